@@ -17,9 +17,30 @@ struct Map_Memory
     float ADIF_map_bearing;
 };
 
+// Worked.bin, the worked-before index, holds one of these per logged QSO, oldest first,
+// so the calls can be loaded at power up without reading the ADIF files
+struct __attribute__((packed)) Worked_Record
+{
+    uint32_t key;    // call_key() of the call
+    uint32_t time;   // UTC, seconds since 1970
+    char grid[4];    // four character locator, or blanks
+    uint8_t band;    // BandIndex
+    uint8_t reserved[3];
+};
+
+// Draw the next map into off-screen display memory, true once all of them are there. From then
+// on draw_map() only has to copy one, until then it draws the map from its image.
+bool preload_next_map(void);
 void draw_map(int16_t index);
+// Mark the stations of the last slot's decodes on the map, and fade those heard before
+void plot_heard_stations(const struct Decode *decodes, int num_decodes);
 void write_ADIF_Log(void);
 void Init_Log_File(void);
+// Write the buffered log records to the card, done in the quiet part of RX slots, before a
+// band change and when the ON/OFF button is pressed
+void flush_ADIF_Log(void);
+// Mark every station in Worked.bin as worked on its band, done once at startup
+void load_Worked_Index(void);
 
 void set_Station_Coordinates();
 float Target_Distance(const char *target);
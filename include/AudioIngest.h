@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Audio.h>
+#include "arm_math.h"
+
+#include "filters.h"
+
+// Audio sink for the FT8 receiver. Takes the 32 kHz stream from the codec, mixes the 10 kHz
+// IF down, selects the upper sideband and decimates by 5 as the blocks arrive, into a ring
+// of 6.4 kHz samples the spectrogram reads in place.
+//
+// The mixer, the FIR_I / FIR_Q phasing pair and the decimation low pass are folded into one
+// filter per phase of the 10 kHz LO, which is periodic in 16 samples. As 5 and 16 are
+// coprime each kept sample comes out of one real dot product with one of 16 tap sets, and
+// the samples decimation throws away are never worked out.
+//
+// Output 0 is the same sideband back at 32 kHz, for the receive monitor on the codec's
+// line out and headphones. It is the 6.4 kHz samples through FIR_Decimate again as a 5 times
+// interpolator, 47 taps an output sample, and runs a stage (20 ms) behind the input.
+class AudioIngest : public AudioStream
+{
+public:
+    AudioIngest(void);
+
+    void begin(void);
+    virtual void update(void);
+
+    // Receive gain, as AudioAmplifier::gain() gave it ahead of the old decimator
+    void gain(float level);
+
+    // Decimated samples not yet taken by take_gulp()
+    int available(void);
+
+    // Take the next gulp_samples samples and return the last window_samples samples
+    // received, ending with them, as one contiguous run
+    q15_t *take_gulp(void);
+
+    static const int gulp_samples = 1024;   // FFT_BASE_SIZE
+    static const int window_samples = 3072; // FFT_BASE_SIZE * 3
+    static const int decimation = 5;
+    static const int ring_samples = 8192; // stored twice over, so any window is contiguous
+
+    uint32_t overruns; // gulps dropped because the main loop fell a whole ring behind
+
+    static const int lo_period = 16; // 10 kHz at 32 kHz
+    static const int taps = NUM_DECIMATE_COEFFS + NUM_COEFFS - 1;
+    static const int monitor_taps = (NUM_DECIMATE_COEFFS + decimation - 1) / decimation;
+
+private:
+    static const int stage_samples = AUDIO_BLOCK_SAMPLES * decimation;
+    static const int monitor_samples = 512; // power of two, over a stage and monitor_taps
+
+    void decimate_stage(void);
+    void send_monitor(void);
+
+    audio_block_t *inputQueueArray[1];
+
+    // Input blocks gathered until there is a whole number of output samples per block,
+    // behind the last taps - 1 samples of the one before. stage_samples is a multiple of
+    // lo_period, so the LO phase of each position in it is always the same.
+    float32_t history[taps - 1 + stage_samples];
+    int staged;
+
+    volatile float gain_level;
+
+    // 6.4 kHz samples before the receive gain, as the old monitor mixers had them
+    float32_t monitor[monitor_samples];
+    uint32_t monitor_written;
+    uint32_t monitor_read; // newest sample the next output sample is made from
+    int monitor_phase;     // of that output sample, 0 to decimation - 1
+
+    volatile uint32_t write_count; // written in update(), from the audio interrupt
+    uint32_t read_count;
+    bool recording;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+// Recently decoded full callsigns, for unpacking the 10, 12 and 22 bit hashes FT8 sends in
+// place of a call that does not fit a standard message, e.g. <PJ4/K1ABC>. Every call that
+// unpacks in full is entered. The table holds a fixed number of calls and drops the oldest
+// to make room for another; the station's own call is kept apart and never dropped.
+
+const int kCall_hash_capacity = 128;
+
+// The WSJT-X ihashcall() hash of a call of up to 11 characters, in 22 bits. Its top 12 and
+// 10 bits are the shorter hashes.
+uint32_t call_hash22(const char *call);
+
+void call_hash_clear(void);
+void call_hash_set_own(const char *call);
+// Add a call, or make it the most recent if it is held already
+void call_hash_insert(const char *call);
+
+// The call hash was made from, or NULL if it is not held
+const char *call_hash_lookup22(uint32_t hash);
+const char *call_hash_lookup12(uint32_t hash);
+const char *call_hash_lookup10(uint32_t hash);
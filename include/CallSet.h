@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+// Set of callsigns keyed on their 28 bit pack28() value, for constant time "called before"
+// and "worked before" checks. Calls that do not pack, such as compound calls, are keyed on
+// a hash of their text with the top bit set, clear of every pack28() value.
+// Once capacity calls are held, inserting another drops the one used least recently.
+struct Call_Set
+{
+    uint32_t *keys;      // 0 marks an empty slot
+    uint32_t *last_used; // value of clock when the call was last inserted
+    int size;            // slots, a power of two above capacity
+    int capacity;
+    int count;
+    uint32_t clock;
+    uint32_t evicted; // calls dropped to make room since the last call_set_clear()
+};
+
+void call_set_init(Call_Set *set, uint32_t *keys, uint32_t *last_used, int size, int capacity);
+void call_set_clear(Call_Set *set);
+
+uint32_t call_key(const char *call);
+// Key of a call on a band, for sets that tell the bands apart. Bits 28 to 30 hold the band.
+uint32_t call_band_key(uint32_t key, int band);
+
+bool call_set_contains(const Call_Set *set, const char *call);
+bool call_set_contains_key(const Call_Set *set, uint32_t key);
+// Add a call, or mark it as the most recently used if it is there already
+void call_set_insert(Call_Set *set, const char *call);
+void call_set_insert_key(Call_Set *set, uint32_t key);
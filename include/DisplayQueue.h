@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+// Text, fills and waterfall rows are queued and drawn by service_display() when the loop
+// has time, so the audio and decode paths do not wait on SPI to the LCD. A command that
+// lands exactly where the last queued command touching that area did replaces it, so
+// something redrawn before the screen caught up, such as the clock, is only drawn once.
+
+void display_text(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length);
+void display_fill(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t colour);
+// Draw a text straight away, after what is queued
+void display_text_now(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length);
+// One row of pixels, copied into the queue
+void display_row(int16_t x, int16_t y, int16_t width, const uint16_t *pixels);
+
+// The texts queued or drawn are remembered by place, and drawing the same text in the same
+// colours at the same place again is skipped. Drawing over a place forgets what was there,
+// and display_invalidate() does the same for drawing done straight on the screen.
+bool display_text_shown(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length);
+void display_invalidate(int16_t x, int16_t y, int16_t width, int16_t height);
+
+// Start queueing, until then every command is drawn straight away
+void display_queue_begin(void);
+
+// Draw queued commands, oldest first, until budget_us has passed
+void service_display(uint32_t budget_us);
+
+// Draw everything queued, needed before drawing on the screen directly
+void flush_display(void);
+
+// Whether anything is queued still
+bool display_pending(void);
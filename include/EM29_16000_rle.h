@@ -0,0 +1,4568 @@
+// Generated by maps/compress_map.py from EM29_16000.h, do not edit
+// Image Size : 432x427 pixels, 72250 bytes compressed from 368928
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t EM29_16000_palette[16] PROGMEM = {
+0xFFFF, 0x0021, 0x867C, 0x5B4D, 0x9D14, 0x6D16, 0xCE9A, 0x29E8,
+0x7410, 0x42AA, 0x7DB9, 0xE73C, 0x1125, 0x9E9C, 0xB5D7, 0x8E5C};
+
+const uint32_t EM29_16000_rows[427] PROGMEM = {
+0, 11, 26, 46, 71, 106, 144, 180, 224, 287, 366, 438,
+519, 592, 685, 786, 886, 992, 1094, 1186, 1274, 1366, 1458, 1545,
+1638, 1735, 1845, 1961, 2083, 2197, 2333, 2484, 2629, 2771, 2911, 3047,
+3157, 3272, 3381, 3515, 3644, 3763, 3882, 4013, 4159, 4298, 4428, 4568,
+4692, 4822, 4959, 5111, 5264, 5430, 5582, 5741, 5916, 6078, 6229, 6399,
+6561, 6719, 6883, 7024, 7169, 7305, 7440, 7583, 7740, 7906, 8053, 8195,
+8329, 8477, 8654, 8821, 8972, 9138, 9291, 9455, 9631, 9808, 9984, 10158,
+10336, 10497, 10662, 10825, 11002, 11178, 11371, 11569, 11769, 11973, 12164, 12354,
+12541, 12727, 12909, 13101, 13300, 13480, 13657, 13844, 14035, 14227, 14425, 14618,
+14807, 15003, 15192, 15389, 15588, 15803, 16019, 16215, 16411, 16624, 16836, 17047,
+17267, 17507, 17731, 17954, 18178, 18401, 18616, 18853, 19085, 19316, 19549, 19791,
+20027, 20273, 20502, 20737, 20983, 21220, 21457, 21705, 21941, 22175, 22391, 22594,
+22805, 23049, 23285, 23528, 23754, 23957, 24176, 24397, 24603, 24843, 25070, 25296,
+25523, 25757, 25969, 26185, 26421, 26639, 26844, 27061, 27274, 27487, 27714, 27935,
+28159, 28392, 28623, 28851, 29088, 29316, 29534, 29755, 29983, 30195, 30419, 30657,
+30890, 31128, 31364, 31601, 31824, 32057, 32284, 32498, 32726, 32944, 33148, 33353,
+33554, 33770, 33965, 34162, 34362, 34553, 34750, 34946, 35129, 35323, 35499, 35675,
+35860, 36036, 36215, 36401, 36575, 36747, 36919, 37114, 37263, 37375, 37498, 37648,
+37822, 37987, 38164, 38325, 38477, 38622, 38769, 38935, 39092, 39250, 39425, 39590,
+39773, 39959, 40138, 40329, 40522, 40702, 40886, 41070, 41253, 41453, 41636, 41824,
+42020, 42224, 42442, 42666, 42893, 43110, 43338, 43551, 43767, 43988, 44193, 44406,
+44614, 44826, 45050, 45279, 45491, 45693, 45885, 46077, 46278, 46481, 46683, 46877,
+47060, 47248, 47421, 47607, 47811, 48005, 48196, 48385, 48588, 48783, 48976, 49172,
+49362, 49562, 49766, 49961, 50167, 50368, 50577, 50780, 50998, 51209, 51424, 51632,
+51851, 52063, 52292, 52509, 52719, 52937, 53152, 53367, 53581, 53793, 54006, 54211,
+54420, 54636, 54834, 55048, 55243, 55454, 55654, 55857, 56064, 56260, 56457, 56675,
+56880, 57083, 57297, 57501, 57694, 57895, 58093, 58301, 58504, 58711, 58910, 59135,
+59341, 59544, 59745, 59945, 60121, 60314, 60511, 60697, 60893, 61080, 61254, 61443,
+61636, 61806, 61990, 62186, 62384, 62570, 62744, 62929, 63121, 63314, 63505, 63677,
+63852, 64050, 64236, 64436, 64621, 64786, 64950, 65115, 65265, 65425, 65591, 65764,
+65923, 66084, 66212, 66335, 66473, 66629, 66785, 66934, 67089, 67259, 67430, 67597,
+67767, 67920, 68083, 68230, 68376, 68525, 68679, 68811, 68942, 69069, 69183, 69285,
+69389, 69478, 69556, 69648, 69737, 69834, 69920, 70002, 70091, 70184, 70265, 70345,
+70418, 70490, 70563, 70622, 70682, 70741, 70793, 70841, 70896, 70959, 71030, 71100,
+71166, 71250, 71334, 71423, 71515, 71604, 71684, 71762, 71833, 71912, 71980, 72022,
+72069, 72114, 72160, 72194, 72216, 72232, 72245};
+
+const uint8_t EM29_16000_data[72250] PROGMEM = {
+0x0F, 0xC8, 0x80, 0x70, 0xE0, 0x00, 0x60, 0x30, 0x80, 0x0F, 0xC1, 0x0F, 0xAD, 0xE0, 0x60, 0x0F,
+0x08, 0x81, 0x00, 0xC0, 0xB0, 0x80, 0xE0, 0x30, 0x0F, 0xC1, 0x0F, 0xA9, 0x60, 0xB0, 0x00, 0x60,
+0x81, 0x60, 0x0F, 0x07, 0x70, 0x60, 0x00, 0x30, 0x40, 0x00, 0x80, 0xE0, 0x0F, 0xC1, 0x0F, 0xA3,
+0xE0, 0x30, 0xC0, 0xE0, 0x00, 0x91, 0xC0, 0xE0, 0xB0, 0x91, 0xB0, 0x0F, 0x07, 0x70, 0xB0, 0x00,
+0x81, 0x0F, 0x0F, 0x40, 0x80, 0x0F, 0xA3, 0x0F, 0x9E, 0x60, 0x30, 0x40, 0x00, 0xB0, 0xC0, 0xE0,
+0x01, 0x60, 0x70, 0x00, 0xB0, 0x70, 0x0F, 0x0B, 0x70, 0x60, 0x00, 0x81, 0x0F, 0x0D, 0xB0, 0x70,
+0x10, 0x40, 0x01, 0x30, 0x70, 0x30, 0x01, 0x41, 0x0F, 0x9A, 0x0F, 0x9D, 0xB0, 0xC0, 0x60, 0x30,
+0x80, 0x00, 0x70, 0xE0, 0x80, 0xB0, 0x60, 0x70, 0x01, 0x70, 0x60, 0x0F, 0x0A, 0x30, 0x40, 0x00,
+0x70, 0x60, 0x0F, 0x0F, 0x90, 0xE0, 0x00, 0x40, 0x30, 0x00, 0x30, 0xE2, 0x80, 0xB0, 0x0F, 0x99,
+0x0F, 0x9D, 0x60, 0x40, 0x00, 0x40, 0x80, 0x00, 0x10, 0x80, 0x40, 0xC0, 0x60, 0x70, 0x01, 0x30,
+0x40, 0x0F, 0x0A, 0x60, 0x71, 0x30, 0x0F, 0x10, 0x70, 0xB0, 0x00, 0x70, 0x60, 0x00, 0x40, 0x80,
+0xB0, 0x31, 0x0F, 0x9A, 0x0F, 0x9F, 0x80, 0x10, 0x30, 0x00, 0xB0, 0x01, 0x90, 0x40, 0x70, 0xB0,
+0x00, 0x30, 0x40, 0x0A, 0x60, 0xE0, 0x41, 0x80, 0x31, 0x93, 0x31, 0x70, 0x32, 0xC0, 0x31, 0x91,
+0x31, 0x93, 0x31, 0x80, 0x41, 0xE0, 0xB0, 0x0F, 0x00, 0x70, 0x01, 0xC0, 0x01, 0x81, 0x0F, 0x9D,
+0x0F, 0xA1, 0x70, 0xE0, 0x80, 0xB0, 0x00, 0x70, 0x61, 0xC0, 0x40, 0x70, 0x01, 0x60, 0x41, 0x31,
+0x93, 0x10, 0x80, 0xE0, 0x40, 0x80, 0xB0, 0x00, 0x30, 0x02, 0x90, 0x01, 0x80, 0xB0, 0x00, 0xE0,
+0x10, 0xB0, 0x00, 0xE0, 0x40, 0x01, 0x90, 0x01, 0x60, 0x40, 0x00, 0xB0, 0x30, 0x41, 0x80, 0xC0,
+0x31, 0x90, 0x32, 0x41, 0x60, 0x04, 0x60, 0x90, 0x01, 0xC0, 0x01, 0x90, 0x60, 0x0F, 0x9D, 0x0F,
+0x89, 0x40, 0xE0, 0x0F, 0x03, 0x80, 0xB0, 0x00, 0x90, 0xE1, 0x70, 0x90, 0x80, 0x60, 0xE0, 0x30,
+0x70, 0x30, 0x70, 0x90, 0x40, 0xE0, 0x90, 0xB0, 0x00, 0xE0, 0x40, 0x01, 0x30, 0x01, 0xB0, 0x80,
+0x01, 0x30, 0xB0, 0x01, 0x90, 0x01, 0x80, 0xB0, 0x00, 0xE0, 0x10, 0xB0, 0x00, 0xE0, 0x40, 0x01,
+0x90, 0x01, 0xE0, 0x40, 0x01, 0x80, 0xB0, 0x00, 0xB0, 0x80, 0x01, 0x30, 0xB0, 0x01, 0x70, 0xE0,
+0x80, 0x90, 0x70, 0x30, 0x80, 0x40, 0x81, 0x01, 0x70, 0xB0, 0x60, 0xC0, 0x0F, 0x9E, 0x0F, 0x88,
+0xE0, 0x81, 0x60, 0x0F, 0x02, 0x40, 0x90, 0x30, 0x70, 0xB0, 0xE0, 0x30, 0xC0, 0x90, 0x41, 0x90,
+0xB0, 0x00, 0xE1, 0x01, 0x90, 0x01, 0x60, 0x40, 0x01, 0x80, 0xB0, 0x01, 0x80, 0x01, 0x80, 0xB0,
+0x01, 0x90, 0x01, 0x80, 0xE0, 0x00, 0x40, 0x10, 0x60, 0x00, 0x41, 0x00, 0xB0, 0x90, 0x01, 0xE1,
+0x01, 0x30, 0x01, 0x60, 0x40, 0x01, 0x30, 0x02, 0x90, 0x01, 0x80, 0x60, 0x00, 0x60, 0x70, 0x41,
+0x71, 0x90, 0xC1, 0xE0, 0x0F, 0x9E, 0x0F, 0x84, 0xB0, 0x70, 0xC0, 0xE0, 0xB0, 0x90, 0x30, 0xB0,
+0x0F, 0x01, 0xB0, 0x40, 0x71, 0x80, 0xC0, 0xE0, 0x00, 0x10, 0x90, 0x01, 0x30, 0x01, 0xB0, 0x80,
+0x01, 0x30, 0x01, 0xB0, 0x80, 0x00, 0xB0, 0x31, 0x80, 0x30, 0x10, 0x91, 0x70, 0x90, 0x30, 0x91,
+0x30, 0x93, 0x30, 0x92, 0x30, 0x91, 0x30, 0x93, 0x70, 0x91, 0x10, 0x30, 0x80, 0x30, 0x80, 0xB0,
+0x00, 0x30, 0x01, 0xB0, 0x80, 0x01, 0x90, 0x01, 0xB0, 0x30, 0x01, 0x10, 0x70, 0x00, 0xE0, 0xC0,
+0x80, 0x90, 0x30, 0x40, 0xB0, 0x0F, 0x9A, 0x0F, 0x81, 0xE0, 0x01, 0x70, 0xB0, 0x00, 0xC0, 0x60,
+0x0F, 0x00, 0x40, 0x30, 0x91, 0x80, 0x90, 0xB0, 0x01, 0x90, 0x01, 0x90, 0x10, 0x01, 0x30, 0x02,
+0x90, 0xE0, 0x80, 0x70, 0x92, 0x71, 0x31, 0x50, 0xA0, 0xF0, 0xDD, 0x50, 0xDD, 0xF0, 0xA0, 0x80,
+0x30, 0x90, 0x71, 0x92, 0x70, 0x80, 0xE0, 0x70, 0x01, 0xB0, 0x80, 0x00, 0xB0, 0x10, 0x80, 0x01,
+0x30, 0x01, 0x40, 0x30, 0x80, 0x91, 0x80, 0xE0, 0x0F, 0x03, 0xE0, 0xC0, 0x70, 0x60, 0x0F, 0x7F,
+0x0F, 0x81, 0x10, 0xE0, 0x00, 0x70, 0xB0, 0x00, 0x40, 0x90, 0x0A, 0xB0, 0xE0, 0x80, 0x70, 0x90,
+0x40, 0xB0, 0x90, 0x01, 0x41, 0x01, 0x80, 0x01, 0x80, 0x10, 0x41, 0x70, 0x90, 0x70, 0x90, 0x30,
+0x80, 0xA1, 0xF2, 0xD2, 0xA1, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0x20, 0xF0, 0x24,
+0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0xF0, 0xD3, 0xF1, 0xA0, 0x50, 0x80, 0x30, 0x92, 0x30,
+0xE0, 0x40, 0x10, 0x40, 0x00, 0x60, 0x40, 0x01, 0x80, 0x60, 0x01, 0x90, 0xB0, 0x40, 0x70, 0x90,
+0x80, 0xE0, 0xB0, 0x0D, 0x30, 0x60, 0xB0, 0x70, 0xB0, 0x00, 0xB0, 0x0F, 0x7C, 0x0F, 0x7B, 0x60,
+0x80, 0xE0, 0x01, 0x60, 0xC0, 0x90, 0x00, 0x30, 0x40, 0x00, 0xB0, 0xC0, 0x07, 0x60, 0x80, 0x90,
+0x70, 0x40, 0xB0, 0x40, 0xE0, 0x01, 0x30, 0x01, 0xB0, 0x80, 0x00, 0xB0, 0x31, 0x91, 0x70, 0x80,
+0x51, 0xF0, 0xD3, 0xF0, 0xD0, 0xF2, 0xD0, 0xF0, 0xD0, 0xA1, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0,
+0x20, 0xF2, 0x21, 0xF1, 0x50, 0xF0, 0x20, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x50,
+0x20, 0xD1, 0xF1, 0xD1, 0xF0, 0xD4, 0xA0, 0x51, 0x30, 0x70, 0x92, 0x80, 0xB0, 0x00, 0x30, 0x01,
+0xB0, 0x30, 0x01, 0x80, 0x61, 0x40, 0x70, 0x30, 0x40, 0x60, 0x0D, 0x70, 0xB0, 0x80, 0x71, 0x60,
+0x0F, 0x7A, 0x0F, 0x7A, 0x60, 0xC0, 0xE0, 0xC0, 0x60, 0x00, 0x80, 0x60, 0x70, 0x00, 0x60, 0x70,
+0x01, 0x70, 0x04, 0xE0, 0x90, 0x70, 0x30, 0x60, 0x00, 0x90, 0x01, 0xB0, 0x80, 0x01, 0x40, 0xE0,
+0x60, 0x30, 0xC0, 0x91, 0x80, 0x50, 0xF0, 0xD0, 0xA0, 0xD1, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0x20,
+0xF2, 0xA1, 0xF5, 0x22, 0xF3, 0x20, 0xF1, 0x50, 0xD0, 0x20, 0xF1, 0x28, 0xF2, 0x50, 0xF8, 0x23,
+0xF0, 0xD1, 0xF0, 0xA0, 0xD1, 0x50, 0x80, 0x91, 0x10, 0x80, 0x60, 0x40, 0xE0, 0x01, 0x30, 0x02,
+0x30, 0x00, 0xE0, 0x30, 0x70, 0x30, 0xE0, 0x08, 0x60, 0xC0, 0x80, 0x60, 0xC0, 0x00, 0x60, 0x90,
+0x00, 0x40, 0x30, 0xB0, 0x0F, 0x76, 0x0F, 0x7A, 0x41, 0x00, 0x30, 0x60, 0x00, 0x90, 0x00, 0x90,
+0x70, 0x60, 0x70, 0x80, 0x60, 0x70, 0x00, 0xB0, 0x80, 0x30, 0x10, 0x40, 0x00, 0xB0, 0x80, 0x01,
+0x80, 0xB0, 0x01, 0x90, 0x40, 0x30, 0x90, 0x70, 0x80, 0xA0, 0xD4, 0xF0, 0xD0, 0x50, 0xF3, 0x20,
+0xF1, 0x23, 0xF4, 0x20, 0xA0, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF2, 0x20, 0xF2, 0x50, 0xF0, 0x20,
+0xF1, 0x21, 0xF1, 0x23, 0xF3, 0x50, 0xF1, 0x20, 0xF4, 0x24, 0xF2, 0xA1, 0xF1, 0xD4, 0x50, 0x30,
+0x70, 0x90, 0x30, 0x40, 0x30, 0x01, 0xE0, 0x40, 0x01, 0x30, 0x01, 0x80, 0x10, 0x30, 0x40, 0x03,
+0x40, 0xC0, 0x70, 0x60, 0x00, 0x70, 0x60, 0x00, 0x60, 0x70, 0x00, 0x80, 0x60, 0x40, 0x0F, 0x76,
+0x0F, 0x7C, 0x40, 0xC0, 0x70, 0xE0, 0xC0, 0x72, 0x01, 0x80, 0xC0, 0x30, 0x91, 0x60, 0x00, 0x30,
+0x02, 0x90, 0x01, 0xE0, 0x30, 0x80, 0x91, 0x50, 0xA0, 0xD2, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0xA1, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x22,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x23, 0xF2, 0xD0, 0x50, 0xF1, 0x22, 0xF2,
+0x23, 0xF2, 0xD0, 0xA1, 0xF2, 0x22, 0xF1, 0xD2, 0xA0, 0x50, 0x91, 0x80, 0x70, 0x60, 0x01, 0x30,
+0x01, 0x60, 0x80, 0x00, 0xE0, 0x70, 0x90, 0x40, 0x80, 0x10, 0x40, 0x01, 0xB0, 0xC0, 0x01, 0x81,
+0x00, 0x80, 0x30, 0xB0, 0x0F, 0x76, 0x0F, 0x7E, 0x40, 0x90, 0xE0, 0xB0, 0x00, 0x30, 0x60, 0x40,
+0x90, 0x40, 0x60, 0xB0, 0x30, 0x01, 0x40, 0xE0, 0x01, 0x90, 0x30, 0x90, 0x31, 0xA0, 0xF0, 0xD1,
+0xF0, 0x29, 0xF0, 0xA1, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF1,
+0x23, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x23, 0xF3, 0x50, 0xD0, 0xF0, 0x20,
+0xF1, 0x26, 0xF2, 0xD0, 0x50, 0x20, 0xF1, 0x23, 0xF4, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0x31, 0x90,
+0x31, 0x01, 0x40, 0x60, 0x01, 0x30, 0xB0, 0x60, 0x30, 0xC2, 0xE0, 0xB0, 0x90, 0x01, 0x70, 0xB0,
+0x0F, 0x7A, 0x0F, 0x7B, 0xB0, 0xE0, 0x00, 0xE0, 0x30, 0x01, 0xE0, 0x31, 0xE0, 0x80, 0x60, 0x01,
+0x30, 0x02, 0xC0, 0x30, 0x90, 0x30, 0x50, 0xD1, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x21, 0xF3, 0x20,
+0xF1, 0x50, 0xF4, 0x24, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x21, 0xF4, 0x50, 0xD0, 0xF4, 0x25, 0xF2, 0xD0, 0x50, 0xF1,
+0x23, 0xF2, 0x22, 0xF3, 0xA1, 0xD1, 0x50, 0x30, 0x90, 0x30, 0x70, 0x01, 0xB0, 0x80, 0x01, 0x41,
+0x60, 0x30, 0x70, 0xE0, 0x70, 0x60, 0x90, 0x30, 0x0F, 0x7B, 0x0F, 0x7B, 0xB0, 0xC0, 0x71, 0xE0,
+0x30, 0x91, 0x10, 0x60, 0x00, 0x60, 0x80, 0x01, 0x80, 0x31, 0x70, 0x50, 0xF0, 0xD2, 0xF0, 0xD0,
+0xA0, 0x20, 0xF0, 0x23, 0xF7, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x27, 0xF0, 0x22, 0xF1, 0x50, 0xD0,
+0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x22, 0xF2, 0x21,
+0x50, 0xD0, 0xFA, 0x21, 0xF1, 0x50, 0xD0, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0,
+0xA1, 0xD0, 0xF0, 0xD2, 0xF0, 0x80, 0x70, 0x30, 0x70, 0x60, 0x01, 0x30, 0xB0, 0x00, 0x40, 0x10,
+0x80, 0x30, 0x10, 0x80, 0x0F, 0x7C, 0x0F, 0x7C, 0xB0, 0x80, 0x30, 0x90, 0x40, 0x01, 0x10, 0x90,
+0x01, 0x90, 0x40, 0x70, 0x90, 0x50, 0xF0, 0xD1, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF0,
+0x22, 0xF2, 0x20, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF0, 0x24, 0xF0, 0x22, 0xF1, 0x50,
+0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x26, 0xF3, 0x20, 0xA0, 0xD0,
+0x21, 0xF7, 0x22, 0xF0, 0xA1, 0xD0, 0xF2, 0x21, 0xF0, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0xA0,
+0xF2, 0x21, 0xF1, 0xD1, 0xF0, 0x50, 0x91, 0x40, 0x90, 0x01, 0x70, 0x10, 0x01, 0x81, 0x30, 0x40,
+0x0F, 0x7A, 0x0F, 0x7A, 0x60, 0x30, 0xC0, 0x60, 0x01, 0x30, 0x01, 0x90, 0x10, 0xE0, 0x91, 0x50,
+0xF0, 0xD0, 0xF1, 0xD0, 0xF2, 0x23, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x20, 0xF6, 0x21, 0xD0, 0xA1,
+0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF1, 0xA0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x22,
+0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x25, 0xF4, 0xA1, 0xD0, 0x27, 0xF1, 0x22, 0xF0, 0xA1, 0xF0, 0x24,
+0xF1, 0x23, 0xF3, 0x50, 0xD0, 0xF0, 0x23, 0xF2, 0xD2, 0xF0, 0x50, 0x90, 0x30, 0xE0, 0x10, 0x80,
+0x01, 0x90, 0x01, 0xE0, 0xC0, 0x80, 0xB0, 0x0F, 0x77, 0x0F, 0x78, 0x40, 0x90, 0x80, 0xB0, 0x40,
+0xE0, 0x01, 0x30, 0x00, 0x60, 0x70, 0xC0, 0x80, 0xF0, 0xD1, 0x22, 0xF3, 0x20, 0xF0, 0x22, 0xF0,
+0x50, 0xF5, 0x20, 0xF0, 0x22, 0xF0, 0x21, 0xF1, 0xA1, 0xF1, 0x20, 0xF1, 0x27, 0xF1, 0xA1, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x26, 0xF2, 0xD0, 0xA1,
+0xD0, 0xF2, 0x24, 0xF1, 0x22, 0xF0, 0xA0, 0xF1, 0x24, 0xF0, 0x26, 0xF1, 0x50, 0xD0, 0xF1, 0x23,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0x80, 0xC0, 0x90, 0xB0, 0x60, 0x80, 0x01, 0x40, 0xE0,
+0x60, 0x80, 0x90, 0xE0, 0x0F, 0x75, 0x0F, 0x66, 0xE0, 0x30, 0x90, 0x0B, 0xB0, 0x80, 0x90, 0x40,
+0x90, 0x02, 0x90, 0x00, 0x60, 0x90, 0xC0, 0x30, 0xD0, 0xA0, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x29,
+0xF0, 0xA1, 0xF0, 0x20, 0xF1, 0x29, 0xF1, 0xA0, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x22,
+0xF1, 0xA1, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x25,
+0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0xF0, 0xD3, 0x24, 0xF1, 0x21, 0xF1, 0x50, 0xD0, 0xF0, 0x2C, 0xD0,
+0xA0, 0x20, 0xF0, 0x25, 0xF3, 0x21, 0xF1, 0xD0, 0xA0, 0xF0, 0xA0, 0x30, 0xC0, 0x30, 0x01, 0x90,
+0x02, 0x90, 0x40, 0x90, 0x80, 0x0F, 0x73, 0x0F, 0x64, 0x60, 0x00, 0xE0, 0x80, 0x30, 0xB0, 0x08,
+0x60, 0x30, 0x70, 0x40, 0x01, 0x80, 0x60, 0x01, 0x70, 0x91, 0xA0, 0xD1, 0xF1, 0x50, 0xD0, 0xF5,
+0x25, 0xF0, 0x20, 0xF1, 0xA0, 0xF2, 0x27, 0xF0, 0x20, 0xF0, 0xD0, 0x20, 0x50, 0xD0, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0xA1, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF2, 0x50,
+0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0xD0, 0x50, 0x30, 0x80, 0x30, 0x90, 0x30, 0x91, 0x50,
+0xD0, 0x23, 0xF4, 0x50, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0x23, 0xD0, 0x50, 0x20, 0xF1, 0x24, 0xF2,
+0x20, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0xD2, 0xA0, 0x90, 0x70, 0x30, 0x01, 0x40, 0xE0, 0x01, 0x30,
+0x90, 0x30, 0xB0, 0x0F, 0x70, 0x0F, 0x62, 0xB0, 0x91, 0x70, 0xB0, 0x61, 0x07, 0x60, 0x90, 0x80,
+0xB0, 0x00, 0x90, 0x02, 0x90, 0x50, 0x70, 0x50, 0xA0, 0xD1, 0xF1, 0xD0, 0xF0, 0x50, 0xF2, 0x22,
+0xF0, 0x26, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0xA1, 0xF0, 0x20, 0xF2, 0x22, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF3, 0x70, 0x40, 0x90, 0x01, 0xB0, 0x00, 0xB0, 0x80,
+0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x50, 0xD0, 0x21, 0xF3, 0x20, 0xF3, 0x21, 0xF1, 0x50,
+0xF0, 0x20, 0xF0, 0x28, 0xF0, 0x20, 0xF1, 0x20, 0x50, 0xD0, 0xF2, 0xD1, 0xA0, 0x80, 0x70, 0x40,
+0x90, 0x02, 0x30, 0x00, 0xB0, 0x31, 0xB0, 0x0F, 0x6E, 0x0F, 0x62, 0x80, 0x40, 0x00, 0x40, 0x70,
+0x07, 0x60, 0x90, 0x81, 0xE0, 0x01, 0x40, 0xE0, 0xB0, 0x91, 0x50, 0xD1, 0xF1, 0x21, 0xF0, 0x20,
+0xD0, 0xA1, 0xD0, 0xF3, 0xD0, 0x22, 0xF0, 0x20, 0xD4, 0xA0, 0xF2, 0x22, 0xF0, 0x22, 0xF0, 0x21,
+0xF0, 0x20, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x25, 0xF0, 0xD1, 0xC0, 0x70,
+0x41, 0x03, 0xB0, 0x90, 0xD0, 0xF0, 0x22, 0xF3, 0xA0, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xF2, 0x21,
+0xF0, 0xA1, 0xD0, 0x20, 0xF1, 0x22, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF2, 0x20, 0xF2,
+0xD1, 0x80, 0x90, 0x30, 0xB0, 0x40, 0xE0, 0x01, 0x80, 0x40, 0x80, 0x90, 0xB0, 0x0A, 0x90, 0xC0,
+0x80, 0x0F, 0x5E, 0x0F, 0x5F, 0x60, 0xE0, 0x00, 0x40, 0x30, 0x01, 0x90, 0x40, 0x04, 0x40, 0x90,
+0xC0, 0x02, 0x90, 0x01, 0x80, 0xC0, 0x90, 0xF0, 0xD1, 0xF0, 0x20, 0xD0, 0xF0, 0x23, 0xF1, 0x50,
+0xF0, 0xD6, 0x20, 0xF0, 0xD0, 0x50, 0x90, 0x70, 0x10, 0xD0, 0xA1, 0xD0, 0xF0, 0x24, 0xF3, 0x21,
+0xF0, 0xD0, 0xA1, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x27, 0xF0, 0xD0, 0x30, 0x70, 0x40, 0x03, 0x40,
+0x90, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xA1, 0xF0, 0x2C, 0xD0, 0x50, 0xF1, 0x24, 0xF9, 0x50,
+0xF3, 0x23, 0xF1, 0xD1, 0xA0, 0x90, 0xC0, 0x40, 0x01, 0x90, 0x02, 0x10, 0x30, 0x60, 0x08, 0xE0,
+0x00, 0x30, 0x40, 0x0F, 0x5D, 0x0F, 0x5E, 0x80, 0x91, 0x30, 0x00, 0xC0, 0xB0, 0x00, 0x60, 0x70,
+0x02, 0x40, 0x70, 0x40, 0x00, 0xE0, 0x40, 0x01, 0x40, 0x30, 0x70, 0x80, 0xD1, 0xF0, 0x20, 0xF0,
+0x20, 0xF1, 0xD2, 0xF0, 0xD0, 0xF0, 0xD0, 0x50, 0xF1, 0x50, 0x30, 0x90, 0xC0, 0x90, 0x50, 0xD1,
+0x80, 0x70, 0x90, 0x50, 0xE0, 0xD0, 0xF0, 0x50, 0xF0, 0xD2, 0x21, 0xF1, 0x20, 0xD1, 0xF0, 0xD0,
+0xF1, 0xA1, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x27, 0xF1, 0xD0, 0x80, 0x70, 0x60, 0x01, 0x40, 0x10,
+0x80, 0xD1, 0xF2, 0xD2, 0x50, 0xD0, 0xF0, 0x2C, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF4, 0x21,
+0xF0, 0xD0, 0xA1, 0xD0, 0xF1, 0x24, 0xF0, 0x22, 0xF0, 0xD1, 0x30, 0x91, 0x60, 0x01, 0x30, 0xB0,
+0x00, 0x80, 0x70, 0xE0, 0x06, 0x61, 0x90, 0xE0, 0x00, 0x80, 0x40, 0x0F, 0x5A, 0x0F, 0x5B, 0xB0,
+0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40, 0x70, 0x01, 0x70, 0x00, 0x60, 0x90, 0x40, 0x90, 0x02, 0x90,
+0x00, 0x50, 0x90, 0x30, 0xD1, 0xF0, 0x21, 0xF2, 0xD0, 0xA0, 0x30, 0x90, 0xC0, 0x30, 0x50, 0x10,
+0x90, 0xA1, 0x50, 0x10, 0xC0, 0x70, 0x30, 0x90, 0xC0, 0xA2, 0x40, 0x80, 0x30, 0x91, 0x30, 0x80,
+0x30, 0xC0, 0x70, 0x80, 0xD0, 0x20, 0xF0, 0xD1, 0xC0, 0x70, 0xA0, 0xF0, 0xD1, 0xF0, 0x50, 0xF0,
+0x22, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF2, 0x50, 0xF0,
+0x20, 0xF1, 0x20, 0xF4, 0x22, 0xF1, 0xA1, 0x90, 0xC0, 0x10, 0xC0, 0x90, 0xA0, 0x70, 0x51, 0xA1,
+0x31, 0x90, 0x80, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0x21, 0xF2, 0x20, 0x50, 0xD0, 0xF1, 0x23, 0xF3,
+0x22, 0xF0, 0xD0, 0xA0, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x24, 0xF2, 0xD0, 0xF0, 0x30, 0x90, 0x40,
+0xB0, 0x30, 0x02, 0x30, 0x40, 0x30, 0xB0, 0x02, 0x60, 0x00, 0xE0, 0x10, 0x80, 0x00, 0xC0, 0x40,
+0x80, 0x30, 0x0F, 0x59, 0x0F, 0x5A, 0x90, 0xC0, 0x90, 0x00, 0xE0, 0x00, 0x90, 0xC0, 0x70, 0xB0,
+0x30, 0x70, 0x90, 0x80, 0x30, 0x90, 0x01, 0x41, 0x01, 0x90, 0x70, 0x80, 0xD0, 0x50, 0xA0, 0xD4,
+0x50, 0xA1, 0x10, 0xC0, 0x90, 0x30, 0xD1, 0x80, 0x40, 0xD0, 0x50, 0xD0, 0xA0, 0x50, 0x91, 0x70,
+0x91, 0x31, 0x80, 0x60, 0x01, 0x60, 0x80, 0x30, 0x80, 0x90, 0x70, 0xA0, 0xF3, 0xD0, 0x50, 0x30,
+0x50, 0xC0, 0x51, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x23, 0xF3, 0x50, 0xF0, 0x20, 0xF1,
+0x27, 0xF2, 0x50, 0xF0, 0x22, 0xF6, 0x21, 0xF1, 0x50, 0xD1, 0x50, 0x80, 0xC0, 0x80, 0x40, 0x11,
+0x81, 0x30, 0xE0, 0x00, 0xB0, 0x40, 0x80, 0x90, 0xD1, 0x23, 0xF1, 0x21, 0xF2, 0xA1, 0xD0, 0xF1,
+0x23, 0xF2, 0x22, 0xF0, 0x20, 0xD0, 0x50, 0xD0, 0xF0, 0x23, 0xF3, 0x24, 0xF1, 0xA1, 0xD0, 0x80,
+0x70, 0x30, 0x01, 0x80, 0x60, 0x00, 0xB0, 0x70, 0x30, 0x00, 0xB0, 0xC0, 0x01, 0x90, 0x60, 0x90,
+0x40, 0x01, 0xC0, 0x0F, 0x59, 0x0F, 0x59, 0x81, 0x00, 0x90, 0x60, 0x03, 0x40, 0x30, 0x00, 0x60,
+0x90, 0x30, 0x00, 0x90, 0x02, 0x90, 0x30, 0x70, 0x50, 0xD1, 0xF0, 0xD0, 0x50, 0xD0, 0xA0, 0x90,
+0x80, 0x10, 0xC0, 0x50, 0xD3, 0x80, 0x71, 0x93, 0x30, 0x80, 0x40, 0x07, 0x60, 0x30, 0x70, 0x80,
+0xA0, 0xF0, 0xA0, 0xD1, 0xF1, 0x20, 0xF2, 0xD1, 0x20, 0x50, 0xD1, 0xA0, 0x90, 0xD0, 0xF0, 0xD0,
+0x22, 0xF1, 0x21, 0xF3, 0xD0, 0x50, 0xD0, 0x20, 0xF1, 0x20, 0xF2, 0x24, 0xF1, 0x50, 0xD0, 0xF1,
+0x21, 0xF1, 0x20, 0xF1, 0x22, 0xF1, 0x50, 0xF1, 0xD0, 0xF0, 0x70, 0x81, 0xB0, 0x06, 0xE0, 0x00,
+0x60, 0x70, 0xD0, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x23, 0xF2, 0x22,
+0xF0, 0xA1, 0xF1, 0x23, 0xF2, 0x25, 0xF0, 0xD0, 0x50, 0xD0, 0xF0, 0xD1, 0x50, 0x70, 0x31, 0x01,
+0xB0, 0x30, 0x00, 0x90, 0x80, 0x90, 0x40, 0xE0, 0xC0, 0xE0, 0xC0, 0x01, 0xE0, 0x90, 0x00, 0x31,
+0xB0, 0x0F, 0x55, 0x0F, 0x59, 0x40, 0xE0, 0xB0, 0x10, 0x70, 0x60, 0x00, 0x60, 0x00, 0x40, 0x30,
+0x80, 0x70, 0x40, 0x01, 0xE0, 0x40, 0x00, 0x80, 0x70, 0x50, 0xD0, 0x21, 0xF0, 0xD1, 0x30, 0x10,
+0x70, 0x90, 0xD2, 0xA0, 0x80, 0x92, 0x40, 0x03, 0x90, 0xC0, 0x70, 0x30, 0x01, 0xE0, 0x62, 0x40,
+0x80, 0x70, 0x30, 0xA0, 0xD2, 0xF0, 0x50, 0xF1, 0x20, 0xF4, 0x21, 0xF3, 0xD0, 0x50, 0xF0, 0x80,
+0xA0, 0xF0, 0x21, 0xF1, 0x21, 0xF3, 0xD0, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x24, 0xF2, 0x50,
+0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0xA0, 0xD2, 0x90, 0x30, 0x08, 0xB0, 0x60, 0x01,
+0x10, 0x30, 0xD0, 0x27, 0xF1, 0x50, 0xF0, 0x21, 0xF1, 0x23, 0xF5, 0xD0, 0x50, 0xF1, 0x20, 0xF0,
+0x22, 0xF2, 0x22, 0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0x22, 0xD1, 0x50, 0x70, 0x80, 0x00, 0x30, 0xB0,
+0x01, 0x30, 0x70, 0x10, 0x30, 0xB0, 0x80, 0x40, 0x01, 0xC0, 0x61, 0x81, 0xE0, 0x0F, 0x55, 0x0F,
+0x5B, 0xB0, 0x60, 0xE0, 0x70, 0xB0, 0x70, 0x90, 0x10, 0x70, 0x60, 0x00, 0x90, 0x02, 0xC0, 0x90,
+0x50, 0xD1, 0xF0, 0x21, 0xD2, 0x50, 0x80, 0x40, 0x80, 0x30, 0x91, 0x30, 0xE0, 0xB1, 0x05, 0x30,
+0x40, 0x81, 0x30, 0x90, 0x71, 0x80, 0x30, 0x51, 0xD1, 0xF0, 0x22, 0xD0, 0x50, 0xF0, 0x21, 0xF2,
+0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0xA0, 0x50, 0x70, 0xA0, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0xD0,
+0x50, 0xF3, 0x26, 0xF3, 0x50, 0xF0, 0x25, 0xF0, 0x23, 0xF0, 0xD0, 0xA1, 0xD0, 0x50, 0x70, 0x80,
+0x06, 0xB0, 0x01, 0x60, 0xB0, 0x01, 0x70, 0x30, 0xD0, 0x22, 0xF0, 0x23, 0xF1, 0xA0, 0xF0, 0x21,
+0xF0, 0x23, 0xF3, 0x21, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x24, 0xF2, 0x50, 0xF0,
+0x20, 0xF0, 0x20, 0xF2, 0xD1, 0x80, 0x91, 0x01, 0xB0, 0x30, 0x00, 0x60, 0x70, 0x60, 0x40, 0x80,
+0x00, 0x90, 0x30, 0x01, 0xE1, 0x0F, 0x56, 0x0F, 0x5E, 0x70, 0xB1, 0x70, 0x11, 0x01, 0xE0, 0x80,
+0xE0, 0x70, 0x50, 0xD0, 0x21, 0xF0, 0xD1, 0x20, 0xF0, 0x80, 0x70, 0x31, 0x80, 0xE0, 0xB0, 0x0A,
+0x40, 0x31, 0x81, 0xA0, 0xD4, 0xF0, 0xD0, 0x24, 0xF0, 0xD0, 0xA0, 0xF1, 0x20, 0xF3, 0x26, 0xF1,
+0x30, 0x10, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0xD0, 0xA0, 0xF3, 0x25, 0xF4, 0x50, 0xF0,
+0x24, 0xF0, 0x23, 0xF1, 0xD0, 0xA2, 0xC0, 0x08, 0xC0, 0x01, 0xE0, 0x03, 0x70, 0xD0, 0xF0, 0x22,
+0xF0, 0x22, 0xF0, 0xA1, 0xF0, 0x21, 0xF0, 0x23, 0xF3, 0x21, 0xD0, 0xA1, 0xF0, 0x21, 0xF2, 0x20,
+0xF1, 0x24, 0xF0, 0xD0, 0xA1, 0xF5, 0x21, 0xD2, 0x80, 0x70, 0x60, 0x30, 0xB0, 0x01, 0x11, 0x30,
+0x90, 0x70, 0x80, 0x0F, 0x5B, 0x0F, 0x5B, 0x90, 0x34, 0x00, 0xE0, 0x10, 0x80, 0x00, 0xE0, 0xC0,
+0x30, 0xD1, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x91, 0x30, 0xE0, 0x01, 0xB0, 0x60, 0x06, 0xB0, 0x80,
+0x30, 0xC1, 0x90, 0x80, 0xD1, 0xF0, 0x50, 0xD0, 0xF2, 0x23, 0xD0, 0xF0, 0x20, 0xF3, 0x20, 0xA0,
+0xF0, 0x22, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0x90, 0x10, 0x50, 0xD0, 0x20, 0xF2, 0x21, 0xF4, 0xA1,
+0xF7, 0x20, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0x28, 0xF2, 0xD0, 0xA2, 0x10, 0xB0, 0x0A, 0x40, 0x03,
+0x90, 0xA0, 0xD0, 0xF0, 0x24, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF0, 0x23, 0xF2, 0x21, 0xF1, 0x50,
+0xF0, 0x23, 0xF2, 0x26, 0xF0, 0xD0, 0x50, 0x21, 0xF3, 0x23, 0xF1, 0xD1, 0x30, 0xC0, 0x60, 0x00,
+0x90, 0x10, 0xB0, 0x00, 0x30, 0x80, 0x0F, 0x5C, 0x0F, 0x5C, 0x40, 0x90, 0x30, 0x40, 0x80, 0x01,
+0x90, 0x10, 0x90, 0x30, 0xD0, 0x51, 0xD2, 0x50, 0x90, 0x30, 0xB0, 0x05, 0xE0, 0x04, 0xE0, 0x10,
+0x70, 0x40, 0xD7, 0x50, 0xD6, 0x30, 0x80, 0xD0, 0xF4, 0xD0, 0x50, 0xF2, 0x26, 0xF0, 0x20, 0xF0,
+0x20, 0xD0, 0x80, 0x10, 0x30, 0xD0, 0xF3, 0x21, 0xF5, 0xA0, 0xD0, 0xF1, 0x21, 0xF5, 0x20, 0xF1,
+0x50, 0xF0, 0x25, 0xF2, 0xD1, 0xF0, 0xD0, 0xA0, 0xD0, 0x40, 0x70, 0x0B, 0xE0, 0x04, 0x70, 0xA0,
+0xD0, 0x24, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0x50, 0xF0,
+0x23, 0xF2, 0x26, 0xF0, 0xA1, 0xF0, 0x20, 0xF2, 0x24, 0xF3, 0xD1, 0x91, 0x10, 0x80, 0x01, 0x30,
+0x40, 0x90, 0xE0, 0x0F, 0x5A, 0x0F, 0x5B, 0xB0, 0x70, 0x40, 0x01, 0x90, 0x01, 0x30, 0xC0, 0xA0,
+0xD0, 0x50, 0xC0, 0xA0, 0x50, 0x90, 0x70, 0x40, 0xB0, 0x07, 0xB0, 0x60, 0x00, 0x60, 0x72, 0x30,
+0x41, 0x30, 0xC0, 0x90, 0x31, 0x70, 0x50, 0xD0, 0x50, 0x70, 0x80, 0x50, 0x80, 0xC0, 0x30, 0x90,
+0x10, 0x30, 0x90, 0xD1, 0x23, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x20,
+0xF0, 0x50, 0x80, 0xF0, 0x20, 0xF0, 0x25, 0xF3, 0x20, 0xA0, 0xD0, 0xF0, 0x23, 0xF4, 0x20, 0xF1,
+0x50, 0xD0, 0xF0, 0x22, 0xF2, 0xD0, 0xA3, 0x31, 0x50, 0x90, 0x40, 0x0A, 0xB0, 0x60, 0x05, 0x70,
+0xF1, 0x23, 0xD0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0x21, 0xF1, 0xA1, 0x24, 0xF2, 0x25,
+0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0xD0, 0x50,
+0xC0, 0x80, 0x00, 0x60, 0x30, 0x01, 0x80, 0x70, 0xB0, 0x0F, 0x58, 0x0F, 0x5A, 0x80, 0x30, 0x40,
+0x80, 0x02, 0xC0, 0x90, 0x50, 0xD0, 0x50, 0xD1, 0x50, 0x70, 0x80, 0xB0, 0x0A, 0xB0, 0x40, 0x90,
+0x11, 0xC0, 0x80, 0x90, 0x80, 0x40, 0x60, 0xE0, 0xB0, 0xE0, 0x60, 0x80, 0x71, 0x90, 0x82, 0x40,
+0xE0, 0x60, 0xB0, 0x01, 0x70, 0x50, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0xA1, 0xD0, 0x25, 0xF0, 0x20,
+0xF1, 0x21, 0xF0, 0xA0, 0xF2, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0x50, 0xD0, 0xF0, 0x24, 0xF6, 0x50,
+0xD0, 0xF1, 0xD2, 0xF0, 0xD0, 0x70, 0x90, 0x31, 0x90, 0xE0, 0x80, 0x40, 0x60, 0x0B, 0x60, 0xB0,
+0x05, 0x10, 0xA0, 0xF0, 0x23, 0xF0, 0xA1, 0xF1, 0x22, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xD0, 0x50,
+0xF1, 0x21, 0xF4, 0x25, 0xF1, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0x23, 0xF1, 0x20, 0xF1,
+0x50, 0xD0, 0x80, 0x90, 0x70, 0x02, 0x30, 0xE0, 0x90, 0x40, 0x0F, 0x57, 0x0F, 0x58, 0xB0, 0x10,
+0xE0, 0x01, 0x90, 0xB1, 0x90, 0x30, 0xD2, 0xA0, 0x80, 0x70, 0x40, 0x09, 0x80, 0x10, 0x90, 0x11,
+0xC0, 0x31, 0x40, 0x06, 0x40, 0x90, 0x40, 0x80, 0x90, 0xC0, 0x90, 0x30, 0x03, 0x80, 0x90, 0x60,
+0x00, 0xC1, 0x70, 0x90, 0xD1, 0xF1, 0x50, 0xD0, 0x25, 0xF3, 0x21, 0xF0, 0xA1, 0xF2, 0x20, 0xF1,
+0x26, 0xF0, 0x50, 0xD0, 0xF0, 0x24, 0xF0, 0x20, 0xF4, 0x50, 0xD3, 0x50, 0x70, 0x90, 0x31, 0x00,
+0x40, 0x02, 0xE0, 0x0D, 0x60, 0x31, 0x04, 0xC0, 0xD1, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xF3, 0x22,
+0xF1, 0x20, 0xF1, 0x21, 0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xD0, 0x50,
+0xF0, 0xD0, 0x21, 0xF0, 0x28, 0xF3, 0xA1, 0xD2, 0x30, 0x90, 0x00, 0xE0, 0x80, 0x01, 0x80, 0xC0,
+0xB0, 0x0F, 0x55, 0x0F, 0x57, 0x80, 0x30, 0x60, 0x80, 0x02, 0xC0, 0x90, 0xF0, 0xD2, 0x80, 0x90,
+0x40, 0x0A, 0x90, 0x11, 0xC0, 0x70, 0x90, 0x80, 0xE0, 0x06, 0x60, 0x81, 0x60, 0x90, 0x70, 0x82,
+0x90, 0x70, 0x90, 0xC1, 0x80, 0xD0, 0xC0, 0x40, 0x71, 0x80, 0x72, 0xF0, 0xD0, 0x50, 0x20, 0xF2,
+0x22, 0xF1, 0xD2, 0xF2, 0xA0, 0xF0, 0x20, 0xF2, 0x27, 0xF0, 0x50, 0xF3, 0x23, 0xD0, 0xF4, 0x50,
+0xD0, 0x30, 0x91, 0x80, 0x08, 0xE0, 0x0D, 0xE0, 0x40, 0x90, 0x04, 0x70, 0x50, 0xD0, 0x23, 0xF0,
+0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xD0, 0xA0, 0xF1, 0x21, 0xF1, 0x21, 0xF2, 0x20,
+0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x23, 0xF7, 0x50, 0xF1, 0x20, 0xF0, 0xD0,
+0xA0, 0x70, 0xC0, 0x02, 0x30, 0x60, 0x90, 0x40, 0x0F, 0x54, 0x0F, 0x55, 0x60, 0xC0, 0x40, 0x01,
+0x80, 0x61, 0x70, 0x50, 0xD1, 0xF0, 0x50, 0x90, 0x40, 0x00, 0x61, 0x04, 0x40, 0xC0, 0x10, 0x40,
+0x30, 0x11, 0x70, 0x30, 0x60, 0x01, 0x61, 0x05, 0x10, 0x92, 0x50, 0xD4, 0x50, 0xD0, 0x50, 0x30,
+0xD1, 0x90, 0x30, 0xE0, 0xB0, 0xC0, 0x10, 0xC0, 0x90, 0xD1, 0xA0, 0x20, 0xF1, 0x22, 0xF0, 0xD0,
+0xA0, 0x80, 0xC0, 0x11, 0x90, 0xD0, 0x50, 0xD0, 0x22, 0xF2, 0x25, 0xF0, 0x50, 0xD0, 0xF1, 0x24,
+0xF0, 0xD2, 0xF0, 0x50, 0x80, 0xC0, 0x40, 0x0B, 0xE0, 0x0D, 0x40, 0x06, 0xE0, 0xC0, 0xD0, 0xF0,
+0x21, 0xF0, 0xA1, 0xF0, 0x20, 0xF1, 0x21, 0xF3, 0x22, 0xF1, 0x50, 0xF1, 0x21, 0xF1, 0x22, 0xF1,
+0x20, 0xF1, 0x20, 0xF0, 0xA1, 0xD0, 0x20, 0xF1, 0x23, 0xF4, 0x20, 0xF1, 0xD0, 0x50, 0x20, 0xF0,
+0x22, 0xF0, 0xD1, 0x50, 0x90, 0x60, 0x41, 0x01, 0x80, 0x70, 0xB0, 0x0F, 0x52, 0x0F, 0x48, 0x40,
+0xB0, 0x09, 0x80, 0x30, 0xE0, 0x80, 0x01, 0xB0, 0xC0, 0x30, 0xD1, 0xF0, 0x50, 0x70, 0x80, 0xB0,
+0x02, 0x40, 0x02, 0x60, 0x70, 0x80, 0xC0, 0x11, 0x90, 0xC0, 0x40, 0xB1, 0xE0, 0xB0, 0x01, 0xE0,
+0x01, 0xB0, 0x80, 0x91, 0x80, 0xA0, 0xD2, 0x22, 0xF0, 0xD0, 0x50, 0xF1, 0xD0, 0xF0, 0xD0, 0x30,
+0x10, 0x80, 0xB0, 0x00, 0x40, 0x70, 0xC0, 0x70, 0x80, 0xA1, 0xD0, 0xF0, 0xD0, 0xF1, 0xD0, 0xA0,
+0xC0, 0x70, 0x90, 0x41, 0x90, 0xD0, 0x50, 0xD0, 0xF0, 0x21, 0xF1, 0x24, 0xF0, 0x20, 0xD0, 0x50,
+0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0xD0, 0xA0, 0x91, 0xC0, 0x10, 0x80, 0x0C, 0xB0, 0xE0, 0x0D, 0xE0,
+0x07, 0xC0, 0x50, 0xF0, 0x21, 0xF0, 0x50, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0x20, 0xF0,
+0xA1, 0xF0, 0x21, 0xF2, 0x24, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0x21, 0xF0, 0x24, 0xF7, 0xA1, 0xF0,
+0x20, 0xF0, 0x22, 0xF1, 0xD0, 0xA0, 0x30, 0x70, 0x02, 0x90, 0x60, 0x30, 0x40, 0x0F, 0x51, 0x0F,
+0x47, 0x80, 0x60, 0x30, 0x07, 0xB0, 0xC0, 0x40, 0x01, 0x80, 0xE1, 0x70, 0x50, 0xD1, 0x80, 0x70,
+0x40, 0x06, 0x40, 0xE0, 0x30, 0x10, 0x40, 0x60, 0x40, 0x90, 0x11, 0x30, 0x80, 0x91, 0x80, 0x90,
+0xC0, 0x81, 0x30, 0x91, 0x50, 0xD3, 0xF0, 0x24, 0xF0, 0x20, 0xA1, 0xF0, 0xD0, 0xF0, 0xD0, 0x70,
+0x40, 0xE0, 0x80, 0x10, 0x40, 0xB0, 0x40, 0x90, 0x70, 0x10, 0x30, 0xF0, 0xD3, 0x70, 0x10, 0xB0,
+0x03, 0x10, 0xE0, 0xA0, 0xD2, 0x20, 0xF1, 0x24, 0xF0, 0xD1, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF1,
+0x70, 0x90, 0x80, 0x02, 0xE0, 0x0C, 0xB0, 0x60, 0x0C, 0xB0, 0x60, 0x07, 0x60, 0x90, 0xD0, 0x21,
+0xD0, 0x50, 0xF0, 0x25, 0xF3, 0x20, 0xF1, 0xD0, 0x50, 0xF0, 0x21, 0xF3, 0x24, 0xF0, 0x20, 0xF0,
+0xD0, 0xA1, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x26, 0xF1, 0x20, 0xD0, 0x50, 0xD0, 0xF4, 0x23, 0xF0,
+0xD0, 0x50, 0x70, 0xB0, 0x41, 0x01, 0x80, 0x70, 0x0F, 0x50, 0x0F, 0x47, 0x40, 0x81, 0x06, 0x80,
+0x30, 0xB0, 0x90, 0x02, 0x10, 0x30, 0xD2, 0x10, 0xC0, 0x05, 0x10, 0x70, 0xC0, 0x30, 0x80, 0x90,
+0x11, 0xC0, 0x10, 0xC0, 0x91, 0x80, 0x90, 0xD4, 0x50, 0xA0, 0x50, 0xD2, 0x28, 0xF0, 0x21, 0xF0,
+0x50, 0xD4, 0xC0, 0xE0, 0x01, 0xE0, 0x40, 0xE0, 0x60, 0xC0, 0x40, 0xE0, 0x70, 0x90, 0x80, 0xA0,
+0xC0, 0xE1, 0x04, 0xB0, 0x70, 0x90, 0x70, 0x10, 0xD3, 0xF1, 0x21, 0xF1, 0xD0, 0xF0, 0x50, 0xF0,
+0xD5, 0x50, 0xC0, 0x04, 0x40, 0x01, 0x61, 0x08, 0x61, 0x0C, 0x60, 0xB0, 0x07, 0x60, 0x90, 0xD0,
+0x20, 0xF0, 0xD0, 0x50, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xF0,
+0x21, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF2, 0xA1, 0xD1,
+0xF5, 0x23, 0xD1, 0x90, 0xC0, 0x02, 0x90, 0x00, 0x90, 0x40, 0x0F, 0x4E, 0x0F, 0x45, 0x80, 0x40,
+0x00, 0xB0, 0x06, 0x90, 0x40, 0x01, 0x41, 0x60, 0x90, 0x50, 0xD1, 0xA0, 0x90, 0x80, 0x05, 0x80,
+0xC0, 0x50, 0xD1, 0x80, 0xC0, 0x50, 0xF0, 0x51, 0xD3, 0xF4, 0xD2, 0xA1, 0xD0, 0xF0, 0x22, 0xF0,
+0x20, 0xF0, 0x21, 0xF1, 0xD2, 0xA0, 0x50, 0x30, 0x70, 0x80, 0x90, 0x30, 0xB0, 0x05, 0xC0, 0xB0,
+0x60, 0x00, 0x80, 0xE0, 0x30, 0xC0, 0x08, 0x60, 0x70, 0x10, 0xC0, 0x11, 0x30, 0x50, 0xF0, 0xD0,
+0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0x50, 0x80, 0x30, 0xC0, 0x10, 0x91, 0x30, 0xE0, 0x04, 0xE0, 0x01,
+0x30, 0xC0, 0x30, 0x07, 0x60, 0xB0, 0x0C, 0xE0, 0x08, 0x80, 0x50, 0xD0, 0x20, 0xF0, 0xA1, 0xD0,
+0xF0, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF4, 0x20, 0xF0, 0x25, 0xF0, 0xD0, 0xA1,
+0xD0, 0x26, 0xF1, 0x23, 0xF2, 0x50, 0xF4, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0xD1, 0x50, 0x90,
+0xB0, 0x80, 0xE0, 0x01, 0x80, 0x30, 0x0F, 0x4D, 0x0F, 0x44, 0x70, 0x40, 0x30, 0xC0, 0x05, 0x60,
+0x90, 0xE0, 0x30, 0x02, 0x10, 0x30, 0xD0, 0x50, 0xD1, 0xC0, 0x40, 0x05, 0x90, 0x10, 0x90, 0xD0,
+0xF0, 0xD0, 0xA1, 0xD1, 0xF0, 0x24, 0xF0, 0x24, 0xF2, 0x50, 0xD0, 0x23, 0xF0, 0xD4, 0xF0, 0xA1,
+0x50, 0x90, 0x80, 0x60, 0xB0, 0x80, 0x60, 0x07, 0x10, 0x30, 0x90, 0x82, 0x0B, 0x60, 0x00, 0x60,
+0xE0, 0x40, 0x80, 0xC1, 0x50, 0xD1, 0xF0, 0x50, 0xC0, 0x70, 0x10, 0x70, 0x10, 0x90, 0x30, 0x10,
+0x07, 0x40, 0x0C, 0x60, 0xB0, 0x0C, 0x40, 0x08, 0x70, 0x50, 0xD0, 0x20, 0xD0, 0x50, 0xF2, 0x24,
+0xF1, 0x22, 0xF1, 0x50, 0xF2, 0x20, 0xF3, 0x25, 0xF1, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0x22, 0xF3, 0xA1, 0xF0, 0x23, 0xF0, 0x21, 0xF3, 0x22, 0xD1, 0xA0, 0x71, 0x02, 0x30,
+0x40, 0x90, 0x0F, 0x4C, 0x0F, 0x44, 0x70, 0x01, 0x40, 0xC0, 0x03, 0x80, 0x30, 0x01, 0x41, 0xB0,
+0xC0, 0x50, 0x40, 0x70, 0xC0, 0x50, 0x90, 0xE0, 0x01, 0xB0, 0x00, 0xE0, 0x90, 0x11, 0xC0, 0xF0,
+0xD0, 0xF2, 0x50, 0xF1, 0x24, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0xF1, 0x20,
+0xF0, 0xD1, 0xA0, 0x50, 0xC0, 0x71, 0x11, 0x70, 0x40, 0xB0, 0xE0, 0x0E, 0x40, 0x00, 0x40, 0x10,
+0x80, 0x09, 0x40, 0x03, 0x60, 0xC0, 0x00, 0xC0, 0x80, 0x90, 0x11, 0x41, 0xE0, 0x00, 0x70, 0x60,
+0x09, 0x40, 0x0C, 0xE0, 0xB0, 0x0C, 0x40, 0x07, 0x30, 0x10, 0xD1, 0xF1, 0x50, 0xD0, 0xF4, 0x24,
+0xF0, 0x20, 0xF1, 0x50, 0xD0, 0x22, 0xF3, 0x24, 0xF1, 0xA1, 0xD0, 0xF0, 0x20, 0xF2, 0x26, 0xF3,
+0x50, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0xD1, 0x50, 0x80, 0x70, 0x00, 0x30,
+0xE0, 0x01, 0x90, 0xE0, 0x0F, 0x4A, 0x0F, 0x40, 0xB0, 0x71, 0xB0, 0x70, 0x60, 0x01, 0x30, 0x40,
+0x01, 0x90, 0x80, 0x30, 0x02, 0x71, 0xD1, 0x90, 0x70, 0xA0, 0x10, 0x91, 0x71, 0xC3, 0x31, 0xD1,
+0xF1, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0x23, 0xF2, 0x22, 0xF0, 0x20, 0xF2, 0x30, 0xA0, 0xD2, 0x11,
+0x70, 0xC0, 0x00, 0xE1, 0xB0, 0x41, 0x10, 0xB0, 0x60, 0xB0, 0x0D, 0x40, 0x01, 0x70, 0xB0, 0x09,
+0x40, 0x02, 0x40, 0xC0, 0x30, 0xC0, 0x90, 0x70, 0x10, 0x30, 0x70, 0x10, 0x80, 0x41, 0xB0, 0x10,
+0xB0, 0x08, 0xE0, 0x04, 0x81, 0x05, 0xE0, 0xB0, 0x0C, 0xE0, 0x07, 0x80, 0xC0, 0xD2, 0xA1, 0xF5,
+0x24, 0xF2, 0xA1, 0xF1, 0x21, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF2, 0x23,
+0xF0, 0x20, 0xF2, 0xD0, 0x50, 0xF1, 0x24, 0xF0, 0x22, 0xF1, 0x22, 0xF1, 0xD0, 0x50, 0xF0, 0xD0,
+0xF0, 0xC0, 0x30, 0x02, 0x90, 0x80, 0x30, 0x04, 0x60, 0x40, 0x30, 0x10, 0x70, 0x0F, 0x3F, 0x0F,
+0x40, 0x70, 0xB0, 0xE0, 0x70, 0xB0, 0xC0, 0xB0, 0x00, 0xB0, 0x90, 0x60, 0x90, 0x60, 0x00, 0xE0,
+0x80, 0x00, 0x30, 0x80, 0xD0, 0x40, 0x90, 0xE0, 0x30, 0x50, 0xD1, 0xF0, 0xD0, 0xA0, 0x70, 0xC0,
+0x30, 0x50, 0xA0, 0xD1, 0x20, 0xF1, 0x21, 0xD0, 0x50, 0xF0, 0xD0, 0x23, 0xF1, 0x21, 0xF2, 0xD1,
+0x70, 0xC0, 0x30, 0x40, 0x30, 0xC0, 0x80, 0x07, 0x60, 0x80, 0x01, 0x40, 0x0D, 0x60, 0xE0, 0x30,
+0x70, 0x0A, 0xE0, 0xB0, 0x01, 0xE0, 0x90, 0x00, 0x30, 0x70, 0x30, 0x40, 0x30, 0x00, 0x61, 0x91,
+0xB0, 0x40, 0x70, 0x90, 0x07, 0x40, 0x04, 0xE0, 0xB0, 0x05, 0xE0, 0x0C, 0xB0, 0x60, 0x06, 0x31,
+0xD1, 0xF1, 0xA1, 0x21, 0xF3, 0x24, 0xF2, 0x50, 0xD0, 0xF1, 0x21, 0xF2, 0x23, 0xF2, 0xA0, 0x50,
+0xD0, 0x22, 0xF1, 0x25, 0xF1, 0x20, 0xF0, 0xA1, 0xD0, 0xF0, 0x27, 0xF2, 0x20, 0xF0, 0x21, 0xF0,
+0xA1, 0xD1, 0xF0, 0xD0, 0x30, 0x80, 0x00, 0x90, 0xB0, 0x00, 0x60, 0x70, 0xB0, 0x01, 0xC0, 0x90,
+0xE1, 0x10, 0x01, 0x60, 0xB0, 0x0F, 0x3C, 0x0F, 0x3F, 0xB0, 0xC0, 0x01, 0x70, 0x00, 0x40, 0xC0,
+0xE0, 0x80, 0x70, 0x31, 0x02, 0x30, 0x70, 0x40, 0xD0, 0x80, 0x90, 0x60, 0x90, 0x51, 0xD0, 0xF1,
+0xA0, 0x10, 0xC0, 0xA0, 0xD1, 0xF4, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x23, 0xF1, 0x21, 0xF0,
+0x20, 0xF0, 0xD0, 0x80, 0x40, 0x00, 0x40, 0x90, 0x10, 0x60, 0x02, 0x80, 0xC0, 0x10, 0x80, 0x00,
+0x60, 0x90, 0xB0, 0x01, 0xE0, 0x04, 0x80, 0x10, 0x06, 0x81, 0xB0, 0x0B, 0xB0, 0x60, 0x01, 0x81,
+0x01, 0xE0, 0x70, 0x80, 0xB0, 0x01, 0xB0, 0xE0, 0x01, 0x30, 0x70, 0x40, 0x07, 0xE0, 0x0C, 0x40,
+0x0C, 0xE0, 0xB0, 0x04, 0xB0, 0x70, 0x10, 0x40, 0x51, 0xA0, 0xF0, 0x50, 0xF0, 0x22, 0xF2, 0x24,
+0xF1, 0xA1, 0xD0, 0xF0, 0x22, 0xF1, 0x25, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF3, 0x25, 0xF3, 0x50,
+0xD0, 0xF0, 0x20, 0xF0, 0x26, 0xF3, 0x21, 0xF1, 0x50, 0xD1, 0xF0, 0xD0, 0xF0, 0xD0, 0x80, 0x70,
+0x80, 0x02, 0x91, 0xE0, 0x00, 0x40, 0x70, 0x60, 0xC0, 0xB0, 0x00, 0x90, 0x71, 0x60, 0x0F, 0x3B,
+0x0F, 0x3D, 0xB1, 0x00, 0x40, 0x00, 0xB0, 0x70, 0x01, 0xB0, 0x80, 0xC0, 0x40, 0x00, 0x60, 0x30,
+0x00, 0x40, 0x70, 0xD0, 0x80, 0x10, 0x30, 0xB0, 0x70, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x20,
+0xF0, 0xD2, 0xF1, 0x20, 0xF1, 0x22, 0xF2, 0xA0, 0xF1, 0x21, 0xF2, 0x21, 0xF0, 0xD1, 0x50, 0x90,
+0x40, 0x01, 0x90, 0x80, 0x00, 0x60, 0xB0, 0x80, 0x30, 0xE0, 0x01, 0x90, 0x30, 0x03, 0xB0, 0x90,
+0xE0, 0x01, 0x82, 0x30, 0x00, 0x60, 0x40, 0x01, 0x10, 0x90, 0xE0, 0x0D, 0x61, 0x90, 0x80, 0x40,
+0x01, 0x70, 0x90, 0x33, 0x80, 0x90, 0x40, 0x60, 0x40, 0x80, 0x70, 0x00, 0x62, 0xB0, 0x02, 0xE0,
+0x0C, 0x40, 0x0C, 0x40, 0x06, 0xC0, 0x11, 0x30, 0x40, 0x31, 0x90, 0xA0, 0xD0, 0x29, 0xF0, 0xD0,
+0x50, 0xF1, 0x21, 0xF2, 0x24, 0xF1, 0xD0, 0xF0, 0xA0, 0xF0, 0x20, 0xF2, 0x26, 0xF1, 0x20, 0xD0,
+0xA1, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF3, 0x21, 0xF1, 0x50, 0x20, 0xF1, 0xD0, 0x21, 0xF0,
+0xD0, 0xA0, 0x70, 0xE0, 0x00, 0x90, 0xB0, 0x00, 0x30, 0x40, 0x00, 0x60, 0x10, 0x80, 0x00, 0xC0,
+0x80, 0x00, 0xB0, 0x90, 0x0F, 0x3B, 0x0F, 0x3C, 0x80, 0x70, 0xC0, 0x80, 0x01, 0x60, 0x90, 0x00,
+0x70, 0xE0, 0x30, 0x70, 0x02, 0x80, 0x70, 0x80, 0x60, 0x30, 0x80, 0x00, 0x60, 0xC0, 0xD1, 0xF0,
+0xD0, 0xA0, 0xF0, 0xD0, 0xF1, 0x29, 0xF3, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xA1,
+0xF0, 0x11, 0x90, 0x80, 0x10, 0x30, 0xB0, 0x05, 0x31, 0x06, 0xE0, 0xB0, 0x80, 0x90, 0x80, 0x01,
+0xC0, 0x70, 0x80, 0x90, 0x70, 0xC0, 0x01, 0xE0, 0x0D, 0x60, 0x90, 0x05, 0xB0, 0x04, 0x40, 0xC0,
+0x30, 0x10, 0x90, 0x71, 0x83, 0x30, 0x70, 0x31, 0x40, 0x0B, 0x40, 0x0A, 0xE0, 0x90, 0xE0, 0x07,
+0xE1, 0x02, 0xB0, 0x60, 0x90, 0x50, 0xD0, 0x22, 0xF0, 0x23, 0xF1, 0xD0, 0x50, 0xD0, 0xF0, 0x20,
+0xF2, 0x25, 0xF1, 0xD0, 0x50, 0xF1, 0x20, 0xF2, 0x25, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF0,
+0x20, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xA1, 0xF2, 0x23, 0xF0, 0xD1, 0x30, 0xC0, 0xE0,
+0x02, 0x70, 0x31, 0x80, 0x40, 0x30, 0x80, 0x01, 0x40, 0x30, 0x00, 0x60, 0x0F, 0x39, 0x0F, 0x3C,
+0xC0, 0x00, 0x60, 0x70, 0x60, 0x00, 0xE0, 0x70, 0x90, 0x80, 0x30, 0xB0, 0x60, 0x30, 0x00, 0xB0,
+0x70, 0xA0, 0xD0, 0x30, 0x80, 0x00, 0xE0, 0x70, 0xF1, 0x20, 0xD1, 0x70, 0x90, 0x50, 0xF0, 0x26,
+0xF0, 0x21, 0xD1, 0xF3, 0xA1, 0xD0, 0x21, 0xF1, 0x21, 0xA0, 0xD0, 0x30, 0x10, 0x70, 0x00, 0x71,
+0x40, 0xE0, 0xB0, 0x01, 0x60, 0x91, 0x60, 0x07, 0x60, 0x90, 0xB0, 0x07, 0x10, 0x31, 0x81, 0x90,
+0xB1, 0x02, 0x40, 0x06, 0xE0, 0x10, 0x06, 0x60, 0xE0, 0x80, 0x30, 0x90, 0x80, 0xE1, 0x90, 0x30,
+0x00, 0x70, 0xB0, 0x60, 0xB0, 0x60, 0xB0, 0x01, 0xE0, 0x80, 0x90, 0x70, 0x91, 0x30, 0xE0, 0xB0,
+0x04, 0xE0, 0x0C, 0xE0, 0x0C, 0x60, 0x01, 0x90, 0xA0, 0xF0, 0x20, 0xF3, 0x21, 0xF1, 0xA1, 0xF5,
+0x25, 0xF2, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x25, 0xF2, 0x20, 0xD0, 0xA1, 0xF1, 0x21, 0xF2, 0x23,
+0xF0, 0x20, 0xF0, 0x21, 0xD0, 0xF0, 0x50, 0xF0, 0x21, 0xF1, 0x22, 0xF2, 0xD0, 0x50, 0x90, 0x01,
+0x90, 0xB0, 0x60, 0x90, 0x01, 0xC0, 0x02, 0x10, 0xB0, 0x40, 0x81, 0x0F, 0x38, 0x0F, 0x3C, 0x90,
+0x00, 0x80, 0x90, 0xC0, 0x80, 0x60, 0x10, 0x80, 0x10, 0x80, 0x01, 0x40, 0x30, 0x90, 0xA0, 0xD0,
+0x30, 0x80, 0x00, 0x31, 0xF0, 0xD0, 0x22, 0xC1, 0x80, 0xA0, 0xD0, 0x20, 0xF2, 0x24, 0xD0, 0x50,
+0xC0, 0x30, 0xF2, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x21, 0xD1, 0x30, 0x10, 0xE0, 0x00, 0x90, 0x80,
+0x00, 0x60, 0x40, 0x80, 0x70, 0x30, 0x10, 0xB0, 0x00, 0x60, 0x41, 0x01, 0xB1, 0x40, 0x90, 0xE0,
+0x05, 0xB0, 0x80, 0x70, 0x10, 0xE0, 0xB0, 0xE0, 0xB0, 0x90, 0x71, 0x90, 0x40, 0x90, 0x10, 0x80,
+0x05, 0xE0, 0x30, 0x06, 0x10, 0xC0, 0xE0, 0xB0, 0x00, 0xE0, 0x00, 0x40, 0x30, 0xC0, 0x91, 0x41,
+0x80, 0x31, 0x91, 0x80, 0xB0, 0x03, 0x60, 0x40, 0x80, 0x90, 0x60, 0x01, 0xB0, 0xE0, 0x0B, 0xB0,
+0xE0, 0x0B, 0xB0, 0x30, 0xC0, 0x90, 0x80, 0x70, 0xF5, 0x20, 0xF2, 0x50, 0xF3, 0x20, 0xF0, 0x22,
+0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xF1, 0x26, 0xF1, 0x20, 0xF3, 0x20, 0x50, 0xD0, 0x22, 0xF2, 0x23,
+0xF1, 0x22, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x27, 0xD0, 0xA0, 0x70, 0x30, 0xE0, 0x01, 0x90, 0x10,
+0xB0, 0x70, 0x00, 0xB0, 0xC0, 0xE0, 0x00, 0x80, 0xE0, 0x30, 0x0F, 0x38, 0x0F, 0x41, 0xC0, 0x00,
+0x40, 0x80, 0x70, 0x10, 0xE0, 0x00, 0x40, 0x90, 0xD1, 0x70, 0x40, 0x00, 0x90, 0x50, 0xD1, 0xF1,
+0x20, 0x50, 0xC0, 0x50, 0xD0, 0xA1, 0xD3, 0xF1, 0x20, 0xF1, 0xD0, 0x30, 0x90, 0xF2, 0x20, 0xF0,
+0xA1, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0x90, 0x40, 0x01, 0x40, 0x80, 0x02, 0xE0, 0x70, 0x80, 0x00,
+0xB0, 0xC0, 0x70, 0x80, 0xE0, 0x40, 0x70, 0x30, 0x81, 0xE2, 0x05, 0x40, 0xC0, 0x80, 0xB0, 0x03,
+0x40, 0x01, 0x90, 0x40, 0x00, 0xE0, 0x90, 0x05, 0x81, 0x05, 0x80, 0x90, 0x30, 0x90, 0x30, 0x81,
+0x30, 0x40, 0x0A, 0x81, 0x70, 0x30, 0x40, 0x04, 0x80, 0x90, 0x30, 0xB0, 0x60, 0x0B, 0x61, 0x08,
+0xB0, 0x30, 0x40, 0x00, 0x40, 0xE0, 0x80, 0x10, 0xC0, 0x50, 0xF1, 0x23, 0xF2, 0x50, 0xD0, 0xF0,
+0x20, 0xF1, 0x23, 0xF2, 0x20, 0xF1, 0x50, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0x21, 0xF1, 0xD0, 0x50,
+0x20, 0xF1, 0x23, 0xF2, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xA0, 0xF2, 0x25, 0xF0, 0x23, 0xD1,
+0x70, 0xE0, 0x00, 0x40, 0x10, 0x90, 0x31, 0x70, 0xC0, 0xE0, 0x02, 0x40, 0x0F, 0x39, 0x0F, 0x3E,
+0xB2, 0x70, 0x90, 0x80, 0x01, 0xC0, 0x10, 0x90, 0x80, 0xD0, 0xF0, 0xC0, 0xB0, 0x00, 0x70, 0x50,
+0xD0, 0xF2, 0x20, 0xF1, 0xD3, 0x50, 0x80, 0x71, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0xD2, 0x21, 0xF1,
+0xD0, 0x50, 0xF0, 0xD0, 0x21, 0xF0, 0xD0, 0x90, 0x40, 0x01, 0x40, 0x10, 0x02, 0xE0, 0x30, 0x80,
+0x07, 0xE1, 0x81, 0x10, 0xC0, 0x61, 0x80, 0x30, 0xC0, 0x30, 0x80, 0x40, 0x90, 0x80, 0x04, 0x60,
+0xB0, 0x02, 0x60, 0xC0, 0x04, 0x60, 0x90, 0x40, 0xB0, 0x04, 0x90, 0x80, 0x03, 0x10, 0xC0, 0x0C,
+0xE0, 0x01, 0x80, 0x31, 0x40, 0x04, 0xC0, 0xE0, 0xB0, 0x0B, 0xE0, 0xB0, 0x08, 0x40, 0x80, 0x40,
+0x90, 0x30, 0xE0, 0x01, 0x90, 0xF0, 0xD0, 0x23, 0xF1, 0xD0, 0xA1, 0xF1, 0x20, 0xF2, 0x21, 0xF1,
+0x20, 0xF1, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x24, 0xF5, 0xA1, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0x21,
+0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF3, 0x21, 0xF2, 0x23, 0xF2, 0xD0, 0x31, 0x10, 0x90,
+0x01, 0x30, 0x40, 0x0F, 0x3F, 0x0F, 0x3E, 0x40, 0xC0, 0x70, 0x90, 0x40, 0x30, 0x01, 0x60, 0x10,
+0x80, 0xD0, 0xA0, 0x70, 0x00, 0x60, 0x90, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xA0,
+0x80, 0x70, 0x10, 0x80, 0x00, 0x30, 0xC0, 0xD0, 0xF2, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x50,
+0xD0, 0xF1, 0xD0, 0x50, 0x30, 0x03, 0xE0, 0x91, 0xC0, 0x90, 0x00, 0x40, 0x00, 0x60, 0x40, 0xE0,
+0x31, 0x90, 0x70, 0x81, 0xB0, 0x40, 0x70, 0x80, 0xE0, 0x90, 0x60, 0x01, 0x81, 0x70, 0xB0, 0x05,
+0xB0, 0x60, 0x02, 0x90, 0x40, 0x02, 0x80, 0x10, 0x80, 0x01, 0xE0, 0x02, 0x31, 0x60, 0x05, 0x60,
+0xB0, 0x07, 0xB0, 0x00, 0xE2, 0x01, 0xB0, 0x01, 0x40, 0x31, 0x70, 0x10, 0xC0, 0xB0, 0x60, 0xB0,
+0x0B, 0x40, 0x09, 0x60, 0x70, 0x00, 0xE0, 0x00, 0x40, 0x91, 0x10, 0xC0, 0xD1, 0x22, 0xF1, 0xD0,
+0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x23,
+0xF2, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0x24, 0xF1, 0x50, 0xF9, 0x20,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0x30, 0x10, 0x02, 0x90, 0x81, 0x0F, 0x3E, 0x0F,
+0x40, 0x30, 0x60, 0x00, 0xE0, 0x30, 0xB0, 0x70, 0xA2, 0x70, 0xB0, 0x80, 0x90, 0xA0, 0xD0, 0xF0,
+0x21, 0xF2, 0xD1, 0x90, 0x10, 0x70, 0x00, 0xB1, 0x40, 0x70, 0x30, 0xD1, 0xF0, 0x21, 0xF1, 0x24,
+0xF1, 0xD0, 0xA1, 0xF1, 0xD0, 0x70, 0x07, 0x40, 0xC0, 0x30, 0x70, 0x30, 0x91, 0x11, 0x90, 0x30,
+0x80, 0x70, 0x01, 0xE0, 0x81, 0x41, 0x01, 0x40, 0x70, 0x60, 0x08, 0x30, 0xB0, 0x01, 0xB0, 0x90,
+0xB1, 0x00, 0x80, 0x30, 0x40, 0x70, 0x00, 0x40, 0x80, 0x30, 0x70, 0xE0, 0x06, 0xB0, 0x30, 0x80,
+0x07, 0x10, 0xB0, 0xC0, 0x10, 0xE0, 0x02, 0xB1, 0x01, 0xE0, 0x70, 0xE0, 0x80, 0x30, 0x40, 0x0C,
+0x40, 0x0A, 0x30, 0x80, 0xE0, 0x02, 0xB1, 0x90, 0xC0, 0xA0, 0xF0, 0x21, 0xF2, 0x50, 0xD0, 0x21,
+0xF0, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0x20, 0xD0, 0xA1, 0xD0, 0x22, 0xF2, 0x22, 0xF1, 0x20, 0xF0,
+0xD0, 0xA1, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF1, 0x23, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF9, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xA1, 0x50, 0x90, 0xB0, 0x90, 0xB0, 0x00, 0x40, 0x80, 0x0F,
+0x3D, 0x0F, 0x3F, 0x70, 0x90, 0x02, 0x80, 0xC0, 0xD2, 0x90, 0x60, 0x30, 0x80, 0xD0, 0xF1, 0x22,
+0xF0, 0xD2, 0x30, 0x10, 0x02, 0xB0, 0xC0, 0x70, 0x50, 0xD0, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF4,
+0x20, 0xD0, 0x50, 0xF0, 0xD0, 0xA0, 0x10, 0x40, 0x08, 0x40, 0x10, 0x31, 0x50, 0xD1, 0xF0, 0xD1,
+0x90, 0x40, 0x04, 0xB0, 0x40, 0x10, 0x40, 0x02, 0x40, 0x80, 0x05, 0x40, 0x03, 0x60, 0x31, 0x90,
+0xC0, 0x40, 0xE0, 0xC0, 0x10, 0x30, 0x60, 0x09, 0x60, 0x80, 0xE0, 0x01, 0x31, 0x03, 0xB0, 0x02,
+0xE0, 0x02, 0x80, 0x30, 0x05, 0xB0, 0x80, 0x90, 0xE0, 0x0A, 0x60, 0x01, 0x81, 0x30, 0x90, 0x30,
+0x90, 0x30, 0x01, 0x40, 0x90, 0xE0, 0x05, 0x70, 0x30, 0xD0, 0x22, 0xF0, 0xA1, 0xF0, 0x23, 0xF0,
+0x21, 0xF2, 0x21, 0xF0, 0x50, 0xF1, 0x23, 0xF1, 0x22, 0xF0, 0x21, 0xD0, 0xF0, 0x50, 0xD0, 0x20,
+0xF0, 0x22, 0xF1, 0x21, 0xF1, 0x22, 0xF1, 0xA1, 0xD0, 0xF1, 0x21, 0xF1, 0x21, 0xF2, 0x21, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xD1, 0xA0, 0xC0, 0x40, 0x02, 0xC0, 0x90, 0x0F, 0x3C, 0x0F,
+0x3D, 0xB0, 0x70, 0x00, 0x60, 0x90, 0x00, 0x40, 0x70, 0xD2, 0x90, 0x40, 0x30, 0x80, 0xD0, 0xF1,
+0x20, 0xF0, 0xD1, 0xA0, 0x30, 0xC0, 0x90, 0x40, 0x02, 0x30, 0xC0, 0x70, 0xD0, 0x50, 0xD0, 0xF0,
+0x24, 0xF5, 0x21, 0xF1, 0xA1, 0xF0, 0xD0, 0x50, 0x10, 0x70, 0x90, 0x42, 0x80, 0x30, 0x70, 0xC0,
+0x80, 0xD0, 0xA0, 0xF0, 0xD0, 0xF4, 0x90, 0x05, 0xE0, 0x80, 0x04, 0x60, 0x30, 0x05, 0x60, 0xB0,
+0x0B, 0x60, 0x09, 0xB0, 0x40, 0xB0, 0xE0, 0xB0, 0xE0, 0x90, 0x80, 0xE2, 0x40, 0xE0, 0x40, 0xE0,
+0x40, 0x80, 0xE3, 0x60, 0xE4, 0x60, 0xB0, 0xE0, 0x40, 0xC0, 0x02, 0xB0, 0x10, 0x04, 0xE0, 0x31,
+0x90, 0xE0, 0x60, 0xB0, 0x02, 0xB0, 0x71, 0x90, 0x30, 0xB0, 0x05, 0x40, 0xC0, 0xD2, 0x20, 0xF0,
+0x50, 0xD0, 0x20, 0xF0, 0x26, 0xF0, 0x21, 0xD0, 0xA1, 0xD0, 0x24, 0xF0, 0x20, 0xF2, 0x21, 0xF0,
+0xD0, 0x50, 0xA0, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0x22, 0xF4, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF1,
+0x22, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0x50, 0xD0, 0xF1, 0xD1, 0x70, 0x60, 0x00, 0x90, 0xB1,
+0x90, 0x0F, 0x3B, 0x0F, 0x3C, 0x60, 0x10, 0x02, 0x40, 0x70, 0x30, 0xD2, 0x30, 0x40, 0x81, 0x50,
+0xF3, 0xD0, 0x50, 0x90, 0x30, 0xE0, 0x04, 0x90, 0x70, 0x30, 0xD1, 0xA0, 0x50, 0xD1, 0xF0, 0x21,
+0xF1, 0x20, 0xF2, 0x23, 0xF0, 0xD0, 0x50, 0xF1, 0xD0, 0xA1, 0x50, 0x80, 0x52, 0xA0, 0xD4, 0x50,
+0xD0, 0xF2, 0xD0, 0x30, 0x10, 0x03, 0xE0, 0x40, 0x70, 0xE0, 0x0C, 0xB0, 0xE0, 0x0B, 0x60, 0xB0,
+0x02, 0xB0, 0x61, 0xE1, 0x42, 0xE0, 0x40, 0xB1, 0x01, 0xB0, 0x06, 0xE0, 0x07, 0xB2, 0x60, 0x90,
+0x80, 0x30, 0x40, 0xE1, 0x60, 0x80, 0x60, 0xB0, 0x00, 0xB0, 0x10, 0x80, 0x60, 0x0B, 0xE0, 0x07,
+0x10, 0x30, 0xA0, 0xD1, 0xA1, 0xD0, 0xF1, 0x24, 0xF1, 0x21, 0xF1, 0x50, 0xF2, 0x23, 0xF4, 0x21,
+0xF1, 0xA0, 0xF1, 0x26, 0xF0, 0x22, 0xF3, 0x50, 0xF1, 0x21, 0xF2, 0x25, 0xF0, 0x20, 0xF3, 0xD0,
+0x50, 0xF0, 0xD0, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0x91, 0x60, 0x01, 0x60, 0xC0, 0xB0, 0x0F, 0x39,
+0x0F, 0x3B, 0x60, 0x90, 0xE0, 0x30, 0x01, 0x80, 0x30, 0xD2, 0x81, 0x40, 0x30, 0xD0, 0xA0, 0x50,
+0xD0, 0xF0, 0xD0, 0x50, 0x90, 0x06, 0x30, 0x11, 0xA0, 0xD0, 0x20, 0xF0, 0x50, 0xA0, 0xF2, 0x22,
+0xF2, 0x25, 0xF0, 0xA0, 0x50, 0xD0, 0xF2, 0xD1, 0xF4, 0xD1, 0x80, 0x30, 0x50, 0xF2, 0xD0, 0x30,
+0x10, 0x80, 0x90, 0x70, 0x30, 0x90, 0x80, 0x60, 0x00, 0xB0, 0x60, 0x0C, 0x40, 0x0B, 0xE0, 0x42,
+0xE0, 0x61, 0xB1, 0x04, 0xE0, 0x0B, 0x40, 0x0B, 0x30, 0x40, 0x03, 0xB1, 0x60, 0x40, 0x81, 0x41,
+0x60, 0xB0, 0x0A, 0xE0, 0x07, 0xB0, 0x40, 0x90, 0x30, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x25, 0xF2,
+0x20, 0xF0, 0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0x21, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x23,
+0xF0, 0x21, 0xF0, 0x22, 0xF2, 0xA1, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0x26, 0xF0, 0x20, 0xF1, 0xD0,
+0x50, 0xA0, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x90, 0x40, 0x01, 0x30, 0xE0, 0x90, 0xB0, 0x0F,
+0x38, 0x0F, 0x3A, 0xE0, 0x90, 0x01, 0x40, 0x81, 0x30, 0xD0, 0xF0, 0xD0, 0x81, 0xE0, 0x90, 0xD0,
+0xF1, 0xA1, 0xD0, 0x80, 0xC0, 0x06, 0x80, 0x90, 0x40, 0x10, 0x70, 0xD0, 0xF1, 0xD0, 0x50, 0xF3,
+0x20, 0xF1, 0x22, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x21, 0xF2, 0x21, 0xF0, 0xD0, 0x80,
+0x70, 0x40, 0xE0, 0xC0, 0xA0, 0xD2, 0x10, 0xC0, 0x60, 0x01, 0x80, 0x04, 0x40, 0x0C, 0x40, 0x06,
+0x60, 0x41, 0xE1, 0x60, 0xE0, 0x0B, 0x40, 0x0B, 0xE0, 0x0B, 0xE0, 0x70, 0x40, 0x09, 0x40, 0x60,
+0xE1, 0x40, 0xE0, 0x60, 0x05, 0xB0, 0xE0, 0x0A, 0x60, 0x90, 0x30, 0xD2, 0x24, 0xF3, 0x21, 0x50,
+0xD0, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF0, 0xA1, 0xF1, 0x21, 0xF1, 0x23, 0xF1, 0x20, 0xF1,
+0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x28, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x25, 0xF0, 0xD0,
+0x30, 0x80, 0x90, 0x60, 0x01, 0x70, 0xB0, 0x0F, 0x37, 0x0F, 0x39, 0xE0, 0x70, 0x30, 0x02, 0x70,
+0x50, 0xD0, 0xF0, 0xD0, 0x81, 0x60, 0x90, 0xD0, 0xF1, 0x20, 0xD0, 0x51, 0x90, 0x06, 0x80, 0x40,
+0x01, 0x80, 0x50, 0xD0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xF4, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF1,
+0x50, 0xD0, 0xF0, 0x20, 0xF3, 0x20, 0xD0, 0x50, 0x70, 0x01, 0x70, 0x80, 0x50, 0xD0, 0xA0, 0x10,
+0x80, 0x09, 0xE0, 0xB0, 0x0B, 0x60, 0xB0, 0x00, 0xB0, 0xE0, 0x42, 0xB0, 0x04, 0x40, 0x0B, 0x40,
+0x0B, 0xE0, 0x0B, 0x40, 0x0B, 0x40, 0x04, 0x60, 0xE0, 0x40, 0xE0, 0x60, 0xB0, 0x00, 0x60, 0xB0,
+0x0B, 0xB0, 0x40, 0xC0, 0x30, 0xA0, 0xD1, 0x22, 0xF4, 0xA1, 0xD0, 0xF1, 0xD0, 0x21, 0xF0, 0x23,
+0xF3, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x50, 0xF3, 0x24, 0xF2,
+0x24, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x28, 0xD0, 0x30, 0x90, 0x02, 0x90, 0x70, 0x60, 0x0F, 0x36,
+0x0F, 0x38, 0xE0, 0x30, 0x00, 0xE0, 0x30, 0x00, 0x90, 0x50, 0xD0, 0xF0, 0xD0, 0x80, 0x30, 0x00,
+0xC0, 0xA0, 0xD0, 0x20, 0xF1, 0xD0, 0xF0, 0x90, 0x60, 0x05, 0x60, 0x70, 0x01, 0x40, 0x30, 0xD0,
+0x22, 0xF0, 0xD0, 0xA1, 0xF3, 0x21, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF3, 0x20,
+0xD0, 0xC0, 0xB0, 0x00, 0x30, 0x10, 0x80, 0x40, 0x90, 0x70, 0x80, 0x0A, 0xB0, 0xE0, 0x0A, 0xB0,
+0xE0, 0x80, 0x40, 0x60, 0xB0, 0x08, 0xE0, 0x0B, 0x40, 0x0B, 0xE0, 0x0B, 0x40, 0x00, 0x41, 0xB0,
+0x03, 0xB0, 0x40, 0x01, 0xE0, 0x08, 0xE0, 0x80, 0xE0, 0x40, 0xB1, 0x0A, 0x40, 0x01, 0x60, 0x90,
+0x30, 0xF0, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xD0, 0x50, 0xF2, 0x25, 0xF2, 0x20, 0xF1, 0xA1, 0xF0,
+0x25, 0xF1, 0x20, 0xF4, 0xD0, 0x50, 0xA0, 0xD0, 0xF2, 0x24, 0xF2, 0x23, 0xF1, 0xA1, 0xD0, 0xF0,
+0x24, 0xF1, 0x21, 0xF1, 0xD0, 0x80, 0x30, 0x00, 0x90, 0x60, 0x00, 0x90, 0x60, 0x0F, 0x35, 0x0F,
+0x37, 0x60, 0xC0, 0x02, 0x40, 0x70, 0x50, 0xD2, 0x81, 0x01, 0x70, 0xA0, 0xF2, 0xD0, 0x50, 0x70,
+0x80, 0xE0, 0x05, 0xE0, 0x30, 0x00, 0xB0, 0x70, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xF2, 0x22,
+0xF1, 0x22, 0xF1, 0x22, 0xD0, 0x50, 0xF5, 0x20, 0xD0, 0x70, 0xE0, 0x70, 0x10, 0xC0, 0x30, 0x10,
+0x30, 0x0D, 0x40, 0x07, 0xB0, 0xE0, 0x40, 0xE0, 0xB0, 0x40, 0x0B, 0x60, 0xB0, 0x0A, 0xE0, 0x0B,
+0xE0, 0x0A, 0xB0, 0xE0, 0x00, 0x60, 0xE0, 0x30, 0x90, 0xB0, 0x02, 0xB0, 0x00, 0x61, 0x05, 0xE0,
+0xB0, 0x80, 0x30, 0x80, 0x90, 0x80, 0xC0, 0x80, 0x40, 0x60, 0x30, 0x70, 0x40, 0xB0, 0x04, 0xE0,
+0xB0, 0x30, 0x60, 0x00, 0xE0, 0x70, 0x80, 0xD1, 0xF1, 0x20, 0xF1, 0x50, 0xD3, 0xF0, 0x22, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0xF0,
+0xA0, 0x50, 0xD0, 0x20, 0xF3, 0x22, 0xF4, 0x21, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF3,
+0x21, 0xF0, 0xD1, 0x80, 0x70, 0xE0, 0x01, 0xB0, 0xC0, 0xB0, 0x0F, 0x34, 0x0F, 0x2C, 0xB0, 0x80,
+0xB0, 0x06, 0xE0, 0x30, 0x40, 0x30, 0x01, 0x70, 0x50, 0xD0, 0xF0, 0xD0, 0x80, 0x30, 0x00, 0xB0,
+0x70, 0xA0, 0xD0, 0xF1, 0xD0, 0x90, 0x80, 0xB0, 0x01, 0x40, 0x03, 0xB0, 0x90, 0x01, 0x90, 0xA0,
+0xD0, 0xF0, 0x23, 0xF2, 0x50, 0xD0, 0x20, 0xF2, 0x25, 0xF4, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0xD0, 0x30, 0x70, 0x40, 0x90, 0x10, 0xB0, 0x00, 0xB0, 0x60, 0x0C, 0xE0, 0xB0, 0x03, 0x60,
+0x41, 0x60, 0xB0, 0x02, 0xE0, 0xB0, 0x08, 0x40, 0x80, 0xB0, 0x60, 0x0A, 0xE0, 0xB0, 0x0A, 0xE0,
+0x0A, 0xB0, 0x60, 0x03, 0x40, 0xC0, 0x04, 0xE0, 0xB0, 0x02, 0x92, 0x10, 0x81, 0x01, 0x60, 0x40,
+0xE0, 0x80, 0x31, 0x40, 0xE0, 0x31, 0x90, 0xB0, 0x01, 0x60, 0xB0, 0x40, 0x10, 0x80, 0x90, 0x30,
+0x90, 0x10, 0xC0, 0xD1, 0x21, 0xF0, 0x51, 0x70, 0x90, 0x80, 0xD0, 0x51, 0xD0, 0xF0, 0x20, 0xF3,
+0xD0, 0x50, 0xF1, 0x22, 0xF1, 0x26, 0xF2, 0x50, 0xD0, 0x21, 0xF4, 0x21, 0xF4, 0x21, 0xD0, 0xF0,
+0x50, 0xD0, 0x20, 0xF0, 0x24, 0xF3, 0x23, 0xF0, 0xD0, 0x50, 0x90, 0x01, 0x90, 0xE0, 0x70, 0xB0,
+0x0F, 0x33, 0x0F, 0x2C, 0x30, 0xB0, 0x30, 0x05, 0xE0, 0x30, 0x01, 0x40, 0x30, 0x90, 0xA0, 0xD0,
+0xF0, 0xD0, 0x50, 0x90, 0x01, 0xC0, 0xD0, 0xF1, 0x20, 0xD0, 0x50, 0x90, 0x03, 0xB0, 0xE0, 0x01,
+0xE0, 0x10, 0x02, 0x90, 0xF1, 0x25, 0xF1, 0xA0, 0x50, 0xD0, 0xF2, 0x26, 0xF2, 0x21, 0x50, 0xF1,
+0x23, 0xF0, 0xD2, 0xC0, 0xE0, 0x02, 0x40, 0x0D, 0xE0, 0x00, 0x60, 0x41, 0x60, 0x06, 0x61, 0x0A,
+0xB0, 0x60, 0x0A, 0x60, 0xB0, 0x0A, 0xE0, 0x0A, 0x60, 0xB0, 0x04, 0x80, 0x30, 0x60, 0xB0, 0x01,
+0xE0, 0x01, 0x80, 0xC0, 0x40, 0x00, 0xB0, 0x40, 0x03, 0x60, 0x07, 0x60, 0xE0, 0x90, 0x70, 0xE1,
+0x00, 0x10, 0xB0, 0x01, 0xB1, 0x01, 0x70, 0xA0, 0xD0, 0xF1, 0x50, 0xA0, 0x90, 0x00, 0xE0, 0x30,
+0x70, 0x10, 0x90, 0xD1, 0x50, 0xA0, 0xD1, 0xA1, 0xD0, 0x23, 0xF1, 0x27, 0xD0, 0x50, 0xF0, 0xD0,
+0x22, 0xF5, 0x20, 0xF2, 0x20, 0xF2, 0x50, 0xF3, 0x24, 0xF3, 0x24, 0xF0, 0xD0, 0x50, 0x91, 0x60,
+0x01, 0x90, 0x60, 0x0F, 0x32, 0x0F, 0x2C, 0x40, 0x80, 0x40, 0x04, 0xE0, 0xC0, 0x80, 0x02, 0x70,
+0x50, 0xD2, 0xA0, 0x70, 0x01, 0x90, 0x50, 0xF0, 0x20, 0xF1, 0xA0, 0x90, 0x05, 0x61, 0x40, 0x30,
+0x03, 0x30, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF1, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x24, 0xF1,
+0x21, 0xF0, 0xD0, 0x20, 0xF1, 0x50, 0xD0, 0x20, 0xF0, 0x22, 0xD0, 0xA0, 0x10, 0x04, 0xB0, 0x60,
+0x0B, 0xB0, 0x80, 0x40, 0x60, 0x0A, 0xE0, 0x0B, 0xE0, 0x0A, 0xB0, 0x60, 0x0A, 0xE0, 0x0A, 0xE0,
+0xB0, 0x05, 0xC0, 0x10, 0xC0, 0x10, 0x81, 0x40, 0xE0, 0x10, 0x60, 0x07, 0x40, 0x0A, 0x60, 0x80,
+0x30, 0x60, 0xE0, 0x80, 0x05, 0xB0, 0x70, 0x80, 0xD0, 0x50, 0xF0, 0xD0, 0x90, 0x04, 0x94, 0x80,
+0xD0, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x27, 0xA1, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x21, 0xF0,
+0x20, 0xF2, 0x50, 0xA0, 0xD1, 0xF1, 0x24, 0xF2, 0x26, 0xF0, 0xD0, 0x30, 0x90, 0x02, 0x30, 0x70,
+0x60, 0x0F, 0x31, 0x0F, 0x2B, 0xB0, 0x00, 0xB0, 0x04, 0x60, 0x90, 0x00, 0x40, 0x80, 0x00, 0x90,
+0xA1, 0x50, 0xD0, 0xF0, 0x70, 0xB0, 0x00, 0x90, 0x50, 0xD0, 0x22, 0xD0, 0x31, 0x06, 0xE0, 0x30,
+0x04, 0x90, 0x70, 0xD0, 0xF5, 0x21, 0xF1, 0x50, 0xF1, 0x24, 0xF1, 0x20, 0xF3, 0x20, 0xD0, 0x50,
+0xF2, 0x21, 0xD0, 0xA0, 0xC0, 0x30, 0x05, 0x40, 0x08, 0xB0, 0xE0, 0x40, 0x61, 0xB0, 0x0B, 0x40,
+0x06, 0xB0, 0x03, 0x40, 0x0A, 0xB0, 0x60, 0x0A, 0xE0, 0x0A, 0xE0, 0x06, 0x70, 0x00, 0x60, 0x31,
+0x80, 0x30, 0x70, 0x80, 0x08, 0x40, 0x0B, 0x61, 0x41, 0x80, 0xE0, 0x06, 0x80, 0x30, 0x50, 0xD1,
+0x70, 0x60, 0x08, 0x80, 0x90, 0x80, 0x50, 0xD1, 0xF4, 0x23, 0xF1, 0x21, 0x50, 0xF2, 0x25, 0xF2,
+0x20, 0xF0, 0x21, 0xF1, 0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0x23, 0xF2, 0x25, 0xF2, 0x50, 0xF0, 0x80,
+0x30, 0x00, 0x90, 0x60, 0x00, 0x90, 0xB0, 0x0F, 0x30, 0x0F, 0x29, 0x60, 0x71, 0xC0, 0x60, 0x03,
+0xB0, 0xC0, 0x02, 0xE0, 0x10, 0xA0, 0xD1, 0xA1, 0x30, 0xE0, 0x00, 0x30, 0x50, 0xD0, 0xF0, 0x21,
+0xD0, 0x50, 0x70, 0xB0, 0x06, 0x81, 0x02, 0xE0, 0x90, 0xC0, 0xD0, 0xF2, 0x20, 0xF1, 0x22, 0xF0,
+0xD0, 0xF0, 0x50, 0xD0, 0x25, 0xF0, 0x22, 0xF4, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x10, 0x40, 0x06,
+0x61, 0x05, 0xB0, 0x40, 0xE0, 0xB0, 0x02, 0x40, 0x0B, 0x60, 0xB0, 0x03, 0x30, 0x11, 0x03, 0x40,
+0x0A, 0xB0, 0xE0, 0x00, 0x40, 0x08, 0x40, 0x0A, 0x40, 0x06, 0x40, 0x30, 0x80, 0x01, 0xE0, 0x00,
+0x70, 0x08, 0x60, 0xB0, 0x0B, 0x40, 0x01, 0x40, 0x70, 0x80, 0xE0, 0xB0, 0x05, 0x40, 0x70, 0xD2,
+0xC0, 0xB0, 0x08, 0x40, 0xE0, 0x80, 0x70, 0x80, 0xD1, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xD0, 0x50,
+0xF3, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xF3, 0x23, 0xF1, 0x21,
+0xF0, 0x24, 0xF2, 0x50, 0xA0, 0xD1, 0x50, 0xC0, 0x60, 0x02, 0x10, 0x0F, 0x30, 0x0F, 0x29, 0x90,
+0x60, 0x00, 0xB0, 0x10, 0x40, 0x01, 0xB0, 0x90, 0x40, 0x30, 0x01, 0x70, 0xA0, 0xD0, 0x20, 0xF0,
+0xD0, 0x80, 0x30, 0x00, 0x80, 0x30, 0xD0, 0xF0, 0x21, 0xD0, 0x50, 0xC0, 0x07, 0x80, 0x90, 0x00,
+0x40, 0x01, 0x90, 0x10, 0x30, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xA1, 0xD0, 0x23, 0xF1,
+0x22, 0xF4, 0xA1, 0xD0, 0xF0, 0xD0, 0x30, 0x10, 0xB0, 0x07, 0x40, 0x03, 0xE0, 0x40, 0xE0, 0x05,
+0xE0, 0x0B, 0xB0, 0x60, 0x03, 0x60, 0x40, 0x60, 0x03, 0x60, 0xB0, 0x0A, 0xE0, 0x00, 0xC0, 0xB0,
+0x07, 0xE0, 0x0A, 0xE0, 0x02, 0x40, 0xE0, 0x02, 0x80, 0x10, 0xE0, 0xB2, 0xC0, 0x40, 0xC0, 0x90,
+0x70, 0x90, 0x80, 0xE0, 0x01, 0xE0, 0x0B, 0xB0, 0x60, 0xC0, 0x31, 0x90, 0xE0, 0x00, 0xE0, 0x40,
+0x60, 0x03, 0xE0, 0x60, 0x70, 0xF0, 0xD0, 0xF0, 0x70, 0xB0, 0x06, 0xE0, 0xB0, 0x01, 0x60, 0x70,
+0x80, 0x50, 0xD1, 0x21, 0xF1, 0x20, 0xF1, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x21, 0xF0,
+0x21, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF1, 0x24, 0xF4, 0x24, 0xF1, 0xD0, 0x50, 0xA0, 0xD0,
+0xF0, 0x20, 0xD0, 0x50, 0x90, 0x01, 0x90, 0x40, 0x90, 0x06, 0x40, 0x70, 0x0F, 0x26, 0x0F, 0x29,
+0x81, 0x02, 0xC0, 0x60, 0x00, 0x90, 0xB0, 0x00, 0x40, 0x80, 0x90, 0x50, 0xD0, 0xF1, 0xD0, 0xA0,
+0x30, 0x60, 0x91, 0xD1, 0x21, 0xD0, 0x50, 0x30, 0x08, 0x60, 0x10, 0x30, 0x00, 0xE1, 0x11, 0xA0,
+0xD0, 0xF0, 0x21, 0xF1, 0x24, 0xF2, 0x50, 0xD0, 0x23, 0xF1, 0x23, 0xF3, 0xD0, 0x50, 0xF0, 0xD0,
+0x90, 0x11, 0x30, 0x07, 0x60, 0xB1, 0xE0, 0x40, 0xB0, 0x07, 0xB0, 0x60, 0x0B, 0x40, 0x0A, 0xB0,
+0x60, 0x0A, 0xE0, 0x05, 0xB0, 0x10, 0x80, 0x01, 0x40, 0x07, 0x60, 0xE0, 0x40, 0x80, 0x90, 0x30,
+0x90, 0x40, 0x30, 0x90, 0xC0, 0x90, 0x80, 0x01, 0xE0, 0x01, 0xB0, 0xE0, 0x02, 0xB0, 0x60, 0x30,
+0x80, 0x00, 0xE0, 0x0B, 0xE0, 0x00, 0xB0, 0x70, 0x05, 0xB0, 0x40, 0xE0, 0x00, 0x60, 0xB0, 0x00,
+0x60, 0x70, 0xF0, 0xD0, 0x40, 0x80, 0x05, 0xB0, 0xE0, 0x04, 0x40, 0x80, 0x70, 0xF0, 0xD0, 0x20,
+0xF0, 0x21, 0xF1, 0x30, 0x90, 0xD0, 0xF1, 0x21, 0xF1, 0x26, 0xF2, 0x50, 0xF0, 0xD0, 0xF0, 0x24,
+0xF3, 0x25, 0xF0, 0xD0, 0xF0, 0x50, 0xF5, 0xD0, 0x50, 0x31, 0x60, 0x00, 0x60, 0x30, 0x04, 0xC0,
+0x30, 0x40, 0x70, 0x0F, 0x25, 0x0F, 0x26, 0x60, 0x40, 0x01, 0x70, 0x80, 0x01, 0x40, 0x80, 0x90,
+0x80, 0x02, 0x70, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x70, 0x60, 0xC1, 0x50, 0xD0, 0xF2, 0xD0, 0xC0,
+0xE0, 0x09, 0xB0, 0x10, 0x31, 0xE0, 0xB0, 0x10, 0xA0, 0xF0, 0x26, 0xF0, 0x22, 0xF2, 0x50, 0xD0,
+0xF0, 0x21, 0xF2, 0x26, 0xF0, 0xA1, 0x30, 0x10, 0x40, 0x60, 0x08, 0xB0, 0x80, 0xE0, 0xB0, 0x0A,
+0x40, 0x0B, 0x40, 0x0B, 0xE0, 0x0A, 0xE0, 0x06, 0xE0, 0xB0, 0x01, 0x40, 0x06, 0x40, 0x90, 0x40,
+0xE0, 0x40, 0x00, 0xB0, 0x08, 0x40, 0x09, 0xE0, 0x90, 0x40, 0xB0, 0x01, 0x60, 0xB0, 0x06, 0x40,
+0x00, 0x60, 0x90, 0x07, 0xB0, 0xE0, 0x40, 0x01, 0xB0, 0x70, 0xD0, 0xF0, 0x30, 0x40, 0x05, 0xE0,
+0xB0, 0x06, 0x60, 0x70, 0xD1, 0xF0, 0x21, 0xF0, 0x50, 0xD0, 0xC0, 0x70, 0xD0, 0xF2, 0x20, 0xF1,
+0x20, 0xF0, 0x23, 0xF1, 0x50, 0x20, 0xF1, 0x25, 0xF4, 0x23, 0xD1, 0xF0, 0x50, 0xA0, 0xF3, 0x22,
+0xD0, 0x31, 0x02, 0x91, 0x01, 0x60, 0xB0, 0x31, 0x00, 0x81, 0x0F, 0x24, 0x0F, 0x26, 0x60, 0x10,
+0x80, 0x01, 0x71, 0xE0, 0x30, 0xC0, 0xB0, 0x81, 0x00, 0x81, 0xD0, 0x21, 0xF0, 0xD0, 0x30, 0x40,
+0x70, 0x10, 0x80, 0xA0, 0x50, 0xD2, 0xC0, 0x40, 0x0B, 0xB0, 0x60, 0xC0, 0x61, 0x80, 0x50, 0xD0,
+0xF0, 0x22, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0xD0, 0xA1, 0xF2, 0x20, 0xF2, 0x26, 0xD0, 0xA0, 0xC0,
+0x70, 0x00, 0x10, 0xB0, 0x05, 0xB0, 0x40, 0xE0, 0x40, 0x10, 0xE0, 0x0A, 0xE0, 0xB0, 0x0A, 0x60,
+0xB0, 0x0A, 0xE0, 0x0A, 0xE0, 0x0A, 0xE0, 0x05, 0x40, 0x10, 0x02, 0x90, 0x11, 0xC0, 0x60, 0x06,
+0x40, 0x01, 0x30, 0x80, 0x06, 0xB0, 0x80, 0x70, 0x91, 0x81, 0x90, 0x70, 0x90, 0x80, 0x01, 0xB1,
+0x30, 0xC0, 0x09, 0xB0, 0xE2, 0x30, 0x80, 0x90, 0x10, 0x30, 0x05, 0x60, 0xE0, 0x08, 0x60, 0xC0,
+0x50, 0xD0, 0xF0, 0xD0, 0xA1, 0xD1, 0x10, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF0,
+0xD0, 0x50, 0xA0, 0xF2, 0x25, 0xF1, 0x22, 0xF0, 0x20, 0xD0, 0x51, 0xD0, 0x50, 0xA0, 0xD0, 0xF2,
+0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x30, 0x40, 0x00, 0x90, 0xE1, 0x80, 0xB0, 0xC0, 0x01, 0x30, 0x40,
+0x0F, 0x26, 0x0F, 0x26, 0x60, 0x31, 0x70, 0x01, 0xE0, 0x30, 0x70, 0x60, 0x01, 0xE0, 0x70, 0x80,
+0xD0, 0x21, 0xF0, 0xD1, 0x70, 0x30, 0xC0, 0x70, 0xD1, 0xA0, 0x50, 0x80, 0x70, 0x40, 0x0D, 0x70,
+0x01, 0x60, 0xE0, 0xC0, 0xD0, 0xA0, 0xD0, 0x20, 0xF0, 0x22, 0xF1, 0x22, 0xF2, 0x50, 0xF3, 0x20,
+0xF1, 0x26, 0xD0, 0x70, 0x30, 0x01, 0x60, 0x04, 0xB0, 0x40, 0xE0, 0x01, 0x10, 0x40, 0x0B, 0xB0,
+0xE0, 0x0B, 0xE0, 0x0A, 0x40, 0x02, 0xB0, 0x06, 0x40, 0x0A, 0x40, 0x05, 0x41, 0x02, 0x40, 0x0A,
+0xE0, 0x01, 0xB1, 0x06, 0x40, 0x08, 0x80, 0x30, 0xB0, 0x80, 0x90, 0x70, 0x0A, 0x40, 0x02, 0xE0,
+0x90, 0x10, 0x70, 0x30, 0x90, 0x30, 0xE0, 0x02, 0x40, 0x0B, 0x31, 0xD0, 0xA0, 0x50, 0xD0, 0xF0,
+0xD0, 0xF0, 0x51, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xF2, 0x26, 0xF1,
+0x24, 0xD0, 0xF0, 0x51, 0xA0, 0xD0, 0x20, 0xF5, 0x21, 0xF0, 0xD0, 0x30, 0x70, 0x60, 0x01, 0x40,
+0x30, 0x90, 0x01, 0x90, 0x40, 0x00, 0x80, 0x90, 0x60, 0x0F, 0x22, 0x0F, 0x26, 0xB0, 0xE0, 0x00,
+0x80, 0xC0, 0xB0, 0x00, 0x80, 0x90, 0x80, 0x01, 0x40, 0x30, 0xD1, 0x21, 0xF1, 0xC0, 0x80, 0x30,
+0x10, 0xF0, 0xD0, 0x20, 0xD0, 0x50, 0x80, 0x0E, 0x80, 0x40, 0x02, 0x30, 0x80, 0x50, 0x10, 0x50,
+0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0xD0,
+0x31, 0x61, 0x04, 0xB0, 0x40, 0xE0, 0x03, 0x80, 0x30, 0xB0, 0x0B, 0x40, 0x0B, 0x40, 0x09, 0x60,
+0x81, 0x90, 0x31, 0x90, 0x60, 0x04, 0x40, 0x0A, 0xE0, 0x05, 0xB0, 0x70, 0x02, 0x90, 0xC0, 0x08,
+0xB0, 0x60, 0x04, 0x90, 0xB0, 0x03, 0x40, 0x09, 0x30, 0x90, 0xE0, 0x0B, 0x61, 0x04, 0xE0, 0x70,
+0x90, 0xE0, 0xD0, 0x30, 0x71, 0x40, 0xB0, 0x0C, 0x40, 0x90, 0x50, 0xD1, 0x20, 0xF1, 0xD0, 0xF1,
+0xD0, 0xF0, 0x22, 0xF2, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0x23, 0xF1, 0xD0,
+0xA0, 0x90, 0xA0, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0x90, 0x60,
+0x01, 0x30, 0x90, 0x70, 0x90, 0xC0, 0x30, 0x60, 0xC0, 0x80, 0x60, 0x70, 0x60, 0x0F, 0x21, 0x0F,
+0x23, 0xE0, 0x70, 0x80, 0x03, 0x40, 0x70, 0xE0, 0x80, 0x00, 0x40, 0x80, 0xE0, 0x90, 0xD0, 0xF0,
+0x20, 0xF1, 0xD0, 0x90, 0x40, 0x31, 0x50, 0xD0, 0xF0, 0x20, 0xD0, 0x30, 0xE1, 0x0B, 0x60, 0xE0,
+0x80, 0x00, 0xB0, 0x00, 0x90, 0x80, 0x50, 0xE0, 0xC0, 0x90, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0,
+0x23, 0xF1, 0xA1, 0xD0, 0x22, 0xF0, 0x21, 0xF3, 0xD0, 0x10, 0xB0, 0x00, 0x40, 0x03, 0xE1, 0x04,
+0x41, 0xB0, 0xE0, 0x0B, 0x60, 0xB0, 0x0A, 0x40, 0x06, 0xB0, 0x40, 0x30, 0x80, 0x40, 0x60, 0x02,
+0xB0, 0x31, 0x80, 0x40, 0x60, 0xE0, 0x81, 0x40, 0xB0, 0x07, 0xE0, 0x02, 0xC0, 0x70, 0x30, 0x90,
+0xC0, 0x01, 0xB0, 0x60, 0x09, 0x61, 0x04, 0x40, 0xB0, 0x02, 0xB0, 0xE0, 0x08, 0x60, 0x70, 0x60,
+0xB0, 0x0B, 0x40, 0x07, 0x40, 0x90, 0xA0, 0xD1, 0x50, 0x90, 0x30, 0x0D, 0x40, 0x90, 0x81, 0xD1,
+0xF1, 0xD0, 0x50, 0x90, 0xD0, 0xF1, 0x20, 0xF0, 0xD1, 0xF0, 0x50, 0xD0, 0xF1, 0x22, 0xF1, 0x23,
+0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xA0, 0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xD0,
+0x70, 0xE0, 0x30, 0xE0, 0x00, 0x30, 0x40, 0xB1, 0xC0, 0xE0, 0x01, 0x30, 0xE0, 0x0F, 0x21, 0x0F,
+0x22, 0x60, 0x70, 0xB0, 0x70, 0x60, 0x03, 0xB0, 0x10, 0x02, 0x80, 0x70, 0xD0, 0xF0, 0x21, 0xF0,
+0xD0, 0x80, 0x40, 0x30, 0x50, 0xD1, 0xF3, 0x30, 0x00, 0xB0, 0xE0, 0x08, 0xB0, 0x70, 0x10, 0x30,
+0x01, 0x10, 0xC0, 0x50, 0xD0, 0xF0, 0x50, 0xC0, 0x30, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x24,
+0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0xD1, 0x10, 0x01, 0x61, 0x00, 0xE0,
+0x40, 0xB0, 0x04, 0xB0, 0x10, 0x40, 0x00, 0xE0, 0xB0, 0x0B, 0x40, 0x0A, 0x60, 0xB0, 0x00, 0xE0,
+0x30, 0x90, 0x31, 0x80, 0x40, 0xB0, 0x00, 0xB0, 0x60, 0x04, 0xB1, 0x40, 0x80, 0x41, 0x60, 0x81,
+0x07, 0xE0, 0x02, 0x70, 0x10, 0x40, 0x03, 0xB1, 0x04, 0x60, 0x03, 0xE0, 0x0A, 0x60, 0xB0, 0x09,
+0xE0, 0x90, 0x0B, 0xB0, 0xE0, 0x08, 0x60, 0x90, 0xE0, 0xD0, 0xA0, 0xD0, 0x10, 0x40, 0x0B, 0xB0,
+0xE0, 0x00, 0xE0, 0x80, 0x70, 0xD1, 0xF1, 0x20, 0xA0, 0xF0, 0x20, 0xF1, 0xD0, 0xF1, 0x50, 0xF1,
+0x20, 0xF1, 0x21, 0xF0, 0x24, 0xF1, 0x22, 0xF1, 0x50, 0xA0, 0xD0, 0xF2, 0x23, 0xF0, 0x21, 0xF0,
+0x20, 0xF2, 0xD1, 0xC0, 0xE0, 0x01, 0x60, 0x10, 0x00, 0x90, 0xE0, 0x01, 0x60, 0xC0, 0x0F, 0x22,
+0x0F, 0x22, 0x40, 0x90, 0x00, 0x70, 0xC0, 0x10, 0x40, 0x01, 0x70, 0x11, 0x60, 0x00, 0x70, 0xD1,
+0x21, 0xF0, 0xD0, 0xA0, 0x70, 0x81, 0xD0, 0xF0, 0x20, 0xF0, 0xD1, 0x80, 0x90, 0x80, 0x40, 0x70,
+0x40, 0x06, 0x80, 0xC0, 0x11, 0x01, 0x10, 0x50, 0xD1, 0xF1, 0xA0, 0x91, 0xD1, 0x22, 0xF0, 0x20,
+0xF1, 0x22, 0xF2, 0xD0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x90, 0x30,
+0x02, 0x80, 0x40, 0xB0, 0x07, 0x40, 0x01, 0xB0, 0xE0, 0x0B, 0x40, 0x0B, 0x30, 0x70, 0x40, 0xB0,
+0x07, 0x40, 0x09, 0x60, 0x00, 0x41, 0x03, 0x60, 0xB0, 0x00, 0x40, 0x30, 0x81, 0x90, 0xB0, 0x40,
+0x10, 0x80, 0x00, 0x30, 0x10, 0x90, 0x80, 0xE0, 0x02, 0x30, 0x10, 0xB0, 0x02, 0x40, 0x0A, 0x40,
+0x0B, 0x90, 0x60, 0x0A, 0x40, 0x0A, 0x40, 0x90, 0x51, 0xD1, 0x70, 0x30, 0x09, 0xB0, 0x40, 0x03,
+0xB0, 0x70, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x50, 0xA0, 0xF0, 0x30, 0xD0, 0x50, 0xF0, 0xD0, 0x20,
+0xF1, 0x22, 0xF1, 0x22, 0xF0, 0x21, 0xF2, 0xD0, 0x50, 0xF5, 0x24, 0xF0, 0x20, 0xF1, 0x21, 0xA0,
+0x20, 0xF1, 0x70, 0x00, 0x40, 0x11, 0x91, 0x01, 0x40, 0x10, 0xB0, 0x60, 0x90, 0x80, 0x0F, 0x1F,
+0x0F, 0x22, 0xB0, 0x40, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x30, 0xB1, 0x11, 0xC0, 0xF0, 0xD0, 0xF0,
+0x21, 0xF1, 0xC0, 0x10, 0x50, 0xD1, 0xF0, 0x21, 0xF0, 0x90, 0x10, 0x70, 0x10, 0x70, 0x30, 0x90,
+0x60, 0x02, 0xB0, 0xE0, 0x91, 0xD0, 0x90, 0x10, 0x82, 0xF0, 0x90, 0xD0, 0xF0, 0xD1, 0x30, 0x70,
+0xA0, 0xD0, 0x22, 0xF4, 0x21, 0xF3, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xD0, 0x71, 0x00,
+0xB0, 0x40, 0x60, 0xE0, 0x04, 0xB0, 0x10, 0x05, 0x40, 0x0B, 0x61, 0x09, 0x90, 0x40, 0x0A, 0x40,
+0x09, 0xB1, 0x00, 0x90, 0x40, 0x02, 0x80, 0x40, 0x00, 0x70, 0x60, 0x80, 0x40, 0xE0, 0x04, 0x60,
+0x41, 0x90, 0x70, 0x13, 0xC0, 0xB0, 0x02, 0x40, 0x0A, 0xE0, 0x0A, 0x61, 0x70, 0xB0, 0x08, 0xB0,
+0xE0, 0x0B, 0xC0, 0x50, 0xA0, 0x50, 0xF0, 0x60, 0x40, 0x70, 0x08, 0x40, 0xB0, 0x05, 0x90, 0x50,
+0xD0, 0xF0, 0xD1, 0x80, 0xC0, 0x90, 0x70, 0x90, 0x80, 0xF0, 0xD0, 0xF0, 0x25, 0xF1, 0x23, 0xF0,
+0x20, 0xF1, 0x50, 0x20, 0xF1, 0x20, 0xF4, 0x23, 0xF3, 0x20, 0xA0, 0xD0, 0xF0, 0xD0, 0xA0, 0xC0,
+0x10, 0xC0, 0x00, 0xB0, 0xC0, 0x71, 0x90, 0x01, 0x40, 0xE0, 0x30, 0xB0, 0x0F, 0x1E, 0x0F, 0x27,
+0xB0, 0x90, 0x30, 0x80, 0x02, 0xC0, 0x80, 0xD0, 0xF3, 0xD0, 0x90, 0x10, 0x50, 0xA0, 0xC0, 0xF1,
+0x21, 0xD0, 0x90, 0x50, 0xD2, 0x80, 0x70, 0x90, 0x31, 0x60, 0x90, 0x10, 0xA0, 0xD0, 0xF0, 0xC1,
+0x90, 0x80, 0xD0, 0xF0, 0xD0, 0xF2, 0xD0, 0x90, 0x71, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD1, 0xF0,
+0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x70, 0x80, 0x60,
+0xE0, 0x01, 0xE0, 0xB0, 0x03, 0xE0, 0x90, 0x05, 0xB0, 0xE0, 0x0B, 0x40, 0x03, 0x40, 0xB0, 0x01,
+0x60, 0x90, 0xB0, 0xE0, 0xB0, 0x09, 0xE0, 0x08, 0x30, 0x60, 0x90, 0x01, 0x80, 0x30, 0x90, 0x80,
+0x01, 0x80, 0xC0, 0xB0, 0x30, 0x10, 0x80, 0x06, 0xE0, 0x01, 0xB0, 0x60, 0x40, 0xB0, 0x03, 0xB0,
+0xE0, 0x09, 0xB0, 0x60, 0x0A, 0x40, 0x00, 0xB0, 0x90, 0x08, 0xE0, 0x0C, 0x70, 0xA0, 0xD0, 0xF0,
+0x50, 0x30, 0x90, 0x10, 0x07, 0x61, 0x07, 0x90, 0x50, 0xD0, 0xF0, 0xD1, 0x90, 0x40, 0x60, 0xE0,
+0x80, 0x90, 0x30, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0x23, 0xF2, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x20,
+0xF3, 0x23, 0xF5, 0x20, 0xF1, 0xD0, 0x30, 0x70, 0x02, 0x30, 0x80, 0x04, 0x40, 0x60, 0x0F, 0x1F,
+0x0F, 0x25, 0xE0, 0xC1, 0x30, 0x40, 0x80, 0x30, 0x00, 0x81, 0xD0, 0x50, 0xF3, 0xD0, 0x70, 0xC0,
+0xD0, 0x50, 0x80, 0xD0, 0xF0, 0x22, 0xD1, 0x21, 0xD0, 0x50, 0x30, 0xD0, 0x80, 0x71, 0xD1, 0xF1,
+0xD0, 0x80, 0x10, 0x50, 0xD0, 0xF6, 0xC0, 0x30, 0x90, 0x70, 0x50, 0xD0, 0x50, 0xD0, 0x80, 0x71,
+0x10, 0x30, 0xD2, 0x21, 0xF1, 0x50, 0xF0, 0xD3, 0xA0, 0xD1, 0x90, 0x40, 0x04, 0x40, 0x0C, 0x40,
+0x0B, 0xE0, 0xB0, 0x02, 0xE0, 0x01, 0x31, 0x01, 0x60, 0xB0, 0x09, 0xE0, 0xB0, 0x07, 0x40, 0xC0,
+0x30, 0x04, 0x80, 0xC1, 0x40, 0x30, 0x60, 0x90, 0x10, 0xB0, 0x06, 0x40, 0x09, 0xB0, 0x60, 0x09,
+0xE0, 0xB0, 0x09, 0xB0, 0x60, 0x01, 0xE0, 0x90, 0x06, 0xB0, 0xE0, 0x0C, 0x80, 0x30, 0xD1, 0x90,
+0x30, 0x40, 0xC0, 0x60, 0x06, 0x40, 0x09, 0x70, 0xA0, 0xD0, 0xF1, 0xD0, 0x80, 0x30, 0x02, 0xE0,
+0x70, 0x80, 0xD1, 0x24, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x21, 0xF1,
+0x23, 0xF0, 0x21, 0xF3, 0xD1, 0xA0, 0x50, 0xD0, 0x30, 0xE0, 0x00, 0x90, 0x40, 0x80, 0xE0, 0x0F,
+0x25, 0x0F, 0x27, 0x60, 0x80, 0x01, 0xE0, 0x70, 0x30, 0xD1, 0xF0, 0x50, 0xA0, 0xD1, 0x71, 0x50,
+0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0xD1, 0xA0, 0xC0, 0x30, 0xA0, 0xD0, 0xF1, 0xD1,
+0x51, 0xD0, 0x23, 0xF1, 0x20, 0xF0, 0x50, 0xD0, 0x30, 0x80, 0x40, 0xC2, 0x90, 0x00, 0xB0, 0x30,
+0x91, 0x70, 0x50, 0xD0, 0x21, 0xD0, 0xF0, 0x50, 0xD0, 0x50, 0x30, 0x51, 0xF0, 0x50, 0xC0, 0x10,
+0x30, 0x03, 0x60, 0xE0, 0x03, 0x10, 0x40, 0x05, 0x61, 0x0A, 0xB0, 0x60, 0x03, 0x40, 0x70, 0x60,
+0x03, 0x40, 0x09, 0x60, 0xB0, 0x07, 0x40, 0x90, 0x60, 0x02, 0x40, 0xC0, 0x90, 0xE0, 0x02, 0xE0,
+0x40, 0x90, 0x07, 0x40, 0x09, 0x60, 0xB0, 0x09, 0x40, 0x0A, 0xE0, 0x03, 0x40, 0x70, 0x60, 0x04,
+0xE0, 0xB0, 0x0B, 0xE0, 0x60, 0x70, 0xD0, 0xF0, 0xD0, 0x90, 0x10, 0x90, 0xE0, 0x05, 0x40, 0x0B,
+0x70, 0x50, 0xD1, 0xA1, 0x80, 0x30, 0x03, 0x40, 0x70, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF3,
+0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x26, 0xF1, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xF1, 0xD0, 0x90, 0x70,
+0x60, 0x01, 0x30, 0xB0, 0x0F, 0x24, 0x0F, 0x26, 0xB0, 0xC0, 0x40, 0x01, 0xB0, 0x70, 0xD1, 0x20,
+0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xC0, 0x80, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22,
+0xF1, 0xD0, 0xC0, 0x70, 0xD0, 0xA0, 0x50, 0xD2, 0x80, 0xD1, 0xF0, 0x21, 0xF5, 0xD1, 0x80, 0x31,
+0x10, 0xC0, 0x90, 0x05, 0x31, 0xD0, 0xF1, 0x20, 0xD0, 0x31, 0x40, 0x60, 0x90, 0xA0, 0x50, 0xA0,
+0x80, 0xC1, 0x03, 0xB0, 0xC0, 0x03, 0x40, 0x00, 0xE0, 0x01, 0x61, 0x01, 0x30, 0x09, 0xE0, 0x00,
+0x40, 0x02, 0x40, 0x80, 0x05, 0xE0, 0x09, 0xB0, 0x60, 0x08, 0x60, 0x80, 0xB0, 0x60, 0x31, 0x05,
+0xE0, 0x09, 0x40, 0x09, 0xE0, 0x0A, 0xE0, 0x02, 0xB0, 0x40, 0xB0, 0x04, 0x40, 0x05, 0x31, 0x40,
+0x60, 0x00, 0xB0, 0xE0, 0x0C, 0xE0, 0xC0, 0x50, 0xF0, 0x20, 0xD0, 0x30, 0x10, 0x40, 0x00, 0x40,
+0x60, 0x02, 0xE0, 0xB0, 0x0C, 0x30, 0x90, 0xA0, 0x50, 0xF0, 0xD0, 0x30, 0x80, 0x04, 0x30, 0x90,
+0xA0, 0xD0, 0xF5, 0x50, 0xF2, 0x20, 0xF4, 0x22, 0xF3, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xA0,
+0xF0, 0x21, 0xF1, 0x70, 0x02, 0x80, 0xC0, 0x0F, 0x24, 0x0F, 0x26, 0x90, 0xB0, 0x81, 0xB0, 0x70,
+0xD1, 0xF2, 0x20, 0xD0, 0xA1, 0x80, 0xD1, 0xF0, 0x22, 0xF0, 0x21, 0xF2, 0x22, 0xF0, 0xD0, 0x50,
+0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xA0, 0xC0, 0xD0, 0x24, 0xF4, 0xD0, 0x31, 0x80, 0xC0, 0x30,
+0x70, 0x30, 0x40, 0x03, 0x40, 0x71, 0xD1, 0x20, 0xF1, 0x80, 0x90, 0x01, 0xE0, 0x30, 0xD2, 0x30,
+0x70, 0x04, 0x61, 0x00, 0x30, 0xB0, 0x00, 0xC0, 0x10, 0x01, 0x40, 0x60, 0x01, 0xE0, 0x60, 0x08,
+0x80, 0x00, 0xE0, 0xB0, 0x01, 0x90, 0x06, 0x60, 0xB0, 0x09, 0x40, 0x02, 0xE0, 0x80, 0x30, 0x90,
+0x32, 0x70, 0xC0, 0x80, 0x60, 0x02, 0xB0, 0x02, 0x40, 0x09, 0x40, 0x09, 0x40, 0x09, 0x60, 0xB0,
+0x00, 0x30, 0x70, 0xC0, 0x70, 0x90, 0x30, 0x02, 0x61, 0x06, 0x60, 0xE0, 0x80, 0xC0, 0x70, 0xB0,
+0x0B, 0xE0, 0x60, 0x70, 0xD0, 0x21, 0xD0, 0x70, 0xE0, 0x02, 0xE0, 0x40, 0x00, 0xB0, 0xE0, 0x0E,
+0xE0, 0x90, 0xD0, 0xF1, 0xD0, 0x90, 0x60, 0x04, 0xB0, 0x90, 0x80, 0xD2, 0xF1, 0x50, 0xA0, 0xF1,
+0x20, 0xF1, 0x20, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1,
+0xD0, 0xA0, 0x70, 0x00, 0x30, 0x40, 0x60, 0x30, 0x0F, 0x23, 0x0F, 0x25, 0x80, 0xE0, 0x01, 0xE0,
+0xC0, 0xA0, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x90, 0x70, 0x50, 0xD1, 0xF1, 0x21, 0xF0, 0x21,
+0xF2, 0x20, 0xF3, 0xD0, 0xF2, 0xD0, 0xA0, 0x50, 0xF0, 0xA0, 0x24, 0xF1, 0xD4, 0x50, 0x71, 0x10,
+0x90, 0x30, 0x50, 0x10, 0x01, 0xB0, 0x80, 0xC0, 0x50, 0xA1, 0x90, 0xD0, 0xF1, 0xD0, 0x30, 0x80,
+0xE0, 0x00, 0x70, 0xF2, 0xD0, 0x70, 0x90, 0x02, 0x40, 0x00, 0x30, 0x00, 0xE0, 0xB0, 0x10, 0xC0,
+0x80, 0x06, 0x40, 0x08, 0xB0, 0x00, 0xB0, 0xE0, 0x00, 0x41, 0x06, 0xB0, 0x60, 0x09, 0x40, 0x01,
+0x60, 0x90, 0xB0, 0x02, 0x60, 0xB0, 0x40, 0xB0, 0x04, 0x90, 0xB0, 0x01, 0x40, 0x09, 0xE0, 0x09,
+0xE0, 0x09, 0xE0, 0x01, 0x31, 0x60, 0xD1, 0xC1, 0x40, 0x00, 0x40, 0x08, 0x40, 0x90, 0x40, 0x80,
+0x90, 0xE0, 0x09, 0xB0, 0xE1, 0x70, 0xD0, 0x20, 0xF0, 0xD0, 0x10, 0xE0, 0x03, 0xB0, 0x41, 0x0F,
+0x00, 0xE0, 0x60, 0x70, 0xD0, 0xF2, 0x70, 0x06, 0x80, 0x70, 0x50, 0xD0, 0xF0, 0x50, 0xF3, 0x20,
+0xF1, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x21, 0xF2, 0x50, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x20,
+0xD0, 0xF0, 0x50, 0xC0, 0x60, 0x01, 0x80, 0x40, 0x0F, 0x22, 0x0F, 0x24, 0xE0, 0xC0, 0x40, 0x01,
+0x80, 0x50, 0xD0, 0x21, 0xF0, 0x21, 0xD0, 0xA0, 0x90, 0xC0, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0x20,
+0xF0, 0xD0, 0xA0, 0xD1, 0xF0, 0xD0, 0xA1, 0xD0, 0xF5, 0xD0, 0xA0, 0x50, 0x10, 0xA0, 0xF0, 0x22,
+0xD1, 0xA0, 0x70, 0x30, 0xC0, 0x10, 0x80, 0x90, 0x10, 0x70, 0x90, 0x50, 0x40, 0x90, 0x30, 0x70,
+0x90, 0x70, 0xD2, 0xA0, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0x40, 0x90, 0x70, 0xA0, 0xD0, 0x21, 0xD0,
+0xC0, 0x70, 0xB0, 0x00, 0x90, 0x70, 0x90, 0xC0, 0x90, 0x30, 0x00, 0x40, 0x00, 0xB0, 0x80, 0x05,
+0xB0, 0x60, 0x02, 0xB0, 0x40, 0x05, 0x40, 0x00, 0x31, 0xE0, 0x06, 0x40, 0x09, 0xE0, 0x40, 0x01,
+0x30, 0xE0, 0x04, 0xE0, 0x09, 0xE0, 0x08, 0xB0, 0xE0, 0x08, 0x40, 0x80, 0x09, 0x40, 0xB0, 0xC0,
+0x10, 0x90, 0x30, 0x50, 0x30, 0xE0, 0x10, 0x01, 0x40, 0x04, 0x80, 0xE0, 0x00, 0x30, 0x10, 0x50,
+0xA1, 0xD0, 0x90, 0x30, 0x08, 0x40, 0x01, 0x90, 0x70, 0xD1, 0xA0, 0xC0, 0xB0, 0x04, 0xE2, 0x0D,
+0xE0, 0x60, 0x00, 0x40, 0x90, 0xD0, 0xF0, 0xD0, 0xA0, 0x70, 0x07, 0x80, 0x90, 0x50, 0xF0, 0xD0,
+0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0x20, 0xF1,
+0x21, 0xF2, 0xD1, 0x30, 0x40, 0x01, 0x80, 0xC0, 0x60, 0x0F, 0x21, 0x0F, 0x23, 0xB0, 0x70, 0x00,
+0x40, 0x30, 0x40, 0x30, 0xD0, 0xF2, 0x22, 0xD0, 0xC0, 0x70, 0x50, 0xD0, 0xF0, 0x50, 0xA0, 0xD0,
+0x20, 0xD0, 0xA0, 0x90, 0xC1, 0x90, 0xC1, 0x10, 0xC0, 0x80, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x20,
+0xD0, 0x50, 0x80, 0xA0, 0xF0, 0xD0, 0xF0, 0xD0, 0xA0, 0xD0, 0x90, 0x60, 0x90, 0x70, 0x91, 0x11,
+0xA0, 0xD0, 0xF0, 0x50, 0xA1, 0xD3, 0xF1, 0xD0, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xA1, 0xD0,
+0x22, 0xD0, 0x30, 0x11, 0x80, 0x10, 0xE0, 0x40, 0x10, 0x90, 0xE0, 0x41, 0x30, 0x90, 0xC0, 0xB0,
+0x01, 0x60, 0x00, 0x80, 0x90, 0x30, 0x01, 0x60, 0x07, 0x60, 0xB1, 0x81, 0x06, 0x40, 0x05, 0x40,
+0x80, 0x30, 0xB1, 0x10, 0xE0, 0x80, 0x30, 0x60, 0x04, 0xE0, 0x09, 0x40, 0x04, 0xB0, 0x70, 0x01,
+0xB0, 0x60, 0x08, 0x81, 0x09, 0xE0, 0x00, 0x60, 0x70, 0xC0, 0x10, 0xC0, 0x91, 0x01, 0x61, 0x03,
+0xB0, 0xC1, 0xE0, 0xC1, 0x51, 0xD0, 0xF0, 0xD0, 0x30, 0x40, 0x06, 0x61, 0x01, 0xE0, 0x30, 0x10,
+0x80, 0x70, 0x30, 0x04, 0x61, 0x00, 0xB0, 0x40, 0x0B, 0xE0, 0x60, 0x02, 0xE0, 0x70, 0xD0, 0xF0,
+0xD0, 0x81, 0x04, 0x60, 0x01, 0x40, 0x90, 0x80, 0xD0, 0xF2, 0x20, 0xF0, 0x25, 0xF0, 0x23, 0xF2,
+0xA0, 0x50, 0xD0, 0xF1, 0x21, 0xF3, 0x21, 0xF0, 0xD0, 0x90, 0xE0, 0x90, 0x60, 0x00, 0x70, 0x0F,
+0x21, 0x0F, 0x23, 0x70, 0x02, 0xE0, 0xC0, 0xD0, 0xF3, 0x21, 0xD0, 0x50, 0xC0, 0x50, 0xD0, 0xF2,
+0x50, 0xA0, 0xD1, 0x70, 0xB0, 0x00, 0x60, 0x00, 0x80, 0x10, 0x70, 0xC0, 0x50, 0xD0, 0x25, 0xF0,
+0xA0, 0xC0, 0x30, 0xC0, 0x50, 0xD0, 0x50, 0xC0, 0x70, 0x10, 0x40, 0x30, 0x40, 0x70, 0xC0, 0x10,
+0x50, 0xD0, 0xF2, 0x50, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0xA1, 0xD1, 0xF1, 0x50,
+0xF0, 0x22, 0xF0, 0xD0, 0x50, 0x10, 0x80, 0x90, 0x11, 0x70, 0x81, 0x51, 0xA0, 0xD0, 0x70, 0x30,
+0x00, 0x30, 0x90, 0x70, 0x81, 0x30, 0xB0, 0x00, 0x40, 0xB0, 0x07, 0x30, 0x80, 0xE0, 0x07, 0xB1,
+0x02, 0xB0, 0x90, 0x40, 0xB1, 0x70, 0x30, 0x70, 0x90, 0x30, 0x80, 0x05, 0xE0, 0x01, 0x40, 0x06,
+0xE0, 0x01, 0xB0, 0x30, 0xE0, 0x03, 0x61, 0x02, 0x60, 0x04, 0xE0, 0x09, 0x60, 0xB0, 0x04, 0xB1,
+0x02, 0x40, 0x04, 0xE0, 0x90, 0xE0, 0x10, 0x70, 0xA0, 0xF0, 0xA0, 0xF0, 0x20, 0xD1, 0x70, 0x06,
+0x40, 0x03, 0x30, 0x90, 0x10, 0x80, 0x30, 0x60, 0x03, 0x40, 0x03, 0x40, 0x60, 0x08, 0xB0, 0xE0,
+0x04, 0xE0, 0x70, 0xD0, 0xF0, 0xD0, 0x70, 0x60, 0x03, 0x30, 0xB0, 0x40, 0xB0, 0x00, 0x80, 0x30,
+0xD1, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x23, 0xF0, 0x20, 0xD0, 0xA1, 0xF1, 0x23, 0xF1, 0x20, 0xF1,
+0x21, 0xF1, 0xC0, 0xB0, 0x01, 0xB0, 0x90, 0x0F, 0x20, 0x0F, 0x22, 0x80, 0x70, 0x40, 0x01, 0x90,
+0xA0, 0xD0, 0x20, 0xF1, 0x20, 0xF2, 0x90, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0xA1, 0x50, 0x40,
+0x02, 0x40, 0x90, 0xD0, 0x90, 0x70, 0x30, 0xD0, 0xF2, 0x21, 0xF1, 0x50, 0x30, 0x90, 0x30, 0xA0,
+0x30, 0x90, 0xB0, 0x30, 0xC0, 0x90, 0x11, 0xC0, 0x10, 0xA0, 0xD0, 0xF0, 0x21, 0xF1, 0x50, 0xF1,
+0x20, 0xF1, 0x21, 0xF0, 0x50, 0xA0, 0xF0, 0x90, 0xD1, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xD1, 0xF0,
+0x50, 0xA0, 0xD0, 0xA0, 0x50, 0xD1, 0xA1, 0xD0, 0xF0, 0xD0, 0x70, 0x40, 0xB0, 0x90, 0xD1, 0xA0,
+0x70, 0x00, 0x40, 0x04, 0xB1, 0x03, 0x70, 0x09, 0x40, 0x32, 0x90, 0x30, 0x60, 0xB0, 0x80, 0xB0,
+0x00, 0xB0, 0x60, 0x08, 0xE0, 0xB0, 0x00, 0x10, 0x40, 0x05, 0x40, 0x00, 0x90, 0x10, 0x80, 0x03,
+0xB0, 0x60, 0xB0, 0x01, 0x60, 0xC0, 0x04, 0xE0, 0x09, 0x40, 0x09, 0xB0, 0xE0, 0x05, 0x80, 0x10,
+0x70, 0xD1, 0x50, 0xD0, 0xF2, 0xD0, 0x70, 0xB0, 0x04, 0xE0, 0xB0, 0x01, 0xB0, 0x70, 0x80, 0x00,
+0x80, 0x30, 0x70, 0xE0, 0x02, 0x40, 0x05, 0xE1, 0x07, 0x40, 0x06, 0x40, 0x30, 0xD0, 0xF0, 0xD0,
+0x70, 0xE0, 0x02, 0x60, 0x80, 0xB0, 0x02, 0x40, 0x70, 0xF0, 0xD0, 0xF3, 0x22, 0xF0, 0x23, 0xF0,
+0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xD0, 0x20, 0xF1, 0x23, 0xF2, 0x20, 0xD0, 0x50, 0x30, 0x01,
+0x80, 0x70, 0x40, 0x0F, 0x1F, 0x0F, 0x21, 0x40, 0x80, 0x00, 0x40, 0x31, 0x80, 0xD0, 0xF0, 0x22,
+0xF0, 0x20, 0xD0, 0x90, 0x40, 0xC0, 0xD0, 0x21, 0xF0, 0xD2, 0x30, 0x90, 0x02, 0x40, 0x70, 0xD0,
+0x30, 0xD0, 0x70, 0xD0, 0xF3, 0x22, 0xF0, 0xD0, 0x91, 0x30, 0x80, 0x11, 0x70, 0x30, 0xE0, 0xC0,
+0x12, 0x30, 0xD1, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x20, 0x50, 0xF0,
+0xD0, 0x50, 0x70, 0xD0, 0xF1, 0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0xD0, 0xF1, 0x22, 0xD1, 0x50, 0xD0,
+0xF0, 0xD0, 0xC0, 0xB0, 0x30, 0x80, 0xD2, 0x70, 0x00, 0xE0, 0x04, 0xE0, 0x60, 0x02, 0x90, 0x40,
+0xB0, 0x06, 0x91, 0x40, 0xE1, 0x02, 0x40, 0x11, 0x02, 0xE0, 0x08, 0x60, 0xB0, 0x40, 0x10, 0x80,
+0x05, 0xE0, 0x06, 0x40, 0x10, 0x90, 0x09, 0x40, 0x09, 0x40, 0x09, 0x60, 0xB0, 0x05, 0xC0, 0x90,
+0xD1, 0xA1, 0x80, 0xD3, 0x40, 0x30, 0x04, 0x40, 0x02, 0x80, 0xE0, 0x03, 0xE0, 0x10, 0xE0, 0x00,
+0xE0, 0x60, 0x06, 0xB0, 0x40, 0x05, 0x40, 0x06, 0xC0, 0x40, 0x30, 0xA0, 0xD2, 0x70, 0xB0, 0x01,
+0xE0, 0x90, 0x60, 0x03, 0xB0, 0x70, 0x50, 0xD1, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0x50, 0xF0, 0xD0, 0xF2, 0x21, 0xF1, 0x24, 0xF0, 0x21, 0xF0, 0xD0, 0x30, 0x80, 0x90, 0xE0, 0x00,
+0x90, 0x60, 0x0F, 0x1E, 0x0F, 0x21, 0x70, 0x02, 0x40, 0x90, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1,
+0xD0, 0x70, 0x10, 0x30, 0xD0, 0x20, 0xF0, 0xD0, 0x50, 0x30, 0x70, 0xE0, 0x60, 0x40, 0x00, 0x40,
+0x90, 0xD1, 0x90, 0x30, 0x50, 0xD0, 0xF2, 0x22, 0xF0, 0xD0, 0xF0, 0x10, 0x60, 0x90, 0x70, 0x30,
+0x10, 0xC0, 0x70, 0x90, 0x10, 0x70, 0x30, 0xC0, 0xA0, 0xD0, 0x23, 0xF2, 0xA0, 0x50, 0xD2, 0xA0,
+0x50, 0xF1, 0xD1, 0xF4, 0xD0, 0x50, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0xA0, 0x50, 0xD0,
+0x30, 0xC0, 0x70, 0x40, 0x81, 0xD0, 0x80, 0x40, 0x01, 0x40, 0x07, 0x80, 0xE0, 0x00, 0x40, 0x05,
+0x70, 0xB0, 0x01, 0x40, 0x03, 0x10, 0x40, 0x01, 0xC0, 0xE1, 0x08, 0xB1, 0x40, 0x07, 0xE0, 0x08,
+0x60, 0xB0, 0x08, 0x40, 0x08, 0xB0, 0x60, 0x09, 0x40, 0x02, 0xE0, 0x02, 0xB0, 0xC0, 0xD0, 0xF0,
+0x50, 0xD0, 0x30, 0x10, 0x90, 0x70, 0xC1, 0xB0, 0x03, 0x40, 0x03, 0x60, 0x80, 0x04, 0xE0, 0xC0,
+0x40, 0xE0, 0x09, 0x40, 0xB0, 0x02, 0x40, 0xB0, 0x05, 0xB0, 0x10, 0x92, 0xA0, 0xD1, 0x50, 0x80,
+0x00, 0x40, 0x00, 0x60, 0x80, 0x05, 0x90, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xD0,
+0xA0, 0x50, 0xF3, 0x20, 0xF2, 0x20, 0xF0, 0x23, 0xF2, 0x20, 0xF1, 0xD0, 0x70, 0x60, 0x02, 0x90,
+0x0F, 0x1E, 0x0F, 0x20, 0x31, 0x80, 0x01, 0x70, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xD0, 0xA0, 0x11,
+0xF2, 0xD0, 0x90, 0x30, 0xE0, 0x00, 0xE0, 0x10, 0xB0, 0xE0, 0x70, 0xD1, 0x80, 0x90, 0x30, 0xD0,
+0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0xC1, 0x40, 0x30, 0x90, 0x40, 0x11, 0x70, 0xC0, 0xD3,
+0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xA1, 0xD0, 0xA1, 0xF1, 0xD0, 0x50, 0x90, 0xD0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0x50, 0xD0, 0xC0, 0x70, 0xD1, 0xC0, 0x10,
+0x82, 0x01, 0xE0, 0xB0, 0x04, 0x80, 0xB0, 0x80, 0x60, 0x00, 0xE0, 0xB0, 0x02, 0xB0, 0x90, 0xB0,
+0x02, 0x60, 0xB0, 0x01, 0x30, 0x10, 0x02, 0x80, 0x10, 0x80, 0x08, 0xB0, 0x60, 0x08, 0xE0, 0x08,
+0xE0, 0x08, 0xB0, 0xE0, 0x08, 0x60, 0xB0, 0x08, 0x61, 0x00, 0xB0, 0x30, 0x10, 0x80, 0x00, 0xE1,
+0x90, 0xD0, 0xA1, 0xD0, 0x81, 0x01, 0x71, 0x03, 0xB0, 0xE0, 0x00, 0xB0, 0x01, 0x80, 0x30, 0x05,
+0x91, 0x0B, 0xE0, 0x60, 0x00, 0xE0, 0xB0, 0x09, 0x30, 0x80, 0x90, 0x50, 0xD1, 0x90, 0x40, 0x02,
+0x30, 0x06, 0x30, 0x50, 0xD0, 0xF2, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF0,
+0x22, 0xF0, 0x24, 0xF0, 0x22, 0xF2, 0xA0, 0x90, 0x01, 0x31, 0x80, 0x0F, 0x1D, 0x0F, 0x1F, 0xE0,
+0x80, 0x00, 0xE0, 0x91, 0xA0, 0xD0, 0x21, 0xF4, 0xD0, 0x90, 0x10, 0xA0, 0xD0, 0xF0, 0xD0, 0x30,
+0x40, 0x00, 0xE0, 0x90, 0x80, 0x70, 0xB0, 0x00, 0x40, 0x30, 0x60, 0x91, 0xF0, 0xD0, 0xF1, 0x21,
+0xF1, 0xD0, 0x50, 0x70, 0xC0, 0x70, 0x90, 0x60, 0x90, 0x10, 0x72, 0x30, 0x50, 0xD0, 0xF2, 0x20,
+0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0x23, 0xF1, 0x21, 0xF0, 0xA1, 0xF1,
+0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF3, 0x50, 0xD2, 0x50, 0x70, 0x60, 0x71, 0x60, 0x01, 0xB0, 0xE0,
+0x04, 0xB0, 0x60, 0x90, 0x00, 0xB0, 0x70, 0x80, 0x02, 0x41, 0x04, 0x40, 0x00, 0x40, 0xC0, 0x90,
+0x03, 0x80, 0x91, 0x40, 0x07, 0xE0, 0x08, 0xE0, 0x08, 0xE0, 0x08, 0x60, 0xB0, 0x08, 0x40, 0x00,
+0x80, 0x07, 0xE0, 0x01, 0x70, 0x30, 0x60, 0x30, 0x70, 0x11, 0x50, 0xD0, 0x50, 0xF0, 0xD0, 0x70,
+0x02, 0x31, 0xB0, 0x02, 0xE0, 0x00, 0x80, 0xC0, 0x70, 0x90, 0x10, 0x06, 0x60, 0x90, 0xB0, 0x0B,
+0x60, 0x40, 0x60, 0x04, 0xE0, 0x80, 0x04, 0x70, 0xE0, 0xC0, 0xD1, 0x50, 0x90, 0x02, 0x90, 0x07,
+0x90, 0x80, 0xD0, 0xF1, 0x21, 0xD0, 0xA1, 0xF4, 0x29, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x50,
+0x91, 0x60, 0x00, 0x30, 0x60, 0x0F, 0x1C, 0x0F, 0x16, 0xE1, 0x05, 0xB0, 0x70, 0x02, 0x40, 0x90,
+0xA0, 0xD0, 0xF3, 0x20, 0xF1, 0xD0, 0xC0, 0x70, 0xD0, 0xF1, 0xD0, 0x70, 0x40, 0x70, 0x30, 0x91,
+0xE0, 0x10, 0xB0, 0x71, 0x80, 0x70, 0x50, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0x90, 0x80, 0xE0,
+0x60, 0x80, 0x10, 0x80, 0x70, 0x11, 0x70, 0x81, 0xD1, 0xF0, 0x20, 0xF2, 0x24, 0xF2, 0x51, 0xF0,
+0xD0, 0xF0, 0x26, 0xF0, 0x22, 0xF0, 0x50, 0xF3, 0xD1, 0xF5, 0xD0, 0xA1, 0xF0, 0xD0, 0x81, 0x00,
+0x40, 0x04, 0x40, 0x04, 0xB0, 0x90, 0x00, 0x80, 0x70, 0xB0, 0x80, 0xB0, 0x60, 0x80, 0x90, 0x03,
+0xB1, 0x40, 0x00, 0x70, 0xC0, 0x60, 0x04, 0x10, 0xC0, 0x10, 0xB0, 0x06, 0xE0, 0x08, 0xE0, 0x08,
+0x40, 0x08, 0xE0, 0x09, 0xE0, 0xB0, 0x30, 0x07, 0x40, 0x02, 0x90, 0x50, 0x60, 0xD1, 0xC0, 0xA0,
+0xF0, 0x50, 0xD1, 0x70, 0x01, 0x60, 0x00, 0xB0, 0x30, 0x90, 0x00, 0xB0, 0x90, 0xE1, 0x80, 0x08,
+0xB0, 0x60, 0x41, 0x0B, 0xB0, 0x41, 0x05, 0x70, 0x05, 0x90, 0x10, 0x90, 0x50, 0xF0, 0xD0, 0x70,
+0x01, 0x80, 0x60, 0x07, 0x30, 0x80, 0xD1, 0xF1, 0x50, 0xA0, 0xF2, 0x20, 0xF1, 0x26, 0xF2, 0x21,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x90, 0x60, 0x02, 0xC0, 0x0F, 0x1C, 0x0F, 0x15, 0xE0,
+0x81, 0x60, 0x04, 0x32, 0x00, 0xB0, 0x70, 0xD0, 0xA0, 0x50, 0xF2, 0x22, 0xD0, 0x30, 0xC0, 0x80,
+0xD0, 0xF0, 0xD0, 0x50, 0x10, 0x50, 0xD0, 0x70, 0xE0, 0x71, 0x90, 0xE0, 0x90, 0x80, 0x90, 0x30,
+0xD1, 0xF0, 0x23, 0xD0, 0x90, 0xE0, 0x02, 0xE0, 0xC0, 0x70, 0xC0, 0x50, 0x10, 0xA2, 0xD0, 0xF1,
+0x23, 0xF0, 0x22, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0x50, 0xF5, 0x80, 0xD0, 0xF6, 0x50, 0xF0, 0xD0,
+0xA0, 0x50, 0xF0, 0xA1, 0xD1, 0xF0, 0xD0, 0xA0, 0x70, 0x80, 0xD0, 0xA0, 0xC0, 0x07, 0xB0, 0xE0,
+0x02, 0xE0, 0x10, 0x40, 0x80, 0x90, 0xE0, 0x10, 0x80, 0x90, 0x30, 0xB0, 0x02, 0xB0, 0xE0, 0xB1,
+0xE0, 0x00, 0x31, 0x60, 0x05, 0x80, 0x08, 0x40, 0x08, 0xE0, 0x08, 0x40, 0x08, 0x40, 0x08, 0xB0,
+0x60, 0x08, 0x60, 0xB0, 0x03, 0x30, 0x70, 0x80, 0xD2, 0x50, 0xD0, 0xA0, 0x31, 0x01, 0x80, 0x90,
+0x01, 0xB0, 0x31, 0x10, 0x80, 0xC0, 0x06, 0xC0, 0x60, 0x00, 0xE1, 0x10, 0xB0, 0x0A, 0xB0, 0x40,
+0x01, 0x40, 0xB0, 0x03, 0xE0, 0x90, 0x40, 0x04, 0xB0, 0x90, 0x50, 0xD1, 0x80, 0x40, 0x00, 0xB0,
+0x30, 0x08, 0x30, 0x80, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x24, 0xF4, 0x20, 0xF3, 0x22,
+0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0x70, 0x00, 0xB0, 0x31, 0x80, 0x0F, 0x1B, 0x0F, 0x15, 0xB0,
+0x80, 0x30, 0xB0, 0x03, 0x41, 0x00, 0x60, 0x30, 0x70, 0xA0, 0xD0, 0xF1, 0x50, 0xA0, 0xF1, 0x21,
+0xD0, 0xC0, 0x90, 0xD0, 0xF1, 0x50, 0x90, 0xA0, 0xD0, 0x30, 0xE0, 0x00, 0x70, 0x40, 0x80, 0x30,
+0xA0, 0x50, 0xC0, 0x51, 0xF1, 0x22, 0xD0, 0x80, 0x40, 0x03, 0x60, 0x10, 0xC0, 0x50, 0xF1, 0xD1,
+0xA0, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xD0, 0xA0, 0x50, 0xF2, 0x20, 0x50, 0xD0, 0x20, 0xF0,
+0xA0, 0x50, 0xD0, 0xF2, 0x21, 0xF1, 0xD0, 0xA1, 0xD0, 0x70, 0x30, 0x90, 0x10, 0xC0, 0xA0, 0x50,
+0xA0, 0xD0, 0x11, 0xC0, 0x30, 0xC0, 0x90, 0x01, 0x60, 0x05, 0x40, 0x02, 0xB0, 0x40, 0xE0, 0x60,
+0x00, 0xB0, 0xC0, 0x80, 0x40, 0x08, 0xB0, 0x60, 0xB0, 0x10, 0x40, 0x05, 0xE0, 0x08, 0x40, 0x08,
+0xE0, 0x08, 0x40, 0x08, 0x40, 0x08, 0xE0, 0xB0, 0x08, 0x40, 0x05, 0xB0, 0x80, 0x70, 0xC0, 0x51,
+0xD0, 0x70, 0x90, 0x03, 0xB1, 0xC0, 0xB0, 0x70, 0xB0, 0x30, 0xC1, 0x04, 0x80, 0x90, 0x80, 0xB0,
+0xE0, 0x00, 0x40, 0x80, 0x0B, 0x40, 0x03, 0x40, 0xB0, 0x03, 0x60, 0x80, 0x70, 0xE0, 0x00, 0x61,
+0x40, 0x90, 0x70, 0xF0, 0xD0, 0x50, 0x80, 0x01, 0x30, 0x09, 0x30, 0x50, 0xA0, 0xF1, 0x20, 0xF0,
+0x21, 0xF0, 0x24, 0xF2, 0x21, 0xF2, 0x24, 0xA0, 0x50, 0xF1, 0xD0, 0x50, 0x70, 0x30, 0x60, 0x00,
+0x30, 0x60, 0x0F, 0x1A, 0x0F, 0x16, 0xB1, 0x04, 0x90, 0x02, 0x81, 0xD0, 0x20, 0xF1, 0xD0, 0x51,
+0xD1, 0x50, 0xD0, 0xC0, 0xA0, 0xF0, 0xD0, 0x70, 0xC0, 0xA0, 0xD0, 0x90, 0x30, 0x00, 0x90, 0x50,
+0xD0, 0x70, 0x10, 0x40, 0x91, 0xD0, 0xA0, 0x50, 0xA0, 0x21, 0xF1, 0x10, 0x80, 0x70, 0x01, 0xB0,
+0x30, 0x70, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0xA1, 0xF2, 0x22, 0xF1, 0xD0, 0xA0, 0x50, 0xD0, 0x20,
+0xF2, 0xA0, 0x50, 0xD1, 0x50, 0xC0, 0xD0, 0xF7, 0xD0, 0x50, 0xF0, 0xA0, 0x50, 0x10, 0xE0, 0x90,
+0x12, 0xC0, 0xE0, 0xB0, 0xE0, 0x80, 0x60, 0x90, 0x01, 0xE0, 0x05, 0xB0, 0xE0, 0x06, 0xB0, 0x90,
+0x00, 0x40, 0x09, 0x40, 0x00, 0x91, 0x05, 0x40, 0x08, 0xE0, 0x08, 0xE0, 0x08, 0xE0, 0x07, 0xB0,
+0xE0, 0x08, 0x40, 0x09, 0x40, 0x08, 0xB0, 0x80, 0x71, 0xC0, 0x06, 0x40, 0xE0, 0x90, 0x70, 0x80,
+0xB0, 0x60, 0x30, 0x03, 0x40, 0x60, 0x00, 0x61, 0x00, 0xB0, 0x80, 0x0A, 0x40, 0x05, 0x40, 0xB0,
+0x03, 0x30, 0x90, 0x30, 0x90, 0x10, 0x90, 0x81, 0x30, 0x70, 0x30, 0xC0, 0x02, 0x70, 0x09, 0xB0,
+0x70, 0xA0, 0xD1, 0x20, 0xF0, 0x21, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0x21, 0xF3, 0x50, 0xA0, 0xD0,
+0xF2, 0xD0, 0x90, 0xE0, 0x02, 0x70, 0x0F, 0x1A, 0x0F, 0x14, 0x80, 0x70, 0x80, 0x04, 0x90, 0x31,
+0x00, 0xB0, 0x70, 0xD0, 0xF1, 0x22, 0xD0, 0xA0, 0x51, 0x10, 0x90, 0x70, 0xD1, 0xF1, 0xD1, 0x70,
+0x40, 0xE0, 0x70, 0x50, 0xD0, 0xC0, 0x10, 0x30, 0x80, 0x90, 0x50, 0xD0, 0xF0, 0xD0, 0x50, 0xA0,
+0xD1, 0x70, 0x90, 0xC1, 0x00, 0x70, 0xC0, 0x50, 0xD1, 0x23, 0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x22,
+0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0xA0, 0x50, 0xD1, 0x50, 0x90, 0xD0, 0xF2, 0x20,
+0xF2, 0xD1, 0x50, 0xD0, 0x90, 0x70, 0x02, 0x80, 0x40, 0xE0, 0x03, 0x30, 0x40, 0x06, 0xE0, 0x01,
+0x40, 0x06, 0xB0, 0x90, 0x00, 0x61, 0x08, 0x40, 0x08, 0xE0, 0x08, 0xE0, 0x08, 0xE0, 0x07, 0xB0,
+0x60, 0x07, 0xB0, 0x60, 0x07, 0xB0, 0xE0, 0x08, 0x60, 0xB0, 0x09, 0xE0, 0x0A, 0x80, 0x90, 0x00,
+0x70, 0x10, 0xB0, 0x80, 0x30, 0x05, 0x40, 0x02, 0x90, 0x09, 0x40, 0xB0, 0x06, 0x40, 0x60, 0x01,
+0x60, 0x90, 0x30, 0x70, 0xD0, 0xA0, 0xE0, 0xD1, 0x71, 0x80, 0x10, 0x30, 0x00, 0xB0, 0x70, 0x08,
+0xE1, 0x00, 0x70, 0xF1, 0x23, 0xF2, 0x23, 0xF2, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0x20, 0xF1, 0x21,
+0xF1, 0xD0, 0x70, 0x01, 0x90, 0x30, 0x80, 0x0F, 0x19, 0x0F, 0x13, 0x40, 0x30, 0xB0, 0x80, 0x10,
+0x40, 0x01, 0x41, 0x00, 0xB0, 0x90, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD1, 0x30, 0x80,
+0x10, 0x80, 0xD0, 0x70, 0xD0, 0xF0, 0xD0, 0x90, 0x60, 0xE0, 0xC0, 0x50, 0xD0, 0x11, 0x30, 0xD0,
+0x30, 0x90, 0x50, 0xD2, 0xF0, 0xA0, 0x50, 0xD1, 0xC1, 0x40, 0xC0, 0x50, 0xD0, 0x20, 0xF0, 0x20,
+0xF0, 0x23, 0xF2, 0xA0, 0x50, 0xD0, 0xF2, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF0, 0xD0, 0xA1,
+0xD1, 0x70, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0xD2, 0x10, 0xD1, 0x40, 0x10, 0x60, 0x05, 0x90, 0x40,
+0x01, 0xE0, 0x90, 0x06, 0x80, 0x01, 0x61, 0x06, 0x40, 0xE0, 0x00, 0x40, 0x08, 0x60, 0xB0, 0x07,
+0x60, 0xB0, 0x07, 0xE0, 0xB0, 0x07, 0xE0, 0x07, 0x61, 0x07, 0x60, 0xB0, 0x07, 0x60, 0xB0, 0x08,
+0x40, 0x09, 0xE0, 0xB0, 0x09, 0x60, 0x40, 0x02, 0x31, 0x00, 0x90, 0x10, 0x40, 0x60, 0x42, 0x03,
+0x30, 0x08, 0xE0, 0x60, 0x08, 0xE0, 0x60, 0x80, 0xC0, 0xD0, 0xF0, 0x51, 0xF0, 0xD1, 0x50, 0x70,
+0xB0, 0x90, 0x30, 0x90, 0xC0, 0x70, 0x08, 0x40, 0x60, 0x01, 0x60, 0x90, 0xD0, 0x20, 0xF1, 0x22,
+0xF1, 0x23, 0xF0, 0x23, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x23, 0xF1, 0xD0, 0x50, 0x70, 0x30, 0x01,
+0x80, 0x60, 0x0F, 0x18, 0x0F, 0x13, 0x30, 0xE0, 0x02, 0x70, 0x40, 0x00, 0xC0, 0x02, 0x81, 0xD0,
+0xF0, 0x21, 0xF0, 0x22, 0xD0, 0x50, 0xC0, 0x31, 0x50, 0x70, 0x50, 0xD0, 0xF0, 0xC0, 0x10, 0x30,
+0x90, 0xD2, 0x30, 0x50, 0xD0, 0xA0, 0x30, 0x40, 0x70, 0xF0, 0xA0, 0x70, 0x30, 0xD0, 0xA0, 0x50,
+0xD0, 0xA0, 0x80, 0x50, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF3, 0xD0, 0xA0, 0x50, 0xD1, 0xF0, 0x50,
+0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0xD0, 0x81, 0xD3, 0x50, 0xA0, 0x50, 0xC0,
+0x50, 0x70, 0x30, 0x70, 0xB1, 0x00, 0x60, 0x40, 0x91, 0x40, 0x70, 0x00, 0xB0, 0x30, 0x40, 0x01,
+0x40, 0x07, 0x40, 0x06, 0x60, 0x30, 0xE0, 0x40, 0x08, 0xB0, 0xE0, 0x07, 0xB0, 0xE0, 0x07, 0x60,
+0xB0, 0x07, 0xE0, 0x07, 0x60, 0xB0, 0x07, 0xE0, 0x08, 0x40, 0x09, 0x60, 0x09, 0xE0, 0x0A, 0x40,
+0x90, 0x06, 0x80, 0x30, 0x40, 0xE0, 0x40, 0x30, 0x80, 0x02, 0x30, 0x07, 0x60, 0xE0, 0x0A, 0x30,
+0x80, 0xD1, 0xF0, 0x50, 0xA0, 0xF0, 0x20, 0xD0, 0x70, 0x60, 0x01, 0x90, 0xE0, 0x90, 0x08, 0x40,
+0xB0, 0x03, 0x40, 0x30, 0xD0, 0x22, 0xF0, 0x21, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50,
+0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0x30, 0xE0, 0x02, 0xC0, 0x03, 0xB0, 0x40, 0x30,
+0xE0, 0x0F, 0x10, 0x0F, 0x13, 0xB0, 0x10, 0x60, 0x02, 0x70, 0x80, 0x30, 0x90, 0x00, 0xB0, 0x70,
+0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0x70, 0x90, 0x31, 0x51, 0xD1, 0x40, 0x10, 0xC1, 0xA0,
+0xD1, 0x30, 0xD3, 0x30, 0xC0, 0x80, 0x70, 0x51, 0xD0, 0xF1, 0xA0, 0x50, 0xF0, 0xD2, 0xF0, 0x24,
+0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xD0, 0x50, 0xA0, 0xD0, 0xF2, 0x21, 0xF1, 0x22, 0xF0,
+0xD0, 0x50, 0xF0, 0xA0, 0xD1, 0x30, 0xA0, 0xC1, 0x12, 0x80, 0xA1, 0x80, 0x92, 0x30, 0x50, 0xA0,
+0xD1, 0x90, 0x00, 0x30, 0xC0, 0x60, 0xB0, 0x00, 0x40, 0x07, 0x60, 0xB0, 0x06, 0x40, 0xC0, 0x61,
+0x08, 0x40, 0x08, 0x40, 0x07, 0x60, 0xB0, 0x07, 0xE0, 0x07, 0xE0, 0xB0, 0x07, 0x40, 0x07, 0x80,
+0x40, 0x90, 0x70, 0xE0, 0x05, 0xE0, 0x70, 0xB0, 0xE0, 0x80, 0x02, 0x40, 0x01, 0x61, 0x09, 0x61,
+0x70, 0x30, 0x06, 0x90, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x90, 0x01, 0x80, 0xB0, 0x05, 0xB0, 0xE0,
+0x0A, 0xB0, 0x90, 0xA1, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF0, 0xD0, 0x70, 0x03, 0x80, 0x10, 0x60,
+0x05, 0xB0, 0x40, 0x06, 0x90, 0xA0, 0xD0, 0x23, 0xF4, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0,
+0xF2, 0x26, 0xF0, 0xD0, 0x70, 0x00, 0xB0, 0x90, 0x30, 0x40, 0x01, 0x80, 0x10, 0x80, 0x60, 0x70,
+0x60, 0x0F, 0x0F, 0x0F, 0x11, 0xB0, 0x91, 0x40, 0xC0, 0x70, 0xE0, 0x40, 0x70, 0x80, 0x00, 0xB0,
+0x90, 0x70, 0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0xD0, 0x30, 0xC0, 0x80, 0x70, 0x30, 0xD0, 0xA0, 0x50,
+0xD0, 0xC1, 0x10, 0x90, 0xD0, 0xF0, 0xD0, 0xA0, 0xD0, 0xF0, 0x20, 0xD1, 0x50, 0xD2, 0xF0, 0x50,
+0xF3, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x21, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0xF5, 0x21, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF1, 0xC0, 0x10, 0xC0, 0x00, 0x40, 0xE0, 0xC0, 0x50,
+0xD1, 0xF0, 0x50, 0xD2, 0xF1, 0x20, 0xD0, 0x70, 0x00, 0xB0, 0x80, 0x00, 0x40, 0x0A, 0x40, 0x06,
+0xB0, 0x90, 0x00, 0x40, 0x08, 0x40, 0x08, 0x40, 0x07, 0xB0, 0x60, 0x07, 0x40, 0x07, 0xE0, 0x08,
+0xE0, 0x07, 0x10, 0xE0, 0x81, 0x40, 0x01, 0x80, 0x10, 0x40, 0x00, 0x30, 0x10, 0x82, 0x60, 0x70,
+0x30, 0x12, 0x90, 0x10, 0x09, 0xE0, 0x70, 0x40, 0x80, 0x70, 0xB0, 0x05, 0x90, 0x40, 0x02, 0xB0,
+0x70, 0xE0, 0x90, 0x70, 0x05, 0x40, 0x09, 0xB0, 0x00, 0x40, 0x90, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0x20, 0xF0, 0x50, 0x30, 0x90, 0x0B, 0x60, 0x40, 0x08, 0xC0, 0xD0, 0x21, 0xF1, 0x20, 0xF3, 0x21,
+0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF3, 0x25, 0xD0, 0x50, 0xC0, 0x30, 0x01, 0x90, 0x00,
+0x80, 0xC0, 0xE0, 0x90, 0x60, 0xE0, 0x30, 0x0F, 0x0F, 0x0F, 0x11, 0x70, 0x61, 0x71, 0x40, 0x30,
+0x80, 0x90, 0x02, 0xE0, 0x30, 0xD0, 0xF1, 0x23, 0xF0, 0xD0, 0xA0, 0x70, 0x31, 0x70, 0xD0, 0xF0,
+0xD1, 0x30, 0xC0, 0x10, 0x80, 0xF1, 0xD0, 0xC0, 0x90, 0xD0, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xC1,
+0xD0, 0x22, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF2, 0x24, 0xF1, 0x52, 0xD0, 0xF0, 0x21, 0xF4,
+0x20, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF0, 0xD0, 0x80, 0x70, 0x40, 0xE0, 0x70, 0x10, 0x90, 0xD0,
+0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0x22, 0xD0, 0x80, 0x70, 0xE0, 0x70, 0x00, 0x40, 0xE0, 0x09,
+0x60, 0xB0, 0x04, 0xB0, 0x90, 0x01, 0xE0, 0xB0, 0x07, 0x61, 0x07, 0xE0, 0x07, 0xB0, 0x60, 0x07,
+0xE0, 0x07, 0xE0, 0x07, 0xB0, 0x60, 0x05, 0x60, 0x10, 0x90, 0xE0, 0x06, 0x70, 0x10, 0x70, 0xC0,
+0x03, 0x40, 0x90, 0x01, 0xB0, 0xE0, 0x10, 0xC0, 0x11, 0x60, 0x04, 0x40, 0x00, 0x90, 0xD1, 0xF0,
+0x70, 0x05, 0x60, 0x90, 0x04, 0x70, 0x40, 0xB0, 0x90, 0x03, 0x40, 0x08, 0x90, 0xC0, 0x30, 0x70,
+0x30, 0xD1, 0x52, 0xD0, 0x20, 0xD0, 0xA0, 0xC1, 0x0A, 0xE1, 0x09, 0x60, 0x70, 0xD0, 0xF0, 0x20,
+0xF3, 0x20, 0xF1, 0xD0, 0x51, 0xF1, 0x20, 0xF2, 0x20, 0xF2, 0x25, 0xF0, 0xD0, 0x90, 0xB0, 0x01,
+0xB0, 0x90, 0x70, 0x01, 0xE0, 0x30, 0x80, 0x60, 0x0F, 0x0F, 0x0F, 0x11, 0x70, 0x02, 0x40, 0x70,
+0x00, 0xE0, 0x31, 0x60, 0x00, 0x70, 0xF3, 0x21, 0xF2, 0xD0, 0x71, 0x40, 0xC0, 0x80, 0xD0, 0x20,
+0xF0, 0xD0, 0x90, 0x30, 0x50, 0xD1, 0xF1, 0x10, 0xD1, 0xF1, 0x23, 0xF0, 0xA1, 0xD0, 0xF0, 0x23,
+0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0x23, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xA0, 0x50, 0xF1,
+0x20, 0xF4, 0x20, 0xF0, 0x23, 0xD0, 0xA1, 0xF1, 0xD1, 0x70, 0x11, 0xE0, 0x30, 0xD0, 0x21, 0xD0,
+0x50, 0xF0, 0x23, 0xF0, 0xD0, 0x80, 0x10, 0x30, 0x01, 0x40, 0x07, 0xB0, 0x60, 0xB0, 0x40, 0x03,
+0x30, 0x90, 0xB0, 0x01, 0xB0, 0x60, 0x08, 0xE0, 0x07, 0xE0, 0xB0, 0x06, 0xB0, 0xE0, 0x07, 0x40,
+0x07, 0xE0, 0x07, 0x60, 0xB0, 0x06, 0xB0, 0xE0, 0x08, 0x40, 0xB0, 0x08, 0x40, 0x00, 0xB0, 0x01,
+0x40, 0x60, 0x03, 0xB0, 0xE0, 0x00, 0x90, 0xF1, 0xD0, 0x50, 0x30, 0x03, 0xB0, 0x60, 0x80, 0x40,
+0x04, 0x81, 0x60, 0x30, 0x60, 0x90, 0x40, 0xB0, 0x07, 0x40, 0x30, 0xD3, 0xF0, 0x50, 0xA0, 0xD0,
+0xA1, 0x50, 0x31, 0x70, 0x90, 0x09, 0xE0, 0x60, 0x0B, 0x40, 0x30, 0xD0, 0x20, 0xF1, 0x21, 0xF2,
+0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x29, 0xF0, 0xA0, 0x90, 0x00, 0x60, 0x31, 0xC0,
+0x61, 0x70, 0x40, 0x00, 0xB1, 0x0F, 0x0E, 0x0F, 0x11, 0x30, 0x90, 0x02, 0x80, 0x40, 0x90, 0x00,
+0xB0, 0x80, 0xC0, 0x50, 0xD0, 0x21, 0xF0, 0x21, 0xF2, 0xD0, 0xC0, 0x50, 0x40, 0x10, 0xD0, 0x20,
+0xF1, 0xD0, 0x80, 0xF1, 0x50, 0xA0, 0xD0, 0x50, 0xC0, 0xD0, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0x20,
+0xF0, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0x22, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x50,
+0xA0, 0xD0, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF0, 0x23, 0xF2, 0x23, 0xD0, 0x50, 0xA0, 0xF0, 0xD0,
+0x80, 0x70, 0x90, 0x10, 0x00, 0x70, 0xF0, 0xD0, 0xF2, 0x50, 0xD0, 0xF3, 0xD0, 0x50, 0x10, 0x40,
+0x60, 0xB0, 0x00, 0xE0, 0x05, 0x60, 0x90, 0x32, 0x90, 0x71, 0x90, 0xE0, 0x04, 0x40, 0x08, 0x40,
+0x07, 0x61, 0x07, 0xE0, 0x07, 0x40, 0x07, 0xE0, 0x07, 0xE0, 0xB0, 0x07, 0xE0, 0x08, 0x40, 0x08,
+0xB0, 0x60, 0x09, 0x40, 0x01, 0x30, 0xD0, 0xF1, 0xD0, 0x30, 0x40, 0x02, 0x40, 0x01, 0x90, 0x60,
+0x04, 0x40, 0x30, 0x40, 0x70, 0xE0, 0x30, 0xE0, 0x07, 0x90, 0x80, 0xD0, 0xF2, 0x50, 0xF1, 0x20,
+0xD0, 0x80, 0x70, 0xE0, 0x60, 0xB0, 0x09, 0x40, 0xB0, 0x0D, 0x30, 0x50, 0xD0, 0xF0, 0x22, 0xF0,
+0xA0, 0x50, 0xF0, 0xD1, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x29, 0xF0, 0xD0, 0x80, 0x70, 0x80, 0x01,
+0x70, 0x90, 0x70, 0x40, 0xB0, 0x90, 0xC0, 0x70, 0x40, 0x0F, 0x0D, 0x0F, 0x12, 0x80, 0x10, 0x80,
+0x60, 0x90, 0x70, 0x40, 0x02, 0x70, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0xD0, 0x71, 0xD0, 0xF1,
+0xD0, 0x50, 0x70, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xC0, 0x50, 0xD1, 0xF0, 0xD0, 0xF2, 0x20, 0xF1,
+0x23, 0xF4, 0xD0, 0xA0, 0x50, 0xF3, 0x21, 0xF4, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50,
+0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0,
+0xA0, 0x91, 0x10, 0x00, 0x90, 0xC0, 0xF3, 0xA0, 0x50, 0xD0, 0xF2, 0xD0, 0x30, 0x10, 0xB0, 0x40,
+0x70, 0xB0, 0xE0, 0xB0, 0x02, 0xB0, 0x90, 0x70, 0x03, 0xE0, 0x08, 0x60, 0xB0, 0x07, 0x40, 0x07,
+0xB0, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x80, 0xE0, 0x06, 0xE0, 0x07, 0xB0, 0xE0, 0x07, 0x61,
+0x08, 0x40, 0x08, 0x80, 0xB0, 0x60, 0x01, 0x90, 0xD0, 0x21, 0xF0, 0xD0, 0x70, 0x01, 0x40, 0xB0,
+0x02, 0xC0, 0x80, 0x01, 0x90, 0x80, 0x00, 0x60, 0x40, 0x61, 0x00, 0x30, 0x80, 0x04, 0x40, 0x10,
+0x80, 0xD0, 0xF1, 0xD0, 0x50, 0xD0, 0xA0, 0xD2, 0x70, 0xE0, 0x80, 0x0A, 0x40, 0xB0, 0x09, 0x80,
+0x04, 0x70, 0xD1, 0xF0, 0x21, 0x51, 0xD1, 0xF3, 0x20, 0xF0, 0x2D, 0xF1, 0x70, 0x02, 0x30, 0x40,
+0x00, 0x40, 0x10, 0xE0, 0x01, 0x70, 0x0F, 0x0D, 0x0F, 0x0E, 0xB0, 0xC1, 0x30, 0x01, 0x80, 0x90,
+0x40, 0x11, 0x70, 0x60, 0x90, 0xF0, 0xD0, 0x21, 0xF1, 0x25, 0xF0, 0xD0, 0xC0, 0x50, 0xD0, 0x20,
+0xD1, 0x50, 0xD1, 0xF0, 0xD1, 0x50, 0x70, 0xD1, 0xF0, 0xD1, 0xA0, 0xD0, 0x21, 0xF0, 0x20, 0xF0,
+0x21, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xA0, 0xF2, 0x21, 0xF1, 0xD0, 0xA1, 0xF5, 0xD0,
+0xA0, 0x50, 0xF2, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0x50, 0xF0, 0x30, 0x80, 0x70, 0x40,
+0x80, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0xD0, 0x90, 0x30, 0x01, 0x11,
+0xB0, 0x00, 0x40, 0xE0, 0xC0, 0x91, 0xB0, 0x04, 0x40, 0x08, 0xB0, 0xE0, 0x07, 0x61, 0x07, 0x40,
+0x07, 0x40, 0x07, 0x40, 0x02, 0x40, 0x80, 0x01, 0x91, 0x11, 0x60, 0x04, 0x40, 0x07, 0xE0, 0xB0,
+0x07, 0x40, 0x08, 0xB0, 0xE0, 0x08, 0x10, 0x90, 0x10, 0xC0, 0x80, 0xC0, 0xD0, 0xF2, 0xD0, 0x70,
+0x00, 0x61, 0x03, 0x30, 0x10, 0xC0, 0x30, 0x10, 0x70, 0xC0, 0x40, 0x90, 0xE0, 0x60, 0x01, 0xE0,
+0x30, 0x02, 0x30, 0x90, 0xD1, 0xF0, 0xD1, 0x50, 0x71, 0x93, 0x30, 0x00, 0x40, 0x80, 0x07, 0x60,
+0x40, 0x0B, 0x31, 0x04, 0xC0, 0xD1, 0xA0, 0x50, 0xF0, 0xD0, 0xF4, 0x20, 0xF0, 0x29, 0xF2, 0x22,
+0xD0, 0xA0, 0x30, 0x60, 0xC0, 0x11, 0xE0, 0x90, 0x02, 0x60, 0x70, 0x0F, 0x0D, 0x0F, 0x0E, 0x80,
+0x40, 0x00, 0xC2, 0x60, 0x00, 0x30, 0xB0, 0x80, 0x11, 0x80, 0xD0, 0xF1, 0x20, 0xF1, 0x23, 0xF3,
+0x10, 0x90, 0xD0, 0xF0, 0x20, 0x90, 0xD0, 0xF3, 0x50, 0x10, 0x30, 0xA1, 0xF0, 0x90, 0x70, 0xC0,
+0x30, 0xD0, 0x20, 0xF3, 0x23, 0xF0, 0x22, 0xF1, 0xD0, 0x50, 0xA0, 0xF1, 0x21, 0xF1, 0xA0, 0x50,
+0xF3, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF5, 0x51, 0x11, 0x60, 0x90,
+0xD0, 0x21, 0xF0, 0x20, 0xF2, 0x50, 0xF1, 0xD0, 0x70, 0x02, 0x70, 0x30, 0x01, 0x60, 0x90, 0x08,
+0xB0, 0xE0, 0x08, 0x40, 0x08, 0x40, 0x07, 0x40, 0x07, 0x40, 0x00, 0xB1, 0x60, 0x90, 0x80, 0xB0,
+0x60, 0x40, 0x61, 0xB0, 0x60, 0x10, 0xB0, 0x30, 0x90, 0x80, 0xB0, 0xE0, 0xB0, 0x04, 0x40, 0x07,
+0x40, 0x08, 0xE0, 0x01, 0x61, 0x04, 0x40, 0x09, 0x60, 0x70, 0x90, 0xE0, 0xC1, 0xD0, 0xF1, 0x20,
+0xD0, 0xC0, 0x60, 0xE0, 0x05, 0x70, 0x41, 0xE0, 0x40, 0x90, 0x70, 0x30, 0x60, 0x70, 0x40, 0x01,
+0x90, 0x01, 0x90, 0x30, 0xD1, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0x70, 0x80, 0x06, 0x80, 0x40, 0x05,
+0x60, 0xE0, 0x0C, 0xB0, 0xC0, 0x80, 0x03, 0x60, 0x30, 0xA0, 0x50, 0xF3, 0x20, 0xF0, 0x24, 0xF0,
+0x25, 0xF1, 0xD2, 0xF0, 0x20, 0xF0, 0xD1, 0x90, 0x11, 0x40, 0xB0, 0x10, 0xE0, 0x01, 0x40, 0xC0,
+0x61, 0xE0, 0x0F, 0x0B, 0x0F, 0x0E, 0x81, 0x00, 0x90, 0xB0, 0x60, 0x70, 0xE0, 0x40, 0x01, 0x60,
+0x70, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF1, 0xA0, 0xD1, 0x50, 0x10, 0x30, 0xD0, 0x20, 0xF4, 0xD0,
+0xF0, 0x50, 0x80, 0xA1, 0x70, 0x30, 0x10, 0x70, 0xC1, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x24, 0xF1,
+0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xD0, 0x23, 0xF0, 0x21, 0xF1, 0xD0, 0xA0,
+0x50, 0xF2, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xA0, 0x30, 0x91, 0x80, 0x30, 0xD0, 0x25,
+0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0x90, 0x03, 0x90, 0x40, 0x00, 0xB0, 0x80, 0x09, 0x40, 0x08, 0x60,
+0xB0, 0x07, 0x40, 0x07, 0xE0, 0xB0, 0x00, 0xB0, 0x60, 0xE0, 0x41, 0xE0, 0x40, 0xE1, 0x62, 0xE0,
+0x60, 0xB0, 0x40, 0xB0, 0x61, 0xB0, 0x10, 0x30, 0x70, 0x30, 0xE1, 0x40, 0xE1, 0x60, 0xB0, 0x00,
+0xB0, 0x60, 0x06, 0xB0, 0xE0, 0x07, 0x60, 0xB0, 0x00, 0x90, 0x10, 0x60, 0x03, 0xB0, 0xE0, 0x09,
+0x40, 0x00, 0x30, 0x80, 0xE0, 0x10, 0x80, 0xD0, 0x20, 0xF0, 0xD0, 0x70, 0x40, 0x06, 0x81, 0x40,
+0x30, 0x61, 0x51, 0x31, 0xE0, 0x01, 0x70, 0xC1, 0x70, 0xD1, 0xF0, 0xD0, 0xA0, 0x80, 0x70, 0xC0,
+0xE0, 0x80, 0xB0, 0x06, 0x80, 0x70, 0xE0, 0x02, 0xE0, 0x60, 0x0D, 0x60, 0x30, 0x41, 0x03, 0x30,
+0x80, 0xD0, 0xF0, 0x27, 0xF2, 0x25, 0xF0, 0xA0, 0xC0, 0x90, 0x50, 0xD2, 0xF0, 0x50, 0xA0, 0xC0,
+0x02, 0x30, 0xC0, 0x30, 0xC0, 0x90, 0xB1, 0x81, 0x60, 0x0F, 0x0A, 0x0F, 0x0F, 0xE0, 0x03, 0x90,
+0x70, 0x90, 0xE0, 0x00, 0x80, 0x50, 0xD0, 0xA0, 0x50, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x50,
+0xC0, 0xD1, 0x80, 0xC0, 0xD0, 0xF0, 0x20, 0xF3, 0xD0, 0x70, 0x80, 0xD2, 0x11, 0x70, 0x40, 0x90,
+0x30, 0x90, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x20, 0xD0, 0x51, 0xD0, 0xF1, 0x50,
+0xD0, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0xA0, 0x50, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0x20, 0xD0, 0x50, 0x70, 0x00, 0x90, 0x10, 0x30, 0xD0, 0xF2, 0x23, 0xF0, 0xA1, 0xD0, 0xC0, 0x60,
+0x03, 0x40, 0x70, 0xE0, 0x30, 0x60, 0x08, 0xB0, 0x60, 0x08, 0x40, 0x07, 0xE0, 0xB0, 0x03, 0xB0,
+0xE0, 0x42, 0xE0, 0x60, 0xB0, 0x08, 0xC0, 0x11, 0x60, 0xE0, 0x03, 0xE0, 0x90, 0xC0, 0x70, 0x00,
+0xE0, 0x10, 0x60, 0x00, 0xB0, 0x60, 0xE0, 0x42, 0x60, 0xB0, 0x03, 0x61, 0x07, 0x40, 0x02, 0xE0,
+0x04, 0x40, 0x09, 0x40, 0x02, 0x90, 0x70, 0xC1, 0x80, 0xD0, 0xF1, 0x50, 0x80, 0x07, 0x80, 0x70,
+0x10, 0x70, 0x50, 0xF0, 0xD2, 0x90, 0x80, 0x01, 0xB0, 0x80, 0xC0, 0x50, 0xD1, 0x31, 0xE0, 0x02,
+0x60, 0x80, 0x07, 0x40, 0x80, 0x90, 0x00, 0x40, 0xB0, 0x01, 0x40, 0x0C, 0x90, 0x00, 0x90, 0x40,
+0x00, 0x60, 0x40, 0x00, 0x30, 0x50, 0xD0, 0xF0, 0x26, 0xF4, 0x23, 0xF0, 0xD0, 0x10, 0x30, 0x80,
+0x70, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0x30, 0xE0, 0x00, 0x40, 0x91, 0x60, 0xB0, 0x01, 0xB0, 0x91,
+0xB0, 0x0F, 0x0A, 0x0F, 0x12, 0x30, 0x71, 0xE0, 0x00, 0x80, 0x30, 0x70, 0xD0, 0xF0, 0xD1, 0xA0,
+0x50, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xD0, 0xC1, 0xD0, 0xF0, 0x20, 0xF2, 0xD0, 0x80,
+0x70, 0x50, 0xD0, 0x80, 0x90, 0x10, 0xC0, 0x10, 0x90, 0x30, 0xA0, 0xD0, 0xF6, 0x23, 0xF1, 0x23,
+0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0x50, 0xF3, 0x22, 0xF2, 0x20, 0xF3, 0xA0, 0x50, 0xF1, 0x20, 0xF2,
+0x25, 0xD0, 0x70, 0x10, 0x60, 0x00, 0x30, 0x10, 0xA0, 0xD0, 0x24, 0xF1, 0x50, 0xD0, 0xF0, 0x70,
+0x04, 0xE0, 0x90, 0xB0, 0xE0, 0x09, 0x40, 0x08, 0x40, 0x07, 0xB0, 0x60, 0xB0, 0xE0, 0x41, 0xE0,
+0xB0, 0x00, 0xB0, 0x60, 0x0D, 0x60, 0xB0, 0x60, 0x10, 0x30, 0x03, 0xC0, 0x80, 0x00, 0xE0, 0x70,
+0xC0, 0x03, 0xE0, 0x01, 0xB0, 0xE0, 0x41, 0xE0, 0xB0, 0xE0, 0x07, 0xB0, 0xE0, 0x07, 0xB0, 0xE0,
+0x08, 0xB0, 0xE0, 0x80, 0x11, 0x60, 0xE0, 0x10, 0x00, 0x80, 0x70, 0xD0, 0xF0, 0xA0, 0x70, 0x03,
+0x40, 0x10, 0x02, 0x40, 0x80, 0x91, 0xD1, 0xF0, 0xD1, 0x10, 0x03, 0xE0, 0x10, 0xC0, 0x90, 0x80,
+0x05, 0x90, 0x08, 0xE0, 0x60, 0x90, 0x80, 0x40, 0x01, 0x11, 0x0B, 0xE0, 0x80, 0x00, 0x80, 0x90,
+0x40, 0x02, 0x70, 0xD1, 0x29, 0xF7, 0xD0, 0x90, 0x00, 0x60, 0x70, 0x50, 0xD0, 0xF0, 0xD1, 0x70,
+0x30, 0x40, 0x00, 0x80, 0x60, 0x0F, 0x11, 0x0F, 0x12, 0x61, 0x30, 0x02, 0x90, 0xA0, 0xF5, 0x51,
+0xF3, 0x20, 0xF0, 0xD0, 0x70, 0x50, 0xD0, 0xF4, 0xA0, 0x30, 0x90, 0xD0, 0x50, 0x10, 0xC0, 0x70,
+0x91, 0x50, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF2, 0x25, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0x80, 0xA0,
+0xD0, 0xF2, 0x22, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF5, 0x24, 0xD0, 0x90, 0x80,
+0x60, 0xB0, 0x30, 0xC0, 0xA0, 0xF0, 0x24, 0xF2, 0x50, 0xD0, 0x81, 0x07, 0x40, 0x08, 0x60, 0xE0,
+0x07, 0x61, 0x04, 0xB0, 0x60, 0x41, 0x60, 0x05, 0xB0, 0xE0, 0x0F, 0x00, 0x60, 0x10, 0xE0, 0x00,
+0x10, 0x60, 0x40, 0xC0, 0x60, 0x01, 0xC0, 0x40, 0x70, 0x00, 0x40, 0x10, 0x80, 0x06, 0x60, 0x41,
+0x60, 0xB0, 0x04, 0xE0, 0xB0, 0x03, 0x60, 0xB0, 0x01, 0x40, 0x09, 0x40, 0x00, 0x40, 0x70, 0xB0,
+0xC0, 0x70, 0xC0, 0x91, 0x30, 0xD0, 0x50, 0xD0, 0x50, 0x90, 0x03, 0xB0, 0x03, 0x30, 0x80, 0x10,
+0x50, 0xF1, 0x20, 0xD0, 0x30, 0x90, 0xB0, 0xE0, 0x70, 0x10, 0x80, 0xB0, 0xE0, 0x06, 0x80, 0x60,
+0x07, 0x60, 0x80, 0x00, 0x80, 0x40, 0x90, 0x60, 0xB0, 0x80, 0x0C, 0x30, 0x60, 0xE0, 0xB0, 0x80,
+0x30, 0xB0, 0x00, 0xB0, 0x70, 0xD0, 0xF0, 0x28, 0xF2, 0xD1, 0xF0, 0xD0, 0xF0, 0xD0, 0x31, 0x60,
+0x00, 0x90, 0x50, 0xD0, 0xF0, 0xD0, 0x81, 0x02, 0x90, 0x0F, 0x11, 0x0F, 0x13, 0x40, 0xC0, 0xE0,
+0x01, 0x70, 0xD0, 0xF0, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0xD2, 0xA0, 0x10, 0xA0, 0xD0,
+0xF1, 0x20, 0xF0, 0xD0, 0x80, 0x90, 0x30, 0xD0, 0x90, 0x70, 0xC0, 0xD0, 0xC0, 0xD2, 0xF1, 0x51,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0,
+0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xD0, 0xA0, 0x50, 0xD0, 0xF5, 0x21, 0xF0,
+0xD0, 0x70, 0x01, 0xE0, 0x30, 0x80, 0x30, 0xD0, 0x25, 0xF1, 0xA1, 0xD0, 0x70, 0x07, 0xE0, 0xB0,
+0x08, 0x40, 0x07, 0x60, 0x40, 0x01, 0xB0, 0xE0, 0x40, 0x60, 0xB0, 0x09, 0xE0, 0x0F, 0x00, 0x60,
+0x10, 0x90, 0xB0, 0x70, 0x10, 0x40, 0x10, 0xB0, 0x00, 0x81, 0xD0, 0x50, 0x90, 0xC0, 0x30, 0x91,
+0x80, 0xE0, 0x06, 0xB0, 0xE0, 0x40, 0xE0, 0xB0, 0x01, 0x40, 0x01, 0xE0, 0x90, 0xB0, 0x10, 0x30,
+0x01, 0x40, 0x08, 0x61, 0x00, 0x40, 0xC0, 0x01, 0x40, 0xC0, 0x10, 0xC0, 0xD0, 0xA1, 0xF0, 0xD0,
+0x50, 0x90, 0x04, 0xB0, 0xE0, 0xB0, 0x80, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x11, 0xC0,
+0x70, 0xE0, 0x00, 0xE0, 0xB0, 0x04, 0xB0, 0x01, 0x90, 0x06, 0x60, 0xE0, 0x62, 0x01, 0x30, 0x80,
+0x0D, 0xE0, 0x90, 0x02, 0x60, 0x90, 0x40, 0x00, 0x40, 0x30, 0xD0, 0xF0, 0x25, 0xF1, 0x21, 0xF1,
+0x70, 0xD0, 0xF1, 0xA1, 0x81, 0x01, 0x30, 0x70, 0xD2, 0x70, 0x01, 0x40, 0xC0, 0xE0, 0x0F, 0x10,
+0x0F, 0x12, 0xB0, 0x90, 0x00, 0x80, 0x90, 0x70, 0xF1, 0x23, 0xF2, 0xD0, 0xF0, 0xA0, 0x90, 0x80,
+0x70, 0x50, 0x40, 0x10, 0xA0, 0xF2, 0x20, 0xF0, 0xD0, 0x71, 0xD1, 0x30, 0xA1, 0xD0, 0xF1, 0x21,
+0xF1, 0xD0, 0xA0, 0x50, 0x20, 0xF3, 0x20, 0xF0, 0x23, 0xF5, 0xA0, 0x50, 0xD1, 0x50, 0xA0, 0xD0,
+0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF1, 0x21, 0xF0,
+0xD0, 0x50, 0x10, 0x02, 0x80, 0xC0, 0x80, 0xD6, 0xF0, 0x20, 0xD0, 0x50, 0xF0, 0xA0, 0xC0, 0x07,
+0x30, 0xB0, 0x02, 0xB0, 0x70, 0xB0, 0x01, 0x61, 0x07, 0xE0, 0x41, 0xE0, 0x0D, 0x40, 0x0F, 0x00,
+0xE0, 0x00, 0xC1, 0x11, 0x70, 0x30, 0x00, 0x80, 0x70, 0xA0, 0xD1, 0xF0, 0x10, 0x80, 0xA0, 0xE0,
+0xC0, 0x10, 0xE0, 0x08, 0xB0, 0xE0, 0x41, 0x60, 0x00, 0xE0, 0x70, 0xE0, 0x80, 0x10, 0xE0, 0x00,
+0xE0, 0xB0, 0x08, 0x40, 0x01, 0x40, 0xC0, 0x01, 0xB0, 0x11, 0x60, 0xA0, 0x50, 0xD0, 0xF0, 0x20,
+0xD0, 0xA0, 0xC0, 0x03, 0x80, 0x10, 0x40, 0x30, 0xD1, 0xF0, 0x22, 0xD0, 0x50, 0x90, 0x03, 0x40,
+0xB0, 0x05, 0x11, 0xB0, 0x90, 0x05, 0xE1, 0x01, 0xE0, 0xB0, 0x02, 0x30, 0x60, 0x08, 0xC0, 0x60,
+0xB0, 0x40, 0x00, 0x80, 0x60, 0x03, 0x40, 0x70, 0x00, 0x80, 0x30, 0xD0, 0x20, 0xF0, 0x27, 0xF0,
+0xD0, 0xC0, 0xD0, 0xA0, 0x50, 0xA0, 0xD1, 0x30, 0x40, 0x01, 0x60, 0x70, 0xD1, 0x50, 0x91, 0x40,
+0x00, 0x70, 0x0F, 0x10, 0x0F, 0x12, 0x80, 0x60, 0x01, 0x60, 0x90, 0xD0, 0x23, 0xF3, 0x21, 0xD0,
+0x10, 0x70, 0x81, 0x30, 0xC0, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0xC0, 0x50, 0xD2, 0x50, 0xC0,
+0xD0, 0x25, 0xF1, 0x51, 0xD0, 0xF3, 0x24, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0x20, 0xF0, 0xD0, 0xA0,
+0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xF3,
+0x20, 0xF2, 0x70, 0x10, 0xB0, 0x02, 0x80, 0x70, 0x80, 0x90, 0x80, 0xD0, 0xA0, 0x70, 0xA0, 0xD0,
+0xF2, 0x50, 0xD1, 0xC0, 0xB0, 0x05, 0x61, 0x00, 0x80, 0x11, 0x90, 0x40, 0x02, 0x40, 0x05, 0xE0,
+0x41, 0x60, 0x0F, 0x00, 0x60, 0xB0, 0x0D, 0xC0, 0x80, 0x60, 0xC0, 0x90, 0xA0, 0x10, 0x31, 0x80,
+0x30, 0xD1, 0xF0, 0x20, 0xD0, 0x50, 0x70, 0xA0, 0xD1, 0x80, 0x71, 0x10, 0xC0, 0x10, 0xE0, 0x60,
+0x40, 0x04, 0xE0, 0x41, 0x90, 0x00, 0x30, 0x03, 0x40, 0x08, 0xE0, 0xB0, 0x01, 0x40, 0x90, 0x03,
+0x70, 0x30, 0x40, 0xD1, 0x22, 0xD0, 0x80, 0x40, 0x02, 0x60, 0x40, 0x00, 0x30, 0x90, 0xD0, 0xF0,
+0x21, 0xF0, 0xD1, 0x10, 0xB0, 0x01, 0x40, 0xB0, 0x07, 0xB0, 0x10, 0x90, 0xB0, 0x03, 0x40, 0xB0,
+0x03, 0x40, 0xB0, 0x02, 0x90, 0xE0, 0x07, 0xB0, 0x10, 0xE0, 0x01, 0x60, 0x80, 0x05, 0x90, 0x30,
+0x70, 0xA0, 0xD0, 0xF3, 0x24, 0xD1, 0xF0, 0x50, 0xA0, 0xD0, 0xF2, 0xD0, 0x70, 0x02, 0x40, 0x80,
+0xD1, 0x70, 0x02, 0xE0, 0x40, 0x0F, 0x0F, 0x0F, 0x11, 0xB0, 0x70, 0xE0, 0x01, 0x90, 0xF0, 0xD0,
+0x24, 0xF1, 0x22, 0xD0, 0x30, 0xE0, 0xB0, 0x31, 0x50, 0xD0, 0x23, 0xD1, 0x70, 0x10, 0x50, 0xD0,
+0x20, 0xF0, 0xA1, 0xF1, 0x25, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x24, 0xF1, 0xD0, 0xF0, 0x50,
+0xD0, 0x22, 0xF1, 0xA0, 0x50, 0xF3, 0x23, 0xF0, 0x20, 0xF2, 0x21, 0xD0, 0xA0, 0x50, 0xF2, 0xD0,
+0x30, 0x20, 0xD0, 0x80, 0x10, 0x70, 0x60, 0x02, 0xE2, 0x90, 0x12, 0xC0, 0xA0, 0xD2, 0xA0, 0x50,
+0xD0, 0xA0, 0x70, 0xB0, 0x05, 0xE0, 0x60, 0x10, 0xC0, 0x10, 0x50, 0x30, 0x02, 0x60, 0xB0, 0x01,
+0xB0, 0xE1, 0xB0, 0x01, 0x40, 0x0F, 0x00, 0x61, 0x03, 0x40, 0xB0, 0x06, 0x60, 0x10, 0x30, 0x80,
+0x50, 0xD0, 0x80, 0x30, 0xF0, 0x10, 0x70, 0xD0, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x90, 0x10, 0xA0,
+0xD1, 0x10, 0x70, 0xE0, 0x70, 0x90, 0xC0, 0x90, 0xC0, 0x01, 0x30, 0x40, 0x00, 0xE0, 0x00, 0xE0,
+0xB0, 0x30, 0x40, 0x02, 0x61, 0x07, 0xB0, 0xE0, 0x01, 0x80, 0xB0, 0x05, 0x30, 0x10, 0xC0, 0x50,
+0xD1, 0xF0, 0xD1, 0x10, 0x70, 0x01, 0x40, 0x02, 0x80, 0x50, 0xD0, 0x21, 0xF1, 0xD0, 0x80, 0x30,
+0x00, 0xE0, 0x90, 0x09, 0x40, 0x10, 0x80, 0x01, 0xB0, 0x40, 0xB0, 0x05, 0x40, 0x03, 0x30, 0xE0,
+0x05, 0xB0, 0x40, 0xB0, 0x02, 0xB0, 0x30, 0x07, 0xB0, 0x70, 0xD0, 0xF3, 0x22, 0xF0, 0xD0, 0xF0,
+0x50, 0xA0, 0xF2, 0x22, 0xD0, 0xC0, 0xE0, 0x01, 0xE0, 0x10, 0xA0, 0xD0, 0xA0, 0x30, 0x01, 0x40,
+0x70, 0x0F, 0x0F, 0x0F, 0x11, 0x80, 0xE0, 0x40, 0x90, 0x80, 0x30, 0xD0, 0xF0, 0x24, 0xF1, 0x21,
+0xF0, 0xD0, 0x80, 0x60, 0x00, 0x70, 0x90, 0x80, 0xA0, 0xD1, 0x20, 0xF0, 0xD0, 0x80, 0x10, 0x70,
+0xF2, 0xD0, 0xA0, 0xD0, 0xF2, 0x24, 0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF1, 0x21,
+0xF0, 0xD0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x23,
+0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xF2, 0xD0, 0xF1, 0xD0, 0x31, 0x90, 0x70, 0xC0, 0x40,
+0xB1, 0x00, 0x11, 0x70, 0x30, 0xC0, 0x30, 0xD0, 0x80, 0x30, 0xD0, 0xA0, 0xF0, 0xD0, 0xA0, 0x70,
+0x90, 0x30, 0x40, 0x00, 0x40, 0x60, 0xB0, 0x40, 0x10, 0xD0, 0xA0, 0xD0, 0x70, 0x60, 0x02, 0x40,
+0xB0, 0x40, 0xE0, 0xB0, 0x03, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0x02, 0x60, 0x10, 0xB0, 0x00, 0x70,
+0xE0, 0x04, 0xC0, 0x80, 0xD1, 0xF0, 0xD2, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0xD1, 0x80, 0x30, 0x10,
+0x80, 0xD1, 0x51, 0xF0, 0x90, 0x10, 0x30, 0xE0, 0x70, 0xC0, 0x70, 0x90, 0xC0, 0x81, 0x00, 0xE0,
+0x11, 0xC0, 0x60, 0xE0, 0xB0, 0xE0, 0x08, 0x40, 0x02, 0x80, 0x05, 0x60, 0xB1, 0x70, 0x10, 0x90,
+0x30, 0xA0, 0xD0, 0x60, 0xC0, 0x10, 0x40, 0xE0, 0xB0, 0x02, 0xC0, 0x50, 0xD0, 0xF0, 0x20, 0xF2,
+0xD0, 0x30, 0x80, 0xB0, 0x0B, 0x30, 0x10, 0x00, 0xB0, 0x40, 0x07, 0xB0, 0xE0, 0x03, 0x80, 0x90,
+0x03, 0x60, 0xE0, 0x05, 0x90, 0x08, 0x70, 0x80, 0xD0, 0x20, 0xF0, 0x22, 0xD0, 0xF0, 0xA2, 0xF0,
+0xD0, 0xF0, 0x23, 0xD0, 0xA0, 0x10, 0xB0, 0x00, 0xE0, 0x10, 0xF0, 0xD1, 0x90, 0x80, 0x90, 0xE0,
+0x41, 0x0F, 0x0E, 0x0F, 0x11, 0x90, 0x02, 0xC0, 0xF0, 0xD0, 0xF0, 0x26, 0xF1, 0x20, 0xD0, 0x80,
+0xC0, 0x00, 0x40, 0x70, 0xC0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0xD0, 0x30, 0xC0, 0x90, 0xD1, 0x90,
+0x50, 0x10, 0xD0, 0xF4, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0xF7, 0x50, 0xA0, 0xF0,
+0x20, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF3, 0x21, 0xF1, 0x21, 0xF0,
+0xA0, 0x50, 0xF3, 0x20, 0xF0, 0xD3, 0x40, 0x71, 0x90, 0x30, 0x50, 0xE0, 0x30, 0x40, 0xB0, 0x81,
+0x10, 0x30, 0x70, 0x30, 0x80, 0xA0, 0x80, 0xD1, 0x40, 0x80, 0x70, 0x82, 0x70, 0x80, 0xD0, 0xF2,
+0x90, 0x01, 0x60, 0x40, 0x60, 0x06, 0xB0, 0xE0, 0x0F, 0x00, 0xE1, 0x10, 0x00, 0x10, 0x30, 0x00,
+0x80, 0x11, 0x02, 0x60, 0x70, 0x90, 0xA0, 0x30, 0xA0, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xD2, 0x50,
+0x71, 0xE0, 0x10, 0x80, 0xD0, 0x21, 0xD1, 0xA0, 0x30, 0xD0, 0x90, 0x40, 0xE0, 0x90, 0xE0, 0xC0,
+0x30, 0x90, 0xE0, 0x90, 0x11, 0x00, 0xB0, 0xC0, 0x80, 0x40, 0xB0, 0x10, 0x05, 0xB0, 0xE0, 0x09,
+0xE0, 0x30, 0x90, 0x70, 0xE0, 0xB0, 0x70, 0xC0, 0x71, 0x90, 0x70, 0x90, 0x60, 0x03, 0x10, 0x90,
+0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0x90, 0xB0, 0x0C, 0x90, 0x70, 0x40, 0x09, 0x61, 0x02, 0xC0,
+0x30, 0x80, 0x01, 0x40, 0x60, 0x05, 0xE0, 0x80, 0x09, 0x70, 0xF2, 0x20, 0xF0, 0xD0, 0xA0, 0x50,
+0xA0, 0xF2, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xC0, 0xB0, 0x01, 0x80, 0x90, 0xD1, 0xA0, 0x70, 0x02,
+0x30, 0x0F, 0x0E, 0x0F, 0x10, 0x30, 0x80, 0x01, 0xE0, 0x80, 0xD0, 0x20, 0xF1, 0x21, 0xF1, 0x22,
+0xF2, 0xD0, 0x50, 0x81, 0x90, 0x70, 0xD1, 0x51, 0x20, 0xD0, 0xE0, 0xC0, 0x80, 0x90, 0x30, 0x50,
+0x10, 0xC0, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x30, 0xA0, 0xD0, 0xF0, 0x50, 0xA0,
+0xD0, 0xF0, 0x20, 0xF1, 0xA1, 0xD0, 0xF2, 0x24, 0xF1, 0xD0, 0x50, 0xA0, 0xF0, 0x21, 0xF1, 0x20,
+0xF3, 0x22, 0xF1, 0xA0, 0x50, 0xF0, 0x20, 0xF2, 0x21, 0xF1, 0xD3, 0x50, 0xD0, 0x30, 0x40, 0x01,
+0x60, 0x70, 0x50, 0xA0, 0xC0, 0x30, 0x70, 0x90, 0x80, 0x30, 0x91, 0x31, 0x90, 0x10, 0x90, 0x60,
+0x50, 0xD0, 0xF1, 0xD0, 0x90, 0xE0, 0x40, 0x60, 0x09, 0x40, 0x0E, 0x60, 0x40, 0x60, 0xC0, 0x11,
+0x60, 0x00, 0x70, 0xB0, 0x80, 0x10, 0x30, 0x10, 0x70, 0xD1, 0xA0, 0x90, 0xD0, 0xF0, 0x20, 0xF1,
+0xD2, 0xF0, 0x30, 0xC0, 0x11, 0x70, 0x90, 0xD1, 0x21, 0xF3, 0xD1, 0x70, 0x01, 0x60, 0x30, 0x60,
+0x30, 0xC0, 0x80, 0x10, 0x40, 0x01, 0x70, 0x00, 0x10, 0x60, 0xB0, 0x40, 0x60, 0x04, 0x40, 0x09,
+0x40, 0x70, 0x60, 0x03, 0x70, 0x00, 0xB0, 0x90, 0x40, 0x60, 0x70, 0xE0, 0x00, 0x60, 0xB0, 0x40,
+0x11, 0x70, 0xD1, 0xF2, 0x50, 0xD0, 0x90, 0xB0, 0x0C, 0x41, 0x0B, 0x40, 0xB0, 0x03, 0x30, 0x41,
+0x07, 0x90, 0x0A, 0x60, 0x30, 0xD0, 0xF0, 0xD0, 0xA0, 0x51, 0xD0, 0xF0, 0xD0, 0xF0, 0x22, 0xF0,
+0x21, 0xF0, 0x20, 0xD0, 0xA0, 0x10, 0xE0, 0x01, 0x80, 0x70, 0xD1, 0x30, 0x60, 0x01, 0x90, 0x40,
+0x0F, 0x0D, 0x0F, 0x10, 0x90, 0x40, 0x90, 0xE0, 0x90, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x22,
+0xF0, 0x21, 0xF0, 0xA0, 0x80, 0x32, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0x30, 0x90, 0x80, 0xC0,
+0x30, 0x11, 0x50, 0xD0, 0x22, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0x90, 0x20, 0xF0, 0xD1, 0x51, 0xF0,
+0xD0, 0xF1, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF3,
+0x20, 0xF3, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0xD0, 0xF0, 0x25, 0xF0, 0x20, 0xF0, 0x50, 0x90,
+0x30, 0x00, 0x40, 0x90, 0xF0, 0xD0, 0x71, 0x50, 0xD0, 0xE0, 0x70, 0xE0, 0x60, 0xE0, 0x31, 0xE0,
+0x30, 0x10, 0x70, 0xA1, 0xF0, 0xD0, 0xA0, 0x50, 0x90, 0x0B, 0x61, 0x09, 0xB0, 0x00, 0x60, 0x30,
+0xC0, 0x31, 0xD0, 0x80, 0x70, 0x03, 0xE0, 0x10, 0x90, 0x30, 0xD0, 0xA1, 0x50, 0xD0, 0xF1, 0x20,
+0xF0, 0xA0, 0x30, 0x72, 0x90, 0x70, 0x10, 0x90, 0x40, 0xA0, 0xD0, 0x22, 0xF4, 0xD0, 0x70, 0x02,
+0x70, 0x31, 0x03, 0x70, 0x80, 0xC0, 0x70, 0xE0, 0x70, 0xB0, 0x00, 0x60, 0x80, 0xB0, 0x01, 0x61,
+0x08, 0xE0, 0x80, 0x30, 0x04, 0x40, 0x80, 0x01, 0x30, 0x90, 0xC0, 0x10, 0x70, 0x12, 0x30, 0x90,
+0x50, 0xC0, 0xD1, 0xF0, 0x50, 0xF0, 0xD0, 0x90, 0x60, 0x0B, 0x40, 0x60, 0x30, 0x0C, 0x40, 0x03,
+0xE0, 0x40, 0x30, 0x07, 0x30, 0x0B, 0x90, 0xA0, 0xF0, 0x50, 0xA0, 0xF0, 0xD0, 0xF3, 0x23, 0xF1,
+0x20, 0xF0, 0x20, 0xD0, 0x50, 0x10, 0x02, 0xE0, 0x10, 0xD0, 0xA0, 0x30, 0x40, 0x90, 0xE0, 0x90,
+0x0F, 0x0D, 0x0F, 0x0F, 0x80, 0xE0, 0x01, 0x80, 0x30, 0xD0, 0x21, 0xF2, 0x20, 0xF0, 0x25, 0xF2,
+0x90, 0x30, 0xD0, 0xF0, 0xD0, 0xF0, 0xD1, 0xF0, 0xA0, 0x80, 0x70, 0xE0, 0x80, 0xC0, 0x90, 0x50,
+0xD0, 0x22, 0xF0, 0x21, 0xF1, 0x20, 0xF2, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0x50, 0x20,
+0xF3, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0xA0, 0x50, 0xF3, 0x20, 0xF0, 0x26, 0xF0, 0xD0, 0xA0,
+0x50, 0xD0, 0xF1, 0x22, 0xF6, 0x50, 0xC0, 0x00, 0xC0, 0xD1, 0xF0, 0xD3, 0xC0, 0x90, 0x30, 0x81,
+0x51, 0x81, 0x50, 0xA0, 0xD0, 0x50, 0xA0, 0x50, 0xA0, 0xD0, 0x30, 0xE0, 0x0B, 0x40, 0x06, 0xE0,
+0x80, 0x90, 0x10, 0xC0, 0x90, 0x10, 0xA1, 0xD2, 0xC0, 0x40, 0x00, 0x30, 0xE1, 0x90, 0xA0, 0x30,
+0xD0, 0x50, 0xA0, 0x50, 0xF1, 0x21, 0xD0, 0x30, 0xC0, 0x93, 0x70, 0xA0, 0xD0, 0xA1, 0xF0, 0x21,
+0xF0, 0x23, 0xF0, 0xD0, 0x70, 0x02, 0x71, 0xE0, 0x80, 0x00, 0x60, 0x30, 0x13, 0x90, 0x10, 0x70,
+0x40, 0xC1, 0x60, 0x40, 0xB0, 0xE0, 0x08, 0xB0, 0xE0, 0x00, 0x30, 0x60, 0x04, 0x80, 0x40, 0x00,
+0xE0, 0x40, 0x10, 0xC1, 0x70, 0xC0, 0x70, 0x31, 0xA0, 0xD0, 0x90, 0xF0, 0x50, 0xA0, 0xD1, 0x90,
+0xB0, 0x0A, 0x40, 0xB0, 0x00, 0x90, 0x0C, 0xB0, 0xE0, 0x00, 0xB0, 0x40, 0xB0, 0x00, 0x60, 0x30,
+0x80, 0x04, 0x90, 0x70, 0x30, 0x0A, 0xB0, 0x90, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF1, 0x20, 0xF1,
+0x22, 0xF0, 0x20, 0xF1, 0xD0, 0x90, 0x70, 0x02, 0x70, 0x90, 0xD0, 0x70, 0x40, 0x01, 0x41, 0x0F,
+0x0C, 0x0F, 0x0F, 0x70, 0x02, 0x90, 0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0xD0, 0xC0,
+0x71, 0xA0, 0xF4, 0xD0, 0x91, 0x51, 0x71, 0xD0, 0xF0, 0x25, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0x51, 0xA0, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0,
+0xF0, 0x50, 0x20, 0xF0, 0xA0, 0x50, 0xF0, 0x22, 0xF0, 0x20, 0xF4, 0xA0, 0x50, 0xD0, 0xF1, 0x20,
+0xF2, 0x22, 0xF0, 0xD0, 0xA0, 0x90, 0x10, 0x70, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xD0,
+0x50, 0xD7, 0xF0, 0x51, 0xD2, 0x50, 0x80, 0x0B, 0x40, 0x06, 0x90, 0x31, 0x12, 0x70, 0xA0, 0xF0,
+0xA0, 0xD1, 0x50, 0xC0, 0x70, 0x90, 0x10, 0xC0, 0x81, 0xD2, 0xF0, 0x50, 0xD0, 0x22, 0xD0, 0xF1,
+0xD5, 0xF0, 0xA1, 0xF0, 0x20, 0xF2, 0x23, 0xD0, 0x70, 0x60, 0x40, 0x10, 0xC0, 0x71, 0x80, 0x90,
+0x70, 0xC0, 0x91, 0x10, 0xC0, 0x70, 0x90, 0x40, 0x90, 0x40, 0x02, 0x80, 0x40, 0x08, 0x40, 0x02,
+0x70, 0x04, 0xB0, 0x30, 0x40, 0x00, 0xB0, 0x70, 0x30, 0x70, 0x80, 0xD0, 0xB0, 0x30, 0x10, 0x70,
+0x60, 0x10, 0x50, 0xA0, 0xD0, 0xF0, 0xD0, 0x30, 0xB0, 0x08, 0xB0, 0x40, 0x02, 0x80, 0xE0, 0x0C,
+0x60, 0x40, 0xE0, 0x04, 0x40, 0x80, 0x01, 0x70, 0x90, 0x10, 0x30, 0x10, 0xC0, 0x70, 0x10, 0x06,
+0xB0, 0x40, 0x60, 0x70, 0xD0, 0xF0, 0x23, 0xF4, 0x22, 0xF0, 0x22, 0xF0, 0xD0, 0xC0, 0x02, 0x60,
+0x90, 0xD0, 0xA0, 0x80, 0x02, 0x70, 0x0F, 0x0C, 0x0F, 0x0E, 0x40, 0x30, 0x90, 0x40, 0x60, 0x30,
+0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x20, 0xF1, 0x22, 0xD0, 0x90, 0x30, 0xD0, 0xF0, 0x21, 0xF1,
+0xD0, 0x50, 0x10, 0xA0, 0xD0, 0x30, 0xE0, 0x70, 0xD1, 0xF0, 0x25, 0xF0, 0x23, 0xF0, 0x20, 0xF0,
+0x21, 0xF1, 0xD0, 0xF0, 0x51, 0xA0, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0xD0,
+0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0xF0,
+0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x30, 0xC0, 0xD0, 0xF2, 0x20, 0xF0, 0x20,
+0xD1, 0xA1, 0xF4, 0xD0, 0xA0, 0x50, 0xD0, 0x50, 0xF0, 0xD1, 0x90, 0x60, 0x0B, 0x61, 0x05, 0x90,
+0x70, 0xD0, 0xF0, 0x90, 0xA0, 0xD1, 0xF0, 0x50, 0xD0, 0xF1, 0xD2, 0x80, 0x71, 0xC0, 0x90, 0xA0,
+0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x21, 0xF7, 0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x24, 0xD0, 0x30,
+0x10, 0x01, 0x60, 0xE0, 0x90, 0x80, 0x60, 0x00, 0x10, 0xE0, 0x11, 0x70, 0x10, 0x70, 0x10, 0x70,
+0x60, 0x00, 0x41, 0xE0, 0x00, 0x41, 0xB0, 0xE0, 0x80, 0x90, 0x40, 0x30, 0x70, 0x30, 0xB0, 0x01,
+0x70, 0x05, 0x80, 0x01, 0xB0, 0x30, 0xC0, 0x70, 0xD0, 0x90, 0x30, 0x11, 0x70, 0x60, 0x31, 0xD0,
+0xF1, 0xD0, 0x80, 0xE0, 0x07, 0x60, 0xE0, 0x03, 0x60, 0x80, 0x0B, 0xB0, 0x41, 0x06, 0x90, 0xB0,
+0x10, 0xB0, 0x01, 0xE0, 0x40, 0x80, 0xC0, 0x80, 0x04, 0xB0, 0x40, 0xE0, 0x01, 0xE0, 0x90, 0xD0,
+0xF1, 0x22, 0xF2, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0x90, 0x70, 0x02, 0x90, 0x40, 0xD0, 0x70, 0x00,
+0x80, 0x91, 0xE0, 0x0F, 0x0B, 0x0F, 0x0E, 0x90, 0x01, 0xE0, 0xC0, 0x50, 0xF1, 0xD0, 0xF0, 0x23,
+0xF2, 0x20, 0xF2, 0x22, 0xA0, 0xC0, 0xD0, 0x50, 0x22, 0xF0, 0xD0, 0xC0, 0x90, 0xD0, 0xA0, 0x10,
+0x00, 0x80, 0x50, 0xF2, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF3, 0x50, 0xF1,
+0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xF0,
+0x22, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0xA0,
+0x30, 0x70, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x50, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD1,
+0xF0, 0x50, 0xD0, 0x80, 0x70, 0x0D, 0x40, 0x03, 0xB0, 0x31, 0xD0, 0xF0, 0xD2, 0xF0, 0x20, 0xF0,
+0x50, 0xF0, 0x21, 0xF3, 0x30, 0xC0, 0x10, 0x80, 0xC0, 0x90, 0xD0, 0x50, 0xD0, 0x51, 0x20, 0xF3,
+0x21, 0xF3, 0x50, 0xF0, 0x20, 0xF2, 0x23, 0xF0, 0xD0, 0x90, 0x10, 0x60, 0xE0, 0x80, 0x40, 0x60,
+0x02, 0x30, 0x00, 0x60, 0xC1, 0x10, 0x90, 0x60, 0x70, 0xC0, 0x90, 0x10, 0x80, 0x70, 0x01, 0x60,
+0x40, 0x90, 0xB1, 0x80, 0xE0, 0x60, 0x00, 0x30, 0x70, 0x80, 0x10, 0x40, 0x03, 0xE0, 0xC0, 0x40,
+0xE0, 0x00, 0x70, 0x40, 0x10, 0x30, 0x90, 0x11, 0x30, 0x80, 0xA0, 0xC0, 0x90, 0xD0, 0xF0, 0xD1,
+0x91, 0x60, 0x05, 0xE1, 0x04, 0xB0, 0x30, 0x0A, 0x60, 0xE0, 0x01, 0x40, 0x05, 0x30, 0xC0, 0xB0,
+0x03, 0x30, 0x06, 0xE0, 0x40, 0x60, 0x03, 0x30, 0x80, 0xD1, 0x22, 0xF2, 0x23, 0xF2, 0xD0, 0xF1,
+0xD0, 0x10, 0xB0, 0x02, 0x90, 0xA0, 0x50, 0xC0, 0x60, 0x01, 0x90, 0x0F, 0x0B, 0x0F, 0x0D, 0x41,
+0x01, 0x60, 0x30, 0xF0, 0x50, 0xA0, 0xF0, 0xD0, 0x22, 0xF1, 0x22, 0xF2, 0x21, 0xD0, 0x50, 0x70,
+0xA0, 0x30, 0x22, 0xF1, 0x70, 0xD1, 0x90, 0x40, 0x00, 0x70, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x22,
+0xF0, 0x20, 0xF0, 0x22, 0xF5, 0xD0, 0x50, 0xA0, 0xF1, 0xD0, 0xA0, 0x50, 0xF2, 0x23, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x23, 0xD0, 0xF0, 0xA1, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF3,
+0xA0, 0x50, 0xF1, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0x80, 0x70, 0xD0, 0xF0, 0x21, 0xF4, 0x20, 0x50,
+0xD1, 0x51, 0xF1, 0x21, 0xF0, 0x50, 0xD0, 0x90, 0x60, 0x0D, 0xE0, 0xB0, 0x02, 0x40, 0x10, 0xD1,
+0x20, 0xA0, 0xF3, 0xD0, 0x50, 0xF1, 0x23, 0xF0, 0xD0, 0xA0, 0x50, 0x10, 0xC1, 0xD0, 0x50, 0xA0,
+0x22, 0xF0, 0xD2, 0xF0, 0x22, 0xF0, 0x20, 0x50, 0xD0, 0x22, 0xF2, 0x21, 0xF0, 0xA0, 0x13, 0x90,
+0x80, 0x02, 0x90, 0xC0, 0xE0, 0xB0, 0x00, 0xE0, 0x10, 0xC0, 0x00, 0x10, 0x30, 0x10, 0xC0, 0x70,
+0x40, 0x02, 0xB0, 0x81, 0x01, 0x40, 0x02, 0x81, 0x90, 0x80, 0x30, 0x60, 0x00, 0xB0, 0x70, 0x90,
+0x80, 0x30, 0x70, 0x40, 0x30, 0x10, 0x70, 0x10, 0xC0, 0x11, 0x80, 0x50, 0x70, 0x90, 0xD1, 0xF0,
+0xD0, 0x70, 0xE0, 0x80, 0x30, 0x41, 0x60, 0x00, 0xE0, 0xB0, 0x06, 0x30, 0x09, 0x40, 0x60, 0x02,
+0x61, 0x05, 0x30, 0x04, 0x90, 0x04, 0x60, 0x40, 0xB0, 0x60, 0x70, 0x04, 0x90, 0x70, 0x50, 0xD0,
+0x23, 0xF0, 0x22, 0xF2, 0xD0, 0x80, 0xF0, 0xD1, 0x30, 0xE0, 0x02, 0x40, 0x90, 0xD0, 0x90, 0x02,
+0x80, 0x60, 0x0F, 0x0A, 0x0F, 0x0D, 0x70, 0x90, 0x40, 0x00, 0x30, 0xA0, 0xD1, 0xA0, 0x51, 0x21,
+0xD0, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0xA1, 0xD1, 0x23, 0xD2, 0x50, 0x80, 0x00, 0xE0, 0x30, 0xD1,
+0xA0, 0x50, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0xA0, 0x50, 0xD0,
+0x20, 0xF3, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0xD0, 0xA0, 0x50,
+0xF0, 0x26, 0xF0, 0x20, 0xF3, 0xA0, 0x50, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x50, 0x80,
+0xD0, 0xF0, 0x21, 0xF3, 0x20, 0xD0, 0xA0, 0x51, 0xA0, 0xD0, 0x23, 0xF1, 0xA0, 0x10, 0xB0, 0x0D,
+0x61, 0x02, 0xB0, 0xC0, 0x90, 0xD1, 0x30, 0xF0, 0xA0, 0xF2, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF0,
+0xD0, 0xA0, 0xC1, 0x51, 0x30, 0xA0, 0x20, 0xF0, 0x51, 0x70, 0x50, 0xD1, 0x21, 0xF0, 0xA1, 0xF0,
+0x21, 0xF2, 0x22, 0xF0, 0xA0, 0x11, 0x30, 0x90, 0x80, 0x60, 0x00, 0x40, 0x90, 0x10, 0x60, 0x80,
+0x90, 0x70, 0x01, 0xE0, 0x80, 0x10, 0x40, 0xE0, 0x80, 0x50, 0x30, 0x91, 0x11, 0x90, 0xE0, 0x41,
+0x03, 0x40, 0xE0, 0x90, 0x00, 0xB0, 0x30, 0x80, 0x90, 0x70, 0x04, 0x80, 0x60, 0x01, 0x60, 0x10,
+0x40, 0x30, 0x10, 0xD1, 0xF2, 0xD0, 0x70, 0x01, 0xB0, 0x61, 0x80, 0x91, 0x40, 0x06, 0x90, 0x07,
+0x60, 0x40, 0x05, 0x40, 0x0B, 0x80, 0xE0, 0xB0, 0x00, 0xB0, 0x40, 0x60, 0x08, 0xB0, 0xC0, 0x10,
+0xF0, 0xD0, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x70, 0xC0, 0x50, 0xD0, 0xF0, 0xD0, 0x10, 0xE0,
+0x40, 0xE0, 0x00, 0x40, 0x80, 0x50, 0x80, 0x00, 0x80, 0x90, 0x30, 0x0F, 0x0A, 0x0F, 0x05, 0x81,
+0x04, 0xE0, 0x80, 0x00, 0xE0, 0x71, 0xD0, 0x20, 0xD0, 0xF0, 0xD0, 0xF0, 0x51, 0xA0, 0xF0, 0xD0,
+0xF1, 0x20, 0xF6, 0xD0, 0xF0, 0x20, 0xF2, 0xD0, 0x70, 0xD0, 0xC1, 0xB0, 0x00, 0x90, 0xD0, 0xF3,
+0x51, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF1,
+0xD0, 0xA0, 0x50, 0xF1, 0xD0, 0x20, 0xF0, 0x27, 0xF2, 0xD0, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x24,
+0xF2, 0xD0, 0xA0, 0x50, 0xF3, 0x24, 0xF0, 0xD0, 0xC0, 0x80, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0,
+0xD0, 0xF0, 0x51, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xD0, 0x50, 0x70, 0xB0, 0x0E, 0x40, 0x03,
+0x60, 0xC0, 0x10, 0x90, 0x30, 0x90, 0x10, 0xA0, 0xD0, 0xF0, 0xA1, 0x23, 0xF0, 0x20, 0xF1, 0x20,
+0xD0, 0xA0, 0xD1, 0x50, 0xD0, 0x21, 0xD0, 0x70, 0x11, 0xC0, 0x30, 0xA0, 0xF0, 0x20, 0xD0, 0xA1,
+0xD0, 0xF0, 0x26, 0xF0, 0xD0, 0x70, 0x10, 0x90, 0x60, 0x80, 0x30, 0xC0, 0x80, 0x00, 0x40, 0x10,
+0x70, 0x90, 0x30, 0xC0, 0x70, 0x80, 0x50, 0xF0, 0x30, 0xA0, 0xF0, 0xD0, 0xF0, 0xD2, 0xA0, 0x10,
+0x40, 0x00, 0x40, 0x60, 0x02, 0xB0, 0x10, 0x60, 0x30, 0x01, 0x70, 0xE0, 0x04, 0x40, 0xE0, 0x10,
+0x60, 0x00, 0xB0, 0x70, 0x40, 0x10, 0x30, 0xD0, 0xF0, 0x21, 0xD0, 0x80, 0x70, 0x04, 0x40, 0x01,
+0xE0, 0x90, 0x30, 0x80, 0x60, 0x02, 0x80, 0xB0, 0x05, 0x40, 0xE0, 0x07, 0x40, 0x0B, 0xC1, 0x70,
+0x81, 0x09, 0x40, 0x90, 0x30, 0xD2, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0x70, 0xF0, 0xD0, 0xF0,
+0xD0, 0xA0, 0x90, 0x40, 0x03, 0x90, 0x60, 0x70, 0x90, 0x60, 0x00, 0x30, 0xB0, 0x0F, 0x09, 0x0F,
+0x04, 0x40, 0xE0, 0x40, 0x60, 0x03, 0x30, 0x02, 0x80, 0xA0, 0xD0, 0x20, 0xD2, 0xF0, 0xD0, 0xF0,
+0x51, 0xA0, 0xD1, 0xF0, 0x20, 0xF3, 0xD0, 0x90, 0xF0, 0xD0, 0xF3, 0x50, 0xF0, 0xD0, 0x10, 0x90,
+0x01, 0x90, 0xD0, 0xF0, 0x20, 0xF3, 0x50, 0xA0, 0xF4, 0x22, 0xF1, 0xD0, 0x50, 0xF1, 0xD0, 0x20,
+0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xF4, 0x23, 0xF0, 0x25, 0xF1, 0x50, 0xA0, 0xD0, 0xF1, 0xD0,
+0xF0, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0x80,
+0xA0, 0xD0, 0xF0, 0x21, 0xF2, 0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xD1, 0xA0, 0x10, 0x80,
+0x0F, 0x00, 0x60, 0xB0, 0x00, 0x80, 0x10, 0x70, 0x91, 0x80, 0x10, 0x40, 0xC0, 0xA0, 0xF1, 0xA1,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x21, 0xF2, 0x50, 0xF0, 0x21, 0xD0, 0x80, 0x70, 0xC0,
+0x30, 0x10, 0xC0, 0xD0, 0xF0, 0xD0, 0xA0, 0xF0, 0xD0, 0x20, 0xF0, 0x25, 0xF2, 0xC1, 0x81, 0x10,
+0x04, 0xB0, 0x00, 0x40, 0x70, 0xE0, 0xD2, 0x70, 0x31, 0xD0, 0xC1, 0xA0, 0xD1, 0x10, 0x80, 0x01,
+0x60, 0xE0, 0x01, 0x40, 0x90, 0x00, 0x70, 0xE1, 0x80, 0xE0, 0x03, 0x31, 0x80, 0x60, 0x81, 0x30,
+0x11, 0x50, 0xF1, 0x22, 0xD0, 0x30, 0x60, 0x02, 0x60, 0x40, 0x05, 0x60, 0x80, 0x90, 0x40, 0xB0,
+0xE1, 0x03, 0xB0, 0x40, 0xB0, 0x08, 0x61, 0x0A, 0x40, 0x80, 0x01, 0x60, 0x90, 0x06, 0x90, 0x80,
+0x90, 0x00, 0x30, 0x70, 0x80, 0xF1, 0x23, 0xF0, 0x20, 0xA0, 0xC0, 0xF2, 0xA0, 0x50, 0xA0, 0x50,
+0x80, 0x03, 0xB0, 0x90, 0x80, 0xE0, 0x01, 0xB0, 0x80, 0x0F, 0x09, 0x0F, 0x05, 0x30, 0x80, 0x04,
+0x10, 0x40, 0x01, 0x70, 0xD0, 0xF0, 0xD0, 0x50, 0x70, 0x80, 0xD0, 0xF3, 0xA0, 0x50, 0xA0, 0xF1,
+0x20, 0xF2, 0xD0, 0x50, 0x80, 0xF1, 0x20, 0xF1, 0x80, 0xD0, 0x90, 0x30, 0x70, 0x00, 0x80, 0x90,
+0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xA0, 0xF1, 0xD0, 0xF0, 0x22, 0xF0, 0xA0, 0x50,
+0xF4, 0x24, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x20, 0xF1, 0x24, 0xF0, 0x20, 0xF2, 0xD0, 0x50, 0xA0,
+0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0x21,
+0xF0, 0x20, 0xF1, 0xD0, 0x50, 0x30, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1,
+0x20, 0xF1, 0x21, 0xF0, 0xD0, 0x30, 0x70, 0xB0, 0x60, 0x0F, 0x00, 0xE0, 0x00, 0x40, 0xC0, 0xD2,
+0x50, 0x11, 0x90, 0xD0, 0x21, 0xF0, 0x50, 0xF3, 0x20, 0xF2, 0x22, 0xF1, 0x50, 0xF0, 0x22, 0xD0,
+0xA0, 0xD1, 0x51, 0xD0, 0xF0, 0xD0, 0x50, 0xF2, 0x21, 0xF0, 0x23, 0xF0, 0xD1, 0xF0, 0x80, 0x11,
+0x70, 0x80, 0x02, 0x80, 0x02, 0xE0, 0xC0, 0x90, 0x31, 0x70, 0xC0, 0x10, 0x90, 0x40, 0x90, 0x80,
+0xF0, 0xD0, 0x30, 0x60, 0x02, 0xB0, 0x40, 0xB0, 0xC0, 0xB0, 0x00, 0xB0, 0x81, 0x00, 0x70, 0x03,
+0x60, 0x10, 0x70, 0x31, 0x90, 0x81, 0x50, 0xF0, 0xD0, 0xF2, 0x20, 0xD0, 0x30, 0xE0, 0x01, 0x60,
+0xE0, 0x09, 0xE0, 0x80, 0x91, 0x02, 0xE1, 0x0B, 0x40, 0x08, 0x60, 0x40, 0xB0, 0x90, 0x02, 0x40,
+0x80, 0x04, 0x60, 0x80, 0x30, 0xB0, 0x01, 0x70, 0x10, 0x50, 0xD1, 0xF0, 0x20, 0xF0, 0x21, 0xD0,
+0x30, 0xC0, 0x30, 0x50, 0xA0, 0xF2, 0x70, 0x04, 0x30, 0x50, 0x90, 0x00, 0xB0, 0x80, 0xC0, 0x0F,
+0x09, 0x0F, 0x05, 0xB0, 0x04, 0x80, 0x60, 0x40, 0x30, 0x90, 0x80, 0xD1, 0xF0, 0x91, 0xC0, 0xD3,
+0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0, 0x90, 0x80, 0xD0, 0x20, 0xF2, 0xD0,
+0x91, 0x40, 0x70, 0x40, 0x90, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF1,
+0xD0, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0xA0, 0x50,
+0xF3, 0x26, 0xF0, 0x21, 0xF1, 0xD0, 0xA1, 0xF3, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0xD0, 0xA0, 0x50,
+0xF2, 0x21, 0xF0, 0x20, 0xF1, 0xA0, 0x30, 0xA1, 0xD1, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0xD0, 0xF0,
+0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x30, 0xC0, 0x00, 0xE0, 0x0F, 0x00, 0x40, 0x10, 0xC0, 0xD2, 0xA0,
+0xC1, 0xD1, 0xF0, 0x21, 0xD0, 0x50, 0xF5, 0x23, 0xF2, 0x50, 0xD0, 0x22, 0xF0, 0xD0, 0xF1, 0xD1,
+0x21, 0x51, 0xD3, 0xF1, 0x20, 0xF6, 0xA0, 0x90, 0x10, 0x90, 0x10, 0x30, 0x00, 0x60, 0x10, 0x04,
+0xB0, 0x42, 0xE0, 0x10, 0x70, 0x91, 0xC0, 0x10, 0xD1, 0x70, 0xB0, 0x03, 0x40, 0x70, 0x00, 0x60,
+0x80, 0x90, 0x40, 0x80, 0x70, 0xB0, 0x02, 0x60, 0x90, 0x60, 0xD0, 0x80, 0xA0, 0xD2, 0xF1, 0x20,
+0xF0, 0x21, 0xD0, 0xA0, 0x90, 0x00, 0x40, 0x60, 0x0D, 0x40, 0x30, 0x80, 0x40, 0xB0, 0x0C, 0xB0,
+0x40, 0x05, 0xB0, 0x40, 0x60, 0x01, 0x70, 0x03, 0xC0, 0x04, 0x80, 0x60, 0x03, 0xB0, 0xC0, 0x71,
+0x30, 0xD1, 0xF2, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xD0, 0x80, 0x70, 0x04, 0x90, 0x30,
+0x90, 0x30, 0xE0, 0x41, 0x0F, 0x08, 0x0F, 0x03, 0x60, 0x10, 0x90, 0x10, 0xC0, 0xE0, 0x01, 0x90,
+0x02, 0x90, 0xD2, 0x70, 0x00, 0x30, 0xC0, 0xA0, 0x30, 0xA0, 0x50, 0xD1, 0xF2, 0xA0, 0x50, 0xA0,
+0xF2, 0xD1, 0x21, 0xF1, 0xD0, 0x81, 0x00, 0x90, 0x10, 0x90, 0x30, 0xD0, 0x20, 0xF3, 0x22, 0xF3,
+0x51, 0xF0, 0xD0, 0xF1, 0xA1, 0xD0, 0xF0, 0x23, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0x50, 0xA0, 0xD0,
+0xF0, 0x21, 0xF0, 0x24, 0xF5, 0xA0, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0,
+0xA0, 0x50, 0xD0, 0xF1, 0x20, 0xF4, 0xD1, 0x80, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0xD2, 0xF0, 0xA1,
+0xD0, 0xF1, 0xD0, 0x30, 0xC0, 0x70, 0xE1, 0x0D, 0xE0, 0x70, 0xE0, 0xD1, 0xF0, 0xD0, 0x70, 0xC0,
+0xD0, 0x80, 0xD0, 0x21, 0xF0, 0xD0, 0x50, 0xF3, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0xA0, 0xF0,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x30, 0x52, 0x80, 0xC0, 0xA0, 0xF0, 0x20, 0xF0,
+0x50, 0xA0, 0xD1, 0xF0, 0xA1, 0xD0, 0xA0, 0x13, 0x70, 0x40, 0xE0, 0xB0, 0x70, 0x90, 0x80, 0x60,
+0x00, 0xE0, 0x80, 0x00, 0xE0, 0x90, 0x30, 0xB0, 0x00, 0x90, 0x31, 0x40, 0x90, 0x03, 0x81, 0x60,
+0xE0, 0x40, 0x80, 0x71, 0x40, 0x03, 0x10, 0x50, 0xD0, 0x40, 0x70, 0x10, 0xD0, 0x22, 0xF0, 0x20,
+0xF2, 0x20, 0xD0, 0x81, 0x0F, 0x01, 0x60, 0xE0, 0x70, 0x0E, 0xE0, 0xB0, 0x03, 0x40, 0xE0, 0x03,
+0x80, 0x60, 0x03, 0x90, 0xE1, 0x00, 0xB0, 0x10, 0x60, 0x04, 0xB0, 0x60, 0x40, 0x10, 0x30, 0xD1,
+0xF0, 0x51, 0xA0, 0xD0, 0xF1, 0x20, 0xF1, 0xD0, 0xA0, 0x70, 0x04, 0x81, 0x30, 0x02, 0x90, 0x0F,
+0x08, 0x0F, 0x03, 0x70, 0xB0, 0x01, 0x60, 0x70, 0x40, 0xE0, 0x90, 0x01, 0x60, 0x90, 0xD0, 0x31,
+0x40, 0xB0, 0x11, 0x90, 0x10, 0xC0, 0x70, 0xF1, 0x22, 0xD1, 0xA0, 0x51, 0x20, 0xF0, 0x80, 0xA0,
+0x20, 0xD2, 0x90, 0x70, 0x10, 0x80, 0x50, 0xD0, 0x70, 0xA0, 0x21, 0xF2, 0x22, 0xF0, 0x20, 0xF1,
+0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x50, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x23,
+0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0x50, 0xF2, 0x20,
+0xF1, 0x20, 0xF2, 0x21, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0xA0, 0x30, 0x90,
+0x30, 0xA0, 0xD0, 0xA0, 0x80, 0x30, 0x91, 0x80, 0x30, 0xC0, 0x80, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0,
+0x90, 0x30, 0xB0, 0x0C, 0x40, 0x80, 0x50, 0xD0, 0xF4, 0xD0, 0x50, 0xF1, 0x21, 0xD0, 0xA0, 0xF2,
+0x20, 0xF1, 0x23, 0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xA0, 0x71,
+0x30, 0x11, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0xD1, 0xC0, 0x10, 0xC0, 0x12,
+0x70, 0x91, 0x10, 0xB1, 0x90, 0x60, 0x00, 0x60, 0x10, 0x70, 0xE1, 0x40, 0x80, 0xC0, 0x40, 0xC0,
+0x10, 0x30, 0xC0, 0x70, 0x10, 0xB0, 0x60, 0x30, 0x40, 0x01, 0x10, 0x03, 0x80, 0x10, 0xA1, 0x30,
+0x90, 0x30, 0xA1, 0xD0, 0x22, 0xF2, 0xD0, 0xA0, 0x50, 0x32, 0x0D, 0x40, 0x60, 0x00, 0x80, 0x60,
+0x0E, 0x40, 0x01, 0xE0, 0x40, 0x05, 0x60, 0x30, 0x01, 0x90, 0xB0, 0x80, 0x71, 0x00, 0x80, 0x41,
+0x07, 0x71, 0xD0, 0x51, 0xF1, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x90, 0x05, 0x90, 0x70, 0x02,
+0x70, 0xB0, 0x04, 0xB0, 0x60, 0x0F, 0x00, 0x0F, 0x03, 0x81, 0x03, 0x70, 0x90, 0xE0, 0x90, 0x80,
+0x71, 0x30, 0x90, 0x30, 0x00, 0x90, 0x70, 0xC0, 0x30, 0x12, 0x80, 0xD0, 0xF0, 0x22, 0xF2, 0xA0,
+0x50, 0x80, 0xC0, 0x80, 0xF0, 0xA0, 0xF0, 0xD0, 0xC1, 0xE0, 0x10, 0xD0, 0x30, 0x70, 0x50, 0x20,
+0xF7, 0x20, 0xF2, 0xD1, 0xA0, 0x51, 0xA0, 0xD0, 0xF4, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0xD0, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xD0,
+0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF4, 0xA0, 0x50, 0xF2, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xF0,
+0x80, 0x10, 0x91, 0xC0, 0xE0, 0x60, 0x04, 0x80, 0x70, 0xD1, 0xF0, 0xD1, 0xC0, 0xE0, 0x0C, 0x80,
+0x51, 0xF1, 0x21, 0xF3, 0x22, 0xF0, 0xD0, 0xA1, 0xF3, 0x25, 0xF1, 0x50, 0xF0, 0x20, 0xF3, 0x20,
+0xF0, 0x23, 0xA0, 0x12, 0x90, 0x12, 0xF1, 0x22, 0xF0, 0xA1, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA1,
+0x50, 0xC0, 0x10, 0x70, 0x30, 0xC0, 0x31, 0x92, 0x80, 0x70, 0x10, 0xB0, 0x40, 0xC0, 0x70, 0xC0,
+0x70, 0x10, 0x00, 0xB0, 0xE0, 0x00, 0xE0, 0x80, 0xE0, 0x00, 0x90, 0x01, 0x40, 0xE0, 0x00, 0xE0,
+0x70, 0x10, 0x51, 0x71, 0xB0, 0x92, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xD1, 0xA0, 0x50, 0xF0, 0xD0,
+0xA0, 0x50, 0x90, 0x0A, 0x60, 0x40, 0x02, 0xB0, 0xC0, 0x40, 0x0D, 0x60, 0xE0, 0x40, 0x60, 0x06,
+0x60, 0x30, 0x01, 0x10, 0x90, 0xB0, 0x11, 0x00, 0x90, 0x02, 0xB0, 0x05, 0xB0, 0x30, 0x80, 0xD2,
+0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x70, 0x60, 0x04, 0x40, 0x90, 0x81, 0x30, 0xE0, 0x30, 0x04,
+0xB0, 0xC0, 0x0F, 0x00, 0x0F, 0x04, 0x90, 0xC0, 0x80, 0x60, 0xE0, 0xC0, 0x80, 0x01, 0x40, 0xC0,
+0x60, 0xE0, 0x02, 0x10, 0x90, 0x10, 0xC0, 0x70, 0x90, 0x10, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20,
+0xF1, 0xD0, 0x30, 0x10, 0x90, 0x80, 0xA0, 0x10, 0x30, 0xD0, 0x90, 0x40, 0x81, 0x50, 0x90, 0x10,
+0xD0, 0x20, 0xF5, 0x22, 0xF4, 0xD0, 0xA0, 0x51, 0xF1, 0xD1, 0xF2, 0x22, 0xF1, 0x50, 0xF0, 0x20,
+0xF1, 0x21, 0xF1, 0x51, 0xF1, 0xD0, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0x50, 0xA0,
+0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xF0, 0x22, 0xF0, 0xD0, 0xF0,
+0x50, 0xF0, 0xD0, 0xF0, 0x80, 0xC0, 0x09, 0x90, 0x80, 0xD2, 0x50, 0xC0, 0x61, 0x09, 0x31, 0x90,
+0xD0, 0xA1, 0xD0, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xA1, 0xD0, 0xF2, 0x25, 0xF1, 0x50,
+0xD0, 0xF5, 0x23, 0xF0, 0xA0, 0x80, 0x14, 0x50, 0xD0, 0x23, 0xF0, 0xA0, 0xF1, 0x20, 0xF0, 0x24,
+0xD2, 0x70, 0x11, 0x40, 0xB0, 0x00, 0x30, 0x90, 0xC0, 0x10, 0xC2, 0x60, 0x70, 0x12, 0x01, 0xB0,
+0x01, 0x30, 0xE0, 0x30, 0x70, 0x80, 0xB1, 0xC0, 0x80, 0x10, 0xC0, 0x50, 0x40, 0xE0, 0x70, 0xB0,
+0x00, 0x60, 0x90, 0xC1, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF3, 0xD0, 0x30, 0x60, 0x08,
+0x40, 0xE0, 0x04, 0x90, 0xE0, 0x30, 0x80, 0x0A, 0xB0, 0x41, 0x08, 0xB0, 0x80, 0x01, 0x71, 0xE0,
+0x10, 0x40, 0x10, 0xB0, 0x01, 0xB0, 0x10, 0x03, 0xB0, 0x40, 0xE0, 0x00, 0x90, 0xC0, 0xD0, 0xF0,
+0xD1, 0xF1, 0x20, 0xF3, 0xD0, 0x90, 0x30, 0x05, 0x90, 0xC0, 0x60, 0x01, 0x30, 0x05, 0x70, 0xB0,
+0x0E, 0x0F, 0x03, 0xB0, 0x01, 0x40, 0x70, 0x31, 0xB0, 0x01, 0x30, 0xE0, 0x03, 0xC0, 0x90, 0x40,
+0xE0, 0x02, 0xC0, 0x30, 0xD0, 0x26, 0xF0, 0xD0, 0x30, 0x90, 0xA0, 0x50, 0x90, 0x80, 0xD0, 0x30,
+0xE0, 0x90, 0x60, 0x30, 0xC0, 0x30, 0xD0, 0x22, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xD0,
+0xF0, 0x51, 0xF0, 0xD1, 0xF0, 0xD1, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0xD0,
+0xF0, 0x50, 0xA0, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x21,
+0xF0, 0x22, 0xF3, 0xA0, 0x50, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0xD0, 0xA0, 0x50, 0x90, 0x10,
+0x70, 0x07, 0x40, 0x70, 0xD0, 0xC0, 0x70, 0x80, 0x00, 0x40, 0x07, 0x11, 0x30, 0xA0, 0xD2, 0x50,
+0xF1, 0x20, 0xF8, 0x20, 0x50, 0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0x50, 0xD0, 0xF1, 0x22, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0x50, 0xD1, 0x11, 0xC0, 0xD1, 0xF1, 0x21, 0xF1, 0x50, 0xD0, 0xF2, 0x23,
+0xF3, 0xD0, 0xA0, 0x10, 0x30, 0xB0, 0x80, 0x01, 0x40, 0x70, 0x30, 0xE0, 0x15, 0x40, 0x02, 0x40,
+0x60, 0x90, 0xE0, 0x00, 0x80, 0x90, 0xE0, 0x90, 0x10, 0x90, 0xE0, 0x40, 0x90, 0x70, 0x80, 0x00,
+0x40, 0x10, 0xD1, 0xC0, 0x70, 0xD1, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xD0, 0xA0, 0x70, 0x07,
+0xB0, 0x40, 0x05, 0x30, 0xB0, 0x01, 0x60, 0x70, 0x80, 0x07, 0xE0, 0x40, 0x00, 0xB0, 0xE0, 0x08,
+0xC0, 0x01, 0x61, 0x00, 0x30, 0x00, 0x30, 0x90, 0x01, 0x60, 0x80, 0x01, 0x60, 0x40, 0xE0, 0x03,
+0xE0, 0xC1, 0x10, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xA0, 0x90, 0x05, 0xE0, 0xC0, 0x60, 0x01,
+0xE0, 0x80, 0x30, 0xC1, 0x70, 0x80, 0x90, 0x80, 0x0E, 0x0F, 0x01, 0xB0, 0x70, 0x90, 0x10, 0x90,
+0x60, 0x01, 0x70, 0x30, 0x80, 0xB0, 0xC0, 0x04, 0xB0, 0x00, 0x80, 0x60, 0x02, 0x80, 0x50, 0xD0,
+0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD4, 0xA1, 0xC0, 0x90, 0x40, 0x60, 0x10, 0x50, 0xF1, 0x22,
+0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x21, 0xA1, 0xD0, 0xF2, 0x50, 0xA0, 0xC0, 0x50, 0xA0, 0x80, 0xF1,
+0x20, 0xF2, 0x21, 0xF2, 0x22, 0xF1, 0x50, 0xA0, 0xF2, 0x23, 0xF3, 0x20, 0xF2, 0xA0, 0x50, 0xF0,
+0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD1, 0xA0, 0x50, 0xD0, 0xF0,
+0xD0, 0xF2, 0xA1, 0xD0, 0xC0, 0x70, 0x80, 0x04, 0x60, 0x01, 0x90, 0x80, 0x90, 0xE0, 0xB1, 0xE0,
+0x07, 0xE0, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x21, 0xF8, 0x50, 0xD0, 0xF2, 0x22, 0xF4,
+0x50, 0xD0, 0x25, 0xF4, 0x50, 0xF0, 0xD0, 0xF2, 0xD0, 0x24, 0xD0, 0xA1, 0xD0, 0xF3, 0x24, 0xF2,
+0xD0, 0x50, 0x10, 0x70, 0x41, 0x02, 0x80, 0x30, 0xA0, 0x10, 0x40, 0x30, 0x10, 0x90, 0x40, 0xB0,
+0x00, 0xE0, 0xB0, 0x04, 0x90, 0x30, 0xB0, 0xE0, 0x70, 0x80, 0xC0, 0x60, 0x01, 0x60, 0xC0, 0x50,
+0xD1, 0x80, 0xC0, 0x70, 0x51, 0xA0, 0xF0, 0x22, 0xF0, 0xD0, 0x30, 0x60, 0x06, 0xE1, 0x05, 0xB0,
+0x30, 0x04, 0x60, 0x90, 0x40, 0x03, 0xE0, 0x40, 0xB0, 0x02, 0xE0, 0xB0, 0x06, 0x40, 0xC0, 0x30,
+0x90, 0x30, 0x01, 0x70, 0x60, 0x80, 0x90, 0x60, 0x01, 0x10, 0xE0, 0x40, 0x60, 0x07, 0x90, 0x30,
+0xC0, 0xD1, 0xF0, 0x22, 0xF0, 0x20, 0xD0, 0x90, 0x06, 0x91, 0x60, 0x80, 0x90, 0x70, 0xE0, 0xB0,
+0x00, 0xB0, 0xE0, 0x31, 0x0E, 0x0F, 0x01, 0x30, 0xE0, 0x00, 0xB0, 0x71, 0x40, 0xE0, 0x40, 0x00,
+0xB0, 0x90, 0x30, 0x0B, 0x90, 0xF1, 0x23, 0xF0, 0x22, 0xF2, 0x20, 0xD2, 0x82, 0x30, 0xE0, 0x10,
+0xA0, 0xD0, 0x23, 0xF1, 0x24, 0xF1, 0x22, 0x50, 0xD0, 0xF0, 0xD2, 0xF0, 0xA0, 0x30, 0x50, 0xA0,
+0x50, 0xF4, 0x20, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0x22, 0xF3, 0x20, 0xF1,
+0x20, 0xF1, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xA1, 0xD0, 0xF3, 0x20,
+0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0xC0, 0x30, 0x70, 0x40, 0x60, 0x90, 0x70, 0xC0, 0x30, 0xB0,
+0xC1, 0x10, 0xC0, 0x00, 0xE0, 0xB0, 0x06, 0x30, 0xA0, 0xD0, 0xF2, 0xA1, 0xD0, 0x21, 0xF6, 0x20,
+0xF0, 0x50, 0xF4, 0x20, 0xF5, 0x50, 0xF0, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x20,
+0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x24, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0xA1,
+0x50, 0x12, 0xC0, 0x80, 0xB0, 0x00, 0xC0, 0xA0, 0x90, 0xC0, 0x70, 0x10, 0xC0, 0x10, 0x60, 0xB0,
+0xE0, 0x05, 0x30, 0xC0, 0x40, 0xB0, 0x40, 0xE0, 0x40, 0x02, 0x30, 0x50, 0xD0, 0x20, 0xD0, 0xA0,
+0x80, 0x60, 0x30, 0xA0, 0xF1, 0x23, 0xD0, 0x90, 0x05, 0xB0, 0x40, 0xB0, 0x06, 0x30, 0xB0, 0x06,
+0x70, 0x01, 0xB0, 0x40, 0x60, 0x05, 0x40, 0x05, 0x80, 0x30, 0x00, 0x60, 0x70, 0x10, 0xE0, 0x00,
+0x40, 0x80, 0x40, 0x60, 0x10, 0x40, 0x60, 0x30, 0xE0, 0x0A, 0x60, 0x91, 0xD0, 0x20, 0xF0, 0x20,
+0xF0, 0x21, 0xD0, 0x90, 0xB0, 0x05, 0xE0, 0x10, 0x80, 0xB0, 0x00, 0x80, 0xB0, 0x0F, 0x05, 0x0F,
+0x01, 0x30, 0x40, 0x01, 0x90, 0x00, 0x70, 0x30, 0x02, 0x90, 0xB0, 0x0A, 0xB0, 0x30, 0xD0, 0xF1,
+0xD1, 0xF0, 0x24, 0xF0, 0xD1, 0x50, 0x30, 0xD0, 0x70, 0x01, 0xE0, 0x90, 0x30, 0xF0, 0xD0, 0xF2,
+0x20, 0xF0, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xA0, 0xF2, 0x20, 0xF2, 0xD0, 0x51, 0xF0, 0xD0, 0x20,
+0xF3, 0x24, 0xF3, 0x21, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF2,
+0x50, 0xF3, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x51, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF1, 0xD0, 0x50,
+0xF0, 0xD0, 0x50, 0xA0, 0x80, 0x10, 0x90, 0x30, 0x80, 0x10, 0x90, 0x70, 0x00, 0x60, 0xE0, 0x10,
+0x00, 0xB0, 0x40, 0x06, 0x70, 0x80, 0xD0, 0xF3, 0x50, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0x21, 0xF0,
+0xA1, 0xF0, 0x20, 0xF8, 0x50, 0xF0, 0x27, 0xF0, 0xD0, 0xA1, 0xF2, 0x26, 0xF1, 0x50, 0xF0, 0x22,
+0xF1, 0x20, 0xF2, 0x20, 0xF1, 0xD0, 0x50, 0xF0, 0xD0, 0x50, 0x15, 0x70, 0xF0, 0xD4, 0xC0, 0x80,
+0xE0, 0x06, 0x90, 0x10, 0xC0, 0x30, 0xE0, 0x03, 0x90, 0x30, 0xD0, 0x20, 0xF0, 0xD0, 0x50, 0x31,
+0xA0, 0x90, 0xA0, 0xF0, 0x21, 0xF1, 0xD0, 0x70, 0x04, 0x60, 0xE0, 0x07, 0xE0, 0x80, 0x07, 0x90,
+0x00, 0x40, 0xE0, 0x07, 0xE0, 0xB0, 0x04, 0x60, 0x80, 0x02, 0x80, 0x70, 0x01, 0x10, 0xC0, 0xB0,
+0x91, 0xB0, 0x0D, 0x30, 0x40, 0x30, 0xD1, 0x21, 0xF1, 0xD0, 0x30, 0xE0, 0x06, 0xC0, 0x40, 0x01,
+0x60, 0x40, 0x02, 0x40, 0x91, 0xB0, 0x0D, 0x0F, 0x02, 0x70, 0xC0, 0x10, 0x60, 0x00, 0x70, 0x11,
+0x30, 0x60, 0xC0, 0x0B, 0x80, 0x50, 0xF0, 0x20, 0xD0, 0xA0, 0x70, 0xA0, 0xF0, 0x22, 0xF1, 0xD0,
+0x80, 0x10, 0xC0, 0xD0, 0x90, 0x02, 0x30, 0x10, 0x51, 0xF0, 0xD0, 0xF2, 0x23, 0xF5, 0x50, 0xF3,
+0xD0, 0x22, 0xF0, 0xD0, 0xF0, 0x51, 0xD0, 0xF2, 0x26, 0xF0, 0x21, 0xF4, 0xA0, 0x50, 0xF3, 0x25,
+0xF3, 0xD0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF0, 0xD0, 0xA1, 0xD0, 0x23, 0xF0, 0x20, 0xF0, 0x21,
+0xF1, 0x50, 0xF0, 0xD6, 0xA1, 0x10, 0xB0, 0x04, 0xE0, 0xB0, 0x04, 0x30, 0x10, 0x70, 0xD0, 0x20,
+0xF0, 0x20, 0xF0, 0xA1, 0xF1, 0x27, 0xF0, 0xA1, 0xF0, 0x23, 0xF5, 0x50, 0xF0, 0x22, 0xF1, 0x22,
+0xF1, 0x50, 0xF2, 0x25, 0xF2, 0xA1, 0xF0, 0x26, 0xF1, 0x21, 0xD0, 0xA1, 0xF1, 0xD2, 0xA0, 0x50,
+0x30, 0x50, 0xD1, 0xF1, 0x20, 0xD1, 0x80, 0x91, 0x40, 0x03, 0x80, 0xB0, 0x10, 0x40, 0xC0, 0xE1,
+0x00, 0x80, 0x30, 0x10, 0x50, 0xD0, 0xF2, 0xD0, 0xA0, 0x70, 0x90, 0xD1, 0xF0, 0x21, 0xF0, 0xD0,
+0x70, 0x90, 0xE0, 0x03, 0x40, 0x60, 0x08, 0x90, 0x08, 0x40, 0x90, 0x0A, 0x40, 0x04, 0x60, 0x80,
+0x03, 0x10, 0xB0, 0x00, 0x40, 0x30, 0xE0, 0x80, 0x10, 0x0E, 0x90, 0x00, 0x80, 0x30, 0xD0, 0xF1,
+0x21, 0xF0, 0xD0, 0x70, 0xB0, 0x05, 0xE0, 0x10, 0x60, 0x90, 0x11, 0x00, 0x80, 0x10, 0x30, 0xE1,
+0x70, 0x0D, 0x0F, 0x00, 0xE0, 0x70, 0x80, 0x01, 0x60, 0x70, 0x30, 0x80, 0x90, 0x11, 0x80, 0x0B,
+0x70, 0xF0, 0x20, 0xF0, 0xD0, 0xC0, 0x10, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0xA0, 0x11, 0xA0, 0xD0,
+0x90, 0x03, 0x40, 0x50, 0xF0, 0x51, 0xA0, 0xD0, 0xF2, 0x21, 0xF4, 0xA1, 0xD0, 0x21, 0xF0, 0x23,
+0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF3, 0x26, 0xF0, 0x24, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x24,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0xA1, 0xD0, 0x24, 0xD0, 0xA0, 0x50, 0xF0, 0x25, 0xF0, 0x23,
+0xF1, 0x50, 0xD0, 0xA0, 0x24, 0xD1, 0x70, 0xE0, 0x05, 0x40, 0x04, 0x91, 0xC0, 0xD1, 0xF0, 0x20,
+0xF0, 0xA1, 0xF1, 0x27, 0xF1, 0x50, 0xF0, 0x23, 0xF5, 0x50, 0xF0, 0x22, 0xF1, 0x21, 0xF1, 0xD0,
+0x51, 0xF0, 0xD0, 0xF1, 0x22, 0xF3, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF1,
+0x50, 0xF1, 0x21, 0xF1, 0x20, 0xD2, 0xF5, 0xD0, 0x80, 0xC0, 0x90, 0xC0, 0x80, 0xE0, 0x60, 0xE0,
+0xC0, 0x30, 0xC0, 0x00, 0x30, 0x90, 0x00, 0x40, 0x90, 0xE0, 0xC0, 0xD3, 0xF0, 0x50, 0xA1, 0xF0,
+0xA0, 0xF1, 0x20, 0xF1, 0xA0, 0x30, 0x03, 0x60, 0xE0, 0x09, 0x80, 0xE0, 0x06, 0x60, 0x40, 0x00,
+0x60, 0x90, 0x09, 0xE0, 0xB0, 0x04, 0x70, 0x03, 0x40, 0x90, 0x61, 0x91, 0x00, 0x91, 0x0D, 0x40,
+0xE0, 0x00, 0x90, 0x30, 0xD0, 0xF3, 0xD0, 0x50, 0x80, 0x05, 0xB0, 0x70, 0x11, 0x30, 0x80, 0x30,
+0x90, 0x03, 0x90, 0xB0, 0x0C, 0x0E, 0xB0, 0xC0, 0x60, 0x90, 0x80, 0x02, 0x30, 0x01, 0xB0, 0xC0,
+0xB0, 0xE1, 0xB0, 0x07, 0x60, 0x30, 0xD0, 0x20, 0xF0, 0xD0, 0xC1, 0xD0, 0x21, 0xF1, 0x21, 0xA0,
+0x10, 0x80, 0xD0, 0xA0, 0x30, 0x03, 0x30, 0xA0, 0xD0, 0xF0, 0x20, 0xA0, 0x50, 0xA0, 0xF0, 0xD0,
+0xF1, 0x20, 0xF3, 0x50, 0xD0, 0xF1, 0x26, 0xF4, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0x21,
+0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xA1, 0xF2, 0x23, 0xF0, 0x23, 0xD0, 0xF0, 0xA0, 0x50,
+0xD0, 0xF1, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x25, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xA0, 0x50,
+0x10, 0xF0, 0x23, 0xF0, 0xD0, 0xA0, 0x30, 0x05, 0x61, 0x04, 0x80, 0x70, 0x50, 0x90, 0xF1, 0x20,
+0xD0, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x23, 0xF5, 0x50, 0xF1, 0x20,
+0xF0, 0x20, 0xF0, 0x21, 0xD1, 0xA0, 0x50, 0x70, 0x90, 0xD1, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0x20, 0xD0, 0x50, 0xA0, 0xF0, 0x23, 0xF2, 0x20, 0xF6, 0x50,
+0xF0, 0x70, 0x10, 0x40, 0x70, 0xC0, 0x70, 0x10, 0x01, 0x30, 0x80, 0xE0, 0x90, 0x00, 0xE0, 0x80,
+0xE0, 0xC0, 0x70, 0x80, 0x30, 0x51, 0xA0, 0xD1, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x30,
+0x60, 0x02, 0x40, 0x60, 0x0A, 0x90, 0x05, 0xB0, 0x40, 0x60, 0x02, 0x80, 0x90, 0x09, 0x40, 0x00,
+0xB0, 0x40, 0x90, 0x70, 0x80, 0x02, 0xB0, 0xE0, 0x30, 0xB0, 0x00, 0xE0, 0x70, 0x40, 0xC0, 0x30,
+0x0D, 0x60, 0x80, 0x01, 0xC0, 0xA0, 0xD0, 0xF0, 0x22, 0xD0, 0x70, 0x03, 0x60, 0x40, 0xE0, 0x40,
+0x70, 0x02, 0x10, 0xE0, 0x01, 0xB0, 0x90, 0x30, 0x0D, 0x0E, 0x40, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+0x91, 0x02, 0xC0, 0x02, 0x60, 0x41, 0xB0, 0x04, 0x70, 0xA0, 0xF1, 0xD1, 0x90, 0x70, 0xD0, 0x21,
+0xF1, 0x22, 0x50, 0xF0, 0xD0, 0x50, 0x40, 0x03, 0x70, 0xD0, 0x20, 0xF1, 0xD0, 0xF0, 0xA0, 0x50,
+0xA0, 0xF2, 0x20, 0xF1, 0xA1, 0xF0, 0x20, 0xF1, 0x25, 0xF2, 0x20, 0xF2, 0x51, 0xF0, 0xD0, 0xF1,
+0x23, 0xF3, 0x22, 0xF2, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x23, 0xF2, 0x21, 0xF0, 0xD0, 0xA0, 0x50,
+0xD0, 0xF1, 0x20, 0x50, 0xD0, 0xF4, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xD0, 0x80, 0x50,
+0xD0, 0xF2, 0x21, 0xD0, 0xC0, 0x40, 0x06, 0x40, 0x03, 0xB0, 0x10, 0x60, 0x30, 0x81, 0xD0, 0xF1,
+0xA1, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x23, 0xF2, 0x20, 0xF1,
+0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0x71, 0x90, 0x71, 0x10, 0xA0, 0xD2, 0xF3, 0xA1,
+0xD0, 0x20, 0xF4, 0x22, 0xF2, 0x50, 0xD1, 0x22, 0xF0, 0xA1, 0x20, 0xF0, 0x20, 0xF4, 0xA1, 0xD1,
+0xA0, 0xC1, 0x00, 0x31, 0x02, 0x30, 0x11, 0x90, 0x60, 0x10, 0x50, 0x40, 0x70, 0x10, 0x70, 0x80,
+0x90, 0x50, 0xD1, 0x50, 0xC0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x80, 0x60, 0x00, 0xB0, 0x40, 0xB0,
+0x0A, 0x90, 0x05, 0x40, 0xE0, 0x05, 0x80, 0x90, 0x08, 0xE0, 0x30, 0x10, 0xC0, 0x40, 0x80, 0x01,
+0x60, 0x40, 0x60, 0x00, 0x40, 0x80, 0x00, 0xE1, 0x90, 0x10, 0xB0, 0x0E, 0x30, 0x01, 0xB0, 0x70,
+0xD0, 0xF1, 0x21, 0xD0, 0x50, 0x40, 0xB0, 0x40, 0xE0, 0x60, 0x02, 0x10, 0x02, 0x71, 0x90, 0xC0,
+0x10, 0x40, 0x00, 0xE0, 0x0C, 0x0E, 0xB0, 0x10, 0xB0, 0x00, 0x30, 0xE0, 0x31, 0x80, 0x31, 0x90,
+0x40, 0x05, 0xE0, 0x40, 0xE0, 0x01, 0xC0, 0x10, 0x60, 0xD0, 0x50, 0x10, 0x90, 0x70, 0x90, 0xD0,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0x90, 0x03, 0xB0, 0x90, 0xD0, 0xF1, 0x23,
+0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x27, 0xF3, 0x20, 0xD0, 0x20,
+0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20,
+0xF0, 0x23, 0xF1, 0x21, 0xF1, 0x50, 0xF1, 0x50, 0xD0, 0xF1, 0x22, 0xF3, 0x26, 0xD0, 0x80, 0x50,
+0xA0, 0xF1, 0x22, 0xF0, 0xA0, 0xC0, 0x30, 0x04, 0x60, 0xB0, 0xE0, 0x02, 0x60, 0x30, 0xD0, 0x50,
+0x31, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0xF1, 0x27, 0xF0, 0x50, 0x22, 0xF2, 0x20, 0xD0, 0x10, 0x70, 0x40, 0xC0, 0x10, 0xC0, 0x90, 0x10,
+0xC0, 0x51, 0xD3, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xC0, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF0,
+0x21, 0xF4, 0xC0, 0x70, 0xD0, 0x20, 0xF0, 0x22, 0xA1, 0xD3, 0xA0, 0xC0, 0x30, 0x70, 0x04, 0x30,
+0x00, 0x40, 0x30, 0x40, 0x90, 0x40, 0x60, 0xE0, 0x91, 0xA0, 0x10, 0xF1, 0x10, 0x71, 0x90, 0x10,
+0xD1, 0x70, 0x00, 0xE1, 0x0B, 0xE0, 0x80, 0x03, 0xE0, 0x40, 0x08, 0x60, 0x10, 0xC0, 0x81, 0x60,
+0x40, 0x01, 0x80, 0x70, 0x80, 0x01, 0x60, 0x80, 0x60, 0x40, 0x60, 0x03, 0x81, 0x60, 0x90, 0x00,
+0x80, 0x30, 0x0E, 0x70, 0x02, 0x60, 0x70, 0xD1, 0xF0, 0xD0, 0xA1, 0x90, 0x60, 0x05, 0x33, 0x80,
+0xE0, 0x60, 0xB0, 0x01, 0x30, 0x40, 0x80, 0x0B, 0x0F, 0x00, 0x60, 0x01, 0xB0, 0xC0, 0x91, 0x02,
+0xC0, 0x08, 0xB0, 0xE0, 0x40, 0x70, 0x90, 0x80, 0x70, 0xC0, 0x80, 0x10, 0x80, 0xC0, 0xD0, 0xF0,
+0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x70, 0x03, 0x40, 0x50, 0xF2, 0x23, 0xF0, 0xD0, 0xF0,
+0xA0, 0x50, 0xA0, 0xD0, 0xA1, 0xF3, 0x20, 0xF0, 0x28, 0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF0, 0x20, 0xF5, 0x24, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xF3, 0x20, 0xF1, 0x21, 0xF1, 0x20,
+0xF1, 0x51, 0xD0, 0xF2, 0x20, 0xF4, 0x25, 0xF0, 0xD0, 0xF0, 0xD1, 0x50, 0xF2, 0x22, 0xD1, 0x90,
+0x70, 0x03, 0x10, 0x00, 0xE0, 0xB0, 0x01, 0xB0, 0x30, 0xD1, 0x71, 0xD0, 0xF1, 0xD0, 0x50, 0xF2,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF2, 0x24, 0xF1, 0x50, 0x21, 0xF0, 0x20, 0xF1,
+0xD0, 0x80, 0x10, 0x40, 0x30, 0x40, 0x03, 0x30, 0x12, 0x80, 0xA0, 0x50, 0xA0, 0xF0, 0x20, 0xF5,
+0x22, 0xD0, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0xD0, 0x50, 0xD0, 0xF0, 0x50, 0xD0,
+0xA1, 0xD0, 0xF1, 0x30, 0x70, 0xA0, 0x90, 0x30, 0x0A, 0x70, 0x51, 0xA0, 0xD0, 0xF0, 0x30, 0xC0,
+0xA0, 0xD0, 0x90, 0x02, 0x80, 0x90, 0x10, 0x70, 0x90, 0x0D, 0x90, 0x02, 0x60, 0x40, 0xB0, 0x0A,
+0x80, 0xB0, 0xE0, 0x70, 0x80, 0xE0, 0x30, 0x70, 0xC0, 0x00, 0x60, 0xB0, 0x00, 0x40, 0x80, 0xB0,
+0x06, 0x10, 0xE0, 0xC0, 0x90, 0x60, 0x0F, 0x00, 0x30, 0x03, 0x40, 0x10, 0xA1, 0x50, 0xA0, 0xF0,
+0x81, 0x05, 0xB0, 0x70, 0x02, 0x90, 0x03, 0x81, 0x40, 0x0B, 0x0F, 0x04, 0x30, 0x90, 0x80, 0x01,
+0x60, 0x70, 0x0C, 0x90, 0x30, 0xE0, 0x01, 0x90, 0x40, 0x10, 0x50, 0xF1, 0x20, 0xF1, 0x20, 0xF1,
+0xD0, 0xF0, 0x90, 0x03, 0x30, 0xD1, 0xF1, 0x24, 0xF1, 0xD1, 0xA0, 0x51, 0xF0, 0xD1, 0xF1, 0x26,
+0xF1, 0x22, 0xF3, 0x20, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF5, 0x50, 0xA0, 0xF4, 0x25, 0xF0, 0x51, 0xA0, 0xD0, 0xF0, 0x21, 0xF5, 0x24, 0xF5, 0x50,
+0xF4, 0x20, 0xD1, 0x50, 0x90, 0xB0, 0x00, 0xB0, 0x10, 0xB0, 0x00, 0xE0, 0x01, 0xE0, 0x90, 0xD0,
+0xF0, 0xA0, 0x50, 0xF3, 0xA1, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xA1, 0xF4, 0x21,
+0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x21, 0xD0, 0x70, 0x10, 0xB0, 0xE0, 0x05, 0x60, 0xE0, 0x12, 0x90,
+0xE0, 0xD0, 0x22, 0xF2, 0x22, 0xF1, 0x50, 0xF2, 0x21, 0xF0, 0xA0, 0xD0, 0xF0, 0xD1, 0x90, 0xC0,
+0x30, 0x90, 0x82, 0x30, 0x70, 0xC0, 0x70, 0xB0, 0x11, 0x90, 0x60, 0x08, 0x60, 0xC0, 0x40, 0x50,
+0xA0, 0xD3, 0xF0, 0xD0, 0x90, 0x80, 0x02, 0x70, 0x90, 0x60, 0x30, 0xB0, 0x0C, 0x30, 0xB1, 0x40,
+0x60, 0x0F, 0x00, 0x80, 0x60, 0x00, 0xB0, 0x10, 0x01, 0xB0, 0x80, 0xE0, 0x30, 0xB0, 0x07, 0x40,
+0x10, 0x70, 0x60, 0x70, 0x0F, 0x00, 0x90, 0x03, 0x60, 0x31, 0xF1, 0xD2, 0x90, 0x60, 0x05, 0x10,
+0x02, 0x90, 0x04, 0x60, 0x0C, 0x0F, 0x05, 0x40, 0x70, 0x30, 0x60, 0x80, 0x40, 0x0B, 0xE0, 0x10,
+0xE0, 0x60, 0xE0, 0x60, 0x30, 0x40, 0x10, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xD0, 0x50, 0x80,
+0x03, 0x90, 0xD0, 0xF0, 0x20, 0xF5, 0x21, 0xF1, 0xD0, 0xA0, 0x52, 0xF0, 0xD1, 0xF0, 0x25, 0xF1,
+0x22, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x51, 0xF0, 0xD0, 0xF1, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF2,
+0xA0, 0x50, 0xF4, 0x23, 0xF0, 0xA1, 0xD0, 0xA1, 0x20, 0xF1, 0x20, 0xF2, 0x20, 0xF1, 0x22, 0xF1,
+0xD0, 0xF2, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xD0, 0x80, 0x70, 0x40, 0x11, 0x40,
+0x30, 0x70, 0xB0, 0x00, 0x10, 0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF2, 0x20, 0xF0,
+0x20, 0xF0, 0x21, 0xF1, 0x50, 0xD0, 0xF3, 0x21, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0xD3, 0x70, 0x10,
+0x40, 0xE0, 0x07, 0x60, 0x30, 0x10, 0x70, 0xC0, 0xD1, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xA1, 0xD0,
+0xF1, 0x20, 0xF0, 0x50, 0xC0, 0x30, 0xD0, 0xF0, 0xD0, 0xA0, 0xC0, 0x10, 0x60, 0x30, 0xC0, 0xE0,
+0x60, 0x03, 0xB0, 0x30, 0x80, 0x90, 0x08, 0x80, 0x90, 0xA0, 0xD0, 0xA1, 0xF0, 0xD1, 0xF0, 0xD0,
+0x92, 0x40, 0x00, 0xE0, 0xB0, 0x01, 0x70, 0x0C, 0x60, 0x30, 0x40, 0x0F, 0x02, 0xB0, 0x30, 0x03,
+0x40, 0xE0, 0x40, 0x00, 0x41, 0x08, 0x40, 0x10, 0xB0, 0x71, 0xB0, 0x0D, 0x40, 0xE0, 0xB0, 0x41,
+0x60, 0x00, 0x70, 0xD1, 0x21, 0xD0, 0xF0, 0x70, 0x05, 0x80, 0xE1, 0x90, 0x70, 0x60, 0x0F, 0x02,
+0x0F, 0x05, 0x30, 0x01, 0x40, 0x10, 0xB0, 0x0B, 0x40, 0x10, 0x03, 0x30, 0x90, 0x80, 0xD2, 0xF0,
+0x21, 0xF2, 0xD0, 0x30, 0xE0, 0x03, 0x70, 0xD0, 0x20, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0x50, 0xD1,
+0xF0, 0x51, 0xA0, 0xD1, 0xF1, 0x23, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x22, 0xD0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF1, 0x21, 0xF4, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF2, 0xD0, 0xA1,
+0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0x20, 0xD0, 0xA0, 0x23,
+0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x23, 0xF0, 0xA0, 0xC1, 0xA0, 0xD0, 0x80, 0x10, 0x80, 0xE0, 0xB0,
+0x90, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x20,
+0xF1, 0x50, 0xF4, 0x21, 0xF2, 0x50, 0xF0, 0xD1, 0x30, 0x91, 0x80, 0x10, 0x90, 0x00, 0xE0, 0x0A,
+0x80, 0x10, 0x70, 0xD2, 0x20, 0xF2, 0x20, 0xF1, 0x50, 0xD1, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xD0,
+0xA0, 0x10, 0xC0, 0x30, 0xB0, 0x80, 0x60, 0x91, 0xE0, 0x02, 0x30, 0xA0, 0x90, 0x30, 0x07, 0x81,
+0x60, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0x21, 0xD0, 0xC0, 0x01, 0x80, 0x70, 0x03, 0xE0, 0x90, 0x60,
+0x09, 0xE1, 0x30, 0x80, 0x91, 0x70, 0x0F, 0x00, 0x90, 0x60, 0xB0, 0x40, 0xE0, 0x02, 0x40, 0xB0,
+0x80, 0x09, 0x41, 0x70, 0x80, 0x90, 0x0C, 0xB0, 0x40, 0x80, 0x60, 0x03, 0x40, 0xC0, 0xD0, 0xF0,
+0x21, 0xD0, 0xA0, 0x70, 0x04, 0x60, 0x10, 0xE0, 0x00, 0xB0, 0x30, 0x0F, 0x02, 0x0F, 0x05, 0x30,
+0x01, 0xB0, 0x90, 0x0A, 0x10, 0x62, 0x03, 0x10, 0x70, 0x80, 0xA0, 0x50, 0xA0, 0x21, 0xF4, 0x70,
+0x04, 0x70, 0xD0, 0xF1, 0x21, 0xF3, 0x22, 0xF0, 0xA1, 0xF4, 0x51, 0xA0, 0xD0, 0xF5, 0x25, 0xF1,
+0x24, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF6, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x51, 0xF0,
+0xD0, 0xF3, 0x50, 0xF0, 0x22, 0xD0, 0xA0, 0x50, 0xF4, 0x22, 0xF2, 0xD0, 0x20, 0xC0, 0xA0, 0xF0,
+0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x23, 0xD0, 0xA0, 0xD0, 0xF0, 0xD1, 0x70, 0x00, 0x40, 0x70,
+0x40, 0xD0, 0xF0, 0x21, 0xF0, 0x24, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0x50, 0xF2, 0x24, 0xF1, 0x50, 0xD0, 0xA0, 0x11, 0x41, 0x10, 0xC0, 0x00, 0xB0, 0xE0, 0x09, 0xE1,
+0x12, 0x30, 0x80, 0xD0, 0xF3, 0xD0, 0xA0, 0x80, 0x31, 0xF2, 0x23, 0xF0, 0x20, 0xD1, 0x10, 0x90,
+0x12, 0x70, 0x10, 0x80, 0xC0, 0x01, 0x40, 0x90, 0x50, 0x90, 0xE0, 0x05, 0xB0, 0x40, 0x00, 0x30,
+0x10, 0x50, 0xD0, 0xF0, 0x80, 0xF3, 0x70, 0x00, 0xE0, 0x60, 0xE0, 0x80, 0xE0, 0x80, 0x70, 0x30,
+0x80, 0xC0, 0x07, 0x60, 0x40, 0xB0, 0xE0, 0x90, 0x03, 0x70, 0xE0, 0x0D, 0x60, 0x30, 0x60, 0x04,
+0xE1, 0x80, 0x09, 0xE0, 0x10, 0x41, 0x30, 0x60, 0x09, 0x60, 0x40, 0x60, 0x80, 0xE0, 0x05, 0x90,
+0xD0, 0x23, 0xD0, 0x50, 0x30, 0x04, 0x70, 0x02, 0x30, 0x0F, 0x02, 0x0F, 0x04, 0x40, 0x30, 0x60,
+0x00, 0x80, 0x40, 0x09, 0x30, 0x10, 0xB0, 0x06, 0x70, 0x50, 0xD0, 0x20, 0xA0, 0x51, 0xA0, 0xF0,
+0xD1, 0x31, 0x03, 0x60, 0x90, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0,
+0x50, 0xF2, 0x21, 0xF2, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x26, 0xF3, 0x20, 0xF1, 0x20, 0xF2,
+0xA0, 0x50, 0xF0, 0xD0, 0xF5, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x50,
+0xF1, 0x22, 0xF2, 0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xA0, 0x50, 0x22, 0xF3, 0xA1,
+0xF2, 0x20, 0xF1, 0xD0, 0xF1, 0xD0, 0x30, 0x40, 0x00, 0x10, 0x90, 0xE0, 0xD0, 0x20, 0xF0, 0x21,
+0xF0, 0x22, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x24, 0xF2, 0x51,
+0x11, 0x00, 0xC0, 0x11, 0x40, 0x00, 0xB0, 0x60, 0x09, 0xE0, 0xB0, 0x11, 0x90, 0x70, 0x10, 0x70,
+0xD0, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0x10, 0x80, 0x30, 0xC0, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF1,
+0xD0, 0x50, 0x30, 0x90, 0x70, 0xC0, 0x11, 0x40, 0xC0, 0x70, 0x60, 0x10, 0x90, 0xA0, 0xC1, 0x60,
+0x03, 0x60, 0xE0, 0x01, 0xB0, 0x91, 0xD1, 0x90, 0x50, 0xD0, 0xF0, 0xD0, 0x90, 0x40, 0xB0, 0x01,
+0x40, 0x80, 0xE0, 0x01, 0xB0, 0x80, 0x91, 0x40, 0x02, 0xB0, 0x40, 0x60, 0x01, 0x90, 0x05, 0x30,
+0x80, 0x0A, 0x60, 0x40, 0xB0, 0x30, 0xB0, 0x04, 0xB0, 0x40, 0x80, 0x0A, 0x30, 0x10, 0x80, 0xB0,
+0x80, 0x06, 0xB0, 0x40, 0xE0, 0xB0, 0x01, 0x60, 0x40, 0x05, 0x40, 0x80, 0xD0, 0x22, 0xF0, 0xD0,
+0x30, 0x40, 0x03, 0x30, 0xE0, 0x00, 0xE0, 0x70, 0x60, 0x0F, 0x01, 0x0F, 0x04, 0x30, 0x60, 0x80,
+0x30, 0x10, 0x0A, 0x40, 0xB0, 0x07, 0x70, 0xF1, 0x21, 0xD0, 0xF0, 0xA0, 0x51, 0xD0, 0x70, 0x04,
+0x31, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xD0, 0xF1, 0x23, 0xF2,
+0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xF2,
+0xD0, 0xF0, 0x50, 0xA0, 0xD1, 0xF1, 0x26, 0xF4, 0x50, 0xA0, 0xD0, 0x50, 0xA0, 0xF1, 0x20, 0xF0,
+0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xF4, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x21, 0xF1, 0x20,
+0xF1, 0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x70, 0x40, 0x30, 0x00, 0x70, 0xA0, 0xD4,
+0xF1, 0x21, 0xF0, 0xD0, 0xA1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xF0, 0x25, 0xF1,
+0x50, 0x10, 0x90, 0x40, 0x90, 0x00, 0x90, 0xC0, 0xB0, 0x00, 0x60, 0xB0, 0x08, 0x61, 0x00, 0x60,
+0x30, 0xC0, 0x12, 0x30, 0xD0, 0xF0, 0xD0, 0x50, 0xA0, 0x10, 0x01, 0x70, 0xA0, 0xD0, 0x23, 0xF1,
+0xD0, 0xA1, 0xD2, 0x70, 0x90, 0x10, 0x70, 0x80, 0x40, 0x11, 0x90, 0x50, 0xA0, 0xC0, 0xB0, 0x60,
+0xE0, 0x81, 0x30, 0x02, 0x70, 0xE0, 0x40, 0x50, 0xD0, 0x10, 0x90, 0xA0, 0xD0, 0x50, 0x30, 0x0C,
+0x40, 0x90, 0x60, 0xE1, 0x02, 0x80, 0x40, 0x06, 0x40, 0x70, 0x07, 0x60, 0x40, 0x60, 0x01, 0x60,
+0x80, 0x05, 0x40, 0x90, 0x0B, 0x11, 0x00, 0x80, 0xB0, 0x02, 0xB0, 0x40, 0xE0, 0x60, 0x04, 0x81,
+0x06, 0x70, 0xD0, 0xF4, 0xD0, 0x70, 0x03, 0x60, 0xC0, 0x30, 0x41, 0x80, 0x0F, 0x01, 0x0F, 0x04,
+0x90, 0x02, 0xC0, 0x0F, 0x05, 0x90, 0xF3, 0x20, 0xF0, 0xD2, 0x30, 0x40, 0xE0, 0x02, 0x40, 0x70,
+0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xD1, 0x50, 0xF1, 0x20, 0xF1, 0x22, 0xF1, 0x20, 0xF1,
+0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x22, 0xF4, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF3, 0x21, 0xF0, 0x24, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF3, 0xD0,
+0xA0, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xD0, 0xF0,
+0x50, 0xF3, 0x21, 0xF1, 0xD0, 0x70, 0xC1, 0x10, 0x90, 0xA0, 0xF0, 0x50, 0xC0, 0xE0, 0xA1, 0xD1,
+0xF2, 0xA1, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0xA1, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0xD1, 0x70, 0x13,
+0x00, 0x10, 0xC0, 0x30, 0x00, 0xE0, 0x09, 0x40, 0x02, 0x60, 0x70, 0x11, 0x60, 0xC0, 0xD0, 0xF0,
+0xA1, 0x40, 0x10, 0x01, 0x81, 0xD0, 0x20, 0xF0, 0x20, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0,
+0xF0, 0xD0, 0x90, 0x10, 0x70, 0x00, 0x80, 0x90, 0x80, 0xD0, 0x10, 0x50, 0xD0, 0x70, 0x00, 0x10,
+0x70, 0x90, 0x80, 0x10, 0x40, 0x01, 0x70, 0x00, 0xB0, 0x30, 0xD0, 0x30, 0x53, 0x30, 0x0D, 0x60,
+0x80, 0x30, 0x02, 0x70, 0x90, 0xE0, 0x08, 0xC0, 0x60, 0x03, 0xE0, 0x40, 0xB0, 0x04, 0x90, 0x05,
+0xB0, 0x70, 0x0C, 0xB0, 0x10, 0x30, 0x40, 0x00, 0xE0, 0x40, 0xE0, 0x03, 0x80, 0x10, 0x40, 0x00,
+0x70, 0x07, 0x30, 0xA0, 0xF0, 0x21, 0xF1, 0xD0, 0x80, 0x40, 0x03, 0xC0, 0x02, 0x90, 0x0F, 0x01,
+0x0F, 0x03, 0xE0, 0x80, 0x01, 0x40, 0x30, 0x0F, 0x05, 0x90, 0xD0, 0xF1, 0x20, 0xF0, 0xD0, 0xA0,
+0x30, 0x50, 0x10, 0x00, 0xB0, 0xE1, 0x41, 0x30, 0xD1, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF0,
+0x50, 0xD0, 0x23, 0xF0, 0x24, 0xF2, 0xD0, 0xA0, 0x51, 0xF1, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF1,
+0x22, 0xF3, 0xD1, 0xA0, 0x50, 0xF2, 0x21, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x50, 0xF2, 0x20, 0xF1,
+0x20, 0xF5, 0xA0, 0x50, 0xF2, 0x21, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xD0,
+0xF0, 0x50, 0xD0, 0xF1, 0xD0, 0x21, 0xD0, 0x90, 0x80, 0xD1, 0x50, 0xA0, 0xD0, 0xA0, 0x70, 0xB0,
+0x90, 0x70, 0xC1, 0x50, 0xD1, 0xF1, 0x50, 0xF0, 0x20, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x50,
+0xF5, 0xD0, 0xA0, 0x90, 0x70, 0xE0, 0x11, 0xE0, 0x30, 0xC0, 0x40, 0x90, 0x00, 0x40, 0x09, 0x40,
+0x04, 0x30, 0xC0, 0x00, 0x90, 0xA0, 0xD0, 0x51, 0xC0, 0x10, 0x01, 0xE0, 0x30, 0xD0, 0x20, 0xF0,
+0xD0, 0xF2, 0x50, 0xF1, 0x20, 0xF0, 0xD1, 0x10, 0xE0, 0x30, 0x00, 0x70, 0xD1, 0x30, 0x50, 0xD0,
+0x11, 0x80, 0xA0, 0xD2, 0x32, 0x40, 0x00, 0xC1, 0xA0, 0xD0, 0x30, 0xF0, 0x50, 0x40, 0x30, 0x0B,
+0x60, 0x40, 0xB0, 0x00, 0x40, 0x31, 0xC0, 0x60, 0xB0, 0x80, 0x09, 0x90, 0x01, 0xE0, 0x40, 0xB0,
+0x06, 0x30, 0x05, 0xB0, 0x80, 0x0D, 0x40, 0xC0, 0x90, 0x40, 0x02, 0xB0, 0x11, 0x00, 0x40, 0x70,
+0xC0, 0xE0, 0x80, 0x07, 0xE0, 0x80, 0xD0, 0x23, 0xF0, 0xD0, 0x90, 0x03, 0x90, 0xE0, 0x01, 0x30,
+0x60, 0x0F, 0x00, 0x0F, 0x03, 0x30, 0x80, 0x90, 0x40, 0x70, 0xB0, 0x0F, 0x04, 0x60, 0x90, 0xD0,
+0xF0, 0x21, 0xF0, 0xD0, 0x70, 0xE0, 0x10, 0x90, 0x02, 0x40, 0x80, 0x60, 0x30, 0xF1, 0xD0, 0xF0,
+0x21, 0xF0, 0x21, 0xF2, 0xA1, 0xF1, 0x24, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xA0, 0x51,
+0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF4, 0x20, 0xF1, 0x51, 0xF0, 0xD0, 0xF0, 0x26,
+0xF1, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF6, 0x20, 0xD1, 0xF0, 0x50, 0xF1, 0xD0, 0x20, 0xF1, 0xA0,
+0x50, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x20, 0xA0, 0x20, 0xF0,
+0xD0, 0x71, 0xD1, 0xC0, 0x70, 0x90, 0x40, 0x30, 0x03, 0x40, 0x90, 0xC0, 0xD0, 0xF1, 0xA1, 0xD0,
+0x20, 0xF0, 0x23, 0xF1, 0x50, 0xF1, 0xD1, 0xA0, 0xD0, 0x90, 0x80, 0x30, 0x70, 0x80, 0xC0, 0x10,
+0x40, 0x10, 0x70, 0x90, 0x01, 0xE0, 0x08, 0xE0, 0xB0, 0x07, 0xC0, 0xA1, 0xF0, 0x80, 0x12, 0x40,
+0x70, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x70, 0xC0,
+0x10, 0x80, 0x90, 0xA0, 0xD0, 0xF2, 0xA0, 0x51, 0xF2, 0xD1, 0x90, 0x30, 0x01, 0x40, 0xB0, 0x90,
+0xD0, 0x90, 0xD0, 0xA0, 0x80, 0x30, 0x09, 0xB0, 0x40, 0x60, 0x03, 0xB1, 0x60, 0x01, 0x90, 0x09,
+0x81, 0xE0, 0x09, 0x30, 0x06, 0x80, 0x60, 0x0A, 0x60, 0x40, 0x60, 0x80, 0x10, 0x70, 0xB0, 0x01,
+0xB0, 0x10, 0x60, 0x00, 0x90, 0xE0, 0x90, 0xC0, 0x10, 0x07, 0xB0, 0x90, 0xD0, 0x20, 0xF0, 0x20,
+0xF1, 0xD0, 0x30, 0x60, 0x02, 0xE0, 0x90, 0x80, 0x90, 0x30, 0x80, 0x0F, 0x00, 0x0F, 0x03, 0x90,
+0x01, 0xE0, 0x10, 0x0F, 0x05, 0xB0, 0x90, 0xD0, 0x22, 0xF0, 0xD0, 0x90, 0x00, 0x10, 0x60, 0x01,
+0x60, 0x90, 0x01, 0x30, 0xA0, 0x51, 0x20, 0xF5, 0x20, 0xF0, 0x50, 0xD0, 0xF1, 0x25, 0xF1, 0x21,
+0xF2, 0x20, 0xF1, 0xD0, 0xA0, 0x51, 0x20, 0xD0, 0xF7, 0x21, 0xF1, 0x23, 0xF0, 0xD0, 0xF0, 0x50,
+0xA0, 0xF2, 0x22, 0xF2, 0xA1, 0xD0, 0x20, 0xF0, 0x20, 0xF4, 0x22, 0xF4, 0x50, 0xA0, 0xF2, 0xD0,
+0x30, 0x70, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xA2, 0x90, 0xD0, 0xF0, 0xD0, 0x80,
+0x90, 0xD0, 0x50, 0x10, 0x00, 0xC0, 0x10, 0x30, 0x04, 0xB0, 0x10, 0xD0, 0xF2, 0x50, 0xD0, 0xF0,
+0x24, 0xF1, 0xA0, 0xF0, 0xD1, 0x30, 0x10, 0x50, 0x11, 0x91, 0x70, 0x11, 0x40, 0x30, 0x10, 0x70,
+0x90, 0x70, 0x60, 0x08, 0x40, 0x07, 0xB0, 0xC0, 0xD0, 0x50, 0xD0, 0xF0, 0x90, 0xC0, 0x90, 0x10,
+0xA0, 0xD0, 0xF1, 0x21, 0xD0, 0x50, 0xA0, 0xD0, 0x24, 0xD1, 0x50, 0x30, 0x10, 0xC0, 0x50, 0xD0,
+0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x70, 0x04, 0x40, 0x70, 0x30, 0xD1, 0x50,
+0x40, 0x08, 0xE1, 0x0A, 0x80, 0x60, 0x06, 0xB0, 0x40, 0xE0, 0x30, 0x0A, 0x70, 0x60, 0x05, 0xB0,
+0x80, 0x07, 0xB0, 0xE0, 0x40, 0x60, 0x02, 0x80, 0x11, 0xB0, 0x60, 0x02, 0xB0, 0x10, 0xC0, 0x40,
+0x71, 0xE0, 0x07, 0x30, 0xA0, 0xF1, 0x22, 0xD0, 0x50, 0x80, 0x03, 0x10, 0xB0, 0x01, 0x30, 0x0F,
+0x00, 0x0F, 0x02, 0xB0, 0x80, 0x01, 0xB0, 0x90, 0x0F, 0x05, 0xE0, 0x80, 0xD0, 0xF1, 0x20, 0xF0,
+0xD0, 0x71, 0x40, 0x01, 0xB0, 0x70, 0x01, 0x60, 0x30, 0xD0, 0xF0, 0x20, 0xA0, 0x50, 0xA1, 0xD0,
+0xF2, 0x20, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x26, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x51,
+0xA0, 0xD0, 0xF2, 0x20, 0xF2, 0x20, 0xF0, 0x25, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x20,
+0xD1, 0x50, 0xF5, 0x28, 0xF3, 0x50, 0xA0, 0xD1, 0xF0, 0xA0, 0xF0, 0xD0, 0x20, 0xF2, 0x23, 0xF0,
+0x20, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD2, 0x50, 0x30, 0x00, 0x40, 0x10, 0x90, 0x60,
+0x04, 0x10, 0x30, 0xD0, 0x20, 0xD0, 0x50, 0xF2, 0x23, 0xF0, 0xD0, 0xA0, 0x80, 0x90, 0xC0, 0x11,
+0xA0, 0x70, 0x11, 0x90, 0xC0, 0x11, 0x31, 0x40, 0x80, 0x10, 0xC0, 0x40, 0x70, 0xC0, 0x30, 0x04,
+0xB0, 0xE0, 0x07, 0x10, 0x90, 0xA0, 0xF2, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0xA1,
+0xD0, 0xF0, 0x23, 0xF1, 0xD2, 0x91, 0xF3, 0xA1, 0xD0, 0xF1, 0x20, 0xF1, 0xA0, 0xC0, 0x06, 0x90,
+0xA0, 0xD0, 0xA0, 0x30, 0x06, 0x60, 0x40, 0xB0, 0x0B, 0xB0, 0x80, 0x04, 0x60, 0x40, 0xE0, 0x01,
+0x80, 0xE0, 0x09, 0xE0, 0x70, 0x05, 0x40, 0x30, 0x04, 0xB0, 0xE0, 0x40, 0xE0, 0x06, 0x40, 0x10,
+0xC1, 0x80, 0x01, 0x70, 0xB0, 0x00, 0x30, 0xE0, 0xC1, 0x07, 0x40, 0x50, 0xD0, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0x90, 0x03, 0xC0, 0x02, 0x90, 0x0F, 0x00, 0x0F, 0x02, 0xE0, 0x70, 0x40, 0xB0, 0x30,
+0x40, 0x0F, 0x05, 0xE0, 0x10, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xC0, 0x90, 0x02, 0x90, 0x02,
+0x60, 0x30, 0xD0, 0x20, 0xF1, 0xD0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xA0, 0xF2, 0x21, 0xF0, 0x22,
+0xF1, 0x21, 0xF0, 0x25, 0xF2, 0xD1, 0xF0, 0xA0, 0x50, 0xA0, 0xF7, 0x21, 0xF0, 0x23, 0xF3, 0xA0,
+0x50, 0xA0, 0xD0, 0xF0, 0xD1, 0x50, 0x20, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x28, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0xD0, 0xA0, 0x30, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x22,
+0xD0, 0x50, 0xA0, 0xD1, 0xF0, 0x50, 0x80, 0x50, 0xD0, 0xC0, 0x40, 0x00, 0x41, 0xE0, 0xB0, 0x03,
+0xB0, 0xC0, 0xD0, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xC0, 0x11, 0x82, 0x90,
+0x41, 0x90, 0x30, 0xC0, 0x90, 0xC1, 0x30, 0xD0, 0x50, 0x90, 0xC0, 0x50, 0xD0, 0x30, 0x10, 0x80,
+0x02, 0xE0, 0xB0, 0x07, 0x60, 0x90, 0xA0, 0xD0, 0xF7, 0x21, 0xF0, 0xA0, 0x50, 0xD0, 0xF0, 0x22,
+0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD1, 0xF0, 0x20, 0xF0, 0x50, 0xA0, 0xD0, 0x20, 0xF0, 0x21, 0xF0,
+0xD0, 0x30, 0x40, 0x02, 0x80, 0x40, 0x02, 0xC0, 0xA0, 0xF0, 0x90, 0x60, 0x03, 0xB0, 0x40, 0x60,
+0x0E, 0x30, 0x02, 0x60, 0x40, 0x60, 0x04, 0x90, 0x02, 0x60, 0x06, 0x80, 0x60, 0x04, 0x30, 0xE0,
+0x60, 0x00, 0xB0, 0x30, 0x40, 0xE0, 0x0A, 0x80, 0x10, 0x70, 0x10, 0xC0, 0x70, 0x30, 0x01, 0xE0,
+0x41, 0x10, 0x60, 0x06, 0xE0, 0x30, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0x90, 0x60, 0x02, 0x80, 0x40,
+0x60, 0x40, 0xC0, 0xB0, 0x0E, 0x0F, 0x02, 0x30, 0x61, 0x80, 0xC0, 0xE0, 0xB0, 0x0F, 0x04, 0xB0,
+0x10, 0xC0, 0x90, 0xF0, 0x20, 0xF0, 0xD0, 0x80, 0x40, 0x01, 0x70, 0x60, 0x02, 0x60, 0x30, 0xD0,
+0x23, 0xF0, 0xD0, 0xF0, 0xA0, 0x52, 0xF0, 0xD0, 0xF0, 0x25, 0xF5, 0x27, 0xF4, 0xA0, 0x50, 0xA0,
+0xF0, 0xD0, 0xF5, 0x21, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x51, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x20,
+0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xA0, 0x10,
+0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x50, 0x30, 0xD0, 0x70, 0x90, 0xC0,
+0x10, 0xC0, 0x30, 0x10, 0x02, 0xB0, 0xE0, 0x04, 0x80, 0x50, 0xD0, 0xF0, 0xD0, 0x50, 0xD0, 0x23,
+0xF0, 0xD2, 0x70, 0x11, 0x70, 0x10, 0x80, 0xC2, 0x90, 0x11, 0xC1, 0x10, 0x90, 0xD1, 0x50, 0xD3,
+0xA0, 0xC0, 0x30, 0x01, 0xE0, 0x09, 0x90, 0xA0, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xA0, 0x50,
+0xD0, 0xF1, 0x22, 0xF3, 0x21, 0xF1, 0xD0, 0xF1, 0x50, 0xF2, 0x23, 0xD0, 0xA0, 0x90, 0x08, 0x80,
+0x50, 0xD0, 0xC0, 0xE0, 0x01, 0xB0, 0x40, 0xE0, 0x0F, 0x01, 0x90, 0x00, 0x60, 0x40, 0xB0, 0x06,
+0xE0, 0x80, 0x00, 0x70, 0x90, 0xB0, 0x05, 0x80, 0x60, 0x03, 0x40, 0x30, 0x00, 0x40, 0xE1, 0xB0,
+0x0D, 0x60, 0x40, 0x80, 0x11, 0x60, 0x02, 0x30, 0xB0, 0x10, 0xC0, 0xB0, 0x05, 0xB0, 0x90, 0xD0,
+0xF1, 0x21, 0xF0, 0xD0, 0xA0, 0x30, 0x00, 0xB0, 0x60, 0x40, 0x10, 0x40, 0x61, 0x80, 0x0E, 0x0F,
+0x02, 0x90, 0x02, 0x70, 0x00, 0x60, 0xE0, 0x40, 0xE0, 0xB0, 0x0F, 0x00, 0xE0, 0x10, 0x80, 0xF2,
+0x20, 0xF0, 0xA0, 0x70, 0x00, 0x30, 0x60, 0x03, 0xE0, 0x80, 0xD0, 0x23, 0xF3, 0xD0, 0xA0, 0x52,
+0xF2, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0x23, 0xF3, 0xD1, 0xA0, 0x50, 0xA0, 0xF0,
+0xD1, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0x22, 0xF3, 0x50, 0xA0, 0x50, 0xF4, 0x24, 0xF1, 0x20, 0xF2,
+0x24, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0x30, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20,
+0x30, 0xF0, 0x20, 0xF0, 0xD0, 0x70, 0xC0, 0x10, 0x70, 0x01, 0x40, 0x30, 0x04, 0xE0, 0xB0, 0x04,
+0x70, 0xA0, 0xD1, 0xA1, 0xF0, 0x22, 0xD0, 0x80, 0xC0, 0x80, 0x40, 0x10, 0xC0, 0x11, 0xC0, 0x11,
+0xC0, 0x30, 0x11, 0x70, 0xC1, 0x90, 0xD0, 0xF0, 0x50, 0xD0, 0xF2, 0xD1, 0xC1, 0x30, 0x40, 0x08,
+0x60, 0x80, 0x30, 0xD0, 0xF2, 0x20, 0xF5, 0x50, 0xF2, 0x24, 0xF1, 0x23, 0xF2, 0x50, 0xF2, 0x24,
+0xD0, 0x80, 0x40, 0x00, 0xB0, 0x60, 0x05, 0xB0, 0x90, 0xD0, 0x70, 0x00, 0xE1, 0x40, 0x0F, 0x03,
+0x80, 0x40, 0xB0, 0x09, 0x30, 0xC0, 0x10, 0xC0, 0x10, 0x40, 0x04, 0x30, 0xB0, 0x02, 0x40, 0x30,
+0x40, 0xE0, 0x40, 0x0F, 0x04, 0x80, 0x10, 0x03, 0xB0, 0x90, 0x80, 0x10, 0x70, 0x06, 0x30, 0xD0,
+0xF1, 0x20, 0xF2, 0xA0, 0x30, 0xE1, 0x60, 0x00, 0xC0, 0x02, 0x90, 0x0E, 0x0F, 0x01, 0x60, 0x30,
+0x01, 0xE0, 0x30, 0x03, 0xB0, 0x60, 0x41, 0xE0, 0xB0, 0x0B, 0xE0, 0x10, 0xA0, 0xD0, 0x22, 0xD0,
+0x50, 0x80, 0xB0, 0x10, 0xB0, 0x03, 0x80, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xD0, 0x50, 0xA0,
+0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF1, 0x22, 0xF1, 0x28, 0xF3, 0x21, 0xF2, 0x51, 0xF0,
+0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0x51, 0xA0, 0xD1, 0xF0, 0x20, 0xF0, 0x24,
+0xF4, 0x21, 0xF3, 0x21, 0xF0, 0x20, 0x50, 0xF0, 0xD0, 0x90, 0xC0, 0xD0, 0x23, 0xF0, 0x50, 0x20,
+0xF2, 0xD0, 0x50, 0x90, 0x10, 0x60, 0x09, 0x40, 0x05, 0xC0, 0xD0, 0xF0, 0xA1, 0xF2, 0xD0, 0xF0,
+0xC0, 0x00, 0x10, 0x30, 0x80, 0x70, 0x90, 0x30, 0x90, 0x80, 0x71, 0x80, 0x30, 0x42, 0x80, 0x90,
+0xA1, 0x50, 0xD2, 0xF1, 0xD1, 0x10, 0x70, 0x10, 0xC0, 0x07, 0x30, 0xC0, 0x90, 0xD0, 0xF0, 0x21,
+0xF0, 0x21, 0xF2, 0x50, 0x20, 0xF2, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xD0,
+0xF2, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xC0, 0x01, 0x70, 0x10, 0x01, 0x40, 0xB0, 0x00, 0x40, 0x00,
+0x70, 0xD0, 0x80, 0x41, 0x60, 0x0F, 0x02, 0xE0, 0x40, 0xB0, 0x30, 0x0B, 0x12, 0x80, 0x70, 0x30,
+0x80, 0x60, 0x01, 0x80, 0x60, 0x00, 0xB0, 0xE0, 0x30, 0xE0, 0x01, 0xB0, 0x60, 0x0F, 0x03, 0x80,
+0x40, 0x04, 0x80, 0x41, 0x11, 0x90, 0x40, 0x03, 0x90, 0xD0, 0xF0, 0xD0, 0xF0, 0x52, 0xA0, 0x70,
+0x03, 0xC0, 0x02, 0x90, 0x0E, 0x0F, 0x01, 0x40, 0x30, 0x90, 0x30, 0x70, 0x60, 0x07, 0xB0, 0xE0,
+0x41, 0x60, 0xB0, 0x06, 0x60, 0xB0, 0xC0, 0xD0, 0xF0, 0x22, 0xD0, 0x30, 0xE0, 0x91, 0x04, 0x80,
+0x50, 0xD0, 0x20, 0xF6, 0x20, 0x50, 0xD0, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF3, 0x21, 0xF2, 0x2D,
+0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xD1, 0x50, 0xD0,
+0xA0, 0x50, 0xF2, 0x26, 0xF2, 0x22, 0xF4, 0x20, 0xF2, 0x50, 0xA0, 0xD0, 0xC0, 0x50, 0xD0, 0x20,
+0xF4, 0x21, 0xF1, 0xD0, 0x30, 0xC0, 0x40, 0x09, 0xB0, 0x60, 0x04, 0xC0, 0x30, 0xD1, 0x50, 0xF0,
+0xD0, 0xF1, 0x70, 0x40, 0x60, 0xE0, 0x90, 0x40, 0xE0, 0x63, 0x40, 0x91, 0x70, 0xC1, 0x71, 0x40,
+0x80, 0xE0, 0x53, 0xA0, 0x20, 0xF0, 0xD0, 0xE0, 0x30, 0x11, 0xC0, 0x05, 0xE1, 0x10, 0x50, 0xF0,
+0x23, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF3, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0x50, 0xA0,
+0xF0, 0x20, 0xF0, 0x22, 0xF3, 0xD0, 0x70, 0xE0, 0x60, 0x91, 0x40, 0x80, 0x70, 0x40, 0x01, 0x60,
+0x30, 0xD0, 0x80, 0x90, 0x30, 0x40, 0x0E, 0xB0, 0xE1, 0x02, 0x70, 0x0B, 0x80, 0xB0, 0x01, 0x90,
+0x00, 0x90, 0xE0, 0x01, 0x40, 0x80, 0x40, 0xE0, 0x00, 0x60, 0x80, 0x02, 0x80, 0x10, 0x0F, 0x02,
+0x80, 0xC0, 0x05, 0x10, 0xB0, 0x80, 0x70, 0xC0, 0x30, 0x60, 0x02, 0x90, 0xA0, 0x51, 0xA0, 0xF1,
+0xD1, 0x30, 0xE0, 0x02, 0x40, 0x90, 0x30, 0x91, 0x60, 0x0D, 0x0F, 0x01, 0x30, 0xB0, 0x01, 0xC0,
+0xB0, 0x0B, 0xB0, 0xE0, 0x40, 0xE0, 0x60, 0x02, 0x40, 0x11, 0x30, 0xD1, 0xF0, 0x20, 0xF0, 0xD0,
+0x91, 0xB0, 0x05, 0x90, 0xA0, 0xD3, 0x21, 0xF2, 0xA1, 0xD0, 0x22, 0xF1, 0xD0, 0xF0, 0xA1, 0x50,
+0xA0, 0xF0, 0xD0, 0xF0, 0x21, 0xF6, 0x27, 0xF5, 0xA0, 0x50, 0xF0, 0xD1, 0xF2, 0x25, 0xF0, 0x50,
+0xA0, 0xD1, 0xF0, 0x50, 0xA0, 0xF5, 0x23, 0xF0, 0x24, 0xF0, 0x20, 0xF4, 0x20, 0xA1, 0xF0, 0xA0,
+0x50, 0xD2, 0x22, 0xF0, 0x20, 0xF1, 0xA0, 0x90, 0x40, 0xB0, 0x0A, 0x40, 0x03, 0x90, 0xE0, 0x90,
+0xA0, 0x50, 0xA2, 0x50, 0x80, 0x50, 0x00, 0x80, 0xC0, 0x90, 0x10, 0x40, 0x80, 0x10, 0x90, 0x80,
+0x10, 0xC0, 0x90, 0x30, 0x91, 0x10, 0x70, 0xC0, 0x30, 0x70, 0xD1, 0xF1, 0xA0, 0x51, 0xA1, 0x40,
+0x11, 0xC0, 0x90, 0x03, 0xB0, 0xE1, 0xC0, 0xD0, 0xF0, 0x23, 0xF1, 0xD0, 0x50, 0xA0, 0xF0, 0x22,
+0xF4, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x21, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xC0, 0x10,
+0xE0, 0x00, 0x31, 0x03, 0x40, 0x80, 0x40, 0x10, 0x00, 0xB0, 0x80, 0x31, 0x0A, 0xB0, 0x40, 0xE0,
+0x04, 0x30, 0xB0, 0x0A, 0x41, 0x01, 0x90, 0x00, 0x30, 0x00, 0xB0, 0x60, 0x30, 0x60, 0x03, 0x90,
+0xB0, 0x01, 0xE0, 0x60, 0x0F, 0x02, 0x80, 0x10, 0x05, 0x40, 0xE0, 0x00, 0x30, 0x10, 0x91, 0xB0,
+0xE1, 0x30, 0xA0, 0xF4, 0x20, 0xF0, 0xD0, 0x90, 0x02, 0xE0, 0x70, 0x01, 0x60, 0x80, 0x0D, 0x08,
+0xB0, 0x30, 0x40, 0x04, 0x90, 0x02, 0x70, 0x0F, 0x00, 0xB0, 0x60, 0xE2, 0x70, 0x90, 0xA0, 0xD1,
+0xF0, 0xD0, 0xF1, 0xD0, 0x10, 0xE0, 0x06, 0x70, 0xD1, 0xA0, 0x70, 0xF0, 0x20, 0xF0, 0x20, 0xF1,
+0xA0, 0xF0, 0x23, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xA0, 0x51, 0xF0, 0xD0, 0xF2, 0xD1, 0xF2, 0x25,
+0xF1, 0x20, 0xF1, 0x21, 0xD1, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x24, 0xD0, 0x20, 0x50, 0xF3,
+0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x2A, 0xF2, 0x22, 0xF0, 0xA0, 0x50, 0xF0, 0x30, 0x90,
+0x50, 0xD2, 0x21, 0xF0, 0x20, 0xD0, 0x70, 0xC0, 0x00, 0x30, 0xB0, 0x09, 0xB0, 0xE0, 0x01, 0x30,
+0xE0, 0x00, 0x90, 0x10, 0xC0, 0x80, 0x70, 0xC0, 0xA0, 0xD0, 0x70, 0x30, 0x10, 0xE0, 0x00, 0x90,
+0x10, 0xC0, 0x70, 0x30, 0x12, 0x80, 0x40, 0x70, 0x40, 0x10, 0x80, 0x70, 0x11, 0xC0, 0xA0, 0xF0,
+0xD2, 0xF0, 0xA0, 0x51, 0x81, 0x11, 0x30, 0x02, 0x40, 0x01, 0x10, 0x80, 0xD0, 0x22, 0xF1, 0xD0,
+0xA1, 0xD0, 0x23, 0xF3, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x20, 0xF5, 0x22, 0xF0, 0xD1,
+0x80, 0x70, 0x30, 0x00, 0x10, 0x90, 0xB0, 0x00, 0x60, 0x80, 0x41, 0x30, 0x02, 0x40, 0x70, 0x08,
+0xB0, 0x40, 0x60, 0x06, 0x41, 0x0A, 0x90, 0x60, 0x01, 0x41, 0x30, 0xE0, 0x30, 0x80, 0x30, 0xB0,
+0x03, 0x40, 0x30, 0x01, 0xB0, 0x60, 0x0F, 0x02, 0x90, 0x70, 0x05, 0x60, 0x30, 0x00, 0xB0, 0x41,
+0x90, 0x40, 0x01, 0x30, 0xA0, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0x90, 0x03, 0x70, 0x02,
+0x90, 0x0D, 0x08, 0x80, 0xB0, 0x30, 0x03, 0xB0, 0xC0, 0x30, 0x41, 0x30, 0x0F, 0x03, 0x40, 0x91,
+0x51, 0xA1, 0xD1, 0xF0, 0xD0, 0x80, 0x90, 0x06, 0x60, 0x90, 0xD1, 0xA0, 0xC0, 0xA0, 0x22, 0xF0,
+0xD0, 0x50, 0xF0, 0x29, 0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF2, 0x22, 0xF6, 0x22,
+0xF5, 0xA0, 0x50, 0xA0, 0xD0, 0xF5, 0x50, 0x22, 0xF2, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0x27, 0xF0,
+0x23, 0xF3, 0x21, 0xF1, 0xA0, 0x50, 0xF0, 0x30, 0x10, 0xC0, 0x50, 0xD2, 0xF1, 0xD0, 0xF0, 0x70,
+0x10, 0x90, 0xE0, 0x0A, 0x40, 0x00, 0x40, 0x80, 0x00, 0x60, 0x90, 0x80, 0xC0, 0x10, 0x90, 0x70,
+0x90, 0x40, 0xA1, 0xC0, 0x10, 0x60, 0x00, 0xE0, 0x10, 0x80, 0x40, 0x10, 0x00, 0x30, 0x70, 0x91,
+0x60, 0x10, 0x80, 0x30, 0x10, 0x70, 0x12, 0x90, 0x50, 0xD1, 0xF1, 0xD0, 0xA1, 0x70, 0x11, 0xE0,
+0x00, 0xB0, 0x60, 0x01, 0x40, 0x10, 0xA0, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0x21, 0xF0,
+0x22, 0xF2, 0x21, 0xF2, 0x50, 0xFA, 0x24, 0xF0, 0xD1, 0x90, 0x80, 0x00, 0xE0, 0xC0, 0xE0, 0x30,
+0x80, 0x10, 0x70, 0x60, 0x02, 0x60, 0x40, 0x06, 0xE0, 0x40, 0x60, 0x09, 0x90, 0x09, 0x60, 0x80,
+0x00, 0xB0, 0x40, 0xE0, 0x81, 0x30, 0xE0, 0x60, 0x10, 0x05, 0x30, 0x70, 0x00, 0xE0, 0x30, 0x0F,
+0x02, 0x40, 0x10, 0x04, 0xB0, 0x60, 0x30, 0x40, 0xB0, 0x10, 0xE0, 0x00, 0x90, 0x01, 0x40, 0x50,
+0xD0, 0x21, 0xF2, 0x20, 0xD0, 0x30, 0x40, 0x02, 0x70, 0xE0, 0x40, 0x30, 0x70, 0xB0, 0x0C, 0x08,
+0x60, 0x30, 0x80, 0x03, 0x40, 0x60, 0x00, 0xE0, 0xC0, 0x60, 0x0F, 0x03, 0x70, 0xE0, 0x10, 0x50,
+0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0x80, 0xE0, 0xB0, 0xE0, 0x04, 0xE0, 0x80, 0xD0, 0xF0, 0xD0,
+0x90, 0xA0, 0x22, 0xF0, 0xA1, 0xD0, 0x2B, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF9, 0x20, 0xF0, 0x24,
+0xF0, 0x20, 0xF4, 0xA0, 0x50, 0xA0, 0xF1, 0xD0, 0xF1, 0x50, 0x22, 0xF3, 0xD1, 0xF0, 0xA0, 0x50,
+0xF0, 0xD0, 0xF1, 0x23, 0xF1, 0x24, 0xF4, 0x20, 0xF1, 0x50, 0xF0, 0xD0, 0x90, 0xC0, 0x10, 0x70,
+0x50, 0xA0, 0xD2, 0x80, 0x10, 0x60, 0x41, 0x60, 0x09, 0x81, 0x00, 0xE0, 0x90, 0xB0, 0x00, 0x60,
+0x01, 0x60, 0x11, 0x80, 0x60, 0x70, 0x90, 0x40, 0x01, 0x60, 0xE0, 0x80, 0xD0, 0x11, 0x90, 0x40,
+0x90, 0x40, 0x70, 0x30, 0x03, 0xE0, 0x12, 0x30, 0xD0, 0xF1, 0x21, 0xD0, 0xA0, 0x90, 0x70, 0x40,
+0x00, 0x40, 0x03, 0xC0, 0x30, 0xD0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xF2, 0x22, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0xA0, 0x50, 0xF3, 0x20, 0xF4, 0x27, 0xF1, 0xD0, 0x30, 0x90, 0x40, 0x60, 0xC0, 0x90,
+0x80, 0x70, 0xB0, 0x03, 0xB0, 0x30, 0x04, 0xE0, 0x40, 0xB0, 0x0B, 0x80, 0xB0, 0x08, 0x42, 0xE0,
+0x01, 0x60, 0x90, 0x02, 0x60, 0x80, 0x04, 0x30, 0x90, 0xB0, 0x40, 0x90, 0x0F, 0x03, 0x10, 0xE0,
+0xB0, 0x60, 0xE0, 0x40, 0xE0, 0x00, 0xB0, 0x30, 0x00, 0x31, 0x00, 0x30, 0x01, 0xE0, 0x80, 0xD0,
+0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0x70, 0x02, 0x40, 0x70, 0xE0, 0x00, 0x40, 0xE0, 0x0C, 0x0F,
+0x00, 0x30, 0xB0, 0x01, 0xC0, 0x0F, 0x04, 0x90, 0x50, 0x10, 0xD0, 0xF3, 0x20, 0xA0, 0x50, 0x80,
+0x40, 0x30, 0x40, 0x04, 0x80, 0x30, 0xD0, 0xF0, 0xD0, 0x30, 0xD0, 0xF0, 0x21, 0xF0, 0x50, 0xF2,
+0x20, 0xF3, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF1, 0xD0, 0xF0, 0xA1, 0x50, 0xA0, 0xF0, 0xD0, 0xF2,
+0x24, 0xF2, 0x22, 0xF6, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0x50, 0xF1, 0x24, 0xF3, 0xD0, 0x20, 0x50,
+0xA0, 0xF0, 0xD0, 0x20, 0xF1, 0x22, 0xF1, 0x24, 0xF2, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0,
+0xF0, 0x50, 0x12, 0x90, 0x80, 0x30, 0xC0, 0x71, 0xC0, 0x10, 0x31, 0x90, 0xE0, 0x05, 0xB0, 0x90,
+0xE0, 0x40, 0x00, 0x40, 0x70, 0x04, 0x60, 0xB0, 0x90, 0x40, 0x70, 0x80, 0xC0, 0x40, 0x01, 0xE0,
+0x70, 0xA0, 0x50, 0x70, 0x40, 0x70, 0x50, 0x11, 0xB1, 0x40, 0x10, 0xE0, 0x01, 0x80, 0x11, 0xA0,
+0xD1, 0xF0, 0x20, 0xF0, 0xD0, 0x80, 0x10, 0x30, 0x80, 0x60, 0x03, 0x71, 0xD0, 0xF0, 0xD0, 0xF0,
+0x50, 0xF4, 0x25, 0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0,
+0x21, 0xF1, 0xD0, 0xF0, 0x50, 0x30, 0xC0, 0x80, 0x30, 0xA0, 0xD0, 0xA0, 0x70, 0x04, 0x10, 0x60,
+0x01, 0xE0, 0x40, 0xB0, 0x0D, 0x40, 0xE0, 0x06, 0x60, 0xE0, 0x30, 0x60, 0x04, 0x90, 0x03, 0x90,
+0x03, 0xB0, 0x30, 0x00, 0x70, 0x00, 0xE0, 0x60, 0x0F, 0x01, 0xB0, 0x91, 0x60, 0x40, 0x80, 0x03,
+0x90, 0x10, 0x80, 0x60, 0x40, 0x30, 0x01, 0xB0, 0x90, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xD0,
+0x81, 0x01, 0x60, 0x30, 0x01, 0x60, 0x40, 0x0C, 0x08, 0x40, 0x70, 0xC0, 0x70, 0x80, 0x01, 0x90,
+0xB0, 0x01, 0x10, 0x0F, 0x03, 0x60, 0x30, 0xF0, 0x50, 0xF4, 0x20, 0xD0, 0xF0, 0xD0, 0x90, 0xE0,
+0x30, 0x80, 0xE0, 0xB0, 0x00, 0xB0, 0x70, 0x50, 0xD1, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x21, 0x50,
+0xF1, 0x20, 0xF6, 0x28, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA1, 0xF2, 0x20, 0xF1, 0x2B, 0xF3, 0xA0,
+0x52, 0xD0, 0xF1, 0x26, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x23, 0xF1, 0x21,
+0xF8, 0x50, 0xA0, 0xD0, 0xF1, 0x30, 0x10, 0xC0, 0x10, 0xC0, 0x10, 0xC0, 0x80, 0x30, 0x72, 0x90,
+0x70, 0x00, 0xE0, 0x03, 0x70, 0x41, 0x01, 0x40, 0x80, 0x02, 0x80, 0xB0, 0x02, 0x90, 0x10, 0x80,
+0x04, 0x90, 0xC0, 0xD0, 0x70, 0x40, 0x30, 0x81, 0x10, 0x90, 0x13, 0x90, 0x01, 0x80, 0x11, 0xC0,
+0x30, 0xA0, 0xD0, 0xF1, 0xD0, 0x80, 0x10, 0x30, 0x90, 0xB0, 0x03, 0xC0, 0x30, 0xD0, 0xF0, 0x50,
+0x20, 0xF0, 0x20, 0xF4, 0x22, 0xF0, 0x20, 0xD0, 0x50, 0xA0, 0xD0, 0x22, 0xF3, 0x25, 0xF1, 0x20,
+0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0xD1, 0x80, 0x70, 0xD0, 0xF0, 0xD0, 0x50, 0x80, 0x03, 0x81,
+0xE0, 0x40, 0xB0, 0x0F, 0x00, 0x80, 0x60, 0x03, 0xB0, 0x40, 0xE0, 0x60, 0x00, 0x60, 0x40, 0x04,
+0xB0, 0x90, 0x02, 0x41, 0x02, 0x60, 0x80, 0x00, 0x30, 0x60, 0x00, 0xE0, 0x0C, 0xB0, 0xE0, 0x40,
+0xE0, 0xB1, 0x90, 0x60, 0x40, 0x10, 0x04, 0x30, 0x01, 0x30, 0xE0, 0x40, 0x01, 0x70, 0xD0, 0x20,
+0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x90, 0xE0, 0x00, 0xB0, 0xC0, 0x01, 0xE0, 0x30, 0x0C, 0x07,
+0xB0, 0x70, 0xB0, 0x00, 0x60, 0x80, 0xC0, 0xB0, 0x70, 0x80, 0x32, 0x0F, 0x03, 0x40, 0x80, 0xD1,
+0x20, 0xF1, 0x23, 0xD1, 0x30, 0xE0, 0x11, 0x00, 0xE1, 0x30, 0x40, 0xD3, 0xF0, 0xD0, 0x30, 0xD0,
+0xF1, 0xA0, 0xF2, 0x22, 0xF1, 0x21, 0xF3, 0x21, 0xF0, 0x25, 0xF3, 0xA0, 0x50, 0xA0, 0xF0, 0xD1,
+0xF1, 0x23, 0xF1, 0x25, 0xF1, 0xD2, 0x50, 0x21, 0xF4, 0x24, 0xF1, 0x20, 0xF1, 0xA0, 0x50, 0xF0,
+0xD0, 0xF4, 0x26, 0xF2, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xD1, 0xA0, 0x90, 0x50, 0x80, 0x30, 0x80,
+0x70, 0x11, 0x90, 0x10, 0xC0, 0x80, 0x10, 0xC0, 0x60, 0x02, 0x30, 0x60, 0x00, 0xB0, 0xE0, 0x00,
+0x40, 0x90, 0x01, 0x60, 0x10, 0xE0, 0x80, 0x02, 0x90, 0x10, 0x80, 0x60, 0x80, 0x10, 0xE0, 0x10,
+0x90, 0xC0, 0x10, 0x30, 0x11, 0x80, 0x60, 0x10, 0x30, 0x71, 0x90, 0x11, 0xE0, 0x01, 0x40, 0x30,
+0x11, 0x30, 0xD0, 0xF0, 0xD1, 0xA0, 0x70, 0x10, 0x30, 0x60, 0x02, 0xB0, 0x10, 0xD0, 0x50, 0xA0,
+0xF1, 0x21, 0xF0, 0x25, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF3, 0x26, 0xF1, 0xD1, 0xA0,
+0x50, 0xA0, 0xF0, 0x20, 0xF1, 0xD1, 0x21, 0xF0, 0xD0, 0x70, 0x04, 0x90, 0x60, 0x0F, 0x02, 0x30,
+0xB0, 0x00, 0xB0, 0xE0, 0x40, 0xE0, 0x03, 0x60, 0x80, 0x05, 0x90, 0x03, 0x10, 0xB0, 0x01, 0x60,
+0x80, 0x01, 0x70, 0x00, 0x40, 0x08, 0xB0, 0xE0, 0x41, 0xE0, 0x05, 0x70, 0xB0, 0x10, 0xB0, 0x03,
+0x30, 0x01, 0x30, 0x60, 0x70, 0x01, 0x70, 0xD0, 0x23, 0xF1, 0x20, 0xF2, 0xC0, 0x01, 0x70, 0x31,
+0x80, 0x70, 0x0C, 0x07, 0xE0, 0x90, 0x03, 0xE0, 0x90, 0x80, 0x01, 0x40, 0x80, 0x0F, 0x03, 0x30,
+0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x51, 0x90, 0xC0, 0x70, 0x10, 0x40, 0x01, 0x80,
+0x40, 0xA0, 0x51, 0xA0, 0x20, 0xD0, 0x70, 0xD1, 0xA1, 0xD0, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x23,
+0xF2, 0x27, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xF3,
+0x50, 0xF6, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0xA0, 0x50, 0xF0, 0xD0, 0xF5, 0x20, 0xF0, 0x24,
+0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xF1, 0xD2, 0x50, 0x90, 0x11, 0xC0, 0xE0, 0xD0, 0xA0, 0x30, 0xC0,
+0x10, 0xB0, 0x00, 0xB0, 0x30, 0xE0, 0x02, 0x40, 0x00, 0xC0, 0x03, 0x70, 0x80, 0x40, 0x80, 0x01,
+0x10, 0xC0, 0x14, 0x71, 0xC0, 0x71, 0x30, 0x70, 0x10, 0x30, 0xC0, 0x60, 0x10, 0x50, 0x31, 0xC1,
+0xE0, 0xB0, 0x60, 0x40, 0x80, 0x10, 0x30, 0xD0, 0xF1, 0xA0, 0x50, 0xD0, 0x30, 0x10, 0x70, 0x80,
+0x00, 0x30, 0x90, 0x10, 0x70, 0xA0, 0xF0, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xF3,
+0x20, 0xF1, 0x28, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x21, 0xD0, 0x70,
+0x04, 0x30, 0xE0, 0x0F, 0x00, 0xB0, 0x40, 0xC0, 0x30, 0xE1, 0x05, 0xB0, 0xC0, 0x06, 0x40, 0x80,
+0x03, 0xC0, 0x40, 0xB0, 0x00, 0x80, 0xE0, 0x00, 0x60, 0x30, 0x00, 0x60, 0x03, 0xB0, 0x60, 0x41,
+0xE0, 0xB0, 0x04, 0x30, 0x60, 0x01, 0x60, 0x80, 0x00, 0xB1, 0x02, 0x30, 0x02, 0x90, 0xC0, 0x30,
+0x00, 0x80, 0xA0, 0x27, 0xF0, 0xD0, 0x90, 0xB0, 0x00, 0x90, 0xE0, 0x01, 0x30, 0x04, 0xB0, 0x06,
+0x08, 0x30, 0x70, 0x80, 0x61, 0x30, 0x90, 0x60, 0x01, 0x30, 0x60, 0x0F, 0x03, 0x70, 0x80, 0xF1,
+0x21, 0xF0, 0x21, 0xF1, 0x30, 0x50, 0xD0, 0x50, 0xD0, 0x90, 0x80, 0x01, 0x80, 0x70, 0xA0, 0xD0,
+0x20, 0xA1, 0x50, 0xA1, 0xF0, 0x50, 0xD1, 0x26, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x28,
+0xF1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0x20, 0xF4, 0x22, 0xF1, 0xA1, 0xFA, 0x20, 0xF1, 0x23,
+0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xF4, 0x50, 0xF2, 0x20,
+0xA0, 0x52, 0xD1, 0xF0, 0xD1, 0x50, 0xC0, 0x80, 0x60, 0x81, 0x03, 0xB0, 0x60, 0x90, 0x60, 0x02,
+0x80, 0x10, 0xC0, 0x10, 0x90, 0x01, 0x60, 0x40, 0xC1, 0x60, 0x91, 0x30, 0x11, 0x90, 0x00, 0x60,
+0x40, 0x10, 0x30, 0x00, 0x90, 0x50, 0xD0, 0x70, 0x50, 0x90, 0x15, 0x50, 0xD2, 0x50, 0xF1, 0xD0,
+0xF0, 0x30, 0x10, 0x70, 0xC2, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xA0, 0x50,
+0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x26, 0xF1, 0x20, 0xF0, 0x20, 0x51, 0xF0, 0xD0, 0xF0, 0x22, 0xF2,
+0x23, 0xD0, 0x70, 0x04, 0x30, 0x40, 0xB0, 0x0D, 0x60, 0x70, 0x81, 0xB0, 0x90, 0x06, 0x90, 0x08,
+0x30, 0xB0, 0x03, 0x80, 0x70, 0x30, 0x70, 0xC0, 0x01, 0x40, 0xC0, 0xE0, 0x00, 0xB0, 0xE0, 0x40,
+0xE0, 0xB0, 0x08, 0xE0, 0xB0, 0x02, 0x90, 0x00, 0x80, 0x30, 0x02, 0x30, 0x03, 0x60, 0x40, 0x00,
+0xE0, 0x80, 0xD0, 0x25, 0xF2, 0xA0, 0x30, 0x00, 0x40, 0x80, 0x01, 0x40, 0x60, 0x30, 0xC0, 0x80,
+0x30, 0xC0, 0x90, 0x05, 0x09, 0x60, 0x80, 0x91, 0xE0, 0x30, 0x90, 0x80, 0x60, 0xC0, 0x0F, 0x04,
+0x10, 0x80, 0xD0, 0xF0, 0x22, 0xF1, 0xD0, 0x80, 0x30, 0xD0, 0xF1, 0xD0, 0x30, 0x60, 0x01, 0x30,
+0x90, 0xA0, 0xF1, 0xD0, 0xA0, 0x90, 0xF0, 0xA0, 0x51, 0xA1, 0xF0, 0xD0, 0xF4, 0x20, 0xF0, 0x23,
+0xF0, 0x21, 0xF2, 0x2A, 0xF3, 0xA0, 0x51, 0xF2, 0xD0, 0xF2, 0x23, 0xF1, 0x50, 0xD0, 0xF2, 0x22,
+0xF5, 0x21, 0xF1, 0x22, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xF2, 0x25, 0xF0, 0x26, 0xD0, 0xF0, 0x50,
+0xA0, 0xF1, 0x20, 0xD1, 0xF5, 0xD0, 0x80, 0x30, 0x40, 0x30, 0xB0, 0x30, 0x03, 0xE0, 0x30, 0xE0,
+0x02, 0x80, 0x12, 0x90, 0x00, 0x41, 0x00, 0x30, 0xC0, 0x01, 0xE1, 0x40, 0x10, 0x80, 0x02, 0x70,
+0x40, 0x80, 0x50, 0x30, 0xD2, 0x70, 0x60, 0x80, 0xB0, 0xC0, 0x10, 0x70, 0xF0, 0xD0, 0xF0, 0xA1,
+0xF3, 0xD1, 0x80, 0x50, 0xA0, 0x50, 0xD1, 0x22, 0xF0, 0x21, 0xF3, 0xA1, 0xF1, 0x23, 0xF2, 0x23,
+0xF2, 0xD0, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x22, 0xF0, 0x22, 0xF0, 0x21, 0xD0, 0x90, 0x60,
+0x03, 0x90, 0x00, 0xE0, 0x0B, 0x31, 0x80, 0x60, 0x02, 0xB0, 0x70, 0xB0, 0x04, 0x70, 0x08, 0xE0,
+0x80, 0x05, 0xB0, 0x00, 0x90, 0xE0, 0x00, 0xB0, 0x90, 0x80, 0x61, 0xB0, 0x0F, 0x01, 0x40, 0xE1,
+0x10, 0xB0, 0x01, 0x30, 0x00, 0xB0, 0x04, 0xB0, 0x90, 0xD0, 0x22, 0xF1, 0x20, 0xF2, 0xD0, 0x90,
+0x00, 0xB0, 0x90, 0xE0, 0x80, 0x71, 0x30, 0xB0, 0x80, 0x90, 0x00, 0x30, 0xE0, 0x04, 0x07, 0xB0,
+0x90, 0x40, 0x00, 0x40, 0xB0, 0x00, 0x90, 0x00, 0x60, 0x40, 0x10, 0x0F, 0x04, 0x90, 0xF2, 0x23,
+0xD0, 0xA0, 0xC0, 0x90, 0xD0, 0xF1, 0xD0, 0x30, 0x60, 0x01, 0x81, 0xF1, 0x20, 0xD0, 0x50, 0x10,
+0xD0, 0xF0, 0xA3, 0x51, 0xA0, 0xF0, 0xD0, 0xF3, 0xD0, 0x50, 0x30, 0xF5, 0x21, 0xF7, 0x21, 0xF1,
+0x21, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF0, 0x22, 0xF2, 0xA0, 0xD0, 0xF0, 0x29,
+0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF4, 0x23, 0xF0, 0x21,
+0xF0, 0x20, 0xF3, 0xD0, 0x50, 0xA0, 0xD0, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xE0, 0x10,
+0x70, 0x61, 0x04, 0x80, 0xB0, 0x03, 0x91, 0x70, 0x01, 0x40, 0x70, 0x60, 0x00, 0x40, 0x00, 0x90,
+0x40, 0x01, 0x31, 0x03, 0xC0, 0x10, 0xC0, 0xD0, 0xF1, 0x50, 0x10, 0xB0, 0x10, 0x40, 0x00, 0x40,
+0xC0, 0x30, 0xD0, 0xF0, 0x50, 0xF1, 0x22, 0xF1, 0xD1, 0xA0, 0x50, 0xD0, 0xF1, 0x23, 0xF2, 0xD0,
+0x50, 0xA0, 0xF2, 0x2A, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x24, 0xF2, 0x20, 0xF1, 0xD0,
+0xA0, 0x90, 0x03, 0x90, 0x00, 0x40, 0x08, 0xE0, 0x80, 0x30, 0x60, 0x06, 0xB0, 0x90, 0x03, 0x90,
+0x30, 0x09, 0x90, 0xB0, 0x05, 0xB0, 0x60, 0x90, 0xE0, 0x61, 0x70, 0x80, 0x0F, 0x04, 0x30, 0x70,
+0x60, 0x30, 0x01, 0x30, 0x00, 0x70, 0x05, 0xC0, 0xF2, 0x25, 0xF0, 0xD0, 0x81, 0x00, 0x10, 0xE0,
+0xB0, 0x00, 0x10, 0x60, 0x00, 0xB0, 0xC0, 0xB0, 0x70, 0x60, 0x04, 0x07, 0xC0, 0xE0, 0x30, 0x10,
+0x30, 0xC0, 0x81, 0x01, 0xB0, 0x90, 0x0F, 0x04, 0x90, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x80,
+0xC0, 0x40, 0x80, 0xD0, 0x21, 0xD0, 0x80, 0x40, 0x00, 0x80, 0x40, 0x10, 0xA0, 0xF0, 0x20, 0xF0,
+0xD0, 0x30, 0xD0, 0xF0, 0xA1, 0xD0, 0xF0, 0xD1, 0xA1, 0x51, 0xA0, 0x20, 0xF0, 0xD2, 0xF2, 0x21,
+0xF1, 0x21, 0xF8, 0x24, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0x20, 0xF3, 0xD0, 0x50, 0xF2, 0x28, 0xF0,
+0x21, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF6, 0x23, 0xF0, 0x21,
+0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0xF2, 0x21, 0xF2, 0x50, 0xF0, 0xD0, 0x80, 0x10, 0x90, 0x05, 0x70,
+0xB0, 0x05, 0xE0, 0x01, 0x61, 0x10, 0x03, 0x70, 0x10, 0x30, 0x00, 0xE0, 0x00, 0x90, 0x10, 0xE0,
+0xC0, 0x10, 0x70, 0xD1, 0x30, 0x90, 0x10, 0xC0, 0x90, 0xE0, 0xB0, 0x81, 0x10, 0xD0, 0xA1, 0xF1,
+0x23, 0xF0, 0x21, 0xF1, 0x50, 0xF0, 0xD0, 0x23, 0xF2, 0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x21,
+0xF0, 0x24, 0xF3, 0x50, 0xA0, 0xD1, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x21, 0xF3, 0xD0, 0x30, 0xE0,
+0x01, 0xB0, 0x80, 0x00, 0xB0, 0xE0, 0x04, 0xB0, 0x40, 0x30, 0x40, 0x0A, 0x41, 0x01, 0x70, 0xB0,
+0x09, 0xB0, 0x30, 0x40, 0x01, 0xB0, 0x60, 0xE0, 0x40, 0x60, 0x70, 0x03, 0x80, 0xE0, 0xC0, 0x60,
+0x0F, 0x00, 0x10, 0x03, 0x10, 0xB0, 0x00, 0x30, 0xB0, 0x70, 0x05, 0x70, 0xD0, 0xF0, 0x20, 0xF1,
+0x24, 0xF0, 0xD0, 0x30, 0x40, 0x10, 0x02, 0x30, 0xC0, 0x40, 0x70, 0x40, 0x90, 0xE0, 0x05, 0x07,
+0xC0, 0x00, 0xE0, 0x80, 0x00, 0xB0, 0x70, 0xC0, 0x30, 0xE0, 0x80, 0x40, 0x0F, 0x04, 0x90, 0xD1,
+0xF3, 0xD0, 0x10, 0xB0, 0x90, 0xF1, 0x21, 0xD0, 0x80, 0xE0, 0x60, 0x10, 0x90, 0x70, 0x90, 0xD0,
+0xF0, 0xD0, 0x50, 0x10, 0xD1, 0x50, 0xF2, 0x21, 0xF3, 0xA0, 0x51, 0xA1, 0xF1, 0xD0, 0xF2, 0x2F,
+0x04, 0xF4, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0x2C, 0xF0, 0x28, 0xF3, 0xD0, 0xF0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x22, 0xF2, 0x21, 0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xF1, 0x21, 0xF0,
+0xD0, 0xA0, 0x50, 0xF1, 0xD1, 0xC0, 0x80, 0xC0, 0x40, 0xE0, 0x02, 0x90, 0x80, 0x04, 0x40, 0x90,
+0x02, 0x60, 0x30, 0x04, 0xE0, 0x60, 0x00, 0xE0, 0x01, 0xE0, 0xC0, 0x10, 0x40, 0x31, 0xD0, 0x80,
+0xC0, 0x90, 0x80, 0x70, 0x30, 0x60, 0xC0, 0x11, 0x80, 0x50, 0xD0, 0xF0, 0x24, 0xF0, 0x21, 0xF2,
+0x50, 0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0x21, 0xF2, 0x20, 0xF2,
+0xA0, 0x50, 0xF0, 0xD0, 0xF3, 0x2B, 0xF4, 0x70, 0x40, 0x01, 0x30, 0x01, 0x40, 0x02, 0x60, 0x81,
+0x60, 0x0C, 0xB0, 0x90, 0x01, 0x90, 0x0A, 0x80, 0x90, 0xE1, 0x40, 0xE0, 0xB0, 0x01, 0x40, 0x80,
+0x03, 0x41, 0x70, 0x10, 0x0F, 0x01, 0x60, 0xB0, 0x72, 0x01, 0x30, 0xE0, 0xC0, 0x00, 0x90, 0x03,
+0x90, 0xF2, 0x22, 0xF0, 0x23, 0xD0, 0xF0, 0x70, 0x10, 0x60, 0x40, 0x30, 0x10, 0xB0, 0x30, 0x81,
+0x31, 0x60, 0x04, 0x07, 0x30, 0x71, 0x90, 0x00, 0xE0, 0x70, 0x13, 0x80, 0xB0, 0x0F, 0x03, 0x90,
+0xD0, 0xF2, 0xD1, 0xC0, 0x80, 0xE0, 0x80, 0xD0, 0xF1, 0x20, 0xD0, 0x70, 0x00, 0x30, 0x51, 0x30,
+0xC0, 0xD0, 0xF0, 0xD0, 0xA0, 0x10, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0xD1, 0xF0, 0xA1,
+0x51, 0xA0, 0xF5, 0x20, 0xF1, 0x2B, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0xA0,
+0x50, 0xA0, 0xF3, 0x26, 0xF1, 0x21, 0xF0, 0x29, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x20, 0xF0,
+0x20, 0xF3, 0x22, 0xF2, 0xD0, 0xA0, 0x50, 0xF3, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xC0,
+0x13, 0x80, 0x01, 0x40, 0x80, 0x60, 0x03, 0x30, 0x40, 0x01, 0x40, 0x12, 0x02, 0x30, 0x11, 0x30,
+0x40, 0x02, 0x40, 0x10, 0x00, 0x80, 0x10, 0xC0, 0xA0, 0xC0, 0x40, 0xD0, 0xE0, 0xC0, 0x10, 0x30,
+0x70, 0xC0, 0x90, 0xD1, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0x50, 0xF2, 0xD0, 0xF0, 0x50,
+0xF0, 0xD0, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x20, 0xF3, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF2,
+0x2B, 0xF1, 0x23, 0xF1, 0x90, 0x80, 0x00, 0x90, 0x01, 0x61, 0x40, 0x80, 0x70, 0x60, 0x0E, 0xE0,
+0x80, 0x00, 0xB0, 0x30, 0x08, 0xB0, 0x60, 0x80, 0x40, 0xB1, 0x04, 0x30, 0xB0, 0x03, 0x41, 0x00,
+0xC0, 0xB0, 0x0F, 0x00, 0x90, 0x10, 0x40, 0x60, 0xE0, 0x01, 0x80, 0x40, 0x81, 0xC0, 0xB0, 0x02,
+0x30, 0xA0, 0xD0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0xA0, 0x80, 0x13, 0xB0, 0x91, 0x40, 0xE0,
+0x40, 0x70, 0x04, 0x07, 0xB0, 0xE0, 0x00, 0x80, 0x10, 0x90, 0x80, 0xB0, 0x00, 0x60, 0xC0, 0x60,
+0xB0, 0xE1, 0x41, 0xE0, 0x60, 0x0C, 0x70, 0xD0, 0xF2, 0xD0, 0x30, 0x90, 0x00, 0x80, 0x50, 0xF1,
+0x21, 0xD0, 0x90, 0x00, 0x90, 0xD1, 0x30, 0x70, 0x90, 0xF0, 0xD0, 0x50, 0x10, 0xD0, 0xA1, 0xD0,
+0xF2, 0x24, 0xF7, 0xA0, 0x51, 0xA0, 0xF0, 0xD1, 0xF4, 0x25, 0xF4, 0x20, 0xF7, 0xD0, 0xA0, 0x51,
+0xA0, 0xF0, 0xD1, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x22, 0xF6, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0xF0,
+0xA0, 0x50, 0xF0, 0xD1, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50,
+0xA0, 0xD0, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0xD0, 0x70, 0x11, 0x40, 0xE0, 0x40, 0x70, 0x40, 0x60,
+0xC0, 0x30, 0x04, 0x40, 0x90, 0x00, 0x60, 0x80, 0xE0, 0x30, 0x00, 0xB0, 0x00, 0x30, 0x01, 0x40,
+0x30, 0x10, 0x90, 0x10, 0x30, 0xC1, 0x90, 0x31, 0xD0, 0x70, 0x80, 0x90, 0x10, 0x80, 0xD2, 0xA0,
+0x80, 0xA0, 0xD1, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x22, 0xF1, 0x50, 0xF0, 0xD0, 0xA0, 0x50, 0xF0,
+0x21, 0xF4, 0x24, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF2, 0x20, 0xF3, 0x20, 0xF2,
+0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0xD1, 0x70, 0x00, 0xE0, 0x30, 0x60, 0x31, 0x42, 0x0F, 0x00,
+0x80, 0x60, 0x01, 0x90, 0xB0, 0x04, 0xE0, 0x40, 0xE1, 0x00, 0x40, 0xE0, 0x05, 0xB0, 0x30, 0x40,
+0x30, 0x02, 0xB0, 0x90, 0x0F, 0x03, 0x40, 0x60, 0x04, 0x90, 0x30, 0xC0, 0x30, 0x00, 0x70, 0x02,
+0x80, 0xA0, 0xD3, 0xF1, 0xA0, 0x54, 0xA1, 0x90, 0x60, 0x00, 0x60, 0x70, 0x40, 0x03, 0x30, 0xE0,
+0x03, 0x06, 0x80, 0xC1, 0x30, 0x01, 0x60, 0x30, 0x02, 0x90, 0x06, 0x60, 0xE0, 0x41, 0xE1, 0xB1,
+0x04, 0xB0, 0x30, 0xD1, 0xF1, 0x50, 0x30, 0x01, 0xC0, 0xD0, 0x21, 0xF0, 0xD0, 0xA0, 0x80, 0x00,
+0x90, 0xD1, 0x30, 0x40, 0x10, 0xD0, 0xF0, 0x50, 0xC0, 0xD0, 0xA0, 0x20, 0xF4, 0x25, 0xF0, 0x22,
+0xF1, 0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0xFC, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xA1, 0xD0, 0xA0,
+0x51, 0xA0, 0xF3, 0x21, 0xFC, 0x27, 0xF1, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x20,
+0xF0, 0x21, 0xF2, 0xD1, 0x50, 0xA0, 0x50, 0xF0, 0xD0, 0x22, 0xF0, 0xD0, 0xC0, 0x11, 0xE0, 0x02,
+0x40, 0x90, 0x80, 0x90, 0xE0, 0x00, 0x90, 0x10, 0x40, 0x30, 0x10, 0x70, 0x11, 0x90, 0x10, 0xE0,
+0x60, 0x40, 0x10, 0x30, 0x40, 0x00, 0x60, 0x40, 0x10, 0x30, 0xD1, 0x50, 0x30, 0x10, 0xA0, 0x90,
+0x70, 0x40, 0x30, 0x00, 0x90, 0xC0, 0x70, 0x51, 0xD0, 0x10, 0x50, 0xD0, 0xF5, 0x20, 0xF0, 0x22,
+0xF2, 0x50, 0xA1, 0xF1, 0x20, 0xF7, 0x20, 0xF3, 0x50, 0xA0, 0xD0, 0xF1, 0x22, 0xF2, 0x22, 0xF2,
+0x22, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0xD0, 0x30, 0xE1, 0x30, 0x10, 0x60, 0xE0, 0x00, 0x90, 0xE0,
+0x0F, 0x00, 0x90, 0x02, 0x60, 0x80, 0x00, 0xB0, 0xE0, 0x40, 0xE0, 0xB0, 0x03, 0x60, 0x40, 0x05,
+0x80, 0xC0, 0x30, 0x80, 0xB0, 0x02, 0x30, 0xB0, 0x08, 0x10, 0x07, 0x90, 0xB0, 0x04, 0x40, 0x70,
+0x30, 0x01, 0x80, 0x60, 0x01, 0x40, 0x50, 0xA1, 0x52, 0xA1, 0xF0, 0xD1, 0xF0, 0xD0, 0xF0, 0xD0,
+0x30, 0x02, 0x10, 0x80, 0x00, 0xB0, 0x60, 0x30, 0x70, 0x04, 0x06, 0x70, 0x01, 0x70, 0xE0, 0x00,
+0x71, 0x80, 0x41, 0x70, 0x0B, 0xB0, 0x60, 0xE0, 0x40, 0xE1, 0x60, 0xB1, 0x90, 0xD1, 0xF0, 0xD0,
+0x30, 0x60, 0x00, 0x60, 0x30, 0xD0, 0x21, 0xF1, 0x50, 0x80, 0x00, 0x90, 0xD1, 0x30, 0x60, 0x70,
+0xE0, 0xC0, 0x80, 0xC0, 0x51, 0xF0, 0x20, 0xF5, 0x21, 0xF1, 0x22, 0xF9, 0xA0, 0x51, 0xA1, 0xF0,
+0xD1, 0xF3, 0x28, 0xF4, 0xA1, 0xD1, 0xF1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF2, 0x2A, 0xF2, 0x22,
+0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x50, 0xA0, 0xD1, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0x20, 0xF0, 0xD0,
+0x50, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0xD0, 0xC0, 0x11, 0xB0, 0x04, 0x60, 0x90, 0x30, 0xE0, 0xB0,
+0x40, 0x10, 0x70, 0x90, 0xC0, 0xB0, 0x10, 0x60, 0x40, 0x70, 0x01, 0x90, 0x70, 0x30, 0xB0, 0x90,
+0x80, 0xC0, 0xA0, 0xD0, 0xF0, 0xD0, 0x50, 0x30, 0xD0, 0xC0, 0x30, 0x40, 0x00, 0x60, 0xE0, 0x00,
+0x90, 0x30, 0x50, 0xD0, 0x11, 0x30, 0xD1, 0xF1, 0x21, 0xF3, 0x22, 0xD0, 0xA0, 0x50, 0xF0, 0xD0,
+0xF2, 0x21, 0xF2, 0x22, 0xF1, 0xA0, 0x50, 0xF1, 0x20, 0xF5, 0x24, 0xF2, 0x22, 0xF2, 0x20, 0xF0,
+0x20, 0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0x30, 0x60, 0x41, 0x00, 0x90, 0x60, 0xB0, 0x00, 0x81, 0x0D,
+0xB0, 0x80, 0x01, 0xB0, 0x60, 0x80, 0x40, 0x90, 0x40, 0x06, 0xB0, 0x30, 0x05, 0x70, 0xE0, 0x70,
+0x40, 0xE0, 0x02, 0x41, 0x07, 0xE0, 0x70, 0x80, 0x04, 0x60, 0x90, 0x30, 0x06, 0x10, 0x60, 0x01,
+0xE0, 0x80, 0x60, 0xE0, 0x40, 0x80, 0xA0, 0x20, 0xF0, 0x20, 0xD3, 0x20, 0xF3, 0xD0, 0x70, 0xE0,
+0x40, 0x80, 0x90, 0x80, 0xC0, 0x71, 0x40, 0x05, 0x06, 0x70, 0xB0, 0x00, 0xB0, 0xC0, 0xB0, 0x90,
+0x30, 0x00, 0x60, 0x80, 0x90, 0x0F, 0x01, 0xB1, 0x61, 0x90, 0x50, 0xA2, 0x30, 0x01, 0x30, 0xA0,
+0xF3, 0xD0, 0x30, 0xB0, 0xE0, 0x30, 0xD1, 0x80, 0x40, 0x80, 0x90, 0xC1, 0x80, 0xD0, 0x50, 0x24,
+0xF2, 0x24, 0xF1, 0x20, 0xF1, 0x25, 0xF1, 0xD0, 0xF0, 0xA1, 0x51, 0xA0, 0xF7, 0x25, 0xF1, 0xD1,
+0x50, 0xD0, 0xF0, 0x21, 0xF3, 0xA0, 0x51, 0xF0, 0xD0, 0xF3, 0x27, 0xF2, 0x21, 0xF0, 0x20, 0xF3,
+0x20, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xD0,
+0xF2, 0x21, 0xD1, 0xC0, 0x11, 0x08, 0x31, 0xC0, 0x30, 0x70, 0x40, 0x01, 0x60, 0x00, 0xB0, 0x10,
+0x01, 0xB0, 0x00, 0x70, 0x60, 0x40, 0x10, 0xD1, 0x21, 0xF0, 0xD1, 0xF0, 0xD0, 0x50, 0xC0, 0x00,
+0xC0, 0x30, 0x00, 0x90, 0x30, 0xA0, 0xD0, 0x10, 0x70, 0x10, 0xC0, 0xF0, 0xD0, 0x23, 0xF0, 0x20,
+0xF1, 0x21, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF4, 0xA0, 0x50, 0xA0, 0xF2, 0x22,
+0xF3, 0x25, 0xF1, 0x21, 0xF4, 0x20, 0xF1, 0xA0, 0x51, 0xA0, 0xD0, 0x50, 0x40, 0x30, 0x01, 0x90,
+0xB0, 0xE0, 0x01, 0x40, 0x90, 0x0C, 0x60, 0x80, 0xE1, 0xB0, 0xE0, 0xC0, 0x70, 0x40, 0x10, 0xB0,
+0x06, 0x90, 0x60, 0x03, 0xE0, 0x40, 0x00, 0xB0, 0x00, 0xC0, 0x70, 0x60, 0x00, 0x60, 0x80, 0x06,
+0xE0, 0x10, 0x00, 0x30, 0xE0, 0x03, 0x80, 0x90, 0x06, 0x40, 0x80, 0x41, 0xE0, 0xB0, 0x80, 0xE0,
+0x00, 0x40, 0x30, 0xD0, 0x20, 0xF4, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x70, 0x40, 0x60, 0x00,
+0x30, 0x04, 0x41, 0x03, 0x06, 0xE0, 0x70, 0x01, 0x80, 0x10, 0x30, 0x40, 0x01, 0xE0, 0x80, 0x0F,
+0x05, 0x10, 0xC0, 0xF0, 0xA0, 0x30, 0x41, 0xE0, 0x30, 0xA0, 0xD2, 0xF0, 0xD0, 0x90, 0x00, 0x80,
+0xA0, 0xF1, 0xD0, 0x70, 0x30, 0x40, 0x30, 0x10, 0x80, 0xD0, 0x50, 0x24, 0xF3, 0x23, 0xF5, 0x25,
+0xF3, 0x20, 0xF0, 0x20, 0xA0, 0x52, 0xA0, 0xF0, 0xD0, 0xF3, 0x21, 0xF2, 0x20, 0xF1, 0x50, 0xF1,
+0x22, 0xF3, 0xD0, 0xF0, 0xA0, 0x51, 0xF4, 0x2A, 0xF0, 0x20, 0xF1, 0x22, 0xF4, 0xA0, 0x50, 0xF0,
+0xD0, 0xF2, 0x21, 0xF2, 0xA0, 0x50, 0xD0, 0xF1, 0x22, 0xF1, 0xD0, 0xC0, 0x11, 0x40, 0x07, 0x90,
+0xB0, 0x00, 0xE0, 0x80, 0x30, 0x70, 0x80, 0x60, 0x01, 0x80, 0xC0, 0x90, 0x31, 0x40, 0x60, 0x40,
+0x30, 0xD0, 0x21, 0xF0, 0x20, 0xF3, 0xD0, 0x70, 0xE0, 0x02, 0xB0, 0x10, 0xC0, 0x10, 0x80, 0x60,
+0x71, 0x10, 0xD1, 0xF0, 0x22, 0xF2, 0x21, 0xF2, 0x50, 0xA0, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xD0,
+0xF0, 0x50, 0xA0, 0xD0, 0xF8, 0x2A, 0xF3, 0xD0, 0x80, 0x30, 0x51, 0xA0, 0x20, 0xD0, 0x50, 0xD0,
+0x50, 0xC0, 0x60, 0x00, 0x40, 0x80, 0x00, 0x40, 0x02, 0xB0, 0x70, 0xB0, 0x07, 0xE0, 0x40, 0xE0,
+0x70, 0x30, 0x00, 0x61, 0x10, 0xE0, 0x60, 0x90, 0x80, 0x40, 0x06, 0xB0, 0x30, 0x00, 0x90, 0x01,
+0x30, 0x60, 0x03, 0xB0, 0x70, 0x01, 0x80, 0x40, 0x05, 0x40, 0x80, 0x01, 0x90, 0x02, 0x30, 0x10,
+0x01, 0xB0, 0xE0, 0x41, 0xE0, 0x60, 0x30, 0x60, 0x03, 0xE0, 0x40, 0x00, 0xE0, 0x90, 0xD0, 0xF0,
+0x23, 0xF0, 0xD0, 0x20, 0xF0, 0x22, 0xD0, 0x90, 0xB0, 0x01, 0x30, 0x03, 0xE0, 0x40, 0x80, 0xB0,
+0x02, 0x0B, 0x30, 0x81, 0x01, 0x80, 0xE0, 0x0F, 0x04, 0xE0, 0x70, 0xD1, 0xA0, 0x70, 0x01, 0xE0,
+0x30, 0xA0, 0x52, 0xA1, 0x90, 0x00, 0x70, 0xF2, 0xD1, 0x30, 0x10, 0x70, 0xC0, 0xA2, 0x25, 0xF2,
+0x24, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x25, 0xF2, 0xD0, 0xF0, 0xA0, 0x52, 0xA0, 0xF8, 0xA1, 0xF0,
+0x22, 0xF1, 0x21, 0xF2, 0xD0, 0xF1, 0x51, 0xA0, 0xF0, 0xD0, 0xF4, 0x24, 0xF0, 0x25, 0xF5, 0xD0,
+0xF0, 0x51, 0xF6, 0x20, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0xD0, 0xC0, 0x11, 0xC0, 0x06, 0x40, 0xE0,
+0x40, 0x04, 0xC0, 0x11, 0x31, 0x90, 0x10, 0x30, 0x10, 0x41, 0x90, 0xD0, 0xF0, 0x22, 0xF1, 0x21,
+0x51, 0x70, 0x60, 0x02, 0x40, 0x00, 0x90, 0x70, 0x01, 0x40, 0x80, 0x10, 0xC0, 0xA0, 0xD3, 0xF1,
+0x23, 0xF1, 0xD0, 0x50, 0xF0, 0x21, 0xF2, 0xD0, 0x20, 0x51, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x20,
+0xF2, 0x25, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0xD0, 0xF1, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0,
+0x70, 0x80, 0x70, 0x30, 0x01, 0x70, 0x01, 0x61, 0x03, 0x90, 0x40, 0x01, 0xB0, 0x60, 0xE0, 0x40,
+0xE0, 0xB0, 0x00, 0xB0, 0x80, 0xE0, 0x70, 0xC0, 0x90, 0x40, 0x70, 0x00, 0x60, 0x30, 0x08, 0x11,
+0x71, 0x00, 0x30, 0x70, 0xB0, 0x03, 0xE0, 0x80, 0x00, 0x60, 0x70, 0x05, 0x30, 0x02, 0xE0, 0x80,
+0x00, 0x60, 0x31, 0xE0, 0x40, 0x60, 0xB0, 0x03, 0x80, 0xB0, 0x03, 0xB0, 0x30, 0x01, 0x90, 0xD0,
+0xF1, 0x21, 0xF1, 0xD0, 0xF0, 0x23, 0xD0, 0x30, 0x60, 0x01, 0x90, 0xB0, 0x02, 0xB0, 0x31, 0x03,
+0x0C, 0x40, 0x30, 0x80, 0x90, 0x10, 0x60, 0x0F, 0x04, 0x40, 0x30, 0xD1, 0x70, 0x02, 0x90, 0xD1,
+0xF2, 0x20, 0xA0, 0x30, 0x60, 0x30, 0x50, 0xA2, 0xF0, 0xD1, 0xA0, 0x50, 0xD0, 0x50, 0xF0, 0x25,
+0xF1, 0x21, 0xF1, 0x27, 0xF0, 0x20, 0xF0, 0x26, 0xF6, 0xD0, 0xF1, 0xA1, 0x50, 0xA1, 0xF0, 0xD1,
+0xF1, 0x50, 0xD0, 0x24, 0xF0, 0x27, 0xF1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF4, 0x20, 0xF3, 0x21,
+0xF1, 0x20, 0xF5, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x50, 0xF0, 0xD0,
+0xF2, 0x22, 0xF1, 0xA0, 0x70, 0xC0, 0x10, 0x70, 0x02, 0x30, 0xB0, 0x01, 0x30, 0x00, 0xB0, 0xE0,
+0x01, 0x70, 0x10, 0xC0, 0x90, 0x70, 0xC0, 0xE0, 0x00, 0x82, 0xB0, 0x60, 0x30, 0xD0, 0xF0, 0x22,
+0xF1, 0x20, 0xF2, 0xC0, 0xE0, 0x01, 0x40, 0x05, 0x60, 0x10, 0x00, 0x80, 0x10, 0xC0, 0x10, 0x90,
+0x50, 0xD0, 0xF0, 0x25, 0xF1, 0x50, 0xD0, 0xF3, 0xA0, 0x50, 0x20, 0xD0, 0xF0, 0x20, 0xF0, 0x21,
+0xF2, 0x26, 0xD0, 0xF0, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0,
+0xF2, 0x20, 0xD0, 0x50, 0x10, 0x30, 0xE0, 0x00, 0x80, 0xE0, 0x02, 0xE0, 0x04, 0x30, 0x80, 0xE1,
+0xB0, 0x04, 0xE0, 0x40, 0x04, 0x90, 0x01, 0x30, 0xB0, 0x07, 0x70, 0x40, 0x90, 0x40, 0x90, 0x80,
+0xB0, 0x30, 0x04, 0x90, 0x00, 0xB0, 0x90, 0x60, 0x04, 0x41, 0x60, 0xE0, 0x40, 0x80, 0x30, 0xB0,
+0x30, 0x80, 0xB0, 0x06, 0x80, 0x60, 0x04, 0x90, 0xB0, 0x00, 0x40, 0x10, 0xD0, 0xF0, 0x22, 0xF3,
+0x22, 0xD0, 0x50, 0x70, 0x90, 0x80, 0x90, 0x60, 0x09, 0x0C, 0x80, 0xB0, 0x01, 0xC0, 0xB0, 0x0F,
+0x04, 0x40, 0x50, 0xD0, 0x81, 0x01, 0xB0, 0x90, 0xD0, 0x21, 0xF2, 0xD0, 0x70, 0x00, 0x30, 0x50,
+0xA2, 0x52, 0xA0, 0xF1, 0x50, 0xF8, 0x22, 0xF2, 0x23, 0xF3, 0x26, 0xFB, 0xD0, 0xF0, 0xA1, 0x51,
+0xA0, 0xF1, 0x50, 0xD0, 0x23, 0xF2, 0x28, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF5,
+0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0xA0, 0x50, 0xA0, 0xD1, 0xA1, 0xD0, 0x21, 0xF2,
+0x21, 0xF0, 0xD0, 0x30, 0x10, 0x70, 0x10, 0x03, 0x30, 0x10, 0xE0, 0x00, 0x90, 0x01, 0x40, 0x01,
+0xB0, 0xE0, 0x80, 0x01, 0xB0, 0xE0, 0x90, 0x80, 0x03, 0x30, 0xC0, 0xF1, 0x21, 0xF0, 0x21, 0xF1,
+0xD0, 0xA0, 0x90, 0x40, 0x80, 0xE0, 0x01, 0xB0, 0xC0, 0x02, 0x60, 0x90, 0x00, 0x61, 0x10, 0xC0,
+0x10, 0x90, 0xD0, 0x20, 0xF0, 0x24, 0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x21,
+0xF1, 0x23, 0xF1, 0x23, 0xD0, 0x52, 0x30, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF5, 0x20,
+0xD0, 0xF0, 0x80, 0xD0, 0x90, 0x00, 0x40, 0x30, 0x02, 0x40, 0x00, 0xB0, 0x60, 0x40, 0xE0, 0xB0,
+0xE0, 0x30, 0x02, 0x80, 0x02, 0x80, 0x60, 0x03, 0x60, 0x80, 0x01, 0x41, 0x06, 0xE0, 0x70, 0xD0,
+0xC0, 0xD0, 0x90, 0xE1, 0x40, 0x04, 0x10, 0x01, 0x30, 0x40, 0xB0, 0x60, 0xE0, 0x40, 0xE0, 0x60,
+0x30, 0x03, 0x40, 0x30, 0x80, 0x00, 0x30, 0x06, 0x60, 0x80, 0x04, 0xB0, 0x90, 0x01, 0x40, 0x30,
+0xD0, 0x21, 0xF3, 0x22, 0xF0, 0xD0, 0x50, 0x80, 0x01, 0xE0, 0x40, 0x09, 0x0C, 0x30, 0x02, 0x70,
+0x0F, 0x05, 0xE0, 0x80, 0xA0, 0x70, 0x02, 0xE0, 0x80, 0xD0, 0x22, 0xF1, 0xD0, 0x90, 0x60, 0x70,
+0xD2, 0xF2, 0x20, 0xA1, 0x53, 0xA0, 0xF2, 0xD2, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x20, 0xF7, 0x23,
+0xFB, 0x20, 0xA1, 0x50, 0xA0, 0xD0, 0x22, 0xF4, 0x22, 0xF9, 0x20, 0xA0, 0x50, 0xA0, 0xF0, 0xD0,
+0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x25, 0xF1, 0xD0, 0xF0, 0x51, 0xA0, 0x50, 0xD0, 0x22,
+0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x20, 0xD0, 0x30, 0xC0, 0x70, 0x10, 0xE0, 0x01, 0x80, 0xE0, 0x70,
+0x00, 0x80, 0x60, 0x02, 0x40, 0x01, 0x40, 0xE0, 0x00, 0x90, 0xB0, 0x80, 0x10, 0xC0, 0x03, 0x40,
+0x90, 0x50, 0xD1, 0xF0, 0x20, 0xF2, 0xD0, 0xA1, 0x60, 0x70, 0x80, 0x60, 0x02, 0x40, 0x00, 0x80,
+0x31, 0x70, 0x01, 0x10, 0x90, 0x01, 0x10, 0x80, 0xD0, 0x20, 0xF6, 0x50, 0xD0, 0x50, 0xA0, 0xF2,
+0x2C, 0xF1, 0x20, 0x90, 0xF0, 0xD1, 0xF0, 0x51, 0xA0, 0xF0, 0xD0, 0x21, 0xF3, 0x20, 0xF1, 0xD0,
+0x80, 0xC0, 0xA0, 0xD0, 0x90, 0x01, 0x40, 0x30, 0x01, 0xE0, 0x40, 0xE0, 0xB0, 0x03, 0x60, 0x70,
+0x01, 0x10, 0x02, 0x41, 0x03, 0x60, 0x70, 0x01, 0xE0, 0x30, 0x06, 0x10, 0x30, 0xD0, 0x50, 0xD1,
+0x70, 0x30, 0x04, 0x60, 0x70, 0xE0, 0x40, 0x30, 0x80, 0x60, 0xB0, 0x03, 0x90, 0x04, 0x10, 0x60,
+0x00, 0x90, 0x07, 0x10, 0xB0, 0x04, 0xC0, 0xB0, 0x01, 0x10, 0x30, 0x29, 0xD1, 0x90, 0x01, 0xB0,
+0x80, 0x09, 0x0C, 0x70, 0x30, 0x80, 0x40, 0x70, 0x0F, 0x05, 0xB0, 0x71, 0x03, 0xB0, 0xC0, 0xF0,
+0x23, 0xF0, 0xD0, 0x50, 0x40, 0x70, 0x50, 0xA1, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0xF0, 0x50, 0xD0,
+0xF1, 0xA0, 0x52, 0xA1, 0xFA, 0x22, 0xF0, 0x21, 0xF3, 0x23, 0xF0, 0x20, 0xF3, 0x22, 0xF1, 0x21,
+0xF1, 0xD0, 0xA0, 0xF0, 0xD0, 0x22, 0xFD, 0x21, 0xF0, 0x21, 0xD1, 0xF0, 0x51, 0xA0, 0x20, 0xD0,
+0xF1, 0x20, 0xF1, 0x21, 0xF2, 0x25, 0xF1, 0x20, 0xD1, 0x51, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0xD0,
+0x30, 0xC0, 0x50, 0x12, 0x81, 0x02, 0x90, 0x01, 0xE0, 0xB0, 0x60, 0xB0, 0x00, 0x30, 0x80, 0xE0,
+0x30, 0x01, 0x10, 0x40, 0x00, 0x10, 0x80, 0x00, 0xE0, 0x00, 0xC0, 0x90, 0x80, 0xA0, 0xD0, 0xF0,
+0x20, 0xF0, 0xD0, 0xA0, 0x10, 0x50, 0x80, 0x40, 0x70, 0x00, 0x40, 0x02, 0x13, 0x40, 0x00, 0x40,
+0x01, 0x40, 0x90, 0x10, 0xD1, 0xF4, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0x21, 0xF1, 0x28, 0xF4, 0xD0,
+0xF1, 0xA0, 0x51, 0xF3, 0x20, 0xF1, 0x21, 0xF3, 0xA0, 0xF0, 0xC0, 0x50, 0xF0, 0xD0, 0x90, 0x02,
+0x40, 0x80, 0x00, 0xB0, 0x60, 0x06, 0xB0, 0x70, 0xB0, 0x00, 0x10, 0xE0, 0x00, 0x90, 0x04, 0x30,
+0x91, 0x40, 0x00, 0x30, 0x60, 0x01, 0x60, 0x11, 0x00, 0x70, 0x50, 0xD3, 0x71, 0xB0, 0xE1, 0x40,
+0x80, 0x90, 0x60, 0x01, 0x40, 0x80, 0x00, 0x80, 0x90, 0x01, 0xE0, 0x80, 0x04, 0xE0, 0xB0, 0x00,
+0x60, 0x30, 0x06, 0x10, 0xB0, 0x04, 0xB0, 0x80, 0x01, 0xE0, 0x80, 0xD0, 0xF0, 0x27, 0xF0, 0xD0,
+0x70, 0x40, 0x80, 0x30, 0x90, 0x09, 0x0C, 0x90, 0x00, 0xB0, 0x80, 0x90, 0x0F, 0x06, 0x40, 0xB0,
+0x04, 0x90, 0xD0, 0x25, 0xD0, 0x70, 0x10, 0x71, 0xA0, 0xF0, 0x20, 0xF1, 0xD0, 0xC0, 0x50, 0xA0,
+0xD1, 0xF4, 0x20, 0xA1, 0x52, 0xA1, 0xF6, 0x21, 0xF1, 0x20, 0xF6, 0x26, 0xF1, 0x23, 0xF2, 0x50,
+0xF1, 0x22, 0xF0, 0x25, 0xF5, 0x20, 0xF0, 0x22, 0xF2, 0xD1, 0xF0, 0xA1, 0x50, 0xA0, 0xF2, 0x24,
+0xF1, 0x26, 0xF2, 0x50, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF3, 0xA0, 0x80, 0xD0, 0x10, 0x90,
+0xB0, 0x70, 0x02, 0xB0, 0x80, 0x01, 0x80, 0xC0, 0x00, 0x40, 0x00, 0x80, 0x10, 0x90, 0xB0, 0x00,
+0x40, 0x10, 0x40, 0x91, 0x00, 0x60, 0x80, 0x00, 0x30, 0x00, 0x90, 0x70, 0x50, 0xD3, 0xF0, 0x10,
+0x30, 0x80, 0x01, 0x30, 0x90, 0x00, 0x70, 0x60, 0x70, 0x40, 0x82, 0x01, 0x80, 0x90, 0x30, 0x11,
+0x50, 0xD2, 0xF2, 0xA0, 0x50, 0xF0, 0x50, 0xF4, 0x24, 0xF0, 0x24, 0xF0, 0xD1, 0xF0, 0xA0, 0x51,
+0xA0, 0xF5, 0x23, 0xF1, 0x21, 0xF0, 0x50, 0x90, 0x30, 0xD1, 0xF0, 0x80, 0x40, 0x02, 0x90, 0x01,
+0x40, 0x07, 0xB0, 0x90, 0x41, 0x30, 0x00, 0x80, 0x40, 0x02, 0xB0, 0x10, 0x70, 0x60, 0x80, 0x30,
+0x00, 0xC0, 0x00, 0x40, 0x70, 0xD0, 0x90, 0x71, 0xD0, 0xA2, 0x50, 0xA0, 0x71, 0x02, 0xB0, 0x80,
+0x01, 0xB0, 0x90, 0x80, 0x00, 0x30, 0x40, 0x30, 0x00, 0x80, 0x60, 0x07, 0xB0, 0x30, 0x06, 0xC0,
+0x06, 0x90, 0x02, 0x10, 0xA0, 0xD0, 0xF1, 0x25, 0xF0, 0xD0, 0x90, 0xE0, 0xB0, 0x00, 0x90, 0x09,
+0x0C, 0x30, 0x01, 0x40, 0x30, 0x0F, 0x0D, 0x90, 0xD0, 0xF0, 0x24, 0xD0, 0xC0, 0x70, 0xC0, 0xF0,
+0xD0, 0x20, 0xF1, 0xD0, 0x50, 0xC0, 0xD0, 0xA0, 0xD0, 0xF3, 0x21, 0xF2, 0xD0, 0xF1, 0xA2, 0x52,
+0xA0, 0x22, 0xFA, 0x2D, 0xF0, 0xA1, 0xF0, 0x23, 0xF0, 0x26, 0xF2, 0x21, 0xF0, 0x24, 0xF7, 0xA0,
+0x50, 0xA0, 0xF9, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD1, 0xF1,
+0x22, 0xF0, 0xD1, 0x11, 0xB0, 0x03, 0x80, 0x40, 0x04, 0x60, 0xE0, 0x81, 0xC0, 0x80, 0x30, 0x60,
+0x30, 0x91, 0x01, 0x70, 0x40, 0x01, 0xE0, 0x80, 0x00, 0x30, 0x70, 0x32, 0xD0, 0xA0, 0x90, 0x60,
+0x01, 0xB0, 0x00, 0xB1, 0x80, 0x11, 0x80, 0x00, 0x10, 0x31, 0xE0, 0x00, 0x70, 0x80, 0x72, 0xC0,
+0x50, 0xD0, 0xA0, 0x50, 0xA0, 0xF2, 0xA0, 0xF1, 0x20, 0xF2, 0x21, 0xF7, 0xA0, 0x51, 0xA0, 0xF0,
+0xD0, 0xF0, 0x26, 0xF2, 0x22, 0xF1, 0xD0, 0x51, 0xD0, 0xF0, 0xD1, 0x90, 0xB0, 0x01, 0x30, 0x01,
+0x40, 0x09, 0x90, 0x02, 0xE0, 0x90, 0x02, 0x80, 0x60, 0xB0, 0x10, 0xB0, 0xE0, 0x80, 0x00, 0x30,
+0xC0, 0x80, 0xA1, 0x51, 0xA1, 0xF2, 0xD0, 0x70, 0x30, 0x00, 0xB0, 0x00, 0x40, 0x80, 0x01, 0x60,
+0xC0, 0x40, 0xE0, 0x40, 0x00, 0x40, 0x90, 0x70, 0x08, 0x80, 0xB0, 0x05, 0xB0, 0xC0, 0x06, 0x90,
+0x02, 0x31, 0xD0, 0xF1, 0x25, 0xF0, 0xD0, 0x30, 0xB0, 0x01, 0x30, 0x09, 0x0B, 0xB0, 0x80, 0x01,
+0x40, 0x80, 0x0F, 0x0D, 0x90, 0xD0, 0xF3, 0x21, 0xD0, 0xC0, 0x10, 0x70, 0xD0, 0x21, 0xF1, 0xD0,
+0x30, 0xC0, 0xA0, 0xF0, 0x20, 0xF0, 0x25, 0xF9, 0x20, 0xA1, 0x53, 0xA0, 0xF0, 0xD3, 0xF2, 0x25,
+0xF3, 0x23, 0xF0, 0xA1, 0xD0, 0x22, 0xF1, 0x29, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF6, 0xA0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x24, 0xF2, 0xA0, 0x50, 0xF2, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF0,
+0x22, 0xF0, 0xD0, 0x50, 0x10, 0x40, 0x04, 0xB0, 0x70, 0x05, 0x40, 0x80, 0x02, 0x10, 0xB0, 0x30,
+0xE0, 0x00, 0xB0, 0x30, 0x00, 0xE0, 0x00, 0xB0, 0x90, 0x03, 0x30, 0x40, 0x70, 0xA0, 0x81, 0x04,
+0x80, 0x90, 0x40, 0x60, 0xB0, 0xC1, 0x10, 0x60, 0x01, 0xE0, 0x70, 0x50, 0x71, 0x10, 0x70, 0x10,
+0x40, 0xA0, 0xF1, 0xD0, 0x20, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x23, 0xF3, 0xD1, 0xF0, 0x51, 0xA0,
+0xF5, 0x20, 0xF4, 0x26, 0xF1, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0xE0, 0x01, 0x30, 0x40, 0x00,
+0xE0, 0x09, 0x90, 0x02, 0x30, 0xE0, 0x02, 0x90, 0x01, 0x60, 0x10, 0x60, 0x30, 0xE0, 0x40, 0x90,
+0xA1, 0xF0, 0xD2, 0xF0, 0xD0, 0x90, 0xF0, 0xD1, 0x30, 0x90, 0x30, 0x00, 0x40, 0xC0, 0x01, 0xB0,
+0x30, 0x00, 0x30, 0xB0, 0x02, 0xE0, 0x08, 0x90, 0x07, 0xC0, 0x06, 0x90, 0x03, 0x70, 0xD0, 0xF0,
+0x23, 0xF3, 0xD0, 0x30, 0x60, 0x01, 0x30, 0xB0, 0x08, 0x0B, 0xE0, 0x70, 0x90, 0x30, 0xC0, 0x60,
+0x0F, 0x0C, 0xB0, 0x90, 0xD0, 0x20, 0xF1, 0x22, 0xD0, 0x70, 0x10, 0x30, 0xD0, 0xF0, 0x20, 0xF1,
+0xD0, 0x70, 0x90, 0xA0, 0xF0, 0x27, 0xF4, 0x23, 0xF2, 0xD0, 0xF0, 0xD0, 0x50, 0xA1, 0x53, 0xA1,
+0x20, 0xFA, 0x23, 0xF0, 0xA0, 0xF0, 0xD0, 0x22, 0xF1, 0x20, 0xF0, 0x28, 0xF1, 0x21, 0xF1, 0x22,
+0xF0, 0x25, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF6, 0xD0, 0x50, 0x20, 0xF4, 0xD0, 0xF0,
+0x50, 0xA0, 0xF3, 0x20, 0xD0, 0xC0, 0x11, 0x40, 0x04, 0x10, 0x05, 0x41, 0x04, 0x70, 0xE0, 0x60,
+0x40, 0xC0, 0xB0, 0x31, 0x90, 0x06, 0x40, 0x80, 0xA0, 0x10, 0x00, 0x10, 0x40, 0x02, 0x40, 0x60,
+0x81, 0x03, 0xE0, 0x90, 0x70, 0xD0, 0x50, 0x10, 0x40, 0x00, 0xB0, 0x90, 0x10, 0x50, 0xD0, 0xF0,
+0x21, 0xF1, 0x50, 0xF7, 0xD0, 0x20, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF0, 0x24, 0xF6, 0x24, 0xF0,
+0x20, 0xF3, 0x22, 0xD0, 0x80, 0x40, 0x02, 0x80, 0xE0, 0x60, 0xB0, 0x07, 0x41, 0x02, 0x30, 0x60,
+0x01, 0x80, 0x40, 0xE1, 0x60, 0x30, 0xC0, 0x00, 0x70, 0x30, 0x80, 0xD0, 0xF0, 0x20, 0xF4, 0xD0,
+0xF1, 0xD0, 0x70, 0x03, 0x80, 0x70, 0x00, 0xC0, 0x80, 0xE0, 0x30, 0x0C, 0x60, 0x80, 0x07, 0x10,
+0xB0, 0x05, 0x80, 0x60, 0x02, 0x30, 0x50, 0xF0, 0x23, 0xF3, 0xD0, 0x80, 0x70, 0x30, 0x90, 0x70,
+0xB0, 0x08, 0x0B, 0x40, 0x60, 0x01, 0x30, 0xB0, 0x0F, 0x0C, 0x80, 0x50, 0xD0, 0xF3, 0x21, 0xD0,
+0x50, 0x70, 0xF0, 0xD0, 0xC0, 0xD0, 0xF1, 0xD0, 0xC0, 0x30, 0xA0, 0xD0, 0xF2, 0x23, 0xF6, 0x23,
+0xF3, 0xD0, 0xF1, 0xD1, 0xF1, 0x20, 0xF0, 0xA1, 0x51, 0xA2, 0xF1, 0xD2, 0xF0, 0x21, 0xF0, 0x20,
+0xD0, 0x50, 0xF2, 0x23, 0xF2, 0x22, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xFA, 0xA0, 0x51, 0xA0,
+0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xD0, 0xF1, 0x20, 0xA0,
+0x50, 0xA0, 0xD1, 0xF0, 0xD0, 0x80, 0x70, 0x11, 0x04, 0x30, 0x70, 0x04, 0x80, 0x40, 0x02, 0xB0,
+0x31, 0x12, 0x40, 0x00, 0x30, 0xC0, 0xB0, 0x06, 0x60, 0x70, 0x30, 0x90, 0x80, 0x60, 0x05, 0x70,
+0x10, 0x00, 0xB0, 0x80, 0x10, 0xC0, 0x90, 0xA0, 0xD0, 0x70, 0x10, 0xB0, 0x30, 0x12, 0x50, 0xF2,
+0x21, 0xD0, 0x50, 0xF3, 0xD1, 0xF0, 0xA0, 0x50, 0xA0, 0xF5, 0x27, 0xF1, 0x20, 0xF1, 0x21, 0xF0,
+0x21, 0xF5, 0x22, 0xD0, 0x50, 0xC0, 0x02, 0x30, 0x60, 0x00, 0xE0, 0x06, 0xB0, 0x30, 0x00, 0xB1,
+0x60, 0xE0, 0x30, 0x40, 0xE0, 0x70, 0x01, 0xB0, 0xC0, 0x70, 0x10, 0x70, 0x00, 0x10, 0xD0, 0xF0,
+0x20, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x70, 0x10, 0x30, 0xB0, 0x01, 0x90, 0xB0, 0x70, 0x00,
+0x70, 0xB0, 0x0C, 0xE0, 0x80, 0x07, 0x10, 0xB0, 0x05, 0xE0, 0x80, 0x02, 0xE0, 0x80, 0xD0, 0xF0,
+0x23, 0xF0, 0x21, 0xD0, 0x50, 0x40, 0x01, 0x40, 0x60, 0x08, 0x0B, 0x80, 0xB0, 0x01, 0x70, 0xB0,
+0x0F, 0x0C, 0x90, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x30, 0xD0, 0xF1, 0xD0,
+0x10, 0x80, 0xA0, 0xD0, 0xF2, 0x24, 0xF0, 0x21, 0xF2, 0x25, 0xF7, 0x20, 0xF5, 0xA2, 0x52, 0xA1,
+0x21, 0xF0, 0xD2, 0x50, 0xF2, 0x23, 0xF1, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x24, 0xF3, 0x28,
+0xF0, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD1, 0x50, 0xF6, 0x22, 0xF1, 0xA0, 0x50, 0xA0, 0xF0,
+0xD1, 0x10, 0x30, 0x10, 0xE0, 0x03, 0xB0, 0x30, 0x60, 0x03, 0x90, 0x00, 0x40, 0x03, 0x30, 0x11,
+0xC0, 0x30, 0x00, 0x30, 0xE0, 0x08, 0x30, 0x70, 0x40, 0xC0, 0x02, 0xB0, 0x70, 0xB0, 0x00, 0x60,
+0x70, 0x00, 0x10, 0x80, 0x30, 0x70, 0xC0, 0x50, 0xD0, 0x80, 0x30, 0x70, 0x90, 0x10, 0x80, 0x50,
+0xA0, 0xD0, 0x23, 0xF0, 0xA1, 0xD1, 0xF0, 0xA1, 0x50, 0xA0, 0xF5, 0x26, 0xF2, 0x21, 0xFD, 0x21,
+0xF1, 0xD0, 0x90, 0xB0, 0x00, 0x40, 0x80, 0x01, 0x40, 0x04, 0xB1, 0x80, 0x41, 0xE0, 0x60, 0xB0,
+0x00, 0x70, 0x01, 0x60, 0x90, 0x00, 0x60, 0x10, 0xC0, 0x11, 0x90, 0x70, 0xD0, 0x28, 0x50, 0x20,
+0xD1, 0x50, 0x10, 0xC0, 0x70, 0x91, 0x40, 0xC0, 0x60, 0x30, 0x0E, 0x90, 0x07, 0x10, 0xB0, 0x05,
+0xB0, 0x30, 0x02, 0x60, 0x90, 0xD1, 0xF6, 0xD0, 0x50, 0x40, 0x01, 0xE1, 0x08, 0x0B, 0x80, 0x30,
+0x40, 0xE0, 0x10, 0xB0, 0x0F, 0x0B, 0xB0, 0x90, 0xD0, 0xF0, 0x25, 0xF2, 0x21, 0xD0, 0xF0, 0x20,
+0xF0, 0xD0, 0x10, 0x90, 0xA0, 0xF2, 0x25, 0xF0, 0x29, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xF0,
+0x23, 0xFA, 0xA1, 0x53, 0xA0, 0x50, 0xD0, 0xF0, 0xD1, 0xF1, 0x28, 0xF1, 0x23, 0xF0, 0x20, 0xF1,
+0x2F, 0x00, 0xF4, 0x20, 0xA0, 0x51, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xD0, 0xF1,
+0x51, 0xF0, 0xD0, 0x80, 0x11, 0x90, 0x02, 0xB0, 0x90, 0x00, 0x90, 0x02, 0xB0, 0x80, 0x00, 0x60,
+0xB0, 0x02, 0x30, 0x90, 0x30, 0xC1, 0xB0, 0x30, 0x08, 0x60, 0xE0, 0x30, 0x10, 0xC0, 0x02, 0xE0,
+0x10, 0x00, 0xC0, 0x80, 0x10, 0xB0, 0x10, 0x30, 0x80, 0x70, 0xB0, 0xD0, 0x50, 0xA0, 0x30, 0xD0,
+0xF0, 0x50, 0xD2, 0xF0, 0x23, 0xF1, 0x50, 0xF0, 0x51, 0xA0, 0xF6, 0x20, 0xF2, 0x21, 0xF6, 0x2F,
+0x03, 0xD0, 0x50, 0x40, 0xB0, 0x90, 0x02, 0xE0, 0x60, 0xE0, 0x41, 0xE0, 0x60, 0x90, 0x80, 0x05,
+0xC0, 0x01, 0xB0, 0x10, 0xC0, 0x00, 0xB0, 0x00, 0xE0, 0x10, 0xC0, 0x70, 0xD0, 0x26, 0xF1, 0xC0,
+0x21, 0xF0, 0xD1, 0xA0, 0xF0, 0xA0, 0x50, 0x30, 0x11, 0x30, 0x0E, 0x80, 0xE0, 0x06, 0x90, 0x60,
+0x05, 0xB0, 0x30, 0x03, 0x70, 0xA0, 0xD1, 0xF3, 0xD0, 0xF0, 0xD0, 0x50, 0x30, 0xE0, 0x40, 0x90,
+0x40, 0x08, 0x0B, 0x30, 0x61, 0xE0, 0x10, 0xE0, 0x44, 0xE2, 0x61, 0xB0, 0x0F, 0x00, 0x40, 0x50,
+0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0xD1, 0xC0, 0xA0, 0xD0, 0x20,
+0xF0, 0x24, 0xF2, 0x29, 0xF0, 0x20, 0x51, 0xD0, 0x70, 0x50, 0x2A, 0xF0, 0x22, 0xF2, 0xD0, 0xF1,
+0x55, 0xA0, 0x20, 0xD1, 0xFA, 0x21, 0xF1, 0x21, 0xF3, 0x2F, 0x02, 0xF0, 0xD0, 0xF0, 0x50, 0xA0,
+0xD0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD2, 0x20, 0x50, 0xA0, 0xD0, 0x12, 0x30,
+0x80, 0xB0, 0x90, 0x00, 0xB0, 0x30, 0x60, 0x01, 0x60, 0x80, 0x00, 0x90, 0x30, 0x02, 0x30, 0xE0,
+0x10, 0x80, 0x10, 0x40, 0x30, 0x00, 0x60, 0x30, 0x05, 0x40, 0x00, 0x40, 0x70, 0x90, 0x00, 0x60,
+0x00, 0xE0, 0x30, 0x00, 0xB0, 0xC0, 0x60, 0x10, 0x30, 0x60, 0x30, 0xC0, 0xD0, 0x80, 0x71, 0xD1,
+0xF1, 0x21, 0xF0, 0x23, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF4, 0x21, 0xF8, 0x24,
+0xF3, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xF0, 0xD1, 0xA0, 0x80, 0x30, 0xE1, 0x42, 0xE0, 0x04, 0xC0,
+0x06, 0x80, 0xE0, 0x00, 0x90, 0x00, 0xE0, 0x90, 0x01, 0x60, 0x30, 0x70, 0x80, 0xD0, 0xF0, 0x24,
+0xF1, 0xD1, 0xF6, 0x21, 0xD0, 0xA0, 0x10, 0x80, 0x0F, 0x00, 0x90, 0x06, 0x90, 0x07, 0x30, 0x03,
+0x30, 0x80, 0xA2, 0x56, 0x70, 0xE0, 0x60, 0xE0, 0x40, 0x08, 0x0B, 0x30, 0x02, 0x10, 0x07, 0xB1,
+0x61, 0xE0, 0x43, 0xE1, 0x63, 0xB1, 0x02, 0x80, 0xA0, 0xD0, 0xF8, 0xD0, 0x90, 0x23, 0xF0, 0xD0,
+0x80, 0xC0, 0xA0, 0xD0, 0x21, 0xF0, 0x23, 0xF8, 0x23, 0xF1, 0x20, 0xD0, 0xF0, 0x51, 0xF0, 0x23,
+0xF6, 0x22, 0xF4, 0xD0, 0xA0, 0xF0, 0xD0, 0xF1, 0x20, 0xA0, 0x53, 0xA1, 0xF1, 0xD3, 0xF4, 0x26,
+0xF6, 0x24, 0xF1, 0x24, 0xF0, 0xD0, 0x50, 0x23, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0xF1, 0xA0,
+0x50, 0x80, 0x10, 0x30, 0x00, 0xB0, 0x30, 0xC0, 0x30, 0xE0, 0x90, 0xB0, 0x01, 0x40, 0xE0, 0xB0,
+0x70, 0x60, 0xE0, 0x01, 0x90, 0x00, 0x80, 0x90, 0x70, 0x90, 0x80, 0x00, 0x40, 0x10, 0x80, 0x03,
+0xE0, 0x03, 0x30, 0x60, 0x30, 0x03, 0x41, 0x80, 0xC0, 0x80, 0x70, 0xC0, 0x90, 0x30, 0x50, 0x30,
+0x11, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF3, 0xA1, 0x21, 0xF6, 0x2A, 0xF1, 0x20, 0xF2, 0x27, 0xF4,
+0xA1, 0x52, 0x91, 0x40, 0x02, 0x60, 0xB0, 0x03, 0x30, 0xE0, 0x07, 0xC0, 0x30, 0x10, 0x01, 0x80,
+0x60, 0x02, 0x30, 0xF0, 0xD0, 0xF9, 0x21, 0xF0, 0x20, 0xF1, 0x22, 0xD1, 0x50, 0x90, 0x60, 0x0E,
+0x80, 0x60, 0x04, 0x41, 0x00, 0xB1, 0x61, 0xE2, 0x30, 0xE0, 0x40, 0xE0, 0x60, 0xE0, 0x80, 0xF0,
+0x21, 0xF4, 0xD0, 0xF0, 0x90, 0x01, 0xB0, 0x80, 0x08, 0x0B, 0x30, 0x02, 0x70, 0x0F, 0x02, 0xB2,
+0x62, 0xE1, 0x40, 0xE0, 0x30, 0x50, 0xA3, 0x20, 0xF0, 0x20, 0xF4, 0xD0, 0xF1, 0xD1, 0x50, 0xC0,
+0x70, 0xE0, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF8, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF9,
+0x23, 0xF0, 0x23, 0xF1, 0xD0, 0x50, 0x20, 0xF4, 0xD0, 0xF2, 0xA1, 0x52, 0xA1, 0xF7, 0x20, 0xF1,
+0x22, 0xF5, 0x24, 0xF1, 0x21, 0xF4, 0x50, 0xF0, 0x23, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x20, 0xF1,
+0xD0, 0x30, 0x91, 0xE0, 0x01, 0xB0, 0x40, 0x10, 0x81, 0x90, 0x30, 0x40, 0x30, 0xE0, 0x02, 0xE0,
+0x01, 0x90, 0x01, 0x10, 0x40, 0x90, 0x30, 0x00, 0x10, 0x90, 0x00, 0xE0, 0xC0, 0x00, 0xB0, 0xE0,
+0x03, 0x90, 0x02, 0x90, 0xC0, 0x00, 0x80, 0x60, 0xC0, 0x70, 0xC0, 0x40, 0xB0, 0x80, 0x13, 0x70,
+0xD0, 0xF2, 0x20, 0xF1, 0x21, 0xF3, 0xD0, 0x50, 0x20, 0xF2, 0x27, 0xF1, 0x27, 0xF2, 0x20, 0xF5,
+0x21, 0xA1, 0x52, 0xA1, 0xF1, 0xD0, 0xA0, 0x91, 0x40, 0x01, 0xB0, 0x60, 0x02, 0x80, 0x10, 0x07,
+0x80, 0xC0, 0x60, 0xB0, 0x01, 0x60, 0x80, 0x02, 0x90, 0xD0, 0xF8, 0x20, 0xF0, 0x21, 0xF3, 0x23,
+0xF0, 0xD0, 0xA0, 0x70, 0xE0, 0x0B, 0xB1, 0xE0, 0x80, 0x60, 0xE1, 0x41, 0x30, 0xE2, 0x60, 0xB3,
+0x00, 0x90, 0x03, 0xB0, 0x90, 0xD0, 0xF3, 0x22, 0xF1, 0x90, 0x01, 0x60, 0x80, 0x08, 0x0B, 0x70,
+0x31, 0x91, 0x0F, 0x0C, 0x70, 0xA0, 0xF0, 0xA3, 0x55, 0x30, 0xA3, 0xD0, 0x50, 0x70, 0x90, 0xE0,
+0xD0, 0xF0, 0xD1, 0xF5, 0x20, 0xF6, 0x24, 0xF3, 0x20, 0xF3, 0x21, 0xF0, 0x22, 0xF0, 0x23, 0xF0,
+0x21, 0xF1, 0xD0, 0x50, 0xF0, 0x20, 0xF2, 0x20, 0xF9, 0xA0, 0x53, 0xA1, 0xF0, 0xD1, 0xF4, 0x27,
+0xF2, 0x21, 0xF0, 0x21, 0xF3, 0xA0, 0xD0, 0x21, 0xF2, 0x23, 0xF1, 0x22, 0xF0, 0x20, 0xD1, 0x90,
+0xC0, 0x00, 0xE1, 0x01, 0x40, 0xC0, 0xB0, 0x80, 0x01, 0xE0, 0x81, 0x30, 0x90, 0x31, 0x40, 0x60,
+0x70, 0xB0, 0x03, 0xC0, 0x80, 0x02, 0x40, 0x10, 0x00, 0xE0, 0x03, 0xB0, 0x10, 0x60, 0x01, 0x41,
+0x01, 0xB0, 0x10, 0x90, 0x40, 0x80, 0x01, 0x11, 0x80, 0xC0, 0xF0, 0x22, 0xF1, 0x23, 0xF0, 0x20,
+0xF2, 0xA0, 0xF3, 0x22, 0xF4, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0xD2, 0xF0, 0xA1,
+0x52, 0xA1, 0xF4, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0x10, 0x60, 0x00, 0xB0, 0xE0, 0x02, 0x80,
+0x60, 0x03, 0x40, 0x02, 0x10, 0x40, 0x04, 0x90, 0x02, 0x90, 0xD0, 0xF1, 0x24, 0xF2, 0x24, 0xF1,
+0xD3, 0xF0, 0xD0, 0xA0, 0xE0, 0x90, 0x40, 0x00, 0xB0, 0x61, 0xE0, 0x42, 0xE3, 0x60, 0xB0, 0x80,
+0x60, 0xB0, 0x00, 0xB0, 0xC1, 0x08, 0x90, 0x04, 0x90, 0xD0, 0x21, 0xF0, 0x24, 0xD0, 0x70, 0x32,
+0x90, 0x08, 0x0B, 0x30, 0x02, 0x90, 0x0F, 0x0C, 0x70, 0xD1, 0xF0, 0xD7, 0xA0, 0xC0, 0xD0, 0xA2,
+0x50, 0xA0, 0x90, 0x80, 0x53, 0xA3, 0x21, 0xFF, 0x07, 0x27, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0xD0,
+0x50, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF3, 0xD1, 0xF0, 0xA1, 0x53, 0xA0, 0xFE,
+0x21, 0xF3, 0xD0, 0x50, 0xF2, 0x21, 0xF2, 0x21, 0xF0, 0x25, 0xF1, 0xD0, 0x90, 0x30, 0x80, 0x60,
+0xB0, 0x80, 0xB0, 0x90, 0x00, 0x30, 0xE0, 0x05, 0x60, 0x00, 0xE0, 0x70, 0x81, 0x30, 0x90, 0x30,
+0x10, 0x30, 0x90, 0x10, 0x31, 0x01, 0x10, 0xC0, 0x90, 0x04, 0xE0, 0x40, 0x70, 0x10, 0x60, 0x02,
+0x40, 0x80, 0x40, 0x00, 0x90, 0xE0, 0x70, 0x10, 0xC0, 0x10, 0xA0, 0x22, 0xF0, 0x20, 0xF2, 0x23,
+0xF1, 0xD0, 0xA1, 0xD0, 0xF1, 0x25, 0xFB, 0xA1, 0x53, 0xA0, 0xF1, 0xD3, 0xF3, 0x25, 0xF0, 0xD1,
+0x70, 0x60, 0x00, 0x40, 0x90, 0xC0, 0x92, 0x02, 0x60, 0x10, 0xC0, 0x80, 0xE0, 0x70, 0x05, 0x40,
+0x80, 0x00, 0x60, 0x30, 0xD0, 0xF8, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xA3, 0x54, 0x40, 0x30, 0xE0,
+0x61, 0xB1, 0x08, 0xE0, 0x40, 0x01, 0x80, 0x70, 0xB0, 0xC0, 0x06, 0x60, 0xC0, 0x03, 0xB0, 0x30,
+0xD0, 0x21, 0xF0, 0x24, 0xD0, 0x70, 0x02, 0x30, 0x08, 0x0B, 0x30, 0x01, 0x60, 0x30, 0x0F, 0x0B,
+0x60, 0x30, 0xD0, 0x20, 0xF1, 0x21, 0xF3, 0x20, 0xD0, 0x30, 0x90, 0xD0, 0xF0, 0xD1, 0x30, 0x10,
+0x30, 0xC0, 0xD0, 0x20, 0xF1, 0xA2, 0x55, 0xA6, 0xF0, 0xD2, 0xF0, 0xD0, 0xF0, 0xD0, 0xF2, 0x27,
+0xF8, 0xD0, 0x50, 0xD0, 0x20, 0xF6, 0x25, 0xFC, 0xA0, 0x52, 0xA1, 0xF1, 0xD1, 0xF3, 0x23, 0xF3,
+0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x40, 0x00, 0x60,
+0x81, 0x90, 0x31, 0x00, 0x70, 0xB0, 0x00, 0xB0, 0x01, 0xB0, 0xC1, 0x00, 0xE0, 0x70, 0x30, 0x60,
+0x02, 0x90, 0x00, 0xC0, 0xB0, 0x91, 0xC0, 0x10, 0xC0, 0x80, 0x70, 0x10, 0x60, 0x02, 0xE0, 0x10,
+0x00, 0xE0, 0x70, 0xB1, 0x40, 0x00, 0xE0, 0x80, 0x01, 0x11, 0x40, 0x10, 0xA0, 0xF0, 0x22, 0xF0,
+0x20, 0xF1, 0x24, 0xF3, 0x50, 0xD0, 0xF3, 0x22, 0xF3, 0xD1, 0xF0, 0xA2, 0x52, 0xA1, 0x20, 0xFE,
+0x23, 0xF2, 0xD1, 0x70, 0xB0, 0x80, 0x03, 0x31, 0x60, 0x00, 0x90, 0x60, 0xB0, 0x70, 0x10, 0x03,
+0xC0, 0x02, 0x40, 0xC0, 0x90, 0x50, 0xD0, 0xF3, 0xA3, 0x57, 0xA2, 0xF4, 0xA0, 0xD0, 0xC0, 0x0E,
+0x70, 0x40, 0x00, 0x91, 0x00, 0xB0, 0x90, 0xE0, 0x80, 0xB0, 0x02, 0x30, 0x80, 0x40, 0x02, 0xE0,
+0x80, 0xD0, 0xF4, 0x20, 0xF0, 0x20, 0xD0, 0x90, 0x02, 0x30, 0x08, 0x0B, 0xC0, 0xE1, 0x80, 0x30,
+0x0F, 0x0B, 0x30, 0xA0, 0xF1, 0x25, 0xF8, 0xD0, 0xA0, 0x10, 0x30, 0x10, 0xD0, 0xF3, 0xD0, 0xF7,
+0xA5, 0x53, 0xA3, 0xF1, 0x21, 0xFB, 0xD0, 0xF1, 0xD1, 0x50, 0xF8, 0x2D, 0xF0, 0x20, 0xF2, 0xD1,
+0xF1, 0xA2, 0x52, 0xA0, 0xF1, 0x20, 0xF1, 0xD2, 0xF1, 0x20, 0x50, 0xD0, 0xF0, 0x24, 0xF1, 0x23,
+0xF1, 0x21, 0xD0, 0xF0, 0x70, 0x05, 0xB0, 0x90, 0x60, 0x90, 0xB0, 0x00, 0x80, 0x05, 0x80, 0xB0,
+0x40, 0x30, 0x02, 0x30, 0xB0, 0x30, 0xE0, 0x00, 0xE0, 0x70, 0x40, 0x90, 0x30, 0x80, 0x10, 0x70,
+0x03, 0x40, 0x90, 0x30, 0xB0, 0x40, 0x31, 0x60, 0x10, 0xE0, 0x00, 0xC0, 0x30, 0x80, 0x10, 0x90,
+0xD0, 0x22, 0xF1, 0x20, 0xF3, 0x22, 0xF3, 0x50, 0xF7, 0x20, 0xF1, 0xA0, 0x52, 0xA2, 0xF1, 0xD0,
+0xF3, 0x28, 0xF4, 0x23, 0xF3, 0xD0, 0x31, 0x80, 0x04, 0x40, 0x30, 0x90, 0x70, 0x02, 0x40, 0x30,
+0x02, 0x10, 0x90, 0x00, 0xB1, 0xC0, 0x30, 0xA0, 0x54, 0xA4, 0xF3, 0xD3, 0xF6, 0x50, 0xD0, 0x50,
+0x30, 0x0E, 0x40, 0x90, 0x30, 0x80, 0x01, 0xE0, 0x80, 0x91, 0x01, 0xE0, 0x30, 0x00, 0x90, 0x02,
+0x80, 0x50, 0xD0, 0xF6, 0x20, 0xD0, 0x90, 0xE1, 0x40, 0x70, 0x08, 0x04, 0x31, 0x04, 0x70, 0xE0,
+0x40, 0x90, 0x80, 0x0F, 0x0B, 0x10, 0xD0, 0xF9, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0x50, 0x80, 0x10,
+0xD0, 0x20, 0xFF, 0x03, 0xD1, 0x20, 0xF2, 0xA2, 0x56, 0xA2, 0xF3, 0xD1, 0xF2, 0xA0, 0xF0, 0x23,
+0xF3, 0x22, 0xF0, 0x2C, 0xFA, 0x20, 0xA1, 0x53, 0xA0, 0xF2, 0xD0, 0xF0, 0xA0, 0xD0, 0xF3, 0x20,
+0xF2, 0x23, 0xF2, 0x20, 0xD0, 0x31, 0x05, 0x30, 0x60, 0x00, 0x40, 0x80, 0x60, 0x06, 0x30, 0xB0,
+0x00, 0x80, 0x60, 0x01, 0x80, 0xB0, 0xE0, 0x00, 0x60, 0x11, 0x70, 0x40, 0x80, 0x30, 0x90, 0x11,
+0xC0, 0x10, 0x80, 0x01, 0x82, 0x11, 0x80, 0xC0, 0x40, 0xC0, 0x90, 0xD1, 0x30, 0xD0, 0xF0, 0x24,
+0xF5, 0x25, 0x50, 0xF0, 0xD1, 0xF0, 0xA1, 0x52, 0xA2, 0xF0, 0xD1, 0xF3, 0x21, 0xF1, 0x21, 0xF6,
+0x2A, 0xF2, 0x21, 0xA0, 0xC0, 0xE0, 0x05, 0x80, 0x70, 0x60, 0xB0, 0x60, 0xE1, 0x70, 0x80, 0xE2,
+0x40, 0x60, 0xB0, 0x10, 0x50, 0xF1, 0xD1, 0xF2, 0xD1, 0xFB, 0x22, 0xF2, 0x50, 0xF0, 0xD0, 0x80,
+0x90, 0x0E, 0x40, 0x70, 0x80, 0x04, 0x30, 0x60, 0xC0, 0x10, 0x01, 0x30, 0x60, 0x01, 0x90, 0xD0,
+0xF0, 0x21, 0xF2, 0x22, 0xD0, 0x90, 0x80, 0x40, 0xE0, 0x70, 0x08, 0x03, 0x40, 0xE0, 0x40, 0xE0,
+0x03, 0x30, 0x01, 0x40, 0x80, 0x0F, 0x0B, 0xC0, 0xD1, 0x20, 0xF9, 0x20, 0xF0, 0x23, 0xF0, 0xD0,
+0x50, 0xC0, 0xF1, 0x20, 0xF9, 0x24, 0xF1, 0x21, 0xF0, 0xD0, 0xF3, 0xD7, 0xF1, 0xA2, 0x55, 0xA0,
+0x50, 0xA0, 0xF0, 0x22, 0xF3, 0x21, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0x29, 0xF0, 0x28, 0xF1, 0xD1,
+0xF0, 0xA1, 0x51, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0x90,
+0x06, 0x70, 0x02, 0x10, 0x30, 0x70, 0x81, 0x40, 0x60, 0xB0, 0x00, 0x90, 0x32, 0x90, 0x31, 0xC0,
+0xE0, 0x60, 0x40, 0x90, 0x60, 0x00, 0x40, 0x30, 0x90, 0x10, 0x70, 0x12, 0x70, 0x10, 0x30, 0x40,
+0x00, 0x60, 0xC0, 0x00, 0x80, 0x90, 0x40, 0x30, 0x70, 0xD0, 0xF0, 0x20, 0xD0, 0xF0, 0x24, 0xF1,
+0x20, 0xF3, 0x21, 0xF0, 0x22, 0xA0, 0x53, 0xA1, 0xF0, 0xD4, 0xF2, 0x29, 0xF6, 0x2A, 0xF1, 0x22,
+0xD0, 0x90, 0x41, 0xE1, 0x90, 0x40, 0xC0, 0x40, 0x62, 0xB1, 0x01, 0x10, 0xB0, 0x03, 0x30, 0x70,
+0xD2, 0x24, 0xF1, 0x21, 0xF1, 0x20, 0xF4, 0x25, 0xF1, 0x50, 0xD0, 0xF0, 0xD0, 0x50, 0x90, 0x0D,
+0x91, 0x40, 0x04, 0xB0, 0xC0, 0x60, 0x30, 0x02, 0x70, 0x01, 0x90, 0xD0, 0xF0, 0x27, 0xD0, 0x30,
+0xB0, 0x01, 0x90, 0x08, 0x04, 0x81, 0x03, 0xB0, 0x80, 0x01, 0x80, 0x40, 0x0F, 0x0A, 0xB0, 0x30,
+0xD0, 0xF6, 0x22, 0xF0, 0x20, 0xF0, 0x25, 0xF0, 0x80, 0x10, 0xD0, 0xF0, 0x23, 0xF5, 0x27, 0xF0,
+0x21, 0x51, 0x21, 0xF0, 0x25, 0xF9, 0x23, 0xA0, 0xF1, 0x20, 0xF5, 0x21, 0xF8, 0x2E, 0xF0, 0x21,
+0xF1, 0x22, 0xF4, 0xD0, 0xF0, 0x50, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF2, 0x25, 0xF1, 0xD0, 0xC0,
+0x30, 0xC0, 0x90, 0x02, 0x60, 0x80, 0x02, 0xB0, 0x60, 0x70, 0x80, 0x42, 0x80, 0x90, 0xC0, 0x01,
+0x80, 0x90, 0x01, 0x30, 0xE1, 0x00, 0x90, 0x00, 0xB0, 0xE0, 0x00, 0xC0, 0x90, 0x10, 0xB0, 0xE0,
+0xC0, 0x90, 0x80, 0x30, 0x80, 0x90, 0x10, 0xC0, 0x00, 0xB0, 0x10, 0x80, 0x90, 0x30, 0xD0, 0xF1,
+0x21, 0xF1, 0x20, 0xF5, 0x24, 0xF3, 0xA0, 0x50, 0xD0, 0xFC, 0x25, 0xF1, 0x2F, 0x01, 0xF4, 0x22,
+0xD0, 0x50, 0x80, 0x00, 0x60, 0x10, 0x30, 0xC0, 0x60, 0x07, 0x80, 0xE0, 0x02, 0xB0, 0x10, 0xD0,
+0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x21, 0xF3, 0x23, 0xF2, 0x23, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xD0,
+0x90, 0xB0, 0x0C, 0x10, 0xB0, 0x08, 0x30, 0x02, 0x30, 0xB1, 0x30, 0xD0, 0xF0, 0x27, 0xD0, 0x30,
+0x60, 0x01, 0x30, 0x08, 0x06, 0xE1, 0x60, 0x00, 0xB0, 0xC0, 0x90, 0x30, 0xC0, 0x40, 0x0F, 0x0A,
+0xB0, 0x90, 0xD0, 0xF0, 0x21, 0xF1, 0x24, 0xF1, 0x21, 0xF1, 0x22, 0xF0, 0x50, 0x40, 0x50, 0xF1,
+0x24, 0xF3, 0x27, 0xF2, 0xD0, 0x21, 0xF0, 0x28, 0xF0, 0x29, 0xF0, 0x50, 0xF1, 0x20, 0xF4, 0x23,
+0xF6, 0x21, 0xF4, 0x25, 0xF1, 0x22, 0xF0, 0x22, 0xF1, 0x24, 0xF1, 0x50, 0xF0, 0x25, 0xF2, 0x26,
+0xD0, 0x50, 0x80, 0x00, 0x60, 0x40, 0x70, 0x30, 0xE0, 0x80, 0x60, 0x02, 0xE0, 0x00, 0x30, 0x01,
+0x60, 0xE0, 0x01, 0x30, 0x01, 0x70, 0xE1, 0x00, 0xE2, 0x00, 0x31, 0xE0, 0x01, 0xC0, 0x30, 0x80,
+0x00, 0x80, 0x90, 0xC0, 0x01, 0x10, 0xC0, 0x70, 0x60, 0x01, 0xC0, 0x90, 0x30, 0x10, 0x90, 0xD0,
+0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF2, 0x23, 0xF4, 0xD0, 0x50, 0xD0, 0xF3, 0x21, 0xF2, 0x2F, 0x0E,
+0xF2, 0x23, 0xF0, 0x80, 0x90, 0x30, 0x91, 0x80, 0x30, 0x90, 0x02, 0x70, 0x90, 0x80, 0x30, 0x80,
+0x70, 0x30, 0x02, 0xE0, 0x30, 0xD0, 0x20, 0xF0, 0x26, 0xF0, 0x28, 0xF0, 0x27, 0x50, 0xF1, 0x20,
+0xD0, 0x50, 0x40, 0x0B, 0x40, 0x70, 0x08, 0x60, 0x80, 0x02, 0x60, 0x80, 0x60, 0x30, 0xD0, 0xF0,
+0x27, 0xD0, 0x80, 0x70, 0x91, 0xC0, 0x08, 0x04, 0x30, 0xC0, 0x91, 0x71, 0x41, 0x01, 0x30, 0xE0,
+0x0F, 0x0B, 0xC0, 0xD0, 0xF0, 0x28, 0xF4, 0x20, 0xF0, 0x20, 0xF1, 0x90, 0xC0, 0x10, 0xD0, 0xF3,
+0x2A, 0xF4, 0x80, 0x50, 0xF3, 0x23, 0xF3, 0x21, 0xF1, 0x26, 0xD0, 0x50, 0xF0, 0x22, 0xF3, 0x2A,
+0xF2, 0x22, 0xF3, 0x24, 0xF2, 0x20, 0xF6, 0x21, 0xF2, 0x50, 0xF0, 0x26, 0xF1, 0x25, 0xF0, 0xD0,
+0x90, 0xB0, 0x41, 0x00, 0x90, 0x00, 0x40, 0x30, 0x90, 0x30, 0x40, 0xB0, 0xE1, 0x40, 0x03, 0x41,
+0x80, 0x02, 0x40, 0x30, 0x00, 0x40, 0x80, 0x40, 0xE0, 0x60, 0x30, 0x80, 0x00, 0x60, 0x90, 0x80,
+0x40, 0x60, 0xE0, 0x60, 0x10, 0xB0, 0x90, 0x10, 0xB0, 0x00, 0xB0, 0x80, 0x00, 0x90, 0x80, 0x11,
+0x90, 0xD0, 0x20, 0xF0, 0x20, 0xF2, 0x27, 0xF6, 0xD0, 0x50, 0xF0, 0x23, 0xF1, 0x29, 0xF3, 0x20,
+0xF2, 0x29, 0xF2, 0x21, 0xF2, 0x24, 0xA0, 0x80, 0xC0, 0x10, 0xC0, 0x40, 0x00, 0x80, 0x01, 0x80,
+0xE0, 0x00, 0x70, 0x30, 0x80, 0x70, 0x90, 0xC0, 0x90, 0x00, 0x90, 0xA0, 0xD0, 0xF2, 0x24, 0xF1,
+0x21, 0xF2, 0x22, 0xF6, 0x21, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0xA0, 0x30, 0x0B, 0xC0, 0x30, 0x08,
+0x80, 0xB0, 0x03, 0x90, 0x60, 0x80, 0xD0, 0x24, 0xF1, 0x21, 0xD0, 0x80, 0x40, 0x01, 0x80, 0xB0,
+0x07, 0x03, 0x60, 0x90, 0x03, 0x60, 0xC0, 0xE0, 0x01, 0x30, 0xE0, 0x0F, 0x0B, 0xC0, 0xD0, 0xF0,
+0x28, 0xF1, 0x20, 0xF3, 0x20, 0xF0, 0xA0, 0x90, 0x70, 0xC0, 0xD0, 0xF1, 0x22, 0xF0, 0x25, 0xF7,
+0x50, 0x20, 0xFE, 0x24, 0xF1, 0x20, 0xD0, 0x50, 0xF1, 0x21, 0xF2, 0x2B, 0xF3, 0x24, 0xFF, 0x01,
+0x21, 0xF2, 0x50, 0xD0, 0x26, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0xD0, 0x30, 0x60, 0x01, 0xE0, 0x40,
+0x04, 0x70, 0xC0, 0x30, 0x70, 0x60, 0x01, 0xB0, 0xE0, 0x00, 0x40, 0x90, 0x70, 0x32, 0x10, 0x80,
+0x90, 0x81, 0x41, 0x80, 0x10, 0x01, 0x30, 0x40, 0x30, 0x01, 0x40, 0xC0, 0x12, 0x31, 0x80, 0x40,
+0xC0, 0x70, 0x10, 0xC0, 0x60, 0xD0, 0xF0, 0x24, 0xF0, 0x27, 0xF3, 0x20, 0xF1, 0xD0, 0x50, 0xF2,
+0x2A, 0xF6, 0x24, 0xF2, 0x20, 0xF0, 0x23, 0xF2, 0x21, 0xF4, 0x22, 0xD1, 0x80, 0x13, 0x60, 0x01,
+0x90, 0x01, 0x60, 0x90, 0x01, 0xE0, 0xB0, 0xE0, 0x80, 0x30, 0xD0, 0xF3, 0x2C, 0xF0, 0x22, 0xF0,
+0x20, 0xF2, 0x21, 0xF0, 0x50, 0xF3, 0xA0, 0x90, 0x0A, 0x60, 0x10, 0xB0, 0x08, 0x30, 0x04, 0x80,
+0x40, 0x50, 0xD0, 0x24, 0xF1, 0x21, 0xD0, 0x80, 0x40, 0x01, 0x80, 0x60, 0x02, 0xB0, 0x03, 0x03,
+0xB0, 0x70, 0x60, 0x02, 0x80, 0x70, 0x80, 0xE0, 0x60, 0x70, 0x60, 0x0F, 0x0B, 0x30, 0xA0, 0xF0,
+0x2C, 0xF0, 0x21, 0xF0, 0xD1, 0x30, 0xC0, 0x70, 0xD0, 0xF3, 0x21, 0xF1, 0x27, 0xF2, 0x51, 0xD0,
+0xFC, 0x26, 0xF0, 0x21, 0xD0, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x2A, 0xF0, 0x50, 0x30, 0xF1, 0x23,
+0xFF, 0x01, 0x23, 0xF0, 0xA1, 0xF1, 0x28, 0xF2, 0x21, 0xF0, 0xD0, 0x90, 0xB0, 0x01, 0x80, 0x60,
+0x04, 0x81, 0x70, 0x30, 0xE0, 0x60, 0x01, 0x40, 0x00, 0xE0, 0x40, 0xB0, 0xE0, 0xB0, 0x01, 0xE0,
+0x70, 0xE1, 0x00, 0x60, 0xB0, 0x40, 0x10, 0x90, 0x31, 0x70, 0x41, 0x11, 0x71, 0x04, 0x90, 0x10,
+0x80, 0xD0, 0xF1, 0x23, 0xF0, 0x2A, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0x21, 0xF0, 0x22, 0xF0, 0x24,
+0xF7, 0x2F, 0x00, 0xF0, 0x20, 0xF2, 0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0xA0, 0x90, 0xC0, 0x14, 0xC0,
+0x02, 0x30, 0x04, 0xC0, 0x80, 0xF0, 0xD0, 0xF3, 0x2F, 0x07, 0xF0, 0x50, 0xF2, 0xD0, 0xA0, 0x80,
+0x09, 0xB0, 0x91, 0x09, 0x30, 0xB0, 0x03, 0x81, 0x50, 0xD0, 0xF0, 0x24, 0xF2, 0xD0, 0x50, 0x30,
+0x60, 0xE0, 0x30, 0x80, 0x90, 0xB0, 0xC0, 0x70, 0x10, 0xE0, 0x01, 0x04, 0xE0, 0x71, 0xC1, 0x30,
+0xE0, 0x30, 0x41, 0xC0, 0x60, 0x0F, 0x0B, 0x90, 0xA0, 0xD0, 0x28, 0xF0, 0x25, 0xF1, 0xA0, 0x50,
+0x30, 0x70, 0xD0, 0xF1, 0x2F, 0x00, 0xF5, 0x2F, 0x04, 0xF1, 0x50, 0xD0, 0xF0, 0x2F, 0x00, 0xF1,
+0x70, 0x50, 0xD0, 0x2F, 0x04, 0xF0, 0x23, 0xF0, 0xA1, 0xF0, 0x2A, 0xF1, 0x21, 0xF0, 0xD0, 0x31,
+0xB0, 0x00, 0x10, 0xB0, 0x03, 0xB0, 0x80, 0x00, 0x61, 0x80, 0x10, 0x90, 0x30, 0x41, 0x81, 0xB0,
+0x40, 0xE1, 0x01, 0x40, 0x80, 0x60, 0x00, 0xE0, 0x00, 0x60, 0x90, 0xB1, 0xC0, 0xE0, 0x40, 0x80,
+0xB0, 0xE0, 0x00, 0x30, 0xB0, 0x02, 0xB0, 0x11, 0x50, 0x22, 0xF0, 0x2F, 0x04, 0xF0, 0xD0, 0xA0,
+0x20, 0xF1, 0x2E, 0xF0, 0x2F, 0x01, 0xF0, 0x20, 0xD2, 0x30, 0x80, 0xD0, 0x23, 0xD0, 0xF0, 0xA0,
+0xD0, 0xA0, 0xC0, 0x80, 0xA0, 0x50, 0x40, 0xC0, 0x30, 0xB0, 0x60, 0x90, 0xB0, 0x40, 0xE1, 0x30,
+0x90, 0x20, 0xD0, 0xF3, 0x2F, 0x08, 0xF0, 0x50, 0xF3, 0x50, 0x80, 0x09, 0x30, 0xB0, 0x80, 0x60,
+0x08, 0x30, 0x04, 0xE0, 0x30, 0x70, 0xD0, 0xF1, 0x23, 0xF2, 0xD0, 0x50, 0x90, 0x41, 0x30, 0xC0,
+0x00, 0x30, 0x40, 0x00, 0xB0, 0x70, 0x01, 0x04, 0x90, 0xB0, 0x00, 0xB0, 0x01, 0xE1, 0x01, 0x30,
+0x60, 0x0F, 0x0B, 0x80, 0x40, 0xF0, 0x20, 0xF8, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0xA0, 0x51,
+0xD0, 0x21, 0xF6, 0x20, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x50, 0x26, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x2B, 0xF0, 0x50, 0xD0, 0x21, 0xF4, 0x23, 0xF2, 0x20, 0xF3, 0xD0, 0xF3, 0x20, 0xF0, 0x2E, 0xF0,
+0x20, 0xF1, 0x21, 0xF0, 0xA1, 0xF5, 0x20, 0xF0, 0x22, 0xF2, 0x22, 0xD0, 0xA0, 0x11, 0x00, 0xE0,
+0x80, 0x03, 0xE0, 0x40, 0x03, 0x30, 0x01, 0x60, 0xE0, 0x41, 0x90, 0x40, 0x01, 0xE0, 0xB0, 0x00,
+0x90, 0xE0, 0x40, 0x60, 0xE0, 0x70, 0x02, 0x80, 0x00, 0xB0, 0x80, 0x02, 0x70, 0x31, 0x90, 0x30,
+0x11, 0xC0, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x26, 0xF0, 0x22, 0xF3, 0x20, 0xF0, 0xD0, 0xA0,
+0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x29, 0xFF, 0x02, 0xD0, 0x50, 0x91, 0xD0, 0x50, 0xD0, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0xA0, 0xD1, 0xF0, 0xD4, 0xC0, 0x10, 0x70, 0x90, 0x30, 0x81, 0x30, 0xA0, 0xD0,
+0xF0, 0x2B, 0xFA, 0x21, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xD0, 0xA0, 0x30, 0x07, 0xE0, 0x90,
+0x80, 0x00, 0xB0, 0x80, 0x08, 0x90, 0x04, 0x60, 0x30, 0xC0, 0xD1, 0xF0, 0x25, 0xF0, 0xD0, 0x50,
+0x40, 0x01, 0x40, 0x10, 0x00, 0x40, 0xE0, 0x01, 0x70, 0x01, 0x03, 0xB0, 0xC1, 0x30, 0x02, 0xE0,
+0x40, 0xB0, 0x00, 0x90, 0xB0, 0x0F, 0x0B, 0x60, 0x30, 0xD0, 0xFA, 0xD0, 0xF2, 0xD1, 0x31, 0xA0,
+0xC0, 0xD2, 0xFF, 0x02, 0xD1, 0xF3, 0x20, 0xFF, 0x03, 0xD0, 0x50, 0xD0, 0xFF, 0x01, 0xD2, 0x70,
+0x30, 0xD2, 0xFF, 0x02, 0xD0, 0xF1, 0xD1, 0xA1, 0xD0, 0xFE, 0xD2, 0x70, 0x02, 0x30, 0x60, 0x02,
+0x80, 0xB0, 0x03, 0x90, 0x05, 0x80, 0x90, 0x30, 0x81, 0x90, 0x81, 0x30, 0x81, 0x40, 0x90, 0x02,
+0x30, 0x00, 0xB0, 0x30, 0x01, 0x60, 0x70, 0xE0, 0x10, 0x70, 0x12, 0x90, 0xD0, 0xF0, 0xD0, 0xF2,
+0xD0, 0xFF, 0x03, 0xD0, 0xA0, 0xFF, 0x15, 0xD0, 0x80, 0x50, 0xD0, 0xA0, 0x70, 0xD0, 0xF1, 0xD2,
+0xF0, 0x50, 0xD0, 0xF0, 0xD0, 0xF3, 0xD1, 0xA0, 0xD5, 0xF2, 0xD0, 0xF1, 0x20, 0xFF, 0x09, 0xD0,
+0x50, 0xF0, 0xD0, 0xF0, 0xD0, 0xA0, 0x30, 0x07, 0x70, 0xB0, 0x02, 0x90, 0x08, 0x30, 0x04, 0x71,
+0x80, 0xA0, 0xD1, 0xF6, 0xD0, 0x50, 0x80, 0xB1, 0x80, 0x40, 0xC1, 0x10, 0xC1, 0x60, 0x01, 0x03,
+0xB0, 0x90, 0x00, 0x80, 0x10, 0x70, 0x41, 0x13, 0x40, 0xEF, 0x0B, 0x40, 0x90, 0x5F, 0x01, 0xA0,
+0x80, 0x90, 0x50, 0x90, 0x80, 0x5F, 0x07, 0xA1, 0x5F, 0x04, 0xA0, 0x50, 0x80, 0x5F, 0x06, 0x90,
+0x5F, 0x1E, 0xA0, 0x30, 0xE3, 0x30, 0x60, 0xE1, 0x30, 0x60, 0xE1, 0x60, 0x40, 0x80, 0xE5, 0x80,
+0x45, 0x81, 0x40, 0x60, 0xE0, 0x30, 0x40, 0xE1, 0x30, 0x60, 0xE0, 0x90, 0x81, 0x90, 0xE0, 0x60,
+0x90, 0x60, 0x80, 0x71, 0x30, 0x5F, 0x32, 0xA1, 0x50, 0x80, 0x30, 0x5F, 0x0A, 0xA0, 0x51, 0xA0,
+0x5F, 0x0E, 0xA0, 0x50, 0xA0, 0x90, 0x60, 0xE5, 0x80, 0x40, 0x60, 0xE2, 0x80, 0x40, 0xE6, 0x40,
+0x80, 0xE4, 0x30, 0x80, 0x30, 0x80, 0xA0, 0x58, 0x80, 0x13, 0xB0, 0x00, 0xB0, 0x61, 0x03, 0x03,
+0xB0, 0x70, 0x02, 0xE0, 0x80, 0x31, 0x41, 0xC0, 0xB0, 0x0F, 0x0C, 0x10, 0xA0, 0xFF, 0x02, 0x50,
+0xA0, 0x90, 0x30, 0xD0, 0xFF, 0x03, 0xA0, 0x50, 0xFF, 0x09, 0x50, 0xD0, 0xFF, 0x04, 0xD0, 0x71,
+0xD0, 0xFF, 0x08, 0xA1, 0xFF, 0x02, 0xD0, 0x30, 0xE0, 0x02, 0xE0, 0x80, 0x00, 0xB0, 0x90, 0x60,
+0xB0, 0xE0, 0x90, 0xE1, 0x04, 0xB0, 0x30, 0x04, 0xE0, 0x40, 0x80, 0x40, 0xE0, 0x01, 0xC0, 0x01,
+0x90, 0x00, 0x90, 0x40, 0x60, 0x80, 0x30, 0x00, 0x30, 0x60, 0x01, 0xC0, 0x10, 0xE0, 0xFF, 0x0A,
+0xD0, 0xA1, 0xFF, 0x17, 0xA0, 0x90, 0xD0, 0xF5, 0xA0, 0x50, 0xFF, 0x21, 0x50, 0xF3, 0xD0, 0x90,
+0xB0, 0x04, 0x60, 0x30, 0x04, 0x41, 0x06, 0xB0, 0x80, 0x04, 0x30, 0xE0, 0x10, 0x80, 0xD0, 0xF8,
+0x50, 0x90, 0x41, 0x90, 0xE0, 0x90, 0x72, 0x90, 0xB0, 0x01, 0x03, 0xB0, 0x40, 0x04, 0xE1, 0x01,
+0x90, 0x60, 0x0F, 0x0B, 0x60, 0x10, 0xFF, 0x02, 0xD0, 0xF0, 0xA0, 0xD0, 0xFF, 0x04, 0xD0, 0x50,
+0xA0, 0xD0, 0xF0, 0xD1, 0xFF, 0x04, 0xD0, 0x50, 0xD1, 0xFF, 0x03, 0xD0, 0xA0, 0x90, 0xD0, 0xFF,
+0x08, 0xA1, 0xD0, 0xFF, 0x01, 0xD0, 0x50, 0x30, 0x03, 0x90, 0x00, 0x70, 0x90, 0x80, 0x90, 0x10,
+0x71, 0xE0, 0x04, 0xB0, 0x30, 0x02, 0x60, 0xE0, 0xB0, 0xE0, 0x80, 0x40, 0xB0, 0x40, 0xB0, 0x30,
+0x40, 0x00, 0x10, 0x70, 0x40, 0x02, 0xC0, 0x70, 0x30, 0x70, 0x40, 0x80, 0x70, 0x10, 0x40, 0xD0,
+0xFF, 0x08, 0xD1, 0xA0, 0xF0, 0xD0, 0xFF, 0x13, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF5, 0xD0, 0xF0,
+0xA0, 0xD0, 0xF4, 0x20, 0xF3, 0xD0, 0xF6, 0xD0, 0xF2, 0x20, 0xD0, 0xFF, 0x07, 0xD0, 0x50, 0xD0,
+0xF0, 0xD1, 0xF0, 0x80, 0x40, 0x04, 0x30, 0x60, 0x04, 0xB0, 0x80, 0x07, 0x30, 0x04, 0x90, 0x60,
+0x31, 0xD0, 0xF3, 0x20, 0xF2, 0xD0, 0x50, 0x40, 0x01, 0x40, 0x10, 0xE0, 0x02, 0xE0, 0x90, 0x01,
+0x04, 0xB0, 0x30, 0x40, 0x01, 0x60, 0x30, 0x40, 0xB1, 0x90, 0x60, 0x0F, 0x0B, 0xB0, 0x30, 0xD0,
+0xF1, 0x2E, 0xF1, 0xA0, 0xD0, 0xF0, 0x26, 0xF1, 0x28, 0xF0, 0xD0, 0x51, 0xD0, 0xF3, 0x24, 0xFD,
+0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF7, 0x21, 0xF3, 0x23, 0xD0, 0x30, 0xC0, 0xF1, 0x20, 0xFA, 0x20,
+0xF0, 0x20, 0xF0, 0x24, 0xF1, 0xA1, 0xF0, 0x26, 0xF0, 0x25, 0xF3, 0xA0, 0x70, 0xB0, 0x03, 0x11,
+0x80, 0x03, 0x70, 0x40, 0x34, 0x80, 0xC0, 0x40, 0xE0, 0x81, 0x60, 0x40, 0xE0, 0x30, 0xE0, 0xB0,
+0x00, 0xB0, 0x60, 0x70, 0x10, 0x40, 0x00, 0xB0, 0xE0, 0x40, 0xC0, 0x70, 0x90, 0x32, 0x80, 0x40,
+0x10, 0xC0, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xFF, 0x00, 0x20, 0xF0, 0xD0, 0xA0, 0xF3, 0x22,
+0xF8, 0x2F, 0x06, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0x50, 0xD0, 0xF2,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF2, 0x21, 0xF1, 0x2F, 0x09, 0xF0, 0x50,
+0xF0, 0xD0, 0xF1, 0xD0, 0xA0, 0x80, 0x03, 0x40, 0x80, 0x06, 0x90, 0x07, 0x30, 0x04, 0x30, 0x60,
+0x80, 0x30, 0xD0, 0xF2, 0x24, 0xD0, 0x50, 0x80, 0xB1, 0x80, 0x10, 0x04, 0x70, 0x01, 0x04, 0xC0,
+0x40, 0x90, 0x70, 0x00, 0x40, 0x70, 0x90, 0x81, 0xC0, 0x60, 0x0F, 0x0C, 0x70, 0xD0, 0x2F, 0x01,
+0xF0, 0x20, 0x50, 0xD0, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x24, 0xF2, 0x30, 0x90, 0xF2,
+0x2E, 0xF0, 0x20, 0xF0, 0x21, 0xD0, 0x50, 0xD0, 0xF0, 0x2A, 0xF3, 0x23, 0xD0, 0x71, 0x50, 0xD0,
+0x20, 0xF6, 0x24, 0xF0, 0x27, 0xF1, 0xA0, 0xF2, 0x20, 0xF0, 0x22, 0xF1, 0x25, 0xF3, 0x70, 0xC0,
+0xE0, 0x02, 0x80, 0x30, 0x04, 0x30, 0x04, 0xB0, 0xC0, 0x31, 0x90, 0x41, 0x81, 0x40, 0x90, 0x30,
+0x82, 0x30, 0x90, 0x30, 0x10, 0x81, 0x40, 0x60, 0x40, 0x70, 0x60, 0x03, 0x40, 0x10, 0x70, 0xF0,
+0x22, 0xF7, 0x50, 0xA0, 0xF1, 0x28, 0xF0, 0xD0, 0x50, 0x21, 0xF0, 0x27, 0xF7, 0x2F, 0x03, 0xF4,
+0x22, 0xF3, 0xA0, 0xD0, 0xF2, 0x24, 0xF2, 0x22, 0xF7, 0x2F, 0x02, 0xF0, 0x21, 0xF1, 0x20, 0xF1,
+0x50, 0xF3, 0xD0, 0xF0, 0x30, 0x03, 0x90, 0x07, 0x80, 0x60, 0x05, 0xB0, 0x80, 0x04, 0x30, 0x40,
+0x80, 0x90, 0xD0, 0xF2, 0x21, 0xF2, 0xD0, 0x50, 0x90, 0x81, 0x90, 0x80, 0xC0, 0x90, 0x30, 0x90,
+0xC0, 0xE0, 0x01, 0x03, 0x60, 0x30, 0x01, 0x30, 0x80, 0xE0, 0x70, 0xE0, 0x01, 0x30, 0xE0, 0x0F,
+0x0B, 0xB0, 0x90, 0xD0, 0x2F, 0x00, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3,
+0x20, 0xF0, 0x22, 0xF2, 0x22, 0xF0, 0x20, 0xA0, 0xF0, 0x2F, 0x04, 0xF1, 0xD0, 0x50, 0xF1, 0x2B,
+0xF2, 0x23, 0xD0, 0xA1, 0xF1, 0x20, 0xF9, 0x25, 0xF1, 0x20, 0xF3, 0x50, 0xF2, 0x20, 0xF0, 0x22,
+0xF4, 0x22, 0xF0, 0x20, 0xD1, 0xF0, 0xA0, 0x10, 0x60, 0x01, 0xE0, 0x70, 0x04, 0x30, 0x04, 0xB0,
+0x80, 0xE0, 0x00, 0x80, 0xB0, 0x00, 0x40, 0x01, 0x80, 0x40, 0x60, 0x40, 0x00, 0x80, 0xC0, 0x00,
+0x40, 0xB0, 0x01, 0x40, 0x70, 0x80, 0x30, 0x90, 0x40, 0xE0, 0x00, 0x70, 0xC0, 0xD0, 0xF0, 0x22,
+0xF4, 0x21, 0xF0, 0xA0, 0x20, 0xF1, 0x29, 0xD0, 0x50, 0xF0, 0x27, 0xF0, 0x21, 0xF2, 0x22, 0xF1,
+0x2F, 0x02, 0xF2, 0x24, 0xF3, 0xA0, 0xD0, 0xF1, 0x28, 0xF3, 0x26, 0xF1, 0x2F, 0x00, 0xF0, 0x21,
+0xF0, 0x21, 0xF1, 0x50, 0xF5, 0x90, 0x02, 0x30, 0x60, 0x07, 0xE0, 0x40, 0x05, 0x60, 0x80, 0x04,
+0x60, 0x90, 0xB0, 0x70, 0xD0, 0xF2, 0x20, 0xF2, 0x20, 0xD0, 0x50, 0x40, 0x01, 0x40, 0x60, 0xB0,
+0x60, 0x40, 0xE0, 0x03, 0x04, 0xC0, 0xE0, 0x01, 0x90, 0xC0, 0x90, 0xE0, 0x01, 0x80, 0x70, 0x0F,
+0x0B, 0xB0, 0x90, 0xD0, 0x2F, 0x00, 0xF2, 0x50, 0xD1, 0x20, 0xF0, 0x20, 0xFD, 0x21, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x2F, 0x03, 0xF2, 0x50, 0xF1, 0x2B, 0xF2, 0x23, 0xF0, 0xD0, 0xF2, 0x20, 0xF5,
+0x29, 0xF1, 0x21, 0xF2, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF5, 0x22, 0xF0, 0x20,
+0xF0, 0xD0, 0x50, 0x80, 0x90, 0xB0, 0x80, 0x30, 0x60, 0x03, 0xB0, 0x30, 0x03, 0x60, 0x41, 0x01,
+0x80, 0x00, 0xB0, 0xE0, 0x01, 0x41, 0x00, 0xE0, 0x00, 0x40, 0xC0, 0x30, 0x90, 0xC0, 0x80, 0x91,
+0xC1, 0x00, 0xB0, 0x60, 0x80, 0x70, 0xC0, 0xD0, 0xF1, 0x29, 0xF0, 0x21, 0xF0, 0x29, 0xF0, 0xD0,
+0x50, 0xF2, 0x26, 0xF1, 0x21, 0xF3, 0x2F, 0x0E, 0xF1, 0xA0, 0xD0, 0xF3, 0x2F, 0x00, 0xF2, 0x20,
+0xF0, 0x21, 0xF4, 0x27, 0xF0, 0x25, 0xF0, 0x50, 0xF4, 0xD0, 0x90, 0x00, 0x60, 0x70, 0x90, 0x08,
+0xB0, 0x80, 0x05, 0x80, 0xE0, 0x07, 0x10, 0xD0, 0x20, 0xF1, 0x24, 0xF0, 0x80, 0xE0, 0x01, 0x80,
+0xB0, 0x03, 0x30, 0x40, 0x01, 0x04, 0x60, 0x30, 0x02, 0x81, 0x70, 0x31, 0x70, 0x90, 0x80, 0x0F,
+0x0A, 0x60, 0x80, 0xD0, 0x2F, 0x00, 0xF2, 0x50, 0xF3, 0x50, 0x70, 0xD0, 0xF2, 0x21, 0xF2, 0x23,
+0xF3, 0x20, 0xF0, 0x23, 0xF2, 0x2B, 0xF3, 0xD0, 0x50, 0xF1, 0x22, 0xF0, 0x27, 0xF2, 0x23, 0xF1,
+0xD0, 0xF1, 0x28, 0xF0, 0x25, 0xF3, 0x20, 0xF2, 0x50, 0xF3, 0x21, 0xF0, 0x20, 0xF4, 0x23, 0xF0,
+0x22, 0xF0, 0xD0, 0xC0, 0x31, 0xC0, 0x04, 0x60, 0x80, 0x01, 0xB0, 0x40, 0xB0, 0x60, 0x40, 0x01,
+0x30, 0x90, 0x40, 0x02, 0x41, 0x01, 0xE0, 0xC0, 0xB1, 0x30, 0x40, 0x00, 0x30, 0xE0, 0x40, 0x90,
+0x70, 0x01, 0x80, 0x30, 0xD0, 0xF1, 0x29, 0xF0, 0x20, 0xF0, 0x2B, 0xF0, 0xD0, 0x50, 0xD0, 0xF3,
+0x26, 0xF1, 0x2F, 0x0F, 0xF3, 0xA1, 0xD0, 0xF7, 0x2D, 0xF3, 0x21, 0xF1, 0x2F, 0x00, 0xF1, 0x50,
+0xF4, 0xD0, 0x90, 0x00, 0x90, 0xB0, 0x09, 0x41, 0x05, 0x80, 0x60, 0x07, 0xC0, 0xD0, 0x20, 0xF1,
+0x24, 0xD0, 0x80, 0x70, 0x31, 0x70, 0xB0, 0x02, 0x80, 0xB0, 0x80, 0xB0, 0x00, 0x0A, 0xB0, 0x80,
+0x01, 0x40, 0x50, 0x90, 0x60, 0x0F, 0x09, 0xE0, 0x90, 0xD0, 0xF0, 0x2F, 0x00, 0xF1, 0x50, 0xD0,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x2B, 0xF0, 0x29, 0xFC, 0xD2, 0xA1, 0xF8, 0x22, 0xF3,
+0x23, 0xF2, 0x21, 0xF0, 0x29, 0xF1, 0x23, 0xF4, 0xD1, 0x50, 0xF3, 0x21, 0xF0, 0x22, 0xF1, 0x24,
+0xF0, 0x20, 0xF0, 0x21, 0xD0, 0x90, 0xB0, 0xE0, 0x70, 0x80, 0x03, 0x40, 0xE0, 0x60, 0x80, 0x60,
+0x01, 0xE0, 0x40, 0x02, 0xE0, 0x80, 0x11, 0x90, 0x30, 0x80, 0x01, 0x41, 0x00, 0xB0, 0x30, 0x00,
+0xE0, 0x30, 0xB0, 0xE0, 0x60, 0x81, 0x40, 0xC0, 0xD0, 0xF0, 0x2B, 0xF0, 0x24, 0xFA, 0x50, 0xD2,
+0xF0, 0x21, 0xF5, 0x2F, 0x13, 0xF1, 0xA1, 0xD4, 0xF6, 0x22, 0xF1, 0x26, 0xF3, 0x20, 0xF3, 0x2D,
+0xF1, 0x50, 0xF1, 0x21, 0xF0, 0xD0, 0x30, 0x90, 0x30, 0x0A, 0x90, 0x06, 0x40, 0xE0, 0x07, 0x90,
+0xD0, 0x21, 0xF0, 0x24, 0xD0, 0x30, 0xE0, 0x01, 0x30, 0x03, 0xB0, 0x90, 0x80, 0x01, 0x0B, 0x30,
+0x01, 0xE0, 0x80, 0xA0, 0x70, 0x0F, 0x09, 0x40, 0x10, 0xF2, 0x2E, 0xF1, 0x50, 0xD0, 0xF0, 0x22,
+0x80, 0x23, 0xF0, 0x27, 0xFF, 0x03, 0x23, 0xA3, 0x53, 0xA0, 0xF8, 0x22, 0xF3, 0x22, 0xF1, 0x21,
+0xF1, 0x29, 0xF3, 0xD1, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0xA1, 0x51, 0xF3, 0x21, 0xF0, 0x28, 0xF0,
+0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x80, 0xE0, 0x30, 0xC0, 0x30, 0x90, 0x40, 0x01, 0x80, 0x40, 0xE0,
+0xB0, 0x02, 0x40, 0xE0, 0x01, 0xB0, 0xE0, 0x01, 0xB0, 0x00, 0xE0, 0xC0, 0x81, 0xC0, 0x80, 0x00,
+0xB0, 0x80, 0x00, 0x40, 0x60, 0x80, 0x00, 0xB0, 0xE0, 0x30, 0x10, 0xA0, 0xD0, 0xF0, 0x2E, 0xF1,
+0x20, 0xF7, 0x20, 0xF0, 0xA0, 0x52, 0xA0, 0xFA, 0x2F, 0x0E, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x52,
+0xA3, 0xF5, 0xD3, 0xFB, 0x2F, 0x03, 0xF1, 0x50, 0xD0, 0x22, 0xF2, 0x10, 0xB0, 0x0A, 0x30, 0x06,
+0x40, 0xE0, 0x01, 0x40, 0xB0, 0x03, 0x90, 0xD0, 0x21, 0xF0, 0x24, 0xD0, 0x30, 0xB0, 0x01, 0x90,
+0x08, 0x0B, 0x90, 0x01, 0xE0, 0x30, 0xD0, 0x80, 0xE0, 0x0F, 0x09, 0x10, 0x50, 0xD0, 0xFF, 0x00,
+0x20, 0xD0, 0x50, 0xF2, 0x21, 0x90, 0xD0, 0xF0, 0x20, 0xF0, 0x27, 0xF2, 0xD2, 0xF6, 0xA2, 0x55,
+0xA5, 0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x2A, 0xF3, 0x21, 0xF1, 0x23, 0xF0, 0x21, 0xF7, 0xD1, 0xF2,
+0xA1, 0x52, 0xA2, 0xF0, 0xA1, 0xF2, 0x21, 0xF0, 0x22, 0xF1, 0x22, 0xF2, 0x20, 0xF1, 0xD1, 0x50,
+0x80, 0x30, 0x60, 0x70, 0xB0, 0x40, 0x70, 0x80, 0x30, 0x70, 0x30, 0xC0, 0x90, 0x30, 0x90, 0x70,
+0x60, 0x01, 0xE0, 0xB0, 0x03, 0x60, 0x90, 0xB0, 0x00, 0x40, 0xC0, 0xB1, 0x80, 0x01, 0xB0, 0xC0,
+0x02, 0x81, 0xA0, 0xD0, 0xF1, 0x20, 0xF7, 0x22, 0xF0, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0xF1, 0x50,
+0xF2, 0xA1, 0x52, 0xA1, 0xF0, 0xD0, 0xF0, 0xD1, 0xF2, 0x21, 0xFF, 0x04, 0x26, 0xF1, 0xD0, 0x50,
+0xF1, 0x20, 0xF1, 0xA4, 0x55, 0xA2, 0xF6, 0xD2, 0xF6, 0x2C, 0xF0, 0x50, 0xD0, 0xF4, 0xD0, 0x90,
+0x0B, 0x90, 0x06, 0x80, 0xE0, 0x01, 0x10, 0x40, 0x02, 0xB0, 0x90, 0xD0, 0x21, 0xF0, 0x20, 0xF2,
+0x20, 0xD0, 0x30, 0x60, 0x01, 0x90, 0x08, 0x0B, 0x10, 0x31, 0x90, 0x30, 0xD0, 0x50, 0x80, 0x0F,
+0x09, 0x40, 0x70, 0xD0, 0xFF, 0x01, 0xD0, 0x50, 0xF0, 0xD0, 0xF3, 0xD0, 0xF2, 0xD0, 0xF3, 0xD0,
+0xF1, 0x20, 0xA3, 0x56, 0xA3, 0xF1, 0xD8, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0x2A, 0xF3, 0x20, 0xF3,
+0x23, 0xF2, 0xD5, 0xA1, 0x52, 0xA2, 0xD2, 0xF1, 0xD0, 0xF0, 0xA1, 0xF2, 0x21, 0xF1, 0x20, 0xF2,
+0x21, 0xF5, 0x51, 0xD0, 0xA0, 0x90, 0x80, 0xE0, 0x80, 0x60, 0x00, 0xE1, 0x40, 0xE0, 0x01, 0x90,
+0x04, 0xB0, 0xE0, 0x04, 0x60, 0x70, 0xE0, 0x00, 0x70, 0x00, 0x61, 0x80, 0x00, 0x60, 0x40, 0x10,
+0x00, 0xB0, 0x60, 0x10, 0xE0, 0xA0, 0x50, 0xF0, 0xD0, 0xF8, 0x20, 0xF0, 0x20, 0xF1, 0x24, 0xF0,
+0x25, 0xF0, 0x50, 0xF4, 0xD1, 0xF0, 0xA1, 0x53, 0xA1, 0xF0, 0xD1, 0xFF, 0x04, 0x26, 0xF2, 0xD0,
+0x50, 0xD0, 0xF4, 0xD7, 0xF1, 0xA3, 0x57, 0xA2, 0x20, 0xFF, 0x02, 0x50, 0xD1, 0xF3, 0xD0, 0x90,
+0x60, 0x0A, 0x80, 0xB0, 0x05, 0x90, 0x07, 0x40, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0xD0,
+0x90, 0x32, 0xC0, 0x08, 0x0B, 0x90, 0x02, 0x90, 0xD0, 0xA0, 0x90, 0x0F, 0x09, 0x60, 0x80, 0xD0,
+0xF0, 0x20, 0xF6, 0x21, 0xF0, 0x20, 0xF2, 0xD1, 0x50, 0xF0, 0xD2, 0xF2, 0xA3, 0x56, 0xA2, 0xFF,
+0x09, 0x21, 0xF0, 0xD0, 0x50, 0x25, 0xF1, 0x28, 0xF7, 0xD0, 0xF1, 0xA1, 0x53, 0xA0, 0xF5, 0x21,
+0xF6, 0x50, 0xD0, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF2, 0x21, 0xD0, 0x50, 0x30,
+0x10, 0x90, 0x80, 0x60, 0x05, 0xB0, 0x70, 0x03, 0x40, 0x05, 0xE1, 0x30, 0x00, 0x31, 0x70, 0x40,
+0x70, 0x10, 0xC0, 0x90, 0x30, 0xC0, 0x30, 0x80, 0x10, 0x50, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF0,
+0x21, 0xF3, 0x21, 0xF1, 0x24, 0xF2, 0x22, 0xF2, 0x50, 0xD0, 0x20, 0xF0, 0x20, 0xFA, 0xA0, 0x52,
+0xA2, 0xF0, 0xD2, 0xF2, 0x21, 0xF7, 0x27, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xFF, 0x09, 0xA3, 0x55,
+0xA4, 0xF1, 0xD1, 0xF0, 0xD0, 0xF0, 0xA0, 0xD0, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x70, 0x60, 0x09,
+0x41, 0x03, 0x60, 0x30, 0x40, 0x07, 0x30, 0xA0, 0xD0, 0xF2, 0x21, 0xF1, 0x20, 0xD0, 0x90, 0x02,
+0x30, 0x08, 0x0B, 0x30, 0x02, 0x70, 0xD1, 0x70, 0x0F, 0x09, 0x40, 0x50, 0xD0, 0xF8, 0xD0, 0xF0,
+0x20, 0xF1, 0xA0, 0xF0, 0xA1, 0x56, 0xA2, 0xF0, 0xA0, 0xF4, 0xD3, 0xF4, 0x23, 0xF2, 0x24, 0xF0,
+0x23, 0xF4, 0x21, 0xF0, 0x50, 0xF0, 0x22, 0xF3, 0x21, 0xFA, 0x20, 0xF0, 0xA1, 0x52, 0xA1, 0xF1,
+0xD1, 0xF2, 0x2A, 0xF0, 0xD0, 0x50, 0xF1, 0x23, 0xF1, 0x27, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x80,
+0x90, 0x80, 0x90, 0xC0, 0x01, 0x70, 0x04, 0x90, 0x01, 0x40, 0xE0, 0x60, 0x05, 0xE0, 0x41, 0x00,
+0xB0, 0x00, 0x10, 0x71, 0xC0, 0x80, 0x70, 0x10, 0x70, 0x90, 0x00, 0xE0, 0x70, 0xD0, 0xF0, 0xD0,
+0xF0, 0x50, 0xA0, 0xF0, 0xD0, 0xF4, 0x24, 0xF1, 0x20, 0xF3, 0x21, 0xF1, 0xD0, 0xF0, 0x50, 0xD0,
+0xF0, 0x22, 0xF0, 0x20, 0xF3, 0x20, 0xF3, 0xD1, 0xF1, 0xA1, 0x52, 0xA1, 0x21, 0xF9, 0x22, 0xF1,
+0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0x22, 0xF0, 0x22, 0xF3, 0x24, 0xF3,
+0xD1, 0xF0, 0xD1, 0xF2, 0xA5, 0x53, 0xA0, 0x51, 0xA2, 0x22, 0xF0, 0xD1, 0x70, 0x09, 0x60, 0x80,
+0x02, 0x40, 0x30, 0x40, 0x08, 0x90, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0xD0, 0x70, 0x02, 0x30,
+0x08, 0x0B, 0x90, 0x40, 0x81, 0x90, 0xD1, 0x30, 0x80, 0x0F, 0x08, 0x80, 0x50, 0xD0, 0xF3, 0xA3,
+0x54, 0xA6, 0x20, 0xF1, 0xD1, 0x20, 0xF3, 0xD1, 0xF8, 0x2E, 0xF1, 0x26, 0xF0, 0x20, 0xF0, 0xD0,
+0x50, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xD2, 0xF2, 0xA1, 0x51, 0xA2, 0xF0, 0xD0, 0xFF, 0x00,
+0x25, 0xF0, 0xA1, 0xF0, 0x26, 0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0x70, 0x30, 0xB0,
+0x70, 0x80, 0x40, 0x00, 0xE0, 0x04, 0xB0, 0x70, 0x90, 0x40, 0x90, 0x30, 0x05, 0x90, 0x10, 0x91,
+0x10, 0x30, 0x11, 0xA0, 0xD2, 0x50, 0xD0, 0xA0, 0x70, 0x00, 0x80, 0x90, 0xD0, 0xF1, 0xD0, 0xA0,
+0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF8, 0x25, 0xF1, 0x50, 0xF2, 0x21, 0xFF, 0x01, 0xD1,
+0xF0, 0x20, 0xF0, 0xA1, 0x52, 0xA1, 0xF0, 0xD2, 0xF2, 0x20, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0xA0,
+0xF0, 0x23, 0xF2, 0x20, 0xF1, 0x21, 0xF2, 0x20, 0xF3, 0x28, 0xFF, 0x03, 0xA0, 0x50, 0xA4, 0x54,
+0x30, 0xB0, 0x60, 0xB1, 0x04, 0xB0, 0x80, 0x02, 0x90, 0x0A, 0x90, 0xD0, 0xF2, 0x22, 0xF1, 0x20,
+0xD0, 0x70, 0x81, 0x40, 0x30, 0x08, 0x0B, 0x90, 0x61, 0x00, 0x70, 0xD0, 0xF0, 0xD0, 0x90, 0x0F,
+0x03, 0xB0, 0x61, 0xE1, 0x80, 0x30, 0x54, 0xA3, 0xF0, 0xD4, 0xF0, 0xD0, 0xF0, 0xD0, 0xA1, 0xD0,
+0xF0, 0xD0, 0xA0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0x2F, 0x08, 0xF0, 0x24, 0xF1, 0x20, 0xF1,
+0x50, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF2, 0xD0, 0xF0, 0xA0, 0x52, 0xA2, 0xF3, 0xD1, 0xF0, 0x24,
+0xF2, 0x21, 0xF8, 0x23, 0xF1, 0x50, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0x28, 0xF0, 0xD0, 0xA0, 0x51,
+0xC0, 0x00, 0x30, 0xE0, 0xC0, 0x90, 0xE0, 0x06, 0xB0, 0x60, 0x00, 0x90, 0x03, 0x80, 0x91, 0xD3,
+0x30, 0x50, 0x80, 0xA1, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xC0, 0x60, 0xB0, 0x10, 0xA0, 0xF0, 0xD2,
+0xF0, 0x51, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0x25, 0xF1, 0x50, 0xD0, 0xF1, 0x20, 0xF9,
+0x20, 0xF4, 0x22, 0xF4, 0xD2, 0xF0, 0xA1, 0x53, 0xA0, 0xF3, 0xD1, 0xF4, 0xA1, 0xF0, 0x20, 0xF1,
+0x23, 0xF2, 0x22, 0xF7, 0x2C, 0xF4, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0xA0, 0xF0, 0xD0, 0xF3, 0xD2,
+0xF0, 0xD0, 0x81, 0xB0, 0x60, 0xE1, 0x42, 0xE0, 0x40, 0x80, 0xE0, 0x60, 0xB0, 0x30, 0x03, 0x10,
+0x01, 0x61, 0x01, 0x90, 0xD0, 0xF8, 0xD0, 0x70, 0x00, 0x60, 0x40, 0x30, 0x08, 0x0B, 0x30, 0x02,
+0x70, 0xD2, 0x90, 0xE0, 0x04, 0xB1, 0x62, 0xE3, 0x42, 0xE0, 0x61, 0xB0, 0x01, 0xE0, 0x70, 0xD0,
+0xFA, 0xD0, 0xF3, 0x20, 0xF0, 0xA1, 0xF0, 0xA1, 0x70, 0x50, 0xF0, 0x24, 0xF0, 0x20, 0xF5, 0x23,
+0xF1, 0x28, 0xF4, 0x26, 0xF2, 0xA0, 0xF0, 0xD2, 0xF0, 0xA1, 0x54, 0xA0, 0xF0, 0xD1, 0xF4, 0xD0,
+0xF3, 0x27, 0xF3, 0x20, 0xF4, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x23, 0xF1,
+0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x51, 0xD1, 0xA0, 0x10, 0x40, 0xC0, 0xD0, 0xC0,
+0x03, 0xB0, 0x80, 0x01, 0xB0, 0xE0, 0x00, 0xE0, 0x30, 0x01, 0x70, 0x10, 0x50, 0xA0, 0xF0, 0x20,
+0xF0, 0xD4, 0x50, 0xF2, 0x20, 0xD0, 0x70, 0x30, 0x00, 0x10, 0x80, 0x50, 0xC0, 0x10, 0x50, 0xD0,
+0xF1, 0x51, 0xF0, 0xD0, 0xF0, 0x25, 0xF0, 0x26, 0xF1, 0x50, 0xF1, 0x28, 0xF4, 0x29, 0xFB, 0xA0,
+0x53, 0xA1, 0xF0, 0xD3, 0xA1, 0xF0, 0x26, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF4, 0x28, 0xF1,
+0x21, 0xF2, 0x20, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x20, 0xF7, 0xD0, 0xF0, 0xD0, 0x70,
+0x08, 0x90, 0x00, 0xB1, 0x30, 0xE0, 0x42, 0xC0, 0xE0, 0x60, 0x30, 0x70, 0x61, 0x30, 0xD0, 0xF2,
+0xD4, 0xF1, 0x90, 0x01, 0xB0, 0x80, 0x08, 0x0B, 0x30, 0xB2, 0x70, 0xA2, 0x80, 0x90, 0xE1, 0x41,
+0xE1, 0x61, 0xB2, 0x0C, 0x90, 0xD0, 0xF0, 0x28, 0xA0, 0x30, 0xD0, 0xF1, 0x21, 0xF0, 0xA0, 0x50,
+0xD0, 0x80, 0xC0, 0x30, 0xF2, 0x24, 0xF0, 0x23, 0xF4, 0x2C, 0xF0, 0x20, 0xF9, 0xD0, 0xF0, 0xA2,
+0x52, 0xA1, 0xF2, 0xD0, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x27, 0xF4, 0x23, 0xF8, 0x50,
+0xA0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF1, 0x21, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0xD1,
+0x71, 0xA0, 0x40, 0x70, 0x40, 0x02, 0xB0, 0x01, 0xE0, 0xB0, 0x01, 0x30, 0x60, 0xB0, 0x10, 0xE0,
+0xD0, 0x50, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0x21, 0xF1, 0x10, 0x81, 0x30, 0x51, 0x30, 0x80,
+0xA0, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF2, 0x22, 0xF1, 0x23, 0xF3, 0xA1, 0xF2, 0x20, 0xF0,
+0x2A, 0xF2, 0x28, 0xF0, 0x20, 0xF2, 0x23, 0xF0, 0xD2, 0xF1, 0xA2, 0x51, 0xA1, 0x50, 0xA0, 0xF8,
+0x20, 0xF0, 0x27, 0xFB, 0x24, 0xF1, 0x21, 0xF3, 0x22, 0xF0, 0xD0, 0x50, 0x21, 0xF6, 0x21, 0xF0,
+0x50, 0x90, 0x07, 0x90, 0x30, 0x01, 0x90, 0x02, 0x80, 0x70, 0x00, 0x60, 0x80, 0xB0, 0x80, 0xE0,
+0x30, 0xA0, 0x54, 0xA4, 0x90, 0xB0, 0x00, 0x60, 0x80, 0x08, 0x0B, 0x80, 0x90, 0x30, 0x80, 0x70,
+0x50, 0xA1, 0xD0, 0x90, 0xB0, 0x0F, 0x07, 0x30, 0xA0, 0xF0, 0x20, 0xF3, 0x21, 0xF1, 0x20, 0xA0,
+0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0xA0, 0xD0, 0x30, 0x10, 0xD1, 0x20, 0xF0, 0x21, 0xF2, 0x27,
+0xF1, 0x26, 0xF1, 0x24, 0xF2, 0xD1, 0xF2, 0xA1, 0x54, 0xA0, 0x20, 0xF6, 0x22, 0xF1, 0x26, 0xF0,
+0x2C, 0xF1, 0x24, 0xF2, 0xD1, 0xA1, 0x50, 0xA0, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF3,
+0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0x20, 0xF3, 0xD0, 0xC0, 0x31, 0x50, 0x10, 0xB0, 0x04, 0xB0, 0xE0,
+0x02, 0x40, 0x70, 0x00, 0x10, 0xD1, 0x50, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0x50, 0xF3,
+0xD0, 0xA0, 0xC0, 0x60, 0x30, 0xD0, 0xA0, 0x50, 0x30, 0x10, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0xA0,
+0x50, 0xA0, 0xD1, 0xF2, 0x25, 0xF2, 0x50, 0xA0, 0x50, 0xA0, 0xF1, 0xD0, 0xF1, 0x26, 0xF0, 0x25,
+0xF0, 0x23, 0xF0, 0x27, 0xF0, 0x20, 0xFA, 0xA1, 0x53, 0xA2, 0xF0, 0xD1, 0xF7, 0x25, 0xF4, 0x28,
+0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xD0, 0x50, 0x22, 0xF0, 0x20, 0xF2, 0x23, 0xD0, 0x81, 0x06, 0x40,
+0xC0, 0x00, 0xB0, 0x80, 0x03, 0x60, 0x00, 0xE0, 0x40, 0x60, 0x40, 0x60, 0x30, 0xD2, 0xF1, 0x20,
+0xF0, 0xA2, 0x50, 0x70, 0x80, 0x30, 0x70, 0x40, 0x08, 0x0B, 0x80, 0xB0, 0x01, 0x30, 0xA0, 0xD2,
+0x70, 0x60, 0x0F, 0x07, 0x80, 0x50, 0xD0, 0xF0, 0x24, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1,
+0x50, 0xD0, 0x50, 0xC0, 0x80, 0x50, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x27, 0xF1, 0x26, 0xF9, 0x20,
+0xA0, 0x54, 0xA0, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF4, 0x2F, 0x03, 0xF1, 0x2C, 0xF1, 0xD1, 0xF0,
+0xA0, 0x50, 0xA1, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF2, 0x21, 0xF4, 0x50, 0xA0, 0xF0, 0xD0, 0xF2,
+0x20, 0xF1, 0xD0, 0x10, 0x60, 0xC0, 0xB0, 0x90, 0xC0, 0x04, 0x40, 0x04, 0xE0, 0x80, 0x10, 0xA0,
+0xD0, 0x50, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0x10, 0x30, 0xD0, 0x90, 0x10, 0xA0, 0x30, 0x10, 0x80, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0x51, 0xF0,
+0xD0, 0xF0, 0x20, 0xF2, 0x21, 0xF3, 0xA0, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF3, 0x26, 0xF4,
+0x2B, 0xF5, 0x21, 0xF0, 0x22, 0xF1, 0xD0, 0x50, 0xD0, 0xF1, 0xA1, 0x53, 0xA1, 0xF1, 0xD0, 0xF5,
+0x20, 0xF9, 0x25, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF3,
+0x24, 0xD0, 0x70, 0x40, 0x05, 0xE0, 0x30, 0x40, 0x60, 0x40, 0x05, 0x40, 0x60, 0x40, 0x60, 0xE0,
+0x80, 0xD0, 0xF7, 0xD0, 0x50, 0x40, 0x01, 0xE0, 0x40, 0x08, 0x0B, 0x40, 0x60, 0x01, 0x80, 0xA0,
+0xD0, 0xF0, 0xD0, 0x80, 0x40, 0x0F, 0x07, 0xE0, 0x80, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x29, 0xF1,
+0x50, 0xD0, 0xA0, 0x70, 0xC0, 0x50, 0x24, 0xF6, 0x25, 0xF4, 0xD2, 0xF1, 0xA1, 0x53, 0xA0, 0x20,
+0xF7, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF7, 0x29, 0xF0, 0x25, 0xF5, 0xA0, 0x51,
+0xA0, 0xD1, 0xF1, 0xD0, 0xA1, 0xF5, 0x20, 0xF0, 0xD0, 0xF0, 0x51, 0xF5, 0x21, 0xF0, 0x21, 0xA0,
+0xC0, 0x10, 0x90, 0x60, 0x70, 0x90, 0x02, 0xE0, 0xB0, 0x05, 0x80, 0xC0, 0xD0, 0xF0, 0x50, 0xD0,
+0x20, 0xF2, 0x21, 0xF1, 0xD0, 0xA1, 0x21, 0xF0, 0xD0, 0x51, 0xD2, 0x10, 0x50, 0xA0, 0x10, 0x70,
+0xA1, 0xD3, 0xF0, 0x50, 0xA0, 0xF3, 0x20, 0xF3, 0xD0, 0x50, 0xF5, 0xA0, 0x51, 0xA0, 0xF0, 0xD0,
+0xF1, 0x25, 0xF5, 0x2C, 0xF2, 0x21, 0xF1, 0x22, 0xF2, 0x50, 0xD0, 0xF5, 0xD0, 0xF1, 0xA0, 0x53,
+0xA1, 0xF1, 0xD1, 0xF5, 0x21, 0xF5, 0x21, 0xF1, 0x22, 0xF3, 0x20, 0xF2, 0x50, 0xF1, 0x21, 0xF2,
+0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x91, 0x05, 0xB0, 0x80, 0x30, 0x40, 0x60, 0x05, 0x80, 0x00, 0x80,
+0xB0, 0x40, 0x50, 0xD0, 0xF1, 0x22, 0xF2, 0xD0, 0x50, 0xE0, 0x01, 0x40, 0xE0, 0x08, 0x0B, 0xE0,
+0x80, 0x41, 0x70, 0x50, 0xD0, 0xF0, 0xD0, 0x80, 0x30, 0x0F, 0x07, 0x60, 0x30, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF0, 0x29, 0xD0, 0x50, 0xD0, 0xA0, 0xC0, 0x70, 0xD0, 0x22, 0xF1, 0x21, 0xF2, 0x20,
+0xF6, 0xD1, 0xF1, 0xA2, 0x52, 0xA1, 0xF0, 0xA1, 0xD0, 0xF1, 0x25, 0xF1, 0xD0, 0xA0, 0xF1, 0x21,
+0xF0, 0x22, 0xF4, 0x29, 0xF1, 0x20, 0xF5, 0x23, 0xF0, 0xD0, 0xF0, 0xA1, 0x50, 0xA0, 0xF0, 0xD0,
+0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF3, 0xA0, 0x50, 0xF7, 0x24, 0xD1, 0x71, 0xF0, 0xD0,
+0x90, 0xE0, 0x01, 0x40, 0x06, 0x91, 0xD1, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x50,
+0xF1, 0xD2, 0xA0, 0x50, 0xD4, 0xA0, 0x30, 0xC0, 0x32, 0x50, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xF0,
+0xD0, 0xF0, 0x22, 0xF1, 0x50, 0xF0, 0x23, 0xF0, 0xD1, 0xF0, 0xA0, 0x50, 0xA1, 0xF2, 0x25, 0xF1,
+0x21, 0xF0, 0x2F, 0x01, 0xF2, 0x21, 0xF1, 0xA1, 0xF4, 0x21, 0xF3, 0xD1, 0xF1, 0xA1, 0x52, 0xA1,
+0xF2, 0xD0, 0xF0, 0xD0, 0xF7, 0x26, 0xF6, 0x50, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0x21, 0xD0, 0x80,
+0x30, 0x06, 0x90, 0x31, 0x06, 0x30, 0x00, 0x90, 0x00, 0x80, 0x50, 0xF2, 0x23, 0xF1, 0xD0, 0x80,
+0x90, 0x40, 0xE0, 0x30, 0x60, 0x08, 0x0B, 0x60, 0x90, 0xE0, 0x60, 0x40, 0x80, 0xD0, 0x20, 0xD0,
+0x80, 0xE0, 0x0F, 0x07, 0xB0, 0x90, 0x30, 0xF5, 0x21, 0xF1, 0x21, 0xF1, 0x22, 0xD0, 0xA0, 0xF1,
+0xC1, 0xD0, 0x20, 0xF1, 0x26, 0xF1, 0xD0, 0xF3, 0xA1, 0x51, 0xA2, 0xF2, 0xD2, 0xF1, 0xA0, 0xD0,
+0xF4, 0x21, 0xF3, 0xA1, 0xD0, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF2, 0x2C, 0xF0, 0x25, 0xF1, 0xD0,
+0xF1, 0xA0, 0x50, 0xA0, 0xF2, 0x23, 0xF4, 0xA1, 0xD0, 0x21, 0xF1, 0xA0, 0x50, 0xA0, 0xF7, 0x22,
+0xF1, 0x21, 0xD0, 0x31, 0xF1, 0xD0, 0x70, 0x00, 0xE0, 0xB0, 0x06, 0x30, 0x80, 0xD0, 0xF0, 0x50,
+0xD0, 0x26, 0xF2, 0xA1, 0xD0, 0x50, 0x70, 0x90, 0xC2, 0x71, 0xA0, 0xD2, 0x50, 0xA0, 0x80, 0x30,
+0xA0, 0xF4, 0xA0, 0x50, 0xF0, 0xD1, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x21, 0xF6, 0xA0, 0x50,
+0xA0, 0xF0, 0xD1, 0xF2, 0x22, 0xFB, 0x27, 0xF1, 0x23, 0xD0, 0xA0, 0xF2, 0x26, 0xF1, 0x21, 0xF4,
+0xD0, 0x20, 0xA2, 0x52, 0xA1, 0xF1, 0xD1, 0xF2, 0x21, 0xF1, 0x22, 0xF1, 0x24, 0xA1, 0xF1, 0x24,
+0xF1, 0x20, 0xF1, 0x20, 0xD0, 0xA0, 0x80, 0x06, 0x30, 0x10, 0xB0, 0x05, 0x60, 0x30, 0xB0, 0x80,
+0x00, 0x30, 0xA0, 0xF3, 0x22, 0xF1, 0xD0, 0x80, 0x40, 0x60, 0xE0, 0x90, 0xB0, 0x08, 0x0B, 0xB0,
+0x80, 0x01, 0x60, 0x30, 0xD0, 0xF1, 0x50, 0x30, 0x0F, 0x08, 0x71, 0xD0, 0xF4, 0x21, 0xF1, 0x21,
+0xF1, 0x21, 0xF1, 0xA1, 0xD0, 0xA0, 0x90, 0xD0, 0xF5, 0x21, 0xF0, 0x21, 0xA0, 0x53, 0xA1, 0xF1,
+0xD2, 0xF4, 0x24, 0xF7, 0x21, 0xF2, 0xA0, 0xD0, 0x21, 0xF0, 0xA0, 0x50, 0xF4, 0x29, 0xF4, 0x21,
+0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x21, 0xF1, 0x20, 0xF3, 0x20, 0xF1, 0x50,
+0xD0, 0xF1, 0x20, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x22, 0xF2, 0x26, 0xF0, 0xD1, 0xF1, 0xD0, 0x50,
+0x90, 0xE0, 0x07, 0x30, 0xA0, 0xD0, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0xF1, 0xA0,
+0x90, 0xC0, 0x90, 0x10, 0x31, 0xE0, 0x80, 0x30, 0x10, 0x70, 0x50, 0xD1, 0x71, 0xD8, 0xA0, 0x51,
+0xF0, 0x30, 0xD0, 0x50, 0xD0, 0xF0, 0x25, 0xF0, 0x20, 0xF2, 0xD1, 0xF0, 0x51, 0xA0, 0xF4, 0x24,
+0xF7, 0x27, 0xF2, 0x21, 0xF0, 0xD0, 0x50, 0xF3, 0x21, 0xF0, 0x24, 0xF0, 0x26, 0xF2, 0xD2, 0xF0,
+0xA2, 0x52, 0xA1, 0xF0, 0xD0, 0xF4, 0x21, 0xF0, 0x23, 0xF0, 0xA1, 0xF1, 0x25, 0xF0, 0x20, 0xF3,
+0xD0, 0x30, 0x06, 0x30, 0xE0, 0x07, 0x30, 0x40, 0xE0, 0x00, 0x70, 0xD0, 0xF2, 0x23, 0xF1, 0xD0,
+0x30, 0xB0, 0x01, 0x30, 0x09, 0x0C, 0x90, 0x01, 0x60, 0x30, 0xD0, 0x21, 0xD0, 0xC0, 0xB0, 0x0F,
+0x07, 0xC0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xF4, 0x20, 0xA0, 0xD0,
+0xF0, 0x50, 0xD0, 0xF1, 0xD1, 0xF0, 0xA2, 0x52, 0xA0, 0x20, 0xF3, 0x21, 0xF2, 0x20, 0xF4, 0x23,
+0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x24, 0xF1, 0x50, 0xF1, 0x22, 0xF0, 0x25, 0xF9, 0x23, 0xF0, 0xD1,
+0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF2, 0x2B, 0xF0, 0xA1, 0xD0, 0x51, 0xF3, 0x21, 0xF0, 0x23,
+0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xA0, 0x80, 0x30, 0x60, 0x07, 0x90, 0xD1, 0xF0,
+0x50, 0xF1, 0x21, 0xF1, 0xD2, 0xF0, 0xD1, 0x80, 0x70, 0x30, 0x10, 0xD0, 0x30, 0xF0, 0x30, 0x10,
+0x30, 0x60, 0x40, 0x80, 0x71, 0xA0, 0x80, 0x30, 0x70, 0x90, 0x70, 0xC0, 0x30, 0xD0, 0xA0, 0x30,
+0x70, 0xC0, 0x80, 0x50, 0x81, 0x30, 0xD1, 0xF2, 0x23, 0xF0, 0x21, 0xF3, 0xD1, 0xA0, 0x51, 0xA0,
+0xF0, 0xD0, 0xF0, 0x26, 0xF0, 0x2B, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x22, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF5, 0x20, 0xF1, 0x23, 0xF3, 0xD0, 0xF1, 0xA0, 0x53, 0xA1, 0xF0,
+0xD1, 0xF3, 0x20, 0xF0, 0x50, 0xF2, 0x26, 0xF0, 0x21, 0xF1, 0xD0, 0x70, 0x06, 0x30, 0x08, 0x80,
+0xC0, 0x00, 0xB0, 0x30, 0xD0, 0x27, 0xF0, 0xD0, 0x90, 0xB0, 0x01, 0x90, 0x09, 0x0C, 0xC0, 0x30,
+0x90, 0x30, 0x90, 0xD0, 0xF0, 0x20, 0xD0, 0x80, 0x60, 0x0F, 0x07, 0x70, 0xD0, 0x20, 0xF4, 0x21,
+0xF0, 0x20, 0xF4, 0xA0, 0xD0, 0xF1, 0x50, 0xD0, 0x80, 0xA0, 0x20, 0xA1, 0x52, 0xA1, 0xF1, 0xD1,
+0xF1, 0x2F, 0x05, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x29, 0xFE, 0xA0, 0x51, 0xA0,
+0xF3, 0x21, 0xF1, 0x22, 0xF1, 0x21, 0xF0, 0x22, 0xF1, 0xD0, 0x51, 0xF0, 0xD0, 0xF1, 0x23, 0xF0,
+0x24, 0xF0, 0x25, 0xF1, 0x22, 0xF0, 0x30, 0x90, 0x60, 0x07, 0x80, 0x70, 0xD0, 0xF0, 0x50, 0xD0,
+0x20, 0xF3, 0x80, 0x30, 0x90, 0x70, 0x30, 0xD0, 0xF0, 0xA0, 0xF0, 0x50, 0xF1, 0xD1, 0x50, 0x90,
+0xC0, 0x90, 0x80, 0x90, 0x70, 0xE0, 0xC0, 0x91, 0x01, 0x80, 0x70, 0x90, 0x30, 0xC0, 0x70, 0x50,
+0x30, 0xD0, 0x50, 0x30, 0x71, 0xF2, 0x24, 0xF2, 0x23, 0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xA1, 0xF3,
+0x2F, 0x00, 0xF3, 0x20, 0xF1, 0x50, 0xD0, 0x20, 0xF2, 0x21, 0xF3, 0x20, 0xF1, 0x23, 0xF2, 0x29,
+0xF7, 0xA1, 0x52, 0xA1, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0xF1, 0xD0, 0xF0, 0x27, 0xF1, 0xD0,
+0x30, 0xE0, 0x05, 0x30, 0x08, 0xB0, 0x40, 0x00, 0x40, 0x80, 0xD0, 0x27, 0xF0, 0xD0, 0x70, 0x30,
+0x90, 0x30, 0x90, 0x09, 0x0C, 0x30, 0x02, 0x70, 0xD0, 0xF0, 0x20, 0xD0, 0x70, 0xE0, 0x01, 0x30,
+0xB0, 0x0F, 0x03, 0x90, 0xD0, 0xF1, 0x25, 0xF0, 0x21, 0xF2, 0xA0, 0xC0, 0xD1, 0xA0, 0x51, 0x30,
+0x80, 0xA1, 0xF1, 0x21, 0xF0, 0x20, 0xF9, 0x21, 0xF1, 0x27, 0xF2, 0x26, 0xF6, 0x50, 0xA0, 0xD0,
+0x21, 0xF3, 0x27, 0xF0, 0x21, 0xF5, 0xA0, 0x50, 0xA0, 0xF4, 0x21, 0xF1, 0x21, 0xF2, 0x23, 0xF0,
+0x21, 0xF1, 0xA0, 0x52, 0xD0, 0xF1, 0x20, 0xF3, 0x2A, 0xF0, 0xD1, 0xF0, 0x20, 0xF1, 0xD0, 0x50,
+0xC0, 0x00, 0xB0, 0xE0, 0x06, 0x70, 0xD1, 0x50, 0xF0, 0x21, 0xD1, 0xC0, 0x40, 0xB0, 0x00, 0xE0,
+0x70, 0xD0, 0xF1, 0x50, 0xD0, 0xF0, 0xD1, 0x50, 0xD1, 0x81, 0xA1, 0xD0, 0xA0, 0x90, 0x11, 0x90,
+0xC0, 0x80, 0x50, 0xA2, 0xD3, 0x50, 0xA0, 0x80, 0x70, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x26, 0xF2,
+0x20, 0xF4, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF1, 0xD0, 0xF1, 0x26, 0xF1, 0x21, 0xF4, 0x20, 0xF1,
+0x51, 0xF2, 0xD0, 0xF5, 0x23, 0xF3, 0x21, 0xF0, 0x51, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x21,
+0xF9, 0xA2, 0x53, 0xA0, 0xF2, 0xD1, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0xA0, 0x30, 0x05, 0x30, 0x0B,
+0x30, 0xA0, 0xD0, 0x22, 0xF1, 0x21, 0xF1, 0xD0, 0x90, 0x01, 0xB0, 0x80, 0x00, 0x30, 0xE0, 0x06,
+0x0C, 0x80, 0xB0, 0x01, 0x90, 0xF0, 0x21, 0xD0, 0x30, 0x40, 0x01, 0xC0, 0x40, 0x0F, 0x03, 0x90,
+0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0xD0, 0xF0, 0xA1, 0x50, 0x70, 0xA0, 0x50, 0xA0, 0x50,
+0xD2, 0xF3, 0x2B, 0xF7, 0x25, 0xF3, 0x20, 0xF4, 0xD1, 0xF0, 0xA0, 0x51, 0xA2, 0xF1, 0x20, 0xF0,
+0xD0, 0xA0, 0xF2, 0x25, 0xF2, 0xD1, 0xF0, 0xA0, 0x50, 0xA1, 0xD0, 0xF3, 0x28, 0xF3, 0x21, 0xF2,
+0x20, 0x51, 0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x2A, 0xF0, 0xA1, 0xF1, 0x20,
+0xF0, 0xA1, 0x90, 0x01, 0x70, 0x60, 0x00, 0x40, 0xB0, 0x02, 0x81, 0xD0, 0x50, 0xD0, 0x20, 0xF1,
+0xD0, 0x90, 0x02, 0xC0, 0x50, 0xD0, 0xF1, 0xA1, 0xD0, 0x80, 0x51, 0xD2, 0xA0, 0xD1, 0xA0, 0x11,
+0x70, 0x30, 0xC0, 0xD1, 0x20, 0xF5, 0xA1, 0xD1, 0x51, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF0,
+0x21, 0xF2, 0x21, 0xF4, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF2, 0x23, 0xF6, 0x20, 0xF1, 0x20,
+0xD0, 0x50, 0xA0, 0x52, 0xA0, 0xF0, 0xD1, 0xF6, 0x23, 0xF0, 0x22, 0xF0, 0x21, 0xF3, 0x29, 0xF4,
+0xD1, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0x53, 0xA0, 0xF1, 0xD0, 0xF5, 0x20, 0xD0, 0x90, 0x05, 0x30,
+0x04, 0xB0, 0x30, 0x04, 0x70, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0xA0, 0x30, 0x01, 0x60, 0x40,
+0x80, 0xB0, 0x30, 0x06, 0x0C, 0x42, 0x80, 0x70, 0xA0, 0xF0, 0x20, 0xF0, 0xA0, 0x30, 0x01, 0xC0,
+0xE0, 0x0F, 0x03, 0x90, 0xD0, 0xF2, 0xD1, 0xF0, 0xA2, 0x52, 0xA0, 0xF0, 0xD0, 0xC0, 0x30, 0xD1,
+0x50, 0xF3, 0x20, 0xF2, 0x20, 0xF0, 0x24, 0xF0, 0x23, 0xF4, 0x20, 0xF0, 0x25, 0xF6, 0xD0, 0xF0,
+0xA0, 0x52, 0xA0, 0xF2, 0xD0, 0x50, 0xD0, 0x21, 0xF0, 0xD0, 0x70, 0xA0, 0xF1, 0x23, 0xF2, 0xD0,
+0xF0, 0xA0, 0x51, 0xA0, 0xD0, 0xF2, 0x24, 0xF0, 0x22, 0xF0, 0x21, 0xF2, 0x22, 0xF0, 0xD0, 0xF0,
+0x51, 0xF0, 0xD0, 0xF1, 0xD0, 0x50, 0xF3, 0x21, 0xF3, 0x22, 0xF0, 0x20, 0xF3, 0xA0, 0x20, 0xF0,
+0x20, 0xF1, 0x50, 0xD0, 0x50, 0x70, 0x60, 0x08, 0x90, 0xE0, 0x50, 0xD3, 0x81, 0x02, 0xC0, 0xD0,
+0xF2, 0xD0, 0x50, 0xD1, 0xF0, 0xD1, 0x50, 0x10, 0xC0, 0x10, 0xA0, 0xD5, 0xF3, 0x22, 0xF1, 0x50,
+0xD0, 0xF2, 0xC0, 0x51, 0xF3, 0x24, 0xF0, 0x21, 0xF0, 0x22, 0xF7, 0xD0, 0xA0, 0x51, 0xA0, 0xF0,
+0xD0, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x50, 0xD1, 0xF1, 0xA0, 0x52, 0xA0, 0xF0, 0xD1,
+0xF2, 0x21, 0xF3, 0x26, 0xF0, 0x27, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF5, 0xA1, 0xD0, 0xF2,
+0x20, 0xA1, 0x52, 0xA1, 0xF1, 0xD2, 0x90, 0x05, 0x30, 0x05, 0x60, 0x10, 0x03, 0x70, 0xD0, 0x20,
+0xF2, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0x70, 0x80, 0x40, 0x30, 0x60, 0xB0, 0x90, 0x40, 0x06,
+0x09, 0xB1, 0x00, 0xE0, 0x30, 0xE0, 0xB0, 0x80, 0x50, 0x21, 0xF1, 0x70, 0x00, 0xB0, 0x10, 0xE0,
+0x0F, 0x03, 0xC0, 0xF0, 0x20, 0xA1, 0x52, 0xA1, 0xF1, 0xD2, 0xF0, 0xD0, 0x90, 0x70, 0xD0, 0x50,
+0xA0, 0xF0, 0xA0, 0x10, 0xD0, 0x20, 0xF1, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20,
+0xF3, 0x20, 0xF2, 0x22, 0xF2, 0xD0, 0xF0, 0x20, 0xA1, 0x51, 0xA0, 0xF4, 0x21, 0xF0, 0x50, 0xF1,
+0x21, 0xF0, 0xD1, 0xF7, 0xA0, 0x51, 0xA0, 0xD1, 0xF2, 0x27, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0x20,
+0xF1, 0xA0, 0x50, 0xF2, 0x21, 0xF0, 0xD0, 0xA1, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0xF0,
+0x21, 0xF2, 0x23, 0xF1, 0x50, 0xA0, 0xD1, 0xF0, 0x70, 0x60, 0x40, 0x10, 0x05, 0x40, 0x10, 0x80,
+0xA0, 0x50, 0x30, 0xC0, 0x10, 0x02, 0xC1, 0xD0, 0x20, 0xF2, 0xA0, 0x50, 0xD0, 0xF2, 0xD0, 0xA0,
+0x80, 0xF0, 0xD0, 0xF0, 0x23, 0xF4, 0x21, 0xF1, 0x50, 0xF2, 0x20, 0xD0, 0x90, 0xF0, 0x80, 0x50,
+0xA0, 0xF3, 0x23, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0x21, 0xF1, 0xD1, 0xF0, 0xA0, 0x50, 0xA1, 0xF2,
+0x23, 0xF0, 0x22, 0xF2, 0xA1, 0xD0, 0xF0, 0x21, 0xF3, 0xA0, 0x51, 0xA1, 0xF6, 0x2C, 0xF1, 0x21,
+0xF1, 0x20, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x21, 0xF1, 0xD3, 0xF1,
+0xA1, 0x52, 0xA0, 0x30, 0x60, 0x04, 0x90, 0x06, 0xB0, 0x02, 0xE0, 0x80, 0xD0, 0xF0, 0x20, 0xF1,
+0x22, 0xF1, 0xD0, 0x30, 0xE0, 0xB0, 0xE0, 0x70, 0xB0, 0x09, 0x05, 0x40, 0xB0, 0x01, 0xE0, 0x10,
+0xE0, 0x60, 0x40, 0x01, 0xE0, 0x80, 0xD0, 0x21, 0xD0, 0x70, 0x00, 0x71, 0x60, 0x0F, 0x00, 0xB0,
+0x60, 0xE0, 0x90, 0x50, 0xA2, 0x20, 0xF1, 0xD0, 0xF6, 0xD0, 0x80, 0xC0, 0x50, 0xC0, 0xD0, 0x50,
+0xF0, 0x30, 0xD0, 0xF2, 0x26, 0xF0, 0x26, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0xF1, 0xA0, 0x51,
+0xA0, 0xF7, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0x22, 0xF2, 0x21, 0xF0, 0xD0, 0xF1, 0xA0, 0x50, 0xA0,
+0x20, 0xF1, 0x20, 0xF8, 0x23, 0xF3, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0x23, 0xF1, 0x20,
+0xF0, 0x50, 0xA0, 0xF2, 0x23, 0xF3, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0,
+0xF1, 0xD0, 0xF0, 0x30, 0x70, 0x90, 0x04, 0xB0, 0x90, 0x60, 0x80, 0xC0, 0x90, 0xE1, 0x60, 0x40,
+0x80, 0x70, 0xC0, 0x90, 0xD0, 0x23, 0xD0, 0x50, 0xF0, 0x22, 0xF1, 0xD0, 0xF3, 0x20, 0xF2, 0x24,
+0xF0, 0xD0, 0xA1, 0xD0, 0x20, 0xF0, 0x20, 0xD0, 0x30, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0xD0,
+0xF0, 0x21, 0xF0, 0x26, 0xF3, 0x24, 0xF5, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x22, 0xF2, 0xD0,
+0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xA1, 0x51, 0xA0, 0xF0, 0xD1, 0xF4, 0x22,
+0xF1, 0x20, 0xF6, 0x23, 0xF1, 0x25, 0xD0, 0x50, 0xF2, 0x22, 0xF1, 0x21, 0xF2, 0xD1, 0xF2, 0x80,
+0x40, 0xE0, 0x40, 0xE0, 0x60, 0xB0, 0x30, 0x0A, 0x30, 0xA0, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x20,
+0xD0, 0x90, 0xB0, 0x01, 0x30, 0x00, 0x40, 0x72, 0x80, 0x04, 0x05, 0xC0, 0x10, 0xE0, 0x02, 0x70,
+0xB0, 0x80, 0x01, 0x60, 0x30, 0xD0, 0x21, 0xD0, 0xC0, 0xE0, 0x80, 0x30, 0xE0, 0x09, 0xB0, 0x60,
+0xE0, 0x41, 0xE1, 0xB0, 0x00, 0x70, 0xA0, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x21, 0xF3, 0xD1, 0x10,
+0x90, 0x50, 0x80, 0x50, 0xA0, 0x10, 0xD0, 0xF2, 0x21, 0xF0, 0xD3, 0x20, 0xF3, 0x22, 0xF5, 0xD1,
+0x20, 0xA0, 0x52, 0xA0, 0xF0, 0xD0, 0xF4, 0x24, 0xF2, 0xD0, 0x50, 0xF6, 0xD0, 0xF0, 0xA0, 0x50,
+0xA0, 0xF0, 0xD1, 0xF0, 0x20, 0xF1, 0x21, 0xF6, 0x23, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xF0,
+0x51, 0xF0, 0xD0, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xF1, 0xD0, 0xF0, 0x23, 0xF1, 0x25, 0xF0,
+0x22, 0xD0, 0x50, 0xF2, 0x20, 0xF1, 0xD1, 0x30, 0x70, 0x60, 0x05, 0xE0, 0x00, 0x40, 0x01, 0x10,
+0xE0, 0x60, 0x31, 0x90, 0xD3, 0xF2, 0x50, 0xD0, 0x23, 0xF1, 0x20, 0xF2, 0x26, 0xF0, 0xD0, 0xA0,
+0x50, 0xD0, 0xF2, 0x20, 0xA0, 0x70, 0xD3, 0xF0, 0x51, 0xD0, 0xF1, 0x22, 0xF0, 0x24, 0xF1, 0x21,
+0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0x51, 0xA0, 0xF3, 0x22, 0xF1, 0x50, 0xD0,
+0xF0, 0x21, 0xF0, 0x24, 0xF2, 0xD1, 0xF0, 0xA1, 0x51, 0xA0, 0xF0, 0xD0, 0xF9, 0x21, 0xF2, 0x20,
+0x90, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0x50, 0xF0, 0x21, 0xF2, 0x24, 0xF5, 0xD0, 0x50, 0x80,
+0x02, 0xB0, 0x80, 0x40, 0xE0, 0x40, 0xE0, 0x60, 0x06, 0x90, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF0,
+0x20, 0xD0, 0x90, 0x02, 0x30, 0x60, 0x70, 0xB1, 0x60, 0x80, 0x10, 0xB0, 0x02, 0x05, 0x90, 0xB0,
+0x70, 0x30, 0x01, 0xC0, 0x00, 0x90, 0x30, 0x92, 0xD0, 0xF1, 0xD0, 0x70, 0xC0, 0xE0, 0x70, 0x04,
+0xB0, 0x60, 0xE1, 0x41, 0xE0, 0x60, 0x06, 0x90, 0xD1, 0x20, 0xF3, 0x20, 0xF0, 0x25, 0xF0, 0xD0,
+0x30, 0xC0, 0x80, 0x90, 0xA0, 0xD1, 0xF0, 0x24, 0xD0, 0xC2, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x23, 0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0xF0, 0xD0, 0xF4, 0x20, 0xF1, 0x27, 0xF0, 0xD0, 0x50,
+0xF3, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xD1, 0xF2, 0x26, 0xF6, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xF0,
+0xA0, 0x50, 0xF0, 0xD0, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0x50, 0xD0, 0xF0, 0x24, 0xF0, 0x27,
+0xF2, 0xA1, 0xF0, 0x22, 0xF2, 0x20, 0xD1, 0x90, 0x70, 0x80, 0x03, 0x80, 0xE2, 0x00, 0x60, 0x90,
+0x00, 0x80, 0x90, 0x60, 0x80, 0x10, 0x31, 0x50, 0xD1, 0x50, 0xA0, 0xF1, 0x24, 0xF1, 0x25, 0xF1,
+0xD0, 0xF0, 0x50, 0xD1, 0xF2, 0x20, 0xF1, 0x50, 0x80, 0xD1, 0xF2, 0x51, 0xF0, 0xD0, 0xF1, 0x20,
+0xF2, 0x26, 0xF5, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF2, 0xA1,
+0x21, 0xF0, 0x20, 0xF2, 0x22, 0xF3, 0x20, 0xF4, 0xA0, 0x52, 0xA0, 0xF0, 0xD1, 0xF2, 0x22, 0xF2,
+0x20, 0xF0, 0x21, 0xF1, 0x25, 0xF1, 0xA0, 0xF0, 0x2A, 0xF4, 0xD0, 0xF0, 0x90, 0x00, 0x90, 0x30,
+0xB0, 0xC0, 0x03, 0x60, 0xE0, 0x41, 0xE1, 0xB1, 0x90, 0xD0, 0xF5, 0x23, 0xD0, 0x70, 0x91, 0x31,
+0x60, 0x90, 0x03, 0xE0, 0x80, 0x02, 0x05, 0x80, 0x40, 0x00, 0x80, 0xC1, 0xE0, 0x00, 0x90, 0xB0,
+0x01, 0x90, 0xD1, 0xF0, 0xD0, 0x50, 0x10, 0x60, 0x90, 0x00, 0x60, 0xE0, 0x41, 0xE0, 0x60, 0xB0,
+0x0B, 0x30, 0xA0, 0x20, 0xF1, 0x2B, 0xF0, 0xA0, 0x10, 0xA2, 0xF0, 0x50, 0xA0, 0xF0, 0x23, 0xD0,
+0xA0, 0xC0, 0x90, 0x40, 0x30, 0xD1, 0xF4, 0x20, 0xA1, 0x51, 0xA0, 0xF1, 0xD0, 0xF0, 0x23, 0xF0,
+0x21, 0xF3, 0x26, 0xF2, 0xA0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0x21, 0xF4, 0x24,
+0xF9, 0x21, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xD0,
+0xA0, 0x51, 0xD0, 0xF0, 0x20, 0xF0, 0x2B, 0xF0, 0xD0, 0x50, 0xD0, 0xF1, 0x26, 0xF0, 0xD1, 0x80,
+0x70, 0x80, 0x40, 0x30, 0x90, 0xC0, 0x80, 0x90, 0xC0, 0x31, 0xB0, 0xC0, 0x10, 0x90, 0x70, 0x30,
+0x40, 0xE0, 0xC1, 0xD0, 0xF0, 0x50, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD1,
+0xF2, 0x51, 0xA1, 0xF0, 0x50, 0xA0, 0xD0, 0x50, 0x80, 0x10, 0xD0, 0xF0, 0x20, 0xF3, 0xA0, 0x50,
+0xA0, 0xD0, 0xF0, 0xD0, 0xF2, 0x26, 0xF0, 0x23, 0xF1, 0x24, 0xF1, 0xD0, 0xF0, 0xD0, 0xA0, 0x50,
+0xA1, 0x20, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF5, 0x24, 0xF0, 0xD2, 0xF0, 0xA0,
+0x51, 0xA0, 0xF5, 0x29, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xA1, 0xF0, 0x25, 0xF4, 0x21, 0xF1, 0x21,
+0xD0, 0x30, 0xE0, 0x80, 0xC0, 0x90, 0x09, 0xB0, 0x60, 0x81, 0x50, 0xA2, 0xF5, 0xD1, 0x90, 0x01,
+0xB0, 0x30, 0x00, 0x30, 0x70, 0x40, 0xE1, 0x70, 0x60, 0x02, 0x05, 0xE0, 0x40, 0x02, 0xB0, 0x01,
+0x80, 0xB0, 0x01, 0x90, 0xE0, 0xF1, 0xA1, 0x90, 0x40, 0x90, 0x70, 0xB1, 0x0F, 0x01, 0x80, 0x50,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x26, 0xD0, 0x70, 0x91, 0x30, 0xF5, 0x22, 0xD1, 0x10,
+0x80, 0xE0, 0x70, 0xD1, 0xF1, 0xA0, 0x51, 0xA0, 0xF1, 0xD0, 0xF0, 0xD1, 0xF1, 0x28, 0xF3, 0x21,
+0xF3, 0xD1, 0x50, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF4, 0x23, 0xF1, 0x29, 0xF4, 0x20, 0xF0, 0xD0,
+0xA0, 0x50, 0xA0, 0x20, 0xF3, 0x22, 0xF1, 0x20, 0xF4, 0xA0, 0x50, 0xD0, 0xA1, 0xF0, 0xD0, 0x29,
+0xF0, 0x21, 0xD0, 0xA1, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x23, 0xD0, 0xF0, 0xD0, 0xF0, 0xA0, 0x80,
+0xA0, 0x50, 0xD0, 0x80, 0x71, 0x02, 0xC0, 0xE0, 0x03, 0x90, 0x70, 0x10, 0xA0, 0xD0, 0xA1, 0xF1,
+0x20, 0xF1, 0xD0, 0xF2, 0x20, 0xF1, 0x50, 0xD0, 0x90, 0x31, 0x80, 0xD0, 0x51, 0xA1, 0x10, 0xC0,
+0x12, 0xA0, 0xD0, 0xF0, 0x23, 0xF1, 0x51, 0xF1, 0xD0, 0xF0, 0x25, 0xF1, 0x21, 0xF2, 0x24, 0xF1,
+0x21, 0xF1, 0xD0, 0xF1, 0x20, 0xA0, 0x50, 0xA0, 0x50, 0xD1, 0xF1, 0x20, 0xF4, 0x24, 0xF0, 0x21,
+0xF1, 0x20, 0xF3, 0xD1, 0xF0, 0xA1, 0x51, 0xA0, 0xF1, 0xD0, 0xF2, 0x21, 0xF2, 0x20, 0xF5, 0xA0,
+0xF1, 0x20, 0xF0, 0x27, 0xF2, 0x22, 0xF2, 0x70, 0x80, 0x0D, 0x90, 0xD0, 0xF1, 0xA1, 0x52, 0xA1,
+0xF0, 0xD0, 0xA0, 0x30, 0x01, 0x60, 0x40, 0x00, 0xB0, 0x80, 0x30, 0x90, 0x30, 0x40, 0x03, 0x07,
+0x40, 0x70, 0xC1, 0x70, 0x00, 0xE0, 0x71, 0x11, 0x80, 0x51, 0xA0, 0xF0, 0x70, 0x50, 0x70, 0x10,
+0x0F, 0x03, 0x80, 0x50, 0xF0, 0x24, 0xF0, 0x21, 0xF4, 0x21, 0xF0, 0xA0, 0x50, 0xF0, 0xA1, 0xD0,
+0xF2, 0x23, 0xF0, 0xD1, 0x70, 0xC0, 0x60, 0x30, 0xA0, 0x50, 0xA0, 0xF0, 0x80, 0xD1, 0x80, 0x21,
+0xF3, 0x2A, 0xF0, 0x20, 0xF3, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xD0, 0xF1, 0x24, 0xF7, 0x29, 0xF2,
+0x20, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x20, 0xF2, 0x26, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1,
+0xA1, 0xD0, 0xF1, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0x20, 0xF0, 0x20, 0xF3, 0x20,
+0xF1, 0x20, 0xF3, 0xD1, 0xF0, 0x50, 0xD1, 0x80, 0x10, 0x01, 0x60, 0x10, 0x60, 0xB0, 0x00, 0xE0,
+0x70, 0x40, 0x00, 0x30, 0xA0, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x20, 0xF5, 0xD0, 0x30, 0x10, 0x80,
+0xC0, 0x90, 0x70, 0x80, 0xD0, 0x50, 0x90, 0x80, 0x90, 0x70, 0x60, 0x90, 0x70, 0x80, 0x90, 0xD3,
+0x20, 0xF2, 0xD0, 0xF0, 0x50, 0xA0, 0xF3, 0x22, 0xF1, 0x20, 0xF2, 0x2B, 0xF0, 0x21, 0xF0, 0x20,
+0xD1, 0x52, 0xA0, 0xF0, 0xD0, 0xF4, 0x27, 0xF1, 0x20, 0xF3, 0x23, 0xF0, 0xD1, 0xF0, 0xA1, 0x51,
+0xA0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF9, 0x50, 0xF1, 0x22, 0xF2, 0x20, 0xF3, 0x25, 0xF0, 0xD0, 0xA0,
+0x90, 0x0C, 0xB0, 0x90, 0xD0, 0xF1, 0xD0, 0xF0, 0xD1, 0xF1, 0xA1, 0x50, 0x80, 0x11, 0x71, 0xB0,
+0x90, 0x70, 0x30, 0x70, 0xC0, 0x80, 0x04, 0x06, 0x30, 0x70, 0xE0, 0x30, 0xB0, 0x60, 0x90, 0xB0,
+0x10, 0xC0, 0x91, 0x80, 0xD0, 0x20, 0xF1, 0xD0, 0x50, 0x11, 0x0F, 0x03, 0x90, 0xD0, 0x23, 0xF0,
+0x21, 0xF0, 0x22, 0xF2, 0x22, 0xD0, 0x51, 0xD0, 0x50, 0xD0, 0xF1, 0x21, 0xF1, 0xD1, 0xF0, 0xA0,
+0xE0, 0x30, 0x71, 0x10, 0x50, 0xD0, 0xF0, 0xD3, 0x24, 0xF1, 0x20, 0xF0, 0x2A, 0xF0, 0xD0, 0xF0,
+0xA0, 0x51, 0xF0, 0xD0, 0xF0, 0x50, 0xF3, 0x23, 0xF4, 0x24, 0xF0, 0x26, 0xF1, 0xD0, 0xF0, 0x51,
+0xF0, 0xD0, 0x20, 0xF0, 0x22, 0xF4, 0x23, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0x20, 0xF2, 0xA0, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x24, 0xF1, 0xD0, 0x50, 0xF1, 0x21, 0xF6, 0x25, 0xF2, 0x50, 0xF1, 0xD0,
+0xF0, 0x71, 0x10, 0x40, 0x11, 0x80, 0x70, 0x60, 0x01, 0x70, 0xD0, 0x20, 0xF0, 0xA1, 0xD0, 0x21,
+0xF3, 0xD0, 0xA0, 0x30, 0x70, 0x10, 0x90, 0x30, 0xB0, 0x00, 0x70, 0x90, 0x40, 0xE0, 0x80, 0x40,
+0x03, 0x80, 0x10, 0xC0, 0x10, 0x70, 0xA0, 0xD4, 0x51, 0x80, 0x50, 0xF1, 0xD0, 0xF0, 0x21, 0xF0,
+0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x22, 0xF1, 0xD0, 0x50,
+0xF0, 0xD0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF0, 0x21, 0xF1, 0x22, 0xFA, 0x22, 0xF4, 0xD0, 0xF0,
+0xA0, 0x52, 0xA0, 0xF0, 0xD1, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xD0, 0xF4, 0x20, 0xF5, 0x26,
+0xF0, 0xD0, 0x70, 0x0C, 0x80, 0x50, 0xD0, 0xF5, 0x23, 0xD0, 0x31, 0x90, 0xC0, 0x10, 0x60, 0x30,
+0x03, 0x30, 0x80, 0x03, 0x06, 0xC0, 0x01, 0xB0, 0x90, 0x00, 0x70, 0xB0, 0x30, 0x01, 0xB0, 0x30,
+0xD0, 0x22, 0xD0, 0x50, 0x70, 0xC0, 0xE0, 0x0F, 0x02, 0x90, 0xD0, 0x2A, 0xF2, 0x22, 0xF2, 0xD0,
+0xA1, 0xF1, 0xD0, 0xF1, 0xA1, 0x51, 0xA0, 0x31, 0xC0, 0x10, 0x30, 0xA0, 0xF0, 0x22, 0xF0, 0x24,
+0xF7, 0x21, 0xF5, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xF3, 0x23, 0xF2, 0x24,
+0xF3, 0x24, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF2, 0x22, 0xF2,
+0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0xA0, 0x50, 0xF0, 0xD1, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0,
+0xD0, 0xA1, 0xF0, 0x22, 0xF7, 0x24, 0xF2, 0x50, 0x21, 0xF1, 0xD1, 0xF0, 0xA0, 0x71, 0x10, 0xE0,
+0x02, 0x10, 0xD0, 0x21, 0xD0, 0x50, 0xF0, 0x22, 0xF2, 0xC0, 0x70, 0x40, 0x32, 0x07, 0xB0, 0x40,
+0x02, 0xB1, 0x70, 0x01, 0x10, 0x30, 0xA1, 0x30, 0xC0, 0x90, 0x70, 0x40, 0x70, 0xC0, 0x80, 0xA0,
+0xD1, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0x20, 0xF2, 0x25, 0xF0, 0x21, 0xF2, 0x50, 0xF2, 0xD0, 0xF0,
+0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF4, 0x21, 0xF0, 0x28, 0xF0, 0x25, 0xF5, 0xA0, 0x51, 0xA0, 0xF4,
+0xD0, 0xA1, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0xD0, 0x30, 0x60, 0x0B, 0x90,
+0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xD0, 0x70, 0x02, 0x90, 0xB0, 0x70, 0xE0, 0x02, 0xE0, 0x30,
+0x03, 0x06, 0x90, 0x40, 0xB0, 0x90, 0x40, 0x80, 0x40, 0x00, 0x30, 0x01, 0x60, 0x90, 0xD0, 0xF4,
+0x80, 0x30, 0x80, 0x0F, 0x02, 0x90, 0xD0, 0x2F, 0x01, 0xF3, 0xA1, 0xF1, 0xA0, 0x51, 0xA1, 0xF0,
+0xD1, 0x50, 0x80, 0x30, 0x50, 0xC0, 0x30, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xD0, 0xF4, 0x20,
+0xF3, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x20, 0xF3, 0x2B,
+0xF2, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF4, 0x21, 0xF0, 0x20, 0xF1, 0x24, 0xF1, 0xA0, 0x50,
+0xF0, 0xD0, 0x26, 0xF0, 0xA0, 0x50, 0xF3, 0x22, 0xF0, 0x20, 0xD0, 0x50, 0x20, 0xF0, 0x29, 0xF1,
+0x24, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xD0, 0xF0, 0xD1, 0x80, 0x10, 0x70, 0x40, 0x00,
+0x10, 0xD0, 0x22, 0xF0, 0x50, 0xF0, 0x21, 0xF1, 0x70, 0x40, 0x00, 0xB0, 0x80, 0x30, 0x90, 0xB0,
+0x08, 0x40, 0x80, 0x30, 0x01, 0x10, 0x01, 0x70, 0x60, 0xC0, 0x30, 0x40, 0x60, 0x30, 0x60, 0x01,
+0x30, 0x10, 0x30, 0xA0, 0xF0, 0xD0, 0x23, 0xF0, 0x22, 0xF2, 0x20, 0xD0, 0xF2, 0x20, 0xF1, 0x23,
+0xF0, 0xA0, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x20, 0x51, 0xA0, 0xF0, 0xD1, 0xF2, 0x26, 0xF2, 0x22,
+0xF0, 0x22, 0xF9, 0xA1, 0x51, 0xA1, 0xF0, 0xA0, 0xF4, 0x22, 0xF3, 0x28, 0xF0, 0xD0, 0x50, 0x40,
+0x0A, 0xE0, 0x80, 0xD0, 0x21, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0xD0, 0x70, 0x02, 0x30, 0x00, 0x60,
+0x70, 0xC0, 0x91, 0xC0, 0xB0, 0x03, 0x07, 0x90, 0x70, 0x80, 0xE0, 0x40, 0xB0, 0x00, 0x91, 0x30,
+0x80, 0xC0, 0xD0, 0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xE0, 0x80, 0x0F, 0x01, 0xB0, 0x90, 0xD0, 0x21,
+0xF0, 0x28, 0xF0, 0x21, 0xF1, 0xD0, 0xF2, 0xA0, 0x51, 0xA1, 0xF0, 0xD1, 0xF0, 0x21, 0xF0, 0xD0,
+0x50, 0xC0, 0xA0, 0xD2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x90, 0xF7, 0xD0, 0xF0,
+0x52, 0xF6, 0x21, 0xF2, 0x50, 0xD0, 0x21, 0xF2, 0x28, 0xF4, 0x20, 0xF0, 0xD0, 0xF0, 0x51, 0xF0,
+0xD0, 0xF1, 0x25, 0xF2, 0x23, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x27, 0xF0, 0xD0, 0x51, 0xF0,
+0xD0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF2, 0x28, 0xF2, 0x23, 0xF1, 0x50, 0xF0, 0x21, 0xD0,
+0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x50, 0x11, 0x90, 0xC0, 0xD0, 0x22, 0xD0, 0xA0, 0xF1, 0x20, 0xD0,
+0xA0, 0xC0, 0x01, 0x40, 0x80, 0x70, 0xC0, 0xB0, 0x09, 0x80, 0x90, 0x00, 0x90, 0x60, 0x03, 0x70,
+0xB0, 0x00, 0xC0, 0x10, 0x40, 0x01, 0x30, 0x00, 0x70, 0x60, 0x51, 0xD0, 0xF2, 0x20, 0xF0, 0x20,
+0xF0, 0x21, 0xF5, 0xD0, 0xF4, 0x20, 0xF0, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xD1, 0xA0, 0x51,
+0xA0, 0xF0, 0xD0, 0xF1, 0x26, 0xF1, 0x22, 0xF5, 0x26, 0xF0, 0xD2, 0xF0, 0xA0, 0x52, 0xA0, 0xF7,
+0x22, 0xF0, 0x27, 0xF2, 0x30, 0x0A, 0x70, 0xA0, 0xF1, 0x22, 0xF4, 0x20, 0xD0, 0xA0, 0x70, 0x30,
+0x91, 0x80, 0x02, 0xB0, 0x61, 0x05, 0x07, 0xB0, 0x70, 0xC0, 0x90, 0x30, 0xC0, 0x41, 0xB0, 0x01,
+0x30, 0xA0, 0xF1, 0xD1, 0x30, 0x90, 0x70, 0x40, 0x0F, 0x01, 0x60, 0x30, 0xD0, 0xF2, 0x27, 0xF2,
+0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0x50, 0xD0, 0xF3, 0x21, 0xF2, 0xD0, 0x50, 0xA0, 0x50, 0xF1, 0x80,
+0xD0, 0xF0, 0x23, 0xF0, 0xD1, 0x70, 0x90, 0xD0, 0xF0, 0x20, 0xF2, 0xA0, 0x51, 0xF5, 0x22, 0xF4,
+0xD0, 0x50, 0xA0, 0xF0, 0x21, 0xF1, 0x25, 0xF2, 0x23, 0xF0, 0xD1, 0xA0, 0x50, 0xF0, 0xD0, 0xF0,
+0x26, 0xF1, 0xD0, 0xF2, 0x21, 0xF1, 0x50, 0xA0, 0xD0, 0xF0, 0x27, 0xF0, 0xD0, 0xA1, 0xD0, 0x50,
+0xA0, 0xD0, 0xF3, 0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x28, 0xF2, 0x23, 0xF0, 0x50, 0x21, 0xF0,
+0x20, 0xF1, 0x21, 0xD0, 0xF0, 0x20, 0xD0, 0xC0, 0x40, 0x60, 0x80, 0x90, 0xD3, 0x50, 0x80, 0x50,
+0xD1, 0x90, 0x80, 0x00, 0x60, 0x40, 0x70, 0x40, 0xB0, 0x0B, 0xE0, 0x60, 0x30, 0x41, 0x01, 0x40,
+0x80, 0x03, 0x70, 0xB0, 0x00, 0x30, 0x00, 0x80, 0x10, 0x50, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x24,
+0xF1, 0xD1, 0xF0, 0xD3, 0xF0, 0xD2, 0xA1, 0xF6, 0x22, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD1,
+0xF1, 0x25, 0xF0, 0x21, 0xF0, 0x26, 0xF2, 0x23, 0xF3, 0xD0, 0x50, 0xA0, 0x52, 0xA0, 0xF0, 0xD0,
+0xF3, 0x25, 0xF1, 0x22, 0xF0, 0xD0, 0x90, 0x09, 0x90, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x21, 0xF0, 0x20, 0xF2, 0x50, 0x40, 0x01, 0xE2, 0x60, 0x09, 0x07, 0xC0, 0x60, 0x03, 0x90, 0xB0,
+0x80, 0x01, 0xE0, 0x80, 0xD0, 0xF1, 0xD0, 0xA0, 0x90, 0x11, 0x90, 0x0F, 0x00, 0x60, 0x30, 0xD0,
+0xF2, 0x21, 0xF1, 0x21, 0xF1, 0xD0, 0xF0, 0xA1, 0x50, 0xA1, 0xF0, 0xD2, 0x50, 0xF1, 0x24, 0xF0,
+0x20, 0xF0, 0xD0, 0x80, 0x50, 0xD0, 0x50, 0xA0, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0xC0, 0x50,
+0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF0, 0x21, 0xF1, 0x23, 0xF1, 0x20, 0xF3, 0x50, 0xF0,
+0x25, 0xF2, 0x20, 0xF1, 0x22, 0xF2, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x25, 0xF2, 0x22, 0xF0, 0xD0,
+0xF0, 0x50, 0xA0, 0xF3, 0x24, 0xF2, 0xA0, 0x50, 0xD0, 0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0,
+0xD0, 0x50, 0xF2, 0x20, 0xF1, 0x2A, 0xF1, 0x22, 0xD0, 0x50, 0xF0, 0x20, 0xF2, 0x25, 0xD0, 0x80,
+0x10, 0x90, 0x00, 0x80, 0xC0, 0x80, 0xF0, 0x90, 0x10, 0xC0, 0x30, 0x70, 0x90, 0x80, 0x00, 0x40,
+0x60, 0x01, 0x90, 0x60, 0xB0, 0x60, 0x0A, 0x61, 0x70, 0xC0, 0x40, 0x00, 0x41, 0x03, 0x30, 0xE0,
+0x30, 0x40, 0x01, 0x60, 0x70, 0xD1, 0xA1, 0xF0, 0xD1, 0xF0, 0xD0, 0x20, 0xD1, 0xF0, 0x50, 0x93,
+0x80, 0xA1, 0x30, 0x90, 0xD0, 0x50, 0xF6, 0x22, 0xF7, 0xA0, 0x51, 0xA0, 0xD0, 0xF3, 0x22, 0xF3,
+0x27, 0xF0, 0x23, 0xF0, 0x22, 0xF0, 0xA1, 0xD0, 0xF2, 0xA0, 0x51, 0xA1, 0xF6, 0x21, 0xF1, 0x22,
+0xD0, 0x30, 0x60, 0x07, 0xB0, 0x90, 0xD0, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0x30, 0x60, 0x01,
+0x30, 0x00, 0x80, 0x10, 0x70, 0xC0, 0x70, 0x80, 0x60, 0x04, 0x07, 0x70, 0x03, 0x31, 0x00, 0x90,
+0xB0, 0x40, 0x90, 0x30, 0xD0, 0xF2, 0xD0, 0x50, 0xC0, 0x90, 0xC0, 0x0F, 0x00, 0x60, 0x30, 0xD0,
+0x22, 0xF3, 0xD0, 0xF1, 0xA0, 0x51, 0xA0, 0xF0, 0x20, 0xF0, 0xD0, 0xF2, 0xD0, 0xF0, 0xA0, 0xF5,
+0x24, 0xD0, 0xF0, 0xA0, 0x20, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0x20,
+0xF4, 0x21, 0xF1, 0x25, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x29, 0xF4, 0x50, 0xA0, 0xF3, 0x24,
+0xF3, 0x25, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x50, 0xD0,
+0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xD0, 0x23, 0xF4, 0x23,
+0xF5, 0x50, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x23, 0xD0, 0xA0, 0x50, 0x72, 0xC0, 0x30, 0x40, 0x71,
+0x30, 0x70, 0x10, 0x41, 0xB0, 0x02, 0x70, 0x31, 0x90, 0x80, 0x60, 0x80, 0xC0, 0x07, 0x40, 0x80,
+0xB0, 0x70, 0x01, 0x90, 0x30, 0x00, 0x40, 0x70, 0x10, 0x30, 0xE0, 0x02, 0x40, 0x10, 0x40, 0x50,
+0xA0, 0x90, 0xC0, 0x30, 0xC0, 0x10, 0x80, 0xE0, 0x91, 0xC0, 0x90, 0x02, 0xB0, 0x40, 0x30, 0x90,
+0xE1, 0x90, 0xA0, 0xD0, 0xF0, 0x25, 0xF1, 0x22, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0,
+0xF0, 0xD0, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x23, 0xF4, 0x22, 0xF2, 0x21, 0xA0, 0xF8, 0xA0, 0x51,
+0xA0, 0xF4, 0x24, 0xF0, 0xD0, 0x50, 0x80, 0x07, 0x90, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF0,
+0x21, 0xF0, 0xD0, 0x70, 0x30, 0x40, 0xB0, 0x90, 0x01, 0x90, 0xB1, 0x60, 0x80, 0x40, 0x04, 0x07,
+0x40, 0x10, 0x70, 0xC0, 0x10, 0x80, 0x01, 0x70, 0x80, 0xE0, 0x00, 0x70, 0xD0, 0xF0, 0x21, 0xF0,
+0xD1, 0x60, 0x10, 0xB0, 0x0E, 0xE0, 0x30, 0xD0, 0x20, 0xF1, 0xD1, 0xF0, 0xA0, 0x51, 0xA1, 0xF0,
+0xD1, 0xF1, 0x21, 0xF4, 0x50, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0x21, 0xF5, 0x20, 0xA0,
+0x51, 0xA0, 0xD0, 0xF2, 0x21, 0xF6, 0x24, 0xF3, 0xA0, 0x50, 0xA0, 0xF1, 0x28, 0xF1, 0xD0, 0xF0,
+0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x24, 0xF2, 0x27, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF3, 0x20, 0xF0,
+0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x22, 0xD0, 0xF0, 0x52, 0xF4, 0x23, 0xF5, 0x23, 0xF4,
+0x50, 0xD0, 0x25, 0xF0, 0x23, 0xF0, 0xD1, 0xA0, 0x11, 0x70, 0x31, 0x80, 0xD0, 0x80, 0x70, 0x80,
+0xE0, 0x05, 0xB0, 0x00, 0xE0, 0x40, 0x80, 0x60, 0x70, 0x06, 0x70, 0x80, 0x00, 0x40, 0x70, 0x02,
+0x40, 0x30, 0x10, 0x06, 0xC0, 0x11, 0x80, 0x10, 0x80, 0x40, 0xE0, 0x80, 0x90, 0x10, 0xC0, 0xE0,
+0x60, 0x0A, 0x30, 0x50, 0xA0, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF0,
+0xD1, 0xA0, 0x51, 0xA0, 0x20, 0xD0, 0xF3, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0x21, 0xF4, 0x20,
+0x50, 0xD0, 0xF0, 0x22, 0xF3, 0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0xF4, 0x20, 0xF1, 0xD0, 0x90, 0x06,
+0x40, 0x80, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x23, 0xF0, 0x90, 0x00, 0xE0, 0x30, 0x90, 0x01,
+0x60, 0xB0, 0x08, 0x09, 0xB0, 0x02, 0x40, 0x00, 0x30, 0x02, 0x30, 0xF1, 0x21, 0xF2, 0xD0, 0x90,
+0x40, 0x0E, 0x80, 0x50, 0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0xD0, 0xF3, 0x23, 0xF2, 0x21, 0xF1, 0x50,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF3, 0x22, 0xF0, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0,
+0xF1, 0x25, 0xF4, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x51, 0xA0, 0xD0, 0x50, 0xF1, 0x20, 0xF0,
+0x23, 0xF0, 0x21, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF6, 0x23, 0xF2, 0x22, 0xF1, 0xD0, 0xA0,
+0x50, 0xD0, 0xF0, 0x25, 0xF1, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0xD0, 0xA0, 0x50,
+0xA0, 0xF0, 0xD0, 0xF4, 0x21, 0xF1, 0x22, 0xF2, 0x22, 0xF2, 0x50, 0xD0, 0x25, 0xF0, 0x23, 0xF3,
+0xD1, 0x90, 0x71, 0x50, 0xD0, 0xA0, 0x80, 0x40, 0x08, 0xB0, 0x40, 0x01, 0x90, 0x03, 0x10, 0xC0,
+0x70, 0x40, 0x02, 0x30, 0xB0, 0x00, 0xB0, 0x70, 0x30, 0xB0, 0x05, 0x30, 0x10, 0xB0, 0x00, 0x90,
+0x10, 0x03, 0xB0, 0x70, 0x40, 0x0B, 0xB0, 0x80, 0x90, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x20,
+0xF2, 0x25, 0xF0, 0x21, 0xF4, 0xD0, 0xA0, 0x51, 0xA0, 0xD1, 0xF4, 0x21, 0xF3, 0x20, 0xF0, 0x24,
+0xF1, 0xA0, 0xF0, 0x23, 0xF8, 0xD0, 0xF0, 0xA0, 0x51, 0xA1, 0xD0, 0xF2, 0xD0, 0x90, 0x05, 0xC0,
+0x30, 0xD0, 0xF4, 0x24, 0xF0, 0x20, 0xF1, 0x50, 0x80, 0x01, 0x60, 0x40, 0x0C, 0x0C, 0x30, 0x42,
+0xB0, 0x00, 0xB0, 0x90, 0xA0, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0x10, 0x0E, 0x90, 0xA1, 0x51, 0xA0,
+0xF0, 0xD1, 0xF4, 0x24, 0xF2, 0x21, 0xF1, 0xA1, 0xF0, 0x22, 0xF3, 0x22, 0xF7, 0x51, 0xA0, 0xD0,
+0xF2, 0x27, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0xD0, 0xF1, 0x51, 0xA0, 0xD0, 0xF2, 0xA0, 0xF0, 0x21,
+0xF0, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x25, 0xF1,
+0xA1, 0xF1, 0x24, 0xF3, 0xD0, 0xF1, 0x50, 0xA0, 0xF0, 0x22, 0xF0, 0x23, 0xF0, 0x50, 0xD0, 0xA0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF4, 0x22, 0xF0, 0x20, 0xF1, 0x23, 0xF2, 0x50, 0xD0, 0xF0, 0x22, 0xF2,
+0x23, 0xF2, 0x22, 0xD1, 0xF0, 0xA0, 0x50, 0xA1, 0x80, 0x09, 0x60, 0xE0, 0x00, 0x30, 0xE0, 0x02,
+0x60, 0x80, 0x04, 0xE0, 0xC0, 0x40, 0x90, 0x08, 0xC0, 0x10, 0xC0, 0x30, 0x10, 0xB0, 0x04, 0xE0,
+0x60, 0x40, 0xB0, 0x09, 0xE0, 0x60, 0x90, 0xD0, 0xF0, 0xA0, 0x51, 0xF0, 0xD0, 0xF1, 0x21, 0xF1,
+0x20, 0xF1, 0x26, 0xF2, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xD0, 0xF8, 0x20, 0xF3, 0x21, 0xF0, 0xA1,
+0xF0, 0x22, 0xF3, 0x26, 0xF1, 0xD0, 0xF0, 0xA1, 0x51, 0xA0, 0xF1, 0x90, 0x03, 0x60, 0x70, 0xA0,
+0xD0, 0xF0, 0x21, 0xF2, 0x23, 0xF4, 0x50, 0x30, 0xB0, 0x00, 0x40, 0xE0, 0x0C, 0x0C, 0x30, 0x80,
+0x40, 0x60, 0x91, 0x80, 0x30, 0x80, 0xD0, 0x20, 0xF0, 0x22, 0xF1, 0x70, 0x0B, 0xB0, 0x60, 0x40,
+0x30, 0xA1, 0x20, 0xFE, 0x20, 0xF6, 0x50, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x21, 0xF2, 0xA1, 0x50,
+0xA0, 0xF0, 0x20, 0xF5, 0x22, 0xF0, 0x20, 0xF1, 0x25, 0xF2, 0xA1, 0x50, 0xF2, 0x21, 0xF0, 0xD0,
+0x50, 0x20, 0xD0, 0x23, 0xF0, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF0, 0x21, 0xF2, 0x25, 0xF0, 0x21,
+0xF2, 0x20, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF3, 0xA1, 0xF1, 0x20,
+0xF0, 0x21, 0xF0, 0x21, 0xF0, 0xA1, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF0, 0x21,
+0xF4, 0x25, 0xF1, 0x50, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0xA0,
+0x50, 0xA0, 0xF0, 0xD1, 0x70, 0xB0, 0x09, 0xE0, 0x60, 0x00, 0xC0, 0x03, 0x90, 0x70, 0x04, 0xE0,
+0x80, 0xE0, 0x07, 0x40, 0x10, 0x30, 0x11, 0x90, 0x07, 0xB0, 0xE1, 0x07, 0xB0, 0xE0, 0xB0, 0x30,
+0xD0, 0x22, 0xA0, 0x51, 0xF1, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xFD, 0xA0, 0x50, 0xA1,
+0xD1, 0xF1, 0x25, 0xF1, 0x20, 0xF1, 0x50, 0xF1, 0x20, 0xF7, 0x22, 0xF9, 0xA1, 0x81, 0x60, 0x02,
+0x70, 0xA0, 0xD0, 0xF0, 0x2B, 0xF1, 0xD0, 0x30, 0x80, 0x30, 0x91, 0xB0, 0x0C, 0x0D, 0x60, 0x01,
+0x90, 0x02, 0x90, 0xD0, 0x25, 0xD0, 0x90, 0xB0, 0x07, 0x60, 0x40, 0x80, 0xE0, 0xB0, 0x90, 0x50,
+0xD0, 0xF2, 0x24, 0xF8, 0x20, 0xF5, 0xD0, 0x50, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21,
+0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x20, 0xA0, 0xF9, 0x26, 0xF1, 0xA0, 0x50, 0xA1, 0xD0, 0xF0,
+0x21, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xD1, 0x20, 0xA0, 0x50, 0xF0, 0xD0, 0xF1,
+0x22, 0xF2, 0x24, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0x22, 0xF0,
+0x23, 0xF2, 0x20, 0xF0, 0xA0, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF1, 0x20, 0x50, 0xD0, 0xF3, 0xD0,
+0xA0, 0x51, 0xA0, 0xF0, 0x21, 0xF4, 0x25, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF3, 0x20, 0xF2, 0x20,
+0xF0, 0xD0, 0xF1, 0xA0, 0x51, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x90, 0x40, 0x0A, 0xE0, 0x40,
+0xC0, 0x03, 0x30, 0xE0, 0x06, 0xB0, 0x40, 0x06, 0x40, 0x60, 0xB0, 0x01, 0x60, 0x09, 0xB0, 0x40,
+0xB0, 0x05, 0x40, 0x00, 0x60, 0x30, 0xD0, 0x22, 0xF0, 0xD0, 0xF0, 0x51, 0xF3, 0x21, 0xF1, 0x20,
+0xF8, 0x20, 0xF3, 0xD1, 0xA1, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0xA0, 0xD0,
+0xFA, 0x20, 0xF6, 0x21, 0xF0, 0x20, 0xD1, 0xC0, 0x61, 0xE1, 0x81, 0xD2, 0xF1, 0x26, 0xF1, 0x21,
+0xF0, 0xD0, 0x90, 0x02, 0x90, 0x0D, 0x0F, 0x01, 0x30, 0x02, 0x90, 0xA0, 0xF0, 0x23, 0xF0, 0xD0,
+0x80, 0xE0, 0x03, 0xB0, 0xE0, 0x41, 0x60, 0x03, 0xC0, 0xD0, 0xF4, 0x20, 0xF1, 0x22, 0xF5, 0x25,
+0xF1, 0xD0, 0xA1, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xD1, 0xF1, 0x20,
+0xF0, 0xA0, 0x50, 0xD0, 0xF1, 0x22, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0xF1,
+0x20, 0xF0, 0x24, 0xF2, 0x50, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF2,
+0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x20,
+0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF2, 0x23, 0xD0, 0x50, 0xF2, 0x20, 0xF4,
+0xA0, 0x52, 0xA0, 0xF0, 0xD0, 0xF2, 0x25, 0xF1, 0x50, 0xF1, 0x21, 0xF3, 0xD0, 0xF0, 0xD1, 0xF0,
+0xA0, 0x52, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0xD0, 0xC0, 0x40, 0xE0, 0x0A, 0x80, 0x91, 0x01, 0x90,
+0x80, 0x09, 0x40, 0x02, 0x60, 0x0F, 0x04, 0x60, 0x40, 0x60, 0x02, 0xB0, 0xE0, 0x00, 0x90, 0x50,
+0xD0, 0x22, 0xF2, 0xD0, 0x20, 0x51, 0xA0, 0xD0, 0xF1, 0x24, 0xF2, 0x21, 0xF1, 0x21, 0xF2, 0x20,
+0xF3, 0xA0, 0x51, 0xA0, 0xF8, 0xA1, 0xD0, 0xF2, 0x21, 0xF2, 0x22, 0xF4, 0x27, 0xD0, 0x30, 0x60,
+0x01, 0xE0, 0x90, 0xA0, 0x52, 0xA0, 0xF0, 0xD0, 0xF3, 0x23, 0xF2, 0xA0, 0x30, 0x01, 0xB0, 0x80,
+0x0D, 0x0F, 0x01, 0x42, 0x80, 0xC0, 0xA0, 0xD0, 0xF4, 0xD0, 0x80, 0xE0, 0xB0, 0x60, 0x41, 0x60,
+0xB0, 0x06, 0x70, 0xD0, 0xF2, 0x29, 0xF4, 0x24, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0x20, 0xF3, 0xA0,
+0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xD1, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF2,
+0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0x21, 0xF0, 0x24, 0xF4, 0x50, 0xD0, 0xF0, 0x50, 0xA0,
+0xF4, 0x22, 0xF2, 0x21, 0xF3, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA1, 0xD0, 0xF1, 0x22, 0xF0, 0x20,
+0xF0, 0x24, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xA0, 0x50, 0xD0,
+0x21, 0xF5, 0x50, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA1, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x50, 0xF3,
+0xD1, 0xF1, 0xA1, 0x51, 0xA1, 0xF2, 0x50, 0xF0, 0x23, 0xF0, 0xD0, 0xC0, 0xB0, 0xE0, 0x08, 0x70,
+0x30, 0x80, 0xE0, 0x70, 0x30, 0xC0, 0x40, 0x0B, 0x40, 0x60, 0x00, 0x30, 0x0F, 0x06, 0xE0, 0x40,
+0xB0, 0x00, 0x40, 0x00, 0xB0, 0x70, 0xD0, 0xF1, 0x20, 0xF7, 0x51, 0xA0, 0xD0, 0xF3, 0x27, 0xF1,
+0x21, 0xF2, 0x20, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA1, 0xF0, 0xD0, 0xF2, 0xD0, 0x50, 0xF3, 0x26,
+0xF3, 0x20, 0xF2, 0x26, 0xF0, 0x50, 0x40, 0x00, 0xB0, 0x70, 0xF0, 0xD0, 0xF2, 0xA0, 0x51, 0xA1,
+0xF1, 0xD0, 0xF4, 0xD0, 0x80, 0x70, 0x80, 0x40, 0x80, 0xE0, 0x0D, 0x0F, 0x01, 0xE0, 0x90, 0xE0,
+0xB0, 0xE0, 0x80, 0xD0, 0xF1, 0xD0, 0xF1, 0xA0, 0x81, 0x60, 0xB0, 0x09, 0x60, 0x70, 0xD0, 0x20,
+0xF3, 0x28, 0xF3, 0x24, 0xF3, 0x50, 0xF0, 0xD1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0x23, 0xF0,
+0x20, 0xD0, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0xA0, 0x50, 0xA0, 0xF5, 0x20, 0xF0, 0x21,
+0xF2, 0x20, 0xF1, 0xD0, 0x52, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0x23, 0xF4, 0x21,
+0xF1, 0x50, 0xA0, 0xF2, 0x22, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0x20, 0xF0, 0x22,
+0xF1, 0x20, 0xF1, 0x20, 0xD0, 0x50, 0xF0, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF2, 0xD0, 0xF1,
+0xA0, 0x54, 0xA3, 0x50, 0xA3, 0x54, 0xF0, 0x20, 0xF0, 0xD1, 0xF1, 0xD0, 0x50, 0xF0, 0xD0, 0xF1,
+0xD0, 0xF0, 0x70, 0x80, 0x00, 0xB0, 0xE0, 0x07, 0x10, 0x80, 0x00, 0xB0, 0xE0, 0xB0, 0x0E, 0xE0,
+0x60, 0x0F, 0x08, 0xB0, 0xE0, 0x40, 0x60, 0x00, 0x80, 0x50, 0xD0, 0xF0, 0x22, 0xF3, 0x21, 0xF2,
+0xA0, 0x50, 0xA0, 0xF3, 0x26, 0xF2, 0x25, 0xF6, 0xA0, 0x50, 0xA1, 0xD1, 0xF0, 0xA0, 0xF3, 0x20,
+0xF0, 0x24, 0xF5, 0x22, 0xF2, 0x22, 0xD0, 0x80, 0xC0, 0x00, 0x90, 0xD0, 0xF0, 0x22, 0xF2, 0x20,
+0xA1, 0x51, 0xA0, 0xF0, 0xD1, 0xF1, 0xD0, 0x90, 0xB1, 0xE0, 0x70, 0xB0, 0x0D, 0x0F, 0x01, 0xB0,
+0x30, 0x01, 0xB0, 0x30, 0xD0, 0xF0, 0xA0, 0x51, 0xA2, 0x90, 0x0B, 0x40, 0x80, 0xD0, 0x2D, 0xF3,
+0x23, 0xF2, 0x20, 0xD0, 0xA2, 0x50, 0xA1, 0xD1, 0xF4, 0x23, 0xD0, 0x30, 0x20, 0xF0, 0x24, 0xF1,
+0x20, 0xF1, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF1, 0x22, 0xF9, 0xD0, 0xF0, 0xD0, 0xA0, 0x51, 0xD0,
+0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x23, 0xF4, 0x20, 0xF1, 0x50, 0xA0, 0xF2, 0x20, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x23, 0xF1,
+0xA1, 0xD0, 0xF0, 0x22, 0xF2, 0xD0, 0xA1, 0xF0, 0x20, 0xF3, 0xD0, 0xF0, 0x50, 0xD1, 0xF1, 0xA3,
+0x50, 0xA3, 0xF1, 0xD1, 0x50, 0xD0, 0xF0, 0x20, 0xF4, 0xA1, 0xF2, 0xD0, 0x90, 0x80, 0x02, 0x40,
+0xB0, 0x05, 0x60, 0x90, 0xE0, 0x01, 0x60, 0xE0, 0x0F, 0x00, 0x60, 0xE0, 0x0F, 0x09, 0x40, 0xE0,
+0x60, 0x70, 0xD0, 0xF2, 0x22, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD1, 0xF1, 0x23,
+0xF4, 0x23, 0xF9, 0xA0, 0x51, 0xA1, 0xF0, 0xD0, 0xF4, 0x24, 0xF3, 0x24, 0xF2, 0x20, 0xF1, 0xD0,
+0x30, 0x10, 0xC0, 0x30, 0xD0, 0x22, 0xF0, 0x20, 0xF3, 0xD1, 0xF0, 0xA0, 0x52, 0xA0, 0xF0, 0xD0,
+0x90, 0x02, 0x90, 0x0E, 0x0F, 0x02, 0x90, 0x01, 0xE0, 0xC0, 0xA0, 0x50, 0xA0, 0xF0, 0xD3, 0x90,
+0xB0, 0x0A, 0xE0, 0x80, 0xD0, 0x24, 0xF0, 0x2F, 0x00, 0xF0, 0xD1, 0xF0, 0xA0, 0x50, 0x80, 0xFB,
+0x21, 0xF0, 0xD0, 0x50, 0x90, 0xD0, 0xF2, 0x21, 0x51, 0xD1, 0xF0, 0x51, 0xA0, 0xD0, 0xF2, 0x24,
+0xF4, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF4, 0x22, 0xF0, 0xD0, 0x50,
+0xA0, 0xD0, 0xF3, 0x25, 0xD0, 0x50, 0xD0, 0xF1, 0x22, 0xF2, 0xD0, 0x50, 0xF8, 0xA0, 0xF2, 0xD1,
+0xF0, 0xD1, 0x50, 0xD0, 0xF1, 0x20, 0xD0, 0xF0, 0x21, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF3, 0x50,
+0xF1, 0xD0, 0x50, 0x10, 0x70, 0x40, 0x02, 0xE0, 0x05, 0xB0, 0x90, 0x03, 0x61, 0x0F, 0x00, 0xB0,
+0x40, 0x0F, 0x07, 0xE0, 0xB0, 0x00, 0x90, 0x40, 0xA0, 0xD1, 0xF0, 0x22, 0xF1, 0x21, 0xF1, 0x23,
+0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x27, 0xF4, 0x21, 0xF4,
+0x51, 0xA0, 0xF0, 0xD1, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x22, 0xF2, 0x20, 0xF1, 0x20,
+0xF0, 0xD1, 0xA0, 0xD0, 0xF0, 0x22, 0xF8, 0xD2, 0x20, 0xA0, 0x51, 0xC0, 0x60, 0x01, 0x30, 0x0E,
+0x0F, 0x02, 0x40, 0x91, 0x40, 0x80, 0x50, 0xD0, 0xF2, 0x20, 0xF1, 0xA0, 0x30, 0x0A, 0x80, 0xC0,
+0xD0, 0x26, 0xF4, 0x24, 0xF1, 0x20, 0xF2, 0xA0, 0x51, 0xA0, 0xF0, 0x50, 0xF5, 0x22, 0xF2, 0x20,
+0xF3, 0x20, 0xF0, 0x20, 0xF4, 0x20, 0xA0, 0x51, 0xF0, 0xD1, 0xF2, 0x22, 0xF0, 0x20, 0xF4, 0x21,
+0xF0, 0xA0, 0x50, 0xA0, 0xF3, 0x50, 0xF2, 0x28, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xD0, 0xA0,
+0x50, 0xF1, 0x24, 0xF2, 0x23, 0xF2, 0xA1, 0xF3, 0x23, 0xF0, 0x21, 0xF0, 0xA1, 0xF1, 0x20, 0xF2,
+0x20, 0xF1, 0x20, 0xA0, 0xF7, 0xA1, 0xD0, 0xF6, 0x50, 0xF0, 0x21, 0xF2, 0x21, 0x50, 0xF1, 0x22,
+0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0x50, 0x70, 0x01, 0x30, 0x91, 0x71, 0xE0, 0x05, 0x60,
+0x80, 0x03, 0xE0, 0x60, 0x0F, 0x00, 0xB0, 0x40, 0xB0, 0x0F, 0x04, 0xB0, 0x40, 0x01, 0x70, 0xD0,
+0x51, 0xF0, 0xD0, 0xF0, 0x23, 0xF2, 0x25, 0xF1, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF1, 0x29, 0xF4,
+0x22, 0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0xA0, 0x51, 0xA0, 0xF5, 0x26, 0xF1, 0x22, 0xF1, 0x21, 0xF0,
+0x20, 0xF0, 0x21, 0xF0, 0x22, 0xFD, 0xD0, 0x80, 0x41, 0x90, 0x70, 0x60, 0x0E, 0x0F, 0x02, 0x60,
+0x80, 0x01, 0x60, 0x30, 0xD0, 0xF2, 0x20, 0xF1, 0xD0, 0x70, 0x0A, 0x80, 0x50, 0xD0, 0x22, 0xF3,
+0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0xD0, 0xF1, 0xA0, 0x50, 0xA0, 0x20, 0xF1, 0xD0, 0xF0, 0xA0,
+0xF2, 0x26, 0xF4, 0x20, 0xF0, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0x20, 0xF1, 0x22, 0xF1, 0x23,
+0xF1, 0x20, 0xF4, 0xA1, 0xF3, 0x20, 0xF1, 0x50, 0xD1, 0xF0, 0x28, 0xF2, 0x20, 0xF1, 0xD0, 0xA0,
+0x50, 0xF2, 0x23, 0xF2, 0x24, 0xF1, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x21, 0xF1,
+0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0xA1,
+0xF0, 0x24, 0xF1, 0x50, 0xD0, 0x22, 0xD0, 0xA1, 0xF0, 0xA1, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0xA1,
+0xD0, 0x30, 0xE0, 0x04, 0x60, 0x70, 0x81, 0x04, 0xB0, 0x80, 0x04, 0x30, 0x0F, 0x02, 0x40, 0xB0,
+0x0F, 0x03, 0x40, 0x01, 0xB0, 0x90, 0xD1, 0x20, 0x50, 0xA0, 0xF1, 0x23, 0xF3, 0x24, 0xF4, 0x51,
+0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x22, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x50, 0xF4, 0xA0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF3, 0x22, 0xF4, 0x25, 0xF1, 0x20, 0xD0, 0x25, 0xF2, 0x22, 0xF4, 0x20,
+0xF0, 0xD0, 0x70, 0x02, 0x90, 0x0F, 0x00, 0x0F, 0x03, 0x30, 0x02, 0x90, 0xD0, 0xF0, 0x24, 0xD0,
+0x81, 0x09, 0x30, 0xA0, 0xD0, 0xF2, 0x21, 0xFA, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xD1, 0xF0, 0x21,
+0xF1, 0x50, 0xD0, 0xF0, 0x27, 0xF2, 0x20, 0xF6, 0xA0, 0x50, 0xA0, 0xF2, 0x23, 0xF0, 0x22, 0xF0,
+0x20, 0xD0, 0xF1, 0xD0, 0xF2, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x22, 0xF0, 0xD0, 0x50, 0xA0, 0xF2,
+0x28, 0xF0, 0x20, 0x50, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF3, 0x21, 0xF1, 0x21, 0xF0, 0x22, 0xF1,
+0xA0, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0x50, 0x20, 0xF0, 0x24, 0xF1, 0x50, 0xF0,
+0x20, 0xF0, 0xD0, 0x80, 0x30, 0x50, 0xD0, 0xA1, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0x50, 0xD0,
+0x10, 0xB0, 0x04, 0x60, 0x80, 0xB0, 0x80, 0xC0, 0x00, 0xE0, 0x91, 0x80, 0x40, 0x05, 0x40, 0x0F,
+0x02, 0x40, 0x60, 0x0F, 0x01, 0x61, 0x00, 0xB0, 0x90, 0x50, 0xD0, 0x20, 0xF0, 0xD0, 0xA0, 0x50,
+0xA0, 0xD0, 0xF0, 0x20, 0xF4, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x51, 0xA0, 0xF0,
+0xD0, 0x20, 0xF4, 0x28, 0xF3, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xA1, 0x50, 0xA0, 0xF0,
+0xD0, 0xF2, 0x21, 0xF1, 0x25, 0xF0, 0x21, 0xF1, 0x27, 0xF0, 0x23, 0xF2, 0x22, 0xF1, 0x70, 0x02,
+0x30, 0x0F, 0x00, 0x0F, 0x03, 0x90, 0xE0, 0x31, 0xC0, 0xD0, 0xF0, 0x24, 0xF0, 0xD0, 0x90, 0x60,
+0x08, 0x30, 0xF0, 0xD0, 0xF2, 0x27, 0xF1, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xD1, 0xF1, 0x22, 0xF2,
+0xA1, 0xF0, 0x23, 0xF0, 0x23, 0xF2, 0x20, 0xF0, 0xD0, 0xF1, 0xA0, 0x50, 0xA0, 0xF2, 0x20, 0xF2,
+0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x20,
+0xF1, 0x50, 0xF5, 0x26, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0x23, 0xF1, 0x24, 0xF0, 0x22, 0xF1, 0x50,
+0xF2, 0x23, 0xF3, 0x20, 0xF0, 0xA1, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0xA1, 0xF0, 0x25, 0xF0,
+0xD0, 0x50, 0xF0, 0x24, 0xF2, 0x50, 0xF1, 0x20, 0xD0, 0x70, 0x10, 0xC0, 0x80, 0x51, 0xD0, 0xF0,
+0x21, 0xF1, 0x20, 0xF1, 0xA0, 0x30, 0x40, 0x05, 0x70, 0x01, 0xE1, 0x70, 0x80, 0xB0, 0x00, 0x10,
+0x40, 0x05, 0xB0, 0x40, 0x0F, 0x02, 0xE1, 0x0E, 0xB0, 0x40, 0x01, 0x10, 0x70, 0xD0, 0xF1, 0x20,
+0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF6, 0x22, 0xF4, 0x51, 0xA0,
+0xD1, 0xF0, 0x29, 0xF1, 0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0xA0, 0x51,
+0xA0, 0xF0, 0xD1, 0xF0, 0x23, 0xF5, 0x21, 0xF0, 0x25, 0xF1, 0x25, 0xF0, 0x23, 0xD0, 0xA0, 0xC0,
+0x31, 0x40, 0x80, 0x0F, 0x00, 0x0F, 0x03, 0x40, 0x30, 0x01, 0x40, 0x80, 0xD0, 0x25, 0xF0, 0xA0,
+0x10, 0x60, 0x07, 0x80, 0x50, 0xD0, 0x21, 0xF2, 0x22, 0xF3, 0xA0, 0x51, 0xA0, 0xF1, 0xD0, 0xF4,
+0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xF0, 0x23, 0xF0, 0x24, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xD0,
+0xF2, 0x24, 0xF2, 0x21, 0xF3, 0x20, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0x20,
+0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF3, 0x24, 0xF2, 0x50, 0x30, 0xA0, 0xF1, 0x24, 0xF2,
+0x24, 0xF2, 0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xF4, 0x50, 0xF2, 0x21, 0xF5, 0x50, 0xF2,
+0x24, 0xF1, 0x50, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0x20, 0xF0, 0xD0, 0x50, 0x30, 0x80,
+0x30, 0xD0, 0x50, 0xD0, 0xF2, 0x22, 0xF2, 0x31, 0x70, 0x02, 0x40, 0x70, 0xB0, 0x02, 0x40, 0x02,
+0x80, 0xC0, 0xE0, 0x06, 0xB0, 0xE0, 0x0F, 0x02, 0xB0, 0x40, 0x0D, 0x40, 0x02, 0xC0, 0xA0, 0xD0,
+0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x51, 0xF3, 0x20, 0xF5, 0x26, 0xF0, 0xD1, 0xA0, 0x50, 0xA0,
+0xF4, 0x26, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0xF4, 0x22, 0xF1, 0xD0, 0xF0, 0xA0, 0x51,
+0xA0, 0xF2, 0x22, 0xF3, 0x23, 0xF0, 0x23, 0xF2, 0x21, 0xF3, 0x23, 0xF0, 0xD0, 0x30, 0x60, 0x01,
+0x90, 0x60, 0x0F, 0x00, 0x0F, 0x04, 0x30, 0x02, 0x70, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xD0,
+0x50, 0x70, 0x01, 0x40, 0x04, 0x40, 0x50, 0xD0, 0x23, 0xF4, 0xA1, 0x50, 0xA0, 0x20, 0xF7, 0x23,
+0xF3, 0x50, 0x20, 0xF2, 0x23, 0xF5, 0x51, 0xA0, 0xF3, 0x21, 0xF0, 0x21, 0xF0, 0x23, 0xF0, 0x23,
+0xF1, 0xA0, 0x50, 0xF0, 0xD1, 0xF4, 0x23, 0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x22, 0xF0, 0x23,
+0xD0, 0xF0, 0x50, 0xA1, 0xF1, 0x24, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF3, 0x22, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0xF0, 0x22, 0xF4, 0x20, 0x50, 0xD0, 0xF1, 0x21, 0xF3,
+0xA1, 0xD0, 0x22, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xD1, 0xF1, 0xD0, 0x50, 0xF0,
+0xD0, 0x23, 0xF1, 0x20, 0xD0, 0x50, 0x70, 0x10, 0x01, 0x90, 0x40, 0x04, 0xE0, 0xB0, 0x00, 0xE0,
+0x90, 0xC0, 0xB0, 0x07, 0x61, 0x0F, 0x02, 0xB0, 0x40, 0x0B, 0x60, 0x40, 0x02, 0x10, 0x50, 0xD0,
+0x25, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x20, 0xF2,
+0xD1, 0xA0, 0x50, 0xA0, 0xF7, 0x20, 0xF1, 0x21, 0xA1, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0x20, 0xF2,
+0xD1, 0xF0, 0xA0, 0x50, 0xA0, 0xF4, 0x24, 0xF9, 0x23, 0xF1, 0x24, 0xD0, 0x90, 0x02, 0x30, 0x0F,
+0x01, 0x0F, 0x04, 0x30, 0x00, 0xB0, 0x40, 0xC0, 0xD1, 0x20, 0xF2, 0x21, 0xF0, 0xD0, 0xA0, 0x90,
+0x00, 0x10, 0x40, 0x03, 0x40, 0x50, 0xD0, 0x21, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1,
+0xF0, 0x26, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF2, 0x22, 0xF3, 0x20, 0x51, 0xA0, 0xD0,
+0xF1, 0x22, 0xF3, 0x23, 0xF0, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF4, 0x26, 0xF0, 0xD0,
+0xA0, 0x50, 0xF0, 0x50, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0x90, 0xA0, 0xF1,
+0x22, 0xF3, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0xA1, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x20,
+0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0xA1, 0xF0, 0xD0, 0xF0, 0x22, 0xF2, 0xA1, 0xF0,
+0x22, 0xF0, 0x20, 0xF2, 0x50, 0x22, 0xF4, 0xD0, 0xA1, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0xA0, 0x90,
+0x30, 0x00, 0x81, 0x06, 0x40, 0x90, 0x40, 0x0B, 0xE0, 0xB0, 0x0F, 0x03, 0x40, 0xB0, 0x08, 0xB0,
+0x40, 0xB0, 0x40, 0xB0, 0x00, 0x80, 0x50, 0xD0, 0x25, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF2,
+0x23, 0xF0, 0x24, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF5, 0x20, 0xF0,
+0x50, 0xF1, 0x24, 0xF7, 0x20, 0xF1, 0xD1, 0xA0, 0x51, 0xA0, 0xF2, 0x21, 0xF1, 0x20, 0xF8, 0x23,
+0xF1, 0x22, 0xF0, 0xD0, 0xA0, 0xC0, 0x40, 0x00, 0xB0, 0x30, 0x0F, 0x01, 0x0F, 0x04, 0x80, 0x90,
+0x30, 0x60, 0x80, 0x50, 0xD0, 0x20, 0xF1, 0x24, 0xD0, 0x90, 0x30, 0xC1, 0x03, 0xB0, 0x90, 0xD0,
+0xF0, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xD0, 0xF3, 0x23, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0xD0, 0x50,
+0xF1, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x23, 0xF3, 0x20, 0xF0, 0x22, 0xF2,
+0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x51, 0xD1,
+0xF0, 0x50, 0xD0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD1, 0xF0, 0xA0, 0x50, 0xF2, 0x23,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0x21, 0xF2, 0x23, 0xF2, 0x50, 0xF5, 0x23,
+0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x24, 0xF2, 0x50, 0xF0,
+0x21, 0xF5, 0xA1, 0xF0, 0x23, 0xF2, 0xD0, 0x30, 0x70, 0xC0, 0xE0, 0xC0, 0x07, 0x90, 0x60, 0x0D,
+0x40, 0xB0, 0x0F, 0x03, 0x40, 0x60, 0x07, 0x40, 0x02, 0xE2, 0x80, 0xD0, 0x22, 0xF3, 0x21, 0xF3,
+0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x22, 0xF3, 0x21, 0xF0, 0x25, 0xF2, 0xA0, 0x51, 0xF0, 0xD1, 0xF4,
+0x20, 0x50, 0xD0, 0xF1, 0x23, 0xF3, 0x26, 0xF2, 0xD1, 0xA0, 0x51, 0xA0, 0xD1, 0xF3, 0x22, 0xF5,
+0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x80, 0xE0, 0x60, 0x30, 0x70, 0xE0, 0x0F, 0x01, 0x0F,
+0x04, 0xB0, 0x80, 0x01, 0xB0, 0x30, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xC0,
+0x50, 0x10, 0x40, 0x00, 0x40, 0x90, 0x60, 0x70, 0xD0, 0x20, 0xA0, 0x51, 0xA0, 0xD1, 0xF3, 0x25,
+0xF1, 0x21, 0xF1, 0x25, 0xF0, 0xD0, 0xA1, 0xF4, 0xA0, 0x50, 0xA0, 0xF2, 0x22, 0xF1, 0x23, 0xF0,
+0x21, 0xF0, 0x20, 0xF3, 0xD0, 0xF0, 0x51, 0xD1, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x20,
+0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0xD0, 0xA0, 0x50, 0xF2, 0x20, 0xF1, 0x50, 0xA0, 0xF8, 0x25, 0xF0,
+0x20, 0xF2, 0x50, 0xF2, 0x22, 0xF1, 0x22, 0xF3, 0x50, 0xF5, 0x23, 0xF1, 0xA0, 0xF0, 0x20, 0xF0,
+0x23, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF3,
+0xA1, 0xD0, 0xF1, 0x21, 0xF2, 0xD0, 0x70, 0x40, 0xB0, 0x30, 0x40, 0x07, 0x90, 0xE0, 0x0E, 0x40,
+0x0F, 0x04, 0x60, 0xE0, 0x05, 0x40, 0xB0, 0x03, 0xB0, 0x40, 0x80, 0xD0, 0xF1, 0x20, 0xD0, 0xF0,
+0x23, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x51, 0xF3, 0x23, 0xF0, 0x21, 0xF1, 0x24, 0xF2, 0xD0, 0xF0,
+0x51, 0xA0, 0xF0, 0xD0, 0xF0, 0xD1, 0xA0, 0xF4, 0x21, 0xF2, 0x2A, 0xF2, 0xD1, 0xF0, 0xA0, 0x50,
+0xA1, 0xF0, 0xD0, 0xF3, 0x25, 0xF3, 0x23, 0xF0, 0xD0, 0x90, 0x02, 0x30, 0xB0, 0x80, 0x40, 0x0E,
+0x0F, 0x05, 0x90, 0x01, 0xB0, 0x70, 0xF1, 0xD0, 0x23, 0xF1, 0x20, 0xF0, 0xD1, 0xA0, 0x90, 0x00,
+0x90, 0xE0, 0x90, 0x30, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0xD1, 0x20, 0xF2, 0x2A, 0xF3, 0x22,
+0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0xA0, 0x50, 0xA0, 0x20, 0xF3, 0x22, 0xF5, 0x25, 0xF0, 0xD0, 0xF0,
+0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x20, 0xF4, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x51, 0xD0, 0xF2,
+0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0xF2, 0x50, 0xA0, 0xD1, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF1,
+0x21, 0xF0, 0x20, 0xF2, 0x50, 0xF5, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF6, 0x23,
+0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x20, 0x50, 0xD0, 0xF1, 0x21, 0xF1, 0x20, 0xD0, 0x31, 0x09,
+0x80, 0x40, 0xB0, 0xE0, 0x0D, 0xB0, 0x40, 0x0F, 0x04, 0x60, 0xE0, 0x03, 0x61, 0x05, 0xE0, 0x30,
+0xA0, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0x22, 0xF1, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF5, 0x21, 0xF1,
+0x24, 0xF5, 0x51, 0xA0, 0xD0, 0xF1, 0x50, 0xF0, 0x28, 0xF4, 0x25, 0xF0, 0x21, 0xF3, 0xD0, 0xF0,
+0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x27, 0xF0, 0x22, 0xF0, 0xD0, 0xF0, 0x70, 0x02, 0x30, 0x60,
+0x40, 0x80, 0xB0, 0x0D, 0x0F, 0x05, 0x40, 0x30, 0x90, 0x80, 0x30, 0x50, 0xD0, 0x20, 0xF0, 0x20,
+0xF0, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x90, 0xC0, 0x30, 0xA0, 0x50, 0xA1, 0xD0, 0xFA, 0x2A, 0xF3,
+0x20, 0xF2, 0xD0, 0xA2, 0x50, 0xA0, 0xF1, 0xD0, 0xF0, 0x26, 0xF2, 0x25, 0xF2, 0xA0, 0x50, 0xA0,
+0xD0, 0xF0, 0x21, 0xF5, 0x24, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0x50,
+0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0x26, 0xF3, 0x21, 0xF2, 0x50, 0xF6, 0x25, 0xF0, 0xD0,
+0xA1, 0x21, 0xF4, 0x23, 0xD0, 0x50, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0,
+0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0x50, 0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x50,
+0xC0, 0x40, 0x08, 0xC0, 0x01, 0x40, 0x0E, 0xB0, 0x40, 0x0F, 0x04, 0xB0, 0x40, 0x01, 0xB0, 0xE0,
+0x06, 0x40, 0x50, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x23, 0xF2, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xF0,
+0xD0, 0xF0, 0x20, 0xF3, 0x20, 0xF1, 0x26, 0xF0, 0x21, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA2, 0xD0,
+0x22, 0xF2, 0x22, 0xF6, 0x22, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0x51, 0xA0,
+0x20, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0x81, 0x30, 0x90, 0x30, 0xE0, 0x00, 0x90,
+0x80, 0x0E, 0x0F, 0x03, 0xB0, 0x00, 0x60, 0x30, 0x01, 0x60, 0x30, 0xD0, 0xF0, 0x24, 0xF2, 0xD0,
+0xF1, 0xA0, 0x70, 0x50, 0xA0, 0xD1, 0xF0, 0x20, 0xF3, 0x22, 0xF2, 0x22, 0xF1, 0x22, 0xF1, 0x21,
+0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x80, 0xA0, 0xF2, 0x20, 0xF0, 0x24, 0xF1, 0x21,
+0xF4, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x22, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xF0,
+0xD0, 0x51, 0xF0, 0xD0, 0xF0, 0x20, 0x30, 0xA0, 0xF1, 0x20, 0xD0, 0x50, 0x30, 0x80, 0xA0, 0x50,
+0xF2, 0x20, 0xF1, 0x25, 0xF3, 0x22, 0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF3, 0x26, 0xF1, 0x50,
+0xD0, 0x22, 0xF4, 0x21, 0xF1, 0xA0, 0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x20, 0xA0, 0xD0, 0xF0,
+0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xD0, 0x50, 0xF1, 0x20, 0xF2, 0x22, 0xD1,
+0x81, 0x07, 0x10, 0x02, 0x40, 0x06, 0x40, 0x30, 0x05, 0x60, 0xE0, 0x0F, 0x05, 0x40, 0xB0, 0x40,
+0x07, 0x81, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF2, 0x21, 0xF2, 0xD1, 0x51, 0xF0, 0xD0,
+0xF0, 0x22, 0xF0, 0x21, 0xF3, 0x25, 0xF1, 0xD2, 0xA0, 0x80, 0xA0, 0xF0, 0xD0, 0xF0, 0x25, 0xF6,
+0x24, 0xF4, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0,
+0x24, 0xF0, 0x20, 0xD0, 0x90, 0xB0, 0x01, 0x70, 0x0F, 0x03, 0x0F, 0x02, 0xB0, 0xC0, 0x70, 0x00,
+0x90, 0x02, 0x90, 0xD0, 0xF8, 0xA0, 0x50, 0x30, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x22, 0xF3, 0x26,
+0xF3, 0x21, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0x50, 0xF0, 0xD0, 0x21,
+0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x22, 0xF1, 0x20, 0xF2, 0x20, 0x51, 0xF0, 0xD0, 0x20, 0xF2, 0x24,
+0xF3, 0xD1, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x90, 0x21, 0xF1, 0xA0, 0x80,
+0x51, 0xD1, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xF3, 0x21, 0xF1, 0xA1, 0xF1, 0x21, 0xF1, 0x26,
+0xF1, 0xA1, 0xD0, 0xF0, 0x22, 0xF3, 0x21, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF1,
+0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xA1, 0xF0, 0x26, 0xF0,
+0xD0, 0xE0, 0x70, 0xE0, 0x06, 0xB0, 0x70, 0x01, 0x60, 0xE0, 0x03, 0xB0, 0x70, 0xE0, 0x90, 0xB0,
+0x05, 0xE0, 0x60, 0x0F, 0x05, 0x80, 0x60, 0x07, 0x90, 0xD0, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF2,
+0x23, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x21, 0xF4, 0x21,
+0xF0, 0x22, 0xF2, 0xD0, 0xA2, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x23, 0xF5, 0x24, 0xF0, 0x25, 0xF0,
+0x25, 0xF0, 0xD0, 0xF0, 0xA0, 0x51, 0xA0, 0xF2, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0x90, 0x02, 0x90,
+0x00, 0x40, 0x30, 0x40, 0xB0, 0x0D, 0x0D, 0x40, 0x90, 0x60, 0x02, 0x80, 0x40, 0x80, 0x60, 0xE0,
+0x30, 0x70, 0x50, 0xD0, 0x20, 0xF1, 0xD0, 0xF0, 0xA1, 0x50, 0xA1, 0x10, 0xD1, 0xF8, 0x28, 0xF8,
+0x22, 0xF0, 0xD0, 0xF0, 0x51, 0xF3, 0x50, 0xF1, 0x21, 0xF0, 0x24, 0xF1, 0x21, 0xF3, 0xD0, 0xF0,
+0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF0, 0x27, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF2, 0x20, 0xF2,
+0x21, 0xF2, 0xD0, 0xF0, 0xA1, 0x30, 0x50, 0x80, 0x50, 0xF0, 0x20, 0xF0, 0x25, 0xF4, 0x21, 0xD0,
+0xA1, 0xF1, 0x22, 0xF1, 0x24, 0xF3, 0x50, 0xD0, 0x20, 0xF0, 0x23, 0xF2, 0x20, 0xF1, 0x50, 0xD0,
+0xF2, 0x20, 0xF5, 0x50, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0,
+0xA1, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0xD0, 0x50, 0x70, 0xB0, 0x06, 0x30, 0x70, 0x80, 0x31, 0x02,
+0x40, 0x70, 0xB0, 0x00, 0x80, 0x60, 0x06, 0x40, 0xB0, 0x0F, 0x03, 0xE0, 0x00, 0xE1, 0x05, 0x60,
+0x30, 0xD0, 0xF1, 0x20, 0xF1, 0x50, 0xF4, 0x22, 0xF0, 0x23, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0xF0, 0x20, 0xF7, 0x24, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF4, 0x25,
+0xF3, 0x20, 0xF0, 0x22, 0xF1, 0x25, 0xF8, 0xA0, 0x50, 0xA0, 0xF4, 0x20, 0xD0, 0x50, 0x70, 0x80,
+0xE1, 0x40, 0x80, 0x30, 0xE0, 0x30, 0xC0, 0x30, 0x0C, 0x0D, 0xE0, 0xC0, 0x70, 0x90, 0xB0, 0x00,
+0x40, 0x80, 0xB0, 0xC0, 0x40, 0x00, 0xB0, 0x90, 0xD0, 0xF2, 0xA0, 0x50, 0xA1, 0xD2, 0x30, 0xD0,
+0xF0, 0x20, 0xF0, 0xD0, 0xF1, 0x2D, 0xFB, 0x51, 0xF0, 0xD0, 0xF0, 0x21, 0xD0, 0x50, 0x20, 0xF1,
+0x20, 0xF1, 0x22, 0xF3, 0x20, 0xF3, 0xA0, 0x50, 0xA0, 0xD1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x21, 0xF0, 0x20, 0xF2, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xF2, 0xD0, 0xF0, 0x50, 0xA0,
+0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x25, 0xF7, 0x50, 0xF1, 0x24, 0xF0, 0x24, 0xF1,
+0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x23, 0xF3, 0xA1, 0xF2, 0x21, 0xF5, 0x50, 0xF0, 0x22, 0xF0, 0x22,
+0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21,
+0xF1, 0x51, 0x30, 0x08, 0x40, 0xB0, 0x90, 0x80, 0x91, 0x30, 0x02, 0xE0, 0x70, 0xB1, 0x05, 0x40,
+0x0F, 0x02, 0xE0, 0x60, 0x01, 0x60, 0xE0, 0x04, 0xB0, 0x90, 0xD0, 0xF0, 0x22, 0xF1, 0x50, 0xA0,
+0xF0, 0xD0, 0xF1, 0x21, 0xF1, 0x27, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0xF4, 0x22, 0xF0, 0x24, 0xF1,
+0xA1, 0xD0, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0xD0, 0xF1, 0x23, 0xF2, 0x27, 0xF2, 0x23, 0xF0,
+0x20, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0xA1, 0x50, 0xA0, 0xF1, 0xD1, 0x70, 0x00, 0xB0, 0x40, 0x10,
+0x00, 0x90, 0xB0, 0x02, 0x80, 0x90, 0x0B, 0x0E, 0xC0, 0x00, 0xE0, 0xC0, 0x10, 0xC0, 0x01, 0x90,
+0x02, 0x90, 0xD0, 0xA0, 0x51, 0xA0, 0xF2, 0xD0, 0xF1, 0xD2, 0x20, 0xD0, 0x50, 0xD0, 0xF0, 0x25,
+0xF0, 0x20, 0xF1, 0x27, 0xF2, 0xD1, 0xA0, 0x51, 0xF0, 0xD0, 0xF2, 0x20, 0xF1, 0x20, 0x50, 0xD0,
+0xF1, 0x20, 0xF0, 0x24, 0xF3, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF2, 0x25, 0xF0, 0x20, 0xF4, 0xD0,
+0xA0, 0x50, 0xF0, 0xD0, 0xF3, 0x20, 0xF1, 0x21, 0xF3, 0x50, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA1,
+0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0x20, 0xF2, 0x50, 0xF1, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0xF0,
+0xD0, 0xF0, 0x50, 0xD0, 0x21, 0xF1, 0x24, 0xF1, 0xD0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF4,
+0x50, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF1, 0x50, 0xF0, 0x25, 0xF2,
+0xD0, 0xA1, 0x90, 0x60, 0x09, 0x60, 0x40, 0x30, 0xE0, 0x04, 0xB0, 0x31, 0x90, 0x70, 0x31, 0x80,
+0x01, 0x40, 0x0F, 0x00, 0xE0, 0x60, 0x01, 0x30, 0x00, 0xB0, 0x40, 0x03, 0x80, 0x50, 0xF0, 0x22,
+0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF1, 0x28, 0xF2, 0xA0, 0x50, 0xF0,
+0xD0, 0xF4, 0x25, 0xF1, 0xD0, 0x50, 0xF0, 0xD0, 0xF4, 0x21, 0x51, 0xA0, 0xD1, 0xF4, 0x27, 0xF7,
+0x25, 0xF7, 0xA0, 0x51, 0xA0, 0xE0, 0x30, 0x02, 0x90, 0x00, 0x40, 0xC0, 0x60, 0x02, 0xC0, 0x0B,
+0x0E, 0x30, 0x40, 0x05, 0x80, 0xE0, 0x40, 0xC0, 0x10, 0x30, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x21,
+0xD0, 0x30, 0x70, 0xD0, 0xF0, 0x70, 0x30, 0xD0, 0x25, 0xF5, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0xF0,
+0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0x20, 0xF5, 0x20, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x23,
+0xF2, 0x51, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x25, 0xF2, 0xD1, 0xF0, 0x51, 0xF2, 0x21, 0xF0, 0x21,
+0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF3, 0x50, 0xA0, 0x50, 0xD0, 0x20, 0xF2, 0x20,
+0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF1, 0x21, 0xF0, 0xD0,
+0x50, 0xF2, 0x20, 0xF1, 0x24, 0xF2, 0xA0, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0xF1, 0x50, 0xF0,
+0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0x50, 0xF0, 0x24, 0xF4, 0xD0,
+0x50, 0xD0, 0x70, 0x0B, 0x60, 0x70, 0x09, 0xB0, 0x00, 0x30, 0x60, 0x00, 0xB0, 0x40, 0x0D, 0xE0,
+0x60, 0x02, 0x10, 0x40, 0x01, 0x40, 0xB0, 0x01, 0xC0, 0xD0, 0x23, 0xF3, 0xD1, 0x50, 0xA0, 0xF2,
+0x22, 0xF0, 0x27, 0xF3, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xA1, 0xF0,
+0xD0, 0xF3, 0x21, 0xF2, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x26, 0xF0, 0x20, 0xF2, 0x20, 0xF3, 0x26,
+0xF0, 0x23, 0xF2, 0xD0, 0xF1, 0x90, 0x10, 0x70, 0xE0, 0x41, 0x01, 0x60, 0xC1, 0x30, 0x70, 0x80,
+0x0B, 0x0E, 0xB0, 0x60, 0x01, 0xE0, 0x80, 0x90, 0x80, 0x00, 0x11, 0xC0, 0x80, 0x90, 0xD1, 0xF3,
+0x23, 0xF1, 0x10, 0xA0, 0xD0, 0xA0, 0xC0, 0xF0, 0x23, 0xF0, 0x21, 0xF6, 0x22, 0xD0, 0xF0, 0xA0,
+0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF0,
+0x21, 0xF4, 0xA0, 0x50, 0xA0, 0xD0, 0xF5, 0x21, 0xF0, 0x22, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xF0,
+0xD0, 0x26, 0xF0, 0x20, 0xF2, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0x90,
+0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xF0, 0x24, 0xF1, 0x20,
+0xF0, 0xA1, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0xD0, 0xA1, 0xF0, 0x24, 0xF2, 0x20, 0xF1,
+0xA0, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0x50, 0xF0, 0x24,
+0xF4, 0xD0, 0xA0, 0xF0, 0x50, 0x90, 0x0A, 0xE0, 0x30, 0x0B, 0x90, 0x60, 0x01, 0x60, 0xE0, 0x0B,
+0x60, 0xE0, 0x03, 0x40, 0x03, 0xE0, 0xB0, 0x81, 0xD0, 0x24, 0xF0, 0x22, 0xF0, 0xD0, 0xA0, 0x50,
+0xF6, 0x24, 0xF0, 0x20, 0xF4, 0xA0, 0x50, 0xA0, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x50, 0x20,
+0xFB, 0x20, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x25, 0xF2, 0x24, 0xF0, 0x20, 0xF4, 0x26, 0xF3,
+0xD1, 0x70, 0x80, 0x12, 0x00, 0x40, 0xB0, 0x01, 0xB0, 0xE0, 0x60, 0x0C, 0x0F, 0x01, 0x90, 0xB0,
+0x91, 0x60, 0x70, 0x00, 0x70, 0xE0, 0x01, 0x30, 0xA0, 0xF4, 0x23, 0xF0, 0xD0, 0xC0, 0x70, 0xD1,
+0x10, 0x50, 0xF1, 0x22, 0xFB, 0x51, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x90,
+0xF0, 0xD0, 0xF1, 0x20, 0xD0, 0xA1, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xF0,
+0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x21, 0xF2, 0xA0, 0x50, 0xF0, 0xD0,
+0xF0, 0x21, 0xF0, 0x23, 0xF0, 0xA0, 0x20, 0xF1, 0x50, 0xA0, 0xD0, 0x21, 0xF4, 0x20, 0xF0, 0xD0,
+0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF4, 0x24, 0xF0,
+0xD0, 0xF0, 0x20, 0x50, 0xD0, 0x22, 0xF0, 0x21, 0xF1, 0x23, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x21,
+0xF2, 0x20, 0xF0, 0xA1, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20,
+0xF0, 0xD0, 0xA1, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0x50, 0xD0, 0x90, 0x40, 0x0A, 0x30, 0x0B, 0x40,
+0x80, 0x00, 0x40, 0x62, 0x09, 0x60, 0xE0, 0x0A, 0x60, 0x30, 0xD1, 0x23, 0xF1, 0x24, 0xD0, 0xF0,
+0x50, 0xA0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF4, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF6, 0xA1, 0xF1, 0x20, 0xF1, 0x20, 0xF5, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0,
+0xD0, 0xF0, 0x22, 0xF0, 0x2A, 0xF5, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x80, 0x01, 0x40, 0x30,
+0x00, 0x11, 0x90, 0xE0, 0x0F, 0x00, 0x0F, 0x00, 0x81, 0x01, 0x70, 0x00, 0x30, 0x41, 0x60, 0x01,
+0x81, 0xD0, 0xF8, 0xD0, 0x30, 0x80, 0x90, 0xB0, 0x30, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1,
+0x20, 0xF2, 0xD0, 0xF0, 0x51, 0xA0, 0xF0, 0xD0, 0xF7, 0xD0, 0x91, 0xD0, 0xF4, 0x50, 0xD0, 0xF0,
+0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF4, 0x22, 0xF0, 0x20, 0xF4, 0x21, 0xF2, 0x50, 0xA0, 0xF6,
+0x23, 0xF0, 0x50, 0xF1, 0x50, 0xA0, 0xF3, 0x22, 0xF4, 0x51, 0xA0, 0x21, 0xF0, 0x20, 0xF1, 0x21,
+0xA1, 0xD0, 0xF3, 0x20, 0xF1, 0x24, 0xF2, 0xD0, 0xA1, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x22, 0xF1,
+0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0x50, 0xF1, 0x22, 0xF0, 0x22, 0xF2, 0x50,
+0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0xA0, 0xD0, 0xF0, 0x22, 0xF3, 0x20, 0xF0, 0xD0, 0xA0,
+0xF0, 0xD0, 0x70, 0x60, 0x09, 0x70, 0xB0, 0x0B, 0x90, 0x80, 0x30, 0x80, 0x00, 0x40, 0xB0, 0x07,
+0x60, 0x41, 0x01, 0xB0, 0x80, 0x41, 0x05, 0x70, 0x50, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF2,
+0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF6, 0x22, 0xF0, 0xD0, 0x20, 0x51, 0xF0,
+0xD0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x23, 0xF3, 0x22, 0xF1, 0xD0,
+0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xF0, 0x2B, 0xF6, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0x90, 0x40, 0x01,
+0x40, 0xE0, 0x00, 0x80, 0xE1, 0x90, 0x10, 0x30, 0x0D, 0x0F, 0x00, 0x40, 0x80, 0x01, 0xC0, 0x00,
+0xB0, 0x60, 0x00, 0x90, 0x80, 0x90, 0x40, 0x70, 0xD0, 0xF4, 0x21, 0xF1, 0xD0, 0xA0, 0x80, 0xE0,
+0x10, 0xC0, 0x90, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF5, 0x51, 0xF0, 0xD0, 0xF0, 0x20, 0xF9, 0xD0,
+0x10, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF3, 0x51, 0xF0, 0xD0, 0x22, 0xF0, 0x23, 0xF5,
+0x21, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x50,
+0xA0, 0xD0, 0x26, 0xF3, 0x50, 0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0xA0, 0x80, 0xD1, 0xA0, 0x50,
+0xD0, 0xF2, 0x22, 0xF1, 0x24, 0xF3, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0xD0,
+0x50, 0xA0, 0xF0, 0x20, 0xF2, 0x20, 0xF2, 0x21, 0xF0, 0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0x23, 0xD0, 0xA1, 0xD0, 0x90,
+0x40, 0x08, 0x30, 0x40, 0xE0, 0x0E, 0x70, 0x80, 0x00, 0x40, 0x06, 0xE1, 0x01, 0x40, 0x00, 0xB0,
+0x70, 0x11, 0x41, 0x01, 0xB0, 0x70, 0xA1, 0x50, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF7, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0,
+0xF1, 0xD0, 0xA1, 0xF0, 0x27, 0xF5, 0x23, 0xF0, 0xD0, 0xA0, 0x51, 0xA0, 0xD0, 0xF0, 0x23, 0xF1,
+0x25, 0xF9, 0x22, 0xF0, 0xD0, 0x70, 0x80, 0x90, 0x40, 0x90, 0x01, 0xB0, 0xE0, 0x02, 0xE0, 0x0D,
+0x0F, 0x01, 0x90, 0x70, 0xC0, 0x80, 0x00, 0x61, 0x00, 0x30, 0xE0, 0x01, 0x80, 0x50, 0x22, 0xF1,
+0x21, 0xF2, 0xD0, 0x90, 0xB1, 0x00, 0x30, 0xA0, 0xF0, 0x21, 0xF0, 0x20, 0xF4, 0x51, 0xF0, 0xD0,
+0xF3, 0x24, 0xF0, 0x22, 0xF0, 0xD0, 0x70, 0x10, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xD0,
+0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x23, 0xF2, 0xD0, 0xF0, 0xA1, 0xF2,
+0x21, 0xF0, 0x22, 0xF5, 0xA0, 0x50, 0xF0, 0xD0, 0xF1, 0x21, 0xF6, 0x50, 0xA0, 0xD1, 0xF0, 0xA1,
+0xD3, 0xA0, 0x50, 0xF3, 0x22, 0xF2, 0x21, 0xF1, 0x22, 0xD0, 0x50, 0xA0, 0xF1, 0x23, 0xF0, 0x24,
+0xF0, 0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0x50, 0xD0,
+0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x25, 0xF0, 0xD0, 0x50, 0xF1, 0x26, 0xF1,
+0x20, 0xF0, 0x50, 0xD0, 0xF0, 0x70, 0xE0, 0x06, 0xE0, 0x10, 0x70, 0x60, 0xE0, 0x0E, 0x90, 0x01,
+0x40, 0x04, 0xE1, 0x02, 0xB0, 0x40, 0x01, 0x70, 0x40, 0x02, 0x40, 0x90, 0x50, 0xD1, 0xF0, 0x50,
+0xF0, 0xD0, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD1, 0x51, 0xF3, 0x25, 0xF4, 0x20, 0xF1,
+0x20, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x27, 0xF1, 0x25, 0xF3, 0xD0, 0xA0,
+0x50, 0xA1, 0xD1, 0xF0, 0x22, 0xF3, 0x29, 0xF0, 0x23, 0xD0, 0x80, 0x40, 0x01, 0x81, 0x0F, 0x06,
+0x0F, 0x02, 0xB0, 0xE0, 0x90, 0xC0, 0x90, 0x70, 0x40, 0xE0, 0x40, 0x01, 0x60, 0x30, 0xD0, 0x22,
+0xF0, 0x21, 0xF2, 0xD0, 0x50, 0x30, 0x01, 0x40, 0x30, 0xD0, 0x21, 0xF1, 0xD0, 0xF1, 0x50, 0xA0,
+0xF0, 0xD0, 0xF4, 0x2A, 0xD0, 0xA0, 0x90, 0x70, 0xD0, 0xF2, 0xD0, 0xA0, 0x51, 0xA0, 0xD0, 0xF0,
+0xD0, 0xF0, 0x24, 0xF0, 0x21, 0xF1, 0x23, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF1,
+0x22, 0xF4, 0xD0, 0xA0, 0x50, 0xD1, 0xF1, 0x22, 0xF4, 0x20, 0x50, 0xF0, 0xD0, 0x20, 0xF1, 0xD0,
+0xA1, 0xD0, 0xF1, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x21, 0xF3, 0x50, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0,
+0x20, 0xF1, 0xA0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x26, 0xD0,
+0x50, 0xF1, 0x26, 0xF1, 0x20, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0x91, 0x60, 0x05, 0x40, 0x10, 0x60,
+0xE0, 0x0D, 0xB0, 0x30, 0x01, 0xB0, 0x40, 0x02, 0xE0, 0x60, 0x04, 0xB0, 0x40, 0x03, 0x30, 0x10,
+0x70, 0x50, 0xD0, 0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x25, 0xF4, 0x21, 0xF3, 0xA0, 0x51, 0xA0, 0xF4,
+0x20, 0xF1, 0x25, 0xF1, 0x20, 0xF0, 0x23, 0xF2, 0xD0, 0xA1, 0x50, 0xA0, 0xD1, 0xF6, 0x2C, 0xF0,
+0xD0, 0x70, 0xB0, 0x01, 0x80, 0x60, 0x70, 0x80, 0xB0, 0x0F, 0x03, 0x0F, 0x02, 0xE0, 0x10, 0x60,
+0x02, 0x70, 0x00, 0x90, 0x00, 0x80, 0x30, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF3, 0xD0, 0x70,
+0x01, 0xB0, 0x90, 0xD0, 0x20, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0xF5, 0x26, 0xF2, 0x23, 0xF0, 0xD0,
+0x90, 0x10, 0xA0, 0xD0, 0xF2, 0x51, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x25, 0xF2, 0x22, 0xD0, 0xF0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF4, 0x25, 0xF2, 0x51, 0xD0, 0xF1, 0x23, 0xF0, 0x20, 0xF3, 0x50, 0xF2,
+0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0x24, 0xF3, 0x22,
+0xF0, 0xD0, 0x50, 0xD0, 0xF3, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x20, 0xF0, 0x21, 0xF1, 0x24,
+0xF1, 0xA1, 0xF2, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x50,
+0xF1, 0x23, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xA1, 0xD2, 0xF0, 0x30, 0x91, 0x40, 0x02, 0x80, 0xE0,
+0x01, 0xE0, 0x09, 0x40, 0x31, 0x90, 0xE0, 0x02, 0x60, 0xE0, 0x00, 0x40, 0xB0, 0x05, 0xB1, 0x40,
+0x01, 0xC0, 0x70, 0xA0, 0xD1, 0xF0, 0x21, 0xF0, 0xD1, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF5, 0x22, 0xF2, 0xD0,
+0xF0, 0x51, 0xD0, 0xF8, 0x2F, 0x00, 0xF2, 0xA0, 0x50, 0xA0, 0xD1, 0x21, 0xF4, 0x20, 0xF0, 0x22,
+0xF0, 0x23, 0xF2, 0xC0, 0x90, 0x40, 0x00, 0x90, 0x00, 0x80, 0x90, 0xC1, 0x40, 0x0F, 0x01, 0x0F,
+0x02, 0x90, 0xB0, 0x02, 0x40, 0x90, 0x00, 0x40, 0x70, 0xB0, 0x00, 0xE0, 0x30, 0xD0, 0x21, 0xF1,
+0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0x70, 0x01, 0x90, 0xD1, 0xF0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1,
+0x2A, 0xF3, 0x23, 0xD1, 0xA0, 0x10, 0x70, 0x50, 0xD0, 0xA0, 0x50, 0xF0, 0xA0, 0x50, 0xD0, 0xF0,
+0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF0, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xF0,
+0x21, 0xF0, 0x22, 0xF2, 0x50, 0xA0, 0xD0, 0xF1, 0x26, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x22, 0xF1,
+0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0xA1,
+0xD0, 0xF2, 0x25, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0x22, 0xF1, 0x24, 0xF0, 0xD0, 0xA1, 0xF1, 0x22,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0xA1, 0xF0, 0x22, 0xF1, 0x20,
+0xF2, 0x21, 0xF0, 0x50, 0xD0, 0xF2, 0xD2, 0x80, 0x10, 0x60, 0x00, 0xC0, 0x80, 0x01, 0x90, 0xB0,
+0x06, 0x80, 0x90, 0x40, 0x01, 0xC0, 0x40, 0x03, 0xE0, 0x80, 0x06, 0x40, 0x30, 0x01, 0xE0, 0xC0,
+0x50, 0xD1, 0xF2, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xF2, 0x23, 0xF0, 0x22, 0xF0, 0x21, 0xD1, 0xA0,
+0x50, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0xA0,
+0x50, 0xA0, 0xF4, 0x20, 0xF0, 0x27, 0xF2, 0x26, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF4, 0x21, 0xF0,
+0x25, 0xF0, 0x20, 0xF1, 0xD0, 0x90, 0xB0, 0x00, 0xE0, 0x10, 0xE0, 0x00, 0x60, 0x80, 0x00, 0xB0,
+0x80, 0x10, 0xB0, 0x0E, 0x0F, 0x02, 0x80, 0x30, 0x60, 0x80, 0xC0, 0x90, 0x02, 0x30, 0x02, 0x90,
+0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0xD0, 0x10, 0x01, 0x70, 0x30, 0xA0, 0x50, 0xA0, 0xD0, 0xF0,
+0x20, 0xF0, 0x23, 0xF1, 0x23, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0x90, 0x10, 0x70,
+0xA1, 0xF0, 0x20, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x21, 0xF1,
+0xD0, 0xA1, 0x20, 0xF3, 0x20, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0x50, 0xF3, 0x21, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x51, 0xF2, 0x20, 0xF2, 0x27, 0xF0,
+0xD0, 0xF0, 0x50, 0xD0, 0xF3, 0x27, 0xF1, 0xA1, 0xF0, 0x22, 0xF1, 0x24, 0xF0, 0xD0, 0x50, 0xF2,
+0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x23, 0xF0, 0xA1, 0xD0, 0x22, 0xF1,
+0x25, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0xD2, 0x30, 0xC0, 0xE0, 0x90, 0x01, 0x70, 0x40,
+0x05, 0x80, 0x40, 0x03, 0x40, 0x80, 0x02, 0xB0, 0xE1, 0xB0, 0x04, 0x90, 0x10, 0x01, 0x80, 0x90,
+0x80, 0xF4, 0x20, 0xF2, 0x20, 0xF3, 0x50, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0x20, 0xF2,
+0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x23, 0xF3, 0x21, 0xF0, 0xA1, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF0, 0x27, 0xF0, 0x20, 0xF4, 0x26, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF2,
+0x24, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x30, 0x02, 0x90, 0x02, 0xB0, 0x0F, 0x04, 0x0F, 0x03, 0x80,
+0x90, 0x80, 0x60, 0x00, 0x80, 0x30, 0xE0, 0x30, 0x01, 0x40, 0xC0, 0x50, 0xD0, 0xF0, 0x23, 0xF3,
+0xD0, 0x30, 0x60, 0x00, 0x81, 0xF1, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0x20, 0xF4, 0x24, 0xF5,
+0xD0, 0x90, 0xC0, 0x30, 0xD0, 0xF3, 0x50, 0xD0, 0x22, 0xF2, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xF0,
+0x50, 0xA0, 0xD1, 0x25, 0xF0, 0x21, 0xF1, 0x20, 0xF2, 0x50, 0xF3, 0x24, 0xF0, 0x21, 0xD0, 0xF0,
+0x50, 0xF3, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0x20,
+0xF2, 0x27, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF3, 0x26, 0xF1, 0xD0, 0x50, 0xF1, 0x29, 0xF0, 0xD0,
+0x50, 0xF2, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1,
+0x50, 0xD0, 0xF0, 0x22, 0xF0, 0x25, 0xF0, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD1,
+0x70, 0x00, 0x40, 0x30, 0x01, 0xE0, 0x60, 0x03, 0xB0, 0x90, 0x04, 0x41, 0x00, 0x80, 0x40, 0xE0,
+0x01, 0x40, 0xB0, 0x03, 0x61, 0x00, 0x40, 0x30, 0xD0, 0xF0, 0x50, 0xD1, 0xF3, 0x21, 0xF0, 0x20,
+0xF1, 0xD0, 0xF0, 0x50, 0x20, 0xF0, 0x23, 0xF0, 0x23, 0xF5, 0xA0, 0x50, 0xF1, 0xD0, 0x25, 0xF5,
+0x50, 0xD0, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0x26, 0xFC, 0x21, 0xF5, 0xA0, 0x50, 0xA0,
+0xF1, 0x24, 0xF0, 0x21, 0xF0, 0x21, 0xD0, 0x80, 0xC0, 0xE0, 0x00, 0x60, 0x80, 0x0F, 0x08, 0x0F,
+0x08, 0x30, 0xB0, 0x80, 0x00, 0xC0, 0x30, 0xE0, 0x00, 0x70, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF0,
+0xD1, 0xE0, 0x30, 0x60, 0x40, 0xC0, 0xD1, 0xF2, 0x21, 0xF4, 0x22, 0xF2, 0x22, 0xF1, 0x21, 0xF1,
+0xD0, 0xF0, 0x50, 0xA0, 0x90, 0x10, 0xC0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0x21, 0xF0,
+0xD0, 0xF1, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xF5, 0x25, 0xF3, 0xD0, 0xA0, 0x50, 0xF3, 0x26, 0xF0,
+0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0x50, 0xF2, 0xD0, 0x51, 0xD0, 0xF1,
+0x22, 0xF0, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0x20, 0xF3, 0x26, 0xF2, 0x50, 0xD0, 0xF0, 0x25,
+0xF1, 0x21, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF2, 0x24, 0xF0, 0xD0, 0x50, 0xF1, 0x20,
+0xF0, 0x23, 0xD0, 0x30, 0xB0, 0x60, 0x30, 0x02, 0x40, 0x03, 0xB0, 0x80, 0x04, 0xE0, 0x90, 0x32,
+0x03, 0x40, 0x05, 0x90, 0x70, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF5, 0x22, 0xF1, 0xD0, 0xF0,
+0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x27, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0x26, 0xF0,
+0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF1,
+0x2A, 0xF3, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0xD1, 0xA0, 0x51, 0xF0, 0xD0, 0xF2, 0x20, 0xF1,
+0x21, 0xF1, 0x70, 0x00, 0x40, 0x30, 0xC0, 0x0F, 0x09, 0x0F, 0x08, 0x60, 0x30, 0xB0, 0x00, 0x90,
+0x02, 0x30, 0xA0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xA0, 0x51, 0x80, 0x40, 0x80, 0x10,
+0xD0, 0xF2, 0x21, 0xF5, 0x22, 0xF2, 0x23, 0xF3, 0xD0, 0xA0, 0x50, 0xF0, 0xD1, 0x30, 0x40, 0x80,
+0xD0, 0xF2, 0xD0, 0x50, 0xFA, 0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xF2, 0x25, 0xF0, 0x20, 0xF1, 0xA1,
+0xD1, 0xF0, 0x20, 0xF0, 0x26, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x21, 0xF3, 0x22, 0xF0, 0x50, 0xF1,
+0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0xD0, 0xF0, 0x21, 0xF4, 0xD0, 0x50, 0xF0, 0x21, 0xF3, 0x23,
+0xF1, 0x21, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0x21, 0xF1, 0xA0, 0xF0, 0x20, 0xF2, 0x20,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0x20, 0xF0, 0x21,
+0xF2, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF1, 0x24, 0xD0, 0x30, 0xB1, 0x70, 0x03, 0x60, 0x00,
+0xB0, 0x40, 0x90, 0x60, 0x06, 0xE0, 0x00, 0x80, 0x41, 0x02, 0x40, 0x03, 0x30, 0xC0, 0xD0, 0xF1,
+0x20, 0xD0, 0xF0, 0x50, 0xF1, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0,
+0xF1, 0x25, 0xF2, 0x23, 0xD1, 0x51, 0xD0, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0xA0, 0x50, 0xF2, 0x21,
+0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD1, 0xF3, 0x27, 0xF2, 0xD0, 0xF0, 0x20, 0xF0, 0x23,
+0xF2, 0xD1, 0xA1, 0x50, 0xF0, 0xD1, 0x23, 0xF0, 0xD0, 0x50, 0x40, 0x01, 0xB0, 0x80, 0x0F, 0x09,
+0x0F, 0x0C, 0x41, 0x00, 0xB0, 0x31, 0xD0, 0x21, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0x20, 0xD1,
+0xC1, 0x10, 0x80, 0xD0, 0xF0, 0x24, 0xF2, 0x25, 0xF2, 0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0xF0, 0xD1, 0xC0, 0x70, 0xC0, 0xA1, 0xF0, 0xD0, 0xF1, 0x50, 0xF1, 0x20, 0xF3, 0xD0, 0xA0, 0x50,
+0xF1, 0x21, 0xF1, 0x20, 0xF2, 0x22, 0xF1, 0x20, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x26,
+0xD0, 0xA0, 0x50, 0xF3, 0x20, 0xF6, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x50, 0xA0, 0xF1, 0x22,
+0xF3, 0xA1, 0xF0, 0x21, 0xF3, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF2, 0x23, 0xF2,
+0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0,
+0x20, 0xF0, 0x20, 0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xA0, 0xD0,
+0xF1, 0x22, 0xF0, 0xD0, 0x30, 0xE0, 0x00, 0x80, 0x60, 0x00, 0x80, 0x30, 0x80, 0x30, 0x90, 0xE0,
+0x80, 0x30, 0x04, 0x60, 0xE0, 0x01, 0x60, 0x80, 0x70, 0x02, 0xB0, 0xE0, 0x02, 0x10, 0xD0, 0xF1,
+0x22, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF1, 0x25, 0xF2, 0xA1, 0xF1, 0x22, 0xF1, 0x22, 0xF0, 0x22,
+0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xD1, 0xF2, 0x22, 0x50, 0xF0, 0xD1, 0x21, 0xF0, 0x22, 0xF3, 0xA0,
+0x50, 0xA0, 0xF3, 0x29, 0xF0, 0x20, 0xF2, 0x22, 0xF4, 0x20, 0xF2, 0x51, 0xA0, 0xD0, 0xF3, 0xD0,
+0x70, 0x80, 0x01, 0x80, 0x60, 0x0F, 0x09, 0x0F, 0x0D, 0x90, 0x80, 0x30, 0x60, 0x90, 0xF0, 0xD1,
+0xF0, 0xA0, 0x50, 0xA0, 0xF1, 0x21, 0xD0, 0xA0, 0xC0, 0x10, 0xA0, 0xD0, 0x2A, 0xF0, 0x22, 0xF3,
+0x20, 0xF1, 0x50, 0xA0, 0xF4, 0xD0, 0x90, 0x40, 0xB0, 0x90, 0x71, 0xF2, 0xA1, 0xF1, 0x20, 0xF2,
+0xA0, 0x50, 0xF1, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xD0, 0x20, 0x50, 0xA0, 0xD0, 0xF0,
+0x21, 0xF0, 0x26, 0xF1, 0x50, 0xF1, 0x24, 0xF3, 0xD0, 0xA1, 0xF1, 0x23, 0xF3, 0x50, 0xA0, 0xF0,
+0xD0, 0x20, 0xF3, 0xD0, 0x50, 0xF0, 0x22, 0xF3, 0x23, 0xF1, 0x20, 0xF0, 0xA0, 0x50, 0xF0, 0x21,
+0xF2, 0x22, 0xF2, 0x20, 0xF0, 0xA0, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20,
+0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xA1, 0xF1, 0x20, 0xF1, 0x21, 0xF3, 0x21, 0xD0, 0x50,
+0xF3, 0x20, 0xF0, 0x20, 0xD0, 0x30, 0x60, 0x00, 0x60, 0x80, 0xE0, 0x30, 0xB1, 0x90, 0x40, 0x01,
+0xE0, 0x70, 0x40, 0x60, 0xB0, 0xE0, 0x40, 0x04, 0x90, 0x03, 0x61, 0x01, 0x10, 0xD1, 0x22, 0xF0,
+0x20, 0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0x21, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0x20,
+0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x24, 0xF2, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0xA1, 0xF2, 0x27,
+0xF1, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x2A, 0xF0, 0x20, 0xF3, 0x21, 0xF1, 0x24, 0xF0, 0xD0, 0xF0,
+0xA0, 0x50, 0xA0, 0xF0, 0xD1, 0xA0, 0x30, 0xE0, 0x90, 0x80, 0x90, 0x0F, 0x0A, 0x0F, 0x0D, 0x80,
+0x40, 0x01, 0xE0, 0x80, 0xD0, 0x51, 0xA0, 0xF4, 0x20, 0xF1, 0xD0, 0x50, 0xD0, 0xF0, 0x24, 0xF0,
+0x25, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0x20, 0xD0, 0x80, 0x90, 0x00,
+0x80, 0x01, 0x80, 0xA0, 0xD0, 0x20, 0xF0, 0x50, 0xF4, 0x50, 0xA0, 0xF0, 0x28, 0xF2, 0x20, 0xF1,
+0xD0, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x25, 0xF1, 0xD0, 0xF0, 0x50, 0xF1, 0x24, 0xF4, 0xA1, 0xD0,
+0xF1, 0x21, 0xF0, 0x22, 0xD0, 0x50, 0xF1, 0x50, 0xA0, 0xD0, 0xA0, 0x21, 0xF0, 0xA1, 0xF0, 0x22,
+0xF0, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0xA0, 0xF1, 0x21, 0xF2, 0x22, 0xF2, 0x20, 0xF0, 0x50,
+0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x21, 0xF2, 0xA0,
+0xD0, 0x22, 0xF0, 0x20, 0xF4, 0x21, 0xF0, 0xA1, 0xD0, 0xF3, 0x20, 0xD0, 0x90, 0x02, 0x90, 0x10,
+0x02, 0x60, 0xB0, 0x03, 0x40, 0x92, 0x30, 0xE0, 0x02, 0x60, 0xC0, 0x30, 0x03, 0xE0, 0xB0, 0x00,
+0xC0, 0xD0, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1,
+0xD1, 0xA0, 0x50, 0x20, 0xF0, 0x21, 0xF3, 0x20, 0xF2, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xF1, 0x21,
+0x51, 0xD0, 0xF0, 0x23, 0xF1, 0x21, 0xF5, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x20, 0xF1,
+0x28, 0xF3, 0x21, 0xF0, 0x23, 0xF4, 0xA0, 0x50, 0xA0, 0xD0, 0x90, 0x60, 0x01, 0x30, 0x40, 0x0F,
+0x0A, 0x0F, 0x0D, 0xB0, 0x30, 0x01, 0xB0, 0xC0, 0x50, 0xA0, 0xD0, 0xF5, 0x20, 0xF2, 0xD1, 0xF0,
+0x22, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0xF0, 0xD1, 0xF2,
+0x21, 0xD0, 0x50, 0x30, 0x00, 0x40, 0x01, 0x30, 0x50, 0xD0, 0xF2, 0x50, 0xD0, 0xF0, 0xA0, 0x50,
+0xF1, 0x23, 0xF1, 0x23, 0xF0, 0x21, 0xD0, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x26,
+0xF2, 0x50, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0x20, 0xF2, 0x21, 0xF0, 0x20,
+0xF0, 0xA1, 0xD2, 0x52, 0xF1, 0x20, 0x50, 0xF0, 0x22, 0xF3, 0x23, 0xF3, 0xD0, 0x50, 0xF0, 0x22,
+0xF2, 0x22, 0xF2, 0x20, 0xD0, 0x50, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20,
+0xF1, 0x23, 0xF0, 0x21, 0xF2, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF4, 0x21, 0xF0, 0x20, 0x50,
+0xD0, 0xF1, 0x20, 0xF1, 0x50, 0x70, 0x03, 0x90, 0x03, 0x40, 0x02, 0xB0, 0xE0, 0xB0, 0x01, 0x60,
+0x90, 0xB0, 0x01, 0xE0, 0x40, 0x30, 0x04, 0x40, 0xB0, 0x10, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF3, 0x50, 0xF3, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20,
+0xF3, 0x20, 0xF1, 0x21, 0xF3, 0xD0, 0xF0, 0x50, 0xA0, 0xF1, 0x50, 0xD1, 0x24, 0xF0, 0x20, 0xF5,
+0x22, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x2A, 0xF1, 0x27, 0xF1, 0x20, 0xF1, 0xD0, 0xA0,
+0x50, 0xC0, 0x02, 0x90, 0x0F, 0x0B, 0x0F, 0x0E, 0x80, 0xE0, 0x80, 0x30, 0x40, 0x30, 0xD0, 0xF1,
+0x20, 0xF1, 0x21, 0xF4, 0x23, 0xF4, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0,
+0x25, 0xF1, 0xD0, 0x80, 0x30, 0x01, 0x80, 0x10, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xA1, 0x50, 0xA0,
+0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0x20, 0xF2, 0xA1, 0xF0, 0x25, 0xF0, 0x22, 0xF0, 0x20,
+0xF1, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x20, 0xD0, 0xF0, 0x50, 0xD0, 0xF2, 0x20, 0xF1, 0x22,
+0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0x50, 0xA0, 0xF0, 0x21, 0xF1,
+0x21, 0xF0, 0x24, 0xF3, 0xA0, 0xD0, 0x22, 0xF2, 0x22, 0xF4, 0x50, 0xD0, 0x22, 0xF1, 0x20, 0xF0,
+0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF0, 0x20,
+0xF2, 0x24, 0xF0, 0x50, 0xF3, 0x21, 0x50, 0x30, 0x01, 0xE0, 0x90, 0x60, 0x03, 0x61, 0x00, 0xE0,
+0x40, 0x03, 0x30, 0x60, 0xE0, 0x00, 0x60, 0x90, 0x40, 0x30, 0x05, 0x80, 0x30, 0xD0, 0x22, 0xF2,
+0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF2, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0,
+0xF0, 0x21, 0xF4, 0x22, 0xF5, 0xA0, 0x51, 0xA0, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF3, 0x27, 0xF1,
+0xA0, 0x50, 0xA0, 0xD0, 0xF3, 0x2F, 0x03, 0xF1, 0xD0, 0x21, 0xF0, 0xD0, 0x90, 0xE0, 0x30, 0x80,
+0x41, 0x0F, 0x0B, 0x0F, 0x0E, 0xB0, 0xC0, 0x60, 0x01, 0x90, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF2,
+0x22, 0xF0, 0x21, 0xF4, 0x24, 0xF2, 0x51, 0xF0, 0xD0, 0xF0, 0x25, 0xF1, 0xA0, 0xC0, 0x60, 0x80,
+0x30, 0x00, 0x90, 0x30, 0xA0, 0xD0, 0xF1, 0xD0, 0xA0, 0x80, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xD0, 0x50, 0xA0, 0xD0, 0x25, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0x50, 0xF0, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x50, 0xF1, 0x23, 0xF2, 0x21,
+0x50, 0xF1, 0x21, 0xF2, 0xD0, 0xA0, 0x51, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF1,
+0xD0, 0x50, 0xF0, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0xD0, 0xF0, 0xA0, 0xF0, 0x21, 0xF1,
+0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0x50,
+0xF1, 0x20, 0xF0, 0x23, 0xF1, 0x23, 0xF0, 0xA0, 0x50, 0xF1, 0x22, 0x50, 0x40, 0x01, 0xC0, 0x06,
+0x41, 0xB0, 0x03, 0xB0, 0x70, 0x00, 0x60, 0x30, 0x90, 0x31, 0x05, 0x60, 0x90, 0x50, 0xD0, 0xF0,
+0x24, 0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xD0, 0xF2, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xA1,
+0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x23, 0xF3, 0x20, 0xD0, 0xA0, 0x50, 0xA0, 0xD1, 0xF1, 0x22, 0xF3,
+0x27, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0x2F, 0x02, 0xF1, 0x21, 0xF2, 0x90, 0x01,
+0x60, 0x10, 0x0F, 0x0C, 0x0F, 0x0F, 0x30, 0x02, 0x40, 0x80, 0xD0, 0xF1, 0x23, 0xF2, 0x20, 0xF1,
+0x21, 0xF0, 0x25, 0xF1, 0xD2, 0x51, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0x30, 0xC0,
+0x40, 0xB0, 0x70, 0xB0, 0x40, 0x50, 0x21, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0x50, 0xD0, 0x21, 0xF1,
+0xD0, 0xF1, 0x25, 0xF1, 0xD0, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0x50, 0xF0, 0xD0, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF3, 0x22, 0xF1, 0x20, 0xD0,
+0xA1, 0xF0, 0x23, 0xF2, 0xD0, 0x52, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x22, 0xF1, 0xD0,
+0x50, 0xD0, 0x22, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0xD0, 0xA0, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0x22,
+0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xA1, 0xF0, 0x20, 0xF0, 0x23,
+0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x50, 0x30, 0x00, 0xB0, 0x30, 0x04, 0xB0,
+0x40, 0xE1, 0x04, 0x80, 0x32, 0x40, 0x30, 0x40, 0x06, 0x70, 0xD0, 0xF0, 0x50, 0xF2, 0x23, 0xF0,
+0x20, 0xF0, 0xD1, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0xD0, 0xA0, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xD0, 0xA0, 0x50, 0xD1,
+0x21, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0x20, 0xF4, 0xD0, 0xF0, 0x50, 0xA0, 0xF0, 0xD0, 0xF3, 0x28,
+0xF2, 0x22, 0xF1, 0x22, 0xD0, 0x30, 0x60, 0x01, 0x60, 0x80, 0x0F, 0x0C, 0x0F, 0x10, 0x30, 0xB0,
+0x31, 0x70, 0xD1, 0x24, 0xF2, 0x23, 0xF1, 0x23, 0xF2, 0xD0, 0xF0, 0xA0, 0x50, 0xF3, 0x21, 0xF2,
+0x23, 0xF0, 0xD0, 0x50, 0x40, 0x11, 0x30, 0xB0, 0x80, 0x50, 0x21, 0xA0, 0x50, 0xF0, 0xD1, 0xA0,
+0x50, 0xD0, 0x20, 0xF3, 0x23, 0xF2, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x24, 0xF1, 0x20,
+0xD0, 0xF0, 0x50, 0xD0, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xA0, 0xF3, 0x24, 0xD0,
+0xA1, 0xD0, 0x22, 0xF0, 0x20, 0xF2, 0xA1, 0xD1, 0x51, 0xF4, 0x21, 0xF0, 0x22, 0xF1, 0xA1, 0xF0,
+0x20, 0xF0, 0x21, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x25, 0xF0, 0x21, 0xF0, 0xA0, 0x50, 0xF0, 0x20, 0xF0,
+0x23, 0xF0, 0x22, 0xF2, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x30, 0x60, 0x01, 0x90, 0x02,
+0xB0, 0x40, 0xE0, 0x01, 0xE0, 0xB0, 0x07, 0x90, 0x40, 0x06, 0x80, 0x50, 0xD1, 0xA1, 0xF1, 0x24,
+0xD0, 0xF2, 0xD0, 0xF0, 0x50, 0xF5, 0x22, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0x50, 0x20, 0xF1, 0x22,
+0xF1, 0x23, 0xF1, 0xD0, 0x50, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0xF1, 0x22, 0xF0, 0x28, 0xF7, 0xD0,
+0xA0, 0x50, 0xA0, 0xF6, 0x25, 0xF2, 0x23, 0xF0, 0x21, 0xF0, 0xA0, 0x70, 0x30, 0x80, 0x00, 0x90,
+0x0F, 0x0D, 0x0F, 0x10, 0x90, 0x30, 0xB0, 0x00, 0x40, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x25, 0xF2,
+0x21, 0xF0, 0x20, 0xF1, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0xF7, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0xD0, 0x70, 0x60, 0x00, 0x90, 0x10, 0x40, 0x30, 0xA0, 0xD0, 0xA0, 0x50, 0xF4, 0xA1, 0xD0, 0xF0,
+0x20, 0xF0, 0x25, 0xF0, 0xD0, 0xA0, 0x50, 0xF4, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xF2,
+0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF2, 0x23, 0xF0, 0x50,
+0xF2, 0x24, 0xF0, 0xD0, 0x50, 0xD0, 0x20, 0xD0, 0xF1, 0x50, 0xA0, 0xF3, 0x20, 0xF0, 0x23, 0xF0,
+0x50, 0xF3, 0x21, 0xF2, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x23, 0xF2,
+0xD0, 0xF0, 0xA0, 0xD0, 0xF1, 0xD0, 0x90, 0x60, 0x00, 0x60, 0x70, 0x00, 0xB0, 0xE1, 0x04, 0x40,
+0x06, 0x80, 0x40, 0x00, 0x40, 0x03, 0x90, 0x10, 0x70, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0,
+0xF0, 0x27, 0xF2, 0x50, 0xF4, 0x24, 0xF2, 0x20, 0xF1, 0x50, 0xA0, 0xF0, 0x20, 0xF0, 0x21, 0xF1,
+0x23, 0xF0, 0xA1, 0xD0, 0xF2, 0x51, 0xA0, 0xF1, 0x20, 0xF0, 0x24, 0xF3, 0x20, 0xF1, 0x20, 0xF0,
+0x22, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xF0, 0xD0, 0xF5, 0x23, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0xD0,
+0x30, 0xE0, 0x00, 0x60, 0x70, 0x80, 0x0F, 0x0D, 0x0F, 0x10, 0x60, 0x80, 0x02, 0x70, 0xD0, 0xF0,
+0x29, 0xF3, 0x20, 0xF1, 0xD0, 0xF0, 0xA1, 0xF0, 0xD0, 0xF0, 0x24, 0xF5, 0x20, 0xF1, 0xD0, 0x30,
+0x80, 0x01, 0xC0, 0x70, 0x90, 0xA0, 0x50, 0xA0, 0xF6, 0x50, 0xF1, 0x26, 0xF1, 0xA1, 0xF0, 0xD0,
+0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0x20,
+0xF1, 0xA0, 0x50, 0xD0, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0x50, 0xF0, 0xD0, 0xF2, 0x21, 0xF2, 0xA1,
+0xF1, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xA0, 0xF4, 0x22, 0xF0, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0x22,
+0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x25, 0xF2, 0x50, 0xF0, 0x25, 0xF2, 0x22,
+0xF1, 0x50, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0xD0, 0x50, 0xF2, 0xD0, 0x70,
+0x01, 0x70, 0x60, 0xE1, 0xB0, 0x05, 0x60, 0xB0, 0x04, 0x40, 0x30, 0x01, 0x60, 0xE0, 0x02, 0x70,
+0x10, 0xA0, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xF1, 0x27, 0xF0, 0xD0, 0xA0, 0x50, 0xF2, 0x28,
+0xF3, 0xA1, 0xD0, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x50, 0xD0, 0xA0,
+0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF5, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF5, 0xA0, 0x50, 0xF5, 0x23,
+0xF1, 0x23, 0xF1, 0x20, 0xF1, 0x70, 0x02, 0x30, 0xB0, 0x0F, 0x0D, 0x0F, 0x11, 0x90, 0x01, 0x90,
+0x70, 0x50, 0xD0, 0x22, 0xF3, 0x22, 0xF0, 0x20, 0xF2, 0xD1, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x26,
+0xF5, 0x21, 0xF0, 0xD0, 0x90, 0x80, 0x01, 0x70, 0x60, 0x51, 0xF1, 0x22, 0xF4, 0x50, 0xF0, 0x22,
+0xF0, 0x21, 0xF1, 0x50, 0xA0, 0xD0, 0xF2, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50,
+0xF2, 0x22, 0xF3, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF0,
+0xA1, 0xD0, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0xD1, 0x52, 0xF0, 0xD1,
+0x21, 0xF0, 0xA1, 0xD0, 0xF0, 0x24, 0xF1, 0x50, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xF3, 0x27, 0xF2,
+0x50, 0xD0, 0xF0, 0x23, 0xF2, 0x23, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x20, 0xF2, 0x22, 0xF2,
+0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0x50, 0x80, 0x00, 0x40, 0x80, 0xE0, 0x40, 0x08, 0x40, 0x03, 0xE0,
+0x10, 0x90, 0xE0, 0x01, 0xE0, 0xB0, 0x00, 0x30, 0x10, 0x80, 0xD0, 0xF0, 0x21, 0xF2, 0x50, 0xF1,
+0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x26, 0xF2,
+0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x50, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xD0, 0xF0,
+0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0xF3, 0x23, 0xF2, 0x20, 0xF3, 0x50, 0xA0,
+0xF0, 0xD0, 0xF1, 0x2A, 0xF1, 0xD0, 0x30, 0x70, 0x30, 0x00, 0x60, 0x80, 0x0F, 0x0E, 0x0F, 0x11,
+0x60, 0x70, 0x30, 0x01, 0x70, 0xD0, 0x23, 0xF1, 0x20, 0xF1, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xA0,
+0xD1, 0xF0, 0x23, 0xF1, 0x22, 0xF3, 0x22, 0xD0, 0xA0, 0x10, 0x30, 0x01, 0x90, 0x50, 0xA0, 0xD0,
+0xF0, 0x23, 0xF4, 0xA0, 0x50, 0xF4, 0xD0, 0x20, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0x26, 0xF2,
+0x50, 0xD0, 0xF2, 0x24, 0xF4, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xA0, 0x50,
+0xD0, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xA1, 0xF1, 0x51,
+0xA0, 0xF1, 0xD0, 0x50, 0xF3, 0x21, 0xF1, 0x20, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF1, 0xA1, 0xF0,
+0x21, 0xF0, 0x27, 0xF2, 0x50, 0xD0, 0xF0, 0x24, 0xF1, 0x23, 0xF0, 0xD0, 0x50, 0xF1, 0x22, 0xF3,
+0x22, 0xF4, 0x50, 0xD1, 0x90, 0xE0, 0x40, 0x80, 0x01, 0xE0, 0xB0, 0x07, 0xB0, 0xE0, 0x02, 0x70,
+0x01, 0x90, 0x70, 0x30, 0xB0, 0xE0, 0x40, 0x10, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0x50,
+0xF1, 0x23, 0xF1, 0x21, 0xF3, 0x50, 0xF3, 0x20, 0xF0, 0x25, 0xF3, 0xA0, 0x50, 0xF0, 0xD0, 0x20,
+0xF1, 0x20, 0xF0, 0x50, 0xF3, 0x25, 0xD1, 0xA0, 0x50, 0xF3, 0x22, 0xF6, 0x22, 0xF2, 0x21, 0xF2,
+0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x90,
+0x00, 0xB0, 0x90, 0x70, 0x0F, 0x0F, 0x0F, 0x12, 0x30, 0x02, 0xE0, 0x30, 0xD0, 0x21, 0xF0, 0x21,
+0xF1, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF2, 0x22,
+0xF1, 0x70, 0x30, 0x71, 0x81, 0xD0, 0xF3, 0x23, 0xF3, 0xD0, 0xA1, 0xF0, 0x20, 0xF1, 0xA0, 0x50,
+0x20, 0xF1, 0x20, 0xF2, 0x21, 0xF0, 0x24, 0xF1, 0x50, 0x21, 0xF4, 0x22, 0xF0, 0x20, 0xD0, 0xF0,
+0x50, 0xF1, 0x20, 0xF0, 0x23, 0xF2, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xD0, 0x21, 0xF0, 0x21, 0xF0,
+0xA1, 0xF1, 0x24, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0x20, 0xF1, 0xA0, 0x50, 0xA1, 0x50, 0xD0, 0xF1,
+0x21, 0xF3, 0x20, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF0, 0x27, 0xF3, 0x50, 0xD0,
+0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0xA1, 0xF0, 0x23, 0xF1, 0x25, 0xF1, 0xD0, 0x50, 0xA1,
+0x30, 0x00, 0x80, 0x60, 0x01, 0xB0, 0x40, 0x04, 0x40, 0xC0, 0x01, 0x40, 0x02, 0x90, 0x03, 0x60,
+0x90, 0x80, 0x70, 0x50, 0xD1, 0x22, 0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF1,
+0x21, 0xF2, 0x50, 0xF0, 0x20, 0xF4, 0x22, 0xF5, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0xD0, 0xA1, 0xF4,
+0x23, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xF3, 0x20, 0xF0, 0x2E, 0xF2, 0xD1, 0xA0, 0x50,
+0xF0, 0xD0, 0x21, 0xF2, 0x21, 0xF0, 0x22, 0xD0, 0x90, 0xB0, 0x01, 0x60, 0x80, 0x00, 0x60, 0x0F,
+0x0D, 0x0F, 0x12, 0x60, 0x30, 0x00, 0xB0, 0x30, 0xC0, 0xD0, 0xF0, 0x25, 0xF0, 0x20, 0xF1, 0x51,
+0xF6, 0x20, 0xF2, 0x26, 0xF0, 0x21, 0xF0, 0xD0, 0x70, 0x40, 0x90, 0x10, 0x80, 0xC0, 0x90, 0xD1,
+0xF3, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF1, 0x21, 0xF0,
+0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF4, 0x23, 0xF0, 0xD0, 0x50, 0xF2, 0x26,
+0xF0, 0xD0, 0xA1, 0xD0, 0x20, 0xF3, 0x22, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0,
+0xA1, 0xF0, 0x22, 0xF0, 0xD1, 0xF0, 0x51, 0xA0, 0xF2, 0x21, 0xF0, 0xD0, 0xF3, 0x22, 0xF0, 0x50,
+0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x26, 0xF1, 0x50, 0xD0, 0xF0, 0x2B, 0xF1, 0x50, 0xF0, 0x22, 0xF1,
+0x24, 0xF3, 0xA0, 0x51, 0xD0, 0x70, 0x00, 0x90, 0xE0, 0x02, 0xE0, 0x04, 0x60, 0xE0, 0x01, 0xB0,
+0xE0, 0x00, 0x80, 0xE0, 0x00, 0x60, 0x10, 0xB0, 0x00, 0xE0, 0x10, 0x70, 0xF0, 0xD0, 0x23, 0xF3,
+0x20, 0xD0, 0xA1, 0xD0, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x50, 0xD0, 0xF0, 0x20,
+0xF0, 0x24, 0xF0, 0x21, 0xF2, 0xD0, 0x20, 0x50, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF1, 0x20,
+0xF0, 0x22, 0xF1, 0x20, 0xF3, 0xA1, 0xD0, 0xF0, 0x21, 0xF0, 0x2F, 0x00, 0xF3, 0xD0, 0xF0, 0x50,
+0xA0, 0xD1, 0xF4, 0x22, 0xF0, 0xD0, 0xC0, 0x80, 0xB0, 0x00, 0x90, 0xB0, 0x81, 0x60, 0x0F, 0x0C,
+0x0F, 0x13, 0x32, 0xB0, 0x60, 0x30, 0xD0, 0xF1, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xF4, 0x2F,
+0x01, 0xF0, 0xD0, 0x10, 0xE0, 0x40, 0x70, 0x30, 0x11, 0x30, 0xD0, 0xF9, 0x20, 0xF1, 0xD0, 0x50,
+0xD0, 0xA0, 0x50, 0xF1, 0x27, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF0, 0xD0, 0x21, 0xF4, 0x23,
+0xF0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x25, 0xD0, 0xF0, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0x21,
+0xF0, 0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xF5, 0x20, 0xF0, 0xD0, 0x50,
+0xF0, 0xA1, 0x51, 0x20, 0xF0, 0xD1, 0xF3, 0x21, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0x26, 0xF1, 0x50, 0xF0, 0x2A, 0xF1, 0x20, 0xF0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xD1,
+0xF0, 0x52, 0xF1, 0xA0, 0x81, 0xB0, 0x30, 0x03, 0xB0, 0xE0, 0x08, 0xE0, 0x00, 0x30, 0xB0, 0x40,
+0x10, 0x40, 0x01, 0x90, 0x10, 0xF0, 0x50, 0xF1, 0x22, 0xF5, 0xD0, 0xA1, 0xD0, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x24, 0xF2, 0x20, 0xF1, 0x50,
+0xA0, 0xF0, 0x50, 0xD0, 0xF0, 0x22, 0xF4, 0x22, 0xF4, 0xA0, 0x50, 0xF0, 0xD1, 0xF0, 0x26, 0xF2,
+0x26, 0xF3, 0xD1, 0xF0, 0x50, 0xA0, 0xD1, 0xF0, 0x23, 0xF0, 0xD0, 0x70, 0xB1, 0x91, 0x80, 0xB0,
+0x30, 0x41, 0x0F, 0x0C, 0x0F, 0x14, 0x90, 0x02, 0x90, 0xF1, 0x21, 0xF1, 0xD0, 0xA0, 0x50, 0xA0,
+0xD0, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0x29, 0xF0, 0xD1, 0x10, 0x70, 0x40, 0xE0, 0x80,
+0x90, 0xD1, 0xF0, 0x20, 0xFC, 0xD0, 0x80, 0xA0, 0xD0, 0xF2, 0x22, 0xF0, 0x23, 0xF0, 0x21, 0xD0,
+0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF5, 0x21, 0xF2, 0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0xD0,
+0x50, 0xD0, 0xF1, 0x21, 0xF2, 0x21, 0xD0, 0x50, 0xD0, 0x20, 0xF3, 0x21, 0xD0, 0xF0, 0x50, 0xD0,
+0xF3, 0x20, 0xF1, 0xA1, 0xD0, 0xF0, 0xD1, 0xF0, 0xA0, 0x51, 0xA0, 0xF0, 0xD2, 0xF0, 0xD0, 0xF1,
+0x50, 0xD0, 0xF0, 0x2B, 0xF1, 0x50, 0xF0, 0x26, 0xF1, 0x21, 0xF2, 0xD0, 0x50, 0xF2, 0xD0, 0xF1,
+0x21, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0, 0x50, 0x80, 0x60, 0x30, 0xB0, 0x04, 0x40, 0x09,
+0x40, 0x10, 0x05, 0x70, 0xD1, 0xA0, 0x50, 0xD0, 0x24, 0xF0, 0x20, 0xF3, 0x50, 0xA0, 0xD0, 0xF0,
+0x21, 0xF0, 0x25, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF2, 0x24, 0xF4, 0x20, 0xF0, 0xD0, 0x50, 0x80,
+0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x50, 0xA0, 0xD0,
+0xF1, 0x25, 0xF1, 0x29, 0xF0, 0x20, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0xD0,
+0x50, 0x80, 0x02, 0x90, 0x01, 0xB0, 0xE0, 0x0F, 0x0D, 0x0F, 0x11, 0x90, 0x70, 0xB0, 0x30, 0x60,
+0x00, 0x60, 0x91, 0xD0, 0x20, 0xD1, 0xA0, 0x50, 0xA0, 0xD1, 0xF1, 0x23, 0xF2, 0x24, 0xF0, 0x27,
+0xD1, 0xA0, 0x90, 0xC0, 0x10, 0x00, 0x90, 0xC0, 0xD0, 0xF0, 0x20, 0xF3, 0x22, 0xF6, 0x50, 0xA0,
+0x50, 0xD0, 0x22, 0xF0, 0x22, 0xF0, 0x24, 0xD0, 0xA0, 0x50, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xF1, 0x23, 0xF0, 0x22, 0xF1, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x21,
+0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0x21, 0xF2,
+0x21, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0x50, 0xA2,
+0xF0, 0xD0, 0xF0, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x23, 0xF1, 0x50, 0xD0, 0xF0, 0x25,
+0xF6, 0xD0, 0x50, 0xD1, 0xF0, 0xA1, 0x53, 0xA0, 0xD2, 0xF0, 0x20, 0xF2, 0x81, 0x41, 0x04, 0xB0,
+0x60, 0x08, 0xE0, 0x30, 0x60, 0xB0, 0x00, 0x60, 0xE0, 0xC0, 0x50, 0xD0, 0xF0, 0xD0, 0xA1, 0xD0,
+0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xF3, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF3,
+0x50, 0xF2, 0x22, 0xF2, 0x23, 0xF1, 0xD0, 0x50, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0,
+0x20, 0xF4, 0x22, 0xF1, 0x20, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x2B, 0xF0, 0x24, 0xF0, 0x21,
+0xD0, 0xF2, 0xA0, 0x50, 0xF0, 0xD0, 0x20, 0xF0, 0xD0, 0x70, 0x30, 0x60, 0x00, 0x41, 0xB0, 0x80,
+0xE0, 0x0F, 0x0E, 0x0F, 0x11, 0xB0, 0xE0, 0x70, 0x00, 0x90, 0x81, 0x00, 0x30, 0xA0, 0xD0, 0xF0,
+0xA1, 0xF0, 0xD0, 0xF2, 0x23, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0xF0,
+0xA1, 0x10, 0x40, 0xB0, 0x01, 0x90, 0xA0, 0xF0, 0x20, 0xF3, 0x23, 0xF2, 0xD0, 0xF0, 0x50, 0xF0,
+0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x24, 0xD0, 0xF0, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF0,
+0x22, 0xF2, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xA1, 0xD0, 0xF3, 0x20, 0xF4, 0x50,
+0xD0, 0x22, 0xF1, 0x21, 0xF1, 0x50, 0x21, 0xF1, 0x22, 0xF1, 0x50, 0xF1, 0x21, 0xF2, 0xD0, 0xA1,
+0xD1, 0xF0, 0xA1, 0x53, 0xF0, 0x20, 0xF4, 0xD1, 0xF6, 0x50, 0xD0, 0xF6, 0xD1, 0xF3, 0x20, 0xF0,
+0x53, 0xA1, 0xF0, 0xD1, 0xA1, 0xF2, 0x22, 0xF1, 0x50, 0x80, 0x60, 0x30, 0x05, 0x40, 0x08, 0x60,
+0x70, 0x90, 0x30, 0x70, 0x31, 0xA0, 0xD0, 0xF2, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF5, 0x50,
+0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xF2, 0x21, 0xF1, 0x23, 0xF1, 0xD0,
+0x50, 0xA0, 0xD0, 0xF0, 0x50, 0x20, 0xF2, 0x23, 0xF2, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50,
+0xA0, 0xF2, 0x25, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0,
+0x20, 0xD0, 0x50, 0x80, 0x00, 0x30, 0x80, 0x90, 0xB0, 0x70, 0x40, 0x90, 0xC0, 0xE0, 0x0F, 0x0C,
+0x0F, 0x0D, 0x31, 0x60, 0x02, 0x70, 0xB0, 0x80, 0x40, 0x01, 0xB0, 0x90, 0xA0, 0x50, 0xFA, 0x25,
+0xF5, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0x91, 0xB0, 0x01, 0x81, 0xD0, 0x22, 0xF0, 0x25,
+0xF0, 0xD0, 0xA0, 0x90, 0x50, 0xD0, 0xF1, 0xA1, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1,
+0x50, 0xF1, 0x24, 0xF1, 0x22, 0xF1, 0xD0, 0x50, 0xF1, 0x24, 0xF0, 0x20, 0xF3, 0x50, 0xF0, 0x20,
+0xF2, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0x50, 0xA0, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xA1, 0xF1, 0x21, 0xF1, 0x20, 0xD0, 0x50, 0xF0, 0xD0, 0xF4,
+0xD0, 0x50, 0xA1, 0x55, 0xA2, 0xF3, 0xD1, 0x50, 0xD2, 0xF2, 0xA2, 0x54, 0xA1, 0x50, 0xA0, 0xF2,
+0xD1, 0xF0, 0xD0, 0xF0, 0xA0, 0xD0, 0xF3, 0x20, 0xF0, 0xD0, 0x80, 0xB0, 0x00, 0x70, 0x05, 0x61,
+0x08, 0xB0, 0x70, 0xE0, 0xD2, 0xF3, 0x21, 0xF0, 0x50, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0xF0,
+0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xF5, 0x21, 0xF1, 0x20,
+0xD0, 0xA1, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x23, 0xF1, 0x20, 0xD0,
+0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF4, 0x2A, 0xF0, 0xD1, 0xA0, 0x50, 0xD0,
+0x70, 0x02, 0x30, 0xE0, 0x41, 0x01, 0xB0, 0x10, 0x40, 0x0F, 0x0B, 0x0F, 0x0D, 0x90, 0x30, 0x90,
+0xC0, 0x90, 0x71, 0x01, 0x90, 0x00, 0x60, 0xC0, 0x10, 0x80, 0xD1, 0xF0, 0x23, 0xF4, 0x25, 0xF1,
+0x21, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0xD0, 0x50, 0xC0, 0x80, 0x00,
+0x50, 0x30, 0xD0, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0xA1, 0x70, 0x50, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0xA0, 0xD0, 0xF1, 0x21, 0xF4, 0x50, 0xD0, 0x29, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF3, 0x22, 0xF0,
+0x20, 0xF2, 0xD0, 0x50, 0xA0, 0xF2, 0x23, 0xF0, 0x20, 0xF0, 0xA1, 0xF3, 0x23, 0xF1, 0x50, 0xD0,
+0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x50, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xD0, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0xD3, 0xF2, 0x50, 0xA1, 0x55, 0x80, 0x56, 0xA0, 0x50,
+0xF1, 0xD2, 0xF2, 0xA0, 0xF0, 0x20, 0xF3, 0x50, 0xD0, 0x50, 0xF3, 0x21, 0xF0, 0xA0, 0x90, 0x60,
+0xB0, 0x70, 0x06, 0x40, 0x09, 0x90, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0xA1, 0xD0, 0x20,
+0xF0, 0x23, 0xF1, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF4, 0x20, 0xF0, 0x21, 0xF2, 0x50,
+0xF2, 0x23, 0xF2, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x20, 0xF2, 0x27,
+0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF4, 0x28, 0xF1,
+0x20, 0xF0, 0xD1, 0x30, 0x10, 0x90, 0xB0, 0x00, 0x90, 0x00, 0xB0, 0x10, 0xB0, 0x02, 0xC0, 0x0F,
+0x0B, 0x0F, 0x0D, 0xB0, 0x70, 0x01, 0x61, 0x02, 0xE0, 0xC0, 0x11, 0x40, 0x90, 0xD0, 0xF1, 0x24,
+0xF6, 0x26, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF3, 0xD1, 0xC0, 0x90, 0x70, 0xA0,
+0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xD0, 0xA1, 0xD1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0xA0, 0xD0, 0xF1, 0x22, 0xF0, 0xA0, 0x50, 0xF1, 0x23, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xA0,
+0xF2, 0x21, 0xF2, 0x20, 0xF1, 0xD0, 0xA1, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xD0, 0x50, 0xF1,
+0x20, 0xF1, 0x23, 0xD0, 0xA1, 0xF2, 0x20, 0xF0, 0x23, 0x50, 0xD0, 0xF3, 0x20, 0xF1, 0xA1, 0xF0,
+0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xD0, 0xF4, 0xD0, 0xF0, 0x50, 0xD1, 0xF2, 0xD1, 0xF0, 0x50,
+0xD0, 0xF4, 0xD1, 0x50, 0xD0, 0xF6, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x50, 0xD0, 0x50,
+0xF1, 0x21, 0xF1, 0xD0, 0x80, 0xE0, 0x60, 0x90, 0xB0, 0x06, 0x61, 0x08, 0xE0, 0x30, 0xD0, 0x27,
+0xF0, 0xD0, 0xA1, 0xF1, 0x24, 0xF4, 0xA1, 0xF1, 0x20, 0xF6, 0x22, 0xF1, 0x50, 0xF0, 0xD0, 0xF0,
+0x23, 0xF0, 0xA1, 0xD0, 0x23, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x25, 0xF2, 0x20,
+0xF0, 0x22, 0xF1, 0xD0, 0xA0, 0x50, 0xD1, 0xF0, 0x23, 0xF6, 0x26, 0xF3, 0xD0, 0xE0, 0x90, 0x80,
+0x11, 0xC0, 0xB0, 0x00, 0xB0, 0x60, 0x10, 0x30, 0x60, 0xB0, 0x70, 0x0F, 0x0B, 0x0F, 0x0E, 0x81,
+0x06, 0x70, 0x90, 0x01, 0xE0, 0x30, 0xD0, 0xF0, 0x26, 0xF6, 0x24, 0xF1, 0xD0, 0xA0, 0x50, 0xA0,
+0xF4, 0x21, 0xD0, 0x70, 0xC0, 0x50, 0xF0, 0x24, 0xF4, 0x50, 0xA0, 0xD0, 0xF3, 0x20, 0xD0, 0xF2,
+0x50, 0xA0, 0xD0, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x23, 0xF1, 0x24, 0xF1, 0xA1, 0xF0, 0x20, 0xF0,
+0x21, 0xF4, 0x20, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0x22, 0xD0, 0xA1, 0xD0, 0xF0, 0x25,
+0xF1, 0x50, 0xD0, 0xF2, 0x23, 0xF0, 0xA1, 0xF5, 0x20, 0xF0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0x21,
+0xF1, 0x50, 0xF1, 0x21, 0xF2, 0x20, 0x50, 0xD0, 0xF2, 0x22, 0xF0, 0x50, 0xF1, 0x23, 0xF1, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x22, 0xF0, 0xD0, 0xA1, 0xF0, 0x20, 0xF2,
+0xA0, 0x90, 0x00, 0x60, 0x90, 0x08, 0x40, 0x08, 0x90, 0x50, 0xA0, 0x25, 0xF0, 0x20, 0xF2, 0x50,
+0xF2, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF3, 0x50,
+0xF1, 0x21, 0xF1, 0xA0, 0x50, 0xF2, 0x23, 0xF1, 0xD0, 0xA0, 0x50, 0xD0, 0xF2, 0x24, 0xF4, 0x26,
+0xD0, 0xA0, 0x50, 0xA0, 0xF1, 0x20, 0xF0, 0x24, 0xF6, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0x90, 0xB0,
+0x00, 0xB0, 0x70, 0x30, 0x60, 0xC1, 0x40, 0x00, 0x80, 0x70, 0xC0, 0x60, 0x0F, 0x0B, 0x0F, 0x0F,
+0x60, 0x00, 0x10, 0x92, 0x70, 0x30, 0xB0, 0x80, 0x01, 0xE0, 0x10, 0xF1, 0x28, 0xF4, 0x24, 0xF1,
+0x50, 0xA0, 0xF4, 0x22, 0xF0, 0xD0, 0x51, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xF1, 0x50,
+0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x50, 0xF0, 0xD0, 0xF1, 0xD0, 0x50, 0xF0,
+0xD0, 0x21, 0xF0, 0x21, 0xF4, 0x21, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0x22, 0xF5, 0xD0, 0x50, 0xF2,
+0x23, 0xF4, 0x50, 0xD0, 0xF2, 0x23, 0xF0, 0xD0, 0xA1, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50,
+0xF2, 0x20, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xA1, 0xF1, 0x21, 0xF2,
+0x20, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x50, 0xF1,
+0x22, 0xF1, 0xD0, 0xA0, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x50, 0x23, 0xD0, 0x90, 0x60, 0x00, 0x40,
+0x80, 0x08, 0xE0, 0xB0, 0x06, 0x90, 0x50, 0xD0, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF3, 0xD0, 0xF0,
+0x50, 0xD0, 0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x25, 0xD1,
+0xF0, 0x50, 0xF3, 0xA0, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0xD0, 0xA0, 0x50, 0xF2, 0x23, 0xF4,
+0x25, 0xF4, 0x50, 0xA0, 0xD1, 0xF3, 0x22, 0xF5, 0x24, 0xF0, 0xD0, 0x50, 0x10, 0x60, 0x01, 0x30,
+0x00, 0x70, 0xB0, 0x00, 0x10, 0x0F, 0x10, 0x0F, 0x11, 0x30, 0x40, 0x00, 0x30, 0xC0, 0xE0, 0x00,
+0x30, 0x40, 0x90, 0x80, 0x00, 0x70, 0xD0, 0xF2, 0x26, 0xF3, 0x23, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0x20, 0xF3, 0x22, 0xF1, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF0,
+0x20, 0xF4, 0x22, 0xF1, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x23, 0xF2, 0x21, 0xF5, 0x50,
+0xD1, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0xA1, 0xD0, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xF0, 0x50,
+0xF4, 0x23, 0xF1, 0x50, 0xD0, 0xF0, 0x23, 0xF3, 0xA0, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x50, 0xF1,
+0x22, 0xF0, 0x20, 0xF0, 0xA1, 0xF0, 0x24, 0xF0, 0x20, 0xA0, 0xD0, 0xF2, 0x20, 0xF2, 0x50, 0xD0,
+0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF0, 0x24, 0xF1, 0xA1, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x50,
+0xF0, 0x21, 0xD0, 0x50, 0x70, 0x00, 0x60, 0x90, 0xE0, 0x09, 0x40, 0x04, 0x80, 0x70, 0x50, 0xD0,
+0xF0, 0xA1, 0xF3, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xA1, 0xF3, 0x25, 0xF0, 0xD0, 0xF0, 0x50, 0xF0,
+0x21, 0xF1, 0x24, 0xF0, 0x20, 0xF3, 0x50, 0xD1, 0xA0, 0x50, 0xD0, 0xF0, 0x27, 0xF4, 0x50, 0xF6,
+0x25, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0xA0, 0x50, 0xF3, 0x24, 0xF4, 0x24, 0xD1, 0x70, 0x00, 0x80,
+0x30, 0x80, 0x40, 0x00, 0xC0, 0xB0, 0x00, 0x30, 0x40, 0x00, 0x30, 0x0F, 0x0D, 0x0F, 0x11, 0xB0,
+0x10, 0xC0, 0x40, 0x03, 0xC0, 0xB0, 0x01, 0x40, 0x50, 0xD0, 0xF3, 0x2A, 0xF1, 0x51, 0xD0, 0xF2,
+0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0,
+0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x50, 0xA0, 0x50, 0xF1, 0x20,
+0xF0, 0x21, 0xF0, 0x20, 0xF6, 0x20, 0x50, 0xD0, 0xF4, 0x24, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF0,
+0x23, 0xF4, 0x50, 0xD0, 0x21, 0xF1, 0x23, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xA1, 0xF1,
+0x20, 0xF2, 0x21, 0xA1, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xF2, 0x20, 0xF3, 0xA1,
+0xF2, 0x22, 0xF1, 0x50, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x50, 0xF1, 0x22, 0xF2, 0xA1, 0xD0, 0x21,
+0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xA0, 0x22, 0xF0, 0xC0, 0xB0, 0x00, 0x40, 0xE0, 0x61, 0x08, 0xE2,
+0x40, 0x91, 0x50, 0xF0, 0xD0, 0xF2, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0x50, 0xF3,
+0x27, 0xD0, 0xF0, 0x50, 0xF1, 0x23, 0xF4, 0x21, 0xF2, 0x50, 0xA0, 0x50, 0xF1, 0x21, 0xF1, 0x20,
+0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xD0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0x25, 0xF1, 0x21, 0xF0, 0x21,
+0xF0, 0x20, 0xF3, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x24, 0xF2, 0x22, 0xF0, 0x21, 0xD0, 0x30, 0xE0,
+0x01, 0x60, 0x70, 0x01, 0x40, 0xE0, 0x00, 0x40, 0x80, 0xE0, 0x90, 0x0F, 0x0D, 0x0F, 0x11, 0x71,
+0x30, 0x00, 0xB0, 0x81, 0x00, 0x41, 0x01, 0x40, 0xC0, 0xD0, 0xF4, 0x26, 0xF3, 0x50, 0xA0, 0xF3,
+0x21, 0xF0, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0xD0, 0xA1, 0xD0, 0x21, 0xF1, 0x20, 0xF2, 0x21,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF7, 0x50, 0xA0, 0xD0,
+0xF2, 0x20, 0xF1, 0x22, 0xF2, 0x50, 0xF2, 0x20, 0xF0, 0x23, 0xF2, 0x50, 0xF0, 0x23, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF3, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF3, 0x21, 0x50,
+0xF1, 0x21, 0xF2, 0x20, 0xD0, 0x50, 0xF1, 0x21, 0xF3, 0xA1, 0xF4, 0x20, 0xF1, 0x50, 0xF1, 0x23,
+0xF0, 0xD0, 0x50, 0xF1, 0x22, 0xF2, 0x20, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xA1, 0xD0,
+0xF0, 0xA0, 0x30, 0x01, 0xE0, 0x80, 0x00, 0xE0, 0x08, 0xE0, 0x70, 0x30, 0x50, 0xA0, 0xD0, 0xF1,
+0x22, 0xF1, 0x50, 0xD0, 0x20, 0xF0, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x22, 0xD1, 0xA0, 0x50, 0xF0,
+0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x24, 0xF1, 0x20, 0xD0, 0x50, 0xA0, 0xF3, 0x26, 0xF2, 0x20,
+0xF7, 0xA1, 0xF0, 0xD0, 0xF0, 0x23, 0xF1, 0x24, 0xF0, 0xD0, 0xF0, 0xC0, 0xE0, 0x01, 0x30, 0x60,
+0x40, 0xB0, 0x02, 0xB0, 0x71, 0xB0, 0x0F, 0x0D, 0x0F, 0x11, 0xB0, 0x01, 0x30, 0x10, 0x80, 0x40,
+0x70, 0x00, 0x90, 0x60, 0x90, 0x40, 0xE0, 0x30, 0xD0, 0xF2, 0x24, 0xF0, 0x20, 0xF0, 0xD1, 0xA0,
+0x50, 0xF8, 0x24, 0xF2, 0x22, 0xF3, 0x50, 0xA0, 0xF1, 0x25, 0xF1, 0x24, 0xF3, 0x50, 0xF0, 0x50,
+0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xF6, 0x22, 0xF2, 0x50,
+0xA0, 0xF0, 0x21, 0xF2, 0x22, 0xF0, 0xD0, 0xA1, 0xD0, 0x23, 0xF0, 0x22, 0xF0, 0xA1, 0xF1, 0x20,
+0xF0, 0x23, 0xF0, 0xA1, 0xD0, 0x22, 0xF2, 0x20, 0xD0, 0x50, 0xD0, 0x23, 0xF2, 0xD0, 0x50, 0xD0,
+0x21, 0xF0, 0x20, 0xF2, 0xA1, 0xF3, 0x20, 0xF2, 0x50, 0xF0, 0x25, 0xD0, 0xA0, 0xF2, 0x20, 0xF0,
+0x22, 0xF0, 0x50, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xF2, 0x30, 0x01, 0x90, 0x40,
+0x00, 0xE0, 0x08, 0x40, 0x30, 0xD1, 0xF3, 0x22, 0xF0, 0xD0, 0x50, 0xF2, 0x23, 0xF0, 0x20, 0xF1,
+0xD0, 0xA1, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x25, 0xF0, 0xD0, 0xA1, 0xF1, 0x20, 0xF3, 0x20, 0xF0,
+0x22, 0xD0, 0xF0, 0x50, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0xD0,
+0xA0, 0x50, 0xD0, 0xF3, 0x22, 0xF0, 0x21, 0xF0, 0x24, 0xF3, 0x20, 0xD0, 0xA0, 0x50, 0xA0, 0xD0,
+0xF1, 0x20, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x70, 0xB0, 0x80, 0x90, 0x60, 0x30, 0x00, 0x30,
+0x10, 0x80, 0x02, 0xC0, 0x80, 0x0F, 0x0E, 0x0F, 0x13, 0x70, 0x30, 0x02, 0x70, 0xB1, 0x10, 0x02,
+0x30, 0xA0, 0xF0, 0xD0, 0xF0, 0x25, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF3, 0x23,
+0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0xF1, 0xD0, 0xF0, 0x24, 0xF0, 0x20, 0xF0,
+0x25, 0xD0, 0xF0, 0x50, 0xD1, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0x22, 0xF5, 0xA1, 0xD0, 0xF0, 0x20,
+0xF3, 0x24, 0xD0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x23, 0xD0, 0x50, 0xD0, 0xF1, 0x22,
+0xF0, 0x20, 0xF2, 0x50, 0xF4, 0x23, 0xD0, 0x50, 0xF0, 0xD0, 0x21, 0xF0, 0x21, 0xF2, 0x50, 0xD0,
+0x23, 0xF3, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA1, 0xF3, 0x20, 0xF2, 0x50, 0xF0, 0x25,
+0xF0, 0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0x50, 0xD2,
+0x70, 0x00, 0x40, 0x80, 0x01, 0xB0, 0x60, 0x07, 0xC0, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x22,
+0xF0, 0xD0, 0xF0, 0x50, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0xD1, 0x50, 0xF2, 0x20, 0xF1, 0x25, 0xF0,
+0xD0, 0xA1, 0xF6, 0x22, 0xD0, 0xA0, 0x50, 0xD1, 0xF0, 0x50, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0x25,
+0xF2, 0xD0, 0xA0, 0x50, 0xD1, 0xF1, 0x23, 0xF1, 0x26, 0xF1, 0x22, 0xF0, 0xD0, 0x51, 0xF4, 0x21,
+0xF0, 0x22, 0xD0, 0x50, 0x80, 0x02, 0x10, 0x01, 0x41, 0x80, 0x10, 0x40, 0x0F, 0x11, 0x0F, 0x12,
+0xE0, 0x90, 0x02, 0x80, 0x70, 0x01, 0x80, 0xE0, 0x01, 0x80, 0x70, 0xD0, 0xF1, 0x23, 0xF1, 0xD0,
+0xA0, 0x50, 0xF4, 0x28, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF4, 0x21,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xA0, 0x50, 0xF4, 0x50, 0xA0, 0xF0, 0x23, 0xF1, 0x20,
+0xD0, 0xA0, 0x50, 0xF2, 0x22, 0xF0, 0x22, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x22, 0xF0, 0x23,
+0xD0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0xA1, 0xD0, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x50,
+0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xD0, 0x23, 0xF1, 0xD0, 0xA1, 0xF0, 0x21, 0xF0,
+0x20, 0xF1, 0xD0, 0xA0, 0x20, 0xF3, 0x20, 0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xA1, 0xF1,
+0x24, 0xF0, 0xA1, 0xF0, 0x25, 0xF0, 0x50, 0xA0, 0xD0, 0x90, 0x40, 0x00, 0x70, 0xB0, 0x02, 0x40,
+0x03, 0x71, 0x80, 0x90, 0x30, 0xD0, 0x50, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA1,
+0xF1, 0x24, 0xF4, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0xD0, 0xF0,
+0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0xD0, 0xF0, 0x50, 0xF0, 0x20, 0xF0,
+0x22, 0xF0, 0x20, 0xF0, 0x27, 0xF2, 0x50, 0xF0, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF2,
+0x23, 0xF0, 0x20, 0xD0, 0xF2, 0x20, 0x50, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0xD0, 0xF0, 0xC0, 0x40, 0x01, 0x41, 0x01, 0xB0, 0x60, 0x00, 0xB0, 0x90, 0x70, 0x0F, 0x10, 0x0F,
+0x12, 0x60, 0x70, 0x00, 0xE0, 0x70, 0x90, 0x00, 0x31, 0x00, 0x90, 0x60, 0x90, 0xE1, 0x30, 0xD0,
+0xF0, 0x20, 0xF4, 0x50, 0xA0, 0xF6, 0x24, 0xF4, 0x23, 0xF1, 0xD0, 0xA0, 0x50, 0xF1, 0x22, 0xF2,
+0x24, 0xF3, 0x20, 0xF1, 0x50, 0xF4, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0x22, 0xF1, 0xD0, 0xF0, 0x50,
+0xD0, 0x29, 0xF1, 0xD0, 0x50, 0xA0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x50,
+0xD0, 0x20, 0xF2, 0x22, 0xF2, 0x50, 0xF4, 0x21, 0xF0, 0x20, 0xF0, 0xA1, 0xF1, 0x22, 0xF0, 0x20,
+0xF0, 0xD0, 0x50, 0xF1, 0x23, 0xF1, 0xD0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA0,
+0x20, 0xF3, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xA1, 0xD0, 0x20, 0xF0, 0x23, 0xF0,
+0xA1, 0xF3, 0x23, 0xF0, 0xA1, 0x90, 0x00, 0xB0, 0x30, 0x03, 0xE0, 0xB0, 0x02, 0x70, 0xE0, 0x50,
+0xA0, 0xD0, 0xF1, 0x50, 0xF0, 0x21, 0xF1, 0x23, 0xF1, 0x50, 0xF0, 0x20, 0xD0, 0x20, 0xF0, 0x20,
+0xF3, 0x20, 0xF0, 0xA0, 0x50, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x22, 0xF0, 0x50, 0xF0,
+0xD0, 0x20, 0xF0, 0x21, 0xF1, 0xA1, 0xF3, 0x20, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x22, 0xF2, 0x28,
+0xF1, 0x20, 0x50, 0xF4, 0x24, 0xF2, 0x23, 0xF2, 0x22, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0xD0, 0xF1,
+0x20, 0xF0, 0xD0, 0x90, 0x60, 0x40, 0x90, 0x60, 0x90, 0x07, 0xB0, 0x0F, 0x10, 0x0F, 0x13, 0x40,
+0xC0, 0x90, 0xE0, 0x00, 0x60, 0x40, 0xE1, 0x60, 0xC0, 0x02, 0x30, 0x50, 0xD1, 0xF2, 0xA0, 0x50,
+0xA0, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xF3, 0x22, 0xF1, 0xD1, 0xA1, 0xD1, 0xF0, 0x25, 0xF1,
+0x20, 0xF2, 0x20, 0xF3, 0x50, 0x20, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xF1,
+0x20, 0xF1, 0x50, 0xF0, 0x29, 0xF1, 0xD0, 0xA1, 0xD0, 0x20, 0xF2, 0x25, 0xD0, 0x50, 0xA0, 0xF0,
+0x20, 0xF1, 0x22, 0xF3, 0x50, 0xF3, 0x22, 0xF1, 0xD0, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x50,
+0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0x20, 0xF2,
+0x21, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x50, 0xD0, 0x20, 0xF0, 0x23, 0xF0, 0xA1, 0xF2,
+0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xC0, 0x80, 0x70, 0x80, 0x04, 0xE0, 0x02, 0xC0, 0x10,
+0x30, 0xD1, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0xA1, 0xD0, 0xF0, 0x22,
+0xF1, 0x23, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF3, 0x50, 0xF1, 0x22,
+0xF0, 0xA1, 0xF2, 0x21, 0xF1, 0xD0, 0xF0, 0x50, 0xF3, 0x20, 0xF0, 0x22, 0xF2, 0x24, 0xF1, 0xD0,
+0x50, 0xA0, 0xF1, 0x24, 0xF3, 0x24, 0xF0, 0x23, 0xF2, 0xA0, 0x50, 0xF0, 0xD0, 0xF0, 0x20, 0xF0,
+0xD0, 0x80, 0x40, 0x02, 0xC0, 0xB0, 0x0F, 0x19, 0x0F, 0x19, 0x81, 0x01, 0x80, 0xE0, 0x01, 0x30,
+0xC0, 0xD0, 0xF0, 0xD1, 0xA0, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0x26, 0xF0, 0x21, 0xF4,
+0x50, 0xA0, 0x70, 0xD0, 0xF2, 0x23, 0xF4, 0x50, 0xA0, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF0,
+0x21, 0xF6, 0x50, 0xA0, 0xD0, 0xF2, 0x50, 0xF1, 0x20, 0xF0, 0x27, 0xF0, 0xD0, 0xF0, 0x50, 0xD0,
+0xF0, 0x20, 0xF2, 0x23, 0xF0, 0xD0, 0xA1, 0xD0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50,
+0xF4, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xA1, 0xF1, 0x22, 0xF0, 0x20,
+0xF1, 0x50, 0xD0, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x50, 0xF0,
+0x20, 0xF1, 0x22, 0xF1, 0x50, 0xD0, 0x20, 0xF0, 0x23, 0xF1, 0x50, 0xF1, 0x21, 0xF1, 0x20, 0xF1,
+0xA0, 0x70, 0x12, 0xE0, 0x04, 0x40, 0x02, 0x10, 0xC0, 0x50, 0xD0, 0xF2, 0xA0, 0x50, 0xD0, 0xF0,
+0x20, 0xF1, 0x21, 0xF3, 0x50, 0xF2, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x50, 0xF2, 0x20, 0xF0,
+0x20, 0xF0, 0x24, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF1, 0x50, 0xA0, 0xD1, 0xF0, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xF1, 0x50, 0xD0, 0xF2, 0x23, 0xF3, 0x24, 0xF1, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x22,
+0xF0, 0x20, 0xF3, 0x23, 0xF1, 0x22, 0xF4, 0x50, 0xA0, 0xD2, 0xF0, 0xC0, 0x80, 0x01, 0x41, 0x0F,
+0x1A, 0x0F, 0x1E, 0x90, 0xE0, 0x90, 0xB0, 0xE0, 0x90, 0xD0, 0xA0, 0x50, 0xA0, 0xF0, 0x20, 0xF1,
+0x25, 0xF4, 0x24, 0xF4, 0x50, 0xF0, 0xD0, 0x90, 0x50, 0xD0, 0xF0, 0x24, 0xF2, 0x20, 0xF0, 0x20,
+0xF0, 0x20, 0xD0, 0xA0, 0x50, 0xF1, 0x24, 0xF0, 0x21, 0xF0, 0xD1, 0xA1, 0xD1, 0x50, 0xA0, 0xF2,
+0x27, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x23, 0xF1, 0x50, 0xF1, 0x22, 0xF4, 0xD0, 0xF0,
+0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xA1, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xA0, 0xF1,
+0x21, 0xF1, 0x21, 0xF1, 0x50, 0xF0, 0x20, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x23,
+0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x50, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1,
+0x50, 0xF3, 0x22, 0xF0, 0xD0, 0xF0, 0xC0, 0x10, 0x71, 0x05, 0xE0, 0xB0, 0x00, 0x90, 0x50, 0xD1,
+0xF1, 0x20, 0xF1, 0x50, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x24, 0xF0, 0xD0,
+0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x26, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x50, 0xA0, 0xD0,
+0xF1, 0x20, 0xF1, 0x22, 0xF3, 0x50, 0xF2, 0x23, 0xF4, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x50,
+0xD0, 0xF1, 0x21, 0xF4, 0x23, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0xF0,
+0xD0, 0x70, 0x00, 0xE0, 0x90, 0xE0, 0x90, 0x0F, 0x1B, 0x0F, 0x1E, 0x60, 0xC0, 0x02, 0x81, 0x50,
+0xF6, 0x25, 0xF5, 0x22, 0xF3, 0x50, 0xF2, 0xD0, 0xF2, 0x25, 0xF3, 0x20, 0xF0, 0xD0, 0xF0, 0x50,
+0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0xA0, 0x50, 0xA1, 0xF2, 0x20, 0xF0, 0x25, 0xF2, 0xA1,
+0xF0, 0x21, 0xF0, 0x25, 0xF1, 0xA1, 0xD0, 0xF0, 0x23, 0xF4, 0xA1, 0xF1, 0x21, 0xF0, 0x22, 0xF0,
+0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x50, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0xA0,
+0xF0, 0x20, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0x25, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0,
+0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x80, 0x90,
+0xC0, 0x80, 0x90, 0x60, 0x05, 0xE0, 0x60, 0x90, 0xD0, 0xF2, 0x21, 0xF1, 0xA1, 0xF2, 0x20, 0xF1,
+0x23, 0xD0, 0xA0, 0xF2, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xD0, 0xA1, 0xD0, 0xF0, 0x25, 0xF1, 0x20,
+0xF1, 0xD0, 0xA1, 0x50, 0xA0, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xA0, 0x50,
+0xF2, 0x23, 0xF6, 0x21, 0xF0, 0x20, 0xF2, 0x50, 0x20, 0xF1, 0x22, 0xF2, 0x25, 0xF0, 0x22, 0xF4,
+0xD0, 0xF0, 0x50, 0x80, 0x50, 0x02, 0x10, 0x0F, 0x1C, 0x0F, 0x1F, 0x80, 0x60, 0x01, 0x30, 0xC0,
+0xD1, 0x20, 0xF0, 0x20, 0xF3, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x50,
+0xF9, 0x22, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x23, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0x20,
+0xD0, 0x50, 0x80, 0xF0, 0xD0, 0xF2, 0x26, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0x21, 0xF0, 0x25, 0xF2,
+0x50, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0xA1,
+0xF1, 0x23, 0xF3, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF2, 0x21,
+0xF1, 0x50, 0xF0, 0x25, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF0,
+0x20, 0xF2, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x80, 0x30, 0x10, 0x80, 0x90,
+0x30, 0x05, 0x40, 0x70, 0xA0, 0xD0, 0xF0, 0x23, 0xF2, 0x50, 0xF1, 0x21, 0xF0, 0x23, 0xF2, 0x50,
+0xD0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0x50, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x20, 0xF0,
+0xD0, 0xF0, 0x80, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x50, 0xF2,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF4, 0x23, 0xF2, 0x50, 0xF1, 0x22, 0xF3, 0x20, 0xF0, 0x22, 0xF1,
+0x23, 0xF3, 0xD0, 0xF0, 0xC0, 0x30, 0x01, 0x41, 0x0F, 0x1C, 0x0F, 0x20, 0x70, 0x40, 0x90, 0xB0,
+0x60, 0x90, 0xD0, 0xF0, 0x20, 0xF4, 0x27, 0xF1, 0x21, 0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0xF2, 0x22,
+0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF4, 0x50, 0xD0, 0xF0, 0x24, 0xF1, 0x23, 0xF1, 0x20, 0xF0,
+0xA0, 0x50, 0xD0, 0x50, 0xA0, 0xF4, 0x23, 0xF2, 0x50, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x21, 0xD0,
+0xA1, 0xD0, 0xF0, 0x24, 0xF2, 0xD0, 0x50, 0xA0, 0xF2, 0x24, 0xF0, 0xD0, 0xA1, 0xF2, 0x22, 0xF2,
+0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xA0, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0xA1,
+0xF0, 0x24, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF1, 0x20, 0xF1,
+0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0x10, 0x70, 0x10, 0x40, 0x10, 0x80, 0x01, 0x30,
+0xB0, 0x00, 0xC0, 0x30, 0x50, 0xD0, 0xF1, 0x23, 0xF1, 0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0x21, 0xF0,
+0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x21, 0xF1, 0x20, 0xF2, 0x20, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x22,
+0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0x50, 0xF2, 0x25, 0xF3, 0x21, 0xF1, 0x20, 0x50,
+0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF4, 0x22, 0xF2, 0xD0, 0x50, 0xA0, 0xD0, 0xF0,
+0x22, 0xF2, 0x25, 0xF2, 0x20, 0xF3, 0xD0, 0x70, 0x00, 0x60, 0x70, 0x40, 0x90, 0x0F, 0x1D, 0x0F,
+0x20, 0x60, 0x70, 0x02, 0x81, 0xD0, 0xF1, 0x20, 0xF2, 0x27, 0xF3, 0xD1, 0x50, 0xA0, 0xD0, 0xF0,
+0x21, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x23, 0xF2, 0x22, 0xF0,
+0x20, 0xF3, 0x50, 0xF1, 0xD0, 0x50, 0xA0, 0xF6, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x21, 0xF0,
+0x21, 0xF2, 0x20, 0xF2, 0x50, 0xD0, 0xF1, 0x21, 0xF1, 0x21, 0xF2, 0x50, 0xD0, 0xF2, 0x23, 0xF2,
+0x50, 0xD0, 0xF2, 0x22, 0xF1, 0xD0, 0x50, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xD0,
+0x22, 0xF1, 0x21, 0xF0, 0xA1, 0xF0, 0x24, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xA0,
+0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0xF1, 0x21, 0xF1, 0xD0, 0x50, 0x10, 0xC0,
+0x90, 0x00, 0xC0, 0x02, 0x90, 0x60, 0x70, 0xD1, 0x50, 0xD0, 0xF1, 0x23, 0xF3, 0x50, 0xD0, 0x22,
+0xF1, 0x20, 0xF1, 0x21, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x21, 0xF0, 0xD0, 0xA1, 0xD0,
+0xF0, 0x22, 0xF2, 0xD1, 0x50, 0xA0, 0xF0, 0xD0, 0xF0, 0x50, 0xF1, 0x25, 0xF3, 0x23, 0xF1, 0x50,
+0xF3, 0x25, 0xF2, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x22, 0xF3,
+0x20, 0xF1, 0xD0, 0x90, 0xE0, 0x02, 0x70, 0x0F, 0x1E, 0x0F, 0x21, 0x80, 0x40, 0x00, 0xB0, 0x90,
+0x70, 0xA0, 0xF0, 0x20, 0xF4, 0x25, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0x23,
+0xF0, 0x24, 0xF0, 0xD0, 0x30, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0x50, 0xF1, 0x23, 0xF2, 0x23, 0xF1,
+0x21, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD1, 0xF0, 0x21, 0xF1, 0xA1, 0xD0,
+0x21, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xA1, 0xF0,
+0x20, 0xF0, 0x23, 0xF2, 0xA1, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0x50, 0xD0, 0x20, 0xF0,
+0x21, 0xF0, 0x21, 0xF1, 0x50, 0xD0, 0x23, 0xF0, 0x21, 0xF0, 0xA1, 0xF0, 0x24, 0xF2, 0x50, 0xF0,
+0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xA0, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0x50, 0xD0, 0x21, 0xF1, 0xD0,
+0xA0, 0x12, 0x60, 0x30, 0x10, 0x04, 0x90, 0x50, 0xA0, 0x50, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0xD0,
+0xA1, 0xF0, 0x21, 0xF4, 0x21, 0xF0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x20, 0xF1,
+0x50, 0xA0, 0xF1, 0x22, 0xF2, 0x50, 0xA0, 0xF3, 0xA0, 0x50, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x22, 0xF3, 0x50, 0xF0, 0xD0, 0xF0, 0x26, 0xF9, 0xD0, 0xA0, 0x50, 0x20, 0xF2, 0x21,
+0xF2, 0x22, 0xF3, 0x21, 0xD0, 0x50, 0x70, 0x80, 0x01, 0x80, 0x40, 0x0F, 0x1E, 0x0F, 0x22, 0x30,
+0x40, 0x90, 0x01, 0x70, 0xD0, 0xF3, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xD0, 0xF1, 0x50,
+0xF3, 0x24, 0xF1, 0x23, 0xF1, 0xD0, 0xF3, 0x50, 0xF0, 0xD0, 0xF0, 0x22, 0xF2, 0x26, 0xF0, 0xD0,
+0x50, 0xF6, 0xA0, 0x50, 0xF1, 0xD0, 0xF3, 0x50, 0xD0, 0xF1, 0x23, 0xF0, 0x20, 0xF2, 0xD0, 0xA0,
+0x50, 0xD0, 0xF0, 0x20, 0xF3, 0x22, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0x50,
+0xF2, 0x24, 0xF2, 0x50, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xD0, 0xF0, 0x50, 0xF1, 0x22, 0xF1,
+0x20, 0xF0, 0xA1, 0xF0, 0x24, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xA1, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x50, 0xF2, 0x20, 0xF1, 0x11, 0xC0, 0x40, 0x30, 0x10, 0x40, 0x05,
+0x80, 0xC0, 0xA1, 0xF3, 0x24, 0xF1, 0x50, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0,
+0x50, 0xF1, 0x20, 0xF2, 0x21, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF0, 0xA0, 0x50, 0xF0,
+0xD0, 0xF0, 0x22, 0xF0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x21, 0xF0, 0x22, 0xF0, 0x21, 0xD1,
+0xA0, 0x50, 0xF2, 0x26, 0xF4, 0x21, 0xF2, 0xD0, 0xA0, 0x50, 0xF1, 0x22, 0xF2, 0x20, 0xF6, 0xD1,
+0x70, 0x00, 0x60, 0x90, 0x40, 0x30, 0x0F, 0x1F, 0x0F, 0x23, 0x10, 0x02, 0x60, 0x70, 0xD0, 0xF1,
+0x22, 0xF1, 0x21, 0xF4, 0xA0, 0x50, 0xF4, 0x24, 0xF2, 0x23, 0xF1, 0xD0, 0xF1, 0x50, 0xF0, 0xD0,
+0x22, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0x22, 0xF1, 0xD0, 0xF0,
+0x50, 0xF0, 0xD0, 0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xF3, 0x50, 0xF2, 0x20, 0xF2,
+0x23, 0xF0, 0xA1, 0xF2, 0x23, 0xF2, 0xD0, 0x50, 0xD0, 0xF1, 0x22, 0xF3, 0xA1, 0xF0, 0x21, 0xF1,
+0x21, 0xF1, 0xA1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0xA0, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x50, 0xF0,
+0x25, 0xF0, 0xD0, 0xA1, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0xD0,
+0xA0, 0x90, 0x10, 0xE1, 0x80, 0x06, 0xC0, 0x30, 0xD0, 0x50, 0xF3, 0x24, 0xF0, 0xD0, 0xA1, 0xD0,
+0xF2, 0x25, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50, 0xD0,
+0xF2, 0xA0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xF5, 0x21, 0xF0, 0x23, 0xF2, 0xD0,
+0xF0, 0x50, 0xD0, 0xF2, 0x25, 0xF2, 0x23, 0xF2, 0xD0, 0xF0, 0x50, 0xA0, 0x21, 0xF6, 0x22, 0xF1,
+0xD0, 0x70, 0x03, 0x10, 0x0F, 0x20, 0x0F, 0x23, 0x60, 0x30, 0x00, 0x60, 0x90, 0x30, 0x80, 0xD0,
+0x22, 0xF0, 0x22, 0xF1, 0x20, 0xD1, 0xA0, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x22, 0xF4, 0x21, 0xF0,
+0x22, 0xF0, 0xA0, 0x50, 0xF1, 0x21, 0xF8, 0x21, 0xF1, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF0,
+0x20, 0xF0, 0xD0, 0x51, 0xD1, 0xA1, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0xA1, 0xF0,
+0x21, 0xF3, 0x24, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0xA1, 0xF2, 0x22, 0xF1, 0x20, 0xF0,
+0x50, 0xF1, 0x21, 0xF0, 0x23, 0xF0, 0xA1, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x50, 0xF1,
+0x21, 0xF0, 0x21, 0xF2, 0x50, 0xF0, 0x25, 0xF2, 0xA0, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xA1, 0xD0,
+0xF0, 0x20, 0xF0, 0xA0, 0x11, 0xC0, 0x70, 0xC0, 0x60, 0x04, 0x40, 0x70, 0xA0, 0xD1, 0x50, 0x21,
+0xF1, 0x22, 0xF3, 0x20, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x25, 0xD1, 0x50, 0xA0, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0x22, 0xF2, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x50, 0xA0, 0xF2, 0x20, 0xF0, 0x21, 0xF0,
+0x21, 0xD0, 0x50, 0xA0, 0xF3, 0x23, 0xF4, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xD1, 0xF2, 0x24, 0xF0,
+0x24, 0xF3, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0x22, 0xF1, 0x24, 0xF0, 0xD0, 0x31, 0x90, 0x01, 0x90,
+0xB0, 0x0F, 0x20, 0x0F, 0x24, 0x81, 0x30, 0x01, 0x90, 0xA0, 0xD0, 0x21, 0xF0, 0x21, 0xF2, 0xD0,
+0xF0, 0xA1, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF7, 0x22, 0xF1, 0x50, 0xF0, 0xD0, 0xF0, 0x22,
+0xF3, 0x20, 0xF5, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF5, 0xA0, 0x50, 0xA0, 0x50,
+0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0x21, 0xF1, 0x20,
+0xF1, 0x21, 0xF2, 0xA0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x20,
+0xF0, 0x22, 0xF3, 0x50, 0xD0, 0xF0, 0x26, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21,
+0xF0, 0x50, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x50, 0xF0, 0x25, 0xF2, 0xA0, 0xF0, 0x22, 0xF0, 0x22,
+0xF0, 0xA1, 0xF1, 0x20, 0xD0, 0x80, 0x11, 0x90, 0x70, 0x10, 0x60, 0x03, 0x40, 0x90, 0xD1, 0x20,
+0xF0, 0x20, 0x50, 0xD1, 0xF8, 0x50, 0xF2, 0x25, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0xF3, 0x20, 0xF0,
+0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x21,
+0xF0, 0x21, 0xF3, 0x50, 0xF3, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xF0, 0xD0,
+0xF2, 0x28, 0xF1, 0x20, 0xD0, 0xF1, 0xD0, 0xF0, 0xA1, 0xF5, 0x23, 0xD0, 0x50, 0x30, 0x00, 0xB0,
+0x31, 0x40, 0x0F, 0x21, 0x0F, 0x25, 0x70, 0xB0, 0x01, 0x60, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x21,
+0xF3, 0x50, 0xA0, 0xF0, 0x22, 0xF2, 0x22, 0xF6, 0x20, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0xD0, 0xF1,
+0x21, 0xF3, 0x23, 0xF2, 0xD0, 0xF0, 0x50, 0xF0, 0x22, 0xF3, 0x20, 0xF2, 0x20, 0xF2, 0x80, 0xA0,
+0xD1, 0xF5, 0x23, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0xF1, 0x21, 0xF1, 0x23, 0xD0, 0xF0, 0x50, 0xD0, 0x22, 0xF0, 0x22, 0xF2, 0xA0, 0xF1, 0x20, 0xF0,
+0x23, 0xF0, 0xD0, 0x50, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x50, 0xF1, 0x20, 0xF1, 0x21,
+0xF2, 0x50, 0xF0, 0x24, 0xF2, 0x20, 0xA0, 0xD0, 0xF0, 0x22, 0xF4, 0x50, 0xD0, 0x21, 0xD0, 0x80,
+0x13, 0xC0, 0x60, 0x02, 0x10, 0x70, 0xA0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xF0, 0xD4, 0xF2,
+0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x25, 0xF3, 0xA1, 0xF0, 0x24, 0xF2, 0x20, 0xF1, 0xD0, 0x51, 0xF2,
+0x21, 0xF0, 0x24, 0xF4, 0x50, 0xF2, 0x26, 0xF1, 0x23, 0xF2, 0x51, 0xD0, 0xF2, 0x28, 0xF3, 0x21,
+0xF1, 0xA0, 0x50, 0xF1, 0x20, 0xF2, 0x21, 0xF1, 0xC0, 0x02, 0xE0, 0x30, 0x0F, 0x22, 0x0F, 0x25,
+0xB0, 0x90, 0x00, 0x60, 0x90, 0x40, 0x70, 0xD0, 0xF0, 0x23, 0xF1, 0x50, 0xF0, 0xD0, 0xF0, 0x23,
+0xF1, 0x23, 0xF0, 0xD0, 0x80, 0x90, 0xD0, 0x22, 0xF1, 0x50, 0xD0, 0xF2, 0x22, 0xF2, 0x25, 0xF0,
+0xD0, 0xF0, 0x50, 0xF1, 0x23, 0xF3, 0x21, 0xF0, 0x21, 0xD0, 0x50, 0xA1, 0x50, 0xF6, 0x21, 0xF2,
+0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF2, 0xA1, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0xD0, 0xA1, 0xF0,
+0x27, 0xD0, 0xA1, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x50, 0xF0, 0x23, 0xF0, 0x22, 0xF0, 0x50, 0xF1,
+0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x20, 0x50, 0xD0, 0xF0, 0x22, 0xF3,
+0xD0, 0x50, 0xF0, 0x21, 0xD0, 0x30, 0x13, 0x70, 0x60, 0xB0, 0x00, 0x90, 0x30, 0xD0, 0xF1, 0x21,
+0xF1, 0x50, 0xF1, 0x30, 0x71, 0x90, 0xF2, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x23, 0xF4, 0xD0, 0x50,
+0xF2, 0x20, 0xF0, 0x20, 0xF5, 0x50, 0xA0, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xF4,
+0xA0, 0x50, 0xD0, 0xF1, 0x25, 0xF1, 0x23, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0xD1, 0xF0, 0x20, 0xF0,
+0x27, 0xF3, 0x23, 0xF0, 0xA0, 0x50, 0xF0, 0xD0, 0x20, 0xF3, 0xD0, 0x70, 0xE0, 0x90, 0xB0, 0x00,
+0x70, 0x00, 0x40, 0xB0, 0x0F, 0x20, 0x0F, 0x26, 0xE0, 0x90, 0x30, 0x01, 0x40, 0x30, 0xD0, 0xF2,
+0xD0, 0xA0, 0x50, 0xF0, 0x20, 0xD0, 0xF1, 0x24, 0xF1, 0x20, 0xF1, 0x20, 0xD0, 0x50, 0xF1, 0x20,
+0xF0, 0xA0, 0x50, 0xF4, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF2, 0x50, 0xA0, 0xD0, 0xF1,
+0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x50, 0xA0, 0xD0,
+0xF0, 0x21, 0xF4, 0x50, 0xF3, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x22, 0xF1, 0x22, 0xF1,
+0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xD0, 0x50, 0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF0, 0xA1, 0xF0,
+0x26, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF2, 0x50,
+0xD0, 0xF0, 0x22, 0xF3, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xD0, 0x30, 0x11, 0x91, 0xE0, 0x00, 0x60,
+0xE0, 0x10, 0xD0, 0xF1, 0x23, 0xF0, 0xD0, 0x80, 0xC0, 0x11, 0xC0, 0x90, 0xD0, 0xF0, 0x22, 0xD0,
+0xA1, 0xD0, 0xF0, 0x23, 0xF3, 0x20, 0xF1, 0xA0, 0xF0, 0xD3, 0xF3, 0xA0, 0x50, 0xF1, 0xD0, 0x50,
+0xF2, 0x27, 0xF4, 0xA0, 0x50, 0xD0, 0xF1, 0x23, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x50,
+0x20, 0xF3, 0x25, 0xF6, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x90,
+0x60, 0x01, 0x30, 0x70, 0x00, 0x80, 0x60, 0x30, 0x0F, 0x20, 0x0F, 0x27, 0x80, 0xE0, 0x02, 0xC0,
+0x50, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xF1, 0x21, 0xF2, 0x23, 0xF2, 0x20, 0xF2, 0xD0, 0x20, 0xF0,
+0xD0, 0xF0, 0x50, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x24, 0xF2, 0x20, 0xD0, 0xA1, 0xD0, 0xF1, 0x20,
+0xF1, 0x24, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0x21, 0xF1, 0xA0, 0x50, 0x20, 0xF1, 0x20, 0xF1, 0xD0,
+0xA0, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0x20, 0x50, 0xD0, 0xF0, 0x23, 0xF0,
+0x22, 0xF1, 0xA0, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF1, 0x23, 0xF0,
+0xA1, 0xF0, 0x26, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23,
+0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF3, 0xD0, 0xA0, 0xF2, 0xD0, 0x70, 0x13, 0x80, 0x40, 0x80, 0x30,
+0x10, 0xD0, 0x24, 0xF1, 0xD0, 0x50, 0x30, 0x50, 0x80, 0xF0, 0xD0, 0xF0, 0x24, 0xF0, 0x50, 0xF2,
+0x22, 0xF2, 0x21, 0xF1, 0x50, 0xF0, 0xA0, 0xC0, 0x10, 0xA0, 0xD1, 0xF0, 0x50, 0xA0, 0xD0, 0xF0,
+0x20, 0xF0, 0x20, 0x50, 0xD0, 0xF0, 0x22, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xD0, 0xF1,
+0x21, 0xF1, 0x21, 0xF3, 0x21, 0xF1, 0xD0, 0xA0, 0x50, 0xF0, 0xD0, 0xF2, 0x23, 0xF1, 0x23, 0xF4,
+0x20, 0xF1, 0x50, 0xA0, 0xF1, 0xD0, 0x80, 0xC0, 0x02, 0x80, 0x40, 0x00, 0x40, 0x81, 0x0F, 0x20,
+0x0F, 0x25, 0x60, 0xE0, 0x00, 0x90, 0xB0, 0x60, 0x90, 0x00, 0x90, 0xA0, 0xD0, 0x50, 0xA0, 0xD0,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x26, 0xF2, 0x20, 0xF1, 0xD0, 0xF0, 0x50, 0xF2, 0x24, 0xF1, 0x23,
+0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xF3, 0xA1, 0xF1, 0xD0,
+0xF2, 0x20, 0x51, 0xF4, 0x50, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x21, 0xD0, 0x50, 0x20,
+0xF1, 0x26, 0xF0, 0xD0, 0xA1, 0xF0, 0x24, 0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0x21, 0xF1, 0x23, 0xF0,
+0xA1, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20,
+0xF1, 0x23, 0xF1, 0x50, 0xF1, 0x22, 0xF4, 0xA1, 0xF0, 0xD1, 0x50, 0x13, 0xC0, 0x80, 0x90, 0x11,
+0xD0, 0x25, 0xD0, 0xF0, 0xA1, 0xD1, 0x27, 0xF0, 0xA1, 0xD0, 0xF2, 0x24, 0xF3, 0x50, 0xD0, 0x50,
+0x10, 0x80, 0xD0, 0x51, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xA1, 0xF1, 0x21, 0xF3, 0x22, 0xF0, 0x22,
+0xD0, 0x50, 0xA0, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50,
+0xF3, 0x20, 0xF0, 0x21, 0xF1, 0x23, 0xF2, 0x21, 0xF0, 0xD0, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x80,
+0x30, 0xB0, 0x70, 0x00, 0xE0, 0x30, 0x02, 0xB0, 0x0F, 0x21, 0x0F, 0x25, 0x91, 0x70, 0x00, 0xC0,
+0x30, 0x02, 0x70, 0x50, 0xF5, 0x21, 0xF1, 0x21, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xF0,
+0x50, 0xF0, 0xD0, 0x26, 0xF1, 0x23, 0xF2, 0xD0, 0xA0, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x25,
+0xF1, 0xD0, 0xA1, 0xF1, 0x22, 0xF2, 0xD0, 0xA0, 0x50, 0xA0, 0xD1, 0xA1, 0xF0, 0x21, 0xF1, 0x21,
+0xF2, 0x20, 0xF1, 0x50, 0xD0, 0x22, 0xF2, 0x22, 0xF0, 0xD0, 0x50, 0xF1, 0x24, 0xF1, 0x20, 0xF0,
+0xA0, 0xF1, 0x21, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x23, 0xF2, 0xA0, 0xD0, 0xF0,
+0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0x50, 0xF1, 0x22, 0xF1, 0x20, 0xF1,
+0xA1, 0xD0, 0xF1, 0xD0, 0x15, 0xC0, 0x60, 0x10, 0xF0, 0xD1, 0xF4, 0xD0, 0xF0, 0x50, 0xD0, 0x28,
+0xF1, 0x50, 0xF4, 0x23, 0xF2, 0xD0, 0xA1, 0xD0, 0xA1, 0x50, 0xF0, 0xD0, 0xF1, 0x23, 0xF0, 0xD0,
+0x50, 0x20, 0xF1, 0x20, 0xF3, 0x22, 0xF1, 0x22, 0xD0, 0x50, 0xF3, 0x23, 0xF1, 0x20, 0xF0, 0x20,
+0xF0, 0x22, 0xF2, 0x50, 0xD0, 0xF2, 0x22, 0xF2, 0x23, 0xF4, 0x20, 0xF1, 0xD0, 0xA0, 0x50, 0x70,
+0x02, 0x91, 0x00, 0x70, 0xC1, 0x60, 0x0F, 0x21, 0x0F, 0x27, 0x80, 0x40, 0x00, 0x90, 0x01, 0x90,
+0x10, 0xC0, 0xD0, 0xF3, 0x21, 0xF9, 0x23, 0xD0, 0xA0, 0x50, 0xF1, 0x21, 0xF1, 0x23, 0xF1, 0x24,
+0xF2, 0x50, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0xD0, 0xF0, 0x50, 0xF3, 0x20, 0xF0,
+0x20, 0xF4, 0xA0, 0x50, 0xA0, 0x50, 0xD0, 0x20, 0xF1, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0,
+0xA1, 0xF0, 0x22, 0xF3, 0x21, 0xF1, 0xA0, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0x50, 0xF1, 0x20, 0xF1,
+0x23, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xA1, 0xD0, 0xF0, 0x20, 0xF0,
+0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x21, 0x50,
+0xD0, 0xF1, 0xD0, 0xA0, 0x14, 0x70, 0x80, 0xE0, 0x70, 0x50, 0xD1, 0xF3, 0x20, 0xF0, 0x50, 0xF0,
+0xD0, 0x22, 0xF3, 0x20, 0xF1, 0xA1, 0xD0, 0xF3, 0x23, 0xF2, 0xD0, 0x50, 0xA0, 0x50, 0xA0, 0xF2,
+0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF1, 0x50, 0xD0, 0x20, 0xF2, 0x25, 0xF0, 0x21, 0xF2, 0x50, 0xF2,
+0x23, 0xF2, 0x22, 0xF0, 0x21, 0xF3, 0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF2, 0x23, 0xF0, 0x20, 0xF1,
+0x21, 0xF1, 0xD0, 0xC0, 0x10, 0x80, 0x01, 0x90, 0x00, 0x80, 0x40, 0x00, 0x60, 0xC0, 0x40, 0x0F,
+0x20, 0x0F, 0x21, 0x60, 0x81, 0xE0, 0x61, 0x70, 0x60, 0x00, 0xE0, 0x30, 0x70, 0x10, 0x80, 0xE0,
+0x90, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF9, 0x20, 0xF2, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x23,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0xD0, 0x22, 0xF0, 0x20, 0xF0, 0x25, 0xF2, 0x50, 0xF1, 0x26, 0xF0,
+0x20, 0xF3, 0x51, 0xF0, 0xD0, 0xF3, 0x23, 0xF0, 0x21, 0x50, 0xD0, 0xF0, 0x22, 0xF3, 0x21, 0xD0,
+0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0,
+0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xA1, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x50,
+0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xA1, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x50, 0xD0, 0xF0,
+0x21, 0xD0, 0x50, 0x70, 0x13, 0x90, 0x10, 0x71, 0xC0, 0x70, 0xC0, 0xF1, 0x21, 0xF0, 0xA1, 0xD0,
+0xF2, 0x20, 0xF2, 0x21, 0xF1, 0x50, 0xD0, 0xF3, 0x23, 0xF1, 0xD0, 0xF0, 0x51, 0xF0, 0xD0, 0xF0,
+0x20, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0xA0, 0x50, 0xD0, 0xF2, 0x27, 0xF0, 0x21, 0xF1, 0x50, 0xF1,
+0x23, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF4, 0x50, 0xF0, 0xD0, 0xF1, 0x22, 0xF1, 0x24, 0xF1,
+0x22, 0xF0, 0xD0, 0x90, 0x60, 0x90, 0x10, 0x91, 0xB0, 0x00, 0x40, 0x30, 0x02, 0xC0, 0x60, 0x0F,
+0x1F, 0x0F, 0x21, 0x40, 0x10, 0x40, 0x30, 0x71, 0x40, 0x00, 0x40, 0x00, 0x40, 0x10, 0xE0, 0x01,
+0x80, 0x30, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x50,
+0xF1, 0x22, 0xF1, 0x24, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x50, 0xF4, 0x21, 0xF1, 0x24, 0xF1, 0xD0,
+0xA1, 0xF3, 0x23, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0x50, 0xA0, 0x50, 0xA0, 0xF3, 0x24, 0xD0, 0xA1,
+0xF3, 0x20, 0xF3, 0x20, 0xF1, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF1,
+0x22, 0xF1, 0x20, 0xF2, 0x50, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0xA0, 0x20, 0xF1, 0x20, 0xF0,
+0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xA1, 0xF3, 0x24, 0xF0, 0x50, 0xF2, 0x20, 0xF0,
+0xD1, 0x80, 0xC0, 0x11, 0x70, 0x11, 0x30, 0xA0, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF1,
+0x20, 0xF3, 0x21, 0xF1, 0xA1, 0xF0, 0x22, 0xF1, 0x20, 0xF2, 0xA0, 0x50, 0xA0, 0x50, 0xF0, 0x21,
+0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20,
+0xF2, 0x23, 0xF1, 0x50, 0xF0, 0x24, 0xF0, 0x24, 0xF3, 0x20, 0xF2, 0x50, 0xF0, 0xD0, 0xF3, 0x27,
+0xF1, 0x20, 0xF0, 0xD0, 0x90, 0x40, 0x01, 0x80, 0x10, 0x60, 0x02, 0xC0, 0x40, 0x01, 0xE0, 0x30,
+0x0F, 0x1F, 0x0F, 0x22, 0x80, 0x30, 0x03, 0x40, 0x30, 0x70, 0x00, 0x80, 0x60, 0x00, 0xB0, 0x90,
+0x30, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xD0, 0x20, 0xF1, 0x50, 0xD0, 0x23, 0xF2,
+0x22, 0xF0, 0x23, 0xF3, 0x50, 0xA0, 0xF0, 0x22, 0xF1, 0x27, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF3,
+0x23, 0xF2, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0xD0, 0xF2, 0x21, 0xF1, 0x50,
+0xF0, 0x20, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xD0,
+0x50, 0x20, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0xA1, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0x50, 0xF2,
+0x20, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0xA1, 0xF3, 0x24, 0xF0, 0xA1, 0xD0,
+0x22, 0xF1, 0xD2, 0x50, 0x80, 0x90, 0xD1, 0xF0, 0x26, 0xD0, 0xA1, 0xF1, 0x20, 0xF2, 0x23, 0xF0,
+0xD0, 0x50, 0xF0, 0x22, 0xF3, 0xA0, 0x50, 0xA0, 0xD1, 0xF0, 0x50, 0x20, 0xF0, 0x21, 0xF2, 0x21,
+0xF0, 0x22, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0xA1, 0xD0,
+0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF4, 0x21, 0xF1, 0x20, 0x50, 0xD2, 0x21, 0xF0, 0x20, 0xF0, 0x24,
+0xF2, 0xD0, 0x31, 0x90, 0x01, 0x41, 0xB0, 0xC0, 0x10, 0x40, 0x00, 0x71, 0x60, 0x90, 0x40, 0x0F,
+0x1F, 0x0F, 0x23, 0x90, 0x80, 0x04, 0x40, 0x80, 0x00, 0x90, 0x40, 0x90, 0x01, 0x30, 0x50, 0xD0,
+0x28, 0xF1, 0x20, 0xF1, 0x50, 0xF1, 0x22, 0xF3, 0x22, 0xF1, 0x23, 0xD0, 0xF0, 0xA1, 0xF0, 0x20,
+0xF4, 0x26, 0xF2, 0x50, 0xF0, 0xD0, 0xF3, 0x21, 0xF3, 0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0xF3, 0xA0,
+0x50, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0xA1, 0xD0, 0x25, 0xF2, 0x20, 0xF0, 0x50, 0xF1, 0x21, 0xF0,
+0x21, 0xF0, 0x21, 0xF1, 0x50, 0xF3, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF3, 0x23, 0xF1, 0xD0,
+0x50, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0xA1, 0xF3, 0x24, 0xF0,
+0xA1, 0xF0, 0x23, 0xF3, 0xD1, 0xA0, 0xD0, 0xF1, 0x26, 0xD0, 0xF0, 0x50, 0xD0, 0xF2, 0x24, 0xF2,
+0xA1, 0xF0, 0x21, 0xD0, 0xF0, 0xA0, 0x50, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0, 0x50, 0xF1, 0x23, 0x50,
+0x22, 0xF0, 0x22, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xF2, 0xA1, 0xD0, 0x22, 0xF0,
+0x23, 0xF3, 0x22, 0xF1, 0xD0, 0xF0, 0x50, 0xF3, 0x23, 0xF0, 0x22, 0xF1, 0xD0, 0x30, 0x80, 0x01,
+0x70, 0x81, 0x00, 0xC0, 0xB1, 0xC0, 0x80, 0xB0, 0xE0, 0x90, 0x40, 0x0F, 0x20, 0x0F, 0x25, 0x80,
+0x40, 0x00, 0x90, 0x30, 0xC0, 0xE0, 0x01, 0x70, 0xB0, 0x01, 0x60, 0xC0, 0x50, 0xD0, 0x22, 0xF0,
+0x25, 0xF0, 0x20, 0x50, 0xF0, 0x24, 0xF3, 0x21, 0xF2, 0x22, 0xF1, 0xA1, 0xD0, 0xF0, 0x20, 0xF4,
+0x25, 0xF1, 0xD0, 0xA1, 0xD0, 0xF1, 0x23, 0xF2, 0x21, 0xF2, 0x50, 0xF2, 0x21, 0xF2, 0xA0, 0x50,
+0xA0, 0xF0, 0xD1, 0x50, 0xF0, 0xD0, 0x24, 0xF4, 0x20, 0x50, 0xD0, 0x22, 0xF0, 0x22, 0xF0, 0x20,
+0xF1, 0x50, 0xF2, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xD0, 0x25, 0xF2, 0xD0, 0x50, 0xF1, 0x21,
+0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x23, 0xF2, 0xA0, 0xF3, 0x24, 0xF1, 0x50, 0xF0, 0x26,
+0xF1, 0xD0, 0x50, 0xF1, 0x26, 0xF1, 0xD0, 0x50, 0xF2, 0x25, 0xF0, 0x20, 0xF1, 0x50, 0xF2, 0xA0,
+0x50, 0xA0, 0xF1, 0x21, 0xF3, 0x50, 0xF0, 0x23, 0x50, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xD0,
+0xA1, 0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x25, 0xF1, 0x50, 0xA0, 0xF0, 0x20, 0xF0, 0x24,
+0xF2, 0x22, 0xF2, 0x20, 0xF1, 0x50, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xC0, 0x02,
+0x60, 0x90, 0x01, 0x70, 0xB0, 0xE0, 0x70, 0x40, 0x10, 0xB0, 0x0F, 0x22, 0x0F, 0x25, 0x70, 0xB0,
+0x00, 0x40, 0x90, 0xB0, 0x00, 0x60, 0x00, 0xB0, 0x90, 0x00, 0x60, 0x90, 0xB0, 0x70, 0xA0, 0xF1,
+0x20, 0xF0, 0x21, 0xF4, 0x50, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF1,
+0x20, 0xF1, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x26, 0xF1, 0xD0, 0xF0, 0x50, 0xF1, 0x20, 0xF1,
+0x21, 0xF3, 0x21, 0xF0, 0xD0, 0xA1, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x21, 0xA0, 0x50, 0xA2, 0xD0,
+0xF2, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0x22, 0xF0, 0x24, 0xF0, 0xA1, 0xF0,
+0x24, 0xF1, 0x20, 0xF1, 0x50, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x50, 0xF0,
+0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x24, 0xF1, 0xA0, 0xF1, 0x26, 0xF1, 0x50, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x20, 0xF4, 0x22, 0xF1, 0xD0, 0xA1,
+0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF1, 0xA2, 0x50, 0xA0, 0xF0, 0xD0, 0x20, 0xF0, 0x21, 0xF2, 0xD0,
+0xA1, 0xF3, 0x21, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0x50, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF1,
+0x22, 0xF1, 0x50, 0xF2, 0x28, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xF2, 0x21,
+0xF2, 0x20, 0xF0, 0xD0, 0x50, 0x90, 0xB0, 0x90, 0x01, 0x70, 0xB0, 0xE0, 0x00, 0xB0, 0x03, 0x81,
+0x0F, 0x22, 0x0F, 0x25, 0x40, 0x90, 0xE0, 0x10, 0x61, 0x10, 0x90, 0xC0, 0xE0, 0x00, 0x70, 0x30,
+0x02, 0x70, 0xF0, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xD0, 0x20, 0x50, 0xF0, 0xD0, 0x21, 0xF3, 0x22,
+0xF2, 0x21, 0xF3, 0x20, 0x50, 0xF0, 0xD0, 0x23, 0xF1, 0x25, 0xF1, 0xD1, 0x50, 0xF3, 0x23, 0xF3,
+0x21, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF1, 0xD0, 0xA0, 0x80, 0xA0, 0xD1, 0xF1, 0x22,
+0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x25, 0xF0, 0x21, 0xF0, 0x50, 0xF0, 0xD0, 0x24, 0xF1, 0x20, 0xF1,
+0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0,
+0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x25, 0xF2, 0x50, 0xD0, 0x20, 0xF2, 0x21, 0xF1,
+0x20, 0xF1, 0x50, 0xD0, 0xF4, 0x24, 0xF0, 0x50, 0xD0, 0xF0, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0xA0,
+0x50, 0xA0, 0xF0, 0xD0, 0xF2, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xF3, 0x20, 0xF0, 0x21, 0xF1,
+0x20, 0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0x20, 0xF1, 0x23, 0xF2, 0x23, 0xF2, 0x50, 0xD0, 0xF2,
+0x28, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x50, 0xD0, 0xF2, 0x22, 0xF0, 0xD0, 0x50, 0x90, 0x02, 0x90,
+0x70, 0x00, 0xB0, 0x10, 0x80, 0x02, 0x60, 0xB0, 0x70, 0x60, 0x0F, 0x22, 0x0F, 0x26, 0xE0, 0x30,
+0x60, 0x40, 0xC0, 0xB0, 0x00, 0xB0, 0x90, 0x00, 0xB0, 0x90, 0x01, 0xB0, 0x90, 0x70, 0xF0, 0xD0,
+0xF1, 0x20, 0xF1, 0xA0, 0x50, 0xF6, 0x20, 0xF0, 0x24, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xF1,
+0x20, 0xF0, 0x20, 0xF1, 0x26, 0xF1, 0xD0, 0xF0, 0x50, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x22, 0xF1, 0xD0, 0x50, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xA2, 0x50, 0xA0,
+0xF1, 0xD0, 0xF2, 0x21, 0xF0, 0xA1, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0x50, 0xD0,
+0xF0, 0x24, 0xF1, 0x20, 0xF0, 0xA1, 0xF0, 0x21, 0xF0, 0x24, 0xF1, 0x50, 0xF0, 0x22, 0xF0, 0x22,
+0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x50, 0xF1, 0x25, 0xF1, 0xD0, 0x50, 0xF0,
+0x20, 0xF1, 0x26, 0xF0, 0x50, 0xD0, 0xF0, 0x27, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF3, 0xD0, 0xF0,
+0x51, 0xA0, 0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF1, 0x22, 0xF2, 0xA1, 0xD0, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x23,
+0xF0, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF2, 0x26, 0xF0, 0x22, 0xF0, 0x21, 0xF2, 0x50, 0xF0, 0xD0,
+0xF0, 0x22, 0xD0, 0xA0, 0x70, 0x90, 0x02, 0x90, 0xB0, 0x00, 0x60, 0x90, 0x30, 0x70, 0x01, 0x80,
+0xC0, 0xE0, 0x0F, 0x23, 0x0F, 0x28, 0xB0, 0xC0, 0xB0, 0x01, 0x30, 0x80, 0x00, 0x60, 0xE0, 0x30,
+0x60, 0x90, 0x00, 0x60, 0x70, 0xD1, 0xF0, 0x20, 0xD0, 0x20, 0x50, 0xF1, 0x20, 0xF6, 0x24, 0xF1,
+0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF3, 0x27, 0xF3, 0x50, 0xF1, 0x23, 0xF2, 0x23, 0xF1, 0xA0, 0x50,
+0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x50, 0xF0, 0xD0, 0xF0, 0xA0, 0x50, 0xA1,
+0xF3, 0x21, 0xA1, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xA1, 0xF2, 0x26, 0xF0, 0xA1, 0xD0,
+0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x50, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xD0, 0xA1, 0xF2, 0x22, 0xF0,
+0x21, 0xF1, 0x50, 0xF0, 0x25, 0xF1, 0x20, 0xD1, 0xA1, 0xF1, 0x21, 0xF0, 0xD0, 0xA0, 0x31, 0xA0,
+0xF0, 0xD0, 0xF0, 0x50, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF3,
+0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x50, 0xF3, 0x26, 0xF0, 0x23, 0xF1, 0xA0, 0x50,
+0xD0, 0xF2, 0x25, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0x50, 0xF0, 0xD0, 0xF2, 0xA0, 0x70, 0x00, 0xB0,
+0x90, 0xB0, 0x90, 0x60, 0x01, 0xB0, 0x40, 0x00, 0x80, 0x70, 0xB0, 0x0F, 0x26, 0x0F, 0x28, 0x80,
+0x40, 0x01, 0x80, 0x70, 0xB0, 0x81, 0x60, 0x40, 0xC0, 0x02, 0xE0, 0xC0, 0xD0, 0xF2, 0x50, 0xF3,
+0x22, 0xF3, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xA1, 0xF1, 0x21, 0xF2, 0x27, 0xF2, 0x50,
+0xF1, 0x23, 0xF3, 0x22, 0xF0, 0x20, 0xD0, 0x50, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0xA1,
+0xF1, 0x20, 0xF1, 0xA1, 0x50, 0xA0, 0xF2, 0xD0, 0x50, 0xF1, 0x22, 0xF3, 0x21, 0xD0, 0xA1, 0xF0,
+0x20, 0xF2, 0x24, 0xF0, 0x50, 0xF3, 0x20, 0xF1, 0x22, 0xF1, 0x50, 0xF0, 0x22, 0xF0, 0x22, 0xF2,
+0x50, 0xF0, 0x26, 0xF1, 0xD0, 0x50, 0xF0, 0x21, 0xF3, 0x20, 0xF2, 0x20, 0x50, 0xD0, 0xF3, 0x20,
+0xF4, 0xA1, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0xC0, 0x50, 0xD0, 0x50, 0xD0, 0xF0, 0xD0,
+0xF0, 0xA0, 0x50, 0xA1, 0x50, 0xF2, 0xD0, 0x50, 0xF1, 0x24, 0xF1, 0x23, 0xF1, 0x50, 0xD0, 0xF1,
+0x22, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x50, 0xD0, 0xF1, 0x26, 0xF2, 0x23, 0xF0, 0x50, 0xA0, 0xF5,
+0x20, 0xF0, 0x28, 0xF3, 0x50, 0xF1, 0xD0, 0xF0, 0xC0, 0xB0, 0x02, 0x10, 0x60, 0x06, 0x40, 0x70,
+0x0F, 0x26, 0x0F, 0x28, 0xB0, 0xC0, 0x40, 0x71, 0x01, 0x30, 0x80, 0x40, 0x00, 0x40, 0x80, 0x00,
+0xB0, 0x70, 0x60, 0x70, 0xD0, 0xF0, 0x50, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1,
+0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x21, 0xF2, 0x22, 0xF2, 0x21, 0xF1, 0xD0, 0x50, 0xA0, 0xF1, 0x23,
+0xF1, 0x22, 0xF0, 0x21, 0xD0, 0xA1, 0xF1, 0x22, 0xF0, 0x23, 0xF2, 0xD0, 0x50, 0xF0, 0xD0, 0x23,
+0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0xF0, 0xA1, 0xD0, 0xF1, 0x22, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xF1,
+0x21, 0xF1, 0x23, 0xF1, 0x50, 0xF5, 0x23, 0xF0, 0xA1, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x50, 0xF0,
+0x26, 0xF1, 0xD0, 0x50, 0xF0, 0x21, 0xF2, 0x21, 0xF3, 0x50, 0xD0, 0xF4, 0x21, 0xF2, 0xA1, 0xD3,
+0xA1, 0xF0, 0xD0, 0x52, 0xD0, 0xA0, 0xF1, 0x51, 0xA0, 0xD1, 0xF2, 0x20, 0xF2, 0x50, 0xD0, 0xF0,
+0x23, 0xF1, 0x23, 0xF0, 0xD0, 0x50, 0xA0, 0xF2, 0x22, 0xF1, 0x23, 0xF1, 0xD0, 0xA0, 0x50, 0xD0,
+0x26, 0xF4, 0x23, 0xD0, 0x50, 0xF2, 0x22, 0xF0, 0x28, 0xF3, 0xD0, 0xF0, 0x50, 0xD1, 0x70, 0x60,
+0x70, 0x01, 0x30, 0xE0, 0x0F, 0x30, 0x0F, 0x29, 0xB0, 0x80, 0x60, 0x03, 0x60, 0x02, 0x80, 0x31,
+0x01, 0xB0, 0x70, 0x50, 0xD0, 0xF0, 0x21, 0xF4, 0x26, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xA0, 0x50,
+0xF2, 0x20, 0xF1, 0x24, 0xF1, 0x22, 0xF0, 0xD0, 0xA1, 0xD0, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0x20,
+0xF2, 0x50, 0xF3, 0x21, 0xF1, 0x21, 0xF3, 0xA1, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0xD0, 0xF0, 0x51,
+0xA0, 0xF0, 0xD1, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0x50, 0xD0, 0x20, 0xF3, 0x23, 0xF1, 0x50, 0xD0,
+0xF4, 0x23, 0xF0, 0xA1, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0x50, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0xD0,
+0xA0, 0x20, 0xF4, 0x22, 0xF2, 0x50, 0xD0, 0x21, 0xF1, 0x24, 0xD1, 0x50, 0xD0, 0x31, 0xC1, 0x30,
+0xD4, 0xF0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xF1,
+0x23, 0xF1, 0x23, 0xF0, 0x20, 0xD0, 0x50, 0xF2, 0x22, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0xA1, 0xD0,
+0x20, 0xF0, 0x23, 0xF3, 0x22, 0xF0, 0x20, 0xD0, 0xF0, 0x50, 0xF2, 0x22, 0xF5, 0x22, 0xF0, 0x20,
+0xD0, 0xF2, 0xD0, 0x80, 0x70, 0x02, 0x90, 0x30, 0x40, 0x0F, 0x31, 0x0F, 0x35, 0x30, 0x80, 0x01,
+0xB0, 0x70, 0x90, 0xD0, 0xF8, 0x26, 0xF2, 0x20, 0x50, 0xF2, 0x20, 0xF2, 0x24, 0xF1, 0x21, 0xF2,
+0x50, 0xD0, 0x20, 0xF2, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xA1, 0xF0, 0x20, 0xF1, 0x25,
+0xF2, 0xD0, 0x50, 0xF2, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xA0, 0x51, 0xA0, 0x20,
+0xF6, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0xA0, 0xD0, 0xF5, 0x22, 0xD0, 0xA1, 0xF1,
+0x21, 0xF1, 0x21, 0xF2, 0x50, 0xF0, 0x20, 0xF1, 0x20, 0xF4, 0xD0, 0xA1, 0xF3, 0x24, 0xF1, 0x50,
+0xF0, 0x21, 0xF1, 0x24, 0xD0, 0x50, 0x30, 0x70, 0xC0, 0x30, 0xA1, 0x50, 0x30, 0xF1, 0xA0, 0x50,
+0xA1, 0x50, 0xD0, 0xF2, 0x20, 0xF3, 0x21, 0xF1, 0xA1, 0xD0, 0xF0, 0x2A, 0xD0, 0xA1, 0xD0, 0xF0,
+0x22, 0xF1, 0x21, 0xF2, 0x20, 0xF2, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x24, 0xF2, 0xD0, 0xF0,
+0x50, 0xF1, 0x22, 0xF5, 0x22, 0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0x70, 0x90, 0x02, 0x30, 0x40, 0x0F,
+0x32, 0x0F, 0x36, 0x80, 0x40, 0x00, 0x90, 0x00, 0x60, 0x70, 0xD0, 0xF1, 0x21, 0xF3, 0x26, 0xF1,
+0x20, 0x50, 0x22, 0xF0, 0x20, 0xF1, 0x24, 0xF2, 0x20, 0xF2, 0x50, 0xF1, 0x20, 0xF1, 0x26, 0xF0,
+0x20, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x23, 0xF0, 0x20, 0xF2, 0x50, 0xD0, 0xF0, 0x21, 0xF3,
+0x23, 0xF0, 0xA1, 0xD0, 0xF1, 0xA0, 0x51, 0xA0, 0xF0, 0xD0, 0xF1, 0xD0, 0xA0, 0xF1, 0x22, 0xF0,
+0x24, 0xF0, 0xA1, 0xD0, 0xF5, 0x22, 0xF0, 0xA0, 0xF1, 0x22, 0xF1, 0x21, 0xF2, 0x50, 0xF0, 0x20,
+0xF7, 0xD0, 0xA1, 0xF1, 0x27, 0xF0, 0x50, 0xF1, 0x20, 0xF2, 0x22, 0xD1, 0x50, 0x30, 0x80, 0x40,
+0x90, 0xC0, 0x11, 0x70, 0x50, 0xA1, 0xF1, 0xD0, 0xA0, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF0,
+0x21, 0xF1, 0x50, 0xF1, 0x25, 0xF1, 0x21, 0xF0, 0x20, 0xD0, 0x50, 0xF2, 0x23, 0xF4, 0x22, 0xF1,
+0x50, 0xD0, 0xF4, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xA0, 0x50, 0xD0,
+0xF0, 0x23, 0xF2, 0x22, 0xF1, 0x22, 0xD0, 0xA0, 0x70, 0x00, 0xB0, 0x90, 0x00, 0x80, 0x40, 0x0F,
+0x33, 0x0F, 0x37, 0x80, 0xC0, 0x02, 0xE0, 0xC0, 0xD1, 0xF6, 0x23, 0xF1, 0x20, 0xD0, 0x50, 0xA0,
+0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x21, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0x21, 0xF1,
+0x25, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0x50,
+0xF1, 0x22, 0xF2, 0x24, 0xD0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0xD1, 0xF0, 0xA0, 0x52, 0xF0, 0xD0,
+0x50, 0xF2, 0x20, 0xF2, 0x22, 0xF0, 0xD0, 0xA1, 0xF6, 0x22, 0xF0, 0x50, 0xF1, 0x22, 0xF1, 0x21,
+0xF2, 0x50, 0xF0, 0x20, 0xF4, 0x22, 0xF0, 0x20, 0xA0, 0xD0, 0xF0, 0x27, 0xF0, 0xA1, 0xF0, 0x21,
+0xF3, 0xD0, 0x80, 0x90, 0x70, 0x90, 0x70, 0x11, 0x70, 0x80, 0xE0, 0xD1, 0xF1, 0x20, 0xF1, 0x20,
+0x50, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xA1, 0xF1, 0x24, 0xF1, 0x22, 0xF1, 0xA0,
+0x50, 0xD0, 0xF1, 0x22, 0xF4, 0x23, 0xF0, 0xA1, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF1,
+0x20, 0xD0, 0x20, 0xD0, 0xA1, 0xD0, 0x20, 0xF0, 0x22, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xA0, 0xC0,
+0xB0, 0x01, 0xB0, 0xC0, 0x40, 0x0F, 0x34, 0x0F, 0x38, 0x80, 0x40, 0x00, 0xB0, 0x70, 0x60, 0x70,
+0xF4, 0x21, 0xF0, 0x22, 0xF0, 0x21, 0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x23,
+0xF2, 0x22, 0xF1, 0x50, 0xD0, 0xF1, 0x26, 0xF2, 0x20, 0xF1, 0xA1, 0xD0, 0x24, 0xF1, 0x21, 0xF0,
+0x20, 0xF2, 0x50, 0xD0, 0xF1, 0x20, 0xF3, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x20,
+0xF4, 0xD0, 0xF1, 0x51, 0x80, 0xA1, 0xF5, 0x20, 0xF1, 0xD0, 0x50, 0x20, 0xF0, 0x20, 0xF0, 0x21,
+0xF1, 0x20, 0xF1, 0xD0, 0x50, 0xF3, 0x20, 0xF1, 0x21, 0xF2, 0x50, 0xF0, 0x20, 0xF3, 0x23, 0xF1,
+0x50, 0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0x50, 0xF0, 0x21, 0xF0, 0xD2, 0x70, 0x11, 0xC0, 0x70,
+0x80, 0x40, 0xA0, 0x30, 0xF0, 0xD0, 0xF2, 0xD0, 0xF2, 0xD0, 0x50, 0xD0, 0x21, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x23, 0xD0, 0x50, 0xF2, 0x23, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x23,
+0xF2, 0x25, 0xD0, 0x50, 0xF0, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x20,
+0xD0, 0x50, 0xA0, 0xD0, 0xF0, 0x24, 0xF1, 0x21, 0xF0, 0x20, 0xD0, 0xA0, 0x70, 0x60, 0x70, 0x01,
+0x80, 0x40, 0x0F, 0x35, 0x0F, 0x39, 0x81, 0x30, 0x01, 0xB0, 0x70, 0xA0, 0xF2, 0x20, 0xF7, 0xA1,
+0xD0, 0xF4, 0x25, 0xF3, 0x20, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x25, 0xF4, 0xD0, 0x50, 0xD0, 0xF0,
+0x21, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xA1, 0xF0, 0x22, 0xF3, 0x21, 0xF2,
+0xA1, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0xD0, 0xA1, 0xF0, 0xA0, 0x51, 0xA0, 0xF4, 0xD1,
+0x50, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0x50, 0xD0, 0xF1, 0x21, 0xF1, 0x21, 0xF2,
+0x50, 0xF0, 0x21, 0xF3, 0x22, 0xF1, 0x50, 0xD0, 0xF2, 0x22, 0xF4, 0x50, 0xD0, 0xF0, 0xD1, 0x50,
+0x30, 0xA0, 0x30, 0x40, 0x90, 0x50, 0xE0, 0x80, 0xD3, 0xF6, 0x20, 0xF0, 0xA1, 0xF0, 0x23, 0xF0,
+0x24, 0xF0, 0xD0, 0xA1, 0xF1, 0x22, 0xF0, 0x24, 0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x23, 0xF1,
+0x20, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0x50, 0xF0, 0xD0, 0x22, 0xF0, 0x20, 0xF0, 0x25, 0xF0, 0x20,
+0xF1, 0xD0, 0x50, 0xA0, 0xD0, 0x24, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0x70, 0x01, 0xB0, 0x30, 0x80,
+0x40, 0x0F, 0x36, 0x0F, 0x3A, 0x30, 0x80, 0x01, 0xB0, 0x90, 0x70, 0xA0, 0xD0, 0xF2, 0x20, 0xF4,
+0xA0, 0x50, 0xD0, 0xF5, 0x24, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF4, 0x23, 0xF0, 0x21, 0xF1, 0x21,
+0xD0, 0xA1, 0xD0, 0x20, 0xF0, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x21, 0xF2,
+0x24, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x23, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0xF1, 0x20,
+0xA2, 0x51, 0xA1, 0xF0, 0x50, 0xD0, 0xF2, 0x24, 0xF2, 0x50, 0xD0, 0xF0, 0x27, 0xF1, 0x50, 0x23,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0xD1, 0xF0,
+0xD0, 0x50, 0xD1, 0xA0, 0x50, 0x31, 0x71, 0xC0, 0x10, 0x30, 0xD0, 0xF0, 0xA0, 0xF0, 0x21, 0xF3,
+0x20, 0xF0, 0x21, 0xF1, 0x50, 0xF1, 0x22, 0xF0, 0x22, 0xF4, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x24,
+0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0, 0xF1, 0x23, 0xF2, 0x22, 0xF2, 0xA1, 0xF1, 0x21, 0xF0,
+0x20, 0xF0, 0x24, 0xF2, 0x20, 0xF2, 0x50, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0x50, 0x91, 0x02,
+0x90, 0x40, 0x0F, 0x37, 0x0F, 0x3B, 0x81, 0x00, 0x70, 0x01, 0x70, 0xA0, 0xD0, 0xF2, 0x20, 0xF0,
+0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x22, 0xF2, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xA1, 0xF3,
+0x20, 0xF0, 0x25, 0xF4, 0x50, 0xF1, 0xD0, 0x27, 0xF0, 0x20, 0xF1, 0xA1, 0xF0, 0x21, 0xF3, 0x23,
+0xF1, 0xA1, 0xF0, 0x29, 0xF1, 0x50, 0xF5, 0xD2, 0xA2, 0x53, 0xA0, 0xF8, 0x50, 0xD0, 0xF8, 0xD0,
+0xF0, 0x50, 0xD0, 0x20, 0xF8, 0xD0, 0x50, 0xD1, 0xF2, 0xD1, 0xF1, 0xA0, 0x53, 0x70, 0xC0, 0x70,
+0xE0, 0x90, 0x10, 0x90, 0x50, 0xA0, 0xD0, 0xF1, 0x50, 0xF0, 0x29, 0xF1, 0x50, 0xF0, 0x20, 0xF2,
+0x23, 0xF4, 0xA1, 0xF3, 0x24, 0xF0, 0x20, 0xF3, 0x50, 0xF2, 0x24, 0xF1, 0x21, 0xF3, 0xD0, 0x50,
+0xF0, 0x2C, 0xF1, 0x20, 0xF2, 0x50, 0xD0, 0x23, 0xF2, 0xD0, 0x50, 0x90, 0x00, 0xB0, 0x70, 0x00,
+0x30, 0x40, 0x0F, 0x38, 0x0F, 0x3C, 0x40, 0x10, 0x02, 0xB0, 0xC0, 0x80, 0xD0, 0xF5, 0x50, 0xF0,
+0x20, 0xF5, 0x23, 0xF2, 0x21, 0xF2, 0x50, 0xD0, 0xF0, 0x20, 0xF3, 0x24, 0xF4, 0x50, 0xF1, 0x20,
+0xF1, 0x26, 0xF3, 0x50, 0xF1, 0x20, 0xF4, 0x24, 0xF0, 0x50, 0x26, 0xF0, 0x20, 0xF4, 0x50, 0xF0,
+0x22, 0xF2, 0x21, 0xF1, 0xD0, 0xA1, 0xD0, 0xF0, 0xA1, 0x53, 0xA3, 0x50, 0xF2, 0xD8, 0x50, 0xD9,
+0xF1, 0x50, 0xA3, 0x53, 0xA0, 0xF1, 0xD0, 0xA0, 0x12, 0xE0, 0xC0, 0xA0, 0xD3, 0xF0, 0xD0, 0xF0,
+0x50, 0xF0, 0x2A, 0xF0, 0xA1, 0xF3, 0x23, 0xF2, 0x20, 0xF1, 0x50, 0xF3, 0x23, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xD0, 0xA1, 0xF1, 0x24, 0xF2, 0x20, 0xF5, 0x50, 0xD0, 0xF1, 0x24, 0xF1, 0x25,
+0xF3, 0x50, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0x30, 0xC0, 0x02, 0x60, 0x10, 0xE0, 0x0F, 0x39, 0x0F,
+0x3D, 0x40, 0x30, 0x01, 0x90, 0x00, 0x30, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD0,
+0x22, 0xF2, 0x24, 0xF2, 0x22, 0xD0, 0x50, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x20, 0xF2,
+0x50, 0xF1, 0x21, 0xF2, 0x24, 0xF2, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x25, 0xF0, 0x50, 0xF0,
+0x22, 0xF0, 0x23, 0xF3, 0xA1, 0xF0, 0x29, 0xF0, 0xA0, 0xF2, 0xD3, 0xF2, 0xA2, 0x59, 0xA0, 0x52,
+0xA1, 0x5A, 0xA2, 0xF3, 0xD2, 0xF0, 0xD0, 0xA0, 0x40, 0x70, 0x30, 0x10, 0x30, 0x80, 0xF2, 0x20,
+0xF1, 0xD0, 0xA1, 0xF0, 0x25, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x50, 0xD0, 0xF3, 0x22, 0xF2,
+0x20, 0xF0, 0xD0, 0xA1, 0xD0, 0xF1, 0x23, 0xF2, 0x22, 0xF0, 0xD0, 0x50, 0xF3, 0x23, 0xF3, 0x21,
+0xF1, 0xD0, 0xF0, 0x50, 0xD0, 0xF1, 0x22, 0xF3, 0x23, 0xF0, 0x20, 0xF2, 0xA0, 0x50, 0xF3, 0xD0,
+0x30, 0x80, 0xB0, 0x90, 0x01, 0x90, 0x60, 0x0F, 0x3A, 0x0F, 0x3E, 0xE0, 0x91, 0x02, 0x31, 0xD2,
+0xA1, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x24, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xA1, 0xD0, 0x21, 0xF0,
+0x23, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF1, 0x23, 0xF2, 0x23, 0xF1, 0xD0, 0x50, 0xF1,
+0x20, 0xF2, 0x24, 0xF2, 0xA1, 0xF1, 0x20, 0xF4, 0x23, 0xF0, 0x50, 0xF1, 0x20, 0xF3, 0x22, 0xF0,
+0x20, 0xF0, 0x50, 0xF2, 0xD1, 0xF4, 0xD0, 0xF1, 0xA0, 0xD0, 0xF5, 0x22, 0xF0, 0xA0, 0x50, 0xF0,
+0x20, 0xF0, 0x50, 0xA0, 0x20, 0xF4, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0xD1, 0xF0, 0xA0, 0x90, 0x70,
+0x30, 0xE0, 0x80, 0x10, 0x00, 0xC0, 0x10, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x50, 0xD0,
+0x25, 0xF2, 0x20, 0xF1, 0x50, 0xF2, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xA0, 0xF1, 0x25, 0xF0,
+0x20, 0xF0, 0x21, 0xF1, 0xA1, 0xD0, 0xF2, 0x23, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0,
+0xD0, 0xF0, 0x22, 0xF3, 0x24, 0xF0, 0x20, 0xF2, 0xA1, 0xF0, 0xD1, 0x90, 0x80, 0x01, 0x60, 0x91,
+0xB0, 0x60, 0x40, 0x0F, 0x39, 0x0F, 0x3F, 0x60, 0x70, 0x02, 0x90, 0x80, 0x90, 0xD0, 0xA0, 0x50,
+0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x23, 0xF6, 0xA0, 0x50, 0xF2, 0x24, 0xF1, 0x21, 0xF4, 0xA0, 0x50,
+0xF0, 0x24, 0xF4, 0x21, 0xF0, 0xD0, 0xA1, 0xF0, 0x21, 0xF2, 0x24, 0xF1, 0xD0, 0x50, 0x20, 0xF6,
+0x20, 0xF0, 0x23, 0x50, 0xD0, 0x22, 0xF3, 0x23, 0xD0, 0x50, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x20,
+0xF1, 0xA1, 0xF0, 0x21, 0xF4, 0x20, 0xF1, 0xD0, 0x50, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF1,
+0x20, 0xF0, 0x50, 0xF0, 0x21, 0xF1, 0x30, 0xA1, 0x10, 0x80, 0x00, 0xC1, 0x80, 0x60, 0x01, 0x30,
+0x10, 0xF2, 0x23, 0xF0, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF3, 0x20, 0xF0, 0xA0, 0x50, 0xD0,
+0xF0, 0x24, 0xF0, 0x24, 0xD0, 0x50, 0xA0, 0xF0, 0x22, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0x20, 0xD0,
+0x50, 0xF3, 0x24, 0xF0, 0x24, 0xF2, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x23, 0xF0, 0x20, 0xF1,
+0x21, 0xF0, 0x50, 0xA0, 0xD0, 0x70, 0x40, 0x70, 0x02, 0x70, 0x00, 0xB0, 0x80, 0xE0, 0x40, 0x0F,
+0x38, 0x0F, 0x41, 0x70, 0x60, 0x90, 0x01, 0xE0, 0xC0, 0x50, 0xD0, 0xF0, 0x23, 0xF2, 0x21, 0xF3,
+0x20, 0xF1, 0x20, 0xD0, 0x50, 0xF2, 0x20, 0xF1, 0x25, 0xF1, 0x21, 0xF0, 0x20, 0x50, 0xD0, 0xF0,
+0x20, 0xF0, 0x21, 0xF5, 0x21, 0xF0, 0xD0, 0x50, 0xF0, 0x20, 0xF4, 0x24, 0xF2, 0x50, 0xD0, 0xF3,
+0x25, 0xF1, 0xA1, 0xD0, 0x22, 0xF1, 0x22, 0xF0, 0x22, 0x50, 0xD0, 0xF0, 0x20, 0xF2, 0x23, 0xF1,
+0xA1, 0xF1, 0x23, 0xF1, 0x21, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x25, 0xF0, 0xA1, 0xD0, 0xF0, 0xD0,
+0x50, 0x10, 0x30, 0xA0, 0xC0, 0xB0, 0x00, 0x10, 0x40, 0xE0, 0x02, 0x71, 0xD0, 0x20, 0xF0, 0x23,
+0xD0, 0x50, 0xF4, 0x23, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x2A, 0xF0, 0xA1, 0xF0, 0x22, 0xF4,
+0x20, 0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF1, 0x25, 0xF2, 0x22, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF0,
+0x24, 0xF0, 0x20, 0xF3, 0x23, 0xF1, 0xD0, 0x50, 0x10, 0x01, 0xB0, 0x90, 0x60, 0x90, 0x00, 0xB0,
+0x00, 0x80, 0x30, 0x60, 0x0F, 0x38, 0x0F, 0x3D, 0xB0, 0x90, 0x70, 0x40, 0x00, 0x70, 0x40, 0x01,
+0x90, 0x10, 0x70, 0xA0, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF3, 0x20, 0xF1, 0xD0, 0xA1, 0xF1,
+0x22, 0xF2, 0x22, 0xF0, 0xD1, 0x20, 0xF1, 0xA1, 0xD0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x20,
+0xF0, 0xA1, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x22, 0xF2, 0xA1, 0xF0, 0x20, 0xF1, 0x26, 0xF1, 0xA1,
+0xF1, 0x23, 0xF0, 0x23, 0xF0, 0xA1, 0xD0, 0x27, 0xF2, 0xA1, 0xF1, 0x20, 0xF1, 0xD6, 0x50, 0xD0,
+0x20, 0xF3, 0x21, 0xF3, 0xA1, 0xF0, 0xD0, 0x90, 0xC0, 0x10, 0xC0, 0x90, 0x10, 0x60, 0x00, 0x10,
+0xE0, 0x60, 0xB0, 0x00, 0x60, 0x10, 0xC0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xA0, 0xF2, 0xD0,
+0xF0, 0x26, 0xF0, 0xD0, 0x50, 0xF1, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xD0, 0x50, 0xF1, 0x22, 0xF2,
+0x22, 0xF0, 0x21, 0xF1, 0xA1, 0xD0, 0xF1, 0x24, 0xF2, 0x22, 0xF1, 0xD0, 0xA1, 0xD0, 0xF0, 0x25,
+0xF2, 0x23, 0xF1, 0xD0, 0x50, 0x70, 0x10, 0x80, 0x01, 0x80, 0x90, 0x60, 0x71, 0x90, 0xB0, 0x0F,
+0x3A, 0x0F, 0x3D, 0xB0, 0xE0, 0xB0, 0x70, 0x60, 0x00, 0x30, 0xE0, 0x80, 0x10, 0x80, 0x00, 0x90,
+0x50, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF6, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF1,
+0x21, 0xF1, 0x22, 0xF0, 0x50, 0xA0, 0xD0, 0xF1, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20,
+0xF3, 0x50, 0xD0, 0xF0, 0x22, 0xF3, 0x20, 0xF1, 0x20, 0xF1, 0x50, 0xD0, 0xF0, 0x20, 0xF1, 0x26,
+0xF0, 0xD0, 0x50, 0xF3, 0x27, 0xD0, 0xA0, 0xF1, 0x21, 0xF0, 0x24, 0xF0, 0xD0, 0xF0, 0xA0, 0xF2,
+0x20, 0xF0, 0xD0, 0x50, 0x71, 0xC2, 0x90, 0xA0, 0xD5, 0x22, 0xF1, 0xD0, 0xA1, 0xD1, 0xA0, 0xC0,
+0x11, 0x70, 0xB0, 0x00, 0x80, 0xC0, 0x00, 0x61, 0x00, 0x70, 0xC0, 0xF0, 0xD0, 0xF1, 0x22, 0xF2,
+0x50, 0xF3, 0x21, 0xF3, 0x21, 0xF1, 0x50, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0xF0,
+0x50, 0xD0, 0x23, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xF2, 0x25, 0xF0, 0x21, 0xF0, 0x21,
+0xF2, 0x50, 0xF2, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x30, 0x00, 0x90,
+0x10, 0x41, 0x30, 0x00, 0x30, 0x60, 0x00, 0x80, 0x70, 0x0F, 0x3A, 0x0F, 0x40, 0x80, 0x40, 0x01,
+0x80, 0x10, 0x90, 0x01, 0xB0, 0xC0, 0x30, 0xD1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xD0,
+0xF0, 0x50, 0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0x21, 0xD0, 0x50, 0x70, 0x30, 0xD0, 0x50, 0xD1,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xD0, 0xF1, 0xA0, 0xD0, 0xF0, 0x22, 0xF3, 0x21,
+0xF3, 0x50, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x50, 0xF0, 0x22, 0xF1, 0x21,
+0xF1, 0x20, 0xF0, 0xD0, 0x50, 0xD1, 0xF0, 0x20, 0xF3, 0x20, 0xF2, 0xD0, 0xA0, 0xF0, 0xD0, 0x21,
+0xF1, 0xC0, 0x90, 0x13, 0xC0, 0x90, 0x50, 0xA0, 0x70, 0x30, 0x90, 0x50, 0xD2, 0xF1, 0xD1, 0x90,
+0x70, 0xF0, 0xD0, 0x80, 0xC0, 0x11, 0x80, 0x90, 0x70, 0x90, 0x00, 0xB0, 0x60, 0xC0, 0x10, 0xA0,
+0xD0, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x50, 0xF3, 0x21, 0xF3, 0x22, 0xD0, 0x50, 0xD0, 0x20, 0xF1,
+0x21, 0xF4, 0x22, 0xD0, 0x50, 0xF1, 0x21, 0xF2, 0x23, 0xF2, 0x20, 0xD0, 0xA1, 0xD0, 0xF0, 0x2B,
+0xF3, 0x50, 0xD0, 0xF3, 0x22, 0xF1, 0x21, 0xF0, 0xD1, 0x90, 0xC0, 0x02, 0xC0, 0x10, 0x40, 0x01,
+0x30, 0x40, 0x01, 0x31, 0x0F, 0x39, 0x0F, 0x3B, 0xE0, 0x81, 0x30, 0x70, 0xC0, 0xB0, 0xC1, 0x40,
+0xE0, 0x30, 0x01, 0x70, 0x00, 0xE0, 0x70, 0xD1, 0x23, 0xF0, 0x24, 0xD0, 0x50, 0xA0, 0xD0, 0xF0,
+0x25, 0xF2, 0x20, 0xF1, 0xD1, 0xF0, 0xA1, 0x70, 0x50, 0xF2, 0x20, 0xF1, 0x20, 0xF1, 0x21, 0xF0,
+0x20, 0xD0, 0x50, 0xF5, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0xA1, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x20,
+0xF0, 0x20, 0xF0, 0xA1, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x22, 0xF1, 0x51, 0xA0, 0xDA, 0xA0, 0xD0,
+0xF0, 0x20, 0xD0, 0x90, 0x30, 0x13, 0x80, 0x31, 0x80, 0x90, 0x30, 0x71, 0x90, 0x71, 0x10, 0x50,
+0xD1, 0x10, 0x71, 0xC0, 0x30, 0x11, 0x80, 0x70, 0xC1, 0x90, 0x80, 0x02, 0x40, 0x90, 0xC0, 0xD0,
+0xF0, 0x24, 0xF2, 0xD0, 0x50, 0x20, 0xF2, 0x21, 0xF2, 0x22, 0xF1, 0xA1, 0xD0, 0xF1, 0x20, 0xF6,
+0x21, 0xF0, 0xA1, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x23, 0xF3, 0x20, 0xD0, 0x50, 0xF4, 0x21, 0xF1,
+0x23, 0xF3, 0xD0, 0xA0, 0x50, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xD0, 0xF0, 0x70, 0x60,
+0x00, 0x90, 0x01, 0x90, 0x61, 0x70, 0x00, 0xB0, 0x10, 0x02, 0xC0, 0x0F, 0x39, 0x0F, 0x3A, 0x60,
+0x10, 0x30, 0xE0, 0x40, 0x60, 0x01, 0xB0, 0x00, 0x90, 0xE0, 0x60, 0x91, 0x02, 0x40, 0xC0, 0xA0,
+0xD0, 0xF1, 0x25, 0xF0, 0xA1, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x50,
+0xD0, 0xA0, 0x50, 0xD0, 0xF0, 0x23, 0xF2, 0x23, 0xF0, 0x50, 0xF1, 0x20, 0xF2, 0x26, 0xF0, 0xD0,
+0x50, 0xF3, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0xA1, 0xF0, 0x22, 0xF1, 0x20, 0xF3, 0xD1, 0xA0,
+0xC0, 0x10, 0xC0, 0x30, 0x10, 0x30, 0x90, 0x70, 0xD0, 0x90, 0x50, 0x90, 0x51, 0x80, 0xF0, 0xD0,
+0xF0, 0xD1, 0x80, 0x10, 0x90, 0x80, 0x02, 0xE0, 0x06, 0xE0, 0x40, 0x90, 0x70, 0xE0, 0xB0, 0x80,
+0x71, 0x90, 0x30, 0x40, 0x60, 0xB0, 0x05, 0x70, 0xC0, 0x50, 0xF0, 0x25, 0xF2, 0xD0, 0xA1, 0xF2,
+0x22, 0xF1, 0x22, 0xF2, 0x50, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF3, 0x20, 0xF0, 0xD0, 0x50, 0xF5,
+0x23, 0xF2, 0x20, 0xF1, 0xA0, 0x50, 0xD0, 0xF3, 0x20, 0xF0, 0x24, 0xF3, 0x20, 0xD0, 0x50, 0xF3,
+0x23, 0xF1, 0xD0, 0x50, 0xC0, 0xE0, 0x01, 0x60, 0x30, 0x90, 0xB0, 0x00, 0x60, 0x10, 0x80, 0x00,
+0xE0, 0xC0, 0xB0, 0x00, 0xC0, 0x0F, 0x39, 0x0F, 0x3B, 0xB0, 0xC0, 0xE0, 0x05, 0x30, 0x40, 0x01,
+0x70, 0x60, 0x01, 0x90, 0x00, 0x30, 0x80, 0xD0, 0xF2, 0x23, 0xF0, 0x50, 0xD1, 0x21, 0xF1, 0x21,
+0xF0, 0x24, 0xF3, 0xA0, 0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x22, 0xF3, 0x21, 0xD0, 0x50, 0xF1, 0x22,
+0xF0, 0x27, 0xF0, 0xA1, 0xF3, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0x50, 0xF2, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0xD1, 0xA0, 0x50, 0xA0, 0x30, 0xC0, 0x70, 0x10, 0x90, 0xC3, 0x10, 0xC0, 0x80, 0x10,
+0x90, 0x71, 0xA0, 0xD0, 0xA0, 0x50, 0x40, 0x80, 0xC0, 0x90, 0x02, 0xE0, 0x0C, 0xE0, 0x0A, 0xB0,
+0x70, 0x90, 0xD1, 0xF0, 0x21, 0xF3, 0x20, 0xF3, 0x50, 0xD0, 0xF0, 0x27, 0xF2, 0xD0, 0x50, 0xF1,
+0x24, 0xF0, 0xD6, 0xA1, 0xF0, 0xD0, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0,
+0x50, 0xA0, 0xD0, 0xF3, 0x29, 0xF0, 0xD0, 0xF0, 0x50, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xD1, 0x31,
+0xB0, 0x90, 0x01, 0xE0, 0x90, 0x02, 0xB0, 0x30, 0x70, 0x40, 0x00, 0xE0, 0x71, 0x40, 0x0F, 0x39,
+0x0F, 0x3D, 0xC0, 0xE0, 0x40, 0x92, 0xC0, 0x70, 0x00, 0x40, 0x80, 0x00, 0x90, 0x40, 0x30, 0xB0,
+0x01, 0x30, 0x70, 0xD1, 0xF1, 0x20, 0xF1, 0x50, 0xF2, 0x20, 0xF0, 0x20, 0xF3, 0x24, 0xF2, 0x20,
+0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x50, 0xF1, 0x22, 0xF0,
+0x27, 0xD0, 0x50, 0xA0, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0x50, 0xD0, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0x71, 0x11, 0x90, 0x70, 0x30, 0x41, 0x80, 0x41, 0x60, 0x04, 0x40,
+0x60, 0x70, 0x30, 0x91, 0x50, 0x41, 0x30, 0x90, 0x02, 0xE0, 0x0C, 0xE0, 0x08, 0x80, 0x10, 0xC0,
+0xA1, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x50, 0xF1, 0x26, 0xF3, 0xD0, 0xA1, 0xD0,
+0x20, 0xF0, 0x21, 0xD1, 0x50, 0x30, 0x50, 0xC0, 0xF0, 0x50, 0x31, 0xA0, 0xF3, 0x22, 0xF1, 0x21,
+0xF0, 0x22, 0xF1, 0x50, 0xD0, 0xF3, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xA0, 0x50,
+0xD0, 0xF1, 0x21, 0xD0, 0xF0, 0xC0, 0x80, 0x01, 0x60, 0x30, 0x81, 0x03, 0xB0, 0x30, 0x00, 0x10,
+0x70, 0x0F, 0x3D, 0x0F, 0x3E, 0xB0, 0x10, 0x30, 0xB1, 0x01, 0xC0, 0x30, 0x40, 0x70, 0x00, 0x80,
+0x90, 0x01, 0xB0, 0x90, 0xB0, 0x70, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xA1, 0xD0, 0xF2, 0x2B, 0xF0,
+0xD0, 0xA1, 0xF1, 0x2B, 0xF0, 0xD0, 0x50, 0xA0, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22,
+0xF0, 0x50, 0xF1, 0x20, 0xF1, 0x23, 0xF2, 0x20, 0xF0, 0xA1, 0xD0, 0x21, 0xF1, 0xD2, 0x30, 0x70,
+0xE0, 0x01, 0xB0, 0x0D, 0xE0, 0x0C, 0x40, 0x0A, 0xE0, 0x90, 0x80, 0x03, 0xB0, 0x60, 0x40, 0x80,
+0x90, 0xC0, 0xD2, 0xA1, 0xD0, 0xF1, 0x22, 0xF0, 0x24, 0xF0, 0xA1, 0xF0, 0x26, 0xF5, 0x50, 0xD0,
+0xF1, 0xD2, 0x50, 0x10, 0x70, 0xC0, 0x10, 0xC0, 0x10, 0x90, 0x80, 0x70, 0x50, 0xD1, 0xF0, 0x22,
+0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xA1, 0xF2, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF3, 0xA1, 0xF0, 0xD2, 0x50, 0x70, 0x00, 0x70, 0x02, 0xC0, 0x40, 0x00, 0xE0, 0x10, 0x02, 0x90,
+0x30, 0x90, 0xC0, 0xB0, 0x0F, 0x3C, 0x0F, 0x40, 0x70, 0x80, 0x01, 0x70, 0x40, 0x01, 0x70, 0x01,
+0xB0, 0x70, 0x60, 0x30, 0xB0, 0x01, 0x70, 0x30, 0xD1, 0xA0, 0x50, 0xD1, 0xF2, 0x2A, 0xF2, 0x50,
+0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0xF2, 0x22, 0xF0, 0xD1, 0x50, 0xD3, 0xF0, 0x20, 0xF0, 0x20,
+0xF2, 0x22, 0xF0, 0xA1, 0xD0, 0xF3, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x50, 0xF1, 0x21, 0xF0,
+0xA0, 0x50, 0x30, 0x70, 0x30, 0x03, 0x40, 0x0C, 0xB0, 0x60, 0x0C, 0xE0, 0x0A, 0x81, 0x30, 0x90,
+0x30, 0x80, 0x91, 0x30, 0x80, 0x50, 0xA0, 0xD0, 0xF3, 0x50, 0xD0, 0xF1, 0x29, 0xA1, 0xF1, 0x24,
+0xF4, 0xD1, 0xA1, 0xD0, 0x51, 0x30, 0x90, 0x30, 0x00, 0x80, 0xC0, 0xE0, 0xC0, 0x90, 0x30, 0xC0,
+0x40, 0x50, 0xA1, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0x23, 0xD0, 0x50, 0xF2, 0x25, 0xF3, 0x20, 0xF0,
+0x22, 0xD0, 0x50, 0xF1, 0xD0, 0x91, 0x01, 0x60, 0x30, 0xE0, 0x90, 0xB0, 0x01, 0x40, 0xC0, 0x90,
+0x01, 0xC0, 0x80, 0x00, 0x60, 0xB0, 0x0F, 0x3C, 0x0F, 0x41, 0x90, 0x60, 0xE0, 0x70, 0x01, 0x60,
+0xC0, 0x00, 0xE0, 0x60, 0x00, 0x70, 0x80, 0x01, 0x60, 0x80, 0x40, 0x90, 0xD0, 0x50, 0xF3, 0x20,
+0xF1, 0x24, 0xF0, 0x23, 0xF0, 0xD0, 0x50, 0xF1, 0x20, 0xF2, 0xD1, 0xA1, 0xF1, 0xD3, 0x50, 0x30,
+0x80, 0xA0, 0x50, 0x80, 0xD1, 0xF5, 0x20, 0xF2, 0x50, 0xF1, 0x21, 0xF0, 0x25, 0xF0, 0x20, 0xF0,
+0xD0, 0x50, 0xF2, 0x20, 0xD0, 0xA0, 0x11, 0x05, 0x40, 0x0C, 0x61, 0x0C, 0xE0, 0x07, 0x41, 0xB0,
+0x00, 0x90, 0x30, 0x80, 0xA2, 0xD3, 0xF5, 0x50, 0xD0, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF1,
+0x50, 0xD0, 0xF2, 0x21, 0xF2, 0xA0, 0x50, 0xD0, 0xF0, 0x50, 0x31, 0x70, 0x80, 0x40, 0xE0, 0xB0,
+0x05, 0x70, 0x10, 0x80, 0x90, 0x80, 0xC0, 0x90, 0xD2, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0xA1, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0x21, 0xF1, 0x50, 0xA0,
+0x70, 0xE0, 0x30, 0xB0, 0x01, 0x90, 0x30, 0x03, 0x80, 0x00, 0x31, 0x0F, 0x42, 0x0F, 0x43, 0x90,
+0x60, 0x01, 0x10, 0x60, 0xE0, 0x40, 0x80, 0x60, 0x00, 0x80, 0x30, 0x00, 0x70, 0x01, 0x60, 0xC0,
+0x80, 0xD0, 0xF0, 0xD0, 0x20, 0xF1, 0x23, 0xF8, 0xA0, 0xD0, 0x20, 0xD0, 0xF0, 0x50, 0x10, 0x80,
+0x30, 0x10, 0x70, 0x90, 0x70, 0x90, 0x30, 0xC0, 0x10, 0x90, 0x40, 0x60, 0x80, 0x30, 0x10, 0x70,
+0x80, 0xD1, 0xF2, 0x21, 0xF0, 0xD1, 0x50, 0xF0, 0x26, 0xF1, 0x21, 0xF2, 0x50, 0xF2, 0xD1, 0x70,
+0x11, 0xC0, 0xE0, 0x03, 0xE0, 0x0C, 0x60, 0xB0, 0x0C, 0xE0, 0x05, 0x80, 0x40, 0x60, 0x11, 0x30,
+0x91, 0x80, 0xD3, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xD1, 0xF1, 0x22, 0xF4, 0xD1, 0x50,
+0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x90, 0x10, 0x50, 0xD0, 0x30, 0x10, 0x90, 0x60,
+0x0A, 0x40, 0x90, 0x42, 0x80, 0x91, 0xC0, 0x70, 0xD0, 0xF0, 0x21, 0xF0, 0x24, 0xF2, 0x50, 0xF1,
+0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xD1, 0x30, 0x70, 0xB0, 0x00, 0x60, 0x30, 0x00,
+0x90, 0x40, 0x07, 0x70, 0x80, 0x0F, 0x41, 0x0F, 0x43, 0x80, 0x30, 0xE0, 0x10, 0x40, 0x00, 0xB0,
+0x31, 0x02, 0x60, 0x10, 0xE0, 0x01, 0x60, 0x30, 0x80, 0x90, 0xD1, 0xF0, 0x22, 0xF0, 0x21, 0xF1,
+0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x80, 0xD4, 0x80, 0x40, 0x11, 0x80, 0x03, 0x41, 0xB0, 0x61, 0x04,
+0x30, 0x70, 0x50, 0xD1, 0xF0, 0x21, 0xF0, 0xD0, 0xA1, 0xF0, 0x20, 0xF1, 0x23, 0xF1, 0x22, 0xD0,
+0xA1, 0xF1, 0xD2, 0x80, 0x13, 0xB0, 0x01, 0xB0, 0x60, 0x0C, 0xE0, 0xB0, 0x0C, 0xE0, 0x05, 0x40,
+0x10, 0xC0, 0x70, 0x90, 0xD2, 0x80, 0x70, 0x10, 0x50, 0xF0, 0x26, 0xD1, 0x51, 0xA0, 0xD0, 0xF1,
+0x22, 0xD5, 0xA0, 0xF2, 0xD4, 0x90, 0x30, 0x91, 0x30, 0x80, 0xB0, 0x60, 0xB0, 0x0E, 0xE0, 0x00,
+0x60, 0x10, 0x30, 0xD1, 0xF2, 0x24, 0xF3, 0x50, 0xD0, 0xF1, 0x20, 0xF1, 0x27, 0xF0, 0xD1, 0x70,
+0x40, 0x30, 0xB0, 0x01, 0x80, 0x10, 0x0A, 0xC0, 0xB0, 0x0F, 0x40, 0x0F, 0x44, 0x40, 0x30, 0x60,
+0x09, 0x90, 0x40, 0x00, 0x70, 0x01, 0x60, 0xC0, 0x50, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0xD0,
+0x20, 0xF2, 0xA0, 0x10, 0xC0, 0x80, 0x70, 0x10, 0x70, 0xC0, 0x30, 0x10, 0x08, 0x40, 0x07, 0x31,
+0xD1, 0x21, 0xF1, 0x50, 0xF1, 0x20, 0xF1, 0x22, 0xF2, 0x22, 0xD0, 0x50, 0xF2, 0xA0, 0x10, 0x90,
+0x30, 0x70, 0x30, 0xC0, 0xB0, 0x02, 0x61, 0x0C, 0xE0, 0xB0, 0x0C, 0xE0, 0x06, 0x40, 0x10, 0x30,
+0xC0, 0xF0, 0xD0, 0x71, 0x30, 0xF0, 0xD1, 0xF1, 0x20, 0xF0, 0x20, 0xD1, 0x80, 0x90, 0x30, 0x40,
+0x90, 0x50, 0xD4, 0xA0, 0x50, 0x80, 0x31, 0x90, 0x31, 0x94, 0x30, 0x70, 0x80, 0x60, 0x05, 0xE0,
+0x0F, 0x00, 0xE0, 0x40, 0xC0, 0x30, 0xC0, 0xA0, 0xF1, 0x23, 0xF1, 0x21, 0xF0, 0xD0, 0xA1, 0xD0,
+0x21, 0xF1, 0x23, 0xF1, 0x20, 0xD1, 0x80, 0xC0, 0x02, 0x90, 0x00, 0x81, 0x0F, 0x4E, 0x0F, 0x52,
+0x40, 0x70, 0xE0, 0x01, 0xE0, 0x81, 0x30, 0xF0, 0xD0, 0x20, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0xD1,
+0x91, 0x00, 0x80, 0xE0, 0x80, 0x60, 0x01, 0xE0, 0x07, 0x61, 0x08, 0xE0, 0xC0, 0x70, 0x23, 0x50,
+0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x22, 0xF1, 0x50, 0xD0, 0xF2, 0x30, 0x90, 0x60, 0xE0, 0x80,
+0x04, 0xE0, 0xB0, 0x0C, 0xE0, 0x0D, 0xE0, 0x07, 0x90, 0x10, 0x90, 0xD1, 0x51, 0x30, 0xA1, 0x90,
+0x70, 0xD3, 0x50, 0x90, 0x40, 0x00, 0xE0, 0x90, 0x30, 0x70, 0xC0, 0xA0, 0x50, 0x30, 0x70, 0x30,
+0x40, 0xE0, 0x60, 0xB0, 0x01, 0xE0, 0x02, 0xB1, 0xE0, 0x08, 0x40, 0x0F, 0x00, 0xE1, 0x40, 0xE0,
+0x10, 0xC0, 0xA0, 0xF0, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x50, 0xD0, 0x21, 0xF1, 0x21, 0xF1,
+0x21, 0xD0, 0xA0, 0x90, 0x40, 0x30, 0xB0, 0x01, 0x40, 0x70, 0xE0, 0x0F, 0x4F, 0x0F, 0x53, 0xB0,
+0x90, 0xE0, 0x00, 0x90, 0x01, 0xE0, 0xC0, 0x50, 0xD1, 0xF0, 0x20, 0x30, 0xF0, 0xD1, 0xF1, 0x50,
+0x30, 0x0F, 0x01, 0x40, 0x0A, 0x80, 0x10, 0xD0, 0xF1, 0xA1, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x22,
+0xF0, 0xD0, 0xA1, 0xF1, 0x20, 0xF0, 0xD0, 0xA0, 0x32, 0xC0, 0xE0, 0x40, 0xE0, 0xB0, 0x40, 0xB0,
+0x0C, 0xE0, 0x0D, 0xE0, 0x09, 0x30, 0x70, 0xA0, 0xD0, 0x50, 0xC0, 0x10, 0xC1, 0xA0, 0xD0, 0x80,
+0x91, 0x80, 0x02, 0x10, 0x80, 0xD0, 0xF0, 0x80, 0x10, 0x40, 0x60, 0x07, 0xE0, 0x0E, 0xE0, 0xB0,
+0x0E, 0xB0, 0xE0, 0x01, 0x80, 0xC0, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF3, 0xA1, 0xD0, 0x20,
+0xF1, 0x20, 0xF1, 0x20, 0xD1, 0x50, 0xC0, 0xB0, 0x01, 0x70, 0x00, 0x40, 0x90, 0x0F, 0x51, 0x0F,
+0x55, 0x80, 0x10, 0x60, 0x01, 0x41, 0x80, 0x90, 0xD2, 0xC0, 0x10, 0x90, 0xA0, 0xD1, 0x90, 0x0F,
+0x01, 0xB0, 0xE0, 0x0B, 0x30, 0x70, 0xD1, 0x50, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0xA1,
+0xF0, 0x22, 0xF1, 0x70, 0x30, 0x83, 0x32, 0x71, 0x30, 0xB0, 0x09, 0xE0, 0x0D, 0xE0, 0x0B, 0x80,
+0x90, 0xA0, 0xD0, 0x51, 0xD1, 0x10, 0x70, 0x80, 0xA0, 0x40, 0x80, 0x71, 0xF0, 0x50, 0xD1, 0xA0,
+0xC0, 0xE0, 0x80, 0x40, 0x06, 0x60, 0xB0, 0x0E, 0x40, 0x0F, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0x80,
+0xD0, 0xF2, 0x27, 0xF0, 0xD0, 0x50, 0xF0, 0xD0, 0x23, 0xF0, 0xD0, 0xA0, 0x70, 0x81, 0x60, 0x01,
+0x40, 0x10, 0x40, 0x0F, 0x52, 0x0F, 0x56, 0xB0, 0x90, 0x40, 0x00, 0x90, 0x01, 0x60, 0xC0, 0x80,
+0xD1, 0x50, 0x70, 0x10, 0x90, 0x81, 0x0F, 0x01, 0x40, 0x0D, 0x30, 0x90, 0x80, 0xA0, 0xD0, 0x26,
+0xF1, 0x21, 0xF1, 0xD0, 0x50, 0xF0, 0x20, 0xF0, 0x22, 0xD0, 0x30, 0x90, 0x30, 0x70, 0x10, 0xA0,
+0xD0, 0xF0, 0xA0, 0xD1, 0xE0, 0x90, 0x09, 0x40, 0x0D, 0xE0, 0x0C, 0xE0, 0x30, 0xD2, 0xA0, 0xF0,
+0xE1, 0x43, 0xE0, 0xD1, 0x50, 0xD1, 0x60, 0x90, 0xC0, 0x70, 0x90, 0x07, 0xE0, 0x0E, 0xE0, 0x0F,
+0x00, 0xB0, 0xE0, 0x00, 0x70, 0xD0, 0xF2, 0x20, 0xF1, 0x25, 0xF0, 0xD0, 0xA0, 0x50, 0xD0, 0xF0,
+0x20, 0xF0, 0xD1, 0x30, 0xC0, 0xB0, 0x01, 0x90, 0x00, 0x40, 0x90, 0x0F, 0x54, 0x0F, 0x58, 0x40,
+0xC0, 0x60, 0x01, 0x80, 0xE0, 0x40, 0x70, 0xA0, 0xD1, 0x50, 0x90, 0x70, 0x60, 0x0F, 0x01, 0xE0,
+0x0E, 0xB0, 0x30, 0x80, 0xD1, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x50, 0x22,
+0xF3, 0xD0, 0xF0, 0x52, 0xF1, 0xA1, 0x30, 0xC0, 0x70, 0xC0, 0x60, 0x08, 0x40, 0x0D, 0xE0, 0x0D,
+0x80, 0x70, 0x30, 0x70, 0x93, 0x31, 0x94, 0x30, 0x92, 0x30, 0x0A, 0x40, 0x0E, 0x61, 0x0F, 0x00,
+0xE0, 0x30, 0xA0, 0xD0, 0xF6, 0x24, 0xF1, 0xD0, 0x50, 0xF2, 0xD0, 0x50, 0x70, 0x60, 0x40, 0xE0,
+0x01, 0x40, 0xC0, 0x40, 0x0F, 0x55, 0x0F, 0x59, 0x60, 0x90, 0x40, 0x00, 0x90, 0x02, 0x10, 0x30,
+0xD1, 0x50, 0x30, 0x90, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x41, 0x70, 0x50, 0xF0, 0xD1, 0xF1, 0x20,
+0xF0, 0xD2, 0x20, 0xF0, 0xA1, 0xF0, 0x20, 0xF8, 0x20, 0xF1, 0xA1, 0x80, 0x91, 0x80, 0x60, 0x08,
+0x40, 0x0D, 0xE0, 0x0D, 0x41, 0xB0, 0x04, 0x61, 0x04, 0x60, 0xB0, 0x0D, 0xE0, 0xB0, 0x0E, 0x40,
+0x0F, 0x00, 0xB0, 0x70, 0xD0, 0xF6, 0x26, 0xF2, 0x50, 0xD0, 0xF0, 0x90, 0x10, 0x02, 0x90, 0x00,
+0x40, 0x90, 0x0F, 0x57, 0x0F, 0x5B, 0x40, 0x10, 0x60, 0x01, 0x30, 0xB0, 0x60, 0x90, 0x30, 0xD1,
+0x90, 0xE0, 0x0D, 0xB0, 0x40, 0x0F, 0x00, 0x61, 0x00, 0xB0, 0x40, 0x90, 0x70, 0x80, 0xD3, 0x50,
+0x30, 0xA0, 0xD1, 0xA0, 0xF1, 0x21, 0xF4, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0xA0, 0xD2, 0x50,
+0x30, 0x71, 0x60, 0x05, 0xE0, 0x0D, 0xE0, 0x0D, 0xE0, 0x0D, 0xB0, 0x60, 0x0D, 0xB0, 0x60, 0x0E,
+0xE0, 0xB0, 0x0F, 0x00, 0x40, 0x70, 0xD0, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1,
+0xD0, 0xA0, 0x30, 0x90, 0xB0, 0xE0, 0x40, 0x01, 0x40, 0x10, 0xE0, 0xB0, 0x80, 0x60, 0x0F, 0x55,
+0x0F, 0x5D, 0x30, 0x80, 0x60, 0x30, 0x01, 0x30, 0x10, 0x90, 0x50, 0xD0, 0xC0, 0x0D, 0xE0, 0xB0,
+0x0F, 0x00, 0xE0, 0x05, 0x40, 0x91, 0x30, 0x80, 0x10, 0xC0, 0x70, 0x50, 0xA1, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF0, 0x21, 0xF4, 0x50, 0xF4, 0xD1, 0xF0, 0x30, 0x90, 0x40, 0xB0, 0x01, 0xB0, 0xE0,
+0xB0, 0x0C, 0xE0, 0x0D, 0xE0, 0xB0, 0x0D, 0xE0, 0x0E, 0xE0, 0x0E, 0xB0, 0x60, 0x0F, 0x00, 0xB0,
+0x90, 0x30, 0xD2, 0x20, 0xF4, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x50, 0x70, 0x10, 0xE0, 0x01, 0x90,
+0xB0, 0x30, 0x80, 0x01, 0x30, 0xB0, 0x30, 0x0F, 0x55, 0x0F, 0x5B, 0xB0, 0x40, 0xB0, 0x60, 0x70,
+0x40, 0x00, 0xB0, 0x10, 0x70, 0x00, 0x80, 0x90, 0x80, 0x90, 0x0C, 0xE0, 0x0F, 0x01, 0x40, 0x07,
+0xB0, 0xE0, 0x40, 0x80, 0xC1, 0x10, 0xC0, 0x90, 0xA0, 0xF0, 0x20, 0xF1, 0x26, 0xF2, 0x50, 0xF1,
+0x22, 0xF2, 0xD0, 0xF0, 0x50, 0x30, 0x90, 0x70, 0x30, 0x70, 0x10, 0x70, 0x0B, 0xE0, 0x0D, 0x60,
+0xB0, 0x0D, 0x40, 0x0E, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x70, 0x81, 0x90, 0xC0, 0x80,
+0xD0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x50, 0x70, 0x40, 0x00, 0xC0, 0x10, 0x01, 0x80,
+0x70, 0x60, 0x40, 0x30, 0x00, 0x40, 0x30, 0x40, 0x0F, 0x55, 0x0F, 0x5A, 0xB0, 0xC0, 0x40, 0x70,
+0x60, 0x00, 0x80, 0x30, 0x70, 0x10, 0xB0, 0x00, 0xB0, 0x90, 0x80, 0xC0, 0x70, 0xE0, 0x09, 0x60,
+0xB0, 0x0F, 0x00, 0xB0, 0x60, 0x0D, 0xE0, 0x40, 0x70, 0x80, 0xD0, 0xF3, 0x24, 0xF3, 0x50, 0xD0,
+0x23, 0xF2, 0xD4, 0x60, 0x40, 0x10, 0x60, 0x0C, 0xE0, 0x0D, 0x60, 0xB0, 0x0D, 0x40, 0x0E, 0x60,
+0xB0, 0x0E, 0xE0, 0xB0, 0x0F, 0x00, 0x61, 0xE0, 0x80, 0x70, 0x30, 0xD0, 0xF2, 0x20, 0xF0, 0xD0,
+0xA0, 0x70, 0x80, 0x90, 0x01, 0x60, 0x10, 0x91, 0x40, 0x00, 0x30, 0x80, 0x40, 0x10, 0x0F, 0x58,
+0x0F, 0x5D, 0x60, 0x70, 0x02, 0x90, 0xC0, 0x01, 0x30, 0xB0, 0x00, 0xB0, 0xC0, 0x10, 0x70, 0x40,
+0x07, 0x40, 0x0F, 0x01, 0x40, 0x0F, 0x00, 0xE0, 0x00, 0x90, 0x70, 0xA0, 0xD2, 0x23, 0xF0, 0x20,
+0xF0, 0xD0, 0xA1, 0xF0, 0xD1, 0xF0, 0xD3, 0x30, 0x92, 0x32, 0x0E, 0xE0, 0x0D, 0xB0, 0x60, 0x0D,
+0x60, 0xB0, 0x0D, 0xB0, 0x60, 0x0F, 0x00, 0xE0, 0x0F, 0x01, 0xE0, 0x30, 0x90, 0xD1, 0xF1, 0x20,
+0xF0, 0xD1, 0x70, 0xC0, 0x01, 0xE0, 0x80, 0x01, 0x10, 0x30, 0x02, 0x70, 0xB0, 0x00, 0x40, 0x70,
+0x0F, 0x57, 0x0F, 0x5C, 0xB0, 0x70, 0x40, 0x00, 0x60, 0xE1, 0x60, 0x90, 0x81, 0x01, 0x60, 0x80,
+0x60, 0x90, 0x70, 0xC0, 0x05, 0xE0, 0xB0, 0x0F, 0x01, 0xE0, 0x0F, 0x00, 0xE0, 0x01, 0x40, 0x30,
+0x91, 0x30, 0x51, 0xA0, 0xD0, 0xF0, 0xD2, 0xA0, 0xD1, 0xA0, 0xF0, 0x50, 0x80, 0x30, 0x71, 0x80,
+0x04, 0xE0, 0x0E, 0xE0, 0x0D, 0xB0, 0xE0, 0x0D, 0xB0, 0x60, 0x0E, 0x40, 0x0F, 0x00, 0x40, 0x0E,
+0xB0, 0x70, 0x90, 0xA0, 0xD0, 0xF2, 0xD1, 0xA0, 0x30, 0x90, 0xB0, 0x30, 0x02, 0x31, 0x90, 0x00,
+0xB0, 0x70, 0x30, 0x00, 0x30, 0x40, 0x01, 0x70, 0x60, 0x0F, 0x56, 0x0F, 0x59, 0x40, 0x90, 0x71,
+0x40, 0x00, 0xE0, 0x30, 0x10, 0xE0, 0x01, 0x40, 0x90, 0xE0, 0x00, 0x30, 0xB0, 0x01, 0x90, 0x10,
+0x30, 0x04, 0x40, 0x0F, 0x01, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0x04, 0x60, 0xE0, 0xC1, 0x90, 0x72,
+0x91, 0x30, 0x72, 0x90, 0xC0, 0x80, 0xE0, 0xB0, 0x06, 0x40, 0x0E, 0xE0, 0x0D, 0xB0, 0xE0, 0x0D,
+0xB0, 0xE0, 0x0E, 0x40, 0x0F, 0x00, 0x60, 0xB0, 0x0C, 0x60, 0x11, 0xE0, 0x50, 0xD0, 0x20, 0xF0,
+0xD0, 0xA0, 0x30, 0x70, 0x30, 0x01, 0x60, 0x80, 0x00, 0x40, 0x90, 0xE0, 0x00, 0x60, 0xC0, 0x60,
+0x01, 0xB0, 0xC0, 0x01, 0x40, 0x80, 0x0F, 0x56, 0x0F, 0x58, 0x40, 0x10, 0x40, 0x04, 0xE0, 0x90,
+0x02, 0xB0, 0x00, 0x40, 0x90, 0x30, 0x01, 0xB0, 0x30, 0x00, 0x40, 0xC0, 0x30, 0x01, 0x61, 0x0F,
+0x01, 0x40, 0x0F, 0x00, 0x60, 0xB0, 0x0B, 0xB0, 0x01, 0xE0, 0x0E, 0x40, 0x0E, 0xE0, 0x0E, 0xE0,
+0x0E, 0xE0, 0x0E, 0x60, 0xB0, 0x0F, 0x00, 0x40, 0x0A, 0xB0, 0x90, 0x10, 0xC0, 0x91, 0x50, 0xA0,
+0xD0, 0xF0, 0x30, 0x90, 0xE0, 0x00, 0x30, 0x02, 0x91, 0x40, 0x60, 0xB0, 0x01, 0x70, 0x60, 0x70,
+0xC0, 0x60, 0x80, 0x90, 0x00, 0x30, 0x40, 0x0F, 0x56, 0x0F, 0x59, 0x60, 0xC0, 0x90, 0xB0, 0x02,
+0x10, 0xB0, 0x00, 0x60, 0x10, 0x91, 0x01, 0x80, 0x30, 0xB0, 0x90, 0x02, 0x30, 0x40, 0x10, 0x30,
+0x40, 0x0F, 0x01, 0xB0, 0xE0, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0E, 0x40, 0x0E, 0xE0, 0x0E,
+0xE0, 0x0E, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0A, 0x60, 0x91, 0x40, 0x00, 0x40, 0xC0,
+0x80, 0x91, 0x40, 0x80, 0x01, 0xB0, 0x80, 0x60, 0x90, 0x80, 0x01, 0x90, 0x70, 0x01, 0x90, 0x10,
+0x00, 0xB0, 0x10, 0x00, 0x80, 0x10, 0x80, 0x0F, 0x57, 0x0F, 0x5B, 0x40, 0x60, 0x01, 0x81, 0x00,
+0xB0, 0xC0, 0xB0, 0x00, 0x30, 0xE0, 0x00, 0xE0, 0x60, 0x80, 0x70, 0xB0, 0x00, 0x60, 0x80, 0x01,
+0x80, 0x10, 0x90, 0x60, 0x0E, 0xE0, 0xB0, 0x0F, 0x00, 0xE0, 0x0E, 0xB0, 0xE0, 0x0E, 0xE0, 0x0E,
+0xE0, 0x0E, 0x40, 0x0E, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x61, 0x0E, 0xE0, 0x10, 0xC0, 0x60,
+0x01, 0x90, 0x01, 0xE0, 0x70, 0x80, 0x03, 0x90, 0x70, 0xE0, 0x00, 0xB0, 0x60, 0x01, 0x90, 0xE0,
+0x0F, 0x5A, 0x0F, 0x5E, 0xB0, 0xC0, 0x01, 0x30, 0x80, 0x01, 0x70, 0xB0, 0x40, 0xE0, 0x30, 0x00,
+0xB0, 0x30, 0x80, 0x90, 0x02, 0x30, 0x00, 0xE0, 0x70, 0xC0, 0xE0, 0x0C, 0x40, 0x0F, 0x00, 0xB0,
+0x60, 0x0E, 0x61, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0x40, 0x0E, 0xE0, 0xB0, 0x0E, 0xE0, 0x0F, 0x01,
+0x40, 0x0C, 0xE0, 0xC0, 0x90, 0xB0, 0x00, 0x30, 0x01, 0xB0, 0x90, 0x30, 0x80, 0xB0, 0x03, 0xB0,
+0x61, 0xC0, 0x01, 0xE0, 0x40, 0x60, 0x70, 0xB0, 0x0F, 0x5A, 0x0F, 0x5E, 0xB1, 0x01, 0x70, 0x01,
+0x60, 0x70, 0x00, 0x40, 0x80, 0x30, 0x02, 0xB0, 0x80, 0x90, 0xB0, 0x60, 0x80, 0x01, 0xE0, 0x80,
+0x30, 0xC0, 0x80, 0x09, 0xB0, 0x60, 0x0F, 0x00, 0xE0, 0xB0, 0x0E, 0xE0, 0xB0, 0x0E, 0xE0, 0x0E,
+0xE0, 0x0E, 0x40, 0x0E, 0xB0, 0x60, 0x0E, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0xB0, 0x09, 0x80, 0xC0,
+0x31, 0xB0, 0x01, 0x30, 0xB0, 0xE0, 0x90, 0x80, 0xB0, 0x08, 0x90, 0x40, 0x00, 0x60, 0x70, 0x90,
+0x60, 0x0F, 0x5B, 0x0F, 0x61, 0xB0, 0x70, 0x01, 0x10, 0x60, 0x01, 0xB0, 0x06, 0x80, 0x10, 0x40,
+0x01, 0x90, 0x02, 0xC1, 0x90, 0xB0, 0x06, 0xE0, 0x0F, 0x01, 0xE0, 0x0F, 0x00, 0x40, 0x0E, 0xB0,
+0xE0, 0x0E, 0xE0, 0x0E, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xB0, 0xE0, 0x06,
+0x60, 0x70, 0xC1, 0x01, 0xB0, 0x30, 0x01, 0x80, 0xC0, 0x80, 0x0C, 0x10, 0x0F, 0x60, 0x0F, 0x62,
+0x80, 0x70, 0xC0, 0xE0, 0x0C, 0x80, 0x90, 0x81, 0x01, 0x40, 0xE0, 0x00, 0x60, 0x10, 0xC0, 0x40,
+0x04, 0x40, 0x0F, 0x01, 0xE0, 0x0F, 0x00, 0xE0, 0x0E, 0xB0, 0xE0, 0x0E, 0xE0, 0x0E, 0x40, 0x0F,
+0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x03, 0xB0, 0x80, 0x10, 0x70, 0xB0, 0x00, 0x80,
+0x60, 0x01, 0x30, 0x80, 0x90, 0x40, 0x0E, 0x60, 0x0F, 0x60, 0x0F, 0x63, 0xB1, 0x0F, 0x00, 0x40,
+0x90, 0x40, 0xB0, 0x30, 0x02, 0x30, 0xB0, 0x30, 0x70, 0x90, 0x60, 0x00, 0xB0, 0x60, 0x0F, 0x00,
+0x61, 0x0E, 0xB0, 0xE0, 0x0E, 0x61, 0x0E, 0xE0, 0x0E, 0x60, 0xB0, 0x0E, 0x40, 0x0F, 0x00, 0xE0,
+0xB0, 0x0F, 0x00, 0x60, 0xB0, 0x00, 0xE0, 0x70, 0xC0, 0x80, 0xB0, 0x30, 0x01, 0xB0, 0x80, 0xB0,
+0x80, 0x90, 0xE0, 0x0F, 0x72, 0x0F, 0x77, 0xE0, 0x30, 0xC0, 0xB0, 0x00, 0x60, 0x40, 0x01, 0x80,
+0x40, 0x71, 0x90, 0x0F, 0x01, 0xE0, 0xB0, 0x0E, 0xB0, 0x60, 0x0E, 0x60, 0xB0, 0x0E, 0xE0, 0x0E,
+0x60, 0xB0, 0x0E, 0xE0, 0x0F, 0x00, 0x61, 0x0F, 0x00, 0xB0, 0x90, 0xC0, 0x30, 0x80, 0xE0, 0x01,
+0x30, 0xB0, 0x00, 0x60, 0xC0, 0x30, 0x60, 0x0F, 0x74, 0x0F, 0x7A, 0x80, 0x30, 0x10, 0x02, 0x90,
+0x01, 0x30, 0x10, 0x70, 0xC0, 0x40, 0x0D, 0x40, 0x0F, 0x00, 0x60, 0xB0, 0x0E, 0xE0, 0xB0, 0x0E,
+0xE0, 0x0E, 0xB0, 0x60, 0x0E, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0x0D, 0x80, 0xC0, 0x70, 0x10, 0x40,
+0x01, 0x90, 0x01, 0xB0, 0xC0, 0x90, 0x80, 0x0F, 0x77, 0x0F, 0x7C, 0xE0, 0x90, 0x80, 0x41, 0x01,
+0x10, 0x70, 0x01, 0xC0, 0x70, 0xC0, 0x40, 0xB0, 0x09, 0xE0, 0x0F, 0x00, 0xE0, 0xB0, 0x0E, 0xE0,
+0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0E, 0xB0, 0x60, 0x0F, 0x00, 0x40, 0x09, 0x60, 0x40, 0xC0,
+0x71, 0x01, 0x10, 0x70, 0x01, 0x30, 0x40, 0x30, 0x90, 0x60, 0x00, 0x60, 0x80, 0xB0, 0x0F, 0x75,
+0x0F, 0x7E, 0xB0, 0x80, 0x90, 0x41, 0x10, 0xE0, 0x00, 0xB0, 0x80, 0x00, 0xB0, 0x30, 0xC0, 0x70,
+0x80, 0xB0, 0x05, 0xE0, 0xB0, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x00,
+0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x60, 0xB0, 0x05, 0x60, 0x80, 0x70, 0x10, 0x80, 0xB0, 0x00,
+0x30, 0x01, 0x80, 0x10, 0xE0, 0x40, 0x70, 0x40, 0xB0, 0x02, 0x30, 0x60, 0x80, 0x0F, 0x75, 0x0F,
+0x7B, 0x40, 0xC0, 0x70, 0x40, 0x01, 0xE0, 0x30, 0x10, 0x40, 0x00, 0x40, 0xE0, 0x01, 0x30, 0x00,
+0xB0, 0x40, 0x10, 0x70, 0x30, 0xB0, 0x02, 0xE0, 0x0F, 0x01, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00,
+0xE0, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0xB0, 0x60, 0x02, 0x60, 0x30, 0x70, 0x10,
+0x40, 0xB0, 0x60, 0x40, 0x01, 0x80, 0x60, 0x00, 0x80, 0x10, 0x80, 0x60, 0x01, 0x30, 0x70, 0x90,
+0x00, 0x80, 0x30, 0xE0, 0x0F, 0x75, 0x0F, 0x7B, 0x40, 0xB0, 0x00, 0x70, 0x60, 0x00, 0x60, 0x01,
+0x40, 0x30, 0xC0, 0xE0, 0x01, 0x90, 0x01, 0x60, 0x40, 0x00, 0x40, 0x11, 0x90, 0x80, 0xE0, 0x0F,
+0x00, 0xB0, 0xE0, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0xE0, 0x0F,
+0x01, 0x40, 0x80, 0x70, 0x10, 0x70, 0x40, 0x00, 0x80, 0xB0, 0x01, 0x90, 0x01, 0x80, 0xC0, 0x30,
+0xE0, 0x00, 0xE0, 0x60, 0x00, 0x40, 0x30, 0x00, 0x80, 0x30, 0x0F, 0x78, 0x0F, 0x7E, 0xC0, 0xB0,
+0x30, 0x90, 0x70, 0x80, 0x02, 0x40, 0x91, 0x30, 0x01, 0x30, 0x02, 0x30, 0x00, 0xB0, 0x30, 0xC1,
+0x90, 0x40, 0x60, 0x0B, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x40, 0x0F,
+0x00, 0x60, 0xB0, 0x0B, 0x60, 0x40, 0x70, 0xC0, 0x10, 0x40, 0x01, 0x80, 0x01, 0xE0, 0x40, 0x01,
+0x92, 0xE0, 0x02, 0x70, 0x80, 0x70, 0x60, 0x40, 0x80, 0x01, 0x10, 0xB0, 0x0F, 0x77, 0x0F, 0x7B,
+0xB0, 0x40, 0xC0, 0x40, 0xE0, 0x70, 0x00, 0xB0, 0x70, 0x00, 0xB0, 0x80, 0x40, 0x00, 0xB0, 0xE0,
+0x31, 0x70, 0xB0, 0x01, 0x30, 0x01, 0x40, 0x60, 0x00, 0x60, 0xC0, 0x90, 0x70, 0x90, 0x40, 0x60,
+0x07, 0xE0, 0xB0, 0x0E, 0xB0, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x60, 0xB0,
+0x06, 0xB0, 0x60, 0x40, 0x90, 0x72, 0xB0, 0x00, 0x40, 0xE0, 0x01, 0x90, 0x01, 0x60, 0x70, 0x31,
+0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0x30, 0x00, 0x60, 0x00, 0x60, 0x70, 0x01, 0x30, 0x40,
+0x0F, 0x77, 0x0F, 0x7A, 0x80, 0x70, 0x80, 0xB0, 0x00, 0x90, 0xE0, 0x00, 0xB0, 0x70, 0x00, 0xC0,
+0x40, 0x80, 0x30, 0x03, 0xE0, 0x80, 0x91, 0x40, 0x01, 0x90, 0x01, 0xB0, 0x80, 0x01, 0x80, 0x30,
+0x70, 0xC0, 0x70, 0x30, 0x40, 0x03, 0xE0, 0x0F, 0x00, 0xB0, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x00,
+0xE0, 0x0F, 0x00, 0xB0, 0x60, 0x03, 0x40, 0x30, 0x70, 0xC0, 0x91, 0x40, 0x01, 0x30, 0x02, 0x30,
+0x01, 0x80, 0x30, 0x90, 0x80, 0xE0, 0x04, 0x10, 0x80, 0x00, 0xE0, 0x31, 0x90, 0xC0, 0x00, 0x70,
+0x60, 0x00, 0x40, 0x80, 0x0F, 0x77, 0x0F, 0x79, 0x40, 0x10, 0x30, 0x01, 0xB0, 0x70, 0x01, 0x81,
+0x40, 0x80, 0x00, 0xB0, 0x70, 0x00, 0x30, 0x80, 0xE0, 0x02, 0xE0, 0x80, 0x30, 0x90, 0x70, 0x01,
+0xE0, 0x40, 0x01, 0x80, 0xB0, 0x01, 0x30, 0xE0, 0x80, 0xC0, 0x10, 0xC0, 0x30, 0x80, 0x60, 0x0E,
+0xB0, 0x60, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x80, 0x30, 0x70, 0x10, 0x70,
+0x80, 0xE0, 0x30, 0x01, 0x60, 0x80, 0x01, 0x80, 0x01, 0xB0, 0xC0, 0x31, 0x80, 0x60, 0x06, 0x80,
+0x30, 0x70, 0x01, 0x10, 0xE0, 0x00, 0x40, 0x30, 0x60, 0xC0, 0xB0, 0x70, 0xE0, 0x0F, 0x77, 0x0F,
+0x7B, 0x40, 0x70, 0x30, 0xB0, 0x70, 0x01, 0xC0, 0xB0, 0xC0, 0xB0, 0x00, 0xE0, 0x70, 0x00, 0x30,
+0x41, 0x06, 0x60, 0x31, 0x70, 0x80, 0xB0, 0x00, 0x90, 0x01, 0xE0, 0x40, 0x01, 0x80, 0x01, 0x30,
+0x10, 0x90, 0x70, 0x10, 0xC0, 0x30, 0x41, 0x60, 0x07, 0xB1, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE0,
+0x08, 0x60, 0x40, 0x80, 0x90, 0xC0, 0x10, 0x90, 0x70, 0x10, 0x80, 0x00, 0x60, 0x40, 0x01, 0x80,
+0xB0, 0x01, 0x90, 0x00, 0xB0, 0x30, 0x70, 0x90, 0x30, 0x60, 0x0A, 0xB0, 0x00, 0x90, 0xE0, 0x00,
+0x90, 0x40, 0x00, 0x60, 0x90, 0x00, 0xE0, 0x90, 0xE0, 0x0F, 0x78, 0x0F, 0x7F, 0x31, 0x70, 0x80,
+0xB0, 0x70, 0x01, 0x30, 0x40, 0x00, 0xB0, 0x60, 0x0A, 0xB0, 0xE0, 0x80, 0x91, 0x40, 0xB0, 0x80,
+0x60, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0x30, 0xB0, 0x60, 0x40, 0xC0, 0x91, 0xC1, 0x90, 0x30,
+0x40, 0xE0, 0x60, 0x40, 0xE0, 0xB0, 0x0E, 0xE0, 0x0F, 0x00, 0xE1, 0x60, 0xE0, 0x40, 0x30, 0x70,
+0xC0, 0x71, 0x90, 0x10, 0xE0, 0xB0, 0xE0, 0x80, 0x00, 0xB0, 0x10, 0x80, 0x00, 0xB0, 0x80, 0x01,
+0x41, 0x60, 0x40, 0x70, 0x90, 0x80, 0x60, 0xB0, 0x0F, 0x00, 0xE0, 0x90, 0x00, 0xB0, 0xC0, 0x30,
+0x70, 0xE0, 0x0F, 0x7C, 0x0F, 0x80, 0xE1, 0x00, 0xB0, 0x70, 0x00, 0x60, 0xC0, 0x0F, 0x03, 0xB0,
+0xE0, 0x80, 0x91, 0x30, 0xE0, 0x90, 0x01, 0xC0, 0x70, 0x01, 0x30, 0x01, 0xB0, 0x80, 0x01, 0x30,
+0x61, 0x40, 0x90, 0x40, 0x30, 0xC3, 0x71, 0x92, 0x31, 0x81, 0x44, 0x80, 0xE1, 0x41, 0x82, 0x30,
+0x94, 0x71, 0xC2, 0x30, 0x40, 0x70, 0x40, 0x60, 0xE0, 0x80, 0x01, 0x30, 0x01, 0xB0, 0x80, 0x01,
+0x10, 0x90, 0x01, 0x70, 0xE0, 0x30, 0x70, 0x30, 0x40, 0xE0, 0x0F, 0x05, 0xB0, 0xC0, 0x01, 0xB0,
+0xE0, 0xB0, 0x0F, 0x7D, 0x0F, 0x84, 0x40, 0xC1, 0x60, 0x0F, 0x09, 0x40, 0x80, 0x31, 0x10, 0xC0,
+0x60, 0xB0, 0x30, 0x01, 0x60, 0x40, 0x01, 0x90, 0x01, 0x60, 0x80, 0x01, 0x80, 0xB0, 0x01, 0x80,
+0x01, 0x30, 0x42, 0xC0, 0x40, 0x80, 0x70, 0x30, 0x80, 0x90, 0x10, 0x30, 0x80, 0x91, 0x80, 0x40,
+0xC0, 0xE1, 0x81, 0xB0, 0x00, 0x30, 0x01, 0x60, 0x40, 0x01, 0x30, 0x02, 0x30, 0x01, 0x80, 0xB0,
+0x01, 0x30, 0x00, 0xE0, 0x11, 0x31, 0x80, 0x60, 0xB0, 0x02, 0x30, 0x40, 0x0F, 0x05, 0x80, 0x60,
+0x0F, 0x81, 0x0F, 0xA0, 0x40, 0xB0, 0x01, 0xB0, 0x60, 0xB0, 0x40, 0x30, 0x90, 0x31, 0x70, 0x80,
+0x60, 0xB0, 0x90, 0x01, 0x60, 0x40, 0x01, 0x80, 0x01, 0xB0, 0x80, 0x01, 0x80, 0xB0, 0x01, 0x90,
+0x01, 0x80, 0xB0, 0x00, 0xE0, 0x10, 0xB0, 0x00, 0xE0, 0x40, 0x01, 0x90, 0x01, 0xE0, 0x40, 0x01,
+0x30, 0x01, 0xB0, 0x80, 0x01, 0x80, 0x02, 0x90, 0xB0, 0x60, 0x30, 0x90, 0x31, 0x90, 0x30, 0xE0,
+0x04, 0x72, 0x00, 0x80, 0xB0, 0x80, 0xB0, 0x0F, 0x97, 0x0F, 0x9E, 0x60, 0x90, 0x10, 0xB0, 0x00,
+0x80, 0xC0, 0x31, 0x02, 0xB0, 0x00, 0xB0, 0x60, 0x40, 0x80, 0x91, 0x30, 0x90, 0x30, 0x40, 0xE0,
+0x70, 0x60, 0xB0, 0xE0, 0x80, 0x01, 0x80, 0x02, 0x90, 0x01, 0x80, 0xB0, 0x00, 0xE0, 0x10, 0xB0,
+0x00, 0xE0, 0x40, 0x01, 0x90, 0x01, 0x60, 0x40, 0x01, 0x30, 0x60, 0xB0, 0xE0, 0x90, 0xE0, 0x40,
+0x90, 0x31, 0x91, 0x80, 0x40, 0x60, 0xB0, 0x00, 0x60, 0xB0, 0x00, 0x40, 0x90, 0x70, 0x10, 0x41,
+0x30, 0x00, 0x81, 0x00, 0x90, 0x80, 0x0F, 0x98, 0x0F, 0x9E, 0x60, 0xE0, 0x70, 0x00, 0xB0, 0xC0,
+0x01, 0x70, 0x61, 0xC0, 0x70, 0x80, 0x00, 0x60, 0x30, 0x60, 0x02, 0xB0, 0x60, 0xE0, 0x41, 0x81,
+0x33, 0xC0, 0x90, 0x31, 0x70, 0x80, 0x40, 0x70, 0x80, 0x40, 0x30, 0x10, 0x80, 0x40, 0x30, 0x90,
+0x40, 0x80, 0xC0, 0x30, 0x90, 0x71, 0x31, 0x90, 0x30, 0x80, 0x42, 0xE0, 0xB1, 0x07, 0xC0, 0x40,
+0x00, 0xE1, 0xB0, 0xC0, 0x00, 0x80, 0x40, 0x00, 0x60, 0x70, 0x0F, 0x9B, 0x0F, 0x9F, 0xB0, 0x70,
+0x00, 0xB0, 0x70, 0x01, 0xC0, 0x60, 0x70, 0xB0, 0x00, 0x70, 0xB0, 0x30, 0x00, 0x30, 0x0F, 0x02,
+0xB2, 0x62, 0xB1, 0x62, 0xB2, 0x0F, 0x07, 0x70, 0x90, 0x30, 0x02, 0xE0, 0x90, 0x00, 0x40, 0x30,
+0x00, 0xB0, 0x70, 0xB0, 0x0F, 0x9A, 0x0F, 0x9F, 0x40, 0x30, 0x01, 0x30, 0x70, 0x30, 0x10, 0xE0,
+0x70, 0x01, 0x70, 0x61, 0x90, 0xE0, 0x0F, 0x04, 0x80, 0xB0, 0x01, 0x30, 0x70, 0xE0, 0x01, 0x80,
+0x70, 0x40, 0x00, 0xB0, 0x30, 0x80, 0x0F, 0x04, 0xB0, 0x70, 0x02, 0x90, 0xE0, 0x00, 0x60, 0x70,
+0x01, 0x70, 0xB0, 0x0F, 0x9A, 0x0F, 0x9F, 0x30, 0x40, 0x00, 0x61, 0xB0, 0x60, 0x70, 0x40, 0x30,
+0x01, 0x70, 0xB0, 0x0F, 0x06, 0x30, 0x10, 0xB0, 0x00, 0x30, 0x80, 0x00, 0xC0, 0xB0, 0x40, 0x90,
+0x00, 0x70, 0xE1, 0x40, 0x80, 0x60, 0x0F, 0x04, 0xC0, 0x02, 0xC0, 0xB0, 0x01, 0x70, 0x41, 0x90,
+0x0F, 0x9B, 0x0F, 0x9F, 0x30, 0x60, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x40, 0x80, 0x00, 0x60,
+0x70, 0x0F, 0x06, 0xE0, 0x40, 0x70, 0xB0, 0x00, 0x81, 0x00, 0xC0, 0xB0, 0x30, 0xE0, 0x00, 0x40,
+0x30, 0x00, 0x80, 0x40, 0x0F, 0x05, 0xC0, 0x02, 0xC0, 0x02, 0xB0, 0x90, 0x30, 0xB0, 0x0F, 0x9B,
+0x0F, 0xA3, 0x60, 0x80, 0xE0, 0x00, 0x60, 0xC0, 0x00, 0x70, 0x40, 0x0F, 0x08, 0x70, 0xB0, 0x00,
+0x60, 0x10, 0xC0, 0x70, 0x00, 0x90, 0x60, 0x00, 0xE0, 0x90, 0x0F, 0x08, 0x90, 0xE0, 0x01, 0x30,
+0x0F, 0xA2, 0x0F, 0xA8, 0x60, 0x70, 0x40, 0x0F, 0x09, 0x70, 0xB0, 0x00, 0xC0, 0x60, 0x00, 0x30,
+0x40, 0x30, 0xE0, 0x00, 0x40, 0x30, 0x0F, 0xBF, 0x0F, 0xC4, 0x70, 0x60, 0x00, 0x70, 0x60, 0x00,
+0x30, 0x41, 0x80, 0x00, 0x30, 0x40, 0x0F, 0xBF, 0x0F, 0xC4, 0x90, 0xB0, 0x00, 0xE0, 0xC0, 0x71,
+0x01, 0x71, 0x90, 0x0F, 0xC0, 0x0F, 0xCE, 0xB0, 0x0F, 0xC1};
+
+const Map_Image EM29_16000_image = {432, 427, EM29_16000_palette, EM29_16000_rows, EM29_16000_data};
@@ -0,0 +1,4137 @@
+// Generated by maps/compress_map.py from EM29_4000.h, do not edit
+// Image Size : 431x428 pixels, 65346 bytes compressed from 368936
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t EM29_4000_palette[16] PROGMEM = {
+0xFFFF, 0x0041, 0x867C, 0x5B6D, 0x9D14, 0xCE99, 0x6D16, 0x29E8,
+0x7C30, 0xB5D7, 0x42AB, 0x7DB9, 0xE73C, 0x9E9C, 0x1925, 0x8E5C};
+
+const uint32_t EM29_4000_rows[428] PROGMEM = {
+0, 17, 43, 80, 114, 151, 194, 261, 336, 407, 488, 579,
+669, 768, 881, 985, 1084, 1183, 1300, 1410, 1512, 1624, 1736, 1851,
+1975, 2100, 2229, 2355, 2485, 2610, 2745, 2885, 3009, 3137, 3259, 3369,
+3473, 3585, 3697, 3819, 3933, 4065, 4196, 4333, 4467, 4609, 4742, 4886,
+5048, 5219, 5392, 5552, 5704, 5853, 5987, 6123, 6253, 6376, 6500, 6632,
+6753, 6892, 7018, 7154, 7288, 7417, 7549, 7683, 7821, 7965, 8118, 8297,
+8473, 8650, 8821, 8989, 9173, 9368, 9557, 9762, 9966, 10160, 10343, 10512,
+10690, 10860, 11037, 11212, 11371, 11534, 11705, 11885, 12060, 12225, 12401, 12564,
+12730, 12898, 13070, 13243, 13399, 13571, 13735, 13923, 14105, 14281, 14465, 14659,
+14850, 15041, 15229, 15430, 15632, 15837, 16019, 16207, 16385, 16566, 16742, 16920,
+17099, 17283, 17443, 17610, 17748, 17904, 18066, 18239, 18425, 18592, 18770, 18954,
+19148, 19326, 19505, 19689, 19870, 20049, 20238, 20414, 20592, 20770, 20951, 21140,
+21322, 21507, 21695, 21864, 22045, 22224, 22417, 22601, 22797, 22965, 23124, 23286,
+23445, 23591, 23755, 23922, 24086, 24272, 24472, 24653, 24845, 25033, 25217, 25374,
+25537, 25708, 25870, 26052, 26225, 26382, 26569, 26767, 26935, 27132, 27319, 27499,
+27692, 27875, 28048, 28212, 28383, 28527, 28673, 28824, 28968, 29121, 29272, 29450,
+29621, 29768, 29913, 30056, 30201, 30362, 30508, 30645, 30789, 30931, 31072, 31202,
+31328, 31466, 31602, 31738, 31886, 32013, 32116, 32205, 32288, 32381, 32491, 32609,
+32733, 32856, 33028, 33165, 33292, 33465, 33603, 33747, 33894, 34054, 34189, 34315,
+34448, 34577, 34699, 34829, 34977, 35115, 35259, 35403, 35544, 35712, 35859, 36019,
+36166, 36333, 36504, 36684, 36855, 37011, 37164, 37326, 37489, 37650, 37808, 37972,
+38142, 38314, 38484, 38661, 38824, 39007, 39205, 39373, 39564, 39748, 39921, 40098,
+40285, 40465, 40643, 40830, 41017, 41201, 41376, 41562, 41750, 41935, 42121, 42309,
+42498, 42701, 42901, 43097, 43288, 43475, 43670, 43874, 44063, 44253, 44436, 44635,
+44829, 45043, 45244, 45453, 45650, 45852, 46059, 46245, 46438, 46630, 46821, 47008,
+47208, 47411, 47603, 47800, 47996, 48209, 48413, 48609, 48813, 49022, 49219, 49419,
+49624, 49830, 50027, 50234, 50433, 50632, 50832, 51033, 51225, 51421, 51630, 51820,
+52016, 52197, 52374, 52550, 52741, 52915, 53094, 53271, 53433, 53599, 53763, 53937,
+54122, 54295, 54463, 54637, 54805, 54991, 55170, 55360, 55534, 55723, 55905, 56091,
+56263, 56444, 56633, 56821, 56988, 57155, 57324, 57482, 57630, 57790, 57927, 58070,
+58206, 58347, 58483, 58617, 58756, 58903, 59052, 59200, 59353, 59501, 59663, 59799,
+59952, 60102, 60266, 60419, 60571, 60734, 60883, 61026, 61155, 61280, 61414, 61542,
+61664, 61785, 61919, 62043, 62172, 62302, 62434, 62560, 62686, 62821, 62951, 63080,
+63206, 63331, 63447, 63558, 63655, 63729, 63812, 63892, 63971, 64050, 64135, 64226,
+64320, 64431, 64538, 64646, 64724, 64802, 64883, 64957, 65030, 65079, 65124, 65167,
+65213, 65255, 65285, 65305, 65322, 65334, 65338, 65342};
+
+const uint8_t EM29_4000_data[65346] PROGMEM = {
+0x0F, 0xAB, 0x40, 0x30, 0x80, 0x0F, 0x07, 0xC0, 0xE0, 0x01, 0xE0, 0x00, 0x40, 0x30, 0x90, 0x0F,
+0xC1, 0x0F, 0xA2, 0x50, 0x90, 0x80, 0x01, 0xA0, 0xE0, 0xA0, 0x00, 0x80, 0x90, 0x30, 0x0F, 0x07,
+0x50, 0x70, 0x01, 0x70, 0x50, 0x0F, 0x0F, 0x40, 0xC0, 0x0F, 0xA3, 0x0F, 0x9E, 0x50, 0x01, 0x90,
+0xE0, 0x30, 0x90, 0x00, 0x40, 0x30, 0x00, 0x30, 0x80, 0x00, 0x40, 0xC0, 0x0F, 0x07, 0x50, 0x70,
+0x01, 0x70, 0x50, 0x0F, 0x0D, 0x50, 0xA0, 0x10, 0xC0, 0x01, 0x40, 0x80, 0x02, 0xC0, 0x0F, 0x9B,
+0x0F, 0x9C, 0x50, 0xE0, 0x30, 0xE0, 0x00, 0x90, 0x80, 0x02, 0x30, 0x40, 0x00, 0xC0, 0xE0, 0x0F,
+0x0A, 0xC0, 0xE0, 0x01, 0xE0, 0x0F, 0x0E, 0x90, 0x40, 0x70, 0x01, 0x31, 0x40, 0x70, 0x00, 0x82,
+0x0F, 0x9A, 0x0F, 0x9C, 0x30, 0x50, 0x00, 0x70, 0x50, 0x90, 0x10, 0xA0, 0x10, 0x80, 0x40, 0x80,
+0x01, 0x10, 0x0F, 0x0B, 0x80, 0xA0, 0x70, 0x80, 0x0F, 0x0F, 0x50, 0xA0, 0x00, 0xC0, 0xE0, 0x01,
+0xE0, 0x00, 0x80, 0x40, 0x80, 0x0F, 0x9A, 0x0F, 0x9E, 0x30, 0x10, 0xC1, 0x90, 0x01, 0xE0, 0x50,
+0x70, 0x01, 0xE0, 0x0B, 0xC2, 0x50, 0x92, 0x42, 0x82, 0x30, 0x81, 0x71, 0x81, 0x30, 0x83, 0x41,
+0x92, 0x50, 0xC0, 0x50, 0xC0, 0x0F, 0x00, 0x40, 0x30, 0x00, 0x90, 0x30, 0x01, 0xE0, 0x01, 0x50,
+0x0F, 0x9B, 0x0F, 0x9E, 0x50, 0x40, 0xE0, 0x00, 0x50, 0x01, 0xE0, 0x00, 0xE0, 0x51, 0x70, 0x02,
+0xC1, 0x50, 0x41, 0x80, 0x30, 0xA0, 0x70, 0x30, 0x80, 0x70, 0x80, 0x41, 0x70, 0x91, 0x30, 0x40,
+0xC1, 0xA0, 0x50, 0x00, 0x70, 0xE0, 0xC1, 0xA0, 0x50, 0xC0, 0x90, 0xA0, 0x50, 0x90, 0xA0, 0x80,
+0x40, 0x80, 0x70, 0x80, 0x30, 0xA0, 0x70, 0xA0, 0x81, 0x40, 0x50, 0xC1, 0x06, 0x30, 0x40, 0x00,
+0x81, 0x01, 0x10, 0x0F, 0x9E, 0x0F, 0x9D, 0x50, 0x01, 0x70, 0x50, 0x10, 0x80, 0xA0, 0x80, 0x00,
+0xC0, 0x70, 0xE0, 0xA0, 0x30, 0xA0, 0x30, 0xA0, 0x70, 0x40, 0x90, 0xE0, 0xC0, 0x00, 0xC0, 0x80,
+0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x40, 0x90, 0x01, 0xA0, 0x01, 0x70, 0xE0, 0x01, 0x30, 0x02,
+0x30, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x40, 0x50, 0x00, 0xC0, 0x70, 0x90, 0x40, 0x70, 0xA0,
+0x30, 0xA1, 0x80, 0x40, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x40, 0x30, 0x00, 0x90, 0xA0, 0x0F, 0x9E,
+0x0F, 0x87, 0x80, 0x30, 0xA0, 0x0F, 0x03, 0xE0, 0x40, 0x80, 0x30, 0x00, 0x50, 0x70, 0xA0, 0x80,
+0xA0, 0x70, 0x30, 0x90, 0x00, 0x30, 0x02, 0x30, 0x01, 0x30, 0x02, 0x30, 0x01, 0x40, 0x90, 0x01,
+0xA0, 0x01, 0x91, 0x01, 0x30, 0x01, 0x70, 0xE0, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x30, 0x01,
+0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x01, 0x40, 0x50, 0x01, 0x30, 0xC0, 0x90, 0x30, 0x10,
+0x31, 0x81, 0xE0, 0xA0, 0xE0, 0x0F, 0x9F, 0x0F, 0x83, 0x50, 0x30, 0x80, 0x00, 0x41, 0x30, 0x0F,
+0x03, 0x90, 0x71, 0xA0, 0x70, 0x41, 0x10, 0x40, 0x00, 0x50, 0x40, 0x01, 0x30, 0xC0, 0x01, 0xA0,
+0x01, 0x40, 0xC0, 0x00, 0xC0, 0xA0, 0x51, 0x80, 0x30, 0x41, 0xE0, 0x80, 0x30, 0xE1, 0x70, 0x12,
+0xE0, 0x10, 0xE1, 0xA0, 0x70, 0x10, 0xE2, 0x70, 0xA0, 0x10, 0x30, 0x81, 0xA0, 0x90, 0x50, 0xA0,
+0x50, 0x00, 0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0xA0, 0x01, 0x91, 0x00, 0x50, 0x10, 0x80, 0x90,
+0x70, 0xE0, 0x80, 0x40, 0x50, 0xC0, 0x0F, 0x9B, 0x0F, 0x83, 0x70, 0x50, 0x80, 0xA0, 0x00, 0x90,
+0xC0, 0x0D, 0xC0, 0x90, 0x80, 0xA0, 0x30, 0xE0, 0x50, 0xC0, 0x90, 0x40, 0x00, 0xC0, 0x10, 0x80,
+0x01, 0x30, 0x01, 0x80, 0x50, 0x00, 0xC0, 0xE0, 0x70, 0xE3, 0x10, 0xE0, 0xA1, 0x71, 0x80, 0x61,
+0xB0, 0x70, 0x90, 0x01, 0x70, 0x40, 0x80, 0xE0, 0x51, 0x90, 0x30, 0x80, 0x40, 0xC2, 0x52, 0x92,
+0x40, 0x80, 0xA0, 0x73, 0xE0, 0xA0, 0x40, 0xA0, 0x50, 0x01, 0xA0, 0x01, 0x30, 0x01, 0x90, 0x10,
+0xC0, 0x00, 0x50, 0x40, 0xC0, 0x50, 0x70, 0x30, 0xA0, 0x80, 0x90, 0xC0, 0x0F, 0x04, 0x50, 0x80,
+0x50, 0x0F, 0x80, 0x0F, 0x7F, 0x50, 0xE0, 0x00, 0xC0, 0x70, 0x01, 0xE0, 0xC0, 0x0C, 0x90, 0x30,
+0xA0, 0x80, 0x30, 0x80, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x10, 0x70, 0x01, 0x70, 0x80, 0xA0,
+0x13, 0xA0, 0x31, 0x60, 0xD1, 0x61, 0xD1, 0x61, 0xD1, 0xF0, 0xD0, 0xA0, 0x40, 0x30, 0x90, 0x10,
+0xD0, 0xA0, 0xC1, 0x50, 0xC0, 0xA0, 0xD0, 0xA0, 0x0B, 0x80, 0x30, 0x02, 0x90, 0xE0, 0x80, 0x30,
+0xA1, 0x70, 0xA0, 0x80, 0xE0, 0x01, 0x30, 0x10, 0x01, 0x40, 0x50, 0x01, 0xA0, 0x01, 0x40, 0x30,
+0x80, 0xA0, 0x30, 0x40, 0x0F, 0x00, 0x50, 0x10, 0x90, 0x70, 0x40, 0x0F, 0x7F, 0x0F, 0x7B, 0x50,
+0x02, 0x40, 0x10, 0x90, 0x00, 0xE0, 0x01, 0x40, 0x30, 0x08, 0x90, 0x30, 0xA1, 0x40, 0xA0, 0x02,
+0x30, 0x01, 0x40, 0x50, 0x01, 0x70, 0x40, 0x30, 0x11, 0x70, 0xA0, 0x80, 0xB0, 0xD0, 0x61, 0xB0,
+0xD7, 0x60, 0xF1, 0xD1, 0xF1, 0xD0, 0xF0, 0xD0, 0x62, 0xF0, 0xD0, 0x60, 0x10, 0xC1, 0x00, 0xA0,
+0x50, 0xA0, 0x00, 0x50, 0x01, 0x41, 0x03, 0x50, 0x00, 0x80, 0x10, 0x90, 0xC0, 0x30, 0x70, 0xB0,
+0xD5, 0xB0, 0x60, 0xA0, 0x70, 0xE0, 0x10, 0x80, 0x90, 0x70, 0x01, 0xC0, 0x80, 0x01, 0x40, 0x50,
+0x01, 0xA0, 0x40, 0xA1, 0x30, 0x40, 0xC0, 0x0D, 0xC0, 0xE0, 0x00, 0x30, 0xE0, 0x40, 0x0F, 0x7B,
+0x0F, 0x79, 0x90, 0xE0, 0xA1, 0x01, 0x30, 0x80, 0xA0, 0x00, 0xA0, 0x90, 0x00, 0xC0, 0x70, 0x04,
+0x50, 0x40, 0x70, 0x30, 0x40, 0x90, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x00, 0x50, 0x80, 0xE1,
+0x70, 0xA0, 0x80, 0xC1, 0x30, 0xD2, 0xF0, 0xD1, 0xF0, 0x24, 0xF1, 0x20, 0xF0, 0x60, 0xF1, 0xD0,
+0xF5, 0xD3, 0xF0, 0xD0, 0x60, 0x70, 0x40, 0x50, 0x70, 0xD0, 0x80, 0x70, 0x10, 0xC1, 0x10, 0xA0,
+0x00, 0x90, 0x80, 0x30, 0x10, 0xA0, 0x30, 0x60, 0x80, 0xA0, 0x60, 0xD1, 0xF7, 0xD1, 0xB0, 0x90,
+0x40, 0x80, 0xA0, 0x70, 0x30, 0xA0, 0x30, 0xC0, 0x00, 0x80, 0x02, 0x30, 0x01, 0x41, 0x90, 0x30,
+0x70, 0x40, 0x50, 0x09, 0x50, 0xE0, 0x40, 0x80, 0x30, 0x00, 0x70, 0x50, 0x00, 0x90, 0x50, 0x0F,
+0x77, 0x0F, 0x79, 0x70, 0x50, 0x00, 0x70, 0xC0, 0x00, 0xA0, 0x00, 0xE0, 0x90, 0x50, 0x70, 0x00,
+0x50, 0xA0, 0x01, 0x50, 0x80, 0x70, 0x80, 0x50, 0x30, 0xC0, 0x01, 0xA0, 0x01, 0x50, 0x80, 0xC0,
+0x80, 0xE0, 0x71, 0x80, 0x51, 0x04, 0x81, 0xD0, 0xFD, 0xB0, 0xF6, 0x20, 0xF1, 0x20, 0xD0, 0x30,
+0x70, 0xD0, 0x60, 0x70, 0x80, 0x30, 0x60, 0xD1, 0x60, 0xB0, 0xA1, 0x60, 0xA2, 0x31, 0x60, 0xB1,
+0xD4, 0xF1, 0x20, 0xF4, 0x20, 0xF0, 0xD0, 0x60, 0xD4, 0xB0, 0x60, 0x80, 0x30, 0xA0, 0xE0, 0x40,
+0xC0, 0x40, 0x90, 0x01, 0x30, 0x02, 0xA0, 0x50, 0x80, 0xA0, 0x30, 0x50, 0x04, 0x90, 0x71, 0x90,
+0x00, 0x10, 0x01, 0x30, 0x90, 0x41, 0x30, 0x0F, 0x77, 0x0F, 0x79, 0x50, 0x00, 0x30, 0x10, 0x40,
+0x50, 0x70, 0xA0, 0x10, 0xA0, 0x00, 0x40, 0xE0, 0x70, 0x40, 0x30, 0xA0, 0x80, 0x90, 0x30, 0x01,
+0x40, 0x90, 0x01, 0x80, 0x50, 0x80, 0x70, 0x10, 0xA0, 0x40, 0xC0, 0x09, 0x40, 0xA0, 0xD0, 0xF4,
+0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0xB1, 0xF3, 0x24, 0xD1, 0xB1, 0xD0, 0xF0, 0x60, 0xB0, 0xD2,
+0xF0, 0xDA, 0xB1, 0xF4, 0xD6, 0xF2, 0xD0, 0x60, 0xD0, 0xF1, 0x20, 0xF2, 0xD3, 0x60, 0xA0, 0x70,
+0xA0, 0x40, 0x00, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x80, 0x40, 0x80, 0xA1, 0x90, 0x00, 0xA0, 0x70,
+0xC0, 0x01, 0x40, 0x30, 0x01, 0x70, 0x50, 0x90, 0x30, 0xA0, 0x0F, 0x77, 0x0F, 0x7B, 0x50, 0x00,
+0xE0, 0x80, 0x30, 0x50, 0xC0, 0x70, 0x00, 0x50, 0x80, 0x30, 0x40, 0x80, 0x50, 0x01, 0xA0, 0x02,
+0x30, 0x90, 0xA0, 0x10, 0x70, 0x40, 0x0B, 0x90, 0x30, 0x70, 0xA0, 0x30, 0x80, 0xD1, 0x20, 0xF5,
+0x20, 0xF1, 0xD1, 0xF0, 0xB0, 0xF1, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xD1, 0xB0, 0x60, 0xD1, 0xF1,
+0x40, 0x80, 0xA0, 0x30, 0xD3, 0xF2, 0xD0, 0xF0, 0xD2, 0xB1, 0xD4, 0x30, 0xA0, 0x30, 0xA3, 0xD1,
+0xF1, 0x60, 0xD0, 0xF1, 0x22, 0xF3, 0xD4, 0x60, 0x71, 0x30, 0x40, 0x30, 0x02, 0xA0, 0x01, 0xC0,
+0x30, 0x40, 0xA0, 0x70, 0x10, 0x70, 0x80, 0x00, 0x30, 0x90, 0x00, 0x50, 0xE0, 0x0F, 0x7B, 0x0F,
+0x7A, 0xC0, 0x01, 0x80, 0x40, 0x01, 0xC0, 0x80, 0xA0, 0x80, 0xA0, 0x01, 0x50, 0x80, 0x01, 0x90,
+0x80, 0x40, 0xA2, 0x70, 0x00, 0x50, 0x09, 0x90, 0x30, 0xE1, 0x70, 0xA0, 0x80, 0x90, 0x30, 0xB0,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0x60, 0xD0, 0x60, 0x31, 0xB0, 0xD0, 0x20, 0xF0, 0xD0,
+0x20, 0xD1, 0x61, 0x31, 0x10, 0xD0, 0xF0, 0xD0, 0x60, 0x30, 0x40, 0xC0, 0x50, 0x10, 0xA1, 0x30,
+0xD0, 0xF1, 0xD0, 0xF0, 0x80, 0x32, 0xB0, 0xD0, 0x60, 0xA2, 0xE0, 0x00, 0x50, 0xC0, 0x01, 0x90,
+0xA0, 0xB0, 0xD0, 0xB1, 0xF0, 0xD0, 0xF1, 0x20, 0xF1, 0x21, 0xF3, 0x20, 0xF0, 0xD0, 0xB2, 0x60,
+0xA1, 0x80, 0x40, 0x80, 0x01, 0x40, 0x90, 0x01, 0x30, 0x40, 0xA0, 0x70, 0x50, 0x40, 0x80, 0x00,
+0x70, 0x40, 0x0F, 0x7B, 0x0F, 0x7A, 0x80, 0x70, 0x40, 0x70, 0xC0, 0x90, 0xA0, 0xE0, 0x10, 0x01,
+0x30, 0xC0, 0x01, 0xA0, 0xC0, 0x80, 0x70, 0xA0, 0x60, 0xF0, 0xD1, 0xA0, 0xC0, 0x90, 0x07, 0xC0,
+0x70, 0xA0, 0x70, 0x80, 0x50, 0x02, 0x50, 0x80, 0xB0, 0xD2, 0xF4, 0xD0, 0x70, 0xB0, 0xA0, 0xC0,
+0x50, 0xA0, 0xB0, 0xD0, 0xF0, 0xD1, 0xB0, 0xA0, 0x11, 0xE0, 0xA0, 0x70, 0xA0, 0xD1, 0xA0, 0xC0,
+0x02, 0x50, 0x01, 0xA0, 0xB0, 0xD1, 0xB0, 0x70, 0x40, 0xC0, 0x00, 0x30, 0x90, 0x80, 0xA0, 0x01,
+0xC0, 0x10, 0x05, 0xC0, 0xE0, 0xB2, 0xF0, 0x21, 0xF3, 0x21, 0xF3, 0xD0, 0xF1, 0x60, 0xF1, 0xD1,
+0xF0, 0x60, 0xA0, 0x70, 0x80, 0xC0, 0xA0, 0x01, 0xC0, 0x30, 0x01, 0xE0, 0x10, 0xA0, 0xE1, 0x40,
+0x0F, 0x7C, 0x0F, 0x7B, 0x90, 0xA0, 0x70, 0xE0, 0x90, 0x00, 0x80, 0x10, 0xC0, 0x00, 0xC0, 0x80,
+0x50, 0x30, 0x70, 0xA0, 0x60, 0xD3, 0xF1, 0xD0, 0xA0, 0x90, 0xC0, 0x05, 0x90, 0x70, 0x80, 0x30,
+0x05, 0x90, 0x70, 0xA0, 0x70, 0xB0, 0xD5, 0x60, 0x70, 0x40, 0xA0, 0x01, 0xA0, 0x60, 0xD0, 0xF2,
+0x70, 0x10, 0x01, 0x90, 0xC0, 0x00, 0xA0, 0xB0, 0x60, 0x70, 0x30, 0x05, 0x70, 0xD0, 0xF0, 0xD0,
+0x70, 0x02, 0x40, 0xA0, 0x80, 0x10, 0x80, 0x02, 0x70, 0xE0, 0x80, 0x05, 0x70, 0xB0, 0xF3, 0x20,
+0xFB, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0xD2, 0x60, 0x30, 0x70, 0xA0, 0x50, 0x40, 0x90, 0x01, 0x10,
+0x30, 0x00, 0x50, 0xE0, 0x30, 0x40, 0x0F, 0x7B, 0x0F, 0x7A, 0x80, 0xA0, 0x40, 0x00, 0x40, 0x50,
+0x01, 0x10, 0x30, 0xC0, 0x80, 0xE0, 0x30, 0xB0, 0xD2, 0xF0, 0xD0, 0x20, 0xF1, 0xD1, 0x30, 0x40,
+0x50, 0x03, 0xC0, 0xE0, 0x30, 0xD0, 0x31, 0x04, 0xC0, 0x70, 0xE0, 0x40, 0x00, 0xE0, 0xB0, 0x60,
+0x70, 0x30, 0xD0, 0xF0, 0xE0, 0x90, 0x30, 0x10, 0x90, 0x00, 0xA0, 0xF0, 0xD0, 0xF0, 0xD0, 0x60,
+0x30, 0x80, 0x03, 0x30, 0x70, 0xD0, 0x80, 0x40, 0xC0, 0x04, 0x80, 0x60, 0xD1, 0xA0, 0x50, 0x02,
+0xA0, 0x40, 0x10, 0x50, 0x90, 0x03, 0x30, 0xE0, 0x01, 0x80, 0xA0, 0xE0, 0x10, 0x80, 0x60, 0xF0,
+0xD0, 0x22, 0xF7, 0x23, 0xB0, 0xF7, 0xD3, 0x30, 0xE0, 0x30, 0x50, 0x40, 0x10, 0xC0, 0x00, 0xC0,
+0x80, 0x00, 0x40, 0x70, 0x80, 0xC0, 0x0F, 0x78, 0x0F, 0x77, 0x50, 0x80, 0xA0, 0x50, 0xA0, 0x02,
+0x30, 0x00, 0xC0, 0xE1, 0x30, 0x40, 0xD2, 0xB0, 0xF0, 0xD0, 0xF0, 0x20, 0xF3, 0xD0, 0x30, 0x91,
+0x03, 0x70, 0xD1, 0xA0, 0x30, 0xC0, 0x05, 0x80, 0x90, 0x02, 0x70, 0xB0, 0xA0, 0x70, 0xD0, 0x90,
+0x30, 0x01, 0x40, 0xE0, 0x90, 0x30, 0xF1, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0xE0, 0x02, 0x70, 0x80,
+0xD0, 0x60, 0x80, 0x50, 0x03, 0xC0, 0x70, 0xD1, 0xB0, 0x70, 0x02, 0xC0, 0xA0, 0x80, 0xE0, 0x10,
+0xA0, 0x03, 0x90, 0x70, 0xA0, 0x30, 0x80, 0xA0, 0x40, 0x50, 0x70, 0x30, 0xA0, 0x60, 0xD0, 0xF0,
+0xD0, 0xF0, 0x23, 0xF2, 0x22, 0xB0, 0xF4, 0xD0, 0xF6, 0xD1, 0xB0, 0x30, 0xE0, 0x10, 0x50, 0x00,
+0x30, 0x02, 0xA0, 0x50, 0x31, 0x90, 0x0F, 0x76, 0x0F, 0x65, 0x50, 0xA0, 0x40, 0x0C, 0x90, 0xA1,
+0x80, 0x01, 0x80, 0x90, 0x01, 0x70, 0xE1, 0x70, 0x30, 0x70, 0x40, 0xB0, 0xD1, 0xE0, 0x80, 0xD0,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x30, 0xC0, 0x90, 0x02, 0x90, 0xA0, 0xD0, 0xA0, 0x50, 0x07,
+0x90, 0x03, 0x70, 0x40, 0x70, 0x80, 0xA0, 0x40, 0x80, 0x02, 0xA0, 0x70, 0xB0, 0xF1, 0xB0, 0xE0,
+0x30, 0xD0, 0x70, 0x80, 0x01, 0xA0, 0x80, 0x70, 0x30, 0x40, 0x30, 0xC0, 0x03, 0x50, 0x30, 0xD1,
+0x60, 0x90, 0x02, 0x40, 0x80, 0xA0, 0x10, 0x70, 0x90, 0x04, 0x70, 0x42, 0x80, 0x02, 0x90, 0x00,
+0x70, 0xB0, 0xF2, 0x22, 0xF6, 0x60, 0xD0, 0xF2, 0x20, 0xF7, 0x20, 0xF0, 0xD1, 0x61, 0x30, 0xA0,
+0x70, 0x01, 0xC0, 0x30, 0x01, 0x40, 0x70, 0xA0, 0x40, 0x0F, 0x74, 0x0F, 0x65, 0xA0, 0x00, 0x30,
+0x0A, 0x80, 0xE0, 0x80, 0x01, 0xA0, 0x02, 0xA0, 0x30, 0xE0, 0x41, 0x50, 0x90, 0x51, 0x70, 0x30,
+0xD0, 0xB0, 0x30, 0xA0, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xD0, 0xA0, 0x60, 0x30, 0xA3, 0xD0, 0xF0,
+0xE0, 0xC0, 0x07, 0x51, 0x01, 0x13, 0x00, 0x30, 0x80, 0x30, 0x02, 0x80, 0x60, 0xB0, 0xF0, 0xD0,
+0x70, 0x00, 0x70, 0x90, 0x70, 0x30, 0x00, 0x50, 0xE0, 0x30, 0xE0, 0x30, 0x80, 0x40, 0xC0, 0x03,
+0x80, 0x60, 0xD1, 0x80, 0x90, 0x02, 0x70, 0x50, 0x80, 0x00, 0x80, 0x40, 0x03, 0xC0, 0xE0, 0x30,
+0x81, 0xE0, 0xA0, 0x90, 0xC0, 0x50, 0x30, 0x10, 0x80, 0xA0, 0xD6, 0xF2, 0xD0, 0xF0, 0xB0, 0xD0,
+0xF1, 0x21, 0xF1, 0x20, 0xF3, 0x21, 0xF2, 0x60, 0xD1, 0xF0, 0x80, 0xA0, 0x30, 0xA0, 0xC0, 0x01,
+0xA0, 0x01, 0x40, 0xE0, 0x30, 0x0F, 0x72, 0x0F, 0x62, 0x70, 0xE0, 0x40, 0xC0, 0x30, 0x90, 0x08,
+0x80, 0xA0, 0x51, 0x40, 0x01, 0x40, 0x90, 0x40, 0xE0, 0x30, 0xA0, 0x90, 0x10, 0xE0, 0x10, 0x30,
+0xE0, 0x71, 0x40, 0xB0, 0x70, 0xA0, 0x30, 0xD0, 0xF0, 0x23, 0xF2, 0x60, 0xB1, 0xD2, 0xF0, 0xD0,
+0x60, 0x11, 0x07, 0x90, 0x00, 0xC0, 0x40, 0xC0, 0x02, 0x82, 0x02, 0x40, 0x60, 0xB0, 0xF0, 0xD0,
+0x70, 0x00, 0x50, 0x70, 0xA0, 0x04, 0x10, 0x30, 0x40, 0x80, 0xC0, 0x30, 0xA1, 0x80, 0xA0, 0xD2,
+0xA0, 0x90, 0x02, 0x81, 0xA0, 0x06, 0x30, 0x10, 0xE0, 0x10, 0x70, 0x10, 0x80, 0x70, 0x50, 0x80,
+0xE0, 0xA0, 0x00, 0x71, 0xD0, 0x30, 0x70, 0xA0, 0x80, 0xD0, 0xF1, 0x20, 0xF0, 0xB1, 0xF4, 0x23,
+0xF2, 0x22, 0xF0, 0xB1, 0xF2, 0xD1, 0xF0, 0xA1, 0x40, 0x50, 0x80, 0x01, 0x50, 0x40, 0xC0, 0xA0,
+0x30, 0xC0, 0x0F, 0x6F, 0x0F, 0x61, 0xA0, 0x90, 0x00, 0x70, 0x40, 0x07, 0xC0, 0x80, 0x30, 0xE0,
+0x02, 0xA0, 0x00, 0x50, 0x30, 0x10, 0x81, 0x10, 0xE1, 0xA0, 0xE0, 0x10, 0x70, 0x90, 0x40, 0xE1,
+0xA0, 0xC0, 0x00, 0x30, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0x60, 0xF2, 0x20, 0xD1, 0x70,
+0xA0, 0x92, 0xC0, 0x03, 0x40, 0x06, 0x30, 0x80, 0x40, 0x02, 0x40, 0x60, 0xB0, 0xF0, 0xD0, 0xB0,
+0x70, 0x07, 0x30, 0x70, 0x50, 0xA0, 0xC0, 0x50, 0x70, 0xD0, 0x60, 0xD1, 0xF1, 0x70, 0x04, 0xA0,
+0x30, 0x70, 0xE0, 0x05, 0xE1, 0x90, 0x80, 0x11, 0xC0, 0x50, 0x40, 0x30, 0x80, 0x12, 0x70, 0x10,
+0x90, 0x00, 0x80, 0x30, 0xD1, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x24, 0xF1, 0x22,
+0xF0, 0x60, 0xF5, 0xD1, 0xF0, 0x60, 0x70, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x01, 0xA0, 0x31, 0x50,
+0x0A, 0xC0, 0x81, 0x0F, 0x5F, 0x0F, 0x61, 0x70, 0xC0, 0x00, 0xC0, 0x10, 0x05, 0xC0, 0x30, 0x70,
+0x50, 0x00, 0x90, 0x40, 0x01, 0x30, 0x70, 0xE0, 0x40, 0x00, 0x50, 0x11, 0x90, 0x01, 0xE0, 0x30,
+0x01, 0xC0, 0x80, 0x90, 0x02, 0x70, 0xF1, 0xD1, 0xF0, 0x21, 0xF3, 0x60, 0xF1, 0x21, 0xD0, 0xB0,
+0x80, 0x30, 0x70, 0xE0, 0x11, 0xC0, 0x02, 0x40, 0x06, 0x82, 0x02, 0x50, 0x30, 0xB1, 0xF0, 0xD0,
+0x31, 0x50, 0x06, 0xA0, 0x90, 0x30, 0xC0, 0x00, 0xA0, 0xD1, 0xF2, 0x60, 0x80, 0x04, 0x30, 0x40,
+0xE0, 0x10, 0x90, 0x04, 0xE0, 0x80, 0x00, 0xC0, 0x90, 0x70, 0x80, 0x90, 0x00, 0x50, 0x00, 0x10,
+0x70, 0xE0, 0x11, 0x50, 0x00, 0x50, 0xE0, 0x70, 0xB2, 0x60, 0xF3, 0x26, 0xF5, 0x60, 0xD0, 0xF7,
+0xD1, 0x60, 0xA1, 0x30, 0x01, 0x90, 0x40, 0x00, 0xC0, 0xA0, 0x30, 0x50, 0x08, 0x40, 0x80, 0x40,
+0xA0, 0x0F, 0x5E, 0x0F, 0x5D, 0x40, 0xE1, 0xC0, 0x40, 0xA0, 0x01, 0x30, 0x40, 0x02, 0xC0, 0x31,
+0xC0, 0xA0, 0x02, 0xA0, 0x40, 0xE0, 0xA0, 0x50, 0x03, 0x70, 0x40, 0xC0, 0x01, 0x50, 0x03, 0x90,
+0x02, 0xC0, 0xA0, 0xD1, 0x60, 0xA0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xB1, 0xF2, 0x60, 0xA0, 0x41,
+0x90, 0x50, 0x05, 0x90, 0x06, 0x80, 0x40, 0xA0, 0x02, 0x50, 0x30, 0xB1, 0xD0, 0xF0, 0xD0, 0x80,
+0x70, 0xC0, 0x04, 0x50, 0xA0, 0x50, 0x30, 0x51, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x70,
+0x04, 0x30, 0xA0, 0x50, 0xC0, 0x10, 0x04, 0xC0, 0x05, 0x40, 0x03, 0x10, 0x40, 0x11, 0x00, 0xC0,
+0x11, 0x40, 0x70, 0x10, 0xA0, 0x30, 0x70, 0x60, 0xD0, 0xF0, 0x28, 0xF1, 0xD0, 0xB1, 0xD0, 0xF5,
+0x20, 0xD0, 0xF1, 0xD1, 0xB0, 0x30, 0x70, 0x90, 0x30, 0x02, 0xA0, 0x50, 0x80, 0xA0, 0xC0, 0x09,
+0xE0, 0x01, 0xC0, 0x0F, 0x5B, 0x0F, 0x5C, 0xC0, 0xE0, 0x00, 0x40, 0x30, 0x00, 0x10, 0x50, 0x00,
+0x50, 0xA0, 0x01, 0x30, 0x70, 0x40, 0x01, 0x90, 0x40, 0x00, 0x40, 0x10, 0xA0, 0x05, 0x50, 0x10,
+0xC0, 0x07, 0x40, 0x02, 0xC0, 0xA0, 0xD0, 0xB0, 0xE0, 0x10, 0xB0, 0xF3, 0x21, 0xB0, 0x60, 0x21,
+0xF0, 0x60, 0x80, 0x09, 0x90, 0xC0, 0x05, 0x40, 0x10, 0x80, 0x02, 0xC0, 0xA0, 0xF0, 0xB0, 0xD3,
+0xB0, 0xA0, 0x04, 0x50, 0xA0, 0xD0, 0x80, 0xA1, 0xB0, 0xD0, 0xF2, 0xD0, 0xB0, 0x30, 0x04, 0x90,
+0xA0, 0x30, 0x0D, 0x40, 0x03, 0x40, 0x00, 0x40, 0x30, 0x00, 0x30, 0x10, 0x80, 0x40, 0x10, 0xE0,
+0x40, 0x00, 0x50, 0x31, 0xB0, 0xD0, 0x23, 0xF0, 0x22, 0xF2, 0x60, 0xFE, 0xD1, 0x30, 0xE0, 0x40,
+0x00, 0x50, 0x80, 0x01, 0x90, 0x70, 0x30, 0xC0, 0x04, 0xC0, 0xE1, 0x80, 0xC0, 0x10, 0x70, 0xE0,
+0x0F, 0x5A, 0x0F, 0x59, 0x80, 0xA0, 0x50, 0xC0, 0x30, 0x00, 0x70, 0xE0, 0x40, 0x50, 0xE0, 0x40,
+0xA0, 0x40, 0x80, 0xA0, 0xC0, 0x00, 0xA0, 0xC0, 0x01, 0x10, 0xE0, 0x10, 0x00, 0x90, 0x0F, 0x01,
+0x51, 0x02, 0x70, 0x40, 0x10, 0x40, 0x70, 0xD3, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0x21, 0xF0, 0xD0,
+0xA0, 0x90, 0x08, 0xC0, 0x50, 0x0C, 0xA0, 0xF0, 0x60, 0xD1, 0xF0, 0xD1, 0x30, 0x80, 0x00, 0x90,
+0xC0, 0x00, 0x80, 0xA0, 0x50, 0x30, 0xE0, 0x30, 0xD0, 0xF0, 0xD0, 0xF2, 0xB0, 0x30, 0x04, 0xC0,
+0x30, 0x70, 0x30, 0x90, 0x0A, 0xC0, 0x50, 0x08, 0x40, 0x10, 0x00, 0x10, 0x40, 0xE0, 0x30, 0x50,
+0xE0, 0x70, 0x80, 0xA0, 0x60, 0xD0, 0xF3, 0x22, 0xF0, 0xD0, 0xB1, 0xF0, 0x21, 0xF8, 0x21, 0xF0,
+0xD0, 0xF0, 0x60, 0xD0, 0xE1, 0x10, 0x02, 0x70, 0x00, 0xC0, 0x31, 0xC0, 0x00, 0x81, 0x00, 0x50,
+0xA0, 0x00, 0x10, 0x50, 0x00, 0x30, 0x40, 0x0F, 0x59, 0x0F, 0x58, 0x30, 0x80, 0x50, 0xE0, 0x01,
+0xC0, 0x90, 0x50, 0xE0, 0xC1, 0x30, 0xA0, 0x30, 0x41, 0x01, 0x50, 0x80, 0x40, 0xE0, 0x80, 0x30,
+0x40, 0x00, 0x50, 0xC0, 0x0F, 0x01, 0x40, 0x02, 0x30, 0x10, 0x90, 0xC0, 0xE0, 0xD0, 0x30, 0xA0,
+0xB0, 0xD0, 0xF1, 0xD0, 0x60, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xE0, 0x70, 0x80, 0xC0, 0x05, 0xC0,
+0x90, 0x0C, 0xA0, 0xD0, 0x60, 0xD0, 0xF3, 0xD0, 0x70, 0x00, 0x70, 0xA0, 0x90, 0x70, 0xB0, 0x40,
+0x30, 0x80, 0x70, 0x30, 0xD0, 0xF1, 0x20, 0xD1, 0x70, 0x04, 0x90, 0x00, 0x30, 0x71, 0x0A, 0x90,
+0xC0, 0x0A, 0x80, 0x10, 0x81, 0x90, 0x10, 0x80, 0x10, 0x50, 0x00, 0xA0, 0xB0, 0xD0, 0xF3, 0x20,
+0xF1, 0xD0, 0x60, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x26, 0xF2, 0x60, 0xD0, 0xB0, 0x10, 0xE1,
+0x80, 0x90, 0x40, 0x01, 0x90, 0x80, 0x30, 0x41, 0x30, 0x00, 0x40, 0x70, 0x40, 0x30, 0x01, 0xA0,
+0x51, 0x30, 0x90, 0x0F, 0x56, 0x0F, 0x58, 0x70, 0xC0, 0x00, 0xE0, 0x90, 0x03, 0x80, 0x90, 0x50,
+0x70, 0x40, 0x01, 0xA0, 0x01, 0x80, 0x10, 0x80, 0x00, 0x50, 0x30, 0x02, 0x40, 0x0F, 0x01, 0x40,
+0x03, 0x90, 0xC0, 0x10, 0x90, 0x80, 0x30, 0xC0, 0x30, 0xA0, 0xD1, 0xF0, 0xB1, 0xF2, 0xD2, 0x80,
+0xA2, 0x70, 0x90, 0x02, 0x40, 0x0C, 0x70, 0xD0, 0x60, 0xD0, 0xF3, 0xD0, 0xA0, 0xC1, 0xE0, 0x80,
+0xD1, 0xE0, 0xC1, 0x00, 0x80, 0x30, 0xD0, 0xF3, 0xA0, 0x04, 0x90, 0x01, 0x70, 0xA0, 0x0A, 0x40,
+0x0C, 0x40, 0x10, 0x00, 0x30, 0x70, 0x30, 0xA0, 0x00, 0x71, 0xB0, 0xD1, 0xF5, 0xD0, 0x60, 0xF1,
+0x22, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xD0, 0x60, 0xB0, 0xF0, 0xD0, 0x30, 0x10, 0x70, 0x11, 0x80,
+0x01, 0xA0, 0x01, 0x90, 0xE2, 0x70, 0x50, 0xE0, 0x01, 0xC0, 0x10, 0x00, 0x30, 0xC0, 0x30, 0x0F,
+0x56, 0x0F, 0x5A, 0x81, 0x70, 0x80, 0x90, 0x70, 0x40, 0xE0, 0xA0, 0x40, 0x50, 0x80, 0x01, 0xC0,
+0x70, 0x10, 0x30, 0x03, 0x40, 0x70, 0xC0, 0x00, 0x90, 0xC0, 0x0F, 0x00, 0xC0, 0x50, 0x04, 0x90,
+0xA0, 0x80, 0x02, 0x90, 0xA0, 0xD0, 0xF1, 0x60, 0xD1, 0xF0, 0x82, 0x60, 0x40, 0xD2, 0x30, 0xA0,
+0x01, 0x90, 0x0B, 0x40, 0x80, 0xD0, 0x60, 0xF0, 0xD0, 0xF3, 0xB0, 0xE0, 0x70, 0xB0, 0xD1, 0x30,
+0x10, 0x80, 0xC0, 0x01, 0xA0, 0xB0, 0xF2, 0xD0, 0x30, 0xA0, 0x32, 0x00, 0x90, 0xC0, 0x10, 0xE1,
+0x0A, 0x40, 0x0C, 0xC0, 0x51, 0x70, 0xA0, 0x10, 0x00, 0x70, 0x11, 0xE0, 0x30, 0xD0, 0xF3, 0xD1,
+0xB1, 0xF0, 0x23, 0xF1, 0x20, 0xF3, 0x22, 0xF1, 0xB0, 0xD0, 0xF1, 0xD2, 0x11, 0xE0, 0x10, 0xA0,
+0x50, 0x01, 0x41, 0x50, 0xA0, 0x50, 0x00, 0xE0, 0x01, 0xE0, 0x90, 0x00, 0x50, 0x30, 0x40, 0x0F,
+0x56, 0x0F, 0x5D, 0xE0, 0x00, 0x40, 0xE0, 0x10, 0x80, 0x01, 0xA0, 0x00, 0x90, 0xE0, 0xA0, 0x07,
+0xA0, 0x40, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x0B, 0x30, 0xB0, 0xD1, 0x60, 0xF0, 0xD0, 0x30, 0x80,
+0x91, 0x40, 0x80, 0x30, 0xA0, 0x30, 0xB0, 0x40, 0xE0, 0x00, 0x50, 0xC0, 0x0A, 0x50, 0xA0, 0xD0,
+0x60, 0xF3, 0x20, 0xF0, 0xD1, 0xF0, 0xD1, 0x60, 0x30, 0x00, 0xC0, 0x50, 0x01, 0x90, 0x30, 0xD0,
+0xF2, 0xD0, 0xB0, 0x32, 0x10, 0x80, 0x10, 0x50, 0x00, 0x40, 0x09, 0x40, 0x80, 0x0E, 0x40, 0x00,
+0x50, 0xA0, 0x10, 0x80, 0x40, 0x80, 0x00, 0x80, 0x70, 0xD0, 0xF3, 0xD0, 0x60, 0xF1, 0x25, 0xF3,
+0x22, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF3, 0xD0, 0x10, 0x90, 0xA0, 0x00, 0x30, 0x10, 0x40, 0x00,
+0xA0, 0x01, 0x40, 0x10, 0xA0, 0x30, 0xA0, 0x70, 0x80, 0x0F, 0x5B, 0x0F, 0x5A, 0x80, 0xC0, 0x40,
+0x30, 0x40, 0x30, 0xC0, 0x70, 0x10, 0xC0, 0x00, 0x50, 0x10, 0xA0, 0xC0, 0x09, 0x30, 0x40, 0x90,
+0xC0, 0x0F, 0x00, 0x50, 0xC0, 0x0A, 0x90, 0xA0, 0xD1, 0xB0, 0xF0, 0xD0, 0xA0, 0x06, 0x90, 0x31,
+0x10, 0x30, 0x51, 0x0B, 0xA0, 0xD0, 0x60, 0xF3, 0x22, 0xF2, 0xD0, 0x60, 0x40, 0x00, 0xC0, 0x50,
+0x01, 0x50, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x30, 0x40, 0x90, 0x80, 0x41, 0x0C, 0xC0, 0xE0,
+0xA0, 0x80, 0x90, 0xC0, 0x0B, 0x90, 0x01, 0x51, 0x70, 0x11, 0xA0, 0x30, 0xB0, 0xF0, 0x21, 0xF2,
+0x60, 0xF0, 0x27, 0xF1, 0x22, 0xF2, 0x60, 0xF5, 0xD0, 0xA1, 0x10, 0x00, 0x80, 0x30, 0x70, 0x10,
+0x40, 0x01, 0x10, 0xE0, 0xC0, 0x31, 0xC0, 0x0F, 0x5C, 0x0F, 0x5A, 0x80, 0x70, 0xA1, 0xE0, 0x01,
+0xC0, 0x10, 0xA0, 0x30, 0xE0, 0x50, 0x0B, 0x30, 0xC0, 0x00, 0x40, 0x0F, 0x00, 0xC0, 0x50, 0x0B,
+0x80, 0x70, 0xD0, 0xB1, 0xD0, 0x60, 0x80, 0x07, 0x50, 0xC0, 0x50, 0xC0, 0x50, 0x0B, 0x50, 0xE0,
+0x80, 0xD1, 0xF1, 0x25, 0xD0, 0x80, 0x90, 0x00, 0x51, 0x01, 0xC0, 0x70, 0xD0, 0xF2, 0xD0, 0xB0,
+0xA0, 0x02, 0x90, 0x0D, 0x50, 0x30, 0x71, 0x30, 0x0A, 0xC0, 0x50, 0x03, 0x90, 0xE1, 0xA0, 0xD0,
+0xF2, 0x21, 0xF0, 0xB1, 0xF1, 0x28, 0xF0, 0x22, 0xD0, 0xB1, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0xF0,
+0xE0, 0x10, 0xE0, 0x10, 0x00, 0xA0, 0x80, 0xA1, 0x30, 0x10, 0x50, 0x01, 0xE0, 0xA0, 0x90, 0x0F,
+0x5B, 0x0F, 0x5B, 0x81, 0x00, 0xC0, 0x30, 0x01, 0xE0, 0x10, 0x40, 0x0D, 0x70, 0x01, 0x40, 0x0F,
+0x01, 0x40, 0x0C, 0xC0, 0x70, 0xB0, 0x60, 0xD1, 0x70, 0x0A, 0xC0, 0x90, 0x0C, 0x90, 0xA0, 0x80,
+0xD1, 0x60, 0xE0, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0xD0, 0x10, 0x30, 0xC0, 0x50, 0x02, 0x80, 0x30,
+0xD0, 0xF2, 0xD0, 0x30, 0x80, 0x01, 0x40, 0x80, 0xC0, 0x04, 0x80, 0x30, 0x00, 0xC0, 0x50, 0xC1,
+0x50, 0x00, 0x70, 0xC0, 0x70, 0x10, 0x50, 0x08, 0x90, 0xC0, 0x04, 0x90, 0x70, 0x10, 0x60, 0xD5,
+0x60, 0xD1, 0xF0, 0x26, 0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD1,
+0x60, 0xE0, 0x10, 0x70, 0x30, 0x90, 0x00, 0x90, 0x11, 0x01, 0x80, 0x50, 0x00, 0x80, 0x30, 0x0F,
+0x5A, 0x0F, 0x59, 0x40, 0x30, 0xA0, 0xC0, 0x01, 0x40, 0x80, 0xE0, 0x40, 0x50, 0xC0, 0x0C, 0xA0,
+0x50, 0x01, 0xC0, 0x90, 0x0F, 0x00, 0x50, 0xC0, 0x0C, 0x50, 0xA0, 0x60, 0xD1, 0xA0, 0x60, 0x0A,
+0x40, 0x0D, 0xC0, 0xA1, 0xD1, 0xB0, 0xF1, 0x21, 0xF0, 0xD1, 0x70, 0x50, 0xC0, 0x50, 0x03, 0xA0,
+0x60, 0xD0, 0xF2, 0xD0, 0x60, 0x70, 0x30, 0xA0, 0x10, 0xC0, 0x04, 0xC0, 0x30, 0xE0, 0x11, 0x30,
+0xA0, 0x30, 0x70, 0x80, 0x60, 0xA0, 0x30, 0xE1, 0x07, 0x40, 0x04, 0x50, 0x70, 0x11, 0x70, 0xA0,
+0x70, 0x60, 0xB0, 0xD0, 0xF0, 0x60, 0xD2, 0xF4, 0x21, 0xF1, 0x21, 0xF1, 0xB1, 0xD0, 0xF0, 0x21,
+0xF0, 0x21, 0xF2, 0xD1, 0xE1, 0x10, 0x40, 0x01, 0x80, 0x11, 0x81, 0x02, 0x70, 0xA0, 0x80, 0x0F,
+0x58, 0x0F, 0x57, 0xC0, 0xA0, 0x40, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x71, 0xC0, 0x01, 0x40, 0x0C,
+0xA0, 0x03, 0x40, 0xC0, 0x0E, 0xC0, 0x40, 0x0D, 0x80, 0xA0, 0xB0, 0xD1, 0x30, 0xA0, 0x80, 0x50,
+0x07, 0x90, 0x0D, 0x50, 0xC0, 0x80, 0x70, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0x80, 0x40, 0x00,
+0xC0, 0x50, 0x03, 0xC0, 0xE0, 0xD0, 0xF1, 0x21, 0xD0, 0xB0, 0x80, 0x30, 0x71, 0xE0, 0x70, 0x32,
+0xA0, 0x30, 0x80, 0x71, 0xE1, 0x30, 0xE0, 0xD0, 0xE0, 0x30, 0xD0, 0xA0, 0x70, 0x30, 0x90, 0x05,
+0x90, 0x06, 0x30, 0x80, 0x40, 0x11, 0xA0, 0x10, 0x70, 0x40, 0xE0, 0x80, 0x60, 0xB0, 0xF0, 0xD1,
+0xF4, 0x21, 0xF2, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF3, 0xD0, 0x60, 0x10, 0x50, 0x30, 0x40,
+0x80, 0x12, 0x01, 0x80, 0x90, 0x00, 0x40, 0xA0, 0xC0, 0x0F, 0x56, 0x0F, 0x56, 0x40, 0xA1, 0x02,
+0x40, 0xA0, 0xE0, 0x90, 0x03, 0xC0, 0x50, 0x0A, 0xA0, 0x90, 0x03, 0xC0, 0x50, 0x09, 0x40, 0xE0,
+0x03, 0x40, 0x0E, 0x50, 0xA0, 0x30, 0x70, 0xB0, 0xD0, 0x60, 0x30, 0xA0, 0x06, 0x50, 0xC0, 0x0C,
+0xC0, 0x50, 0x00, 0x40, 0x30, 0xD0, 0xF2, 0xD2, 0x80, 0x40, 0x00, 0xC0, 0x50, 0x03, 0x10, 0x70,
+0xD0, 0xF1, 0x21, 0xF0, 0xD1, 0x30, 0x70, 0xB0, 0x80, 0x70, 0xA0, 0xE1, 0x32, 0xD1, 0x80, 0xA0,
+0x70, 0x60, 0x90, 0xE0, 0x60, 0xB0, 0xA0, 0x70, 0x50, 0x70, 0xC0, 0x03, 0x51, 0x09, 0x30, 0xE0,
+0x70, 0xE0, 0x10, 0x71, 0x11, 0xE0, 0x60, 0xD5, 0xF4, 0xB1, 0xF2, 0x27, 0xF0, 0x20, 0xF1, 0xD1,
+0x71, 0x50, 0x12, 0xA0, 0xE0, 0xA0, 0x80, 0x02, 0xA0, 0x30, 0x40, 0x0F, 0x55, 0x0F, 0x55, 0xA0,
+0x40, 0x01, 0x70, 0x00, 0x50, 0xE0, 0x30, 0x06, 0x40, 0x0A, 0xC0, 0xE0, 0xA0, 0xC0, 0x02, 0x40,
+0x09, 0x30, 0xE0, 0x00, 0x50, 0x70, 0xC1, 0x50, 0x0E, 0x90, 0x80, 0xA0, 0x31, 0x50, 0xD0, 0x70,
+0x06, 0xC0, 0x50, 0x0A, 0xC0, 0x00, 0x50, 0x70, 0x30, 0x80, 0x30, 0xD1, 0xF0, 0xD0, 0x60, 0x30,
+0xD1, 0x70, 0xC1, 0x50, 0x03, 0x81, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0xB1, 0xD2, 0xE0, 0xC0, 0x00,
+0x90, 0x80, 0xE0, 0x10, 0xD2, 0xF0, 0xB0, 0xD1, 0xE0, 0xA0, 0xD0, 0x71, 0x31, 0xE0, 0x10, 0x80,
+0x01, 0x90, 0xC0, 0x0C, 0x40, 0x30, 0x70, 0xA0, 0xC0, 0x00, 0x80, 0x70, 0x10, 0x70, 0xE0, 0x71,
+0xB0, 0xD1, 0xF1, 0xD0, 0x60, 0xF1, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF4, 0xD0, 0x60, 0x70, 0x00,
+0xE0, 0x10, 0x80, 0x10, 0x30, 0x80, 0xE0, 0x90, 0x00, 0x30, 0x50, 0x00, 0x40, 0xA0, 0xC0, 0x0F,
+0x53, 0x0F, 0x47, 0xC0, 0x0A, 0x40, 0xA1, 0xC0, 0x01, 0x40, 0xE0, 0x70, 0xC0, 0x07, 0xC0, 0x40,
+0x0B, 0xE0, 0xC0, 0x02, 0xC0, 0x50, 0x08, 0x40, 0x10, 0x50, 0x40, 0xE0, 0xC0, 0x00, 0x40, 0x0E,
+0x40, 0x02, 0xA0, 0x40, 0xB0, 0x30, 0x07, 0x90, 0x03, 0x80, 0x70, 0x04, 0x40, 0x10, 0x30, 0x80,
+0xA0, 0xE0, 0xB0, 0xF1, 0xD0, 0xF0, 0xA0, 0x60, 0xA0, 0xD0, 0x90, 0x70, 0x40, 0x90, 0x02, 0x10,
+0x70, 0x80, 0xE0, 0xD1, 0xF1, 0x20, 0xF0, 0xB1, 0xF0, 0xD1, 0xA0, 0x03, 0x50, 0x80, 0x70, 0x30,
+0xF0, 0xB1, 0xD0, 0x60, 0x70, 0x60, 0xD1, 0xB0, 0x30, 0x90, 0x30, 0x80, 0x10, 0x80, 0x10, 0x90,
+0x0E, 0x50, 0x02, 0x40, 0x11, 0xE0, 0x71, 0x10, 0x70, 0x30, 0x70, 0xF1, 0xD0, 0xB1, 0xF1, 0x23,
+0xF1, 0x22, 0xF5, 0xB0, 0xF0, 0xB0, 0xA1, 0xE0, 0x10, 0x30, 0x02, 0xA0, 0xE0, 0x80, 0x02, 0xA0,
+0x30, 0x80, 0x0F, 0x52, 0x0F, 0x46, 0x81, 0x40, 0x08, 0xA0, 0x80, 0x01, 0x70, 0x00, 0x50, 0xE0,
+0x80, 0x0A, 0x90, 0xC0, 0x0A, 0x30, 0x04, 0x40, 0x07, 0x40, 0x10, 0x40, 0x04, 0x90, 0xC0, 0x90,
+0x0C, 0x90, 0xC0, 0x02, 0x70, 0x40, 0x80, 0x07, 0x90, 0x02, 0xC0, 0x71, 0x50, 0x04, 0x10, 0xE0,
+0x30, 0xD0, 0xE0, 0xF0, 0x20, 0xF0, 0xD0, 0x30, 0xE0, 0x00, 0x72, 0xE0, 0xA0, 0x70, 0x40, 0x50,
+0xC0, 0x50, 0x40, 0x70, 0x10, 0x31, 0xD3, 0x60, 0xB0, 0xD0, 0xF0, 0xD0, 0x70, 0x05, 0x90, 0x50,
+0x70, 0xB0, 0xF0, 0xD0, 0xA1, 0xB0, 0xD0, 0xF0, 0xD0, 0x70, 0xA0, 0xD0, 0xE0, 0x71, 0xE0, 0x80,
+0x90, 0x0D, 0x40, 0x02, 0xC0, 0x10, 0x41, 0x10, 0x30, 0x10, 0x00, 0xA0, 0xE0, 0xF0, 0xD0, 0xF0,
+0x60, 0xF1, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF3, 0xD0, 0xF0, 0x60, 0xD1, 0xB0, 0xE0, 0x11, 0x30,
+0x03, 0x40, 0xE0, 0x90, 0x00, 0xA0, 0xC0, 0x00, 0x40, 0xA0, 0xC0, 0x0F, 0x50, 0x0F, 0x46, 0x30,
+0x90, 0x80, 0x06, 0x50, 0x70, 0x30, 0xC0, 0x01, 0x90, 0x70, 0x10, 0xC0, 0x0C, 0x40, 0x09, 0xA0,
+0x90, 0x04, 0x51, 0x06, 0xA0, 0x41, 0x30, 0x03, 0xC0, 0x40, 0x70, 0xC0, 0x0C, 0x90, 0x02, 0xA0,
+0x90, 0x70, 0x07, 0x90, 0x80, 0xA0, 0x30, 0x70, 0x50, 0x80, 0xA0, 0x30, 0xC0, 0x01, 0xC0, 0x10,
+0x00, 0x80, 0xB1, 0xD1, 0xF0, 0xD0, 0xA0, 0x80, 0x01, 0x30, 0x11, 0xA0, 0x50, 0x70, 0x10, 0x30,
+0x02, 0x80, 0x11, 0x60, 0xB0, 0x80, 0xD0, 0x60, 0xF2, 0xD0, 0x60, 0x70, 0xC0, 0x04, 0x31, 0xB0,
+0xF0, 0xD0, 0x62, 0xD0, 0xF2, 0xD1, 0x80, 0x10, 0x30, 0xA0, 0x80, 0xA0, 0x40, 0x0B, 0x51, 0x03,
+0x90, 0x01, 0x30, 0x40, 0xC0, 0x00, 0xC0, 0xE0, 0x60, 0xD0, 0xB1, 0xF1, 0x23, 0xF4, 0x21, 0xF2,
+0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0xD2, 0x30, 0xE0, 0x40, 0x30, 0x03, 0x70, 0xE0, 0x40, 0x02, 0xA1,
+0x40, 0x0F, 0x4F, 0x0F, 0x44, 0x50, 0x01, 0x40, 0x06, 0x80, 0x30, 0x01, 0xA0, 0x00, 0xC0, 0xE0,
+0x10, 0xC0, 0x0D, 0x51, 0x06, 0x80, 0xE0, 0x07, 0x40, 0x08, 0x70, 0x10, 0x04, 0x40, 0x0E, 0x90,
+0x50, 0x10, 0x70, 0xA0, 0xD0, 0x30, 0x71, 0xA0, 0x70, 0xE0, 0xA0, 0x32, 0x80, 0x50, 0x90, 0x40,
+0xA1, 0x80, 0xA1, 0x50, 0x01, 0xC0, 0x00, 0x80, 0xE0, 0xD0, 0xB0, 0x80, 0x60, 0xA1, 0x03, 0xE0,
+0x60, 0xB0, 0xD0, 0x71, 0x50, 0x02, 0x90, 0x10, 0xA0, 0xD0, 0x70, 0x31, 0x60, 0xD0, 0xF0, 0x20,
+0xD1, 0x80, 0x10, 0x04, 0x90, 0xA0, 0x80, 0xD0, 0xF0, 0xD0, 0xB0, 0x10, 0x60, 0xD2, 0x30, 0xA0,
+0x31, 0x40, 0x30, 0xA0, 0x30, 0x70, 0xC0, 0x0A, 0x40, 0x0A, 0x70, 0x10, 0x30, 0xD1, 0x60, 0xF0,
+0xD0, 0xF0, 0x22, 0xF5, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xA0, 0x10,
+0x30, 0x70, 0x40, 0x00, 0x50, 0x00, 0x40, 0x10, 0x90, 0x00, 0xA0, 0xC0, 0x00, 0x80, 0xA0, 0x0F,
+0x4E, 0x0F, 0x43, 0xA1, 0xE0, 0x40, 0x05, 0xC0, 0xA1, 0x50, 0x01, 0xC0, 0xE0, 0x70, 0x30, 0x90,
+0x0F, 0x00, 0x40, 0x06, 0x80, 0x40, 0x07, 0x50, 0xC0, 0x08, 0x40, 0x04, 0x90, 0xC0, 0x0D, 0x40,
+0x70, 0x90, 0xD5, 0x60, 0xF0, 0x30, 0xD2, 0xB0, 0x30, 0xA1, 0x40, 0x01, 0xA0, 0x40, 0x80, 0xA1,
+0x40, 0x30, 0x70, 0x80, 0xD1, 0xE1, 0x70, 0x90, 0x04, 0xA0, 0x30, 0xD0, 0xB0, 0x70, 0xE0, 0x04,
+0xC0, 0x30, 0x90, 0x30, 0x00, 0x40, 0x30, 0xD0, 0xF1, 0xD1, 0x70, 0xE0, 0x05, 0x81, 0xD0, 0xF1,
+0xB0, 0xA0, 0xD0, 0xF0, 0xD0, 0x60, 0x80, 0x01, 0x90, 0x10, 0x90, 0xD0, 0x70, 0x40, 0xE0, 0xC0,
+0x09, 0x40, 0x0A, 0x30, 0x10, 0xE0, 0xB0, 0xF0, 0x60, 0xD0, 0xF1, 0x22, 0xF5, 0x22, 0xF0, 0xD0,
+0x60, 0xF3, 0x20, 0xF0, 0x20, 0xD1, 0xA0, 0x10, 0xE0, 0x10, 0x30, 0xA0, 0x02, 0x70, 0xE0, 0x40,
+0x01, 0xC0, 0xA1, 0xC0, 0x0F, 0x4C, 0x0F, 0x42, 0x90, 0x30, 0x00, 0xC0, 0xE0, 0x90, 0x03, 0x50,
+0xA0, 0xC0, 0x00, 0xA0, 0x00, 0xC0, 0x70, 0x30, 0x40, 0x30, 0x0F, 0x01, 0xC0, 0x50, 0x04, 0x90,
+0x30, 0x09, 0x40, 0x0F, 0x00, 0x50, 0x0D, 0x50, 0xA0, 0x80, 0x70, 0xB0, 0x60, 0xD1, 0xF0, 0x60,
+0xD2, 0xB0, 0xD0, 0x30, 0x40, 0x02, 0x30, 0xE0, 0x10, 0x81, 0xD0, 0xB0, 0x60, 0xB0, 0x30, 0x70,
+0xB0, 0xD0, 0xE0, 0x60, 0xB0, 0x10, 0xE0, 0x90, 0x03, 0xA0, 0x70, 0x31, 0x10, 0x50, 0x04, 0x70,
+0x90, 0x30, 0x01, 0x80, 0x60, 0xD0, 0xF0, 0xD0, 0xA0, 0x90, 0xC0, 0x03, 0xA0, 0xE0, 0x30, 0xB0,
+0xF2, 0x60, 0xE0, 0xD0, 0xF0, 0xD0, 0x30, 0x90, 0x01, 0xC0, 0xA0, 0x31, 0x60, 0xD0, 0xB0, 0xA0,
+0x08, 0x51, 0x06, 0x40, 0x90, 0x01, 0x50, 0x11, 0xD0, 0x60, 0xF1, 0xD0, 0xF1, 0x22, 0xF4, 0x21,
+0xF1, 0xB1, 0xF1, 0x21, 0xF4, 0xD0, 0xB0, 0x60, 0x30, 0x10, 0xE0, 0x03, 0x80, 0xE0, 0x50, 0x00,
+0xA0, 0x01, 0x30, 0x40, 0x0F, 0x4B, 0x0F, 0x40, 0x80, 0x90, 0xC0, 0x70, 0x01, 0xC0, 0xE0, 0xC0,
+0x01, 0x80, 0xE0, 0x90, 0x02, 0xE1, 0x50, 0x00, 0xE0, 0x0F, 0x03, 0x40, 0x04, 0xC0, 0xA0, 0x09,
+0x90, 0xC0, 0x05, 0x30, 0xA1, 0x32, 0x81, 0x90, 0x80, 0xA3, 0x90, 0x09, 0x90, 0x40, 0xE0, 0x30,
+0x80, 0xD3, 0xB0, 0xD0, 0x70, 0xE0, 0xD0, 0x80, 0x40, 0xE0, 0xA1, 0x10, 0x80, 0xA0, 0x70, 0x10,
+0xF0, 0x20, 0xF0, 0xD0, 0x60, 0x30, 0xB0, 0xD0, 0xB0, 0xD2, 0x60, 0x70, 0x40, 0x02, 0xA0, 0x30,
+0x80, 0x31, 0x80, 0x04, 0x30, 0x80, 0x40, 0x01, 0x90, 0xA0, 0xD2, 0xA0, 0xC0, 0x04, 0x90, 0x10,
+0x40, 0xD0, 0xF3, 0xD0, 0xF1, 0xD0, 0x30, 0xC0, 0x02, 0x80, 0xB0, 0xD0, 0xF1, 0xD0, 0x30, 0x40,
+0x07, 0x40, 0x00, 0x40, 0x70, 0xE0, 0xC0, 0x00, 0x80, 0x50, 0x70, 0x50, 0x01, 0x50, 0x90, 0x10,
+0xE0, 0xB0, 0xD0, 0xF2, 0x23, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0xD0,
+0xF1, 0x22, 0xF0, 0xD1, 0xB0, 0xE0, 0xC0, 0x01, 0x40, 0x01, 0xE0, 0x70, 0x50, 0x01, 0xC0, 0xE0,
+0x30, 0x06, 0xC0, 0x40, 0x70, 0x90, 0x0F, 0x3F, 0x0F, 0x3E, 0xC0, 0x70, 0x80, 0xE0, 0x40, 0x31,
+0x01, 0x80, 0x40, 0x00, 0xA0, 0x90, 0x00, 0x70, 0x01, 0xA0, 0x70, 0x01, 0x70, 0xC0, 0x40, 0x0F,
+0x03, 0x40, 0x04, 0x30, 0xC0, 0x09, 0x40, 0x05, 0xE0, 0x70, 0xA0, 0x80, 0x90, 0x62, 0x30, 0x60,
+0x90, 0xD0, 0x51, 0x10, 0x50, 0x08, 0x40, 0x01, 0x40, 0xA0, 0x71, 0xA0, 0xE0, 0x10, 0x30, 0x70,
+0x80, 0xA0, 0xD0, 0xA0, 0x10, 0x70, 0xE0, 0x80, 0x01, 0x70, 0x40, 0xD1, 0xF1, 0xD0, 0xB1, 0xD0,
+0xB1, 0xD0, 0xF0, 0xD0, 0xA0, 0x11, 0x30, 0x70, 0xB0, 0xF0, 0xB0, 0xD0, 0x70, 0x40, 0x04, 0xA1,
+0x90, 0x01, 0x40, 0xA0, 0xD0, 0x61, 0x30, 0x50, 0x05, 0x31, 0xD1, 0xF0, 0x20, 0xF1, 0xD0, 0xF0,
+0xD0, 0x30, 0x50, 0x02, 0x40, 0xB0, 0xF2, 0xD0, 0xB0, 0x70, 0x00, 0xC0, 0x10, 0x30, 0x03, 0x90,
+0x00, 0x11, 0x80, 0x70, 0x30, 0x10, 0x90, 0x10, 0xC0, 0x01, 0xE2, 0x60, 0xF1, 0xD0, 0xF0, 0x23,
+0xF2, 0x22, 0xF1, 0xD0, 0xB1, 0xF0, 0x22, 0xF3, 0x22, 0xF1, 0x20, 0xD0, 0xB0, 0xA0, 0x30, 0xE0,
+0x11, 0x50, 0x00, 0x30, 0x70, 0x01, 0x70, 0x00, 0x50, 0x70, 0xC0, 0x01, 0x50, 0xA1, 0x30, 0xA0,
+0x70, 0x0F, 0x40, 0x0F, 0x3E, 0x40, 0x30, 0x00, 0x50, 0x70, 0x00, 0x70, 0x80, 0x00, 0x80, 0x30,
+0xE0, 0x40, 0x02, 0xA0, 0xE0, 0x40, 0x01, 0x30, 0x90, 0x00, 0x51, 0x0F, 0x02, 0x90, 0xC0, 0x03,
+0x70, 0x80, 0x09, 0x90, 0xC0, 0x04, 0x90, 0x00, 0xC0, 0x80, 0xE0, 0x70, 0xA0, 0x30, 0xD1, 0x61,
+0x70, 0xA0, 0x40, 0x09, 0x90, 0xC0, 0x04, 0xC0, 0x02, 0x80, 0x70, 0x30, 0x90, 0xA0, 0x30, 0x05,
+0xE0, 0x60, 0x70, 0xD2, 0xB1, 0xD0, 0x61, 0xD1, 0x10, 0xA0, 0xC0, 0xA0, 0x30, 0x60, 0xD0, 0xB0,
+0xD0, 0xA0, 0x50, 0x05, 0xC0, 0xE0, 0x02, 0x70, 0xA0, 0xD0, 0x30, 0x70, 0xA0, 0x07, 0xA0, 0x90,
+0xD0, 0xF1, 0x20, 0xF2, 0xD0, 0xB0, 0xA0, 0x01, 0x40, 0x30, 0xD1, 0x20, 0xF0, 0xD0, 0xA0, 0xC0,
+0x01, 0xA0, 0x40, 0xA1, 0x10, 0x30, 0xC0, 0x00, 0x90, 0xE0, 0x40, 0xD0, 0xB0, 0x70, 0xE0, 0xA0,
+0x02, 0x40, 0x10, 0xD0, 0x60, 0xD0, 0xF2, 0x23, 0xF1, 0x23, 0xF2, 0x60, 0xD0, 0xF0, 0x22, 0xF2,
+0x22, 0xF1, 0x22, 0xD1, 0xB0, 0x60, 0x70, 0x10, 0x70, 0x00, 0x40, 0x90, 0xE0, 0xA0, 0xC0, 0x01,
+0x50, 0xE0, 0x40, 0x00, 0x50, 0x10, 0x50, 0xC0, 0xE0, 0x00, 0xC0, 0xA0, 0xE0, 0x40, 0x0F, 0x3C,
+0x0F, 0x3E, 0x50, 0x30, 0x00, 0x50, 0xA0, 0x01, 0x30, 0x70, 0xE0, 0x30, 0x00, 0xA0, 0xC0, 0x00,
+0x40, 0xE0, 0x50, 0x01, 0x40, 0x80, 0x02, 0x40, 0xC0, 0x0F, 0x02, 0x40, 0x03, 0xC0, 0x70, 0x09,
+0xC0, 0x90, 0x09, 0x90, 0xC0, 0x81, 0xD0, 0x60, 0xE0, 0x50, 0x02, 0xC1, 0x06, 0xC0, 0x50, 0x09,
+0x40, 0xA0, 0x90, 0x70, 0x06, 0x50, 0x41, 0xA0, 0xD1, 0xB1, 0xD2, 0xF0, 0xD0, 0x10, 0x02, 0x10,
+0xE0, 0xB0, 0x60, 0x30, 0x80, 0x0B, 0xE0, 0xD1, 0x30, 0x80, 0x70, 0x07, 0x40, 0xA0, 0x60, 0xD0,
+0xF1, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x31, 0xA0, 0x30, 0xB0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xA0,
+0x40, 0xA0, 0x10, 0xE0, 0xD2, 0x80, 0x30, 0x00, 0x10, 0x70, 0x50, 0xA0, 0xB0, 0xD2, 0x70, 0x10,
+0x90, 0x50, 0x00, 0x30, 0x80, 0xB0, 0xD0, 0x20, 0xF0, 0x24, 0xF2, 0x21, 0xF0, 0x20, 0xD0, 0x60,
+0xF2, 0x21, 0xF3, 0x21, 0xF1, 0x22, 0xF2, 0x60, 0xD1, 0x80, 0x70, 0x11, 0x40, 0x70, 0x10, 0x40,
+0x01, 0x70, 0x00, 0x81, 0x00, 0xC0, 0x70, 0x10, 0xC1, 0xE0, 0x40, 0x00, 0x70, 0xC0, 0x0F, 0x3B,
+0x0F, 0x3B, 0x90, 0xE0, 0x70, 0xC0, 0x01, 0x40, 0x80, 0x00, 0x80, 0x00, 0x31, 0x02, 0xA0, 0x30,
+0x70, 0x02, 0xC0, 0xA0, 0x04, 0x40, 0x0F, 0x02, 0x51, 0x03, 0xA0, 0x0A, 0x40, 0x09, 0xA0, 0xE0,
+0x40, 0x70, 0xF0, 0xB0, 0x60, 0x70, 0xA0, 0x51, 0xE0, 0x10, 0x07, 0x90, 0x09, 0x50, 0x10, 0x70,
+0xE0, 0x50, 0x08, 0x40, 0x70, 0xB1, 0x60, 0x80, 0x30, 0x60, 0xD0, 0x80, 0x10, 0x70, 0xA0, 0x00,
+0x90, 0x30, 0x80, 0xA0, 0x40, 0x0B, 0xC0, 0x70, 0xB0, 0xD0, 0x60, 0xE0, 0x40, 0x07, 0x90, 0x00,
+0x70, 0xD0, 0x20, 0xF5, 0xD0, 0xB0, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xD1, 0x70, 0x30, 0x41, 0x80,
+0x30, 0x60, 0xA1, 0x80, 0x00, 0x90, 0xE0, 0x10, 0xA0, 0xD1, 0xF1, 0xD0, 0x70, 0x11, 0x80, 0x50,
+0x80, 0xD0, 0xF3, 0x23, 0xF3, 0x20, 0xF2, 0x60, 0xD0, 0x22, 0xF3, 0x22, 0xF0, 0x21, 0xF2, 0xD0,
+0x60, 0xF0, 0xD2, 0x60, 0x71, 0x12, 0xE0, 0xA0, 0x30, 0xC0, 0x01, 0x80, 0xA0, 0x00, 0x70, 0xE0,
+0xC0, 0xE0, 0x40, 0x01, 0x70, 0x50, 0x0F, 0x3B, 0x0F, 0x3A, 0xC0, 0xE0, 0x00, 0x81, 0x01, 0x80,
+0x40, 0xA0, 0x30, 0xA0, 0x90, 0x30, 0x50, 0x01, 0xE0, 0x80, 0x03, 0xE0, 0x05, 0xC0, 0x90, 0x0F,
+0x02, 0x40, 0x03, 0xA0, 0x0A, 0xC0, 0x90, 0x07, 0x40, 0x30, 0x60, 0x80, 0x60, 0xD0, 0xF0, 0x60,
+0xD0, 0xB0, 0x31, 0x80, 0xE0, 0x07, 0x40, 0x0B, 0xA0, 0xE0, 0x90, 0x09, 0xC0, 0x30, 0xA0, 0x30,
+0x40, 0x90, 0x80, 0x70, 0xA1, 0xE0, 0x30, 0xA0, 0x00, 0xA1, 0xC1, 0x0B, 0x51, 0xE0, 0xD1, 0x30,
+0x90, 0x06, 0x51, 0x00, 0xA0, 0xD0, 0xF3, 0x22, 0xF0, 0xD1, 0x60, 0xD0, 0xF0, 0x21, 0xD0, 0x30,
+0x90, 0x03, 0x40, 0x10, 0x40, 0x50, 0x02, 0xC0, 0x70, 0xA0, 0x70, 0xD2, 0xF0, 0xD0, 0x30, 0xE0,
+0x10, 0xE1, 0xB0, 0xF1, 0x27, 0xF2, 0x20, 0xD0, 0x60, 0xF0, 0x23, 0xF2, 0x23, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0xB1, 0xD0, 0x21, 0xF0, 0xD3, 0x80, 0xE0, 0x10, 0xA0, 0x70, 0x01, 0xC0, 0xA0, 0xC0,
+0xE0, 0x40, 0x00, 0x40, 0x30, 0x01, 0x50, 0xE0, 0x00, 0x80, 0x30, 0x0F, 0x39, 0x0F, 0x3A, 0x50,
+0xA0, 0x00, 0xA0, 0xE1, 0xC0, 0x80, 0x10, 0x80, 0xE0, 0xC0, 0x01, 0xA0, 0x50, 0x10, 0x50, 0x03,
+0xA0, 0xC0, 0x05, 0xC0, 0x90, 0xC0, 0x0F, 0x01, 0xC0, 0x90, 0x02, 0xA0, 0x0B, 0x40, 0x06, 0xA0,
+0x30, 0xB0, 0xD4, 0x60, 0xD2, 0xB0, 0xE0, 0x08, 0x50, 0xC0, 0x09, 0x81, 0xE0, 0x40, 0x0C, 0x50,
+0x05, 0x50, 0xE0, 0x91, 0x30, 0x81, 0x50, 0x0B, 0x50, 0xC0, 0x50, 0x70, 0xB0, 0x70, 0x50, 0x06,
+0x90, 0x01, 0xA0, 0xF0, 0xD0, 0x20, 0xF1, 0x23, 0xF0, 0xB0, 0x60, 0xF1, 0x21, 0xD0, 0x70, 0x04,
+0x90, 0x10, 0x00, 0x40, 0x03, 0xC0, 0x10, 0x40, 0xE0, 0xD1, 0xF0, 0xD3, 0x60, 0xF5, 0x25, 0xF2,
+0xD0, 0xB1, 0xF1, 0x22, 0xF2, 0x26, 0xF0, 0xD0, 0xF0, 0x60, 0xF0, 0x22, 0xF4, 0xD0, 0xB0, 0x30,
+0xD1, 0x70, 0x90, 0xA0, 0xC0, 0x00, 0xC0, 0xE0, 0x50, 0x80, 0x90, 0x00, 0x50, 0x10, 0xC0, 0x50,
+0x42, 0x0F, 0x38, 0x0F, 0x3B, 0xC0, 0x00, 0x90, 0x00, 0x40, 0x70, 0x00, 0x80, 0xA0, 0x10, 0x70,
+0x01, 0x90, 0x10, 0xC0, 0x03, 0x80, 0x40, 0x04, 0x40, 0xA0, 0x40, 0x00, 0x40, 0x0F, 0x02, 0x40,
+0x02, 0x30, 0x90, 0x0A, 0xC0, 0x50, 0x03, 0x80, 0xE0, 0x30, 0xD1, 0x80, 0xA1, 0x30, 0x80, 0xA1,
+0x60, 0xD0, 0xE0, 0x40, 0x08, 0xC0, 0x30, 0x50, 0x08, 0x40, 0x11, 0x80, 0x0C, 0x90, 0x08, 0x90,
+0xE0, 0x80, 0xA0, 0xC0, 0x0B, 0x90, 0xC0, 0x00, 0x40, 0x10, 0x40, 0x07, 0x40, 0x00, 0x30, 0xA0,
+0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xD0, 0xB1, 0xF1, 0xD1, 0x30, 0x90, 0x06, 0x51, 0x04, 0xC0, 0x00,
+0x80, 0xE0, 0x60, 0xD3, 0xB1, 0xD0, 0xF0, 0x21, 0xF1, 0x25, 0xF3, 0x60, 0xF1, 0x23, 0xF2, 0x24,
+0xF3, 0x60, 0x24, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD3, 0x70, 0x80, 0x01, 0xA0, 0x10,
+0x70, 0x80, 0xA0, 0x30, 0xE0, 0x50, 0x01, 0x80, 0x30, 0x0F, 0x39, 0x0F, 0x3F, 0xC0, 0xA0, 0x90,
+0x80, 0x00, 0x40, 0x10, 0x80, 0x40, 0xA0, 0x40, 0x30, 0x02, 0x90, 0x30, 0x05, 0xE0, 0x30, 0x01,
+0xC0, 0x90, 0x0F, 0x02, 0x40, 0x01, 0x41, 0x0B, 0x40, 0x04, 0xA0, 0x80, 0xD0, 0x60, 0x30, 0x01,
+0x71, 0x00, 0x90, 0x70, 0xA0, 0xE0, 0x08, 0xC0, 0x70, 0xA0, 0x80, 0x09, 0x10, 0xE0, 0x80, 0x0C,
+0x90, 0x09, 0xE0, 0x10, 0x70, 0xC0, 0x0B, 0x90, 0x01, 0xC0, 0x80, 0x03, 0x80, 0x10, 0xC0, 0x01,
+0x40, 0x00, 0x70, 0xD0, 0xF0, 0x20, 0xF3, 0x22, 0xD0, 0xB0, 0xF1, 0xD0, 0xF0, 0xD0, 0xA0, 0x90,
+0x06, 0x40, 0x08, 0x40, 0xE0, 0x71, 0xA1, 0x60, 0xD0, 0x22, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xD0,
+0xB1, 0xF1, 0x23, 0xF2, 0x25, 0xF0, 0xD0, 0xB1, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x20,
+0xF2, 0xD1, 0x30, 0x80, 0x40, 0x10, 0x30, 0x00, 0x80, 0x30, 0x50, 0x0F, 0x3F, 0x0F, 0x3D, 0xA1,
+0x70, 0xA0, 0xE0, 0xC0, 0x01, 0x30, 0x10, 0x30, 0xD1, 0x30, 0x40, 0xC0, 0x00, 0xE0, 0x06, 0x70,
+0x40, 0x02, 0x51, 0x0F, 0x01, 0x90, 0xC0, 0x00, 0xA0, 0x50, 0x0B, 0x51, 0x04, 0x80, 0x70, 0xA0,
+0x00, 0x80, 0x70, 0x30, 0x10, 0x40, 0x50, 0x00, 0x51, 0x08, 0xC0, 0x70, 0xE0, 0x0A, 0x31, 0xC1,
+0x0B, 0x40, 0x09, 0x41, 0xE0, 0xC0, 0x0B, 0x40, 0x07, 0x81, 0x10, 0x70, 0x00, 0x50, 0xA0, 0x80,
+0xD0, 0xF0, 0x20, 0xF4, 0x20, 0xF0, 0xD0, 0x60, 0xF4, 0xD0, 0xA1, 0xC0, 0x04, 0x90, 0x09, 0x40,
+0x90, 0xA0, 0x11, 0x80, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x22, 0xF0, 0xD0, 0xF0, 0x60, 0xF0,
+0x26, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x60, 0xD0, 0xF0, 0x22, 0xF5, 0x20, 0xF1, 0x22, 0xF0, 0xD0,
+0x60, 0x10, 0xA0, 0x02, 0xE0, 0x30, 0x0F, 0x3F, 0x0F, 0x3E, 0x50, 0x30, 0x40, 0x00, 0xA0, 0xC0,
+0x00, 0x70, 0x60, 0xB0, 0xD0, 0xF0, 0xD0, 0xA0, 0x10, 0x00, 0x81, 0x05, 0x50, 0xC0, 0x03, 0x40,
+0x0F, 0x02, 0x40, 0x80, 0x40, 0x0D, 0x40, 0x06, 0xA0, 0x10, 0xE0, 0xA0, 0x90, 0x01, 0x41, 0x0B,
+0xC0, 0xA0, 0xC0, 0x0A, 0x10, 0x51, 0x05, 0xC0, 0x10, 0xC0, 0x02, 0x40, 0x08, 0xC0, 0x10, 0xE0,
+0x30, 0x50, 0x0B, 0x40, 0x06, 0xC0, 0x01, 0x90, 0x10, 0x90, 0xA0, 0x80, 0xD0, 0xF0, 0x21, 0xF0,
+0x20, 0xF5, 0xB0, 0xF0, 0x20, 0xF3, 0xD0, 0x40, 0xE0, 0x02, 0xC0, 0xA0, 0x80, 0xC0, 0x0B, 0xC0,
+0x30, 0x70, 0xD2, 0xF1, 0x21, 0xF2, 0x22, 0xF1, 0x60, 0xF1, 0x26, 0xF0, 0x20, 0xF1, 0x23, 0xF0,
+0x60, 0xF2, 0x21, 0xF8, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xB0, 0x60, 0x70, 0xC0, 0x00, 0x70, 0x00,
+0x50, 0xA0, 0x0F, 0x3E, 0x0F, 0x3E, 0xA0, 0x80, 0x02, 0x70, 0xA0, 0xB0, 0xD0, 0xB0, 0x60, 0xD1,
+0x60, 0x80, 0x01, 0x40, 0x30, 0x80, 0xC0, 0x09, 0x40, 0x0F, 0x01, 0xC0, 0x80, 0x90, 0x0D, 0x51,
+0x05, 0xC0, 0x90, 0xC0, 0x03, 0xE0, 0x80, 0x0D, 0x90, 0x00, 0x70, 0x50, 0x07, 0x90, 0xC0, 0x50,
+0x06, 0x30, 0xE0, 0x02, 0x40, 0x09, 0x40, 0xE0, 0x00, 0x50, 0x0B, 0x40, 0x04, 0xE0, 0xA0, 0x70,
+0x30, 0x00, 0x90, 0x30, 0xE0, 0xA0, 0xF0, 0xD0, 0x21, 0xF1, 0x21, 0xF2, 0xD0, 0xB1, 0x21, 0xF1,
+0xD1, 0x90, 0x70, 0x30, 0xC0, 0x02, 0x80, 0x30, 0xA0, 0x80, 0x0A, 0xC0, 0x90, 0xA1, 0x30, 0xD0,
+0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0xB1, 0xD0, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20,
+0xF1, 0x21, 0xF1, 0xB1, 0xF7, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0,
+0xA0, 0x70, 0xC0, 0x01, 0x90, 0xE0, 0x0F, 0x3D, 0x0F, 0x3D, 0x70, 0x90, 0xA0, 0x50, 0x00, 0x50,
+0x70, 0xF0, 0xD2, 0x60, 0xB0, 0xD0, 0xF0, 0x70, 0x02, 0xC1, 0x10, 0xC0, 0x08, 0x51, 0x0F, 0x01,
+0x80, 0x50, 0x0E, 0x40, 0x0C, 0x10, 0x30, 0xC0, 0x0C, 0x40, 0xC0, 0x11, 0x09, 0x90, 0x07, 0x10,
+0x02, 0x90, 0x04, 0xC4, 0x50, 0x80, 0x50, 0x90, 0x52, 0xC3, 0x04, 0x90, 0x04, 0x70, 0x80, 0x50,
+0xA0, 0x30, 0x10, 0x70, 0xA0, 0x80, 0xB0, 0xF0, 0x21, 0xF6, 0xD0, 0x60, 0xD5, 0xA0, 0x10, 0x50,
+0x04, 0x40, 0x10, 0x50, 0xA0, 0x80, 0x09, 0x90, 0x01, 0x40, 0x10, 0xE0, 0xD0, 0xF1, 0x20, 0xF1,
+0x21, 0xF0, 0x20, 0xD0, 0x60, 0xD0, 0xF0, 0x22, 0xF2, 0x22, 0xF4, 0xD0, 0xB0, 0x60, 0xF1, 0x21,
+0xF3, 0x24, 0xF4, 0xD0, 0xB1, 0xD0, 0xF0, 0xD1, 0xA0, 0x90, 0x01, 0xA0, 0x50, 0x70, 0xC0, 0x0F,
+0x3B, 0x0F, 0x3C, 0x70, 0xC0, 0x01, 0xA0, 0x40, 0x70, 0xD1, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF0,
+0xD0, 0xB0, 0x70, 0x80, 0x30, 0x70, 0x80, 0x50, 0x0A, 0x40, 0x0F, 0x00, 0xC0, 0x30, 0x50, 0x0E,
+0x90, 0xC0, 0x0B, 0x10, 0x80, 0x90, 0x08, 0x30, 0x02, 0x90, 0x00, 0xC0, 0x10, 0x90, 0x08, 0x40,
+0x05, 0xC1, 0x93, 0x41, 0x91, 0x50, 0x92, 0x51, 0xC2, 0x50, 0x90, 0xC0, 0x54, 0x91, 0x40, 0x91,
+0x41, 0x90, 0x40, 0x90, 0x50, 0xC0, 0x00, 0x80, 0xA0, 0x50, 0x80, 0x30, 0x10, 0x80, 0xC0, 0xD0,
+0xF0, 0x21, 0xF5, 0xD1, 0x60, 0xB0, 0x71, 0xA1, 0x70, 0x30, 0x05, 0x50, 0x10, 0xE0, 0x80, 0xE0,
+0x10, 0x08, 0xC0, 0x90, 0x01, 0x40, 0x10, 0x70, 0xE0, 0xD1, 0x23, 0xF1, 0xD0, 0xB1, 0xD0, 0xF0,
+0x21, 0xF0, 0x20, 0xF3, 0x20, 0xF3, 0xD0, 0xF0, 0x60, 0xD0, 0x24, 0xF1, 0x27, 0xF1, 0xD0, 0xF0,
+0x60, 0xF4, 0xD0, 0xA0, 0x40, 0xA0, 0xC0, 0x01, 0xA0, 0xC0, 0x0F, 0x3A, 0x0F, 0x3A, 0x50, 0xA1,
+0xC0, 0x01, 0x40, 0x70, 0xD1, 0x20, 0xF3, 0xD0, 0x60, 0xF0, 0xD1, 0x40, 0xE0, 0x10, 0xE0, 0x30,
+0x0B, 0x40, 0x0E, 0xC0, 0x30, 0x90, 0xC0, 0x0E, 0x40, 0x0D, 0x40, 0x08, 0x40, 0x02, 0x51, 0x00,
+0x30, 0x10, 0x08, 0x40, 0x51, 0x91, 0x41, 0x90, 0x50, 0xC0, 0x00, 0xC1, 0x00, 0x40, 0x00, 0xC0,
+0x10, 0x50, 0x06, 0xC0, 0x50, 0x0B, 0x50, 0x01, 0xC1, 0x51, 0x30, 0x80, 0xA0, 0x70, 0x80, 0x31,
+0x10, 0xF0, 0xD0, 0xF1, 0xD1, 0xF3, 0xD0, 0xF0, 0xB0, 0x60, 0xA0, 0x01, 0x90, 0xE0, 0x10, 0x05,
+0x90, 0x00, 0xA0, 0x30, 0x0A, 0x90, 0xC0, 0x02, 0xA0, 0x70, 0x10, 0xE0, 0xD0, 0xF0, 0x22, 0xF2,
+0x60, 0xD0, 0xF1, 0x23, 0xF3, 0x20, 0xF2, 0xD0, 0xF0, 0x60, 0xF1, 0x2E, 0xF2, 0x60, 0xF1, 0x20,
+0xF3, 0xD0, 0xA0, 0x80, 0x01, 0xC0, 0xA1, 0x50, 0x0F, 0x39, 0x0F, 0x39, 0xC0, 0xA0, 0x01, 0xA0,
+0xC0, 0x40, 0xA0, 0xD0, 0xF0, 0x20, 0xD0, 0x21, 0xF3, 0x60, 0xD1, 0x70, 0x81, 0x70, 0x80, 0x30,
+0x90, 0x09, 0x51, 0x0D, 0xC0, 0xA0, 0x00, 0x40, 0x0E, 0x90, 0xC0, 0x0C, 0xC0, 0x50, 0x0C, 0x90,
+0x00, 0x70, 0x10, 0x40, 0x02, 0xC1, 0x50, 0x90, 0x41, 0x90, 0xC1, 0x06, 0x70, 0x10, 0xE2, 0x10,
+0xE1, 0x06, 0xC0, 0x50, 0x06, 0x40, 0x10, 0xA0, 0x30, 0x70, 0x40, 0x05, 0x70, 0xA0, 0x40, 0xE0,
+0x70, 0x40, 0x80, 0x30, 0x60, 0xB2, 0xF6, 0xB0, 0xD0, 0x31, 0x02, 0xC0, 0x10, 0x50, 0xE0, 0xC0,
+0x50, 0x31, 0x50, 0x0B, 0xC1, 0x90, 0x03, 0xC0, 0x10, 0xA0, 0xB0, 0xF1, 0x20, 0xF0, 0x21, 0xD0,
+0x60, 0xF2, 0x20, 0xF1, 0x20, 0xF4, 0x22, 0xF1, 0xB1, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF4,
+0x20, 0xF1, 0x60, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0x31, 0x00, 0xA0, 0xC0, 0x00, 0xA0, 0x50,
+0x0F, 0x38, 0x0F, 0x38, 0xC0, 0x10, 0xC0, 0x02, 0xE0, 0x30, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0,
+0x20, 0xF1, 0xB0, 0x60, 0xD0, 0xA0, 0x01, 0x40, 0x50, 0x00, 0x80, 0x30, 0x09, 0x90, 0xC0, 0x0C,
+0x80, 0x50, 0x00, 0x50, 0xC0, 0x0E, 0x90, 0x0D, 0x40, 0x0C, 0x40, 0x00, 0x41, 0xE0, 0x50, 0x40,
+0x91, 0x50, 0xC0, 0x01, 0xC0, 0x50, 0x09, 0x90, 0x41, 0x10, 0x90, 0x08, 0xC0, 0x50, 0x06, 0xC0,
+0x80, 0x40, 0x30, 0xE0, 0x30, 0xA0, 0x40, 0x02, 0x81, 0xA0, 0x00, 0xA1, 0x80, 0xB0, 0xD1, 0xB2,
+0x61, 0xB0, 0xF1, 0xD1, 0x60, 0xB0, 0x30, 0x04, 0xA0, 0x90, 0x70, 0x12, 0xA0, 0x0A, 0x40, 0x80,
+0x70, 0xA0, 0xC0, 0x04, 0x90, 0xA0, 0xD0, 0xF6, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF4, 0x21,
+0xF1, 0x60, 0xF1, 0x21, 0xF2, 0x24, 0xF6, 0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0xD0,
+0x80, 0x10, 0xC0, 0x02, 0x10, 0x50, 0x0F, 0x37, 0x0F, 0x37, 0xC0, 0x70, 0x00, 0x70, 0xC0, 0x00,
+0xA0, 0x60, 0xD0, 0xF6, 0x21, 0xF0, 0x20, 0xD0, 0xB0, 0x60, 0x80, 0x40, 0x00, 0x50, 0x80, 0x01,
+0xC0, 0x70, 0x40, 0x08, 0x40, 0x0C, 0x40, 0x70, 0x01, 0x40, 0x0E, 0x90, 0xC0, 0x0C, 0x40, 0x0C,
+0x50, 0x91, 0x40, 0x70, 0x50, 0x07, 0x90, 0x0B, 0x90, 0x0A, 0xC0, 0x50, 0x0A, 0x50, 0xA0, 0x90,
+0x10, 0x50, 0x00, 0xC0, 0x70, 0xD0, 0xA0, 0x00, 0x90, 0x10, 0xA0, 0x80, 0xD1, 0xF0, 0xD0, 0xF2,
+0xB1, 0x63, 0x40, 0x80, 0x04, 0xA0, 0x30, 0x80, 0x30, 0x70, 0x80, 0xA0, 0x30, 0x09, 0x70, 0xA0,
+0x30, 0x71, 0x11, 0x80, 0x40, 0x90, 0xC0, 0x10, 0x30, 0xD0, 0xF4, 0x60, 0xF3, 0x20, 0xF0, 0x23,
+0xF3, 0x20, 0xF1, 0x60, 0xF3, 0x22, 0xF3, 0x24, 0xF1, 0xD0, 0xB1, 0xD0, 0xF2, 0x24, 0xF2, 0xD0,
+0x60, 0x70, 0x01, 0x70, 0x00, 0xA0, 0x90, 0x0F, 0x36, 0x0F, 0x36, 0x50, 0x70, 0x02, 0x30, 0xA0,
+0x60, 0xD0, 0xF1, 0x22, 0xF3, 0x21, 0xF1, 0xD0, 0xB1, 0x70, 0x01, 0xA0, 0x03, 0x40, 0xA0, 0xC0,
+0x06, 0xC0, 0x90, 0x0C, 0x90, 0x30, 0x00, 0x51, 0x0D, 0xC0, 0x90, 0x09, 0xC0, 0x70, 0xC1, 0x50,
+0x08, 0x50, 0x90, 0x41, 0x50, 0x00, 0x91, 0x08, 0x90, 0x0B, 0x40, 0x0A, 0xC0, 0x50, 0x0A, 0x50,
+0x90, 0xA0, 0x80, 0x12, 0x40, 0xD0, 0xA0, 0x01, 0x90, 0x50, 0x80, 0xA0, 0x70, 0xD1, 0xF2, 0xD0,
+0xF0, 0xD1, 0xB0, 0x61, 0x30, 0xC0, 0x02, 0x90, 0xA0, 0xD0, 0x60, 0xF0, 0xD0, 0xB0, 0x90, 0x60,
+0xE0, 0x40, 0x90, 0xC0, 0x06, 0x40, 0x30, 0x40, 0x50, 0x90, 0x70, 0x10, 0xE0, 0x70, 0x11, 0xB1,
+0xF3, 0xB1, 0xD0, 0x20, 0xF2, 0x24, 0xF5, 0xB1, 0xF2, 0x24, 0xF2, 0x25, 0xD0, 0xB0, 0x60, 0xD0,
+0x20, 0xF2, 0x28, 0xD0, 0xB0, 0x70, 0x30, 0xC0, 0x01, 0x30, 0x90, 0x0F, 0x35, 0x0F, 0x2C, 0xC0,
+0x07, 0xC0, 0xA0, 0x30, 0xC0, 0x01, 0xA0, 0x80, 0xD0, 0xF0, 0x24, 0xF4, 0x22, 0xF1, 0xB0, 0x80,
+0x40, 0x00, 0xA0, 0x05, 0x81, 0x06, 0x90, 0xC0, 0x0B, 0xC0, 0xA0, 0x01, 0x40, 0x0E, 0x40, 0x07,
+0xC0, 0x00, 0x50, 0x10, 0x90, 0x00, 0x40, 0x05, 0x50, 0x91, 0x50, 0x02, 0x90, 0x0B, 0x40, 0x0B,
+0x40, 0x0A, 0xC0, 0x50, 0x0A, 0x90, 0x01, 0x51, 0xC1, 0xA0, 0xD0, 0xA0, 0x02, 0x90, 0x01, 0x90,
+0x70, 0x80, 0x60, 0xD0, 0xF3, 0xD0, 0x60, 0xF0, 0xD0, 0x31, 0x81, 0x30, 0x70, 0xD4, 0x60, 0xF0,
+0xD0, 0x60, 0xE0, 0x10, 0x70, 0xA0, 0x06, 0x40, 0x30, 0x10, 0xA0, 0x90, 0xD2, 0xB0, 0x70, 0xE0,
+0x10, 0x60, 0xD0, 0x20, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x24, 0xF6, 0x60, 0xD0, 0xF2, 0x23, 0xF2,
+0x21, 0xF0, 0x20, 0xF3, 0x60, 0xD0, 0xF4, 0x27, 0xF1, 0xD0, 0x60, 0x70, 0x01, 0xC0, 0x30, 0xA0,
+0x50, 0x0F, 0x34, 0x0F, 0x2B, 0x81, 0x40, 0x05, 0xC0, 0x70, 0x01, 0x70, 0x00, 0xA0, 0x80, 0xD0,
+0xF2, 0x24, 0xF3, 0x22, 0xF0, 0xD1, 0x60, 0x30, 0x00, 0x30, 0x02, 0x80, 0xA1, 0x80, 0x50, 0xA0,
+0x40, 0x02, 0x51, 0x00, 0x40, 0x0C, 0xA0, 0x01, 0xC0, 0x90, 0x0D, 0xC0, 0x90, 0x05, 0x30, 0x70,
+0xC0, 0x00, 0x40, 0x01, 0x90, 0xC0, 0x01, 0x50, 0x40, 0x90, 0x50, 0x05, 0x40, 0x0B, 0x40, 0x0B,
+0x90, 0x0A, 0xC0, 0x50, 0x0A, 0x90, 0x05, 0xA0, 0xD0, 0xA0, 0xC0, 0x01, 0x40, 0x03, 0x40, 0x31,
+0xD0, 0xF2, 0xD0, 0x60, 0xF2, 0x61, 0x30, 0x60, 0xB0, 0x60, 0xB0, 0xF2, 0x60, 0xF0, 0xD2, 0x61,
+0x70, 0x05, 0x51, 0x00, 0xC0, 0x90, 0xA0, 0x70, 0x60, 0xD2, 0x60, 0x30, 0xF2, 0xB1, 0xF4, 0x23,
+0xF3, 0x20, 0xF1, 0x60, 0xD0, 0x20, 0xF0, 0x22, 0xF4, 0x24, 0xF1, 0x20, 0x60, 0xF3, 0x21, 0xF0,
+0x29, 0xF0, 0xD0, 0xB0, 0x70, 0x00, 0xA0, 0x50, 0x00, 0xA0, 0x50, 0x0F, 0x33, 0x0F, 0x2A, 0xC0,
+0x30, 0x40, 0x80, 0x04, 0xC0, 0x10, 0x03, 0x10, 0x60, 0xD0, 0xF1, 0x26, 0xF2, 0x23, 0xF1, 0xD0,
+0xF0, 0x30, 0xC0, 0x70, 0x40, 0x80, 0x70, 0x40, 0x01, 0xA0, 0x01, 0x40, 0xA0, 0x90, 0x00, 0x40,
+0x80, 0x00, 0xC0, 0x40, 0x0B, 0x70, 0x02, 0x40, 0xC0, 0x0D, 0x40, 0x04, 0xC0, 0xE0, 0x40, 0x70,
+0x03, 0xC0, 0x42, 0xC0, 0x08, 0x50, 0x40, 0x02, 0xA0, 0x06, 0x50, 0xC0, 0x0A, 0x90, 0x0A, 0xC0,
+0x50, 0x0A, 0x90, 0x04, 0x40, 0x30, 0xD0, 0x70, 0x01, 0xC0, 0x90, 0x05, 0x30, 0xB0, 0xD0, 0xF1,
+0xB0, 0x60, 0xD0, 0xF0, 0xD0, 0xF0, 0x70, 0xD1, 0xF0, 0xD0, 0xF0, 0x62, 0xB0, 0xD0, 0xF1, 0xD0,
+0xB0, 0xE0, 0x30, 0x00, 0x90, 0x03, 0x40, 0x05, 0x30, 0x70, 0xF0, 0xD3, 0x21, 0x60, 0xF1, 0x20,
+0xF1, 0x24, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xF0, 0x23, 0xF4, 0x22, 0xF3, 0xD0, 0x60, 0xF3,
+0x20, 0xF1, 0x2B, 0xF0, 0xD0, 0xB0, 0x10, 0xC0, 0x02, 0x10, 0x50, 0x0F, 0x32, 0x0F, 0x2B, 0xC0,
+0x40, 0x04, 0xC0, 0xA0, 0x00, 0x70, 0xC0, 0x00, 0xA0, 0x60, 0xB1, 0xF3, 0x25, 0xF3, 0x21, 0xF0,
+0x20, 0xF0, 0xB0, 0xA0, 0x90, 0x40, 0x10, 0x90, 0x02, 0x31, 0xC0, 0x01, 0x71, 0x30, 0x90, 0xE0,
+0x01, 0x51, 0x0A, 0xC0, 0x70, 0x02, 0x40, 0x0D, 0xC0, 0x50, 0x04, 0xC0, 0x70, 0xA0, 0x90, 0x00,
+0xC0, 0x91, 0x40, 0x08, 0xA1, 0x00, 0x70, 0xA0, 0x42, 0x10, 0xC0, 0x05, 0xC0, 0x90, 0x08, 0x50,
+0x31, 0x40, 0x50, 0x00, 0x80, 0x12, 0xC0, 0x02, 0xC0, 0x50, 0x0A, 0x40, 0x04, 0x70, 0xD1, 0xA0,
+0x01, 0x50, 0xC0, 0x05, 0xC0, 0x70, 0xD0, 0x60, 0xD0, 0xB1, 0xF1, 0xD0, 0x60, 0xA0, 0xD0, 0xF0,
+0xD0, 0xF2, 0xD0, 0x62, 0xB0, 0x20, 0xF0, 0xD1, 0x30, 0xA0, 0x10, 0x90, 0xC0, 0x90, 0x80, 0xC0,
+0x06, 0x80, 0xE0, 0xD1, 0x60, 0xF0, 0xD0, 0x60, 0xF2, 0x28, 0xF2, 0xD0, 0xB1, 0xD0, 0xF0, 0x23,
+0xF4, 0x23, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0x2B, 0xF2, 0x60, 0x40, 0xA0, 0x01,
+0x70, 0xC0, 0x30, 0x90, 0x0F, 0x31, 0x0F, 0x28, 0xC0, 0x71, 0x40, 0x04, 0xC0, 0xA0, 0x02, 0x30,
+0xA0, 0x60, 0xD0, 0xF0, 0x60, 0x20, 0xF3, 0x24, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xE0, 0x50,
+0x90, 0x10, 0x40, 0xC0, 0x00, 0xE0, 0xA0, 0x30, 0x02, 0x10, 0x00, 0xC0, 0x80, 0x10, 0x02, 0x40,
+0x0B, 0x30, 0xC0, 0x01, 0x51, 0x0D, 0x40, 0x05, 0xC0, 0x70, 0x90, 0x40, 0x50, 0x01, 0x50, 0xC0,
+0x06, 0x71, 0x10, 0xE1, 0x50, 0x80, 0x70, 0xE0, 0x70, 0x10, 0x70, 0xC0, 0x04, 0x40, 0x05, 0x90,
+0xE0, 0x00, 0xC0, 0x30, 0x80, 0xE0, 0x10, 0xE0, 0x10, 0x80, 0xC0, 0x30, 0x40, 0x02, 0xC0, 0x50,
+0x0A, 0x40, 0x03, 0x40, 0x80, 0xD1, 0xA0, 0x01, 0x90, 0xC0, 0x02, 0x30, 0x90, 0x00, 0x90, 0x10,
+0x70, 0x30, 0xE0, 0x60, 0xF3, 0xD1, 0xA0, 0x70, 0x30, 0xF3, 0xB0, 0xD0, 0xF0, 0xB0, 0x60, 0xB1,
+0xD2, 0x11, 0x70, 0xA0, 0x30, 0x70, 0x50, 0x01, 0xC1, 0x50, 0xC0, 0x00, 0xB0, 0xA0, 0xB0, 0xE0,
+0x10, 0xB0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF2, 0x60, 0xF2, 0x23,
+0xF3, 0x24, 0xF0, 0xD0, 0x60, 0xB0, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x29, 0xF2, 0x60, 0xF0, 0xD0,
+0x60, 0xA0, 0x30, 0xC0, 0x01, 0xA0, 0xC0, 0x0F, 0x30, 0x0F, 0x28, 0x70, 0x90, 0xC0, 0x71, 0x03,
+0x70, 0xA0, 0xC0, 0x01, 0xA0, 0x80, 0xD0, 0xF1, 0x20, 0x60, 0xF0, 0xD1, 0xF1, 0x24, 0xF0, 0x21,
+0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xA0, 0xC1, 0x70, 0xE0, 0x10, 0x00, 0x10, 0x90, 0x30, 0x00, 0xC0,
+0xE0, 0x80, 0x02, 0x10, 0x30, 0x80, 0x01, 0x40, 0x0A, 0xA0, 0x03, 0x40, 0x0D, 0x51, 0x03, 0xC0,
+0x90, 0x50, 0xC0, 0x03, 0xC0, 0x90, 0x06, 0xC0, 0x50, 0x00, 0xC0, 0x00, 0x40, 0x01, 0xC0, 0x40,
+0x90, 0xE0, 0xA0, 0x04, 0x40, 0x0A, 0x50, 0x00, 0x50, 0x80, 0xA0, 0x50, 0x03, 0xC1, 0x51, 0x0A,
+0x40, 0x03, 0xA0, 0xB0, 0xF0, 0xD0, 0x30, 0x40, 0x00, 0x90, 0x02, 0x31, 0x71, 0x50, 0xC0, 0x01,
+0x81, 0xF0, 0x21, 0xD0, 0xB0, 0x30, 0x60, 0x30, 0xE0, 0x60, 0xD1, 0xB1, 0xF1, 0xD1, 0xB0, 0x61,
+0xB0, 0xD1, 0x30, 0x70, 0xA0, 0x90, 0xB0, 0xA3, 0x32, 0xA4, 0x80, 0x30, 0xD0, 0xF1, 0x21, 0xF0,
+0x22, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0x23, 0xF1, 0xB0,
+0x60, 0xD0, 0xF2, 0x21, 0xF1, 0x20, 0xF0, 0x26, 0xF3, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0x70,
+0x02, 0xA0, 0x70, 0xC0, 0x06, 0x50, 0xC0, 0x0F, 0x26, 0x0F, 0x28, 0xE0, 0x02, 0x80, 0x70, 0x01,
+0x70, 0xC0, 0x00, 0x70, 0x00, 0xA0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xF0, 0xD0,
+0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF5, 0xD0, 0xB0, 0xA0, 0x00, 0x40, 0x70, 0x00, 0x40, 0x10,
+0x00, 0x30, 0xC0, 0x10, 0xE0, 0xC0, 0x02, 0x10, 0x00, 0x90, 0xA0, 0x80, 0xC0, 0x50, 0x08, 0x50,
+0x80, 0x03, 0xC0, 0x50, 0x0D, 0x40, 0x01, 0x50, 0x40, 0x90, 0x07, 0x40, 0x0B, 0x50, 0xC0, 0x03,
+0xA0, 0x30, 0x04, 0x40, 0x0A, 0x50, 0xC0, 0x06, 0x80, 0x10, 0x30, 0xA0, 0x30, 0x40, 0x00, 0x40,
+0x07, 0x30, 0xA0, 0x80, 0xC0, 0x31, 0xD1, 0x60, 0x70, 0xC0, 0x00, 0x40, 0x02, 0x80, 0x60, 0xD0,
+0xA1, 0x40, 0xC0, 0x00, 0xA0, 0x60, 0xD0, 0x20, 0xF1, 0xE0, 0xC0, 0xA0, 0xB0, 0xD3, 0x60, 0xD4,
+0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0x60, 0xDC, 0x80, 0x30, 0xE0, 0xD0, 0xF1, 0x25, 0xF0,
+0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0xF0, 0x60,
+0xD0, 0xF2, 0x27, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0xF4, 0xD0, 0xB0, 0x70,
+0x00, 0x70, 0xC0, 0x00, 0x70, 0x05, 0xA0, 0xE1, 0x0F, 0x26, 0x0F, 0x25, 0x50, 0x01, 0x90, 0x10,
+0x02, 0xA0, 0x50, 0xA0, 0x90, 0x02, 0x10, 0x80, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xF0, 0x60,
+0xF0, 0xD1, 0xF1, 0x24, 0xF5, 0xD1, 0x30, 0x10, 0x70, 0xA0, 0x00, 0x30, 0xE0, 0x00, 0xA0, 0x00,
+0x90, 0x04, 0x80, 0x02, 0x50, 0xA0, 0x30, 0xC0, 0x07, 0x80, 0x40, 0xC0, 0x03, 0x40, 0x0D, 0x50,
+0x90, 0x40, 0xC0, 0x05, 0x10, 0x90, 0x01, 0x51, 0x0B, 0x90, 0x0A, 0x90, 0x0A, 0x51, 0x07, 0x40,
+0xA0, 0x30, 0xA0, 0x10, 0x50, 0x10, 0x80, 0x05, 0xC0, 0xE0, 0x72, 0x60, 0xD0, 0xF1, 0x70, 0x01,
+0x40, 0x90, 0x01, 0x50, 0x70, 0xD1, 0xB0, 0x61, 0xA0, 0x70, 0x30, 0xF1, 0x20, 0xF0, 0xD0, 0x60,
+0xA1, 0xB0, 0xF2, 0xB1, 0xF0, 0xD0, 0xA0, 0x30, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x62,
+0xD1, 0xF4, 0xD0, 0xF2, 0x20, 0xD1, 0x60, 0xD0, 0xF3, 0x26, 0xF0, 0x20, 0xF1, 0x60, 0xD1, 0xF1,
+0x23, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x60, 0xD1, 0xF1, 0x29, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0,
+0x20, 0x60, 0xF0, 0xD1, 0x21, 0xF0, 0xD1, 0x60, 0xE0, 0xC0, 0x01, 0x50, 0xE0, 0x03, 0x30, 0xE0,
+0x00, 0x90, 0xE0, 0x0F, 0x25, 0x0F, 0x25, 0x40, 0xE0, 0xC0, 0x00, 0x80, 0xE0, 0x50, 0x00, 0xA0,
+0x70, 0x40, 0xA0, 0x01, 0x40, 0x30, 0xD0, 0xF1, 0x21, 0xF4, 0x60, 0xB0, 0xD0, 0xF2, 0x23, 0xF5,
+0xD1, 0x71, 0xA1, 0x80, 0xE0, 0x40, 0x00, 0x80, 0x50, 0x0B, 0x90, 0x80, 0x40, 0x06, 0xC0, 0x80,
+0xA0, 0x70, 0x50, 0xC2, 0x40, 0x0B, 0x50, 0x41, 0x07, 0xA0, 0xE0, 0x90, 0x01, 0x40, 0x0B, 0x40,
+0x02, 0xE0, 0x06, 0x50, 0xC0, 0x09, 0xC0, 0x50, 0x09, 0xC0, 0x50, 0xC0, 0x00, 0xA0, 0x10, 0xE0,
+0x70, 0x51, 0x01, 0xC0, 0xA0, 0xD3, 0xF0, 0xD0, 0x60, 0x80, 0xA2, 0x90, 0x01, 0x70, 0xD1, 0xF0,
+0xD3, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xF1, 0x20, 0xF0, 0xB0, 0xF0, 0xD1,
+0x33, 0xB0, 0xD1, 0xF0, 0xD1, 0x61, 0xB0, 0xF0, 0xD1, 0xF1, 0xD0, 0x20, 0xF4, 0x60, 0xB0, 0xD0,
+0x20, 0xF2, 0x23, 0xF0, 0x22, 0xF1, 0x60, 0xF0, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x28, 0xF1, 0x60,
+0xF3, 0x29, 0xF0, 0x20, 0xF3, 0x20, 0x60, 0x20, 0xF4, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0x80, 0x01,
+0x30, 0x40, 0xA0, 0x00, 0x80, 0x40, 0x00, 0x90, 0xA0, 0x00, 0x90, 0x0F, 0x25, 0x0F, 0x25, 0x40,
+0x70, 0xE0, 0x50, 0x00, 0x50, 0x71, 0xE0, 0x40, 0x01, 0xA0, 0x80, 0xA0, 0xD0, 0xF0, 0x25, 0xF3,
+0x60, 0xF3, 0x24, 0xF4, 0xD0, 0x60, 0x10, 0x40, 0x30, 0xA0, 0x10, 0xA0, 0x90, 0x01, 0xA0, 0x0C,
+0xC0, 0x80, 0xA0, 0x40, 0x08, 0x31, 0xA0, 0xC0, 0x90, 0xC0, 0x08, 0x50, 0x40, 0xC0, 0x00, 0x50,
+0xC0, 0x07, 0xE0, 0x70, 0xC0, 0x00, 0x40, 0x05, 0xC0, 0x80, 0x30, 0x80, 0xC0, 0x00, 0x50, 0x01,
+0x71, 0x06, 0xC0, 0x50, 0x06, 0x90, 0x80, 0x00, 0xC0, 0x90, 0x09, 0xC0, 0x50, 0x04, 0x30, 0x11,
+0xE0, 0x80, 0x31, 0xD0, 0xF5, 0xA0, 0xB0, 0xD0, 0x41, 0x00, 0x90, 0x30, 0xD1, 0xF1, 0xD1, 0xF0,
+0xD0, 0x60, 0xD0, 0xF1, 0x20, 0xF1, 0xD3, 0xF0, 0xD0, 0x60, 0xD3, 0x60, 0x30, 0x50, 0xA1, 0x60,
+0xD0, 0xF1, 0x60, 0xD0, 0xB0, 0x61, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60,
+0xF2, 0xB0, 0xF1, 0x20, 0xF3, 0x22, 0xF0, 0xB1, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20,
+0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xF4, 0x29, 0xF0, 0x20, 0xF3, 0x60, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x30, 0x80, 0xA0, 0x50, 0x00, 0x50, 0x80, 0xA0, 0x50, 0x01, 0xE0,
+0x01, 0x50, 0xC0, 0x0F, 0x23, 0x0F, 0x25, 0x40, 0x90, 0xC0, 0x10, 0x90, 0x01, 0x90, 0xE0, 0x02,
+0x90, 0x70, 0xD1, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xF0, 0xD0, 0xF1, 0x23, 0xF4,
+0xD0, 0x60, 0x70, 0x40, 0x10, 0x80, 0xA0, 0x10, 0x80, 0x30, 0x10, 0x30, 0x0D, 0x50, 0x00, 0x90,
+0xA0, 0x30, 0x08, 0xA0, 0xC0, 0x00, 0x40, 0x06, 0x90, 0x40, 0xC0, 0x03, 0x40, 0x07, 0xE0, 0x90,
+0xE0, 0xA0, 0x00, 0x90, 0x03, 0x90, 0x14, 0xA0, 0x40, 0x50, 0x70, 0x10, 0x06, 0x80, 0x40, 0x90,
+0x04, 0x80, 0x10, 0xE1, 0x01, 0x40, 0x09, 0xC0, 0x50, 0x04, 0xC2, 0x30, 0x10, 0x80, 0xD1, 0xF1,
+0x20, 0xF1, 0xD3, 0x60, 0xA0, 0x40, 0x70, 0xD0, 0xF1, 0xD1, 0x60, 0x70, 0xB0, 0xF0, 0xB0, 0xF0,
+0xD0, 0x20, 0xD0, 0x20, 0xF0, 0xD0, 0x31, 0x70, 0xA0, 0x30, 0xA0, 0x30, 0xA0, 0x70, 0xE0, 0x30,
+0x02, 0xC0, 0x10, 0x70, 0xD0, 0xB0, 0xF0, 0xD1, 0xF1, 0x61, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0xD0,
+0x60, 0xF1, 0x20, 0xD0, 0x30, 0x60, 0xD0, 0xF4, 0x20, 0xF2, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20,
+0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF2, 0x20, 0xF0, 0x27, 0xF0, 0x20,
+0xF2, 0xD0, 0x60, 0xF2, 0x21, 0xF2, 0x23, 0xD1, 0xA0, 0x80, 0x02, 0xE0, 0x70, 0xA0, 0x90, 0xE0,
+0x80, 0xC0, 0xE0, 0x70, 0xE0, 0x90, 0x0F, 0x22, 0x0F, 0x22, 0xC0, 0x40, 0xC0, 0x03, 0xE0, 0x80,
+0x50, 0x30, 0x00, 0x70, 0xC1, 0x70, 0xD0, 0xF0, 0x24, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x60, 0xF0,
+0xD0, 0xF0, 0x24, 0xF3, 0xD0, 0x60, 0x80, 0x30, 0x70, 0x80, 0x10, 0x90, 0xE0, 0xA0, 0x00, 0x70,
+0x0E, 0x40, 0x01, 0xC0, 0xA0, 0x30, 0x50, 0x05, 0xA0, 0x01, 0x51, 0x03, 0x50, 0x40, 0xC0, 0x00,
+0x51, 0x02, 0x40, 0xC0, 0x06, 0x40, 0x80, 0xD0, 0xA0, 0x50, 0x90, 0x02, 0x50, 0x10, 0x30, 0xA0,
+0x11, 0xA0, 0xE0, 0xA0, 0x41, 0x01, 0xC1, 0x03, 0x30, 0xC0, 0x90, 0x03, 0x31, 0x50, 0xE0, 0x50,
+0x01, 0x40, 0x09, 0xC0, 0x50, 0x09, 0xE0, 0xD0, 0xF0, 0x23, 0xF1, 0xD0, 0xF1, 0x61, 0x80, 0xD1,
+0xF1, 0xA0, 0x70, 0x80, 0xC0, 0x30, 0xB0, 0xF3, 0xD3, 0x60, 0xA0, 0x01, 0x90, 0x00, 0x90, 0x80,
+0x00, 0x50, 0x04, 0x40, 0x00, 0x10, 0x30, 0xB0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x60, 0xB0,
+0xF1, 0xD1, 0xB1, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0x10, 0x30, 0xD0, 0xF0, 0xD0, 0xF1, 0x20, 0xF0,
+0xD0, 0x60, 0xF2, 0x24, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xB1, 0xF3, 0x2A, 0xF0, 0x20, 0xF2,
+0x60, 0xF2, 0x23, 0xF3, 0x22, 0xD1, 0xA0, 0x90, 0x00, 0x70, 0xC0, 0x40, 0x31, 0x91, 0x10, 0x50,
+0x00, 0xC0, 0x70, 0x0F, 0x22, 0x0F, 0x21, 0x50, 0x70, 0x30, 0xE0, 0x04, 0x40, 0x70, 0x02, 0x71,
+0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0xD0, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x24, 0xF0,
+0x21, 0xD0, 0x60, 0x70, 0x10, 0xA0, 0x10, 0x80, 0x40, 0x10, 0x30, 0xC0, 0xA0, 0x0E, 0xC0, 0x40,
+0x02, 0xC0, 0x80, 0xA0, 0x90, 0x03, 0xA0, 0xC0, 0x01, 0x40, 0x01, 0x50, 0x40, 0xC0, 0x02, 0x50,
+0x10, 0x40, 0x50, 0x80, 0x10, 0x40, 0x05, 0x50, 0x00, 0x70, 0xD0, 0xB0, 0xA0, 0x90, 0x50, 0xC0,
+0x80, 0x10, 0xA1, 0x70, 0x10, 0xA0, 0x00, 0xC0, 0x00, 0x90, 0x02, 0xE0, 0x10, 0x05, 0x90, 0xC0,
+0x02, 0x70, 0x91, 0x70, 0x02, 0xA0, 0x50, 0x08, 0xC0, 0x50, 0x03, 0xE0, 0x10, 0x80, 0x02, 0x70,
+0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x60, 0xD1, 0xF1, 0xD0, 0x60, 0x80, 0xC0, 0x00, 0x40, 0x30,
+0x60, 0xF0, 0xD0, 0xF0, 0xB0, 0xA0, 0x60, 0xD1, 0xA0, 0xC0, 0x01, 0x40, 0x0B, 0x80, 0xA0, 0x80,
+0xD3, 0xF0, 0x60, 0xD0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0x60, 0xF2, 0x20, 0xD0, 0x60, 0x10, 0xE0,
+0x60, 0xD0, 0xF1, 0x20, 0xF1, 0xB1, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20,
+0xD0, 0xF0, 0x60, 0xF2, 0x22, 0xF0, 0x29, 0xF1, 0x20, 0x60, 0xF1, 0xD0, 0xF2, 0x22, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0xD1, 0xA0, 0xE0, 0xC0, 0x01, 0xA0, 0xC0, 0x00, 0xE0, 0xC0, 0x01, 0x80, 0x30,
+0x0F, 0x22, 0x0F, 0x21, 0x30, 0x90, 0x00, 0x71, 0x30, 0x02, 0xE0, 0x10, 0x80, 0x01, 0xA0, 0xF3,
+0x21, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xF3, 0x21, 0xF1, 0x20, 0xF0,
+0xD0, 0xA0, 0x11, 0x30, 0x70, 0xC0, 0x70, 0x11, 0x90, 0x80, 0x0F, 0x00, 0x51, 0x04, 0x40, 0xA0,
+0x80, 0xC0, 0x00, 0x30, 0x02, 0xC0, 0x90, 0x40, 0x50, 0x05, 0xC0, 0x80, 0x30, 0x80, 0x40, 0x70,
+0x04, 0xA2, 0x60, 0xD1, 0x80, 0x30, 0xA0, 0x10, 0x70, 0xA1, 0xC0, 0x00, 0x50, 0x03, 0x50, 0xC0,
+0x01, 0x10, 0x70, 0xC0, 0x04, 0x50, 0xC0, 0x02, 0x40, 0xE1, 0x70, 0x01, 0x30, 0xA0, 0x40, 0x00,
+0xC0, 0x90, 0xC0, 0x04, 0xC0, 0x50, 0x03, 0x40, 0x30, 0x40, 0x00, 0xC0, 0xA0, 0x80, 0xD0, 0xF0,
+0x22, 0xF2, 0x20, 0xF1, 0x60, 0xF1, 0x20, 0xF0, 0xD0, 0x30, 0x90, 0x00, 0xC0, 0x70, 0xD0, 0x60,
+0xD0, 0xF0, 0xD0, 0x70, 0xC0, 0x30, 0x60, 0xD0, 0x30, 0xD0, 0x00, 0x51, 0x0B, 0x90, 0x50, 0x70,
+0x31, 0xA0, 0x70, 0xA0, 0xE0, 0x60, 0xF0, 0xD0, 0xB0, 0x61, 0xB0, 0xD0, 0xF2, 0xD0, 0x60, 0x70,
+0x11, 0xA0, 0xD0, 0xF3, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x22, 0xF3, 0x60, 0xF0, 0xD0,
+0xF1, 0x22, 0xF1, 0x25, 0xF4, 0x60, 0x20, 0xF0, 0xD0, 0xF3, 0x23, 0xF3, 0x21, 0xF1, 0xD0, 0xA0,
+0xC0, 0x00, 0x40, 0x11, 0x40, 0x80, 0x01, 0x40, 0xE0, 0x00, 0x40, 0x30, 0x0F, 0x20, 0x0F, 0x21,
+0x40, 0x80, 0x00, 0xA0, 0x00, 0x31, 0x00, 0xA0, 0x50, 0xA0, 0x10, 0x30, 0xA0, 0xB0, 0xD0, 0xF6,
+0x25, 0xF1, 0x20, 0xF3, 0x60, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xB0, 0x11, 0xC0, 0xA0,
+0xE0, 0x00, 0xA0, 0xE1, 0x30, 0x80, 0x0F, 0x01, 0x40, 0x06, 0x50, 0x31, 0x70, 0x02, 0x90, 0x40,
+0x0C, 0x40, 0x80, 0x90, 0xA0, 0x00, 0x70, 0x60, 0xD2, 0xF0, 0xD1, 0x90, 0x30, 0x10, 0xE1, 0x04,
+0x50, 0x10, 0x00, 0xC0, 0x50, 0x01, 0xC0, 0x11, 0x04, 0xC0, 0x50, 0x03, 0x90, 0xE0, 0x90, 0x00,
+0x50, 0x90, 0x80, 0x00, 0xC0, 0x10, 0xA0, 0x40, 0x04, 0x51, 0x04, 0xC0, 0x10, 0xA0, 0x70, 0x30,
+0xB0, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xB1, 0xD0, 0x20, 0xF1, 0xD0, 0x70, 0x01, 0xA0, 0xB0, 0xF0,
+0xB0, 0xD0, 0xF1, 0xA0, 0x00, 0x90, 0x60, 0xD0, 0xF0, 0xA0, 0x00, 0x40, 0x0B, 0x50, 0xC0, 0x00,
+0xC1, 0x51, 0x00, 0xA0, 0x40, 0x60, 0xD1, 0x60, 0xA0, 0x30, 0x60, 0xF0, 0xD0, 0xF1, 0xD0, 0xB0,
+0x70, 0xA0, 0x00, 0x10, 0x70, 0xD2, 0x60, 0xF4, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0xD1, 0x60,
+0xF2, 0x22, 0xF3, 0x23, 0xF0, 0x20, 0xF1, 0xD1, 0x60, 0xF2, 0x21, 0xF1, 0x26, 0xF5, 0xD0, 0xF0,
+0x70, 0x30, 0x10, 0xE0, 0xC0, 0xE0, 0x70, 0x40, 0x70, 0xE0, 0x01, 0x30, 0xC0, 0x80, 0x0F, 0x1F,
+0x0F, 0x26, 0xC0, 0xA0, 0x80, 0x90, 0x01, 0x40, 0x10, 0x60, 0xD1, 0x20, 0xF4, 0x29, 0xF4, 0x60,
+0xB0, 0xF1, 0x22, 0xF1, 0xB0, 0x80, 0xE0, 0x90, 0x70, 0x30, 0x40, 0x70, 0x11, 0x00, 0x30, 0x90,
+0x0F, 0x01, 0x40, 0x08, 0x80, 0xA0, 0x40, 0x80, 0x01, 0x40, 0x0C, 0x30, 0x10, 0xA0, 0x70, 0x80,
+0xD0, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0x50, 0x30, 0x10, 0x80, 0x04, 0x40, 0x10, 0xC0, 0x01, 0x90,
+0x03, 0x10, 0x90, 0x03, 0xC0, 0x50, 0x06, 0xA0, 0x70, 0x00, 0x50, 0x01, 0xE0, 0x30, 0xA0, 0x04,
+0xC0, 0x50, 0x04, 0x40, 0x10, 0x30, 0xD0, 0x30, 0xB0, 0xD0, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF0,
+0xB1, 0xF1, 0x21, 0xD0, 0x60, 0xE1, 0x80, 0xD0, 0xB1, 0xD0, 0xF1, 0x70, 0x00, 0x30, 0x60, 0xD1,
+0x31, 0x50, 0x0B, 0x40, 0x07, 0x30, 0xB0, 0xD1, 0x31, 0xB0, 0xD0, 0x60, 0xB0, 0xF1, 0xD0, 0x30,
+0xA0, 0x80, 0x50, 0xC0, 0xE0, 0x70, 0x61, 0xB0, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x20,
+0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0x22, 0xF4, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xF0,
+0xD0, 0xF0, 0x21, 0xF0, 0x27, 0xF3, 0x20, 0xF2, 0xD0, 0xB0, 0x10, 0x30, 0x01, 0xC0, 0x70, 0x80,
+0x90, 0x02, 0x40, 0xA0, 0x50, 0x0F, 0x1F, 0x0F, 0x24, 0x90, 0x80, 0xA0, 0x32, 0xC0, 0x00, 0x40,
+0x30, 0xB1, 0xD0, 0xF1, 0x21, 0xF0, 0x23, 0xF2, 0x22, 0xF0, 0x20, 0xF4, 0x60, 0x20, 0xF3, 0x20,
+0xF0, 0xD0, 0xA0, 0xC0, 0x80, 0xE0, 0x80, 0xA0, 0x40, 0x70, 0x30, 0x50, 0x40, 0xC0, 0x90, 0x0F,
+0x00, 0xC0, 0x90, 0x08, 0x40, 0x50, 0x80, 0x30, 0x41, 0xC0, 0x0B, 0xC0, 0x30, 0xA0, 0x50, 0xD4,
+0xB0, 0xA0, 0x30, 0x70, 0xA0, 0x40, 0x04, 0x90, 0x11, 0x90, 0x01, 0x40, 0x03, 0x40, 0x05, 0x40,
+0x06, 0x10, 0xA0, 0x10, 0x90, 0xC0, 0x01, 0x80, 0x30, 0x04, 0x50, 0x40, 0x03, 0x90, 0xE0, 0x70,
+0xD2, 0x60, 0xD0, 0x22, 0xF3, 0x20, 0xF0, 0xB0, 0xF1, 0x22, 0xF0, 0xD0, 0xF1, 0xD1, 0x60, 0xD0,
+0xF1, 0xD0, 0x31, 0x70, 0xB0, 0xD0, 0xF0, 0xD0, 0x80, 0x90, 0x0A, 0x51, 0x07, 0x90, 0xA0, 0xD1,
+0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0x60, 0x30, 0x40, 0xA1, 0x00, 0x30, 0xE0,
+0x80, 0xD1, 0xF0, 0x22, 0xF1, 0xD0, 0x24, 0xF1, 0x60, 0xB0, 0xD0, 0xF2, 0x22, 0xF1, 0x24, 0xF4,
+0x60, 0xF5, 0x26, 0xF1, 0x23, 0xF2, 0xD0, 0xB0, 0x60, 0x81, 0x01, 0xA0, 0x80, 0x40, 0x0F, 0x26,
+0x0F, 0x24, 0x50, 0x80, 0x40, 0x30, 0x00, 0xC0, 0x30, 0x40, 0xA0, 0xD1, 0xB0, 0x60, 0xD0, 0xF2,
+0x24, 0xF4, 0x20, 0xF1, 0x21, 0xF2, 0x20, 0x60, 0xF1, 0x20, 0xD0, 0x20, 0xF0, 0xD0, 0xE0, 0x50,
+0x70, 0xA0, 0x31, 0xA0, 0xE0, 0x00, 0x90, 0x40, 0x00, 0x51, 0x0F, 0x00, 0x40, 0xC0, 0x05, 0x91,
+0x03, 0x40, 0x31, 0x50, 0x07, 0x90, 0x70, 0x40, 0x00, 0x90, 0x40, 0xE0, 0x80, 0xB0, 0x60, 0xB1,
+0xA0, 0x90, 0x02, 0x90, 0x04, 0xC0, 0xE0, 0xA0, 0x02, 0x50, 0xC0, 0x04, 0xC0, 0x03, 0x40, 0x06,
+0x40, 0x10, 0xE0, 0x50, 0xC0, 0x07, 0xC0, 0x10, 0x70, 0xC0, 0x02, 0x11, 0xB0, 0xD0, 0xF1, 0x60,
+0xF0, 0x22, 0xF3, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xF1, 0x20,
+0xF0, 0xD0, 0x60, 0x30, 0xD1, 0xF0, 0xD0, 0x81, 0x0A, 0x80, 0x09, 0x30, 0x60, 0xD0, 0x60, 0xF3,
+0xD0, 0xF0, 0x61, 0xD0, 0xE0, 0xA0, 0x00, 0x30, 0xC0, 0x40, 0x80, 0xA0, 0x70, 0xB0, 0xD0, 0x23,
+0xF3, 0x20, 0xF2, 0xB1, 0xD0, 0xF1, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0xF3, 0x60, 0xF3, 0x22, 0xF1,
+0x24, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x61, 0xD1, 0x30, 0x40, 0xA0, 0xC0, 0x00, 0x80, 0x40,
+0x0F, 0x25, 0x0F, 0x26, 0x70, 0x02, 0xC0, 0xE0, 0xD0, 0xF0, 0xD1, 0xB0, 0x60, 0xF2, 0x24, 0xF5,
+0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xF0, 0xD0, 0xF2, 0xD0, 0x70, 0x30, 0x70, 0x30, 0xE0,
+0x90, 0x10, 0x30, 0x00, 0x50, 0x80, 0x01, 0x90, 0xC0, 0x0F, 0x00, 0x40, 0x03, 0xC0, 0x40, 0xC0,
+0x06, 0x50, 0x32, 0x90, 0x04, 0x30, 0xE0, 0x30, 0x00, 0x51, 0x00, 0x40, 0x82, 0x31, 0x03, 0x51,
+0x04, 0x40, 0x50, 0x02, 0xC0, 0x90, 0x04, 0x10, 0x40, 0x02, 0x90, 0xC0, 0x06, 0xC0, 0x50, 0xC1,
+0x07, 0xC0, 0x10, 0x90, 0x02, 0x90, 0x10, 0xD3, 0xF0, 0x60, 0xF1, 0x22, 0xF4, 0x60, 0xD0, 0xF0,
+0x22, 0xF0, 0x23, 0xB1, 0xF0, 0x21, 0xF0, 0x20, 0xD1, 0xF0, 0x20, 0xD0, 0xB0, 0x80, 0x30, 0x09,
+0x90, 0xA0, 0x08, 0x40, 0xE0, 0x60, 0xB0, 0x60, 0xF1, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0x70, 0x01,
+0x70, 0x10, 0x50, 0xA0, 0x80, 0x00, 0x70, 0xD0, 0xF2, 0x20, 0xF5, 0xD0, 0xF0, 0x60, 0xF2, 0x20,
+0xF2, 0x27, 0xF2, 0xD0, 0x60, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x25,
+0xF1, 0x60, 0xB0, 0xD0, 0xF1, 0xD0, 0x70, 0x90, 0x02, 0xE0, 0x0F, 0x25, 0x0F, 0x25, 0x70, 0x90,
+0x70, 0xC0, 0x00, 0x70, 0xF0, 0xD0, 0xF2, 0xD0, 0xF0, 0x60, 0x20, 0xF0, 0x24, 0xF5, 0x21, 0xF0,
+0x21, 0xF1, 0x20, 0xF1, 0x60, 0xF0, 0xD0, 0xF1, 0xB0, 0x31, 0x80, 0x70, 0x10, 0x50, 0xA0, 0x10,
+0xC0, 0x30, 0xC0, 0x02, 0x40, 0xC0, 0x0E, 0xC0, 0x90, 0x01, 0x91, 0x09, 0x90, 0x00, 0x30, 0x80,
+0xA0, 0x30, 0x40, 0x06, 0x90, 0x06, 0x40, 0xC0, 0x02, 0x40, 0x0A, 0x40, 0x02, 0xA0, 0x10, 0xA0,
+0x90, 0x02, 0xC0, 0x50, 0x08, 0xC0, 0x50, 0x01, 0x90, 0x05, 0xC0, 0x50, 0x01, 0x80, 0x10, 0xD0,
+0xF0, 0xD0, 0xF1, 0xB1, 0xF1, 0x21, 0xF4, 0x20, 0x60, 0xD0, 0x20, 0xD0, 0x25, 0xF0, 0x60, 0x20,
+0xF5, 0x20, 0xF1, 0xD0, 0xB0, 0x80, 0x90, 0x06, 0xA0, 0x11, 0xA0, 0x70, 0x40, 0x05, 0x70, 0x10,
+0x70, 0x40, 0x70, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xF0, 0x20, 0xD1, 0x30, 0x10, 0x00,
+0x40, 0x31, 0xE0, 0x90, 0x40, 0x10, 0x70, 0xB0, 0xD0, 0xF0, 0xD0, 0x20, 0xF5, 0x60, 0xF1, 0x21,
+0xF3, 0x25, 0xF0, 0x20, 0xF2, 0x60, 0xF2, 0x21, 0xF0, 0x20, 0xF3, 0x20, 0xF3, 0x22, 0xF0, 0x20,
+0xF1, 0x60, 0xB0, 0xF2, 0x20, 0xD1, 0x70, 0x01, 0xA0, 0x90, 0x70, 0x0F, 0x24, 0x0F, 0x24, 0x80,
+0x40, 0x01, 0x30, 0x70, 0xB0, 0xD0, 0xF0, 0x21, 0xF3, 0x60, 0xB0, 0xF2, 0x24, 0xF3, 0x21, 0xF0,
+0x20, 0xF5, 0x60, 0xF0, 0xD1, 0xF0, 0x70, 0x80, 0x70, 0x10, 0x30, 0x80, 0x10, 0xE0, 0x00, 0x30,
+0xC0, 0x03, 0x40, 0xC0, 0x0E, 0x51, 0x40, 0xC0, 0x0A, 0xC0, 0x40, 0x30, 0x01, 0xC0, 0x40, 0xA0,
+0x30, 0x40, 0xC0, 0x02, 0x40, 0x50, 0x90, 0xC0, 0x03, 0x90, 0xC0, 0x02, 0x90, 0x0A, 0x40, 0x02,
+0x30, 0xA0, 0x04, 0xC0, 0x50, 0x08, 0xC0, 0x50, 0x01, 0x10, 0xA0, 0x04, 0xC0, 0x50, 0x01, 0x50,
+0x70, 0xD0, 0xF0, 0x21, 0xF0, 0xB1, 0xF0, 0x22, 0xF4, 0xB1, 0xD0, 0xF2, 0x20, 0xF1, 0x20, 0xF0,
+0xD0, 0x60, 0xF4, 0x23, 0xD0, 0xF0, 0x80, 0xE1, 0x80, 0x07, 0x51, 0x0B, 0x40, 0x60, 0xD0, 0xF1,
+0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x70, 0xC0, 0x40, 0xC0, 0x50, 0x00, 0x10, 0x40, 0x70, 0x40, 0xE1,
+0xB0, 0xD0, 0xF0, 0xD0, 0x21, 0xF0, 0xD0, 0xF0, 0x60, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0x26, 0xD0,
+0xF1, 0x60, 0xF2, 0x21, 0xF0, 0x22, 0xF2, 0x20, 0xF2, 0x22, 0xF0, 0x20, 0xD0, 0xF0, 0x60, 0x20,
+0xF2, 0x21, 0xF1, 0xD0, 0x70, 0xA0, 0xC0, 0x00, 0x90, 0x80, 0x0F, 0x23, 0x0F, 0x23, 0x50, 0x10,
+0x02, 0x81, 0xD0, 0xF0, 0x22, 0xF4, 0x60, 0xB0, 0xD0, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x20, 0x60, 0xF1, 0xD1, 0x70, 0x10, 0x70, 0xA0, 0xE2, 0x40, 0xA0,
+0x05, 0x40, 0x0E, 0x50, 0x80, 0x0D, 0x80, 0x90, 0x04, 0xC0, 0x40, 0x80, 0xA0, 0x80, 0xC0, 0x70,
+0xA0, 0x10, 0x09, 0xC0, 0x50, 0x09, 0x50, 0xC0, 0x01, 0x90, 0x06, 0x90, 0x09, 0x90, 0x01, 0x40,
+0x10, 0xC0, 0x03, 0xC0, 0x50, 0x01, 0x70, 0xD1, 0xF0, 0x20, 0xF1, 0xB1, 0xF1, 0x20, 0xF5, 0xB1,
+0xF2, 0x22, 0xF2, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0x80, 0x61, 0x70, 0x07,
+0x90, 0x0C, 0x40, 0x70, 0x60, 0xD0, 0xF0, 0xD0, 0xF2, 0x20, 0xD0, 0x70, 0x10, 0x01, 0x80, 0x90,
+0x00, 0x40, 0x50, 0x01, 0x10, 0x80, 0x10, 0xE1, 0xB0, 0xF3, 0x60, 0xF2, 0x23, 0xF2, 0x24, 0xF3,
+0x60, 0xF4, 0x20, 0xF0, 0x23, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xD0, 0xB0, 0x60, 0xF2, 0x20,
+0xF0, 0x22, 0xF0, 0xD0, 0x60, 0x30, 0x02, 0x70, 0x40, 0x0F, 0x22, 0x0F, 0x23, 0x70, 0x50, 0x70,
+0xC1, 0x70, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF1, 0x21,
+0xF0, 0x26, 0xF8, 0x60, 0xF0, 0xD0, 0x30, 0x70, 0x30, 0xE0, 0x70, 0xA0, 0xE0, 0x70, 0xC0, 0x70,
+0x05, 0xC0, 0x40, 0x0C, 0x40, 0xC0, 0x00, 0x40, 0x0C, 0xA0, 0x90, 0x08, 0x50, 0x80, 0x30, 0x70,
+0x40, 0x0A, 0x40, 0x0A, 0x40, 0x09, 0x40, 0x03, 0x80, 0x04, 0x90, 0x02, 0x10, 0x50, 0x03, 0xC0,
+0x50, 0x00, 0x40, 0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0x60, 0xF2, 0x21, 0xF3, 0xD0, 0x60, 0xF2, 0x24,
+0xF1, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xD1, 0x60, 0xF0, 0xD1, 0xE0, 0x07, 0x90, 0x0B, 0x90,
+0xC0, 0x40, 0x10, 0x60, 0xD2, 0xF0, 0x21, 0xF0, 0xA0, 0x40, 0x10, 0x50, 0xC1, 0x40, 0x30, 0x01,
+0x50, 0x40, 0x00, 0x50, 0xC0, 0xE0, 0x60, 0xD0, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x23, 0xF0,
+0x20, 0xF0, 0x23, 0xF1, 0xD1, 0x60, 0xF2, 0x20, 0xF3, 0x24, 0xF1, 0x22, 0xF2, 0xD0, 0xB1, 0xF3,
+0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x30, 0x90, 0x00, 0x70, 0x90, 0xA0, 0xC0, 0x0F, 0x21, 0x0F, 0x22,
+0x30, 0xC0, 0x01, 0x30, 0xE0, 0xD1, 0x24, 0xF0, 0x22, 0xF1, 0xD0, 0xB0, 0x60, 0xF3, 0x21, 0xF0,
+0x23, 0xF5, 0x21, 0xF2, 0x60, 0xF0, 0x30, 0xD0, 0xE0, 0x11, 0x70, 0xE0, 0x10, 0x91, 0x30, 0x05,
+0xC0, 0x90, 0x09, 0xC0, 0x40, 0x02, 0x51, 0x0A, 0x50, 0x80, 0x51, 0x0B, 0x80, 0x30, 0xA0, 0x30,
+0x40, 0x50, 0x05, 0x90, 0xC0, 0x09, 0x40, 0x04, 0xE0, 0x10, 0x50, 0x01, 0x40, 0x01, 0x90, 0xE0,
+0x10, 0x04, 0x40, 0x02, 0x40, 0x10, 0x03, 0xC0, 0x50, 0x00, 0x30, 0xB0, 0xD0, 0x20, 0xF0, 0x21,
+0xF0, 0x60, 0xF2, 0x21, 0xF3, 0xD0, 0x60, 0xF2, 0x23, 0xF0, 0x20, 0xD0, 0x60, 0xF2, 0x24, 0xF2,
+0x60, 0xD0, 0xF0, 0xD0, 0x60, 0xA0, 0x05, 0x40, 0xC0, 0x0A, 0xC0, 0x90, 0x00, 0xC0, 0x70, 0x10,
+0x30, 0x70, 0x60, 0xD2, 0xB0, 0x70, 0x00, 0xE0, 0x50, 0x02, 0x80, 0xA0, 0x04, 0x90, 0x11, 0xB0,
+0xD0, 0xB1, 0xF2, 0x21, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xF1, 0xD0,
+0x21, 0xF5, 0x22, 0xF0, 0x23, 0xF2, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x22, 0xF0, 0xD0, 0x71, 0x02, 0x70, 0x0F, 0x21, 0x0F, 0x21, 0x80, 0x70, 0x02, 0x30, 0x60,
+0xD0, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF3, 0xB0, 0x60, 0xB0, 0xD0, 0xF3, 0x23, 0xF5, 0x21, 0xF0,
+0x20, 0xD0, 0xF0, 0x60, 0xD0, 0x60, 0x10, 0x70, 0x40, 0x10, 0x40, 0xE0, 0xA0, 0x00, 0x30, 0x50,
+0x05, 0x90, 0x50, 0x07, 0x91, 0x04, 0x40, 0xC0, 0x09, 0x80, 0x50, 0x00, 0x40, 0x0B, 0x90, 0x01,
+0xC0, 0x90, 0x80, 0xA0, 0x80, 0xE0, 0x90, 0xC0, 0x01, 0x50, 0x09, 0x90, 0xC0, 0x03, 0xA0, 0x11,
+0x01, 0x90, 0x01, 0x40, 0x10, 0x30, 0x04, 0x40, 0x03, 0x90, 0x03, 0xC0, 0x50, 0x00, 0xA0, 0xD0,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x60, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0x60, 0xF1, 0x21, 0xF1, 0x20,
+0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF2, 0x23, 0xF1, 0xB1, 0xF0, 0xD0, 0xF0, 0xD0, 0xE0, 0x30, 0x04,
+0x40, 0x0B, 0x40, 0x01, 0x30, 0x10, 0x30, 0xC0, 0x00, 0x70, 0xA0, 0xB0, 0xD0, 0x70, 0xC0, 0x00,
+0x40, 0x04, 0x50, 0x30, 0x10, 0x02, 0x80, 0x50, 0xE0, 0xA0, 0x80, 0xB0, 0xF2, 0x21, 0xF0, 0x21,
+0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x60, 0xF0, 0xD0, 0xF1, 0x22, 0xF4, 0x25, 0xF3, 0x60, 0xB0, 0xF2,
+0x20, 0xF0, 0x21, 0xF1, 0x24, 0xD0, 0xB0, 0x70, 0x02, 0xA0, 0x30, 0x0F, 0x20, 0x0F, 0x20, 0x50,
+0x30, 0x50, 0xA0, 0x50, 0x81, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x26, 0xF0, 0xD0, 0xF0, 0x60,
+0xB0, 0xD0, 0xF0, 0x25, 0xF4, 0x23, 0xF0, 0xD0, 0xF1, 0x60, 0x30, 0x10, 0x40, 0x00, 0xE2, 0xA0,
+0x90, 0x00, 0xA0, 0x06, 0x40, 0xC0, 0x05, 0x40, 0x50, 0x06, 0x40, 0x09, 0xA0, 0x01, 0x51, 0x0B,
+0x40, 0x04, 0xC0, 0x90, 0x40, 0x30, 0xA0, 0x81, 0xC0, 0x08, 0x51, 0x03, 0x50, 0x10, 0x70, 0x01,
+0xC0, 0x80, 0xC0, 0xE0, 0x40, 0x03, 0xC0, 0xE0, 0x30, 0x08, 0xC1, 0x40, 0x80, 0xD0, 0x23, 0xF1,
+0x60, 0xD0, 0xF1, 0x23, 0xF1, 0xB1, 0xF0, 0x22, 0xF4, 0xB1, 0xD0, 0xF3, 0x22, 0xF0, 0xD0, 0x60,
+0xF1, 0x20, 0xF0, 0xD0, 0x60, 0x80, 0x03, 0x90, 0xC0, 0x0A, 0x50, 0x90, 0x01, 0xE0, 0x10, 0x02,
+0x50, 0x10, 0xE0, 0x70, 0x90, 0x00, 0x90, 0xC0, 0x05, 0xC0, 0x80, 0x50, 0x03, 0xC1, 0xA0, 0x60,
+0xD1, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x60, 0xF3, 0x22, 0xF0, 0x20,
+0xF3, 0x25, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xD0, 0x60, 0x30, 0xC0, 0xA0, 0x50, 0x80, 0x90, 0x0F, 0x1F, 0x0F, 0x20, 0x70, 0x02,
+0xA0, 0x70, 0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x60,
+0xB0, 0xF3, 0x21, 0xF4, 0x25, 0xF1, 0xD0, 0x70, 0xA0, 0xE0, 0x30, 0x00, 0xE0, 0x70, 0xA0, 0x80,
+0x30, 0x41, 0x90, 0x06, 0x40, 0x03, 0xC0, 0x40, 0x08, 0x50, 0x90, 0x07, 0x50, 0x80, 0x02, 0x40,
+0x0B, 0x90, 0xC0, 0x08, 0xC0, 0x40, 0xE0, 0x30, 0xA1, 0x80, 0x50, 0x04, 0x40, 0x03, 0xC0, 0x10,
+0xC0, 0x02, 0x10, 0x50, 0x04, 0x80, 0x10, 0x30, 0x50, 0x08, 0xC1, 0xA0, 0xF0, 0xD0, 0x21, 0xF2,
+0x20, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xB1, 0xF0, 0x21, 0xF4, 0xD0, 0x60, 0x20, 0xF1,
+0x20, 0xF4, 0xD0, 0x61, 0xF1, 0x20, 0xD1, 0x70, 0xE0, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x90, 0x03,
+0x70, 0xE0, 0x10, 0x00, 0x50, 0x90, 0x08, 0xA0, 0xC0, 0x03, 0x40, 0x10, 0x70, 0x30, 0xD0, 0xF1,
+0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF2, 0xD0, 0x60, 0xF3, 0x22, 0xF0, 0x21, 0xF4, 0x22, 0xF1,
+0xD0, 0xB0, 0x60, 0xF1, 0x21, 0xF2, 0x21, 0xF3, 0x23, 0xF1, 0xD0, 0xA0, 0x70, 0x02, 0xA0, 0x0F,
+0x1F, 0x0F, 0x1F, 0x30, 0xA0, 0x02, 0x70, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x20,
+0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x61, 0xD0, 0xF6, 0x24, 0xF0, 0x21, 0xF1, 0xD0, 0x30, 0x10,
+0x30, 0x40, 0x11, 0xA0, 0x10, 0x30, 0x10, 0x00, 0xC0, 0xA0, 0x07, 0x40, 0x01, 0x50, 0x40, 0x0A,
+0x90, 0xC0, 0x06, 0x30, 0xC0, 0x02, 0xC0, 0x90, 0x0A, 0xC0, 0x90, 0x09, 0xC0, 0x80, 0x02, 0x50,
+0x40, 0x30, 0xA0, 0x30, 0x82, 0x50, 0xC0, 0x06, 0x70, 0x40, 0x70, 0x04, 0x30, 0x10, 0x90, 0x50,
+0xC0, 0x07, 0xC0, 0x30, 0xA0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x23,
+0xF0, 0x60, 0xF1, 0x21, 0xF4, 0xD0, 0x60, 0xD0, 0x20, 0xF0, 0x20, 0xF4, 0xD0, 0xA0, 0xB0, 0x21,
+0xF1, 0xD0, 0x70, 0xC0, 0x02, 0x90, 0xC0, 0x0A, 0x51, 0x08, 0x10, 0x40, 0x80, 0x00, 0x40, 0x09,
+0x30, 0x91, 0x00, 0x50, 0xE0, 0xA0, 0x10, 0xA1, 0xD1, 0x20, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0xD0,
+0xF0, 0x60, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x23, 0xF4, 0x20, 0xD0, 0xB0, 0x60, 0xD0, 0xF2,
+0x23, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x21, 0xD0, 0xF0, 0xD0, 0xA0, 0xC0, 0x01, 0x30, 0x70, 0x0F,
+0x1E, 0x0F, 0x1E, 0x90, 0x80, 0x00, 0xA0, 0x90, 0x30, 0x60, 0xD0, 0xF0, 0x23, 0xF1, 0x24, 0xF0,
+0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xF0, 0xD0, 0xF3, 0x26, 0xF2, 0x20, 0xD1, 0x11,
+0x80, 0xE0, 0x80, 0x70, 0x80, 0xC0, 0x10, 0x01, 0x30, 0x50, 0x07, 0x40, 0x90, 0x50, 0x0C, 0x40,
+0x06, 0xA0, 0x04, 0x90, 0xC0, 0x0A, 0x90, 0x09, 0x90, 0xA0, 0x30, 0x90, 0x05, 0xC1, 0x40, 0x80,
+0x30, 0xA1, 0x30, 0x80, 0x41, 0x51, 0x30, 0xA0, 0x04, 0x70, 0x10, 0xC0, 0x50, 0xC0, 0x07, 0xC0,
+0x81, 0xD1, 0xF2, 0x20, 0xF0, 0x20, 0xB0, 0xD0, 0xF1, 0x23, 0xF1, 0x60, 0xF1, 0x21, 0xF0, 0x20,
+0xF0, 0x20, 0xF1, 0x60, 0xD0, 0x23, 0xF2, 0xD0, 0xB0, 0x60, 0xD0, 0xF3, 0xD0, 0x10, 0xC0, 0x02,
+0x40, 0x0B, 0x40, 0x08, 0x10, 0x40, 0x01, 0x40, 0x0A, 0x30, 0xC1, 0x91, 0x50, 0x70, 0x11, 0x30,
+0xD0, 0xF0, 0xD1, 0xF0, 0x24, 0xD0, 0xF1, 0x60, 0xF3, 0x20, 0xF0, 0x21, 0xF1, 0x25, 0xF2, 0xD1,
+0x60, 0xB0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x23, 0xF6, 0xD0, 0xB0, 0xA0, 0x50, 0xA0,
+0x50, 0x41, 0x0F, 0x1D, 0x0F, 0x1E, 0xA0, 0x02, 0xA1, 0xD1, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x22,
+0xF2, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xF5, 0x23, 0xF1, 0x20, 0xF1, 0x20,
+0xD0, 0xB0, 0x11, 0x80, 0x40, 0x70, 0x11, 0xA1, 0x00, 0x30, 0x70, 0x08, 0x41, 0x0D, 0xC0, 0x90,
+0x04, 0x90, 0x40, 0x05, 0x40, 0x0B, 0x90, 0x08, 0xA1, 0x40, 0xE0, 0x40, 0x50, 0x05, 0xC0, 0x50,
+0x02, 0xC0, 0x50, 0x90, 0x41, 0x80, 0x30, 0xE0, 0x30, 0xA1, 0x31, 0x10, 0x70, 0x42, 0x51, 0xC6,
+0x30, 0x60, 0xD0, 0xF2, 0x21, 0xF1, 0xB0, 0xD0, 0xF1, 0x23, 0xF1, 0x60, 0xF1, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0xB1, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xF3, 0xD0, 0x40, 0x80,
+0x02, 0x50, 0xC0, 0x0A, 0x90, 0xC0, 0x07, 0xA0, 0x40, 0x01, 0x51, 0x0A, 0x30, 0x01, 0x90, 0x80,
+0x01, 0x90, 0x10, 0xE1, 0x70, 0xB0, 0xD0, 0xF2, 0x21, 0xF2, 0x60, 0xF2, 0x22, 0xF0, 0x20, 0xF1,
+0x20, 0xF0, 0x24, 0xF3, 0x60, 0xB0, 0xF1, 0x21, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x21,
+0xF0, 0x21, 0xF2, 0xD0, 0x30, 0x70, 0x02, 0xA0, 0x0F, 0x1D, 0x0F, 0x14, 0x50, 0x31, 0x05, 0x30,
+0x70, 0x02, 0xA0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF4, 0x24, 0xF2,
+0xD0, 0xF0, 0x60, 0xB0, 0xF4, 0x22, 0xF2, 0x22, 0xD0, 0xF0, 0x11, 0x40, 0x30, 0x80, 0x12, 0x01,
+0xE0, 0xC0, 0x07, 0x40, 0x00, 0x51, 0x0D, 0x90, 0xC0, 0x03, 0xA0, 0x06, 0x51, 0x0A, 0x40, 0x06,
+0x90, 0xA0, 0xE0, 0x50, 0x40, 0x50, 0x30, 0x80, 0xA0, 0x70, 0xC0, 0x03, 0x90, 0x08, 0x51, 0x02,
+0xC0, 0xE0, 0x10, 0x40, 0x90, 0x40, 0x84, 0x32, 0x81, 0xA0, 0xB0, 0xD0, 0xF2, 0x20, 0xF1, 0xB1,
+0xD0, 0xF5, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x60, 0xF1, 0x20, 0xF1, 0x22,
+0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF0, 0xD0, 0xE0, 0xC0, 0x02, 0x40, 0x0A, 0xC0, 0x90, 0x08, 0x50,
+0x01, 0xC0, 0x40, 0x0B, 0x40, 0x80, 0xC0, 0x90, 0x00, 0x40, 0xC0, 0x00, 0x50, 0x00, 0x70, 0xE0,
+0x11, 0xB0, 0xD1, 0xF0, 0xD2, 0x60, 0xF0, 0xD1, 0xF1, 0x21, 0xF5, 0x20, 0xF2, 0x20, 0xF2, 0x60,
+0xF2, 0x22, 0xF2, 0x21, 0xF4, 0x26, 0xF0, 0xD0, 0xF0, 0x60, 0xF0, 0x70, 0xC0, 0x01, 0xA0, 0x70,
+0x0F, 0x1C, 0x0F, 0x14, 0x80, 0x90, 0x80, 0xC0, 0x03, 0x90, 0x80, 0x00, 0xA0, 0x40, 0xA0, 0xB0,
+0xD1, 0x61, 0xF2, 0x23, 0xF5, 0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0,
+0xF3, 0x20, 0xF5, 0x20, 0xF0, 0xD0, 0xE0, 0x60, 0x70, 0x32, 0xE0, 0x10, 0x70, 0x50, 0x11, 0x05,
+0xC0, 0x40, 0x02, 0x90, 0x50, 0x02, 0xA0, 0x09, 0x40, 0x02, 0xC0, 0x30, 0x07, 0x40, 0x0A, 0xC0,
+0x90, 0x50, 0x10, 0x30, 0x01, 0x40, 0xA0, 0x40, 0xE0, 0xA0, 0x32, 0xA1, 0x30, 0x70, 0x10, 0xA0,
+0x40, 0x00, 0x90, 0x08, 0x40, 0x50, 0x02, 0xC0, 0xE0, 0xA1, 0x01, 0x50, 0x08, 0x30, 0xB0, 0xF2,
+0x20, 0xF0, 0x20, 0xF0, 0xB1, 0xF7, 0x20, 0xB0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x60, 0xF4,
+0x22, 0xF1, 0x60, 0xF5, 0xA0, 0x02, 0x51, 0x0A, 0x40, 0x0C, 0x40, 0x0D, 0x70, 0x40, 0x02, 0x40,
+0xC0, 0x03, 0x80, 0xA0, 0xE0, 0x61, 0xB0, 0x31, 0x60, 0xD0, 0x30, 0x70, 0x61, 0xD0, 0xF1, 0x20,
+0xF3, 0x22, 0xD1, 0xF1, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x26, 0xF2, 0x20, 0xF2, 0x22,
+0xF0, 0xD0, 0x61, 0xD0, 0xF0, 0xD0, 0x70, 0x90, 0x70, 0xC0, 0x40, 0x80, 0x0F, 0x1B, 0x0F, 0x15,
+0x80, 0x90, 0x04, 0xA0, 0x02, 0x31, 0xD0, 0xF1, 0xD0, 0xB0, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF2,
+0x25, 0xF0, 0x20, 0xF2, 0x20, 0xF2, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0xF0, 0x20,
+0xF0, 0xD0, 0x20, 0xF0, 0xD0, 0xB0, 0xA0, 0xD0, 0x30, 0x70, 0x30, 0xA0, 0xC0, 0x11, 0x30, 0x04,
+0xC0, 0x40, 0x04, 0x40, 0x02, 0x70, 0xC0, 0x08, 0xC0, 0x40, 0x01, 0x40, 0x90, 0x07, 0x51, 0x0A,
+0x90, 0x80, 0xA0, 0x70, 0x00, 0xE0, 0xA0, 0x30, 0x70, 0x40, 0x00, 0xC0, 0x40, 0x04, 0xC0, 0x90,
+0x40, 0xC0, 0x30, 0x10, 0x50, 0x06, 0x80, 0x90, 0x05, 0xC0, 0x00, 0xC0, 0x90, 0x07, 0xC0, 0x30,
+0xB0, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xB1, 0xF5, 0xD1, 0xB0, 0xF4, 0x21, 0xF2, 0xB0, 0xD0, 0xF3,
+0x21, 0xF1, 0xB1, 0xD0, 0xF4, 0x10, 0x50, 0x01, 0x40, 0x0A, 0x51, 0x0B, 0x90, 0xC0, 0x0D, 0x80,
+0xE0, 0xC0, 0x50, 0x01, 0x90, 0x50, 0x04, 0x71, 0x12, 0x30, 0x70, 0x30, 0x70, 0xA0, 0x40, 0xE0,
+0xB0, 0xD0, 0xF1, 0x25, 0xF1, 0xD1, 0xB0, 0x60, 0xF7, 0x26, 0xF2, 0x20, 0xF0, 0x21, 0xF2, 0x60,
+0xB0, 0xD0, 0xF0, 0xD1, 0x60, 0x70, 0x02, 0x30, 0x50, 0x0F, 0x1A, 0x0F, 0x13, 0xC0, 0x90, 0x05,
+0x30, 0x70, 0xC0, 0x01, 0x70, 0xD1, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF0, 0x27,
+0xF3, 0x20, 0xF4, 0xD0, 0xB0, 0x60, 0xF2, 0x21, 0xF1, 0xD0, 0xF0, 0xD0, 0x61, 0xD5, 0xB0, 0x10,
+0x80, 0x11, 0x50, 0x04, 0xC0, 0x40, 0x06, 0x40, 0x01, 0x70, 0x50, 0x09, 0x51, 0x00, 0xA0, 0x09,
+0x40, 0xC0, 0x09, 0x50, 0x90, 0xA1, 0x00, 0xE2, 0x40, 0x50, 0x01, 0x40, 0x07, 0xE0, 0x30, 0x80,
+0x07, 0x30, 0x40, 0x08, 0x90, 0x07, 0xC0, 0x30, 0x60, 0xD0, 0x23, 0xF0, 0xD0, 0xB1, 0xF6, 0xD0,
+0x60, 0xF3, 0x20, 0xF3, 0xB1, 0xF0, 0x20, 0xF2, 0x21, 0xF0, 0xD0, 0x60, 0xF5, 0xD0, 0x60, 0xA0,
+0x80, 0x51, 0x0A, 0x40, 0x0B, 0xC0, 0x90, 0x0D, 0x40, 0x00, 0x80, 0x70, 0x80, 0x02, 0x90, 0x50,
+0x03, 0x70, 0x10, 0x30, 0x80, 0x30, 0x00, 0x90, 0x50, 0x01, 0x90, 0x70, 0xB0, 0xD0, 0xF2, 0x25,
+0xF0, 0xD0, 0x61, 0xD0, 0xF0, 0x21, 0xF3, 0x2A, 0xF3, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF3, 0xD0,
+0xA0, 0x50, 0x01, 0xA0, 0x70, 0x0F, 0x1A, 0x0F, 0x12, 0x40, 0xE0, 0xA0, 0x10, 0x30, 0x02, 0x90,
+0x80, 0x00, 0xA0, 0x40, 0xA0, 0xB0, 0xD0, 0x21, 0xF2, 0xD1, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x24,
+0xF3, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0xB0, 0x60, 0xD0, 0xF1, 0x20, 0xF2, 0xD0, 0xB0, 0x70,
+0x30, 0x70, 0xD2, 0xF0, 0xD0, 0x70, 0xA0, 0x10, 0x31, 0x04, 0x50, 0x40, 0x07, 0xC0, 0x40, 0x00,
+0xA1, 0x0A, 0x40, 0x50, 0x80, 0x09, 0xC0, 0x90, 0x0A, 0x40, 0x80, 0x40, 0x03, 0x30, 0xC0, 0x01,
+0x90, 0xC0, 0x08, 0x90, 0x07, 0x30, 0x90, 0x08, 0x90, 0x07, 0xC0, 0x30, 0xB0, 0xD0, 0xF1, 0x20,
+0xF1, 0xD0, 0xB0, 0x20, 0xF1, 0x22, 0xF1, 0xD0, 0x60, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0x60,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x60, 0xD0, 0xF1, 0xD0, 0xF0, 0x20, 0xF0, 0xD1, 0x80, 0xA1,
+0x09, 0x51, 0x0B, 0x40, 0x0D, 0x90, 0xC0, 0x01, 0xC0, 0x70, 0x50, 0x02, 0x91, 0x02, 0x51, 0x00,
+0xA0, 0x50, 0x03, 0x50, 0xE0, 0xA2, 0xD1, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0,
+0x23, 0xF3, 0x2A, 0xF0, 0x20, 0xD1, 0x60, 0xB0, 0xF3, 0x21, 0xF2, 0x70, 0x90, 0x70, 0xC0, 0x40,
+0x80, 0x0F, 0x19, 0x0F, 0x12, 0xA0, 0xC0, 0x01, 0x30, 0x10, 0x01, 0xA0, 0x02, 0x31, 0xD0, 0xF7,
+0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0x25, 0xF3, 0x23, 0xF0, 0x24, 0xF2, 0x60, 0x20, 0xF1, 0x20, 0xF0,
+0xD1, 0x30, 0xC0, 0x40, 0x80, 0xE0, 0x30, 0xB0, 0xD0, 0xF0, 0x80, 0xA0, 0x10, 0x80, 0x90, 0x03,
+0x91, 0x09, 0xC0, 0x40, 0x10, 0x70, 0x0B, 0x30, 0x50, 0x0A, 0x90, 0xC0, 0x09, 0x50, 0xC0, 0x04,
+0xA0, 0x02, 0xC0, 0x90, 0x08, 0x40, 0x02, 0xC0, 0x03, 0x30, 0x90, 0xC0, 0x07, 0x40, 0x07, 0xC0,
+0xA0, 0x90, 0xD2, 0xF1, 0xD1, 0x60, 0xF1, 0x24, 0xF1, 0x60, 0xF0, 0x22, 0xF0, 0x21, 0xF1, 0x60,
+0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xB1, 0xF1, 0x20, 0xF2, 0x21, 0xD0, 0xF0, 0xB1, 0x70, 0xC0, 0x06,
+0x91, 0x0B, 0x40, 0xC0, 0x0C, 0x51, 0x04, 0x30, 0x70, 0x02, 0x50, 0x40, 0x03, 0x40, 0x05, 0x11,
+0x70, 0x00, 0x90, 0x70, 0xA0, 0x71, 0xE0, 0x60, 0xD0, 0xF1, 0x60, 0xB0, 0xD0, 0xF0, 0x26, 0xF1,
+0x22, 0xF1, 0x25, 0xD0, 0xB0, 0x60, 0xF0, 0xD1, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0x70,
+0x02, 0xA0, 0x05, 0x50, 0xC0, 0x0F, 0x11, 0x0F, 0x12, 0x80, 0x30, 0x02, 0x40, 0x30, 0x80, 0x70,
+0x50, 0x00, 0xC0, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0xB1, 0xF0, 0x24, 0xF2,
+0x20, 0xF0, 0x23, 0xF2, 0x22, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0xD0, 0x30, 0x40, 0x80,
+0xE0, 0x30, 0xE0, 0xB0, 0xD0, 0x61, 0x11, 0xC0, 0x00, 0x40, 0x01, 0x90, 0x50, 0x0B, 0x50, 0x80,
+0x10, 0xE0, 0x81, 0x40, 0xC0, 0x06, 0x70, 0x50, 0x0B, 0x40, 0x0A, 0x40, 0x03, 0xC0, 0x30, 0x03,
+0x40, 0x08, 0x50, 0xC0, 0x00, 0xC0, 0xE0, 0x00, 0xC0, 0x01, 0xA0, 0xC1, 0x07, 0x40, 0x07, 0xC0,
+0x80, 0x70, 0x62, 0xB0, 0xD0, 0x20, 0xD0, 0x60, 0xF0, 0x25, 0xF1, 0x60, 0xF0, 0x21, 0xF1, 0x21,
+0xF0, 0xB1, 0xF0, 0x24, 0xF2, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x60,
+0xF0, 0xD0, 0xB0, 0x70, 0x05, 0xA0, 0x70, 0xC0, 0x0A, 0x51, 0x00, 0x50, 0x10, 0x09, 0x50, 0x90,
+0x06, 0x30, 0xC0, 0x02, 0xC0, 0x90, 0x01, 0x40, 0xC0, 0x04, 0xE0, 0x10, 0x80, 0x02, 0x10, 0x30,
+0x02, 0x80, 0x30, 0xF0, 0x60, 0xF0, 0xD1, 0xF2, 0x20, 0xF1, 0x24, 0xF3, 0x23, 0xF1, 0xB1, 0xD0,
+0xF1, 0x21, 0xF1, 0x24, 0xD0, 0xA0, 0x50, 0x00, 0xC0, 0xA0, 0x30, 0x02, 0x40, 0x70, 0xA0, 0x70,
+0x40, 0x0F, 0x10, 0x0F, 0x11, 0x90, 0xC0, 0xA0, 0x70, 0xC0, 0x00, 0x50, 0x70, 0x30, 0x00, 0x81,
+0x30, 0xB0, 0xD0, 0x22, 0xF1, 0x24, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xF4, 0x24, 0xF1, 0x21, 0xF0,
+0x21, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF1, 0xD0, 0x70, 0x80, 0xE0, 0x30, 0xA0,
+0xF0, 0xD1, 0x80, 0xA0, 0xE0, 0x30, 0x02, 0x40, 0x51, 0x0D, 0x90, 0x10, 0xC0, 0x80, 0x40, 0x30,
+0x70, 0x05, 0x50, 0x80, 0x90, 0xC0, 0x0A, 0x51, 0x09, 0x51, 0x02, 0x40, 0x90, 0x03, 0x50, 0xC0,
+0x08, 0x40, 0x01, 0x40, 0xA1, 0x01, 0xA0, 0xC0, 0x50, 0x07, 0x40, 0x07, 0xC0, 0x50, 0x40, 0x10,
+0x40, 0x30, 0x70, 0xD2, 0x60, 0xF0, 0x25, 0xF0, 0xB0, 0x60, 0xF0, 0x21, 0xF4, 0xB1, 0xF0, 0x23,
+0xF3, 0x60, 0xF0, 0x21, 0xF5, 0xB0, 0x60, 0xD2, 0x60, 0x30, 0x03, 0x90, 0x10, 0x80, 0x0B, 0x40,
+0x02, 0xE0, 0x80, 0x07, 0xC0, 0x40, 0x06, 0x50, 0x30, 0x04, 0x50, 0x91, 0xC0, 0x04, 0x11, 0xA0,
+0x02, 0xC0, 0xE0, 0x80, 0x02, 0xC0, 0x70, 0xB0, 0xD0, 0xF3, 0x20, 0xF2, 0x24, 0xF3, 0x20, 0xF3,
+0x20, 0x60, 0xB0, 0xD0, 0xF2, 0x22, 0xF2, 0x21, 0xF1, 0xD0, 0xA0, 0x40, 0x30, 0xC0, 0x80, 0x50,
+0x00, 0x30, 0x10, 0x70, 0x50, 0x00, 0xE0, 0x0F, 0x10, 0x0F, 0x10, 0x70, 0xA0, 0xE1, 0x80, 0xE2,
+0x70, 0x02, 0x80, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x26, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF1,
+0x24, 0xF3, 0x22, 0xF1, 0x22, 0xF2, 0xB0, 0x60, 0xD0, 0xF0, 0xD0, 0x30, 0xE0, 0x00, 0xA0, 0xD1,
+0xF0, 0xD0, 0x13, 0xA0, 0x01, 0x50, 0x80, 0x0F, 0x00, 0x80, 0xC0, 0x09, 0x30, 0xC0, 0x00, 0x40,
+0x0B, 0x40, 0x0A, 0x40, 0x02, 0x30, 0x04, 0xC0, 0x90, 0x08, 0x40, 0x01, 0xA0, 0x00, 0xA0, 0x00,
+0xC0, 0x80, 0x00, 0x90, 0x07, 0x40, 0x07, 0xC2, 0x10, 0x01, 0x30, 0xB0, 0xD0, 0xF0, 0x60, 0xD0,
+0xF1, 0x20, 0xF0, 0x21, 0xF0, 0xB1, 0xF4, 0x20, 0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF0,
+0xD0, 0xB1, 0xF0, 0x20, 0xF2, 0xD1, 0xF0, 0xD0, 0x60, 0xF3, 0xD0, 0xA0, 0x50, 0x01, 0x80, 0x10,
+0x80, 0x90, 0x0A, 0x40, 0xC0, 0x03, 0x10, 0x50, 0x06, 0x40, 0x08, 0xA0, 0xC0, 0x04, 0x80, 0x40,
+0x05, 0x70, 0xA0, 0x40, 0x08, 0x40, 0x30, 0x80, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x25, 0xF2,
+0x22, 0xF1, 0xD0, 0xB0, 0x60, 0x20, 0xD0, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x31, 0x02,
+0xA0, 0x40, 0xA0, 0x01, 0x70, 0x50, 0xE0, 0x0F, 0x10, 0x0F, 0x0F, 0x50, 0xA0, 0x01, 0xC0, 0xE0,
+0x40, 0x00, 0x50, 0xE0, 0x50, 0x01, 0x70, 0xD0, 0x22, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0xD0, 0xF0,
+0xB0, 0x60, 0xF0, 0xD0, 0x21, 0xF0, 0x25, 0xF1, 0x20, 0xF1, 0x23, 0xF1, 0xD0, 0xB0, 0x60, 0xF0,
+0xD0, 0x70, 0x32, 0xD0, 0xF0, 0xD1, 0x80, 0x10, 0x70, 0x80, 0x01, 0x51, 0x00, 0x40, 0x0E, 0x40,
+0x30, 0x09, 0xA0, 0x01, 0xC0, 0x40, 0x0A, 0xC0, 0x90, 0x09, 0x90, 0xC0, 0x01, 0xA0, 0x05, 0x40,
+0x08, 0x90, 0x00, 0x40, 0x30, 0x70, 0xC0, 0x00, 0x50, 0x70, 0x00, 0x40, 0x07, 0x90, 0xC0, 0x06,
+0xC0, 0x51, 0xA0, 0x01, 0x90, 0x30, 0xD0, 0xB0, 0x60, 0xF1, 0x23, 0xF1, 0x60, 0xF1, 0x20, 0xF1,
+0x20, 0xF1, 0xD0, 0x60, 0xF0, 0x24, 0xF2, 0x60, 0xD0, 0x21, 0xF2, 0xB0, 0xE0, 0xD0, 0xF0, 0x60,
+0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x01, 0x80, 0x90, 0xC0, 0x0A, 0x90, 0x50, 0x0C, 0x40,
+0x09, 0x91, 0x03, 0x40, 0x00, 0xC0, 0x40, 0x03, 0x70, 0x30, 0xA0, 0x50, 0x07, 0x40, 0xC0, 0x30,
+0x10, 0x90, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x60, 0xB0,
+0xD1, 0xF0, 0x20, 0xF1, 0x25, 0xF4, 0xD1, 0x70, 0x01, 0xC0, 0x71, 0x40, 0x00, 0xC0, 0xE0, 0x0F,
+0x12, 0x0F, 0x10, 0x10, 0x50, 0x02, 0x70, 0x50, 0xA0, 0x00, 0x82, 0x60, 0xD0, 0x23, 0xF1, 0x25,
+0xF2, 0x20, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF2, 0x21, 0xF1, 0x25, 0xF3, 0x60,
+0xF0, 0xA1, 0x70, 0x30, 0xD0, 0xF0, 0xD0, 0x60, 0x10, 0x70, 0xA0, 0x01, 0x90, 0x80, 0x02, 0x40,
+0xC0, 0x0C, 0x80, 0x70, 0x90, 0x07, 0x50, 0x80, 0x02, 0x90, 0xC0, 0x0A, 0x90, 0xC0, 0x09, 0x40,
+0x01, 0x30, 0x05, 0xC0, 0x50, 0x00, 0x50, 0x30, 0x90, 0x03, 0x50, 0xC0, 0xA1, 0x80, 0x01, 0x70,
+0x10, 0xC0, 0x90, 0x07, 0x50, 0xC0, 0x06, 0xC0, 0x50, 0x04, 0xA0, 0xD0, 0xF0, 0xB0, 0xF0, 0x20,
+0xF1, 0x22, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xB1, 0xD0, 0x24, 0xF1, 0xB1, 0xD0,
+0x21, 0xF1, 0x20, 0xF0, 0xB0, 0xD0, 0x60, 0xF2, 0x21, 0xF0, 0xD0, 0x70, 0x02, 0x40, 0x0A, 0xC0,
+0x40, 0x0C, 0x90, 0xC0, 0x30, 0x50, 0x04, 0xC0, 0x30, 0x40, 0x30, 0x90, 0x02, 0x40, 0xC0, 0x01,
+0x50, 0x90, 0x00, 0x50, 0x90, 0x30, 0x81, 0x07, 0x40, 0xC0, 0x00, 0xA0, 0x11, 0xB0, 0xD0, 0xF3,
+0x21, 0xF2, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0x24, 0xF3,
+0x20, 0xF1, 0xD0, 0x60, 0x30, 0x80, 0x30, 0x00, 0x30, 0xE0, 0xA0, 0xE0, 0x90, 0x00, 0x80, 0xA0,
+0x40, 0x0F, 0x0E, 0x0F, 0x10, 0x50, 0x10, 0x80, 0x01, 0xA0, 0x30, 0x50, 0x01, 0x90, 0xE0, 0xD0,
+0xF0, 0x23, 0xF2, 0x24, 0xF3, 0x22, 0xD0, 0xF0, 0xB0, 0x60, 0xF2, 0x24, 0xF2, 0x24, 0xF0, 0x21,
+0xF1, 0xD0, 0xF0, 0xB0, 0xA0, 0x80, 0x10, 0x30, 0xD0, 0xF0, 0xD0, 0x60, 0xA0, 0x71, 0xC0, 0x80,
+0xE1, 0x03, 0x40, 0x05, 0x40, 0x90, 0x04, 0x50, 0xC1, 0x90, 0x06, 0xA0, 0x04, 0x40, 0x0A, 0xC0,
+0x90, 0x09, 0x90, 0x00, 0xC0, 0x80, 0x06, 0x90, 0x40, 0xA0, 0x80, 0x30, 0x04, 0x91, 0x70, 0x80,
+0x00, 0xA1, 0x10, 0x80, 0x50, 0xC0, 0x06, 0x51, 0x06, 0xC0, 0x50, 0x04, 0x30, 0xB2, 0xF1, 0x20,
+0xF0, 0x20, 0xF2, 0x60, 0xD0, 0xF0, 0x24, 0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0xD0, 0x60,
+0xF1, 0x20, 0xF2, 0x21, 0xD1, 0x60, 0xF0, 0x22, 0xF0, 0x20, 0xD0, 0x80, 0x90, 0x00, 0x50, 0xC0,
+0x0A, 0x40, 0x0C, 0x51, 0x00, 0xE0, 0x10, 0x30, 0x80, 0x00, 0xC0, 0x40, 0x30, 0xA0, 0xE0, 0xC0,
+0x02, 0x40, 0xC0, 0x03, 0x50, 0xA0, 0x11, 0x70, 0xA0, 0x06, 0xC0, 0x40, 0x02, 0x50, 0x40, 0xE0,
+0xA0, 0xD0, 0xB0, 0xF4, 0x21, 0xF1, 0x21, 0xF2, 0x60, 0xB0, 0xD1, 0xF0, 0x25, 0xF0, 0x22, 0xF3,
+0x21, 0xF1, 0xD1, 0xA0, 0x80, 0x01, 0xC0, 0xA0, 0x50, 0x00, 0x80, 0xE0, 0x80, 0x50, 0xA0, 0x50,
+0x0F, 0x0D, 0x0F, 0x0E, 0x30, 0x70, 0x01, 0x80, 0x11, 0x30, 0x10, 0xE0, 0xC0, 0x00, 0x30, 0xB0,
+0xD0, 0xF0, 0x23, 0xF3, 0x22, 0xF2, 0x23, 0xF2, 0xD0, 0xF0, 0x60, 0xF2, 0x21, 0xF0, 0x21, 0xF2,
+0x20, 0xF4, 0x22, 0xF2, 0x60, 0x10, 0xA0, 0xD0, 0xF2, 0xD0, 0x30, 0xE0, 0x30, 0xE0, 0x71, 0x05,
+0x40, 0x04, 0x90, 0x10, 0x40, 0x06, 0x51, 0x04, 0xC0, 0x30, 0x04, 0xC0, 0x40, 0x0A, 0x50, 0xC0,
+0x08, 0xC0, 0x91, 0x40, 0x06, 0x90, 0x11, 0x70, 0x40, 0x04, 0x40, 0x00, 0xC0, 0x00, 0xA0, 0x40,
+0x30, 0x70, 0x00, 0x51, 0x06, 0xC0, 0x50, 0x06, 0xC0, 0x50, 0x04, 0x90, 0x30, 0xB1, 0xD1, 0xF2,
+0x20, 0xF0, 0xB1, 0xF0, 0x24, 0xF1, 0x60, 0xF2, 0x23, 0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF1, 0x21,
+0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF1, 0xD1, 0x70, 0x00, 0x90, 0x01, 0xC0, 0xA0, 0x80, 0x05,
+0x90, 0x50, 0x0B, 0xC0, 0x50, 0x81, 0x90, 0x10, 0xE0, 0xC0, 0xA0, 0x30, 0x10, 0x00, 0x50, 0x10,
+0x80, 0x01, 0x80, 0x50, 0x05, 0x50, 0xC0, 0x00, 0x10, 0x90, 0x05, 0xC0, 0x40, 0x06, 0x70, 0x60,
+0x70, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0x60, 0xF0, 0xD0, 0xF2, 0x23, 0xF2,
+0x22, 0xF3, 0x21, 0xF4, 0x70, 0x00, 0xC0, 0x70, 0x10, 0xC0, 0x80, 0xA0, 0x02, 0x40, 0x80, 0x0F,
+0x0D, 0x0F, 0x0D, 0x30, 0x40, 0x90, 0x70, 0x30, 0x40, 0x01, 0x30, 0x80, 0x11, 0xE0, 0x80, 0xD0,
+0xF2, 0x22, 0xF3, 0x22, 0xF2, 0x25, 0xF2, 0xD0, 0x61, 0xF2, 0x20, 0xF3, 0x21, 0xF4, 0x23, 0xF0,
+0xD0, 0xB0, 0x70, 0xA0, 0xB0, 0xD0, 0xF0, 0xD1, 0x30, 0xE1, 0xA0, 0x11, 0x40, 0x00, 0xC0, 0x80,
+0x02, 0x40, 0x05, 0x10, 0x07, 0x40, 0xC0, 0x03, 0x90, 0x40, 0x05, 0x51, 0x0A, 0x40, 0x09, 0x50,
+0xA0, 0x07, 0xC0, 0x90, 0x07, 0x50, 0xC0, 0x00, 0x30, 0x80, 0xD0, 0x10, 0xC0, 0x00, 0xC0, 0x90,
+0x04, 0x50, 0x10, 0x30, 0x50, 0x06, 0xC0, 0x50, 0x05, 0x70, 0xB0, 0xF2, 0xD0, 0xF1, 0xD1, 0xB1,
+0xF1, 0x23, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x23, 0xD0, 0xB1, 0xF0, 0x22, 0xF1, 0x20, 0xD0, 0x70,
+0xA0, 0x60, 0xD1, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0x10, 0xA0, 0x02, 0x50, 0x71, 0x10, 0xC0, 0x02,
+0x50, 0x90, 0x0B, 0xC0, 0x40, 0x00, 0x50, 0x10, 0x30, 0x70, 0x10, 0x80, 0x01, 0xA0, 0xE0, 0x00,
+0x10, 0x70, 0xA0, 0x70, 0x10, 0x90, 0x06, 0x90, 0x50, 0xC0, 0x05, 0x50, 0x90, 0x07, 0xE0, 0xD2,
+0xF0, 0x23, 0xF0, 0x20, 0xF2, 0xB0, 0x60, 0xD0, 0xF0, 0x20, 0xD0, 0x25, 0xF2, 0x22, 0xF3, 0x21,
+0xF2, 0xD1, 0x60, 0xE0, 0x11, 0x80, 0xA0, 0x70, 0x02, 0x40, 0xE0, 0x0F, 0x0E, 0x0F, 0x0D, 0x70,
+0x50, 0x00, 0x10, 0x90, 0xA0, 0x80, 0x50, 0x80, 0x01, 0x30, 0x10, 0xB0, 0xF0, 0xD1, 0xF1, 0x21,
+0xF3, 0x20, 0xF1, 0x25, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0x26,
+0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xE0, 0xA0, 0x60, 0xF2, 0xD1, 0x80, 0xA0, 0xE0, 0xA0, 0x80,
+0x10, 0x90, 0x50, 0x71, 0xE0, 0x10, 0xA0, 0x90, 0x04, 0x90, 0xC0, 0x07, 0x40, 0xC0, 0x02, 0x30,
+0x07, 0x40, 0x0A, 0x51, 0x08, 0xC0, 0xA0, 0x01, 0xC0, 0xE0, 0x04, 0x40, 0x07, 0xC0, 0x50, 0x00,
+0x80, 0x30, 0xD0, 0x10, 0xC0, 0x01, 0x90, 0x02, 0xC1, 0x50, 0xA0, 0x30, 0x40, 0x81, 0x43, 0x90,
+0x41, 0x91, 0x41, 0x91, 0x81, 0xB3, 0xF1, 0xD1, 0xB0, 0xF0, 0xD1, 0xF1, 0x21, 0xF0, 0xB1, 0xF0,
+0x20, 0xF1, 0x21, 0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF2, 0xD0, 0xB1, 0x70, 0xA0, 0xF1, 0x20, 0xF2,
+0xD0, 0x30, 0xA0, 0x10, 0x02, 0x50, 0x40, 0xA0, 0x03, 0x40, 0x0C, 0x40, 0x02, 0x90, 0xA0, 0x50,
+0x11, 0x40, 0x01, 0x30, 0x11, 0xA0, 0x30, 0x70, 0x50, 0x08, 0x90, 0xC0, 0x04, 0x90, 0x50, 0x04,
+0x90, 0x01, 0x80, 0x40, 0x60, 0xE0, 0x60, 0xD0, 0x23, 0xF2, 0xB0, 0x60, 0xB0, 0xD0, 0xF2, 0x21,
+0xF2, 0x23, 0xF1, 0x22, 0xF2, 0x23, 0xF2, 0xB0, 0xE0, 0xA0, 0x01, 0x90, 0x10, 0x91, 0xE0, 0x70,
+0xC0, 0x40, 0x30, 0x40, 0x0F, 0x0B, 0x0F, 0x0D, 0x41, 0x00, 0x50, 0x00, 0xC0, 0xA1, 0x90, 0x01,
+0x40, 0x60, 0xF0, 0x60, 0xB0, 0xD1, 0xFB, 0x22, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x60,
+0xB0, 0xD0, 0xF0, 0x29, 0xF3, 0x20, 0xF0, 0xD0, 0x70, 0xE0, 0xD0, 0x60, 0xF2, 0xD0, 0x40, 0x11,
+0x70, 0x00, 0x90, 0x40, 0x00, 0x50, 0xE0, 0x10, 0x50, 0x70, 0xA0, 0x90, 0x0E, 0x40, 0x01, 0xC0,
+0x30, 0x08, 0x40, 0x0A, 0x40, 0x08, 0xC0, 0x80, 0x01, 0x50, 0x10, 0x80, 0x03, 0x90, 0xC0, 0x07,
+0x90, 0x01, 0xA0, 0x90, 0x10, 0x01, 0xC0, 0x40, 0x90, 0x40, 0x90, 0x50, 0xC0, 0xE0, 0x40, 0x80,
+0x00, 0x91, 0x04, 0xC1, 0x05, 0x41, 0x90, 0x80, 0x70, 0x80, 0x31, 0x60, 0xB0, 0x60, 0xB0, 0xF1,
+0xD1, 0xF1, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0x20, 0xF0, 0x21,
+0xF3, 0xB0, 0x80, 0x10, 0xA0, 0xE0, 0x30, 0xD0, 0x20, 0xF1, 0xD0, 0x30, 0x40, 0x50, 0x08, 0x40,
+0xC0, 0x0B, 0x40, 0x03, 0xE0, 0x80, 0x00, 0x40, 0x10, 0x70, 0xE0, 0x70, 0x30, 0x10, 0xA0, 0x91,
+0xC0, 0x0A, 0x40, 0xC0, 0x02, 0x40, 0xC0, 0x03, 0x90, 0xA1, 0x90, 0x00, 0x70, 0x40, 0xE0, 0x30,
+0xA0, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xF4, 0x23, 0xF1, 0x22, 0xF1, 0x24, 0xF6, 0xB0,
+0x60, 0xB0, 0x60, 0x80, 0x01, 0x50, 0xE0, 0x30, 0xA0, 0x90, 0x01, 0x30, 0xC0, 0x30, 0x0F, 0x0B,
+0x0F, 0x11, 0xC0, 0x80, 0x70, 0x40, 0x80, 0x70, 0x50, 0x70, 0xD0, 0xF1, 0xB0, 0x60, 0xB0, 0xD0,
+0xF3, 0x20, 0xF4, 0x24, 0xF0, 0x26, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x20,
+0xF0, 0x21, 0xF3, 0x20, 0xF0, 0xD0, 0x30, 0x10, 0xB0, 0xF0, 0x60, 0xF0, 0xD0, 0x60, 0x70, 0xE0,
+0x70, 0x10, 0x03, 0xC0, 0x50, 0x02, 0x10, 0xC0, 0x40, 0x0E, 0x40, 0x00, 0x40, 0x90, 0x08, 0x51,
+0x90, 0x10, 0x40, 0x06, 0xC0, 0x90, 0x07, 0x50, 0x80, 0x50, 0x01, 0xE0, 0x70, 0x03, 0xC0, 0x50,
+0x07, 0x91, 0x00, 0x30, 0x80, 0xA0, 0x91, 0x50, 0x40, 0x03, 0x70, 0x10, 0xA0, 0x50, 0x07, 0xC0,
+0x50, 0x05, 0xE1, 0x70, 0x40, 0x02, 0x50, 0x71, 0x80, 0x40, 0xB0, 0x62, 0xB0, 0xD1, 0x60, 0xD0,
+0xF0, 0x20, 0xF4, 0xB1, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xD0, 0xB0, 0x80, 0x11, 0x80, 0x10,
+0x30, 0xD0, 0x20, 0xF0, 0xD0, 0x40, 0x80, 0x09, 0x51, 0x00, 0x50, 0x10, 0x08, 0x40, 0xC0, 0x03,
+0xA0, 0x02, 0x30, 0x50, 0xC0, 0x80, 0x10, 0x30, 0x90, 0xC0, 0x0D, 0x40, 0x01, 0x40, 0xC0, 0x02,
+0x40, 0xA0, 0x80, 0x01, 0x30, 0x50, 0x80, 0x70, 0x90, 0x10, 0x60, 0xD0, 0x21, 0xF2, 0x60, 0xB0,
+0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x21, 0xF2, 0x22, 0xF2, 0x22, 0xF1, 0xD0, 0xF0, 0x60, 0xB0,
+0xF1, 0xD0, 0xA0, 0x90, 0xA0, 0x80, 0x41, 0x03, 0xC0, 0x80, 0xC0, 0x0F, 0x0B, 0x0F, 0x10, 0xC0,
+0xE0, 0x80, 0xA0, 0x02, 0xE0, 0xB0, 0xF0, 0xD0, 0xF2, 0x61, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x22,
+0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF3, 0x24, 0xF1, 0x21, 0xF2,
+0xB0, 0xE0, 0xD2, 0x61, 0xD0, 0x70, 0x13, 0x07, 0x90, 0x10, 0x00, 0x40, 0x0D, 0xC0, 0x90, 0xA0,
+0x0A, 0x40, 0xC0, 0x30, 0x11, 0xE0, 0xC0, 0x04, 0x90, 0xC0, 0x06, 0x40, 0x91, 0x50, 0x00, 0x90,
+0x10, 0x90, 0x03, 0x40, 0x06, 0xC0, 0x90, 0x30, 0x72, 0x80, 0x02, 0x50, 0xC0, 0x00, 0x40, 0xE0,
+0x10, 0x30, 0x09, 0xC0, 0x50, 0x04, 0x81, 0xC0, 0x07, 0x40, 0x10, 0x70, 0xB0, 0xD0, 0xF0, 0xB0,
+0x62, 0xB0, 0xF4, 0xD1, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x61, 0xA0, 0x70, 0x11, 0xD0,
+0x21, 0xD1, 0xA0, 0xC0, 0x09, 0x40, 0x00, 0xA0, 0x10, 0x30, 0x06, 0xA0, 0x80, 0xC0, 0x04, 0x40,
+0x90, 0x05, 0x80, 0x70, 0xC0, 0x0F, 0x00, 0x41, 0x02, 0x40, 0x70, 0x40, 0x03, 0xA0, 0x10, 0xA0,
+0x50, 0x00, 0x30, 0xA0, 0xD1, 0xF0, 0xD0, 0xB0, 0x60, 0xB0, 0xD1, 0x20, 0xF0, 0x20, 0xF0, 0x23,
+0xF0, 0x21, 0xF0, 0x24, 0xF1, 0x20, 0xD0, 0xF3, 0x61, 0xF2, 0x20, 0xF0, 0xB0, 0xE0, 0x02, 0xA0,
+0xC0, 0x0F, 0x11, 0x0F, 0x12, 0x40, 0x30, 0x01, 0xC0, 0xA0, 0xD0, 0xF4, 0xD0, 0xF0, 0x60, 0xB0,
+0xF2, 0x21, 0xF0, 0x22, 0xF6, 0x26, 0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xF3, 0x20, 0xF1, 0x20, 0xF1,
+0x20, 0xF0, 0x20, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xB0, 0x40, 0xE0, 0x11, 0xC0, 0x07,
+0xC0, 0x71, 0xC0, 0x40, 0x0D, 0x50, 0x80, 0x0B, 0x40, 0x01, 0xC0, 0xE0, 0x90, 0x05, 0x90, 0x06,
+0x30, 0xC1, 0xE0, 0xA0, 0x80, 0x10, 0x04, 0x51, 0x02, 0xC0, 0x90, 0x40, 0x51, 0x10, 0xE0, 0x80,
+0xC0, 0x80, 0x02, 0xC0, 0x50, 0x00, 0x70, 0xA0, 0xC0, 0x0A, 0xC0, 0x50, 0x0E, 0xC0, 0x30, 0x90,
+0x00, 0xA0, 0x30, 0xD1, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xB1, 0xF0, 0xD1, 0xF0, 0x60, 0xD0, 0xF0,
+0x20, 0xF2, 0x20, 0xF0, 0xB1, 0xD0, 0x70, 0x10, 0xE0, 0x70, 0xD0, 0xF1, 0xD0, 0x60, 0x10, 0x09,
+0x40, 0xC0, 0x10, 0x70, 0x80, 0x07, 0xA0, 0x30, 0x05, 0x30, 0x40, 0x05, 0x40, 0x10, 0xA0, 0x02,
+0xC0, 0x30, 0xC0, 0x08, 0x50, 0x40, 0x90, 0x00, 0x40, 0xA0, 0x40, 0x04, 0xA0, 0x80, 0xD0, 0xA0,
+0x01, 0xC0, 0xA0, 0x30, 0x60, 0xD0, 0x60, 0xB0, 0xD0, 0xF3, 0x22, 0xF0, 0x21, 0xF1, 0x21, 0xF1,
+0x23, 0xF4, 0xD0, 0xB0, 0x60, 0xF3, 0x21, 0xD1, 0x30, 0x90, 0x01, 0x40, 0x30, 0x0F, 0x11, 0x0F,
+0x12, 0xA0, 0x40, 0xA0, 0xC0, 0x30, 0x60, 0xD0, 0xF6, 0xD0, 0xB0, 0x60, 0xB0, 0xF1, 0x26, 0xF5,
+0x24, 0xF0, 0x22, 0xF2, 0x60, 0xB0, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF5, 0xD0, 0xB0,
+0x60, 0xD0, 0xB0, 0x60, 0xE0, 0x11, 0x80, 0x01, 0x70, 0x50, 0x07, 0xC0, 0x40, 0x0C, 0x80, 0x40,
+0xC0, 0x0A, 0xC0, 0x90, 0x09, 0x51, 0x05, 0xA0, 0x01, 0x40, 0x11, 0x80, 0x91, 0x03, 0x90, 0xC0,
+0x90, 0x40, 0x50, 0xC0, 0x01, 0x50, 0x70, 0x90, 0x00, 0x50, 0x80, 0x01, 0x50, 0x00, 0x70, 0x0D,
+0x50, 0x80, 0x50, 0x0E, 0x90, 0x40, 0x02, 0x40, 0xA0, 0xD0, 0xF2, 0xD1, 0xF0, 0xB0, 0x61, 0xB2,
+0xD0, 0xF2, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0xB0, 0x60, 0xD0, 0xF2, 0xD1, 0x70, 0x80, 0x08, 0x51,
+0xC0, 0x70, 0x50, 0x07, 0x30, 0x40, 0x02, 0xC1, 0x02, 0x80, 0x30, 0x03, 0x40, 0x51, 0xC0, 0x02,
+0x40, 0x81, 0x07, 0x90, 0x50, 0x00, 0x80, 0x30, 0x40, 0x05, 0x30, 0x60, 0xD1, 0x30, 0x50, 0x00,
+0x80, 0xE0, 0xB0, 0x61, 0xB0, 0xD1, 0xF8, 0x24, 0xF0, 0x21, 0xF0, 0x23, 0xF0, 0xD0, 0xB0, 0x60,
+0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0xA0, 0xC0, 0xA0, 0x40, 0xA0, 0xC0, 0x0F,
+0x10, 0x0F, 0x11, 0x80, 0x90, 0x01, 0x30, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xF0,
+0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x24, 0xF6, 0x26, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xD0, 0xF3, 0x23,
+0xF2, 0x20, 0xF1, 0xB0, 0x60, 0xD0, 0xF0, 0xD0, 0xB0, 0x60, 0xE0, 0x10, 0x81, 0x10, 0x80, 0x0A,
+0x40, 0x0B, 0xA0, 0x00, 0x40, 0xC0, 0x0A, 0x90, 0xC0, 0x09, 0x40, 0x04, 0xC0, 0x80, 0x01, 0xC0,
+0x10, 0xA0, 0x00, 0x10, 0x50, 0xC0, 0x70, 0x00, 0x50, 0x80, 0x90, 0x09, 0x90, 0x40, 0x01, 0xA0,
+0x10, 0x80, 0x0B, 0xC1, 0x50, 0x10, 0x30, 0x0D, 0xC0, 0x70, 0x04, 0x40, 0x30, 0xD3, 0x20, 0xD2,
+0xF0, 0xB0, 0x61, 0xF0, 0xD1, 0x20, 0xF2, 0x20, 0x60, 0xD0, 0xF1, 0xD1, 0xF1, 0xD1, 0x60, 0xA0,
+0x08, 0xC0, 0x40, 0x0B, 0x40, 0x03, 0x11, 0x40, 0x50, 0x01, 0x71, 0x01, 0x40, 0xC0, 0x05, 0x30,
+0xC0, 0x80, 0xA0, 0x05, 0x90, 0x50, 0x80, 0xA0, 0x91, 0xC0, 0x04, 0xA0, 0x30, 0xD0, 0xF0, 0xD0,
+0x80, 0x40, 0x01, 0x70, 0xB0, 0x60, 0xF0, 0xD0, 0xF3, 0xD0, 0xF0, 0xD0, 0xF3, 0x21, 0xF0, 0x21,
+0xF2, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x30,
+0xA0, 0x01, 0xC0, 0x30, 0x0F, 0x10, 0x0F, 0x11, 0x70, 0x02, 0xA0, 0xF0, 0xD0, 0x22, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x61, 0xF3, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x24,
+0xF4, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0x20, 0xF2, 0x25, 0xF1, 0x60, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0,
+0xB0, 0xA0, 0xE0, 0x11, 0xE0, 0xC0, 0x0B, 0x40, 0x09, 0xC0, 0x30, 0x01, 0x40, 0x0B, 0x40, 0x09,
+0xC0, 0x90, 0x03, 0x90, 0x40, 0x02, 0x40, 0x00, 0x70, 0x10, 0x00, 0xC0, 0x50, 0x10, 0xE0, 0x40,
+0x50, 0x09, 0x40, 0x50, 0x02, 0x30, 0x50, 0x0A, 0x80, 0x10, 0x40, 0x00, 0xC1, 0x0D, 0x70, 0x50,
+0x05, 0x30, 0x70, 0xA0, 0x60, 0xD2, 0xF2, 0xB1, 0xF0, 0x61, 0xB0, 0xD1, 0xF0, 0xD0, 0x60, 0x20,
+0xF2, 0x20, 0xF2, 0xD0, 0xB0, 0xA0, 0xC0, 0x08, 0x40, 0x0B, 0x40, 0x05, 0x90, 0x11, 0x50, 0x02,
+0x10, 0x40, 0x07, 0x40, 0x80, 0x30, 0x05, 0x80, 0xA1, 0xC0, 0x02, 0x40, 0xC0, 0x02, 0xC0, 0xE0,
+0xD0, 0xF0, 0xD1, 0xA0, 0x50, 0x00, 0xC0, 0x30, 0x90, 0xD2, 0xF1, 0xD1, 0xE0, 0xD2, 0xF1, 0x21,
+0xF0, 0x22, 0xF0, 0xD0, 0xF3, 0x20, 0xB0, 0x60, 0xF0, 0xD0, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0xD0,
+0x70, 0x02, 0x70, 0xC0, 0x0F, 0x0F, 0x0F, 0x10, 0x81, 0xA0, 0x91, 0x30, 0xD0, 0x22, 0xF1, 0x25,
+0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0x24, 0xF4, 0x23, 0xF0, 0x21, 0xF4,
+0x60, 0xB0, 0xF4, 0x23, 0xF1, 0x60, 0xF1, 0xD0, 0xF1, 0xD0, 0x30, 0x10, 0xA0, 0xE0, 0xC0, 0x70,
+0x40, 0x0C, 0x40, 0xC0, 0x07, 0x90, 0x80, 0x02, 0x40, 0x0A, 0xC0, 0x40, 0x09, 0x40, 0x03, 0x80,
+0x50, 0x02, 0x51, 0x10, 0x30, 0x90, 0x50, 0x00, 0xC1, 0x00, 0x40, 0x01, 0x90, 0x06, 0xE0, 0x70,
+0x02, 0x70, 0xA0, 0x0A, 0x41, 0x01, 0xC0, 0x50, 0x0C, 0xA0, 0xC0, 0x40, 0x07, 0xC0, 0x80, 0xA0,
+0x31, 0xF0, 0xD1, 0x60, 0xF0, 0xD2, 0xB0, 0x60, 0xB0, 0xF1, 0x60, 0xF1, 0x20, 0xF2, 0xD1, 0xB0,
+0x30, 0xC0, 0x08, 0x90, 0xC0, 0x0A, 0x40, 0xC0, 0x05, 0x80, 0x11, 0x00, 0x90, 0x01, 0x42, 0xA0,
+0x05, 0xC0, 0xE0, 0xA0, 0x03, 0x90, 0x30, 0x80, 0xC0, 0x05, 0x40, 0x02, 0x30, 0x60, 0xD0, 0xF1,
+0xD0, 0x70, 0xC0, 0x50, 0x40, 0x30, 0x40, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0xA0, 0x70, 0x31, 0xA0,
+0xD0, 0x20, 0xF3, 0x21, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0xF1, 0x25, 0xF1, 0x22, 0xD0,
+0x80, 0x40, 0x90, 0xA0, 0x80, 0x30, 0x0F, 0x0F, 0x0F, 0x10, 0xA0, 0x01, 0x40, 0x10, 0xD0, 0xF0,
+0x22, 0xF0, 0x25, 0xF0, 0x20, 0xF4, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x25, 0xF3, 0x21, 0xF0, 0x21,
+0xF0, 0x22, 0xF3, 0xB0, 0x60, 0x20, 0xF3, 0x21, 0xF1, 0xB1, 0xD0, 0xF3, 0xD0, 0x30, 0x10, 0x50,
+0x90, 0xC0, 0xA0, 0x40, 0x0D, 0x40, 0x07, 0x80, 0x40, 0x02, 0xC0, 0x40, 0x0A, 0x51, 0x08, 0xC0,
+0x90, 0x02, 0x30, 0xC0, 0x02, 0xC0, 0x41, 0x50, 0x05, 0x90, 0x01, 0x10, 0x80, 0x05, 0x70, 0xE0,
+0x01, 0x50, 0x10, 0xA0, 0x50, 0x0D, 0xC0, 0x50, 0x0B, 0x80, 0x40, 0x00, 0x90, 0x0A, 0xC0, 0x40,
+0xA0, 0xB0, 0xD0, 0x60, 0xF0, 0x60, 0xB2, 0xD0, 0x60, 0xB0, 0x60, 0xB0, 0xD0, 0xF3, 0xD0, 0x60,
+0xE0, 0xA0, 0x50, 0x08, 0xC0, 0x90, 0x0A, 0x90, 0x50, 0x06, 0x50, 0x10, 0xE1, 0x10, 0x00, 0x40,
+0xC0, 0x30, 0x80, 0xE0, 0xC0, 0x05, 0x40, 0x80, 0xA0, 0xC0, 0x40, 0xA0, 0x40, 0x08, 0xC0, 0x40,
+0x01, 0xA0, 0x60, 0xD0, 0xF1, 0xD0, 0xA0, 0x90, 0x50, 0x00, 0xA0, 0x71, 0xA1, 0xD1, 0x70, 0x10,
+0xE0, 0x40, 0x00, 0x30, 0x60, 0xF4, 0x21, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xF1, 0xD0, 0xF1, 0x26,
+0xF1, 0x22, 0xF0, 0xD0, 0xE0, 0x80, 0x01, 0x30, 0x50, 0x0F, 0x0E, 0x0F, 0x0F, 0x80, 0x50, 0x01,
+0xC0, 0xA0, 0xD0, 0xF0, 0x20, 0xF3, 0x23, 0xF2, 0x22, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xF0, 0xD0,
+0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF4, 0x26, 0xF0, 0x20, 0xD0, 0x20, 0x60, 0xB0, 0xD0, 0xF1, 0x20,
+0xF1, 0xB0, 0x60, 0xD0, 0x20, 0xF4, 0x10, 0x30, 0x10, 0xE0, 0xC0, 0x90, 0x0F, 0x00, 0x40, 0x06,
+0x90, 0x30, 0x03, 0x50, 0x90, 0x0A, 0x40, 0x09, 0x40, 0xC0, 0x01, 0xA0, 0x02, 0x40, 0x90, 0xC0,
+0x07, 0xC0, 0x30, 0xA0, 0x30, 0xA0, 0xC0, 0x30, 0x03, 0x30, 0x03, 0x50, 0x00, 0x50, 0x0D, 0xC0,
+0x50, 0x0A, 0x90, 0x80, 0x00, 0xC0, 0x50, 0x0C, 0x50, 0xE0, 0xA0, 0x70, 0xA0, 0x80, 0xE0, 0xA0,
+0x30, 0x70, 0xE0, 0xA0, 0xD0, 0x61, 0xF0, 0xD2, 0x80, 0x10, 0x30, 0x90, 0x09, 0x40, 0x0A, 0xC0,
+0x40, 0x00, 0xC0, 0xE0, 0x05, 0x80, 0x00, 0x50, 0x41, 0xC0, 0x00, 0xE0, 0x70, 0x80, 0x40, 0x05,
+0x90, 0x40, 0x30, 0xA0, 0x80, 0x50, 0x0A, 0x90, 0x50, 0x00, 0xE0, 0x60, 0xD2, 0xB0, 0x30, 0x50,
+0x01, 0xA1, 0x00, 0xA0, 0x90, 0xC0, 0x70, 0xA0, 0xE0, 0x30, 0x01, 0x70, 0xF0, 0xD0, 0xF1, 0xD0,
+0xF2, 0xD0, 0xF0, 0x61, 0xF1, 0x21, 0xF3, 0x26, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x90, 0x01, 0xC0,
+0x30, 0x0F, 0x0E, 0x0F, 0x0F, 0x70, 0xA0, 0x40, 0x00, 0xA0, 0xD1, 0x20, 0xF5, 0x22, 0xF2, 0x23,
+0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF1, 0x23, 0xF4, 0x26, 0xF1, 0x20, 0xF1, 0xB0, 0x60, 0xD0,
+0xF0, 0xD0, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0x40, 0x80,
+0x10, 0x70, 0x90, 0x0F, 0x00, 0x40, 0x06, 0x80, 0x40, 0x03, 0x51, 0x0A, 0x40, 0x09, 0x40, 0x01,
+0x30, 0x00, 0x41, 0x0A, 0x41, 0x30, 0x10, 0x06, 0x80, 0xC0, 0x04, 0x90, 0x0D, 0xC0, 0x50, 0x09,
+0xC0, 0x70, 0x01, 0x90, 0xC0, 0x0D, 0x10, 0x50, 0x07, 0x70, 0xD2, 0xB0, 0x60, 0xB0, 0xD0, 0x80,
+0x40, 0x50, 0xC0, 0x08, 0x90, 0xC0, 0x09, 0xC0, 0x90, 0xE0, 0x80, 0x00, 0xC0, 0x08, 0x40, 0x05,
+0x30, 0x01, 0x50, 0x70, 0xA0, 0x50, 0xC0, 0x80, 0x00, 0x90, 0xC0, 0x0C, 0x90, 0x40, 0xE0, 0xD1,
+0xF0, 0x61, 0x80, 0x40, 0x01, 0x70, 0xA0, 0xC0, 0x10, 0x70, 0x12, 0x90, 0x02, 0x10, 0xD1, 0xE0,
+0x70, 0xD0, 0xF1, 0xD0, 0x61, 0xF3, 0x23, 0xF6, 0x22, 0xF4, 0xD0, 0x70, 0x00, 0x90, 0xA0, 0x70,
+0xC0, 0x0F, 0x0D, 0x0F, 0x0E, 0x40, 0x90, 0x00, 0x40, 0x70, 0x30, 0xD0, 0xF0, 0x21, 0xF6, 0x21,
+0xF5, 0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF4, 0x23, 0xF0, 0x20,
+0xF4, 0x20, 0x60, 0xB0, 0xD0, 0xF0, 0x60, 0xF2, 0x20, 0xF1, 0xD0, 0xF0, 0xD0, 0x30, 0x10, 0xA0,
+0xC0, 0x02, 0x40, 0xC0, 0x0E, 0x40, 0xC0, 0x05, 0x70, 0xA0, 0x03, 0x90, 0xC0, 0x09, 0xC0, 0x50,
+0x08, 0x50, 0xC0, 0x90, 0x80, 0x90, 0x0C, 0x40, 0x70, 0x40, 0x07, 0xA0, 0xC0, 0x04, 0x40, 0x05,
+0xC0, 0x90, 0x05, 0xC0, 0x50, 0x09, 0x70, 0x02, 0x40, 0x0D, 0xC0, 0x40, 0x90, 0x07, 0xA0, 0xB0,
+0x21, 0xD0, 0xF0, 0xB0, 0x60, 0xD0, 0xA0, 0x90, 0x08, 0x51, 0x0A, 0x40, 0x00, 0xC0, 0x02, 0xC0,
+0x51, 0x04, 0x40, 0x06, 0xA0, 0xE0, 0x80, 0xE0, 0xC0, 0x00, 0xA0, 0x40, 0x30, 0x40, 0xC0, 0x0E,
+0xA0, 0x40, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0x60, 0x80, 0x01, 0x31, 0x00, 0x51, 0x00, 0x90, 0x10,
+0x02, 0x50, 0xE0, 0x10, 0x70, 0x60, 0xA0, 0xD1, 0xB0, 0x60, 0xF1, 0xD0, 0xF2, 0x23, 0xF7, 0x21,
+0xF4, 0xD0, 0x60, 0xE0, 0x40, 0x00, 0xC0, 0x30, 0x0F, 0x0D, 0x0F, 0x0E, 0xA0, 0x02, 0x30, 0xB0,
+0xF6, 0x20, 0xF3, 0x21, 0xF4, 0x24, 0xF2, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF2,
+0x26, 0xF0, 0x21, 0xF2, 0x61, 0xB1, 0xF1, 0x21, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xA0, 0x40, 0x90,
+0x04, 0x40, 0xC0, 0x0E, 0x40, 0x06, 0x30, 0xC0, 0x03, 0x40, 0x0A, 0x40, 0x09, 0x40, 0x30, 0xC0,
+0x0E, 0xC0, 0x50, 0x07, 0x30, 0xC0, 0x04, 0x90, 0x04, 0x50, 0x10, 0x70, 0x05, 0xC0, 0x50, 0x08,
+0x30, 0x50, 0x02, 0x40, 0x0E, 0x50, 0xC0, 0x07, 0x70, 0xF0, 0x20, 0xF2, 0xD0, 0xB0, 0x60, 0x80,
+0xA0, 0x50, 0x07, 0x40, 0x0A, 0x40, 0x05, 0x80, 0x10, 0x70, 0x03, 0x40, 0xC0, 0x06, 0xC0, 0x50,
+0x90, 0xC0, 0x02, 0xA0, 0x80, 0x0F, 0x01, 0x70, 0xB1, 0x60, 0xF2, 0xB0, 0x80, 0x08, 0x40, 0x04,
+0x10, 0x70, 0x40, 0x80, 0x61, 0xB0, 0xF6, 0x23, 0xF7, 0x21, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0x70,
+0x02, 0x30, 0x0F, 0x0D, 0x0F, 0x0D, 0x40, 0xE0, 0x40, 0x00, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xF3,
+0x22, 0xF2, 0x27, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x61, 0x20, 0xD0, 0x20, 0xF0, 0x22,
+0xF3, 0x23, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xD1, 0xB0, 0x80, 0xB0, 0xD0, 0x23, 0xF0, 0x70, 0x40,
+0x70, 0x81, 0x06, 0x90, 0x50, 0x0E, 0x40, 0x03, 0xC0, 0x00, 0x41, 0x04, 0x40, 0x0A, 0x40, 0x06,
+0xC0, 0x40, 0x50, 0x70, 0x0F, 0x01, 0x40, 0x07, 0xA0, 0x05, 0x50, 0xC0, 0x03, 0x80, 0x40, 0x90,
+0xA0, 0x30, 0x03, 0xC0, 0x50, 0x00, 0xC0, 0x05, 0x40, 0x80, 0x03, 0x90, 0x0E, 0x40, 0x08, 0x70,
+0xD0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0x80, 0x10, 0xC0, 0x05, 0x40, 0x0A, 0x40, 0xC0, 0x05,
+0x50, 0xE0, 0x10, 0x50, 0x01, 0x40, 0xC0, 0x0D, 0xC0, 0x90, 0x0F, 0x01, 0x31, 0x61, 0xD0, 0xF0,
+0x21, 0xD0, 0x10, 0x50, 0x01, 0x70, 0x0A, 0x80, 0x40, 0xE0, 0x40, 0x70, 0x80, 0xD1, 0xF1, 0x20,
+0xF4, 0x21, 0xF6, 0x22, 0xF2, 0x20, 0xF1, 0xD0, 0x30, 0x90, 0x00, 0x90, 0x70, 0x30, 0x0F, 0x0C,
+0x0F, 0x0D, 0x70, 0x00, 0x40, 0xA0, 0x70, 0xB0, 0xD0, 0xF1, 0xD0, 0xF1, 0x24, 0xF1, 0x28, 0xF2,
+0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x61, 0xD0, 0xF0, 0x20, 0xF5, 0x22, 0xF0, 0x20, 0xF1, 0x21,
+0xF2, 0xD0, 0x60, 0xD0, 0x60, 0xB0, 0xF4, 0x70, 0x00, 0x90, 0x70, 0x30, 0x10, 0x80, 0x40, 0x04,
+0x50, 0x90, 0x0E, 0x40, 0x02, 0x80, 0xA0, 0x00, 0x30, 0x04, 0xC0, 0x40, 0x09, 0xC0, 0x90, 0x04,
+0x40, 0x90, 0x01, 0xA0, 0x0F, 0x01, 0x50, 0xC0, 0x06, 0xA0, 0x05, 0x50, 0xC0, 0x03, 0x80, 0x11,
+0x80, 0x04, 0xC1, 0x40, 0x70, 0x10, 0x70, 0x02, 0x90, 0x30, 0x04, 0x90, 0x0E, 0x90, 0x08, 0x70,
+0xB0, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x60, 0xD1, 0x80, 0x30, 0x04, 0x51, 0x80, 0x08, 0x90, 0xC0,
+0x08, 0xC0, 0x01, 0x40, 0xC0, 0x0D, 0x91, 0x0F, 0x00, 0x40, 0x70, 0x60, 0xB0, 0xF0, 0x60, 0xF0,
+0xD0, 0xF0, 0x20, 0xF0, 0xE0, 0x90, 0x00, 0x90, 0xE0, 0x0B, 0xA0, 0x70, 0x32, 0xE0, 0x30, 0xD0,
+0x22, 0xF3, 0x21, 0xF0, 0x22, 0xF2, 0x23, 0xF2, 0x20, 0xF0, 0xD1, 0x70, 0xA0, 0x80, 0x00, 0xA0,
+0x0F, 0x0C, 0x0F, 0x0C, 0x40, 0x90, 0x01, 0xC0, 0x70, 0x61, 0xF0, 0xD0, 0xF1, 0x26, 0xF0, 0x25,
+0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF3, 0x21, 0xF0, 0x21,
+0xF2, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD1, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0x80,
+0x11, 0x80, 0x30, 0x80, 0x11, 0x50, 0x00, 0x70, 0x02, 0x50, 0x40, 0x0E, 0x40, 0xC0, 0x01, 0xE0,
+0xC0, 0x80, 0x05, 0x50, 0x90, 0x09, 0x90, 0x50, 0x01, 0x50, 0x40, 0xC0, 0x01, 0xC0, 0x30, 0x90,
+0x0F, 0x01, 0x90, 0x06, 0xA0, 0x05, 0xC0, 0x50, 0x02, 0x50, 0xE0, 0x40, 0x06, 0xC0, 0x90, 0x10,
+0x70, 0x40, 0x03, 0xA0, 0x04, 0x51, 0x0D, 0x50, 0xC0, 0x08, 0xC0, 0xA0, 0xD0, 0xF0, 0x20, 0xF1,
+0x60, 0xB0, 0xD1, 0x81, 0x90, 0x50, 0x01, 0xC0, 0x90, 0x80, 0x10, 0x50, 0x06, 0x51, 0x0B, 0x40,
+0x04, 0x30, 0xC0, 0x07, 0x40, 0x50, 0x0E, 0x90, 0x70, 0x80, 0x40, 0xB0, 0xD1, 0xF0, 0x60, 0xF1,
+0xD0, 0xB0, 0xA0, 0x80, 0x00, 0x80, 0xA0, 0x09, 0x50, 0x40, 0x50, 0x80, 0x70, 0x80, 0xA2, 0xD0,
+0xF0, 0x2F, 0x05, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xA0, 0x90, 0x01, 0x50, 0x80, 0x0F, 0x0B, 0x0F,
+0x0C, 0x70, 0x90, 0x01, 0x30, 0xB0, 0xD0, 0xB0, 0x60, 0xB0, 0xF2, 0x24, 0xF1, 0x28, 0xF1, 0x20,
+0xF0, 0x22, 0xF3, 0xD0, 0xF0, 0xB0, 0x60, 0xF3, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x20, 0xF2,
+0x60, 0xD0, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xD1, 0x60, 0x80, 0x40, 0x00, 0x40, 0x30, 0x11, 0x30,
+0xE0, 0x40, 0x00, 0xC0, 0x01, 0xC0, 0x40, 0xC0, 0x0D, 0x40, 0x01, 0xE0, 0x90, 0xE0, 0x30, 0x05,
+0x51, 0x09, 0x40, 0x00, 0x90, 0x50, 0x03, 0x90, 0x40, 0x90, 0xC0, 0x0F, 0x00, 0x40, 0x04, 0xC0,
+0x00, 0xA0, 0x03, 0xC0, 0x50, 0x00, 0x90, 0x02, 0x50, 0x80, 0x07, 0xC0, 0x40, 0x80, 0x04, 0x70,
+0xC0, 0x04, 0x90, 0xC0, 0x0D, 0x40, 0x0A, 0x80, 0x60, 0xD0, 0xF2, 0x60, 0xD0, 0xF1, 0xD0, 0x70,
+0x00, 0x50, 0x40, 0x00, 0x40, 0x00, 0x30, 0x70, 0x06, 0xC0, 0x90, 0x0B, 0x40, 0xC0, 0x02, 0x30,
+0x00, 0x70, 0x10, 0x40, 0x05, 0x40, 0xC0, 0x0B, 0x50, 0x80, 0xA0, 0xE0, 0xA0, 0x40, 0x60, 0xB0,
+0xD0, 0xF1, 0xD0, 0x60, 0xB0, 0xF1, 0xD0, 0x70, 0x10, 0x00, 0xA0, 0x40, 0x07, 0xC0, 0x91, 0x00,
+0xA0, 0x11, 0x30, 0x40, 0x81, 0xB0, 0xD0, 0x22, 0xF2, 0x25, 0xF1, 0x24, 0xF0, 0xD0, 0xF0, 0xB0,
+0x60, 0xB0, 0xD1, 0xA0, 0x01, 0x50, 0xE0, 0x0F, 0x0B, 0x0F, 0x04, 0x50, 0xC0, 0x04, 0x50, 0x30,
+0x40, 0xA0, 0x80, 0xA0, 0xD1, 0xF0, 0xD0, 0xF0, 0x61, 0xF7, 0x2B, 0xFB, 0x61, 0xF3, 0x21, 0xF3,
+0x22, 0xF0, 0xD0, 0x60, 0xF2, 0x20, 0xF2, 0xB0, 0x60, 0xD0, 0x30, 0x10, 0x02, 0x50, 0x11, 0x30,
+0x10, 0x00, 0x90, 0x10, 0x03, 0x40, 0xC0, 0x0D, 0x40, 0x00, 0x80, 0x70, 0x00, 0x70, 0x06, 0x40,
+0xC0, 0x08, 0x50, 0x80, 0xC0, 0x04, 0x80, 0x50, 0x00, 0x40, 0x0F, 0x00, 0xC0, 0x50, 0x03, 0x70,
+0x40, 0xA0, 0x03, 0x11, 0xC0, 0x90, 0x02, 0xE0, 0xA0, 0x07, 0xC1, 0x04, 0x30, 0x90, 0x05, 0x40,
+0x0D, 0xC0, 0x50, 0x0A, 0x40, 0x60, 0xD0, 0xF0, 0xD0, 0x60, 0xF1, 0x60, 0xD1, 0x30, 0x90, 0x01,
+0x40, 0x90, 0x00, 0x40, 0x10, 0x06, 0x40, 0x0B, 0x40, 0xC0, 0x03, 0x11, 0xE0, 0x10, 0x40, 0x04,
+0x40, 0xC0, 0x0A, 0x90, 0x70, 0x30, 0x60, 0xD0, 0x62, 0xF6, 0x60, 0xF0, 0xD0, 0xB0, 0x70, 0x40,
+0xC0, 0x10, 0x07, 0x90, 0x40, 0x02, 0x80, 0x10, 0x70, 0x50, 0x01, 0x90, 0x30, 0xD0, 0xF0, 0x21,
+0xF3, 0x23, 0xF4, 0x20, 0xF2, 0x61, 0xB0, 0xF2, 0xD0, 0x31, 0xA0, 0x40, 0x80, 0x90, 0x0F, 0x0A,
+0x0F, 0x03, 0x40, 0x80, 0x30, 0xC0, 0x03, 0xA0, 0x02, 0x30, 0x60, 0xD0, 0xF5, 0x61, 0xB0, 0xD0,
+0xF4, 0x24, 0xF0, 0x23, 0xF8, 0x20, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xF2, 0x20, 0xF1, 0x24, 0xF0,
+0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x60, 0xF0, 0xD0, 0x10, 0x03, 0xA0, 0x11, 0x40,
+0x10, 0x50, 0x04, 0x40, 0x50, 0x0D, 0x40, 0xC0, 0x40, 0x00, 0x81, 0x06, 0x40, 0xC0, 0x06, 0x91,
+0x06, 0xA0, 0x01, 0x51, 0x0F, 0x00, 0x90, 0x05, 0xA0, 0x02, 0x50, 0x10, 0x80, 0xE0, 0x90, 0x01,
+0xC0, 0x10, 0xE0, 0x07, 0xC0, 0x40, 0xC0, 0x02, 0x40, 0x80, 0x06, 0x40, 0x0D, 0x90, 0xC0, 0x0A,
+0x50, 0x30, 0xD1, 0xF0, 0xB0, 0xD0, 0xF0, 0x70, 0x60, 0xD0, 0x60, 0x80, 0x02, 0x50, 0x40, 0x07,
+0x40, 0x0B, 0x40, 0xC0, 0x04, 0x90, 0x10, 0x00, 0x70, 0xE0, 0x02, 0xC0, 0x40, 0x09, 0x50, 0x30,
+0x70, 0xA0, 0xD2, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xB0, 0x60, 0xF0, 0xD0,
+0xA0, 0x00, 0x50, 0xA0, 0x05, 0x50, 0x41, 0x00, 0xC0, 0x10, 0x30, 0xE0, 0x10, 0x80, 0x91, 0xC0,
+0x00, 0x70, 0xF1, 0x22, 0xF1, 0x25, 0xF3, 0xD0, 0xB0, 0x61, 0x20, 0xF5, 0xB0, 0x70, 0x02, 0xA0,
+0x0F, 0x0A, 0x0F, 0x03, 0x40, 0x80, 0x30, 0x03, 0xC0, 0x70, 0x02, 0xA0, 0xD0, 0xF8, 0xB0, 0x60,
+0xB0, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0x20, 0xF3, 0x22, 0xF2, 0x24, 0xF1, 0xD0, 0xB0, 0x60, 0xB0,
+0xD1, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x60, 0xD0, 0xF1, 0x24, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xA0,
+0xE0, 0xC0, 0x02, 0x40, 0x11, 0x80, 0x90, 0xC0, 0x04, 0x50, 0x90, 0x0D, 0x40, 0x00, 0x50, 0x00,
+0x80, 0x90, 0x06, 0x40, 0x05, 0x40, 0xC0, 0x07, 0xA0, 0x02, 0x40, 0x0F, 0x00, 0x40, 0x10, 0xC0,
+0x03, 0xA0, 0x02, 0xC0, 0x11, 0x80, 0xC0, 0x30, 0x71, 0x10, 0x70, 0x07, 0xC0, 0xE1, 0x70, 0x30,
+0x50, 0x30, 0x06, 0xC0, 0x90, 0x0D, 0x40, 0x0B, 0xC0, 0xA0, 0x80, 0xA0, 0x31, 0xD1, 0x61, 0xD1,
+0x70, 0x90, 0x02, 0xC0, 0x40, 0xC0, 0x04, 0x40, 0x0B, 0x40, 0xC0, 0x06, 0x10, 0x40, 0x80, 0x10,
+0x01, 0x91, 0x07, 0xC0, 0x40, 0x70, 0xA0, 0xF0, 0xD3, 0xB1, 0xD1, 0xF0, 0x22, 0xF2, 0x20, 0xD0,
+0x60, 0xB0, 0x80, 0x70, 0xC0, 0x05, 0x50, 0x40, 0xC0, 0x40, 0xE0, 0xC0, 0x70, 0xE0, 0x80, 0xE0,
+0xB0, 0x80, 0x90, 0x10, 0x80, 0x00, 0x30, 0xB0, 0x24, 0xF1, 0x23, 0xF2, 0xD0, 0xF0, 0x60, 0xB0,
+0x20, 0xF7, 0xD0, 0xA0, 0xC0, 0x01, 0xA0, 0x50, 0x0F, 0x09, 0x0F, 0x04, 0x50, 0x04, 0x40, 0x80,
+0xA0, 0x41, 0x30, 0xD0, 0x20, 0xF1, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0,
+0xD0, 0xF3, 0x24, 0xF1, 0x23, 0xF2, 0x26, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20, 0xF2,
+0x60, 0x20, 0xF0, 0x21, 0xF1, 0x23, 0xF1, 0xD0, 0xB0, 0x30, 0x70, 0x40, 0x03, 0x13, 0xC0, 0x05,
+0x50, 0x40, 0x0D, 0x90, 0x70, 0x80, 0xC0, 0x30, 0x06, 0xC0, 0x40, 0x02, 0xC0, 0x40, 0x08, 0xC0,
+0x80, 0x02, 0xC0, 0x90, 0x0E, 0x50, 0x80, 0x04, 0x30, 0x01, 0x80, 0x70, 0xE0, 0x40, 0x01, 0xE0,
+0xD1, 0x60, 0x10, 0x07, 0xC0, 0x80, 0x70, 0xA0, 0x90, 0xA0, 0xC0, 0x06, 0xC0, 0x50, 0x0C, 0x51,
+0x0B, 0x50, 0x70, 0x30, 0x50, 0xC0, 0x90, 0x30, 0xD1, 0x20, 0xF0, 0xD0, 0xB0, 0x30, 0x04, 0x40,
+0x50, 0x02, 0x90, 0xC0, 0x0A, 0x40, 0xC0, 0x07, 0xC0, 0x70, 0x10, 0x40, 0x00, 0x90, 0x50, 0x06,
+0x50, 0xA1, 0x80, 0xD1, 0x60, 0x30, 0xA0, 0x70, 0x80, 0xA1, 0x80, 0x60, 0xB0, 0x22, 0xF2, 0x20,
+0xF0, 0xD0, 0x60, 0x11, 0xE0, 0xC0, 0x02, 0xC0, 0x40, 0x90, 0x01, 0x11, 0xE0, 0x70, 0x80, 0x30,
+0xB0, 0xD0, 0x60, 0x31, 0x70, 0x40, 0x70, 0xF1, 0x22, 0xF1, 0x23, 0xF2, 0xB0, 0x61, 0xF0, 0xD0,
+0x21, 0xF0, 0x20, 0xF5, 0x60, 0x80, 0x40, 0xA0, 0x80, 0x30, 0x0F, 0x09, 0x0F, 0x02, 0xC0, 0x70,
+0xE0, 0xA0, 0x50, 0x02, 0xA0, 0x01, 0x90, 0xE0, 0xD0, 0xF2, 0x20, 0xF7, 0xD0, 0xF0, 0xB0, 0x60,
+0xB0, 0xF0, 0xD0, 0xF2, 0x2B, 0xF6, 0x21, 0xF3, 0x61, 0xD0, 0xF1, 0xD1, 0xB1, 0xF0, 0x20, 0xF3,
+0x23, 0xD0, 0xF1, 0xD0, 0xB0, 0xA1, 0x90, 0x02, 0xE0, 0x10, 0x70, 0x08, 0xC0, 0x40, 0x0D, 0x40,
+0x90, 0x00, 0xE0, 0x30, 0x06, 0x50, 0x90, 0x00, 0x50, 0x90, 0x09, 0x90, 0x40, 0x03, 0x40, 0x0F,
+0x00, 0x40, 0x03, 0xC0, 0xA0, 0x01, 0x10, 0x80, 0x50, 0x70, 0x01, 0xA0, 0xD2, 0x30, 0x40, 0x06,
+0xC0, 0x50, 0x01, 0x70, 0x08, 0x50, 0xC0, 0x0C, 0x40, 0x0D, 0x70, 0xA0, 0x30, 0xA0, 0x30, 0xE0,
+0xF0, 0xD0, 0xF1, 0xD1, 0xA0, 0x40, 0x04, 0x50, 0x90, 0x00, 0x51, 0x0A, 0x40, 0xC0, 0x0A, 0x70,
+0x41, 0x50, 0x06, 0x70, 0xA0, 0xF0, 0xD1, 0xF0, 0x10, 0x80, 0x90, 0x50, 0x90, 0x01, 0xC0, 0x41,
+0xA0, 0x60, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0xA0, 0x40, 0x30, 0x02, 0x90, 0x40, 0x01,
+0xC0, 0x70, 0xA0, 0xE0, 0x80, 0x90, 0x31, 0xB0, 0xD1, 0xE0, 0xB0, 0x80, 0xA0, 0xD1, 0x24, 0xF2,
+0x20, 0xD1, 0xB0, 0x60, 0xB0, 0x20, 0xFC, 0xD0, 0xE0, 0x90, 0x01, 0xA0, 0x0F, 0x09, 0x0F, 0x02,
+0x70, 0x90, 0x00, 0x40, 0xE1, 0x00, 0x40, 0x90, 0x01, 0x50, 0x30, 0xD0, 0xF1, 0x20, 0xF0, 0x21,
+0xF4, 0x20, 0xF1, 0xD1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x29, 0xF5, 0x23, 0xF2, 0xD0, 0xF0,
+0x60, 0xB0, 0xD1, 0xF0, 0x60, 0xD0, 0x22, 0xF2, 0x23, 0xF3, 0xD0, 0xE0, 0x30, 0x80, 0x02, 0xA0,
+0x30, 0x50, 0x00, 0x30, 0x70, 0x07, 0x40, 0xC0, 0x0C, 0x40, 0x01, 0xA0, 0x07, 0x50, 0x40, 0x50,
+0x0A, 0x80, 0x50, 0x04, 0x40, 0x0E, 0x90, 0xC0, 0x03, 0x30, 0x00, 0x50, 0x00, 0x70, 0x80, 0xA0,
+0xE0, 0x70, 0x60, 0xD3, 0xA0, 0x06, 0xC2, 0x70, 0x09, 0x90, 0xC0, 0x0C, 0x40, 0x0E, 0xA0, 0x40,
+0xD0, 0xF0, 0xB0, 0xF4, 0xD1, 0xE0, 0xC0, 0x04, 0xC0, 0x40, 0x90, 0x0A, 0x40, 0xC0, 0x0A, 0xC0,
+0x90, 0x30, 0x06, 0xE1, 0xB0, 0xD1, 0xF2, 0x60, 0x30, 0xA1, 0x50, 0x02, 0x50, 0xB0, 0xA0, 0x60,
+0xD0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x30, 0x50, 0x00, 0x50, 0x40, 0x01, 0x50,
+0x30, 0xE0, 0xB0, 0xD2, 0x30, 0xD0, 0xA0, 0xB0, 0xF1, 0xD3, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0xD0,
+0xF0, 0x61, 0xB0, 0xD0, 0xF2, 0x21, 0xF3, 0x23, 0xF1, 0xD0, 0x60, 0x90, 0x01, 0xC0, 0x80, 0x0F,
+0x08, 0x0F, 0x02, 0x70, 0xC0, 0x02, 0x40, 0x30, 0xA1, 0x80, 0x00, 0x30, 0xB0, 0xF2, 0x20, 0xF0,
+0x21, 0xF2, 0x23, 0xF4, 0xB0, 0x61, 0xF0, 0xD0, 0xF2, 0x26, 0xF5, 0x28, 0xF0, 0xD0, 0xF0, 0x60,
+0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0x21, 0xF0, 0xB0, 0x10, 0x30, 0x90, 0x50,
+0x00, 0xA0, 0x30, 0xA0, 0x90, 0x10, 0xC0, 0x08, 0x90, 0x50, 0x0C, 0x40, 0x00, 0x90, 0x40, 0x06,
+0x41, 0xC0, 0x0A, 0x30, 0x05, 0x90, 0xC0, 0x0D, 0xC0, 0x90, 0x02, 0xC0, 0x30, 0x00, 0x70, 0xE0,
+0xA0, 0x70, 0x10, 0xE0, 0xA0, 0x30, 0xA0, 0x60, 0xD1, 0x70, 0x06, 0xC0, 0x90, 0xA0, 0xC0, 0x09,
+0x40, 0x0C, 0x50, 0xC0, 0x0E, 0x90, 0xA0, 0x60, 0xD0, 0xF2, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xE0,
+0x05, 0xC0, 0x41, 0xC0, 0x07, 0x50, 0x71, 0x0B, 0x70, 0x40, 0x06, 0x50, 0xA0, 0xD0, 0xF0, 0xD0,
+0xF4, 0x60, 0xF1, 0x30, 0xA0, 0x70, 0xA0, 0x30, 0x60, 0xF1, 0x25, 0xF2, 0xD0, 0x30, 0xC0, 0x90,
+0x50, 0x40, 0x30, 0x70, 0x30, 0xB0, 0xD2, 0xB0, 0x60, 0x30, 0x80, 0x30, 0xF1, 0x20, 0xF2, 0x23,
+0xF2, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0xF1, 0x21, 0xF4, 0x20, 0xF0, 0x22, 0xF2, 0xD0, 0xA0,
+0x00, 0x40, 0x30, 0x70, 0x05, 0xA0, 0xC0, 0x0F, 0x00, 0x0F, 0x02, 0x90, 0xE0, 0x40, 0xC0, 0x00,
+0xC0, 0xE0, 0x80, 0x00, 0x50, 0xA0, 0x70, 0xD0, 0xF3, 0x26, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0xD0,
+0xF0, 0x61, 0xF4, 0x24, 0xF3, 0x22, 0xF0, 0x25, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF5, 0x21,
+0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x10, 0x00, 0x50, 0x90, 0xA0, 0x80, 0x11, 0xA0, 0x0A,
+0x50, 0x90, 0x0C, 0x40, 0xC0, 0xA0, 0x05, 0x40, 0x01, 0x40, 0xC0, 0x09, 0xA0, 0x06, 0x40, 0x0E,
+0x40, 0x02, 0xC0, 0x30, 0x00, 0x30, 0xA0, 0x10, 0x80, 0xA0, 0xC0, 0x00, 0x40, 0xE0, 0x60, 0xD1,
+0xA0, 0x06, 0xC0, 0xA0, 0xC0, 0x0A, 0x40, 0x0C, 0x40, 0x0E, 0x40, 0x00, 0x80, 0xE0, 0xD1, 0xF1,
+0x20, 0xD0, 0x70, 0x30, 0xB0, 0x30, 0x05, 0x40, 0x01, 0x40, 0xC0, 0x06, 0x80, 0x10, 0xA0, 0x04,
+0xC0, 0x04, 0x50, 0xA0, 0x40, 0x06, 0x30, 0xB0, 0xD0, 0xF2, 0xD1, 0xB1, 0xD8, 0xF0, 0x25, 0xF2,
+0xD0, 0xB0, 0x30, 0x90, 0x00, 0x80, 0xE0, 0xB0, 0xF0, 0xD1, 0xF1, 0xD0, 0xE0, 0x80, 0x30, 0x80,
+0xD0, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0xD0, 0xB0, 0x61, 0xB0, 0xD1, 0xF5, 0x20, 0xF2, 0x21, 0xF0,
+0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xA1, 0x90, 0x00, 0x40, 0x90, 0x04, 0x81, 0x0F, 0x00, 0x0F, 0x03,
+0xC0, 0xA0, 0x10, 0xE1, 0x70, 0x02, 0x61, 0xD0, 0xF5, 0x25, 0xF4, 0x20, 0xF1, 0x20, 0xF2, 0xB0,
+0x60, 0xF0, 0xD0, 0xF2, 0x2C, 0xF4, 0x20, 0xF1, 0xD0, 0x60, 0xF0, 0x61, 0xD0, 0xF4, 0x22, 0xF0,
+0x24, 0xD1, 0x10, 0xC0, 0x01, 0x82, 0x11, 0x00, 0x40, 0x09, 0x50, 0x40, 0x06, 0xC1, 0x03, 0x40,
+0x30, 0xC0, 0x02, 0xC0, 0x40, 0x03, 0x40, 0x08, 0x50, 0x80, 0x06, 0x51, 0x0D, 0x51, 0x01, 0x50,
+0x30, 0x01, 0x90, 0xA0, 0x10, 0x91, 0x00, 0x40, 0x80, 0xD2, 0x61, 0x05, 0x30, 0x50, 0x0A, 0xC0,
+0x90, 0x0C, 0x90, 0x0D, 0xC0, 0x90, 0x00, 0x30, 0x80, 0xE0, 0x80, 0xD1, 0xF1, 0x70, 0xB0, 0x70,
+0x50, 0x04, 0x40, 0xC0, 0x02, 0x40, 0xC0, 0x04, 0x40, 0xA0, 0x10, 0x04, 0xC0, 0xA0, 0x03, 0x90,
+0x50, 0x40, 0x10, 0xC0, 0x05, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x61, 0x80, 0x60, 0xD2,
+0xF3, 0xD0, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xA0, 0x40, 0x31, 0xD1, 0xF0, 0x20, 0xF2,
+0xD0, 0x60, 0x70, 0xD1, 0xF0, 0x22, 0xF6, 0xD0, 0xF0, 0x61, 0xB0, 0xF0, 0x22, 0xF1, 0x21, 0xF3,
+0x24, 0xF1, 0x22, 0xF0, 0xD0, 0xB0, 0x30, 0x02, 0xA0, 0x00, 0x50, 0x40, 0x90, 0xC1, 0x70, 0x0F,
+0x00, 0x0F, 0x01, 0x30, 0xE0, 0x30, 0xC0, 0x02, 0xE0, 0x80, 0x01, 0x70, 0xD1, 0x20, 0xF0, 0x20,
+0xF2, 0x25, 0xF4, 0x20, 0xF1, 0x21, 0xF2, 0xD0, 0x61, 0xB0, 0xD1, 0x21, 0xF0, 0x27, 0xF3, 0x24,
+0xD0, 0xB1, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x20,
+0xF0, 0xD0, 0xA0, 0x30, 0x90, 0xA0, 0x90, 0x40, 0x81, 0xA0, 0x10, 0x80, 0x0A, 0xC0, 0x40, 0x04,
+0x50, 0x10, 0x50, 0x04, 0x40, 0x70, 0x01, 0xC0, 0x40, 0x05, 0x40, 0x07, 0x40, 0x90, 0x07, 0x40,
+0x0E, 0x90, 0x01, 0xC0, 0x80, 0x03, 0x80, 0xA0, 0x40, 0x01, 0x70, 0x40, 0xB1, 0xD0, 0xA0, 0x05,
+0x30, 0x50, 0x0A, 0x51, 0x0B, 0x50, 0xC0, 0x0D, 0x40, 0x04, 0x80, 0x70, 0xD1, 0xF0, 0xD0, 0x80,
+0x30, 0x40, 0x03, 0x40, 0xC0, 0x04, 0x40, 0x50, 0x02, 0x40, 0x30, 0xE0, 0x30, 0x09, 0x40, 0x50,
+0x00, 0x90, 0x70, 0x10, 0x05, 0xA0, 0xD0, 0xF0, 0xD1, 0xB0, 0xA0, 0x30, 0x80, 0x40, 0x80, 0x70,
+0x30, 0xD0, 0xF4, 0xD0, 0xF6, 0xB0, 0x60, 0xB0, 0xD0, 0xB0, 0xA0, 0xB0, 0xD0, 0xF0, 0x20, 0xF0,
+0x21, 0xF2, 0xD1, 0xF1, 0x22, 0xF5, 0xD0, 0xB0, 0x61, 0xF0, 0xD0, 0xF1, 0x26, 0xF3, 0x24, 0xF1,
+0x23, 0xD1, 0xA0, 0x01, 0x40, 0xE0, 0x71, 0x30, 0xA0, 0x70, 0xE0, 0x10, 0xC0, 0x0E, 0x0F, 0x00,
+0x30, 0x40, 0x00, 0x30, 0x10, 0xA0, 0x00, 0x50, 0x80, 0x50, 0x30, 0xA0, 0x30, 0xD0, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x28, 0xF5, 0x23, 0xF3, 0xB0, 0x60, 0xB0, 0xD1, 0xF1, 0x26, 0xF4, 0x22, 0xF1,
+0x60, 0xF0, 0xD0, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xF5, 0x20, 0xF1, 0x20, 0xF3, 0xB0, 0xE0, 0x70,
+0x01, 0x81, 0x90, 0xA0, 0x80, 0x50, 0x0B, 0x40, 0xC0, 0x02, 0x30, 0x80, 0x06, 0x80, 0xC1, 0x40,
+0x06, 0xC0, 0x90, 0x06, 0x80, 0xC0, 0x07, 0xC0, 0x90, 0x0D, 0x40, 0x01, 0x50, 0x30, 0x03, 0xA0,
+0x10, 0x02, 0x80, 0xA0, 0x70, 0x30, 0xD0, 0x30, 0x50, 0x04, 0x30, 0x50, 0x0A, 0x90, 0xC0, 0x0B,
+0x40, 0x0D, 0x51, 0x05, 0x90, 0xA0, 0xD1, 0x80, 0xA1, 0x70, 0x02, 0x90, 0x50, 0x06, 0x90, 0x50,
+0x00, 0x40, 0xC0, 0x71, 0x07, 0x80, 0x00, 0x40, 0xC0, 0x02, 0xC0, 0x10, 0x30, 0x04, 0x70, 0xD2,
+0x30, 0x80, 0xC0, 0x03, 0x30, 0x10, 0xD0, 0x20, 0xF3, 0x20, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xF3,
+0xD0, 0x60, 0xF2, 0x20, 0xF6, 0xD0, 0x26, 0xF0, 0xD0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0x2F,
+0x06, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xA1, 0x50, 0x90, 0x40, 0x04, 0xC0, 0x0F, 0x00, 0x0F, 0x00,
+0xE0, 0xC0, 0x01, 0x30, 0x40, 0x80, 0x30, 0x02, 0xA0, 0xB0, 0xD0, 0xF3, 0x2B, 0xF1, 0x23, 0xF1,
+0x22, 0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xB0, 0xF4, 0x21, 0xF0, 0x20, 0xF4, 0x20, 0xF1, 0xD0, 0xB1,
+0xD0, 0xF0, 0x21, 0xF2, 0xB0, 0x60, 0x20, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xF2, 0xD0,
+0x60, 0x80, 0x02, 0x50, 0x10, 0x40, 0xA0, 0x30, 0x0D, 0x40, 0xC0, 0x01, 0xA0, 0x90, 0x06, 0x50,
+0x80, 0x90, 0x08, 0x51, 0x05, 0x30, 0xC0, 0x08, 0x40, 0x0D, 0xC0, 0x50, 0x00, 0x50, 0x80, 0x02,
+0xC0, 0x80, 0x30, 0x02, 0x90, 0x40, 0x30, 0xB0, 0xD0, 0x80, 0x40, 0x04, 0x30, 0x50, 0x0A, 0x90,
+0x0B, 0xC0, 0x50, 0x0D, 0x90, 0x07, 0x81, 0xD0, 0xA0, 0x40, 0x00, 0xE0, 0x01, 0x50, 0x90, 0x08,
+0x90, 0x40, 0x01, 0x10, 0x90, 0x07, 0x10, 0x40, 0x01, 0x40, 0x02, 0x90, 0xC0, 0x02, 0xC0, 0x80,
+0x30, 0xD0, 0xB0, 0x30, 0x50, 0x06, 0x30, 0x60, 0xD0, 0xF0, 0x20, 0xF4, 0xD1, 0xB0, 0x60, 0xF0,
+0xD1, 0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0x24, 0xF2, 0xB0, 0x60, 0xB0,
+0xF3, 0x23, 0xF0, 0x22, 0xF1, 0x25, 0xF1, 0x24, 0xF4, 0xB0, 0x70, 0x02, 0x30, 0x03, 0xC2, 0x0E,
+0x0F, 0x00, 0x80, 0x70, 0x40, 0xA0, 0x40, 0x00, 0x70, 0xE0, 0x80, 0x01, 0xA0, 0xD0, 0xF3, 0x22,
+0xF1, 0x27, 0xF0, 0x23, 0xF0, 0x20, 0xF2, 0x21, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0,
+0xF2, 0x25, 0xF3, 0xD0, 0x60, 0xF1, 0x25, 0xD0, 0xB0, 0x60, 0xB0, 0xF8, 0x20, 0xF0, 0xD0, 0xA0,
+0x50, 0x01, 0xC0, 0x11, 0xE0, 0x40, 0x0E, 0x90, 0x50, 0x00, 0x50, 0xC0, 0x06, 0xC0, 0x30, 0x40,
+0x09, 0x90, 0xC0, 0x04, 0xA0, 0x0A, 0x40, 0x0D, 0x40, 0x00, 0x50, 0x80, 0x02, 0xC0, 0x71, 0x02,
+0x40, 0x00, 0xA0, 0x70, 0xE0, 0x40, 0x30, 0x04, 0x30, 0x50, 0x0A, 0x40, 0x0B, 0x90, 0xC0, 0x0C,
+0x90, 0xC0, 0x07, 0x71, 0xA0, 0x10, 0xA0, 0x00, 0x50, 0x00, 0xC0, 0x40, 0x0A, 0x90, 0xC0, 0x50,
+0x10, 0xA0, 0x06, 0xC0, 0x30, 0x50, 0x01, 0x10, 0x30, 0x05, 0xC0, 0xE0, 0x40, 0x50, 0x40, 0x70,
+0xC0, 0x07, 0xA0, 0xB0, 0xF0, 0x23, 0xF0, 0x20, 0xD0, 0xB0, 0x80, 0x70, 0xF4, 0x22, 0xD0, 0x60,
+0xF1, 0x28, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF4, 0x20, 0xF2, 0x20, 0xF4, 0x29, 0xF1, 0x21,
+0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x30, 0xC0, 0x00, 0x40, 0x10, 0x50, 0x00, 0x40, 0xE1, 0x70, 0xE0,
+0xC0, 0x0D, 0x0F, 0x00, 0x50, 0x90, 0x30, 0x40, 0xC0, 0x70, 0xA0, 0x12, 0xE0, 0x80, 0xD1, 0xF2,
+0x23, 0xF0, 0x2F, 0x07, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF1, 0x24, 0xF2, 0xD0, 0xB1, 0xF1,
+0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xB0, 0xD1, 0xF4, 0x20, 0xF0, 0xD0, 0x30,
+0x10, 0x90, 0x00, 0x50, 0x10, 0x80, 0xA0, 0x70, 0x80, 0x30, 0x40, 0x0C, 0x50, 0x40, 0x06, 0xA0,
+0x50, 0x40, 0x00, 0xA0, 0x0A, 0x40, 0xC0, 0x02, 0xC0, 0x30, 0x0A, 0x50, 0xC0, 0x0C, 0x40, 0x00,
+0x50, 0x80, 0x03, 0x11, 0x40, 0x90, 0x00, 0x90, 0x00, 0x80, 0x70, 0x80, 0x31, 0x50, 0x03, 0x30,
+0x50, 0x0A, 0x40, 0x0B, 0x40, 0x0D, 0x40, 0x07, 0xA0, 0x70, 0x01, 0x80, 0x10, 0xC0, 0x01, 0x40,
+0x0C, 0x90, 0x40, 0x80, 0x10, 0x05, 0x91, 0x01, 0xC0, 0x30, 0x12, 0xC0, 0x03, 0x10, 0x91, 0x80,
+0xE0, 0xC0, 0x07, 0x30, 0x60, 0xD0, 0xF0, 0x22, 0xF1, 0x20, 0x60, 0xF0, 0xA0, 0x70, 0xD0, 0xF1,
+0xD0, 0xB0, 0xD0, 0x21, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0xD0, 0xF0, 0x61,
+0xB0, 0xD0, 0xF3, 0x27, 0xF2, 0x2A, 0xF1, 0x20, 0xF2, 0xD0, 0xF1, 0xD0, 0x60, 0xE0, 0x12, 0x40,
+0x30, 0x70, 0xC0, 0x01, 0x90, 0x30, 0x0D, 0x0D, 0xC0, 0xE0, 0xA0, 0xE0, 0x01, 0x50, 0xC0, 0x30,
+0x00, 0xC0, 0x30, 0x10, 0x60, 0xB0, 0xF1, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF6, 0x27, 0xF0, 0x24,
+0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x61, 0xF0, 0xD0, 0xF2, 0x21, 0xF3, 0x60, 0xD0, 0xF0, 0x21, 0xF3,
+0x20, 0xF4, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x70, 0xE0, 0x10, 0x90,
+0x00, 0xE1, 0x10, 0xE0, 0xC0, 0x50, 0x80, 0xA0, 0x30, 0x40, 0xC0, 0x08, 0x31, 0x90, 0x05, 0xC0,
+0x40, 0x01, 0xA0, 0x0B, 0x40, 0x02, 0x90, 0x40, 0x09, 0x10, 0x00, 0x40, 0x0C, 0xC0, 0x50, 0x90,
+0x40, 0x03, 0x80, 0x13, 0x50, 0xC0, 0x01, 0xC0, 0x71, 0x80, 0x03, 0x30, 0x50, 0x08, 0x80, 0x10,
+0x50, 0x0A, 0x51, 0x0C, 0x40, 0x08, 0x50, 0x03, 0x30, 0x10, 0x00, 0x40, 0x0E, 0x50, 0xE0, 0x50,
+0x04, 0x40, 0x50, 0x02, 0x30, 0x10, 0x40, 0x00, 0x50, 0xC0, 0x02, 0x31, 0xB0, 0x80, 0xA0, 0x09,
+0x70, 0xB0, 0x60, 0xD0, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0x20, 0xD0, 0x10, 0x60, 0xD0, 0x20, 0xD0,
+0x60, 0xE0, 0x60, 0xD0, 0x20, 0xF0, 0xD0, 0x60, 0xF6, 0x21, 0xD0, 0x20, 0x61, 0xB0, 0xD0, 0xF1,
+0x20, 0xF5, 0x20, 0xF2, 0x2E, 0xF6, 0xD0, 0xF0, 0xB0, 0x60, 0xE0, 0x30, 0xC0, 0x00, 0xA0, 0x70,
+0x03, 0x70, 0x40, 0x0D, 0x0D, 0x41, 0x00, 0x40, 0x30, 0x00, 0x90, 0x81, 0x02, 0xA0, 0xD0, 0xB1,
+0x60, 0xB0, 0xFA, 0x24, 0xF3, 0x2D, 0xF1, 0xD0, 0xB1, 0x60, 0xF7, 0xB1, 0xF0, 0x21, 0xF7, 0x21,
+0xF2, 0xB0, 0x60, 0x20, 0xF2, 0x20, 0xD0, 0x60, 0x40, 0xC0, 0xE0, 0x10, 0x71, 0x10, 0xE0, 0x70,
+0x50, 0x00, 0xC0, 0x90, 0x50, 0x90, 0x31, 0x40, 0xC0, 0x05, 0xE0, 0x90, 0x00, 0x40, 0xC0, 0x02,
+0xC0, 0x40, 0x02, 0x70, 0x0C, 0x40, 0x01, 0x30, 0xC0, 0x08, 0x50, 0x10, 0xA0, 0xC0, 0x50, 0x0C,
+0x41, 0x90, 0x04, 0xC0, 0x90, 0xE0, 0x10, 0xC0, 0x50, 0x01, 0x90, 0xE0, 0x80, 0x10, 0x03, 0x30,
+0x50, 0x08, 0x40, 0x30, 0xC0, 0x0A, 0x40, 0x0C, 0xC0, 0x90, 0x0D, 0x90, 0x80, 0x90, 0xC0, 0x03,
+0x90, 0x0A, 0x90, 0xC0, 0x03, 0x40, 0xC0, 0x03, 0xC0, 0x06, 0x50, 0xA0, 0x41, 0xA0, 0xC0, 0x05,
+0x80, 0x40, 0x50, 0xA0, 0x90, 0x60, 0xE0, 0xD0, 0xF1, 0x61, 0xF2, 0xD0, 0x70, 0x60, 0xF0, 0x20,
+0xD0, 0x30, 0x50, 0xA0, 0xD0, 0xF0, 0x20, 0xD0, 0xF0, 0x60, 0xD0, 0xF3, 0xD0, 0xF1, 0x61, 0xB0,
+0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0x2A, 0xF7, 0xB0, 0x61, 0xB0, 0xD0,
+0x30, 0xC0, 0x01, 0x40, 0xE0, 0x51, 0x30, 0xE0, 0x80, 0x0E, 0x0D, 0x80, 0x30, 0x01, 0xE0, 0x00,
+0xA1, 0x70, 0x30, 0xC0, 0x40, 0x60, 0xD1, 0xF1, 0xB0, 0x61, 0xB0, 0xD0, 0xF5, 0x25, 0xF2, 0x2E,
+0xF3, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF2, 0xD0, 0xF0, 0x60, 0xF1, 0x21, 0xF5, 0x20, 0xF2, 0x21,
+0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD2, 0x30, 0x90, 0x00, 0xC0, 0x30, 0x10, 0x70, 0x50, 0xE0,
+0x70, 0x03, 0x91, 0x01, 0x40, 0x30, 0xA0, 0x40, 0xC0, 0x02, 0x80, 0x40, 0x01, 0x40, 0xC0, 0x01,
+0x40, 0x03, 0x30, 0x0C, 0xC0, 0x90, 0x00, 0xA0, 0x06, 0x40, 0x00, 0x40, 0x10, 0x51, 0x00, 0x40,
+0x0C, 0x50, 0x40, 0x90, 0x06, 0x30, 0x10, 0x40, 0x90, 0x02, 0x90, 0xE1, 0x40, 0x02, 0x30, 0x50,
+0x08, 0xA0, 0xE0, 0x0B, 0x40, 0x0C, 0x40, 0x0E, 0xC0, 0x30, 0x50, 0x04, 0x10, 0x90, 0x0A, 0x40,
+0x01, 0xC0, 0x40, 0x0D, 0x81, 0xD0, 0x70, 0xC0, 0x05, 0x71, 0x80, 0x30, 0x80, 0xA0, 0xE0, 0x30,
+0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF0, 0xD1, 0x20, 0xF0, 0xD0, 0x70, 0x00, 0x30, 0xF0,
+0xD1, 0xF0, 0xD0, 0x60, 0xF3, 0xD0, 0xB0, 0x61, 0xF1, 0xD0, 0xF1, 0x2C, 0xF1, 0x20, 0xF1, 0x25,
+0xF1, 0x20, 0xF2, 0xD1, 0xB0, 0x61, 0xB0, 0xF2, 0xD0, 0xB0, 0x30, 0xC0, 0x30, 0xA2, 0x70, 0x80,
+0xC1, 0x31, 0x0C, 0x0E, 0xA0, 0x01, 0x81, 0x70, 0xA0, 0x00, 0xC0, 0x80, 0xE0, 0xF0, 0xD0, 0xF0,
+0x21, 0xF0, 0xD1, 0xB0, 0x61, 0xB0, 0xF5, 0x22, 0xF6, 0x2B, 0xF5, 0xD1, 0xB0, 0x60, 0xB0, 0xD1,
+0xB1, 0xF1, 0xD0, 0xF2, 0x20, 0xF2, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xB0,
+0xD1, 0xB0, 0x30, 0x02, 0xC0, 0x30, 0xE0, 0x10, 0x70, 0x04, 0xC0, 0x40, 0xC0, 0x02, 0x90, 0x30,
+0xA0, 0x30, 0x90, 0x04, 0x40, 0x50, 0x40, 0x03, 0x50, 0x80, 0x0D, 0x51, 0x30, 0x06, 0xA0, 0xE0,
+0x30, 0x40, 0x02, 0xC0, 0x40, 0x0B, 0xC0, 0x30, 0x50, 0x06, 0x90, 0x10, 0x30, 0x90, 0x03, 0x10,
+0x71, 0x02, 0x30, 0x50, 0x08, 0x50, 0x90, 0xA0, 0xC0, 0x40, 0x10, 0x80, 0x05, 0x50, 0xC0, 0x0B,
+0x51, 0x0E, 0x50, 0x30, 0x05, 0x80, 0xA0, 0x0B, 0x40, 0x50, 0x40, 0x0D, 0x40, 0xA0, 0xD0, 0x30,
+0x90, 0x04, 0xC0, 0x10, 0x81, 0x30, 0xA0, 0x70, 0x00, 0x80, 0x61, 0xB0, 0xD0, 0xF1, 0x20, 0xF3,
+0x21, 0xF0, 0xD0, 0xA0, 0x00, 0x80, 0xA0, 0x31, 0xD1, 0xB0, 0x60, 0xD1, 0xB0, 0x60, 0xB0, 0xF0,
+0xD0, 0x20, 0xF2, 0x21, 0xF0, 0x28, 0xF1, 0x20, 0xF4, 0x25, 0xF1, 0xD1, 0xB0, 0x61, 0xB0, 0xF0,
+0xD0, 0xF3, 0x20, 0xD0, 0xE0, 0x30, 0xC0, 0x00, 0xA0, 0x03, 0x40, 0x50, 0x80, 0xC0, 0x0B, 0x0F,
+0x02, 0xC0, 0x10, 0x30, 0x80, 0x01, 0xC0, 0xA0, 0xD0, 0x20, 0xF3, 0x20, 0xF3, 0xB0, 0x60, 0xB1,
+0xD1, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF7, 0x26, 0xF0, 0x22, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0,
+0x60, 0xD1, 0xF3, 0x25, 0xF1, 0x20, 0xF3, 0x21, 0xF1, 0xB0, 0x60, 0xB0, 0x40, 0x80, 0x04, 0x70,
+0x10, 0xE0, 0x06, 0x90, 0x50, 0x05, 0x40, 0xA0, 0x30, 0x40, 0x50, 0x01, 0x41, 0x03, 0x41, 0x0E,
+0x90, 0x80, 0x0E, 0x90, 0xC0, 0x0B, 0x30, 0x50, 0x06, 0xC0, 0x10, 0x90, 0x50, 0x02, 0xC0, 0x70,
+0x30, 0x80, 0x02, 0x30, 0x50, 0x09, 0x91, 0x10, 0xE0, 0x40, 0x06, 0x40, 0x0C, 0x40, 0x0E, 0xC0,
+0x90, 0xA0, 0x04, 0x50, 0x10, 0xE0, 0x0B, 0x90, 0x40, 0x0C, 0x50, 0x40, 0xC0, 0xA0, 0x40, 0x30,
+0x02, 0x92, 0x70, 0x03, 0x50, 0xC0, 0x00, 0x81, 0xD3, 0xF2, 0x21, 0xD4, 0xA0, 0x00, 0x80, 0x10,
+0x60, 0x80, 0x30, 0xD1, 0x60, 0xB0, 0x60, 0xB0, 0xF1, 0x20, 0xF0, 0x21, 0xF3, 0x25, 0xF5, 0x20,
+0xF0, 0x24, 0xF3, 0xD0, 0xF1, 0xB0, 0x60, 0xB0, 0x20, 0xF3, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0x30,
+0x50, 0x01, 0x40, 0x50, 0x03, 0x80, 0x40, 0x0C, 0x0F, 0x03, 0x50, 0x30, 0x80, 0xC0, 0x00, 0x80,
+0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0xF1, 0xB0, 0x60, 0xB0, 0xF4, 0x24, 0xF7,
+0x2A, 0xF3, 0xD0, 0xF0, 0x61, 0xB0, 0xF0, 0xD1, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF2, 0x22,
+0xF4, 0x60, 0x30, 0x90, 0x03, 0x40, 0x11, 0x80, 0x07, 0x50, 0x40, 0x04, 0xC0, 0x00, 0xC0, 0x50,
+0x70, 0xA0, 0x80, 0x40, 0x50, 0x90, 0x02, 0xC0, 0x30, 0x0E, 0x50, 0x30, 0xC0, 0x0E, 0x40, 0x0B,
+0x40, 0x50, 0x07, 0xA1, 0x30, 0xC0, 0x01, 0x90, 0x80, 0x90, 0x30, 0x02, 0x30, 0x50, 0x09, 0x40,
+0x90, 0x50, 0x07, 0xC0, 0x90, 0x0B, 0x90, 0x0F, 0x00, 0x40, 0x00, 0x80, 0xC0, 0x03, 0xC0, 0x50,
+0x0B, 0x90, 0x50, 0xC0, 0x90, 0x03, 0x40, 0x80, 0x02, 0xC1, 0x41, 0x00, 0x40, 0x80, 0x70, 0x02,
+0xA0, 0x42, 0x05, 0x50, 0x90, 0x81, 0xD1, 0xA0, 0x60, 0xD0, 0xF2, 0xD0, 0xB0, 0xA0, 0x70, 0xD0,
+0xB0, 0x30, 0x00, 0x70, 0x10, 0x00, 0x80, 0x60, 0xD0, 0xB0, 0x61, 0xD1, 0x20, 0xF0, 0x23, 0xF0,
+0x20, 0xF1, 0x24, 0xF4, 0x20, 0xF2, 0x23, 0xF3, 0x20, 0xB0, 0x61, 0xF0, 0x20, 0xF1, 0x21, 0xF1,
+0x20, 0xF1, 0x20, 0xF0, 0xD0, 0xB0, 0x30, 0x00, 0xC0, 0x80, 0x30, 0x0F, 0x03, 0x0F, 0x04, 0x30,
+0x90, 0x80, 0x30, 0x70, 0xD1, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x21, 0xF3, 0xB0, 0x61, 0xB0,
+0xD0, 0xF1, 0x26, 0xF9, 0x27, 0xF2, 0xD0, 0x60, 0xD0, 0xB0, 0x61, 0xF4, 0x21, 0xF1, 0x22, 0xF0,
+0x24, 0xF1, 0x20, 0xF0, 0xD0, 0x81, 0x50, 0x01, 0x71, 0xE0, 0x70, 0x0A, 0x40, 0x50, 0x01, 0x40,
+0x70, 0x02, 0x30, 0x00, 0x90, 0x80, 0x70, 0xA0, 0x30, 0x90, 0x01, 0xA0, 0xC0, 0x0D, 0x40, 0x50,
+0x40, 0x0E, 0x51, 0x0A, 0x41, 0x07, 0x50, 0x31, 0x50, 0x01, 0x90, 0x80, 0x70, 0x30, 0x02, 0x30,
+0x50, 0x05, 0x90, 0x01, 0xC0, 0x10, 0x40, 0x08, 0x50, 0xC0, 0x0B, 0x40, 0x0E, 0x40, 0x01, 0x90,
+0x40, 0x0F, 0x01, 0x90, 0xC0, 0x01, 0x51, 0x01, 0xC0, 0x10, 0x80, 0xA0, 0x01, 0xE0, 0x70, 0x30,
+0x11, 0x70, 0x81, 0x01, 0x80, 0x40, 0x06, 0xC0, 0x40, 0x50, 0x00, 0x10, 0xE0, 0x80, 0xD0, 0x71,
+0xD3, 0xA1, 0xE0, 0x60, 0xD0, 0x80, 0x90, 0x40, 0x11, 0xC0, 0xA0, 0xB0, 0x60, 0xB0, 0xD0, 0x60,
+0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xFA, 0x23, 0xF2, 0xB0, 0x61, 0xB0, 0x20, 0xD0,
+0xF1, 0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xD1, 0x70, 0xA0, 0x30, 0x50, 0x30, 0x0F, 0x03,
+0x0F, 0x04, 0xA0, 0x02, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x22, 0xF2, 0x20, 0xF1, 0xD0,
+0xF0, 0xB0, 0x60, 0xB1, 0xF0, 0xD0, 0xF3, 0x20, 0xF9, 0x27, 0xF2, 0xB1, 0xF0, 0xD1, 0x20, 0x61,
+0xF0, 0xD0, 0xF2, 0x21, 0xF2, 0x24, 0xD0, 0xF0, 0x22, 0xD0, 0x30, 0x90, 0xC0, 0x40, 0x00, 0xE0,
+0xA0, 0x10, 0x80, 0x0B, 0x90, 0x40, 0x00, 0x10, 0x02, 0x90, 0x41, 0x00, 0x80, 0xC0, 0x00, 0xC0,
+0x80, 0x70, 0x30, 0xA0, 0xE0, 0xC0, 0x0C, 0xA0, 0x01, 0x40, 0x0E, 0x40, 0x0A, 0x81, 0x08, 0x70,
+0x90, 0x30, 0x01, 0x50, 0x70, 0xA0, 0x00, 0x50, 0xC0, 0x00, 0x30, 0x50, 0x04, 0xC0, 0x10, 0x30,
+0x50, 0x70, 0x80, 0x09, 0x40, 0x80, 0x50, 0x09, 0x40, 0x0E, 0x40, 0xC0, 0x02, 0x30, 0x0F, 0x00,
+0x40, 0x80, 0xC0, 0x02, 0x40, 0xC0, 0x01, 0x50, 0x70, 0x50, 0x00, 0x91, 0x03, 0x70, 0xA0, 0x02,
+0x90, 0x40, 0x04, 0xC0, 0x40, 0x50, 0x03, 0xC0, 0x70, 0x90, 0x70, 0xA0, 0xE0, 0x70, 0xA1, 0xD0,
+0x50, 0xA0, 0xD1, 0xB0, 0x30, 0x00, 0x10, 0x70, 0x40, 0x80, 0xB0, 0xD0, 0xF2, 0xB0, 0xF2, 0x20,
+0xF2, 0x23, 0xF5, 0x24, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xD1, 0xF1, 0x20,
+0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x30, 0xC0, 0x01, 0x80, 0x50, 0x0F,
+0x02, 0x0F, 0x03, 0x41, 0x01, 0x40, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x25,
+0xF4, 0xB0, 0x61, 0xB0, 0xD0, 0xF2, 0x27, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60,
+0xF5, 0x20, 0x61, 0xB0, 0xF6, 0x23, 0xF2, 0x22, 0xD0, 0x70, 0x10, 0x01, 0x90, 0x70, 0x11, 0xC0,
+0x0C, 0xC0, 0x40, 0xC0, 0x02, 0x81, 0x01, 0x30, 0x03, 0x90, 0x50, 0x00, 0x90, 0x30, 0xA0, 0x30,
+0x80, 0x90, 0xC0, 0x07, 0xA0, 0x01, 0xC0, 0x40, 0x0D, 0xC0, 0x90, 0x09, 0x80, 0x90, 0x50, 0x07,
+0xE0, 0xA0, 0x80, 0x02, 0x90, 0xC0, 0x00, 0x70, 0x40, 0x00, 0x30, 0x50, 0x05, 0x80, 0x11, 0xA0,
+0x70, 0x08, 0xC0, 0xA1, 0xE0, 0x08, 0x51, 0x0D, 0x90, 0x50, 0x03, 0x30, 0x0D, 0xC0, 0x90, 0x30,
+0xA0, 0x30, 0x03, 0x40, 0x04, 0x40, 0xC0, 0x04, 0xE0, 0x30, 0x02, 0x90, 0x40, 0xC0, 0x02, 0x91,
+0x06, 0x40, 0x30, 0x90, 0xA0, 0xE0, 0x40, 0xD0, 0xE1, 0x90, 0xA0, 0xD0, 0x30, 0x60, 0xA0, 0x90,
+0x30, 0xA0, 0x60, 0xD1, 0xF0, 0x21, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0x27, 0xF0,
+0x20, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF6, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF2,
+0x20, 0xD0, 0x60, 0x80, 0x01, 0x90, 0x80, 0x0F, 0x02, 0x0F, 0x03, 0xA0, 0x80, 0xA0, 0x40, 0xA0,
+0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF5, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0xF0,
+0xB1, 0x60, 0xB0, 0x20, 0xF1, 0x26, 0xF0, 0x24, 0xF2, 0x20, 0xF2, 0x60, 0xF0, 0x22, 0xF1, 0xD0,
+0xF1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x24, 0xF3, 0x22, 0xD0, 0xE0, 0x90, 0x02, 0x50, 0x40,
+0x90, 0x0F, 0x00, 0x90, 0x50, 0x01, 0x30, 0xC0, 0x50, 0xC0, 0xA0, 0x04, 0x50, 0x90, 0x02, 0xC0,
+0x50, 0x40, 0x30, 0xA0, 0x80, 0x40, 0x50, 0xC0, 0x01, 0xC0, 0x80, 0x02, 0x51, 0x0D, 0x40, 0x09,
+0x80, 0x50, 0x40, 0x07, 0x51, 0x40, 0x08, 0x30, 0x50, 0x06, 0xC0, 0x90, 0x40, 0x09, 0x90, 0xA0,
+0x30, 0x70, 0x50, 0x07, 0x90, 0x0D, 0x51, 0x04, 0x30, 0x0C, 0x50, 0x90, 0x50, 0x10, 0x70, 0xE0,
+0x10, 0x40, 0x01, 0xC0, 0x90, 0x01, 0x50, 0x90, 0x05, 0x40, 0xE0, 0x90, 0x00, 0xA0, 0x90, 0xA1,
+0x30, 0x80, 0x50, 0x90, 0xC0, 0x08, 0x30, 0xA0, 0x40, 0x80, 0xA0, 0x81, 0x40, 0xA0, 0x40, 0xB0,
+0xA0, 0x70, 0x80, 0x30, 0xE0, 0x80, 0xD1, 0xF1, 0x21, 0xF0, 0xB1, 0xF0, 0x20, 0xF0, 0x20, 0xF1,
+0x22, 0xF2, 0x26, 0xF1, 0x20, 0xB0, 0x60, 0xB1, 0xF0, 0xD0, 0xF4, 0x21, 0xF0, 0x21, 0xF1, 0x20,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xD0, 0x70, 0x90, 0x31, 0x70, 0x0F, 0x02, 0x0F, 0x02, 0xC0,
+0x30, 0x01, 0x40, 0x70, 0xD0, 0xF0, 0x23, 0xFC, 0x24, 0xF1, 0xD1, 0xF0, 0xB1, 0x60, 0xB0, 0xF5,
+0x26, 0xF5, 0x60, 0xF1, 0x23, 0xF2, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF1, 0x20, 0xF3, 0x20, 0xF1,
+0x21, 0xF0, 0xD0, 0x10, 0x50, 0x04, 0xC0, 0x40, 0x50, 0x0E, 0xC0, 0x40, 0x50, 0x40, 0x00, 0x10,
+0xA0, 0x40, 0x05, 0x50, 0x40, 0x06, 0xC0, 0x90, 0x80, 0x30, 0xA1, 0x30, 0x80, 0x03, 0x50, 0xC0,
+0x0C, 0xC0, 0x40, 0x08, 0x30, 0xC0, 0x90, 0x09, 0x90, 0xC0, 0x07, 0x30, 0x50, 0x30, 0x07, 0x90,
+0x09, 0xA0, 0x80, 0x50, 0x80, 0x40, 0x06, 0x90, 0xC0, 0x0C, 0xC0, 0x40, 0x05, 0x80, 0xC0, 0x0A,
+0x90, 0x50, 0x00, 0xE0, 0x10, 0x80, 0x30, 0x80, 0x50, 0x02, 0x51, 0x90, 0x50, 0x06, 0x70, 0xA0,
+0x00, 0x50, 0x80, 0x10, 0x70, 0x01, 0x80, 0xA0, 0x0B, 0x80, 0x40, 0x80, 0x10, 0x40, 0x31, 0x70,
+0xE0, 0xA0, 0x40, 0x50, 0x00, 0xC0, 0x10, 0x70, 0xD0, 0xF2, 0x20, 0xF2, 0x60, 0xF5, 0x23, 0xF0,
+0x21, 0xF6, 0x61, 0xB0, 0xF0, 0xD0, 0xF2, 0x23, 0xF8, 0x24, 0xF1, 0x21, 0xF0, 0xD0, 0xA0, 0x80,
+0x01, 0x80, 0x50, 0x0F, 0x01, 0x0F, 0x02, 0x90, 0x40, 0x01, 0x50, 0x30, 0xD0, 0xF0, 0x23, 0xF0,
+0x23, 0xF7, 0x24, 0xF1, 0x20, 0xF4, 0xB0, 0x61, 0xF0, 0xD0, 0xF4, 0x22, 0xF0, 0x21, 0xF0, 0x20,
+0xF1, 0x60, 0xD0, 0xF1, 0x23, 0xF4, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF5, 0x20, 0xF0,
+0xD0, 0xA1, 0x07, 0x50, 0x40, 0xC0, 0x0E, 0x30, 0x90, 0x50, 0x81, 0xC0, 0x06, 0xC0, 0x40, 0x0B,
+0x50, 0x80, 0x33, 0x40, 0x80, 0xC0, 0x0C, 0x40, 0xC0, 0x07, 0x30, 0xC1, 0x90, 0x08, 0x50, 0xC0,
+0x07, 0x30, 0x50, 0x10, 0x30, 0x05, 0xC0, 0x90, 0x08, 0x50, 0x80, 0x10, 0x71, 0x40, 0x06, 0x90,
+0x0D, 0x40, 0x04, 0x80, 0x10, 0x81, 0x09, 0x40, 0xC0, 0x02, 0x40, 0x07, 0x40, 0xC0, 0x06, 0x40,
+0x31, 0x00, 0x80, 0x50, 0x01, 0x91, 0x00, 0x80, 0x50, 0x0A, 0x80, 0xC0, 0x30, 0x90, 0x80, 0x40,
+0x80, 0xC0, 0x90, 0x50, 0x02, 0x90, 0x70, 0xD1, 0x20, 0xF0, 0x20, 0xF3, 0x60, 0x20, 0xF4, 0x24,
+0xF3, 0xD0, 0xF0, 0x61, 0xB0, 0xF5, 0x25, 0xF7, 0x25, 0xF1, 0x21, 0xF0, 0xD0, 0x60, 0x40, 0x01,
+0x50, 0x40, 0x0F, 0x01, 0x0F, 0x02, 0x30, 0xA0, 0x40, 0x00, 0x30, 0xB0, 0xD0, 0x24, 0xF1, 0x24,
+0xF6, 0x27, 0xF3, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD1, 0xF0, 0x24, 0xF3, 0xB1, 0xD0, 0xF0,
+0x26, 0xF1, 0x20, 0xD0, 0xF2, 0xB0, 0x61, 0xF2, 0xD0, 0xF3, 0xD0, 0xA0, 0x10, 0xE0, 0x08, 0x91,
+0xC0, 0x0B, 0x90, 0x70, 0x02, 0x50, 0x80, 0x04, 0x50, 0xC0, 0x01, 0x40, 0xC0, 0x0F, 0x00, 0x50,
+0x40, 0x80, 0x70, 0x30, 0x81, 0x40, 0x90, 0x50, 0x06, 0x40, 0x07, 0x30, 0xC0, 0x00, 0x40, 0x08,
+0xC0, 0x50, 0x07, 0x70, 0xE1, 0x10, 0x05, 0xC0, 0x50, 0x08, 0x90, 0x50, 0xA0, 0xE0, 0x70, 0xC0,
+0x05, 0x40, 0xC0, 0x0C, 0x40, 0x05, 0x40, 0x12, 0xA0, 0x06, 0xC0, 0x40, 0xC0, 0x0D, 0x40, 0x06,
+0x30, 0xA0, 0xC0, 0x00, 0xA0, 0x00, 0x91, 0x02, 0x90, 0x40, 0x0A, 0x90, 0x10, 0x70, 0x01, 0xC0,
+0x51, 0x03, 0x90, 0xE0, 0xD1, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0xB1, 0xF4, 0x21, 0xF0, 0x20, 0xF1,
+0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF3, 0x27, 0xF7, 0x26, 0xF1, 0x22, 0xF0, 0xB0, 0xA0,
+0x00, 0x40, 0x30, 0x70, 0x0F, 0x01, 0x0F, 0x02, 0xA0, 0x00, 0x90, 0x30, 0x70, 0xD1, 0xF2, 0x21,
+0xF1, 0x29, 0xF5, 0x26, 0xF2, 0xD2, 0xB1, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF1,
+0x60, 0xF4, 0x26, 0xF0, 0x20, 0xF2, 0xD1, 0xB0, 0x61, 0xF2, 0xD0, 0xF0, 0xD1, 0x70, 0xC0, 0x30,
+0xE0, 0xC0, 0x07, 0xC0, 0x40, 0x50, 0x09, 0x50, 0x90, 0x30, 0x03, 0xA0, 0x04, 0x10, 0x40, 0x02,
+0x90, 0x50, 0x0F, 0x02, 0x90, 0x00, 0xC0, 0x50, 0x90, 0x40, 0x80, 0x30, 0xA0, 0x30, 0x80, 0x41,
+0x50, 0x40, 0x50, 0x06, 0x30, 0x01, 0x90, 0xC0, 0x08, 0x90, 0x07, 0x70, 0xE3, 0x04, 0x50, 0xC0,
+0x08, 0x40, 0x09, 0xC0, 0x90, 0x0C, 0x90, 0xC0, 0x07, 0xC0, 0x70, 0xA0, 0x05, 0xC0, 0x40, 0x0F,
+0x00, 0x51, 0x04, 0xC0, 0xE0, 0x70, 0x00, 0xC0, 0x30, 0x90, 0xC0, 0x04, 0xA0, 0x0A, 0x50, 0x10,
+0x40, 0x50, 0x80, 0xA0, 0x10, 0x03, 0x50, 0x70, 0xF0, 0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xF1, 0x60,
+0xF8, 0x20, 0xB0, 0x60, 0xB1, 0xF0, 0xD0, 0xF2, 0x27, 0xF5, 0x2B, 0xF2, 0x20, 0xF1, 0xD0, 0xA1,
+0x90, 0xC0, 0xA0, 0x0F, 0x01, 0x0F, 0x01, 0x50, 0x80, 0x01, 0x50, 0x30, 0xD0, 0xF3, 0x22, 0xF1,
+0x29, 0xF8, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF3, 0xB0, 0x61, 0xB0, 0xF5, 0xB1, 0xF2, 0x20, 0xF0,
+0x27, 0xF0, 0x20, 0xF3, 0xD0, 0x20, 0xF0, 0x61, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x30, 0x01, 0x50,
+0xA0, 0x09, 0x50, 0x40, 0xC0, 0x07, 0x40, 0x50, 0x80, 0x03, 0xA0, 0x03, 0x50, 0x10, 0x90, 0x03,
+0x91, 0x0F, 0x01, 0xC0, 0x40, 0x07, 0xC0, 0x50, 0x90, 0xE0, 0x81, 0x31, 0xA1, 0x30, 0x80, 0x40,
+0x70, 0x90, 0xC1, 0x90, 0x08, 0x90, 0x07, 0x71, 0x12, 0x04, 0x90, 0xC0, 0x07, 0x51, 0x03, 0x90,
+0xC0, 0x03, 0x40, 0x0C, 0x90, 0x50, 0x09, 0x30, 0x05, 0x51, 0x0F, 0x02, 0x40, 0x04, 0xE0, 0x10,
+0x01, 0x80, 0x90, 0x06, 0x80, 0x50, 0x09, 0x70, 0xA0, 0x80, 0xA0, 0x71, 0xC0, 0x03, 0x70, 0xD1,
+0xF0, 0x26, 0xF2, 0xB1, 0xF3, 0xD1, 0xB0, 0x61, 0xB0, 0xFA, 0x20, 0xF8, 0x2C, 0xF2, 0x21, 0xF0,
+0xD0, 0x80, 0x40, 0x01, 0x41, 0x0F, 0x00, 0x0F, 0x01, 0x41, 0x01, 0x80, 0x60, 0xD1, 0xF1, 0x22,
+0xF3, 0x29, 0xF8, 0x25, 0xF0, 0x22, 0xF1, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xD0, 0xF0, 0xD0, 0x60,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x26, 0xF6, 0x20, 0xF2, 0x61, 0xF0, 0xD0, 0x80, 0x90, 0x02, 0xA0,
+0x0B, 0x90, 0x40, 0xC0, 0x04, 0x40, 0x00, 0x40, 0x50, 0x03, 0x70, 0x04, 0x50, 0x05, 0x50, 0x40,
+0x0F, 0x01, 0x50, 0x90, 0x09, 0xA0, 0x00, 0xC0, 0x50, 0x02, 0xC0, 0x50, 0x90, 0x40, 0x81, 0x30,
+0x80, 0xA0, 0x36, 0xA0, 0x34, 0x82, 0x30, 0xE0, 0x30, 0xE1, 0x50, 0x04, 0x40, 0x01, 0x50, 0x80,
+0x04, 0x40, 0x03, 0x80, 0x11, 0xE0, 0x80, 0xA0, 0x30, 0xA0, 0x0B, 0x51, 0x0A, 0x80, 0x50, 0x03,
+0x90, 0x50, 0x30, 0x50, 0x01, 0x80, 0x0E, 0x40, 0x02, 0x90, 0x70, 0x00, 0x92, 0x40, 0x06, 0xC0,
+0x80, 0x08, 0x30, 0x60, 0x70, 0xE0, 0x10, 0xE0, 0x03, 0xC0, 0xE0, 0xB0, 0xD0, 0xF0, 0x21, 0xF0,
+0x23, 0xF2, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0xD0, 0xF0, 0x61, 0xB0, 0xF0, 0xD1, 0xF5, 0x25, 0xF7,
+0x29, 0xF3, 0x20, 0xF5, 0x90, 0x30, 0x01, 0x50, 0x30, 0x0F, 0x00, 0x0F, 0x01, 0x31, 0xA0, 0x80,
+0x70, 0xB0, 0xD0, 0xF0, 0xD1, 0xF0, 0x22, 0xF1, 0x20, 0xF7, 0x2A, 0xF4, 0x25, 0xF4, 0x20, 0xB0,
+0x61, 0xB0, 0x60, 0xD1, 0xF0, 0x20, 0xF0, 0x27, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0xD0, 0xF2, 0xB0,
+0x60, 0xA0, 0x03, 0x30, 0x0D, 0x91, 0x02, 0xC0, 0x90, 0x00, 0xA0, 0x04, 0xC0, 0xA0, 0x0B, 0xC0,
+0x40, 0x0F, 0x01, 0x90, 0x50, 0x08, 0xA0, 0x01, 0x90, 0xC0, 0x08, 0x50, 0xC0, 0x07, 0x50, 0x80,
+0x90, 0x00, 0xC1, 0x50, 0xC0, 0x40, 0xA1, 0xE0, 0x02, 0x70, 0xE0, 0x01, 0x90, 0x01, 0x80, 0xE0,
+0xC0, 0x02, 0xC0, 0x90, 0x02, 0xC0, 0x11, 0x30, 0x60, 0xB1, 0x60, 0xB0, 0xA0, 0x09, 0xC0, 0x90,
+0x0B, 0x41, 0x02, 0x40, 0x50, 0x00, 0xE0, 0x70, 0x90, 0x30, 0x10, 0xC0, 0x0D, 0x90, 0xC0, 0x02,
+0x50, 0x90, 0x01, 0x41, 0x07, 0x70, 0x05, 0x91, 0xA0, 0x60, 0x50, 0x30, 0x80, 0x50, 0x30, 0x02,
+0x40, 0x10, 0xD1, 0xF0, 0x23, 0xF4, 0x21, 0xF0, 0xD0, 0x60, 0xB1, 0x60, 0xB0, 0xF5, 0x20, 0xF1,
+0x21, 0xF7, 0x2A, 0xF5, 0x20, 0xF0, 0x22, 0xF0, 0xD1, 0xF2, 0x90, 0xA0, 0x80, 0xA0, 0x30, 0xA0,
+0x0F, 0x00, 0x0F, 0x01, 0xA0, 0x01, 0xC0, 0x70, 0xB0, 0x60, 0xB1, 0xF6, 0x20, 0xF8, 0x29, 0xF0,
+0x22, 0xF1, 0x25, 0xF6, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF4, 0x25, 0xF1, 0x20, 0xF0, 0x21, 0xF2,
+0x20, 0xF2, 0xD0, 0x60, 0x80, 0x90, 0x50, 0x01, 0x30, 0x40, 0xC0, 0x51, 0x0A, 0xC0, 0x40, 0x50,
+0x00, 0x40, 0x00, 0xC0, 0x30, 0x05, 0x80, 0x50, 0x0C, 0x40, 0xC0, 0x0F, 0x00, 0x90, 0xC0, 0x07,
+0x30, 0x02, 0x40, 0x09, 0x90, 0x07, 0xC0, 0x40, 0x80, 0x05, 0xC0, 0x50, 0x31, 0x40, 0xC0, 0x40,
+0x10, 0xE0, 0x80, 0x50, 0x07, 0x90, 0xC0, 0x00, 0xC0, 0x30, 0xE0, 0x10, 0x40, 0xD2, 0xB1, 0xD0,
+0xA0, 0xC0, 0x07, 0xC0, 0x40, 0x0C, 0xC0, 0x80, 0x00, 0xC0, 0xA0, 0xC0, 0x01, 0x10, 0x70, 0x10,
+0x71, 0x50, 0x0E, 0x40, 0x00, 0x50, 0x40, 0xC0, 0x02, 0x30, 0xC0, 0x07, 0x80, 0xA0, 0x80, 0x01,
+0xC0, 0x90, 0x70, 0xE0, 0x30, 0xD0, 0x60, 0xA0, 0x03, 0xC0, 0xE1, 0xD1, 0xF0, 0x23, 0xF5, 0xD0,
+0xF1, 0xB0, 0x61, 0xB0, 0xF4, 0x20, 0xF2, 0x22, 0xF5, 0x2B, 0xFD, 0xD0, 0xF0, 0xB1, 0x60, 0xB0,
+0x70, 0x50, 0x01, 0xA0, 0x0F, 0x00, 0x0F, 0x00, 0x50, 0x80, 0x01, 0x90, 0x80, 0xD0, 0xF1, 0xB0,
+0x61, 0xB0, 0xF5, 0x21, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x27, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x23,
+0xF3, 0x20, 0xF0, 0xD0, 0x60, 0xF0, 0xB0, 0x61, 0xF1, 0xD0, 0xF2, 0x25, 0xF0, 0x22, 0xF2, 0x20,
+0xF2, 0xD1, 0xA0, 0x01, 0x50, 0x40, 0x50, 0x00, 0x90, 0x80, 0x40, 0x80, 0xA0, 0xC0, 0x07, 0x90,
+0x01, 0x50, 0x40, 0x50, 0x00, 0x41, 0x05, 0x50, 0x80, 0x0D, 0x40, 0x50, 0x0E, 0x50, 0x30, 0x06,
+0xC0, 0x30, 0x01, 0xC0, 0x40, 0x09, 0x40, 0x08, 0x80, 0x40, 0x00, 0xC0, 0x51, 0x91, 0x41, 0x50,
+0x40, 0x80, 0xA0, 0x30, 0x80, 0x11, 0x80, 0x07, 0x40, 0x01, 0x30, 0xA0, 0xE0, 0x30, 0xB0, 0xD1,
+0xF0, 0x60, 0xF0, 0xD0, 0xB0, 0xA0, 0x07, 0x40, 0x0D, 0xC0, 0x70, 0xC0, 0x40, 0x50, 0x03, 0x51,
+0x00, 0x10, 0x70, 0x01, 0x80, 0x0B, 0x50, 0x40, 0x50, 0x04, 0x80, 0x90, 0x09, 0xA0, 0xC0, 0x40,
+0x51, 0x70, 0x60, 0xD1, 0x70, 0x03, 0x80, 0x10, 0x70, 0xB0, 0xD0, 0xF0, 0x24, 0xF5, 0xB0, 0x61,
+0xB0, 0xD0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0x22, 0xF4, 0x22, 0xF1, 0x24,
+0xF1, 0x21, 0xF6, 0xD0, 0xF1, 0xB0, 0x61, 0xB0, 0xF1, 0xD0, 0x80, 0x40, 0x01, 0x40, 0x90, 0x0E,
+0x0F, 0x00, 0x80, 0x70, 0x80, 0x50, 0x80, 0xB0, 0xD0, 0xF2, 0xD1, 0xF0, 0xB0, 0x61, 0xB0, 0xF0,
+0xD1, 0xF7, 0x21, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x28, 0xF1, 0x22, 0xF1, 0x60, 0xD0,
+0xF0, 0xD1, 0xB0, 0x61, 0xB0, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0x21, 0xF0, 0xD0, 0x81,
+0x03, 0x50, 0x40, 0x90, 0x02, 0xC0, 0x31, 0xA1, 0x33, 0x70, 0x10, 0xC0, 0x01, 0x90, 0x50, 0x90,
+0x80, 0x50, 0x06, 0xA0, 0x50, 0x0D, 0x91, 0x07, 0x40, 0x50, 0x80, 0x30, 0x80, 0xA0, 0x11, 0x40,
+0x05, 0xC0, 0x80, 0x70, 0x11, 0xE0, 0x80, 0x08, 0xC0, 0x50, 0x04, 0xC0, 0x91, 0x81, 0x90, 0x51,
+0xC0, 0x01, 0xC1, 0x01, 0xC1, 0x52, 0x40, 0x71, 0x80, 0x02, 0x80, 0x00, 0xC0, 0x50, 0x01, 0xA0,
+0x40, 0xE0, 0x70, 0x30, 0x70, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0x30, 0xA0, 0x40, 0xA0, 0x70,
+0x50, 0x01, 0x40, 0xC0, 0x0D, 0xC0, 0x70, 0x90, 0x09, 0x40, 0x00, 0x30, 0xE0, 0x0A, 0x40, 0x90,
+0x40, 0x05, 0x90, 0x80, 0x08, 0x50, 0x80, 0xE1, 0x30, 0x70, 0xB0, 0xD1, 0xA1, 0x02, 0xC0, 0x10,
+0x60, 0xD1, 0xF1, 0x23, 0xF1, 0xD1, 0xF0, 0x61, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0xF1, 0x23,
+0xF1, 0x2A, 0xF4, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF6, 0xD0, 0x20, 0xB0, 0x61, 0xB1, 0xF0, 0xD1,
+0xF2, 0xD0, 0xA0, 0x50, 0x80, 0xA0, 0x30, 0x0E, 0x0F, 0x00, 0x30, 0x00, 0xC0, 0x40, 0xE0, 0xD1,
+0xF2, 0x20, 0xF2, 0xD1, 0xB0, 0x62, 0xB0, 0xF0, 0xD0, 0xF4, 0x27, 0xF0, 0x2C, 0xF1, 0x22, 0xF0,
+0xB1, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF3, 0x24, 0xF2, 0x21, 0xD1,
+0xA0, 0x06, 0xC0, 0x40, 0x90, 0xC0, 0x09, 0xC0, 0x80, 0xA0, 0x30, 0x40, 0xC0, 0x00, 0x80, 0x40,
+0x07, 0x70, 0x40, 0x0D, 0x50, 0x40, 0x06, 0x40, 0x10, 0xA0, 0x40, 0xA1, 0xC0, 0x70, 0x50, 0x40,
+0x04, 0xC0, 0x80, 0x03, 0x10, 0xA0, 0xC0, 0x07, 0x90, 0x00, 0xC0, 0x50, 0x41, 0x50, 0xC0, 0x00,
+0x50, 0x40, 0x05, 0x50, 0x70, 0x10, 0x08, 0x90, 0x31, 0x70, 0x32, 0xA0, 0x80, 0xE1, 0x11, 0xB0,
+0xD1, 0x32, 0xF0, 0xD2, 0xA0, 0x70, 0xD0, 0x30, 0x90, 0x00, 0x40, 0xC0, 0x0E, 0x50, 0x80, 0x30,
+0x0B, 0x30, 0x90, 0x08, 0x50, 0x40, 0x02, 0x40, 0x04, 0x80, 0x90, 0x06, 0x90, 0x40, 0xC0, 0x01,
+0x70, 0x30, 0xD2, 0xB0, 0x10, 0xC0, 0x03, 0xE0, 0xD0, 0xF3, 0x21, 0xF3, 0xB0, 0x60, 0xB0, 0x20,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xB1, 0xD0, 0x25, 0xF0, 0x2F, 0x02, 0xF0, 0x21, 0xF3, 0xD0, 0xF0,
+0xB1, 0x61, 0xB0, 0xF0, 0xD2, 0xF5, 0xD0, 0xE0, 0x80, 0x50, 0x00, 0xA0, 0x0E, 0x08, 0x50, 0x05,
+0xA0, 0x02, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xF1, 0xD1, 0xF1, 0xB0, 0x61, 0xB1,
+0x20, 0xF2, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0x2A, 0xF0, 0x23, 0xF0, 0x60, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF2, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF2, 0x22, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0x80,
+0x08, 0xC0, 0x91, 0xC0, 0x0A, 0x40, 0x90, 0x80, 0xA0, 0x70, 0x50, 0x40, 0x50, 0x05, 0x30, 0x50,
+0x0E, 0xC0, 0x40, 0x05, 0xC0, 0x40, 0x04, 0x50, 0x00, 0x50, 0x90, 0x03, 0x90, 0x40, 0x03, 0xE0,
+0xA0, 0xC0, 0x07, 0x41, 0x90, 0xC0, 0x05, 0x70, 0x04, 0xC0, 0xE0, 0x10, 0x40, 0x0A, 0x50, 0xC0,
+0x50, 0x91, 0x50, 0xE0, 0x40, 0x80, 0xE0, 0xB0, 0xD0, 0xF0, 0xD0, 0x60, 0xF0, 0x60, 0x70, 0x30,
+0xF0, 0xD0, 0x61, 0xD0, 0x30, 0x40, 0x51, 0x0E, 0x40, 0x50, 0x00, 0x10, 0x50, 0x0F, 0x04, 0xC0,
+0x40, 0xC0, 0x03, 0x90, 0xC0, 0x03, 0xA0, 0x05, 0x90, 0x40, 0xC0, 0x03, 0x40, 0x10, 0xE0, 0xD1,
+0x10, 0x90, 0x03, 0x40, 0x30, 0xD0, 0xF0, 0xD0, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB1, 0xF2, 0x22,
+0xF2, 0xD0, 0x60, 0xF1, 0x23, 0xF1, 0x27, 0xF0, 0x22, 0xF0, 0x22, 0xF4, 0xD0, 0x20, 0xB1, 0x61,
+0xB0, 0xF1, 0xD1, 0xF7, 0x20, 0xF0, 0xD0, 0x30, 0xC0, 0x01, 0x80, 0xC0, 0x0D, 0x07, 0x82, 0x03,
+0xC0, 0xA0, 0x01, 0x50, 0x30, 0xD0, 0xF1, 0x23, 0xF4, 0x21, 0xF1, 0xD0, 0xF0, 0xB1, 0x61, 0xB1,
+0xD1, 0xF3, 0x21, 0xF1, 0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF2, 0x22, 0xF0, 0x20, 0x60, 0xF1, 0x21,
+0xF0, 0x20, 0xF6, 0xB0, 0x61, 0xB0, 0xF0, 0xD2, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x70, 0x0B,
+0xC0, 0x90, 0x40, 0xC0, 0x07, 0x90, 0xC0, 0x02, 0x30, 0x50, 0x00, 0x50, 0x40, 0xC0, 0x03, 0xA0,
+0x08, 0xC0, 0x50, 0x05, 0xC0, 0x40, 0x0E, 0x90, 0x50, 0x02, 0x40, 0x90, 0x04, 0x10, 0x80, 0x90,
+0x80, 0x70, 0xC0, 0x00, 0xC0, 0x40, 0x90, 0xC0, 0x08, 0x30, 0xC0, 0x03, 0xC0, 0x80, 0x40, 0x0E,
+0x40, 0xA0, 0x80, 0x60, 0xF0, 0xD2, 0xF0, 0xD0, 0xB1, 0xD2, 0x60, 0x70, 0xA0, 0xF0, 0xD2, 0x31,
+0x0E, 0x40, 0xC0, 0x01, 0x50, 0xE0, 0x0F, 0x03, 0x40, 0x50, 0x06, 0x40, 0x02, 0x50, 0xE0, 0x02,
+0xC0, 0x91, 0xC0, 0x04, 0xC0, 0xE0, 0x60, 0xB0, 0xD1, 0x10, 0x04, 0x30, 0xB0, 0xD1, 0xF0, 0xD1,
+0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF2, 0x21, 0xF3, 0x20, 0xD0, 0xB1, 0xF0, 0x22, 0xF2, 0x21, 0xF2,
+0x20, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xD2, 0xF0, 0xB0, 0x61, 0xB1, 0xF0, 0xD0, 0xF2, 0x20, 0xF4,
+0x24, 0xF0, 0xD0, 0x80, 0x40, 0x01, 0x80, 0x90, 0x0D, 0x07, 0x80, 0x40, 0x30, 0x03, 0x40, 0x80,
+0x31, 0x70, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x2C, 0xF1, 0xD2, 0xB1, 0x61, 0xB0, 0xF1, 0xD0, 0xF6,
+0x20, 0xF3, 0x20, 0xF3, 0x21, 0xF0, 0xB1, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x21, 0xF0,
+0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0xB0, 0xA0, 0x0E, 0x90,
+0x40, 0xC0, 0x05, 0x40, 0x04, 0xA0, 0x02, 0x90, 0x40, 0x01, 0x41, 0x08, 0xC0, 0x10, 0x07, 0x40,
+0xC0, 0x0D, 0x90, 0xC0, 0x01, 0x80, 0x50, 0x05, 0x40, 0x70, 0x30, 0x40, 0x50, 0x40, 0x90, 0x0B,
+0x40, 0x90, 0x04, 0xC1, 0x0D, 0xA0, 0x30, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0xA1, 0x10, 0xD0,
+0x20, 0xF1, 0xD0, 0x60, 0xA1, 0xB0, 0xD0, 0x80, 0x30, 0x0C, 0xC0, 0x40, 0x04, 0xC0, 0x70, 0x0F,
+0x00, 0x90, 0x40, 0x01, 0xC0, 0x90, 0x04, 0x90, 0xC0, 0x00, 0x80, 0x10, 0x01, 0xC0, 0x40, 0x90,
+0x06, 0x40, 0xE0, 0xB0, 0xD2, 0xF0, 0x10, 0x03, 0x50, 0x10, 0xD0, 0xF0, 0xD0, 0x20, 0x61, 0xB0,
+0xF0, 0xD1, 0xF2, 0x23, 0xF0, 0x20, 0xF3, 0xB1, 0xF0, 0x22, 0xF2, 0x20, 0xF3, 0x20, 0xF9, 0xB0,
+0x61, 0xB1, 0xF0, 0xD0, 0xF6, 0x23, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x70, 0x31, 0x81,
+0x0D, 0x08, 0x50, 0x04, 0xA0, 0x02, 0xA0, 0xD0, 0xF1, 0x26, 0xF0, 0x23, 0xF1, 0x20, 0xF5, 0xD1,
+0xF1, 0x62, 0xB0, 0xF0, 0xD1, 0xF5, 0x22, 0xF6, 0xB0, 0xF3, 0x21, 0xF3, 0x22, 0xF1, 0x21, 0xF0,
+0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF2, 0xD1, 0x30, 0x50, 0x0F, 0x01, 0x50, 0x40, 0x50, 0x02, 0x40,
+0x05, 0xA0, 0x04, 0x40, 0x50, 0x80, 0x40, 0x09, 0x80, 0xC0, 0x07, 0x90, 0x50, 0x0D, 0x40, 0x01,
+0x30, 0x07, 0x90, 0x00, 0x90, 0x50, 0x0D, 0x41, 0x04, 0xC0, 0x50, 0x40, 0x71, 0x09, 0x30, 0x60,
+0xD0, 0xF4, 0xB0, 0x60, 0xA0, 0x80, 0xA0, 0xD1, 0xF3, 0xD1, 0xB0, 0x70, 0x30, 0x80, 0xA0, 0x50,
+0x0A, 0x50, 0x90, 0x06, 0x50, 0xA0, 0x83, 0x40, 0x07, 0x50, 0x40, 0x03, 0xE1, 0x05, 0x90, 0xC0,
+0x80, 0x30, 0xC0, 0x40, 0x90, 0x05, 0xC0, 0x40, 0xE0, 0x10, 0xD1, 0x21, 0xF1, 0x60, 0x40, 0x01,
+0x50, 0xA0, 0x80, 0xD0, 0xB0, 0x61, 0xF0, 0xD0, 0xF5, 0x26, 0xF4, 0x60, 0xF6, 0x22, 0xF5, 0xD1,
+0xF0, 0xB0, 0x62, 0xB0, 0xF0, 0xD1, 0xF5, 0x2D, 0xF2, 0xD0, 0xA0, 0x02, 0xA0, 0x0D, 0x08, 0x90,
+0x40, 0x50, 0x02, 0x30, 0x02, 0xA0, 0xD0, 0xF3, 0x27, 0xF0, 0x25, 0xF2, 0x20, 0xF3, 0xD0, 0xF1,
+0xB1, 0x60, 0xB1, 0xF7, 0x23, 0xF2, 0x60, 0xD0, 0xF3, 0x20, 0xF0, 0x22, 0xF1, 0x24, 0xF2, 0xD0,
+0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xB0, 0xA0, 0x0F, 0x04, 0x50, 0x40, 0x50, 0xC0, 0x90, 0x04, 0x80,
+0x90, 0x05, 0x50, 0x30, 0xC0, 0x0F, 0x05, 0x50, 0x90, 0x0D, 0x40, 0x00, 0xA0, 0x07, 0x41, 0x0F,
+0x00, 0x41, 0x04, 0xC0, 0x50, 0x00, 0xC1, 0x08, 0x40, 0x30, 0xD1, 0xF0, 0xD0, 0xF1, 0xD1, 0x70,
+0x31, 0x40, 0xD1, 0xF0, 0x20, 0xF1, 0xD2, 0xB0, 0x60, 0x70, 0x30, 0xE0, 0x09, 0x91, 0x08, 0xC0,
+0x53, 0x40, 0xA0, 0xC0, 0x50, 0x02, 0xC0, 0x40, 0x50, 0x40, 0xA1, 0x40, 0x00, 0xE0, 0x80, 0x04,
+0xC0, 0x40, 0xA0, 0x81, 0x90, 0x06, 0x40, 0x10, 0x70, 0x10, 0xB0, 0xD0, 0xF2, 0x20, 0xD1, 0x71,
+0x50, 0x80, 0xA0, 0x61, 0xB0, 0xF0, 0xD0, 0xF8, 0x24, 0xF3, 0x20, 0xF0, 0x60, 0xF4, 0x20, 0xF8,
+0xB1, 0x61, 0xB0, 0xF1, 0xD0, 0xF4, 0x21, 0xF0, 0x2F, 0x00, 0xF2, 0xD0, 0x30, 0xC0, 0x01, 0x30,
+0x0D, 0x07, 0xE0, 0x31, 0x70, 0xE0, 0x40, 0x00, 0xE0, 0xA0, 0x40, 0x90, 0xA0, 0xD0, 0x20, 0xF2,
+0x2F, 0x07, 0xF3, 0xD0, 0xF1, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF1, 0xD0, 0x24, 0xF1, 0xB0, 0xF8,
+0x20, 0xF3, 0x25, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0x30, 0x90, 0x0F, 0x06, 0xC0, 0x40, 0xC0, 0x03,
+0x90, 0x30, 0x06, 0xC0, 0x70, 0xA0, 0x80, 0xC0, 0x0F, 0x04, 0x50, 0x40, 0x0C, 0xC0, 0x40, 0x30,
+0x05, 0x50, 0x40, 0x00, 0x40, 0x0F, 0x00, 0x90, 0x40, 0x04, 0xC0, 0x50, 0x0A, 0x80, 0x30, 0xD0,
+0x60, 0xB1, 0xD2, 0x40, 0x70, 0x50, 0x90, 0x10, 0x70, 0x30, 0x60, 0xD1, 0xF0, 0xD0, 0xF0, 0x60,
+0x80, 0x70, 0x30, 0xE0, 0xA1, 0xC0, 0x07, 0x90, 0x50, 0x0F, 0x00, 0x50, 0x71, 0x40, 0x00, 0x40,
+0x50, 0xC0, 0xA0, 0x40, 0x01, 0x30, 0x03, 0xC0, 0x50, 0x80, 0xA0, 0x80, 0x40, 0x80, 0x40, 0x50,
+0x80, 0x06, 0x80, 0x30, 0x10, 0xB0, 0xD1, 0xF4, 0xD0, 0xF0, 0x60, 0x31, 0xB0, 0xF0, 0xD0, 0xF3,
+0x25, 0xF5, 0x21, 0xF4, 0xB1, 0xD0, 0xF0, 0x23, 0xF1, 0xD1, 0xF0, 0xB0, 0x61, 0xB1, 0xF0, 0xD0,
+0xF3, 0x2A, 0xF4, 0x27, 0xF2, 0xD0, 0x80, 0x41, 0xA0, 0xE0, 0x50, 0x0C, 0x06, 0x40, 0x80, 0x03,
+0xA0, 0x80, 0x40, 0x00, 0x50, 0xA0, 0x80, 0xF0, 0x21, 0xF1, 0x21, 0xF3, 0x2F, 0x02, 0xF6, 0xD0,
+0xF0, 0xB1, 0x61, 0xB0, 0xF1, 0x22, 0xF1, 0x60, 0xF2, 0x22, 0xF5, 0x29, 0xF3, 0xD0, 0xA0, 0x10,
+0x50, 0x41, 0xC0, 0x0F, 0x04, 0x40, 0x04, 0xE0, 0x08, 0x50, 0xC0, 0x80, 0x40, 0x90, 0x0F, 0x04,
+0xC0, 0x40, 0x0C, 0x50, 0x30, 0x04, 0x40, 0x50, 0x01, 0x51, 0xC0, 0x0D, 0x50, 0x80, 0x04, 0xC0,
+0x50, 0x09, 0x31, 0x40, 0x70, 0xA0, 0x10, 0xB0, 0xD0, 0x30, 0xA0, 0x80, 0x01, 0x81, 0x00, 0xC0,
+0x30, 0x60, 0xD1, 0xB0, 0x70, 0x30, 0x90, 0xC0, 0x00, 0x70, 0xE0, 0x11, 0x80, 0x04, 0xC0, 0x90,
+0xC0, 0x0F, 0x04, 0xA0, 0x70, 0xA2, 0x03, 0x70, 0x00, 0xC0, 0x40, 0xE0, 0x10, 0x80, 0xC0, 0x02,
+0x90, 0x80, 0x00, 0xA0, 0x06, 0x40, 0xE0, 0xB0, 0xD0, 0xF3, 0xD1, 0x20, 0x61, 0xB0, 0xD2, 0xF4,
+0x23, 0xF0, 0x23, 0xF0, 0x23, 0xF6, 0x60, 0xD0, 0xF2, 0x21, 0xF0, 0xB0, 0x61, 0xB1, 0xF0, 0xD0,
+0xF3, 0x2D, 0xF7, 0x24, 0xF2, 0x20, 0xF0, 0x60, 0x70, 0x90, 0x00, 0x50, 0x40, 0x0C, 0x06, 0xC0,
+0xE0, 0x50, 0x02, 0x80, 0xA0, 0x50, 0x01, 0x80, 0xB0, 0xD0, 0xF3, 0x20, 0xFA, 0x20, 0xF0, 0x20,
+0xF0, 0x27, 0xF2, 0x20, 0xF8, 0xB0, 0x61, 0xB1, 0x20, 0xD1, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x23,
+0xF0, 0x27, 0xF3, 0x21, 0xF0, 0xD0, 0x60, 0x30, 0x03, 0x90, 0x40, 0x90, 0xC0, 0x0F, 0x00, 0x50,
+0xC0, 0x02, 0xC0, 0x70, 0xC0, 0x0A, 0x80, 0xC0, 0x00, 0x40, 0x50, 0x0F, 0x04, 0x40, 0xC0, 0x0A,
+0xC0, 0x30, 0x50, 0x01, 0x50, 0x40, 0x04, 0x90, 0x40, 0x10, 0x0C, 0x50, 0x80, 0x04, 0xC0, 0x50,
+0x08, 0x80, 0x70, 0xA0, 0x80, 0x00, 0x50, 0x10, 0x30, 0xA0, 0x40, 0x02, 0x40, 0x04, 0x80, 0x70,
+0xA1, 0x51, 0x05, 0x40, 0x11, 0x71, 0xA0, 0x70, 0x80, 0x70, 0x11, 0xE0, 0x70, 0xA0, 0x30, 0x0C,
+0x50, 0x40, 0x07, 0x30, 0xE0, 0xA0, 0x30, 0x51, 0x10, 0xC0, 0x04, 0xA0, 0x00, 0x40, 0x90, 0x03,
+0x50, 0x71, 0x90, 0xD1, 0xF0, 0xD1, 0xF0, 0xB0, 0x61, 0x20, 0xF2, 0xD0, 0x21, 0xF3, 0x29, 0xF1,
+0x22, 0xF2, 0x21, 0xF0, 0x60, 0xD0, 0xF1, 0xB1, 0x61, 0xB0, 0xF0, 0xD0, 0xF5, 0x21, 0xF4, 0x20,
+0xF0, 0x24, 0xF1, 0x23, 0xF4, 0x20, 0xF4, 0x20, 0xF1, 0xB0, 0x30, 0x01, 0xC0, 0x80, 0x00, 0x40,
+0x90, 0x00, 0x31, 0x06, 0x07, 0x90, 0x70, 0xE0, 0x71, 0x30, 0xA0, 0x90, 0xC0, 0x00, 0xA0, 0xD1,
+0xF2, 0x21, 0xFF, 0x06, 0x23, 0xF0, 0x24, 0xF5, 0xD0, 0xB1, 0x61, 0xB0, 0x60, 0xF0, 0xD0, 0xF0,
+0x2C, 0xF5, 0x21, 0xF1, 0x70, 0x06, 0xC0, 0x90, 0x40, 0x50, 0x0D, 0x40, 0x03, 0xA0, 0xC0, 0x0B,
+0xC0, 0x30, 0x01, 0xC0, 0x40, 0xC0, 0x0F, 0x03, 0x90, 0x50, 0x09, 0x50, 0x40, 0x90, 0xC0, 0x51,
+0x05, 0xC0, 0x90, 0x10, 0x0C, 0xC0, 0x30, 0x04, 0xC0, 0x50, 0x08, 0xA0, 0x04, 0xC0, 0x50, 0x70,
+0x02, 0x51, 0x05, 0xC0, 0x40, 0xC0, 0x90, 0x02, 0x90, 0x50, 0x00, 0x50, 0xC0, 0xE0, 0x11, 0xA0,
+0x31, 0xE0, 0x80, 0x30, 0x10, 0x80, 0xD1, 0x80, 0x30, 0x09, 0xC0, 0x40, 0x50, 0x06, 0xC0, 0xA0,
+0x50, 0xC0, 0x02, 0xC0, 0x10, 0x50, 0x03, 0x30, 0x80, 0x00, 0xC0, 0x80, 0x02, 0x50, 0x10, 0x70,
+0x90, 0xD1, 0xF1, 0xB0, 0x61, 0xF1, 0xD0, 0xF0, 0x20, 0xF2, 0x23, 0xF4, 0x20, 0xF0, 0x29, 0xF1,
+0xD0, 0xF2, 0x60, 0xB0, 0x61, 0xB0, 0xF4, 0x21, 0xF1, 0x22, 0xF2, 0x22, 0xF9, 0x24, 0xF2, 0x21,
+0xF4, 0xD0, 0x20, 0xF0, 0xD0, 0x70, 0x00, 0xC0, 0x50, 0xA0, 0x30, 0xA1, 0xE0, 0x40, 0x30, 0x80,
+0x05, 0x0A, 0x50, 0xC0, 0x00, 0xA0, 0x40, 0x30, 0xA0, 0x70, 0xD0, 0xF3, 0x21, 0xF3, 0x27, 0xFA,
+0x26, 0xF0, 0x25, 0xF2, 0xD2, 0xB0, 0x62, 0xB0, 0xF0, 0xD0, 0xF3, 0x23, 0xF4, 0x21, 0xF3, 0xD0,
+0xB0, 0x30, 0x09, 0x50, 0x90, 0x40, 0xC0, 0x09, 0x51, 0x02, 0x90, 0x80, 0x0D, 0xA0, 0x03, 0x90,
+0x40, 0x0F, 0x03, 0x50, 0x90, 0x08, 0x90, 0x40, 0x00, 0x80, 0x50, 0x07, 0x90, 0x10, 0x0D, 0xA0,
+0xC0, 0x03, 0xC0, 0x50, 0x02, 0x50, 0x30, 0x03, 0xA0, 0x06, 0xC0, 0x30, 0xA0, 0x81, 0x07, 0xC0,
+0x80, 0x00, 0xC0, 0x50, 0x70, 0x30, 0xA1, 0xE0, 0x31, 0x80, 0xE0, 0x70, 0x30, 0xE0, 0x10, 0x40,
+0xC0, 0x10, 0x30, 0xD2, 0xA0, 0x30, 0x07, 0x91, 0x08, 0x70, 0xC0, 0x05, 0xE0, 0x80, 0x02, 0x50,
+0x80, 0x00, 0x90, 0x00, 0xA0, 0x02, 0x70, 0x10, 0xD2, 0xB0, 0x61, 0xB0, 0xF3, 0x24, 0xF9, 0x27,
+0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xB0, 0x63, 0xF0, 0xD2, 0xF1, 0x2E, 0xFF, 0x02, 0x22, 0xF3, 0x20,
+0xF1, 0xD0, 0xA0, 0x70, 0x30, 0x40, 0xE0, 0x70, 0x01, 0x70, 0x00, 0xC0, 0xA0, 0x05, 0x06, 0xA0,
+0x10, 0xE0, 0x80, 0x10, 0x70, 0xC0, 0x80, 0x01, 0x50, 0x30, 0xD0, 0xF1, 0x24, 0xF2, 0x28, 0xF8,
+0x29, 0xF0, 0x22, 0xF3, 0x21, 0xD0, 0x60, 0xF0, 0xD1, 0xB0, 0x62, 0xB0, 0xF0, 0xD0, 0xF8, 0x21,
+0xF3, 0xD0, 0x60, 0x30, 0x0C, 0x50, 0x41, 0xC0, 0x06, 0x40, 0x04, 0xA0, 0xC0, 0x0C, 0x70, 0x90,
+0x04, 0x40, 0x90, 0x0F, 0x02, 0xC0, 0x40, 0x07, 0x40, 0x70, 0x31, 0xA1, 0x31, 0x80, 0x40, 0x90,
+0x50, 0xC1, 0xA0, 0x0D, 0x40, 0x90, 0x03, 0xC0, 0x50, 0x02, 0x30, 0x10, 0xC0, 0x02, 0x70, 0x09,
+0x41, 0xA1, 0x30, 0x80, 0x04, 0x40, 0x30, 0xA0, 0x30, 0x60, 0xD1, 0x11, 0xE0, 0x51, 0x40, 0x80,
+0x70, 0x60, 0x50, 0x60, 0xA0, 0x10, 0x60, 0xD1, 0xF0, 0xD0, 0x30, 0x10, 0xC0, 0x03, 0x90, 0x40,
+0xC0, 0x08, 0x80, 0x50, 0x06, 0x40, 0xE0, 0x02, 0xC0, 0x30, 0x00, 0x40, 0x00, 0x41, 0x00, 0x90,
+0xA0, 0xC0, 0xD0, 0x61, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x20, 0xFB,
+0x20, 0xF4, 0x20, 0xB0, 0x62, 0xB0, 0xF0, 0xD1, 0x60, 0xF5, 0x22, 0xF0, 0x2C, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x22, 0xF3, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0x90,
+0x01, 0x40, 0xE0, 0x00, 0xC0, 0xE1, 0x10, 0x90, 0x05, 0x05, 0xC0, 0xA0, 0x00, 0x80, 0x30, 0x00,
+0x40, 0x70, 0x80, 0xC0, 0x00, 0x40, 0x60, 0xD0, 0xF1, 0x24, 0xF2, 0x2F, 0x04, 0xF2, 0x24, 0xF0,
+0x20, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0xF5, 0x20, 0xB1, 0x61, 0xB0, 0xF0, 0xD1, 0xF4,
+0x20, 0xF3, 0xD0, 0xA0, 0x0F, 0x01, 0x90, 0x40, 0x50, 0xC0, 0x03, 0x90, 0x04, 0xA0, 0x0E, 0x70,
+0x05, 0xC0, 0x30, 0xA0, 0x80, 0x40, 0x90, 0xC0, 0x0C, 0xC0, 0x40, 0xC0, 0x05, 0x40, 0x80, 0x04,
+0xC0, 0x50, 0x90, 0x40, 0x80, 0x31, 0x71, 0x33, 0x87, 0x40, 0x30, 0x40, 0x03, 0xC0, 0x50, 0x03,
+0xC0, 0x02, 0x31, 0x08, 0xC0, 0x90, 0x03, 0x40, 0xA0, 0x01, 0x50, 0x11, 0x70, 0x40, 0xD0, 0xA1,
+0x80, 0x90, 0x00, 0x90, 0xA0, 0x30, 0x80, 0xD1, 0x30, 0x70, 0xF0, 0xD1, 0x30, 0xA0, 0xB0, 0xD2,
+0x30, 0x40, 0x01, 0x50, 0x40, 0xC0, 0x09, 0xC0, 0x70, 0x07, 0x80, 0xA0, 0x02, 0x50, 0x80, 0x00,
+0x90, 0xC1, 0x30, 0x00, 0x40, 0x30, 0x61, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0,
+0x21, 0xF0, 0x21, 0xF0, 0x26, 0xF0, 0x21, 0xF0, 0xD1, 0xF0, 0xB0, 0x62, 0xB0, 0x20, 0xD1, 0xF1,
+0x20, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF3, 0x20, 0xF1, 0x2F, 0x03, 0xF0, 0x24,
+0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xB0, 0x80, 0x01, 0x40, 0xA0, 0xE1, 0x90, 0xC0, 0x50, 0x06, 0x05,
+0xC0, 0xE0, 0x50, 0xE0, 0x90, 0x00, 0x50, 0xE0, 0x12, 0xE0, 0x60, 0xD3, 0xF0, 0x21, 0xF2, 0x2F,
+0x03, 0xF0, 0x21, 0xF8, 0x21, 0xF2, 0x21, 0xF1, 0x60, 0xF2, 0x23, 0xF3, 0xB0, 0x61, 0xB0, 0xF9,
+0xD0, 0x70, 0x0F, 0x03, 0xC0, 0x90, 0x40, 0x50, 0x00, 0x90, 0x04, 0x50, 0x30, 0x0E, 0xA0, 0x40,
+0x50, 0x90, 0x50, 0x00, 0x90, 0x71, 0xC0, 0x80, 0x41, 0x80, 0xA0, 0x30, 0x80, 0x40, 0x50, 0xC0,
+0x08, 0x40, 0xC0, 0x04, 0x80, 0xC0, 0x0B, 0x30, 0x80, 0x02, 0xC4, 0x54, 0x70, 0x90, 0x03, 0xC0,
+0x50, 0x06, 0x80, 0x90, 0x09, 0x40, 0x05, 0x90, 0x80, 0x00, 0xA0, 0x40, 0x60, 0xD1, 0x60, 0xB0,
+0xD0, 0x30, 0xE0, 0x01, 0x40, 0xC0, 0x80, 0x70, 0xF0, 0xD0, 0xB0, 0xA0, 0xD1, 0x60, 0xE0, 0xA0,
+0xD3, 0x70, 0x40, 0x90, 0x50, 0x0A, 0x50, 0x10, 0x40, 0x07, 0x50, 0xE0, 0x02, 0x41, 0x01, 0x90,
+0x00, 0x30, 0x90, 0x30, 0x40, 0xD2, 0xF1, 0x23, 0xF5, 0xD0, 0xF2, 0x24, 0xF6, 0xB0, 0x61, 0xB0,
+0xF7, 0x21, 0xF0, 0xB1, 0xF1, 0x22, 0xF5, 0x21, 0xF6, 0x2F, 0x05, 0xF3, 0xD1, 0xF2, 0xE0, 0x12,
+0x80, 0xC0, 0xA0, 0xE0, 0x72, 0x50, 0x04, 0x06, 0x50, 0xA0, 0x40, 0xE0, 0x80, 0xE0, 0x30, 0x40,
+0x80, 0x70, 0xE0, 0x62, 0xB1, 0xF2, 0xD0, 0xF1, 0x22, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x22, 0xF1, 0x20, 0xFF, 0x00, 0x20, 0xF0, 0x20, 0xF1, 0xB1, 0xF0, 0x20, 0xF0, 0x24, 0xF5, 0xB1,
+0x61, 0xB0, 0xF1, 0xD0, 0xF2, 0xD0, 0x70, 0xC0, 0x07, 0x80, 0xC0, 0x0A, 0x50, 0x90, 0x80, 0xC0,
+0x03, 0x80, 0x50, 0x0E, 0x90, 0xA0, 0x80, 0x40, 0x80, 0x30, 0x81, 0x70, 0x01, 0x50, 0x90, 0x02,
+0x50, 0x41, 0x80, 0x30, 0xA0, 0x30, 0x80, 0x90, 0xC0, 0x03, 0x90, 0xC0, 0x02, 0x40, 0x30, 0xC0,
+0x0B, 0x10, 0x80, 0x50, 0x0A, 0x40, 0x80, 0x04, 0xC0, 0x50, 0x06, 0xE0, 0x09, 0xC0, 0x50, 0x06,
+0xA0, 0xC0, 0x31, 0x60, 0xD0, 0xF0, 0xD0, 0x60, 0x80, 0x30, 0xC1, 0x40, 0x02, 0x40, 0xA0, 0xD1,
+0x70, 0xF0, 0xD1, 0x30, 0x70, 0xE0, 0xD1, 0x90, 0xA0, 0x80, 0x40, 0x80, 0x09, 0x30, 0x10, 0x30,
+0x09, 0xA0, 0xC0, 0x01, 0x40, 0x50, 0x00, 0xC0, 0x80, 0x90, 0x50, 0x30, 0x70, 0xD0, 0xF1, 0xD0,
+0xF3, 0x22, 0xF2, 0x20, 0xF5, 0x20, 0xF2, 0xD1, 0xF0, 0xB0, 0x61, 0xB1, 0xF5, 0x21, 0xF2, 0x21,
+0xF0, 0xB1, 0xF1, 0x20, 0xF0, 0x20, 0xFF, 0x00, 0x28, 0xF0, 0x23, 0xF0, 0x22, 0xF5, 0xB1, 0x61,
+0xB0, 0xE0, 0x70, 0x30, 0x40, 0x30, 0x70, 0x40, 0x02, 0x90, 0x30, 0x04, 0x05, 0x50, 0xE0, 0x30,
+0x00, 0xC0, 0x80, 0x00, 0x30, 0x02, 0x70, 0xD1, 0xF1, 0xB0, 0x64, 0xB0, 0x20, 0xF0, 0xD0, 0xFB,
+0x22, 0xF9, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xF2, 0x29, 0xF1, 0xD0, 0xF2, 0xB0, 0x62,
+0xB0, 0xF0, 0xD1, 0x70, 0x30, 0xA0, 0x80, 0x05, 0x10, 0xC0, 0x0C, 0x90, 0x50, 0x41, 0xC0, 0x00,
+0xA0, 0x0F, 0x07, 0x50, 0x30, 0x00, 0xE0, 0x80, 0x00, 0x40, 0x90, 0x07, 0x50, 0x40, 0x80, 0x31,
+0xA0, 0x31, 0xA0, 0x40, 0x50, 0x40, 0x00, 0x30, 0x0B, 0xC0, 0x10, 0x30, 0x90, 0x0A, 0x90, 0x30,
+0x04, 0xC0, 0x50, 0x06, 0x41, 0x08, 0x40, 0x07, 0x70, 0xA0, 0x80, 0x10, 0xD0, 0x20, 0xD1, 0x30,
+0x70, 0x50, 0xC0, 0x40, 0x03, 0x80, 0xA0, 0xD1, 0x30, 0x60, 0xD2, 0x70, 0xA0, 0x10, 0x31, 0xE0,
+0x00, 0x80, 0xE0, 0x40, 0x05, 0x80, 0x11, 0xE0, 0x10, 0x70, 0x09, 0x80, 0x70, 0x01, 0x90, 0x80,
+0x40, 0x51, 0xC0, 0x00, 0x40, 0x70, 0xD0, 0xF2, 0xD0, 0xF5, 0x22, 0xF5, 0xD0, 0xF2, 0xB1, 0x61,
+0xB0, 0xF1, 0xD1, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF1, 0x60, 0xD0, 0x20, 0xF0, 0x20, 0xF2,
+0x23, 0xF2, 0x20, 0xF5, 0x24, 0xF1, 0x20, 0xF6, 0xD0, 0xF1, 0xB1, 0x63, 0xB0, 0xF1, 0xD1, 0x70,
+0x02, 0x30, 0xA0, 0x03, 0x80, 0x30, 0x04, 0x04, 0xC0, 0x70, 0xC0, 0x40, 0xE0, 0x01, 0x71, 0x50,
+0x01, 0xA0, 0xD0, 0xF3, 0x21, 0xF2, 0xB0, 0x62, 0xB2, 0xF1, 0xD1, 0xF2, 0x29, 0xF1, 0x2A, 0xF0,
+0x20, 0xF0, 0x60, 0xD0, 0xF9, 0x23, 0xF5, 0xD0, 0xF0, 0xB0, 0x62, 0xA0, 0x01, 0x50, 0x31, 0x40,
+0xC0, 0x01, 0xE0, 0xC0, 0x0B, 0x40, 0x03, 0x90, 0x40, 0x30, 0x0F, 0x07, 0x40, 0x90, 0x00, 0x30,
+0x70, 0x01, 0xC0, 0x40, 0x50, 0x0D, 0x50, 0x40, 0x81, 0x71, 0x0C, 0x50, 0xA0, 0x00, 0x90, 0x0A,
+0x40, 0xA0, 0x03, 0xC0, 0x50, 0x06, 0x90, 0x40, 0x07, 0x50, 0xC0, 0x07, 0x90, 0x71, 0xA0, 0xD0,
+0xF0, 0xD0, 0x60, 0xA0, 0x10, 0x80, 0x50, 0x05, 0xA0, 0xD1, 0x60, 0xA0, 0xD0, 0xF0, 0xD0, 0xA0,
+0xC0, 0x40, 0x50, 0x91, 0x00, 0xE0, 0xA0, 0xC0, 0x03, 0xC0, 0x70, 0x10, 0x80, 0x10, 0x80, 0x40,
+0x70, 0x0A, 0x80, 0x90, 0x42, 0x02, 0x90, 0x00, 0xA0, 0x30, 0xD0, 0xF1, 0x22, 0xF2, 0x21, 0xF6,
+0xD0, 0xF0, 0xB1, 0x61, 0xB0, 0xF0, 0xD1, 0xF5, 0x20, 0xF3, 0x21, 0xF3, 0x20, 0xF1, 0x60, 0xF2,
+0x25, 0xF1, 0x21, 0xF2, 0x29, 0xF2, 0xD1, 0xF1, 0xB1, 0x63, 0xB0, 0xF2, 0x20, 0xF0, 0xD0, 0xF2,
+0xD0, 0xA0, 0x01, 0xC0, 0x70, 0xA1, 0x30, 0x70, 0x10, 0x30, 0x05, 0x04, 0x50, 0xA0, 0x01, 0x30,
+0x80, 0x50, 0xA1, 0x40, 0x30, 0x70, 0x30, 0xD0, 0x20, 0xF1, 0x23, 0xF1, 0xD1, 0xF1, 0xB2, 0x62,
+0xB2, 0x20, 0xF0, 0xD0, 0xF3, 0x26, 0xF0, 0x29, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF8, 0x21,
+0xF3, 0x21, 0xF0, 0x20, 0xD2, 0xF0, 0xB0, 0x30, 0x91, 0x50, 0x00, 0xC0, 0x50, 0x30, 0xA0, 0x40,
+0xC0, 0x0C, 0x40, 0x04, 0x41, 0x50, 0x40, 0x50, 0x0F, 0x04, 0x80, 0x50, 0x01, 0xC0, 0x03, 0x50,
+0x40, 0xC0, 0x0C, 0x51, 0x00, 0xC0, 0x80, 0x0C, 0x10, 0x40, 0x00, 0x90, 0xC0, 0x09, 0xC0, 0x30,
+0x03, 0xC0, 0x50, 0x06, 0x80, 0x50, 0x06, 0xC0, 0x40, 0x08, 0xA1, 0x10, 0x60, 0xD0, 0xF0, 0xB0,
+0x70, 0x00, 0x40, 0x50, 0x90, 0x05, 0xA0, 0xF0, 0xD1, 0x70, 0xD1, 0x30, 0x80, 0x50, 0x09, 0x90,
+0xA0, 0x30, 0x41, 0x30, 0x40, 0x70, 0x90, 0x70, 0x08, 0x50, 0x90, 0x80, 0x40, 0x00, 0xC0, 0x80,
+0x02, 0x40, 0xA0, 0xC0, 0xE0, 0x60, 0xD0, 0xF0, 0x22, 0xF7, 0xD0, 0xF1, 0xB0, 0x61, 0xB1, 0xF1,
+0xD0, 0xF4, 0x21, 0xF7, 0x20, 0xF3, 0x20, 0xF0, 0xD0, 0xB0, 0xF2, 0x20, 0xF0, 0x26, 0xF0, 0x26,
+0xF3, 0xD0, 0xF0, 0x20, 0xB2, 0x62, 0xB1, 0xF2, 0xD1, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x80,
+0x70, 0x30, 0x80, 0xA0, 0xC0, 0x90, 0x40, 0x50, 0xC0, 0x00, 0xC0, 0x04, 0x05, 0x70, 0x80, 0x01,
+0x70, 0x80, 0x30, 0x40, 0x01, 0x40, 0x80, 0xD0, 0xF3, 0x22, 0xF1, 0x20, 0xF9, 0xB1, 0x62, 0xB1,
+0xF0, 0xD1, 0xF4, 0x21, 0xF0, 0x22, 0xF2, 0x24, 0xB0, 0xD0, 0x23, 0xF5, 0x21, 0xF3, 0x21, 0xF0,
+0x22, 0xF0, 0xD1, 0x60, 0x30, 0x01, 0xC0, 0x50, 0x91, 0xC1, 0x40, 0x80, 0xA0, 0x40, 0xC0, 0x08,
+0xC0, 0x50, 0x04, 0x30, 0xC0, 0x01, 0x50, 0x90, 0x40, 0xC0, 0x0F, 0x01, 0x30, 0xC0, 0x08, 0x90,
+0x40, 0x0A, 0x50, 0x90, 0x01, 0x90, 0x40, 0x09, 0x50, 0x70, 0xE0, 0x10, 0x02, 0x40, 0x09, 0xC0,
+0x80, 0x03, 0xC0, 0x50, 0x06, 0x80, 0x50, 0x06, 0x90, 0xC0, 0x07, 0x50, 0xE0, 0x80, 0xA0, 0xD0,
+0xF0, 0xD0, 0x80, 0x60, 0x02, 0x51, 0x04, 0xA0, 0xF0, 0xD1, 0x30, 0x60, 0xB0, 0x30, 0xC0, 0x08,
+0x80, 0xA0, 0x30, 0x90, 0xD0, 0x60, 0x30, 0xA1, 0x81, 0x70, 0x05, 0xC0, 0x91, 0x50, 0x00, 0xC0,
+0x80, 0x00, 0xC0, 0xA0, 0x90, 0x30, 0xA0, 0x80, 0x40, 0x00, 0xA0, 0xB0, 0xF2, 0x20, 0xF3, 0xD1,
+0xF1, 0xB0, 0x61, 0xB1, 0x22, 0xF2, 0x28, 0xF6, 0x20, 0xF3, 0x20, 0xF1, 0xB1, 0xF0, 0x23, 0xF1,
+0x27, 0xF5, 0xB1, 0x62, 0xB2, 0x20, 0xF8, 0x23, 0xF4, 0xD0, 0x60, 0x80, 0x01, 0x40, 0x90, 0x03,
+0x81, 0x40, 0x03, 0x06, 0x50, 0x01, 0x90, 0x10, 0x30, 0x50, 0x01, 0x80, 0xB0, 0xD0, 0xF9, 0x28,
+0xF2, 0xD1, 0xF0, 0xB1, 0x63, 0xB1, 0xF9, 0xD0, 0xF0, 0x21, 0xF0, 0xB1, 0xD0, 0x29, 0xF5, 0x23,
+0xF3, 0xD0, 0xA0, 0xC0, 0x05, 0x50, 0x91, 0x50, 0xC0, 0x50, 0x32, 0x50, 0x05, 0x90, 0xC0, 0x04,
+0xA0, 0x05, 0x50, 0x40, 0x90, 0xC0, 0x0D, 0xA0, 0x0A, 0xC0, 0x40, 0x90, 0x08, 0x40, 0x02, 0x40,
+0x90, 0x09, 0x90, 0x40, 0x10, 0x40, 0x02, 0x51, 0x08, 0xC0, 0x80, 0x03, 0xC0, 0x50, 0x06, 0x30,
+0x90, 0x05, 0xC0, 0x90, 0x08, 0x90, 0x10, 0x50, 0x30, 0xD0, 0xF1, 0x80, 0x40, 0x03, 0x40, 0xC0,
+0x02, 0x90, 0x30, 0xD0, 0xF0, 0xD0, 0x60, 0x30, 0xD0, 0xA0, 0x08, 0xA0, 0x40, 0x80, 0xA2, 0x80,
+0xB0, 0xD1, 0x80, 0x30, 0x03, 0xC0, 0x90, 0x40, 0x90, 0x04, 0x70, 0xA0, 0x30, 0x80, 0x40, 0xC0,
+0x01, 0x90, 0x00, 0xE0, 0x60, 0xD3, 0xF1, 0xD0, 0xF0, 0xB0, 0x62, 0xB0, 0xF0, 0xD0, 0xF1, 0x2B,
+0xF8, 0x23, 0xF1, 0x21, 0xF1, 0xB0, 0xF0, 0x21, 0xFB, 0x20, 0xB0, 0x63, 0xB1, 0xF0, 0xD2, 0xF3,
+0x25, 0xF1, 0x22, 0xF3, 0x20, 0xF0, 0xD1, 0xA0, 0x01, 0xC0, 0x80, 0x03, 0x30, 0x90, 0x80, 0x03,
+0x0B, 0x80, 0x30, 0x80, 0x40, 0xA0, 0xB0, 0xD0, 0xF5, 0x26, 0xF0, 0x22, 0xF8, 0xD2, 0xF2, 0xB0,
+0x62, 0xB2, 0xF0, 0xD1, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xF2, 0x2F, 0x04, 0xF0, 0xD1, 0x60, 0x30,
+0x0A, 0x50, 0x91, 0x51, 0x80, 0x10, 0x80, 0x40, 0xC0, 0x01, 0x40, 0x05, 0x30, 0x08, 0x90, 0x40,
+0x90, 0xC0, 0x09, 0xC0, 0x30, 0x0C, 0xC0, 0x40, 0xC0, 0x05, 0x40, 0x03, 0x80, 0x50, 0x0B, 0xA1,
+0x03, 0x40, 0x08, 0xC0, 0x80, 0x03, 0xC0, 0x50, 0x07, 0x70, 0x10, 0xC0, 0x03, 0x40, 0x0B, 0x90,
+0x80, 0xD0, 0xF0, 0xD0, 0x30, 0x50, 0x04, 0x40, 0x02, 0xA0, 0x40, 0x30, 0x70, 0xA0, 0xB0, 0x70,
+0xD0, 0xA0, 0x07, 0xA0, 0x60, 0xA0, 0x80, 0x40, 0x33, 0xA1, 0x40, 0x02, 0x50, 0x40, 0x90, 0xC0,
+0x06, 0xA0, 0x06, 0x90, 0x00, 0x90, 0x30, 0x80, 0x60, 0x10, 0x60, 0xB1, 0x61, 0xB0, 0xF0, 0xD1,
+0xF3, 0x26, 0xF1, 0x20, 0xF4, 0x2A, 0xF1, 0x20, 0xF2, 0x60, 0xD0, 0xF0, 0x20, 0xF2, 0xD1, 0xF0,
+0xB2, 0x62, 0xB0, 0xF1, 0xD3, 0xF7, 0x29, 0xF3, 0xD0, 0xF3, 0xD0, 0x70, 0x40, 0x80, 0x30, 0xA0,
+0x03, 0xC0, 0x40, 0x04, 0x0B, 0x30, 0xC1, 0x50, 0x70, 0xD0, 0xF0, 0x20, 0xF7, 0x25, 0xF1, 0x22,
+0xF1, 0x20, 0xF1, 0x22, 0xF3, 0xD2, 0xF1, 0xB1, 0x62, 0xB1, 0xF0, 0x20, 0xD1, 0x60, 0xD0, 0xF1,
+0x20, 0xF2, 0x24, 0xF0, 0x20, 0xF2, 0x23, 0xF2, 0xD0, 0xF0, 0x70, 0xC0, 0x0D, 0xC0, 0x50, 0x40,
+0x80, 0x90, 0x40, 0x31, 0x41, 0x04, 0x40, 0x90, 0x0A, 0xC0, 0x90, 0x40, 0x50, 0x00, 0xC0, 0x50,
+0x04, 0x80, 0x40, 0x0E, 0x50, 0x40, 0xC0, 0x02, 0x51, 0x03, 0x80, 0xC0, 0x0C, 0xC0, 0x03, 0xC0,
+0x50, 0x07, 0xC0, 0x80, 0x03, 0xC0, 0x50, 0x08, 0x50, 0x70, 0x40, 0x01, 0x51, 0x08, 0x90, 0x01,
+0x40, 0x30, 0xD0, 0xF0, 0xB0, 0xA0, 0x05, 0xC0, 0x90, 0x00, 0x80, 0x40, 0x30, 0x80, 0xC0, 0x41,
+0xA0, 0xB0, 0xA0, 0xC0, 0x05, 0x50, 0x30, 0x50, 0xE0, 0xA0, 0x80, 0x50, 0xC1, 0x50, 0xC0, 0x01,
+0xC0, 0x40, 0x90, 0xC0, 0x09, 0xA0, 0x05, 0xC0, 0x40, 0xC0, 0x01, 0xA0, 0x90, 0x31, 0xB1, 0xF0,
+0xD1, 0xF4, 0x29, 0xF5, 0x2B, 0xF4, 0xD0, 0x60, 0xD1, 0xF2, 0xB1, 0x61, 0xB1, 0xF2, 0xD2, 0xF5,
+0x21, 0xF2, 0x22, 0xF2, 0x24, 0xF6, 0x20, 0xF1, 0xD0, 0x70, 0x90, 0x50, 0x00, 0xA0, 0x0A, 0x0B,
+0x30, 0x02, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF5, 0x2E, 0xFE, 0xB1, 0x63, 0xB0, 0xF0, 0xD0,
+0xF4, 0x22, 0xF4, 0x25, 0xF0, 0xD1, 0x70, 0xC0, 0x0F, 0x01, 0x80, 0x50, 0xC0, 0x50, 0x90, 0x40,
+0x81, 0x30, 0xA0, 0x40, 0xC0, 0x00, 0xA0, 0x0E, 0x50, 0x90, 0xA1, 0x04, 0x30, 0xC0, 0x0F, 0x01,
+0x91, 0x00, 0xC0, 0x40, 0x04, 0x30, 0xC0, 0x0F, 0x03, 0x40, 0xC0, 0x06, 0xC0, 0x80, 0x03, 0xC0,
+0x50, 0x0A, 0xA0, 0x50, 0x00, 0x40, 0x08, 0xC0, 0x10, 0x90, 0x00, 0xA0, 0xB0, 0xF1, 0xB0, 0xA0,
+0x06, 0x90, 0xC0, 0x30, 0x80, 0x30, 0x01, 0x50, 0x30, 0x60, 0x31, 0x50, 0x05, 0x40, 0x70, 0xA0,
+0x10, 0x50, 0x04, 0xC0, 0x90, 0x40, 0x50, 0x0C, 0xA0, 0x02, 0x50, 0x30, 0xA0, 0xE0, 0x40, 0x80,
+0x91, 0x31, 0xE0, 0x60, 0xD0, 0xF3, 0x27, 0xF1, 0x20, 0xF1, 0x2F, 0x00, 0xF4, 0xD1, 0xF2, 0x63,
+0xB2, 0x20, 0xFB, 0x2F, 0x00, 0xF5, 0x22, 0xF2, 0x21, 0xD0, 0xA0, 0xC0, 0x01, 0x30, 0x0A, 0x0B,
+0xA0, 0x02, 0x70, 0xD0, 0xF1, 0x25, 0xF5, 0x2F, 0x00, 0xF5, 0x21, 0xF7, 0xD1, 0xB0, 0x60, 0xB0,
+0x63, 0xB0, 0xF0, 0xD0, 0xF4, 0xD1, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0xB0, 0x30, 0x06, 0xC0, 0xA0,
+0x08, 0xA0, 0x04, 0x40, 0x02, 0x40, 0x30, 0xA0, 0x10, 0x40, 0x0F, 0x00, 0x40, 0x50, 0x40, 0x90,
+0xC0, 0x01, 0x30, 0x0F, 0x03, 0xC0, 0x41, 0x05, 0x30, 0x0F, 0x02, 0x40, 0x00, 0xC0, 0x90, 0x06,
+0x50, 0x80, 0x03, 0xC0, 0x50, 0x0B, 0x30, 0x80, 0xC0, 0x09, 0x10, 0x50, 0x00, 0x70, 0xD0, 0x20,
+0xF0, 0xD0, 0x70, 0x07, 0x40, 0x90, 0x40, 0xC0, 0x02, 0xA0, 0x30, 0xB0, 0xA0, 0x50, 0x08, 0xC0,
+0x10, 0xC0, 0x01, 0x90, 0x40, 0x90, 0xC0, 0x0E, 0xA2, 0x30, 0x80, 0xC0, 0x00, 0x80, 0x00, 0xA0,
+0x70, 0x80, 0x71, 0xD0, 0x60, 0xF3, 0x26, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x27, 0xF9, 0x20, 0xB0,
+0x63, 0xB2, 0xD1, 0xF4, 0x27, 0xF1, 0x2F, 0x00, 0xF6, 0x27, 0xD0, 0x30, 0xC0, 0x01, 0x30, 0xC0,
+0x09, 0x0B, 0xE0, 0x30, 0xA2, 0xD0, 0xF0, 0x26, 0xFC, 0x20, 0xF0, 0x2C, 0xF3, 0x23, 0xF1, 0x20,
+0xF0, 0xB1, 0xD0, 0xF1, 0xD0, 0xF0, 0xB1, 0x62, 0xB1, 0xF2, 0xD1, 0xF5, 0xD0, 0xB0, 0x30, 0x06,
+0x80, 0xA0, 0x07, 0x50, 0x80, 0x04, 0x40, 0x06, 0x90, 0x30, 0xA0, 0x30, 0x40, 0x50, 0x0E, 0x90,
+0x40, 0x50, 0x30, 0x0F, 0x04, 0xC0, 0x41, 0xC0, 0x03, 0xA0, 0x0F, 0x01, 0xC0, 0x10, 0x01, 0x51,
+0x05, 0xC0, 0x80, 0x03, 0xC0, 0x50, 0x0C, 0x81, 0x09, 0xC0, 0x01, 0x70, 0xD0, 0x21, 0xF0, 0xA0,
+0x05, 0xC0, 0x41, 0x50, 0x04, 0x40, 0x10, 0xA0, 0x40, 0x06, 0xC0, 0x40, 0x30, 0xE0, 0x10, 0x41,
+0x90, 0x0F, 0x03, 0x30, 0x05, 0x50, 0x41, 0x10, 0x30, 0xA0, 0x70, 0xB0, 0xE0, 0xB0, 0x20, 0xF0,
+0x21, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x20, 0xF3, 0x24, 0xF3, 0xD0, 0xF1, 0xB2, 0x62, 0xB0, 0xF0,
+0xD0, 0xF3, 0x60, 0xD0, 0xF2, 0x22, 0xF5, 0x2F, 0x01, 0xF0, 0x20, 0xF7, 0x24, 0xF0, 0x20, 0xF0,
+0xD0, 0x80, 0x70, 0xA0, 0x30, 0x70, 0xC0, 0x09, 0x0A, 0xC0, 0x30, 0x01, 0x90, 0x80, 0xD0, 0xF0,
+0x21, 0xF0, 0x29, 0xFE, 0x2F, 0x02, 0xF0, 0xB1, 0xF1, 0x20, 0xF4, 0xD0, 0xF0, 0xB1, 0x63, 0xB1,
+0x20, 0xF0, 0xD1, 0xF0, 0xD1, 0x70, 0x0F, 0x01, 0x40, 0x90, 0x03, 0xC0, 0x90, 0x09, 0xC0, 0x90,
+0x80, 0xA0, 0x30, 0x40, 0x50, 0xC0, 0x0B, 0xC0, 0x30, 0x90, 0x50, 0x0F, 0x02, 0x40, 0x01, 0x50,
+0x40, 0xC0, 0x01, 0xA0, 0x0F, 0x01, 0xC0, 0x10, 0x02, 0x40, 0x05, 0xC0, 0x80, 0x03, 0xC1, 0x0B,
+0x90, 0x50, 0x70, 0x0B, 0xC0, 0xA0, 0xD0, 0xF1, 0xD0, 0x30, 0x50, 0x03, 0x91, 0x01, 0x40, 0x04,
+0xC0, 0x10, 0x80, 0x06, 0x30, 0xA0, 0x81, 0xA0, 0x80, 0xC0, 0x0C, 0x50, 0xC0, 0x05, 0x40, 0x90,
+0x04, 0xC0, 0xA0, 0x30, 0xB0, 0xD0, 0xB0, 0xF0, 0xD0, 0xF5, 0x25, 0xFD, 0x20, 0xB2, 0x61, 0xB2,
+0xF2, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xF1, 0x23, 0xF6, 0x2E, 0xF8, 0x20, 0xF1, 0x23,
+0xF3, 0xD0, 0x60, 0x40, 0x01, 0x40, 0x50, 0x09, 0x0A, 0x50, 0x40, 0x01, 0x40, 0x60, 0xD1, 0xF1,
+0x2C, 0xF0, 0x20, 0xFC, 0x26, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0x60, 0xF1, 0x21, 0xF4, 0x21, 0xF2,
+0x21, 0xF0, 0xB2, 0x62, 0xB1, 0xD0, 0x80, 0x40, 0x0F, 0x00, 0x30, 0x04, 0x50, 0xC0, 0x0D, 0xC0,
+0x90, 0x80, 0x30, 0x70, 0x80, 0x50, 0x08, 0xC0, 0x80, 0x00, 0x50, 0x41, 0xC0, 0x0D, 0xC0, 0x50,
+0x02, 0xC0, 0x40, 0x50, 0x00, 0xA0, 0x0F, 0x02, 0x70, 0x80, 0x01, 0x51, 0x04, 0x30, 0xE0, 0x3A,
+0xA5, 0x32, 0x10, 0x0B, 0x90, 0x30, 0xD0, 0xF2, 0xB0, 0xA0, 0x01, 0x50, 0x40, 0xC0, 0x02, 0x51,
+0x04, 0x30, 0x03, 0x90, 0x80, 0x40, 0x30, 0x10, 0x40, 0x30, 0x80, 0x70, 0x09, 0xC0, 0x50, 0x80,
+0xA0, 0x30, 0x80, 0xA0, 0x30, 0x04, 0x50, 0x80, 0x02, 0x50, 0xA1, 0x30, 0xB1, 0xD0, 0xF0, 0xD0,
+0xF3, 0x20, 0xF1, 0x22, 0xF0, 0x21, 0xF4, 0xD1, 0xF2, 0xB1, 0x62, 0xB1, 0xF1, 0xD1, 0xF6, 0x20,
+0xF0, 0x21, 0xF1, 0x60, 0xD0, 0xF3, 0x2C, 0xF9, 0x29, 0xF1, 0x23, 0xF4, 0x60, 0x80, 0x01, 0x91,
+0x09, 0x0A, 0x90, 0xE0, 0x80, 0x40, 0xA0, 0xB0, 0xD0, 0xF2, 0x2F, 0x02, 0xFC, 0x23, 0xF0, 0x26,
+0xF0, 0xD0, 0x60, 0xF1, 0x2C, 0xF4, 0xD1, 0xB2, 0x61, 0x30, 0x51, 0x0D, 0xA0, 0x04, 0x40, 0x0F,
+0x03, 0x80, 0xC0, 0x40, 0x30, 0xA1, 0x80, 0x90, 0x03, 0x40, 0x90, 0x03, 0x90, 0x40, 0x90, 0x0B,
+0x40, 0x05, 0xC0, 0x40, 0xA0, 0x30, 0x80, 0x41, 0xC0, 0x0D, 0x10, 0x40, 0x01, 0x40, 0x04, 0x30,
+0xC0, 0x03, 0x51, 0x0A, 0x40, 0x01, 0x70, 0x80, 0x0A, 0x90, 0x80, 0xD0, 0xF2, 0xD0, 0xA0, 0x50,
+0x40, 0x50, 0x05, 0x40, 0x03, 0x40, 0x30, 0x02, 0xA0, 0x30, 0x40, 0x82, 0xE0, 0x80, 0x70, 0xC0,
+0x05, 0x50, 0x80, 0xA1, 0x30, 0x80, 0x50, 0x03, 0x80, 0xC0, 0x04, 0xA0, 0x00, 0xC0, 0x70, 0xA0,
+0x10, 0x40, 0x70, 0xD0, 0x60, 0xD0, 0xFB, 0x20, 0xF3, 0xD0, 0xF1, 0xB0, 0x63, 0xB1, 0xF0, 0xD1,
+0xF0, 0xD1, 0xF2, 0x23, 0xF0, 0x25, 0xF0, 0xD0, 0x60, 0xD0, 0xF1, 0x2D, 0xFA, 0x29, 0xF2, 0x20,
+0xF6, 0xB0, 0xA0, 0x40, 0x80, 0x70, 0x40, 0x09, 0x0A, 0x40, 0x50, 0xC0, 0x50, 0x70, 0xD0, 0xF4,
+0x21, 0xF5, 0x2F, 0x0D, 0xF2, 0x21, 0xF1, 0x60, 0xF1, 0x23, 0xF3, 0x23, 0xF2, 0x21, 0xF1, 0xD0,
+0xF2, 0xD0, 0x60, 0x80, 0x00, 0x50, 0x90, 0x40, 0x91, 0x50, 0xC0, 0x06, 0x41, 0x04, 0x40, 0x0F,
+0x02, 0x90, 0x40, 0x04, 0x50, 0x40, 0xA1, 0x30, 0x80, 0x70, 0x07, 0x90, 0x40, 0x90, 0xC0, 0x06,
+0xC0, 0x90, 0x06, 0x50, 0x80, 0x91, 0x50, 0x40, 0x80, 0x30, 0xA3, 0x30, 0x83, 0x42, 0x51, 0x10,
+0x30, 0x00, 0xC0, 0x90, 0x03, 0x41, 0x03, 0xC0, 0x50, 0x09, 0x50, 0xC0, 0x01, 0xA0, 0xC0, 0x0A,
+0xC0, 0xA0, 0xD0, 0xF0, 0xD0, 0xF1, 0x80, 0x40, 0x07, 0x51, 0x01, 0x50, 0x10, 0x70, 0x01, 0x30,
+0x80, 0x90, 0x80, 0xA0, 0x70, 0x80, 0x40, 0xE0, 0x90, 0x00, 0xC0, 0x40, 0x80, 0x30, 0xA1, 0x80,
+0x50, 0x08, 0xC0, 0xA0, 0x30, 0xC0, 0x00, 0x50, 0xC0, 0x30, 0x80, 0xA0, 0x90, 0xA0, 0x11, 0x60,
+0xD0, 0x60, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0xD1, 0xF0, 0xB2, 0x62, 0xB0, 0xF0, 0x20,
+0xFC, 0x23, 0xF2, 0x24, 0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF3, 0x29, 0xF2, 0x20, 0xF0, 0x2A, 0xF0,
+0x22, 0xF2, 0x22, 0xF4, 0xD0, 0x70, 0x50, 0xC1, 0x80, 0x09, 0x0A, 0x30, 0x02, 0xA0, 0xD0, 0xF4,
+0x20, 0xF6, 0x2F, 0x09, 0xF2, 0x24, 0xF2, 0x60, 0xD0, 0xF0, 0x21, 0xF3, 0x22, 0xFD, 0xD0, 0xA0,
+0xC0, 0x05, 0xC0, 0x50, 0x90, 0x40, 0x90, 0x51, 0xC0, 0x00, 0x30, 0xC0, 0x04, 0x90, 0x0F, 0x02,
+0x80, 0x50, 0x02, 0x30, 0x40, 0x03, 0xC0, 0x50, 0x70, 0x09, 0xC0, 0x90, 0x40, 0x50, 0x01, 0x31,
+0x00, 0x90, 0x03, 0x41, 0x01, 0x40, 0x50, 0x00, 0x50, 0x90, 0x07, 0xC2, 0x51, 0x90, 0x43, 0xA0,
+0x80, 0x00, 0x40, 0x51, 0x01, 0x80, 0x40, 0x03, 0xC0, 0x50, 0x09, 0x40, 0x02, 0x80, 0x50, 0x0B,
+0x30, 0xB0, 0xD0, 0xF0, 0xB1, 0x60, 0x80, 0x08, 0x90, 0x01, 0xA0, 0xE0, 0x70, 0x90, 0x81, 0x90,
+0x70, 0x30, 0xB0, 0xD0, 0x80, 0x30, 0x50, 0x70, 0xA0, 0x80, 0x40, 0x50, 0xC0, 0x0D, 0xC0, 0x70,
+0x80, 0x30, 0x80, 0x70, 0x10, 0x70, 0x31, 0x70, 0xE0, 0xB0, 0xD1, 0xB0, 0xF2, 0xD0, 0xF2, 0x21,
+0xB1, 0x62, 0xB1, 0xF1, 0xD1, 0xF1, 0x24, 0xF0, 0x20, 0xF3, 0x23, 0xF0, 0x22, 0xF1, 0x21, 0xF0,
+0x22, 0xF0, 0xB0, 0xF2, 0x24, 0xF2, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xF0, 0x2E, 0xF2, 0x22, 0xF4,
+0xD0, 0xA0, 0x02, 0x30, 0x09, 0x0A, 0xA0, 0x02, 0xA0, 0xD3, 0xF6, 0x2F, 0x14, 0xF2, 0xB0, 0xD0,
+0xF0, 0x20, 0xF3, 0x23, 0xFB, 0x20, 0xF0, 0xD0, 0xA0, 0x0B, 0xC0, 0x52, 0x30, 0x40, 0x50, 0xC0,
+0x01, 0xC0, 0x50, 0x0F, 0x02, 0xA0, 0x02, 0xC0, 0x70, 0x30, 0x05, 0x30, 0x0C, 0x50, 0x40, 0x90,
+0x40, 0x50, 0x00, 0x90, 0x04, 0xC0, 0x01, 0x30, 0xC0, 0x01, 0xC0, 0x40, 0x50, 0x0F, 0x01, 0x50,
+0x70, 0x82, 0xA0, 0x50, 0xA0, 0x04, 0xC0, 0x50, 0x08, 0x90, 0xC0, 0x03, 0x70, 0x50, 0x08, 0xC0,
+0x00, 0x30, 0x60, 0xB0, 0x60, 0xB0, 0xD0, 0x60, 0x80, 0x08, 0x50, 0xC0, 0x90, 0xE0, 0x41, 0x70,
+0x40, 0x90, 0x70, 0x60, 0xD0, 0x40, 0x70, 0xA0, 0x0F, 0x06, 0x40, 0x90, 0x01, 0x90, 0x10, 0xE0,
+0x40, 0x90, 0x30, 0x80, 0xD1, 0xF0, 0xD0, 0xB1, 0xF1, 0xB1, 0x62, 0xB2, 0x20, 0xF9, 0x26, 0xF0,
+0x22, 0xF1, 0x21, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xB1, 0xD0, 0xF1, 0x25, 0xF0, 0x24,
+0xF7, 0x2E, 0xF6, 0xD3, 0xA0, 0x02, 0xA0, 0x09, 0x0A, 0xA0, 0x32, 0xE0, 0x61, 0xB2, 0xFF, 0x0A,
+0x22, 0xF3, 0x21, 0xF4, 0x21, 0xF0, 0xD0, 0xB1, 0xF1, 0x20, 0xF4, 0x25, 0xF8, 0x20, 0xF1, 0xA0,
+0x0E, 0xC0, 0x30, 0x00, 0xC0, 0x50, 0x91, 0x41, 0x50, 0xC0, 0x0E, 0xC0, 0x30, 0x02, 0xC0, 0xA1,
+0xC0, 0x03, 0x50, 0x80, 0x0F, 0x00, 0x30, 0xA0, 0x40, 0xC0, 0x07, 0xA0, 0x04, 0x50, 0x40, 0x50,
+0x0F, 0x02, 0x50, 0xC0, 0x00, 0x80, 0x10, 0xC0, 0x03, 0xC0, 0x50, 0x07, 0xC0, 0x90, 0x04, 0xC0,
+0x30, 0x70, 0x30, 0xA3, 0x33, 0x80, 0xA0, 0x80, 0xB0, 0xD2, 0x30, 0x50, 0x09, 0x40, 0x80, 0x70,
+0x30, 0xE0, 0x80, 0xB0, 0x70, 0xB0, 0xD0, 0xA0, 0x30, 0x00, 0x30, 0x0F, 0x06, 0x70, 0x03, 0x10,
+0x40, 0x30, 0xA0, 0xD2, 0xF1, 0xB0, 0x63, 0xB1, 0xF1, 0xD1, 0xF2, 0x20, 0xF2, 0x22, 0xF0, 0x24,
+0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x2A, 0xF4, 0x20, 0xB0, 0xD0, 0xF0, 0x24, 0xF1, 0x22, 0xF1, 0x23,
+0xFF, 0x0A, 0xB2, 0x61, 0x70, 0xA0, 0x31, 0x70, 0x09, 0x0A, 0x30, 0x02, 0xA0, 0xD0, 0xF0, 0x20,
+0xB2, 0x67, 0xB3, 0xF1, 0xD7, 0xF5, 0x23, 0xF1, 0x21, 0xF5, 0xD0, 0xB0, 0xF1, 0x21, 0xF2, 0x24,
+0xF4, 0x21, 0xF4, 0x20, 0xD0, 0xF0, 0x30, 0x0E, 0x80, 0x50, 0x04, 0x90, 0x00, 0xC0, 0x50, 0x41,
+0x91, 0x50, 0xC0, 0x08, 0x90, 0x40, 0x03, 0x70, 0x40, 0x70, 0xC0, 0x02, 0x90, 0x40, 0x0F, 0x00,
+0xC0, 0x00, 0x40, 0x08, 0xA0, 0x06, 0x50, 0x40, 0xC0, 0x0F, 0x01, 0x40, 0x01, 0x40, 0x30, 0x03,
+0xC0, 0x50, 0x07, 0x40, 0x07, 0xA0, 0x50, 0x07, 0x90, 0x80, 0x40, 0xD0, 0xF1, 0xB0, 0x70, 0x0A,
+0x90, 0x30, 0xA0, 0x30, 0xA0, 0x60, 0x70, 0xD1, 0x70, 0x50, 0x01, 0x30, 0x0F, 0x06, 0xA0, 0x02,
+0x70, 0x10, 0x70, 0x90, 0xB1, 0x62, 0xB1, 0xF0, 0x60, 0xD0, 0xF8, 0x2F, 0x02, 0xF0, 0x26, 0xF0,
+0x26, 0xF2, 0x22, 0x60, 0xD0, 0xF5, 0x21, 0xF2, 0x22, 0xF8, 0xD4, 0xF1, 0xB3, 0x67, 0xB2, 0x20,
+0xF0, 0xD0, 0x30, 0x50, 0x01, 0x30, 0xC0, 0x08, 0x09, 0xC0, 0x30, 0x01, 0xC0, 0xA0, 0xD0, 0xF5,
+0xD0, 0xF7, 0xB1, 0x65, 0xB4, 0xF4, 0xD2, 0xFA, 0xD0, 0x60, 0x20, 0xF0, 0x2E, 0xF9, 0x70, 0x0E,
+0xA0, 0x05, 0x40, 0x05, 0xC1, 0x50, 0x90, 0x40, 0x90, 0x50, 0xC1, 0x02, 0x40, 0x50, 0x03, 0xC0,
+0x70, 0x30, 0xA0, 0x02, 0x80, 0xC0, 0x04, 0xC0, 0x0A, 0xC0, 0x50, 0x08, 0xA0, 0x08, 0x91, 0x0F,
+0x00, 0xC0, 0x50, 0x01, 0xA0, 0x03, 0xC0, 0x50, 0x06, 0x51, 0x08, 0x70, 0xC0, 0x04, 0x90, 0x40,
+0x00, 0xC0, 0x70, 0xD2, 0x60, 0x40, 0x02, 0xC1, 0x51, 0xC0, 0x90, 0x40, 0x80, 0x30, 0x70, 0x80,
+0x30, 0xE0, 0x80, 0x60, 0x30, 0xA0, 0x90, 0x02, 0x30, 0x0F, 0x06, 0xA0, 0x50, 0xC0, 0x50, 0x80,
+0x30, 0x80, 0xB1, 0xF2, 0xD0, 0xF0, 0xD1, 0x60, 0xF0, 0x29, 0xF0, 0x2B, 0xF0, 0x20, 0xF0, 0x22,
+0xF0, 0x20, 0xF0, 0x2C, 0xF1, 0x21, 0x60, 0xD0, 0xFB, 0xD0, 0xF2, 0x22, 0xB4, 0x65, 0xB1, 0xF7,
+0xD0, 0xF5, 0xD0, 0x80, 0x90, 0x01, 0x80, 0xC0, 0x08, 0x0A, 0x70, 0x40, 0x90, 0x40, 0x30, 0xD0,
+0xF0, 0x25, 0xFE, 0x20, 0xB5, 0x65, 0xB3, 0xF4, 0xD3, 0xB0, 0x20, 0xF1, 0x20, 0xF4, 0x21, 0xF1,
+0x27, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x40, 0x0D, 0x30, 0x05, 0x40, 0x0B, 0xC0, 0x50, 0x91, 0x40,
+0x50, 0x80, 0x50, 0x04, 0x80, 0xE0, 0x50, 0x02, 0xA0, 0x30, 0x40, 0xC0, 0x01, 0x80, 0xA0, 0x0A,
+0x50, 0xC0, 0x08, 0x30, 0x09, 0xC0, 0x40, 0x50, 0x0E, 0x40, 0x01, 0x30, 0xC0, 0x02, 0xC0, 0x50,
+0x06, 0x40, 0x09, 0xC0, 0x30, 0x02, 0xC0, 0x40, 0xC0, 0x02, 0x80, 0x60, 0xD0, 0xB0, 0xE0, 0x31,
+0xA0, 0x31, 0x80, 0x40, 0xE0, 0x80, 0x40, 0x90, 0xC0, 0x00, 0x90, 0x40, 0x10, 0xE0, 0xA0, 0x30,
+0x90, 0xC0, 0x03, 0x30, 0xC0, 0x0F, 0x01, 0xC0, 0x50, 0x90, 0x40, 0x90, 0xA0, 0x40, 0xC0, 0x00,
+0x50, 0x30, 0xD1, 0xF6, 0x60, 0xF1, 0x2B, 0xF6, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x24, 0xF1,
+0x21, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x60, 0xD4, 0xF3, 0xB3, 0x64, 0xB6, 0xF3, 0xD0,
+0xFB, 0x23, 0xF1, 0xD0, 0x81, 0x90, 0x40, 0xA0, 0x50, 0x08, 0x09, 0xC0, 0x30, 0x50, 0x90, 0x80,
+0x30, 0xD0, 0xF2, 0x2F, 0x00, 0xFA, 0xD3, 0xF0, 0xB3, 0x67, 0xB0, 0x60, 0xB0, 0x20, 0xF2, 0xD1,
+0xFF, 0x01, 0x20, 0xF1, 0xD0, 0x70, 0x0C, 0x31, 0x04, 0xC0, 0x90, 0x0F, 0x02, 0xA0, 0x50, 0x90,
+0x41, 0x90, 0x50, 0xC0, 0x90, 0x04, 0xC0, 0x40, 0x80, 0x31, 0x11, 0x40, 0x50, 0x08, 0x40, 0x09,
+0x30, 0x0B, 0x50, 0x40, 0xC0, 0x0C, 0xC0, 0x90, 0x01, 0xA0, 0x02, 0xC0, 0x50, 0x05, 0x50, 0xC0,
+0x09, 0x90, 0x80, 0x00, 0xC0, 0x40, 0x50, 0x04, 0xC0, 0x10, 0x70, 0xA0, 0x90, 0xC0, 0x05, 0x80,
+0xC0, 0x03, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x06, 0x40, 0x50, 0x0A, 0xC0, 0x50, 0x90, 0x41, 0x91,
+0x50, 0x03, 0xE0, 0xC0, 0x00, 0xC0, 0xA0, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0xB1, 0xF1,
+0x26, 0xFF, 0x12, 0xD0, 0xF0, 0xD0, 0xF0, 0x20, 0xB0, 0x60, 0xB0, 0x67, 0xB3, 0xF1, 0xD6, 0xF6,
+0x27, 0xF6, 0x20, 0xF2, 0xD0, 0x60, 0x30, 0x40, 0x50, 0x80, 0x50, 0x08, 0x09, 0xC0, 0x80, 0x01,
+0x50, 0x30, 0xD0, 0xF2, 0x2C, 0xF0, 0x24, 0xF0, 0x23, 0xFB, 0xD0, 0xF5, 0xD0, 0xF0, 0x60, 0xB1,
+0x66, 0xB4, 0xF2, 0xD3, 0xF2, 0x20, 0xF0, 0xD1, 0x80, 0x90, 0x0A, 0xC0, 0x10, 0x40, 0x04, 0xC0,
+0x50, 0x0F, 0x01, 0xC0, 0x30, 0x04, 0xC0, 0x91, 0x40, 0x90, 0x51, 0xC0, 0x06, 0x30, 0xA2, 0x30,
+0x81, 0x40, 0x50, 0x01, 0x90, 0x08, 0xC0, 0x30, 0x0D, 0x50, 0x40, 0xC0, 0x0B, 0x90, 0xC0, 0x00,
+0x30, 0x02, 0xC0, 0x50, 0x05, 0x40, 0x0A, 0x70, 0x00, 0x40, 0x90, 0x07, 0x30, 0x09, 0x40, 0x90,
+0x03, 0x90, 0xC0, 0x09, 0x50, 0x80, 0x04, 0xC1, 0x50, 0x91, 0x40, 0x90, 0x50, 0x08, 0x90, 0xA0,
+0x01, 0x30, 0x70, 0xD0, 0x20, 0xF0, 0x24, 0xD0, 0xB1, 0xD0, 0xF1, 0x26, 0xF8, 0x22, 0xF5, 0xD4,
+0xF1, 0xB4, 0x66, 0xB1, 0x60, 0xB0, 0xF7, 0xD0, 0xFF, 0x00, 0x24, 0xF0, 0x2C, 0xF2, 0xD0, 0x80,
+0x40, 0x01, 0x40, 0x90, 0x08, 0x09, 0xC0, 0x80, 0x01, 0x50, 0x30, 0xD0, 0xF2, 0x22, 0xF2, 0x27,
+0xF2, 0x2F, 0x00, 0xF4, 0x24, 0xF1, 0x60, 0xD4, 0xF5, 0xB2, 0x64, 0xB4, 0x20, 0xF1, 0xD0, 0x30,
+0xA0, 0x0B, 0x40, 0x80, 0x04, 0x51, 0x0F, 0x01, 0x41, 0x09, 0xC0, 0x51, 0x40, 0x91, 0x50, 0xC0,
+0x01, 0x80, 0x03, 0xC0, 0x50, 0x90, 0x80, 0x30, 0xA0, 0x30, 0x80, 0x41, 0x90, 0x50, 0xC0, 0x02,
+0xC0, 0x80, 0x06, 0x50, 0x90, 0x06, 0x40, 0x50, 0x0B, 0x40, 0x00, 0xA0, 0x02, 0xC0, 0x50, 0x04,
+0x90, 0xC0, 0x07, 0xC0, 0x40, 0xA0, 0x80, 0x40, 0xC0, 0x08, 0x30, 0x09, 0x90, 0x40, 0x03, 0xC0,
+0x50, 0x09, 0x50, 0x30, 0xC0, 0x50, 0x91, 0x40, 0x90, 0x50, 0xC0, 0x0B, 0xC0, 0x90, 0x10, 0xC0,
+0x01, 0x40, 0x70, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xB0, 0xF2, 0x22, 0xFF, 0x00, 0x20, 0xF0,
+0xB4, 0x65, 0xB3, 0xF5, 0xD3, 0x60, 0xF1, 0x22, 0xF2, 0x24, 0xF1, 0x2F, 0x06, 0xFA, 0xD0, 0x60,
+0x40, 0x01, 0x40, 0x90, 0x08, 0x03, 0x50, 0xC0, 0x03, 0xC0, 0xE0, 0x30, 0xA0, 0x70, 0x80, 0xD0,
+0xFF, 0x08, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x2F, 0x00, 0xF0, 0xD0, 0x60, 0xD0, 0xFE, 0xD0,
+0xF1, 0x20, 0xF1, 0xB3, 0x61, 0x80, 0x30, 0x40, 0x80, 0x50, 0xC2, 0x06, 0x30, 0xC0, 0x03, 0x50,
+0xC0, 0x0F, 0x01, 0x30, 0xC0, 0x0F, 0x00, 0xC0, 0x50, 0x91, 0x30, 0x50, 0xC1, 0x05, 0x50, 0xC1,
+0x50, 0x41, 0x81, 0x30, 0xA3, 0x90, 0x50, 0xC1, 0x02, 0x50, 0x80, 0x07, 0xC0, 0x40, 0x50, 0x09,
+0x50, 0xC0, 0x90, 0x80, 0x01, 0xC0, 0x50, 0x03, 0xC0, 0x90, 0x08, 0x30, 0x80, 0x40, 0xC0, 0x0A,
+0xA0, 0x09, 0x50, 0x80, 0x04, 0x90, 0x05, 0xC1, 0x91, 0x80, 0xA0, 0x50, 0xC1, 0x0F, 0x00, 0xC0,
+0x70, 0x10, 0x50, 0x02, 0xE0, 0x80, 0xD0, 0x20, 0xF4, 0x22, 0xB0, 0xF2, 0xD4, 0xF5, 0xB2, 0x65,
+0xB4, 0xF0, 0x21, 0xFF, 0x01, 0xD0, 0x60, 0xF1, 0x2F, 0x0F, 0xFE, 0xD0, 0xB0, 0xE0, 0xA0, 0x30,
+0x70, 0x90, 0x08, 0x02, 0x41, 0x30, 0xC0, 0x02, 0x50, 0x80, 0x01, 0x90, 0x80, 0xD0, 0xFD, 0x20,
+0xF0, 0x26, 0xF7, 0x2E, 0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF4, 0x20, 0xFC, 0xD0, 0xF0, 0xD0, 0xF0,
+0xD1, 0x30, 0x10, 0x30, 0xE0, 0x10, 0xE0, 0x50, 0x91, 0x45, 0x30, 0xC1, 0x01, 0x50, 0xC0, 0x0F,
+0x01, 0x30, 0x0F, 0x05, 0xA0, 0x00, 0x50, 0x91, 0x41, 0x90, 0xC0, 0x00, 0x40, 0x09, 0xC0, 0x50,
+0x41, 0x80, 0x32, 0xA0, 0x30, 0x0A, 0x50, 0x40, 0xC0, 0x08, 0x40, 0x00, 0x30, 0x01, 0xC0, 0x50,
+0x03, 0x40, 0x09, 0xA0, 0x40, 0x0C, 0xA0, 0x09, 0xC0, 0x80, 0x04, 0x40, 0x00, 0xC0, 0x90, 0x41,
+0x91, 0x50, 0xC0, 0x01, 0xE0, 0x0E, 0x90, 0x30, 0xA0, 0x30, 0xA0, 0xE0, 0x10, 0x03, 0x10, 0xD1,
+0xF1, 0x20, 0xD0, 0xF3, 0x20, 0x60, 0xF1, 0xB2, 0x67, 0xB3, 0x20, 0xF0, 0xD6, 0xF5, 0x22, 0xF4,
+0x22, 0xF3, 0x20, 0xF0, 0x60, 0xF2, 0x2F, 0x0F, 0xFD, 0xD0, 0x60, 0x80, 0x01, 0x50, 0x40, 0x08,
+0x02, 0x90, 0x31, 0x03, 0x50, 0x40, 0x01, 0x40, 0x60, 0xD0, 0xF2, 0x2F, 0x06, 0xFF, 0x07, 0x60,
+0xF1, 0x21, 0xF4, 0x22, 0xFA, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0xB0, 0x10, 0x80, 0x00, 0xC0, 0x30,
+0x40, 0x07, 0x40, 0x80, 0x50, 0x90, 0x41, 0x0F, 0x02, 0xA0, 0x0F, 0x04, 0x50, 0x80, 0x05, 0xC0,
+0x50, 0x41, 0x0F, 0x03, 0x30, 0x0C, 0x90, 0x40, 0x07, 0xC0, 0x50, 0xA0, 0x01, 0xC0, 0x50, 0x02,
+0x51, 0x07, 0x92, 0x40, 0x0C, 0xA0, 0x09, 0xC0, 0x30, 0x04, 0x90, 0x40, 0x50, 0xC0, 0x06, 0x90,
+0x70, 0xC0, 0x07, 0xC0, 0x40, 0x80, 0x30, 0xA1, 0x40, 0xC0, 0x00, 0x50, 0x10, 0x72, 0x50, 0x00,
+0x70, 0xB0, 0xD0, 0x23, 0xF2, 0x20, 0xF1, 0x62, 0xB2, 0x20, 0xF0, 0xD3, 0xFF, 0x04, 0x23, 0xF2,
+0x20, 0xF0, 0x22, 0xF3, 0x20, 0xF0, 0xB0, 0xFF, 0x10, 0x2C, 0xF2, 0xD0, 0x60, 0x80, 0x01, 0x50,
+0x40, 0x08, 0x03, 0xC0, 0x04, 0x90, 0x30, 0x90, 0x50, 0x30, 0x60, 0xD0, 0xF1, 0x2F, 0x08, 0xFF,
+0x06, 0x60, 0xF1, 0x21, 0xF2, 0x24, 0xF1, 0x20, 0xF3, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0x10,
+0xA0, 0x0C, 0xA0, 0xC0, 0x01, 0x90, 0x0F, 0x01, 0xC0, 0x30, 0x0F, 0x04, 0x90, 0x40, 0x08, 0x40,
+0x0F, 0x02, 0xC0, 0x30, 0x0E, 0x40, 0x90, 0x06, 0x90, 0x30, 0x01, 0xC0, 0x50, 0x02, 0x40, 0x06,
+0xC0, 0x90, 0x01, 0xA0, 0xC0, 0x0C, 0x30, 0x0A, 0x30, 0x04, 0x90, 0xC0, 0x08, 0x40, 0x30, 0x50,
+0x01, 0xC0, 0x50, 0x40, 0x80, 0x30, 0x70, 0xE0, 0x71, 0x04, 0x90, 0x10, 0x70, 0x80, 0x90, 0x70,
+0x30, 0x71, 0xD0, 0x20, 0xF1, 0x20, 0xF4, 0x21, 0x60, 0xD1, 0xF8, 0x2D, 0xF0, 0x26, 0xF3, 0x25,
+0xF3, 0x20, 0xF0, 0xB1, 0xFF, 0x09, 0x2F, 0x05, 0xF0, 0xD0, 0xB0, 0xA0, 0x50, 0x90, 0x81, 0x08,
+0x03, 0x50, 0xA0, 0x70, 0xE0, 0xA0, 0x91, 0x80, 0x41, 0xA0, 0xB0, 0xD0, 0xF2, 0x25, 0xF2, 0x22,
+0xF8, 0x2F, 0x06, 0xF0, 0x20, 0xB0, 0xF1, 0x21, 0xF0, 0x29, 0xF4, 0x21, 0xF1, 0x20, 0xF0, 0x20,
+0xF0, 0xD0, 0x60, 0x40, 0xE0, 0x0C, 0x50, 0x30, 0x01, 0x90, 0x0F, 0x01, 0x40, 0x90, 0x0F, 0x04,
+0x40, 0x50, 0x08, 0x90, 0x0F, 0x02, 0xC0, 0x80, 0x0F, 0x00, 0xC0, 0x40, 0x50, 0x05, 0x30, 0x90,
+0x50, 0x91, 0x51, 0x41, 0x50, 0x90, 0x43, 0x80, 0x70, 0xA0, 0x50, 0x81, 0x0D, 0x80, 0xC0, 0x09,
+0x30, 0x04, 0x50, 0xC0, 0x08, 0x30, 0x90, 0xA0, 0x30, 0xA0, 0x80, 0xE0, 0x40, 0x50, 0xA1, 0x80,
+0xC0, 0x40, 0x30, 0xC0, 0x02, 0xE1, 0xA0, 0x50, 0x41, 0x80, 0x31, 0xD0, 0xF2, 0x26, 0xF0, 0x60,
+0xD0, 0xF7, 0x23, 0xF0, 0x26, 0xF0, 0x2F, 0x06, 0xF0, 0x22, 0xF0, 0xB1, 0xF2, 0x2C, 0xF3, 0x2F,
+0x00, 0xF1, 0x27, 0xF0, 0xD0, 0xB0, 0xA0, 0x41, 0x81, 0x08, 0x02, 0xC0, 0xE0, 0x90, 0xC1, 0x50,
+0x70, 0xA0, 0x50, 0x01, 0x30, 0xB0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xFF, 0x01, 0x2F, 0x06, 0xF1,
+0xB0, 0xF1, 0x21, 0xF0, 0x2A, 0xF3, 0x23, 0xF3, 0xD0, 0x30, 0x50, 0x0E, 0x80, 0x90, 0x00, 0x40,
+0x0F, 0x01, 0x30, 0x0F, 0x05, 0x80, 0xC0, 0x07, 0xC0, 0x50, 0x0F, 0x02, 0x50, 0x80, 0x0F, 0x02,
+0x50, 0x40, 0x04, 0x40, 0x30, 0x40, 0x84, 0x42, 0x90, 0x40, 0x30, 0x90, 0xC0, 0x01, 0xA0, 0x70,
+0x0E, 0x40, 0x90, 0x09, 0xA0, 0x04, 0x51, 0x08, 0x70, 0x00, 0x50, 0x02, 0x40, 0x50, 0x70, 0xC0,
+0x00, 0x31, 0x70, 0xA0, 0x70, 0x50, 0x01, 0x90, 0x10, 0xA0, 0x00, 0x30, 0x00, 0xA0, 0x30, 0xD0,
+0xF0, 0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0x2F, 0x07, 0xF0, 0x2F, 0x02, 0xF0,
+0x22, 0xF0, 0xB1, 0xF0, 0x2F, 0x00, 0xF2, 0x2C, 0xF5, 0x26, 0xF0, 0xD0, 0xB0, 0xA0, 0x01, 0xC0,
+0x80, 0x08, 0x02, 0x90, 0x30, 0x03, 0x90, 0x70, 0x50, 0x01, 0x30, 0xF0, 0xD0, 0xF3, 0x20, 0xF9,
+0x2F, 0x0E, 0xF1, 0xB1, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x27, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x20,
+0xF1, 0xD0, 0x60, 0x80, 0x0F, 0x00, 0x70, 0x00, 0x40, 0x0F, 0x01, 0xA0, 0x0F, 0x05, 0x30, 0xC0,
+0x07, 0x51, 0x0F, 0x02, 0x90, 0x80, 0xC0, 0x0F, 0x03, 0x91, 0x03, 0x80, 0x00, 0xC1, 0x00, 0x90,
+0x03, 0x91, 0x04, 0x50, 0x40, 0x0E, 0x90, 0x40, 0x09, 0x30, 0x04, 0xC0, 0x50, 0x07, 0x80, 0x40,
+0x04, 0x90, 0x10, 0x02, 0xA0, 0x03, 0x80, 0x10, 0x40, 0x00, 0x70, 0x10, 0x00, 0xA0, 0x01, 0xA0,
+0xD1, 0xF2, 0x24, 0xF1, 0xD0, 0x60, 0xD0, 0xF7, 0x23, 0xF6, 0x20, 0xF0, 0x24, 0xF0, 0x26, 0xF0,
+0x26, 0xF3, 0x20, 0xF0, 0xB1, 0xF2, 0x2F, 0x0B, 0xF1, 0x21, 0xF4, 0x24, 0xF0, 0x20, 0xF0, 0xD0,
+0xF0, 0xA0, 0x01, 0xC0, 0x80, 0x90, 0xC1, 0xA1, 0x50, 0x02, 0x03, 0x70, 0x30, 0x41, 0x30, 0x70,
+0x30, 0xA0, 0x31, 0x70, 0xF0, 0xD0, 0xFE, 0x2F, 0x0C, 0xF3, 0xB1, 0xF2, 0x20, 0xF0, 0x20, 0xF1,
+0x23, 0xF0, 0x22, 0xF2, 0x22, 0xF7, 0x30, 0xA0, 0x0E, 0x50, 0x80, 0x40, 0x0F, 0x00, 0xC0, 0x30,
+0x0F, 0x05, 0xA0, 0x08, 0x50, 0xC0, 0x0F, 0x02, 0x40, 0xA0, 0x80, 0x30, 0xA1, 0x33, 0x80, 0x43,
+0x91, 0x54, 0xC0, 0x50, 0x80, 0x50, 0xC0, 0x00, 0x90, 0x80, 0x00, 0x50, 0xC0, 0x90, 0x01, 0x50,
+0x40, 0xC0, 0x05, 0x90, 0x40, 0x0E, 0x50, 0x80, 0x09, 0x80, 0xC0, 0x04, 0x90, 0x05, 0x50, 0x70,
+0x80, 0x06, 0xC0, 0x01, 0x80, 0x40, 0x04, 0xA0, 0x80, 0xC0, 0xA0, 0xE0, 0xA0, 0x90, 0x30, 0x80,
+0x10, 0x60, 0xD0, 0xF2, 0x23, 0xF2, 0xD0, 0x60, 0xD0, 0xF5, 0x22, 0xF0, 0x21, 0xFF, 0x01, 0x20,
+0xF0, 0x20, 0xF2, 0x26, 0xF3, 0x20, 0xF0, 0xB1, 0xF4, 0x2F, 0x03, 0xF7, 0x21, 0xF5, 0x23, 0xF0,
+0x20, 0xF0, 0xD1, 0x70, 0x31, 0xA0, 0x71, 0xC0, 0xE0, 0x40, 0x90, 0xE0, 0xC0, 0x01, 0x03, 0x50,
+0x90, 0x80, 0x30, 0x40, 0x00, 0x40, 0x90, 0x01, 0x30, 0xF5, 0x21, 0xF0, 0x2F, 0x13, 0xF0, 0x21,
+0xF1, 0xB1, 0xF5, 0x25, 0xF1, 0x21, 0xF1, 0x23, 0xF0, 0x20, 0xF4, 0xD0, 0x50, 0x70, 0x0F, 0x00,
+0x30, 0x40, 0x0F, 0x00, 0x50, 0x80, 0x0F, 0x05, 0xA0, 0x08, 0x90, 0x0F, 0x03, 0x40, 0x50, 0x04,
+0xC1, 0x53, 0x90, 0x44, 0x87, 0x30, 0x80, 0x30, 0x80, 0x50, 0x90, 0x00, 0xC0, 0x40, 0x50, 0x08,
+0x30, 0x0F, 0x00, 0x30, 0x09, 0x40, 0x90, 0x04, 0x90, 0x05, 0x70, 0x0A, 0x80, 0x30, 0x05, 0x10,
+0x00, 0x30, 0x10, 0xE0, 0x90, 0x30, 0xC0, 0x00, 0x10, 0x60, 0xD0, 0xF3, 0x23, 0xF1, 0xD0, 0x60,
+0xF0, 0xD0, 0xF1, 0x2E, 0xFA, 0x20, 0xF0, 0x20, 0xF0, 0x28, 0xF5, 0xB1, 0xF4, 0x21, 0xF0, 0x2F,
+0x12, 0xF6, 0xA0, 0x01, 0xC0, 0x70, 0x90, 0xC0, 0x30, 0x01, 0x80, 0x90, 0x01, 0x02, 0xC0, 0x10,
+0x80, 0x03, 0x80, 0x50, 0x01, 0x30, 0xF0, 0xD0, 0xFF, 0x1E, 0xD0, 0xB1, 0xD0, 0xF1, 0xD1, 0xFF,
+0x07, 0xD1, 0x80, 0x30, 0x0F, 0x01, 0x80, 0x0F, 0x00, 0x40, 0x90, 0x0F, 0x04, 0x50, 0x80, 0x08,
+0x90, 0x0F, 0x03, 0x80, 0xC0, 0x0F, 0x09, 0x50, 0x90, 0xC0, 0x80, 0xA0, 0x50, 0x91, 0x0A, 0xA0,
+0xC0, 0x0E, 0xA0, 0x09, 0x50, 0x40, 0x04, 0x40, 0x04, 0x40, 0x70, 0x0A, 0xA0, 0x05, 0xC0, 0x10,
+0xE0, 0x30, 0xA0, 0x70, 0xA0, 0x10, 0x00, 0xC0, 0x10, 0x60, 0xD0, 0xF9, 0xD0, 0x60, 0xF0, 0xD0,
+0xFF, 0x1A, 0xD0, 0xF3, 0xB1, 0xD0, 0xFF, 0x1E, 0xD1, 0xA0, 0x02, 0x30, 0xE0, 0x90, 0xA0, 0x40,
+0x90, 0xE0, 0xC0, 0x01, 0x02, 0x50, 0xA0, 0x80, 0x10, 0x80, 0xC0, 0x00, 0x40, 0x70, 0xA1, 0xE0,
+0xBF, 0x22, 0x60, 0xBF, 0x0D, 0xF0, 0x70, 0x00, 0xCF, 0x01, 0x30, 0x80, 0xCE, 0x30, 0x50, 0xCF,
+0x04, 0x41, 0xC8, 0x40, 0xCF, 0x03, 0x30, 0x50, 0xCF, 0x0B, 0x40, 0x81, 0x40, 0xCD, 0x70, 0x50,
+0x00, 0xCC, 0xA0, 0xC9, 0x50, 0x70, 0x40, 0x50, 0xC2, 0x40, 0xC3, 0x40, 0xA0, 0x40, 0xC7, 0x50,
+0x81, 0x40, 0xC6, 0x90, 0x70, 0x12, 0x90, 0x30, 0xE1, 0xA0, 0xF0, 0xBB, 0x60, 0xBF, 0x22, 0x60,
+0xBF, 0x21, 0x70, 0xA1, 0x70, 0x30, 0x00, 0x30, 0xA0, 0x70, 0x30, 0xC0, 0x02, 0x02, 0xC0, 0x70,
+0x01, 0x80, 0xE1, 0xA0, 0x12, 0xE0, 0xBF, 0x21, 0x61, 0xBF, 0x0E, 0x30, 0x90, 0x5F, 0x01, 0x40,
+0x80, 0x40, 0x5D, 0x30, 0x5F, 0x05, 0x30, 0x90, 0x58, 0x40, 0x5F, 0x03, 0x30, 0x5F, 0x0C, 0x40,
+0x81, 0x40, 0x5E, 0x81, 0x5B, 0x40, 0x80, 0x5A, 0x30, 0x50, 0x30, 0x40, 0x90, 0x50, 0x40, 0xC0,
+0x80, 0x50, 0xC0, 0x30, 0x90, 0x58, 0x80, 0x41, 0x58, 0x40, 0xE0, 0x40, 0x80, 0xA0, 0x80, 0xA0,
+0x80, 0xBD, 0x60, 0xBF, 0x21, 0x61, 0xBF, 0x21, 0xE0, 0x12, 0x30, 0x00, 0x40, 0x81, 0x90, 0x03,
+0x02, 0xC0, 0xA0, 0x03, 0xC0, 0x80, 0x90, 0x01, 0xA0, 0xD1, 0xFF, 0x1E, 0xD0, 0xB1, 0xF0, 0x20,
+0xFF, 0x0B, 0xD0, 0xB0, 0x80, 0x0F, 0x01, 0x90, 0x00, 0xA0, 0x0C, 0xC0, 0x80, 0x0F, 0x05, 0x30,
+0x09, 0x90, 0x0F, 0x03, 0xA0, 0x0F, 0x0A, 0xC0, 0x90, 0x50, 0x40, 0x80, 0x41, 0xC0, 0x0D, 0xA0,
+0x0C, 0x30, 0x08, 0xC0, 0x40, 0x30, 0x00, 0xC0, 0x80, 0x34, 0x80, 0x00, 0xA0, 0x09, 0xA0, 0x0B,
+0x50, 0x10, 0x30, 0xA0, 0xD0, 0x30, 0x70, 0xD0, 0xFB, 0xD0, 0xB0, 0xFF, 0x21, 0xB1, 0xD0, 0xFF,
+0x1E, 0xD1, 0x70, 0x01, 0xC0, 0x30, 0xE0, 0x30, 0x40, 0x80, 0x30, 0x70, 0x02, 0x09, 0x40, 0x50,
+0x01, 0x30, 0xF0, 0xD0, 0xF5, 0x20, 0xFF, 0x0F, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0xB1, 0x23,
+0xF1, 0x21, 0xFA, 0x29, 0xF0, 0xD0, 0x70, 0x0F, 0x01, 0x90, 0x00, 0x41, 0x0B, 0x90, 0x40, 0x0F,
+0x05, 0xA0, 0x09, 0x90, 0x0F, 0x03, 0xA0, 0x0F, 0x09, 0x40, 0x90, 0x00, 0x90, 0x51, 0x30, 0xC0,
+0x90, 0x40, 0x0C, 0x80, 0xA0, 0x30, 0x0A, 0x30, 0x07, 0x40, 0x70, 0x40, 0x04, 0xC0, 0x40, 0xC0,
+0x00, 0x90, 0xE0, 0x40, 0x08, 0x50, 0x40, 0x0D, 0xA0, 0x70, 0xB0, 0x10, 0x60, 0xD0, 0xF7, 0x22,
+0xF1, 0x60, 0xD0, 0xFF, 0x02, 0x27, 0xFD, 0x22, 0xF0, 0x22, 0xF0, 0xB1, 0xF4, 0x21, 0xFF, 0x11,
+0x21, 0xF5, 0xD0, 0xA0, 0x02, 0x70, 0x40, 0x03, 0x30, 0x90, 0x01, 0x03, 0x70, 0x10, 0xE0, 0xC0,
+0x00, 0x30, 0x70, 0xA0, 0x31, 0x70, 0xF0, 0xD0, 0xF3, 0x2F, 0x19, 0xF1, 0xB1, 0xF0, 0x20, 0xF3,
+0x21, 0xF8, 0x24, 0xF1, 0x22, 0xF2, 0xD0, 0xA0, 0xC0, 0x0F, 0x00, 0x40, 0x01, 0x70, 0x0B, 0x80,
+0x50, 0x0D, 0x90, 0x70, 0x04, 0x30, 0x09, 0x50, 0xC0, 0x0F, 0x02, 0x30, 0x0F, 0x07, 0x90, 0x40,
+0x01, 0xC0, 0x90, 0xC1, 0x80, 0x50, 0x01, 0x40, 0x90, 0x0B, 0x50, 0x40, 0x80, 0x09, 0x70, 0x07,
+0xA0, 0xC0, 0x06, 0x90, 0x02, 0xA0, 0x09, 0xA0, 0xC0, 0x0C, 0x40, 0x80, 0xA0, 0x60, 0x10, 0xD1,
+0x21, 0xF1, 0x27, 0xF0, 0x60, 0xD0, 0xF1, 0x2F, 0x02, 0xF3, 0x24, 0xF7, 0x20, 0xF1, 0x21, 0xF3,
+0x20, 0xF0, 0xB1, 0xF2, 0x2F, 0x17, 0xF6, 0x70, 0x32, 0xA0, 0x70, 0x50, 0xC1, 0x50, 0xE0, 0xC0,
+0x01, 0x02, 0x50, 0xA0, 0x00, 0x90, 0x10, 0x00, 0x80, 0xA0, 0x90, 0x01, 0xA0, 0xB0, 0xD0, 0xF7,
+0x20, 0xFF, 0x0B, 0x22, 0xF7, 0xB1, 0xF0, 0x20, 0xFF, 0x0C, 0xD0, 0xB0, 0x30, 0x0F, 0x00, 0x40,
+0x01, 0xC0, 0x30, 0x0A, 0x30, 0x0D, 0xC0, 0x10, 0x40, 0x04, 0x30, 0x09, 0x51, 0x0F, 0x01, 0xC0,
+0x30, 0x0F, 0x05, 0xC0, 0x40, 0xC0, 0x02, 0x40, 0x00, 0xC1, 0x81, 0x02, 0xC0, 0x40, 0x50, 0x0A,
+0x40, 0x90, 0x08, 0x41, 0x06, 0x30, 0x40, 0x06, 0xC0, 0x50, 0x02, 0x80, 0x40, 0x07, 0xC0, 0x30,
+0x0B, 0xC0, 0x10, 0xA0, 0x10, 0x70, 0xB0, 0x70, 0xD0, 0xF0, 0x21, 0xF1, 0x27, 0xD0, 0x60, 0xD0,
+0xF1, 0x2F, 0x00, 0xFF, 0x0C, 0x20, 0xF0, 0xB1, 0xF6, 0x20, 0xF0, 0x20, 0xFF, 0x0B, 0x20, 0xF8,
+0xD0, 0xF0, 0xA0, 0x01, 0x50, 0x80, 0x50, 0x70, 0xE0, 0x70, 0xA0, 0x50, 0x02, 0x02, 0x90, 0x30,
+0x01, 0x90, 0x70, 0x80, 0xA0, 0x50, 0x01, 0x30, 0xB0, 0xD0, 0xF3, 0x2F, 0x1A, 0xF0, 0xB1, 0xF5,
+0x26, 0xF6, 0x28, 0xF0, 0xD1, 0xA0, 0xC0, 0x0E, 0x40, 0x02, 0x80, 0x90, 0x09, 0xE0, 0xA0, 0x30,
+0x40, 0x50, 0xC0, 0x08, 0x10, 0x40, 0x04, 0x50, 0x80, 0x09, 0xC0, 0x50, 0x0F, 0x01, 0xC0, 0x80,
+0x0F, 0x03, 0xC0, 0x40, 0x50, 0x03, 0x51, 0x00, 0xC1, 0x80, 0x50, 0x90, 0x03, 0x50, 0x40, 0xC0,
+0x08, 0xA0, 0xC0, 0x07, 0xC0, 0x70, 0x04, 0x50, 0x40, 0xC0, 0xA0, 0x07, 0xC0, 0x50, 0x03, 0x70,
+0x07, 0x90, 0x40, 0x0C, 0x91, 0x70, 0x10, 0x70, 0x80, 0xD1, 0x2A, 0xF1, 0x60, 0xD0, 0xF1, 0x2F,
+0x07, 0xF9, 0x25, 0xF6, 0xB1, 0xF0, 0x20, 0xF0, 0x2F, 0x15, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xD0,
+0xF0, 0xA0, 0x01, 0xC0, 0x80, 0x04, 0xC0, 0x02, 0x03, 0xE0, 0x30, 0x01, 0x40, 0x10, 0xA0, 0x50,
+0x01, 0x30, 0xB0, 0xD0, 0xF3, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x27, 0xF5, 0x60,
+0xF0, 0x20, 0xF3, 0x26, 0xF3, 0x20, 0xF4, 0x25, 0xF2, 0xB0, 0x70, 0x0E, 0x40, 0x03, 0x70, 0x08,
+0xC0, 0x80, 0x00, 0xC0, 0x40, 0x80, 0x30, 0xA1, 0x80, 0x50, 0x01, 0xC0, 0x40, 0x70, 0xE0, 0x05,
+0x40, 0x90, 0x09, 0xC0, 0x90, 0x0C, 0x80, 0x50, 0x01, 0x50, 0x80, 0x0F, 0x02, 0x90, 0x40, 0x05,
+0x40, 0x01, 0xC1, 0x80, 0xC0, 0x40, 0x05, 0x90, 0x40, 0x07, 0x70, 0x08, 0x40, 0x50, 0x04, 0xA0,
+0x70, 0xE0, 0x50, 0x07, 0x51, 0x04, 0x70, 0x40, 0x04, 0x30, 0x70, 0x0F, 0x01, 0xA0, 0x30, 0x80,
+0x30, 0xD0, 0xF0, 0x21, 0xF0, 0x27, 0xF0, 0x60, 0xD1, 0xF1, 0x24, 0xF1, 0x2E, 0xF8, 0x27, 0xF5,
+0xB1, 0xF4, 0x28, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x24, 0xF6, 0xD0, 0xB0, 0xA0, 0x01, 0xC0, 0x80,
+0x03, 0x31, 0x90, 0x01, 0x09, 0x40, 0xE0, 0xA0, 0x30, 0x70, 0xB0, 0xD0, 0xF5, 0x20, 0xFF, 0x19,
+0x60, 0xF0, 0x20, 0xF2, 0x28, 0xF3, 0x28, 0xF4, 0xB0, 0xA0, 0x0E, 0x90, 0x03, 0x50, 0xA0, 0x06,
+0xE0, 0x91, 0x06, 0x50, 0x80, 0xA0, 0x13, 0x30, 0x05, 0x30, 0x0B, 0x90, 0x0F, 0x01, 0x50, 0x40,
+0x0F, 0x00, 0x50, 0x40, 0xC0, 0x05, 0x90, 0xC0, 0x01, 0xC1, 0x80, 0xC0, 0x00, 0x40, 0x06, 0x40,
+0x90, 0x05, 0x90, 0xA0, 0xC0, 0x06, 0x81, 0xE0, 0xA0, 0x80, 0xE0, 0x70, 0x40, 0x0A, 0x50, 0xC0,
+0x04, 0xC0, 0x10, 0x90, 0x00, 0x40, 0x80, 0x70, 0xC0, 0x02, 0x40, 0x10, 0x0D, 0xC0, 0x30, 0x10,
+0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x60, 0xF3, 0x20, 0xF0, 0x20, 0xF0,
+0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF7, 0x22, 0xF4, 0x28, 0xF4, 0xB1, 0xFF,
+0x1F, 0xD0, 0xB0, 0x70, 0x30, 0xA0, 0x70, 0x80, 0x03, 0x30, 0x80, 0x40, 0x01, 0x09, 0x90, 0x40,
+0x01, 0x61, 0xD0, 0xFF, 0x20, 0x60, 0xF0, 0x20, 0xF3, 0x2D, 0xFB, 0xD0, 0x30, 0x40, 0x0A, 0xC2,
+0x40, 0x04, 0x30, 0x50, 0x04, 0x50, 0xE0, 0x40, 0xC0, 0x0B, 0xC0, 0x50, 0x40, 0xA1, 0x30, 0x40,
+0x90, 0xC0, 0xA0, 0x0A, 0x50, 0x40, 0x0F, 0x01, 0x90, 0x40, 0x0D, 0xC0, 0x40, 0x50, 0x07, 0x40,
+0x02, 0xC1, 0x80, 0xC0, 0x00, 0x50, 0xC0, 0x06, 0xC0, 0x40, 0x50, 0x04, 0x50, 0x70, 0x80, 0x05,
+0x30, 0xA0, 0x01, 0x50, 0x0D, 0x90, 0x50, 0xC0, 0x02, 0x50, 0xA0, 0x00, 0x80, 0xA0, 0x80, 0x50,
+0x05, 0x70, 0x02, 0x50, 0xC0, 0x02, 0xC0, 0x90, 0x40, 0x80, 0x31, 0x40, 0x50, 0x10, 0x80, 0xD0,
+0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0x60, 0xB1, 0xF0, 0x20, 0xFF, 0x09, 0x2D, 0xF5, 0xB1,
+0xFF, 0x1F, 0xD0, 0xB0, 0x80, 0x01, 0x50, 0x40, 0x03, 0xC0, 0x90, 0x02, 0x09, 0x50, 0x40, 0x01,
+0x90, 0x60, 0xD0, 0xF3, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xFF, 0x02, 0xD0, 0x60, 0x21, 0xF6, 0x22,
+0xF1, 0x27, 0xF3, 0xD3, 0xF0, 0xD1, 0x30, 0x50, 0x00, 0xC1, 0x51, 0x91, 0x41, 0x91, 0x52, 0x40,
+0xC0, 0x04, 0x70, 0x02, 0x40, 0x11, 0x80, 0xE0, 0x0F, 0x02, 0xC0, 0x50, 0x40, 0x80, 0xE0, 0x31,
+0x80, 0x40, 0xC1, 0x50, 0x92, 0x50, 0xC0, 0x40, 0x0F, 0x01, 0x40, 0x90, 0x0C, 0x40, 0x90, 0x08,
+0x40, 0x03, 0xC1, 0x80, 0xC0, 0x01, 0x40, 0x08, 0x50, 0x40, 0xC0, 0x04, 0x80, 0x40, 0x04, 0x70,
+0x0F, 0x02, 0x40, 0x51, 0x42, 0xA0, 0xC0, 0x0E, 0x30, 0x10, 0x70, 0xA0, 0xE0, 0x70, 0x40, 0x90,
+0xC2, 0x00, 0x80, 0x11, 0xD1, 0x20, 0xF5, 0x21, 0xF1, 0x60, 0xB2, 0x64, 0xB3, 0xF6, 0xD4, 0xF3,
+0x26, 0xF1, 0x22, 0xF0, 0x20, 0xF6, 0xB0, 0xF9, 0x20, 0xF6, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF6, 0xD0, 0xB0, 0x80, 0x01, 0x50, 0x40, 0x08, 0x09, 0xC0, 0x70, 0x80, 0x30, 0x70, 0x60,
+0xD0, 0xF0, 0x20, 0xF1, 0x2F, 0x0B, 0xFF, 0x00, 0xD0, 0x60, 0xF0, 0x20, 0xFC, 0x22, 0xF6, 0xB2,
+0x64, 0x30, 0x92, 0x50, 0xC2, 0x07, 0x50, 0xC0, 0x04, 0x90, 0x80, 0x01, 0xC0, 0x30, 0x50, 0x11,
+0xA0, 0x0F, 0x05, 0x80, 0x00, 0x90, 0x81, 0x41, 0x80, 0xA1, 0x30, 0x40, 0x50, 0x40, 0x0F, 0x01,
+0x40, 0x50, 0x0A, 0x90, 0x40, 0x09, 0xC0, 0x90, 0x03, 0xC1, 0x80, 0x50, 0x01, 0x51, 0x09, 0x90,
+0x40, 0x04, 0x70, 0x03, 0x30, 0xA0, 0x0F, 0x02, 0x40, 0x03, 0xA0, 0xC0, 0x50, 0x91, 0x40, 0x50,
+0xC0, 0x04, 0xC0, 0x40, 0x30, 0xA1, 0x80, 0x40, 0xA0, 0x51, 0x03, 0x80, 0xE0, 0xA0, 0x10, 0x90,
+0x70, 0xE0, 0xD0, 0xF6, 0x21, 0xF1, 0xB0, 0xD1, 0xF0, 0xD3, 0xF1, 0xB5, 0x65, 0xB2, 0xF8, 0x20,
+0xF6, 0x21, 0xF3, 0x20, 0xF0, 0xB0, 0xF6, 0x25, 0xF2, 0x2F, 0x0B, 0xF4, 0xD0, 0xB0, 0xE0, 0x31,
+0xA0, 0x90, 0x08, 0x09, 0xC0, 0x30, 0xC0, 0x00, 0x90, 0x80, 0xD0, 0xF0, 0x2F, 0x0E, 0xF1, 0x27,
+0xF5, 0xD0, 0x60, 0xF2, 0xD1, 0xF1, 0xD2, 0xF1, 0xB5, 0x65, 0xB2, 0x20, 0xF1, 0xD1, 0xF0, 0x70,
+0x0E, 0x51, 0x05, 0x30, 0x50, 0x00, 0xC0, 0x80, 0x02, 0x10, 0x90, 0x0E, 0xC0, 0x50, 0x91, 0x40,
+0x80, 0x50, 0x08, 0x50, 0x40, 0x80, 0xA1, 0x32, 0x81, 0x40, 0x50, 0xC0, 0x06, 0x40, 0x50, 0x08,
+0x50, 0x40, 0xC0, 0x0A, 0x40, 0x04, 0xC1, 0x80, 0x50, 0x02, 0x40, 0x0B, 0x40, 0x50, 0x02, 0xA0,
+0x00, 0xC0, 0x50, 0x90, 0x40, 0x0F, 0x02, 0xC0, 0x50, 0x02, 0x70, 0xC0, 0x02, 0xC0, 0x90, 0x40,
+0x30, 0x71, 0x30, 0x70, 0xE0, 0xA0, 0x40, 0x0C, 0x11, 0x30, 0x10, 0xA0, 0x70, 0x60, 0xD0, 0xF2,
+0x20, 0xF1, 0x22, 0xB1, 0xD0, 0xFB, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF2, 0x20, 0xB2, 0x66, 0xB4,
+0xF1, 0xD1, 0xF2, 0xD0, 0xF3, 0x60, 0xF4, 0x2F, 0x17, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0x40, 0x01,
+0x80, 0x90, 0x08, 0x09, 0xC0, 0x80, 0x01, 0x50, 0x30, 0xD0, 0xF0, 0x2F, 0x0E, 0xFE, 0xD0, 0xF0,
+0x60, 0xB0, 0x20, 0xB4, 0x64, 0xB3, 0xFF, 0x00, 0xD0, 0x60, 0x70, 0x30, 0xC0, 0x0B, 0xC0, 0x50,
+0x06, 0xA0, 0x00, 0x40, 0xA0, 0x0D, 0xC0, 0x51, 0x41, 0x90, 0x50, 0xC0, 0x01, 0x90, 0x40, 0x0C,
+0x90, 0x02, 0xC1, 0x50, 0x41, 0x80, 0x30, 0xA1, 0x70, 0x81, 0x40, 0x70, 0x40, 0x90, 0x50, 0xC1,
+0x02, 0xC0, 0x90, 0xC0, 0x0B, 0x50, 0xC0, 0x04, 0xC1, 0x80, 0xC0, 0x02, 0xC0, 0x90, 0x0B, 0x50,
+0x40, 0x50, 0x00, 0x81, 0xA0, 0x40, 0x70, 0x80, 0x90, 0x50, 0x0F, 0x00, 0x50, 0xC1, 0x80, 0x10,
+0x80, 0x40, 0x30, 0xA1, 0x80, 0x70, 0x40, 0x50, 0xC0, 0x03, 0xC0, 0x50, 0x40, 0x91, 0x50, 0xC1,
+0x09, 0xE0, 0x30, 0x80, 0xE0, 0xD0, 0xF4, 0x21, 0xF1, 0xB1, 0xD0, 0xF5, 0x20, 0xF2, 0x20, 0xFD,
+0xD2, 0xF3, 0xB3, 0x64, 0xB5, 0x20, 0x60, 0xF0, 0xD0, 0xFE, 0x2F, 0x0B, 0xF0, 0x21, 0xF0, 0xD0,
+0x60, 0x40, 0x01, 0x40, 0x90, 0x08, 0x09, 0xC0, 0x30, 0x01, 0x90, 0x30, 0xD0, 0xF0, 0x20, 0xF0,
+0x28, 0xF2, 0x21, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0xD3, 0xF3, 0xB4, 0x64,
+0xB5, 0x22, 0xF2, 0xD1, 0xFF, 0x02, 0xD2, 0xB0, 0xA1, 0xC0, 0x09, 0xC0, 0x90, 0x06, 0x90, 0x80,
+0x40, 0x70, 0x07, 0xC1, 0x50, 0x90, 0x40, 0x90, 0x50, 0xC1, 0x06, 0x40, 0x50, 0x0C, 0x40, 0x0A,
+0xC0, 0x30, 0xC0, 0x52, 0x41, 0x83, 0xA0, 0x80, 0xA0, 0x70, 0x31, 0x82, 0x42, 0x92, 0x51, 0x40,
+0x50, 0xC4, 0x51, 0x80, 0x50, 0x03, 0x40, 0x0D, 0x90, 0x40, 0x00, 0x70, 0xA0, 0x01, 0xC0, 0x11,
+0x05, 0xC3, 0x50, 0x40, 0x82, 0x32, 0xA0, 0x30, 0x91, 0x50, 0xC0, 0x02, 0xE0, 0x0A, 0xC1, 0x50,
+0x90, 0x41, 0x90, 0xC1, 0x02, 0x90, 0xC1, 0x70, 0xD0, 0xE0, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF1,
+0xB1, 0xF8, 0x21, 0xF0, 0x20, 0xF4, 0x20, 0xFF, 0x06, 0x21, 0xF0, 0xB4, 0x64, 0xB4, 0xF3, 0xD2,
+0xF3, 0x22, 0xF0, 0x20, 0xF4, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21,
+0xD0, 0x81, 0x01, 0x80, 0x50, 0x08, 0x0A, 0x70, 0x33, 0xD0, 0x21, 0xFF, 0x09, 0x20, 0xB2, 0x65,
+0xB5, 0xF1, 0xD2, 0xB0, 0xF0, 0xD0, 0xF1, 0xD1, 0xF1, 0x23, 0xF2, 0x26, 0xFA, 0xA0, 0x60, 0xF0,
+0xD1, 0x70, 0x0A, 0x90, 0x07, 0xA0, 0x41, 0x02, 0xC0, 0x50, 0x41, 0x91, 0x50, 0xC0, 0x0C, 0x30,
+0xC0, 0x0C, 0x90, 0xC0, 0x09, 0x50, 0x40, 0x08, 0xC0, 0x90, 0x04, 0xC1, 0x51, 0x90, 0x44, 0x30,
+0x40, 0x87, 0x70, 0x50, 0x04, 0x40, 0x0E, 0x91, 0x80, 0x02, 0x40, 0x10, 0x80, 0x30, 0xA1, 0x32,
+0x82, 0x40, 0x90, 0x51, 0xC0, 0x00, 0x90, 0x07, 0x50, 0x70, 0xC0, 0x0F, 0x01, 0xC0, 0x50, 0x91,
+0x80, 0x40, 0x72, 0xB1, 0x10, 0xD1, 0x20, 0xD0, 0xF0, 0xD0, 0x20, 0xF1, 0xD0, 0x60, 0x21, 0xF1,
+0x22, 0xF0, 0x28, 0xF9, 0x20, 0xF0, 0x26, 0xF0, 0x23, 0xF7, 0xD0, 0x60, 0xD2, 0xF1, 0xB4, 0x66,
+0xB2, 0x20, 0xFF, 0x09, 0x21, 0xD0, 0x80, 0xA0, 0x80, 0x30, 0x70, 0x50, 0x08, 0x0A, 0x30, 0x01,
+0xC0, 0xA0, 0xD0, 0xF6, 0xD3, 0xF1, 0xD1, 0xB4, 0x67, 0xB2, 0xF4, 0xD0, 0xF9, 0xD0, 0x60, 0x20,
+0xF6, 0x23, 0xFF, 0x02, 0x21, 0xF1, 0xE1, 0x10, 0x61, 0x30, 0x09, 0x40, 0x07, 0xC0, 0x10, 0x40,
+0x90, 0x41, 0x50, 0xC0, 0x0F, 0x03, 0xA0, 0x0D, 0xC0, 0x50, 0x09, 0x80, 0x70, 0x34, 0x80, 0x40,
+0x90, 0x80, 0x40, 0xC0, 0x0E, 0x90, 0x06, 0xC1, 0x40, 0xC0, 0x04, 0x50, 0xC0, 0x0D, 0xC0, 0x70,
+0x30, 0x50, 0x40, 0x81, 0x10, 0xC0, 0x0D, 0x51, 0x05, 0x40, 0x70, 0x80, 0xC0, 0x0F, 0x07, 0x50,
+0x31, 0x90, 0xA1, 0x60, 0xB1, 0xF3, 0xD0, 0xF1, 0xD0, 0x60, 0xF0, 0x20, 0xF1, 0x29, 0xFF, 0x07,
+0x20, 0xF0, 0x20, 0xD1, 0xF5, 0x20, 0xD0, 0x60, 0xD0, 0xF5, 0xD6, 0xF2, 0xB2, 0x67, 0xB4, 0xF1,
+0xD4, 0xF0, 0xD0, 0xF5, 0xD0, 0x80, 0x90, 0x01, 0x80, 0x50, 0x08, 0x0A, 0x30, 0x02, 0xA0, 0xD0,
+0xF1, 0x20, 0xF1, 0xB4, 0x64, 0xB4, 0xF2, 0xD6, 0xF1, 0x26, 0xF7, 0xD0, 0xB0, 0x20, 0xF6, 0x23,
+0xFF, 0x01, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0xB0, 0xD1, 0x80, 0xA0, 0x80, 0x07, 0x90, 0x01, 0xC0,
+0x51, 0x90, 0x40, 0x90, 0x50, 0xA0, 0x0F, 0x09, 0xA0, 0x0E, 0x40, 0x09, 0x80, 0xC0, 0x02, 0xC1,
+0x90, 0x80, 0x42, 0x80, 0x30, 0x70, 0x0B, 0x40, 0x07, 0xC1, 0x81, 0x45, 0x80, 0x40, 0x82, 0x34,
+0xA1, 0x70, 0x90, 0x00, 0xE0, 0x30, 0x41, 0x80, 0x90, 0xC0, 0x10, 0x0E, 0x40, 0x05, 0x80, 0x30,
+0x50, 0x0F, 0x08, 0xC0, 0x90, 0x80, 0xA2, 0xD0, 0xF0, 0xB1, 0x62, 0xB1, 0xF2, 0x60, 0xD0, 0xF4,
+0x2A, 0xF3, 0x22, 0xFB, 0x20, 0xF3, 0x60, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0x60, 0xF8, 0x20,
+0xF2, 0x22, 0xF0, 0xD7, 0xF3, 0xB3, 0x65, 0xB3, 0xF3, 0xD1, 0x30, 0x50, 0x01, 0x80, 0xC0, 0x08,
+0x0A, 0xA0, 0x90, 0x40, 0x80, 0x70, 0x63, 0xB6, 0x20, 0xF2, 0xD0, 0xFF, 0x03, 0x22, 0xF1, 0x23,
+0xF3, 0xD0, 0xB1, 0xF1, 0x27, 0xF9, 0x2B, 0xF1, 0xD1, 0xF0, 0x20, 0xD0, 0xB0, 0x30, 0x40, 0x03,
+0xC1, 0x50, 0x41, 0x91, 0xC1, 0x03, 0x80, 0x50, 0x0F, 0x07, 0xC0, 0x80, 0x0C, 0xC0, 0x50, 0x40,
+0xC0, 0x08, 0x30, 0xC0, 0x03, 0x50, 0x90, 0x05, 0xA0, 0x0A, 0xC0, 0x50, 0x07, 0xC1, 0x81, 0x93,
+0x51, 0x90, 0x40, 0x51, 0xC3, 0x03, 0x50, 0x80, 0x00, 0xA0, 0x03, 0x50, 0x90, 0x70, 0x80, 0x0D,
+0x40, 0x90, 0xC0, 0x02, 0x80, 0xA0, 0x0F, 0x0B, 0x70, 0xE0, 0xA0, 0x10, 0xD1, 0xF1, 0x21, 0xF2,
+0xB1, 0x62, 0xB1, 0xF1, 0xD1, 0xF3, 0x25, 0xF2, 0x29, 0xF6, 0xD0, 0xF0, 0x21, 0x60, 0x70, 0xD1,
+0xF5, 0xB0, 0xD0, 0xF1, 0x2B, 0xFF, 0x05, 0x22, 0xF0, 0xB4, 0x63, 0xA0, 0x30, 0x40, 0x90, 0xA0,
+0x09, 0x0A, 0xA0, 0x91, 0x50, 0xA0, 0xD5, 0xF5, 0x23, 0xF0, 0x27, 0xF4, 0x2F, 0x00, 0xF1, 0xD0,
+0xB1, 0xF0, 0x27, 0xF4, 0x20, 0xF0, 0x2C, 0xF6, 0xD0, 0x21, 0xD0, 0xB0, 0x70, 0x50, 0x90, 0x41,
+0x90, 0x50, 0xC0, 0x51, 0x07, 0x90, 0x30, 0x0F, 0x07, 0x90, 0x40, 0x0A, 0x50, 0x40, 0x90, 0xC1,
+0x90, 0x08, 0x30, 0x02, 0x50, 0x40, 0xC0, 0x06, 0x30, 0x0A, 0x40, 0x08, 0xC0, 0x50, 0x90, 0x40,
+0x06, 0x40, 0x09, 0x70, 0xC0, 0x50, 0x30, 0x05, 0x30, 0x80, 0x0C, 0x51, 0xC0, 0x92, 0xA0, 0x40,
+0x0F, 0x0C, 0x40, 0x70, 0x10, 0x30, 0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0xD1, 0xB4, 0x62, 0xB0,
+0xF1, 0xD1, 0xF8, 0x29, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xFA, 0xB0, 0xD0, 0xF0, 0x2F, 0x02,
+0xF4, 0x22, 0xF2, 0x27, 0xF3, 0xD5, 0xA0, 0x50, 0x91, 0x70, 0x09, 0x0A, 0x30, 0x02, 0xA0, 0xD1,
+0xF3, 0x29, 0xF7, 0x25, 0xF4, 0x2A, 0xF2, 0x20, 0xB0, 0xF0, 0x28, 0xF2, 0x2E, 0xF2, 0x20, 0xF0,
+0xD1, 0xB2, 0x62, 0xB0, 0x70, 0xC0, 0x05, 0x90, 0x08, 0x10, 0x90, 0x0F, 0x06, 0x40, 0x90, 0x07,
+0x50, 0x41, 0xC0, 0x03, 0x40, 0x08, 0x30, 0x00, 0xC0, 0x40, 0xC0, 0x08, 0x30, 0x09, 0x50, 0xC0,
+0x08, 0xC0, 0x50, 0xC0, 0x80, 0x07, 0x40, 0x08, 0x31, 0x70, 0x80, 0x06, 0xC0, 0x40, 0x50, 0x0A,
+0x40, 0x02, 0x30, 0x80, 0x91, 0x50, 0x02, 0x50, 0x90, 0x40, 0x80, 0x31, 0x40, 0x0E, 0xA0, 0xE0,
+0x70, 0x61, 0xD1, 0x20, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xB1, 0xD0, 0xF2, 0xD0, 0xF0, 0xB1, 0x63,
+0xB1, 0xF0, 0xD1, 0xF3, 0x2E, 0xF0, 0x21, 0xF0, 0x20, 0xF3, 0x20, 0xF2, 0xB1, 0xF2, 0x2C, 0xF3,
+0x24, 0xF2, 0x22, 0xF1, 0x22, 0xF2, 0x25, 0xF2, 0xD0, 0xA0, 0x02, 0x30, 0x09, 0x0A, 0x80, 0xC0,
+0x01, 0x70, 0xD0, 0xF2, 0x2F, 0x00, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x20, 0xF3, 0x2B, 0xF2, 0x20,
+0x60, 0xD0, 0xF0, 0x21, 0xF2, 0x2B, 0xF9, 0x20, 0xB1, 0x62, 0xB2, 0xD0, 0x60, 0x10, 0xD1, 0x70,
+0x05, 0x40, 0x07, 0x50, 0x70, 0x50, 0x0F, 0x06, 0x80, 0xC0, 0x04, 0xC0, 0x90, 0x40, 0x50, 0x06,
+0xC0, 0x50, 0x07, 0xA0, 0x90, 0x50, 0x09, 0xC0, 0x30, 0x09, 0x40, 0x09, 0xC0, 0x50, 0xC0, 0x30,
+0x07, 0x90, 0xC0, 0x09, 0xE0, 0x09, 0x50, 0x40, 0xC0, 0x07, 0xC0, 0x50, 0x01, 0x80, 0x40, 0x03,
+0x40, 0x80, 0x70, 0x80, 0x40, 0x90, 0x50, 0x00, 0x50, 0x30, 0x40, 0x50, 0x41, 0x81, 0x08, 0xE0,
+0x80, 0xD2, 0xF5, 0x25, 0xD0, 0x60, 0xF2, 0x22, 0xF1, 0xD1, 0xF2, 0xB1, 0x61, 0xB2, 0xFB, 0x25,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xF4, 0x2A, 0xF2, 0x20,
+0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x22, 0xF2, 0x2A, 0xF0, 0xD0, 0x70, 0x01, 0xC0, 0x80,
+0x09, 0x0A, 0x40, 0xE0, 0x30, 0x80, 0x70, 0xB0, 0xF0, 0x26, 0xF6, 0x2F, 0x0B, 0xF0, 0x22, 0xF2,
+0x60, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0x22, 0xF4, 0xD0, 0xF1, 0xB2, 0x61, 0xB2, 0xF1, 0xD1, 0xF1,
+0xD1, 0x60, 0xF0, 0xD0, 0x80, 0x30, 0x04, 0x40, 0x06, 0xC0, 0xA0, 0xC0, 0x0F, 0x07, 0x30, 0xC0,
+0x01, 0xC0, 0x50, 0x40, 0x50, 0xC0, 0x09, 0x40, 0x06, 0x50, 0x30, 0x0B, 0xC0, 0x80, 0x08, 0x40,
+0xC0, 0x09, 0xC0, 0x50, 0x00, 0xA0, 0x08, 0x40, 0x08, 0x80, 0x40, 0x0B, 0x91, 0x06, 0x90, 0x01,
+0x90, 0x80, 0x00, 0xC1, 0x50, 0x31, 0x50, 0xC0, 0x90, 0x50, 0x04, 0x81, 0x40, 0x50, 0xC0, 0x50,
+0xA0, 0x50, 0x05, 0x80, 0x30, 0xD0, 0xF1, 0x20, 0xF1, 0x29, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0xF4,
+0x22, 0xF5, 0xB2, 0x62, 0xB1, 0xF1, 0xD0, 0xF3, 0x29, 0xF0, 0x22, 0xF2, 0x60, 0xF7, 0x25, 0xF3,
+0x2F, 0x0B, 0xF2, 0xD0, 0xB0, 0x70, 0x80, 0x30, 0x70, 0x80, 0x09, 0x0A, 0x50, 0x40, 0x01, 0x40,
+0x60, 0xF1, 0x24, 0xF8, 0x2E, 0xF2, 0x28, 0xF3, 0x20, 0xD0, 0x60, 0xF1, 0x21, 0xFB, 0xD0, 0xF0,
+0x20, 0xB1, 0x62, 0xB1, 0xF1, 0xD0, 0xF9, 0xA0, 0xD0, 0xF0, 0xD1, 0xA0, 0x50, 0x03, 0x90, 0x80,
+0xC0, 0x04, 0x80, 0xC0, 0x0F, 0x08, 0x30, 0x00, 0x50, 0x40, 0x90, 0xC0, 0x0C, 0x90, 0xC0, 0x03,
+0x50, 0x40, 0xC0, 0xA0, 0x0B, 0x50, 0x80, 0x07, 0xC0, 0x90, 0x0A, 0xC0, 0x50, 0x00, 0xA0, 0x08,
+0x50, 0xC0, 0x06, 0x50, 0xE0, 0x0E, 0x90, 0x50, 0x02, 0xC0, 0x90, 0x81, 0xA0, 0xE0, 0x70, 0x31,
+0x80, 0x31, 0x03, 0xC0, 0x90, 0x40, 0x50, 0x08, 0xA0, 0x80, 0x03, 0x90, 0xE0, 0xD0, 0xF0, 0x22,
+0xF1, 0x23, 0xF0, 0x23, 0xF0, 0x20, 0x60, 0xF2, 0x20, 0xF3, 0x27, 0xF3, 0xD1, 0xF1, 0xB1, 0x63,
+0xB0, 0xF1, 0xD0, 0xF3, 0x21, 0xF5, 0x20, 0xF2, 0x60, 0xD0, 0x20, 0xF5, 0x20, 0xF0, 0x25, 0xF0,
+0x2F, 0x03, 0xF3, 0x23, 0xF4, 0x60, 0x80, 0x01, 0x90, 0x40, 0x09, 0x0A, 0xC0, 0x30, 0x01, 0x90,
+0x80, 0xD0, 0xF1, 0x22, 0xFF, 0x09, 0x22, 0xFE, 0xB0, 0xF1, 0x22, 0xF2, 0xD2, 0xF1, 0xB1, 0x63,
+0xB0, 0xF0, 0xD1, 0xF8, 0x20, 0xF2, 0x21, 0xD0, 0xE0, 0xB0, 0xF1, 0xD0, 0x60, 0x40, 0x04, 0xE0,
+0x70, 0x04, 0x70, 0x0F, 0x08, 0xC0, 0x30, 0x90, 0xC0, 0x0F, 0x01, 0x40, 0x01, 0xC0, 0x40, 0x50,
+0x01, 0x30, 0x0B, 0x50, 0x80, 0x07, 0x40, 0x0B, 0xC0, 0x50, 0x00, 0xA0, 0x09, 0x40, 0x06, 0xC0,
+0xA0, 0x06, 0xC0, 0x50, 0x42, 0x80, 0x33, 0xA0, 0x71, 0xE0, 0x80, 0x90, 0xC0, 0x05, 0x30, 0x40,
+0x00, 0xC0, 0x04, 0xC0, 0x41, 0x50, 0x06, 0x40, 0xA0, 0xC0, 0x01, 0x30, 0x70, 0xD0, 0x23, 0xF2,
+0x21, 0xF6, 0xB1, 0xD0, 0xF0, 0x26, 0xF2, 0x20, 0xF1, 0x23, 0xF7, 0xD1, 0xF0, 0xB1, 0x62, 0xB1,
+0xF0, 0xD1, 0xF1, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xD0, 0x60, 0xF1, 0x21, 0xF3, 0x27, 0xFF, 0x09,
+0x22, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0x40, 0x01, 0x40, 0x50, 0x09, 0x0B, 0x70, 0x90, 0x40, 0x31,
+0xD0, 0xF2, 0x22, 0xF5, 0x21, 0xFF, 0x02, 0x24, 0xFA, 0xB1, 0xD0, 0xF5, 0xB1, 0x62, 0xB1, 0xF0,
+0xD4, 0xF4, 0x26, 0xF1, 0x22, 0xF4, 0xD0, 0x60, 0x40, 0x04, 0x30, 0xE0, 0x40, 0x02, 0xA0, 0x50,
+0x0F, 0x05, 0xC0, 0x90, 0x40, 0x50, 0x80, 0x0F, 0x03, 0x51, 0x91, 0x02, 0x50, 0x80, 0x0B, 0x50,
+0x40, 0x06, 0x51, 0x0B, 0xC0, 0x50, 0x00, 0xA0, 0x09, 0xC0, 0x50, 0x05, 0x80, 0x70, 0x80, 0x32,
+0xA1, 0x31, 0xE0, 0x50, 0x90, 0x30, 0x80, 0xC0, 0x03, 0x50, 0x90, 0x30, 0x50, 0x08, 0xA0, 0x10,
+0x30, 0x07, 0xC0, 0x40, 0x90, 0x50, 0x04, 0xC0, 0xA0, 0x80, 0x71, 0xF2, 0x21, 0xF0, 0x20, 0xF9,
+0xD0, 0x60, 0xF0, 0xD0, 0xF1, 0x23, 0xF2, 0x21, 0xF4, 0x26, 0xF4, 0xD4, 0xF0, 0xB1, 0x62, 0xB2,
+0xF0, 0xD1, 0xF1, 0xD0, 0xF0, 0x60, 0xF3, 0x21, 0xF1, 0x21, 0xF2, 0x24, 0xFF, 0x07, 0x24, 0xF1,
+0xD0, 0x60, 0xA0, 0x40, 0x90, 0x30, 0x50, 0x09, 0x0B, 0xE0, 0x90, 0x51, 0xA0, 0xD1, 0xF0, 0x24,
+0xF4, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x25,
+0xF4, 0x21, 0xF4, 0xD0, 0xB1, 0xF0, 0xB1, 0x62, 0xB1, 0xFA, 0x20, 0xF4, 0x22, 0xF5, 0x22, 0xF0,
+0xD0, 0xF0, 0xD0, 0xF1, 0x60, 0x40, 0x04, 0x90, 0x40, 0x02, 0xC0, 0x80, 0x0F, 0x03, 0xC0, 0x50,
+0x40, 0x50, 0xC0, 0x00, 0x90, 0x40, 0x0F, 0x03, 0x50, 0x80, 0xC0, 0x03, 0x90, 0x40, 0x0B, 0x90,
+0x40, 0x06, 0x40, 0x0C, 0xC0, 0x50, 0x00, 0xA0, 0x0A, 0x40, 0x04, 0xC0, 0x70, 0x50, 0xC2, 0x04,
+0x30, 0x00, 0x50, 0x80, 0x70, 0x10, 0x50, 0x04, 0x80, 0x90, 0x04, 0x50, 0x10, 0x02, 0x40, 0xE0,
+0x09, 0xC0, 0x50, 0x40, 0x50, 0xC0, 0x02, 0xA0, 0x80, 0xF0, 0xD1, 0xF1, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF3, 0x21, 0xF1, 0xD0, 0x60, 0xD1, 0xF1, 0x27, 0xF9, 0x23, 0xF3, 0x20, 0xF8, 0x21, 0xB2,
+0x61, 0xB4, 0xD0, 0xFF, 0x01, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x22, 0xF4, 0x23, 0xF2, 0xD0, 0x30, 0x40, 0x50, 0x90, 0x70, 0x01, 0xC0, 0x07,
+0x0B, 0x30, 0x02, 0x70, 0xD1, 0xF0, 0x24, 0xF3, 0x2F, 0x09, 0xF5, 0xD0, 0xF0, 0x20, 0xF0, 0xB0,
+0x62, 0xB1, 0xF1, 0xD1, 0xF1, 0x28, 0xF2, 0x25, 0xF0, 0x24, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD1,
+0x60, 0xA0, 0x50, 0x00, 0xC0, 0x50, 0x90, 0x40, 0x03, 0xC0, 0x70, 0x0F, 0x01, 0x50, 0x40, 0x90,
+0xC0, 0x03, 0x80, 0x50, 0x0F, 0x01, 0x50, 0x40, 0xC1, 0x90, 0x03, 0x40, 0x90, 0x0B, 0x41, 0x05,
+0x90, 0xC0, 0x0C, 0xC0, 0x50, 0x00, 0xA0, 0x0B, 0x40, 0x03, 0xA0, 0x50, 0x08, 0xA0, 0x03, 0xC1,
+0x03, 0xC0, 0x80, 0x41, 0x50, 0x02, 0x80, 0xE0, 0x03, 0x90, 0x30, 0x0B, 0xC0, 0x90, 0x40, 0x50,
+0x30, 0x60, 0xD1, 0xF1, 0x21, 0xF0, 0x24, 0xF2, 0x23, 0xF0, 0xD0, 0x61, 0xB1, 0xD0, 0xF7, 0x23,
+0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x26, 0xF3, 0x23, 0xF0, 0x21, 0xF2, 0xD1, 0xF0, 0xB2, 0x62, 0xB0,
+0xF0, 0x20, 0xF0, 0xD0, 0xF7, 0x2F, 0x07, 0xF2, 0x25, 0xF1, 0xD0, 0xA0, 0xC0, 0x01, 0x80, 0xC0,
+0x31, 0x50, 0x06, 0x0B, 0x30, 0x02, 0xA0, 0xD0, 0xF2, 0x23, 0xF3, 0x2F, 0x04, 0xF3, 0xD2, 0xF0,
+0xB1, 0x64, 0xB0, 0xD1, 0x60, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0x21,
+0xF2, 0x22, 0xF1, 0x25, 0xF3, 0xD0, 0xF0, 0xD0, 0x60, 0xA0, 0x30, 0x81, 0x32, 0x80, 0x40, 0x50,
+0xC0, 0x00, 0x41, 0x0C, 0x50, 0x41, 0xC0, 0x06, 0x30, 0x0F, 0x00, 0xC0, 0x40, 0x50, 0x02, 0x90,
+0xC0, 0x02, 0x80, 0xC0, 0x0B, 0xC0, 0x70, 0x40, 0x50, 0x03, 0x40, 0x0D, 0xC0, 0x50, 0x00, 0xA0,
+0x0B, 0x90, 0xC0, 0x02, 0xE0, 0x09, 0xA0, 0x08, 0xC0, 0x40, 0x00, 0xA0, 0x00, 0x50, 0x40, 0xC0,
+0x00, 0xC0, 0x05, 0x70, 0x10, 0xC0, 0x0C, 0x90, 0x30, 0xB1, 0xF0, 0xD0, 0xF3, 0x20, 0xF0, 0x21,
+0xF2, 0x24, 0xF0, 0xB1, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF1, 0xD1, 0xF0, 0x21, 0xF0, 0x22, 0xF4,
+0x21, 0xF4, 0x24, 0xF1, 0x22, 0xF1, 0x21, 0xF2, 0x21, 0xF0, 0xD0, 0x60, 0xD1, 0x20, 0xB0, 0x63,
+0xB1, 0xF0, 0xD2, 0xF4, 0x2F, 0x04, 0xF1, 0x24, 0xF2, 0xD0, 0xA0, 0xC0, 0x01, 0x30, 0xC0, 0x30,
+0x80, 0x90, 0x06, 0x0B, 0x80, 0x30, 0xA1, 0x70, 0xF2, 0x21, 0xF0, 0x20, 0xF4, 0x28, 0xF9, 0xD0,
+0xF1, 0xB2, 0x62, 0xB1, 0xF4, 0x21, 0xD0, 0x60, 0xF0, 0x22, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0x22,
+0xF1, 0x21, 0xF0, 0x25, 0xF2, 0x21, 0xF3, 0xD1, 0xF1, 0xB1, 0x60, 0xB0, 0xA0, 0x05, 0x40, 0x90,
+0x40, 0x30, 0xE0, 0x30, 0x0A, 0xC0, 0x90, 0x40, 0x50, 0x09, 0x30, 0x0E, 0x91, 0x05, 0x40, 0x02,
+0x30, 0x0E, 0x80, 0x30, 0x70, 0x01, 0x40, 0x0E, 0xC0, 0x50, 0x00, 0xA0, 0x0C, 0x40, 0x01, 0x70,
+0x80, 0x09, 0xA0, 0x08, 0x40, 0x01, 0x30, 0x02, 0x91, 0xC0, 0x06, 0xE0, 0x10, 0x0C, 0x10, 0x60,
+0xD0, 0xB0, 0x61, 0xB0, 0xF4, 0x20, 0xF1, 0x26, 0xF0, 0x60, 0xF3, 0xD0, 0xF1, 0xB0, 0x61, 0xB0,
+0xF0, 0xD1, 0xF4, 0x21, 0xF2, 0x29, 0xF0, 0x20, 0xF7, 0x20, 0xF1, 0x21, 0xF1, 0x60, 0xD0, 0xF0,
+0x20, 0xF4, 0xB1, 0x62, 0xB2, 0x20, 0xF0, 0xD0, 0xF9, 0x2B, 0xF0, 0x21, 0xF4, 0xD0, 0x70, 0xA1,
+0x30, 0xA0, 0x00, 0xC0, 0x50, 0x07, 0x08, 0x40, 0x80, 0x00, 0x40, 0x90, 0x01, 0x80, 0xB0, 0xD0,
+0x22, 0xF3, 0x2A, 0xF4, 0xD2, 0xF0, 0xB1, 0x62, 0xB2, 0x20, 0xF6, 0x22, 0xF0, 0xD0, 0xB1, 0xF0,
+0x22, 0xF0, 0x25, 0xF1, 0x29, 0xF0, 0x23, 0xF0, 0x21, 0xF0, 0xD0, 0xF1, 0xB1, 0x61, 0xB0, 0xF0,
+0xD1, 0x30, 0x50, 0x04, 0x90, 0x01, 0x90, 0x30, 0x08, 0xC0, 0x90, 0x40, 0x50, 0xC0, 0x0B, 0x30,
+0x0C, 0x50, 0x40, 0xC0, 0x06, 0xC0, 0x90, 0x01, 0xA0, 0x0F, 0x01, 0x90, 0xA0, 0x80, 0x40, 0x90,
+0x50, 0x0C, 0xC0, 0x50, 0x00, 0xA0, 0x0C, 0x50, 0xC0, 0x50, 0x70, 0x0A, 0xA0, 0x07, 0x51, 0x01,
+0x80, 0xC0, 0x02, 0xC0, 0x91, 0x05, 0x40, 0x50, 0xA0, 0x50, 0x0A, 0x10, 0xB0, 0xD0, 0xF1, 0x20,
+0xB0, 0x60, 0xB1, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF5, 0x20,
+0xB0, 0x61, 0xB1, 0xF1, 0xD0, 0xF3, 0x22, 0xF1, 0x28, 0xF1, 0x22, 0xF1, 0x21, 0xF1, 0x21, 0xF1,
+0x60, 0xF1, 0x21, 0xF8, 0xB2, 0x62, 0xB1, 0xF1, 0xD2, 0xF2, 0x27, 0xF1, 0x22, 0xF0, 0x20, 0xF0,
+0x20, 0xF2, 0xD0, 0xA0, 0x01, 0x50, 0x30, 0x00, 0xC0, 0x90, 0x50, 0xC0, 0x05, 0x03, 0x50, 0xE0,
+0x80, 0x01, 0xC0, 0xA0, 0x80, 0x50, 0x40, 0x01, 0x40, 0x60, 0xD0, 0x22, 0xF4, 0x23, 0xF9, 0xB0,
+0x63, 0xB1, 0xFA, 0x25, 0xF2, 0xB0, 0xD0, 0x21, 0xF1, 0x23, 0xF1, 0x20, 0xF2, 0x26, 0xF9, 0xB0,
+0x61, 0xB1, 0xF0, 0xD1, 0xF1, 0xD0, 0x60, 0x80, 0x04, 0x51, 0x01, 0x90, 0x70, 0x90, 0x04, 0x50,
+0x40, 0x90, 0xC0, 0x0E, 0x30, 0x07, 0xC0, 0x01, 0xC0, 0x40, 0x50, 0x09, 0x90, 0xC0, 0x00, 0xA0,
+0x0F, 0x03, 0x42, 0xA0, 0x51, 0x03, 0x70, 0xC0, 0x04, 0xC0, 0x50, 0x00, 0xA0, 0x0D, 0x40, 0xA0,
+0x50, 0x0A, 0xA0, 0x07, 0x40, 0x02, 0x50, 0x40, 0x04, 0xC0, 0x40, 0x50, 0x06, 0xA0, 0x09, 0x70,
+0x80, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xD1, 0xF0, 0x61, 0xB0, 0x20, 0xD0, 0xF1, 0x21, 0xF0, 0x21,
+0xF1, 0xB0, 0xD0, 0xF0, 0x20, 0xF7, 0xD0, 0xF0, 0xB1, 0x61, 0xB0, 0xF4, 0xD0, 0xF0, 0x21, 0xF2,
+0x24, 0xF1, 0x22, 0xF2, 0x21, 0xF1, 0x21, 0xF0, 0xB1, 0xD0, 0xF0, 0x26, 0xF1, 0x20, 0xF2, 0xD1,
+0xF1, 0xB1, 0x63, 0xB0, 0xF7, 0x20, 0xF3, 0x21, 0xF0, 0x22, 0xF2, 0xD0, 0xB0, 0x80, 0x01, 0x91,
+0x40, 0xE0, 0x30, 0x70, 0xE0, 0x70, 0xC0, 0x03, 0x04, 0x70, 0xA0, 0xE0, 0x02, 0x70, 0x00, 0x30,
+0x50, 0x40, 0xA0, 0x30, 0xD0, 0x23, 0xF1, 0x22, 0xF2, 0xD2, 0xB1, 0x63, 0xB1, 0xF0, 0x21, 0xF8,
+0x21, 0xF2, 0x20, 0xF3, 0x21, 0xF1, 0x60, 0xD0, 0x21, 0xF6, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF5,
+0xD1, 0xF0, 0xB0, 0x61, 0xB1, 0xF0, 0xD0, 0xF0, 0x20, 0xF5, 0xD0, 0xE0, 0x05, 0x90, 0x03, 0x80,
+0xA0, 0xC1, 0x41, 0x50, 0x0F, 0x02, 0x30, 0x07, 0x80, 0x00, 0x40, 0x90, 0x0C, 0x40, 0xC0, 0x30,
+0x0F, 0x02, 0x51, 0x02, 0xA0, 0x80, 0x72, 0x11, 0x51, 0x30, 0xA0, 0x30, 0x70, 0xA0, 0x90, 0x00,
+0x30, 0x0D, 0xC0, 0xA0, 0x0B, 0xA0, 0x06, 0x40, 0x80, 0x40, 0x02, 0xA0, 0x06, 0x50, 0x40, 0xC0,
+0x04, 0x50, 0x70, 0x90, 0x05, 0x50, 0xA0, 0x30, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0xD1, 0xB0,
+0x61, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF1, 0xD0, 0x60, 0xB0, 0xF0, 0x22, 0xF5, 0x24, 0xD0, 0xF1,
+0xB0, 0x61, 0xB0, 0xF1, 0xD2, 0xF3, 0x29, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xB1, 0xD0, 0x22, 0xF3,
+0x21, 0xF0, 0x21, 0xF8, 0x20, 0xF0, 0x20, 0xB1, 0x63, 0xB1, 0xF0, 0xD0, 0xF3, 0x25, 0xF1, 0x20,
+0xD0, 0x60, 0x70, 0x80, 0x90, 0x80, 0xC0, 0x70, 0x03, 0x50, 0xE0, 0x03, 0x04, 0x70, 0x00, 0x90,
+0xE0, 0x40, 0x31, 0x00, 0xE0, 0x40, 0x50, 0xC0, 0xA0, 0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0xF4, 0x20,
+0xB2, 0x61, 0xB1, 0xF5, 0x25, 0xF2, 0x22, 0xF1, 0x21, 0xF5, 0x21, 0xD0, 0xF0, 0x60, 0xD0, 0xF0,
+0x20, 0xF2, 0x20, 0xF3, 0x24, 0xF4, 0xD1, 0xF0, 0xB1, 0x61, 0xB0, 0xF0, 0xD0, 0xF2, 0x24, 0xF3,
+0xB0, 0x30, 0x05, 0x40, 0x10, 0x03, 0x40, 0x80, 0x30, 0x0F, 0x04, 0x50, 0x80, 0x06, 0x10, 0x50,
+0x90, 0x0E, 0xC0, 0x80, 0x30, 0x0F, 0x02, 0x40, 0x06, 0x90, 0x40, 0x01, 0x30, 0x80, 0x03, 0xC0,
+0x31, 0x70, 0xC0, 0x0C, 0x40, 0x30, 0x0B, 0x30, 0x05, 0x40, 0xC0, 0x90, 0x03, 0x30, 0xC0, 0x07,
+0x91, 0x05, 0x70, 0x05, 0x80, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF5, 0xD1, 0xF0, 0xB0, 0x61,
+0xF1, 0xD1, 0xF0, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0xF4, 0x23, 0xF0, 0xD2, 0xF0, 0xB0, 0x62,
+0xB0, 0xF0, 0xD2, 0xF2, 0x25, 0xF2, 0x22, 0xF1, 0x21, 0xD0, 0x60, 0xF1, 0x21, 0xF4, 0x22, 0xF2,
+0x20, 0xF3, 0x24, 0xF6, 0xB1, 0x62, 0xB1, 0xF4, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xA0, 0x51, 0x40,
+0x10, 0x00, 0x31, 0xC0, 0x02, 0xE0, 0x03, 0x04, 0xA0, 0x90, 0x00, 0xC0, 0x30, 0x80, 0x01, 0x30,
+0x02, 0x70, 0xD2, 0xF1, 0xB2, 0x62, 0xB1, 0xF2, 0xD1, 0xF5, 0x22, 0xF0, 0x21, 0xF2, 0x2D, 0xF1,
+0xD0, 0x60, 0xF1, 0x20, 0xF3, 0x26, 0xF1, 0xD1, 0xF1, 0xB1, 0x61, 0xB0, 0xF5, 0x24, 0xF7, 0x70,
+0x05, 0xC0, 0x30, 0xE0, 0x92, 0x01, 0x90, 0xA0, 0x50, 0x0F, 0x02, 0x40, 0x90, 0x05, 0x50, 0x80,
+0xC0, 0x0E, 0xC0, 0x90, 0xC0, 0x30, 0x0F, 0x01, 0x90, 0xC0, 0x0F, 0x01, 0xC2, 0x40, 0x30, 0xA0,
+0x0B, 0x70, 0x80, 0x90, 0x0A, 0x30, 0x04, 0x90, 0x50, 0x90, 0xC0, 0x03, 0x40, 0x90, 0x08, 0xC0,
+0x40, 0x50, 0x03, 0x90, 0x80, 0x01, 0xC1, 0xE0, 0xA0, 0xD1, 0xF1, 0x20, 0xF0, 0x24, 0xF4, 0xD0,
+0xF1, 0xB0, 0x60, 0xB0, 0xF0, 0xB1, 0xD0, 0xF0, 0xD0, 0xF0, 0x23, 0xF6, 0x24, 0xF4, 0x20, 0xB0,
+0x61, 0xB1, 0xF2, 0xD0, 0xF1, 0x26, 0xF3, 0x21, 0xF0, 0x60, 0xD0, 0xF3, 0x2A, 0xF3, 0x21, 0xF1,
+0x21, 0xF5, 0xD3, 0xF1, 0xB1, 0x61, 0xB1, 0xF3, 0xD1, 0x70, 0x02, 0x30, 0x01, 0x80, 0x71, 0xA0,
+0x70, 0x40, 0x03, 0x04, 0x50, 0xC0, 0x00, 0xC0, 0x91, 0xC0, 0x00, 0x80, 0xC0, 0x50, 0x40, 0x70,
+0xB1, 0x61, 0xB2, 0xF1, 0xD1, 0xFE, 0x22, 0xF0, 0x24, 0xF2, 0x29, 0xF1, 0xB1, 0xF3, 0x20, 0xF0,
+0x20, 0xF8, 0xB0, 0x61, 0xB0, 0xF0, 0xD2, 0xF0, 0x2A, 0xF3, 0x21, 0xD0, 0x60, 0x40, 0x04, 0x50,
+0x81, 0xA0, 0xC0, 0x04, 0x80, 0x30, 0x0F, 0x01, 0x30, 0xC0, 0x03, 0xC0, 0x40, 0x50, 0x0F, 0x00,
+0x50, 0x40, 0x01, 0xA0, 0x90, 0x0F, 0x00, 0x90, 0x0F, 0x02, 0xC0, 0x50, 0x02, 0x30, 0x0B, 0x50,
+0x80, 0x50, 0xC0, 0x09, 0x30, 0x03, 0x90, 0x50, 0x01, 0x80, 0x50, 0x02, 0x50, 0x80, 0x0A, 0xC0,
+0x40, 0xC0, 0x02, 0xA0, 0x50, 0x90, 0x11, 0xB0, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF2, 0x23, 0xF6,
+0xD0, 0xB1, 0x61, 0xF3, 0x25, 0xF3, 0x25, 0xF0, 0x22, 0xF2, 0xD0, 0xF1, 0xB0, 0x61, 0xB1, 0xF5,
+0x22, 0xF3, 0x20, 0xF1, 0x60, 0xF4, 0x2E, 0xF0, 0x22, 0xFB, 0xD0, 0xF0, 0xD2, 0xF1, 0xB1, 0x63,
+0xB0, 0x70, 0x40, 0x50, 0x00, 0x30, 0x00, 0x30, 0x71, 0xA0, 0x40, 0x05, 0x05, 0x50, 0x12, 0x80,
+0xE0, 0x50, 0x40, 0x13, 0x60, 0xF0, 0xD1, 0xF2, 0x20, 0xF6, 0x20, 0xF6, 0x21, 0xF3, 0x2A, 0xF4,
+0x22, 0xF1, 0x20, 0xB0, 0xF3, 0x21, 0xF3, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xD1, 0xF1, 0x24,
+0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0xD1, 0xA0, 0x01, 0x50, 0x90, 0x40, 0x50, 0x30, 0xD1,
+0x70, 0x30, 0x70, 0xC0, 0x02, 0xC0, 0xA0, 0x80, 0x0E, 0xA0, 0x03, 0x40, 0x90, 0x0F, 0x01, 0x91,
+0x01, 0x50, 0x80, 0xC0, 0x40, 0x0D, 0x40, 0x0F, 0x03, 0xC0, 0x50, 0x02, 0x30, 0x09, 0xC1, 0x40,
+0x30, 0x00, 0x40, 0x09, 0x30, 0x02, 0x90, 0x50, 0x01, 0x50, 0x40, 0x50, 0x40, 0x02, 0x70, 0x0C,
+0x90, 0x40, 0xC0, 0x01, 0xA0, 0xC0, 0x10, 0x70, 0xD0, 0xF7, 0x2B, 0xF1, 0xD0, 0xF0, 0x60, 0xB0,
+0x61, 0xB0, 0xF0, 0xD0, 0x21, 0xF2, 0x25, 0xF1, 0x22, 0xF2, 0x24, 0xF1, 0xD0, 0xF1, 0xB0, 0x61,
+0xB0, 0xF0, 0xD2, 0xF7, 0xB1, 0xF0, 0x23, 0xF1, 0x2D, 0xF2, 0x22, 0xF4, 0x22, 0xF4, 0x23, 0xD0,
+0xF1, 0xD0, 0x20, 0xB0, 0x13, 0x80, 0x30, 0x80, 0x00, 0xC0, 0x40, 0xE0, 0x80, 0x04, 0x05, 0x70,
+0xC0, 0x00, 0x80, 0x90, 0x00, 0xA0, 0x90, 0xA0, 0x90, 0x00, 0x40, 0x60, 0xD0, 0xF2, 0x24, 0xF3,
+0x28, 0xF2, 0x21, 0xF1, 0x2D, 0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xF6, 0x20, 0xB1, 0x61, 0xB0, 0xF0,
+0xD1, 0xF2, 0x26, 0xF1, 0x24, 0xF0, 0x24, 0xF2, 0xD1, 0xA0, 0x50, 0x40, 0x50, 0x01, 0xC0, 0xA0,
+0xB0, 0xD1, 0xB1, 0xA0, 0x04, 0x50, 0x70, 0x90, 0x0C, 0xA0, 0x01, 0x90, 0x40, 0x0F, 0x02, 0x40,
+0x50, 0x02, 0x90, 0x40, 0x00, 0xC0, 0x40, 0x0B, 0xC0, 0x90, 0x0F, 0x03, 0xC0, 0x50, 0x02, 0x70,
+0xA7, 0x32, 0x80, 0x30, 0xA0, 0x00, 0x51, 0x08, 0x30, 0x01, 0x90, 0x50, 0x05, 0xC0, 0x40, 0x01,
+0x90, 0x80, 0x0D, 0x91, 0x00, 0x80, 0x30, 0xE0, 0xD0, 0xF3, 0x21, 0xF3, 0x29, 0xF0, 0x20, 0xF0,
+0xD0, 0xB1, 0xD1, 0xF0, 0xB0, 0x61, 0xB0, 0xD1, 0xF2, 0x24, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x26,
+0xF2, 0xD1, 0xF0, 0xB1, 0x60, 0xB1, 0xF1, 0xD1, 0xF2, 0xD0, 0x60, 0xF1, 0x2F, 0x03, 0xF1, 0x21,
+0xF2, 0x28, 0xF1, 0x26, 0xF1, 0x21, 0xB0, 0x80, 0x00, 0x90, 0x30, 0x40, 0xA0, 0xC0, 0x03, 0x70,
+0x04, 0x04, 0xC0, 0x70, 0x01, 0x81, 0x40, 0x30, 0xC0, 0x40, 0x01, 0x50, 0x30, 0xD0, 0xF2, 0x29,
+0xF4, 0x29, 0xF0, 0x27, 0xF1, 0x26, 0xF1, 0xD0, 0x60, 0xF4, 0xB0, 0x61, 0xB0, 0xF7, 0x22, 0xF7,
+0x21, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0x30, 0x40, 0x03, 0xC0, 0xA0, 0x60,
+0xF2, 0xD0, 0xA0, 0x80, 0xC0, 0x04, 0x80, 0x30, 0xC0, 0x09, 0xC0, 0x30, 0xC0, 0x40, 0xC0, 0x0F,
+0x02, 0x40, 0xC0, 0x03, 0x40, 0x90, 0x01, 0xC0, 0x40, 0x0A, 0x40, 0x0F, 0x04, 0xC0, 0x50, 0x02,
+0x30, 0x0B, 0xC0, 0xE0, 0x01, 0x40, 0x07, 0xC0, 0x30, 0x00, 0x90, 0x50, 0x08, 0x40, 0xC0, 0x00,
+0x70, 0x0E, 0xC0, 0x40, 0xC0, 0x70, 0x60, 0xD0, 0xF2, 0x22, 0xF4, 0x25, 0xF3, 0x21, 0xD0, 0x60,
+0x20, 0xF0, 0x20, 0xF3, 0xB0, 0x60, 0xB0, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF5, 0x20, 0xF2,
+0x21, 0xF8, 0xB0, 0x61, 0xB1, 0xF0, 0xD2, 0x60, 0xF1, 0x20, 0xF1, 0x28, 0xF1, 0x24, 0xF0, 0x22,
+0xF0, 0x28, 0xF3, 0x24, 0xF3, 0x20, 0xF0, 0x60, 0x40, 0x01, 0x92, 0xE0, 0x80, 0x50, 0xC0, 0x90,
+0x70, 0x04, 0x05, 0x80, 0xE0, 0xA0, 0x70, 0x00, 0x40, 0x01, 0xA0, 0x00, 0x40, 0xA1, 0xD0, 0xF0,
+0x20, 0xF1, 0x2F, 0x0A, 0xF4, 0x20, 0xF0, 0x25, 0xF4, 0xD0, 0xB2, 0x61, 0xB1, 0xF0, 0xD1, 0xF1,
+0x26, 0xFB, 0x21, 0xF6, 0xB0, 0x61, 0xB0, 0xD0, 0x80, 0x40, 0x04, 0xA0, 0xB0, 0xF0, 0xD0, 0xF0,
+0xD1, 0x40, 0xE0, 0x05, 0xC0, 0xA0, 0x80, 0x08, 0xC0, 0x30, 0x50, 0x01, 0x50, 0x05, 0x40, 0x80,
+0x90, 0xC0, 0x05, 0x40, 0x05, 0x40, 0x50, 0x03, 0x40, 0x08, 0x51, 0x0F, 0x04, 0xC0, 0x50, 0x02,
+0x30, 0x0C, 0x70, 0x01, 0xC0, 0x90, 0x06, 0xC0, 0x30, 0x40, 0xC0, 0x0A, 0x40, 0x50, 0x70, 0x0F,
+0x01, 0x80, 0xA0, 0xF5, 0x23, 0xF3, 0x23, 0xF3, 0x20, 0xF2, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0xD0,
+0xF1, 0x61, 0xB0, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x21, 0xF4, 0x23, 0xF5,
+0xB0, 0x61, 0xB2, 0xD0, 0xF4, 0x27, 0xF1, 0x22, 0xF1, 0x23, 0xF0, 0x2A, 0xF0, 0x24, 0xF1, 0xD1,
+0x20, 0xF0, 0xD0, 0xA1, 0x40, 0xC0, 0x30, 0xC0, 0x00, 0x50, 0x80, 0x70, 0xE0, 0xA0, 0x50, 0x04,
+0x07, 0x31, 0xE1, 0x30, 0x00, 0xA0, 0x30, 0x90, 0x00, 0xA0, 0xD0, 0xF4, 0x21, 0xF3, 0x2C, 0xFB,
+0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD1, 0xF0, 0xB0, 0x62, 0xB0, 0xD0, 0xF2, 0x21, 0xF1, 0x23,
+0xF7, 0x28, 0xF2, 0xD1, 0xB0, 0x61, 0xB0, 0xF1, 0xD1, 0x31, 0x04, 0xA0, 0xD0, 0x60, 0xF4, 0x70,
+0x07, 0x90, 0x70, 0x31, 0x40, 0x50, 0x02, 0x90, 0x41, 0x01, 0x50, 0x70, 0x30, 0xA1, 0x31, 0x80,
+0x70, 0x80, 0x90, 0x80, 0x30, 0xA0, 0x31, 0x80, 0xA0, 0x80, 0x40, 0x90, 0x50, 0x02, 0x80, 0xC0,
+0x02, 0x50, 0x90, 0x40, 0xC0, 0x06, 0x40, 0x0F, 0x05, 0xC0, 0x50, 0x02, 0x30, 0x0C, 0x40, 0xA0,
+0x01, 0x90, 0xC0, 0x05, 0xC0, 0x30, 0x51, 0x0B, 0x40, 0x30, 0x0F, 0x01, 0x10, 0x30, 0xB0, 0x60,
+0xF0, 0xD0, 0xF0, 0x25, 0xF9, 0x21, 0xF1, 0x60, 0xF2, 0x23, 0xF2, 0xD0, 0xF1, 0xB0, 0x61, 0xB0,
+0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x28, 0xF5, 0x23, 0xF1, 0x21, 0xF2, 0xD0, 0xB0, 0x62, 0xB0, 0xF1,
+0xD0, 0xF0, 0x23, 0xF4, 0x20, 0xF3, 0x20, 0xF0, 0x20, 0xF2, 0x2F, 0x01, 0xF5, 0xD0, 0x70, 0x00,
+0x90, 0x30, 0xE0, 0x0C, 0x06, 0x30, 0xA0, 0x90, 0x01, 0x81, 0x40, 0x50, 0x01, 0x30, 0xB0, 0xD0,
+0xF0, 0x21, 0xF0, 0x22, 0xF3, 0x2B, 0xF3, 0x23, 0xFA, 0xB1, 0x61, 0xB0, 0xF1, 0x60, 0xD0, 0xF2,
+0x29, 0xF5, 0x26, 0xF4, 0xB0, 0x61, 0xB0, 0xF0, 0xD1, 0xF2, 0xD0, 0xF0, 0x70, 0xC0, 0x03, 0xA0,
+0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x80, 0x0A, 0xC0, 0x50, 0x40, 0x30, 0x70, 0x81, 0x31,
+0x50, 0x00, 0x90, 0x40, 0x04, 0xC0, 0x90, 0xA0, 0x50, 0x03, 0x91, 0x00, 0xC0, 0x90, 0x40, 0x80,
+0x30, 0xA1, 0x70, 0x02, 0xC0, 0x40, 0x01, 0x90, 0x50, 0x04, 0x90, 0xC0, 0x0F, 0x05, 0xC0, 0x50,
+0x02, 0x30, 0x0C, 0x70, 0x80, 0x02, 0x40, 0x04, 0x50, 0x81, 0x00, 0x51, 0x0A, 0x50, 0x70, 0x90,
+0x0E, 0xC0, 0x70, 0xB0, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0x23, 0xFB, 0xD0, 0x60, 0xD0,
+0xF2, 0x21, 0xF3, 0x20, 0xF2, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF1, 0x27, 0xF5, 0x29,
+0xF2, 0xD0, 0x60, 0xF0, 0xD0, 0xB0, 0x61, 0xB1, 0x20, 0xD0, 0xF8, 0x25, 0xF3, 0x29, 0xF1, 0x23,
+0xF2, 0x20, 0xF1, 0xB0, 0xA0, 0x02, 0x80, 0x50, 0xE0, 0x30, 0x40, 0x90, 0xC0, 0x06, 0x05, 0xC0,
+0x70, 0x03, 0x50, 0x30, 0x50, 0x40, 0x01, 0x80, 0x60, 0xD0, 0xF0, 0x26, 0xF1, 0x2F, 0x08, 0xF1,
+0xD0, 0xF0, 0xB1, 0x61, 0xB0, 0xF4, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x2D, 0xF0, 0x21, 0xF1, 0x21,
+0xF5, 0xB0, 0x60, 0xB1, 0xD0, 0xF2, 0x22, 0xF1, 0xD0, 0xA0, 0xC0, 0x03, 0xA0, 0xD0, 0xF0, 0xB0,
+0xD0, 0xF1, 0xB0, 0x30, 0x0C, 0xC0, 0x90, 0xC0, 0x00, 0xC0, 0x50, 0x90, 0x80, 0x30, 0x70, 0x50,
+0x07, 0xA0, 0x02, 0x40, 0x50, 0x0C, 0x40, 0x03, 0x50, 0x40, 0xC0, 0x01, 0xC0, 0x90, 0x0F, 0x06,
+0xC0, 0x50, 0x02, 0xA0, 0x0C, 0x70, 0x03, 0x50, 0xC0, 0x02, 0x90, 0x50, 0xC0, 0x80, 0x01, 0x40,
+0xC0, 0x09, 0xC0, 0x10, 0x00, 0x40, 0x0D, 0x90, 0x10, 0xF3, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0x21,
+0xF0, 0x20, 0xF5, 0x22, 0xF0, 0xD0, 0xB1, 0xD0, 0xF4, 0x20, 0xF2, 0x22, 0xF2, 0xD0, 0xF0, 0x20,
+0xB0, 0x60, 0xB0, 0xF5, 0x2F, 0x02, 0xF5, 0x60, 0xD0, 0x20, 0xF3, 0xB0, 0x61, 0xB1, 0xF0, 0xD0,
+0xF2, 0x29, 0xF1, 0x23, 0xF0, 0x22, 0xF3, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xB0, 0x30, 0x01,
+0x50, 0x40, 0x00, 0x70, 0x81, 0xA0, 0xE0, 0x70, 0xC0, 0x04, 0x06, 0xE0, 0x50, 0xC0, 0x90, 0x30,
+0x10, 0x50, 0x00, 0x70, 0xA0, 0x32, 0xD0, 0x27, 0xF0, 0x21, 0xF5, 0x2D, 0xF3, 0xB0, 0x61, 0xB1,
+0xF0, 0xD0, 0xF1, 0x22, 0xF1, 0xB1, 0xF0, 0x20, 0xF1, 0x20, 0xF5, 0x26, 0xF3, 0xD0, 0xF1, 0xD0,
+0xB0, 0x61, 0xB0, 0xD0, 0xF3, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x70, 0x03, 0xC0, 0xA0, 0xD0, 0xF0,
+0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0x70, 0x0B, 0x40, 0x50, 0x0F, 0x02, 0x40, 0x30, 0x00, 0x40, 0xC0,
+0x0C, 0x40, 0x06, 0x40, 0x50, 0x00, 0x40, 0x0F, 0x07, 0xC0, 0x50, 0x02, 0x70, 0xA0, 0x0A, 0x80,
+0x40, 0x04, 0x40, 0x00, 0xC0, 0x40, 0xC0, 0x00, 0xC0, 0x80, 0x02, 0x40, 0x0A, 0xA0, 0x00, 0xC0,
+0x40, 0x0C, 0x90, 0x70, 0xD0, 0xF0, 0xD0, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x22, 0xF3,
+0x23, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x26, 0xF1, 0x21, 0xF1, 0xD1, 0xB0, 0x61,
+0xB0, 0xF6, 0x2B, 0xF3, 0x20, 0xF2, 0xB0, 0xF0, 0x20, 0xF2, 0xD2, 0xF0, 0xB1, 0x61, 0xB0, 0xF4,
+0x27, 0xF0, 0x21, 0xF8, 0x24, 0xF2, 0x21, 0xD0, 0x80, 0xA0, 0x30, 0xA0, 0x70, 0x90, 0x00, 0x50,
+0x30, 0x02, 0xC0, 0x05, 0x06, 0xC0, 0xA0, 0x70, 0xA0, 0x80, 0x02, 0x30, 0x02, 0xA0, 0xD0, 0x22,
+0xF1, 0x22, 0xF0, 0x29, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0xD1, 0xF0, 0xB0, 0x62, 0xB0, 0xF0, 0xD0,
+0xF5, 0x23, 0xF1, 0x60, 0xD0, 0xF0, 0x24, 0xF4, 0x25, 0xF2, 0xD0, 0xF0, 0xB1, 0x60, 0xB0, 0xD1,
+0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x30, 0x50, 0x03, 0xA0,
+0xB0, 0x60, 0xB0, 0x60, 0xD0, 0xF0, 0xD0, 0x30, 0x90, 0x08, 0x90, 0x40, 0x0F, 0x05, 0x90, 0xA0,
+0x0D, 0x40, 0xC0, 0x07, 0x50, 0x40, 0x90, 0x0F, 0x07, 0xC0, 0x50, 0x03, 0x10, 0x50, 0x08, 0xC0,
+0xA0, 0x05, 0x50, 0x40, 0x50, 0x02, 0xC0, 0x30, 0x03, 0x40, 0x09, 0xA0, 0x02, 0x40, 0xC0, 0x0A,
+0x40, 0x70, 0xD0, 0xF2, 0x21, 0xF1, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x22, 0xF3, 0x22, 0xF0, 0xB0,
+0x62, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0x20, 0xF3, 0xD1, 0xB0, 0x61, 0xB0,
+0xF0, 0xD0, 0xF3, 0x25, 0xF2, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0xB0, 0xF1, 0x25, 0xF3, 0xD0, 0xF1,
+0x62, 0xB0, 0xF0, 0xD1, 0xF1, 0x20, 0xF1, 0x20, 0xF6, 0x29, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0x30,
+0x50, 0x01, 0x30, 0xC0, 0x0C, 0x0B, 0x80, 0x30, 0x00, 0xA0, 0x02, 0xA0, 0xD0, 0xF0, 0x20, 0xF2,
+0x22, 0xF0, 0x27, 0xF9, 0xB1, 0x61, 0xB0, 0xF0, 0xD1, 0xF3, 0x21, 0xF0, 0x25, 0xF0, 0xD0, 0x60,
+0xF2, 0x22, 0xFD, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF1, 0xD0, 0xB0, 0xE0, 0xF3, 0x23, 0xF1, 0xD1,
+0x60, 0xA0, 0x01, 0xC0, 0x90, 0x80, 0x30, 0xD1, 0x60, 0xD0, 0xF0, 0xD0, 0xB0, 0x30, 0x06, 0x50,
+0x40, 0xC0, 0x04, 0x50, 0x0E, 0x50, 0x90, 0x40, 0x80, 0x0B, 0x90, 0xC0, 0x09, 0x40, 0x50, 0x90,
+0xC0, 0x0F, 0x05, 0xC0, 0x50, 0x03, 0xE0, 0x30, 0x08, 0x80, 0x50, 0x03, 0xC0, 0x40, 0x50, 0x40,
+0x04, 0x30, 0x03, 0xC0, 0x90, 0x08, 0xA0, 0xC0, 0x02, 0x90, 0x50, 0x07, 0x80, 0x30, 0xA0, 0x70,
+0xD0, 0xF2, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF1, 0x21, 0xF2, 0x23, 0xF0, 0x60, 0xF0, 0xD0,
+0xF0, 0x61, 0xB0, 0xF1, 0x20, 0xF4, 0x20, 0xF1, 0x20, 0xF5, 0x20, 0xF1, 0xD0, 0xF0, 0xB0, 0x61,
+0xB0, 0xF3, 0x24, 0xF2, 0x25, 0xF1, 0x60, 0xD0, 0x29, 0xF3, 0xD1, 0xF0, 0xB0, 0x61, 0xB1, 0xFB,
+0x29, 0xF2, 0x21, 0xD0, 0xA0, 0x02, 0xA0, 0x0D, 0x0B, 0x30, 0x91, 0x80, 0x91, 0x80, 0xE0, 0xF4,
+0x28, 0xF7, 0xD0, 0xF1, 0xB0, 0x61, 0xB0, 0xF1, 0xD0, 0xF1, 0x20, 0xF1, 0x2B, 0xF1, 0xB1, 0xF3,
+0x20, 0xF1, 0x22, 0xF3, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF5, 0x20, 0xF0, 0x20, 0x70, 0xF5, 0x21,
+0xF3, 0xD0, 0x80, 0x30, 0x91, 0xC0, 0x00, 0xA0, 0x60, 0xD0, 0xB1, 0xF1, 0xB0, 0x80, 0x04, 0xC0,
+0x40, 0x50, 0x06, 0x30, 0x0D, 0x50, 0x90, 0x01, 0x30, 0x40, 0x09, 0x50, 0x90, 0x09, 0x50, 0xC0,
+0x01, 0x91, 0xC0, 0x0F, 0x03, 0xC0, 0x50, 0x03, 0x50, 0x10, 0x08, 0xE0, 0xC0, 0x01, 0xC0, 0x91,
+0xC0, 0x00, 0xC0, 0x90, 0x03, 0xA0, 0x04, 0x91, 0xC0, 0x90, 0x40, 0x81, 0x30, 0xA1, 0x30, 0x70,
+0x90, 0x02, 0x50, 0x90, 0x00, 0xC3, 0x50, 0x00, 0x30, 0xC1, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x22,
+0xD0, 0xF0, 0xD1, 0xB0, 0x60, 0xB0, 0xF2, 0xD0, 0xF0, 0x22, 0xF0, 0xB1, 0xD1, 0xF0, 0xD0, 0xF0,
+0xB0, 0x60, 0xB0, 0xF4, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x23, 0xF6, 0xB0, 0x60, 0xB1, 0xD0,
+0xF4, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xB1, 0xF0, 0x2A, 0xF9, 0xB0, 0x61, 0xB1, 0xF2, 0xD0,
+0xF1, 0x20, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xF4, 0xE0, 0x80, 0x90, 0x50, 0x30, 0x0D, 0x0B,
+0x80, 0x30, 0xC0, 0x50, 0x70, 0x40, 0x50, 0x40, 0x60, 0xD0, 0xF1, 0x24, 0xF4, 0x21, 0xF2, 0xD0,
+0xF0, 0xB0, 0x61, 0xB1, 0xF0, 0xD0, 0xF3, 0x22, 0xF0, 0x2A, 0xF0, 0x21, 0xF0, 0x20, 0x60, 0xD0,
+0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xB1, 0xF3, 0x21, 0xF1, 0x20,
+0xF1, 0xD0, 0x20, 0xF2, 0x20, 0xF2, 0x20, 0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0x70, 0x03, 0x70, 0xD0,
+0xB0, 0x60, 0xF1, 0xD0, 0xA0, 0x03, 0x40, 0x90, 0x0F, 0x07, 0x90, 0x50, 0x03, 0x81, 0x07, 0xC0,
+0x40, 0x09, 0xC0, 0x40, 0x03, 0xC0, 0x90, 0x40, 0x50, 0x0F, 0x01, 0xC0, 0x50, 0x03, 0xC0, 0x10,
+0x40, 0x07, 0x70, 0x00, 0xC0, 0x40, 0x90, 0xC0, 0x01, 0xC1, 0x90, 0xC0, 0x02, 0xA0, 0x02, 0x30,
+0x82, 0x30, 0x40, 0x90, 0x50, 0xC0, 0x03, 0x11, 0xA2, 0x30, 0xA0, 0x32, 0x82, 0xA0, 0x70, 0x00,
+0x40, 0x10, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0xD0, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0,
+0x20, 0xF3, 0x60, 0xF7, 0xB0, 0x60, 0xB0, 0xD1, 0xF1, 0x21, 0xF7, 0x22, 0xF6, 0xB1, 0x60, 0xB0,
+0xF0, 0xD0, 0xF3, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0xB1, 0xF1, 0x23, 0xF0, 0x27, 0xF1, 0x20, 0xF4,
+0xD0, 0xF0, 0xB1, 0x61, 0xB0, 0x20, 0xF4, 0x20, 0xF1, 0x20, 0xF2, 0x23, 0xF1, 0xD0, 0x60, 0x80,
+0xC0, 0x40, 0xA0, 0x40, 0x0D, 0x0F, 0x00, 0xA0, 0x02, 0x70, 0xD0, 0xF2, 0x23, 0xF4, 0xD1, 0xF0,
+0xB1, 0x61, 0xB0, 0xF0, 0xD0, 0xF0, 0x22, 0xF1, 0x21, 0xF7, 0x24, 0xF2, 0x21, 0xF1, 0x60, 0xD0,
+0xF1, 0x21, 0xF3, 0xD1, 0xB0, 0x61, 0xB0, 0xF3, 0x22, 0xF0, 0x23, 0xF6, 0x20, 0xF4, 0xB0, 0x60,
+0xB0, 0xD1, 0x40, 0x30, 0x02, 0x50, 0xA0, 0x70, 0xA0, 0xB0, 0xD1, 0xA0, 0xC0, 0x00, 0x90, 0x40,
+0x0F, 0x08, 0x40, 0xC0, 0x05, 0x41, 0x06, 0x40, 0x0A, 0x90, 0xC0, 0x06, 0x50, 0x41, 0x50, 0x0D,
+0xC0, 0x50, 0x04, 0x90, 0x40, 0x06, 0xC0, 0x70, 0x30, 0x80, 0x35, 0x70, 0x00, 0x40, 0x02, 0xA0,
+0x02, 0x80, 0x40, 0x01, 0x90, 0x0F, 0x00, 0x40, 0x04, 0x90, 0x00, 0xE0, 0x40, 0x30, 0xD0, 0xF4,
+0x20, 0xF1, 0x20, 0xF2, 0xD0, 0x61, 0xF0, 0xD1, 0x20, 0xF0, 0xB1, 0xF0, 0x22, 0xF3, 0xD0, 0xF0,
+0xB0, 0x60, 0xB0, 0xF1, 0xD0, 0xF1, 0x24, 0xF4, 0x21, 0xF2, 0x21, 0xF2, 0xB0, 0x61, 0xB0, 0xF0,
+0xD0, 0xF1, 0x21, 0xF1, 0x20, 0xF1, 0x60, 0xF1, 0x21, 0xF9, 0x24, 0xF4, 0x21, 0xF3, 0xB0, 0x62,
+0xB0, 0xF0, 0xD2, 0xF4, 0x23, 0xF1, 0xD0, 0x30, 0x50, 0x01, 0x80, 0xC0, 0x0D, 0x0F, 0x00, 0xA0,
+0x01, 0x50, 0x70, 0xD1, 0xF0, 0x22, 0xF1, 0xD2, 0xF0, 0xB1, 0x61, 0xB0, 0xF0, 0xD1, 0xF2, 0x27,
+0xF2, 0x20, 0xF4, 0x21, 0xF4, 0x21, 0xF0, 0xD0, 0xB1, 0xF1, 0x20, 0xF2, 0xD0, 0xB0, 0x61, 0xB0,
+0xF3, 0x25, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0,
+0xF2, 0xD1, 0xA0, 0x90, 0x02, 0x40, 0xE1, 0x60, 0xF0, 0xD0, 0x40, 0x80, 0x90, 0xC0, 0x0F, 0x07,
+0xC0, 0x40, 0xC0, 0x07, 0xA0, 0x05, 0x40, 0x0A, 0xC0, 0x90, 0x08, 0x40, 0x00, 0x50, 0x41, 0x50,
+0xC0, 0x09, 0x51, 0x04, 0x90, 0x40, 0x02, 0xC0, 0x50, 0x90, 0x40, 0x50, 0x00, 0x90, 0x05, 0x50,
+0x40, 0x00, 0x51, 0x01, 0x80, 0x00, 0xA0, 0x80, 0x00, 0xA0, 0xC0, 0xE0, 0x00, 0x40, 0x80, 0x30,
+0xC0, 0x0C, 0x40, 0xC0, 0x04, 0x70, 0x90, 0xA0, 0xD0, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0xD0, 0xF0,
+0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x60, 0xF2, 0x21, 0xF0, 0x22, 0xF0, 0xD0, 0xF1, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF3, 0x20, 0xF2, 0x25, 0xF1, 0x24, 0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF2, 0x21,
+0xF2, 0x60, 0xD0, 0xF0, 0x21, 0xF8, 0x24, 0xF1, 0x25, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0xB0, 0x62,
+0xB0, 0xF1, 0xD1, 0xF1, 0x22, 0xF1, 0xD0, 0x70, 0x90, 0x01, 0xA0, 0x0E, 0x0F, 0x00, 0x80, 0x30,
+0xA0, 0x80, 0xA0, 0xB0, 0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0xB2, 0x60, 0xB1, 0xF0, 0xD1, 0xF4, 0x24,
+0xF1, 0x29, 0xF7, 0x22, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0xD1, 0xF0, 0xB0, 0x60, 0xB1, 0xF2, 0x20,
+0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0xB0, 0x60, 0xB0, 0xF0, 0xD0,
+0xF3, 0xD0, 0xB0, 0xA0, 0x02, 0xC0, 0xA0, 0x10, 0x30, 0xB1, 0x80, 0x70, 0xC0, 0x0F, 0x07, 0xC0,
+0x40, 0x09, 0x80, 0x50, 0x03, 0x40, 0xC0, 0x0A, 0x40, 0x08, 0xC0, 0x50, 0x03, 0xC0, 0x50, 0x41,
+0x90, 0xC2, 0x03, 0xC0, 0x50, 0x04, 0xA0, 0xC0, 0x50, 0x41, 0x90, 0x50, 0xC0, 0x02, 0x51, 0x04,
+0xC0, 0xA0, 0x01, 0x90, 0x50, 0xC0, 0x41, 0x70, 0xA0, 0x00, 0xA0, 0xE0, 0x10, 0xE1, 0xA0, 0x10,
+0xA0, 0x80, 0xE0, 0x05, 0x41, 0xC0, 0x02, 0x90, 0x50, 0x03, 0x50, 0x70, 0x40, 0x60, 0xD0, 0x23,
+0xF0, 0x26, 0xF2, 0xB0, 0x60, 0xB2, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x20, 0xF3, 0xB0,
+0x60, 0xB0, 0xF2, 0x20, 0xF0, 0x26, 0xF2, 0x21, 0xF1, 0x23, 0xF2, 0xB1, 0x60, 0xB0, 0xF4, 0xB1,
+0xFC, 0x28, 0xF1, 0x24, 0xF0, 0x22, 0xF1, 0xD1, 0xF0, 0xB0, 0x61, 0xB1, 0xF5, 0xD1, 0x70, 0x40,
+0xA0, 0x30, 0xA0, 0x0E, 0x0F, 0x00, 0x90, 0x80, 0x01, 0x40, 0x80, 0xD2, 0x20, 0xB0, 0x61, 0xB1,
+0xF0, 0xD1, 0xF3, 0x25, 0xF6, 0x28, 0xF3, 0x21, 0xF1, 0x21, 0xF0, 0xD1, 0x60, 0xD0, 0xF0, 0xB0,
+0x61, 0xB0, 0xD1, 0xF1, 0x25, 0xF1, 0x2B, 0xF2, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF2, 0xD0,
+0xF0, 0xD0, 0x81, 0x02, 0x10, 0x80, 0x30, 0x80, 0x40, 0xA0, 0xE0, 0x90, 0x0F, 0x06, 0x50, 0x40,
+0x0A, 0x90, 0x40, 0x02, 0x90, 0x50, 0x0A, 0x51, 0x08, 0x90, 0xC0, 0x07, 0x40, 0x51, 0x92, 0x40,
+0x90, 0x43, 0x91, 0x40, 0x80, 0xC0, 0x90, 0xC0, 0x07, 0x40, 0x03, 0xA0, 0xC0, 0x40, 0x90, 0x80,
+0xA3, 0xE2, 0x70, 0x10, 0x30, 0x80, 0xB0, 0xD1, 0xB1, 0x30, 0x10, 0x80, 0x03, 0x70, 0xA0, 0x80,
+0xA0, 0x40, 0x02, 0x91, 0x03, 0x10, 0xC0, 0x70, 0xD0, 0xF1, 0x22, 0xF1, 0x24, 0xF2, 0xD0, 0xF0,
+0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x24, 0xF6, 0xD1, 0xF0, 0x61, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x24,
+0xF1, 0x22, 0xF0, 0x23, 0xF3, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0x60, 0xD0, 0xF0, 0x20, 0xF3, 0x21,
+0xF3, 0x28, 0xF5, 0x23, 0xF6, 0xD1, 0xF0, 0xB1, 0x61, 0xB0, 0x20, 0xD2, 0x60, 0x80, 0x01, 0x41,
+0x0E, 0x0F, 0x01, 0x30, 0x02, 0xA0, 0xF0, 0x62, 0xB0, 0xF0, 0xD1, 0xF1, 0x23, 0xF8, 0x21, 0xF0,
+0x21, 0xF2, 0x2E, 0xF0, 0xD1, 0xF0, 0xD0, 0x62, 0xB0, 0xD1, 0xF3, 0x21, 0xF0, 0x21, 0xF6, 0x20,
+0xF0, 0x22, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF2, 0x20, 0xF1, 0xD1, 0xF1, 0xD1, 0x70, 0xC0,
+0x01, 0x50, 0x70, 0x40, 0x90, 0x60, 0x80, 0xA0, 0x40, 0x09, 0x90, 0x50, 0x08, 0x40, 0x50, 0x0B,
+0x90, 0x40, 0x01, 0x51, 0x0B, 0x40, 0x09, 0x40, 0x07, 0xC0, 0x50, 0x06, 0xC1, 0x03, 0x50, 0x80,
+0x00, 0xC0, 0x50, 0x07, 0x90, 0x02, 0x70, 0x90, 0xA0, 0x70, 0xE0, 0xA0, 0xB1, 0x63, 0xB0, 0xD4,
+0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0x90, 0xE0, 0x90, 0x00, 0x50, 0xE0, 0x30, 0xD2, 0xA0, 0x40, 0x02,
+0x50, 0x40, 0x04, 0x81, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF4, 0x22, 0xF0, 0xD0, 0x60, 0xB0, 0x61,
+0xF0, 0xD0, 0xF0, 0xD0, 0x20, 0xF1, 0x21, 0xF1, 0x23, 0xF1, 0xD0, 0xF0, 0x61, 0xB0, 0xD0, 0xF1,
+0x21, 0xF1, 0x23, 0xF4, 0x25, 0xF1, 0xD1, 0xF0, 0xB0, 0x62, 0xD1, 0xF2, 0x20, 0xF0, 0x26, 0xF7,
+0x22, 0xF6, 0x20, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0xD1, 0xF0, 0xB1, 0x61, 0xF0, 0xA0, 0x02, 0x30,
+0x0F, 0x00, 0x0F, 0x01, 0x30, 0x90, 0x80, 0x30, 0x70, 0xB0, 0xF0, 0xD1, 0xF4, 0x26, 0xF0, 0x20,
+0xF0, 0x20, 0xF4, 0x20, 0xF2, 0x20, 0xF6, 0x27, 0xF1, 0xD0, 0xB1, 0x60, 0xB0, 0x60, 0xD1, 0xF0,
+0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF4, 0x21, 0xF1, 0x22, 0xF1, 0xD0, 0xB0, 0x61, 0xF0, 0xD0, 0xF2,
+0x21, 0xF2, 0xB0, 0xE0, 0xD0, 0xF1, 0xD0, 0x60, 0x80, 0x00, 0x50, 0x90, 0x30, 0x40, 0x80, 0xB0,
+0xA0, 0x30, 0xA0, 0x50, 0x08, 0x40, 0x10, 0x80, 0x06, 0x40, 0xC0, 0x0D, 0xA0, 0x00, 0xC0, 0x90,
+0x05, 0xC0, 0x80, 0x50, 0xC0, 0x01, 0x50, 0xC0, 0x08, 0x51, 0x07, 0x90, 0xC0, 0x06, 0xC0, 0x50,
+0x03, 0xC0, 0x30, 0x01, 0x90, 0x07, 0xC0, 0x90, 0x01, 0x31, 0xA0, 0x10, 0xE1, 0xF0, 0xB0, 0x60,
+0xD1, 0xF0, 0x23, 0xD0, 0xF3, 0xB1, 0xD0, 0x30, 0xE0, 0x11, 0x30, 0xD0, 0xF2, 0xD0, 0x70, 0x90,
+0x02, 0xC0, 0x40, 0x04, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF6, 0x22, 0xF0, 0xB1, 0xD1, 0xF0,
+0x60, 0xB0, 0xF7, 0x25, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF4, 0x23, 0xF5, 0x21, 0xF1, 0x21,
+0xF1, 0x20, 0xF1, 0xD0, 0xB1, 0x60, 0xB1, 0xD0, 0xF2, 0x25, 0xF7, 0x25, 0xF1, 0x20, 0xF5, 0x24,
+0xF1, 0x20, 0xF1, 0xD2, 0xF0, 0xB0, 0x70, 0x30, 0x80, 0x90, 0xA0, 0x0F, 0x00, 0x0F, 0x01, 0x81,
+0x50, 0x00, 0x80, 0xB0, 0xF5, 0x28, 0xF2, 0x20, 0xF0, 0x28, 0xF6, 0x20, 0xF6, 0x20, 0xB0, 0x60,
+0xB0, 0xF0, 0xD1, 0x60, 0xF1, 0x21, 0xF0, 0x20, 0xF6, 0x26, 0xF0, 0x21, 0xF1, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF2, 0x23, 0xF1, 0xD0, 0xA0, 0xE0, 0xD0, 0xF0, 0xD1, 0x70, 0xC0, 0x90, 0x50, 0x00,
+0x40, 0x30, 0xB0, 0xD0, 0x60, 0xD0, 0x80, 0x30, 0x08, 0x90, 0x10, 0x90, 0x05, 0x40, 0xC0, 0x0E,
+0x40, 0x80, 0x90, 0x05, 0x31, 0x90, 0x80, 0x30, 0x70, 0xA0, 0x90, 0x09, 0x40, 0x08, 0x40, 0x07,
+0xC0, 0x50, 0x03, 0x70, 0x90, 0x01, 0x40, 0x04, 0xC0, 0x02, 0x40, 0x02, 0xC0, 0x00, 0x90, 0xA0,
+0xE0, 0xD0, 0x60, 0xA0, 0xB0, 0xD0, 0xF1, 0x21, 0xF6, 0x60, 0xB0, 0xD0, 0xB0, 0x61, 0xD0, 0xF0,
+0xD0, 0xF1, 0xD1, 0xA0, 0x80, 0x03, 0x40, 0xC0, 0x02, 0x90, 0xA0, 0xD0, 0xF4, 0x20, 0xF5, 0x21,
+0x60, 0x20, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0xF4, 0x26, 0xF3, 0xD0, 0xF0, 0xB0, 0x60,
+0xB0, 0xF2, 0x27, 0xF5, 0x26, 0xD0, 0x60, 0xD0, 0xF1, 0xB0, 0x60, 0xB0, 0xF7, 0x20, 0xF1, 0x23,
+0xF1, 0x21, 0xF0, 0x24, 0xF4, 0x28, 0xF2, 0xD0, 0xF1, 0xD0, 0x30, 0x00, 0x50, 0x40, 0x30, 0x0F,
+0x00, 0x0F, 0x01, 0x90, 0x40, 0x01, 0x90, 0x80, 0xD0, 0xF3, 0x2F, 0x06, 0xF1, 0x21, 0xF9, 0xD0,
+0xB0, 0x61, 0xB0, 0xF0, 0xD1, 0xF0, 0xD0, 0xB1, 0xF0, 0x21, 0xF9, 0x23, 0xF4, 0xB0, 0x60, 0xB0,
+0xF1, 0xD0, 0xF1, 0x24, 0xF0, 0xD0, 0xF1, 0xD0, 0xB0, 0xD2, 0x90, 0xA0, 0x50, 0x03, 0x30, 0x60,
+0xD0, 0xB0, 0x60, 0xD0, 0x70, 0x09, 0xC0, 0x04, 0xC0, 0x40, 0x0F, 0x02, 0x40, 0x30, 0x04, 0x41,
+0x04, 0x40, 0xA0, 0x41, 0x07, 0x40, 0x08, 0x40, 0x07, 0xC0, 0x81, 0x01, 0xC0, 0x10, 0x70, 0xA1,
+0x30, 0x50, 0x01, 0xC0, 0xA0, 0x70, 0x80, 0x01, 0x90, 0x04, 0xC0, 0xE0, 0x40, 0xD1, 0xF0, 0x60,
+0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF3, 0x21, 0xF0, 0x60, 0xF0, 0xD1, 0xF6, 0xD1, 0x30, 0x70, 0x50,
+0x02, 0x40, 0x50, 0x02, 0x30, 0x60, 0xD1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x20,
+0xD0, 0xB1, 0xF0, 0x20, 0xF4, 0xB0, 0x60, 0xF1, 0xD0, 0xF0, 0x2A, 0xF0, 0xD1, 0xF1, 0xB0, 0x60,
+0xB0, 0xF2, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0x21, 0xF0, 0xB1, 0xD1, 0xF0, 0xD1,
+0xB0, 0x61, 0xB0, 0xF6, 0x20, 0xF1, 0x23, 0xF1, 0x2F, 0x05, 0xF3, 0xD0, 0x60, 0x80, 0x01, 0x50,
+0x40, 0x0F, 0x00, 0x0F, 0x01, 0xC0, 0x30, 0x01, 0x80, 0x70, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF3,
+0x2F, 0x05, 0xF2, 0xD1, 0xB0, 0x61, 0xB0, 0x20, 0xD2, 0xF1, 0x20, 0xF1, 0x60, 0xF7, 0x20, 0xF0,
+0x24, 0xF3, 0xD0, 0xB0, 0x60, 0xB0, 0xD1, 0xF2, 0x27, 0xF0, 0xD0, 0xF0, 0xD0, 0xA0, 0xE0, 0x30,
+0x40, 0x30, 0xC0, 0x04, 0x90, 0x30, 0xD0, 0xF0, 0xB1, 0x90, 0xE0, 0x0D, 0x50, 0x40, 0x0F, 0x02,
+0x40, 0x00, 0x50, 0x70, 0x40, 0x02, 0xA0, 0x04, 0xC0, 0x90, 0x80, 0x10, 0x07, 0x50, 0xC0, 0x08,
+0x90, 0x07, 0x90, 0x70, 0xE0, 0x80, 0x30, 0x70, 0x30, 0xD2, 0xB0, 0xA1, 0x30, 0xA1, 0x10, 0xA1,
+0xE0, 0x00, 0x90, 0x01, 0x90, 0xE0, 0x30, 0xA0, 0x80, 0xD2, 0xB1, 0xF4, 0x20, 0xF0, 0x23, 0xF1,
+0x60, 0xF2, 0x21, 0xF1, 0x22, 0xF0, 0xD1, 0x70, 0x03, 0x91, 0x01, 0x40, 0x10, 0xB0, 0xD0, 0x20,
+0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF2, 0x20, 0xF1, 0x20, 0xD0, 0xF0, 0x60, 0xB0, 0xF0,
+0xD0, 0xF1, 0x21, 0xF0, 0x27, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0x22, 0xF1, 0x21, 0xF4, 0x60, 0xF1, 0x22, 0xF0, 0xD1, 0xF0, 0xB0, 0x61, 0xB0, 0xD1, 0xF2, 0x26,
+0xF1, 0x2B, 0xF5, 0x24, 0xF0, 0xD0, 0xA0, 0x30, 0xC0, 0x00, 0x80, 0xC0, 0x0F, 0x00, 0x0F, 0x02,
+0xA1, 0x30, 0x50, 0xA0, 0xF0, 0xD0, 0x21, 0xF2, 0x20, 0xF4, 0x29, 0xF0, 0x27, 0xF3, 0xB1, 0x60,
+0xB0, 0xF1, 0xD0, 0xF5, 0x21, 0xD0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF2,
+0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0xF2, 0x27, 0xF2, 0x20, 0xF0, 0xD1, 0xA0, 0x90, 0x40, 0x10,
+0x80, 0x04, 0x90, 0x30, 0xD0, 0xF0, 0xD0, 0x60, 0xD0, 0x81, 0x0B, 0x91, 0x0F, 0x02, 0x90, 0xC0,
+0x02, 0x80, 0xA0, 0xC0, 0x30, 0x40, 0x04, 0x40, 0x01, 0x50, 0xA0, 0x06, 0x40, 0x08, 0xC0, 0x50,
+0x07, 0xC0, 0xA0, 0x10, 0x70, 0xB0, 0xD1, 0xF2, 0xB1, 0xD0, 0xF1, 0xD0, 0x60, 0xD0, 0x90, 0x10,
+0x00, 0x90, 0x50, 0xA0, 0xC0, 0x72, 0x30, 0xA0, 0x60, 0xD1, 0x60, 0xF4, 0x21, 0xF0, 0x23, 0xF1,
+0x60, 0xD0, 0xF1, 0x27, 0xD0, 0x30, 0x50, 0x03, 0x50, 0x40, 0x00, 0xC0, 0x10, 0xE0, 0xD0, 0xF4,
+0x22, 0xF0, 0xD0, 0x60, 0xF3, 0x23, 0xF3, 0xB0, 0x60, 0xB0, 0xF6, 0x25, 0xF0, 0x20, 0xF2, 0xD1,
+0xB0, 0x61, 0xF0, 0xD0, 0xF2, 0x24, 0xF1, 0x20, 0xF2, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x23, 0xF1,
+0xD1, 0xF1, 0xB0, 0x61, 0xB0, 0xF1, 0xD0, 0xF0, 0x21, 0xF1, 0x23, 0xF0, 0x29, 0xF3, 0x20, 0xF0,
+0x24, 0xF0, 0xD0, 0x70, 0x50, 0x31, 0x70, 0x0F, 0x01, 0x0F, 0x02, 0x41, 0x01, 0x40, 0x80, 0xD0,
+0x20, 0xF0, 0x2A, 0xF7, 0x21, 0xF0, 0x22, 0xF3, 0x20, 0xB0, 0x60, 0xB0, 0xF9, 0x23, 0xF1, 0x60,
+0xD0, 0xF2, 0x25, 0xF2, 0xD0, 0xF0, 0x61, 0xB0, 0xF4, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x23,
+0xF1, 0xB0, 0x61, 0xA0, 0x00, 0xC0, 0x50, 0x04, 0x90, 0x30, 0xD1, 0xF0, 0xB0, 0x60, 0xD0, 0xA0,
+0xC0, 0x09, 0x40, 0x50, 0x0F, 0x02, 0x51, 0x04, 0xC0, 0x30, 0x90, 0x04, 0x51, 0x02, 0x41, 0x05,
+0x40, 0x08, 0x51, 0x07, 0x90, 0xE0, 0x60, 0xD1, 0xF2, 0x20, 0xF1, 0xB0, 0xD0, 0xF0, 0xD0, 0xF0,
+0xD1, 0xF0, 0xA0, 0x70, 0x30, 0xA0, 0x60, 0xE0, 0x80, 0xD0, 0xB0, 0x70, 0xE0, 0xA0, 0xD0, 0xF0,
+0xB1, 0xF2, 0x23, 0xF0, 0x20, 0xF3, 0xB0, 0x60, 0xF2, 0x21, 0xF0, 0x22, 0xF0, 0xD0, 0x80, 0x40,
+0x04, 0xC0, 0x40, 0x00, 0x70, 0xE0, 0xD0, 0x20, 0xF6, 0xD0, 0xB1, 0xF0, 0xD0, 0xF0, 0x20, 0xF1,
+0x23, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF2, 0x22, 0xF0, 0x22, 0xF0, 0x23, 0xF3, 0xD0, 0xB0,
+0x61, 0xB0, 0xD0, 0xF2, 0x24, 0xF0, 0x20, 0xF1, 0xD0, 0xB1, 0xF1, 0x21, 0xF4, 0x20, 0xF3, 0x20,
+0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x25, 0xF7, 0x2C, 0xF0, 0x60, 0x80, 0x01, 0x50, 0x80, 0x0F,
+0x01, 0x0F, 0x02, 0xC0, 0x80, 0x01, 0xC0, 0xA0, 0xD0, 0xF0, 0x2B, 0xFD, 0xD0, 0xF0, 0xB0, 0x61,
+0xB0, 0xF4, 0x20, 0xF0, 0x29, 0xD0, 0x60, 0xF2, 0x24, 0xF2, 0xD0, 0xF0, 0x61, 0xB0, 0xD0, 0xF6,
+0x23, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x61, 0xF0, 0xD0, 0x30, 0x50, 0x07, 0xA0, 0xB0, 0xD0, 0xF0,
+0x61, 0xB1, 0x70, 0xA0, 0x50, 0x02, 0x10, 0x02, 0x40, 0xC0, 0x0F, 0x02, 0xC0, 0x90, 0x0D, 0x40,
+0x04, 0xA0, 0x04, 0x90, 0xC0, 0x08, 0x50, 0xC0, 0x07, 0xE0, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0x60,
+0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD1, 0xB0, 0x60, 0xD0, 0xB0, 0xD2, 0x60, 0x30, 0xF0,
+0xD0, 0xF0, 0xD0, 0x60, 0x20, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xF0, 0x23, 0xF0,
+0x22, 0xD0, 0x30, 0x50, 0x06, 0x40, 0x90, 0x10, 0xD0, 0xF2, 0x20, 0xD0, 0x20, 0xF0, 0xD0, 0xB0,
+0x61, 0xD1, 0xF4, 0x22, 0xF0, 0x21, 0xF2, 0x61, 0xF0, 0xD0, 0xF0, 0x21, 0xF3, 0x24, 0xF5, 0xD0,
+0xB0, 0x61, 0xB0, 0xF2, 0x24, 0xF0, 0x20, 0xF1, 0x60, 0xD0, 0x22, 0xF1, 0x26, 0xF4, 0xB1, 0x60,
+0xB0, 0xF0, 0xD0, 0xF1, 0x22, 0xF9, 0x2A, 0xF0, 0xD0, 0x30, 0x90, 0x01, 0x40, 0x90, 0x0F, 0x01,
+0x0F, 0x03, 0xA0, 0x40, 0xA0, 0x30, 0xE0, 0xD1, 0xF2, 0x21, 0xF2, 0x28, 0xF4, 0xD2, 0xB0, 0x61,
+0xB0, 0xF5, 0x24, 0xF1, 0x26, 0xF0, 0xB1, 0xF0, 0x22, 0xF2, 0xD0, 0xF1, 0x61, 0xF0, 0xD0, 0xF2,
+0x21, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0x20, 0xF3, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0x70,
+0x50, 0x07, 0x70, 0xB0, 0x60, 0xF0, 0xD0, 0x60, 0xD1, 0x90, 0x10, 0x02, 0x10, 0x00, 0xC0, 0x40,
+0x0F, 0x03, 0xC0, 0x40, 0x0D, 0x90, 0xC0, 0x04, 0x80, 0x50, 0x03, 0x40, 0x09, 0x90, 0x06, 0x40,
+0x70, 0xB1, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xD0, 0x60, 0xD1, 0xF0, 0x22, 0xF2, 0xD0, 0x60, 0xF0,
+0xD1, 0xF1, 0xD2, 0xF0, 0x20, 0xF1, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF4, 0x20, 0xD0, 0x60,
+0xB0, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0xD0, 0x70, 0x08, 0x90, 0xA0, 0x70, 0xD0, 0xF1, 0x21, 0xF2,
+0x60, 0xF1, 0x60, 0xB0, 0xD0, 0xF6, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x20, 0x60, 0xB0, 0xF3,
+0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF4, 0xD0, 0x20, 0xB0, 0x60, 0xB0, 0xD1, 0xF3, 0x21,
+0xF0, 0xB1, 0xD0, 0x22, 0xF2, 0x23, 0xF0, 0x22, 0xF5, 0xB0, 0x61, 0xB0, 0xD1, 0xFA, 0x27, 0xF1,
+0x21, 0xF0, 0xD0, 0x70, 0x30, 0xA0, 0x40, 0xA0, 0x0F, 0x02, 0x0F, 0x03, 0x81, 0x01, 0x80, 0x60,
+0xF0, 0xD0, 0xF3, 0x20, 0xF2, 0x26, 0xF3, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF0, 0xD0, 0xF4, 0x26,
+0xF0, 0x22, 0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xF0, 0x22, 0xF0, 0xD1, 0xB0, 0x61, 0xF0, 0xD1, 0xF1,
+0x24, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF2, 0xD1, 0xF0, 0x70, 0x90,
+0x06, 0x80, 0x60, 0xD0, 0xF2, 0x60, 0xD1, 0xA0, 0x03, 0x50, 0x40, 0x0F, 0x04, 0x40, 0x0D, 0xC0,
+0x90, 0x05, 0x50, 0x30, 0x02, 0xC0, 0x50, 0x09, 0x40, 0x01, 0xA1, 0x90, 0xA0, 0x10, 0x30, 0xD0,
+0xB1, 0xF1, 0x23, 0xF1, 0xD0, 0x60, 0xF2, 0x23, 0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF2, 0x20,
+0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x21, 0xF4, 0x20, 0xF2, 0x60, 0xF3, 0x21, 0xF1, 0xD0, 0x70, 0x30,
+0xC0, 0x07, 0x50, 0xE0, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0,
+0x60, 0xF4, 0x24, 0xF4, 0xD0, 0xB0, 0x60, 0xB0, 0xF1, 0x21, 0xF0, 0x24, 0xF0, 0x25, 0xF4, 0xB0,
+0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x22, 0xD0, 0x60, 0xF2, 0x26, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x20,
+0xF1, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF6, 0x24, 0xF3, 0x20, 0xF3, 0xD0, 0xF0, 0xB0, 0x30, 0x01,
+0x40, 0x30, 0x00, 0xC0, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x30, 0x02, 0xA0, 0xD0, 0xF3, 0x21, 0xF3,
+0x24, 0xF1, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD1, 0xF2, 0x28, 0xF3, 0x25, 0xF1, 0xD0, 0xB0,
+0xF1, 0x21, 0xF0, 0xB0, 0x60, 0xB0, 0xF6, 0x24, 0xF1, 0x20, 0xF1, 0x23, 0xD0, 0xF0, 0x60, 0xB0,
+0xF3, 0x20, 0xF2, 0xD0, 0xF0, 0x70, 0x90, 0x03, 0xC0, 0x40, 0xC0, 0x70, 0xD1, 0xF0, 0x20, 0xB1,
+0xD0, 0xE0, 0x02, 0x50, 0x90, 0x0F, 0x04, 0x40, 0xC0, 0x0D, 0x90, 0xC0, 0x06, 0x30, 0x02, 0x90,
+0xC0, 0x08, 0xC0, 0x90, 0x01, 0xE0, 0xA0, 0x10, 0xA0, 0xB0, 0xD1, 0xB1, 0xF1, 0x24, 0xF1, 0xB1,
+0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF7, 0x60, 0xD0, 0xF1, 0x20,
+0xF4, 0x22, 0xF2, 0x60, 0xF2, 0x20, 0xF2, 0xD0, 0x70, 0x11, 0x08, 0x40, 0x30, 0xD1, 0x21, 0xF0,
+0xB1, 0xD0, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x20,
+0xF1, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF3, 0x26, 0xF4, 0xB0, 0x60, 0xB0, 0xF3, 0xB0, 0x60,
+0xD0, 0xF1, 0x25, 0xF3, 0x24, 0xF4, 0x20, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB1, 0xF0, 0xD0, 0xF1,
+0x23, 0xF5, 0x21, 0xD0, 0x20, 0xF0, 0xD0, 0x30, 0x50, 0x01, 0x40, 0x90, 0x81, 0x40, 0x0E, 0x0F,
+0x04, 0xA0, 0x00, 0x50, 0x30, 0xE0, 0xD1, 0xF2, 0x22, 0xF0, 0x22, 0xF3, 0xD0, 0xF0, 0xB0, 0x61,
+0xB0, 0xF4, 0x20, 0xF0, 0x25, 0xF1, 0x20, 0xF4, 0x26, 0xF2, 0x60, 0xD0, 0xF0, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF0, 0x21, 0xF4, 0x24, 0xF3, 0x20, 0xF2, 0x61, 0xF1, 0xD0, 0xF0, 0x21, 0xF0, 0x20,
+0xF2, 0xD1, 0x70, 0xA0, 0x70, 0x80, 0x50, 0x90, 0x01, 0x30, 0x60, 0xD0, 0xF2, 0xB0, 0xF0, 0x70,
+0x90, 0x00, 0x90, 0x50, 0x0F, 0x04, 0x40, 0xC0, 0x0D, 0xC0, 0x50, 0x07, 0x90, 0x30, 0x01, 0x40,
+0x09, 0xC1, 0x00, 0x11, 0xA0, 0xB0, 0xD1, 0xF0, 0xD0, 0xB1, 0xF2, 0x24, 0xF0, 0xB1, 0xF0, 0x23,
+0xF4, 0xB0, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0xB1, 0xD0, 0xF6, 0x23, 0xF0, 0xD0, 0xF0,
+0x60, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xE0, 0x30, 0x09, 0x10, 0x60, 0xF1, 0x20, 0xB0, 0x60,
+0xF0, 0xD0, 0xF0, 0xD0, 0xF1, 0x61, 0xB0, 0x60, 0xD1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x21,
+0xF0, 0xD0, 0xF0, 0x61, 0xF7, 0x27, 0xF5, 0xD0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0x60, 0xF0, 0xD0,
+0x27, 0xF0, 0x27, 0xF5, 0x20, 0xF4, 0xB0, 0x61, 0xB0, 0xF5, 0x20, 0xF3, 0x20, 0xF4, 0xD0, 0x70,
+0xA0, 0x50, 0x00, 0x30, 0xC0, 0x30, 0xC0, 0x80, 0x0E, 0x0F, 0x04, 0x30, 0xA0, 0x80, 0xC0, 0x30,
+0xB0, 0xD0, 0xF2, 0x24, 0xF1, 0xD2, 0xF0, 0x61, 0xB0, 0xF1, 0x25, 0xF5, 0x23, 0xF0, 0x23, 0xF2,
+0x23, 0xF0, 0x20, 0xD1, 0xB0, 0x61, 0xB0, 0xD0, 0xF2, 0x23, 0xF3, 0x23, 0xF0, 0x21, 0xF1, 0xD1,
+0xB0, 0x60, 0xB0, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xD0, 0xF2, 0xD0, 0xA0, 0x40,
+0xC0, 0x02, 0x50, 0xE0, 0xB0, 0xD0, 0x20, 0xF0, 0xD0, 0x60, 0xD0, 0xA0, 0x30, 0x90, 0x0F, 0x04,
+0x51, 0x0E, 0x40, 0x09, 0x80, 0x40, 0xC0, 0x50, 0x09, 0xC0, 0x70, 0x11, 0x80, 0xD1, 0xF1, 0xD0,
+0xF0, 0xB1, 0xF6, 0x20, 0xF1, 0x60, 0xF0, 0x24, 0xF2, 0xD0, 0xB1, 0xF0, 0x20, 0xF0, 0x21, 0xF2,
+0x21, 0xF0, 0xD0, 0x60, 0xF2, 0x21, 0xF2, 0x23, 0xF2, 0xB0, 0x60, 0xF2, 0x20, 0xF1, 0xD0, 0x10,
+0x50, 0x07, 0x50, 0x00, 0xA0, 0x70, 0x60, 0xF0, 0xD0, 0x60, 0xD1, 0x20, 0xD2, 0x30, 0xA0, 0xE1,
+0xD0, 0x60, 0xB0, 0xD0, 0x24, 0xF2, 0x20, 0xF0, 0x23, 0xD0, 0xF0, 0x60, 0xB0, 0xD1, 0xF1, 0x21,
+0xF0, 0x24, 0xF3, 0x21, 0xF2, 0xD1, 0xB0, 0x62, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x21, 0xF1,
+0x25, 0xF5, 0x25, 0xF1, 0xB0, 0x61, 0xB0, 0xD2, 0xF1, 0x24, 0xF2, 0xD1, 0xA0, 0x00, 0x80, 0xA1,
+0x00, 0x50, 0x80, 0x0F, 0x00, 0x0F, 0x01, 0x50, 0x30, 0xC0, 0x50, 0x40, 0x01, 0x50, 0x30, 0xD0,
+0xF3, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x26, 0xF7, 0x22,
+0xF0, 0x25, 0xF2, 0x21, 0xF0, 0xD0, 0xF0, 0x62, 0xD0, 0xF1, 0x27, 0xF2, 0x24, 0xF2, 0xD0, 0xB0,
+0x60, 0xB0, 0xD1, 0xF0, 0x24, 0xF4, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xA0, 0x90, 0x03, 0x10, 0x70,
+0xF0, 0xD0, 0xF1, 0xD0, 0x60, 0x40, 0x80, 0xA0, 0x0F, 0x03, 0xC0, 0x80, 0xE0, 0x40, 0x0C, 0x50,
+0xC0, 0x0A, 0xA0, 0x40, 0x0A, 0x90, 0x11, 0xD2, 0xF1, 0x20, 0xF0, 0xD0, 0xB1, 0xF6, 0x20, 0xF1,
+0x60, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0xD0, 0xF1, 0x21, 0xF1, 0x22, 0xF2, 0x60,
+0xD0, 0x23, 0xF2, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0xB1, 0xD0, 0xF3, 0xD0, 0x80, 0xA0, 0x06, 0x30,
+0xA0, 0x90, 0x00, 0x80, 0x62, 0xF1, 0xD1, 0x31, 0x70, 0x10, 0xF0, 0xD0, 0x30, 0x10, 0x80, 0xB1,
+0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x24, 0xF0, 0xD1, 0xB0, 0x60, 0xB0, 0xD1, 0xF1, 0x24, 0xF4,
+0x21, 0xF1, 0x20, 0xF2, 0xD0, 0x62, 0xB0, 0xD0, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x24, 0xF5, 0x26,
+0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xD1, 0xF1, 0x22, 0xF2, 0xD0, 0x80, 0x90, 0x01, 0x90, 0x40,
+0x0F, 0x03, 0x0C, 0xC1, 0x01, 0xC0, 0x80, 0xE0, 0x00, 0xA0, 0x01, 0x50, 0xE0, 0xD1, 0x20, 0xF3,
+0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF3, 0x27, 0xF2, 0x21, 0xF7, 0x24, 0xF3, 0xD1, 0xF0, 0xB0, 0x60,
+0xF1, 0xB1, 0xD0, 0xF1, 0x22, 0xF0, 0x27, 0xF0, 0xD1, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0,
+0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0xD1, 0xF0, 0x60, 0xB0, 0xD1, 0x70, 0x50, 0x02, 0x80,
+0xA0, 0x60, 0xF2, 0xB0, 0x61, 0xD0, 0xA0, 0x0F, 0x02, 0xC0, 0x40, 0x0F, 0x00, 0x40, 0x0B, 0x50,
+0x80, 0xC0, 0x08, 0x40, 0xA0, 0x10, 0x40, 0xD1, 0xF1, 0x22, 0xD0, 0xB1, 0xF5, 0x21, 0xF0, 0xD0,
+0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF3, 0x60, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x20,
+0xD0, 0x60, 0xB0, 0xF0, 0x23, 0xF4, 0x20, 0xF2, 0xD0, 0xB1, 0xF0, 0xD0, 0x20, 0xF1, 0xD0, 0x30,
+0x50, 0xC1, 0x02, 0x40, 0x80, 0x00, 0x30, 0x00, 0x50, 0x30, 0x61, 0xB0, 0xD0, 0x30, 0xE1, 0x70,
+0x60, 0xB0, 0xF0, 0xD1, 0xA0, 0x70, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF0,
+0x21, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x23, 0xF6, 0x22, 0xF1, 0xD0, 0xF0, 0x60,
+0xD0, 0xF0, 0x61, 0xF1, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF4, 0x28, 0xF2, 0x24, 0xF3, 0x20, 0x61,
+0xB0, 0xF5, 0xD2, 0x70, 0x90, 0x01, 0xA0, 0x00, 0x30, 0xE1, 0xA0, 0x90, 0x0D, 0x0C, 0x30, 0x10,
+0x30, 0x02, 0x80, 0x90, 0x80, 0x30, 0xA0, 0x80, 0x30, 0x60, 0xF0, 0xD1, 0xF1, 0xB0, 0x61, 0xB0,
+0xF3, 0x23, 0xF1, 0x21, 0xF0, 0x25, 0xF0, 0x20, 0xF3, 0x26, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0,
+0xF2, 0x60, 0xD0, 0x23, 0xF3, 0x24, 0xF4, 0xB0, 0x60, 0xF0, 0xD0, 0xF8, 0xD0, 0x20, 0xF0, 0x21,
+0xF1, 0xB0, 0x60, 0x20, 0xD1, 0xF0, 0xD0, 0xA0, 0x80, 0x02, 0xC0, 0xA0, 0xD1, 0xB0, 0x60, 0xD0,
+0xB0, 0x60, 0x80, 0xA0, 0x30, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x90, 0xC0, 0x0B, 0x50, 0x90, 0xA0,
+0x09, 0xA0, 0x70, 0xD0, 0xF1, 0x23, 0xF1, 0xB1, 0xF3, 0x24, 0xD0, 0x60, 0xF1, 0x22, 0xF5, 0x20,
+0x60, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x20, 0x60, 0xD0, 0xF0, 0x23, 0xF2, 0x20, 0xF0,
+0x21, 0xF2, 0x60, 0xF4, 0xD0, 0xB0, 0xA0, 0x10, 0x80, 0x03, 0x80, 0xE0, 0x90, 0x00, 0xC0, 0x30,
+0xB0, 0xD0, 0xB0, 0x60, 0xD0, 0x31, 0xD1, 0xF0, 0xD2, 0x70, 0x30, 0xD1, 0x20, 0x60, 0xB0, 0xF1,
+0x21, 0xF1, 0x21, 0xF2, 0x20, 0xF2, 0x20, 0xD0, 0xF0, 0x61, 0xF2, 0x20, 0xF0, 0x20, 0xF7, 0x23,
+0xD0, 0xB0, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x24, 0xF3, 0x28, 0xF2, 0x28,
+0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF3, 0xD0, 0xF0, 0xA0, 0x40, 0xA0, 0x80, 0x30, 0x50, 0x30,
+0x01, 0x90, 0x70, 0x30, 0x0C, 0x0C, 0x90, 0x30, 0x40, 0x10, 0x30, 0x90, 0xE0, 0x51, 0x80, 0x01,
+0x50, 0x30, 0xD1, 0xB0, 0x61, 0xB0, 0xF0, 0xD1, 0xF1, 0x26, 0xF5, 0x24, 0xF3, 0x24, 0xF2, 0xD1,
+0xB0, 0x61, 0xF0, 0xD0, 0xF4, 0x60, 0xF1, 0x22, 0xF3, 0x22, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xD1,
+0x22, 0xF0, 0x21, 0xF2, 0x22, 0xF1, 0xD0, 0xF0, 0x61, 0xF4, 0xD1, 0x70, 0x02, 0xC0, 0xA0, 0xD0,
+0x60, 0xB0, 0xF1, 0xD0, 0xB0, 0x60, 0xD0, 0x30, 0x40, 0x01, 0x81, 0x09, 0x40, 0x0F, 0x00, 0xC0,
+0x90, 0x0C, 0x40, 0x00, 0xA0, 0x07, 0x80, 0x50, 0x70, 0xB0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0xB1,
+0xD0, 0xF1, 0x25, 0xD0, 0xB0, 0xF2, 0x21, 0xF5, 0xD0, 0x60, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x20,
+0xF1, 0x20, 0xF0, 0xB1, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0x23, 0xD1, 0x60, 0xF1, 0x20, 0xF0, 0x20,
+0xD1, 0x10, 0x31, 0x06, 0x50, 0x30, 0xD2, 0xB0, 0x60, 0xD2, 0x21, 0xD0, 0xF0, 0xD0, 0x10, 0x60,
+0xD0, 0xF1, 0xD0, 0xB0, 0x60, 0xF1, 0x20, 0xF4, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF4, 0x22, 0xF1, 0x23, 0xF0, 0x60, 0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF1, 0x2E, 0xF5, 0x20, 0xF1, 0x23, 0xF2, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xD1, 0x80,
+0x90, 0x01, 0x41, 0x90, 0xA0, 0x03, 0xA0, 0x90, 0x0B, 0x0D, 0x70, 0x01, 0x40, 0x30, 0x90, 0x01,
+0xA0, 0x01, 0x90, 0xE0, 0xB0, 0x60, 0xB0, 0xF0, 0xD1, 0xF3, 0x25, 0xF8, 0x20, 0xF6, 0x24, 0xF2,
+0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0xF0, 0x23, 0xF2, 0x21, 0xF4,
+0x60, 0xB0, 0xD1, 0xF1, 0x23, 0xF4, 0x21, 0xF0, 0x20, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20,
+0xD0, 0x21, 0xD0, 0x60, 0x80, 0x02, 0xA0, 0x60, 0xB0, 0xD1, 0x21, 0xD0, 0xB1, 0x40, 0x70, 0x01,
+0xC1, 0x08, 0x40, 0xC0, 0x0F, 0x00, 0x40, 0x0D, 0x40, 0x00, 0x30, 0xC0, 0x06, 0xE1, 0x30, 0xD1,
+0xF2, 0x21, 0xF2, 0xB1, 0xF2, 0x24, 0xF2, 0xB0, 0xF4, 0x20, 0xF2, 0x20, 0xD0, 0xB1, 0xF2, 0x20,
+0xF0, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF2, 0x22, 0xF3, 0x22, 0xF3, 0x60, 0xF1, 0x21, 0xD1,
+0xA0, 0x10, 0x40, 0x05, 0x50, 0x90, 0x30, 0xD0, 0xF0, 0x20, 0xF1, 0x60, 0xF0, 0xD0, 0xF0, 0x20,
+0xF1, 0xD0, 0x30, 0x60, 0xD4, 0xF0, 0x60, 0xB0, 0xD0, 0xF6, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0xB0,
+0x60, 0xB0, 0xF3, 0x27, 0xF1, 0xB1, 0xF0, 0x22, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xF3, 0x24, 0xF1,
+0x20, 0xF1, 0x22, 0xF7, 0x26, 0xF3, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xE0, 0x90, 0x01, 0xA0, 0x01,
+0x80, 0x10, 0x40, 0xC0, 0x00, 0xA0, 0x50, 0x0B, 0x0D, 0x80, 0x40, 0x03, 0xC0, 0x00, 0x40, 0xA0,
+0x12, 0x80, 0xD1, 0xF2, 0x22, 0xFB, 0x21, 0xF5, 0x23, 0xF5, 0xB0, 0x60, 0xB0, 0xF3, 0x24, 0xF1,
+0xD0, 0x60, 0xF1, 0x23, 0xF4, 0xD0, 0xF0, 0xB1, 0xF0, 0xD0, 0xF3, 0x21, 0xF4, 0x21, 0xF0, 0x20,
+0xF1, 0x61, 0xF1, 0x21, 0xF3, 0x20, 0xD0, 0xB0, 0xA0, 0x01, 0xC0, 0x30, 0x70, 0xD1, 0x22, 0xF0,
+0xD0, 0xB0, 0xA0, 0x70, 0x0B, 0x90, 0x50, 0x0F, 0x00, 0x51, 0x0C, 0x90, 0xC0, 0x00, 0xA0, 0x80,
+0x07, 0x30, 0xA0, 0xD0, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0xB1, 0xF1, 0x26, 0xF0, 0xD0, 0x60, 0xD0,
+0xF4, 0x23, 0xF1, 0x60, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0xB1, 0xD0, 0xF1, 0x21, 0xF0,
+0x20, 0xF1, 0x23, 0xF2, 0xB0, 0x60, 0xF3, 0xD0, 0xB1, 0x70, 0x04, 0x50, 0x90, 0x00, 0xA0, 0xD0,
+0xF0, 0x21, 0xF0, 0x20, 0x60, 0xB0, 0xF1, 0x20, 0xF1, 0xD0, 0x20, 0xD0, 0x61, 0xD1, 0xF1, 0xB0,
+0x60, 0xF0, 0xD0, 0x24, 0xF0, 0x24, 0xF3, 0xD0, 0x20, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x21, 0xF0,
+0x23, 0xF2, 0x60, 0xF1, 0x25, 0xF3, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF0,
+0x20, 0xF1, 0x20, 0xF3, 0x21, 0xF9, 0x24, 0xF2, 0xD1, 0xB0, 0x12, 0xA0, 0x80, 0x02, 0xC0, 0x30,
+0x71, 0x80, 0x0C, 0x0F, 0x00, 0xC1, 0x70, 0xE1, 0x30, 0x00, 0x10, 0xE0, 0x40, 0x50, 0xA0, 0xD0,
+0xF2, 0x23, 0xF8, 0x23, 0xF0, 0x21, 0xF0, 0x25, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0xF2,
+0x26, 0xF1, 0xD0, 0xF0, 0x60, 0xF0, 0x24, 0xF3, 0xB0, 0x60, 0xB0, 0xF2, 0x21, 0xF1, 0x21, 0xF4,
+0x21, 0xF2, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF3, 0x20, 0xD0, 0xB0, 0x10, 0x00, 0xC0, 0x90, 0xA0,
+0xD0, 0xF2, 0x21, 0xF0, 0xD0, 0x80, 0x40, 0xC0, 0x0A, 0x50, 0x90, 0x0F, 0x01, 0x40, 0x0D, 0x40,
+0x01, 0x50, 0x10, 0xC0, 0x06, 0xE0, 0x70, 0xD0, 0xF4, 0x21, 0xF1, 0xB1, 0xF1, 0x22, 0xF0, 0x22,
+0xF0, 0xD0, 0x60, 0xD0, 0xF4, 0x23, 0xF0, 0xD0, 0x60, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x21, 0xF0,
+0xD0, 0xF0, 0x60, 0xF2, 0x22, 0xF2, 0x25, 0xF0, 0xD0, 0xB1, 0xD0, 0xF2, 0xD1, 0x30, 0x50, 0x02,
+0xC0, 0x40, 0x01, 0xA0, 0xD0, 0x23, 0xF1, 0x60, 0xB0, 0xD0, 0xF3, 0x20, 0xD0, 0x60, 0x10, 0x70,
+0x60, 0xD0, 0xF0, 0xD0, 0xB0, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF7, 0x60,
+0xB0, 0xF3, 0x24, 0xF0, 0xB1, 0xD0, 0xF0, 0x27, 0xF1, 0xD1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2,
+0x20, 0xF0, 0x21, 0xF1, 0x26, 0xF8, 0x24, 0xF0, 0xD0, 0xF0, 0xD0, 0x30, 0x40, 0x90, 0x70, 0x10,
+0x50, 0x80, 0xA0, 0x90, 0x0F, 0x02, 0x0E, 0x90, 0xE0, 0x00, 0x40, 0x80, 0x00, 0xE0, 0x00, 0xA0,
+0x02, 0xA0, 0xD1, 0xF0, 0x20, 0xF6, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xF1, 0x26, 0xF0, 0xD0, 0xF0,
+0xB0, 0x60, 0xB0, 0xD1, 0x20, 0xF1, 0x26, 0xF3, 0xD0, 0xB1, 0xF0, 0xD0, 0x20, 0xF2, 0xD0, 0xB0,
+0x60, 0xB0, 0xD1, 0xF0, 0x23, 0xF2, 0xD0, 0xF3, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xF1, 0x23, 0xF3,
+0x21, 0xF0, 0xB0, 0x30, 0x50, 0x90, 0x00, 0x40, 0x30, 0xA0, 0x60, 0xD0, 0x20, 0xF0, 0xD1, 0xA0,
+0x41, 0x50, 0x08, 0xC0, 0x90, 0x0F, 0x01, 0x90, 0xC0, 0x0C, 0xC0, 0x90, 0x02, 0xE0, 0x30, 0x06,
+0xA0, 0x70, 0xD0, 0xF3, 0x23, 0xF0, 0xB1, 0xF6, 0x21, 0xF0, 0xD0, 0x60, 0xF6, 0x22, 0xF0, 0xD0,
+0xB1, 0xF1, 0x23, 0xF1, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x26,
+0xF1, 0x60, 0xB0, 0xF0, 0xD0, 0xF3, 0x70, 0x30, 0xC1, 0x80, 0x01, 0x50, 0xA0, 0xD1, 0xF2, 0x20,
+0xD1, 0xB1, 0xD0, 0xF0, 0x21, 0xF1, 0xD1, 0xB0, 0xE0, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0x60, 0xB0,
+0xD0, 0xF0, 0x22, 0xF3, 0x22, 0xF0, 0x21, 0xF0, 0xD2, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0xD0, 0xF0,
+0x20, 0xF2, 0x60, 0xD0, 0xF1, 0x2B, 0xD1, 0xF0, 0x61, 0xF0, 0xD0, 0xF1, 0x20, 0xF2, 0x20, 0xF0,
+0x2B, 0xF4, 0x21, 0xF0, 0x20, 0xF0, 0xD1, 0xA0, 0x02, 0x30, 0x00, 0xC0, 0x10, 0x70, 0x10, 0x30,
+0xC0, 0x0E, 0x0E, 0xA0, 0x50, 0x01, 0xE0, 0x00, 0x30, 0x92, 0x00, 0x40, 0x70, 0x30, 0xD0, 0x21,
+0xF6, 0x29, 0xF0, 0x24, 0xF0, 0x20, 0xF2, 0x61, 0xB0, 0xD1, 0xF2, 0x21, 0xF1, 0x24, 0xF5, 0x60,
+0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x25, 0xF5, 0x20, 0xF2, 0x60, 0xB0, 0xD1,
+0xF0, 0x22, 0xF0, 0x20, 0xF4, 0xD0, 0xE0, 0x30, 0x50, 0x02, 0xA0, 0xF0, 0xD0, 0xF2, 0xD1, 0x80,
+0x70, 0x80, 0xA0, 0x50, 0x07, 0x40, 0x0F, 0x02, 0x40, 0x0D, 0x90, 0xC0, 0x02, 0x90, 0x70, 0x06,
+0xA0, 0x10, 0xB0, 0xD0, 0x20, 0xF1, 0x23, 0xF0, 0xB1, 0xF7, 0x20, 0xF1, 0xB1, 0xF0, 0x22, 0xF1,
+0x22, 0xF2, 0x60, 0xD0, 0xF1, 0x21, 0xF1, 0x23, 0xF1, 0xD0, 0xB0, 0xF1, 0x20, 0xF0, 0x20, 0xF0,
+0x27, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF4, 0xD1, 0x90, 0xA0, 0x90, 0x00, 0x40, 0x00, 0x40, 0x60,
+0xD0, 0x20, 0xF1, 0x20, 0xD0, 0x20, 0xF0, 0xD0, 0x61, 0xF0, 0xD0, 0x61, 0xF1, 0xD1, 0xB0, 0xE0,
+0xD4, 0xB0, 0x60, 0xF8, 0x21, 0xF3, 0x21, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF3, 0x60, 0xF3,
+0x20, 0xF2, 0x25, 0xF4, 0xD0, 0xF0, 0x61, 0xB0, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x2D, 0xF6, 0x20,
+0xF0, 0xD0, 0x60, 0x70, 0x40, 0x00, 0x50, 0x80, 0x01, 0xA0, 0x01, 0x40, 0xE0, 0x80, 0x0D, 0x0E,
+0x40, 0x30, 0xC0, 0x80, 0x70, 0x03, 0xE0, 0x30, 0x90, 0x00, 0x70, 0xD0, 0xF0, 0x23, 0xF5, 0x2A,
+0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x61, 0xF3, 0x21, 0xF4, 0x26, 0xF1, 0x21, 0xD0, 0xB1, 0xD1, 0xF0,
+0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20, 0xF1, 0x23, 0xF4, 0x21, 0xF1, 0xB0, 0x60, 0xF0, 0xD0, 0xF1,
+0x23, 0xF5, 0xD0, 0xB0, 0xA0, 0xC0, 0x03, 0x80, 0xB0, 0xD0, 0xF2, 0xD1, 0x60, 0xB0, 0x11, 0x90,
+0x50, 0x05, 0x40, 0x0F, 0x02, 0x90, 0xC0, 0x0D, 0x40, 0x04, 0x40, 0xA0, 0x40, 0xC0, 0x03, 0xA0,
+0x10, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0xB1, 0xF7, 0x20, 0xF1, 0xB1, 0xF0, 0x22, 0xF1, 0x22, 0xF1,
+0xD0, 0x60, 0xF2, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF2, 0x60, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0x25,
+0xF1, 0xD0, 0x60, 0xF0, 0xD0, 0xF3, 0xB0, 0x60, 0x30, 0x00, 0xC0, 0x90, 0x30, 0x60, 0xD0, 0xF0,
+0x20, 0xF4, 0xD0, 0xA1, 0x80, 0xD0, 0xE0, 0x30, 0xD0, 0xF1, 0xD0, 0x60, 0x70, 0xD0, 0x60, 0x30,
+0xD0, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xF2, 0x22, 0xF4, 0x24, 0xF1, 0xD0, 0xF0, 0x61, 0xF2, 0xB0,
+0x60, 0xD0, 0x21, 0xF2, 0x25, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0x20,
+0xF0, 0x29, 0xF7, 0x21, 0xF1, 0xD0, 0xA0, 0x51, 0x30, 0xE0, 0xC0, 0x0F, 0x06, 0x0F, 0x00, 0x80,
+0x70, 0x30, 0x50, 0x30, 0x70, 0x30, 0x00, 0xA0, 0x02, 0x30, 0xB0, 0xD0, 0x20, 0xF0, 0x22, 0xF4,
+0x2B, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x23, 0xF5, 0x24, 0xF1, 0x20, 0xF2, 0x60,
+0xD0, 0xB0, 0x60, 0xF4, 0x27, 0xF2, 0x21, 0xF2, 0x60, 0xB0, 0xF4, 0x21, 0xF1, 0x20, 0xF0, 0x21,
+0xF2, 0x80, 0xE0, 0x04, 0x50, 0xE0, 0x60, 0xD0, 0xF0, 0xD1, 0x60, 0xB0, 0xD0, 0xB0, 0xA0, 0xE0,
+0x91, 0x03, 0x40, 0xC0, 0x0F, 0x01, 0xC0, 0x90, 0x0D, 0x51, 0x06, 0x40, 0xA0, 0x40, 0x01, 0x50,
+0xC0, 0x10, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0xB1, 0xF1, 0x22, 0xF5, 0xB1, 0xF1, 0x21, 0xF1, 0x24,
+0xF1, 0xB0, 0xD0, 0x22, 0xF3, 0x21, 0xF2, 0xD0, 0xB1, 0xD0, 0xF1, 0x23, 0xF2, 0x22, 0xF3, 0x20,
+0x60, 0xF3, 0xB0, 0x60, 0xD0, 0x70, 0xA0, 0x00, 0x90, 0x70, 0x80, 0xD0, 0xF2, 0x21, 0xF2, 0x80,
+0x90, 0xA0, 0x60, 0xD1, 0xF2, 0x20, 0xF0, 0xB0, 0xD0, 0xB0, 0xE0, 0x60, 0xD1, 0xF0, 0xD0, 0xB0,
+0x60, 0xF2, 0x22, 0xF6, 0x22, 0xF4, 0x60, 0xB0, 0xD0, 0x60, 0xF5, 0x25, 0xF3, 0x25, 0xF1, 0xD0,
+0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0x28, 0xF6, 0x21, 0xF1, 0xD0, 0xA0, 0x02, 0xA0,
+0x50, 0xC0, 0x0F, 0x05, 0x0F, 0x02, 0x70, 0xE0, 0x40, 0xC0, 0x80, 0x30, 0x90, 0x40, 0x01, 0x80,
+0xA0, 0xD0, 0xF1, 0x2A, 0xF3, 0x20, 0xF1, 0xD1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x22, 0xF5,
+0x20, 0xF0, 0x27, 0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF2,
+0x24, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF3, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0xB0,
+0x60, 0x80, 0x10, 0xA0, 0x04, 0x30, 0x70, 0xD1, 0xF0, 0x60, 0xB0, 0xF1, 0xD1, 0xB0, 0xE0, 0x80,
+0x90, 0x01, 0x90, 0x50, 0x0F, 0x02, 0x40, 0x0E, 0x90, 0x09, 0x40, 0x32, 0xC0, 0xE0, 0x30, 0xD0,
+0xF1, 0x22, 0xF1, 0xD0, 0xB1, 0xF1, 0x25, 0xF3, 0x60, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0x60, 0xF0,
+0x23, 0xF1, 0x24, 0xF2, 0x60, 0xF1, 0x20, 0xF0, 0x22, 0xF4, 0xD0, 0xF2, 0x21, 0xB0, 0x60, 0xD1,
+0xB1, 0xF0, 0xD0, 0x30, 0x10, 0xA0, 0x70, 0xE0, 0xB0, 0xD0, 0xF4, 0x20, 0xF0, 0xD0, 0x30, 0xC1,
+0xA0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0xD1, 0xF1, 0xD0, 0xB0, 0xE0, 0x60, 0xD0, 0xF0, 0xD0, 0xE0,
+0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x22, 0xF3, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0xB0, 0x61, 0xD0, 0xF1,
+0x29, 0xF1, 0x22, 0xF1, 0x22, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0xD0, 0xF1, 0x2D, 0xF1,
+0xD0, 0x30, 0xA0, 0x01, 0x90, 0x41, 0x10, 0xE0, 0x40, 0x0F, 0x03, 0x0F, 0x01, 0x70, 0x40, 0x02,
+0xC0, 0x70, 0x00, 0x70, 0x80, 0xA0, 0x90, 0xA0, 0xB0, 0xF1, 0x20, 0xF0, 0x26, 0xF6, 0xD0, 0xF0,
+0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF3, 0x24, 0xF3, 0x20, 0xF0, 0x25, 0xF3, 0xD0, 0xF0, 0x62, 0xF2,
+0x23, 0xF1, 0x20, 0xF1, 0x20, 0xF1, 0x21, 0xF2, 0xB0, 0x60, 0xF0, 0xD0, 0xF2, 0x21, 0xF3, 0x23,
+0xF0, 0xB0, 0x60, 0xD1, 0xA0, 0x10, 0x40, 0x03, 0x30, 0xB0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0x21,
+0xF1, 0xD0, 0x60, 0x10, 0x80, 0x90, 0x51, 0x0F, 0x02, 0x51, 0x0E, 0x40, 0x0C, 0x90, 0x30, 0xA0,
+0x30, 0xD1, 0xF0, 0x22, 0xF1, 0xD0, 0xB1, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0x21,
+0xF1, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0xF2, 0x24, 0xF2, 0x22, 0xF0, 0xB0, 0x60, 0xF1, 0x24,
+0xF6, 0x22, 0xD0, 0xB0, 0x61, 0xB0, 0xD0, 0xF0, 0xD3, 0x61, 0xD0, 0x60, 0xF6, 0xD0, 0x10, 0x90,
+0x00, 0x70, 0xD0, 0x61, 0xD1, 0x61, 0xD0, 0x21, 0xD0, 0xA0, 0x30, 0xD0, 0xF0, 0xD0, 0xA0, 0xF0,
+0xD0, 0x61, 0xD0, 0xF1, 0x24, 0xF4, 0x23, 0xF1, 0xD0, 0x60, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20,
+0xF0, 0x28, 0xF3, 0x24, 0xF2, 0xD1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF4, 0x27, 0xF4, 0xD0, 0xA0,
+0x90, 0xA0, 0x30, 0xA0, 0x01, 0x70, 0xC0, 0x30, 0xE0, 0x70, 0x50, 0x0F, 0x00, 0x0F, 0x01, 0x70,
+0x02, 0x40, 0xE0, 0x90, 0x00, 0x80, 0x40, 0x01, 0x90, 0x80, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0x21, 0xF6, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF1, 0x20, 0xF4, 0x23, 0xF1, 0x20, 0xF1, 0x26, 0xF2,
+0xD0, 0xF0, 0xB0, 0x60, 0x20, 0xF1, 0x60, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF0,
+0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xD0, 0x20, 0xF0, 0x20, 0xF2, 0x23, 0xF1, 0x60, 0xB0,
+0xF0, 0xD2, 0x70, 0x10, 0x90, 0x02, 0x70, 0xB0, 0x61, 0xB0, 0xF5, 0xD1, 0x70, 0x10, 0xC0, 0x80,
+0xC0, 0x0F, 0x02, 0x40, 0x0E, 0x50, 0xC0, 0x0C, 0x90, 0x00, 0x61, 0xD0, 0xF1, 0x22, 0xF1, 0xD0,
+0xB1, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x60, 0xF2, 0x24, 0xF1, 0x21, 0xF1, 0x60, 0xD0,
+0xF0, 0x22, 0xF1, 0x26, 0xF0, 0x60, 0xF2, 0x23, 0xF1, 0x20, 0xF2, 0x22, 0xF2, 0x61, 0xD0, 0xF0,
+0xD0, 0xB0, 0xF0, 0x61, 0xD1, 0xF1, 0x60, 0xF0, 0xD0, 0xF3, 0xD0, 0x60, 0xA0, 0x71, 0xB0, 0xD0,
+0xB0, 0x60, 0xF1, 0x61, 0xF2, 0xD2, 0xF1, 0xD1, 0xF0, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF1, 0x22,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x60, 0xB0, 0xD0, 0x20, 0x60, 0xB0, 0xF0, 0xD0, 0xF2,
+0x25, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x26, 0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x21,
+0xF0, 0x24, 0xF0, 0xD0, 0x20, 0xF0, 0xD0, 0x60, 0x80, 0x01, 0x50, 0x30, 0x01, 0x40, 0x02, 0x90,
+0x40, 0x0F, 0x00, 0x0F, 0x01, 0x40, 0xE0, 0x70, 0xE0, 0xA0, 0x50, 0xC0, 0x90, 0xC0, 0x30, 0x02,
+0x70, 0xD0, 0x20, 0xD0, 0x20, 0xF1, 0x23, 0xF4, 0x20, 0x61, 0xB0, 0xD1, 0x25, 0xF2, 0x23, 0xF1,
+0x27, 0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF2, 0x60, 0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x22,
+0xF1, 0x21, 0xD1, 0xB0, 0x60, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xF2, 0x60,
+0xB0, 0xF4, 0xD0, 0x60, 0x70, 0x90, 0x01, 0x70, 0x40, 0x70, 0xF0, 0xD0, 0xF3, 0x20, 0xF1, 0xD0,
+0xB0, 0xA0, 0x90, 0x00, 0x40, 0xC0, 0x0F, 0x00, 0x90, 0xC0, 0x0E, 0x40, 0x0D, 0x90, 0x40, 0xA0,
+0xF0, 0xD0, 0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0xB0, 0xF2, 0x24, 0xF2,
+0x20, 0xF0, 0xD0, 0x60, 0xF2, 0x21, 0xF1, 0x22, 0xF1, 0x22, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF0,
+0x23, 0xF2, 0x21, 0xF2, 0x60, 0xF0, 0x60, 0xB0, 0xD0, 0x60, 0x70, 0x61, 0xB0, 0xF4, 0x60, 0xF0,
+0xD0, 0x20, 0xF2, 0xD1, 0x30, 0x11, 0xB0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0xB0, 0xF0, 0xD1, 0xF0,
+0xB0, 0xD0, 0x61, 0xD0, 0xF1, 0xD0, 0xF1, 0xB1, 0xF3, 0x21, 0xF0, 0x24, 0xF3, 0x60, 0xF2, 0xD0,
+0xB0, 0x60, 0xB0, 0xD0, 0xF2, 0x23, 0xF0, 0x22, 0xF5, 0x25, 0xF2, 0xD1, 0xB0, 0x61, 0xF0, 0xD0,
+0xF2, 0x24, 0xF2, 0xD0, 0xF0, 0xD0, 0x70, 0x02, 0x80, 0x50, 0x0F, 0x08, 0x0F, 0x02, 0xC0, 0x50,
+0x01, 0xC0, 0x30, 0x40, 0x90, 0x80, 0x50, 0x30, 0xA0, 0x30, 0x60, 0xD0, 0x20, 0xF2, 0x23, 0xF0,
+0xD1, 0xF0, 0x61, 0xF0, 0xD1, 0xF0, 0x24, 0xF5, 0x26, 0xF1, 0x21, 0xF2, 0xD0, 0xF0, 0x60, 0xB0,
+0xD0, 0xF0, 0x22, 0xF1, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xD0,
+0xF0, 0x22, 0xF4, 0x23, 0xF2, 0x60, 0xF0, 0xD0, 0xF2, 0x20, 0xF1, 0xD1, 0xA0, 0x80, 0x00, 0x90,
+0x30, 0x70, 0x80, 0xE0, 0x22, 0xF4, 0xD0, 0xA0, 0x30, 0x01, 0x91, 0x0E, 0x40, 0x0F, 0x00, 0x40,
+0x0C, 0x90, 0xE0, 0x10, 0x60, 0xD0, 0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0xB1,
+0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF2, 0x21,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xB1, 0xD1, 0xF1, 0x25, 0xF2, 0xD0, 0xB0, 0x60, 0xF2, 0x60, 0xF0,
+0xB1, 0xD0, 0xF4, 0x20, 0xF0, 0x20, 0x60, 0xD2, 0xF0, 0x20, 0xF1, 0xD0, 0x70, 0xC0, 0xA0, 0xD1,
+0xF0, 0x60, 0xF0, 0xD0, 0xB0, 0x70, 0xB0, 0xD0, 0xA0, 0xE0, 0xD1, 0xF4, 0xD0, 0xF0, 0xB0, 0x60,
+0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xF0,
+0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF3, 0x26, 0xF5, 0x22, 0xF0, 0x20, 0xF4, 0xD0, 0xF0, 0x61, 0xF0,
+0xD0, 0xF2, 0x23, 0xF1, 0x20, 0xF0, 0xB0, 0xA1, 0x30, 0x50, 0xA0, 0x0F, 0x09, 0x0F, 0x07, 0x81,
+0x50, 0xC0, 0x10, 0xC0, 0x01, 0xA0, 0xD0, 0x21, 0xF6, 0xB0, 0x61, 0xF0, 0xD0, 0xF5, 0x21, 0xF6,
+0x21, 0xF0, 0x25, 0xF1, 0x20, 0xF1, 0x61, 0xF0, 0xD0, 0xF0, 0x20, 0xF3, 0xD0, 0xB1, 0xD0, 0xF1,
+0x21, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x22, 0xF0,
+0x20, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x25, 0xD1, 0xA0, 0x91, 0xC0, 0x00, 0xA1, 0xF1, 0x21,
+0xF3, 0x60, 0xD0, 0x11, 0x01, 0x50, 0x40, 0x0C, 0x40, 0x0F, 0x00, 0x90, 0x0D, 0x50, 0x80, 0xE0,
+0xD1, 0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF1,
+0x21, 0xF1, 0x21, 0xF2, 0x60, 0xD0, 0x22, 0xF3, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x60, 0xD0,
+0xF3, 0x25, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0x20, 0xF2, 0x60, 0xD1, 0xF0, 0x20, 0xF0, 0x22, 0xD0,
+0x20, 0xF1, 0x60, 0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0xD0, 0x10, 0x30, 0xD0, 0xF0, 0xD0, 0xF0, 0x60,
+0xB0, 0xD0, 0x60, 0xE0, 0x70, 0xD0, 0x70, 0xA0, 0xD0, 0xF3, 0xB0, 0x70, 0xD1, 0xF0, 0x60, 0xB0,
+0xF4, 0x24, 0xD0, 0xB1, 0xF6, 0xD0, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF2, 0x24, 0xF0, 0x20, 0xF8,
+0x21, 0xF5, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF2, 0x20, 0xF4, 0xD0, 0x30, 0x50, 0x01, 0x70, 0x90,
+0x0F, 0x09, 0x0F, 0x08, 0xC0, 0x01, 0xA0, 0x02, 0x30, 0xB0, 0xF2, 0x20, 0xF1, 0xD0, 0xB0, 0x61,
+0xF0, 0xD0, 0xF4, 0x22, 0xF0, 0x21, 0xF4, 0x28, 0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xF2, 0x21, 0xF0,
+0x20, 0xF0, 0xD0, 0x20, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0xB0, 0x60, 0xF2,
+0x23, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xB0, 0x60, 0xF3, 0x21, 0xF0, 0x22, 0xF2, 0xD0,
+0xA0, 0x50, 0x02, 0xE0, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xB0, 0xD1, 0xA0, 0x40, 0x01, 0xC0, 0x40,
+0xC0, 0x09, 0xC0, 0x90, 0x0F, 0x00, 0x40, 0x0D, 0x90, 0xE0, 0x30, 0xD0, 0x21, 0xF1, 0x22, 0xF2,
+0xB1, 0xF1, 0x22, 0xF3, 0x21, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF2,
+0xD0, 0x60, 0xF1, 0x21, 0xF3, 0x22, 0xF2, 0x20, 0xF0, 0xB1, 0xD0, 0xF0, 0x25, 0xF1, 0xB0, 0x60,
+0xB0, 0xD0, 0xF0, 0x22, 0xF0, 0xB0, 0x60, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0x20,
+0xF0, 0x22, 0xF0, 0xD0, 0xB0, 0xD0, 0x20, 0xF3, 0x60, 0xB0, 0xD1, 0xF0, 0xD0, 0x60, 0x10, 0x30,
+0xD0, 0xF0, 0xD3, 0xF2, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x21, 0xF3, 0x60, 0xD0, 0x20, 0xF0,
+0x24, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x25, 0xF9, 0x24, 0xF2, 0xD0, 0xF0, 0xB0,
+0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF3, 0xA0, 0x02, 0xA0, 0x0F, 0x0A, 0x0F, 0x0B, 0x90, 0x40,
+0x00, 0x80, 0xA0, 0x30, 0xD0, 0xF1, 0xD1, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF2, 0x24, 0xF6, 0x28,
+0xF0, 0x21, 0xD0, 0xF1, 0x60, 0xB0, 0xD1, 0xF0, 0x23, 0xF4, 0x21, 0x60, 0xD0, 0xF0, 0xD0, 0xF3,
+0x20, 0x60, 0xB0, 0xD1, 0xF2, 0x20, 0xF2, 0x25, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0x70, 0x50, 0x01, 0x80, 0x60,
+0xD0, 0x22, 0xD0, 0x61, 0xD0, 0xF1, 0xD0, 0xA0, 0x40, 0x02, 0x91, 0x08, 0x40, 0x0F, 0x00, 0xC0,
+0x90, 0x0D, 0x40, 0x10, 0xB0, 0xD0, 0xF3, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF1, 0x60,
+0xF1, 0x20, 0xF1, 0x21, 0xF3, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0x21, 0xF3, 0x23, 0xF4, 0x60, 0xF0,
+0xD0, 0x22, 0xF3, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF2,
+0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xB0, 0x60, 0xF5, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0xD0, 0xB1, 0xD0,
+0xF1, 0xD0, 0x60, 0xE0, 0xD1, 0xA0, 0x70, 0x30, 0x60, 0xD0, 0x21, 0xD1, 0xF0, 0x60, 0xB0, 0xD0,
+0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF2, 0xD0, 0xB0, 0x60, 0xB0,
+0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x26, 0xF4, 0x21, 0xF1, 0x24, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0,
+0xD1, 0xF0, 0xD1, 0x80, 0x70, 0x30, 0x00, 0x50, 0x80, 0x0F, 0x0A, 0x0F, 0x0C, 0xE0, 0x30, 0x50,
+0x00, 0x70, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xD1, 0x29, 0xF3, 0x2A, 0xF2, 0xD0, 0xF0, 0x60, 0xB0,
+0xD0, 0xF2, 0x23, 0xF3, 0x22, 0xF0, 0xB1, 0xD0, 0xF2, 0xD0, 0xB0, 0x60, 0xD1, 0xF2, 0x21, 0xF0,
+0x21, 0xF1, 0x23, 0xF0, 0xD0, 0x60, 0xB0, 0xD1, 0xF0, 0x25, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xB0,
+0xD1, 0x70, 0xC0, 0x00, 0x50, 0x70, 0xD0, 0xF2, 0xB0, 0x60, 0xD0, 0xF1, 0x20, 0xD1, 0xA0, 0x90,
+0x01, 0x90, 0x50, 0x40, 0xC0, 0x05, 0x51, 0x0F, 0x00, 0x90, 0x0E, 0x80, 0x10, 0xD0, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF1, 0xB0, 0xF1, 0x20, 0xF1, 0x21,
+0xF3, 0x20, 0xF2, 0x60, 0xF0, 0x21, 0xF3, 0x23, 0xF3, 0xD0, 0xB1, 0xF1, 0x21, 0xF2, 0x62, 0xF8,
+0xD0, 0xB1, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF3, 0x60, 0xD1, 0xF1, 0xD0, 0xF0, 0x26, 0xD0,
+0xB0, 0x60, 0xF1, 0xD1, 0xF1, 0x20, 0x60, 0x71, 0xE0, 0xD1, 0xF0, 0xE0, 0x10, 0x60, 0xD0, 0x61,
+0xD1, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0xD0, 0xB0, 0x60, 0xF0,
+0xD1, 0xF1, 0x27, 0xF4, 0x22, 0xF0, 0x24, 0xF4, 0xB0, 0x60, 0xB0, 0xF0, 0xD1, 0x70, 0x00, 0xC0,
+0x30, 0xE0, 0xC0, 0x0F, 0x0A, 0x0F, 0x0C, 0x80, 0xC0, 0x01, 0x50, 0x30, 0xB0, 0x60, 0xB0, 0xD0,
+0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF6, 0x28, 0xF1, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF1, 0x2C,
+0xF0, 0xD0, 0x60, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF3, 0x22, 0xF2, 0x24, 0xF0, 0x20, 0x60,
+0xB0, 0xF0, 0xD0, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF0,
+0xD0, 0x60, 0x40, 0x01, 0xC0, 0xA0, 0xD1, 0xF0, 0x60, 0xD0, 0xF4, 0xD1, 0x70, 0x00, 0x50, 0x90,
+0x01, 0x91, 0x04, 0x40, 0x0F, 0x01, 0x40, 0x0D, 0xC0, 0xA0, 0x70, 0xD0, 0xF1, 0x20, 0xF1, 0x22,
+0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x23, 0xD0, 0xB1, 0xF0, 0x20, 0xF1, 0x21, 0xF4, 0x20, 0xF0, 0xD0,
+0x60, 0x20, 0xF0, 0x20, 0xF3, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF4, 0xB0, 0x60,
+0xF0, 0xD0, 0xB1, 0xD0, 0x20, 0xF6, 0xD0, 0x60, 0xB0, 0xD0, 0xF4, 0x22, 0xF2, 0x60, 0xF0, 0xD0,
+0xF2, 0x22, 0xF0, 0x21, 0xF2, 0x20, 0x60, 0x20, 0xD0, 0xF4, 0xD0, 0xE0, 0xA0, 0xD0, 0xF1, 0xB0,
+0xD1, 0xF0, 0xD0, 0xF0, 0x61, 0xB0, 0xD0, 0xF0, 0x60, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x26, 0xF2,
+0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF2, 0x2A, 0xF3, 0x24, 0xF1, 0x21, 0xF0, 0xD1, 0xF0, 0x60, 0xB0,
+0x80, 0x40, 0x02, 0x30, 0x0F, 0x0B, 0x0F, 0x0D, 0xA0, 0x00, 0xC0, 0x80, 0xE0, 0xB0, 0xD0, 0xF0,
+0x20, 0xF0, 0x22, 0xF3, 0x21, 0xF7, 0x25, 0xF2, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0,
+0x25, 0xF2, 0x24, 0xF3, 0x60, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x21, 0xF4, 0x20,
+0xF2, 0x60, 0xF0, 0xD0, 0xF2, 0x22, 0xF5, 0xD0, 0x60, 0xB0, 0xF0, 0x20, 0xF1, 0xB0, 0xA0, 0x01,
+0xD0, 0x30, 0xD0, 0xF0, 0x60, 0xF7, 0xD0, 0x80, 0x40, 0x90, 0x03, 0xC0, 0x40, 0xC0, 0x01, 0x90,
+0xC0, 0x0F, 0x00, 0x51, 0x0D, 0xC0, 0x31, 0xD0, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22,
+0xF3, 0x22, 0xF1, 0xB0, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0xB0, 0xF6, 0x21, 0xF0, 0x23,
+0xF0, 0xD0, 0xF0, 0x60, 0xD1, 0x20, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0xF3, 0x20, 0xF2,
+0xD1, 0xF0, 0xB0, 0xF0, 0xD1, 0xB0, 0xD2, 0xF1, 0x20, 0xF1, 0xB0, 0x60, 0xD1, 0xF1, 0x21, 0xF1,
+0x20, 0xF0, 0x22, 0xD0, 0x20, 0x60, 0xF4, 0xD0, 0x30, 0x70, 0xD1, 0xF1, 0xD0, 0xF1, 0xD0, 0x60,
+0xA0, 0xB0, 0x30, 0x70, 0xA0, 0xB0, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0x25, 0xF3, 0xB1,
+0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x27, 0xF0, 0x20, 0xF2, 0x23, 0xF1, 0x22, 0xF2, 0xD1, 0xE0, 0x80,
+0xC0, 0x00, 0x30, 0xC0, 0x0F, 0x0B, 0x0F, 0x0D, 0x80, 0xA0, 0x30, 0x50, 0x40, 0x80, 0xD0, 0xF0,
+0x24, 0xF3, 0x22, 0xF3, 0x26, 0xF5, 0x60, 0xB0, 0xD0, 0xF1, 0x26, 0xF4, 0x21, 0xF1, 0x20, 0xF1,
+0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF2, 0x26, 0xF0, 0x20, 0xF3, 0xD0, 0xB0, 0x60, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF5, 0x60, 0xB0, 0xF5, 0xA0, 0x00, 0x40, 0x70, 0xB0, 0xF0, 0x60, 0xB0,
+0xF3, 0x20, 0xF3, 0xD0, 0xA0, 0x50, 0x05, 0x91, 0xC0, 0x40, 0x0F, 0x01, 0x90, 0xC0, 0x0D, 0xC0,
+0x10, 0x30, 0xD0, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x23, 0xF1, 0x60, 0xF3,
+0x21, 0xF0, 0x21, 0xF5, 0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x23, 0xF2, 0xD0, 0xB3, 0x20,
+0xD1, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0xD0, 0xF2, 0xD0, 0xF0, 0xB2, 0xF0, 0xA0, 0x80, 0xA0, 0x30,
+0xA0, 0x60, 0xA0, 0xF0, 0xD2, 0xF1, 0xD0, 0xB0, 0x60, 0xD0, 0xF4, 0xD0, 0xF1, 0x21, 0xF0, 0x20,
+0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x60, 0xF0, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x60, 0x30,
+0xF0, 0xD0, 0xB0, 0x61, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF4, 0x26, 0xF1, 0xD0, 0xB0, 0x60, 0xB0,
+0xD0, 0xF2, 0x20, 0xF0, 0x27, 0xF3, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x60,
+0x80, 0xC0, 0x32, 0x0F, 0x0C, 0x0F, 0x0D, 0xC0, 0xA0, 0x02, 0xA0, 0xD0, 0xF0, 0x23, 0xF4, 0x23,
+0xF0, 0x27, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0x24, 0xF3, 0x22, 0xF0, 0x22, 0xF4, 0xD0, 0xB0,
+0x61, 0xF4, 0x24, 0xF2, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x20, 0xF2, 0x24, 0xF1, 0xD0,
+0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0x30, 0xA0, 0x30, 0xD1, 0x60, 0xB0, 0xF0, 0x21,
+0xF0, 0x20, 0xF3, 0xD0, 0xB0, 0x40, 0xA0, 0x06, 0xC0, 0x80, 0x90, 0x0F, 0x01, 0x40, 0x0E, 0x50,
+0x70, 0x80, 0xD0, 0x22, 0xF1, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x24, 0xF1, 0x60, 0xF0, 0x20,
+0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF5, 0x25, 0xF2, 0xD1, 0xB0,
+0x60, 0xB0, 0xD0, 0xF3, 0x20, 0xF1, 0xB0, 0x60, 0xD2, 0xA1, 0x36, 0x50, 0x80, 0x10, 0x30, 0x70,
+0xE0, 0xA0, 0x60, 0xF0, 0x60, 0xF0, 0xD0, 0xB0, 0x60, 0xD1, 0xF4, 0x23, 0xF2, 0xD0, 0xB0, 0x60,
+0xD0, 0x21, 0xD0, 0x20, 0xF4, 0xD0, 0xF1, 0xD1, 0xF2, 0x61, 0xB0, 0xD0, 0xF1, 0x20, 0xF1, 0x21,
+0xF0, 0x20, 0xF4, 0x22, 0xF0, 0x21, 0xF2, 0xB0, 0x60, 0xF0, 0xD0, 0xF2, 0x21, 0xF0, 0x24, 0xF0,
+0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x20, 0xF1, 0x20, 0xD0, 0x70, 0x02, 0x30, 0x50, 0x0F, 0x0C,
+0x0F, 0x0E, 0x80, 0x50, 0x00, 0xC0, 0x70, 0x30, 0xD1, 0x22, 0xF4, 0x21, 0xF0, 0x28, 0xD0, 0xF2,
+0xB0, 0x60, 0xF0, 0xD0, 0xF2, 0x21, 0xF6, 0x22, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0xD0, 0x61, 0xD0,
+0xF0, 0x60, 0xD0, 0x20, 0xF0, 0x25, 0xF3, 0x20, 0xF1, 0x60, 0xB0, 0xF3, 0x22, 0xF0, 0x20, 0xF0,
+0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF2, 0x23, 0xD3, 0xB1, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0x60,
+0xD0, 0xA0, 0x40, 0x05, 0xC0, 0x50, 0xC0, 0x40, 0x50, 0x0D, 0x50, 0xC0, 0x0E, 0x90, 0x30, 0xB0,
+0xF0, 0xD0, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0xD0, 0x60, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0xF0, 0x20, 0x60, 0xD0, 0xF2, 0x20, 0xF0, 0x24,
+0xD1, 0xF0, 0xB0, 0x60, 0xB2, 0xD0, 0xF2, 0x20, 0xF1, 0xD1, 0x81, 0xA0, 0x70, 0x90, 0x06, 0xC0,
+0x90, 0x03, 0xC0, 0x70, 0xE0, 0xD0, 0xB0, 0xD0, 0xA0, 0x10, 0xE0, 0x30, 0x60, 0xB0, 0xF5, 0x20,
+0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xB0, 0x60, 0xF0, 0x23, 0xF2, 0xD0, 0x70, 0x30, 0xD0, 0xF2, 0xD0,
+0x60, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD1, 0xF2, 0x21, 0xF7, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xF0,
+0x61, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x28, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xD0,
+0x60, 0xE0, 0xC0, 0x00, 0xC0, 0xA0, 0x0F, 0x0D, 0x0F, 0x0E, 0xC0, 0x30, 0x80, 0x30, 0xC0, 0xA0,
+0xD0, 0xF1, 0x23, 0xF2, 0x29, 0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0x21, 0xF6,
+0x22, 0xF0, 0x21, 0xF4, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xB0, 0x60, 0xF1, 0x24, 0xF0, 0x20, 0xF3,
+0x20, 0x60, 0x20, 0xF3, 0x22, 0xF2, 0x22, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0x21, 0xF0, 0x20, 0xF0,
+0x23, 0xD1, 0xB0, 0x60, 0xD0, 0xF0, 0x26, 0xF1, 0x60, 0xF1, 0xD0, 0xA0, 0x50, 0x04, 0x40, 0x02,
+0x50, 0x40, 0xC0, 0x0B, 0x40, 0x0F, 0x00, 0x90, 0x80, 0x60, 0xF1, 0x22, 0xF0, 0x22, 0xF2, 0xB1,
+0xF1, 0x22, 0xF2, 0x23, 0xF0, 0xD0, 0x60, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x21,
+0xF0, 0xD0, 0x60, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0xF0, 0xB2, 0xF0, 0xD1, 0x60,
+0xF2, 0x20, 0xF1, 0xD0, 0xB0, 0xA1, 0x80, 0xC0, 0x01, 0xC0, 0x50, 0x90, 0xC0, 0x03, 0x51, 0x04,
+0x31, 0xA3, 0x30, 0xA0, 0x70, 0x30, 0xF0, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0xD0, 0xF0, 0x21,
+0xF1, 0xB0, 0x60, 0xF1, 0x22, 0xF0, 0xD1, 0x60, 0xF4, 0xB1, 0xF1, 0xD0, 0xB0, 0x60, 0xB0, 0xD0,
+0xF0, 0xD0, 0xF1, 0x23, 0xF5, 0x21, 0xF0, 0x21, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x20,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xA0, 0xC0, 0x31, 0x80,
+0x90, 0x0F, 0x0D, 0x0F, 0x0F, 0xA0, 0x90, 0x01, 0x40, 0x80, 0xD0, 0x27, 0xF1, 0x21, 0xF0, 0x22,
+0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xF2, 0x24, 0xF1, 0x20, 0xF1, 0x28, 0xF0, 0xD1, 0xB0, 0x60, 0xF1,
+0x22, 0xF0, 0xB1, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF3, 0x60, 0xF0, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF5, 0x60, 0xB0, 0xD0, 0x23, 0xF1, 0x23, 0xD0, 0xB0, 0x60, 0xD0, 0xF4,
+0x22, 0xF1, 0xB1, 0xF3, 0x70, 0x03, 0x51, 0x04, 0x50, 0x40, 0xC0, 0x09, 0x40, 0x0E, 0xC0, 0x50,
+0x30, 0xB0, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0xD0,
+0xB1, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0x22, 0xD0, 0xB1, 0xD0, 0x23, 0xF4, 0x60, 0xB0, 0xF4, 0xB1,
+0xD0, 0xF1, 0xD0, 0xB0, 0xA1, 0x90, 0x01, 0x40, 0x70, 0xA1, 0x31, 0xE0, 0x50, 0x03, 0x90, 0xC0,
+0x04, 0xC0, 0x02, 0xC0, 0x40, 0x30, 0xE0, 0x70, 0x30, 0xB0, 0xD1, 0xF2, 0xD0, 0xF1, 0x22, 0xF2,
+0x60, 0xB0, 0xF0, 0x21, 0xD0, 0x30, 0xA0, 0xE0, 0x60, 0xD0, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF1,
+0x21, 0xF0, 0xB0, 0x60, 0xD0, 0xF0, 0xD0, 0xF0, 0x24, 0xF5, 0x25, 0xF1, 0xD1, 0xB0, 0x60, 0xB0,
+0xD0, 0xF0, 0xD0, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x25, 0xD0, 0x60, 0x80, 0x01, 0x50,
+0x70, 0x0F, 0x0E, 0x0F, 0x0F, 0xC0, 0x30, 0x01, 0xC0, 0x10, 0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF3,
+0x21, 0xF3, 0x61, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x28, 0xD0, 0xF1, 0xD0,
+0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF1, 0x60, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xD1,
+0xF2, 0x20, 0xF0, 0x24, 0xF1, 0xD1, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF2, 0xD0, 0xF0, 0x20, 0xF1,
+0x60, 0xF7, 0x21, 0xF0, 0xB0, 0x60, 0xD0, 0xF2, 0xD0, 0xB0, 0xA0, 0x02, 0x40, 0x07, 0x50, 0x40,
+0x50, 0x06, 0x90, 0x0F, 0x00, 0x50, 0xC0, 0x30, 0xB0, 0xF2, 0x21, 0xF0, 0x22, 0xF2, 0xB1, 0xF1,
+0x22, 0xF1, 0x24, 0xF2, 0xB0, 0xF2, 0x20, 0xF0, 0x23, 0xF1, 0x21, 0xF1, 0xB0, 0x60, 0xF1, 0x20,
+0xF2, 0xD0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0, 0xF0, 0x21, 0xF1, 0xD0, 0x60, 0xF1, 0xD0, 0x60, 0x70,
+0x50, 0x02, 0x40, 0x30, 0xB0, 0xD1, 0x30, 0xA0, 0x80, 0x05, 0x80, 0x0B, 0x40, 0xA0, 0x70, 0x10,
+0xA0, 0xD2, 0xF3, 0x21, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xB0, 0xD1, 0xA0, 0x90, 0xB0, 0x70, 0xF0,
+0xD0, 0xF1, 0x60, 0xD0, 0xF1, 0x23, 0xF0, 0xB0, 0x60, 0xF0, 0xD1, 0x22, 0xF0, 0x26, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x21, 0xF3, 0x61, 0xF3, 0xB0, 0x60, 0xF2, 0x21, 0xF0, 0xD0, 0xF2, 0x20, 0xF1,
+0xD0, 0xE0, 0x90, 0x01, 0x40, 0x90, 0x0F, 0x0E, 0x0F, 0x10, 0xA0, 0x50, 0x31, 0x80, 0x60, 0xD0,
+0xF3, 0x24, 0xF4, 0xD0, 0x20, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0x28, 0xF0,
+0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x25, 0xF1, 0x60, 0xF3, 0x20, 0xF1, 0xD0, 0xB1,
+0xF5, 0x21, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0x25, 0xF0, 0xD0, 0xF3, 0x60, 0xF1,
+0x21, 0xF7, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0xD0, 0xA0, 0x50, 0x00, 0x40, 0x08, 0xC0, 0x51, 0x40,
+0x90, 0x04, 0x40, 0x0F, 0x00, 0x90, 0x00, 0x80, 0xB0, 0xD0, 0xF2, 0x20, 0xF1, 0x21, 0xF2, 0xB1,
+0xF2, 0x21, 0xF1, 0x24, 0xF1, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF1, 0xD0, 0x60,
+0xF4, 0xB0, 0x60, 0xB2, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xB0, 0x70, 0x03, 0x80,
+0x70, 0xD0, 0x60, 0xF0, 0xD0, 0x60, 0xA0, 0x30, 0xA1, 0x10, 0x30, 0x80, 0x30, 0x10, 0x80, 0x0D,
+0x30, 0x11, 0x30, 0xB0, 0xD6, 0xF1, 0xD0, 0xF0, 0xD0, 0x61, 0xD0, 0x80, 0xE0, 0x30, 0xD1, 0xF0,
+0xD0, 0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF3, 0x60, 0xB0, 0xF4, 0x25, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x22, 0xF0, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0x60, 0x30, 0xD0, 0xF0, 0x22, 0xD0,
+0xA0, 0xB0, 0xF3, 0xD0, 0x60, 0x30, 0x80, 0xA0, 0x50, 0xA0, 0x0F, 0x0F, 0x0F, 0x10, 0xC0, 0x70,
+0xC0, 0x01, 0x70, 0xF0, 0xD0, 0xF3, 0x23, 0xF3, 0xD0, 0xB0, 0x60, 0xB0, 0xF3, 0x25, 0xF4, 0x20,
+0xF0, 0x21, 0xF0, 0x21, 0xF3, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0x25, 0xF0, 0xD0, 0xB0, 0x60, 0xD0,
+0x22, 0xF1, 0x60, 0xB0, 0xF5, 0x22, 0xF5, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x23, 0xF4, 0xD0, 0x60,
+0xB0, 0xF0, 0x20, 0xF4, 0x20, 0xF1, 0xD0, 0x60, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x60,
+0x40, 0x00, 0x90, 0x08, 0x40, 0x02, 0xC0, 0x91, 0xC0, 0x00, 0xC0, 0x50, 0x0F, 0x00, 0x90, 0xC0,
+0xE0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0xD0, 0xB1, 0xF6, 0x20, 0xF0, 0x20, 0xF3, 0xD0,
+0x60, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF3, 0xD0, 0xB1, 0xD0, 0xB0, 0x61, 0xB0, 0xF0, 0xD0,
+0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0xB0, 0xF0, 0xA0, 0xC0, 0x00, 0xC0, 0x40, 0x30,
+0xA0, 0xD2, 0x60, 0xF0, 0xD1, 0xB0, 0xF0, 0xB4, 0xD0, 0x31, 0x80, 0x90, 0x50, 0xC1, 0x40, 0x70,
+0x90, 0x05, 0x80, 0x00, 0x30, 0x70, 0xE0, 0xA1, 0x80, 0x31, 0xF3, 0xD0, 0xF0, 0xD0, 0xB0, 0x60,
+0xD2, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x23, 0xF0, 0xD1, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0,
+0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0x60,
+0xB0, 0xD1, 0xF0, 0x22, 0xF0, 0xD0, 0xE0, 0x60, 0xD0, 0xF2, 0xD0, 0x70, 0x02, 0x70, 0x90, 0x0F,
+0x0F, 0x0F, 0x11, 0x30, 0xC0, 0x01, 0x80, 0x30, 0xD1, 0xF1, 0x23, 0xF1, 0xD0, 0xF1, 0x60, 0xB0,
+0xF0, 0xD0, 0xF3, 0x25, 0xF4, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF1,
+0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF1, 0xD0, 0xB1, 0xF3, 0x60, 0xB0, 0x20, 0xF5, 0x20, 0xF0, 0x20,
+0xF1, 0x20, 0xF2, 0x60, 0xB0, 0xF2, 0x22, 0xF0, 0x20, 0xF3, 0xD0, 0xB1, 0xF1, 0x22, 0xF5, 0xB1,
+0xD0, 0xF5, 0xD0, 0x60, 0x40, 0x90, 0x08, 0xC0, 0x50, 0x05, 0x50, 0x41, 0xC0, 0x0F, 0x00, 0x91,
+0xA0, 0xD0, 0xF2, 0x25, 0xF1, 0xD0, 0xB1, 0xF1, 0x24, 0xF1, 0x21, 0xF2, 0xD0, 0x60, 0xF1, 0x20,
+0xF2, 0x20, 0xF4, 0x20, 0xF3, 0x62, 0xB0, 0xD1, 0xF2, 0xB1, 0xF0, 0x21, 0xF0, 0x22, 0xD1, 0xB0,
+0xA0, 0x90, 0xC0, 0x70, 0x80, 0x60, 0xD1, 0x60, 0x30, 0xB1, 0xF1, 0xD4, 0x20, 0xD0, 0xF0, 0xD0,
+0xB0, 0x81, 0x30, 0xA1, 0x80, 0x90, 0x70, 0xC0, 0x04, 0xC0, 0x90, 0x01, 0x90, 0x00, 0xC0, 0x90,
+0xC0, 0x70, 0x60, 0xD0, 0xF2, 0xD0, 0xF0, 0xD0, 0xB0, 0x60, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xF2,
+0x20, 0xF0, 0xD2, 0xB0, 0x60, 0xB1, 0xF0, 0xD0, 0x61, 0xB0, 0xD1, 0xF0, 0x20, 0xF0, 0x20, 0xF2,
+0x22, 0xF0, 0x21, 0xF4, 0xD1, 0xF0, 0xD1, 0xB1, 0x60, 0xB0, 0xF1, 0x20, 0xF0, 0xD0, 0xF0, 0x60,
+0xB0, 0xD0, 0xF1, 0xD0, 0x60, 0x30, 0x02, 0xA0, 0x00, 0x80, 0x50, 0x0F, 0x0D, 0x0F, 0x11, 0xC0,
+0x30, 0x00, 0xA0, 0x80, 0x70, 0xF3, 0x21, 0xF3, 0xD0, 0x61, 0xF4, 0x22, 0xF4, 0x20, 0xF4, 0x21,
+0xF0, 0x21, 0xF1, 0xD0, 0x61, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0x60,
+0xB0, 0xF1, 0x60, 0xF4, 0x20, 0xF2, 0x23, 0xF0, 0x20, 0xF1, 0xB1, 0xD0, 0xF1, 0x21, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xF3, 0x24, 0xF2, 0x60, 0xF3, 0xD1, 0xF1, 0xD0, 0x60,
+0x80, 0x50, 0x08, 0x90, 0x08, 0x40, 0x90, 0x40, 0x50, 0x0D, 0x90, 0xC0, 0x30, 0xD0, 0xF0, 0x28,
+0xF1, 0xB1, 0xF1, 0x23, 0xF0, 0x23, 0xF3, 0xB0, 0xF3, 0x20, 0xF0, 0x23, 0xF0, 0xD1, 0xF0, 0xB0,
+0x62, 0xF0, 0xD1, 0xF5, 0x60, 0xF4, 0x20, 0xF1, 0x80, 0x70, 0xA0, 0x80, 0x70, 0xB0, 0xD2, 0x60,
+0x80, 0x60, 0xA0, 0x60, 0xB0, 0xD0, 0xF0, 0xB0, 0xE0, 0xD0, 0xF1, 0x21, 0xF1, 0xB1, 0xD4, 0x60,
+0x30, 0x05, 0xC0, 0x40, 0x04, 0x50, 0x11, 0xE0, 0x31, 0x70, 0x60, 0xD2, 0xF0, 0x60, 0xF0, 0xD0,
+0xF0, 0x60, 0xD1, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0x70, 0xA1, 0x40, 0x31, 0xA0, 0x70, 0xA0, 0x80,
+0xB2, 0xF0, 0xD0, 0x20, 0xF4, 0x21, 0xF1, 0x20, 0xF0, 0xD3, 0xF1, 0xD0, 0x61, 0x70, 0x60, 0xD0,
+0x61, 0xF0, 0xD0, 0x20, 0xF5, 0xD1, 0x70, 0x80, 0xA0, 0xC0, 0x80, 0x50, 0x80, 0x50, 0x30, 0x0F,
+0x0D, 0x0F, 0x12, 0x30, 0x70, 0x01, 0x50, 0x30, 0xD0, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0xB0, 0x60,
+0xF0, 0xD0, 0xF1, 0x20, 0xF0, 0x23, 0xF6, 0x25, 0xF0, 0x20, 0xF2, 0x60, 0xB0, 0xD0, 0xF1, 0x21,
+0xF0, 0x21, 0xF4, 0x22, 0xF2, 0x60, 0xB0, 0x60, 0xD1, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0x20, 0xF2,
+0x60, 0xB0, 0xF2, 0x21, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0x60, 0xF1, 0x20, 0xF1, 0x23, 0xF0, 0x20,
+0xF0, 0x60, 0xF1, 0x21, 0xD0, 0x70, 0x60, 0xD1, 0xF0, 0xD0, 0x80, 0x00, 0x41, 0x05, 0xC0, 0x90,
+0x07, 0x51, 0x01, 0xC0, 0x41, 0x90, 0xC0, 0x08, 0xC0, 0x90, 0x00, 0xA0, 0xD0, 0xF2, 0x26, 0xF1,
+0xB1, 0xF1, 0x24, 0xF1, 0x22, 0xF1, 0xD0, 0xB1, 0xF5, 0x20, 0xF1, 0xB0, 0x62, 0xB0, 0xF0, 0xD0,
+0xB1, 0xD0, 0xF0, 0x20, 0xF3, 0xD0, 0xB1, 0xF3, 0x20, 0xF1, 0xE0, 0x30, 0x80, 0x30, 0xD0, 0xF0,
+0x21, 0xD0, 0x30, 0xE0, 0x00, 0xE0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xF1, 0x23, 0xF0, 0xD0,
+0x60, 0xB0, 0x61, 0xD2, 0x70, 0x40, 0x06, 0x40, 0x0A, 0x80, 0xA1, 0x60, 0xD1, 0x60, 0xB1, 0xA0,
+0x10, 0x30, 0xF0, 0xD1, 0x60, 0x70, 0x08, 0x70, 0xA0, 0xE0, 0xA0, 0x80, 0xD3, 0xF0, 0x20, 0xF3,
+0xD1, 0xF0, 0x60, 0xA1, 0x70, 0x30, 0x70, 0x80, 0xA0, 0x60, 0xD3, 0xF0, 0x61, 0xF0, 0x20, 0xF3,
+0xB0, 0xD0, 0x80, 0x40, 0x01, 0x30, 0x70, 0x00, 0x40, 0x30, 0x40, 0x0F, 0x0D, 0x0F, 0x10, 0x50,
+0xC0, 0x00, 0x30, 0x02, 0x70, 0xB0, 0xD0, 0xF0, 0x20, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0xF2,
+0x20, 0xF0, 0x24, 0xF5, 0x26, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xF4, 0x23, 0xF5, 0x23, 0xF0, 0xD0,
+0xB0, 0x80, 0xD1, 0x20, 0xF0, 0x26, 0xF0, 0x20, 0xF2, 0xD0, 0x60, 0xB0, 0xF1, 0x22, 0xF0, 0x20,
+0xF1, 0x22, 0xF1, 0x60, 0xF0, 0xD0, 0xF3, 0x23, 0xF1, 0xB1, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0xE0,
+0xF0, 0xD0, 0xF0, 0xB0, 0x30, 0x80, 0x00, 0xC0, 0x05, 0x40, 0x08, 0x90, 0x05, 0xC0, 0x50, 0x41,
+0x50, 0xC0, 0x04, 0x50, 0xC0, 0x00, 0x70, 0xB0, 0xD0, 0xF1, 0x25, 0xF2, 0xB1, 0xF1, 0x24, 0xF0,
+0x22, 0xF4, 0xB0, 0xD0, 0x20, 0xD1, 0xF0, 0xB1, 0x61, 0xB0, 0x20, 0xF1, 0xD0, 0xF2, 0x60, 0xD0,
+0xF3, 0xD1, 0x21, 0x60, 0xF7, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xD0, 0x30, 0xE0, 0x70, 0x60,
+0xD0, 0xF0, 0x60, 0xF0, 0xD0, 0xF2, 0x22, 0xF2, 0xD0, 0x61, 0x30, 0xA0, 0xB0, 0xF1, 0x31, 0x90,
+0x40, 0x60, 0xA0, 0x30, 0x00, 0xC0, 0x40, 0x0A, 0xD0, 0x30, 0x60, 0xD2, 0x60, 0xA1, 0x90, 0x40,
+0xA0, 0x70, 0xA1, 0x70, 0x09, 0x90, 0xE0, 0x70, 0x80, 0xA0, 0x70, 0xA0, 0xB0, 0xD0, 0xF1, 0x20,
+0xF0, 0xD0, 0x60, 0xA1, 0x40, 0xC0, 0x02, 0x30, 0xA0, 0xE0, 0xB0, 0xD0, 0xF0, 0xB1, 0xF0, 0xD0,
+0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0xD0, 0xB0, 0xE0, 0x71, 0x02, 0x80, 0x50, 0x0F, 0x11, 0x0F, 0x10,
+0x70, 0xE0, 0x50, 0x80, 0x90, 0xC0, 0x30, 0x80, 0xA0, 0xD2, 0xF0, 0x60, 0xB0, 0xF1, 0x21, 0xF3,
+0x24, 0xF5, 0x24, 0xF3, 0x60, 0xB0, 0xF3, 0x24, 0xF0, 0x21, 0xF2, 0x23, 0xF1, 0xB1, 0xF0, 0x60,
+0xD0, 0xF1, 0x26, 0xF0, 0x20, 0xF2, 0x60, 0xB0, 0xD0, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF1,
+0x60, 0xF0, 0xD0, 0x20, 0xF4, 0x21, 0xF1, 0xB0, 0x60, 0xD0, 0x21, 0xF2, 0xD0, 0x60, 0xA0, 0xD0,
+0xF0, 0x60, 0xD0, 0xA0, 0x90, 0x06, 0x40, 0x08, 0x90, 0x07, 0x50, 0xC1, 0x91, 0x40, 0x90, 0xC0,
+0x00, 0x40, 0x01, 0xE0, 0xA0, 0xD0, 0xFA, 0xB1, 0xF6, 0xD0, 0xF1, 0x20, 0xF4, 0x60, 0xF1, 0xB0,
+0x61, 0xB2, 0x60, 0xD0, 0xF4, 0xD1, 0xB2, 0xD2, 0x80, 0x60, 0xD0, 0xF0, 0xB1, 0xD0, 0xF0, 0x20,
+0xF0, 0x23, 0xF0, 0x60, 0xB0, 0xF3, 0xD0, 0xF1, 0xD0, 0xF0, 0xD0, 0x60, 0xB0, 0xF3, 0x21, 0xF0,
+0x20, 0xF2, 0x20, 0x60, 0xD0, 0xB0, 0x30, 0xD0, 0x30, 0xB0, 0x60, 0x30, 0x61, 0x90, 0x81, 0x00,
+0xC0, 0x40, 0x06, 0xC0, 0x40, 0xA1, 0x60, 0xD0, 0xF0, 0xD0, 0x60, 0x70, 0x91, 0x05, 0xA0, 0x0A,
+0xC3, 0x90, 0x50, 0xA0, 0x30, 0xD0, 0x20, 0xF1, 0xD0, 0xE0, 0x05, 0x90, 0xA0, 0xD3, 0x60, 0xE0,
+0x60, 0xD0, 0xF2, 0xB0, 0x60, 0xF0, 0xD2, 0x70, 0x30, 0xA0, 0x50, 0xC0, 0x30, 0xC0, 0x70, 0xE0,
+0x80, 0x0F, 0x0E, 0x0F, 0x11, 0xC0, 0xA0, 0x00, 0xE0, 0x30, 0xC0, 0x00, 0x30, 0xB0, 0xD0, 0x61,
+0xF0, 0xD0, 0xF1, 0x21, 0xF0, 0x22, 0xF0, 0x24, 0xF4, 0x23, 0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0,
+0xF0, 0x27, 0xF0, 0x25, 0xF3, 0x60, 0xB0, 0xF1, 0xB0, 0x60, 0xD0, 0xF1, 0x26, 0xF0, 0xD1, 0x60,
+0xB0, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xB0, 0xF1, 0x20, 0xF4, 0x22,
+0xD0, 0x60, 0xF6, 0x20, 0xD0, 0x60, 0xF0, 0x60, 0xF0, 0xD0, 0x30, 0x90, 0x05, 0x90, 0xC0, 0x07,
+0x50, 0xC0, 0x07, 0x40, 0x04, 0xC0, 0x50, 0x90, 0x41, 0x90, 0x80, 0x10, 0xB0, 0xD8, 0xF0, 0xD0,
+0xB1, 0xD0, 0xF0, 0xD2, 0xF2, 0xD2, 0xF0, 0xB1, 0x62, 0xB2, 0xF0, 0xD0, 0xF0, 0xD1, 0x60, 0xF1,
+0xD3, 0x60, 0x70, 0xA0, 0x31, 0x71, 0x11, 0xA0, 0x30, 0xD0, 0x20, 0x60, 0xF3, 0x23, 0xF1, 0x60,
+0xF0, 0x20, 0xF5, 0x20, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF1, 0x21, 0xF2, 0x21, 0xF1, 0x60, 0xD1,
+0xF0, 0x20, 0x30, 0xD1, 0xF0, 0xD1, 0xA0, 0x40, 0x01, 0xC0, 0x90, 0x04, 0xA0, 0x10, 0x30, 0xD4,
+0xB1, 0xA1, 0x31, 0x80, 0x03, 0x81, 0x0E, 0x90, 0xC0, 0xA0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x80,
+0x60, 0x00, 0x50, 0x80, 0xA1, 0x30, 0xF1, 0xD0, 0xF2, 0xD1, 0x22, 0xF1, 0xD0, 0x61, 0xD1, 0xA0,
+0x01, 0x80, 0xE0, 0xC0, 0x70, 0xC1, 0x30, 0x10, 0x50, 0x0F, 0x0C, 0x0F, 0x0B, 0xC0, 0x10, 0xE0,
+0xA0, 0x90, 0x00, 0x50, 0xE0, 0x00, 0x40, 0x90, 0x01, 0x40, 0xE0, 0x60, 0xB0, 0xD0, 0xF2, 0x20,
+0xF1, 0x20, 0xF2, 0x26, 0xF1, 0x23, 0xF3, 0x60, 0xB0, 0xD0, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0x20,
+0xF0, 0x23, 0xF3, 0x60, 0xF1, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF4, 0x22, 0xF1, 0x60, 0xB0, 0xD0,
+0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF2,
+0x20, 0xF0, 0x20, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xD0, 0xF0, 0x60, 0xD1, 0x70, 0xC0,
+0x04, 0xC0, 0x90, 0x08, 0x40, 0x07, 0xC0, 0x50, 0x07, 0x90, 0x01, 0x50, 0xA0, 0x70, 0x63, 0xB6,
+0x61, 0xB6, 0x64, 0xB1, 0xF0, 0xD0, 0xB0, 0xF0, 0xD0, 0xF5, 0xB1, 0xD0, 0x61, 0xA1, 0x80, 0x01,
+0x90, 0x05, 0xA0, 0xD1, 0x60, 0xB0, 0xF4, 0x20, 0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xF0, 0x20, 0x60, 0xF1, 0x20, 0xF3, 0x23, 0xD0, 0xB0, 0x60, 0xD0, 0xF5, 0xD0, 0x70,
+0x90, 0x01, 0xC0, 0x40, 0x30, 0xA0, 0x70, 0xA0, 0x71, 0x80, 0xD1, 0xF1, 0x20, 0xD0, 0xB1, 0xD3,
+0xB0, 0x30, 0x03, 0x50, 0x30, 0x0B, 0x90, 0x40, 0x80, 0x00, 0x30, 0x60, 0xF0, 0xD0, 0x60, 0xF0,
+0xD1, 0xE0, 0xA1, 0x60, 0xD2, 0xF6, 0x22, 0xF3, 0xD0, 0xF0, 0x60, 0x70, 0x80, 0x01, 0x50, 0x80,
+0x00, 0xE0, 0xC0, 0x02, 0x10, 0xC0, 0x0F, 0x0B, 0x0F, 0x0C, 0x30, 0x40, 0x90, 0xA0, 0xE1, 0x50,
+0x01, 0xA0, 0x50, 0x70, 0x11, 0x60, 0xD0, 0xF0, 0x20, 0xF7, 0x28, 0xF0, 0x21, 0xF2, 0xD0, 0xB0,
+0x60, 0x20, 0xF2, 0x21, 0xF1, 0x21, 0xF3, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0,
+0xF0, 0x21, 0xF1, 0xB1, 0xD0, 0xF4, 0x20, 0xF1, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF3,
+0x21, 0xF1, 0xB1, 0xF0, 0x25, 0xF3, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x21, 0xF4, 0x20, 0xF0, 0x60,
+0xF0, 0xD0, 0xA0, 0x90, 0x05, 0x52, 0x07, 0x90, 0x07, 0x50, 0xC0, 0x06, 0xC0, 0x90, 0x02, 0x30,
+0x10, 0xD0, 0xF0, 0xD0, 0x60, 0xF0, 0x23, 0xB2, 0x60, 0xB1, 0x23, 0xF0, 0xB1, 0xF0, 0x20, 0xF4,
+0xB1, 0xF4, 0xD1, 0x60, 0x30, 0xA0, 0x80, 0x40, 0xC0, 0x03, 0x50, 0xC0, 0x04, 0xA0, 0xD0, 0xF0,
+0x20, 0x60, 0xD0, 0x25, 0xF0, 0xD0, 0xF0, 0x60, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0x20, 0xF1, 0xB1,
+0xF1, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0xB1, 0xD0, 0xF3, 0xD0, 0x30, 0xB0, 0xD0, 0x80, 0xA1, 0x60,
+0xB0, 0xF0, 0x60, 0xD3, 0xF4, 0xB0, 0x60, 0xD0, 0xF1, 0xD2, 0x70, 0x90, 0xC0, 0x01, 0xA0, 0x40,
+0x08, 0x80, 0xA0, 0x70, 0x30, 0x61, 0xE1, 0xD0, 0x60, 0xB0, 0x30, 0xD0, 0xF0, 0xD0, 0xF0, 0xB0,
+0xD1, 0xF0, 0x23, 0xF1, 0x24, 0xF1, 0x23, 0xD0, 0xB0, 0x11, 0xE0, 0x50, 0xA0, 0x01, 0x90, 0x10,
+0x50, 0x01, 0x40, 0x80, 0x0F, 0x0B, 0x0F, 0x0C, 0xC0, 0xE0, 0x06, 0x90, 0x11, 0x80, 0x00, 0xA0,
+0xD0, 0xF2, 0x21, 0xF4, 0x26, 0xF0, 0x22, 0xF2, 0xD0, 0x61, 0xF2, 0x23, 0xF0, 0x20, 0xF3, 0x25,
+0xF2, 0xB0, 0x60, 0xF1, 0xD0, 0x23, 0xF1, 0x60, 0xB0, 0xD1, 0xF4, 0x60, 0xB0, 0xF3, 0x21, 0xF0,
+0x20, 0xF2, 0x21, 0xD0, 0xF0, 0x60, 0xF2, 0x23, 0xF0, 0x21, 0xF2, 0x60, 0xF2, 0x21, 0xF3, 0x20,
+0xD0, 0xB1, 0xD1, 0x70, 0x40, 0x05, 0x90, 0x50, 0x80, 0x06, 0x90, 0xC0, 0x07, 0x90, 0x07, 0xC0,
+0x50, 0x03, 0x70, 0xD1, 0xB1, 0xD0, 0xF5, 0xB1, 0xF5, 0xD0, 0xB1, 0xF0, 0x22, 0xF0, 0x20, 0xF0,
+0xB1, 0xF0, 0x22, 0xD0, 0xF0, 0xA0, 0x80, 0x40, 0x08, 0x90, 0x04, 0xA0, 0xD0, 0xF1, 0x60, 0xF0,
+0xD0, 0x23, 0xF2, 0xD0, 0xB1, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0x21, 0xF2, 0x24,
+0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0x20, 0xF1, 0xD0, 0x70, 0xA0, 0x30, 0x60, 0xB0, 0xD1, 0xF2, 0x60,
+0xF1, 0xD0, 0xF3, 0xB0, 0x60, 0xD0, 0xF1, 0x21, 0x60, 0xD0, 0xA0, 0x80, 0x90, 0x50, 0x01, 0x30,
+0x04, 0x50, 0x01, 0xA0, 0x60, 0xF1, 0xD2, 0x61, 0xD0, 0xF0, 0xB1, 0xD0, 0xF0, 0x20, 0xF0, 0xD0,
+0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0x22, 0xD1, 0x70, 0x00, 0x40, 0x11, 0x40,
+0x00, 0x80, 0xC0, 0x50, 0xE0, 0xA0, 0x40, 0x70, 0x50, 0x0F, 0x0B, 0x0F, 0x0D, 0x80, 0x40, 0x00,
+0x80, 0x41, 0x50, 0x01, 0xA0, 0x50, 0x01, 0x50, 0x30, 0xD0, 0x24, 0xF6, 0x20, 0xF0, 0x23, 0xF1,
+0x20, 0xF1, 0x60, 0xB0, 0xD0, 0xF1, 0x24, 0xF5, 0x22, 0xF0, 0x20, 0xF1, 0xD0, 0x61, 0xD0, 0xF2,
+0x23, 0xF1, 0xD0, 0x60, 0xB0, 0xD1, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0x24, 0xF5, 0x20, 0xD0,
+0xF0, 0x60, 0xD0, 0xF0, 0x24, 0xF0, 0x22, 0xF0, 0xD0, 0xB1, 0xD0, 0x20, 0xF0, 0x20, 0xF2, 0x20,
+0xF2, 0x60, 0xD1, 0x80, 0xA1, 0x04, 0x50, 0xC0, 0x08, 0x40, 0x08, 0x40, 0x07, 0x50, 0xC0, 0x03,
+0xA0, 0xB0, 0xF0, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF2, 0xB1, 0xF0,
+0x21, 0xF4, 0xB0, 0xD0, 0xF2, 0xD0, 0xE0, 0x50, 0x00, 0x40, 0x08, 0x90, 0x03, 0x40, 0x80, 0xD0,
+0x20, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF5, 0xD0, 0x60, 0xF2, 0x21, 0xF0, 0x23, 0xF0, 0x20,
+0x60, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF2, 0xD0, 0x60, 0xF1, 0x21, 0xF1, 0xD2, 0xF2, 0x21, 0xF1,
+0x60, 0xF5, 0x60, 0xF2, 0x20, 0xD0, 0x60, 0xE1, 0x70, 0x40, 0x70, 0x30, 0x80, 0x10, 0xE0, 0x30,
+0x02, 0xA0, 0xE0, 0x30, 0xA0, 0x30, 0xD1, 0xF0, 0x20, 0xF1, 0xD1, 0xF1, 0xD0, 0xF0, 0x60, 0x20,
+0xF1, 0xD0, 0xF2, 0xD0, 0xF1, 0xD0, 0xF2, 0x22, 0xF5, 0xD0, 0x80, 0x40, 0x01, 0xC0, 0xE0, 0x00,
+0xE0, 0x80, 0x10, 0xC0, 0x00, 0x90, 0x80, 0x50, 0x0F, 0x0C, 0x0F, 0x0F, 0xC0, 0x10, 0x90, 0x40,
+0x30, 0x10, 0x30, 0xC0, 0x30, 0x00, 0x90, 0x30, 0x70, 0xB0, 0xD0, 0x24, 0xF6, 0x20, 0xF0, 0x23,
+0xF1, 0xB0, 0x60, 0xF3, 0x24, 0xF6, 0x22, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF1, 0x23,
+0xF0, 0xD0, 0x60, 0xB0, 0xF0, 0xD1, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0x20, 0xF1,
+0x20, 0x60, 0xF2, 0x22, 0xF1, 0x23, 0xF0, 0xB1, 0xD0, 0x22, 0xF1, 0x22, 0xF0, 0xD0, 0xB1, 0xD0,
+0xB0, 0xA0, 0x06, 0x40, 0x08, 0xC0, 0x50, 0x07, 0xC0, 0x50, 0x07, 0x90, 0x04, 0xC0, 0xA0, 0xD0,
+0xB1, 0xD0, 0xF0, 0x22, 0xF0, 0xD0, 0xB1, 0xF1, 0x22, 0xF1, 0xB1, 0xF0, 0x21, 0xF4, 0x60, 0xD0,
+0xF1, 0xD1, 0xE0, 0x01, 0x51, 0x07, 0x51, 0x01, 0x40, 0x71, 0x60, 0x21, 0xF0, 0x60, 0xFA, 0x60,
+0xD0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0xD0, 0x60, 0xF1, 0xD0, 0xF0, 0xD0, 0x60, 0x21, 0xF4, 0x26, 0xD0, 0xF0, 0x60, 0xF0, 0xD1, 0xF0,
+0x60, 0xF0, 0xD6, 0x40, 0x90, 0x30, 0xA0, 0x50, 0x00, 0x30, 0x70, 0x40, 0x01, 0x10, 0xB0, 0xD0,
+0x60, 0xD1, 0xF2, 0x21, 0xF7, 0x60, 0xB0, 0xF0, 0xD0, 0xF3, 0xD0, 0xF0, 0xD0, 0xF2, 0x22, 0xF2,
+0x20, 0xF0, 0xD0, 0xF0, 0x70, 0xA0, 0x40, 0x00, 0x80, 0x50, 0x80, 0x90, 0x00, 0x50, 0xA0, 0x0F,
+0x10, 0x0F, 0x10, 0x82, 0x70, 0x90, 0x01, 0x80, 0xA0, 0x80, 0x01, 0x70, 0xD1, 0x23, 0xF7, 0x20,
+0xF0, 0x20, 0xF1, 0x20, 0x60, 0xB0, 0xF2, 0x26, 0xF5, 0x23, 0xF2, 0x60, 0xB0, 0xF2, 0x22, 0xF1,
+0x23, 0xF2, 0x60, 0xB0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF3, 0x60,
+0xB0, 0xF2, 0x21, 0xF3, 0x20, 0xF0, 0x21, 0x60, 0xF2, 0x21, 0xF0, 0x23, 0xF1, 0x60, 0xF0, 0xD1,
+0xA0, 0x05, 0x51, 0x02, 0xC0, 0x91, 0xC0, 0x01, 0x90, 0xC0, 0x07, 0x50, 0xC0, 0x07, 0x40, 0x05,
+0x70, 0xB2, 0xF3, 0x20, 0xF0, 0xD0, 0xB1, 0xF1, 0x20, 0xF4, 0x60, 0xF0, 0x22, 0xF2, 0xD0, 0x60,
+0xF4, 0x30, 0x02, 0x40, 0x08, 0x40, 0x00, 0xC0, 0xA0, 0x30, 0xE0, 0xD0, 0x21, 0xF0, 0xB1, 0xD0,
+0xF2, 0x20, 0xF3, 0xD0, 0x60, 0xB0, 0xF2, 0x20, 0xF0, 0x21, 0xF2, 0xD0, 0x60, 0xF0, 0xD0, 0x20,
+0xF1, 0x60, 0xA0, 0x30, 0xD0, 0xF1, 0xD0, 0xF0, 0x20, 0x60, 0xD0, 0xF3, 0x20, 0xF0, 0x20, 0xF6,
+0xB0, 0x60, 0xD0, 0xF0, 0x60, 0xF0, 0xD0, 0x60, 0x30, 0x80, 0x30, 0x10, 0x32, 0xA0, 0x80, 0x00,
+0x50, 0x90, 0x40, 0xA0, 0x02, 0x70, 0xD3, 0xF3, 0x21, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xB0, 0x60,
+0xB0, 0xF0, 0xD0, 0xF1, 0x20, 0xF4, 0x24, 0xF2, 0xD0, 0xA0, 0x50, 0x00, 0x40, 0xA0, 0x30, 0x00,
+0x40, 0xA0, 0x01, 0xE0, 0x00, 0x81, 0x0F, 0x0D, 0x0F, 0x10, 0x40, 0x10, 0x30, 0x04, 0x70, 0x02,
+0x81, 0xD1, 0x22, 0xF9, 0x20, 0xD0, 0xB0, 0x60, 0xF2, 0x22, 0xF0, 0x21, 0xF1, 0x27, 0xF4, 0x60,
+0x20, 0xF3, 0x22, 0xF1, 0x23, 0xF1, 0xD0, 0xF0, 0x61, 0xB0, 0xD0, 0xF2, 0x23, 0xF0, 0x20, 0xF0,
+0x20, 0xF2, 0xB1, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x60, 0xF3, 0x25, 0xF1, 0x60, 0xF0,
+0xD0, 0xF0, 0xD0, 0xA0, 0xC0, 0x04, 0x40, 0x03, 0xA0, 0x10, 0xE0, 0x10, 0x01, 0x40, 0x08, 0x40,
+0x08, 0x90, 0x05, 0x50, 0x70, 0x60, 0xD0, 0xF0, 0x24, 0xF0, 0xB1, 0xF1, 0x22, 0xF2, 0x60, 0xF0,
+0x23, 0xF0, 0x20, 0xD0, 0xB0, 0xF3, 0xB0, 0x30, 0x02, 0x40, 0x08, 0x90, 0x00, 0x30, 0x40, 0x61,
+0xD0, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0x60, 0xF2,
+0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x20, 0xF1, 0x60, 0xF5, 0xD0, 0xF2, 0x21, 0xF0, 0xB0, 0x60, 0xD1,
+0xF0, 0x22, 0xF0, 0x20, 0xD0, 0xF2, 0x20, 0xF0, 0xD0, 0xB0, 0x61, 0xF0, 0xD0, 0x60, 0x30, 0xC0,
+0x91, 0x53, 0x00, 0x90, 0xA0, 0x30, 0x80, 0x60, 0x70, 0x30, 0x00, 0x40, 0x80, 0xD0, 0xF1, 0x20,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x60, 0xB0, 0xF3, 0x21, 0xF2,
+0x24, 0xF1, 0xD0, 0x60, 0x30, 0x02, 0xA0, 0xC0, 0x01, 0x90, 0x01, 0xE0, 0x50, 0x70, 0x0F, 0x0E,
+0x0F, 0x0F, 0xC0, 0xA0, 0x80, 0x50, 0x00, 0xA0, 0x10, 0xE0, 0x50, 0x90, 0x80, 0x00, 0x90, 0xA0,
+0x70, 0xD0, 0xF4, 0x26, 0xF1, 0xD0, 0x60, 0xB0, 0xF3, 0x20, 0xF0, 0x22, 0xF3, 0x26, 0xF0, 0xD0,
+0xF0, 0xB0, 0x60, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0x24, 0xF1, 0xD1, 0xB0, 0x60, 0xF2, 0x20, 0xF2,
+0x24, 0xF2, 0xB1, 0xD0, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xB1, 0xF2, 0x20,
+0xF0, 0x23, 0xF1, 0xB0, 0x60, 0xD0, 0xF1, 0xD0, 0xB0, 0xA0, 0x03, 0xC0, 0x90, 0x05, 0x50, 0x40,
+0x00, 0x51, 0x08, 0x40, 0x07, 0xC0, 0x50, 0x06, 0x90, 0xA0, 0xD1, 0xF0, 0x20, 0xF3, 0xB1, 0xF6,
+0xD0, 0x60, 0xF0, 0x22, 0xF1, 0x20, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x30, 0x02, 0x90, 0xC0, 0x07,
+0xC0, 0x50, 0xA0, 0xD0, 0xF0, 0xD1, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xF0, 0x23, 0xF0, 0x22, 0xD0,
+0xB1, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0xD0, 0xB0, 0x60, 0xD0, 0xF1, 0x20, 0xF2, 0x20, 0xF0, 0x22,
+0xF0, 0xB1, 0xD0, 0xF1, 0x20, 0xF7, 0x20, 0xF1, 0x61, 0xD1, 0x60, 0x30, 0x60, 0x01, 0x30, 0xA3,
+0x30, 0xF0, 0xD3, 0xA0, 0x30, 0xA0, 0xD0, 0xF0, 0x22, 0xF1, 0x26, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0xD0, 0xB0, 0x60, 0xD0, 0x21, 0xF1, 0x20, 0xF1, 0x23, 0xF2, 0xD0, 0x70, 0xA0, 0x40, 0x00, 0x41,
+0x90, 0xE0, 0xC0, 0x02, 0x30, 0x10, 0x90, 0x0F, 0x0E, 0x0F, 0x12, 0x40, 0x10, 0x40, 0x01, 0x70,
+0x00, 0x30, 0xA0, 0x80, 0x00, 0x50, 0xA0, 0xD0, 0xF3, 0x25, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0,
+0xF0, 0x22, 0xF0, 0x22, 0xF4, 0x25, 0xF2, 0xB0, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x23,
+0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0x60, 0xB0, 0xF0, 0x20, 0xF3, 0x24, 0xF0, 0xB0, 0x60, 0xD0, 0xF1,
+0x20, 0xF8, 0xB0, 0x60, 0xD0, 0x20, 0xF3, 0x22, 0xF1, 0xD0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0xD0,
+0x30, 0x40, 0x02, 0x40, 0x09, 0x90, 0x07, 0x31, 0x50, 0x07, 0x51, 0x07, 0x40, 0x30, 0xD0, 0xF5,
+0xB1, 0xF1, 0x21, 0xF2, 0xD0, 0x60, 0xF0, 0x20, 0xF6, 0xB0, 0xF0, 0x20, 0xF0, 0xD0, 0xA0, 0x02,
+0x51, 0x08, 0x90, 0x10, 0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x60, 0xF3, 0x20, 0xF0, 0x21,
+0xF1, 0xD0, 0x60, 0xD0, 0xF2, 0x20, 0xF1, 0x21, 0xD0, 0xE0, 0x70, 0x60, 0xB0, 0xF1, 0x21, 0xF0,
+0x21, 0xF0, 0x22, 0xF1, 0xB1, 0xD6, 0xF4, 0x20, 0x60, 0xD0, 0xF0, 0x60, 0xD1, 0x61, 0xA0, 0xE0,
+0x70, 0xB0, 0xD3, 0xF2, 0x20, 0xF0, 0xD0, 0x30, 0x80, 0x60, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x23,
+0xF2, 0x23, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xF4, 0x24, 0xF1, 0xD0, 0x30, 0x40, 0x00, 0x40, 0xA1,
+0x00, 0xC0, 0xE1, 0xA0, 0x01, 0xC0, 0x30, 0x0F, 0x0F, 0x0F, 0x11, 0x90, 0x70, 0xC0, 0x01, 0xC0,
+0xE0, 0x00, 0xC0, 0xA0, 0x02, 0x30, 0x60, 0xD0, 0x20, 0xF0, 0x24, 0xF0, 0xD0, 0xF0, 0xB0, 0x60,
+0xF0, 0xD0, 0xF4, 0x23, 0xF0, 0x20, 0xF3, 0x22, 0xF3, 0x60, 0xB0, 0xD0, 0xF2, 0x2A, 0xF1, 0xD0,
+0xF0, 0x60, 0xB0, 0xD1, 0xF0, 0x60, 0xB0, 0xF5, 0x22, 0xF0, 0x20, 0x60, 0xF3, 0x70, 0xB0, 0xF1,
+0x22, 0xF1, 0xD0, 0x60, 0xF2, 0x21, 0xF1, 0x23, 0xF0, 0xB1, 0xF1, 0x20, 0xF1, 0xD1, 0xA0, 0xC0,
+0x00, 0xC0, 0x90, 0x09, 0x90, 0x08, 0x90, 0x08, 0x90, 0xC0, 0x07, 0x90, 0x30, 0x60, 0xD0, 0xF2,
+0x20, 0xF0, 0xB1, 0xF1, 0x23, 0xF0, 0xD0, 0x60, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xD0, 0xF0, 0x60,
+0xF1, 0xD0, 0x30, 0x80, 0x03, 0x40, 0x08, 0x40, 0x80, 0xD0, 0xF3, 0x21, 0xF1, 0xB1, 0xF2, 0x20,
+0xF1, 0x21, 0xF1, 0xB0, 0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0xB0, 0xD1, 0x60, 0xF2, 0x20,
+0xF0, 0x20, 0xF2, 0x22, 0xF0, 0xD0, 0xB1, 0x61, 0x80, 0x60, 0x80, 0xB0, 0xD3, 0xB0, 0x60, 0xF0,
+0xD1, 0xF0, 0x60, 0xF0, 0xD2, 0xB0, 0xD0, 0xF4, 0x22, 0xF2, 0xD1, 0xB0, 0x60, 0xF0, 0xD0, 0xF0,
+0x23, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x24, 0xF2, 0xD0, 0x20, 0xB0, 0x60, 0xF3, 0x21, 0xF3, 0xD0,
+0xB0, 0x70, 0x02, 0x30, 0x50, 0x01, 0xA0, 0x00, 0x40, 0xE0, 0x80, 0x0F, 0x11, 0x0F, 0x11, 0x80,
+0x40, 0x01, 0x90, 0xE0, 0x90, 0x50, 0x00, 0x80, 0x90, 0x00, 0x40, 0x30, 0x70, 0xD1, 0xF2, 0x21,
+0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF5, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20,
+0xF1, 0x60, 0xF4, 0x25, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0x20, 0xF2, 0x60,
+0xB0, 0xD0, 0x20, 0xF1, 0x20, 0xF3, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0xB0, 0xF1, 0x24, 0xD0, 0xB1,
+0xD0, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xB0,
+0x70, 0xC0, 0x90, 0xC0, 0x08, 0x50, 0xC0, 0x08, 0x40, 0x08, 0x90, 0x08, 0x90, 0x00, 0x70, 0xD0,
+0xF1, 0x21, 0xD0, 0xB1, 0xF1, 0x23, 0xF0, 0xD0, 0x60, 0x21, 0xF2, 0x20, 0xF2, 0x60, 0xD1, 0xB0,
+0xA0, 0x04, 0x90, 0x08, 0xA0, 0x30, 0xF0, 0xD0, 0xF0, 0x24, 0xF1, 0x60, 0xD0, 0x20, 0xF0, 0x20,
+0xF0, 0x22, 0xF2, 0xB0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xD0,
+0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0xB0, 0x30, 0xA0, 0x80, 0x42, 0x90,
+0xA0, 0x70, 0xA0, 0x60, 0xB0, 0x60, 0xF2, 0xD0, 0xF1, 0x60, 0xF2, 0xD0, 0x20, 0xF2, 0x22, 0xF0,
+0x20, 0xF6, 0x60, 0xF2, 0x22, 0xF0, 0x20, 0xF3, 0x25, 0xF4, 0xD0, 0xB0, 0x60, 0xF1, 0x20, 0xF4,
+0xD1, 0xA0, 0x30, 0x40, 0x00, 0xC0, 0x30, 0x02, 0xC0, 0x02, 0xA0, 0x40, 0x0F, 0x10, 0x0F, 0x11,
+0x50, 0xE0, 0x80, 0xE1, 0x51, 0x80, 0x30, 0x00, 0xA0, 0x30, 0x80, 0x00, 0x50, 0xA0, 0xD1, 0xF3,
+0xD0, 0xB0, 0x60, 0x20, 0xF1, 0xD0, 0xF3, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0,
+0x20, 0x60, 0xF2, 0x20, 0xF0, 0x2A, 0xF3, 0x60, 0xB0, 0xF5, 0xD0, 0x60, 0xB0, 0xD0, 0x21, 0xF0,
+0x21, 0xD0, 0x60, 0xF1, 0xD0, 0x20, 0xF4, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF2, 0x21, 0xF0,
+0x20, 0xF0, 0x21, 0xD0, 0xB1, 0xD0, 0xF2, 0x20, 0xF2, 0xD0, 0xB0, 0xA0, 0x80, 0x09, 0x40, 0x09,
+0x90, 0x08, 0x40, 0x08, 0x90, 0x00, 0xA0, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0xB1, 0xF1, 0x22, 0xF1,
+0xD0, 0xB1, 0xD1, 0x23, 0xF0, 0xD0, 0x60, 0xF1, 0xB0, 0x80, 0x04, 0x50, 0xC0, 0x07, 0x80, 0xA0,
+0xD0, 0xF5, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0x22, 0xF2, 0x20, 0xF2, 0x60, 0xD0, 0xF0, 0x22, 0xF0,
+0x21, 0xF2, 0xD0, 0xB1, 0xD0, 0xF3, 0x20, 0xF2, 0xD0, 0xF0, 0x70, 0x50, 0x00, 0x40, 0x06, 0x30,
+0x60, 0xF5, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF4, 0x22, 0xF0, 0x20,
+0xF1, 0x60, 0xF0, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x24, 0xF2, 0x20, 0xF5, 0xD0, 0x60, 0xB0,
+0xF2, 0xD0, 0xF0, 0xD1, 0x30, 0x40, 0x00, 0x40, 0xA0, 0x70, 0x0F, 0x1A, 0x0F, 0x12, 0xC0, 0x40,
+0xC0, 0x01, 0x50, 0x31, 0x00, 0xC0, 0x30, 0x02, 0x30, 0x60, 0xD0, 0xF1, 0xD0, 0xF0, 0x60, 0xB0,
+0x20, 0xF0, 0x20, 0xF4, 0x24, 0xF3, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0xB0, 0x60, 0xF2, 0x20, 0xF0,
+0x22, 0xF4, 0x20, 0xF1, 0x20, 0xF2, 0x60, 0xB0, 0xF7, 0xD0, 0x61, 0xD0, 0x21, 0xF0, 0xD0, 0x60,
+0xB0, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xF0, 0x20, 0xF2, 0x60, 0xD0, 0xF5, 0x20, 0xF0, 0x20, 0xF1,
+0x20, 0x60, 0xD0, 0x20, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xE0, 0x90, 0x07, 0x90,
+0x08, 0x51, 0x08, 0x90, 0x08, 0x90, 0x00, 0x40, 0x80, 0xD0, 0xF2, 0xD0, 0xB1, 0xD0, 0xF0, 0x22,
+0xF2, 0xB1, 0xF2, 0x22, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0x30, 0x40, 0x04, 0xC0, 0x50, 0x07, 0x40,
+0xE0, 0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0xD0, 0xF0, 0x22, 0xF1, 0x21,
+0xF1, 0x60, 0xB0, 0xF3, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF3, 0x23, 0xF1, 0xD0, 0xA0, 0x70,
+0xA0, 0x50, 0x90, 0x01, 0xC0, 0x71, 0x31, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0xD0, 0xF2, 0x60, 0xD1,
+0xF2, 0x20, 0xF5, 0x25, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0x25, 0xF1, 0x20, 0xF3,
+0xD0, 0xF0, 0x22, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD1, 0xB0, 0x70, 0x02, 0x80, 0x90, 0x0F, 0x1A,
+0x0F, 0x18, 0xC0, 0x02, 0x80, 0x90, 0x00, 0x80, 0x30, 0x70, 0xD1, 0xF0, 0xB0, 0x60, 0xF1, 0x20,
+0xF0, 0x21, 0xF2, 0x24, 0xF2, 0x20, 0xF0, 0x22, 0xF2, 0xB0, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x21,
+0xF4, 0x21, 0xF4, 0xD0, 0x60, 0xB0, 0x22, 0xF2, 0x20, 0xF2, 0xD0, 0xB0, 0x60, 0xF1, 0xD0, 0xB1,
+0xD0, 0xF0, 0x27, 0xF2, 0xD0, 0x60, 0xB0, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x60,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF1, 0x60, 0xD1, 0x30, 0xA0, 0x05, 0x90, 0xC0, 0x08, 0x90,
+0x08, 0xC0, 0x50, 0x07, 0xC0, 0x90, 0x01, 0xA0, 0xB0, 0xD0, 0xF0, 0x20, 0xD0, 0xB1, 0xD0, 0xF0,
+0x21, 0xF2, 0xD0, 0xB1, 0xD0, 0xF1, 0x22, 0xF1, 0xB1, 0x31, 0x06, 0x90, 0x07, 0xC0, 0x30, 0xB0,
+0xF5, 0x22, 0xD0, 0x60, 0xB0, 0xF1, 0x21, 0xF3, 0x20, 0xF1, 0x60, 0xF2, 0x21, 0xF0, 0x20, 0xF0,
+0x20, 0xF3, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF2, 0xD1, 0xB0, 0xA0, 0x32, 0x10, 0x60, 0xB0,
+0x60, 0xD0, 0xF4, 0x21, 0xF1, 0xD0, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF7, 0x25, 0xF0, 0xD0,
+0x60, 0xB0, 0xF3, 0x22, 0xF0, 0x25, 0xF6, 0x21, 0xF1, 0x60, 0xB0, 0xF1, 0xD0, 0x70, 0x30, 0x80,
+0x00, 0x50, 0x30, 0x0F, 0x1B, 0x0F, 0x1D, 0x70, 0xA0, 0x40, 0x00, 0x90, 0xA0, 0xD0, 0x60, 0xB0,
+0xF1, 0x22, 0xF1, 0x21, 0xF0, 0x23, 0xF4, 0x23, 0xF1, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF5,
+0x22, 0xF0, 0x20, 0xF2, 0x60, 0xB0, 0xF0, 0x23, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60,
+0xD0, 0xB0, 0x60, 0xF0, 0x2A, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF1,
+0xB0, 0x60, 0xD0, 0x23, 0xF1, 0x22, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0xA0, 0x04, 0x40,
+0x01, 0xA0, 0x30, 0x05, 0x40, 0x08, 0x50, 0xC0, 0x07, 0xC0, 0x50, 0x01, 0xC0, 0x70, 0xD0, 0xF2,
+0xB1, 0xF1, 0x21, 0xF2, 0xD0, 0xB1, 0xF5, 0xD1, 0xB0, 0xA0, 0x80, 0x07, 0x40, 0x05, 0x90, 0x00,
+0x40, 0x61, 0xF5, 0x22, 0xF1, 0x60, 0xD0, 0xF0, 0x21, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0x21, 0xF0,
+0x20, 0xF1, 0x23, 0xD0, 0xB1, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF3, 0x60, 0xB0, 0x30, 0xB2, 0xD0,
+0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xD0, 0xF0, 0x60, 0xF3, 0x24, 0xF4, 0x22, 0xF1, 0xD0, 0xB0,
+0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x23, 0xF4, 0x24, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0x30, 0x40,
+0x00, 0x90, 0xA0, 0x70, 0x0F, 0x1C, 0x0F, 0x1D, 0x50, 0x30, 0x02, 0x31, 0xF0, 0xD0, 0x20, 0xF0,
+0x23, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0x22, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x21,
+0xF0, 0x20, 0xF4, 0x22, 0xF1, 0xD1, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0x26, 0xF1, 0xB0, 0x61,
+0xD1, 0xF0, 0x29, 0xF1, 0x60, 0xF0, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0xD0, 0x60, 0xF2,
+0x21, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xD0, 0x20, 0xF1, 0xD0, 0x81, 0x02, 0xC0, 0x90, 0x02, 0x10,
+0x70, 0x50, 0x02, 0xC0, 0x90, 0x08, 0x90, 0x08, 0xC0, 0x50, 0x02, 0x40, 0x70, 0xD2, 0xB1, 0xD0,
+0xF0, 0x22, 0xF3, 0xB0, 0xD6, 0x60, 0x10, 0x90, 0x08, 0x51, 0x03, 0x90, 0x10, 0x50, 0xA0, 0xD0,
+0xB1, 0xF2, 0x21, 0xF0, 0x22, 0xD0, 0xB0, 0xF1, 0x21, 0xF1, 0x22, 0xF1, 0xD0, 0x60, 0xF2, 0x21,
+0xF0, 0x23, 0xF1, 0xD0, 0x60, 0x20, 0xF2, 0x22, 0xF1, 0x21, 0xF1, 0xD1, 0x61, 0xB0, 0xD0, 0xF0,
+0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF5, 0x60, 0xD1, 0x20, 0xF0, 0x24, 0xF4, 0x23, 0xD0, 0xF0, 0xB0,
+0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x24, 0xF0, 0x20, 0xF1, 0x21, 0xF3, 0xD0, 0xF0, 0x60,
+0x70, 0x02, 0x80, 0x90, 0x0F, 0x1C, 0x0F, 0x1E, 0x80, 0x40, 0x00, 0x31, 0x70, 0xD0, 0xF1, 0x21,
+0xF2, 0x25, 0xF3, 0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF5, 0x22,
+0xF0, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0x20, 0xF2, 0x28, 0xF1, 0xD0, 0x61, 0xB0, 0xD0, 0xF0, 0x27,
+0xF1, 0xD0, 0x60, 0xF0, 0xD0, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xD0, 0xB1, 0xD0, 0xF0, 0x22,
+0xF0, 0x20, 0xF1, 0x20, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x90, 0x01, 0x90,
+0x03, 0x10, 0xA0, 0x10, 0x80, 0x01, 0x51, 0x08, 0x40, 0x08, 0x50, 0xC0, 0x03, 0x70, 0x10, 0xA1,
+0x30, 0xB0, 0xD0, 0xF0, 0x22, 0xF0, 0xD1, 0xF0, 0xB0, 0xD0, 0xB0, 0x30, 0xA1, 0xE0, 0x71, 0x40,
+0xA0, 0x09, 0x90, 0x02, 0x40, 0x71, 0x80, 0x30, 0xD0, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0xF2, 0x21,
+0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x22,
+0xF0, 0x24, 0xF1, 0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0x22, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF0,
+0x20, 0xF0, 0x23, 0xF0, 0x22, 0xF4, 0x60, 0xF0, 0xD0, 0xF1, 0x24, 0xF3, 0x24, 0xF0, 0xD0, 0xF0,
+0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF5, 0x25, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0xD1, 0x70, 0x80, 0x30,
+0x00, 0x50, 0x30, 0x0F, 0x1D, 0x0F, 0x1F, 0xA1, 0x50, 0x00, 0xC0, 0x70, 0xD0, 0xF0, 0x20, 0xF4,
+0x26, 0xF0, 0x23, 0xF1, 0xB0, 0x60, 0xF2, 0x22, 0xF7, 0x20, 0xF4, 0xD0, 0x60, 0xB0, 0xF0, 0x20,
+0xF0, 0x20, 0xF2, 0x27, 0xF0, 0xD0, 0x60, 0xF1, 0x60, 0xB0, 0xF3, 0x23, 0xF1, 0xD0, 0xB1, 0xD0,
+0xF2, 0x26, 0xF1, 0x60, 0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF1, 0x60, 0xD1, 0xF1, 0x21, 0xF1, 0xA0,
+0x30, 0x91, 0x03, 0xE0, 0xC0, 0x50, 0x40, 0x01, 0x90, 0x09, 0x40, 0x08, 0x50, 0xC0, 0x04, 0xC0,
+0x01, 0x40, 0xA0, 0x60, 0xD0, 0x20, 0xF0, 0xD1, 0xB0, 0x61, 0x80, 0x30, 0xE0, 0x50, 0x01, 0xE1,
+0x30, 0x70, 0x90, 0x09, 0x40, 0x01, 0x50, 0x30, 0xE0, 0x10, 0xE0, 0x30, 0xD1, 0x60, 0xF0, 0xD0,
+0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xB1, 0xF0, 0x20, 0xF0, 0x25, 0xF1, 0x60, 0xF2, 0x22, 0xF0, 0x20,
+0xF4, 0xB0, 0x60, 0xD0, 0xF2, 0x20, 0xF0, 0x21, 0xF2, 0xB0, 0x60, 0xF1, 0x60, 0xD0, 0xF1, 0x27,
+0xF0, 0x20, 0xF3, 0x20, 0x60, 0xD0, 0xF1, 0x24, 0xF3, 0x24, 0xF0, 0x20, 0xF1, 0x60, 0xB0, 0xD0,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x26, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x30, 0x90, 0x00, 0x50,
+0xA1, 0x0F, 0x1E, 0x0F, 0x1F, 0xC0, 0xA0, 0x02, 0x31, 0xD0, 0xF0, 0x20, 0xF4, 0x23, 0xF1, 0x21,
+0xF0, 0x20, 0xF1, 0xB0, 0x60, 0xD0, 0xF2, 0x22, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x60,
+0xB0, 0xF1, 0x22, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x60, 0xB0, 0xD1, 0xF0, 0xB1, 0xF0,
+0xD0, 0xF2, 0x22, 0xF1, 0x60, 0xD0, 0xF1, 0x27, 0xF0, 0xD0, 0xB1, 0xF1, 0x26, 0xF1, 0xB1, 0xF3,
+0x22, 0xF0, 0xD0, 0xB0, 0x80, 0xA0, 0x40, 0xC0, 0x01, 0x50, 0xC0, 0x03, 0x40, 0x09, 0x40, 0x08,
+0x90, 0x50, 0x10, 0x50, 0x05, 0xC0, 0x50, 0xA0, 0xB0, 0xD0, 0xF0, 0xB0, 0x70, 0x10, 0x41, 0x30,
+0x90, 0x04, 0x51, 0x00, 0x50, 0xC0, 0x08, 0x90, 0x01, 0xA0, 0xC0, 0x00, 0x30, 0x10, 0xA0, 0xD0,
+0xF0, 0xB1, 0xD0, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0x60, 0xD0, 0x21, 0xF0, 0x23, 0xF0, 0x20, 0xD0,
+0xF0, 0x60, 0xD0, 0xF0, 0x26, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0x20, 0xF0, 0x21, 0xF2, 0xD0, 0xB0,
+0x60, 0xF0, 0xD0, 0xF0, 0xB0, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0x21, 0xF1, 0x22, 0xF1, 0x60, 0xF2,
+0x25, 0xF2, 0x25, 0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0x25, 0xF0, 0x22, 0xF2, 0xD0, 0x60,
+0xA0, 0x02, 0x80, 0x90, 0x0F, 0x1E, 0x0F, 0x20, 0x80, 0x40, 0x00, 0x30, 0x80, 0xA0, 0xB0, 0xD0,
+0xF4, 0x22, 0xF2, 0x22, 0xF1, 0xD0, 0x61, 0xF4, 0x21, 0xF4, 0x24, 0xF1, 0xD1, 0xB1, 0xD0, 0xF1,
+0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x23, 0xD0, 0xB1, 0xF0, 0x22, 0xF0, 0xB0, 0x60, 0xF2, 0x21,
+0xF1, 0xD0, 0x60, 0xF2, 0x23, 0xF0, 0x22, 0xF2, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF2, 0x20, 0xD0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0xD0, 0x60, 0xB0, 0x60, 0xA2, 0x30,
+0x03, 0xC0, 0x50, 0x08, 0xC0, 0x50, 0x08, 0x90, 0x00, 0xE1, 0x05, 0xC2, 0xE0, 0x71, 0x81, 0x02,
+0x40, 0x08, 0x51, 0x08, 0xC0, 0x81, 0x30, 0x01, 0x70, 0xE0, 0xF0, 0xD0, 0xF0, 0xD0, 0x60, 0xD0,
+0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xD0, 0x60, 0xF1, 0x22, 0xF1, 0x21, 0xF1, 0xD0, 0xB1, 0xF0,
+0x22, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xD1, 0x60, 0xB0, 0xD0,
+0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0xB0,
+0x60, 0xF3, 0x24, 0xF2, 0x21, 0xF0, 0x22, 0xF2, 0xB0, 0x60, 0xD1, 0xF0, 0x2A, 0xF2, 0xD1, 0x70,
+0x80, 0xA0, 0x00, 0x90, 0x30, 0x0F, 0x1F, 0x0F, 0x21, 0x30, 0x70, 0x50, 0x01, 0xA0, 0xD1, 0x20,
+0xF3, 0x21, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x60, 0xB0, 0xD0, 0xF1, 0x22, 0xF5, 0x25, 0xF2, 0x60,
+0xB0, 0xF2, 0x21, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x22, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x23, 0xF1,
+0x60, 0xB0, 0xD1, 0xF0, 0x20, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x24, 0xF0, 0x22, 0xF0, 0xD0, 0x60,
+0xF2, 0x21, 0xF1, 0x20, 0xF3, 0xB1, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x60, 0xD4, 0x60,
+0xA0, 0x02, 0x90, 0x09, 0x90, 0xC0, 0x08, 0x40, 0x08, 0xC0, 0x50, 0x08, 0x40, 0x09, 0x50, 0x00,
+0x51, 0x91, 0x41, 0x81, 0x70, 0x41, 0x01, 0x50, 0x70, 0xB0, 0xD0, 0xF1, 0xD0, 0xB0, 0xF5, 0x22,
+0xF1, 0xB1, 0xF1, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0x60, 0xF0, 0x22, 0xF2, 0x23, 0xF0, 0xD0, 0x20,
+0x60, 0xD0, 0xF1, 0xD1, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x22, 0xD1, 0xB1, 0xF2, 0x23, 0xF0, 0x25,
+0xF1, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0x26, 0xF6, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xF1,
+0x2B, 0xF0, 0xD1, 0x70, 0x01, 0xC0, 0x71, 0x0F, 0x20, 0x0F, 0x22, 0xA0, 0x02, 0x80, 0x70, 0xD1,
+0xF8, 0x21, 0xF1, 0x60, 0xF0, 0xD0, 0x20, 0xF0, 0x20, 0xF7, 0x25, 0xF1, 0xD0, 0x60, 0xB0, 0xD0,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x25, 0xF2, 0x20, 0xF0, 0x20, 0x60, 0xD0, 0xF1, 0x23, 0xF2, 0xB0,
+0x60, 0xD0, 0xF0, 0xD0, 0xB1, 0xD0, 0x20, 0xF1, 0x26, 0xF1, 0xB1, 0xD0, 0xF0, 0x24, 0xF3, 0xD0,
+0x60, 0xF1, 0x22, 0xF1, 0x21, 0xF1, 0xB1, 0xF3, 0xD1, 0x31, 0x01, 0x40, 0x09, 0x40, 0x09, 0x40,
+0x08, 0xC0, 0x50, 0x08, 0x40, 0x09, 0x30, 0xA0, 0x80, 0x42, 0x90, 0x51, 0xC0, 0x90, 0x80, 0x02,
+0x40, 0x70, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0x60, 0xF4, 0x22, 0xF1, 0xD0, 0x60, 0xD0, 0xF3, 0x20,
+0xF0, 0x20, 0xF3, 0xB1, 0xD0, 0xF0, 0x22, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF1,
+0xB0, 0x60, 0xF0, 0xD0, 0x23, 0xF0, 0x21, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0x21, 0xF0,
+0x24, 0xF2, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF4, 0x20, 0xF0, 0x21, 0xF1, 0xD0,
+0xF0, 0x60, 0xF1, 0x22, 0xF2, 0x22, 0xF1, 0x20, 0xD0, 0x30, 0xA0, 0x02, 0xA0, 0x0F, 0x21, 0x0F,
+0x22, 0x50, 0x30, 0x00, 0x30, 0x41, 0x30, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xD0, 0xF0, 0x60, 0xF5, 0x22, 0xF2, 0x24, 0xF0, 0x20, 0xF2, 0x60, 0xB0, 0xD0, 0xF2, 0x21,
+0xF0, 0x20, 0xF0, 0x22, 0xF5, 0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF3, 0xD0, 0xB0, 0x60, 0xF0, 0xD0,
+0x60, 0xF1, 0xD0, 0xF0, 0x26, 0xF2, 0x60, 0xD0, 0x26, 0xF2, 0xD0, 0xB1, 0xF1, 0x22, 0xF1, 0x22,
+0xF0, 0x60, 0xF0, 0x24, 0xD1, 0x60, 0xA0, 0x50, 0x90, 0x09, 0x40, 0x09, 0x90, 0x08, 0xC0, 0x50,
+0x08, 0x90, 0x09, 0x80, 0x90, 0x07, 0xC0, 0xA0, 0x02, 0x40, 0x80, 0x30, 0xE0, 0xD0, 0xF0, 0x20,
+0xF0, 0x60, 0xD0, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0xB1, 0xD0, 0xF2, 0x25, 0xF1, 0x60, 0xF2, 0x22,
+0xF1, 0x22, 0xF2, 0x60, 0xF1, 0x60, 0xB0, 0xD0, 0xF1, 0x27, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x20,
+0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xD0, 0xB0, 0x60, 0xF2, 0x24, 0xF5,
+0x22, 0xF4, 0x60, 0xB0, 0xF2, 0x20, 0xF1, 0x22, 0xF1, 0xD0, 0x60, 0x80, 0x90, 0xA0, 0x00, 0x80,
+0x40, 0x0F, 0x21, 0x0F, 0x23, 0x40, 0xE0, 0xC0, 0x01, 0xA0, 0xB0, 0xD0, 0x23, 0xF0, 0x20, 0xF1,
+0xD0, 0xB0, 0x60, 0xF0, 0xD1, 0x20, 0xF0, 0x20, 0xF0, 0x29, 0xF2, 0xD1, 0x60, 0xB0, 0xD0, 0x20,
+0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x21, 0xD0, 0xF0, 0x60, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0x20, 0xF4, 0x20, 0x61, 0xF1, 0xD0, 0x28, 0xF1, 0xB1, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF1,
+0xD0, 0x60, 0xD0, 0xF1, 0x21, 0xF2, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xD0,
+0xF0, 0x70, 0x40, 0x09, 0x90, 0x09, 0x90, 0x08, 0xC0, 0x50, 0x08, 0x50, 0xC0, 0x08, 0x91, 0x07,
+0xC0, 0xA0, 0xC0, 0x01, 0x80, 0xB0, 0x60, 0x30, 0xD0, 0xF0, 0x20, 0xF0, 0xB1, 0xF3, 0x20, 0xF0,
+0x21, 0xF1, 0xD0, 0x60, 0xD0, 0xF2, 0x21, 0xF0, 0x23, 0xF1, 0x60, 0xF2, 0x21, 0xF2, 0x21, 0xF1,
+0xD0, 0xF0, 0x61, 0xB0, 0xD0, 0xF0, 0x21, 0xF4, 0x21, 0xF1, 0x20, 0x60, 0x20, 0xD0, 0xF0, 0x20,
+0xF0, 0x24, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0xB0, 0x60, 0xD0, 0xF1, 0x23, 0xF3, 0x21, 0xF1, 0x23,
+0xF2, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0xB0, 0xA0, 0x01, 0xC0, 0x70, 0x30, 0x0F,
+0x22, 0x0F, 0x24, 0xA0, 0xC0, 0x01, 0x80, 0xE0, 0xD1, 0x22, 0xF0, 0x20, 0xF1, 0x61, 0xD1, 0xF0,
+0x20, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x26, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0,
+0x21, 0xF0, 0x26, 0xF1, 0xB1, 0xD0, 0xF0, 0x22, 0xF4, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60,
+0xB0, 0xF3, 0x26, 0xF1, 0x60, 0xD0, 0xF0, 0x24, 0xF0, 0x21, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x20,
+0xF2, 0xD0, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF2, 0xD0, 0x60, 0x30, 0x70,
+0x80, 0xC0, 0x05, 0xC0, 0x90, 0x08, 0xC0, 0x50, 0x08, 0xC0, 0x50, 0x05, 0x50, 0x01, 0x50, 0xC0,
+0x06, 0x30, 0xE0, 0x30, 0xC0, 0x07, 0xC0, 0x30, 0x90, 0x01, 0x40, 0x80, 0xD1, 0xF3, 0x20, 0x60,
+0xF5, 0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xF1, 0x20, 0xF0,
+0x21, 0xF2, 0x21, 0xF0, 0xD0, 0x61, 0xB0, 0xD0, 0xF0, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF1, 0x60, 0xD0, 0xF2, 0x22, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0x60, 0xF3,
+0x20, 0xF4, 0x20, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0x20,
+0xF0, 0x21, 0xF1, 0xD0, 0x70, 0x30, 0x02, 0xA0, 0x0F, 0x23, 0x0F, 0x25, 0x70, 0xC0, 0x30, 0x40,
+0xC0, 0x70, 0xD0, 0xF0, 0x20, 0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF5, 0x29, 0xF3, 0xD1, 0x60, 0xB0,
+0xD0, 0xF0, 0x21, 0xF2, 0x24, 0xF1, 0x21, 0xF0, 0xD0, 0xB1, 0xF3, 0x21, 0xF4, 0x21, 0xF2, 0x60,
+0xF1, 0x60, 0xB0, 0xD0, 0xF2, 0x23, 0xF0, 0xD0, 0x60, 0xF2, 0x20, 0xF2, 0x20, 0xF0, 0x21, 0xF0,
+0xD0, 0x60, 0xF1, 0x21, 0xF3, 0x21, 0xF0, 0xD0, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0x22, 0xF1, 0x60,
+0xD1, 0x60, 0xA0, 0x30, 0x50, 0x03, 0x51, 0x08, 0xC0, 0x50, 0x08, 0xC0, 0x50, 0x04, 0xA0, 0xE1,
+0x00, 0xC0, 0x50, 0x07, 0x81, 0x50, 0x08, 0x30, 0x90, 0x01, 0x50, 0x30, 0xD0, 0xF4, 0xD0, 0x60,
+0xF5, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2,
+0x60, 0xD0, 0xF1, 0x22, 0xF1, 0x20, 0xD0, 0xB0, 0x60, 0xB0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x21,
+0xF4, 0x21, 0xF1, 0x20, 0xF0, 0xB0, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0x21, 0xF2, 0x60,
+0xD0, 0xF5, 0x20, 0xF3, 0x27, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF2, 0x20, 0xD1, 0xA0, 0x51, 0xA0,
+0x00, 0xA0, 0xC0, 0x80, 0x30, 0x0F, 0x21, 0x0F, 0x25, 0x50, 0xE0, 0x50, 0x01, 0x40, 0xA0, 0xD0,
+0xF1, 0xD0, 0xF0, 0x60, 0xB0, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0x20, 0xF0,
+0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF1, 0x25, 0xF4, 0xB0, 0x60, 0xD0, 0xF0, 0x20,
+0xF1, 0x21, 0xF3, 0x21, 0xF2, 0x60, 0xF0, 0xD1, 0xF0, 0xB0, 0x60, 0xF2, 0x23, 0xF0, 0xB1, 0xF6,
+0x20, 0xF0, 0x20, 0xF1, 0xB1, 0xF0, 0x22, 0xF1, 0x23, 0xF0, 0xB1, 0xF2, 0x20, 0xF2, 0x21, 0xF0,
+0x20, 0x60, 0xD3, 0x60, 0x31, 0x02, 0x50, 0xC0, 0x08, 0x51, 0x08, 0xC0, 0x50, 0x04, 0xC0, 0x00,
+0x50, 0x00, 0xC0, 0x90, 0x08, 0x80, 0x30, 0xC0, 0x07, 0x30, 0x50, 0xC0, 0x00, 0x40, 0x80, 0xD0,
+0xF5, 0xB1, 0xD1, 0xB1, 0xF1, 0x23, 0xF0, 0xB1, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x21, 0xF2, 0xB1,
+0xF0, 0x21, 0xF4, 0xB0, 0x60, 0xF0, 0xD0, 0xF1, 0x60, 0xD0, 0x20, 0xF0, 0x21, 0xF7, 0x20, 0xF0,
+0xD0, 0xB1, 0xF2, 0x27, 0xF2, 0x20, 0xF2, 0xB0, 0x60, 0xF2, 0x21, 0xF5, 0x28, 0xF0, 0xD0, 0xF0,
+0x60, 0xF3, 0xD0, 0x30, 0x80, 0x01, 0xC0, 0xE0, 0x90, 0x50, 0x80, 0x40, 0x90, 0x0F, 0x20, 0x0F,
+0x26, 0x41, 0x01, 0x80, 0x70, 0x80, 0xD0, 0xF1, 0x60, 0xF2, 0x23, 0xF3, 0x26, 0xF0, 0x20, 0xF0,
+0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF2, 0x25, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xD0,
+0xF1, 0x24, 0xF3, 0x21, 0xF1, 0xB1, 0xF2, 0x20, 0xD0, 0xB0, 0x60, 0xB0, 0xD1, 0xF0, 0x20, 0xF0,
+0xD0, 0x60, 0xF4, 0x24, 0xF1, 0xD0, 0x60, 0xF2, 0x21, 0xF2, 0x22, 0xF0, 0x60, 0xF3, 0x20, 0xF2,
+0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF1, 0xD2, 0x60, 0xA1, 0x80, 0x40, 0x09, 0x50, 0xC0, 0x08, 0xC0,
+0x50, 0x09, 0x90, 0x09, 0x40, 0x70, 0xC0, 0x05, 0xC0, 0x30, 0x00, 0x50, 0x00, 0x30, 0xB0, 0xD0,
+0xF6, 0x60, 0xE0, 0x62, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x60, 0xF0, 0x21, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x22, 0xF1, 0x60, 0xF4, 0xD0, 0xF0, 0x60, 0xB0, 0xD0, 0xF3, 0xB0, 0x60, 0xD0, 0xF2,
+0x20, 0xF5, 0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF0, 0x24, 0xF4, 0x20, 0xF0, 0x20,
+0xD0, 0xB0, 0x60, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF5, 0x23, 0xF0, 0x21, 0xD0, 0x20, 0x60,
+0xB0, 0xD1, 0x60, 0x70, 0x30, 0x01, 0x90, 0x30, 0x01, 0x80, 0x30, 0x0F, 0x21, 0x0F, 0x24, 0x71,
+0x00, 0x80, 0x40, 0xA0, 0x90, 0x00, 0x30, 0xB1, 0x60, 0xF3, 0x23, 0xF3, 0x24, 0xF1, 0x20, 0xF1,
+0xD0, 0x60, 0xB0, 0xF2, 0x21, 0xF3, 0x26, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x23,
+0xF1, 0x20, 0xF4, 0x60, 0xD0, 0x22, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xB1,
+0xF1, 0x21, 0xF0, 0x24, 0xF1, 0xB0, 0x60, 0xD0, 0xF0, 0x23, 0xF2, 0x21, 0xF0, 0x60, 0xD0, 0xF2,
+0x20, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF0, 0xD3, 0xB0, 0x30, 0x70, 0xA0, 0x07, 0x50,
+0xC0, 0x08, 0xC0, 0x50, 0x09, 0x90, 0x09, 0x90, 0x00, 0x70, 0x90, 0x04, 0xC0, 0x80, 0x00, 0x90,
+0x50, 0xA0, 0xD0, 0xF0, 0x22, 0xF1, 0xD0, 0x20, 0x30, 0x60, 0xDA, 0xB0, 0xF0, 0x21, 0xF0, 0x21,
+0xF1, 0x22, 0xF0, 0xD0, 0xB1, 0xF0, 0xD1, 0xF0, 0x61, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xD0,
+0x60, 0xB0, 0xF2, 0x22, 0xF2, 0x24, 0xF0, 0xD0, 0x60, 0xF2, 0x24, 0xF6, 0x21, 0xF1, 0xB0, 0x60,
+0xF1, 0x23, 0xF0, 0x20, 0xF4, 0x25, 0xF2, 0xD0, 0x60, 0xB1, 0xA0, 0x00, 0xC0, 0x70, 0x90, 0xA0,
+0x00, 0x80, 0x40, 0x0F, 0x23, 0x0F, 0x24, 0x90, 0x50, 0x70, 0x00, 0x70, 0x50, 0x01, 0x50, 0x10,
+0x60, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF6, 0x22, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0,
+0x22, 0xF3, 0x22, 0xF0, 0x23, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0x22, 0xF0, 0x23, 0xF1, 0x20, 0xF2,
+0xD0, 0x60, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x60, 0xB0, 0xF1, 0x60, 0xD0, 0xF0, 0x27,
+0xF1, 0xD0, 0x60, 0xB0, 0xF1, 0x23, 0xF1, 0x20, 0xF1, 0xB1, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1,
+0x20, 0xF2, 0x60, 0xD0, 0xF1, 0x20, 0xF1, 0x21, 0xF2, 0xB0, 0xD0, 0x60, 0xA0, 0x50, 0x05, 0x90,
+0xC0, 0x08, 0xC0, 0x30, 0x40, 0xC0, 0x07, 0x40, 0xA0, 0x08, 0x50, 0x01, 0xA0, 0x04, 0xC0, 0x80,
+0x00, 0x80, 0x70, 0xD0, 0xF2, 0x21, 0xF0, 0xD0, 0x70, 0xF1, 0xB0, 0xD0, 0x60, 0x70, 0x30, 0x60,
+0x80, 0xA2, 0x31, 0x80, 0x60, 0xD1, 0xF2, 0x23, 0xF1, 0x20, 0xD0, 0x60, 0xF0, 0xD0, 0xB0, 0x60,
+0xF1, 0xD0, 0xF1, 0x22, 0xF0, 0x20, 0xD0, 0x60, 0xF2, 0x22, 0xF2, 0x25, 0xF1, 0x60, 0xF0, 0xD0,
+0xF0, 0x23, 0xF4, 0x25, 0xD0, 0xB0, 0x60, 0xF1, 0x21, 0xF0, 0x28, 0xF0, 0x20, 0xF2, 0x20, 0xF1,
+0xD0, 0xB0, 0x10, 0x40, 0x01, 0x50, 0x70, 0x00, 0xA0, 0x80, 0x30, 0x10, 0x50, 0x0F, 0x21, 0x0F,
+0x26, 0x70, 0x50, 0x00, 0x70, 0x00, 0x40, 0x11, 0xA0, 0xD1, 0x20, 0xF1, 0x20, 0xF3, 0x22, 0xF1,
+0x22, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x23, 0xF2, 0x22, 0xF1, 0x20, 0xF1, 0xD0, 0x60, 0xB0,
+0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF2, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0x22, 0xF1, 0x20, 0xF3,
+0xD0, 0xB0, 0x61, 0xB0, 0xF2, 0x25, 0xF3, 0x60, 0xF0, 0x25, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0xF2,
+0x22, 0xF1, 0x21, 0xF0, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0xB1, 0xD1, 0x60, 0x30, 0x70,
+0x30, 0x03, 0x90, 0x09, 0x80, 0xE0, 0x10, 0x70, 0x10, 0x70, 0x50, 0x04, 0x30, 0x10, 0xA0, 0xC0,
+0x02, 0xC0, 0x52, 0x90, 0x41, 0x30, 0x04, 0x50, 0x80, 0x50, 0x30, 0x40, 0xD2, 0xB0, 0x60, 0xF0,
+0xB3, 0x61, 0xA0, 0x70, 0x90, 0xC0, 0x40, 0x90, 0x50, 0x01, 0x81, 0x90, 0xA0, 0xB0, 0xD0, 0xF3,
+0x22, 0xF4, 0x61, 0xB0, 0xF2, 0x20, 0xF0, 0x25, 0xF1, 0x60, 0xD0, 0xF1, 0x22, 0xF1, 0x25, 0xF0,
+0xD0, 0xF0, 0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF2, 0x27, 0xD0, 0xB0, 0x60, 0xF2, 0x2A, 0xF0, 0xD0,
+0x20, 0xF2, 0xD1, 0xA0, 0xE0, 0x10, 0x80, 0x00, 0xA0, 0xC0, 0x00, 0xE0, 0x01, 0x50, 0x10, 0x50,
+0x0F, 0x20, 0x0F, 0x20, 0x30, 0xE1, 0xA0, 0x80, 0xA0, 0xE0, 0x01, 0xC0, 0xE0, 0x11, 0x00, 0x50,
+0xA0, 0xD0, 0xF1, 0x20, 0xF4, 0x22, 0xF1, 0x21, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x21, 0xF1,
+0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF2, 0xD0, 0xB1, 0xD0, 0x24, 0xF0, 0x25, 0xF0, 0x20, 0xD0, 0xB1,
+0xD0, 0xF3, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0xF2, 0x23, 0xF2, 0xB1,
+0xF0, 0x21, 0xF0, 0x24, 0xF2, 0x60, 0xD0, 0xF1, 0x26, 0xF0, 0xB1, 0xF1, 0x21, 0xD0, 0x20, 0xF0,
+0x21, 0xF0, 0xB1, 0xF1, 0xD2, 0x30, 0xA0, 0x40, 0x50, 0x00, 0x90, 0x07, 0x90, 0x70, 0x60, 0xB0,
+0xD0, 0x60, 0x80, 0xE0, 0x10, 0x80, 0x03, 0x50, 0x12, 0x30, 0x00, 0x90, 0xA0, 0x81, 0x41, 0x80,
+0x40, 0x50, 0x04, 0x50, 0xE0, 0x72, 0xE0, 0x40, 0x80, 0xA0, 0x40, 0x70, 0xA0, 0x30, 0xA1, 0x81,
+0x90, 0x0A, 0x10, 0xA1, 0xD1, 0xF1, 0x22, 0xF1, 0xD0, 0xF0, 0xB0, 0x60, 0xB0, 0xD0, 0xF0, 0x24,
+0xF0, 0x20, 0xF2, 0x20, 0xD0, 0xB1, 0xD0, 0xF1, 0x28, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xF3, 0x22,
+0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x23, 0xD0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0x24, 0xF5, 0x21, 0xF1,
+0x20, 0xD0, 0x30, 0x40, 0x00, 0x70, 0x11, 0x50, 0x01, 0x70, 0x90, 0x01, 0xC0, 0xE0, 0x0F, 0x20,
+0x0F, 0x20, 0x50, 0xE0, 0x00, 0x50, 0x41, 0x00, 0x80, 0xE0, 0xC0, 0x50, 0x10, 0x02, 0xA1, 0xD0,
+0xF0, 0x20, 0xF4, 0x22, 0xF1, 0x21, 0xF2, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x24,
+0xF4, 0xB1, 0xD0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x23, 0xF2, 0x60, 0xF0, 0xD0, 0x23, 0xF1, 0x24,
+0xF0, 0xD0, 0x60, 0xF1, 0x61, 0xF5, 0x21, 0xF1, 0x60, 0xD0, 0x22, 0xF1, 0x23, 0xF1, 0xB1, 0xD0,
+0x20, 0xF0, 0x22, 0xF2, 0x20, 0xF0, 0x60, 0xF6, 0x20, 0xF1, 0xD0, 0xB0, 0xF4, 0xD1, 0xB0, 0x60,
+0x30, 0x70, 0x30, 0x90, 0x03, 0x90, 0xA0, 0x70, 0x30, 0xD0, 0xB1, 0xD4, 0xA1, 0x02, 0x40, 0x00,
+0x50, 0x00, 0xA0, 0x90, 0xA0, 0x04, 0x90, 0x08, 0xA0, 0x40, 0x80, 0x50, 0x10, 0x80, 0x08, 0x90,
+0x0A, 0x80, 0xE0, 0x11, 0xE0, 0xD1, 0xF2, 0xD0, 0xF0, 0x61, 0xF0, 0xD0, 0x60, 0xD0, 0xF0, 0x25,
+0xF0, 0x20, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xF3, 0x24, 0xF2, 0x21, 0xF1, 0xD0, 0xB1, 0xF3, 0x21,
+0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xF1, 0x23, 0xFA, 0xD0, 0x30, 0xE0,
+0x02, 0x70, 0x40, 0x00, 0x80, 0x50, 0x00, 0x10, 0x40, 0x01, 0x70, 0xC0, 0x0F, 0x1F, 0x0F, 0x21,
+0x40, 0xA0, 0x03, 0xC1, 0x70, 0x00, 0x41, 0x00, 0x30, 0x90, 0x40, 0x30, 0xD0, 0xF0, 0x22, 0xF2,
+0x21, 0xF0, 0x20, 0xF2, 0xD0, 0x60, 0xB0, 0xD0, 0xF1, 0x22, 0xF3, 0x25, 0xF3, 0x60, 0xD0, 0xF0,
+0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0x22,
+0xF1, 0x20, 0xF1, 0x21, 0xF1, 0xB1, 0xF0, 0xD1, 0xF0, 0x60, 0xB0, 0xF0, 0xD0, 0xF1, 0x21, 0xF0,
+0xB1, 0xD0, 0xF0, 0x20, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF2, 0x23, 0xF4, 0x60, 0xD0,
+0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xD0, 0x60, 0xF2, 0x20, 0xF3, 0xD2, 0x60, 0x30, 0x70, 0x31, 0xA0,
+0x30, 0xF0, 0xD2, 0xB1, 0xF3, 0xD1, 0xB0, 0x70, 0x50, 0x00, 0x40, 0x03, 0x80, 0x50, 0x04, 0x40,
+0x06, 0x40, 0x10, 0x70, 0x00, 0x90, 0xA0, 0x0A, 0x40, 0x0B, 0xC0, 0x90, 0x50, 0x40, 0xE0, 0xB0,
+0xD1, 0xF0, 0xB0, 0x60, 0xF0, 0xD0, 0xF0, 0xD0, 0xB1, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x21, 0xF3,
+0x60, 0xD0, 0xF1, 0x24, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0xB1, 0xF2, 0x26, 0xF2, 0x22, 0xF3, 0x60,
+0xF1, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0xF4, 0xD0, 0x30, 0x80, 0x50, 0x70, 0x00, 0x90, 0x80, 0x00,
+0xE0, 0x80, 0xE0, 0xC0, 0x00, 0xA0, 0x70, 0xA0, 0x30, 0x0F, 0x20, 0x0F, 0x22, 0x30, 0x90, 0xC0,
+0x01, 0x90, 0x00, 0xA0, 0x50, 0x00, 0x30, 0x70, 0x50, 0x01, 0x81, 0xD0, 0xF0, 0x23, 0xF2, 0x21,
+0xF1, 0xD0, 0x60, 0xB0, 0xF2, 0x22, 0xF3, 0x24, 0xF0, 0x20, 0xF2, 0x60, 0xF0, 0xD0, 0x23, 0xF1,
+0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0xB0, 0x60, 0xD1, 0xF0, 0x25, 0xF0, 0x21, 0xF1, 0xD0, 0x60,
+0xF4, 0xD0, 0xB0, 0x60, 0xB0, 0xF1, 0x20, 0xF1, 0x60, 0xD0, 0x21, 0xF4, 0x21, 0xF2, 0x60, 0xF2,
+0x23, 0xF2, 0xD0, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF2, 0x60, 0xF6, 0x21, 0xF1, 0x60, 0xD1, 0xB1,
+0xF0, 0xD1, 0xF2, 0xB1, 0xD0, 0xF1, 0x22, 0xF1, 0xA0, 0x40, 0x90, 0x03, 0xA0, 0x05, 0x40, 0x06,
+0x70, 0x80, 0xC0, 0x40, 0x30, 0x50, 0x0A, 0x90, 0xC0, 0x0B, 0x40, 0x30, 0xA0, 0x10, 0xB0, 0xD0,
+0xB0, 0x60, 0xB0, 0xF1, 0x20, 0xF1, 0xD0, 0x60, 0xF2, 0x21, 0xF2, 0x21, 0xF1, 0x20, 0xF0, 0xD0,
+0xB1, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x60, 0xF0, 0xD0, 0xF2, 0x24,
+0xF3, 0x20, 0xF3, 0xD0, 0xF0, 0x60, 0xF1, 0x20, 0xF1, 0x60, 0xF0, 0x20, 0xF1, 0xB1, 0xD1, 0x60,
+0xA0, 0x01, 0xC0, 0x70, 0xA0, 0x00, 0x40, 0x30, 0x00, 0x30, 0xE0, 0x70, 0xC0, 0x50, 0x90, 0x0F,
+0x21, 0x0F, 0x24, 0xE0, 0xC0, 0x00, 0x70, 0xE0, 0xA0, 0x02, 0x70, 0xC0, 0x01, 0x30, 0x70, 0x60,
+0xD0, 0xF0, 0x25, 0xF1, 0xD0, 0xF0, 0xB1, 0xD0, 0xF0, 0x22, 0xF4, 0x24, 0xF0, 0x20, 0xF1, 0xD0,
+0x60, 0xF0, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0x20, 0x60, 0xD0, 0xF1, 0x20, 0xF0,
+0x22, 0xF4, 0x20, 0xD0, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF0, 0xD0,
+0xB1, 0xD1, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0xB0, 0xF3, 0x23, 0xF2, 0xD0, 0xB1, 0xF1, 0x25, 0xF2,
+0xB0, 0xF2, 0x20, 0xF2, 0x20, 0xF1, 0x20, 0x60, 0xD0, 0xF0, 0xD0, 0xF2, 0x20, 0xF2, 0xB1, 0xF3,
+0x21, 0xF0, 0xD1, 0xA0, 0x30, 0x02, 0x30, 0xC0, 0x05, 0x90, 0xC0, 0x07, 0x30, 0x80, 0x00, 0x40,
+0x0B, 0x40, 0x05, 0x40, 0xC0, 0x01, 0x30, 0xA1, 0x51, 0x70, 0xB0, 0x60, 0xB0, 0xF3, 0x21, 0xF0,
+0xD0, 0xB1, 0xD0, 0xF5, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xB0, 0xF1, 0x22, 0xF0,
+0x20, 0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x60, 0xF0, 0xD0, 0xF1, 0x23, 0xF5, 0x20, 0xF2, 0xD0, 0xF0,
+0xB0, 0x60, 0xF0, 0xD2, 0x30, 0xE0, 0xD0, 0x20, 0xF0, 0x60, 0xE0, 0x30, 0x60, 0x70, 0x30, 0x02,
+0x70, 0x01, 0xC0, 0xA0, 0x00, 0x30, 0xC0, 0x40, 0x70, 0x0F, 0x23, 0x0F, 0x24, 0xE0, 0x01, 0x30,
+0x90, 0x00, 0x90, 0xA0, 0x40, 0x00, 0xA0, 0xC0, 0xA0, 0x90, 0x00, 0xA0, 0x60, 0xD0, 0xF0, 0x21,
+0xF0, 0x22, 0xF0, 0xD0, 0x60, 0xB0, 0xF2, 0x21, 0xF0, 0x20, 0xF2, 0x26, 0xF1, 0xD0, 0x60, 0xF0,
+0xD0, 0xF0, 0x23, 0xF1, 0x22, 0xF3, 0x20, 0xF0, 0x60, 0xF2, 0x21, 0xF0, 0x22, 0xF6, 0x60, 0xD0,
+0xF1, 0x22, 0xF3, 0xD0, 0xB0, 0x60, 0xB0, 0x60, 0xD0, 0xF3, 0x21, 0xF0, 0x21, 0xF2, 0x60, 0xF2,
+0x21, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF1, 0x26, 0xF1, 0xB1, 0xF0, 0x26, 0xF1, 0x20, 0xB0, 0xD0,
+0x20, 0xF1, 0x21, 0xF1, 0xD1, 0xB1, 0xD0, 0xF3, 0x21, 0xF1, 0xD0, 0x60, 0xE0, 0x01, 0x50, 0x30,
+0x05, 0xC0, 0x50, 0x06, 0x70, 0x50, 0x01, 0x90, 0x0B, 0x90, 0x04, 0x81, 0xA0, 0x30, 0xE0, 0x40,
+0x01, 0x40, 0x50, 0x80, 0x60, 0xD1, 0xF0, 0x20, 0xF0, 0x22, 0xF1, 0xD0, 0x60, 0xF6, 0x21, 0xF1,
+0x21, 0xF2, 0x60, 0xF2, 0x20, 0xF1, 0x22, 0xF3, 0x22, 0xF1, 0x60, 0xF0, 0xD1, 0x23, 0xF8, 0xD3,
+0xB0, 0x60, 0xD0, 0xF0, 0xD1, 0xF0, 0xD0, 0x21, 0xD0, 0x60, 0xE1, 0x00, 0x50, 0x70, 0xC0, 0xE0,
+0x00, 0xA0, 0x90, 0x05, 0x70, 0x0F, 0x23, 0x0F, 0x24, 0x90, 0xE1, 0x70, 0x00, 0x70, 0xA0, 0x50,
+0xA0, 0x90, 0x00, 0x70, 0x90, 0x02, 0xE0, 0xB0, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0xD0, 0x60,
+0xB0, 0xD0, 0xF0, 0x25, 0xF1, 0x23, 0xF5, 0xB1, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0x20,
+0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF5, 0x21, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xF2,
+0x21, 0xF1, 0xD1, 0xF0, 0xB0, 0x60, 0xB0, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0xB1, 0xF0,
+0x22, 0xF2, 0x22, 0xF1, 0x60, 0x27, 0xF1, 0xD0, 0xB0, 0xF1, 0x26, 0xF0, 0xD0, 0xB1, 0xF0, 0x23,
+0xF3, 0xD0, 0xB1, 0xF1, 0x21, 0xF6, 0xA0, 0x80, 0x00, 0x90, 0x80, 0x06, 0x40, 0x06, 0xA0, 0x02,
+0x90, 0x0B, 0x51, 0x02, 0xC0, 0x70, 0x05, 0x50, 0x40, 0x50, 0xA0, 0x80, 0xD0, 0x23, 0xF0, 0x23,
+0xD0, 0xF0, 0x60, 0xD0, 0x20, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0xB0, 0x60, 0xF4,
+0x22, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0xB1, 0xF2, 0x22, 0xF6, 0xD1, 0x30, 0xA0, 0x30, 0xB0,
+0xD0, 0xB0, 0x60, 0xD1, 0xA0, 0x70, 0x30, 0xD0, 0xF0, 0xD0, 0x90, 0xE0, 0xC0, 0x01, 0x50, 0xE0,
+0xC0, 0x00, 0x30, 0x10, 0x80, 0x01, 0x50, 0xA0, 0x70, 0x40, 0x0F, 0x23, 0x0F, 0x25, 0xC0, 0x50,
+0x00, 0xE0, 0x80, 0x01, 0x40, 0x80, 0x00, 0xC0, 0xA0, 0x01, 0x80, 0x40, 0x70, 0xB0, 0xD0, 0xF0,
+0x20, 0xF1, 0xD0, 0x60, 0xB0, 0xD0, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x24, 0xF4, 0xB0, 0x60, 0xD0,
+0xF0, 0x24, 0xF1, 0x20, 0xF0, 0x22, 0xF3, 0x60, 0xF1, 0x20, 0xF0, 0x21, 0xF4, 0x21, 0xF1, 0xB0,
+0x60, 0xD0, 0x20, 0xF4, 0x21, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0xF0, 0xB1, 0x60, 0x20, 0xF4, 0x20,
+0xF1, 0x60, 0x20, 0xF0, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xF0, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0x60,
+0xF1, 0x26, 0xF0, 0xD0, 0xB0, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF3,
+0xD0, 0xF0, 0xB0, 0x30, 0x81, 0x50, 0x06, 0x40, 0x06, 0xA0, 0xC0, 0x01, 0xC0, 0x50, 0x0B, 0x40,
+0x02, 0x40, 0x80, 0x02, 0xC0, 0x91, 0x50, 0x00, 0x90, 0x70, 0x60, 0xD0, 0x23, 0xF0, 0x24, 0xF0,
+0xB1, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x20, 0xF1, 0x60, 0xB0, 0xF2, 0x24, 0xF0,
+0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF0, 0xD0, 0xF0, 0x21, 0xF5, 0xD1, 0x30, 0x70, 0xC0, 0xD0, 0xA0,
+0xB0, 0xD0, 0xB0, 0x61, 0x80, 0x00, 0xA0, 0xF0, 0xD1, 0x70, 0x40, 0x30, 0x01, 0x30, 0x50, 0x01,
+0x30, 0x50, 0xA0, 0x30, 0x01, 0x40, 0x50, 0x0F, 0x24, 0x0F, 0x27, 0x80, 0x30, 0x02, 0x10, 0xC0,
+0x80, 0x40, 0xC0, 0xA0, 0x30, 0x40, 0x01, 0x70, 0xF0, 0xD0, 0xF1, 0xD0, 0x60, 0xB0, 0xF0, 0x23,
+0xF1, 0x20, 0xF0, 0x24, 0xF4, 0xD0, 0xF0, 0x60, 0xD0, 0x21, 0xF0, 0x22, 0xF1, 0x22, 0xF1, 0x21,
+0xF0, 0xD0, 0x60, 0xF2, 0x23, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF0,
+0x24, 0xF0, 0xD0, 0xB0, 0x60, 0xD1, 0xF0, 0x20, 0xB0, 0x60, 0xB0, 0xF5, 0x60, 0xF0, 0x23, 0xF2,
+0x22, 0xF0, 0x60, 0xF0, 0x20, 0xF4, 0x21, 0xF1, 0xD0, 0x60, 0xF1, 0x21, 0xF0, 0x20, 0xF1, 0x20,
+0xF0, 0xD0, 0xB0, 0xF1, 0x23, 0xF0, 0x21, 0xF1, 0xB1, 0xF2, 0x23, 0xF0, 0x20, 0xF1, 0x60, 0xD0,
+0x80, 0x10, 0x07, 0x90, 0x04, 0xC0, 0xA0, 0x30, 0x03, 0x40, 0x0B, 0x90, 0xC0, 0x00, 0x40, 0x80,
+0x01, 0x50, 0x40, 0x90, 0xC0, 0x02, 0x50, 0x30, 0xD0, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF2, 0x24, 0xF3, 0x20, 0xF1, 0x60, 0xF2, 0x20, 0xF0, 0x28,
+0xF0, 0x20, 0xF1, 0x60, 0xB0, 0xD0, 0xF0, 0x21, 0xF5, 0xD0, 0xE1, 0x02, 0x40, 0x30, 0xD0, 0xF0,
+0xB0, 0x30, 0x80, 0x00, 0x30, 0x60, 0xD0, 0x70, 0xC0, 0x00, 0x50, 0xA0, 0x30, 0x90, 0x02, 0xC0,
+0x01, 0xA0, 0x70, 0x0F, 0x27, 0x0F, 0x27, 0x30, 0x90, 0x00, 0x50, 0x10, 0x92, 0x40, 0x51, 0xA0,
+0x02, 0x30, 0xE0, 0xB0, 0xD1, 0x60, 0xB0, 0xD0, 0x23, 0xF1, 0x20, 0xD0, 0x25, 0xF5, 0x60, 0xF2,
+0x22, 0xF1, 0x22, 0xF2, 0x21, 0xF1, 0x60, 0xB0, 0xD0, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0x21, 0xF1,
+0xB1, 0xD0, 0x23, 0xF1, 0x23, 0xF2, 0x60, 0xF1, 0x21, 0xF0, 0xD0, 0xF0, 0xB0, 0x61, 0x20, 0xD1,
+0xB1, 0xD0, 0xF0, 0x22, 0xF3, 0x20, 0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF3, 0x21, 0xF1, 0xD0, 0x60,
+0xF0, 0x20, 0xF7, 0xD0, 0x60, 0xF1, 0x21, 0xF0, 0x23, 0xF1, 0xB1, 0xF1, 0x26, 0xF0, 0xD0, 0x60,
+0xD1, 0x60, 0x70, 0xC0, 0x05, 0x90, 0x04, 0xE0, 0x90, 0x40, 0x70, 0x90, 0x01, 0x90, 0x0A, 0xC0,
+0x80, 0xC0, 0x81, 0x00, 0x90, 0x40, 0x50, 0x05, 0x80, 0x60, 0xF6, 0x24, 0xF1, 0xB1, 0xD0, 0xF0,
+0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xB0, 0x60, 0xD0, 0xF1, 0x28, 0xF0, 0x20, 0xF0,
+0x20, 0xF1, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF6, 0x30, 0x02, 0xC0, 0xE0, 0xD1, 0xF0, 0xD1, 0xA0,
+0x10, 0x70, 0x11, 0xA0, 0x02, 0x30, 0x40, 0x07, 0x80, 0x40, 0x0F, 0x26, 0x0F, 0x27, 0xC0, 0x72,
+0x50, 0x01, 0x31, 0x01, 0x40, 0x30, 0x00, 0xA0, 0x90, 0x00, 0x70, 0xD0, 0x60, 0xB0, 0xD0, 0xF1,
+0x22, 0xF3, 0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x60, 0xF2, 0x23, 0xF0, 0x23, 0xF4, 0xD0, 0xB0,
+0x60, 0xD0, 0xF0, 0x24, 0xF1, 0x23, 0xF1, 0xD0, 0x60, 0xF1, 0x23, 0xF1, 0x20, 0xF0, 0x20, 0xF0,
+0x20, 0xD0, 0xF0, 0x60, 0xF0, 0x21, 0xF5, 0x20, 0x61, 0xB0, 0x60, 0xF4, 0x20, 0xF3, 0x20, 0xF1,
+0x60, 0xF1, 0x20, 0xF4, 0x20, 0xF2, 0x60, 0xF9, 0xD0, 0x60, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xB1,
+0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xD0, 0xF0, 0xD0, 0xB0, 0xA0, 0x80, 0x04, 0x50, 0xC0,
+0x01, 0xC0, 0x30, 0x80, 0x02, 0x31, 0x50, 0xC0, 0x40, 0xC0, 0x08, 0xA0, 0x40, 0x31, 0x50, 0x90,
+0xC0, 0x07, 0x10, 0xB1, 0xF3, 0x22, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF2, 0x23, 0xF0, 0x25, 0xF1,
+0xB1, 0xF2, 0x24, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0xD0, 0x60, 0xF0, 0xD0, 0xF4, 0xD1, 0x30, 0x90,
+0x00, 0xC0, 0x30, 0x10, 0x60, 0xD0, 0xF1, 0xD1, 0x40, 0x70, 0x30, 0x10, 0x51, 0xA0, 0x00, 0x40,
+0x80, 0x0F, 0x31, 0x0F, 0x29, 0x50, 0x08, 0x40, 0x10, 0x90, 0x02, 0x10, 0x60, 0xD0, 0xF3, 0x20,
+0xF1, 0x20, 0xF2, 0x20, 0xF1, 0x22, 0xF2, 0x60, 0xB0, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF3, 0x20,
+0xF0, 0xD0, 0xF0, 0x60, 0xF0, 0x20, 0xF0, 0x23, 0xF2, 0x23, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x24,
+0xF1, 0x20, 0xF1, 0xD0, 0xF0, 0x60, 0x23, 0xF6, 0xD0, 0xF0, 0xB0, 0x61, 0xB0, 0xF1, 0xD0, 0xF2,
+0x20, 0xF1, 0xD0, 0xB1, 0xF0, 0x21, 0xF2, 0x23, 0xF0, 0xB1, 0xF9, 0xD0, 0x60, 0xF1, 0x20, 0xF0,
+0x23, 0xF2, 0xB1, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF2, 0xD1, 0x80, 0x70, 0x40, 0x50,
+0xC0, 0x50, 0x40, 0x90, 0x01, 0x70, 0x50, 0x04, 0x50, 0x70, 0xA0, 0x80, 0x71, 0x90, 0x03, 0x80,
+0xA0, 0xE0, 0x90, 0x50, 0x40, 0x50, 0x0A, 0xA0, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x23,
+0xF0, 0xB1, 0xF2, 0x22, 0xF0, 0x25, 0xF2, 0x60, 0xF3, 0x23, 0xF1, 0x21, 0xF1, 0x21, 0xF0, 0xD0,
+0xF0, 0x60, 0xF0, 0xD0, 0xF2, 0xD0, 0x60, 0x70, 0x80, 0x00, 0x40, 0x10, 0x30, 0xB0, 0xD0, 0xF0,
+0xD1, 0xF0, 0x31, 0xC0, 0x10, 0x90, 0x01, 0x50, 0xE0, 0x80, 0x0F, 0x32, 0x0F, 0x34, 0x40, 0x80,
+0x01, 0x30, 0x40, 0x70, 0xB0, 0xD1, 0x23, 0xF1, 0x25, 0xF4, 0xB1, 0xD0, 0xF1, 0x22, 0xF2, 0x23,
+0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0xD0, 0x24, 0xF2, 0x22, 0xF2, 0x60, 0xD0, 0xF1, 0x24, 0xF1,
+0x21, 0xF2, 0x60, 0xD0, 0xF0, 0x21, 0xF7, 0xD0, 0xB1, 0x20, 0xB0, 0x61, 0xB0, 0xF0, 0xD2, 0xF0,
+0x20, 0xD0, 0x60, 0x20, 0xF0, 0x27, 0xF1, 0xB0, 0x26, 0xF1, 0x20, 0xF1, 0x60, 0xF1, 0x21, 0xF0,
+0x22, 0xF1, 0xD0, 0xB1, 0xF1, 0x26, 0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF0, 0xD1, 0x60, 0x30, 0xA0,
+0x30, 0x80, 0x30, 0xA0, 0x10, 0x08, 0xC0, 0x90, 0x00, 0x40, 0x50, 0x03, 0xA0, 0x50, 0x90, 0x50,
+0x01, 0x90, 0x0A, 0xA0, 0xD0, 0x60, 0xB0, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0x60,
+0xF2, 0x22, 0xF0, 0x25, 0xF1, 0xD0, 0x20, 0x60, 0xD0, 0x20, 0xF1, 0x20, 0xF2, 0x22, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0xB0, 0x60, 0xD3, 0x60, 0xA0, 0xC0, 0x01, 0x10, 0x60, 0xD0, 0xF1, 0xD1, 0xA1,
+0x40, 0x00, 0x10, 0x80, 0x30, 0x01, 0x40, 0x80, 0x0F, 0x33, 0x0F, 0x35, 0x40, 0x80, 0x30, 0x40,
+0x01, 0x70, 0xB0, 0xD0, 0xF3, 0x28, 0xF1, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF4, 0x24,
+0xF0, 0xD0, 0xB1, 0xD1, 0x24, 0xF3, 0x22, 0xF0, 0xD0, 0x60, 0xF4, 0x23, 0xF2, 0x20, 0xF1, 0xB0,
+0xF2, 0x22, 0xF3, 0x22, 0xD0, 0x60, 0xF1, 0xD1, 0xF0, 0xB0, 0x61, 0xB0, 0xF1, 0xD0, 0xF0, 0x60,
+0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x23, 0xF0, 0x60, 0xD0, 0xF0, 0x27, 0xF0, 0xD0, 0x60, 0xF1,
+0x21, 0xF1, 0x21, 0xF1, 0xD0, 0xB1, 0xF2, 0x21, 0xF0, 0x23, 0xF0, 0x60, 0xF1, 0x21, 0xF2, 0xD4,
+0x60, 0xD0, 0xB0, 0x70, 0x80, 0x90, 0x50, 0x05, 0x90, 0x00, 0xA0, 0x40, 0x00, 0x50, 0x40, 0x90,
+0x80, 0x50, 0x03, 0x40, 0x0A, 0xA0, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x25, 0xF2, 0x60,
+0xD0, 0xF1, 0x29, 0xF1, 0xD0, 0xB1, 0xF7, 0x21, 0xF7, 0xB0, 0x60, 0xD1, 0x60, 0xA0, 0x02, 0x41,
+0xA0, 0xD2, 0xF0, 0x70, 0x90, 0x01, 0xE0, 0x90, 0x00, 0x50, 0xA0, 0x81, 0x0F, 0x34, 0x0F, 0x36,
+0x40, 0xA0, 0x02, 0x30, 0x70, 0xB0, 0xD0, 0xF2, 0x26, 0xF0, 0x20, 0xF0, 0xD0, 0xF0, 0x60, 0xF1,
+0x22, 0xF1, 0x20, 0xF2, 0x24, 0xF2, 0x60, 0xF0, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF4, 0x20, 0xF0,
+0x20, 0xF1, 0x60, 0xD0, 0x20, 0xF2, 0x23, 0xF5, 0x60, 0xD0, 0xF1, 0x23, 0xF2, 0x20, 0xF2, 0x60,
+0xF0, 0x22, 0xF3, 0xB0, 0x61, 0xB1, 0x60, 0xD1, 0xF3, 0x20, 0xF4, 0x60, 0xD0, 0xF7, 0x20, 0xF0,
+0xD0, 0x60, 0xF0, 0x23, 0xF0, 0x21, 0xF1, 0xD0, 0xB1, 0xF2, 0x21, 0xF0, 0x23, 0xF0, 0x60, 0xF2,
+0x20, 0xF3, 0x20, 0xF1, 0xD0, 0x60, 0xF0, 0xD1, 0x60, 0x80, 0x30, 0xA0, 0x30, 0x90, 0x00, 0x40,
+0x00, 0xC0, 0x50, 0x31, 0xA0, 0xC0, 0x00, 0x80, 0x70, 0xC0, 0x03, 0x50, 0xC0, 0x09, 0x40, 0x60,
+0xD0, 0xB0, 0xF0, 0xD0, 0x21, 0xF0, 0x24, 0xF0, 0x22, 0xD0, 0xB1, 0xD0, 0xF0, 0x28, 0xF0, 0x20,
+0xF1, 0xD0, 0x60, 0x20, 0xF6, 0x24, 0xF1, 0x20, 0xF0, 0xD1, 0xB1, 0x60, 0xA0, 0x02, 0x50, 0x70,
+0x00, 0x50, 0xE0, 0x80, 0x30, 0xA0, 0xC0, 0x01, 0xE0, 0x70, 0x02, 0x81, 0x0F, 0x35, 0x0F, 0x37,
+0x40, 0x80, 0x00, 0x30, 0x90, 0x00, 0x70, 0xB0, 0xD1, 0x24, 0xF0, 0x22, 0xF2, 0x60, 0xF1, 0x24,
+0xF4, 0x23, 0xF2, 0x60, 0xF3, 0x20, 0xF0, 0x21, 0xF3, 0x21, 0xF1, 0xD0, 0x60, 0x20, 0xF0, 0x20,
+0xF3, 0x22, 0xF3, 0xD0, 0xB1, 0xF2, 0x23, 0xF2, 0x21, 0xD0, 0x60, 0xF2, 0x24, 0xF0, 0xD1, 0xF0,
+0xB0, 0x62, 0xB1, 0xF8, 0x60, 0xD0, 0xF6, 0x21, 0xF1, 0x60, 0xF0, 0x23, 0xF0, 0x21, 0xF1, 0xD0,
+0xB1, 0xF3, 0x20, 0xF0, 0x23, 0xF0, 0xB1, 0xF7, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0xD3, 0xF0,
+0x30, 0x70, 0x10, 0x30, 0x80, 0x31, 0x90, 0x70, 0x40, 0xC0, 0xA0, 0x06, 0x40, 0x09, 0xE0, 0x60,
+0xD0, 0xF0, 0x60, 0xD0, 0x20, 0xF0, 0x24, 0xF1, 0x21, 0xF2, 0x60, 0xD0, 0xF0, 0x29, 0xF0, 0x21,
+0xF1, 0x60, 0xF8, 0x21, 0xF2, 0xD0, 0x60, 0x34, 0x02, 0xC0, 0xA0, 0x02, 0x80, 0xA1, 0x02, 0x10,
+0x51, 0xA0, 0x00, 0x40, 0x80, 0x0F, 0x36, 0x0F, 0x38, 0x40, 0xE0, 0x40, 0x02, 0xE0, 0x60, 0xD1,
+0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0xF2, 0x22, 0xF0, 0x20, 0xF2, 0x24, 0xF2,
+0xB1, 0xD1, 0x20, 0xF1, 0x22, 0xF3, 0x20, 0xF1, 0xD0, 0xB1, 0xF0, 0x22, 0xF2, 0x22, 0xF3, 0xD0,
+0x60, 0xD0, 0xF3, 0x22, 0xF2, 0x21, 0xF0, 0x60, 0xF6, 0x21, 0xF2, 0xD0, 0x60, 0xF1, 0xB1, 0x61,
+0xB0, 0xF2, 0xD1, 0xF0, 0xB0, 0xF1, 0x27, 0xF1, 0x60, 0xF0, 0x22, 0xF1, 0x21, 0xF1, 0xD0, 0xB1,
+0xF3, 0x20, 0xF4, 0xD0, 0xB1, 0xF5, 0x23, 0xD0, 0xB1, 0xD0, 0xF1, 0xD0, 0xB1, 0x60, 0xB1, 0xF2,
+0x60, 0xD0, 0x71, 0xE0, 0x80, 0x50, 0x06, 0x40, 0x08, 0xC0, 0x10, 0x80, 0xD1, 0x60, 0xF1, 0x25,
+0xF1, 0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x23, 0xF2, 0x23, 0xF0, 0x20, 0xF0, 0xB1, 0xF6, 0x22, 0xF0,
+0xD2, 0x70, 0xC0, 0x90, 0x50, 0x00, 0x90, 0x02, 0x80, 0x90, 0x03, 0x10, 0x80, 0x01, 0x10, 0xC0,
+0x01, 0x50, 0xE0, 0x80, 0x0F, 0x37, 0x0F, 0x39, 0x40, 0x80, 0x01, 0x30, 0x90, 0xA0, 0x60, 0xD0,
+0xF1, 0x20, 0xF0, 0x20, 0xF3, 0x60, 0xF2, 0x24, 0xF2, 0x20, 0xF0, 0x22, 0xF3, 0x60, 0xD0, 0xF3,
+0x23, 0xF2, 0x21, 0xF0, 0xD1, 0x60, 0xF2, 0x21, 0xF3, 0x22, 0xF1, 0xD0, 0xB1, 0xF4, 0x22, 0xF5,
+0xB0, 0xD1, 0xF5, 0x21, 0xF2, 0x60, 0xD0, 0xF1, 0xD2, 0xF0, 0xB1, 0x61, 0xB0, 0x60, 0xB0, 0xD0,
+0xFA, 0xB0, 0xD0, 0xF3, 0x22, 0xF1, 0xD0, 0xB1, 0xF2, 0x21, 0xF4, 0xD0, 0xB1, 0xF8, 0xD1, 0xB0,
+0x60, 0xB0, 0x62, 0xB1, 0xD2, 0xF1, 0xD0, 0x60, 0xF0, 0x60, 0xA0, 0xC0, 0x08, 0x51, 0x07, 0x40,
+0x10, 0xA0, 0xD0, 0xF1, 0xB0, 0xF2, 0x22, 0xF1, 0x25, 0xD0, 0x60, 0xF2, 0x21, 0xF3, 0x24, 0xF1,
+0xD0, 0x60, 0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x20, 0xD0, 0xB0, 0x30, 0x60, 0x40, 0x70, 0x04, 0x40,
+0x01, 0xA0, 0x04, 0x30, 0x70, 0x50, 0x10, 0x90, 0xA0, 0x01, 0x40, 0x80, 0x0F, 0x38, 0x0F, 0x3A,
+0x40, 0x30, 0x80, 0x40, 0x01, 0x30, 0x80, 0xD0, 0xF1, 0x21, 0xF1, 0xD0, 0x60, 0xB0, 0xF1, 0x23,
+0xF4, 0x23, 0xF3, 0x60, 0xF2, 0x27, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xD0, 0xB1, 0xF0, 0x21, 0xF0,
+0x20, 0xF0, 0x20, 0xF6, 0xD0, 0x60, 0xD0, 0xF4, 0x22, 0xF1, 0x20, 0xF0, 0xD0, 0x60, 0xF3, 0x23,
+0xF0, 0x22, 0xF0, 0xB1, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xB0, 0x62, 0xB2, 0xF2,
+0xD1, 0xB1, 0xD2, 0xF7, 0xB1, 0xF3, 0x21, 0xF2, 0xD1, 0xB1, 0xD1, 0xF2, 0xB2, 0x64, 0xF8, 0x20,
+0xF2, 0xB0, 0xD1, 0x70, 0x40, 0x02, 0x90, 0x30, 0x03, 0x90, 0x07, 0xC0, 0x70, 0xD0, 0xF1, 0xD0,
+0x60, 0xF2, 0x20, 0xF1, 0x26, 0xF2, 0x60, 0xD0, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0x24, 0xF2, 0x60,
+0xF2, 0x21, 0xF1, 0xD0, 0xF0, 0x70, 0xD0, 0x70, 0x10, 0x80, 0x04, 0xC0, 0x90, 0x40, 0x90, 0x03,
+0xC0, 0xA0, 0x70, 0xE0, 0xC0, 0x00, 0x90, 0x30, 0x81, 0x0F, 0x39, 0x0F, 0x3B, 0x90, 0xE0, 0x02,
+0x30, 0xA0, 0x30, 0xD1, 0x20, 0xF1, 0xD0, 0xB1, 0xD0, 0xF1, 0x23, 0xF3, 0x23, 0xF2, 0xD0, 0xB1,
+0xF2, 0x26, 0xF0, 0x22, 0xF2, 0x60, 0xF2, 0x21, 0xF0, 0x21, 0xF5, 0xD0, 0xB1, 0xD0, 0xF5, 0x22,
+0xF3, 0x60, 0xD0, 0xF1, 0x24, 0xF1, 0x21, 0xD0, 0xB0, 0xF2, 0x20, 0xF0, 0x24, 0xF1, 0xD0, 0x60,
+0xD0, 0xF2, 0xB3, 0x65, 0xB2, 0xF0, 0x25, 0xF0, 0xB1, 0xF1, 0x23, 0xF2, 0xB1, 0x61, 0xB0, 0x63,
+0xB2, 0xF3, 0x60, 0xD0, 0xF1, 0x23, 0xF1, 0x20, 0xF2, 0x60, 0xF0, 0xD1, 0xA0, 0x30, 0x00, 0x40,
+0x10, 0x70, 0xE0, 0x02, 0x90, 0xC0, 0x06, 0x80, 0x10, 0xD0, 0xF3, 0xB0, 0xF3, 0x20, 0xF1, 0x22,
+0xF0, 0x21, 0xF1, 0xB1, 0xF2, 0x20, 0xF1, 0x26, 0xF2, 0x20, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0xD1,
+0x70, 0xC0, 0x00, 0x40, 0xE0, 0x50, 0x05, 0xC0, 0x30, 0x04, 0x30, 0xA0, 0xE0, 0xA0, 0x02, 0xA0,
+0x40, 0x0F, 0x3A, 0x0F, 0x3C, 0x50, 0x70, 0x00, 0x80, 0x40, 0x00, 0x80, 0x30, 0xD1, 0xF1, 0xB0,
+0x60, 0xD0, 0xF2, 0x20, 0xF6, 0x23, 0xF3, 0x60, 0xF2, 0x2A, 0xF0, 0x20, 0xD0, 0x60, 0xB0, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF5, 0x60, 0xF1, 0x20, 0xF4, 0x21, 0xF3, 0xB1, 0xF2, 0x23, 0xF2,
+0x20, 0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xD1, 0xF8, 0xD0, 0x60,
+0xB9, 0x60, 0xB0, 0x61, 0xB0, 0x62, 0xB7, 0x60, 0xF0, 0x20, 0xF7, 0xD1, 0x60, 0xF0, 0x24, 0xF2,
+0x21, 0xF0, 0xD0, 0x60, 0xF2, 0xD0, 0x60, 0x70, 0xC1, 0x70, 0x80, 0xC0, 0x70, 0x80, 0xC0, 0x50,
+0x06, 0x80, 0x70, 0xD0, 0xF3, 0x60, 0xD0, 0x20, 0xF3, 0x23, 0xF0, 0x22, 0xF1, 0x60, 0xF0, 0x20,
+0xF3, 0x26, 0xF2, 0xD0, 0x60, 0xB0, 0xF3, 0xD0, 0xE0, 0xC0, 0x0B, 0x30, 0x50, 0x02, 0xC0, 0x10,
+0xE0, 0x00, 0x90, 0x30, 0x00, 0xA0, 0x90, 0x0F, 0x3B, 0x0F, 0x3D, 0xC0, 0x10, 0x80, 0x02, 0xE0,
+0x70, 0xD1, 0xF0, 0x60, 0xD1, 0xF1, 0x20, 0xF7, 0x23, 0xF1, 0xD0, 0x60, 0xD0, 0xF2, 0x29, 0xF1,
+0xD0, 0xB0, 0x60, 0xD0, 0x22, 0xF0, 0x24, 0xF4, 0xB1, 0xF3, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF0,
+0xD0, 0x60, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0x21, 0xF1, 0x60, 0xF0, 0x22, 0xF3, 0x20, 0xF1, 0xD0,
+0xB0, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xF7, 0x60, 0xF1, 0xD0, 0xF1, 0xD4, 0xF0, 0xD0, 0xB1, 0xD0,
+0xF0, 0xD4, 0xF1, 0xD0, 0xF1, 0x60, 0xF1, 0x27, 0xF1, 0xB1, 0xF0, 0x22, 0xF3, 0x21, 0xF0, 0xD0,
+0x60, 0xF3, 0xD1, 0xE0, 0x02, 0xA0, 0x90, 0x80, 0xA0, 0x80, 0x06, 0xC0, 0x70, 0xD0, 0xF0, 0x20,
+0xF0, 0xD0, 0xB1, 0xF4, 0x23, 0xF0, 0x20, 0xF0, 0x21, 0xD0, 0xB1, 0xF3, 0x27, 0xF2, 0xD1, 0x60,
+0x20, 0xF1, 0xD0, 0xA0, 0x50, 0x0C, 0x30, 0x40, 0xC0, 0x01, 0x70, 0x10, 0x02, 0x90, 0x10, 0x51,
+0x30, 0x80, 0x0F, 0x39, 0x0F, 0x3F, 0xA0, 0x50, 0x00, 0x30, 0x90, 0x50, 0x70, 0xD0, 0x60, 0xF1,
+0x20, 0xF0, 0x21, 0xD0, 0xF6, 0x22, 0xF1, 0xD0, 0x60, 0xF0, 0xD0, 0xF1, 0x2C, 0xD0, 0x60, 0x20,
+0xF2, 0x26, 0xF4, 0x60, 0xF2, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x60, 0x22,
+0xF2, 0x21, 0xF0, 0x22, 0xF0, 0xB1, 0xF0, 0x22, 0xF3, 0x20, 0xF1, 0xD0, 0xB1, 0xD0, 0xF2, 0x26,
+0xF0, 0x60, 0xD0, 0xF1, 0x21, 0xF5, 0xD0, 0xB1, 0xD1, 0xF4, 0x20, 0xF2, 0xD0, 0x60, 0xF0, 0x22,
+0xF1, 0x21, 0xF1, 0x20, 0xF1, 0xB0, 0xF0, 0x21, 0xF4, 0x21, 0xF1, 0xB0, 0x60, 0xF0, 0x21, 0xF1,
+0xB0, 0x70, 0x01, 0x40, 0x80, 0x50, 0xD0, 0x80, 0x30, 0x06, 0x70, 0xF2, 0x20, 0xF0, 0xD0, 0x60,
+0xD0, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x60, 0xD0, 0xF3, 0x27, 0xF1, 0x20, 0xF0, 0x20,
+0x60, 0xF0, 0xD1, 0x70, 0x0D, 0xA0, 0x00, 0x90, 0x00, 0x70, 0x80, 0xC0, 0xA0, 0x00, 0xC0, 0xA0,
+0xC0, 0x00, 0x80, 0x50, 0xA0, 0x0F, 0x39, 0x0F, 0x3D, 0xC0, 0x01, 0xA0, 0x80, 0x40, 0x01, 0x80,
+0x10, 0x60, 0xD0, 0xF1, 0x21, 0xF8, 0x22, 0xF0, 0xD0, 0xB1, 0xF2, 0x25, 0xF2, 0x23, 0xD0, 0xB1,
+0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF0, 0x20, 0xF3, 0xB1, 0xD0, 0xF1, 0x21, 0xF0, 0x21, 0xF1,
+0x20, 0xF1, 0xD0, 0xB1, 0x22, 0xF1, 0x22, 0xF0, 0x22, 0xF0, 0x60, 0xF1, 0x22, 0xF3, 0x21, 0xF1,
+0xB1, 0xD0, 0xF6, 0x22, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0xD0, 0xB1, 0xD0, 0xF0,
+0x22, 0xF5, 0xD0, 0x60, 0xF1, 0x21, 0xF1, 0x25, 0xF0, 0x60, 0xF1, 0x20, 0xF3, 0x22, 0xF2, 0x60,
+0xF0, 0x20, 0xF0, 0x20, 0xD1, 0x60, 0x70, 0x90, 0x00, 0xA0, 0xE0, 0x30, 0xD0, 0x31, 0x04, 0x30,
+0x60, 0xD0, 0xF1, 0x20, 0xF1, 0xB1, 0xD0, 0xF0, 0x23, 0xF1, 0x20, 0xF0, 0x21, 0xF1, 0xD0, 0xB1,
+0xD0, 0x20, 0xF1, 0x29, 0xF0, 0xD0, 0xF0, 0xB1, 0xD0, 0x60, 0xE0, 0x0D, 0xA0, 0x00, 0xC0, 0x10,
+0xA0, 0x01, 0x90, 0x31, 0x50, 0x80, 0x90, 0xC0, 0x30, 0x90, 0x0F, 0x39, 0x0F, 0x3C, 0x90, 0xE0,
+0x70, 0x80, 0x00, 0x70, 0x50, 0x00, 0xC0, 0x10, 0xE0, 0xA0, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x22,
+0xF3, 0x20, 0xF3, 0x60, 0xF1, 0x26, 0xF3, 0x22, 0xF1, 0x60, 0xF0, 0x22, 0xF2, 0x21, 0xF1, 0x20,
+0xF3, 0xB0, 0xF2, 0x22, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x60, 0xF3, 0x23, 0xF2, 0x22, 0x60, 0xD0,
+0xF0, 0x22, 0xF2, 0x22, 0xF1, 0x60, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF1, 0x60, 0xD0, 0xF1,
+0x21, 0xF2, 0x20, 0xF2, 0xB1, 0xF4, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0x60, 0xF6, 0x21, 0xF3, 0x60,
+0xF1, 0x21, 0xF2, 0x23, 0xF0, 0xD0, 0xB0, 0xF3, 0x20, 0xF0, 0xD0, 0xF0, 0xA0, 0x81, 0x70, 0x30,
+0x50, 0x40, 0x30, 0x80, 0x03, 0x30, 0xB0, 0xD0, 0xF1, 0x20, 0xF2, 0x60, 0xF1, 0x23, 0xF1, 0x21,
+0xF0, 0x21, 0xF1, 0xD0, 0x60, 0xF2, 0x24, 0xF1, 0x25, 0xF1, 0x60, 0xF0, 0xB0, 0xE0, 0x0C, 0x50,
+0x40, 0x50, 0x10, 0x70, 0x10, 0x90, 0x00, 0xC0, 0xE0, 0xC0, 0x70, 0x40, 0x70, 0xA0, 0x0F, 0x3B,
+0x0F, 0x3F, 0x70, 0x50, 0x00, 0x80, 0x30, 0x11, 0x01, 0x80, 0xA0, 0xD0, 0xF2, 0x23, 0xF6, 0xD0,
+0x60, 0xF0, 0xD0, 0xF0, 0x26, 0xF2, 0x23, 0xF0, 0x60, 0xB0, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF0,
+0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF1, 0x21, 0xF0, 0x60,
+0xF0, 0xD0, 0x20, 0xF0, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x60, 0xD0, 0xF1, 0x21, 0xF1,
+0x24, 0xF0, 0x60, 0xF1, 0x23, 0xF3, 0x21, 0xF0, 0x60, 0xD0, 0xF5, 0x22, 0xF1, 0xB1, 0xF1, 0x23,
+0xF4, 0xD0, 0xB0, 0xF5, 0x23, 0xF2, 0x60, 0xD0, 0x21, 0xF4, 0x22, 0xF1, 0xB1, 0xF2, 0x21, 0xF0,
+0xD1, 0x60, 0x30, 0xE0, 0x10, 0x70, 0x30, 0x40, 0xE0, 0x40, 0x90, 0x01, 0xC0, 0x70, 0xF0, 0xD0,
+0xF0, 0x21, 0xF1, 0xB0, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0,
+0x23, 0xF3, 0x24, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xA0, 0x0C, 0xA0, 0x80, 0x70, 0x01, 0x11, 0x30,
+0xA0, 0x00, 0x50, 0xA0, 0x01, 0x30, 0xA0, 0x0F, 0x3A, 0x0F, 0x3E, 0xC0, 0xE0, 0xC0, 0x90, 0x50,
+0x40, 0x10, 0x50, 0x01, 0x30, 0x80, 0xA0, 0xD1, 0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0xD0,
+0xB1, 0xD0, 0xF1, 0x20, 0xF4, 0x21, 0xF1, 0x20, 0xF3, 0x60, 0xD0, 0x22, 0xF7, 0x22, 0xF0, 0x60,
+0xF3, 0x24, 0xF2, 0x20, 0xF1, 0x60, 0xF2, 0x21, 0xF1, 0x24, 0xF0, 0xD0, 0xB1, 0xF1, 0x27, 0xF2,
+0x60, 0xD0, 0xF0, 0x22, 0xF3, 0x21, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22,
+0xF2, 0xB1, 0xF1, 0x23, 0xF1, 0x21, 0xF1, 0xB0, 0xF3, 0x23, 0xF3, 0xD0, 0x60, 0xF2, 0x28, 0xF0,
+0xB1, 0xD0, 0xF0, 0x20, 0xF4, 0xD0, 0xA0, 0x80, 0x00, 0x90, 0x30, 0xA0, 0x30, 0x50, 0x80, 0x70,
+0x90, 0xC0, 0xA0, 0xE0, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0xF0, 0x22, 0xF3, 0x24, 0xF0,
+0x20, 0xD0, 0xB1, 0xD0, 0xF1, 0x22, 0xF3, 0x25, 0xF0, 0xB0, 0x60, 0x70, 0x0C, 0x10, 0xA0, 0x30,
+0x01, 0xC0, 0x10, 0x80, 0xC0, 0x01, 0xE0, 0xC0, 0x01, 0x70, 0x90, 0x0F, 0x39, 0x0F, 0x39, 0x50,
+0xA0, 0x72, 0xE0, 0x40, 0x50, 0x70, 0xA0, 0x80, 0xC0, 0xA0, 0x00, 0x41, 0x00, 0x90, 0xA0, 0xB0,
+0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF3, 0x23,
+0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF6, 0x23, 0xF0, 0x60, 0xF3, 0x24, 0xF1, 0x22, 0xF0,
+0x60, 0xF1, 0x22, 0xF1, 0x23, 0xF1, 0xD0, 0x60, 0xF1, 0x22, 0xF0, 0x23, 0xF1, 0xD0, 0xF0, 0xB0,
+0xF1, 0x22, 0xF2, 0x22, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xB1,
+0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0xF1, 0x22, 0xF2, 0x21, 0xF0, 0xB0, 0xF2, 0x29, 0xF0,
+0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF2, 0x10, 0x40, 0x02, 0x40, 0x02, 0xC0, 0x81, 0x90, 0xA0, 0x60,
+0xD1, 0xF2, 0xD0, 0x60, 0x20, 0xD0, 0x20, 0xF0, 0x21, 0xF1, 0x23, 0xF4, 0x60, 0xF0, 0xD0, 0xF1,
+0x22, 0xF3, 0x20, 0xF1, 0x20, 0xF1, 0xD0, 0x60, 0xA0, 0x50, 0x09, 0xC0, 0x70, 0x80, 0x00, 0x90,
+0x30, 0x00, 0x30, 0x90, 0x00, 0xE0, 0x80, 0x00, 0x90, 0xE0, 0x01, 0x90, 0x30, 0x0F, 0x39, 0x0F,
+0x39, 0x50, 0x10, 0x40, 0x06, 0xA0, 0x50, 0x00, 0x70, 0x30, 0x02, 0xA0, 0x70, 0x60, 0xD0, 0xF2,
+0x22, 0xF2, 0x60, 0xF1, 0x24, 0xF2, 0x25, 0xF2, 0x60, 0xD0, 0xF0, 0x24, 0xF4, 0x22, 0xF0, 0xB1,
+0xF3, 0x24, 0xF4, 0x20, 0xB0, 0xD0, 0xF0, 0x21, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x60, 0xD0, 0xF0,
+0x27, 0xF1, 0xD0, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF2,
+0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0xF1, 0x22, 0xF2, 0x21, 0xF1, 0x60, 0xD0, 0xF0,
+0x29, 0xF0, 0xB0, 0xF1, 0x22, 0xF1, 0x20, 0xD1, 0x70, 0xC0, 0x01, 0x51, 0x05, 0xC0, 0x70, 0xD0,
+0xF5, 0x60, 0xD0, 0xF0, 0x21, 0xF3, 0x24, 0xF1, 0xD0, 0xB1, 0xF1, 0x24, 0xF1, 0x22, 0xF2, 0xD0,
+0x30, 0xA0, 0x80, 0x09, 0x50, 0x10, 0xE0, 0x02, 0x80, 0xE0, 0xC0, 0x01, 0xA0, 0xE0, 0x90, 0x00,
+0x80, 0x70, 0x50, 0x30, 0x40, 0x0F, 0x39, 0x0F, 0x3B, 0x70, 0x80, 0x04, 0x90, 0xE0, 0xC0, 0x01,
+0x30, 0x40, 0x00, 0x30, 0x90, 0x00, 0x31, 0xD1, 0xF0, 0x23, 0xD0, 0xB1, 0xD0, 0xF0, 0x24, 0xF1,
+0x21, 0xF4, 0x20, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x23, 0xF2, 0x20, 0xF0, 0x20, 0xF1, 0x60, 0xD0,
+0xF3, 0x24, 0xF0, 0x20, 0xF0, 0x20, 0xD0, 0x60, 0xF2, 0x20, 0xF3, 0x22, 0xF0, 0x20, 0xF0, 0xB1,
+0xF1, 0x28, 0xF1, 0xB0, 0xF1, 0x23, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0xF0, 0x20, 0xF2, 0x22, 0xF2,
+0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xD0, 0xF1, 0x22, 0xF2, 0x21, 0xF1, 0x60, 0xD0, 0xF1,
+0x21, 0xF1, 0x22, 0xF2, 0xB1, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0xD0, 0x81, 0x03, 0x40, 0x06, 0x50,
+0x70, 0xD1, 0xF0, 0x21, 0xD0, 0x60, 0xB0, 0xF1, 0x22, 0xF0, 0xD0, 0x20, 0xF1, 0x21, 0xD3, 0x60,
+0xD2, 0xF0, 0x20, 0xF5, 0x20, 0xF1, 0xD0, 0x30, 0x80, 0x00, 0xC0, 0x40, 0x07, 0x80, 0xE0, 0x00,
+0xC0, 0xA0, 0x00, 0x50, 0xA0, 0x03, 0xA0, 0xC0, 0xE0, 0x40, 0x50, 0x90, 0xA0, 0x40, 0x0F, 0x3A,
+0x0F, 0x3C, 0x80, 0x40, 0xE3, 0xA0, 0xC0, 0x50, 0xE0, 0xA0, 0xC0, 0x80, 0xA0, 0x80, 0x02, 0x70,
+0xA0, 0xB0, 0xD0, 0x20, 0xF2, 0xB1, 0xD0, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF4, 0xD0, 0xB1, 0xF1,
+0x20, 0xF2, 0x22, 0xF2, 0x21, 0xF0, 0xD0, 0xB1, 0xF2, 0x28, 0xF2, 0x60, 0xD0, 0xF0, 0x21, 0xF1,
+0x24, 0xF0, 0x21, 0xB1, 0xF0, 0x29, 0xF1, 0x60, 0x20, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0xB1, 0xD0,
+0xF0, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF1, 0xB0, 0xD0, 0xF0, 0x24, 0xF1,
+0x20, 0xF1, 0xD0, 0x60, 0xF1, 0x22, 0xF1, 0x22, 0xF3, 0x60, 0xF1, 0x22, 0xF0, 0x20, 0xD0, 0x70,
+0x02, 0x80, 0x00, 0x50, 0xC0, 0x06, 0x90, 0x70, 0xF0, 0xD0, 0x22, 0xF0, 0x60, 0xF0, 0x22, 0xF2,
+0x20, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xA0, 0x30, 0xA0, 0x70, 0x80, 0x30, 0x80, 0xB0, 0xD2, 0xF2,
+0x20, 0xF2, 0xD0, 0x70, 0x02, 0x51, 0x05, 0xE1, 0x02, 0x40, 0xA0, 0x30, 0x00, 0x80, 0x02, 0x30,
+0xC0, 0x80, 0x10, 0x50, 0x0F, 0x3D, 0x0F, 0x3D, 0xC0, 0x70, 0x80, 0x02, 0x40, 0xE0, 0xC0, 0x90,
+0xA0, 0x00, 0x90, 0xA0, 0xC0, 0x00, 0x30, 0x50, 0xC0, 0xA0, 0x60, 0xD0, 0xF0, 0xD1, 0x60, 0xF1,
+0xD0, 0x21, 0xF0, 0x26, 0xF4, 0xD0, 0x60, 0xD0, 0x21, 0xF3, 0x22, 0xF2, 0x21, 0xF1, 0x60, 0xD0,
+0x20, 0xF0, 0x23, 0xF2, 0x22, 0xF0, 0xD0, 0xB1, 0xD0, 0x22, 0xF1, 0x25, 0xF1, 0x60, 0xF1, 0x26,
+0xF0, 0x21, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF1, 0xB1, 0xD0, 0xF0, 0x22, 0xF0,
+0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF0, 0x20, 0xB0, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0x60, 0xF1, 0x22, 0xF1, 0x22, 0xF3, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0xD0, 0x30, 0x90,
+0x01, 0x10, 0xE0, 0x80, 0x90, 0x07, 0x50, 0x70, 0xB0, 0xD0, 0xF0, 0xD1, 0x60, 0xF1, 0x22, 0xF0,
+0x20, 0xD0, 0xF1, 0xD0, 0x60, 0xA0, 0xC1, 0x50, 0x40, 0x80, 0x91, 0x30, 0x70, 0x30, 0xB0, 0xD0,
+0xF4, 0xD0, 0x30, 0x80, 0x03, 0x40, 0x03, 0x90, 0xE0, 0x90, 0xC0, 0xA0, 0x01, 0x30, 0x40, 0x01,
+0xE0, 0xA0, 0x01, 0x80, 0x70, 0xA0, 0x40, 0xA0, 0x0F, 0x3D, 0x0F, 0x3F, 0xA1, 0x00, 0x50, 0xE0,
+0x01, 0xC0, 0x70, 0x01, 0xC0, 0xA0, 0x81, 0x02, 0x10, 0x30, 0xD1, 0x60, 0xF2, 0x20, 0xF2, 0x27,
+0xF2, 0xD0, 0x60, 0xB0, 0xF0, 0x21, 0xF3, 0x26, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x24, 0xF2, 0x22,
+0xF0, 0xD0, 0x60, 0xF1, 0x22, 0xF2, 0x24, 0xF1, 0x60, 0xD0, 0xF0, 0x25, 0xF1, 0x22, 0xF0, 0x60,
+0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF1, 0xB0, 0xF2, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22,
+0xF2, 0x22, 0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xB0, 0xF1, 0x22,
+0xF1, 0x22, 0xF3, 0x60, 0xF2, 0x22, 0xF0, 0xD1, 0x70, 0x60, 0x50, 0xC0, 0x30, 0x70, 0x80, 0x08,
+0xC0, 0x70, 0xA0, 0x90, 0xD1, 0xB0, 0x60, 0xD0, 0xF0, 0x21, 0xF2, 0xD1, 0x30, 0xE0, 0xC0, 0x04,
+0x90, 0x02, 0x90, 0x70, 0xB0, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x30, 0x80, 0x04, 0xC0, 0x40, 0x01,
+0x80, 0x10, 0x50, 0x01, 0x40, 0x80, 0xA0, 0x50, 0x02, 0x70, 0xA0, 0x80, 0x00, 0x50, 0x30, 0x01,
+0xC0, 0x0F, 0x3D, 0x0F, 0x40, 0x40, 0x00, 0x70, 0x50, 0x01, 0xA0, 0x40, 0xC0, 0x30, 0x40, 0x00,
+0x30, 0x80, 0x01, 0x30, 0xC0, 0x90, 0x70, 0x60, 0xB0, 0xF1, 0x20, 0xF4, 0x27, 0xF2, 0x60, 0xD0,
+0xF0, 0x21, 0xF4, 0x24, 0xF1, 0xD0, 0x60, 0xF1, 0x25, 0xF2, 0x21, 0xF2, 0x60, 0xD0, 0xF0, 0x22,
+0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x24, 0xF3, 0x21, 0xF0, 0xB0, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x22,
+0xF1, 0xB0, 0xF2, 0x21, 0xF1, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF1, 0x60, 0xD0, 0xF0,
+0x24, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xB1, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x21, 0xF0, 0xB1, 0xD0,
+0xF0, 0x21, 0xF2, 0xD1, 0x60, 0x30, 0xA0, 0x30, 0x60, 0x80, 0x50, 0x07, 0x40, 0xE0, 0xA0, 0x71,
+0x60, 0xD0, 0x60, 0xD1, 0xF0, 0x20, 0xF0, 0xD1, 0x30, 0x71, 0x11, 0x40, 0x80, 0xA0, 0x10, 0x00,
+0x50, 0xC0, 0x03, 0x70, 0x80, 0xF0, 0xD0, 0xF0, 0x70, 0x80, 0x06, 0xC0, 0x90, 0xE0, 0x80, 0x00,
+0xA0, 0x01, 0x40, 0xA0, 0x04, 0x90, 0x00, 0x70, 0x40, 0x0F, 0x42, 0x0F, 0x42, 0xE0, 0x01, 0x30,
+0xA0, 0x00, 0x80, 0xC0, 0x30, 0xC0, 0x00, 0x90, 0xA0, 0x80, 0x40, 0x01, 0xC0, 0xE0, 0x30, 0xD1,
+0xF0, 0x20, 0xF1, 0x20, 0xF2, 0x22, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0x22, 0xF2, 0x21, 0xF1,
+0x23, 0xD0, 0xB1, 0xF1, 0x25, 0xF2, 0x21, 0xF1, 0xB1, 0xD0, 0x23, 0xF3, 0x22, 0xF0, 0xD0, 0x60,
+0x20, 0xF0, 0x20, 0xF0, 0x23, 0xF3, 0x20, 0xF0, 0xB0, 0xF1, 0x20, 0xF0, 0x22, 0xF1, 0x22, 0xF0,
+0xD0, 0x60, 0xD0, 0xF1, 0x22, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0x60, 0xD0, 0xF0, 0x24, 0xF1, 0x20, 0xF0, 0x20, 0xF1, 0xB0, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x20,
+0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF1, 0x21, 0xF3, 0xD1, 0x60, 0xA0, 0xD0, 0xB0, 0xA0, 0x70, 0x30,
+0x50, 0x04, 0x80, 0xC0, 0x00, 0xC0, 0x10, 0xA0, 0xD0, 0x60, 0xB0, 0xD0, 0xF0, 0xD1, 0x60, 0x70,
+0x40, 0x00, 0xA0, 0x80, 0x50, 0x10, 0x60, 0xD0, 0xB0, 0x70, 0xA0, 0x40, 0x04, 0x71, 0x61, 0x70,
+0x07, 0x80, 0x10, 0x90, 0x01, 0x90, 0x80, 0x30, 0x40, 0x08, 0xE0, 0x90, 0x0F, 0x41, 0x0F, 0x42,
+0x80, 0xA1, 0x70, 0x01, 0xC0, 0x30, 0x40, 0x02, 0xC0, 0x70, 0x40, 0x01, 0x30, 0x50, 0x40, 0xA0,
+0xB0, 0xD0, 0xF2, 0x20, 0xF3, 0x20, 0xF1, 0x21, 0xF0, 0xB1, 0xF1, 0x22, 0xF0, 0x21, 0xF2, 0x23,
+0xF0, 0xD0, 0x60, 0xF2, 0x25, 0xF3, 0x21, 0xD0, 0x60, 0xF0, 0xD0, 0x24, 0xF2, 0x22, 0xF0, 0xD0,
+0x60, 0xF0, 0x20, 0xF1, 0x23, 0xF3, 0x20, 0xF0, 0x60, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0x22, 0xF0,
+0xD0, 0x60, 0xD0, 0xF0, 0x23, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0x60, 0xD0, 0xF0, 0x25, 0xF0, 0x21, 0xF2, 0x60, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x22, 0xF0, 0x60,
+0xF2, 0x21, 0xF1, 0x21, 0xF1, 0xD1, 0xF0, 0xD0, 0x60, 0xD0, 0x60, 0x30, 0xA0, 0xC0, 0x02, 0x80,
+0x40, 0x01, 0x82, 0x10, 0x80, 0xD1, 0xF0, 0x31, 0x04, 0x70, 0xD4, 0x60, 0xA0, 0x90, 0x30, 0x80,
+0x01, 0x50, 0x32, 0xA0, 0x50, 0x05, 0x70, 0x30, 0xC0, 0xA0, 0x01, 0x50, 0xE0, 0xC0, 0x09, 0x50,
+0x30, 0x0F, 0x41, 0x0F, 0x43, 0x50, 0x90, 0x0A, 0x81, 0x41, 0x01, 0x90, 0xE0, 0x30, 0xD0, 0xF1,
+0x21, 0xF1, 0x21, 0xF3, 0xD0, 0x60, 0xF0, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x22, 0xF1,
+0xB1, 0xD0, 0xF0, 0x27, 0xF3, 0x21, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF2, 0x21, 0xF2, 0x60,
+0xF0, 0x20, 0xF0, 0x24, 0xF3, 0x20, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF1,
+0x60, 0xF1, 0x23, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x60, 0xF1,
+0x25, 0xF0, 0x21, 0xF1, 0xD0, 0x60, 0xF0, 0x22, 0xF1, 0x22, 0xF0, 0x22, 0xF0, 0xB0, 0xF3, 0x26,
+0xF1, 0x20, 0xF0, 0xB1, 0xF0, 0xD0, 0xB0, 0x70, 0xC0, 0x01, 0xC0, 0x30, 0x90, 0x01, 0x41, 0xC0,
+0x40, 0xA0, 0x70, 0xA0, 0x40, 0x04, 0xC0, 0x70, 0xD0, 0xF0, 0xD1, 0xE0, 0xD0, 0x60, 0x70, 0x11,
+0x40, 0x01, 0x30, 0x50, 0x40, 0x10, 0x80, 0x03, 0x40, 0x10, 0x80, 0x01, 0x90, 0x80, 0x40, 0x30,
+0x0F, 0x4F, 0x0F, 0x51, 0x50, 0x10, 0x50, 0x01, 0x70, 0x00, 0x40, 0x70, 0xF0, 0xD0, 0xF4, 0x20,
+0xD0, 0xF2, 0xB1, 0xD0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x60,
+0xF2, 0x22, 0xF1, 0x23, 0xF2, 0xD0, 0x60, 0xF3, 0x21, 0xF4, 0x22, 0xF0, 0xB1, 0xF0, 0x26, 0xF3,
+0x20, 0xF0, 0x60, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x23, 0xF1, 0x60, 0xF0, 0x24, 0xF0, 0x22,
+0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x23, 0xF1, 0xB0, 0xF1, 0x20, 0xF0, 0x26, 0xF1, 0xD0, 0x60, 0x20,
+0xF0, 0x21, 0xF1, 0x23, 0xF0, 0x21, 0xF0, 0xB1, 0xD0, 0xF1, 0x26, 0xF1, 0x20, 0xF1, 0x60, 0xD0,
+0x20, 0xD0, 0x60, 0x80, 0x02, 0xA0, 0x06, 0x90, 0x06, 0x50, 0x70, 0xF3, 0xA0, 0x70, 0xB0, 0xD1,
+0x80, 0x90, 0xA0, 0x90, 0x01, 0x70, 0x00, 0x10, 0x30, 0x02, 0x70, 0xA0, 0x00, 0x70, 0x02, 0x10,
+0x40, 0x0F, 0x50, 0x0F, 0x53, 0x30, 0x81, 0x90, 0x01, 0x90, 0xE0, 0x80, 0xD1, 0xF1, 0x20, 0xF2,
+0xD0, 0xF0, 0x60, 0xF2, 0x20, 0xF0, 0x21, 0xF0, 0x26, 0xF2, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20,
+0xF2, 0x24, 0xF1, 0xD0, 0x60, 0xF2, 0x22, 0xF4, 0x22, 0xD0, 0x60, 0xF0, 0x25, 0xF6, 0x20, 0x60,
+0xD0, 0xF1, 0x22, 0xF1, 0x23, 0xF1, 0xB0, 0xF0, 0x21, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0xB1, 0xF1,
+0x22, 0xF1, 0x24, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0xD0, 0xB1, 0xF0, 0x21, 0xF1, 0x23,
+0xF0, 0x21, 0xF1, 0x60, 0xF2, 0x26, 0xF0, 0x20, 0xF1, 0xD0, 0x60, 0xF1, 0xD0, 0xA0, 0x90, 0x10,
+0xA0, 0x00, 0x30, 0xC0, 0x05, 0x51, 0x03, 0x50, 0xA1, 0xD1, 0x20, 0xF1, 0x60, 0xD2, 0xE0, 0x40,
+0x03, 0x90, 0x80, 0x00, 0xC0, 0x01, 0x40, 0x10, 0x80, 0x01, 0x50, 0x30, 0x40, 0xA0, 0x0F, 0x52,
+0x0F, 0x54, 0x90, 0xE0, 0xC0, 0x01, 0xA0, 0x00, 0x40, 0xA0, 0xB0, 0xD1, 0xF2, 0xD1, 0x60, 0xF1,
+0x21, 0xF4, 0x21, 0xF0, 0x23, 0xF1, 0x60, 0xF3, 0x20, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0xD0, 0xB1,
+0xF1, 0x21, 0xF0, 0x21, 0xF2, 0x22, 0xF1, 0x60, 0xD0, 0x22, 0xF0, 0x21, 0xF6, 0xB1, 0xD0, 0xF1,
+0x22, 0xF1, 0x23, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1,
+0x24, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0xD0, 0xB1, 0xF5, 0x22, 0xF0, 0x20, 0xF1, 0xD0,
+0x60, 0xF0, 0xD0, 0xF0, 0x25, 0xF1, 0x20, 0xF1, 0xD0, 0xB1, 0xF0, 0xD0, 0x30, 0x80, 0x30, 0xE0,
+0x80, 0x30, 0x50, 0xC0, 0x90, 0x40, 0x03, 0x40, 0x03, 0xA0, 0x40, 0xD0, 0xF1, 0x21, 0xF1, 0xD0,
+0xF0, 0xD0, 0x30, 0x80, 0x90, 0x00, 0x40, 0xC0, 0x30, 0x50, 0x01, 0xC0, 0x70, 0xA0, 0x00, 0xA0,
+0xC0, 0x01, 0xE0, 0x40, 0x0F, 0x53, 0x0F, 0x56, 0xA0, 0x41, 0x90, 0x01, 0x90, 0xE0, 0xA0, 0xF0,
+0xD0, 0xF2, 0xB1, 0xD0, 0xF0, 0x21, 0xF3, 0x22, 0xF0, 0x23, 0xD0, 0xF0, 0x60, 0xD0, 0xF2, 0x20,
+0xF0, 0x20, 0xF1, 0x24, 0xF1, 0x60, 0xF1, 0x22, 0xF0, 0x21, 0xF1, 0x23, 0xF1, 0xB0, 0xD0, 0xF0,
+0x24, 0xF3, 0x20, 0xF1, 0xB1, 0xD0, 0xF1, 0x22, 0xF1, 0x22, 0xF1, 0xB1, 0xF0, 0x24, 0xF0, 0x22,
+0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x22, 0xF0, 0x20, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0xD0,
+0xF0, 0xB0, 0xF6, 0x21, 0xF0, 0x21, 0xF1, 0xB1, 0xF0, 0x23, 0xF4, 0x20, 0xF3, 0x60, 0xD2, 0x60,
+0x80, 0xB0, 0x10, 0x70, 0x31, 0xE1, 0xA1, 0x30, 0x00, 0x90, 0xC0, 0x02, 0x50, 0x70, 0xF0, 0xD0,
+0xF2, 0x20, 0xF3, 0xD0, 0x70, 0x40, 0x00, 0xA0, 0x10, 0x40, 0x01, 0x30, 0x10, 0x80, 0x01, 0x50,
+0x80, 0x90, 0x70, 0xC0, 0x0F, 0x54, 0x0F, 0x57, 0x40, 0x10, 0x02, 0x70, 0x00, 0x90, 0xA0, 0x60,
+0xD1, 0xF0, 0x60, 0xF2, 0x21, 0xF3, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0xB0, 0xF3, 0x20, 0xF0, 0x20,
+0xF3, 0x23, 0xF1, 0x60, 0xD0, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x24,
+0xF2, 0x21, 0xF1, 0x60, 0x20, 0xF2, 0x22, 0xF1, 0x22, 0xF1, 0xB1, 0xF0, 0x24, 0xF0, 0x22, 0xF2,
+0xB1, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0xB1, 0xF0, 0x20, 0xF1, 0x25, 0xF3, 0x60, 0xD0, 0xF0, 0x20,
+0xF3, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xB0, 0xD0, 0x22, 0xF4, 0x22, 0xF2, 0x60, 0xF3, 0xD2,
+0xE0, 0xB0, 0xD4, 0xA0, 0x90, 0x00, 0x81, 0x02, 0xC0, 0x70, 0xB0, 0xD0, 0x22, 0xF2, 0x20, 0xF0,
+0xD0, 0x70, 0x80, 0x30, 0x01, 0x90, 0x10, 0x80, 0x00, 0xA0, 0xC0, 0x01, 0xE0, 0x80, 0x0F, 0x56,
+0x0F, 0x59, 0xA0, 0x81, 0x50, 0x01, 0x40, 0xA0, 0x70, 0xB0, 0xF0, 0xB0, 0xD0, 0xF1, 0x21, 0xF4,
+0x23, 0xF3, 0x60, 0xF4, 0x21, 0xF4, 0x22, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0x21,
+0xF2, 0x60, 0xF2, 0x22, 0xF0, 0x25, 0xF0, 0xD0, 0x60, 0xF2, 0x22, 0xF0, 0x24, 0xF1, 0xB1, 0xF1,
+0x20, 0xF0, 0x21, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x60, 0xF0,
+0x20, 0xF1, 0x24, 0xF4, 0x60, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x60, 0xF1, 0x20, 0xF0,
+0x20, 0xF0, 0x20, 0xF1, 0x22, 0xF3, 0xB0, 0xD0, 0xF0, 0x20, 0xF1, 0xD1, 0xF4, 0xD1, 0xA0, 0x80,
+0xA1, 0xC0, 0x03, 0xE0, 0xD0, 0xF0, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xD1, 0xA0, 0x40, 0xC0, 0x70,
+0xE0, 0x80, 0x01, 0xC0, 0x30, 0x40, 0xA0, 0x0F, 0x58, 0x0F, 0x5A, 0x90, 0x70, 0x90, 0x01, 0x30,
+0x01, 0x70, 0xA0, 0xB0, 0xD0, 0xF1, 0x20, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0x60,
+0xF5, 0x20, 0xF5, 0x22, 0xD0, 0x60, 0xF0, 0xD0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF4, 0x60, 0xF0,
+0x23, 0xF0, 0x21, 0xF1, 0x22, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x22, 0xF3, 0xB1, 0xF1,
+0x22, 0xF1, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x20, 0xF0, 0x21, 0xF1, 0x60, 0xF2, 0x24, 0xF3,
+0x20, 0xF0, 0x60, 0xF1, 0x22, 0xF2, 0x23, 0xF0, 0x20, 0xF0, 0xB0, 0xF1, 0x20, 0xF1, 0x21, 0xF0,
+0x20, 0xF1, 0x21, 0xF2, 0x60, 0xD0, 0x20, 0xF0, 0x20, 0xF4, 0x21, 0xD0, 0xB0, 0x70, 0xF0, 0x60,
+0xE0, 0xA0, 0x40, 0x01, 0x40, 0x70, 0x80, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0xD2,
+0xA0, 0x10, 0x50, 0x00, 0x30, 0xC0, 0x00, 0x50, 0x70, 0x90, 0x00, 0x80, 0x30, 0x0F, 0x56, 0x0F,
+0x5C, 0x80, 0x31, 0x50, 0x01, 0x11, 0xA0, 0x80, 0xD1, 0xF0, 0x23, 0xF1, 0x22, 0xF0, 0x20, 0xF1,
+0x60, 0xD0, 0xFB, 0x21, 0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0x20, 0xF0,
+0xB1, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xB0, 0x60, 0xF0, 0x20, 0xF3, 0x23,
+0xF3, 0xB0, 0xF2, 0x21, 0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF2, 0x60, 0xF2, 0x24,
+0xF0, 0x20, 0xF1, 0x20, 0xF0, 0xB1, 0xF1, 0x20, 0xF3, 0x21, 0xF0, 0x22, 0xF0, 0xB1, 0xF0, 0x20,
+0xF0, 0x22, 0xF0, 0x20, 0xF1, 0x21, 0xF1, 0xD0, 0xB0, 0xF2, 0x20, 0xF0, 0x20, 0xF4, 0xD0, 0x60,
+0xE0, 0x60, 0xD0, 0x60, 0xB0, 0x70, 0x50, 0x30, 0x70, 0xD1, 0xF1, 0x22, 0xF1, 0xD2, 0x60, 0xA0,
+0xE0, 0x10, 0x02, 0xA0, 0x81, 0x01, 0x90, 0x41, 0x90, 0x0F, 0x55, 0x0F, 0x5A, 0xA0, 0x70, 0x50,
+0x00, 0x70, 0x80, 0x00, 0x80, 0x10, 0x50, 0x00, 0x40, 0x10, 0x60, 0xD1, 0xF0, 0x20, 0xF1, 0x23,
+0xF2, 0xB1, 0xFC, 0x21, 0xD0, 0xB1, 0xD0, 0xF1, 0x20, 0xF1, 0x24, 0xF1, 0x20, 0xF0, 0xB1, 0xF0,
+0x23, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xB1, 0xF0, 0x21, 0xF1, 0x24, 0xF3, 0x60, 0xF2, 0x21, 0xF2,
+0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x22, 0xF2, 0x60, 0xF2, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF0,
+0xB1, 0xF1, 0x21, 0xF2, 0x21, 0xF0, 0x22, 0xF1, 0x60, 0xD0, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0xF1,
+0x23, 0xF0, 0xD0, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x21, 0xF2, 0x20, 0xF0, 0xD0, 0xB0, 0xF1,
+0xD0, 0xF0, 0x80, 0x30, 0xB0, 0xD1, 0x20, 0xF1, 0x20, 0xF2, 0xD1, 0xB0, 0xE0, 0x80, 0x01, 0x10,
+0xA0, 0x00, 0x40, 0x70, 0xC0, 0x40, 0xE0, 0x70, 0x00, 0x81, 0x0F, 0x56, 0x0F, 0x59, 0x50, 0x80,
+0x00, 0x70, 0x50, 0x00, 0x90, 0xA0, 0x10, 0x30, 0x01, 0x30, 0xC0, 0x80, 0xA0, 0x60, 0xD1, 0xF0,
+0x20, 0xF0, 0x20, 0xF3, 0xD0, 0x60, 0xD0, 0xF1, 0x24, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0xD0, 0x60,
+0xF1, 0x20, 0xF0, 0x20, 0xF1, 0x24, 0xF0, 0x21, 0xF0, 0x60, 0xF1, 0x22, 0xF1, 0x21, 0xF0, 0x22,
+0xF1, 0xB1, 0xF0, 0x21, 0xF0, 0x25, 0xF3, 0x60, 0xF2, 0x21, 0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x22,
+0xF2, 0x23, 0xF1, 0x60, 0xF2, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x60, 0xF1, 0x21, 0xF2, 0x20,
+0xF1, 0x22, 0xF1, 0x60, 0xF1, 0x21, 0xF1, 0x20, 0xF0, 0x24, 0xF1, 0xD0, 0x60, 0xD0, 0xF2, 0x21,
+0xF1, 0x20, 0xF2, 0xD0, 0x20, 0xF2, 0x60, 0xD2, 0xF1, 0x20, 0xF2, 0xD1, 0xB0, 0xA0, 0x80, 0xC0,
+0x30, 0x01, 0x80, 0x10, 0x70, 0x40, 0x00, 0x50, 0xA0, 0x00, 0x40, 0x70, 0x0F, 0x58, 0x0F, 0x5C,
+0x81, 0x02, 0x80, 0xA0, 0xC1, 0x30, 0x01, 0xC0, 0xE0, 0xA0, 0x60, 0xD1, 0xF0, 0x21, 0xF1, 0xD0,
+0xB1, 0xD0, 0xF1, 0x24, 0xF1, 0x23, 0xF2, 0x60, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF0, 0x20,
+0xF0, 0x20, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x25, 0xF1, 0x60, 0xF1, 0x21, 0xF0, 0x20,
+0xF0, 0x23, 0xF3, 0x60, 0xD0, 0xF0, 0x22, 0xF2, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF2, 0x23, 0xF0,
+0xD0, 0x60, 0xF2, 0x24, 0xF2, 0x21, 0xF1, 0x60, 0xD0, 0xF0, 0x21, 0xF1, 0x21, 0xF0, 0x22, 0xF1,
+0xD0, 0x60, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x20, 0xF1, 0x21, 0xF0, 0x20, 0xF0, 0xB1, 0xD0, 0xF1,
+0x23, 0xF0, 0x21, 0xF0, 0x22, 0xF0, 0xD0, 0xB0, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0xD1, 0xB0, 0xA0,
+0x70, 0x90, 0x01, 0x80, 0x50, 0x00, 0x30, 0x80, 0x00, 0x90, 0xC0, 0x90, 0xA0, 0x01, 0xA0, 0x80,
+0x0F, 0x57, 0x0F, 0x5A, 0x50, 0x30, 0xE0, 0xC0, 0x50, 0x80, 0xA0, 0x50, 0xC0, 0x30, 0x70, 0x50,
+0x01, 0x30, 0xC1, 0x30, 0xA0, 0xB0, 0xD0, 0xF1, 0xD0, 0xF1, 0x60, 0xD0, 0xF2, 0x2A, 0xF0, 0xD0,
+0xB1, 0xF2, 0x20, 0xF1, 0x20, 0xF2, 0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x22, 0xF0, 0x23, 0xF0, 0x20,
+0xF2, 0x60, 0xD0, 0x21, 0xF1, 0x20, 0xF1, 0x22, 0xF3, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF0,
+0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x24, 0xF0, 0xD0, 0x60, 0xF2, 0x25, 0xF0, 0x22, 0xF1, 0x60,
+0xF1, 0x21, 0xF1, 0x21, 0xF0, 0x22, 0xF3, 0xB0, 0xF0, 0x21, 0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x23,
+0xF1, 0x60, 0xF1, 0x29, 0xF4, 0x60, 0xF0, 0xD0, 0xF1, 0xD1, 0xF0, 0x30, 0xA0, 0x50, 0x00, 0x30,
+0x01, 0xC0, 0x70, 0x30, 0xC0, 0x00, 0x71, 0x00, 0xC0, 0xE0, 0xC0, 0x00, 0x50, 0x70, 0x0F, 0x57,
+0x0F, 0x57, 0x40, 0xE1, 0xA0, 0x40, 0x01, 0x90, 0x30, 0xE0, 0x02, 0xC0, 0xA0, 0x80, 0xC0, 0x30,
+0x01, 0xC0, 0xA0, 0x30, 0x70, 0xB0, 0xD1, 0xF0, 0xB1, 0xF3, 0x29, 0xF1, 0xD0, 0x60, 0xD0, 0xF0,
+0x24, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0xB0, 0xF2, 0x22, 0xF0, 0x20, 0xF7, 0x60, 0xD0, 0x21, 0xF1,
+0x20, 0xF1, 0x22, 0xF3, 0x60, 0xD0, 0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22,
+0xF1, 0x24, 0xF0, 0xD0, 0x60, 0xF2, 0x22, 0xF0, 0x21, 0xF0, 0x22, 0xF1, 0x60, 0xF2, 0x20, 0xF1,
+0x20, 0xF1, 0x22, 0xF3, 0x60, 0xD0, 0xF0, 0x20, 0xF4, 0x20, 0xF1, 0x21, 0xF2, 0x60, 0xF0, 0xD0,
+0xF0, 0x27, 0xF0, 0x20, 0xF3, 0xB1, 0xD0, 0xF0, 0xD1, 0xA2, 0x50, 0x01, 0x80, 0x50, 0x80, 0xA0,
+0x50, 0x01, 0x70, 0x40, 0x00, 0x50, 0x00, 0x40, 0x70, 0x01, 0x70, 0xC0, 0x0F, 0x56, 0x0F, 0x57,
+0x80, 0xE0, 0x40, 0x04, 0x70, 0x50, 0x01, 0x81, 0x00, 0x50, 0xE0, 0x80, 0x01, 0x30, 0xC0, 0x01,
+0xE0, 0xA0, 0x60, 0xD0, 0x60, 0xF2, 0x21, 0xF0, 0x21, 0xF1, 0x24, 0xF2, 0xB0, 0xD0, 0xF0, 0x23,
+0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0xF2, 0x22, 0xF1, 0x21, 0xF0, 0x22, 0xD0, 0xB1, 0xF1,
+0x20, 0xF1, 0x20, 0xF1, 0x22, 0xF1, 0xD0, 0xF0, 0xB0, 0xF2, 0x21, 0xF2, 0x22, 0xF2, 0xB1, 0xF1,
+0x22, 0xF1, 0x20, 0xF1, 0x20, 0xF2, 0xB1, 0xF2, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF1,
+0xB1, 0xD0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF3, 0x60, 0xF1, 0x20, 0xF0, 0x21, 0xF0,
+0x21, 0xF1, 0x22, 0xF1, 0xB1, 0xD0, 0xF0, 0x23, 0xF2, 0x25, 0xF0, 0xD0, 0x60, 0xD0, 0xB0, 0xA0,
+0x10, 0x02, 0x70, 0x01, 0x40, 0xE0, 0x90, 0x00, 0x30, 0x01, 0x90, 0xA0, 0x71, 0x10, 0xC0, 0xA0,
+0x30, 0x80, 0xA0, 0x0F, 0x57, 0x0F, 0x58, 0xC0, 0xA0, 0x70, 0x02, 0x40, 0xA0, 0x01, 0x70, 0x80,
+0x40, 0x70, 0x01, 0x90, 0xA0, 0x40, 0x80, 0x01, 0x50, 0x80, 0xC0, 0x30, 0x70, 0x80, 0xD1, 0xF8,
+0x22, 0xF2, 0xB0, 0xF1, 0x24, 0xF0, 0x21, 0xF1, 0x21, 0xF2, 0x60, 0xF2, 0x23, 0xF0, 0x21, 0xF0,
+0x22, 0xD0, 0xB1, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0xD0, 0xB1, 0xF2, 0x22, 0xF1, 0x22,
+0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0xB1, 0xD0, 0xF1, 0x21, 0xF1, 0x21, 0xF1,
+0x20, 0xF1, 0x20, 0x60, 0xD0, 0x21, 0xF2, 0x20, 0xF0, 0x22, 0xF3, 0xB1, 0xF0, 0x23, 0xF0, 0x21,
+0xF1, 0x22, 0xF2, 0x60, 0xD0, 0xF1, 0x21, 0xF0, 0x20, 0xF3, 0x23, 0xD1, 0x60, 0xA0, 0x30, 0xC0,
+0x40, 0x50, 0x01, 0x80, 0x40, 0x30, 0x40, 0x01, 0x50, 0x10, 0x40, 0x00, 0xC0, 0xE0, 0x90, 0x00,
+0x40, 0xA0, 0x00, 0x40, 0x80, 0x0F, 0x58, 0x0F, 0x5A, 0x50, 0x02, 0x10, 0xC0, 0x00, 0x80, 0xA0,
+0x01, 0xE0, 0x00, 0x50, 0x30, 0xC0, 0x40, 0xA0, 0x90, 0x00, 0x30, 0xC0, 0x01, 0x31, 0xA0, 0x60,
+0xD1, 0xF0, 0x20, 0xF6, 0x21, 0xF1, 0x60, 0xD0, 0xF0, 0x25, 0xF3, 0x21, 0xF1, 0xB1, 0xF2, 0x24,
+0xF3, 0x20, 0xF0, 0xD0, 0x60, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x22, 0xF1, 0xD0, 0xB1, 0xF0,
+0x20, 0xF0, 0x23, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x21, 0xF2, 0xB1, 0xD0,
+0xF0, 0x23, 0xF0, 0x21, 0xF1, 0x21, 0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF2, 0x20, 0xF0, 0x22, 0xF4,
+0xB0, 0xF0, 0x20, 0xF0, 0x21, 0xF0, 0x21, 0xF1, 0x23, 0xF0, 0xD0, 0x60, 0xF2, 0x20, 0xF0, 0x22,
+0xF1, 0x22, 0xD1, 0xB0, 0xA0, 0x30, 0xA0, 0x02, 0xA0, 0x00, 0x50, 0xA0, 0x80, 0x03, 0x30, 0x40,
+0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x70, 0x0F, 0x5B, 0x0F, 0x5D, 0x40, 0x80, 0x01, 0x10, 0x01, 0xC0,
+0xE0, 0x00, 0x30, 0x00, 0x30, 0x01, 0x40, 0xA0, 0x70, 0x01, 0xC0, 0x30, 0x01, 0xA0, 0xE0, 0x30,
+0xD1, 0xF6, 0x20, 0xF0, 0xD0, 0xB1, 0xD0, 0xF0, 0x25, 0xF1, 0x21, 0xF0, 0x21, 0xF0, 0x60, 0xF3,
+0x27, 0xF0, 0x20, 0xF0, 0xD0, 0x60, 0xF0, 0x22, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0xD0, 0xB1, 0xF0,
+0x25, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x23, 0xF0, 0x20, 0xF0, 0x20, 0x60, 0xD0, 0xF0,
+0x23, 0xF0, 0x20, 0xF1, 0x23, 0xD0, 0x60, 0xD0, 0xF0, 0x21, 0xF4, 0x24, 0xF1, 0x60, 0xF0, 0x20,
+0xF0, 0x21, 0xF1, 0x20, 0xF2, 0x23, 0xD0, 0xB1, 0xD0, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0xD1, 0x60,
+0xE0, 0x70, 0xC0, 0x00, 0x80, 0x90, 0x01, 0xA0, 0x70, 0x80, 0x05, 0xC0, 0x00, 0x80, 0x30, 0x01,
+0x70, 0x80, 0x70, 0x40, 0x0F, 0x5B, 0x0F, 0x60, 0x90, 0xA0, 0x01, 0xA0, 0x40, 0x00, 0x40, 0x30,
+0x40, 0x03, 0x40, 0xA0, 0x40, 0xA0, 0x02, 0xA0, 0x00, 0x90, 0xA1, 0xB0, 0xD1, 0xF6, 0x60, 0xF1,
+0x22, 0xF1, 0x22, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x60, 0xD0, 0xF2, 0x24, 0xF0, 0x21, 0xF0, 0x20,
+0xF0, 0xD0, 0x60, 0xF0, 0x23, 0xF1, 0x20, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0x20, 0xF1, 0x24, 0xF0,
+0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x23, 0xF0, 0x20, 0xF1, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20,
+0xF1, 0x20, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0x60, 0xF1, 0x21, 0xF4, 0x24, 0xF0, 0xD0, 0x60, 0x20,
+0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x21, 0xF2, 0x60, 0xF0, 0xD1, 0xF0, 0x20, 0xF1, 0xD1,
+0xB0, 0xA1, 0x40, 0x00, 0xA0, 0x02, 0xA0, 0x40, 0xA0, 0x40, 0x0A, 0x10, 0xC0, 0x00, 0xC0, 0x80,
+0xC0, 0x0F, 0x5C, 0x0F, 0x60, 0x50, 0x70, 0x00, 0x80, 0x70, 0x0A, 0x90, 0x70, 0x40, 0x00, 0xC0,
+0x80, 0x01, 0x90, 0x80, 0x30, 0xA0, 0x60, 0xF0, 0xD0, 0xF4, 0x60, 0xD0, 0x23, 0xF1, 0x22, 0xF1,
+0x22, 0xF0, 0x20, 0x60, 0xF1, 0x20, 0xF0, 0x24, 0xF0, 0x20, 0xF1, 0x20, 0xF1, 0x60, 0xD0, 0x23,
+0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xD0, 0x60, 0x21, 0xF0, 0x24, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22,
+0xF1, 0x24, 0xF0, 0x20, 0xF0, 0x60, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xF1, 0x20, 0xF3, 0x21, 0xF0,
+0xB1, 0xF0, 0x20, 0xF0, 0x20, 0xF3, 0x24, 0xF0, 0xD0, 0xB1, 0xF0, 0x21, 0xF2, 0x20, 0xF4, 0x22,
+0xF0, 0xB0, 0xF1, 0xD0, 0xF0, 0xD1, 0xF0, 0x60, 0xA0, 0x30, 0x41, 0x01, 0x40, 0x90, 0x00, 0x40,
+0x70, 0x40, 0x0C, 0x40, 0x30, 0x0F, 0x60, 0x0F, 0x61, 0x80, 0xE0, 0xA0, 0x0D, 0x90, 0xA0, 0x70,
+0x50, 0x01, 0xA0, 0x01, 0xC0, 0xE0, 0xA0, 0x30, 0xF0, 0xD2, 0xB1, 0xD0, 0x23, 0xF1, 0x21, 0xF2,
+0x22, 0xF0, 0xB1, 0xF1, 0x20, 0xF0, 0x24, 0xF2, 0x20, 0xF1, 0xB1, 0xF0, 0x22, 0xF1, 0x21, 0xF1,
+0x22, 0xF0, 0xD0, 0x60, 0xF0, 0x20, 0xF0, 0x24, 0xF0, 0x22, 0xF2, 0xB1, 0xF1, 0x22, 0xF1, 0x20,
+0xF0, 0x22, 0xF0, 0x20, 0xF0, 0x60, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0xB1,
+0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF2, 0x23, 0xF0, 0xD0, 0xF0, 0xB0, 0xF0, 0x21, 0xF2, 0x20,
+0xF4, 0x22, 0xF1, 0x60, 0xD2, 0xF0, 0x80, 0xA0, 0xE0, 0x50, 0x01, 0xA0, 0x01, 0x50, 0x70, 0xA0,
+0x40, 0x0F, 0x00, 0xC0, 0x0F, 0x60, 0x0F, 0x74, 0x50, 0x30, 0xA0, 0x81, 0x01, 0x90, 0x40, 0x00,
+0x90, 0x71, 0x80, 0xD0, 0xB0, 0xD0, 0xF1, 0x21, 0xF2, 0x21, 0xF1, 0x20, 0xF3, 0x60, 0xF2, 0x27,
+0xF1, 0x20, 0xF0, 0xD0, 0xB1, 0xF0, 0x22, 0xF1, 0x20, 0xF2, 0x22, 0xF0, 0xD0, 0x60, 0xF0, 0x20,
+0xF1, 0x22, 0xF2, 0x21, 0xF2, 0xB1, 0xF2, 0x21, 0xF1, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x20,
+0xF0, 0x60, 0xF3, 0x20, 0xF0, 0x20, 0xF2, 0x23, 0xF1, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xF4, 0x23,
+0xF2, 0x60, 0xF1, 0x20, 0xF9, 0x21, 0xD1, 0x60, 0xD0, 0x60, 0x70, 0xE0, 0x90, 0x00, 0x50, 0x80,
+0x01, 0x90, 0x80, 0x31, 0x90, 0x0F, 0x73, 0x0F, 0x77, 0x80, 0xA0, 0x80, 0x00, 0x30, 0x02, 0xA0,
+0x00, 0x90, 0x10, 0x70, 0x60, 0xD1, 0xF1, 0x20, 0xF1, 0x21, 0xF1, 0x20, 0xF2, 0x20, 0x60, 0xD0,
+0xF1, 0x27, 0xF4, 0x60, 0xF1, 0x23, 0xF2, 0x20, 0xF0, 0x22, 0xF0, 0xD0, 0x60, 0xF3, 0x21, 0xF7,
+0xD0, 0xB1, 0xF7, 0x21, 0xF4, 0x60, 0xF3, 0x20, 0xF4, 0x23, 0xF1, 0x60, 0xF1, 0x21, 0xF2, 0x25,
+0xF2, 0xB0, 0xFC, 0xD2, 0x60, 0xA0, 0x10, 0x40, 0x00, 0x30, 0x02, 0xA0, 0x00, 0x40, 0x31, 0x0F,
+0x76, 0x0F, 0x79, 0x90, 0xA0, 0x70, 0x50, 0x00, 0x90, 0x40, 0x01, 0x10, 0x70, 0x40, 0xA1, 0x60,
+0xF0, 0xD1, 0xF2, 0x20, 0xF1, 0x20, 0xF2, 0xB0, 0xF2, 0x24, 0xF0, 0x23, 0xF2, 0x60, 0xF1, 0x24,
+0xF3, 0x22, 0xF0, 0xD0, 0x60, 0xF3, 0x22, 0xF3, 0x20, 0xF2, 0xB1, 0xF2, 0x21, 0xF2, 0x21, 0xF4,
+0x60, 0xF3, 0x20, 0xF3, 0x24, 0xF0, 0xD0, 0x60, 0xF1, 0x21, 0xF0, 0x23, 0xF2, 0x22, 0xF0, 0xB1,
+0xD0, 0x21, 0xF4, 0xD2, 0xF0, 0xB0, 0x30, 0xA0, 0x80, 0x30, 0x10, 0x01, 0x90, 0x40, 0x00, 0xC0,
+0xA1, 0x90, 0x0F, 0x78, 0x0F, 0x7B, 0xC0, 0x80, 0xA0, 0x70, 0xC0, 0x00, 0x90, 0x10, 0x90, 0x01,
+0x70, 0x80, 0x70, 0x30, 0xB0, 0xF0, 0xD1, 0xF1, 0x20, 0xF2, 0xB1, 0xD0, 0xF0, 0x25, 0xF0, 0x23,
+0xF2, 0x60, 0xD0, 0xF1, 0x29, 0xF1, 0xD0, 0x60, 0xF0, 0x20, 0xF0, 0x29, 0xF1, 0xB1, 0xF1, 0x2A,
+0xF1, 0xB0, 0xF2, 0x21, 0xF1, 0x25, 0xF1, 0xD0, 0xB0, 0xF4, 0x26, 0xF1, 0x20, 0xF1, 0x60, 0xF0,
+0x24, 0xD2, 0xB0, 0x30, 0x70, 0x80, 0x30, 0x50, 0x00, 0xC0, 0x10, 0x40, 0x01, 0xE0, 0x31, 0x50,
+0x01, 0x31, 0x0F, 0x76, 0x0F, 0x7B, 0x90, 0xC0, 0x00, 0x40, 0xA0, 0x30, 0xE0, 0x10, 0x01, 0x40,
+0x50, 0x01, 0xA0, 0x80, 0xA1, 0x60, 0xD3, 0xF0, 0xD0, 0x60, 0xD0, 0xF2, 0x22, 0xF2, 0x23, 0xF2,
+0xB0, 0xD0, 0xF2, 0x24, 0xF1, 0x21, 0xF2, 0x60, 0xF0, 0x2B, 0xF1, 0xB1, 0xF1, 0x2A, 0xF1, 0xB1,
+0xF0, 0x22, 0xF0, 0x25, 0xF3, 0xB1, 0xF3, 0x21, 0xF4, 0x21, 0xF2, 0x60, 0xD5, 0x60, 0xA0, 0x70,
+0x80, 0x70, 0x01, 0xC0, 0x80, 0x01, 0xE0, 0x10, 0x30, 0xA0, 0x40, 0x01, 0x50, 0x00, 0x91, 0x80,
+0xC0, 0x0F, 0x75, 0x0F, 0x7A, 0x10, 0x30, 0x70, 0x30, 0x02, 0x40, 0xA0, 0x80, 0x50, 0xA0, 0x01,
+0xC0, 0x30, 0x01, 0x90, 0xA2, 0x80, 0xB0, 0xD1, 0x60, 0xD1, 0xF1, 0x23, 0xF0, 0xD0, 0xF4, 0xD0,
+0xB1, 0xD0, 0xFE, 0xB0, 0xF2, 0x29, 0xF1, 0xB1, 0xF1, 0x2A, 0xF1, 0xB1, 0xF0, 0x22, 0xF2, 0x24,
+0xF2, 0xB1, 0xD0, 0xF3, 0x20, 0xF6, 0x20, 0xF0, 0xD0, 0xB0, 0xF0, 0xD0, 0xB0, 0x80, 0xA1, 0x30,
+0x80, 0x01, 0x80, 0x50, 0x01, 0x30, 0x50, 0x80, 0xA0, 0x40, 0x02, 0x80, 0x70, 0xA1, 0x00, 0x81,
+0x0F, 0x76, 0x0F, 0x7A, 0xC0, 0x01, 0x10, 0x00, 0x50, 0x30, 0x90, 0x00, 0x50, 0x80, 0x70, 0x40,
+0xC0, 0x41, 0x01, 0x30, 0x01, 0xC0, 0x70, 0x30, 0xA0, 0x30, 0x80, 0xB0, 0xD3, 0xF5, 0x21, 0xF2,
+0xB0, 0xFF, 0x00, 0xB1, 0xF2, 0x28, 0xF1, 0xD0, 0xB1, 0xF2, 0x29, 0xF1, 0xB1, 0xF0, 0x22, 0xF2,
+0x20, 0xF1, 0x22, 0xF1, 0x20, 0x60, 0xD0, 0xF1, 0x21, 0xF5, 0xD3, 0xB0, 0x80, 0xA1, 0x30, 0x70,
+0x50, 0x01, 0x30, 0x01, 0xC0, 0x80, 0xC0, 0x40, 0xA0, 0x30, 0x50, 0x00, 0x40, 0xA0, 0x90, 0x00,
+0x70, 0xC0, 0x00, 0x70, 0x40, 0x0F, 0x78, 0x0F, 0x7C, 0x40, 0x70, 0xC0, 0xE0, 0x90, 0xA0, 0x40,
+0x02, 0x50, 0x80, 0xE0, 0x30, 0xC0, 0x00, 0x30, 0x01, 0x90, 0x40, 0x01, 0x30, 0x80, 0x30, 0x70,
+0xA0, 0x60, 0xB0, 0xD2, 0xF3, 0x21, 0xF1, 0x60, 0xF3, 0x26, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0xB1,
+0xF0, 0x2A, 0xF1, 0xD0, 0xB1, 0xF2, 0x23, 0xF0, 0x25, 0xF0, 0xB1, 0xF0, 0x27, 0xF2, 0x20, 0xF2,
+0x60, 0xD0, 0xF6, 0xD2, 0xB1, 0x30, 0x70, 0xA0, 0x40, 0xA0, 0x01, 0x90, 0x40, 0x01, 0x30, 0x00,
+0xC0, 0x80, 0xE0, 0x80, 0x90, 0x02, 0x80, 0x30, 0x50, 0x30, 0x00, 0x70, 0x50, 0x00, 0x90, 0x70,
+0x0F, 0x78, 0x0F, 0x7A, 0x80, 0xE0, 0xA0, 0x00, 0x70, 0x90, 0x00, 0x90, 0x30, 0x00, 0x80, 0xE0,
+0x30, 0x01, 0xC0, 0x80, 0x70, 0xE0, 0x90, 0x00, 0x80, 0xC0, 0x01, 0xA0, 0x01, 0xC0, 0xA0, 0x40,
+0x30, 0x70, 0xA0, 0x60, 0xF0, 0xD6, 0x60, 0xD0, 0xF2, 0x2A, 0xF0, 0xB1, 0xF8, 0x22, 0xF1, 0xD0,
+0xB1, 0xF2, 0x22, 0xF5, 0x21, 0xF1, 0xB0, 0xF0, 0x26, 0xF3, 0x21, 0xF0, 0xD0, 0x60, 0xD0, 0xF0,
+0xD4, 0xF0, 0x60, 0xA0, 0x70, 0x30, 0x80, 0x30, 0x50, 0x01, 0x30, 0x02, 0x30, 0x00, 0x50, 0x71,
+0x80, 0x50, 0x02, 0xA0, 0x01, 0x70, 0x00, 0x90, 0x80, 0x00, 0x81, 0x01, 0x70, 0xC0, 0x0F, 0x77,
+0x0F, 0x78, 0x40, 0x10, 0x40, 0x01, 0xC0, 0xE0, 0x01, 0x80, 0x40, 0x80, 0xA0, 0x00, 0x30, 0x40,
+0x00, 0x40, 0x90, 0x01, 0x40, 0xA0, 0xE0, 0x80, 0xC0, 0x00, 0x30, 0x01, 0x80, 0x50, 0x01, 0x30,
+0x00, 0x40, 0xA0, 0xE0, 0xA1, 0x60, 0xB0, 0xD1, 0xB0, 0xD1, 0xF0, 0xD0, 0xF0, 0x20, 0xF4, 0x23,
+0xD0, 0xB0, 0xF6, 0xD0, 0xF1, 0x20, 0xF0, 0x21, 0xF0, 0xD0, 0xB1, 0xF1, 0x20, 0xF0, 0x20, 0xF2,
+0xD0, 0xF6, 0x60, 0xF0, 0x22, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0xD1, 0xB0, 0xD1, 0xB0, 0x60, 0xA1,
+0x71, 0x40, 0x00, 0x30, 0x01, 0xC0, 0x30, 0x01, 0x80, 0x50, 0xC0, 0x40, 0xE0, 0xA0, 0x80, 0xC0,
+0x04, 0x80, 0x10, 0x50, 0x00, 0xA1, 0x81, 0xE0, 0xC0, 0xE0, 0x01, 0x70, 0xC0, 0x0F, 0x77, 0x0F,
+0x78, 0x40, 0x70, 0xA0, 0x40, 0x00, 0x90, 0xA0, 0x01, 0xE0, 0xC0, 0xE0, 0xC0, 0x00, 0x40, 0x80,
+0x50, 0x40, 0x80, 0xC0, 0x02, 0xC0, 0x90, 0x80, 0x70, 0x30, 0x90, 0xC0, 0xA0, 0x02, 0x30, 0x01,
+0x90, 0x40, 0x00, 0xC0, 0x70, 0x80, 0xA0, 0x70, 0xA0, 0x80, 0x60, 0xB1, 0xD2, 0xF0, 0xD2, 0xF4,
+0x60, 0xF0, 0xD0, 0xF4, 0x20, 0xD0, 0xF0, 0x20, 0xF4, 0xB1, 0xD0, 0xF3, 0x20, 0xF1, 0x20, 0xF6,
+0x60, 0xD0, 0xF4, 0xD5, 0xF0, 0xB0, 0x60, 0x80, 0x30, 0x71, 0x80, 0x70, 0xC0, 0x00, 0x50, 0x40,
+0x01, 0x80, 0x50, 0x01, 0xA0, 0xC0, 0x50, 0x30, 0x70, 0x80, 0x90, 0x08, 0x30, 0x40, 0x30, 0x00,
+0x40, 0xE0, 0x01, 0x70, 0x50, 0x40, 0x70, 0x31, 0x0F, 0x78, 0x0F, 0x7A, 0x50, 0x30, 0x51, 0xA0,
+0x00, 0x40, 0x70, 0x50, 0xA0, 0x01, 0xA0, 0x90, 0xC0, 0xA1, 0x07, 0xC0, 0x40, 0x80, 0xE0, 0x80,
+0x90, 0x50, 0x80, 0x01, 0x30, 0xC0, 0x00, 0xC0, 0x80, 0x01, 0x10, 0xE0, 0x50, 0x40, 0xE0, 0xA0,
+0x70, 0xA0, 0x30, 0x60, 0xB1, 0xF0, 0xD4, 0x60, 0xD0, 0xF0, 0xD0, 0x21, 0xF1, 0x20, 0xF0, 0x20,
+0xF0, 0x20, 0xF3, 0xB1, 0xF3, 0x20, 0xF1, 0x21, 0xF1, 0x21, 0xF1, 0xD0, 0x60, 0xD3, 0xF1, 0xD0,
+0xB0, 0x60, 0x30, 0xA0, 0x70, 0xA0, 0xE0, 0x40, 0x90, 0x70, 0x10, 0x01, 0x80, 0xC0, 0x01, 0x30,
+0x01, 0x41, 0xC0, 0x80, 0xE0, 0x30, 0x40, 0x50, 0x0C, 0xC0, 0xE0, 0x01, 0xE0, 0x50, 0x00, 0x70,
+0x50, 0x00, 0x50, 0x90, 0x0F, 0x79, 0x0F, 0x7E, 0xA0, 0xE1, 0x00, 0x81, 0x01, 0x10, 0x0F, 0x00,
+0xC0, 0x40, 0x30, 0xA1, 0x40, 0x70, 0x01, 0x50, 0x80, 0x01, 0x10, 0x30, 0x01, 0xA0, 0x01, 0x80,
+0x41, 0x80, 0xE0, 0x30, 0xA0, 0x71, 0xA0, 0x31, 0x60, 0xB0, 0xF0, 0xDC, 0xF0, 0xB0, 0xDD, 0xB0,
+0x60, 0x31, 0xA0, 0x70, 0xA1, 0x30, 0xE0, 0x30, 0x41, 0x30, 0x01, 0x30, 0x01, 0x40, 0x10, 0xC0,
+0x00, 0x90, 0x40, 0x01, 0xA0, 0x40, 0xA1, 0x30, 0x80, 0x50, 0x0F, 0x02, 0xA0, 0x90, 0x00, 0x50,
+0xE1, 0x80, 0x0F, 0x7D, 0x0F, 0x82, 0x90, 0x70, 0xC0, 0xA0, 0x80, 0x0F, 0x05, 0x50, 0x80, 0xA0,
+0x30, 0x70, 0x30, 0x50, 0x90, 0x10, 0x90, 0x00, 0xC0, 0x80, 0x01, 0x30, 0xC0, 0x01, 0x30, 0x01,
+0x40, 0x50, 0x00, 0x50, 0x70, 0x40, 0x30, 0x71, 0xA1, 0xE0, 0x30, 0xAF, 0x02, 0x30, 0xE0, 0xA1,
+0x70, 0xE0, 0x30, 0x40, 0xA0, 0x90, 0x00, 0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0xA0, 0x01, 0x40,
+0x50, 0x00, 0xC0, 0x10, 0x40, 0x50, 0x80, 0xE0, 0x30, 0xA0, 0x80, 0x90, 0x0F, 0x07, 0x50, 0xE0,
+0x0F, 0x82, 0x0F, 0x83, 0x40, 0x70, 0x80, 0x0F, 0x0A, 0xC0, 0x50, 0x40, 0x30, 0x70, 0x30, 0x40,
+0x30, 0x80, 0xC0, 0x00, 0x30, 0x02, 0xA0, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x01, 0x91, 0x01, 0xA0,
+0x01, 0x41, 0x01, 0xA0, 0xC0, 0x00, 0x70, 0xE0, 0xC1, 0xA0, 0xC0, 0x00, 0x50, 0x80, 0x01, 0xA0,
+0x01, 0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x00, 0xC0, 0x40,
+0xA0, 0x40, 0x80, 0xE0, 0xA0, 0x40, 0x50, 0x00, 0x40, 0x90, 0x01, 0x80, 0x30, 0x40, 0x0F, 0x05,
+0x50, 0x0F, 0x82, 0x0F, 0x9E, 0x50, 0x70, 0x02, 0x80, 0x90, 0x00, 0x50, 0x90, 0x40, 0x80, 0x30,
+0xE0, 0x30, 0x41, 0x30, 0x01, 0xA0, 0x02, 0x80, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x40, 0x90,
+0x01, 0x30, 0x01, 0x70, 0xE0, 0x01, 0x30, 0x01, 0xC0, 0x30, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01,
+0x40, 0x50, 0x01, 0xA0, 0x01, 0x81, 0x40, 0x80, 0xE0, 0x30, 0x80, 0x40, 0x90, 0x50, 0xC0, 0x00,
+0xC0, 0x90, 0x00, 0x80, 0xA0, 0x30, 0xA0, 0x00, 0x30, 0xC0, 0x80, 0x0F, 0x98, 0x0F, 0x9D, 0x30,
+0xE0, 0x70, 0x01, 0x10, 0x40, 0x30, 0x80, 0x01, 0x90, 0xC0, 0x02, 0x50, 0x40, 0x80, 0x31, 0x70,
+0x30, 0xA0, 0x70, 0xE0, 0x40, 0x90, 0xA0, 0x90, 0xC1, 0x30, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01,
+0x70, 0xE0, 0x01, 0x30, 0x02, 0x30, 0x01, 0x30, 0xC1, 0x90, 0xA0, 0x90, 0x40, 0x71, 0xA0, 0x30,
+0x70, 0x31, 0x80, 0x40, 0x90, 0xC0, 0x02, 0x80, 0x00, 0xC0, 0xE1, 0x70, 0x10, 0xC0, 0xE0, 0x01,
+0x70, 0x51, 0x80, 0xC0, 0x0F, 0x98, 0x0F, 0x9E, 0x90, 0x30, 0x00, 0x40, 0x30, 0x01, 0x70, 0x00,
+0xE0, 0x30, 0x70, 0x80, 0x00, 0x31, 0x50, 0x06, 0xC0, 0x50, 0x41, 0x81, 0x30, 0xA4, 0x31, 0x70,
+0x31, 0x70, 0xE0, 0x31, 0x70, 0x31, 0xA3, 0x32, 0x80, 0x41, 0x50, 0xC0, 0x0B, 0x80, 0x10, 0x03,
+0x81, 0x00, 0xE0, 0x01, 0x81, 0x0F, 0x9B, 0x0F, 0x9E, 0x30, 0x40, 0x00, 0x90, 0x70, 0x00, 0x50,
+0xE0, 0x90, 0xA0, 0x00, 0xC0, 0x70, 0x00, 0x30, 0x90, 0x40, 0x0F, 0x04, 0xC0, 0x02, 0xC0, 0x03,
+0xC1, 0x02, 0xC0, 0x0F, 0x03, 0x90, 0x30, 0x70, 0x50, 0x02, 0xE0, 0xC0, 0x00, 0xE0, 0xC0, 0x00,
+0x90, 0xA0, 0x0F, 0x9B, 0x0F, 0x9E, 0x70, 0x50, 0x01, 0x30, 0x71, 0xA0, 0x80, 0x40, 0x00, 0xC0,
+0xE0, 0x00, 0x50, 0x40, 0x0F, 0x04, 0x50, 0xA0, 0x01, 0x40, 0x71, 0x90, 0x00, 0x90, 0x71, 0x40,
+0x00, 0x82, 0x0F, 0x04, 0x30, 0x40, 0x02, 0xE0, 0x01, 0x81, 0x00, 0x90, 0x30, 0x0F, 0x9B, 0x0F,
+0x9E, 0xE0, 0x01, 0x30, 0x01, 0x80, 0x40, 0x70, 0x50, 0x00, 0x90, 0x70, 0x0F, 0x06, 0x40, 0x10,
+0x70, 0x01, 0xE0, 0x00, 0xC0, 0xE0, 0x00, 0xE0, 0xC0, 0x00, 0xE0, 0x00, 0x30, 0x40, 0x30, 0x0F,
+0x04, 0x40, 0x30, 0x01, 0x50, 0x70, 0x02, 0x10, 0x80, 0xE0, 0x50, 0x0F, 0x9B, 0x0F, 0x9E, 0x80,
+0x01, 0x90, 0xE0, 0xA1, 0x00, 0x70, 0x50, 0x00, 0x30, 0x40, 0x0F, 0x06, 0x50, 0x00, 0x70, 0x01,
+0x30, 0x80, 0x30, 0x80, 0x00, 0xE0, 0x01, 0xA0, 0x50, 0x00, 0x90, 0x0F, 0x05, 0xC0, 0xE0, 0x01,
+0x90, 0x70, 0x03, 0x40, 0xC0, 0x0F, 0x9C, 0x0F, 0xA2, 0xC1, 0x01, 0x90, 0x70, 0x30, 0x70, 0x0F,
+0x08, 0xC0, 0xE0, 0x01, 0xA0, 0x30, 0xA0, 0x30, 0x00, 0xE0, 0x01, 0xA0, 0x90, 0x0F, 0x08, 0xA0,
+0x01, 0xC0, 0x90, 0x0F, 0xA2, 0x0F, 0xA7, 0x50, 0x40, 0x0F, 0x09, 0xC0, 0xE0, 0x00, 0x50, 0xE0,
+0x01, 0x70, 0x50, 0xE0, 0x01, 0x70, 0x50, 0x0F, 0xBF, 0x0F, 0xC2, 0xC0, 0xE0, 0x00, 0xC0, 0x10,
+0x00, 0xC0, 0xE0, 0x00, 0x70, 0x50, 0xC0, 0xE0, 0x0F, 0xC0, 0x0F, 0xC3, 0x80, 0x01, 0x50, 0x71,
+0x50, 0x01, 0x71, 0xC0, 0x0F, 0xC0, 0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xFF,
+0x0F, 0x90};
+
+const Map_Image EM29_4000_image = {431, 428, EM29_4000_palette, EM29_4000_rows, EM29_4000_data};
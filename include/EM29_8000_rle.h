@@ -0,0 +1,4077 @@
+// Generated by maps/compress_map.py from EM29_8000.h, do not edit
+// Image Size : 428x432 pixels, 64393 bytes compressed from 369792
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t EM29_8000_palette[16] PROGMEM = {
+0xFFFF, 0x0021, 0x867C, 0x632C, 0x6D16, 0xB5D7, 0x29E8, 0xCE9A,
+0x8430, 0x9D14, 0x428A, 0x7DB9, 0x1124, 0x8E7C, 0x53D0, 0xE75D};
+
+const uint32_t EM29_8000_rows[432] PROGMEM = {
+0, 12, 16, 20, 31, 47, 67, 95, 130, 169, 208, 263,
+330, 406, 482, 564, 644, 734, 824, 924, 1019, 1108, 1191, 1277,
+1361, 1438, 1514, 1596, 1683, 1770, 1858, 1960, 2068, 2180, 2314, 2461,
+2593, 2720, 2829, 2961, 3088, 3203, 3327, 3436, 3544, 3658, 3774, 3900,
+4028, 4154, 4287, 4427, 4562, 4715, 4877, 5028, 5165, 5312, 5462, 5608,
+5754, 5913, 6072, 6244, 6387, 6527, 6668, 6813, 6949, 7081, 7213, 7363,
+7532, 7682, 7823, 7973, 8119, 8273, 8434, 8601, 8774, 8964, 9145, 9324,
+9498, 9688, 9865, 10047, 10225, 10401, 10576, 10741, 10900, 11083, 11272, 11464,
+11652, 11842, 12019, 12224, 12410, 12590, 12787, 12967, 13138, 13339, 13545, 13747,
+13950, 14148, 14347, 14550, 14749, 14950, 15138, 15343, 15547, 15731, 15920, 16118,
+16318, 16527, 16728, 16936, 17126, 17321, 17512, 17708, 17900, 18090, 18277, 18486,
+18694, 18906, 19138, 19358, 19564, 19766, 19948, 20126, 20312, 20495, 20689, 20874,
+21057, 21247, 21446, 21649, 21867, 22071, 22297, 22503, 22690, 22891, 23102, 23294,
+23490, 23685, 23858, 24037, 24218, 24400, 24588, 24765, 24939, 25123, 25298, 25495,
+25694, 25876, 26071, 26252, 26430, 26612, 26798, 26998, 27195, 27369, 27547, 27725,
+27899, 28065, 28246, 28425, 28599, 28787, 28970, 29141, 29305, 29466, 29620, 29796,
+29962, 30102, 30254, 30408, 30572, 30730, 30879, 31024, 31182, 31318, 31450, 31592,
+31733, 31890, 32051, 32208, 32368, 32523, 32650, 32761, 32883, 33007, 33107, 33195,
+33293, 33430, 33525, 33675, 33816, 34095, 34227, 34366, 34506, 34645, 34803, 34939,
+35067, 35191, 35316, 35447, 35570, 35696, 35804, 35928, 36072, 36221, 36347, 36478,
+36615, 36774, 36922, 37076, 37230, 37396, 37554, 37725, 37881, 38060, 38223, 38370,
+38536, 38706, 38882, 39045, 39211, 39401, 39594, 39774, 39949, 40129, 40305, 40496,
+40675, 40867, 41040, 41215, 41382, 41550, 41717, 41898, 42070, 42247, 42418, 42614,
+42789, 42971, 43159, 43340, 43507, 43700, 43905, 44112, 44314, 44517, 44717, 44916,
+45116, 45319, 45510, 45703, 45901, 46095, 46289, 46481, 46665, 46851, 47041, 47248,
+47456, 47672, 47861, 48032, 48192, 48361, 48527, 48680, 48841, 49002, 49146, 49295,
+49454, 49614, 49786, 49944, 50094, 50253, 50405, 50554, 50714, 50887, 51072, 51244,
+51410, 51590, 51769, 51945, 52108, 52260, 52423, 52575, 52716, 52877, 53018, 53157,
+53299, 53450, 53600, 53731, 53873, 54021, 54170, 54326, 54481, 54626, 54788, 54940,
+55108, 55269, 55423, 55578, 55741, 55900, 56038, 56181, 56316, 56459, 56586, 56706,
+56830, 56953, 57070, 57182, 57299, 57412, 57537, 57648, 57771, 57899, 58048, 58204,
+58355, 58497, 58646, 58804, 58957, 59110, 59256, 59398, 59542, 59677, 59817, 59946,
+60062, 60177, 60298, 60412, 60530, 60661, 60785, 60916, 61047, 61175, 61303, 61423,
+61557, 61690, 61831, 61969, 62100, 62217, 62325, 62420, 62517, 62606, 62697, 62798,
+62895, 62999, 63104, 63202, 63300, 63408, 63520, 63622, 63707, 63785, 63870, 63948,
+64024, 64096, 64136, 64181, 64229, 64279, 64312, 64340, 64357, 64374, 64385, 64389};
+
+const uint8_t EM29_8000_data[64393] PROGMEM = {
+0x0F, 0xB1, 0x90, 0xF0, 0x0F, 0x20, 0xF0, 0x0F, 0x0D, 0xF0, 0x0F, 0x8A, 0x0F, 0xFF, 0x0F, 0x8D,
+0x0F, 0xFF, 0x0F, 0x8D, 0x0F, 0xC6, 0x30, 0xC0, 0xA0, 0x00, 0xF0, 0x31, 0xF0, 0x0F, 0xBE, 0x0F,
+0xAB, 0x50, 0x80, 0x0F, 0x08, 0x50, 0x60, 0x00, 0x81, 0x70, 0x80, 0x90, 0x50, 0x0F, 0xBE, 0x0F,
+0xA7, 0x50, 0x90, 0x00, 0xF0, 0x30, 0x70, 0x80, 0x0F, 0x07, 0x30, 0x90, 0x00, 0x70, 0x60, 0x00,
+0x51, 0x0F, 0xBF, 0x0F, 0xA1, 0x50, 0xA0, 0x60, 0xE0, 0x00, 0x80, 0x30, 0x80, 0xA0, 0x00, 0x80,
+0x30, 0x70, 0x0F, 0x07, 0x30, 0x50, 0x00, 0xF0, 0xC0, 0x0F, 0x0F, 0x50, 0x60, 0x0F, 0xA1, 0x0F,
+0x9C, 0xF0, 0xA1, 0xF0, 0x00, 0x60, 0x50, 0x02, 0xC0, 0x01, 0x60, 0x70, 0x0F, 0x0A, 0x30, 0x90,
+0x00, 0x70, 0x60, 0x0F, 0x0E, 0xA0, 0xC0, 0xA0, 0x01, 0x90, 0xC0, 0x60, 0xF0, 0x00, 0x90, 0x30,
+0x0F, 0x98, 0x0F, 0x9C, 0xC0, 0x70, 0x50, 0x60, 0x00, 0xA0, 0x90, 0xA0, 0x90, 0x00, 0xC0, 0xF0,
+0x00, 0x80, 0xE0, 0x0F, 0x0A, 0x70, 0x60, 0x00, 0x81, 0x0F, 0x0F, 0x90, 0xE0, 0x00, 0x70, 0xC0,
+0x00, 0x50, 0xA0, 0x00, 0xE0, 0x70, 0x90, 0x0F, 0x97, 0x0F, 0x9C, 0x90, 0x00, 0x90, 0x30, 0x00,
+0xA0, 0x80, 0xF0, 0x60, 0x50, 0xA0, 0x70, 0x00, 0x50, 0xA0, 0x0F, 0x06, 0xF4, 0xA0, 0xC0, 0xA0,
+0xF4, 0x0F, 0x0B, 0x30, 0x50, 0x00, 0x81, 0x00, 0x70, 0x60, 0x00, 0x80, 0x30, 0xF0, 0x0F, 0x97,
+0x0F, 0x9D, 0x70, 0xC0, 0x60, 0xF0, 0x02, 0x70, 0xA0, 0x81, 0x00, 0x50, 0x30, 0x07, 0xF1, 0x70,
+0x50, 0x90, 0x80, 0x32, 0xA2, 0x30, 0x60, 0x30, 0x80, 0x30, 0xA0, 0x81, 0x10, 0xA0, 0x80, 0x30,
+0x60, 0x80, 0x30, 0xA0, 0x30, 0xA1, 0x60, 0x32, 0x80, 0x91, 0x71, 0xF0, 0x0C, 0x60, 0xF0, 0x00,
+0xA0, 0x50, 0x00, 0x50, 0xA0, 0x0F, 0x9B, 0x0F, 0x9F, 0x90, 0xA0, 0x91, 0x00, 0x81, 0x00, 0xC0,
+0x80, 0xC0, 0xF0, 0x00, 0x50, 0x90, 0x30, 0xA1, 0x30, 0x60, 0x30, 0x80, 0x60, 0x90, 0x50, 0x70,
+0xA0, 0x01, 0x51, 0x01, 0xA0, 0x01, 0x70, 0x90, 0x01, 0x10, 0x80, 0x01, 0x80, 0x01, 0x80, 0xF0,
+0x01, 0xA0, 0x01, 0x90, 0x80, 0x70, 0x50, 0xC0, 0x80, 0x31, 0x60, 0xA1, 0x30, 0x80, 0x90, 0xF0,
+0x04, 0xC0, 0x01, 0xA0, 0x70, 0x00, 0x80, 0x30, 0x0F, 0x9B, 0x0F, 0x87, 0x50, 0x30, 0x0F, 0x03,
+0x90, 0x80, 0x00, 0x90, 0x30, 0x00, 0x61, 0xA0, 0x70, 0x90, 0x80, 0x60, 0x30, 0xA0, 0x60, 0x90,
+0x70, 0x30, 0xF0, 0x01, 0xA0, 0x01, 0x90, 0x70, 0x01, 0x30, 0x01, 0x70, 0x90, 0x01, 0xA0, 0x01,
+0x70, 0x90, 0x00, 0xF0, 0x10, 0x80, 0x00, 0xF0, 0x80, 0x01, 0x80, 0x02, 0xA0, 0x01, 0x90, 0x50,
+0x01, 0x30, 0x01, 0x70, 0x90, 0x01, 0x30, 0x70, 0x50, 0x30, 0xC0, 0x31, 0x81, 0xA0, 0xF0, 0x00,
+0x81, 0x00, 0xC0, 0xF0, 0x0F, 0x9B, 0x0F, 0x84, 0x70, 0x00, 0xF0, 0x30, 0xF0, 0x80, 0x0F, 0x03,
+0x60, 0xA0, 0xC0, 0x91, 0x30, 0xC1, 0x90, 0x70, 0x30, 0xF0, 0x00, 0xF0, 0x80, 0x01, 0x80, 0x70,
+0x01, 0xA0, 0x01, 0x51, 0x01, 0x30, 0x01, 0x70, 0x30, 0x70, 0xF0, 0x60, 0x51, 0x80, 0x30, 0x50,
+0x90, 0x10, 0xA0, 0x50, 0x90, 0xA0, 0x51, 0xA0, 0x50, 0x71, 0xA0, 0x01, 0x80, 0xF0, 0x01, 0x30,
+0x01, 0x51, 0x01, 0xA0, 0x01, 0x70, 0x90, 0x01, 0x30, 0x51, 0xA0, 0x10, 0xA0, 0xC0, 0x10, 0x80,
+0x0F, 0x9C, 0x0F, 0x82, 0xF0, 0xA0, 0x60, 0xA0, 0x00, 0x80, 0x30, 0x70, 0x0F, 0x00, 0xF0, 0x70,
+0x90, 0x30, 0xA0, 0x90, 0xC0, 0x70, 0x00, 0x30, 0x10, 0x01, 0x90, 0x70, 0x01, 0x30, 0x01, 0x51,
+0x01, 0xA0, 0x70, 0x50, 0xA0, 0xC0, 0xA1, 0xC0, 0xA0, 0x60, 0xC2, 0x60, 0xA1, 0x31, 0x82, 0x30,
+0x80, 0x30, 0x81, 0x31, 0xA1, 0x60, 0x11, 0xA1, 0xC2, 0x60, 0xC0, 0x80, 0x50, 0x80, 0x50, 0xF1,
+0x30, 0x01, 0x90, 0x50, 0x01, 0x30, 0x01, 0x30, 0x10, 0xF0, 0x00, 0x30, 0x80, 0x30, 0xA0, 0x30,
+0x50, 0x70, 0x0F, 0x97, 0x0F, 0x7F, 0x50, 0x70, 0x00, 0x80, 0x90, 0x00, 0x30, 0x80, 0x0F, 0x00,
+0x90, 0xA1, 0x30, 0x91, 0x80, 0x01, 0x80, 0xF0, 0x00, 0x90, 0x10, 0xF0, 0x00, 0x51, 0x01, 0xC0,
+0x30, 0xA0, 0xC0, 0x10, 0xC1, 0xA0, 0x30, 0x80, 0x90, 0x80, 0x70, 0x0E, 0x70, 0x08, 0xA0, 0xC0,
+0x00, 0xF0, 0xA1, 0x60, 0x50, 0x80, 0x90, 0x80, 0x30, 0xA0, 0xC0, 0x11, 0xA0, 0x30, 0xA0, 0x50,
+0x01, 0xA0, 0x01, 0xC1, 0x01, 0x30, 0x02, 0xA0, 0x50, 0x80, 0xA1, 0x80, 0xF0, 0x0F, 0x02, 0x70,
+0xC1, 0x80, 0x0F, 0x7D, 0x0F, 0x7F, 0x60, 0xA0, 0x00, 0x30, 0x90, 0x01, 0xC0, 0x0A, 0xF0, 0x90,
+0x30, 0xA0, 0x60, 0x50, 0x00, 0x30, 0x02, 0x30, 0x01, 0x51, 0x00, 0x70, 0x10, 0xA0, 0x30, 0xC0,
+0x10, 0xC0, 0xA0, 0x80, 0x90, 0xF0, 0x07, 0x90, 0x07, 0x90, 0x80, 0x30, 0x10, 0x51, 0x01, 0x50,
+0xF0, 0x08, 0x60, 0x11, 0x60, 0x50, 0xA0, 0x71, 0x02, 0x80, 0x90, 0x02, 0x90, 0x80, 0x30, 0x60,
+0x11, 0xA0, 0x80, 0x10, 0xA0, 0x01, 0x30, 0x01, 0x50, 0x90, 0x01, 0x30, 0x00, 0x70, 0x30, 0xC0,
+0x30, 0x80, 0x70, 0x0D, 0x90, 0x70, 0x00, 0xA0, 0x90, 0x00, 0xF0, 0x70, 0x0F, 0x79, 0x0F, 0x79,
+0x70, 0x31, 0x01, 0xF0, 0xA0, 0xC0, 0x00, 0x50, 0xA0, 0x01, 0xA0, 0x50, 0x05, 0xF0, 0x50, 0x80,
+0x30, 0xC0, 0x90, 0x01, 0x30, 0x01, 0x90, 0x50, 0x01, 0x30, 0x70, 0x50, 0x30, 0x10, 0xC0, 0xA1,
+0x80, 0x70, 0x0E, 0x90, 0x07, 0x50, 0xA0, 0x30, 0x00, 0x90, 0x10, 0x01, 0x50, 0xF0, 0x09, 0x70,
+0xF0, 0x90, 0xE1, 0x90, 0x70, 0x01, 0x30, 0xE0, 0x60, 0x08, 0xF0, 0x50, 0x30, 0xA0, 0x60, 0xC1,
+0x50, 0x70, 0x30, 0xF0, 0x01, 0x30, 0x01, 0x70, 0x80, 0x00, 0x70, 0xA1, 0x30, 0x90, 0x70, 0x0C,
+0xA0, 0x50, 0x90, 0x60, 0xA0, 0x30, 0x0F, 0x78, 0x0F, 0x79, 0xC0, 0x50, 0x80, 0x30, 0x00, 0x50,
+0x80, 0x30, 0x90, 0x00, 0x60, 0xF0, 0x00, 0x30, 0x90, 0x02, 0xF0, 0x50, 0x30, 0xA1, 0x70, 0x00,
+0x80, 0x70, 0x01, 0x30, 0x01, 0x70, 0x30, 0x80, 0xA0, 0xC0, 0x60, 0x30, 0x50, 0x70, 0x01, 0x70,
+0xF0, 0x0F, 0x00, 0x90, 0x0B, 0x70, 0xA0, 0x01, 0x50, 0x00, 0x50, 0x60, 0xF0, 0x08, 0x50, 0xE0,
+0xA0, 0xF0, 0x70, 0x01, 0x80, 0xE0, 0x80, 0xE0, 0x09, 0x50, 0x01, 0x71, 0x80, 0x60, 0xC0, 0x60,
+0x30, 0x90, 0x30, 0x01, 0x90, 0x50, 0x01, 0x30, 0x00, 0xF0, 0x90, 0xA1, 0x80, 0x70, 0x07, 0x50,
+0xA1, 0xF0, 0x60, 0xF0, 0x00, 0xC0, 0x00, 0x50, 0xA0, 0x50, 0x0F, 0x74, 0x0F, 0x78, 0xF0, 0x30,
+0x00, 0x90, 0xE0, 0x00, 0x80, 0x70, 0x50, 0x10, 0x80, 0x90, 0xC0, 0x70, 0x60, 0xF0, 0x00, 0x80,
+0xA0, 0xC0, 0x80, 0x01, 0x30, 0x01, 0x50, 0x90, 0x01, 0x30, 0xA0, 0x60, 0x10, 0x30, 0x90, 0x50,
+0x06, 0xF0, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0xC0, 0x10, 0x60, 0x08, 0x30, 0x81,
+0x71, 0x01, 0xF0, 0x60, 0x70, 0xE0, 0x30, 0x08, 0x90, 0x06, 0x70, 0x90, 0x80, 0xC1, 0x30, 0x60,
+0x01, 0xF0, 0x30, 0x01, 0x90, 0x50, 0x00, 0x70, 0xC0, 0xA0, 0x30, 0x70, 0x02, 0x90, 0xC0, 0xA0,
+0x50, 0x00, 0x81, 0x01, 0xC0, 0xF0, 0x30, 0x00, 0xA0, 0x0F, 0x74, 0x0F, 0x7A, 0x70, 0x60, 0xC0,
+0x90, 0x60, 0x10, 0xA0, 0x10, 0x01, 0x70, 0x60, 0xA1, 0xC0, 0x70, 0x00, 0x50, 0x90, 0x01, 0x80,
+0xF0, 0x00, 0x50, 0xC2, 0x30, 0x90, 0x0C, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0x60,
+0x10, 0x70, 0x01, 0xF0, 0x50, 0x03, 0xE1, 0xA0, 0x71, 0xF0, 0x02, 0xE0, 0x60, 0xD0, 0xA0, 0x30,
+0x05, 0x50, 0xF0, 0x50, 0x0B, 0x70, 0x30, 0x60, 0x10, 0x60, 0x30, 0x01, 0x30, 0xF0, 0x01, 0xA0,
+0x01, 0x30, 0xC0, 0x30, 0x80, 0x10, 0x30, 0xF0, 0x01, 0xC0, 0xF0, 0x00, 0x70, 0x60, 0x00, 0x50,
+0xA0, 0x70, 0x0F, 0x74, 0x0F, 0x7D, 0xC0, 0x70, 0x01, 0x92, 0xA0, 0x80, 0xF0, 0x00, 0xA0, 0x02,
+0x30, 0x00, 0xF0, 0x30, 0x10, 0x60, 0xA0, 0x80, 0xF0, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0x0F,
+0x00, 0x50, 0x00, 0x30, 0xC0, 0xF0, 0x01, 0x50, 0x10, 0x80, 0x70, 0x01, 0xA0, 0x50, 0xA0, 0x00,
+0x50, 0xF0, 0x02, 0x60, 0x40, 0xD1, 0x60, 0xF0, 0x02, 0x61, 0xC0, 0x30, 0xF0, 0x0F, 0x00, 0x90,
+0x30, 0x60, 0xC1, 0x70, 0x00, 0x50, 0x90, 0x01, 0x80, 0xF0, 0x00, 0x50, 0xC0, 0x60, 0x10, 0xA0,
+0x00, 0x60, 0x01, 0xA0, 0x50, 0x0F, 0x78, 0x0F, 0x7A, 0x80, 0x00, 0xF0, 0xC0, 0x00, 0xF0, 0x50,
+0x60, 0x30, 0x71, 0x30, 0x01, 0x90, 0x50, 0x00, 0xF0, 0x60, 0xA0, 0xC0, 0x80, 0x70, 0x01, 0x71,
+0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0x0E, 0x50, 0xF0, 0x10, 0x80, 0x70, 0x02, 0x90, 0x10,
+0x60, 0xA0, 0x00, 0x90, 0x30, 0x80, 0x00, 0x90, 0x02, 0x90, 0xE0, 0xD0, 0x20, 0xD1, 0x60, 0x90,
+0x01, 0x60, 0xD0, 0xC0, 0xE0, 0x91, 0x0E, 0x50, 0x01, 0x70, 0x50, 0xA0, 0x60, 0x10, 0x50, 0x01,
+0xA0, 0x02, 0x30, 0xF0, 0x90, 0xC0, 0x80, 0xA0, 0x30, 0x80, 0x60, 0x0F, 0x79, 0x0F, 0x7A, 0x30,
+0xC0, 0x60, 0x90, 0x31, 0x90, 0x10, 0x30, 0x01, 0xA0, 0x01, 0x70, 0x10, 0xC1, 0x90, 0x70, 0x04,
+0xF0, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0x0E, 0x50, 0x00, 0x80, 0x10, 0xA0, 0x80,
+0x01, 0x90, 0xF0, 0xA1, 0x00, 0x50, 0xA0, 0x60, 0x00, 0x90, 0x02, 0x60, 0x40, 0xD0, 0x21, 0xD1,
+0xE0, 0x60, 0xA0, 0xE0, 0xD0, 0x40, 0x80, 0xE0, 0xA1, 0x50, 0xA0, 0xF0, 0x09, 0xF0, 0x50, 0x05,
+0x50, 0x30, 0xC0, 0x60, 0xA0, 0x01, 0x90, 0x50, 0x00, 0xF0, 0x10, 0x30, 0x80, 0xC0, 0x60, 0x0F,
+0x7A, 0x0F, 0x7B, 0x90, 0x30, 0x80, 0x30, 0x01, 0x60, 0x10, 0x01, 0x30, 0xA0, 0x10, 0xA0, 0x90,
+0x09, 0x90, 0x0F, 0x00, 0x71, 0x0E, 0x71, 0x0E, 0x50, 0xF0, 0x00, 0x80, 0xA1, 0x30, 0xF0, 0x10,
+0xC0, 0xA0, 0xC0, 0xE0, 0xA0, 0x30, 0x80, 0x00, 0x50, 0x01, 0x50, 0x10, 0x40, 0xD2, 0x20, 0xD1,
+0xB0, 0x61, 0xB0, 0xD0, 0x40, 0xD1, 0xB0, 0x40, 0x90, 0x10, 0x50, 0x08, 0x50, 0xF0, 0x08, 0x70,
+0x30, 0x10, 0xA0, 0xC0, 0x01, 0x30, 0x10, 0xF0, 0x00, 0x70, 0x32, 0x70, 0x0F, 0x77, 0x0F, 0x78,
+0x50, 0x30, 0xC0, 0x90, 0x01, 0x30, 0xF0, 0x00, 0x50, 0x10, 0x30, 0xC0, 0xA0, 0x50, 0x0C, 0x50,
+0x0F, 0x00, 0xF0, 0x50, 0x0E, 0x71, 0x0E, 0x50, 0xF0, 0x01, 0x50, 0xA0, 0x80, 0x60, 0x10, 0xA0,
+0xE0, 0xC0, 0x50, 0x40, 0xE0, 0x01, 0x50, 0xF0, 0x60, 0xE0, 0xB0, 0xD2, 0x20, 0xD3, 0xA0, 0xE1,
+0xD0, 0x40, 0xD2, 0x60, 0x10, 0x90, 0x60, 0x90, 0x07, 0x50, 0x0C, 0x70, 0x30, 0xC0, 0x30, 0x10,
+0xC0, 0x01, 0x30, 0xF0, 0x01, 0x60, 0x30, 0x90, 0x0F, 0x75, 0x0F, 0x65, 0xF1, 0x0E, 0x50, 0x60,
+0x80, 0xF0, 0x70, 0x80, 0x01, 0x50, 0x90, 0x50, 0x60, 0xC0, 0x90, 0xF0, 0x0E, 0x71, 0x0F, 0x00,
+0x90, 0x0E, 0x71, 0x0C, 0x90, 0x51, 0xF0, 0x01, 0x70, 0xE0, 0x60, 0xA0, 0x40, 0xD0, 0xE0, 0x60,
+0x70, 0xA0, 0xF0, 0x00, 0xF0, 0x50, 0xA0, 0xD7, 0x20, 0xD1, 0x40, 0xE0, 0xD1, 0x40, 0xD2, 0xB0,
+0x40, 0xE0, 0x60, 0xA1, 0xE1, 0x51, 0xF0, 0xE0, 0x60, 0x80, 0x0F, 0x00, 0x50, 0xA0, 0xC0, 0x30,
+0x70, 0x30, 0x01, 0x70, 0x80, 0x00, 0x50, 0xA0, 0x80, 0x70, 0x0F, 0x72, 0x0F, 0x65, 0x31, 0x50,
+0x0B, 0x80, 0xA0, 0x50, 0x30, 0x70, 0x01, 0x30, 0x00, 0x70, 0xA0, 0x10, 0x30, 0x70, 0x00, 0x70,
+0x0F, 0x01, 0x50, 0x0F, 0x00, 0x50, 0x0E, 0xF0, 0x50, 0x0D, 0x10, 0x50, 0x02, 0xF0, 0xC0, 0xB1,
+0xD2, 0x10, 0xB0, 0x80, 0xA0, 0x70, 0x00, 0xE0, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0,
+0x21, 0xD0, 0xB0, 0xC0, 0xE0, 0xD7, 0x70, 0xD0, 0xB1, 0xA0, 0x61, 0x80, 0x50, 0x60, 0x90, 0x01,
+0xF0, 0x80, 0x0B, 0x70, 0x00, 0x90, 0xC1, 0x90, 0x00, 0x30, 0xF0, 0x01, 0x30, 0x50, 0x30, 0xA0,
+0x70, 0x0F, 0x70, 0x0F, 0x62, 0x50, 0x70, 0x00, 0xA0, 0x80, 0x50, 0x08, 0x70, 0x30, 0xA1, 0x01,
+0xF0, 0x30, 0x01, 0x30, 0x10, 0xA0, 0x70, 0x03, 0x90, 0x0F, 0x01, 0x90, 0x0F, 0x00, 0x50, 0x0F,
+0x00, 0x50, 0x0C, 0x11, 0x31, 0x60, 0xA0, 0x60, 0x40, 0xD1, 0xB0, 0xC0, 0xA0, 0xD2, 0x60, 0xC0,
+0x10, 0x40, 0xD2, 0x22, 0xD2, 0x21, 0xD1, 0xB0, 0x60, 0xA0, 0xC0, 0xD1, 0x22, 0xD1, 0x61, 0xE0,
+0xD3, 0x40, 0x90, 0x30, 0x71, 0xA0, 0xC0, 0x10, 0xF0, 0x09, 0x50, 0xF0, 0x03, 0x80, 0x10, 0xC0,
+0xF0, 0x00, 0xF0, 0x30, 0x01, 0x50, 0xA1, 0x90, 0x0F, 0x6E, 0x0F, 0x61, 0x60, 0x30, 0xC0, 0x90,
+0x00, 0xF0, 0x07, 0x50, 0xA1, 0x01, 0x30, 0x70, 0x01, 0xA0, 0x30, 0xC0, 0x80, 0x06, 0x71, 0x0F,
+0x00, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0x09, 0xA0, 0xF0, 0x02, 0x90, 0x0C, 0xC0, 0x30, 0x90, 0x50,
+0xDB, 0xA0, 0x60, 0x40, 0xB0, 0xD1, 0x24, 0xD0, 0x22, 0xD2, 0xA0, 0x70, 0x90, 0xC0, 0xD1, 0x21,
+0xD1, 0x60, 0x00, 0x40, 0xE0, 0xD1, 0xA0, 0xE1, 0x60, 0xF0, 0x60, 0x50, 0x90, 0xA0, 0x04, 0x70,
+0x10, 0x50, 0x02, 0x90, 0x03, 0x50, 0x01, 0x30, 0xC1, 0x60, 0x02, 0xA0, 0x01, 0x50, 0xC0, 0x90,
+0x0F, 0x6C, 0x0F, 0x60, 0xF0, 0x60, 0x01, 0xC0, 0x70, 0x06, 0x70, 0x30, 0x80, 0xF0, 0x30, 0x02,
+0x30, 0x70, 0x61, 0x50, 0x09, 0x50, 0x0F, 0x00, 0x71, 0x0E, 0x71, 0x08, 0x70, 0x10, 0x03, 0x90,
+0x0C, 0x30, 0x10, 0x40, 0xD2, 0x22, 0xD3, 0x21, 0xD1, 0xB2, 0xD4, 0x20, 0xD2, 0x22, 0xD0, 0xB0,
+0x30, 0x70, 0xE0, 0x10, 0xB0, 0xD0, 0x20, 0xD2, 0x40, 0x60, 0xE0, 0xD2, 0x60, 0x00, 0x51, 0xE0,
+0xA0, 0xD1, 0xE0, 0x60, 0xA0, 0x50, 0x70, 0xF0, 0x60, 0x50, 0x60, 0x01, 0x70, 0x50, 0x02, 0xF0,
+0xC0, 0xF0, 0x70, 0x80, 0x50, 0x10, 0xC0, 0x60, 0x80, 0x70, 0x80, 0x01, 0x70, 0x80, 0x50, 0xA0,
+0x90, 0x0A, 0x80, 0xC0, 0xA0, 0xF0, 0x0F, 0x5B, 0x0F, 0x5D, 0xF0, 0x90, 0x01, 0xC0, 0x01, 0x50,
+0x60, 0x04, 0x50, 0xA0, 0xC0, 0x70, 0x01, 0x30, 0xF0, 0x00, 0x90, 0x10, 0xA0, 0x70, 0x0B, 0x90,
+0x0F, 0x01, 0x90, 0x0E, 0xF0, 0x50, 0x07, 0x90, 0x61, 0x03, 0x80, 0xC0, 0xF0, 0x0A, 0x30, 0x10,
+0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0xB1, 0xD3, 0x20, 0xD0, 0x23, 0xD2,
+0xA0, 0x51, 0x11, 0x40, 0xD0, 0x20, 0xD1, 0x20, 0xD5, 0xA0, 0x90, 0x60, 0xA0, 0xB0, 0xD2, 0xB0,
+0x40, 0x80, 0xE0, 0x30, 0xA0, 0x40, 0x70, 0xE0, 0x30, 0x90, 0x61, 0x04, 0xA0, 0x10, 0x50, 0x80,
+0xA0, 0x50, 0x00, 0x80, 0x10, 0x60, 0xF0, 0x00, 0xA0, 0x02, 0x60, 0xA0, 0x80, 0x08, 0x70, 0x00,
+0x50, 0x30, 0x0F, 0x5B, 0x0F, 0x5C, 0x50, 0x60, 0x80, 0xC0, 0x00, 0xA0, 0x90, 0x01, 0xC0, 0xF0,
+0x01, 0x50, 0x60, 0x80, 0x01, 0xA0, 0x01, 0xF0, 0xC1, 0x30, 0x0E, 0x71, 0x0F, 0x00, 0x50, 0x0F,
+0x00, 0x90, 0x01, 0x60, 0x80, 0x02, 0x80, 0xA1, 0x50, 0x03, 0x80, 0x11, 0x70, 0x08, 0x90, 0x10,
+0xB1, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD1, 0xB0, 0x21, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0xB0,
+0x60, 0x80, 0xF1, 0x00, 0xC0, 0x40, 0xD0, 0x24, 0xD2, 0x20, 0xD1, 0xE0, 0x60, 0xD3, 0x60, 0x30,
+0x91, 0x30, 0xA0, 0xD2, 0xE0, 0xA0, 0xF0, 0xE0, 0x80, 0x90, 0x02, 0x70, 0x10, 0xC2, 0x04, 0x70,
+0x60, 0xC0, 0x80, 0x01, 0x50, 0x90, 0x00, 0x50, 0x60, 0x30, 0x06, 0xF0, 0x90, 0x31, 0x00, 0x80,
+0xA0, 0xF0, 0x0F, 0x57, 0x0F, 0x59, 0x70, 0xF0, 0x00, 0x60, 0x70, 0x00, 0x60, 0x70, 0x00, 0xC0,
+0x70, 0x00, 0x60, 0xF0, 0x70, 0xA0, 0x90, 0x80, 0x70, 0x01, 0x91, 0x30, 0xC0, 0x80, 0xF0, 0x0F,
+0x01, 0x90, 0x0F, 0x00, 0x50, 0xF0, 0x0E, 0x50, 0x02, 0xC0, 0xF0, 0x00, 0xF0, 0x10, 0xA0, 0xE0,
+0x03, 0xA0, 0x60, 0x30, 0x10, 0x70, 0x06, 0x70, 0xE1, 0xD1, 0x40, 0xD1, 0xC0, 0xD3, 0x24, 0xD2,
+0x40, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0xB0, 0xA0, 0x10, 0xE0, 0x00, 0x70, 0x80, 0xE0, 0xA0,
+0xB0, 0xD0, 0x20, 0xD0, 0x22, 0xD3, 0x20, 0xD0, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0xE1, 0x03, 0xF0,
+0x60, 0xD1, 0x40, 0xE1, 0xB0, 0xA0, 0x50, 0x00, 0x30, 0x60, 0xC0, 0x60, 0x10, 0x60, 0x03, 0x50,
+0x60, 0x30, 0x51, 0xA0, 0xC0, 0x70, 0x30, 0x02, 0x30, 0x50, 0xA0, 0x90, 0x02, 0x50, 0x00, 0xF0,
+0x60, 0x30, 0x00, 0xA0, 0x80, 0x70, 0x60, 0xF0, 0x0F, 0x56, 0x0F, 0x58, 0x30, 0xA0, 0x60, 0x70,
+0xF0, 0x00, 0x90, 0x60, 0xC0, 0x90, 0x50, 0x60, 0xA1, 0x30, 0xC0, 0x01, 0xF0, 0x30, 0x01, 0xA0,
+0xC0, 0x90, 0x00, 0xF0, 0x50, 0x0F, 0x01, 0x90, 0x0F, 0x00, 0xF0, 0x50, 0x0E, 0x50, 0xF0, 0x01,
+0x90, 0x10, 0x80, 0x60, 0x11, 0x50, 0x02, 0x60, 0x10, 0x50, 0x00, 0x70, 0x10, 0x70, 0x03, 0x50,
+0x60, 0xE0, 0x40, 0xD2, 0xB0, 0xD0, 0xA0, 0xD2, 0x20, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0x20,
+0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0xC1, 0x60, 0xE0, 0x00, 0x70, 0x30, 0xE0, 0x40, 0xB0, 0xD0,
+0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x21, 0x40, 0xD1, 0x20, 0xD0, 0xE0, 0x50, 0x04, 0x50, 0xE0,
+0xD1, 0x40, 0xE0, 0x50, 0xA0, 0x50, 0x00, 0x10, 0x60, 0x80, 0x00, 0x70, 0x03, 0x70, 0x30, 0x01,
+0x60, 0x80, 0x00, 0x70, 0x60, 0xC0, 0x70, 0x00, 0x50, 0x90, 0x01, 0x30, 0x60, 0x50, 0x00, 0xC0,
+0x70, 0x00, 0x50, 0x30, 0x90, 0xA0, 0x01, 0x60, 0xF0, 0x00, 0x70, 0x0F, 0x54, 0x0F, 0x57, 0x70,
+0xC0, 0x00, 0x90, 0x80, 0x04, 0xC0, 0x01, 0xA0, 0xE0, 0xF0, 0x80, 0x50, 0x01, 0x80, 0x60, 0xC0,
+0x90, 0x03, 0x90, 0x0F, 0x01, 0x70, 0x50, 0x0F, 0x00, 0x50, 0x0E, 0x70, 0xF0, 0x01, 0xA0, 0x80,
+0xC0, 0x60, 0xA0, 0x60, 0xF0, 0x02, 0x70, 0x80, 0x70, 0xF0, 0x00, 0x70, 0xC0, 0x00, 0x30, 0x60,
+0x30, 0x10, 0x40, 0xD1, 0x21, 0xD0, 0xB0, 0xD0, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x21,
+0xD2, 0x40, 0xD5, 0xE0, 0x60, 0x10, 0xC0, 0x90, 0x70, 0x10, 0xC0, 0x60, 0xE0, 0xD2, 0x22, 0xD2,
+0x20, 0xD1, 0x21, 0xD0, 0xB1, 0xD3, 0xA0, 0x90, 0x04, 0xF0, 0xA0, 0xD2, 0xE0, 0x80, 0x10, 0x70,
+0x00, 0x91, 0x10, 0x50, 0x04, 0x50, 0x90, 0x01, 0x50, 0x10, 0x70, 0x01, 0x70, 0x62, 0x02, 0xA0,
+0x00, 0x90, 0x32, 0x50, 0xC0, 0x50, 0xC0, 0xF0, 0x00, 0xF0, 0x60, 0x00, 0x30, 0x80, 0x90, 0x0F,
+0x53, 0x0F, 0x57, 0xF0, 0x80, 0x00, 0xC1, 0x30, 0x00, 0x50, 0x01, 0x60, 0x80, 0xA1, 0x02, 0xA0,
+0x00, 0x80, 0x10, 0x90, 0x05, 0xF0, 0x50, 0x0F, 0x01, 0x90, 0x0F, 0x00, 0x50, 0xF0, 0x0B, 0x80,
+0x60, 0xA0, 0x90, 0x30, 0x60, 0xB0, 0xD0, 0x40, 0x60, 0xC0, 0x80, 0x05, 0xF0, 0x70, 0x01, 0xC0,
+0x60, 0xE0, 0x10, 0xE0, 0xD2, 0x21, 0xD1, 0xB0, 0x20, 0xD2, 0x23, 0xD6, 0x40, 0xB0, 0x42, 0xA0,
+0x10, 0x30, 0x80, 0x01, 0xA0, 0x60, 0xC0, 0xB0, 0x70, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x40, 0xD4, 0x40, 0x30, 0x05, 0x80, 0x40, 0xD0, 0xE0, 0x61, 0x04,
+0x70, 0x05, 0x30, 0xF0, 0x00, 0xF0, 0x30, 0x00, 0x90, 0x70, 0x02, 0xF0, 0xA0, 0xC0, 0x50, 0x91,
+0x01, 0x50, 0xA0, 0xC0, 0x60, 0x71, 0x30, 0x01, 0x60, 0x90, 0x00, 0x30, 0x90, 0x80, 0x0F, 0x53,
+0x0F, 0x5A, 0x70, 0x00, 0x60, 0x70, 0x30, 0x60, 0x10, 0xC0, 0x70, 0x00, 0x90, 0x50, 0x01, 0xA0,
+0x60, 0x40, 0xE0, 0x50, 0x06, 0x90, 0x0F, 0x01, 0x50, 0xF0, 0x0E, 0x71, 0x09, 0x90, 0x30, 0xA0,
+0xE0, 0xB0, 0xE0, 0xB0, 0xD4, 0xA0, 0xF0, 0x05, 0xF0, 0x70, 0x00, 0x90, 0x30, 0xC0, 0xD3, 0x20,
+0xD1, 0x20, 0xD1, 0xB0, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0xB0, 0xA1, 0xE1, 0x81, 0x90, 0xF0, 0x02,
+0x60, 0x10, 0xA0, 0xD2, 0xB1, 0xD0, 0x26, 0xD1, 0x22, 0xD1, 0x40, 0xD4, 0x40, 0x90, 0x05, 0x70,
+0xE2, 0xF0, 0x08, 0x60, 0x31, 0x50, 0x31, 0x90, 0xA0, 0x01, 0xC0, 0x30, 0x05, 0xA0, 0x10, 0xF0,
+0x01, 0xA0, 0x01, 0x31, 0x70, 0xA0, 0xF0, 0x80, 0xA0, 0x02, 0x50, 0x0F, 0x54, 0x0F, 0x59, 0xF0,
+0x01, 0x30, 0x50, 0xF0, 0xA1, 0x10, 0x70, 0x01, 0xA0, 0x50, 0xA0, 0xE0, 0xD1, 0xB0, 0x30, 0x06,
+0xF0, 0x50, 0x0F, 0x00, 0xF0, 0x50, 0x0E, 0xF0, 0x50, 0x02, 0x80, 0xA0, 0xF1, 0x50, 0x30, 0x60,
+0x10, 0x80, 0x70, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x60, 0xF0, 0x05, 0xF0, 0x50, 0x00, 0x60, 0xA0,
+0xD1, 0xE0, 0x60, 0xD0, 0x20, 0xD0, 0xB0, 0x60, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x22, 0xD1, 0xB0,
+0xA0, 0x00, 0xF0, 0x92, 0x00, 0xF2, 0xA0, 0x60, 0xC0, 0xB0, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20,
+0xD0, 0x25, 0xD0, 0x22, 0xD1, 0xB0, 0xD1, 0x20, 0xD1, 0xE0, 0x70, 0x05, 0xF0, 0x60, 0x30, 0x50,
+0x00, 0xF0, 0x50, 0x05, 0x80, 0x30, 0x60, 0x70, 0x90, 0xA0, 0xC0, 0xA0, 0x80, 0x01, 0x30, 0x60,
+0xE0, 0x03, 0x70, 0x60, 0x90, 0x60, 0x30, 0x80, 0x50, 0x01, 0xC0, 0x10, 0x31, 0xA0, 0x30, 0x0F,
+0x59, 0x0F, 0x59, 0x90, 0x60, 0x30, 0xA0, 0x80, 0x30, 0xF0, 0x00, 0x10, 0xC0, 0x00, 0xF0, 0xC0,
+0xE0, 0xD4, 0xE0, 0x90, 0x06, 0x90, 0x0F, 0x01, 0x90, 0x0F, 0x00, 0x90, 0x81, 0x90, 0x70, 0x80,
+0x11, 0x60, 0x50, 0x00, 0x90, 0xA0, 0xD2, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xE0, 0x10, 0x50,
+0x02, 0x70, 0xC0, 0xF0, 0x50, 0x01, 0x60, 0xD1, 0xB0, 0x40, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0,
+0x20, 0xD4, 0x23, 0xD1, 0xA2, 0x82, 0x60, 0xC0, 0xA1, 0x40, 0xB1, 0xD1, 0x21, 0xD0, 0x40, 0xD2,
+0x20, 0xD0, 0x23, 0xD1, 0x22, 0xD0, 0xB1, 0xD4, 0xE0, 0x70, 0x06, 0xC1, 0x01, 0x10, 0xA0, 0x03,
+0x51, 0xA0, 0x50, 0x10, 0x90, 0x12, 0xA0, 0x60, 0x31, 0x10, 0x70, 0x60, 0xC0, 0x50, 0x90, 0x30,
+0x60, 0x10, 0xF0, 0x00, 0x50, 0x10, 0x30, 0x00, 0x80, 0x10, 0x90, 0x00, 0x90, 0xA0, 0x0F, 0x5A,
+0x0F, 0x5A, 0xF0, 0x30, 0xA0, 0x50, 0x30, 0x01, 0x50, 0x10, 0x60, 0xA0, 0xD7, 0xA0, 0x06, 0x71,
+0x0F, 0x00, 0x71, 0x0D, 0x90, 0x60, 0x80, 0xB0, 0x60, 0x10, 0xC1, 0x10, 0x60, 0x90, 0x00, 0x70,
+0xC0, 0xB0, 0xD1, 0xB0, 0x24, 0xD1, 0x60, 0x10, 0x90, 0x00, 0x90, 0x60, 0xA0, 0x60, 0xA0, 0xF0,
+0x90, 0xE0, 0xD3, 0x23, 0xD2, 0xB0, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0xB1, 0xD8,
+0x23, 0xD0, 0x40, 0xD1, 0x22, 0xD5, 0x22, 0xD0, 0x40, 0xD2, 0x21, 0xD0, 0xE0, 0x90, 0x03, 0x50,
+0x80, 0x00, 0x10, 0x30, 0x60, 0x00, 0x10, 0x70, 0x02, 0x31, 0x51, 0x60, 0x30, 0x00, 0x30, 0x11,
+0xA0, 0x11, 0x80, 0xC0, 0x90, 0x71, 0xA0, 0x70, 0x60, 0x80, 0x04, 0x90, 0x11, 0x60, 0x01, 0x91,
+0x31, 0x0F, 0x58, 0x0F, 0x59, 0xF0, 0xA0, 0x30, 0x01, 0x91, 0x00, 0x80, 0x60, 0x40, 0xD4, 0x21,
+0xD0, 0x40, 0x80, 0x07, 0x90, 0x0F, 0x00, 0xF0, 0x50, 0x0E, 0xA0, 0xB0, 0xD1, 0xB0, 0x60, 0x10,
+0xC0, 0x00, 0xC1, 0xE0, 0xB0, 0xD2, 0xB1, 0xD0, 0x23, 0xD2, 0xA0, 0x60, 0xE0, 0xD1, 0x90, 0x30,
+0x80, 0x60, 0xD0, 0xB0, 0xA0, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x20, 0xD0, 0x25, 0xD0, 0x23,
+0xD0, 0xB1, 0xD1, 0x23, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD5, 0x20, 0xD2, 0x40,
+0xD1, 0x22, 0xD1, 0xC0, 0x02, 0x10, 0x61, 0x90, 0x60, 0x30, 0x70, 0x50, 0x10, 0xF0, 0x70, 0x90,
+0xA0, 0x80, 0x00, 0xA0, 0x00, 0x30, 0x00, 0x50, 0xA0, 0x10, 0x60, 0x70, 0x11, 0x01, 0x60, 0x70,
+0xD0, 0xA0, 0xF0, 0x08, 0x30, 0xC0, 0x70, 0x00, 0xA0, 0x01, 0x70, 0xC0, 0x90, 0x0F, 0x56, 0x0F,
+0x58, 0x90, 0x30, 0x70, 0x30, 0x02, 0x60, 0xA0, 0x40, 0xD0, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD0,
+0x60, 0x08, 0x50, 0x70, 0x0F, 0x00, 0x90, 0x0E, 0x50, 0xA0, 0xB0, 0xD2, 0x40, 0xC0, 0xA0, 0xE0,
+0xD6, 0x40, 0xD3, 0x20, 0xD8, 0x41, 0x50, 0xE0, 0x60, 0xA0, 0xD5, 0x20, 0xD1, 0xB0, 0xD2, 0x20,
+0xD1, 0x26, 0xD0, 0x40, 0xB0, 0xD2, 0x22, 0xD4, 0x22, 0x40, 0xDA, 0x20, 0xD1, 0x20, 0xB0, 0xD1,
+0x23, 0xD0, 0xE0, 0x10, 0x90, 0x00, 0xF0, 0x02, 0x50, 0x02, 0x90, 0xA0, 0x81, 0x50, 0x01, 0x50,
+0xC0, 0x01, 0x60, 0x11, 0x80, 0x00, 0x10, 0x90, 0xF1, 0x30, 0x60, 0xD0, 0xE0, 0x80, 0x07, 0x50,
+0x00, 0x70, 0xA0, 0x10, 0x70, 0x01, 0x80, 0x50, 0x90, 0xA0, 0x0F, 0x55, 0x0F, 0x56, 0xF0, 0x60,
+0x30, 0x01, 0x50, 0x80, 0x00, 0xA0, 0xE0, 0xD2, 0x20, 0x40, 0xD1, 0x21, 0xD1, 0xB0, 0x30, 0x09,
+0x50, 0x0F, 0x00, 0x71, 0x0B, 0xF0, 0xA0, 0xE1, 0xB0, 0xDA, 0x20, 0xD1, 0x40, 0xD3, 0x27, 0xD0,
+0xB0, 0xE1, 0x60, 0x50, 0x00, 0xA0, 0xE0, 0xA0, 0x40, 0xB0, 0xD4, 0xB0, 0x20, 0xD1, 0x20, 0xD1,
+0x22, 0xD0, 0x20, 0xD2, 0x40, 0xD4, 0x22, 0xD5, 0xB1, 0xD7, 0x22, 0xD2, 0xB1, 0xD1, 0x21, 0xD2,
+0x10, 0xC0, 0xF0, 0x04, 0x90, 0x01, 0x90, 0xA0, 0x05, 0x90, 0x10, 0x00, 0x90, 0x10, 0x60, 0xC0,
+0x60, 0x80, 0x10, 0x60, 0x11, 0x00, 0xA0, 0xE0, 0x70, 0x10, 0x05, 0xF0, 0x51, 0x02, 0x90, 0xC0,
+0x90, 0x00, 0xA0, 0x02, 0x10, 0x90, 0x0F, 0x53, 0x0F, 0x55, 0x80, 0x30, 0xF0, 0x60, 0x02, 0xC0,
+0x60, 0xB0, 0xD2, 0x20, 0xD0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0xA0, 0x70, 0x09, 0x50, 0x70, 0x0F,
+0x00, 0x90, 0x0B, 0xF0, 0x60, 0x70, 0x40, 0xD2, 0x20, 0xD4, 0x22, 0xD2, 0x40, 0xD1, 0x24, 0xD0,
+0x22, 0xD0, 0x20, 0xD0, 0x41, 0x60, 0x70, 0x30, 0x61, 0xF0, 0x90, 0x60, 0x40, 0xD1, 0x20, 0xD0,
+0xB0, 0x22, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0x40, 0xD0, 0x2A, 0xD1, 0xB1, 0xD1, 0x22, 0xD1, 0x22,
+0xD3, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x10, 0xA0, 0x04, 0x50, 0x33, 0x06, 0x80, 0x10, 0x03,
+0x60, 0x14, 0x30, 0x01, 0xE0, 0xA0, 0x50, 0x60, 0x02, 0x10, 0x60, 0xA0, 0xE0, 0x60, 0xF0, 0x03,
+0x30, 0x10, 0x70, 0x01, 0x80, 0x70, 0x90, 0xA0, 0x0F, 0x52, 0x0F, 0x53, 0xF0, 0x60, 0x30, 0x01,
+0x70, 0x30, 0x70, 0x60, 0x40, 0xD4, 0x21, 0xD0, 0x40, 0xD3, 0x61, 0x0B, 0x90, 0x0F, 0x00, 0x50,
+0x09, 0x51, 0xA0, 0x40, 0xD1, 0xB0, 0x20, 0xD0, 0x22, 0xD0, 0x25, 0xD1, 0x40, 0xD0, 0x26, 0xD0,
+0x23, 0xD0, 0xB0, 0xD0, 0x40, 0x60, 0x10, 0xA0, 0x60, 0xF0, 0x01, 0x10, 0xC0, 0xB0, 0xD1, 0xB0,
+0x21, 0xD1, 0x60, 0x40, 0xD0, 0x22, 0xD3, 0x40, 0xD1, 0x29, 0xD1, 0x40, 0xD2, 0x28, 0xD2, 0x40,
+0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x50, 0x10, 0xA0, 0x03, 0x80, 0x0F, 0x00, 0x50, 0x30, 0xF0,
+0x00, 0x50, 0x80, 0x30, 0x50, 0x80, 0x01, 0x30, 0x40, 0x80, 0xC0, 0x50, 0xA1, 0x70, 0xB0, 0x50,
+0x60, 0x50, 0x04, 0xF0, 0xC0, 0x30, 0x70, 0x30, 0x01, 0xF0, 0x10, 0x90, 0x0F, 0x50, 0x0F, 0x46,
+0x91, 0x09, 0x90, 0x30, 0xF0, 0xA0, 0x02, 0x60, 0xA0, 0xB0, 0xD3, 0x20, 0xD1, 0x20, 0xD0, 0xB1,
+0xD2, 0xA0, 0x90, 0x0B, 0x50, 0xF0, 0x0E, 0x70, 0x50, 0x08, 0x30, 0x10, 0xE0, 0xD2, 0x40, 0xD1,
+0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0x23, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x22,
+0xD0, 0xB1, 0xD1, 0x40, 0xD0, 0xE0, 0x30, 0xA0, 0x90, 0x11, 0xE0, 0xD1, 0x40, 0x23, 0xD4, 0x22,
+0xD1, 0x40, 0xD1, 0x25, 0xD0, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x29, 0xD0, 0xB1, 0xD0, 0x22,
+0xD2, 0x60, 0xA0, 0x11, 0x60, 0xC0, 0xA1, 0x90, 0xA0, 0x50, 0x07, 0xF0, 0x50, 0x03, 0x90, 0x02,
+0x30, 0x10, 0xC0, 0x10, 0x60, 0x01, 0xF0, 0x10, 0x50, 0x40, 0xA1, 0xC0, 0x80, 0x90, 0x30, 0x90,
+0x07, 0x80, 0x10, 0x50, 0x01, 0x80, 0x50, 0x90, 0x30, 0xF0, 0x0F, 0x4E, 0x0F, 0x45, 0x91, 0x80,
+0x70, 0x07, 0x60, 0x30, 0x01, 0x70, 0xE0, 0xF0, 0x60, 0x40, 0xD2, 0x21, 0xD2, 0x20, 0xD2, 0x40,
+0xD1, 0xB0, 0xA0, 0x0D, 0x90, 0x0F, 0x00, 0x90, 0x08, 0x80, 0xC0, 0x70, 0xD2, 0x40, 0xD5, 0x21,
+0xD0, 0x21, 0xD2, 0xB1, 0xD0, 0x21, 0xD5, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD2, 0xE0,
+0xC0, 0xA0, 0xF0, 0x10, 0x40, 0xD1, 0xB0, 0x20, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0x40,
+0xD3, 0x22, 0xD1, 0x22, 0xD1, 0x40, 0xD0, 0x2B, 0xD0, 0xB1, 0xD1, 0x22, 0xD1, 0xC0, 0x00, 0x10,
+0x30, 0x80, 0x11, 0xC0, 0x00, 0xA0, 0x60, 0x06, 0x80, 0xA0, 0x10, 0xA0, 0x50, 0x01, 0x50, 0x02,
+0xF0, 0xA0, 0x90, 0x80, 0x70, 0x01, 0xA0, 0x10, 0x40, 0xD0, 0x40, 0x10, 0x60, 0x30, 0x60, 0x10,
+0x09, 0x80, 0x10, 0x80, 0x50, 0x30, 0x01, 0x50, 0xC0, 0x50, 0x0F, 0x4D, 0x0F, 0x45, 0xF0, 0x31,
+0x06, 0x50, 0x60, 0x00, 0x30, 0xF0, 0x01, 0x61, 0xD3, 0x22, 0xD3, 0x20, 0xD2, 0x40, 0xD0, 0x40,
+0xE0, 0x0D, 0x50, 0x0F, 0x00, 0x50, 0xF0, 0x07, 0x80, 0x61, 0xE0, 0xD1, 0xB1, 0xD0, 0xA0, 0x60,
+0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x21, 0xD3, 0x23, 0xD0, 0xB1, 0xD0, 0x21,
+0xD2, 0xE0, 0x50, 0x00, 0x60, 0xD2, 0x40, 0xD1, 0xC0, 0x20, 0xD2, 0x21, 0xD4, 0x40, 0xD3, 0x23,
+0xD1, 0x21, 0xD1, 0xB0, 0xD0, 0x24, 0xD2, 0x22, 0xD1, 0x40, 0xD2, 0x21, 0xD2, 0x60, 0x80, 0xC0,
+0x10, 0x01, 0x50, 0x80, 0x00, 0x50, 0x90, 0x06, 0x10, 0xD0, 0xB1, 0xE0, 0x60, 0xE0, 0x50, 0x09,
+0xE0, 0x60, 0xD2, 0xE0, 0x40, 0xA1, 0xB0, 0x60, 0xE0, 0x90, 0x02, 0x90, 0x31, 0x50, 0xF0, 0x30,
+0x90, 0x10, 0x50, 0x01, 0x30, 0x70, 0x80, 0x30, 0x0F, 0x4C, 0x0F, 0x43, 0x80, 0xA0, 0xF0, 0x07,
+0x30, 0xA0, 0x01, 0xF0, 0x30, 0xF0, 0x60, 0x40, 0xD3, 0x24, 0xD1, 0x22, 0xD1, 0x40, 0xD0, 0x10,
+0x90, 0x0D, 0xF0, 0x50, 0x0E, 0xF0, 0x50, 0x09, 0xA1, 0xD2, 0xB0, 0xD7, 0x21, 0xD0, 0x21, 0xD0,
+0x40, 0xD2, 0x20, 0xD2, 0x24, 0xD1, 0xB0, 0xD0, 0x23, 0xD0, 0xB0, 0x60, 0xE1, 0x60, 0xE0, 0xD0,
+0xB0, 0x20, 0xD0, 0x40, 0xD6, 0x40, 0xB0, 0x40, 0xE1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x24, 0xD1, 0x23, 0xD0, 0x20, 0xB0, 0xD3, 0x21, 0xD0, 0x20, 0xC0,
+0x10, 0x80, 0x50, 0xA0, 0x51, 0x30, 0x90, 0xF0, 0x04, 0x90, 0x80, 0xA1, 0x40, 0xD3, 0x40, 0xA0,
+0xC0, 0x80, 0x03, 0xF0, 0x91, 0x50, 0x60, 0xE1, 0xD2, 0x40, 0xD3, 0xB0, 0xE0, 0x61, 0xA1, 0x60,
+0x10, 0xC0, 0x00, 0x30, 0x00, 0xF0, 0x60, 0x30, 0x91, 0x01, 0x50, 0xC0, 0x70, 0x0F, 0x4A, 0x0F,
+0x42, 0x30, 0x80, 0x50, 0x10, 0x50, 0x04, 0xF0, 0xA0, 0x50, 0x30, 0xF0, 0x01, 0x30, 0x60, 0xDB,
+0x22, 0xD3, 0x41, 0x60, 0x0E, 0x90, 0x0F, 0x00, 0x90, 0x09, 0x70, 0x10, 0xB0, 0xE1, 0xB0, 0xD1,
+0xB0, 0x41, 0xA0, 0x60, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD2, 0x24, 0xD1, 0x40,
+0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0xE0, 0xD0, 0x21, 0xD0, 0x40, 0x20, 0xD2, 0x20, 0xD1, 0x20,
+0xD0, 0xE0, 0xC1, 0xA0, 0x61, 0xC0, 0x40, 0xD1, 0x22, 0xD0, 0x23, 0xD0, 0xB0, 0xD1, 0x20, 0xD5,
+0x23, 0xD0, 0xB1, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0x60, 0x10, 0x90, 0x51, 0x80,
+0x70, 0x90, 0xA0, 0x01, 0x70, 0x30, 0x60, 0x90, 0x70, 0xF0, 0x70, 0xC0, 0x40, 0xD1, 0xB1, 0xD0,
+0xB0, 0xE0, 0x10, 0x51, 0xA1, 0x41, 0xE0, 0xB0, 0xD3, 0xB1, 0xD0, 0x20, 0xD9, 0xA0, 0x60, 0xC0,
+0x02, 0x90, 0x10, 0x70, 0x01, 0x30, 0x70, 0x30, 0x90, 0x0F, 0x49, 0x0F, 0x42, 0xA0, 0xF0, 0x00,
+0xF0, 0xC0, 0x70, 0x02, 0x50, 0x60, 0x01, 0xF0, 0xA0, 0x00, 0xA0, 0xE0, 0x40, 0xDA, 0x24, 0xD2,
+0x40, 0x90, 0x30, 0x0E, 0x70, 0x50, 0x0E, 0x71, 0x08, 0x80, 0xE0, 0x80, 0x61, 0xA0, 0x41, 0x60,
+0x90, 0x30, 0x10, 0xE0, 0xD4, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD2, 0x24, 0xD1, 0x40, 0xD0, 0x20,
+0xD1, 0x21, 0xD2, 0x20, 0xD1, 0x20, 0xB0, 0x20, 0xD0, 0x23, 0xD2, 0x41, 0x60, 0xC1, 0x60, 0x90,
+0x60, 0xA0, 0xD2, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD5, 0x22, 0xD1, 0x40, 0xD1, 0x21,
+0xD0, 0x22, 0xD1, 0x13, 0x00, 0x50, 0x01, 0xC0, 0x00, 0x31, 0x50, 0x04, 0x90, 0x10, 0xC0, 0xA1,
+0x60, 0xE0, 0xB0, 0x50, 0xE0, 0x40, 0xE0, 0xB0, 0xD5, 0xC0, 0x40, 0xD0, 0x40, 0xD6, 0x24, 0xD0,
+0xB0, 0xE0, 0x10, 0x90, 0x01, 0x50, 0x70, 0xC0, 0x90, 0x50, 0x80, 0x01, 0x80, 0x30, 0x09, 0xF0,
+0x0F, 0x3D, 0x0F, 0x3F, 0xA0, 0x10, 0x90, 0x80, 0xA0, 0x01, 0x50, 0x60, 0x01, 0x30, 0x80, 0x30,
+0xF0, 0x01, 0x80, 0xC0, 0xB0, 0xD1, 0x40, 0xD4, 0x24, 0xD0, 0x23, 0xD1, 0xE0, 0x40, 0x60, 0x0F,
+0x01, 0x50, 0x0E, 0xF0, 0x50, 0x04, 0x30, 0xF0, 0x30, 0x70, 0xA0, 0x40, 0x30, 0x00, 0xA1, 0xB0,
+0xE0, 0xA0, 0x02, 0x60, 0xD2, 0x22, 0xD0, 0xB1, 0xD1, 0x22, 0xD0, 0x24, 0xD1, 0x40, 0xD0, 0x21,
+0xD0, 0x22, 0xD2, 0x21, 0xD0, 0xB0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0xE0, 0xA0, 0x70, 0x40,
+0xA0, 0x10, 0x60, 0xB0, 0xA1, 0xC0, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD5,
+0x22, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0x11, 0x91, 0x50, 0x01, 0x70, 0xA0, 0x80,
+0x08, 0x70, 0x50, 0x90, 0x00, 0x70, 0x30, 0xA0, 0x70, 0xD3, 0x20, 0xD1, 0x20, 0xD0, 0x60, 0xB1,
+0xD4, 0xC0, 0x40, 0xB0, 0xD1, 0x23, 0xD1, 0x90, 0x60, 0x00, 0x71, 0x01, 0x30, 0x10, 0x02, 0x30,
+0x50, 0xA0, 0x70, 0x03, 0xF0, 0x80, 0xA0, 0xC0, 0x10, 0x0F, 0x3D, 0x0F, 0x3E, 0xA0, 0x50, 0x00,
+0xC0, 0x70, 0xA0, 0x80, 0x01, 0x60, 0xF0, 0x60, 0x70, 0x01, 0xA0, 0x00, 0x80, 0xA0, 0xD3, 0xB0,
+0x40, 0xD2, 0x26, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xE0, 0xC0, 0xE0, 0xA0, 0x70, 0x0F, 0x00, 0x70,
+0x50, 0x0E, 0x50, 0x04, 0x10, 0xA0, 0x10, 0x60, 0xD0, 0xB0, 0xA1, 0xB0, 0xD0, 0xB0, 0xC0, 0x01,
+0x80, 0xE0, 0x60, 0xD3, 0x21, 0xD0, 0xB1, 0xD1, 0x22, 0xD0, 0x24, 0xD1, 0x40, 0xD1, 0x21, 0xD0,
+0x20, 0xD0, 0x24, 0xD0, 0x40, 0x20, 0xD4, 0x21, 0xD1, 0x20, 0xA0, 0xC0, 0xA0, 0x40, 0xD0, 0xE0,
+0x12, 0xB0, 0xD0, 0x20, 0xD3, 0x20, 0x40, 0xD1, 0x22, 0xD4, 0x21, 0xD1, 0xB0, 0xD0, 0x22, 0xD1,
+0x22, 0xD1, 0x40, 0xC0, 0x10, 0x60, 0x80, 0x00, 0xF0, 0x30, 0x80, 0x70, 0x09, 0x90, 0x03, 0x50,
+0x10, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x60, 0xE0, 0xA0, 0xE0, 0xD2, 0xE0, 0xC1, 0x60,
+0xB0, 0xD0, 0x21, 0xD1, 0xB0, 0x10, 0x90, 0x00, 0x50, 0x03, 0x50, 0x10, 0x70, 0x91, 0x01, 0x30,
+0x80, 0x01, 0x30, 0x10, 0x70, 0xF0, 0xC0, 0x70, 0x00, 0x70, 0x50, 0x0F, 0x3A, 0x0F, 0x3E, 0x60,
+0x70, 0x00, 0xA0, 0x70, 0x00, 0x60, 0x80, 0x90, 0xC0, 0x31, 0x70, 0x01, 0x50, 0xC0, 0x40, 0xD1,
+0x22, 0xD0, 0x40, 0xB0, 0xD0, 0x25, 0xD6, 0xE0, 0x10, 0x80, 0x00, 0x90, 0x0F, 0x01, 0x90, 0x0E,
+0x71, 0x03, 0x30, 0x10, 0x60, 0xD6, 0x80, 0x10, 0xC0, 0x30, 0xC0, 0xA0, 0xD2, 0x23, 0xD1, 0x40,
+0xD0, 0x26, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0xB0, 0x20, 0xD5,
+0x22, 0xD0, 0xB0, 0xD0, 0xB0, 0xD2, 0xB0, 0x60, 0xC0, 0xB0, 0xD1, 0x21, 0xD1, 0xB1, 0xD1, 0x28,
+0xD1, 0xB1, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xC0, 0xA0, 0x10, 0x80, 0x90, 0xC0,
+0x60, 0x70, 0xF0, 0x07, 0x50, 0xF0, 0x04, 0x70, 0x10, 0xA0, 0xB0, 0xD4, 0x70, 0x10, 0x30, 0x00,
+0xA0, 0x10, 0xC0, 0xB0, 0xD1, 0x40, 0xE1, 0x20, 0xD2, 0x20, 0xD0, 0xB0, 0xE0, 0x00, 0x90, 0x05,
+0xF0, 0xC0, 0x60, 0x02, 0x30, 0x80, 0x30, 0x00, 0xF0, 0xA0, 0x90, 0xA0, 0x90, 0x00, 0x30, 0x60,
+0xA0, 0x30, 0x0F, 0x39, 0x0F, 0x3B, 0xF0, 0x90, 0x00, 0x50, 0xF0, 0x00, 0x60, 0x70, 0x01, 0x90,
+0x60, 0x30, 0x01, 0xA0, 0x00, 0x50, 0x60, 0xB0, 0xD2, 0x22, 0xD1, 0x40, 0xD1, 0x23, 0xD4, 0x21,
+0xD0, 0x60, 0x50, 0x01, 0xF0, 0x50, 0x0F, 0x00, 0x71, 0x0E, 0x90, 0x04, 0xA0, 0xD5, 0x20, 0xD0,
+0x40, 0x80, 0x70, 0x10, 0xE0, 0x40, 0xD0, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x26, 0xD1, 0x20,
+0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x22, 0xD2, 0x20, 0xD0, 0xB0, 0x20, 0xD4, 0x23, 0xD2, 0x40, 0xD0,
+0x21, 0xD3, 0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x22, 0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x22, 0xD1,
+0x24, 0xD2, 0x40, 0x12, 0xA0, 0x81, 0x60, 0x07, 0x30, 0x07, 0xC1, 0xA0, 0xE1, 0xB1, 0x40, 0x10,
+0x90, 0x00, 0x11, 0x30, 0x60, 0xD3, 0x40, 0xD6, 0x60, 0x71, 0x07, 0x30, 0x60, 0x00, 0x80, 0x90,
+0x00, 0x50, 0x30, 0x01, 0x10, 0xC0, 0x00, 0x30, 0xA0, 0x01, 0xC0, 0x0F, 0x39, 0x0F, 0x3A, 0x50,
+0xC0, 0x30, 0x60, 0x02, 0x60, 0x00, 0x30, 0x81, 0x60, 0x70, 0x01, 0xF0, 0xC0, 0xA0, 0xD2, 0x20,
+0xD0, 0x21, 0xD2, 0x20, 0x40, 0xD2, 0x21, 0xD1, 0x23, 0xD1, 0xA0, 0x50, 0x02, 0x50, 0xF0, 0x0F,
+0x00, 0x90, 0x0E, 0x50, 0x01, 0xC0, 0xE0, 0xA0, 0xB0, 0xD1, 0x21, 0xD3, 0x40, 0xC0, 0x60, 0xE0,
+0xD1, 0x22, 0xD1, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x23, 0xD3, 0x20, 0xD1, 0x40, 0xD3, 0x23, 0xD4,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD2, 0x40, 0xD0, 0x22, 0xD2, 0x20, 0xD4, 0xB0, 0x21, 0xD1,
+0x21, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0xE0, 0x12,
+0xF0, 0x00, 0xA0, 0xF1, 0x03, 0xF0, 0xC0, 0xA0, 0x09, 0x50, 0x70, 0x90, 0x30, 0xE0, 0x51, 0xC0,
+0x90, 0xF0, 0x10, 0x00, 0x70, 0x11, 0x61, 0x11, 0xC0, 0xA0, 0xB0, 0xD2, 0xB0, 0x30, 0x09, 0x50,
+0x10, 0x30, 0x02, 0xA1, 0x80, 0x30, 0x50, 0x90, 0xC0, 0x01, 0xF0, 0xC0, 0x00, 0x70, 0x0F, 0x37,
+0x0F, 0x3A, 0xA0, 0x50, 0x00, 0xC0, 0x90, 0xF0, 0x00, 0xC0, 0xA0, 0x80, 0x30, 0x50, 0x00, 0xA0,
+0x01, 0xA0, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD5, 0xB1, 0xD0, 0x29, 0xD0, 0x60, 0x80, 0x50, 0x02,
+0x90, 0x0F, 0x00, 0x50, 0x70, 0x0E, 0x30, 0x10, 0xE0, 0x60, 0xB0, 0xD2, 0x22, 0xD0, 0x40, 0xA1,
+0x30, 0xD3, 0x21, 0xD0, 0x21, 0xD3, 0xB1, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x21, 0xD0, 0x40, 0x20,
+0xD2, 0x23, 0xD4, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD3, 0x40, 0xD0, 0x26, 0xD1, 0xB0, 0x40,
+0xD0, 0x40, 0x21, 0xD1, 0x20, 0xD2, 0x21, 0xD2, 0xB1, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x22, 0xD1,
+0x21, 0xD0, 0x40, 0xD1, 0xE0, 0xC0, 0x10, 0xC0, 0x90, 0xA0, 0xC0, 0x60, 0x03, 0x90, 0x30, 0x0F,
+0x00, 0x71, 0x02, 0x60, 0xC0, 0x00, 0x30, 0x00, 0x50, 0xF1, 0x50, 0xE0, 0xC0, 0x60, 0xD2, 0x40,
+0x80, 0xA0, 0x0A, 0xC0, 0x80, 0x00, 0x30, 0x70, 0x00, 0x30, 0x50, 0x00, 0xA0, 0x70, 0x01, 0xC0,
+0x51, 0x80, 0x30, 0xF0, 0x0F, 0x35, 0x0F, 0x3A, 0x90, 0x70, 0x50, 0xA0, 0x30, 0xC0, 0x00, 0xC0,
+0x80, 0xC1, 0x02, 0xA1, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0x40, 0xD1, 0x20, 0xD2,
+0x23, 0xD1, 0x60, 0xC0, 0x60, 0xA0, 0xF0, 0x00, 0x71, 0x0F, 0x00, 0x90, 0x0C, 0xF0, 0xC0, 0xE0,
+0xB0, 0xD3, 0x24, 0xD0, 0xA0, 0x50, 0x60, 0x40, 0xD3, 0x21, 0xD1, 0x21, 0xD2, 0xB1, 0xD2, 0x21,
+0xD3, 0x21, 0xD0, 0xB1, 0xD2, 0x23, 0xD0, 0x22, 0xD0, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD4,
+0x40, 0xD0, 0x20, 0xD4, 0x20, 0xD1, 0xB0, 0xC0, 0xB0, 0x40, 0x20, 0xD1, 0x40, 0x20, 0xD0, 0xB1,
+0xD4, 0xB1, 0xD1, 0x20, 0xD2, 0x20, 0xD3, 0x20, 0xD0, 0xB1, 0xD3, 0xA0, 0x14, 0xC0, 0x80, 0x30,
+0x80, 0x71, 0x05, 0x70, 0x60, 0xF0, 0x06, 0x90, 0x04, 0xC0, 0xF0, 0x07, 0x60, 0xD1, 0xB0, 0xD0,
+0x70, 0xE0, 0x90, 0x09, 0x80, 0x10, 0x60, 0x90, 0x01, 0x90, 0x10, 0x90, 0x30, 0x90, 0xF0, 0x60,
+0x80, 0x00, 0x50, 0x90, 0x80, 0x70, 0x0F, 0x35, 0x0F, 0x3F, 0x30, 0x70, 0x50, 0x30, 0x80, 0x10,
+0x30, 0x00, 0x70, 0x60, 0xD8, 0x22, 0xD4, 0x40, 0xD4, 0x24, 0xD0, 0x60, 0xE0, 0xD0, 0xB0, 0x60,
+0x01, 0x90, 0x0F, 0x00, 0x50, 0x70, 0x0B, 0xE0, 0x91, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0xA1,
+0xB1, 0xD0, 0x20, 0x40, 0xD0, 0x20, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD2, 0x21, 0xD3, 0x21,
+0xD0, 0xB1, 0xD2, 0x23, 0xD0, 0x22, 0xD0, 0xB0, 0x20, 0xD4, 0x21, 0xD4, 0x40, 0xD5, 0x22, 0xD3,
+0x40, 0xD2, 0xE0, 0xD1, 0x60, 0xE0, 0x60, 0xB0, 0xD2, 0x40, 0xD1, 0x20, 0xD0, 0xA0, 0x21, 0xD0,
+0x20, 0xD2, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD1, 0xE0, 0x16, 0x90, 0x30, 0xA0, 0x90, 0x03, 0x50,
+0x10, 0x50, 0x00, 0xF0, 0x50, 0xF0, 0x02, 0x50, 0xF0, 0x10, 0xF0, 0x02, 0xF1, 0x10, 0x60, 0x70,
+0x03, 0x91, 0x80, 0x50, 0x40, 0xC0, 0xD1, 0xA0, 0x09, 0x30, 0xF0, 0x80, 0xA0, 0x00, 0x70, 0x10,
+0xC0, 0x80, 0x31, 0x60, 0x90, 0x02, 0x50, 0x70, 0x0F, 0x36, 0x0F, 0x3C, 0xF0, 0x70, 0x00, 0xA0,
+0x80, 0xA0, 0x01, 0x80, 0x10, 0x60, 0xA0, 0x70, 0xD2, 0x21, 0xD7, 0xB0, 0xE0, 0xA0, 0x61, 0xE0,
+0xA0, 0x40, 0xD3, 0x22, 0xD4, 0x40, 0x60, 0x70, 0xF0, 0x50, 0x0F, 0x00, 0x50, 0x0B, 0x30, 0x50,
+0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xE0, 0xB0, 0xD0, 0xB2, 0xA0, 0xD1, 0x20,
+0xD0, 0x20, 0xD2, 0x22, 0x40, 0xD2, 0x21, 0xD3, 0x21, 0xD0, 0x20, 0xB0, 0xD1, 0x24, 0xD1, 0x20,
+0xD1, 0x40, 0x20, 0xD5, 0x21, 0xD3, 0xB0, 0xD3, 0x25, 0xD1, 0x50, 0x30, 0xA2, 0xD1, 0xE0, 0x60,
+0x90, 0x10, 0xB0, 0xD2, 0x40, 0xD0, 0x22, 0x40, 0x21, 0xD0, 0x20, 0xD3, 0x20, 0xB0, 0xD3, 0x20,
+0xD1, 0xE0, 0x12, 0xA0, 0x60, 0x10, 0xC0, 0x01, 0x80, 0x10, 0x60, 0x30, 0x80, 0xA0, 0x10, 0x50,
+0x00, 0x80, 0x10, 0x50, 0x01, 0xF0, 0x50, 0x00, 0x70, 0x03, 0x70, 0x10, 0x30, 0x80, 0x11, 0x02,
+0x80, 0x00, 0x60, 0x30, 0xA0, 0xE0, 0xD1, 0x40, 0xA0, 0x30, 0xF0, 0x01, 0x70, 0x50, 0xF0, 0x80,
+0xA1, 0x01, 0x50, 0x12, 0x01, 0x50, 0x60, 0x0F, 0x3D, 0x0F, 0x3C, 0xF0, 0x61, 0xA0, 0x90, 0xA0,
+0xF0, 0x01, 0x10, 0x60, 0xD0, 0x60, 0xB0, 0x40, 0xB0, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xE0, 0xA1,
+0xE0, 0x50, 0xF0, 0x01, 0x50, 0x70, 0x80, 0xC0, 0xB0, 0xD2, 0x21, 0xD0, 0x22, 0xD2, 0x60, 0x80,
+0x50, 0xF0, 0x0E, 0x50, 0xF0, 0x0A, 0xA0, 0xB0, 0xD0, 0x40, 0xD4, 0x20, 0xD7, 0x40, 0xD1, 0x20,
+0xD3, 0x22, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x22, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x21,
+0xD1, 0x20, 0xD1, 0xB0, 0x20, 0xD5, 0x22, 0xD2, 0xB0, 0xD2, 0x26, 0xD1, 0xB0, 0xA0, 0x01, 0xE0,
+0x40, 0xE0, 0x11, 0x80, 0x40, 0xD2, 0xB1, 0xD0, 0x21, 0xD3, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0x21,
+0xD1, 0x22, 0xD1, 0xB0, 0x40, 0xA1, 0x70, 0xD0, 0xE0, 0x12, 0x90, 0xF0, 0x01, 0x30, 0x00, 0xA0,
+0x70, 0x30, 0x03, 0x50, 0xC0, 0x70, 0x04, 0x30, 0x80, 0x30, 0x80, 0x03, 0x10, 0x90, 0x00, 0x50,
+0x70, 0xA0, 0xD2, 0xB0, 0x10, 0xC0, 0x30, 0xA1, 0x30, 0xA1, 0x50, 0x70, 0xC0, 0x02, 0x50, 0x10,
+0x90, 0x01, 0x30, 0x50, 0x60, 0xF0, 0x0F, 0x3B, 0x0F, 0x3E, 0x80, 0x90, 0x00, 0xF0, 0xA0, 0x70,
+0xA0, 0x40, 0xB0, 0x40, 0x60, 0xC0, 0xE0, 0xB0, 0xD1, 0xB0, 0x40, 0x60, 0x30, 0x90, 0x50, 0xF0,
+0x06, 0x90, 0x00, 0x70, 0x60, 0xA1, 0xD2, 0x20, 0xD0, 0x23, 0xD1, 0xE0, 0x80, 0x50, 0x0F, 0x00,
+0x50, 0x0A, 0xA0, 0xD1, 0xB1, 0xD1, 0x24, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD2, 0x22, 0xD2, 0x22, 0xD0, 0x40, 0xD1, 0x20, 0xD5,
+0x20, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x25, 0xD0, 0xB1, 0xD0, 0x26, 0xD1, 0x20, 0xD0, 0xB0,
+0x10, 0x60, 0x80, 0x60, 0x90, 0xA2, 0x30, 0xE0, 0x30, 0xE2, 0xB0, 0xD3, 0x21, 0xD3, 0x20, 0xD1,
+0x40, 0xD3, 0x20, 0xD1, 0x20, 0xD3, 0xC0, 0xA0, 0xD0, 0xB1, 0xE0, 0x60, 0x10, 0x60, 0x10, 0x30,
+0x01, 0x90, 0xC0, 0x80, 0xF1, 0x00, 0x70, 0x90, 0x50, 0xA0, 0x30, 0x70, 0x90, 0x50, 0x01, 0x30,
+0xA0, 0x10, 0x70, 0x02, 0xF1, 0x50, 0xF0, 0x00, 0x90, 0xE0, 0xD0, 0xC0, 0x10, 0x60, 0x01, 0xF0,
+0x01, 0x70, 0x01, 0xF0, 0x60, 0xF0, 0x00, 0xF0, 0x50, 0xF0, 0x60, 0x90, 0x80, 0x90, 0x00, 0xF0,
+0xA0, 0x70, 0x0F, 0x3A, 0x0F, 0x3D, 0x30, 0x60, 0xF0, 0x01, 0x50, 0x10, 0xB0, 0xD1, 0xB0, 0x40,
+0xC1, 0xB0, 0x61, 0xE0, 0x90, 0x70, 0x0A, 0x70, 0x50, 0x02, 0xC0, 0xD3, 0x24, 0xD1, 0x40, 0x90,
+0x70, 0xF0, 0x0E, 0x90, 0x0A, 0xA0, 0xD2, 0x40, 0xD2, 0x23, 0xD0, 0x20, 0xD2, 0x20, 0xB1, 0xD0,
+0x26, 0xD0, 0x21, 0xD0, 0xB0, 0xDC, 0x40, 0xDB, 0xB0, 0x20, 0xDA, 0xB1, 0xD2, 0x22, 0xD3, 0x20,
+0xD0, 0xB0, 0xE0, 0xC0, 0x50, 0x10, 0xC0, 0x50, 0x00, 0x90, 0x70, 0x31, 0x70, 0x10, 0xE0, 0xD1,
+0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x20, 0xD1,
+0x21, 0xD3, 0x40, 0xD3, 0x40, 0xE0, 0xA0, 0x10, 0x60, 0x50, 0x00, 0x70, 0x90, 0x31, 0xA0, 0x81,
+0x30, 0x00, 0x50, 0x90, 0x70, 0x90, 0xA0, 0x01, 0x80, 0x30, 0xA0, 0x02, 0x50, 0xA1, 0x61, 0xC0,
+0x40, 0xD0, 0x30, 0x10, 0x04, 0x90, 0x03, 0x70, 0x30, 0x00, 0x90, 0x02, 0x61, 0x02, 0x30, 0x60,
+0x70, 0x0F, 0x39, 0x0F, 0x3C, 0xA0, 0x70, 0x00, 0x60, 0x00, 0x70, 0x60, 0xD4, 0x40, 0xB0, 0xA0,
+0xC0, 0x0F, 0x01, 0x50, 0xF0, 0x01, 0x60, 0xE0, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0x80, 0x00,
+0x90, 0x0E, 0xF0, 0x50, 0x08, 0xE0, 0x40, 0xD2, 0x40, 0xD1, 0x21, 0xD2, 0x21, 0xD1, 0x20, 0xD0,
+0xB1, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD9, 0x40, 0xB2, 0x47, 0xB0,
+0x4B, 0xB0, 0x40, 0xB0, 0xDB, 0x40, 0xB0, 0x11, 0xC0, 0x82, 0x10, 0xC0, 0x80, 0x10, 0x60, 0xA0,
+0xB0, 0xD1, 0x22, 0xD0, 0x25, 0xD0, 0x40, 0xD0, 0x21, 0xD5, 0x21, 0xD3, 0x40, 0xD0, 0x21, 0xD4,
+0x11, 0x90, 0x10, 0xA0, 0x01, 0x50, 0x70, 0x04, 0x30, 0x00, 0x80, 0xC0, 0xA0, 0xC0, 0x00, 0xA0,
+0x10, 0x60, 0xC0, 0xE0, 0x40, 0xD0, 0xE0, 0x60, 0x10, 0xC0, 0x10, 0x40, 0x10, 0xF0, 0x03, 0x70,
+0x04, 0x81, 0x02, 0xF0, 0x60, 0x10, 0xA0, 0x00, 0x30, 0x50, 0x00, 0xA0, 0x70, 0x0F, 0x38, 0x0F,
+0x3B, 0xC0, 0x50, 0x02, 0x60, 0xA0, 0xD3, 0x20, 0xD1, 0x40, 0xD0, 0xE1, 0x0F, 0x01, 0x90, 0x02,
+0xA0, 0xE0, 0xD2, 0x20, 0xD4, 0xA0, 0x90, 0x00, 0x71, 0x0E, 0x90, 0x04, 0x90, 0xE0, 0x90, 0xA0,
+0xE0, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x21, 0xD2, 0x21, 0xD4, 0x40, 0xD0, 0x24, 0xD0, 0x20, 0xD4,
+0x40, 0xD1, 0x20, 0xB2, 0x44, 0xB0, 0x40, 0xB0, 0xDA, 0xB0, 0xD9, 0x20, 0xD0, 0x46, 0xB2, 0x20,
+0xD2, 0x40, 0xD0, 0x70, 0x90, 0xC0, 0x11, 0xF0, 0xA0, 0xC0, 0x10, 0xA0, 0x40, 0xB1, 0xD1, 0x22,
+0xD0, 0x24, 0xD1, 0x40, 0xD0, 0x21, 0xD5, 0x22, 0xD1, 0x40, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0xB0,
+0x60, 0xA0, 0x10, 0x30, 0x00, 0x90, 0x03, 0x70, 0x10, 0x80, 0x00, 0x30, 0xA0, 0x10, 0xC0, 0xA0,
+0x60, 0x40, 0xD1, 0x40, 0xB0, 0xD0, 0xF0, 0x10, 0x80, 0x00, 0x11, 0x90, 0xA0, 0x09, 0x50, 0xA0,
+0x01, 0xF0, 0xC0, 0x00, 0x30, 0xC1, 0x90, 0x02, 0x10, 0x50, 0x0F, 0x37, 0x0F, 0x39, 0xF0, 0xA0,
+0x70, 0xA0, 0xF0, 0x00, 0x90, 0xA0, 0xD3, 0x21, 0xD2, 0x40, 0xD0, 0xE0, 0xA0, 0x51, 0x91, 0x0B,
+0xF0, 0x50, 0x02, 0x80, 0xA0, 0x40, 0xD2, 0x40, 0xA0, 0xC0, 0xA0, 0x10, 0x50, 0x01, 0x90, 0x0E,
+0xF0, 0x70, 0x50, 0x70, 0x90, 0x30, 0xA0, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD1, 0x40, 0xD0, 0x22,
+0xD0, 0x24, 0xD2, 0x40, 0x20, 0xD1, 0x20, 0xD7, 0xB0, 0x43, 0xB1, 0x20, 0xD5, 0x40, 0xDB, 0x40,
+0xDB, 0xB0, 0xD2, 0x21, 0xD1, 0x20, 0xB1, 0x43, 0xB1, 0x50, 0x40, 0x10, 0x60, 0x70, 0x90, 0x10,
+0x60, 0xD1, 0x40, 0x25, 0xD1, 0x21, 0xD2, 0xB1, 0xD1, 0x22, 0xD2, 0x22, 0xD2, 0x40, 0xD0, 0x22,
+0xD7, 0xE0, 0xC0, 0x60, 0x70, 0xF0, 0x03, 0xF1, 0x02, 0xC0, 0x60, 0xA0, 0x70, 0xD1, 0xE0, 0x60,
+0xE0, 0xB0, 0xE0, 0x60, 0x80, 0xC1, 0x60, 0x10, 0xA0, 0x60, 0x50, 0x07, 0x50, 0x70, 0x80, 0xC0,
+0xA0, 0x30, 0xF0, 0x01, 0x30, 0xC1, 0x01, 0x30, 0x50, 0x80, 0x90, 0x0F, 0x36, 0x0F, 0x39, 0x60,
+0x02, 0xA0, 0x80, 0xA0, 0xD2, 0x24, 0xD1, 0xB0, 0x40, 0xD0, 0xB0, 0xE1, 0xA1, 0x0C, 0x50, 0x70,
+0x03, 0xA0, 0xE0, 0xD1, 0x40, 0x10, 0xF0, 0x00, 0x70, 0x02, 0x70, 0x50, 0x0E, 0x50, 0x90, 0x12,
+0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0xB1,
+0xD4, 0x20, 0xB0, 0x43, 0xB0, 0x40, 0xDB, 0x40, 0xD5, 0x23, 0xD1, 0xB0, 0x20, 0xD1, 0x22, 0xD0,
+0x20, 0xD1, 0x20, 0xD0, 0x40, 0xDB, 0x40, 0xB1, 0x42, 0x60, 0x30, 0x10, 0xC1, 0xB0, 0xD1, 0x40,
+0xD1, 0x21, 0xD4, 0x20, 0xD2, 0x40, 0xD2, 0x22, 0xD2, 0x22, 0xD1, 0xB1, 0xD1, 0x21, 0xD1, 0x20,
+0xD5, 0xC0, 0x10, 0x80, 0x02, 0x80, 0x07, 0xA1, 0xD2, 0xA0, 0xE0, 0x10, 0xC0, 0x60, 0x10, 0xA1,
+0x60, 0xA0, 0x30, 0x10, 0x90, 0x06, 0x70, 0x50, 0x00, 0xF0, 0x50, 0x05, 0xF0, 0x60, 0xC0, 0x30,
+0x90, 0x01, 0x81, 0x0F, 0x35, 0x0F, 0x37, 0xF0, 0x60, 0xA0, 0x02, 0xE1, 0xD2, 0x23, 0xD0, 0x20,
+0xD2, 0xB0, 0x40, 0xD2, 0x70, 0xA0, 0x50, 0x91, 0x0A, 0x90, 0x04, 0xE0, 0xA0, 0xD1, 0x40, 0x60,
+0x05, 0x90, 0xF0, 0x0D, 0x71, 0x01, 0x80, 0xE0, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x20,
+0xD0, 0x22, 0xD4, 0x40, 0xD0, 0xB0, 0x42, 0xB1, 0xD4, 0x40, 0xD1, 0x28, 0xD0, 0x40, 0xD1, 0x20,
+0xD1, 0x24, 0xD1, 0xB0, 0x20, 0xD1, 0x25, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD6, 0x40, 0xD4,
+0xB5, 0xD0, 0xB1, 0xD1, 0x22, 0xD1, 0x20, 0xD4, 0x40, 0xD3, 0x23, 0xD1, 0x20, 0xD2, 0x40, 0xD1,
+0x20, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x40, 0xA0, 0x11, 0x70, 0x00, 0x80, 0xF0, 0x07,
+0xA1, 0xD0, 0x40, 0xB0, 0x60, 0x10, 0x02, 0x10, 0x60, 0x12, 0x70, 0x06, 0xF0, 0x90, 0x0A, 0x30,
+0x50, 0x10, 0xF0, 0x01, 0x80, 0xA0, 0x90, 0x0F, 0x34, 0x0F, 0x36, 0x70, 0xA0, 0x01, 0xA0, 0xF0,
+0x30, 0xE0, 0xD1, 0x22, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x61, 0x40, 0xE0, 0xA0, 0x0A,
+0x90, 0x04, 0x70, 0x60, 0xE0, 0xD0, 0xB0, 0xC0, 0x04, 0xF0, 0x50, 0x0E, 0x90, 0x01, 0x41, 0xD0,
+0x21, 0xD2, 0x21, 0xD1, 0x40, 0xD6, 0x20, 0xD2, 0xB1, 0x42, 0xD9, 0xB1, 0xD0, 0x25, 0xD0, 0x21,
+0xD0, 0xB1, 0xD0, 0x27, 0xD1, 0xB0, 0x2B, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD2, 0x40, 0xD0, 0x20,
+0xD1, 0x20, 0xD4, 0xB0, 0x42, 0xB0, 0x20, 0xD9, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD4, 0xB1, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD0, 0xB1, 0xE0, 0x10, 0xC0, 0x50, 0x01, 0x90, 0x07,
+0x90, 0xE0, 0xB0, 0xD0, 0x40, 0x11, 0x01, 0xF0, 0x90, 0x30, 0xC0, 0xF0, 0x01, 0x80, 0xF0, 0x03,
+0x90, 0x0B, 0x50, 0x91, 0x10, 0xF0, 0x30, 0x90, 0x00, 0x80, 0x90, 0x0F, 0x33, 0x0F, 0x35, 0xF0,
+0x60, 0x70, 0x01, 0xF0, 0xC0, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD3, 0x40, 0xB0, 0xD5,
+0xA0, 0x50, 0x01, 0xF0, 0x05, 0x90, 0xA0, 0xE0, 0x50, 0x04, 0x60, 0xB0, 0x70, 0x61, 0xA1, 0x02,
+0x50, 0x70, 0x0D, 0x71, 0x00, 0x60, 0xB0, 0xD3, 0x20, 0xD1, 0x20, 0xD1, 0xB1, 0xD6, 0xB0, 0x41,
+0xB0, 0x20, 0x40, 0xB0, 0xD3, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xB0, 0xD1, 0x20, 0xD2, 0x23, 0xD0,
+0xB1, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0xD4, 0x20, 0xD2, 0x20, 0xD1, 0x40, 0xD1,
+0x22, 0xD6, 0x40, 0x23, 0xD0, 0x20, 0xD2, 0x20, 0xD1, 0x40, 0xB1, 0x41, 0xB0, 0xD2, 0x20, 0xD0,
+0x21, 0xD0, 0x40, 0xD5, 0x24, 0xD2, 0x40, 0xD0, 0x21, 0xD1, 0x22, 0xD0, 0x23, 0xD1, 0x40, 0xD1,
+0xE0, 0x11, 0x80, 0x00, 0x10, 0xC0, 0x00, 0x70, 0x05, 0xE1, 0xD1, 0x60, 0x10, 0x30, 0x71, 0x50,
+0x90, 0x60, 0x80, 0x50, 0xC0, 0x80, 0x03, 0x90, 0x0D, 0xA0, 0x50, 0x80, 0xC0, 0x80, 0x02, 0x60,
+0x80, 0x0F, 0x32, 0x0F, 0x2B, 0x80, 0x50, 0x06, 0xF0, 0xA0, 0x70, 0xA0, 0x01, 0xE1, 0xD3, 0x21,
+0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD2, 0xA0, 0x70, 0x90, 0xA2,
+0x70, 0x01, 0xF0, 0x00, 0x10, 0x50, 0x90, 0xA0, 0x60, 0xE0, 0x90, 0xF0, 0x00, 0x90, 0xC0, 0xE0,
+0xA0, 0xE1, 0x30, 0x90, 0x02, 0x90, 0x0E, 0x90, 0x00, 0x60, 0xD6, 0x20, 0xD2, 0xB1, 0xD3, 0xB0,
+0x41, 0xB0, 0xD3, 0xB1, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0x20,
+0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x22, 0xD2, 0xB0, 0x20, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0x40, 0xD2, 0x21, 0xD1, 0x20, 0xD2, 0xB1, 0xD0, 0x26, 0xD1, 0x21, 0x40, 0xD3, 0xB0, 0x41,
+0xB0, 0x20, 0xD2, 0xB1, 0xD5, 0x25, 0xD0, 0xB1, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x21,
+0xD0, 0xB1, 0xD2, 0xA0, 0x11, 0x90, 0x30, 0xC0, 0x00, 0x10, 0x80, 0x03, 0x50, 0x70, 0x60, 0xD2,
+0x40, 0xE0, 0xC0, 0x10, 0xC0, 0xA0, 0x10, 0x60, 0xA0, 0xC0, 0x90, 0xF0, 0x01, 0x90, 0xF0, 0x0D,
+0xA0, 0x00, 0xA0, 0x00, 0x10, 0x70, 0x00, 0x30, 0x90, 0x81, 0x0F, 0x31, 0x0F, 0x2A, 0x90, 0x50,
+0x30, 0x06, 0x60, 0x02, 0xA1, 0xE0, 0xD2, 0x20, 0xD7, 0x24, 0xD2, 0x40, 0xD4, 0xB0, 0x60, 0xE0,
+0xD1, 0xE0, 0x10, 0xA0, 0x60, 0xA0, 0x60, 0xA0, 0x70, 0xA0, 0xE0, 0x40, 0xE1, 0x10, 0x01, 0xF0,
+0x90, 0x50, 0x91, 0xC0, 0x90, 0x02, 0x70, 0x50, 0x0D, 0x70, 0x90, 0xE0, 0xD1, 0x20, 0xD3, 0x20,
+0xD3, 0x40, 0xD0, 0xB0, 0x41, 0xB0, 0xD7, 0x40, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x40,
+0xD8, 0x20, 0xD1, 0xB0, 0xD0, 0x27, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD3, 0x20, 0xB0,
+0xD1, 0x22, 0xD2, 0x21, 0xD0, 0xB1, 0xD0, 0x23, 0xD5, 0xB1, 0xD6, 0xB0, 0x42, 0xD0, 0xB0, 0xD2,
+0x20, 0xD2, 0x21, 0xD1, 0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xD1,
+0x20, 0xD1, 0xA0, 0x10, 0x61, 0xA0, 0x70, 0x60, 0x10, 0xC1, 0x31, 0xF0, 0x61, 0xDB, 0x70, 0x10,
+0x80, 0x00, 0x50, 0x70, 0x0E, 0x60, 0x90, 0x10, 0x50, 0x00, 0xC0, 0x30, 0x90, 0x01, 0x80, 0x90,
+0x0F, 0x30, 0x0F, 0x2A, 0x70, 0x30, 0x80, 0x04, 0xF0, 0x60, 0xA0, 0x02, 0x30, 0xE0, 0xD2, 0x22,
+0xD6, 0x25, 0xD1, 0xB0, 0x40, 0xD2, 0x20, 0xD4, 0xE0, 0xA0, 0x60, 0xD4, 0xB0, 0x60, 0xA0, 0xD0,
+0xB0, 0xC0, 0x05, 0x70, 0x10, 0x04, 0x90, 0x0E, 0x50, 0x10, 0xE0, 0xD0, 0x21, 0xD0, 0x21, 0xD3,
+0xB0, 0x41, 0xB0, 0xD4, 0x21, 0xD3, 0x40, 0xD3, 0x23, 0xD3, 0x40, 0xD8, 0x20, 0xD1, 0x40, 0xD0,
+0x21, 0xD0, 0x24, 0xD1, 0xB0, 0x20, 0xD1, 0x24, 0xD2, 0x20, 0xB0, 0xD1, 0x22, 0xD1, 0x22, 0xD0,
+0xB1, 0xD1, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD0, 0x23, 0xD5, 0x40, 0xE0, 0xB0, 0x20, 0xD3,
+0x22, 0xD3, 0xB1, 0xD1, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD1,
+0xE0, 0xC1, 0x15, 0xC0, 0x60, 0x80, 0xA0, 0xD2, 0x26, 0xD0, 0x21, 0xB0, 0xA0, 0x00, 0x71, 0x0F,
+0x00, 0xC0, 0x50, 0xA0, 0xC0, 0x90, 0x70, 0x10, 0x70, 0x01, 0x80, 0xC0, 0x90, 0x0F, 0x2F, 0x0F,
+0x29, 0x50, 0xF0, 0x06, 0xA0, 0xF0, 0x00, 0xA0, 0xF0, 0x30, 0xE0, 0xD0, 0x40, 0xD2, 0x22, 0xD5,
+0x23, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD0, 0x22, 0xD1, 0x20, 0xD9, 0x40, 0xE0, 0xB0, 0x40, 0xC0,
+0x90, 0x05, 0xF0, 0x04, 0xF0, 0x50, 0x0C, 0x70, 0xA1, 0x60, 0xD0, 0x21, 0xD3, 0x20, 0xB0, 0x40,
+0xB1, 0x40, 0xD4, 0x21, 0xD0, 0x22, 0xD0, 0xB0, 0x20, 0xD1, 0x24, 0xD3, 0xB0, 0xD1, 0x20, 0xD2,
+0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x27, 0xD1, 0xB0, 0x20, 0xD0, 0x26, 0xD1, 0xB1, 0xD1, 0x27,
+0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD4, 0xB2,
+0x41, 0xB0, 0xD1, 0x21, 0xD4, 0x40, 0xD2, 0x22, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0xB0, 0x40, 0xD0,
+0x21, 0xD0, 0x20, 0xD4, 0xB1, 0x40, 0xB0, 0xE0, 0x60, 0xE0, 0x40, 0xE0, 0xD4, 0x27, 0xD1, 0xC0,
+0x60, 0x30, 0xF0, 0x0E, 0x80, 0xC0, 0x60, 0x50, 0x70, 0xA0, 0x70, 0x00, 0x10, 0x70, 0x80, 0x90,
+0x00, 0x80, 0x90, 0x0F, 0x2E, 0x0F, 0x28, 0x60, 0xA0, 0xC0, 0x30, 0x04, 0xC0, 0x70, 0x01, 0xF0,
+0xC0, 0xE0, 0xD2, 0x40, 0xD1, 0x24, 0xD4, 0x23, 0xD0, 0x21, 0xD1, 0xB1, 0xD0, 0x23, 0xD7, 0x20,
+0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x80, 0x10, 0xF0, 0x0B, 0x50, 0xF0, 0x0A, 0x50, 0x60, 0x50, 0xA1,
+0xD0, 0x20, 0xD3, 0x41, 0xB0, 0xD2, 0x40, 0xD2, 0x22, 0xD1, 0x22, 0xD0, 0xB1, 0xD1, 0x24, 0xD3,
+0xB1, 0xD0, 0x28, 0xD0, 0x40, 0xD0, 0x27, 0xD1, 0xB0, 0x20, 0xD1, 0x25, 0xD1, 0xB1, 0xD1, 0x27,
+0xD0, 0x40, 0xD3, 0x21, 0xD0, 0x22, 0xD1, 0x40, 0xD0, 0x24, 0xD1, 0x20, 0xD2, 0x40, 0xB0, 0xD2,
+0xB0, 0x40, 0xB0, 0x20, 0xD4, 0xB0, 0x40, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xD0,
+0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0x21, 0xD4, 0xB1, 0xD1, 0x20, 0xD4, 0x22, 0xD1, 0x22, 0xD0,
+0xE0, 0x30, 0xF0, 0xA0, 0xC0, 0x90, 0x08, 0x90, 0xF0, 0x01, 0xA0, 0x50, 0x01, 0x90, 0xA0, 0x02,
+0x10, 0x80, 0x02, 0x60, 0x50, 0x0F, 0x2D, 0x0F, 0x27, 0x90, 0xE0, 0x01, 0xA0, 0x60, 0x02, 0xA0,
+0x50, 0xA0, 0x01, 0xA0, 0x40, 0xD4, 0x40, 0xD1, 0x28, 0xD1, 0x25, 0xD1, 0x40, 0xB0, 0xD0, 0x23,
+0xD0, 0x23, 0xD2, 0x22, 0xD1, 0xE0, 0x10, 0xA0, 0x0D, 0x90, 0x0A, 0xA0, 0xE0, 0x31, 0x10, 0x40,
+0xD1, 0xB0, 0x41, 0xD2, 0x20, 0xD1, 0xB1, 0xD1, 0x25, 0xD3, 0x40, 0xD1, 0x26, 0xD1, 0xB1, 0xD0,
+0x28, 0xD0, 0x40, 0xD0, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23,
+0xD1, 0xB1, 0xD1, 0x23, 0xD0, 0x21, 0xD0, 0x20, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD0,
+0xB1, 0xD0, 0x20, 0xD2, 0x23, 0xD2, 0x40, 0xD1, 0x20, 0xD2, 0xB0, 0x41, 0x20, 0xD2, 0x40, 0xD2,
+0x20, 0xD0, 0x22, 0xD5, 0xB1, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0x22, 0xD3, 0xB0, 0x40, 0xD1, 0x23,
+0xD3, 0x21, 0xD5, 0x80, 0x60, 0x02, 0x81, 0x07, 0xA0, 0xC0, 0x50, 0x00, 0x90, 0x30, 0x00, 0x50,
+0xF0, 0x50, 0xC0, 0xF0, 0x01, 0x10, 0xF0, 0x00, 0x81, 0x30, 0x70, 0x05, 0x70, 0xC0, 0x50, 0x0F,
+0x23, 0x0F, 0x27, 0x70, 0xC0, 0x02, 0x30, 0x80, 0x00, 0x30, 0x70, 0x00, 0xF0, 0xA0, 0x30, 0xE0,
+0xD6, 0x40, 0x20, 0xD1, 0x26, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x40, 0xB0, 0xD6, 0x20,
+0xD2, 0x20, 0xD0, 0x22, 0xD0, 0xB0, 0x50, 0x60, 0xF0, 0x0C, 0x71, 0x0A, 0x30, 0x71, 0x60, 0xB0,
+0x41, 0xB0, 0xD3, 0x21, 0xD2, 0x40, 0xD1, 0x24, 0xD4, 0x40, 0xD3, 0x23, 0xD3, 0x40, 0xD0, 0x27,
+0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0xB1, 0xD6, 0x22, 0xD0, 0x40,
+0xB0, 0xD5, 0x22, 0xD1, 0xB1, 0xD3, 0x21, 0xD2, 0x41, 0xB1, 0x40, 0xD2, 0x22, 0xD0, 0x21, 0xD1,
+0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x22, 0xD6, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD3, 0x21, 0xD4,
+0x41, 0x10, 0x90, 0x31, 0x00, 0x60, 0x30, 0x70, 0x04, 0xF0, 0x30, 0x00, 0x80, 0x30, 0x90, 0x30,
+0x72, 0x10, 0x50, 0x03, 0x10, 0x30, 0x90, 0x01, 0xA0, 0xF0, 0x03, 0xA0, 0xC0, 0x70, 0xC0, 0x70,
+0x0F, 0x22, 0x0F, 0x25, 0x30, 0x01, 0x80, 0x60, 0xF0, 0x01, 0xA0, 0x80, 0x60, 0x02, 0x80, 0xE0,
+0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x27, 0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x40,
+0x60, 0xD1, 0x24, 0xD0, 0x22, 0xD2, 0x40, 0x50, 0xA0, 0x0D, 0x90, 0x0C, 0x80, 0xA0, 0x40, 0xB0,
+0xD4, 0x20, 0xD1, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD3, 0x20, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x22,
+0xD4, 0x40, 0xD0, 0x21, 0xD7, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x23, 0xD1, 0xB0, 0x20, 0xD2, 0x21, 0xD1, 0x20, 0xD1, 0xB1, 0xA0, 0x60, 0x40, 0xD1, 0x20,
+0xD4, 0x40, 0xD4, 0x24, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD4, 0xB0, 0xE0, 0xB0, 0xD2, 0x21,
+0xD2, 0x23, 0xD0, 0xB1, 0xD1, 0x21, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x21, 0xD2,
+0x26, 0xD3, 0x40, 0xB0, 0xD0, 0x60, 0x12, 0x50, 0xF1, 0xC0, 0x10, 0x60, 0x30, 0x80, 0xA1, 0x50,
+0x01, 0xF0, 0x90, 0x60, 0x70, 0x01, 0x30, 0x90, 0x03, 0x60, 0x10, 0x02, 0x80, 0x60, 0xF0, 0x00,
+0x70, 0xF0, 0x90, 0xA0, 0xF0, 0x70, 0xA0, 0x0F, 0x22, 0x0F, 0x25, 0x10, 0x60, 0xF0, 0x00, 0x80,
+0xC0, 0x90, 0x80, 0x10, 0x90, 0xF0, 0x60, 0x00, 0x90, 0xA0, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x20,
+0xD1, 0x40, 0xD2, 0x26, 0xD0, 0x21, 0xD1, 0x23, 0xD1, 0x41, 0x10, 0x40, 0xD1, 0x27, 0xD4, 0x40,
+0xA0, 0x0D, 0x70, 0x50, 0x0A, 0x50, 0x30, 0x60, 0xB0, 0xD0, 0xE0, 0x60, 0x40, 0xD4, 0x20, 0xD1,
+0xB1, 0xD1, 0x20, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x20, 0xD5, 0x40, 0xD0,
+0x20, 0xD2, 0x21, 0xD3, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x23, 0xD1, 0x40, 0x20, 0xD2, 0x20, 0xD5, 0xB0, 0xE0, 0x50, 0x00, 0xC0, 0x40, 0xD1, 0x20, 0xD2,
+0xB1, 0xD1, 0x21, 0xD2, 0x22, 0xD1, 0xB0, 0xD1, 0x23, 0xD6, 0x40, 0xB0, 0x40, 0xB0, 0xD0, 0x20,
+0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD7,
+0x25, 0xD2, 0xB1, 0xD2, 0xE0, 0xC0, 0x30, 0x01, 0x90, 0x30, 0x80, 0x00, 0x90, 0xC0, 0xA0, 0x80,
+0x03, 0x70, 0xA0, 0x90, 0x02, 0x60, 0x03, 0x50, 0xC0, 0x10, 0x00, 0x81, 0xF0, 0xA0, 0x00, 0xC0,
+0x70, 0x00, 0x70, 0xA0, 0x0F, 0x24, 0x0F, 0x25, 0xA0, 0x90, 0x10, 0x70, 0x00, 0xF0, 0x90, 0x60,
+0x90, 0x02, 0x60, 0xA0, 0xD1, 0x22, 0xD0, 0x24, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x23,
+0xD0, 0x25, 0xD2, 0xA0, 0xB0, 0xD3, 0x24, 0xD0, 0x20, 0xD4, 0xE0, 0x80, 0x0E, 0x90, 0x07, 0xF0,
+0x51, 0x90, 0xE0, 0xD0, 0x40, 0xD0, 0xA0, 0x00, 0xA0, 0xB0, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD3, 0xB1,
+0xD4, 0x21, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD0,
+0x22, 0xD2, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x70, 0x41, 0x80, 0x30, 0x10, 0x00, 0xF0, 0xC0,
+0xE0, 0xD1, 0x21, 0xD0, 0xB1, 0xD0, 0x23, 0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x20, 0xD5,
+0x40, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0x20, 0xD2, 0x21, 0xD0, 0x21,
+0xD0, 0x21, 0xD3, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x22, 0xD0, 0x23, 0xD0, 0xB0, 0x40, 0xD0,
+0x22, 0xD1, 0xA0, 0x40, 0x00, 0x10, 0x04, 0xC0, 0x70, 0x02, 0x50, 0x70, 0x00, 0xA0, 0x70, 0x50,
+0x70, 0x60, 0x04, 0x50, 0xC0, 0x10, 0x90, 0x01, 0xF0, 0xA0, 0x60, 0x01, 0x90, 0xA0, 0x00, 0x90,
+0x60, 0x80, 0x0F, 0x20, 0x0F, 0x25, 0x50, 0x00, 0xF0, 0x10, 0x90, 0x00, 0x50, 0xA0, 0x30, 0x01,
+0x70, 0xA0, 0xD2, 0x21, 0xD1, 0x25, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x28, 0xD0, 0x21, 0xD2, 0xE0,
+0x40, 0xD2, 0x23, 0xD3, 0x21, 0xD1, 0xA0, 0xC0, 0x70, 0x0E, 0xF0, 0x50, 0x05, 0x90, 0x50, 0x00,
+0x70, 0x60, 0xD2, 0xB0, 0x30, 0xF0, 0x70, 0xE0, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0xB1, 0xD1, 0x21,
+0xD0, 0x24, 0xD0, 0xB0, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD3, 0xB1, 0xD3, 0x22, 0xD2, 0xB1, 0xD1,
+0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x40, 0xD0, 0x21,
+0xD2, 0xE0, 0xC0, 0x10, 0xA0, 0xE0, 0xA0, 0xC0, 0x10, 0x00, 0xF0, 0xC0, 0x61, 0xD3, 0x40, 0xD1,
+0x22, 0xD6, 0x40, 0xD4, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xD4, 0xB0, 0x40, 0xB0, 0xD4, 0xB0, 0x40,
+0xD1, 0x21, 0xD2, 0x21, 0xD2, 0x21, 0xD0, 0x40, 0xD5, 0x20, 0xD0, 0x23, 0xD2, 0x20, 0xD0, 0x20,
+0x40, 0xD0, 0x24, 0xD1, 0xE0, 0x11, 0x70, 0x01, 0x80, 0xC0, 0x90, 0x02, 0x50, 0x70, 0x02, 0xA0,
+0x10, 0xA0, 0x80, 0x60, 0xC0, 0xF1, 0x00, 0x10, 0x60, 0x30, 0x60, 0x01, 0x90, 0x30, 0x61, 0xC0,
+0x60, 0xF0, 0xC0, 0xA0, 0xF0, 0x30, 0x90, 0x0F, 0x1F, 0x0F, 0x21, 0x70, 0x61, 0xF0, 0x02, 0xF0,
+0x60, 0x50, 0x30, 0x00, 0x70, 0xA0, 0x50, 0x60, 0xD3, 0x20, 0xD0, 0x26, 0xD3, 0x40, 0xD1, 0x20,
+0xD0, 0x29, 0xD0, 0x20, 0xD1, 0xB0, 0x60, 0xB1, 0xD2, 0x23, 0xD1, 0x21, 0xD2, 0x40, 0xE0, 0x60,
+0x90, 0x0E, 0x50, 0xF0, 0x02, 0x51, 0x02, 0x90, 0xE0, 0xD2, 0x40, 0xE0, 0x70, 0x00, 0xA0, 0xD0,
+0x22, 0xD0, 0x21, 0xD1, 0xB0, 0xD1, 0x21, 0xD0, 0x24, 0xD0, 0xB1, 0xD0, 0x22, 0xD0, 0x20, 0xD3,
+0x20, 0xB0, 0xD3, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1,
+0x20, 0xD1, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD2, 0xE0, 0x40, 0xC0, 0x50, 0x00, 0x90, 0xC0, 0x30,
+0xA1, 0xF0, 0x61, 0x10, 0x30, 0xE1, 0xD0, 0x40, 0xD1, 0x24, 0xD3, 0x20, 0x40, 0xD3, 0x23, 0xD1,
+0x60, 0xD0, 0xB1, 0xD6, 0xB0, 0x40, 0xB0, 0xD2, 0x40, 0x20, 0xD3, 0x21, 0xD2, 0x22, 0xD1, 0xB0,
+0xC0, 0xE0, 0xB0, 0xD0, 0x28, 0xD1, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD5, 0xA0, 0x10, 0x90, 0x01,
+0x60, 0x30, 0x02, 0x51, 0x04, 0xA0, 0x60, 0x01, 0x50, 0xC0, 0xA1, 0x50, 0xA0, 0x50, 0x60, 0xA0,
+0x81, 0x00, 0x50, 0x80, 0x01, 0xC0, 0x90, 0x01, 0x90, 0xE0, 0x0F, 0x1F, 0x0F, 0x21, 0x60, 0x70,
+0x80, 0x30, 0xF0, 0x03, 0xC0, 0x80, 0x01, 0x70, 0xC0, 0xD5, 0x20, 0xD0, 0x22, 0xD4, 0x20, 0xD1,
+0x40, 0xD1, 0x2B, 0xD2, 0x20, 0xB0, 0xD0, 0x40, 0xB0, 0xD2, 0x22, 0xD2, 0x21, 0xD3, 0xB0, 0x60,
+0xE0, 0x0A, 0xF0, 0x02, 0x50, 0x00, 0x70, 0x90, 0x70, 0x03, 0xF0, 0xA0, 0xD2, 0xB0, 0xE0, 0x90,
+0x00, 0xA0, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x40, 0xD2, 0x25, 0xD2, 0x40, 0xD0, 0x22, 0xD0, 0x21,
+0xD3, 0x40, 0xD3, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1,
+0x20, 0xD6, 0x40, 0xD3, 0xB0, 0x10, 0x50, 0x60, 0x01, 0x60, 0x30, 0xC0, 0x00, 0x60, 0x30, 0x00,
+0x70, 0xE0, 0x80, 0x10, 0xC0, 0xB2, 0x40, 0xD2, 0x20, 0xD4, 0x40, 0x20, 0xD2, 0x21, 0xD0, 0x22,
+0xD0, 0x60, 0xE0, 0x40, 0xD5, 0x20, 0xD2, 0x41, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x22,
+0xD2, 0x40, 0xE0, 0x11, 0x25, 0xD0, 0x23, 0xD2, 0x40, 0xD3, 0x20, 0xD6, 0xC0, 0xF0, 0x00, 0xC0,
+0x90, 0xF0, 0x01, 0x50, 0x70, 0x06, 0x70, 0x04, 0xF0, 0x00, 0x70, 0xA0, 0x70, 0xC0, 0x60, 0x02,
+0x10, 0x50, 0x90, 0x30, 0x01, 0xF0, 0x10, 0xF0, 0x0F, 0x1F, 0x0F, 0x20, 0xF0, 0xC0, 0x00, 0x80,
+0xC1, 0xA0, 0x01, 0xA0, 0xC0, 0x10, 0x80, 0x00, 0xA0, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x23,
+0xD3, 0x21, 0xD3, 0x40, 0xD4, 0x25, 0xD0, 0x21, 0xD5, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x23, 0xD1, 0x20, 0xD1, 0xE0, 0x10, 0xF0, 0x07, 0x70, 0x10, 0x02, 0x50, 0x90, 0x70, 0x06,
+0x60, 0xD0, 0x20, 0xD1, 0x40, 0x60, 0x00, 0xE0, 0xB0, 0x21, 0xD1, 0x21, 0xD1, 0xB1, 0xD0, 0x22,
+0xD0, 0x22, 0xD2, 0x40, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20,
+0xD2, 0x20, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD5, 0xB1,
+0xD3, 0xE0, 0x81, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x80, 0x01, 0x90, 0x04, 0xC0, 0x30, 0x90, 0xA0,
+0xC0, 0xE0, 0x40, 0xD6, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD1, 0x21,
+0xD1, 0x20, 0xD3, 0x20, 0x41, 0xD3, 0x22, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD4, 0x20, 0xD1,
+0x22, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD2, 0x40, 0xE0,
+0x10, 0x50, 0x02, 0x50, 0x70, 0x0F, 0x01, 0xE1, 0x70, 0x10, 0x90, 0x00, 0x11, 0xA1, 0x50, 0x00,
+0x50, 0x10, 0x50, 0xF0, 0x31, 0xF0, 0x0F, 0x1C, 0x0F, 0x21, 0x50, 0x00, 0x70, 0x01, 0xA0, 0xF0,
+0x30, 0x70, 0x00, 0x30, 0x11, 0x40, 0xD1, 0x21, 0xD0, 0x25, 0xD3, 0x23, 0xD2, 0x40, 0xD3, 0x25,
+0xD0, 0x21, 0xD1, 0x21, 0xD2, 0x40, 0xD2, 0x20, 0xD1, 0x24, 0xD5, 0x40, 0x10, 0xF0, 0x07, 0x10,
+0xA0, 0x00, 0x90, 0x70, 0x50, 0x07, 0xA0, 0xD3, 0xB0, 0xE0, 0x90, 0xE0, 0xB0, 0x22, 0xD1, 0x20,
+0xD1, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0xB0, 0x20, 0xD0, 0x20, 0xD1, 0x23,
+0xD1, 0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0,
+0x21, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD3, 0x20, 0xD0, 0xB1, 0xD3, 0xE0, 0x10, 0xE0, 0x02, 0xC0,
+0x0A, 0x80, 0xC0, 0x11, 0xA1, 0xC0, 0xE0, 0xB0, 0xD2, 0xB1, 0xD2, 0x23, 0xD0, 0x20, 0xD2, 0x40,
+0xD3, 0x23, 0xD0, 0x22, 0xD0, 0x40, 0xB0, 0x40, 0xB0, 0xD3, 0x21, 0xD1, 0x21, 0xD1, 0x40, 0xB0,
+0xD0, 0x23, 0xD3, 0x20, 0xD2, 0x20, 0xD1, 0x40, 0xB0, 0xD0, 0x20, 0xD5, 0xA0, 0x90, 0x60, 0xB0,
+0xD0, 0x70, 0xC0, 0xF0, 0x02, 0x50, 0x70, 0x0F, 0x03, 0x60, 0xD1, 0x12, 0xF0, 0x00, 0x30, 0x60,
+0xC0, 0x60, 0xF0, 0x00, 0x70, 0x81, 0x50, 0x0F, 0x1C, 0x0F, 0x26, 0xA0, 0x80, 0x60, 0x02, 0xA0,
+0xE0, 0xD2, 0x20, 0xD0, 0x25, 0xD4, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xD4, 0x24, 0xD1, 0x20, 0xD0,
+0x20, 0xD3, 0xB0, 0x40, 0xD2, 0x23, 0xD0, 0x20, 0xD3, 0x21, 0xD1, 0x40, 0x60, 0x70, 0x06, 0xC0,
+0x10, 0x50, 0x01, 0xF0, 0x50, 0x06, 0xA0, 0xD0, 0x22, 0xD0, 0x40, 0xA1, 0xD1, 0x22, 0xD2, 0x20,
+0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xB0, 0xD0, 0x20, 0xD1,
+0x23, 0xD1, 0xB1, 0xD0, 0x22, 0xD2, 0x22, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0,
+0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0xB0, 0xC1, 0x10, 0xF0,
+0x01, 0x90, 0x0A, 0x50, 0xF0, 0x60, 0x51, 0x60, 0x90, 0x10, 0xC0, 0xB0, 0xC1, 0xB0, 0xD2, 0x21,
+0xD1, 0x22, 0xD1, 0xB1, 0xD0, 0x22, 0xD2, 0x23, 0xD0, 0x20, 0x40, 0xD1, 0xB0, 0x40, 0xB0, 0xD1,
+0x21, 0xD4, 0xB0, 0x40, 0xD1, 0x22, 0xD0, 0xB0, 0xC0, 0xD2, 0xA1, 0x40, 0xD1, 0xB1, 0xD3, 0x40,
+0xE0, 0x40, 0x80, 0xE0, 0x80, 0x00, 0x70, 0xC0, 0x50, 0x40, 0xA0, 0x70, 0x01, 0x50, 0x70, 0x0F,
+0x03, 0xF0, 0xC0, 0xD1, 0xE0, 0x10, 0x70, 0x01, 0x90, 0x60, 0xF0, 0x03, 0x51, 0x0F, 0x1D, 0x0F,
+0x23, 0xF0, 0xC1, 0x31, 0x70, 0xA0, 0xF0, 0x70, 0xA0, 0xD0, 0x40, 0xB0, 0xD1, 0x26, 0xD3, 0x25,
+0xD0, 0x20, 0xD1, 0x40, 0xD3, 0x27, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0xB0, 0x40, 0xD2, 0x23, 0xD4,
+0x21, 0xD1, 0xB0, 0x40, 0x60, 0xF0, 0x04, 0x70, 0xA0, 0x30, 0x03, 0x90, 0x05, 0x70, 0x60, 0xD0,
+0x22, 0xD0, 0xB1, 0xD1, 0x23, 0xD2, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD1,
+0x40, 0xD0, 0x20, 0xD2, 0x23, 0xD0, 0xB1, 0xD0, 0x23, 0xD1, 0x22, 0x40, 0xD1, 0x22, 0xD0, 0x21,
+0xD1, 0xB0, 0x20, 0xD0, 0x26, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x40, 0x10, 0x60, 0x30, 0x02, 0x90,
+0x09, 0xF0, 0x50, 0x02, 0x50, 0x10, 0xC0, 0x10, 0xA0, 0xE0, 0x10, 0x60, 0xB0, 0xD2, 0x20, 0xD3,
+0x21, 0xD1, 0x40, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x20, 0xD1, 0x40,
+0xB0, 0xD7, 0x40, 0xD2, 0x22, 0xD0, 0x40, 0xC1, 0xE0, 0xD0, 0xA0, 0x00, 0xE1, 0xD0, 0x40, 0xD0,
+0x40, 0xB1, 0xA0, 0xE0, 0x90, 0x10, 0x90, 0x30, 0x60, 0x01, 0x80, 0x11, 0xE0, 0x30, 0xA0, 0x50,
+0x70, 0x0F, 0x03, 0x70, 0x60, 0x40, 0xD0, 0x40, 0xD0, 0x40, 0x10, 0x00, 0x81, 0x50, 0x30, 0x0F,
+0x23, 0x0F, 0x25, 0xF0, 0x30, 0x01, 0xF0, 0xA0, 0x60, 0xD2, 0xB0, 0x40, 0xD3, 0x23, 0xD4, 0x25,
+0xD3, 0x40, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0xB1, 0xD1, 0x22,
+0xD2, 0x23, 0xD1, 0x20, 0xD0, 0x40, 0xB0, 0x60, 0x30, 0x70, 0x01, 0x70, 0xA0, 0x60, 0x50, 0x04,
+0x50, 0x04, 0x10, 0xB0, 0xD0, 0x23, 0xD0, 0x40, 0xD2, 0x21, 0xD3, 0x21, 0xD0, 0x40, 0xD1, 0x20,
+0xD0, 0x21, 0xD1, 0x21, 0xD0, 0x40, 0xD0, 0x20, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x22, 0xD3, 0x20,
+0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x24, 0xD0, 0x22, 0xD0, 0xB0, 0xD3, 0x40, 0xC0,
+0x11, 0xF0, 0x01, 0x50, 0x09, 0x50, 0x04, 0x50, 0x90, 0x80, 0x90, 0x60, 0x10, 0x60, 0xA0, 0xE0,
+0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB1, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0xB0,
+0x40, 0xD5, 0xB0, 0x40, 0x20, 0xD2, 0xB0, 0xC0, 0x40, 0xD1, 0x23, 0xD2, 0x70, 0xE1, 0x80, 0xE0,
+0x01, 0x90, 0x30, 0x80, 0xA0, 0x90, 0x80, 0xE0, 0x90, 0x01, 0x70, 0x05, 0x80, 0xF0, 0x60, 0x70,
+0x90, 0x30, 0x0F, 0x04, 0x90, 0xC0, 0xD0, 0x40, 0xD2, 0xA0, 0x10, 0x50, 0x01, 0x90, 0x80, 0x0F,
+0x22, 0x0F, 0x25, 0x60, 0x30, 0x02, 0x60, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x21, 0xD0, 0x22,
+0xD2, 0x26, 0xD4, 0x40, 0xD2, 0x20, 0xD0, 0x23, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x40, 0xB0, 0xD0,
+0x21, 0xD4, 0x21, 0xD0, 0x23, 0xB0, 0x40, 0x70, 0x10, 0x00, 0xF0, 0x30, 0xC0, 0xA0, 0xD0, 0x60,
+0x90, 0x00, 0x50, 0xC0, 0x10, 0x90, 0xF0, 0x02, 0x50, 0xC0, 0xD2, 0x22, 0xD0, 0xB1, 0xD1, 0x22,
+0xD2, 0x21, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0xB0, 0x20, 0xD2, 0x24, 0xD1,
+0x40, 0xD0, 0x22, 0xD3, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD0, 0x20,
+0xD0, 0x23, 0xD1, 0xB0, 0xD3, 0xB0, 0xC0, 0x30, 0x60, 0x30, 0x00, 0x71, 0x09, 0x90, 0x07, 0x90,
+0x80, 0xC0, 0x80, 0xC0, 0x60, 0x40, 0xD1, 0x25, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x20,
+0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x40, 0xB0, 0xD1, 0x40, 0xC0, 0xE0, 0x60,
+0xD1, 0x24, 0xD0, 0xB0, 0xC0, 0x00, 0xC0, 0x10, 0x01, 0x90, 0xA0, 0x10, 0x0F, 0x00, 0x80, 0xE0,
+0x50, 0xA0, 0x0F, 0x04, 0xA0, 0xE0, 0x40, 0xD4, 0xC0, 0xE0, 0x01, 0x90, 0x60, 0x50, 0x0F, 0x21,
+0x0F, 0x24, 0x30, 0x71, 0xA0, 0xF0, 0xA0, 0xB0, 0xD1, 0x20, 0xD2, 0x20, 0x40, 0xD2, 0x20, 0xD0,
+0x22, 0xD2, 0x27, 0xD3, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD1, 0x23, 0xD3, 0x40, 0xB0,
+0xD1, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x90, 0x30, 0x70, 0x80, 0x10, 0x40,
+0xD2, 0xE0, 0xA0, 0x61, 0xC0, 0x70, 0x50, 0x02, 0xE0, 0xB0, 0xD0, 0x24, 0xD1, 0x40, 0xD0, 0x24,
+0xD1, 0x21, 0xD0, 0xB1, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xB0, 0xD2, 0x24, 0xD1, 0x40, 0xD0,
+0x22, 0xD2, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x24, 0xD4, 0x40, 0xD2, 0xB0,
+0x60, 0xC1, 0x02, 0x50, 0x09, 0xF0, 0x50, 0x09, 0xF0, 0x90, 0x11, 0x60, 0xA0, 0xD2, 0x22, 0xD0,
+0xB1, 0xD3, 0x22, 0xD1, 0x20, 0xD1, 0xB1, 0xD0, 0x23, 0xD4, 0xB0, 0x40, 0xB0, 0xD0, 0x40, 0xD0,
+0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0xB0, 0xC0, 0x90, 0xF0, 0x31, 0x50, 0xF0, 0x00, 0x10, 0x01,
+0xF0, 0x0C, 0xE0, 0xB0, 0xD0, 0xE1, 0xF0, 0x0F, 0x02, 0xC0, 0x90, 0xD2, 0x20, 0xD2, 0xC0, 0x90,
+0x81, 0x00, 0xA0, 0x0F, 0x21, 0x0F, 0x23, 0x50, 0x80, 0x02, 0xC0, 0x40, 0xD1, 0x20, 0xD0, 0x21,
+0xD2, 0x40, 0xB0, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x26, 0xD1, 0x20, 0xD1, 0x40, 0xD4, 0x20, 0xD4,
+0x23, 0xD3, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x40, 0xE1, 0x60, 0xB0,
+0xD1, 0x20, 0xD2, 0x60, 0x70, 0x01, 0x71, 0x01, 0xA0, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0x20,
+0xD1, 0x22, 0xD1, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0xD1, 0x25, 0xD1, 0x40,
+0x20, 0xD1, 0x20, 0xD3, 0x20, 0xD0, 0xB1, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD3, 0xE2, 0xA0, 0x40, 0xD0, 0xA0, 0xE0, 0x10, 0x30, 0x02, 0x90, 0x09, 0x71, 0x09, 0x70, 0xF0,
+0x70, 0x90, 0x30, 0xE0, 0xD3, 0x20, 0xD1, 0x40, 0xD4, 0x23, 0xD3, 0x40, 0xD1, 0x27, 0xD2, 0x40,
+0xE0, 0xD5, 0x23, 0xD1, 0xB0, 0xC0, 0x30, 0x00, 0x80, 0x90, 0x04, 0xA0, 0x30, 0xF0, 0x60, 0x50,
+0x07, 0x70, 0xA0, 0xD2, 0x60, 0x80, 0x0F, 0x01, 0x50, 0x90, 0xE0, 0xD6, 0xB0, 0x10, 0x90, 0x01,
+0xF0, 0xA0, 0x0F, 0x20, 0x0F, 0x22, 0xF0, 0x60, 0xA0, 0x01, 0x50, 0xA0, 0xD1, 0x20, 0xD0, 0x21,
+0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD1, 0x22, 0xD0, 0x2C, 0xD2, 0x40, 0xD3, 0xE0, 0x60, 0xD0, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD2,
+0x41, 0xE1, 0xD4, 0x20, 0xD1, 0xE0, 0x90, 0x02, 0x50, 0x00, 0x60, 0x40, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD3, 0x40, 0xD1, 0x22, 0xD1, 0x22, 0xD0, 0xB1, 0xD2, 0x23, 0xD0, 0x20, 0xD0, 0x40,
+0xD1, 0x25, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD1, 0x21, 0xD0, 0x21,
+0xD1, 0xB0, 0x20, 0xD0, 0x20, 0xD1, 0x70, 0xA0, 0x11, 0xA0, 0x30, 0x50, 0xE1, 0x10, 0x00, 0x90,
+0xF0, 0x02, 0x50, 0x09, 0x50, 0xF0, 0x09, 0x90, 0x01, 0x11, 0x60, 0xC0, 0xE0, 0xD3, 0xB0, 0x40,
+0xD2, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xB0, 0xD4, 0x20, 0xD2, 0x20, 0xD2, 0xB0, 0x41, 0xD2, 0x25,
+0xD0, 0xB0, 0x10, 0xE0, 0x60, 0xC0, 0x31, 0x80, 0x30, 0x60, 0x50, 0x00, 0x90, 0xC0, 0xA0, 0xE0,
+0xA0, 0x10, 0x50, 0x04, 0x50, 0x80, 0x10, 0x40, 0xD1, 0x40, 0x80, 0x0F, 0x00, 0x90, 0xF0, 0x00,
+0x60, 0x40, 0xD6, 0x40, 0x10, 0x01, 0x50, 0xC0, 0x90, 0x0F, 0x1F, 0x0F, 0x22, 0xA0, 0xF1, 0xA0,
+0x90, 0x60, 0xD2, 0x24, 0xD2, 0x20, 0xD0, 0x41, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0x27, 0xD0, 0x20,
+0xD2, 0x40, 0xD2, 0xE0, 0x60, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD0, 0xB0, 0x40,
+0xD2, 0x20, 0xD0, 0x22, 0xD2, 0x20, 0x40, 0xB0, 0xD0, 0xB0, 0x40, 0xD1, 0x20, 0xD4, 0xB0, 0x30,
+0x02, 0x80, 0xC0, 0xE0, 0xD3, 0x20, 0xD5, 0x40, 0xD1, 0x23, 0xD1, 0x22, 0xD0, 0xB0, 0xD2, 0x25,
+0xD0, 0xB1, 0xD0, 0x24, 0xD2, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD1,
+0x21, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD2, 0xB0, 0x11, 0xA0, 0x70, 0x00, 0x50, 0x00, 0x70, 0x10,
+0x30, 0xC0, 0x50, 0x03, 0x50, 0x09, 0x90, 0x09, 0xF0, 0x50, 0x00, 0x60, 0x12, 0xA0, 0x11, 0x40,
+0xE0, 0xD0, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD2, 0x40, 0xD0, 0xE0, 0xD0, 0x40, 0xA0,
+0xB0, 0xD4, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0xC0, 0x10, 0x60, 0xA0, 0x15, 0x30, 0xA0, 0x60, 0x40, 0xD1, 0xA0, 0xF0, 0x02, 0x70, 0x80, 0x70,
+0x00, 0xC0, 0xD1, 0x40, 0xC0, 0x70, 0x0D, 0x70, 0x90, 0x03, 0xE0, 0xC0, 0x10, 0x40, 0xD4, 0xE0,
+0x60, 0x30, 0x80, 0x00, 0x30, 0x50, 0x0F, 0x1E, 0x0F, 0x21, 0x30, 0x50, 0x02, 0xC0, 0xB0, 0xD2,
+0x21, 0xD0, 0x24, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD2, 0x2C, 0xD0, 0x20, 0xD3, 0x40, 0xD0, 0xE1,
+0xD0, 0x20, 0xD1, 0x20, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x20, 0xD4, 0xB0, 0x40, 0x20,
+0xD2, 0xB1, 0xD1, 0x22, 0xD0, 0xB0, 0x60, 0x50, 0x01, 0xA0, 0x10, 0xA0, 0xB0, 0xD4, 0x21, 0xD3,
+0xB1, 0xD0, 0x23, 0xD1, 0x22, 0xD0, 0x40, 0xD1, 0x26, 0xD1, 0xB0, 0xD0, 0x24, 0xD1, 0x20, 0xD0,
+0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x40, 0x20,
+0xD1, 0xB0, 0xC0, 0x30, 0x00, 0x50, 0x01, 0x80, 0x70, 0xC0, 0x90, 0x60, 0x04, 0xF0, 0x70, 0x08,
+0xF0, 0x70, 0x09, 0x50, 0xF0, 0x01, 0x30, 0x11, 0xC0, 0x60, 0xA0, 0xC0, 0x10, 0x60, 0xE0, 0xB0,
+0xD1, 0x23, 0xD1, 0x21, 0xD0, 0x40, 0xD0, 0xE0, 0x10, 0x60, 0x10, 0x80, 0x10, 0x40, 0xD0, 0x21,
+0xD2, 0x40, 0xD3, 0xB0, 0x40, 0xD1, 0x20, 0xD5, 0xE0, 0xA0, 0xE0, 0x50, 0x10, 0xC0, 0x60, 0x11,
+0x40, 0xC0, 0x40, 0xC0, 0x40, 0xD0, 0x10, 0x70, 0xF0, 0x01, 0x50, 0xC0, 0x70, 0x00, 0x60, 0xB0,
+0xD0, 0xC0, 0x80, 0x70, 0xF0, 0x0B, 0x70, 0x50, 0x05, 0xA0, 0xF0, 0xA0, 0xB0, 0xD0, 0x20, 0xD1,
+0xC0, 0x10, 0x80, 0x02, 0x60, 0xF0, 0x0F, 0x1D, 0x0F, 0x20, 0x50, 0xA0, 0x30, 0xF0, 0x00, 0xE0,
+0x40, 0xD2, 0x21, 0xD0, 0x22, 0xD0, 0x24, 0xD1, 0x40, 0xD2, 0x22, 0xD0, 0x25, 0xD2, 0x21, 0xD0,
+0x20, 0xD1, 0x40, 0xB1, 0xD1, 0x22, 0xD1, 0x24, 0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x22, 0xD2, 0xB1,
+0xD5, 0x40, 0xD1, 0x22, 0xD0, 0x60, 0x50, 0x02, 0x60, 0x50, 0x60, 0xE0, 0xD4, 0x21, 0xD1, 0x20,
+0xD1, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD1, 0xB1, 0xD1, 0x25, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x22,
+0xD0, 0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1,
+0xC0, 0x10, 0xC0, 0x70, 0x01, 0xA1, 0x11, 0x60, 0x10, 0x04, 0x71, 0x08, 0x71, 0x09, 0x90, 0x01,
+0x70, 0x10, 0xC0, 0x10, 0x60, 0x30, 0x02, 0x50, 0x11, 0xD2, 0x21, 0xD2, 0x20, 0xD0, 0xB1, 0xD0,
+0xC0, 0x50, 0x02, 0x90, 0x10, 0xD1, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40,
+0x20, 0xD4, 0x20, 0xD0, 0x41, 0x60, 0xD0, 0xE0, 0xB0, 0x40, 0xC0, 0xE0, 0x60, 0xA0, 0xC0, 0xB0,
+0xD1, 0x60, 0x10, 0x60, 0x30, 0x71, 0x60, 0xA0, 0x50, 0xE0, 0xD1, 0x40, 0x60, 0xA0, 0xC0, 0xF0,
+0x09, 0x51, 0x06, 0xA0, 0x00, 0x70, 0xE0, 0xD1, 0x20, 0xD0, 0x40, 0x50, 0x10, 0x70, 0x00, 0x90,
+0xA0, 0x30, 0x0F, 0x1D, 0x0F, 0x20, 0x60, 0x00, 0xF0, 0xA0, 0x80, 0xA0, 0xD0, 0x22, 0xD2, 0x28,
+0xD2, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x23, 0xD2, 0x40, 0xD1,
+0x20, 0xD0, 0x20, 0xD2, 0x26, 0xD2, 0x40, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD1,
+0xB0, 0x40, 0xD0, 0x22, 0xD0, 0x60, 0xF0, 0x04, 0x50, 0x60, 0xD4, 0x22, 0xD0, 0x20, 0xD1, 0xB1,
+0xD0, 0x21, 0xD0, 0x21, 0xD3, 0x20, 0x40, 0xD3, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x20, 0xD1, 0x20,
+0xD1, 0x21, 0xD1, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0,
+0xD0, 0x40, 0x11, 0x50, 0x80, 0x90, 0x01, 0x70, 0x50, 0xC0, 0x30, 0xC0, 0x30, 0x04, 0x50, 0xF0,
+0x08, 0x50, 0x09, 0xF0, 0x70, 0x02, 0x70, 0x80, 0x90, 0x00, 0x70, 0x00, 0x80, 0x30, 0x80, 0xE0,
+0xA0, 0x10, 0xD1, 0x23, 0xD2, 0x40, 0xD1, 0xA0, 0x50, 0x03, 0x90, 0xA0, 0xD0, 0x20, 0xD1, 0x40,
+0xD0, 0x22, 0xD3, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x40, 0x20, 0xD5, 0x70, 0x60, 0x70, 0xA0, 0x50,
+0x60, 0xD2, 0x40, 0xD0, 0xE0, 0x70, 0x61, 0x50, 0x80, 0x60, 0xD1, 0xE0, 0x40, 0xD0, 0xC0, 0x09,
+0x50, 0x70, 0x06, 0xA1, 0x01, 0xA0, 0xD3, 0xE0, 0x60, 0x80, 0x10, 0x30, 0x90, 0x00, 0x90, 0x80,
+0x0F, 0x1C, 0x0F, 0x1F, 0x60, 0x03, 0xC0, 0xD0, 0x23, 0xD2, 0x28, 0xD3, 0x40, 0xB0, 0xD2, 0x24,
+0xD4, 0x24, 0xD2, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x25, 0xD0, 0x20, 0xD2, 0x40, 0xD2,
+0xB0, 0x40, 0xD2, 0x25, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x40, 0xE0, 0x01, 0x50, 0x80, 0x01, 0x30,
+0xB0, 0x40, 0xD0, 0x20, 0xD5, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD0, 0x40,
+0xD6, 0x20, 0xD1, 0xB1, 0xD4, 0x21, 0xD1, 0xB1, 0xD0, 0x22, 0xD4, 0x40, 0xD0, 0x20, 0xD0, 0x21,
+0xD3, 0xB0, 0xD0, 0x10, 0xA0, 0x03, 0x10, 0xF1, 0x70, 0x00, 0xA1, 0x05, 0x90, 0x09, 0x90, 0x09,
+0x90, 0x06, 0x70, 0x90, 0x10, 0xC0, 0x60, 0xE0, 0x80, 0xA0, 0xC0, 0x40, 0xD0, 0x23, 0xD1, 0xB1,
+0xD1, 0xC0, 0x60, 0x03, 0xF0, 0x60, 0xD2, 0x40, 0xD1, 0x23, 0xD3, 0xB0, 0x40, 0xD2, 0x40, 0xB0,
+0xD1, 0x22, 0xD1, 0x40, 0x10, 0x50, 0x70, 0x80, 0x10, 0x60, 0xA0, 0x40, 0xD0, 0xB0, 0x40, 0x61,
+0xB0, 0x60, 0x00, 0xE1, 0xD2, 0xB0, 0xC0, 0x02, 0x50, 0xF0, 0x00, 0xF0, 0x80, 0x70, 0x91, 0xF0,
+0x05, 0x90, 0xA0, 0xF0, 0x01, 0x41, 0xD0, 0x20, 0xD0, 0xC0, 0x70, 0xA0, 0x30, 0xA0, 0x02, 0xA0,
+0x70, 0x0F, 0x1B, 0x0F, 0x1E, 0x90, 0x31, 0xF0, 0x00, 0xA0, 0xB0, 0xD1, 0x22, 0xD1, 0x22, 0xD2,
+0x23, 0xD1, 0x20, 0xD1, 0x40, 0xB0, 0xD5, 0x20, 0xD2, 0x23, 0xD2, 0x22, 0xD0, 0x40, 0xD1, 0x21,
+0xD2, 0x23, 0xD2, 0x20, 0xD2, 0x40, 0xD0, 0xB0, 0x40, 0xD4, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD2,
+0xE0, 0x11, 0x60, 0x10, 0xC0, 0x70, 0x00, 0x60, 0xD0, 0xB1, 0xD5, 0x20, 0xD1, 0x20, 0xD0, 0xB1,
+0xD0, 0x22, 0xD2, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0x40, 0xD4,
+0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xC0,
+0x61, 0x80, 0x10, 0x80, 0xF0, 0x10, 0x80, 0x70, 0xF0, 0x90, 0xC0, 0x30, 0xA1, 0x03, 0x50, 0x08,
+0xF0, 0x50, 0x09, 0x50, 0x06, 0xC0, 0x10, 0x80, 0x70, 0x90, 0xC0, 0x60, 0xF0, 0x90, 0x60, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x40, 0x10, 0xA0, 0x04, 0x60, 0xD1, 0x40, 0x20, 0xD2, 0x21,
+0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB0, 0x40, 0xD0, 0xB1, 0xD2, 0x24, 0xB0, 0xC0, 0xA0, 0xF0, 0xC0,
+0xF0, 0x00, 0x70, 0x80, 0x30, 0xB0, 0xD0, 0xC0, 0xE0, 0xD0, 0xA0, 0xB0, 0xA0, 0xB0, 0xD2, 0x60,
+0x50, 0x01, 0x50, 0x10, 0xC0, 0x80, 0x60, 0xC0, 0x30, 0x11, 0xE0, 0x05, 0xA0, 0xF0, 0x02, 0x50,
+0xE0, 0xD0, 0x20, 0xD0, 0xE0, 0xC0, 0xE0, 0x70, 0x10, 0x50, 0x00, 0x80, 0x30, 0xA0, 0x0F, 0x1B,
+0x0F, 0x1D, 0xF0, 0x30, 0x00, 0xF0, 0x30, 0xA0, 0xE0, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD1,
+0x23, 0xD2, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x21, 0xD2, 0x24, 0xD3, 0x21, 0xD2, 0x40, 0x20, 0xD0,
+0x21, 0xD1, 0x23, 0xD1, 0x22, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD1,
+0x40, 0xD2, 0xA0, 0xE0, 0x40, 0xD0, 0xC0, 0x60, 0xC0, 0xE0, 0xD1, 0x40, 0xD2, 0xE0, 0xA1, 0xD5,
+0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1,
+0x40, 0xD4, 0x22, 0xD1, 0xB0, 0xD1, 0x23, 0xD2, 0x40, 0xD4, 0x20, 0xD2, 0xA0, 0xE0, 0xA0, 0x11,
+0x30, 0xC1, 0x10, 0x71, 0x00, 0x60, 0xA0, 0xB0, 0x80, 0xA0, 0x02, 0xF0, 0x70, 0x08, 0x50, 0xF0,
+0x08, 0x71, 0x07, 0x71, 0xC0, 0x80, 0x10, 0x80, 0x01, 0xC0, 0xD2, 0x20, 0xD1, 0x40, 0xD2, 0xE0,
+0x10, 0x05, 0xA0, 0xD0, 0xB0, 0x40, 0xD2, 0x24, 0xD0, 0x22, 0xD1, 0x41, 0xD2, 0x21, 0xD0, 0x21,
+0xD1, 0xA0, 0x30, 0x61, 0x02, 0x70, 0x50, 0xA0, 0xB0, 0xD3, 0x61, 0xD3, 0x60, 0x01, 0xF0, 0x10,
+0x80, 0x42, 0xB0, 0xD0, 0xB0, 0xE0, 0xA0, 0x50, 0x04, 0x30, 0xF0, 0x02, 0x70, 0x30, 0xD3, 0xE0,
+0xD1, 0xB0, 0x10, 0xA0, 0x90, 0x00, 0x50, 0x80, 0x0F, 0x1A, 0x0F, 0x14, 0x70, 0x90, 0x06, 0x60,
+0xF0, 0x01, 0xF0, 0x60, 0x40, 0xD3, 0x23, 0xD2, 0x21, 0xD3, 0x24, 0xD2, 0xB0, 0x40, 0xD4, 0x23,
+0xD3, 0x23, 0xD3, 0x40, 0xD1, 0x22, 0xD1, 0x21, 0xD1, 0x22, 0xD1, 0x41, 0xB0, 0xD2, 0x22, 0xD0,
+0x23, 0xD0, 0x20, 0xD0, 0xB1, 0xD6, 0xB0, 0x40, 0xD3, 0x40, 0xD1, 0x60, 0xF0, 0x80, 0xE0, 0x70,
+0xE0, 0x61, 0xE0, 0x50, 0xB0, 0xD2, 0x25, 0xD0, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x21,
+0xD0, 0xB0, 0x20, 0xD3, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x40, 0xD1, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x60, 0x51, 0x10, 0xC1, 0x10, 0x60, 0xF0, 0x00, 0x50, 0x90, 0x61, 0xD0, 0x70,
+0xA0, 0x70, 0x01, 0x71, 0x08, 0x50, 0x09, 0x90, 0x0A, 0x90, 0x11, 0x30, 0x01, 0xA0, 0x40, 0xD0,
+0x20, 0xD2, 0x40, 0xD2, 0x80, 0x10, 0x05, 0xA0, 0x50, 0x40, 0xD2, 0x20, 0xD1, 0x26, 0xD1, 0x41,
+0xB0, 0xD1, 0x20, 0xD3, 0x20, 0xD0, 0xB0, 0xC1, 0x90, 0x50, 0x80, 0x71, 0x00, 0xA0, 0x40, 0xD3,
+0xB0, 0x10, 0xE0, 0xD2, 0x60, 0x01, 0xA0, 0x60, 0x40, 0xD0, 0xB0, 0x40, 0xD3, 0xE0, 0x60, 0x80,
+0x02, 0x70, 0xA0, 0x04, 0xC0, 0xD6, 0xB0, 0xA0, 0x60, 0x02, 0x30, 0x70, 0x0F, 0x19, 0x0F, 0x14,
+0x30, 0x50, 0x80, 0x04, 0x80, 0x30, 0xA0, 0x70, 0x00, 0x60, 0xB0, 0xD0, 0x40, 0xB0, 0xD1, 0x23,
+0xD2, 0x21, 0xD3, 0x23, 0xD0, 0x20, 0xD3, 0x40, 0x20, 0xD1, 0x24, 0xD3, 0x22, 0xD0, 0xB0, 0xE0,
+0xD2, 0x40, 0xD1, 0x25, 0xD5, 0x40, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x23, 0xD0, 0x20,
+0xD0, 0x40, 0xC0, 0xE0, 0xD0, 0x23, 0xD5, 0x40, 0x20, 0xB0, 0x30, 0x01, 0x90, 0xA1, 0x31, 0x60,
+0xA0, 0xE0, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x20, 0xB0, 0xD1, 0x22, 0xD1, 0x20, 0xD0, 0x20,
+0xB0, 0xD3, 0x22, 0xD1, 0x40, 0x25, 0xD2, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0xB0, 0xE1, 0x60,
+0xF0, 0x00, 0x80, 0x10, 0x60, 0x80, 0x10, 0x01, 0x50, 0x30, 0x10, 0xD1, 0xE0, 0x30, 0x02, 0x70,
+0xF0, 0x08, 0x50, 0x08, 0xF0, 0x50, 0x09, 0x71, 0x80, 0xA0, 0x70, 0x01, 0xF0, 0xA0, 0xD0, 0x20,
+0xD1, 0x40, 0xD1, 0xE0, 0xA0, 0x11, 0x30, 0x04, 0xE0, 0xA0, 0xD4, 0x21, 0xD1, 0x22, 0xD2, 0x40,
+0xD1, 0x40, 0xB0, 0xD9, 0x10, 0x01, 0x50, 0x30, 0x01, 0xA0, 0xB0, 0xD2, 0x20, 0xD0, 0xA0, 0xD1,
+0x20, 0xD0, 0x60, 0x10, 0x60, 0xE0, 0x70, 0xD0, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0x40, 0x60, 0xF0,
+0x00, 0x60, 0xF0, 0x02, 0xA0, 0x30, 0x70, 0x60, 0xD3, 0xE0, 0xB1, 0x70, 0xC0, 0x80, 0x00, 0x31,
+0xA0, 0x0F, 0x19, 0x0F, 0x14, 0x30, 0x80, 0x50, 0x03, 0xF0, 0x30, 0x01, 0xE0, 0x60, 0x40, 0xD2,
+0xB0, 0x40, 0xD1, 0x23, 0xD0, 0x23, 0xD3, 0x25, 0xD3, 0x40, 0xB0, 0xD1, 0x21, 0xD3, 0x24, 0xD1,
+0x60, 0xD3, 0x40, 0xD1, 0x26, 0xD2, 0x40, 0x20, 0xD2, 0xB0, 0x22, 0xD3, 0x21, 0xD0, 0x21, 0xD2,
+0xE0, 0x60, 0xD1, 0x21, 0xD0, 0xB0, 0xC0, 0xE0, 0xB0, 0xD2, 0x41, 0x90, 0x07, 0x10, 0xA1, 0x41,
+0xD0, 0x21, 0xD4, 0x40, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xD3, 0x22, 0xD1, 0xB0, 0x20, 0xD0,
+0x24, 0xD1, 0x40, 0x21, 0xD3, 0xB0, 0x10, 0xE0, 0x60, 0xF0, 0x01, 0x90, 0x10, 0xF0, 0x80, 0x60,
+0x70, 0x30, 0x10, 0xE0, 0xD1, 0x10, 0x03, 0x50, 0x08, 0x70, 0x50, 0x08, 0x71, 0x09, 0x90, 0x05,
+0x70, 0xA0, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0xC0, 0x10, 0x80, 0xC1, 0x04, 0x80, 0x40, 0xD0, 0x20,
+0xD0, 0x21, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD3, 0xB1, 0xD0, 0x20, 0xD5, 0x40, 0x30, 0x71,
+0x90, 0x80, 0x70, 0x00, 0x50, 0xE0, 0xD3, 0x20, 0xD5, 0x40, 0xA0, 0xD1, 0x40, 0x20, 0xD1, 0x23,
+0xD2, 0xB0, 0x60, 0xC0, 0x50, 0x03, 0x30, 0x50, 0x00, 0xE1, 0xD1, 0xB0, 0xE0, 0xC0, 0xD2, 0x10,
+0xA0, 0x70, 0x00, 0x70, 0x30, 0x0F, 0x18, 0x0F, 0x15, 0xF0, 0x04, 0x60, 0x02, 0xF0, 0x60, 0xD1,
+0x20, 0xD1, 0xB0, 0x40, 0xD3, 0x21, 0xD0, 0x24, 0xD2, 0x25, 0xD3, 0x40, 0xB0, 0xD5, 0x25, 0xD7,
+0x40, 0xD1, 0x23, 0xD2, 0x20, 0x40, 0xD5, 0x40, 0xD4, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0xA0,
+0xE0, 0xD4, 0x40, 0xE0, 0x50, 0xA1, 0xB0, 0xD0, 0xB0, 0xA0, 0xF0, 0x09, 0x80, 0x90, 0xC0, 0xD2,
+0x20, 0xD3, 0xB1, 0xD0, 0x23, 0xD3, 0x40, 0xD3, 0x22, 0xD1, 0xB1, 0xD0, 0x23, 0xD2, 0xB0, 0xD2,
+0x40, 0xA0, 0xB0, 0xD0, 0x40, 0x50, 0x60, 0x31, 0x01, 0x80, 0x10, 0x01, 0xF0, 0x60, 0x10, 0xA0,
+0xD0, 0x60, 0x70, 0x03, 0x90, 0x08, 0x50, 0x09, 0x90, 0x09, 0x71, 0x05, 0x90, 0xA0, 0xD2, 0x40,
+0xD2, 0xE0, 0x11, 0x60, 0xC0, 0x50, 0x30, 0x00, 0x90, 0x60, 0x40, 0xD0, 0x20, 0xD0, 0x23, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x21, 0xD2, 0xB0, 0x10, 0x60,
+0x80, 0x10, 0x90, 0x30, 0x00, 0x70, 0x60, 0xD6, 0x20, 0xD5, 0x40, 0xD1, 0x23, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0x60, 0xF0, 0x08, 0xA0, 0xB1, 0x40, 0xB0, 0x40, 0xD2, 0x40, 0xC0, 0x02, 0xA0, 0x70,
+0x0F, 0x17, 0x0F, 0x12, 0x50, 0x60, 0xA0, 0x70, 0x03, 0x90, 0x30, 0x60, 0x70, 0x00, 0x60, 0xD3,
+0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x24, 0xD3, 0x24, 0xD4, 0xB0, 0x40, 0xD1, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xE0, 0x40, 0xD2, 0x20, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x20,
+0x40, 0xD2, 0x22, 0xD0, 0x20, 0x40, 0xD2, 0x40, 0xC0, 0xD3, 0x21, 0xD0, 0xB0, 0x10, 0x60, 0xD1,
+0x20, 0xD1, 0x11, 0x00, 0xF0, 0x50, 0xE0, 0x40, 0xE0, 0x80, 0x0A, 0x70, 0x80, 0x10, 0x40, 0xD0,
+0x20, 0xD4, 0xB0, 0x40, 0xD1, 0x23, 0xD2, 0xB0, 0x20, 0xD1, 0x24, 0xD0, 0xB1, 0xD0, 0x23, 0xD2,
+0x40, 0xA0, 0xD1, 0x60, 0x30, 0xC0, 0xB0, 0xD0, 0x70, 0x40, 0x11, 0x50, 0x70, 0xA0, 0x11, 0x60,
+0x00, 0x30, 0x90, 0xC0, 0xE0, 0x80, 0x02, 0xF0, 0x00, 0x50, 0x08, 0x90, 0x08, 0xF0, 0x50, 0x09,
+0x90, 0x06, 0x80, 0x40, 0xD1, 0xB1, 0xD0, 0x20, 0xD1, 0xC0, 0x10, 0xB0, 0x10, 0xC0, 0x10, 0xE0,
+0x60, 0xE0, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0xB0,
+0x40, 0xD0, 0x23, 0xD1, 0xB0, 0x40, 0x60, 0xB0, 0xC0, 0xA0, 0x01, 0xA0, 0xD2, 0x20, 0xD1, 0x21,
+0xD0, 0x20, 0xD1, 0xB0, 0x40, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x60, 0x09,
+0x70, 0xA0, 0xD7, 0xC0, 0x90, 0x00, 0x30, 0x80, 0xA0, 0x0F, 0x17, 0x0F, 0x11, 0x70, 0x60, 0x00,
+0x50, 0xC0, 0xA0, 0x01, 0xF0, 0x30, 0x01, 0x30, 0x60, 0x40, 0xD2, 0x22, 0xD2, 0xB0, 0x40, 0xD2,
+0x24, 0xD4, 0x26, 0xD3, 0x20, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xC0, 0xB0, 0x60,
+0xD2, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0xB0, 0x40,
+0xD1, 0x40, 0xE0, 0xD2, 0x23, 0xD0, 0xB0, 0xE0, 0x40, 0xD0, 0x20, 0xD0, 0xA0, 0x80, 0xC0, 0x01,
+0xF0, 0x60, 0xE1, 0x60, 0x70, 0x0A, 0x50, 0xE1, 0xD0, 0x21, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x20,
+0xD0, 0x22, 0xD2, 0x20, 0xB0, 0xD2, 0x22, 0xD1, 0x20, 0x40, 0xD5, 0xB0, 0xE0, 0xC0, 0xA0, 0xE0,
+0xD0, 0x40, 0x10, 0x50, 0x60, 0xE0, 0xA0, 0x90, 0xC0, 0xF0, 0x00, 0x11, 0x90, 0x30, 0x50, 0x00,
+0x70, 0x50, 0x10, 0xB0, 0xA0, 0x60, 0x30, 0x80, 0x10, 0x80, 0x70, 0x07, 0xF0, 0x50, 0x08, 0x50,
+0xF0, 0x08, 0x70, 0x50, 0x06, 0x10, 0xB0, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0xB1, 0x40, 0xC0, 0x70,
+0xD0, 0x10, 0x40, 0xB0, 0xD0, 0x20, 0xD1, 0x24, 0xD0, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x23, 0xD2,
+0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x40, 0xB0, 0xD2, 0xB0, 0x10, 0x90, 0x50, 0x60, 0xD1, 0x23, 0xD0,
+0x21, 0xD1, 0xB1, 0xD3, 0x21, 0xD6, 0xE0, 0x90, 0x08, 0x52, 0x60, 0xE0, 0x60, 0xB0, 0xD1, 0x20,
+0xD1, 0x10, 0xA0, 0x70, 0x00, 0x50, 0x80, 0x0F, 0x16, 0x0F, 0x11, 0x50, 0x30, 0x02, 0x80, 0x60,
+0x00, 0x60, 0x70, 0x01, 0x70, 0xA0, 0xD2, 0x22, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD1, 0x23, 0xD3,
+0x20, 0xD1, 0x26, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0xE0, 0xD0, 0xB0,
+0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0xB1,
+0xD6, 0x22, 0xD2, 0xB0, 0x40, 0xD1, 0xA0, 0x00, 0xF0, 0x01, 0xF0, 0x60, 0xF0, 0x10, 0xC0, 0x90,
+0x0A, 0x70, 0x10, 0xC0, 0xB0, 0xD0, 0x22, 0xD2, 0xB1, 0xD1, 0x22, 0xD3, 0x40, 0xD1, 0x25, 0xD0,
+0x40, 0xD1, 0xB0, 0x41, 0xB0, 0xC0, 0x61, 0xA0, 0xB0, 0xD0, 0xE0, 0x10, 0x50, 0x90, 0x10, 0x90,
+0x30, 0xE0, 0x10, 0x30, 0x10, 0x60, 0xC0, 0x80, 0x01, 0x50, 0xC0, 0xE0, 0xD1, 0x60, 0xC0, 0x11,
+0x30, 0xF0, 0x01, 0xF1, 0x03, 0x71, 0x08, 0x90, 0x09, 0x90, 0x05, 0xF1, 0x10, 0xB0, 0xD0, 0x40,
+0xD1, 0x22, 0xD3, 0xB0, 0xD1, 0x41, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x26,
+0xD1, 0xB0, 0x40, 0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0xE0, 0x11, 0xA0, 0xD2, 0x21, 0xD0, 0x20,
+0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD2, 0x21, 0xD1, 0x60, 0xF0, 0x06, 0xF0, 0x90, 0xF0,
+0x01, 0xF0, 0x50, 0x90, 0xE0, 0xD0, 0x20, 0xD2, 0xE0, 0x60, 0x02, 0x60, 0x70, 0x03, 0x90, 0xA0,
+0x80, 0x0F, 0x0E, 0x0F, 0x12, 0xA0, 0xE0, 0x02, 0xA0, 0x90, 0x31, 0x50, 0x00, 0x60, 0xB0, 0xD0,
+0x23, 0xD0, 0x24, 0xD1, 0xB0, 0x40, 0xD0, 0x21, 0xD4, 0x20, 0xD2, 0x25, 0xD0, 0x20, 0xD3, 0x40,
+0xB0, 0xD0, 0x21, 0xD0, 0x20, 0xD5, 0x20, 0xD0, 0x20, 0xD4, 0x40, 0xD0, 0xB1, 0xD3, 0x22, 0xD1,
+0x21, 0xD1, 0xB1, 0xD3, 0x23, 0xD0, 0x22, 0xD0, 0xB1, 0xD0, 0xE1, 0x03, 0xE0, 0xC0, 0x10, 0x90,
+0x00, 0x50, 0x0A, 0x80, 0x10, 0xB0, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD2, 0x21, 0xD1,
+0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0x40, 0xD0, 0xE0, 0xA0, 0x90, 0x10, 0xA0, 0xE0,
+0x80, 0x41, 0xD0, 0xB0, 0xD0, 0x40, 0xC0, 0xE0, 0xA1, 0xE0, 0x50, 0xE0, 0xA0, 0x80, 0xC0, 0x10,
+0x30, 0xA0, 0xF0, 0x70, 0x60, 0xD2, 0xE0, 0xC0, 0x60, 0x70, 0x50, 0x00, 0x70, 0x60, 0xA0, 0x61,
+0xA0, 0x01, 0x50, 0x08, 0x71, 0x09, 0x50, 0x04, 0xF0, 0xC0, 0x10, 0xE0, 0xD0, 0xB0, 0x40, 0xD0,
+0x21, 0xD0, 0x21, 0xD5, 0x40, 0xD1, 0x20, 0xD5, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x24, 0xD3,
+0xB0, 0x40, 0xD0, 0x40, 0xB0, 0xD1, 0x21, 0xD1, 0xB0, 0x41, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x40,
+0xB0, 0xD4, 0x21, 0xD1, 0x21, 0xD2, 0x40, 0xE0, 0x06, 0x70, 0x50, 0x06, 0xA0, 0xD1, 0x21, 0xD0,
+0x40, 0x10, 0x50, 0x00, 0x32, 0x01, 0x50, 0x10, 0x60, 0x70, 0x80, 0x30, 0x0F, 0x0D, 0x0F, 0x10,
+0x30, 0x60, 0x80, 0x30, 0xC0, 0x90, 0x50, 0x60, 0xA0, 0x01, 0x80, 0xC0, 0x40, 0xD1, 0x21, 0xD2,
+0x22, 0xD4, 0x20, 0x40, 0xB0, 0xD2, 0x20, 0xD3, 0x28, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0,
+0xD3, 0x20, 0xDD, 0x41, 0xD1, 0x22, 0xD1, 0x20, 0xD2, 0x21, 0xD1, 0x40, 0xD4, 0x20, 0xD0, 0x21,
+0xD0, 0x21, 0xD1, 0x40, 0xD1, 0xE0, 0x80, 0x03, 0x30, 0xC1, 0x00, 0x50, 0xF0, 0x09, 0x70, 0xC0,
+0x40, 0xD0, 0x24, 0xD1, 0x40, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0xB1, 0xD1, 0x23, 0xD1, 0x80, 0x60,
+0x50, 0x70, 0x50, 0x30, 0xB0, 0xD0, 0xE0, 0xA0, 0x40, 0xD0, 0x60, 0xA0, 0xB0, 0x60, 0xE0, 0xB0,
+0xC0, 0xA0, 0x60, 0xD0, 0xE0, 0x90, 0x30, 0x60, 0x10, 0xC1, 0x30, 0xA0, 0x70, 0xD2, 0xE0, 0x60,
+0x10, 0x70, 0xA0, 0x10, 0x40, 0xD2, 0xE0, 0xC0, 0x80, 0x50, 0x08, 0x50, 0x09, 0x50, 0x07, 0x30,
+0x80, 0xD0, 0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD2, 0x20, 0xD1, 0x22,
+0xD1, 0x40, 0xD1, 0x27, 0xD5, 0x40, 0xB0, 0xD2, 0x22, 0xD3, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1,
+0x40, 0xD3, 0x21, 0xD4, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0x80, 0x90, 0x04, 0x90, 0x50, 0x70, 0x06,
+0x90, 0x60, 0xD3, 0xB0, 0xA0, 0xC0, 0xA0, 0xF0, 0x00, 0x90, 0x50, 0x70, 0x10, 0x50, 0x30, 0x90,
+0x00, 0x60, 0x0F, 0x0D, 0x0F, 0x0F, 0x30, 0x90, 0xF0, 0x30, 0x10, 0x90, 0x80, 0x31, 0x50, 0x02,
+0x60, 0xD2, 0x21, 0xD2, 0x23, 0xD1, 0x21, 0xD1, 0x41, 0xD3, 0x20, 0xD0, 0x23, 0xD2, 0x23, 0xD1,
+0x20, 0xD2, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xA0, 0xD3, 0x20, 0xD1, 0xB0, 0x41, 0xD1,
+0x24, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0x40, 0xD2, 0x22, 0xD5, 0x40, 0xD0, 0x40, 0xD0, 0xB0, 0x10,
+0x50, 0x04, 0x80, 0x01, 0x90, 0x09, 0xF0, 0x50, 0xA0, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0xB1,
+0xD1, 0x23, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0xB0, 0xC0, 0x90, 0xA0, 0x10, 0xC0, 0xA0,
+0x10, 0xE0, 0xD1, 0x40, 0xD0, 0xE0, 0xC0, 0x70, 0xD2, 0x50, 0xE0, 0xA0, 0xD0, 0x10, 0xE0, 0x10,
+0x50, 0x90, 0x00, 0x90, 0x80, 0x10, 0x60, 0xD0, 0x20, 0xD2, 0xA0, 0x30, 0xC0, 0xB0, 0xD5, 0xE0,
+0xC0, 0x70, 0x07, 0x90, 0x08, 0xF0, 0x50, 0x07, 0x70, 0xA0, 0xB1, 0xD2, 0x24, 0xD2, 0xB0, 0x40,
+0xD0, 0x21, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD0, 0x23, 0xD3, 0x22, 0xD2, 0xB0, 0x41,
+0xD2, 0x22, 0xD1, 0x24, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD4, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1,
+0x21, 0xD1, 0x60, 0xF0, 0x03, 0xF0, 0x90, 0x01, 0x60, 0x30, 0x06, 0x90, 0xC0, 0xD3, 0xA0, 0x50,
+0x30, 0x02, 0x60, 0xA0, 0x70, 0x01, 0x60, 0x50, 0x80, 0x0F, 0x0D, 0x0F, 0x0F, 0xA0, 0xF0, 0x01,
+0xF0, 0xC0, 0x70, 0xF0, 0x31, 0x90, 0x00, 0xA0, 0xB0, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x22, 0xD0,
+0x20, 0xD3, 0x20, 0xD0, 0xB0, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD4, 0x25, 0xD4, 0xB0, 0x40,
+0xD3, 0x20, 0xD1, 0x40, 0x10, 0xB0, 0xD0, 0x22, 0xD0, 0xB1, 0xD0, 0xB0, 0x40, 0x21, 0xD0, 0x20,
+0xD1, 0x23, 0xD0, 0x21, 0xD2, 0x40, 0xD5, 0xE0, 0xA1, 0xC1, 0x60, 0xA0, 0xB1, 0xD0, 0x90, 0xC0,
+0xA0, 0x06, 0x71, 0x09, 0x50, 0xF0, 0x60, 0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x23, 0xD2, 0x40, 0xD2,
+0x22, 0xD1, 0xB0, 0x60, 0x10, 0xC3, 0x50, 0xD0, 0xA0, 0xE0, 0xD1, 0xB0, 0xD0, 0xB0, 0xD1, 0xA0,
+0x30, 0x80, 0x70, 0xB0, 0x60, 0x80, 0x01, 0x80, 0xA0, 0x70, 0x50, 0x60, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0x40, 0xD4, 0x20, 0xD1, 0xB0, 0x30, 0x10, 0x90, 0x05, 0x71, 0x08, 0x50, 0xF0, 0x08, 0x30,
+0xE0, 0xD4, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD2, 0x24, 0xD2, 0xB1, 0xD1, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD3, 0x20, 0xD0, 0x40, 0xB0, 0xD0, 0xB0, 0x40, 0xD0, 0x22, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0x20,
+0xD1, 0xE0, 0x90, 0x03, 0x51, 0x0C, 0x60, 0xD3, 0x40, 0x80, 0x60, 0xF1, 0x30, 0x80, 0xC0, 0x80,
+0xF0, 0x31, 0x01, 0xF0, 0x0F, 0x0C, 0x0F, 0x0F, 0x50, 0x10, 0x70, 0x01, 0x70, 0xA0, 0x30, 0xF0,
+0x00, 0x90, 0x60, 0xE0, 0xD0, 0x22, 0xD1, 0x25, 0xD4, 0x22, 0xD1, 0x40, 0xB0, 0xD2, 0x21, 0xD6,
+0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x20, 0x40, 0xD2, 0x20, 0xD2, 0x60, 0xC0, 0xD1, 0x20, 0xD0,
+0xB0, 0x40, 0xD3, 0x40, 0x20, 0xD0, 0x22, 0xD2, 0x21, 0xD4, 0xB0, 0x42, 0xD1, 0xB0, 0x10, 0x50,
+0x00, 0x70, 0x50, 0x90, 0xC0, 0xE0, 0xA0, 0xD0, 0x90, 0xC0, 0x90, 0x07, 0x90, 0x09, 0xF0, 0x70,
+0xA0, 0xB0, 0xD1, 0x22, 0xD1, 0x40, 0xD2, 0x23, 0xD1, 0xB0, 0x20, 0xD7, 0x40, 0x10, 0xC0, 0x10,
+0x30, 0x90, 0xA0, 0x40, 0xE1, 0x70, 0x40, 0x10, 0x40, 0xC1, 0xA0, 0x10, 0x90, 0xE0, 0xC1, 0x11,
+0xC0, 0xA0, 0x10, 0x62, 0xE0, 0xD0, 0x22, 0xD0, 0x20, 0xB0, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x40,
+0xD0, 0x40, 0xC0, 0x30, 0x04, 0x90, 0x08, 0xF0, 0x50, 0x09, 0x70, 0xA0, 0xD4, 0x24, 0xD0, 0x40,
+0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x21, 0xD2, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x22, 0xD2, 0x20,
+0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD0, 0x20, 0xD1, 0x22, 0xD5, 0x40, 0xB0, 0xD2, 0x25,
+0xD0, 0x22, 0xD4, 0x60, 0x02, 0xF0, 0x90, 0x70, 0x0D, 0x60, 0xD3, 0xE0, 0x80, 0x00, 0x10, 0x30,
+0xF0, 0x00, 0x30, 0xA0, 0x60, 0x80, 0xF0, 0x30, 0xC0, 0x60, 0x30, 0x0F, 0x0B, 0x0F, 0x10, 0x70,
+0x10, 0xA0, 0x50, 0x30, 0xA1, 0x02, 0xA0, 0xD2, 0x23, 0xD2, 0x24, 0xD1, 0x23, 0xD2, 0xB0, 0x40,
+0xD3, 0x22, 0xD0, 0x21, 0xD6, 0x21, 0xD3, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0xE0, 0x10, 0x60, 0xD1,
+0xB0, 0x40, 0xD3, 0x21, 0x40, 0xD1, 0x21, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD3, 0xB0, 0xA1, 0xE0,
+0x70, 0xA0, 0x10, 0x60, 0x01, 0xF0, 0x70, 0xF0, 0x50, 0xC0, 0xE0, 0xA0, 0x09, 0x70, 0x50, 0x09,
+0x90, 0xF0, 0x60, 0xD4, 0x20, 0xD0, 0x20, 0xB0, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0xB1, 0xD7, 0xB0,
+0xE0, 0x60, 0xC0, 0xF0, 0x00, 0xA0, 0x80, 0xA0, 0x60, 0xA0, 0x40, 0x12, 0x60, 0xA0, 0x40, 0xA0,
+0x10, 0x90, 0x11, 0xE2, 0x70, 0x50, 0x30, 0xE0, 0x60, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD0, 0x21,
+0xD4, 0x40, 0xD2, 0xC0, 0x10, 0xF0, 0x02, 0x50, 0x08, 0x50, 0xF0, 0x09, 0x50, 0xC0, 0x40, 0xD0,
+0x21, 0xD0, 0x21, 0xD2, 0xB1, 0xD1, 0x22, 0xD0, 0x21, 0xD4, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x21, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x22, 0xD1, 0x21, 0xD0, 0x25, 0xD1, 0xA0, 0x01, 0x50,
+0x90, 0x0F, 0x00, 0x81, 0xD2, 0x40, 0x80, 0x00, 0xA0, 0x90, 0x01, 0x50, 0xA0, 0x00, 0xF0, 0x10,
+0x80, 0x01, 0xA0, 0x70, 0x0F, 0x0A, 0x0F, 0x0D, 0xA0, 0xC0, 0x10, 0x01, 0x50, 0x30, 0x90, 0xC0,
+0x11, 0x50, 0x80, 0x40, 0xD1, 0x2F, 0x03, 0xD4, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x21, 0xD4, 0x24,
+0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x40, 0xD1, 0x20, 0xD4, 0x40, 0xD4, 0xE0,
+0xB0, 0x20, 0xD1, 0x21, 0xD2, 0xE0, 0x50, 0x61, 0x10, 0x71, 0x80, 0x04, 0xF0, 0x90, 0x70, 0x0A,
+0x90, 0x09, 0x71, 0x90, 0xA0, 0xD2, 0x22, 0xD0, 0x40, 0xD1, 0x21, 0xD3, 0x20, 0xB0, 0xD2, 0x60,
+0xA1, 0xE0, 0xD0, 0x40, 0xB0, 0xC0, 0x30, 0x10, 0x91, 0x60, 0xA0, 0x90, 0x81, 0xC0, 0x10, 0x60,
+0x30, 0x80, 0x50, 0x41, 0xA0, 0xC1, 0x50, 0x70, 0xB0, 0x60, 0x30, 0x80, 0x10, 0x40, 0xD4, 0x40,
+0xD1, 0x21, 0xD3, 0xB1, 0x20, 0xD1, 0xB0, 0x11, 0x60, 0x80, 0x51, 0x08, 0x90, 0x09, 0x90, 0x00,
+0xE1, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x23, 0xD1, 0x21, 0xD1, 0x40, 0xD2,
+0x22, 0xD1, 0x21, 0xD4, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0xB1, 0xD2, 0x21, 0xD2, 0x20, 0x40, 0xD3,
+0x20, 0xD0, 0x24, 0xD1, 0x22, 0xD0, 0x21, 0xD0, 0xE0, 0x50, 0x00, 0x90, 0x70, 0x00, 0xF0, 0x0F,
+0x00, 0xA0, 0xB0, 0xD1, 0x40, 0x90, 0x01, 0xC0, 0x70, 0xA0, 0x11, 0x90, 0xC0, 0x03, 0xC0, 0xF0,
+0x0F, 0x0A, 0x0F, 0x0C, 0x50, 0x30, 0x00, 0x30, 0xC1, 0x80, 0x00, 0x80, 0x70, 0x50, 0xC0, 0x10,
+0x60, 0xD3, 0x27, 0xD2, 0x28, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x21,
+0xD1, 0x24, 0xD2, 0x20, 0xD0, 0xB1, 0xD4, 0x40, 0xC0, 0x40, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x40,
+0xB0, 0xD1, 0x40, 0xD2, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0xE1, 0x90, 0x11, 0x80, 0x07, 0x50, 0x70,
+0x0A, 0x90, 0x09, 0x90, 0x00, 0x50, 0xA0, 0xD1, 0x22, 0xD0, 0xB1, 0xD0, 0x24, 0xD1, 0x40, 0xD2,
+0x60, 0x01, 0x30, 0xE0, 0x40, 0xD1, 0xA0, 0xC1, 0x30, 0xF0, 0x71, 0x31, 0x80, 0x10, 0x60, 0xA0,
+0x30, 0x60, 0xA0, 0x80, 0x30, 0x50, 0x80, 0x10, 0xC0, 0x10, 0x70, 0x50, 0x00, 0x70, 0xC0, 0xD4,
+0x40, 0xD0, 0x24, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0xB0, 0x10, 0xA0, 0x10, 0xA0, 0x10, 0x50, 0x06,
+0x50, 0xF0, 0x08, 0xF0, 0x50, 0x00, 0x60, 0xE0, 0xD2, 0x21, 0xD2, 0x40, 0xD2, 0x21, 0xD0, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0x20, 0xD1, 0x21, 0xD0, 0x23, 0xD2, 0x20, 0xD0, 0xB1, 0xD2,
+0x20, 0xD4, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x26, 0xD1, 0x20,
+0xD3, 0xE0, 0xA0, 0x70, 0x50, 0xF0, 0x01, 0x50, 0x10, 0x0A, 0x71, 0x01, 0x90, 0xE0, 0xD2, 0x60,
+0x01, 0x50, 0x11, 0x80, 0x00, 0x60, 0xA0, 0x01, 0x50, 0xC0, 0x90, 0x70, 0x90, 0x0F, 0x09, 0x0F,
+0x0C, 0x70, 0x60, 0x00, 0x30, 0x70, 0x00, 0x60, 0x70, 0xA0, 0x02, 0xC0, 0x41, 0x20, 0xD1, 0x20,
+0xD0, 0x23, 0xD4, 0x24, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0x40, 0xB0, 0xD3, 0x24, 0xD0, 0x21,
+0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD4, 0xE0, 0x10, 0xD3, 0x23, 0xD2, 0x40,
+0xD1, 0xB0, 0x20, 0xD0, 0x27, 0xD1, 0x80, 0xA0, 0x10, 0x80, 0x09, 0x90, 0x0A, 0x50, 0xF0, 0x08,
+0x71, 0x00, 0x80, 0x40, 0xD2, 0x20, 0xD1, 0x40, 0xD0, 0x25, 0xD0, 0xB1, 0xD0, 0xA0, 0x90, 0x01,
+0x70, 0x10, 0xE0, 0x40, 0xD0, 0xA0, 0x80, 0x90, 0x80, 0xE0, 0x30, 0xE1, 0x60, 0x40, 0xD0, 0xA0,
+0x90, 0xC0, 0x60, 0x90, 0xE0, 0xC0, 0xF5, 0x80, 0x50, 0x90, 0xA0, 0x40, 0xB1, 0xD0, 0xB0, 0x40,
+0xD1, 0x20, 0xD4, 0x40, 0xD5, 0xA0, 0xE0, 0x30, 0x60, 0x11, 0xC0, 0x70, 0x04, 0x90, 0x09, 0x50,
+0x70, 0x80, 0x60, 0xE0, 0xD0, 0x20, 0xD4, 0xB1, 0xD2, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xB0, 0xD1,
+0x22, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x23, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x20,
+0xD0, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x27, 0xD4, 0xA0, 0xE0, 0x70, 0x02, 0x90, 0x60,
+0xC0, 0x05, 0xF0, 0x03, 0x71, 0x01, 0xE0, 0x40, 0xD2, 0xE0, 0x50, 0x70, 0x50, 0x60, 0x50, 0x01,
+0x70, 0x10, 0x30, 0x61, 0x70, 0x00, 0x30, 0x50, 0x80, 0x0F, 0x08, 0x0F, 0x0D, 0x50, 0x03, 0x30,
+0x60, 0xA0, 0x80, 0x00, 0xF0, 0xA0, 0xD0, 0x20, 0x41, 0xD2, 0x21, 0xD3, 0x26, 0xD3, 0x23, 0xD3,
+0x41, 0xD2, 0x24, 0xD0, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x40, 0xD2, 0x41, 0xC0, 0xD2, 0x23,
+0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x26, 0xD4, 0x60, 0x80, 0x70, 0x0A, 0xF0, 0x50, 0x0A, 0x90, 0x09,
+0x90, 0x00, 0x70, 0x60, 0xD1, 0x21, 0xD1, 0x40, 0x25, 0xD2, 0xB0, 0xC0, 0x50, 0x01, 0xF0, 0x70,
+0x51, 0xE0, 0xB1, 0x40, 0xE0, 0xB0, 0xD6, 0x40, 0xE0, 0x40, 0x60, 0x80, 0x90, 0xA0, 0x60, 0xF0,
+0x30, 0x00, 0x90, 0xE0, 0x10, 0xC0, 0xA0, 0x40, 0xD0, 0x20, 0xB1, 0x43, 0xB0, 0xD4, 0x40, 0xD2,
+0x20, 0xD2, 0x60, 0xE0, 0xA0, 0x30, 0xC0, 0x10, 0x30, 0x03, 0x71, 0x08, 0x71, 0x50, 0x11, 0xE0,
+0xD1, 0x20, 0xD2, 0x20, 0x40, 0xD2, 0x20, 0xD1, 0x23, 0xD1, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x24,
+0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x22, 0xD3, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0xB0, 0x40, 0xD2, 0x27,
+0xD1, 0x24, 0xD2, 0xB0, 0x80, 0x60, 0x03, 0x60, 0x00, 0x80, 0x70, 0x02, 0x80, 0x70, 0x10, 0x70,
+0x06, 0xA0, 0xD3, 0x90, 0x80, 0x50, 0x00, 0xF0, 0x60, 0x00, 0x70, 0xA0, 0x60, 0x71, 0x02, 0x31,
+0x90, 0x0F, 0x08, 0x0F, 0x10, 0x80, 0x61, 0x30, 0x00, 0x50, 0x30, 0x60, 0xD0, 0x20, 0xD1, 0xB0,
+0x40, 0xB0, 0xD5, 0x25, 0xD4, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD2, 0x23, 0xD0,
+0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD3, 0x40, 0xB0, 0x40, 0xD1, 0xE0, 0xA0, 0x40, 0xD1, 0x21, 0xD1,
+0x22, 0xD1, 0x40, 0x20, 0xD2, 0x22, 0xD1, 0x20, 0xD2, 0x40, 0xA0, 0x61, 0x90, 0x09, 0x50, 0x70,
+0x09, 0x71, 0x08, 0x50, 0xF0, 0x80, 0x60, 0xE0, 0xD4, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0xA0,
+0x80, 0x51, 0x90, 0x50, 0xF0, 0x01, 0xA0, 0x50, 0xD7, 0x20, 0xD2, 0x70, 0xA0, 0x90, 0xA0, 0xE0,
+0x70, 0xE0, 0x63, 0xA0, 0xB0, 0x71, 0xD4, 0xB1, 0xD1, 0xB0, 0x42, 0xB2, 0xD3, 0x21, 0xD1, 0xB0,
+0xE0, 0x30, 0x90, 0x50, 0xC0, 0x10, 0xF0, 0x01, 0x90, 0x09, 0x90, 0x01, 0x60, 0xC0, 0xD1, 0x20,
+0xD3, 0x40, 0xD3, 0x20, 0xD2, 0x21, 0xD1, 0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD2,
+0x40, 0xB0, 0xD2, 0x23, 0xD3, 0x22, 0xD0, 0x40, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x26, 0xD2,
+0x23, 0xD1, 0x41, 0x50, 0x30, 0x03, 0x60, 0x00, 0x70, 0xC0, 0x70, 0x01, 0xC0, 0x00, 0x80, 0x90,
+0x05, 0x70, 0xA0, 0xD1, 0xB1, 0x30, 0x60, 0xA0, 0x30, 0x70, 0x32, 0x00, 0x70, 0x80, 0x0F, 0x0F,
+0x0F, 0x10, 0xF0, 0x70, 0x30, 0xF0, 0x01, 0x50, 0xE0, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD2,
+0x22, 0xD0, 0x22, 0xD4, 0x21, 0xD1, 0x25, 0xD1, 0x40, 0xB0, 0xD1, 0x22, 0xD3, 0x21, 0xD1, 0x21,
+0xD0, 0x20, 0xD3, 0x41, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x23, 0xD0, 0x20, 0x40, 0xD2, 0x20,
+0xD1, 0x23, 0xD2, 0x40, 0xA0, 0x70, 0x0B, 0x90, 0x0A, 0x50, 0xF0, 0x08, 0x30, 0x90, 0x00, 0xC0,
+0xB0, 0xD3, 0x20, 0x40, 0xD4, 0xB1, 0xE0, 0x90, 0xF1, 0x02, 0x70, 0x30, 0x10, 0x30, 0xE0, 0xD1,
+0x21, 0xD0, 0xB0, 0x40, 0xB0, 0xD2, 0x40, 0xE0, 0xA0, 0x70, 0x40, 0x30, 0xA0, 0xE0, 0x90, 0xD1,
+0x40, 0x80, 0xD0, 0x40, 0x30, 0x60, 0xA2, 0xB2, 0xD4, 0x21, 0x42, 0xB0, 0xD2, 0x20, 0xD0, 0xB1,
+0xE0, 0x10, 0x80, 0xA0, 0xC2, 0x70, 0xF0, 0x50, 0x08, 0x50, 0xF0, 0x00, 0x70, 0x10, 0xB0, 0xD1,
+0x21, 0xD1, 0x40, 0x20, 0xD1, 0x22, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xD3, 0x23, 0xD1, 0x21, 0xD1,
+0xB1, 0xD2, 0x20, 0xD0, 0x22, 0xD8, 0xE0, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x25, 0xD3, 0x20,
+0xD1, 0x20, 0x40, 0x20, 0xD0, 0xB0, 0xA0, 0x50, 0x90, 0x70, 0x10, 0x90, 0x01, 0xF0, 0x30, 0x90,
+0x00, 0xF0, 0x00, 0xF0, 0x50, 0x05, 0x80, 0x40, 0xD0, 0xB0, 0x40, 0xE0, 0xC0, 0x02, 0x80, 0xA0,
+0xC0, 0x02, 0x30, 0xF0, 0x0F, 0x0E, 0x0F, 0x11, 0x70, 0xC0, 0x80, 0x01, 0xA0, 0xD0, 0x21, 0xD5,
+0x40, 0xB0, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD3, 0x22, 0xD1, 0x24, 0xD0, 0x20, 0xD1, 0xB0, 0x40,
+0x20, 0xD1, 0x21, 0xD2, 0x20, 0xD0, 0x24, 0xD3, 0xB0, 0x40, 0xB0, 0x40, 0xD3, 0x20, 0xB0, 0xD2,
+0x25, 0xD0, 0xB0, 0x40, 0xD4, 0x23, 0xD1, 0xE0, 0x60, 0x00, 0x50, 0x70, 0x0B, 0x90, 0x09, 0xF0,
+0x50, 0x07, 0x50, 0x30, 0x01, 0x30, 0xD5, 0x40, 0xD1, 0xB1, 0x41, 0xD0, 0x40, 0x80, 0x03, 0x30,
+0x10, 0x30, 0x71, 0xC0, 0x40, 0xD2, 0xE0, 0x10, 0xB0, 0xA0, 0xB0, 0xD0, 0xA0, 0x10, 0xC0, 0x10,
+0x40, 0x60, 0x71, 0x50, 0x60, 0xD0, 0xA0, 0x90, 0x30, 0xA1, 0x70, 0xC0, 0x50, 0x00, 0xF0, 0x60,
+0x40, 0xD1, 0x24, 0xD2, 0xB1, 0x41, 0xB0, 0xD1, 0x40, 0xD1, 0x60, 0x80, 0x70, 0xE0, 0x50, 0x10,
+0xA0, 0x50, 0x09, 0x50, 0x01, 0x90, 0x10, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x24,
+0xD1, 0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20,
+0xD0, 0x23, 0xD0, 0x20, 0xD4, 0x20, 0xB0, 0x40, 0xB0, 0x40, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x22,
+0xD6, 0xB0, 0x40, 0xD1, 0x20, 0xD0, 0x40, 0x60, 0x11, 0xE0, 0x04, 0xA0, 0x30, 0x09, 0x30, 0x41,
+0xB0, 0xD0, 0x60, 0x70, 0x03, 0xF0, 0x10, 0x50, 0x00, 0x70, 0xA0, 0x30, 0x0F, 0x0E, 0x0F, 0x11,
+0xA0, 0xF0, 0x50, 0xA1, 0xE0, 0xD4, 0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD2, 0x20, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x24, 0xD3, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0x25, 0xD1, 0x20,
+0xD1, 0x20, 0x40, 0xD1, 0xB0, 0x40, 0xD2, 0xB0, 0xE0, 0x40, 0xD3, 0x20, 0xD0, 0x22, 0xD0, 0x20,
+0x40, 0xD4, 0x20, 0xD1, 0xB0, 0xA0, 0x10, 0x02, 0x50, 0xF0, 0x0A, 0x70, 0x50, 0x09, 0x90, 0x06,
+0xF0, 0x60, 0x00, 0x50, 0x00, 0x90, 0x80, 0x40, 0x10, 0x60, 0xD1, 0xB0, 0x41, 0xB0, 0xD4, 0x60,
+0x01, 0xF0, 0x60, 0xC0, 0xE0, 0x01, 0x90, 0xC0, 0xE1, 0xC0, 0x90, 0x60, 0xA0, 0xE0, 0xA0, 0xD0,
+0xF0, 0x10, 0x80, 0x00, 0x60, 0x80, 0x30, 0xF0, 0x00, 0x50, 0xE0, 0x40, 0xE0, 0x00, 0xC0, 0x10,
+0x30, 0x00, 0x80, 0xC0, 0x90, 0x60, 0x10, 0xA0, 0xB0, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD3,
+0xB0, 0x42, 0xD2, 0x60, 0x10, 0xE0, 0x70, 0x30, 0xC0, 0xF0, 0x08, 0x90, 0x03, 0xC0, 0xB0, 0xD0,
+0x20, 0xD2, 0x40, 0xD0, 0x25, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x21, 0xD1, 0x20, 0xD1,
+0xB1, 0xD2, 0x24, 0xD0, 0x21, 0xD2, 0x20, 0xD0, 0xB0, 0x40, 0xD1, 0xB0, 0x40, 0xD1, 0x24, 0xD3,
+0x20, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD1, 0x22, 0xD2, 0x40, 0x10, 0x80, 0x04, 0x80, 0x50, 0x08,
+0x30, 0x40, 0xD1, 0xB0, 0x60, 0x05, 0xF0, 0xC0, 0x30, 0x80, 0x00, 0x30, 0x70, 0x0F, 0x0D, 0x0F,
+0x10, 0x50, 0x90, 0x02, 0x60, 0xD0, 0x20, 0xD3, 0x24, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0,
+0x23, 0xD2, 0x21, 0xD2, 0x25, 0xD2, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x20,
+0xD1, 0x40, 0xD3, 0xB0, 0x40, 0x20, 0xD2, 0x60, 0xB2, 0xD4, 0x21, 0xD1, 0x40, 0xD3, 0x21, 0xD0,
+0x40, 0xC0, 0x80, 0xF0, 0x01, 0x90, 0x80, 0x0B, 0x90, 0xF0, 0x09, 0x90, 0x04, 0xF0, 0x60, 0x01,
+0x50, 0xF0, 0x00, 0x11, 0xA0, 0xC0, 0xE0, 0xA0, 0xE1, 0x60, 0xD0, 0xC0, 0xD3, 0x60, 0x90, 0x80,
+0xA1, 0xE0, 0x02, 0x70, 0xF0, 0x50, 0x11, 0xC0, 0x80, 0x00, 0x10, 0x90, 0xB0, 0x10, 0xA0, 0xC0,
+0x80, 0x10, 0xC0, 0x80, 0x01, 0xA0, 0xD0, 0xA0, 0x00, 0x50, 0x60, 0x10, 0x30, 0x01, 0xC0, 0xA0,
+0xC0, 0x70, 0x90, 0xC0, 0x40, 0xD5, 0x22, 0xD4, 0xB0, 0x42, 0xB0, 0xD2, 0x60, 0x10, 0xA0, 0x30,
+0x80, 0xF0, 0x05, 0xF0, 0x50, 0x03, 0x11, 0xB0, 0xD0, 0x20, 0xD0, 0x40, 0x20, 0xD1, 0x25, 0xD2,
+0x40, 0xD1, 0x21, 0xD2, 0x22, 0xD3, 0x40, 0xB0, 0xD2, 0x25, 0xD1, 0x21, 0xD2, 0x40, 0xB0, 0xD3,
+0xB0, 0x40, 0xD0, 0x23, 0xD0, 0x20, 0xD3, 0x20, 0xD1, 0xB0, 0x40, 0xD3, 0x21, 0xD0, 0x20, 0xD0,
+0x20, 0xD1, 0x40, 0xC0, 0xE0, 0x02, 0x30, 0x61, 0x50, 0x04, 0x90, 0x50, 0xE0, 0xB0, 0xD1, 0x40,
+0x90, 0x06, 0x30, 0x80, 0x02, 0x30, 0x0F, 0x0D, 0x0F, 0x10, 0x60, 0x80, 0xF0, 0x00, 0x80, 0x40,
+0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x27, 0xD6, 0x24,
+0xD3, 0x40, 0xB0, 0xD1, 0x22, 0xD3, 0x20, 0xD1, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0x40, 0xB0, 0xD2,
+0xC2, 0xB1, 0xD3, 0x20, 0xD2, 0x40, 0xD2, 0x22, 0xD0, 0xE0, 0xC0, 0x60, 0x00, 0x90, 0xC0, 0xA0,
+0x50, 0x0B, 0x90, 0x09, 0x50, 0xF0, 0x03, 0xA0, 0xF0, 0x01, 0xF0, 0x50, 0x80, 0x50, 0x61, 0x30,
+0x12, 0xA0, 0x10, 0x60, 0xC0, 0x40, 0xD2, 0x42, 0xB0, 0x50, 0x10, 0x90, 0x50, 0x01, 0x50, 0x91,
+0x00, 0x60, 0x80, 0x00, 0xE0, 0xD0, 0x40, 0xE0, 0xA0, 0x70, 0x00, 0x30, 0x10, 0x80, 0xA0, 0x60,
+0xE0, 0xD0, 0x60, 0x00, 0x70, 0xC0, 0x30, 0xF0, 0x00, 0x70, 0x12, 0xC0, 0xA0, 0x11, 0x60, 0xC0,
+0xE0, 0xD7, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xB0, 0x40, 0xB0, 0xD0, 0xE0, 0x10, 0x60, 0x11, 0x50,
+0x05, 0x90, 0x05, 0xA0, 0x60, 0xD1, 0xB1, 0xD0, 0x20, 0xD3, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD1,
+0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD2, 0x26, 0xD1, 0x20, 0xD2, 0x40, 0xB0,
+0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x40, 0xB0, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD4, 0x40, 0xB0, 0xD4,
+0x26, 0xD2, 0x60, 0xE0, 0x04, 0x60, 0x51, 0x00, 0x51, 0x01, 0x90, 0xE0, 0xD1, 0xA0, 0x70, 0x06,
+0xF0, 0xC0, 0x01, 0x50, 0x60, 0x70, 0x0F, 0x0C, 0x0F, 0x0F, 0x50, 0x80, 0x70, 0x30, 0x80, 0x60,
+0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x22, 0xD5, 0xB0, 0x40, 0xD3, 0x24, 0xD7, 0x21, 0xD1, 0x22, 0xD1,
+0x41, 0xD4, 0x22, 0xD1, 0x40, 0xB0, 0xD7, 0x40, 0xB0, 0xD2, 0xB0, 0xC1, 0x10, 0xE0, 0xD7, 0x40,
+0xD1, 0x23, 0xD1, 0xC0, 0x00, 0x91, 0x00, 0xF0, 0x90, 0x0A, 0x70, 0x50, 0x09, 0x90, 0x02, 0x30,
+0x70, 0x03, 0x90, 0x30, 0x50, 0x70, 0xF0, 0x10, 0x80, 0x90, 0x30, 0xF0, 0x80, 0xF0, 0x90, 0xB2,
+0xD4, 0x40, 0xC0, 0x11, 0x90, 0x00, 0x90, 0x02, 0x60, 0x30, 0x00, 0xE0, 0xB0, 0xD0, 0x60, 0x80,
+0x02, 0xC0, 0xE1, 0x40, 0xD0, 0xB0, 0x30, 0x01, 0xC0, 0x10, 0xA0, 0x01, 0xA0, 0x70, 0xA1, 0x70,
+0xA0, 0x11, 0x30, 0xC1, 0xA0, 0xE0, 0xB0, 0xD6, 0x40, 0xD4, 0xB0, 0x40, 0xB0, 0xE0, 0x10, 0x60,
+0x10, 0xC0, 0x80, 0x03, 0x71, 0x05, 0x30, 0xA1, 0xD0, 0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD0, 0x20,
+0xD0, 0xB0, 0x40, 0xD0, 0x22, 0xD0, 0x21, 0xD2, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x2A, 0xD2, 0x40,
+0xB0, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x40, 0xD3, 0x20, 0xD1, 0x20, 0xD2, 0x40, 0xD3, 0x29, 0xD3,
+0xE1, 0x03, 0x70, 0x30, 0x60, 0x50, 0xF1, 0xA0, 0x00, 0xF0, 0xC0, 0xA1, 0xE0, 0x08, 0x90, 0xA0,
+0x30, 0x90, 0xF0, 0x30, 0x0F, 0x0C, 0x0F, 0x0F, 0xA0, 0x02, 0xA0, 0x40, 0xD0, 0x27, 0xD2, 0x21,
+0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x24, 0xD3, 0x21, 0xD2, 0x23, 0xD0, 0x20, 0xD1, 0x20, 0x40,
+0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40,
+0xB0, 0xD3, 0xA0, 0xC0, 0x11, 0xB0, 0xE1, 0xD3, 0x20, 0x40, 0xD1, 0x22, 0xD0, 0xB0, 0x11, 0xA0,
+0x02, 0x70, 0x50, 0x0A, 0x50, 0xF0, 0x08, 0x71, 0x00, 0x80, 0x90, 0x03, 0xF0, 0x30, 0x70, 0x02,
+0x60, 0x03, 0x50, 0x00, 0x30, 0xE0, 0x10, 0x40, 0xD1, 0x20, 0xD1, 0x60, 0xF0, 0x03, 0x50, 0x02,
+0xA0, 0x80, 0x00, 0xE0, 0xB0, 0xD1, 0xA0, 0x50, 0x01, 0x60, 0xA0, 0x60, 0x70, 0xD0, 0x40, 0x60,
+0x01, 0x30, 0x10, 0x50, 0x04, 0x70, 0xF0, 0x00, 0x90, 0x80, 0x90, 0x12, 0x30, 0x10, 0xE0, 0xD1,
+0x22, 0xB1, 0xD0, 0x22, 0xD2, 0xB0, 0xE0, 0x30, 0x60, 0x50, 0x10, 0x80, 0x03, 0x90, 0x07, 0xA0,
+0x10, 0xB0, 0xD3, 0x21, 0xD4, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD1,
+0xB1, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x21, 0xD2, 0x40, 0x20, 0xD2, 0x24, 0xD1, 0x40, 0xD1, 0x22,
+0xD2, 0x41, 0xD3, 0x20, 0xD0, 0x28, 0xD4, 0xE0, 0x90, 0x03, 0x50, 0x90, 0x50, 0x70, 0x62, 0xA1,
+0x90, 0x0A, 0x70, 0x10, 0x02, 0x30, 0xF0, 0x0F, 0x0B, 0x0F, 0x0E, 0x70, 0xC0, 0x01, 0xF0, 0xA0,
+0xD0, 0x20, 0xD0, 0x26, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x22, 0xD2, 0x22,
+0xD3, 0x24, 0xD3, 0x41, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD0,
+0xB0, 0x40, 0xD4, 0x70, 0x60, 0xA0, 0xC0, 0xE0, 0x60, 0x40, 0xD3, 0x40, 0xD5, 0x40, 0xA0, 0x80,
+0x50, 0x00, 0xF0, 0x00, 0x70, 0x50, 0x0A, 0x90, 0x09, 0x50, 0x90, 0x30, 0x02, 0x70, 0x50, 0xA0,
+0x90, 0x08, 0x70, 0xF0, 0x70, 0x10, 0xC0, 0xA0, 0x60, 0x40, 0xD3, 0xC0, 0xA0, 0x80, 0x90, 0x00,
+0x70, 0xF0, 0x04, 0x90, 0x40, 0xD2, 0xA0, 0x60, 0xC0, 0xE0, 0x30, 0xA0, 0xE0, 0xD1, 0xA0, 0x02,
+0xA0, 0xC0, 0x04, 0x50, 0x04, 0x50, 0x10, 0x30, 0x10, 0xC0, 0xA0, 0xE0, 0xD1, 0x20, 0xD0, 0x40,
+0xD2, 0x21, 0xD0, 0x20, 0xD2, 0x10, 0xA1, 0x30, 0x03, 0x50, 0xF0, 0x07, 0x80, 0xC0, 0x80, 0xD0,
+0x20, 0xD2, 0x21, 0xD3, 0x40, 0xD2, 0x26, 0xD2, 0x40, 0xB0, 0xD2, 0x25, 0xD5, 0xB0, 0x40, 0xD1,
+0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0x40, 0xB0, 0xD3, 0x20, 0xD1,
+0x27, 0xD4, 0x20, 0xD0, 0x60, 0x50, 0xA0, 0x70, 0x50, 0x01, 0x30, 0xC0, 0x50, 0xD2, 0x40, 0xA0,
+0x0B, 0xC0, 0x30, 0x01, 0x90, 0xA0, 0x0F, 0x0B, 0x0F, 0x0E, 0x30, 0x70, 0xA0, 0x90, 0x80, 0x40,
+0xD1, 0x23, 0xD1, 0x24, 0xD3, 0x24, 0xD1, 0xB0, 0x40, 0xD3, 0x25, 0xD0, 0x22, 0xD3, 0x20, 0xD0,
+0x21, 0xD2, 0xB0, 0x40, 0xD3, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD5, 0x40, 0xD6,
+0xB0, 0x60, 0x11, 0xC0, 0xA1, 0xB0, 0xD0, 0x40, 0xD4, 0xB0, 0x60, 0xC0, 0xA0, 0x00, 0x10, 0x60,
+0x90, 0x30, 0xC0, 0x09, 0xF0, 0x90, 0x08, 0x70, 0x30, 0x01, 0x70, 0x90, 0x70, 0x00, 0x50, 0xA0,
+0x50, 0x07, 0xF0, 0x50, 0x01, 0x81, 0x00, 0xA0, 0xB0, 0xD1, 0xE0, 0x30, 0xA3, 0x50, 0x70, 0x04,
+0xA0, 0xB0, 0xD0, 0x20, 0xD0, 0xE0, 0x60, 0xD0, 0x60, 0x80, 0x00, 0x60, 0xD1, 0xE0, 0x10, 0x60,
+0x80, 0xC0, 0x60, 0x03, 0x70, 0x90, 0x05, 0x71, 0x12, 0xC0, 0xE0, 0xD1, 0xB0, 0x40, 0xD2, 0x21,
+0xD1, 0x20, 0xD1, 0xB0, 0xA0, 0x10, 0x80, 0xF0, 0x50, 0xF1, 0x50, 0x09, 0x60, 0xA0, 0xD0, 0x20,
+0xD2, 0x22, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x24, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD4, 0xB0,
+0x40, 0xD2, 0x20, 0xD2, 0x21, 0xD1, 0x21, 0xD0, 0x40, 0xB0, 0xD2, 0xB0, 0x40, 0xD2, 0x22, 0xD0,
+0x22, 0xD0, 0x21, 0xD1, 0x22, 0xD2, 0x21, 0xD0, 0xB0, 0xA1, 0x10, 0x30, 0x02, 0xE0, 0xB0, 0xD3,
+0x40, 0xE0, 0x0A, 0x80, 0xC0, 0x90, 0xA0, 0x90, 0x30, 0x70, 0x0F, 0x0A, 0x0F, 0x0D, 0x50, 0x80,
+0x01, 0x50, 0x60, 0xD1, 0x23, 0xD3, 0x27, 0xD3, 0x20, 0xD3, 0x41, 0xD3, 0x29, 0xD2, 0x24, 0xD2,
+0x40, 0xB0, 0xD0, 0x40, 0xB0, 0xD0, 0x22, 0xD0, 0x25, 0xD4, 0x40, 0x20, 0xD1, 0x21, 0xD1, 0x41,
+0xC2, 0x80, 0xC0, 0xA0, 0x60, 0xE0, 0xB0, 0x41, 0xE0, 0xA0, 0x90, 0xF0, 0xA0, 0x00, 0x70, 0xC0,
+0x10, 0x50, 0x90, 0x80, 0x90, 0xA1, 0x80, 0xF0, 0x04, 0x50, 0x70, 0x06, 0xF0, 0x30, 0x50, 0xF0,
+0x51, 0x04, 0x10, 0x08, 0x50, 0x04, 0xF0, 0x60, 0xD1, 0x60, 0x00, 0xF0, 0x70, 0x90, 0xC0, 0x60,
+0x70, 0x04, 0x90, 0xE0, 0xD1, 0xB0, 0xD2, 0x30, 0x70, 0x00, 0xA0, 0xD1, 0xB0, 0x60, 0x80, 0x50,
+0x05, 0x90, 0xA1, 0xF0, 0x05, 0x70, 0x30, 0x10, 0xC0, 0x40, 0xD1, 0xB1, 0xD3, 0x21, 0xD0, 0x21,
+0xD1, 0x40, 0x11, 0xC0, 0xA0, 0x51, 0x09, 0x50, 0x10, 0x30, 0xD4, 0x21, 0xD1, 0x40, 0x20, 0xD1,
+0x20, 0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x25, 0xD2, 0x40,
+0xB0, 0xD1, 0x21, 0xD6, 0x22, 0xD1, 0x40, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD2, 0x23, 0xD0, 0x21,
+0xD1, 0x24, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xA0, 0xE1, 0xA0, 0xF0, 0x00, 0x60, 0xD1, 0x20,
+0xD2, 0xE0, 0x50, 0x09, 0xA0, 0x90, 0xA0, 0x01, 0x70, 0x30, 0x0F, 0x0A, 0x0F, 0x0D, 0xA0, 0xF0,
+0x01, 0x90, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD3, 0x21, 0xD0, 0x25, 0xD9, 0x20, 0x40, 0xB0, 0xD2,
+0x23, 0xD0, 0x23, 0xD2, 0x24, 0xD3, 0xB0, 0x41, 0xD1, 0x23, 0xD2, 0x23, 0xD3, 0x20, 0x40, 0xB0,
+0xD0, 0x22, 0xD0, 0x41, 0xD0, 0x40, 0xA0, 0x11, 0x01, 0x70, 0x30, 0x91, 0x10, 0x90, 0x10, 0x00,
+0x10, 0x90, 0x00, 0x30, 0xC0, 0x10, 0xC0, 0xE0, 0x62, 0x11, 0x90, 0x04, 0x90, 0x06, 0xA0, 0xF0,
+0x50, 0x80, 0x05, 0xF0, 0xA0, 0x08, 0x71, 0x04, 0x70, 0x60, 0xD0, 0xE0, 0x70, 0x04, 0x50, 0x05,
+0x30, 0x60, 0xD0, 0xC0, 0xD2, 0x10, 0x50, 0x00, 0x70, 0x60, 0xD1, 0xA0, 0x90, 0x30, 0x50, 0x01,
+0x80, 0xA1, 0x80, 0xA0, 0x60, 0x10, 0x80, 0x06, 0x11, 0xE0, 0x90, 0x70, 0x40, 0xD2, 0x22, 0xD2,
+0x20, 0xD2, 0x40, 0xC0, 0x10, 0x60, 0x50, 0x80, 0x90, 0x07, 0x50, 0xF0, 0x80, 0x10, 0xA0, 0xD2,
+0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x20,
+0xD5, 0x23, 0xD1, 0x40, 0x20, 0xD2, 0x20, 0xD7, 0x23, 0xD1, 0x41, 0xD8, 0x22, 0xD0, 0x21, 0xD0,
+0x20, 0xD1, 0x22, 0xD1, 0xB0, 0x41, 0xD4, 0xB0, 0x61, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x60,
+0xF0, 0x08, 0x80, 0x10, 0xC0, 0x02, 0xA0, 0x70, 0x0F, 0x09, 0x0F, 0x0C, 0x70, 0xA0, 0x31, 0xF0,
+0x60, 0xD2, 0x23, 0xD1, 0x20, 0xD1, 0x26, 0xD5, 0x20, 0xD1, 0x21, 0xD0, 0xB0, 0x40, 0xB0, 0xD1,
+0x20, 0xD1, 0x23, 0xD2, 0x21, 0xD0, 0x25, 0xD1, 0x41, 0xB0, 0xD0, 0x22, 0xD0, 0x24, 0xD0, 0x23,
+0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD3, 0xE0, 0xC0, 0x30, 0x10, 0x80, 0x30, 0xA0, 0x80, 0x00, 0x50,
+0x11, 0x03, 0xA0, 0xE0, 0x71, 0xE0, 0xA0, 0x50, 0x00, 0x60, 0x50, 0x02, 0xF0, 0x70, 0x01, 0x90,
+0x04, 0x30, 0x90, 0x50, 0xF0, 0x71, 0x04, 0xA0, 0x07, 0x90, 0x01, 0x50, 0x05, 0x70, 0x60, 0xE0,
+0x60, 0xA0, 0x50, 0x02, 0x90, 0x06, 0x70, 0xC0, 0xD2, 0xB0, 0xE0, 0x70, 0x01, 0x10, 0x40, 0xD1,
+0x40, 0x12, 0xC4, 0x60, 0xC0, 0xA0, 0x10, 0x80, 0x05, 0x50, 0x30, 0x11, 0xC0, 0x61, 0xB0, 0xD4,
+0x21, 0xD4, 0xB0, 0x40, 0x60, 0x30, 0x10, 0x60, 0xA0, 0x05, 0x70, 0x50, 0x02, 0x10, 0xE0, 0xD2,
+0x20, 0xD0, 0xB1, 0xD3, 0x21, 0xD0, 0x20, 0xD3, 0xB1, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x24, 0xD1,
+0x40, 0xD3, 0x21, 0xD1, 0x20, 0xD4, 0x22, 0xD1, 0x41, 0xDC, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD3,
+0x41, 0xD2, 0x21, 0xD3, 0x60, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0x30, 0x09, 0x70, 0xC0, 0x90,
+0x50, 0xA0, 0x31, 0x0F, 0x09, 0x0F, 0x0C, 0x30, 0x01, 0xF0, 0x60, 0xE0, 0xD2, 0x26, 0xD0, 0x20,
+0xD3, 0x24, 0xD0, 0x25, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x21, 0xD3, 0x24, 0xD2, 0x21, 0xD2,
+0x40, 0xB0, 0xD0, 0x40, 0xB0, 0xD4, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0xB0, 0x40,
+0xD2, 0x20, 0xD0, 0x20, 0xD0, 0xE0, 0x10, 0x40, 0xB0, 0x61, 0x40, 0xC0, 0xE0, 0x60, 0xA2, 0x60,
+0xC0, 0xA0, 0xE0, 0x50, 0x40, 0xC1, 0xF0, 0x50, 0x01, 0x60, 0x10, 0x30, 0x00, 0x50, 0x80, 0x01,
+0x70, 0x50, 0x02, 0x90, 0x30, 0x70, 0x02, 0x90, 0x04, 0x80, 0xC0, 0x06, 0xC0, 0x90, 0x60, 0x50,
+0x07, 0x30, 0xA0, 0x80, 0xA0, 0x02, 0x50, 0x01, 0x90, 0xF0, 0x00, 0xF0, 0x30, 0xC0, 0x10, 0xD1,
+0xA0, 0x40, 0x60, 0x90, 0x00, 0xF0, 0x10, 0xA0, 0xD3, 0xB0, 0x10, 0x70, 0x60, 0x10, 0x90, 0x40,
+0xB0, 0xC0, 0x80, 0xC0, 0x11, 0x30, 0xF0, 0x05, 0x70, 0xA0, 0x31, 0x12, 0x60, 0xB0, 0xD0, 0x21,
+0xD0, 0x21, 0xD3, 0xB0, 0x60, 0x11, 0x30, 0x50, 0x70, 0x03, 0x90, 0x03, 0xA0, 0x10, 0xD3, 0xB0,
+0x40, 0xD3, 0x20, 0xD0, 0x22, 0xD2, 0xB1, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD2, 0xB0, 0x40,
+0xD3, 0x27, 0xD0, 0x21, 0xD2, 0xB0, 0x40, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x21, 0xD4, 0x21,
+0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD1, 0x20, 0xDE, 0x21, 0xD0, 0xE0, 0x70, 0x08, 0xF0, 0x30, 0xC0,
+0x50, 0x01, 0x30, 0xF0, 0x0F, 0x08, 0x0F, 0x0C, 0xA0, 0x02, 0xA0, 0xD0, 0x41, 0xB0, 0xD0, 0x20,
+0xD0, 0x21, 0xD0, 0x22, 0xD4, 0x2B, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD1, 0x24,
+0xD1, 0x22, 0xD0, 0xB1, 0xD2, 0xB0, 0x40, 0xB0, 0xD1, 0x25, 0xD0, 0x26, 0xD0, 0xB0, 0x40, 0xD2,
+0x22, 0xD0, 0xE0, 0xB0, 0xD3, 0xB0, 0xD0, 0x40, 0xD0, 0xB0, 0xE2, 0x30, 0xA0, 0xE0, 0x40, 0x11,
+0xC1, 0x50, 0x90, 0x10, 0xC1, 0x50, 0x04, 0x90, 0xF0, 0x00, 0x70, 0x80, 0x04, 0x70, 0x50, 0x03,
+0x70, 0xA0, 0x05, 0x70, 0x10, 0x90, 0xF0, 0x00, 0xA0, 0x70, 0x06, 0xF0, 0xC0, 0x30, 0x02, 0x70,
+0x51, 0xC0, 0xA0, 0x01, 0x10, 0xC0, 0x60, 0x70, 0x40, 0x10, 0xA0, 0x10, 0x61, 0x31, 0x10, 0x60,
+0xD3, 0x60, 0x01, 0x70, 0x10, 0x41, 0x10, 0x70, 0x80, 0xA0, 0xC0, 0x11, 0x70, 0x05, 0x50, 0x00,
+0x80, 0x30, 0x10, 0x60, 0x10, 0xE0, 0xD0, 0x25, 0xD2, 0x40, 0xD0, 0x60, 0x10, 0x90, 0xF0, 0x70,
+0x50, 0x01, 0x50, 0x04, 0x70, 0x10, 0xE0, 0xD1, 0x20, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x20,
+0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x28, 0xD0, 0xB0, 0x40, 0xD1, 0x20, 0xD0, 0x26, 0xD0, 0x22,
+0xD2, 0x40, 0xB0, 0xD2, 0xB0, 0x40, 0xD0, 0x23, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0,
+0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x25, 0xD1, 0x22, 0xD1, 0x40, 0x90, 0x07, 0x51, 0x31,
+0x90, 0x01, 0x70, 0x30, 0x0F, 0x08, 0x0F, 0x0B, 0x80, 0x31, 0x00, 0x50, 0xE0, 0xD2, 0x41, 0x20,
+0xD2, 0x20, 0xD0, 0x23, 0xD5, 0x24, 0xD0, 0x24, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21,
+0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD3, 0x20, 0xD0,
+0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x40, 0xD3, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0xD3, 0x90, 0x10,
+0x30, 0x13, 0x40, 0xD1, 0xE3, 0xC0, 0x10, 0x70, 0xC0, 0x90, 0x05, 0x90, 0x50, 0x30, 0x06, 0x50,
+0x02, 0x70, 0x60, 0x07, 0x50, 0x60, 0x01, 0x90, 0x06, 0x90, 0x10, 0xE1, 0xA0, 0xC0, 0xA0, 0x30,
+0x60, 0x10, 0x30, 0x60, 0x10, 0x90, 0x30, 0x60, 0x80, 0x61, 0xF0, 0x00, 0x10, 0x80, 0x10, 0x80,
+0x00, 0xE0, 0xC0, 0x61, 0xD1, 0xB0, 0xC0, 0x01, 0x90, 0xE0, 0xD0, 0x60, 0xE0, 0x70, 0xA0, 0x30,
+0x10, 0x60, 0xC0, 0xF0, 0x03, 0x71, 0x03, 0x50, 0x10, 0xE0, 0xD0, 0x20, 0xD0, 0x22, 0xD2, 0x40,
+0xD2, 0x40, 0x11, 0xA0, 0xF0, 0x51, 0x70, 0x05, 0x60, 0x10, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0x22, 0xD1, 0x40, 0xB0, 0xD1,
+0x23, 0xD2, 0x25, 0xD2, 0x40, 0xB0, 0xD4, 0xB1, 0xD0, 0x23, 0xD0, 0x25, 0xD3, 0x40, 0xB0, 0xD3,
+0x22, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x23, 0xD0, 0x40, 0x90, 0x05, 0x50, 0x90, 0xF0,
+0x00, 0x30, 0x00, 0x10, 0x00, 0x90, 0xA0, 0xC0, 0x0F, 0x08, 0x0F, 0x03, 0x90, 0x30, 0xF0, 0x04,
+0xA0, 0x00, 0xF0, 0x30, 0xC0, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x21, 0xD3,
+0x24, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD3, 0x23, 0xD1,
+0x40, 0xD2, 0x20, 0xD3, 0xB0, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x25, 0xD1, 0x40, 0xB0,
+0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0xE0, 0xD0, 0xE1, 0xA0, 0x10, 0x30, 0x10, 0xA0, 0x40,
+0xD6, 0xA0, 0xC0, 0x11, 0x80, 0x04, 0xF0, 0x50, 0xA0, 0xF0, 0x06, 0xF0, 0x50, 0x01, 0xA0, 0x50,
+0x07, 0x50, 0x90, 0x51, 0x91, 0x80, 0x70, 0x03, 0x80, 0xC0, 0xA0, 0x50, 0x40, 0x50, 0xE0, 0x90,
+0x31, 0xC0, 0x10, 0xA0, 0x40, 0xA0, 0xC0, 0xE0, 0xA0, 0xC0, 0xA0, 0x00, 0x80, 0x60, 0x10, 0x80,
+0x01, 0x60, 0x80, 0xF0, 0xE0, 0x70, 0x60, 0x50, 0x00, 0x70, 0x10, 0xB0, 0xD0, 0xE0, 0x41, 0xB0,
+0x00, 0x60, 0xA0, 0x40, 0xA0, 0x03, 0x51, 0x90, 0x00, 0x90, 0x80, 0xF0, 0x10, 0xA0, 0xD0, 0x23,
+0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD3, 0xB0, 0xA0, 0x10, 0x90, 0x00, 0x50, 0x70, 0x02, 0xC0, 0x30,
+0x00, 0xA0, 0x10, 0xA0, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD2,
+0x21, 0xD0, 0x24, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x26, 0xD0, 0xB0, 0x40, 0xD7,
+0x40, 0xD1, 0x28, 0xD2, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD0, 0x23, 0xD3, 0x23,
+0xD0, 0x40, 0x80, 0x02, 0xF0, 0x50, 0x90, 0xF0, 0x02, 0x30, 0x00, 0x30, 0xC0, 0x90, 0x00, 0x91,
+0x0F, 0x07, 0x0F, 0x02, 0xF0, 0x30, 0x70, 0x80, 0x03, 0x91, 0x01, 0x70, 0xE0, 0xD0, 0x23, 0xD2,
+0xB0, 0x40, 0xB0, 0xD3, 0x24, 0xD9, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0xB0, 0x40,
+0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x22, 0xD4, 0x40, 0xB0, 0xD1,
+0x20, 0xD0, 0x2A, 0xD1, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xE0, 0xD0, 0xB0,
+0x60, 0x40, 0xE0, 0x61, 0xB0, 0xD0, 0x22, 0xD4, 0x40, 0xD0, 0xE0, 0x10, 0xA0, 0x02, 0x50, 0x70,
+0x30, 0x50, 0x08, 0x50, 0xF0, 0x00, 0x91, 0x07, 0xC1, 0x10, 0x60, 0xE1, 0x60, 0xC0, 0x04, 0xF0,
+0x80, 0x60, 0xA0, 0x60, 0x10, 0xC0, 0xA0, 0xC0, 0x80, 0x50, 0x60, 0x40, 0xD2, 0x40, 0xB0, 0x11,
+0x60, 0x50, 0xA0, 0x90, 0x01, 0xC0, 0x80, 0x70, 0xC0, 0xE0, 0x10, 0x02, 0x30, 0xB0, 0xD2, 0x40,
+0x80, 0x00, 0xA0, 0xD1, 0xA0, 0xF0, 0x10, 0x81, 0x70, 0x11, 0x60, 0x10, 0x80, 0x70, 0x10, 0xE0,
+0xD0, 0x20, 0xD1, 0x23, 0x40, 0xD1, 0x20, 0xD4, 0x60, 0xC0, 0x10, 0x80, 0x90, 0x00, 0xF0, 0x14,
+0x60, 0xB0, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x22,
+0xD1, 0xB0, 0x40, 0x20, 0xD3, 0x25, 0xD1, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x23, 0xD2, 0x40, 0xD0,
+0x23, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x24, 0xD6, 0x24, 0xD1,
+0x40, 0x90, 0x00, 0xF0, 0x51, 0x05, 0x50, 0x90, 0xF0, 0x60, 0x02, 0xA0, 0x0F, 0x07, 0x0F, 0x03,
+0x90, 0x30, 0xF0, 0x03, 0x60, 0x30, 0xF0, 0x00, 0xE0, 0xB0, 0xD0, 0x22, 0xD5, 0xB0, 0x40, 0xB0,
+0xD4, 0x23, 0xD4, 0x21, 0xD1, 0x21, 0xD2, 0x25, 0xD0, 0xB0, 0x40, 0xB0, 0xD5, 0x20, 0xD1, 0x40,
+0xD3, 0x22, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD5, 0x21, 0xD0, 0x22, 0xD0, 0x22, 0xD0, 0xB0, 0x40,
+0xD3, 0x20, 0xD8, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD4, 0x40, 0x70, 0xC0, 0xF0, 0x00, 0xF0, 0x90,
+0xF0, 0x50, 0x80, 0x0A, 0x90, 0x00, 0x70, 0x60, 0x09, 0x80, 0x10, 0x30, 0xE0, 0x60, 0x70, 0x30,
+0x70, 0x07, 0x50, 0x10, 0x60, 0x02, 0x50, 0x60, 0xE0, 0xB0, 0x41, 0xC0, 0xA0, 0x30, 0xC0, 0x30,
+0x80, 0x02, 0xF0, 0x00, 0x90, 0x80, 0xC0, 0x60, 0x02, 0x70, 0xA0, 0xB0, 0xD2, 0xA1, 0x40, 0xD1,
+0xC0, 0xA0, 0xC0, 0x80, 0x60, 0x30, 0x10, 0xC0, 0x50, 0x80, 0x10, 0x60, 0xC0, 0xB0, 0xD0, 0x20,
+0xD4, 0xB1, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0xA0, 0x11, 0x30, 0xA0, 0xE2, 0x10, 0xC0, 0x40,
+0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD1,
+0xB0, 0x40, 0xD1, 0x23, 0xD1, 0x23, 0xD4, 0xB0, 0x40, 0xD2, 0x22, 0xD0, 0x21, 0xD2, 0x40, 0x24,
+0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD3, 0x26, 0xD0, 0x21, 0xD3, 0x22, 0xD2, 0x40, 0x80, 0x51,
+0x07, 0xF0, 0x30, 0x00, 0xC0, 0x70, 0x00, 0x50, 0xC0, 0x70, 0x0F, 0x06, 0x0F, 0x03, 0xF0, 0x04,
+0x50, 0x80, 0x70, 0x30, 0xA1, 0xD1, 0x22, 0xD3, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD4, 0x21, 0xD0,
+0x21, 0xD0, 0x22, 0xD6, 0x24, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD5, 0xB1, 0xD0, 0x25, 0xD0,
+0x20, 0xD0, 0x21, 0xD0, 0xB0, 0x40, 0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x20, 0xD0, 0x22, 0xD0,
+0xB0, 0x40, 0xD2, 0x22, 0xD1, 0x22, 0xD2, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x40,
+0x10, 0x90, 0x00, 0x90, 0x00, 0xF0, 0xA0, 0x0B, 0x50, 0x70, 0x00, 0x30, 0x08, 0xF0, 0x60, 0xA0,
+0x80, 0x50, 0x80, 0x30, 0x10, 0xF0, 0x08, 0x30, 0x60, 0x04, 0x90, 0x30, 0x80, 0xE0, 0x60, 0x10,
+0x30, 0x10, 0x80, 0x06, 0x60, 0xE0, 0x80, 0x02, 0x51, 0x40, 0xD6, 0x40, 0xE0, 0x00, 0x50, 0x10,
+0x80, 0x00, 0x90, 0x10, 0x30, 0x70, 0x40, 0xC0, 0x10, 0xE0, 0xD0, 0x22, 0xD2, 0x40, 0xD4, 0x24,
+0xD1, 0x40, 0xE0, 0x10, 0xE0, 0xB0, 0xD2, 0xB0, 0xD2, 0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x20,
+0xD1, 0x23, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x24, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x40, 0xB0,
+0xD2, 0x25, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD3, 0x40, 0xB0, 0x20, 0xD1, 0x21, 0xD0, 0x22,
+0xD4, 0x20, 0xD0, 0x21, 0xD3, 0x22, 0xD4, 0xB0, 0x40, 0xA0, 0x09, 0x70, 0x80, 0x00, 0x50, 0xC0,
+0x30, 0x90, 0x70, 0x30, 0x0F, 0x06, 0x0F, 0x01, 0xF0, 0xC0, 0xA0, 0xC0, 0x10, 0x80, 0x01, 0x30,
+0xF0, 0x01, 0x80, 0x40, 0xD0, 0x22, 0xD2, 0x23, 0xD3, 0xB0, 0x41, 0x20, 0xD3, 0x25, 0xD0, 0x20,
+0xD3, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0x20, 0xD2, 0x20, 0x40, 0xD1,
+0x29, 0xD3, 0xB0, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD1, 0x25, 0xD1, 0x40, 0x20, 0xD3, 0x20, 0xD0,
+0x24, 0xD1, 0x40, 0xD4, 0x23, 0xD1, 0xB1, 0xE0, 0x60, 0x01, 0xA0, 0x01, 0x50, 0x10, 0x09, 0x90,
+0x00, 0x60, 0x07, 0xF0, 0x10, 0x90, 0xE0, 0x61, 0x30, 0xC0, 0x80, 0x03, 0x60, 0x80, 0x03, 0x60,
+0x10, 0xF0, 0x0A, 0x10, 0xA0, 0x06, 0x70, 0x10, 0xF1, 0x90, 0x00, 0x70, 0x60, 0xB0, 0xD0, 0x23,
+0xD1, 0x60, 0x02, 0x90, 0x70, 0x01, 0x50, 0xA0, 0xC0, 0xE0, 0x90, 0x70, 0xD0, 0x23, 0xD1, 0xB1,
+0xD0, 0x21, 0xD1, 0x26, 0xD3, 0xB0, 0x40, 0xB0, 0x40, 0xD1, 0x24, 0xD3, 0xB1, 0xD2, 0x26, 0xD2,
+0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x25, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB0, 0x40, 0xD3, 0x24, 0xD1,
+0x23, 0xD0, 0xB0, 0x40, 0xD3, 0x41, 0xD3, 0x26, 0xD5, 0x24, 0xD1, 0x22, 0xD2, 0xB0, 0x40, 0xB0,
+0xD0, 0x60, 0x09, 0x80, 0x70, 0x01, 0x60, 0x02, 0x30, 0xF0, 0x0F, 0x05, 0x0F, 0x01, 0x80, 0x90,
+0x01, 0xF0, 0x30, 0x60, 0x00, 0x60, 0xF0, 0x01, 0x60, 0xD1, 0x22, 0xD2, 0x21, 0xD8, 0x41, 0xB0,
+0xD1, 0x22, 0xD1, 0x2E, 0xD6, 0x40, 0xB0, 0xD1, 0x40, 0xD3, 0x21, 0xD1, 0x26, 0xD3, 0x40, 0xB0,
+0xD0, 0x21, 0xD3, 0x25, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD4, 0x20, 0xD0, 0x20, 0x40,
+0xD3, 0x21, 0xD4, 0x41, 0x90, 0xC0, 0x30, 0x90, 0x01, 0x90, 0x80, 0x09, 0x70, 0x90, 0xA0, 0x08,
+0x70, 0xC1, 0x10, 0xA0, 0x80, 0x90, 0x04, 0x10, 0x90, 0x03, 0x70, 0xC0, 0x70, 0x02, 0x80, 0x06,
+0x10, 0xA0, 0x09, 0x50, 0xC0, 0x10, 0x80, 0xE0, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0x60, 0xF0,
+0x00, 0x90, 0x70, 0x03, 0x30, 0x60, 0x10, 0xB0, 0xD1, 0x21, 0xD1, 0x20, 0x40, 0xD0, 0x21, 0xD2,
+0x25, 0xD0, 0x20, 0xD3, 0xB0, 0xE0, 0xB0, 0xD4, 0x21, 0xD2, 0xB1, 0xD2, 0x20, 0xD0, 0x25, 0xD1,
+0x40, 0x20, 0xD0, 0x20, 0xD1, 0x27, 0xD0, 0x20, 0xD1, 0x41, 0xD3, 0x25, 0xD0, 0x24, 0xD1, 0x40,
+0xB0, 0xD0, 0xB0, 0x40, 0x20, 0xD6, 0x24, 0xD4, 0x20, 0xD1, 0x20, 0xD2, 0x22, 0xD1, 0x41, 0xB0,
+0xD2, 0x40, 0x90, 0x08, 0x80, 0x50, 0x01, 0x80, 0x90, 0x01, 0x81, 0x05, 0x70, 0x0D, 0x0F, 0x01,
+0x50, 0x60, 0x03, 0xA0, 0x30, 0x50, 0x80, 0x30, 0x81, 0xD0, 0x21, 0xD4, 0x21, 0xD0, 0x20, 0xD3,
+0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x2E, 0xD9, 0x20, 0x40, 0xB0, 0x40, 0xD3, 0x2C, 0xD2, 0x40,
+0xB0, 0xD2, 0x20, 0xD2, 0x24, 0xD0, 0x21, 0xD0, 0x40, 0xB0, 0xD3, 0x22, 0xD2, 0x20, 0xD1, 0x40,
+0xD1, 0x21, 0xD4, 0x40, 0xB0, 0x40, 0xD0, 0xC0, 0xF0, 0x30, 0x60, 0xF0, 0x0C, 0x80, 0x50, 0x09,
+0xF0, 0x90, 0xF0, 0x00, 0xC0, 0xF0, 0x04, 0xF1, 0xC0, 0x03, 0x51, 0x02, 0x10, 0x70, 0x05, 0x60,
+0x80, 0x08, 0xC0, 0x60, 0x30, 0x10, 0x60, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0xE0, 0xC0, 0x50, 0x00,
+0xA0, 0x60, 0x50, 0x04, 0x80, 0xC0, 0xE0, 0xD0, 0x20, 0xD2, 0x40, 0x20, 0xD0, 0x21, 0xD2, 0x2A,
+0xD0, 0x40, 0xB0, 0x40, 0xB0, 0xD1, 0x23, 0xD1, 0x40, 0xB0, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xB0,
+0xD1, 0x22, 0xD0, 0x23, 0xD3, 0x21, 0xD3, 0x41, 0xB0, 0xD1, 0x22, 0xD3, 0x26, 0xD2, 0x20, 0xD1,
+0x20, 0xD4, 0x20, 0x41, 0xB0, 0xD1, 0x21, 0xD1, 0x60, 0xF0, 0x07, 0x30, 0x70, 0x01, 0xF0, 0xC0,
+0x90, 0xA0, 0x50, 0xA0, 0x05, 0x60, 0xF0, 0x0C, 0x0F, 0x02, 0x90, 0x10, 0x30, 0x50, 0x70, 0x60,
+0xA0, 0x02, 0xC0, 0xD8, 0x23, 0xD0, 0x24, 0xD4, 0x41, 0xB0, 0xD4, 0x23, 0xD0, 0x25, 0xD6, 0x21,
+0xD2, 0x41, 0xD2, 0x21, 0xD2, 0x26, 0xD1, 0x20, 0xD2, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x23, 0xD1,
+0x25, 0xD0, 0xB0, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD1, 0x20, 0xD3, 0x40,
+0x20, 0xD1, 0x40, 0xB0, 0xA0, 0x60, 0x10, 0x0D, 0x91, 0x0D, 0xC0, 0x50, 0x03, 0xA0, 0x01, 0x31,
+0x03, 0x90, 0x02, 0x70, 0xF0, 0x01, 0x50, 0x70, 0x02, 0x50, 0xF0, 0x07, 0x50, 0xC0, 0x10, 0xC0,
+0xE0, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xE0, 0x60, 0xC0, 0x10, 0x02, 0xC0, 0x11, 0x05, 0xA0, 0x10,
+0xE0, 0xD2, 0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x21, 0xD7, 0x22, 0xD0, 0x40, 0xB0, 0xD1, 0x40, 0xB0,
+0xD1, 0x21, 0xD1, 0xB1, 0xD3, 0x21, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0x20, 0xD0, 0x20, 0xD4, 0x20,
+0xD2, 0x20, 0xD2, 0xB0, 0x40, 0xD2, 0x24, 0xD0, 0x21, 0xD1, 0x22, 0xD4, 0x41, 0xB0, 0xD0, 0x20,
+0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD2, 0x24, 0xD4, 0x21, 0xD2, 0x41, 0xB0, 0xD1, 0x20, 0xD0,
+0x21, 0xD2, 0xA0, 0x06, 0xF0, 0x30, 0x03, 0x60, 0x80, 0x01, 0x91, 0x04, 0x80, 0x90, 0x0C, 0x0F,
+0x01, 0xF0, 0x01, 0x50, 0xA1, 0x90, 0x80, 0x01, 0xF0, 0xA0, 0xD1, 0x20, 0xD5, 0x24, 0xD2, 0x21,
+0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD3, 0x26, 0xD3, 0x21, 0xD1, 0x20, 0xD0, 0xB1,
+0xD0, 0x41, 0x20, 0xD4, 0x25, 0xD0, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD3, 0x20,
+0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD1, 0x23, 0xD1, 0x21, 0xD2, 0x40, 0xD3, 0x20, 0x40, 0xD1, 0x20,
+0xD1, 0x40, 0x30, 0xA0, 0xC0, 0xA0, 0x50, 0x0B, 0x30, 0x90, 0xF0, 0x0D, 0x50, 0x06, 0x50, 0x10,
+0xF0, 0x02, 0x50, 0x03, 0x50, 0x12, 0x30, 0x02, 0x50, 0xF0, 0x01, 0x70, 0x11, 0xA0, 0x70, 0x00,
+0x80, 0x60, 0x10, 0x30, 0xA0, 0xD5, 0x60, 0x01, 0x11, 0xA0, 0x60, 0x04, 0x70, 0x80, 0x70, 0x01,
+0x10, 0xE0, 0xD2, 0x40, 0xD1, 0x21, 0xD0, 0x23, 0xD5, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x40,
+0xB0, 0xD3, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD3, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD0,
+0x21, 0xD4, 0x20, 0x40, 0xB0, 0xD4, 0x23, 0xD3, 0x21, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD0,
+0x40, 0xD0, 0x20, 0xD0, 0x26, 0xD2, 0x25, 0xD2, 0x20, 0xD1, 0xB0, 0x41, 0xD2, 0x23, 0xD0, 0x20,
+0xD2, 0xA0, 0x70, 0x06, 0xA0, 0x03, 0x70, 0xA0, 0x02, 0x30, 0x80, 0x60, 0xC1, 0x30, 0x80, 0x60,
+0x0C, 0x0F, 0x00, 0xA1, 0xC1, 0x50, 0x01, 0x32, 0x70, 0x30, 0xB0, 0xD7, 0x23, 0xD2, 0x20, 0xD0,
+0x25, 0xD4, 0xB0, 0x41, 0x20, 0xD3, 0x20, 0xD6, 0x26, 0xD2, 0x40, 0xD3, 0x40, 0xB0, 0xD2, 0x21,
+0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x22, 0xD3, 0xB0, 0x40, 0xD5, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD1,
+0x20, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x40, 0xD1, 0x20, 0x40, 0xD0, 0x21, 0xD3,
+0xE0, 0x81, 0x00, 0x80, 0x30, 0xF0, 0x09, 0xA0, 0x90, 0x50, 0x0C, 0x70, 0x50, 0x70, 0x06, 0xA0,
+0x80, 0x02, 0x50, 0x05, 0xF0, 0x04, 0x50, 0xF0, 0x04, 0x11, 0xE0, 0xA0, 0x80, 0x30, 0xA1, 0xD4,
+0xB0, 0xE0, 0x01, 0x10, 0xC1, 0xA0, 0x80, 0x70, 0x02, 0xA0, 0x10, 0xC0, 0x12, 0xA0, 0xD1, 0xB1,
+0xD1, 0x20, 0xD1, 0x25, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xD2, 0x20, 0xD1, 0x41, 0xD1, 0xB1, 0xD2,
+0x20, 0xD0, 0x23, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD3,
+0x22, 0xD6, 0x21, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x2B, 0xD2,
+0xB0, 0x41, 0xD5, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0xA0, 0x06, 0xA0, 0x04, 0xC0, 0xF0, 0x80, 0x30,
+0xC0, 0x90, 0x70, 0x00, 0xF0, 0x50, 0x80, 0x60, 0xF0, 0x0B, 0x0E, 0x50, 0x30, 0x01, 0xA0, 0x31,
+0xF0, 0x30, 0x00, 0xF0, 0x90, 0xC0, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x25, 0xD3, 0x25, 0xD6, 0xB3,
+0xD8, 0x26, 0xD2, 0xB1, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD9, 0x21, 0xD0, 0x23, 0xD1, 0xB0,
+0x40, 0xB0, 0xD4, 0x20, 0xD1, 0x23, 0xD2, 0x40, 0xB0, 0xD0, 0x20, 0xD3, 0x21, 0xD3, 0x40, 0xB0,
+0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0xE0, 0x30, 0xF1, 0x80, 0x60, 0x90, 0x08, 0xF0, 0xA0,
+0x71, 0x09, 0x70, 0x50, 0x30, 0x90, 0x50, 0x06, 0xF0, 0x03, 0x71, 0x0A, 0x50, 0x05, 0xF0, 0x91,
+0xA0, 0x30, 0x00, 0x50, 0x70, 0x60, 0xE0, 0xD3, 0xA1, 0xC0, 0x40, 0xD1, 0xB0, 0xA0, 0x10, 0xC0,
+0x02, 0x90, 0xC0, 0x60, 0x81, 0x10, 0xE0, 0xD0, 0x40, 0xD6, 0x28, 0xD0, 0xB0, 0x40, 0xD3, 0x20,
+0xD2, 0xB0, 0x40, 0xB1, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD4, 0x24, 0xD0,
+0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD2, 0x20, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0x40,
+0xB0, 0xD1, 0x20, 0xD2, 0x40, 0xD1, 0x2B, 0xD5, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD2,
+0x21, 0xD0, 0x20, 0xD1, 0xE0, 0xA0, 0x05, 0x30, 0x04, 0x80, 0xA0, 0x70, 0x00, 0x50, 0x90, 0x0F,
+0x03, 0x0E, 0x50, 0x60, 0x01, 0xA0, 0x00, 0x30, 0x80, 0x50, 0x01, 0x70, 0xE0, 0xD0, 0x20, 0xD1,
+0x22, 0xD1, 0x2F, 0x04, 0xD3, 0xB1, 0x40, 0xD2, 0x20, 0xD1, 0x23, 0xD0, 0x23, 0xD2, 0x40, 0xD7,
+0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD6, 0x24, 0xD2, 0xB0, 0x40, 0xD2, 0x20, 0xD2, 0x23, 0xD3, 0x40,
+0xB0, 0xD5, 0x22, 0xD1, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xE0, 0xA0, 0x60, 0x30, 0x90,
+0xA0, 0x50, 0xC0, 0x80, 0xA0, 0x06, 0xA0, 0x00, 0x90, 0x09, 0x80, 0x10, 0x50, 0x00, 0x50, 0x03,
+0xF0, 0x50, 0x30, 0x50, 0x80, 0x50, 0x01, 0xF0, 0x70, 0x03, 0x70, 0x90, 0x00, 0x50, 0xA0, 0x70,
+0x00, 0x50, 0x07, 0x70, 0x31, 0x00, 0x50, 0x01, 0x50, 0xE0, 0xD3, 0x60, 0xD2, 0x40, 0xD1, 0x40,
+0xC0, 0xA0, 0x00, 0x70, 0x01, 0x70, 0xA0, 0x30, 0x70, 0xD0, 0x40, 0xB0, 0xD8, 0x22, 0xD0, 0x22,
+0xD0, 0x40, 0xD4, 0x22, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0x40, 0xB0, 0xD4, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD0, 0x22, 0xDE, 0xB0, 0x40, 0x20, 0xD3, 0x21,
+0xD0, 0xB1, 0xD1, 0x2A, 0xD3, 0xB0, 0x40, 0xB0, 0xD8, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40,
+0x60, 0x30, 0x03, 0x30, 0xF0, 0x04, 0x60, 0x02, 0xA0, 0x02, 0x50, 0x30, 0xA0, 0x50, 0x0B, 0x0F,
+0x00, 0x30, 0xC0, 0x10, 0x30, 0x00, 0x30, 0x11, 0x60, 0x50, 0xA0, 0xB0, 0xD0, 0x20, 0xD3, 0x23,
+0xD0, 0x2F, 0x04, 0xD4, 0x41, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD3, 0x21, 0xD0, 0x40, 0xD3, 0x22,
+0xD0, 0x20, 0xD1, 0x41, 0xD7, 0x20, 0xD1, 0x24, 0xD2, 0xB0, 0x40, 0x20, 0xD4, 0x21, 0xD1, 0x20,
+0xD3, 0x41, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD4, 0x20, 0xD1, 0x20, 0xD1, 0xE0, 0x80,
+0x10, 0x90, 0x10, 0x30, 0x70, 0x60, 0x80, 0x10, 0x70, 0x05, 0x90, 0x50, 0xF0, 0x50, 0x09, 0x80,
+0x70, 0x00, 0xF0, 0x50, 0x02, 0x11, 0xA0, 0x90, 0x11, 0x80, 0x01, 0x90, 0x01, 0xF0, 0x30, 0x90,
+0x30, 0x11, 0xA0, 0x50, 0xF0, 0x50, 0x07, 0xA0, 0x50, 0xA0, 0xF0, 0x70, 0x00, 0xC0, 0x80, 0x60,
+0xC0, 0xE0, 0xD1, 0x40, 0x10, 0x40, 0xD0, 0x40, 0xD3, 0x11, 0xC0, 0xA0, 0x80, 0xE0, 0x80, 0x10,
+0x60, 0xC0, 0x40, 0xD0, 0x20, 0xD4, 0x20, 0xD2, 0x22, 0xD2, 0x40, 0xD4, 0x23, 0xD2, 0xB1, 0xD1,
+0x23, 0xD2, 0xB0, 0x40, 0xD2, 0x20, 0xD1, 0x23, 0xD4, 0x41, 0xD1, 0x25, 0xD0, 0x22, 0xD6, 0xB0,
+0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xD2, 0x28, 0xD2, 0xB0, 0x40, 0xB0, 0xD9, 0x25,
+0xD1, 0x22, 0xD2, 0xE0, 0x80, 0x02, 0x80, 0x70, 0x04, 0x60, 0x90, 0x30, 0x11, 0x00, 0x70, 0x10,
+0xA0, 0x90, 0x70, 0x60, 0x70, 0x0A, 0x0D, 0xF0, 0xA0, 0x30, 0xF0, 0x01, 0xC0, 0x31, 0xE0, 0x11,
+0x60, 0xD4, 0x21, 0xD0, 0x23, 0xD2, 0x20, 0xD2, 0x21, 0xD1, 0x24, 0xDA, 0xB0, 0x40, 0xB0, 0xD3,
+0x20, 0xD1, 0x24, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD4, 0x40, 0xB0, 0xD2, 0x22, 0xD0, 0x22, 0xD2,
+0x21, 0xD3, 0x40, 0xB0, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD2,
+0x20, 0xD3, 0x40, 0xD1, 0x21, 0xD5, 0x20, 0xD1, 0xC0, 0xA0, 0x60, 0xC0, 0x80, 0xC0, 0x70, 0xF0,
+0x10, 0x80, 0x30, 0x50, 0x03, 0x60, 0x70, 0x00, 0x50, 0xF0, 0x0A, 0x90, 0x00, 0x50, 0x07, 0x50,
+0x80, 0x01, 0x90, 0x08, 0xF0, 0x10, 0xC0, 0x60, 0xA0, 0xF0, 0x01, 0x50, 0x10, 0x60, 0xE0, 0xB0,
+0xA0, 0x90, 0xF0, 0x90, 0xE0, 0x60, 0xE2, 0xD0, 0xE0, 0x10, 0xE0, 0xD0, 0xB1, 0x40, 0xB0, 0xD2,
+0x40, 0xD0, 0xB0, 0x40, 0xB0, 0xD0, 0xB1, 0xA0, 0xB0, 0xD1, 0x21, 0xD0, 0x25, 0xD4, 0x40, 0xB0,
+0xD3, 0x24, 0xD3, 0xB0, 0x40, 0xD0, 0x22, 0xD2, 0xB0, 0x40, 0xD2, 0x21, 0xD2, 0x23, 0xD2, 0x40,
+0x20, 0xD7, 0x27, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0xB0, 0x40, 0xD2, 0x21,
+0xD0, 0x21, 0xD3, 0x41, 0xB0, 0xD4, 0x21, 0xD1, 0x24, 0xD3, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1,
+0xA0, 0x02, 0x70, 0xA0, 0xF0, 0x03, 0x90, 0x11, 0x60, 0x80, 0x30, 0x60, 0xF0, 0x02, 0x80, 0x90,
+0x0A, 0x0D, 0xA0, 0x50, 0x80, 0xA0, 0x01, 0xF0, 0x90, 0x70, 0x01, 0x30, 0xE0, 0xB0, 0x40, 0xB0,
+0x20, 0xD2, 0x21, 0xD0, 0x22, 0xDA, 0x24, 0xD4, 0x24, 0xD1, 0xB0, 0x40, 0xB0, 0xD5, 0x21, 0xD0,
+0x40, 0xD4, 0x22, 0xD6, 0xB0, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0x21, 0xD5, 0x20, 0xD1, 0xB0, 0x40,
+0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0x20, 0xD0,
+0x20, 0xD2, 0x40, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0x20, 0xD1, 0xB0, 0x11, 0x30, 0x80, 0x30, 0x04,
+0xF0, 0x80, 0x30, 0x70, 0x01, 0x50, 0xA0, 0x30, 0x80, 0x50, 0x0A, 0xC0, 0x30, 0x50, 0xF0, 0x01,
+0x70, 0x50, 0xF0, 0x00, 0x70, 0xA0, 0x02, 0x50, 0x02, 0x71, 0x04, 0xF0, 0x90, 0x50, 0x60, 0xC0,
+0x10, 0x80, 0x30, 0xE0, 0xB0, 0xD0, 0xA0, 0x60, 0xA0, 0x70, 0x60, 0xD1, 0xB0, 0x40, 0xD2, 0x40,
+0xB0, 0xD0, 0x40, 0x70, 0xA0, 0xC0, 0xE0, 0xB0, 0xD5, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x27,
+0xD4, 0xB1, 0xD0, 0x21, 0xD2, 0x22, 0xD2, 0x21, 0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0xB1, 0xD2, 0x22,
+0xD2, 0x22, 0xD1, 0xB0, 0x40, 0xD1, 0x22, 0xD4, 0x26, 0xD0, 0x20, 0x40, 0xB0, 0xD2, 0x20, 0xD1,
+0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x41, 0xD2, 0x23, 0xD0, 0x28,
+0xD4, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0xE0, 0x50, 0x02, 0xF0, 0xA0, 0xF0, 0x00, 0x50, 0x90,
+0x30, 0xC0, 0x70, 0x01, 0x60, 0x30, 0x01, 0xF0, 0x80, 0xC0, 0x0B, 0x0C, 0x70, 0xA0, 0x01, 0xA0,
+0x50, 0x00, 0x61, 0xF0, 0x01, 0xA0, 0xB0, 0xD0, 0x20, 0xB0, 0x41, 0xB0, 0xD2, 0x20, 0xD1, 0x23,
+0xD8, 0x27, 0xD3, 0x20, 0xD3, 0x20, 0xB0, 0x40, 0xB0, 0xD5, 0x20, 0x40, 0xD1, 0x20, 0xD1, 0x20,
+0xD0, 0x20, 0xD3, 0x20, 0xD3, 0xB0, 0x40, 0x20, 0xD2, 0x22, 0xD7, 0x20, 0xD2, 0x40, 0xB0, 0xD4,
+0x24, 0xD3, 0x40, 0xB0, 0xD2, 0x40, 0xD3, 0x22, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0xB0, 0x11, 0xC0,
+0xA0, 0x10, 0x70, 0x05, 0xF0, 0x80, 0xA0, 0x50, 0x01, 0x70, 0xA0, 0x71, 0x09, 0x50, 0x10, 0xA0,
+0x70, 0x00, 0x90, 0x12, 0x90, 0x10, 0x50, 0x01, 0x90, 0xA0, 0xF0, 0x00, 0x90, 0x10, 0x60, 0x05,
+0x50, 0x02, 0x90, 0xA0, 0x60, 0xD4, 0xE0, 0x60, 0x40, 0xD0, 0xA0, 0x60, 0xB0, 0xD2, 0xB0, 0xC0,
+0x30, 0xA0, 0xC0, 0x10, 0xF0, 0x50, 0x10, 0x60, 0xD6, 0x40, 0xD0, 0xB0, 0xC0, 0xD2, 0x25, 0xD3,
+0xB1, 0xD0, 0x20, 0xD0, 0x25, 0xD2, 0x23, 0xD0, 0x40, 0xB0, 0xD2, 0x40, 0xB0, 0xD3, 0x22, 0xD0,
+0x21, 0xD3, 0x40, 0xB0, 0xD3, 0x22, 0xD2, 0x25, 0xD1, 0xB0, 0x40, 0x20, 0xD1, 0x23, 0xD1, 0x21,
+0xD0, 0x20, 0xD3, 0x20, 0x40, 0xD6, 0x41, 0x20, 0xD3, 0x21, 0xD1, 0x29, 0xD3, 0x21, 0xD1, 0x22,
+0xD1, 0xB0, 0x30, 0x03, 0x50, 0x60, 0x80, 0xA0, 0x30, 0x70, 0xA0, 0x50, 0x01, 0x30, 0xC0, 0xA0,
+0x60, 0x10, 0x30, 0x00, 0x50, 0xF0, 0x09, 0x0D, 0x60, 0x90, 0x00, 0x50, 0x30, 0x50, 0x60, 0xE0,
+0x80, 0xA0, 0xE0, 0xA0, 0xD0, 0x20, 0xD3, 0xB0, 0x41, 0xB0, 0xD2, 0x20, 0xD1, 0x22, 0xD1, 0x20,
+0xD4, 0x27, 0xD1, 0x22, 0xD0, 0x22, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x40, 0x21, 0xD0, 0x20, 0xD2,
+0x20, 0xD3, 0x23, 0xD3, 0x41, 0xD2, 0x22, 0xD2, 0x22, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40,
+0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD2, 0x40, 0xB0, 0xD0, 0x40, 0xD2, 0x24, 0xD0, 0x21, 0xD1,
+0x20, 0xD0, 0x40, 0x11, 0xC1, 0x30, 0xF0, 0x08, 0x90, 0xA0, 0x80, 0x00, 0xA0, 0x00, 0x90, 0x03,
+0x10, 0xC0, 0x10, 0xF0, 0x00, 0xF0, 0xA1, 0xE0, 0x31, 0x10, 0xC0, 0x10, 0x51, 0x00, 0x90, 0x10,
+0x01, 0x71, 0x00, 0xC0, 0x10, 0x70, 0x31, 0x03, 0x50, 0xF0, 0x00, 0x10, 0x30, 0xF0, 0xA0, 0xD1,
+0x20, 0xD1, 0x40, 0xD1, 0x60, 0xD0, 0xE0, 0xB0, 0xD0, 0xE0, 0xA0, 0xB0, 0x80, 0x70, 0xF0, 0x04,
+0xA0, 0xC0, 0x40, 0xE0, 0xA0, 0xD1, 0x40, 0xB0, 0xD0, 0xB0, 0x10, 0xC0, 0xD2, 0x20, 0xD2, 0x21,
+0xD1, 0xB0, 0x40, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD2, 0x22, 0xD2, 0x40, 0xB0, 0xD0, 0x40,
+0xD3, 0x21, 0xD0, 0x22, 0xD3, 0xB0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD8, 0xB0, 0x40,
+0xB0, 0xD4, 0x24, 0xD0, 0x21, 0xD3, 0x20, 0xD0, 0x40, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x22,
+0xD0, 0x2F, 0x03, 0xD7, 0x60, 0x00, 0x50, 0x90, 0x70, 0x30, 0x70, 0xA0, 0x90, 0x01, 0x70, 0x60,
+0x30, 0xA0, 0x81, 0x71, 0x01, 0x80, 0x50, 0x30, 0x09, 0x0E, 0xF0, 0x01, 0x61, 0x30, 0xF0, 0x01,
+0xE0, 0x40, 0xD8, 0xB0, 0x40, 0xB0, 0xD4, 0x22, 0xD0, 0x24, 0xD2, 0x24, 0xD2, 0x23, 0xD3, 0x20,
+0xD1, 0xB0, 0x40, 0xB0, 0xD0, 0xB0, 0x40, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x24, 0xD0, 0x22, 0xD0,
+0x20, 0xD1, 0x40, 0xB0, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0x26, 0xD1, 0x40, 0xB0, 0xD0, 0x20, 0xD0,
+0x22, 0xD1, 0x21, 0xD2, 0x41, 0xD1, 0x20, 0xD3, 0x23, 0xD4, 0xA0, 0x11, 0x60, 0x10, 0xC0, 0x70,
+0x0A, 0x70, 0xA0, 0xC0, 0x50, 0x71, 0x05, 0x10, 0xC0, 0x60, 0xB0, 0xD1, 0x40, 0x10, 0x60, 0x01,
+0xC0, 0x50, 0x00, 0xF0, 0x10, 0x90, 0x00, 0xF0, 0x50, 0x00, 0x70, 0x30, 0x81, 0x70, 0x10, 0xA0,
+0x01, 0x70, 0x01, 0x70, 0x10, 0xC0, 0xB0, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x60, 0xE1, 0xD1, 0xA0,
+0xE0, 0xB0, 0xA0, 0x50, 0x06, 0x50, 0x91, 0xC0, 0xD0, 0xA0, 0xE0, 0xD1, 0xB0, 0x10, 0xC1, 0x40,
+0xD1, 0x20, 0xD4, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x27, 0xD0, 0x21, 0xD0, 0x21, 0xD2, 0x41, 0xD3,
+0x20, 0xD1, 0x23, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x26, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x20,
+0xD1, 0x28, 0xD2, 0x20, 0xD2, 0xB1, 0xD0, 0xB0, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x21, 0xD1, 0x25,
+0xD4, 0x26, 0xD1, 0x20, 0xD3, 0xB0, 0xE0, 0x50, 0xF0, 0x01, 0xA0, 0x01, 0x30, 0x80, 0x01, 0xC0,
+0x02, 0xA0, 0x03, 0x90, 0x80, 0xE0, 0x09, 0x0F, 0x02, 0x50, 0x60, 0x30, 0x02, 0xA0, 0xD1, 0x20,
+0xD2, 0x22, 0xD2, 0xB1, 0x40, 0xB0, 0x20, 0xD1, 0x27, 0xD6, 0x26, 0xD3, 0x23, 0xD1, 0xB0, 0x41,
+0xB0, 0xD5, 0x20, 0xD0, 0x29, 0xD4, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0x24, 0xD2,
+0xB0, 0x40, 0xD1, 0x22, 0xD3, 0x20, 0xD1, 0xB0, 0x41, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x21, 0xD1,
+0xE0, 0x60, 0x10, 0xC2, 0x50, 0xF0, 0x0B, 0x70, 0x90, 0xA0, 0x80, 0x70, 0x03, 0x51, 0xC0, 0x80,
+0x90, 0x40, 0x60, 0xA0, 0x80, 0x01, 0xA0, 0x10, 0x02, 0x71, 0x01, 0x50, 0x02, 0xC0, 0x10, 0x00,
+0x90, 0x80, 0x01, 0x30, 0x70, 0x00, 0x10, 0x60, 0xD1, 0x22, 0xD0, 0xB1, 0xD1, 0xB0, 0x40, 0xD2,
+0xE0, 0xC0, 0x70, 0x40, 0x80, 0x04, 0xF0, 0x03, 0x80, 0x41, 0xB0, 0xD1, 0xB0, 0x10, 0xC0, 0xA0,
+0x10, 0xE0, 0xD6, 0x40, 0xD1, 0x29, 0xD1, 0x21, 0xD4, 0xB0, 0x41, 0xD2, 0x20, 0xD0, 0x20, 0xD2,
+0x20, 0xD1, 0xB0, 0x40, 0x20, 0xD2, 0x23, 0xD2, 0x23, 0xD2, 0xB0, 0x40, 0xD2, 0x22, 0xD0, 0x21,
+0xD0, 0x21, 0xD0, 0x21, 0xD8, 0x41, 0xB0, 0xD4, 0x20, 0xD0, 0x21, 0xD0, 0x26, 0xD7, 0x23, 0xD5,
+0xB0, 0x41, 0xD0, 0xA0, 0x02, 0x80, 0x70, 0x02, 0x81, 0x00, 0x30, 0x90, 0x01, 0x80, 0x50, 0x03,
+0x70, 0x0A, 0x0F, 0x04, 0xC0, 0xA0, 0x90, 0xF0, 0xA0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD3,
+0xB0, 0x41, 0xB0, 0xD2, 0x21, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x24, 0xD6, 0x23, 0xD2, 0x40, 0xB0,
+0x40, 0xD2, 0x24, 0xD0, 0x21, 0xD1, 0x23, 0xD6, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x25, 0xD4,
+0xB0, 0x40, 0x20, 0xD4, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD0, 0xB0, 0x40, 0xD3, 0x21, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xE0, 0x12, 0x60, 0x30, 0x00, 0x90, 0xF0, 0x0D, 0x70, 0x30,
+0xA0, 0x80, 0x00, 0x70, 0xC0, 0x00, 0xF0, 0x81, 0x30, 0x70, 0x00, 0x50, 0x01, 0x70, 0x50, 0x03,
+0xC0, 0x30, 0x00, 0x90, 0x02, 0x70, 0x50, 0x03, 0xF0, 0x60, 0x00, 0x90, 0x10, 0xD3, 0x21, 0xD0,
+0x40, 0xDA, 0x90, 0x30, 0x02, 0x30, 0x60, 0x10, 0x02, 0x80, 0xC0, 0x60, 0xB0, 0xD0, 0x20, 0xD1,
+0xC0, 0x80, 0x12, 0xE0, 0xD4, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x25, 0xD1, 0x22, 0xD2, 0xB0, 0x40,
+0xD0, 0xB0, 0x40, 0xD1, 0x23, 0xD3, 0x41, 0xD5, 0x24, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD2,
+0x20, 0xD4, 0x21, 0xD0, 0x23, 0xD0, 0x22, 0xD2, 0x42, 0xB0, 0xD2, 0x25, 0xD2, 0x21, 0xD0, 0x21,
+0xD0, 0x21, 0xD2, 0x20, 0xD3, 0x21, 0xD3, 0x41, 0xB0, 0x20, 0xD1, 0xE0, 0x70, 0x00, 0x70, 0x30,
+0x04, 0xC0, 0x00, 0x70, 0xA0, 0x70, 0x30, 0xA0, 0x30, 0x0F, 0x00, 0x0F, 0x03, 0x80, 0x70, 0x00,
+0x50, 0xC0, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x24, 0xD4, 0xB0, 0x41, 0xB0, 0xD5, 0x21, 0xD2,
+0x20, 0xD1, 0x21, 0xD3, 0x20, 0xD2, 0x24, 0xD0, 0xB1, 0xD1, 0x41, 0xB0, 0xD1, 0x21, 0xD0, 0x21,
+0xD3, 0x22, 0xD2, 0x21, 0xD3, 0x41, 0xD4, 0x23, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1,
+0x20, 0xD3, 0x20, 0x40, 0xD3, 0x40, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0xE0, 0x12,
+0xC0, 0x30, 0x01, 0x90, 0x0E, 0x50, 0x80, 0x70, 0x31, 0x80, 0x70, 0x30, 0x80, 0x01, 0x90, 0x00,
+0xF0, 0x50, 0x05, 0x50, 0x60, 0x01, 0x50, 0x05, 0x90, 0x10, 0x01, 0x70, 0x00, 0x60, 0xB0, 0xD1,
+0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD6, 0x20, 0xD2, 0xA0, 0x10, 0xF0, 0x01, 0x50, 0x80, 0x70, 0x02,
+0x50, 0xF0, 0x30, 0x40, 0xD2, 0xB0, 0x10, 0x01, 0x60, 0x30, 0x10, 0x60, 0xE0, 0xD1, 0x40, 0xB0,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD2,
+0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD1, 0x23, 0xD0, 0x23, 0xD4, 0xB0, 0x40,
+0xB0, 0xD7, 0x25, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0x41, 0xB0, 0xD1, 0x40, 0xD1, 0x20, 0xD0,
+0x25, 0xD3, 0x20, 0xD2, 0x20, 0xD1, 0x20, 0xD7, 0x20, 0xB0, 0x41, 0xD3, 0x20, 0xD0, 0x40, 0x80,
+0x00, 0xA0, 0xF0, 0x03, 0x80, 0x50, 0x01, 0x10, 0x90, 0xF0, 0x00, 0xA0, 0x0F, 0x00, 0x0F, 0x03,
+0xA0, 0x02, 0xA0, 0xD1, 0x23, 0xD5, 0x22, 0xD6, 0xB0, 0x41, 0xB0, 0xD5, 0x20, 0xD1, 0x24, 0xD1,
+0x25, 0xD0, 0x21, 0xD1, 0x40, 0xD4, 0xB0, 0x40, 0xB0, 0xD3, 0x24, 0xD0, 0x26, 0xD2, 0x20, 0xD0,
+0x20, 0x40, 0xB0, 0xD6, 0x23, 0xD4, 0xB0, 0x40, 0xD1, 0x20, 0xD2, 0x40, 0x20, 0xD1, 0x20, 0xD1,
+0x40, 0xB0, 0xD5, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0x12, 0xC0, 0xA0, 0x02, 0x90, 0x0D, 0x90, 0x80,
+0x02, 0xF0, 0x90, 0x60, 0xA0, 0x90, 0x50, 0x02, 0x50, 0x07, 0x80, 0x50, 0x70, 0xF0, 0x70, 0xA0,
+0x03, 0x10, 0xF0, 0x00, 0x50, 0x70, 0xA0, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x24, 0xD2, 0xB1, 0xE1,
+0x08, 0xF0, 0x90, 0x10, 0xE0, 0xB0, 0x70, 0xE0, 0x10, 0x80, 0x00, 0x60, 0x70, 0x80, 0xE0, 0x10,
+0x40, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD4, 0x20, 0x40,
+0x20, 0xD4, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD4, 0x23, 0xD1, 0x20, 0xD0,
+0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD5, 0x22, 0xD2, 0x21, 0xD0, 0x21, 0xD1, 0xB0, 0x41,
+0xD4, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD4, 0x24, 0xD1, 0x20, 0xD3, 0xB0, 0x41, 0xB0, 0xD4, 0x21,
+0xD0, 0x40, 0x90, 0x50, 0x80, 0x04, 0xA0, 0x02, 0x30, 0x70, 0x01, 0x80, 0xF0, 0x0E, 0x0F, 0x02,
+0xF0, 0xC0, 0x50, 0x00, 0xF0, 0xA0, 0xD0, 0x20, 0xD0, 0x23, 0xD6, 0x25, 0xD3, 0xB1, 0x40, 0xB0,
+0xD4, 0x26, 0xD1, 0x24, 0xD1, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0,
+0xD4, 0x21, 0xD0, 0x24, 0xD5, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x22, 0xD7, 0x40,
+0xB0, 0xD2, 0x40, 0xB0, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x41, 0xDA, 0xC0, 0x60, 0x11, 0x30, 0x90,
+0x01, 0x70, 0x50, 0x0C, 0xA0, 0x71, 0x04, 0xF0, 0x70, 0x90, 0x30, 0xA0, 0x90, 0x80, 0x70, 0x06,
+0x10, 0xC0, 0x00, 0x70, 0x10, 0xA0, 0x00, 0x50, 0x80, 0x00, 0x50, 0xF0, 0x00, 0x70, 0xE0, 0x40,
+0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x25, 0xD1, 0x40, 0xD1, 0xC0, 0x70, 0x07, 0x51, 0x10, 0x90, 0x61,
+0xA0, 0xF1, 0x00, 0x70, 0xA0, 0x90, 0x00, 0xA0, 0xC0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x20,
+0xD0, 0x21, 0xD6, 0x40, 0x20, 0xD1, 0x22, 0xD1, 0x40, 0xD2, 0x20, 0x40, 0xB0, 0xD4, 0x24, 0xD5,
+0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD3, 0x23, 0xD2, 0x20, 0xD2, 0xB0, 0x41, 0xD2, 0x20, 0xD0,
+0x20, 0xD1, 0x40, 0xD3, 0x25, 0xD2, 0x22, 0xD4, 0x60, 0xA0, 0xD0, 0xB1, 0x40, 0xB0, 0xD5, 0x20,
+0xB0, 0xD0, 0x20, 0xD0, 0xE0, 0x70, 0xA0, 0x04, 0x80, 0x50, 0x02, 0x50, 0x30, 0x00, 0x70, 0x30,
+0x80, 0x0E, 0x0F, 0x02, 0x50, 0x80, 0x90, 0x30, 0x60, 0xE0, 0xD1, 0x24, 0xD9, 0x21, 0xD7, 0xB1,
+0x40, 0xB0, 0xD4, 0x29, 0xD3, 0x20, 0xD0, 0x40, 0xD3, 0x22, 0xD2, 0xB0, 0x41, 0xD2, 0x20, 0xD0,
+0x25, 0xD1, 0x23, 0xD4, 0xB0, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD2, 0x20, 0xD2, 0xB0, 0x40, 0xD0,
+0xB1, 0xD0, 0x24, 0xD2, 0xB0, 0x40, 0xD6, 0x20, 0xD0, 0x40, 0x10, 0xC0, 0x11, 0xC0, 0xA0, 0x02,
+0x50, 0x70, 0x0A, 0x70, 0x80, 0x00, 0x90, 0x09, 0x70, 0x90, 0x31, 0xA0, 0x30, 0x90, 0x70, 0x01,
+0x30, 0x90, 0x00, 0xC0, 0x70, 0x00, 0x70, 0x10, 0x70, 0x03, 0x50, 0x60, 0xD1, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD1, 0x10, 0x90, 0x06,
+0x71, 0xF0, 0x90, 0x00, 0x80, 0x10, 0x90, 0x04, 0xA0, 0x00, 0x70, 0x30, 0x10, 0xB0, 0xD1, 0x20,
+0xD2, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD3, 0x23, 0xD0, 0x20, 0x40, 0xD0, 0xB0,
+0x40, 0xD0, 0x20, 0xD1, 0x22, 0xD2, 0x22, 0xD2, 0xB0, 0x40, 0x20, 0xD4, 0x21, 0xD0, 0x21, 0xD2,
+0x22, 0xD4, 0xB0, 0x41, 0xD3, 0x22, 0xD2, 0x40, 0x20, 0xD2, 0x26, 0xD0, 0x24, 0xD3, 0xE0, 0x41,
+0xB0, 0x20, 0xD4, 0x21, 0xD0, 0xB0, 0x10, 0xD2, 0xA0, 0x90, 0x50, 0x03, 0x70, 0x30, 0x04, 0x10,
+0x30, 0x80, 0x70, 0xA0, 0x0E, 0x0F, 0x02, 0x30, 0x02, 0xE0, 0xD2, 0x25, 0xD7, 0x25, 0xD7, 0xB0,
+0x41, 0xB0, 0xD4, 0x26, 0xD4, 0x20, 0xB0, 0xD2, 0x24, 0xD4, 0x41, 0xD3, 0x20, 0xD1, 0x21, 0xD0,
+0x21, 0xD4, 0x20, 0xD3, 0x41, 0xD6, 0x22, 0xD1, 0x20, 0xD1, 0xB0, 0x41, 0xD2, 0x22, 0xD4, 0xB0,
+0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x13, 0xA0, 0x30, 0x50, 0x02, 0x50, 0x70,
+0x09, 0x30, 0x70, 0x00, 0x70, 0x50, 0x09, 0x70, 0x31, 0x01, 0x50, 0x90, 0x33, 0xA0, 0xC0, 0x30,
+0x90, 0x30, 0x10, 0xF0, 0x70, 0xF1, 0x00, 0x90, 0xE0, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD2,
+0x21, 0xD0, 0x20, 0xD1, 0xE0, 0xB0, 0xD1, 0x60, 0x07, 0x90, 0x02, 0xF0, 0x10, 0xF0, 0x05, 0x30,
+0x00, 0x90, 0xA0, 0x10, 0xA0, 0xB0, 0xD5, 0x20, 0xD3, 0x21, 0xD1, 0xB0, 0x40, 0xD3, 0x25, 0xD0,
+0xB0, 0x40, 0xB0, 0xD2, 0x24, 0xD1, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD4, 0x22, 0xD1,
+0x21, 0xD4, 0xB0, 0x40, 0xB0, 0xD3, 0x25, 0xD2, 0x40, 0xD5, 0x27, 0xD3, 0xB0, 0x40, 0xB0, 0xD3,
+0x23, 0xD0, 0x23, 0xC0, 0xD1, 0x40, 0xE0, 0x30, 0x04, 0x30, 0xF0, 0x04, 0xA0, 0xF0, 0x01, 0x30,
+0xF0, 0x0D, 0x0F, 0x01, 0xF0, 0xA0, 0x01, 0xF0, 0xA0, 0xD1, 0x23, 0xD3, 0x27, 0xD2, 0x26, 0xD5,
+0xB0, 0x40, 0xB1, 0xD4, 0x24, 0xD3, 0x40, 0x20, 0xD2, 0x21, 0xD1, 0x23, 0xD2, 0x20, 0x41, 0xB0,
+0xD4, 0x25, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x26, 0xD3, 0x40, 0xD3, 0x20,
+0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x13, 0x80, 0x10,
+0x04, 0x50, 0xF0, 0x00, 0x50, 0x06, 0xA0, 0x02, 0x90, 0xF0, 0x05, 0x80, 0x00, 0x50, 0x10, 0xA1,
+0x11, 0x80, 0x70, 0x04, 0x80, 0xF0, 0x50, 0x10, 0x60, 0x90, 0x81, 0x31, 0xA0, 0x40, 0xD4, 0x20,
+0xD1, 0x40, 0xD1, 0x22, 0xD4, 0x40, 0xD1, 0xE0, 0x90, 0x06, 0x50, 0xF0, 0x02, 0xF1, 0x06, 0x30,
+0x90, 0x01, 0x50, 0x60, 0x10, 0x60, 0xB0, 0xE0, 0xD0, 0xE0, 0x40, 0xD1, 0x22, 0xD2, 0x40, 0xB0,
+0xD3, 0x20, 0xD0, 0x21, 0xD4, 0x40, 0xD3, 0x25, 0xD4, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x24, 0xD0,
+0x25, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD8, 0x40, 0xD1, 0x20, 0xDB, 0xB0, 0x41,
+0xB0, 0xD3, 0x20, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0xA0, 0xC0, 0xD0, 0xB0, 0xC0, 0x04, 0x91, 0x05,
+0x90, 0x30, 0x01, 0x91, 0x0D, 0x0F, 0x01, 0x50, 0xA1, 0x81, 0xE0, 0xD1, 0x22, 0xD4, 0x26, 0xD0,
+0x21, 0xD4, 0x20, 0xD1, 0x21, 0xD5, 0xB1, 0x40, 0xB0, 0xD4, 0x22, 0xD3, 0x40, 0xD1, 0x20, 0xD2,
+0x24, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xD3, 0x21, 0xD0, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD2, 0xB2, 0xD1, 0x24, 0xD3, 0xB1, 0xD4, 0x21, 0xD0, 0x22, 0xD3, 0x40, 0xB0, 0xD3, 0x20, 0xB0,
+0x50, 0x30, 0xA0, 0x12, 0x05, 0x90, 0x00, 0x10, 0x05, 0x50, 0x90, 0x02, 0xF0, 0x50, 0x04, 0xF0,
+0x10, 0x30, 0x11, 0xF0, 0x90, 0x71, 0x90, 0xA0, 0x10, 0x90, 0x02, 0x80, 0x01, 0x71, 0x04, 0x90,
+0x40, 0xD2, 0x20, 0xD3, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0xB1, 0xD1, 0xE0, 0x30, 0xF0, 0x04,
+0x70, 0x50, 0x0C, 0x50, 0xC0, 0x30, 0x02, 0xF0, 0xC0, 0x11, 0x61, 0xC0, 0xE0, 0xD5, 0x40, 0xB0,
+0xD2, 0x23, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0xB0,
+0x40, 0xD5, 0x24, 0xD0, 0x25, 0xD1, 0x20, 0xB0, 0x40, 0xB0, 0xD1, 0x24, 0xD1, 0x20, 0xD4, 0x40,
+0x21, 0xB0, 0xDA, 0xB0, 0x41, 0xB0, 0xD4, 0x20, 0xD0, 0x24, 0xD0, 0x23, 0xD1, 0x10, 0xB0, 0xD0,
+0x60, 0x04, 0xA0, 0x07, 0xC0, 0x90, 0xA0, 0x80, 0xA0, 0x0D, 0x0F, 0x01, 0x80, 0x70, 0x00, 0xF0,
+0x60, 0xB0, 0xD2, 0x26, 0xD2, 0x25, 0xD6, 0x26, 0xD5, 0xB0, 0x41, 0xB0, 0xD7, 0xB1, 0x22, 0xD1,
+0x20, 0xD0, 0x28, 0xD3, 0x41, 0xB0, 0xD2, 0x22, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0x20,
+0xB0, 0x40, 0xD1, 0x24, 0xD1, 0x20, 0x40, 0xD1, 0x25, 0xD1, 0x20, 0xD5, 0x40, 0xB0, 0xD2, 0xE0,
+0x10, 0xE0, 0x70, 0xE0, 0x10, 0xC0, 0xF0, 0x06, 0x50, 0x10, 0xF0, 0x04, 0x30, 0x04, 0x50, 0xF0,
+0x04, 0x30, 0xF0, 0x90, 0x30, 0x00, 0x50, 0x02, 0xF0, 0x70, 0x03, 0x30, 0xF0, 0x07, 0x90, 0x40,
+0xD3, 0x20, 0xD2, 0x40, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0x20, 0xD2, 0x40, 0x60, 0x80, 0x03,
+0x90, 0x0C, 0x70, 0x50, 0xF0, 0xA0, 0x90, 0x02, 0x50, 0x81, 0x01, 0x10, 0x60, 0xE0, 0x60, 0xA0,
+0xD1, 0x40, 0x20, 0xD3, 0x20, 0xD0, 0x22, 0xD4, 0x20, 0xD0, 0xB1, 0xD1, 0x24, 0xD1, 0xB0, 0x40,
+0xB0, 0xD5, 0x22, 0xD2, 0x23, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x26, 0xD1, 0xB0, 0x20, 0xD1, 0xE0,
+0x10, 0x20, 0xD0, 0x40, 0xD3, 0x20, 0xD2, 0xB1, 0x40, 0xB0, 0x20, 0xD6, 0x20, 0xD0, 0x24, 0xD1,
+0x22, 0xD1, 0xC0, 0xD1, 0x40, 0xE0, 0x02, 0xF0, 0x60, 0x07, 0xC0, 0x90, 0x01, 0x30, 0xF0, 0x0C,
+0x0F, 0x01, 0x30, 0x02, 0x60, 0xD1, 0x26, 0xD0, 0x29, 0xD6, 0x26, 0xD1, 0x20, 0xD5, 0xB0, 0x41,
+0xB0, 0xD4, 0x40, 0xD0, 0x21, 0xD5, 0x22, 0xD0, 0x26, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD2,
+0x20, 0xD0, 0x26, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD3, 0x40, 0x20, 0xD2, 0x25, 0xD2, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD1, 0xC0, 0x11, 0x40, 0xA0, 0x10, 0x50, 0x08, 0x60, 0x11,
+0x90, 0x02, 0xA0, 0x05, 0x90, 0x07, 0x30, 0x00, 0x71, 0x04, 0x80, 0x30, 0x70, 0x30, 0x50, 0x07,
+0x50, 0x61, 0xE0, 0xD1, 0x20, 0xD2, 0x40, 0xD0, 0x20, 0xD2, 0x21, 0xD1, 0x40, 0xD0, 0x20, 0xD3,
+0xE0, 0x90, 0x01, 0xC0, 0x50, 0x06, 0x10, 0x03, 0x70, 0x50, 0x02, 0x60, 0x05, 0xF0, 0x10, 0xC0,
+0x00, 0x10, 0x80, 0x90, 0x60, 0xB0, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x21, 0xD3, 0x20, 0xD2, 0x40,
+0x20, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1,
+0x21, 0xD1, 0x20, 0x41, 0xB0, 0xD2, 0x26, 0xD1, 0x20, 0xD0, 0xC0, 0x40, 0xD1, 0x40, 0xB0, 0xD1,
+0xB1, 0xD3, 0x20, 0xB0, 0x41, 0xB0, 0xD3, 0x21, 0xD2, 0x27, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB0,
+0xD2, 0x60, 0x03, 0x70, 0xA0, 0x06, 0x80, 0x50, 0x01, 0x90, 0x50, 0x0C, 0x0F, 0x00, 0xF0, 0xC0,
+0x80, 0x50, 0x70, 0xE0, 0xD5, 0x21, 0xD1, 0x2F, 0x00, 0xD2, 0x25, 0xD2, 0x21, 0xD4, 0x20, 0xB0,
+0x40, 0xB1, 0xD0, 0xB1, 0xD1, 0x21, 0xD1, 0x22, 0xD2, 0x20, 0xD0, 0x27, 0xD2, 0xB0, 0x40, 0xB0,
+0xD3, 0x23, 0xD1, 0x25, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0xB1, 0xD6, 0x26, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0xB0, 0x40, 0xD0, 0x10, 0x60, 0x40, 0x70, 0x11, 0x90, 0x08, 0x50, 0x80, 0x00, 0x70, 0x01,
+0x91, 0x05, 0x71, 0x05, 0x50, 0x90, 0x01, 0x50, 0x04, 0x30, 0xC0, 0x50, 0x30, 0x50, 0x07, 0x70,
+0x10, 0x50, 0xA0, 0xD2, 0x21, 0xB1, 0x21, 0xD0, 0x22, 0xD1, 0xB1, 0xD1, 0x40, 0xB0, 0xD2, 0x60,
+0xF0, 0xA0, 0x30, 0x07, 0x91, 0x01, 0xF0, 0x50, 0x03, 0x60, 0x05, 0x30, 0x10, 0x01, 0xF0, 0x00,
+0x70, 0xA0, 0x40, 0xD1, 0x24, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD4, 0x40, 0xB0,
+0xD2, 0x22, 0xD1, 0x20, 0xD0, 0x26, 0xD1, 0xB0, 0x41, 0xD3, 0x20, 0xD0, 0x23, 0xD2, 0x20, 0xD4,
+0x20, 0xD5, 0x40, 0xD1, 0xB0, 0x41, 0xB0, 0xD5, 0x21, 0xD1, 0x24, 0xD5, 0x20, 0xD2, 0xB1, 0xD3,
+0xE0, 0x90, 0x03, 0x70, 0xA0, 0x05, 0x70, 0xA0, 0xF0, 0x90, 0x30, 0x80, 0x0C, 0x0F, 0x00, 0x90,
+0x50, 0x70, 0x90, 0x60, 0xE0, 0xB0, 0x20, 0xD7, 0x2F, 0x13, 0xD2, 0xB1, 0x41, 0xB0, 0xDE, 0x27,
+0xD3, 0xB0, 0x40, 0xB0, 0x20, 0xD6, 0x22, 0xD2, 0x22, 0xD1, 0xB0, 0x40, 0x20, 0xD1, 0x40, 0xD7,
+0x27, 0xD2, 0x21, 0xD0, 0x20, 0x40, 0x11, 0xD0, 0xB0, 0x10, 0x60, 0x80, 0x30, 0x04, 0x70, 0x01,
+0x90, 0xA0, 0x70, 0x02, 0xA0, 0x07, 0x90, 0x05, 0x80, 0x70, 0x01, 0x51, 0xC0, 0x02, 0x10, 0xA0,
+0x80, 0x10, 0x50, 0x07, 0x70, 0x50, 0x00, 0x90, 0x40, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1,
+0x22, 0xD0, 0x40, 0x20, 0xD1, 0xB0, 0xD3, 0xE0, 0x90, 0x50, 0x0C, 0x50, 0xA0, 0x50, 0xF0, 0x50,
+0xC0, 0x60, 0x03, 0xF0, 0xC0, 0x10, 0x30, 0x02, 0x50, 0x70, 0xC0, 0x10, 0x40, 0x24, 0xD4, 0x25,
+0xD2, 0xB1, 0xD1, 0xB0, 0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD0, 0x21, 0xD4, 0x20, 0xD1, 0xB0, 0x40,
+0xB0, 0xD2, 0x20, 0xD1, 0x23, 0xD7, 0xC0, 0x40, 0xD0, 0x21, 0xD4, 0x42, 0xB0, 0xD2, 0x22, 0xD0,
+0x22, 0xD1, 0x25, 0xD4, 0x20, 0xD1, 0x40, 0xB0, 0x60, 0xC0, 0xD1, 0x20, 0xD0, 0xE0, 0x50, 0x04,
+0x70, 0xA0, 0x03, 0x70, 0x50, 0xC0, 0x80, 0x50, 0x70, 0x30, 0x0C, 0x0F, 0x00, 0x30, 0xF0, 0x01,
+0xE0, 0xB2, 0x41, 0xB0, 0xD5, 0x20, 0xD6, 0x2C, 0xD2, 0x2B, 0xD3, 0x42, 0xB0, 0xD2, 0x24, 0xD8,
+0x22, 0xD0, 0x22, 0xD2, 0xB0, 0x41, 0xD3, 0x20, 0xD1, 0x24, 0xD6, 0x42, 0xB0, 0xD1, 0x21, 0xD0,
+0x20, 0xD2, 0x20, 0xD0, 0x25, 0xD2, 0x21, 0xD1, 0xA0, 0x60, 0xD1, 0x12, 0x90, 0x04, 0xA0, 0x60,
+0x02, 0x90, 0xF0, 0x00, 0xF0, 0x30, 0x07, 0xF0, 0x50, 0x04, 0xA0, 0x02, 0xF0, 0x10, 0xA0, 0x02,
+0xF0, 0xA0, 0x60, 0xC0, 0x70, 0x02, 0x30, 0x03, 0x50, 0x01, 0xF0, 0xA0, 0xD3, 0x40, 0xD1, 0x20,
+0xD1, 0x21, 0xD1, 0x40, 0xD2, 0x40, 0xE0, 0xD2, 0xB0, 0x60, 0x50, 0x00, 0xC0, 0x30, 0x08, 0x50,
+0x30, 0x11, 0x80, 0x10, 0xA0, 0xC0, 0x60, 0x30, 0x01, 0xF0, 0x90, 0xC0, 0xF0, 0x01, 0x90, 0x70,
+0x01, 0xE0, 0xA0, 0xB0, 0xD0, 0x21, 0xD2, 0x20, 0xD2, 0x25, 0xD0, 0x20, 0xD0, 0x40, 0xB0, 0x40,
+0xB0, 0xD1, 0x22, 0xD3, 0x24, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x23, 0xD9, 0xE0, 0x20,
+0xD1, 0x20, 0xD2, 0xB0, 0x40, 0xB1, 0xD4, 0x21, 0xD1, 0x26, 0xD1, 0x21, 0xD4, 0x20, 0xD1, 0x60,
+0xE0, 0x40, 0x60, 0xD3, 0xE0, 0x70, 0x05, 0x50, 0x30, 0x70, 0x90, 0x50, 0x70, 0x00, 0xA0, 0xF0,
+0x01, 0x30, 0x0C, 0x0F, 0x00, 0xA0, 0x02, 0x60, 0xD4, 0xB0, 0x41, 0xB1, 0xD9, 0x2F, 0x01, 0xD1,
+0x27, 0xD3, 0xB1, 0xD1, 0xB0, 0x41, 0xB0, 0xD6, 0x20, 0xD9, 0x21, 0xD0, 0x21, 0xD3, 0x41, 0x20,
+0xD3, 0x21, 0xD4, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x23, 0xD3, 0x22, 0xD0, 0x21,
+0xD0, 0x23, 0xD0, 0xE0, 0x60, 0xB0, 0xD0, 0x40, 0x12, 0x30, 0x11, 0x50, 0x01, 0x80, 0x03, 0x90,
+0x00, 0x90, 0x50, 0x08, 0x90, 0xF0, 0x03, 0x30, 0x00, 0xC0, 0x01, 0x50, 0x04, 0x30, 0xC0, 0x90,
+0x52, 0x70, 0xC0, 0x80, 0x30, 0x51, 0x91, 0x51, 0xE0, 0x42, 0xB0, 0x40, 0xD3, 0x20, 0xD2, 0xB1,
+0xD0, 0x20, 0xD1, 0x61, 0x40, 0xD1, 0xA0, 0x60, 0x00, 0x80, 0x30, 0x07, 0x50, 0xF0, 0x50, 0x11,
+0xC0, 0xA0, 0x11, 0xC0, 0x70, 0x06, 0x90, 0x01, 0x30, 0x50, 0x30, 0x60, 0xE0, 0xD0, 0x20, 0xD0,
+0x25, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0xB0, 0x41, 0xD3, 0x21, 0xD0, 0x20, 0xD2, 0x21, 0xD4, 0xB0,
+0x40, 0xB0, 0xD2, 0x28, 0xD7, 0x20, 0xD5, 0xB0, 0x41, 0x20, 0xD1, 0x40, 0xD3, 0x22, 0xD2, 0x29,
+0xD1, 0x21, 0xD3, 0x61, 0xD5, 0xE0, 0x90, 0x02, 0xF0, 0x53, 0x30, 0x03, 0x30, 0x90, 0x01, 0x80,
+0x50, 0x0B, 0x0F, 0x00, 0x60, 0x31, 0xE0, 0xA0, 0xD7, 0x20, 0xB0, 0x41, 0xB1, 0xD3, 0x20, 0xD1,
+0x21, 0xD3, 0x2B, 0xD0, 0x20, 0xD3, 0x22, 0xD2, 0x40, 0xD5, 0xB0, 0x40, 0xB1, 0xD3, 0x25, 0xD2,
+0x24, 0xD1, 0x20, 0xD3, 0x20, 0x41, 0xB0, 0xD2, 0x20, 0xD2, 0x23, 0xD3, 0x40, 0xD0, 0xB0, 0x40,
+0xB0, 0xD1, 0x24, 0xD5, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xC0, 0xB1, 0x80, 0x11, 0xF0, 0x00, 0x90,
+0x00, 0x10, 0x70, 0x06, 0x50, 0xA0, 0x04, 0xF0, 0x10, 0x30, 0x70, 0x01, 0x50, 0x02, 0x70, 0x80,
+0x00, 0x10, 0x90, 0x00, 0x50, 0x03, 0x50, 0x30, 0x60, 0x90, 0x70, 0xF0, 0x90, 0x10, 0x30, 0x03,
+0x50, 0x02, 0x10, 0xA0, 0x71, 0x31, 0xA0, 0x41, 0xB1, 0xD2, 0x40, 0xD1, 0x20, 0xD0, 0xB0, 0x11,
+0xE0, 0xD0, 0xB0, 0x80, 0x05, 0xC0, 0x50, 0x01, 0xF0, 0x90, 0x70, 0x00, 0x91, 0x70, 0x80, 0xC0,
+0x10, 0x07, 0xF0, 0x50, 0x00, 0x80, 0xA0, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xD1, 0x2B, 0xD1, 0x20,
+0x41, 0xD0, 0x40, 0xD2, 0x23, 0xD1, 0x22, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x21, 0xD0,
+0x25, 0xD0, 0x26, 0xD3, 0xB0, 0x41, 0x20, 0xD4, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x2E, 0xD0,
+0xE1, 0xD0, 0xA0, 0xB0, 0xD5, 0x70, 0xA0, 0x70, 0x50, 0x90, 0x50, 0xF0, 0x02, 0x80, 0x90, 0x02,
+0xF0, 0xC0, 0x30, 0xA0, 0x30, 0x80, 0x0B, 0x0E, 0x90, 0x50, 0x01, 0xE0, 0x40, 0xD1, 0x20, 0xD8,
+0xB1, 0x41, 0xB0, 0x20, 0xDA, 0x28, 0xD7, 0x20, 0xD3, 0x40, 0xD7, 0xB0, 0x41, 0xB0, 0x20, 0xD1,
+0x25, 0xD0, 0x27, 0xD1, 0x22, 0xD2, 0xB0, 0x40, 0xB0, 0xD4, 0x24, 0xD1, 0xB0, 0x40, 0xD2, 0xB0,
+0x40, 0xD2, 0x23, 0xD5, 0x26, 0xD1, 0x40, 0xD0, 0xB0, 0x40, 0x11, 0x00, 0x90, 0x01, 0x80, 0xA0,
+0x06, 0x70, 0x30, 0x05, 0x70, 0x30, 0x90, 0x01, 0x50, 0x70, 0x01, 0x90, 0x50, 0x60, 0x10, 0x90,
+0x01, 0x50, 0x70, 0x51, 0xA0, 0xC0, 0x30, 0x00, 0xF0, 0x50, 0xA0, 0x90, 0x04, 0x90, 0xF0, 0x00,
+0xF1, 0x03, 0xA0, 0x90, 0x60, 0xB2, 0x40, 0xB2, 0xD1, 0x20, 0xD1, 0xC1, 0x40, 0xD0, 0xA0, 0x50,
+0x04, 0x10, 0x30, 0x02, 0x80, 0x30, 0x00, 0xF1, 0xA0, 0x01, 0xF0, 0xC0, 0x50, 0x00, 0x60, 0xF0,
+0x02, 0x70, 0x90, 0x80, 0x30, 0x50, 0x00, 0x90, 0xA1, 0xF0, 0x10, 0xE0, 0xD0, 0x20, 0xD2, 0x24,
+0xD3, 0xB0, 0x40, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0x20, 0xB0, 0x40, 0xB0,
+0xD4, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x24, 0xD2, 0x20, 0xB0, 0x40, 0xB0, 0xD2,
+0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x20, 0xD1, 0x2E, 0xD0, 0x40, 0x60, 0xD0, 0xE0,
+0xD3, 0x20, 0xB1, 0x40, 0xE0, 0x90, 0x06, 0x80, 0x70, 0x03, 0x10, 0x02, 0x30, 0x0B, 0x07, 0x81,
+0x04, 0xA0, 0x02, 0xA0, 0xD0, 0x22, 0xD4, 0x20, 0xD5, 0x20, 0xB1, 0x41, 0xB0, 0xDB, 0x21, 0xD6,
+0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x23, 0xD4, 0xB0, 0x41, 0xB0, 0xD4, 0x26, 0xD1, 0x23, 0xD6,
+0xB0, 0x40, 0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0x40, 0xB0, 0xD3,
+0x21, 0xD7, 0x22, 0xD0, 0x20, 0xD4, 0xE0, 0x11, 0x30, 0x0A, 0x80, 0x90, 0x50, 0x0A, 0x90, 0x01,
+0x80, 0xF0, 0x30, 0x10, 0xC0, 0x92, 0x70, 0x01, 0x50, 0x00, 0x30, 0x00, 0xC0, 0xA0, 0x04, 0x80,
+0x30, 0x60, 0x70, 0x05, 0x30, 0x70, 0x00, 0x70, 0x60, 0x40, 0xD1, 0xB1, 0x40, 0xB0, 0xD6, 0x40,
+0x30, 0x05, 0x50, 0x03, 0x90, 0x00, 0x50, 0x10, 0x30, 0x50, 0xC0, 0xF0, 0x02, 0x70, 0xC0, 0x30,
+0x01, 0x50, 0xA0, 0x30, 0x50, 0x01, 0x90, 0x60, 0x70, 0xA0, 0xF0, 0x60, 0x70, 0xD1, 0xB1, 0xD2,
+0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD4, 0x40, 0xB0, 0xD0, 0x23, 0xD3, 0xB0, 0x41, 0xB0, 0xD3, 0x24,
+0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x22, 0xD5, 0xB0, 0x40, 0xB0, 0x20, 0xD4, 0x23, 0xD1, 0x40, 0xD3,
+0x21, 0xD0, 0x27, 0xD0, 0x20, 0xD2, 0x22, 0xD6, 0xB0, 0x41, 0xB1, 0xD1, 0xA0, 0x06, 0xA0, 0x04,
+0x60, 0x02, 0xA0, 0x0B, 0x06, 0x70, 0x91, 0x50, 0x03, 0xA0, 0x30, 0x90, 0x70, 0xA0, 0xD0, 0x22,
+0xD3, 0x26, 0xD5, 0xB0, 0x41, 0xB1, 0xD5, 0x20, 0xD5, 0x22, 0xD2, 0x21, 0xD3, 0x40, 0xD2, 0x25,
+0xD1, 0x20, 0xD2, 0xB0, 0x41, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x23, 0xD6, 0x21, 0xD1, 0xB0,
+0x40, 0xB0, 0xD6, 0xB1, 0xD0, 0x23, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD5, 0x20,
+0xD1, 0x20, 0xD1, 0x22, 0xD1, 0xC0, 0x30, 0xC0, 0x30, 0x0A, 0xC0, 0x00, 0x50, 0x70, 0x09, 0x70,
+0x50, 0x00, 0xA0, 0x01, 0x90, 0xA0, 0x70, 0x90, 0x70, 0x00, 0x80, 0x02, 0xC0, 0x50, 0x80, 0x10,
+0x04, 0x80, 0xF0, 0x70, 0x05, 0x80, 0x90, 0x02, 0x70, 0x80, 0xA0, 0x60, 0xD0, 0x70, 0x50, 0x90,
+0x40, 0xB0, 0xD3, 0xE1, 0x0A, 0x90, 0x02, 0x30, 0x10, 0x80, 0x00, 0xC0, 0xA0, 0x02, 0x10, 0x80,
+0x50, 0x30, 0x80, 0xF0, 0x03, 0xA0, 0xD1, 0x60, 0x00, 0xA0, 0x60, 0xE0, 0xD0, 0x10, 0xC0, 0xA0,
+0xD5, 0x40, 0xB0, 0xD2, 0x22, 0xD1, 0x40, 0xD0, 0x22, 0xD2, 0xB0, 0x41, 0xD2, 0x20, 0xD0, 0x21,
+0xD1, 0x23, 0xD0, 0x21, 0xD1, 0x20, 0xD5, 0xB0, 0x41, 0xD4, 0x24, 0xD0, 0x21, 0xD1, 0x40, 0xD1,
+0x20, 0xD1, 0x22, 0xD1, 0x22, 0xD0, 0x21, 0xD9, 0xE1, 0x41, 0xB0, 0xD5, 0x40, 0xA0, 0x05, 0xA0,
+0x04, 0x81, 0x50, 0x30, 0xC0, 0x70, 0x0A, 0x07, 0x31, 0xF0, 0x02, 0xF0, 0x30, 0x00, 0x70, 0x30,
+0xE0, 0xD0, 0x21, 0xD0, 0x26, 0xD1, 0x23, 0xD6, 0x20, 0xB0, 0x41, 0xB1, 0xD4, 0x23, 0xD5, 0x24,
+0xD0, 0x40, 0xD1, 0x25, 0xD0, 0x21, 0xD5, 0x20, 0xB0, 0x40, 0xB0, 0xD6, 0x22, 0xD0, 0x24, 0xD1,
+0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x41, 0xD4, 0x40, 0xD1, 0x24, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x22,
+0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0x11, 0xA0, 0x50, 0x0A, 0x30, 0x50, 0x00, 0x50, 0xF0,
+0x09, 0x90, 0x00, 0x30, 0x70, 0x90, 0xF0, 0x02, 0xF0, 0xC0, 0x10, 0x30, 0x01, 0xA0, 0x00, 0x71,
+0x06, 0x50, 0xF0, 0x03, 0x50, 0x30, 0x06, 0xF0, 0x10, 0xA2, 0x61, 0x41, 0xD0, 0xC0, 0x60, 0x0A,
+0x80, 0x90, 0x30, 0x01, 0x70, 0x80, 0x30, 0x00, 0xA0, 0xC0, 0xF0, 0x70, 0x90, 0x80, 0xC0, 0x30,
+0xF0, 0x05, 0xC0, 0xD1, 0xE0, 0xF0, 0xC2, 0x11, 0xF0, 0x60, 0x40, 0xE0, 0xD1, 0x41, 0xD5, 0x22,
+0xD0, 0xB1, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD1, 0x22, 0xD2, 0x22, 0xD5, 0xB0,
+0x41, 0xB0, 0xD4, 0x26, 0xD4, 0xB1, 0xD0, 0x23, 0xD6, 0x21, 0xD6, 0xB0, 0x42, 0xB0, 0xD6, 0x21,
+0xD1, 0x60, 0x05, 0x30, 0x70, 0x04, 0x10, 0x90, 0x00, 0xF0, 0x30, 0x0A, 0x0D, 0x50, 0x80, 0x01,
+0x50, 0xE0, 0xD2, 0x26, 0xD1, 0x21, 0xD1, 0x23, 0xD0, 0x21, 0xD4, 0xB1, 0x41, 0xB0, 0xD5, 0x24,
+0xD1, 0x21, 0xD1, 0xB1, 0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x27, 0xD4, 0xB0, 0x41, 0xB0, 0xD5, 0x20,
+0xD1, 0x21, 0xD1, 0x20, 0xD1, 0x22, 0xD4, 0x40, 0xB0, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x21,
+0xD1, 0x21, 0xD2, 0xB0, 0x40, 0x20, 0xD0, 0x21, 0xD2, 0x24, 0xD0, 0x21, 0xD2, 0xB0, 0xC1, 0x70,
+0x51, 0x0A, 0xA0, 0x70, 0x00, 0x90, 0x09, 0xF0, 0x81, 0x70, 0x04, 0x70, 0x60, 0x70, 0x02, 0xA0,
+0x05, 0x60, 0x50, 0x01, 0x50, 0x03, 0xF0, 0xA0, 0x08, 0x90, 0x03, 0xA0, 0x70, 0xB0, 0x41, 0x80,
+0x09, 0x50, 0x70, 0xF1, 0x60, 0x70, 0x04, 0x50, 0xC1, 0x50, 0xC0, 0x90, 0x06, 0x50, 0xA0, 0xD1,
+0xE0, 0x70, 0x30, 0xF0, 0x90, 0xA0, 0x90, 0x00, 0x60, 0x10, 0xC0, 0xB2, 0xD2, 0x20, 0xD1, 0x23,
+0xD1, 0x40, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x25, 0xD1, 0x21, 0xD2, 0x20, 0xD0, 0x20, 0xD4, 0xB1,
+0x40, 0xB0, 0xD5, 0x28, 0xD5, 0x40, 0xD1, 0x22, 0xDA, 0x20, 0xB1, 0x41, 0xB0, 0xD7, 0x20, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0xA0, 0xF0, 0x05, 0xA0, 0x70, 0x03, 0xC0, 0x02, 0xA0, 0x0A, 0x06, 0xF0,
+0xA0, 0x61, 0x30, 0xF0, 0x00, 0x90, 0x50, 0x01, 0xE0, 0xB0, 0xD0, 0x22, 0xD1, 0x24, 0xD6, 0x23,
+0xD1, 0x20, 0xD6, 0xB0, 0x42, 0xD4, 0x23, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD1,
+0x20, 0xD0, 0x21, 0xD2, 0x20, 0xD0, 0x20, 0xD4, 0xB0, 0x41, 0xB0, 0xD3, 0x24, 0xD2, 0x20, 0xD0,
+0x22, 0xD4, 0x20, 0x42, 0xD1, 0x26, 0xD4, 0xB0, 0x40, 0xB0, 0xD1, 0x26, 0xD0, 0x21, 0xD2, 0xE0,
+0xA0, 0x10, 0x30, 0x01, 0x70, 0x90, 0x08, 0x70, 0x81, 0x01, 0x90, 0x08, 0x50, 0x80, 0x70, 0x0B,
+0xA0, 0x04, 0x50, 0x10, 0xC0, 0xF0, 0x00, 0x70, 0x90, 0xC0, 0x01, 0xA0, 0xF0, 0x0D, 0xA0, 0xD2,
+0x40, 0xE0, 0x90, 0x02, 0xF0, 0x03, 0x50, 0x70, 0x01, 0xF0, 0x10, 0x80, 0x07, 0xF0, 0x90, 0x06,
+0x50, 0x60, 0xB0, 0xD1, 0xE0, 0x80, 0x91, 0x03, 0xF0, 0x60, 0x30, 0xC0, 0x40, 0xD1, 0x21, 0xD1,
+0x24, 0xD1, 0x40, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x22, 0xD1, 0x22, 0xD1, 0x23, 0xD3, 0xB0,
+0x40, 0xB0, 0x20, 0xD6, 0x20, 0xD6, 0x21, 0xD5, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD5, 0xB0, 0x41,
+0xB0, 0x20, 0xD4, 0x20, 0xD3, 0x22, 0xD0, 0x22, 0xD0, 0xE0, 0x70, 0x06, 0xA0, 0x70, 0x02, 0xC0,
+0xF0, 0x01, 0xA0, 0x0A, 0x06, 0x60, 0x70, 0xF0, 0x70, 0x90, 0xC0, 0x50, 0x33, 0x60, 0xD2, 0x21,
+0xD1, 0x23, 0xD3, 0x2F, 0x01, 0xD4, 0xB0, 0x42, 0xB0, 0xD5, 0x20, 0xD1, 0x40, 0xD1, 0x23, 0xD1,
+0x20, 0xD0, 0x25, 0xD1, 0x20, 0xD7, 0xB0, 0x41, 0x20, 0xD5, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD1,
+0x21, 0xD2, 0xB0, 0x40, 0xD3, 0x21, 0xD2, 0x22, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x26, 0xD2, 0x40,
+0x10, 0x60, 0x11, 0x60, 0x01, 0x90, 0x07, 0xF0, 0x10, 0xA0, 0x01, 0xF0, 0x90, 0x05, 0x70, 0x90,
+0x00, 0x80, 0x90, 0x0A, 0xF0, 0xA0, 0x04, 0x31, 0xF0, 0x01, 0x50, 0x10, 0x30, 0x00, 0x30, 0x50,
+0x0E, 0x90, 0xE0, 0xD0, 0xB1, 0x70, 0x60, 0x50, 0x00, 0x70, 0x10, 0x02, 0x70, 0x50, 0x06, 0xF0,
+0x90, 0xA0, 0x02, 0x51, 0x04, 0xF0, 0x90, 0xA1, 0xD1, 0x20, 0xD0, 0xE0, 0xC0, 0xA0, 0xF0, 0x03,
+0x70, 0x30, 0x11, 0xC0, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x40, 0xD1, 0x21, 0xD0, 0x20,
+0xD1, 0x21, 0xD0, 0x22, 0xD4, 0x20, 0xD1, 0xB0, 0x41, 0x20, 0xD3, 0x21, 0xD1, 0x22, 0xD6, 0x21,
+0xD2, 0x20, 0xD1, 0xB1, 0xD0, 0x20, 0xD5, 0x20, 0xB0, 0x41, 0xB1, 0xD4, 0x23, 0xD3, 0x22, 0xD1,
+0x22, 0xD0, 0xE0, 0x50, 0x07, 0xA0, 0x50, 0x01, 0x80, 0xA0, 0x31, 0x60, 0xF0, 0x09, 0x06, 0xC0,
+0x03, 0xF0, 0x60, 0x30, 0x01, 0xF0, 0xE0, 0xD5, 0x23, 0xD2, 0x23, 0xD1, 0x24, 0xD1, 0x23, 0xD2,
+0x20, 0xD5, 0x20, 0xB0, 0x41, 0xB0, 0xD4, 0xB1, 0xD1, 0x23, 0xD1, 0x22, 0xD0, 0x21, 0xD0, 0x22,
+0xD0, 0x21, 0xD0, 0x21, 0xD5, 0xB0, 0x40, 0xB0, 0xD4, 0x25, 0xD3, 0x20, 0xD2, 0x40, 0x20, 0xD0,
+0x22, 0xD1, 0x22, 0xD3, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0x22, 0xD2, 0xB0, 0xC0,
+0x00, 0x80, 0x10, 0xC1, 0x70, 0x00, 0x90, 0xF0, 0x06, 0x61, 0x90, 0x01, 0x70, 0x50, 0x03, 0x90,
+0x70, 0x01, 0x30, 0x50, 0x70, 0x09, 0xA0, 0x60, 0x00, 0x30, 0x10, 0x70, 0x00, 0x10, 0x70, 0x02,
+0x50, 0xF0, 0x00, 0x80, 0x90, 0x0F, 0x00, 0xF0, 0x30, 0xD0, 0x42, 0xA0, 0xF0, 0x90, 0x70, 0x30,
+0x01, 0xF0, 0x90, 0x07, 0x90, 0x11, 0x70, 0x00, 0x50, 0x70, 0x03, 0x90, 0xA1, 0x41, 0xD4, 0xE0,
+0x60, 0x10, 0x02, 0x51, 0x90, 0xC0, 0x10, 0xF0, 0x41, 0xD1, 0x20, 0xD1, 0x22, 0xD4, 0x40, 0xD3,
+0x23, 0xD1, 0x20, 0xD0, 0x20, 0xD5, 0xB0, 0x41, 0xB0, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0x21, 0xD0, 0x26, 0xD1, 0x21, 0xD1, 0xB0, 0xD0, 0x20, 0xD2, 0xB1, 0x41, 0xB0, 0xD4,
+0x20, 0xD4, 0x23, 0xD2, 0x21, 0xD1, 0x22, 0xD0, 0xE0, 0xA0, 0x07, 0x80, 0x90, 0x01, 0x90, 0x30,
+0x01, 0x90, 0x50, 0x03, 0xF0, 0x04, 0x06, 0x90, 0xC0, 0x80, 0x50, 0x70, 0x80, 0x60, 0x90, 0x01,
+0x70, 0xE0, 0xD2, 0x26, 0xD3, 0x24, 0xD4, 0x21, 0xD1, 0x20, 0xD0, 0x26, 0xD6, 0xB1, 0x40, 0xB1,
+0xD0, 0xB0, 0xD3, 0x21, 0xD3, 0x26, 0xD1, 0x20, 0xD0, 0x24, 0xD6, 0xB0, 0x41, 0xB0, 0xD2, 0x20,
+0xD0, 0x22, 0xD2, 0x21, 0xD1, 0xB1, 0xD0, 0x25, 0xD1, 0x22, 0xD0, 0x20, 0xD6, 0xB0, 0x40, 0xD2,
+0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0xE0, 0xC0, 0x00, 0x50, 0x11, 0x70, 0x01, 0x50, 0x70, 0x06,
+0x30, 0xA0, 0x02, 0x50, 0x70, 0x00, 0x70, 0x90, 0x03, 0xA0, 0x00, 0x90, 0x06, 0x70, 0x10, 0x00,
+0xF0, 0x30, 0x00, 0xC0, 0x10, 0x50, 0x60, 0x10, 0x70, 0x02, 0x90, 0xC0, 0xA0, 0x30, 0x0F, 0x01,
+0xF0, 0xC0, 0xA1, 0x41, 0xE1, 0x00, 0x70, 0x50, 0x01, 0x90, 0x09, 0xA0, 0x10, 0x51, 0xF0, 0x01,
+0x70, 0x80, 0xA0, 0x30, 0xE0, 0x80, 0x40, 0xB0, 0xD4, 0xC0, 0xA0, 0x01, 0x70, 0x50, 0x60, 0x11,
+0xC0, 0xA0, 0x10, 0xE1, 0xD0, 0x26, 0xD3, 0x21, 0xB0, 0xD1, 0x22, 0xD2, 0x20, 0xD0, 0x20, 0xD3,
+0xB0, 0x41, 0xB0, 0xD4, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x28, 0xD3, 0x20, 0xD2, 0x40, 0xD0,
+0x20, 0xB0, 0x41, 0xB0, 0xD7, 0x29, 0xD1, 0x23, 0xD1, 0x21, 0xD2, 0xC0, 0x06, 0xF0, 0xA0, 0x02,
+0x70, 0xA0, 0x01, 0x70, 0x90, 0x50, 0x60, 0x30, 0x80, 0xC1, 0x03, 0x07, 0xF0, 0x80, 0xA0, 0x60,
+0x80, 0x50, 0xC0, 0x80, 0x50, 0x90, 0x40, 0xD3, 0x22, 0xD1, 0x28, 0xD4, 0x2E, 0xD8, 0x20, 0xB0,
+0x42, 0xB0, 0xD7, 0x24, 0xD5, 0x25, 0xD1, 0x20, 0xD5, 0xB0, 0x41, 0xB0, 0xD1, 0x23, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x23, 0xD1, 0x21, 0xDD, 0x41, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0xB0,
+0x10, 0x90, 0x00, 0x10, 0xA0, 0x80, 0x02, 0x51, 0x05, 0x50, 0x90, 0x30, 0x02, 0x52, 0x03, 0x70,
+0x80, 0x00, 0x71, 0x08, 0xF0, 0x30, 0x50, 0x10, 0x60, 0xA0, 0x50, 0x40, 0x80, 0x02, 0x70, 0x80,
+0xA0, 0x0F, 0x03, 0x60, 0xE0, 0xC0, 0x40, 0xD1, 0x60, 0x70, 0x00, 0xF0, 0x91, 0xF0, 0x0A, 0x60,
+0x50, 0x02, 0x60, 0xA0, 0x40, 0xE0, 0x10, 0xA0, 0x50, 0x90, 0x60, 0xE0, 0xD3, 0xA0, 0x60, 0x00,
+0x90, 0x50, 0xE0, 0x10, 0xE0, 0x10, 0x41, 0xE1, 0xB0, 0xD0, 0x2B, 0xD0, 0x40, 0xD1, 0x22, 0xD1,
+0x22, 0xD2, 0xB0, 0x40, 0xB0, 0x20, 0xD5, 0x27, 0xD0, 0x21, 0xD1, 0x28, 0xD5, 0xB0, 0x41, 0xB1,
+0xD8, 0x2A, 0xD3, 0x22, 0xD1, 0x20, 0xD3, 0xE0, 0x70, 0x05, 0x60, 0x04, 0x60, 0x70, 0x90, 0xA0,
+0xC0, 0x60, 0x70, 0x90, 0xC0, 0x00, 0x50, 0xE0, 0x02, 0x06, 0x80, 0x30, 0x00, 0x70, 0x50, 0x00,
+0x90, 0x70, 0xF0, 0x90, 0x60, 0xB0, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x2F, 0x16, 0xD2, 0x40, 0xB1,
+0x41, 0xB1, 0xD4, 0x21, 0xD3, 0x20, 0xD0, 0x22, 0xD1, 0x22, 0xD3, 0x22, 0xD4, 0xB0, 0x41, 0x21,
+0xD1, 0x20, 0xD4, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD3, 0x20, 0xD7, 0x20, 0xD2, 0xB0, 0x40, 0xB0,
+0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x61, 0x00, 0x10, 0xC0, 0x10, 0x03, 0x70, 0x50, 0x06, 0x30, 0xF0,
+0x01, 0x50, 0x70, 0x04, 0x90, 0x50, 0x01, 0x90, 0x08, 0xF0, 0x30, 0xC0, 0x11, 0x60, 0xC0, 0x70,
+0x60, 0x02, 0x50, 0x30, 0x0F, 0x04, 0x70, 0x60, 0x70, 0xD1, 0x40, 0xE0, 0x90, 0x01, 0xF0, 0x90,
+0xF0, 0x02, 0x60, 0xC0, 0x04, 0x50, 0x80, 0x02, 0xA0, 0xE0, 0xD2, 0x70, 0x80, 0xA1, 0xE0, 0xB0,
+0xD3, 0x41, 0xE0, 0x60, 0xA0, 0x40, 0xB0, 0xC1, 0xB0, 0xD3, 0x27, 0xD1, 0x22, 0xD0, 0xB1, 0xD0,
+0x21, 0xD4, 0x20, 0xB0, 0x40, 0xB1, 0xD3, 0x26, 0xD1, 0x25, 0xD4, 0x20, 0xD2, 0x20, 0xD3, 0xB0,
+0x42, 0xB2, 0xD1, 0x2F, 0x03, 0xD3, 0x25, 0xD0, 0x20, 0xD3, 0xA0, 0x04, 0x80, 0x50, 0x04, 0xC0,
+0x30, 0x50, 0x00, 0x60, 0x80, 0x01, 0xC0, 0x50, 0x30, 0x80, 0x02, 0x05, 0x80, 0x30, 0x80, 0xC0,
+0xA1, 0x30, 0xE0, 0x02, 0xA0, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x22, 0xD2, 0x20, 0xD1, 0x28, 0xDB,
+0x26, 0xD0, 0x20, 0xD0, 0xB1, 0xD3, 0x20, 0xB0, 0x41, 0xB1, 0xD6, 0x27, 0xD2, 0x25, 0xD7, 0xB0,
+0x40, 0xB0, 0xD5, 0xB1, 0xD2, 0x20, 0xD2, 0x2D, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0,
+0xD6, 0x10, 0x70, 0x60, 0x11, 0x90, 0x03, 0xF0, 0x90, 0x01, 0xF0, 0x30, 0x01, 0x50, 0x80, 0x00,
+0x90, 0xF0, 0x05, 0xA0, 0x02, 0xF0, 0x50, 0x07, 0x70, 0x30, 0x70, 0xC1, 0x70, 0x60, 0x70, 0xA0,
+0x70, 0x01, 0xA0, 0x0F, 0x04, 0xF0, 0x50, 0xA0, 0x60, 0xE0, 0x70, 0x60, 0xC0, 0xF0, 0x03, 0x90,
+0xF0, 0x00, 0x50, 0x10, 0x90, 0x00, 0xF0, 0x80, 0x00, 0x70, 0x90, 0x10, 0x70, 0x01, 0xA0, 0x70,
+0xD0, 0xE0, 0xA1, 0x40, 0xD6, 0xB0, 0x40, 0xA1, 0xD3, 0xE0, 0xD3, 0x20, 0xD1, 0x24, 0xD0, 0x23,
+0xD3, 0x40, 0xD1, 0x20, 0xD2, 0xB0, 0x41, 0xB0, 0xD7, 0x23, 0xD0, 0x23, 0xD1, 0x25, 0xD6, 0xB0,
+0x42, 0xB0, 0xD4, 0x40, 0xD1, 0x22, 0xD3, 0x25, 0xD5, 0x28, 0xD0, 0x24, 0xD0, 0xA0, 0xF0, 0x02,
+0x50, 0x80, 0x05, 0x30, 0x50, 0x01, 0x90, 0xC0, 0x80, 0x30, 0x80, 0x31, 0x03, 0x05, 0xA0, 0xF1,
+0x60, 0x01, 0xA0, 0x10, 0x30, 0x90, 0x70, 0xA0, 0xD0, 0x20, 0xD2, 0x22, 0xD3, 0x2F, 0x02, 0xD9,
+0x28, 0xD0, 0x40, 0xD2, 0x20, 0xD4, 0xB1, 0x40, 0xB1, 0xD6, 0x22, 0xD0, 0x21, 0xD3, 0x27, 0xD5,
+0xB0, 0x41, 0xB0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x26, 0xD0, 0x2B, 0xD3, 0x41, 0xD2, 0x21,
+0xD0, 0x40, 0x10, 0xF0, 0xA0, 0xC1, 0x04, 0xF0, 0x90, 0x00, 0x90, 0x60, 0x02, 0xA0, 0x50, 0xF0,
+0x06, 0xA0, 0x03, 0x50, 0xF0, 0x06, 0x70, 0x30, 0x00, 0x80, 0xC0, 0x00, 0x80, 0x10, 0xE0, 0x90,
+0x01, 0x30, 0x0F, 0x04, 0x90, 0x02, 0x80, 0xE0, 0xA0, 0x10, 0x70, 0x04, 0x90, 0x00, 0x80, 0x10,
+0x02, 0x90, 0x80, 0x50, 0x00, 0x31, 0x00, 0xF0, 0xA0, 0xB0, 0x60, 0x90, 0xF0, 0x70, 0xC0, 0x20,
+0xD3, 0xB0, 0x40, 0xB0, 0xD0, 0xB0, 0xD6, 0x22, 0xD5, 0x21, 0xD8, 0x40, 0x20, 0xD0, 0x20, 0xB1,
+0x40, 0xB0, 0xD3, 0x22, 0xD5, 0x22, 0xD4, 0x23, 0xD5, 0xB1, 0x41, 0xB1, 0xD3, 0x21, 0xD1, 0x40,
+0xD1, 0x21, 0xD4, 0x25, 0xD5, 0x2A, 0xD0, 0x21, 0xD1, 0x80, 0x90, 0x01, 0xF0, 0xA0, 0x06, 0x50,
+0x30, 0x70, 0x80, 0xC0, 0x90, 0x80, 0x30, 0x90, 0x31, 0x70, 0x02, 0x05, 0x50, 0xC0, 0x61, 0xF0,
+0x00, 0x60, 0x13, 0xA0, 0xB0, 0xD4, 0x20, 0xD2, 0x26, 0xD8, 0x2D, 0xD4, 0x20, 0xD0, 0x20, 0xD1,
+0x40, 0xDB, 0x20, 0xB0, 0x41, 0xB1, 0xD5, 0x25, 0xD2, 0x28, 0xD5, 0xB0, 0x41, 0xB0, 0x40, 0xD1,
+0x20, 0xD1, 0x2F, 0x03, 0xD0, 0x21, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x50, 0xC0, 0x00,
+0xA0, 0x10, 0xC0, 0x50, 0x05, 0x90, 0x50, 0x70, 0x01, 0x50, 0x81, 0x07, 0x30, 0x04, 0x50, 0x06,
+0x70, 0x30, 0x00, 0x30, 0xC0, 0x01, 0x10, 0xC0, 0xA0, 0x01, 0x30, 0x0F, 0x03, 0x71, 0x02, 0xE0,
+0x60, 0x10, 0x50, 0xF0, 0x05, 0x50, 0x60, 0x10, 0x02, 0x80, 0x50, 0x80, 0x10, 0x50, 0x00, 0x50,
+0xC0, 0x80, 0x60, 0x03, 0x60, 0xD2, 0xB0, 0x40, 0x60, 0xD3, 0x20, 0xD0, 0x20, 0xD4, 0x23, 0xD0,
+0x20, 0xD4, 0x22, 0xD5, 0x40, 0xB0, 0x40, 0xB1, 0xD4, 0x21, 0xD0, 0x23, 0xD4, 0x27, 0xD4, 0xB0,
+0x41, 0xB0, 0x20, 0xD5, 0x21, 0xD3, 0xB0, 0xD2, 0x20, 0xD0, 0x26, 0xD1, 0x2A, 0xD8, 0x20, 0xD1,
+0xE0, 0x90, 0x01, 0xA0, 0xF0, 0x05, 0xF0, 0x90, 0x13, 0x90, 0x80, 0x60, 0x30, 0x51, 0x60, 0x70,
+0x01, 0x06, 0x50, 0x00, 0x50, 0x10, 0xC0, 0x80, 0x50, 0x00, 0x70, 0x30, 0x80, 0xB1, 0x43, 0xB0,
+0x20, 0xDF, 0x01, 0x2F, 0x01, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD2,
+0x20, 0xD4, 0x20, 0xB0, 0x41, 0xB0, 0x20, 0xD5, 0x24, 0xD1, 0x29, 0xD5, 0x42, 0x20, 0xD4, 0x2F,
+0x03, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x11, 0xC0, 0x10, 0xC0, 0x90, 0x30,
+0xA0, 0x90, 0x02, 0x80, 0xA0, 0x70, 0x01, 0x80, 0xF0, 0x30, 0x06, 0x70, 0x80, 0x03, 0x80, 0x60,
+0xF0, 0x05, 0x70, 0x80, 0x00, 0x70, 0x11, 0x50, 0x00, 0x30, 0x10, 0x70, 0x00, 0x30, 0x03, 0x70,
+0x10, 0x0C, 0x90, 0x03, 0x90, 0x00, 0x50, 0x60, 0x01, 0xF0, 0x04, 0x90, 0x80, 0x00, 0xF0, 0x90,
+0x00, 0xF0, 0xC0, 0x80, 0x70, 0x00, 0x60, 0x80, 0x60, 0x02, 0x70, 0x80, 0xA0, 0xB0, 0xD0, 0x40,
+0xB0, 0xE0, 0xC0, 0x70, 0x61, 0xD1, 0x20, 0xD3, 0x28, 0xD3, 0x21, 0xD4, 0xB0, 0x40, 0xE0, 0xD3,
+0x2E, 0xDA, 0xB0, 0x42, 0xB0, 0xD5, 0x23, 0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x26, 0xD2, 0x29, 0xD5,
+0x20, 0xD5, 0xB0, 0xE0, 0x00, 0x30, 0x50, 0x00, 0x70, 0x50, 0x90, 0x52, 0x71, 0xC0, 0x50, 0x01,
+0x30, 0xA0, 0x03, 0x50, 0x80, 0x01, 0x04, 0x70, 0xC0, 0x61, 0x01, 0x70, 0x80, 0x70, 0x01, 0x80,
+0xB0, 0xD4, 0x20, 0xB1, 0x42, 0xB2, 0xD7, 0x2F, 0x09, 0xD1, 0x20, 0x40, 0xD2, 0x23, 0xD4, 0x23,
+0xD3, 0x20, 0xB0, 0x41, 0xB0, 0xD5, 0x22, 0xD5, 0x23, 0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x42, 0xD4,
+0x20, 0xD6, 0x24, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD0, 0xB0, 0x80, 0x90,
+0xC0, 0x10, 0x30, 0x02, 0x50, 0xA0, 0x30, 0x90, 0x80, 0x50, 0xF0, 0x51, 0x00, 0xF0, 0x30, 0x06,
+0x90, 0x50, 0x01, 0x90, 0x11, 0x90, 0x50, 0x05, 0x50, 0x80, 0x02, 0xC0, 0x30, 0x00, 0x50, 0x10,
+0x30, 0x00, 0x30, 0x03, 0x70, 0xC0, 0x70, 0x80, 0x09, 0x50, 0xF0, 0x06, 0x30, 0x01, 0x80, 0xC0,
+0x04, 0x50, 0x70, 0x50, 0x05, 0x50, 0x30, 0xA0, 0x01, 0x50, 0x11, 0xC1, 0x41, 0xD4, 0xE0, 0x60,
+0xE0, 0xB0, 0xD0, 0x26, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x23, 0xD3, 0xB0, 0x41, 0xB0, 0xD0, 0xB1,
+0xD1, 0x22, 0xD7, 0x20, 0xD0, 0x24, 0xD4, 0xB0, 0x42, 0xB0, 0xD4, 0x21, 0xD5, 0x20, 0xD0, 0x23,
+0xD1, 0x40, 0xD0, 0x23, 0xD4, 0x29, 0xD0, 0x28, 0xD6, 0xA0, 0x90, 0x80, 0x51, 0x70, 0xF0, 0x05,
+0xA0, 0x02, 0xA1, 0x01, 0x70, 0x90, 0x10, 0xF0, 0x01, 0x04, 0x30, 0x50, 0x00, 0x31, 0x00, 0xA0,
+0x31, 0x90, 0x50, 0xA0, 0xB0, 0xD1, 0x20, 0xD7, 0xB2, 0x41, 0xB2, 0x20, 0xD9, 0x2F, 0x02, 0xD0,
+0xB1, 0xD1, 0x27, 0xD0, 0x26, 0xD5, 0xB1, 0x40, 0xB1, 0x20, 0xD8, 0x23, 0xD2, 0x24, 0xB0, 0xD3,
+0xB0, 0x41, 0xB0, 0x20, 0xD8, 0x24, 0xD2, 0x22, 0xD8, 0x40, 0x90, 0xE0, 0x00, 0x70, 0x10, 0xA0,
+0x04, 0xF0, 0x70, 0x32, 0x91, 0x00, 0x70, 0x80, 0x06, 0x30, 0xF0, 0x01, 0xF0, 0x70, 0x01, 0xF0,
+0x50, 0x04, 0x50, 0x80, 0x02, 0xA0, 0x60, 0x00, 0xF0, 0xC0, 0x30, 0x00, 0x30, 0x04, 0x90, 0x10,
+0x30, 0x09, 0x90, 0x07, 0x30, 0x01, 0x80, 0xA0, 0x05, 0x80, 0x01, 0x70, 0x00, 0xF0, 0x71, 0x30,
+0x60, 0xF0, 0x90, 0x31, 0xF1, 0x90, 0x30, 0x90, 0x40, 0xD2, 0x40, 0xD0, 0xE0, 0xC0, 0x60, 0xA0,
+0xD0, 0x23, 0xD0, 0x20, 0xD3, 0x24, 0xD2, 0xB1, 0x40, 0xB0, 0xD4, 0x40, 0xD4, 0x21, 0xD1, 0x20,
+0xD4, 0x20, 0xD4, 0xB1, 0x41, 0xB1, 0xD3, 0x20, 0xD0, 0x26, 0xD1, 0x20, 0xD2, 0x22, 0xD1, 0x40,
+0xD0, 0x23, 0xD3, 0x26, 0xDC, 0x21, 0xB1, 0x42, 0xB1, 0xC0, 0x51, 0xF0, 0x07, 0xA0, 0x91, 0x80,
+0x60, 0x90, 0xC1, 0x60, 0x30, 0xF0, 0x02, 0x04, 0x30, 0x90, 0x01, 0x60, 0x70, 0x60, 0x80, 0x71,
+0x50, 0x60, 0xD1, 0x21, 0xD1, 0x20, 0xD9, 0x20, 0xB2, 0x41, 0xB1, 0xDA, 0x20, 0xD6, 0x20, 0xD1,
+0x20, 0xD1, 0x40, 0xD1, 0x29, 0xD0, 0x20, 0xD0, 0x21, 0xDA, 0x20, 0xB0, 0x41, 0xB0, 0x20, 0xD4,
+0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0xB0, 0x20, 0xD1, 0x20, 0xD3, 0xB0, 0x41, 0xB0,
+0xD3, 0x26, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x21, 0xD6, 0x40, 0xE0, 0x70, 0xC0, 0x10, 0x70, 0x05,
+0x90, 0x30, 0x00, 0xA0, 0x90, 0xC0, 0xA0, 0x30, 0x60, 0x06, 0xA0, 0x07, 0x90, 0x04, 0x50, 0x90,
+0x03, 0x10, 0x80, 0xF0, 0x10, 0x30, 0x00, 0x30, 0x02, 0x30, 0x70, 0x10, 0x04, 0x70, 0x04, 0x90,
+0x08, 0x80, 0x70, 0x09, 0x50, 0x00, 0x10, 0x30, 0x50, 0x12, 0x80, 0xF0, 0x30, 0x02, 0x50, 0xF0,
+0x10, 0xA0, 0xC0, 0xA0, 0xE0, 0x60, 0x10, 0x50, 0x60, 0x10, 0x60, 0x40, 0xD0, 0x22, 0xD5, 0x21,
+0xD4, 0xB0, 0x40, 0xB0, 0x20, 0xD3, 0x21, 0xD0, 0x40, 0xD4, 0x26, 0xD5, 0xB0, 0x41, 0xB1, 0x20,
+0xDD, 0x21, 0xD1, 0x21, 0xD1, 0x23, 0xD0, 0x40, 0xD0, 0x24, 0xD0, 0x28, 0xD0, 0x20, 0xD6, 0xB1,
+0x42, 0xB1, 0x21, 0xD3, 0xE0, 0x10, 0x61, 0x90, 0x06, 0x30, 0xA0, 0x50, 0xF0, 0x30, 0xF0, 0x03,
+0x50, 0x80, 0x01, 0x04, 0xF0, 0x60, 0x70, 0x00, 0x50, 0xC0, 0xA0, 0x30, 0x02, 0x60, 0xD1, 0x26,
+0xD2, 0x20, 0xDA, 0xB0, 0x44, 0xB0, 0xDB, 0x20, 0xD1, 0x20, 0xD2, 0x40, 0xD2, 0x21, 0xD0, 0x26,
+0xDA, 0x20, 0xD6, 0xB1, 0x41, 0xB0, 0x20, 0xD8, 0x20, 0xD2, 0x40, 0xD2, 0x20, 0xD6, 0xB0, 0x41,
+0xB0, 0xD2, 0x25, 0xD0, 0x21, 0xD5, 0x20, 0xD3, 0x20, 0xD0, 0xE0, 0xA0, 0x70, 0x60, 0xA0, 0x06,
+0x70, 0xF0, 0x50, 0x91, 0x50, 0x00, 0x70, 0x90, 0x32, 0x80, 0x70, 0x01, 0x30, 0x08, 0x90, 0x03,
+0x50, 0x90, 0x03, 0xC0, 0x80, 0x00, 0x90, 0x50, 0x90, 0x30, 0x02, 0x60, 0x10, 0x30, 0x03, 0x90,
+0x10, 0x90, 0x02, 0xF0, 0x50, 0x08, 0x90, 0x50, 0x06, 0xC0, 0x10, 0x72, 0x04, 0x10, 0x70, 0x90,
+0xC0, 0x51, 0x90, 0x02, 0xE0, 0xC0, 0x10, 0xC0, 0x10, 0xA1, 0x11, 0x30, 0xD0, 0x21, 0xD0, 0x21,
+0xD0, 0x21, 0xD1, 0x20, 0xD2, 0xB0, 0x41, 0x20, 0xD6, 0x21, 0xD0, 0xB1, 0xD1, 0x22, 0xD0, 0x21,
+0xD4, 0xB0, 0x42, 0xB0, 0xD3, 0x20, 0xD0, 0x23, 0xDC, 0x21, 0xD1, 0x22, 0xD1, 0x40, 0x20, 0xD2,
+0x24, 0xD0, 0x20, 0xD8, 0xB0, 0x43, 0xB1, 0xD5, 0x23, 0xD1, 0x40, 0xD0, 0x70, 0xC0, 0x70, 0x05,
+0x90, 0x80, 0x01, 0x90, 0x50, 0x03, 0x30, 0x50, 0x90, 0x00, 0x09, 0x90, 0x80, 0xA0, 0xF0, 0x01,
+0xA0, 0xD1, 0x21, 0xD0, 0x2A, 0xDC, 0x20, 0xB0, 0x43, 0xB1, 0xD6, 0x23, 0xD1, 0x40, 0xD0, 0x20,
+0xD0, 0x21, 0xD1, 0x22, 0xD1, 0x26, 0xD2, 0x24, 0xD8, 0xB0, 0x42, 0xB0, 0xD4, 0x20, 0xD0, 0x20,
+0xD0, 0xB1, 0xD1, 0x20, 0xD2, 0x21, 0xD5, 0xB0, 0x40, 0xB0, 0x20, 0xD7, 0x22, 0xD2, 0x21, 0xD2,
+0x21, 0xD0, 0xC0, 0x90, 0x01, 0x70, 0x50, 0xF0, 0x06, 0x80, 0xA0, 0x10, 0x06, 0x70, 0x80, 0xA1,
+0x60, 0x80, 0x90, 0x70, 0x05, 0x50, 0xF0, 0x02, 0x50, 0x90, 0x09, 0x30, 0xC0, 0x08, 0xC0, 0x60,
+0x30, 0x02, 0x90, 0x08, 0xF0, 0x30, 0x80, 0x05, 0x70, 0x10, 0xA0, 0x90, 0x00, 0x50, 0xF0, 0x02,
+0x90, 0x60, 0x80, 0xC0, 0x81, 0x50, 0x04, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x50, 0x70, 0x10, 0xB0,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD2, 0xB0, 0x41, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD1, 0x21,
+0xD1, 0xB0, 0xD0, 0x23, 0xD3, 0xB1, 0x41, 0xB0, 0xDA, 0x2D, 0xD1, 0x21, 0xD1, 0x21, 0xD2, 0xB1,
+0xD1, 0x23, 0xD6, 0xB0, 0x43, 0xB0, 0x20, 0xDA, 0x25, 0xD3, 0xA0, 0xC0, 0x05, 0xF0, 0x30, 0x01,
+0x91, 0x03, 0x31, 0x70, 0x00, 0x0B, 0xC0, 0x80, 0x30, 0x60, 0xE0, 0xD1, 0x20, 0xD1, 0x29, 0xD4,
+0x24, 0xD0, 0x20, 0xD7, 0xB1, 0x42, 0xB1, 0x21, 0xD4, 0xB0, 0x40, 0xD1, 0x20, 0xD4, 0x20, 0xD5,
+0x2A, 0xD2, 0x21, 0xD8, 0xB0, 0x41, 0xB1, 0x20, 0xD3, 0xB1, 0xD0, 0x21, 0xD2, 0x24, 0xD4, 0xB1,
+0x40, 0xB0, 0xD6, 0x22, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0xC0, 0x10, 0x03, 0x51, 0x04, 0x70, 0x30,
+0x00, 0x30, 0xF0, 0x00, 0x51, 0x06, 0xF0, 0x70, 0x50, 0x80, 0x30, 0xA0, 0x30, 0x80, 0x90, 0x51,
+0x90, 0x02, 0x51, 0x09, 0xA0, 0x10, 0x30, 0x07, 0x80, 0x10, 0x70, 0x01, 0x71, 0x08, 0xF0, 0xC0,
+0x10, 0x50, 0x05, 0xF0, 0x03, 0x90, 0x02, 0xC0, 0x90, 0x30, 0x50, 0xF0, 0x00, 0xA0, 0x04, 0xA1,
+0x70, 0x90, 0x01, 0xA0, 0xE0, 0xD1, 0x21, 0xD5, 0xB1, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x23, 0xD0,
+0x22, 0xD1, 0x40, 0xD4, 0x20, 0xB0, 0x41, 0xB0, 0xD5, 0x24, 0xD0, 0x20, 0xD0, 0x2A, 0xD3, 0x20,
+0xDA, 0x40, 0xD5, 0x20, 0xB1, 0x42, 0xB1, 0xD7, 0x28, 0xD3, 0x20, 0xD1, 0x22, 0xD0, 0x10, 0x30,
+0xF0, 0x04, 0x10, 0xA0, 0x31, 0x80, 0x04, 0xF0, 0x01, 0x0A, 0x50, 0x90, 0x01, 0x90, 0x40, 0xD5,
+0x20, 0xD2, 0x2C, 0xD0, 0x25, 0xD0, 0x21, 0xD6, 0xB2, 0x42, 0xB1, 0xD0, 0xB1, 0xD3, 0x20, 0xD8,
+0x20, 0xD0, 0x29, 0xDA, 0x20, 0xD4, 0xB1, 0x41, 0xB0, 0xD1, 0x40, 0xD1, 0x20, 0xD4, 0x20, 0xD1,
+0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0xB0, 0x41, 0xB0, 0xD5, 0x25, 0xD3, 0x40, 0xE0, 0x70, 0x30,
+0x03, 0x70, 0x90, 0x70, 0x02, 0x81, 0x00, 0x80, 0x50, 0x00, 0x30, 0x80, 0x0C, 0xF0, 0x70, 0x50,
+0x90, 0x33, 0xA0, 0xC0, 0xA0, 0x30, 0x81, 0x90, 0x53, 0x71, 0xA0, 0x11, 0x03, 0x70, 0x04, 0xA0,
+0x80, 0x50, 0x90, 0x0B, 0xA0, 0x02, 0x70, 0x00, 0x70, 0x05, 0x70, 0x50, 0x00, 0x90, 0x10, 0x50,
+0x80, 0x02, 0x30, 0xF0, 0x02, 0xF0, 0x12, 0x90, 0x00, 0xE1, 0xD1, 0x22, 0xD3, 0xB0, 0x40, 0xB0,
+0x20, 0xD2, 0x20, 0xD3, 0x24, 0xD1, 0x22, 0xD0, 0xB1, 0xD0, 0xB0, 0x41, 0xB1, 0xD3, 0x20, 0xD1,
+0x20, 0xD8, 0x2B, 0xD5, 0x24, 0xD3, 0x40, 0xD1, 0xB0, 0x42, 0xB2, 0xD8, 0x20, 0xD1, 0x29, 0xD0,
+0x27, 0xD2, 0x40, 0x60, 0x70, 0x03, 0x10, 0x02, 0x30, 0x07, 0x0A, 0x80, 0x70, 0x01, 0x30, 0xD0,
+0x20, 0xD3, 0x21, 0xD6, 0x27, 0xD0, 0x20, 0xD1, 0x2A, 0xD8, 0xB2, 0x41, 0xB2, 0xDC, 0x29, 0xD8,
+0x21, 0xD1, 0x23, 0xD3, 0xB0, 0x42, 0xD7, 0x28, 0xD0, 0x20, 0xD3, 0xB0, 0x41, 0x20, 0xD4, 0x21,
+0xD0, 0x21, 0xD2, 0xE0, 0x70, 0x00, 0xC0, 0x00, 0xF0, 0x03, 0x70, 0x50, 0xF0, 0x50, 0x80, 0x70,
+0x00, 0xF0, 0xA0, 0x0F, 0x04, 0x90, 0xF0, 0x50, 0x03, 0xF0, 0x70, 0x52, 0x90, 0x60, 0x82, 0x30,
+0x10, 0x70, 0x10, 0x30, 0x01, 0x60, 0x03, 0xC0, 0x10, 0xE1, 0xA0, 0x50, 0x0A, 0x80, 0xF0, 0x90,
+0x00, 0x10, 0xC0, 0x10, 0x06, 0x50, 0xF0, 0x90, 0x50, 0x70, 0x80, 0x02, 0x90, 0x30, 0x01, 0xA0,
+0x60, 0x80, 0x60, 0x50, 0xF0, 0x10, 0xE0, 0xD1, 0x20, 0xD3, 0xB0, 0x41, 0xB0, 0xD4, 0x20, 0xD0,
+0x24, 0xD1, 0x22, 0xD0, 0x22, 0xD0, 0xB0, 0x41, 0xB0, 0xD6, 0x23, 0xD9, 0x2A, 0xDB, 0x20, 0xB0,
+0x44, 0xB0, 0xD8, 0x25, 0xD0, 0x22, 0xD2, 0x24, 0xD3, 0x24, 0xD1, 0x20, 0xD2, 0x60, 0xF0, 0x02,
+0xC0, 0x02, 0x30, 0x07, 0x0A, 0x31, 0x80, 0x50, 0x60, 0xD0, 0x21, 0xD0, 0x27, 0xD1, 0x27, 0xD1,
+0x22, 0xD3, 0x27, 0xD2, 0x20, 0xD6, 0x40, 0xD1, 0xB1, 0x43, 0xB1, 0xD9, 0x23, 0xD4, 0x2A, 0xD6,
+0x20, 0xD1, 0xB1, 0xD4, 0x24, 0xD1, 0x22, 0xD1, 0x20, 0xD1, 0x20, 0xD4, 0xB0, 0x41, 0xD4, 0x20,
+0xD0, 0x21, 0xD0, 0xB0, 0xA0, 0x01, 0x50, 0x31, 0xA0, 0x81, 0x90, 0xA0, 0x70, 0x90, 0x50, 0xA0,
+0x02, 0x30, 0x70, 0x0A, 0xF0, 0x91, 0x80, 0xC0, 0x02, 0x80, 0xA0, 0x60, 0x90, 0x08, 0x80, 0xF0,
+0x01, 0x71, 0x80, 0xA0, 0x11, 0x50, 0x00, 0x50, 0x01, 0xC0, 0x10, 0xA0, 0x40, 0xB0, 0x50, 0xA0,
+0x50, 0x90, 0x08, 0xA0, 0x90, 0x50, 0x00, 0x70, 0x90, 0xC0, 0x90, 0xA0, 0x04, 0x50, 0x80, 0xF0,
+0x00, 0x70, 0x30, 0x03, 0x90, 0xA0, 0x90, 0xC0, 0x90, 0x10, 0x00, 0x50, 0x10, 0xE0, 0xD4, 0xB0,
+0x41, 0xB0, 0xD5, 0x25, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40,
+0xD3, 0x21, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x25, 0xD4, 0x25, 0xD9, 0xB1, 0x43, 0xB0, 0x20, 0xD0,
+0xB1, 0xD9, 0x21, 0xD0, 0x2A, 0xD4, 0x25, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0xB0, 0x60, 0x02, 0xA0,
+0x91, 0x80, 0xC0, 0x07, 0x0A, 0xA0, 0xF0, 0x70, 0x50, 0x60, 0xD0, 0x21, 0xD0, 0x27, 0xD1, 0x21,
+0xD3, 0x23, 0xD3, 0x22, 0xD1, 0x20, 0xD0, 0x26, 0xD1, 0x24, 0xD0, 0x40, 0xD7, 0xB1, 0x42, 0xB1,
+0x20, 0xDB, 0x29, 0xD1, 0x21, 0xD1, 0x22, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD1, 0x26, 0xD5, 0x27,
+0xD1, 0xB0, 0x41, 0xB0, 0xD6, 0xA0, 0x70, 0x04, 0xF0, 0x72, 0x50, 0x33, 0x70, 0x02, 0xC0, 0x0A,
+0x50, 0x10, 0xC0, 0xA0, 0xC0, 0x02, 0x30, 0x51, 0xC0, 0x50, 0x07, 0x80, 0x70, 0x01, 0xA1, 0x02,
+0x50, 0x80, 0x60, 0x30, 0x60, 0xC0, 0x10, 0xC0, 0x90, 0xE0, 0x60, 0x41, 0x61, 0xF0, 0x07, 0x70,
+0x10, 0x04, 0x50, 0x80, 0x02, 0xF0, 0x90, 0x71, 0xF0, 0x00, 0x50, 0x80, 0x04, 0x90, 0x10, 0x50,
+0xA0, 0x80, 0x00, 0x80, 0xE0, 0xD2, 0xB1, 0x40, 0xB0, 0xD2, 0x25, 0xD2, 0x28, 0xD0, 0x20, 0xD0,
+0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0x29, 0xDA, 0x20, 0xB2,
+0x41, 0xB2, 0xD6, 0xB1, 0xD0, 0x28, 0xD1, 0x2A, 0xD2, 0x21, 0xD0, 0x24, 0xD1, 0x20, 0xD2, 0x23,
+0xD0, 0xE0, 0x50, 0x01, 0x60, 0x80, 0x70, 0xF0, 0xA0, 0x07, 0x0A, 0xA0, 0x02, 0xA0, 0xD0, 0x29,
+0xD1, 0x22, 0xDF, 0x01, 0x20, 0xD0, 0x20, 0xD0, 0x2A, 0xD0, 0x20, 0xB0, 0xDB, 0x20, 0xB2, 0x42,
+0xB0, 0xD6, 0x21, 0xD0, 0x28, 0xD7, 0x20, 0xD1, 0x40, 0xD1, 0x27, 0xD1, 0x2F, 0x00, 0xD2, 0x20,
+0xB0, 0x41, 0xD4, 0xA0, 0x0A, 0x72, 0xA0, 0x70, 0x90, 0x70, 0x00, 0x30, 0x03, 0x80, 0x50, 0x0C,
+0x30, 0x01, 0x31, 0x60, 0x50, 0x05, 0x91, 0x01, 0x80, 0x70, 0x05, 0x90, 0xA0, 0x40, 0xB0, 0xD0,
+0x40, 0xE0, 0xB0, 0xE0, 0x60, 0x40, 0x90, 0x30, 0x08, 0x30, 0x80, 0x07, 0x51, 0xF0, 0x01, 0x50,
+0x00, 0xC0, 0xF0, 0x04, 0xA0, 0x60, 0xB0, 0xC0, 0x01, 0xC0, 0xD1, 0xB0, 0x40, 0xB0, 0x20, 0xD4,
+0x2A, 0xD3, 0x27, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x27, 0xD0, 0x27, 0xD7, 0xB1, 0x42, 0xB1, 0x20,
+0xDB, 0xB1, 0xD0, 0x2A, 0xD2, 0x22, 0xD3, 0x20, 0xD9, 0x23, 0xD3, 0x22, 0xD1, 0xA0, 0x00, 0x70,
+0x10, 0x90, 0x01, 0x30, 0xF0, 0x06, 0x0A, 0x30, 0x02, 0xA0, 0xD8, 0x26, 0xD0, 0x20, 0xD2, 0x22,
+0xD6, 0x20, 0xD5, 0x28, 0xD1, 0xB1, 0xD0, 0x22, 0xD4, 0x21, 0xD7, 0xB1, 0x43, 0xB0, 0x20, 0xDD,
+0x22, 0xD1, 0x20, 0xD2, 0x40, 0xD1, 0x22, 0xD2, 0x21, 0xD3, 0x2F, 0x01, 0xD3, 0xB0, 0x40, 0xB0,
+0xD0, 0xE0, 0x50, 0x0A, 0x90, 0x01, 0x30, 0x70, 0x00, 0x50, 0x80, 0x90, 0x03, 0x50, 0x70, 0x0C,
+0x30, 0x02, 0x50, 0x70, 0x06, 0x70, 0x80, 0x01, 0x70, 0x31, 0x03, 0x90, 0x30, 0x70, 0xD0, 0x70,
+0xA1, 0x40, 0xD2, 0xE0, 0x60, 0x10, 0x09, 0x80, 0xA2, 0xF0, 0x01, 0x70, 0x81, 0x90, 0x10, 0x01,
+0xF0, 0x61, 0x03, 0x30, 0x10, 0xE0, 0xD1, 0xE1, 0x80, 0xA0, 0x41, 0xB0, 0xD0, 0x20, 0xD1, 0x21,
+0xD1, 0x28, 0xD0, 0x22, 0xD3, 0x21, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0xB1, 0xD4, 0x22, 0xD2, 0x21,
+0xD9, 0xB1, 0x43, 0xB1, 0xD5, 0x21, 0xD1, 0x25, 0xD2, 0xB0, 0xD0, 0x2A, 0xD5, 0x21, 0xD5, 0x23,
+0xD2, 0x23, 0xD2, 0x23, 0xD1, 0xA0, 0x00, 0xA0, 0x90, 0x30, 0x01, 0x90, 0x70, 0x06, 0x0A, 0x60,
+0xA0, 0x31, 0xA0, 0xD2, 0x27, 0xD3, 0x24, 0xD3, 0x2F, 0x00, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0xB1,
+0xD0, 0x22, 0xD3, 0x22, 0xDD, 0xB0, 0x43, 0xB1, 0xD7, 0x20, 0xD0, 0x22, 0xD0, 0x22, 0xB0, 0x40,
+0xD0, 0x24, 0xD3, 0x20, 0xD5, 0x20, 0xD7, 0x20, 0xD3, 0x21, 0xD4, 0x40, 0x60, 0x70, 0xF0, 0x08,
+0x71, 0x00, 0x50, 0x30, 0x02, 0x90, 0xA0, 0x90, 0x0F, 0x02, 0xA0, 0x03, 0x90, 0x70, 0x05, 0x70,
+0x80, 0x01, 0x50, 0x04, 0x90, 0xC0, 0x60, 0x80, 0x40, 0x60, 0x80, 0xC0, 0x60, 0x40, 0xD0, 0xE0,
+0x30, 0xC0, 0x10, 0x60, 0xF0, 0x00, 0xF2, 0x07, 0xA0, 0x31, 0xA0, 0x90, 0x80, 0x90, 0x50, 0x32,
+0x80, 0x30, 0x70, 0x01, 0xF0, 0x10, 0xE0, 0xD2, 0xB0, 0xE1, 0xD6, 0x22, 0xD0, 0x21, 0xD5, 0x21,
+0xD0, 0x22, 0xDC, 0x20, 0x40, 0xD2, 0x21, 0xD0, 0x22, 0xD7, 0xB1, 0x43, 0xB0, 0x20, 0xDB, 0x21,
+0xD0, 0x26, 0xD2, 0x40, 0xD1, 0x23, 0xD3, 0x2F, 0x0B, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0xE0, 0x60,
+0x70, 0xF0, 0x10, 0x30, 0xA0, 0x60, 0x50, 0x06, 0x09, 0xF0, 0x30, 0x01, 0x70, 0xE0, 0xD8, 0x20,
+0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x2F, 0x07, 0xD8, 0xB0, 0x20, 0xD0, 0x21, 0xD4, 0x22, 0xD1, 0x20,
+0xD2, 0x23, 0xD0, 0x21, 0xD6, 0xB1, 0x41, 0xB2, 0x20, 0xD7, 0x20, 0xD0, 0x40, 0xB0, 0xD0, 0x25,
+0xD2, 0x24, 0xD1, 0x20, 0xDC, 0x23, 0xD2, 0xA0, 0xF1, 0x51, 0x70, 0x06, 0x90, 0x00, 0x70, 0xA0,
+0x04, 0x50, 0x80, 0x50, 0x70, 0x0F, 0x00, 0x30, 0x03, 0xF0, 0xC0, 0x90, 0x04, 0x70, 0x80, 0x01,
+0x50, 0x03, 0x50, 0x10, 0x90, 0x30, 0x10, 0x30, 0xF0, 0x50, 0x01, 0x30, 0x60, 0x50, 0x00, 0x70,
+0x50, 0xC0, 0x10, 0xC2, 0x10, 0x60, 0xA0, 0x04, 0xF0, 0x51, 0x70, 0xF1, 0x60, 0xA0, 0x50, 0x10,
+0x01, 0x80, 0x90, 0x80, 0x00, 0x80, 0x10, 0x80, 0xD0, 0xB0, 0x41, 0xB0, 0xD4, 0x20, 0xD0, 0x23,
+0xD0, 0x22, 0xD6, 0x22, 0xD3, 0x21, 0xD3, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xDA, 0xB2, 0x42, 0xB1,
+0xD7, 0x25, 0xD2, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xDA, 0x2F, 0x07, 0xD0,
+0x20, 0xD4, 0x23, 0xD1, 0xC0, 0x70, 0x00, 0x60, 0x01, 0xF0, 0x80, 0x06, 0x09, 0xF0, 0x80, 0x01,
+0x70, 0xE0, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x25, 0xDA, 0x22, 0xD2, 0x25, 0xDA, 0x40, 0xD1, 0x21,
+0xD4, 0x22, 0xD4, 0x26, 0xDB, 0x20, 0xB1, 0x42, 0xB1, 0xD5, 0x40, 0xD1, 0x24, 0xD1, 0x26, 0xD0,
+0x23, 0xD7, 0x21, 0xD6, 0xB0, 0xE0, 0x03, 0x70, 0x51, 0xF0, 0x02, 0xF0, 0x50, 0x00, 0x30, 0x50,
+0x05, 0xA0, 0x00, 0x70, 0x90, 0xF0, 0x0C, 0xF0, 0xC0, 0x91, 0x71, 0x00, 0x30, 0x80, 0x05, 0xA0,
+0x01, 0x50, 0x00, 0xF0, 0xA0, 0x00, 0x51, 0x01, 0xF0, 0x31, 0x80, 0x50, 0x02, 0x50, 0x60, 0xA0,
+0xC1, 0xA0, 0x11, 0xC0, 0x10, 0xF0, 0x40, 0xC0, 0x70, 0x01, 0x51, 0x03, 0x60, 0xF0, 0x01, 0x10,
+0x00, 0xF0, 0x30, 0x70, 0x30, 0xF0, 0xC0, 0x30, 0x50, 0x40, 0xB0, 0x20, 0xD2, 0x23, 0xD0, 0x20,
+0xD0, 0x28, 0xD6, 0x20, 0xD0, 0x28, 0xD0, 0x22, 0xD1, 0x40, 0xD5, 0xB1, 0x42, 0xB1, 0x21, 0xD5,
+0x2C, 0xD2, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0xB0, 0x20, 0xDA, 0x25, 0xD0, 0x24, 0xD6, 0x25,
+0xD4, 0x22, 0xD1, 0xE0, 0x90, 0x00, 0xC0, 0x02, 0x30, 0x06, 0x09, 0x70, 0x60, 0x90, 0x50, 0x80,
+0x40, 0xDF, 0x0A, 0x2C, 0xD9, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD4, 0x20, 0xD0, 0x20, 0xD0, 0x23,
+0xD0, 0x21, 0xD1, 0x27, 0xD1, 0x20, 0xD6, 0xB2, 0x42, 0xB1, 0x40, 0xD7, 0x21, 0xD0, 0x2D, 0xD3,
+0x21, 0xD0, 0x22, 0xD2, 0xE0, 0x50, 0x06, 0x50, 0x90, 0x50, 0x00, 0x50, 0x01, 0x80, 0x90, 0x05,
+0x30, 0x90, 0x01, 0xA0, 0x32, 0x90, 0x70, 0x07, 0x70, 0x80, 0x50, 0x91, 0x80, 0x35, 0xA0, 0x31,
+0xC0, 0x01, 0x50, 0x01, 0x90, 0xF0, 0xA0, 0x70, 0x03, 0x51, 0x80, 0x60, 0xF0, 0x10, 0xC0, 0x50,
+0x60, 0xC0, 0x80, 0x60, 0x30, 0xA0, 0x80, 0xE0, 0xC0, 0x70, 0x90, 0x60, 0xF0, 0x50, 0xF0, 0x03,
+0x60, 0x50, 0x02, 0xA0, 0xF1, 0x30, 0x70, 0x91, 0xE0, 0xB1, 0xD2, 0x25, 0xD0, 0x21, 0xD0, 0x2B,
+0xD2, 0x27, 0xD1, 0x21, 0xD5, 0xB2, 0x43, 0xB1, 0xD6, 0x2F, 0x00, 0xD2, 0x24, 0xD1, 0x21, 0xD1,
+0x20, 0xD3, 0xB1, 0xD9, 0x2B, 0xDF, 0x09, 0x60, 0x00, 0x10, 0x50, 0x90, 0x80, 0xA0, 0x06, 0x09,
+0x50, 0x80, 0x70, 0x50, 0xA0, 0xE0, 0x47, 0xB2, 0xDC, 0x2F, 0x07, 0xD1, 0x40, 0xD1, 0x21, 0xD5,
+0x21, 0xD0, 0x26, 0xD7, 0x26, 0xDD, 0xB0, 0x43, 0xB1, 0xD5, 0x20, 0xD3, 0x20, 0xD0, 0x28, 0xD1,
+0x26, 0xD1, 0xE0, 0xA0, 0x70, 0x01, 0x80, 0x90, 0x04, 0x50, 0x90, 0x01, 0xA0, 0x06, 0x70, 0xA0,
+0x30, 0xA0, 0xC0, 0x81, 0x51, 0x80, 0xA1, 0x31, 0x80, 0x90, 0x50, 0xF0, 0x90, 0x50, 0x04, 0x60,
+0xA0, 0x04, 0x70, 0x60, 0x01, 0x50, 0xF0, 0x01, 0x91, 0x03, 0x90, 0x02, 0x30, 0x61, 0xD0, 0x70,
+0x10, 0x90, 0x01, 0x60, 0x50, 0x60, 0x70, 0x60, 0x10, 0x80, 0x30, 0xC0, 0x50, 0x01, 0x70, 0x80,
+0x11, 0x03, 0x90, 0xA0, 0xF0, 0x80, 0x00, 0x90, 0xA0, 0x40, 0xD4, 0x25, 0xD0, 0x20, 0xD1, 0x20,
+0xD0, 0x25, 0xD1, 0x28, 0xD8, 0xB1, 0x44, 0xB0, 0xDC, 0x29, 0xD7, 0x20, 0xD0, 0x23, 0xD6, 0x20,
+0xD2, 0xB1, 0xD0, 0x2F, 0x07, 0xDC, 0xB4, 0x44, 0xE0, 0x50, 0xC0, 0x90, 0x50, 0xF0, 0x30, 0x06,
+0x09, 0x90, 0x50, 0x01, 0xE0, 0xB0, 0xD7, 0xB2, 0x45, 0xB5, 0x21, 0xDF, 0x00, 0x25, 0xD1, 0x40,
+0xD1, 0x22, 0xD3, 0x22, 0xD1, 0x24, 0xD6, 0x2D, 0xD1, 0x21, 0xD5, 0xB0, 0xD3, 0xB0, 0x42, 0xB2,
+0xDA, 0x24, 0xD1, 0x21, 0xD0, 0x23, 0xD1, 0xE0, 0x90, 0x80, 0xA0, 0x90, 0xA0, 0x90, 0x04, 0x71,
+0x00, 0x70, 0x80, 0x0A, 0x30, 0x50, 0x30, 0xF0, 0x50, 0x70, 0x02, 0xF0, 0x70, 0x50, 0x90, 0x80,
+0xC0, 0xF0, 0x04, 0x90, 0xA0, 0x50, 0x04, 0x30, 0x70, 0x00, 0x50, 0xF0, 0x01, 0x70, 0x80, 0x02,
+0x70, 0x50, 0x02, 0x70, 0x10, 0x60, 0xD0, 0xA0, 0x10, 0x02, 0x90, 0x40, 0xE0, 0x40, 0xE1, 0x90,
+0x50, 0x60, 0x70, 0x00, 0x50, 0x60, 0x10, 0xC1, 0x04, 0x30, 0x70, 0x80, 0x00, 0x90, 0x60, 0xE0,
+0xD3, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD4, 0x25, 0xD2, 0x23, 0xD6, 0x20, 0xB1, 0x42, 0xB1, 0xD3,
+0xB0, 0xD9, 0x21, 0xD4, 0x20, 0xD0, 0x22, 0xDA, 0x25, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB1, 0xD0,
+0x26, 0xDF, 0x00, 0x21, 0xB5, 0x44, 0xB3, 0xD5, 0xE0, 0x70, 0x60, 0x02, 0x30, 0x06, 0x09, 0x80,
+0x50, 0x01, 0xA0, 0xDF, 0x01, 0x22, 0xB4, 0x44, 0xB4, 0xDE, 0x40, 0xD0, 0x22, 0xD3, 0x24, 0xD0,
+0x22, 0xDD, 0x20, 0xD0, 0x2C, 0xD2, 0xB1, 0xD0, 0x20, 0xD5, 0x20, 0xB1, 0x42, 0xB1, 0xD6, 0x24,
+0xD4, 0x22, 0xD1, 0xA0, 0xF0, 0x01, 0x70, 0x90, 0x31, 0x70, 0x02, 0x50, 0x01, 0x90, 0x50, 0x0A,
+0xA0, 0x03, 0x70, 0x90, 0xF0, 0x05, 0x30, 0x04, 0x30, 0x10, 0x50, 0x71, 0x03, 0x80, 0x70, 0x00,
+0x50, 0xF0, 0x01, 0x50, 0x80, 0x02, 0x90, 0x03, 0x30, 0x10, 0x91, 0xE0, 0x03, 0x81, 0x90, 0xE1,
+0x03, 0x90, 0x64, 0x30, 0x04, 0x81, 0xC0, 0x30, 0x81, 0xA0, 0xD2, 0x22, 0xD3, 0x2F, 0x00, 0xD6,
+0xB0, 0x42, 0xB2, 0x20, 0xD4, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x28, 0xD0, 0x22, 0xD9, 0x20,
+0xD0, 0x2B, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xB0, 0xDE, 0xB4, 0x44, 0xB4, 0x22, 0xDD, 0x40,
+0x50, 0xA0, 0xF0, 0x01, 0x30, 0x06, 0x09, 0x30, 0xA0, 0x31, 0xC0, 0xDF, 0x00, 0x20, 0xDC, 0xB4,
+0x47, 0xB1, 0x20, 0xD3, 0xB0, 0xDF, 0x04, 0x24, 0xD9, 0x2B, 0xD1, 0xB1, 0x25, 0xD7, 0xB1, 0x43,
+0xB0, 0x20, 0xDA, 0x22, 0xD0, 0x40, 0xE0, 0x05, 0x70, 0x80, 0xC0, 0xA0, 0x90, 0x50, 0x01, 0x30,
+0xF0, 0x09, 0x70, 0x30, 0x05, 0x50, 0x90, 0x04, 0xA0, 0x05, 0xA0, 0xF0, 0x00, 0x90, 0x03, 0x80,
+0x70, 0x00, 0x50, 0x03, 0xC0, 0x60, 0x00, 0x71, 0x03, 0x70, 0xE0, 0x50, 0x80, 0x90, 0x03, 0xC0,
+0xA2, 0x30, 0x02, 0x90, 0xC2, 0xA1, 0x80, 0x05, 0x90, 0x80, 0x01, 0xF0, 0x50, 0x30, 0x60, 0xA0,
+0xD1, 0x20, 0xDF, 0x05, 0x20, 0xB0, 0x43, 0xB1, 0xD9, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x29,
+0xD4, 0x20, 0xD3, 0x27, 0xDF, 0x01, 0x20, 0xB0, 0xD3, 0xB2, 0x47, 0xB3, 0xDE, 0x20, 0xD0, 0x22,
+0xD1, 0x20, 0xD1, 0x21, 0xD0, 0xE2, 0xA1, 0x30, 0x60, 0x06, 0x09, 0x30, 0x02, 0xA0, 0xD1, 0x26,
+0xD0, 0x26, 0xDF, 0x09, 0x20, 0xB2, 0x47, 0xB3, 0xDB, 0x2B, 0xD5, 0x20, 0xD1, 0x23, 0xD4, 0x40,
+0x20, 0xD2, 0x25, 0xD1, 0x20, 0xD7, 0xB1, 0x42, 0xB2, 0xD5, 0x20, 0xD1, 0x60, 0x02, 0x50, 0xF0,
+0x02, 0x50, 0x90, 0x00, 0x90, 0x30, 0xA0, 0x80, 0x60, 0xF0, 0x06, 0xC0, 0x70, 0x00, 0x91, 0x07,
+0x90, 0x50, 0x02, 0x30, 0x07, 0xF0, 0x70, 0x50, 0x02, 0x80, 0x70, 0x00, 0x50, 0xF0, 0x03, 0x50,
+0x30, 0x90, 0x03, 0x30, 0x80, 0xA0, 0xD0, 0xE0, 0x50, 0x02, 0x50, 0xA0, 0xF0, 0x90, 0x10, 0xA0,
+0x02, 0x90, 0x61, 0x09, 0x90, 0x30, 0x80, 0x30, 0xC0, 0x30, 0xE0, 0x10, 0xA0, 0xD2, 0x28, 0xD6,
+0xB1, 0x43, 0xB0, 0xDC, 0x20, 0xD2, 0x21, 0xD1, 0x40, 0x20, 0xD3, 0x24, 0xD1, 0x25, 0xD3, 0x26,
+0xDD, 0xB4, 0x41, 0xE0, 0x42, 0xB2, 0x20, 0xDF, 0x04, 0x22, 0xD1, 0x26, 0xD0, 0x21, 0xD1, 0x21,
+0xD0, 0xE1, 0x10, 0xF0, 0x01, 0x80, 0xF0, 0x05, 0x09, 0x30, 0x02, 0xA0, 0xD1, 0x26, 0xD0, 0x26,
+0xD2, 0x2F, 0x04, 0xD8, 0xB1, 0xD2, 0xB3, 0x45, 0xB3, 0x24, 0xDF, 0x07, 0x21, 0xD1, 0x40, 0xD1,
+0x23, 0xD1, 0x27, 0xD9, 0xB2, 0x42, 0xB1, 0x21, 0xD0, 0xB0, 0x30, 0x02, 0x60, 0x70, 0x02, 0x30,
+0xF0, 0x00, 0x50, 0x01, 0xF0, 0x90, 0x31, 0x80, 0x50, 0x70, 0x05, 0x80, 0x70, 0x08, 0xF0, 0x90,
+0x70, 0x00, 0x30, 0x07, 0x30, 0x70, 0x50, 0x02, 0x80, 0xF0, 0x00, 0x50, 0x05, 0x90, 0xA0, 0x03,
+0xF1, 0x60, 0xD0, 0xE0, 0x90, 0x00, 0xF0, 0x51, 0x01, 0xF0, 0x10, 0x80, 0x02, 0x80, 0xC0, 0x10,
+0x05, 0xF0, 0x70, 0x01, 0x50, 0x30, 0xF0, 0x00, 0x80, 0xA0, 0x60, 0xA1, 0xDB, 0x20, 0xB2, 0x41,
+0xB1, 0xDA, 0x23, 0xD0, 0x28, 0xD1, 0xB0, 0x20, 0xD0, 0x25, 0xD0, 0x22, 0xDF, 0x00, 0x23, 0xB4,
+0x44, 0xB4, 0xD2, 0x40, 0xDB, 0x24, 0xD7, 0x23, 0xD2, 0x26, 0xD2, 0x21, 0xD0, 0x20, 0xD2, 0xE0,
+0x70, 0x01, 0x80, 0xF0, 0x05, 0x09, 0xA0, 0x50, 0x71, 0xA0, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x2F, 0x04, 0xD1, 0x20, 0xD0, 0x20, 0xD7,
+0xB0, 0xDB, 0x22, 0xB4, 0x45, 0xB3, 0xDA, 0x26, 0xD1, 0x40, 0xD0, 0x21, 0xD0, 0x21, 0xD5, 0x22,
+0xD0, 0x21, 0xDC, 0x20, 0xB2, 0x41, 0xB0, 0x30, 0x70, 0x06, 0xA0, 0x01, 0x50, 0x05, 0x70, 0x90,
+0x30, 0x60, 0x30, 0x90, 0x70, 0x01, 0x30, 0xF0, 0x0A, 0x70, 0x90, 0x30, 0xF2, 0x04, 0x90, 0xA0,
+0x00, 0x50, 0x01, 0x60, 0xA0, 0x32, 0xA1, 0x33, 0xC0, 0x05, 0x60, 0xD0, 0xB0, 0xA0, 0x70, 0x50,
+0xF0, 0x02, 0xF0, 0xA0, 0x00, 0x90, 0xA0, 0xC0, 0x10, 0xC0, 0x50, 0x01, 0xF0, 0x50, 0x30, 0xA0,
+0x30, 0x60, 0x50, 0x00, 0xF0, 0x80, 0x00, 0x30, 0xC0, 0xE0, 0xD3, 0x20, 0xD5, 0xB1, 0x41, 0xB2,
+0x20, 0xD8, 0x20, 0xD7, 0x2A, 0xD1, 0xB0, 0x27, 0xDB, 0xB4, 0x45, 0xB4, 0x21, 0xDB, 0x40, 0xD8,
+0x22, 0xD3, 0x28, 0xD0, 0x20, 0xD3, 0x21, 0xD0, 0x23, 0xD4, 0x21, 0xD3, 0xE0, 0x90, 0x71, 0xA0,
+0xF0, 0x05, 0x02, 0x90, 0x30, 0xF0, 0x03, 0xA0, 0x90, 0x80, 0xE0, 0x60, 0xD8, 0x20, 0xD5, 0x20,
+0xD0, 0x2E, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x24, 0xD0, 0x40, 0xD2, 0x22, 0xD5, 0x20,
+0xDC, 0xB3, 0x47, 0xB1, 0x21, 0xD7, 0x40, 0xD0, 0x24, 0xD4, 0x20, 0xD3, 0x2E, 0xD6, 0x30, 0x52,
+0x90, 0x50, 0x70, 0x00, 0x50, 0x90, 0x01, 0x90, 0x07, 0x70, 0x90, 0x00, 0x81, 0x31, 0xA0, 0x06,
+0x70, 0x50, 0x01, 0xF0, 0x70, 0x00, 0x30, 0xA0, 0x35, 0xA0, 0x30, 0x10, 0xC0, 0x50, 0xF0, 0x00,
+0xA0, 0x01, 0x50, 0x04, 0x90, 0x00, 0x10, 0xF0, 0x04, 0x60, 0xD0, 0xB0, 0xA0, 0xF0, 0x04, 0xA0,
+0x10, 0x90, 0xA2, 0xC1, 0x30, 0xA0, 0x31, 0x90, 0xF0, 0x02, 0x60, 0x30, 0x80, 0x10, 0xC0, 0x11,
+0xB1, 0xD3, 0xB1, 0x43, 0xB1, 0xD6, 0x29, 0xD1, 0x25, 0xD0, 0x25, 0xD1, 0x21, 0xD0, 0xB1, 0xD7,
+0x20, 0xB1, 0x47, 0xB3, 0xDF, 0x03, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD1,
+0x23, 0xD5, 0x21, 0xD1, 0x23, 0xD1, 0x23, 0xD5, 0x21, 0xD5, 0x21, 0xD3, 0x80, 0xA0, 0x80, 0x90,
+0xA0, 0xF0, 0x05, 0x01, 0xF0, 0x30, 0xF0, 0x80, 0x03, 0xA0, 0x02, 0xE0, 0xD1, 0x2F, 0x05, 0xD0,
+0x23, 0xD2, 0x26, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x40, 0xD2, 0x22, 0xD2, 0x23, 0xD1,
+0x21, 0xDF, 0x04, 0x21, 0xB2, 0x45, 0xB0, 0x41, 0xD0, 0x20, 0xD0, 0x22, 0xD6, 0x29, 0xD2, 0x22,
+0xD1, 0x21, 0xD4, 0xA0, 0x04, 0x70, 0x50, 0x30, 0x90, 0x52, 0x07, 0x90, 0x50, 0x00, 0x10, 0xF0,
+0x01, 0xA0, 0x06, 0x90, 0x60, 0x01, 0xF0, 0x71, 0x90, 0x00, 0x50, 0x70, 0x06, 0xF0, 0xA0, 0x30,
+0xA0, 0xC0, 0x01, 0x50, 0xF0, 0x02, 0x70, 0x50, 0x00, 0x90, 0xA0, 0x50, 0x90, 0x82, 0xA0, 0x40,
+0xD0, 0x60, 0x04, 0x70, 0x10, 0x60, 0xA0, 0x60, 0xE0, 0xC0, 0xF0, 0x70, 0x08, 0xA0, 0x00, 0xA0,
+0x10, 0xC0, 0xE0, 0xD1, 0x44, 0xB0, 0x20, 0xD9, 0x26, 0xD3, 0x24, 0xD0, 0x25, 0xD2, 0x23, 0xD2,
+0xB0, 0x40, 0xB0, 0x46, 0xB2, 0xDF, 0x09, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x40,
+0xD1, 0x2F, 0x0F, 0xD1, 0x22, 0xD3, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0x90, 0x01, 0x80, 0x70, 0x05,
+0x02, 0x90, 0x30, 0xF0, 0x03, 0x30, 0x01, 0xF0, 0xE0, 0xD1, 0x2D, 0xD2, 0x25, 0xD2, 0x21, 0xD2,
+0x22, 0xD0, 0x20, 0xD0, 0x40, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x23, 0xD0, 0x20,
+0xD0, 0x29, 0xD8, 0x27, 0xDC, 0xB1, 0xD0, 0x20, 0xD0, 0x26, 0xD0, 0x26, 0xD1, 0x21, 0xD0, 0x22,
+0xD2, 0x22, 0xD2, 0x21, 0xD0, 0xA0, 0x06, 0x30, 0x01, 0x50, 0x70, 0x07, 0x30, 0xF0, 0x00, 0xC1,
+0x00, 0x70, 0x90, 0x01, 0xF0, 0x03, 0xF0, 0x50, 0x03, 0x50, 0x90, 0x01, 0x70, 0x90, 0x70, 0x06,
+0x71, 0x30, 0x70, 0x00, 0x50, 0xF0, 0x02, 0x90, 0x02, 0x90, 0x60, 0x72, 0x90, 0x30, 0x51, 0xA0,
+0x00, 0xF0, 0x71, 0x50, 0x30, 0x11, 0x60, 0xA0, 0x91, 0x50, 0x09, 0x60, 0x00, 0x10, 0xC0, 0x50,
+0xD2, 0x40, 0xD6, 0x24, 0xD5, 0x24, 0xD0, 0x25, 0xD0, 0x22, 0xD0, 0x22, 0xD3, 0x24, 0xD1, 0xB0,
+0x40, 0xDD, 0x26, 0xDB, 0x24, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x28, 0xD0,
+0x2B, 0xD0, 0x23, 0xDA, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0x90, 0x01, 0x90, 0x50, 0x05,
+0x04, 0xF0, 0x71, 0x01, 0x60, 0xA2, 0xE0, 0xDF, 0x11, 0x20, 0xD2, 0x20, 0xD0, 0xE1, 0xC0, 0x40,
+0xD1, 0x22, 0xD0, 0x40, 0xD2, 0x21, 0xD2, 0x22, 0xD3, 0x21, 0xDC, 0x24, 0xDD, 0xB1, 0xD1, 0x23,
+0xD3, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xDB, 0x22, 0xD4, 0xA0, 0xF0, 0x04, 0x70, 0xA0, 0x01, 0x50,
+0x08, 0xA0, 0x01, 0x50, 0xC0, 0x00, 0x50, 0x60, 0x30, 0x80, 0x30, 0x09, 0x90, 0x50, 0x03, 0x51,
+0xF0, 0x05, 0x51, 0x80, 0x00, 0x50, 0xF0, 0x01, 0x50, 0x70, 0x03, 0xA0, 0x00, 0x70, 0x50, 0x00,
+0x70, 0xA1, 0x60, 0x30, 0x80, 0x30, 0xA0, 0x90, 0x50, 0xA0, 0x10, 0x30, 0x50, 0x00, 0x70, 0x80,
+0x09, 0x50, 0x30, 0x50, 0xE0, 0xD3, 0x40, 0xD3, 0x23, 0xDA, 0x22, 0xD6, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD6, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xDE, 0x23, 0xDF, 0x01, 0x22, 0xD1, 0x21,
+0xD2, 0x21, 0xD0, 0x40, 0xD7, 0x20, 0xD0, 0x20, 0xD0, 0x27, 0xD5, 0x22, 0xD2, 0xE0, 0xB0, 0xD3,
+0x26, 0xD1, 0x20, 0xD0, 0x40, 0x60, 0x30, 0xA0, 0xC0, 0x50, 0x05, 0x02, 0x70, 0x10, 0x61, 0xC1,
+0x90, 0x80, 0x01, 0x70, 0xE0, 0xD1, 0x2F, 0x0F, 0xD3, 0x21, 0xD1, 0x60, 0xB0, 0xD1, 0x21, 0xD1,
+0x40, 0xD2, 0x20, 0xD0, 0x2F, 0x1B, 0xD0, 0xB1, 0xD0, 0x2F, 0x11, 0xD1, 0x20, 0xD0, 0xE1, 0x04,
+0x31, 0x01, 0x90, 0x07, 0x70, 0x80, 0x06, 0xF0, 0x50, 0x30, 0x60, 0x31, 0xA0, 0x30, 0x90, 0x50,
+0xF0, 0x01, 0x80, 0xF0, 0x02, 0xF0, 0x01, 0x51, 0x04, 0x70, 0x50, 0x30, 0x00, 0x50, 0x02, 0x50,
+0x03, 0x50, 0xA0, 0x90, 0x70, 0x02, 0xC0, 0x70, 0x02, 0xF0, 0x80, 0x07, 0xA0, 0x09, 0x50, 0xA0,
+0x70, 0x10, 0xD3, 0x40, 0xD3, 0x2F, 0x1A, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x2F, 0x1E, 0xD0,
+0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x2B, 0xD2, 0x21, 0xD2, 0x20, 0xD1, 0xB0, 0x40, 0xE0, 0xD1,
+0x20, 0xD1, 0x27, 0xD0, 0xB0, 0xE0, 0x01, 0x50, 0x90, 0x05, 0x02, 0xC0, 0x04, 0xC0, 0x80, 0x01,
+0x70, 0xE0, 0xD1, 0x2F, 0x10, 0xD2, 0x21, 0xD4, 0x23, 0xD0, 0x40, 0xD1, 0x2F, 0x1E, 0xD0, 0xB1,
+0xD0, 0x2F, 0x11, 0xD1, 0x20, 0xD0, 0x40, 0x11, 0x80, 0xF0, 0x02, 0xA0, 0x01, 0x50, 0x07, 0x90,
+0x50, 0x08, 0x90, 0x70, 0x03, 0x50, 0x90, 0x30, 0xA1, 0x60, 0x31, 0x81, 0x30, 0x03, 0x90, 0x50,
+0x03, 0x50, 0x60, 0x00, 0x50, 0xF0, 0x00, 0x90, 0x03, 0x50, 0xA0, 0x70, 0x04, 0x30, 0x03, 0xF0,
+0x30, 0x07, 0xC0, 0x06, 0x50, 0x90, 0xA0, 0x10, 0x00, 0x90, 0x60, 0xD3, 0xB0, 0x20, 0xD2, 0x2F,
+0x1D, 0xD0, 0x40, 0xD1, 0x2F, 0x1E, 0xD0, 0x40, 0xD1, 0x2F, 0x07, 0xD7, 0x40, 0x60, 0xD2, 0x24,
+0xD5, 0xB0, 0xE0, 0x01, 0x50, 0x90, 0x02, 0xF0, 0x01, 0x02, 0x60, 0x70, 0x02, 0x70, 0x60, 0x30,
+0x71, 0x90, 0xE0, 0xD1, 0x2F, 0x14, 0xD0, 0x20, 0xD4, 0x22, 0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x2F,
+0x19, 0xD1, 0xB1, 0xD0, 0x2F, 0x14, 0xD1, 0x10, 0x31, 0x50, 0x02, 0x50, 0x30, 0x00, 0x50, 0x07,
+0x80, 0x70, 0x08, 0x30, 0x0A, 0xF2, 0x30, 0x70, 0x04, 0x70, 0x90, 0x70, 0x02, 0xA0, 0x71, 0x01,
+0x70, 0x02, 0x50, 0x80, 0x90, 0x05, 0x30, 0x04, 0x30, 0x07, 0x10, 0x00, 0xF0, 0x51, 0x30, 0xC0,
+0x30, 0x90, 0xA0, 0x11, 0x30, 0x60, 0xB0, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x2F, 0x1D, 0xD0, 0x40,
+0xD1, 0x2F, 0x1E, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x28, 0xD1, 0x25, 0xD1,
+0x40, 0xB1, 0x60, 0xD8, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD1, 0xB0, 0xA0, 0x71, 0x81, 0xA0, 0xF0,
+0xA0, 0xC1, 0x80, 0x02, 0xF0, 0x62, 0xC0, 0x60, 0x50, 0xA0, 0x90, 0x80, 0x30, 0xE0, 0xD1, 0x2F,
+0x12, 0xD3, 0x22, 0x60, 0x40, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD2, 0x2F, 0x18, 0xD1, 0xB1,
+0xD0, 0x2F, 0x0B, 0xD2, 0x24, 0xD2, 0xC0, 0x80, 0x05, 0x30, 0x51, 0x07, 0x30, 0x09, 0x30, 0x0D,
+0x30, 0x07, 0x51, 0x01, 0x50, 0xA0, 0x33, 0xA0, 0x30, 0x80, 0x61, 0xF0, 0x05, 0x30, 0xF0, 0x03,
+0x30, 0x06, 0xF0, 0x10, 0x31, 0xC2, 0x10, 0x80, 0x00, 0x11, 0x80, 0x10, 0xE0, 0xD2, 0x20, 0xD0,
+0xB1, 0xD1, 0x2F, 0x1C, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x2F, 0x1E, 0xD0, 0xB1, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x27, 0xD3, 0x24, 0xD0, 0x20, 0xC0, 0x60, 0xB0, 0xE0, 0xD3, 0x20, 0xD1,
+0x20, 0xD0, 0x27, 0xD0, 0xB0, 0x60, 0x91, 0x30, 0x60, 0x50, 0x70, 0xA0, 0x00, 0xF0, 0x60, 0x02,
+0x80, 0x70, 0x00, 0xF1, 0x00, 0xF0, 0x80, 0x01, 0x70, 0xE0, 0xDF, 0x11, 0x22, 0xD6, 0xC0, 0xA0,
+0xD3, 0x40, 0xDF, 0x21, 0xB1, 0xDF, 0x17, 0xA0, 0x70, 0x06, 0x60, 0x50, 0x07, 0xA0, 0x09, 0x30,
+0x0D, 0xA0, 0x30, 0x80, 0x91, 0x50, 0x71, 0xF0, 0x01, 0x51, 0x00, 0x30, 0x51, 0x70, 0xF0, 0x90,
+0x70, 0x00, 0x70, 0x30, 0x06, 0x80, 0xF0, 0x03, 0xA0, 0x05, 0x70, 0xC0, 0x01, 0xF0, 0xC0, 0x00,
+0xA0, 0x50, 0x90, 0x10, 0x80, 0x10, 0x60, 0x30, 0xE0, 0xD4, 0xB1, 0xDF, 0x21, 0x40, 0xDF, 0x21,
+0xB1, 0xDF, 0x04, 0x21, 0xD3, 0x40, 0xD5, 0xE1, 0xDC, 0xB0, 0xE0, 0x01, 0xF0, 0xC0, 0x50, 0xF0,
+0x80, 0x01, 0xA0, 0x02, 0xA0, 0xC0, 0xA0, 0xF0, 0x01, 0xF0, 0x30, 0x01, 0x50, 0xE0, 0xDF, 0x1B,
+0xB0, 0x40, 0xD3, 0x40, 0xDF, 0x21, 0xB1, 0xDF, 0x17, 0xB0, 0x60, 0x06, 0x70, 0x90, 0x06, 0x70,
+0x80, 0x09, 0x30, 0x0D, 0xA0, 0x00, 0xF0, 0x70, 0x50, 0x91, 0x80, 0x32, 0xA0, 0x81, 0xA0, 0x30,
+0x90, 0x51, 0x03, 0xA0, 0x06, 0x80, 0x70, 0x03, 0xA0, 0x04, 0xF0, 0xC0, 0x04, 0xC0, 0xF0, 0x01,
+0x12, 0xC0, 0xA0, 0x60, 0xD5, 0xB0, 0xDF, 0x21, 0x40, 0xDF, 0x21, 0xB1, 0xDF, 0x10, 0xA0, 0xC0,
+0xDD, 0x50, 0xA0, 0x01, 0x50, 0x80, 0xA0, 0x60, 0x10, 0xC1, 0x80, 0x02, 0x60, 0xF0, 0x90, 0xC0,
+0x60, 0x90, 0x50, 0x13, 0xE0, 0xBF, 0x10, 0x40, 0xBA, 0x40, 0xA0, 0xB2, 0x40, 0xB4, 0x40, 0xBF,
+0x1B, 0x41, 0xBF, 0x13, 0x40, 0xB0, 0x40, 0xB0, 0xE0, 0x90, 0x57, 0x30, 0x56, 0x80, 0x90, 0x59,
+0x80, 0x5D, 0x30, 0x70, 0x52, 0x78, 0x50, 0x80, 0x90, 0x50, 0x70, 0x53, 0x80, 0x30, 0x55, 0x30,
+0x90, 0x52, 0x70, 0x31, 0x90, 0x51, 0x70, 0x30, 0x80, 0x70, 0x52, 0xA0, 0x80, 0x52, 0x30, 0x60,
+0xA2, 0x40, 0xB4, 0x41, 0xBF, 0x21, 0x41, 0xBF, 0x19, 0x40, 0xB5, 0x41, 0xBF, 0x03, 0x47, 0xB4,
+0x40, 0xE0, 0x43, 0xB2, 0x44, 0xB0, 0x41, 0x13, 0x90, 0x00, 0xF0, 0x51, 0x01, 0x02, 0x60, 0xF0,
+0x01, 0x50, 0x30, 0xA1, 0x81, 0x30, 0xE0, 0xD0, 0x2F, 0x1A, 0xD0, 0xE0, 0x10, 0x40, 0xD0, 0x20,
+0x40, 0xD1, 0x2F, 0x1E, 0xD0, 0x40, 0xB0, 0x2F, 0x16, 0xD0, 0x40, 0xE0, 0x01, 0xF2, 0x00, 0xF0,
+0x00, 0x90, 0xA0, 0x01, 0xF2, 0x00, 0x30, 0xF0, 0x00, 0xF3, 0x00, 0xF1, 0x00, 0x91, 0x00, 0xF2,
+0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF2, 0x30, 0x00, 0xF1, 0x00, 0xF1, 0x02, 0xF0, 0x01,
+0x50, 0x90, 0x80, 0x30, 0x90, 0xF0, 0x00, 0xF1, 0x01, 0x90, 0x30, 0xF0, 0x00, 0xF1, 0x00, 0x80,
+0x50, 0x00, 0xF0, 0x00, 0x90, 0xC0, 0xF0, 0x80, 0xA3, 0x00, 0xF1, 0x00, 0x91, 0x01, 0xF1, 0x00,
+0x90, 0x10, 0xC0, 0x60, 0xD1, 0x23, 0xB0, 0x40, 0xD0, 0x2F, 0x1F, 0xD0, 0x40, 0xD0, 0x2F, 0x20,
+0xB1, 0xD0, 0x2F, 0x03, 0xD2, 0x24, 0xD0, 0x20, 0xD0, 0x60, 0x40, 0xD2, 0x2A, 0xD0, 0xB0, 0x60,
+0x81, 0x30, 0x81, 0x62, 0xA0, 0x70, 0x02, 0x80, 0x04, 0xF0, 0x80, 0x01, 0x70, 0xE0, 0xDF, 0x17,
+0x21, 0xD3, 0xC0, 0x60, 0xD1, 0x40, 0xDF, 0x21, 0xB1, 0xDF, 0x18, 0x60, 0x07, 0x50, 0x91, 0x04,
+0x30, 0x06, 0xC0, 0x01, 0x80, 0x70, 0x0C, 0xF0, 0x30, 0x09, 0xF0, 0x90, 0x70, 0x51, 0x80, 0xF0,
+0x90, 0x50, 0x04, 0x80, 0x30, 0x03, 0x80, 0x50, 0x02, 0x60, 0x04, 0x91, 0x03, 0xA0, 0x05, 0x30,
+0x11, 0xE0, 0xD5, 0x20, 0xB0, 0xDF, 0x00, 0x20, 0xD1, 0x20, 0xDF, 0x0D, 0x40, 0xDF, 0x1F, 0x20,
+0xD0, 0xB1, 0xDF, 0x09, 0x20, 0xD4, 0x60, 0xB0, 0xD4, 0x20, 0xD8, 0xB0, 0xE0, 0x01, 0x70, 0x60,
+0x30, 0xF0, 0x01, 0x70, 0x60, 0x03, 0x81, 0x01, 0xF0, 0x81, 0x00, 0xF0, 0x90, 0xE0, 0xDF, 0x14,
+0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0xA0, 0xC0, 0xB0, 0xD0, 0x40, 0xD2, 0x20, 0xD4, 0x21, 0xDF,
+0x16, 0xB1, 0xD3, 0x20, 0xDF, 0x07, 0x21, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0x80, 0x06, 0x50,
+0x00, 0xA0, 0xF0, 0x03, 0xC0, 0x31, 0x80, 0x50, 0xF0, 0x50, 0xC0, 0x30, 0x01, 0xA0, 0x0B, 0x71,
+0xF0, 0x80, 0x08, 0x90, 0x50, 0x00, 0xF0, 0x50, 0x70, 0xC0, 0x50, 0x00, 0x70, 0x90, 0x70, 0x02,
+0x90, 0x50, 0x02, 0xF0, 0x30, 0x01, 0x30, 0xC0, 0x70, 0x05, 0xA0, 0x50, 0x01, 0x81, 0x05, 0x30,
+0x60, 0x10, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD9, 0x20, 0xD0,
+0x20, 0xD1, 0x20, 0xDF, 0x08, 0x20, 0xD3, 0x40, 0xDF, 0x16, 0x20, 0xD1, 0x21, 0xD3, 0x20, 0xD0,
+0xB1, 0xDF, 0x00, 0x21, 0xD5, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD5, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0x23, 0xD0, 0xB0, 0xA0, 0xF1, 0x50, 0xC0, 0x70, 0x03, 0xA0, 0x02, 0x32, 0x60, 0xF1, 0xC0,
+0xA0, 0x32, 0xE0, 0xD1, 0x2F, 0x0E, 0xD2, 0x21, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0xD1, 0x40,
+0xD2, 0x21, 0xD1, 0x2F, 0x18, 0xD1, 0xB1, 0xD1, 0x23, 0xD1, 0x2F, 0x0D, 0xD3, 0x60, 0x06, 0x50,
+0x00, 0xF0, 0xA0, 0x01, 0x50, 0xC0, 0x90, 0x00, 0xF0, 0x70, 0x90, 0x30, 0xC0, 0x10, 0x80, 0x50,
+0x70, 0xA0, 0x0D, 0x70, 0x80, 0x06, 0x50, 0x90, 0x02, 0x90, 0x00, 0x70, 0xA0, 0x71, 0x01, 0x70,
+0x90, 0xF0, 0x00, 0xF0, 0xC0, 0x50, 0x01, 0x50, 0x10, 0xA0, 0x60, 0x90, 0x70, 0x06, 0x50, 0xC0,
+0x80, 0xA0, 0x90, 0x00, 0x30, 0x90, 0x00, 0x70, 0x00, 0xF0, 0x70, 0x90, 0xE0, 0x10, 0xD2, 0x20,
+0xD1, 0xB1, 0xD0, 0x2B, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x2F, 0x05, 0xD1, 0x24, 0xD0,
+0x40, 0xD1, 0x2F, 0x1A, 0xD1, 0x21, 0xD0, 0xB1, 0xD0, 0x2F, 0x0C, 0xD5, 0x2B, 0xD1, 0x60, 0x80,
+0x30, 0xA0, 0x30, 0x60, 0xA0, 0x31, 0x60, 0x30, 0x02, 0x60, 0x01, 0x90, 0x60, 0x00, 0x60, 0x80,
+0x01, 0x70, 0xE0, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD3, 0x21, 0xD7, 0x40, 0x10, 0xB0, 0xD0, 0x40, 0xD2, 0x21, 0xD2, 0x22, 0xD2, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0xB1, 0xD3,
+0x21, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD5, 0x22, 0xD1, 0xA0, 0x06, 0x90, 0x01, 0x90, 0x50, 0xF0, 0x11,
+0x30, 0x06, 0x70, 0x90, 0x80, 0xC0, 0x30, 0xA0, 0x80, 0x90, 0x50, 0xF1, 0x06, 0x70, 0x90, 0x04,
+0x70, 0x90, 0x70, 0x02, 0x71, 0x00, 0x70, 0x60, 0x00, 0x90, 0x03, 0x51, 0x01, 0xA0, 0xF0, 0x00,
+0x30, 0x90, 0x09, 0x70, 0x30, 0x00, 0x70, 0x02, 0x70, 0x50, 0x80, 0x10, 0xC0, 0xA0, 0x90, 0xA0,
+0xC0, 0x10, 0xA0, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD5, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x21, 0xD0, 0x21, 0xD0, 0x40, 0xD3, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD7, 0x23, 0xD0, 0x21, 0xD0, 0xB1,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0x27,
+0xD1, 0x23, 0xD1, 0x20, 0xDB, 0xB0, 0xE0, 0x01, 0x50, 0x90, 0x00, 0x50, 0x91, 0x70, 0x00, 0x02,
+0x60, 0x90, 0x01, 0x80, 0xC0, 0x60, 0x80, 0x01, 0x70, 0xE0, 0xD0, 0x2F, 0x16, 0xD2, 0x20, 0xD1,
+0x60, 0x70, 0xA0, 0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x2F, 0x1A, 0xD0, 0xB1, 0xD0, 0x2F, 0x0E, 0xD0,
+0x20, 0xD2, 0x22, 0xD1, 0x60, 0x70, 0x05, 0x50, 0x02, 0xA0, 0x70, 0x30, 0x50, 0xC0, 0x08, 0x70,
+0x80, 0x01, 0x70, 0x50, 0x90, 0x80, 0x32, 0xA1, 0x30, 0x80, 0x50, 0x81, 0x03, 0x90, 0x70, 0x04,
+0x50, 0x01, 0x70, 0x60, 0x00, 0x71, 0x03, 0xF0, 0x90, 0x70, 0x50, 0x31, 0xC0, 0x09, 0x50, 0xC0,
+0x90, 0x80, 0x30, 0xA0, 0x30, 0xA0, 0x30, 0x90, 0x70, 0xF0, 0x02, 0x90, 0xC0, 0x11, 0xB0, 0xD3,
+0x40, 0x22, 0xD1, 0x2E, 0xD0, 0x2F, 0x0D, 0x40, 0xD1, 0x2F, 0x1E, 0xD0, 0x40, 0xD1, 0x2F, 0x08,
+0xD0, 0x24, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD5, 0x21, 0xD0, 0xB0, 0xE0, 0x01, 0x50, 0x90,
+0x03, 0x90, 0x80, 0x03, 0xA0, 0xF0, 0x01, 0x90, 0xA1, 0x80, 0x31, 0xE0, 0xD1, 0x2F, 0x15, 0xD1,
+0x20, 0xD1, 0xE0, 0x90, 0x00, 0xA0, 0xD0, 0x40, 0xD2, 0x21, 0xD1, 0x24, 0xD0, 0x2F, 0x0E, 0xD5,
+0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x2F, 0x06, 0xD5, 0x23, 0xD0, 0x40, 0xA0, 0x60, 0x04, 0x50,
+0x02, 0xF0, 0x10, 0xA0, 0x0A, 0x50, 0x90, 0x0B, 0xA0, 0x50, 0x90, 0x80, 0x30, 0xA1, 0x80, 0x39,
+0x80, 0xC0, 0x01, 0x90, 0x05, 0xF0, 0x90, 0x60, 0x50, 0x80, 0x10, 0x91, 0x80, 0x34, 0xA0, 0x30,
+0x90, 0x70, 0x90, 0x60, 0x09, 0x90, 0x80, 0x61, 0xE0, 0xD3, 0x40, 0xD0, 0x21, 0xD0, 0x2C, 0xD2,
+0x20, 0xD0, 0x2F, 0x04, 0xD1, 0x22, 0xD0, 0x21, 0x40, 0xD1, 0x20, 0xD3, 0x2F, 0x0C, 0xD0, 0x22,
+0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x2E, 0xD3, 0x24, 0xD0, 0x20, 0xD1, 0x22,
+0xD0, 0x27, 0xD3, 0x20, 0xD1, 0xB0, 0x60, 0x81, 0xA0, 0x50, 0x02, 0x50, 0x90, 0x50, 0x09, 0x30,
+0xF1, 0x70, 0xE0, 0xD1, 0x2F, 0x0F, 0xD1, 0x23, 0xD1, 0x21, 0xD0, 0xA0, 0x80, 0x90, 0x60, 0xD0,
+0x40, 0xD2, 0x21, 0xD2, 0x2F, 0x07, 0xDF, 0x02, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x2F, 0x07,
+0xD0, 0x21, 0xD1, 0x23, 0xD0, 0xE0, 0x60, 0x30, 0xA0, 0x70, 0x02, 0x50, 0xF0, 0x02, 0x30, 0x50,
+0x0A, 0x90, 0x50, 0x0B, 0xA1, 0x32, 0x81, 0x90, 0x04, 0x70, 0x50, 0x00, 0xF0, 0x00, 0x50, 0x60,
+0x70, 0x50, 0x91, 0x51, 0x93, 0x50, 0xC0, 0x80, 0x30, 0x10, 0x50, 0x70, 0xF2, 0x05, 0xA0, 0x30,
+0x0A, 0x80, 0x10, 0x61, 0xD1, 0x20, 0xD1, 0x40, 0xD9, 0x25, 0xD0, 0x21, 0xD0, 0xB0, 0xD1, 0x2E,
+0xD1, 0x21, 0xD1, 0x22, 0xD1, 0x20, 0xB0, 0xDF, 0x03, 0x2F, 0x00, 0xD1, 0x21, 0xD1, 0x21, 0xD0,
+0x20, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x2E, 0xD9, 0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x25, 0xD1,
+0x21, 0xD1, 0x40, 0x80, 0xF1, 0x80, 0x50, 0x02, 0xF0, 0x31, 0x09, 0x30, 0x01, 0xF0, 0xE0, 0xD6,
+0x21, 0xD1, 0x2B, 0xD2, 0x2C, 0xD4, 0xB0, 0x42, 0xD0, 0x40, 0xD2, 0x20, 0xD4, 0x2F, 0x06, 0xDB,
+0xB4, 0x42, 0xD1, 0x23, 0xD4, 0x20, 0xD0, 0x22, 0xD2, 0x20, 0xD1, 0x23, 0xD2, 0x29, 0xD4, 0x90,
+0xC0, 0xF0, 0x70, 0x50, 0x90, 0x70, 0x02, 0x50, 0x80, 0x0A, 0x80, 0x70, 0x0B, 0x30, 0x00, 0x70,
+0x90, 0x70, 0xF0, 0x70, 0xA0, 0x04, 0x90, 0x03, 0x70, 0x60, 0x94, 0x52, 0x70, 0xC0, 0x30, 0x90,
+0xF0, 0x50, 0xC0, 0x70, 0x07, 0xF0, 0x60, 0x50, 0x0B, 0x90, 0x10, 0xC0, 0xD1, 0x21, 0xD1, 0x41,
+0xB1, 0xD6, 0x27, 0xD0, 0x20, 0x60, 0xD1, 0x21, 0xD4, 0x24, 0xD0, 0x21, 0xD2, 0x20, 0xD0, 0x23,
+0xD1, 0xB0, 0x42, 0xB4, 0xDC, 0x2C, 0xD2, 0x22, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0x40, 0xD1, 0x20,
+0xD3, 0x21, 0xD0, 0x27, 0xD1, 0x24, 0xD2, 0x2B, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40,
+0x90, 0x01, 0x90, 0x70, 0x05, 0x09, 0xA0, 0x02, 0xE0, 0xD1, 0x24, 0xD1, 0x20, 0xD0, 0x22, 0xD2,
+0x21, 0xD2, 0x25, 0xD2, 0x21, 0xD8, 0x20, 0xD3, 0x20, 0xD0, 0x40, 0xD2, 0x23, 0xDF, 0x08, 0x21,
+0xB1, 0x46, 0xB4, 0xD2, 0x40, 0xD0, 0x29, 0xD0, 0x20, 0xD2, 0x22, 0xD0, 0x20, 0xD5, 0x21, 0xD2,
+0x21, 0xD6, 0xB0, 0x42, 0xE0, 0xA0, 0x70, 0xF0, 0x00, 0x90, 0x02, 0xF0, 0x10, 0xF0, 0x09, 0x30,
+0x0C, 0x30, 0x90, 0x50, 0x03, 0x30, 0x03, 0xF0, 0x50, 0x03, 0x70, 0x30, 0xF0, 0x02, 0x50, 0x03,
+0x30, 0x10, 0xF0, 0x01, 0x70, 0x90, 0x50, 0x05, 0x90, 0x30, 0x01, 0x80, 0xA0, 0x30, 0x60, 0x50,
+0xF0, 0x90, 0x03, 0x50, 0x10, 0xE0, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xB0,
+0x43, 0xB1, 0xDF, 0x00, 0x20, 0xD4, 0x21, 0xD1, 0x21, 0xD3, 0x24, 0xD2, 0xB1, 0xD2, 0xB3, 0x47,
+0xB1, 0xDF, 0x09, 0x21, 0xD1, 0x21, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x28, 0xD3, 0x23,
+0xD1, 0x22, 0xD3, 0x20, 0xD1, 0x25, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0xE0, 0x50, 0x01,
+0x80, 0x70, 0x05, 0x09, 0x60, 0xA2, 0x60, 0xD1, 0x26, 0xD5, 0x21, 0xD1, 0x22, 0xD6, 0x2D, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0x40, 0x24, 0xDD, 0xB3, 0x47, 0xB2, 0x20, 0xDE, 0x40, 0xD0, 0x20, 0xD6,
+0x26, 0xD2, 0x20, 0xD0, 0x25, 0xD6, 0xB2, 0x43, 0xB0, 0xD1, 0x40, 0xE0, 0xB0, 0xA0, 0x01, 0x90,
+0x02, 0x30, 0x50, 0x0A, 0xA0, 0x0B, 0x50, 0x30, 0x04, 0x70, 0x80, 0x03, 0x90, 0x04, 0x50, 0x90,
+0x50, 0x02, 0x71, 0x02, 0x90, 0x80, 0x04, 0xF0, 0x50, 0xF0, 0x00, 0x70, 0x50, 0x80, 0x10, 0x80,
+0xA1, 0xF0, 0x02, 0x30, 0x80, 0x90, 0x60, 0x50, 0x01, 0x60, 0xB0, 0xD2, 0x22, 0xD0, 0xB1, 0xD6,
+0x20, 0xB0, 0x42, 0xB2, 0xD6, 0x26, 0xD0, 0x20, 0xD1, 0x21, 0xD4, 0x26, 0xD1, 0xB0, 0x20, 0xDD,
+0x20, 0xB2, 0x46, 0xB4, 0xDE, 0x23, 0x40, 0xD1, 0x26, 0xD5, 0x24, 0xD2, 0x21, 0xD1, 0x23, 0xD0,
+0x24, 0xD3, 0x26, 0xD0, 0x80, 0x60, 0xA0, 0x30, 0xC0, 0xF0, 0x05, 0x09, 0x30, 0x02, 0xA0, 0xD1,
+0x2C, 0xD0, 0x20, 0xD4, 0x26, 0xD0, 0x20, 0xDF, 0x02, 0xB0, 0xD3, 0x24, 0xB4, 0x44, 0xB3, 0xDC,
+0x20, 0xD0, 0x25, 0xD1, 0x21, 0xD1, 0x40, 0xD0, 0x24, 0xD3, 0x23, 0xDD, 0x21, 0xB1, 0x41, 0xB2,
+0xD6, 0xE1, 0x70, 0xA0, 0xF0, 0x00, 0x90, 0xC0, 0x00, 0x70, 0x30, 0x0A, 0xF0, 0x30, 0x09, 0x70,
+0x50, 0x70, 0x30, 0x04, 0x70, 0x80, 0x02, 0x50, 0x70, 0x04, 0x50, 0x91, 0x03, 0x90, 0x02, 0xA0,
+0x80, 0x91, 0x80, 0xA1, 0xC0, 0xA0, 0x80, 0x30, 0xC0, 0x51, 0xF0, 0x00, 0xA1, 0x07, 0x81, 0x30,
+0x60, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0xB0, 0xD4, 0x20, 0xD7, 0xB2, 0x40, 0xB2, 0x21, 0xD9, 0x2E,
+0xD1, 0x40, 0x2E, 0xDC, 0xB2, 0x44, 0xB5, 0x21, 0xD5, 0x40, 0xD8, 0x25, 0xD4, 0x20, 0xD0, 0x20,
+0xD1, 0x23, 0xD9, 0x28, 0xD0, 0xE0, 0x70, 0x01, 0x80, 0xF0, 0x05, 0x09, 0x30, 0x02, 0xA0, 0xDD,
+0x28, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x24, 0xDA, 0xB2, 0x41, 0xB0, 0x44, 0xB4, 0x21, 0xDE, 0x27,
+0xD4, 0x24, 0xD2, 0x40, 0xD0, 0x21, 0xD3, 0x29, 0xD5, 0xB2, 0x41, 0xB2, 0x20, 0xD8, 0x20, 0xD4,
+0xA0, 0x70, 0x00, 0x70, 0x80, 0x00, 0x30, 0xF0, 0x0A, 0x70, 0x90, 0x07, 0xF0, 0x90, 0x70, 0x00,
+0xF0, 0x30, 0x04, 0x70, 0x80, 0x02, 0x50, 0x05, 0x50, 0x91, 0x03, 0x70, 0x50, 0x01, 0xC0, 0x52,
+0x70, 0x30, 0x80, 0x10, 0x90, 0x01, 0x80, 0x70, 0x00, 0xF0, 0x10, 0x00, 0xA0, 0x80, 0x07, 0xC0,
+0x40, 0xD3, 0x23, 0xD0, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xDA, 0x20, 0xB1, 0x42, 0xB1, 0xD8, 0x25,
+0xD7, 0x40, 0xD2, 0x24, 0xD6, 0x25, 0xDE, 0x21, 0xB5, 0x43, 0xB1, 0x40, 0xB1, 0xDC, 0x2F, 0x08,
+0xD9, 0xE0, 0xF0, 0x01, 0x80, 0xF0, 0x05, 0x09, 0x30, 0x91, 0x80, 0xC0, 0xD8, 0x27, 0xDF, 0x02,
+0x21, 0xB1, 0x46, 0xB3, 0x40, 0xDE, 0x25, 0xD0, 0x2C, 0xD7, 0x20, 0xD1, 0x20, 0xD1, 0xB1, 0xD2,
+0x21, 0xDB, 0xB1, 0x42, 0xB1, 0xD7, 0x21, 0xD2, 0x22, 0xD2, 0x20, 0xD1, 0xA1, 0x33, 0xC0, 0x90,
+0x0A, 0x90, 0x50, 0x06, 0x90, 0x50, 0x02, 0x70, 0x80, 0x04, 0xF0, 0xA0, 0x60, 0x00, 0x50, 0x06,
+0x50, 0x90, 0x50, 0x04, 0x90, 0x00, 0x30, 0x50, 0x03, 0x30, 0x04, 0x80, 0x50, 0x90, 0x50, 0x70,
+0x01, 0x10, 0xC0, 0x05, 0x30, 0x40, 0xD4, 0x22, 0xD0, 0xB1, 0xD1, 0x21, 0xD2, 0x27, 0xD9, 0xB1,
+0x43, 0xB0, 0x20, 0xDD, 0x20, 0xD1, 0x40, 0x21, 0xD0, 0x23, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x26,
+0xDF, 0x0A, 0xB0, 0x40, 0xB3, 0x45, 0xB2, 0x20, 0xDF, 0x04, 0x22, 0xD4, 0x20, 0xD5, 0xE0, 0x30,
+0x80, 0x50, 0xA0, 0x06, 0x09, 0x81, 0x70, 0xF0, 0xA0, 0xD1, 0x25, 0xDF, 0x00, 0xB3, 0x47, 0xB1,
+0x21, 0xD4, 0x20, 0xD3, 0x40, 0xD8, 0x22, 0xD1, 0x21, 0xD4, 0x20, 0xDD, 0x23, 0xD3, 0x21, 0xD2,
+0xB1, 0xDA, 0xB1, 0x43, 0xB0, 0x20, 0xD7, 0x2F, 0x02, 0xD0, 0x40, 0x90, 0x01, 0x50, 0x00, 0xC0,
+0xF0, 0x0A, 0x80, 0x70, 0x04, 0x51, 0x04, 0x50, 0x90, 0x06, 0x70, 0xA1, 0x80, 0x70, 0x00, 0x71,
+0x01, 0x70, 0x90, 0x50, 0x05, 0x90, 0xC0, 0x04, 0x30, 0x04, 0xF0, 0x30, 0x00, 0x70, 0x90, 0xF0,
+0x00, 0x70, 0x31, 0x03, 0xF0, 0xC0, 0xD1, 0x21, 0xD2, 0x21, 0xD0, 0xB0, 0x20, 0xD0, 0x24, 0xD0,
+0x29, 0xD0, 0x20, 0xD0, 0x20, 0xD9, 0xB1, 0x43, 0xB1, 0xD7, 0x21, 0xD0, 0x40, 0xD3, 0x2C, 0xD2,
+0x27, 0xD1, 0x22, 0xDA, 0x20, 0xD3, 0x20, 0xB0, 0xD9, 0x20, 0xB2, 0x47, 0xB2, 0xDD, 0x21, 0xD0,
+0x25, 0xD0, 0xA0, 0x71, 0x50, 0xA0, 0x06, 0x09, 0x90, 0x70, 0x01, 0x30, 0xB0, 0xD8, 0x22, 0xB4,
+0x44, 0xB3, 0xDE, 0x26, 0xD0, 0x40, 0xD1, 0x29, 0xD3, 0x23, 0xD1, 0x21, 0xD8, 0x2B, 0xD4, 0xB0,
+0xD4, 0xB2, 0x42, 0xB1, 0xDA, 0x2F, 0x05, 0xD0, 0xB0, 0xA0, 0x01, 0x70, 0x90, 0x00, 0x30, 0x80,
+0x09, 0x30, 0xF0, 0x01, 0x50, 0x30, 0x50, 0xF0, 0x05, 0x90, 0x50, 0x07, 0x90, 0x00, 0x50, 0xA0,
+0xC1, 0xA2, 0x31, 0x90, 0x05, 0x30, 0x50, 0x04, 0xA0, 0x02, 0x50, 0x80, 0x00, 0xA0, 0x02, 0x51,
+0x01, 0x80, 0x30, 0x01, 0xF0, 0x10, 0xB0, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x23, 0xD0,
+0x29, 0xD0, 0x28, 0xDA, 0xB1, 0x41, 0xB2, 0x20, 0xD4, 0x40, 0xD4, 0x2A, 0xD7, 0x25, 0xD2, 0x22,
+0xD1, 0x29, 0xD0, 0x20, 0xB0, 0xD0, 0x25, 0xDE, 0xB3, 0x45, 0xB3, 0x22, 0xD9, 0xA0, 0xF0, 0x01,
+0x30, 0x06, 0x09, 0x90, 0x50, 0x01, 0xE0, 0x40, 0xD0, 0xB3, 0x45, 0xB4, 0xD0, 0x20, 0xDF, 0x09,
+0x23, 0xD1, 0x40, 0xD1, 0x22, 0xD1, 0x25, 0xD0, 0x2F, 0x00, 0xD3, 0x25, 0xD0, 0x22, 0xD5, 0x40,
+0xB1, 0x42, 0xB1, 0x20, 0xDC, 0x25, 0xD3, 0x26, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0x60, 0x01, 0xF0,
+0xC0, 0x80, 0x00, 0x50, 0xA0, 0x50, 0x07, 0x30, 0x01, 0xF0, 0x80, 0x70, 0x07, 0x80, 0x70, 0x06,
+0x71, 0x04, 0x70, 0x01, 0x50, 0x90, 0xA0, 0x70, 0x04, 0xA0, 0x90, 0x04, 0xA0, 0x02, 0xF0, 0x01,
+0x30, 0x03, 0xF0, 0x51, 0x00, 0x30, 0x50, 0xA0, 0x10, 0x40, 0xD3, 0x22, 0xD3, 0x40, 0xD3, 0x21,
+0xD5, 0x29, 0xD0, 0x26, 0xDB, 0x20, 0xB2, 0x41, 0xB3, 0xD6, 0x26, 0xD1, 0x2F, 0x02, 0xD0, 0x2A,
+0xD2, 0xB1, 0xD1, 0x24, 0xDF, 0x07, 0x22, 0xB4, 0x44, 0xB3, 0xD1, 0xA0, 0xF0, 0x01, 0x30, 0x06,
+0x09, 0x70, 0xC0, 0x31, 0x60, 0xE0, 0xB4, 0xDB, 0x20, 0xDF, 0x0F, 0x40, 0xD2, 0x20, 0xD1, 0x24,
+0xD4, 0x22, 0xD0, 0x2C, 0xDB, 0x20, 0xB0, 0x43, 0xB1, 0xD7, 0x2F, 0x00, 0xD5, 0x27, 0xD6, 0xA0,
+0x70, 0x91, 0xE1, 0x60, 0x50, 0x00, 0x80, 0xA0, 0xF0, 0x05, 0x30, 0x00, 0x51, 0x09, 0x30, 0xF0,
+0x06, 0x90, 0x08, 0x50, 0x00, 0x90, 0x30, 0x81, 0x32, 0xC0, 0x90, 0x70, 0x03, 0xA0, 0x02, 0x90,
+0xF0, 0x00, 0x91, 0x04, 0x70, 0x90, 0xF0, 0xC0, 0x10, 0x40, 0xD0, 0x21, 0xD1, 0x21, 0xD1, 0x20,
+0xD0, 0x42, 0xB0, 0xD9, 0x27, 0xD2, 0x2E, 0xD0, 0x22, 0xD5, 0xB1, 0x43, 0xB1, 0xD8, 0x22, 0xD2,
+0x2E, 0xD1, 0x29, 0xD2, 0xB1, 0xDF, 0x1C, 0xB4, 0x60, 0x31, 0xA1, 0x06, 0x09, 0xF0, 0x80, 0x01,
+0x50, 0xE0, 0xDF, 0x02, 0x2F, 0x08, 0xD6, 0x40, 0xD1, 0x21, 0xD1, 0x25, 0xD1, 0x2F, 0x00, 0xD8,
+0xB1, 0x44, 0xB0, 0xD2, 0x40, 0xD8, 0x2F, 0x01, 0xD0, 0x26, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20,
+0xD3, 0xB0, 0x41, 0x80, 0x00, 0xF0, 0xA0, 0x50, 0x70, 0x60, 0x80, 0x01, 0xA0, 0x30, 0x04, 0xA0,
+0x50, 0x70, 0x02, 0x50, 0x70, 0x05, 0xA0, 0x06, 0x50, 0x70, 0x08, 0x50, 0x00, 0x91, 0x71, 0xF1,
+0x00, 0x30, 0x91, 0x03, 0x30, 0x06, 0xC0, 0x06, 0x70, 0x80, 0xE0, 0xD2, 0x21, 0xD1, 0x20, 0xD3,
+0x40, 0xD1, 0xB0, 0x41, 0xB0, 0xD7, 0x28, 0xD2, 0x2F, 0x01, 0xD7, 0x40, 0xD2, 0x20, 0xB0, 0x43,
+0xB1, 0xD6, 0x22, 0xD0, 0x23, 0xD0, 0x25, 0xD2, 0x27, 0xD0, 0x21, 0xD2, 0xB0, 0x20, 0xDA, 0x23,
+0xD0, 0x2D, 0xDF, 0x03, 0xA0, 0x02, 0xA0, 0x06, 0x09, 0xF0, 0x80, 0x01, 0x70, 0xE0, 0xD0, 0x29,
+0xD4, 0x25, 0xD0, 0x2F, 0x07, 0xD2, 0xB0, 0x20, 0xD0, 0x21, 0xD1, 0x24, 0xD3, 0x23, 0xDD, 0x20,
+0xB1, 0x42, 0xB1, 0xD5, 0x21, 0xD0, 0xB1, 0xD2, 0x20, 0xD4, 0x2C, 0xD4, 0x24, 0xD0, 0x20, 0xD0,
+0x20, 0xD4, 0x20, 0xB0, 0x40, 0xB0, 0xD0, 0x40, 0xA0, 0x01, 0xA0, 0x40, 0xD0, 0xB0, 0xA0, 0x02,
+0x70, 0xA0, 0x30, 0x80, 0x90, 0x31, 0x50, 0xA0, 0x30, 0xA1, 0xC0, 0x90, 0x30, 0xA0, 0x31, 0x80,
+0x90, 0xC0, 0x05, 0xF0, 0x50, 0x09, 0x50, 0x00, 0x90, 0x50, 0x04, 0x50, 0x60, 0x00, 0x50, 0x01,
+0xF0, 0x30, 0x05, 0x70, 0xA0, 0x07, 0x60, 0x41, 0xD4, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD4, 0xB0,
+0x41, 0xB0, 0xDA, 0x23, 0xD3, 0x20, 0xD0, 0x2A, 0xD3, 0x24, 0xD0, 0x40, 0xD1, 0x20, 0xD5, 0xB1,
+0x41, 0xB3, 0x20, 0xDD, 0x24, 0xD3, 0x21, 0xD1, 0x21, 0xD2, 0x40, 0xD9, 0x2F, 0x00, 0xD0, 0x26,
+0xD4, 0x29, 0xD0, 0xA0, 0x01, 0xF0, 0x30, 0x06, 0x0A, 0x30, 0x70, 0x50, 0x80, 0xA0, 0xD3, 0x2D,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x2F, 0x00, 0xD1,
+0xB1, 0xD4, 0x25, 0xD0, 0x23, 0xDA, 0xB1, 0x43, 0xB0, 0x20, 0xDD, 0xB1, 0xD0, 0x2E, 0xDA, 0x21,
+0xD1, 0x23, 0xD3, 0xB0, 0x40, 0xB0, 0x20, 0xD3, 0xA0, 0x00, 0xF0, 0x30, 0xB0, 0xD0, 0xB0, 0xE0,
+0x04, 0xF0, 0x80, 0x51, 0x80, 0x30, 0x50, 0x02, 0x80, 0x50, 0x02, 0xF0, 0x72, 0x05, 0x50, 0xF0,
+0x09, 0x50, 0x00, 0x90, 0x80, 0x04, 0x30, 0x90, 0x00, 0x50, 0xF0, 0x00, 0xF0, 0x30, 0x05, 0xF0,
+0x60, 0x06, 0x70, 0xC0, 0x70, 0xB0, 0x40, 0xB0, 0xD1, 0x24, 0xD0, 0x40, 0xD0, 0x22, 0xD4, 0xB0,
+0x40, 0xB1, 0xD4, 0x23, 0xDE, 0x2C, 0xD1, 0x40, 0xDC, 0x21, 0xB1, 0x42, 0xB2, 0xD9, 0x22, 0xD0,
+0x20, 0xD5, 0x22, 0xD2, 0x40, 0xD0, 0x2F, 0x03, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x2B, 0xD0, 0x21, 0xD1, 0x60, 0x51, 0x91, 0x06, 0x0A, 0x60, 0x90,
+0x51, 0xA0, 0xD1, 0x2E, 0xD5, 0x20, 0xD6, 0x2F, 0x00, 0xD1, 0xB1, 0xD5, 0x23, 0xDB, 0xB0, 0x43,
+0xB1, 0xD8, 0x21, 0xD9, 0x40, 0xD1, 0x23, 0xD0, 0x23, 0xDE, 0x21, 0xD7, 0xB0, 0x41, 0xD0, 0x40,
+0xD2, 0x20, 0xD1, 0x60, 0x00, 0xF0, 0xA0, 0x70, 0x40, 0xD0, 0x60, 0x03, 0x90, 0x50, 0x09, 0xA0,
+0x50, 0x0A, 0x70, 0x50, 0x0A, 0x50, 0x01, 0x10, 0x03, 0xF0, 0x30, 0x02, 0x50, 0x01, 0xA0, 0x06,
+0xA0, 0x06, 0xE0, 0x10, 0xD2, 0xB0, 0x40, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0x40, 0xD0, 0x23, 0xD6,
+0xB0, 0x40, 0xB0, 0xD6, 0x21, 0xDF, 0x03, 0x22, 0xD1, 0x23, 0xB0, 0xD7, 0x24, 0xD7, 0xB1, 0x42,
+0xB0, 0x20, 0xD6, 0x21, 0xD4, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0xD0, 0x2F, 0x02, 0xD6, 0x21, 0xD4,
+0x2B, 0xD0, 0x21, 0xD0, 0xB0, 0x30, 0x50, 0x90, 0xA0, 0x50, 0x06, 0x0A, 0xA0, 0x02, 0xA0, 0xD0,
+0x25, 0xD2, 0x2F, 0x05, 0xD9, 0x25, 0xD1, 0x20, 0xB0, 0xD5, 0x22, 0xD5, 0xB2, 0x43, 0xB0, 0xDF,
+0x01, 0x24, 0xD1, 0x21, 0xD0, 0x40, 0xD0, 0x24, 0xD0, 0x23, 0xD2, 0x2C, 0xD5, 0xB0, 0x41, 0xB0,
+0xD2, 0xE0, 0xB0, 0xD2, 0x20, 0xD0, 0xB0, 0x60, 0x00, 0x50, 0xA0, 0x40, 0xD0, 0xA0, 0xF0, 0x00,
+0x50, 0x90, 0x02, 0x50, 0x90, 0x07, 0x60, 0x50, 0x09, 0x90, 0x0B, 0x50, 0xF0, 0x00, 0x60, 0x80,
+0x02, 0x80, 0x50, 0x02, 0x90, 0x70, 0x00, 0xA0, 0x00, 0x90, 0x34, 0xC0, 0x60, 0x90, 0x81, 0x31,
+0x60, 0xA0, 0xC0, 0xD4, 0x41, 0xD3, 0x40, 0xD1, 0x22, 0xD1, 0x21, 0xD5, 0xB0, 0x41, 0xB0, 0xD4,
+0x2E, 0xD3, 0x23, 0xD1, 0x21, 0xD0, 0xB1, 0xD2, 0x27, 0xDE, 0x20, 0xB0, 0x43, 0xB1, 0xDA, 0x22,
+0xD1, 0xB0, 0xD0, 0x28, 0xD8, 0x2F, 0x04, 0xD9, 0x40, 0x50, 0x01, 0x80, 0x70, 0x06, 0x0A, 0xA0,
+0x02, 0xA0, 0xD0, 0x28, 0xD1, 0x21, 0xD3, 0x2C, 0xDA, 0x24, 0xD2, 0x40, 0xD8, 0x20, 0xB2, 0x41,
+0xB1, 0xD6, 0x20, 0xD0, 0x22, 0xD2, 0x22, 0xD2, 0x2A, 0xD0, 0x40, 0xD2, 0x22, 0xDB, 0x27, 0xD3,
+0x20, 0x41, 0xB0, 0xD4, 0x20, 0xD5, 0x20, 0xD0, 0x40, 0xA0, 0x00, 0x80, 0x10, 0x40, 0x90, 0x80,
+0x50, 0x70, 0x0E, 0x30, 0xF0, 0x07, 0x71, 0x0B, 0x50, 0xF0, 0x00, 0x50, 0x80, 0x02, 0x90, 0xA0,
+0x33, 0x50, 0x00, 0x80, 0x90, 0x30, 0x90, 0x51, 0xF0, 0x01, 0x90, 0x70, 0xF2, 0x00, 0x50, 0x90,
+0x10, 0xB0, 0xD1, 0x21, 0xD1, 0x41, 0xD0, 0xB1, 0xD1, 0x21, 0xD2, 0x24, 0xD5, 0xB0, 0x40, 0xB1,
+0xD3, 0x2C, 0xD2, 0x20, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x40, 0xD2, 0x2B, 0xD3, 0x20, 0xD1, 0x23,
+0xD6, 0xB1, 0x42, 0xB1, 0x20, 0xD6, 0x20, 0xD0, 0xB1, 0xD0, 0x24, 0xDC, 0x2A, 0xD3, 0x23, 0xD4,
+0x22, 0xD2, 0xE0, 0x50, 0x01, 0x30, 0x07, 0x0A, 0x31, 0xA0, 0x30, 0xC0, 0xD0, 0x22, 0xD0, 0x24,
+0xD1, 0x22, 0xD0, 0x2D, 0xD1, 0x20, 0xD1, 0x23, 0xD1, 0x22, 0xD2, 0x21, 0xD0, 0x40, 0xD4, 0xB1,
+0x42, 0xB1, 0x20, 0xDA, 0x23, 0xD3, 0x22, 0xD0, 0x20, 0xD2, 0x25, 0xD0, 0x21, 0xD0, 0xB1, 0xD0,
+0x20, 0xD0, 0x21, 0xD2, 0x22, 0xD9, 0x22, 0xD2, 0xB0, 0x40, 0xB0, 0x20, 0xD4, 0x21, 0xD5, 0x21,
+0xD1, 0xE0, 0x50, 0x00, 0x10, 0x30, 0x90, 0x60, 0x0F, 0x01, 0x50, 0x90, 0x07, 0x90, 0x0C, 0x50,
+0xF0, 0x00, 0x80, 0x50, 0x06, 0x70, 0x30, 0x50, 0x80, 0x60, 0x10, 0xC0, 0x12, 0xC0, 0x10, 0x01,
+0xE0, 0xA0, 0x70, 0x02, 0x70, 0x10, 0xE0, 0xD0, 0x22, 0xD3, 0x41, 0xD1, 0x23, 0xD2, 0x21, 0xD4,
+0x22, 0xD1, 0x20, 0xB0, 0x40, 0xB1, 0xD1, 0x26, 0xD0, 0x20, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x23,
+0xD1, 0x40, 0xD0, 0x29, 0xD2, 0x26, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x21, 0xD4, 0x20, 0xB1, 0x42,
+0xB1, 0xD3, 0xB1, 0xD0, 0x25, 0xD0, 0x23, 0xD7, 0x21, 0xDC, 0x23, 0xD0, 0x21, 0xD0, 0x23, 0xD1,
+0xA0, 0x30, 0xA0, 0x30, 0xC0, 0x07, 0x0A, 0x80, 0x70, 0x01, 0xA0, 0xD1, 0x21, 0xD1, 0x27, 0xD1,
+0x29, 0xD1, 0x2B, 0xD9, 0x45, 0xB0, 0xD6, 0x2A, 0xD2, 0x2C, 0xD1, 0x22, 0xD4, 0xB0, 0x40, 0xD2,
+0x21, 0xD6, 0x22, 0xD4, 0x20, 0xD1, 0x20, 0xB0, 0x40, 0xB1, 0xD3, 0x25, 0xD0, 0x21, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0xE0, 0xD1, 0x60, 0x00, 0xA0, 0x80, 0xE0, 0x10, 0x04, 0xA0, 0x50, 0x09, 0x70,
+0x30, 0x03, 0xF0, 0x01, 0x50, 0xF0, 0x0C, 0x50, 0x01, 0x80, 0x06, 0x90, 0x12, 0x90, 0xE2, 0xB0,
+0xD1, 0x70, 0xC0, 0xA0, 0x61, 0x50, 0x60, 0x70, 0x02, 0x50, 0x30, 0xB0, 0xD0, 0x21, 0xD0, 0x20,
+0xD1, 0xB0, 0x41, 0xB0, 0xD0, 0x22, 0xD3, 0x21, 0xD2, 0x24, 0xD0, 0x20, 0xD2, 0x41, 0xB0, 0x20,
+0xD5, 0x20, 0xD0, 0x21, 0xD1, 0x29, 0xD0, 0xB0, 0x40, 0xD6, 0x26, 0xD2, 0x21, 0xD0, 0x25, 0xD1,
+0x24, 0xD2, 0x21, 0xD5, 0xB1, 0x44, 0xB0, 0xDC, 0x24, 0xD7, 0x22, 0xD3, 0x20, 0xD0, 0x22, 0xD0,
+0x23, 0xD0, 0x22, 0xD1, 0x60, 0x02, 0xA0, 0x00, 0x81, 0x04, 0x0A, 0x50, 0x90, 0x01, 0x80, 0x40,
+0xD0, 0x20, 0xD3, 0x26, 0xDB, 0x2A, 0xD6, 0xB1, 0x44, 0xB0, 0xD7, 0x22, 0xD0, 0x21, 0xD5, 0x23,
+0xD3, 0x21, 0xD7, 0x21, 0xD4, 0xB0, 0x42, 0xB0, 0x40, 0xD1, 0x21, 0xD1, 0x24, 0xD0, 0x25, 0xD2,
+0xB0, 0x41, 0xB0, 0xD8, 0x21, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x60, 0xB0, 0x50, 0xA0, 0x50, 0x70,
+0x60, 0x90, 0x40, 0xA0, 0x03, 0xA0, 0x80, 0x0A, 0x30, 0x90, 0x01, 0x80, 0xA0, 0x30, 0xA0, 0x30,
+0x70, 0x0C, 0x50, 0x70, 0x00, 0x10, 0x80, 0x90, 0x00, 0x70, 0x80, 0x02, 0xF0, 0xA1, 0x90, 0x40,
+0xD6, 0xE0, 0xA0, 0xD2, 0x60, 0xE0, 0x03, 0x60, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x41,
+0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x26, 0xD9, 0x41, 0xB0, 0x20, 0xD2, 0x26, 0xD0, 0x22, 0xD5, 0xB0,
+0x43, 0xB0, 0xD4, 0x22, 0xD1, 0x20, 0xD2, 0x23, 0xD1, 0x20, 0xD3, 0x20, 0xDF, 0x04, 0x40, 0xB0,
+0x43, 0xB1, 0xD9, 0x27, 0xD1, 0x2B, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0xA0, 0x02, 0x30,
+0x51, 0x90, 0x50, 0x03, 0x0A, 0xF0, 0x30, 0x70, 0x50, 0xA0, 0xE0, 0xD5, 0x22, 0xD1, 0x27, 0xDF,
+0x01, 0x20, 0xB2, 0x42, 0xB0, 0xD4, 0xB1, 0xD1, 0x21, 0xD1, 0x25, 0xD7, 0x26, 0xD0, 0x24, 0xD2,
+0x20, 0xD3, 0x20, 0xB0, 0x41, 0xB0, 0xD3, 0xB0, 0xD4, 0x20, 0xD0, 0x27, 0xD2, 0x20, 0x41, 0xB0,
+0xD4, 0x21, 0xD8, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xC0, 0xA0, 0x80, 0x01, 0xA0, 0xD0, 0xB0, 0xA0,
+0x90, 0x0F, 0x01, 0x80, 0x30, 0x50, 0x30, 0x01, 0x50, 0xA0, 0x30, 0x0C, 0x80, 0x10, 0x60, 0xA0,
+0x40, 0xE0, 0x61, 0xC0, 0x10, 0x90, 0xF0, 0xA0, 0x10, 0xC0, 0xB0, 0x40, 0x20, 0xD2, 0x20, 0xD3,
+0x21, 0xD1, 0xE0, 0x90, 0x02, 0xA0, 0x60, 0xD1, 0x20, 0xD1, 0x40, 0xD4, 0x40, 0xB0, 0xD4, 0x25,
+0xD4, 0x22, 0xD5, 0xB0, 0x41, 0xB0, 0x20, 0xD1, 0x28, 0xD5, 0x40, 0xD3, 0xB1, 0x40, 0xB1, 0xDA,
+0x23, 0xD1, 0x22, 0xD9, 0x20, 0xD2, 0x23, 0xD3, 0x40, 0xD4, 0xB0, 0x42, 0xB2, 0x20, 0xDB, 0x21,
+0xD0, 0x2A, 0xD4, 0x20, 0xD0, 0x21, 0xD1, 0x60, 0x90, 0x51, 0x30, 0x00, 0x31, 0x04, 0x08, 0xF0,
+0x01, 0xC0, 0x90, 0x51, 0xA0, 0xDA, 0x21, 0xD1, 0x26, 0xD9, 0xB1, 0x42, 0xB1, 0x21, 0xD5, 0x20,
+0xD1, 0x40, 0xD0, 0x21, 0xD2, 0x23, 0xD4, 0x26, 0xD1, 0x24, 0xD1, 0x21, 0xD4, 0xB0, 0x41, 0xB1,
+0xD1, 0x21, 0xD2, 0xB1, 0xD3, 0x27, 0xD1, 0x20, 0xB0, 0x40, 0xB1, 0xD5, 0x21, 0xD8, 0x22, 0xD0,
+0x21, 0xD2, 0x40, 0xE0, 0x80, 0x70, 0x01, 0xE0, 0x40, 0xD0, 0x40, 0x60, 0x50, 0x00, 0x50, 0xF0,
+0x0D, 0x70, 0x30, 0xF0, 0x00, 0x70, 0x50, 0x00, 0xA0, 0x0C, 0xA0, 0xE0, 0xD6, 0x40, 0x60, 0xA0,
+0xC0, 0x40, 0xC0, 0xA0, 0xD0, 0x40, 0xD0, 0x21, 0xD3, 0x20, 0xD1, 0x20, 0xD1, 0x30, 0x02, 0x90,
+0xC0, 0xD1, 0x20, 0xD0, 0xB1, 0xD1, 0x20, 0xD2, 0xB0, 0x40, 0xD3, 0x24, 0xD4, 0x21, 0xD0, 0x22,
+0xD6, 0xB0, 0x41, 0x20, 0xDB, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD2, 0x20, 0xB0, 0x41, 0xB1, 0xD3,
+0x2A, 0xD0, 0x26, 0xD2, 0x21, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0xB0, 0xD1, 0x20, 0xD5, 0x20, 0xB2,
+0x41, 0xB1, 0xD5, 0x22, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0x21, 0xD6, 0x20, 0xD1, 0xB0, 0x30, 0x70,
+0x90, 0x30, 0x80, 0x07, 0x03, 0x50, 0xF0, 0x01, 0xF0, 0xC0, 0x80, 0x00, 0x30, 0x02, 0x60, 0xD4,
+0x20, 0xD0, 0x20, 0xD2, 0x21, 0xDC, 0x20, 0xB0, 0x43, 0xB1, 0xD6, 0x27, 0xD0, 0x40, 0xD0, 0x21,
+0xD5, 0x22, 0xD1, 0x2D, 0xD5, 0xB0, 0x41, 0xB1, 0xD4, 0x23, 0xD2, 0x40, 0xD4, 0x22, 0xD3, 0xB0,
+0x41, 0xB0, 0xD3, 0x2D, 0xD0, 0x21, 0xD5, 0x41, 0xD0, 0xB0, 0x60, 0xF0, 0x01, 0xF0, 0x60, 0xD0,
+0xB0, 0x90, 0xC0, 0x70, 0x30, 0x50, 0x0F, 0x02, 0x90, 0x01, 0x70, 0x80, 0x07, 0xF0, 0x50, 0x80,
+0x60, 0xE0, 0xD3, 0x22, 0xD8, 0xB1, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x40, 0xE0, 0x03, 0x10, 0x40,
+0xD1, 0x20, 0x40, 0xD3, 0x21, 0xD2, 0xB0, 0x40, 0x20, 0xD2, 0x21, 0xD3, 0x24, 0xD1, 0x23, 0xD5,
+0xB0, 0x41, 0xB0, 0x20, 0xD8, 0x20, 0xD0, 0xB1, 0xD0, 0x24, 0xD4, 0xB1, 0x41, 0xB0, 0x20, 0xD1,
+0x20, 0xD3, 0x23, 0xD1, 0x28, 0xD0, 0x28, 0xD0, 0xB1, 0xD0, 0x27, 0xD6, 0xB1, 0x43, 0xB0, 0x20,
+0xDC, 0x21, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x80, 0x01, 0x51, 0x00, 0xA0, 0xC0, 0x60, 0x80,
+0xF0, 0x01, 0x03, 0xA0, 0x10, 0x80, 0x02, 0xA0, 0xF0, 0x30, 0x02, 0x60, 0xD1, 0x21, 0xD0, 0x23,
+0xD3, 0x20, 0xD5, 0xB1, 0x43, 0xB0, 0x20, 0xDA, 0x28, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x22, 0xD1,
+0x24, 0xD4, 0x22, 0xD5, 0xB1, 0x41, 0xB0, 0xD5, 0x25, 0xD3, 0x40, 0xD2, 0x20, 0xD1, 0x20, 0xD1,
+0xB0, 0x41, 0xB0, 0xD1, 0x21, 0xD1, 0x24, 0xD1, 0x29, 0xD4, 0xB0, 0x40, 0x20, 0xD3, 0xC0, 0x80,
+0x50, 0x00, 0xE0, 0x40, 0xD0, 0xB0, 0xA0, 0x50, 0x0F, 0x03, 0x50, 0x70, 0x02, 0xA0, 0x07, 0x60,
+0x10, 0x60, 0x70, 0xB0, 0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD5, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0x10, 0x50, 0x02, 0xF0, 0x10, 0xD1, 0x40, 0xD1, 0xB0,
+0x40, 0xD1, 0x22, 0xD2, 0x41, 0xD5, 0x2A, 0xD2, 0x20, 0xD1, 0x20, 0xD3, 0x20, 0x41, 0xB0, 0xD1,
+0x21, 0xD1, 0x21, 0xD0, 0x40, 0x20, 0xD1, 0x28, 0xD3, 0xB1, 0x41, 0xB0, 0xD5, 0x26, 0xD0, 0x2D,
+0xD1, 0x40, 0xD1, 0x29, 0xD9, 0x20, 0xB0, 0x43, 0xB1, 0xD6, 0x23, 0xD1, 0x20, 0xD0, 0x22, 0xD1,
+0xE0, 0x50, 0x01, 0x80, 0xF0, 0x60, 0x50, 0xF0, 0x70, 0x80, 0xC0, 0x50, 0x00, 0x03, 0x80, 0x90,
+0x80, 0x60, 0x01, 0x30, 0x70, 0x80, 0x31, 0xA0, 0x60, 0xD1, 0x22, 0xD0, 0x20, 0xD6, 0x20, 0xB1,
+0x42, 0xB1, 0xD5, 0x2A, 0xD0, 0x27, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD2, 0x27, 0xDA, 0x20, 0xB0,
+0x41, 0xB0, 0xD5, 0x26, 0xD0, 0x20, 0xD4, 0xB1, 0xD4, 0xB1, 0x40, 0xB0, 0xD5, 0x26, 0xD0, 0x20,
+0xD1, 0x26, 0xD5, 0x40, 0xB0, 0xD6, 0xA1, 0x01, 0x10, 0xD1, 0x40, 0x60, 0x80, 0x09, 0xA0, 0x06,
+0x90, 0x03, 0x70, 0x30, 0x05, 0x10, 0xC0, 0x40, 0xD1, 0xB0, 0x20, 0xD3, 0x20, 0xD2, 0x21, 0xD0,
+0x20, 0xD3, 0xB1, 0xD0, 0x21, 0xD3, 0x20, 0xD2, 0x10, 0x02, 0xF0, 0x80, 0xA0, 0xE0, 0x40, 0xD1,
+0x40, 0xC1, 0x60, 0xD1, 0x23, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x2D, 0xD0, 0x24, 0xD0, 0x20, 0xD2,
+0xB0, 0x41, 0xB0, 0x20, 0xD4, 0x40, 0xD4, 0x20, 0xD0, 0x27, 0xD4, 0xB0, 0x41, 0xB1, 0xDA, 0x2D,
+0xD0, 0x40, 0x21, 0xD0, 0x22, 0xD0, 0x2A, 0xDA, 0xB0, 0x42, 0xB2, 0xD7, 0x24, 0xD0, 0xE0, 0x60,
+0x30, 0x80, 0x60, 0x00, 0xC0, 0x03, 0xF0, 0xA0, 0x00, 0x03, 0x50, 0x30, 0x00, 0x90, 0xC1, 0xA0,
+0x00, 0x80, 0x50, 0x01, 0xE0, 0xB0, 0xD0, 0x20, 0xD5, 0x20, 0xB0, 0x42, 0xB2, 0x20, 0xD3, 0x28,
+0xD6, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0xB1, 0xD0, 0x22, 0xD1, 0x24, 0xD0, 0x22,
+0xD0, 0x20, 0xD4, 0xB1, 0x40, 0xB1, 0xD6, 0x20, 0xD0, 0x22, 0xDB, 0x40, 0xD2, 0xB0, 0x40, 0xB1,
+0xD9, 0x2D, 0xD0, 0x20, 0xD2, 0x20, 0xB0, 0x40, 0xD5, 0x21, 0xD1, 0xE1, 0x00, 0x60, 0xE0, 0xD0,
+0x41, 0x60, 0x70, 0x00, 0xF0, 0x06, 0x50, 0x05, 0x50, 0xF0, 0x04, 0x81, 0x03, 0x30, 0x10, 0xD3,
+0x40, 0x20, 0xD0, 0x24, 0xD2, 0x21, 0xD5, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x40, 0x60, 0x90,
+0x00, 0x30, 0xC0, 0x70, 0xE0, 0x41, 0xC1, 0x40, 0xD0, 0xC0, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD2,
+0xB0, 0x40, 0xB0, 0xD2, 0x24, 0xD0, 0x29, 0xDA, 0xB0, 0x41, 0xB0, 0xD1, 0xB1, 0xD0, 0x20, 0xD5,
+0x22, 0xD0, 0x22, 0xD8, 0xB0, 0x41, 0xB0, 0xD5, 0x26, 0xD0, 0x22, 0xD1, 0x21, 0xD1, 0x40, 0xD0,
+0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD5, 0x21, 0xDC, 0x20, 0xB1, 0x42, 0xB1, 0xD8, 0xA0,
+0x01, 0xF0, 0xA0, 0x00, 0x80, 0x60, 0x90, 0x70, 0xF0, 0x80, 0x30, 0x00, 0x03, 0x70, 0xA0, 0x02,
+0xF0, 0x01, 0x51, 0x01, 0x90, 0x40, 0xD1, 0x20, 0xB0, 0x43, 0xB1, 0xD4, 0x2E, 0xDF, 0x00, 0x22,
+0xD0, 0x40, 0xD0, 0x23, 0xD1, 0x21, 0xD8, 0x20, 0xB0, 0x41, 0xB0, 0xDA, 0x21, 0xD2, 0x22, 0xD1,
+0x21, 0xD4, 0x40, 0xB0, 0x41, 0xB0, 0xD3, 0x20, 0xD9, 0x2A, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD4,
+0x24, 0xD2, 0xE0, 0x50, 0x00, 0xC0, 0xB0, 0xD0, 0xB0, 0x80, 0x60, 0xF0, 0x60, 0x0C, 0xF0, 0x50,
+0x06, 0x60, 0x02, 0x90, 0x10, 0xE0, 0xD1, 0x20, 0xD0, 0xB0, 0x20, 0xD0, 0x24, 0xD2, 0x22, 0xD4,
+0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0xA0, 0x10, 0x70, 0x00, 0x70, 0xF0, 0x30,
+0xD0, 0xB0, 0x40, 0xD2, 0xC0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0xB0, 0x40, 0x20,
+0xD6, 0x22, 0xD0, 0x25, 0xD8, 0x20, 0xD2, 0xB1, 0x40, 0xB0, 0x40, 0xD5, 0x20, 0xD0, 0x22, 0xD0,
+0x21, 0xD2, 0x23, 0xD6, 0xB0, 0x42, 0xB0, 0xD9, 0x20, 0xD0, 0x22, 0xD3, 0x40, 0xD0, 0x22, 0xDD,
+0x2B, 0xD8, 0xB2, 0x42, 0xB1, 0xD2, 0xA0, 0x02, 0x30, 0x01, 0x90, 0x30, 0x61, 0x30, 0x01, 0x05,
+0xF0, 0x30, 0x62, 0x70, 0xF0, 0xA0, 0x30, 0xC0, 0x10, 0xE0, 0x42, 0xB0, 0xD7, 0x21, 0xD0, 0x24,
+0xD9, 0x23, 0xDD, 0x20, 0xD0, 0x40, 0xD1, 0x21, 0xD2, 0x22, 0xD3, 0xB1, 0x41, 0xB0, 0x20, 0xD8,
+0x23, 0xD4, 0x26, 0xD3, 0xB0, 0x42, 0xD3, 0x20, 0xD0, 0x25, 0xD6, 0x25, 0xD6, 0xB0, 0x40, 0xB0,
+0xD4, 0x26, 0xD1, 0x40, 0xC0, 0x00, 0xA0, 0xB0, 0xD1, 0xB0, 0xA0, 0x70, 0x0D, 0x90, 0x07, 0xC0,
+0x50, 0x01, 0xF0, 0x10, 0x70, 0xD0, 0x21, 0xD0, 0xB0, 0x20, 0xD0, 0x2A, 0xD5, 0x40, 0x20, 0xD1,
+0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0xB0, 0x60, 0x90, 0x00, 0x70, 0x50, 0xA0, 0xD1, 0xB0, 0x40,
+0xD3, 0xC0, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD4, 0x41, 0xD4, 0x20, 0xD2, 0x2F, 0x03, 0xD3, 0xB0,
+0x41, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD2, 0x2A, 0xD7, 0x20, 0xB0, 0x42, 0xB0, 0xDD, 0xB1, 0xD0,
+0x20, 0xDB, 0x28, 0xD6, 0x28, 0xD5, 0xB1, 0x42, 0x11, 0xA0, 0x30, 0x90, 0x50, 0x10, 0x61, 0xC0,
+0x80, 0x02, 0x04, 0x50, 0xC0, 0x80, 0x30, 0x90, 0xF0, 0xC0, 0x00, 0x11, 0xC0, 0xA1, 0xD5, 0x21,
+0xD0, 0x27, 0xDD, 0x22, 0xDF, 0x00, 0x40, 0xD3, 0x20, 0xD4, 0xB1, 0x41, 0xB0, 0xD5, 0x22, 0xD0,
+0x21, 0xD0, 0x23, 0xD0, 0x20, 0xD4, 0x25, 0xD0, 0xB1, 0x40, 0xB0, 0xD1, 0x40, 0xD2, 0x2D, 0xD3,
+0x20, 0xD0, 0x21, 0xD5, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x27, 0xD1, 0x40, 0x60, 0x70, 0xE0, 0x60,
+0xD1, 0xE0, 0xC0, 0x80, 0x0C, 0x71, 0x07, 0x80, 0x60, 0x02, 0xC0, 0x40, 0xD0, 0x21, 0xD0, 0xB0,
+0x20, 0xD0, 0x21, 0xD0, 0x28, 0xD1, 0x21, 0xD0, 0x20, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x21,
+0xD1, 0x60, 0x80, 0x70, 0xF0, 0xA0, 0xD2, 0xB0, 0x40, 0xD0, 0xB0, 0xD0, 0x40, 0x10, 0x40, 0xD2,
+0x22, 0xD0, 0x21, 0xD1, 0x20, 0x40, 0xB0, 0xD6, 0x20, 0xD0, 0x2F, 0x02, 0xD0, 0x20, 0xD0, 0xB1,
+0xD0, 0xB0, 0x41, 0xB0, 0xD4, 0x23, 0xD0, 0x2A, 0xD1, 0x22, 0xD4, 0xB0, 0x41, 0xB1, 0xD5, 0x21,
+0xD1, 0x40, 0xD3, 0x20, 0xD6, 0x20, 0xD0, 0x26, 0xD8, 0x20, 0xD1, 0x2A, 0xD1, 0x20, 0xD2, 0x40,
+0x61, 0x11, 0x50, 0x60, 0x03, 0x80, 0x30, 0x01, 0x04, 0x30, 0x50, 0x01, 0xA0, 0x00, 0xA0, 0xF0,
+0xA0, 0xF0, 0x01, 0xA0, 0xD5, 0x21, 0xD3, 0x2B, 0xD7, 0x2C, 0xD4, 0xB1, 0xD5, 0xB0, 0x41, 0xB1,
+0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD2, 0x21, 0xD1, 0x23, 0xD1, 0x21, 0xD0, 0x22, 0xD4, 0xB0, 0x40,
+0xB0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD0, 0x21, 0xD0, 0x2F, 0x00, 0xD7, 0xB0, 0x40, 0xD3,
+0x24, 0xD1, 0x21, 0xD4, 0xA0, 0x50, 0x00, 0x50, 0xE0, 0xD2, 0xA0, 0x10, 0x50, 0x0B, 0x90, 0x09,
+0x80, 0xA0, 0x50, 0x00, 0xA0, 0x60, 0xD3, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x26, 0xD1,
+0x22, 0xD0, 0xB1, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0x50, 0xA0, 0x51, 0xA0, 0xD3, 0xA0,
+0xE0, 0x60, 0xB0, 0xD0, 0xE0, 0x40, 0xC0, 0xD4, 0x21, 0xD4, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0,
+0x20, 0xD2, 0x2E, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0xB0, 0x41, 0xB0, 0xD4, 0x22, 0xD0,
+0x21, 0xD3, 0x22, 0xD3, 0x20, 0xD2, 0x21, 0xD2, 0xB1, 0x41, 0xB0, 0xD6, 0x40, 0xD2, 0x2F, 0x01,
+0xD5, 0x2B, 0xD0, 0x21, 0xD5, 0x20, 0xD1, 0xE0, 0x50, 0x01, 0x80, 0x50, 0x60, 0x50, 0x02, 0xF0,
+0x60, 0x01, 0x04, 0x80, 0x30, 0x00, 0x90, 0xA0, 0x50, 0xC0, 0x00, 0x80, 0xF0, 0x01, 0xA0, 0xD1,
+0x20, 0xD0, 0x25, 0xD7, 0x27, 0xD5, 0x2D, 0xD4, 0x40, 0xD1, 0xB0, 0x42, 0xB0, 0xD4, 0x25, 0xD0,
+0x21, 0xD2, 0x24, 0xD4, 0x21, 0xD3, 0xB0, 0x41, 0xB0, 0xD2, 0x22, 0xD1, 0xB0, 0xD1, 0x21, 0xD0,
+0x20, 0xD2, 0x2A, 0xD5, 0xB0, 0x40, 0xB0, 0xD3, 0x24, 0xD2, 0x21, 0xD3, 0xB0, 0xC0, 0x60, 0x01,
+0xC0, 0xB0, 0xD2, 0xE0, 0xC0, 0x90, 0x09, 0x50, 0xF0, 0x0A, 0xF0, 0x80, 0x30, 0xC0, 0x60, 0xD3,
+0xB0, 0x20, 0xD6, 0x25, 0xD1, 0x23, 0xD0, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0xB0,
+0x40, 0xB0, 0xC0, 0x10, 0xE0, 0xD0, 0x21, 0xD0, 0x10, 0x80, 0xE0, 0xB0, 0xD0, 0xB0, 0xD0, 0x60,
+0xA0, 0xD0, 0x60, 0xD1, 0x20, 0xD0, 0x21, 0xD4, 0xB0, 0x40, 0xD6, 0x2A, 0xD0, 0x20, 0xD1, 0x20,
+0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0x20, 0xD4, 0x20, 0xD0, 0x21, 0xD3,
+0x20, 0xD0, 0x21, 0xD1, 0x22, 0xD0, 0x25, 0xD2, 0xB0, 0x42, 0xB0, 0xD2, 0xB0, 0xD2, 0x2F, 0x02,
+0xD2, 0x2C, 0xD2, 0x20, 0xD1, 0x24, 0xD1, 0xE0, 0x70, 0x01, 0x30, 0xF1, 0xC1, 0xA0, 0x30, 0xC0,
+0x90, 0x01, 0x05, 0x30, 0xC0, 0xA0, 0x70, 0x50, 0xF0, 0x00, 0x90, 0xA0, 0x31, 0x60, 0x40, 0xD0,
+0x21, 0xD0, 0x22, 0xD2, 0x24, 0xD3, 0x2F, 0x09, 0xD5, 0x42, 0xB0, 0x20, 0xD3, 0x21, 0xD0, 0x21,
+0xD1, 0x21, 0xD1, 0x2A, 0xD6, 0xB0, 0x41, 0xB0, 0xD4, 0x21, 0xD3, 0x40, 0xD1, 0x21, 0xD0, 0x27,
+0xD0, 0x20, 0xD8, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x23, 0xD3, 0x40,
+0xD1, 0x10, 0xA0, 0x00, 0x60, 0xE0, 0xD0, 0x20, 0xD1, 0xE0, 0xC0, 0x50, 0xF0, 0x07, 0x90, 0x0E,
+0x90, 0xE0, 0xD3, 0xB0, 0x20, 0xD0, 0x21, 0xD2, 0x20, 0xD0, 0x23, 0xD2, 0x21, 0xD2, 0xB1, 0xD1,
+0x23, 0xD1, 0x41, 0xD0, 0xA0, 0xE0, 0xD1, 0x20, 0xD2, 0xE0, 0x10, 0xA0, 0xB1, 0xA0, 0xD2, 0x40,
+0x20, 0xD2, 0x20, 0xD3, 0x20, 0xD3, 0x40, 0xB0, 0xDC, 0x20, 0xD2, 0x23, 0xD0, 0x20, 0xD0, 0xB1,
+0xD1, 0x21, 0xD5, 0x20, 0x41, 0xB0, 0xD5, 0x21, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0x24, 0xD5, 0x20,
+0xD4, 0xB0, 0x43, 0xD3, 0x2F, 0x0B, 0xD5, 0x24, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x60, 0x32, 0x60,
+0x03, 0x50, 0x90, 0xF0, 0x02, 0x06, 0x80, 0xC0, 0x60, 0xA0, 0x60, 0x30, 0x70, 0x80, 0x01, 0x50,
+0xE0, 0xD1, 0x21, 0xD0, 0x27, 0xD1, 0x2F, 0x06, 0xD7, 0x20, 0xB0, 0x41, 0xB0, 0x40, 0xB0, 0xD3,
+0x25, 0xD1, 0x21, 0xD1, 0x2A, 0xD5, 0xB1, 0x40, 0xB0, 0xD3, 0x21, 0xD7, 0xB1, 0xD3, 0x25, 0xD2,
+0x20, 0xD6, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD2, 0x20, 0xD1, 0x20, 0xD2, 0x23, 0xD1, 0xB0, 0x40,
+0xD3, 0x40, 0x30, 0x80, 0xC1, 0xD0, 0x20, 0xD1, 0x60, 0xE0, 0x50, 0x70, 0x05, 0x50, 0x0E, 0x60,
+0x10, 0xD4, 0x40, 0x23, 0xD2, 0x20, 0xD0, 0x23, 0xD2, 0x21, 0xD3, 0x40, 0xD1, 0x22, 0xD1, 0x40,
+0xD0, 0xB0, 0x41, 0xD2, 0x21, 0xD2, 0x40, 0x10, 0x40, 0xB1, 0xE0, 0xC0, 0x60, 0xE0, 0xD1, 0x40,
+0x20, 0xD3, 0x20, 0xD0, 0x21, 0xD2, 0x20, 0x40, 0xB0, 0xD3, 0x21, 0xD4, 0x21, 0xD0, 0x22, 0xD1,
+0x22, 0x40, 0xD4, 0x24, 0xD3, 0xB0, 0x41, 0xB0, 0xD5, 0x21, 0xD0, 0x25, 0xD4, 0x20, 0xD0, 0x20,
+0xD1, 0x22, 0xD5, 0x40, 0xB0, 0x41, 0xB1, 0xD7, 0x25, 0xD1, 0x27, 0xD3, 0x20, 0xD0, 0x20, 0xD1,
+0x24, 0xD0, 0x24, 0xD1, 0xA0, 0x01, 0x70, 0x80, 0xF0, 0x70, 0x07, 0x05, 0x80, 0x30, 0x03, 0x60,
+0xF0, 0x30, 0x01, 0xF0, 0xE0, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x2E, 0xD0,
+0x20, 0xD3, 0x21, 0xD5, 0xB0, 0x41, 0xB1, 0x20, 0xD1, 0xB1, 0xD2, 0x21, 0xD2, 0x20, 0xD0, 0x22,
+0xD1, 0x21, 0xD1, 0x26, 0xD4, 0xB0, 0x40, 0xB1, 0xD3, 0x22, 0xD2, 0x21, 0xD4, 0x40, 0xD4, 0x21,
+0xD1, 0x20, 0xD0, 0x23, 0xD4, 0x40, 0xB0, 0x20, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x23,
+0xD2, 0xB0, 0x40, 0xD1, 0x21, 0xD1, 0xE0, 0x40, 0x00, 0xC0, 0xD2, 0x40, 0xD0, 0x60, 0x71, 0x50,
+0x03, 0xF0, 0x50, 0x0E, 0xA1, 0xD0, 0x21, 0xD1, 0x40, 0x22, 0xD1, 0x22, 0xD1, 0x21, 0xD3, 0x21,
+0xD0, 0x21, 0xD1, 0x40, 0xD3, 0xB0, 0x40, 0xD2, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x40, 0x20,
+0xD0, 0xB0, 0x41, 0xB0, 0x10, 0x41, 0xE0, 0xD1, 0xB0, 0xD2, 0x20, 0xD0, 0x23, 0xD1, 0xB0, 0x40,
+0xB0, 0xD1, 0x21, 0xD3, 0x20, 0xD0, 0x25, 0xD2, 0xB1, 0xD4, 0x21, 0xD0, 0x21, 0xD0, 0x21, 0xD3,
+0xB0, 0x41, 0xB0, 0xD4, 0x24, 0xD2, 0x20, 0xD2, 0x22, 0xD1, 0x20, 0xD1, 0x21, 0xD3, 0x40, 0xD1,
+0x21, 0xB0, 0x41, 0xB1, 0xD3, 0x20, 0xD0, 0x21, 0xD4, 0x2B, 0xD3, 0x22, 0xD3, 0x23, 0xD0, 0x40,
+0x90, 0x01, 0x52, 0x10, 0x61, 0x30, 0x80, 0x70, 0x02, 0x05, 0x30, 0x70, 0x02, 0x70, 0xC0, 0x00,
+0xA0, 0x00, 0x70, 0x80, 0xC0, 0xD3, 0x28, 0xD0, 0x23, 0xD0, 0x26, 0xD0, 0x21, 0xD1, 0x21, 0xD4,
+0xB1, 0x41, 0xB0, 0xD3, 0x21, 0xD0, 0x20, 0xB0, 0xD1, 0x23, 0xD5, 0x22, 0xD1, 0x21, 0xD1, 0x20,
+0xD1, 0x20, 0xD2, 0xB0, 0x41, 0xB0, 0xD3, 0x27, 0xD1, 0x22, 0xD2, 0xB1, 0xD2, 0x20, 0xD1, 0x25,
+0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x24, 0xD1, 0x20, 0xD1, 0x22, 0xD2, 0x40, 0xB0, 0xD0,
+0x23, 0xD2, 0xE0, 0x50, 0x90, 0xE0, 0xD0, 0x40, 0xD2, 0x60, 0x00, 0xF0, 0x90, 0x70, 0x01, 0x90,
+0x0F, 0x00, 0xC0, 0xE0, 0xD0, 0x20, 0xD2, 0xB0, 0x21, 0xD2, 0x22, 0xD1, 0x21, 0xD4, 0x24, 0xD0,
+0x40, 0xB0, 0xD1, 0x40, 0xB0, 0xD4, 0x40, 0xD9, 0x21, 0xD0, 0xB0, 0x40, 0xD0, 0xB1, 0x60, 0xC0,
+0xB0, 0x40, 0x10, 0xD0, 0x20, 0xB0, 0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0x20,
+0xD6, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xD2, 0x20, 0xD3, 0x21, 0xD0, 0x24, 0xD3, 0xB1,
+0x40, 0xB0, 0xD3, 0x20, 0xD1, 0x22, 0xD3, 0x21, 0xD0, 0x22, 0xD3, 0x22, 0xD0, 0xB1, 0xD0, 0x20,
+0xD4, 0xB1, 0x41, 0xB0, 0xD9, 0x26, 0xD0, 0x20, 0xD2, 0x26, 0xD2, 0x24, 0xD0, 0xE0, 0xA0, 0x90,
+0x00, 0x80, 0x70, 0x00, 0x30, 0x71, 0x50, 0x80, 0xA0, 0x02, 0x05, 0x70, 0x10, 0xA0, 0x60, 0x10,
+0xC0, 0xF0, 0x00, 0x30, 0x60, 0x90, 0xF0, 0xA0, 0xB0, 0xD0, 0x20, 0xD1, 0x25, 0xD5, 0x23, 0xD1,
+0x21, 0xD2, 0x21, 0xD3, 0x20, 0xB0, 0x41, 0xB0, 0x20, 0xD6, 0x21, 0xD1, 0x40, 0xD1, 0x25, 0xD0,
+0x27, 0xD1, 0x21, 0xD3, 0xB0, 0x41, 0xB0, 0xD1, 0x21, 0xD5, 0x22, 0xD4, 0x20, 0xD2, 0xB0, 0x41,
+0xD1, 0x20, 0xD1, 0x25, 0xD3, 0xB0, 0x40, 0xB0, 0xD7, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD4, 0x40,
+0xB0, 0xD0, 0x20, 0xD2, 0x22, 0xD0, 0xB0, 0xE0, 0x70, 0xE0, 0xB0, 0x20, 0xD2, 0xB0, 0xA0, 0x01,
+0x51, 0x71, 0x0F, 0x00, 0x60, 0x40, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD3, 0x26, 0xD0, 0x24, 0xD0,
+0x22, 0xD1, 0x40, 0xB0, 0x40, 0xD5, 0xB0, 0x50, 0xE3, 0xD6, 0x21, 0xD1, 0x40, 0xB0, 0xD1, 0xC0,
+0xD3, 0xC0, 0x60, 0xE0, 0xD4, 0x20, 0xD3, 0x20, 0x40, 0xB0, 0xD2, 0x25, 0xD1, 0x20, 0xD2, 0xB0,
+0x40, 0xB0, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x22, 0xD8, 0xB0, 0x41, 0xB0, 0xD5, 0x23, 0xD7, 0x20,
+0xD1, 0x22, 0xD0, 0x40, 0xDB, 0xB0, 0x42, 0xB0, 0xD3, 0x21, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0x23,
+0xD2, 0x22, 0xD2, 0x23, 0xD1, 0xA0, 0x70, 0x50, 0x30, 0xC0, 0x01, 0xF0, 0x50, 0x06, 0x07, 0x50,
+0x70, 0x01, 0x50, 0x00, 0x51, 0x01, 0x90, 0x40, 0xD0, 0x20, 0xD1, 0x26, 0xDF, 0x02, 0x20, 0xB0,
+0x41, 0xB1, 0xD4, 0x28, 0xD0, 0xB1, 0xD0, 0x29, 0xD4, 0x20, 0xD3, 0x20, 0x41, 0xB0, 0xD2, 0x20,
+0xD0, 0x24, 0xD4, 0x21, 0xD3, 0x21, 0xB0, 0x40, 0xB0, 0xD0, 0xB1, 0xD4, 0x24, 0xD2, 0x40, 0xB0,
+0xD1, 0x22, 0xD4, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0x40, 0xD2, 0x21, 0xD1,
+0x20, 0xD1, 0x20, 0xD0, 0xA0, 0xE0, 0xB1, 0xD1, 0x20, 0xD1, 0xA0, 0x70, 0x02, 0x80, 0x50, 0x0F,
+0x00, 0x60, 0xD5, 0xB0, 0x20, 0xD7, 0x25, 0xD1, 0x23, 0xD1, 0xB0, 0x41, 0xD3, 0x40, 0xE0, 0xA0,
+0xE1, 0xA0, 0xE0, 0x30, 0xA0, 0xC0, 0x60, 0x40, 0xE0, 0xA0, 0x40, 0xD2, 0x20, 0xD1, 0x40, 0xB0,
+0xD3, 0xE0, 0xD4, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x21,
+0xD5, 0x40, 0xD0, 0xB0, 0x40, 0xB0, 0x20, 0xD4, 0x21, 0xD0, 0x21, 0xD0, 0x26, 0xD3, 0xB0, 0x41,
+0xB0, 0xD7, 0x27, 0xD1, 0x21, 0xD1, 0x40, 0xD4, 0x25, 0xD4, 0xB0, 0x41, 0xB1, 0x20, 0xD8, 0x20,
+0xD3, 0x21, 0xD0, 0x23, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0xA0, 0x02, 0x30, 0x0A, 0x0A, 0x80, 0x90,
+0x80, 0xF0, 0x80, 0x01, 0x90, 0xE0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x21,
+0xD2, 0x21, 0xD6, 0xB1, 0x41, 0xB0, 0xD6, 0x25, 0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x26, 0xD1, 0x22,
+0xD4, 0xB0, 0x40, 0xB0, 0x20, 0xD5, 0x20, 0xD3, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD2, 0xB0, 0x40,
+0xB0, 0x20, 0xD2, 0x40, 0xD2, 0x24, 0xD2, 0xB0, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD6, 0x22,
+0xD4, 0xB0, 0x40, 0xD2, 0x23, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD0, 0x23, 0xD1, 0x60,
+0xF0, 0x00, 0x50, 0xF1, 0x90, 0x70, 0x0D, 0xA0, 0xD5, 0x40, 0x23, 0xD4, 0x25, 0xD1, 0x20, 0xD2,
+0xB0, 0x40, 0xB0, 0xD0, 0x40, 0xD1, 0xB0, 0xE0, 0xA0, 0x83, 0x01, 0x50, 0x01, 0xA2, 0xC0, 0x10,
+0xE0, 0xD2, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x40, 0x60, 0xD3, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0,
+0x20, 0xD4, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB1, 0xD2, 0xB0, 0x40, 0xB0, 0x20,
+0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x23, 0xD7, 0xB0, 0x41, 0xB0, 0xD2, 0x25, 0xD1, 0x25,
+0xD0, 0xB1, 0xD4, 0x26, 0xD6, 0xB1, 0x41, 0xB1, 0xD6, 0x2A, 0xD0, 0x24, 0xD1, 0x60, 0x02, 0x30,
+0x0A, 0x0A, 0x80, 0x50, 0x30, 0x00, 0xA0, 0x31, 0xE0, 0xA0, 0xD4, 0x20, 0xD2, 0x20, 0x40, 0xE0,
+0xD0, 0x23, 0xD4, 0x20, 0xB0, 0x41, 0xB0, 0xD7, 0x2D, 0xD1, 0x40, 0xD2, 0x24, 0xD0, 0x21, 0xD4,
+0xB0, 0x41, 0xB0, 0xD3, 0x22, 0xD3, 0x22, 0xD2, 0x23, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD0,
+0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x22, 0xD0, 0x21, 0xD5, 0x23, 0xD0,
+0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x40, 0xD2, 0x23,
+0xD0, 0xB0, 0xA0, 0x00, 0x90, 0x02, 0x70, 0x90, 0x50, 0x0B, 0xA0, 0xD2, 0x20, 0xD1, 0xB0, 0x23,
+0xD3, 0x25, 0xD4, 0xB0, 0x41, 0xD2, 0xB0, 0x41, 0xA0, 0xF0, 0x50, 0xA0, 0x90, 0xC0, 0x10, 0x80,
+0x90, 0x30, 0x50, 0x04, 0x80, 0x11, 0x40, 0xD4, 0xB0, 0x41, 0x10, 0xC0, 0xDA, 0x22, 0xD5, 0x41,
+0xD0, 0xE0, 0xB0, 0xD1, 0xB0, 0xD2, 0x40, 0xD5, 0xB0, 0x41, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0x22,
+0xD0, 0x21, 0xD8, 0xB0, 0x40, 0xB0, 0xD3, 0x22, 0xD0, 0x24, 0xD2, 0xB0, 0x20, 0xD2, 0x24, 0xD2,
+0x24, 0xD6, 0xB1, 0x40, 0xB1, 0xD6, 0x27, 0xD1, 0x21, 0xD2, 0xB0, 0x60, 0x30, 0xA0, 0x30, 0x90,
+0x0A, 0x0B, 0x90, 0x01, 0xA0, 0x02, 0xA0, 0xD2, 0x20, 0xD2, 0x21, 0xD3, 0x21, 0xD2, 0xB1, 0x41,
+0xB0, 0x20, 0xD9, 0x21, 0xD0, 0x26, 0xD1, 0x23, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0x20,
+0xD2, 0xB0, 0x41, 0xB0, 0xD4, 0x20, 0xD0, 0x24, 0xD2, 0x20, 0xD8, 0xB0, 0x40, 0xB0, 0xD5, 0x20,
+0xD0, 0x20, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0x20, 0xD1,
+0x22, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0x40,
+0xD0, 0x21, 0xD1, 0x21, 0xD2, 0xE0, 0x90, 0x05, 0xF0, 0x90, 0x50, 0xF0, 0x07, 0xF0, 0xC0, 0xD5,
+0xB0, 0x20, 0xD4, 0x26, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD1, 0xB0, 0xA0, 0x50, 0xA1, 0xB0,
+0xD1, 0x40, 0xE1, 0x40, 0xE2, 0x30, 0x60, 0xF0, 0x01, 0x90, 0xA0, 0x10, 0xA0, 0xC0, 0xE0, 0xD2,
+0x40, 0xB0, 0xD5, 0xB1, 0xD4, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0x40, 0xB0, 0xD2, 0xC0, 0x20,
+0xD0, 0xB0, 0xA0, 0xD0, 0x20, 0xD5, 0x20, 0x41, 0xB0, 0xD5, 0x21, 0xD1, 0x21, 0xD0, 0x25, 0xD4,
+0x20, 0x41, 0xB0, 0xD2, 0x21, 0xD0, 0x23, 0xD2, 0x40, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x24, 0xD0,
+0x20, 0xD9, 0x20, 0xB0, 0x42, 0xB0, 0xD3, 0x21, 0xD7, 0x21, 0xD1, 0xA0, 0xF0, 0x01, 0xA0, 0x0B,
+0x0E, 0x80, 0x70, 0x01, 0xE0, 0xB0, 0xD0, 0x20, 0xD0, 0x21, 0xD7, 0x20, 0xB0, 0x41, 0xB1, 0xD4,
+0x21, 0xD3, 0x2D, 0xD4, 0x21, 0xB0, 0xD8, 0x20, 0x41, 0xB0, 0xD5, 0x2A, 0xD2, 0x20, 0xD4, 0x41,
+0xB0, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD2, 0x20, 0x40, 0xB0, 0xD2, 0x22, 0xD1,
+0x20, 0xD2, 0x27, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x24,
+0xD1, 0x40, 0x23, 0xD1, 0x21, 0xB0, 0x40, 0xD0, 0xE0, 0x50, 0x70, 0x07, 0x80, 0x90, 0x50, 0x70,
+0x04, 0xF0, 0xA0, 0xD2, 0x20, 0xD1, 0xB0, 0x20, 0xDB, 0x20, 0xB0, 0x42, 0xD2, 0x22, 0xD1, 0xC0,
+0x61, 0x50, 0x40, 0xC0, 0x60, 0xD1, 0xA0, 0xD2, 0x42, 0x70, 0x60, 0x05, 0x90, 0xC0, 0xA1, 0xE0,
+0xB0, 0x40, 0xD0, 0xE1, 0xB0, 0xE0, 0xA0, 0xE1, 0xA0, 0xC0, 0xE0, 0xA0, 0xB0, 0xD4, 0xB0, 0xE3,
+0x60, 0xB0, 0x40, 0xB0, 0xD1, 0xB0, 0xD0, 0x41, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD3, 0xB0, 0x40,
+0xB0, 0xD4, 0x22, 0xD1, 0x2A, 0xD3, 0xB0, 0x41, 0xB0, 0xD5, 0x20, 0xD2, 0x40, 0xD1, 0x20, 0xD0,
+0x23, 0xD2, 0x27, 0xD1, 0x21, 0xD0, 0x22, 0xD4, 0xB0, 0x41, 0xB0, 0x20, 0xD9, 0x20, 0xD2, 0x60,
+0x02, 0xA0, 0x0B, 0x0E, 0xF0, 0x30, 0xF0, 0x90, 0xA0, 0xE0, 0xD1, 0x23, 0xD3, 0xB1, 0x41, 0xB0,
+0x20, 0xD2, 0x2F, 0x06, 0xD1, 0x22, 0xD4, 0x40, 0xD1, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0x20, 0xD7,
+0x27, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xB0, 0x40, 0x20, 0xD8, 0x21, 0xD2, 0x40,
+0xD1, 0xB0, 0x40, 0xB0, 0xD6, 0x22, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1,
+0x23, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x22, 0xD3, 0xB0, 0xC0, 0xD0, 0x40, 0xA0,
+0x70, 0x06, 0x50, 0xF0, 0x00, 0xF0, 0x70, 0x52, 0x70, 0x01, 0x60, 0x50, 0xD1, 0x20, 0xD1, 0xB0,
+0x20, 0xD7, 0xB2, 0x40, 0xB0, 0xD2, 0x40, 0xB1, 0x40, 0xD1, 0x20, 0xD1, 0x41, 0xB0, 0xD0, 0x40,
+0xC0, 0xE0, 0xD1, 0x20, 0xD3, 0x40, 0xA0, 0xE1, 0x60, 0xA0, 0x60, 0x90, 0x04, 0x70, 0xC0, 0xE0,
+0xD0, 0xE0, 0xA0, 0xE0, 0x30, 0x60, 0x90, 0x03, 0x30, 0xC0, 0xA1, 0x40, 0xD1, 0xA0, 0xE0, 0x51,
+0x60, 0xC0, 0xD0, 0x60, 0xB1, 0x40, 0xD0, 0xE0, 0x60, 0xD0, 0x60, 0x40, 0xD4, 0x20, 0xD5, 0xB0,
+0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x2B, 0xD0, 0x22, 0xD4, 0xB0, 0x41, 0xB0, 0xD5, 0xB1, 0xD0, 0x20,
+0xD2, 0x22, 0xD4, 0x29, 0xD3, 0x24, 0xD2, 0xB1, 0x40, 0xB1, 0xD5, 0x22, 0xD1, 0xC0, 0x80, 0x50,
+0x70, 0x30, 0x0B, 0x0F, 0x00, 0xC0, 0x80, 0x50, 0x00, 0x60, 0xD5, 0x20, 0xB0, 0x41, 0xB1, 0xD5,
+0x2F, 0x05, 0xD3, 0x23, 0xD1, 0x20, 0xD0, 0x40, 0xB0, 0xD2, 0xB0, 0x41, 0xB0, 0xD8, 0x2B, 0xD0,
+0x20, 0xD2, 0x20, 0x41, 0xB0, 0xD9, 0x22, 0xD2, 0xB0, 0x41, 0xB0, 0xD3, 0x20, 0xD3, 0x22, 0xD0,
+0x20, 0xD1, 0x25, 0xD1, 0x20, 0x40, 0xD2, 0x23, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xB0, 0xD0,
+0x23, 0xD4, 0x41, 0x50, 0x60, 0x07, 0x90, 0x05, 0xF0, 0x70, 0x90, 0x50, 0x30, 0xE0, 0xB1, 0x21,
+0xD0, 0x40, 0xB0, 0x20, 0xB2, 0x43, 0xB2, 0xD1, 0x50, 0x40, 0x60, 0xE1, 0x60, 0x10, 0xA0, 0xD5,
+0x40, 0xD4, 0x23, 0xD2, 0x40, 0xB0, 0x40, 0xB0, 0xD0, 0xE0, 0x80, 0x00, 0x50, 0x80, 0xE0, 0x10,
+0x60, 0xB0, 0xD1, 0xA0, 0xE0, 0x50, 0x01, 0xA0, 0x06, 0xF0, 0xC0, 0xD1, 0x60, 0x80, 0xA1, 0x40,
+0xD1, 0xE0, 0xD1, 0xB0, 0x40, 0xB0, 0x40, 0xE0, 0x40, 0xB0, 0xA0, 0xE0, 0xD0, 0x21, 0xD3, 0x20,
+0xD3, 0xB0, 0x40, 0xB0, 0xD4, 0x24, 0xD0, 0x25, 0xD0, 0x23, 0xD3, 0xB1, 0x40, 0xB0, 0xD3, 0x40,
+0xDC, 0x2B, 0xD3, 0x24, 0xD5, 0xB0, 0x42, 0xB0, 0xD5, 0x40, 0x80, 0x70, 0x90, 0xA0, 0x90, 0x0B,
+0x0F, 0x00, 0x30, 0x02, 0xA0, 0xD2, 0xB0, 0x41, 0xB1, 0xD6, 0x20, 0xD0, 0x21, 0xD0, 0x26, 0xD2,
+0x26, 0xD0, 0x24, 0xD0, 0x22, 0xD4, 0x40, 0xB0, 0x41, 0xB0, 0xD8, 0x2D, 0xD3, 0xB0, 0x41, 0xD5,
+0x20, 0xD1, 0x25, 0xD3, 0x41, 0xD2, 0x21, 0xD1, 0x27, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0xB0, 0x40,
+0xD2, 0x22, 0xD1, 0x24, 0xD2, 0xB0, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x40, 0xE0,
+0x30, 0x02, 0x80, 0x03, 0x50, 0x07, 0x50, 0x00, 0x70, 0x10, 0xD0, 0xB2, 0x42, 0xB2, 0x21, 0xD1,
+0x40, 0xD2, 0xE0, 0xA0, 0x30, 0x90, 0x01, 0x50, 0x01, 0xA0, 0xD1, 0x20, 0xD2, 0xB1, 0xD3, 0x21,
+0xD4, 0xB0, 0x40, 0xD1, 0xB0, 0x10, 0xE0, 0x60, 0xE0, 0xB1, 0xD3, 0x20, 0xD1, 0x60, 0x50, 0x70,
+0xA0, 0x03, 0x61, 0xA0, 0x10, 0x42, 0xD0, 0x40, 0xD5, 0x21, 0xD1, 0x41, 0xB0, 0xD0, 0x11, 0xB0,
+0xD0, 0x23, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x22, 0xD0, 0x20, 0xD3, 0x21,
+0xD1, 0x20, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0xB0, 0x42, 0xD0, 0xB0, 0xD1, 0x20, 0xD4, 0x24, 0xD1,
+0x29, 0xD7, 0x21, 0xD7, 0x20, 0xB0, 0x41, 0xB1, 0xD1, 0xE0, 0x70, 0x01, 0x80, 0xF0, 0x0B, 0x0F,
+0x00, 0x80, 0x70, 0x00, 0xF0, 0xA0, 0x41, 0xB0, 0xD4, 0x29, 0xD4, 0x23, 0xD2, 0x20, 0xD0, 0x22,
+0xD1, 0x21, 0xD2, 0x20, 0xD0, 0x20, 0xD4, 0x20, 0xB0, 0xE0, 0xB0, 0xD3, 0x20, 0xD0, 0x21, 0xD4,
+0x24, 0xD3, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x29, 0xD0, 0x20, 0x41,
+0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x24, 0xD1, 0x26, 0xD3, 0x40, 0xB0, 0xD1, 0x23, 0xD2, 0x23, 0xD2,
+0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD0, 0x40, 0xD0, 0x60, 0x80, 0x06, 0x50, 0xF0,
+0x07, 0x50, 0x01, 0xA0, 0xD4, 0x40, 0xD7, 0xB1, 0xD0, 0xE1, 0x04, 0x90, 0x00, 0x50, 0xC0, 0xD2,
+0x20, 0xD2, 0x40, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xB0, 0xD0, 0xB0, 0x40, 0xD1, 0xB0, 0xD4,
+0x20, 0xD4, 0xC0, 0x60, 0xC0, 0x80, 0x10, 0xF0, 0xE0, 0xC0, 0x60, 0xB0, 0xDC, 0x21, 0xD0, 0x21,
+0x40, 0xD0, 0xB0, 0x40, 0xE1, 0x40, 0xD0, 0x23, 0xD1, 0x23, 0xD4, 0xB0, 0x41, 0xD4, 0x21, 0xDC,
+0x24, 0xD2, 0xB0, 0x41, 0xB0, 0xD4, 0x20, 0xD1, 0x25, 0xD5, 0x25, 0xD8, 0x25, 0xD5, 0xB0, 0x40,
+0xB0, 0xC0, 0x70, 0x01, 0xA0, 0x0C, 0x0F, 0x00, 0x70, 0xA0, 0x31, 0x80, 0xE0, 0xD6, 0x20, 0xD2,
+0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD2, 0x24, 0xD8, 0x24, 0xD2, 0xB0, 0x41, 0xD0, 0xB1,
+0xD4, 0x25, 0xD7, 0x22, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD3, 0x26, 0xD3, 0xB0, 0x40, 0xD3,
+0x40, 0xB0, 0xD2, 0x25, 0xD4, 0x21, 0xD4, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD3, 0x22, 0xD0, 0x20,
+0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x60, 0x04, 0x30, 0xC0, 0xF0,
+0x50, 0x08, 0x90, 0x01, 0x50, 0xE0, 0xD3, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0,
+0xE0, 0x70, 0x04, 0x71, 0x60, 0xC0, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x20, 0xD0,
+0x20, 0xD2, 0xE1, 0xD1, 0xB1, 0xD3, 0x20, 0xD4, 0xA1, 0x60, 0xC0, 0x60, 0xE0, 0xA1, 0xF0, 0xA0,
+0xD8, 0x23, 0xD1, 0x21, 0xD2, 0x40, 0xD3, 0xB0, 0xE0, 0x60, 0xD2, 0x26, 0xD3, 0x21, 0xD1, 0xB0,
+0x41, 0xB0, 0xD3, 0x24, 0xD5, 0x22, 0xD1, 0x21, 0xD3, 0x40, 0xD0, 0xB0, 0x40, 0xB1, 0xD2, 0x2B,
+0xD5, 0x23, 0xD5, 0x20, 0xD2, 0x21, 0xD8, 0xB0, 0xA0, 0x90, 0xA0, 0x30, 0x80, 0x0C, 0x0F, 0x01,
+0x60, 0x02, 0x60, 0xD0, 0x20, 0xD5, 0x21, 0xD4, 0x26, 0xD2, 0x24, 0xDD, 0xB0, 0x41, 0xB0, 0xD2,
+0x20, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x27, 0xD3, 0x21, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x25,
+0xD1, 0x24, 0xD3, 0xB0, 0x40, 0xB0, 0xD5, 0x40, 0xD2, 0x26, 0xD4, 0x20, 0xD3, 0x40, 0xB0, 0xD1,
+0x20, 0xD0, 0x21, 0xD3, 0x22, 0xD3, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD1,
+0xE0, 0x50, 0x03, 0x50, 0x80, 0x51, 0x02, 0x80, 0xF0, 0x03, 0x50, 0x02, 0x30, 0x40, 0xD0, 0x20,
+0xD0, 0x40, 0x20, 0xD0, 0x21, 0xD4, 0x40, 0xD0, 0xE0, 0x70, 0x05, 0xA0, 0xE0, 0xD1, 0x23, 0xD2,
+0x40, 0x20, 0xD1, 0x20, 0xD0, 0xA0, 0x40, 0xD5, 0x40, 0xB0, 0xD5, 0x20, 0xD1, 0xC0, 0x30, 0xC0,
+0xE1, 0x40, 0xD0, 0x40, 0x60, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x25, 0xD6, 0xB1, 0xD5, 0x41,
+0xD3, 0x26, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x41, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD3, 0x20, 0xD5,
+0x22, 0xD1, 0xB1, 0xD3, 0xB0, 0x41, 0x20, 0xD6, 0x25, 0xD4, 0x26, 0xD3, 0x23, 0xD5, 0x20, 0xD2,
+0x40, 0x90, 0x01, 0x91, 0x0C, 0x0F, 0x01, 0x30, 0xF0, 0x01, 0x30, 0xB0, 0xD3, 0x23, 0xD1, 0xE0,
+0x40, 0xD3, 0x24, 0xD4, 0x27, 0xD5, 0xB0, 0x41, 0xB0, 0xD6, 0x40, 0xB0, 0xD4, 0x20, 0xD1, 0x25,
+0xD0, 0x20, 0xD4, 0x41, 0xB0, 0xD2, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD2, 0x21, 0xD2, 0x40, 0xB0,
+0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB1, 0xD1, 0x27, 0xD2, 0x20, 0xD2, 0xB0, 0x40, 0xD4, 0x21, 0xD0,
+0x20, 0xD1, 0x23, 0xD2, 0x40, 0x20, 0xD0, 0xA0, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x60,
+0x05, 0x50, 0xF0, 0x02, 0x70, 0x03, 0x71, 0x03, 0xA0, 0xB0, 0xD1, 0x40, 0x20, 0xD0, 0x21, 0xD0,
+0x21, 0xD1, 0x40, 0xD0, 0x60, 0xF0, 0x05, 0xA0, 0xB0, 0xD0, 0x23, 0xD1, 0x20, 0xD1, 0x40, 0xD1,
+0x20, 0xD0, 0x40, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xE0, 0xA1, 0xE0, 0xB0, 0xD1, 0x20, 0xD1, 0xB0,
+0x40, 0xD5, 0xB0, 0x40, 0xD1, 0x26, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x40, 0xD0, 0x20, 0xD1, 0x20,
+0xD1, 0x40, 0xC0, 0xE0, 0xB0, 0xD1, 0x22, 0xD3, 0x20, 0xD0, 0x21, 0xD5, 0x20, 0x41, 0xB0, 0xD7,
+0x20, 0xD0, 0x25, 0xD0, 0x20, 0xD2, 0x40, 0xD6, 0xB0, 0x41, 0xB0, 0xD4, 0x21, 0xD0, 0x26, 0xD3,
+0x27, 0xD2, 0x26, 0xD3, 0xE0, 0x70, 0x01, 0x80, 0x70, 0x0C, 0x0F, 0x01, 0x92, 0x30, 0xC0, 0x40,
+0xD3, 0x20, 0xD1, 0x21, 0xD0, 0xE0, 0x60, 0xD3, 0x24, 0xD6, 0x24, 0xD3, 0x20, 0x41, 0xB0, 0xD7,
+0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x27, 0xD3, 0xB0, 0x41, 0xB0, 0xD2, 0x23, 0xD1,
+0x25, 0xD3, 0x20, 0xB0, 0x40, 0xD2, 0x23, 0xD3, 0x40, 0x20, 0xD2, 0x28, 0xD2, 0xB0, 0x40, 0xD2,
+0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0xB1, 0xD4, 0x25, 0xD1, 0x40, 0xD3, 0xB0, 0x60,
+0x80, 0x03, 0x90, 0x08, 0x50, 0xF0, 0x03, 0x50, 0xE0, 0xD1, 0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD2,
+0x40, 0xB0, 0xE0, 0x06, 0xC0, 0xB0, 0xD1, 0x21, 0xD5, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x22,
+0xD0, 0xE0, 0xC0, 0x40, 0x00, 0x70, 0xA0, 0x10, 0xD1, 0x20, 0xD3, 0x23, 0xD2, 0xB0, 0x40, 0xD1,
+0x22, 0xD0, 0x20, 0xD0, 0x24, 0xD2, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0,
+0x40, 0xB0, 0xD5, 0x22, 0xD4, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x21,
+0xD1, 0x21, 0xD3, 0x40, 0xD0, 0x21, 0xD6, 0xB0, 0x41, 0xB0, 0xD4, 0x26, 0xD4, 0x2F, 0x02, 0xD2,
+0xC0, 0x30, 0x80, 0x70, 0xA0, 0x0D, 0x0F, 0x01, 0x70, 0x60, 0x50, 0xF0, 0x70, 0xE0, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x25, 0xD1, 0x21, 0xD4, 0x20, 0xD1, 0x21, 0xD4, 0xB0,
+0x40, 0xB1, 0xDC, 0x40, 0xD2, 0x28, 0xD3, 0xB0, 0x40, 0xB1, 0xD3, 0x23, 0xD0, 0x21, 0xD0, 0x20,
+0xD0, 0x21, 0xD3, 0xB0, 0x40, 0xB0, 0xD3, 0x25, 0xD2, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x20,
+0xD2, 0xB1, 0xD1, 0x25, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0xB1, 0xD1, 0x20, 0xD3, 0x20, 0xD4, 0xB1,
+0xD0, 0x20, 0xD3, 0xE0, 0xA0, 0x01, 0x71, 0x90, 0xF0, 0x06, 0x90, 0x05, 0xA0, 0xB0, 0xD0, 0xB0,
+0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0x60, 0x70, 0x05, 0xF0, 0xE0, 0x40, 0xD1, 0x21, 0xD0,
+0x21, 0xD3, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x23, 0xB0, 0xA0, 0xE0, 0x60, 0x41, 0xD1, 0x21,
+0xD2, 0x24, 0xD2, 0xB0, 0x40, 0xD1, 0x24, 0xD0, 0x24, 0xD0, 0xB1, 0xD1, 0x20, 0xD2, 0x21, 0xD0,
+0x40, 0xC0, 0xD1, 0x41, 0xD3, 0x25, 0xD3, 0x22, 0xD3, 0xB0, 0x40, 0xB0, 0xD3, 0x24, 0xD1, 0x21,
+0xD2, 0xB1, 0xDB, 0x20, 0xB0, 0x40, 0xB1, 0xD3, 0x23, 0xD4, 0x21, 0xD1, 0x29, 0xD0, 0x22, 0xD2,
+0xB0, 0xE0, 0x00, 0x70, 0x30, 0x80, 0x0D, 0x0F, 0x02, 0xA0, 0x02, 0xA0, 0xD2, 0x21, 0xD0, 0x20,
+0xD0, 0x23, 0xD0, 0x25, 0xD2, 0x22, 0xD6, 0xB0, 0x40, 0xB1, 0xD3, 0x24, 0xD3, 0x21, 0xD0, 0xB1,
+0xD3, 0x24, 0xD3, 0xB0, 0x41, 0xD3, 0x27, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD4,
+0x20, 0xD2, 0x23, 0xD1, 0x40, 0xB0, 0xD2, 0x23, 0xD0, 0x20, 0xD2, 0xB1, 0xD3, 0x25, 0xD2, 0x20,
+0xD3, 0x20, 0x40, 0xD1, 0x24, 0xD6, 0x40, 0xD7, 0x40, 0xA0, 0x00, 0x50, 0x00, 0x30, 0x10, 0x70,
+0x05, 0x50, 0x05, 0xF0, 0x10, 0xE0, 0x40, 0xD5, 0x40, 0xE0, 0x61, 0x70, 0x05, 0x70, 0x10, 0xA0,
+0x40, 0xD0, 0x20, 0xD2, 0x23, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD3,
+0x40, 0xD1, 0x21, 0xD4, 0x25, 0xD3, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0xE0,
+0xD3, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0x40, 0xD2, 0xC0, 0x40, 0xB0, 0xD2, 0x20, 0xD3, 0x20, 0xD0,
+0x27, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x22, 0xD1, 0x21, 0xD2, 0x40, 0xD2, 0x20, 0xD0, 0x26, 0xD3,
+0xB0, 0x41, 0xB0, 0xDC, 0x21, 0xD0, 0x25, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0xE0, 0x70, 0x01, 0x80,
+0x70, 0x0D, 0x0F, 0x02, 0x80, 0x70, 0x00, 0x50, 0x60, 0x40, 0xD1, 0x23, 0xD0, 0x22, 0xD0, 0x20,
+0xD4, 0x24, 0xD5, 0xB0, 0x41, 0xB0, 0xD3, 0x21, 0xD4, 0x24, 0xD2, 0x20, 0x40, 0xD4, 0x21, 0xD3,
+0xB0, 0x41, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x23, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0x20,
+0xD0, 0x20, 0xD4, 0x21, 0xD1, 0x21, 0xD1, 0x40, 0xB0, 0x40, 0xB0, 0xD0, 0x25, 0xD2, 0x40, 0xB0,
+0xD2, 0x20, 0xD4, 0x21, 0xD1, 0x21, 0xD3, 0x40, 0xD2, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40,
+0xD3, 0x21, 0xD0, 0x20, 0xD1, 0xE0, 0xA0, 0x80, 0x00, 0x90, 0x60, 0x90, 0x05, 0x50, 0x03, 0xF0,
+0x80, 0x00, 0x50, 0x80, 0xE1, 0x70, 0x40, 0x61, 0x10, 0x81, 0x10, 0xA0, 0x70, 0x04, 0xF0, 0xC0,
+0x10, 0xC0, 0xD0, 0xB0, 0xD0, 0x25, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD0, 0x20,
+0xD3, 0xB1, 0xD2, 0x21, 0xD0, 0x21, 0xD1, 0x23, 0xD4, 0x40, 0xB0, 0xD5, 0x21, 0xD1, 0x40, 0x20,
+0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0xE0, 0xA0, 0xD4, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD1,
+0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD3, 0xB0, 0x41, 0xD4, 0x21, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20,
+0xD0, 0x25, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0xB0, 0x41, 0xB0, 0xD2, 0x26, 0xD4, 0x20, 0xD3, 0x26,
+0xD1, 0xC0, 0x80, 0x01, 0x30, 0x0E, 0x0F, 0x02, 0x70, 0x60, 0xA0, 0x90, 0x50, 0xE0, 0xD0, 0x27,
+0xD6, 0x22, 0xD5, 0x20, 0xB0, 0x40, 0xB0, 0xD4, 0x25, 0xD2, 0x27, 0xD0, 0x40, 0xD8, 0xB0, 0x40,
+0xB0, 0xD2, 0x25, 0xD2, 0x22, 0xD0, 0x21, 0xD3, 0xB0, 0x40, 0xD1, 0x22, 0xD3, 0x20, 0xD0, 0x20,
+0xD3, 0xB0, 0x40, 0xD2, 0x40, 0xD1, 0x22, 0xD2, 0xB0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x23,
+0xD0, 0x20, 0xD2, 0x40, 0xD3, 0x28, 0xD1, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0,
+0xE0, 0xA0, 0x60, 0x50, 0x05, 0xF0, 0x50, 0x04, 0x60, 0x70, 0x01, 0x70, 0x80, 0xA1, 0x90, 0x05,
+0x90, 0xF0, 0x70, 0x51, 0x30, 0x60, 0x00, 0x10, 0x40, 0xD0, 0x40, 0xD4, 0x20, 0xD0, 0x21, 0xD1,
+0x20, 0x40, 0xD3, 0x22, 0xD3, 0x20, 0xD1, 0x40, 0xB0, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0x24, 0xD0,
+0x21, 0xD1, 0xB1, 0xD7, 0x40, 0xB0, 0xD1, 0x41, 0xD3, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0xD3,
+0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x24, 0xD1, 0x21, 0xD0, 0x20, 0xD4, 0x40, 0xB0, 0xD3, 0x22,
+0xD1, 0x40, 0xD2, 0x26, 0xD3, 0x25, 0xD2, 0xB0, 0x41, 0xB0, 0xD3, 0x25, 0xD5, 0x20, 0xD0, 0x25,
+0xD1, 0xA0, 0x70, 0x32, 0x0E, 0x0F, 0x03, 0xA0, 0x02, 0xA0, 0xD0, 0x26, 0xD4, 0x26, 0xD2, 0xB0,
+0x40, 0xB0, 0x20, 0xD9, 0x23, 0xD2, 0x23, 0xD0, 0x20, 0xD1, 0x20, 0x40, 0xD5, 0xB0, 0x40, 0xB0,
+0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x23, 0xD2, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x20,
+0xD0, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0x22, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0xB0,
+0x40, 0xD2, 0x22, 0xD1, 0x21, 0xD3, 0x21, 0xD3, 0x40, 0x20, 0xD4, 0x25, 0xD0, 0x20, 0xD0, 0x40,
+0xD0, 0x20, 0xD4, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD2, 0xA0, 0x40, 0x04, 0x71, 0x08, 0x50, 0x09,
+0x30, 0x81, 0x91, 0xA0, 0x70, 0x00, 0xC0, 0xA0, 0xD0, 0x40, 0xD5, 0x23, 0xD1, 0x40, 0xB0, 0xD1,
+0x23, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x21, 0xD4, 0x22, 0xD0, 0x22, 0xD2, 0xB0,
+0x40, 0xD1, 0x20, 0xD2, 0xB1, 0xD3, 0xB0, 0x40, 0xB0, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x23,
+0xD1, 0x41, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x23, 0xD2, 0x21, 0xD3, 0x20, 0x41, 0x20, 0xD4, 0x20,
+0x40, 0xD3, 0x20, 0xD2, 0x28, 0xD2, 0x22, 0xD2, 0xB0, 0x41, 0xD3, 0x26, 0xD2, 0x20, 0xD2, 0x21,
+0xD0, 0x20, 0xD0, 0xE0, 0x50, 0x01, 0x80, 0x50, 0x70, 0x90, 0x0C, 0x0F, 0x03, 0x30, 0x02, 0xA0,
+0xB0, 0xD0, 0x22, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x22, 0xD4, 0xB0, 0x41, 0xB0, 0xD3, 0x24, 0xD3,
+0x23, 0xD3, 0x22, 0xD4, 0x40, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD4, 0x22, 0xD0, 0x22, 0xD6,
+0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD0,
+0x22, 0xD1, 0xB0, 0x40, 0xD3, 0xB0, 0x40, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x21, 0xD3, 0x21, 0xD2,
+0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x26, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x40,
+0xD3, 0xE0, 0xA0, 0x70, 0x02, 0x50, 0xF0, 0x08, 0x50, 0xF0, 0x07, 0x90, 0xA0, 0x03, 0x80, 0x70,
+0xF0, 0x60, 0xE0, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD0,
+0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD3, 0x25, 0xD0, 0x21, 0xD2, 0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x40,
+0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xB0, 0xD3, 0xE0, 0x21, 0xD1, 0x23, 0xD2, 0xB0, 0x40, 0xB0,
+0xD6, 0x25, 0xD0, 0x21, 0xD1, 0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x40, 0xB0, 0x20, 0xD4, 0x2F,
+0x03, 0xD2, 0xB0, 0x41, 0xB0, 0x20, 0xD2, 0x20, 0xD1, 0x21, 0xD2, 0x20, 0xD3, 0x20, 0xD1, 0x60,
+0x02, 0x30, 0xF0, 0x30, 0x50, 0x90, 0x0B, 0x0F, 0x03, 0x70, 0x33, 0xE0, 0xD0, 0x21, 0xD1, 0x21,
+0xD1, 0x23, 0xD2, 0xB0, 0x41, 0xB0, 0xD5, 0x25, 0xD3, 0x22, 0xD1, 0x26, 0xD3, 0xB1, 0xD0, 0x41,
+0xB0, 0xD1, 0x24, 0xD4, 0x22, 0xD7, 0x41, 0xD2, 0x23, 0xD4, 0x21, 0xD2, 0x41, 0xD3, 0x23, 0xD0,
+0x40, 0xB0, 0xD1, 0x40, 0xB0, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0x23, 0xD2, 0x21, 0xD1, 0xB1, 0xD1,
+0x20, 0xD1, 0x21, 0xD1, 0x23, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0xD2,
+0x20, 0xD1, 0xB0, 0xA0, 0x60, 0x50, 0x00, 0x50, 0x09, 0x50, 0xF0, 0x00, 0x90, 0x10, 0x50, 0x03,
+0x50, 0x60, 0x03, 0x80, 0x70, 0x00, 0x60, 0xD2, 0x40, 0xD0, 0x20, 0xD1, 0x26, 0xD0, 0xB1, 0xD1,
+0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x24, 0xD0,
+0x24, 0xD3, 0x40, 0xB0, 0xD1, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0x60,
+0x21, 0xD2, 0x25, 0xD1, 0xB0, 0x40, 0xB0, 0xD7, 0x22, 0xD4, 0x22, 0xD3, 0xB0, 0x40, 0xB0, 0xD0,
+0x40, 0xD2, 0x21, 0xD0, 0x2C, 0xD1, 0x21, 0xD1, 0x20, 0xD5, 0x20, 0x41, 0xB0, 0xD4, 0x22, 0xD0,
+0x20, 0xD2, 0x21, 0xD1, 0x60, 0x31, 0x90, 0x30, 0x00, 0x31, 0x70, 0x0B, 0x0F, 0x04, 0xC0, 0xF0,
+0x01, 0x60, 0xD0, 0x21, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xB0, 0x40, 0xB0, 0xD3, 0x22, 0xD1,
+0x26, 0xD0, 0x21, 0xD4, 0x24, 0xD5, 0xB0, 0x41, 0xD4, 0x23, 0xD4, 0x23, 0xD5, 0x41, 0xD3, 0x24,
+0xD5, 0x20, 0xD0, 0x20, 0x40, 0xB0, 0xD5, 0x23, 0xD0, 0x40, 0xB0, 0x40, 0xB0, 0xD1, 0x23, 0xD1,
+0x20, 0xD1, 0x22, 0xD5, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0xB1,
+0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x21, 0xD3, 0xA0, 0x60, 0xE0, 0x50, 0x08,
+0x50, 0x09, 0x70, 0xA0, 0x70, 0x01, 0x80, 0xF0, 0x90, 0xE0, 0xD2, 0xB0, 0x60, 0xE0, 0xD6, 0x21,
+0xD1, 0x40, 0xD1, 0x24, 0xD0, 0x23, 0xD2, 0xB0, 0x40, 0xD0, 0x22, 0xD0, 0x25, 0xD0, 0x26, 0xD1,
+0x40, 0xB0, 0x40, 0x20, 0xD1, 0x23, 0xD4, 0x40, 0xB0, 0xD3, 0x60, 0xE0, 0xD1, 0x26, 0xD1, 0xB0,
+0x40, 0xB0, 0xD5, 0x21, 0xD2, 0x26, 0xD4, 0xB0, 0x41, 0xD4, 0x25, 0xD0, 0x21, 0xD0, 0x26, 0xD0,
+0x20, 0xD2, 0x24, 0xD2, 0xB0, 0x41, 0xB0, 0xD2, 0x23, 0xD1, 0x21, 0xD1, 0x40, 0x90, 0x01, 0x80,
+0x90, 0x0F, 0x00, 0x0F, 0x01, 0xA0, 0x60, 0xF0, 0x30, 0xF0, 0x01, 0xE0, 0xB0, 0xD0, 0x20, 0xD3,
+0x20, 0xD2, 0xB0, 0x40, 0xB1, 0xD3, 0x21, 0xD0, 0x24, 0xD4, 0x24, 0xD0, 0x24, 0xD1, 0x21, 0xD2,
+0xB0, 0x40, 0xB2, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x21, 0xD0, 0x20, 0xD3,
+0xB0, 0x40, 0xB0, 0xD5, 0x22, 0xD0, 0x21, 0xD4, 0xB0, 0x40, 0x20, 0xD3, 0x20, 0xD2, 0x22, 0xD1,
+0xE0, 0xB0, 0xD2, 0x20, 0xD0, 0x27, 0xD3, 0x20, 0xD2, 0x40, 0xD1, 0x25, 0xD2, 0x20, 0xD0, 0x20,
+0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x24, 0xD1, 0xB1, 0xD1, 0x24, 0xD3, 0x40, 0xA1, 0x50, 0x06, 0x80,
+0xC0, 0x90, 0xF0, 0x01, 0xA0, 0x80, 0x01, 0x70, 0x50, 0x80, 0xA0, 0x01, 0x81, 0xC0, 0x70, 0xB1,
+0xE1, 0x80, 0x60, 0xA2, 0xC0, 0x60, 0xB0, 0xD4, 0xB1, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x24, 0xD2,
+0xB1, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x25, 0xD0, 0x24, 0xD2, 0x41, 0xD4, 0x20, 0xD0, 0xB0, 0x22,
+0xD1, 0xB0, 0x40, 0xD2, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xB0,
+0xD2, 0x21, 0xD3, 0x25, 0xD7, 0x40, 0xB0, 0x40, 0xB0, 0xD2, 0x25, 0xD2, 0x22, 0xD1, 0x20, 0xD5,
+0x27, 0xD3, 0xB0, 0x41, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xA0, 0x02, 0x30, 0x00, 0x70,
+0x80, 0x50, 0xF0, 0x0B, 0x0B, 0x70, 0x80, 0x70, 0x02, 0x50, 0x30, 0x51, 0x00, 0x90, 0xC0, 0xE0,
+0xD6, 0xB0, 0x41, 0xB0, 0xD4, 0x23, 0xD0, 0x24, 0xD3, 0x25, 0xD1, 0x23, 0xD4, 0xB0, 0x41, 0xD2,
+0x40, 0xD1, 0x21, 0xD2, 0x21, 0xD0, 0x22, 0xD6, 0x20, 0x40, 0xB0, 0xD3, 0x20, 0xD2, 0x23, 0xD0,
+0x20, 0xD3, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0,
+0x40, 0xD3, 0x26, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD3, 0x25, 0xD0, 0x20, 0xD3, 0x40, 0xD2,
+0x23, 0xD0, 0x22, 0xD1, 0xB0, 0x20, 0xD1, 0x23, 0xD3, 0xB1, 0xD0, 0x40, 0xA1, 0x30, 0xF0, 0x01,
+0x90, 0x60, 0xE1, 0x60, 0x10, 0x50, 0x00, 0x80, 0x10, 0xA0, 0x30, 0x80, 0x90, 0x80, 0x50, 0x01,
+0x90, 0x11, 0xC0, 0xE3, 0x80, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x80, 0x10, 0x60, 0xB0, 0xD3, 0x40,
+0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20,
+0xD2, 0x23, 0xD1, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0x40, 0xD2, 0x21, 0xD0, 0xA0, 0xD6, 0x41, 0xC0,
+0xE0, 0xD4, 0x20, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD6, 0x24, 0xD4, 0x20, 0xD1,
+0xB0, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD5, 0x21, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x29,
+0xD5, 0x41, 0xB0, 0x20, 0xD6, 0xC0, 0x30, 0x70, 0xF0, 0x30, 0xF0, 0xC0, 0x80, 0x30, 0x10, 0x30,
+0x0A, 0x0B, 0xF0, 0x10, 0x61, 0xF0, 0x01, 0xC0, 0x00, 0xC0, 0x30, 0x50, 0x00, 0x60, 0xD3, 0x20,
+0x41, 0xB0, 0xD3, 0x25, 0xD3, 0x22, 0xD4, 0x22, 0xD1, 0x24, 0xD4, 0xB0, 0x40, 0xB0, 0xD4, 0xB1,
+0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x23, 0xD2, 0x41, 0xD4, 0x21, 0xD0, 0x20,
+0xD3, 0x23, 0xD0, 0xB0, 0x40, 0xD4, 0x22, 0xD1, 0x21, 0xD1, 0xB0, 0x40, 0xD1, 0xB0, 0x40, 0xD1,
+0x22, 0xD2, 0x23, 0xD1, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD0, 0x20,
+0xD2, 0xB0, 0x40, 0xD2, 0x23, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x24, 0xD3, 0xB1, 0xD3, 0xB0, 0x60,
+0xA0, 0x60, 0xE0, 0xD0, 0xB0, 0xD2, 0xA0, 0x30, 0x01, 0x91, 0x01, 0x50, 0x02, 0xC0, 0x60, 0x30,
+0x50, 0x03, 0xF0, 0x70, 0x04, 0x90, 0x10, 0xC0, 0xD2, 0x20, 0xD0, 0x40, 0xD6, 0x24, 0xD0, 0x21,
+0xD0, 0x40, 0x20, 0xD0, 0x21, 0xD2, 0x21, 0xD3, 0x21, 0xD2, 0xB0, 0xE0, 0xD1, 0xB0, 0x40, 0xB0,
+0xE0, 0xD0, 0x20, 0xD2, 0x41, 0xD1, 0xE0, 0x60, 0x10, 0x90, 0x50, 0x60, 0xD1, 0x22, 0xD1, 0x20,
+0xD1, 0x21, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x23, 0xD4, 0x20, 0xD0, 0x20, 0xD1, 0x40,
+0xD1, 0x20, 0xD1, 0x20, 0x41, 0xD3, 0x21, 0xD2, 0x21, 0xD0, 0x24, 0xD2, 0x24, 0xD2, 0x22, 0xD5,
+0xB0, 0x41, 0xB0, 0xD3, 0xE0, 0x50, 0x00, 0x80, 0x60, 0x90, 0x80, 0x50, 0x02, 0x80, 0x60, 0x09,
+0x0C, 0x30, 0x71, 0xC2, 0x90, 0x00, 0x30, 0xF0, 0x01, 0x80, 0x40, 0xD0, 0xB0, 0x41, 0xD4, 0x26,
+0xDC, 0x20, 0xD1, 0x24, 0xD4, 0x41, 0xB0, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x22, 0xD1,
+0x23, 0xD3, 0xB0, 0x40, 0xB0, 0xD0, 0x22, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD3, 0x40, 0xB0,
+0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD3, 0xB0, 0x40, 0xD0, 0x22, 0xD3, 0x21,
+0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x24, 0xD4, 0x40, 0xD1, 0x20, 0xD0,
+0x23, 0xD0, 0x20, 0xD2, 0xB1, 0xD0, 0x22, 0xD0, 0x20, 0xD4, 0xB0, 0x20, 0xD1, 0x21, 0xD5, 0x40,
+0x21, 0xD1, 0x40, 0x60, 0x00, 0x30, 0xF0, 0x01, 0x50, 0x02, 0x70, 0xA0, 0x70, 0x05, 0x50, 0x01,
+0x90, 0x30, 0xA1, 0x90, 0x60, 0xD1, 0x20, 0xD1, 0x40, 0x20, 0xD4, 0x20, 0xD0, 0x21, 0xD1, 0x21,
+0xD2, 0x40, 0xD1, 0x20, 0xD8, 0x20, 0xC0, 0xD0, 0xA0, 0xC0, 0x40, 0xE0, 0xD2, 0xB0, 0x40, 0xD4,
+0xE0, 0x10, 0xA0, 0xE0, 0x11, 0x30, 0x70, 0x61, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20,
+0xD1, 0x25, 0xD1, 0xB0, 0x40, 0x20, 0xD2, 0x21, 0xD5, 0x22, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x21,
+0xD2, 0x41, 0xB0, 0xD7, 0x22, 0xD6, 0x23, 0xD3, 0x23, 0xD1, 0x20, 0xD3, 0xB0, 0x41, 0xB0, 0xD0,
+0xA0, 0x02, 0x30, 0xF1, 0xC0, 0x70, 0x02, 0xA0, 0x70, 0x08, 0x0C, 0x90, 0x30, 0x01, 0xF0, 0x02,
+0x50, 0x90, 0xF0, 0x30, 0x10, 0xA0, 0xB1, 0xD6, 0x23, 0xDF, 0x01, 0x21, 0xD7, 0xB0, 0x40, 0xB0,
+0xD3, 0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x22, 0xD2, 0x23, 0xD0, 0xB0, 0x40, 0xB0, 0xD1, 0x20,
+0xD1, 0x22, 0xD2, 0x22, 0xD3, 0x20, 0x40, 0xB0, 0xD3, 0x25, 0xD3, 0x40, 0xB0, 0xD3, 0x20, 0xD0,
+0xB0, 0x40, 0xD6, 0x25, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x26, 0xD2, 0xB1, 0xD1, 0x20,
+0xD0, 0x23, 0xD4, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD5, 0x40, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0xB0, 0x20, 0xD3, 0x40, 0xA0, 0x30, 0x70, 0x01, 0x70, 0xF0, 0x01, 0x91, 0x06, 0x50,
+0xF0, 0x00, 0x60, 0x71, 0x01, 0x60, 0xB0, 0xD2, 0x20, 0xD0, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD0,
+0x21, 0xD0, 0x21, 0xD2, 0x40, 0xD5, 0xB0, 0xC0, 0xA0, 0x40, 0xD0, 0x40, 0x60, 0x90, 0x50, 0x40,
+0xD3, 0x20, 0xD1, 0xB0, 0xD0, 0x40, 0xE0, 0xD1, 0x11, 0x51, 0x10, 0xC1, 0x10, 0x60, 0xE1, 0x40,
+0xD4, 0x23, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD2, 0x22, 0xD3, 0x20, 0xD0,
+0x21, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x20, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD0,
+0x20, 0xD5, 0x23, 0xD8, 0x22, 0xD5, 0x20, 0xB0, 0x40, 0x10, 0xA0, 0x50, 0xF0, 0x30, 0x01, 0x50,
+0xC0, 0x60, 0x81, 0xA0, 0x09, 0x0C, 0xF0, 0x80, 0x02, 0x50, 0x81, 0x00, 0x60, 0x11, 0x61, 0xD1,
+0x20, 0xD1, 0x26, 0xD6, 0x22, 0xD5, 0x24, 0xD4, 0x41, 0xB0, 0xD2, 0x28, 0xD0, 0x40, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0x40, 0xB0, 0xD3, 0x27, 0xD2, 0x20, 0xD2, 0xB0,
+0x40, 0xD3, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x40, 0xD4, 0x21, 0xD1, 0x40, 0xB0, 0xD5, 0x24,
+0xD0, 0x20, 0x40, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x24, 0xD2, 0x40, 0xD1, 0x23, 0xD0, 0x22, 0xD3,
+0x40, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0,
+0x40, 0x20, 0xD2, 0x20, 0xD0, 0x40, 0xC0, 0xF0, 0x01, 0x71, 0x00, 0x70, 0x10, 0x80, 0x06, 0x70,
+0x50, 0xA0, 0x70, 0x02, 0xF0, 0xA0, 0xD2, 0x20, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD4, 0xC0, 0x90, 0xD0, 0xA0, 0xD0, 0xE0, 0x61, 0xE0,
+0x60, 0xA0, 0xB0, 0xD4, 0x41, 0xB0, 0xD1, 0xA1, 0x02, 0x91, 0xC0, 0x50, 0xF0, 0x90, 0xC0, 0x50,
+0x40, 0xD3, 0x23, 0xD2, 0x24, 0xD2, 0xB0, 0x40, 0xB0, 0xD4, 0x21, 0xD3, 0xB1, 0xD3, 0x20, 0xD0,
+0x20, 0xD0, 0x21, 0xD2, 0x41, 0xB0, 0xD6, 0x20, 0xD4, 0x24, 0xD6, 0x20, 0xD1, 0x20, 0xD0, 0x21,
+0xD1, 0x20, 0xD1, 0xE0, 0x60, 0x12, 0x50, 0x70, 0x02, 0x70, 0x81, 0xF0, 0x09, 0x0E, 0x80, 0x70,
+0x80, 0x10, 0x90, 0x60, 0xF0, 0x80, 0xA0, 0xF0, 0x00, 0x90, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD1,
+0x20, 0xD1, 0x2F, 0x03, 0xD1, 0xB0, 0x41, 0xD4, 0x23, 0xD0, 0x22, 0xD2, 0xB1, 0xD2, 0x21, 0xD3,
+0xB0, 0x40, 0xD3, 0x20, 0xD3, 0x20, 0xD0, 0x23, 0xD4, 0x40, 0xB0, 0xD2, 0x23, 0xD1, 0x22, 0xD1,
+0xB0, 0x40, 0xD3, 0x24, 0xD1, 0xB1, 0xD1, 0x25, 0xD2, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0x20,
+0xD0, 0x23, 0xD1, 0xB1, 0xD1, 0x22, 0xD1, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x24, 0xD2, 0xB0,
+0xD2, 0x20, 0xD0, 0x22, 0xD2, 0xB0, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x60, 0x80, 0x00, 0x71, 0xF0,
+0x60, 0xF0, 0x90, 0x60, 0x31, 0x70, 0x00, 0xF0, 0x80, 0x60, 0x30, 0xF0, 0x03, 0x90, 0xE0, 0xD4,
+0x20, 0xD0, 0x40, 0xD3, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB1, 0xD2, 0xA0, 0x81,
+0x10, 0xD1, 0x40, 0x10, 0x80, 0xF0, 0x00, 0xF0, 0x10, 0xB0, 0xD0, 0x40, 0x60, 0xA0, 0x80, 0x61,
+0xE0, 0x60, 0x90, 0x08, 0x70, 0xA0, 0x70, 0xA1, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD8,
+0xB0, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x20, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x20,
+0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x27, 0xD0, 0x2F, 0x05, 0xD1, 0xA0, 0x01, 0x50, 0xC0, 0x00, 0xA0,
+0x10, 0xA0, 0x50, 0x0D, 0x0D, 0xF0, 0xC0, 0x01, 0x80, 0x70, 0x50, 0x30, 0xF0, 0x80, 0x01, 0x70,
+0x60, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x2F, 0x01, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0xB0,
+0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD0, 0x21, 0xD3, 0x40, 0xD6, 0xB0, 0x40, 0xB0, 0xD3, 0x20,
+0xD0, 0x23, 0xD0, 0x25, 0xD1, 0xB0, 0x40, 0xD2, 0x27, 0xD3, 0xB0, 0x40, 0xD4, 0x24, 0xD1, 0xB0,
+0x40, 0xB0, 0xD1, 0x22, 0xD3, 0x40, 0xD3, 0x22, 0xD1, 0x20, 0xD1, 0x22, 0xD2, 0x40, 0xD0, 0x21,
+0xD0, 0x23, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x20, 0xD2, 0x25, 0xD0, 0xB1, 0xD4, 0x23, 0xD1, 0xB0,
+0x20, 0xD2, 0x22, 0xD1, 0x40, 0xA0, 0x31, 0x10, 0x50, 0xF0, 0x01, 0x70, 0x90, 0x30, 0x00, 0x90,
+0x80, 0x00, 0x50, 0xF0, 0x03, 0x90, 0x40, 0xD3, 0x22, 0xB0, 0x40, 0xD3, 0x24, 0xD1, 0x20, 0xD0,
+0x21, 0xD1, 0xB1, 0xD0, 0x60, 0x70, 0x90, 0xC0, 0xF0, 0x40, 0x60, 0xE0, 0x50, 0x90, 0x02, 0x50,
+0x60, 0xA0, 0xE0, 0x04, 0x70, 0x50, 0x08, 0x70, 0xA0, 0xC0, 0x60, 0xF0, 0xA0, 0x30, 0xA1, 0x40,
+0xD3, 0x23, 0xD9, 0xB0, 0x40, 0xD1, 0x22, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD2, 0x26, 0xD0, 0x20,
+0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x29, 0xD0, 0x26, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x40,
+0xA0, 0x02, 0x30, 0x00, 0x70, 0x30, 0x70, 0xA0, 0xC0, 0x30, 0xF0, 0x0A, 0x0D, 0xF0, 0xA0, 0x01,
+0x80, 0x90, 0x00, 0x80, 0x00, 0xA0, 0x70, 0x31, 0x60, 0xD0, 0x20, 0xD3, 0x2A, 0xD1, 0x26, 0xD3,
+0xB0, 0x40, 0xB0, 0xD4, 0x2E, 0xD0, 0xB0, 0x40, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20,
+0xD2, 0x20, 0xD5, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x25, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xD4, 0x20,
+0xD0, 0x22, 0xD1, 0x40, 0xB0, 0xD0, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD1,
+0x20, 0xD0, 0x24, 0xD2, 0x21, 0xD2, 0x40, 0xD2, 0x28, 0xD2, 0x40, 0xD0, 0x22, 0xD1, 0x24, 0xD0,
+0xB0, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD4, 0x40,
+0xD0, 0xE1, 0xA0, 0x60, 0xE0, 0x80, 0x10, 0x90, 0x60, 0x70, 0x01, 0x50, 0x03, 0x50, 0xA0, 0xD0,
+0x21, 0xD0, 0x22, 0xD0, 0x40, 0xB0, 0xD2, 0x23, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xE0, 0xA0,
+0x70, 0xF0, 0x30, 0x80, 0x10, 0xA0, 0xF0, 0x50, 0x01, 0x90, 0x02, 0xF0, 0x07, 0xF0, 0x90, 0x07,
+0x50, 0xA0, 0x90, 0x00, 0x70, 0xA0, 0x01, 0x90, 0xA0, 0xE0, 0xD2, 0x22, 0xD3, 0x40, 0xE1, 0xA0,
+0xE1, 0xA0, 0xB0, 0x50, 0x40, 0xB0, 0xD3, 0x20, 0x40, 0xD1, 0x23, 0xD0, 0x28, 0xD4, 0xB0, 0x40,
+0xB0, 0xD2, 0x26, 0xD2, 0x26, 0xD2, 0x20, 0xD0, 0x22, 0xD1, 0xA0, 0x80, 0xA0, 0x50, 0x30, 0xF0,
+0x01, 0x80, 0x01, 0xF0, 0x80, 0x70, 0x0A, 0x0E, 0x30, 0xA1, 0x60, 0x03, 0x90, 0xA0, 0xF0, 0x00,
+0x50, 0xE0, 0xD4, 0x26, 0xD1, 0x22, 0xD1, 0x22, 0xD4, 0xB0, 0x40, 0xB0, 0xD6, 0x28, 0xD0, 0x22,
+0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD1, 0x40, 0xB0, 0xD4, 0x21, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x21,
+0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD3,
+0x23, 0xD3, 0x40, 0xB0, 0xD2, 0xB1, 0xD1, 0x20, 0xD1, 0x40, 0x20, 0xD2, 0x27, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0xB0, 0x40, 0xD2, 0x22, 0xD0, 0x24, 0xD1, 0xB1, 0xD0, 0x22, 0xD1, 0x21, 0xD1, 0x20,
+0xD0, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD1,
+0x40, 0xD3, 0x40, 0xE0, 0x40, 0xC1, 0x50, 0x02, 0x50, 0x03, 0x30, 0xC0, 0xD1, 0x23, 0xD1, 0x20,
+0x40, 0xD3, 0x27, 0xD1, 0xB0, 0xE1, 0x50, 0x90, 0x00, 0xA0, 0x01, 0x10, 0x70, 0x50, 0x02, 0xF0,
+0x90, 0x0C, 0x90, 0xF0, 0x09, 0xC0, 0x03, 0x70, 0xA0, 0x41, 0xD5, 0xE0, 0x60, 0xC0, 0x70, 0x30,
+0x60, 0x72, 0xE0, 0xC0, 0xA0, 0x41, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x22, 0xD1, 0x22,
+0xD4, 0xB0, 0x40, 0xB0, 0x20, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x28, 0xD0, 0x21, 0xD1, 0x21, 0xD1,
+0xA0, 0x01, 0x90, 0xC0, 0x0F, 0x04, 0x0F, 0x00, 0x51, 0x80, 0xC2, 0x30, 0x00, 0x30, 0x02, 0x60,
+0xD4, 0x23, 0xD2, 0x20, 0xD1, 0x25, 0xD3, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x27,
+0xD2, 0x20, 0xD2, 0x20, 0xD3, 0x40, 0xB0, 0x40, 0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD5,
+0x21, 0xD2, 0x41, 0xD3, 0x21, 0xD3, 0x23, 0xD1, 0x40, 0x20, 0xD3, 0x20, 0xD1, 0x20, 0xD0, 0x20,
+0xD1, 0xB1, 0xD4, 0xB0, 0x40, 0xD2, 0xB1, 0xD2, 0x20, 0xD0, 0x29, 0xD0, 0x20, 0xD0, 0x40, 0xD3,
+0x28, 0xD1, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD1, 0xB1, 0xD0, 0x20, 0xD4, 0x60,
+0x50, 0x90, 0x60, 0x00, 0x70, 0xF0, 0x02, 0x60, 0xE0, 0xD2, 0x20, 0xD4, 0xB1, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD4, 0xE0, 0xA0, 0x10, 0x02, 0x90, 0x30, 0x01, 0xC0, 0xA0, 0x05, 0x90, 0x0C,
+0x50, 0x70, 0x07, 0xF0, 0x60, 0x04, 0x60, 0x80, 0x30, 0x60, 0xE0, 0xD0, 0xE1, 0xC0, 0x90, 0xF0,
+0x01, 0x30, 0x70, 0x04, 0xC0, 0x11, 0xE0, 0x40, 0xB0, 0x40, 0xD2, 0x21, 0xD1, 0x22, 0xD4, 0x20,
+0xD3, 0x22, 0xD2, 0x20, 0x41, 0xB0, 0xD2, 0x23, 0xD3, 0x20, 0xD2, 0x23, 0xD4, 0x40, 0x90, 0x01,
+0xF0, 0x80, 0x30, 0x80, 0xF0, 0x0F, 0x01, 0x0F, 0x01, 0x60, 0x30, 0xF0, 0x01, 0xA0, 0x70, 0x30,
+0x00, 0x70, 0xE0, 0xC0, 0xB0, 0xD0, 0x20, 0xD2, 0x20, 0xD6, 0x20, 0xD1, 0x20, 0xD3, 0x20, 0x41,
+0x20, 0xD1, 0x24, 0xD1, 0x25, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0xD2,
+0x21, 0xD3, 0x20, 0xD0, 0x22, 0xD0, 0x22, 0xD1, 0xB0, 0x40, 0xB0, 0xD0, 0x27, 0xD1, 0x21, 0xD1,
+0xB0, 0x40, 0xD6, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD2, 0x22, 0xD0, 0xB0, 0x40, 0xD0, 0xB0,
+0x40, 0xD1, 0x23, 0xD0, 0x27, 0xD0, 0x20, 0xD0, 0xB1, 0xD3, 0x24, 0xD0, 0x22, 0xD0, 0xB1, 0xD1,
+0x22, 0xD2, 0x21, 0xD2, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20,
+0xD1, 0x20, 0xD0, 0x24, 0xD1, 0xB1, 0xD4, 0x20, 0xD1, 0xE0, 0xA0, 0x30, 0xA1, 0x50, 0x02, 0x60,
+0x40, 0xD2, 0x21, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD3, 0x21, 0xD2, 0xE0, 0x40, 0x04, 0x50,
+0x90, 0x00, 0x80, 0x91, 0xA0, 0x05, 0x90, 0x0C, 0x51, 0x00, 0xA0, 0x80, 0x04, 0x30, 0xC0, 0x03,
+0x30, 0x00, 0x51, 0x90, 0x10, 0x90, 0x70, 0xF0, 0x02, 0xF0, 0x30, 0x06, 0x30, 0x90, 0x10, 0x42,
+0xD4, 0x22, 0xD5, 0x22, 0xD3, 0x22, 0xD4, 0x41, 0xB0, 0xD2, 0x20, 0xD0, 0x21, 0xD3, 0x25, 0xD4,
+0x60, 0x30, 0x90, 0x00, 0x30, 0x00, 0x50, 0x10, 0x60, 0xC0, 0x90, 0xF0, 0x0D, 0x0F, 0x00, 0x81,
+0x02, 0xF0, 0x60, 0xF0, 0x70, 0x60, 0x80, 0xF1, 0xA0, 0xD7, 0x24, 0xD1, 0x20, 0xD3, 0x41, 0x20,
+0xD2, 0x2B, 0xD4, 0x21, 0xD5, 0xB0, 0x40, 0xB0, 0xD0, 0x40, 0xD0, 0x21, 0xD2, 0x26, 0xD1, 0x20,
+0xD2, 0xB0, 0x40, 0xD4, 0x21, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x20,
+0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD3, 0x23, 0xD0, 0xB0, 0x41, 0xD1, 0x24, 0xD0, 0x24,
+0xD0, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0x21, 0xD0, 0x40, 0x20, 0xD1,
+0x22, 0xD2, 0x22, 0xD0, 0x20, 0x40, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x24, 0xD1, 0x20, 0xB0, 0x21, 0xD1, 0x22, 0xD1, 0xE0, 0x90, 0x30, 0xE0, 0x30, 0x90,
+0x01, 0xE0, 0x40, 0xD0, 0x24, 0xD3, 0xB1, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xC0, 0x05, 0x92, 0x30,
+0x80, 0x70, 0xA0, 0x06, 0x90, 0xF0, 0x0B, 0x70, 0x50, 0x60, 0xC0, 0x03, 0x90, 0xA0, 0xF0, 0x06,
+0xF0, 0x90, 0xE0, 0x04, 0xC1, 0xA0, 0x05, 0xF0, 0x30, 0x00, 0x90, 0xE0, 0xB1, 0x40, 0xB0, 0xD1,
+0x21, 0xD4, 0x2D, 0xD1, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x22, 0xD3, 0x24, 0xD0, 0x20, 0xD1,
+0x40, 0x80, 0x00, 0x50, 0xA0, 0x30, 0x00, 0xF0, 0x30, 0x00, 0x70, 0x30, 0xC0, 0x90, 0x0C, 0x0F,
+0x00, 0x50, 0x30, 0x00, 0x70, 0x30, 0xC0, 0x50, 0x01, 0x30, 0x02, 0x30, 0xB0, 0xD0, 0x21, 0xD3,
+0x23, 0xD4, 0x20, 0x40, 0xB0, 0xD2, 0x24, 0xD1, 0x21, 0xD1, 0x23, 0xD4, 0x22, 0xD3, 0x41, 0xD2,
+0xB1, 0xD1, 0x20, 0xD2, 0x23, 0xD0, 0x22, 0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD2, 0x21, 0xD1, 0x22,
+0xD1, 0x41, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD3, 0x21, 0xD0, 0x21, 0xD1,
+0x41, 0xB0, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x27, 0xD0, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x24, 0xD1,
+0x21, 0xD0, 0x40, 0xD3, 0x21, 0xD3, 0x21, 0xD0, 0xB1, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0x40, 0xD0, 0x22, 0xD0, 0x22, 0xD1, 0xE0,
+0x60, 0x10, 0xE0, 0xA0, 0x50, 0x00, 0x30, 0xB0, 0xD1, 0x24, 0xD0, 0x21, 0xD0, 0x40, 0xD3, 0x20,
+0xD0, 0x20, 0xD2, 0x60, 0x05, 0x30, 0x52, 0x60, 0xE0, 0x30, 0x06, 0xF0, 0x90, 0x0C, 0xF0, 0x80,
+0x30, 0x03, 0x60, 0x09, 0xF0, 0x30, 0x70, 0x02, 0x70, 0x10, 0x30, 0x80, 0x50, 0x04, 0x70, 0x80,
+0x00, 0xF0, 0x30, 0xB0, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0x2D, 0xD1, 0x21,
+0xD2, 0xB0, 0x40, 0xB0, 0xD6, 0x27, 0xD1, 0xE0, 0xF0, 0x01, 0x90, 0x50, 0x01, 0x70, 0x03, 0xF0,
+0x0C, 0x0F, 0x01, 0x80, 0xC0, 0x60, 0x90, 0x00, 0xF0, 0xA0, 0x91, 0x50, 0x00, 0xF0, 0x60, 0xE0,
+0xD0, 0x22, 0xD3, 0x23, 0xD1, 0xB0, 0x41, 0xD3, 0x24, 0xD0, 0x21, 0xD1, 0x21, 0xD0, 0x24, 0xD1,
+0x21, 0xD3, 0xB0, 0x40, 0x20, 0xD4, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x20, 0xD2, 0xB0, 0x40,
+0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x24, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0xB1, 0xD2, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD1, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0x25,
+0xD1, 0x20, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x22, 0xD3, 0x20, 0xD0, 0xB1, 0xD2, 0x23, 0xD2,
+0x21, 0xD0, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24,
+0xD2, 0x40, 0xD2, 0x26, 0xD0, 0xE0, 0x60, 0x90, 0x30, 0x80, 0x61, 0x10, 0xD2, 0x21, 0xD0, 0x21,
+0xD3, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x70, 0x60, 0x05, 0xA0, 0x60, 0x00, 0x51, 0x90, 0x09,
+0x90, 0x0C, 0xF0, 0x90, 0xF0, 0x02, 0x60, 0x08, 0xF0, 0xA0, 0x90, 0x70, 0x90, 0x02, 0x50, 0x01,
+0xC0, 0x70, 0x03, 0x30, 0xF0, 0x00, 0x51, 0xA0, 0x70, 0xD2, 0x41, 0xD2, 0x22, 0xD0, 0x28, 0xD4,
+0x21, 0xD0, 0x21, 0xD2, 0x20, 0xB0, 0x40, 0xB0, 0xD9, 0x21, 0xD2, 0xC0, 0x90, 0x01, 0xA0, 0x0F,
+0x06, 0x0F, 0x06, 0x80, 0xF0, 0x30, 0xF0, 0xA0, 0x31, 0x00, 0xA0, 0xD0, 0x23, 0xD3, 0x20, 0xD1,
+0xB0, 0x40, 0xB0, 0xD5, 0x28, 0xD4, 0x24, 0xD4, 0xB0, 0x40, 0xB0, 0xD6, 0xB0, 0x40, 0xD1, 0x21,
+0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x21,
+0xD2, 0x40, 0xD4, 0x20, 0xD1, 0x21, 0xD3, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xB0,
+0xD2, 0xB0, 0x40, 0xD7, 0x23, 0xD1, 0x40, 0xD1, 0x22, 0xD1, 0x22, 0xD5, 0x40, 0xD1, 0x20, 0xD0,
+0x24, 0xD1, 0x21, 0xD0, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x23, 0xD3, 0x40, 0xD3, 0x24, 0xD1, 0xB0, 0x60, 0x00, 0x70, 0x02, 0x90, 0xA0, 0xD1, 0x22,
+0xD0, 0x20, 0xD3, 0xB0, 0xD2, 0x20, 0xD3, 0x60, 0x80, 0x03, 0x70, 0x90, 0x00, 0x70, 0x30, 0x00,
+0x90, 0x0B, 0x90, 0x0D, 0x90, 0x70, 0x00, 0xF0, 0x60, 0x08, 0x30, 0x70, 0x02, 0x90, 0x70, 0x04,
+0x60, 0x03, 0xA0, 0x00, 0xF0, 0x50, 0x00, 0xA0, 0x10, 0xE0, 0xD3, 0x41, 0xD1, 0x20, 0xD0, 0x20,
+0xD2, 0x25, 0xD0, 0x21, 0xD0, 0x24, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0x20, 0xD1, 0x20, 0xD3,
+0x21, 0xD1, 0xE0, 0x70, 0x50, 0xA1, 0x50, 0x0F, 0x06, 0x0F, 0x06, 0xF0, 0x30, 0x50, 0x00, 0x80,
+0x50, 0x01, 0x90, 0xE0, 0xD0, 0x22, 0xD4, 0xB0, 0x40, 0xB0, 0xD3, 0x23, 0xD3, 0x23, 0xD7, 0x20,
+0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x22,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40, 0x20, 0xD0, 0x21, 0xD1, 0x25, 0xD0, 0x20, 0xD2, 0xB0,
+0x40, 0xD2, 0x21, 0xD2, 0x23, 0xD1, 0xB1, 0xD2, 0x21, 0xD0, 0x22, 0xD1, 0xB1, 0xD4, 0xB0, 0x40,
+0xD6, 0x23, 0xD0, 0xB1, 0xD0, 0x22, 0xD3, 0x21, 0xD5, 0x40, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0x20,
+0xD0, 0x21, 0xD1, 0x40, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x24, 0xD2, 0xB1, 0xD1, 0x23, 0xD3, 0x40, 0x80, 0x50, 0xA0, 0x70, 0x02, 0x80, 0xE0, 0xD7, 0x40,
+0xA1, 0xE0, 0xA0, 0xE0, 0xB0, 0xD2, 0xE0, 0x90, 0x03, 0x51, 0x02, 0x90, 0x80, 0x00, 0x90, 0x0B,
+0x90, 0x0D, 0x51, 0x00, 0x70, 0xA0, 0x90, 0xA0, 0x30, 0x04, 0x80, 0x70, 0x03, 0x51, 0x03, 0xA0,
+0x02, 0xF0, 0x30, 0x00, 0x90, 0x01, 0x70, 0x30, 0xA1, 0xD3, 0xB0, 0x40, 0xB0, 0xD3, 0x20, 0xD0,
+0x20, 0xD3, 0x23, 0xD0, 0x24, 0xD1, 0xB0, 0x40, 0xB1, 0xD3, 0x40, 0xB1, 0xD8, 0xA0, 0x02, 0x60,
+0xF0, 0x0F, 0x06, 0x0F, 0x0A, 0xF0, 0x30, 0x01, 0x70, 0x60, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0,
+0x40, 0xB0, 0xD4, 0x24, 0xD4, 0x22, 0xD4, 0x20, 0xD6, 0x41, 0xD2, 0x20, 0xD1, 0x24, 0xD1, 0x40,
+0xD1, 0x20, 0xD0, 0x20, 0xD3, 0x41, 0xD3, 0x28, 0xD3, 0xB0, 0x40, 0xD1, 0x25, 0xD1, 0x20, 0xD2,
+0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD2, 0xB1, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xB0, 0xD3,
+0x20, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x20, 0xD0,
+0xB1, 0xD1, 0x20, 0xD1, 0x26, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD3, 0xB0, 0xD1, 0x23, 0xD2, 0x20, 0xD0, 0xA1, 0x10, 0x30,
+0x03, 0x30, 0xC0, 0x40, 0xD4, 0xE0, 0x10, 0x70, 0x30, 0x80, 0x71, 0xA0, 0x40, 0xD0, 0xE1, 0x03,
+0x90, 0x70, 0x03, 0xF0, 0xA0, 0x00, 0xF0, 0x90, 0x0B, 0x90, 0x0D, 0x70, 0x50, 0x01, 0xA0, 0x50,
+0xA0, 0x04, 0x30, 0xF0, 0x04, 0xF0, 0x90, 0xF0, 0x01, 0xA0, 0x02, 0x80, 0x50, 0x71, 0x04, 0xE0,
+0x40, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD9, 0x20, 0xD1, 0x20, 0xD5, 0xA0, 0xE0, 0x40, 0xE1,
+0x60, 0xA0, 0xE0, 0xD2, 0x41, 0xD1, 0x40, 0xA0, 0xB0, 0xD1, 0x40, 0x30, 0x01, 0xF0, 0x30, 0x0F,
+0x07, 0x0F, 0x0B, 0xA0, 0x50, 0xA0, 0x80, 0xA0, 0xB0, 0xD3, 0x41, 0xB0, 0xD1, 0x24, 0xD3, 0x26,
+0xD3, 0x22, 0xD0, 0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0x21, 0xD1, 0x24, 0xD0, 0xB0, 0x40, 0xD1,
+0x20, 0xD2, 0xB0, 0x40, 0x20, 0xD3, 0x23, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x21,
+0xD1, 0x25, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD2, 0x20, 0xD0,
+0x21, 0xD2, 0x41, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x24, 0xD0, 0x23, 0xD1, 0x21, 0xD0,
+0x40, 0xD2, 0x21, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0xB0, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD4, 0x40, 0xD2, 0x21, 0xD0, 0x22, 0xD2, 0xB0,
+0xE0, 0x40, 0x60, 0xA0, 0xF0, 0x00, 0xA0, 0x70, 0x10, 0x60, 0x40, 0xD0, 0x80, 0xA0, 0x80, 0xA0,
+0xC0, 0xE0, 0xA0, 0x80, 0x50, 0x00, 0xC0, 0x61, 0x02, 0x70, 0x80, 0xF0, 0x04, 0xF0, 0x30, 0x01,
+0xF0, 0x50, 0xF1, 0x70, 0x08, 0x90, 0x0D, 0xF0, 0x90, 0xF0, 0x30, 0x00, 0x30, 0x60, 0x03, 0x50,
+0xA0, 0x06, 0x72, 0x80, 0x50, 0x60, 0x10, 0x90, 0x00, 0x90, 0x05, 0xC0, 0x40, 0xD1, 0x20, 0xD3,
+0xB0, 0x40, 0xD4, 0xB0, 0xD2, 0x20, 0xD5, 0x70, 0xE0, 0x60, 0x70, 0x05, 0x50, 0x60, 0xA0, 0xE0,
+0x50, 0xB0, 0xE0, 0xA0, 0xE0, 0x00, 0x60, 0xB0, 0xD0, 0x60, 0x90, 0xA0, 0x80, 0xA0, 0x0F, 0x08,
+0x0F, 0x0B, 0x70, 0x60, 0x02, 0x60, 0xD0, 0xB0, 0x41, 0xD4, 0x23, 0xD4, 0x25, 0xD2, 0x22, 0xD1,
+0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x22, 0xD3, 0x25, 0xD0, 0x40, 0xB0, 0xD3, 0xB0, 0x40, 0xD3,
+0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD3, 0x40, 0xB0, 0xD1, 0x21, 0xD1, 0x25, 0xD1, 0xB1, 0xD1, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0xB1, 0xD0,
+0x40, 0xB0, 0xD2, 0x20, 0xD1, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0xB0,
+0xD0, 0x23, 0xD1, 0x21, 0xD0, 0x22, 0xD0, 0xB1, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0,
+0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD4, 0x40, 0xD1, 0x22, 0xD0, 0x23, 0xD4, 0x40, 0x50, 0x60, 0x00,
+0x80, 0x90, 0xF0, 0x31, 0xA0, 0x80, 0x01, 0xA0, 0xB0, 0xD0, 0x60, 0x80, 0xC0, 0x10, 0x00, 0x60,
+0x10, 0x70, 0x00, 0x90, 0x70, 0x00, 0x90, 0x05, 0x90, 0x60, 0x90, 0x80, 0x32, 0xA0, 0x80, 0x02,
+0xF0, 0x80, 0xA1, 0x01, 0x90, 0x0D, 0x90, 0xA0, 0x70, 0x01, 0x50, 0xA0, 0x03, 0x70, 0xC0, 0xA0,
+0x03, 0xF0, 0xA0, 0x30, 0xA0, 0x30, 0x80, 0x02, 0x90, 0x05, 0x80, 0x10, 0xB0, 0xD6, 0x40, 0xE0,
+0xA0, 0xE1, 0xA0, 0xE0, 0x10, 0x60, 0xD3, 0x40, 0xE0, 0x40, 0xE0, 0xC0, 0xA0, 0x30, 0x09, 0xF0,
+0x90, 0xA0, 0x30, 0x80, 0x00, 0x70, 0x90, 0x50, 0xA0, 0x90, 0x80, 0x01, 0x70, 0x60, 0x0F, 0x08,
+0x0F, 0x0C, 0xA0, 0x02, 0x60, 0x80, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x29, 0xD5, 0x20,
+0xD1, 0x24, 0xD1, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x23, 0xD1, 0x22, 0xD2, 0x20, 0xD0, 0x40, 0xD1,
+0x20, 0x40, 0xB0, 0xD3, 0x23, 0xD3, 0x21, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x21,
+0xD0, 0x22, 0xD1, 0xB1, 0xD3, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xD3, 0x20, 0xD1, 0x20, 0xD1, 0x20,
+0x40, 0xD2, 0xB0, 0x40, 0xD3, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x21,
+0xD1, 0xB0, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x40, 0xD1, 0x27,
+0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x60, 0x10, 0xA0, 0x90, 0x70, 0xF0, 0x02, 0xF0, 0xC0, 0x40, 0xD0,
+0xB0, 0x41, 0xE0, 0x70, 0x50, 0x30, 0x71, 0x90, 0xF0, 0x01, 0x70, 0x50, 0x05, 0x70, 0x50, 0xF0,
+0x00, 0x70, 0xF0, 0x00, 0x90, 0x31, 0xA0, 0x30, 0x50, 0xF0, 0x30, 0x02, 0x90, 0xF0, 0x0A, 0x90,
+0xA0, 0x00, 0x50, 0x70, 0x00, 0x90, 0x80, 0x05, 0x80, 0x90, 0x01, 0xA0, 0x30, 0x70, 0x01, 0x90,
+0x70, 0x01, 0x50, 0x70, 0x05, 0xC0, 0x11, 0xC0, 0xE0, 0xA0, 0x60, 0xE0, 0x90, 0xC0, 0xA1, 0x31,
+0x80, 0x30, 0x10, 0x80, 0xA0, 0x10, 0xD1, 0xC0, 0xE0, 0x50, 0x90, 0x80, 0xF0, 0x0F, 0x04, 0x70,
+0x80, 0xC0, 0xF0, 0x01, 0x90, 0x50, 0x0F, 0x08, 0x0F, 0x0C, 0x90, 0x50, 0x70, 0xA0, 0x80, 0xA0,
+0xD1, 0x21, 0xD3, 0x24, 0xD0, 0x23, 0xD7, 0x22, 0xD0, 0x20, 0xD0, 0x41, 0xD3, 0x20, 0xD0, 0x21,
+0xD1, 0x20, 0xD0, 0x24, 0xD4, 0xB0, 0x40, 0xB0, 0x40, 0xD4, 0x20, 0xD1, 0x22, 0xD6, 0x20, 0x40,
+0xD1, 0x22, 0xD0, 0x20, 0xD3, 0x21, 0xD1, 0x40, 0xB0, 0xD2, 0x25, 0xD2, 0x40, 0xB0, 0xD1, 0x21,
+0xD1, 0x20, 0xD2, 0x40, 0xD4, 0x20, 0x40, 0xB0, 0xD0, 0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD1,
+0x23, 0xD1, 0x21, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x23, 0xD3, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD1, 0x20, 0xD0, 0x40,
+0xD1, 0x22, 0xD0, 0x23, 0xD0, 0x21, 0xD1, 0xB2, 0xE0, 0x10, 0x60, 0xC0, 0xA1, 0x00, 0x70, 0x00,
+0x60, 0xB0, 0xD3, 0xA0, 0x80, 0x10, 0x70, 0x50, 0x70, 0x04, 0x50, 0xF0, 0x09, 0x90, 0xF0, 0x00,
+0x51, 0x02, 0x50, 0x90, 0x03, 0x90, 0x08, 0x31, 0x90, 0x02, 0x50, 0x70, 0x30, 0xF0, 0x06, 0x30,
+0x50, 0x00, 0x60, 0xF0, 0x03, 0x70, 0x50, 0xF0, 0x50, 0x05, 0x90, 0x11, 0xC0, 0x10, 0x80, 0xF0,
+0x00, 0xA1, 0xF0, 0x04, 0x70, 0x90, 0xF0, 0x00, 0x10, 0xC1, 0x80, 0x0F, 0x0A, 0x70, 0x60, 0x30,
+0x80, 0xF0, 0xA0, 0x0F, 0x09, 0x0F, 0x0D, 0xC0, 0x80, 0x01, 0x30, 0xB0, 0xD0, 0x22, 0xD2, 0x23,
+0xD0, 0x20, 0xD0, 0x28, 0xD0, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x20,
+0xD1, 0x22, 0xD3, 0x20, 0xD3, 0x41, 0xD2, 0x25, 0xD0, 0x22, 0xD4, 0x20, 0x40, 0xD1, 0x20, 0xD1,
+0x21, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xB0, 0xD1, 0x24,
+0xD2, 0xB1, 0xD0, 0x22, 0xD2, 0xB0, 0x41, 0xD2, 0x21, 0xD2, 0x22, 0xD2, 0x21, 0xD0, 0xB1, 0xD2,
+0x24, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x24, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD1, 0x22, 0xD0, 0x20, 0xD3, 0x40, 0xD1, 0xB1,
+0xD1, 0xA0, 0xC0, 0x10, 0x00, 0x70, 0xC0, 0xD1, 0x20, 0xD1, 0xE0, 0x90, 0x70, 0x07, 0x90, 0x0A,
+0x90, 0x05, 0x30, 0x70, 0x04, 0x90, 0x01, 0x51, 0x00, 0x70, 0x80, 0xF0, 0xA0, 0x05, 0x70, 0xA0,
+0x07, 0x50, 0x10, 0xC0, 0x30, 0x70, 0x05, 0x30, 0x70, 0x04, 0x70, 0x11, 0x80, 0x70, 0x02, 0x50,
+0x60, 0x80, 0x07, 0x51, 0x11, 0xA0, 0x0F, 0x0B, 0x60, 0x70, 0x00, 0x50, 0xC0, 0x50, 0x0F, 0x09,
+0x0F, 0x0D, 0x90, 0x50, 0x01, 0x70, 0xA0, 0xD1, 0x21, 0xD2, 0x23, 0xD2, 0x29, 0xD2, 0xB0, 0x40,
+0xB0, 0xD2, 0x24, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0x20, 0xD3, 0x20, 0xD1, 0xB0, 0x40, 0xD0, 0x40,
+0xD1, 0x25, 0xD0, 0x20, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xD3, 0x25, 0xD4, 0xB1, 0xD1, 0x22, 0xD0,
+0x23, 0xD1, 0xB1, 0xD1, 0x26, 0xD1, 0x40, 0xD1, 0x21, 0xD4, 0xB0, 0x41, 0x20, 0xD5, 0x22, 0xD2,
+0x21, 0xD0, 0xB0, 0xD2, 0x23, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xB0, 0xD2, 0x20, 0xD0, 0x26,
+0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD3, 0xB0, 0xD0, 0x21, 0xD2, 0x23, 0xD1,
+0x20, 0xD1, 0x40, 0xD0, 0x23, 0xD0, 0xC0, 0xB0, 0xE0, 0x60, 0xA0, 0xD4, 0xB0, 0x40, 0xA0, 0x50,
+0x07, 0xF0, 0x50, 0x0A, 0x90, 0x04, 0x80, 0x70, 0x05, 0x90, 0x70, 0x10, 0x30, 0x60, 0x80, 0x90,
+0xA0, 0x90, 0x06, 0x80, 0x90, 0x05, 0x30, 0x80, 0x50, 0x07, 0x50, 0xF0, 0x51, 0x03, 0xA0, 0xC0,
+0x60, 0x04, 0x10, 0xC0, 0x70, 0x09, 0x80, 0x30, 0x0F, 0x0B, 0x50, 0xA0, 0x02, 0xA0, 0x0F, 0x0A,
+0x0F, 0x0E, 0xA0, 0x00, 0x50, 0x30, 0x60, 0xB0, 0xD0, 0x22, 0xD2, 0x22, 0xD1, 0x23, 0xD1, 0x20,
+0xD1, 0x20, 0xD1, 0x20, 0x40, 0xB0, 0xD3, 0x25, 0xD2, 0x21, 0xD3, 0x21, 0xD3, 0x40, 0xB0, 0xD2,
+0x40, 0xD1, 0x21, 0xD1, 0x21, 0xD0, 0x20, 0xD4, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0,
+0x23, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD5, 0x20, 0xD1, 0xB0, 0x40, 0xD3, 0x20, 0xD1, 0x21, 0xD1,
+0x40, 0xD2, 0x24, 0xD1, 0x40, 0xD1, 0xB0, 0x40, 0xD5, 0x22, 0xD1, 0x20, 0xD1, 0x40, 0xD1, 0x27,
+0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x23, 0xD0, 0x24, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0,
+0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x21, 0xD0, 0x27, 0xD1, 0x20, 0xB1, 0xD0, 0x21, 0xD4, 0xB0,
+0xD3, 0xB0, 0x40, 0xB0, 0xD0, 0xB0, 0x30, 0x08, 0x50, 0x70, 0x09, 0xF0, 0x90, 0x03, 0x91, 0x06,
+0x50, 0xF0, 0x30, 0x50, 0x0A, 0xF0, 0xA0, 0x50, 0xF0, 0x01, 0xF0, 0xA0, 0x80, 0x08, 0x70, 0x50,
+0x01, 0xF0, 0x90, 0xF0, 0x01, 0x10, 0xC0, 0x10, 0x50, 0x02, 0x80, 0x10, 0x60, 0x0A, 0xA0, 0x51,
+0x70, 0x0F, 0x09, 0x61, 0x80, 0x00, 0x91, 0x0F, 0x0A, 0x0F, 0x0E, 0x90, 0x60, 0x90, 0x00, 0x70,
+0xE0, 0xD1, 0x21, 0xD3, 0x26, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xB0, 0xD3, 0x26, 0xD0,
+0x21, 0xD1, 0x20, 0xD1, 0x20, 0xD3, 0xB0, 0x40, 0xB0, 0xD3, 0xB1, 0xD0, 0x23, 0xD0, 0x21, 0xD0,
+0x20, 0xD2, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD3,
+0x23, 0xD3, 0x20, 0x40, 0xD5, 0x20, 0xD3, 0x40, 0xB0, 0xD1, 0x25, 0xD0, 0xB1, 0xD2, 0xB0, 0x40,
+0xB0, 0xD4, 0x21, 0xD3, 0xB1, 0xD1, 0x27, 0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD2,
+0x23, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x20,
+0xD1, 0x27, 0xD1, 0x21, 0x40, 0xD1, 0x21, 0xD1, 0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD3, 0xE0, 0xF0,
+0x08, 0x90, 0x0A, 0x70, 0x50, 0x03, 0xA0, 0x07, 0x50, 0xF0, 0x30, 0x0B, 0x90, 0xA0, 0x50, 0x00,
+0x50, 0xA0, 0x50, 0x09, 0x90, 0x04, 0x50, 0x70, 0x90, 0x80, 0x11, 0xA0, 0x01, 0xA0, 0x10, 0x60,
+0x0B, 0x70, 0x01, 0x70, 0x90, 0x0F, 0x07, 0xF0, 0x60, 0x00, 0x50, 0x30, 0xA0, 0x0F, 0x0B, 0x0F,
+0x0F, 0xA0, 0x02, 0xA0, 0xD1, 0x20, 0xD3, 0x22, 0xD2, 0x20, 0xD1, 0x22, 0xD1, 0xB0, 0x40, 0xB0,
+0xD3, 0x23, 0xD1, 0x23, 0xD2, 0x23, 0xD3, 0xB1, 0xD3, 0x20, 0xD1, 0x40, 0xB0, 0xD3, 0x23, 0xD2,
+0x40, 0x20, 0xD2, 0x21, 0xD0, 0x23, 0xD1, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD1, 0x24, 0xD2, 0x40,
+0x20, 0xD3, 0x20, 0xD1, 0x20, 0xD1, 0xB1, 0xD2, 0x24, 0xD1, 0x40, 0xD5, 0xB0, 0x41, 0xD1, 0x22,
+0xD3, 0x40, 0xD6, 0x21, 0xD2, 0x21, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD4, 0x23, 0xD1, 0xB0, 0x20,
+0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD1, 0x22, 0xD0, 0x22, 0xD5,
+0x40, 0xB0, 0xD2, 0x21, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x20, 0xD1, 0xA0, 0x50, 0x08, 0xF0, 0x90,
+0x0A, 0x50, 0x70, 0x02, 0x90, 0xA0, 0x07, 0x50, 0xA0, 0x70, 0x0B, 0x80, 0xA0, 0x60, 0xA0, 0x0A,
+0x90, 0x06, 0xF0, 0x80, 0xC0, 0x30, 0x80, 0x90, 0xA0, 0x12, 0xF0, 0x0F, 0x01, 0x90, 0x50, 0x0F,
+0x05, 0x60, 0xF0, 0x01, 0x50, 0x90, 0x0F, 0x0B, 0x0F, 0x0F, 0x80, 0x50, 0x00, 0x90, 0xA1, 0xD1,
+0x26, 0xD3, 0x20, 0xD3, 0x20, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x22, 0xD5, 0x20, 0xD1, 0x21, 0xD0,
+0x22, 0xD0, 0x20, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD3, 0x22, 0xD1, 0xB0, 0x40,
+0xD2, 0x23, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x24, 0xD0, 0x22, 0xD1, 0x40, 0xB0, 0xD1,
+0x20, 0xD0, 0x23, 0xD2, 0x40, 0xD4, 0x22, 0xD1, 0x40, 0x20, 0xD1, 0x23, 0xD1, 0xB0, 0x41, 0x20,
+0xD0, 0x20, 0xD3, 0x40, 0xD3, 0x20, 0xD6, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x22, 0xD2, 0xB1, 0xD1, 0x22, 0xD2,
+0x20, 0xD5, 0xB1, 0xD4, 0x20, 0xB0, 0x41, 0xD4, 0x21, 0xD0, 0x60, 0x90, 0x09, 0x71, 0x0A, 0x90,
+0xF0, 0x02, 0x30, 0x90, 0x07, 0x80, 0xA0, 0xC0, 0x80, 0x0C, 0x70, 0x50, 0x08, 0x50, 0xF0, 0x06,
+0x50, 0x10, 0x30, 0x70, 0x90, 0x60, 0x10, 0x90, 0x50, 0xC0, 0x0F, 0x03, 0xF0, 0x90, 0x50, 0x0F,
+0x02, 0x70, 0x10, 0x80, 0xF0, 0x00, 0xA0, 0x0F, 0x0C, 0x0F, 0x10, 0x60, 0x30, 0x90, 0x00, 0xA0,
+0xB0, 0xD0, 0x23, 0xD0, 0x22, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xD1, 0x21, 0xD2, 0x23, 0xD6, 0x24,
+0xD2, 0xB0, 0x40, 0xD4, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0x40, 0xD0, 0x24, 0xD0, 0xB0, 0x40, 0xD2,
+0x21, 0xD0, 0x23, 0xD1, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x25, 0xD1, 0x40, 0xB0, 0xD2, 0x21,
+0xD0, 0x22, 0xD1, 0x40, 0xB0, 0xD0, 0x20, 0xD3, 0x21, 0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x21, 0xD1,
+0x40, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0xB0, 0x20, 0xD0, 0x24, 0xD2, 0x24, 0xD1, 0x40, 0xD3, 0x23,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD3, 0x20, 0xD1, 0x23, 0xD2, 0xB1, 0xD1, 0x22, 0xD0,
+0x23, 0xD0, 0x22, 0xD1, 0x40, 0xD2, 0xB1, 0x40, 0xB0, 0xD0, 0xB1, 0xD2, 0x22, 0xD0, 0xE0, 0x51,
+0x09, 0x50, 0xF0, 0x0A, 0x90, 0x01, 0x70, 0x30, 0x09, 0x80, 0x30, 0xF0, 0x0D, 0x70, 0x90, 0x06,
+0x70, 0x50, 0x06, 0x30, 0x10, 0xA0, 0x00, 0x70, 0xA0, 0x70, 0x01, 0x50, 0xC0, 0x0F, 0x05, 0x70,
+0x90, 0x70, 0x0F, 0x00, 0x60, 0x71, 0x31, 0x90, 0x0F, 0x0C, 0x0F, 0x10, 0x30, 0x50, 0x01, 0x70,
+0xA0, 0xD0, 0x23, 0xD8, 0xB0, 0x40, 0x20, 0xD1, 0x23, 0xD0, 0x23, 0xD6, 0x23, 0xD3, 0x40, 0xB0,
+0xD7, 0x23, 0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x40, 0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD1,
+0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD0, 0x24, 0xD1, 0xB1, 0xD3, 0x21, 0xD0, 0x21, 0xD1, 0xB1,
+0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD2, 0x20, 0xD0, 0xB1, 0xD3, 0xB0,
+0x41, 0xD0, 0x40, 0xD3, 0x2A, 0xD0, 0xB1, 0xD3, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20,
+0xD3, 0x20, 0xD0, 0x24, 0xD2, 0x20, 0xB0, 0xD1, 0x26, 0xD6, 0xB0, 0xD0, 0xB0, 0x40, 0xB1, 0xD3,
+0x40, 0xD4, 0x20, 0xD0, 0x40, 0x90, 0x50, 0xF0, 0x09, 0x90, 0x0A, 0xF0, 0x90, 0x00, 0x30, 0x60,
+0x50, 0x08, 0x30, 0x50, 0x0F, 0x00, 0xF0, 0x90, 0x05, 0x90, 0x07, 0x50, 0xF0, 0x03, 0x50, 0x70,
+0x0F, 0x0A, 0x51, 0x0D, 0x50, 0xA0, 0x02, 0x60, 0x0F, 0x0D, 0x0F, 0x11, 0xA0, 0x01, 0x90, 0x10,
+0xB0, 0xD1, 0x22, 0xD5, 0xB0, 0x40, 0xB0, 0xD1, 0x21, 0xD2, 0x21, 0xD0, 0x20, 0xD4, 0x22, 0xD0,
+0x21, 0xD3, 0xB0, 0x40, 0xD5, 0x28, 0xD0, 0x40, 0xB0, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x21,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0xB0,
+0x40, 0xD0, 0x20, 0xD1, 0x25, 0xD1, 0x40, 0xD3, 0x21, 0xD3, 0xB1, 0xD0, 0x21, 0xD1, 0x21, 0xD1,
+0x40, 0xD6, 0xB0, 0x41, 0xB0, 0xD4, 0x22, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD1,
+0x26, 0xD1, 0xB0, 0x20, 0xD1, 0x28, 0xD3, 0x40, 0xD1, 0x25, 0xD6, 0xB0, 0x41, 0xB0, 0xD3, 0x21,
+0xD0, 0xB1, 0xD1, 0x22, 0xD0, 0xE0, 0xA0, 0x00, 0x90, 0x09, 0x70, 0x50, 0x0A, 0xF0, 0x90, 0x01,
+0xC0, 0xF0, 0x06, 0xC0, 0x90, 0x00, 0x90, 0x0F, 0x01, 0x90, 0xF0, 0x02, 0x90, 0x0F, 0x00, 0x50,
+0x90, 0x0F, 0x0A, 0xF0, 0x90, 0x50, 0x0B, 0xC0, 0xA0, 0x01, 0x92, 0x30, 0x90, 0x0F, 0x0A, 0x0F,
+0x11, 0x90, 0x30, 0xA0, 0x90, 0xF0, 0xA0, 0xD1, 0x22, 0xD3, 0x20, 0x40, 0xB0, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0x25, 0xD4, 0x24, 0xD0, 0x21, 0xD0, 0x20, 0xB0, 0x40, 0xD7, 0x22, 0xD0, 0x22, 0xD2,
+0x40, 0xD1, 0x40, 0xD2, 0x22, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x21, 0xD0,
+0x21, 0xD0, 0x23, 0xD0, 0xB0, 0x40, 0xD2, 0x24, 0xD3, 0x40, 0xD0, 0x20, 0xD1, 0x22, 0xD3, 0x40,
+0xD0, 0x22, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x24, 0xD0, 0x40, 0xD0, 0xB0, 0x41, 0xB0, 0xD8, 0x21,
+0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x26, 0xD1, 0xB0, 0x20, 0xD0, 0x29, 0xD3, 0x40, 0xD1, 0x21, 0xD7,
+0xB0, 0x41, 0xB0, 0xD0, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0x40, 0xD2, 0x20, 0xD1, 0x40,
+0x10, 0x72, 0x09, 0x50, 0xF0, 0x0A, 0x70, 0x50, 0x30, 0xA0, 0x60, 0x04, 0x70, 0xC0, 0xF0, 0x02,
+0x90, 0x0F, 0x01, 0x51, 0x00, 0x90, 0xF0, 0x0F, 0x01, 0xF0, 0x90, 0xF0, 0x0F, 0x0A, 0xF0, 0x90,
+0x70, 0x08, 0x90, 0x30, 0x00, 0xA0, 0x80, 0xA0, 0x00, 0x30, 0x70, 0x80, 0x0F, 0x0A, 0x0F, 0x12,
+0x60, 0x02, 0x80, 0x40, 0xD0, 0x22, 0xD2, 0xB0, 0x40, 0xD4, 0x25, 0xD1, 0x21, 0xD1, 0x22, 0xD0,
+0x23, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x41, 0xD2,
+0x23, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x24, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x20, 0xD0,
+0x21, 0xD0, 0x21, 0xD2, 0xB1, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x40, 0xB0, 0xD0, 0x21, 0xD1, 0x21,
+0xD1, 0x40, 0xD1, 0x25, 0xD0, 0x40, 0xD3, 0xB1, 0x40, 0xB0, 0xD5, 0x21, 0xD0, 0x40, 0xD1, 0x22,
+0xD0, 0x27, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x21, 0xD1, 0x20, 0xD0, 0xB1, 0xD0,
+0x21, 0xD3, 0xB1, 0x41, 0xB0, 0xD3, 0xB1, 0xD0, 0x21, 0xD4, 0xB1, 0xD0, 0x22, 0xD1, 0xC0, 0xF0,
+0x00, 0x90, 0x0A, 0x90, 0x08, 0xF0, 0x70, 0x30, 0xA0, 0x90, 0x00, 0x10, 0x70, 0x01, 0xF0, 0x70,
+0xA0, 0xF0, 0x04, 0x90, 0x0F, 0x01, 0x70, 0x80, 0x70, 0x03, 0x30, 0x50, 0x0D, 0x51, 0x0F, 0x0B,
+0x70, 0x90, 0xF0, 0x06, 0xC0, 0x02, 0x30, 0x50, 0x00, 0x70, 0x80, 0xF0, 0x0F, 0x0A, 0x0F, 0x0F,
+0x90, 0xA0, 0xF0, 0x50, 0x90, 0x01, 0x80, 0xC0, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xB0, 0xD2, 0x20,
+0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x22, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0xB0, 0x40, 0xD4, 0x28, 0xD0,
+0x20, 0xD1, 0x21, 0xD0, 0xB0, 0x41, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x40,
+0xB0, 0xD2, 0x27, 0xD2, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD3, 0xB0, 0x40, 0xD0, 0x21, 0xD1, 0x20,
+0xD1, 0x20, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x23, 0xD1, 0xB1, 0xD6, 0xB0,
+0x42, 0xB1, 0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD4, 0x24, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x20,
+0xD7, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xB0, 0x43, 0xD5, 0x20, 0xD0, 0x40, 0xD0, 0x21,
+0xD2, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD2, 0xE0, 0xA0, 0x01, 0x70, 0x50, 0x09, 0x70, 0x50, 0x05,
+0x30, 0xA0, 0x30, 0x90, 0x50, 0xF0, 0x50, 0x00, 0x30, 0xC0, 0x90, 0x70, 0xA0, 0x10, 0x50, 0x05,
+0xF0, 0x90, 0x0F, 0x00, 0x70, 0x90, 0x50, 0x03, 0x90, 0x50, 0x0E, 0x70, 0x90, 0x0F, 0x0C, 0x51,
+0x04, 0x90, 0xC0, 0xF0, 0x01, 0xA0, 0x00, 0x71, 0x0F, 0x0C, 0x0F, 0x0F, 0x70, 0x50, 0x60, 0xF0,
+0xA0, 0x50, 0x60, 0x50, 0x80, 0x40, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD4, 0x24, 0xD1, 0x22,
+0xD2, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x22, 0xD1, 0x26, 0xD0, 0x20, 0xD3, 0x40, 0xB0, 0xD0, 0xB0,
+0x40, 0xD2, 0x23, 0xD0, 0x20, 0xD4, 0xB1, 0xD0, 0x20, 0xD0, 0x27, 0xD2, 0x40, 0xB0, 0xD0, 0x23,
+0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x24, 0xD2, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x40,
+0xD1, 0x22, 0xD3, 0xB0, 0x20, 0xD4, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xB0, 0x42, 0xB0, 0x40, 0xD9,
+0x23, 0xD1, 0xB0, 0x20, 0xD1, 0x22, 0xD9, 0xB0, 0x43, 0xB1, 0xD1, 0x20, 0x40, 0xD1, 0x20, 0xD2,
+0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD0, 0x40, 0xD3, 0x70, 0xC0, 0xF0, 0x02, 0x50, 0x0A,
+0x50, 0x70, 0x04, 0xA0, 0x05, 0x90, 0x01, 0x90, 0x30, 0x00, 0xF0, 0x08, 0x90, 0x0D, 0xF0, 0x90,
+0x00, 0xF0, 0x90, 0x0F, 0x06, 0x90, 0x70, 0x0F, 0x0B, 0xF0, 0x90, 0x50, 0x02, 0x10, 0xF0, 0x32,
+0xF0, 0x30, 0xA0, 0x60, 0x10, 0x50, 0x0F, 0x0A, 0x0F, 0x0B, 0x50, 0x90, 0x70, 0x02, 0x80, 0x90,
+0xF0, 0x60, 0x02, 0x60, 0xD0, 0x41, 0xD2, 0x24, 0xD5, 0x25, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20,
+0xD0, 0xB0, 0x40, 0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x24, 0xD0, 0x20, 0xD4, 0x40, 0xB0, 0xD2, 0xB0,
+0x40, 0xD3, 0x22, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x2A, 0xD0, 0xB1, 0xD0, 0x25, 0xD4, 0x40, 0xB0,
+0xD1, 0x25, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0xB0, 0x40, 0xD0, 0x22, 0xD4, 0x40, 0xD0,
+0x21, 0xD1, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD4, 0xB0, 0x40, 0xB0, 0x42, 0xB4, 0xD0, 0x20, 0xD4,
+0xB0, 0xD4, 0x22, 0xB3, 0x43, 0xB0, 0x40, 0xD5, 0x21, 0x40, 0xD1, 0x21, 0xD3, 0xB1, 0xD3, 0x22,
+0xD0, 0x20, 0x40, 0xD1, 0x40, 0x10, 0xE0, 0x04, 0x90, 0x0A, 0x90, 0x04, 0xC0, 0x31, 0x04, 0x90,
+0x0E, 0x90, 0x0B, 0xF0, 0x90, 0x03, 0x90, 0xF0, 0x0F, 0x05, 0x70, 0x90, 0x0F, 0x0C, 0xF0, 0x90,
+0xF0, 0x30, 0x90, 0x01, 0x70, 0xA0, 0x70, 0x30, 0x01, 0xF0, 0xC0, 0x30, 0x0F, 0x09, 0x0F, 0x0B,
+0x80, 0x10, 0xA0, 0x60, 0x30, 0x80, 0xC0, 0x70, 0x00, 0x30, 0x01, 0x80, 0x10, 0xA0, 0xD6, 0x24,
+0xD0, 0x20, 0xD4, 0x22, 0xD0, 0x22, 0xD2, 0x40, 0xB0, 0xD4, 0x24, 0xD3, 0x25, 0xD1, 0x40, 0x20,
+0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x23,
+0xD2, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x25, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD2,
+0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xD0, 0xB1, 0xD0,
+0x21, 0xD1, 0x21, 0xD0, 0x40, 0xD0, 0x21, 0xD4, 0xB1, 0xD4, 0x20, 0xB0, 0x4F, 0x00, 0xB1, 0x40,
+0xB0, 0x21, 0xD4, 0x40, 0xD5, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0xD2, 0x23,
+0xD1, 0x40, 0xD0, 0xE1, 0xF0, 0x05, 0x50, 0x70, 0x0A, 0x90, 0x03, 0x90, 0xA0, 0x60, 0x04, 0xF0,
+0x50, 0x0E, 0x90, 0x0A, 0x90, 0x05, 0x90, 0x70, 0x0F, 0x06, 0x90, 0x70, 0x0F, 0x0C, 0x50, 0x10,
+0x60, 0xF0, 0x00, 0x30, 0xF0, 0x00, 0x60, 0x50, 0x02, 0x60, 0x70, 0x0F, 0x08, 0x0F, 0x0C, 0xC0,
+0x00, 0xF0, 0x90, 0x80, 0x70, 0x01, 0x70, 0xA0, 0xC0, 0x10, 0x60, 0xA0, 0xB0, 0xD4, 0x27, 0xD4,
+0x23, 0xD0, 0x21, 0xD0, 0x20, 0x40, 0xD4, 0x20, 0xD0, 0x24, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0xB0, 0x40, 0xD7, 0x40, 0xB0, 0xD4, 0x20, 0xD1, 0x40, 0xB0, 0xD2, 0x25, 0xD4, 0x20, 0x40,
+0xD0, 0x21, 0xD0, 0x23, 0xD3, 0x20, 0x40, 0xD0, 0x23, 0xD0, 0x21, 0xD2, 0xB1, 0xD2, 0x24, 0xD0,
+0x20, 0x40, 0xD0, 0x21, 0xD3, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x40, 0xD0, 0x20,
+0xD0, 0x20, 0xD3, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0xB0, 0xD7, 0x40, 0xD7, 0x40, 0xD1, 0x20,
+0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0xB1, 0xD0, 0x23, 0xD2, 0x40, 0xD1, 0x26,
+0xB1, 0xA0, 0x50, 0x07, 0x90, 0x0A, 0x50, 0x70, 0x01, 0x50, 0x30, 0x07, 0x70, 0x50, 0x0E, 0x90,
+0x08, 0x90, 0x07, 0x51, 0x0F, 0x06, 0x51, 0x0F, 0x0B, 0xA1, 0x11, 0x31, 0x01, 0x70, 0xC0, 0x80,
+0x01, 0x30, 0x50, 0x0F, 0x08, 0x0F, 0x0C, 0x90, 0xA0, 0x06, 0x30, 0x10, 0x90, 0x00, 0x70, 0xA0,
+0xD2, 0x21, 0xD0, 0x2A, 0xD7, 0x41, 0xD3, 0x23, 0xD0, 0x27, 0xD0, 0x20, 0xD2, 0xB0, 0x40, 0xD2,
+0x20, 0xD1, 0x21, 0xD1, 0x40, 0xB0, 0xD5, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD4, 0x40, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xB0, 0xD1, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x23, 0xD2,
+0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0xB1, 0xD0, 0x21,
+0xD1, 0x21, 0xD0, 0x40, 0xD5, 0x20, 0xD0, 0x40, 0xD7, 0x40, 0x20, 0xD6, 0x40, 0xD1, 0x20, 0xD4,
+0x40, 0x20, 0xD1, 0x23, 0xD1, 0xB0, 0xD0, 0x22, 0xD3, 0xB1, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0xE0,
+0xA0, 0x08, 0x71, 0x0A, 0x90, 0x01, 0x50, 0x90, 0x08, 0x50, 0x70, 0x0E, 0x90, 0x06, 0x90, 0x09,
+0x70, 0x90, 0x0F, 0x06, 0xF0, 0x90, 0xF0, 0x0F, 0x08, 0x50, 0xA0, 0x00, 0xF0, 0x60, 0x10, 0x00,
+0x30, 0x10, 0x80, 0x00, 0x30, 0x10, 0xC0, 0x30, 0x0F, 0x09, 0x0F, 0x0D, 0x90, 0x00, 0xA0, 0x60,
+0xA1, 0x30, 0xE0, 0xF0, 0x30, 0x02, 0xC0, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD0, 0x26, 0xD5, 0xB0,
+0x40, 0x20, 0xD6, 0x23, 0xD1, 0x23, 0xD4, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD1,
+0x40, 0x20, 0xD3, 0x40, 0xB0, 0xD1, 0x26, 0xD5, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1,
+0xB1, 0xD0, 0x20, 0xD2, 0x21, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x22, 0xD3, 0x40, 0xD0, 0x21,
+0xD0, 0x21, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x22,
+0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x23, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x21, 0xD0, 0x40, 0xD7, 0xB1, 0xD2, 0x22, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD1,
+0x20, 0xD5, 0x40, 0xC0, 0xA0, 0xF0, 0x07, 0x90, 0x0B, 0x90, 0x01, 0x60, 0x50, 0x08, 0x90, 0xF0,
+0x0E, 0x90, 0x04, 0x90, 0xF0, 0x0A, 0xF0, 0x90, 0x0F, 0x07, 0x90, 0x50, 0x0F, 0x07, 0x10, 0x50,
+0x01, 0x90, 0x50, 0x90, 0x80, 0x00, 0x60, 0x50, 0x0F, 0x0D, 0x0F, 0x0F, 0x90, 0xA0, 0x00, 0x90,
+0x10, 0xA0, 0x00, 0x92, 0xA0, 0x70, 0x60, 0xD2, 0x22, 0xD1, 0x24, 0xD1, 0x20, 0xD4, 0x40, 0xB0,
+0xD1, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD5, 0x40, 0xB0, 0xD2, 0x20, 0xD3,
+0x23, 0xD1, 0x40, 0x20, 0xD1, 0x40, 0xB0, 0xD2, 0x24, 0xD3, 0x20, 0xD1, 0x40, 0x21, 0xD1, 0x23,
+0xD0, 0x21, 0xD1, 0x20, 0x40, 0xD0, 0x21, 0xD3, 0x21, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD3,
+0x40, 0xB0, 0xD3, 0x22, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21,
+0xD1, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x20, 0xD3, 0x40, 0xD2, 0x23, 0xD0, 0xB0, 0xD1, 0x24, 0xD1,
+0xB1, 0xD5, 0x40, 0x60, 0xE0, 0x90, 0x70, 0x30, 0x60, 0x30, 0x02, 0x90, 0x02, 0x50, 0x0A, 0x70,
+0x50, 0x01, 0x30, 0x70, 0x08, 0x90, 0xF0, 0x0E, 0x90, 0xF0, 0x01, 0x90, 0x70, 0x0D, 0x90, 0xF0,
+0x0F, 0x06, 0x70, 0x90, 0xF0, 0x0F, 0x04, 0x30, 0x81, 0x30, 0xF0, 0xA0, 0x00, 0xA0, 0x50, 0x00,
+0x50, 0x30, 0x00, 0x50, 0x70, 0x0F, 0x0A, 0x0F, 0x10, 0x60, 0xA0, 0x60, 0x70, 0x02, 0x60, 0x80,
+0x01, 0x50, 0xE0, 0xD0, 0x23, 0xD2, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD1, 0x21,
+0xD0, 0x21, 0xD2, 0x23, 0xD0, 0x20, 0xD1, 0x20, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD1,
+0x21, 0xD1, 0x22, 0xD2, 0x40, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x26, 0xD4, 0xB1, 0xD3, 0x23, 0xD0,
+0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD3, 0x22, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x40, 0xD1,
+0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x40, 0xD2,
+0x23, 0xD0, 0xB1, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20,
+0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD3, 0x22, 0xD0, 0xB1,
+0xD0, 0x24, 0xD1, 0x20, 0x40, 0xD2, 0x20, 0xD0, 0xE1, 0x70, 0x00, 0xF0, 0x70, 0x01, 0x80, 0x60,
+0x30, 0xC0, 0x80, 0xA0, 0x30, 0x90, 0x80, 0xF0, 0x0A, 0x50, 0xF0, 0x00, 0x70, 0x30, 0x09, 0x90,
+0x0E, 0xF0, 0x50, 0x00, 0x90, 0xF0, 0x0F, 0x00, 0x50, 0x70, 0x0F, 0x07, 0x50, 0x70, 0x0F, 0x03,
+0xC0, 0x01, 0x70, 0xC0, 0xF0, 0x00, 0x50, 0x30, 0x00, 0x70, 0xA0, 0x00, 0xC0, 0xF0, 0x0F, 0x0A,
+0x0F, 0x0F, 0x80, 0x10, 0xC0, 0x01, 0x70, 0x90, 0x00, 0xF0, 0x30, 0x02, 0x10, 0xD4, 0x22, 0xD0,
+0x22, 0xD4, 0xB0, 0x40, 0xD3, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x24, 0xD0, 0x21, 0xD1, 0x40,
+0x20, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x24, 0xD1, 0x20, 0xD1, 0x41, 0xD3, 0x21, 0xD1, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD2, 0x21, 0xD1, 0x22, 0xD2, 0xB1, 0xD1, 0x21, 0xD3, 0x21, 0xD0,
+0xB1, 0xD2, 0x20, 0xD1, 0x22, 0xD0, 0xB1, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0xB0, 0xD1,
+0x22, 0xD1, 0x21, 0xB1, 0xD2, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD1, 0x24, 0xD0, 0x40, 0xD1, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0x21, 0xD0, 0x21, 0xD0, 0x20,
+0xD0, 0x40, 0xD3, 0x22, 0xD1, 0x40, 0xD0, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x22, 0xD0, 0x40,
+0x90, 0x02, 0x90, 0x03, 0xF0, 0x02, 0xC0, 0xA0, 0x90, 0x30, 0x70, 0x0A, 0x90, 0x01, 0xA0, 0x09,
+0xF0, 0x90, 0x0F, 0x00, 0x30, 0xF0, 0x0F, 0x02, 0x51, 0x0F, 0x07, 0x50, 0x90, 0x0F, 0x01, 0x60,
+0x80, 0x01, 0xF0, 0x30, 0x70, 0xF0, 0x03, 0x60, 0x30, 0x80, 0x0F, 0x0B, 0x0F, 0x0F, 0x70, 0x00,
+0xF0, 0x70, 0xC1, 0x80, 0x60, 0xF0, 0x30, 0x70, 0x80, 0xA0, 0xF0, 0x60, 0xD2, 0x23, 0xD0, 0x22,
+0xD3, 0x40, 0xB0, 0xD6, 0x21, 0xD2, 0x24, 0xD2, 0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x22, 0xD3, 0x23,
+0xD4, 0x40, 0xB0, 0x40, 0xB0, 0xD0, 0x21, 0xD4, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xD2, 0x22, 0xD2,
+0x21, 0xD1, 0x20, 0x40, 0xD1, 0x25, 0xD3, 0x40, 0xD3, 0x21, 0xD0, 0x22, 0xD0, 0x40, 0xD1, 0x20,
+0xD0, 0x21, 0xD3, 0x40, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x40,
+0xD2, 0x23, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1,
+0xB0, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0x40, 0xD4, 0x22, 0xD0, 0x40, 0xD1, 0x21, 0xD1, 0x20, 0xD1,
+0xB1, 0xD0, 0x21, 0xD0, 0xE0, 0x50, 0x02, 0x71, 0x07, 0xA0, 0x00, 0x70, 0x60, 0x70, 0x09, 0xF0,
+0x50, 0x00, 0x30, 0x0A, 0x80, 0x90, 0x0D, 0x90, 0xF0, 0x90, 0x0F, 0x03, 0x70, 0x50, 0x0F, 0x08,
+0x90, 0x70, 0x0D, 0x90, 0xA0, 0x90, 0xA0, 0xF0, 0xA0, 0x00, 0x90, 0x10, 0x30, 0x02, 0x30, 0x10,
+0x0F, 0x0C, 0x0F, 0x11, 0x90, 0xC0, 0x70, 0x01, 0x90, 0x80, 0x00, 0xC0, 0x90, 0x01, 0x80, 0x40,
+0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD0, 0xB0, 0x40, 0xD1, 0x23, 0xD0, 0x21, 0xD1, 0x21, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x22,
+0xD0, 0x22, 0xD0, 0x40, 0xB0, 0xD1, 0x40, 0xB0, 0xD6, 0x22, 0xD1, 0x40, 0xD4, 0x21, 0xD0, 0x20,
+0xD2, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD0, 0x24, 0xD1, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x20,
+0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0xB1, 0xD2, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x21,
+0xD0, 0x20, 0xD2, 0x40, 0xD2, 0x22, 0xD2, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0xE0, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD1, 0x23, 0xD1, 0xB1,
+0xD0, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0x20, 0xD1, 0xE1, 0x04, 0x90, 0x07, 0x10, 0xF0,
+0x00, 0x90, 0x80, 0xA0, 0x70, 0x08, 0x51, 0x30, 0x0B, 0x51, 0x0B, 0x50, 0x70, 0x01, 0x90, 0x0F,
+0x03, 0xF0, 0x90, 0x0F, 0x08, 0x51, 0x0C, 0xC0, 0x01, 0xF0, 0xC0, 0x90, 0x00, 0x70, 0x30, 0x80,
+0x10, 0x90, 0x01, 0x70, 0x0F, 0x0C, 0x0F, 0x11, 0xC0, 0xF0, 0x01, 0xF0, 0x60, 0x70, 0x00, 0x91,
+0x01, 0x70, 0xC0, 0xD1, 0x20, 0xD0, 0x21, 0xD4, 0x40, 0xB0, 0xD1, 0x24, 0xD3, 0x20, 0xD0, 0x21,
+0xD1, 0xE0, 0x21, 0xD3, 0xB1, 0xD2, 0x20, 0xD1, 0x20, 0xD3, 0x21, 0xD0, 0x21, 0xD2, 0xB1, 0xD1,
+0x20, 0xD0, 0x40, 0xB0, 0xD4, 0x20, 0xD3, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x23, 0xD3, 0x40, 0x20,
+0xD1, 0x20, 0xD1, 0x23, 0xD2, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40,
+0xD3, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD2, 0x21, 0xD3, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD2,
+0x40, 0xD2, 0x22, 0xD1, 0x20, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x21, 0xD1, 0xB0, 0x40, 0xD1, 0xE0, 0xD3, 0xB1, 0xD1, 0x22, 0xD2, 0xB1, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x21, 0xD1, 0x40, 0xD2, 0xE0, 0xA0, 0x04, 0x50, 0xF0, 0x05, 0x70, 0x80, 0x01, 0x71, 0xF0,
+0xC0, 0x50, 0x02, 0x70, 0xF0, 0x50, 0x80, 0x70, 0x00, 0x91, 0x0C, 0x50, 0x70, 0x09, 0x90, 0x70,
+0x03, 0x90, 0x0F, 0x03, 0xF0, 0x90, 0x0F, 0x08, 0xF0, 0x90, 0xF0, 0x09, 0xA0, 0x30, 0x02, 0x30,
+0x01, 0xF0, 0x80, 0x00, 0xF0, 0x61, 0xF0, 0x0F, 0x0D, 0x0F, 0x11, 0x60, 0x01, 0x90, 0x10, 0x51,
+0xA0, 0x00, 0xA0, 0x00, 0x80, 0x30, 0x50, 0xA0, 0xD2, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0x40, 0xB0,
+0xD3, 0x25, 0xD1, 0x25, 0xB0, 0x20, 0xD3, 0x40, 0xB0, 0xD2, 0x24, 0xD1, 0x22, 0xD1, 0x20, 0xD2,
+0xB1, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD4, 0x21, 0xD0, 0x40, 0xB0, 0xD0, 0x21, 0xD1, 0x25, 0xD1,
+0xB0, 0x40, 0xD2, 0x20, 0xD2, 0x22, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0xB1,
+0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0xB1,
+0xD0, 0x25, 0xD0, 0xB1, 0xD2, 0x22, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x21, 0xD1, 0x40, 0x10, 0xA0, 0xE0, 0xB0, 0xD4, 0x40, 0xD1, 0x21, 0xD4, 0x40, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB1, 0xD0, 0xE0, 0xA0, 0x06, 0x90, 0x05, 0xA0, 0xF0, 0x02,
+0x90, 0x00, 0xF0, 0xA0, 0x00, 0x70, 0x80, 0xA1, 0x80, 0x50, 0x30, 0xA0, 0x50, 0x80, 0x0D, 0x90,
+0x08, 0x90, 0xF0, 0x05, 0x90, 0x0F, 0x04, 0x90, 0x70, 0x0F, 0x08, 0x51, 0x07, 0x50, 0x60, 0x90,
+0x60, 0x00, 0x30, 0x70, 0x06, 0x50, 0xF0, 0x0F, 0x0D, 0x0F, 0x11, 0x50, 0xC0, 0x10, 0x30, 0x01,
+0x30, 0x00, 0x80, 0x00, 0x10, 0x70, 0x01, 0x90, 0xE0, 0xD1, 0x20, 0xD2, 0xB0, 0x40, 0xD2, 0x20,
+0xD1, 0x23, 0xD1, 0x26, 0xD4, 0x20, 0x40, 0xD3, 0x21, 0xD0, 0x21, 0xD1, 0x23, 0xD0, 0x20, 0xD2,
+0xB1, 0xD1, 0x21, 0xD3, 0x40, 0xB0, 0xD5, 0x40, 0xB0, 0xD1, 0x21, 0xD2, 0x24, 0xD1, 0x40, 0xD1,
+0x22, 0xD2, 0x22, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD2,
+0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0xB1, 0xD3,
+0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x40,
+0xC0, 0x10, 0x60, 0xC0, 0xE0, 0xD0, 0xB1, 0xD0, 0x40, 0xD0, 0x23, 0xD3, 0x40, 0xD3, 0x21, 0xD0,
+0x20, 0xD1, 0x40, 0xD0, 0xA0, 0x70, 0x06, 0x50, 0xF0, 0x03, 0x91, 0x03, 0xF0, 0x50, 0x00, 0x80,
+0xA0, 0x30, 0x50, 0x04, 0xA0, 0x50, 0x30, 0x70, 0x0D, 0x90, 0x06, 0x90, 0x08, 0x90, 0x0F, 0x04,
+0x51, 0x0F, 0x08, 0x70, 0x90, 0x06, 0x10, 0x02, 0xC0, 0x80, 0x0F, 0x17, 0x0F, 0x17, 0x90, 0xA0,
+0xF0, 0x00, 0x91, 0x01, 0x70, 0xC0, 0xD4, 0x40, 0xB0, 0xD1, 0x22, 0xD1, 0x23, 0xD2, 0x24, 0xD2,
+0xE1, 0xD0, 0x40, 0xD4, 0x20, 0xD0, 0x20, 0xD0, 0x23, 0xD0, 0x21, 0xD3, 0x40, 0xB0, 0xD1, 0x21,
+0xD5, 0xB1, 0xD3, 0xB1, 0xD0, 0x20, 0xD5, 0x23, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x21, 0xD0, 0x40, 0xD2, 0x20, 0xD2, 0x20, 0xD1, 0x40, 0xD2, 0x23, 0xD1, 0xB1, 0xD3, 0x21,
+0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x60,
+0xA0, 0xE1, 0x40, 0xD0, 0xC0, 0x40, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0xB1, 0xD1, 0x23, 0xD2, 0xB0,
+0xD0, 0x80, 0x90, 0x07, 0x50, 0x02, 0x90, 0x30, 0x05, 0x50, 0xF0, 0x07, 0x50, 0x90, 0x52, 0x0E,
+0x90, 0x03, 0xF0, 0x90, 0x0A, 0x90, 0x0F, 0x04, 0x70, 0x50, 0x0F, 0x09, 0x90, 0x70, 0x03, 0xA1,
+0x02, 0xA0, 0x0F, 0x18, 0x0F, 0x1C, 0xA0, 0xF0, 0x80, 0xE0, 0x70, 0xA0, 0xD1, 0xB0, 0x40, 0xD2,
+0x23, 0xD7, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xE1, 0xB0, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1,
+0x25, 0xD2, 0x40, 0xB0, 0xD1, 0x22, 0xD3, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0x40, 0xD2, 0x20, 0xD4,
+0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x22, 0xD3, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x23, 0xD1,
+0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0xB0, 0xD0,
+0x20, 0xD0, 0x23, 0xD1, 0x40, 0x20, 0xD3, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xB0,
+0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x41, 0xE0, 0xB0, 0xA0, 0xD0, 0x41, 0xD1, 0x40, 0x20, 0xD0,
+0x23, 0xD2, 0x20, 0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD1, 0xB1, 0x40, 0xE0, 0x00, 0x90, 0x80, 0x04,
+0x50, 0xF1, 0x30, 0x80, 0x07, 0x90, 0x07, 0x60, 0x50, 0x90, 0x50, 0x00, 0x90, 0x0D, 0xF0, 0x50,
+0x01, 0xF0, 0x90, 0x0C, 0x90, 0x0F, 0x04, 0x70, 0x90, 0x0F, 0x09, 0x70, 0x50, 0x01, 0x50, 0xA0,
+0x50, 0xA0, 0xF0, 0x30, 0x70, 0x0F, 0x18, 0x0F, 0x1D, 0x10, 0x50, 0x01, 0x80, 0xE0, 0x40, 0xB0,
+0xD1, 0x27, 0xD5, 0x23, 0xD0, 0x20, 0xD2, 0x41, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x23,
+0xD0, 0x21, 0xD1, 0xB1, 0xD0, 0x27, 0xD4, 0xB0, 0x40, 0xD0, 0x40, 0xD0, 0x20, 0xD0, 0x21, 0xD5,
+0x21, 0xD1, 0x40, 0xD2, 0x22, 0xD2, 0x22, 0xD0, 0x40, 0xD1, 0x20, 0xD4, 0x21, 0xD0, 0x20, 0x40,
+0xD0, 0x21, 0xD1, 0x22, 0xD1, 0xB1, 0xD1, 0x21, 0xD2, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22,
+0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x40, 0xD0, 0x40, 0xB0, 0xD1, 0xB1, 0xD1, 0x22, 0xD1, 0x20,
+0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xA0, 0x60, 0x00, 0x10, 0xA0, 0x04, 0xF0, 0x31,
+0x70, 0x08, 0x50, 0x70, 0x06, 0x30, 0x60, 0xC0, 0x70, 0x00, 0x70, 0x50, 0x0D, 0x50, 0x71, 0x90,
+0x0E, 0x90, 0x0F, 0x05, 0x90, 0x0F, 0x0A, 0x90, 0x70, 0xC0, 0x02, 0x60, 0x80, 0x0F, 0x19, 0x0F,
+0x1D, 0x91, 0x01, 0x50, 0xC0, 0xB0, 0xD0, 0x29, 0xD4, 0x24, 0xD3, 0x40, 0xB0, 0xD4, 0x24, 0xD1,
+0x20, 0xD1, 0x22, 0xD1, 0xB1, 0xD0, 0x23, 0xD1, 0x24, 0xD1, 0x20, 0xD1, 0xE0, 0xB0, 0xD1, 0x20,
+0xD6, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x21, 0xD0, 0xB1, 0xD4, 0x20, 0xD1, 0x21,
+0xD0, 0x40, 0xD1, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD0, 0x40, 0xD1, 0x20,
+0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0x20, 0xD7, 0xB1, 0xD2, 0x21,
+0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD4, 0x40, 0xD0, 0xB0, 0xC0, 0x10, 0x30, 0x03, 0x50, 0xA0,
+0x90, 0x0B, 0x90, 0x05, 0x31, 0x80, 0x30, 0x02, 0x50, 0xF0, 0x0D, 0x80, 0x90, 0x0F, 0x01, 0x90,
+0x0F, 0x05, 0x90, 0x70, 0x0F, 0x09, 0xC0, 0xA0, 0x02, 0xA0, 0x0F, 0x1A, 0x0F, 0x1E, 0x30, 0x70,
+0x30, 0x80, 0xF0, 0x60, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x23, 0xD2, 0x23, 0xD3, 0x20, 0x40, 0x20,
+0xD2, 0xE1, 0xD2, 0x23, 0xD3, 0x21, 0xD1, 0x40, 0xB0, 0xD3, 0x22, 0xD2, 0x23, 0xD2, 0x40, 0xB0,
+0x40, 0xB0, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x20, 0xD2, 0xB1, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x21,
+0xD1, 0x20, 0x40, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0,
+0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD3, 0x40, 0xD4, 0x22, 0xD0, 0xB1, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21,
+0xD1, 0xB1, 0x21, 0xD3, 0x20, 0xD0, 0x20, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xB1, 0xD1,
+0x21, 0xD2, 0x20, 0xD1, 0x40, 0x70, 0x90, 0x10, 0x50, 0x02, 0x70, 0xC0, 0x01, 0x50, 0x0A, 0xF0,
+0x50, 0x01, 0x50, 0x31, 0x50, 0x06, 0x90, 0x0C, 0x90, 0x70, 0x50, 0xF0, 0x0F, 0x01, 0x90, 0x0F,
+0x05, 0x51, 0x0F, 0x07, 0x80, 0x30, 0x70, 0xA0, 0x70, 0xA0, 0xF0, 0x0F, 0x1A, 0x0F, 0x1E, 0xF0,
+0xC0, 0x70, 0x01, 0x50, 0xE0, 0xD1, 0x20, 0xD3, 0x29, 0xD1, 0x20, 0xD0, 0xB0, 0x40, 0xD4, 0xE0,
+0x40, 0xD3, 0x23, 0xD1, 0x20, 0xD2, 0xB1, 0xD2, 0x23, 0xD3, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xB0,
+0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x21, 0xD3, 0x40, 0xD1, 0x24, 0xD1, 0x21, 0xD1, 0x40, 0x20,
+0xD1, 0x20, 0xD0, 0x24, 0xD1, 0xB1, 0xD0, 0x24, 0xD3, 0xB0, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0xB1,
+0xD4, 0x21, 0xD1, 0xB1, 0xD0, 0x22, 0xD4, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x21, 0xD1, 0xB1, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD1,
+0x40, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0x40, 0x50, 0xC0, 0x80, 0x03, 0xA0, 0x70, 0x01, 0x90, 0x0B,
+0x50, 0x00, 0x90, 0x30, 0x09, 0xF0, 0x50, 0x0A, 0x90, 0xF0, 0x01, 0x90, 0x0F, 0x02, 0x90, 0x0F,
+0x05, 0x51, 0x0F, 0x06, 0xC0, 0x02, 0xA0, 0x90, 0x0F, 0x1B, 0x0F, 0x1F, 0x50, 0x80, 0x01, 0x50,
+0x10, 0xB0, 0xD0, 0x21, 0xD3, 0x28, 0xD2, 0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD3, 0x20, 0xD0,
+0x23, 0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x21, 0xD5, 0x25, 0xD0, 0xB1, 0xD3, 0x41, 0xD2, 0x23, 0xD1,
+0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD2, 0x24, 0xD0, 0x20, 0x40,
+0xD2, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD1, 0xB1, 0xD5, 0x21, 0xD0, 0x40,
+0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x21, 0xD1, 0x20, 0xB0, 0xD3, 0x23, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD2, 0x40, 0xD2, 0x21,
+0xD0, 0x22, 0xD0, 0xB0, 0xA0, 0x90, 0x80, 0x03, 0xA0, 0x02, 0x71, 0x0B, 0x30, 0x80, 0x0B, 0x50,
+0xF0, 0x07, 0x70, 0x90, 0x04, 0x90, 0x0F, 0x02, 0x90, 0x0F, 0x05, 0x70, 0x90, 0x0F, 0x04, 0x10,
+0xA0, 0x02, 0xA0, 0x0F, 0x1C, 0x0F, 0x20, 0x30, 0x50, 0x30, 0x80, 0x00, 0x60, 0xB0, 0xD6, 0x26,
+0xD2, 0x40, 0xB0, 0xD4, 0x20, 0xD0, 0x20, 0x41, 0xD4, 0x23, 0xD1, 0xB1, 0xD1, 0x24, 0xD3, 0x22,
+0xD0, 0x20, 0xD0, 0xB0, 0x40, 0xD5, 0xB0, 0x40, 0xD1, 0x23, 0xD0, 0x40, 0xB0, 0xD1, 0x22, 0xD0,
+0x20, 0xD1, 0x20, 0xD2, 0x40, 0xD5, 0x21, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x25, 0xD1, 0xB1, 0xD1,
+0x22, 0xD1, 0x20, 0xD1, 0x40, 0x21, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0x40, 0xD1, 0x21, 0xD1, 0x21,
+0xD1, 0xB0, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0x40,
+0xD1, 0x25, 0xD0, 0xB1, 0xD0, 0x25, 0xD1, 0xB0, 0xD2, 0x22, 0xD1, 0x20, 0xD0, 0x60, 0x50, 0xC0,
+0x30, 0x70, 0x01, 0x70, 0x80, 0x03, 0x90, 0x0A, 0x90, 0x80, 0xF0, 0x0C, 0x90, 0x06, 0x51, 0x05,
+0xF0, 0x50, 0x0F, 0x02, 0x90, 0x0F, 0x05, 0xF0, 0x90, 0x0F, 0x02, 0xA0, 0x90, 0x00, 0x60, 0x50,
+0xA0, 0x0F, 0x1D, 0x0F, 0x21, 0xC0, 0x50, 0x01, 0xF0, 0xA0, 0xD1, 0x20, 0xD3, 0x23, 0xD4, 0x40,
+0xB0, 0xD1, 0x21, 0xD3, 0x20, 0xD0, 0x21, 0xD3, 0x22, 0xD1, 0x40, 0xB0, 0xD3, 0x21, 0xD1, 0x22,
+0xD3, 0x20, 0xD0, 0x20, 0x40, 0xD4, 0x20, 0xD2, 0x40, 0xB0, 0xD0, 0x21, 0xD0, 0xB1, 0xD1, 0x24,
+0xD2, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD4, 0x40, 0xD2, 0x25, 0xD1, 0x40, 0x20, 0xD1,
+0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD2, 0x21, 0xD0, 0x40, 0xD0, 0x23, 0xD3,
+0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0x40,
+0xD1, 0x20, 0xD0, 0x23, 0xD0, 0xB1, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x20,
+0xD1, 0xE0, 0x90, 0x70, 0xA0, 0x90, 0x80, 0x60, 0xF0, 0x60, 0xF0, 0x03, 0x71, 0x09, 0x30, 0x70,
+0x90, 0x0C, 0xF0, 0x50, 0x03, 0xF0, 0x90, 0x70, 0x07, 0x70, 0x50, 0x0F, 0x02, 0x90, 0x0F, 0x06,
+0x90, 0xF0, 0x0E, 0x90, 0xA0, 0x02, 0xC0, 0x50, 0x0F, 0x1D, 0x0F, 0x21, 0x70, 0x30, 0x01, 0x80,
+0xA0, 0xE0, 0xD2, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x21, 0xD3, 0x22, 0xD1,
+0x21, 0xD4, 0x40, 0xB0, 0xD2, 0x20, 0xD3, 0x22, 0xD3, 0x20, 0xD1, 0x40, 0xD4, 0x20, 0xD0, 0x21,
+0xD1, 0xB0, 0x40, 0xD2, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x21, 0xD0,
+0x22, 0xD3, 0xB1, 0xD0, 0x22, 0xD1, 0x22, 0xD1, 0x40, 0xD0, 0x24, 0xD0, 0x21, 0xD0, 0xB1, 0xD0,
+0x24, 0xD1, 0x21, 0x40, 0xD0, 0x22, 0xD2, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0xB0, 0x40,
+0xD0, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xD2, 0x22, 0xD1, 0xE0, 0x80, 0xF1, 0x01, 0x50, 0xA0, 0x50,
+0x05, 0x90, 0x09, 0xA0, 0x00, 0x71, 0x0C, 0x71, 0x01, 0x70, 0x50, 0xF0, 0x09, 0x50, 0x70, 0x0F,
+0x02, 0x90, 0x0F, 0x06, 0x50, 0x70, 0x0C, 0xF0, 0x10, 0x30, 0xF0, 0x00, 0x50, 0x80, 0x0F, 0x1E,
+0x0F, 0x22, 0x90, 0x80, 0xA0, 0x90, 0x00, 0x30, 0x40, 0xD5, 0x20, 0xD0, 0x20, 0xD1, 0xB0, 0x40,
+0xD4, 0x20, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD4, 0xB1, 0xD2, 0x22, 0xD1, 0x22, 0xD0, 0x22,
+0xD2, 0x40, 0x20, 0xD5, 0x21, 0xD3, 0xB0, 0x40, 0xD0, 0x40, 0x20, 0xD2, 0x22, 0xD0, 0x23, 0xD1,
+0xB1, 0xD0, 0x23, 0xD1, 0x20, 0xD3, 0x40, 0xD1, 0x22, 0xD0, 0x22, 0xD1, 0xB1, 0xD0, 0x24, 0xD0,
+0x21, 0xD0, 0xB0, 0xD2, 0x23, 0xD2, 0xB1, 0xD1, 0x20, 0xD3, 0x20, 0xD0, 0xB1, 0xD2, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x40, 0xD4, 0x21, 0xD2, 0x40, 0xD0, 0x26,
+0xD1, 0x40, 0xD2, 0x23, 0xD1, 0xC0, 0x00, 0x90, 0x0A, 0x71, 0x08, 0xA0, 0x01, 0x90, 0x0D, 0x90,
+0x00, 0x51, 0x0C, 0x90, 0xF0, 0x0F, 0x02, 0x90, 0x0F, 0x06, 0x51, 0x0B, 0x10, 0xF1, 0xA0, 0x50,
+0xA0, 0x0F, 0x1F, 0x0F, 0x23, 0x30, 0x50, 0x02, 0xC0, 0xD3, 0x22, 0xD2, 0xB0, 0x40, 0xD2, 0x21,
+0xD2, 0x24, 0xD0, 0x23, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x24, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x21,
+0xD0, 0x40, 0xB0, 0xD3, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD2, 0x41, 0xD4, 0x26, 0xD0, 0x20, 0x40,
+0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD1, 0x21, 0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x20,
+0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x25, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD3,
+0x20, 0xD0, 0xB1, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x40,
+0xD1, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0xD0, 0x20, 0xD1, 0x24, 0xD0, 0xB1, 0xD1, 0x20, 0xD1, 0x21,
+0xD0, 0x40, 0x30, 0x70, 0xF0, 0x0A, 0x90, 0x07, 0xA0, 0x90, 0x01, 0xF0, 0x50, 0x0C, 0xF0, 0x30,
+0xF0, 0x0E, 0x90, 0x0F, 0x03, 0x90, 0x0F, 0x06, 0x70, 0x90, 0x09, 0xA0, 0x90, 0x02, 0x10, 0x0F,
+0x20, 0x0F, 0x24, 0xA0, 0x01, 0x80, 0xE0, 0xA0, 0xD1, 0x21, 0xD3, 0x41, 0xD1, 0x23, 0xD2, 0x26,
+0xD1, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x25, 0xD4, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x25,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x40, 0xB0, 0xD3, 0x25, 0xD0, 0x40, 0x20, 0xD1, 0x20,
+0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x22, 0xD2, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20,
+0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x25, 0xD1, 0x40, 0xD1, 0x21, 0xD3, 0x20, 0xD0, 0xB0, 0xD3, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD2,
+0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0xA0, 0xE0,
+0x00, 0x50, 0x0A, 0x50, 0x70, 0x05, 0x30, 0x50, 0x03, 0x50, 0xF0, 0x0A, 0x51, 0x70, 0x50, 0x0F,
+0x00, 0x90, 0x0F, 0x03, 0x90, 0x0F, 0x06, 0xF0, 0x90, 0xF0, 0x06, 0x80, 0xA1, 0xF0, 0x00, 0x80,
+0x50, 0x70, 0xF0, 0x0F, 0x1E, 0x0F, 0x24, 0xF0, 0x31, 0x90, 0x00, 0x50, 0xA0, 0xD0, 0x21, 0xD2,
+0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD3, 0x24, 0xD1, 0x20, 0xD2, 0x40, 0xB0, 0xD2, 0x23, 0xD1,
+0x21, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0xB0, 0x40, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0x20, 0xD1, 0x21,
+0xD0, 0x40, 0xD2, 0x40, 0xB0, 0xD2, 0x24, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x24, 0xD0,
+0xB1, 0xD0, 0x22, 0xD3, 0x21, 0xD0, 0xB0, 0x20, 0xD2, 0x20, 0xD1, 0x22, 0xD0, 0xB1, 0xD2, 0x24,
+0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x23, 0xD0, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0xB1, 0xD3, 0x21, 0xD0, 0x20, 0xD1,
+0x40, 0xD0, 0x20, 0xD0, 0x23, 0xD0, 0xE1, 0x50, 0x90, 0x0B, 0x90, 0x05, 0x60, 0x05, 0x50, 0x09,
+0x90, 0x70, 0x01, 0x50, 0xF0, 0x0E, 0xF0, 0x50, 0x0F, 0x03, 0x90, 0x0F, 0x07, 0x90, 0xF0, 0x04,
+0x50, 0xC0, 0x01, 0xA0, 0x81, 0x70, 0x81, 0xF0, 0x0F, 0x1D, 0x0F, 0x25, 0x81, 0x02, 0xA0, 0xE0,
+0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD1,
+0xB1, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x23, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x20, 0xD0, 0x20, 0xD0,
+0x22, 0xD1, 0x20, 0xD2, 0xB1, 0xD3, 0xB0, 0x40, 0xD2, 0x22, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x22,
+0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD3, 0x21, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x20,
+0xD1, 0x21, 0xD0, 0x40, 0xD3, 0x24, 0xD1, 0x40, 0xD0, 0x22, 0xD1, 0x22, 0xD0, 0x40, 0xD3, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0xB0, 0xD2, 0x20, 0xD0, 0x22, 0xD1,
+0xB1, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0xE0, 0xA0, 0x50,
+0x0A, 0x50, 0xF0, 0x03, 0x70, 0xC0, 0x05, 0x50, 0x70, 0x06, 0x70, 0x90, 0x04, 0x90, 0x0F, 0x00,
+0x70, 0x50, 0x0F, 0x03, 0x90, 0x0F, 0x07, 0x90, 0x70, 0x03, 0x10, 0xF0, 0x01, 0xF0, 0x60, 0x00,
+0x90, 0x80, 0x30, 0xF0, 0x0F, 0x1D, 0x0F, 0x24, 0x70, 0x00, 0x80, 0x50, 0x00, 0x30, 0x90, 0xE0,
+0x40, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD2, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1,
+0x21, 0xD0, 0x21, 0xD3, 0x23, 0xD3, 0x40, 0xD1, 0x21, 0xD2, 0x23, 0xD2, 0x20, 0xD0, 0x20, 0x40,
+0xD2, 0x21, 0xD1, 0x41, 0xD4, 0xB1, 0xD1, 0x23, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0x40, 0xD1,
+0x22, 0xD3, 0x21, 0xD0, 0x40, 0xD2, 0x21, 0xD2, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x24, 0xD1,
+0x40, 0xD0, 0x22, 0xD1, 0x22, 0xD0, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x23, 0xD0, 0xB0, 0xD2, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x20,
+0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x60, 0x90, 0x0A, 0x90, 0x04, 0x80, 0x30,
+0x05, 0x90, 0x04, 0x70, 0x90, 0x70, 0x05, 0xF0, 0x50, 0x00, 0x90, 0x50, 0x0C, 0x50, 0x70, 0x0F,
+0x03, 0x90, 0x0F, 0x07, 0x51, 0x01, 0x10, 0x50, 0xA0, 0x70, 0x00, 0x60, 0x02, 0x70, 0xF0, 0x0F,
+0x1E, 0x0F, 0x23, 0x80, 0x61, 0x00, 0x30, 0xA0, 0x70, 0x01, 0xA0, 0x41, 0xD1, 0x22, 0xD0, 0x21,
+0xD4, 0x23, 0xD1, 0x21, 0xD1, 0xB1, 0xD2, 0x24, 0xD1, 0x23, 0xD0, 0x22, 0xD0, 0x40, 0xD2, 0x28,
+0xD4, 0x40, 0xD3, 0x21, 0xD2, 0x20, 0x40, 0xB0, 0xD2, 0x40, 0xD1, 0x24, 0xD2, 0x20, 0xD1, 0x40,
+0xD2, 0x21, 0xD4, 0x20, 0xD0, 0x40, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x20,
+0xD1, 0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD2, 0x22, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0xB1, 0xD0, 0x20, 0xD0, 0x23, 0xD2, 0x40, 0xD1, 0x20,
+0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x90, 0xA0, 0xF0, 0x09, 0x50, 0xF0, 0x04,
+0xA0, 0x70, 0x04, 0x70, 0x50, 0x02, 0x51, 0x07, 0x50, 0x31, 0x80, 0xA0, 0x0D, 0x90, 0xF0, 0x0F,
+0x03, 0x90, 0x0F, 0x07, 0x70, 0x50, 0xA0, 0x90, 0x01, 0x30, 0x60, 0xF0, 0x90, 0xC0, 0x60, 0x70,
+0x0F, 0x1F, 0x0F, 0x25, 0x90, 0x80, 0x00, 0x60, 0x01, 0x70, 0x10, 0xC0, 0xD2, 0x20, 0xD0, 0x21,
+0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x21, 0xD4, 0x40, 0xB0, 0xD2, 0x24, 0xD2, 0x22, 0xD0, 0x21, 0xD1,
+0x40, 0xB0, 0xD0, 0x21, 0xD0, 0x23, 0xD3, 0x20, 0xD2, 0x40, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD0,
+0x20, 0xD1, 0x41, 0xD0, 0x40, 0xB0, 0xD2, 0x21, 0xD4, 0x20, 0xD0, 0xB1, 0xD4, 0x21, 0xD1, 0x20,
+0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD1, 0xB1,
+0xD0, 0x22, 0xD2, 0x20, 0xD0, 0x20, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x23, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x23, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0x22, 0xD2, 0x40,
+0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0xB0, 0x80, 0xA0, 0x09, 0xF0, 0x50, 0x05, 0x60, 0x50,
+0x04, 0x90, 0x00, 0x70, 0x90, 0xF0, 0x07, 0x80, 0x30, 0x70, 0x50, 0x00, 0xA0, 0x0E, 0x50, 0xF0,
+0x0F, 0x02, 0xF0, 0x90, 0x0F, 0x07, 0x30, 0x10, 0x80, 0x01, 0x80, 0x90, 0x70, 0xA0, 0x00, 0x70,
+0xC0, 0x80, 0x0F, 0x1E, 0x0F, 0x20, 0x70, 0x50, 0x02, 0x80, 0xA0, 0x00, 0x70, 0x30, 0x90, 0x11,
+0x90, 0xA0, 0xD5, 0x21, 0xD0, 0x21, 0xD3, 0x20, 0xD4, 0xB1, 0xD2, 0x25, 0xD1, 0x20, 0xD0, 0x23,
+0xD1, 0xB1, 0xD3, 0x24, 0xD4, 0x20, 0xD0, 0xB0, 0x40, 0xD0, 0x20, 0xD2, 0x26, 0xD0, 0xB0, 0x41,
+0xD1, 0x22, 0xD4, 0x21, 0xD0, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x20,
+0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x22, 0xD2, 0x20,
+0xD0, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22,
+0xD1, 0xB1, 0xD1, 0x24, 0xD0, 0x20, 0xD0, 0xB0, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x40,
+0xD0, 0x21, 0xD0, 0x25, 0xD1, 0x41, 0x60, 0x09, 0x50, 0x06, 0x60, 0x04, 0xF0, 0xA0, 0x90, 0x08,
+0xA0, 0x80, 0x02, 0x80, 0x30, 0x0F, 0x00, 0x90, 0x0F, 0x04, 0x90, 0x0F, 0x05, 0x90, 0xA0, 0x30,
+0x10, 0xA0, 0x90, 0x30, 0x00, 0x50, 0xA0, 0x02, 0xC0, 0x90, 0x0F, 0x1D, 0x0F, 0x1F, 0x70, 0x10,
+0xA0, 0x60, 0xC1, 0x60, 0x00, 0xF0, 0x00, 0x50, 0x10, 0x60, 0x01, 0x50, 0xA0, 0xD1, 0xA0, 0xD0,
+0x20, 0xD0, 0x22, 0xD6, 0x20, 0xD1, 0xB1, 0xD1, 0x27, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0xB1, 0xD2,
+0x20, 0xD0, 0x24, 0xD4, 0x20, 0xD0, 0x40, 0xD0, 0x21, 0xD2, 0x20, 0xD0, 0x24, 0xD1, 0x40, 0xB0,
+0x40, 0xB0, 0xD9, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD1, 0x40, 0x20, 0xD0, 0x21,
+0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x21, 0xD1, 0x23, 0xD1, 0x40, 0xD1, 0x23, 0xD3, 0x20,
+0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x40,
+0xD1, 0x24, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x20,
+0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD0, 0x40, 0x30, 0x08, 0xF0, 0x50, 0x04, 0x50, 0x60, 0x30,
+0xC0, 0x01, 0x50, 0xA0, 0x90, 0x70, 0x06, 0x70, 0x60, 0x70, 0x03, 0x70, 0x30, 0x0F, 0x00, 0xF0,
+0x90, 0x0F, 0x04, 0x90, 0x0F, 0x03, 0x70, 0xC0, 0x01, 0x90, 0x10, 0xA0, 0x02, 0xA0, 0x30, 0x01,
+0xF0, 0xC0, 0x0F, 0x1D, 0x0F, 0x20, 0x90, 0xA0, 0x03, 0x70, 0x60, 0xC0, 0xF0, 0x91, 0x01, 0x80,
+0xA0, 0xE0, 0xD0, 0xB0, 0xD1, 0x23, 0xD4, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x22,
+0xD1, 0x20, 0xD1, 0xB0, 0x40, 0xD2, 0x21, 0xD1, 0x23, 0xD3, 0x20, 0xD0, 0x40, 0xB0, 0xD1, 0x21,
+0xD0, 0x21, 0xD2, 0x21, 0xD1, 0xB1, 0xD1, 0xB0, 0x40, 0xB0, 0xD7, 0x40, 0x20, 0xD0, 0x21, 0xD4,
+0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x22, 0xD1, 0x20, 0xB0, 0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x20,
+0xD1, 0x20, 0x40, 0xD2, 0x21, 0xD0, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD1, 0x26, 0xD0, 0xB1, 0xD3, 0x24, 0xD1, 0x40,
+0xD0, 0x20, 0xD0, 0x24, 0xD2, 0xB1, 0xD0, 0x60, 0xF0, 0x08, 0x90, 0x07, 0x50, 0x60, 0x80, 0x30,
+0x00, 0x50, 0x80, 0x05, 0x80, 0x30, 0x50, 0x05, 0x30, 0xF0, 0x0F, 0x00, 0x70, 0x50, 0x0F, 0x04,
+0x90, 0x0F, 0x01, 0xF0, 0x10, 0xA0, 0xF0, 0x01, 0xA0, 0x00, 0x30, 0xC0, 0x80, 0x00, 0xA0, 0x60,
+0xF0, 0x50, 0x60, 0x0F, 0x1D, 0x0F, 0x21, 0x31, 0x04, 0xF0, 0xA0, 0x00, 0x30, 0x50, 0x30, 0x90,
+0x00, 0xE1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x25, 0xD2,
+0x23, 0xD3, 0x40, 0x20, 0xD2, 0x22, 0xD0, 0x24, 0xD3, 0xB1, 0xD0, 0x20, 0xD1, 0x25, 0xD4, 0x40,
+0xD0, 0x21, 0xD1, 0xB0, 0x40, 0x20, 0xD5, 0x40, 0xD0, 0x22, 0xD3, 0x22, 0xD0, 0xB1, 0xD0, 0x22,
+0xD1, 0x22, 0xD1, 0xB0, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD2, 0xB1, 0xD0, 0x20, 0xD0, 0x24, 0xD1,
+0xB1, 0xD0, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD1, 0x26,
+0xD1, 0x40, 0xD4, 0x23, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40,
+0xD0, 0xB0, 0x60, 0x08, 0xF0, 0x50, 0x05, 0x70, 0x90, 0xF0, 0x02, 0x90, 0x80, 0x71, 0x91, 0x30,
+0xA0, 0x30, 0x07, 0x50, 0x30, 0x0F, 0x01, 0x50, 0x70, 0x0F, 0x04, 0x90, 0x0E, 0xF0, 0xC0, 0xF1,
+0xA0, 0x70, 0xA0, 0x00, 0x90, 0x80, 0x00, 0x60, 0x50, 0xF0, 0x90, 0x61, 0x70, 0x0F, 0x1D, 0x0F,
+0x22, 0x50, 0xF0, 0x30, 0x00, 0x82, 0xA0, 0x01, 0xC0, 0x50, 0x02, 0xC0, 0x40, 0xD1, 0x22, 0xD2,
+0x22, 0xD1, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1, 0x21,
+0xD0, 0x28, 0xD2, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0x22, 0xD2, 0x40, 0xB0, 0xD0,
+0x20, 0xD4, 0x41, 0x20, 0xD2, 0xB1, 0xD1, 0x21, 0xD3, 0x22, 0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x22,
+0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD2, 0xB1, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0xB1, 0xD0, 0x23,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xD1, 0x26, 0xD1, 0x40, 0xD0,
+0x20, 0xD3, 0x22, 0xD1, 0xB1, 0xD3, 0x20, 0xD0, 0x20, 0xD3, 0xB1, 0xD0, 0xE0, 0x50, 0x08, 0x90,
+0x03, 0x50, 0x90, 0x70, 0x04, 0x70, 0xC0, 0x30, 0x80, 0xA0, 0x90, 0x70, 0x50, 0x09, 0x70, 0xA0,
+0x30, 0xF0, 0x81, 0x50, 0x0B, 0x50, 0x70, 0x0F, 0x04, 0x90, 0x0D, 0xC0, 0x50, 0x02, 0xC0, 0x70,
+0x00, 0x30, 0x80, 0x00, 0xC0, 0xA0, 0x10, 0x70, 0x0F, 0x20, 0x0F, 0x23, 0x81, 0x00, 0xF0, 0xC0,
+0x80, 0x03, 0x60, 0xF0, 0x00, 0x30, 0x90, 0xA0, 0x40, 0xD0, 0x20, 0xD2, 0x23, 0xD1, 0xB1, 0xD1,
+0x21, 0xD1, 0x24, 0xD3, 0x21, 0xD2, 0x40, 0xB0, 0xD1, 0x20, 0xD0, 0x2A, 0xD1, 0x40, 0xD1, 0x20,
+0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD2, 0x40, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD3, 0x41,
+0xB0, 0xD0, 0x40, 0xD1, 0x21, 0xD5, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x23, 0xD0, 0x40, 0xD5,
+0x21, 0xD2, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD1, 0xB1, 0xD0, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20,
+0xD1, 0x20, 0xD0, 0x22, 0xD2, 0x40, 0xD1, 0x27, 0xD0, 0x40, 0xD0, 0x20, 0xD3, 0x21, 0xD2, 0xB1,
+0xD4, 0x20, 0xD1, 0x20, 0xD1, 0xB1, 0xD0, 0xB0, 0xA0, 0x08, 0x71, 0x00, 0x50, 0x90, 0x70, 0x08,
+0xF0, 0x50, 0x00, 0xA0, 0xF0, 0x0B, 0x50, 0x90, 0x30, 0x50, 0x70, 0x80, 0xA0, 0x30, 0x60, 0x50,
+0x00, 0x50, 0x90, 0xF0, 0x04, 0x90, 0xF0, 0x0F, 0x04, 0x90, 0x0B, 0xC0, 0x90, 0xA0, 0xF0, 0x00,
+0x30, 0x50, 0x70, 0x00, 0xF0, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x60, 0x0F, 0x20, 0x0F, 0x23, 0x70,
+0x60, 0xF0, 0x80, 0xA0, 0x00, 0x30, 0xC0, 0x60, 0x90, 0x00, 0xA0, 0x30, 0x50, 0x01, 0xA0, 0xB0,
+0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xB0, 0xD2, 0x20, 0xD3, 0x20, 0xD2, 0x21, 0xD5, 0x40, 0xB0,
+0xD2, 0x20, 0xD2, 0x27, 0xD1, 0xB1, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x40,
+0xD1, 0x21, 0xD1, 0x21, 0xD3, 0x20, 0xB0, 0x40, 0xB0, 0xD8, 0x20, 0xD1, 0xB0, 0x20, 0xD0, 0x25,
+0xD1, 0x21, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x26, 0xD2, 0xB0, 0x20,
+0xD1, 0x22, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD1, 0xB0, 0x20,
+0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD1, 0x21, 0xD0, 0x22, 0xD2, 0x40, 0xD1, 0x22,
+0xD2, 0x21, 0xD1, 0x40, 0xD1, 0xE0, 0x80, 0x08, 0x80, 0x50, 0xF0, 0x0B, 0x90, 0x00, 0xF0, 0xA0,
+0x0C, 0x90, 0x06, 0x30, 0xA0, 0x90, 0x50, 0x31, 0x04, 0x90, 0x0F, 0x05, 0x90, 0x09, 0x60, 0x90,
+0x01, 0xA0, 0x30, 0x90, 0x00, 0xC0, 0x30, 0x04, 0x90, 0x30, 0x0F, 0x20, 0x0F, 0x24, 0x90, 0x60,
+0xA0, 0xF0, 0x60, 0x30, 0x01, 0xC0, 0x00, 0x70, 0x60, 0x02, 0xE0, 0xC0, 0xD3, 0x20, 0xD2, 0x40,
+0xB0, 0xD1, 0x22, 0xD5, 0x24, 0xD3, 0xB0, 0x40, 0xD6, 0x26, 0xD2, 0x20, 0x40, 0xD2, 0x21, 0xD1,
+0x22, 0xD4, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD4, 0x40, 0xB0, 0x40, 0xB0, 0xD6, 0x20,
+0xD1, 0x40, 0xD3, 0x23, 0xD3, 0x40, 0xB0, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD0,
+0x26, 0xD2, 0x40, 0x20, 0xD0, 0x26, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1,
+0xB0, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0xB1, 0xD3, 0x24, 0xD1, 0x40, 0xD1, 0x22, 0xD6, 0xB0,
+0x20, 0xD1, 0xA0, 0x70, 0x04, 0xF0, 0x52, 0x70, 0x0C, 0xF0, 0x50, 0x00, 0x50, 0x80, 0x0B, 0x70,
+0x50, 0x0A, 0xA0, 0x05, 0x90, 0x0F, 0x04, 0xF0, 0x90, 0x07, 0x30, 0x10, 0x02, 0x81, 0x01, 0xA2,
+0x01, 0x90, 0xC0, 0xA0, 0x0F, 0x21, 0x0F, 0x27, 0x30, 0x80, 0x02, 0xC0, 0x01, 0x70, 0xA0, 0x00,
+0x30, 0x90, 0x00, 0x60, 0xD0, 0xE0, 0xB0, 0xD0, 0x20, 0xD0, 0x40, 0xB0, 0xD1, 0x24, 0xD3, 0x26,
+0xD1, 0x20, 0x40, 0xD5, 0x27, 0xD3, 0x40, 0xD2, 0x24, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x40, 0x20,
+0xD2, 0x26, 0xD2, 0xB1, 0xD1, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD2, 0x40, 0xD1, 0x21, 0xD7, 0x40,
+0xD1, 0x20, 0xD1, 0x23, 0xD2, 0xB0, 0xD2, 0x24, 0xD2, 0x40, 0xD1, 0x26, 0xD1, 0xB0, 0x20, 0xD0,
+0x21, 0xD0, 0x23, 0xD1, 0xB1, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xB0, 0xD3, 0x22,
+0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x21, 0xD4, 0x21, 0xD1, 0x40, 0xD1, 0xB0, 0x60, 0x02, 0xF0, 0x90,
+0x50, 0xF0, 0x01, 0x90, 0x0D, 0x50, 0xF0, 0x70, 0x30, 0x0C, 0x50, 0x70, 0x09, 0x30, 0xF0, 0x04,
+0x70, 0x50, 0x0F, 0x04, 0xF0, 0x90, 0x05, 0x30, 0xA0, 0x00, 0x60, 0x00, 0x50, 0x30, 0x02, 0x30,
+0x00, 0x80, 0xC0, 0x0F, 0x25, 0x0F, 0x26, 0x70, 0x60, 0x01, 0xF0, 0x10, 0x50, 0x90, 0x30, 0x50,
+0x70, 0x10, 0x50, 0x01, 0xF0, 0xC0, 0xA0, 0xD2, 0x40, 0xB0, 0xD1, 0x25, 0xD3, 0x25, 0xD1, 0x20,
+0x40, 0xD6, 0x27, 0xD2, 0x40, 0x20, 0xD0, 0x22, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20,
+0xD0, 0xB1, 0xD4, 0x20, 0xD0, 0x23, 0xD2, 0x40, 0xD4, 0xB0, 0x41, 0xB0, 0xD3, 0x40, 0xB0, 0xDB,
+0x40, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0xB1, 0xD2, 0x24, 0xD2, 0x40, 0xD1, 0x26, 0xD1, 0xB0, 0x20,
+0xD1, 0x20, 0xD0, 0x23, 0xD1, 0xB1, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0xB1, 0xD0, 0x21, 0xD8, 0x40, 0xD2, 0x40, 0xA0, 0x70,
+0x90, 0x50, 0x04, 0x71, 0x0D, 0x50, 0x60, 0x0E, 0x90, 0x09, 0x60, 0x06, 0x51, 0x0F, 0x05, 0x90,
+0x03, 0xA0, 0x30, 0x02, 0x60, 0xA0, 0x06, 0x50, 0x10, 0x70, 0x0F, 0x23, 0x0F, 0x27, 0x60, 0x70,
+0x90, 0xC0, 0x90, 0x00, 0x30, 0x50, 0x30, 0x00, 0x90, 0x80, 0x01, 0x30, 0x80, 0x10, 0xB0, 0xD0,
+0x40, 0xB0, 0xD0, 0x28, 0xD1, 0x25, 0xD2, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x23, 0xD1, 0x23, 0xD1,
+0xB1, 0xD1, 0x21, 0xD1, 0x21, 0xD2, 0x21, 0xD2, 0x40, 0xD1, 0x20, 0xD2, 0x24, 0xD0, 0x20, 0xD0,
+0xB1, 0xD6, 0x20, 0x41, 0xB0, 0xD1, 0x40, 0xD2, 0x23, 0xD1, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0,
+0x22, 0xD3, 0xB1, 0xD0, 0x26, 0xD2, 0x40, 0xD1, 0x20, 0xD0, 0x24, 0xD1, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x20, 0xD4, 0xB1, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x20,
+0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x28, 0xD0, 0xB1, 0xD0, 0xB0, 0x40, 0xE0, 0x90, 0x07, 0x50, 0x0D,
+0x70, 0x60, 0x0F, 0x00, 0x90, 0x07, 0x70, 0x60, 0x70, 0x06, 0x50, 0x70, 0x0F, 0x05, 0x90, 0x01,
+0x30, 0xA0, 0x30, 0xF0, 0x00, 0x70, 0x30, 0x08, 0x70, 0x0F, 0x24, 0x0F, 0x27, 0x70, 0xA0, 0x30,
+0xF0, 0x01, 0x70, 0x90, 0xF0, 0x01, 0x82, 0x90, 0x00, 0x70, 0x60, 0xB1, 0xD0, 0x23, 0xD0, 0x22,
+0xD1, 0x26, 0xD2, 0x40, 0x20, 0xD5, 0x29, 0xD1, 0x40, 0xD1, 0x25, 0xD3, 0x20, 0xD0, 0x20, 0xD0,
+0xB0, 0x20, 0xD0, 0x21, 0xD1, 0x27, 0xD0, 0x40, 0xD1, 0x21, 0xD3, 0x20, 0xD1, 0xB0, 0x42, 0xD7,
+0x22, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x26, 0xD2, 0x40, 0xD1,
+0x20, 0xD0, 0x24, 0xD1, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD3, 0x20, 0xB0, 0xD1, 0x26, 0xD1,
+0x40, 0xD1, 0x21, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x23, 0xD5, 0xB0, 0x41, 0xB0, 0xD0, 0x50, 0xA0,
+0x50, 0x06, 0x50, 0xF0, 0x0D, 0x30, 0x0F, 0x00, 0x71, 0x07, 0x70, 0x30, 0x07, 0x90, 0xF0, 0x0F,
+0x05, 0x50, 0x31, 0x00, 0xF0, 0xA0, 0x70, 0xA0, 0x0F, 0x2F, 0x0F, 0x33, 0x80, 0x60, 0x02, 0x30,
+0xC0, 0xD2, 0x22, 0xD6, 0x24, 0xD2, 0xB1, 0xD3, 0x20, 0xD0, 0x22, 0xD0, 0x24, 0xD2, 0x40, 0xB0,
+0xD2, 0x23, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x24, 0xD1, 0x24, 0xD0, 0xB1, 0xD1, 0x21,
+0xD8, 0x40, 0xB0, 0x41, 0xB0, 0xD5, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x21, 0xD0,
+0x40, 0xD3, 0x25, 0xD0, 0xB1, 0xD0, 0x27, 0xD1, 0x40, 0x20, 0xD0, 0x26, 0xD1, 0x20, 0xB0, 0xD1,
+0x22, 0xD5, 0xB1, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD4,
+0xB0, 0x40, 0xB0, 0x40, 0xD4, 0x60, 0x06, 0xF0, 0x50, 0x0D, 0x80, 0x50, 0x0F, 0x00, 0x90, 0xF0,
+0x07, 0xA0, 0x00, 0x50, 0x80, 0xA0, 0x31, 0x02, 0x90, 0x0F, 0x05, 0x30, 0x10, 0x02, 0x70, 0x10,
+0x0F, 0x30, 0x0F, 0x34, 0x81, 0x00, 0x30, 0x90, 0x00, 0x60, 0xD1, 0x20, 0xD0, 0x20, 0xD5, 0x23,
+0xD3, 0xB0, 0x40, 0xD0, 0x20, 0xD3, 0x28, 0xD2, 0xB1, 0xD3, 0x23, 0xD1, 0x20, 0xD0, 0x21, 0xD1,
+0x40, 0xD1, 0x24, 0xD1, 0x23, 0xD1, 0x40, 0xD2, 0x22, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD2,
+0xB0, 0x41, 0xB0, 0xD5, 0x40, 0xD0, 0x20, 0xD0, 0x27, 0xD0, 0x40, 0xD3, 0x25, 0xD0, 0xB1, 0xD0,
+0x27, 0xD1, 0x40, 0x20, 0xD0, 0x26, 0xD1, 0x20, 0x40, 0xD1, 0x22, 0xD1, 0x20, 0xD2, 0xB1, 0xD0,
+0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x20, 0x40, 0xD4, 0x20, 0xB0, 0x41, 0xB0, 0xD1, 0xB1, 0xD3,
+0xB0, 0xA0, 0x06, 0x90, 0x0D, 0xA0, 0x90, 0x0F, 0x01, 0x90, 0x07, 0x31, 0x90, 0x70, 0x00, 0x90,
+0x50, 0x03, 0x90, 0x0F, 0x03, 0x30, 0xA0, 0x00, 0xC0, 0x00, 0x70, 0x60, 0x0F, 0x31, 0x0F, 0x35,
+0x80, 0x60, 0x90, 0x01, 0xF0, 0xC0, 0xD2, 0x21, 0xD2, 0x41, 0xD0, 0x22, 0xD2, 0xB0, 0x40, 0xD4,
+0x24, 0xD0, 0x24, 0xD1, 0xB0, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD1, 0x22, 0xD0, 0xB0, 0x40, 0xD2,
+0x23, 0xD1, 0x23, 0xD1, 0x40, 0xD2, 0x24, 0xD1, 0x21, 0xD0, 0xB1, 0xD5, 0xB0, 0x41, 0xB0, 0xD1,
+0xB1, 0xD2, 0x25, 0xD1, 0x20, 0x40, 0xD1, 0x27, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x22,
+0xD1, 0xB0, 0x20, 0xD3, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD0, 0x28, 0xD1, 0xB0, 0xD2,
+0x25, 0xD2, 0x40, 0xD1, 0xB0, 0x41, 0xB0, 0x20, 0xD5, 0x40, 0xD1, 0x20, 0xD1, 0x30, 0x50, 0x05,
+0xF0, 0x50, 0x0B, 0x80, 0x90, 0x00, 0x90, 0x0F, 0x00, 0x70, 0x50, 0x0B, 0x70, 0x30, 0x70, 0x02,
+0x70, 0x50, 0x0F, 0x01, 0xA1, 0x02, 0xA1, 0x0F, 0x32, 0x0F, 0x36, 0x81, 0x01, 0x81, 0x60, 0xD2,
+0x21, 0xD1, 0xB0, 0xE0, 0xD0, 0x22, 0xD1, 0x20, 0x40, 0xD5, 0x27, 0xD2, 0x20, 0xD0, 0x40, 0x20,
+0xD1, 0x20, 0xD3, 0x23, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x29, 0xD1, 0x40, 0x20, 0xD1, 0x25, 0xD2,
+0x20, 0xD0, 0x40, 0xD3, 0x21, 0xD3, 0xB1, 0x41, 0xB0, 0xD4, 0x21, 0xD3, 0xB1, 0xD1, 0x27, 0xD0,
+0xB1, 0xD1, 0x21, 0xD2, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD7, 0x40, 0xD1, 0x21, 0xD1, 0x23,
+0xD1, 0x40, 0xD0, 0x22, 0xD1, 0x20, 0xD4, 0x42, 0xB0, 0xD4, 0x20, 0xD3, 0xB1, 0xD0, 0x20, 0xD1,
+0xC0, 0x07, 0x50, 0xF0, 0x0A, 0x30, 0x70, 0x00, 0x50, 0xF0, 0x0F, 0x00, 0x50, 0xF0, 0x0B, 0x90,
+0xA0, 0x90, 0x02, 0x70, 0x50, 0x0E, 0x32, 0xF0, 0x00, 0xF0, 0xA0, 0xF0, 0x0F, 0x32, 0x0F, 0x37,
+0x83, 0x00, 0xF0, 0x60, 0xB0, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0x22, 0xD1, 0x23,
+0xD0, 0x24, 0xD3, 0xB1, 0xD1, 0x22, 0xD2, 0x23, 0xD3, 0xB1, 0xD0, 0x20, 0xD1, 0x27, 0xD2, 0x40,
+0xD1, 0x21, 0xD0, 0x24, 0xD3, 0x40, 0xD5, 0x21, 0xD4, 0x40, 0xB0, 0x41, 0xB1, 0xD6, 0x40, 0x20,
+0xD4, 0x24, 0xD0, 0xB0, 0xD2, 0x20, 0xD0, 0x23, 0xD2, 0xB0, 0x20, 0xD3, 0x22, 0xD1, 0x20, 0xD0,
+0x40, 0xD1, 0x21, 0xD7, 0x40, 0xD7, 0xB0, 0x41, 0xB0, 0x40, 0xB0, 0xD2, 0x21, 0xD6, 0xB1, 0xD0,
+0x21, 0xD0, 0xE0, 0x40, 0x06, 0xF0, 0x50, 0x09, 0xA0, 0x30, 0x90, 0x01, 0x90, 0x0F, 0x01, 0x90,
+0x0D, 0xA0, 0x03, 0x50, 0x70, 0x0C, 0x31, 0x00, 0xF0, 0xA0, 0x70, 0x60, 0x0F, 0x34, 0x0F, 0x38,
+0x80, 0x60, 0x02, 0x80, 0xC0, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD2, 0x40, 0xB0, 0xD0, 0x22, 0xD0,
+0x23, 0xD0, 0x23, 0xD3, 0x20, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD3, 0x21, 0xD3, 0x40, 0xD0, 0x22,
+0xD3, 0x23, 0xD2, 0x40, 0x20, 0xD0, 0x22, 0xD1, 0x23, 0xD2, 0xB1, 0xD4, 0x20, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0xB1, 0xD3, 0xB0, 0x43, 0xB0, 0xD1, 0x40, 0xDB, 0x40, 0xD2, 0x21, 0xD1, 0x22, 0xD1,
+0xB0, 0x21, 0xD7, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD8, 0x40, 0xD2, 0xB0, 0x43, 0xB0, 0xD3, 0x40,
+0xD0, 0x23, 0xD7, 0x40, 0xD0, 0x21, 0xD1, 0xA0, 0x80, 0x06, 0x90, 0x08, 0x31, 0x60, 0xA0, 0xF0,
+0x00, 0x71, 0x0F, 0x00, 0xF0, 0x50, 0x0C, 0x91, 0x03, 0x90, 0xF0, 0x0A, 0x60, 0x10, 0x02, 0x50,
+0x10, 0x0F, 0x35, 0x0F, 0x39, 0x81, 0x00, 0x80, 0x90, 0x00, 0xA0, 0x40, 0xD3, 0x22, 0xD1, 0x40,
+0xB0, 0xD0, 0x26, 0xD0, 0x23, 0xD5, 0x40, 0xD2, 0x25, 0xD2, 0x22, 0xD1, 0x40, 0xB0, 0xD2, 0x21,
+0xD2, 0x23, 0xD2, 0x40, 0xD0, 0x23, 0xD1, 0x23, 0xD2, 0x40, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0x23,
+0xD0, 0xB1, 0xD0, 0x20, 0xD5, 0x20, 0xB0, 0x42, 0xB2, 0xD8, 0x40, 0xD1, 0x27, 0xD1, 0xB0, 0x2B,
+0xB0, 0xD8, 0xB2, 0x42, 0xB0, 0x20, 0xD1, 0x20, 0xD5, 0x40, 0x20, 0xD0, 0x25, 0xD0, 0x20, 0xD2,
+0xB1, 0xD0, 0x22, 0xD0, 0x40, 0x60, 0xF0, 0x04, 0xF0, 0x50, 0x07, 0x80, 0x60, 0xC0, 0x11, 0x70,
+0x00, 0x90, 0x0F, 0x01, 0x50, 0x70, 0x0B, 0x30, 0x05, 0x90, 0x09, 0xC0, 0x90, 0x00, 0x60, 0x00,
+0x70, 0xA0, 0x0F, 0x36, 0x0F, 0x3A, 0x90, 0x60, 0x80, 0x02, 0xC0, 0x40, 0xD1, 0x21, 0xD2, 0xB1,
+0xD1, 0x26, 0xD0, 0x22, 0xD5, 0x40, 0xB0, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x22, 0xD1, 0x20, 0x40,
+0xD1, 0x21, 0xD0, 0x20, 0xD3, 0x22, 0xD1, 0x40, 0xB0, 0xD0, 0x24, 0xD2, 0x21, 0xD1, 0xB0, 0x40,
+0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD3, 0x40, 0xB3, 0x41,
+0xB3, 0x20, 0xD0, 0x40, 0xDB, 0xB0, 0xD9, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xB2, 0x42, 0xB3, 0x40,
+0xD5, 0x20, 0xD2, 0x20, 0xD0, 0xB0, 0x20, 0xD0, 0x23, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD0,
+0x22, 0xD1, 0xB0, 0x60, 0x80, 0x70, 0x03, 0x90, 0x09, 0x90, 0xC0, 0x10, 0xF0, 0x00, 0xF0, 0x50,
+0x0F, 0x01, 0x90, 0x0B, 0xA0, 0x05, 0xF0, 0x90, 0x06, 0xF0, 0xC0, 0x90, 0x02, 0x60, 0x30, 0x0F,
+0x37, 0x0F, 0x3B, 0x50, 0x30, 0x01, 0x80, 0x90, 0x30, 0xE0, 0xD4, 0xB0, 0x40, 0xD4, 0x28, 0xD4,
+0xB0, 0x40, 0xD0, 0x20, 0xD5, 0x24, 0xD3, 0x40, 0xD1, 0x24, 0xD4, 0x21, 0xD1, 0x40, 0xD1, 0x21,
+0xD0, 0x21, 0xD3, 0x20, 0xD1, 0xB0, 0xD1, 0x24, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB0, 0xD0, 0x22,
+0xD2, 0x20, 0xD4, 0x40, 0xD5, 0x20, 0xB4, 0xE0, 0x45, 0xB5, 0x41, 0xB3, 0x48, 0xB3, 0x20, 0xD6,
+0x40, 0xD4, 0x22, 0xD3, 0xB1, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x21, 0xD2,
+0x40, 0xA1, 0x90, 0x01, 0xF0, 0x70, 0x09, 0xA0, 0xF0, 0x02, 0x50, 0xF0, 0x0F, 0x00, 0xF0, 0x50,
+0x09, 0x50, 0x80, 0x06, 0xF0, 0x90, 0x04, 0x70, 0xC0, 0x50, 0xA0, 0x01, 0x50, 0xA0, 0x0F, 0x38,
+0x0F, 0x3C, 0x70, 0xA0, 0x81, 0x01, 0x80, 0xA0, 0xD3, 0x40, 0xD7, 0x25, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0x40, 0xD0, 0x22, 0xD4, 0x24, 0xD1, 0x21, 0x40, 0xD0, 0x23, 0xD0, 0x20, 0xD7, 0xB1, 0xD0,
+0x22, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0x40, 0xD2, 0x24, 0xD2, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD0,
+0x23, 0xD2, 0xB1, 0x24, 0xD6, 0x40, 0xD7, 0xB3, 0x40, 0xB4, 0xD6, 0xB1, 0xD6, 0x23, 0xD0, 0x40,
+0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD0, 0x20, 0x40, 0xD1, 0x20, 0xD3, 0x21, 0xD1, 0x20, 0xD0,
+0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD3, 0xE0, 0x60, 0xA0, 0xE0, 0x80, 0x07, 0xF0, 0xA0, 0xF0, 0x04,
+0x90, 0x0F, 0x01, 0x70, 0x50, 0x03, 0x70, 0x91, 0x70, 0x00, 0x30, 0x08, 0x70, 0x50, 0x02, 0x70,
+0x10, 0xF0, 0x00, 0xF0, 0xA0, 0x80, 0x30, 0x00, 0x50, 0x0F, 0x37, 0x0F, 0x3D, 0x70, 0x60, 0xF0,
+0x01, 0x80, 0x30, 0xA0, 0xD1, 0x40, 0xD4, 0x20, 0xD2, 0x23, 0xD2, 0x21, 0xD1, 0x40, 0xD2, 0x21,
+0xD6, 0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD3, 0x23, 0xD1, 0x21, 0xD3, 0x40, 0xD1, 0x20, 0xD3, 0x21,
+0xD1, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x20, 0xD0, 0xB0, 0xD1, 0x21, 0xD2, 0x23,
+0xD1, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD1, 0x40, 0xDB, 0xB0, 0xDB, 0xB1, 0xD0, 0x20, 0xD3, 0x23,
+0xD1, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x22, 0xD2, 0x20, 0xD0, 0x21, 0xD1, 0x40,
+0xD1, 0x23, 0xD6, 0xB0, 0x40, 0xA0, 0x80, 0x70, 0x04, 0x50, 0xA0, 0x05, 0x50, 0x70, 0x0F, 0x01,
+0x50, 0x00, 0x70, 0x30, 0xA0, 0x80, 0x51, 0x80, 0xA0, 0x10, 0x70, 0x08, 0x50, 0x70, 0x00, 0x90,
+0xC0, 0xA0, 0x02, 0x30, 0x80, 0x00, 0x30, 0x90, 0x80, 0x0F, 0x36, 0x0F, 0x3E, 0xF0, 0xA0, 0xF0,
+0x91, 0x00, 0x70, 0x60, 0x40, 0xD4, 0x20, 0xD0, 0x24, 0xD2, 0x20, 0xD3, 0xB1, 0xD1, 0x22, 0xD1,
+0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD2, 0x22, 0xD0, 0x23, 0xD1,
+0xB1, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD4, 0x40,
+0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x23, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x22,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0xD0,
+0x21, 0xD2, 0x24, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD1, 0xB1, 0xD0, 0x22, 0xD2, 0x20, 0xD0,
+0x21, 0xD1, 0x40, 0x21, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x41, 0xA0, 0x30,
+0x03, 0x60, 0xA0, 0x50, 0x04, 0x31, 0x0F, 0x01, 0x50, 0x30, 0x80, 0x70, 0x04, 0x70, 0xC0, 0xF0,
+0x09, 0x50, 0x30, 0xA0, 0x00, 0xF0, 0xA0, 0x00, 0x30, 0x90, 0x01, 0x80, 0x90, 0x80, 0x0F, 0x36,
+0x0F, 0x3C, 0x50, 0xA0, 0x50, 0x00, 0xA0, 0x30, 0x01, 0xF0, 0x10, 0xC0, 0xB0, 0xD0, 0x20, 0xD1,
+0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x20, 0xD1, 0x24, 0xD2,
+0x20, 0xD2, 0x40, 0xD1, 0x21, 0xD1, 0x25, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0,
+0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x24, 0xD2, 0x20, 0x40, 0xD1, 0x20, 0xD1, 0x21,
+0xD0, 0x23, 0xD0, 0x40, 0xD1, 0x23, 0xD2, 0x21, 0xD1, 0xB0, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20,
+0xD2, 0xB0, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0xB0, 0xD0, 0x21, 0xD2, 0x24, 0xD0,
+0xB1, 0xD0, 0x23, 0xD2, 0x22, 0xD0, 0xB1, 0xD0, 0x22, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0,
+0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x25, 0xD1, 0xB0, 0xD1, 0xA0, 0x30, 0xF0, 0x01, 0xA0, 0x00,
+0xC0, 0x04, 0x30, 0xA0, 0x70, 0x0D, 0x50, 0xA0, 0x90, 0x71, 0x06, 0x30, 0xF0, 0x09, 0xA0, 0x10,
+0x30, 0x01, 0x70, 0x10, 0x50, 0x80, 0xC0, 0xA0, 0x00, 0x50, 0x0F, 0x37, 0x0F, 0x3C, 0x80, 0x50,
+0xA0, 0x90, 0x00, 0xA0, 0x50, 0x00, 0x11, 0xF0, 0xA0, 0xE0, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x22,
+0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x23, 0xD1, 0x24, 0xD2, 0x21, 0xD0, 0x40, 0x20, 0xD1, 0x22, 0xD2,
+0x22, 0xD3, 0xB1, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD1, 0xB1, 0xD1, 0x20, 0xD1,
+0x22, 0xD0, 0x20, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0x20, 0xB0, 0xD1, 0x22,
+0xD3, 0x21, 0xD0, 0xB1, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0x40, 0xD0, 0x21, 0xD2, 0x24, 0xD0, 0xB1, 0xD0, 0x22, 0xD3, 0x22, 0xD1,
+0x40, 0xD1, 0x21, 0xD3, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x21, 0xD4, 0x22, 0xD3, 0x40, 0xD1,
+0xB0, 0x60, 0x30, 0xA0, 0x70, 0x00, 0x90, 0x70, 0x03, 0x80, 0x10, 0x90, 0x0D, 0xA0, 0x02, 0x50,
+0xF0, 0x05, 0x81, 0x08, 0x10, 0x90, 0x80, 0x10, 0x90, 0x00, 0xA0, 0x70, 0x50, 0x30, 0x00, 0x90,
+0x10, 0x0F, 0x38, 0x0F, 0x3E, 0x70, 0x60, 0x01, 0x90, 0x11, 0xF0, 0x01, 0x60, 0xA0, 0xD2, 0x20,
+0xD4, 0x23, 0xD1, 0x40, 0xB0, 0xD1, 0x20, 0xD3, 0x25, 0xD0, 0x21, 0xD0, 0xB0, 0x40, 0xD2, 0x23,
+0xD1, 0x22, 0xD3, 0x40, 0xD3, 0x23, 0xD1, 0x22, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD0, 0x20,
+0xD2, 0x40, 0xD2, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x22, 0xD3, 0x21, 0xD0, 0xB1,
+0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x24, 0xD0, 0x20, 0xD2, 0x40, 0xD0,
+0x21, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD3, 0x22, 0xD1, 0x40, 0xD1, 0x23, 0xD1,
+0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xB0,
+0xD2, 0xA0, 0x70, 0x01, 0x70, 0x30, 0x04, 0x30, 0xF0, 0x90, 0x0B, 0x91, 0x03, 0x90, 0x05, 0x70,
+0x80, 0x06, 0x50, 0x10, 0x50, 0x01, 0xA0, 0x10, 0xA0, 0x01, 0x90, 0xE0, 0x01, 0x80, 0xA0, 0x0F,
+0x37, 0x0F, 0x3A, 0x70, 0x50, 0x70, 0x90, 0xC0, 0x91, 0x60, 0x90, 0x50, 0x60, 0x01, 0x80, 0x91,
+0xA0, 0xD8, 0x21, 0xD1, 0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x20, 0xD2, 0x27, 0xD1, 0x40, 0xD0, 0x20,
+0xD1, 0x23, 0xD1, 0x22, 0xD2, 0xB1, 0xD3, 0x23, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x25,
+0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0xB1, 0xD2, 0x21, 0xD3, 0x21,
+0xD0, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x22,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x40, 0xD0, 0x21, 0xD2, 0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x22,
+0xD3, 0x22, 0xD1, 0xB1, 0xD1, 0x26, 0xD0, 0x21, 0xD0, 0xB0, 0x40, 0xD3, 0x22, 0xD0, 0x22, 0xD3,
+0x40, 0xD2, 0xE0, 0x70, 0x02, 0x80, 0x30, 0x05, 0x50, 0xF0, 0x0A, 0x60, 0x04, 0xF0, 0x50, 0x04,
+0x90, 0x50, 0x02, 0xF0, 0x01, 0x80, 0xC0, 0xF0, 0xA0, 0x01, 0x90, 0xA0, 0xF0, 0x80, 0x01, 0xC0,
+0x70, 0x01, 0x60, 0x70, 0x0F, 0x36, 0x0F, 0x39, 0xC1, 0x32, 0x70, 0x00, 0x90, 0x70, 0x30, 0x90,
+0xF0, 0xA0, 0x90, 0x80, 0x01, 0x50, 0xC0, 0xB0, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x21, 0xD0, 0x20,
+0x40, 0xD1, 0x22, 0xD3, 0x22, 0xD1, 0x21, 0xD1, 0xB1, 0xD1, 0x20, 0xD1, 0x28, 0xD1, 0x40, 0xD4,
+0x23, 0xD2, 0x21, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD1, 0xB0, 0xD0,
+0x22, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD3, 0x21, 0xD0, 0x40,
+0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x22, 0xD0, 0x22, 0xD2,
+0x40, 0xD5, 0x22, 0xD3, 0xB0, 0x20, 0xD1, 0x20, 0xD3, 0x22, 0xD1, 0x20, 0xB0, 0xD1, 0x24, 0xD0,
+0x20, 0xD1, 0x20, 0xD1, 0x40, 0xD2, 0x26, 0xD1, 0x21, 0xD0, 0x40, 0x20, 0xD1, 0x40, 0x80, 0x03,
+0x60, 0x06, 0x90, 0x0A, 0xA0, 0x05, 0x50, 0x70, 0x03, 0x90, 0x50, 0x00, 0x70, 0x90, 0x60, 0x30,
+0x10, 0xA0, 0x01, 0x70, 0x30, 0x80, 0x30, 0x00, 0xF0, 0x10, 0x30, 0x00, 0x50, 0xC0, 0xF0, 0x00,
+0xE0, 0x90, 0x0F, 0x36, 0x0F, 0x39, 0xF0, 0xC0, 0x50, 0x05, 0x70, 0x60, 0x01, 0x60, 0x70, 0x01,
+0x80, 0x90, 0xA0, 0xE0, 0xD1, 0x20, 0xD2, 0x20, 0xD1, 0xB1, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20,
+0xD1, 0x21, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD2, 0x26, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x21,
+0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD1, 0x40, 0xD2, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0xB1,
+0xD0, 0x22, 0xD1, 0x22, 0xD3, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD3, 0x20, 0xD1, 0x40, 0xD2, 0x20,
+0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x22, 0xD0, 0x22, 0xD2, 0x40, 0xD5,
+0x22, 0xD3, 0xB1, 0xD0, 0x21, 0xD3, 0x24, 0xD0, 0x40, 0xD1, 0x27, 0xD0, 0x20, 0xD1, 0xB0, 0x20,
+0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x21, 0xD0, 0x20, 0x40, 0xD2, 0x30, 0x02, 0xF0, 0xC0,
+0x06, 0x50, 0x70, 0x09, 0x30, 0x06, 0x90, 0x03, 0x90, 0xA1, 0x30, 0x50, 0x00, 0xC0, 0x90, 0xA0,
+0x02, 0x60, 0x90, 0x02, 0x30, 0xA0, 0x80, 0x00, 0x50, 0x10, 0x61, 0x0F, 0x37, 0x0F, 0x3B, 0x60,
+0x90, 0xF0, 0x50, 0x90, 0x80, 0x30, 0xC0, 0x50, 0x00, 0x50, 0x00, 0x30, 0x91, 0x80, 0x01, 0x80,
+0x60, 0xD2, 0x20, 0xD2, 0xB0, 0x40, 0xD0, 0x22, 0xD0, 0x24, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x40,
+0xB0, 0xD0, 0x21, 0xD2, 0x23, 0xD3, 0x20, 0xD0, 0x40, 0xD2, 0x21, 0xD0, 0x24, 0xD1, 0x20, 0xD0,
+0x20, 0xB0, 0xD2, 0x22, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x22, 0xD1, 0x22, 0xD1, 0x20,
+0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x20, 0xD1, 0x40, 0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20,
+0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD2, 0x40, 0xD4, 0x22, 0xD1, 0x20, 0xD1,
+0xB1, 0xD1, 0x20, 0xD3, 0x24, 0xD0, 0x40, 0xD2, 0x25, 0xD1, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD0,
+0x20, 0xD5, 0x22, 0xD0, 0x40, 0xD0, 0x20, 0xD0, 0xA0, 0x02, 0x91, 0x07, 0x90, 0x08, 0x80, 0x70,
+0x06, 0xF0, 0x90, 0x06, 0x90, 0xC0, 0xF0, 0x00, 0x70, 0x30, 0xF0, 0x60, 0x70, 0x03, 0xA0, 0x00,
+0xC1, 0x70, 0x00, 0x70, 0x0F, 0x38, 0x0F, 0x3C, 0xF0, 0xC1, 0x90, 0x80, 0x90, 0xF0, 0x50, 0xC0,
+0x30, 0xA0, 0x00, 0x80, 0xC0, 0x02, 0x30, 0x40, 0xA0, 0x40, 0xD4, 0x40, 0xD0, 0x22, 0xD1, 0x20,
+0xD0, 0x21, 0xD3, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x23, 0xD4, 0x20,
+0x40, 0xD2, 0x21, 0xD1, 0x23, 0xD3, 0x40, 0xB0, 0xD2, 0x22, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x40,
+0xD1, 0x22, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x21, 0xD1, 0x40,
+0xD2, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD2, 0xB0, 0x20,
+0xD3, 0x22, 0xD1, 0x20, 0xD1, 0x20, 0xB0, 0xD0, 0x21, 0xD3, 0x24, 0xD0, 0xB1, 0xD1, 0x25, 0xD1,
+0x21, 0xD1, 0x40, 0xD0, 0x22, 0xD6, 0x21, 0xD2, 0x40, 0xD1, 0xA0, 0x02, 0xF0, 0x60, 0x07, 0x70,
+0x50, 0x06, 0xF0, 0xA0, 0x08, 0x71, 0x04, 0xA0, 0x31, 0xF0, 0x01, 0x80, 0x60, 0x01, 0x60, 0xF0,
+0x01, 0x30, 0x50, 0x60, 0xC0, 0x70, 0x0F, 0x3A, 0x0F, 0x3D, 0xF0, 0xA0, 0x80, 0x01, 0x50, 0xC0,
+0xF0, 0x00, 0x80, 0x90, 0x00, 0x50, 0xA0, 0xF0, 0x50, 0x80, 0x01, 0xA0, 0xE0, 0xD2, 0x40, 0xD1,
+0x24, 0xD0, 0x23, 0xD2, 0x22, 0xD0, 0x40, 0x20, 0xD3, 0x20, 0xD1, 0x22, 0xD3, 0x20, 0xD0, 0xB0,
+0x20, 0xD2, 0x21, 0xD1, 0x23, 0xD3, 0x40, 0xD2, 0x22, 0xD1, 0x23, 0xD1, 0xB1, 0xD0, 0x23, 0xD1,
+0x22, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x21, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD2, 0xB1, 0xD2, 0x23, 0xD1, 0x20,
+0xD2, 0x40, 0xD6, 0x24, 0xD1, 0x40, 0xD2, 0x24, 0xD1, 0x22, 0xD0, 0xB1, 0x22, 0xD6, 0x22, 0xD1,
+0x40, 0xD1, 0xE0, 0x03, 0x30, 0x90, 0x07, 0x50, 0x03, 0x90, 0xA0, 0x30, 0xC0, 0x30, 0x09, 0x50,
+0x02, 0xF0, 0xC0, 0x90, 0x00, 0xF0, 0xA0, 0x00, 0x80, 0x30, 0x01, 0xF0, 0xC0, 0x60, 0x01, 0xA0,
+0x10, 0xF0, 0x50, 0x90, 0x0F, 0x3A, 0x0F, 0x3F, 0xA0, 0x80, 0x00, 0xC0, 0x70, 0x01, 0x60, 0x70,
+0x00, 0x70, 0x00, 0xA0, 0x60, 0x02, 0x30, 0x80, 0xA0, 0xD0, 0xB1, 0xD2, 0x21, 0xD4, 0x21, 0xD3,
+0x20, 0xD0, 0xB0, 0x40, 0xD3, 0x21, 0xD1, 0x22, 0xD4, 0x20, 0x40, 0xD0, 0x20, 0xD1, 0x21, 0xD1,
+0x23, 0xD2, 0xB1, 0xD1, 0x22, 0xD2, 0x23, 0xD1, 0xB0, 0x20, 0xD0, 0x23, 0xD1, 0x22, 0xD0, 0x20,
+0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20,
+0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD0, 0xB1, 0xD2, 0x23, 0xD1, 0x22, 0xD0,
+0x40, 0xD1, 0x20, 0xD3, 0x23, 0xD0, 0x20, 0xD0, 0x40, 0xD3, 0x22, 0xD2, 0x22, 0xD1, 0x40, 0xD0,
+0x20, 0xD6, 0x23, 0xD1, 0xB1, 0xD0, 0xA0, 0x04, 0xA0, 0x04, 0x90, 0x30, 0x00, 0x50, 0x81, 0x00,
+0x30, 0x90, 0x02, 0x31, 0x09, 0x90, 0x00, 0x80, 0xC0, 0xA0, 0x02, 0x50, 0x10, 0x50, 0x02, 0x90,
+0x81, 0xA0, 0x00, 0xF0, 0x0F, 0x3E, 0x0F, 0x41, 0x90, 0x80, 0x01, 0x31, 0x00, 0x30, 0x80, 0x50,
+0x00, 0x90, 0x30, 0x00, 0x91, 0x00, 0x70, 0x60, 0xE0, 0xD5, 0x22, 0xD1, 0x22, 0xD1, 0x20, 0xD1,
+0x40, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x24, 0xD4, 0x40, 0xB0, 0xD0, 0x20, 0xD1, 0x21, 0xD2, 0x23,
+0xD1, 0x40, 0x20, 0xD1, 0x22, 0xD2, 0x23, 0xD1, 0x40, 0xD1, 0x23, 0xD1, 0x22, 0xD2, 0x40, 0xD1,
+0x22, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x24, 0xD0, 0x20, 0xD0, 0x20, 0xB0, 0xD2, 0x23, 0xD2, 0x21, 0xD0, 0x40, 0xD1, 0x20, 0xD1,
+0x25, 0xD2, 0xB1, 0xD2, 0x22, 0xD2, 0x22, 0xD1, 0x40, 0x20, 0xD1, 0x22, 0xD2, 0x22, 0xD3, 0x40,
+0xD0, 0x60, 0x04, 0x80, 0x50, 0x02, 0x50, 0xC0, 0x70, 0x30, 0x92, 0xA0, 0x30, 0x04, 0x81, 0x08,
+0x70, 0xC0, 0x30, 0x01, 0x60, 0x00, 0x50, 0xA0, 0x07, 0xA0, 0x80, 0x0F, 0x3F, 0x0F, 0x41, 0x90,
+0x30, 0x00, 0x80, 0xC0, 0x01, 0x30, 0x90, 0x50, 0x01, 0x50, 0x60, 0xA0, 0x02, 0x30, 0xE0, 0xA0,
+0xD4, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x22,
+0xD0, 0x20, 0xD4, 0x40, 0xD1, 0x24, 0xD4, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD2, 0x23,
+0xD1, 0x40, 0xD2, 0x22, 0xD1, 0x22, 0xD2, 0x40, 0xD0, 0x23, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x20,
+0xD1, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x40, 0xD3,
+0x22, 0xD2, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x24, 0xD3, 0xB1, 0xD2, 0x22, 0xD2, 0x22, 0xD1,
+0xB1, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x23, 0xD0, 0x20, 0xD0, 0xB1, 0xA0, 0x04, 0x70, 0x30, 0x01,
+0x50, 0x30, 0xF0, 0x03, 0x50, 0xC0, 0x50, 0x05, 0x90, 0xA0, 0x90, 0x05, 0x90, 0xC0, 0xA0, 0x70,
+0x01, 0x50, 0xC0, 0x80, 0x09, 0xC0, 0x90, 0x0F, 0x3E, 0x0F, 0x42, 0x80, 0xC0, 0xA0, 0x02, 0xF0,
+0x50, 0x04, 0x30, 0x90, 0x00, 0x80, 0x90, 0x00, 0x50, 0x60, 0x40, 0xD1, 0x20, 0xD0, 0x27, 0xD2,
+0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD1, 0x21, 0xD2, 0x20, 0xD2, 0xB1, 0xD1, 0x24, 0xD4, 0x21, 0xD0,
+0xB1, 0xD1, 0x23, 0xD2, 0x23, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x22, 0xD2, 0x40, 0xD0,
+0x22, 0xD2, 0x24, 0xD0, 0xB0, 0x40, 0xD0, 0x21, 0xD0, 0x23, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x24, 0xD3, 0x40, 0xD3, 0x22, 0xD1, 0x22, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1,
+0x20, 0xD2, 0x21, 0x40, 0xD2, 0x21, 0xD7, 0x21, 0x40, 0xD1, 0x22, 0xD2, 0x22, 0xD1, 0x20, 0xD1,
+0x40, 0xE0, 0x05, 0xA0, 0x00, 0x70, 0xA0, 0x05, 0x71, 0x08, 0x90, 0x60, 0xA0, 0x31, 0x50, 0xA1,
+0x01, 0xA0, 0x01, 0xA0, 0x50, 0x0A, 0xF0, 0x70, 0x0F, 0x3E, 0x0F, 0x50, 0x80, 0xA0, 0x30, 0x02,
+0xA0, 0xE0, 0xA0, 0xD3, 0x20, 0xD0, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xB0, 0xD3, 0x21, 0xD1, 0x21,
+0xD1, 0x22, 0xD1, 0x40, 0xD2, 0x24, 0xD4, 0x21, 0xD0, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD2, 0x22,
+0xD1, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x21, 0xD2, 0x24, 0xD0, 0xB1,
+0xD0, 0x26, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD3, 0x40, 0xD2, 0x23, 0xD1,
+0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD3, 0x21, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD2, 0x21, 0xD2,
+0x20, 0xD2, 0x21, 0xD0, 0x40, 0xD1, 0x22, 0xD2, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0x50, 0x05, 0x31,
+0x60, 0x80, 0x06, 0x90, 0x0C, 0x50, 0x10, 0xA0, 0x70, 0x01, 0x70, 0xA1, 0x0F, 0x4D, 0x0F, 0x51,
+0x70, 0xA0, 0x90, 0x00, 0x30, 0x70, 0x00, 0x70, 0x60, 0x40, 0xD2, 0xE0, 0xD1, 0x22, 0xD0, 0x20,
+0x40, 0xD8, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0xB1, 0xD3, 0x24, 0xD2, 0x21, 0xD1, 0x40, 0xD1,
+0x24, 0xD1, 0x22, 0xD2, 0x40, 0xD1, 0x21, 0xD1, 0x25, 0xD1, 0xB0, 0x20, 0xD1, 0x22, 0xD0, 0x22,
+0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x23, 0xD2, 0x20, 0xD2, 0x40, 0xD2, 0x21, 0xD2,
+0x23, 0xD1, 0xB1, 0x20, 0xD4, 0x21, 0xD2, 0x21, 0xD1, 0xB0, 0xD0, 0x22, 0xD2, 0x23, 0xD3, 0x40,
+0x80, 0x07, 0x90, 0x50, 0x06, 0xF0, 0x50, 0x0A, 0xA0, 0x60, 0x01, 0xA0, 0x01, 0x30, 0x90, 0x0F,
+0x4E, 0x0F, 0x53, 0x80, 0xA0, 0x30, 0x02, 0xA0, 0xE1, 0xD1, 0xB0, 0xD1, 0x21, 0xD1, 0x40, 0x20,
+0xD1, 0x20, 0xD5, 0x20, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD2, 0x21,
+0xD0, 0xB1, 0xD1, 0x22, 0xD2, 0x23, 0xD2, 0xB0, 0xD0, 0x21, 0xD3, 0x24, 0xD1, 0x40, 0xD1, 0x23,
+0xD0, 0x25, 0xD0, 0xB1, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x21, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x40, 0xD2,
+0x21, 0xD2, 0x23, 0xD1, 0xB1, 0xD0, 0x20, 0xD3, 0x21, 0xD2, 0x21, 0xD1, 0x40, 0xD1, 0x21, 0xD3,
+0x21, 0xD0, 0x20, 0xD1, 0xB0, 0x60, 0x50, 0xF0, 0x06, 0x30, 0xF0, 0x07, 0x50, 0xF0, 0x07, 0x90,
+0xC0, 0x30, 0x50, 0x01, 0x70, 0x60, 0xA0, 0xF0, 0x0F, 0x4F, 0x0F, 0x54, 0x70, 0x60, 0x70, 0x00,
+0x30, 0x70, 0x00, 0x50, 0x60, 0x40, 0xD4, 0x20, 0xB1, 0xD1, 0x25, 0xD5, 0x21, 0xD0, 0xB1, 0xD2,
+0x27, 0xD1, 0x21, 0xD0, 0x40, 0xD2, 0x22, 0xD1, 0x24, 0xD1, 0xB1, 0xD0, 0x21, 0xD0, 0x20, 0xD1,
+0x24, 0xD1, 0x40, 0xD1, 0x23, 0xD1, 0x24, 0xD0, 0xB0, 0xD2, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xD2, 0x21, 0xD1, 0x21, 0xD1, 0x20,
+0xD1, 0xB0, 0x20, 0xD1, 0x21, 0xD2, 0x24, 0xD1, 0x40, 0xD0, 0x20, 0xD3, 0x21, 0xD3, 0x20, 0xD1,
+0xB0, 0x20, 0xD0, 0x22, 0xD2, 0x21, 0xD0, 0x21, 0xD0, 0x40, 0xA0, 0x00, 0x90, 0x05, 0xF0, 0xA0,
+0x09, 0x90, 0x06, 0x60, 0xA0, 0x01, 0x60, 0x01, 0x30, 0x80, 0x0F, 0x51, 0x0F, 0x56, 0x30, 0xA0,
+0x80, 0x02, 0xA0, 0x80, 0x60, 0xB0, 0xD3, 0x40, 0xD2, 0x26, 0xD4, 0x21, 0xD0, 0x40, 0xD0, 0x20,
+0xD1, 0x25, 0xD3, 0x20, 0xD0, 0x20, 0x40, 0xD3, 0x21, 0xD1, 0x24, 0xD1, 0x40, 0xD1, 0x21, 0xD0,
+0x20, 0xD1, 0x24, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x24, 0xD0, 0x40, 0xD2, 0x20, 0xD0,
+0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD1, 0x40,
+0xD2, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x20, 0xD2, 0x25, 0xD1, 0x40, 0x20, 0xD4,
+0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x22, 0xD2, 0x24, 0xD0, 0xB0, 0x60, 0x00, 0x50,
+0xF0, 0x02, 0xF0, 0x31, 0x0A, 0x50, 0xF0, 0x03, 0x30, 0xC0, 0x80, 0x90, 0x02, 0xC0, 0xA0, 0x70,
+0x0F, 0x52, 0x0F, 0x57, 0x70, 0xA0, 0x50, 0x00, 0x30, 0xF0, 0x00, 0xF0, 0xC0, 0xA0, 0xD1, 0xB1,
+0xD7, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD1, 0x21,
+0xD0, 0xB0, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0x40, 0xD0, 0x22, 0xD3,
+0x22, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x40, 0xD2,
+0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x21,
+0xD0, 0x40, 0xD2, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0x20, 0xB0, 0xD1, 0x20, 0xD2, 0x25, 0xD1,
+0xB1, 0xD0, 0x21, 0xD2, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x23, 0xD1, 0x40, 0x80,
+0x00, 0xF0, 0x50, 0x01, 0x50, 0xA0, 0xF0, 0x0C, 0x90, 0x01, 0x50, 0x10, 0x80, 0x01, 0xA0, 0x00,
+0xF0, 0x30, 0x80, 0x0F, 0x54, 0x0F, 0x59, 0x80, 0xA0, 0x30, 0x01, 0xF0, 0x30, 0x70, 0x60, 0x40,
+0xB0, 0xD2, 0x20, 0xD4, 0x23, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x21, 0xD1, 0x21, 0xD1, 0x22, 0xD0,
+0x21, 0xD1, 0x40, 0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD3, 0x20, 0xB0, 0xD0, 0x23, 0xD2, 0x21,
+0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xD2, 0x23,
+0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD1, 0x21, 0xD0, 0xB1, 0xD1,
+0x21, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x26, 0xD2, 0x40, 0xD0,
+0x21, 0xD2, 0x22, 0xD0, 0x23, 0xD0, 0xB1, 0xD0, 0x21, 0xD2, 0x23, 0xD1, 0x40, 0x90, 0x01, 0x50,
+0xF0, 0x00, 0x60, 0x0E, 0xF0, 0x50, 0xA1, 0x50, 0x80, 0x01, 0xF0, 0xC0, 0x30, 0x71, 0xF0, 0x0F,
+0x53, 0x0F, 0x5A, 0x70, 0x30, 0x80, 0x00, 0x30, 0x70, 0x00, 0x70, 0x10, 0x60, 0xB0, 0xD0, 0x21,
+0xD2, 0x24, 0xD1, 0x20, 0xD1, 0xB1, 0xD1, 0x21, 0xD4, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0xB1,
+0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x22, 0xD3, 0xB0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD2, 0x21, 0xD3,
+0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x24, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x21,
+0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x24, 0xD0, 0x20, 0xD2, 0x40,
+0xD0, 0x21, 0xD2, 0x27, 0xD1, 0x40, 0xD1, 0x21, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x40, 0x90, 0x01,
+0xF0, 0x50, 0x00, 0x60, 0xF0, 0x0D, 0x30, 0x10, 0xA0, 0x01, 0x30, 0xF1, 0xA0, 0x50, 0x00, 0x91,
+0x30, 0xF0, 0x0F, 0x52, 0x0F, 0x5A, 0xF0, 0x00, 0x50, 0xC0, 0x30, 0x01, 0xA0, 0x10, 0x50, 0xE0,
+0xA0, 0xD4, 0x23, 0xD2, 0x20, 0xD1, 0x40, 0xD5, 0x22, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0xB0, 0x20,
+0xD1, 0x21, 0xD1, 0x20, 0xD0, 0x22, 0xD3, 0x40, 0xD0, 0x21, 0xD1, 0x20, 0xD1, 0x22, 0xD3, 0x40,
+0xD1, 0x21, 0xD0, 0x21, 0xD1, 0x21, 0xD2, 0x20, 0x40, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0xB1, 0xD1, 0x21,
+0xD1, 0x22, 0xD0, 0x22, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0x40,
+0xD0, 0x21, 0xD3, 0x22, 0xD0, 0x23, 0xD0, 0x40, 0xD2, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0xB0,
+0xA0, 0x02, 0x50, 0x00, 0xA0, 0x0C, 0x90, 0x10, 0x50, 0x60, 0x10, 0xF0, 0x00, 0xF0, 0xC0, 0x30,
+0xF0, 0x50, 0x00, 0x90, 0x31, 0x0F, 0x53, 0x0F, 0x59, 0xA0, 0x61, 0x50, 0x00, 0x80, 0x30, 0x50,
+0x10, 0x80, 0x01, 0xA1, 0xE0, 0xD2, 0x24, 0xD1, 0x20, 0xD1, 0x40, 0xD3, 0x26, 0xD2, 0x21, 0xD0,
+0x40, 0xD2, 0x22, 0xD1, 0x23, 0xD2, 0x20, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x21, 0xD1, 0x20,
+0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x22, 0xD2, 0x20, 0xB0, 0xD1, 0x20, 0xD0, 0x22, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0xB0, 0xD0, 0x24,
+0xD0, 0x20, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x22,
+0xD0, 0xB1, 0xD0, 0x21, 0xD1, 0x24, 0xD0, 0x21, 0xD1, 0x20, 0xB0, 0xD1, 0x23, 0xD0, 0x21, 0xD1,
+0xE0, 0x90, 0x02, 0xF0, 0x50, 0x30, 0x0A, 0x90, 0xC1, 0xF0, 0x00, 0xF0, 0x10, 0x60, 0x50, 0xA0,
+0xF1, 0xC0, 0x30, 0xC0, 0xF1, 0x0F, 0x54, 0x0F, 0x59, 0x70, 0x01, 0xC0, 0x01, 0x70, 0xA0, 0x10,
+0x01, 0x70, 0x30, 0x00, 0x50, 0x60, 0xE0, 0xD3, 0x21, 0xD1, 0x20, 0xD0, 0x40, 0xD4, 0x27, 0xD1,
+0x20, 0xD0, 0xB1, 0xD3, 0x22, 0xD1, 0x22, 0xD2, 0xB1, 0xD1, 0x21, 0xD0, 0x20, 0xD2, 0x21, 0xD3,
+0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x23, 0xD1, 0x20,
+0xD2, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x21, 0xD2, 0x40, 0xD0, 0x20,
+0xD2, 0x20, 0xD0, 0x22, 0xD1, 0x20, 0xD2, 0x40, 0xD1, 0x20, 0xD1, 0x21, 0xD0, 0x20, 0xD1, 0xA0,
+0x04, 0x50, 0x30, 0xF0, 0x07, 0x50, 0xC0, 0x30, 0x00, 0xF0, 0x30, 0x01, 0xA0, 0x10, 0x50, 0x01,
+0x30, 0x50, 0x00, 0x50, 0xC0, 0x0F, 0x55, 0x0F, 0x5B, 0x70, 0x10, 0x02, 0xF0, 0x50, 0xA0, 0x50,
+0xA0, 0x02, 0x30, 0x90, 0x60, 0x40, 0xD3, 0x23, 0x40, 0xD2, 0x29, 0xD1, 0x20, 0xD0, 0x40, 0xD1,
+0x20, 0xD1, 0x27, 0xD2, 0xB0, 0x20, 0xD0, 0x25, 0xD0, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD1, 0x21,
+0xD0, 0x22, 0xD2, 0xB1, 0xD1, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0x40, 0xD1,
+0x20, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD2, 0x21, 0xD1, 0x23, 0xD1, 0x20, 0xD1,
+0x40, 0xD1, 0x21, 0xD0, 0x22, 0xD2, 0xA0, 0xF0, 0x03, 0x70, 0x80, 0x06, 0xF0, 0x60, 0xA1, 0x02,
+0x30, 0x70, 0x30, 0x80, 0x00, 0x50, 0x60, 0x00, 0x90, 0x30, 0x01, 0xA0, 0x90, 0x0F, 0x54, 0x0F,
+0x58, 0x90, 0x30, 0xC1, 0x70, 0xF0, 0x60, 0x10, 0x60, 0x01, 0x80, 0xC0, 0x70, 0x00, 0x70, 0x80,
+0x01, 0xE0, 0xC0, 0x40, 0xD2, 0x20, 0xD0, 0xB1, 0xD0, 0x24, 0xD2, 0x23, 0xD2, 0x20, 0x40, 0xD1,
+0x20, 0xD2, 0x23, 0xD0, 0x22, 0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x23, 0xD1,
+0xB1, 0xD0, 0x25, 0xD0, 0x22, 0xD2, 0xB1, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD2, 0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x22,
+0xD1, 0x40, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0xB1, 0xD2, 0x20,
+0xD1, 0x23, 0xD1, 0x21, 0xD0, 0x20, 0xB0, 0xD1, 0x21, 0xD2, 0x20, 0xD1, 0x60, 0x05, 0x30, 0xF0,
+0x03, 0x70, 0x60, 0x10, 0x70, 0x01, 0xA0, 0x01, 0x30, 0x60, 0xF0, 0x00, 0xA1, 0xF0, 0x01, 0x10,
+0x01, 0x70, 0x60, 0x0F, 0x54, 0x0F, 0x56, 0x70, 0x10, 0xA0, 0x70, 0x04, 0x60, 0xF0, 0x03, 0x31,
+0xA0, 0x02, 0x30, 0x00, 0x90, 0xA0, 0xE0, 0xD2, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD7, 0x21, 0xD0,
+0xB1, 0xD1, 0x20, 0xD3, 0x22, 0xD0, 0x22, 0xD1, 0xB0, 0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD0,
+0x23, 0xD1, 0xB1, 0xD0, 0x25, 0xD1, 0x22, 0xD1, 0xB1, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x27, 0xD1, 0x40, 0xD1, 0x22, 0xD0, 0x21, 0xD1, 0x22,
+0xD1, 0x40, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x22, 0xD0, 0x20, 0xB0, 0xD2, 0x20, 0xD0,
+0x23, 0xD2, 0x22, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x40, 0xE0, 0x04, 0xA0,
+0x30, 0x70, 0x01, 0x70, 0x61, 0xF0, 0x80, 0x70, 0x01, 0x80, 0x30, 0xA0, 0x70, 0x02, 0xC0, 0xF0,
+0x90, 0xA0, 0x70, 0x50, 0x60, 0x00, 0xF0, 0x60, 0x0F, 0x54, 0x0F, 0x57, 0x50, 0x60, 0x80, 0xF0,
+0x02, 0x80, 0x30, 0x01, 0x30, 0xC0, 0xA0, 0x00, 0xF0, 0x30, 0x80, 0xF0, 0x50, 0x80, 0x01, 0x50,
+0xA1, 0xE0, 0xB0, 0xD2, 0x24, 0xD5, 0x22, 0xD0, 0x40, 0xD1, 0x22, 0xD2, 0x22, 0xD0, 0x22, 0xD0,
+0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x23, 0xD1, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x23, 0xD1, 0x22,
+0xD1, 0xB0, 0x20, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20,
+0xD0, 0x25, 0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x22, 0xD1, 0xB0, 0x20,
+0xD0, 0x23, 0xD0, 0x22, 0xD0, 0x22, 0xD1, 0x40, 0xD0, 0x21, 0xD1, 0x23, 0xD1, 0x20, 0xD0, 0x21,
+0xD0, 0xB1, 0xD0, 0x20, 0xD0, 0x22, 0xD1, 0x60, 0x70, 0x03, 0x80, 0x50, 0x00, 0x50, 0x70, 0x60,
+0xA1, 0x01, 0xF0, 0x30, 0x00, 0x90, 0xA0, 0x50, 0x00, 0x70, 0xC0, 0x01, 0x90, 0x10, 0x80, 0x50,
+0x10, 0xF0, 0x80, 0x61, 0x70, 0x0F, 0x54, 0x0F, 0x59, 0x30, 0x80, 0x01, 0xF0, 0xC0, 0xF0, 0x00,
+0x31, 0x00, 0x90, 0x80, 0x01, 0x70, 0x30, 0x60, 0xF0, 0x01, 0xA0, 0x01, 0x90, 0xC0, 0xE0, 0xD2,
+0x2B, 0xD0, 0x20, 0xB0, 0xD0, 0x23, 0xD2, 0x22, 0xD0, 0x21, 0xD1, 0x40, 0xD1, 0x20, 0xD1, 0x23,
+0xD1, 0x22, 0xD1, 0x40, 0xD0, 0x21, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD1, 0xB0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x25,
+0xD0, 0x20, 0xD1, 0x40, 0x20, 0xD1, 0x20, 0xD1, 0x20, 0xD2, 0x22, 0xD1, 0xB1, 0xD0, 0x23, 0xD1,
+0x21, 0xD0, 0x23, 0xD0, 0xB0, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x21, 0xD1, 0x22, 0x40,
+0xD2, 0x20, 0xD3, 0xA0, 0x03, 0xF0, 0x30, 0x00, 0x50, 0xC0, 0x60, 0x70, 0x00, 0x80, 0x70, 0x01,
+0x30, 0x60, 0x90, 0x02, 0x30, 0xC0, 0x90, 0x00, 0xF0, 0xA0, 0x01, 0x90, 0x30, 0x00, 0xF0, 0x0F,
+0x56, 0x0F, 0x5D, 0x60, 0x90, 0x00, 0xF0, 0x10, 0x01, 0x50, 0x80, 0xF0, 0x31, 0x00, 0x70, 0xA0,
+0x30, 0x91, 0x01, 0x52, 0xA0, 0xE0, 0xD3, 0x21, 0xD0, 0x22, 0xD1, 0x20, 0xD0, 0xB0, 0xD1, 0x24,
+0xD1, 0x25, 0xD1, 0x40, 0xD4, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x40, 0xD0, 0x21,
+0xD1, 0x20, 0xD0, 0x20, 0xD1, 0x22, 0xD1, 0x40, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x25, 0xD0, 0x20, 0xD1, 0xB0, 0x20, 0xD1,
+0x23, 0xD2, 0x22, 0xD1, 0xB1, 0xD1, 0x22, 0xD1, 0x21, 0xD0, 0x22, 0xD1, 0xB1, 0xD0, 0x20, 0xD0,
+0x21, 0xD0, 0x20, 0xD2, 0x21, 0xD0, 0x20, 0xD1, 0x40, 0xD1, 0x21, 0xD2, 0x40, 0xE0, 0x03, 0x31,
+0xC0, 0x30, 0x70, 0x30, 0x02, 0x30, 0x50, 0xA0, 0x90, 0x04, 0x30, 0xF0, 0xC0, 0x02, 0x70, 0x00,
+0x30, 0x80, 0x0F, 0x58, 0x0F, 0x5D, 0x80, 0x01, 0x30, 0x50, 0x01, 0xC0, 0x71, 0x81, 0x70, 0x01,
+0xF0, 0xA0, 0x30, 0x70, 0x00, 0xA0, 0x02, 0x60, 0x30, 0xA0, 0x40, 0xD3, 0x22, 0xD3, 0x40, 0xD3,
+0x20, 0xD0, 0x22, 0xD0, 0x23, 0xD1, 0xB1, 0xD1, 0x20, 0xC0, 0x20, 0xD0, 0x20, 0xD2, 0x20, 0xD1,
+0x20, 0xD0, 0xB1, 0xD1, 0x25, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x40, 0xD3, 0x23, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x20, 0xD1, 0xB1, 0xD2, 0x22, 0xD2, 0x21,
+0xD3, 0x40, 0xD0, 0x22, 0xD0, 0x27, 0xD2, 0x40, 0xD4, 0x20, 0xD1, 0x23, 0xD3, 0xB1, 0xD0, 0x23,
+0xD0, 0xA0, 0xF0, 0x01, 0xF0, 0xC0, 0x10, 0x30, 0x90, 0x01, 0x90, 0x50, 0x00, 0x90, 0xA0, 0x90,
+0x08, 0x80, 0x30, 0x00, 0xF0, 0xC1, 0x30, 0x0F, 0x59, 0x0F, 0x60, 0xC0, 0xF0, 0x00, 0x90, 0xA0,
+0x01, 0x51, 0x04, 0x70, 0x30, 0xA0, 0x30, 0x01, 0x91, 0x00, 0xF0, 0xA1, 0xE0, 0xB0, 0xD6, 0xB1,
+0xD1, 0x23, 0xD2, 0x20, 0xD0, 0x22, 0xD1, 0xB1, 0xD1, 0x20, 0xB0, 0xD1, 0x21, 0xD1, 0x20, 0xD0,
+0x21, 0xD0, 0xB1, 0xD1, 0x27, 0xD0, 0x22, 0xD0, 0x40, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x23, 0xD2, 0x21, 0xD0, 0xB1, 0xD2, 0x22, 0xD1, 0x22,
+0xD3, 0x40, 0xD0, 0x21, 0xD1, 0x27, 0xD2, 0x40, 0xD3, 0x21, 0xD1, 0x23, 0xD4, 0x40, 0xD0, 0x22,
+0xD1, 0x60, 0x00, 0x50, 0xA0, 0x10, 0x50, 0x01, 0xA0, 0x01, 0xF0, 0xC0, 0x30, 0x50, 0x0B, 0xC0,
+0x70, 0x01, 0xF0, 0x0F, 0x5A, 0x0F, 0x60, 0x80, 0x30, 0x80, 0xC0, 0x0B, 0x70, 0x31, 0xF0, 0xA0,
+0x02, 0x30, 0x00, 0x90, 0xA1, 0xB0, 0xD4, 0x40, 0x20, 0xD2, 0x21, 0xD1, 0x20, 0xD4, 0x20, 0xD1,
+0x40, 0xD1, 0x21, 0xD1, 0x28, 0xD0, 0xB0, 0xD2, 0x27, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x20, 0xD1,
+0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x22, 0xD0, 0xB1,
+0xD2, 0x2A, 0xD0, 0x40, 0xD0, 0x22, 0xD0, 0x27, 0xD2, 0x40, 0x20, 0xD1, 0x28, 0xD0, 0x21, 0xD1,
+0x40, 0x20, 0xD3, 0xE0, 0xC1, 0x30, 0x70, 0x90, 0x50, 0x01, 0x80, 0x70, 0x90, 0x30, 0x50, 0x0D,
+0x50, 0x90, 0x0F, 0x5D, 0x0F, 0x61, 0x50, 0x90, 0x0E, 0xF0, 0x30, 0x60, 0x90, 0x00, 0x50, 0x90,
+0x01, 0x91, 0xE0, 0x60, 0xE0, 0xD2, 0x40, 0xD0, 0x20, 0xD0, 0x22, 0xD2, 0x20, 0xD1, 0x20, 0xD3,
+0x40, 0xD0, 0x22, 0xD1, 0x21, 0xD0, 0x25, 0xD0, 0x40, 0xD2, 0x21, 0xD2, 0x22, 0xD0, 0x21, 0xD1,
+0x40, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24,
+0xD0, 0x22, 0xD0, 0xB1, 0xD1, 0x2B, 0xD0, 0xB1, 0xD0, 0x21, 0xD0, 0x21, 0xD2, 0x22, 0xD2, 0xB1,
+0xD2, 0x25, 0xD1, 0x22, 0xD1, 0xB1, 0xD1, 0x40, 0xA0, 0x60, 0x90, 0xA0, 0x02, 0xA0, 0x00, 0xF0,
+0xA0, 0x60, 0x50, 0x0F, 0x6F, 0x0F, 0x75, 0x90, 0xA0, 0xC0, 0x70, 0x01, 0xA0, 0x01, 0x70, 0xA2,
+0x80, 0xB0, 0xD2, 0x22, 0xD1, 0x21, 0xD0, 0x20, 0xD4, 0xB0, 0xD0, 0x22, 0xD2, 0x20, 0xD1, 0x24,
+0xD0, 0x40, 0xD8, 0x21, 0xD0, 0x21, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20,
+0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x21, 0xD1, 0x20, 0xB0, 0xD1, 0x23, 0xD0, 0x23,
+0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x21, 0xD9, 0x40, 0xD2, 0x20, 0xD0, 0x21, 0xD2, 0x24,
+0xD1, 0x40, 0xE0, 0xA1, 0x80, 0x01, 0x90, 0x50, 0x01, 0xA0, 0x60, 0x30, 0x0F, 0x72, 0x0F, 0x77,
+0x70, 0x31, 0x80, 0x50, 0x01, 0x80, 0x70, 0x00, 0x50, 0x10, 0x60, 0xE0, 0x40, 0xD3, 0x20, 0xD0,
+0x23, 0xD3, 0xB0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD2, 0x23, 0xD0, 0x40, 0xD8, 0x21,
+0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD2, 0x20, 0x40, 0xD1, 0x22, 0xD1, 0x22, 0xD2, 0x20, 0xD1, 0xB0,
+0xD0, 0x20, 0xD6, 0x21, 0xD4, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD4, 0xB0, 0xE0, 0xA0, 0x10, 0x60,
+0x01, 0x30, 0x02, 0xA0, 0x90, 0xA0, 0x50, 0x0F, 0x74, 0x0F, 0x79, 0xF0, 0x80, 0xA0, 0x90, 0x00,
+0xA0, 0x01, 0x30, 0x10, 0xF0, 0x70, 0xA0, 0x60, 0xE0, 0xB0, 0xD3, 0x21, 0xD0, 0x22, 0xD0, 0x40,
+0xD3, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD1, 0x20, 0xD2, 0xB1, 0xD2, 0x21, 0xD1, 0x23, 0xD1, 0x20,
+0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0,
+0x24, 0xD0, 0x20, 0xD3, 0x40, 0xD1, 0x22, 0xD1, 0x22, 0xD2, 0x20, 0xD1, 0x40, 0xD0, 0x20, 0xD0,
+0x20, 0xD0, 0x20, 0xD0, 0x24, 0xD1, 0x20, 0xD0, 0xB0, 0x20, 0xD0, 0x20, 0xD7, 0xB0, 0x40, 0xA0,
+0xC0, 0x50, 0x00, 0xA0, 0x10, 0x01, 0x51, 0xF0, 0x31, 0x50, 0x00, 0x70, 0x0F, 0x74, 0x0F, 0x7C,
+0x50, 0xA0, 0xC0, 0x50, 0x00, 0x10, 0x60, 0x01, 0x30, 0x00, 0x50, 0xE0, 0xC0, 0xA0, 0x40, 0xD3,
+0x21, 0xD0, 0x20, 0x40, 0xD1, 0x22, 0xD1, 0x23, 0xD2, 0x20, 0xD0, 0xB0, 0x20, 0xD1, 0x22, 0xD0,
+0x22, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2,
+0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x24, 0xD0, 0x20, 0xD3, 0x40, 0xD1, 0x22, 0xD0, 0x20, 0xD0, 0x20,
+0xD3, 0x20, 0xD1, 0x40, 0xD2, 0x28, 0xD0, 0x21, 0xD0, 0xB1, 0xD7, 0xE0, 0x60, 0xA0, 0x90, 0x00,
+0x30, 0x01, 0x50, 0x10, 0x50, 0x00, 0x30, 0xC0, 0x80, 0x02, 0x80, 0x90, 0x30, 0x0F, 0x73, 0x0F,
+0x7A, 0x30, 0x60, 0x90, 0x01, 0x90, 0xA0, 0x10, 0x80, 0x01, 0x30, 0x01, 0x70, 0x80, 0xF0, 0x80,
+0xC0, 0xA0, 0xE0, 0xD3, 0x20, 0xB0, 0xD1, 0x23, 0xD1, 0x20, 0xD3, 0x21, 0xD0, 0x40, 0xD1, 0x21,
+0xD0, 0x21, 0xD0, 0x21, 0xD0, 0x20, 0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x20, 0xD3, 0x20,
+0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x25, 0xD4, 0x40, 0xD1, 0x23, 0xD0, 0x20, 0xD4,
+0x21, 0xD0, 0x40, 0xD1, 0x21, 0xD0, 0x21, 0xD0, 0x22, 0xD0, 0x21, 0xD2, 0x40, 0xD3, 0x40, 0xE0,
+0xC0, 0xA0, 0x50, 0x00, 0x30, 0x01, 0x70, 0x80, 0x00, 0xF0, 0x10, 0xC0, 0x30, 0x70, 0x00, 0x70,
+0x60, 0xA0, 0x00, 0x90, 0x81, 0x0F, 0x73, 0x0F, 0x79, 0x90, 0x80, 0x00, 0x30, 0x90, 0x01, 0xF0,
+0x00, 0x80, 0x31, 0x80, 0x01, 0x30, 0xF0, 0x01, 0x30, 0xF0, 0x90, 0x60, 0xA0, 0xE0, 0xB0, 0x40,
+0xD3, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0, 0x20, 0xD0, 0x40, 0xD2, 0x20, 0xD2, 0x24,
+0xD1, 0x20, 0xD0, 0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x25, 0xD0, 0x20, 0xD2, 0x21, 0xD0,
+0xB1, 0xD2, 0x24, 0xD0, 0x20, 0xD5, 0x40, 0xB0, 0x40, 0xE0, 0xC0, 0xE0, 0x70, 0x80, 0x70, 0x01,
+0x30, 0x02, 0x60, 0x31, 0x70, 0xF0, 0x02, 0xC0, 0xF0, 0x90, 0x60, 0x00, 0x70, 0xF0, 0x0F, 0x73,
+0x0F, 0x7C, 0x81, 0xF0, 0x61, 0x90, 0x01, 0x70, 0x80, 0xA0, 0x90, 0xA0, 0x01, 0x70, 0x80, 0x01,
+0x91, 0x50, 0x80, 0xC0, 0xA0, 0x40, 0xD7, 0x21, 0xD0, 0x21, 0xD1, 0x40, 0xD0, 0x21, 0xD0, 0x21,
+0xD1, 0x23, 0xD1, 0x20, 0xD0, 0x40, 0xD7, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1,
+0x20, 0xD0, 0x22, 0xD0, 0x22, 0xD3, 0x40, 0xD1, 0x20, 0xD2, 0x20, 0xD0, 0x20, 0xD2, 0x22, 0xD0,
+0xB1, 0xD0, 0x22, 0xD0, 0x23, 0xD4, 0x40, 0xE0, 0xC0, 0xA0, 0x90, 0x70, 0x30, 0x01, 0xF0, 0x30,
+0x01, 0x90, 0x80, 0x31, 0x90, 0xF0, 0x00, 0x50, 0x60, 0xC0, 0x90, 0xF0, 0x60, 0x01, 0x60, 0x50,
+0x0F, 0x75, 0x0F, 0x7B, 0x80, 0x10, 0xF0, 0xC0, 0x70, 0x00, 0xC0, 0xF0, 0x00, 0xF0, 0x70, 0x00,
+0x50, 0x80, 0xA0, 0x80, 0x30, 0x70, 0x01, 0xA0, 0x01, 0xF0, 0x80, 0x00, 0x90, 0x62, 0x40, 0xD8,
+0x20, 0xD0, 0x40, 0xD1, 0x21, 0xD1, 0x20, 0xD1, 0x22, 0xD0, 0x21, 0xD0, 0x40, 0xD1, 0x26, 0xD0,
+0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x26, 0xD3, 0xB1, 0xD0, 0x22, 0xD0, 0x24,
+0xD1, 0x21, 0xD1, 0x40, 0xD9, 0xB0, 0xA0, 0x60, 0xC0, 0x80, 0x71, 0x90, 0x01, 0x80, 0x70, 0x01,
+0x30, 0x90, 0xA0, 0x30, 0x90, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0xC0, 0x01, 0xF0, 0x00, 0x10, 0x01,
+0x90, 0x30, 0x0F, 0x75, 0x0F, 0x78, 0xF0, 0xA0, 0xC0, 0x80, 0x00, 0x90, 0x30, 0x01, 0x60, 0xF0,
+0x80, 0xC0, 0xA1, 0x02, 0xF0, 0x80, 0xA0, 0x30, 0x90, 0x80, 0x01, 0x90, 0x50, 0x01, 0xE0, 0x01,
+0x90, 0xC0, 0xA1, 0xE0, 0x40, 0xB0, 0xD4, 0xB0, 0xD1, 0x23, 0xD0, 0x24, 0xD1, 0x20, 0xD0, 0x40,
+0xD1, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x20, 0xD2,
+0x22, 0xD1, 0x20, 0xD0, 0xB1, 0xD2, 0x20, 0xD0, 0x24, 0xD1, 0x20, 0xD2, 0x40, 0xD4, 0x40, 0xE0,
+0xA1, 0x61, 0xF0, 0x00, 0x80, 0xF0, 0x01, 0xA0, 0x01, 0x70, 0x30, 0x90, 0xA0, 0x30, 0x50, 0x03,
+0x80, 0x60, 0x00, 0xF0, 0x60, 0x50, 0xC0, 0x60, 0xF0, 0x30, 0x90, 0x00, 0xF0, 0xC0, 0x0F, 0x75,
+0x0F, 0x77, 0xF0, 0x10, 0xA0, 0xF0, 0x01, 0xA0, 0x50, 0x01, 0xC0, 0xF0, 0xC0, 0x01, 0x60, 0xF0,
+0x90, 0x30, 0x90, 0x01, 0x70, 0x90, 0xA0, 0x30, 0x90, 0x30, 0x70, 0x01, 0xA0, 0x01, 0x50, 0x90,
+0x01, 0xA0, 0x90, 0xE0, 0xA0, 0x60, 0xE0, 0x41, 0xB0, 0xD8, 0x20, 0xD0, 0x20, 0xD0, 0x21, 0xD0,
+0x40, 0xD1, 0x20, 0xD1, 0x23, 0xD0, 0x20, 0xD0, 0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x22,
+0xD0, 0x22, 0xD1, 0x20, 0xD0, 0xB1, 0xD0, 0x22, 0xD1, 0x21, 0xD7, 0x41, 0xE1, 0x60, 0xA0, 0x90,
+0x60, 0x70, 0x01, 0x80, 0x01, 0x50, 0x90, 0x01, 0x30, 0x90, 0x80, 0xA0, 0x80, 0x70, 0x05, 0x70,
+0x60, 0xC0, 0xF0, 0x00, 0xC0, 0xA0, 0x00, 0x50, 0x60, 0xF0, 0xC0, 0xF0, 0x50, 0xA0, 0x0F, 0x75,
+0x0F, 0x78, 0x70, 0x80, 0xC0, 0x30, 0x00, 0xC0, 0xF0, 0x00, 0x83, 0x01, 0x60, 0xF0, 0x30, 0x00,
+0x30, 0x04, 0xF0, 0x50, 0x80, 0x31, 0x80, 0x30, 0x01, 0x30, 0x02, 0x30, 0x01, 0x70, 0xE0, 0x70,
+0x80, 0x10, 0x61, 0xA0, 0xE0, 0x40, 0xB0, 0xD7, 0x21, 0xD0, 0x40, 0xD4, 0x23, 0xD0, 0x20, 0xD0,
+0x20, 0xD2, 0xB0, 0x20, 0xD1, 0x20, 0xD0, 0x21, 0xD0, 0x23, 0xD1, 0x20, 0xD1, 0xB0, 0xD0, 0x20,
+0xD7, 0xB1, 0x40, 0xE0, 0xA1, 0x10, 0x60, 0x50, 0x70, 0x30, 0x01, 0x90, 0x50, 0x01, 0xA0, 0x01,
+0x70, 0xA0, 0x80, 0xA0, 0x80, 0x90, 0x70, 0x08, 0x71, 0x81, 0x00, 0x80, 0x30, 0x01, 0xC0, 0x00,
+0x90, 0xC0, 0x60, 0xF0, 0x0F, 0x75, 0x0F, 0x7B, 0x70, 0x00, 0x30, 0x80, 0x50, 0x10, 0x00, 0x60,
+0x70, 0x00, 0x70, 0x60, 0x00, 0x70, 0x30, 0x70, 0x09, 0x50, 0x32, 0xC0, 0xF0, 0x01, 0x30, 0x01,
+0x90, 0x50, 0x00, 0x70, 0x10, 0x50, 0x00, 0x50, 0xE0, 0x90, 0xE0, 0x60, 0xA0, 0x60, 0xA0, 0xE1,
+0x40, 0xD3, 0x40, 0xDF, 0x00, 0xB0, 0xDF, 0x01, 0xB0, 0xD2, 0xB0, 0x40, 0xE1, 0x60, 0xA0, 0x60,
+0x30, 0x80, 0x50, 0x60, 0x01, 0x10, 0x60, 0x01, 0x30, 0x02, 0x30, 0x01, 0x31, 0xA0, 0x30, 0x90,
+0x70, 0x0E, 0xF0, 0x60, 0x01, 0x10, 0x50, 0x90, 0x60, 0x0F, 0x7A, 0x0F, 0x7E, 0x80, 0x30, 0xF0,
+0x00, 0x60, 0xF0, 0x00, 0x60, 0x50, 0x0F, 0x02, 0x70, 0x30, 0xA2, 0x90, 0x70, 0xA0, 0x01, 0x80,
+0x10, 0x01, 0x90, 0x50, 0x01, 0xA0, 0x01, 0x50, 0x80, 0x50, 0x90, 0xC0, 0xA2, 0x60, 0xA1, 0xE3,
+0x80, 0x41, 0xB5, 0xD0, 0xB7, 0x41, 0xE4, 0xA2, 0x60, 0xA1, 0x60, 0x30, 0x90, 0x50, 0x30, 0x01,
+0x90, 0x70, 0x01, 0x30, 0x01, 0xA0, 0x10, 0x01, 0x30, 0x70, 0x50, 0x80, 0xC0, 0xA0, 0x30, 0x50,
+0x0F, 0x05, 0x60, 0x70, 0x01, 0x30, 0x80, 0x0F, 0x7B, 0x0F, 0x82, 0x90, 0xA2, 0x0F, 0x07, 0xF0,
+0x50, 0x80, 0xA0, 0x30, 0x90, 0x60, 0x10, 0xF0, 0x00, 0x80, 0xF0, 0x01, 0x30, 0x01, 0x90, 0x70,
+0x01, 0x30, 0x01, 0x50, 0x90, 0xF1, 0xA0, 0xF0, 0x70, 0x90, 0xA0, 0x91, 0x60, 0xE1, 0xA0, 0x60,
+0xE0, 0xA0, 0xC0, 0x60, 0x30, 0xA0, 0x60, 0xE1, 0x60, 0x80, 0x90, 0x50, 0x60, 0x70, 0xF0, 0x30,
+0x70, 0xF1, 0x30, 0x01, 0x51, 0x01, 0xA0, 0x01, 0x50, 0x90, 0x01, 0x30, 0xF0, 0x00, 0x30, 0x10,
+0x81, 0x60, 0x80, 0x50, 0xF0, 0x01, 0xF0, 0x50, 0x0F, 0x05, 0x90, 0x80, 0x0F, 0x7F, 0x0F, 0x83,
+0x70, 0x50, 0x0F, 0x0A, 0xF0, 0x01, 0x70, 0x50, 0x90, 0x80, 0x30, 0xC0, 0x30, 0x91, 0x30, 0x01,
+0x80, 0xF0, 0x01, 0xA0, 0x01, 0x90, 0x50, 0x01, 0xA0, 0x01, 0x70, 0x80, 0x01, 0x30, 0x01, 0x70,
+0x90, 0x01, 0x10, 0x80, 0x00, 0xF0, 0x80, 0x01, 0x80, 0xF0, 0x01, 0xA0, 0x01, 0x80, 0x70, 0x01,
+0x30, 0x01, 0x50, 0x90, 0x01, 0x30, 0x01, 0x50, 0x30, 0x50, 0x80, 0x60, 0xA0, 0x30, 0x90, 0x50,
+0x70, 0xF0, 0x00, 0x50, 0xA1, 0x00, 0x70, 0x80, 0x90, 0x50, 0x0F, 0x95, 0x0F, 0x9D, 0x50, 0x10,
+0x80, 0x01, 0x61, 0x30, 0x03, 0x70, 0x81, 0x31, 0xC0, 0xA0, 0x30, 0x90, 0x60, 0xF0, 0x00, 0x80,
+0xF0, 0x01, 0x30, 0x01, 0x70, 0x90, 0x01, 0xA0, 0x01, 0x70, 0x90, 0x00, 0xF0, 0x10, 0x80, 0x00,
+0xF0, 0x80, 0x01, 0x80, 0xF0, 0x01, 0x30, 0x01, 0x90, 0x50, 0x01, 0x30, 0x00, 0xF0, 0x90, 0xA0,
+0x80, 0x30, 0xC0, 0xA0, 0x31, 0x80, 0x90, 0x70, 0x02, 0x50, 0x80, 0xA0, 0x30, 0x00, 0xC0, 0x00,
+0x90, 0xA0, 0xF0, 0x30, 0xA0, 0x70, 0x0F, 0x95, 0x0F, 0x9C, 0x70, 0x30, 0xA0, 0x70, 0x00, 0xA0,
+0x90, 0x00, 0x81, 0x00, 0x30, 0x60, 0x80, 0x01, 0x90, 0x70, 0x01, 0xF0, 0x70, 0x50, 0x80, 0x30,
+0xA0, 0x32, 0x60, 0x30, 0x80, 0xA1, 0x80, 0x90, 0xC0, 0x51, 0x90, 0x30, 0x70, 0x50, 0x10, 0xA0,
+0x70, 0x50, 0xA0, 0x70, 0x50, 0xA0, 0x82, 0xC0, 0x80, 0x30, 0xA1, 0x30, 0xA2, 0x30, 0x90, 0x50,
+0x70, 0x06, 0x80, 0xA0, 0x00, 0x90, 0x30, 0x50, 0x30, 0x90, 0x70, 0xA0, 0x01, 0x10, 0x0F, 0x99,
+0x0F, 0x9E, 0x60, 0xF0, 0x00, 0xC0, 0xF0, 0x00, 0x90, 0x30, 0x80, 0x30, 0x00, 0x60, 0x70, 0x90,
+0x50, 0x30, 0x0A, 0xF3, 0x71, 0x51, 0x9B, 0x52, 0x70, 0xF4, 0x0E, 0x50, 0xC0, 0xA0, 0x03, 0x60,
+0x00, 0x70, 0x60, 0x01, 0x60, 0x70, 0x0F, 0x98, 0x0F, 0x9E, 0xC0, 0x01, 0x80, 0xA0, 0x70, 0xC0,
+0x90, 0x60, 0xF0, 0x00, 0x80, 0x90, 0x70, 0x31, 0x0F, 0x04, 0xF1, 0x01, 0xF0, 0x90, 0x70, 0x02,
+0x90, 0x70, 0x01, 0x50, 0x80, 0x0F, 0x03, 0x90, 0x00, 0xC0, 0xF0, 0x01, 0x50, 0xA0, 0x01, 0xC0,
+0x01, 0xA0, 0x50, 0x0F, 0x98, 0x0F, 0x9D, 0x70, 0x60, 0x01, 0xF0, 0x90, 0x80, 0x60, 0x70, 0xC0,
+0x01, 0x30, 0x90, 0x0F, 0x06, 0xF0, 0x10, 0x90, 0x00, 0xF0, 0x10, 0x90, 0x60, 0x50, 0x00, 0xC0,
+0x80, 0x60, 0x50, 0xF0, 0x80, 0x70, 0x80, 0x0F, 0x04, 0x60, 0x70, 0x01, 0x81, 0x01, 0xA0, 0x90,
+0x00, 0xC0, 0x70, 0x0F, 0x98, 0x0F, 0x9D, 0x90, 0x30, 0x00, 0xF0, 0x10, 0x00, 0x50, 0x60, 0xF0,
+0x60, 0x01, 0xC0, 0xF0, 0x0F, 0x05, 0xF0, 0x60, 0xA0, 0x90, 0x00, 0x50, 0xA0, 0x00, 0x90, 0x80,
+0x50, 0x30, 0x00, 0xF0, 0xC0, 0x00, 0x80, 0x30, 0xF0, 0x0F, 0x04, 0x30, 0x50, 0x01, 0x30, 0x50,
+0x01, 0xF0, 0x60, 0xC0, 0x80, 0x0F, 0x99, 0x0F, 0xA1, 0x50, 0xA0, 0x30, 0xF0, 0x00, 0xC0, 0xF0,
+0x70, 0xC0, 0x0F, 0x08, 0x80, 0x90, 0x01, 0xC0, 0x60, 0xC0, 0xF0, 0x81, 0x00, 0xF0, 0xC0, 0x0F,
+0x08, 0x80, 0x30, 0x01, 0x30, 0x50, 0x0F, 0x9F, 0x0F, 0xA6, 0x90, 0x60, 0xC0, 0x70, 0x0F, 0x08,
+0x30, 0x90, 0x00, 0x90, 0xA0, 0xF0, 0x80, 0x30, 0x90, 0x80, 0x01, 0xC0, 0x0F, 0x08, 0xF0, 0x70,
+0x01, 0xF0, 0x0F, 0xA0, 0x0F, 0xC2, 0x80, 0x90, 0x00, 0x30, 0x50, 0x00, 0xF0, 0xC0, 0x70, 0x30,
+0x00, 0xF0, 0xC0, 0x0F, 0xBD, 0x0F, 0xC2, 0x30, 0x80, 0x00, 0xF0, 0x10, 0x80, 0x60, 0x90, 0x00,
+0x60, 0x30, 0xC0, 0x50, 0x0F, 0xBD, 0x0F, 0xC6, 0xF0, 0x50, 0x70, 0x01, 0xF0, 0x50, 0x70, 0x0F,
+0xBE, 0x0F, 0xFF, 0x0F, 0x8D, 0x0F, 0xFF, 0x0F, 0x8D};
+
+const Map_Image EM29_8000_image = {428, 432, EM29_8000_palette, EM29_8000_rows, EM29_8000_data};
@@ -0,0 +1,4555 @@
+// Generated by maps/compress_map.py from JM29_16000.h, do not edit
+// Image Size : 430x431 pixels, 72040 bytes compressed from 370660
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t JM29_16000_palette[16] PROGMEM = {
+0xFFFF, 0x0021, 0x867C, 0x5B4D, 0x6D16, 0xAD75, 0x21A7, 0xC659,
+0x8451, 0x7DB9, 0x3A8A, 0x53F1, 0xDF1C, 0x9E9C, 0x8E5C, 0x1104};
+
+const uint32_t JM29_16000_rows[431] PROGMEM = {
+0, 13, 17, 21, 30, 43, 57, 83, 111, 147, 186, 228,
+290, 361, 436, 519, 594, 668, 760, 852, 957, 1055, 1146, 1237,
+1331, 1414, 1503, 1596, 1688, 1787, 1898, 2015, 2124, 2233, 2354, 2484,
+2603, 2718, 2832, 2948, 3057, 3165, 3283, 3403, 3515, 3627, 3755, 3883,
+4015, 4157, 4290, 4428, 4569, 4713, 4864, 5020, 5184, 5343, 5504, 5673,
+5832, 5981, 6132, 6286, 6416, 6555, 6690, 6835, 6979, 7121, 7271, 7417,
+7574, 7744, 7906, 8075, 8244, 8417, 8593, 8770, 8952, 9134, 9316, 9511,
+9702, 9905, 10110, 10294, 10467, 10643, 10821, 11003, 11184, 11374, 11555, 11739,
+11920, 12110, 12308, 12510, 12712, 12902, 13122, 13329, 13550, 13761, 13974, 14200,
+14421, 14651, 14873, 15111, 15333, 15541, 15768, 15976, 16189, 16395, 16602, 16825,
+17038, 17259, 17458, 17662, 17864, 18061, 18257, 18467, 18670, 18863, 19080, 19296,
+19504, 19722, 19947, 20185, 20415, 20636, 20857, 21081, 21296, 21527, 21761, 22000,
+22226, 22454, 22694, 22926, 23173, 23419, 23660, 23883, 24103, 24326, 24553, 24773,
+24985, 25206, 25426, 25645, 25866, 26081, 26304, 26524, 26742, 26958, 27175, 27396,
+27607, 27826, 28055, 28286, 28516, 28745, 28978, 29209, 29429, 29665, 29894, 30141,
+30371, 30595, 30821, 31035, 31254, 31470, 31684, 31889, 32090, 32301, 32522, 32732,
+32925, 33133, 33342, 33551, 33754, 33968, 34169, 34357, 34545, 34739, 34940, 35121,
+35310, 35508, 35695, 35890, 36070, 36240, 36476, 36656, 36847, 37112, 37302, 37480,
+37611, 37733, 37904, 38080, 38328, 38493, 38725, 38889, 39058, 39218, 39370, 39520,
+39671, 39811, 39957, 40102, 40250, 40400, 40558, 40716, 40873, 41063, 41252, 41435,
+41616, 41794, 41985, 42169, 42363, 42541, 42733, 42926, 43114, 43306, 43485, 43668,
+43849, 44040, 44238, 44438, 44617, 44819, 45030, 45233, 45431, 45619, 45830, 46054,
+46259, 46470, 46666, 46864, 47064, 47258, 47458, 47651, 47850, 48046, 48223, 48409,
+48606, 48798, 49011, 49214, 49420, 49629, 49844, 50049, 50252, 50455, 50654, 50861,
+51057, 51256, 51456, 51664, 51876, 52089, 52295, 52504, 52735, 52933, 53128, 53331,
+53533, 53726, 53929, 54138, 54322, 54517, 54722, 54934, 55145, 55343, 55530, 55734,
+55929, 56120, 56316, 56520, 56722, 56939, 57158, 57353, 57561, 57778, 58006, 58217,
+58439, 58656, 58879, 59087, 59292, 59498, 59698, 59892, 60074, 60279, 60467, 60644,
+60839, 61027, 61200, 61381, 61570, 61751, 61935, 62125, 62304, 62490, 62682, 62863,
+63052, 63250, 63449, 63632, 63831, 64020, 64203, 64388, 64581, 64759, 64931, 65088,
+65246, 65414, 65576, 65724, 65875, 66026, 66182, 66319, 66470, 66618, 66781, 66938,
+67087, 67223, 67359, 67498, 67635, 67775, 67897, 68025, 68142, 68263, 68364, 68471,
+68563, 68669, 68766, 68861, 68954, 69045, 69128, 69216, 69288, 69363, 69437, 69511,
+69593, 69674, 69762, 69849, 69931, 70015, 70093, 70170, 70247, 70316, 70388, 70465,
+70551, 70642, 70736, 70832, 70937, 71053, 71167, 71267, 71361, 71452, 71528, 71603,
+71674, 71751, 71797, 71837, 71880, 71925, 71967, 71993, 72007, 72023, 72036};
+
+const uint8_t JM29_16000_data[72040] PROGMEM = {
+0x0F, 0xAD, 0x80, 0x10, 0x50, 0x0F, 0x1F, 0x50, 0x0F, 0x0E, 0x50, 0x0F, 0x8F, 0x0F, 0xFF, 0x0F,
+0x8F, 0x0F, 0xFF, 0x0F, 0x8F, 0x0F, 0xC3, 0xC0, 0x50, 0x02, 0x80, 0x70, 0x0F, 0xC4, 0x0F, 0xC2,
+0x50, 0xF0, 0x80, 0xF0, 0x00, 0x80, 0x70, 0x30, 0xC0, 0x0F, 0xC3, 0x0F, 0xA7, 0xC0, 0x31, 0x0F,
+0x08, 0xA0, 0x70, 0x00, 0xA0, 0x71, 0x31, 0x0F, 0xC4, 0x0F, 0x9F, 0xC0, 0x50, 0xC0, 0x00, 0x50,
+0x60, 0xA0, 0x00, 0x70, 0x81, 0xC0, 0x0F, 0x07, 0x60, 0xC0, 0x00, 0x81, 0x00, 0xC0, 0x0F, 0x0E,
+0x70, 0x0F, 0xA6, 0x0F, 0x9E, 0x61, 0x30, 0xC1, 0xF0, 0x00, 0x80, 0xA0, 0x00, 0x51, 0x0F, 0x08,
+0x60, 0xC0, 0x00, 0x81, 0x0F, 0x0E, 0x50, 0xF0, 0x30, 0x01, 0xC0, 0x50, 0xC0, 0x0F, 0xA1, 0x0F,
+0x99, 0x61, 0xF0, 0x70, 0xC0, 0xA0, 0x02, 0x70, 0xA0, 0x01, 0x60, 0xC0, 0x0F, 0x0A, 0xA0, 0x70,
+0x00, 0x30, 0x50, 0x0F, 0x0D, 0xC0, 0x80, 0x30, 0x50, 0x00, 0xC0, 0xF0, 0x80, 0xF0, 0xC1, 0x30,
+0xA0, 0x0F, 0x9D, 0x0F, 0x98, 0x50, 0x30, 0x00, 0x50, 0x30, 0x00, 0xF0, 0xA0, 0x60, 0x30, 0xC0,
+0x60, 0x01, 0xA0, 0x50, 0x0F, 0x0A, 0x50, 0xA0, 0x50, 0x60, 0x0F, 0x10, 0xA0, 0x70, 0x00, 0x30,
+0x50, 0x00, 0x50, 0x80, 0x70, 0x80, 0x30, 0xC0, 0x0F, 0x9C, 0x0F, 0x9A, 0x50, 0xF0, 0x50, 0x00,
+0x80, 0x01, 0x60, 0x50, 0x60, 0x01, 0x30, 0x50, 0x0D, 0xC3, 0x72, 0x52, 0x81, 0x50, 0x30, 0xF0,
+0x80, 0x50, 0x82, 0x52, 0x70, 0xC3, 0x00, 0xC0, 0x0F, 0x02, 0x60, 0x01, 0xF0, 0x01, 0x50, 0x80,
+0x00, 0x71, 0x0F, 0x9D, 0x0F, 0x9A, 0x70, 0x50, 0x10, 0xC0, 0x02, 0x30, 0x50, 0x30, 0x80, 0x00,
+0xA0, 0x70, 0x04, 0xC0, 0x70, 0x50, 0x30, 0xA1, 0x31, 0xA1, 0x81, 0x60, 0x81, 0x50, 0x60, 0x71,
+0xA0, 0x50, 0x70, 0x80, 0x10, 0x50, 0x70, 0x80, 0x30, 0x71, 0x60, 0x50, 0x80, 0x30, 0x60, 0x81,
+0x60, 0x31, 0xA1, 0x30, 0x80, 0x50, 0x70, 0xC0, 0x08, 0xC0, 0x60, 0x01, 0xF0, 0x01, 0x30, 0x80,
+0x0F, 0xA0, 0x0F, 0x99, 0xC0, 0x01, 0x30, 0x50, 0xA0, 0x30, 0x50, 0x60, 0x01, 0xA0, 0x10, 0x60,
+0x80, 0x31, 0xA0, 0xF0, 0x30, 0x80, 0x30, 0x80, 0xC0, 0x00, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x80,
+0x02, 0xA0, 0x01, 0x80, 0xC0, 0x00, 0x50, 0x10, 0xC0, 0x00, 0x70, 0x50, 0x01, 0xA0, 0x01, 0x70,
+0x50, 0x01, 0x80, 0x02, 0x30, 0x00, 0xC0, 0x30, 0x81, 0x30, 0x10, 0x32, 0x80, 0x50, 0xC0, 0x00,
+0x70, 0x30, 0x01, 0xF0, 0x01, 0xF0, 0xC0, 0x0F, 0xA0, 0x0F, 0x83, 0x70, 0x31, 0xC0, 0x0F, 0x02,
+0xA0, 0x80, 0x70, 0x60, 0x00, 0xC0, 0x30, 0xA0, 0x80, 0x31, 0x60, 0x80, 0x70, 0x80, 0x50, 0x01,
+0xA0, 0x01, 0x70, 0x80, 0x01, 0x80, 0xC0, 0x00, 0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0xA0, 0x01,
+0x80, 0xC0, 0x00, 0x50, 0x10, 0xC0, 0x00, 0x70, 0x50, 0x01, 0x30, 0x01, 0x70, 0x50, 0x01, 0x30,
+0x01, 0x70, 0x80, 0x01, 0x30, 0x02, 0xA0, 0x01, 0x80, 0x51, 0x80, 0xF0, 0x31, 0x80, 0x70, 0xA0,
+0x31, 0x80, 0x0F, 0xA1, 0x0F, 0x80, 0x81, 0x00, 0x70, 0x50, 0x30, 0xC0, 0x0F, 0x02, 0xC0, 0x30,
+0x60, 0xA0, 0x60, 0x80, 0x50, 0x10, 0xA0, 0x01, 0x30, 0x01, 0x70, 0x80, 0x01, 0x30, 0x01, 0xC0,
+0x80, 0x01, 0x80, 0x70, 0xC0, 0x70, 0xA0, 0xC0, 0x70, 0xA0, 0x80, 0x40, 0x80, 0x60, 0xB0, 0x30,
+0x60, 0xA0, 0x30, 0xA0, 0x10, 0xA0, 0x30, 0xA1, 0x30, 0xB0, 0x60, 0x41, 0x30, 0xB0, 0x70, 0xC0,
+0xA0, 0xC0, 0x00, 0x51, 0x01, 0x30, 0x02, 0x30, 0x01, 0x30, 0x02, 0x30, 0x01, 0xF0, 0x10, 0x50,
+0xA0, 0x10, 0x80, 0x50, 0xC0, 0x0F, 0x9F, 0x0F, 0x7F, 0x31, 0x80, 0x60, 0x00, 0x50, 0x70, 0x0E,
+0xC0, 0x50, 0x30, 0xA0, 0x60, 0x80, 0x50, 0x00, 0xA0, 0x01, 0x61, 0x01, 0x30, 0x02, 0xB0, 0x01,
+0x30, 0x51, 0x30, 0x60, 0x31, 0x60, 0xA0, 0x33, 0xB1, 0x42, 0x92, 0xE0, 0x90, 0xE1, 0x40, 0xD0,
+0x90, 0xE0, 0x93, 0x41, 0xB2, 0x32, 0xA4, 0xF0, 0x80, 0x51, 0x80, 0x01, 0xA0, 0x01, 0xC0, 0x80,
+0x01, 0x10, 0xA0, 0x01, 0xA0, 0xC0, 0x50, 0x30, 0x60, 0xA0, 0x30, 0x50, 0x0F, 0x06, 0x50, 0x70,
+0x0F, 0x83, 0x0F, 0x7C, 0xF0, 0xC0, 0x00, 0x60, 0x01, 0x30, 0x80, 0x0C, 0xC0, 0x50, 0x32, 0xA0,
+0x01, 0x80, 0x70, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0xA0, 0x50, 0x80, 0x30, 0x60, 0xA2, 0xB0,
+0x41, 0xD0, 0xB1, 0xD0, 0xE0, 0xDA, 0xE4, 0x40, 0xD1, 0xE4, 0xD8, 0x90, 0xE0, 0xD1, 0xE0, 0x40,
+0xB1, 0xA2, 0x60, 0xB0, 0x81, 0xB0, 0x00, 0xC0, 0x10, 0x80, 0x00, 0xC0, 0x80, 0x01, 0x50, 0x70,
+0x01, 0x60, 0x32, 0x50, 0xC0, 0x0F, 0x00, 0xA0, 0x31, 0x60, 0x0F, 0x82, 0x0F, 0x77, 0xC0, 0x02,
+0xC0, 0x10, 0x80, 0x00, 0x60, 0x70, 0x00, 0xC0, 0x60, 0x08, 0xC0, 0x50, 0x80, 0xA0, 0x80, 0x30,
+0x70, 0x01, 0xA0, 0x01, 0x70, 0x80, 0x01, 0x80, 0x51, 0xA0, 0x10, 0xA1, 0x30, 0xB0, 0x40, 0xE1,
+0xD3, 0x20, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x22, 0xE2, 0x22, 0xE2, 0x40, 0xD0, 0xE0,
+0x24, 0xE2, 0x23, 0xE0, 0xD0, 0x90, 0x22, 0xE2, 0xD4, 0x90, 0x40, 0xB0, 0x30, 0xA1, 0x10, 0x30,
+0x70, 0x80, 0x50, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x01, 0x50, 0x80, 0x30, 0xA0, 0x80, 0x50, 0xC0,
+0x0E, 0xA0, 0x70, 0xC0, 0xA0, 0x30, 0x0F, 0x7E, 0x0F, 0x75, 0xC0, 0xA1, 0x60, 0x01, 0x81, 0x60,
+0x00, 0x80, 0x30, 0x01, 0x60, 0x05, 0x70, 0x80, 0xA0, 0x80, 0x50, 0xA0, 0x01, 0x70, 0x80, 0x01,
+0x80, 0xC0, 0x00, 0xC0, 0xA0, 0x80, 0xA1, 0xB1, 0x90, 0x40, 0xE0, 0xD2, 0xE1, 0xD0, 0xE5, 0x20,
+0xE0, 0xD0, 0x91, 0xE0, 0x26, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2B, 0xE0, 0xD0,
+0x40, 0x22, 0xE6, 0xD5, 0x90, 0x41, 0xB0, 0xA2, 0x50, 0xA0, 0xC0, 0x00, 0x70, 0x50, 0x01, 0x30,
+0xC0, 0x01, 0xA0, 0x50, 0x30, 0xA0, 0x80, 0x70, 0x0A, 0x50, 0x60, 0xC0, 0xF0, 0x70, 0x80, 0x30,
+0x00, 0xC1, 0x0F, 0x7A, 0x0F, 0x75, 0x81, 0x00, 0x30, 0x70, 0x00, 0x30, 0x00, 0x60, 0x50, 0xC0,
+0x10, 0x01, 0x60, 0x02, 0x70, 0x31, 0x81, 0x50, 0x01, 0x30, 0x02, 0x30, 0x00, 0xC0, 0x30, 0x60,
+0x30, 0xA0, 0xB0, 0x40, 0xE0, 0xD3, 0x90, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0x22, 0xE4, 0x90, 0xE0,
+0x26, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0xD0,
+0x40, 0x21, 0xE0, 0x22, 0xE4, 0x20, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0xE0, 0xD1, 0x90, 0x40, 0xB0,
+0xA1, 0xF0, 0xB0, 0xC0, 0x00, 0x30, 0x01, 0xC0, 0x30, 0x01, 0x82, 0x31, 0x70, 0x05, 0x80, 0xF0,
+0xA0, 0xC0, 0x80, 0x30, 0x00, 0xC0, 0x60, 0x00, 0x30, 0x80, 0x50, 0x0F, 0x79, 0x0F, 0x75, 0x70,
+0xC0, 0x70, 0x10, 0x80, 0x00, 0x60, 0x80, 0x11, 0xC0, 0x70, 0xF0, 0x60, 0x80, 0x50, 0x30, 0xA0,
+0x80, 0xA0, 0x02, 0x30, 0x01, 0x51, 0x70, 0x80, 0xF0, 0xA1, 0x40, 0xD3, 0xE2, 0x20, 0xE0, 0xD0,
+0x91, 0xE0, 0x21, 0xE1, 0x21, 0xE8, 0x40, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x23, 0xE2, 0x40, 0xD0,
+0xE0, 0x26, 0xE1, 0x20, 0xE2, 0xD0, 0x40, 0xE0, 0x23, 0xE5, 0x20, 0xE0, 0x20, 0xE1, 0x91, 0xE3,
+0xD5, 0x40, 0xA1, 0x60, 0x80, 0xC0, 0x80, 0x70, 0x01, 0xA0, 0x02, 0x30, 0x80, 0x31, 0x50, 0x00,
+0x70, 0x10, 0x80, 0x02, 0xF0, 0xC0, 0x00, 0x70, 0xA0, 0x00, 0x30, 0xB0, 0x50, 0x0F, 0x79, 0x0F,
+0x77, 0x70, 0xC0, 0xA0, 0x30, 0xA0, 0x80, 0xC0, 0x60, 0x01, 0x50, 0x31, 0x81, 0x01, 0x30, 0xC0,
+0x01, 0x30, 0x70, 0x80, 0x30, 0xF0, 0x30, 0x40, 0xD3, 0xE1, 0x26, 0xE0, 0x91, 0xE0, 0x20, 0xE0,
+0x21, 0xE2, 0x21, 0xE5, 0x40, 0xD0, 0x26, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28,
+0xE3, 0xD0, 0x40, 0xE1, 0x25, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x90, 0xE0, 0xD0, 0xE0, 0x27, 0xD3,
+0x40, 0x30, 0xF0, 0xB0, 0x50, 0x70, 0x30, 0x01, 0x51, 0x01, 0x30, 0x80, 0x30, 0xA0, 0x10, 0x60,
+0x80, 0xC1, 0x60, 0x01, 0xA0, 0x50, 0x01, 0xC0, 0x0F, 0x7A, 0x0F, 0x79, 0x70, 0xA0, 0x02, 0x80,
+0x31, 0xA0, 0xC0, 0x01, 0xA0, 0x01, 0xC0, 0x30, 0xC0, 0xB0, 0xF0, 0xB0, 0x40, 0x90, 0x40, 0xD1,
+0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0x22, 0xE2, 0x22, 0xE0, 0x22, 0xE1, 0x40,
+0xE0, 0x21, 0xE0, 0x23, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE2, 0xD0, 0x40,
+0xE0, 0x26, 0xE1, 0x21, 0xE3, 0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0xD2,
+0x91, 0x40, 0x30, 0x60, 0x80, 0xC0, 0x30, 0x02, 0x30, 0x01, 0x70, 0x31, 0xF0, 0x80, 0x00, 0x60,
+0x00, 0x70, 0x60, 0x0F, 0x7E, 0x0F, 0x76, 0x70, 0x60, 0x70, 0xA0, 0x70, 0x00, 0x30, 0x60, 0x10,
+0x70, 0x00, 0x51, 0x01, 0x30, 0xC0, 0x70, 0x30, 0x60, 0x30, 0x40, 0xD3, 0x40, 0xE1, 0x24, 0xE0,
+0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0x20,
+0xD0, 0x40, 0xE0, 0x27, 0xE0, 0x22, 0xE2, 0x40, 0xD0, 0xE0, 0x29, 0xE2, 0xD0, 0x40, 0xE0, 0x27,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x21, 0xE0, 0xD0, 0xE1,
+0x90, 0xD3, 0x40, 0x30, 0x60, 0x30, 0x71, 0x50, 0x01, 0x80, 0x70, 0x00, 0x50, 0x10, 0xA0, 0x62,
+0xC0, 0x0F, 0x7E, 0x0F, 0x77, 0x70, 0xA2, 0x30, 0x00, 0x70, 0x10, 0x50, 0x01, 0x30, 0x00, 0x80,
+0xA0, 0x60, 0xB0, 0xE0, 0xD1, 0xE4, 0x91, 0xE1, 0x21, 0xE8, 0x20, 0xE1, 0x40, 0xE1, 0x22, 0xE0,
+0x27, 0xE0, 0xD0, 0x40, 0xE1, 0x26, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0,
+0x20, 0xE2, 0x40, 0xE0, 0x26, 0xE0, 0x23, 0xE1, 0x20, 0x40, 0xD0, 0x21, 0xE7, 0x90, 0xB0, 0xD0,
+0xB0, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0xD3, 0x90, 0x30, 0x60, 0x30, 0x50, 0x00, 0x30, 0x01, 0x30,
+0x10, 0x01, 0xA1, 0x80, 0x0F, 0x7E, 0x0F, 0x76, 0x70, 0x31, 0xC0, 0x70, 0x80, 0x01, 0xF1, 0x00,
+0x50, 0x60, 0xA0, 0x40, 0xE0, 0xD1, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x40, 0xE1, 0x21, 0xE8,
+0x20, 0xE1, 0x90, 0xE1, 0x22, 0xE0, 0x24, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE0, 0x23,
+0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2A, 0xE2, 0x40, 0xE0, 0x26, 0xE1, 0x21, 0xE0,
+0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE7, 0xD0, 0xE1, 0x90, 0xE0, 0x41, 0xE2, 0x20, 0xE3, 0xD1, 0xE0,
+0xB0, 0xA0, 0x60, 0x70, 0x00, 0x10, 0xA0, 0x01, 0x30, 0x00, 0x70, 0x31, 0x70, 0x0F, 0x7B, 0x0F,
+0x74, 0x50, 0xA0, 0x80, 0x30, 0x02, 0xA0, 0x01, 0x30, 0x10, 0xA0, 0xB0, 0x90, 0xD1, 0xE0, 0x20,
+0xE0, 0x22, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE1, 0x2A, 0xE0, 0x91, 0xE0, 0x22, 0xE1,
+0x21, 0xE3, 0x20, 0xE0, 0xD0, 0x90, 0xE1, 0x21, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xE0, 0x2B, 0xE0, 0x91, 0xE0, 0x24, 0xE4, 0x20, 0xE1, 0xD0, 0x90, 0xE2, 0x20, 0xE4, 0x23,
+0xE1, 0xD0, 0xE0, 0x40, 0xD1, 0xB0, 0x90, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0xD1, 0x90, 0xB0, 0xA0,
+0x10, 0x80, 0x01, 0xA0, 0x01, 0xC0, 0x30, 0x80, 0xA0, 0x50, 0x0F, 0x79, 0x0F, 0x61, 0xC0, 0x30,
+0x80, 0x0C, 0xC0, 0x30, 0xA0, 0x60, 0x01, 0x70, 0x80, 0x01, 0x80, 0xA1, 0x30, 0x40, 0xD1, 0xE4,
+0x22, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE0, 0x29, 0xE0, 0x91, 0xD0, 0xE0, 0x21, 0xE1,
+0x21, 0xE3, 0x20, 0xE0, 0xD0, 0x90, 0xE1, 0x21, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xE0, 0x2B, 0xE0, 0x91, 0xE0, 0x24, 0xE8, 0x40, 0xE1, 0x21, 0xE3, 0x25, 0xE1, 0x91, 0xD0,
+0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x24, 0xD0, 0xE0, 0xD0, 0x80, 0x30, 0xA1, 0x50, 0x01,
+0x30, 0xC0, 0x01, 0xF0, 0xA0, 0x80, 0x0F, 0x77, 0x0F, 0x61, 0x80, 0xC0, 0x30, 0x0A, 0x70, 0x60,
+0xA0, 0xC0, 0x00, 0xA0, 0x02, 0x30, 0x40, 0xA1, 0x40, 0xD1, 0x91, 0xE0, 0xD0, 0x22, 0xE0, 0x22,
+0xE3, 0x21, 0xE0, 0x91, 0xD0, 0xE0, 0x26, 0xE3, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x26,
+0xE1, 0x91, 0xE1, 0x20, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2B, 0xE0,
+0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE5, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x24, 0xE1, 0x23, 0xE3, 0x40,
+0xE1, 0x20, 0xE0, 0x20, 0x40, 0xE0, 0x21, 0xE1, 0x23, 0xE0, 0xD0, 0x40, 0xE0, 0xD1, 0x40, 0xA1,
+0x40, 0x30, 0x01, 0xC0, 0x80, 0x00, 0x70, 0xA1, 0x70, 0x0F, 0x74, 0x0F, 0x5E, 0x80, 0x60, 0x50,
+0xC0, 0x30, 0x80, 0x08, 0x50, 0xA0, 0x80, 0xC0, 0x30, 0x01, 0x70, 0x80, 0xC0, 0x80, 0x60, 0xB0,
+0xD2, 0xE2, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE2, 0x21, 0xE1, 0x40, 0xE0, 0xD0,
+0xE0, 0x23, 0xE1, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0x22, 0xE1, 0x26, 0xE2, 0x90, 0xD0,
+0xE0, 0x20, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2B, 0xD0, 0x40, 0xE1,
+0x20, 0xE1, 0x22, 0xE3, 0x22, 0xD0, 0x40, 0xE0, 0x24, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xD0, 0xE0,
+0x20, 0xE2, 0x90, 0x22, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xE3, 0xD1, 0xB0, 0x60, 0x80, 0x00,
+0x80, 0xC0, 0x01, 0x30, 0xC0, 0x80, 0x30, 0x70, 0x0F, 0x72, 0x0F, 0x5D, 0x50, 0x30, 0xC0, 0x60,
+0x50, 0x08, 0x50, 0x30, 0x60, 0x70, 0x01, 0x30, 0x01, 0x70, 0xF0, 0x30, 0x40, 0xD1, 0xE0, 0x22,
+0xE1, 0x40, 0xE1, 0x20, 0xE1, 0x24, 0xE2, 0x22, 0xE0, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE0, 0x26,
+0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x22, 0xE1, 0x21, 0xE2, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE3, 0x25,
+0xE0, 0x22, 0xE0, 0x40, 0xE3, 0x21, 0xE1, 0x21, 0xE2, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xD0,
+0xA0, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE2, 0xD1, 0x40, 0xA0, 0x60,
+0xC0, 0x00, 0x70, 0x80, 0x01, 0x50, 0xA0, 0x30, 0x70, 0x0B, 0x70, 0x80, 0xC0, 0x0F, 0x61, 0x0F,
+0x5D, 0x30, 0x50, 0x01, 0x10, 0xC0, 0x05, 0x50, 0xA0, 0x50, 0x00, 0x70, 0x80, 0x01, 0x50, 0xA1,
+0x30, 0x90, 0xD1, 0xE1, 0x24, 0xE0, 0x91, 0xD0, 0x20, 0xE1, 0x23, 0xE1, 0x24, 0xE0, 0x90, 0xE3,
+0x29, 0xE1, 0x90, 0xE1, 0x20, 0xE2, 0x21, 0xE3, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23,
+0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x25, 0xE1, 0x20, 0xE0, 0x91, 0xE7, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xE2, 0x20, 0xE1,
+0xD0, 0xE0, 0x22, 0xE3, 0xD0, 0x40, 0x20, 0xE0, 0x23, 0xE2, 0xD1, 0x90, 0x30, 0xA1, 0xC0, 0x01,
+0x30, 0x01, 0x80, 0x60, 0x70, 0x09, 0xA0, 0x80, 0x60, 0xC0, 0x0F, 0x60, 0x0F, 0x59, 0x70, 0x60,
+0xF0, 0xC0, 0x70, 0x60, 0x01, 0x80, 0x30, 0x03, 0x80, 0xA0, 0x50, 0x30, 0xC0, 0x01, 0x30, 0xC0,
+0xB0, 0xA0, 0xB0, 0xD1, 0xE4, 0x24, 0xE0, 0xD0, 0x40, 0xE3, 0x21, 0xE2, 0x22, 0xE1, 0x20, 0xE0,
+0x91, 0xD0, 0x20, 0xE0, 0x29, 0xE2, 0x90, 0xD0, 0xE0, 0x2A, 0xE1, 0x40, 0xD0, 0xE1, 0x25, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0,
+0x20, 0xE1, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0x22, 0xE2, 0x20,
+0xE1, 0xB0, 0x60, 0xD0, 0xE4, 0x40, 0xE1, 0x23, 0xE5, 0xD1, 0xB0, 0xA0, 0x80, 0x70, 0x80, 0x01,
+0x70, 0x81, 0xA0, 0x50, 0x09, 0x50, 0x80, 0x0F, 0x60, 0x0F, 0x59, 0xF0, 0xC0, 0x70, 0x60, 0x00,
+0xA0, 0x50, 0x00, 0xC0, 0x60, 0x01, 0x80, 0xA1, 0x01, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x60, 0x90,
+0xD1, 0xE1, 0x21, 0xE1, 0x25, 0xE0, 0xD0, 0x91, 0xE1, 0x22, 0xE2, 0x22, 0xE1, 0x21, 0xE0, 0x40,
+0xE2, 0x26, 0xE1, 0x21, 0xE0, 0x20, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x25, 0xE1, 0x40, 0xD0, 0xE0,
+0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x24, 0xE1, 0x24, 0xE0, 0x40, 0xE1, 0x24, 0xE1, 0x24, 0xE0, 0xD0, 0x40, 0x21, 0xE0, 0x20, 0xE1,
+0x20, 0xD0, 0xE0, 0xA0, 0xD0, 0xE2, 0x20, 0xE0, 0x91, 0xE3, 0x22, 0xE2, 0x22, 0xE0, 0xD1, 0x40,
+0xF0, 0x80, 0xC0, 0x00, 0xA0, 0x02, 0xA1, 0x50, 0x05, 0x80, 0x61, 0xC0, 0x80, 0xF0, 0x60, 0x50,
+0x0F, 0x5C, 0x0F, 0x55, 0x50, 0x30, 0x50, 0x00, 0xA0, 0x00, 0x80, 0xF0, 0x50, 0xC0, 0xF0, 0x70,
+0x80, 0x30, 0x70, 0xA0, 0x50, 0x00, 0x30, 0xC0, 0x01, 0xA0, 0x30, 0xA0, 0x41, 0xD0, 0xE0, 0x20,
+0xE0, 0x21, 0xE0, 0x20, 0xE3, 0x21, 0xE3, 0x40, 0xE0, 0x23, 0xE2, 0x22, 0xE1, 0x21, 0xD0, 0x40,
+0x20, 0xE2, 0x25, 0xE2, 0x20, 0xE1, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x25, 0xE1, 0x40, 0xD0, 0xE0,
+0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x22, 0x40, 0xD0, 0xE0, 0x2B,
+0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x21, 0xE1, 0x40, 0xE0, 0x22, 0xE1, 0xD0, 0xB1, 0xD0, 0xE0,
+0x20, 0xE2, 0xD0, 0x40, 0xE4, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x41,
+0xA0, 0x31, 0x01, 0x70, 0x80, 0x00, 0x80, 0xA0, 0x70, 0x01, 0xA0, 0x01, 0xA0, 0x50, 0x70, 0x60,
+0x01, 0x60, 0x0F, 0x5C, 0x0F, 0x54, 0x50, 0xA0, 0x50, 0xF0, 0xC0, 0x01, 0x80, 0x70, 0x60, 0x50,
+0xC0, 0x30, 0xA1, 0x80, 0x30, 0x02, 0x30, 0x00, 0x31, 0x40, 0xD1, 0x90, 0x40, 0xD0, 0xE0, 0x25,
+0xE2, 0x21, 0xE3, 0x40, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x20, 0xE1, 0x91, 0xE1, 0x26,
+0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x25, 0xE1, 0x40, 0xD0, 0xE0, 0x26, 0xE0, 0x21,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2A, 0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x2B, 0xE0, 0x40, 0xD0,
+0xE0, 0x29, 0xE2, 0x91, 0xE0, 0x23, 0xE2, 0x20, 0xE2, 0x21, 0xE1, 0x40, 0xE4, 0x23, 0xE1, 0x24,
+0xE0, 0x40, 0xE0, 0xD1, 0x40, 0xA0, 0xB0, 0x00, 0x30, 0x02, 0x30, 0x80, 0x30, 0xC0, 0x60, 0x01,
+0xA0, 0x50, 0xF0, 0xC0, 0x01, 0x60, 0x00, 0x50, 0x80, 0x0F, 0x59, 0x0F, 0x54, 0xA0, 0x50, 0x00,
+0x60, 0x50, 0x03, 0x50, 0x30, 0x00, 0xA0, 0x30, 0x01, 0x30, 0xC0, 0x00, 0xC0, 0xF0, 0xA0, 0x90,
+0xD1, 0xE1, 0xD0, 0x40, 0xD0, 0x20, 0xE2, 0x20, 0xE0, 0x25, 0xE3, 0x91, 0xE0, 0x20, 0xE0, 0x22,
+0xE0, 0x25, 0xE2, 0x90, 0xE1, 0x26, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x27, 0xD0,
+0x40, 0xD0, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE1, 0x20, 0x40,
+0xD0, 0xE0, 0x29, 0xE2, 0x90, 0xD0, 0xE0, 0x27, 0xE4, 0x40, 0xE1, 0x24, 0xE5, 0x21, 0xE0, 0x40,
+0x90, 0xE4, 0x28, 0xE2, 0x40, 0xD0, 0xE1, 0xD1, 0x40, 0x61, 0x01, 0x50, 0x80, 0x01, 0x30, 0xF0,
+0x60, 0xF0, 0x30, 0x70, 0xA0, 0x01, 0x30, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0x0F, 0x58, 0x0F, 0x56,
+0x50, 0x30, 0xA0, 0x30, 0xC0, 0xA0, 0x70, 0x60, 0xA0, 0x30, 0xC0, 0x30, 0x02, 0xA0, 0xB0, 0xA0,
+0xD2, 0xE0, 0x21, 0xE1, 0x91, 0xD0, 0xE4, 0x28, 0xE1, 0x40, 0x21, 0xE1, 0x21, 0xE2, 0x23, 0xE2,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x90, 0xE1, 0x20, 0xE1, 0x28,
+0xD0, 0x40, 0xE2, 0x25, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE2, 0x90, 0xD0,
+0xE0, 0x29, 0xE1, 0x91, 0xD0, 0x28, 0xE4, 0x40, 0xD0, 0xE1, 0x23, 0xD0, 0xE0, 0x20, 0xE2, 0x21,
+0xD0, 0x40, 0x21, 0xE3, 0x27, 0xE1, 0xD0, 0x91, 0xE0, 0x21, 0xE1, 0xD1, 0x90, 0x60, 0x80, 0xA0,
+0x02, 0x30, 0xC0, 0x30, 0x80, 0x00, 0x81, 0x00, 0x70, 0xF0, 0x01, 0x80, 0x30, 0xC0, 0x0F, 0x58,
+0x0F, 0x59, 0xF0, 0x00, 0x50, 0xF0, 0x10, 0xA0, 0x01, 0x80, 0x70, 0x00, 0x80, 0xA0, 0x40, 0xD0,
+0xE1, 0x25, 0xD0, 0x40, 0xE4, 0x29, 0xE0, 0xD0, 0x40, 0x20, 0xE2, 0x21, 0xE3, 0x22, 0xE0, 0x20,
+0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE1, 0x28,
+0xE0, 0x40, 0xE1, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE1, 0x91, 0xD0,
+0xE0, 0x22, 0xE0, 0x25, 0xE1, 0x91, 0xD0, 0x23, 0xE0, 0x23, 0xE3, 0x91, 0xD0, 0xE1, 0x23, 0xE2,
+0x20, 0xE1, 0x20, 0xE1, 0x40, 0xD0, 0x21, 0xE3, 0x23, 0xE1, 0x20, 0xE2, 0x40, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xA0, 0x50, 0x00, 0x51, 0x01, 0x10, 0xF0, 0x50, 0xA0, 0x30,
+0x60, 0x70, 0x0F, 0x5D, 0x0F, 0x56, 0x50, 0xC1, 0xA0, 0xC0, 0x30, 0x70, 0x30, 0x10, 0x70, 0x00,
+0xC0, 0x60, 0xA0, 0x40, 0xD1, 0x20, 0xE0, 0x25, 0xE1, 0x91, 0xD0, 0xE0, 0x20, 0xE2, 0x27, 0xE0,
+0xD0, 0x91, 0xE2, 0x21, 0xE3, 0x21, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE1, 0x24, 0xE1, 0x21,
+0xE1, 0x40, 0xE3, 0x27, 0xE1, 0x91, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x28, 0xE1, 0xD0, 0x91, 0xE1, 0x22, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE0, 0x25, 0xE0,
+0xD0, 0x90, 0xE3, 0x22, 0xE1, 0xD1, 0xE4, 0x90, 0xE0, 0x22, 0xE3, 0x22, 0xE1, 0x20, 0xE2, 0x91,
+0xE0, 0x22, 0xE1, 0x22, 0xE0, 0xD1, 0xB0, 0xA1, 0x01, 0x50, 0x10, 0x80, 0x50, 0xA0, 0x50, 0x0F,
+0x5F, 0x0F, 0x56, 0x80, 0x60, 0xA1, 0x60, 0x70, 0x01, 0x10, 0xF0, 0x70, 0xA0, 0xB0, 0xD1, 0xE2,
+0x23, 0xE5, 0x40, 0xD0, 0xE4, 0x21, 0xE1, 0xD0, 0xE0, 0x21, 0xE2, 0x40, 0xD0, 0xE0, 0x22, 0xE3,
+0x21, 0xE1, 0x21, 0xD0, 0x40, 0xE3, 0x24, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0xE3, 0x28, 0xE0,
+0x91, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE1, 0xD0, 0x90, 0xE1,
+0x23, 0xE0, 0x23, 0xE3, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x25, 0xE1, 0x40, 0xE5, 0x20, 0xE0, 0x90,
+0xF0, 0xB0, 0xD0, 0xE3, 0x40, 0xD0, 0xE0, 0x21, 0xE4, 0x21, 0xE5, 0x40, 0xE0, 0x22, 0xE4, 0x22,
+0xE0, 0xD1, 0xB0, 0xA0, 0x70, 0x10, 0xF0, 0x01, 0x50, 0x60, 0x80, 0x0F, 0x5E, 0x0F, 0x57, 0x50,
+0x30, 0xC0, 0x00, 0xA0, 0x01, 0xB0, 0x10, 0xB0, 0xD1, 0x20, 0xE2, 0x23, 0xE4, 0x20, 0xE0, 0x91,
+0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xB0, 0x21, 0xE3, 0x40, 0xE1, 0x23, 0xE2, 0x21, 0xE1, 0x21,
+0xD0, 0x40, 0xE3, 0x23, 0xE1, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0xE3, 0x23, 0xE1, 0x21, 0xE2, 0x90,
+0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE1, 0xD0, 0x90, 0x20, 0xE1,
+0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x90, 0xE1, 0x23, 0xE1, 0x24, 0xE1, 0x90, 0xE1, 0x20, 0xE0,
+0x20, 0xE1, 0x20, 0xD1, 0xA1, 0xD0, 0xE0, 0xD0, 0x91, 0xD1, 0xE0, 0x20, 0xE3, 0x22, 0xE4, 0x91,
+0xE0, 0x22, 0xE4, 0x20, 0xE0, 0x22, 0xE0, 0xD1, 0x30, 0x10, 0x50, 0x01, 0xA0, 0x00, 0x70, 0xA0,
+0x50, 0x0F, 0x5C, 0x0F, 0x55, 0x70, 0x30, 0x60, 0xC0, 0x01, 0x51, 0xB0, 0x30, 0x91, 0xE1, 0x20,
+0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x22, 0xE1, 0xD0, 0xE0, 0x40, 0xE4, 0x22, 0xD0, 0x40, 0xE2, 0x21,
+0xE0, 0x91, 0xD0, 0x20, 0xE0, 0x22, 0xE1, 0x21, 0xE1, 0x21, 0xE0, 0x90, 0xE3, 0x23, 0xE2, 0x21,
+0xE1, 0x40, 0xE4, 0x22, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xE0, 0x28, 0xE1, 0xD0, 0x40, 0xE0, 0x24, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x91, 0xE1, 0x23,
+0xE1, 0x24, 0xE0, 0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE3, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xE1,
+0xA0, 0x90, 0xE1, 0x21, 0xE0, 0x25, 0xE1, 0x40, 0xD0, 0xE1, 0x23, 0xE4, 0x21, 0xE0, 0x21, 0xE0,
+0x91, 0xA0, 0x81, 0x70, 0x01, 0x50, 0x60, 0x30, 0xC0, 0x0F, 0x5A, 0x0F, 0x54, 0x80, 0x30, 0x01,
+0xA0, 0x01, 0x50, 0xF0, 0x40, 0xD1, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x28, 0xE0, 0xD1, 0x91, 0xE1,
+0x20, 0xE0, 0x22, 0xE2, 0x20, 0xE1, 0x21, 0xD0, 0x40, 0xE3, 0x21, 0xE1, 0x21, 0xE0, 0x22, 0xE0,
+0x91, 0xD0, 0xE1, 0x23, 0xE2, 0x21, 0xE1, 0x91, 0xD0, 0xE2, 0x22, 0xE2, 0x20, 0xE1, 0xD0, 0x40,
+0xD0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE1, 0xD0, 0x40, 0xE0, 0x23,
+0xE2, 0x22, 0xE2, 0x91, 0xE0, 0x23, 0xE2, 0x24, 0xE0, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE9, 0x40,
+0xD0, 0xE0, 0x40, 0x20, 0xE1, 0x21, 0xE1, 0x24, 0xE0, 0x91, 0xE2, 0x24, 0xE3, 0x25, 0x40, 0xD1,
+0xB0, 0xF0, 0x70, 0x01, 0xA0, 0x00, 0xC0, 0x30, 0x80, 0x0F, 0x59, 0x0F, 0x52, 0xC0, 0xA0, 0x60,
+0xC0, 0x01, 0x50, 0x80, 0xA0, 0x30, 0xD1, 0xE1, 0x90, 0x40, 0xE1, 0x22, 0xE0, 0x27, 0xD0, 0x40,
+0x60, 0x90, 0x40, 0xD0, 0xE1, 0x24, 0xE0, 0x25, 0xD0, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0x21, 0xE0,
+0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x23, 0xE3, 0x21, 0xE1, 0x91, 0xD0, 0xE2, 0x22, 0xE1, 0x21, 0xE1,
+0xD0, 0x40, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE2, 0x40, 0xE0,
+0x23, 0xE2, 0x22, 0xE2, 0x90, 0xE1, 0x23, 0xE2, 0x22, 0xE2, 0x40, 0xE3, 0x22, 0xE7, 0x91, 0xE1,
+0xD1, 0xE1, 0x22, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0x26, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0xD0,
+0x40, 0xE2, 0xD1, 0xA0, 0x31, 0x70, 0x01, 0x70, 0xA1, 0x0F, 0x58, 0x0F, 0x51, 0x80, 0x30, 0x01,
+0x60, 0x01, 0xB0, 0xA0, 0xD1, 0xE3, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x21,
+0xD0, 0x60, 0x40, 0xD0, 0x40, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x90, 0xD0,
+0xE0, 0x23, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0x22, 0xE1, 0x20, 0x90,
+0xE1, 0x20, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x28, 0xE2, 0x40, 0xE0, 0x23, 0xE2, 0x22, 0xE2, 0x40, 0xE0, 0x24, 0xE2, 0x22,
+0xE2, 0x40, 0xD0, 0xE2, 0x23, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x40, 0xE0, 0x20,
+0xE0, 0x22, 0xE1, 0x21, 0xD0, 0x91, 0xD0, 0xE0, 0x2B, 0xE0, 0x20, 0xD0, 0x91, 0xE1, 0x20, 0xE1,
+0xD0, 0x90, 0x60, 0x80, 0x01, 0xA0, 0x01, 0xA0, 0x80, 0x0F, 0x56, 0x0F, 0x43, 0xC0, 0x0A, 0xC0,
+0xA1, 0x70, 0x01, 0x70, 0x30, 0xA0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0x40, 0xE2,
+0x21, 0xE0, 0x22, 0xE4, 0xD2, 0xE0, 0x90, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0x40, 0xE1, 0x23, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x23, 0xE0,
+0x24, 0xE0, 0x20, 0xE0, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x26,
+0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE2, 0x90, 0xE0, 0x23, 0xE2, 0x22, 0xE2,
+0x40, 0xD0, 0xE0, 0x23, 0xE2, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE3, 0x21, 0xE1, 0x22, 0xE1, 0x20,
+0x90, 0xE6, 0x24, 0xE3, 0x40, 0xE2, 0x20, 0xE4, 0x23, 0xE0, 0x20, 0xE2, 0x40, 0xE3, 0x22, 0xE0,
+0xD0, 0xB0, 0xA0, 0x30, 0xC0, 0x01, 0x50, 0x31, 0xC0, 0x0F, 0x54, 0x0F, 0x42, 0x50, 0x30, 0x80,
+0x08, 0x80, 0x30, 0x01, 0xA0, 0x01, 0xB0, 0xA0, 0xD1, 0x22, 0xE1, 0x22, 0xE0, 0x91, 0xE0, 0x22,
+0xE0, 0x22, 0xE4, 0x20, 0xE1, 0xD0, 0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE2,
+0x91, 0xE0, 0x23, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x91, 0xE1, 0x22, 0xE1, 0x23, 0xE0, 0x20, 0xD0,
+0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE2, 0x20, 0xE1, 0xD0, 0x40, 0xE0, 0x26, 0xE0, 0x21, 0xE0, 0x20,
+0xE0, 0x40, 0xD0, 0xE0, 0x29, 0xE1, 0x90, 0xE0, 0x24, 0xE1, 0x22, 0xE1, 0x20, 0x90, 0xE1, 0x23,
+0xE2, 0x22, 0xE0, 0xD0, 0x40, 0xE5, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x91, 0xD0, 0x21, 0xE3,
+0x24, 0xE2, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE4, 0x25, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x22, 0xE0,
+0x20, 0xE1, 0xD0, 0xE0, 0xA0, 0x40, 0x00, 0xC0, 0xA0, 0x00, 0xC0, 0xA0, 0x50, 0x0F, 0x53, 0x0F,
+0x42, 0x30, 0xC0, 0x30, 0x07, 0xA1, 0x70, 0x01, 0xC0, 0xA0, 0x60, 0x40, 0xD1, 0xE4, 0x24, 0xD0,
+0x40, 0xD0, 0xE2, 0x23, 0xE5, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xE0, 0x20, 0xE0,
+0x23, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x20, 0xE2, 0x25, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x24, 0xE4, 0x91, 0xD0, 0xE0, 0x22, 0xE2, 0x21,
+0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE4, 0x24, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x22, 0xE3, 0x23,
+0xE0, 0x21, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x24, 0xE2, 0x40, 0xD0, 0xE0,
+0x21, 0xE1, 0x21, 0xE3, 0xD0, 0xB0, 0xA1, 0x02, 0x80, 0xA0, 0x30, 0x0F, 0x52, 0x0F, 0x40, 0xC0,
+0x01, 0x80, 0x06, 0x50, 0xA0, 0x01, 0xA0, 0x01, 0xB0, 0xA0, 0xD1, 0xE0, 0x20, 0xE2, 0x25, 0xE1,
+0x91, 0xD0, 0xE0, 0x29, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x24, 0xE1, 0x20, 0xE2, 0x20, 0xE1,
+0x90, 0x21, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xE2, 0x20, 0xE3,
+0x20, 0xE1, 0x21, 0xE0, 0x91, 0xE0, 0x22, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0x20, 0xE1,
+0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x91, 0xE0, 0x20,
+0xE0, 0x24, 0xE4, 0x90, 0xE1, 0x23, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE1, 0x25,
+0xE2, 0x91, 0xE0, 0x22, 0xE1, 0x27, 0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x28, 0xE0, 0xD0,
+0x40, 0xE2, 0x21, 0xE3, 0x22, 0xE1, 0xD1, 0xA0, 0x80, 0x00, 0xC0, 0xA0, 0x00, 0xC0, 0xA0, 0x70,
+0x0F, 0x50, 0x0F, 0x3F, 0x80, 0x61, 0x50, 0x06, 0x80, 0x60, 0x50, 0x02, 0x60, 0xA0, 0x40, 0xD0,
+0xE2, 0x26, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE4, 0x21, 0xE1, 0x21, 0xE0, 0x22, 0xE0, 0xD0, 0x91,
+0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE2, 0x20, 0xE1, 0x91, 0xE5, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE3, 0x21, 0xE0, 0x21, 0xE1, 0x90, 0xE0, 0x22, 0xE1, 0x21, 0xE0,
+0x21, 0xE0, 0xD0, 0x90, 0xE2, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x24, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x24, 0xE3, 0xD0, 0x40, 0xE1, 0x23, 0xE0, 0x22, 0xE0, 0x21,
+0xE0, 0x91, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0xE2, 0x20, 0xE2, 0x23, 0xE1,
+0x20, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x20, 0xE2, 0x26, 0xE1, 0x90, 0x40, 0xE1, 0x23,
+0xE2, 0x23, 0xE1, 0xD1, 0xB0, 0xA1, 0x02, 0x80, 0xA0, 0x80, 0x0F, 0x4F, 0x0F, 0x3E, 0xC0, 0x60,
+0x00, 0xC0, 0x60, 0x80, 0x04, 0xA0, 0x50, 0x00, 0xA0, 0x01, 0x80, 0xA0, 0x90, 0xD0, 0xE2, 0x27,
+0xE2, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE3, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE2, 0x20, 0xD0, 0x40,
+0xE1, 0x22, 0xE1, 0x22, 0xE2, 0x20, 0xE1, 0x40, 0xD0, 0xE3, 0x25, 0xE0, 0x20, 0xE0, 0x20, 0x40,
+0xD0, 0x21, 0xE3, 0x21, 0xE0, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xE1, 0x20, 0xE1,
+0x91, 0xE1, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x91,
+0xE0, 0x20, 0xE1, 0x23, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE2, 0x21, 0xE0, 0x20,
+0xE1, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE1, 0x21, 0xE2, 0x23,
+0xE3, 0x40, 0xD0, 0x22, 0xE3, 0x27, 0xD0, 0x40, 0xE2, 0x23, 0xE2, 0x25, 0xE0, 0xD1, 0x40, 0xA0,
+0x50, 0x00, 0x70, 0x30, 0x00, 0x50, 0x30, 0x0F, 0x4E, 0x0F, 0x3C, 0x50, 0x70, 0x00, 0xF0, 0x01,
+0xC0, 0x10, 0xC0, 0x01, 0x70, 0x10, 0x50, 0x02, 0xA1, 0xB0, 0xD0, 0x40, 0xE0, 0x20, 0xE1, 0x20,
+0xE0, 0x24, 0xE3, 0x22, 0xD0, 0x91, 0xD0, 0xE3, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xE1,
+0x21, 0xE0, 0x24, 0xE1, 0x20, 0xE1, 0x40, 0xE6, 0x23, 0xE3, 0x40, 0xD0, 0x21, 0xE1, 0x23, 0xE0,
+0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xE1, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x22, 0xE1,
+0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x90, 0xE1, 0x20, 0xE1, 0x23,
+0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0x20, 0xE2,
+0x22, 0xE1, 0x22, 0xD0, 0x91, 0xD0, 0xE2, 0x20, 0xE2, 0x24, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE5,
+0x22, 0xE0, 0xD0, 0x91, 0xE1, 0x24, 0xE2, 0x25, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xB0, 0x31, 0x02,
+0x30, 0xF0, 0x70, 0x06, 0x70, 0x80, 0x30, 0x0F, 0x42, 0x0F, 0x3B, 0xA0, 0x30, 0x60, 0x81, 0xA0,
+0x01, 0x50, 0x30, 0x00, 0x30, 0x80, 0x00, 0xA0, 0x70, 0x00, 0x50, 0x60, 0x90, 0xD0, 0xE0, 0xD0,
+0x40, 0xE2, 0x26, 0xE0, 0x20, 0xE1, 0x23, 0xD0, 0x40, 0xE4, 0x24, 0xE1, 0x20, 0xE1, 0x20, 0xE0,
+0x40, 0xE1, 0x20, 0xE1, 0x24, 0xE5, 0x40, 0xE4, 0x24, 0xE2, 0xD0, 0x40, 0xE0, 0x21, 0xE1, 0x26,
+0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE2, 0x20, 0xE1, 0x20, 0xE2, 0x90, 0xD0, 0xE0, 0x23, 0xE0, 0x22,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x40, 0xE1, 0x20, 0xE1, 0x26, 0xE1,
+0x90, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x22, 0xD0, 0x91, 0xD0, 0x20, 0xE2, 0x21, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0xD0, 0x40, 0x20, 0xE3, 0x21, 0xE1, 0x23, 0xE2, 0x40, 0xD0, 0x27, 0xE2, 0x22, 0xE1,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0xD0, 0x90, 0xA0,
+0x70, 0x00, 0x50, 0x80, 0x00, 0x30, 0x80, 0x02, 0x50, 0x30, 0x60, 0x80, 0x10, 0x80, 0x0F, 0x42,
+0x0F, 0x3A, 0x70, 0xA0, 0x00, 0xC0, 0x60, 0x00, 0x60, 0x80, 0x00, 0x70, 0xA1, 0x80, 0x02, 0x30,
+0xB0, 0x30, 0xD1, 0x21, 0xE0, 0x91, 0xD0, 0x20, 0xE0, 0x24, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x91,
+0xE2, 0x25, 0xE1, 0x22, 0xE1, 0x91, 0xE2, 0x27, 0xE3, 0x40, 0x20, 0xE2, 0x25, 0xE3, 0x91, 0xE0,
+0x21, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE1, 0x21, 0xE1, 0x20,
+0xE1, 0x20, 0x90, 0xD0, 0xE0, 0x24, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x23, 0xE1, 0x40, 0xE1, 0x20, 0xE2, 0x24, 0xE1, 0x91, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0xD0, 0x90, 0xE1, 0x20, 0xE2, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x40, 0xE0, 0x20,
+0xE2, 0x23, 0xE0, 0x22, 0xE1, 0x91, 0xE1, 0x21, 0xE0, 0x23, 0xE3, 0x21, 0xD0, 0x91, 0xE2, 0x23,
+0xE2, 0x22, 0xE3, 0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0xA0, 0x80, 0x30, 0x02, 0xA0,
+0x30, 0x01, 0xA1, 0x00, 0x31, 0x00, 0x70, 0xA0, 0x30, 0xC0, 0x0F, 0x3E, 0x0F, 0x3A, 0xC0, 0xA0,
+0x00, 0xC0, 0xA0, 0x01, 0x30, 0x60, 0xF0, 0xA0, 0xC0, 0x30, 0x70, 0x01, 0x60, 0xB0, 0xD0, 0xE0,
+0x22, 0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x22, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0xD0,
+0xE1, 0x25, 0xE2, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x23, 0xE0, 0x23, 0xE3, 0x91, 0xE1, 0x25, 0xE4,
+0xD0, 0x40, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x21,
+0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x23, 0xE1, 0x40, 0xE1, 0x20, 0xE2, 0x24, 0xE1, 0x40, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE4, 0x20, 0xE1, 0x21, 0xE1, 0x91, 0xE0, 0x20, 0xE3, 0x22,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x23, 0xE3, 0x20, 0xE1, 0x40, 0xD0,
+0xE1, 0x24, 0xE1, 0x23, 0xE0, 0x20, 0xE1, 0x91, 0xE2, 0x21, 0xE0, 0xD0, 0xB0, 0xA0, 0x01, 0x50,
+0x80, 0x70, 0xA0, 0xC0, 0x00, 0x80, 0xF0, 0xA0, 0x00, 0x50, 0xF0, 0x70, 0x50, 0x30, 0x0F, 0x3E,
+0x0F, 0x37, 0xC0, 0xF0, 0x60, 0xC0, 0x01, 0x70, 0xA0, 0x00, 0x50, 0x00, 0x50, 0x60, 0x02, 0xA0,
+0x50, 0x60, 0x90, 0xD1, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0x22, 0xE4, 0x25, 0xE2, 0x20,
+0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0x23, 0xE0, 0xD0, 0x90, 0xE1, 0x23, 0xE1, 0x21, 0xE4,
+0x20, 0x40, 0xD0, 0xE0, 0x23, 0xE0, 0x21, 0xE3, 0xD0, 0x40, 0xE2, 0x27, 0xE2, 0x40, 0xD0, 0x21,
+0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x20, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x24, 0xE0,
+0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x20, 0xE1, 0x21, 0xE1, 0x40, 0xE0, 0x20, 0xE3, 0x21, 0xE0, 0x21,
+0xE2, 0x40, 0xE0, 0x21, 0xE3, 0x22, 0xE0, 0x20, 0xE2, 0x91, 0xE0, 0x20, 0xE3, 0x23, 0xE1, 0x20,
+0xE0, 0x20, 0xD0, 0x40, 0xE1, 0x26, 0xE1, 0x23, 0xE3, 0x40, 0xD0, 0xE4, 0x20, 0xE0, 0xD0, 0x40,
+0x60, 0x50, 0xA0, 0x02, 0xF0, 0xC1, 0x10, 0xA0, 0xC0, 0x10, 0x01, 0xC0, 0x60, 0x0F, 0x3E, 0x0F,
+0x37, 0xF0, 0x00, 0x50, 0x30, 0x01, 0x50, 0x81, 0xA0, 0x30, 0x81, 0x70, 0x01, 0x30, 0xA0, 0xD1,
+0xE3, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x25, 0xE2, 0x40, 0xE1, 0x20,
+0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0x23, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x40,
+0xE1, 0x20, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0x41, 0xE0, 0xD0, 0xE1, 0x23, 0xE0, 0x22, 0xE1,
+0x40, 0xD0, 0x23, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x24, 0xE5, 0x40, 0xD0, 0xE0, 0x20,
+0xE3, 0x22, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0x23, 0xE0,
+0x21, 0xE0, 0x22, 0xE0, 0x91, 0xE0, 0x20, 0xE2, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0x90, 0xD0, 0x21,
+0xE3, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE0, 0x21, 0xE3, 0x23, 0xE1, 0x20, 0xE0, 0xD0,
+0x91, 0xE3, 0x24, 0xE1, 0x20, 0xE4, 0xD0, 0x40, 0xE2, 0x20, 0xE0, 0x23, 0xE0, 0xD1, 0xA0, 0x80,
+0x01, 0x50, 0x80, 0x30, 0xF0, 0x01, 0x60, 0x70, 0x01, 0xA0, 0x80, 0xC0, 0x30, 0x50, 0x0F, 0x3B,
+0x0F, 0x36, 0xC0, 0xF0, 0x00, 0x80, 0xF0, 0x60, 0xC0, 0x50, 0x10, 0x30, 0xA0, 0x50, 0x01, 0xA0,
+0xC0, 0x30, 0xB0, 0xD0, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0x20,
+0xE4, 0x20, 0xE0, 0x24, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x25, 0xE1, 0xD0, 0x40,
+0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x20, 0xE2, 0xD0, 0x91, 0xE0, 0x21, 0xE0, 0x21, 0xE2, 0xD0, 0x40,
+0xA0, 0xB0, 0xE0, 0x90, 0xE1, 0x24, 0xE0, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE0,
+0x23, 0xE0, 0x40, 0xE1, 0x24, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x22, 0xE1, 0x20,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x23, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0x21, 0xE2, 0x22,
+0xE0, 0x20, 0xE2, 0x91, 0xE0, 0x22, 0xE2, 0x26, 0xE1, 0x40, 0xE3, 0x25, 0xE0, 0x20, 0xE1, 0x20,
+0xE2, 0x91, 0xE1, 0x22, 0xE2, 0x22, 0xD1, 0xB0, 0x30, 0x70, 0x30, 0x01, 0x80, 0x30, 0x00, 0x60,
+0x01, 0x80, 0xA0, 0x00, 0x80, 0xC0, 0x30, 0x0F, 0x3B, 0x0F, 0x37, 0xC0, 0x00, 0x50, 0xC0, 0x50,
+0x60, 0x00, 0x80, 0x30, 0x10, 0x60, 0x01, 0x70, 0xF0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x28, 0xE0,
+0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE1, 0x28, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE2, 0x27, 0xE1,
+0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0xD2, 0x40, 0xD3, 0xE0, 0x90, 0xB0, 0x90,
+0xD0, 0xE0, 0xA0, 0xB0, 0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0x23, 0xE0, 0x22, 0xE1, 0x40, 0xE1, 0x21,
+0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x40, 0xE1, 0x24, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x22, 0xE2, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x25, 0xD0, 0xE0, 0x90, 0xE1, 0x22, 0xE1, 0x20, 0xE0,
+0x20, 0xE2, 0x40, 0xD0, 0x21, 0xE2, 0x24, 0xE1, 0xD0, 0x40, 0xE1, 0x21, 0xE2, 0x23, 0xE2, 0xD0,
+0x40, 0xD0, 0xE0, 0x22, 0xE4, 0x20, 0xE0, 0x22, 0xE0, 0x91, 0xD0, 0xE2, 0x21, 0xE2, 0x22, 0xE1,
+0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x21, 0xE2, 0xD0, 0x80, 0x60, 0xC0, 0x01, 0xF0, 0x10,
+0x33, 0x60, 0x01, 0xC0, 0x30, 0x50, 0x0F, 0x3B, 0x0F, 0x3C, 0x60, 0x70, 0x30, 0x00, 0x50, 0x10,
+0x30, 0x70, 0x60, 0xE0, 0xD1, 0xE0, 0x2B, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x22, 0xE2,
+0x21, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x26, 0xE0, 0x20, 0xD0, 0x40, 0x20, 0xE1, 0x23, 0xE0,
+0x20, 0xE1, 0xD0, 0x40, 0x60, 0x30, 0x40, 0xD0, 0x90, 0xA0, 0x60, 0xE0, 0x61, 0x90, 0xE1, 0xD1,
+0xE0, 0xD0, 0x40, 0xE3, 0x22, 0xE0, 0x22, 0xE1, 0x91, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x23, 0xE0,
+0x91, 0xE0, 0x20, 0xE0, 0x22, 0xE5, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x22, 0xE1, 0x91, 0xE1, 0x20,
+0xE1, 0x24, 0xE0, 0xD0, 0x91, 0xE1, 0x22, 0xE1, 0x22, 0xE1, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x25,
+0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x23, 0xE2, 0x90, 0x40, 0xD0, 0xE0, 0x25, 0xE2, 0x23,
+0xE0, 0x40, 0xE3, 0x22, 0xE2, 0x22, 0xE3, 0xD0, 0x40, 0xD0, 0x20, 0xE1, 0x24, 0xE0, 0x21, 0xE3,
+0xD0, 0x90, 0x60, 0xC0, 0xF0, 0x10, 0x70, 0x00, 0xA0, 0x50, 0x70, 0x0F, 0x41, 0x0F, 0x39, 0x80,
+0xA2, 0xF0, 0x70, 0x01, 0x80, 0x10, 0xA0, 0xD0, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x27, 0xD0, 0x91,
+0xE2, 0x20, 0xE1, 0x23, 0xE0, 0x21, 0xE3, 0x91, 0xE3, 0x23, 0xE1, 0x23, 0xE1, 0x40, 0xD0, 0xE0,
+0x24, 0xE0, 0x20, 0xD0, 0x40, 0xA0, 0x00, 0xF0, 0xB0, 0x60, 0x10, 0xA0, 0xB0, 0xD2, 0xE0, 0x24,
+0xE0, 0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x23,
+0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x22, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE2, 0x23, 0xE0, 0xD0, 0x90, 0x20, 0xE2, 0x22, 0xE0, 0x23,
+0xE0, 0x90, 0xE2, 0x20, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x24, 0xE0, 0x24, 0xE0,
+0xD0, 0x40, 0xE2, 0x25, 0xE2, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x24, 0xE2, 0x23,
+0xE1, 0xD0, 0x91, 0xE0, 0x20, 0xE3, 0x23, 0xE2, 0x21, 0xE1, 0xD1, 0x60, 0x10, 0x50, 0x01, 0x80,
+0x60, 0x70, 0x0F, 0x41, 0x0F, 0x3A, 0x70, 0x30, 0x80, 0x00, 0x30, 0x70, 0x00, 0x31, 0x90, 0xD0,
+0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE2, 0x21, 0xE0, 0x20, 0xE3, 0xD0, 0x40, 0xE2, 0x2A, 0xE0, 0x20,
+0xE1, 0x40, 0xE0, 0xD0, 0x25, 0xE1, 0x23, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0,
+0xA0, 0x60, 0xB0, 0x90, 0xE0, 0x40, 0xD2, 0xE2, 0x20, 0xE3, 0x20, 0xE1, 0x90, 0xE0, 0x24, 0xE0,
+0x23, 0xE1, 0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0x91, 0xE2, 0x22, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x22, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE2,
+0x20, 0xE0, 0x22, 0xE0, 0x40, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x23, 0xD0, 0x40, 0xE2, 0x20, 0xE0,
+0x24, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x27, 0xE1, 0x40, 0xD0, 0xE0, 0x26, 0xE1, 0x21, 0xE2,
+0x40, 0xD0, 0xE1, 0x23, 0xE2, 0x24, 0xE1, 0x90, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x24, 0xE0, 0x22,
+0xE0, 0x21, 0xE1, 0x40, 0x30, 0x80, 0x00, 0x50, 0x80, 0x00, 0x30, 0x50, 0x0F, 0x40, 0x0F, 0x3A,
+0x80, 0x30, 0x02, 0xA1, 0x40, 0xD0, 0x90, 0x40, 0xD0, 0x21, 0xE0, 0x21, 0xE3, 0x20, 0xE0, 0x20,
+0xE6, 0x40, 0xE2, 0x24, 0xE2, 0x23, 0xE2, 0x40, 0xD0, 0x25, 0xE1, 0x24, 0xE0, 0x91, 0xD0, 0xE2,
+0x23, 0xE0, 0xD2, 0xE1, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE3, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x24,
+0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xD0, 0xE2, 0x20,
+0xE6, 0x40, 0xD1, 0xE8, 0xD0, 0x40, 0xE5, 0x21, 0xE0, 0x22, 0xE0, 0x40, 0x23, 0xE1, 0x20, 0xE1,
+0x20, 0xE0, 0x20, 0xD0, 0x40, 0xE4, 0x26, 0xE1, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x26, 0xE0, 0xD0,
+0x40, 0xE2, 0x2A, 0xE0, 0xD0, 0x40, 0xE2, 0x23, 0xE4, 0x23, 0xE1, 0x40, 0xE2, 0x20, 0xE1, 0x21,
+0xE3, 0x20, 0xE0, 0x23, 0xE1, 0x40, 0xE0, 0xD0, 0xB0, 0xA0, 0x30, 0x02, 0xA0, 0x50, 0x0F, 0x3F,
+0x0F, 0x39, 0x30, 0x80, 0x30, 0xC0, 0x01, 0x60, 0x90, 0xD2, 0x91, 0xE0, 0x22, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xE1, 0x22, 0xE2, 0x25, 0xE0, 0xD0, 0x40,
+0xE1, 0x25, 0xE3, 0x22, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x24, 0xE2, 0x20, 0xE2, 0x40, 0xE1, 0x22,
+0xE2, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0x20, 0xE2, 0x21, 0xE1,
+0xD0, 0xE0, 0xD1, 0x91, 0xD3, 0xE2, 0x94, 0x40, 0x95, 0xE2, 0xD2, 0x90, 0xE0, 0xD2, 0xE3, 0x22,
+0xE0, 0x91, 0x23, 0xE0, 0x21, 0xE5, 0x90, 0xE0, 0x20, 0xE2, 0x26, 0xD0, 0x40, 0xE5, 0x23, 0xE0,
+0x21, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0x21, 0xE3, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x22,
+0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0x90, 0xE3, 0x25, 0xD0, 0xE1, 0x22, 0xE1, 0xD0, 0x40, 0x90,
+0xD0, 0xE0, 0xD0, 0x40, 0xA0, 0x01, 0x50, 0x30, 0x81, 0x0F, 0x3E, 0x0F, 0x38, 0xA0, 0x70, 0x01,
+0xA0, 0x50, 0x60, 0x90, 0xD0, 0xE2, 0xD0, 0x40, 0x90, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0x28, 0xE0,
+0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE2, 0x25, 0xE1, 0xD0, 0x40, 0xE2, 0x23, 0xE3, 0x22, 0xE0,
+0x91, 0xD0, 0xE1, 0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE2, 0x22, 0xE1, 0x21, 0xE1, 0xD0,
+0x91, 0xE0, 0x22, 0xE1, 0x20, 0xE2, 0x20, 0xD0, 0x90, 0xE0, 0xD0, 0xE0, 0xD0, 0xE2, 0x93, 0x48,
+0x95, 0x40, 0x95, 0x45, 0xB0, 0x41, 0x93, 0xE5, 0x91, 0xE2, 0x21, 0xE1, 0x20, 0xE3, 0x40, 0xE1,
+0x20, 0xE2, 0x25, 0xE1, 0x40, 0xE0, 0x21, 0xE2, 0x21, 0xE5, 0x40, 0xE0, 0xD0, 0xE1, 0x21, 0xE0,
+0x26, 0xE1, 0x40, 0xE0, 0xD0, 0x21, 0xE2, 0x22, 0xE1, 0x20, 0xE3, 0x91, 0xD0, 0xE3, 0x26, 0xE1,
+0x21, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0xD0, 0xB0, 0x10, 0x60, 0x50, 0x30, 0x01, 0x50, 0x30,
+0x0F, 0x3D, 0x0F, 0x37, 0x30, 0xA0, 0xC0, 0x01, 0x70, 0x60, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x20,
+0xD0, 0x40, 0x90, 0xD0, 0x21, 0xE0, 0x20, 0xE0, 0x23, 0xE1, 0x23, 0xE2, 0x40, 0xE2, 0x24, 0xE1,
+0x22, 0xE2, 0xD0, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x40, 0xE0,
+0x20, 0xE0, 0x24, 0xE4, 0xD0, 0x40, 0x90, 0xE0, 0x23, 0xE1, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0x23,
+0xE3, 0xD1, 0x94, 0x42, 0x91, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE1, 0xD4, 0xE3, 0x40, 0xD0, 0xE8,
+0xD0, 0xE0, 0x40, 0xE2, 0x92, 0x42, 0x91, 0xE0, 0x91, 0xD0, 0xE4, 0x23, 0xE0, 0xD0, 0x40, 0xD0,
+0x24, 0xE2, 0x22, 0xE0, 0x91, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE1,
+0x22, 0xE1, 0x21, 0xE4, 0x91, 0xD0, 0x20, 0xE3, 0x21, 0xE1, 0x20, 0xE5, 0x40, 0xD0, 0xE2, 0x29,
+0xE3, 0xD0, 0x90, 0x40, 0xE0, 0x21, 0xD0, 0x40, 0x10, 0x30, 0xB0, 0x60, 0xC0, 0x01, 0x50, 0xA0,
+0x30, 0x0F, 0x3C, 0x0F, 0x36, 0xA0, 0x70, 0x00, 0xA0, 0xC0, 0x70, 0xA0, 0xD1, 0xE2, 0x20, 0xE0,
+0x20, 0xE1, 0x40, 0xE4, 0x23, 0xE3, 0x23, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0x23, 0xE1, 0x23,
+0xE0, 0xD0, 0x20, 0xE0, 0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xE0,
+0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE3, 0x90, 0xD0, 0xE1, 0x23, 0xE2, 0x21, 0xE0, 0x40, 0xE8, 0x90,
+0x43, 0x92, 0xE0, 0xD1, 0xE5, 0x40, 0xE4, 0x23, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE0,
+0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE2, 0xD1, 0xE2, 0x91, 0x42, 0x90, 0xE6, 0x20,
+0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x24, 0xE5, 0x40, 0xE0, 0xD0, 0x23, 0xE1, 0x20, 0xE0, 0x22, 0xD0,
+0x90, 0xE3, 0x24, 0xE6, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x21, 0xE7, 0x40, 0xE4, 0x22, 0xE2, 0x23,
+0xE1, 0x20, 0xD0, 0xE0, 0x40, 0xD0, 0x22, 0xE1, 0xA1, 0x91, 0x60, 0xC0, 0x70, 0x30, 0x00, 0x70,
+0x30, 0x0F, 0x3B, 0x0F, 0x35, 0x10, 0x50, 0x02, 0x60, 0xA0, 0xD0, 0xE1, 0x24, 0xE3, 0x40, 0xD0,
+0xE0, 0x20, 0xE0, 0x23, 0xE3, 0x24, 0xE0, 0xD0, 0x40, 0xE2, 0x24, 0xE0, 0x23, 0xE2, 0xD0, 0x91,
+0xD0, 0xE0, 0x27, 0xE1, 0x20, 0xE1, 0x40, 0xD0, 0x21, 0xE3, 0x25, 0xD0, 0x40, 0xE3, 0x27, 0xE0,
+0x40, 0xE0, 0xD2, 0x90, 0x43, 0x90, 0x20, 0xD0, 0xE0, 0x40, 0xE0, 0xD0, 0xE2, 0x24, 0xE0, 0xD0,
+0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE0, 0xD0, 0x40,
+0xE0, 0x20, 0xE1, 0x21, 0xE3, 0xD1, 0x40, 0xD0, 0xE1, 0x91, 0x42, 0x90, 0xD2, 0x91, 0x26, 0xE1,
+0x21, 0xE1, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x22, 0xE1, 0x40, 0xE2, 0x20, 0xE0, 0x23,
+0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE2, 0x22, 0xE3, 0xB1, 0xD0, 0x91, 0xD0, 0xE0, 0x25,
+0xE3, 0x22, 0xE3, 0x40, 0xE1, 0x21, 0xE1, 0xD3, 0x40, 0x10, 0xF0, 0x30, 0x02, 0x80, 0x60, 0x0F,
+0x3A, 0x0F, 0x34, 0x60, 0xC0, 0xA0, 0x70, 0x00, 0xB0, 0x30, 0xD0, 0xE1, 0x26, 0xE2, 0x90, 0x40,
+0xD0, 0xE0, 0x24, 0xE3, 0x23, 0xE2, 0xD0, 0x40, 0xE2, 0x24, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x40,
+0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x21, 0xD0, 0x91, 0xE1, 0x20, 0xE3, 0x24, 0xE0, 0x91,
+0xE2, 0x22, 0xE4, 0xD0, 0x90, 0x43, 0x90, 0xE0, 0xD3, 0xE1, 0xD0, 0x40, 0xE1, 0x22, 0xE0, 0x23,
+0xE0, 0xD0, 0x40, 0xE1, 0x26, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE5, 0x20, 0xE1, 0x40, 0xE0, 0x20,
+0xE1, 0x21, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE3, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0x40, 0xE0, 0xD0,
+0xE7, 0x21, 0xD0, 0x40, 0xE4, 0x22, 0xE1, 0x21, 0xE1, 0x91, 0xE2, 0x20, 0xE0, 0x24, 0xE0, 0x20,
+0xE1, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x21, 0xE1, 0x21, 0xE4, 0x40, 0xD0, 0xE1, 0x26, 0xE3,
+0x22, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xD1, 0xF1, 0xA1, 0x50,
+0x00, 0x50, 0x30, 0x70, 0xA0, 0x0F, 0x39, 0x0F, 0x32, 0xC0, 0xA0, 0x02, 0x31, 0xB0, 0xD0, 0xE1,
+0x25, 0xE0, 0x20, 0xE2, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE2, 0x24, 0xE3, 0x90,
+0xE1, 0x24, 0xE2, 0x23, 0xE2, 0x90, 0xE1, 0x20, 0xE0, 0x24, 0xE1, 0x20, 0xE2, 0x40, 0xE0, 0xD0,
+0x20, 0xE2, 0x25, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE3, 0x91, 0x42, 0xE3, 0x20, 0xE4, 0x20, 0xE0,
+0x40, 0x90, 0xE0, 0x25, 0xE2, 0xD0, 0x40, 0xE2, 0x23, 0xE4, 0x40, 0xD0, 0xE0, 0x21, 0xE4, 0x20,
+0xE1, 0x40, 0xD0, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x91, 0xE1, 0x23, 0xE4, 0x90, 0x42, 0x91, 0xE0,
+0xD0, 0xE6, 0x40, 0xE3, 0x23, 0xE1, 0x21, 0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x28, 0xE3, 0x40, 0xE1,
+0x22, 0xE0, 0x22, 0xE1, 0x21, 0xE2, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x21, 0xE1, 0x20,
+0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0x21, 0xE0, 0x21, 0xE2, 0x20, 0xD0, 0xB0, 0xF0, 0x40, 0xF0,
+0xB0, 0x30, 0x80, 0x30, 0x01, 0xC0, 0xA0, 0x0F, 0x38, 0x0F, 0x28, 0xC0, 0x08, 0x30, 0xA0, 0xC0,
+0x01, 0xB0, 0x30, 0xD0, 0xE1, 0x25, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x24, 0xE2, 0x24,
+0xE1, 0xD0, 0x91, 0xE2, 0x22, 0xE2, 0x23, 0xE1, 0xD0, 0x40, 0xE1, 0x22, 0xE0, 0x23, 0xE2, 0x20,
+0xE0, 0x91, 0xE2, 0x20, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0xE6, 0x90, 0x40, 0x91, 0xD1, 0x40, 0xE2,
+0x22, 0xE1, 0x23, 0x91, 0xE0, 0x21, 0xE0, 0x20, 0xE4, 0xD0, 0x40, 0xE3, 0x23, 0xE1, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0xE2, 0x20, 0xE1, 0x22, 0xE0,
+0x91, 0xE1, 0x25, 0xE3, 0x90, 0xD0, 0xE0, 0x90, 0x41, 0x91, 0xE0, 0xD1, 0xE2, 0x40, 0xE3, 0x23,
+0xE1, 0x20, 0xE1, 0x91, 0xD0, 0x22, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x91, 0xD0, 0x21, 0xE0, 0x20,
+0xE0, 0x22, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0x90, 0xE2, 0x23, 0xE1, 0x23, 0xE4, 0x40, 0x90, 0xE1,
+0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0x10, 0x40, 0x30, 0xA0, 0x40, 0xA0, 0x80,
+0x01, 0x70, 0xA0, 0x30, 0x0F, 0x37, 0x0F, 0x27, 0x80, 0x30, 0x50, 0x06, 0xA0, 0xC0, 0x00, 0x60,
+0x00, 0x80, 0x30, 0xD1, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x25, 0xE1, 0x40, 0x90, 0xD0, 0xE0,
+0x24, 0xE1, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x23, 0xE3, 0x23, 0xE2, 0x40, 0xE1,
+0x20, 0xE0, 0x24, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE4, 0x21, 0xE2, 0x90, 0x40, 0xD1,
+0x90, 0x41, 0x90, 0xE1, 0x20, 0xE2, 0x91, 0xE2, 0x21, 0xE3, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE2,
+0x20, 0xE3, 0x91, 0xD0, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE0,
+0x21, 0xE0, 0x91, 0xE3, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE1, 0x21, 0xE5, 0x91,
+0xE4, 0x90, 0x42, 0x90, 0xE0, 0xD0, 0x40, 0xE3, 0x24, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x26, 0xE0,
+0x20, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE1, 0x24, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x90, 0x40, 0xD0,
+0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x22, 0xE3, 0x90, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x25,
+0xD0, 0xF0, 0xB0, 0xD0, 0xA0, 0x40, 0xD0, 0xA0, 0x50, 0x70, 0xA0, 0x00, 0x70, 0x30, 0x0F, 0x36,
+0x0F, 0x27, 0x30, 0x70, 0x80, 0x05, 0x10, 0x70, 0x02, 0x10, 0xB0, 0xD0, 0xE2, 0x20, 0xE1, 0x20,
+0xE3, 0x24, 0xE3, 0x40, 0xE1, 0x26, 0xE0, 0x20, 0xE0, 0x24, 0xE0, 0x20, 0x40, 0xD0, 0x21, 0xE0,
+0x20, 0xE0, 0x20, 0xE2, 0x23, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x24, 0xE1, 0x21, 0xE0, 0x91,
+0xE1, 0x20, 0xE3, 0x21, 0xE2, 0xD0, 0x40, 0x90, 0x40, 0x90, 0xD2, 0xE0, 0x22, 0xE1, 0x91, 0xD0,
+0xE6, 0x21, 0xE1, 0x90, 0xE0, 0x20, 0xE3, 0x20, 0xE3, 0x91, 0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xE0,
+0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE0, 0x91, 0xE3, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE4,
+0x20, 0xE4, 0xD0, 0x40, 0xE1, 0x24, 0xE0, 0xD0, 0xE0, 0x43, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE1, 0x27, 0xE0, 0x21, 0xD0, 0x91, 0xE2, 0x24, 0xE0, 0x20, 0xE0,
+0x20, 0xE2, 0x20, 0x40, 0xD0, 0xE1, 0x22, 0xE2, 0x21, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x40, 0xD0,
+0xE1, 0x20, 0xE2, 0x24, 0xE0, 0xD0, 0xB0, 0xF0, 0xD0, 0xB1, 0xD1, 0xA0, 0xF0, 0x02, 0x50, 0xF0,
+0x0F, 0x35, 0x0F, 0x27, 0xC0, 0x50, 0x05, 0xA0, 0xC0, 0xA0, 0x70, 0x00, 0xB1, 0x40, 0x90, 0xE3,
+0x20, 0xE0, 0x21, 0xE2, 0x24, 0xE4, 0x40, 0xE0, 0xD0, 0x21, 0xE0, 0x22, 0xE2, 0x24, 0xE0, 0xD0,
+0x91, 0xD0, 0xE1, 0x21, 0xE3, 0x24, 0xE1, 0x40, 0xE2, 0x20, 0xE0, 0x23, 0xE1, 0x21, 0xE1, 0x40,
+0xD0, 0x24, 0xE2, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE4, 0x40,
+0xE2, 0x20, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x91, 0xD0, 0xE1,
+0x24, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x21, 0xE1, 0x90, 0xE2, 0x20, 0xE0, 0x25, 0xD0, 0x40,
+0xE0, 0x26, 0xE3, 0x40, 0xE1, 0x21, 0xE3, 0x20, 0xE1, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0xD1, 0xE0,
+0x21, 0xE2, 0x20, 0xD0, 0x40, 0xE1, 0x22, 0xE0, 0x23, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0xE3, 0x23,
+0xE1, 0x21, 0xE2, 0x40, 0x90, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE1,
+0x20, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE4, 0x21, 0xE1, 0xF0, 0xE0, 0x20, 0x90,
+0xD0, 0x91, 0x30, 0x80, 0x00, 0x50, 0x30, 0x70, 0xA0, 0x0F, 0x34, 0x0F, 0x25, 0x30, 0xA0, 0x50,
+0x05, 0x30, 0x70, 0x01, 0x31, 0xB0, 0xD0, 0xE0, 0x40, 0x20, 0xE3, 0x21, 0xE2, 0x25, 0xE1, 0x20,
+0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x25, 0xD0, 0x40, 0x90, 0xD0, 0xE0,
+0x20, 0xE4, 0x25, 0xD0, 0x91, 0xD0, 0x21, 0xE0, 0x23, 0xE1, 0x22, 0xD0, 0x91, 0xE1, 0x21, 0xE0,
+0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE1, 0x40, 0xE1, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xE1,
+0x21, 0xE2, 0x21, 0xE1, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0x20, 0x90, 0xD0, 0xE0, 0x24,
+0xE3, 0x40, 0xD0, 0xE1, 0x20, 0xE2, 0x21, 0xE1, 0x40, 0xE2, 0x26, 0xE1, 0x40, 0xE0, 0x27, 0xE2,
+0x90, 0xE0, 0x21, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x90, 0x41, 0x90, 0xE5, 0xD0,
+0x91, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x21, 0xD0, 0x40, 0xE0, 0xD0, 0xE3, 0x23, 0xE1, 0x21,
+0xE1, 0x91, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x22, 0xE2, 0x40, 0xE0, 0xD0, 0xE0,
+0x21, 0xE1, 0x20, 0xE4, 0x21, 0xE0, 0xD0, 0x90, 0xD2, 0x90, 0x40, 0xD1, 0x30, 0xB0, 0x30, 0x01,
+0x70, 0x30, 0x0F, 0x33, 0x0F, 0x24, 0x30, 0x50, 0xC0, 0xA0, 0x60, 0x03, 0x30, 0x60, 0x02, 0x80,
+0xA0, 0xD0, 0xE2, 0x40, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0x26, 0xE1, 0x21, 0xE0, 0x90, 0x40, 0xD0,
+0xE0, 0x25, 0xE2, 0x23, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x24, 0xD0,
+0x40, 0xE2, 0x2A, 0x90, 0x40, 0xD0, 0xE3, 0x90, 0x40, 0x90, 0xE2, 0xD1, 0x40, 0xE0, 0x29, 0xE0,
+0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0x20, 0xE0, 0x27, 0xE0, 0x20, 0x40, 0xD0,
+0xE0, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x40, 0xD0, 0xE1, 0x21,
+0xE0, 0x23, 0xE0, 0x91, 0xE0, 0x20, 0xE2, 0x23, 0xE0, 0xD0, 0x90, 0xE1, 0x22, 0xE1, 0x23, 0xE1,
+0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x41, 0x90, 0xD1, 0xE1, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE0,
+0x21, 0xE3, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE3, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE3, 0x40, 0xD0,
+0x22, 0xE0, 0x20, 0xE0, 0x23, 0xE3, 0x20, 0xE0, 0xD0, 0x40, 0xE3, 0x20, 0xE8, 0x21, 0xE1, 0xD0,
+0xB0, 0x40, 0xE0, 0xB0, 0xD1, 0xE0, 0xD0, 0xA0, 0x50, 0x01, 0xC0, 0xF0, 0x80, 0x07, 0x70, 0x0F,
+0x29, 0x0F, 0x24, 0x60, 0xC0, 0x01, 0x80, 0x60, 0x01, 0xA0, 0x70, 0x00, 0x60, 0x00, 0x80, 0xB0,
+0xD0, 0xE1, 0x20, 0xE1, 0x40, 0x20, 0xE1, 0x20, 0xE0, 0x24, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0xD0,
+0x91, 0xD0, 0xE1, 0x23, 0xE2, 0x21, 0xE0, 0x20, 0xE3, 0x40, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x23,
+0xE1, 0x40, 0xD0, 0xE0, 0x2A, 0xD0, 0x40, 0xE2, 0x41, 0x90, 0xD0, 0xE2, 0x21, 0xE0, 0x90, 0xE1,
+0x28, 0xE1, 0x40, 0xE1, 0x21, 0xE0, 0x22, 0xE2, 0x91, 0xE0, 0x29, 0x40, 0xD0, 0xE1, 0x21, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x23, 0xD0,
+0x91, 0xE5, 0x22, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE1, 0x23, 0xE0, 0x21, 0xD0, 0x91, 0xD0, 0xE0,
+0x22, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x22,
+0xE1, 0x20, 0xE2, 0x40, 0xE4, 0x21, 0xE1, 0x22, 0xE2, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE3,
+0x22, 0xE5, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE3, 0x20, 0xE2, 0x22, 0xE2, 0x90, 0x30, 0x40, 0x10,
+0xB0, 0xD0, 0xE0, 0xD1, 0xA0, 0x50, 0x70, 0x60, 0x00, 0x81, 0x04, 0x70, 0x60, 0xF0, 0x30, 0x0F,
+0x28, 0x0F, 0x21, 0xC0, 0x01, 0x70, 0xF0, 0xC0, 0x01, 0xA0, 0x70, 0x81, 0x02, 0xF0, 0x30, 0xD0,
+0xE0, 0x21, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0x22, 0xE5, 0x21, 0xE3, 0xD0, 0x40,
+0x90, 0xE0, 0x24, 0xE0, 0x22, 0xE6, 0x91, 0xD0, 0x20, 0xE0, 0x22, 0xE3, 0x22, 0xE0, 0xD0, 0x91,
+0xE1, 0x27, 0xE1, 0xD0, 0x90, 0x41, 0x90, 0x20, 0xE4, 0x22, 0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x21,
+0xE1, 0x22, 0xE1, 0x40, 0xE0, 0x22, 0xE0, 0x22, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE0,
+0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0xE4, 0x20, 0xE0, 0x21, 0xE0,
+0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x40, 0xE1, 0x20, 0xE3, 0x21, 0xE2, 0x40,
+0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0x40, 0xE8, 0xD0, 0x91, 0x41, 0xE0, 0xD0, 0xE3,
+0x22, 0xE2, 0x20, 0xD0, 0x91, 0xD0, 0x20, 0xE0, 0x29, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x22,
+0xE3, 0x23, 0xE2, 0x91, 0xE2, 0x21, 0xE0, 0x24, 0xE1, 0x22, 0xE2, 0xD0, 0x90, 0xA0, 0xB0, 0x10,
+0xA0, 0x90, 0xD0, 0xE1, 0xD0, 0xA1, 0x02, 0x30, 0x80, 0x02, 0xC0, 0x10, 0x80, 0x00, 0xA0, 0x80,
+0x0F, 0x27, 0x0F, 0x21, 0x50, 0xF0, 0xC0, 0x00, 0x80, 0xF0, 0x70, 0x00, 0x80, 0xA0, 0x80, 0xA0,
+0xC0, 0x00, 0x70, 0xA0, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0x20, 0xE1, 0x23, 0xE4, 0x20,
+0xE0, 0x20, 0xE5, 0x40, 0xE1, 0x25, 0xE0, 0x21, 0xE2, 0x20, 0xE1, 0xD0, 0x40, 0xE0, 0xD0, 0x22,
+0xE5, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x21, 0xE2, 0xD0, 0x90, 0x41, 0xE0,
+0xD0, 0xE5, 0x23, 0xE0, 0x40, 0xE3, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0x27, 0xE3, 0x40, 0xD0,
+0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE5, 0x40, 0xD0,
+0xE4, 0x21, 0xE2, 0x40, 0xE1, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2,
+0x21, 0xE1, 0x91, 0xE0, 0x22, 0xE0, 0x22, 0xE2, 0x20, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x22, 0xE0,
+0xD1, 0x90, 0x41, 0xE4, 0x21, 0xE2, 0x20, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x29, 0xE1, 0x40, 0xD0,
+0xE2, 0x23, 0xE1, 0x24, 0xE1, 0x90, 0x40, 0xD0, 0x24, 0xE1, 0x24, 0xE0, 0x21, 0xE2, 0xD0, 0x90,
+0x40, 0x60, 0x31, 0x10, 0xF0, 0xE1, 0x20, 0xE1, 0xA0, 0xC0, 0x00, 0x70, 0x31, 0x50, 0x00, 0xA0,
+0xC0, 0x00, 0x30, 0x50, 0x00, 0x50, 0x0F, 0x27, 0x0F, 0x21, 0x70, 0x60, 0xF0, 0xC0, 0x00, 0x70,
+0x60, 0xF1, 0x80, 0x01, 0xA0, 0x50, 0x60, 0xD1, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0xD0, 0xE0, 0x40,
+0xE2, 0x22, 0xE1, 0x20, 0xE1, 0x21, 0xE3, 0x21, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22,
+0xE3, 0x20, 0xE2, 0x40, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0xD0, 0x91, 0xE7,
+0xD0, 0x90, 0x40, 0x90, 0xD0, 0x91, 0xE0, 0x20, 0xE3, 0x24, 0xE0, 0x91, 0xE1, 0x20, 0xE2, 0x21,
+0xE1, 0x20, 0xE0, 0x90, 0xE1, 0x24, 0xE3, 0x40, 0xE1, 0x24, 0xE3, 0x40, 0xD0, 0xE0, 0x21, 0xE0,
+0x20, 0xE4, 0x40, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x23,
+0xE1, 0x40, 0xE1, 0x23, 0xE1, 0x20, 0xE1, 0x40, 0xE0, 0x22, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0xD0,
+0x40, 0xE2, 0x22, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x41, 0x90, 0xD0, 0xE7, 0x91, 0xE0, 0x24,
+0xE0, 0x26, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x24, 0xE1, 0x40, 0xE1, 0x26, 0xE0, 0x23,
+0xE1, 0x20, 0xE2, 0x90, 0x40, 0xD0, 0xB0, 0x40, 0xD0, 0x10, 0xB0, 0xE1, 0x20, 0xE0, 0xD0, 0xE0,
+0x60, 0x50, 0x30, 0x01, 0xA0, 0x50, 0x60, 0x01, 0x50, 0x30, 0x01, 0xC0, 0x0F, 0x26, 0x0F, 0x21,
+0x51, 0x00, 0x10, 0x50, 0x01, 0xC0, 0xF0, 0x02, 0xC0, 0x60, 0xD1, 0xE0, 0x20, 0xE1, 0x23, 0xE3,
+0x40, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0x20, 0xE4, 0x21, 0xE2, 0x40, 0xD0, 0xE2, 0x25, 0xE3, 0x20,
+0xE0, 0xD0, 0x91, 0xD0, 0x21, 0xE1, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0xE1, 0x20,
+0xE3, 0x90, 0x40, 0x90, 0xE2, 0xD0, 0x40, 0x21, 0xE5, 0x22, 0xE1, 0x40, 0xD0, 0x21, 0xE0, 0x20,
+0xE0, 0x21, 0xE1, 0x21, 0x40, 0xD0, 0xE0, 0x25, 0xE2, 0x40, 0xE1, 0x24, 0xE3, 0x40, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE4, 0x40, 0xD0, 0xE2, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0x90, 0xD0, 0xE1, 0x20,
+0xE0, 0x23, 0xE1, 0x40, 0xE1, 0x23, 0xE0, 0x20, 0xE2, 0x40, 0xE0, 0x22, 0xE0, 0x22, 0xE0, 0x20,
+0xE0, 0xD0, 0x40, 0xE0, 0x24, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0x41, 0x90, 0xD1,
+0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x23, 0xE3, 0x23, 0xD0, 0x40, 0x90, 0xE1, 0x21, 0xE0, 0x27,
+0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x2D, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0xD1, 0xB0, 0x61,
+0x90, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xF0, 0x02, 0xC0, 0x10, 0x60, 0x51, 0x10, 0xC0, 0x50,
+0x10, 0x61, 0x0F, 0x25, 0x0F, 0x1E, 0xC0, 0x50, 0xC0, 0x03, 0x60, 0x80, 0x00, 0xA0, 0xC0, 0xA0,
+0xC0, 0x00, 0x60, 0xE0, 0xD0, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0x20, 0x40, 0x90, 0xD0,
+0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x22, 0xE4, 0x90, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE2, 0x91, 0xE0, 0x22, 0xE0, 0x26, 0xE1, 0x90, 0x40, 0x20, 0xE1, 0xD0, 0x90,
+0x40, 0x90, 0xE2, 0xD0, 0xE0, 0xD0, 0x91, 0xE0, 0x20, 0xE3, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0x40,
+0xE2, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xE1, 0x24, 0xE3,
+0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x25, 0xE1, 0x90, 0xD0,
+0xE1, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0x23, 0xE1, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x20, 0xE2, 0x20, 0xE1, 0x90, 0xD0, 0x22, 0xE2, 0x23, 0xD0, 0x40, 0xE0, 0xD0, 0xE1, 0x20,
+0xE1, 0x41, 0xE0, 0xD0, 0xE2, 0x40, 0xE3, 0x21, 0xE0, 0x20, 0xE2, 0x22, 0xD0, 0x91, 0xE1, 0x20,
+0xE2, 0x26, 0xE3, 0x40, 0xE3, 0x24, 0xE0, 0x22, 0xE0, 0x24, 0xD0, 0x90, 0x40, 0xE2, 0xD0, 0xA0,
+0x10, 0x91, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0xA0, 0x00, 0x70, 0xA0, 0x00, 0xA0, 0x80, 0x30,
+0xC0, 0x30, 0x60, 0x01, 0x81, 0x0F, 0x24, 0x0F, 0x1D, 0xC0, 0xA0, 0x30, 0xF0, 0x04, 0x50, 0x60,
+0x02, 0xA0, 0x60, 0x90, 0xD0, 0x20, 0xE0, 0x25, 0xE1, 0x23, 0xE1, 0x40, 0xE4, 0x23, 0xE0, 0x23,
+0xE3, 0x20, 0xE0, 0x91, 0xD0, 0xE1, 0x23, 0xE0, 0x23, 0xE0, 0x21, 0xD0, 0xE0, 0x40, 0xE0, 0x20,
+0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x20, 0x40, 0x90, 0xE3, 0x20,
+0xE3, 0x40, 0xD0, 0x21, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE1,
+0x90, 0xE1, 0x27, 0xE0, 0x91, 0xE0, 0x24, 0xE3, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE3, 0x20, 0xE0,
+0x40, 0xD0, 0xE1, 0x25, 0xE0, 0x91, 0xD0, 0xE3, 0x22, 0xE0, 0xD0, 0x91, 0xE0, 0x23, 0xE0, 0x21,
+0xE1, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x40, 0xE2, 0x21, 0xE1, 0x22, 0xE2,
+0x40, 0xD0, 0xE1, 0x23, 0xD0, 0xE0, 0x40, 0x90, 0x20, 0xE0, 0x90, 0x40, 0xE0, 0x26, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0x40, 0xE0, 0x21, 0xE0, 0x20, 0xD0, 0xE0, 0x26, 0xE1, 0xD0, 0x40, 0x90, 0xD0,
+0xE0, 0x22, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE0,
+0xD0, 0xA0, 0xC0, 0x10, 0xE2, 0x23, 0xE0, 0xD0, 0x40, 0x60, 0x30, 0x01, 0xC0, 0xA0, 0x00, 0x50,
+0xA0, 0x02, 0xA0, 0x70, 0x0F, 0x24, 0x0F, 0x1D, 0x81, 0x00, 0xA0, 0x60, 0x30, 0x02, 0xA0, 0x10,
+0x80, 0x01, 0xA0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x25, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0x40, 0xE1,
+0x21, 0xE0, 0x27, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x22,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x23, 0xE0, 0x23, 0xE2, 0x42, 0x20, 0xD0,
+0xE6, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x23, 0xE1,
+0x21, 0xE1, 0x90, 0xD0, 0x21, 0xE1, 0x23, 0xE1, 0x40, 0xE0, 0x20, 0xE1, 0x21, 0xE3, 0x90, 0xE1,
+0x20, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0x91, 0xE3, 0x24, 0xD0,
+0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x22, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE2, 0x21,
+0xE2, 0xD0, 0xE0, 0x40, 0x90, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x24, 0xE2, 0xD0, 0x40, 0xE1, 0x20,
+0xE1, 0x23, 0xE2, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x22, 0xE0, 0x23, 0xE1, 0x21, 0xE1, 0x21,
+0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0xB0, 0x60, 0xD0, 0x10, 0xD0, 0xE2, 0x23, 0xE0,
+0xD0, 0x40, 0x30, 0x01, 0x30, 0x10, 0x80, 0xA0, 0xC0, 0x01, 0xA0, 0x30, 0x00, 0x80, 0x50, 0x0F,
+0x22, 0x0F, 0x1D, 0x50, 0x30, 0x00, 0x60, 0xC0, 0x80, 0xA0, 0x00, 0x30, 0x50, 0x30, 0x10, 0xA0,
+0x30, 0x40, 0xD0, 0x22, 0xE0, 0x24, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xE2, 0x27,
+0xE2, 0x20, 0xE4, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1,
+0x20, 0xE0, 0x20, 0xE3, 0x21, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE0,
+0x90, 0xE1, 0x22, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0xD0, 0x40, 0xE3,
+0x21, 0xE3, 0x91, 0xE0, 0x23, 0xE4, 0x40, 0xD0, 0xE7, 0xD0, 0x91, 0xE4, 0x23, 0xE0, 0x40, 0xE0,
+0x24, 0xE4, 0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x22, 0xE1,
+0x21, 0xE2, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xE3, 0xD0, 0x41, 0x90, 0xD0, 0xE1, 0x20, 0xE1,
+0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0xE3, 0x23, 0xE2, 0x22, 0xD0, 0x90, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x21, 0xE2, 0xD0, 0x90, 0x40, 0xE1, 0xD0, 0xE0, 0x20, 0xD0,
+0x40, 0x60, 0xF0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0xB1, 0x60, 0x10,
+0x80, 0x50, 0x60, 0x30, 0x50, 0x10, 0x80, 0x00, 0x80, 0x70, 0x80, 0x70, 0x0F, 0x21, 0x0F, 0x23,
+0xA0, 0x50, 0x80, 0x01, 0x80, 0x10, 0x30, 0xD0, 0xE0, 0x2A, 0xE2, 0x20, 0xE1, 0x21, 0xE1, 0x40,
+0x90, 0xE1, 0x20, 0xE0, 0x23, 0xE2, 0x20, 0xE1, 0x20, 0xE3, 0x40, 0xE0, 0xD0, 0x23, 0xE0, 0x20,
+0xE0, 0x21, 0xE0, 0x20, 0xE3, 0x40, 0xE1, 0x21, 0xE3, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0,
+0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x22, 0xE1, 0x21, 0xE0,
+0x90, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0x20, 0xE4, 0x22, 0xE0, 0xD0, 0x40, 0xE3, 0x21,
+0xE0, 0x20, 0xE1, 0x91, 0xE0, 0x24, 0xE3, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x90,
+0x20, 0xE4, 0x22, 0xE1, 0x40, 0xE0, 0x21, 0xE2, 0x21, 0xE1, 0x91, 0xE1, 0x20, 0xE1, 0x20, 0xE0,
+0x20, 0xE2, 0x40, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x21, 0xE1, 0x91, 0xE0, 0x23, 0xE0, 0x20, 0xE5,
+0x40, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x90, 0x40, 0xD0,
+0xE2, 0x25, 0xE3, 0x20, 0xE1, 0x40, 0xD0, 0x20, 0xE2, 0x20, 0xE0, 0x23, 0xE2, 0x20, 0xE3, 0x90,
+0x40, 0xE2, 0x21, 0xE1, 0xD3, 0x20, 0xE1, 0x25, 0xE1, 0xD0, 0xA0, 0x10, 0x50, 0x01, 0x31, 0x80,
+0xC0, 0x01, 0xC0, 0x31, 0x0F, 0x22, 0x0F, 0x20, 0x70, 0x80, 0x31, 0xA0, 0x30, 0xC0, 0x00, 0x70,
+0x30, 0x91, 0x21, 0xE0, 0x29, 0xE3, 0x23, 0xE1, 0x40, 0xE4, 0x23, 0xE0, 0x23, 0xE0, 0x22, 0xE1,
+0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x22, 0xE1, 0x24, 0xE2, 0x40, 0xE1, 0x20, 0xE4, 0x20, 0x40, 0x90,
+0xE0, 0xD0, 0xE0, 0x91, 0xE2, 0x26, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x21, 0xD0,
+0x40, 0xE1, 0x20, 0xE2, 0x21, 0xE2, 0x91, 0xE0, 0x24, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x20, 0xE2,
+0x23, 0xE2, 0x90, 0xE1, 0x24, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0xD0,
+0x40, 0x21, 0xE0, 0x20, 0xE3, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x91,
+0xE0, 0x20, 0xE2, 0x22, 0xE2, 0x40, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x21, 0xE2, 0x40, 0xD0, 0xE0,
+0x24, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0xE3, 0x40, 0x90, 0xE4, 0x22, 0xE0, 0x40, 0xE5, 0x23,
+0xE6, 0x40, 0xE2, 0x22, 0xE0, 0x23, 0xE1, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0xE2, 0x20, 0xE0, 0x20,
+0xE0, 0xD0, 0xE0, 0xD0, 0xE5, 0x22, 0xE2, 0xD0, 0x40, 0x90, 0xA0, 0xC0, 0x00, 0xC0, 0x30, 0xA0,
+0xC0, 0x0F, 0x28, 0x0F, 0x20, 0xC0, 0x80, 0x50, 0xA0, 0x00, 0xC0, 0xA0, 0x50, 0x60, 0xD1, 0x90,
+0x40, 0xD0, 0xE1, 0x21, 0xE4, 0x29, 0xE2, 0x40, 0xE4, 0x23, 0xE0, 0x20, 0xE1, 0x22, 0xE2, 0x90,
+0x40, 0xD0, 0xE1, 0x22, 0xE1, 0x26, 0xE0, 0x91, 0xE1, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0xE0, 0xD0,
+0xE3, 0x40, 0xE2, 0x27, 0xE1, 0x91, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x22, 0xE0, 0x91, 0xE1, 0x20,
+0xE2, 0x22, 0xE1, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x91, 0xD0, 0xE1, 0x24,
+0xE0, 0xD0, 0x40, 0xD0, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x24, 0xE0, 0xD0, 0x40, 0xE0,
+0x22, 0xE3, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0xD0, 0x40, 0xE0, 0x21,
+0xE2, 0x23, 0xD0, 0x91, 0x21, 0xE3, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE1, 0x23, 0xE2, 0x20, 0xE1,
+0x91, 0xD0, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xD0, 0x91, 0xD0, 0xE2, 0x25, 0xE1,
+0x20, 0xE2, 0x40, 0xE7, 0x21, 0xE3, 0x23, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE2, 0x20, 0xE2, 0xD0,
+0xE0, 0xD1, 0x21, 0xE2, 0x21, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0xA0, 0x50, 0xA0, 0x01,
+0x60, 0x0F, 0x28, 0x0F, 0x22, 0x60, 0x03, 0x10, 0xD0, 0xE2, 0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE3,
+0x29, 0xE0, 0x20, 0xE1, 0x40, 0xE2, 0x21, 0xE0, 0x22, 0xE2, 0x24, 0xE1, 0x91, 0xD0, 0xE0, 0x22,
+0xE2, 0x25, 0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x22,
+0xE0, 0x40, 0xE4, 0x24, 0xE2, 0x40, 0xE4, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x20,
+0xE2, 0x22, 0xE1, 0x40, 0xD0, 0x22, 0xE2, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x25, 0xE0, 0xD0, 0x40,
+0xE0, 0x26, 0xE1, 0x40, 0xD0, 0xE1, 0x22, 0xE2, 0xD0, 0x40, 0x24, 0xE1, 0x21, 0xE0, 0x90, 0xE1,
+0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x40, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x20,
+0xE0, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x24, 0xE2, 0x20, 0xD0, 0x40, 0xE2, 0x20, 0xE1,
+0xD1, 0x90, 0x40, 0xE1, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE1, 0x23, 0xD0,
+0x40, 0xE4, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE2, 0x22, 0xD0, 0x90, 0x40, 0xD0, 0xE3, 0x21, 0xE0,
+0xD0, 0x60, 0x90, 0xF0, 0xA0, 0x90, 0xE0, 0x20, 0xE6, 0x40, 0xE0, 0xD0, 0xE0, 0xD0, 0x90, 0x10,
+0x02, 0x70, 0xA0, 0x0F, 0x27, 0x0F, 0x21, 0x30, 0x50, 0xA0, 0xC0, 0x00, 0xA0, 0x90, 0xD0, 0xE3,
+0x20, 0x40, 0x90, 0xE2, 0x20, 0xE1, 0x20, 0xE1, 0x28, 0xE3, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x21,
+0xE0, 0x20, 0xE2, 0x24, 0xE1, 0x91, 0xE1, 0x22, 0xE1, 0x26, 0xD0, 0xE0, 0x40, 0xD1, 0x90, 0x40,
+0xE0, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0xD0, 0xE1, 0x24, 0xE1, 0xD0, 0x40,
+0x90, 0xE3, 0x21, 0xE0, 0x22, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0x40,
+0xE1, 0x22, 0xE1, 0x20, 0xE1, 0x20, 0x90, 0xD0, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0xD1, 0x40, 0xD3, 0xE1, 0xD1, 0xE1, 0x40, 0xE0, 0x23, 0xE2, 0x21, 0x40, 0xE4,
+0x22, 0xE0, 0xD0, 0x91, 0xD0, 0x21, 0xE2, 0x21, 0xE2, 0x90, 0xD0, 0x21, 0xE0, 0x20, 0xE2, 0x21,
+0xE0, 0x91, 0xD0, 0xE0, 0x24, 0xE4, 0x91, 0xE3, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD1, 0x40,
+0xE2, 0x26, 0xE1, 0x21, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x24, 0xE4, 0x20, 0xE0, 0x20, 0xD0,
+0x90, 0x40, 0xE1, 0x27, 0xD0, 0xE0, 0xF0, 0xA0, 0x60, 0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0x90, 0x40,
+0xE1, 0x22, 0xD0, 0x40, 0x30, 0x00, 0x70, 0xA0, 0x81, 0x0F, 0x26, 0x0F, 0x20, 0x50, 0x80, 0x01,
+0x30, 0xA0, 0x40, 0xD0, 0xE1, 0x21, 0xE2, 0x40, 0x90, 0xE0, 0x20, 0xE1, 0x20, 0xE2, 0x28, 0xE1,
+0x20, 0xE1, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x25, 0xE0, 0xD0, 0x40, 0xE2, 0x21, 0xE0,
+0x26, 0xE1, 0xD0, 0x90, 0x40, 0x91, 0xE3, 0x24, 0xE2, 0x40, 0xD0, 0xE2, 0x24, 0xE3, 0x40, 0xE3,
+0x23, 0xE0, 0x20, 0xE0, 0x91, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0x91, 0xE0, 0x20, 0xE0, 0x20,
+0xE1, 0x22, 0xE0, 0x40, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0xE0,
+0x91, 0x40, 0x90, 0x61, 0xA0, 0xD0, 0xE0, 0x90, 0x60, 0xD1, 0x40, 0xE0, 0x20, 0xE2, 0x21, 0xE0,
+0x20, 0xE0, 0x40, 0xE5, 0x20, 0xE1, 0xD0, 0x90, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0xE1,
+0x24, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x24, 0xE5, 0x40, 0xD0, 0xE1, 0x20, 0xE7, 0x40, 0x90,
+0x40, 0x90, 0xE2, 0x25, 0xE1, 0x22, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x21, 0xE2, 0x20,
+0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x23, 0xD0, 0x40, 0xF0, 0x90, 0xA0,
+0x90, 0xD0, 0xE3, 0x90, 0x40, 0xE2, 0x22, 0xE0, 0xD0, 0xB0, 0x31, 0x01, 0x30, 0x70, 0x0F, 0x25,
+0x0F, 0x20, 0x10, 0x02, 0x50, 0xA0, 0xD0, 0xE2, 0x22, 0xE1, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE0,
+0x21, 0xE1, 0x28, 0xE2, 0x20, 0xE0, 0x40, 0xE1, 0x23, 0xE4, 0x25, 0xE1, 0x40, 0xE1, 0x20, 0xE0,
+0x23, 0xE3, 0x20, 0xE0, 0xD0, 0x90, 0xB0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE0,
+0x20, 0xE0, 0xD0, 0x91, 0xE2, 0x24, 0xE3, 0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0,
+0xD0, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0x90, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x40, 0xE2,
+0x24, 0xE0, 0xD0, 0x40, 0xE0, 0xD1, 0xE2, 0x40, 0x60, 0x11, 0xB0, 0x40, 0xB2, 0xD1, 0xA1, 0xE0,
+0xA0, 0x90, 0xE1, 0x20, 0xE3, 0x20, 0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0xD0,
+0x40, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE3, 0x25, 0xE1, 0x90, 0xD0, 0xE0, 0x20, 0xE4,
+0x20, 0xE1, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0x40,
+0xE0, 0xD0, 0x20, 0xE0, 0x23, 0xE4, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x26, 0xE2, 0x23, 0xD0,
+0x90, 0x40, 0xD0, 0xE1, 0x27, 0xE0, 0xD0, 0x90, 0xF0, 0x90, 0xF0, 0xA0, 0x40, 0xD0, 0x20, 0xD0,
+0x40, 0x90, 0xD0, 0xE1, 0x23, 0xE0, 0xD1, 0xA0, 0x70, 0x01, 0xC0, 0xF0, 0x0F, 0x25, 0x0F, 0x1F,
+0xA0, 0x70, 0xA0, 0xC0, 0x00, 0x60, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0xD0, 0xE1, 0x90, 0x40,
+0xE1, 0x24, 0xE0, 0x26, 0xE2, 0x22, 0xE0, 0x40, 0xE2, 0x20, 0xE4, 0x25, 0xE0, 0x20, 0xE1, 0x40,
+0xE2, 0x22, 0xE6, 0x41, 0xD0, 0x40, 0xE1, 0x22, 0xE2, 0x20, 0xE3, 0xD0, 0x40, 0xE3, 0x25, 0xE1,
+0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x24, 0xE0, 0x20, 0xE1,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE0, 0x91, 0xE1, 0x23, 0xE2, 0x40, 0xD1, 0xB2, 0x90, 0xD3,
+0x40, 0xD3, 0xE0, 0x20, 0xD1, 0xE0, 0xB0, 0x90, 0xE0, 0x20, 0xD1, 0xE2, 0x20, 0xE0, 0x91, 0xE1,
+0x20, 0xE0, 0x22, 0xE2, 0x40, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0x22,
+0xE0, 0x40, 0xE0, 0xD0, 0xE0, 0x22, 0xE2, 0x20, 0xE2, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x20,
+0xE0, 0x20, 0xE1, 0x40, 0xD0, 0x41, 0xD0, 0xE2, 0x22, 0xE5, 0x40, 0xE1, 0x24, 0xE0, 0x22, 0xE1,
+0x21, 0xE0, 0x20, 0xD0, 0x90, 0x40, 0xE3, 0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x60, 0xD0,
+0x41, 0xA1, 0xD0, 0x40, 0x90, 0xD0, 0xE2, 0x23, 0xE0, 0x20, 0xE1, 0x60, 0x00, 0x50, 0xA0, 0x70,
+0xA0, 0x0F, 0x24, 0x0F, 0x1E, 0x30, 0x70, 0x01, 0x30, 0xF0, 0xD1, 0x20, 0xE0, 0x25, 0xE1, 0xD1,
+0x90, 0x40, 0xE1, 0x25, 0xE4, 0x26, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE1, 0x26, 0xE1,
+0x20, 0xE0, 0x90, 0x40, 0xE1, 0x21, 0xE4, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x90, 0x40, 0xE1,
+0x21, 0xE3, 0x24, 0x91, 0xE2, 0x21, 0xE0, 0x23, 0xE0, 0xD0, 0x40, 0x20, 0xD0, 0x23, 0xE0, 0x20,
+0xE2, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x20, 0xE0, 0x26, 0xE0, 0x91, 0xE1,
+0x23, 0xE0, 0xD1, 0x90, 0xB0, 0x10, 0x60, 0xD1, 0xE4, 0x40, 0xD1, 0xE0, 0x24, 0xD0, 0xE0, 0x90,
+0xE0, 0xD0, 0x40, 0xF0, 0x90, 0xD0, 0x20, 0xE1, 0x90, 0xE2, 0x24, 0xE1, 0x91, 0xE0, 0x20, 0xE2,
+0x23, 0xE0, 0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE1, 0x24, 0x40, 0xD0, 0xE1, 0x22, 0xE1, 0x22, 0xD0,
+0x40, 0xE1, 0x20, 0xE3, 0x24, 0xE0, 0xD0, 0x40, 0xE0, 0xD1, 0x90, 0x40, 0xE3, 0x22, 0xE2, 0xD0,
+0x40, 0xE0, 0xD0, 0x21, 0xE1, 0x20, 0xE3, 0x24, 0xE1, 0x90, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1,
+0x20, 0xE1, 0x20, 0xE1, 0xD0, 0xF0, 0xA0, 0xD0, 0xA0, 0x60, 0x31, 0xD0, 0xE1, 0x20, 0xE0, 0x22,
+0xE2, 0x21, 0xE0, 0x90, 0xF0, 0x80, 0x01, 0x50, 0x80, 0x0F, 0x23, 0x0F, 0x1D, 0x50, 0xF0, 0x02,
+0x81, 0xD0, 0xE3, 0x23, 0xE0, 0x22, 0xE2, 0x40, 0xE0, 0xD0, 0x25, 0xE4, 0x23, 0xE0, 0x21, 0xE1,
+0x40, 0xE2, 0x20, 0xE1, 0x2A, 0xD0, 0x91, 0xE0, 0x20, 0xE4, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE1,
+0x91, 0xE4, 0x20, 0xE0, 0x24, 0xE0, 0x40, 0xE3, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x91, 0xE1, 0x24,
+0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xE1, 0x23, 0xE0, 0x20,
+0xE0, 0x91, 0xD0, 0xE0, 0x22, 0xE0, 0xD0, 0xE0, 0x90, 0xA0, 0x60, 0x40, 0xD1, 0xE1, 0x20, 0xE2,
+0x40, 0xD0, 0xE0, 0x25, 0xE0, 0x91, 0xE1, 0xD0, 0xA0, 0xB0, 0xD0, 0xE0, 0x20, 0xD0, 0x40, 0xE1,
+0x20, 0xE0, 0x23, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0xE1, 0x22, 0xE1,
+0x22, 0x40, 0xE0, 0xD0, 0xE2, 0x21, 0xE1, 0x21, 0xE0, 0x91, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x22,
+0xE1, 0x91, 0xD0, 0x20, 0xE2, 0x40, 0xE2, 0x21, 0xE2, 0xD0, 0x40, 0xE1, 0x21, 0xE2, 0x21, 0xE3,
+0x23, 0xE0, 0x90, 0x40, 0xE5, 0x23, 0xE5, 0xD0, 0x40, 0x60, 0xD1, 0x90, 0x30, 0xA0, 0x90, 0xD0,
+0xE1, 0x20, 0xE0, 0xD1, 0xE2, 0x90, 0x20, 0xE0, 0xD0, 0xB0, 0x50, 0x02, 0x10, 0x70, 0x0F, 0x22,
+0x0F, 0x1C, 0xC0, 0x30, 0xC0, 0xA0, 0xC0, 0x50, 0x30, 0xD0, 0xE0, 0x20, 0xE0, 0x28, 0xE0, 0x20,
+0xE2, 0x40, 0x90, 0xE1, 0x22, 0xE0, 0x23, 0xE0, 0x23, 0xE0, 0x22, 0xE1, 0x40, 0xE2, 0x20, 0xE0,
+0x2A, 0xE1, 0x91, 0xE3, 0xD1, 0x40, 0x90, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x25,
+0xE1, 0x40, 0xD0, 0xE3, 0x24, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x24, 0xE2, 0xD0, 0x40, 0xE1, 0x23,
+0xE4, 0x40, 0xE0, 0x21, 0xE2, 0x21, 0xD0, 0xE0, 0x40, 0xE0, 0x23, 0xD1, 0xB0, 0x10, 0x30, 0x90,
+0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0x91, 0xD0, 0xE1,
+0x20, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE2, 0x21, 0xE2, 0x40, 0xD0, 0x24, 0xE3,
+0x91, 0xE2, 0x21, 0xE1, 0x20, 0xE2, 0x40, 0xD0, 0xE3, 0x20, 0xE1, 0x22, 0xD0, 0x40, 0xE1, 0x24,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x41, 0xD0, 0xE1, 0x20, 0xE1,
+0x90, 0xB0, 0xE1, 0x22, 0xE0, 0xD0, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE2,
+0x26, 0xE3, 0xD0, 0xB0, 0x40, 0x10, 0xD0, 0x91, 0x40, 0x60, 0xF0, 0xD0, 0xE0, 0x21, 0xE0, 0x40,
+0xB0, 0xD1, 0xE0, 0xF0, 0x22, 0xD0, 0xA0, 0xC0, 0x50, 0xA0, 0xC0, 0xA0, 0x0F, 0x22, 0x0F, 0x1C,
+0xA0, 0x02, 0x30, 0x60, 0xD0, 0xE0, 0x2D, 0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x21,
+0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x21, 0xE3, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xE0, 0x21,
+0xE2, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x40,
+0xE2, 0x25, 0xE3, 0x91, 0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xE2, 0x91, 0xE2, 0x23, 0xE1, 0xD0, 0xE0,
+0x40, 0xE0, 0x23, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x23, 0xE0, 0x40, 0xD0,
+0xE1, 0xD1, 0x60, 0x11, 0x40, 0xE0, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE2, 0x40, 0xD0, 0xE2,
+0x23, 0xE0, 0x91, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x20,
+0x90, 0xD0, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE2,
+0x21, 0xE0, 0x23, 0xD0, 0x91, 0xE2, 0x25, 0xE1, 0x20, 0xD0, 0x40, 0xE1, 0x21, 0xE1, 0x21, 0xD0,
+0x90, 0x40, 0xE2, 0xD0, 0x91, 0xE3, 0x20, 0xD0, 0x60, 0xB0, 0xD1, 0xE0, 0x20, 0xE3, 0xD0, 0x90,
+0x40, 0xD0, 0xE4, 0x27, 0xE2, 0xD0, 0xB0, 0x90, 0x41, 0x90, 0xD1, 0x40, 0x60, 0xA0, 0xD0, 0xE0,
+0x20, 0xD0, 0x90, 0x10, 0xD0, 0x20, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0xF0, 0x80, 0x01,
+0xC0, 0x30, 0x0F, 0x21, 0x0F, 0x1B, 0x80, 0xA0, 0x02, 0xA0, 0xD0, 0xE2, 0x21, 0xE0, 0x22, 0xE2,
+0x21, 0xE1, 0x20, 0xD0, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE2, 0x27, 0xE0, 0x20, 0xE6, 0x40,
+0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x90,
+0x40, 0xE1, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x23,
+0xE4, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xE2, 0xD0, 0x40, 0xE3, 0x23, 0xE1, 0xD0, 0x40, 0xE1,
+0x22, 0xE3, 0xD0, 0x91, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0xE1, 0xB1, 0xA0, 0x10, 0xA0, 0xD1, 0x91,
+0xD0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xE0, 0x40, 0xE2, 0x22,
+0xE2, 0x91, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xD0, 0x91, 0xE0, 0x22, 0xE1, 0x21, 0xE0, 0x90, 0x40,
+0xD0, 0x20, 0xE1, 0x21, 0xE4, 0x40, 0xD0, 0x20, 0xE0, 0x26, 0xE1, 0x40, 0xE1, 0x20, 0xE4, 0x23,
+0xD0, 0x40, 0x90, 0xD0, 0x20, 0xE1, 0x22, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0x90, 0x40, 0xE4,
+0x20, 0xE3, 0xA0, 0xD1, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x21, 0xE3, 0x25, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0xD0, 0xB0, 0xA0, 0xB0, 0xD0, 0xE2, 0x90,
+0xE2, 0xD0, 0xB0, 0x90, 0xE1, 0xD0, 0x40, 0xA0, 0x01, 0xC0, 0x60, 0x50, 0x0F, 0x20, 0x0F, 0x1A,
+0x70, 0x30, 0x00, 0xA0, 0x50, 0x80, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE5, 0x22, 0xE1,
+0x23, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x27, 0xE3, 0x21, 0xE1, 0x40, 0x90, 0xE0,
+0x22, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE5, 0x40, 0x90, 0x40, 0xE1, 0x22, 0xE1, 0x22, 0xE0,
+0x20, 0xD0, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0x22, 0xE4, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0x22, 0xE2,
+0x91, 0xD0, 0xE1, 0x24, 0xE0, 0xD0, 0x91, 0xD0, 0x22, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x40, 0xD0,
+0x26, 0xE0, 0x90, 0xE0, 0x90, 0x12, 0xA0, 0xD1, 0xE1, 0x90, 0xD0, 0xE1, 0xB1, 0xD0, 0xE2, 0x40,
+0xD1, 0x25, 0xD0, 0x40, 0xE2, 0x21, 0xE2, 0xD0, 0xB1, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE0,
+0xD0, 0x40, 0xE0, 0xD8, 0x91, 0xE1, 0xD0, 0xE1, 0x20, 0xE1, 0x20, 0xD0, 0x91, 0xE0, 0x21, 0xE1,
+0x24, 0xD0, 0x91, 0xE1, 0x21, 0xE4, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0x21, 0xD0, 0xE0, 0x40, 0x90, 0x40, 0xE2, 0x20, 0xE3, 0x21, 0xE0, 0x90, 0x40, 0xA0,
+0xE2, 0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0x40,
+0xE2, 0x21, 0xD0, 0x40, 0x60, 0x30, 0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x90, 0xA1, 0xD0, 0xE1, 0xD0,
+0xB0, 0x80, 0x50, 0x30, 0x00, 0xA0, 0x0F, 0x20, 0x0F, 0x1A, 0xA0, 0x02, 0x30, 0x60, 0xD0, 0xE1,
+0x20, 0xE0, 0x21, 0xE5, 0x22, 0xE0, 0x25, 0xE2, 0x40, 0xE3, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xD0,
+0xE0, 0x20, 0xE3, 0x40, 0xE6, 0x24, 0xE3, 0xD0, 0x40, 0xB0, 0xD1, 0xE0, 0x25, 0xE1, 0x21, 0xE1,
+0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x21, 0xE4, 0x40, 0xE2, 0x20, 0xE2, 0x21, 0xE2, 0x40, 0xD0, 0xE1,
+0x23, 0xE3, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0xD0, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0x91,
+0x31, 0xA0, 0xB0, 0xD1, 0xE2, 0x90, 0xE5, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x25, 0xD0, 0x40, 0xE8,
+0x90, 0xB0, 0xF0, 0xD0, 0x20, 0xE0, 0xD4, 0x40, 0xD0, 0x80, 0x30, 0xB0, 0x30, 0xA1, 0x90, 0x60,
+0xA0, 0xB0, 0xE0, 0xD0, 0x40, 0x60, 0x40, 0xE1, 0xD2, 0x20, 0x40, 0xE0, 0x20, 0xE4, 0x21, 0xE1,
+0x90, 0x40, 0xD0, 0x24, 0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0x21, 0xD1,
+0xB0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0xA0, 0x90, 0xD0, 0x90,
+0x40, 0xE4, 0x25, 0xE2, 0x20, 0xE0, 0x22, 0xD0, 0xE0, 0x40, 0xE1, 0xD0, 0xE0, 0x22, 0x40, 0x10,
+0x50, 0xA0, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xD0, 0xA1, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0xD0, 0xF0,
+0x80, 0x01, 0xC0, 0x30, 0x0F, 0x1F, 0x0F, 0x10, 0xC0, 0x31, 0x05, 0x80, 0xF0, 0x02, 0xA0, 0x90,
+0x40, 0x90, 0xE0, 0x20, 0xE2, 0x20, 0xE2, 0x23, 0xE1, 0x24, 0xE0, 0x20, 0xE2, 0x40, 0xE3, 0x21,
+0xE1, 0x23, 0xE0, 0x22, 0xE0, 0x20, 0xE2, 0x40, 0xE0, 0xD0, 0xE3, 0x23, 0xE3, 0xD0, 0x40, 0x91,
+0x40, 0xD0, 0xE1, 0x22, 0xE2, 0x23, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x20,
+0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xD0, 0xE0, 0x23, 0xE2,
+0xD0, 0x40, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE3, 0xD0, 0xB0, 0xE0, 0x80, 0x10, 0xA0,
+0xB0, 0xD0, 0xE2, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0x22, 0xE0, 0x20, 0xE1,
+0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x20, 0xE1, 0x40, 0xD0, 0x90, 0xD2, 0x90, 0xA0, 0x90, 0xD0, 0x10,
+0xA0, 0x10, 0x80, 0xC0, 0x50, 0xF0, 0xA0, 0x60, 0x41, 0x91, 0xD0, 0xE0, 0x20, 0xB0, 0x90, 0xD0,
+0x61, 0x90, 0xD0, 0x40, 0x90, 0xD0, 0xE2, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE1,
+0x24, 0xE3, 0x20, 0xE0, 0x40, 0x90, 0xD0, 0x23, 0xE0, 0x21, 0xE0, 0x21, 0xE2, 0x40, 0xE0, 0x90,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD1, 0x90, 0x40, 0xE4, 0x26,
+0xE2, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xD0, 0x90, 0xA0, 0x50, 0x40,
+0xE1, 0x22, 0xE0, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xA0, 0x01, 0xC0, 0x10, 0x50,
+0x0F, 0x1E, 0x0F, 0x10, 0x80, 0x50, 0x80, 0xC0, 0x03, 0x70, 0x30, 0x00, 0xA0, 0x50, 0x30, 0x40,
+0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x25, 0xE0, 0x25, 0xE5, 0x40, 0x90, 0xD0, 0xE1, 0x20,
+0xE4, 0x22, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE0, 0x23, 0xE1, 0x40,
+0xE1, 0xD0, 0x91, 0xE0, 0x23, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x40, 0x90, 0xD0, 0x24, 0xE1, 0x20,
+0xE1, 0xD0, 0x40, 0xE4, 0x24, 0xE1, 0x40, 0xE2, 0x22, 0xE3, 0x91, 0xE0, 0x23, 0xE3, 0x91, 0xE4,
+0xD0, 0xB0, 0x90, 0xD0, 0x60, 0x80, 0xA0, 0xD2, 0x40, 0x90, 0xE0, 0xD0, 0x40, 0xD1, 0x20, 0xE5,
+0x40, 0xD0, 0x22, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0x21, 0xE1, 0x22, 0xE0, 0x40, 0xD2, 0x40, 0x90,
+0xA0, 0x50, 0x30, 0xA0, 0x50, 0xC1, 0x00, 0xC0, 0xF0, 0xD4, 0x40, 0x20, 0xE0, 0x20, 0xE0, 0xD0,
+0xE1, 0x20, 0xB0, 0x40, 0x60, 0x40, 0xD2, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x91, 0xD0, 0xE1, 0x23,
+0xE0, 0x22, 0xE0, 0x91, 0xD0, 0xE2, 0x22, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x91, 0xD1, 0x90, 0x40,
+0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE2, 0xD0, 0x90, 0x40, 0xD1, 0xE0, 0x21, 0xE0, 0x24, 0xE5, 0x20,
+0xE0, 0xD0, 0x40, 0x90, 0xE5, 0xD1, 0x21, 0xD0, 0xB0, 0xD0, 0xA0, 0xD0, 0x20, 0xD0, 0xF0, 0xB0,
+0xD0, 0xE0, 0xD0, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD1, 0xB0, 0x81, 0x30, 0x00, 0xA0, 0xC0, 0x0F,
+0x1D, 0x0F, 0x11, 0x80, 0x50, 0x04, 0xA0, 0x02, 0x31, 0xD0, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xE4,
+0x25, 0xE0, 0x24, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE6, 0x24, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0x40, 0x90, 0xE3, 0x23, 0xE1, 0x40, 0xE0, 0xD0, 0xE1, 0xD0, 0x40, 0x90, 0xE2,
+0x21, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0x40,
+0xD0, 0xE3, 0x24, 0xD0, 0x90, 0xE2, 0x23, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE3, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0xD0, 0x10, 0xF0, 0x80, 0xA0, 0x10, 0x30, 0xB1, 0x60,
+0x10, 0xB0, 0xD0, 0x91, 0x30, 0xB0, 0xE0, 0x20, 0xE1, 0x41, 0xD0, 0x40, 0xD0, 0x22, 0xE4, 0x40,
+0xD0, 0x21, 0xE1, 0x20, 0xE1, 0x20, 0x40, 0xD1, 0xE0, 0x10, 0x60, 0x50, 0x02, 0x50, 0x02, 0x30,
+0xB0, 0xD0, 0x20, 0xE1, 0xD0, 0x40, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD1, 0x40, 0xA0, 0xF0,
+0x60, 0xA0, 0xD0, 0xE0, 0xD0, 0x22, 0xE0, 0xD0, 0x40, 0xE4, 0x27, 0x40, 0xD0, 0xE1, 0x22, 0xE1,
+0x20, 0x91, 0xE0, 0x20, 0xE0, 0x91, 0xE2, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x21, 0xE0, 0x20, 0xE2,
+0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE2, 0x26, 0xE1, 0x21, 0xE3, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0xD0, 0xA0, 0xD0, 0xE2, 0xD0, 0xA0, 0x30, 0x90, 0xD0, 0xE0, 0x20, 0x90, 0xE1, 0xD1,
+0x90, 0x40, 0x90, 0xD0, 0x20, 0xE0, 0xD0, 0x60, 0x80, 0x01, 0xC0, 0x30, 0x0F, 0x1D, 0x0F, 0x10,
+0x70, 0x05, 0x80, 0x60, 0xC0, 0x01, 0x60, 0xD0, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0,
+0xE1, 0x24, 0xE1, 0x21, 0xE5, 0x21, 0xE3, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE3, 0x24, 0xE2, 0x20,
+0xE2, 0x40, 0xE3, 0x21, 0xE2, 0x40, 0xE0, 0xD0, 0xE2, 0x20, 0xE0, 0x40, 0xE5, 0x21, 0xE1, 0x21,
+0xE1, 0x90, 0x40, 0xD0, 0x21, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0x22, 0xE0, 0x22,
+0xE2, 0x40, 0xD0, 0x21, 0xE0, 0x22, 0xE1, 0xD0, 0x40, 0xE1, 0x26, 0xD0, 0x40, 0xE0, 0x21, 0xE0,
+0xD0, 0xA0, 0x11, 0x60, 0x80, 0xF0, 0x11, 0x30, 0x70, 0xC0, 0x60, 0xA0, 0x10, 0x30, 0x10, 0xF0,
+0x20, 0xE0, 0x20, 0xE0, 0x40, 0xB0, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE5, 0x90, 0xE1, 0xD2, 0xE3,
+0x90, 0xD1, 0xA0, 0xB0, 0x04, 0x50, 0x01, 0x50, 0x30, 0xD0, 0xE0, 0x20, 0xE1, 0x91, 0xE0, 0x23,
+0xE1, 0xD0, 0xE1, 0x40, 0xD0, 0x90, 0xB0, 0x10, 0x60, 0xF0, 0x30, 0xD0, 0xE2, 0x91, 0xE3, 0x24,
+0xE2, 0x40, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x90,
+0x40, 0xE2, 0x22, 0xE1, 0x90, 0x40, 0xD0, 0xE3, 0x23, 0xE1, 0x25, 0xD0, 0xE1, 0x40, 0xE0, 0xD0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x90, 0x60, 0xD0, 0xE2, 0xD0, 0xA0, 0xB0, 0x40, 0xD0, 0xE1,
+0xD1, 0x90, 0x60, 0x90, 0x40, 0xE1, 0xD0, 0x21, 0xE0, 0x90, 0xA0, 0x01, 0x70, 0xF0, 0x50, 0x0F,
+0x1C, 0x0F, 0x0E, 0x70, 0xF0, 0xA0, 0x10, 0x30, 0x02, 0x70, 0x30, 0x00, 0xA0, 0x80, 0x30, 0x40,
+0xD0, 0x22, 0xD0, 0xE1, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x26, 0xE5, 0x21, 0xE0, 0x21, 0xE2,
+0x40, 0xE5, 0x26, 0xE2, 0x20, 0xE2, 0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE0, 0x40, 0xE0, 0xD0, 0xE1,
+0x22, 0xE1, 0x40, 0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0x90, 0xE1, 0x24,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x25, 0xE1, 0xD0, 0x90, 0xE0, 0x22, 0xE1, 0x22,
+0xD0, 0x91, 0xD0, 0xE0, 0x25, 0xE0, 0x40, 0xE0, 0xD0, 0x21, 0xD0, 0xA0, 0x10, 0x60, 0x51, 0x30,
+0xC0, 0x00, 0x10, 0x01, 0x80, 0x30, 0x10, 0xF0, 0x30, 0xD0, 0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE1,
+0xD0, 0xE0, 0xD2, 0xE0, 0x90, 0xD0, 0x90, 0x30, 0xF0, 0xB0, 0xD3, 0xB0, 0xA0, 0xB0, 0x60, 0x80,
+0x03, 0xC0, 0x70, 0x01, 0x60, 0xD1, 0xE3, 0x40, 0xE1, 0x24, 0xE2, 0x91, 0xD3, 0x60, 0x10, 0x80,
+0x60, 0xD1, 0xE0, 0x40, 0xD0, 0xE0, 0xD3, 0xE1, 0xD0, 0xE2, 0x91, 0xD0, 0xE1, 0x24, 0xE0, 0x21,
+0xD1, 0xE0, 0x40, 0xD0, 0xE3, 0x21, 0xE1, 0x40, 0x90, 0xE3, 0xD0, 0x90, 0x40, 0xE1, 0xD0, 0x26,
+0xE2, 0x22, 0xE3, 0x40, 0xE0, 0xD0, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0xF0, 0x40, 0xD0, 0xE1, 0xD0,
+0x90, 0xF0, 0xB0, 0xD0, 0x20, 0xD0, 0xE0, 0xD0, 0x60, 0xA0, 0x40, 0xD1, 0xE1, 0x22, 0xD0, 0xB0,
+0x80, 0x31, 0x00, 0x60, 0x0F, 0x1C, 0x0F, 0x0E, 0x30, 0xC0, 0x01, 0x80, 0x10, 0x01, 0xA0, 0x02,
+0x80, 0x30, 0xD0, 0x22, 0xE0, 0x20, 0xE3, 0x20, 0x40, 0xE0, 0xB0, 0x20, 0xE0, 0x22, 0xE0, 0x20,
+0xE4, 0x26, 0xE3, 0x40, 0xE0, 0xD0, 0xE0, 0x27, 0xE4, 0x23, 0x40, 0x90, 0xE0, 0x20, 0xD0, 0x90,
+0x40, 0xD1, 0xE1, 0x22, 0xE0, 0x20, 0xD0, 0xE0, 0x40, 0xE4, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE1, 0x40, 0xE2, 0x22, 0xE0, 0x21, 0xE0, 0x20, 0xD0, 0x91, 0x21, 0xE0, 0x22, 0xE4, 0x40,
+0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE0,
+0x21, 0xE0, 0xD0, 0x60, 0x30, 0x10, 0xF0, 0x80, 0x06, 0x81, 0x60, 0xA0, 0xD0, 0xE0, 0xD1, 0xE2,
+0x40, 0xD0, 0x21, 0xE0, 0x41, 0xD0, 0x90, 0xB0, 0x30, 0x10, 0x60, 0x70, 0x00, 0x30, 0xA1, 0x10,
+0x31, 0xF1, 0xB0, 0x04, 0x71, 0x80, 0x60, 0xD1, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x21, 0xE0,
+0x21, 0xD0, 0xE0, 0x40, 0xE3, 0xD1, 0xA0, 0x70, 0xC0, 0xA0, 0x60, 0xB0, 0xE0, 0xD1, 0xB0, 0xA0,
+0xB1, 0xD1, 0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x24, 0xE0, 0xD0, 0xE0, 0x40,
+0xD1, 0x20, 0xE2, 0x23, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE2, 0x25, 0xE2,
+0x23, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x23, 0xE1, 0xD0, 0xB0, 0xF0, 0xD0, 0xE0, 0x20,
+0xE0, 0xD0, 0xF0, 0xB0, 0xD0, 0xE1, 0xD0, 0x90, 0x30, 0xA2, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xD0,
+0x60, 0x70, 0x02, 0xA0, 0x05, 0x70, 0x0F, 0x14, 0x0F, 0x0E, 0x80, 0x30, 0x02, 0x50, 0x30, 0x50,
+0x60, 0x70, 0x01, 0xA0, 0xD0, 0xE0, 0x23, 0xE0, 0x23, 0xD1, 0x91, 0xE3, 0x21, 0xE5, 0x25, 0xE1,
+0x21, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x26, 0xE3, 0x23, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x90,
+0x40, 0xE3, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE2, 0x23, 0xE1, 0x20, 0xE1,
+0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0xD0, 0x40, 0x22, 0xE0, 0x21, 0xE3, 0xD0, 0x40,
+0x20, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x90, 0xE1, 0x22, 0xE1, 0x20, 0xE1, 0x90, 0xE0, 0x21, 0xD0,
+0xB0, 0x10, 0xB0, 0x11, 0x70, 0x07, 0x70, 0x60, 0x90, 0xE1, 0xB0, 0x40, 0x90, 0xD0, 0xE0, 0x40,
+0xD0, 0x20, 0xE0, 0xD0, 0xF0, 0xB0, 0xF0, 0xB0, 0x80, 0x70, 0xC0, 0x04, 0xC0, 0x50, 0x80, 0xA0,
+0x80, 0xC1, 0x70, 0xB0, 0xA0, 0x60, 0x31, 0x60, 0xB0, 0xE0, 0xD0, 0x20, 0xE3, 0x91, 0xE2, 0x22,
+0xE0, 0x20, 0xE0, 0x91, 0xE4, 0xD0, 0x40, 0x80, 0x01, 0xC0, 0x30, 0xD0, 0x90, 0xB1, 0xC0, 0x50,
+0x60, 0xA3, 0xF0, 0x30, 0xB0, 0xD1, 0xE0, 0x90, 0xE2, 0x22, 0xE2, 0x40, 0x90, 0xE0, 0x20, 0xE1,
+0x21, 0xE0, 0x22, 0xE1, 0x40, 0x90, 0xD0, 0x90, 0x40, 0xE3, 0x25, 0xE3, 0x20, 0xE3, 0x91, 0xE5,
+0x23, 0xE0, 0x20, 0xE0, 0xA0, 0xE0, 0x22, 0xD0, 0x90, 0xB0, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0x40,
+0xB1, 0x10, 0xD1, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0xA0, 0x01, 0x70, 0xF0, 0x70, 0x02, 0x30, 0x60,
+0xA0, 0x60, 0xC0, 0x0F, 0x12, 0x0F, 0x0D, 0x70, 0xC0, 0x30, 0xA0, 0xC0, 0x00, 0xC0, 0x60, 0x30,
+0x00, 0x30, 0x80, 0xB0, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0,
+0xE1, 0x20, 0xE1, 0x22, 0xE2, 0x22, 0xE1, 0x21, 0xE2, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE3,
+0x23, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x23, 0xE0, 0x20, 0xE1,
+0x20, 0xD0, 0x91, 0xD0, 0x20, 0xE3, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE2, 0x23, 0xE1,
+0xD0, 0x91, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x90,
+0xE3, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0xD0, 0x90, 0x10, 0xF1, 0x30, 0xC0, 0x50, 0x06, 0x70, 0x61,
+0xD0, 0x20, 0x90, 0x60, 0xF1, 0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0xD0, 0x10, 0xC1, 0x00, 0x70, 0x08,
+0x80, 0xA0, 0x30, 0xA0, 0x30, 0xB0, 0x40, 0xD0, 0xE0, 0x41, 0xD3, 0x21, 0xE1, 0xD0, 0x40, 0x21,
+0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xB0, 0xD0, 0x20, 0xD0, 0x60, 0xA0, 0xC0, 0xB0, 0x50,
+0x01, 0x50, 0xA0, 0x50, 0x60, 0x10, 0x70, 0x02, 0xC0, 0x02, 0x50, 0xA0, 0x10, 0x40, 0x91, 0x40,
+0xE1, 0x21, 0xE3, 0x91, 0xD0, 0xE1, 0x22, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x42, 0xD1, 0xE1,
+0x26, 0xE4, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x25, 0xE0, 0x21, 0xD1, 0xE0, 0x20, 0xE2,
+0xF0, 0x91, 0x40, 0xE0, 0xD1, 0xE0, 0xF0, 0x10, 0xB0, 0xD0, 0xE5, 0xD0, 0xB0, 0x80, 0x30, 0x80,
+0x00, 0xA0, 0x01, 0x10, 0xF0, 0xA0, 0x00, 0x70, 0x30, 0x0F, 0x12, 0x0F, 0x0C, 0xA1, 0x61, 0x80,
+0x60, 0xF1, 0xA0, 0x02, 0x50, 0xA0, 0xD0, 0xE0, 0x21, 0xE1, 0x24, 0xD0, 0xA0, 0x40, 0xE1, 0xD0,
+0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0x20, 0xE2, 0x90, 0x40,
+0xE5, 0x25, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xB0, 0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x21,
+0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0x40,
+0xE0, 0xD0, 0xE1, 0x24, 0xE2, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x21, 0xE1, 0x40, 0xE2, 0x24, 0xE0,
+0xD0, 0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xB0, 0xF0, 0x70, 0x80, 0x10, 0xC0,
+0x00, 0x50, 0x05, 0x50, 0x10, 0x80, 0xD6, 0x60, 0xF0, 0xB0, 0xD3, 0xA0, 0x30, 0x01, 0x50, 0x06,
+0x30, 0x50, 0xA0, 0xF0, 0xA2, 0xD1, 0xE1, 0x90, 0xD1, 0xE1, 0x22, 0xE0, 0xD0, 0xE0, 0x40, 0xE0,
+0x25, 0xE0, 0xD1, 0x60, 0x10, 0xD1, 0x40, 0x30, 0xA0, 0x60, 0xA4, 0x30, 0x12, 0x60, 0x30, 0x10,
+0xA2, 0xC0, 0x00, 0x70, 0x00, 0x50, 0x10, 0xA0, 0xD1, 0xE0, 0x22, 0xE1, 0xD0, 0x91, 0xE1, 0x20,
+0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x90, 0xB0, 0x90, 0xE4, 0x24, 0xE6, 0xD0, 0x40, 0x90,
+0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x27, 0xE0, 0x20, 0xE1, 0x21, 0xD0, 0x41, 0x60, 0xE0, 0xD0, 0xE0,
+0xD0, 0xA0, 0x10, 0x80, 0xA0, 0xD0, 0x20, 0xE2, 0x21, 0xE0, 0xD0, 0xF0, 0x70, 0x01, 0x70, 0x80,
+0xA0, 0x50, 0x00, 0x70, 0x30, 0x80, 0x30, 0x0F, 0x12, 0x0F, 0x0B, 0xC0, 0xA0, 0x01, 0xC0, 0xF0,
+0x80, 0x00, 0xC0, 0xF0, 0x70, 0x01, 0x60, 0xD1, 0x22, 0xE2, 0x21, 0xE1, 0x40, 0xB0, 0x22, 0xE0,
+0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x28, 0xE1, 0x26, 0xE2, 0x40, 0xE3, 0x27, 0xE0, 0x20, 0xE0, 0xD0,
+0x90, 0x40, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x20, 0xE2, 0x40,
+0x90, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x40, 0xE2, 0x25, 0xE2, 0x40, 0xE3,
+0x24, 0xE0, 0x90, 0x40, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE1, 0x91, 0x11, 0xF0, 0x10, 0x50, 0x01, 0x50, 0x05, 0xA0, 0x80, 0x60, 0x30, 0x60, 0xF0, 0x90,
+0xD1, 0xB0, 0x10, 0xC0, 0xB0, 0xA0, 0x40, 0x50, 0xA0, 0x30, 0x12, 0x70, 0x06, 0x50, 0x60, 0xA0,
+0xC0, 0x00, 0x60, 0xA0, 0xD3, 0x50, 0x10, 0xB0, 0xD1, 0x22, 0xE1, 0x91, 0xE0, 0x21, 0xE0, 0x20,
+0xE2, 0xD0, 0x30, 0x70, 0x80, 0xA1, 0x10, 0x30, 0x60, 0xB0, 0xD0, 0xA0, 0x91, 0xD0, 0xA1, 0xF0,
+0xA0, 0xD0, 0xE1, 0xD2, 0x10, 0x30, 0x70, 0x01, 0x50, 0x60, 0x90, 0xD0, 0x21, 0xE0, 0x20, 0xE0,
+0xD0, 0x90, 0x40, 0xD0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0xD0, 0x90, 0x40, 0xE0,
+0x40, 0x90, 0xD0, 0xE0, 0x24, 0xE3, 0x21, 0xE0, 0xD0, 0xE0, 0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x90, 0xB0, 0x30,
+0x40, 0xA0, 0xD2, 0xA0, 0xF0, 0x00, 0x10, 0xD0, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0x30, 0x01,
+0x50, 0xF1, 0x01, 0x50, 0xA0, 0x0F, 0x14, 0x0F, 0x0C, 0xF0, 0x70, 0x02, 0x60, 0x70, 0xA0, 0x00,
+0x82, 0xB0, 0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE2, 0x90, 0xB0, 0xD0, 0x23, 0xE2, 0x40, 0x90, 0xE3,
+0x23, 0xE1, 0x23, 0xE0, 0x24, 0xE0, 0xD0, 0xE0, 0x40, 0xE3, 0x23, 0xE1, 0x21, 0xE1, 0x90, 0x40,
+0xD1, 0xE0, 0x40, 0x90, 0xD0, 0x21, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40,
+0xE4, 0x23, 0xE1, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0x20,
+0xE1, 0x24, 0xE1, 0x40, 0xE5, 0x20, 0xE2, 0x40, 0xE5, 0xD1, 0xA1, 0x10, 0xF0, 0x60, 0x70, 0x03,
+0x70, 0xC0, 0x04, 0x70, 0xF0, 0x71, 0xC0, 0xA0, 0x10, 0x40, 0xB0, 0xF0, 0x30, 0xC0, 0x70, 0x50,
+0x30, 0x10, 0x80, 0x00, 0xC2, 0x50, 0x07, 0x70, 0xC0, 0x01, 0x80, 0xA0, 0xB1, 0x30, 0xA0, 0x32,
+0xF0, 0x40, 0xD0, 0x22, 0xE0, 0x40, 0xE1, 0x20, 0xE1, 0xD2, 0x90, 0x60, 0x50, 0x00, 0x50, 0xA0,
+0x60, 0x90, 0xD3, 0xE0, 0x91, 0xD2, 0x91, 0x22, 0xE1, 0xD0, 0xB0, 0x40, 0xA0, 0x50, 0x01, 0xC0,
+0x60, 0xD0, 0xE5, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE0, 0x20, 0xE3, 0x90, 0x40, 0xE0, 0xD0,
+0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x25, 0xE2, 0x90, 0x40, 0xE1, 0x26, 0xE0, 0x22, 0xE0, 0x20,
+0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xD0, 0x50, 0xB0, 0x80, 0x40, 0xD0, 0xB0, 0xA0, 0x30, 0x00,
+0xA0, 0xD0, 0x21, 0xE0, 0x23, 0xE0, 0xD0, 0x30, 0x50, 0x30, 0x50, 0x00, 0xF0, 0xA1, 0x60, 0x00,
+0x70, 0x31, 0xC0, 0x0F, 0x10, 0x0F, 0x0C, 0x70, 0xF0, 0x80, 0x01, 0x31, 0x50, 0x01, 0x70, 0xF0,
+0xD0, 0xE2, 0x22, 0xE4, 0xD0, 0x90, 0xE0, 0x24, 0xE1, 0x20, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x20,
+0xE0, 0x27, 0xE0, 0x24, 0xE3, 0x40, 0x90, 0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0xE4,
+0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x40, 0xE0, 0xD0, 0xE1, 0x26, 0xE1,
+0x40, 0xE0, 0xD0, 0xE1, 0x22, 0xE1, 0x20, 0xE1, 0x40, 0xE4, 0x22, 0xE1, 0x91, 0xD3, 0xE2, 0xD1,
+0x90, 0xE0, 0xD4, 0x40, 0xA0, 0x81, 0xC0, 0x00, 0x80, 0x04, 0xC0, 0x70, 0x06, 0x70, 0x80, 0x70,
+0x60, 0xB0, 0xE0, 0xA1, 0x00, 0xF0, 0x80, 0x00, 0xC0, 0xF0, 0xC0, 0x03, 0x50, 0x07, 0x70, 0x04,
+0x51, 0xC1, 0x50, 0x01, 0xF0, 0x10, 0xD1, 0xE1, 0x91, 0xD0, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0xA0,
+0x60, 0x81, 0xA0, 0x80, 0xD1, 0x80, 0xB0, 0x90, 0xD1, 0xE0, 0x40, 0xD0, 0xE4, 0x21, 0xE0, 0x20,
+0xE0, 0x91, 0xD0, 0xB0, 0x10, 0x50, 0x01, 0x10, 0x60, 0xD1, 0xE2, 0x40, 0xE2, 0x20, 0xE0, 0x23,
+0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE2, 0x40, 0xE2, 0x25, 0xE2, 0x90, 0x40, 0xD0,
+0xE0, 0x25, 0xE1, 0x20, 0xE0, 0x26, 0xE1, 0xD0, 0xE0, 0x40, 0x91, 0xA0, 0x50, 0xB0, 0x70, 0x30,
+0x50, 0xF0, 0x80, 0x70, 0x00, 0x30, 0x90, 0xE2, 0x23, 0xE2, 0x10, 0x02, 0x81, 0x70, 0x00, 0x30,
+0xF0, 0x51, 0x60, 0x0F, 0x10, 0x0F, 0x0A, 0x80, 0x60, 0x01, 0x80, 0x10, 0xF0, 0x30, 0x10, 0xF0,
+0xC0, 0x00, 0xB0, 0x90, 0xD0, 0x21, 0xE0, 0x21, 0xE5, 0x20, 0xE2, 0x20, 0xE7, 0x40, 0x90, 0xD0,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x2A, 0xE3, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE4, 0x20, 0x40,
+0xE1, 0x20, 0xE3, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0xD0, 0x90, 0x40,
+0xD0, 0xE1, 0x26, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0xE3,
+0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xB1, 0xF0, 0x10, 0x60, 0xD1, 0xE0, 0x90, 0xB2, 0x40, 0xD0, 0xB1,
+0xA0, 0xF0, 0x10, 0x80, 0x00, 0x70, 0x08, 0x50, 0x05, 0x60, 0x10, 0xA0, 0xF0, 0x90, 0xD2, 0x90,
+0xA0, 0x61, 0x07, 0x50, 0x07, 0x50, 0x07, 0xC0, 0x70, 0x01, 0xC0, 0x60, 0xA0, 0xE0, 0xD1, 0x40,
+0xE5, 0x90, 0x10, 0x30, 0x70, 0x30, 0x10, 0x30, 0xA0, 0x60, 0xB1, 0x50, 0xB0, 0xA1, 0xB1, 0xD3,
+0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x40, 0xD1, 0xE0, 0x30, 0xA0, 0x30, 0x50, 0x10, 0x80, 0xA0, 0xB0,
+0xD0, 0xE0, 0x40, 0xE1, 0x20, 0xE3, 0x24, 0xE1, 0xD0, 0x90, 0x40, 0xD1, 0xE0, 0x20, 0xE2, 0x40,
+0xE0, 0xD0, 0xE1, 0x23, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0,
+0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE2, 0xD0, 0x90, 0x40, 0x20, 0xD1, 0xA0, 0x30, 0xB0, 0x00, 0xA0,
+0x10, 0x80, 0x02, 0x70, 0xB0, 0xD0, 0xE1, 0x20, 0xE0, 0x23, 0xD0, 0x40, 0x80, 0x00, 0x70, 0x10,
+0xF0, 0x00, 0x60, 0x80, 0x02, 0x60, 0x0F, 0x10, 0x0F, 0x09, 0x81, 0x70, 0x60, 0x80, 0x50, 0x01,
+0x81, 0x11, 0x61, 0x40, 0xD0, 0x21, 0xE1, 0x23, 0xE2, 0x23, 0xE3, 0x21, 0xE2, 0xD0, 0x90, 0x40,
+0xE0, 0xD0, 0xE0, 0x23, 0xE2, 0x24, 0xE0, 0x21, 0xE2, 0x20, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x20,
+0xE3, 0x40, 0xD0, 0xE2, 0x22, 0xE1, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1,
+0x20, 0xE0, 0x91, 0xD0, 0xE2, 0x22, 0xE1, 0x20, 0xE2, 0x40, 0xE2, 0x20, 0xE0, 0x23, 0xE1, 0x40,
+0xE0, 0xD0, 0xE1, 0xD1, 0x20, 0xE0, 0xD0, 0xB1, 0x30, 0x61, 0xF0, 0x15, 0xA0, 0x11, 0x30, 0x10,
+0xF0, 0x00, 0x80, 0x30, 0x00, 0x50, 0x07, 0x50, 0x05, 0x50, 0x80, 0x30, 0xA0, 0x80, 0xD5, 0x80,
+0xA0, 0x50, 0x05, 0x50, 0x07, 0x50, 0x07, 0x50, 0x04, 0x80, 0x60, 0x90, 0xD0, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x20, 0xD0, 0x40, 0xB0, 0x30, 0x60, 0xA0, 0x70, 0x50, 0x06, 0xC0, 0x51, 0xA1, 0x80,
+0xD2, 0xE0, 0x21, 0xE0, 0x40, 0xE1, 0x20, 0xD2, 0x90, 0x30, 0x10, 0x00, 0x50, 0x30, 0x41, 0x90,
+0xE0, 0x25, 0xE4, 0x20, 0xD0, 0x90, 0x40, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xE1, 0x23, 0xE1,
+0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE2, 0xD0, 0xE0, 0x40, 0x90,
+0xE1, 0xD0, 0x40, 0xF0, 0x80, 0xF0, 0x07, 0xA0, 0xD0, 0xE2, 0x23, 0xE1, 0xD0, 0xA0, 0xF0, 0x11,
+0x80, 0x60, 0x80, 0x02, 0x30, 0xA0, 0x0F, 0x10, 0x0F, 0x09, 0xA0, 0x70, 0x00, 0x10, 0x50, 0xA0,
+0x30, 0xC0, 0x80, 0x01, 0x30, 0xF0, 0xB0, 0x90, 0xD0, 0xE1, 0x20, 0xE3, 0x20, 0xD0, 0x60, 0xB0,
+0xE0, 0x22, 0xE1, 0x23, 0xE2, 0x20, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x25, 0xE1, 0x21,
+0xE1, 0x21, 0xE1, 0x40, 0xE3, 0x20, 0xE0, 0x40, 0xE2, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xE0,
+0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x91, 0xE2, 0x21, 0xE3, 0xD2, 0x91, 0xD1, 0xE4,
+0x21, 0xE1, 0x40, 0xD2, 0x40, 0xB0, 0xD1, 0x90, 0x40, 0x60, 0x30, 0x60, 0xA0, 0x16, 0xA0, 0x10,
+0xA0, 0x30, 0x50, 0x00, 0x10, 0x00, 0x50, 0x30, 0x50, 0x07, 0x70, 0x03, 0xC3, 0x51, 0x40, 0x30,
+0x45, 0x80, 0x31, 0x81, 0x53, 0x71, 0xC1, 0x02, 0xC0, 0x70, 0x07, 0x50, 0x05, 0xC0, 0xF0, 0xB0,
+0x90, 0xE2, 0x21, 0xE1, 0xD0, 0x90, 0x30, 0xC1, 0x80, 0x06, 0x50, 0x02, 0xC0, 0x80, 0xA0, 0xB0,
+0x40, 0xD2, 0x91, 0xD0, 0x20, 0xE0, 0x22, 0xD1, 0x60, 0x00, 0x10, 0xF0, 0x80, 0x90, 0xD0, 0xE0,
+0x21, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x40,
+0xD0, 0xE4, 0x40, 0xE2, 0x21, 0xE5, 0x21, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE2,
+0x20, 0xD0, 0x40, 0x60, 0x00, 0xC0, 0x07, 0xA0, 0xE0, 0xD0, 0xE0, 0x24, 0xE0, 0xD0, 0xE0, 0x40,
+0x10, 0x80, 0x01, 0xA1, 0xC0, 0x80, 0xF0, 0x30, 0x00, 0x31, 0x70, 0x0F, 0x0D, 0x0F, 0x09, 0x50,
+0x80, 0x00, 0x70, 0x01, 0xA1, 0x50, 0x01, 0x50, 0xB0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE4, 0x20,
+0x90, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE5, 0x21, 0xD0, 0x41, 0xE0, 0xD0, 0xE0, 0x20, 0xE4, 0x21,
+0xE1, 0x26, 0xE1, 0x40, 0xE3, 0x40, 0xE2, 0x25, 0xE3, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE5, 0x20,
+0xE0, 0x40, 0xE3, 0x20, 0xE1, 0xD1, 0xE0, 0xB0, 0x40, 0x90, 0x40, 0x91, 0xD2, 0xE0, 0x22, 0xE1,
+0x91, 0xA0, 0xF0, 0x11, 0x61, 0x12, 0xA0, 0xF0, 0x12, 0xF0, 0x60, 0xF3, 0x30, 0xF0, 0x70, 0x01,
+0x50, 0x01, 0x70, 0xA0, 0xC0, 0x06, 0x54, 0x71, 0xC1, 0x01, 0xA0, 0xB0, 0xD0, 0xE1, 0xD0, 0xE0,
+0x40, 0xD1, 0xB1, 0x30, 0x60, 0x70, 0x00, 0x51, 0xC0, 0x72, 0x52, 0x70, 0x06, 0xC0, 0x70, 0x06,
+0xC0, 0x30, 0x90, 0xD1, 0xE0, 0x22, 0xE1, 0x90, 0x30, 0x50, 0x07, 0x71, 0x05, 0x50, 0x30, 0xA0,
+0x90, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0xD0, 0x90, 0x30, 0x80, 0xF0, 0x31, 0xD0, 0x23, 0xE0,
+0x20, 0xE0, 0x21, 0xE2, 0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE3, 0x40, 0xE1, 0xD0, 0x90,
+0x40, 0xE2, 0x21, 0xE0, 0x20, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x24, 0xE2, 0x40, 0x90, 0xE2,
+0x21, 0xD0, 0xB0, 0x80, 0x09, 0xB0, 0x90, 0xD0, 0x23, 0xE0, 0xD1, 0x90, 0x40, 0xD0, 0x30, 0x70,
+0x01, 0x80, 0xF0, 0xA0, 0x30, 0xC0, 0x01, 0x30, 0x51, 0x0F, 0x0D, 0x0F, 0x0D, 0xC0, 0x50, 0x60,
+0x80, 0x50, 0xA0, 0xC0, 0x60, 0xD1, 0xE0, 0x90, 0x40, 0x90, 0xD1, 0xE1, 0x20, 0xE0, 0x20, 0xE5,
+0x23, 0xE3, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0xE2, 0x22, 0xE2, 0x27, 0xE0, 0x20, 0xE2, 0x40, 0x90,
+0xD0, 0x40, 0xE3, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0x40, 0xE2, 0x22, 0xE0, 0x20, 0xE1, 0x20,
+0xE0, 0x21, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0xD2, 0xA2, 0x40, 0x80, 0xA0, 0x60, 0xB0, 0xF1, 0xB0,
+0x90, 0xD5, 0xB0, 0xA0, 0x30, 0x60, 0x10, 0xF0, 0x11, 0x80, 0xF0, 0x80, 0x00, 0x50, 0x31, 0x50,
+0x04, 0x70, 0x60, 0x07, 0x70, 0xA0, 0xC0, 0x00, 0x70, 0x52, 0x72, 0x07, 0x30, 0xB0, 0xD0, 0xE0,
+0x22, 0xD0, 0x40, 0xD4, 0x50, 0x10, 0x80, 0xF1, 0xC0, 0x04, 0x50, 0x71, 0x52, 0xC0, 0x01, 0x70,
+0xC0, 0x07, 0x50, 0xA1, 0xB0, 0xE1, 0xD3, 0x40, 0xB0, 0x10, 0xA0, 0x02, 0x50, 0x02, 0x50, 0x08,
+0x70, 0x60, 0x40, 0xE3, 0x24, 0xD0, 0x40, 0xA0, 0x70, 0x30, 0x61, 0xE0, 0xD0, 0x23, 0xE0, 0x22,
+0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x26, 0xE2, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0x90, 0x40, 0xE2,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xB0, 0xD0, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x90, 0x40, 0x90, 0xD1,
+0xE1, 0x21, 0xD0, 0x40, 0xB0, 0x08, 0xA0, 0xF0, 0x90, 0xE5, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x90,
+0xA0, 0x70, 0x60, 0x50, 0x30, 0x04, 0x50, 0x80, 0x0F, 0x0E, 0x0F, 0x0C, 0xC0, 0x60, 0x30, 0xA0,
+0x02, 0x60, 0x40, 0xD0, 0x20, 0xE2, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xA0, 0x90, 0xE0, 0x20,
+0xE0, 0x28, 0xE2, 0x23, 0xE2, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE2, 0x24, 0xE1, 0x20, 0xE0,
+0x21, 0xE1, 0xD0, 0x41, 0x90, 0xE0, 0xD0, 0x23, 0xE3, 0x23, 0xE1, 0x40, 0x90, 0xD0, 0xE1, 0x24,
+0xE0, 0x23, 0xE0, 0x40, 0xD1, 0x40, 0x60, 0xF0, 0xC0, 0x03, 0x80, 0x70, 0xC1, 0x00, 0x70, 0x30,
+0x60, 0x11, 0x30, 0xF1, 0x10, 0x30, 0xF0, 0x10, 0x50, 0x00, 0xC1, 0x80, 0xF0, 0x01, 0x70, 0xC0,
+0x05, 0x70, 0x10, 0x30, 0x07, 0x70, 0x80, 0x30, 0x80, 0xC0, 0x03, 0xC0, 0x70, 0x06, 0x80, 0x10,
+0xD1, 0x24, 0x40, 0x90, 0x33, 0x40, 0xB0, 0x60, 0xF0, 0x10, 0x60, 0x30, 0x01, 0x80, 0x71, 0x04,
+0xC0, 0x51, 0x80, 0x70, 0x06, 0xC0, 0x70, 0x00, 0xC0, 0x70, 0x31, 0xA1, 0xB0, 0x40, 0xB0, 0x12,
+0x02, 0xC0, 0x01, 0x50, 0xC0, 0x00, 0xF0, 0xA1, 0x31, 0x80, 0xC0, 0x01, 0x70, 0xA0, 0x90, 0xD0,
+0x21, 0xE4, 0xD0, 0x40, 0x31, 0xC0, 0x10, 0x30, 0x60, 0xB0, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x22,
+0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40,
+0x90, 0xD0, 0xE0, 0x23, 0xE2, 0xB0, 0xE0, 0x21, 0xE1, 0x23, 0xD0, 0xE0, 0x90, 0x40, 0xD1, 0xE2,
+0x22, 0xE0, 0xB0, 0xD0, 0x06, 0x80, 0x60, 0x10, 0xE0, 0xD0, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0x90,
+0xD0, 0xE2, 0xD0, 0xB0, 0xA0, 0x02, 0xA0, 0x0F, 0x14, 0x0F, 0x0E, 0x50, 0x30, 0x02, 0xA0, 0xD0,
+0x22, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0x20, 0xE4, 0x21, 0xE0, 0x23, 0xE2, 0x23, 0xE0, 0x22, 0xE1,
+0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xE2, 0x23, 0xE1, 0x90, 0x41, 0xE1, 0x20,
+0xE0, 0x20, 0xE4, 0x24, 0xE1, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0xD0,
+0x90, 0xB0, 0x30, 0x11, 0x02, 0x70, 0xA0, 0x00, 0xF0, 0x01, 0x50, 0x01, 0x70, 0xA0, 0x81, 0x50,
+0x13, 0x30, 0x50, 0x02, 0x30, 0xF0, 0x70, 0x02, 0x50, 0x05, 0x30, 0x70, 0x00, 0x50, 0x02, 0xC0,
+0x70, 0x51, 0xC0, 0x01, 0x30, 0x70, 0x04, 0x50, 0x05, 0x80, 0x10, 0xD1, 0xE0, 0x21, 0xE0, 0x20,
+0xE0, 0x41, 0x60, 0xA0, 0xB1, 0x60, 0xD1, 0xE0, 0x90, 0xE0, 0x90, 0x61, 0x10, 0x00, 0x50, 0x08,
+0xC0, 0x51, 0x70, 0xC0, 0x02, 0x50, 0x06, 0xC0, 0x80, 0xB0, 0xA0, 0x11, 0xC0, 0x05, 0x50, 0x01,
+0xC0, 0xA0, 0xC0, 0x00, 0xC0, 0x70, 0x61, 0x71, 0xA0, 0x40, 0xD0, 0xE1, 0x20, 0xE2, 0x20, 0xE0,
+0xD0, 0x40, 0x90, 0xA1, 0x11, 0xA0, 0xD1, 0xE3, 0x21, 0x90, 0x40, 0xE6, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE2, 0x41, 0x90, 0xD0, 0xE3, 0x20, 0xE2, 0xD0, 0x21, 0xE0, 0x24, 0xD0, 0x90,
+0x40, 0x90, 0xD0, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xD0, 0xB0, 0x50, 0x06, 0x60, 0x90, 0xD1, 0xE1,
+0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0x20, 0xE3, 0xD0, 0xA0, 0x02, 0x60, 0xC0, 0x0F, 0x13, 0x0F, 0x0E,
+0xA0, 0x50, 0xA0, 0x70, 0xB0, 0x40, 0xD0, 0x22, 0xE0, 0xD0, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD1,
+0xE1, 0x24, 0xE3, 0x28, 0xE3, 0x20, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x25, 0xE2, 0x23, 0x90,
+0x40, 0xD0, 0x90, 0x40, 0xE3, 0x21, 0xE0, 0x21, 0xE0, 0x22, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xE0,
+0x22, 0xE4, 0xD1, 0x40, 0xA0, 0x52, 0xA0, 0x04, 0x80, 0xA0, 0x70, 0x01, 0x50, 0xC0, 0x30, 0x00,
+0xC0, 0x13, 0xA0, 0x70, 0xC0, 0x70, 0x02, 0x50, 0x70, 0x60, 0x02, 0x50, 0xC0, 0x03, 0x30, 0x50,
+0x01, 0x50, 0xC0, 0x70, 0x50, 0x70, 0xC0, 0x05, 0x30, 0x50, 0x03, 0x50, 0x01, 0x80, 0xF0, 0x60,
+0xF0, 0xA0, 0x90, 0xD0, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0xE0, 0x91, 0x40, 0xE0, 0xD0, 0xE0, 0xD0,
+0xE2, 0xD0, 0x40, 0x60, 0x00, 0x50, 0x0B, 0xC0, 0x70, 0x50, 0x70, 0xC0, 0x70, 0x07, 0xC0, 0x70,
+0x00, 0x70, 0x60, 0x50, 0x04, 0x50, 0x04, 0x60, 0xC0, 0x01, 0x50, 0x10, 0x80, 0x00, 0x61, 0xD1,
+0x23, 0xE0, 0x20, 0xE0, 0x40, 0xE0, 0xD0, 0xE0, 0x30, 0xF0, 0x10, 0x60, 0xA0, 0xB0, 0xE0, 0xD1,
+0xE0, 0xD0, 0x90, 0x40, 0xD0, 0x21, 0xE5, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0,
+0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x90, 0x40, 0xD0, 0xE2,
+0x24, 0xE1, 0xD0, 0x40, 0x80, 0x06, 0x80, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0,
+0xE4, 0x20, 0xE0, 0xD0, 0xB0, 0x51, 0xA0, 0x70, 0xA0, 0x0F, 0x13, 0x0F, 0x0D, 0x80, 0x50, 0x01,
+0x30, 0x60, 0xD0, 0xE0, 0x21, 0xE4, 0x20, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x23, 0xE4,
+0x2B, 0xE1, 0xD0, 0x90, 0x40, 0xE4, 0x21, 0xE4, 0x23, 0x40, 0xE0, 0xD0, 0xE1, 0x40, 0xE0, 0xD0,
+0xE1, 0x24, 0xE0, 0x21, 0xE1, 0x20, 0xD0, 0xE0, 0x40, 0x20, 0xE5, 0xD1, 0xB0, 0x60, 0xB0, 0x01,
+0x70, 0xC0, 0x05, 0xA0, 0x03, 0xC0, 0x80, 0x50, 0x02, 0x70, 0xA0, 0x03, 0x50, 0x03, 0x70, 0xC0,
+0x50, 0xA0, 0x80, 0x00, 0x50, 0x02, 0x80, 0x50, 0x01, 0x70, 0x81, 0x02, 0xC0, 0x06, 0x30, 0x80,
+0x01, 0xC0, 0xB0, 0x30, 0xA0, 0x30, 0xB0, 0x40, 0xB0, 0xE1, 0xD0, 0xE0, 0x20, 0xE4, 0x40, 0xD0,
+0xE1, 0xD0, 0x20, 0xE1, 0x22, 0xE1, 0xD0, 0xB0, 0x50, 0x00, 0x70, 0x0E, 0xC0, 0x81, 0x70, 0x06,
+0x50, 0x08, 0xC0, 0x70, 0x05, 0x60, 0x02, 0x50, 0xA0, 0x30, 0x80, 0xA0, 0x10, 0x40, 0xD1, 0xE0,
+0x21, 0xD0, 0x41, 0xD0, 0xE0, 0xD1, 0x60, 0x10, 0x01, 0x70, 0xF0, 0xB1, 0xD0, 0x90, 0x40, 0xD0,
+0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0xD1, 0x90, 0x40, 0xE3, 0x40, 0xD0, 0xE2, 0x20,
+0xE1, 0x25, 0xE2, 0x40, 0x90, 0xD0, 0xE2, 0x24, 0xE1, 0x20, 0xD0, 0x40, 0x80, 0x06, 0x60, 0x40,
+0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD1, 0xE2, 0x20, 0xE2, 0x21, 0xD0, 0xF0, 0x50, 0x01, 0x80, 0x70,
+0x0F, 0x12, 0x0F, 0x0D, 0x60, 0x02, 0x30, 0x90, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE6, 0x90, 0x40,
+0xE0, 0xD0, 0xE4, 0x27, 0xE1, 0x25, 0xE2, 0x20, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xD0,
+0x40, 0xE0, 0xD0, 0xE2, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x20,
+0xD1, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0xD0, 0x90, 0xF0, 0xB0, 0x04, 0x70, 0x60, 0xF0, 0x32, 0x60,
+0x80, 0x04, 0x30, 0xC0, 0x02, 0xC0, 0x30, 0x04, 0x50, 0x03, 0x30, 0x10, 0x80, 0xC0, 0x00, 0x50,
+0x01, 0x70, 0x30, 0x80, 0x30, 0x81, 0x50, 0x30, 0xF0, 0xA1, 0x60, 0xA0, 0x60, 0x80, 0xA0, 0x60,
+0x50, 0x01, 0x80, 0xA0, 0xB0, 0x60, 0x40, 0x90, 0xD2, 0xE0, 0xD1, 0xE1, 0x22, 0xE3, 0x40, 0xD0,
+0xE2, 0x27, 0xE0, 0xD0, 0xA0, 0xB0, 0xC0, 0x0F, 0x00, 0x50, 0x00, 0xC0, 0x51, 0xC0, 0x02, 0xC0,
+0x70, 0x08, 0x50, 0x05, 0x60, 0xA0, 0x01, 0x71, 0x03, 0x10, 0x60, 0xA1, 0x90, 0xD0, 0xE0, 0x91,
+0xD4, 0xC0, 0x80, 0x60, 0x10, 0xF0, 0x11, 0xF0, 0xB0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE1,
+0x20, 0xE0, 0x21, 0xE3, 0x41, 0xD0, 0x21, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE5, 0xD0, 0x90,
+0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x24, 0xE1, 0xD0, 0xE0, 0x40, 0x80, 0x06, 0x10, 0x80, 0xE0,
+0x40, 0x90, 0xD0, 0xE0, 0x26, 0xE0, 0x22, 0xD0, 0x40, 0x80, 0x02, 0x60, 0x0F, 0x12, 0x0F, 0x0C,
+0x81, 0xA0, 0x50, 0x70, 0x30, 0xD0, 0xE0, 0x24, 0xE3, 0x21, 0xE3, 0x40, 0x90, 0xE3, 0x20, 0xE0,
+0x22, 0xE0, 0x22, 0xE1, 0x24, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE4, 0x22, 0xD0,
+0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE2,
+0x23, 0xE1, 0x40, 0x90, 0xD0, 0xE1, 0xD0, 0xB0, 0xF0, 0x04, 0xC0, 0xA0, 0x80, 0x03, 0xA0, 0x05,
+0xA0, 0x50, 0x02, 0x30, 0xC0, 0x04, 0x70, 0xC0, 0x03, 0xF0, 0x03, 0x50, 0x00, 0xA0, 0x30, 0x80,
+0x03, 0x70, 0x03, 0x70, 0x00, 0x80, 0xC0, 0x00, 0xA2, 0x60, 0x40, 0x90, 0xD0, 0xE0, 0x90, 0xD0,
+0xE1, 0x20, 0xE2, 0x23, 0xE3, 0x40, 0xD0, 0x2B, 0xD1, 0x40, 0xA0, 0x30, 0x0D, 0xC0, 0x70, 0x03,
+0x51, 0x70, 0x00, 0x50, 0x08, 0x70, 0xC0, 0x04, 0x50, 0x80, 0x02, 0x50, 0x02, 0xC0, 0x70, 0x00,
+0x30, 0x80, 0x00, 0xA0, 0xB0, 0xE0, 0x40, 0xD0, 0xB0, 0xA1, 0x60, 0xA0, 0xB0, 0xA0, 0x60, 0x10,
+0x60, 0x30, 0xB0, 0x90, 0x40, 0xE5, 0x21, 0xE1, 0x22, 0xE0, 0xD1, 0x40, 0x90, 0xE0, 0x23, 0xE0,
+0xD0, 0x91, 0xD0, 0x23, 0xE1, 0x21, 0xE0, 0x20, 0x40, 0x90, 0xE2, 0x20, 0xE1, 0x21, 0xE1, 0x20,
+0xE3, 0xD0, 0xB0, 0x70, 0x06, 0x50, 0xA0, 0x40, 0xE1, 0x23, 0xE0, 0x22, 0xE0, 0x23, 0xE0, 0xD0,
+0xA0, 0xC0, 0x50, 0xA0, 0x30, 0x50, 0x0F, 0x11, 0x0F, 0x0C, 0xA0, 0x01, 0x50, 0xF0, 0x90, 0xD0,
+0x24, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0x23, 0xE2, 0x24,
+0xE2, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xD1, 0x90, 0x40, 0xE4, 0x22, 0xE0, 0x91, 0xD0, 0xE3, 0x22,
+0xD0, 0x91, 0xE1, 0x20, 0xE2, 0x23, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE0, 0x90, 0xD0,
+0xA0, 0x70, 0x03, 0x70, 0xA0, 0x01, 0x50, 0x01, 0x70, 0x80, 0x04, 0x50, 0x80, 0x00, 0x50, 0x00,
+0x70, 0x30, 0x05, 0x50, 0x30, 0x80, 0x70, 0xC0, 0x05, 0x50, 0x30, 0x51, 0x04, 0xC0, 0x70, 0x06,
+0x50, 0x11, 0xD4, 0xE0, 0x40, 0xE2, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x40, 0xD0,
+0xE3, 0x23, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xC0, 0x10, 0xC0, 0x0C, 0x50, 0x06, 0x70, 0x51, 0x08,
+0x50, 0x05, 0xA0, 0x70, 0x01, 0x50, 0x03, 0xC0, 0x50, 0x01, 0xA0, 0x80, 0x00, 0x30, 0x80, 0xD0,
+0xA0, 0x30, 0x03, 0x10, 0xA0, 0xE0, 0xB0, 0xA0, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0xD0, 0xB0, 0x40,
+0xD0, 0x23, 0xE5, 0x40, 0x90, 0xE0, 0x24, 0xE1, 0xD0, 0x40, 0x90, 0xE0, 0x20, 0xE1, 0x22, 0xD0,
+0x90, 0x40, 0xE0, 0xD0, 0xE3, 0x22, 0xE3, 0x20, 0xE1, 0x20, 0xD0, 0xB1, 0x05, 0x70, 0x50, 0xA0,
+0xD0, 0xE1, 0x20, 0xE1, 0x2A, 0xD0, 0x40, 0xF0, 0x50, 0x01, 0xA0, 0x0F, 0x11, 0x0F, 0x0B, 0x80,
+0x70, 0x02, 0xA0, 0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x24, 0xE1, 0x20, 0xD1, 0x90, 0x40, 0xE0,
+0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE2, 0x24, 0xE5, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE3,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0xD0, 0xE2, 0xD0, 0x40, 0x90, 0x60, 0x10, 0x50, 0x03, 0x50, 0xA0, 0x02, 0xC0, 0x50,
+0x00, 0x80, 0x70, 0x01, 0x70, 0x01, 0x30, 0x01, 0x70, 0x50, 0xA0, 0x10, 0x30, 0x80, 0x01, 0x11,
+0x80, 0x70, 0x51, 0x31, 0xA0, 0x80, 0x71, 0x51, 0x30, 0x07, 0x50, 0x06, 0xF0, 0x10, 0xA0, 0xD0,
+0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x25, 0xE6, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x21, 0xE0, 0x22, 0xE1,
+0x40, 0xD0, 0x10, 0x50, 0x0C, 0x50, 0x08, 0x70, 0x50, 0x70, 0x05, 0x50, 0xC0, 0x05, 0x81, 0x00,
+0x71, 0x08, 0x30, 0x50, 0x70, 0xA0, 0xF0, 0x80, 0x04, 0x30, 0x60, 0xD1, 0xB0, 0x41, 0xD0, 0xE1,
+0xD0, 0x40, 0xF0, 0xE0, 0xD0, 0xE7, 0x40, 0xE2, 0x22, 0xE4, 0xD0, 0x40, 0xE2, 0x20, 0xE1, 0xD0,
+0x41, 0xE0, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x23, 0xE0, 0xD0, 0xB0, 0xA1, 0x02, 0xC0,
+0x50, 0xC0, 0x00, 0x31, 0xD0, 0x23, 0xE1, 0x20, 0xE3, 0x23, 0xE0, 0xD0, 0xA0, 0x02, 0x51, 0x0F,
+0x10, 0x0F, 0x0B, 0xA1, 0x50, 0x00, 0x30, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x29, 0xE2, 0x21, 0xD1,
+0x41, 0xE0, 0xD0, 0xE2, 0x20, 0xE2, 0x24, 0xE0, 0x20, 0xE3, 0x20, 0xE1, 0xD1, 0x90, 0x40, 0xE0,
+0xD0, 0xE1, 0xD0, 0x40, 0xE2, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0x90, 0xD0, 0xE1, 0x24,
+0xE0, 0xA0, 0xE2, 0xD1, 0x90, 0xB0, 0x80, 0x03, 0x30, 0x80, 0x04, 0xC0, 0x50, 0x60, 0x30, 0xA1,
+0x30, 0xA0, 0x30, 0x60, 0xA0, 0x30, 0xF0, 0x80, 0xA0, 0x00, 0xC0, 0x70, 0x50, 0x10, 0x80, 0x02,
+0x50, 0x03, 0x81, 0x31, 0x60, 0x08, 0x70, 0x80, 0x70, 0x30, 0x70, 0x02, 0xF0, 0x10, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0xD0, 0xE3,
+0x24, 0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xA0, 0xB0, 0x30, 0x0A, 0xC0, 0x70, 0x0A, 0xC0, 0x50, 0x70,
+0x02, 0xC0, 0x50, 0x04, 0x50, 0xA0, 0x30, 0x00, 0xC0, 0x50, 0x06, 0xA0, 0x01, 0x50, 0x30, 0xC0,
+0x00, 0xC0, 0x02, 0x80, 0x70, 0x01, 0x10, 0x30, 0xD0, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0xD1, 0xA0,
+0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0xE3, 0x21, 0xE3, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0xD1,
+0xE0, 0x40, 0xE0, 0xD1, 0xE2, 0x25, 0xE1, 0x25, 0xD0, 0xB0, 0x50, 0x00, 0x60, 0x70, 0x50, 0x70,
+0x03, 0x10, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x23, 0xE0, 0x21, 0xE1, 0x90, 0xB0, 0x00, 0x80,
+0xA1, 0x0F, 0x10, 0x0F, 0x0A, 0x51, 0x00, 0x50, 0xA0, 0x10, 0xB0, 0x20, 0xE0, 0x20, 0xE3, 0x25,
+0xE2, 0x21, 0xE1, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xE4, 0x20, 0xE1, 0x22, 0xE4, 0x23, 0xE4,
+0x40, 0x90, 0xD1, 0x40, 0x90, 0xD0, 0xE0, 0x24, 0xE0, 0x20, 0xE0, 0x22, 0xD0, 0xE0, 0x40, 0x90,
+0xD0, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0xD1, 0x30, 0x60, 0x80, 0xC0, 0x02, 0x30, 0x50, 0x06,
+0x50, 0x80, 0x04, 0xC0, 0x00, 0xC0, 0x80, 0x61, 0x50, 0x00, 0xC0, 0x80, 0xA0, 0xC0, 0x04, 0x70,
+0x00, 0x70, 0x50, 0xC0, 0x01, 0x80, 0x71, 0xA0, 0x04, 0x80, 0xF0, 0x80, 0xF0, 0x30, 0x10, 0x70,
+0x02, 0x10, 0x30, 0xD0, 0xE0, 0x22, 0xE1, 0x40, 0xE3, 0x20, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x21,
+0x40, 0xD0, 0xE4, 0x23, 0xE2, 0xD0, 0xE0, 0x90, 0xD1, 0xF0, 0x10, 0x0A, 0x50, 0x0D, 0xC0, 0x50,
+0xC0, 0x00, 0x50, 0x03, 0xC0, 0xF0, 0x30, 0xC0, 0x01, 0x50, 0x0A, 0x70, 0x50, 0xA0, 0x03, 0x80,
+0xF0, 0x11, 0xF0, 0x80, 0x10, 0x90, 0xB0, 0xD0, 0xE0, 0x22, 0xE3, 0x40, 0xB0, 0xE0, 0xD0, 0x20,
+0xE0, 0x90, 0x40, 0xE6, 0x20, 0xE1, 0x22, 0xE1, 0x91, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE2,
+0x40, 0xD0, 0x25, 0xE1, 0x25, 0xD0, 0x40, 0x80, 0x00, 0x70, 0x30, 0x50, 0x04, 0x70, 0xF0, 0xE1,
+0x20, 0xE2, 0x20, 0xE3, 0x23, 0xE1, 0xD0, 0xA1, 0x70, 0x00, 0x80, 0x70, 0x0F, 0x0F, 0x0F, 0x0A,
+0xA0, 0x02, 0xA0, 0x60, 0xD0, 0xE0, 0x21, 0xE0, 0x27, 0xE1, 0x28, 0xE1, 0xD0, 0x90, 0x40, 0x90,
+0xD0, 0xE0, 0x22, 0xE7, 0x26, 0xE3, 0x90, 0x40, 0x90, 0x40, 0xE2, 0x26, 0xE6, 0x41, 0xD0, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0x60, 0xA0, 0x70, 0x00, 0x50, 0xC0, 0x00, 0x30,
+0x50, 0x07, 0x81, 0xC0, 0x03, 0xC0, 0x50, 0x30, 0x70, 0x00, 0x30, 0x81, 0x60, 0x70, 0x05, 0xF0,
+0x51, 0x70, 0x03, 0xA0, 0x80, 0x60, 0x50, 0x04, 0x10, 0x60, 0x10, 0x30, 0xC0, 0x70, 0x01, 0xA0,
+0x60, 0x10, 0x40, 0xD0, 0x21, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x27, 0xD0, 0xB0, 0xA0, 0x90, 0xD1, 0x30, 0xA0, 0x00, 0x81, 0x07,
+0x50, 0x07, 0x70, 0x50, 0x05, 0x70, 0x80, 0x70, 0x03, 0x10, 0x03, 0x50, 0xC0, 0x09, 0x71, 0x00,
+0xC0, 0x10, 0x00, 0xA1, 0x30, 0xA0, 0x92, 0x60, 0xF0, 0x90, 0x10, 0xE8, 0xD0, 0xA0, 0xF0, 0xD1,
+0x40, 0x90, 0xD1, 0xE6, 0x25, 0xE0, 0xD0, 0x40, 0x90, 0x40, 0x90, 0xE4, 0xD0, 0x60, 0x40, 0x22,
+0xE0, 0x21, 0xE1, 0x25, 0xD0, 0x40, 0x80, 0x50, 0xC0, 0x00, 0x80, 0x30, 0x04, 0x10, 0xB0, 0xD0,
+0x20, 0xE2, 0x22, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0x80, 0x02, 0xA0, 0x0F, 0x0F, 0x0F,
+0x09, 0x50, 0xF0, 0x50, 0x00, 0xC0, 0x10, 0x90, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x25, 0xE3, 0x27,
+0xE1, 0xD1, 0x90, 0x40, 0xE0, 0xD0, 0xE4, 0x20, 0xE3, 0x27, 0xE2, 0xD0, 0x90, 0xB0, 0xE0, 0xD0,
+0xE0, 0x28, 0xE1, 0x21, 0xE2, 0x41, 0xD0, 0xE1, 0x20, 0xE1, 0xD0, 0xE0, 0xA0, 0x30, 0x00, 0x80,
+0xF0, 0x30, 0x00, 0x70, 0x30, 0x50, 0x06, 0xC0, 0x70, 0xA0, 0x00, 0x50, 0xC0, 0x00, 0xC0, 0x10,
+0x30, 0x80, 0xC0, 0xF0, 0x00, 0x10, 0x50, 0x80, 0x06, 0x70, 0x60, 0x70, 0x50, 0x03, 0x50, 0x80,
+0x10, 0xA0, 0x01, 0x10, 0x80, 0x00, 0xA0, 0xF0, 0xA0, 0xF0, 0xA0, 0x50, 0x01, 0x50, 0x10, 0xA0,
+0xD2, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xE0, 0x22, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x20,
+0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0xD0, 0x40, 0xA0, 0xB0, 0xD0, 0x40, 0x61, 0x10, 0x60, 0x10,
+0x80, 0x05, 0xC0, 0x70, 0x0F, 0x01, 0x50, 0x70, 0x50, 0x02, 0x60, 0x02, 0xC0, 0x50, 0x06, 0x80,
+0x70, 0x00, 0xC0, 0x50, 0x00, 0x80, 0x00, 0x50, 0xF1, 0x80, 0x10, 0xA0, 0xD2, 0x90, 0x40, 0xD0,
+0x90, 0xE3, 0x20, 0xE1, 0x21, 0xE0, 0xD0, 0xB0, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x22, 0xE2, 0x24,
+0xE0, 0xD1, 0x90, 0xB0, 0xE0, 0xD0, 0xE1, 0x20, 0xE2, 0xD0, 0xB0, 0xD0, 0x20, 0xE3, 0x20, 0xE1,
+0x21, 0xE3, 0x30, 0x70, 0x03, 0x50, 0x60, 0x03, 0x10, 0x30, 0x40, 0xE2, 0x21, 0xE2, 0x24, 0xE2,
+0xD0, 0xA0, 0x01, 0x80, 0x10, 0x70, 0x0F, 0x0E, 0x0F, 0x09, 0xA0, 0x00, 0x50, 0xA1, 0x90, 0xD1,
+0xE0, 0x24, 0xE1, 0x22, 0xE0, 0x22, 0xE1, 0x23, 0xE4, 0x21, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE0,
+0x26, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x22,
+0xE1, 0x20, 0xE1, 0x25, 0xE0, 0xD0, 0x90, 0x40, 0xE3, 0xD0, 0xB0, 0x60, 0x70, 0x01, 0x30, 0x70,
+0x00, 0x70, 0x10, 0xA0, 0x10, 0x81, 0x32, 0xA0, 0x30, 0x81, 0x30, 0x01, 0x50, 0x30, 0xA0, 0xC0,
+0x03, 0x80, 0xC0, 0x01, 0x50, 0x04, 0x70, 0x50, 0x01, 0x71, 0x02, 0x60, 0x30, 0xA1, 0x30, 0x50,
+0xC0, 0x30, 0x00, 0x30, 0x60, 0x10, 0xA0, 0x70, 0x50, 0x01, 0xA0, 0x40, 0xD0, 0xB0, 0xA1, 0xD0,
+0xE1, 0x22, 0xD0, 0x40, 0xE0, 0x20, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x29, 0xB0, 0xE0, 0x40, 0x11, 0x80, 0xF0, 0xB0, 0xD2, 0xF0, 0x70, 0x04, 0x50, 0x0F, 0x01, 0x70,
+0xC0, 0x00, 0xC0, 0x50, 0x70, 0x00, 0xA0, 0x02, 0x50, 0x09, 0xC0, 0x50, 0x01, 0xC0, 0x01, 0x70,
+0x60, 0xD1, 0xE2, 0x90, 0x40, 0xD0, 0xE0, 0xD0, 0x28, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x20,
+0xE0, 0x22, 0xE1, 0x25, 0xE3, 0x40, 0x91, 0x40, 0xD0, 0xE0, 0x20, 0xE4, 0xD0, 0x22, 0xE1, 0x20,
+0xE0, 0x21, 0xE2, 0x90, 0x40, 0x90, 0xA0, 0xC0, 0x04, 0xC0, 0x60, 0x50, 0xA0, 0x00, 0x10, 0x70,
+0xA0, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE6, 0xD1, 0x80, 0xA0, 0x30, 0x70, 0x00, 0x30, 0x0F, 0x0E,
+0x0F, 0x08, 0x51, 0x01, 0xC0, 0xA0, 0x40, 0x90, 0xE0, 0xD1, 0xE2, 0x20, 0xE0, 0x20, 0xE3, 0x21,
+0xE2, 0x23, 0xE4, 0x21, 0xE2, 0x90, 0x40, 0x90, 0xE0, 0x23, 0xE0, 0x22, 0xE4, 0x23, 0xE0, 0x90,
+0x40, 0xD1, 0x90, 0x40, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0x20, 0xE2, 0x40, 0xE0, 0x90,
+0xD0, 0x40, 0xB0, 0xC0, 0x80, 0x10, 0x61, 0x30, 0xA0, 0x60, 0x00, 0x80, 0x30, 0xA0, 0xC0, 0x04,
+0xA0, 0xF0, 0xC0, 0x30, 0x00, 0x50, 0x80, 0x01, 0xC0, 0x02, 0xA0, 0x02, 0xC0, 0x70, 0x01, 0xC0,
+0x50, 0x70, 0x03, 0x50, 0x70, 0x00, 0x70, 0x50, 0x30, 0x80, 0xF0, 0xA0, 0x05, 0x50, 0x01, 0x70,
+0x50, 0xA0, 0x40, 0xD0, 0xB0, 0x80, 0xC0, 0x80, 0x60, 0xD1, 0x21, 0xE1, 0x40, 0x20, 0xE3, 0x25,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x29, 0x90, 0xE0, 0x40, 0xF0, 0xA1, 0xB0, 0x91, 0xE0, 0xD0,
+0x30, 0x11, 0x70, 0x01, 0xC0, 0x50, 0x0F, 0x01, 0x50, 0x03, 0x71, 0x30, 0xC0, 0x00, 0x70, 0xC0,
+0x09, 0x50, 0x06, 0x30, 0x40, 0xD0, 0x20, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x27, 0xE1,
+0x90, 0x40, 0xE1, 0xD0, 0x28, 0xE4, 0xD0, 0xE0, 0x40, 0xE0, 0xD1, 0x90, 0xE0, 0xD0, 0xE3, 0x22,
+0xE2, 0x20, 0xE0, 0x21, 0xE3, 0x90, 0x40, 0xE0, 0xD0, 0xA0, 0x06, 0xC0, 0xA0, 0x60, 0x00, 0x80,
+0x00, 0x30, 0x90, 0xE0, 0x26, 0xE4, 0xD0, 0xE0, 0x40, 0x90, 0xA0, 0x02, 0x80, 0x70, 0x0F, 0x0D,
+0x0F, 0x08, 0x60, 0x50, 0x01, 0x30, 0x90, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE0, 0x29, 0xE0, 0x22,
+0xE6, 0x20, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xE2, 0x20,
+0xE0, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x21,
+0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0xE1, 0x40, 0xA0, 0x80, 0xA0, 0xB0, 0x30, 0xB0,
+0x31, 0x04, 0xC0, 0x00, 0xA0, 0xC0, 0x03, 0x32, 0x02, 0x81, 0x70, 0xC0, 0x30, 0x02, 0x30, 0x03,
+0x70, 0xC1, 0x70, 0x05, 0x50, 0x10, 0x00, 0xA0, 0x70, 0xC0, 0x10, 0x30, 0x03, 0x70, 0x02, 0xC0,
+0x71, 0x60, 0x30, 0x50, 0x80, 0xB0, 0xA0, 0x01, 0x50, 0xF0, 0x40, 0xD0, 0x20, 0xE1, 0x40, 0x21,
+0xE2, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE1, 0x91, 0x40, 0x60, 0xA0, 0xB1, 0x21,
+0xD1, 0x80, 0x60, 0x02, 0x70, 0xC0, 0x0F, 0x00, 0x50, 0x05, 0xC0, 0x50, 0x30, 0x70, 0x80, 0x09,
+0x50, 0xC0, 0x05, 0x60, 0x50, 0x60, 0x90, 0xD0, 0x40, 0xB0, 0xD0, 0xE0, 0x25, 0xE0, 0x20, 0xE0,
+0x21, 0xD0, 0x90, 0x40, 0xE1, 0xD0, 0xE0, 0xD0, 0x26, 0xE0, 0x22, 0xD0, 0xE0, 0x91, 0xE0, 0xD0,
+0xE2, 0x40, 0xE1, 0x21, 0xE4, 0x25, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0x20, 0xD0, 0xA0, 0xC0,
+0x06, 0x70, 0x60, 0x70, 0x01, 0x50, 0xB0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x23, 0xE0, 0xD0, 0xE0,
+0x41, 0x20, 0xD0, 0xB0, 0x80, 0x01, 0x80, 0x30, 0x0F, 0x0D, 0x0F, 0x00, 0x70, 0xC0, 0x05, 0x30,
+0x50, 0xA0, 0x80, 0xA0, 0xD0, 0xE1, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE3, 0x22, 0xE0, 0x24, 0xE4,
+0x20, 0xE1, 0x24, 0xE1, 0xD0, 0xE0, 0x41, 0x20, 0xE3, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xD0, 0x40, 0x90, 0xE0, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE3, 0x20, 0xE0, 0x20, 0xE4,
+0xD0, 0xE0, 0x10, 0x80, 0x30, 0xB1, 0xC0, 0x31, 0x50, 0x05, 0xC0, 0x30, 0x50, 0xC0, 0x02, 0x70,
+0x80, 0x10, 0xA0, 0x60, 0x30, 0x60, 0xA0, 0x71, 0x02, 0x70, 0x60, 0x80, 0x34, 0x60, 0x32, 0x82,
+0x50, 0x30, 0x60, 0x70, 0x30, 0x01, 0x30, 0x10, 0xC0, 0x30, 0x02, 0xA0, 0x30, 0x00, 0xF0, 0x10,
+0xF0, 0x80, 0x30, 0x10, 0xF0, 0x11, 0x80, 0x01, 0xA0, 0x90, 0xD1, 0xE0, 0xD0, 0x90, 0xE4, 0x23,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0xD0, 0x91, 0xD0, 0x40, 0xA0, 0x40,
+0xD0, 0x20, 0xD0, 0x90, 0x60, 0x11, 0xC0, 0x01, 0x50, 0x0F, 0x00, 0xC0, 0x50, 0x07, 0x70, 0xA0,
+0x80, 0xA0, 0x70, 0x06, 0x50, 0xC0, 0x05, 0x70, 0xF0, 0xB0, 0x11, 0x90, 0xB0, 0x10, 0x40, 0xD0,
+0x20, 0xE5, 0x22, 0xD0, 0x90, 0x40, 0xD0, 0xE3, 0xB0, 0xE0, 0x24, 0xE0, 0x21, 0xE0, 0xD0, 0x90,
+0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE0, 0x91, 0xE0, 0x22, 0xE4, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0x90,
+0xD1, 0xE1, 0xD0, 0xB0, 0x80, 0x08, 0xA0, 0x70, 0x00, 0x50, 0xB0, 0xD0, 0x21, 0xD0, 0x20, 0xE4,
+0x90, 0x41, 0xE3, 0xD0, 0xA0, 0x80, 0x30, 0x70, 0xA0, 0x0F, 0x0D, 0x0E, 0x50, 0x80, 0x30, 0xC0,
+0x03, 0x30, 0x02, 0x30, 0x40, 0xE1, 0x20, 0xE1, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE2, 0x22, 0xE0,
+0x24, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0xD0, 0x20, 0x40, 0x90, 0xE0, 0xD0,
+0xE1, 0x23, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0x23, 0xE0, 0xD0, 0xE1, 0x40, 0x90, 0xE1, 0x20, 0xE1,
+0x23, 0xE0, 0x21, 0xE0, 0xD0, 0x60, 0x30, 0x80, 0x30, 0xA0, 0x70, 0x60, 0x80, 0x30, 0x06, 0x30,
+0x80, 0x00, 0x50, 0xC0, 0x01, 0xA0, 0x70, 0x03, 0x30, 0x80, 0x00, 0x50, 0x70, 0x01, 0x30, 0x70,
+0xC0, 0x01, 0x70, 0x50, 0x03, 0x50, 0x60, 0x30, 0xC0, 0x71, 0xF0, 0x60, 0x50, 0x00, 0xA1, 0x10,
+0x50, 0x10, 0xC0, 0x80, 0x10, 0x50, 0x00, 0x50, 0x61, 0x80, 0x50, 0x10, 0x50, 0xA0, 0x01, 0x60,
+0xC0, 0x10, 0x50, 0xD0, 0x60, 0xB0, 0xD1, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0,
+0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0xD0, 0xE0, 0x21, 0xD0, 0xB0,
+0x11, 0x50, 0x01, 0xC0, 0x70, 0x0F, 0x00, 0x50, 0x0A, 0x50, 0xC0, 0x50, 0xA0, 0x30, 0x02, 0x80,
+0xF0, 0x50, 0x07, 0x80, 0x30, 0x40, 0x30, 0x40, 0xB0, 0x80, 0xF0, 0xD0, 0xE0, 0x20, 0xE0, 0x20,
+0xE4, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x22, 0x40, 0xD0, 0xE3, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0xD0,
+0xE3, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x22, 0xE2, 0x20, 0xE3, 0x41, 0xE0, 0xD0, 0x23, 0xD1, 0xF0,
+0x70, 0x08, 0xA0, 0x50, 0x00, 0xA0, 0xD2, 0xE0, 0xD0, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0x20, 0xE1,
+0x22, 0xD0, 0xB0, 0x80, 0x01, 0x70, 0x80, 0x0F, 0x0C, 0x0E, 0x50, 0x80, 0x30, 0x04, 0x60, 0x02,
+0xA0, 0xD0, 0xE1, 0x23, 0xD1, 0xE0, 0x90, 0x40, 0x90, 0xE2, 0x21, 0xE0, 0x2A, 0xE4, 0x24, 0xE1,
+0xD0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x24, 0xE1, 0x40, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0xD1,
+0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0x20, 0xD0, 0x30, 0x50, 0x00, 0x30, 0x60,
+0xA0, 0x30, 0x00, 0x51, 0x06, 0x30, 0x10, 0x70, 0x00, 0x50, 0xC0, 0x00, 0x60, 0x04, 0x50, 0x70,
+0x01, 0x50, 0xC0, 0x00, 0xA0, 0x00, 0xC0, 0x72, 0x03, 0x50, 0x10, 0xF0, 0x80, 0x02, 0x10, 0x80,
+0xC0, 0x00, 0xC0, 0x50, 0x60, 0xC0, 0x10, 0x70, 0x60, 0xC0, 0x01, 0x30, 0xF0, 0x80, 0x00, 0x70,
+0x30, 0x01, 0x70, 0xF1, 0x30, 0x40, 0xA0, 0x11, 0x60, 0xE0, 0xD0, 0x91, 0xD0, 0x21, 0xE1, 0x21,
+0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE2, 0x40, 0xE1, 0x22, 0xE0, 0x20, 0xD0,
+0x40, 0xA0, 0x60, 0x02, 0x50, 0xC0, 0x0E, 0x71, 0x0B, 0x71, 0x00, 0x81, 0xC0, 0x70, 0x30, 0x50,
+0x80, 0x08, 0x50, 0xB0, 0x90, 0xD0, 0x30, 0x70, 0x31, 0xD0, 0xE1, 0xD0, 0xE0, 0xD0, 0x40, 0x90,
+0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x41, 0xD0, 0xE2, 0x20, 0xE1, 0x90, 0x40, 0x90, 0xD0,
+0xE1, 0x25, 0xE1, 0x40, 0xD0, 0xE0, 0x24, 0xD1, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x22, 0xE0,
+0xD0, 0x40, 0x60, 0xF0, 0x30, 0x09, 0x30, 0x80, 0x30, 0xB0, 0x60, 0xB0, 0x90, 0xD0, 0xE0, 0x90,
+0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xD0, 0xE0, 0xA0, 0x01, 0xC0, 0x60, 0x0F, 0x0C, 0x0F,
+0x00, 0x70, 0x04, 0x50, 0x80, 0xA0, 0x80, 0x50, 0x30, 0xD0, 0xE0, 0x25, 0xE3, 0x90, 0x40, 0x90,
+0xE0, 0xD0, 0xE0, 0x22, 0xE0, 0x25, 0xE0, 0x21, 0xE4, 0x21, 0xE6, 0x90, 0x40, 0x90, 0xE2, 0x21,
+0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0x24, 0xE4, 0x90, 0x40, 0x90, 0xE1, 0x25, 0xE1, 0x60, 0xC0, 0xA1,
+0xF0, 0x80, 0x00, 0x50, 0x30, 0x07, 0x30, 0x00, 0xC1, 0x70, 0x80, 0xA1, 0x04, 0x30, 0x02, 0x80,
+0x30, 0xC0, 0x30, 0x00, 0x50, 0x60, 0x70, 0x04, 0xC0, 0xA0, 0x00, 0x80, 0xA0, 0x00, 0xC0, 0x60,
+0x30, 0x50, 0x01, 0xF0, 0x80, 0x60, 0x30, 0x01, 0xC0, 0x13, 0x50, 0x01, 0x50, 0x00, 0x50, 0x10,
+0x30, 0x70, 0x30, 0x13, 0x60, 0x40, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x20,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0xA0, 0xF0,
+0xC0, 0x01, 0x50, 0x0F, 0x00, 0x50, 0x0D, 0x70, 0x50, 0x00, 0xA0, 0x10, 0x80, 0x30, 0x00, 0xA0,
+0x00, 0xC0, 0x06, 0xC0, 0x30, 0xB0, 0xD1, 0xA0, 0xC0, 0xF0, 0xB0, 0xD1, 0x90, 0x40, 0x30, 0x10,
+0xF0, 0xB0, 0xA0, 0x60, 0xD1, 0x21, 0xE1, 0xD0, 0x90, 0x60, 0xD0, 0xE4, 0x90, 0x40, 0xE0, 0xD0,
+0xE1, 0x24, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xE2, 0x23, 0xE0,
+0xD0, 0xA0, 0x60, 0xF0, 0x60, 0x0A, 0x30, 0x60, 0xD0, 0x40, 0x10, 0xA0, 0x80, 0x40, 0x90, 0xE1,
+0x20, 0xE2, 0x22, 0xE0, 0xD1, 0xA0, 0x70, 0x80, 0x31, 0x70, 0x0F, 0x0B, 0x0E, 0xA0, 0xF0, 0xA0,
+0x70, 0x02, 0xA0, 0x01, 0x70, 0xF0, 0xD1, 0xE2, 0x25, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xE4, 0x24,
+0xE1, 0x24, 0xE1, 0x21, 0xE8, 0x41, 0xE2, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0x20, 0xE2, 0x27, 0xD0,
+0xE0, 0x41, 0xE1, 0x22, 0xE0, 0xD1, 0x30, 0x70, 0xA0, 0x50, 0xA0, 0x50, 0x01, 0x50, 0x30, 0xC0,
+0x05, 0xC0, 0x60, 0x31, 0x80, 0x50, 0x70, 0x51, 0x04, 0x30, 0x02, 0x30, 0xF0, 0x80, 0x50, 0xC0,
+0x50, 0x80, 0xC0, 0x03, 0xC0, 0x71, 0x00, 0xC0, 0x50, 0x00, 0x60, 0x81, 0x00, 0x60, 0xA0, 0x80,
+0x04, 0xC0, 0x80, 0x70, 0x11, 0x60, 0x01, 0x70, 0x80, 0xF0, 0x10, 0x50, 0xD0, 0xA0, 0x10, 0xA0,
+0xF0, 0x61, 0x40, 0xD1, 0x40, 0xE1, 0x25, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x2A,
+0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0xD0, 0xA0, 0x30, 0x00, 0xC0, 0x70, 0x0E, 0x70, 0xC0,
+0x0F, 0x00, 0x80, 0x60, 0xA0, 0x50, 0xA0, 0x00, 0x80, 0x50, 0x80, 0x05, 0x70, 0x50, 0x00, 0xA0,
+0x90, 0xB0, 0x60, 0x80, 0x00, 0xA0, 0x40, 0x31, 0x80, 0x50, 0x80, 0x50, 0x80, 0xF0, 0xA0, 0x10,
+0x90, 0xD0, 0x20, 0xE2, 0xD0, 0xB0, 0xE4, 0x40, 0x90, 0xD0, 0xE3, 0x24, 0xE4, 0x40, 0xE2, 0x20,
+0xE1, 0x40, 0x90, 0xE4, 0x24, 0xD0, 0x40, 0xD0, 0xF0, 0x60, 0x50, 0x03, 0x70, 0xC0, 0x01, 0x70,
+0x10, 0x30, 0xB0, 0xD0, 0xE0, 0xA0, 0x70, 0xA0, 0xF0, 0x40, 0xD0, 0xE0, 0xD0, 0x40, 0xE0, 0xD0,
+0xE0, 0x21, 0xE3, 0xF0, 0xC0, 0x01, 0xA0, 0x0F, 0x0B, 0x0D, 0xA0, 0x50, 0x00, 0x50, 0x60, 0xF0,
+0x00, 0x51, 0x01, 0xC0, 0xB0, 0xD0, 0xE1, 0x28, 0xE3, 0xD0, 0x90, 0x41, 0xE0, 0xD0, 0xE2, 0x20,
+0xE1, 0x2C, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0x41, 0xD2, 0x40, 0xE0, 0x20, 0xE0, 0x2B, 0xE0,
+0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0xD1, 0x40, 0xA0, 0x30, 0xF0, 0x90, 0xA0, 0x50, 0x02, 0x80,
+0x71, 0xC0, 0x00, 0x70, 0x80, 0x33, 0x04, 0x50, 0x81, 0x50, 0x02, 0x30, 0x02, 0x51, 0xC0, 0x80,
+0x70, 0x06, 0x80, 0x10, 0x02, 0x80, 0x70, 0x00, 0x50, 0xF0, 0x10, 0x50, 0xC0, 0x00, 0x50, 0x06,
+0x60, 0x10, 0x50, 0x01, 0xC0, 0x30, 0x80, 0x10, 0x60, 0xC0, 0x60, 0x30, 0x10, 0xB1, 0x10, 0xF0,
+0xD0, 0xE0, 0x40, 0x90, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE0, 0xD0, 0x91,
+0xD0, 0x20, 0xE2, 0x21, 0xE1, 0xD0, 0x10, 0x01, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x01, 0xC0, 0x30,
+0x50, 0x30, 0x10, 0x70, 0x00, 0xA0, 0x80, 0x01, 0xC0, 0x80, 0x00, 0x70, 0x50, 0x01, 0x50, 0x30,
+0xA0, 0xC0, 0x02, 0x30, 0xA0, 0x01, 0xC0, 0xF0, 0x60, 0x10, 0xF0, 0xC0, 0x80, 0x10, 0x30, 0xD0,
+0xE0, 0x20, 0xD2, 0xE0, 0x20, 0xD0, 0x90, 0x40, 0x20, 0xE8, 0x21, 0xE1, 0x20, 0xE2, 0x40, 0xD0,
+0xE1, 0x41, 0xE1, 0xD0, 0xE0, 0x27, 0xE0, 0xD0, 0x40, 0xF0, 0x90, 0x60, 0x03, 0x10, 0xF0, 0xA0,
+0x10, 0xC0, 0xA0, 0x50, 0xD0, 0x41, 0xE0, 0x60, 0x00, 0x70, 0xF0, 0xB0, 0xD0, 0xF1, 0xA0, 0xD0,
+0xE1, 0x23, 0xD0, 0xA0, 0x02, 0x80, 0xC0, 0x0F, 0x0A, 0x0D, 0x60, 0xC0, 0x02, 0x70, 0x31, 0xA0,
+0x80, 0xC0, 0xB0, 0x40, 0xD0, 0xE1, 0x2B, 0xE2, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE2, 0x20, 0xE1,
+0x2D, 0xE6, 0x90, 0x40, 0x92, 0xE1, 0x2B, 0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xD1, 0xF0, 0x60, 0x30,
+0xA0, 0x80, 0x40, 0x30, 0x03, 0x80, 0x70, 0x50, 0x30, 0xA0, 0x80, 0xC0, 0x01, 0xC0, 0x80, 0x04,
+0x80, 0xC0, 0x50, 0x70, 0x02, 0x30, 0x04, 0x80, 0x50, 0x70, 0x03, 0xC0, 0xA0, 0x01, 0x51, 0x10,
+0x80, 0x10, 0x60, 0xC0, 0x31, 0x00, 0xC0, 0x70, 0x50, 0x00, 0xC0, 0x01, 0x70, 0xF0, 0x00, 0xA0,
+0x30, 0x10, 0x60, 0x50, 0x60, 0xA0, 0xB0, 0x30, 0x60, 0x30, 0xC0, 0xF0, 0x10, 0xA0, 0xB0, 0x90,
+0x61, 0xD0, 0xE0, 0x91, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE1, 0x91, 0xE1,
+0x20, 0xE2, 0xD3, 0xA0, 0x50, 0x80, 0x50, 0x0E, 0x50, 0x0F, 0x02, 0x50, 0x30, 0x71, 0x03, 0x30,
+0x70, 0x01, 0xC1, 0x50, 0x00, 0x50, 0x70, 0x00, 0x50, 0x80, 0x06, 0x50, 0xF0, 0x80, 0xC0, 0x81,
+0xC0, 0x01, 0x10, 0x90, 0xD0, 0xE0, 0xD0, 0xB0, 0x90, 0xD1, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x23,
+0xE3, 0x23, 0xE1, 0xD0, 0x40, 0x91, 0x40, 0xE0, 0xD0, 0xE2, 0x28, 0xE0, 0xD0, 0xB1, 0xD0, 0xB1,
+0x01, 0x30, 0xB0, 0xD0, 0x50, 0x60, 0x10, 0xA0, 0x41, 0xE0, 0xD1, 0x90, 0xA0, 0x01, 0xB0, 0x80,
+0xA0, 0x00, 0xB1, 0xD0, 0xE1, 0x23, 0x41, 0xC0, 0x80, 0xA0, 0x30, 0x04, 0xC0, 0xA0, 0x0F, 0x03,
+0x0D, 0x50, 0xF0, 0x50, 0xC0, 0x01, 0xF0, 0x80, 0x00, 0x70, 0x30, 0x60, 0xD0, 0xE3, 0x25, 0xE1,
+0x20, 0xE0, 0x21, 0xE3, 0xD0, 0x20, 0x41, 0x90, 0xD1, 0xE1, 0x21, 0xE1, 0x2C, 0xE0, 0x20, 0xE4,
+0x90, 0x40, 0x90, 0xD0, 0x25, 0xE3, 0x23, 0xE3, 0xD0, 0x90, 0x40, 0xB0, 0x60, 0x00, 0x10, 0x90,
+0x40, 0x60, 0xC0, 0x50, 0x30, 0x00, 0x80, 0x31, 0x50, 0xC0, 0x71, 0x02, 0x70, 0x80, 0x04, 0x30,
+0xC0, 0x00, 0x80, 0xC0, 0x00, 0xC0, 0x30, 0x70, 0x50, 0x30, 0xA0, 0x80, 0xA0, 0xC0, 0x70, 0xC0,
+0x03, 0x80, 0x50, 0x80, 0xA1, 0x11, 0x60, 0x81, 0x60, 0x30, 0xA0, 0x00, 0x50, 0x10, 0xA0, 0x70,
+0x51, 0x60, 0x01, 0x60, 0x80, 0xF0, 0x10, 0xF0, 0xD1, 0x30, 0xF0, 0xB0, 0xD1, 0x60, 0x10, 0x60,
+0xB0, 0x60, 0x80, 0xB0, 0x90, 0xD0, 0x91, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27,
+0xE0, 0xD0, 0x90, 0x21, 0xE3, 0xD0, 0xB0, 0xF0, 0xA0, 0xF0, 0x10, 0x30, 0x80, 0xC0, 0x0D, 0xC0,
+0x70, 0x0E, 0xC0, 0x70, 0x00, 0x70, 0xA0, 0xC0, 0x71, 0x02, 0x70, 0x30, 0x01, 0xC0, 0x50, 0x02,
+0x70, 0x08, 0x50, 0x60, 0x10, 0x00, 0x50, 0xC0, 0x03, 0xC0, 0x60, 0x40, 0xD1, 0x60, 0xB0, 0x80,
+0x40, 0x90, 0xE4, 0x22, 0xE5, 0x21, 0xE1, 0xD1, 0x90, 0x40, 0x90, 0xE3, 0x21, 0xE0, 0x28, 0xD0,
+0xB0, 0x90, 0xD1, 0xA0, 0x01, 0x30, 0x90, 0xD1, 0x90, 0x30, 0x60, 0x40, 0xD1, 0xE1, 0xD0, 0x30,
+0x80, 0x01, 0xA0, 0x60, 0x50, 0x00, 0x30, 0xB0, 0xD0, 0xE1, 0x22, 0xD0, 0x60, 0x80, 0x70, 0x00,
+0x30, 0xC0, 0x04, 0x60, 0xC0, 0x0F, 0x02, 0x0F, 0x00, 0x30, 0xF0, 0x60, 0xF0, 0xA0, 0x02, 0x50,
+0x40, 0xD0, 0x21, 0xE0, 0x27, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0xD0, 0xE0, 0x90, 0x40,
+0x90, 0xD0, 0xE6, 0x2A, 0xE2, 0x22, 0xD0, 0x40, 0x90, 0x41, 0x20, 0xE0, 0x20, 0xE6, 0x21, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD1, 0x30, 0x80, 0x60, 0x40, 0xD0, 0x60, 0x50, 0x80, 0x50, 0x70,
+0x01, 0xA0, 0x80, 0x02, 0xC0, 0x50, 0x01, 0x51, 0x04, 0x30, 0x01, 0x81, 0x31, 0xA0, 0x60, 0x50,
+0x00, 0x80, 0x30, 0x80, 0x01, 0x51, 0x30, 0xA1, 0x30, 0x80, 0x70, 0x60, 0xA0, 0x03, 0x70, 0x10,
+0x80, 0x71, 0x10, 0x80, 0x00, 0x60, 0x80, 0x50, 0x10, 0x00, 0xC0, 0x10, 0x60, 0xF0, 0x50, 0x40,
+0x80, 0xF0, 0x70, 0xA0, 0x10, 0x40, 0x80, 0xF0, 0x10, 0xF0, 0xC0, 0xF1, 0x10, 0x40, 0xD0, 0x91,
+0xE1, 0x26, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE1, 0x40, 0x21, 0xE2, 0xD1, 0xF0, 0x70,
+0x00, 0x80, 0x10, 0x60, 0x50, 0x0E, 0x50, 0x0F, 0x00, 0x50, 0x00, 0x71, 0x00, 0xA0, 0x00, 0x70,
+0x50, 0x02, 0x80, 0x71, 0x50, 0x03, 0x50, 0x07, 0xA0, 0xC0, 0x00, 0x10, 0x00, 0xC1, 0x00, 0x80,
+0x30, 0x02, 0x10, 0x40, 0x70, 0x30, 0x40, 0x50, 0xA0, 0xD3, 0xE0, 0x23, 0xE4, 0x22, 0xE2, 0x40,
+0x92, 0xD0, 0xE2, 0x22, 0xE1, 0x26, 0xD0, 0xF0, 0xA0, 0x90, 0xD0, 0x80, 0x50, 0x00, 0xA0, 0xD0,
+0x90, 0x40, 0x90, 0x30, 0x80, 0x60, 0xD0, 0xE3, 0xD0, 0x60, 0x02, 0x30, 0x50, 0x01, 0x30, 0x40,
+0x90, 0xD0, 0xE0, 0x21, 0xD0, 0xB0, 0x70, 0x01, 0x51, 0x00, 0x70, 0x50, 0x70, 0x00, 0x81, 0x0F,
+0x02, 0x0C, 0x80, 0x60, 0x30, 0xC0, 0x02, 0xF0, 0x80, 0xC0, 0x00, 0xA0, 0xE0, 0xD0, 0xE3, 0x20,
+0xE2, 0x2D, 0xE1, 0xD1, 0x90, 0x40, 0x90, 0xD1, 0xE3, 0x21, 0xE2, 0x26, 0xE0, 0x20, 0xE1, 0x21,
+0x40, 0xD1, 0x20, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0xE1, 0x26, 0xE2, 0x21, 0xD0, 0x40, 0x10, 0xA0,
+0x50, 0x70, 0xA0, 0x70, 0x05, 0x70, 0x80, 0x00, 0x60, 0x02, 0x80, 0x00, 0x51, 0x04, 0x60, 0x31,
+0xF0, 0x71, 0xC0, 0x00, 0xA0, 0x00, 0x50, 0x10, 0x00, 0x60, 0xA0, 0x60, 0x30, 0x51, 0x60, 0x11,
+0x70, 0x00, 0xA2, 0x02, 0x70, 0xF0, 0xA0, 0xC1, 0xA0, 0x80, 0x00, 0x60, 0x80, 0x00, 0xC0, 0x00,
+0x30, 0x10, 0xA0, 0xF1, 0x30, 0xA0, 0x10, 0x80, 0xA0, 0xF0, 0x30, 0xF0, 0x10, 0x60, 0x10, 0x70,
+0x11, 0x50, 0x60, 0xD1, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0,
+0xE0, 0x27, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xD0, 0xE0, 0x40, 0x70, 0x10, 0x03, 0xF0, 0x30, 0x0D,
+0x71, 0x09, 0xC0, 0xF0, 0x30, 0xC0, 0x02, 0xC0, 0x50, 0x01, 0xA0, 0x01, 0xC0, 0x50, 0x01, 0x70,
+0x30, 0x70, 0x0B, 0xA0, 0x50, 0x04, 0xA0, 0x50, 0x01, 0x80, 0x02, 0x70, 0x10, 0xB0, 0x50, 0x30,
+0x50, 0x00, 0x60, 0xD1, 0x90, 0x40, 0x23, 0xE2, 0x21, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0xD2, 0x40,
+0xD0, 0xE0, 0x24, 0xE1, 0x21, 0xE4, 0x90, 0x30, 0x00, 0xA0, 0xF0, 0x10, 0x80, 0x00, 0xA0, 0x40,
+0x90, 0xD1, 0xB0, 0x40, 0xF0, 0xD0, 0xE0, 0x21, 0xE0, 0xD0, 0xB0, 0xF0, 0x70, 0x05, 0xA0, 0x10,
+0x90, 0xD0, 0x21, 0xD0, 0xA1, 0x00, 0xC0, 0x30, 0x61, 0xA0, 0x30, 0xA0, 0x60, 0xF1, 0x0F, 0x02,
+0x0B, 0x30, 0x80, 0x00, 0x30, 0x10, 0xA0, 0x00, 0xC0, 0x80, 0xC0, 0x30, 0xA0, 0x30, 0xD0, 0xE2,
+0x21, 0xE3, 0x2C, 0xE0, 0x20, 0xE4, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x20, 0xE1, 0x2A, 0xE0,
+0x20, 0xD0, 0x40, 0xE3, 0xD0, 0x90, 0x40, 0x90, 0xE3, 0x25, 0xE1, 0x20, 0xE2, 0xA0, 0xF0, 0x90,
+0xB0, 0xA0, 0x30, 0x06, 0xC0, 0xA0, 0x05, 0x50, 0x80, 0x70, 0x04, 0xA0, 0x01, 0x30, 0x01, 0x70,
+0x00, 0x30, 0x50, 0xC0, 0x80, 0x00, 0xA0, 0x02, 0x30, 0xA0, 0x11, 0x60, 0x03, 0x61, 0x02, 0x30,
+0x00, 0xF0, 0x70, 0x50, 0x00, 0x80, 0x30, 0xC0, 0x00, 0x70, 0x14, 0x81, 0x30, 0x11, 0x80, 0xA0,
+0x60, 0x10, 0xF0, 0x11, 0xF1, 0x60, 0xF0, 0x11, 0x80, 0x90, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x22,
+0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE1, 0x40, 0xD0, 0xE0, 0xD0, 0x40, 0xF0, 0xA0, 0xF0, 0xB0, 0x01,
+0x10, 0x00, 0xC0, 0xA0, 0x70, 0x0C, 0x50, 0x0B, 0x70, 0x60, 0xF0, 0x10, 0x70, 0x00, 0x50, 0x02,
+0x51, 0x01, 0xC0, 0x50, 0x00, 0x80, 0x50, 0xC0, 0x03, 0x50, 0x05, 0x71, 0x05, 0xC1, 0x06, 0x70,
+0xA0, 0x60, 0x70, 0x30, 0x40, 0x70, 0xF0, 0x90, 0xE0, 0x40, 0xE0, 0x21, 0xE0, 0xD1, 0xE2, 0xD0,
+0xE0, 0x90, 0x40, 0xB0, 0x90, 0xD2, 0x90, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x21, 0xE3, 0xD0,
+0xA0, 0xC0, 0x00, 0x70, 0x10, 0x50, 0x70, 0x80, 0x30, 0xD0, 0xE2, 0xD0, 0xA1, 0xD0, 0xE0, 0x22,
+0xE0, 0xD0, 0x60, 0xB0, 0x07, 0x60, 0x90, 0xD0, 0xE0, 0xD0, 0x40, 0x10, 0x31, 0xC0, 0x30, 0xC0,
+0x0F, 0x08, 0x0B, 0x60, 0xC0, 0x01, 0x30, 0x50, 0x31, 0x02, 0x30, 0x90, 0x20, 0xE1, 0x20, 0xE0,
+0x22, 0xE2, 0x29, 0xE0, 0x24, 0xE4, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x25, 0xE0, 0x23, 0xE1,
+0x20, 0xE0, 0x91, 0xE1, 0x21, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x23, 0xE1, 0x20,
+0xE1, 0x60, 0xA0, 0x80, 0xD0, 0xF0, 0x81, 0x70, 0x05, 0x80, 0xF0, 0x06, 0x80, 0x50, 0x04, 0x60,
+0x01, 0x30, 0x01, 0x51, 0xA1, 0x02, 0xA0, 0x01, 0xA0, 0x10, 0x31, 0xF0, 0x10, 0xF0, 0xA0, 0x01,
+0xC0, 0x70, 0x02, 0x30, 0x01, 0x30, 0x50, 0x00, 0x80, 0x50, 0x02, 0x70, 0xC0, 0x30, 0xF0, 0x10,
+0x70, 0x80, 0xA0, 0x40, 0x60, 0x70, 0x30, 0xA0, 0xF1, 0x10, 0xA1, 0x60, 0xF0, 0x60, 0xC0, 0x60,
+0x10, 0x30, 0xD0, 0x20, 0xE2, 0x20, 0xE0, 0x23, 0xE0, 0x40, 0xD0, 0xE0, 0x27, 0xE0, 0x91, 0xD1,
+0x90, 0x10, 0xF0, 0xA2, 0x80, 0x00, 0x30, 0x10, 0x50, 0x0D, 0x50, 0xC0, 0x0D, 0x70, 0xF1, 0x50,
+0x03, 0x51, 0x02, 0xC0, 0x50, 0x70, 0x30, 0xA0, 0x30, 0x02, 0x70, 0x50, 0x03, 0x50, 0x70, 0x09,
+0xC0, 0x03, 0x50, 0x70, 0x00, 0x10, 0x80, 0xD0, 0xA0, 0xB1, 0x90, 0xE1, 0xD0, 0xB0, 0xA0, 0xF0,
+0x41, 0xD0, 0xE0, 0xD0, 0x90, 0xB1, 0x50, 0x31, 0x60, 0xD0, 0x90, 0xD0, 0x90, 0xE0, 0x23, 0xE1,
+0x21, 0xE2, 0x21, 0xD0, 0xA0, 0xC0, 0x01, 0xF0, 0x50, 0x70, 0x10, 0x30, 0xD0, 0x21, 0xE0, 0xD0,
+0x40, 0xF0, 0xD0, 0xE0, 0x23, 0xD1, 0xA0, 0x07, 0xC0, 0xA0, 0xD1, 0x90, 0x60, 0x10, 0x80, 0x01,
+0xC0, 0x80, 0x03, 0xC1, 0x0F, 0x02, 0x0B, 0x80, 0x60, 0x50, 0x30, 0x80, 0x00, 0xA0, 0xF0, 0x80,
+0x01, 0xA0, 0xD0, 0x21, 0x90, 0xA0, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x2D, 0xE3, 0xD0, 0xE0,
+0xD0, 0x90, 0x41, 0xE0, 0xD0, 0xE0, 0x24, 0xE0, 0x22, 0xE3, 0x40, 0xE1, 0x22, 0xE4, 0x41, 0xE0,
+0xD0, 0xE1, 0x23, 0xE3, 0xB1, 0xD0, 0x40, 0x60, 0x01, 0xC0, 0x50, 0xC0, 0x02, 0xC0, 0x31, 0x06,
+0x80, 0x50, 0x80, 0x00, 0xC0, 0x80, 0xA0, 0x60, 0xC0, 0x00, 0x30, 0x00, 0x70, 0x10, 0xA0, 0x60,
+0xC0, 0x02, 0xA0, 0x00, 0xF0, 0xA0, 0x50, 0x10, 0x60, 0x80, 0xC0, 0x52, 0x30, 0x02, 0x50, 0xA0,
+0xF0, 0xA0, 0x31, 0xC0, 0x00, 0xF0, 0x30, 0x05, 0xC0, 0x10, 0xF0, 0x41, 0xA1, 0x60, 0x80, 0x10,
+0x80, 0x60, 0x13, 0xF0, 0x30, 0x12, 0x60, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0x40, 0xD0,
+0xE0, 0x27, 0xE0, 0x90, 0xE0, 0xA0, 0x60, 0x10, 0xB0, 0x60, 0xB0, 0xD0, 0xB0, 0x11, 0x60, 0x10,
+0x50, 0x0D, 0x50, 0x0F, 0x00, 0xC0, 0xA0, 0x60, 0x03, 0x60, 0xC0, 0x03, 0xC0, 0x50, 0x01, 0x30,
+0x70, 0x02, 0xC0, 0x02, 0x50, 0xC0, 0x0A, 0x10, 0xC0, 0x00, 0xC0, 0x80, 0x02, 0xC0, 0x10, 0xD0,
+0x90, 0xD1, 0xE0, 0x20, 0xE0, 0xD0, 0xB0, 0xA0, 0x30, 0x80, 0x30, 0xB0, 0xD0, 0x40, 0x90, 0x30,
+0x10, 0xA0, 0x31, 0x10, 0x40, 0x10, 0xA0, 0x30, 0x90, 0xD1, 0xE0, 0x21, 0xE5, 0x20, 0xE0, 0xD0,
+0x40, 0x30, 0x70, 0x50, 0x11, 0x50, 0x10, 0xD0, 0xE0, 0x22, 0xE0, 0xD0, 0xB0, 0xE1, 0x22, 0xE1,
+0xD0, 0x90, 0xA0, 0x07, 0xB0, 0xF0, 0xC0, 0x10, 0xF0, 0xC0, 0x10, 0x00, 0xC0, 0x30, 0xF0, 0x01,
+0x30, 0x10, 0x61, 0xA0, 0x0F, 0x01, 0x0B, 0x70, 0x50, 0x30, 0x80, 0xC0, 0x60, 0xA0, 0xF0, 0x11,
+0xF0, 0xB0, 0xD2, 0x90, 0x40, 0xE6, 0x21, 0xE4, 0x25, 0xE4, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x90,
+0x41, 0xE0, 0xD0, 0xE0, 0x23, 0xE2, 0x21, 0xE0, 0x91, 0xE1, 0x20, 0xE0, 0x22, 0xE2, 0xD0, 0xE0,
+0x40, 0x90, 0xE2, 0xB0, 0xE5, 0xD1, 0x90, 0x10, 0xC0, 0x03, 0x50, 0x70, 0x01, 0xA0, 0x00, 0xA0,
+0x03, 0xC0, 0x30, 0x60, 0xF0, 0x50, 0x30, 0xA0, 0x30, 0xA0, 0x03, 0x30, 0xC1, 0x70, 0x00, 0x30,
+0x03, 0x30, 0x00, 0x50, 0xA0, 0x10, 0x30, 0x00, 0xC1, 0x02, 0xA0, 0x01, 0xA0, 0x10, 0xD2, 0x40,
+0xF0, 0x11, 0x60, 0x00, 0x70, 0x60, 0x70, 0x01, 0x80, 0x10, 0x60, 0x70, 0xF1, 0x00, 0x70, 0x80,
+0xA0, 0x60, 0x50, 0xA0, 0x10, 0x50, 0x12, 0x60, 0x11, 0x80, 0x30, 0xF0, 0xB0, 0xD0, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE3, 0x20, 0xE3, 0xD0, 0x40, 0xD0, 0xF0, 0x60, 0x11,
+0x90, 0xD0, 0x40, 0xB0, 0x10, 0xC0, 0x00, 0x70, 0x0D, 0x50, 0x0F, 0x01, 0x71, 0x10, 0x30, 0x01,
+0xA0, 0x50, 0x06, 0x80, 0x01, 0x60, 0x04, 0xC0, 0x50, 0x0C, 0x70, 0xC0, 0x51, 0x04, 0x60, 0x30,
+0xD0, 0xE5, 0xD0, 0xA0, 0xC0, 0x01, 0xA0, 0xB0, 0xD1, 0xF0, 0x60, 0x10, 0xA0, 0x60, 0xF0, 0x11,
+0xF0, 0xB0, 0x60, 0x30, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0xE1, 0x40, 0x30,
+0x01, 0x10, 0xC0, 0x10, 0x30, 0xD1, 0x23, 0xD1, 0xE0, 0x23, 0xE2, 0xD0, 0xA0, 0xC0, 0x07, 0x30,
+0xF0, 0x60, 0x01, 0x30, 0xF0, 0x12, 0xC0, 0xF0, 0x80, 0x02, 0x30, 0x50, 0x0F, 0x00, 0x0A, 0x60,
+0xA0, 0xF0, 0x01, 0xC1, 0x30, 0x00, 0xC0, 0x80, 0xF0, 0x41, 0x90, 0xE0, 0xD2, 0xE7, 0x21, 0xE2,
+0x24, 0xE4, 0x25, 0xE1, 0xD1, 0xE0, 0x41, 0x90, 0xE3, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE2,
+0x21, 0xE1, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0xD0, 0x20, 0xE1, 0x20, 0xE0,
+0xD0, 0x60, 0x50, 0x05, 0xC0, 0x50, 0x80, 0x50, 0x00, 0xA0, 0x00, 0xC0, 0x80, 0xA0, 0x30, 0xC0,
+0x50, 0x60, 0x30, 0xC0, 0x00, 0x70, 0x30, 0x03, 0x30, 0x10, 0x80, 0x01, 0x30, 0x01, 0x80, 0xA0,
+0x60, 0x00, 0x30, 0x60, 0x51, 0xA0, 0x80, 0xA0, 0x60, 0x70, 0x01, 0x70, 0x50, 0x60, 0x40, 0xD0,
+0xE0, 0x20, 0xD1, 0xB0, 0x60, 0x10, 0xC0, 0x70, 0x10, 0x01, 0x80, 0x10, 0xA0, 0x70, 0x60, 0x10,
+0x60, 0xF0, 0x11, 0xF0, 0x30, 0x80, 0x30, 0x10, 0xA0, 0x10, 0x70, 0x30, 0x60, 0x70, 0xF1, 0x70,
+0x80, 0x10, 0xE0, 0x20, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0xE9, 0x40, 0xD0, 0x40, 0x50, 0xB0, 0xD1,
+0x20, 0xE0, 0xD0, 0xF0, 0x50, 0x00, 0x50, 0x0C, 0xC0, 0x70, 0x0C, 0xC0, 0x50, 0xC1, 0x70, 0x00,
+0xC0, 0x10, 0x70, 0xC0, 0x30, 0x07, 0xC0, 0x50, 0x00, 0x51, 0x02, 0x70, 0x50, 0x0C, 0x52, 0xC0,
+0x06, 0xF0, 0x40, 0xD0, 0x21, 0xE0, 0x20, 0xD0, 0xE0, 0x40, 0xA0, 0xC0, 0x50, 0xC0, 0xF0, 0xE0,
+0x30, 0x60, 0x12, 0xF1, 0x61, 0x80, 0x30, 0x00, 0x80, 0xA0, 0xD0, 0xE0, 0x22, 0xE3, 0x90, 0x40,
+0x90, 0x10, 0x60, 0x70, 0x30, 0x60, 0x30, 0xC0, 0x30, 0xD0, 0xE0, 0xB0, 0xE2, 0x20, 0xE1, 0x23,
+0xE2, 0xD0, 0xE0, 0x60, 0xC0, 0x07, 0x30, 0x70, 0xC0, 0x51, 0x10, 0x80, 0x01, 0x10, 0x80, 0x02,
+0x70, 0x60, 0xC0, 0x0F, 0x00, 0x09, 0x81, 0x00, 0x50, 0x30, 0x00, 0x70, 0x80, 0x30, 0x02, 0xA0,
+0xD0, 0x91, 0x41, 0x90, 0xD0, 0xE1, 0x22, 0xE7, 0x22, 0xE4, 0x25, 0xE6, 0xD0, 0xE0, 0x90, 0x40,
+0x90, 0xE6, 0x91, 0xD0, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x22, 0xE1, 0x90, 0x40, 0xE0, 0xD0, 0x20,
+0xE0, 0x22, 0xD0, 0x90, 0xA0, 0x03, 0x70, 0x50, 0x01, 0x30, 0x80, 0xC0, 0x00, 0x60, 0x31, 0x70,
+0x02, 0x50, 0xA0, 0xC0, 0x02, 0x80, 0x70, 0x02, 0xA0, 0x80, 0x02, 0xA0, 0x31, 0x70, 0x00, 0xA0,
+0x50, 0xA0, 0x30, 0x50, 0x70, 0xC0, 0x30, 0x60, 0x80, 0xC0, 0x01, 0xF0, 0xB0, 0xE0, 0xD0, 0xE0,
+0x21, 0xE0, 0xD2, 0xA0, 0x80, 0x30, 0x80, 0x71, 0x10, 0xF0, 0x60, 0xA0, 0x10, 0x00, 0x60, 0x30,
+0x50, 0x80, 0x60, 0x80, 0xB0, 0x60, 0x12, 0x31, 0x10, 0x30, 0xC0, 0x00, 0xA0, 0x50, 0x10, 0xE0,
+0x25, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE3, 0x21, 0x40, 0xE1, 0xD2, 0x20, 0xE0, 0xA0,
+0xD0, 0x40, 0x80, 0x00, 0x70, 0x0C, 0x50, 0x0D, 0x11, 0xF0, 0xA0, 0x60, 0x80, 0x00, 0x10, 0x30,
+0x70, 0x80, 0x08, 0xC0, 0x70, 0xC0, 0x80, 0x00, 0xC0, 0x70, 0x50, 0x0D, 0x50, 0xF0, 0x08, 0x50,
+0x60, 0xD0, 0xE0, 0x21, 0xE0, 0xD0, 0xE1, 0xB0, 0x60, 0x50, 0x00, 0x50, 0xF0, 0x10, 0xF0, 0x10,
+0x30, 0xF0, 0xB0, 0x30, 0x60, 0xF0, 0x80, 0x10, 0x00, 0x70, 0x30, 0x60, 0xD0, 0x22, 0xD0, 0xE0,
+0x90, 0x40, 0x90, 0xE0, 0xD0, 0x10, 0xF0, 0x61, 0x40, 0x60, 0xA0, 0x60, 0xB0, 0xD0, 0xF1, 0x90,
+0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE3, 0xD0, 0x90, 0xA0, 0x06, 0xC0, 0x70, 0x50, 0x70, 0xC0, 0x00,
+0xF0, 0x02, 0x60, 0xA0, 0xC0, 0x50, 0xA0, 0x60, 0x70, 0x0F, 0x01, 0x09, 0x80, 0x30, 0x01, 0x60,
+0x00, 0x31, 0xA0, 0x30, 0xC0, 0x50, 0xB0, 0xD1, 0xE0, 0xD0, 0x91, 0x40, 0x90, 0xE2, 0x20, 0xE6,
+0x21, 0xE5, 0x25, 0xE0, 0x20, 0xE2, 0x21, 0xE2, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD1, 0xE0,
+0xD0, 0x40, 0xE2, 0x21, 0xE2, 0x21, 0xE0, 0x23, 0xE3, 0x40, 0x90, 0xE2, 0x20, 0xD1, 0x60, 0x07,
+0x70, 0x80, 0x00, 0x70, 0x51, 0xC0, 0x04, 0x50, 0xA0, 0x70, 0x02, 0x30, 0x50, 0x70, 0x01, 0x30,
+0x01, 0x70, 0xF0, 0x30, 0x70, 0x00, 0x50, 0x80, 0x11, 0x50, 0x04, 0xC0, 0x80, 0x30, 0xC0, 0x00,
+0x50, 0x40, 0x21, 0xE0, 0x21, 0xE3, 0xA0, 0xF0, 0x10, 0x60, 0x10, 0x60, 0x01, 0x70, 0x80, 0x10,
+0x50, 0x00, 0xC0, 0xA0, 0x60, 0xF0, 0x40, 0x30, 0x80, 0xB0, 0x80, 0xD0, 0xB0, 0x10, 0x30, 0xF0,
+0x10, 0x60, 0x10, 0x30, 0xF0, 0x90, 0xE2, 0x22, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0,
+0x21, 0xE0, 0x20, 0x90, 0xE0, 0xB0, 0xD1, 0xE0, 0x21, 0xD2, 0xF0, 0x30, 0x0C, 0x71, 0x0D, 0x30,
+0x10, 0x80, 0x70, 0x80, 0x50, 0x00, 0x71, 0x00, 0x30, 0x09, 0x70, 0x81, 0x00, 0x30, 0x70, 0x0D,
+0x50, 0xC0, 0x80, 0x09, 0xF0, 0x90, 0xD0, 0x22, 0xE0, 0x41, 0xE1, 0xA0, 0x30, 0x00, 0xC0, 0x80,
+0x10, 0xF0, 0x50, 0xA0, 0xB0, 0xA0, 0x11, 0xA1, 0x50, 0x00, 0xA0, 0x10, 0x40, 0xD2, 0x90, 0x40,
+0xA1, 0xD2, 0xA0, 0xF0, 0x10, 0x40, 0xD0, 0x10, 0xB0, 0xF0, 0x90, 0xD0, 0x40, 0x10, 0x60, 0xD0,
+0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE3, 0x20, 0xD0, 0x80, 0x30, 0x03, 0x70, 0x50, 0x70, 0xC0, 0x03,
+0x30, 0x71, 0x30, 0x60, 0x30, 0xA1, 0x50, 0x00, 0x70, 0x30, 0x50, 0x0E, 0x0A, 0xA0, 0x01, 0x81,
+0x60, 0xA0, 0x01, 0x80, 0xF0, 0xE6, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x29, 0xE3, 0x25,
+0xE2, 0x20, 0xE1, 0x22, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE1, 0x91, 0xD0, 0xE2, 0x20, 0xE0,
+0x26, 0xE5, 0xD0, 0x90, 0x40, 0x90, 0xD2, 0x30, 0x50, 0x07, 0x30, 0x70, 0x02, 0x50, 0xC0, 0x03,
+0x50, 0xA0, 0x30, 0x70, 0x02, 0x80, 0xC0, 0x70, 0x50, 0x70, 0x60, 0xF0, 0xA0, 0x50, 0x02, 0xC0,
+0x30, 0xA0, 0x10, 0x50, 0x70, 0x80, 0xC1, 0x03, 0xC0, 0x31, 0x60, 0xE0, 0xD0, 0x23, 0xE1, 0xD0,
+0xB0, 0x60, 0xC0, 0x00, 0x10, 0xA0, 0xF0, 0x00, 0x30, 0xF1, 0x10, 0x80, 0x00, 0x70, 0x10, 0x60,
+0xA0, 0x90, 0x40, 0xD2, 0x80, 0x10, 0x50, 0x60, 0x80, 0x10, 0x60, 0x10, 0x61, 0xD2, 0xE0, 0x22,
+0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x25, 0x91, 0xD1, 0x40, 0xB0, 0x22, 0xD0, 0x40, 0xE0, 0x40,
+0x60, 0x10, 0x30, 0x04, 0x80, 0xC0, 0x80, 0x02, 0x50, 0x0F, 0x00, 0x70, 0x05, 0x70, 0x50, 0x30,
+0x0A, 0x70, 0x51, 0xC0, 0x0C, 0x70, 0x50, 0x01, 0x50, 0x80, 0x08, 0x50, 0xA0, 0xD0, 0xE0, 0xD0,
+0x41, 0xE3, 0xD0, 0x60, 0x80, 0x00, 0x60, 0xF1, 0x30, 0x60, 0xA0, 0x60, 0xA0, 0x10, 0x30, 0x50,
+0x30, 0x00, 0x70, 0x60, 0x30, 0xD0, 0x40, 0x60, 0x90, 0xD0, 0x90, 0x10, 0x60, 0x40, 0xD1, 0x90,
+0x40, 0xE0, 0xD6, 0xA0, 0x10, 0xD0, 0xE0, 0x25, 0xE1, 0x23, 0xD0, 0x30, 0x50, 0xC0, 0x51, 0xC0,
+0x06, 0x70, 0x10, 0x80, 0x01, 0x30, 0x03, 0x30, 0x00, 0xA0, 0x0E, 0x0E, 0x10, 0x30, 0x80, 0x01,
+0xC0, 0x30, 0xD0, 0xE2, 0x20, 0xE2, 0xD0, 0xE1, 0x90, 0x41, 0x90, 0xE1, 0x28, 0xE2, 0x28, 0xE0,
+0x24, 0xE1, 0x20, 0xE0, 0xD1, 0x90, 0x40, 0x90, 0x40, 0xD0, 0xE0, 0xD0, 0xE2, 0x26, 0xE4, 0x21,
+0xE1, 0xD0, 0x90, 0x40, 0xB0, 0x90, 0x30, 0x08, 0x50, 0xA0, 0x50, 0x02, 0x70, 0x50, 0x00, 0x70,
+0x60, 0x50, 0x00, 0x51, 0x02, 0x50, 0x70, 0x00, 0x50, 0xA0, 0x50, 0x30, 0x03, 0x70, 0x01, 0x80,
+0x60, 0x00, 0xA0, 0x10, 0x60, 0x50, 0x04, 0xC0, 0x80, 0x60, 0xD0, 0x23, 0xE0, 0x20, 0xE1, 0x40,
+0x60, 0x81, 0xB0, 0x80, 0xA0, 0x60, 0x81, 0x30, 0x11, 0xC1, 0x11, 0x40, 0xD0, 0x40, 0x90, 0xD0,
+0x40, 0x11, 0xC0, 0x00, 0x80, 0x50, 0x01, 0x80, 0x60, 0xF0, 0xA1, 0x90, 0xD0, 0x23, 0xE0, 0x40,
+0xD0, 0xE1, 0x24, 0xE0, 0xD0, 0x41, 0xD0, 0xE0, 0x24, 0xE0, 0x90, 0xA0, 0x40, 0x50, 0x60, 0x30,
+0x03, 0x70, 0x10, 0x00, 0x10, 0xC0, 0x00, 0x50, 0xC0, 0x0E, 0x50, 0xC0, 0x04, 0x50, 0xA0, 0x80,
+0x0C, 0x30, 0xC0, 0x0C, 0x50, 0x70, 0x03, 0x61, 0x08, 0x10, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE0,
+0x22, 0xD0, 0x90, 0x60, 0xA0, 0x11, 0xF0, 0x30, 0x60, 0xF0, 0x70, 0x12, 0xA0, 0xF0, 0x60, 0x00,
+0x50, 0xB1, 0xD0, 0xB0, 0x60, 0xE0, 0xD0, 0xF0, 0x61, 0x90, 0x60, 0xD0, 0x40, 0xB0, 0xE1, 0x20,
+0xE0, 0xD0, 0x40, 0x60, 0xD0, 0x10, 0x40, 0xD0, 0x25, 0xE5, 0x91, 0x30, 0xC0, 0x0A, 0x60, 0x02,
+0x30, 0xC0, 0x02, 0xC0, 0x30, 0xC0, 0x0E, 0x0E, 0xC0, 0x31, 0xC0, 0x00, 0x80, 0x40, 0xD0, 0x24,
+0xE4, 0xD1, 0xE0, 0x90, 0x40, 0x91, 0xE2, 0x25, 0xE1, 0x20, 0xE2, 0x2A, 0xE6, 0xD0, 0x90, 0x40,
+0x90, 0xE0, 0xD0, 0xE3, 0x25, 0xE3, 0x22, 0xE2, 0xD0, 0xB0, 0x80, 0x30, 0x70, 0x09, 0x70, 0x80,
+0x03, 0xC0, 0x50, 0xA0, 0x70, 0x01, 0x70, 0x50, 0x02, 0x70, 0x80, 0x50, 0x80, 0xC0, 0x70, 0x30,
+0xC0, 0x01, 0x70, 0x80, 0x01, 0x60, 0x80, 0x01, 0x80, 0xA0, 0x06, 0xA0, 0x40, 0xD0, 0xE1, 0x20,
+0xE0, 0x21, 0xE0, 0x60, 0xF0, 0x80, 0x10, 0xA0, 0xD1, 0x40, 0xD0, 0x70, 0xA0, 0x60, 0x10, 0x80,
+0x00, 0xA0, 0x10, 0x90, 0xD0, 0xE1, 0x40, 0xD0, 0xF0, 0x50, 0x30, 0xC0, 0x05, 0xA0, 0xF0, 0x12,
+0x60, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE3, 0x21, 0xE0, 0xD0, 0xA0, 0x30, 0x10, 0xD0, 0xE1, 0x21,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xA0, 0x01, 0x70, 0x01, 0x80, 0x30, 0x00, 0x70, 0x00,
+0xC0, 0x50, 0x0E, 0x50, 0xC0, 0x05, 0x60, 0xF0, 0x70, 0x0A, 0xC0, 0x50, 0x81, 0xC0, 0x09, 0x70,
+0x50, 0xC0, 0x04, 0x70, 0xF0, 0x06, 0x80, 0x00, 0xF0, 0x40, 0x90, 0xE4, 0x22, 0xD1, 0x91, 0x40,
+0xF0, 0xB0, 0x60, 0xE0, 0xB0, 0x10, 0xA0, 0xB0, 0xF0, 0xA0, 0x10, 0x30, 0x50, 0x30, 0xA0, 0xD1,
+0xE1, 0xD0, 0xB0, 0xF0, 0x11, 0x90, 0xD0, 0xB0, 0xF0, 0xB0, 0xD1, 0x90, 0xD1, 0xF0, 0xB0, 0xE2,
+0x22, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0xE1, 0x90, 0x40, 0x90, 0xE0, 0xB0, 0x50, 0x0A, 0x30, 0x50,
+0x00, 0x70, 0xA0, 0x70, 0x0F, 0x05, 0x0F, 0x00, 0x30, 0x70, 0x80, 0x30, 0x60, 0xE1, 0x25, 0xE0,
+0x21, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x20, 0xE1, 0x21, 0xE4,
+0x25, 0xE1, 0x23, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE2, 0x21, 0xE0, 0x20,
+0xE0, 0x22, 0xE1, 0x21, 0xE2, 0xD1, 0x60, 0x70, 0x50, 0x70, 0x08, 0x60, 0x50, 0x05, 0x30, 0x70,
+0x01, 0x70, 0x80, 0x02, 0xC0, 0x10, 0x80, 0x02, 0x80, 0x70, 0x00, 0x30, 0x60, 0xA0, 0x60, 0x00,
+0x60, 0x80, 0xC0, 0x08, 0xC0, 0x30, 0x91, 0xD0, 0xE3, 0x20, 0xD0, 0x40, 0x31, 0x10, 0xD2, 0xE0,
+0x40, 0xA0, 0x30, 0x10, 0x60, 0x00, 0xC0, 0x10, 0xF0, 0xD0, 0xE1, 0xD0, 0x40, 0xD0, 0xB0, 0x10,
+0x07, 0x50, 0x70, 0x50, 0x70, 0x60, 0x10, 0xB0, 0xD0, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0x21, 0xE0,
+0x21, 0xE1, 0xD0, 0xB0, 0xA0, 0x10, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xA1, 0x12, 0x30, 0x04, 0x50, 0x0E, 0x71, 0x05, 0x80, 0xF0, 0x51, 0x09, 0x70, 0x50, 0x00,
+0x81, 0x50, 0x08, 0x50, 0x70, 0x07, 0xC0, 0x06, 0x30, 0x80, 0xA0, 0x90, 0xD0, 0xE3, 0x21, 0xE0,
+0x21, 0xE1, 0xD0, 0x90, 0x40, 0x91, 0xD1, 0xB0, 0x40, 0x30, 0x40, 0x80, 0x30, 0xA0, 0x30, 0xB0,
+0xD0, 0xE1, 0xD0, 0xE1, 0xD0, 0x60, 0x10, 0x60, 0xD0, 0xE0, 0xD0, 0x60, 0xB0, 0x90, 0xB2, 0xD0,
+0xA1, 0xD0, 0xE1, 0x21, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x90, 0x41, 0xE0, 0xD0, 0xE0, 0xD1, 0xA0,
+0x0A, 0x70, 0xF0, 0x30, 0x80, 0x50, 0x80, 0x0F, 0x05, 0x0F, 0x00, 0xA0, 0x02, 0x60, 0xD0, 0xE0,
+0x24, 0xE1, 0x27, 0xE2, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE8, 0x21, 0xE0, 0x28, 0xE5, 0x40, 0xD0,
+0xE0, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0x22, 0xE2, 0xD0, 0x40, 0x10,
+0x60, 0x50, 0x01, 0xC0, 0x50, 0x70, 0x05, 0x70, 0xA0, 0x06, 0xA0, 0xC0, 0x50, 0x00, 0xC0, 0x80,
+0x02, 0xA0, 0x30, 0x80, 0x02, 0x50, 0x80, 0xA0, 0x50, 0x01, 0xF0, 0x60, 0xF0, 0x01, 0x30, 0x50,
+0x06, 0x60, 0x40, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0xB0, 0x40, 0x70, 0xD0, 0x80, 0x60,
+0xB0, 0xD0, 0x90, 0xA0, 0xF0, 0x10, 0x70, 0x00, 0xA0, 0x10, 0x40, 0xD0, 0xE2, 0x91, 0xD0, 0x60,
+0x07, 0x50, 0x01, 0x80, 0x10, 0x30, 0xA0, 0xD0, 0xE2, 0x40, 0xD0, 0x24, 0xE1, 0xD0, 0xA0, 0x61,
+0x90, 0xE3, 0xA0, 0x40, 0xD1, 0x90, 0xE0, 0xA0, 0x90, 0x10, 0x80, 0x00, 0x80, 0x30, 0x03, 0xC0,
+0x70, 0x0D, 0xC0, 0x50, 0x07, 0x60, 0x70, 0x09, 0x50, 0x70, 0x01, 0xA0, 0x00, 0xC0, 0x50, 0x05,
+0xC0, 0x50, 0xC0, 0x0F, 0x00, 0x70, 0x50, 0xC0, 0x30, 0x60, 0xD0, 0x26, 0xE0, 0x22, 0xE1, 0xD1,
+0xA0, 0x40, 0xD1, 0x90, 0x40, 0x90, 0x30, 0x10, 0x40, 0x90, 0x40, 0xE1, 0xD0, 0xA0, 0x40, 0xE0,
+0xD0, 0xE0, 0xF0, 0x10, 0x80, 0xD0, 0xE0, 0xD1, 0x30, 0xA0, 0x30, 0xD0, 0xE0, 0xD0, 0xE0, 0x20,
+0xE2, 0xD1, 0xE0, 0x90, 0xB0, 0xA0, 0x90, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xB0, 0x0A,
+0x60, 0x02, 0xA0, 0x0F, 0x05, 0x0E, 0x50, 0x80, 0x01, 0x50, 0xB0, 0xD0, 0x21, 0xE5, 0x21, 0xE0,
+0x25, 0xE2, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xEA, 0x23, 0xE0, 0x22, 0xE3, 0xD0, 0x40, 0xE6,
+0x90, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x24, 0xE2, 0x90, 0xA0, 0x06, 0x70, 0x50, 0xC0, 0x02, 0xC0,
+0xA0, 0x06, 0x70, 0x30, 0x01, 0x50, 0x70, 0x30, 0x00, 0x50, 0x31, 0x00, 0xA0, 0x02, 0xC0, 0xA0,
+0x30, 0x70, 0x00, 0x70, 0x10, 0xC0, 0x10, 0xF0, 0x50, 0x10, 0x80, 0x06, 0xF0, 0x90, 0xD1, 0x40,
+0xE1, 0x91, 0xD1, 0x61, 0xB0, 0x11, 0x50, 0xF0, 0x40, 0x30, 0x80, 0xF0, 0x80, 0x00, 0x70, 0x11,
+0xD1, 0xE2, 0xD0, 0x40, 0xD0, 0x10, 0x07, 0x50, 0x02, 0x60, 0x10, 0xA0, 0x90, 0xE2, 0x40, 0xD0,
+0x24, 0xE0, 0xD0, 0xB0, 0x10, 0x40, 0xD0, 0xE3, 0xD0, 0x60, 0x30, 0xD1, 0x40, 0xD0, 0xB0, 0xF0,
+0x10, 0xF0, 0x10, 0x05, 0x50, 0x0D, 0xC0, 0x50, 0x09, 0x80, 0xA0, 0x70, 0x06, 0x50, 0xC0, 0x01,
+0x70, 0x30, 0x01, 0x71, 0x03, 0x70, 0x50, 0x0F, 0x00, 0xC0, 0x50, 0xC0, 0x00, 0x30, 0x10, 0x60,
+0xD0, 0xE0, 0x23, 0xE0, 0x25, 0xE1, 0xD0, 0xA0, 0x60, 0xE0, 0x40, 0x90, 0xE0, 0xD0, 0xB0, 0x10,
+0x40, 0xD0, 0x91, 0xE0, 0x20, 0x90, 0xE2, 0xD0, 0xE0, 0x60, 0x11, 0x90, 0xE0, 0xD0, 0xA0, 0xB0,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD2, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0x10, 0xD1, 0xE2, 0x22, 0xD0,
+0xA0, 0x0A, 0x30, 0x50, 0x01, 0x30, 0x70, 0x0F, 0x04, 0x0E, 0x30, 0x80, 0x30, 0x50, 0xA0, 0xD0,
+0xE1, 0x20, 0xE5, 0x21, 0xE2, 0x23, 0xE0, 0x20, 0xE3, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0x20, 0xE1,
+0x20, 0xE1, 0x21, 0xE4, 0x23, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x90, 0x40, 0x90,
+0xD1, 0x23, 0xE3, 0xD0, 0x30, 0x70, 0x08, 0x70, 0x50, 0x01, 0xA0, 0x07, 0x50, 0xF0, 0x02, 0x70,
+0xA0, 0x30, 0x80, 0x71, 0x00, 0x30, 0x02, 0x30, 0x10, 0x70, 0xC0, 0x51, 0x80, 0xF0, 0x30, 0x10,
+0x60, 0x08, 0x80, 0x40, 0xD1, 0xE0, 0x40, 0xD0, 0x90, 0xB0, 0x90, 0xA0, 0x30, 0xB2, 0xD0, 0x10,
+0x30, 0x60, 0x50, 0xF0, 0x50, 0x00, 0x70, 0x11, 0x30, 0xD0, 0x20, 0xE0, 0x21, 0xD0, 0x90, 0x60,
+0x50, 0x07, 0x70, 0xC0, 0x01, 0xA0, 0x10, 0xA0, 0x60, 0xD0, 0xE1, 0x40, 0xD0, 0x21, 0xE5, 0x40,
+0x90, 0xE0, 0x22, 0xE0, 0x90, 0x60, 0x30, 0xD0, 0x91, 0xA0, 0x60, 0xA0, 0x10, 0xF0, 0x70, 0x04,
+0x70, 0xC0, 0x0D, 0x50, 0x02, 0xC0, 0x07, 0x80, 0x50, 0x04, 0xC0, 0x50, 0xC0, 0x01, 0xC0, 0x60,
+0x03, 0x50, 0xC0, 0x00, 0xC0, 0x50, 0xC0, 0x0E, 0xC0, 0x50, 0x70, 0x03, 0x30, 0xF0, 0xD1, 0x21,
+0xE3, 0x20, 0xE0, 0x22, 0xE3, 0xB0, 0x40, 0x90, 0xD1, 0xE1, 0xF0, 0x30, 0xD1, 0x40, 0xE2, 0x90,
+0xA0, 0x90, 0xE0, 0xD1, 0xA0, 0x10, 0x90, 0xE0, 0xD0, 0xA1, 0xD0, 0x21, 0xE2, 0x91, 0x40, 0x90,
+0x20, 0xE1, 0xD0, 0xB0, 0xF0, 0xB0, 0xD0, 0x20, 0xE1, 0x21, 0xD0, 0x40, 0xB0, 0x09, 0x70, 0xA0,
+0x80, 0xA0, 0x30, 0x80, 0x0F, 0x04, 0x0E, 0x30, 0x01, 0x50, 0x60, 0xD0, 0x20, 0xE0, 0x20, 0xE5,
+0x24, 0xE3, 0x22, 0xE4, 0xD1, 0x90, 0x41, 0x90, 0x20, 0xE7, 0x21, 0xE2, 0x22, 0xE1, 0x91, 0xE2,
+0x23, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE1, 0x20, 0xE4, 0xD0, 0xA0, 0x01, 0x70, 0x07, 0xC0,
+0x70, 0x80, 0x50, 0x07, 0xC0, 0xA0, 0x01, 0xC0, 0x60, 0x80, 0x50, 0xC0, 0x50, 0x01, 0x30, 0xC0,
+0x00, 0x50, 0xA0, 0x03, 0x30, 0x50, 0x10, 0x60, 0x80, 0xA0, 0x07, 0x50, 0xF0, 0x40, 0xD1, 0x90,
+0x41, 0x31, 0x60, 0x30, 0x00, 0x50, 0xA0, 0xD0, 0xC0, 0x10, 0x80, 0x50, 0x30, 0x10, 0x50, 0x00,
+0xF0, 0x10, 0x30, 0xD0, 0xE0, 0x21, 0xE1, 0xD0, 0x31, 0x08, 0xC0, 0x70, 0x01, 0x80, 0x10, 0x60,
+0x40, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0xD0, 0xE0, 0xA0, 0xD0, 0xE0, 0x91, 0x23,
+0xD0, 0x31, 0xB0, 0xD0, 0x90, 0xE0, 0xB0, 0xA0, 0x00, 0x10, 0xF0, 0x30, 0x00, 0x50, 0xF0, 0xA0,
+0x30, 0x50, 0x0D, 0x50, 0x03, 0x10, 0x70, 0x06, 0xA0, 0x04, 0xC0, 0x50, 0x03, 0x80, 0x70, 0x04,
+0x50, 0x70, 0x50, 0x0F, 0x00, 0x51, 0x06, 0xF0, 0x90, 0xD0, 0xE0, 0x23, 0xE3, 0xD0, 0xE1, 0x90,
+0x40, 0x90, 0x40, 0x10, 0x60, 0xD0, 0x20, 0xE0, 0xD0, 0x90, 0x10, 0xB0, 0xD0, 0x91, 0xE0, 0xD1,
+0x91, 0xD0, 0xE0, 0xD0, 0x30, 0xF1, 0xA0, 0xD0, 0x60, 0xA0, 0xD0, 0x20, 0xE0, 0x20, 0x90, 0x40,
+0x91, 0xD0, 0xE2, 0x20, 0xD0, 0x40, 0x11, 0xD1, 0x23, 0xE1, 0xA0, 0x0A, 0x10, 0x70, 0x01, 0xA0,
+0x0F, 0x04, 0x0D, 0x70, 0x80, 0x01, 0x70, 0xB0, 0xD0, 0x28, 0xE2, 0x26, 0xE1, 0x22, 0xE6, 0x90,
+0x41, 0x90, 0xD1, 0xE1, 0x23, 0xE2, 0x22, 0xE1, 0x40, 0xE3, 0x25, 0xE1, 0xD1, 0x90, 0x40, 0x90,
+0xE0, 0xD1, 0x21, 0xD0, 0x90, 0x30, 0x00, 0x30, 0x09, 0xA0, 0x30, 0x50, 0x70, 0x07, 0x30, 0x70,
+0x31, 0x51, 0x00, 0x80, 0x01, 0x50, 0xF0, 0xA0, 0x61, 0x50, 0x00, 0x70, 0xC0, 0x50, 0xA0, 0x81,
+0x30, 0xA0, 0x50, 0x05, 0x70, 0xA0, 0x30, 0xD1, 0xB0, 0x10, 0xB0, 0xD0, 0x30, 0x80, 0x30, 0x70,
+0x02, 0x10, 0x90, 0x31, 0x10, 0x30, 0x00, 0x10, 0x50, 0x70, 0x10, 0xD2, 0xE0, 0x21, 0xE0, 0xD0,
+0xA0, 0x60, 0x50, 0x08, 0xC0, 0x50, 0x01, 0x80, 0xF0, 0x90, 0xD0, 0xE2, 0x40, 0xD1, 0xB0, 0x11,
+0xB0, 0x90, 0xD1, 0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xD0, 0xB0, 0x30, 0xF0, 0xD0, 0x40, 0xD1, 0x30,
+0x50, 0x00, 0x70, 0x12, 0x80, 0x50, 0x30, 0x0D, 0x50, 0xC0, 0x03, 0xA0, 0x10, 0x60, 0x04, 0xA0,
+0x80, 0x03, 0x70, 0x50, 0x04, 0xA0, 0x05, 0xC0, 0x80, 0x0E, 0x70, 0x50, 0xC0, 0x07, 0x10, 0x40,
+0xD0, 0xE2, 0x21, 0xE1, 0xD1, 0x90, 0x41, 0x90, 0xD2, 0xB0, 0xF0, 0xE1, 0x21, 0xD0, 0x90, 0x60,
+0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0xD0, 0x40, 0x60, 0xD0, 0xE0, 0xD1, 0x60, 0xA0, 0xD0, 0x10, 0x30,
+0xD0, 0x90, 0x41, 0x90, 0xB0, 0x60, 0xD0, 0xE2, 0x20, 0xE1, 0xD0, 0xF0, 0x10, 0xB0, 0xD0, 0x20,
+0xE0, 0x20, 0xE1, 0xD0, 0xA0, 0x70, 0x09, 0xA0, 0xC0, 0x01, 0x30, 0x0F, 0x04, 0x0D, 0x31, 0x50,
+0x00, 0x30, 0x90, 0xD0, 0x20, 0xE0, 0x26, 0xE1, 0x23, 0xE2, 0x21, 0xE1, 0x25, 0xE2, 0xD1, 0xE0,
+0x90, 0x40, 0x91, 0xE3, 0x20, 0xE2, 0x22, 0xE1, 0x90, 0xE1, 0x20, 0xE2, 0x21, 0xE1, 0x20, 0xE2,
+0xD1, 0x90, 0x41, 0xE2, 0xD0, 0xA0, 0xC0, 0x00, 0xA0, 0x08, 0x70, 0xA0, 0x01, 0xC0, 0x50, 0xC0,
+0x05, 0x60, 0x30, 0x01, 0xC0, 0x80, 0x70, 0xC0, 0x00, 0xC0, 0xA0, 0x03, 0x30, 0x00, 0x60, 0xF0,
+0x11, 0x31, 0xA0, 0xF0, 0x05, 0x50, 0x10, 0xA0, 0xC0, 0x40, 0xB1, 0xF0, 0xC0, 0x40, 0xA0, 0x70,
+0xC0, 0x00, 0xF0, 0x30, 0x00, 0x60, 0x50, 0x10, 0x02, 0x30, 0x10, 0xA0, 0x50, 0x10, 0xD1, 0xE1,
+0x20, 0xD0, 0xE0, 0xF0, 0x10, 0x00, 0x70, 0xC0, 0x08, 0x50, 0x00, 0x70, 0x10, 0x40, 0xD0, 0xE0,
+0x20, 0xE1, 0x40, 0x90, 0x12, 0xA0, 0xB0, 0xD0, 0xE1, 0x40, 0xD0, 0xE1, 0x22, 0xB0, 0xF1, 0x40,
+0x90, 0xE1, 0xD0, 0x60, 0xC0, 0x01, 0x80, 0xA0, 0x10, 0x30, 0x70, 0x0C, 0x71, 0x06, 0x70, 0x03,
+0xA0, 0x30, 0x00, 0xC0, 0x01, 0x50, 0x70, 0x05, 0xA0, 0x06, 0x71, 0x0B, 0xC0, 0x50, 0x70, 0x09,
+0x10, 0x40, 0xD0, 0xE0, 0x21, 0xE3, 0x90, 0x41, 0xE0, 0xD0, 0xE3, 0xD0, 0xF0, 0x40, 0xD0, 0x22,
+0xD1, 0xE0, 0xD0, 0x40, 0xE2, 0xD0, 0x90, 0x10, 0x90, 0xD0, 0xE3, 0xD0, 0x60, 0xA0, 0x40, 0x90,
+0xD1, 0xE0, 0xD0, 0x10, 0x90, 0xD0, 0xE1, 0x20, 0xE1, 0xD0, 0x11, 0xF0, 0xD1, 0x20, 0xE2, 0xD1,
+0xA0, 0x09, 0x50, 0x30, 0xC0, 0x50, 0xA0, 0x80, 0x0F, 0x03, 0x0D, 0xA0, 0x00, 0x50, 0x30, 0x60,
+0xD1, 0x21, 0xE0, 0x22, 0xE0, 0x25, 0xE1, 0x22, 0xE0, 0x2A, 0xE6, 0x90, 0x40, 0x90, 0xE0, 0xD1,
+0x24, 0xE1, 0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x23, 0xE2, 0x21, 0xE2, 0x90, 0x40, 0x90, 0xD0,
+0xA0, 0x0B, 0x50, 0x70, 0x80, 0x10, 0x80, 0xC0, 0x70, 0x50, 0x03, 0x80, 0x30, 0x03, 0x30, 0x50,
+0x00, 0xC0, 0x60, 0x04, 0x60, 0xA0, 0x81, 0x30, 0x80, 0x62, 0x50, 0x05, 0xA0, 0x80, 0xA2, 0x30,
+0xA0, 0x40, 0x30, 0x60, 0x01, 0x50, 0xC2, 0x30, 0xB0, 0x30, 0x81, 0xC1, 0xF0, 0x60, 0xA0, 0x31,
+0xD1, 0xE1, 0xD1, 0xB0, 0x10, 0x30, 0x01, 0x70, 0x08, 0x50, 0xC0, 0x10, 0xB0, 0xD0, 0x20, 0xE1,
+0x20, 0xE0, 0x41, 0xF1, 0xA0, 0x60, 0x40, 0x90, 0xD0, 0x20, 0x90, 0xD0, 0xE0, 0x23, 0xD0, 0xF0,
+0x10, 0xA0, 0xD0, 0xE1, 0xD0, 0x40, 0x60, 0x80, 0x70, 0xC0, 0x00, 0x50, 0x30, 0x50, 0x0B, 0x71,
+0x0C, 0x10, 0xA0, 0x81, 0x00, 0x50, 0x70, 0x05, 0x70, 0x80, 0x07, 0x50, 0x09, 0xC0, 0x50, 0x70,
+0x0B, 0x80, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE5, 0xD0, 0xB0, 0xF0,
+0xD0, 0x21, 0xE0, 0xD0, 0xA1, 0xD0, 0xE0, 0x40, 0xE0, 0x21, 0xD0, 0xF0, 0x30, 0xD0, 0xE0, 0xD0,
+0x92, 0x60, 0x10, 0x90, 0xD0, 0xE2, 0xD0, 0xA1, 0xD0, 0x22, 0xE1, 0xD0, 0xA0, 0x70, 0x30, 0xA0,
+0xE0, 0xD0, 0xE0, 0x20, 0xD0, 0xA0, 0xD0, 0xA0, 0xC0, 0x09, 0x10, 0x80, 0x70, 0x00, 0xA0, 0x0F,
+0x03, 0x0C, 0x70, 0x80, 0x01, 0x70, 0xB0, 0xD0, 0x20, 0xE2, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE0,
+0x21, 0xE2, 0x2F, 0x00, 0xE4, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0x20, 0xE2, 0xD0, 0xE0, 0x40, 0xD0,
+0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x23, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x80, 0x0B,
+0x50, 0x30, 0x10, 0x30, 0x10, 0xF0, 0x00, 0xC0, 0x50, 0xC0, 0x70, 0xA1, 0xC0, 0x03, 0x80, 0x01,
+0x60, 0x50, 0x03, 0xA0, 0x30, 0x50, 0xA0, 0x80, 0x30, 0x12, 0x70, 0xC0, 0x50, 0x03, 0xF0, 0xA0,
+0x80, 0xA0, 0x80, 0x01, 0x70, 0x30, 0x80, 0x30, 0xF0, 0x01, 0x50, 0x01, 0x60, 0xD0, 0x40, 0x50,
+0x10, 0x70, 0x30, 0x60, 0x10, 0xF0, 0x10, 0xA0, 0xE2, 0xD0, 0x40, 0xF0, 0x11, 0x30, 0x01, 0x50,
+0x08, 0x70, 0x50, 0x10, 0xB0, 0xD0, 0xE3, 0x20, 0x40, 0x90, 0x13, 0x60, 0xD1, 0x91, 0xD0, 0xE0,
+0x23, 0xD0, 0xB0, 0x10, 0xA0, 0xD0, 0xE1, 0xD2, 0xA0, 0xF0, 0x10, 0x00, 0xC0, 0x61, 0x0A, 0xC0,
+0x50, 0x0D, 0x30, 0x01, 0xC0, 0xA0, 0x30, 0x06, 0x30, 0xC0, 0x07, 0x70, 0x50, 0x07, 0x70, 0x50,
+0x0D, 0x50, 0xB0, 0xD1, 0xE1, 0x90, 0x40, 0x90, 0xE3, 0x21, 0xE1, 0xD0, 0xE1, 0xD0, 0xF0, 0x40,
+0xD0, 0xE2, 0x40, 0xB0, 0xD0, 0xE0, 0x40, 0xD0, 0x21, 0xD0, 0x30, 0xF0, 0xE0, 0x90, 0x42, 0xD0,
+0x30, 0xF0, 0x90, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xA0, 0x10, 0x90, 0xE0, 0x20, 0xE2, 0xD0, 0xB0,
+0x51, 0x60, 0x10, 0x90, 0xE1, 0xD0, 0x60, 0x90, 0x30, 0x70, 0x09, 0xF0, 0x02, 0x30, 0x0F, 0x03,
+0x0C, 0x50, 0x80, 0x01, 0x80, 0x40, 0xD0, 0x21, 0xE0, 0x24, 0xE2, 0x20, 0xE1, 0x20, 0xE3, 0x20,
+0xE6, 0x20, 0xE7, 0x20, 0xE3, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE0, 0xD0, 0x91, 0xD0, 0x23,
+0xE1, 0x20, 0xE1, 0x21, 0xE2, 0x22, 0xE4, 0xD0, 0xF0, 0x60, 0x70, 0x08, 0x61, 0x10, 0xE0, 0xD1,
+0xA1, 0x30, 0x00, 0x50, 0xF0, 0x51, 0x70, 0x02, 0xC0, 0xA0, 0x70, 0x81, 0x02, 0x80, 0xA3, 0xC0,
+0x02, 0x10, 0xF0, 0x01, 0xC0, 0x50, 0x01, 0x70, 0x11, 0xF0, 0x51, 0xC0, 0x02, 0x10, 0xC1, 0x02,
+0x50, 0x10, 0x60, 0xE0, 0x40, 0xF0, 0x10, 0xA0, 0x10, 0x90, 0xA1, 0xB0, 0x90, 0x40, 0xE0, 0xD1,
+0xA0, 0xF0, 0x11, 0x02, 0x70, 0xC0, 0x08, 0x11, 0xD0, 0xE0, 0x20, 0xE3, 0x40, 0xD0, 0x90, 0x11,
+0x80, 0xA0, 0xD1, 0x90, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xA0, 0x31, 0xD2, 0x90, 0xA1,
+0x50, 0x70, 0x00, 0x80, 0x10, 0x80, 0x0A, 0x50, 0x0E, 0x30, 0x00, 0xC0, 0x50, 0x10, 0x04, 0x60,
+0xA0, 0x30, 0x80, 0x07, 0x30, 0x10, 0x50, 0xC0, 0x04, 0x70, 0x50, 0xC0, 0x0E, 0x80, 0x10, 0x40,
+0xB0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE2, 0x23, 0xE1, 0xD0, 0xE0, 0xD0, 0xB0, 0xA0, 0xD0, 0xE0,
+0x21, 0xD2, 0xE0, 0x90, 0xE1, 0xD1, 0x80, 0x30, 0xB0, 0x90, 0xD0, 0x40, 0xA0, 0xC0, 0x60, 0x80,
+0xD0, 0x20, 0xE0, 0x21, 0xE1, 0x60, 0x40, 0xD1, 0xE1, 0xD1, 0x60, 0x01, 0x11, 0xB0, 0x21, 0xD0,
+0x60, 0xF0, 0x80, 0x50, 0x09, 0x80, 0x50, 0x01, 0x30, 0x70, 0x0F, 0x02, 0x0C, 0x30, 0x80, 0xA0,
+0x30, 0xA0, 0x90, 0xE4, 0x21, 0xE2, 0x21, 0xE2, 0x23, 0xEE, 0x20, 0xE2, 0x21, 0xE3, 0xD1, 0xE0,
+0x90, 0x41, 0xE0, 0x40, 0xD0, 0xE1, 0x24, 0xE0, 0x22, 0xE3, 0x22, 0xE1, 0x21, 0xD0, 0x90, 0x10,
+0x30, 0xC0, 0x81, 0x04, 0x30, 0x10, 0xA0, 0x40, 0xD0, 0xE1, 0xD1, 0xB0, 0x60, 0xA1, 0xC0, 0x70,
+0x81, 0x50, 0x80, 0x50, 0x30, 0x10, 0xF0, 0x60, 0x00, 0x70, 0x30, 0x60, 0x70, 0x00, 0xC0, 0x80,
+0x01, 0x70, 0x50, 0xA0, 0x11, 0x03, 0x31, 0x80, 0x03, 0x60, 0x70, 0x02, 0x70, 0x03, 0x30, 0x10,
+0x50, 0x60, 0xE0, 0x90, 0x11, 0x60, 0x40, 0xD4, 0x91, 0xD0, 0xB0, 0xA0, 0x10, 0xF0, 0x04, 0x50,
+0x07, 0x30, 0x60, 0xB0, 0xD1, 0x20, 0xE1, 0xD0, 0xE0, 0x40, 0xD1, 0xB0, 0x10, 0xD1, 0xE1, 0x40,
+0xE5, 0x20, 0xE0, 0xD0, 0xB0, 0x31, 0x60, 0xF0, 0x11, 0x70, 0x02, 0x70, 0xC0, 0x70, 0x0A, 0x50,
+0x0C, 0xA0, 0x70, 0x00, 0x50, 0x30, 0x70, 0x04, 0xC0, 0x60, 0xC0, 0x0A, 0xC0, 0x50, 0x00, 0x50,
+0x02, 0xC0, 0x50, 0x70, 0x0F, 0x00, 0xC0, 0x10, 0xF0, 0xA1, 0x40, 0xD1, 0xE0, 0xD1, 0xE0, 0x24,
+0xE1, 0x20, 0xE1, 0x90, 0x10, 0xD0, 0xE0, 0x21, 0xE0, 0x40, 0x90, 0xE0, 0xD0, 0x40, 0x90, 0x41,
+0x30, 0xB0, 0x40, 0xD1, 0xB0, 0x10, 0xB1, 0xA0, 0x90, 0x22, 0xE1, 0xD0, 0x40, 0xB0, 0xD0, 0xE2,
+0xD0, 0x40, 0x60, 0x01, 0x30, 0xF0, 0x40, 0xE0, 0x20, 0xD1, 0x60, 0xA0, 0x50, 0x09, 0x50, 0xF0,
+0x30, 0xA0, 0x30, 0x80, 0x0F, 0x02, 0x0C, 0xA0, 0x01, 0xC0, 0x60, 0x90, 0x40, 0x92, 0xD0, 0xE2,
+0x29, 0xE0, 0x26, 0xE3, 0x20, 0xE0, 0x26, 0xEA, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x25,
+0xE2, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0xA0, 0xC0, 0x02, 0xC0, 0x50, 0x70, 0x00, 0x70, 0xA0, 0xB0,
+0xE0, 0xD1, 0xE0, 0x23, 0xD0, 0x30, 0x50, 0x02, 0x70, 0xA0, 0x30, 0x80, 0x30, 0x50, 0xC0, 0x30,
+0xF1, 0x30, 0x50, 0x02, 0xC0, 0x60, 0x01, 0x80, 0x10, 0xA0, 0x60, 0x10, 0x01, 0xC0, 0x30, 0x60,
+0x71, 0x50, 0x06, 0x10, 0xC0, 0x02, 0xC0, 0x80, 0xA0, 0x70, 0x40, 0xD0, 0x40, 0x60, 0x90, 0xD1,
+0xE1, 0x20, 0xE1, 0xD0, 0x40, 0xF0, 0x11, 0x60, 0xC0, 0x04, 0x50, 0x07, 0x10, 0x60, 0x40, 0xD0,
+0xE2, 0xD1, 0xE0, 0x90, 0xD2, 0x90, 0xD0, 0xE1, 0xD0, 0x40, 0xE3, 0x22, 0xE1, 0x40, 0xF1, 0x60,
+0xB0, 0x90, 0xB0, 0x10, 0x01, 0xC0, 0x50, 0x0B, 0x50, 0xC0, 0x06, 0x80, 0x04, 0xC0, 0x01, 0x50,
+0x80, 0x00, 0x80, 0x60, 0xA0, 0x80, 0x00, 0x30, 0xC0, 0x0E, 0xC0, 0x70, 0x00, 0x50, 0x70, 0x0F,
+0x02, 0xA1, 0x80, 0xA0, 0x70, 0x60, 0x90, 0xE0, 0x20, 0xE3, 0x22, 0xE0, 0x21, 0xE1, 0x20, 0xD0,
+0xF0, 0x40, 0xD0, 0x40, 0x20, 0xD0, 0xB1, 0xE0, 0x40, 0xB0, 0x90, 0xE0, 0xD0, 0x31, 0x40, 0xD1,
+0xF0, 0xB0, 0xE0, 0xA1, 0xD0, 0xE1, 0x21, 0xE7, 0xD0, 0x10, 0x70, 0x02, 0xA0, 0xD0, 0xE0, 0xD1,
+0x50, 0xF0, 0x30, 0x06, 0xC0, 0x70, 0x51, 0xC0, 0x60, 0xC0, 0x01, 0xA0, 0x0F, 0x02, 0x0B, 0x70,
+0x80, 0x01, 0x70, 0xB0, 0xD1, 0x92, 0x40, 0x91, 0xE4, 0x25, 0xE0, 0x27, 0xE2, 0x20, 0xE0, 0x26,
+0xE0, 0x23, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE0, 0x90, 0x41, 0x90, 0xE3, 0x24, 0xE2, 0x21, 0xE2,
+0x20, 0xE0, 0xD0, 0x60, 0x05, 0xC0, 0x80, 0xA0, 0x90, 0xD1, 0xE2, 0x23, 0xD0, 0xB0, 0x70, 0x00,
+0x30, 0x60, 0xF0, 0x70, 0x00, 0x50, 0x80, 0x50, 0x00, 0x10, 0x30, 0x70, 0xA0, 0x02, 0x80, 0x31,
+0x70, 0xC0, 0x80, 0x10, 0x60, 0xF1, 0x00, 0x70, 0x10, 0x50, 0x01, 0x81, 0x06, 0x71, 0x00, 0xC0,
+0x00, 0x70, 0x10, 0xA0, 0x80, 0xA1, 0x40, 0xD1, 0x21, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0x61, 0x10,
+0x30, 0x06, 0x70, 0xC0, 0x02, 0x70, 0x61, 0xF0, 0x10, 0x30, 0xE1, 0x92, 0x45, 0x92, 0x20, 0xE1,
+0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0x90, 0xD0, 0x90, 0xD1, 0xC0, 0xF0, 0x30, 0x01,
+0x50, 0x0B, 0x71, 0x07, 0xA0, 0x50, 0x05, 0x51, 0x60, 0xA1, 0x01, 0x50, 0xA0, 0x30, 0x0F, 0x01,
+0x80, 0x50, 0xC0, 0x0F, 0x02, 0x70, 0x30, 0x40, 0x70, 0xA0, 0x70, 0xD0, 0xB0, 0xD0, 0xE0, 0x20,
+0xE0, 0xD0, 0xE0, 0x26, 0xE0, 0x20, 0xD0, 0x40, 0xA0, 0xD0, 0x90, 0xD1, 0x30, 0x40, 0x93, 0xD1,
+0xA0, 0x60, 0xD1, 0xE0, 0xF0, 0x40, 0xD0, 0xA0, 0x40, 0xD0, 0xE3, 0xD0, 0xB0, 0x60, 0xD0, 0xE2,
+0x20, 0x60, 0x10, 0xC0, 0x02, 0x80, 0x40, 0xD0, 0xB1, 0x60, 0xC0, 0x04, 0xC0, 0x51, 0x71, 0x02,
+0x60, 0x70, 0x01, 0x30, 0xC0, 0x0F, 0x01, 0x0B, 0x80, 0x60, 0x30, 0x70, 0xB0, 0x90, 0xD0, 0xE3,
+0xD0, 0xE0, 0x90, 0x41, 0x91, 0xE0, 0xD0, 0xE0, 0x28, 0xE1, 0x23, 0xE4, 0x2A, 0xE1, 0x20, 0xE0,
+0xD0, 0x40, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD1, 0x20, 0xE1, 0x20, 0xE1, 0x23, 0xE4, 0xA0,
+0x05, 0x70, 0x10, 0xD0, 0x41, 0xE0, 0xD0, 0xE0, 0x23, 0xE0, 0xD0, 0x80, 0xA0, 0x00, 0xA0, 0x03,
+0x70, 0x50, 0x30, 0x71, 0x30, 0x00, 0xA0, 0x60, 0x80, 0xA0, 0x70, 0x00, 0x80, 0x11, 0xA0, 0x30,
+0x50, 0x10, 0x60, 0x00, 0x60, 0xC0, 0xA0, 0x02, 0xC0, 0x50, 0x03, 0x50, 0x71, 0x01, 0x60, 0x70,
+0x01, 0x60, 0xF0, 0x10, 0x30, 0x90, 0xD0, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x60, 0x10, 0x80,
+0x30, 0x08, 0x50, 0x02, 0x50, 0x11, 0x60, 0x30, 0x42, 0x92, 0x21, 0xE0, 0x40, 0xE2, 0x90, 0x44,
+0x91, 0xE0, 0xD0, 0xE3, 0x40, 0xD3, 0xB0, 0xF0, 0x30, 0x01, 0xC0, 0x50, 0x0A, 0x71, 0x08, 0x80,
+0xA0, 0x04, 0x50, 0xC1, 0x30, 0x04, 0x70, 0x0F, 0x00, 0x70, 0x50, 0x70, 0x50, 0x0F, 0x00, 0xC0,
+0x50, 0xA0, 0x70, 0x10, 0xA0, 0xD0, 0x40, 0x30, 0x00, 0x60, 0xD0, 0x20, 0xE0, 0xD0, 0xE2, 0x25,
+0xE2, 0xD0, 0x60, 0x92, 0xA1, 0x90, 0xD1, 0xE0, 0x40, 0xD0, 0x90, 0x60, 0xB0, 0xD0, 0x60, 0xD0,
+0xA0, 0x90, 0xE0, 0xD0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x60, 0xE0, 0x90, 0xE2, 0xD1, 0xF0, 0x80,
+0x03, 0x70, 0x30, 0xC0, 0x10, 0xA0, 0xC0, 0x01, 0xC0, 0x52, 0x70, 0x06, 0x50, 0x80, 0x50, 0x30,
+0x60, 0x70, 0x0F, 0x01, 0x0B, 0x30, 0x01, 0x50, 0xF0, 0xE2, 0x20, 0xE2, 0xD0, 0xE1, 0xD0, 0x91,
+0x41, 0x90, 0xEA, 0x24, 0xE3, 0x2A, 0xE0, 0x22, 0x91, 0xE4, 0xD0, 0xE0, 0x90, 0x41, 0xE6, 0x22,
+0xE2, 0xD0, 0x90, 0x30, 0x05, 0x60, 0x40, 0xD1, 0xE0, 0x41, 0x90, 0xE1, 0x20, 0xE1, 0xD0, 0x40,
+0xA0, 0x00, 0x80, 0x70, 0x01, 0x70, 0xA0, 0x80, 0xF0, 0x50, 0x70, 0x30, 0x02, 0xF0, 0x02, 0x50,
+0x11, 0x70, 0x01, 0x10, 0x01, 0x30, 0x00, 0x10, 0x00, 0xC0, 0x01, 0xF2, 0x01, 0x80, 0x50, 0x80,
+0x50, 0x04, 0xC0, 0x60, 0x10, 0x90, 0x40, 0xE0, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x90, 0x10,
+0xA0, 0xC0, 0x50, 0x08, 0x70, 0x01, 0x30, 0x81, 0xF0, 0x50, 0xD1, 0xE0, 0xD1, 0xE1, 0x20, 0xE0,
+0xD0, 0x40, 0xD0, 0xE2, 0xD0, 0xE0, 0xD2, 0xE0, 0x90, 0x42, 0x90, 0xE0, 0x91, 0xD1, 0x61, 0xF1,
+0xC0, 0x01, 0x50, 0x0A, 0xC0, 0x50, 0x0E, 0xC0, 0x50, 0x01, 0x70, 0x60, 0x00, 0x60, 0xC0, 0x0F,
+0x01, 0xC0, 0x50, 0x70, 0x30, 0x00, 0x70, 0xC0, 0x0C, 0x70, 0x50, 0x70, 0x30, 0x80, 0xA0, 0x50,
+0x10, 0xE0, 0xD0, 0xA2, 0xD0, 0x20, 0xE3, 0x23, 0xE0, 0x20, 0xE2, 0xD0, 0x91, 0x40, 0x60, 0x10,
+0xF0, 0x80, 0x40, 0xD0, 0xE0, 0xD0, 0x40, 0xE0, 0x60, 0x80, 0x30, 0x50, 0x10, 0xF0, 0x40, 0xD0,
+0xE0, 0x24, 0xE2, 0x20, 0x90, 0xE4, 0x11, 0x70, 0x03, 0xA1, 0xF0, 0x71, 0x51, 0x70, 0x0A, 0x70,
+0x10, 0x50, 0x00, 0x70, 0x80, 0x0F, 0x01, 0x04, 0x70, 0xC0, 0x04, 0xA0, 0x02, 0x60, 0xD0, 0x23,
+0xE9, 0x91, 0x40, 0x91, 0xE1, 0xD0, 0xE1, 0x24, 0xE0, 0x25, 0xE2, 0x21, 0xE1, 0x21, 0xE1, 0x21,
+0xE0, 0x40, 0xEA, 0x90, 0x41, 0x90, 0xD0, 0xE1, 0x23, 0xE2, 0x40, 0x80, 0x04, 0x80, 0x40, 0xD1,
+0xE2, 0x20, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0xD0, 0xB0, 0x80, 0x60, 0xF0, 0x70, 0xC0, 0x31,
+0xC0, 0x00, 0x60, 0x50, 0x00, 0x80, 0x50, 0x01, 0xA0, 0x03, 0x30, 0x11, 0x31, 0x50, 0x01, 0xA0,
+0x00, 0x10, 0x00, 0x10, 0x30, 0x00, 0x70, 0xC0, 0x50, 0xC1, 0xA0, 0x70, 0x10, 0xC0, 0xA0, 0x50,
+0x01, 0x70, 0xA0, 0x10, 0x30, 0xD0, 0xE0, 0x40, 0xE1, 0x22, 0xE0, 0xD0, 0x11, 0xC0, 0x00, 0x70,
+0xC0, 0x07, 0x70, 0x50, 0x80, 0xF1, 0x60, 0xA0, 0xD1, 0xE8, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x20,
+0xD0, 0xE1, 0xD1, 0xE1, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0x32, 0x02, 0x71, 0x0A, 0x50, 0x07, 0xC0,
+0x10, 0xC0, 0x00, 0x80, 0xC0, 0x00, 0x70, 0x50, 0x00, 0x70, 0x10, 0x70, 0x50, 0x30, 0x70, 0x0F,
+0x01, 0x50, 0x70, 0x04, 0x50, 0x0A, 0x70, 0x50, 0x70, 0x01, 0xA0, 0x02, 0xF0, 0xE0, 0xD1, 0x40,
+0xD0, 0xE0, 0x27, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0x90, 0xF0, 0x70, 0x50, 0x80, 0xF0,
+0x90, 0xE2, 0x90, 0xA0, 0x50, 0x80, 0xA0, 0x11, 0xB0, 0xD0, 0xE2, 0x22, 0xE0, 0xD0, 0xE1, 0xA0,
+0xD0, 0x21, 0xD1, 0xA0, 0x80, 0x30, 0x03, 0x50, 0x80, 0x50, 0x70, 0xC0, 0x0E, 0x60, 0x02, 0x30,
+0x0F, 0x01, 0x03, 0x82, 0x03, 0xC0, 0xA0, 0x01, 0xC0, 0xB0, 0xD0, 0x21, 0xE0, 0x24, 0xE1, 0x22,
+0xE0, 0xD1, 0xE1, 0x90, 0x42, 0xE0, 0x20, 0xE5, 0x23, 0xE0, 0x22, 0xE2, 0x21, 0xE1, 0x20, 0xE0,
+0x20, 0xE1, 0x40, 0xEA, 0xD1, 0xE0, 0x41, 0x90, 0x20, 0xE2, 0x20, 0xE1, 0xD0, 0x90, 0xB0, 0x04,
+0x60, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x90, 0x40, 0x90, 0xE0, 0xD1, 0x11, 0xA0, 0xC0, 0x30,
+0x50, 0xC0, 0x02, 0x60, 0x00, 0xC0, 0x30, 0x70, 0xC0, 0xA0, 0x50, 0x01, 0xC0, 0x30, 0x60, 0x12,
+0x30, 0x00, 0x70, 0x30, 0x00, 0x80, 0x00, 0x50, 0x70, 0x01, 0x70, 0x51, 0xC0, 0x00, 0xA0, 0x10,
+0x60, 0x10, 0x80, 0x00, 0x31, 0x80, 0x10, 0xD2, 0xE0, 0x40, 0xD0, 0x21, 0xE0, 0xD0, 0xA0, 0x10,
+0xA0, 0x02, 0x50, 0x05, 0x70, 0x50, 0xC0, 0x00, 0x11, 0x60, 0x10, 0xB0, 0xD0, 0x22, 0xE0, 0x20,
+0xE4, 0x40, 0xD0, 0xE0, 0x23, 0xE1, 0xD1, 0xE1, 0xD4, 0x90, 0x40, 0xB0, 0x31, 0x50, 0x02, 0x50,
+0x0A, 0x50, 0x08, 0xC0, 0x80, 0x01, 0x70, 0xC0, 0x70, 0x50, 0x02, 0x30, 0x10, 0xA0, 0x50, 0x30,
+0x0E, 0x70, 0x50, 0xC0, 0x05, 0x70, 0xC0, 0x07, 0x70, 0x50, 0x70, 0x03, 0xA0, 0x02, 0x80, 0xB0,
+0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x90, 0x41, 0x90, 0xD0, 0xE1,
+0xD0, 0xA0, 0x02, 0xB0, 0x40, 0xE0, 0x20, 0xE0, 0x40, 0xA0, 0x30, 0x80, 0x10, 0x61, 0x40, 0xE4,
+0x20, 0xE2, 0xD0, 0xE2, 0x20, 0xE1, 0xD0, 0x10, 0x40, 0x30, 0x00, 0x70, 0x50, 0x70, 0xC0, 0x0F,
+0x03, 0xA0, 0x70, 0x01, 0xA0, 0x0F, 0x01, 0x03, 0x81, 0x30, 0x03, 0x50, 0x80, 0x31, 0xF0, 0x90,
+0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x23, 0xE7, 0x90, 0x41, 0x91, 0xE0, 0xD1, 0xE2, 0x21,
+0xE7, 0x21, 0xE3, 0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x23, 0xE3, 0xD1, 0x90, 0x41, 0x90, 0xE0,
+0xD1, 0xE0, 0xD0, 0x40, 0x80, 0x03, 0xB0, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0xD0, 0xE0, 0x90, 0x41,
+0xC0, 0x10, 0xA0, 0x10, 0x60, 0x00, 0x50, 0x00, 0x80, 0x50, 0x30, 0xA0, 0x50, 0x00, 0x60, 0x51,
+0xA1, 0x62, 0x00, 0xC0, 0x30, 0x00, 0xF0, 0x10, 0xA0, 0x00, 0xA0, 0x03, 0xC0, 0x80, 0x70, 0xA0,
+0x00, 0xC0, 0x10, 0x50, 0xC0, 0x10, 0x70, 0x10, 0xA0, 0xC0, 0xF0, 0x50, 0x10, 0xB0, 0xD0, 0xE0,
+0x20, 0xD0, 0x91, 0xD0, 0x21, 0xD0, 0xF0, 0x80, 0x03, 0x71, 0x02, 0x50, 0x70, 0x00, 0xA0, 0x02,
+0x70, 0x10, 0xF0, 0xD1, 0x22, 0xD0, 0xE0, 0x23, 0xE0, 0x40, 0xE1, 0x23, 0xE0, 0xD0, 0xA0, 0x12,
+0x80, 0x90, 0xD3, 0x90, 0x60, 0x30, 0xA0, 0x50, 0x01, 0x50, 0xC0, 0x09, 0x50, 0xC0, 0x0D, 0x50,
+0x70, 0x04, 0x30, 0x50, 0x30, 0x70, 0x08, 0x50, 0x10, 0x01, 0x70, 0x50, 0x70, 0x08, 0x50, 0x05,
+0x70, 0x50, 0x70, 0x01, 0x30, 0x60, 0x01, 0xF0, 0xC0, 0x02, 0xA0, 0xD0, 0xE0, 0x20, 0xE1, 0xD6,
+0x90, 0x41, 0x90, 0xD1, 0xE4, 0x40, 0x80, 0x01, 0x10, 0xB0, 0xD0, 0xE1, 0x90, 0xA0, 0xF0, 0xD0,
+0x30, 0x80, 0xA0, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xD0, 0xB0, 0xA1, 0xD0, 0xE0, 0xD2,
+0x60, 0x81, 0x70, 0xC0, 0x0F, 0x06, 0x80, 0x60, 0x30, 0x80, 0x30, 0x70, 0x0F, 0x00, 0x04, 0x70,
+0x04, 0xA0, 0x02, 0xA0, 0xD0, 0xE0, 0x22, 0xE1, 0x22, 0xE1, 0x29, 0xE2, 0xD1, 0x91, 0x41, 0x90,
+0xE1, 0xD0, 0xE3, 0x20, 0xE5, 0x20, 0xE0, 0x20, 0xE1, 0x90, 0xE0, 0xD0, 0x22, 0xE1, 0x23, 0xE0,
+0x20, 0xE2, 0xD1, 0xE1, 0x90, 0x40, 0x91, 0xE0, 0xD0, 0x40, 0x80, 0x01, 0x30, 0x80, 0xA0, 0xD0,
+0xE0, 0x24, 0xE0, 0x20, 0xE4, 0x90, 0x40, 0xB0, 0xD0, 0xA0, 0x10, 0xA0, 0xC0, 0x01, 0xA0, 0xC0,
+0x70, 0xF0, 0xA0, 0x50, 0xA0, 0x10, 0x00, 0x71, 0x60, 0x02, 0xA0, 0x00, 0x70, 0xF0, 0xA2, 0x80,
+0x03, 0x30, 0x50, 0x11, 0x60, 0xA0, 0x70, 0x30, 0x80, 0x60, 0x11, 0x30, 0x00, 0x10, 0xA0, 0xD0,
+0x20, 0xE1, 0xD1, 0x91, 0xE0, 0xD0, 0x40, 0x10, 0x05, 0x30, 0x81, 0x30, 0xC0, 0x80, 0xF0, 0x60,
+0x10, 0x60, 0xA0, 0x60, 0x30, 0xD0, 0xE1, 0x22, 0xB1, 0xD0, 0x22, 0xE0, 0x40, 0xD0, 0xE0, 0x21,
+0xE0, 0xD1, 0x60, 0x15, 0x60, 0x30, 0x60, 0xF0, 0xB0, 0x50, 0x10, 0xA0, 0x50, 0x70, 0xC0, 0x70,
+0x09, 0x50, 0xC0, 0x0D, 0x50, 0xC0, 0x06, 0x70, 0xA0, 0x07, 0xC0, 0x02, 0xC0, 0x50, 0x70, 0x0A,
+0x70, 0xC0, 0x01, 0xC0, 0x70, 0x50, 0xC0, 0x07, 0xF0, 0x01, 0xC0, 0x00, 0x80, 0xB0, 0xD0, 0xE0,
+0xD0, 0x90, 0x61, 0xA0, 0xB0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xE0, 0xD0,
+0xA0, 0x00, 0xC0, 0xA0, 0x10, 0xC0, 0xD2, 0xB0, 0xF0, 0xD0, 0x50, 0x40, 0xA0, 0xD1, 0xE2, 0x20,
+0xE0, 0x20, 0xE0, 0xD1, 0xB0, 0x92, 0x41, 0x30, 0xA0, 0x10, 0x70, 0x0F, 0x08, 0xC0, 0xA0, 0x01,
+0xC0, 0x80, 0x0F, 0x00, 0x04, 0x50, 0x80, 0x70, 0xC0, 0x01, 0xA0, 0x02, 0xA0, 0xD0, 0xE0, 0x20,
+0xE3, 0x22, 0xE1, 0x22, 0xE1, 0x22, 0xE2, 0x20, 0xE1, 0x20, 0xE2, 0x20, 0x90, 0x41, 0x91, 0xE1,
+0xD1, 0xE2, 0x25, 0xE1, 0x40, 0xD0, 0xE0, 0x27, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0xD1, 0x91, 0x40,
+0x90, 0xB0, 0x50, 0x01, 0x70, 0x60, 0xA0, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x22, 0xE2, 0xD0,
+0xE0, 0x41, 0x10, 0x30, 0x00, 0x70, 0x60, 0x00, 0xC0, 0xF1, 0x70, 0x61, 0xA0, 0x72, 0xA0, 0x50,
+0x01, 0x70, 0x80, 0x03, 0xF0, 0xA0, 0x01, 0x70, 0x00, 0x10, 0xC0, 0x81, 0x02, 0x30, 0x52, 0x60,
+0x01, 0x10, 0x90, 0xD1, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0x90, 0xD0, 0x30, 0xF0, 0x04, 0x61, 0xB0,
+0x60, 0xF0, 0x60, 0xB0, 0xD1, 0x92, 0xD3, 0x22, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0xE2, 0xD1, 0x60,
+0x10, 0x80, 0x50, 0x80, 0x10, 0xC1, 0x70, 0x01, 0xC0, 0x80, 0x30, 0x60, 0x80, 0x00, 0xC0, 0x80,
+0x70, 0x08, 0x71, 0x0B, 0x70, 0xC0, 0x50, 0x09, 0x30, 0x80, 0x05, 0x60, 0x50, 0x01, 0x70, 0x50,
+0x0D, 0x50, 0xC0, 0x50, 0x70, 0xC0, 0x00, 0xC0, 0x01, 0x50, 0x03, 0x70, 0x30, 0x01, 0x10, 0xF0,
+0x70, 0xB0, 0xA0, 0x60, 0xA0, 0x60, 0x30, 0xC0, 0x50, 0x80, 0x60, 0x40, 0xD1, 0xE5, 0x20, 0xE1,
+0x20, 0xD0, 0x60, 0x70, 0x50, 0x80, 0xF0, 0x10, 0x30, 0xD0, 0x40, 0x50, 0x10, 0xB0, 0x70, 0xA0,
+0x60, 0x30, 0x40, 0xD0, 0x90, 0xE1, 0xD1, 0xE1, 0xA0, 0xB0, 0x80, 0x90, 0x20, 0xE0, 0xD0, 0x40,
+0x10, 0x60, 0x0F, 0x0A, 0x10, 0x02, 0x30, 0x0F, 0x00, 0x03, 0xF0, 0x31, 0xA0, 0xF0, 0x80, 0x00,
+0xF0, 0x30, 0x80, 0x70, 0xA0, 0xD0, 0xE0, 0x20, 0xE2, 0x23, 0xE1, 0x21, 0xE2, 0x20, 0xE3, 0x20,
+0xE0, 0x25, 0xE1, 0xD1, 0xE0, 0x90, 0x41, 0x91, 0xE3, 0x21, 0xE0, 0x21, 0xE1, 0x90, 0xD0, 0x20,
+0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE3, 0x90, 0x81, 0xC0, 0x01, 0x50,
+0xB0, 0xD0, 0x21, 0xE0, 0x26, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x80, 0x31, 0x10, 0xC0,
+0x01, 0x32, 0x00, 0x30, 0x70, 0x30, 0x80, 0xF2, 0x50, 0x70, 0x00, 0xA0, 0xC0, 0x01, 0x30, 0x10,
+0x50, 0x01, 0xF0, 0x11, 0xF0, 0x10, 0x80, 0xA0, 0x70, 0x00, 0x30, 0x10, 0xA0, 0xC0, 0x01, 0x50,
+0x10, 0xD0, 0xE6, 0xD0, 0x40, 0xD0, 0x10, 0x50, 0x02, 0x30, 0x60, 0x30, 0x92, 0xD2, 0xE0, 0x20,
+0xE0, 0xD0, 0xE2, 0x22, 0xE0, 0x22, 0xE5, 0x40, 0xD0, 0xE1, 0xD1, 0x60, 0x11, 0x80, 0x31, 0x10,
+0x70, 0x00, 0x10, 0x02, 0xC0, 0x10, 0x30, 0x50, 0x00, 0xC0, 0x71, 0x50, 0xC0, 0x05, 0xC0, 0x50,
+0x0C, 0xA0, 0x50, 0x09, 0x30, 0x11, 0x30, 0x06, 0x70, 0x50, 0xC0, 0x0E, 0x70, 0x50, 0x01, 0xA1,
+0xF0, 0x50, 0x00, 0x50, 0x03, 0x80, 0xA1, 0x81, 0x70, 0x81, 0xA0, 0x30, 0xA0, 0x31, 0x60, 0x70,
+0x00, 0xC0, 0x60, 0xB0, 0xD0, 0x22, 0xE0, 0x22, 0xE1, 0x20, 0xD0, 0xB0, 0xA0, 0x80, 0xC1, 0x70,
+0x80, 0x60, 0xA1, 0x80, 0x10, 0xF0, 0xA0, 0x81, 0xA0, 0xB0, 0x10, 0x90, 0xD0, 0x90, 0x41, 0x90,
+0x60, 0xA1, 0xD0, 0xE0, 0x20, 0xD1, 0x10, 0x30, 0x50, 0x0F, 0x09, 0x60, 0x70, 0x80, 0xA0, 0xF0,
+0x0F, 0x00, 0x02, 0x50, 0x80, 0x03, 0xA0, 0x81, 0x00, 0x70, 0x30, 0xB0, 0xD0, 0x22, 0xE0, 0x24,
+0xE1, 0x21, 0xE2, 0x22, 0xE0, 0x21, 0xE3, 0x21, 0xE2, 0x21, 0xE1, 0xD0, 0xE1, 0x90, 0x41, 0x90,
+0xE0, 0xD1, 0xE3, 0x91, 0xE2, 0x23, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x23, 0xE1, 0x22, 0xD0, 0x40,
+0x50, 0xC0, 0x51, 0x80, 0x40, 0xD0, 0xE1, 0x23, 0xE2, 0x21, 0xE2, 0x20, 0xE1, 0xD0, 0x30, 0x50,
+0x60, 0x02, 0xC0, 0x10, 0x00, 0x30, 0xC0, 0x00, 0xA1, 0x01, 0x50, 0xF0, 0x70, 0xC0, 0x70, 0x30,
+0xC0, 0x00, 0x31, 0x70, 0xF0, 0xA0, 0x30, 0xA1, 0x60, 0x30, 0x80, 0xF0, 0x50, 0x60, 0x01, 0x30,
+0x71, 0x50, 0x10, 0x50, 0x60, 0x40, 0xD0, 0x21, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0x80, 0x10, 0xA0,
+0x00, 0x80, 0xF0, 0x40, 0xD2, 0x40, 0xD1, 0x21, 0xE0, 0x20, 0xD2, 0x23, 0xE2, 0x22, 0xE1, 0x20,
+0xE0, 0x40, 0xD0, 0xE1, 0xD0, 0xF0, 0x10, 0x62, 0xA0, 0x70, 0x10, 0x30, 0x70, 0x60, 0x32, 0xA0,
+0xF0, 0x02, 0x50, 0x02, 0x50, 0x70, 0x04, 0x50, 0x0C, 0x71, 0x09, 0xC1, 0x00, 0xA0, 0xC0, 0x04,
+0xC0, 0x50, 0x70, 0x0F, 0x02, 0x50, 0xF0, 0xA0, 0xF0, 0xC0, 0x00, 0x31, 0x04, 0x80, 0x30, 0xC0,
+0x80, 0x00, 0x50, 0x10, 0x50, 0x70, 0x50, 0x70, 0xC0, 0x00, 0xC0, 0xF0, 0xC0, 0x01, 0x10, 0x40,
+0xD0, 0x21, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0x10, 0xA0, 0xC0, 0x03, 0x50, 0xA0, 0xD0, 0xA0,
+0x50, 0x01, 0xA0, 0x50, 0xA1, 0x32, 0xE0, 0xD1, 0x10, 0xA0, 0x60, 0xD0, 0xE2, 0xD0, 0x90, 0x30,
+0x80, 0x0F, 0x09, 0x31, 0x70, 0x00, 0x30, 0x0F, 0x00, 0x02, 0xC0, 0x10, 0x70, 0x02, 0x80, 0xA0,
+0x70, 0x01, 0x80, 0x40, 0xD0, 0x22, 0xE1, 0x23, 0xE1, 0x21, 0xE1, 0x28, 0xE2, 0x27, 0xE3, 0xD0,
+0xE0, 0x91, 0x41, 0x90, 0xE1, 0xD0, 0x40, 0xE4, 0x2F, 0x05, 0xE0, 0x90, 0xA0, 0x02, 0x80, 0x30,
+0x91, 0xE5, 0x20, 0xE1, 0x21, 0xE5, 0xF0, 0x81, 0x02, 0x70, 0x30, 0x00, 0x30, 0xC0, 0x00, 0x30,
+0x70, 0x01, 0x10, 0xF1, 0x70, 0x60, 0x30, 0x50, 0xA0, 0xF0, 0x30, 0x80, 0x60, 0x50, 0xC0, 0x01,
+0x60, 0x30, 0x80, 0x00, 0xA2, 0x01, 0xA0, 0xC0, 0x70, 0xA0, 0xF0, 0x10, 0x40, 0xD0, 0x20, 0xE0,
+0x21, 0xE0, 0x20, 0xE2, 0x90, 0xF0, 0x30, 0x10, 0x30, 0xD1, 0xE2, 0x91, 0xE1, 0x20, 0xE0, 0xD0,
+0xB0, 0x10, 0x90, 0xD3, 0xE1, 0x24, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x40, 0x11, 0x60, 0x01,
+0xA0, 0xC0, 0x00, 0x50, 0x80, 0xA1, 0xF0, 0x70, 0x40, 0x60, 0xA0, 0x00, 0x70, 0xC0, 0x03, 0x70,
+0x50, 0x02, 0x30, 0xC0, 0x0B, 0x50, 0x70, 0x0A, 0x10, 0xC0, 0x00, 0xF0, 0x04, 0x50, 0x70, 0x0F,
+0x04, 0x70, 0x30, 0x80, 0x70, 0xF0, 0xC0, 0x00, 0xA0, 0x05, 0xA0, 0x30, 0x01, 0xC0, 0x70, 0x30,
+0xA0, 0x30, 0x03, 0x30, 0x10, 0x50, 0x01, 0x10, 0xE0, 0x24, 0xE3, 0xD1, 0x10, 0x31, 0x03, 0x60,
+0x90, 0x40, 0x90, 0x30, 0x00, 0x70, 0xA0, 0x80, 0x00, 0x80, 0x10, 0x60, 0x40, 0xE1, 0xD0, 0x31,
+0x60, 0xD0, 0x21, 0xE0, 0x20, 0xD0, 0x40, 0xB0, 0x0F, 0x09, 0x50, 0x30, 0x01, 0x50, 0x70, 0xC0,
+0x80, 0x71, 0x60, 0x80, 0x08, 0x03, 0x70, 0xA0, 0xF0, 0x61, 0x31, 0x50, 0xC0, 0x00, 0xA0, 0xD0,
+0xE5, 0x23, 0xE3, 0x20, 0xE2, 0x2F, 0x02, 0xE7, 0xD0, 0xE0, 0x91, 0x42, 0xE1, 0xD0, 0xE0, 0x22,
+0xE0, 0x2C, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0x10, 0xC0, 0x01, 0x10, 0xD0, 0x90, 0x40,
+0x90, 0xE0, 0xD1, 0xE0, 0x20, 0xE0, 0x26, 0xD0, 0x41, 0x60, 0xA0, 0x02, 0x30, 0xC0, 0x00, 0x51,
+0x00, 0x70, 0x60, 0x00, 0x60, 0x12, 0xF0, 0x60, 0x10, 0x81, 0x30, 0x70, 0x60, 0x70, 0x01, 0xC0,
+0xA0, 0xC0, 0x00, 0x10, 0x50, 0xF0, 0x60, 0xF0, 0x80, 0x01, 0xA0, 0x01, 0x30, 0xF0, 0xD0, 0xE1,
+0x21, 0xE4, 0xD0, 0xE0, 0xA0, 0x10, 0x40, 0xD1, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0xF0,
+0x12, 0x61, 0x90, 0xD0, 0x20, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0xE0, 0xD0, 0x40, 0xA0, 0x10, 0xC0,
+0x01, 0x50, 0x80, 0x01, 0x30, 0xF0, 0x60, 0x80, 0xF0, 0x10, 0xF0, 0x70, 0x00, 0x50, 0x06, 0x50,
+0xC0, 0x50, 0x30, 0xF0, 0x09, 0xC0, 0x50, 0xC0, 0x0A, 0xA0, 0x60, 0x01, 0x80, 0xA0, 0x80, 0xC0,
+0x70, 0x50, 0x0F, 0x06, 0x30, 0x50, 0x01, 0x30, 0x01, 0x80, 0x51, 0x80, 0x70, 0xC0, 0x00, 0x10,
+0xA0, 0x70, 0x50, 0x70, 0xC0, 0xA0, 0xC0, 0x70, 0xA0, 0x60, 0xA0, 0xC0, 0xA0, 0x00, 0x30, 0x70,
+0x00, 0x70, 0xB0, 0xD0, 0x20, 0xE1, 0x20, 0xE4, 0xD0, 0x60, 0xA0, 0x70, 0x30, 0x02, 0x70, 0x30,
+0x41, 0xB0, 0x50, 0xC0, 0x60, 0x30, 0x50, 0x80, 0x11, 0xD0, 0xE1, 0xD0, 0xB0, 0xA1, 0xD0, 0x20,
+0xE3, 0xD0, 0xA0, 0x0F, 0x0A, 0xA0, 0x00, 0xC0, 0x80, 0x30, 0x60, 0x30, 0x61, 0x70, 0xA0, 0x70,
+0x07, 0x03, 0xC0, 0x01, 0xC1, 0x00, 0xA0, 0x50, 0x80, 0x30, 0x60, 0xD0, 0xE9, 0x22, 0xE1, 0x20,
+0xE1, 0x22, 0xE2, 0x2C, 0xE2, 0x21, 0xE4, 0xD1, 0x90, 0x42, 0x91, 0xE6, 0x2A, 0xE1, 0x21, 0xE1,
+0xD0, 0xA0, 0x80, 0x30, 0xC0, 0x50, 0xA0, 0xD1, 0x90, 0xB0, 0x40, 0x90, 0xE4, 0x23, 0xE0, 0x90,
+0x40, 0xD0, 0x30, 0x51, 0x00, 0x50, 0xF0, 0x01, 0x51, 0x01, 0x30, 0xF0, 0x12, 0xF0, 0x60, 0xA0,
+0xF1, 0x60, 0x30, 0xA1, 0x10, 0x60, 0x00, 0xA0, 0x70, 0x00, 0x70, 0x10, 0xF0, 0x40, 0xA0, 0x61,
+0xC0, 0x00, 0x70, 0x30, 0x00, 0x70, 0xB0, 0xE0, 0xD0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0xD1,
+0x41, 0xD0, 0xE1, 0x21, 0xE2, 0x91, 0xD0, 0x20, 0xD0, 0x90, 0x11, 0x52, 0xA0, 0xB0, 0xD0, 0x24,
+0xE3, 0x40, 0xD0, 0xE1, 0xD0, 0x10, 0x60, 0x80, 0x01, 0x70, 0xF0, 0x50, 0x00, 0x70, 0x30, 0xC0,
+0x00, 0x60, 0xF1, 0x00, 0x50, 0xC0, 0x07, 0x50, 0x71, 0x11, 0x07, 0xC0, 0x50, 0xC0, 0x0A, 0x80,
+0x10, 0x04, 0x80, 0x30, 0xC0, 0x0F, 0x01, 0xC0, 0x30, 0x03, 0x81, 0x01, 0x30, 0x01, 0xC0, 0xA1,
+0x30, 0xF0, 0x32, 0x80, 0x03, 0xA0, 0x01, 0xC1, 0x50, 0x30, 0x60, 0x01, 0x30, 0xC0, 0x00, 0xA0,
+0xD0, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0xE0, 0x20, 0xD0, 0xF0, 0xC0, 0x00, 0xA0, 0x00, 0xC0, 0x70,
+0x50, 0xA0, 0x80, 0x50, 0x90, 0xA0, 0x00, 0x60, 0xA0, 0xB0, 0xF1, 0x10, 0xD0, 0xE1, 0xD0, 0xA0,
+0x30, 0xA0, 0xD0, 0xE1, 0x21, 0xE0, 0xD0, 0xB0, 0x50, 0x0F, 0x09, 0x10, 0x30, 0x80, 0x50, 0x10,
+0x80, 0x01, 0x60, 0x00, 0x81, 0x07, 0x02, 0x30, 0xF0, 0x60, 0x30, 0x10, 0x60, 0xC0, 0x80, 0x01,
+0xC0, 0x30, 0xD0, 0xE0, 0x20, 0xE4, 0x21, 0xE1, 0x25, 0xED, 0x24, 0xE6, 0x23, 0xE0, 0xD0, 0x40,
+0xE0, 0xD0, 0xE1, 0x90, 0x41, 0x90, 0xE0, 0xD1, 0xE3, 0x20, 0xE3, 0x21, 0xE0, 0x23, 0xE1, 0xD0,
+0xA0, 0x30, 0x50, 0xC0, 0x00, 0x10, 0x30, 0x70, 0xA0, 0x30, 0xA0, 0x90, 0x41, 0x90, 0xD2, 0xE0,
+0x21, 0xE0, 0x90, 0xD0, 0xB0, 0x50, 0x00, 0x11, 0x60, 0xF0, 0x10, 0x30, 0x60, 0x01, 0xC0, 0x60,
+0x10, 0x60, 0xB0, 0x40, 0xD2, 0x90, 0xA0, 0xF0, 0x10, 0x50, 0x90, 0x40, 0x30, 0x11, 0x70, 0x00,
+0xF0, 0xA0, 0xC0, 0xD0, 0x40, 0xB0, 0xD0, 0xA0, 0x10, 0x61, 0x80, 0x10, 0xB0, 0x40, 0x90, 0xE1,
+0x24, 0xE1, 0x40, 0x90, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE3, 0x10, 0x80, 0x02,
+0x30, 0x60, 0xD0, 0xE3, 0x20, 0xE3, 0x40, 0xD0, 0x20, 0xD0, 0xB0, 0x10, 0x31, 0xA0, 0x00, 0x10,
+0x30, 0x10, 0x00, 0xC0, 0x30, 0x70, 0x00, 0xA0, 0x30, 0x00, 0xC0, 0x50, 0x09, 0x50, 0x70, 0x50,
+0x30, 0x06, 0xC0, 0x50, 0x04, 0x10, 0xC0, 0x04, 0xC0, 0x10, 0x70, 0x02, 0x51, 0xC0, 0xA0, 0x70,
+0x0F, 0x07, 0x50, 0x80, 0x70, 0x00, 0x60, 0x02, 0xC0, 0x60, 0xC0, 0x70, 0x50, 0x70, 0xC0, 0x60,
+0x80, 0x60, 0xC1, 0xF0, 0x04, 0x80, 0x10, 0x80, 0x00, 0x80, 0x70, 0x00, 0xA0, 0xD0, 0xE1, 0x22,
+0xE0, 0x20, 0xE1, 0xD0, 0xB0, 0x50, 0x70, 0x30, 0x80, 0x70, 0xC0, 0x00, 0x70, 0xF0, 0x90, 0xD0,
+0xA0, 0xC0, 0x00, 0xA0, 0x70, 0x40, 0xF0, 0x40, 0xD0, 0xE1, 0xD0, 0x10, 0x30, 0xA0, 0xD0, 0xE1,
+0x23, 0x40, 0x80, 0x0F, 0x09, 0xF0, 0x02, 0xA1, 0x00, 0x70, 0x10, 0xF1, 0x08, 0x01, 0xC0, 0xA0,
+0x00, 0x80, 0x30, 0x00, 0x50, 0x60, 0x80, 0xC0, 0x00, 0x50, 0xB0, 0xD0, 0xE0, 0x2D, 0xE0, 0x26,
+0xE8, 0x22, 0xE4, 0x27, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0xD3, 0x90, 0x42, 0x90, 0xE0, 0xD2, 0xE5,
+0x20, 0xE2, 0x21, 0xE0, 0xD0, 0x30, 0x70, 0xC0, 0x01, 0x80, 0x60, 0xA0, 0x70, 0x00, 0x70, 0xA0,
+0xD1, 0x90, 0x41, 0x90, 0xD0, 0xE0, 0xD0, 0xE0, 0x40, 0x50, 0xF0, 0x00, 0xF0, 0x60, 0xD3, 0x90,
+0xB0, 0xF0, 0x12, 0x60, 0xD2, 0x20, 0xE1, 0xD1, 0xB0, 0xF0, 0xD2, 0x90, 0x40, 0xA0, 0x12, 0x30,
+0xD0, 0xB0, 0xD2, 0xC0, 0x50, 0x30, 0x60, 0x10, 0x30, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x23, 0xD0,
+0x40, 0x90, 0xD0, 0xE4, 0x22, 0xE1, 0x90, 0x40, 0xE1, 0xD0, 0x40, 0x10, 0xC0, 0x80, 0x30, 0x10,
+0x40, 0xD0, 0xE2, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0xD0, 0x60, 0x10, 0x50, 0x02, 0x60, 0x70, 0x30,
+0x70, 0x60, 0xF0, 0xA0, 0xC0, 0xA0, 0x10, 0x81, 0x0B, 0x70, 0x80, 0x30, 0x05, 0x70, 0x50, 0x05,
+0x80, 0xC0, 0x04, 0x70, 0x10, 0x70, 0x01, 0x50, 0x30, 0xC1, 0x51, 0x0F, 0x03, 0x10, 0x02, 0x52,
+0x00, 0x70, 0x60, 0x00, 0x70, 0x51, 0xC0, 0x03, 0x60, 0xA0, 0x80, 0xA0, 0x30, 0x71, 0x50, 0x02,
+0xF0, 0xC1, 0x30, 0x80, 0x70, 0x00, 0xA0, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0x20, 0x90, 0x41,
+0x30, 0x00, 0xC0, 0x60, 0x03, 0x81, 0xD1, 0xA0, 0x00, 0xC0, 0x60, 0xD2, 0x21, 0xD1, 0x10, 0xB0,
+0x60, 0xD0, 0xE1, 0x23, 0x90, 0x30, 0x0F, 0x09, 0x30, 0xC0, 0x00, 0xC0, 0x31, 0xF0, 0x60, 0x00,
+0x70, 0xC0, 0x08, 0x02, 0xF0, 0x50, 0x60, 0x50, 0x00, 0x70, 0xF0, 0x12, 0xF0, 0x40, 0xD0, 0xE3,
+0x27, 0xE2, 0x2A, 0xEB, 0x25, 0xE4, 0x40, 0xD0, 0xE1, 0x21, 0xE3, 0xD0, 0xE0, 0x91, 0x41, 0x90,
+0xE0, 0xD1, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xD0, 0x30, 0xA0, 0x50, 0x00, 0x70, 0x05, 0xB0,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0x92, 0xB0, 0x10, 0x01, 0x60, 0xE0, 0xD1, 0xE2, 0xD1,
+0xB0, 0xF0, 0x10, 0x90, 0xD1, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x20, 0xD0, 0xE2, 0xD0, 0xF0, 0x80,
+0x30, 0x11, 0xF0, 0x80, 0x60, 0xD0, 0x40, 0xA0, 0x10, 0xA1, 0x10, 0x30, 0xD1, 0xE0, 0xD0, 0x91,
+0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE3, 0x24, 0xD0, 0x91, 0xE0, 0xD1, 0x90, 0x60, 0xB0,
+0x40, 0xD1, 0xE0, 0xD0, 0xE2, 0x22, 0xE1, 0x40, 0xD1, 0x40, 0x10, 0x80, 0x60, 0x02, 0xA0, 0x30,
+0x50, 0x00, 0x60, 0xA0, 0x10, 0xA0, 0x00, 0x11, 0x70, 0x51, 0x0A, 0x70, 0x50, 0x04, 0x50, 0x70,
+0x0E, 0x60, 0x10, 0x70, 0x50, 0x01, 0xA1, 0x50, 0x70, 0x0F, 0x00, 0x50, 0x60, 0x00, 0xA0, 0x03,
+0xA0, 0x70, 0xC0, 0x00, 0x30, 0x80, 0x70, 0x06, 0xA0, 0x02, 0xF0, 0x80, 0xC0, 0x50, 0x01, 0xC0,
+0x30, 0x02, 0x50, 0x80, 0x70, 0xF0, 0xD1, 0xE0, 0xD0, 0x92, 0x41, 0x90, 0xE0, 0xD0, 0xA0, 0x01,
+0xA0, 0xC0, 0x02, 0x50, 0xB0, 0xD1, 0xA0, 0xF0, 0xB0, 0x50, 0xB0, 0xD0, 0xE0, 0x20, 0xE0, 0xD0,
+0xB0, 0x10, 0xB0, 0x60, 0xE1, 0x21, 0xE2, 0xD0, 0xA0, 0x0F, 0x09, 0x80, 0x13, 0xC0, 0x50, 0x61,
+0xA1, 0x60, 0x07, 0x02, 0xC0, 0x30, 0x50, 0x60, 0x30, 0x60, 0x30, 0x81, 0xA0, 0xF0, 0x43, 0x90,
+0xEC, 0x2D, 0xE7, 0x26, 0xE2, 0x91, 0xE2, 0x25, 0xE1, 0xD0, 0xE2, 0x90, 0x41, 0x90, 0xE1, 0xD0,
+0xE3, 0x20, 0xE1, 0xD0, 0xF0, 0x30, 0x50, 0x70, 0x10, 0xA0, 0x04, 0xC0, 0x60, 0xD0, 0x21, 0xE2,
+0x91, 0x80, 0xA0, 0x50, 0x00, 0x30, 0xB0, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0xD2, 0xE0, 0xD0,
+0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0xF0, 0x61, 0xA0, 0x30, 0x10, 0x60,
+0xA0, 0x40, 0x60, 0xA0, 0x10, 0xF0, 0x10, 0x50, 0xD0, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE1,
+0x40, 0x90, 0xE1, 0x23, 0xE1, 0x24, 0xE1, 0x40, 0xD0, 0xE2, 0xD2, 0x21, 0xE1, 0xD0, 0xE0, 0x23,
+0xE1, 0x40, 0xD0, 0xE0, 0x60, 0x10, 0x60, 0xA0, 0x30, 0x00, 0xA0, 0x30, 0xF0, 0x00, 0x30, 0x12,
+0x30, 0x00, 0x70, 0x61, 0x00, 0x60, 0x0B, 0x71, 0x02, 0x50, 0xC0, 0x0F, 0x00, 0x70, 0x80, 0xC0,
+0x02, 0x10, 0x70, 0x51, 0x0F, 0x00, 0xC0, 0x70, 0x02, 0x60, 0x70, 0x50, 0xA0, 0x70, 0x80, 0x70,
+0xC0, 0xA0, 0x07, 0x30, 0x70, 0x01, 0x70, 0x50, 0x03, 0x30, 0xC0, 0x02, 0x50, 0xA0, 0x61, 0xD0,
+0xE0, 0x90, 0x40, 0x92, 0xE2, 0x20, 0xD0, 0xA0, 0xC0, 0x00, 0x80, 0x70, 0x02, 0x80, 0xA0, 0xE0,
+0xD0, 0x90, 0x30, 0xB0, 0x40, 0xA0, 0x90, 0xD0, 0xE1, 0xD0, 0x60, 0xA0, 0xB1, 0x40, 0xE0, 0x21,
+0xE2, 0xD0, 0x30, 0x50, 0x0F, 0x03, 0xC0, 0x70, 0x51, 0x70, 0x50, 0x10, 0xA0, 0x81, 0x30, 0xA0,
+0x70, 0x02, 0x30, 0x50, 0x06, 0x01, 0x70, 0xF0, 0xA0, 0x00, 0xC0, 0x80, 0x00, 0x80, 0x02, 0xA0,
+0xD0, 0xE2, 0x91, 0x43, 0x90, 0xE1, 0xD4, 0xE0, 0x2E, 0xE6, 0x24, 0xE0, 0x20, 0xE1, 0x90, 0xE2,
+0x22, 0xE0, 0x25, 0xE5, 0x91, 0x41, 0x90, 0xE0, 0xD1, 0xE2, 0xD0, 0x10, 0x30, 0xA0, 0x80, 0xC0,
+0x80, 0xC0, 0x03, 0xC0, 0xF0, 0xD0, 0x23, 0xE1, 0xD0, 0x30, 0x60, 0xC0, 0x50, 0xF0, 0xE0, 0xD0,
+0xE1, 0x21, 0xE0, 0x21, 0xE3, 0x20, 0xE0, 0x24, 0xE4, 0x21, 0xD1, 0x90, 0xA2, 0x10, 0xB0, 0xD0,
+0x60, 0xC0, 0x00, 0x70, 0x10, 0x30, 0xD0, 0x22, 0xE3, 0x40, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x22,
+0xE0, 0x25, 0xE0, 0x20, 0xD0, 0x91, 0xE2, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x23, 0xE1, 0x40,
+0xD0, 0x11, 0xA1, 0x10, 0x00, 0x80, 0xF0, 0x80, 0x50, 0x70, 0x60, 0x13, 0x30, 0x80, 0x50, 0xC0,
+0x80, 0x50, 0x10, 0x08, 0xC0, 0x30, 0x00, 0x71, 0x00, 0x50, 0x0F, 0x00, 0xC0, 0x50, 0x70, 0x04,
+0x70, 0x00, 0xA0, 0x0F, 0x06, 0x70, 0x80, 0xA0, 0x50, 0x30, 0x70, 0x01, 0x70, 0x80, 0x06, 0xA0,
+0x08, 0xA0, 0x00, 0x60, 0x10, 0x30, 0x00, 0x30, 0x80, 0xA0, 0x40, 0x90, 0x21, 0xE1, 0xD0, 0xE1,
+0x20, 0xE0, 0xD0, 0xA0, 0xC0, 0x00, 0x30, 0x04, 0x60, 0xE1, 0xD2, 0xA0, 0x70, 0xF0, 0x90, 0xD0,
+0xE0, 0x90, 0x10, 0x31, 0x40, 0xB0, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0x10, 0x80, 0x0C, 0x70, 0x53,
+0x70, 0xC0, 0x03, 0xA0, 0x02, 0x60, 0x50, 0x03, 0x60, 0x70, 0x06, 0x01, 0x60, 0x00, 0x50, 0xF0,
+0x01, 0x61, 0x70, 0x01, 0xA0, 0xD0, 0xE3, 0xD2, 0xE1, 0x91, 0x42, 0x91, 0xE0, 0xD0, 0xE9, 0x28,
+0xE2, 0x20, 0xE0, 0x24, 0xE1, 0x40, 0xD0, 0xE1, 0x2A, 0xE0, 0x22, 0xE2, 0xD1, 0x90, 0x42, 0x90,
+0xE0, 0xD0, 0xB1, 0x00, 0x70, 0x10, 0x00, 0x70, 0x10, 0x80, 0x70, 0xF0, 0x10, 0xF0, 0xD3, 0x21,
+0xE0, 0xD0, 0x90, 0xA0, 0x80, 0xA0, 0x10, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE3, 0x20, 0xE0, 0x21,
+0xE0, 0x26, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0xD2, 0x42, 0xD1, 0xF0, 0x80, 0x00, 0x30, 0xF0, 0xD0,
+0x22, 0xE4, 0xB0, 0x90, 0xD0, 0xE2, 0x25, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0xE2, 0x24,
+0xE0, 0x20, 0xF0, 0xD0, 0x23, 0xE1, 0x40, 0xF0, 0x10, 0x00, 0x50, 0x80, 0xC0, 0x00, 0xA0, 0x50,
+0xD0, 0x31, 0x11, 0xA0, 0x10, 0x30, 0x80, 0x30, 0x02, 0xA0, 0x30, 0x02, 0xA0, 0x03, 0xC0, 0x60,
+0xA0, 0x01, 0x50, 0x80, 0x02, 0x10, 0x70, 0x0A, 0x51, 0x08, 0xA0, 0x0F, 0x01, 0x30, 0x01, 0x70,
+0x51, 0x30, 0x00, 0x80, 0x70, 0xC0, 0x50, 0x00, 0x50, 0x30, 0x06, 0xA0, 0x08, 0x70, 0x80, 0x00,
+0x71, 0x50, 0x30, 0x00, 0x10, 0xB0, 0xE1, 0x20, 0xE2, 0x22, 0xE0, 0xD0, 0xA0, 0x00, 0xC0, 0x60,
+0x04, 0xA0, 0xB0, 0xD0, 0xE1, 0xD0, 0x40, 0xF0, 0xA0, 0x60, 0xD2, 0x60, 0x80, 0x30, 0x90, 0xB0,
+0xD0, 0x22, 0xE2, 0xD0, 0xA0, 0x30, 0x05, 0xC0, 0x71, 0x52, 0x70, 0xC0, 0x09, 0x60, 0x01, 0x70,
+0x61, 0xA1, 0xF0, 0x10, 0x50, 0x07, 0x00, 0xC0, 0xA0, 0x01, 0x81, 0xC0, 0xA0, 0x30, 0x50, 0x30,
+0x60, 0x30, 0xD0, 0xEE, 0x91, 0x42, 0x91, 0xE1, 0xD0, 0xE4, 0x2F, 0x02, 0xE0, 0x40, 0xD0, 0xE1,
+0x20, 0xE0, 0x20, 0xE2, 0x24, 0xE3, 0x24, 0xE3, 0x90, 0x41, 0xB0, 0x50, 0x02, 0xC0, 0x30, 0x50,
+0x11, 0xB0, 0xD0, 0xE0, 0xD0, 0xE0, 0x60, 0x30, 0x40, 0xD0, 0xE0, 0xD0, 0x90, 0xA0, 0x00, 0xA1,
+0xD0, 0xE1, 0x90, 0x41, 0x90, 0xE2, 0x2A, 0xE3, 0x21, 0xE5, 0xD1, 0x90, 0x41, 0x11, 0x80, 0x10,
+0xB0, 0xD0, 0x20, 0xE5, 0x90, 0x40, 0xD0, 0xE3, 0x25, 0xE4, 0x21, 0xE1, 0x90, 0xD0, 0xE2, 0x20,
+0xE3, 0x60, 0xD0, 0x21, 0xE2, 0xD0, 0xA0, 0x10, 0x80, 0x70, 0x00, 0x60, 0x70, 0x00, 0x30, 0x70,
+0xD0, 0x30, 0xC0, 0xA0, 0x80, 0xF0, 0x60, 0x10, 0x30, 0x70, 0x02, 0x30, 0x10, 0x80, 0x00, 0xC0,
+0x10, 0x70, 0x02, 0x80, 0xF0, 0x03, 0x50, 0xC0, 0x0C, 0x70, 0x50, 0xC0, 0x08, 0x80, 0x60, 0x0F,
+0x01, 0x10, 0x70, 0x50, 0x70, 0x00, 0x70, 0x30, 0x00, 0x60, 0x01, 0xA0, 0x80, 0x70, 0xA0, 0x06,
+0xC0, 0x60, 0x05, 0xC0, 0x71, 0x30, 0x80, 0x02, 0x30, 0x50, 0x70, 0xB0, 0x40, 0xE0, 0x24, 0xE2,
+0xD0, 0xA0, 0x00, 0xA0, 0x50, 0x05, 0x30, 0xD0, 0xE1, 0x20, 0xD0, 0xA0, 0x90, 0xE0, 0x60, 0x40,
+0xD0, 0xF0, 0x40, 0x50, 0x10, 0x40, 0xD0, 0x21, 0xE2, 0xD0, 0x70, 0xF0, 0x50, 0x00, 0xC0, 0x71,
+0x51, 0x70, 0xC1, 0x0E, 0x61, 0x30, 0x50, 0xA0, 0x00, 0x51, 0xC0, 0x01, 0xC0, 0x06, 0x01, 0xA0,
+0x80, 0x01, 0x60, 0x31, 0x50, 0x01, 0x50, 0x80, 0xD0, 0x20, 0xE2, 0x27, 0xE4, 0xD0, 0xE1, 0x92,
+0x41, 0x91, 0x20, 0xE5, 0x20, 0xE3, 0x27, 0xE0, 0x20, 0x40, 0xE2, 0x20, 0xE3, 0x24, 0xE5, 0x24,
+0xE2, 0xD1, 0xE0, 0xB0, 0x52, 0x70, 0xA0, 0x70, 0x60, 0xA0, 0xE0, 0xD1, 0xE0, 0x20, 0xD0, 0xA0,
+0x60, 0xA0, 0x40, 0xD0, 0x90, 0xA1, 0x50, 0x30, 0xD0, 0xE3, 0xD0, 0x91, 0x40, 0x90, 0x20, 0xE4,
+0x24, 0xE4, 0x21, 0xE2, 0x23, 0xE0, 0xD0, 0xE0, 0x90, 0xB0, 0x60, 0x11, 0x90, 0xE1, 0x20, 0xE0,
+0x20, 0xE2, 0x40, 0xE5, 0x25, 0xE4, 0x22, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE1,
+0x20, 0xE1, 0xD0, 0x90, 0xD0, 0xE1, 0x60, 0x10, 0x80, 0xC0, 0x50, 0xA0, 0x80, 0x51, 0x60, 0x40,
+0xB0, 0xF0, 0xA0, 0xF0, 0xA1, 0x30, 0x70, 0x04, 0x70, 0x02, 0xC1, 0x03, 0x10, 0x60, 0x03, 0x50,
+0x0A, 0xC0, 0x50, 0xC0, 0x0A, 0x60, 0xC0, 0x0E, 0x70, 0x81, 0x03, 0x60, 0xF0, 0x30, 0x50, 0x00,
+0x50, 0x30, 0x60, 0x70, 0x50, 0x80, 0x06, 0xA1, 0x81, 0x71, 0x51, 0xC0, 0x00, 0xC0, 0xA0, 0x60,
+0x50, 0x80, 0xF1, 0x50, 0xB0, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0xF0, 0xC0, 0xA0,
+0x06, 0x80, 0x30, 0xD0, 0xE1, 0x20, 0xD2, 0x40, 0xE0, 0x90, 0x10, 0xD1, 0x10, 0x40, 0xD0, 0xE0,
+0xD0, 0x20, 0xE1, 0x40, 0x80, 0xA0, 0x50, 0x71, 0xC1, 0x0F, 0x04, 0x30, 0x70, 0x01, 0x30, 0xC0,
+0x03, 0x31, 0xC0, 0x05, 0x02, 0x70, 0x01, 0x70, 0x10, 0x30, 0x70, 0x01, 0x80, 0x90, 0xD0, 0x25,
+0xE5, 0x22, 0xE1, 0x20, 0xE4, 0xD1, 0xE0, 0x91, 0x42, 0x91, 0xE1, 0xD2, 0xE3, 0x23, 0xE0, 0xD0,
+0x91, 0xE9, 0x24, 0xE7, 0x21, 0xE4, 0x90, 0x30, 0x01, 0x10, 0x60, 0x30, 0xA0, 0x40, 0xD1, 0xE0,
+0xD1, 0xE0, 0xD0, 0xB0, 0xA0, 0x60, 0x90, 0xE0, 0xB0, 0x10, 0xB0, 0xD0, 0xF0, 0xD0, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0xD1, 0x90, 0x41, 0x90, 0xD1, 0xE1, 0x25, 0xE0, 0x23, 0xE1, 0x23, 0xE4, 0xD0,
+0xB0, 0x60, 0xB0, 0xD1, 0xE1, 0x22, 0xD0, 0x40, 0xE1, 0x20, 0xE3, 0x24, 0xE5, 0x21, 0xE2, 0x40,
+0xD0, 0xE0, 0x23, 0xE3, 0xD0, 0x61, 0xD0, 0xE1, 0xA0, 0x10, 0xC0, 0x00, 0xA0, 0x80, 0x01, 0x80,
+0x60, 0xF0, 0x41, 0xA0, 0xF0, 0x50, 0x60, 0x50, 0x00, 0x60, 0x50, 0x0C, 0x80, 0x10, 0x80, 0x03,
+0x50, 0x08, 0x50, 0x70, 0x0C, 0xA0, 0x0C, 0x70, 0x50, 0x70, 0xC0, 0x04, 0xC0, 0x10, 0xA0, 0x30,
+0x10, 0x60, 0x30, 0xC0, 0x30, 0x10, 0x60, 0xF0, 0x50, 0x06, 0x70, 0x51, 0xA0, 0x03, 0x80, 0x50,
+0x60, 0x12, 0xF0, 0x50, 0x60, 0xA0, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x22, 0xD0, 0xA0,
+0x50, 0x80, 0xC0, 0x05, 0x70, 0x10, 0xD1, 0xE1, 0x21, 0xE0, 0xD1, 0xA0, 0xF0, 0xD1, 0x60, 0xB0,
+0xE0, 0x43, 0xA0, 0x80, 0x31, 0x0F, 0x09, 0x51, 0x01, 0x50, 0x70, 0x02, 0xC0, 0x30, 0x80, 0x70,
+0x05, 0x07, 0x80, 0xA0, 0x30, 0x80, 0xA0, 0x90, 0xD0, 0x25, 0xE6, 0x27, 0xE4, 0xD4, 0xE0, 0x90,
+0x43, 0x91, 0xE3, 0xD2, 0xE1, 0x90, 0x20, 0xE0, 0x22, 0xE5, 0x20, 0xE0, 0x23, 0xE8, 0x24, 0xD0,
+0xF0, 0x60, 0xF0, 0x30, 0xF0, 0x70, 0xD0, 0x90, 0x41, 0x91, 0xE0, 0xD0, 0x40, 0x10, 0x30, 0xF0,
+0xA0, 0x40, 0xD3, 0xA0, 0xF0, 0xE0, 0x21, 0xE4, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE2, 0x21, 0xE0,
+0x21, 0xE1, 0x21, 0xE0, 0x24, 0xE1, 0x22, 0xE1, 0x40, 0x91, 0xE3, 0x20, 0xD0, 0x40, 0x90, 0xE0,
+0x22, 0xE1, 0x24, 0xE5, 0x23, 0xE0, 0xD0, 0x91, 0xE0, 0x23, 0xE0, 0xD3, 0xB0, 0x40, 0xD0, 0x20,
+0xD0, 0xA0, 0x60, 0x01, 0x10, 0xA0, 0x50, 0xC0, 0xF0, 0x10, 0x60, 0x70, 0x40, 0x10, 0x30, 0x00,
+0x50, 0x60, 0x0F, 0x01, 0x80, 0x04, 0x70, 0xC0, 0x05, 0x70, 0x30, 0x0E, 0x50, 0x61, 0x50, 0x03,
+0x70, 0x01, 0xC0, 0x51, 0x70, 0x00, 0xF0, 0xC0, 0x03, 0x70, 0x10, 0x00, 0x80, 0x10, 0x70, 0xC0,
+0x01, 0x30, 0x10, 0xF0, 0xA0, 0x80, 0x02, 0x70, 0x51, 0x70, 0x60, 0x10, 0x80, 0x70, 0x80, 0x01,
+0x80, 0xF1, 0xD5, 0x40, 0xB0, 0xD0, 0xE0, 0x20, 0xE3, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x11, 0x07,
+0x61, 0xD0, 0xE4, 0xD0, 0x40, 0xB1, 0x41, 0xB1, 0x90, 0xE1, 0xD1, 0xF0, 0xC0, 0x00, 0x10, 0x0F,
+0x09, 0x70, 0x60, 0x80, 0x30, 0x60, 0x50, 0x03, 0x71, 0x06, 0x07, 0x30, 0xC0, 0x00, 0xC0, 0xA0,
+0xE0, 0xD0, 0x2E, 0xE1, 0x22, 0xE0, 0x21, 0xE2, 0x21, 0xE7, 0x20, 0x91, 0x42, 0x92, 0xE0, 0xD1,
+0x40, 0xD0, 0xE2, 0x23, 0xE5, 0x27, 0xE2, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0xA0, 0x80, 0x70,
+0x00, 0x80, 0xB0, 0x90, 0xD0, 0xE2, 0x90, 0x43, 0x30, 0x80, 0xA0, 0x80, 0xD1, 0xE1, 0x90, 0xF0,
+0xE0, 0x21, 0xE0, 0x22, 0xE2, 0xD1, 0xE0, 0x90, 0x40, 0x90, 0xE3, 0x24, 0xE1, 0x23, 0xE3, 0x22,
+0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0x28, 0xE5, 0x23, 0xE4,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xB1, 0xF0, 0xE0, 0xD0, 0x20, 0xE1, 0xA1, 0x00, 0x80,
+0x12, 0xF0, 0x30, 0x10, 0xD1, 0x40, 0x10, 0xA0, 0x51, 0x0F, 0x02, 0x60, 0x50, 0x04, 0x50, 0x03,
+0x71, 0x30, 0x10, 0xC0, 0x0A, 0x70, 0x01, 0xC0, 0x80, 0xC0, 0xA0, 0x60, 0x30, 0x50, 0x30, 0x80,
+0x70, 0x30, 0x70, 0x05, 0xC0, 0x71, 0x61, 0x70, 0x00, 0xA0, 0x80, 0x60, 0x80, 0x00, 0xA0, 0x60,
+0x11, 0xA0, 0xF0, 0x50, 0x31, 0x50, 0x02, 0x70, 0x60, 0x30, 0xA1, 0x52, 0x30, 0xD0, 0xE0, 0xD0,
+0xE1, 0xD0, 0xE0, 0xD1, 0xE0, 0x20, 0xE4, 0xF0, 0x90, 0xE0, 0xD0, 0x30, 0x60, 0x80, 0x07, 0x60,
+0x40, 0xD0, 0xE0, 0x92, 0x41, 0xB1, 0x40, 0xE0, 0xD0, 0xB1, 0xD0, 0xE1, 0x20, 0xD0, 0x10, 0xC0,
+0x00, 0x30, 0x50, 0x60, 0x0F, 0x07, 0x70, 0xF0, 0xC0, 0x00, 0x70, 0x80, 0x0C, 0x07, 0x30, 0x02,
+0xA0, 0xD0, 0xE0, 0x2F, 0x01, 0xE4, 0x21, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x23, 0xE2, 0xD1, 0xE0,
+0x92, 0x43, 0xE2, 0xD0, 0xE3, 0x20, 0xE6, 0x27, 0xE0, 0x21, 0xE0, 0x22, 0xD0, 0xA0, 0x80, 0x70,
+0x01, 0xF0, 0x60, 0xE1, 0x20, 0xE0, 0xD1, 0xE0, 0x91, 0xB0, 0x30, 0x80, 0x40, 0xD0, 0x90, 0xF0,
+0xB1, 0x40, 0xD0, 0x20, 0xE1, 0x24, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE1, 0x20,
+0xE4, 0x23, 0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE2, 0x90, 0x40, 0x90, 0xE0, 0x40, 0xE1, 0x21,
+0xE1, 0x22, 0xE5, 0x26, 0xE3, 0x91, 0xE2, 0xD0, 0x90, 0x11, 0x60, 0xA0, 0xD0, 0xE1, 0x20, 0xE0,
+0xB0, 0xF0, 0x80, 0xA0, 0x50, 0x10, 0x80, 0x60, 0x50, 0xA1, 0x40, 0x50, 0x61, 0x30, 0xC0, 0x0F,
+0x01, 0x70, 0x30, 0x05, 0xC0, 0x50, 0x00, 0xC0, 0x50, 0xC0, 0x00, 0x11, 0xF0, 0x30, 0x06, 0x70,
+0x50, 0xC0, 0xA0, 0x03, 0x70, 0x10, 0x30, 0x70, 0xA0, 0x80, 0x70, 0x00, 0x31, 0xA0, 0x02, 0x71,
+0x30, 0x10, 0xA0, 0x70, 0x01, 0x30, 0x80, 0x00, 0xC0, 0x60, 0xA0, 0x80, 0x50, 0xA0, 0x30, 0x50,
+0x30, 0xF0, 0x12, 0xA0, 0xC0, 0x00, 0x80, 0x60, 0xC0, 0x40, 0x10, 0x30, 0x80, 0x30, 0xB0, 0x80,
+0xD0, 0xE1, 0x25, 0xE1, 0x20, 0xE1, 0xD0, 0xA0, 0x90, 0xD0, 0xB0, 0xF0, 0x30, 0x80, 0x06, 0x70,
+0x30, 0x41, 0x93, 0xE0, 0xD0, 0x30, 0xF0, 0xD1, 0xB0, 0x90, 0x21, 0xE0, 0x21, 0xD0, 0x10, 0xC0,
+0x01, 0x70, 0xF0, 0x0F, 0x08, 0x60, 0x01, 0xC0, 0x80, 0x0C, 0x07, 0xA0, 0x02, 0x60, 0xD0, 0x2C,
+0xE4, 0x27, 0xE0, 0x21, 0xE1, 0x21, 0xE2, 0x21, 0xE7, 0xD1, 0xE0, 0x40, 0x91, 0x42, 0x91, 0xE0,
+0xD2, 0xE0, 0xD0, 0xE0, 0x2A, 0xE0, 0x23, 0xE0, 0xD0, 0xA0, 0x60, 0xA0, 0x01, 0x80, 0x60, 0xE2,
+0x21, 0xE0, 0x20, 0xE0, 0xD1, 0xA0, 0x80, 0xB0, 0xD0, 0x40, 0x10, 0xB0, 0x60, 0xD0, 0xE2, 0x20,
+0xE0, 0x20, 0xE1, 0x24, 0xE0, 0xD0, 0xE2, 0x90, 0x41, 0x90, 0xE5, 0x20, 0xE0, 0x26, 0xE0, 0x23,
+0xD1, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE3, 0x2A, 0xE0, 0x20, 0xD0,
+0x40, 0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0x10, 0x60, 0x10, 0x30, 0xB0, 0xD0, 0xE0, 0x20, 0xE0, 0x90,
+0xB0, 0x30, 0x70, 0x60, 0xF0, 0x00, 0xC0, 0x00, 0x11, 0x40, 0x30, 0xC0, 0x70, 0x50, 0x0F, 0x02,
+0x30, 0x80, 0x06, 0x70, 0x50, 0x70, 0x02, 0x10, 0xB0, 0x50, 0xF0, 0x06, 0x71, 0x02, 0x70, 0xA0,
+0x00, 0x30, 0x60, 0x50, 0x70, 0xC0, 0x03, 0xC0, 0x60, 0x01, 0xC0, 0x10, 0x30, 0x03, 0x30, 0x10,
+0x50, 0x02, 0x70, 0x80, 0x60, 0xC0, 0x61, 0xD4, 0xB0, 0x40, 0x60, 0xC0, 0x00, 0x60, 0xD2, 0xF1,
+0x80, 0xA0, 0xF0, 0xD0, 0xE0, 0x24, 0xE0, 0x26, 0xD2, 0x40, 0x30, 0x70, 0x01, 0xC0, 0x70, 0x52,
+0x80, 0x60, 0xA0, 0xD1, 0xE2, 0xD0, 0xE0, 0xD0, 0x10, 0xB1, 0x40, 0xB0, 0x90, 0x21, 0xE2, 0xD0,
+0xF0, 0x70, 0x02, 0xF0, 0x70, 0x0F, 0x07, 0xA0, 0x01, 0xC0, 0xA0, 0x0C, 0x07, 0xF0, 0x30, 0xA1,
+0x30, 0xD0, 0xE0, 0x21, 0xE9, 0x23, 0xE0, 0x25, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x20, 0xE4, 0x26,
+0xE1, 0x91, 0xD0, 0xE0, 0xD1, 0xE0, 0x91, 0x43, 0x90, 0xE9, 0x21, 0xE0, 0x25, 0xD1, 0x10, 0x50,
+0x02, 0xA0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x21, 0xD0, 0xB0, 0x30, 0xF0, 0xD0, 0xB1,
+0xD0, 0x10, 0xD0, 0xE3, 0x21, 0xE1, 0x26, 0xE3, 0xD0, 0xE0, 0x90, 0x40, 0x91, 0xE0, 0xD1, 0xE2,
+0x24, 0xE2, 0x21, 0xE0, 0x20, 0xE2, 0x41, 0x90, 0xE4, 0x21, 0xE4, 0x2B, 0xE2, 0x40, 0xD0, 0xE0,
+0xD1, 0xF0, 0x10, 0x00, 0x30, 0x40, 0xD0, 0x20, 0xE1, 0x40, 0xD0, 0x40, 0x11, 0x50, 0xF0, 0x30,
+0x50, 0x10, 0xD1, 0x81, 0x50, 0x0F, 0x03, 0x70, 0x10, 0x70, 0x04, 0x71, 0x50, 0x03, 0xA0, 0xB0,
+0x70, 0x10, 0xC0, 0x0A, 0x80, 0x30, 0xA1, 0xC0, 0x07, 0x30, 0x61, 0xA0, 0xF0, 0x03, 0x60, 0x50,
+0x07, 0xA0, 0x60, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0xD1, 0x90, 0xA0, 0x61, 0xD0, 0x20, 0xE0, 0xD0,
+0x40, 0x10, 0x70, 0x60, 0x40, 0xD0, 0x24, 0xE3, 0x20, 0xE1, 0xD1, 0xE0, 0x90, 0x40, 0xA0, 0x70,
+0x51, 0x70, 0xC0, 0x01, 0xC0, 0x10, 0x80, 0xB0, 0xE2, 0x20, 0xE1, 0xD0, 0x60, 0xF0, 0x31, 0xA0,
+0xD0, 0xE0, 0x21, 0xE2, 0xD0, 0x10, 0xC0, 0x0F, 0x0C, 0xA2, 0x30, 0x60, 0x0C, 0x07, 0x30, 0x01,
+0x70, 0xB0, 0xD0, 0x22, 0xE1, 0x20, 0x90, 0xE2, 0x2F, 0x08, 0xE0, 0x22, 0xE0, 0x23, 0xE0, 0x22,
+0xE0, 0x91, 0xEA, 0x91, 0x42, 0x92, 0xE0, 0xD1, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0xD0, 0x10, 0xA0,
+0x30, 0x01, 0x70, 0xA0, 0xD0, 0x21, 0xE0, 0x20, 0xA0, 0x90, 0xD1, 0xA0, 0x80, 0x60, 0x40, 0xD0,
+0xE0, 0xB1, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE4, 0x24, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0x90,
+0x40, 0x90, 0xE0, 0xD0, 0xE2, 0x28, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x40, 0x90,
+0xD0, 0xE0, 0x23, 0xE4, 0x28, 0xE4, 0x40, 0x90, 0xD0, 0xE0, 0x40, 0xF0, 0x10, 0x80, 0x10, 0xD1,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xB0, 0x30, 0x60, 0xA0, 0x60, 0x50, 0x60, 0x40, 0xD1, 0x50, 0xF0,
+0xC2, 0x0F, 0x02, 0x60, 0x03, 0x70, 0x50, 0xC0, 0x50, 0x80, 0xC0, 0x02, 0x80, 0x31, 0x10, 0x09,
+0xC0, 0x70, 0x80, 0x50, 0xC0, 0x10, 0x02, 0x71, 0x04, 0x70, 0x01, 0x30, 0x70, 0xC0, 0x50, 0xA0,
+0x50, 0x07, 0xC0, 0x60, 0xA0, 0x90, 0xD0, 0xE1, 0x20, 0xE2, 0xD0, 0x30, 0x10, 0x40, 0xD0, 0x20,
+0xE0, 0x20, 0xD0, 0xA0, 0x10, 0xA0, 0x60, 0xD0, 0x22, 0xE0, 0xD0, 0xE0, 0xD1, 0xE1, 0x91, 0x42,
+0x90, 0xE0, 0xA0, 0x70, 0x05, 0x81, 0xD0, 0x91, 0xE0, 0x21, 0xE0, 0xD0, 0xB0, 0x10, 0xA1, 0x40,
+0xA0, 0xD0, 0xE0, 0x24, 0xD0, 0x10, 0x0F, 0x0D, 0xA0, 0x70, 0x01, 0x30, 0x0C, 0x06, 0xC0, 0x80,
+0x01, 0x50, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x90, 0xB0, 0xD0, 0x21, 0xE2, 0x2F, 0x0E,
+0xE1, 0x21, 0xE0, 0x91, 0xE0, 0x22, 0xE7, 0xD1, 0xE1, 0x91, 0x42, 0x92, 0xE0, 0x20, 0xE0, 0xD0,
+0xE1, 0x20, 0xD0, 0x90, 0x30, 0x50, 0x30, 0xA0, 0x30, 0x70, 0x10, 0xD0, 0x22, 0xE1, 0x90, 0xB0,
+0xD0, 0x60, 0x80, 0x60, 0x40, 0xD0, 0x40, 0x30, 0xA0, 0xD0, 0x20, 0xE2, 0x22, 0xE4, 0x23, 0xE0,
+0x23, 0xE3, 0xD0, 0x91, 0x40, 0x90, 0xE3, 0x25, 0xE1, 0x22, 0x40, 0xE3, 0x90, 0x40, 0x20, 0xE3,
+0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x24, 0xE0, 0x21, 0xE1, 0x40, 0xE0, 0x13, 0xC0, 0x50, 0xB0,
+0xD0, 0xE1, 0x20, 0x40, 0xD0, 0xB0, 0x30, 0x12, 0x61, 0xD0, 0xB0, 0x61, 0x30, 0x80, 0x30, 0x0F,
+0x02, 0xC0, 0x60, 0xC0, 0x00, 0xC0, 0x50, 0xC1, 0x60, 0xA0, 0xF0, 0x70, 0x03, 0x30, 0xF0, 0xC0,
+0x07, 0x70, 0x50, 0x70, 0x00, 0x60, 0x70, 0x00, 0x80, 0xA0, 0x06, 0x70, 0xC0, 0x02, 0x70, 0x60,
+0x30, 0x80, 0x09, 0xC0, 0x10, 0x30, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0x23, 0xD0,
+0x90, 0x10, 0x60, 0xF0, 0x80, 0x60, 0xD0, 0xE1, 0x91, 0x43, 0x91, 0xE0, 0xD0, 0xE0, 0xD1, 0xE0,
+0xF0, 0x80, 0x04, 0x80, 0x40, 0xD0, 0x91, 0xD0, 0xE2, 0xD0, 0x60, 0x10, 0x30, 0xF0, 0xB0, 0xD1,
+0x20, 0xE0, 0x23, 0xD0, 0xA0, 0x80, 0x0F, 0x0C, 0x30, 0x50, 0x01, 0x30, 0xC0, 0x0B, 0x06, 0x70,
+0xF0, 0x30, 0x80, 0xA0, 0x90, 0xE0, 0x21, 0xE1, 0x21, 0xD0, 0x20, 0xE0, 0x29, 0xE5, 0x20, 0xE6,
+0x29, 0xE1, 0x21, 0xE0, 0x40, 0xE1, 0x20, 0xE1, 0x27, 0xE2, 0x20, 0xE2, 0xD0, 0xE1, 0x91, 0x43,
+0x91, 0xD1, 0x40, 0x60, 0x01, 0x70, 0x30, 0xA0, 0x10, 0xD0, 0x24, 0xE0, 0x90, 0xD0, 0x30, 0xC0,
+0xA0, 0x90, 0xD0, 0x40, 0x10, 0xB0, 0xE2, 0x20, 0xE0, 0x28, 0xE0, 0xD0, 0xA0, 0x20, 0xE0, 0x20,
+0xE1, 0x21, 0xE1, 0x21, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE3, 0x20, 0xE0,
+0xD0, 0x91, 0xD0, 0xE1, 0x20, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x23, 0xE1, 0x24,
+0xE0, 0x21, 0xE0, 0xD0, 0xB0, 0xA0, 0x14, 0xC0, 0x60, 0xD0, 0xE2, 0x40, 0xD0, 0x40, 0x13, 0xA0,
+0x50, 0x60, 0x40, 0x80, 0xA0, 0x50, 0xA0, 0x80, 0x50, 0x0F, 0x01, 0xF0, 0x10, 0x70, 0x50, 0x70,
+0x01, 0xA0, 0x40, 0xC0, 0x60, 0xA0, 0xC0, 0x03, 0xC0, 0x05, 0x70, 0x51, 0xC0, 0x01, 0x50, 0xA0,
+0x02, 0x30, 0x70, 0x03, 0x80, 0x70, 0x80, 0x70, 0x0F, 0x02, 0xA0, 0x50, 0x90, 0xE0, 0x23, 0xE0,
+0x21, 0xE1, 0x22, 0xE0, 0xD2, 0xC0, 0x10, 0xF0, 0x31, 0xB0, 0x40, 0x93, 0x40, 0xD2, 0xE5, 0xD1,
+0x11, 0xA0, 0x01, 0xF1, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x40, 0xE0, 0xD0, 0xA0, 0xF0, 0xD0, 0x90,
+0xD1, 0xE3, 0x20, 0xE1, 0xD0, 0x31, 0x0F, 0x0C, 0x50, 0xA0, 0x80, 0x30, 0xF0, 0x70, 0x0B, 0x06,
+0x80, 0x70, 0x00, 0xC0, 0x60, 0xD0, 0xE1, 0x29, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x22, 0xE2, 0x20, 0xE0, 0x40, 0xE1, 0x20, 0xE2, 0x2E,
+0xE1, 0xD2, 0xE0, 0xD0, 0xE0, 0x90, 0x42, 0x80, 0x60, 0x50, 0xC0, 0x01, 0x30, 0x10, 0xD0, 0xE1,
+0x22, 0xE0, 0xD1, 0x40, 0xA1, 0x40, 0xD0, 0x40, 0x60, 0xE5, 0x28, 0xE0, 0x21, 0xE1, 0x20, 0xE5,
+0x22, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE0, 0xD1, 0x21, 0xE1, 0x40, 0xD0, 0xE1, 0x20,
+0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x23, 0xE2, 0xD0, 0xB0,
+0x30, 0x51, 0xA0, 0x80, 0x10, 0xC0, 0x50, 0xB0, 0xD0, 0xE1, 0x40, 0xD0, 0x80, 0xF0, 0x30, 0x10,
+0x30, 0x60, 0x10, 0x02, 0x50, 0x02, 0x60, 0x0F, 0x01, 0x30, 0x80, 0x50, 0x03, 0xF0, 0xD0, 0xB1,
+0x00, 0x50, 0x07, 0x70, 0x51, 0xC0, 0x02, 0x70, 0x60, 0x80, 0x03, 0x70, 0x30, 0x03, 0x30, 0x70,
+0x0F, 0x04, 0xF0, 0x91, 0xE9, 0x20, 0xE2, 0x91, 0x41, 0x90, 0x60, 0x50, 0x70, 0x50, 0x10, 0x80,
+0x60, 0xA0, 0x60, 0x80, 0xA0, 0x40, 0xD1, 0xE0, 0x21, 0xE3, 0xD0, 0x30, 0xA0, 0xB0, 0x70, 0x60,
+0xB0, 0xE2, 0x40, 0xD0, 0xE0, 0x60, 0xD0, 0x40, 0xF0, 0xB0, 0xD1, 0xE1, 0x23, 0xE1, 0x20, 0xD0,
+0x30, 0xA0, 0x0F, 0x0C, 0xC0, 0xA0, 0xC0, 0x00, 0x51, 0x0B, 0x06, 0x30, 0x02, 0x30, 0xD0, 0x24,
+0xE1, 0x21, 0xE0, 0x22, 0xE5, 0x2F, 0x00, 0xE6, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x21, 0xE1, 0x27, 0xE0, 0x24, 0xE5, 0x20, 0xE0, 0xD0, 0xE0, 0xD0, 0x30, 0x10, 0x50,
+0x71, 0x80, 0x30, 0x40, 0x90, 0xE2, 0xD0, 0xE0, 0xD2, 0xA0, 0x30, 0xC0, 0xA0, 0xD0, 0x90, 0x60,
+0x90, 0xE1, 0x23, 0xE5, 0x26, 0xE1, 0x20, 0xE0, 0x23, 0xE2, 0x22, 0xE0, 0xD0, 0xE0, 0x90, 0x40,
+0x90, 0xE1, 0xD1, 0xE0, 0x91, 0xE0, 0xD0, 0xE2, 0x20, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0,
+0x20, 0xE0, 0x24, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x60, 0xF0, 0x50, 0x70, 0xB0, 0x10,
+0x60, 0x00, 0x70, 0x10, 0xE0, 0xD1, 0x30, 0xF0, 0x10, 0x60, 0x80, 0x02, 0x60, 0x01, 0x50, 0xC0,
+0x01, 0x70, 0xA0, 0x04, 0x10, 0x70, 0x08, 0x70, 0x60, 0x50, 0x03, 0xA0, 0x30, 0x90, 0x61, 0x00,
+0x70, 0xC0, 0x03, 0xC0, 0x51, 0x70, 0x05, 0x60, 0xC0, 0x04, 0x80, 0x30, 0x03, 0xC0, 0x60, 0x0C,
+0x60, 0x70, 0x04, 0x80, 0xB0, 0x40, 0xD0, 0xE1, 0xD2, 0xE0, 0x91, 0x43, 0x91, 0xE1, 0xD1, 0x90,
+0xA0, 0x01, 0x70, 0x60, 0x82, 0x01, 0xA0, 0xD0, 0xE0, 0xD0, 0x24, 0xE1, 0xD1, 0xB0, 0xF0, 0xB0,
+0xD0, 0xE0, 0x20, 0xE0, 0x40, 0xD1, 0xE0, 0xD0, 0x30, 0xF0, 0xA0, 0xD0, 0xE1, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x60, 0x50, 0x0F, 0x0C, 0xC0, 0xA0, 0x01, 0x70, 0x80, 0x0B,
+0x06, 0xA0, 0xC1, 0x00, 0xA0, 0xD0, 0xE3, 0xD0, 0xE0, 0x20, 0xEB, 0x2F, 0x00, 0xE8, 0x22, 0xE0,
+0x20, 0x90, 0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x20, 0xE3, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE6,
+0x20, 0xE0, 0xD0, 0x60, 0x10, 0xC0, 0x00, 0x50, 0xA0, 0xD0, 0x92, 0x42, 0x90, 0x40, 0xA0, 0xD0,
+0xB0, 0x30, 0xC0, 0x60, 0xD0, 0x40, 0x10, 0xE3, 0x22, 0xE5, 0x22, 0xE0, 0x24, 0xE6, 0x26, 0xE0,
+0xD0, 0xE0, 0x91, 0x40, 0x90, 0x20, 0xD0, 0x40, 0xE4, 0x20, 0xE6, 0x90, 0x40, 0xE1, 0x20, 0xE1,
+0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0xD0, 0x40, 0x10, 0x80, 0x30, 0xA0, 0x80, 0xF0, 0x02, 0x80,
+0xA0, 0xE0, 0x90, 0x61, 0x80, 0x03, 0x50, 0x60, 0x00, 0xC0, 0x70, 0x03, 0xA0, 0xC0, 0x03, 0xC1,
+0x80, 0x70, 0xC0, 0x04, 0x50, 0xC0, 0x70, 0x04, 0xF0, 0x70, 0xE0, 0xA0, 0x60, 0xC1, 0x50, 0x01,
+0x70, 0x50, 0x70, 0xC0, 0x07, 0xA0, 0x05, 0x70, 0xA0, 0x04, 0xA0, 0x0C, 0x70, 0x05, 0x50, 0xA0,
+0x90, 0xE1, 0x91, 0x42, 0x91, 0xE0, 0x91, 0xD1, 0xE3, 0x20, 0xD0, 0x30, 0xF0, 0x60, 0xA0, 0x80,
+0x60, 0x10, 0xC0, 0x01, 0x70, 0xA0, 0x30, 0xE1, 0x20, 0xE1, 0x22, 0xE2, 0x40, 0xD0, 0x22, 0xD0,
+0x40, 0x90, 0xB0, 0xD0, 0xB0, 0x60, 0x10, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x25, 0xD0, 0x40,
+0x60, 0x0F, 0x0D, 0x60, 0x00, 0xC0, 0x70, 0x80, 0x0B, 0x06, 0xA0, 0x80, 0x31, 0x60, 0x42, 0x92,
+0xE0, 0xD1, 0xE1, 0xD5, 0xEF, 0x04, 0x22, 0xE8, 0x91, 0xD0, 0x27, 0xE0, 0x24, 0xE1, 0x20, 0xE1,
+0x26, 0xE3, 0xD0, 0xB0, 0xA0, 0x10, 0x00, 0x80, 0x10, 0xD0, 0xE0, 0xD0, 0xE2, 0xD0, 0xE0, 0x90,
+0x40, 0x30, 0xB0, 0x40, 0x30, 0x40, 0xA0, 0xD1, 0x90, 0xB0, 0xD0, 0xE0, 0x22, 0xE1, 0x25, 0xE3,
+0x26, 0xE2, 0x20, 0xE0, 0x24, 0xE6, 0x90, 0x42, 0xD0, 0x20, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0x20,
+0xE3, 0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xD0, 0xE0, 0xB1, 0x40,
+0x90, 0xF1, 0x30, 0x01, 0x50, 0x60, 0x70, 0xA0, 0x80, 0x10, 0x50, 0x04, 0x80, 0x50, 0x70, 0x05,
+0x60, 0x05, 0x80, 0x12, 0x50, 0x00, 0x70, 0xA0, 0x50, 0x06, 0xF0, 0xD2, 0xE0, 0x60, 0xF0, 0xA0,
+0x30, 0x80, 0xC0, 0x0A, 0x30, 0xC0, 0x05, 0xA0, 0x04, 0xA0, 0x0F, 0x00, 0x50, 0xA0, 0x01, 0x80,
+0x30, 0x41, 0x92, 0xE4, 0xD0, 0x40, 0xF0, 0xD0, 0xE3, 0x21, 0xE0, 0xD0, 0xF0, 0x30, 0x40, 0x10,
+0xF0, 0x70, 0x03, 0x50, 0x60, 0x30, 0xD1, 0xE0, 0x25, 0xE0, 0xD0, 0xE0, 0x22, 0xE0, 0x90, 0x30,
+0x60, 0x90, 0xA0, 0x60, 0x40, 0xD0, 0x22, 0xE1, 0x25, 0xE0, 0xD0, 0xF0, 0x80, 0x0F, 0x05, 0xC1,
+0x71, 0x52, 0x10, 0x33, 0x0B, 0x06, 0x30, 0x02, 0xA0, 0xD1, 0xE1, 0x91, 0x47, 0x93, 0xE0, 0x20,
+0xEF, 0x01, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xD0, 0x25, 0xE0, 0x22, 0xE9, 0x23, 0xE0,
+0x20, 0xE3, 0xD0, 0x60, 0xC0, 0x30, 0x80, 0xF0, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xD1, 0xE0, 0xF0,
+0xA0, 0xD1, 0xB0, 0x60, 0xB0, 0xA0, 0x40, 0x91, 0xE4, 0xD0, 0xEA, 0x24, 0xE0, 0x26, 0xE5, 0x20,
+0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x25, 0xE2, 0x22, 0xE0, 0xD1, 0x90, 0x40, 0x90, 0xE0,
+0xD0, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD2, 0x90, 0xB0, 0x61, 0x51, 0xF0, 0xA0, 0x60,
+0x10, 0x30, 0xA0, 0x05, 0x60, 0xF0, 0x30, 0x70, 0x03, 0x30, 0xC0, 0x08, 0x50, 0x60, 0x70, 0x30,
+0x10, 0x50, 0x06, 0x70, 0x10, 0x90, 0xD3, 0xA0, 0x80, 0x10, 0x30, 0x09, 0xC0, 0x60, 0x06, 0x30,
+0xC0, 0x03, 0x80, 0x70, 0x0B, 0xC0, 0x71, 0x80, 0x51, 0x70, 0x60, 0xD0, 0x91, 0xE0, 0xD0, 0xE1,
+0x23, 0xE0, 0xD0, 0x61, 0xD0, 0xE1, 0x23, 0xE0, 0xD2, 0xE0, 0xD0, 0x10, 0x50, 0x04, 0xB0, 0x10,
+0xB0, 0xD0, 0xE0, 0x23, 0xE0, 0xD0, 0xE0, 0x23, 0xD1, 0x10, 0xA0, 0x11, 0xF0, 0xD0, 0x22, 0xE4,
+0x20, 0xE1, 0x20, 0xD1, 0xF0, 0x70, 0x08, 0xC1, 0x71, 0x57, 0x71, 0xC1, 0x02, 0x10, 0x02, 0x30,
+0x0B, 0x06, 0x30, 0x02, 0xA0, 0xD0, 0x20, 0xEB, 0x20, 0xE0, 0x92, 0x45, 0x95, 0xE2, 0xD1, 0xE6,
+0x20, 0xE0, 0x20, 0xE2, 0x91, 0xE0, 0x23, 0xE6, 0x21, 0xE7, 0x26, 0xE1, 0xD0, 0x60, 0x30, 0x50,
+0xF0, 0xD0, 0x22, 0xE1, 0x21, 0xE3, 0x90, 0xA0, 0xD2, 0xB0, 0xD0, 0xB0, 0x90, 0x10, 0x90, 0x42,
+0x92, 0xE2, 0xD1, 0xE4, 0x21, 0xE1, 0x29, 0xE0, 0x27, 0xE2, 0x40, 0xD0, 0xE1, 0x25, 0xE1, 0x21,
+0xE5, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x21, 0xE7, 0xD0, 0xB0, 0xA0, 0x60, 0xB0, 0xA0, 0x30, 0x80,
+0xA1, 0x30, 0x50, 0xF0, 0x03, 0x80, 0xF0, 0xC0, 0x50, 0x80, 0x61, 0x82, 0xF0, 0x02, 0xC0, 0x04,
+0xC0, 0x30, 0xC0, 0x30, 0xB0, 0xF0, 0x80, 0x07, 0x70, 0x60, 0x40, 0xD0, 0xE0, 0xD1, 0xA1, 0x03,
+0xC0, 0x70, 0x80, 0x30, 0x80, 0x60, 0x00, 0x50, 0x30, 0x06, 0xA0, 0x50, 0x03, 0x51, 0x05, 0xC1,
+0x71, 0x51, 0x71, 0xC0, 0x03, 0x30, 0x90, 0xE0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE0, 0x90,
+0x10, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0xD0, 0xE0, 0xA0, 0xB0, 0xC0, 0x01, 0xC0, 0xA0,
+0x10, 0x60, 0xD1, 0xE1, 0x20, 0xB0, 0x60, 0x90, 0xD0, 0xE2, 0x20, 0xD0, 0x40, 0xF1, 0x00, 0x10,
+0x90, 0xD0, 0xE2, 0xD2, 0xE0, 0xD2, 0xE2, 0xB0, 0x60, 0x00, 0x72, 0x55, 0x71, 0xC1, 0x0E, 0xF0,
+0x02, 0x30, 0x0B, 0x06, 0x60, 0x80, 0x51, 0x30, 0xD0, 0xE2, 0x27, 0xE5, 0xD0, 0xE0, 0xD1, 0xE2,
+0x95, 0x44, 0x94, 0x21, 0xE0, 0x20, 0xE2, 0xD0, 0x91, 0xEA, 0x20, 0xE7, 0x20, 0xE0, 0x27, 0xE1,
+0x40, 0xB0, 0xC0, 0x30, 0xD0, 0x21, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0x90,
+0xE0, 0x40, 0xF0, 0xD1, 0x40, 0xD1, 0xE1, 0x92, 0x42, 0x91, 0xEB, 0x2E, 0xE3, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x24, 0xE1, 0x22, 0xE0, 0x21, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0xE1, 0xD0, 0xE1, 0x22,
+0xE2, 0x21, 0xE0, 0xD0, 0x90, 0x50, 0x80, 0xA0, 0xB0, 0xF0, 0x70, 0x00, 0x31, 0x10, 0x03, 0x70,
+0x30, 0x70, 0xC0, 0x02, 0x82, 0xF0, 0x00, 0xC0, 0x50, 0x60, 0x80, 0x02, 0x30, 0xA0, 0x62, 0xD0,
+0xF0, 0x70, 0x08, 0xC0, 0x30, 0xA0, 0xE1, 0xD0, 0x40, 0xF0, 0x30, 0x01, 0x80, 0xA0, 0x80, 0x73,
+0xF0, 0x60, 0xC0, 0x05, 0x70, 0xA0, 0x04, 0x80, 0x70, 0x00, 0xC0, 0x71, 0x51, 0x71, 0xC1, 0x08,
+0x80, 0x40, 0xE0, 0x40, 0xD0, 0xE1, 0x26, 0xD0, 0xB1, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x21,
+0xE0, 0xD0, 0xE0, 0x30, 0xA0, 0x30, 0xA1, 0x30, 0x60, 0x30, 0xF0, 0xE0, 0x90, 0x40, 0xD0, 0x40,
+0x10, 0x90, 0xD0, 0xE1, 0xD1, 0x40, 0xA0, 0x82, 0xB0, 0xD0, 0xE1, 0x20, 0xE0, 0x94, 0x43, 0x90,
+0x40, 0x60, 0x50, 0xC2, 0x0F, 0x09, 0xA0, 0x70, 0x50, 0x80, 0x60, 0x0B, 0x05, 0xC0, 0x30, 0x71,
+0x80, 0x30, 0xD0, 0x20, 0xE7, 0x27, 0xEF, 0x03, 0x94, 0x47, 0x91, 0xE5, 0xD2, 0xE0, 0x20, 0xE1,
+0x27, 0xE2, 0x22, 0xE0, 0x22, 0xE0, 0x30, 0x50, 0x40, 0x23, 0xE5, 0x21, 0xE0, 0x40, 0xD0, 0x60,
+0xF0, 0x80, 0x10, 0x40, 0xD1, 0xE6, 0xD0, 0xE0, 0x20, 0x92, 0x42, 0x91, 0xE0, 0xD2, 0xE5, 0x21,
+0xE1, 0x26, 0xE2, 0x91, 0xE1, 0x20, 0xE1, 0x23, 0xE2, 0x24, 0xE3, 0xD0, 0xE0, 0x41, 0xE4, 0x25,
+0xD1, 0x31, 0x60, 0x10, 0x80, 0xC0, 0x02, 0x50, 0x80, 0x60, 0x80, 0x02, 0x70, 0xA0, 0x60, 0x30,
+0x60, 0x00, 0x50, 0x60, 0x50, 0xA0, 0xF0, 0x30, 0x80, 0x00, 0x81, 0x70, 0x30, 0x12, 0x30, 0x11,
+0xF0, 0xA0, 0x80, 0x09, 0xC0, 0x60, 0xF0, 0x90, 0xD0, 0x30, 0x10, 0x80, 0xC0, 0xA0, 0x05, 0x30,
+0xC0, 0x06, 0xA0, 0x50, 0x02, 0xC0, 0x70, 0x50, 0x80, 0x72, 0xC0, 0x0E, 0x80, 0xB0, 0xD0, 0x40,
+0xD0, 0xE6, 0x22, 0xD0, 0x60, 0xD0, 0xE0, 0x24, 0xE2, 0xD1, 0xE0, 0xD2, 0x80, 0xA0, 0x60, 0x11,
+0x30, 0xF0, 0xD0, 0xA0, 0xF0, 0x60, 0x80, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0xD0, 0x80, 0xF0, 0x71,
+0x50, 0xA0, 0x44, 0x94, 0xE2, 0x21, 0xD0, 0xA0, 0x60, 0x80, 0x0F, 0x0C, 0xA0, 0x50, 0x71, 0xA0,
+0x0B, 0x05, 0xC0, 0x80, 0x01, 0xC0, 0x30, 0xD0, 0x20, 0xEB, 0x24, 0xE0, 0x2F, 0x00, 0xE2, 0xD6,
+0xE1, 0xD0, 0x40, 0x91, 0x48, 0x92, 0x21, 0xD0, 0xE8, 0xD0, 0xE0, 0xD0, 0xE0, 0xD0, 0x20, 0xE0,
+0x90, 0xB0, 0x30, 0x40, 0xE0, 0x21, 0xE1, 0x22, 0xE4, 0x40, 0xD0, 0x80, 0x11, 0xC0, 0x10, 0xB0,
+0xD0, 0xE0, 0x24, 0xE0, 0x21, 0xE3, 0xD1, 0xE1, 0x90, 0x42, 0x92, 0xE0, 0xD4, 0xE5, 0x22, 0xE1,
+0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x23, 0xE2, 0x23, 0xE3, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0,
+0xE1, 0x25, 0xE1, 0x10, 0x81, 0x50, 0x04, 0x50, 0x00, 0x70, 0x50, 0x02, 0x80, 0x30, 0x01, 0xF0,
+0xA1, 0x01, 0xA0, 0x03, 0x70, 0x30, 0xC0, 0x10, 0xD0, 0x50, 0xF0, 0x50, 0xA0, 0x90, 0xD1, 0x40,
+0xA1, 0x30, 0xC0, 0x03, 0x31, 0x01, 0x30, 0xD1, 0x40, 0xD0, 0xA1, 0x70, 0x05, 0x50, 0x80, 0x05,
+0xC0, 0x30, 0x70, 0x52, 0x71, 0x60, 0xC0, 0x04, 0x80, 0x50, 0x0B, 0xB0, 0x90, 0xD0, 0x40, 0xE5,
+0x20, 0xE2, 0x20, 0xE0, 0x40, 0xE0, 0xD0, 0xE0, 0x22, 0xE3, 0xB0, 0x40, 0xD0, 0x40, 0x30, 0x80,
+0x11, 0xA0, 0x10, 0x61, 0x80, 0x40, 0x31, 0x80, 0xA0, 0x90, 0x44, 0xB0, 0x50, 0xC0, 0x50, 0xA0,
+0xD7, 0xE3, 0x23, 0xD0, 0xA0, 0x10, 0x80, 0x0F, 0x0C, 0xA0, 0xC0, 0x01, 0x30, 0x0B, 0x05, 0xC0,
+0x30, 0x01, 0x70, 0xB0, 0xD0, 0x22, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x27, 0xE8, 0x24, 0xED, 0xD0,
+0x40, 0xEA, 0x92, 0x40, 0x90, 0x43, 0x94, 0xE0, 0x90, 0xE2, 0xD2, 0xB0, 0xF0, 0x10, 0xB0, 0xD0,
+0xE0, 0x20, 0xE1, 0x23, 0xE1, 0x21, 0x40, 0xE0, 0xD0, 0x40, 0x10, 0xF0, 0x70, 0xA0, 0xD0, 0x21,
+0xE0, 0x21, 0xE2, 0x26, 0xE5, 0x20, 0xE0, 0x91, 0x41, 0x92, 0xE0, 0xD2, 0xE7, 0x40, 0xD0, 0xE0,
+0x27, 0xE1, 0x21, 0xE3, 0x26, 0xD1, 0x90, 0x40, 0x90, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0xD0, 0x90,
+0x60, 0xA0, 0x05, 0x50, 0x00, 0xA0, 0x11, 0xA0, 0x31, 0x70, 0x00, 0x70, 0x60, 0x30, 0x01, 0x70,
+0x30, 0x01, 0xC0, 0x50, 0xC0, 0x50, 0x60, 0x10, 0xC0, 0xD1, 0x60, 0x40, 0xD0, 0xE1, 0xD2, 0x90,
+0xA0, 0x81, 0x00, 0x71, 0x00, 0x50, 0x80, 0x60, 0xD1, 0x40, 0xD0, 0x90, 0x10, 0x07, 0xF0, 0xC0,
+0x71, 0x52, 0xC0, 0x30, 0x70, 0x03, 0xA0, 0x50, 0x06, 0xC0, 0x0B, 0x80, 0x40, 0xD0, 0x40, 0xE1,
+0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0xD1, 0xB0, 0x90, 0xB0, 0xD0, 0xE1, 0xD1, 0xA0, 0x50, 0xA0,
+0xF0, 0xB0, 0x80, 0xA0, 0x30, 0x50, 0x70, 0x51, 0x80, 0x31, 0x62, 0x40, 0xD0, 0xE2, 0xD1, 0xB0,
+0x50, 0x00, 0x80, 0xB0, 0xD1, 0xE1, 0x22, 0xE4, 0x23, 0xD0, 0xA0, 0x70, 0x30, 0x0F, 0x0C, 0x30,
+0x70, 0x01, 0xA0, 0x0B, 0x50, 0x70, 0x03, 0xC0, 0xF0, 0x31, 0x60, 0xB0, 0xE0, 0x2A, 0xE0, 0x20,
+0xE2, 0x2A, 0xE4, 0x24, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE0, 0x29, 0xE0, 0xD0, 0xE2,
+0xD1, 0xE1, 0x96, 0x44, 0x90, 0x40, 0xF0, 0x30, 0xB0, 0xE2, 0x20, 0xE7, 0x20, 0x90, 0xD0, 0x20,
+0xD0, 0xA0, 0x30, 0x00, 0x40, 0xB0, 0xD0, 0x23, 0xE2, 0x2A, 0xE0, 0x21, 0xE1, 0xD0, 0xE2, 0x91,
+0x42, 0x90, 0xE3, 0xD0, 0xE0, 0xD0, 0x91, 0xD0, 0xE1, 0x26, 0xE1, 0x21, 0xE3, 0x22, 0xE7, 0x90,
+0x40, 0xE0, 0xD0, 0xE1, 0x23, 0xD1, 0xF0, 0x50, 0x04, 0x50, 0x80, 0x30, 0x00, 0x30, 0x10, 0x32,
+0x80, 0x60, 0xF0, 0x30, 0x70, 0xA0, 0xF0, 0xC0, 0x00, 0x50, 0x70, 0x02, 0x30, 0xA0, 0xD0, 0xE1,
+0xD4, 0xE1, 0xD1, 0x60, 0x51, 0x31, 0x80, 0x00, 0xA0, 0x60, 0x10, 0xD1, 0x90, 0xD0, 0x31, 0x03,
+0xC0, 0x70, 0x52, 0x30, 0xC0, 0x04, 0x80, 0x50, 0x03, 0x30, 0x70, 0x0F, 0x04, 0x30, 0xE0, 0xD0,
+0x40, 0xE0, 0xD0, 0xE5, 0xD0, 0x20, 0xE3, 0x90, 0xB0, 0xA0, 0x42, 0xB0, 0x30, 0x80, 0x71, 0x00,
+0x51, 0x06, 0xC0, 0x00, 0xA0, 0x50, 0xC0, 0xA0, 0xD0, 0xE2, 0xD0, 0x90, 0xA0, 0x00, 0xC0, 0xB0,
+0xE5, 0x21, 0xE3, 0x20, 0xE0, 0x22, 0xD0, 0xA0, 0x0F, 0x0E, 0x30, 0x60, 0x31, 0x10, 0x0B, 0x50,
+0x30, 0xC0, 0x02, 0xC0, 0x80, 0x01, 0x50, 0xB0, 0xD0, 0x21, 0xE0, 0x2A, 0xEC, 0x24, 0xE1, 0x2B,
+0xE0, 0xD0, 0x40, 0xE0, 0x22, 0xE0, 0x24, 0xE2, 0xD1, 0xE0, 0x90, 0xF0, 0xB0, 0x90, 0xD1, 0xE6,
+0xD0, 0xE1, 0x20, 0xE0, 0x30, 0x80, 0xB0, 0x91, 0x45, 0x92, 0xE0, 0x91, 0xD0, 0xE0, 0xD0, 0xA0,
+0xF0, 0x80, 0x70, 0x60, 0xD0, 0xE2, 0x21, 0xE0, 0x21, 0xE1, 0x22, 0xE2, 0x23, 0xE8, 0xD0, 0xE1,
+0x92, 0x42, 0x90, 0xE0, 0x91, 0xE0, 0x21, 0xE4, 0x23, 0xE1, 0x25, 0xE0, 0x21, 0xE6, 0x90, 0x40,
+0x90, 0xE0, 0xD0, 0x23, 0xE0, 0xD0, 0x40, 0x60, 0x04, 0x70, 0x10, 0xA0, 0x60, 0x10, 0xA0, 0xC0,
+0x00, 0x60, 0x50, 0x01, 0x80, 0x30, 0xC0, 0x70, 0x30, 0x50, 0x02, 0xC0, 0x31, 0xB0, 0xD0, 0xE2,
+0xD1, 0xE0, 0xD2, 0xB0, 0x60, 0x50, 0x01, 0x50, 0x10, 0xA0, 0x30, 0x50, 0x00, 0x80, 0x61, 0x30,
+0xA0, 0x80, 0xC0, 0x52, 0x71, 0xC0, 0x02, 0x82, 0x02, 0x70, 0xA0, 0x04, 0x70, 0x60, 0xA0, 0x70,
+0x0F, 0x02, 0x60, 0xE0, 0xD0, 0x91, 0xE0, 0x92, 0x45, 0x94, 0xE0, 0xF0, 0x40, 0xD0, 0x10, 0x70,
+0x03, 0x30, 0xF0, 0x08, 0x71, 0x00, 0x60, 0xD0, 0xE0, 0xD1, 0xB0, 0x60, 0xC0, 0x00, 0x60, 0x80,
+0xD0, 0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x23, 0xE1, 0xD0, 0xA0, 0xC0, 0x0F, 0x0D, 0x30, 0x50, 0x01,
+0x30, 0x0B, 0x31, 0x03, 0x70, 0x80, 0x01, 0x41, 0xD0, 0x21, 0xE0, 0x27, 0xE8, 0x26, 0xE2, 0x2F,
+0x00, 0xE0, 0xD0, 0x40, 0xD0, 0x22, 0xE2, 0x23, 0xE2, 0xD1, 0xB0, 0x10, 0xB0, 0xE1, 0x20, 0xE0,
+0x26, 0xE2, 0xD0, 0x90, 0xB1, 0x30, 0x90, 0xD3, 0xE0, 0x93, 0x41, 0x90, 0xE2, 0xD1, 0x31, 0xA0,
+0xD0, 0xE2, 0x22, 0xE1, 0x21, 0xE8, 0x2A, 0xE2, 0xD3, 0xE0, 0x91, 0x40, 0xE1, 0x20, 0xE5, 0x23,
+0xE2, 0x25, 0xE1, 0x26, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE4, 0xD0, 0x10, 0x80, 0x03, 0x50,
+0x00, 0x10, 0x70, 0xC0, 0x80, 0x70, 0x60, 0x11, 0x50, 0x02, 0x70, 0x51, 0xF0, 0x30, 0x50, 0x80,
+0xF0, 0xC0, 0x30, 0xB0, 0xD0, 0xE1, 0xD0, 0xA1, 0x60, 0xF0, 0xA0, 0x60, 0x80, 0x03, 0x70, 0x10,
+0x70, 0x50, 0x04, 0xC0, 0x50, 0x70, 0xC0, 0x09, 0x50, 0x30, 0x50, 0x00, 0x50, 0x60, 0x07, 0x50,
+0x31, 0x0F, 0x01, 0x30, 0x40, 0xD0, 0x90, 0x40, 0x93, 0xE2, 0xD0, 0xE1, 0xD0, 0xE1, 0xD1, 0xE0,
+0xD2, 0x90, 0xA0, 0x30, 0x61, 0x30, 0x50, 0x80, 0x70, 0x0A, 0x70, 0xA0, 0xD0, 0xE0, 0xF0, 0x30,
+0x70, 0xC0, 0xF0, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x25, 0xE0, 0x20, 0xE2, 0xD0, 0x40, 0x30,
+0x0F, 0x0D, 0x81, 0x01, 0x30, 0x0B, 0x05, 0x70, 0xA0, 0x51, 0x30, 0x40, 0xE0, 0x20, 0xE2, 0x20,
+0xE0, 0x20, 0xEF, 0x0B, 0x28, 0xE0, 0x20, 0xE2, 0x40, 0xE0, 0x22, 0xE3, 0x22, 0xE0, 0x20, 0xE1,
+0xD0, 0xA0, 0x10, 0xB0, 0xD0, 0xE1, 0x20, 0xE0, 0x25, 0xE2, 0xD0, 0x61, 0x00, 0x30, 0x10, 0xB0,
+0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0xE0, 0xD0, 0x90, 0xE1, 0x20, 0xE2, 0xD0, 0xA0, 0x10, 0xD0, 0xE1,
+0x21, 0xE0, 0x20, 0xEF, 0x02, 0x25, 0xE8, 0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x22, 0xE8, 0x20,
+0xE0, 0x22, 0xE2, 0x23, 0xE1, 0xD1, 0x90, 0xB0, 0xE0, 0xD1, 0xE0, 0xD0, 0x40, 0xF0, 0x71, 0x02,
+0x50, 0x70, 0xA0, 0x00, 0x50, 0x01, 0xA0, 0x50, 0xA0, 0x10, 0xC1, 0x50, 0xC0, 0x01, 0x70, 0x60,
+0x50, 0x70, 0x01, 0xA0, 0xE0, 0xD2, 0x60, 0xC0, 0x09, 0x10, 0x80, 0xF0, 0x10, 0x30, 0x04, 0x50,
+0x0C, 0x50, 0x82, 0x09, 0x70, 0x60, 0x0F, 0x01, 0x60, 0xD0, 0xE0, 0x91, 0xD0, 0xEF, 0x02, 0xD0,
+0xE2, 0xD0, 0x40, 0xA0, 0xB0, 0x60, 0x70, 0xC0, 0x09, 0xA0, 0x50, 0xA0, 0x50, 0x01, 0x60, 0xD1,
+0x40, 0xD0, 0xE0, 0x2A, 0xE3, 0xD1, 0x60, 0xC0, 0x0F, 0x0C, 0x50, 0xA0, 0x51, 0x60, 0xC0, 0x0A,
+0x70, 0xA0, 0xF1, 0x60, 0x51, 0x80, 0x71, 0x30, 0x40, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0x20, 0xE2,
+0x40, 0xE0, 0x22, 0xE3, 0x24, 0xE3, 0x30, 0xB0, 0xD0, 0xE2, 0x25, 0xE3, 0xD0, 0x90, 0xA0, 0x60,
+0xA0, 0xF0, 0x60, 0xE3, 0x21, 0xE0, 0xD0, 0xE0, 0x90, 0x20, 0xE2, 0x20, 0xE1, 0x90, 0xB0, 0x90,
+0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE3, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x23, 0xE2, 0xD1, 0xE4, 0x26, 0xE0, 0x23, 0xE1, 0x90,
+0x60, 0xA0, 0x30, 0xB0, 0x41, 0x90, 0xB0, 0x70, 0x00, 0x50, 0x01, 0xC0, 0x50, 0x00, 0x60, 0xA0,
+0x30, 0xA0, 0x00, 0x80, 0x60, 0xD0, 0x60, 0x31, 0x04, 0x60, 0x02, 0x70, 0xF0, 0x30, 0x90, 0x40,
+0xA0, 0x50, 0x0A, 0x70, 0xC0, 0x30, 0x10, 0x50, 0x04, 0x50, 0x0C, 0x80, 0x10, 0x80, 0xC0, 0x08,
+0x70, 0x60, 0xC0, 0x01, 0x50, 0x10, 0xC0, 0x0A, 0xC0, 0xF0, 0xD0, 0x20, 0x91, 0xD0, 0xE0, 0x23,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x90, 0xB1, 0x40, 0xE0, 0xD0,
+0x60, 0xA1, 0x70, 0x07, 0x50, 0x60, 0x30, 0x01, 0x40, 0xB0, 0xD1, 0x40, 0xE1, 0x29, 0xE1, 0x21,
+0xE1, 0xD0, 0x30, 0xC0, 0x0F, 0x0C, 0x50, 0xA0, 0x71, 0x30, 0xC0, 0x0A, 0x60, 0x70, 0xC1, 0x70,
+0xA1, 0x70, 0x01, 0x30, 0x90, 0xE1, 0xD0, 0xE1, 0x2F, 0x17, 0xE0, 0x21, 0xE1, 0x40, 0xE0, 0x2D,
+0xD0, 0x90, 0x41, 0x90, 0xE1, 0x24, 0xE3, 0x21, 0xE0, 0xD0, 0xA0, 0x60, 0xD0, 0x60, 0xB0, 0x40,
+0xD0, 0xE0, 0xD1, 0xE2, 0xD0, 0x40, 0xE0, 0x23, 0xE1, 0xD0, 0xE0, 0xF0, 0xA0, 0xD0, 0xE0, 0x21,
+0xE0, 0x2F, 0x10, 0xE0, 0x20, 0x40, 0xD0, 0x23, 0xE0, 0x23, 0xE2, 0xA0, 0xB0, 0x90, 0xE1, 0x2E,
+0xD0, 0xB0, 0xA0, 0x01, 0xC0, 0x80, 0xA0, 0xB0, 0xF0, 0x50, 0x01, 0x70, 0x50, 0x10, 0x30, 0x80,
+0x60, 0xB0, 0x70, 0x30, 0x50, 0x01, 0xA0, 0xD0, 0x80, 0x11, 0x80, 0x60, 0x80, 0x00, 0x60, 0xC0,
+0x70, 0xC0, 0x10, 0x70, 0x60, 0x10, 0xF0, 0xC0, 0x0B, 0x50, 0x60, 0x51, 0x60, 0xA0, 0x03, 0x50,
+0x0E, 0x80, 0x30, 0xA0, 0x03, 0x50, 0x30, 0xC0, 0x00, 0x10, 0x00, 0xC0, 0x30, 0x00, 0x80, 0x10,
+0x30, 0x0A, 0x80, 0xB0, 0xE2, 0x40, 0xE0, 0x2E, 0xE0, 0x22, 0xE0, 0xD0, 0xB0, 0x60, 0xD0, 0x60,
+0x10, 0x40, 0xD1, 0x90, 0x60, 0xB0, 0x06, 0x60, 0x10, 0xC0, 0x00, 0x80, 0xA0, 0xE0, 0xD0, 0xE0,
+0x40, 0xE1, 0x2C, 0xE0, 0x21, 0xD0, 0xA0, 0xC0, 0x0F, 0x0C, 0x50, 0x30, 0x01, 0x50, 0x70, 0x0A,
+0xB0, 0x03, 0x50, 0x60, 0x70, 0x01, 0x30, 0x90, 0xE0, 0x20, 0xE1, 0x2F, 0x1B, 0xE0, 0x91, 0xE0,
+0x2B, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xA0, 0x90, 0xD0, 0x20, 0xE0, 0x23, 0xE2, 0x23, 0xE0, 0xD0,
+0xE0, 0xD0, 0x60, 0xF0, 0x40, 0xD1, 0x40, 0xA0, 0x90, 0xD2, 0x40, 0xE0, 0x23, 0xE0, 0x20, 0xE0,
+0xD0, 0xB0, 0xF0, 0xB0, 0xD0, 0xE2, 0x2F, 0x10, 0xE1, 0x90, 0xD0, 0x23, 0xE0, 0x24, 0xE1, 0x91,
+0x20, 0xD0, 0xE0, 0x20, 0xE0, 0x2C, 0xD0, 0xB0, 0x10, 0xA0, 0x50, 0x01, 0xC0, 0x50, 0xC0, 0x80,
+0xA0, 0xF0, 0x30, 0xF0, 0x70, 0x40, 0xB0, 0x50, 0x90, 0xF0, 0x61, 0x50, 0x70, 0x50, 0xA0, 0x80,
+0xD0, 0xC0, 0xB0, 0xF0, 0xA0, 0x00, 0x80, 0xF0, 0x60, 0x10, 0xF1, 0x10, 0x60, 0x03, 0x50, 0x70,
+0x05, 0xC0, 0xA0, 0xF0, 0xC0, 0x02, 0xA0, 0x50, 0x02, 0x50, 0x0F, 0x01, 0x70, 0x10, 0x01, 0xC0,
+0xF0, 0xB0, 0x60, 0xF0, 0x10, 0x80, 0xF0, 0x30, 0x01, 0xA0, 0x60, 0xC0, 0x09, 0x70, 0xA0, 0xD0,
+0xE1, 0x40, 0xE0, 0x2F, 0x04, 0xE0, 0xD3, 0xB0, 0x90, 0x10, 0x40, 0xD1, 0xB0, 0xA0, 0x81, 0x00,
+0xC0, 0x50, 0xB0, 0x60, 0x80, 0x60, 0xF0, 0x30, 0xD1, 0xE1, 0x40, 0xE1, 0x2A, 0xE0, 0x22, 0xE0,
+0xD0, 0xA0, 0xC0, 0x0F, 0x0C, 0x70, 0x30, 0x01, 0x51, 0x80, 0x00, 0x50, 0x60, 0x30, 0x05, 0xA1,
+0x81, 0xA0, 0x60, 0x80, 0xA0, 0x31, 0x60, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x22, 0xE1, 0x20, 0xE0, 0x91, 0xE1, 0x23, 0xE2, 0x25, 0xE2, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE4,
+0x23, 0xE2, 0xD0, 0x60, 0xF0, 0x60, 0x40, 0xB0, 0x60, 0x50, 0x10, 0x30, 0xD1, 0x40, 0xD0, 0x24,
+0xE2, 0xD0, 0x40, 0x60, 0xB0, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE2, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE3, 0xD0, 0x40, 0x60, 0xD0,
+0xE0, 0x27, 0xE4, 0x20, 0xD0, 0xB0, 0x71, 0x10, 0x80, 0x02, 0x70, 0x50, 0xC0, 0x00, 0x50, 0x30,
+0x90, 0x40, 0xD0, 0x40, 0x90, 0x10, 0xB0, 0x50, 0x30, 0xB0, 0xC0, 0x00, 0x30, 0x60, 0x50, 0xC0,
+0xA0, 0x50, 0x10, 0x80, 0x30, 0x10, 0x30, 0x10, 0x60, 0x05, 0x81, 0x03, 0x70, 0x80, 0x60, 0xC0,
+0xA0, 0x03, 0x30, 0x70, 0x02, 0x70, 0xC0, 0x0F, 0x00, 0xC0, 0xA0, 0x00, 0x80, 0xF0, 0xD2, 0x90,
+0xD0, 0x40, 0x10, 0x80, 0x00, 0x40, 0xB0, 0x50, 0xA0, 0x0A, 0xA0, 0xB0, 0xD1, 0x40, 0xD0, 0x26,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE6, 0x21, 0xE0, 0x20, 0xE0, 0xD1, 0x90, 0xF1, 0xB0, 0x90,
+0xD0, 0x40, 0xB0, 0xA0, 0xB1, 0xA0, 0xB0, 0xA1, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xE1,
+0x23, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0xB0, 0xC0, 0x0F, 0x0C, 0x70, 0x10, 0x31,
+0x61, 0x80, 0x50, 0x60, 0xC0, 0x80, 0x60, 0x04, 0x71, 0x81, 0x50, 0x00, 0x50, 0x70, 0x01, 0x30,
+0xE0, 0xD0, 0xE0, 0x20, 0xEF, 0x17, 0x22, 0xE2, 0x91, 0xE0, 0x23, 0xE4, 0x22, 0xE0, 0x20, 0xE3,
+0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x26, 0xE1, 0x20, 0xD0, 0xF1, 0x10, 0x80, 0x30, 0x01, 0xC0,
+0x80, 0x30, 0xA0, 0x30, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0xE1, 0xD0, 0xA0, 0xE0, 0xD0, 0xE0,
+0x21, 0xEF, 0x10, 0x91, 0xD0, 0xE0, 0x21, 0xE2, 0x21, 0xE5, 0x20, 0x40, 0xD0, 0xE2, 0x23, 0xE5,
+0x20, 0xE0, 0xD0, 0xA0, 0xC0, 0x80, 0x50, 0x02, 0xC0, 0x00, 0x50, 0x30, 0x80, 0xA0, 0x40, 0x92,
+0xE0, 0x40, 0xA0, 0xB0, 0xD1, 0xB0, 0xA0, 0x30, 0x00, 0xC0, 0x10, 0xA1, 0x80, 0x30, 0x00, 0x10,
+0xF0, 0x80, 0x30, 0x10, 0x50, 0x02, 0x80, 0x70, 0x03, 0x80, 0xA0, 0x30, 0x70, 0x01, 0x30, 0xC0,
+0x02, 0x50, 0x60, 0x70, 0x01, 0x70, 0xC0, 0x0F, 0x00, 0x30, 0x70, 0x80, 0xA0, 0xE0, 0xD0, 0xE0,
+0x20, 0xE0, 0xD1, 0x40, 0xB0, 0xA0, 0x30, 0x90, 0xD0, 0xA1, 0x0A, 0x10, 0x40, 0xD0, 0x40, 0xD0,
+0x23, 0xEF, 0x02, 0x20, 0xE3, 0xD0, 0x40, 0xA0, 0xB0, 0xF0, 0xA0, 0xD6, 0x40, 0xE0, 0xD0, 0xE0,
+0xD0, 0x20, 0xE1, 0x90, 0xE3, 0x21, 0xEB, 0xD0, 0xB0, 0x70, 0x0F, 0x0C, 0x70, 0xA0, 0x01, 0x50,
+0xF0, 0x00, 0x51, 0x01, 0xA0, 0x04, 0x10, 0x30, 0x03, 0x50, 0x70, 0x01, 0x30, 0x90, 0xD0, 0xE1,
+0xD0, 0xEF, 0x10, 0xD1, 0xE1, 0xD0, 0xE3, 0xD2, 0x91, 0xD0, 0xE4, 0xD2, 0xE0, 0xD0, 0xEC, 0xD0,
+0xE8, 0xD0, 0xE0, 0xD1, 0xA0, 0x70, 0x50, 0x05, 0x30, 0xF0, 0x30, 0x40, 0xD0, 0xE3, 0xD0, 0xE1,
+0x20, 0xE1, 0xD0, 0xA0, 0x90, 0x20, 0xEF, 0x0F, 0xD1, 0x91, 0xE0, 0xD0, 0xE2, 0xD1, 0xE3, 0xD7,
+0xE9, 0xD0, 0xE0, 0xD1, 0xE0, 0xA0, 0x00, 0x60, 0x50, 0x70, 0x00, 0xC0, 0x30, 0x01, 0x30, 0x80,
+0x90, 0x50, 0x80, 0x42, 0x30, 0x80, 0x60, 0xD3, 0x30, 0xA0, 0x31, 0x60, 0x40, 0x10, 0xC0, 0x00,
+0x60, 0xF0, 0x30, 0x80, 0x10, 0xA0, 0x02, 0x80, 0x30, 0x01, 0x70, 0xA0, 0x10, 0xF0, 0x03, 0x70,
+0x80, 0x00, 0x60, 0x70, 0x00, 0x70, 0x60, 0xA0, 0x80, 0x70, 0xC0, 0x0F, 0x00, 0x70, 0x10, 0x30,
+0xD1, 0xE0, 0x21, 0xE1, 0xD5, 0xE0, 0xD0, 0x60, 0x50, 0x09, 0x70, 0xA0, 0xD0, 0x40, 0xD0, 0xE1,
+0xD3, 0xED, 0xD0, 0xE0, 0xD0, 0xE3, 0xD3, 0xE0, 0x40, 0xD1, 0x90, 0xB0, 0xD1, 0xE0, 0xD2, 0xE4,
+0x90, 0xE0, 0xD1, 0xE2, 0xD3, 0xE2, 0x20, 0xE2, 0xD1, 0x30, 0xC0, 0x0F, 0x0C, 0xC0, 0x30, 0x01,
+0x70, 0xA1, 0x50, 0x60, 0x50, 0x80, 0xA0, 0x04, 0x30, 0x50, 0x10, 0x30, 0xC0, 0x00, 0x80, 0xF0,
+0xA1, 0xF0, 0x9F, 0x22, 0x40, 0x9F, 0x15, 0x40, 0xA0, 0xC5, 0x70, 0xA0, 0x70, 0xA0, 0x80, 0x90,
+0x60, 0x9A, 0x40, 0x9F, 0x13, 0x40, 0x9F, 0x11, 0xE0, 0xA0, 0x30, 0x70, 0xA0, 0x50, 0x60, 0xC3,
+0x80, 0x30, 0xD0, 0xB0, 0xA0, 0x30, 0x81, 0x90, 0x40, 0x80, 0x30, 0x93, 0xE0, 0x90, 0xA0, 0x60,
+0xE0, 0x91, 0x10, 0x80, 0x60, 0xF0, 0x60, 0x80, 0xA0, 0x10, 0x70, 0xC0, 0x00, 0x70, 0x81, 0x70,
+0x60, 0x50, 0x30, 0x80, 0x00, 0xC2, 0x30, 0x50, 0xC0, 0x70, 0x80, 0xC1, 0x01, 0x30, 0x80, 0xC1,
+0x70, 0xC7, 0x70, 0xC3, 0x80, 0xA1, 0xE0, 0x98, 0xE0, 0x94, 0xD0, 0xA0, 0x50, 0xC2, 0x81, 0xC3,
+0x00, 0xA0, 0x50, 0x40, 0x9F, 0x14, 0x40, 0xB0, 0x91, 0xE0, 0x97, 0x40, 0x9F, 0x02, 0xE0, 0x30,
+0x70, 0xCF, 0x0C, 0x70, 0x10, 0xA1, 0xF0, 0x71, 0x32, 0x50, 0x05, 0xA0, 0x01, 0x80, 0x60, 0xF0,
+0xA0, 0xF3, 0x9F, 0x21, 0x41, 0x9F, 0x15, 0xA0, 0x74, 0xC0, 0x50, 0x60, 0x70, 0xA0, 0x30, 0x80,
+0x10, 0x31, 0xE0, 0x98, 0xB1, 0x40, 0x9F, 0x11, 0x41, 0x9F, 0x11, 0x80, 0x30, 0x50, 0x30, 0xC0,
+0x50, 0xC1, 0x70, 0xC0, 0x80, 0xB0, 0xA0, 0x40, 0x30, 0x82, 0x41, 0xF0, 0xB0, 0x94, 0x40, 0x60,
+0xB0, 0x91, 0xE0, 0x61, 0x80, 0xF0, 0xA0, 0x60, 0xA0, 0x30, 0xF1, 0xA1, 0x41, 0xB0, 0xA1, 0x50,
+0xA0, 0x80, 0xC1, 0x81, 0xC0, 0x70, 0xC0, 0x80, 0x50, 0x72, 0xC0, 0x80, 0x30, 0xF0, 0xA0, 0x30,
+0x70, 0xC1, 0x71, 0xC0, 0x30, 0xA0, 0x30, 0x50, 0x30, 0xA0, 0x40, 0x9F, 0x04, 0xA0, 0x50, 0xC0,
+0x76, 0xC0, 0x81, 0x40, 0x9F, 0x21, 0x40, 0x9F, 0x03, 0x30, 0xC0, 0x7F, 0x0D, 0x10, 0xF1, 0x10,
+0x71, 0x80, 0x31, 0x50, 0x05, 0x30, 0x04, 0x80, 0x70, 0x01, 0x30, 0xE0, 0xD0, 0xE0, 0xD0, 0xEF,
+0x1A, 0xD0, 0xE0, 0xD0, 0x91, 0xD0, 0xE4, 0xD3, 0xE7, 0xD2, 0xE4, 0xD0, 0xE0, 0xD2, 0xE0, 0xD0,
+0xE1, 0xD0, 0x40, 0xA0, 0x06, 0x30, 0x80, 0xA0, 0x71, 0x50, 0x60, 0xA0, 0xB0, 0xD0, 0xE5, 0xD1,
+0xB1, 0xD1, 0xEF, 0x0F, 0xD0, 0x91, 0xE0, 0xD0, 0xEF, 0x04, 0xD0, 0xE1, 0xD2, 0xE1, 0xD0, 0xE0,
+0xD0, 0x90, 0xB0, 0x30, 0x50, 0x02, 0xC0, 0x01, 0x60, 0x90, 0xB0, 0x40, 0x50, 0x80, 0x42, 0x90,
+0x40, 0xD2, 0xB0, 0x60, 0x30, 0xF1, 0xD1, 0xE0, 0xD0, 0x90, 0xA0, 0x30, 0x10, 0x40, 0xF0, 0x60,
+0x80, 0x61, 0x90, 0x40, 0xD1, 0x60, 0xF0, 0xB0, 0xD0, 0x60, 0xA0, 0x00, 0x70, 0xF0, 0x09, 0x80,
+0x10, 0x80, 0x70, 0xB0, 0xA0, 0xC1, 0x01, 0x70, 0x10, 0xF0, 0x31, 0x40, 0xD2, 0xE2, 0xD1, 0xE0,
+0xD1, 0xE6, 0xD0, 0xE0, 0xD1, 0xE0, 0xA1, 0x07, 0x70, 0x60, 0x90, 0xD3, 0xEF, 0x07, 0xD0, 0xE4,
+0xD0, 0xE0, 0xD0, 0xE1, 0xD0, 0xE1, 0xD0, 0xE4, 0xD1, 0x90, 0xE0, 0xD2, 0xE2, 0xD0, 0xE4, 0xD0,
+0xE0, 0xD0, 0xE0, 0xD0, 0x40, 0x80, 0x0F, 0x0D, 0x70, 0xA0, 0x01, 0x50, 0xA1, 0x52, 0x31, 0x04,
+0x05, 0x80, 0x70, 0x01, 0x30, 0xE3, 0x20, 0xEF, 0x1C, 0x91, 0xD0, 0xEF, 0x07, 0x22, 0xE0, 0x20,
+0xE2, 0x20, 0xE1, 0xD0, 0xA0, 0xC0, 0x05, 0xC0, 0x80, 0x30, 0xF0, 0x70, 0x50, 0x00, 0x80, 0xB0,
+0x90, 0xD0, 0xE0, 0x20, 0xE4, 0xD0, 0x60, 0xB0, 0xD0, 0xEF, 0x11, 0x91, 0xD0, 0xE0, 0x20, 0xE4,
+0x20, 0xEC, 0x20, 0xE3, 0x20, 0xE1, 0x21, 0xE0, 0x40, 0xA0, 0x60, 0xA0, 0x03, 0xC0, 0xF0, 0x80,
+0x90, 0x40, 0xD0, 0x90, 0x50, 0x91, 0xD1, 0x40, 0x80, 0xE0, 0xD0, 0xB0, 0x60, 0x50, 0x30, 0x40,
+0xD1, 0x20, 0xE0, 0xD0, 0xE0, 0x30, 0x10, 0xD0, 0x51, 0xD0, 0xF0, 0xE0, 0xD1, 0xE0, 0xD0, 0x41,
+0xD0, 0xE0, 0x60, 0x50, 0x00, 0xA0, 0x50, 0x60, 0x80, 0x50, 0x70, 0xC0, 0x04, 0x30, 0xF0, 0x40,
+0xD1, 0x40, 0xA2, 0x61, 0xD0, 0x60, 0xA0, 0xD2, 0xE0, 0xD0, 0xE1, 0xD0, 0xE0, 0x20, 0xD0, 0x20,
+0xE1, 0x22, 0xE3, 0xD0, 0xE0, 0x20, 0xD1, 0xB0, 0xF0, 0xC0, 0x03, 0x30, 0x01, 0x30, 0x80, 0x90,
+0xE0, 0xD0, 0x20, 0xE0, 0x20, 0xEF, 0x04, 0x21, 0xE9, 0x21, 0xE2, 0x23, 0xE1, 0x90, 0xEC, 0x20,
+0xE0, 0x20, 0xD1, 0xA0, 0xC0, 0x0F, 0x0D, 0x70, 0x30, 0x01, 0x70, 0xF0, 0x04, 0xA0, 0xC0, 0x03,
+0xA0, 0x10, 0xF0, 0xC0, 0x00, 0x80, 0xA1, 0x31, 0x60, 0xD1, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE0,
+0x20, 0xE0, 0x91, 0xEE, 0x22, 0xE3, 0x27, 0xE1, 0xD2, 0x40, 0x10, 0x06, 0x80, 0x50, 0x00, 0xC0,
+0x00, 0x50, 0x00, 0x80, 0xB0, 0xD0, 0x90, 0xE1, 0x22, 0xE1, 0xD0, 0x60, 0xB0, 0xD0, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xD0, 0xE0,
+0x22, 0xE1, 0x22, 0xE3, 0x20, 0xE0, 0x20, 0xE7, 0x21, 0xE1, 0x23, 0xE0, 0xD0, 0xC0, 0xA0, 0x80,
+0xA2, 0xF0, 0x50, 0x91, 0x40, 0x80, 0x30, 0xA0, 0xB0, 0x60, 0xA0, 0xF1, 0x50, 0x60, 0xB0, 0x40,
+0xD0, 0xB0, 0xA0, 0xE5, 0xD2, 0xF0, 0x11, 0xF0, 0xD1, 0xE0, 0x21, 0xE2, 0xD0, 0x90, 0xA0, 0x61,
+0xC0, 0x30, 0x50, 0xC0, 0x50, 0x81, 0x60, 0x80, 0x00, 0x80, 0x60, 0xA0, 0x30, 0xF0, 0xB0, 0xE0,
+0xD5, 0xE0, 0x30, 0x70, 0x60, 0x30, 0xA1, 0xB0, 0x90, 0xD0, 0xE1, 0x21, 0xE2, 0x23, 0xE1, 0xD0,
+0xE1, 0x21, 0xE0, 0xD1, 0xF0, 0xC0, 0x05, 0xA0, 0x60, 0x10, 0xA0, 0xB0, 0xD0, 0xE0, 0x22, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x27, 0xE3, 0x22, 0xE1,
+0x28, 0xE0, 0xD0, 0x40, 0xE2, 0x22, 0xE2, 0x25, 0xE1, 0x90, 0x30, 0x0F, 0x0E, 0x70, 0xF0, 0x31,
+0x60, 0xA0, 0x30, 0x70, 0xC1, 0x80, 0x60, 0x04, 0x30, 0x00, 0xC0, 0x10, 0xC0, 0x80, 0xA0, 0x70,
+0x01, 0x30, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x2F, 0x1B, 0xE0, 0x91, 0xE0, 0x2F, 0x0C, 0xE0, 0xD1,
+0x40, 0x60, 0xB0, 0x10, 0x50, 0x06, 0xA0, 0x03, 0x50, 0x00, 0x50, 0xA0, 0xD0, 0x41, 0xE1, 0x21,
+0xE2, 0xA0, 0xD0, 0xE0, 0x2F, 0x10, 0xE1, 0x90, 0xD0, 0x23, 0xE0, 0x2F, 0x00, 0xE0, 0x20, 0xE0,
+0x27, 0xE1, 0xD0, 0x40, 0x10, 0x72, 0x50, 0x80, 0x30, 0xA0, 0x81, 0xC0, 0x00, 0x80, 0x00, 0xC0,
+0x50, 0x30, 0x00, 0x30, 0x80, 0x40, 0xD0, 0x40, 0xB0, 0xD0, 0x22, 0xE5, 0x91, 0xD0, 0x21, 0xE0,
+0xD0, 0x21, 0xE2, 0x90, 0x30, 0x01, 0xF0, 0xC0, 0x05, 0x30, 0xA1, 0x80, 0x70, 0x01, 0x30, 0xF0,
+0x30, 0x90, 0xB0, 0xD0, 0xE0, 0xD0, 0xB0, 0x50, 0x01, 0x70, 0x01, 0xD0, 0x60, 0xD0, 0x23, 0xE1,
+0x24, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0xD1, 0xF0, 0x50, 0x04, 0xA0, 0x30, 0xA0, 0x00, 0x60, 0x10,
+0xD0, 0x2F, 0x03, 0xE9, 0x21, 0xE0, 0x29, 0xE0, 0xD0, 0x40, 0xE2, 0x22, 0xE1, 0x26, 0xE0, 0xD0,
+0xA0, 0x0F, 0x0F, 0x70, 0xA0, 0x01, 0x50, 0x70, 0x50, 0xA0, 0x61, 0x80, 0x05, 0x30, 0x01, 0xC0,
+0x60, 0x30, 0xA0, 0x70, 0x01, 0x30, 0x90, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0x21, 0xE1, 0x90, 0xE0, 0x2A,
+0xE2, 0x2B, 0xE1, 0xD0, 0xF0, 0xA0, 0xF0, 0x80, 0x30, 0xC0, 0x07, 0x30, 0x80, 0x02, 0x50, 0x01,
+0x50, 0xA0, 0xE0, 0xD0, 0xE0, 0x90, 0x22, 0xD0, 0xB0, 0xA0, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x20, 0x40, 0xD0, 0xE0, 0x22,
+0xE1, 0x22, 0xE3, 0x22, 0xE5, 0x20, 0xE1, 0x20, 0xE1, 0x23, 0xD2, 0xA0, 0xC0, 0x60, 0x30, 0xA0,
+0x30, 0xA0, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x81, 0x00, 0x70, 0xA0, 0xD0, 0x40, 0x91, 0xE0,
+0x21, 0xE4, 0x20, 0xE0, 0xD1, 0x21, 0xE0, 0x21, 0xE0, 0xD3, 0x40, 0x30, 0x10, 0x00, 0x50, 0xA0,
+0x09, 0x50, 0x03, 0xA0, 0x11, 0x90, 0xD0, 0x40, 0x10, 0xC0, 0x05, 0xA0, 0xD0, 0xE0, 0x22, 0xE8,
+0x24, 0xE3, 0xD0, 0x30, 0xA0, 0xC0, 0x02, 0xA0, 0x50, 0x60, 0x00, 0xC0, 0xA0, 0xB0, 0xE1, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xEF, 0x03, 0x20, 0xE5,
+0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0x24, 0xE1, 0xD0, 0x60, 0x0F, 0x0F, 0x70, 0x30, 0x01,
+0x50, 0x70, 0x03, 0xC1, 0x04, 0xA0, 0x30, 0x01, 0x50, 0x10, 0x30, 0x50, 0x00, 0xC0, 0x30, 0x90,
+0xE0, 0x2F, 0x1B, 0xE0, 0x20, 0xE2, 0x40, 0xE0, 0x2F, 0x08, 0xE0, 0xD1, 0x40, 0xF0, 0x71, 0x60,
+0x0B, 0x30, 0x80, 0x01, 0x50, 0x02, 0xC0, 0xA0, 0xB0, 0x91, 0xE1, 0x20, 0xD0, 0x60, 0x40, 0xD0,
+0xE0, 0x2F, 0x10, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x2E, 0xE0, 0x20, 0x60, 0x90, 0xE1, 0x21,
+0xE0, 0x21, 0xE0, 0xD1, 0x30, 0x50, 0xC0, 0x50, 0xC0, 0x70, 0xF0, 0x02, 0x50, 0x02, 0x50, 0x01,
+0x70, 0x80, 0x00, 0x50, 0xF0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE4, 0xD0, 0xE0, 0xD1, 0xE1,
+0x22, 0xE0, 0xD0, 0x90, 0xA0, 0x62, 0x70, 0xC0, 0x00, 0xC0, 0xA0, 0x09, 0x50, 0x04, 0x60, 0xF0,
+0xA0, 0xB0, 0x10, 0x50, 0x06, 0xA0, 0xD0, 0xE1, 0x22, 0xE1, 0x25, 0xE0, 0x20, 0xE1, 0x23, 0xE1,
+0xD0, 0x90, 0x60, 0x50, 0x01, 0xA0, 0x50, 0x60, 0x50, 0x01, 0xA0, 0xD0, 0xE0, 0x2F, 0x0F, 0xE0,
+0x24, 0xE3, 0xD0, 0x40, 0xE0, 0x24, 0xE1, 0x25, 0xE0, 0xD0, 0x90, 0x30, 0x0F, 0x0F, 0x50, 0xA0,
+0x01, 0x80, 0x70, 0x02, 0x70, 0x80, 0x30, 0xC0, 0x03, 0x05, 0x50, 0x60, 0x30, 0x80, 0xA0, 0x40,
+0xD0, 0x23, 0xEF, 0x0F, 0x27, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0x20, 0xE0, 0x2A, 0xE0, 0x22, 0xE7,
+0xD0, 0xB0, 0x10, 0x70, 0x01, 0x30, 0x70, 0x0B, 0x60, 0x01, 0x70, 0xC0, 0x02, 0xF0, 0x70, 0xA0,
+0x40, 0xD0, 0xE0, 0xD0, 0xA0, 0x40, 0xD0, 0xEF, 0x03, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xEA, 0xD0,
+0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x23, 0xE9, 0x20, 0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xD1, 0xA0,
+0x30, 0x80, 0x50, 0x70, 0x02, 0xA0, 0x01, 0xC0, 0x50, 0x02, 0x50, 0x01, 0xA0, 0x50, 0x00, 0x10,
+0xB0, 0xD3, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0xD1, 0xA1, 0x60, 0x40, 0x90, 0xE0, 0xD3, 0x90, 0xF0,
+0x40, 0xA0, 0xF0, 0x03, 0x60, 0x0A, 0x50, 0x05, 0x80, 0x31, 0x07, 0x80, 0x10, 0xD0, 0xE2, 0x21,
+0xE1, 0x26, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xD1, 0x10, 0xC0, 0x00, 0x30, 0x50, 0x70, 0xA0,
+0x00, 0x41, 0xD0, 0xEF, 0x04, 0x2B, 0xE1, 0x22, 0xE4, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x22, 0xE2,
+0x23, 0xE1, 0xD0, 0xB0, 0x50, 0x0F, 0x0F, 0x50, 0x60, 0x80, 0x30, 0xF0, 0xC0, 0x02, 0x70, 0x31,
+0xC0, 0x03, 0x05, 0x70, 0x50, 0x01, 0x50, 0x40, 0xE0, 0x2F, 0x09, 0xE1, 0x29, 0xE0, 0x22, 0xE1,
+0x20, 0xE2, 0xD0, 0x40, 0xE0, 0x20, 0xE3, 0x2C, 0xE3, 0x20, 0xE1, 0xD0, 0xA0, 0x03, 0x70, 0x30,
+0x0B, 0x30, 0x71, 0x50, 0xC0, 0x03, 0xA0, 0x10, 0xA0, 0xD1, 0x60, 0x90, 0xD0, 0xB0, 0x90, 0xE5,
+0x20, 0xE9, 0x21, 0xE0, 0x24, 0xE3, 0xD2, 0xE0, 0x91, 0x40, 0xE0, 0x22, 0xE4, 0x23, 0xE4, 0x20,
+0xE0, 0x20, 0xE5, 0x22, 0xE0, 0xD0, 0x60, 0x70, 0x50, 0x70, 0x04, 0xA0, 0x01, 0x50, 0x03, 0x50,
+0x01, 0xA0, 0xC0, 0x50, 0x70, 0xF0, 0x60, 0x80, 0x30, 0x40, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xA0,
+0x70, 0x00, 0xC0, 0x80, 0x30, 0xF0, 0xA4, 0x02, 0x10, 0x01, 0xF0, 0xA0, 0x70, 0x09, 0xC0, 0x50,
+0xC1, 0x0E, 0x60, 0x90, 0xD0, 0xE2, 0x21, 0xE1, 0x28, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0xD0, 0xE0,
+0x60, 0x31, 0x40, 0x90, 0x40, 0xA1, 0xD7, 0xE5, 0x24, 0xE5, 0x23, 0xE1, 0x28, 0xE1, 0x20, 0xE0,
+0xD0, 0x40, 0xE1, 0x23, 0xE2, 0x23, 0xE0, 0x20, 0xD0, 0x60, 0x0F, 0x10, 0x81, 0x01, 0x30, 0x04,
+0xC1, 0x04, 0x05, 0xC0, 0x80, 0x01, 0x50, 0xB0, 0xD0, 0x21, 0xE0, 0x2D, 0xE4, 0x24, 0xE0, 0x23,
+0xE2, 0x21, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x23, 0xE0, 0x25, 0xEB, 0xD0, 0xB0,
+0x30, 0x03, 0x70, 0xA0, 0x00, 0xC1, 0x73, 0x53, 0x70, 0x80, 0x30, 0xC0, 0x71, 0x05, 0x61, 0xD2,
+0xE0, 0x40, 0xE1, 0x27, 0xE1, 0x25, 0xE1, 0x20, 0xE6, 0x20, 0x92, 0x41, 0x91, 0x40, 0x90, 0x22,
+0xE4, 0x24, 0xE3, 0x21, 0xE4, 0x24, 0xD0, 0x40, 0x30, 0x70, 0x05, 0x70, 0x30, 0x80, 0x71, 0x03,
+0x50, 0x01, 0xC0, 0xA0, 0x70, 0x00, 0x50, 0x30, 0x50, 0x70, 0x80, 0x60, 0xD2, 0x40, 0x80, 0xB0,
+0x04, 0xA0, 0x05, 0x80, 0x00, 0x30, 0xF0, 0x00, 0xF0, 0x0B, 0x73, 0x51, 0x70, 0xC2, 0x08, 0x30,
+0x90, 0xD0, 0x20, 0xE0, 0x21, 0xE2, 0x25, 0xE1, 0x26, 0xE0, 0x20, 0xE1, 0xD1, 0x90, 0x40, 0x92,
+0x46, 0x94, 0xE1, 0x20, 0xEF, 0x05, 0x28, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0x22, 0xE0, 0x20,
+0xD0, 0xA0, 0x30, 0x0F, 0x10, 0x30, 0x50, 0x01, 0x30, 0x0B, 0x05, 0xC0, 0x60, 0x31, 0x60, 0xB0,
+0xD0, 0x20, 0xE1, 0x2F, 0x01, 0xE6, 0x20, 0xE4, 0x23, 0xE1, 0x21, 0xE3, 0x20, 0xE0, 0xD0, 0x40,
+0x29, 0xE3, 0xD4, 0xE4, 0x91, 0x40, 0x30, 0x80, 0x52, 0x70, 0x80, 0xA0, 0x71, 0xC2, 0x06, 0x80,
+0x30, 0xC0, 0x70, 0x05, 0xA0, 0xF0, 0x60, 0xB1, 0xD0, 0xE4, 0x2D, 0xD2, 0xE2, 0x91, 0x41, 0x92,
+0xE1, 0xD0, 0xE0, 0xD0, 0x91, 0xE0, 0x24, 0xE1, 0x28, 0xE0, 0x21, 0xD0, 0xE4, 0x20, 0xE0, 0xD0,
+0x90, 0xB0, 0xC0, 0x04, 0x50, 0x60, 0x81, 0x70, 0x50, 0x04, 0x50, 0x02, 0x70, 0x30, 0x80, 0x30,
+0x03, 0x70, 0x60, 0x30, 0xB0, 0x50, 0x70, 0x30, 0xC0, 0x03, 0x30, 0x05, 0x50, 0x01, 0x61, 0xF0,
+0x60, 0x70, 0x09, 0x50, 0x04, 0xC1, 0x71, 0x51, 0x70, 0xC0, 0x04, 0xB1, 0xD0, 0x23, 0xE6, 0x2B,
+0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE5, 0xD0, 0xE0, 0x21, 0xE0, 0x95, 0x44, 0x92, 0xE7, 0xD2, 0xEC,
+0xD0, 0x40, 0xD0, 0xE1, 0x22, 0xE2, 0x24, 0xD0, 0x60, 0x0F, 0x11, 0x30, 0x60, 0x31, 0xF0, 0x0B,
+0x05, 0xC0, 0x30, 0x01, 0x70, 0xB0, 0xD0, 0x20, 0xE0, 0x2C, 0xE0, 0x20, 0xE4, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE2, 0x22, 0xE5, 0x21, 0xE5, 0xD0, 0x40, 0xE8, 0xD0, 0xE2, 0x91, 0x48, 0x91, 0x80,
+0x10, 0x80, 0x04, 0xA0, 0x0C, 0x50, 0x60, 0x70, 0x06, 0x11, 0xA0, 0xE4, 0x22, 0xE0, 0x23, 0xE5,
+0x20, 0xE0, 0x90, 0x43, 0x91, 0xE0, 0xD3, 0xE4, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21,
+0xE1, 0x29, 0xE1, 0xB0, 0xD2, 0xE0, 0xD1, 0x90, 0x40, 0xD0, 0xA0, 0xC0, 0x03, 0x70, 0xF0, 0x70,
+0x01, 0x50, 0xC0, 0x04, 0x50, 0x03, 0x31, 0xC0, 0x05, 0xC0, 0x50, 0xA0, 0xF0, 0x80, 0x70, 0x50,
+0xC0, 0x01, 0xA0, 0x09, 0xA0, 0x30, 0x70, 0x60, 0x50, 0x08, 0x50, 0x0A, 0xC0, 0x70, 0x54, 0x30,
+0xD1, 0xE1, 0x20, 0xE4, 0x21, 0xE3, 0x28, 0xE1, 0x22, 0xD0, 0x40, 0xD0, 0x28, 0xE2, 0xD6, 0xE2,
+0x93, 0x47, 0x91, 0xE0, 0x20, 0xE5, 0xD0, 0xE3, 0x40, 0xD0, 0xE2, 0x21, 0xE6, 0xD0, 0x40, 0xB0,
+0x0F, 0x11, 0x30, 0x70, 0x01, 0xA0, 0x0B, 0x05, 0xC0, 0x80, 0x01, 0xC0, 0x30, 0xD0, 0x20, 0xE2,
+0x20, 0xE0, 0x20, 0xE6, 0x2F, 0x01, 0xE0, 0x25, 0xE3, 0xD5, 0x40, 0x95, 0x45, 0x91, 0xE2, 0xD0,
+0xE0, 0xD1, 0xE1, 0xD0, 0x40, 0xA0, 0x10, 0x80, 0x05, 0x80, 0x60, 0x0A, 0xC0, 0x60, 0x00, 0x50,
+0x06, 0xC0, 0x60, 0xD0, 0xE1, 0x22, 0xE6, 0xD0, 0xE1, 0x91, 0x43, 0x90, 0xE0, 0xD0, 0xEA, 0x21,
+0xE2, 0x40, 0xD0, 0x22, 0xE3, 0x29, 0xE0, 0x40, 0xA0, 0x60, 0xA0, 0xD1, 0x10, 0x40, 0x90, 0xD0,
+0x30, 0x80, 0x01, 0x50, 0x80, 0x31, 0x03, 0x50, 0x05, 0x50, 0x03, 0x80, 0xA0, 0x50, 0x0C, 0x51,
+0x00, 0x51, 0x09, 0x60, 0xD1, 0xA0, 0x30, 0x07, 0x50, 0x0F, 0x01, 0x50, 0x30, 0x43, 0x91, 0xE0,
+0xD2, 0xE4, 0x22, 0xE1, 0x23, 0xE2, 0x21, 0xE1, 0x40, 0xE2, 0x22, 0xE7, 0x23, 0xEF, 0x00, 0x21,
+0x91, 0x46, 0x94, 0x40, 0xE1, 0xD1, 0xE1, 0xD1, 0xE4, 0x40, 0x10, 0x70, 0x0F, 0x11, 0xA0, 0xC0,
+0x01, 0x30, 0x0B, 0x05, 0xC0, 0x30, 0x00, 0xC0, 0x50, 0x30, 0xD0, 0x21, 0xEB, 0x20, 0xEF, 0x04,
+0x23, 0x93, 0x45, 0x93, 0xE5, 0xD2, 0xE5, 0x21, 0xE1, 0xD0, 0x30, 0x50, 0xF0, 0x06, 0x30, 0x60,
+0xC0, 0x09, 0x30, 0xC0, 0x00, 0x50, 0x03, 0x50, 0x70, 0x00, 0xA1, 0xD0, 0xE1, 0x20, 0xE4, 0x20,
+0xE0, 0x91, 0x41, 0x92, 0xE2, 0xD1, 0xE3, 0x21, 0xE1, 0x21, 0xE0, 0x23, 0xE2, 0x91, 0xE5, 0x22,
+0xE1, 0x21, 0xE0, 0x21, 0xE1, 0x42, 0xA0, 0xB0, 0xA0, 0x42, 0xA0, 0x80, 0x00, 0x70, 0xA0, 0x80,
+0x50, 0xC0, 0x03, 0x50, 0x06, 0x50, 0x03, 0x80, 0x50, 0x00, 0x50, 0x0C, 0xC0, 0x51, 0x80, 0x09,
+0xC0, 0x60, 0xD1, 0xA0, 0x80, 0x05, 0xC0, 0x70, 0x0F, 0x00, 0x70, 0x60, 0x40, 0xD1, 0xE1, 0x91,
+0x42, 0x91, 0xE0, 0x20, 0xE9, 0x21, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE3,
+0x2F, 0x07, 0xE4, 0xD2, 0xE5, 0x91, 0x45, 0x94, 0x20, 0xE0, 0x20, 0xE1, 0xA0, 0xC0, 0x0F, 0x11,
+0xA0, 0x70, 0xC1, 0xA0, 0x0B, 0x06, 0x60, 0x82, 0x30, 0xD0, 0x20, 0xE9, 0x21, 0xE5, 0xD2, 0xE4,
+0x92, 0x46, 0x94, 0xE2, 0xD2, 0x90, 0xEE, 0x23, 0xE1, 0x21, 0xD0, 0x60, 0x00, 0xA0, 0x01, 0xA0,
+0x30, 0x70, 0x00, 0x50, 0x60, 0x51, 0x09, 0xA0, 0x01, 0x50, 0x03, 0x10, 0x50, 0x00, 0xF0, 0xA0,
+0xD1, 0xE0, 0xD0, 0xE0, 0x90, 0x43, 0x91, 0xE1, 0xD2, 0xE4, 0x25, 0xE0, 0x28, 0xE3, 0x90, 0xD0,
+0xE0, 0x20, 0xE1, 0x23, 0xE2, 0x21, 0xE0, 0x21, 0xE1, 0xD1, 0x41, 0xD0, 0x30, 0x10, 0x60, 0x50,
+0x01, 0xA0, 0x06, 0xC0, 0x70, 0x06, 0x50, 0x04, 0xA0, 0x00, 0x50, 0x0E, 0xC0, 0x30, 0xC0, 0x09,
+0x70, 0xA0, 0xD1, 0xA0, 0x60, 0x70, 0x03, 0x50, 0x0F, 0x01, 0x50, 0xB0, 0xD0, 0x20, 0xE1, 0xD0,
+0xE1, 0xD0, 0xE1, 0x92, 0x42, 0x91, 0xE5, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE5,
+0x2D, 0xE4, 0x24, 0xEF, 0x00, 0x91, 0xE3, 0x20, 0xE1, 0x93, 0x42, 0x30, 0x51, 0x71, 0xC0, 0x0F,
+0x0D, 0xA0, 0x81, 0x30, 0x60, 0x0B, 0x06, 0x30, 0x02, 0xA0, 0xD0, 0x20, 0xD0, 0xE8, 0xD0, 0xE1,
+0x20, 0xE0, 0x92, 0x47, 0x92, 0xE2, 0xD7, 0xE2, 0x20, 0xE2, 0x91, 0xE0, 0x27, 0xE1, 0x2A, 0x40,
+0xF0, 0x00, 0x81, 0x60, 0x50, 0x00, 0x80, 0x30, 0x50, 0x00, 0x51, 0x05, 0x50, 0x02, 0x60, 0x01,
+0x50, 0x03, 0x50, 0x02, 0xA0, 0x30, 0x42, 0x91, 0xE1, 0xD2, 0xE4, 0x20, 0xE0, 0x2F, 0x03, 0xE4,
+0x40, 0xE3, 0x24, 0xE2, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xB0, 0xA0, 0x00,
+0xC0, 0x50, 0x80, 0x30, 0x60, 0x06, 0x50, 0x07, 0x50, 0x04, 0xA0, 0x01, 0x50, 0x0E, 0x30, 0x70,
+0x50, 0x09, 0x50, 0x60, 0xD2, 0x60, 0x70, 0x02, 0x50, 0x0F, 0x00, 0x50, 0x60, 0x90, 0xE0, 0x20,
+0xE0, 0x20, 0xE2, 0x20, 0xE2, 0xD2, 0xE1, 0x91, 0x43, 0x91, 0xE5, 0xD0, 0x91, 0xE2, 0x21, 0xE0,
+0x26, 0xE2, 0x26, 0xE4, 0x25, 0xE5, 0x22, 0xE5, 0x91, 0xE2, 0x20, 0xE6, 0xD2, 0x30, 0x01, 0xC1,
+0x72, 0x56, 0x71, 0xC1, 0x0F, 0x00, 0xF0, 0x02, 0x30, 0x0B, 0x06, 0x30, 0x02, 0xA0, 0xD0, 0xE2,
+0x94, 0x46, 0x93, 0xEF, 0x0A, 0x20, 0xE1, 0x91, 0xE0, 0x2F, 0x00, 0xE0, 0x20, 0xE1, 0x20, 0x40,
+0x80, 0x00, 0xC0, 0x60, 0xC0, 0x06, 0xA0, 0x04, 0x50, 0x60, 0x80, 0x00, 0x60, 0x50, 0x01, 0x70,
+0xC0, 0x00, 0xC0, 0x72, 0x30, 0xA0, 0x50, 0xA0, 0x90, 0xEB, 0x27, 0xE0, 0x22, 0xE1, 0x22, 0xE0,
+0x21, 0xE6, 0xD0, 0x40, 0xE0, 0xD0, 0x26, 0xE4, 0x20, 0xE0, 0xD0, 0xE0, 0x41, 0xD1, 0xA0, 0x50,
+0x00, 0xC1, 0x02, 0x60, 0x80, 0x04, 0x70, 0xC0, 0x07, 0x50, 0x04, 0xA0, 0x01, 0x70, 0xC0, 0x0D,
+0x30, 0x01, 0x51, 0x05, 0x50, 0x01, 0xA0, 0x40, 0xD1, 0xE0, 0x60, 0x01, 0xC0, 0x70, 0x0E, 0x70,
+0xA0, 0xD0, 0xE0, 0x22, 0xE7, 0x24, 0xE2, 0xD1, 0xE1, 0x90, 0x42, 0x92, 0xE0, 0x91, 0xD1, 0xE2,
+0x20, 0xE2, 0x21, 0xE6, 0x24, 0xE0, 0x26, 0xE0, 0x22, 0xE2, 0x24, 0xE3, 0x20, 0xE0, 0x40, 0xEB,
+0xD1, 0x30, 0xC0, 0x0D, 0xC1, 0x71, 0x55, 0x73, 0xC1, 0x00, 0x60, 0x01, 0x10, 0x02, 0x30, 0x0B,
+0x06, 0xA0, 0x50, 0x81, 0x60, 0x42, 0x94, 0xE3, 0xD7, 0xEF, 0x01, 0x20, 0xEA, 0x91, 0xD0, 0xE0,
+0x26, 0xE0, 0x27, 0xE1, 0x21, 0xD0, 0xA0, 0x0A, 0xA0, 0x04, 0x60, 0xA0, 0x50, 0xF0, 0x30, 0x70,
+0xC0, 0x70, 0x50, 0x30, 0x50, 0x70, 0xC0, 0x00, 0x50, 0xA1, 0x00, 0x50, 0xB0, 0xD0, 0x22, 0xE4,
+0x2B, 0xE2, 0x21, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0xD0, 0x20, 0xE0, 0x90, 0x40, 0x90,
+0xD0, 0x25, 0xE0, 0x21, 0xE4, 0x90, 0x40, 0xE0, 0xD1, 0x40, 0xB0, 0x01, 0x80, 0x32, 0xA0, 0x51,
+0x30, 0x03, 0x50, 0x08, 0x50, 0x04, 0xA0, 0x02, 0x50, 0x0D, 0x80, 0x70, 0x01, 0xC0, 0x50, 0x70,
+0x03, 0x10, 0x02, 0xA0, 0x60, 0xE0, 0xD0, 0xA0, 0x70, 0x00, 0x51, 0x70, 0xC0, 0x0B, 0xC0, 0xA0,
+0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x2B, 0xE3, 0xD0, 0xE2, 0x91, 0x42, 0x92, 0xE0,
+0xD0, 0xEF, 0x00, 0x26, 0xE2, 0x20, 0xE2, 0x27, 0xE2, 0x21, 0xE0, 0x40, 0xE1, 0x21, 0xE3, 0x20,
+0xE2, 0xD0, 0x90, 0x10, 0x0F, 0x0A, 0xC2, 0x72, 0x60, 0x51, 0x10, 0x82, 0x30, 0x0B, 0x06, 0xA0,
+0x71, 0xC0, 0xA0, 0xD0, 0xE0, 0xD0, 0xEF, 0x02, 0x2F, 0x03, 0xE9, 0x90, 0xE1, 0x26, 0xE4, 0x26,
+0xE0, 0xD0, 0xB0, 0x50, 0x09, 0xA0, 0x03, 0x81, 0x30, 0x70, 0x80, 0xA0, 0x50, 0xC1, 0x00, 0xA0,
+0x30, 0x02, 0x30, 0xC0, 0x01, 0x70, 0x30, 0xD0, 0x21, 0xE0, 0x27, 0xE8, 0x22, 0xE0, 0x26, 0xE3,
+0x90, 0x40, 0x91, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x21, 0xE5, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0,
+0xE0, 0xD0, 0x40, 0x60, 0xC0, 0x01, 0x30, 0xC0, 0x01, 0xC0, 0x01, 0x50, 0x30, 0x01, 0x50, 0xC0,
+0x08, 0x50, 0x03, 0x70, 0x30, 0x02, 0x71, 0x0C, 0x51, 0x03, 0x70, 0x50, 0xC0, 0x00, 0xA0, 0xF0,
+0x00, 0x70, 0x31, 0xB0, 0xA0, 0xD0, 0xE0, 0x60, 0x70, 0x50, 0x00, 0xC0, 0x51, 0x70, 0x09, 0x70,
+0xA0, 0xD0, 0xE0, 0x20, 0xE1, 0x2C, 0xE3, 0x24, 0xE4, 0xD1, 0x40, 0x93, 0x42, 0x90, 0xE2, 0xD1,
+0xE3, 0x22, 0xE1, 0x29, 0xE2, 0x22, 0xE1, 0x28, 0xE0, 0x40, 0xE1, 0x21, 0xE2, 0x23, 0xE0, 0xD0,
+0xB0, 0x10, 0x0F, 0x10, 0x10, 0x01, 0xF0, 0x00, 0x70, 0x50, 0x80, 0x0B, 0x06, 0x30, 0x02, 0xA0,
+0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE4, 0x24, 0xE1, 0x2F, 0x08, 0xE5, 0x40, 0xD0, 0xE0,
+0x2C, 0xE1, 0x21, 0xE0, 0x21, 0xD0, 0x80, 0x50, 0x09, 0x81, 0x70, 0x51, 0x81, 0xC0, 0x01, 0x10,
+0x03, 0x51, 0x10, 0x30, 0x00, 0x50, 0x30, 0x01, 0x10, 0xA0, 0xD0, 0xE1, 0x26, 0xE9, 0x20, 0xE1,
+0x23, 0xE0, 0x20, 0xE2, 0xD0, 0x90, 0x41, 0x90, 0xE2, 0xD0, 0x91, 0xD0, 0xE7, 0xD0, 0x90, 0x40,
+0x90, 0xE2, 0xD1, 0x10, 0x03, 0xA0, 0x05, 0x30, 0x60, 0x10, 0x71, 0x09, 0x50, 0x04, 0x30, 0xC0,
+0x02, 0x50, 0x0C, 0xC0, 0x30, 0x05, 0x70, 0x80, 0x10, 0xA1, 0x80, 0xC0, 0x01, 0xA0, 0x90, 0xD0,
+0xE0, 0x30, 0xA0, 0x50, 0x02, 0xC0, 0x51, 0xC0, 0x06, 0xA0, 0x40, 0xE0, 0x20, 0xE2, 0x2A, 0xE2,
+0x21, 0xE0, 0x25, 0xE0, 0x22, 0xE1, 0x40, 0xD0, 0xE1, 0xD2, 0xE0, 0x92, 0x42, 0x90, 0x20, 0xE0,
+0xD1, 0xE5, 0x26, 0xE6, 0x2A, 0xE0, 0x40, 0xE1, 0x21, 0xE2, 0x23, 0xE0, 0xD0, 0xB0, 0x60, 0x0F,
+0x0F, 0xC0, 0x10, 0x01, 0xA0, 0x01, 0x70, 0x80, 0x0B, 0x06, 0x80, 0xC0, 0x00, 0xC0, 0xA0, 0xD0,
+0x20, 0xE2, 0x28, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE0, 0x2E, 0x40, 0xD0, 0xE2, 0x26, 0xE5, 0x22, 0xE0, 0x20, 0xD0, 0x40, 0x50,
+0x03, 0xC0, 0x70, 0x53, 0x70, 0x50, 0x60, 0xC0, 0x00, 0x70, 0x50, 0x02, 0x80, 0x70, 0x02, 0x30,
+0x00, 0x71, 0xA0, 0x30, 0xF0, 0xC0, 0x01, 0x30, 0x90, 0xE1, 0x2C, 0xE5, 0x24, 0xE0, 0xD0, 0xE0,
+0x90, 0x41, 0x90, 0xE0, 0x20, 0xE0, 0x20, 0xE3, 0x40, 0xD0, 0xE0, 0x22, 0xE3, 0x41, 0xD0, 0xE3,
+0xD0, 0x60, 0x03, 0x30, 0xA0, 0x05, 0x30, 0x01, 0x30, 0x50, 0x09, 0x50, 0x04, 0x70, 0xA0, 0x80,
+0x02, 0x50, 0x0C, 0xA0, 0x02, 0x70, 0x80, 0x31, 0xF0, 0x50, 0x70, 0x04, 0x70, 0x30, 0xD1, 0x40,
+0xD0, 0x60, 0x70, 0x01, 0xC0, 0x50, 0x00, 0x70, 0x50, 0x70, 0xC0, 0x02, 0xA0, 0xB0, 0xD0, 0xE0,
+0x20, 0xE0, 0xD0, 0xE1, 0x25, 0xE1, 0x2C, 0xE0, 0x21, 0xE3, 0x90, 0xE7, 0x20, 0xE1, 0xD0, 0xE0,
+0x90, 0x43, 0x91, 0xE1, 0xD0, 0xE0, 0xD0, 0xE7, 0x22, 0xE0, 0x20, 0xE1, 0x23, 0xE2, 0x21, 0xE0,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xD0, 0xB0, 0x50, 0x0F, 0x0F, 0x50,
+0xF0, 0x00, 0xC0, 0x30, 0x01, 0x51, 0x0B, 0x06, 0x50, 0xF0, 0x30, 0x80, 0xA0, 0x90, 0xE1, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0x20, 0xE0, 0x21, 0xED, 0x2D, 0xE0, 0x40, 0xE3, 0x28,
+0xE7, 0xD1, 0x40, 0x80, 0xC0, 0x70, 0x51, 0x70, 0xC0, 0x05, 0xC0, 0xA0, 0x00, 0x30, 0xC0, 0x03,
+0x61, 0x80, 0x30, 0x60, 0x04, 0xA0, 0x02, 0x50, 0xF0, 0xD1, 0xE0, 0x22, 0xE1, 0x2A, 0xE2, 0x21,
+0xE2, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x23, 0xE2, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0xD0, 0xE0,
+0x90, 0x40, 0xE2, 0x22, 0xD0, 0xA0, 0x70, 0x02, 0x30, 0x70, 0x06, 0x30, 0x00, 0xC1, 0x30, 0x80,
+0x08, 0x50, 0x05, 0xC0, 0x70, 0x30, 0xC0, 0x00, 0x70, 0xC0, 0x80, 0x50, 0xC0, 0x08, 0xA0, 0x80,
+0x30, 0xA0, 0x80, 0x70, 0xC0, 0x02, 0xC0, 0x50, 0x70, 0x03, 0xA0, 0x90, 0xE0, 0x90, 0xD1, 0xA0,
+0x80, 0x50, 0xA0, 0x70, 0x02, 0xC0, 0x70, 0x50, 0xC0, 0xA0, 0x40, 0xD0, 0xE1, 0xD0, 0x40, 0xA0,
+0xE3, 0x23, 0xE1, 0x2D, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE1, 0x23, 0xE1, 0x23, 0xE1, 0xD1,
+0xE2, 0x90, 0x42, 0x92, 0xE1, 0xD2, 0xE3, 0x28, 0xE4, 0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21,
+0xE3, 0x21, 0xE0, 0x90, 0xB0, 0x0F, 0x0A, 0x70, 0x80, 0x02, 0x80, 0x60, 0x00, 0x50, 0xA0, 0x80,
+0x30, 0x60, 0x70, 0x0B, 0x06, 0x70, 0x80, 0x01, 0x50, 0x40, 0x21, 0xE0, 0x23, 0xE0, 0x22, 0xE2,
+0x2F, 0x04, 0xE2, 0x21, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0x91, 0xE0, 0x26, 0xE3, 0xD2, 0xE2, 0x91,
+0x42, 0xB0, 0xC1, 0x0A, 0x80, 0x30, 0x80, 0x05, 0x50, 0x72, 0xC0, 0x03, 0x60, 0x01, 0x30, 0x10,
+0x80, 0x60, 0x90, 0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x90,
+0x41, 0x90, 0xD1, 0x25, 0xE4, 0x90, 0x40, 0xE3, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0xD0,
+0x90, 0x10, 0x30, 0x80, 0x50, 0x00, 0xA0, 0x07, 0x30, 0xC0, 0x50, 0x01, 0x50, 0x30, 0x07, 0x50,
+0x06, 0x80, 0x30, 0x80, 0x30, 0x80, 0xA0, 0x51, 0x31, 0x70, 0x06, 0x30, 0x50, 0x09, 0x70, 0x50,
+0xC0, 0x01, 0x70, 0x60, 0x30, 0xE0, 0xD0, 0xE0, 0xD0, 0x11, 0x50, 0x06, 0x30, 0x41, 0x90, 0xE0,
+0xD0, 0xE0, 0xF0, 0xA0, 0xD0, 0xE2, 0x2D, 0xE4, 0x20, 0xE1, 0x22, 0x90, 0xE1, 0x22, 0xE1, 0x21,
+0xE0, 0x20, 0xE9, 0xD0, 0xE1, 0x20, 0x91, 0x42, 0x91, 0xE2, 0xD2, 0xE1, 0x20, 0xE0, 0x20, 0xE6,
+0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x21, 0xE0, 0x90, 0x30, 0x0F, 0x07, 0xC0, 0x80, 0x30,
+0x11, 0x02, 0x30, 0xA0, 0x00, 0x30, 0x50, 0x01, 0x80, 0xC0, 0x0B, 0x06, 0xC0, 0x30, 0x01, 0x70,
+0xB0, 0x20, 0xE0, 0x20, 0xE7, 0x21, 0xE5, 0x25, 0xE1, 0x26, 0xE7, 0x21, 0xE1, 0x21, 0xD0, 0x91,
+0xE8, 0xD1, 0xE0, 0x90, 0x43, 0x91, 0xE0, 0xD1, 0x90, 0x30, 0x08, 0x51, 0x00, 0x70, 0x30, 0x60,
+0x0A, 0x50, 0x02, 0x81, 0x00, 0x81, 0xC0, 0x00, 0xC0, 0x10, 0xA0, 0xD1, 0x21, 0xE1, 0x20, 0xE1,
+0x23, 0xE4, 0x90, 0x41, 0x90, 0xE0, 0xD1, 0xE0, 0x27, 0xE1, 0x21, 0xD0, 0x40, 0xE0, 0xD0, 0xE0,
+0x41, 0xE0, 0xD0, 0x21, 0xE0, 0x21, 0xE1, 0x90, 0x60, 0x70, 0xC0, 0x80, 0x30, 0xA0, 0x07, 0x30,
+0x50, 0xC0, 0x02, 0x70, 0x60, 0x06, 0x50, 0x04, 0xC0, 0xA0, 0x70, 0x02, 0x50, 0x80, 0xC0, 0x02,
+0x80, 0xA0, 0x30, 0xC0, 0x03, 0x50, 0x70, 0x0B, 0x51, 0x01, 0xC0, 0xA1, 0xD1, 0xE0, 0xB0, 0xA0,
+0x70, 0x01, 0x50, 0x80, 0x01, 0x30, 0xA0, 0xD0, 0xE0, 0x90, 0x41, 0xB0, 0xE0, 0xD0, 0xE0, 0xD0,
+0xE4, 0x25, 0xEA, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xE2, 0x21, 0xE0, 0x20, 0xE5, 0x2A, 0xE2, 0xD1,
+0xE0, 0x92, 0x42, 0x91, 0xE0, 0xD1, 0xE8, 0x91, 0xE1, 0x23, 0xE3, 0x21, 0xE0, 0x90, 0x30, 0x0F,
+0x07, 0xA0, 0xB0, 0xA0, 0xC0, 0xF0, 0x50, 0x01, 0x60, 0x30, 0x00, 0xA0, 0x70, 0x01, 0x30, 0x0C,
+0x07, 0x60, 0x50, 0x80, 0x31, 0xD0, 0xE1, 0x25, 0xE9, 0x29, 0xE3, 0x21, 0xE4, 0x23, 0xE1, 0x20,
+0xE1, 0x91, 0xD0, 0xE0, 0xD2, 0xE0, 0x91, 0x43, 0x90, 0xE3, 0xD0, 0xE2, 0xD0, 0x90, 0x30, 0x07,
+0xA0, 0x80, 0x50, 0xA0, 0xF0, 0x60, 0x50, 0x0A, 0x50, 0x02, 0xA0, 0x01, 0x80, 0x70, 0x01, 0xC1,
+0xA0, 0x60, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE3, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0,
+0xD0, 0xE2, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0xD0, 0x42, 0xD1, 0xE3, 0x23, 0xE0,
+0xD0, 0x30, 0x80, 0x0B, 0x80, 0x50, 0x05, 0x60, 0x50, 0x04, 0x50, 0x03, 0x31, 0x05, 0x50, 0x30,
+0x05, 0x30, 0xA0, 0x80, 0xC0, 0x00, 0x30, 0x50, 0x0D, 0x51, 0x30, 0x00, 0x80, 0x40, 0xD2, 0x40,
+0xA0, 0x01, 0xC0, 0x10, 0x00, 0x30, 0xB0, 0xD2, 0xE0, 0xB0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0,
+0xE3, 0x24, 0xE1, 0x22, 0xE2, 0x20, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x22, 0xE7,
+0x2A, 0xEB, 0x90, 0x43, 0x91, 0xE1, 0xD3, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE2, 0x22, 0xD0, 0x90,
+0xB0, 0x0F, 0x06, 0x80, 0xB0, 0xD2, 0x60, 0x50, 0x00, 0xC0, 0x60, 0x10, 0x00, 0xA1, 0x80, 0x50,
+0x60, 0x0C, 0x07, 0x60, 0x70, 0xC0, 0x00, 0x60, 0xD0, 0xE1, 0x29, 0xE4, 0x20, 0xE0, 0x21, 0xE1,
+0x20, 0x40, 0xB0, 0x20, 0xE0, 0x22, 0xE2, 0x25, 0xE5, 0xD1, 0xE0, 0x90, 0xE0, 0x91, 0x41, 0x92,
+0xE2, 0xD1, 0xE1, 0x25, 0xD0, 0x90, 0x30, 0x06, 0x80, 0x30, 0x02, 0x70, 0xF0, 0x0B, 0x50, 0xC0,
+0x01, 0x60, 0x01, 0x70, 0xA0, 0x01, 0x30, 0x10, 0x30, 0xB1, 0xD0, 0x20, 0xE2, 0x20, 0xE2, 0xD0,
+0xE0, 0x41, 0x90, 0xE5, 0x22, 0xE1, 0x24, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0x91, 0xF0, 0xD0,
+0xE0, 0xD0, 0x21, 0xE1, 0x21, 0xE0, 0xD0, 0x60, 0x70, 0x0B, 0x30, 0x07, 0x31, 0x03, 0x50, 0x01,
+0x70, 0xA0, 0x70, 0x07, 0xA0, 0x70, 0x06, 0x70, 0x80, 0xF0, 0x50, 0x0F, 0x00, 0x50, 0x80, 0xC0,
+0x00, 0x60, 0x10, 0x40, 0xD1, 0xF0, 0xC0, 0x00, 0xA0, 0x30, 0xA0, 0xB0, 0xD0, 0xE1, 0xD0, 0xA1,
+0x40, 0xD1, 0xE0, 0x90, 0x40, 0x90, 0xE4, 0x25, 0xE2, 0x22, 0xE0, 0x21, 0xE2, 0x20, 0xE0, 0x91,
+0xD0, 0xE2, 0x20, 0xE3, 0x20, 0xE2, 0x21, 0xE0, 0x21, 0xE1, 0x23, 0xE3, 0x25, 0xE2, 0xD1, 0xE2,
+0x91, 0x42, 0x92, 0x40, 0xE7, 0x23, 0xE0, 0xD0, 0x90, 0xB0, 0x0F, 0x05, 0x70, 0xA0, 0xD0, 0xE1,
+0xD0, 0x40, 0xF0, 0x00, 0x80, 0x30, 0x10, 0xC0, 0xA0, 0x00, 0xC0, 0x50, 0xA0, 0x00, 0x70, 0xC0,
+0x09, 0x07, 0x30, 0x02, 0x60, 0xD0, 0xE0, 0x20, 0xE2, 0x2A, 0xE4, 0x21, 0xE1, 0x21, 0xE2, 0x27,
+0xE1, 0xD1, 0xE2, 0x91, 0x42, 0x91, 0xE0, 0xD0, 0xE2, 0x21, 0xE3, 0x22, 0xE1, 0x22, 0xD0, 0x90,
+0x30, 0x05, 0x60, 0x80, 0x0E, 0xC0, 0x70, 0x51, 0x70, 0x01, 0x30, 0xC0, 0x01, 0x30, 0x02, 0x80,
+0xC0, 0x00, 0xA0, 0xE5, 0xD0, 0xE0, 0x90, 0x41, 0xE0, 0xD0, 0xE4, 0x20, 0xE1, 0x20, 0xE0, 0x21,
+0xE2, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0x40, 0xE0, 0x40, 0x60, 0xE0, 0x40,
+0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0xB0, 0x70, 0x0B, 0xA0, 0x08, 0x30, 0x80, 0x02, 0x50,
+0x00, 0x70, 0xA0, 0xC0, 0x08, 0x50, 0x30, 0x08, 0x51, 0x0F, 0x00, 0x80, 0x50, 0x70, 0x50, 0x70,
+0xA0, 0x30, 0xA0, 0x40, 0x50, 0x30, 0x50, 0xA1, 0xE0, 0xD2, 0xE0, 0xA0, 0x50, 0x00, 0xF0, 0xD0,
+0xE3, 0x90, 0x41, 0x90, 0xE1, 0xD0, 0xE4, 0x29, 0xE0, 0x20, 0xE1, 0x42, 0x91, 0xE0, 0xD1, 0xE0,
+0x21, 0xE0, 0x2A, 0xE8, 0x20, 0xE0, 0x24, 0xE7, 0x22, 0x91, 0xB0, 0x41, 0x91, 0xE2, 0xD1, 0xE0,
+0x22, 0xE0, 0xD0, 0xA0, 0x0F, 0x05, 0xA0, 0x90, 0xE0, 0x22, 0xD0, 0x30, 0x00, 0x30, 0xB0, 0x10,
+0x80, 0x60, 0x01, 0xC0, 0x80, 0x70, 0x81, 0xC0, 0x08, 0x07, 0x30, 0x02, 0xA0, 0xE1, 0x20, 0xE2,
+0x2C, 0xE0, 0x22, 0xE1, 0x21, 0xE1, 0x21, 0xE3, 0x20, 0xE0, 0xD1, 0xE0, 0x90, 0x43, 0x92, 0xD1,
+0x40, 0xD1, 0xE1, 0x25, 0xE2, 0x27, 0xE1, 0x30, 0x05, 0x60, 0x0B, 0xC0, 0xA0, 0x51, 0x70, 0xC0,
+0x01, 0x50, 0x01, 0xC0, 0xF0, 0x60, 0xA0, 0x60, 0xC0, 0x01, 0x80, 0x70, 0x00, 0x80, 0x30, 0xD2,
+0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE2, 0x22, 0xE2, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x20,
+0xE3, 0x41, 0xE0, 0xD1, 0x90, 0x40, 0xD1, 0x90, 0xA0, 0xD0, 0xE0, 0x20, 0xE3, 0xD0, 0x30, 0x70,
+0x0A, 0x50, 0x80, 0xC0, 0x08, 0x50, 0x60, 0xC0, 0x00, 0x70, 0x50, 0xA0, 0x0A, 0x80, 0x70, 0x50,
+0x07, 0xC0, 0x80, 0x0E, 0x70, 0x30, 0x70, 0x01, 0x71, 0x01, 0x80, 0x60, 0xA0, 0x10, 0xF0, 0x40,
+0xD1, 0xE0, 0x30, 0xA0, 0xC0, 0x01, 0xF0, 0xD0, 0x22, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xD1,
+0xE2, 0x20, 0xE1, 0x28, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x91, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x20,
+0xE3, 0x24, 0xE2, 0x20, 0xE7, 0x21, 0xE3, 0x29, 0xE2, 0x40, 0xD0, 0xE0, 0x91, 0x43, 0x91, 0x22,
+0xD0, 0x40, 0x10, 0xC0, 0x0F, 0x03, 0x50, 0xB0, 0xD0, 0xE0, 0x21, 0xE0, 0x90, 0xF0, 0x70, 0x30,
+0x40, 0x10, 0x30, 0x60, 0x01, 0xC0, 0x80, 0x70, 0x31, 0xC0, 0x08, 0x07, 0x80, 0xA1, 0x30, 0x60,
+0x90, 0xD0, 0x25, 0xE2, 0x21, 0xE0, 0x26, 0xE6, 0xD3, 0xE1, 0x91, 0x43, 0x90, 0x20, 0xE6, 0xD0,
+0x40, 0x20, 0xE0, 0x20, 0xE5, 0x20, 0xE3, 0x26, 0xE1, 0xA0, 0x05, 0xA0, 0x07, 0xC0, 0x70, 0x51,
+0x70, 0x06, 0x50, 0x05, 0xA0, 0x10, 0x60, 0x80, 0x60, 0x01, 0x70, 0x10, 0xE0, 0x90, 0x41, 0x90,
+0xE3, 0x20, 0xE3, 0x21, 0xE1, 0x21, 0xE1, 0x21, 0xE4, 0xD0, 0xE0, 0x41, 0xE2, 0x21, 0xE0, 0x90,
+0xB2, 0x90, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0xA0, 0x0A, 0x70, 0xC0, 0x30, 0xC0, 0x09, 0x50, 0x60,
+0xF0, 0x30, 0x80, 0x0B, 0x80, 0xC0, 0x70, 0xC0, 0x07, 0x30, 0x0D, 0x70, 0x50, 0x81, 0x03, 0x50,
+0x70, 0x00, 0x70, 0x10, 0x30, 0xD2, 0xE0, 0x60, 0x70, 0x03, 0x60, 0xD0, 0xE0, 0x22, 0xE2, 0xD1,
+0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE1, 0x25, 0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0xD0,
+0xE0, 0x42, 0x90, 0x20, 0xD0, 0xE3, 0x27, 0xE0, 0x25, 0xE1, 0x21, 0xE1, 0x24, 0xE5, 0xD0, 0x91,
+0xD0, 0xE3, 0xD1, 0xE1, 0x90, 0x42, 0x90, 0x40, 0x30, 0xA0, 0x0F, 0x03, 0xA0, 0xE0, 0xD0, 0x21,
+0xE1, 0xD0, 0xB3, 0x10, 0x30, 0xF0, 0x30, 0xA0, 0x60, 0x50, 0x00, 0xC0, 0x0A, 0x00, 0xC0, 0x02,
+0x80, 0x30, 0x00, 0x50, 0x70, 0x01, 0x80, 0x90, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x25, 0xE5, 0xD0,
+0xE1, 0x92, 0x41, 0x92, 0xE1, 0xD2, 0xE0, 0x20, 0xE0, 0x23, 0xE1, 0x91, 0xE0, 0x20, 0xE0, 0x20,
+0xE4, 0x23, 0xE2, 0x22, 0xE1, 0xD0, 0x60, 0x05, 0x30, 0x03, 0xC0, 0x71, 0x50, 0x70, 0xC0, 0x09,
+0x71, 0x07, 0xF0, 0x80, 0x00, 0xC0, 0xA0, 0x60, 0xB0, 0x90, 0xE1, 0xD0, 0x24, 0xE2, 0x24, 0xE2,
+0x23, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xD0, 0x40, 0xB0, 0x40,
+0xD0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0xA0, 0x60, 0xA0, 0x30, 0xC0, 0x07, 0x50, 0x00, 0x30,
+0xC0, 0x0A, 0xC0, 0x30, 0x70, 0x0C, 0x80, 0x70, 0x00, 0x50, 0x07, 0xA0, 0x0D, 0x50, 0x00, 0xC0,
+0x30, 0x04, 0xC0, 0x50, 0x30, 0xA1, 0xD1, 0xA1, 0x70, 0x03, 0xC0, 0xA0, 0xD0, 0x22, 0xE5, 0xD2,
+0x91, 0x40, 0x90, 0xE2, 0x23, 0xE5, 0x91, 0xE0, 0x23, 0xE0, 0xD1, 0xE1, 0x91, 0x40, 0x91, 0xE1,
+0xD0, 0xE5, 0x27, 0xE5, 0x25, 0xE1, 0x21, 0xE1, 0x90, 0xE1, 0x20, 0xD0, 0xE1, 0x22, 0xE0, 0xD1,
+0xE2, 0x40, 0xA1, 0x51, 0x71, 0xC0, 0x0C, 0xC0, 0xA0, 0xD0, 0x21, 0xE1, 0x20, 0xD0, 0x90, 0x60,
+0x40, 0x61, 0x10, 0x50, 0x01, 0x80, 0x70, 0x00, 0x50, 0x80, 0x50, 0xC0, 0x07, 0xC0, 0xF0, 0x30,
+0x01, 0xC0, 0x80, 0x30, 0xC0, 0x80, 0x01, 0x50, 0x40, 0xD0, 0x2C, 0xE3, 0xD0, 0xE2, 0x91, 0x41,
+0x92, 0xE0, 0x20, 0xEA, 0x25, 0xE1, 0x40, 0xE2, 0x22, 0xE4, 0x21, 0xE3, 0x21, 0xE1, 0xD0, 0xA0,
+0xC0, 0x04, 0x80, 0x70, 0xC0, 0x70, 0x50, 0x71, 0xC0, 0x0D, 0x50, 0x08, 0x80, 0xA0, 0x80, 0x70,
+0x80, 0x40, 0xD0, 0xE0, 0xD0, 0x29, 0xE1, 0x25, 0xE0, 0x21, 0xD1, 0x90, 0x40, 0x90, 0xD0, 0xE2,
+0x24, 0xE1, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xD0, 0x90, 0xA0, 0x01, 0xC0, 0x60, 0x70, 0x05,
+0x70, 0xC0, 0x00, 0x80, 0xC0, 0x0B, 0x30, 0x70, 0x0C, 0x80, 0x70, 0x00, 0x71, 0x06, 0xA0, 0xC0,
+0x0B, 0x50, 0x01, 0xC0, 0x80, 0x05, 0xC0, 0x30, 0xA3, 0x80, 0x05, 0x50, 0xB0, 0xD0, 0x22, 0xE0,
+0x20, 0xE2, 0x20, 0xE3, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE0, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE0,
+0x40, 0xE2, 0x20, 0xE5, 0xD0, 0xE2, 0x20, 0x90, 0x41, 0x90, 0xE1, 0xD1, 0xE1, 0x27, 0xE3, 0x20,
+0xE2, 0x27, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE7, 0xD1, 0x40, 0x11, 0xC0, 0x00,
+0xC0, 0x71, 0x52, 0x70, 0xC0, 0x07, 0xA0, 0x90, 0xD0, 0x20, 0xE2, 0x20, 0xE0, 0xB0, 0x10, 0x40,
+0x10, 0x30, 0x10, 0x70, 0x01, 0x80, 0xC0, 0xA0, 0x30, 0x80, 0x30, 0x60, 0xA0, 0x06, 0x00, 0x60,
+0x80, 0xF0, 0x02, 0x60, 0x00, 0x30, 0x50, 0x30, 0x60, 0x30, 0xD0, 0x20, 0xE2, 0x25, 0xE1, 0xD1,
+0xE1, 0x90, 0x43, 0x91, 0xE0, 0xD0, 0xE4, 0x2B, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0x23, 0xE1,
+0x24, 0xE7, 0xD0, 0x30, 0xC0, 0x03, 0x70, 0xA0, 0x80, 0x70, 0xC0, 0x0F, 0x02, 0x50, 0x06, 0x70,
+0x50, 0x71, 0x01, 0x80, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x27, 0xE0, 0x25, 0xE1, 0x20, 0xE0, 0xD0,
+0xE0, 0x41, 0xE0, 0xD0, 0xE4, 0x23, 0xE0, 0xD0, 0x91, 0xE2, 0x20, 0xE1, 0xD0, 0x10, 0x04, 0xA0,
+0x00, 0x30, 0x03, 0x70, 0x01, 0x80, 0x70, 0x60, 0x30, 0x09, 0x30, 0x70, 0x0C, 0xA0, 0xC0, 0x01,
+0x50, 0x05, 0xF0, 0x50, 0x0B, 0x50, 0xC0, 0x01, 0x30, 0x70, 0x31, 0x04, 0x81, 0x30, 0x70, 0x07,
+0xA0, 0xD1, 0x23, 0xE1, 0x25, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD1, 0xE1, 0x20,
+0xE0, 0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x21, 0xE2, 0xD1, 0xE0, 0x91, 0x41, 0x90,
+0xE0, 0xD1, 0xE7, 0x23, 0xE3, 0x26, 0xE1, 0x40, 0xE1, 0x21, 0xEA, 0xD0, 0x10, 0xA0, 0x07, 0xC0,
+0x70, 0x53, 0x70, 0xC0, 0x00, 0xC0, 0xA0, 0xD0, 0xE5, 0xD0, 0x40, 0x10, 0x60, 0xA0, 0xF0, 0x10,
+0x60, 0x80, 0x70, 0x30, 0xC0, 0xA0, 0x03, 0x80, 0x30, 0x05, 0x00, 0xA0, 0xC0, 0x70, 0x10, 0x30,
+0xA0, 0x30, 0x00, 0x60, 0x50, 0xC0, 0x00, 0xA0, 0xD0, 0xE4, 0xD2, 0xE0, 0x91, 0x43, 0x91, 0xD0,
+0xE9, 0x28, 0xE2, 0x25, 0xE2, 0x40, 0xD0, 0xE0, 0x2C, 0xE4, 0xD1, 0x40, 0x80, 0x70, 0x52, 0xC0,
+0x00, 0x60, 0x0F, 0x04, 0x70, 0xC0, 0x02, 0xC0, 0x51, 0x70, 0x04, 0x60, 0xB0, 0xD0, 0xE1, 0x24,
+0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE2, 0x20, 0xE2,
+0x20, 0xE0, 0x21, 0xE0, 0xD1, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0xD0, 0x30, 0xA0, 0x03, 0x50,
+0x10, 0x30, 0xF0, 0xA0, 0x60, 0x32, 0x80, 0xA0, 0x70, 0x30, 0x70, 0x08, 0x70, 0x80, 0x70, 0x0B,
+0x60, 0xC0, 0x02, 0xC0, 0x50, 0x03, 0x50, 0x30, 0x0B, 0x70, 0x80, 0x01, 0xC0, 0x30, 0x00, 0x80,
+0x50, 0x06, 0x80, 0xA1, 0x70, 0x82, 0xA0, 0x70, 0x00, 0xA0, 0xD1, 0x22, 0xE1, 0x25, 0xE4, 0x21,
+0xE2, 0x90, 0x41, 0x90, 0xD2, 0x91, 0xE2, 0x25, 0xEA, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xE1, 0xD1,
+0xE1, 0x26, 0xE2, 0x21, 0xE0, 0x22, 0xD0, 0xE0, 0x90, 0xE1, 0x26, 0xE5, 0xD0, 0xB0, 0xA0, 0x0D,
+0xC0, 0x70, 0x50, 0xA0, 0x40, 0x91, 0xE1, 0xD1, 0xE0, 0xD1, 0xB0, 0x90, 0xB0, 0xA0, 0x30, 0x00,
+0xC0, 0x50, 0xA0, 0x00, 0x60, 0x80, 0x02, 0x50, 0x30, 0x05, 0x00, 0x30, 0x50, 0x01, 0x51, 0x01,
+0x30, 0x02, 0xA0, 0xD1, 0xE2, 0x92, 0x41, 0x91, 0xE4, 0xD0, 0xE4, 0x2D, 0xE3, 0x22, 0xE5, 0x40,
+0xE0, 0xD0, 0xE0, 0x2A, 0xE1, 0xD1, 0xE1, 0x91, 0x40, 0xB0, 0xC0, 0x04, 0x81, 0x50, 0x0F, 0x03,
+0x50, 0xC0, 0x70, 0x50, 0x70, 0x07, 0x70, 0x60, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x21, 0xE3,
+0x20, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD1, 0xE1, 0x21, 0xE0, 0x20, 0xE4, 0x20, 0xE0, 0x20, 0x40,
+0xE0, 0x40, 0x90, 0xE0, 0x20, 0xE1, 0xD0, 0xB0, 0x11, 0xF0, 0x70, 0x01, 0xF0, 0x02, 0xC0, 0x70,
+0x00, 0xC1, 0x70, 0x00, 0x30, 0xC0, 0x02, 0x72, 0x50, 0x81, 0x60, 0xC0, 0x50, 0x0A, 0x51, 0x04,
+0x70, 0xC0, 0x02, 0xA0, 0x70, 0x0A, 0x71, 0xC0, 0x51, 0x10, 0x70, 0x0A, 0xC0, 0x71, 0x80, 0x50,
+0xC0, 0x01, 0xC0, 0xA0, 0xD0, 0xE6, 0x2D, 0xE0, 0xD1, 0x91, 0x40, 0x92, 0xE0, 0xD1, 0xE1, 0x24,
+0xE0, 0x20, 0xE5, 0x20, 0xE4, 0xD0, 0xE1, 0x90, 0x41, 0x91, 0xE4, 0x21, 0xE3, 0x21, 0xE2, 0x21,
+0xD0, 0x91, 0xE0, 0x28, 0xE5, 0xD0, 0xA0, 0xC0, 0x0E, 0xA0, 0x40, 0xD0, 0x20, 0x91, 0x42, 0x92,
+0xD0, 0x90, 0x10, 0xA0, 0x30, 0x01, 0xC0, 0x30, 0x01, 0x30, 0x63, 0xC0, 0x05, 0x00, 0xC0, 0x01,
+0x70, 0x81, 0x70, 0x00, 0x80, 0x70, 0x50, 0x80, 0x60, 0x90, 0x42, 0x92, 0x20, 0xE9, 0x2D, 0xE6,
+0x25, 0xE3, 0xD0, 0x91, 0xD0, 0xE1, 0x25, 0xE2, 0xD1, 0xE0, 0x91, 0x40, 0x92, 0xD0, 0x30, 0x06,
+0x50, 0x60, 0x70, 0x0F, 0x01, 0x70, 0x80, 0x70, 0xC0, 0x09, 0x70, 0x60, 0xD0, 0x20, 0xE0, 0x20,
+0xE5, 0x22, 0xE0, 0x21, 0xE2, 0x90, 0x40, 0x90, 0xE2, 0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20,
+0xE2, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x40, 0x20, 0xD0, 0x20, 0xE0, 0xD0, 0xF0, 0x10, 0x60, 0x80,
+0x10, 0xC0, 0x00, 0x60, 0x02, 0x50, 0x07, 0xC0, 0x80, 0xA0, 0x80, 0x60, 0x30, 0x50, 0x71, 0xC0,
+0x00, 0x50, 0x0A, 0x60, 0x06, 0x50, 0x02, 0x60, 0x0A, 0xC0, 0x50, 0x02, 0x50, 0xF0, 0x70, 0x0E,
+0x70, 0x50, 0x01, 0xC0, 0xA0, 0xD1, 0xE1, 0x2D, 0xE9, 0x90, 0x41, 0x90, 0xE1, 0xD0, 0xE0, 0x20,
+0xE0, 0x21, 0xE0, 0x22, 0xE1, 0x22, 0xE1, 0x21, 0xE8, 0x90, 0x41, 0x91, 0xE1, 0xD0, 0xE1, 0x21,
+0xE0, 0x24, 0xE0, 0xD0, 0x91, 0xE0, 0x21, 0xE2, 0x25, 0xE3, 0xD0, 0x30, 0x70, 0x0D, 0x81, 0xD0,
+0xE1, 0xD0, 0xE0, 0xD0, 0xE0, 0x20, 0x92, 0x40, 0xB0, 0xA0, 0x40, 0xF0, 0x80, 0x52, 0x70, 0xA1,
+0x60, 0xA0, 0x50, 0x07, 0x01, 0x50, 0x11, 0xF0, 0x50, 0x60, 0x70, 0x50, 0x13, 0x40, 0xE0, 0xD2,
+0xE2, 0x26, 0xE1, 0x2A, 0xE8, 0x20, 0xE0, 0x26, 0xE4, 0x40, 0xD0, 0xE3, 0x20, 0xE2, 0xD1, 0xE0,
+0x90, 0x41, 0x90, 0xE1, 0xD0, 0xE0, 0xD0, 0xE0, 0x60, 0x07, 0x30, 0x0E, 0x70, 0x51, 0xC0, 0x70,
+0xC0, 0x03, 0xC0, 0x03, 0x50, 0x60, 0x10, 0x80, 0xD0, 0x23, 0xE2, 0x25, 0xE1, 0xD0, 0xE0, 0x41,
+0xE0, 0xD0, 0xE1, 0x21, 0xE1, 0x21, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE3, 0x40, 0xE0,
+0x20, 0xE0, 0xD0, 0xB0, 0x10, 0xF0, 0x50, 0xA0, 0x60, 0x80, 0x70, 0x30, 0x00, 0xC1, 0x06, 0x50,
+0x60, 0x50, 0x01, 0x80, 0x50, 0x04, 0x51, 0x08, 0x70, 0x10, 0x70, 0x05, 0x70, 0xC0, 0x00, 0xC0,
+0x10, 0xC0, 0x08, 0xC0, 0x50, 0x04, 0x30, 0xC0, 0x0F, 0x01, 0x50, 0x70, 0x50, 0xB0, 0xD0, 0xE5,
+0x29, 0xE6, 0x23, 0xD0, 0x92, 0x41, 0x90, 0xD1, 0xE2, 0x28, 0xE0, 0x20, 0xE0, 0x28, 0xE1, 0xD0,
+0xE0, 0x91, 0x41, 0x90, 0xE3, 0x20, 0xE6, 0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x26, 0xE2, 0xD0,
+0xB0, 0x70, 0x0D, 0xA0, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE2, 0xD0, 0x90, 0xF0, 0x60, 0x80, 0x13,
+0x70, 0x60, 0xC0, 0x00, 0xC0, 0x50, 0xF0, 0x70, 0x06, 0x00, 0xC0, 0x60, 0x01, 0x51, 0x00, 0xA0,
+0x70, 0x30, 0x70, 0x00, 0x50, 0xB0, 0xD0, 0xE5, 0x21, 0xE0, 0x2D, 0xE8, 0x23, 0xE3, 0x27, 0xD0,
+0x40, 0xE3, 0xD2, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD1, 0xE1, 0xD0, 0xE2, 0x90, 0x30, 0x07, 0x60,
+0x0B, 0xC0, 0x51, 0x70, 0x03, 0x50, 0x02, 0xC0, 0xA0, 0x01, 0x80, 0xA0, 0x11, 0xF0, 0x10, 0xD0,
+0xE0, 0x21, 0xE1, 0x21, 0xE0, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE3, 0x23,
+0xE0, 0x20, 0xE0, 0x91, 0xD0, 0xE0, 0x20, 0xE2, 0xD0, 0x40, 0xE1, 0xD0, 0x40, 0x11, 0xA0, 0x10,
+0x00, 0x80, 0x30, 0x10, 0x80, 0x30, 0xA0, 0x04, 0xC0, 0x10, 0x60, 0x04, 0x10, 0x50, 0x02, 0x60,
+0x81, 0x60, 0x80, 0xA0, 0x50, 0x00, 0x30, 0xA0, 0x30, 0x60, 0x30, 0x60, 0x11, 0x05, 0x80, 0x02,
+0x60, 0x07, 0x70, 0x50, 0x04, 0xC0, 0x80, 0x71, 0x0F, 0x02, 0x30, 0x40, 0xD0, 0xE1, 0x24, 0xE1,
+0x23, 0xE7, 0x23, 0xE1, 0xD0, 0x40, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x2D,
+0xE2, 0x25, 0xE2, 0xD0, 0xE0, 0x90, 0x42, 0x90, 0xE5, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0x27, 0xE3, 0xA0, 0x0C, 0x50, 0xB0, 0xD0, 0x21, 0xE6, 0x22, 0xB0, 0xD0, 0x30, 0xC0,
+0x00, 0xC0, 0x60, 0x70, 0xA0, 0x04, 0x60, 0x06, 0x01, 0x60, 0x01, 0x82, 0xB0, 0xC0, 0x80, 0x01,
+0xC0, 0xB0, 0xD0, 0xE7, 0x28, 0xED, 0x24, 0xE3, 0x21, 0xE0, 0x23, 0xE1, 0x90, 0xE0, 0xD0, 0xE1,
+0x91, 0x40, 0x91, 0xE0, 0xD1, 0xE1, 0x21, 0xE3, 0x20, 0xE0, 0x30, 0x07, 0x70, 0x60, 0x50, 0x06,
+0xC0, 0x70, 0x50, 0x70, 0x06, 0x50, 0xC0, 0x05, 0x50, 0x62, 0x00, 0x50, 0xA0, 0xE1, 0x20, 0xE1,
+0x24, 0xE2, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x21, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0xE0,
+0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE3, 0x40, 0x90, 0xD0, 0xE0, 0x40, 0x60, 0xA0, 0x03, 0x70, 0x80,
+0x70, 0xA0, 0xC0, 0x02, 0x70, 0x30, 0x50, 0x05, 0xC0, 0xA0, 0x30, 0xC0, 0x80, 0x50, 0x70, 0x01,
+0x50, 0x00, 0x80, 0x30, 0x70, 0x01, 0xC0, 0x01, 0xF1, 0x05, 0x71, 0x01, 0xF0, 0x50, 0x05, 0x71,
+0x06, 0xA0, 0x00, 0x70, 0x50, 0x0F, 0x00, 0xC0, 0xA0, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x22, 0xE2,
+0x22, 0xE4, 0x24, 0xE0, 0x21, 0xD0, 0x91, 0xE1, 0x21, 0xE0, 0xD0, 0xE0, 0xA0, 0x40, 0x90, 0x20,
+0xD0, 0xE2, 0x2B, 0xE3, 0x20, 0xE0, 0x25, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0x91, 0xE1, 0xD0, 0x91,
+0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xE2, 0x25, 0xE0, 0xD0, 0x30, 0xC0, 0x0B, 0xA0, 0xD1, 0x22, 0xE4,
+0x23, 0xD1, 0xA0, 0x02, 0x30, 0x00, 0x80, 0xF0, 0x80, 0x50, 0x70, 0x30, 0x80, 0x06, 0x01, 0x80,
+0xF0, 0x60, 0xA0, 0x00, 0x50, 0x01, 0xA0, 0xC0, 0x80, 0xA1, 0xD0, 0xE0, 0x26, 0xE0, 0x25, 0xE2,
+0x2F, 0x04, 0xE0, 0x20, 0xE1, 0x22, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0x41, 0x90, 0xE6, 0x20, 0xE0,
+0x21, 0xE3, 0x20, 0xD0, 0xA0, 0x08, 0x50, 0xF0, 0x30, 0xA1, 0x30, 0x71, 0x50, 0x70, 0xC0, 0x08,
+0xC0, 0x70, 0x07, 0x30, 0x10, 0x70, 0x00, 0x60, 0x30, 0x90, 0xD0, 0xE0, 0x23, 0xE0, 0xD0, 0xE0,
+0x90, 0x40, 0x90, 0xE1, 0x27, 0xE1, 0x20, 0xE0, 0x20, 0xE3, 0x40, 0x90, 0xD0, 0xE3, 0x20, 0xE0,
+0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD2, 0x10, 0xC0, 0x03, 0x70, 0x00, 0x50, 0xA0, 0x02, 0xA0,
+0x50, 0x07, 0xC0, 0x10, 0x30, 0x60, 0x00, 0x50, 0x0B, 0x50, 0xF0, 0x70, 0x05, 0x50, 0x00, 0x30,
+0x50, 0xA0, 0xC0, 0x03, 0x70, 0x50, 0x06, 0xF0, 0x80, 0x01, 0xC0, 0x50, 0x0E, 0x80, 0x40, 0xD0,
+0x20, 0x41, 0xE3, 0x22, 0xE1, 0x29, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE0, 0x24, 0xE0, 0xD0, 0xB0,
+0x91, 0x41, 0x90, 0xE4, 0x26, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x23, 0xE6, 0xD0, 0xE0, 0x91, 0x41,
+0x90, 0x40, 0x90, 0xE2, 0x20, 0xE0, 0x20, 0xE5, 0x23, 0xE1, 0xD0, 0x40, 0x80, 0x0A, 0x70, 0x30,
+0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x22, 0xD0, 0xF0, 0x30, 0x50, 0xC0, 0xA0,
+0x01, 0xC0, 0x80, 0xA1, 0x80, 0x07, 0x03, 0x30, 0xA0, 0xF1, 0xA0, 0x00, 0xA0, 0x80, 0x70, 0x00,
+0xA0, 0xD0, 0xE0, 0x28, 0xE7, 0x2F, 0x02, 0xE7, 0xD1, 0xE0, 0x90, 0x42, 0xE1, 0xD0, 0xE1, 0x23,
+0xE1, 0x24, 0xE0, 0x22, 0xD0, 0xB0, 0x80, 0x07, 0x70, 0x80, 0xC0, 0x71, 0x50, 0x81, 0x0C, 0x50,
+0x08, 0x80, 0x12, 0x80, 0x10, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x41, 0xE0, 0xD0, 0xE0, 0x2A, 0xE0,
+0x20, 0xE1, 0xD0, 0xE0, 0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0x40, 0x90, 0x40, 0xD1,
+0x40, 0x10, 0xC0, 0xA1, 0x50, 0x02, 0xF0, 0x80, 0x30, 0x80, 0x60, 0x02, 0xA3, 0x30, 0xA1, 0x80,
+0x00, 0x60, 0xA0, 0x50, 0x0A, 0x50, 0x30, 0x50, 0x70, 0x06, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x02,
+0x50, 0x70, 0x50, 0x05, 0xC0, 0x60, 0x30, 0x02, 0xC0, 0x50, 0x10, 0x0C, 0x60, 0xD0, 0x21, 0xE0,
+0x20, 0x40, 0x90, 0xE2, 0x20, 0xE1, 0x21, 0xE0, 0x25, 0xE0, 0x21, 0xE4, 0x40, 0xE0, 0x25, 0xE3,
+0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE2, 0x25, 0xE4, 0x21, 0xE1, 0x23, 0xE6, 0xD1, 0xE1,
+0xB0, 0x41, 0x90, 0xE1, 0xD0, 0xE6, 0x24, 0xE1, 0x40, 0x80, 0x0A, 0xA0, 0xD0, 0xE1, 0x26, 0xE1,
+0x21, 0xE1, 0xD0, 0x30, 0x00, 0x70, 0x80, 0x30, 0x0E, 0x02, 0x60, 0x30, 0xC0, 0x01, 0x50, 0x30,
+0x50, 0x70, 0x01, 0xB0, 0x40, 0xD0, 0x20, 0xE0, 0x29, 0xE3, 0x2F, 0x01, 0xE5, 0xD0, 0xE1, 0x90,
+0x41, 0x91, 0xD1, 0x40, 0xD0, 0xE3, 0x27, 0xE0, 0x26, 0xD0, 0xA0, 0x08, 0x30, 0x70, 0x50, 0x70,
+0x00, 0x80, 0x70, 0x0C, 0xC0, 0x70, 0x08, 0xF0, 0x70, 0x02, 0x10, 0x40, 0xD0, 0xE2, 0x90, 0x40,
+0x90, 0xD0, 0xE2, 0x22, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0xE1, 0x21,
+0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x40, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x30, 0x10, 0x01, 0xA0,
+0x02, 0x10, 0x50, 0x80, 0x30, 0xA0, 0x80, 0x70, 0x81, 0x02, 0x60, 0xF0, 0x02, 0x30, 0x10, 0x80,
+0x0A, 0x60, 0xC0, 0x30, 0x10, 0xC0, 0x04, 0x50, 0x30, 0x01, 0xC0, 0xF0, 0x70, 0x00, 0x50, 0xC0,
+0x01, 0x50, 0x06, 0xC0, 0x60, 0x50, 0x02, 0x80, 0xC0, 0x03, 0xC1, 0x04, 0x30, 0x40, 0xD0, 0x21,
+0xE0, 0x20, 0xD0, 0x90, 0x40, 0x90, 0xD1, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x23, 0xE2, 0x21, 0xE1,
+0x40, 0xE2, 0x25, 0xE4, 0xD0, 0xE1, 0x90, 0x41, 0xE4, 0x22, 0xE1, 0x25, 0xE2, 0x27, 0xE5, 0x40,
+0xD0, 0xE0, 0x90, 0x42, 0x90, 0xE0, 0xD1, 0xE1, 0x22, 0xE1, 0x21, 0xE0, 0x40, 0x80, 0x09, 0xC0,
+0x30, 0xD0, 0xE0, 0x26, 0xE2, 0x22, 0xE0, 0x40, 0x50, 0x01, 0x50, 0x70, 0x30, 0xF0, 0xA0, 0x80,
+0x50, 0xC0, 0x08, 0x01, 0xC0, 0x60, 0x03, 0x50, 0x30, 0xC0, 0x80, 0x00, 0xC0, 0xB1, 0xD0, 0x20,
+0xE0, 0x21, 0xE0, 0x29, 0xE3, 0x23, 0xE0, 0x22, 0xE1, 0x22, 0xE3, 0xD0, 0x20, 0x91, 0x41, 0x90,
+0xE1, 0xD1, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x27, 0xE1, 0x25, 0xE0, 0xD0, 0xB0, 0x80, 0x04,
+0xC0, 0x70, 0x81, 0x03, 0x30, 0x0E, 0x50, 0x0E, 0x10, 0xB0, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0xD0,
+0xE0, 0x23, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xE1, 0x24, 0xE0, 0x20, 0xE1,
+0xD1, 0x40, 0xE0, 0xD0, 0x20, 0xE1, 0x40, 0x90, 0xB0, 0x60, 0x00, 0x50, 0x30, 0x80, 0xC0, 0x00,
+0x60, 0x03, 0x30, 0x80, 0x30, 0xA0, 0x02, 0xA0, 0x81, 0x00, 0x70, 0x30, 0x81, 0x09, 0x50, 0x30,
+0x60, 0x50, 0x04, 0x30, 0x60, 0x50, 0xC0, 0x50, 0x01, 0x70, 0x60, 0x30, 0xC0, 0x02, 0xC0, 0x50,
+0x07, 0xA0, 0x50, 0x02, 0x50, 0x70, 0x00, 0x80, 0xA0, 0xF0, 0x70, 0x03, 0x70, 0xA0, 0xD0, 0xE1,
+0x22, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE2, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0,
+0x20, 0x40, 0xD0, 0xE1, 0x28, 0xE5, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE3, 0x21, 0xE1, 0x20, 0xE5,
+0x20, 0xE1, 0x28, 0xE1, 0x91, 0xD0, 0xE4, 0x90, 0x41, 0x91, 0x20, 0xE5, 0x20, 0xE0, 0x40, 0x80,
+0x09, 0x70, 0xB0, 0xD0, 0xE0, 0x24, 0xE4, 0x22, 0xD0, 0xB0, 0x80, 0xC0, 0x00, 0x30, 0x01, 0x60,
+0x50, 0x80, 0x30, 0x60, 0xA0, 0x07, 0x02, 0x60, 0x80, 0x50, 0x80, 0xA0, 0x60, 0xC0, 0x00, 0xF0,
+0x30, 0x81, 0x30, 0xD0, 0xE4, 0x2D, 0xE1, 0x28, 0xE0, 0xD1, 0xE1, 0x90, 0x41, 0x90, 0xE0, 0x20,
+0xE2, 0x23, 0xE0, 0x91, 0xD0, 0x28, 0xE1, 0x24, 0xE1, 0xD0, 0xE0, 0xD0, 0xA0, 0xC0, 0x01, 0x70,
+0x50, 0x70, 0x00, 0x30, 0xC0, 0x03, 0xA0, 0x0E, 0x50, 0xC0, 0x0D, 0xC0, 0x10, 0x41, 0xE0, 0xD0,
+0x24, 0xE0, 0x23, 0xE7, 0xD0, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE1, 0x20, 0xE0,
+0x40, 0x90, 0xE1, 0x21, 0xE0, 0x20, 0x90, 0x40, 0xF0, 0x80, 0x00, 0x60, 0xA0, 0x30, 0x00, 0x10,
+0x70, 0x05, 0xA0, 0x70, 0xF0, 0x00, 0x10, 0x70, 0x30, 0x00, 0xF0, 0x01, 0x50, 0x09, 0xA0, 0xC0,
+0x00, 0x30, 0x50, 0x02, 0x70, 0x60, 0x02, 0x71, 0xC0, 0x50, 0x00, 0x70, 0x60, 0x50, 0x02, 0x71,
+0x06, 0xC0, 0xF0, 0x30, 0x80, 0x70, 0x00, 0x50, 0x30, 0x80, 0x00, 0x30, 0x03, 0xC0, 0x60, 0xD2,
+0xE1, 0x21, 0xE2, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE3, 0x26, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE1,
+0x21, 0xE0, 0x22, 0xE1, 0x27, 0xE0, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0, 0x25, 0xE8,
+0x25, 0xE1, 0x40, 0xEA, 0x90, 0x41, 0x90, 0xE1, 0xD1, 0xE0, 0xD0, 0x90, 0x30, 0x09, 0x80, 0x40,
+0xE1, 0x22, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0xD0, 0x60, 0x50, 0x30, 0xA0, 0xF0, 0x01, 0x80, 0x70,
+0x0B, 0x03, 0x30, 0xA0, 0x80, 0x50, 0x02, 0x30, 0x02, 0xA0, 0xD0, 0xE6, 0x28, 0xE1, 0x22, 0xE3,
+0x20, 0xE4, 0x90, 0x41, 0x91, 0xE0, 0xD0, 0xE2, 0x26, 0xE1, 0x40, 0xD0, 0xE1, 0x26, 0xE1, 0x23,
+0xE4, 0xD0, 0x90, 0x30, 0x51, 0x70, 0x02, 0x60, 0x04, 0x80, 0x70, 0x0B, 0x51, 0xC0, 0x50, 0x0D,
+0x70, 0x60, 0x80, 0x70, 0xD0, 0xE1, 0x24, 0xE0, 0x23, 0xE0, 0x20, 0xE1, 0x20, 0xD0, 0xE0, 0x40,
+0x90, 0xE4, 0x24, 0xE0, 0x20, 0xD0, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0xD1, 0x40, 0x30, 0xA0, 0x50,
+0x00, 0x10, 0x60, 0x30, 0x01, 0x81, 0x02, 0xA0, 0xC0, 0x30, 0xF0, 0x10, 0x70, 0x30, 0xC0, 0x80,
+0x01, 0x50, 0x08, 0x50, 0x30, 0x02, 0xA0, 0x80, 0x60, 0xA0, 0x80, 0xC0, 0x03, 0x30, 0x70, 0x03,
+0xA0, 0x80, 0x02, 0x71, 0x04, 0x80, 0x30, 0x80, 0x10, 0x70, 0x80, 0x31, 0x51, 0x80, 0x70, 0x03,
+0x60, 0xE0, 0xD0, 0xE2, 0x21, 0xE5, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0xE2, 0x23, 0xE3,
+0x40, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE0, 0x27, 0xE0, 0xD0, 0xE1, 0x90,
+0x41, 0x90, 0xD1, 0xE2, 0x23, 0xE0, 0x21, 0xE3, 0x24, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x21,
+0xE2, 0xD1, 0xE0, 0x90, 0x42, 0x90, 0xE1, 0xD0, 0x60, 0x09, 0x60, 0xE2, 0x21, 0xE1, 0x23, 0xE1,
+0x21, 0xE1, 0xA0, 0x02, 0x30, 0x0F, 0x00, 0x07, 0x31, 0xC0, 0xA0, 0x02, 0xA0, 0xD0, 0x2F, 0x04,
+0xE3, 0xD1, 0xE0, 0x90, 0x42, 0xE1, 0xD0, 0xE8, 0x20, 0xE4, 0xD0, 0x90, 0xE2, 0x28, 0xE0, 0x20,
+0xE4, 0xD0, 0x90, 0x41, 0xB0, 0x80, 0x03, 0x80, 0x30, 0x05, 0x60, 0x08, 0xC0, 0x51, 0x02, 0x70,
+0xC0, 0x0A, 0x70, 0x50, 0xC0, 0x12, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x25, 0xE3, 0xD0, 0x90, 0x40,
+0xD1, 0x21, 0xE3, 0x20, 0xE0, 0x22, 0xE0, 0x90, 0x40, 0xE2, 0x24, 0xE0, 0xD0, 0x40, 0x90, 0x30,
+0x70, 0x00, 0xC0, 0x60, 0x02, 0xA1, 0x01, 0x30, 0x02, 0x11, 0x70, 0x30, 0x70, 0x80, 0x01, 0x50,
+0x08, 0xA0, 0xC0, 0x02, 0xA0, 0x80, 0xC0, 0x04, 0x70, 0x50, 0x71, 0x04, 0x80, 0x60, 0x02, 0x50,
+0xC0, 0x02, 0x80, 0x10, 0xC0, 0x00, 0x10, 0x70, 0x04, 0x80, 0x50, 0x02, 0xA0, 0x40, 0xD0, 0xE1,
+0x24, 0xE5, 0x20, 0xE0, 0x90, 0x40, 0x90, 0xD1, 0x20, 0xE2, 0x23, 0xE0, 0x91, 0xE2, 0x41, 0xE0,
+0xD1, 0xE0, 0x25, 0xE0, 0x23, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xE0,
+0xD1, 0x26, 0xE8, 0x91, 0xE0, 0x21, 0xE1, 0x22, 0xE5, 0x21, 0xE1, 0x90, 0x42, 0x30, 0xC0, 0x07,
+0x10, 0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xB0, 0x01, 0xC0,
+0x80, 0x0F, 0x00, 0x07, 0x30, 0x51, 0x80, 0x51, 0x80, 0xF0, 0x90, 0xE0, 0x27, 0xE0, 0x24, 0xE7,
+0x91, 0x41, 0x90, 0xE5, 0x20, 0xE2, 0x20, 0xE6, 0x20, 0xE3, 0x90, 0xD0, 0xE0, 0x20, 0xE2, 0x23,
+0xE2, 0xD0, 0xE2, 0x90, 0x40, 0x90, 0xE0, 0xD1, 0x60, 0xC0, 0x01, 0xA0, 0x10, 0xC0, 0x05, 0x50,
+0x60, 0x05, 0xC0, 0x50, 0x70, 0x05, 0x50, 0x08, 0xC0, 0x50, 0x70, 0x04, 0xA1, 0xD2, 0xE2, 0x23,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x21,
+0xE0, 0x90, 0x40, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xD1, 0x31, 0xC0, 0x31, 0x05,
+0xA0, 0x01, 0xC0, 0x11, 0x50, 0xA0, 0xC0, 0x30, 0x70, 0x00, 0x70, 0x05, 0x30, 0x61, 0x30, 0x02,
+0x80, 0x50, 0x03, 0xC0, 0x70, 0x50, 0xC0, 0x01, 0x50, 0x00, 0xC0, 0x80, 0x60, 0xA0, 0x31, 0xA1,
+0x60, 0xA0, 0x30, 0x50, 0xA1, 0x50, 0xC0, 0xA0, 0x00, 0x50, 0x10, 0x05, 0x30, 0xC0, 0x00, 0x50,
+0xB0, 0xD0, 0xE1, 0x25, 0xE5, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0x40, 0x90, 0xD1, 0xE1, 0x22, 0xE1,
+0x40, 0xE1, 0x20, 0xE2, 0x41, 0x90, 0xE0, 0x25, 0xE0, 0x21, 0xE3, 0x25, 0xE0, 0xD1, 0xE0, 0x90,
+0x40, 0x90, 0xE5, 0x24, 0xE4, 0xD0, 0x40, 0xE0, 0x27, 0xE3, 0x24, 0xE0, 0xD0, 0xE1, 0xD0, 0x81,
+0x50, 0x70, 0xC0, 0x02, 0x80, 0x10, 0xD2, 0x20, 0xE1, 0x21, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0x60,
+0x80, 0x50, 0x80, 0x50, 0x0F, 0x00, 0x07, 0x50, 0x80, 0x00, 0xC0, 0xA0, 0x70, 0xC0, 0x70, 0xB0,
+0xD0, 0x23, 0xE6, 0x21, 0xE1, 0xD1, 0xE0, 0x91, 0x41, 0x90, 0xE6, 0x26, 0xE5, 0x20, 0xE1, 0x20,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xEA, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x90,
+0x30, 0x01, 0x30, 0x10, 0xC0, 0x06, 0x70, 0x60, 0x02, 0xC0, 0x50, 0x70, 0x07, 0x70, 0xC0, 0x06,
+0x50, 0x70, 0x07, 0x80, 0x60, 0x30, 0x90, 0xD0, 0xE1, 0x23, 0xE3, 0x91, 0xE2, 0x20, 0xE1, 0x20,
+0xE0, 0x20, 0xE1, 0x20, 0xE2, 0x40, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0xD1, 0x30,
+0x80, 0xC0, 0x30, 0x50, 0x01, 0xC1, 0x00, 0x30, 0x02, 0x50, 0x10, 0xF1, 0x61, 0xF0, 0xA0, 0x80,
+0x04, 0x30, 0x50, 0x00, 0x50, 0x03, 0x60, 0x02, 0xC0, 0x50, 0x70, 0x51, 0x02, 0x50, 0x30, 0xA0,
+0x50, 0xC0, 0x02, 0x70, 0xC0, 0x01, 0x31, 0x70, 0x02, 0x50, 0x80, 0x07, 0xA0, 0x70, 0xC0, 0xA0,
+0xD1, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x21, 0xE0, 0x23, 0x90, 0xA0, 0xD0, 0x20, 0x41, 0xE0, 0xD0,
+0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0x20, 0xE1, 0x20, 0xE2, 0x90, 0x40, 0x90, 0xD1, 0xE4, 0x20,
+0xE0, 0x21, 0xE1, 0x23, 0xE6, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE1, 0x23, 0xE2, 0x20, 0xE1, 0x40,
+0xD0, 0xE0, 0x20, 0xE2, 0x23, 0xE0, 0x23, 0xE3, 0xD0, 0x20, 0xE0, 0xD0, 0xB0, 0x50, 0x00, 0xC0,
+0x70, 0x50, 0x70, 0x80, 0x30, 0x90, 0xD1, 0xE2, 0x23, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0xD0, 0x30,
+0x70, 0xC0, 0x70, 0xA0, 0x0F, 0x01, 0x0B, 0xA0, 0x02, 0x60, 0xD0, 0xE0, 0x22, 0xEA, 0x90, 0x41,
+0x91, 0xE0, 0xD0, 0xE2, 0x20, 0xE1, 0x21, 0xE0, 0x23, 0xE0, 0x24, 0xE1, 0x23, 0xE0, 0x20, 0xE0,
+0x40, 0xEA, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE2, 0x21, 0xE0, 0xD0, 0x30, 0x70, 0x01, 0x10, 0xA0,
+0x07, 0x50, 0x80, 0xC0, 0x50, 0x70, 0x0A, 0x50, 0x04, 0x51, 0xC0, 0x0A, 0xC0, 0x60, 0x90, 0xD0,
+0xE1, 0x22, 0xE2, 0x40, 0x90, 0xD0, 0xE1, 0x23, 0xE0, 0x22, 0xE2, 0xD0, 0x40, 0xE1, 0x21, 0xE0,
+0x20, 0xE0, 0x20, 0xE2, 0x91, 0xD0, 0xE2, 0xD0, 0xB0, 0x30, 0xB0, 0x82, 0x13, 0x50, 0xC0, 0x80,
+0xA1, 0xB0, 0xD4, 0x60, 0x80, 0x02, 0x70, 0x30, 0x06, 0xA0, 0x71, 0x80, 0x70, 0x00, 0xC0, 0xA0,
+0x50, 0x60, 0xA1, 0x60, 0x50, 0xC0, 0x08, 0x50, 0x60, 0x50, 0x00, 0x50, 0x01, 0xA0, 0x07, 0x30,
+0x00, 0x81, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x20,
+0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD1, 0xE1, 0xD0, 0x40, 0xD0, 0xE1, 0x23, 0xE1, 0xD0, 0xE0, 0x90,
+0x40, 0x90, 0xD1, 0xE5, 0x20, 0xE1, 0x20, 0xE0, 0x25, 0xE0, 0x21, 0xE0, 0xD0, 0xE0, 0x90, 0x41,
+0xE3, 0x20, 0xE1, 0x21, 0xE2, 0x90, 0xE0, 0x20, 0xE3, 0x26, 0xE1, 0x22, 0xE2, 0x20, 0xD0, 0xB0,
+0x70, 0x03, 0x80, 0x30, 0x90, 0x41, 0x90, 0x20, 0xE4, 0x23, 0xE1, 0x21, 0xE0, 0xD0, 0xA0, 0x02,
+0x30, 0x0F, 0x01, 0x0B, 0x30, 0x01, 0x70, 0xF0, 0xE1, 0x22, 0xE3, 0xD1, 0xE0, 0x90, 0x42, 0x90,
+0xE0, 0xD0, 0xE7, 0x24, 0xE3, 0x2A, 0xE0, 0x21, 0xE0, 0x91, 0xE4, 0xD1, 0x90, 0x41, 0x90, 0xE0,
+0xD0, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0xD0, 0x90, 0x30, 0x00, 0x70, 0xF0, 0x80, 0x07, 0x70, 0x30,
+0x50, 0x0C, 0x71, 0x01, 0x70, 0x50, 0xC0, 0x0E, 0x60, 0x90, 0xE1, 0x21, 0xE0, 0xD0, 0xE0, 0x40,
+0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x40, 0xE5, 0x20, 0xE0, 0x21, 0xE1, 0x40,
+0xD1, 0xE0, 0x21, 0xE0, 0xD0, 0x90, 0xA0, 0xB0, 0x40, 0xD0, 0x92, 0x30, 0xA1, 0x40, 0xD4, 0xE1,
+0xD0, 0x80, 0xA0, 0x70, 0x30, 0x50, 0x10, 0x80, 0x03, 0xC0, 0x70, 0x51, 0xA0, 0x00, 0xC0, 0x70,
+0x00, 0x60, 0x06, 0x50, 0x08, 0xC0, 0x10, 0x80, 0xF0, 0x10, 0x70, 0x30, 0x50, 0x07, 0x81, 0xA0,
+0xE0, 0x40, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x24, 0xE5, 0x21, 0xE0, 0xD1, 0x90, 0x40, 0x90, 0xD1,
+0x40, 0x90, 0xE1, 0x26, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE3, 0x21, 0xE0, 0x21,
+0xE1, 0x20, 0xE2, 0x20, 0xE1, 0x21, 0xE2, 0xD0, 0x90, 0x41, 0x90, 0xD0, 0xE0, 0x20, 0xE2, 0xD0,
+0x90, 0xE0, 0x20, 0xE5, 0x25, 0xE1, 0x24, 0xE0, 0x20, 0xD0, 0xF0, 0x70, 0x02, 0x70, 0xA0, 0xD0,
+0xE0, 0x21, 0x90, 0x42, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x90, 0x60,
+0x70, 0x00, 0xC0, 0x80, 0x0F, 0x01, 0x0B, 0x80, 0xA0, 0x30, 0x50, 0x30, 0x90, 0xE0, 0xD0, 0xE2,
+0xD0, 0xE1, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE2, 0x22, 0xE4, 0x25, 0xE4, 0x28, 0xE2, 0x20, 0xE1,
+0x40, 0xE1, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x27, 0xE2, 0xD0, 0x30, 0x70, 0x10,
+0xC0, 0x06, 0x70, 0x50, 0xC0, 0x00, 0x30, 0x80, 0x0C, 0x50, 0xC0, 0x50, 0x70, 0x0F, 0x01, 0xC0,
+0xA0, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE2, 0x21, 0xE1, 0x25, 0xE1, 0xD0, 0x40, 0x90,
+0xD0, 0x20, 0xE2, 0x20, 0xE0, 0x21, 0xE1, 0x91, 0xD0, 0xE1, 0x23, 0xE0, 0xD0, 0x40, 0xD1, 0xE3,
+0x90, 0x41, 0x93, 0x21, 0xE0, 0x91, 0x30, 0x60, 0xF0, 0x30, 0x80, 0xF0, 0xA0, 0x70, 0x51, 0x70,
+0xC0, 0x01, 0xA0, 0x51, 0x31, 0x10, 0x06, 0x71, 0x07, 0xF0, 0x30, 0x00, 0xC0, 0x50, 0x80, 0xA0,
+0x03, 0x50, 0x04, 0xF0, 0xB0, 0xD0, 0x90, 0x40, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x24, 0xE3,
+0x20, 0xE6, 0xD0, 0x41, 0x90, 0x40, 0xD1, 0xE2, 0x20, 0xE0, 0x24, 0xE2, 0xD0, 0x90, 0x40, 0x90,
+0xE2, 0x25, 0xE0, 0x22, 0xE4, 0x23, 0xE2, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE4, 0x40, 0xE8, 0x24,
+0xE1, 0x26, 0xD0, 0x60, 0x03, 0xA0, 0xE1, 0x22, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x91, 0x20, 0xD0,
+0xE2, 0x20, 0xD0, 0x40, 0x81, 0x30, 0x60, 0x50, 0x0F, 0x01, 0x0B, 0x70, 0x80, 0x01, 0x50, 0xB0,
+0xD1, 0xE1, 0x90, 0x41, 0x90, 0xE1, 0xD1, 0xE0, 0x24, 0xE2, 0x2A, 0xE0, 0x29, 0xE0, 0x22, 0xE1,
+0x20, 0xD0, 0x40, 0xE1, 0x90, 0x40, 0x90, 0xE4, 0xD0, 0xE0, 0x28, 0xE1, 0xD0, 0x90, 0xF0, 0xA0,
+0x50, 0x03, 0xC0, 0x70, 0x50, 0xC0, 0x03, 0x30, 0x70, 0x0B, 0x51, 0x0F, 0x04, 0x80, 0xB0, 0xD0,
+0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0x23, 0xE1, 0x91, 0xD0, 0x20, 0xE1,
+0x20, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xE5, 0xD0, 0xE0,
+0x40, 0xE0, 0x93, 0x43, 0x93, 0xA0, 0xB0, 0xA0, 0xC0, 0x50, 0x05, 0x30, 0x60, 0x70, 0x00, 0xF0,
+0x02, 0x50, 0x01, 0x70, 0x00, 0x50, 0x06, 0x50, 0x30, 0x01, 0x80, 0xA1, 0x10, 0x30, 0x02, 0xA0,
+0x03, 0x50, 0x60, 0xD0, 0xE2, 0x40, 0x90, 0xE1, 0x21, 0xE0, 0x21, 0xE4, 0x21, 0xE1, 0x23, 0xE1,
+0x20, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE2, 0x27, 0xE0, 0xD0, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90,
+0x20, 0xD0, 0xE0, 0x22, 0xE4, 0x22, 0xE3, 0x25, 0xE2, 0x91, 0x40, 0x90, 0xE0, 0x91, 0xE0, 0x20,
+0xE0, 0x21, 0xE5, 0x21, 0xE3, 0x25, 0xD0, 0x60, 0x02, 0xC0, 0x60, 0xD0, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE2, 0xD0, 0xE1, 0x91, 0x41, 0x90, 0xE1, 0xD1, 0x30, 0xC0, 0x01, 0x30, 0xC0, 0x0F, 0x01,
+0x0C, 0xA0, 0x02, 0xA0, 0x90, 0x42, 0x90, 0xE0, 0xD1, 0xE3, 0x24, 0xE4, 0x25, 0xE2, 0x26, 0xE0,
+0x20, 0xE1, 0x21, 0xE6, 0x42, 0x90, 0xE0, 0xD0, 0x21, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0x22, 0xE1,
+0x22, 0xE0, 0x90, 0xB0, 0x00, 0xA0, 0x02, 0x51, 0xC0, 0x05, 0x51, 0x09, 0x70, 0x50, 0x00, 0x50,
+0x0F, 0x05, 0x30, 0xB0, 0xD0, 0x90, 0x40, 0xE1, 0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xD0,
+0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0x90, 0xE0, 0x20,
+0xE1, 0x21, 0xE1, 0xD0, 0x40, 0x21, 0xE2, 0x20, 0xE2, 0x40, 0xD0, 0xE1, 0xD3, 0xE0, 0x40, 0xD3,
+0xE0, 0xD0, 0xA0, 0x70, 0x81, 0x31, 0x80, 0x30, 0x80, 0x50, 0xA0, 0x00, 0x50, 0x80, 0x70, 0x60,
+0xC0, 0x80, 0x01, 0x70, 0x00, 0xC0, 0x70, 0x05, 0x30, 0x70, 0x01, 0x10, 0x70, 0x80, 0x10, 0x70,
+0x06, 0xC0, 0x60, 0xD1, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE4, 0x23, 0xE2, 0x25,
+0xE1, 0x40, 0x90, 0x40, 0x90, 0xE1, 0xD1, 0xE1, 0x25, 0xE4, 0xD0, 0x90, 0x41, 0x20, 0xE2, 0x21,
+0xE2, 0x23, 0xE3, 0x25, 0xE1, 0xD0, 0xE1, 0x90, 0x41, 0x90, 0xD0, 0xE0, 0xD1, 0x22, 0xE2, 0x22,
+0xE4, 0x21, 0xE0, 0x20, 0xE0, 0x90, 0x30, 0x02, 0xA0, 0x40, 0xD0, 0xE0, 0x20, 0xEA, 0xD0, 0xE0,
+0x91, 0x41, 0xD0, 0xA0, 0x02, 0xA0, 0x0F, 0x02, 0x0C, 0x30, 0x80, 0x31, 0x60, 0x90, 0xD0, 0xE0,
+0x21, 0xE0, 0x23, 0xE7, 0x22, 0xEF, 0x01, 0x20, 0xE6, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0x40, 0xD0,
+0xE1, 0x24, 0xE3, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x30, 0x00, 0xA0, 0x00, 0x50,
+0x30, 0x08, 0x60, 0x70, 0x07, 0x70, 0x50, 0xC0, 0x02, 0x50, 0x0F, 0x05, 0x80, 0xA0, 0xB0, 0xD0,
+0xE2, 0x22, 0xD0, 0xE3, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0xD0, 0x91, 0xD0,
+0xE0, 0x22, 0xE4, 0x40, 0xE3, 0x20, 0xE2, 0x91, 0xD0, 0xE6, 0x40, 0xD0, 0xE0, 0x91, 0xD1, 0x60,
+0x80, 0x30, 0x80, 0xC0, 0xA0, 0x30, 0x80, 0x70, 0x80, 0x50, 0x00, 0x80, 0x50, 0x08, 0x50, 0xC0,
+0x04, 0x10, 0x70, 0x80, 0xA0, 0xF0, 0x50, 0x30, 0xA0, 0x50, 0x30, 0xF0, 0x30, 0x50, 0x02, 0x81,
+0xD0, 0xE0, 0x20, 0xE2, 0xD0, 0x41, 0xD0, 0xE0, 0x20, 0xE3, 0x25, 0xE1, 0x22, 0xE0, 0x20, 0xE0,
+0xD0, 0x40, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x21,
+0xE2, 0xD0, 0xE0, 0x41, 0x90, 0xD1, 0xE2, 0x24, 0xE7, 0x23, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0x90,
+0x41, 0xE1, 0xD0, 0xE0, 0x21, 0xE3, 0x22, 0xE6, 0xD0, 0xF0, 0xC0, 0x01, 0x50, 0xB0, 0xD0, 0xE4,
+0x20, 0xE0, 0x22, 0xE9, 0x40, 0x60, 0x31, 0x81, 0x0F, 0x02, 0x0C, 0x81, 0x01, 0x80, 0x40, 0xD0,
+0x27, 0xE2, 0x23, 0xE2, 0x21, 0xE9, 0x21, 0xEB, 0x90, 0x40, 0x90, 0x20, 0xE0, 0xD0, 0x91, 0xE0,
+0x24, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0xD0, 0x90, 0xA0, 0xC0, 0x30, 0x71,
+0xA0, 0x08, 0x80, 0x70, 0x05, 0xC0, 0x50, 0x70, 0x04, 0x71, 0x0F, 0x04, 0x50, 0x00, 0xA0, 0xE1,
+0x25, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0x21, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD0,
+0x40, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x91, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x91, 0xE2, 0x22, 0xE1,
+0x40, 0xD1, 0x91, 0xD0, 0x40, 0x10, 0x50, 0x80, 0x70, 0x00, 0x51, 0x60, 0xC0, 0x02, 0x51, 0x09,
+0x50, 0x04, 0xA0, 0x61, 0x70, 0x30, 0x50, 0x10, 0x30, 0x70, 0x00, 0x70, 0xC0, 0x50, 0xF0, 0x01,
+0x60, 0xE0, 0xD0, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE2, 0x24, 0xE1, 0x20, 0xE2, 0x21,
+0xE0, 0xD0, 0x91, 0xE3, 0xD0, 0x90, 0x40, 0x20, 0xD0, 0x20, 0xE2, 0xD0, 0xE1, 0x25, 0xE1, 0xD1,
+0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE5, 0x22, 0xE0, 0x23, 0xE0, 0x91, 0xD0,
+0xE1, 0x90, 0x40, 0x91, 0xE1, 0xD1, 0xE0, 0x24, 0xE4, 0xD0, 0x90, 0xB0, 0x02, 0xA0, 0xE0, 0x20,
+0xE3, 0x21, 0xE1, 0x21, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xD0, 0xB0, 0x70, 0x01, 0xA0, 0x70,
+0x0F, 0x02, 0x0C, 0x70, 0x80, 0x01, 0x70, 0xB0, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE2, 0x20, 0xE1,
+0x22, 0xE0, 0x2F, 0x00, 0xE3, 0xD1, 0x20, 0x90, 0x40, 0x90, 0xE2, 0xD0, 0xE1, 0x90, 0x40, 0xE1,
+0x22, 0xE1, 0x22, 0xE2, 0x22, 0xE0, 0x22, 0xD0, 0xE0, 0x90, 0xB0, 0xC0, 0xA0, 0x70, 0xC0, 0xA0,
+0x08, 0x51, 0x04, 0x51, 0x07, 0x50, 0x0F, 0x02, 0xC0, 0x50, 0x01, 0x30, 0x40, 0xD0, 0x22, 0xE1,
+0x24, 0xE1, 0xD0, 0x40, 0xE2, 0x21, 0xE1, 0x24, 0xD0, 0x91, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x40,
+0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0x21, 0xE5, 0x40, 0xD0, 0xB0, 0x90, 0xD1, 0x40, 0x10,
+0x71, 0xC0, 0x01, 0x50, 0x80, 0x03, 0x80, 0x30, 0x09, 0x70, 0xC0, 0x02, 0x50, 0xF0, 0x50, 0x60,
+0x70, 0x11, 0xA0, 0x00, 0x70, 0x80, 0xA0, 0x01, 0x50, 0xA0, 0x80, 0xF0, 0xD1, 0xE0, 0x22, 0xE0,
+0x20, 0xE2, 0x40, 0xE2, 0x23, 0xE2, 0x23, 0x40, 0xE3, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0xD0, 0x20,
+0x40, 0x90, 0xE3, 0x24, 0xE5, 0x20, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x27, 0xE6,
+0x21, 0xD0, 0x40, 0xE3, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE2, 0x27, 0xE1, 0xD0, 0x90, 0xF0, 0x70,
+0x00, 0xA0, 0xB0, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0x20, 0xE2, 0x26, 0xD0, 0xA0, 0x02, 0x30,
+0xC0, 0x0F, 0x02, 0x0D, 0x30, 0x00, 0xC0, 0xB0, 0x60, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x20,
+0xE2, 0x22, 0xE0, 0x2F, 0x01, 0xE3, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE1, 0x23, 0xE1, 0x40,
+0xD0, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x22, 0xE4, 0x90, 0x41, 0xB0, 0x00, 0x60, 0x01,
+0xC0, 0x08, 0xC0, 0xA0, 0x80, 0x01, 0x70, 0x50, 0xC0, 0x08, 0xC0, 0x50, 0x0F, 0x00, 0xC0, 0x50,
+0x02, 0x80, 0x40, 0xD0, 0x23, 0xE0, 0x24, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0x25, 0xE0, 0x22, 0xD0,
+0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xE1, 0x20, 0x40, 0xD0, 0x22, 0xE1, 0x20, 0xE1, 0x40, 0x23, 0xE4,
+0x40, 0xD0, 0xB0, 0x90, 0xE0, 0xD0, 0xB0, 0x30, 0x01, 0x70, 0x01, 0xC0, 0x60, 0xC0, 0x01, 0xC0,
+0x60, 0xA0, 0x0A, 0x50, 0x02, 0x30, 0x10, 0x60, 0xF0, 0x71, 0x02, 0xC0, 0x30, 0x80, 0x03, 0x80,
+0x10, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0xE0, 0x40, 0xE2, 0x21, 0xE4, 0x22, 0xE3,
+0x40, 0xE2, 0x22, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x24, 0xE3, 0x23, 0xE3, 0x90, 0x40,
+0x90, 0xE0, 0xD0, 0xE0, 0x25, 0xE3, 0x24, 0xE1, 0x40, 0xD0, 0xE2, 0x20, 0xE1, 0xD0, 0xE0, 0x90,
+0x41, 0x90, 0xE4, 0x23, 0xE1, 0xD0, 0x90, 0xF0, 0x60, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x25, 0xE2,
+0x25, 0xE0, 0xD0, 0xF0, 0x80, 0xC0, 0x00, 0xA0, 0x0F, 0x03, 0x0D, 0x30, 0xA0, 0x30, 0xC0, 0x30,
+0x90, 0xD0, 0xE0, 0x23, 0xE4, 0x27, 0xE0, 0x20, 0xE0, 0x26, 0xE3, 0xD0, 0xE1, 0x41, 0x90, 0xE0,
+0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xE3, 0x21, 0xE4, 0x21, 0xE1, 0xD0, 0xE0,
+0x41, 0x90, 0xD0, 0x90, 0x30, 0x00, 0x30, 0xC0, 0x0C, 0x70, 0x60, 0x50, 0x70, 0x0B, 0x50, 0xC0,
+0x0D, 0x70, 0x50, 0x03, 0x30, 0xB0, 0xD0, 0x23, 0xE1, 0x22, 0xE1, 0x91, 0xD0, 0xE0, 0x24, 0xE1,
+0x20, 0xE1, 0xD0, 0x40, 0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE1, 0x90, 0xE0, 0x20, 0xE0, 0x22, 0xE2,
+0xD0, 0x40, 0xE0, 0x21, 0xE5, 0x40, 0xD0, 0x21, 0xE0, 0x90, 0x10, 0x70, 0xA0, 0x00, 0x50, 0x02,
+0x80, 0x70, 0x01, 0x60, 0x00, 0x30, 0x70, 0x09, 0xC0, 0x70, 0x02, 0x10, 0x00, 0xA0, 0xC0, 0x05,
+0x70, 0xC0, 0x02, 0x30, 0xA0, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE4, 0xD0, 0x40, 0x90, 0xD0, 0xE3,
+0x23, 0xE3, 0xD0, 0x91, 0xE1, 0x27, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE2, 0x20,
+0xE2, 0x21, 0xE5, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0x20, 0xE8, 0x23, 0xE0, 0x40, 0x90, 0xE2, 0x20,
+0xE0, 0x22, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xD1, 0xE0, 0x22, 0xE2, 0xD3, 0xE0, 0x22, 0xE1,
+0x26, 0xE1, 0x21, 0xE1, 0x21, 0xE0, 0x90, 0x30, 0x70, 0x30, 0xA0, 0x80, 0x0F, 0x03, 0x0D, 0x70,
+0x50, 0x01, 0x70, 0xB0, 0xD0, 0x23, 0xE3, 0x22, 0xE0, 0x22, 0xE1, 0x23, 0xE0, 0x23, 0xE3, 0xD0,
+0x90, 0x41, 0x90, 0xE5, 0x21, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0xE1, 0x24, 0xE6, 0x41, 0xE2, 0xD0,
+0x40, 0x80, 0x00, 0x51, 0x0B, 0xC0, 0x50, 0x30, 0x0E, 0x80, 0x0C, 0x50, 0x70, 0x04, 0x30, 0x90,
+0xD0, 0x23, 0xE2, 0x21, 0xE0, 0x91, 0xD0, 0xE0, 0x25, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0x22,
+0xE3, 0x22, 0xE0, 0x40, 0xE2, 0x22, 0xE3, 0x40, 0xE0, 0x21, 0xE5, 0x40, 0xD0, 0x21, 0xE0, 0xD0,
+0xF0, 0xA0, 0x01, 0x70, 0x50, 0xA0, 0x70, 0xA0, 0xC0, 0x00, 0x30, 0x70, 0x00, 0x60, 0x50, 0x0A,
+0x50, 0x02, 0x10, 0xA0, 0x50, 0x07, 0x50, 0xC0, 0x01, 0x30, 0x10, 0xE0, 0x24, 0xE0, 0x20, 0xE1,
+0x21, 0xD1, 0x90, 0x40, 0xD0, 0xE1, 0x23, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x24,
+0xE0, 0x21, 0xE2, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE3, 0x20, 0xE0, 0x27, 0xE2, 0xD1, 0x90,
+0x41, 0xE0, 0xD0, 0xE0, 0xD0, 0xE0, 0x25, 0xE3, 0x40, 0xE3, 0x26, 0xE4, 0x90, 0x40, 0x90, 0xE6,
+0x20, 0xE4, 0x2F, 0x00, 0xE0, 0x20, 0xE0, 0xD0, 0xA0, 0xC0, 0x01, 0x30, 0xC0, 0x0F, 0x03, 0x0D,
+0xC0, 0x30, 0x01, 0x70, 0xA0, 0xD0, 0xE0, 0x20, 0xE1, 0x26, 0xE2, 0x22, 0xE2, 0x21, 0xE6, 0x90,
+0x41, 0xE9, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xE1, 0x24, 0xE3, 0x91, 0x40, 0x22, 0xE1,
+0xD0, 0xB0, 0x50, 0x00, 0x70, 0x80, 0x0A, 0x70, 0x50, 0x00, 0x30, 0x50, 0x0C, 0x50, 0x70, 0x50,
+0x0A, 0x50, 0xC0, 0x04, 0x50, 0x30, 0xD0, 0xE0, 0x21, 0xE0, 0x24, 0xE1, 0x40, 0xD0, 0xE2, 0x21,
+0xE0, 0x23, 0xE1, 0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x23, 0xE0, 0x91, 0xE1, 0x23, 0xE2, 0x91, 0xE0,
+0x21, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x10, 0x80, 0x00, 0xA0, 0x30,
+0x80, 0x31, 0x01, 0x30, 0x01, 0x71, 0x0A, 0xC0, 0x70, 0x01, 0x60, 0xF0, 0x09, 0x50, 0x02, 0xA0,
+0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xA0, 0xD0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xD1, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x42, 0xE2, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE2,
+0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x24, 0xE3, 0x23, 0xE5, 0x41, 0xE0, 0xD0, 0xE0, 0x23, 0xE3, 0xD0,
+0x91, 0xE1, 0x20, 0xE0, 0x25, 0xE4, 0x21, 0xE1, 0x90, 0x40, 0x90, 0xE1, 0xD0, 0xE0, 0x23, 0xE2,
+0x20, 0xE7, 0x24, 0xE4, 0x60, 0x02, 0xA0, 0x0F, 0x04, 0x0E, 0xA0, 0x80, 0xA0, 0x80, 0x60, 0xD0,
+0xE4, 0x29, 0xE1, 0x22, 0xE2, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE2, 0x22, 0xE3, 0x22,
+0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0x23, 0xE0, 0xD0,
+0x60, 0xC0, 0x01, 0x30, 0x07, 0xC0, 0x80, 0x50, 0xC0, 0x02, 0x30, 0x0A, 0xC0, 0x50, 0xC0, 0x00,
+0x71, 0x08, 0x50, 0xC0, 0x04, 0x30, 0xF0, 0xE0, 0xD0, 0xE3, 0x23, 0xE0, 0x20, 0x40, 0xE1, 0x20,
+0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xD0, 0x91, 0xD0, 0x23, 0xE1, 0x22, 0xD0, 0x40, 0xE1, 0x22,
+0xE0, 0x21, 0xE0, 0xD0, 0x91, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0xD0, 0x90, 0x60, 0xC0, 0x30, 0xC0, 0x04, 0x60, 0x02, 0x71, 0x0A, 0x50, 0xC0, 0x00, 0x80,
+0x10, 0xC0, 0x09, 0x50, 0x01, 0x30, 0xF0, 0xD1, 0xE0, 0x25, 0x40, 0x20, 0xE1, 0x20, 0xD0, 0x90,
+0x40, 0xE4, 0x21, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0x90, 0x40, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x24,
+0xE0, 0xD1, 0x90, 0x40, 0x90, 0xE5, 0x24, 0xE0, 0x21, 0xE5, 0xD0, 0x20, 0x41, 0xE0, 0x25, 0xE0,
+0xD1, 0x40, 0xE1, 0x20, 0xE1, 0x27, 0xE3, 0x20, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD0, 0xE3,
+0x21, 0xE2, 0x21, 0xE4, 0x27, 0xD0, 0x90, 0xA0, 0x30, 0xA0, 0x80, 0x30, 0x0F, 0x04, 0x0E, 0x81,
+0x01, 0x80, 0x40, 0x20, 0xE3, 0x21, 0xE2, 0x27, 0xE2, 0xD1, 0x90, 0x41, 0x90, 0xD0, 0xEB, 0x22,
+0xE3, 0x23, 0xD0, 0x40, 0x20, 0xE4, 0xD0, 0x90, 0x40, 0x90, 0xE5, 0x20, 0xE1, 0xD0, 0x60, 0x02,
+0xA0, 0x00, 0x60, 0xA0, 0x03, 0xC0, 0x30, 0x70, 0x30, 0xA0, 0x30, 0x01, 0xA0, 0x09, 0x50, 0x70,
+0x03, 0x50, 0xC0, 0x05, 0xC0, 0x80, 0x04, 0x80, 0xA0, 0xB0, 0xD0, 0xE4, 0x22, 0xE2, 0x40, 0xE2,
+0x20, 0xE3, 0x25, 0xE0, 0x40, 0xE2, 0x21, 0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x21,
+0xE0, 0xD0, 0x40, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xD1,
+0xF1, 0xC0, 0x01, 0x50, 0xC0, 0x10, 0x70, 0x03, 0x50, 0x0B, 0x50, 0x00, 0x50, 0x10, 0x80, 0x09,
+0xC0, 0x50, 0x00, 0x30, 0x90, 0xD0, 0xE1, 0x23, 0xE0, 0x20, 0xE3, 0xD2, 0xE0, 0x40, 0xE0, 0xD0,
+0xE3, 0xD0, 0x90, 0x40, 0xD0, 0xE2, 0x40, 0x90, 0xD0, 0xE2, 0x23, 0xE2, 0x20, 0xE0, 0x21, 0xE0,
+0x90, 0x40, 0xE0, 0xD0, 0xE4, 0x23, 0xE2, 0x23, 0xE1, 0x22, 0x41, 0x90, 0xD0, 0xE1, 0x20, 0xE1,
+0x91, 0xD0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE5, 0x20, 0xE4, 0x90, 0x41, 0xE3, 0x23,
+0xE6, 0x22, 0xE2, 0x21, 0xD0, 0xB0, 0x70, 0x01, 0x30, 0x70, 0x00, 0xC0, 0x0F, 0x02, 0x0F, 0x00,
+0xA0, 0x02, 0x60, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE3, 0x23, 0xE3, 0xD0, 0xE0, 0x41, 0x90, 0xE0,
+0xD1, 0xE8, 0x25, 0xE2, 0x22, 0xE0, 0x21, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0xD0, 0xE0, 0x90, 0x40,
+0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0xD0, 0xA0, 0x02, 0x50, 0x10, 0x70, 0x50, 0x30,
+0x70, 0x00, 0x70, 0x81, 0x02, 0x70, 0xA0, 0x50, 0x80, 0x07, 0xC0, 0x50, 0xC0, 0x05, 0x50, 0x04,
+0x70, 0x50, 0x04, 0x70, 0x60, 0xD1, 0xE1, 0x20, 0xE1, 0x22, 0xE2, 0x40, 0xE4, 0x20, 0xE1, 0x21,
+0xE1, 0x20, 0xE1, 0x40, 0xE3, 0x21, 0xE2, 0x20, 0xE0, 0xD0, 0x91, 0xE1, 0x22, 0xE0, 0x21, 0xE0,
+0xD0, 0x40, 0xE0, 0x22, 0xE0, 0x23, 0xE0, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x20, 0xD1, 0x31, 0x10,
+0xF0, 0xA0, 0x60, 0xC0, 0x04, 0x70, 0xC0, 0x0A, 0x71, 0x00, 0xA0, 0x10, 0x50, 0x00, 0x80, 0x07,
+0x71, 0xC0, 0x60, 0xD1, 0xE0, 0x21, 0xE4, 0x21, 0xE0, 0xD0, 0x10, 0x40, 0xD0, 0xE0, 0x40, 0x90,
+0xE2, 0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0x20, 0xD0, 0xE1, 0x24, 0xE4, 0x20,
+0xE1, 0x40, 0x90, 0xE0, 0xD1, 0x27, 0xE2, 0x21, 0xE0, 0x22, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90,
+0xE2, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x22, 0xE3, 0x22, 0xE2,
+0xD0, 0xE0, 0x90, 0x40, 0x90, 0xEA, 0x21, 0xE3, 0x21, 0xE0, 0xD0, 0xA0, 0x02, 0x30, 0x00, 0x31,
+0x70, 0x0F, 0x01, 0x0F, 0x00, 0x30, 0xC0, 0x50, 0x30, 0x60, 0xE8, 0x22, 0xE5, 0x90, 0x40, 0x90,
+0xE4, 0x20, 0xE2, 0x21, 0xE1, 0x20, 0xE1, 0x29, 0xE2, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x41, 0x90,
+0xE5, 0x20, 0xE3, 0x20, 0xE0, 0xD0, 0xA0, 0x03, 0xA0, 0x01, 0xC0, 0xA0, 0x30, 0x80, 0x51, 0x03,
+0x70, 0x10, 0xC0, 0x06, 0x70, 0x50, 0x07, 0xC0, 0x50, 0x02, 0x50, 0x70, 0x03, 0x80, 0x30, 0xA0,
+0xE0, 0xD0, 0x21, 0xE3, 0x22, 0xE1, 0x91, 0xD0, 0x22, 0xE1, 0x20, 0xE0, 0x21, 0xE3, 0x20, 0x40,
+0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x25, 0xE0, 0xD0,
+0x40, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xE0, 0x90, 0xA0, 0x30,
+0x71, 0x53, 0x02, 0xC0, 0x70, 0x0B, 0x50, 0x01, 0xA0, 0x10, 0x00, 0x61, 0x07, 0x70, 0xC0, 0x30,
+0x60, 0xE1, 0x21, 0x90, 0xD0, 0xE4, 0xD0, 0x80, 0x30, 0xA0, 0x90, 0xD0, 0xE0, 0x91, 0xD1, 0xE0,
+0x40, 0xE3, 0x21, 0xE1, 0x20, 0x40, 0x90, 0xE0, 0x20, 0xE4, 0x22, 0xE4, 0xD0, 0x90, 0x40, 0x90,
+0xE2, 0x23, 0xE1, 0x22, 0xE3, 0x23, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE1, 0x40, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0x28, 0xE0, 0x20, 0xE5, 0x22, 0xE2, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0,
+0x25, 0xE3, 0x22, 0xE0, 0x90, 0x60, 0x30, 0x71, 0x80, 0xC0, 0x81, 0x70, 0x0F, 0x01, 0x0F, 0x00,
+0x80, 0xA0, 0x50, 0x00, 0x80, 0x40, 0xD0, 0xE5, 0x21, 0xE2, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD1,
+0xE2, 0x22, 0xE1, 0x24, 0xE1, 0x29, 0xE5, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE7, 0x21, 0xE1,
+0x20, 0xD0, 0xA0, 0x01, 0x70, 0xA0, 0x30, 0x00, 0x71, 0x30, 0x80, 0x50, 0xF0, 0x05, 0xF0, 0x06,
+0x50, 0x70, 0x09, 0x71, 0x00, 0x50, 0xC0, 0x04, 0xF0, 0xA0, 0xE0, 0xD0, 0x24, 0xE2, 0x21, 0xE0,
+0x90, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x90, 0xE2, 0x21, 0xE0, 0x20, 0xE1,
+0x21, 0xE1, 0x40, 0xE2, 0x22, 0xE1, 0x21, 0xE0, 0x40, 0xE0, 0x22, 0xE1, 0x20, 0xE2, 0x40, 0xD0,
+0xE3, 0x22, 0xE0, 0xD0, 0xB0, 0x10, 0x82, 0x50, 0x70, 0xA0, 0x03, 0x80, 0xA0, 0xC0, 0x50, 0x08,
+0xC0, 0x50, 0x30, 0xF0, 0x10, 0xF0, 0x80, 0x50, 0x00, 0x70, 0x06, 0x51, 0xF0, 0xB0, 0xD0, 0xE0,
+0x90, 0xF0, 0x40, 0xB0, 0xD0, 0xE3, 0x60, 0x50, 0x70, 0xB0, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0x40,
+0x90, 0xD0, 0xE1, 0x23, 0xE0, 0xD1, 0x90, 0x40, 0xE4, 0x22, 0xE0, 0x20, 0xE4, 0xD1, 0x90, 0x40,
+0x90, 0xE3, 0x24, 0xE1, 0x20, 0xE3, 0x22, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0x90, 0xD1, 0xE3, 0x20,
+0xE0, 0x2B, 0xE2, 0x21, 0xE0, 0x21, 0xE2, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xE2, 0x21, 0xE2, 0x23,
+0xE0, 0xD0, 0xB0, 0x50, 0x00, 0x50, 0xA0, 0x50, 0x00, 0x71, 0x0F, 0x02, 0x0C, 0x70, 0x60, 0x70,
+0xC0, 0x80, 0x01, 0xC0, 0x30, 0xD0, 0xE3, 0x21, 0xE1, 0xD1, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE0,
+0x25, 0xE1, 0x21, 0xE2, 0x24, 0xE2, 0x24, 0xE4, 0xD0, 0xE0, 0x42, 0xD1, 0xE1, 0x21, 0xE5, 0x22,
+0xE1, 0x90, 0xA0, 0x01, 0x60, 0xC0, 0x00, 0x50, 0x70, 0x03, 0x80, 0x50, 0x04, 0xA0, 0xC0, 0x03,
+0x70, 0x50, 0x0C, 0x70, 0x80, 0x05, 0xC0, 0x10, 0xD0, 0xE0, 0x26, 0xE0, 0x21, 0xD0, 0xE0, 0x40,
+0xD0, 0xE2, 0x25, 0xE2, 0x20, 0xE0, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0x90, 0x40, 0xE4, 0x91, 0xD0,
+0x20, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x21, 0xE2, 0x40, 0x30, 0x04, 0x50, 0x80, 0x01, 0x50, 0x30, 0x81, 0x60, 0xC0, 0x04, 0x80,
+0xC0, 0x00, 0xC0, 0x60, 0xA0, 0x70, 0x01, 0x70, 0x80, 0x12, 0x04, 0x70, 0xA0, 0x81, 0xB0, 0xD0,
+0xE0, 0xD0, 0x40, 0xA0, 0xB0, 0xA0, 0x21, 0xD0, 0x61, 0x00, 0xC0, 0xA0, 0xD0, 0xE1, 0xD0, 0x90,
+0x40, 0x90, 0xD1, 0xE0, 0x24, 0xE2, 0xD0, 0x20, 0x40, 0x90, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20,
+0xE1, 0x20, 0xE0, 0x22, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x23,
+0xE2, 0x23, 0xE0, 0xD1, 0x42, 0xE1, 0xD0, 0xE1, 0x27, 0xE2, 0x26, 0xEA, 0xD0, 0xE0, 0x90, 0x41,
+0x90, 0xD0, 0xE2, 0x24, 0xE0, 0xD0, 0xA0, 0x02, 0x30, 0x01, 0xC0, 0x0F, 0x03, 0x08, 0x71, 0x02,
+0x70, 0x60, 0x00, 0xA0, 0x01, 0x50, 0xF0, 0xE5, 0xD0, 0xE0, 0x91, 0x40, 0x90, 0xE0, 0xD0, 0xE1,
+0x26, 0xE2, 0x21, 0xE2, 0x26, 0xE2, 0x22, 0xE3, 0x90, 0x41, 0xE0, 0xD0, 0x91, 0xE2, 0x21, 0xE3,
+0x25, 0xE0, 0x90, 0x30, 0x01, 0x30, 0x50, 0x70, 0x06, 0xA0, 0x04, 0x30, 0xC0, 0x02, 0x50, 0x70,
+0x0C, 0xC0, 0x51, 0xC0, 0x04, 0xC0, 0x30, 0xD0, 0x23, 0xE0, 0x23, 0xE2, 0x40, 0xE2, 0x20, 0xE0,
+0x23, 0xE3, 0x20, 0xE1, 0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xE3,
+0x22, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x21,
+0xE0, 0xD0, 0x90, 0x60, 0xC0, 0x04, 0x30, 0xA2, 0xC0, 0x70, 0x00, 0x80, 0x70, 0x04, 0x70, 0x01,
+0x80, 0x60, 0x70, 0x04, 0x70, 0x60, 0x10, 0xC0, 0x00, 0xC0, 0x50, 0x31, 0xC0, 0x00, 0x80, 0xB0,
+0xD0, 0xE0, 0x20, 0xD2, 0xE2, 0xD0, 0x10, 0x50, 0x01, 0x30, 0x90, 0xE0, 0x20, 0xD0, 0x90, 0x41,
+0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0x40, 0xE1, 0x20, 0xE1,
+0x20, 0xE0, 0x21, 0xE2, 0x21, 0xE1, 0xD0, 0xE0, 0x41, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE5,
+0x21, 0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0x41, 0x90, 0xE5, 0x24, 0xE1, 0x27, 0xE4, 0x23, 0xE2, 0xD1,
+0xE0, 0x90, 0x40, 0x91, 0xE3, 0x21, 0xE0, 0x90, 0x60, 0x70, 0x01, 0x30, 0xC0, 0xF0, 0x60, 0xF0,
+0x60, 0x70, 0x0F, 0x00, 0x08, 0x30, 0x10, 0xA0, 0xC0, 0x01, 0x80, 0x51, 0xA1, 0x50, 0x80, 0x40,
+0xD0, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0x20, 0xE6, 0x20, 0xE7, 0x29, 0xE4, 0x22, 0xE0, 0xD0,
+0x90, 0x40, 0x90, 0xE3, 0xD0, 0x40, 0xE2, 0x21, 0xE2, 0x24, 0xE1, 0xD0, 0x40, 0x80, 0x00, 0x70,
+0x30, 0xC0, 0x07, 0x50, 0x80, 0x03, 0xA0, 0x70, 0x00, 0xC0, 0x50, 0xC0, 0x0C, 0x71, 0x01, 0x50,
+0x04, 0xC0, 0x30, 0xD0, 0x25, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x26, 0xE2, 0x21, 0xE1, 0x91, 0xD0,
+0xE1, 0x22, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0x20, 0xE1, 0x22, 0xE1, 0x20, 0xE0, 0x40, 0xE1, 0x21,
+0xE2, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x21, 0xE1, 0x90, 0xA0, 0x05, 0xC0, 0x02, 0x50,
+0x00, 0x80, 0xC0, 0x08, 0xA0, 0x71, 0x03, 0x30, 0x70, 0xF1, 0x31, 0x80, 0x70, 0x02, 0xC0, 0x30,
+0xD0, 0xE0, 0xD0, 0xE4, 0xD0, 0x30, 0xF0, 0x01, 0x30, 0xF0, 0x90, 0xE0, 0xD0, 0x90, 0x40, 0xD0,
+0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE4, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0xD0, 0xE2, 0x25,
+0xE0, 0x20, 0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x27, 0xE2, 0x20, 0xE1, 0xD0, 0xE0, 0x40,
+0xD1, 0xE2, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x2F, 0x05, 0xE1, 0x22, 0xE2, 0x91, 0x40,
+0x90, 0xE0, 0xD1, 0xE0, 0xD0, 0x30, 0x51, 0x30, 0xA0, 0x70, 0x30, 0x50, 0x01, 0x70, 0x60, 0x80,
+0x0E, 0x08, 0x70, 0x30, 0xC0, 0x60, 0xA0, 0x80, 0xF0, 0xC1, 0x30, 0x01, 0xC0, 0x30, 0xD0, 0xE0,
+0x90, 0x40, 0x91, 0xE1, 0x24, 0xE9, 0x21, 0xE1, 0x2A, 0xE3, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0xD1,
+0xE3, 0x91, 0xD0, 0x21, 0xE2, 0x26, 0xE0, 0xD0, 0xB0, 0x80, 0x50, 0x00, 0x30, 0xC0, 0x08, 0xA0,
+0x70, 0x02, 0x70, 0x30, 0x80, 0x50, 0x0D, 0x71, 0x50, 0x02, 0x50, 0x03, 0xC0, 0xA0, 0xD0, 0x23,
+0xE4, 0xD0, 0x40, 0x90, 0xD0, 0x27, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE3, 0x21, 0xE1, 0x20,
+0xE2, 0xD0, 0x91, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x26, 0xE1, 0x40,
+0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xB0, 0xA0, 0x09, 0x70, 0xC0, 0x50, 0x80, 0x05,
+0x71, 0x00, 0x30, 0x70, 0xA0, 0x03, 0x80, 0x50, 0x10, 0x30, 0x06, 0xC0, 0xA0, 0x90, 0xD0, 0xE0,
+0x21, 0xE0, 0xD1, 0x40, 0x10, 0x70, 0x01, 0x80, 0x30, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE0,
+0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x24, 0xE0, 0xD0, 0xE0, 0x91, 0xE2, 0x26, 0xE0, 0x23, 0xE0,
+0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x25, 0xE0, 0xD1, 0x91, 0xE1, 0x20, 0xE1,
+0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0xD0, 0xE0, 0x2F, 0x0B, 0xE1, 0xD0, 0xE0, 0x90, 0x41,
+0x90, 0xE0, 0xD0, 0xA0, 0x02, 0xA0, 0x00, 0x80, 0x30, 0x03, 0xF0, 0x0E, 0x09, 0x60, 0xC0, 0x00,
+0x70, 0x80, 0xC0, 0x01, 0xA0, 0x01, 0x50, 0xF0, 0x41, 0x90, 0x20, 0xE6, 0x22, 0xE0, 0x21, 0xE1,
+0x25, 0xE2, 0x27, 0xE1, 0xD1, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x23, 0xE0, 0xD0, 0x40,
+0xE4, 0x26, 0xE0, 0xD0, 0xE0, 0xB0, 0x70, 0x01, 0x10, 0x70, 0x09, 0xA0, 0x80, 0x01, 0xC0, 0x50,
+0x70, 0x60, 0xC0, 0x0B, 0x50, 0xC0, 0x80, 0x10, 0x03, 0x50, 0x02, 0x50, 0xB0, 0xD0, 0x22, 0xE5,
+0x40, 0x90, 0xD0, 0x29, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE2, 0x23, 0xE4, 0xD0, 0x40, 0xE1,
+0x22, 0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE1, 0x26, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE2, 0xD0, 0x40,
+0x30, 0x0A, 0x50, 0x00, 0x60, 0xC0, 0x31, 0x51, 0x00, 0x70, 0x50, 0x00, 0xA0, 0x00, 0x30, 0x70,
+0x02, 0xA0, 0x80, 0x10, 0x80, 0x07, 0xF0, 0x91, 0xD0, 0xE1, 0xD1, 0xA0, 0x10, 0x03, 0x30, 0xA0,
+0xD0, 0xE0, 0x40, 0xE1, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0xD1, 0xE2, 0x21, 0xE5, 0xD0, 0x90, 0x40,
+0xE4, 0x20, 0xE0, 0x22, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0x22,
+0xE2, 0x22, 0xE3, 0x40, 0xD0, 0xE1, 0x21, 0xE2, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xD1, 0x20, 0xE1,
+0x25, 0xE4, 0x27, 0xE1, 0x22, 0xE1, 0x20, 0xE3, 0xD0, 0xE0, 0x90, 0x41, 0xF0, 0x70, 0x01, 0x30,
+0x01, 0xA0, 0x10, 0x80, 0xC1, 0x60, 0x0E, 0x09, 0x80, 0x50, 0x02, 0xC0, 0x50, 0x00, 0x70, 0xF0,
+0x12, 0xB0, 0xD0, 0xE0, 0x26, 0xE7, 0x26, 0xE2, 0x24, 0xE5, 0x90, 0x40, 0x90, 0xE1, 0x23, 0xE0,
+0x22, 0xE1, 0x91, 0xE0, 0x25, 0xE4, 0x41, 0xA0, 0xC0, 0x00, 0x30, 0x70, 0x0B, 0x80, 0x30, 0x70,
+0x50, 0x01, 0x70, 0x80, 0x0A, 0x50, 0x02, 0xA0, 0xC0, 0x02, 0xC0, 0x50, 0x01, 0x80, 0x40, 0xD0,
+0x22, 0xE2, 0xD1, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x26, 0xE3, 0x40, 0xD0, 0xE2, 0x24, 0xE0, 0x21,
+0xE0, 0x91, 0xD0, 0xE0, 0x22, 0xE0, 0x23, 0xE1, 0x90, 0xD0, 0xE1, 0x21, 0xE0, 0x23, 0xE0, 0x40,
+0xD0, 0xE0, 0x24, 0xE2, 0xD0, 0x40, 0xA0, 0x70, 0x09, 0x50, 0x00, 0x30, 0x80, 0x70, 0xF0, 0x80,
+0xA0, 0x30, 0xA0, 0x60, 0x31, 0xA0, 0x60, 0x50, 0x02, 0xA0, 0x00, 0xA0, 0x10, 0xC0, 0x06, 0x60,
+0xE0, 0x40, 0x90, 0xE0, 0xD0, 0x40, 0xF0, 0x80, 0x04, 0xA0, 0xD1, 0x40, 0xE0, 0xD0, 0x20, 0xE0,
+0x20, 0xE1, 0xD0, 0x40, 0xB0, 0xE0, 0xD0, 0x22, 0xE2, 0x23, 0xE2, 0x40, 0x90, 0xD0, 0xE2, 0x28,
+0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x41, 0xE3, 0x20, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE3, 0x20, 0xE0,
+0x21, 0xE2, 0xD1, 0x90, 0x40, 0x90, 0xE2, 0xD0, 0xE1, 0x22, 0xE4, 0x26, 0xE0, 0x21, 0xE2, 0x21,
+0xE0, 0x22, 0xE2, 0xD1, 0x30, 0x12, 0xF0, 0xC0, 0x02, 0xC0, 0x80, 0x61, 0xC0, 0x0E, 0x0B, 0x70,
+0x00, 0x61, 0xA1, 0x00, 0x10, 0xA0, 0x70, 0xC0, 0xA0, 0xD0, 0xE3, 0x20, 0xE3, 0x2F, 0x02, 0xE4,
+0xD1, 0xE0, 0x92, 0xD0, 0xE2, 0x21, 0xE1, 0x23, 0xE1, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0xD0, 0x90,
+0x40, 0x90, 0xD0, 0xA0, 0x00, 0xC0, 0xA0, 0x0D, 0x81, 0x03, 0xA0, 0x08, 0xC0, 0x50, 0x00, 0x60,
+0x80, 0x06, 0xC0, 0x50, 0x70, 0xA0, 0x90, 0xE0, 0x21, 0xE3, 0xD0, 0x90, 0x40, 0xD0, 0xE2, 0x20,
+0xE3, 0x25, 0xE1, 0x40, 0xE1, 0x25, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xE2, 0x22, 0xE0, 0x20,
+0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE1, 0x22, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x22, 0xE2, 0x20,
+0xE0, 0x90, 0x50, 0x30, 0x09, 0xC0, 0x70, 0x02, 0x30, 0x01, 0xC0, 0x01, 0xC0, 0xA0, 0x30, 0x60,
+0x00, 0x70, 0x00, 0xC0, 0x10, 0x70, 0x80, 0x11, 0xC0, 0x04, 0xC0, 0x60, 0xD1, 0x40, 0xE0, 0xD0,
+0xA0, 0xC0, 0x05, 0xA0, 0xD0, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xD1, 0x40, 0xB0, 0x40,
+0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE3, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x20, 0xD0, 0xE0, 0x23,
+0xE1, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD1, 0xE0, 0x21, 0xE3, 0x20, 0x40, 0xD0,
+0xE3, 0x20, 0xE1, 0x20, 0xE5, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE3, 0x27, 0xE4, 0x2A, 0xE2, 0x20,
+0xE0, 0xD0, 0xA0, 0x00, 0x70, 0x60, 0x10, 0x00, 0xF0, 0xA0, 0x70, 0x0F, 0x04, 0x0A, 0x50, 0x60,
+0x00, 0x70, 0x30, 0x00, 0x60, 0x00, 0x30, 0x02, 0x30, 0xE1, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE3,
+0x2E, 0xE4, 0xD0, 0x90, 0x41, 0x90, 0xE1, 0x20, 0xE0, 0x24, 0xE1, 0x23, 0xE0, 0xD0, 0x91, 0xE7,
+0x40, 0x90, 0xE0, 0xD1, 0x30, 0xC0, 0x51, 0x0B, 0x70, 0x50, 0x00, 0x30, 0x80, 0x02, 0xA0, 0x50,
+0x06, 0x70, 0x50, 0x02, 0x60, 0x10, 0x06, 0x50, 0x30, 0x90, 0xD0, 0xE0, 0x20, 0xE5, 0x40, 0xD0,
+0xE9, 0x23, 0xE1, 0x91, 0xE1, 0x28, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0,
+0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x23, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0,
+0x20, 0xE0, 0x20, 0xD0, 0x90, 0x80, 0xB0, 0x0A, 0x50, 0x70, 0x80, 0xA1, 0x06, 0x50, 0x70, 0x00,
+0x51, 0x30, 0x50, 0x31, 0x50, 0x30, 0x80, 0x04, 0x30, 0x40, 0xD0, 0xE1, 0x41, 0xB0, 0x06, 0xA0,
+0x41, 0xD0, 0xE1, 0x20, 0xE1, 0x20, 0x90, 0xE0, 0xD1, 0xE0, 0x40, 0x90, 0xD0, 0xE2, 0x22, 0xE0,
+0x21, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE0, 0x24, 0xE3, 0x90, 0x40,
+0x90, 0xD0, 0xE4, 0xD0, 0x40, 0x22, 0xE9, 0x20, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xE5, 0x25, 0xE5,
+0x26, 0xE2, 0x23, 0xD0, 0x40, 0x80, 0x02, 0x30, 0x00, 0x80, 0x30, 0xA0, 0xF0, 0x30, 0xC0, 0x0F,
+0x01, 0x0A, 0xA0, 0x70, 0x01, 0xF0, 0x00, 0x80, 0x50, 0x70, 0x50, 0x00, 0x80, 0xA0, 0xB0, 0xD1,
+0xE0, 0x21, 0xE6, 0x22, 0xE0, 0x26, 0xE0, 0x20, 0xE2, 0xD1, 0x90, 0x40, 0x90, 0xE5, 0x2A, 0xE2,
+0xD0, 0x40, 0xE3, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0xF0, 0xC0, 0x30, 0xC0,
+0x0A, 0x50, 0x70, 0x02, 0x80, 0x50, 0x02, 0x80, 0x30, 0x04, 0x50, 0x70, 0x03, 0xA0, 0x10, 0x50,
+0x04, 0x50, 0x00, 0x80, 0xB0, 0xD1, 0xE5, 0x40, 0xE7, 0x21, 0xE3, 0x20, 0xE1, 0xD0, 0x40, 0xE1,
+0x25, 0xE0, 0x21, 0xE1, 0xD0, 0x91, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x22, 0xD0, 0x40, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x90, 0xA0, 0xC0,
+0x0A, 0x70, 0xA0, 0x70, 0xC0, 0x09, 0x80, 0x30, 0x50, 0x02, 0x50, 0x70, 0x80, 0x30, 0x03, 0x31,
+0xD0, 0xE0, 0x20, 0xE1, 0xA0, 0x70, 0x05, 0x50, 0xB0, 0xD0, 0x40, 0x90, 0xE3, 0xD0, 0x60, 0xF0,
+0xD0, 0xE2, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x26, 0xE0, 0xD0, 0xE0, 0x41, 0xD0, 0xE1,
+0x24, 0xE1, 0x20, 0xE8, 0x41, 0xE5, 0x40, 0xE2, 0x23, 0xEA, 0xD1, 0x90, 0x41, 0xE0, 0xD1, 0xE0,
+0x26, 0xE0, 0x22, 0xE2, 0x24, 0xE0, 0x22, 0xE1, 0x20, 0xD0, 0xA1, 0x80, 0x00, 0x80, 0x70, 0x00,
+0x70, 0x80, 0x01, 0x80, 0x60, 0x70, 0x0F, 0x00, 0x0A, 0x70, 0x60, 0x50, 0x30, 0xA0, 0x03, 0x10,
+0x30, 0xC0, 0x00, 0x60, 0xD1, 0xE1, 0x20, 0xE6, 0x23, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE2,
+0xD0, 0x90, 0x40, 0x90, 0xE4, 0x2C, 0xE3, 0xD0, 0xE0, 0x40, 0xD1, 0xE0, 0x41, 0xE0, 0xD0, 0xE0,
+0x21, 0xE0, 0xD0, 0x60, 0x00, 0x51, 0x08, 0x70, 0x50, 0x04, 0x30, 0x50, 0x02, 0x70, 0x80, 0x03,
+0x50, 0xC0, 0x00, 0x80, 0x10, 0x02, 0x70, 0x00, 0xA0, 0x02, 0x50, 0xC0, 0x80, 0xA0, 0xD0, 0x40,
+0xE0, 0xD0, 0xE3, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE6, 0x20, 0xD0, 0x40, 0x90, 0xD0,
+0xE1, 0x24, 0xE0, 0x21, 0xE1, 0xD0, 0x40, 0x22, 0xE1, 0x23, 0xE0, 0x20, 0xE1, 0x40, 0xE1, 0x21,
+0xE7, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x60, 0x70, 0x0B, 0xC0, 0x80, 0x0A, 0x50, 0xF0,
+0x30, 0x61, 0x70, 0x00, 0x80, 0x30, 0xA0, 0x02, 0x50, 0x60, 0xB0, 0xD0, 0x23, 0xD0, 0x40, 0x80,
+0x05, 0xB0, 0x90, 0xD1, 0x40, 0x90, 0xD0, 0xE3, 0x21, 0xE2, 0xD0, 0xE0, 0x90, 0x40, 0xE0, 0xD0,
+0xE2, 0x24, 0xE2, 0xD1, 0x90, 0x40, 0xE1, 0x21, 0xE1, 0x21, 0xE6, 0x22, 0xE0, 0xD0, 0xE0, 0x40,
+0x90, 0xE0, 0xD1, 0x40, 0xE0, 0xD0, 0x25, 0xE6, 0x20, 0xE1, 0x21, 0xE3, 0x41, 0x90, 0xE4, 0x20,
+0xE0, 0x24, 0xE2, 0x25, 0xE0, 0x21, 0xE1, 0x20, 0x90, 0xA0, 0x00, 0x70, 0xA0, 0x60, 0x0F, 0x09,
+0x0B, 0x50, 0x30, 0x80, 0x50, 0xA0, 0x60, 0xA0, 0x00, 0x30, 0xC0, 0x01, 0x80, 0x40, 0xD0, 0xE0,
+0x21, 0xE2, 0x27, 0xE4, 0x20, 0xE2, 0xD0, 0x90, 0x40, 0x90, 0xE7, 0x21, 0xE3, 0x23, 0xE7, 0x40,
+0xE0, 0x90, 0xB0, 0xE2, 0x22, 0xE1, 0xD0, 0xA0, 0x00, 0x30, 0x70, 0x07, 0x50, 0x70, 0x05, 0xA0,
+0x03, 0x81, 0x02, 0x50, 0xC0, 0x00, 0xC0, 0x10, 0x80, 0x07, 0x50, 0xC0, 0x70, 0x60, 0xD0, 0xE1,
+0x40, 0xE2, 0xD0, 0x40, 0x90, 0xE3, 0x20, 0xE0, 0x23, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x40, 0xE1,
+0x20, 0xE0, 0x23, 0xE1, 0x22, 0xE1, 0x40, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x23, 0xE1, 0x40, 0xE0,
+0x23, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x90,
+0xB0, 0x50, 0x0B, 0xC0, 0x80, 0x09, 0x30, 0x50, 0x30, 0xA1, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01,
+0x80, 0xA0, 0xE0, 0xD0, 0xE3, 0x21, 0xD0, 0xA0, 0x70, 0x02, 0xC0, 0x50, 0xA0, 0xD0, 0xE1, 0xD0,
+0x91, 0xD1, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0xE0, 0xD0, 0x21, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0xE2, 0x21, 0xE0, 0x28, 0xE4, 0x90, 0x40,
+0x92, 0xE4, 0x26, 0xE2, 0x20, 0xE0, 0x23, 0xE3, 0x20, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x25, 0xE2,
+0x24, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0xB0, 0x50, 0x01, 0x70, 0x80, 0x50, 0xC0, 0x0F, 0x07,
+0x0D, 0x60, 0xA0, 0x70, 0xC0, 0x50, 0xA0, 0xC0, 0x80, 0x01, 0x30, 0x60, 0xD0, 0xE1, 0x20, 0xE0,
+0x28, 0xE6, 0xD1, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x24, 0xE0, 0x22, 0xE3, 0x24, 0xE5, 0xD0,
+0x90, 0x40, 0x90, 0xB0, 0xD0, 0x20, 0xE2, 0x20, 0xE1, 0xD0, 0x30, 0x70, 0xF0, 0x06, 0xC0, 0x50,
+0xC0, 0x05, 0x80, 0x30, 0x03, 0x80, 0x60, 0x70, 0xC0, 0x50, 0x0A, 0x70, 0x00, 0x70, 0xC0, 0x00,
+0xA0, 0x90, 0xD0, 0xE2, 0x40, 0xE0, 0xD0, 0x91, 0xE4, 0x26, 0xE0, 0x20, 0xE1, 0x20, 0xD0, 0x40,
+0x90, 0xE0, 0x20, 0xE1, 0x23, 0xE1, 0x21, 0xE0, 0xD0, 0x91, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22,
+0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x21, 0xE2,
+0xD0, 0xB0, 0x71, 0x0B, 0xC0, 0x30, 0xC0, 0x07, 0xF0, 0xA0, 0x03, 0xC0, 0x10, 0x04, 0xB0, 0x30,
+0xD1, 0xE0, 0x21, 0xE2, 0x20, 0xD0, 0xA0, 0x80, 0xC0, 0x00, 0xC0, 0x50, 0x70, 0x30, 0xD0, 0xE1,
+0xD0, 0xE0, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x40,
+0x90, 0xD0, 0xE2, 0x22, 0xE0, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0xE2, 0x20, 0xE0, 0x27, 0xE2, 0x21,
+0xE2, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE1, 0x25, 0xE2, 0x24, 0xE1, 0x20, 0xE3, 0x90, 0x40,
+0x90, 0xE0, 0xD0, 0xE3, 0x21, 0xE2, 0x26, 0xE3, 0xD0, 0xF0, 0x80, 0x01, 0x30, 0xC0, 0xA0, 0x10,
+0x60, 0x50, 0x0F, 0x05, 0x0C, 0x60, 0x70, 0x02, 0xC0, 0x60, 0x00, 0xA0, 0x31, 0xC0, 0x30, 0x90,
+0xE0, 0x2D, 0xE2, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE5, 0x25, 0xE8, 0x21, 0xE0, 0x20, 0xE0, 0xD0,
+0xE0, 0x40, 0x92, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0xB0, 0x50, 0x30, 0x05, 0x70, 0x50,
+0x08, 0x50, 0xA0, 0x80, 0x00, 0x70, 0x60, 0x00, 0xA0, 0x50, 0x07, 0x80, 0xF0, 0xA0, 0xF1, 0x60,
+0x10, 0xB0, 0x10, 0xB0, 0xD0, 0xE4, 0x40, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x27, 0xE0, 0x21,
+0xE2, 0x40, 0xD0, 0x21, 0xE1, 0x23, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x21, 0xE1, 0x90, 0xE1, 0x91, 0xE0, 0x23, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2,
+0x20, 0xE2, 0xD1, 0x60, 0x00, 0x70, 0xC0, 0x0A, 0xC0, 0x60, 0x70, 0x06, 0x10, 0x30, 0xC0, 0x04,
+0x80, 0x03, 0x50, 0x60, 0xD0, 0xE2, 0x22, 0xE3, 0xA0, 0x00, 0x50, 0x70, 0x50, 0x00, 0xB0, 0x40,
+0xD0, 0xE0, 0x21, 0xE1, 0x91, 0xD0, 0xE3, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0,
+0x20, 0xE3, 0x20, 0xE0, 0x21, 0xE1, 0xD1, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x25, 0xE3,
+0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0x41, 0xE0, 0xD0, 0x21, 0xE1, 0x2D, 0xE6, 0xD0, 0xE0, 0x90,
+0x40, 0x90, 0xE0, 0xD0, 0xE2, 0x22, 0xE1, 0x26, 0xE0, 0x20, 0xE0, 0x40, 0x80, 0x70, 0x32, 0x00,
+0x70, 0x30, 0xC0, 0x30, 0x10, 0xA0, 0xC0, 0x0F, 0x02, 0x0C, 0xA0, 0xC0, 0x00, 0xC0, 0x80, 0xF0,
+0xC0, 0x00, 0x51, 0x01, 0x70, 0xB0, 0xD0, 0xE0, 0x25, 0xE9, 0x41, 0xE0, 0xD0, 0xE2, 0x20, 0xE1,
+0x28, 0xE8, 0x20, 0xE1, 0x20, 0x41, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x22, 0xE0, 0x20, 0xE2, 0x40,
+0x80, 0x30, 0x70, 0x02, 0xC0, 0x50, 0xC0, 0x0B, 0x50, 0x60, 0xA0, 0x00, 0x70, 0x80, 0x05, 0x70,
+0x30, 0x10, 0xB0, 0xD0, 0x90, 0x40, 0x91, 0xD0, 0x91, 0xD0, 0x21, 0xE1, 0x20, 0xE1, 0x41, 0xD2,
+0xE0, 0x29, 0xE0, 0x20, 0xE1, 0x40, 0xE1, 0x22, 0xE0, 0x23, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE1,
+0x22, 0xE0, 0x20, 0xE0, 0x20, 0x40, 0xE1, 0x91, 0xE0, 0x23, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xE3, 0x21, 0xE0, 0xD0, 0x40, 0xB0, 0x00, 0xC0, 0x70, 0x0B, 0x70, 0x30, 0xC0, 0x70, 0x51,
+0xC1, 0x10, 0x50, 0x06, 0xA0, 0x70, 0x01, 0x80, 0xA0, 0xD0, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0xD0,
+0xA0, 0xC0, 0x00, 0x70, 0x80, 0x01, 0xA0, 0xD1, 0xE1, 0x22, 0xD0, 0x91, 0xE2, 0x20, 0xE0, 0x22,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE2, 0x20, 0xE0, 0x24, 0xE3, 0xD1, 0x90, 0x40, 0xE2,
+0x24, 0xE3, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xD1, 0xE0, 0x40, 0x90, 0xE0, 0xD0, 0xE2, 0x27, 0xE3,
+0x22, 0xE2, 0x21, 0xE4, 0x41, 0xE0, 0xD0, 0xE1, 0x21, 0xE3, 0x26, 0xD0, 0xA0, 0x02, 0x80, 0x70,
+0x01, 0x50, 0x02, 0x70, 0xC0, 0x0F, 0x02, 0x0C, 0x70, 0x62, 0x80, 0xC0, 0x70, 0x80, 0xC0, 0xA0,
+0x01, 0xC0, 0x60, 0xD0, 0xE0, 0x21, 0xE0, 0x23, 0xE4, 0xD0, 0x90, 0x41, 0xE5, 0x22, 0xE0, 0x20,
+0xE1, 0x23, 0xE1, 0x22, 0xE7, 0x90, 0x40, 0xE0, 0xD1, 0xE1, 0x91, 0xE1, 0x21, 0xE1, 0x20, 0xE0,
+0xD0, 0x40, 0xB0, 0xC0, 0x30, 0x01, 0x70, 0x50, 0x0F, 0x00, 0x80, 0x31, 0x70, 0x05, 0x50, 0xF0,
+0xD1, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0xD1, 0xE1, 0x21, 0xE2, 0x40, 0xE0, 0x90, 0x40, 0xE2,
+0x24, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x91, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x21, 0xE0,
+0x90, 0xE2, 0x22, 0xE2, 0x21, 0xE1, 0xD0, 0x40, 0xD0, 0xE0, 0x23, 0xE0, 0x22, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE3, 0x21, 0xE0, 0xD0, 0x40, 0xA0, 0x70, 0x80, 0x50, 0xC0, 0x72, 0x51, 0x30, 0xC4,
+0x50, 0xA0, 0x60, 0xA0, 0xF1, 0x30, 0x80, 0x50, 0x07, 0x60, 0x70, 0x00, 0xA1, 0xD0, 0xE0, 0x27,
+0xE0, 0x90, 0x30, 0x00, 0x50, 0xC1, 0x50, 0xC0, 0xA0, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xD0, 0x91,
+0xD0, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x91, 0xE2, 0x20, 0xE0, 0x22, 0xE0,
+0x21, 0xE3, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x27, 0xE0, 0x22, 0xD0, 0x40, 0xE4, 0x90, 0x40, 0x90,
+0xD0, 0xE3, 0x26, 0xE1, 0x23, 0xE0, 0x20, 0xE2, 0x22, 0xE0, 0x22, 0x40, 0x90, 0xE0, 0xD0, 0x21,
+0xE2, 0x24, 0xE3, 0x60, 0x02, 0xA0, 0x0F, 0x0B, 0x0E, 0xC0, 0x02, 0x30, 0x70, 0x50, 0x80, 0x50,
+0x30, 0x81, 0xB0, 0xD0, 0x20, 0xE0, 0x23, 0xE2, 0xD1, 0x90, 0x41, 0xE0, 0xD0, 0xE0, 0x21, 0xE0,
+0x25, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x23, 0xE3, 0xD0, 0xE0, 0x40, 0x90, 0xD1, 0xE4, 0x40, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0xB0, 0x00, 0xA0, 0x00, 0x50, 0x70, 0x05, 0x80, 0x10,
+0x07, 0x31, 0xC0, 0x07, 0x80, 0xA0, 0xD0, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x23,
+0xE0, 0xD0, 0x40, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE5, 0x20, 0xE0, 0x21, 0xE1, 0x40,
+0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE4, 0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x20,
+0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xD0,
+0x40, 0xA0, 0x80, 0x70, 0x31, 0x81, 0x51, 0x70, 0x50, 0x30, 0x81, 0xA0, 0x10, 0x60, 0x50, 0x30,
+0x80, 0x01, 0xA0, 0x09, 0x60, 0xC0, 0x50, 0x60, 0xD1, 0xE0, 0x23, 0xE0, 0x22, 0xD0, 0x30, 0x80,
+0x50, 0xC0, 0x01, 0xC0, 0x81, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x91, 0xD0, 0x20,
+0xE0, 0x23, 0xE5, 0x90, 0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x22,
+0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xE4, 0x23, 0xE0, 0x21, 0xE0, 0x90, 0x40, 0xE2, 0x21, 0xE0, 0xD0,
+0x90, 0x40, 0xE4, 0x25, 0xE2, 0x23, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x91, 0x40, 0x20,
+0xE0, 0xD0, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x30, 0x50, 0x31, 0x80, 0x50, 0x0F, 0x0B, 0x0F,
+0x03, 0x80, 0xA0, 0x70, 0x00, 0xF0, 0x02, 0xA0, 0xD0, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0xE0, 0x90,
+0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x2D, 0xE1, 0x20, 0xE1, 0x25, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE0,
+0xD0, 0xE1, 0x20, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40,
+0x80, 0x00, 0x30, 0x80, 0x08, 0x80, 0x06, 0x80, 0x30, 0x0A, 0xA0, 0xD1, 0x40, 0x90, 0xD0, 0xE1,
+0x21, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xD0, 0xE5, 0x22, 0xE0,
+0xD0, 0x91, 0xE1, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE2, 0x91, 0xE3, 0x23, 0xE0, 0x20, 0xE3, 0x40,
+0xD0, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xE0, 0x90, 0x30, 0x01,
+0x70, 0x09, 0x30, 0x02, 0x70, 0x02, 0x50, 0xA0, 0x70, 0x06, 0x70, 0x30, 0x00, 0x70, 0xB0, 0xA0,
+0xD0, 0xE0, 0x26, 0xD1, 0x40, 0x30, 0x04, 0x30, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE2, 0x91,
+0xE1, 0x22, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x24, 0xE0, 0x22, 0xE1,
+0xD1, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x40, 0xE1, 0x23, 0xE1, 0xD0, 0x20,
+0x41, 0xE0, 0xD0, 0xE0, 0x29, 0xE2, 0x27, 0xE6, 0x41, 0x90, 0xD1, 0xE2, 0x20, 0xE1, 0xD1, 0xA0,
+0x01, 0xC0, 0x10, 0x0F, 0x0C, 0x0F, 0x07, 0xA0, 0x02, 0x30, 0x40, 0xD0, 0x21, 0xE1, 0xD0, 0xE0,
+0x90, 0x40, 0x90, 0xD0, 0xE2, 0x28, 0xE1, 0x21, 0xE5, 0x23, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0xE3,
+0x22, 0xE1, 0x20, 0xE1, 0x91, 0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0xB0, 0x50, 0x70, 0x80, 0x50, 0x0F,
+0x00, 0x80, 0x60, 0xC0, 0x0A, 0x10, 0xD0, 0x40, 0x90, 0xE2, 0x24, 0xE2, 0x91, 0xE2, 0x21, 0xE0,
+0xD0, 0x91, 0xE0, 0xD0, 0xE2, 0x20, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x22, 0xE2, 0x24, 0xE1, 0xD0,
+0x40, 0xE1, 0x20, 0xE1, 0x23, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xE1, 0x22, 0xE1, 0x22, 0xE0, 0x20,
+0xE0, 0x40, 0xD0, 0xE2, 0x23, 0xE0, 0xD0, 0xB0, 0x30, 0x00, 0x70, 0xC0, 0x08, 0x80, 0xC0, 0x01,
+0xC0, 0x70, 0x02, 0xC0, 0x30, 0xA0, 0x05, 0x30, 0x50, 0x01, 0x50, 0x10, 0xD0, 0xE2, 0x21, 0xE0,
+0x20, 0xE1, 0x40, 0x90, 0x60, 0x03, 0xC0, 0x30, 0x91, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0xD0, 0x91,
+0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x24, 0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0x25, 0xE0, 0x20, 0xE1, 0x21,
+0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xE0, 0x24, 0xE2, 0xD0,
+0xE1, 0x40, 0x90, 0xD0, 0xE2, 0x25, 0xE1, 0x27, 0xE6, 0x20, 0xE0, 0xD1, 0x90, 0x40, 0x90, 0xE5,
+0xD0, 0xB0, 0x80, 0x01, 0xC0, 0x80, 0x0F, 0x0C, 0x0F, 0x07, 0x70, 0x30, 0x70, 0x31, 0xA0, 0xD3,
+0xE0, 0x90, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE2, 0x24, 0xE6, 0x21, 0xE0, 0x21, 0xE3, 0xD0,
+0x90, 0x40, 0x90, 0xE2, 0x20, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0x20, 0xE1, 0x21, 0xE0,
+0xD0, 0x40, 0x80, 0x00, 0x50, 0x30, 0x0E, 0x70, 0x30, 0xC0, 0xA0, 0x09, 0x70, 0x60, 0x91, 0xD0,
+0xE0, 0x21, 0xE1, 0x23, 0xE0, 0x90, 0x40, 0xD0, 0xE3, 0x22, 0xE0, 0x90, 0x40, 0x90, 0xD0, 0xE1,
+0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x22, 0xE2, 0x24, 0xE3, 0x40, 0xE0, 0x21, 0xE2, 0x25, 0xE0, 0xD0,
+0x90, 0xE2, 0x22, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x24, 0xE1, 0xD0, 0xA0, 0x70,
+0xC1, 0x08, 0x30, 0xC0, 0x02, 0x50, 0x04, 0x60, 0x71, 0x02, 0x50, 0x80, 0x02, 0xC0, 0x60, 0x90,
+0xD0, 0x20, 0xE4, 0x90, 0x40, 0x90, 0xD0, 0xA0, 0x02, 0x50, 0xA0, 0x90, 0xD0, 0x40, 0xE0, 0xD0,
+0x25, 0xE1, 0x20, 0xD0, 0x91, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0xD0, 0xE0, 0x40, 0x90,
+0xD0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x23, 0xE1, 0xD0, 0x90, 0x40, 0xE3, 0x21, 0xE0, 0x90,
+0x40, 0xE0, 0x22, 0xE4, 0x22, 0xE1, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x22, 0xE0, 0x28, 0xE5, 0x23,
+0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0x20, 0xE0, 0xD0, 0x60, 0x30, 0x80, 0xC0, 0x30,
+0xC0, 0x0F, 0x0C, 0x0F, 0x08, 0x60, 0x80, 0xC0, 0x00, 0x30, 0x90, 0xD0, 0xE0, 0x41, 0x90, 0xE1,
+0x20, 0xE0, 0x23, 0xE1, 0x21, 0xE0, 0x22, 0xE7, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0,
+0x28, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE3, 0x90, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x0D, 0x50,
+0x70, 0xA0, 0x01, 0xF0, 0x70, 0x06, 0x70, 0x60, 0x80, 0x90, 0xD0, 0xE0, 0x27, 0xE0, 0x90, 0x40,
+0xE1, 0x20, 0xE2, 0x22, 0xE0, 0x91, 0x41, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xD0,
+0x20, 0xE0, 0x21, 0xE1, 0x26, 0xE0, 0xD0, 0x91, 0xE0, 0x21, 0xE2, 0x25, 0xE0, 0xD0, 0x40, 0xE1,
+0x22, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x24, 0xE0, 0xD1, 0xA0, 0x00, 0x70, 0x08,
+0x80, 0xC0, 0x02, 0x70, 0xC0, 0x04, 0x50, 0x10, 0xA3, 0x04, 0x80, 0x90, 0xD0, 0x20, 0xE0, 0xD0,
+0xE1, 0x40, 0x90, 0x40, 0x90, 0xD0, 0x40, 0x60, 0x80, 0x31, 0x90, 0xD0, 0xE0, 0xD0, 0x40, 0xE2,
+0x23, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE0,
+0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE2, 0x25, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE4,
+0x40, 0xE1, 0x22, 0xE3, 0x25, 0xE1, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x2A, 0xE4, 0x25, 0xE2, 0xD0,
+0xE1, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0x40, 0x80, 0x00, 0xC0, 0x31, 0x0F, 0x0D, 0x0F, 0x08, 0x80,
+0x70, 0x01, 0xC0, 0xA0, 0x90, 0x40, 0xE0, 0xD1, 0xE2, 0x20, 0xE1, 0x25, 0xE2, 0x23, 0xE3, 0x21,
+0xE4, 0x41, 0xE1, 0x29, 0xE1, 0x20, 0xE1, 0x20, 0xD0, 0x91, 0xE2, 0x40, 0xE0, 0xA0, 0xC0, 0x00,
+0x30, 0xC0, 0x0C, 0x50, 0xC0, 0x00, 0xA0, 0x01, 0x70, 0x60, 0xC0, 0x03, 0xA0, 0xC0, 0xA0, 0x40,
+0x90, 0xD0, 0x21, 0xE1, 0x22, 0xE2, 0xD0, 0x40, 0xE2, 0x21, 0xE2, 0x20, 0xE1, 0x40, 0xD1, 0x90,
+0x40, 0xE0, 0xD0, 0xE1, 0xD0, 0x40, 0xE1, 0xD0, 0x22, 0xE1, 0x26, 0xE0, 0xD0, 0x40, 0xE0, 0x23,
+0xE2, 0x24, 0xE0, 0xD0, 0x40, 0xE1, 0x22, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x23,
+0xE1, 0x20, 0xD0, 0xB0, 0x40, 0x70, 0x07, 0xC0, 0x60, 0xC0, 0x02, 0xC0, 0x70, 0x04, 0x60, 0x50,
+0x02, 0xA0, 0x04, 0x60, 0x90, 0xD0, 0xE2, 0x90, 0x40, 0xE2, 0x40, 0xE0, 0xD0, 0x90, 0x40, 0x90,
+0xD0, 0xE2, 0xD0, 0xE0, 0x40, 0xE0, 0xD0, 0x24, 0xE4, 0x91, 0xE1, 0x24, 0xE0, 0x23, 0xE1, 0x90,
+0x40, 0xE1, 0x21, 0xE1, 0x20, 0xE1, 0x24, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0xE1, 0xD0, 0x40, 0x90,
+0xE4, 0x21, 0xE0, 0x26, 0xE1, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE1, 0x22, 0xE0, 0x23, 0xE2, 0x27,
+0xE0, 0x20, 0xE1, 0x20, 0xE3, 0x90, 0x40, 0x90, 0xA0, 0x02, 0x80, 0x70, 0x0F, 0x0D, 0x0F, 0x09,
+0xA0, 0x00, 0x70, 0x30, 0x60, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x22, 0xE0,
+0x21, 0xE1, 0x23, 0xE2, 0x20, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x27, 0xE0, 0x23,
+0xE4, 0x40, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x60, 0xC0, 0x00, 0x70, 0x80, 0x0A, 0xC0, 0x50, 0x02,
+0xA0, 0x03, 0x60, 0x70, 0x02, 0x11, 0x30, 0x90, 0xD0, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0xD0, 0x40,
+0xE1, 0x21, 0xE6, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x41, 0xE0, 0xD0, 0x91, 0xE0, 0x21, 0xE0, 0x20,
+0xE2, 0x26, 0xE1, 0x40, 0xD0, 0x23, 0xE2, 0x22, 0xE0, 0x21, 0xD0, 0x40, 0xE0, 0x22, 0xE3, 0x22,
+0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xD0, 0xE0, 0xD0, 0xA0, 0x80,
+0x06, 0xC0, 0x60, 0x70, 0x04, 0x50, 0x02, 0x50, 0x60, 0x04, 0x30, 0x70, 0x02, 0x50, 0xA0, 0x91,
+0xD0, 0xE0, 0x40, 0x90, 0xE2, 0xD0, 0xE0, 0x40, 0xD2, 0xE0, 0x21, 0xE4, 0x40, 0xD0, 0xE1, 0x20,
+0xE0, 0x21, 0xE4, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x25, 0xE1, 0xD0, 0xE0, 0x40, 0xE1, 0x20, 0xE0,
+0x22, 0xE1, 0x24, 0xE2, 0xD0, 0xE0, 0x40, 0x91, 0x40, 0xD0, 0xE1, 0x20, 0xE1, 0x22, 0xE1, 0x27,
+0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE3, 0x27, 0xE4, 0x22, 0xE2,
+0xD0, 0x40, 0x60, 0x30, 0xC0, 0x00, 0xA0, 0x0F, 0x0E, 0x0F, 0x09, 0x50, 0x60, 0x80, 0x00, 0x70,
+0x30, 0xD0, 0xE1, 0x21, 0xE0, 0x24, 0xE2, 0x22, 0xE0, 0x27, 0xE1, 0xD1, 0x90, 0x40, 0x90, 0xD0,
+0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0x27, 0xE1, 0x20, 0xE1, 0x90, 0xB0, 0x90, 0xD1, 0x40, 0xF0,
+0x01, 0x60, 0x70, 0x09, 0x70, 0x50, 0x02, 0x70, 0x10, 0x00, 0x30, 0x10, 0xF0, 0x00, 0x60, 0xC0,
+0x00, 0xA0, 0x10, 0xA0, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x23, 0xD0, 0x40, 0x90, 0xE3,
+0x20, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x90, 0x40, 0x90, 0x40, 0xD0,
+0xE0, 0x22, 0xE1, 0x24, 0xE1, 0x21, 0xE0, 0x91, 0xE1, 0x22, 0xE2, 0x22, 0xE0, 0x20, 0xE1, 0x40,
+0xD0, 0x22, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0,
+0x20, 0xE1, 0xD0, 0x30, 0xC0, 0x05, 0xC0, 0x80, 0x05, 0x71, 0x00, 0x70, 0x30, 0x05, 0x70, 0x80,
+0x00, 0x50, 0xA0, 0xB0, 0xD1, 0x40, 0x90, 0x40, 0xE3, 0x21, 0xE0, 0x91, 0xE0, 0x20, 0xE1, 0x21,
+0xE0, 0x20, 0xE1, 0x90, 0x40, 0xE2, 0x23, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x91, 0xE2, 0x27, 0xE3,
+0x40, 0x90, 0xD0, 0xE2, 0x23, 0xE2, 0x21, 0xE1, 0x20, 0xD1, 0x90, 0xB0, 0xD0, 0xE0, 0x24, 0xE0,
+0x24, 0xE2, 0x23, 0xE0, 0x21, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE4, 0x29, 0xE2, 0x25, 0xE0, 0x20,
+0xE1, 0xD0, 0xA0, 0x00, 0xC0, 0x80, 0xF0, 0x70, 0x0F, 0x0E, 0x0F, 0x0A, 0xA0, 0x02, 0x30, 0x90,
+0xD0, 0x29, 0xE1, 0x21, 0xE0, 0x27, 0xE0, 0x20, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x23, 0xE5,
+0x20, 0xE0, 0x25, 0xE2, 0xD0, 0x90, 0x41, 0x90, 0xD1, 0x40, 0x30, 0x01, 0xA0, 0x09, 0x70, 0x50,
+0x03, 0x70, 0xF0, 0x00, 0xC0, 0x30, 0x50, 0x01, 0xA0, 0x30, 0x10, 0x60, 0x90, 0xD0, 0xE6, 0x22,
+0xD0, 0x91, 0xE3, 0x23, 0xE1, 0x90, 0x40, 0xE6, 0xD1, 0x41, 0xE2, 0x20, 0xE3, 0x25, 0xE0, 0x20,
+0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE2, 0x22, 0xE0, 0x21, 0xE0, 0x91, 0xE0, 0x23, 0xE2, 0x22, 0xE0,
+0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x22, 0xE0, 0x20, 0xD0, 0xE0, 0xA0, 0xC0, 0x05, 0xC0,
+0x80, 0x06, 0x71, 0xA0, 0xC0, 0x05, 0x70, 0x81, 0x30, 0xD2, 0x90, 0xB0, 0x40, 0xD0, 0xE1, 0x21,
+0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90,
+0xE2, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x23, 0xE3, 0x22, 0xE1, 0x40, 0x90,
+0xD0, 0x22, 0xE6, 0x23, 0xE1, 0x91, 0x40, 0xE1, 0x23, 0xE3, 0x21, 0xE4, 0x24, 0xE0, 0xD0, 0xE0,
+0x91, 0xE0, 0xD0, 0xE3, 0x24, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x23, 0xE3, 0x90, 0x30, 0x02, 0xA0,
+0x0F, 0x0F, 0x0F, 0x0A, 0x80, 0x50, 0x00, 0x70, 0x60, 0x30, 0xD0, 0x20, 0xE1, 0x25, 0xE1, 0x24,
+0xE1, 0x21, 0xE3, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x20, 0xE0, 0x22, 0xE5, 0x20, 0xE2, 0x22, 0xE3,
+0xD0, 0x40, 0x90, 0xE0, 0xD0, 0x40, 0xE1, 0xD0, 0xA0, 0x01, 0x30, 0x08, 0x50, 0x70, 0x05, 0x10,
+0x50, 0x04, 0xA0, 0x10, 0xA0, 0xD1, 0xE1, 0x20, 0xE1, 0x22, 0xE0, 0x20, 0xD0, 0x91, 0xD0, 0xE0,
+0x20, 0xE2, 0x21, 0xE2, 0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE2, 0xD0, 0xE0, 0x40, 0xE0, 0x41, 0xE0,
+0xD0, 0xE4, 0x24, 0xE2, 0x40, 0xE1, 0x21, 0xE2, 0x26, 0xE0, 0x40, 0xE2, 0x28, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x21, 0xE3, 0x22, 0xE1, 0xD0, 0xA0, 0xC0, 0x05, 0xC0, 0x80, 0x06, 0x70, 0xF0,
+0xC0, 0x05, 0x50, 0x60, 0x30, 0x10, 0xC0, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE0, 0x23, 0xE1, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x22, 0xD0, 0x40, 0xE2, 0x27, 0xE1, 0x91, 0xE1,
+0x22, 0xE3, 0x21, 0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x21, 0xE5, 0x23, 0xE0, 0x90, 0x40, 0xD0,
+0xE0, 0x41, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x26, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40,
+0x90, 0xE0, 0xD0, 0xE2, 0x20, 0xE0, 0x24, 0xE6, 0x20, 0xE0, 0x20, 0xE2, 0xD0, 0x60, 0xA0, 0xC0,
+0x00, 0x80, 0x50, 0x0F, 0x0F, 0x0F, 0x0B, 0xA0, 0x31, 0x00, 0xA0, 0xD0, 0xE3, 0x2B, 0xE3, 0x20,
+0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0x23, 0xE1, 0x21, 0xE0, 0x21,
+0xE0, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE3, 0x40, 0xE0, 0xD0, 0xB0, 0x70, 0x00, 0x70, 0x80, 0x06,
+0x50, 0xC0, 0x06, 0x80, 0x10, 0xA0, 0x03, 0x30, 0x60, 0x90, 0xD0, 0xE0, 0x24, 0xE1, 0x20, 0xE0,
+0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0x90, 0xD0,
+0x23, 0xE2, 0xD0, 0x40, 0xE0, 0xD1, 0xE0, 0x41, 0xE0, 0xD0, 0xE1, 0xD0, 0x20, 0xE0, 0x22, 0xE1,
+0x40, 0x90, 0xE0, 0x22, 0xE2, 0x21, 0xE2, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x26, 0xE0,
+0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x24, 0xE0, 0xD0, 0xA0, 0x70, 0x05, 0xC0, 0x10, 0x70,
+0x01, 0x80, 0x60, 0x31, 0xA0, 0x70, 0x06, 0xA0, 0x00, 0xF0, 0x60, 0xD0, 0x41, 0xD2, 0x90, 0x40,
+0xD1, 0x20, 0xE0, 0x24, 0x91, 0xD0, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x26, 0xE1,
+0xD0, 0x91, 0xD0, 0x20, 0xE4, 0x24, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE0,
+0x23, 0xE1, 0x40, 0xE2, 0xD0, 0x90, 0x40, 0x20, 0xE2, 0x2F, 0x00, 0xE0, 0x20, 0xE0, 0xD1, 0x90,
+0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x26, 0xE5, 0x21, 0xE2, 0xD0, 0x90, 0x30, 0x00, 0x31, 0xA0,
+0x0F, 0x10, 0x0F, 0x0B, 0x80, 0x50, 0x01, 0x70, 0x30, 0xD0, 0xE0, 0x24, 0xE1, 0x21, 0xE2, 0x20,
+0xE0, 0x20, 0xE1, 0xD1, 0x90, 0x40, 0x90, 0xE5, 0x20, 0xE1, 0x27, 0xE3, 0x20, 0xE2, 0x91, 0xE1,
+0x21, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0x40, 0x30, 0x01, 0xA0, 0x04, 0xC0, 0x50, 0x09, 0x70, 0x60,
+0xA0, 0x80, 0x70, 0x00, 0x80, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x23, 0xE1, 0x90, 0x40, 0xD0, 0xE2,
+0x22, 0xE1, 0x20, 0xD0, 0x91, 0xD0, 0xE1, 0x23, 0xE1, 0x91, 0xD0, 0xE2, 0xD0, 0x20, 0x41, 0xE0,
+0xD0, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x23, 0xE1, 0x21, 0xE2, 0x20, 0xE1, 0x40,
+0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE5, 0x20,
+0xE0, 0x20, 0xD0, 0x40, 0x80, 0x05, 0xC0, 0x80, 0xA0, 0x00, 0x70, 0xA0, 0x01, 0xC0, 0x00, 0x50,
+0x01, 0x70, 0xA0, 0x02, 0x30, 0xA0, 0x80, 0x30, 0x90, 0xE0, 0xD0, 0xE1, 0x20, 0xD0, 0x40, 0xE2,
+0x21, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0x22, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x40, 0xE4, 0x22,
+0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xE4, 0x20, 0xE1, 0x21, 0xE3, 0xD0, 0x90, 0x40, 0xE1, 0x22, 0xE0,
+0x20, 0xE3, 0xD0, 0x40, 0xE3, 0x20, 0xE1, 0x40, 0x90, 0xE3, 0x20, 0xE3, 0x20, 0xE3, 0x24, 0xE0,
+0x20, 0xE3, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x25, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x23, 0xD0, 0xA0,
+0xC0, 0x01, 0x80, 0x50, 0x0F, 0x10, 0x0F, 0x0C, 0xA0, 0x01, 0x70, 0x10, 0xE0, 0xD0, 0xE0, 0x23,
+0xE2, 0x20, 0xE3, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0x25, 0xE2, 0x27, 0xE0, 0x20,
+0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x23, 0xD0, 0xE0, 0x91, 0xD0, 0x30, 0xC0, 0x00, 0x60, 0x03,
+0xC0, 0x50, 0x0B, 0x30, 0x50, 0x40, 0x31, 0x40, 0xE1, 0x24, 0xE0, 0x21, 0xE2, 0x40, 0xE3, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xD0, 0x40,
+0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE4, 0x91, 0xE0, 0x24, 0xE1, 0x21,
+0xE5, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE6, 0x22, 0xE0, 0x90, 0xA0, 0x05, 0xC0, 0x30, 0x60, 0x31, 0x04, 0x50, 0x70, 0x00, 0xC0, 0x70,
+0x02, 0xC0, 0x50, 0x30, 0x40, 0xD0, 0xE1, 0x21, 0xE2, 0x40, 0xE5, 0x20, 0xE0, 0x20, 0xD0, 0x40,
+0xE1, 0x22, 0xE1, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x21,
+0xE0, 0xD0, 0x91, 0xD0, 0xE1, 0x20, 0xE3, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x22,
+0xE3, 0xD0, 0x40, 0x90, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0xE2, 0x20, 0xE0, 0x23,
+0xE5, 0x20, 0xE0, 0x22, 0xE3, 0xD0, 0xE0, 0x90, 0x40, 0x20, 0xD0, 0xE1, 0x20, 0xE0, 0x25, 0xE0,
+0x21, 0xE3, 0x90, 0xF0, 0xC0, 0x01, 0xA0, 0x0F, 0x11, 0x0F, 0x0C, 0x30, 0x50, 0xA0, 0x80, 0x50,
+0xB0, 0xD0, 0x20, 0xE0, 0x23, 0xE7, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE1, 0x28, 0xE1, 0x24, 0xE0,
+0x21, 0xE1, 0xD0, 0x90, 0x40, 0xE4, 0x21, 0xE3, 0x40, 0xD0, 0x60, 0x70, 0x00, 0xA0, 0x02, 0x70,
+0x50, 0x0C, 0x80, 0xB0, 0x70, 0x91, 0xD1, 0x22, 0xE1, 0x22, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE4,
+0x22, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE3, 0x21, 0x91, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0xE0,
+0x40, 0xE0, 0x90, 0x40, 0x90, 0xD1, 0xE0, 0xD0, 0x90, 0xE4, 0x21, 0xE1, 0x24, 0xE1, 0x91, 0xD0,
+0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x21, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE7, 0x21, 0xE1, 0x30, 0x05,
+0xC0, 0x80, 0x50, 0xC0, 0x04, 0xC0, 0x10, 0x70, 0x01, 0xC0, 0x00, 0x70, 0x50, 0xC0, 0x50, 0x30,
+0xD0, 0xE3, 0x22, 0xD0, 0x40, 0x90, 0xD0, 0xE2, 0x23, 0xE1, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x20,
+0xE0, 0x20, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE1, 0x91, 0xE4, 0x20,
+0xE1, 0x21, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x90,
+0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x21, 0xD0, 0x20, 0x40, 0x90, 0xE4, 0x22, 0xE5, 0x28, 0xE0, 0xD0,
+0xE0, 0x41, 0xE0, 0xD0, 0xE1, 0x28, 0xE2, 0xD0, 0xA0, 0x70, 0x30, 0xA0, 0x81, 0x0F, 0x11, 0x0F,
+0x0D, 0x60, 0x02, 0xA0, 0x90, 0xD0, 0x20, 0xE0, 0x22, 0xE7, 0x90, 0x40, 0xE0, 0xD0, 0xE4, 0x27,
+0xE3, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0x20,
+0xE1, 0xD0, 0x40, 0xA0, 0x01, 0x60, 0x01, 0x50, 0x70, 0x0E, 0x30, 0xB0, 0x90, 0xD0, 0xE1, 0x23,
+0xE0, 0x20, 0xE2, 0xD0, 0x40, 0x90, 0xD0, 0xE5, 0x22, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20,
+0xE1, 0x20, 0xE0, 0x40, 0xD0, 0x25, 0xE1, 0x40, 0xE0, 0xD2, 0x90, 0x41, 0xE1, 0x40, 0xE5, 0x20,
+0xE1, 0x24, 0xE1, 0x91, 0xE1, 0x20, 0xE1, 0x21, 0xE1, 0x21, 0xE3, 0x40, 0xD0, 0xE0, 0x21, 0xE3,
+0x23, 0xE0, 0x20, 0xD0, 0x80, 0x50, 0x00, 0x70, 0x02, 0x70, 0x80, 0x08, 0x50, 0x00, 0x30, 0x60,
+0x30, 0x70, 0x00, 0x50, 0xA0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0xE3, 0x20, 0xE0,
+0x20, 0xE1, 0x91, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0x91, 0xD0, 0xE4, 0x23, 0xE2, 0x91,
+0xD0, 0xE0, 0x22, 0xE2, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0x20, 0xE3, 0x40, 0xD0,
+0xE0, 0x21, 0xE4, 0x21, 0xE0, 0xD0, 0x41, 0xE1, 0x25, 0xE4, 0x28, 0xE2, 0xD0, 0x90, 0x40, 0x90,
+0xE1, 0x28, 0xE1, 0xD0, 0x40, 0xB0, 0x02, 0x60, 0x0F, 0x12, 0x0F, 0x0D, 0x80, 0x70, 0x01, 0x80,
+0xA0, 0xD0, 0xE0, 0x21, 0xE5, 0x21, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x27,
+0xE3, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE3, 0x20, 0xE4, 0x21, 0xE3, 0x30, 0xC0, 0x00, 0x60, 0xC0,
+0x50, 0xC0, 0x0F, 0x00, 0x50, 0x40, 0xD0, 0xE0, 0xD0, 0x23, 0xE1, 0x20, 0xE2, 0x91, 0xD0, 0xE0,
+0x21, 0xE2, 0x22, 0xE0, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xD0, 0x40, 0x90, 0xE0,
+0x23, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x42, 0xE1, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE5, 0x20,
+0xE0, 0xD0, 0x40, 0x27, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x21, 0xE0,
+0xD0, 0x30, 0xA0, 0x60, 0x30, 0x70, 0x80, 0x60, 0x70, 0x08, 0x50, 0x30, 0x70, 0x00, 0x60, 0x00,
+0xC0, 0x60, 0xD1, 0x40, 0xD0, 0x25, 0xE1, 0x91, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0x40, 0x90, 0xE1,
+0x23, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x91, 0xE3, 0x24, 0xE1, 0xD1, 0x91, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE1, 0x24, 0xD0, 0xE0, 0xD0, 0x90, 0x40, 0xE3, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE0,
+0x22, 0xE0, 0x21, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x25, 0xE2, 0x20, 0xE0, 0x26, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD1, 0x22, 0xE0, 0x21, 0xE1, 0x20, 0xD0, 0x60, 0x50,
+0x01, 0x52, 0x30, 0xC0, 0x0F, 0x0F, 0x0F, 0x0E, 0xA0, 0xC0, 0xA0, 0x50, 0x30, 0x90, 0xE0, 0x20,
+0xE7, 0x90, 0x40, 0xE4, 0x23, 0xE3, 0x26, 0xE3, 0x20, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x24, 0xE5,
+0x21, 0xE0, 0xD0, 0x40, 0x50, 0x00, 0x80, 0x50, 0xC0, 0x09, 0xA0, 0x50, 0x03, 0x70, 0x60, 0xE0,
+0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE4, 0x40, 0xD0, 0xE0, 0x22, 0xE6, 0x40, 0x20, 0xE2,
+0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x20, 0xD0, 0x91, 0xE1, 0x20,
+0xE3, 0xD0, 0x40, 0x90, 0x41, 0x90, 0x20, 0xEA, 0xD0, 0x40, 0xE0, 0x2B, 0xE0, 0x20, 0xE0, 0x40,
+0xD0, 0xE0, 0x2C, 0xD0, 0x40, 0x30, 0x50, 0x70, 0x51, 0x07, 0x51, 0x71, 0x30, 0x50, 0xA0, 0xC0,
+0x00, 0xA0, 0xE2, 0x91, 0xE0, 0x21, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE1,
+0x22, 0xE1, 0x40, 0xE0, 0xD0, 0x24, 0xE0, 0x20, 0xE2, 0x40, 0xE4, 0x21, 0xE1, 0x20, 0xE0, 0x20,
+0xE1, 0x91, 0xE2, 0x21, 0xE2, 0x22, 0xE0, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0x40, 0x90,
+0xD0, 0xE0, 0x21, 0xE2, 0x24, 0xE1, 0x20, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x25, 0xE0, 0x20, 0xE0,
+0x22, 0xE3, 0x24, 0xE1, 0xD0, 0xE0, 0x41, 0xE0, 0xD0, 0xE0, 0x20, 0xE4, 0xD0, 0x40, 0xB0, 0x80,
+0x30, 0xC0, 0xA0, 0xC0, 0x30, 0x70, 0x80, 0x0F, 0x0F, 0x0F, 0x0E, 0x80, 0xA0, 0x01, 0xC0, 0xA0,
+0xD0, 0xE4, 0xD0, 0xE0, 0x41, 0xE6, 0x26, 0xE0, 0x29, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1,
+0x25, 0xE3, 0x20, 0xE0, 0x21, 0xD0, 0x90, 0x60, 0x80, 0xA0, 0x70, 0x0A, 0x80, 0x10, 0xA1, 0x30,
+0xB0, 0xA0, 0xB0, 0xD0, 0x28, 0xE2, 0x40, 0xE2, 0x24, 0xE2, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x23,
+0xE0, 0x40, 0xE2, 0x20, 0xE5, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0x40, 0xD1, 0xE0, 0x90,
+0x42, 0xE0, 0xD1, 0xE1, 0xD0, 0xE3, 0x40, 0xD0, 0x26, 0xE0, 0x24, 0xE1, 0x40, 0xD0, 0xE0, 0x25,
+0xE0, 0x20, 0xE0, 0x23, 0xD0, 0x40, 0xD0, 0xA0, 0x07, 0x51, 0x71, 0x30, 0x50, 0x00, 0x50, 0x30,
+0x01, 0x30, 0xB0, 0xD0, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE6, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE1,
+0xD0, 0x91, 0xD0, 0x23, 0xE0, 0x21, 0xE3, 0x40, 0xE2, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE3, 0x91,
+0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x41, 0x90, 0xD0, 0xE1, 0x20,
+0xE0, 0x21, 0xE0, 0x24, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE4, 0x20,
+0xE0, 0x23, 0xE4, 0x24, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD1, 0xE1, 0x21, 0xE0, 0xD0, 0x60, 0x02,
+0xF0, 0x70, 0x00, 0x80, 0x30, 0xC0, 0x0F, 0x0F, 0x0F, 0x0C, 0x50, 0x70, 0x00, 0xA0, 0x02, 0x60,
+0x40, 0xD0, 0xE3, 0x90, 0x40, 0x90, 0xD0, 0xE7, 0x25, 0xE3, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x41,
+0xD1, 0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE3, 0x22, 0xE0, 0xD1, 0xA0, 0x30, 0xF0, 0x60, 0x0A, 0xC0,
+0xA0, 0x70, 0xD0, 0x91, 0xD1, 0x20, 0xE0, 0x23, 0xE0, 0x21, 0xE2, 0x40, 0xE0, 0xD0, 0xE0, 0x20,
+0xE0, 0x24, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE2, 0x21, 0xE0, 0x20, 0x91, 0xD0, 0xE2, 0x20, 0xE3,
+0x91, 0xE0, 0x24, 0xE1, 0x91, 0xE4, 0xD0, 0xE0, 0x42, 0x90, 0xE1, 0xD0, 0xE0, 0xD0, 0xE0, 0x90,
+0xD0, 0xE1, 0x20, 0xE2, 0x25, 0xE2, 0x40, 0xD0, 0xE0, 0x22, 0xE2, 0x21, 0xE0, 0x20, 0xE1, 0x20,
+0xD0, 0x40, 0xD0, 0xB0, 0x50, 0x01, 0xC0, 0x70, 0x50, 0x80, 0x50, 0x06, 0x70, 0xC0, 0x00, 0xA0,
+0x40, 0xD0, 0xE2, 0xD0, 0x91, 0xE3, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xE2, 0x20, 0xE0, 0x21, 0xE0,
+0x20, 0xE1, 0x40, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x22, 0xD0, 0xE0, 0x40, 0xE0, 0x20, 0xE4, 0x20,
+0xE1, 0x20, 0xE2, 0x90, 0x40, 0xE2, 0x20, 0xE2, 0x22, 0xE0, 0x23, 0xD0, 0x90, 0x40, 0x90, 0xD0,
+0xE0, 0x26, 0xE5, 0x23, 0xD0, 0xE0, 0x40, 0x90, 0xE4, 0x20, 0xE0, 0x25, 0xE3, 0x26, 0xE1, 0xD0,
+0x90, 0x40, 0x90, 0xD0, 0xE2, 0xD0, 0xB0, 0x30, 0x02, 0xA0, 0x0F, 0x14, 0x0F, 0x0C, 0x30, 0xA0,
+0x80, 0x70, 0x80, 0x70, 0xA0, 0x50, 0xA0, 0xD2, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE1, 0x22, 0xE2,
+0x27, 0xE3, 0x22, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x23,
+0xE0, 0x21, 0xE0, 0xD0, 0x90, 0x30, 0x10, 0x30, 0xF0, 0x07, 0xA1, 0x01, 0xA0, 0xD0, 0x40, 0x90,
+0xD1, 0x20, 0xE0, 0x25, 0xE1, 0x20, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x23, 0xE0, 0x40,
+0xE0, 0xD0, 0xE5, 0x20, 0xE1, 0x40, 0x20, 0xE8, 0x40, 0xE1, 0x24, 0xE1, 0x40, 0xD0, 0xE0, 0x20,
+0xE2, 0xD0, 0xE0, 0x91, 0xE0, 0x91, 0x41, 0x93, 0xD2, 0xE4, 0x26, 0xE0, 0x40, 0xD0, 0xE0, 0x25,
+0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0xD2, 0x40, 0x91, 0xA0, 0x51, 0x70, 0xC0, 0x00, 0x70, 0xC0, 0x07,
+0x50, 0xA0, 0x40, 0xD1, 0xE4, 0x40, 0xD0, 0xE1, 0x20, 0xE5, 0x40, 0xE1, 0x20, 0xE0, 0x21, 0xE1,
+0x20, 0xE1, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x90, 0x40, 0xE2, 0xD0, 0x21,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x24, 0xE0, 0x90,
+0x40, 0xD0, 0x40, 0x90, 0xE3, 0x24, 0xE3, 0x24, 0xE1, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE2, 0x25,
+0xE2, 0x21, 0xE4, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0xA0, 0x50, 0xA0,
+0x70, 0x80, 0xC0, 0x30, 0xF1, 0x30, 0x0F, 0x10, 0x0F, 0x08, 0xC0, 0x04, 0x60, 0x00, 0x60, 0x80,
+0x01, 0x80, 0x40, 0xE0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x22, 0xE2, 0x28, 0xE3, 0x20, 0xE0, 0xD0,
+0x90, 0x40, 0xE1, 0xD0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x25, 0xE3, 0x40, 0x90, 0xB0, 0xF1,
+0x30, 0xC0, 0x06, 0x50, 0xA1, 0xB0, 0xF0, 0x40, 0x90, 0xE2, 0x26, 0xE3, 0x40, 0x90, 0xE0, 0x20,
+0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE3, 0x20, 0xD0, 0x91, 0xE0, 0x21,
+0xE0, 0x20, 0xE3, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x20,
+0xD0, 0x90, 0xE0, 0xD0, 0xE0, 0xD1, 0xE0, 0x91, 0x43, 0x91, 0xE3, 0x20, 0xE0, 0x20, 0xE4, 0x40,
+0xD0, 0xE0, 0xD1, 0xE2, 0x20, 0xE0, 0x21, 0x92, 0x43, 0x90, 0x50, 0x30, 0x03, 0xC0, 0x70, 0x06,
+0x50, 0xA0, 0x90, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xD0, 0x91, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0xD0,
+0x91, 0xD0, 0xE1, 0x21, 0xE1, 0x21, 0xD0, 0x91, 0xD0, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x91, 0xE1,
+0x20, 0xE3, 0x24, 0xE1, 0x91, 0xE2, 0x20, 0xE3, 0x21, 0xE2, 0x40, 0xE1, 0xD0, 0x90, 0x40, 0xE2,
+0x23, 0xE6, 0x21, 0xE3, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x22, 0xE7,
+0x23, 0xD0, 0xE0, 0x41, 0xD0, 0xB0, 0x70, 0x01, 0x31, 0x70, 0x30, 0x00, 0xC0, 0x30, 0xF0, 0xC0,
+0x0F, 0x0E, 0x0F, 0x08, 0x10, 0xF0, 0x60, 0x80, 0xC0, 0x50, 0xF0, 0x00, 0x70, 0x50, 0x01, 0x80,
+0xF0, 0x40, 0xE0, 0xD1, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x25, 0xE1, 0x23, 0xE3, 0x20, 0xE0, 0xD0,
+0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE4, 0x23, 0xE1, 0x22, 0xE0, 0x40, 0xE0, 0xD0,
+0xB0, 0xA1, 0x81, 0x07, 0x60, 0xC0, 0x50, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE1, 0x20,
+0xE0, 0x20, 0xD0, 0x91, 0xD0, 0x20, 0xE0, 0x22, 0xE2, 0x21, 0xE0, 0x91, 0xD1, 0xE0, 0x22, 0xE3,
+0x20, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xE2, 0x23, 0xE0, 0xD0, 0x90,
+0xE4, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE3, 0x90, 0xE0, 0xD0, 0xE0, 0x20, 0x92, 0x47, 0x90,
+0x40, 0xB0, 0x4A, 0x91, 0xE1, 0xD0, 0xE0, 0x90, 0xD0, 0xA0, 0x50, 0x04, 0x50, 0x03, 0xC0, 0x50,
+0xA0, 0x30, 0x91, 0xE0, 0x25, 0xE1, 0x40, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xD0, 0x20, 0xE0,
+0x40, 0xE3, 0x21, 0xE1, 0x21, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x20, 0xD0,
+0x40, 0x90, 0xE3, 0x25, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x20, 0xE4, 0x20, 0xE1, 0x40, 0xE0, 0xD0,
+0xE0, 0x20, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x22,
+0xE0, 0xD1, 0x90, 0x40, 0xD1, 0xE0, 0x26, 0xE0, 0x21, 0xE5, 0x21, 0xE5, 0xD0, 0x90, 0x40, 0xF0,
+0x50, 0x01, 0x30, 0xC0, 0x70, 0x60, 0x02, 0x70, 0x60, 0x0F, 0x0E, 0x0F, 0x08, 0x81, 0x00, 0x80,
+0x60, 0xA0, 0xC0, 0x01, 0x30, 0x50, 0xF0, 0x10, 0xF0, 0xB0, 0xD0, 0xE1, 0x20, 0xE1, 0x22, 0xE1,
+0x23, 0xE1, 0x21, 0xE0, 0x20, 0xE5, 0x90, 0x40, 0xE1, 0x22, 0xE0, 0x21, 0xE1, 0x20, 0xE3, 0x22,
+0xE1, 0x21, 0x90, 0x40, 0xE2, 0xD0, 0x40, 0x10, 0x60, 0x70, 0x80, 0x06, 0x70, 0x10, 0xA0, 0x90,
+0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE6, 0x90, 0x40, 0xD0, 0xE2, 0x21, 0xE0, 0x20, 0xE4, 0x40, 0xD0,
+0xE1, 0x23, 0xE2, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x91, 0xD0, 0xE2, 0x21,
+0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x40, 0xD0, 0x25, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0xD0, 0xE0, 0xD0, 0x40, 0xD2, 0xE0, 0xD0, 0xE1, 0x90, 0x40, 0xD0, 0xE1, 0xD1, 0xE0, 0xD1,
+0x40, 0xD1, 0xE1, 0xD0, 0xE2, 0x40, 0xD0, 0x30, 0x80, 0x04, 0x81, 0x30, 0xB0, 0xA0, 0x60, 0xB0,
+0xD2, 0x40, 0xE1, 0x25, 0xD0, 0x40, 0x90, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xE1,
+0x22, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x40, 0x20, 0xE2, 0x26,
+0xE3, 0x91, 0xD0, 0xE7, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0xD0, 0xE1,
+0x21, 0xE1, 0x22, 0xE1, 0x20, 0xE1, 0x21, 0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xE1,
+0x20, 0xE0, 0x23, 0xE4, 0x20, 0xE2, 0x22, 0xE0, 0xD0, 0xA0, 0x11, 0xF0, 0x81, 0x01, 0x80, 0xF0,
+0x70, 0x01, 0xA0, 0x70, 0x0F, 0x0D, 0x0F, 0x09, 0xF0, 0x70, 0x05, 0xC0, 0x11, 0x50, 0x00, 0x30,
+0x90, 0xD0, 0x23, 0xE0, 0x28, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0x90, 0xD0, 0xE3,
+0x21, 0xE0, 0x21, 0xE0, 0x23, 0xE5, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x20, 0xD0, 0xA0, 0x11, 0x50,
+0x60, 0x70, 0x05, 0xC0, 0x61, 0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x20, 0xD0, 0x90,
+0x40, 0xD0, 0xE2, 0x20, 0xE1, 0x20, 0xE4, 0x40, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0x40,
+0xD0, 0xE2, 0x22, 0xE0, 0x20, 0xE0, 0x40, 0xE4, 0x22, 0xE0, 0x91, 0xE1, 0x24, 0xE0, 0x91, 0xD0,
+0x22, 0xE3, 0x40, 0xD0, 0xE2, 0x20, 0xE2, 0x40, 0xE7, 0x40, 0xD0, 0xE4, 0xD1, 0x40, 0xD0, 0xE0,
+0x21, 0xE1, 0x20, 0xD0, 0x40, 0xD1, 0x10, 0x30, 0xC0, 0x80, 0xA1, 0xB0, 0x40, 0x91, 0xE0, 0xD4,
+0x40, 0x20, 0xE4, 0x20, 0xE1, 0x20, 0x40, 0xD0, 0xE0, 0x23, 0xE3, 0x40, 0xE1, 0x26, 0xE2, 0x40,
+0xE1, 0x22, 0xE0, 0x23, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x24, 0xE0, 0x23, 0xE0, 0xD1, 0x91, 0xE1,
+0x21, 0xE2, 0x40, 0xE3, 0x23, 0xE1, 0x40, 0x90, 0xE2, 0x27, 0xE0, 0x21, 0xE0, 0x21, 0xE4, 0x90,
+0x40, 0xE2, 0x20, 0xE1, 0x2A, 0xE0, 0x21, 0xE3, 0xD0, 0x40, 0xB0, 0x00, 0x80, 0x11, 0x00, 0x80,
+0xA0, 0xC0, 0x70, 0xF0, 0x60, 0xA0, 0x30, 0x0F, 0x0E, 0x0F, 0x09, 0x51, 0x00, 0xA0, 0x30, 0x80,
+0x51, 0x00, 0x80, 0x50, 0x01, 0x70, 0x60, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE2, 0x23,
+0xE6, 0x20, 0x40, 0x90, 0xD0, 0xE0, 0x23, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x22, 0xE5, 0x91, 0xE3,
+0x20, 0xE0, 0xB0, 0x12, 0x80, 0xA0, 0x70, 0x04, 0x70, 0x60, 0x80, 0xE1, 0x24, 0xE0, 0x23, 0xE1,
+0x40, 0xE0, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0xD0, 0x91, 0xE0, 0x23, 0xE0, 0x23,
+0xD0, 0x40, 0xE3, 0x22, 0xE0, 0x20, 0xD0, 0xE0, 0x40, 0xD0, 0xE3, 0x22, 0xE0, 0x40, 0x90, 0xE0,
+0x25, 0xE0, 0x40, 0xD0, 0xE1, 0x22, 0xE1, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0xE0,
+0x40, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xE2,
+0x20, 0xE0, 0x21, 0xE0, 0x40, 0xE0, 0xD0, 0x90, 0xB0, 0xA0, 0x40, 0xE0, 0xD0, 0xE0, 0x40, 0xD0,
+0xE0, 0x22, 0xE2, 0x91, 0xD0, 0xE5, 0x20, 0xD0, 0x40, 0xE1, 0x23, 0xE0, 0x20, 0xE1, 0x91, 0xD0,
+0x24, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xE2, 0x20, 0xE1, 0x24, 0xE1, 0x40, 0xE1, 0x25, 0xE1, 0x20,
+0xE3, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x26, 0xE1, 0x40, 0x90, 0xE0, 0xD0,
+0x2B, 0xE0, 0x23, 0xE2, 0x90, 0x40, 0xE7, 0x26, 0xE1, 0x21, 0xE0, 0x21, 0xD1, 0xF0, 0x02, 0x80,
+0x50, 0x80, 0x30, 0x50, 0xF0, 0x01, 0x71, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x71, 0x80, 0x10, 0x30,
+0x00, 0xA0, 0x00, 0x50, 0xA0, 0x30, 0x40, 0xD0, 0xE2, 0x20, 0xE2, 0x20, 0xE1, 0x21, 0xE0, 0x21,
+0xE4, 0x90, 0x40, 0xE2, 0x24, 0xE2, 0x23, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0x90,
+0xE4, 0x20, 0xE0, 0xD0, 0x30, 0x10, 0xF0, 0x50, 0x10, 0x50, 0x70, 0x02, 0x50, 0xC0, 0xA0, 0xD1,
+0xE0, 0x24, 0xE4, 0xD0, 0x40, 0xE4, 0x21, 0xE5, 0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE0,
+0x21, 0xD0, 0x91, 0xE0, 0xD0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE1,
+0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x21, 0xE0, 0x40, 0xD0, 0x23, 0xE1, 0xD0, 0x90, 0xE2,
+0x21, 0xE1, 0xD0, 0x91, 0xE0, 0x24, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0xD0, 0x40, 0x20, 0xE0,
+0x20, 0xE0, 0x22, 0xE0, 0x91, 0xE0, 0xD4, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x40, 0xE1,
+0x20, 0xE4, 0xD0, 0xE0, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE3, 0x91, 0xE0, 0x20, 0xE1, 0x23, 0xE1,
+0xD0, 0x40, 0xE4, 0x20, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0x24, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0xD0,
+0x91, 0xD0, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE6, 0xD0, 0x41, 0xD0, 0xE0, 0x21, 0xE0,
+0x23, 0xE0, 0x21, 0xE0, 0x23, 0xE4, 0x20, 0x40, 0x90, 0xD0, 0xE1, 0xD0, 0xE3, 0x23, 0xE1, 0x22,
+0xE0, 0x21, 0xD0, 0xB0, 0x30, 0xA0, 0x70, 0x00, 0xA0, 0x00, 0xA0, 0x01, 0x30, 0x50, 0x00, 0xC0,
+0x0F, 0x10, 0x0F, 0x0C, 0x70, 0xA0, 0x30, 0xF0, 0xC0, 0x01, 0x70, 0xF0, 0x50, 0x01, 0x60, 0xD1,
+0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x20, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0x28,
+0xE2, 0x24, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xE3, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x12, 0xC0,
+0x80, 0x50, 0xC0, 0x50, 0x00, 0x50, 0xC0, 0x00, 0x30, 0x40, 0xE1, 0x24, 0xE2, 0xD0, 0xE0, 0x40,
+0x90, 0xD1, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE3, 0x40, 0xE2, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1,
+0x40, 0xE2, 0x20, 0xE1, 0x21, 0xE1, 0x90, 0x40, 0xE0, 0x25, 0xE0, 0xD0, 0x91, 0xD0, 0xE4, 0x20,
+0xE0, 0x91, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x20, 0xE0, 0x22, 0xE1, 0xD0, 0x91, 0xE1,
+0x23, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x91,
+0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x40, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x91, 0xE3, 0x20, 0xE2, 0xD0,
+0x40, 0x20, 0xE3, 0x20, 0xE1, 0x20, 0xE1, 0x40, 0xE1, 0x23, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40,
+0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x91, 0xE1, 0x22, 0xE1, 0x23, 0xE2, 0xD0, 0x90, 0x40,
+0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x24, 0xE3, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE2, 0x21, 0xE1,
+0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE4, 0xD0, 0x90, 0x40, 0x20, 0xD0, 0xE0, 0xD0, 0xE1, 0x23, 0xE0,
+0x21, 0xE0, 0x21, 0xE0, 0x20, 0xD0, 0x90, 0xA0, 0x01, 0x80, 0xF0, 0xC0, 0x00, 0x30, 0x80, 0x00,
+0x50, 0x30, 0x00, 0x10, 0x0F, 0x10, 0x0F, 0x0C, 0x30, 0x10, 0x80, 0x01, 0xC1, 0x00, 0xA0, 0x02,
+0x80, 0xA0, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0xE3,
+0x27, 0xE1, 0x21, 0xE0, 0x22, 0xE1, 0xD0, 0xE0, 0x40, 0xE5, 0x22, 0xE0, 0xD0, 0x60, 0x11, 0x70,
+0x50, 0x80, 0x00, 0xC0, 0xA0, 0x50, 0x00, 0x30, 0xF0, 0x90, 0xE0, 0x23, 0xE0, 0x23, 0xE0, 0x91,
+0xE0, 0x20, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE3, 0x25, 0xE1, 0x40, 0x90, 0xD0, 0xE3,
+0x21, 0xE1, 0xD0, 0x40, 0xE2, 0x24, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE3, 0x20, 0xE0, 0x90, 0xE0,
+0x40, 0x90, 0x21, 0xE2, 0xD0, 0x40, 0xE1, 0x23, 0xE1, 0x91, 0xE1, 0x22, 0xE2, 0x40, 0xD0, 0xE0,
+0x22, 0xE1, 0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x90, 0xE0, 0x24, 0xE1, 0x91, 0xE0,
+0x22, 0xE1, 0x20, 0xE1, 0x40, 0xE2, 0x22, 0xE1, 0xD0, 0x91, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x21,
+0xE0, 0xD0, 0x91, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE4,
+0x22, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xE4, 0x90, 0x40, 0x90, 0xD0, 0xE1,
+0x22, 0xE0, 0x21, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0x90, 0xE1, 0x26, 0xE0, 0x25, 0xE3, 0x20,
+0xD0, 0x20, 0x40, 0x90, 0xD0, 0xE3, 0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x60, 0x70, 0x01,
+0x70, 0x80, 0xC0, 0x03, 0xC0, 0xA0, 0x81, 0x0F, 0x10, 0x0F, 0x0C, 0x80, 0x71, 0xC0, 0x62, 0x80,
+0xC0, 0x30, 0x00, 0x50, 0x31, 0x40, 0xE0, 0x22, 0xE0, 0x23, 0xE5, 0x40, 0x90, 0xD0, 0xE1, 0x20,
+0xE1, 0x25, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0xD0, 0x90, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22,
+0xE0, 0xD0, 0x10, 0xF0, 0x10, 0xC0, 0x80, 0x10, 0x71, 0x51, 0xC0, 0xA0, 0xD0, 0x25, 0xE3, 0xD0,
+0x90, 0x40, 0xD0, 0x20, 0xE1, 0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xD0, 0x20, 0xE0, 0x20,
+0xE0, 0x22, 0xE3, 0x40, 0xD0, 0xE3, 0x23, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x24, 0xE1, 0x40, 0xD0,
+0xE4, 0x20, 0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE1, 0x91, 0xE1,
+0x22, 0xE2, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0xD0, 0x90, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x40,
+0xD0, 0xE0, 0x21, 0xE4, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xE4, 0x20, 0xE2,
+0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x22, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0,
+0x20, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE1,
+0x25, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0x20, 0xE2, 0x22, 0xE2, 0x21, 0xE0, 0x20,
+0xE1, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x26, 0xE3, 0x20, 0xE0, 0xD0, 0x90,
+0x40, 0x20, 0xD0, 0x20, 0xE2, 0x24, 0xE2, 0xD0, 0x40, 0xB0, 0x30, 0x50, 0x00, 0x30, 0x00, 0x30,
+0x60, 0xC0, 0x02, 0xF0, 0x60, 0x0F, 0x11, 0x0F, 0x0E, 0x80, 0x10, 0x50, 0x01, 0x60, 0x00, 0x80,
+0x60, 0x50, 0x00, 0xC0, 0xA0, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE4, 0xD0, 0x90, 0x40, 0xE0, 0xD0,
+0xE1, 0xD0, 0x20, 0xE3, 0x2B, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xE2,
+0xD0, 0x90, 0xF0, 0x50, 0x10, 0x61, 0xC0, 0x00, 0x70, 0x50, 0xA0, 0xD0, 0xE0, 0x22, 0xE1, 0x22,
+0xE1, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x22, 0xD0, 0xE0, 0x40, 0xD0, 0xE1, 0x26, 0xE0,
+0xD0, 0x40, 0xE4, 0x20, 0xE1, 0x21, 0xD0, 0x40, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x22,
+0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE2, 0x91, 0xE1, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x21,
+0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20,
+0xE0, 0x91, 0xD0, 0x23, 0xE3, 0x91, 0xE3, 0x22, 0xE2, 0x91, 0xE0, 0x20, 0xE0, 0x23, 0xE4, 0x40,
+0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE3, 0x23, 0xE0, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE1,
+0x40, 0x90, 0xD0, 0x90, 0x40, 0xD0, 0xE3, 0x24, 0xE1, 0x23, 0xE2, 0x40, 0x90, 0xD0, 0xE0, 0x20,
+0xE1, 0x20, 0xE0, 0x29, 0xE5, 0x90, 0x40, 0x90, 0xD0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x20,
+0xE1, 0xD0, 0x60, 0x01, 0x80, 0xF0, 0x50, 0x00, 0x50, 0xA0, 0x60, 0x30, 0x01, 0x71, 0x0F, 0x11,
+0x0F, 0x0D, 0x50, 0x60, 0x02, 0xC0, 0xF0, 0x01, 0xA0, 0x02, 0x80, 0xB0, 0xD0, 0xE1, 0x22, 0xE2,
+0xD0, 0xE0, 0x40, 0x90, 0xE2, 0x20, 0xE2, 0x21, 0xE5, 0x25, 0xE2, 0x40, 0x90, 0xD0, 0xE0, 0x20,
+0xE2, 0x23, 0xE2, 0x20, 0xE0, 0xD0, 0xA0, 0x60, 0x70, 0x51, 0x02, 0xC0, 0xA0, 0xB0, 0xD1, 0xE0,
+0x20, 0xE0, 0x20, 0xE3, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xE1,
+0x23, 0xE0, 0x22, 0xE1, 0x40, 0xE3, 0x21, 0xE1, 0x21, 0xE0, 0x40, 0xE0, 0x20, 0xE2, 0x22, 0xE0,
+0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x91, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xE1,
+0x22, 0xE2, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE1, 0xD0,
+0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x20,
+0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0x40, 0xD0, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0x20, 0xE1, 0x23,
+0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE3, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20,
+0xE0, 0x20, 0xE3, 0x21, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE1,
+0x40, 0x90, 0xD0, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x2A, 0xE0, 0x21, 0xE0, 0xD0, 0x90, 0x40,
+0xE3, 0x21, 0xE0, 0x28, 0xE0, 0x20, 0xE1, 0x21, 0xD0, 0xE0, 0x41, 0xD0, 0xE0, 0xD0, 0xE2, 0x20,
+0xE2, 0xD0, 0xA0, 0x50, 0x02, 0xA0, 0x01, 0x70, 0x80, 0x00, 0x80, 0x10, 0x80, 0x0F, 0x13, 0x0F,
+0x0D, 0x81, 0x01, 0x80, 0xF0, 0x70, 0x50, 0x71, 0x80, 0x00, 0x80, 0x30, 0xA0, 0xE3, 0x20, 0xE2,
+0xD0, 0x90, 0x40, 0xE0, 0x22, 0xE1, 0x24, 0xE4, 0x22, 0xE0, 0x21, 0xE2, 0x40, 0xE4, 0x26, 0xE5,
+0x11, 0xA0, 0x30, 0x80, 0x03, 0xC0, 0x30, 0xA0, 0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE1, 0x40, 0xE4,
+0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x21,
+0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE3, 0x90, 0xE0, 0x22, 0xE1, 0x20, 0xE3, 0x40, 0xD0,
+0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x90, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE1, 0x22,
+0xE0, 0x20, 0xE0, 0x90, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x23, 0xE1,
+0x91, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x91, 0xD0, 0xE0,
+0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xE1, 0x25, 0xE1, 0x91, 0xE1, 0x25, 0xE2, 0x40, 0xD0,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x20,
+0xE1, 0xD1, 0x90, 0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0xE4, 0x91, 0xD0, 0x20,
+0xE0, 0x22, 0xE1, 0x23, 0xE0, 0x23, 0xE1, 0x90, 0x40, 0xE6, 0x29, 0xE2, 0x20, 0xE2, 0x90, 0x40,
+0xE0, 0xD1, 0xE2, 0x21, 0xD0, 0x40, 0x31, 0x80, 0x00, 0xA0, 0xC0, 0x06, 0x30, 0x0F, 0x13, 0x0F,
+0x0E, 0xA1, 0xF0, 0x30, 0xC0, 0x70, 0x50, 0x80, 0xC0, 0x30, 0xA0, 0x70, 0x01, 0x60, 0xD0, 0xE3,
+0xD0, 0xE0, 0x91, 0xE1, 0x23, 0xE0, 0x25, 0xE3, 0x22, 0xE4, 0x40, 0xE2, 0x21, 0xE1, 0x26, 0xE3,
+0xD0, 0x60, 0xA0, 0xF0, 0x30, 0xA0, 0x04, 0xC0, 0x50, 0xA0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x40,
+0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0x23, 0xE0, 0x23,
+0xE1, 0x91, 0xD0, 0x22, 0xE0, 0x21, 0xE3, 0x40, 0xD0, 0x21, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE1,
+0x24, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x40, 0x20, 0xE0, 0x40, 0xE2, 0x21, 0xE0, 0x21, 0xE0,
+0x90, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0x90, 0xD0, 0xE1,
+0x20, 0xE0, 0x21, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE0, 0x24, 0xE3, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE0,
+0xD0, 0x91, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0x20, 0xD0, 0x40, 0xE2, 0x20, 0xE1, 0x22, 0xE0, 0x20,
+0xE2, 0x90, 0x40, 0xD0, 0xE5, 0x40, 0x90, 0xD0, 0xE4, 0xD0, 0x91, 0xD0, 0xE0, 0x22, 0xE1, 0x27,
+0xE0, 0x20, 0xE2, 0x40, 0xE0, 0xD0, 0x20, 0xE1, 0x2A, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x91, 0xE0,
+0xD0, 0xE0, 0x21, 0xE0, 0x90, 0xA0, 0x01, 0x50, 0x60, 0x80, 0x0F, 0x1C, 0x0F, 0x0F, 0x70, 0xC0,
+0x01, 0xC0, 0xA0, 0x30, 0x01, 0xA0, 0x02, 0x80, 0x30, 0xD0, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD0,
+0xE0, 0x24, 0xE0, 0x25, 0xE0, 0x20, 0xE4, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xE7, 0x24, 0xE1, 0x20,
+0xE1, 0xD1, 0x40, 0xF0, 0x10, 0x50, 0x10, 0x50, 0x05, 0x31, 0xD0, 0x20, 0xE0, 0xD0, 0x91, 0xD0,
+0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE2,
+0x40, 0xD0, 0xE0, 0x26, 0xE1, 0x91, 0xE1, 0x22, 0xE0, 0x21, 0xD0, 0xE0, 0x40, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x21, 0xE2, 0x90, 0xD0, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x21,
+0xE0, 0x21, 0xD0, 0x40, 0xE4, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE3, 0x40, 0xD0,
+0xE0, 0x20, 0xE0, 0x21, 0xE2, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0xE1, 0x21,
+0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE2, 0xD0, 0x91, 0x20, 0xE0, 0x21, 0xE2, 0x21, 0xE1,
+0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x21, 0xE2, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x26,
+0xE1, 0x40, 0x90, 0xD0, 0xE3, 0x40, 0xE1, 0x21, 0xE5, 0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x23,
+0xE0, 0x23, 0xE1, 0x20, 0x40, 0x90, 0xD0, 0xE4, 0x24, 0xE0, 0x23, 0xE2, 0x20, 0xE2, 0xD0, 0x90,
+0x40, 0xE1, 0x21, 0xD0, 0xA0, 0x50, 0x02, 0xA0, 0x0F, 0x1D, 0x0F, 0x18, 0x50, 0x80, 0x00, 0x30,
+0x80, 0x30, 0x40, 0xD1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE4, 0x22, 0xE0, 0x20, 0xE0,
+0x20, 0xE1, 0x20, 0xE3, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x21, 0xE3, 0x24, 0xE0, 0x20, 0xE1, 0x20,
+0xE0, 0xD0, 0x40, 0xE0, 0x60, 0x11, 0x60, 0x10, 0x05, 0x30, 0x40, 0xE0, 0xD1, 0x91, 0xD0, 0x20,
+0xE0, 0x23, 0xE2, 0x20, 0xE2, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x23, 0xE2, 0x20, 0xD0, 0x40, 0x90,
+0x25, 0xE0, 0x22, 0xE0, 0x40, 0xE0, 0xD0, 0x23, 0xE3, 0x91, 0xE0, 0x26, 0xE0, 0x91, 0xD0, 0x20,
+0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE3, 0x22,
+0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x40,
+0xD0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xE2,
+0x23, 0xE3, 0x40, 0xE3, 0x20, 0xE0, 0x21, 0xE2, 0x91, 0xE0, 0x22, 0xE2, 0x22, 0xE0, 0xD0, 0x91,
+0xE2, 0x28, 0xE0, 0xD0, 0x40, 0x90, 0xD1, 0xE0, 0x40, 0xE1, 0x22, 0xE4, 0x20, 0xE0, 0x90, 0x40,
+0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x23, 0xE0, 0xD0, 0x40, 0x90, 0xE6, 0x21, 0xE0, 0x24,
+0xE1, 0x20, 0xE2, 0x21, 0xD0, 0xE0, 0x40, 0x90, 0xE0, 0xD0, 0xB0, 0x31, 0x80, 0x00, 0x30, 0x70,
+0x0F, 0x1D, 0x0F, 0x19, 0x30, 0x60, 0x70, 0x01, 0xA0, 0xE0, 0x40, 0x90, 0x21, 0xE1, 0x20, 0xE4,
+0x24, 0xE0, 0x23, 0xE1, 0x20, 0xE1, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xE1, 0x23, 0xE0, 0x24, 0xE1,
+0xD0, 0x40, 0x90, 0xD1, 0xF0, 0x12, 0x80, 0x03, 0x70, 0x30, 0xD0, 0x40, 0x90, 0xE0, 0x40, 0xE1,
+0x22, 0xE3, 0x23, 0xD0, 0x90, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0xD0, 0x91, 0xD0,
+0x26, 0xE0, 0x20, 0xE0, 0x91, 0xD0, 0xE0, 0x24, 0xE2, 0x40, 0xE1, 0x24, 0xE1, 0xD0, 0x40, 0xE2,
+0x21, 0xE3, 0x20, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x22,
+0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x40, 0xD0,
+0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x91, 0xD0, 0x21, 0xE0, 0x21, 0xE2, 0x91, 0xE1, 0x21, 0xE0, 0x20,
+0xE2, 0xD0, 0x40, 0x90, 0xE3, 0x23, 0xE0, 0xD1, 0x40, 0xE1, 0x21, 0xE2, 0x22, 0xE1, 0xD0, 0x40,
+0xE1, 0x20, 0xE1, 0x26, 0xE0, 0x20, 0xE0, 0x40, 0xE0, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE1,
+0x20, 0xE2, 0x21, 0xE0, 0x91, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x21, 0xE2, 0x23, 0xE1, 0x90, 0x40,
+0xD0, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x23, 0xE5, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xA0, 0x01, 0x70,
+0xF0, 0x80, 0x0F, 0x1E, 0x0F, 0x1A, 0xA0, 0x02, 0xB0, 0xA0, 0xD0, 0xE0, 0x23, 0xE5, 0x21, 0xE2,
+0x25, 0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE2, 0x21, 0xE1, 0x22, 0xE3, 0x20, 0xE1, 0x20, 0xE0,
+0x40, 0x90, 0xE1, 0xD0, 0x40, 0x12, 0xA0, 0x70, 0x02, 0x50, 0xA0, 0xD0, 0xE0, 0x41, 0xD1, 0xE0,
+0x22, 0xE5, 0x20, 0xE1, 0x40, 0xD0, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0xD0, 0x40, 0xE1, 0x28,
+0xE0, 0x40, 0xE1, 0x25, 0xE2, 0x40, 0xD0, 0x22, 0xE0, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x22, 0xE3,
+0x91, 0xE2, 0x21, 0xE3, 0x40, 0xD0, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0,
+0x22, 0xE0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x40, 0xE1, 0x20, 0xE2, 0x22, 0xE0, 0x40, 0xD0,
+0xE0, 0x20, 0xE0, 0x21, 0xE3, 0x40, 0xE5, 0x20, 0xE3, 0x40, 0xE3, 0x23, 0xE1, 0xD0, 0x91, 0xD0,
+0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x21, 0xE2, 0xD0, 0xB0, 0xE1, 0x21, 0xD0, 0xE0,
+0xB0, 0x40, 0xD1, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE1, 0x90, 0x40, 0xD0, 0xE0,
+0x22, 0xE2, 0x22, 0xE2, 0x20, 0xE0, 0x22, 0xE0, 0x90, 0x40, 0xE6, 0x22, 0xE1, 0x22, 0xE2, 0x21,
+0xE0, 0x20, 0xE1, 0xD1, 0x60, 0x50, 0x02, 0xA0, 0x0F, 0x1F, 0x0F, 0x1A, 0x70, 0x80, 0x00, 0x30,
+0x80, 0xA0, 0x90, 0xD0, 0xE0, 0x22, 0xE4, 0x21, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x40,
+0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x27, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x21,
+0xD0, 0xF0, 0x12, 0xA0, 0x02, 0x11, 0xD0, 0xE0, 0x42, 0xD0, 0xE1, 0x23, 0xE3, 0x20, 0xD0, 0x40,
+0x90, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xE1, 0x25, 0xE0, 0x20,
+0xE0, 0x91, 0xD0, 0xE1, 0x23, 0xE1, 0xD0, 0x91, 0xE0, 0x22, 0xE0, 0x21, 0xE2, 0x90, 0xE0, 0x22,
+0xE3, 0xD0, 0x91, 0xE0, 0x23, 0xE2, 0x20, 0x40, 0xD0, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xD0,
+0xE0, 0x21, 0xE0, 0x22, 0xE0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x91, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xE4, 0x23, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE5, 0x91, 0xE3,
+0x22, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x20, 0xE1, 0x21, 0xE3, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE1,
+0xD0, 0xB0, 0x11, 0xB0, 0xE0, 0xD1, 0x40, 0x90, 0x40, 0xE3, 0x20, 0xE1, 0x21, 0xE1, 0x20, 0xE0,
+0x21, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x20, 0xE0, 0x22, 0xE2, 0x21, 0xE0, 0x20, 0xD0,
+0x90, 0x40, 0xE0, 0xD0, 0x21, 0xE2, 0x22, 0xE1, 0x25, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40,
+0xB0, 0x81, 0x00, 0xA0, 0xC0, 0x0F, 0x1F, 0x0F, 0x1B, 0x30, 0x60, 0xC0, 0x01, 0x60, 0xD0, 0xE0,
+0xD0, 0x22, 0xE2, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE3, 0x90, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE0,
+0x23, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE0, 0xD0, 0x60, 0x10, 0xA0,
+0x80, 0x70, 0x01, 0x81, 0xD0, 0x40, 0x90, 0xD0, 0x90, 0x40, 0xE3, 0x25, 0xD0, 0x91, 0xD0, 0x20,
+0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xE2, 0x23, 0xE3, 0xD0, 0x40, 0xE2, 0x23, 0xE2,
+0xD0, 0x40, 0xE1, 0x22, 0xE0, 0x21, 0xE0, 0xD0, 0x91, 0xE0, 0x22, 0xE3, 0xD0, 0x40, 0xE1, 0x23,
+0xE2, 0x91, 0xD0, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x22, 0xE0, 0x40,
+0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x40, 0xE0, 0x24, 0xE1, 0xD0, 0x91, 0xD0, 0xE2, 0x23, 0xE1, 0x40,
+0xE2, 0xD0, 0xE1, 0x20, 0xE3, 0x40, 0xD0, 0xE1, 0x25, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE2, 0x21,
+0xE1, 0x20, 0xE2, 0xD0, 0x91, 0xE3, 0xD0, 0x10, 0xF0, 0x60, 0xD1, 0xE0, 0x40, 0x90, 0xD0, 0x91,
+0xD0, 0xE4, 0x22, 0xE1, 0x21, 0xE3, 0x90, 0x40, 0xD0, 0x21, 0xE1, 0x21, 0xE0, 0x23, 0xE1, 0x20,
+0xE1, 0x20, 0xE2, 0x40, 0xE0, 0xD0, 0xE2, 0x23, 0xE2, 0x24, 0xE4, 0x90, 0xA0, 0x01, 0x70, 0x60,
+0x80, 0x0F, 0x20, 0x0F, 0x1C, 0xA0, 0x02, 0x30, 0xA0, 0xD0, 0x24, 0xE1, 0x23, 0xE1, 0x21, 0xE2,
+0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x23, 0xE2, 0x40, 0x90, 0xD0,
+0xE3, 0x21, 0xD0, 0xB0, 0x11, 0x30, 0x60, 0x01, 0x70, 0xA0, 0x91, 0xD0, 0xE0, 0xD0, 0xE0, 0x40,
+0xE2, 0x23, 0xE2, 0x40, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE3, 0x91, 0xD0, 0xE0, 0x21, 0xE0,
+0x20, 0xE3, 0xD0, 0x91, 0xE0, 0x25, 0xE3, 0x40, 0xE1, 0x24, 0xE2, 0x40, 0xD0, 0x23, 0xE4, 0x40,
+0xE0, 0x24, 0xE2, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x22,
+0xE0, 0x91, 0xE0, 0x25, 0xE1, 0x40, 0xE0, 0x21, 0xE0, 0x20, 0xE3, 0x20, 0x40, 0xD0, 0xE0, 0x25,
+0xE0, 0xD0, 0x40, 0xE1, 0xD0, 0xA0, 0x90, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x25,
+0xE1, 0xD0, 0x91, 0xE1, 0x21, 0xE1, 0x22, 0xE3, 0x40, 0xE1, 0x20, 0xE3, 0xD1, 0x90, 0x40, 0xE2,
+0xD0, 0x91, 0xD0, 0xE2, 0x24, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD1, 0x90, 0x40, 0xD0, 0xE0, 0x22,
+0xE0, 0x25, 0xE8, 0x40, 0x90, 0xE0, 0x20, 0xE3, 0x22, 0xE1, 0x26, 0xE0, 0xD0, 0xF0, 0x80, 0x01,
+0xC0, 0x30, 0x0F, 0x21, 0x0F, 0x1C, 0x70, 0x30, 0x00, 0x30, 0x50, 0x80, 0xB0, 0xD0, 0x2B, 0xE2,
+0xD0, 0xE0, 0x91, 0xD0, 0xE0, 0x25, 0xE2, 0x27, 0xE1, 0x40, 0x90, 0xD0, 0xE3, 0x23, 0xD0, 0xA0,
+0x12, 0x30, 0xC0, 0x00, 0x30, 0x80, 0xD0, 0xE2, 0xD0, 0xE0, 0x40, 0x90, 0xE0, 0xD2, 0xE1, 0xD0,
+0x40, 0xE1, 0x20, 0xE1, 0x22, 0xE2, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0xD0,
+0x40, 0xD0, 0x21, 0xE0, 0x23, 0xE1, 0xD0, 0x91, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x40, 0xD0, 0x23,
+0xE4, 0x40, 0xE0, 0x24, 0xE2, 0x91, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x23, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE3, 0x20, 0xE2, 0x20,
+0xE0, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x22, 0xE1, 0x91, 0xE1, 0x90, 0x20, 0xE0, 0x21, 0xE0, 0x20,
+0xE0, 0x20, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x21,
+0xE1, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x90, 0x40, 0xE2, 0x21, 0xE0,
+0x40, 0x90, 0xD0, 0xE1, 0x22, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xE0,
+0x21, 0xE1, 0x24, 0xE5, 0x21, 0xE1, 0x40, 0x90, 0xD1, 0xE3, 0x28, 0xE0, 0x20, 0xD0, 0xA0, 0x50,
+0x80, 0x30, 0x00, 0xA0, 0xC0, 0x0F, 0x21, 0x0F, 0x1D, 0x80, 0xF0, 0xC0, 0x01, 0x30, 0x40, 0xD0,
+0xE0, 0x24, 0xE2, 0x21, 0xE1, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x26, 0xE1, 0x25, 0xE0, 0x20,
+0xE1, 0x40, 0x90, 0xD0, 0xE2, 0x25, 0xE0, 0xD0, 0xA0, 0x12, 0x81, 0x30, 0xF0, 0x40, 0xD0, 0xE4,
+0x40, 0x90, 0x40, 0x60, 0xB0, 0x90, 0xD0, 0x91, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x22,
+0x40, 0x90, 0xE1, 0x25, 0xE2, 0x90, 0x40, 0xE2, 0x23, 0xE2, 0xD0, 0x40, 0xD0, 0xE0, 0x22, 0xE0,
+0x21, 0xE0, 0xD0, 0xE0, 0x40, 0xE1, 0x23, 0xE2, 0x91, 0xE0, 0x23, 0xE2, 0xD0, 0x90, 0x20, 0xE0,
+0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x91, 0xE0, 0x20, 0xE1, 0x22,
+0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE2, 0x40, 0xE1, 0x20, 0xE2, 0x22, 0xE1, 0x40, 0xD0,
+0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE2, 0x22, 0xE0, 0x91, 0xE1,
+0x20, 0xE2, 0x23, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE1, 0x22, 0xE0,
+0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x25, 0xE3, 0x22, 0xE1, 0x91, 0xD1, 0xE1, 0x20, 0xE1, 0x22, 0xE4,
+0x23, 0xE1, 0x90, 0x40, 0xE0, 0xD0, 0x21, 0xE1, 0x26, 0xE1, 0xD0, 0x40, 0x80, 0x01, 0x70, 0x10,
+0x50, 0x0F, 0x22, 0x0F, 0x1E, 0x30, 0xC0, 0x01, 0x80, 0xF0, 0xD1, 0xE0, 0x23, 0xE2, 0x21, 0xE0,
+0xD0, 0xE0, 0x40, 0xE1, 0xD0, 0x29, 0xE0, 0x25, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x28, 0xE1,
+0xD0, 0x60, 0x12, 0x81, 0x11, 0x90, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0xB0, 0x13, 0x40,
+0xD0, 0x22, 0xE1, 0x20, 0xE2, 0x22, 0x91, 0xE2, 0x25, 0xE1, 0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE0,
+0x23, 0xE2, 0x91, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x90, 0xE3, 0x21, 0xE0, 0x21, 0xE0,
+0x91, 0xE1, 0x21, 0xE3, 0xD0, 0x40, 0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24,
+0xE1, 0x91, 0xE0, 0x21, 0xE0, 0x23, 0xD0, 0x90, 0xE2, 0x24, 0xE0, 0xD0, 0x91, 0xE0, 0x20, 0xE2,
+0x23, 0xE0, 0x40, 0xE2, 0x23, 0xE1, 0x21, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE1, 0x21, 0xE1, 0x40,
+0xE5, 0x24, 0xE0, 0xD1, 0x40, 0xE0, 0xD1, 0x90, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE2, 0xD0, 0x40,
+0xE1, 0x20, 0xE0, 0x22, 0xE4, 0x23, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE2, 0x22, 0xE0, 0x20, 0xE4,
+0x24, 0xE1, 0x90, 0x40, 0xE2, 0x27, 0xE0, 0x20, 0xE1, 0x10, 0x50, 0x01, 0x70, 0x30, 0x0F, 0x23,
+0x0F, 0x1F, 0x60, 0x00, 0xA0, 0x50, 0xC0, 0xA0, 0xD0, 0xE0, 0x22, 0xE3, 0x20, 0xE0, 0xD0, 0x90,
+0x40, 0xE1, 0x21, 0xE3, 0x24, 0xE0, 0x21, 0xE0, 0x22, 0xE1, 0x40, 0x90, 0xE0, 0x20, 0xE6, 0x23,
+0xE0, 0xD0, 0xE0, 0x60, 0x10, 0x30, 0x11, 0x60, 0x50, 0xF0, 0x90, 0xD0, 0xE3, 0xD0, 0x90, 0xB0,
+0x60, 0x10, 0xB0, 0xE0, 0xD0, 0xE0, 0x21, 0xE0, 0x23, 0xE0, 0x21, 0xD0, 0x40, 0xE6, 0x22, 0xE0,
+0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0xD0, 0x91, 0xD0, 0x24, 0xE0,
+0x20, 0xE1, 0x40, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE0, 0x22, 0xE3, 0xD0, 0x40,
+0x23, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE1, 0x91, 0xE0, 0x26, 0xD0, 0x91,
+0xE1, 0x24, 0xE0, 0xD0, 0xE0, 0x40, 0xE0, 0x21, 0xE1, 0x22, 0xE1, 0x91, 0xE0, 0x23, 0xE1, 0x22,
+0xD0, 0x40, 0xE2, 0x22, 0xE1, 0x21, 0xE2, 0x40, 0xE3, 0x22, 0xE5, 0x20, 0x40, 0xD0, 0x90, 0x40,
+0xD2, 0xE0, 0x23, 0xE4, 0x40, 0xE2, 0x26, 0xE2, 0x22, 0xE1, 0x91, 0xE1, 0x23, 0xE1, 0x23, 0xE1,
+0x22, 0xE4, 0x40, 0x90, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0x60, 0x00, 0x80,
+0x30, 0xC0, 0xA0, 0x0F, 0x24, 0x0F, 0x1F, 0xC0, 0xF0, 0xC0, 0x01, 0x80, 0xB0, 0xD0, 0x20, 0xE0,
+0x21, 0xE0, 0x20, 0xE0, 0xD0, 0xE0, 0x91, 0xE1, 0x20, 0xE1, 0x20, 0xE2, 0x26, 0xE0, 0x20, 0xE1,
+0x20, 0xD0, 0x40, 0x90, 0xE0, 0x22, 0xE6, 0x22, 0xE1, 0xD1, 0x80, 0x11, 0xA0, 0xF0, 0x62, 0xD1,
+0xE1, 0x20, 0xE1, 0xD1, 0xB0, 0x90, 0xD0, 0xE2, 0x20, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0x91, 0xE7,
+0x21, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x22, 0xE2, 0x20, 0xD0, 0x40, 0xD0, 0xE0, 0x22,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x90, 0xE0, 0x21, 0xE3, 0x20, 0xE1, 0x40, 0xE1, 0x22, 0xE3, 0xD0,
+0x40, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE1, 0x23, 0xE1, 0x91, 0xE1, 0x25,
+0xE1, 0x90, 0xD0, 0xE0, 0x24, 0xE1, 0xD0, 0x40, 0xE0, 0x20, 0xE3, 0x22, 0xE0, 0xD0, 0x40, 0xE1,
+0x22, 0xE1, 0x22, 0xE0, 0x91, 0xD0, 0xE0, 0x21, 0xE2, 0x21, 0xE1, 0xD0, 0x40, 0x90, 0xE1, 0x20,
+0xE0, 0x22, 0xE3, 0x20, 0xD0, 0x41, 0x90, 0xD1, 0xA0, 0xB0, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x20,
+0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x27, 0xE2, 0x22, 0xE1, 0x91, 0xD0, 0xE0, 0x20, 0xE3, 0x24, 0xE3,
+0x20, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xD0, 0xE2, 0x21, 0xE2, 0xD0, 0xB0, 0x50, 0x01, 0x70, 0xF0,
+0x0F, 0x25, 0x0F, 0x20, 0x80, 0x50, 0x01, 0x30, 0x60, 0x40, 0xD0, 0xE3, 0x20, 0xE1, 0x40, 0x90,
+0xE8, 0x28, 0xE2, 0xD0, 0x40, 0x90, 0xE0, 0x22, 0xE0, 0x23, 0xE3, 0x21, 0xE1, 0xD0, 0x40, 0xE0,
+0x30, 0x13, 0x70, 0xA1, 0x90, 0xD0, 0xE0, 0x21, 0xE1, 0x90, 0x41, 0x90, 0xD0, 0xE2, 0x20, 0xE0,
+0x20, 0xE1, 0x21, 0xE0, 0x40, 0xD0, 0xE2, 0x20, 0xE2, 0x22, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE1,
+0x21, 0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE1, 0x21, 0xE0, 0x21, 0xE1, 0x91, 0xE0, 0x20, 0xE0, 0x20,
+0xE1, 0x22, 0xE0, 0x40, 0xE1, 0x22, 0xE3, 0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE1, 0x23, 0xE2, 0x40, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x25, 0xE0, 0xD0,
+0x90, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0x20, 0xD0, 0x21, 0xE0, 0x21, 0xE0, 0x20, 0xE2,
+0x40, 0xD0, 0xE0, 0x24, 0xE4, 0x20, 0x40, 0xD0, 0xE0, 0x22, 0xE5, 0xD0, 0x90, 0x41, 0xE2, 0x90,
+0x25, 0xE2, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x23, 0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x90,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x27, 0xE2, 0x24, 0xE1, 0x91, 0xD1, 0xE0, 0x22, 0xE0, 0xD0, 0xB0,
+0x60, 0x80, 0x01, 0x80, 0x50, 0x0F, 0x25, 0x0F, 0x21, 0xA0, 0x70, 0xA0, 0x70, 0x00, 0xA0, 0x90,
+0xD0, 0x20, 0xE3, 0x40, 0x90, 0xD0, 0xE4, 0x20, 0xE1, 0x29, 0xE2, 0x40, 0x90, 0xD0, 0x21, 0xE0,
+0x26, 0xE5, 0xD0, 0x91, 0xD2, 0x30, 0x13, 0x30, 0xA0, 0x30, 0xD4, 0x40, 0xD1, 0x41, 0xE0, 0xD0,
+0xE0, 0x21, 0xE4, 0x91, 0xE0, 0xD0, 0x27, 0xE0, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE1, 0x20, 0xE1,
+0x21, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE1, 0x22, 0xE1, 0x20,
+0xE0, 0x21, 0x90, 0xD0, 0xE0, 0x22, 0xE3, 0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE2, 0x22, 0xE2, 0x40, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xE0, 0x22, 0xE1, 0x21, 0xE1,
+0x91, 0xD0, 0x21, 0xE3, 0x20, 0xE1, 0x91, 0xE0, 0x24, 0xE0, 0x20, 0xE2, 0x91, 0xE1, 0x23, 0xE5,
+0x91, 0xE4, 0x20, 0xE0, 0xD0, 0xE1, 0x40, 0x90, 0xD0, 0xE0, 0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE0,
+0x21, 0xE2, 0x20, 0xE0, 0x21, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0x22, 0xE3, 0x20, 0xE0, 0x21,
+0xE0, 0x90, 0x40, 0xD0, 0x20, 0xE1, 0x26, 0xE2, 0x21, 0xE1, 0x21, 0xE1, 0x90, 0x40, 0xD0, 0xE1,
+0x20, 0xE0, 0xD0, 0x90, 0xA0, 0x00, 0x50, 0xA0, 0x50, 0x80, 0x70, 0x30, 0x80, 0x0F, 0x23, 0x0F,
+0x22, 0x60, 0xC0, 0x02, 0xF0, 0xD0, 0xE1, 0xD0, 0xE0, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE4, 0x2A,
+0xE1, 0x40, 0x90, 0xE1, 0x24, 0xE0, 0x24, 0xE3, 0xD0, 0x91, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xF0,
+0x13, 0xA0, 0xF0, 0x60, 0x40, 0xB0, 0x40, 0xE1, 0xD1, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x21, 0xE3,
+0x40, 0xE1, 0x20, 0xE0, 0x23, 0xE0, 0x21, 0xE1, 0x40, 0xE1, 0x21, 0xE0, 0x21, 0xE0, 0x21, 0xE0,
+0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x22, 0xE1, 0x40, 0xE2, 0x20, 0xE2, 0x20, 0xE1,
+0x91, 0xD0, 0xE0, 0x22, 0xE3, 0xD0, 0x40, 0xE0, 0x22, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x21,
+0xE2, 0xD0, 0x40, 0xE1, 0x25, 0xE1, 0x90, 0xE1, 0x21, 0xE1, 0x21, 0xE2, 0x40, 0xE0, 0x21, 0xE2,
+0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x21, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x22, 0xE2,
+0x22, 0xD0, 0x40, 0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0xE0, 0x90, 0x40, 0xE2, 0xD0, 0x90, 0x40, 0xD0,
+0xE1, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE6, 0x22, 0xE4, 0x21, 0xE0,
+0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x26, 0xE2, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE0, 0xD0, 0x90, 0x40,
+0xE0, 0xD0, 0xE2, 0xF0, 0x02, 0x70, 0x60, 0x00, 0x80, 0x70, 0x30, 0x0F, 0x23, 0x0F, 0x22, 0xC0,
+0x30, 0x01, 0x30, 0x80, 0xA0, 0xD1, 0x90, 0x40, 0xE1, 0x22, 0xE3, 0x24, 0xE1, 0x22, 0xE0, 0x20,
+0xE1, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0x24, 0xE0, 0x24, 0xE3, 0x40, 0xE1, 0x21, 0xE1, 0xD0, 0xE0,
+0xB0, 0xF0, 0x13, 0x60, 0xB0, 0xA0, 0x90, 0xD0, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0x20, 0xE2, 0x20,
+0xD0, 0x40, 0x90, 0xE0, 0x25, 0xE4, 0x91, 0xE0, 0xD1, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0x91, 0xD0,
+0xE0, 0x20, 0xE2, 0x21, 0xE2, 0x90, 0xD0, 0xE0, 0x20, 0xE6, 0x91, 0xE1, 0x22, 0xE3, 0xD0, 0x40,
+0xE0, 0x22, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE2, 0x21, 0xE2, 0xD0, 0x40, 0xE1, 0x25, 0xE1, 0x91,
+0xE0, 0x20, 0xE1, 0x21, 0xE2, 0xD0, 0x40, 0xE1, 0x20, 0xE1, 0x24, 0xD0, 0x91, 0xE0, 0x20, 0xE0,
+0x22, 0xE0, 0x20, 0xE2, 0x91, 0xE1, 0x22, 0xE2, 0x21, 0xE1, 0x91, 0xD0, 0xE2, 0xD0, 0x90, 0x40,
+0x90, 0xD0, 0xE1, 0x20, 0xE0, 0xD0, 0x40, 0x90, 0xE0, 0x20, 0xE2, 0x23, 0xE0, 0x23, 0xE1, 0x40,
+0xE6, 0x22, 0xE2, 0x23, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x27, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x21,
+0xE0, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0xA0, 0x81, 0x01, 0xA0, 0x02, 0x80, 0x70, 0x0F, 0x23,
+0x0F, 0x20, 0xF1, 0x70, 0x50, 0x31, 0x70, 0x00, 0x80, 0xB0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE2,
+0x22, 0xE0, 0x20, 0xE3, 0x22, 0xE1, 0x40, 0x90, 0xE3, 0x23, 0xE0, 0x22, 0xE0, 0x22, 0xE2, 0x40,
+0xE0, 0xD0, 0x20, 0xE0, 0x22, 0xE1, 0xD1, 0x40, 0xB0, 0xF0, 0x10, 0xB0, 0xD0, 0x40, 0xE2, 0x22,
+0xE2, 0x40, 0x90, 0xE2, 0x90, 0x40, 0xD0, 0xE2, 0x22, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0x90, 0x60,
+0xA0, 0xE0, 0xD0, 0xE2, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE1, 0x23, 0xE0, 0x91, 0xE1, 0x21,
+0xE1, 0x21, 0xE0, 0xD0, 0x40, 0x20, 0xE1, 0x22, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x22, 0xE2, 0x21,
+0x40, 0xD0, 0xE4, 0x20, 0xE1, 0xD0, 0x40, 0x20, 0xE0, 0x26, 0xE0, 0x91, 0x21, 0xE2, 0x20, 0xE0,
+0x21, 0xE0, 0x91, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x20, 0xE0, 0x24, 0xE2,
+0x40, 0xD0, 0x24, 0xE0, 0x21, 0xE1, 0x20, 0xD0, 0x40, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x20, 0xE7,
+0x40, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x23, 0xE5, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x23, 0xE1, 0x22,
+0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x23, 0xE0, 0x22, 0xE1, 0x23, 0xE1, 0x22, 0xE1, 0x40, 0xE0, 0x30,
+0x70, 0x00, 0x50, 0x31, 0x70, 0x50, 0xA0, 0x80, 0x0F, 0x25, 0x0F, 0x20, 0xC0, 0x00, 0x60, 0x00,
+0x30, 0x50, 0x01, 0x70, 0x10, 0xB0, 0xD0, 0xE0, 0x20, 0xE0, 0x29, 0xE4, 0x21, 0xE0, 0xD0, 0x40,
+0x90, 0xE0, 0x21, 0xE0, 0x23, 0xE4, 0x22, 0xE1, 0xD0, 0x40, 0x90, 0xE0, 0x21, 0xE0, 0x23, 0xE2,
+0x20, 0xE0, 0xD0, 0x40, 0xD0, 0x40, 0xE0, 0xD0, 0xE1, 0x23, 0xE0, 0xD1, 0x90, 0x40, 0x90, 0xD0,
+0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE0, 0x21, 0xE4, 0x91, 0xE0, 0xD0, 0x40, 0xA0, 0xF0, 0xB0, 0xD0,
+0xE1, 0x21, 0xE0, 0x90, 0xE1, 0x21, 0xE3, 0x20, 0xE0, 0xD0, 0x40, 0xE6, 0x21, 0xE0, 0xD0, 0x40,
+0xE2, 0x22, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x22, 0xE0, 0x21, 0xE1, 0x40, 0xD0, 0xE4, 0x20, 0xE1,
+0xD0, 0x90, 0xE1, 0x26, 0xE1, 0x90, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xE1, 0x20,
+0xE1, 0x22, 0xE2, 0x40, 0xE2, 0x22, 0xE1, 0x21, 0xE1, 0x40, 0x90, 0x23, 0xE0, 0x23, 0xE2, 0x90,
+0x40, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x21, 0xE0, 0x90, 0x40, 0xD0, 0x20, 0xE3,
+0x23, 0xE6, 0x40, 0xD0, 0x21, 0xE1, 0x20, 0xE0, 0x23, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x90,
+0x40, 0xD0, 0xE1, 0x21, 0xE0, 0x22, 0xE1, 0x23, 0xE2, 0x22, 0xE0, 0xD0, 0xA0, 0x10, 0xC0, 0x01,
+0x30, 0x50, 0xC0, 0xA0, 0x70, 0x30, 0x10, 0xC0, 0x0F, 0x23, 0x0F, 0x1D, 0xC0, 0x03, 0xA0, 0x50,
+0x00, 0x30, 0x70, 0x80, 0x10, 0x60, 0xA0, 0x40, 0xD0, 0x20, 0xE3, 0x23, 0xE5, 0x20, 0xE3, 0x40,
+0xE1, 0x20, 0xE1, 0x25, 0xE6, 0x20, 0xE0, 0x40, 0x90, 0xE0, 0x22, 0xE5, 0x22, 0xE0, 0xD1, 0x40,
+0x90, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE4, 0xD0, 0x20, 0x41, 0x90, 0xD0, 0xE3, 0x20, 0xE0, 0x20,
+0xE1, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0x20, 0xE0, 0xD1, 0x40, 0xB0, 0x20, 0xE1, 0x20, 0xE0, 0x91,
+0xE0, 0x22, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x21, 0xE2, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x23,
+0xE3, 0x91, 0xE0, 0x22, 0xE5, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x20, 0xE1, 0xD0, 0x90, 0xE1, 0x27,
+0xE0, 0x40, 0xE0, 0x20, 0xE2, 0x20, 0xE4, 0x40, 0xE1, 0x20, 0xE1, 0x22, 0xE1, 0xD0, 0x91, 0xD0,
+0xE0, 0x22, 0xE1, 0x21, 0xE2, 0x40, 0xE0, 0x26, 0xE2, 0xD1, 0x41, 0x90, 0xD1, 0xE0, 0x20, 0xE0,
+0x20, 0xE1, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE3, 0x23, 0xE1, 0x21, 0xE1, 0xD0, 0x91, 0xD0, 0xE1,
+0x20, 0xE1, 0x24, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xE3, 0x23, 0xE1, 0x23, 0xE1, 0x23,
+0xD0, 0x40, 0xA0, 0xF0, 0x10, 0x51, 0x80, 0x00, 0x81, 0x01, 0x70, 0x10, 0xC0, 0x0F, 0x22, 0x0F,
+0x1C, 0x30, 0x10, 0x61, 0xA0, 0x60, 0xA0, 0x02, 0xA0, 0x10, 0xA0, 0x01, 0xA0, 0x90, 0xD0, 0xE3,
+0x24, 0xE0, 0x20, 0xE1, 0x20, 0xE2, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x26, 0xE2, 0x21,
+0xE1, 0x91, 0xD0, 0x23, 0xE6, 0x21, 0xE2, 0x40, 0xD0, 0xE3, 0x20, 0xE3, 0x20, 0xE2, 0xD0, 0x41,
+0x90, 0xD0, 0xE1, 0x22, 0xE2, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE1, 0xD1, 0x20, 0xE1, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0x21, 0xE1, 0x23, 0xE1, 0x40,
+0xE0, 0x24, 0xE3, 0x91, 0xE0, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0x40, 0xE0, 0x40, 0xD0, 0xE4, 0x21,
+0xE1, 0x91, 0xE1, 0x25, 0xE0, 0xD0, 0x40, 0xE3, 0x21, 0xE2, 0x20, 0xD0, 0x40, 0xE1, 0x21, 0xE1,
+0x21, 0xE0, 0x20, 0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE3, 0x23,
+0xE1, 0xD0, 0xE0, 0x90, 0x41, 0xD0, 0xE0, 0x21, 0xE3, 0x21, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0x20,
+0xE2, 0x22, 0xE1, 0x22, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE1, 0x23,
+0xE0, 0xD0, 0xE0, 0x91, 0xD0, 0xE0, 0x23, 0xE3, 0x22, 0xE1, 0x20, 0xE1, 0xD0, 0x90, 0xA0, 0x00,
+0xC0, 0x60, 0x10, 0x30, 0x02, 0xF0, 0x70, 0x01, 0x50, 0x30, 0x0F, 0x22, 0x0F, 0x1C, 0xC0, 0x60,
+0xC0, 0x00, 0x71, 0x00, 0x80, 0xF0, 0x80, 0x00, 0xF0, 0x02, 0xA0, 0x60, 0xD1, 0xE1, 0x25, 0xE1,
+0x21, 0xE2, 0xD0, 0x40, 0x90, 0xD0, 0x22, 0xE0, 0x22, 0xE0, 0x23, 0xE5, 0x90, 0x40, 0xD0, 0xE0,
+0x21, 0xE1, 0x21, 0xE2, 0x22, 0xE1, 0xD0, 0x40, 0xE1, 0x20, 0xE2, 0x20, 0xE2, 0x22, 0xE0, 0xD0,
+0x91, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0x21, 0xE1, 0x22, 0xE0, 0x40, 0xE1, 0x21, 0xE2, 0x21, 0xE3,
+0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x91, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x91,
+0xE0, 0x24, 0xE3, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0x40, 0xD0,
+0xE3, 0x22, 0xE1, 0x91, 0xD0, 0x22, 0xE0, 0x21, 0xE1, 0xD0, 0x90, 0xE1, 0x20, 0xE0, 0x21, 0xE0,
+0x21, 0xE1, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE3, 0x40, 0xE1, 0x22, 0xE1, 0x21, 0xE3, 0x40,
+0xD0, 0xE1, 0x23, 0xE0, 0xD0, 0x90, 0x40, 0x90, 0xD0, 0x91, 0x21, 0xE1, 0x24, 0xE2, 0x20, 0xE1,
+0x40, 0xD0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x23, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x22,
+0xE0, 0x22, 0xE1, 0x22, 0xE1, 0x20, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x21, 0xE2, 0x25, 0xE2,
+0xD0, 0x90, 0xF0, 0x30, 0x02, 0xF0, 0x00, 0x80, 0xA0, 0xC0, 0x70, 0xF0, 0x50, 0x00, 0x70, 0xA0,
+0x0F, 0x22, 0x0F, 0x1D, 0x70, 0xF0, 0xC0, 0x04, 0xA0, 0x70, 0xC0, 0xA0, 0x00, 0xA0, 0x70, 0xC0,
+0x60, 0xD1, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE1,
+0x20, 0xE0, 0x22, 0xE2, 0x22, 0xE1, 0x20, 0xE1, 0x20, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1,
+0x22, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x40, 0x90, 0xE0, 0x27, 0xE0, 0x21, 0xE1, 0x90, 0x40, 0xD0,
+0xE1, 0xD0, 0x90, 0x40, 0x90, 0xE2, 0x21, 0xE0, 0x91, 0xE0, 0x25, 0xE1, 0x20, 0xE0, 0xD0, 0x40,
+0x20, 0xE0, 0x25, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x24, 0xE0, 0x20, 0xE1, 0x90, 0xE1, 0x24,
+0xE3, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x21, 0xE2, 0x40, 0xD0, 0xE3, 0x23, 0xE1, 0x90, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE3, 0x91, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE2, 0x90, 0xD0, 0xE0, 0x21, 0xE1,
+0x20, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0x22, 0xE1, 0x24, 0xD0, 0x40, 0xE5, 0xD0, 0x90, 0x40, 0x90,
+0xD0, 0xE1, 0xD0, 0x40, 0x21, 0xE2, 0x24, 0xE2, 0x20, 0xD0, 0x91, 0xE2, 0x20, 0xE1, 0x20, 0xE0,
+0x20, 0xE0, 0x23, 0xE2, 0x40, 0xE3, 0x24, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0xD0, 0x90,
+0x40, 0xD0, 0x20, 0xE1, 0x28, 0xE0, 0xD0, 0xE0, 0x60, 0x00, 0x50, 0x30, 0x00, 0xA0, 0x00, 0x81,
+0x50, 0x60, 0x01, 0xA0, 0xF0, 0x60, 0xC0, 0x0F, 0x22, 0x0F, 0x1E, 0x70, 0x51, 0xC0, 0x00, 0x30,
+0xC0, 0xA0, 0x50, 0x00, 0x50, 0x10, 0xC0, 0x01, 0x70, 0x60, 0xD1, 0xE0, 0x20, 0xE1, 0x24, 0xE0,
+0xD1, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE1, 0x24, 0xE4, 0x21, 0xE2, 0x40, 0xD0, 0xE1, 0x20, 0xE0,
+0x21, 0xE2, 0x21, 0xE1, 0x21, 0xE0, 0x91, 0xD0, 0x24, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0xD0, 0x40, 0xE6, 0x90, 0x40, 0x90, 0xD0, 0xE1, 0xD0, 0x40, 0x20, 0xE4, 0x24, 0xE1, 0x40, 0xD0,
+0x21, 0xE0, 0x24, 0xE0, 0x21, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE4, 0x40, 0xE1, 0x24, 0xE3,
+0x40, 0xD0, 0xE1, 0x21, 0xE2, 0x22, 0x40, 0xD0, 0xE3, 0x22, 0xE1, 0x20, 0x40, 0xD0, 0xE0, 0x21,
+0xE0, 0x20, 0xE4, 0x90, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0xE1, 0x21, 0xE0,
+0x21, 0xE4, 0x40, 0xE0, 0x24, 0xE1, 0x21, 0xE2, 0x40, 0xD0, 0xE2, 0x90, 0x40, 0x90, 0xE0, 0xD0,
+0xE1, 0x20, 0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x25, 0xE2, 0xD0, 0x40, 0xE2, 0x21, 0xE1,
+0x20, 0xE1, 0x25, 0xE1, 0x40, 0xE2, 0x28, 0xE0, 0x21, 0xE0, 0x20, 0xE2, 0x90, 0x40, 0xD0, 0xE1,
+0x28, 0xD1, 0xF0, 0xC0, 0x01, 0x70, 0x10, 0x70, 0x00, 0x60, 0xC0, 0x00, 0x10, 0xF1, 0x0F, 0x26,
+0x0F, 0x20, 0xF0, 0xC0, 0x00, 0x30, 0xF0, 0x80, 0x02, 0x81, 0x01, 0x30, 0x80, 0xA0, 0xD1, 0xE0,
+0x20, 0xE0, 0x24, 0xD0, 0xE0, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x21,
+0xE3, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0x23, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x40, 0xE1,
+0x23, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE1, 0x23, 0xE1, 0x90, 0x40, 0x90,
+0xD0, 0xE0, 0x40, 0xE0, 0x20, 0xE0, 0x20, 0xE2, 0x22, 0xE1, 0x91, 0xE0, 0x20, 0xE2, 0x23, 0xE1,
+0x20, 0x90, 0xE1, 0x24, 0xE3, 0x40, 0xE1, 0x25, 0xE2, 0x40, 0xD0, 0xE1, 0x21, 0xE3, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x22, 0xE1, 0x20, 0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE3, 0x20,
+0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0x22, 0xE0, 0x20, 0xE1,
+0x20, 0xE1, 0xD0, 0x40, 0xE1, 0x23, 0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x90, 0x40, 0x90, 0xE1,
+0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xE2, 0x26, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE0,
+0x20, 0xE6, 0x23, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x26, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0xD0, 0x91, 0xE2, 0x26, 0xE0, 0xD0, 0xA0, 0x81, 0x01, 0x80, 0x50, 0x01, 0x50,
+0x70, 0xC0, 0x50, 0x00, 0x81, 0x0F, 0x25, 0x0F, 0x20, 0xA0, 0x70, 0x00, 0x30, 0x50, 0x00, 0x80,
+0x60, 0x30, 0x00, 0x80, 0x50, 0xA0, 0x70, 0x00, 0x80, 0xB0, 0xD0, 0xE0, 0x25, 0xE1, 0x40, 0x90,
+0xE2, 0x22, 0xE5, 0x21, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0x90, 0xD0, 0x22, 0xE1, 0x20,
+0xE0, 0x21, 0xE6, 0x40, 0xE1, 0x23, 0xE3, 0x22, 0xE1, 0xD0, 0x40, 0xE4, 0x22, 0xE1, 0xD0, 0xE0,
+0x90, 0x41, 0xD1, 0xE0, 0x21, 0xE2, 0x22, 0xE1, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0,
+0x41, 0xD0, 0x90, 0x27, 0xE3, 0x40, 0xD0, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE3, 0x21, 0xE1, 0x21, 0x40, 0xD0, 0xE0,
+0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE3, 0x20, 0xE2, 0x91, 0xE0, 0x25,
+0xE0, 0x21, 0xE1, 0x90, 0xD0, 0xE1, 0x23, 0xE0, 0x21, 0xD1, 0x90, 0x41, 0x90, 0xE3, 0x22, 0xE1,
+0x20, 0xE1, 0x40, 0xE2, 0x20, 0xE0, 0x23, 0xE0, 0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE2, 0x21, 0xE0,
+0x21, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x90, 0x40, 0xD0, 0x23, 0xE0, 0x25, 0xE1, 0x23, 0xE0, 0xD0,
+0x91, 0xD1, 0xE0, 0x23, 0xE1, 0xD0, 0x30, 0x50, 0x00, 0x50, 0x30, 0x81, 0xC0, 0xF0, 0xC0, 0x04,
+0x50, 0x80, 0x0F, 0x25, 0x0F, 0x20, 0xC0, 0x60, 0x10, 0xA0, 0x00, 0xF0, 0x30, 0x00, 0x81, 0x00,
+0xA0, 0x50, 0x02, 0xF0, 0xB0, 0xD0, 0x23, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE2, 0x22, 0xE3, 0x21,
+0xE0, 0x21, 0xE3, 0x91, 0xE1, 0x23, 0xE0, 0x20, 0xE2, 0x21, 0xE3, 0x90, 0x40, 0xE1, 0x23, 0xE3,
+0x22, 0xE0, 0xD0, 0x91, 0xD0, 0xE4, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0xE0, 0x41, 0x90, 0xD0, 0xE4,
+0x20, 0xE2, 0xD0, 0x40, 0xD0, 0xE1, 0x21, 0xE1, 0x20, 0xE3, 0x40, 0xE0, 0x20, 0xE1, 0x23, 0xE3,
+0x40, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE3, 0x40, 0xD0, 0xE4, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x25,
+0xE0, 0x40, 0xE1, 0x20, 0xE1, 0x23, 0xE2, 0x40, 0xE0, 0x20, 0xE1, 0x21, 0xE1, 0x22, 0xE0, 0x40,
+0xE4, 0x21, 0xE1, 0xD0, 0xE0, 0x90, 0x41, 0xD1, 0xE1, 0x25, 0xE2, 0xD0, 0x91, 0xD0, 0x21, 0xE1,
+0x21, 0xE1, 0x24, 0xD0, 0x40, 0xE2, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE1, 0x22, 0xE2, 0x91, 0xE1,
+0x22, 0xE0, 0x22, 0xE3, 0x24, 0xE0, 0xD0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE0, 0xD0, 0xA1, 0x02,
+0x31, 0x01, 0x60, 0x10, 0x50, 0x01, 0x30, 0xF0, 0x60, 0x0F, 0x26, 0x0F, 0x24, 0x10, 0x70, 0x01,
+0x50, 0x30, 0x01, 0xA0, 0x70, 0x00, 0xA0, 0xC0, 0x30, 0xB0, 0xD0, 0xE0, 0x20, 0xE2, 0x40, 0x90,
+0xE2, 0x25, 0xE1, 0x23, 0xE0, 0x21, 0xE0, 0xD0, 0x91, 0xE1, 0x23, 0xE3, 0x20, 0xE0, 0x21, 0xE3,
+0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x21, 0xE1, 0x21, 0xE3, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE0, 0xD0,
+0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0x90, 0xA0, 0x40, 0x90, 0xD1, 0x23, 0xD0, 0x91,
+0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x40, 0xE2, 0x25, 0xE0, 0xD0, 0x91, 0xE0, 0x21, 0xE2,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0x40, 0xE3, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x27, 0xE0, 0x40, 0xD0, 0xE0, 0x25, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x26, 0xE1, 0xD0, 0x40, 0xE3,
+0x25, 0xE0, 0xD0, 0x91, 0xE0, 0x20, 0xE1, 0x20, 0xD1, 0xE0, 0x41, 0x90, 0xD0, 0x91, 0xE4, 0x24,
+0xE3, 0x40, 0xE0, 0x21, 0xE1, 0x21, 0xE1, 0x23, 0xE1, 0xD0, 0x40, 0xE3, 0x21, 0xE0, 0x20, 0xE1,
+0x21, 0xE5, 0x40, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0x24, 0xE0, 0x20, 0xE1, 0x90, 0x40,
+0xD0, 0xE0, 0x22, 0xD0, 0x30, 0x51, 0xA0, 0x00, 0x50, 0x30, 0x01, 0xC0, 0x30, 0x00, 0xF0, 0x30,
+0x01, 0xC0, 0x0F, 0x27, 0x0F, 0x23, 0x81, 0x01, 0xC0, 0xF0, 0xC0, 0x80, 0x30, 0x00, 0x30, 0xA0,
+0x70, 0x01, 0x30, 0xB0, 0xD0, 0xE2, 0x40, 0x90, 0xE0, 0x22, 0xE3, 0x25, 0xE0, 0x20, 0xE1, 0x20,
+0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE4, 0x24, 0xE0, 0xD0, 0x40, 0xE0, 0x20, 0xE1, 0x20, 0xE1,
+0x25, 0xE1, 0xD0, 0x40, 0x90, 0xE1, 0x20, 0xE2, 0xD1, 0x60, 0xB0, 0x90, 0x21, 0xE0, 0x40, 0xD0,
+0xE0, 0xD0, 0xB0, 0xA0, 0x40, 0x91, 0xE0, 0xD0, 0xE1, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x23, 0xE0,
+0x22, 0xE0, 0x91, 0xD0, 0xE0, 0x21, 0xE0, 0x24, 0xD0, 0x40, 0x20, 0xE0, 0x21, 0xE2, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0x90, 0xE2, 0x21, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x22, 0xE1,
+0x40, 0xD0, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xE0, 0x26, 0xE1, 0xD0,
+0x90, 0xE4, 0x20, 0xE0, 0x21, 0xE3, 0x40, 0xD0, 0xE1, 0xD0, 0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD1,
+0xE0, 0xD0, 0x40, 0xE4, 0x24, 0xE1, 0x20, 0xE0, 0x91, 0xD0, 0x20, 0xE1, 0x21, 0xE1, 0x21, 0xE1,
+0x20, 0xE0, 0xD0, 0xE0, 0x40, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x24, 0xE3, 0x20, 0xE1, 0x40, 0xE1,
+0x21, 0xE0, 0x22, 0xE2, 0x23, 0xE0, 0x22, 0xE1, 0x91, 0xE2, 0xD0, 0xB0, 0x80, 0x01, 0x70, 0xA0,
+0x30, 0x06, 0xA1, 0x0F, 0x29, 0x0F, 0x23, 0x81, 0x00, 0x50, 0x10, 0x71, 0x80, 0x70, 0x50, 0x00,
+0xA0, 0x02, 0x30, 0xA0, 0x40, 0xD1, 0x40, 0x90, 0xD0, 0x20, 0xE0, 0x22, 0xE3, 0x24, 0xE0, 0x22,
+0xE1, 0x40, 0xE0, 0xD0, 0xE0, 0x23, 0xE3, 0x25, 0xD0, 0x91, 0xD0, 0xE0, 0x21, 0xE3, 0x25, 0xE0,
+0x90, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0xD0, 0x90, 0xD0, 0x41, 0x90, 0x20, 0xE0, 0x91, 0xE3, 0xD1,
+0xE0, 0x90, 0x40, 0x90, 0xE0, 0xD0, 0xE0, 0x40, 0xD1, 0x22, 0xE2, 0x20, 0xE0, 0x20, 0xE0, 0x90,
+0xEA, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x22, 0xE1, 0x90, 0xD0, 0xE0, 0x23, 0xE4, 0x40,
+0xD0, 0xE6, 0x20, 0xE1, 0x40, 0xE2, 0x20, 0xE3, 0x21, 0xE1, 0x40, 0xE1, 0x24, 0xE3, 0x91, 0xD0,
+0xE2, 0x21, 0xE0, 0x21, 0xE1, 0xD0, 0x40, 0xE0, 0xD0, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0xE1, 0x20,
+0xE1, 0x91, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0xE3, 0x21, 0xE0,
+0x22, 0xE2, 0x21, 0xD0, 0x91, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x23, 0xE1, 0x23, 0xE1, 0x40, 0xE1,
+0x20, 0xE0, 0x20, 0xE1, 0x22, 0xE2, 0x22, 0xE1, 0x20, 0xE1, 0x90, 0x40, 0xD1, 0xB0, 0xA0, 0x80,
+0x01, 0xC0, 0xA0, 0x08, 0x80, 0x0F, 0x29, 0x0F, 0x24, 0xA0, 0xF0, 0xA0, 0xC0, 0x01, 0x80, 0x30,
+0x01, 0xC0, 0x60, 0x00, 0xA0, 0x70, 0x00, 0xA0, 0x40, 0x91, 0xD0, 0xE0, 0x20, 0xE1, 0x22, 0xE2,
+0x28, 0xE0, 0x40, 0xE0, 0xD0, 0x24, 0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x21, 0xE2, 0x40, 0xE2, 0x21,
+0xE3, 0x25, 0xE0, 0x40, 0xE2, 0x21, 0xE0, 0xD0, 0xE0, 0xF0, 0xA0, 0xD2, 0xE1, 0x40, 0xE1, 0x20,
+0xE0, 0x21, 0xE2, 0xD0, 0x90, 0x42, 0xE0, 0xD0, 0xE3, 0x20, 0xE3, 0x20, 0xE0, 0x40, 0xD0, 0xE7,
+0x20, 0xE1, 0x40, 0xD0, 0x20, 0xE1, 0x24, 0xE1, 0x91, 0xD0, 0xE0, 0x25, 0xE2, 0x40, 0xD0, 0xE0,
+0x20, 0xE4, 0x20, 0xE1, 0x40, 0xE4, 0x20, 0xE0, 0x21, 0xE1, 0xD0, 0x40, 0xE1, 0x23, 0xE5, 0x40,
+0xE0, 0xD0, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0xD2, 0x90, 0x42, 0xE0, 0xD1, 0xE1, 0x20, 0xE0, 0x20,
+0xE1, 0xD0, 0x40, 0xE1, 0x22, 0xE5, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x23, 0xE2, 0x22,
+0xD0, 0x40, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x22, 0xE0, 0x23, 0xE2, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x23, 0xE3, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xD0, 0x91, 0xB0, 0x30, 0x00, 0x80, 0x30, 0x00,
+0x60, 0x0F, 0x34, 0x0F, 0x30, 0x10, 0x70, 0x02, 0x10, 0xB0, 0xD1, 0x20, 0xE0, 0x21, 0xE1, 0x20,
+0xE1, 0x27, 0xE1, 0x40, 0xE2, 0x23, 0xE4, 0x24, 0xE1, 0x40, 0xD0, 0xE1, 0x20, 0xE2, 0x21, 0xE0,
+0x24, 0xE0, 0x91, 0xD0, 0xE0, 0x21, 0xE1, 0xA0, 0x10, 0xB0, 0xD2, 0x40, 0xD0, 0x40, 0x90, 0xD0,
+0xE0, 0x20, 0xE3, 0x21, 0xE0, 0xD0, 0xE0, 0xD0, 0x42, 0x90, 0xE0, 0xD0, 0xE1, 0x21, 0xE3, 0x90,
+0xD0, 0xE6, 0x21, 0xE1, 0x90, 0xE0, 0x20, 0xE2, 0x23, 0xE1, 0x91, 0xE1, 0x25, 0xE0, 0x20, 0xE0,
+0x40, 0xD0, 0xE0, 0x27, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE2,
+0x24, 0xE0, 0x20, 0xE1, 0x40, 0xE0, 0xD0, 0xE1, 0x20, 0xE2, 0xD0, 0xE0, 0x90, 0x42, 0xD1, 0x20,
+0xE1, 0x20, 0xE1, 0x20, 0xE1, 0x20, 0xD0, 0x91, 0xE0, 0x23, 0xE4, 0x20, 0xE0, 0x20, 0xE0, 0x91,
+0xE3, 0x23, 0xE0, 0x21, 0xE4, 0x40, 0xD1, 0xE1, 0x23, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x21, 0xD0,
+0x90, 0x40, 0xD0, 0xE0, 0x27, 0xE3, 0x24, 0xE0, 0xD0, 0xA0, 0x60, 0x02, 0x80, 0x10, 0x0F, 0x35,
+0x0F, 0x30, 0xC0, 0xA0, 0x01, 0xA0, 0x70, 0xB1, 0xD1, 0x21, 0xE1, 0x29, 0xE2, 0x40, 0x90, 0xE1,
+0x26, 0xE0, 0x23, 0xE0, 0x20, 0xE1, 0x91, 0xE0, 0x21, 0xE3, 0x25, 0xE1, 0xD0, 0x40, 0xE2, 0x22,
+0x40, 0xA0, 0xB0, 0x90, 0xD0, 0x90, 0xA0, 0xF0, 0x10, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE6,
+0x90, 0x40, 0xD0, 0xE0, 0x90, 0x40, 0x91, 0x20, 0xE2, 0xD1, 0x91, 0xD0, 0xE0, 0x22, 0xE3, 0x20,
+0xE0, 0x91, 0xE0, 0x20, 0xE3, 0x21, 0xE2, 0x91, 0xE1, 0x25, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0,
+0x24, 0xE0, 0x21, 0xE0, 0x91, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xD0, 0x40,
+0xE6, 0x23, 0xE0, 0x91, 0xE4, 0x20, 0x90, 0x41, 0x90, 0xE0, 0xD0, 0x40, 0xE0, 0x28, 0xE0, 0x20,
+0xE1, 0x40, 0xE1, 0x23, 0xE2, 0x20, 0xE0, 0x21, 0xE1, 0x40, 0xE2, 0x25, 0xE1, 0x20, 0xE0, 0x21,
+0xE0, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x23, 0xE1, 0x21, 0xE1, 0xD0, 0x91, 0xD0, 0xE0,
+0x26, 0xE3, 0x23, 0xE0, 0xD0, 0x30, 0x80, 0x50, 0x30, 0x00, 0xC0, 0x30, 0x0F, 0x36, 0x0F, 0x31,
+0xC0, 0xA0, 0x30, 0x70, 0x01, 0x30, 0xB0, 0xD0, 0xE2, 0x20, 0xE0, 0x23, 0xE0, 0x21, 0xE2, 0xD0,
+0x91, 0xD0, 0x26, 0xE1, 0x24, 0xE2, 0x90, 0x40, 0xE1, 0x23, 0xE2, 0x22, 0xE2, 0xD0, 0x40, 0x90,
+0xE2, 0x22, 0xD0, 0x90, 0xD0, 0x40, 0xA0, 0xF1, 0x10, 0xA0, 0xD1, 0xE0, 0x20, 0xE0, 0x23, 0xE0,
+0x20, 0xE2, 0x40, 0x21, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0xE0, 0xD1, 0x40, 0xE1, 0x25, 0xE0,
+0x22, 0x91, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0xE3, 0x20, 0xE1, 0x20, 0xE0,
+0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xD0, 0x21, 0xE1, 0x23,
+0xE1, 0x91, 0xE7, 0x21, 0xE0, 0x91, 0xD0, 0xE1, 0x90, 0x40, 0x91, 0x20, 0xE4, 0x90, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x91, 0xD0, 0xE2, 0x24, 0xE1, 0x20, 0xE1,
+0x91, 0xD0, 0xE0, 0x20, 0xE0, 0x24, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x2A, 0xE1,
+0x20, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0x25, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0xD0, 0xB1, 0x01,
+0x50, 0x30, 0xA0, 0xC0, 0x0F, 0x36, 0x0F, 0x32, 0xC0, 0x60, 0x02, 0x30, 0xA0, 0x40, 0xD0, 0xE1,
+0x24, 0xE0, 0x21, 0xE1, 0x20, 0xD0, 0x90, 0x40, 0xD0, 0x25, 0xE2, 0x24, 0xE3, 0x40, 0xE2, 0x23,
+0xE2, 0x22, 0xE0, 0xD0, 0xE1, 0x40, 0xE0, 0xD0, 0x21, 0xE0, 0x22, 0xD0, 0xA0, 0x60, 0xF0, 0x50,
+0xF0, 0x10, 0xA0, 0x40, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0x40, 0xE0, 0x21,
+0xE2, 0xD1, 0xE0, 0x90, 0x41, 0x90, 0x40, 0xE0, 0xD0, 0xE1, 0x21, 0xE2, 0x21, 0xE0, 0x90, 0xE1,
+0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xE2, 0x24, 0xE3, 0x40, 0xD0, 0xE0,
+0x21, 0xE0, 0x20, 0xE5, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE1, 0x21, 0xE2, 0x91, 0xD0, 0xE6, 0xD0,
+0xE0, 0xD1, 0x43, 0x90, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0xD0, 0xE0, 0x20, 0xE2, 0x25,
+0xE0, 0x20, 0x40, 0xD0, 0xE1, 0x26, 0xE0, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x26, 0xE2, 0x21, 0xE2,
+0x40, 0xD0, 0xE1, 0x28, 0xE2, 0x21, 0xE0, 0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x24, 0xE2, 0x22, 0xE0,
+0xD0, 0xB0, 0xA0, 0x80, 0x02, 0xF0, 0x0F, 0x38, 0x0F, 0x34, 0x60, 0x00, 0x30, 0x70, 0x00, 0x30,
+0xB0, 0xD0, 0xE0, 0x22, 0xE0, 0x24, 0xE0, 0xD0, 0xE0, 0x40, 0xD0, 0xE2, 0x22, 0xE3, 0x23, 0xE0,
+0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x24, 0xE1, 0x20, 0xE0, 0x21, 0xE2, 0x40, 0xE3, 0x23, 0xE0, 0xD0,
+0xF0, 0x11, 0x70, 0x60, 0x41, 0xE1, 0x21, 0xE1, 0x21, 0xE4, 0x91, 0xE3, 0x21, 0xE4, 0xD0, 0x90,
+0x42, 0x91, 0xE0, 0xD1, 0xE1, 0xD0, 0xE1, 0x40, 0xE1, 0x22, 0xE0, 0x21, 0xE2, 0xD0, 0x40, 0xE1,
+0x23, 0xE1, 0x21, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE4, 0x21, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE1,
+0x21, 0xE3, 0x40, 0xD0, 0xE3, 0xD1, 0xE0, 0x90, 0x43, 0x20, 0xE4, 0x22, 0xE0, 0xD2, 0x90, 0xE2,
+0x21, 0xE0, 0x21, 0xE2, 0x21, 0xE0, 0x40, 0x90, 0xE0, 0x20, 0xE1, 0x24, 0xE4, 0x91, 0xE0, 0x20,
+0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x21, 0xE3, 0x91, 0xD0, 0xE0, 0x27, 0xE2, 0x23, 0xE0, 0xD0, 0x40,
+0xE2, 0x28, 0xD1, 0xA0, 0x80, 0x00, 0x50, 0x80, 0xC0, 0x60, 0x0F, 0x39, 0x0F, 0x35, 0xF0, 0x50,
+0x02, 0x60, 0x30, 0xD0, 0xE3, 0x23, 0xE2, 0x40, 0xE3, 0x23, 0xE3, 0x24, 0xE0, 0xD0, 0x91, 0xD0,
+0xE0, 0x22, 0xE1, 0x22, 0xE0, 0x21, 0xE2, 0x90, 0x40, 0xD0, 0x21, 0xE1, 0x20, 0xE0, 0x20, 0xE1,
+0xD0, 0x60, 0x30, 0x80, 0x30, 0x41, 0xD0, 0xE0, 0x22, 0xE1, 0x20, 0xE3, 0xD0, 0x40, 0xE4, 0x26,
+0xE0, 0x90, 0xE0, 0xD0, 0xE0, 0x91, 0x41, 0x92, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE3, 0x24, 0xE0,
+0xD0, 0x40, 0xE1, 0x26, 0xE2, 0x40, 0xD0, 0xE0, 0x24, 0xE3, 0xD0, 0x40, 0xE0, 0x22, 0xE6, 0xD0,
+0x40, 0xD0, 0xE0, 0x20, 0x92, 0x41, 0x90, 0xE1, 0xD0, 0x91, 0xE0, 0x21, 0xE2, 0xD1, 0x90, 0xB3,
+0x40, 0xD0, 0xE0, 0x20, 0xD0, 0xE3, 0x20, 0xE1, 0x21, 0xE0, 0x40, 0xE0, 0x20, 0xE1, 0x23, 0xE0,
+0x20, 0xE0, 0xD0, 0x21, 0xD0, 0x40, 0xE2, 0x20, 0xE0, 0x26, 0xE1, 0x21, 0xD0, 0x91, 0xD0, 0xE0,
+0x26, 0xE2, 0x24, 0xE0, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE2, 0x20, 0xE0, 0xD0, 0xA1, 0x02, 0x30,
+0x60, 0x0F, 0x3A, 0x0F, 0x35, 0xC0, 0xA0, 0x01, 0x30, 0x51, 0xA0, 0xD0, 0xE4, 0x22, 0xE0, 0x40,
+0xE3, 0x20, 0xE0, 0x22, 0xE3, 0x22, 0xE0, 0x20, 0xD0, 0xE0, 0x40, 0xD0, 0xE0, 0x23, 0xE1, 0x23,
+0xE4, 0x40, 0xE0, 0x20, 0xE4, 0x20, 0xE1, 0xD0, 0xB1, 0x10, 0xC0, 0xF0, 0xB1, 0xD1, 0xE0, 0x25,
+0xE3, 0x40, 0xD0, 0xE2, 0x26, 0xE1, 0x40, 0xD1, 0xE4, 0x20, 0x91, 0x43, 0xE3, 0xD0, 0xE1, 0x20,
+0xE3, 0x40, 0xE1, 0x20, 0xE1, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE0, 0x22, 0xE0,
+0x23, 0xE0, 0xD0, 0x40, 0xE0, 0x21, 0xE8, 0x40, 0x90, 0x41, 0x91, 0x21, 0xE2, 0xD0, 0xE1, 0x40,
+0xD3, 0xE0, 0xD0, 0x90, 0x60, 0x30, 0x50, 0x71, 0x40, 0xB0, 0xE1, 0x23, 0xE0, 0x20, 0xE3, 0x20,
+0xD0, 0x40, 0xE4, 0x21, 0xE0, 0x20, 0xE0, 0x20, 0xE3, 0x91, 0xD0, 0x20, 0xE1, 0x20, 0xE0, 0x22,
+0xE2, 0x20, 0xE3, 0x40, 0xE2, 0x27, 0xE1, 0x22, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0x20, 0xE3, 0x21,
+0xD0, 0xE0, 0xA0, 0x70, 0x81, 0x00, 0xC0, 0xA0, 0x0F, 0x3B, 0x0F, 0x36, 0xC0, 0x60, 0x30, 0x50,
+0x01, 0x50, 0xA0, 0xD1, 0xE0, 0x21, 0xE2, 0x91, 0xE0, 0x23, 0xE0, 0x22, 0xE2, 0x24, 0xD0, 0xE0,
+0x40, 0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x23, 0xE0, 0xD0, 0xE0, 0xD0, 0x91, 0xD0, 0x21, 0xE0, 0x21,
+0xE3, 0xD0, 0x40, 0xF1, 0xC0, 0x30, 0x10, 0xF0, 0xD0, 0xE0, 0x23, 0xE1, 0x21, 0xE1, 0x91, 0xD0,
+0xE1, 0x27, 0xE1, 0x40, 0xD0, 0xE0, 0x22, 0xE4, 0xD1, 0x92, 0x43, 0x92, 0x20, 0xE0, 0xD0, 0xE0,
+0x90, 0xD0, 0xEA, 0x40, 0xD0, 0xE9, 0xD0, 0x40, 0xD0, 0xE0, 0x21, 0x91, 0x44, 0x90, 0x40, 0x90,
+0xD2, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0xD2, 0x40, 0xD0, 0xE0, 0xB0, 0xD0, 0x12, 0x04, 0x70, 0xF0,
+0x90, 0xD3, 0xE6, 0x20, 0xE1, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0xD0, 0xE1,
+0xD0, 0x40, 0x90, 0xD0, 0x20, 0xE3, 0x21, 0xE1, 0x22, 0xE0, 0x20, 0xE1, 0x40, 0xD0, 0xE1, 0x22,
+0xE0, 0x24, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0x20, 0xD0, 0xE2, 0xD1, 0x60, 0x70,
+0x01, 0x80, 0x30, 0xA0, 0x0F, 0x3C, 0x0F, 0x38, 0x60, 0xC0, 0x01, 0xA0, 0x80, 0xA0, 0xE1, 0x20,
+0xE1, 0xD0, 0x91, 0xE1, 0x24, 0xE0, 0x28, 0xE0, 0xD0, 0x91, 0xD0, 0xE0, 0x22, 0xE2, 0x25, 0xE0,
+0xD0, 0xE0, 0x40, 0xE1, 0xD0, 0x23, 0xE2, 0x20, 0xE1, 0x30, 0xF0, 0xC0, 0xA0, 0xF0, 0xE0, 0xD0,
+0x21, 0xE1, 0x20, 0xE1, 0x21, 0xE1, 0x40, 0xE2, 0x22, 0xE5, 0xD0, 0x91, 0xE1, 0x22, 0xE6, 0x90,
+0xE1, 0xD1, 0x20, 0xE1, 0x91, 0x45, 0x9A, 0x40, 0x98, 0x41, 0x90, 0xB0, 0x42, 0x92, 0xE1, 0xD1,
+0xE1, 0x91, 0xD3, 0x21, 0xE0, 0xD2, 0x40, 0xB0, 0x30, 0xA1, 0x61, 0xA0, 0x07, 0x70, 0xA1, 0x30,
+0x41, 0xD2, 0xE4, 0x20, 0xD0, 0x40, 0x90, 0xD0, 0x24, 0xE0, 0xD0, 0x20, 0xE0, 0xD0, 0x90, 0xE2,
+0x40, 0xD0, 0xE1, 0x20, 0xE2, 0x24, 0xE0, 0x22, 0xE0, 0x91, 0xD0, 0xE2, 0x27, 0xE1, 0x22, 0xE0,
+0xD0, 0x40, 0x90, 0xD0, 0x20, 0xE1, 0xD0, 0xE0, 0x60, 0x81, 0x01, 0x50, 0xA0, 0x0F, 0x3D, 0x0F,
+0x39, 0xA0, 0x70, 0x80, 0x50, 0x00, 0xC0, 0xA0, 0xE0, 0xD0, 0xE0, 0xD0, 0x91, 0xE0, 0x27, 0xE1,
+0x21, 0xE2, 0x20, 0xE0, 0xD0, 0x91, 0xD0, 0xE1, 0x22, 0xE2, 0x24, 0xE1, 0xD0, 0x91, 0xE3, 0x21,
+0xE1, 0x22, 0xE0, 0xD0, 0x60, 0x10, 0xB0, 0x80, 0x60, 0xD0, 0xE1, 0x20, 0xE3, 0x20, 0xE0, 0x20,
+0xE1, 0x40, 0xE0, 0x23, 0xE3, 0x20, 0xE1, 0xD0, 0x90, 0xE1, 0x21, 0xE3, 0x22, 0xE1, 0x40, 0x20,
+0xE1, 0x22, 0xD0, 0xE0, 0xD0, 0xE0, 0xD1, 0x91, 0xE3, 0x97, 0x40, 0x97, 0xE2, 0xD0, 0x40, 0xD3,
+0xE0, 0xD0, 0xE4, 0xD0, 0x91, 0xB0, 0x60, 0xB0, 0xD2, 0xE0, 0x40, 0x30, 0xA0, 0x80, 0x72, 0x0C,
+0x50, 0xC0, 0x50, 0x81, 0xA0, 0xB1, 0x40, 0x90, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x90, 0x40, 0xD6,
+0x40, 0x91, 0xF0, 0xB0, 0xD1, 0x90, 0xB0, 0x90, 0xD0, 0xE2, 0xD0, 0xE1, 0x23, 0xE1, 0x22, 0xE0,
+0x40, 0xE4, 0x24, 0xE2, 0x23, 0xE1, 0xD0, 0x40, 0x90, 0xD0, 0xE0, 0xD0, 0x90, 0xA0, 0x01, 0x81,
+0x50, 0x30, 0x00, 0xC0, 0x0F, 0x3C, 0x0F, 0x3A, 0x31, 0x02, 0xA0, 0x60, 0x90, 0xD0, 0xE0, 0x40,
+0xD0, 0x27, 0xE0, 0x20, 0xE7, 0xD0, 0x40, 0xE2, 0x23, 0xE1, 0x24, 0xE0, 0x20, 0xE1, 0x40, 0xD0,
+0xE0, 0x20, 0xE1, 0x21, 0xE0, 0x24, 0xE0, 0x90, 0xF0, 0xA0, 0xF1, 0x80, 0xD1, 0xE1, 0x20, 0xE0,
+0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x24, 0xE1, 0x20, 0xE2, 0xD0, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x24,
+0xE0, 0xD0, 0x40, 0xE0, 0x22, 0xE7, 0x91, 0xD0, 0xE2, 0xD1, 0xE2, 0xD1, 0xE0, 0x40, 0xD4, 0xE0,
+0xD5, 0x40, 0xD9, 0x91, 0x40, 0x31, 0x00, 0xA2, 0x70, 0x60, 0x80, 0xC0, 0x03, 0x50, 0x0C, 0xC0,
+0x70, 0x04, 0x90, 0xF0, 0x90, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0x90, 0xD0, 0xB0, 0x61, 0xA0, 0x30,
+0x10, 0xF0, 0xA0, 0x10, 0x30, 0xA0, 0x90, 0xD1, 0x41, 0xD1, 0x90, 0xF0, 0x40, 0xA0, 0xB0, 0xD0,
+0x21, 0xE1, 0x22, 0xE1, 0x40, 0xE4, 0x23, 0xE3, 0x22, 0xE2, 0x20, 0x40, 0xE0, 0xD0, 0x40, 0x60,
+0x30, 0x02, 0xA0, 0x80, 0x00, 0x80, 0x30, 0x50, 0x0F, 0x3B, 0x0F, 0x3B, 0x81, 0x00, 0x30, 0x50,
+0x00, 0xA0, 0x41, 0xE2, 0x21, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0x20, 0xE3, 0xD0, 0x40, 0xE0, 0xD0,
+0xE0, 0x27, 0xE1, 0x22, 0xE1, 0x40, 0xE2, 0x20, 0xE2, 0x26, 0xE0, 0xD0, 0x41, 0x80, 0x60, 0xF1,
+0x60, 0x10, 0xD1, 0xE0, 0x20, 0xE3, 0x40, 0xD0, 0xE0, 0x23, 0xE2, 0x21, 0xE2, 0x40, 0xE0, 0x22,
+0xE1, 0x24, 0xE0, 0xD0, 0x40, 0xE0, 0x23, 0xE1, 0x20, 0xE2, 0xD0, 0x91, 0xD0, 0x90, 0xD1, 0xB0,
+0x90, 0xD3, 0xB0, 0xD0, 0x40, 0xD0, 0x30, 0x60, 0xF0, 0xB0, 0xD0, 0xA0, 0xF0, 0xA0, 0x11, 0xA0,
+0x30, 0xA0, 0xB0, 0x40, 0xE0, 0x90, 0x40, 0xB0, 0xA0, 0x60, 0xA0, 0x31, 0x51, 0x01, 0xC0, 0xA0,
+0x10, 0xF0, 0x50, 0x05, 0x50, 0x0D, 0x50, 0x03, 0x50, 0xA0, 0x40, 0xD1, 0xE0, 0xD2, 0x30, 0x60,
+0x30, 0xA0, 0x80, 0x02, 0x70, 0xC0, 0x03, 0x70, 0x60, 0xF0, 0x30, 0x80, 0x40, 0xD0, 0xB0, 0xF0,
+0xA0, 0xD0, 0xB0, 0xE1, 0x22, 0xE0, 0x22, 0xE1, 0x91, 0xE2, 0x20, 0xE1, 0x24, 0xE0, 0x23, 0xE3,
+0x40, 0xB0, 0x30, 0x00, 0x81, 0x00, 0x81, 0x01, 0x30, 0x70, 0x80, 0x0F, 0x3B, 0x0F, 0x39, 0x51,
+0x00, 0x80, 0x60, 0x50, 0x01, 0x50, 0x10, 0x30, 0xD0, 0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x20, 0xE0,
+0x20, 0xE0, 0x24, 0xD0, 0x91, 0xE2, 0x20, 0xE2, 0x21, 0xE4, 0x20, 0xE1, 0x91, 0xE1, 0x20, 0xE2,
+0x21, 0xE0, 0x21, 0xE0, 0x21, 0xE1, 0x40, 0xD0, 0x50, 0x70, 0xF0, 0xA0, 0x30, 0xA0, 0x60, 0xA0,
+0x40, 0xD0, 0xE3, 0x90, 0xE0, 0x22, 0xE2, 0x24, 0xD0, 0x91, 0xD0, 0x22, 0xE1, 0x24, 0xE1, 0x90,
+0xD0, 0x24, 0xE1, 0x21, 0xD0, 0x90, 0xA0, 0x80, 0xB0, 0xF0, 0x60, 0x90, 0xF0, 0x10, 0x91, 0x30,
+0x10, 0x60, 0xA0, 0x31, 0x70, 0xC0, 0x00, 0x80, 0xA0, 0x80, 0x04, 0xC1, 0x70, 0x50, 0x31, 0x50,
+0x70, 0x05, 0x50, 0x0C, 0x70, 0xC0, 0x0C, 0x50, 0x01, 0x70, 0xA0, 0x60, 0xD5, 0x60, 0xA0, 0x70,
+0x00, 0x50, 0x0D, 0x50, 0x10, 0x60, 0x31, 0x70, 0xA0, 0x40, 0xD0, 0xE1, 0x27, 0xE1, 0x40, 0x90,
+0xE0, 0x20, 0xE3, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0xE1, 0x20, 0xE1, 0xD0, 0xA0, 0x10, 0x70, 0x01,
+0x80, 0x60, 0x50, 0x80, 0x60, 0x50, 0xC0, 0x80, 0x0F, 0x3C, 0x0F, 0x38, 0xC0, 0xA0, 0x80, 0x60,
+0x00, 0x50, 0x30, 0x00, 0x70, 0x10, 0x60, 0x50, 0xA0, 0xD1, 0xE1, 0x20, 0xE1, 0x20, 0xE0, 0x20,
+0xE0, 0x25, 0x90, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x20, 0xE2, 0x20, 0xE2, 0x40,
+0xE1, 0x20, 0xE4, 0x22, 0xE2, 0x20, 0xE0, 0x90, 0xE0, 0xB0, 0xA0, 0x30, 0x80, 0x10, 0xC0, 0x00,
+0xC0, 0xB0, 0x10, 0xB0, 0x90, 0xD1, 0x40, 0xE1, 0x22, 0xE2, 0x24, 0xD0, 0x40, 0xE2, 0x21, 0xE2,
+0x22, 0xE1, 0x91, 0xE1, 0x23, 0xE0, 0x21, 0xD0, 0xA0, 0x10, 0x80, 0x30, 0x10, 0x50, 0xA0, 0xB0,
+0x80, 0x30, 0xA0, 0x60, 0x80, 0x02, 0x50, 0x0B, 0x70, 0xC0, 0x0B, 0x70, 0xC0, 0x0B, 0xC0, 0x70,
+0x0D, 0x80, 0xA0, 0x60, 0x90, 0xD0, 0x40, 0xB1, 0x30, 0xA1, 0x70, 0x02, 0xC0, 0x70, 0x0D, 0x50,
+0x70, 0x50, 0x01, 0x70, 0xA0, 0xD0, 0xE4, 0x24, 0xE1, 0x20, 0x40, 0xE1, 0x20, 0xE2, 0x23, 0xE0,
+0x22, 0xE3, 0xA0, 0x70, 0x11, 0xC0, 0x00, 0xA0, 0x70, 0x81, 0xC0, 0xA0, 0x30, 0x0F, 0x3D, 0x0F,
+0x3B, 0x30, 0x50, 0x00, 0xC0, 0xA0, 0x10, 0xF0, 0xC0, 0x00, 0x70, 0x60, 0x90, 0xD0, 0xE6, 0x25,
+0xE0, 0x40, 0x90, 0xE2, 0x20, 0xE1, 0x27, 0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE2, 0x24, 0xE2,
+0xD0, 0xE0, 0x40, 0xE0, 0x90, 0xA1, 0x80, 0x10, 0xA0, 0x02, 0xC0, 0xA0, 0x60, 0x40, 0x90, 0x40,
+0xD0, 0xE2, 0x21, 0xE1, 0x24, 0xE0, 0x40, 0xD0, 0xE1, 0x20, 0xE0, 0x25, 0xE1, 0x40, 0xE2, 0x20,
+0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0xD0, 0x90, 0xF0, 0x50, 0x00, 0x70, 0x0A, 0x50, 0x0B, 0xC0, 0x70,
+0x0B, 0xC0, 0x70, 0x0C, 0x50, 0x0C, 0x50, 0xF0, 0x30, 0x50, 0x30, 0xA0, 0x80, 0x51, 0x70, 0x06,
+0x50, 0x0F, 0x00, 0x70, 0xC0, 0x00, 0xC0, 0x60, 0xD1, 0x90, 0xE1, 0xD0, 0xE3, 0x22, 0xE0, 0x91,
+0xE2, 0x24, 0xE0, 0x20, 0xE1, 0x21, 0xD0, 0x90, 0x60, 0xC0, 0x00, 0x70, 0x11, 0xA0, 0xC0, 0x00,
+0x30, 0x50, 0x01, 0x60, 0x50, 0x0F, 0x3C, 0x0F, 0x3A, 0x70, 0x10, 0xC0, 0x81, 0xC0, 0x10, 0x50,
+0x01, 0xA0, 0x50, 0x60, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x24, 0xE0, 0x91, 0xE0, 0x20,
+0xE0, 0x22, 0xE0, 0x27, 0xE2, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x20, 0xE0, 0x23, 0xE2, 0xD0, 0x91,
+0xE0, 0x90, 0xB0, 0xA1, 0x70, 0x30, 0x10, 0x30, 0x02, 0x50, 0x10, 0x60, 0xD1, 0xE3, 0x20, 0xE1,
+0x23, 0xE0, 0x91, 0xD0, 0xE1, 0x20, 0xE0, 0x25, 0xE1, 0x40, 0xD0, 0xE3, 0x20, 0xE2, 0xD0, 0x61,
+0xC0, 0x50, 0x0C, 0x50, 0x0B, 0xC0, 0x70, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x80, 0x60, 0x31, 0x60,
+0x30, 0x0B, 0x70, 0xC0, 0x0F, 0x00, 0x50, 0x00, 0x70, 0x60, 0x50, 0x60, 0xB0, 0xA0, 0x60, 0xD0,
+0xE1, 0x20, 0xE0, 0x22, 0xE1, 0x91, 0xE0, 0x23, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xA0,
+0x50, 0x30, 0x01, 0x80, 0xF0, 0xC0, 0x70, 0x00, 0x70, 0xF0, 0x01, 0xC0, 0x10, 0x0F, 0x3C, 0x0F,
+0x35, 0x70, 0x10, 0xF2, 0xA0, 0x70, 0xC0, 0x30, 0x50, 0xF0, 0x00, 0x30, 0x50, 0x80, 0x50, 0x01,
+0xA0, 0xB0, 0xD1, 0x20, 0xE0, 0x24, 0xE0, 0xD0, 0xE0, 0x40, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x28,
+0xE2, 0x40, 0xE1, 0x20, 0xE0, 0x20, 0xE5, 0x22, 0xE1, 0xD0, 0x40, 0xD1, 0x40, 0x10, 0x40, 0x70,
+0xF0, 0x80, 0x70, 0x80, 0x10, 0x80, 0x02, 0x50, 0x10, 0x40, 0xD0, 0xE0, 0x22, 0xE3, 0x20, 0xE1,
+0x91, 0xE2, 0x20, 0xE0, 0x24, 0xE2, 0x40, 0xD0, 0x21, 0xE0, 0x20, 0xD2, 0xE0, 0xF0, 0xB0, 0x50,
+0x00, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x70, 0xC0, 0x08, 0x50, 0x10, 0x81, 0xA0,
+0x50, 0x0E, 0x50, 0x0F, 0x00, 0xC0, 0x70, 0x50, 0xA0, 0x30, 0x01, 0xA0, 0x90, 0xD0, 0xE1, 0x23,
+0xE2, 0xD0, 0x40, 0xE3, 0x22, 0xE2, 0xD1, 0xA0, 0x30, 0x01, 0x80, 0x50, 0x80, 0x30, 0x00, 0x70,
+0x10, 0x70, 0x00, 0x30, 0xA0, 0x01, 0xA0, 0xC0, 0x0F, 0x3B, 0x0F, 0x36, 0x30, 0xA0, 0x06, 0x30,
+0x50, 0x00, 0x80, 0x60, 0x02, 0x30, 0x80, 0xA0, 0xE0, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE2, 0x40,
+0xE1, 0x20, 0xE0, 0x20, 0xE2, 0x26, 0xE3, 0x40, 0xE1, 0x21, 0xE0, 0x22, 0x41, 0xD0, 0x21, 0xE1,
+0xD0, 0x91, 0xD0, 0x21, 0xE0, 0xD0, 0xF1, 0xB0, 0x10, 0x80, 0x00, 0x61, 0x70, 0x00, 0x71, 0x10,
+0x60, 0xE0, 0xD0, 0xE7, 0xD0, 0x40, 0xE0, 0x20, 0xE0, 0x21, 0xE1, 0x23, 0xE2, 0x40, 0xE2, 0x20,
+0xE0, 0x90, 0xA0, 0xE0, 0xD0, 0x60, 0x10, 0x60, 0x00, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50,
+0x0C, 0xC0, 0x70, 0x07, 0x70, 0x10, 0xA1, 0x50, 0x00, 0x50, 0x0E, 0x70, 0xC0, 0x0F, 0x00, 0x50,
+0x03, 0xF0, 0x40, 0xD0, 0xE0, 0x20, 0xE1, 0x22, 0xE3, 0x90, 0x40, 0xD0, 0xE1, 0x22, 0xE1, 0xD0,
+0x90, 0xA0, 0x80, 0x30, 0x02, 0xF0, 0x50, 0x01, 0xC0, 0xA0, 0x60, 0xC0, 0x00, 0x30, 0xA0, 0x80,
+0xA0, 0x0F, 0x3C, 0x0F, 0x37, 0x80, 0x60, 0x01, 0xC1, 0x70, 0x80, 0xF0, 0x02, 0x50, 0x30, 0x00,
+0x80, 0x50, 0x00, 0x70, 0xA0, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x20, 0xE1, 0x91, 0xD0, 0xE0, 0x22,
+0xE2, 0x25, 0xE0, 0x21, 0xD0, 0x40, 0xE2, 0x24, 0xE0, 0x91, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE1,
+0x21, 0xE0, 0xD0, 0xF0, 0xA0, 0x40, 0x10, 0x80, 0x50, 0x00, 0x50, 0x10, 0xA0, 0xC0, 0x00, 0xC0,
+0x80, 0xF0, 0xA0, 0x40, 0xD0, 0xE1, 0x20, 0xE2, 0xD0, 0x40, 0xE0, 0x23, 0xE2, 0x23, 0xE1, 0x90,
+0xE3, 0x20, 0x90, 0x60, 0xA0, 0xD0, 0x30, 0x50, 0x01, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50,
+0x0D, 0x50, 0x08, 0x70, 0xC0, 0x02, 0x70, 0xC0, 0x0E, 0x50, 0x0F, 0x00, 0xC0, 0x50, 0x02, 0xF0,
+0x90, 0xD0, 0x27, 0xE1, 0xD0, 0xE0, 0x91, 0xE3, 0x20, 0xE0, 0xD0, 0x40, 0xA0, 0xC0, 0x00, 0x80,
+0x50, 0x00, 0xA0, 0x70, 0x02, 0xC0, 0x30, 0x70, 0x60, 0x30, 0x00, 0x70, 0x50, 0x0F, 0x3D, 0x0F,
+0x38, 0x70, 0x50, 0x10, 0xA2, 0x30, 0x00, 0x50, 0xF0, 0x60, 0x50, 0xC0, 0xF0, 0x80, 0x02, 0xA1,
+0xB0, 0xD1, 0xE1, 0xD0, 0x90, 0x40, 0xD0, 0xE0, 0x23, 0xE3, 0x22, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+0x91, 0xE2, 0x24, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0x91, 0xE1, 0x22, 0xE0, 0xD1, 0x90, 0x10, 0xF1,
+0x10, 0xA0, 0x31, 0xA0, 0x03, 0x11, 0xD1, 0xE2, 0x20, 0xE0, 0x91, 0xE0, 0x21, 0xE0, 0x20, 0xE1,
+0x24, 0xD0, 0x91, 0xD0, 0xE1, 0x20, 0xD3, 0x80, 0x10, 0x70, 0x01, 0x50, 0x0C, 0x50, 0x0C, 0x50,
+0x0C, 0x70, 0xC0, 0x0C, 0x70, 0xC0, 0x0C, 0xC0, 0x50, 0x0E, 0x70, 0xC0, 0x0F, 0x00, 0x50, 0x01,
+0x30, 0xB0, 0xD0, 0x22, 0xE0, 0x22, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE2, 0xD2, 0x32, 0x02, 0x30,
+0xA0, 0xC1, 0x30, 0x02, 0xA0, 0x00, 0xF1, 0x0F, 0x40, 0x0F, 0x3A, 0x80, 0x60, 0x02, 0x80, 0xF0,
+0x01, 0xF0, 0x01, 0x30, 0x50, 0x00, 0x30, 0x70, 0x00, 0x80, 0xA0, 0xE0, 0xD0, 0xE1, 0x40, 0xE3,
+0x24, 0xE4, 0x20, 0xE0, 0x20, 0xE1, 0x40, 0xE4, 0x24, 0xE2, 0x22, 0xE0, 0x40, 0xD0, 0xE0, 0x20,
+0xE1, 0x20, 0xE1, 0xD2, 0x40, 0xD0, 0xA0, 0x60, 0xA0, 0x50, 0xA0, 0x70, 0x03, 0x50, 0x10, 0x40,
+0xD0, 0x22, 0xE0, 0x40, 0xE2, 0x23, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xE1, 0x20, 0xE0, 0xD0, 0xB0,
+0xA1, 0x30, 0x50, 0xC0, 0x01, 0xC0, 0x70, 0x0C, 0x50, 0x0C, 0x70, 0x0C, 0xC0, 0x70, 0x0C, 0xC0,
+0x70, 0x0D, 0x50, 0x0E, 0xC0, 0x50, 0x0F, 0x01, 0x50, 0x70, 0xF0, 0xC0, 0xD0, 0xE0, 0x21, 0xE0,
+0x22, 0xE1, 0x21, 0xE3, 0x40, 0xD2, 0x90, 0xA0, 0x50, 0x00, 0x81, 0x00, 0x80, 0x30, 0x01, 0x70,
+0x10, 0x80, 0x01, 0xF1, 0xC0, 0x80, 0x50, 0x0F, 0x3F, 0x0F, 0x3B, 0x70, 0xF0, 0xC0, 0x70, 0xF0,
+0x01, 0xC0, 0xF0, 0x02, 0x80, 0x60, 0x80, 0x02, 0x60, 0xA0, 0x40, 0xD0, 0x40, 0x90, 0xE1, 0x26,
+0xE5, 0x21, 0xD0, 0x91, 0xD0, 0xE3, 0x26, 0xE0, 0x20, 0xE1, 0x90, 0x40, 0xD0, 0xE0, 0x20, 0xE2,
+0x20, 0xE1, 0x20, 0xF1, 0x40, 0xA0, 0x10, 0x32, 0x05, 0xC0, 0xF0, 0x40, 0xD0, 0x21, 0xE0, 0x40,
+0xD0, 0xE3, 0x23, 0xE0, 0x20, 0xE2, 0x40, 0xE1, 0xD0, 0x90, 0x60, 0x80, 0x06, 0xC0, 0x70, 0x0C,
+0x50, 0x0C, 0x70, 0xC0, 0x0C, 0x50, 0x0D, 0x50, 0x0D, 0xC0, 0x70, 0x0E, 0x50, 0x0F, 0x01, 0x70,
+0xC0, 0x80, 0x60, 0x40, 0xD0, 0xE1, 0x23, 0xE0, 0x23, 0xE0, 0x20, 0xD0, 0x91, 0xD0, 0xB0, 0xA1,
+0x02, 0x30, 0xA0, 0x50, 0x02, 0x80, 0x50, 0x60, 0x50, 0x00, 0x50, 0xC0, 0x0F, 0x42, 0x0F, 0x3C,
+0x70, 0x00, 0xA0, 0x50, 0x01, 0xA0, 0x80, 0xC0, 0x31, 0x00, 0x70, 0xA0, 0xC0, 0x00, 0x30, 0xC0,
+0x00, 0x31, 0x90, 0xD1, 0x20, 0xD0, 0x26, 0xE3, 0x20, 0xE2, 0x40, 0xD0, 0xE3, 0x20, 0xE0, 0x22,
+0xE1, 0x21, 0xE1, 0xD0, 0x40, 0xD0, 0xE0, 0x21, 0xE3, 0x21, 0xD0, 0xE0, 0xA0, 0x10, 0xF0, 0x60,
+0xA0, 0x10, 0x07, 0x60, 0x10, 0xD0, 0xE0, 0x20, 0xE0, 0x40, 0xD0, 0xE3, 0x20, 0xE3, 0x20, 0xE2,
+0x40, 0xD0, 0xE0, 0x90, 0x60, 0xC0, 0x07, 0x70, 0xC0, 0x0C, 0x50, 0x0C, 0x70, 0xC0, 0x0C, 0x50,
+0x0D, 0x50, 0x0E, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x01, 0x50, 0x00, 0x80, 0xF0, 0xD0, 0xE2, 0x22,
+0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x31, 0x00, 0x50, 0x80, 0x00, 0x70, 0x30, 0x70, 0x03,
+0xC0, 0x00, 0xC0, 0xF0, 0xC0, 0x0F, 0x44, 0x0F, 0x3E, 0xA0, 0xC0, 0x00, 0x30, 0xA0, 0x00, 0x50,
+0x70, 0x80, 0xC0, 0x01, 0xA0, 0x30, 0x50, 0x02, 0xF0, 0xA0, 0x90, 0xD1, 0x22, 0xE1, 0x25, 0xE0,
+0x20, 0xE1, 0x40, 0xE4, 0x21, 0xE1, 0x21, 0xE2, 0x20, 0xE0, 0xD0, 0x91, 0xE0, 0x20, 0xE3, 0xD5,
+0x90, 0x10, 0x30, 0xA0, 0x30, 0x70, 0x08, 0x30, 0xA0, 0xD1, 0x91, 0xE3, 0x21, 0xE0, 0x20, 0xE1,
+0xD2, 0x91, 0xD1, 0xA0, 0x70, 0x08, 0x70, 0xC0, 0x0C, 0x50, 0x0C, 0x70, 0xC0, 0x0C, 0x50, 0x0D,
+0x70, 0xC0, 0x0D, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x01, 0xC0, 0x71, 0x10, 0x60, 0xE2, 0x22, 0xE0,
+0x21, 0xE2, 0xD1, 0x40, 0x61, 0x02, 0x32, 0x08, 0xC0, 0x10, 0x0F, 0x44, 0x0F, 0x3E, 0x70, 0x60,
+0xF0, 0x30, 0x02, 0x80, 0x70, 0x03, 0x80, 0x30, 0x01, 0xA0, 0x01, 0x31, 0xD1, 0xE0, 0x20, 0xE3,
+0x25, 0xE0, 0x90, 0x40, 0xD0, 0xE0, 0x28, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0xE2, 0xD3, 0x90, 0xB0,
+0xF0, 0x40, 0x10, 0x60, 0x80, 0xA0, 0x10, 0x80, 0x0B, 0xA0, 0xD1, 0x40, 0x21, 0xE0, 0x25, 0xE0,
+0xD0, 0xB0, 0x30, 0x80, 0xD0, 0x41, 0xB0, 0xA0, 0x03, 0xC0, 0x80, 0x03, 0x70, 0xC0, 0x0C, 0x50,
+0x0C, 0xC0, 0x70, 0x0C, 0x70, 0x0D, 0xC0, 0x70, 0x0D, 0xC0, 0x70, 0x0E, 0xC0, 0x70, 0x0F, 0x01,
+0x50, 0x70, 0x60, 0xA0, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0xD1, 0xA0, 0x30, 0x00, 0x70, 0x30, 0x01,
+0xA0, 0x50, 0x0A, 0x70, 0xC0, 0x0F, 0x43, 0x0F, 0x4C, 0x70, 0xA0, 0x80, 0x50, 0x01, 0xC0, 0x60,
+0xA0, 0x90, 0xD0, 0xE4, 0x25, 0xD0, 0x40, 0xE3, 0x27, 0xE0, 0x22, 0xE0, 0x91, 0xD0, 0xE1, 0xB1,
+0x40, 0x90, 0x60, 0xF0, 0x11, 0x80, 0xC0, 0x50, 0xC0, 0x00, 0x50, 0x0A, 0xC0, 0x60, 0xD1, 0x40,
+0xE0, 0x27, 0xE0, 0x40, 0xB0, 0xC0, 0x80, 0x60, 0xA0, 0x61, 0x80, 0xA1, 0x80, 0xB0, 0x60, 0x10,
+0x03, 0x50, 0x0D, 0x50, 0x0C, 0xC0, 0x70, 0x0C, 0x70, 0xC0, 0x0D, 0x50, 0x0E, 0x50, 0x0F, 0x00,
+0x50, 0x0F, 0x02, 0xA0, 0x40, 0xD1, 0xE1, 0xD1, 0xE4, 0xD0, 0x40, 0xA0, 0x60, 0x02, 0x81, 0xA0,
+0xC0, 0x0F, 0x51, 0x0F, 0x4E, 0x30, 0x80, 0x01, 0x30, 0xC0, 0x00, 0xA0, 0xB0, 0xD0, 0xE0, 0x20,
+0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x91, 0xD0, 0xE1, 0x28, 0xE0, 0x21, 0xE0, 0xD0, 0x40, 0xE1, 0xD0,
+0xB0, 0x11, 0xF1, 0x40, 0xD0, 0x10, 0x80, 0x03, 0xC0, 0x70, 0x06, 0x81, 0xC1, 0x40, 0x10, 0xD0,
+0x90, 0x40, 0xE0, 0x24, 0xE1, 0x20, 0xE1, 0xA0, 0xD0, 0x00, 0x80, 0x30, 0xA0, 0x90, 0xD1, 0x90,
+0x41, 0xD0, 0xB0, 0xF0, 0xC0, 0x01, 0x50, 0x0D, 0x50, 0x0C, 0xC0, 0x70, 0x0C, 0xC0, 0x70, 0x0D,
+0x50, 0x0E, 0x50, 0xC0, 0x0E, 0xC0, 0x70, 0x0F, 0x00, 0xA0, 0x31, 0x60, 0x40, 0xD1, 0x90, 0x60,
+0x40, 0xD0, 0xE0, 0xD1, 0x31, 0x00, 0xC0, 0x30, 0x01, 0x30, 0x80, 0x0F, 0x53, 0x0F, 0x4F, 0x70,
+0xA0, 0x30, 0x50, 0x01, 0xC0, 0xA1, 0x90, 0xD0, 0xE2, 0x21, 0xE2, 0x40, 0xD0, 0xE1, 0x27, 0xE2,
+0x20, 0xE2, 0x40, 0xE1, 0xD0, 0xB0, 0x10, 0x30, 0xF0, 0x60, 0xD0, 0x90, 0xF0, 0x04, 0x50, 0x07,
+0x80, 0x11, 0x60, 0x80, 0xD1, 0x91, 0xE2, 0xD0, 0xE0, 0x20, 0xE3, 0xD1, 0x31, 0x50, 0x00, 0xC0,
+0x60, 0x40, 0x21, 0xD1, 0xB0, 0xF0, 0x50, 0x02, 0x50, 0x0D, 0x50, 0x0C, 0xC0, 0x70, 0x0D, 0x50,
+0x0D, 0x70, 0xC0, 0x0D, 0xC0, 0x70, 0x0F, 0x00, 0x50, 0x0E, 0x70, 0x10, 0x50, 0x70, 0x30, 0x90,
+0xE0, 0x60, 0x10, 0xA0, 0xD2, 0x90, 0x60, 0xA0, 0x02, 0x81, 0xA0, 0x70, 0x0F, 0x54, 0x0F, 0x51,
+0x30, 0x80, 0x01, 0xA0, 0x01, 0xA0, 0x30, 0xD1, 0xE0, 0x22, 0xD0, 0x91, 0xE1, 0x26, 0xE3, 0x20,
+0xE1, 0xD0, 0x91, 0xD0, 0xE0, 0x20, 0xE0, 0xA0, 0xB0, 0x30, 0xA0, 0xF0, 0x30, 0x05, 0x50, 0x09,
+0x70, 0x80, 0x31, 0xA0, 0x30, 0xB0, 0xD0, 0xE0, 0x90, 0x60, 0x90, 0xD0, 0xE0, 0x20, 0xD0, 0x40,
+0xE0, 0xD1, 0x81, 0x01, 0xB1, 0xE0, 0x20, 0xD0, 0xA0, 0x80, 0x04, 0x50, 0x0D, 0x50, 0x0D, 0x50,
+0x0D, 0x50, 0x0D, 0xC0, 0x70, 0x0E, 0x50, 0x0F, 0x00, 0xC0, 0x70, 0x0F, 0x01, 0xC0, 0x61, 0x10,
+0xA0, 0x90, 0xD1, 0x90, 0xA0, 0x30, 0x00, 0xC0, 0xA0, 0x01, 0x31, 0x0F, 0x56, 0x0F, 0x52, 0x50,
+0xA0, 0x30, 0x70, 0x01, 0x70, 0xA1, 0xB0, 0xD0, 0xE0, 0x21, 0xE0, 0x40, 0xD0, 0xE0, 0x26, 0xE4,
+0x21, 0xE1, 0x40, 0xD0, 0xE2, 0x20, 0xD1, 0x90, 0x10, 0x60, 0x50, 0xA0, 0x50, 0x02, 0x70, 0xC0,
+0x0C, 0x51, 0xB0, 0xF0, 0xE0, 0xD1, 0xA0, 0x60, 0x40, 0xD0, 0xE0, 0xD0, 0xB0, 0xF0, 0xB0, 0x90,
+0xD0, 0x30, 0x40, 0xA0, 0xB0, 0xD2, 0x31, 0x05, 0x50, 0x0D, 0x50, 0x0D, 0x50, 0x0D, 0x70, 0xC0,
+0x0D, 0x50, 0x0E, 0x70, 0xC0, 0x0F, 0x00, 0x50, 0x0F, 0x01, 0xC0, 0x30, 0x60, 0x90, 0xD2, 0xB0,
+0x30, 0xA0, 0xC0, 0x01, 0x50, 0x30, 0xA0, 0xC0, 0x0F, 0x57, 0x0F, 0x54, 0xA0, 0x80, 0x01, 0xA0,
+0x01, 0x80, 0x60, 0x90, 0xD1, 0x40, 0xE2, 0x21, 0xE0, 0x22, 0xE4, 0x20, 0xE1, 0xD0, 0x91, 0x25,
+0xE0, 0xD0, 0xA0, 0x10, 0x61, 0x30, 0xC0, 0x01, 0x50, 0x0D, 0xA0, 0xF0, 0x30, 0xB0, 0x60, 0xE0,
+0xD0, 0x90, 0xA0, 0x10, 0x40, 0xD0, 0x90, 0x60, 0x10, 0x60, 0xF0, 0x40, 0x90, 0x40, 0x90, 0xD1,
+0x40, 0xA0, 0x80, 0x70, 0x05, 0x50, 0x0D, 0x50, 0x0D, 0x50, 0x0D, 0x70, 0xC0, 0x0D, 0x70, 0xC0,
+0x0E, 0x50, 0x0F, 0x00, 0x71, 0x0F, 0x00, 0xA0, 0xB0, 0x90, 0xD1, 0x40, 0x60, 0x50, 0x00, 0xC0,
+0xA0, 0x01, 0x31, 0x0F, 0x59, 0x0F, 0x55, 0x50, 0xA1, 0x70, 0x01, 0x70, 0x30, 0xA0, 0xB0, 0xD0,
+0x90, 0xD0, 0xEB, 0x21, 0xE0, 0x20, 0xE0, 0x40, 0xE0, 0x22, 0xE3, 0xD0, 0x90, 0xB0, 0xD0, 0x40,
+0x30, 0xA1, 0xF0, 0x31, 0xC0, 0x0C, 0xC0, 0x60, 0xA0, 0x60, 0x90, 0xA0, 0x30, 0xA0, 0x80, 0xD2,
+0x90, 0x40, 0x90, 0x41, 0xE0, 0xD3, 0xA0, 0x08, 0x50, 0x0D, 0x50, 0x0D, 0x50, 0x0D, 0xC0, 0x70,
+0x0D, 0x70, 0xC0, 0x0E, 0x50, 0x0F, 0x01, 0x50, 0x0E, 0xA0, 0x40, 0xD0, 0x90, 0xD0, 0xA0, 0x31,
+0xC0, 0x01, 0x50, 0x30, 0xA0, 0x70, 0x0F, 0x5A, 0x0F, 0x57, 0x80, 0x30, 0x01, 0xA0, 0x01, 0xB0,
+0x10, 0x40, 0xD1, 0x20, 0xE0, 0x20, 0xE3, 0x21, 0xE1, 0x22, 0xE0, 0x91, 0xD0, 0xE4, 0x21, 0xD0,
+0xE0, 0xD0, 0xE0, 0xD3, 0x90, 0x50, 0x30, 0x10, 0x0C, 0x50, 0x00, 0x70, 0x80, 0x30, 0xA0, 0x30,
+0x00, 0x10, 0xA0, 0x30, 0xA2, 0x35, 0xA0, 0x30, 0x10, 0x60, 0x06, 0xC0, 0x70, 0x0D, 0x50, 0x0D,
+0x50, 0x0D, 0xC0, 0x70, 0x0D, 0xC0, 0x70, 0x0E, 0x71, 0x0F, 0x00, 0x70, 0xC0, 0x0C, 0x80, 0x30,
+0xD1, 0xB0, 0x10, 0x50, 0x01, 0xA0, 0x00, 0xC0, 0x30, 0x80, 0x00, 0x80, 0x30, 0x80, 0x0F, 0x58,
+0x0F, 0x59, 0x30, 0xA0, 0x70, 0x01, 0xF0, 0x10, 0x40, 0xA0, 0x40, 0xD1, 0xE3, 0x22, 0xE1, 0x22,
+0xE0, 0x40, 0xE0, 0xD0, 0xE4, 0x24, 0xE0, 0x20, 0xE2, 0x40, 0x70, 0x60, 0x0D, 0x50, 0x0E, 0x50,
+0x05, 0x50, 0x06, 0xC0, 0x70, 0x0D, 0x50, 0x0D, 0x70, 0xC0, 0x0D, 0x50, 0x0E, 0x50, 0x0F, 0x00,
+0x50, 0x0F, 0x01, 0x50, 0x0B, 0x80, 0x30, 0xC0, 0x40, 0xA0, 0x50, 0x10, 0x60, 0x01, 0x50, 0xA0,
+0x30, 0xC1, 0x00, 0x80, 0x50, 0x30, 0x0F, 0x58, 0x0F, 0x56, 0xA0, 0x60, 0x30, 0x00, 0x50, 0xA0,
+0xC0, 0x80, 0x10, 0x50, 0x00, 0xC0, 0xF0, 0x30, 0x90, 0xD1, 0x24, 0xE0, 0x20, 0xE2, 0x91, 0xD0,
+0xE4, 0x27, 0xE1, 0x41, 0xD0, 0x40, 0xA0, 0x0B, 0xC0, 0x70, 0x0E, 0x50, 0x0D, 0x70, 0xC0, 0x0D,
+0x50, 0x0D, 0x70, 0xC0, 0x0D, 0x50, 0x0E, 0x70, 0xC0, 0x0E, 0x50, 0x0F, 0x01, 0x70, 0xC0, 0x09,
+0x80, 0x30, 0x50, 0xA0, 0x60, 0x01, 0x80, 0x10, 0x50, 0x70, 0xA0, 0x71, 0x60, 0xA0, 0x30, 0x00,
+0x50, 0x0F, 0x59, 0x0F, 0x55, 0xC0, 0x50, 0x00, 0x81, 0x01, 0x80, 0x10, 0x60, 0x01, 0x80, 0x70,
+0xC0, 0x31, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x21, 0xE3, 0x40, 0xE6, 0x27, 0xE0, 0x90, 0xA0, 0xF1,
+0x30, 0x10, 0x0B, 0x50, 0x0E, 0xC0, 0x70, 0x0D, 0x70, 0xC0, 0x0D, 0x50, 0x0D, 0xC0, 0x70, 0x0D,
+0x70, 0x0E, 0xC0, 0x70, 0x0E, 0xC0, 0x70, 0x0F, 0x01, 0x50, 0x08, 0x80, 0x30, 0xA0, 0x30, 0x00,
+0x80, 0x50, 0x01, 0x11, 0x80, 0x01, 0xA0, 0x70, 0x00, 0xA0, 0x80, 0x0F, 0x5A, 0x0F, 0x58, 0x80,
+0x30, 0x02, 0xC0, 0x30, 0x80, 0x00, 0xA0, 0x02, 0x60, 0xA1, 0xD1, 0xE2, 0x21, 0xE0, 0x91, 0xD0,
+0xE1, 0x21, 0xE0, 0x23, 0xE1, 0x22, 0xD0, 0xA1, 0x11, 0xF0, 0x80, 0xC0, 0x0A, 0x50, 0x0E, 0x70,
+0xC0, 0x0D, 0x50, 0x0E, 0x50, 0x0D, 0xC0, 0x70, 0x0D, 0x71, 0x0E, 0x50, 0x0F, 0x00, 0x50, 0x0F,
+0x01, 0x50, 0xC0, 0x06, 0x80, 0x10, 0x30, 0xA0, 0x02, 0xA0, 0x00, 0x31, 0x00, 0x70, 0xA0, 0x00,
+0xA0, 0x70, 0x01, 0xF0, 0xC0, 0x0F, 0x59, 0x0F, 0x55, 0x50, 0x80, 0x61, 0x00, 0x50, 0xA0, 0x10,
+0x50, 0x00, 0x70, 0x60, 0x80, 0x01, 0x30, 0xC0, 0x00, 0x70, 0xF0, 0xB0, 0x90, 0xD0, 0xE3, 0x40,
+0xE1, 0x21, 0xE1, 0x22, 0xE3, 0x22, 0xD0, 0x90, 0x60, 0xF0, 0x60, 0x0D, 0x50, 0x0E, 0x50, 0x0E,
+0x50, 0x0E, 0x50, 0x0D, 0xC0, 0x70, 0x0D, 0xC0, 0x70, 0x0E, 0x50, 0x0F, 0x00, 0x70, 0xC0, 0x0F,
+0x00, 0xC0, 0x50, 0x04, 0xC0, 0xA0, 0xF0, 0xC0, 0x00, 0x50, 0x80, 0x01, 0x30, 0x60, 0xC0, 0x00,
+0xA1, 0x01, 0x50, 0x60, 0x01, 0x80, 0x30, 0x0F, 0x59, 0x0F, 0x53, 0x50, 0x10, 0x30, 0x50, 0x70,
+0x02, 0x50, 0xF0, 0x03, 0x50, 0xA0, 0x50, 0x30, 0x02, 0x30, 0x70, 0xA0, 0xB0, 0x90, 0xD1, 0xE0,
+0x90, 0xE1, 0x20, 0xE2, 0x22, 0xE3, 0x21, 0xE1, 0x40, 0x61, 0x10, 0x50, 0x0B, 0xC0, 0x70, 0x0E,
+0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x70, 0x0E, 0x50, 0x0E, 0x70, 0xC0, 0x0E, 0xC0, 0x70, 0x0F,
+0x01, 0x50, 0x02, 0xC0, 0xA0, 0x60, 0x50, 0x30, 0x02, 0xA0, 0x50, 0xA0, 0x50, 0x01, 0xC0, 0xF0,
+0x00, 0x51, 0x00, 0xA0, 0x50, 0x00, 0x50, 0x30, 0x0F, 0x59, 0x0F, 0x53, 0xC0, 0xA0, 0x30, 0x04,
+0xA0, 0x70, 0x01, 0x30, 0x60, 0x70, 0x00, 0x80, 0x60, 0xC0, 0x00, 0x80, 0x70, 0x01, 0xA1, 0x30,
+0xD0, 0x40, 0xE0, 0xD0, 0xE0, 0x20, 0xE1, 0x20, 0xE0, 0x21, 0xE3, 0x21, 0xE1, 0x90, 0x60, 0xC0,
+0xA1, 0x30, 0x0A, 0x50, 0x0F, 0x00, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E,
+0xC0, 0x70, 0x0F, 0x00, 0x50, 0x0F, 0x02, 0x70, 0xC0, 0xA0, 0x10, 0x30, 0x01, 0x51, 0x00, 0x70,
+0x60, 0x80, 0x00, 0x50, 0x80, 0x01, 0x30, 0xA0, 0x30, 0xA0, 0x60, 0x00, 0xF0, 0x30, 0x60, 0x70,
+0x0F, 0x59, 0x0F, 0x55, 0x50, 0xF0, 0x70, 0x01, 0x50, 0x60, 0x01, 0x60, 0x80, 0x00, 0xF0, 0xC0,
+0x01, 0x80, 0xA0, 0x30, 0x01, 0xC0, 0x30, 0x00, 0x70, 0xA0, 0x60, 0xE0, 0xD0, 0xE1, 0x20, 0xE0,
+0x23, 0xE2, 0x22, 0xD0, 0x90, 0xE0, 0x40, 0x60, 0xA0, 0x10, 0xA0, 0x30, 0x09, 0x50, 0x0F, 0x00,
+0x70, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x70, 0xC0,
+0x0F, 0x00, 0x70, 0xF0, 0x60, 0x70, 0x00, 0xA0, 0x02, 0x60, 0xA0, 0x80, 0x02, 0xA0, 0x10, 0x01,
+0x50, 0xA0, 0x01, 0xA0, 0x50, 0x00, 0x70, 0x0F, 0x5B, 0x0F, 0x59, 0xC0, 0xF0, 0xC0, 0x00, 0x80,
+0x30, 0x01, 0xA0, 0xC0, 0x70, 0x30, 0x50, 0x00, 0x80, 0x30, 0x70, 0x80, 0x70, 0x01, 0x80, 0x70,
+0x31, 0x40, 0xD1, 0xE0, 0x23, 0xE1, 0x22, 0xE0, 0xD0, 0x40, 0xD0, 0x40, 0xF0, 0x30, 0x60, 0x80,
+0xB0, 0x80, 0x07, 0xC0, 0x70, 0x0E, 0xC0, 0x70, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50,
+0x0F, 0x00, 0x50, 0x0F, 0x01, 0x50, 0x0D, 0x50, 0x60, 0xA0, 0x50, 0x80, 0x01, 0x51, 0x70, 0xA0,
+0x80, 0x03, 0x70, 0x80, 0x50, 0xA0, 0x04, 0xA0, 0x50, 0x0F, 0x5D, 0x0F, 0x59, 0x70, 0x80, 0x01,
+0xF0, 0xC0, 0x00, 0xC0, 0xF0, 0x00, 0x80, 0xC0, 0x30, 0x01, 0xC0, 0x80, 0x60, 0x70, 0x00, 0xC0,
+0x30, 0x01, 0x50, 0xA1, 0xB0, 0xE0, 0xD0, 0xE0, 0x21, 0xE1, 0x21, 0xE2, 0x90, 0xD0, 0x90, 0xA2,
+0x90, 0xD0, 0x60, 0x70, 0x06, 0x70, 0xC0, 0x0E, 0x70, 0xC0, 0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50,
+0x0E, 0xC0, 0x70, 0x0E, 0x70, 0xC0, 0x0F, 0x00, 0x50, 0x0A, 0xC0, 0x80, 0x60, 0xF0, 0x70, 0x01,
+0xA0, 0x01, 0x50, 0xF0, 0x80, 0x08, 0xF0, 0x70, 0x00, 0x50, 0xF0, 0xA0, 0x30, 0x0F, 0x5E, 0x0F,
+0x5C, 0xC0, 0x60, 0x01, 0xA0, 0x80, 0x00, 0xC0, 0x80, 0x70, 0x04, 0x80, 0xA1, 0x70, 0x01, 0x30,
+0xC0, 0x00, 0x50, 0xF0, 0xB0, 0x90, 0xD1, 0xE1, 0x21, 0xE1, 0x90, 0xE1, 0xD1, 0xE0, 0xD2, 0xF0,
+0x10, 0x80, 0x05, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x0F, 0x00,
+0x50, 0x0E, 0xC0, 0x70, 0x0F, 0x00, 0xC0, 0x70, 0x07, 0xC0, 0xA0, 0x10, 0x80, 0x00, 0x70, 0x80,
+0x01, 0x50, 0x30, 0xA0, 0x80, 0x0A, 0x70, 0x60, 0x01, 0xC0, 0x70, 0x0F, 0x5F, 0x0F, 0x5D, 0xF0,
+0x50, 0x30, 0x60, 0x0B, 0x80, 0xA0, 0x50, 0x00, 0x30, 0x01, 0xC0, 0x30, 0x70, 0x30, 0xA0, 0x40,
+0xD1, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0xE2, 0x20, 0xE3, 0xD1, 0xB0, 0x60, 0x70, 0x03, 0x50, 0x0F,
+0x00, 0x50, 0x0E, 0xC0, 0x70, 0x00, 0xC0, 0x10, 0xF0, 0x80, 0xC0, 0x50, 0x70, 0x06, 0x50, 0x0E,
+0x50, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x50, 0x0F, 0x01, 0x50, 0x05, 0x50, 0x61, 0x70, 0x30, 0x02,
+0x30, 0x00, 0x80, 0xA0, 0x50, 0x0D, 0x30, 0x70, 0x0F, 0x62, 0x0F, 0x5D, 0xC0, 0x30, 0x80, 0x0E,
+0x50, 0x60, 0x30, 0x01, 0x30, 0x02, 0xA0, 0xB0, 0xA0, 0xB0, 0x90, 0xD1, 0x91, 0xD1, 0x20, 0xE1,
+0x20, 0xE1, 0x20, 0xD0, 0xB0, 0x10, 0xF0, 0x50, 0x01, 0xC0, 0x70, 0x0F, 0x00, 0x50, 0x0E, 0xC0,
+0x70, 0x02, 0x30, 0x60, 0x30, 0xB0, 0x30, 0x61, 0x30, 0x70, 0x02, 0x50, 0x0E, 0x70, 0xC0, 0x0E,
+0x50, 0x0F, 0x00, 0x70, 0x0F, 0x01, 0x50, 0x02, 0x70, 0x30, 0xF0, 0xA0, 0x30, 0x01, 0x70, 0x80,
+0x00, 0xC0, 0x30, 0x60, 0x50, 0x0F, 0x74, 0x0F, 0x71, 0x70, 0x31, 0xA0, 0x01, 0xC0, 0x30, 0x01,
+0xB0, 0x60, 0xA0, 0x41, 0xD1, 0xE1, 0x20, 0xE0, 0xD0, 0xE0, 0x22, 0xD0, 0x40, 0x90, 0x30, 0x60,
+0x00, 0x70, 0x0F, 0x00, 0xC0, 0x70, 0x0E, 0x70, 0xC0, 0x03, 0xB0, 0x40, 0xD3, 0x40, 0x30, 0x60,
+0x40, 0x70, 0x50, 0xC1, 0x0C, 0x70, 0xC0, 0x0E, 0x50, 0x0F, 0x00, 0x70, 0xC0, 0x0F, 0x01, 0x50,
+0x80, 0x60, 0xF0, 0x80, 0x01, 0xA0, 0x02, 0x60, 0x31, 0x70, 0x0F, 0x76, 0x0F, 0x73, 0x70, 0x80,
+0xA0, 0x70, 0x30, 0xC0, 0x01, 0xA0, 0x01, 0xA0, 0x10, 0xA0, 0x40, 0xD2, 0xE0, 0xD0, 0xE1, 0x22,
+0xD2, 0x60, 0x30, 0x50, 0x0F, 0x00, 0x71, 0x0E, 0x70, 0xC0, 0x01, 0x70, 0xA0, 0xB0, 0xE0, 0x23,
+0xE0, 0xD0, 0x90, 0x40, 0xB1, 0x31, 0xA1, 0x31, 0x80, 0x70, 0x80, 0x05, 0xC0, 0x70, 0x0E, 0x70,
+0xC0, 0x0E, 0xC0, 0x50, 0x0E, 0x50, 0xA0, 0x10, 0x30, 0x01, 0x30, 0x01, 0x70, 0x80, 0x50, 0xA0,
+0x80, 0xC0, 0x0F, 0x78, 0x0F, 0x76, 0x50, 0x60, 0x80, 0x00, 0xC0, 0x80, 0x01, 0xF0, 0x10, 0x00,
+0x80, 0x60, 0xA0, 0x40, 0xD2, 0x22, 0xE3, 0xD0, 0x90, 0x30, 0xA0, 0x30, 0x70, 0x0C, 0x70, 0xC0,
+0x0C, 0x70, 0x00, 0x70, 0x01, 0xF0, 0x30, 0xD1, 0xE2, 0x20, 0xE0, 0x20, 0xE1, 0xD1, 0x90, 0xD3,
+0xE0, 0x90, 0xB1, 0xA0, 0x61, 0x30, 0xB0, 0x50, 0xC0, 0x00, 0x70, 0x0E, 0x71, 0x0F, 0x00, 0x50,
+0x0B, 0x50, 0xA0, 0x10, 0x80, 0xC0, 0x10, 0xA0, 0x01, 0x30, 0x00, 0xC0, 0x30, 0x60, 0x50, 0x0F,
+0x7B, 0x0F, 0x78, 0xC0, 0x30, 0x60, 0x30, 0x00, 0x70, 0x10, 0x80, 0x01, 0x30, 0x00, 0xB0, 0x60,
+0xA0, 0xB0, 0xD2, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x91, 0xD1, 0xA1, 0x80, 0x50, 0x09, 0x50, 0x08,
+0xA4, 0x30, 0x60, 0x30, 0x00, 0x50, 0x60, 0xE0, 0xD0, 0xE1, 0x20, 0xE1, 0x23, 0xE1, 0x40, 0xD0,
+0x23, 0xE0, 0xD4, 0x91, 0xB0, 0xA0, 0x60, 0xA0, 0x30, 0x80, 0x70, 0x50, 0x70, 0x0A, 0x70, 0x0F,
+0x00, 0x70, 0xC0, 0x06, 0xC0, 0x50, 0x60, 0xF0, 0x30, 0x00, 0x30, 0x01, 0x30, 0x10, 0x01, 0xA0,
+0x60, 0x30, 0x02, 0x31, 0x80, 0x0F, 0x78, 0x0F, 0x76, 0xC0, 0x30, 0x80, 0x01, 0x50, 0x30, 0x60,
+0x10, 0xC0, 0x00, 0x51, 0x01, 0x80, 0x51, 0xA1, 0x40, 0x90, 0xD0, 0xE0, 0x20, 0xE0, 0x40, 0xE2,
+0xD0, 0x90, 0x41, 0xA0, 0x80, 0xC0, 0x06, 0x50, 0x08, 0x30, 0xB0, 0x70, 0xD3, 0x80, 0x30, 0x60,
+0xF0, 0x90, 0xE0, 0x22, 0xE2, 0x21, 0xE2, 0x40, 0xD0, 0xE0, 0x22, 0xE5, 0xD4, 0x40, 0x90, 0xA0,
+0xF0, 0x10, 0xF0, 0x0A, 0x50, 0x0F, 0x00, 0xC0, 0x70, 0x03, 0x70, 0x80, 0x61, 0x81, 0x50, 0x01,
+0x80, 0xC0, 0x00, 0x50, 0x10, 0xA0, 0x30, 0x70, 0x00, 0xC0, 0x30, 0x50, 0x00, 0x30, 0x70, 0x80,
+0x0F, 0x78, 0x0F, 0x76, 0xA0, 0x80, 0x50, 0x60, 0x03, 0x50, 0xA0, 0x80, 0x30, 0xC0, 0x01, 0xA0,
+0x02, 0x30, 0x50, 0x30, 0x60, 0xB0, 0x90, 0xE0, 0x40, 0xD0, 0xE0, 0xD0, 0xE1, 0xD2, 0x40, 0x30,
+0xA0, 0x30, 0x80, 0x00, 0xC0, 0x70, 0x80, 0x30, 0xA0, 0x30, 0x07, 0x50, 0xA0, 0x90, 0xD0, 0xE0,
+0xD0, 0x40, 0xD4, 0xE6, 0x20, 0xE2, 0x40, 0xD0, 0xE0, 0x20, 0xE0, 0x26, 0xE0, 0x20, 0xE1, 0xD0,
+0x40, 0xD3, 0x30, 0xF0, 0x50, 0x08, 0x50, 0x0F, 0x01, 0x70, 0x00, 0x70, 0x30, 0x61, 0x50, 0xA0,
+0x02, 0x30, 0x01, 0x70, 0x32, 0x50, 0x02, 0xC0, 0x60, 0x70, 0x60, 0x50, 0x00, 0x50, 0x0F, 0x79,
+0x0F, 0x79, 0x60, 0xC0, 0x70, 0xF0, 0xA0, 0x01, 0xC0, 0x80, 0x30, 0x80, 0x50, 0x80, 0x01, 0x80,
+0xC0, 0x01, 0x30, 0x50, 0x30, 0xA0, 0x60, 0xB0, 0x90, 0xD3, 0xE1, 0xD2, 0xE0, 0xF0, 0xA0, 0x60,
+0x11, 0xF0, 0x60, 0x12, 0xA0, 0x60, 0x04, 0x80, 0xA0, 0x60, 0xD0, 0xE0, 0x40, 0xD0, 0x60, 0x30,
+0xA0, 0xB0, 0xD0, 0xE0, 0x22, 0xE0, 0x23, 0xE0, 0x40, 0xD0, 0xE3, 0x27, 0xE2, 0x40, 0xD2, 0xB0,
+0x60, 0x70, 0x09, 0x70, 0x0E, 0x70, 0x30, 0x60, 0xF0, 0x30, 0x81, 0x01, 0x51, 0x01, 0x30, 0x50,
+0x30, 0xA0, 0x80, 0xC0, 0x00, 0x50, 0x60, 0xF0, 0xC0, 0x50, 0x80, 0x00, 0xC0, 0xF0, 0x0F, 0x7B,
+0x0F, 0x78, 0x30, 0xA0, 0x70, 0xF0, 0x00, 0x50, 0xA0, 0x01, 0xC0, 0x01, 0x30, 0xA0, 0x80, 0x70,
+0xA0, 0x01, 0xC0, 0x30, 0x01, 0x51, 0x70, 0x30, 0xF0, 0xA0, 0xB0, 0x90, 0xD3, 0xE0, 0xD4, 0x90,
+0xA0, 0x60, 0xA1, 0xF0, 0x31, 0x60, 0xF0, 0x70, 0x00, 0x50, 0x60, 0xF0, 0x10, 0xE1, 0x90, 0xD0,
+0xA0, 0x40, 0xC0, 0xA1, 0xD0, 0x22, 0xE0, 0x23, 0xE0, 0x40, 0xD0, 0xE3, 0x25, 0xE1, 0x21, 0xD0,
+0x41, 0x11, 0xF0, 0xA0, 0x80, 0xB0, 0x80, 0x70, 0x50, 0x05, 0x70, 0xC0, 0x09, 0x50, 0x80, 0x60,
+0x10, 0xA0, 0x50, 0x80, 0x70, 0x01, 0xA0, 0x02, 0x30, 0x50, 0x30, 0xA0, 0x80, 0x03, 0x70, 0x60,
+0x00, 0xC1, 0x70, 0xA0, 0x01, 0xA0, 0x50, 0x0F, 0x7A, 0x0F, 0x75, 0xC0, 0x30, 0x60, 0x80, 0x00,
+0x30, 0x80, 0x00, 0xC0, 0xA0, 0x00, 0x30, 0xA0, 0x60, 0x70, 0x01, 0xC0, 0x50, 0x60, 0x80, 0x70,
+0x51, 0x01, 0x30, 0x02, 0x30, 0x00, 0x50, 0x30, 0x60, 0x30, 0xB0, 0x40, 0x90, 0xE0, 0xD3, 0x40,
+0xD3, 0xE0, 0xD2, 0x40, 0xA0, 0x30, 0x81, 0x50, 0xA0, 0xB0, 0xE0, 0x40, 0xD1, 0xB2, 0x90, 0xE2,
+0x21, 0xE0, 0x22, 0xE0, 0x40, 0xD0, 0xE0, 0x2B, 0xE0, 0xD0, 0x40, 0x90, 0x60, 0x11, 0xF0, 0x40,
+0x90, 0x40, 0xB0, 0xA0, 0x61, 0x80, 0x02, 0xC0, 0x70, 0x04, 0x71, 0x30, 0x60, 0xF0, 0xA0, 0x50,
+0xC0, 0x30, 0x01, 0xC0, 0x30, 0x01, 0x80, 0x51, 0x30, 0xA0, 0x50, 0xC0, 0x02, 0x30, 0x80, 0x00,
+0x50, 0x30, 0x50, 0xA0, 0x80, 0x00, 0x60, 0xC0, 0x00, 0x50, 0x30, 0x0F, 0x7A, 0x0F, 0x74, 0x50,
+0x10, 0x50, 0x02, 0x60, 0xC0, 0x00, 0x50, 0x30, 0x70, 0x60, 0x00, 0xC0, 0xA0, 0x00, 0x80, 0x30,
+0x01, 0xC0, 0x50, 0xA1, 0x80, 0xC0, 0x30, 0x01, 0x70, 0x80, 0x01, 0x80, 0x70, 0x00, 0x50, 0x60,
+0xB0, 0xA1, 0xB0, 0x40, 0xE0, 0x90, 0xD4, 0xE2, 0xD1, 0x90, 0x40, 0xB0, 0x30, 0x90, 0xD0, 0x91,
+0xE1, 0xD1, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x40, 0xD0, 0xE0, 0x2B, 0xE0, 0xD0, 0x41,
+0xA0, 0xB0, 0x41, 0xD5, 0x40, 0x30, 0xA0, 0x10, 0xC0, 0x00, 0x70, 0x00, 0x50, 0x30, 0xA0, 0x61,
+0xF0, 0x50, 0xC0, 0x51, 0x01, 0x30, 0x02, 0xA0, 0xC0, 0x80, 0xA0, 0x30, 0x50, 0xC0, 0x04, 0x70,
+0xF0, 0xA0, 0x00, 0xC0, 0xF0, 0x30, 0xC0, 0xA0, 0x50, 0x80, 0x30, 0x00, 0x81, 0x0F, 0x7A, 0x0F,
+0x74, 0xC0, 0x80, 0x61, 0x50, 0xC0, 0xA0, 0x01, 0x60, 0x70, 0xA0, 0x70, 0x00, 0xC0, 0xA0, 0x00,
+0x80, 0xC0, 0x80, 0x04, 0x70, 0x31, 0xA0, 0x81, 0x70, 0x01, 0x30, 0x01, 0x70, 0x80, 0x01, 0x30,
+0x81, 0x60, 0xF0, 0xA1, 0xB0, 0x40, 0xE0, 0xD9, 0x20, 0x91, 0xE0, 0x21, 0xE0, 0x21, 0xE2, 0x23,
+0xE2, 0x40, 0xD0, 0xE0, 0x25, 0xE3, 0x20, 0xE2, 0x90, 0x20, 0xD9, 0x70, 0x40, 0xF0, 0x10, 0x30,
+0xF0, 0x10, 0xF0, 0x80, 0x30, 0x50, 0x01, 0x80, 0xC0, 0x01, 0x30, 0x01, 0x50, 0x81, 0xA0, 0x30,
+0x80, 0x70, 0x08, 0x80, 0xC0, 0xA0, 0x70, 0x00, 0x10, 0x70, 0x00, 0xC0, 0xA0, 0x00, 0xA0, 0xF0,
+0xA0, 0x0F, 0x7B, 0x0F, 0x77, 0xC0, 0x70, 0x00, 0x60, 0x70, 0x80, 0xA0, 0xC0, 0x60, 0x01, 0x81,
+0x00, 0x80, 0x30, 0xC0, 0x08, 0x70, 0x30, 0xA0, 0x30, 0x80, 0xA0, 0x01, 0x50, 0x70, 0x01, 0x30,
+0x01, 0x30, 0x10, 0x01, 0xA0, 0x80, 0x30, 0xA0, 0x60, 0xA0, 0x30, 0xB1, 0x40, 0x90, 0xE0, 0xD1,
+0x91, 0xD3, 0xE0, 0xD4, 0xE5, 0x40, 0xD0, 0xE5, 0xD8, 0x90, 0xE0, 0xD1, 0xE0, 0x90, 0x41, 0xB0,
+0x30, 0xA0, 0x60, 0xA0, 0x32, 0x00, 0xC0, 0x10, 0x80, 0x00, 0xC0, 0x80, 0x01, 0x80, 0x70, 0x01,
+0xA0, 0x80, 0x30, 0xA0, 0x80, 0xC0, 0x0E, 0x80, 0x30, 0x00, 0x50, 0xF0, 0xC0, 0x80, 0x30, 0x0F,
+0x7F, 0x0F, 0x7A, 0x70, 0xA1, 0x00, 0xC0, 0xA0, 0x01, 0x60, 0xC0, 0x0F, 0x00, 0xC0, 0x70, 0x80,
+0x31, 0x60, 0x80, 0x70, 0x00, 0xA0, 0x01, 0x60, 0xF0, 0x01, 0x30, 0x02, 0x30, 0x00, 0xC0, 0xA0,
+0x81, 0x30, 0x60, 0xA0, 0x30, 0xA0, 0x30, 0xB0, 0x81, 0x43, 0x91, 0xE0, 0x90, 0xE1, 0xD0, 0xE0,
+0xD0, 0x40, 0xD0, 0xE1, 0xD0, 0xE0, 0x92, 0x43, 0x81, 0xB1, 0xA3, 0x60, 0x30, 0x81, 0x30, 0xC0,
+0x00, 0xA0, 0x01, 0xC0, 0x80, 0x01, 0x10, 0xA0, 0x01, 0x30, 0x00, 0x70, 0x80, 0xA0, 0x31, 0x80,
+0x70, 0xC0, 0x0F, 0x02, 0xC0, 0xF0, 0x01, 0x50, 0xA0, 0x30, 0x0F, 0x80, 0x0F, 0x7F, 0x60, 0x50,
+0xA0, 0x80, 0x0F, 0x06, 0x70, 0x50, 0x80, 0x30, 0xF0, 0x80, 0x70, 0x10, 0xA0, 0x01, 0x30, 0x01,
+0x70, 0x80, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x30, 0x50, 0x70, 0x50, 0x60, 0x51, 0xA0, 0x30,
+0xB1, 0x60, 0x30, 0xA0, 0x60, 0xA1, 0x60, 0xF0, 0xA4, 0x30, 0x60, 0xB1, 0x31, 0x51, 0x60, 0x50,
+0x70, 0x81, 0x01, 0x30, 0x02, 0x30, 0x01, 0x30, 0x02, 0x30, 0x01, 0xF1, 0x70, 0x80, 0xF0, 0x81,
+0x70, 0xC0, 0x0F, 0x08, 0x60, 0x70, 0x0F, 0x84, 0x0F, 0x80, 0x80, 0x50, 0x0F, 0x0C, 0xC0, 0x50,
+0x80, 0x31, 0xA0, 0xF0, 0x50, 0xC0, 0x50, 0x70, 0x01, 0xA0, 0x01, 0x70, 0x80, 0x01, 0x30, 0xC0,
+0x00, 0xC0, 0x80, 0x01, 0x80, 0xC0, 0x01, 0xA0, 0x01, 0x80, 0xC0, 0x00, 0x70, 0x10, 0xC0, 0x00,
+0x70, 0x50, 0x01, 0x30, 0x01, 0x70, 0x50, 0x01, 0x30, 0x01, 0x70, 0x80, 0x01, 0x30, 0x02, 0xA0,
+0x01, 0x50, 0x71, 0x50, 0xF0, 0x32, 0x80, 0x50, 0xC0, 0x00, 0x70, 0xA0, 0x50, 0x00, 0x70, 0x31,
+0xC0, 0x0F, 0x9A, 0x0F, 0x9A, 0x50, 0x10, 0x70, 0x00, 0xC0, 0xA1, 0x70, 0x02, 0x70, 0x80, 0x33,
+0xF0, 0x80, 0x50, 0x81, 0x01, 0x30, 0x01, 0xC0, 0x80, 0x01, 0x80, 0x02, 0xA0, 0x01, 0x80, 0xC0,
+0x00, 0x50, 0x10, 0xC0, 0x00, 0x70, 0x50, 0x01, 0xA0, 0x01, 0x70, 0x50, 0x01, 0x80, 0x02, 0x80,
+0x01, 0x30, 0x51, 0x80, 0xF0, 0x31, 0xA0, 0x30, 0x80, 0x70, 0x02, 0x70, 0x50, 0x30, 0x50, 0x70,
+0x60, 0x00, 0x60, 0x50, 0x70, 0x80, 0x30, 0xC0, 0x0F, 0x9A, 0x0F, 0x99, 0x50, 0x30, 0xF0, 0x01,
+0x60, 0x50, 0x00, 0x60, 0xC0, 0x00, 0x31, 0xC0, 0x01, 0x50, 0xC0, 0x00, 0x70, 0x51, 0x80, 0x30,
+0xA0, 0x60, 0x30, 0x80, 0x31, 0x51, 0xA0, 0x50, 0x71, 0x60, 0xC1, 0x30, 0x70, 0x00, 0x80, 0x10,
+0x70, 0xC0, 0x50, 0x80, 0xC1, 0x60, 0xC0, 0x70, 0x80, 0x30, 0x51, 0xA0, 0x30, 0x80, 0x30, 0x60,
+0xA0, 0x30, 0x80, 0x51, 0x70, 0xC1, 0x03, 0x30, 0x50, 0x00, 0x30, 0xA0, 0x80, 0xF0, 0x70, 0x81,
+0x00, 0x70, 0xA0, 0x00, 0xC1, 0x0F, 0x9B, 0x0F, 0x9A, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x01, 0xA0,
+0xC0, 0x30, 0x80, 0x50, 0x60, 0x00, 0x80, 0x50, 0x80, 0x08, 0xC0, 0x73, 0x52, 0x83, 0x30, 0x82,
+0x30, 0x81, 0x30, 0x84, 0x53, 0x72, 0xC0, 0x0C, 0x50, 0x10, 0x80, 0x02, 0xC0, 0xF0, 0x00, 0x81,
+0x00, 0xC0, 0x60, 0x0F, 0x9E, 0x0F, 0x9A, 0x70, 0xA0, 0x01, 0x60, 0x70, 0xC0, 0x10, 0x50, 0x60,
+0x01, 0x60, 0xC0, 0x80, 0x30, 0x80, 0x0F, 0x09, 0x70, 0x03, 0x70, 0x02, 0x50, 0x70, 0x0F, 0x03,
+0x80, 0x50, 0xA0, 0x02, 0x81, 0x00, 0x70, 0xA0, 0x01, 0x60, 0xC0, 0x0F, 0x9D, 0x0F, 0x9A, 0x81,
+0x01, 0xC0, 0x31, 0x60, 0x50, 0x30, 0x01, 0x60, 0xC0, 0x0F, 0x06, 0x70, 0x10, 0xC0, 0x00, 0x50,
+0xF0, 0x30, 0xF0, 0x00, 0xC0, 0xF0, 0x30, 0xF0, 0xC0, 0x51, 0x80, 0x70, 0x0F, 0x04, 0xF0, 0x02,
+0x60, 0x70, 0x01, 0xF0, 0x01, 0x60, 0x0F, 0x9E, 0x0F, 0x9A, 0xA0, 0x50, 0x00, 0x50, 0x30, 0x00,
+0x50, 0x30, 0x50, 0x80, 0x00, 0xC0, 0x60, 0x0F, 0x06, 0x70, 0xA0, 0xF0, 0xC0, 0x00, 0x30, 0x50,
+0x00, 0x60, 0xC0, 0x30, 0x80, 0x00, 0x81, 0xC0, 0x31, 0x0F, 0x05, 0xF0, 0x02, 0xF0, 0xC0, 0x01,
+0x50, 0x61, 0x50, 0x0F, 0x9E, 0x0F, 0x9A, 0x70, 0x02, 0xA0, 0x60, 0xA0, 0x00, 0x50, 0x30, 0x00,
+0x80, 0x30, 0x0F, 0x06, 0xC0, 0x00, 0xA0, 0xC0, 0x00, 0x70, 0xF0, 0xA1, 0x00, 0xA0, 0x70, 0x00,
+0x50, 0xA0, 0x00, 0xC0, 0x0F, 0x06, 0x60, 0x70, 0x01, 0xF0, 0xC0, 0x02, 0xC1, 0x0F, 0x9F, 0x0F,
+0xA3, 0xA0, 0xF1, 0x0F, 0x09, 0xA0, 0xC0, 0x00, 0x31, 0xC0, 0xF0, 0xC0, 0xA0, 0x70, 0x00, 0x50,
+0xA0, 0x0F, 0x08, 0x50, 0xC0, 0x01, 0xC0, 0x0F, 0xA5, 0x0F, 0xBF, 0x60, 0xC0, 0x00, 0x60, 0x01,
+0x81, 0x30, 0x50, 0x00, 0x81, 0x0F, 0xC2, 0x0F, 0xBF, 0x60, 0x70, 0x00, 0x30, 0xA0, 0x50, 0xF0,
+0x71, 0xF0, 0x50, 0x60, 0x70, 0x0F, 0xC2, 0x0F, 0xBF, 0x70, 0x02, 0x50, 0x80, 0x70, 0x01, 0x70,
+0x80, 0x70, 0x0F, 0xC3, 0x0F, 0xFF, 0x0F, 0x8F};
+
+const Map_Image JM29_16000_image = {430, 431, JM29_16000_palette, JM29_16000_rows, JM29_16000_data};
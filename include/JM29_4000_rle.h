@@ -0,0 +1,3084 @@
+// Generated by maps/compress_map.py from JM29_4000.h, do not edit
+// Image Size : 431x432 pixels, 48502 bytes compressed from 372384
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t JM29_4000_palette[16] PROGMEM = {
+0xFFFF, 0x0021, 0x867C, 0x5B2C, 0xA534, 0xCE9A, 0x6D16, 0x29C7,
+0x6BEF, 0xB5D7, 0x426A, 0xE75C, 0x85D9, 0x1904, 0x8C92, 0x967C};
+
+const uint32_t JM29_4000_rows[432] PROGMEM = {
+0, 4, 8, 18, 31, 48, 72, 107, 143, 180, 228, 299,
+370, 440, 521, 605, 680, 762, 851, 934, 1015, 1084, 1156, 1227,
+1291, 1353, 1417, 1484, 1556, 1634, 1712, 1791, 1876, 1973, 2080, 2194,
+2319, 2447, 2548, 2646, 2734, 2818, 2897, 2988, 3071, 3149, 3232, 3326,
+3417, 3508, 3600, 3698, 3798, 3912, 4029, 4146, 4268, 4389, 4514, 4631,
+4737, 4834, 4933, 5030, 5130, 5232, 5338, 5453, 5579, 5692, 5801, 5912,
+6030, 6135, 6239, 6352, 6471, 6596, 6719, 6847, 6977, 7113, 7251, 7381,
+7517, 7653, 7779, 7912, 8046, 8176, 8295, 8406, 8504, 8621, 8752, 8891,
+9018, 9136, 9248, 9353, 9465, 9583, 9718, 9857, 9986, 10109, 10250, 10398,
+10542, 10683, 10828, 10977, 11115, 11257, 11392, 11530, 11663, 11801, 11931, 12061,
+12193, 12307, 12437, 12575, 12713, 12852, 12995, 13153, 13309, 13457, 13603, 13756,
+13908, 14045, 14183, 14318, 14458, 14604, 14739, 14877, 15015, 15153, 15296, 15453,
+15599, 15743, 15885, 16018, 16159, 16313, 16460, 16601, 16748, 16895, 17041, 17183,
+17330, 17469, 17605, 17755, 17903, 18052, 18203, 18346, 18479, 18615, 18765, 18911,
+19052, 19203, 19351, 19495, 19642, 19796, 19939, 20077, 20226, 20367, 20509, 20654,
+20796, 20939, 21078, 21223, 21376, 21510, 21635, 21762, 21886, 22001, 22124, 22245,
+22372, 22500, 22639, 22778, 22936, 23078, 23216, 23357, 23481, 23608, 23742, 23868,
+24007, 24137, 24272, 24408, 24523, 24659, 24788, 24913, 25036, 25156, 25294, 25437,
+25578, 25733, 25860, 25994, 26135, 26262, 26392, 26514, 26626, 26736, 26859, 26987,
+27124, 27266, 27420, 27543, 27655, 27760, 27849, 27958, 28061, 28161, 28265, 28360,
+28457, 28560, 28662, 28778, 28898, 29034, 29166, 29300, 29445, 29591, 29722, 29830,
+29954, 30077, 30199, 30317, 30448, 30582, 30717, 30841, 30964, 31097, 31230, 31357,
+31490, 31628, 31749, 31870, 31989, 32106, 32217, 32329, 32437, 32544, 32658, 32779,
+32894, 33013, 33130, 33240, 33346, 33462, 33589, 33714, 33845, 33966, 34088, 34199,
+34320, 34442, 34558, 34688, 34823, 34951, 35083, 35200, 35311, 35433, 35550, 35672,
+35789, 35900, 36014, 36120, 36240, 36372, 36490, 36607, 36732, 36846, 36957, 37062,
+37179, 37286, 37409, 37534, 37667, 37791, 37908, 38031, 38151, 38273, 38387, 38502,
+38624, 38739, 38856, 38968, 39076, 39183, 39294, 39397, 39493, 39593, 39695, 39793,
+39885, 39975, 40069, 40152, 40243, 40352, 40464, 40567, 40674, 40791, 40916, 41030,
+41143, 41259, 41376, 41491, 41608, 41717, 41834, 41943, 42054, 42167, 42260, 42358,
+42469, 42589, 42720, 42847, 42957, 43061, 43154, 43248, 43340, 43434, 43525, 43620,
+43713, 43812, 43942, 44064, 44177, 44289, 44396, 44517, 44635, 44744, 44846, 44931,
+45013, 45098, 45186, 45278, 45374, 45468, 45567, 45659, 45745, 45831, 45920, 46013,
+46107, 46205, 46310, 46404, 46506, 46601, 46689, 46766, 46835, 46916, 46993, 47065,
+47142, 47219, 47305, 47387, 47485, 47588, 47692, 47790, 47872, 47949, 48032, 48109,
+48186, 48237, 48280, 48328, 48374, 48415, 48444, 48461, 48477, 48490, 48494, 48498};
+
+const uint8_t JM29_4000_data[48502] PROGMEM = {
+0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xC6, 0xB0, 0xE0, 0x90, 0x01, 0x40, 0xE0,
+0x0F, 0xC2, 0x0F, 0xC5, 0xB0, 0xD0, 0xE0, 0x70, 0x90, 0x50, 0xE0, 0x50, 0xE0, 0x0F, 0xC1, 0x0F,
+0xAB, 0x31, 0x40, 0x0F, 0x07, 0xE0, 0x80, 0x00, 0x50, 0x70, 0x00, 0x80, 0x30, 0xB0, 0x0F, 0xC1,
+0x0F, 0xA2, 0x90, 0xE1, 0x00, 0x50, 0x70, 0xD0, 0xE0, 0x00, 0x30, 0x90, 0xE0, 0x0F, 0x07, 0x80,
+0xE0, 0x01, 0xD0, 0x0F, 0x10, 0xE0, 0x0F, 0xA4, 0x0F, 0x9D, 0xB0, 0x50, 0x01, 0x30, 0xA0, 0x80,
+0x50, 0x00, 0xA0, 0x90, 0x00, 0xD0, 0xB1, 0x90, 0x0F, 0x08, 0x80, 0xE0, 0x01, 0xD0, 0x0F, 0x0E,
+0x90, 0x70, 0xD0, 0x01, 0xB0, 0x80, 0xE0, 0x02, 0xB0, 0x0F, 0x9B, 0x0F, 0x9C, 0x80, 0x71, 0x30,
+0x00, 0xA0, 0xB0, 0x02, 0x70, 0xB0, 0x00, 0x80, 0xE0, 0x0F, 0x0A, 0x40, 0x80, 0x00, 0x50, 0x70,
+0x0F, 0x0E, 0x41, 0xA0, 0x01, 0xD0, 0xE0, 0x30, 0x80, 0x00, 0x30, 0x80, 0x40, 0x0F, 0x9A, 0x0F,
+0x9B, 0xB0, 0x70, 0x01, 0xD0, 0x00, 0x70, 0xD0, 0xA0, 0x10, 0xB0, 0x70, 0x50, 0x00, 0x90, 0xA0,
+0x0F, 0x0B, 0x70, 0x80, 0xD0, 0xB0, 0x0F, 0x0F, 0xE1, 0x00, 0x90, 0x70, 0x01, 0x70, 0x00, 0x30,
+0xE0, 0x40, 0x0F, 0x9A, 0x0F, 0x9D, 0xB0, 0xD0, 0xA0, 0x00, 0x90, 0x01, 0x90, 0xA0, 0x80, 0xE0,
+0x00, 0x50, 0xA0, 0x0B, 0xB0, 0x52, 0x92, 0x40, 0xE2, 0x82, 0xE0, 0x80, 0x70, 0x30, 0xE0, 0x83,
+0xE1, 0x41, 0x92, 0x50, 0xB2, 0x0F, 0x00, 0xA0, 0x90, 0x00, 0x80, 0xE0, 0x00, 0xB0, 0x70, 0x00,
+0xB0, 0x50, 0x0F, 0x9B, 0x0F, 0x9E, 0x50, 0x31, 0xB1, 0x00, 0x50, 0xA0, 0x50, 0x70, 0xB0, 0x80,
+0xE0, 0x01, 0xB2, 0x50, 0x40, 0xE0, 0x80, 0x30, 0x70, 0xA0, 0x81, 0x70, 0xE0, 0x40, 0x80, 0x30,
+0x90, 0x50, 0x70, 0xB0, 0x50, 0x90, 0x30, 0xB0, 0x50, 0x10, 0x30, 0xB0, 0x50, 0x30, 0xB0, 0x50,
+0x80, 0xE0, 0x91, 0x70, 0x41, 0x30, 0xA0, 0x80, 0x30, 0xA1, 0x30, 0x80, 0xE0, 0x90, 0x50, 0xB1,
+0x06, 0x70, 0xB0, 0x00, 0x30, 0x90, 0x00, 0x50, 0xA0, 0x0F, 0x9E, 0x0F, 0x88, 0xB0, 0x0F, 0x03,
+0xB1, 0x00, 0xB0, 0x70, 0x50, 0xD0, 0xE0, 0xD0, 0x50, 0x00, 0x90, 0xD1, 0x80, 0x31, 0x80, 0x70,
+0x30, 0xE0, 0x90, 0x70, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x50, 0xE0, 0x01, 0xA0, 0x01, 0xB0,
+0x80, 0x01, 0x10, 0x30, 0x01, 0x80, 0x01, 0xE0, 0x50, 0x01, 0x30, 0x01, 0x91, 0x01, 0x30, 0x01,
+0x50, 0xA0, 0x40, 0xE0, 0x70, 0x33, 0xE0, 0x90, 0x01, 0xD0, 0x01, 0x30, 0x90, 0x00, 0x30, 0xE0,
+0x0F, 0x9E, 0x0F, 0x87, 0x30, 0x80, 0xE0, 0x0F, 0x02, 0x90, 0x10, 0x90, 0xA0, 0x90, 0x00, 0x40,
+0x70, 0x30, 0x80, 0x30, 0xD0, 0xE0, 0x51, 0x80, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x90, 0x40,
+0x01, 0x30, 0x02, 0x80, 0x01, 0x30, 0x01, 0xB0, 0xE0, 0x01, 0x10, 0x30, 0x01, 0x80, 0x01, 0xE0,
+0xB0, 0x01, 0xA0, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x50, 0xE0, 0x01, 0x30, 0x01, 0xB0, 0x80,
+0xB0, 0x40, 0x71, 0x83, 0xD0, 0xA1, 0x0F, 0x9F, 0x0F, 0x83, 0x40, 0xA0, 0x90, 0x00, 0x80, 0x41,
+0x0F, 0x02, 0xB0, 0xE0, 0x70, 0xA0, 0xD0, 0x80, 0x90, 0xA0, 0x10, 0x01, 0xE0, 0x50, 0x01, 0x30,
+0x01, 0x91, 0x01, 0x30, 0x01, 0x90, 0x80, 0x50, 0x90, 0x70, 0x41, 0xE0, 0x70, 0x81, 0x70, 0x30,
+0xA1, 0x70, 0xA1, 0xD0, 0x70, 0xA1, 0x70, 0xA0, 0x30, 0x70, 0x30, 0x80, 0xE0, 0x70, 0x41, 0xA0,
+0xE0, 0x51, 0x30, 0x01, 0x91, 0x01, 0xA0, 0x01, 0x50, 0xE0, 0x01, 0xE0, 0xB0, 0x00, 0xE0, 0x10,
+0x40, 0xE0, 0xD0, 0xA0, 0xE0, 0x40, 0x50, 0x0F, 0x9C, 0x0F, 0x82, 0x90, 0xA0, 0x50, 0xD0, 0x90,
+0xB0, 0x90, 0x0E, 0xB0, 0x40, 0x30, 0xA0, 0x30, 0xA0, 0x50, 0x00, 0x30, 0x01, 0x40, 0x10, 0xB0,
+0x00, 0x90, 0x40, 0x01, 0x30, 0x00, 0xB0, 0x40, 0x30, 0x40, 0x80, 0x70, 0xA3, 0x81, 0x65, 0xC1,
+0x20, 0xC0, 0xF1, 0x20, 0xF0, 0xC1, 0xF2, 0x21, 0xC2, 0x64, 0x82, 0x70, 0x30, 0xA0, 0x70, 0x30,
+0xE0, 0x40, 0xA0, 0xB0, 0x00, 0x41, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0xE0, 0x50, 0xB0, 0x90,
+0xD0, 0x30, 0xA0, 0xE0, 0x90, 0xB0, 0x0F, 0x04, 0x40, 0x80, 0x50, 0x0F, 0x80, 0x0F, 0x7F, 0x81,
+0x00, 0x80, 0x40, 0x00, 0x50, 0x70, 0x0D, 0xE0, 0x31, 0xE0, 0xA0, 0xB0, 0x01, 0x30, 0x01, 0x40,
+0x90, 0x00, 0xB0, 0x10, 0x90, 0x00, 0x90, 0xA0, 0x80, 0xA0, 0x70, 0xA0, 0x30, 0x81, 0x60, 0xC0,
+0xF3, 0x60, 0xF4, 0x20, 0xF0, 0x28, 0xC1, 0x2B, 0xF3, 0xC0, 0xF2, 0xC0, 0x61, 0x80, 0x30, 0xA0,
+0x70, 0xA0, 0x30, 0xE0, 0x70, 0x01, 0xD1, 0x01, 0x30, 0x02, 0x30, 0x01, 0x82, 0x31, 0x90, 0x0F,
+0x00, 0x40, 0x70, 0x90, 0xD0, 0x50, 0x0F, 0x7F, 0x0F, 0x7A, 0xB0, 0x50, 0x02, 0x70, 0xD0, 0x00,
+0x40, 0x30, 0x01, 0x70, 0x50, 0x07, 0x50, 0xE0, 0x30, 0xA0, 0x30, 0x40, 0x80, 0x01, 0xE0, 0x50,
+0x01, 0x30, 0x01, 0xB0, 0xA0, 0x40, 0x80, 0x10, 0x71, 0x30, 0x60, 0xC0, 0xF7, 0x22, 0xF0, 0x60,
+0xF0, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0xF0, 0x60, 0x21, 0xF0, 0x60, 0x80, 0xF6, 0x61, 0xA0, 0x70,
+0xD0, 0x70, 0x80, 0x90, 0xA0, 0x01, 0x40, 0x90, 0x01, 0xA0, 0x02, 0xA0, 0x40, 0xA0, 0x30, 0x80,
+0x90, 0x0E, 0x40, 0x30, 0x00, 0xA0, 0x70, 0x90, 0x0F, 0x7B, 0x0F, 0x79, 0x30, 0xA0, 0x70, 0xE0,
+0x00, 0x50, 0x80, 0xA0, 0x50, 0xB0, 0xD0, 0x01, 0x80, 0xE0, 0x04, 0x90, 0x80, 0x70, 0x80, 0x50,
+0x80, 0x50, 0x01, 0xA0, 0x01, 0x50, 0xE0, 0x00, 0x50, 0xA0, 0x80, 0xA1, 0x30, 0x60, 0xC1, 0xF2,
+0x2D, 0x60, 0xF0, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0xC0, 0x60, 0xF0, 0x21, 0x60, 0xA0, 0x26, 0xF3,
+0x60, 0xC1, 0x80, 0xA0, 0x70, 0x30, 0x70, 0x40, 0xB0, 0x00, 0x30, 0x01, 0x50, 0xE0, 0x01, 0x30,
+0x50, 0x40, 0xA1, 0xE0, 0x50, 0x09, 0x50, 0x10, 0x50, 0xA0, 0x40, 0x00, 0x70, 0xB0, 0x00, 0x40,
+0xB0, 0x0F, 0x77, 0x0F, 0x78, 0xB0, 0xD0, 0x00, 0x50, 0xA0, 0x00, 0x41, 0x90, 0xA0, 0x50, 0x81,
+0x00, 0x30, 0x90, 0x01, 0x90, 0x30, 0xA0, 0x40, 0x90, 0x30, 0x01, 0x41, 0x01, 0x80, 0x51, 0x30,
+0xD0, 0x31, 0x60, 0xC1, 0xF3, 0xC1, 0x2F, 0x00, 0x60, 0x2E, 0xF0, 0x60, 0x2F, 0x00, 0xC1, 0x22,
+0xF1, 0x29, 0xF0, 0x60, 0xF4, 0xC0, 0x60, 0x80, 0x30, 0x71, 0x90, 0xB0, 0x80, 0xB0, 0x01, 0x30,
+0x01, 0xB0, 0x80, 0x50, 0x80, 0xA0, 0xE0, 0x50, 0x04, 0xE0, 0x71, 0xB0, 0x50, 0x70, 0x01, 0xA0,
+0x50, 0x80, 0x50, 0x80, 0x0F, 0x77, 0x0F, 0x79, 0x50, 0xB0, 0xD1, 0x00, 0x31, 0x70, 0x10, 0x40,
+0x00, 0xA0, 0x70, 0x30, 0x40, 0xA0, 0x30, 0x40, 0xE0, 0x90, 0x01, 0x30, 0x02, 0x30, 0xB0, 0x80,
+0xD0, 0x11, 0xD0, 0x60, 0xF4, 0x23, 0xF0, 0x60, 0xF0, 0x2E, 0x60, 0x2E, 0xF0, 0x60, 0x2F, 0x00,
+0xC1, 0xF0, 0x2E, 0x60, 0xF0, 0x25, 0xF2, 0xC0, 0x80, 0xA0, 0xD0, 0x30, 0x90, 0x50, 0xE0, 0x01,
+0xE0, 0x90, 0x01, 0x30, 0x40, 0xE0, 0x31, 0x50, 0x00, 0x10, 0x30, 0xB0, 0x01, 0x30, 0xE0, 0x01,
+0xD0, 0x00, 0xE0, 0x30, 0x80, 0x0F, 0x77, 0x0F, 0x7A, 0xB1, 0x50, 0xD0, 0x81, 0x00, 0x30, 0x90,
+0x00, 0x40, 0x81, 0x90, 0xA0, 0x01, 0xB0, 0x30, 0x01, 0x90, 0x30, 0x80, 0x10, 0xD2, 0x50, 0x00,
+0x70, 0x60, 0xF0, 0x29, 0x60, 0x2F, 0x00, 0x60, 0xC0, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xC0,
+0x2E, 0xC1, 0x2A, 0xF3, 0x80, 0x70, 0xA0, 0x30, 0x90, 0x30, 0x02, 0x30, 0x01, 0x40, 0xE1, 0xA0,
+0xD0, 0x10, 0xA0, 0x40, 0x00, 0x70, 0xB0, 0x00, 0x40, 0x30, 0x0F, 0x7B, 0x0F, 0x7A, 0xB0, 0x01,
+0xD0, 0x02, 0x90, 0x31, 0xE0, 0x80, 0x01, 0x80, 0xB0, 0x01, 0xA0, 0x90, 0xA0, 0x70, 0xA0, 0x90,
+0x00, 0x50, 0xB0, 0x70, 0x30, 0x70, 0x10, 0xC0, 0x29, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xC0, 0x2D,
+0xF0, 0x60, 0x2F, 0x00, 0x60, 0xF0, 0x2E, 0xC0, 0x26, 0xF0, 0x27, 0xF0, 0x60, 0xF0, 0xC0, 0x60,
+0xA1, 0x40, 0x80, 0x50, 0x01, 0x80, 0xB0, 0x01, 0xA0, 0xE0, 0xA0, 0x70, 0x00, 0x30, 0x40, 0x00,
+0xD0, 0x50, 0x0F, 0x7B, 0x0F, 0x7A, 0x70, 0x81, 0x30, 0xB0, 0x80, 0x30, 0x10, 0x80, 0x01, 0xA0,
+0x01, 0xB0, 0x30, 0x40, 0xA0, 0x70, 0xD0, 0x10, 0x90, 0x02, 0xB0, 0x50, 0x30, 0x80, 0x10, 0x60,
+0xF0, 0x26, 0xF0, 0x21, 0xF0, 0x60, 0x20, 0xF0, 0x2D, 0xC1, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60,
+0xF0, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0xF0, 0x60, 0x21, 0xF1, 0xC0, 0x60, 0xA1, 0xE0, 0xB0, 0xA0,
+0x01, 0x50, 0x80, 0x01, 0x10, 0xD0, 0xA0, 0xD1, 0x50, 0x0F, 0x7C, 0x0F, 0x7B, 0xE0, 0x70, 0xA0,
+0x70, 0x50, 0x00, 0x10, 0xD0, 0x01, 0x80, 0xB0, 0x80, 0x70, 0x10, 0x41, 0x01, 0xE0, 0x10, 0x30,
+0x02, 0x90, 0x00, 0xA0, 0x60, 0x2A, 0xF1, 0xC1, 0x2E, 0xC1, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60,
+0xF0, 0x2D, 0xF0, 0x60, 0xF0, 0x2E, 0xC0, 0x60, 0x25, 0xF1, 0x60, 0x30, 0x70, 0x30, 0x50, 0x30,
+0x01, 0x50, 0x10, 0x40, 0x00, 0x40, 0x70, 0x30, 0x50, 0x0F, 0x7B, 0x0F, 0x79, 0x50, 0x31, 0x50,
+0x00, 0x30, 0x01, 0x40, 0x10, 0x90, 0x40, 0xD1, 0xE0, 0x01, 0xD0, 0x10, 0x02, 0x50, 0x10, 0x02,
+0x90, 0x70, 0xA0, 0xF1, 0x2C, 0x60, 0xF0, 0x2D, 0xC1, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xF0,
+0x2D, 0xF0, 0x60, 0xF0, 0x2E, 0x60, 0xC0, 0x28, 0xF1, 0xC0, 0x30, 0xD0, 0x80, 0xB0, 0xA0, 0x10,
+0x01, 0x90, 0x40, 0x00, 0xE0, 0x70, 0x80, 0x0F, 0x79, 0x0F, 0x77, 0x40, 0xA0, 0xE0, 0x40, 0xE0,
+0x01, 0x40, 0x90, 0x00, 0xE0, 0x10, 0x70, 0x80, 0x03, 0xB0, 0xD0, 0x10, 0xD0, 0x40, 0x80, 0x10,
+0x30, 0x80, 0x01, 0xB0, 0x70, 0x10, 0xC0, 0xF0, 0x2C, 0x60, 0xF0, 0x2D, 0xC1, 0x2D, 0xF0, 0x60,
+0x2F, 0x00, 0x60, 0xF0, 0x2E, 0x60, 0x2E, 0xF0, 0x60, 0x2C, 0xF1, 0xC0, 0x30, 0xD1, 0xB0, 0x00,
+0x30, 0x02, 0x30, 0x50, 0xA0, 0x80, 0x50, 0x0F, 0x76, 0x0F, 0x65, 0x80, 0x30, 0xB0, 0x0B, 0xB0,
+0xE0, 0x30, 0x70, 0xB0, 0x01, 0xA0, 0x01, 0x90, 0xD0, 0x70, 0x30, 0x90, 0x50, 0x02, 0x30, 0xD1,
+0x70, 0x40, 0x90, 0x80, 0x30, 0x10, 0x50, 0xA0, 0x02, 0x70, 0xD0, 0xC0, 0x2D, 0x60, 0xF0, 0x2D,
+0xC0, 0x60, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xF0, 0x2D, 0xC1, 0x2E, 0xF0, 0x60, 0x2D, 0xF2,
+0x61, 0xA1, 0x30, 0x01, 0x90, 0x40, 0x01, 0x80, 0xA1, 0x90, 0x0F, 0x74, 0x0F, 0x64, 0xB0, 0x80,
+0x50, 0x40, 0x09, 0x50, 0xA0, 0x70, 0x50, 0x00, 0x50, 0xE0, 0x01, 0x40, 0xA0, 0xD0, 0x70, 0x40,
+0x02, 0x40, 0x03, 0xE0, 0x10, 0x80, 0x90, 0x50, 0x00, 0x90, 0x80, 0x50, 0xA0, 0x02, 0xE0, 0xA0,
+0xC0, 0x2C, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0x2D, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xF0, 0x2D, 0xC1,
+0x2D, 0xF0, 0xC1, 0xF0, 0x2E, 0xC1, 0xF1, 0xC0, 0x80, 0xA0, 0x80, 0xA0, 0x02, 0xA0, 0x01, 0x80,
+0x70, 0xE0, 0x0F, 0x72, 0x0F, 0x61, 0x40, 0xD0, 0x70, 0x00, 0xE0, 0x80, 0xB0, 0x07, 0x90, 0x31,
+0x00, 0xA0, 0x02, 0xA0, 0xB0, 0x30, 0xD0, 0x80, 0x05, 0x90, 0xB0, 0x01, 0xA0, 0x40, 0xB0, 0x70,
+0xD0, 0x71, 0xA0, 0xF0, 0xE1, 0x02, 0xA0, 0x60, 0xF0, 0x2D, 0x60, 0xC0, 0x2D, 0xF0, 0x60, 0x2D,
+0xF0, 0x60, 0x2E, 0xC1, 0xF0, 0x2C, 0xF0, 0x60, 0xF0, 0x28, 0xF0, 0x23, 0xF0, 0x60, 0x2F, 0x00,
+0xF0, 0x60, 0x20, 0xF0, 0x20, 0xF2, 0xC0, 0xA1, 0x90, 0x40, 0x90, 0x01, 0xE0, 0x51, 0xA0, 0x80,
+0x0F, 0x70, 0x0F, 0x61, 0xD0, 0x00, 0x90, 0x10, 0x08, 0x90, 0x30, 0x80, 0x30, 0x01, 0x50, 0xE0,
+0x00, 0x90, 0xD0, 0xA0, 0x90, 0x08, 0x90, 0x01, 0x50, 0x11, 0x70, 0x10, 0x30, 0xA0, 0xC0, 0xF0,
+0x30, 0x50, 0x00, 0x40, 0xB0, 0x70, 0xC0, 0x2E, 0xC1, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2E,
+0xC1, 0xF0, 0x2D, 0x60, 0xF0, 0x2D, 0xF0, 0x60, 0xF0, 0x2D, 0xF1, 0x60, 0x25, 0xF1, 0xC0, 0x80,
+0xD0, 0xE0, 0x50, 0x00, 0xA0, 0x02, 0x70, 0x30, 0x80, 0xB0, 0x0A, 0xB0, 0x80, 0xE0, 0x0F, 0x5F,
+0x0F, 0x60, 0xB0, 0x70, 0x01, 0x81, 0x05, 0x90, 0x70, 0xE0, 0x01, 0xA0, 0x02, 0xD0, 0x70, 0xA0,
+0x50, 0x0A, 0x40, 0x02, 0x50, 0x40, 0x00, 0xB1, 0x90, 0x70, 0xF0, 0x90, 0x30, 0x00, 0xD0, 0x90,
+0xA0, 0x60, 0xF0, 0x2E, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2E, 0xC1, 0xF0, 0x2D, 0x60,
+0xF0, 0x26, 0xF0, 0x20, 0xC0, 0xF1, 0x22, 0x60, 0xF0, 0x2E, 0xC1, 0x27, 0xF0, 0x31, 0x70, 0xA0,
+0x70, 0x80, 0x01, 0xE0, 0x90, 0x00, 0x50, 0x70, 0x80, 0xB0, 0x08, 0xE1, 0x81, 0x0F, 0x5E, 0x0F,
+0x5D, 0xA0, 0xD0, 0x30, 0x00, 0xD0, 0x50, 0x01, 0x10, 0x03, 0x90, 0xA0, 0xE0, 0x90, 0xE0, 0x01,
+0x50, 0xE0, 0x80, 0x10, 0xE0, 0xB0, 0x0C, 0x90, 0xB0, 0x07, 0x90, 0x70, 0x50, 0x60, 0x70, 0x10,
+0xF0, 0x30, 0x60, 0xF0, 0x2E, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2E, 0xC1, 0xF0, 0x2D,
+0x60, 0x24, 0xF2, 0x60, 0xD0, 0xA0, 0x80, 0xA0, 0x60, 0xF0, 0xC1, 0x2E, 0xF0, 0x60, 0x29, 0xA0,
+0x70, 0x30, 0x00, 0x50, 0xA0, 0x70, 0x90, 0x30, 0x02, 0x30, 0xB0, 0x31, 0xB0, 0x08, 0xB0, 0x70,
+0x01, 0xB0, 0x0F, 0x5B, 0x0F, 0x5C, 0x30, 0x40, 0x00, 0x70, 0xB0, 0x90, 0x70, 0x01, 0xA0, 0x50,
+0x00, 0x90, 0xA0, 0x70, 0xB0, 0x01, 0x30, 0x01, 0xA0, 0x10, 0xE0, 0x06, 0x10, 0xB0, 0x07, 0x40,
+0x08, 0x90, 0x70, 0xC0, 0xB0, 0xC0, 0x70, 0xF0, 0x60, 0xC0, 0x2E, 0x60, 0x2E, 0xC1, 0xF0, 0x2B,
+0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0xC1, 0xF0, 0x21, 0xF1, 0x10, 0x80, 0xF0, 0x81, 0xE0,
+0x10, 0xB0, 0xA0, 0xD0, 0x70, 0x80, 0xF0, 0x2E, 0x60, 0x29, 0xF2, 0xD0, 0x50, 0x00, 0xB0, 0x10,
+0xA0, 0x90, 0x00, 0xE0, 0x90, 0x01, 0xE0, 0x70, 0x30, 0xB0, 0x04, 0xB0, 0x10, 0xD0, 0x90, 0x50,
+0x10, 0x70, 0xA0, 0x0F, 0x5A, 0x0F, 0x58, 0x50, 0xA0, 0x30, 0x00, 0xE0, 0x51, 0x10, 0xA0, 0xB0,
+0x80, 0xA0, 0x90, 0x70, 0x90, 0xA0, 0xE0, 0x00, 0x50, 0x80, 0x01, 0x40, 0x10, 0xD0, 0x90, 0xB0,
+0x50, 0x05, 0x90, 0x10, 0x08, 0x40, 0x09, 0x90, 0x70, 0x10, 0x60, 0xF1, 0xC1, 0x2E, 0x60, 0xC0,
+0x2D, 0xC1, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0xC0, 0x21, 0xF0, 0x61, 0xA0,
+0x10, 0xD0, 0x70, 0xA0, 0xE0, 0xD0, 0x10, 0xB0, 0x01, 0x90, 0x30, 0x80, 0xF4, 0x27, 0xF0, 0x60,
+0x2C, 0xF0, 0x60, 0xE0, 0x00, 0x50, 0x80, 0x90, 0x30, 0xA0, 0x70, 0x01, 0xB0, 0x30, 0x00, 0xB0,
+0xA0, 0x80, 0xB0, 0x00, 0x30, 0x90, 0x00, 0x40, 0x30, 0x00, 0x10, 0x01, 0x30, 0x90, 0x0F, 0x59,
+0x0F, 0x58, 0xD0, 0xB0, 0x81, 0x01, 0x51, 0x40, 0x70, 0x00, 0x90, 0xA1, 0xE0, 0x30, 0x02, 0x80,
+0x50, 0xA0, 0x70, 0x90, 0x02, 0x40, 0x05, 0xA0, 0x10, 0x90, 0x07, 0x51, 0x05, 0x50, 0xE0, 0xD0,
+0x10, 0x80, 0x60, 0x21, 0xF1, 0x60, 0x2E, 0xC1, 0x24, 0xF0, 0x27, 0xC1, 0xF0, 0x2B, 0xF0, 0x60,
+0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x20, 0xF1, 0x60, 0xA0, 0xD0, 0x80, 0x70, 0xA0, 0x70, 0xE0,
+0x50, 0x10, 0x40, 0x01, 0x90, 0xA0, 0xF1, 0x80, 0xA0, 0x80, 0x60, 0xF0, 0x22, 0xF4, 0x60, 0xF0,
+0x22, 0xF0, 0x28, 0xF0, 0x70, 0x00, 0x50, 0x80, 0x50, 0xF0, 0xC0, 0x80, 0xA0, 0x90, 0xE0, 0x50,
+0x01, 0xE1, 0x30, 0x40, 0x30, 0xE0, 0x00, 0xE0, 0x31, 0xE0, 0x01, 0x70, 0xB0, 0x90, 0x30, 0x50,
+0x0F, 0x56, 0x0F, 0x57, 0x50, 0x70, 0x00, 0xE0, 0xA0, 0xB0, 0x03, 0xD0, 0x00, 0x80, 0x70, 0xB0,
+0x00, 0xB0, 0x30, 0x01, 0x70, 0x10, 0x90, 0x04, 0x51, 0x01, 0x50, 0x90, 0xE0, 0x30, 0x70, 0x80,
+0x01, 0x40, 0x05, 0x40, 0x03, 0x30, 0xD0, 0x70, 0xD0, 0xC0, 0xF2, 0x22, 0xF0, 0x60, 0x2E, 0xC1,
+0xF0, 0x21, 0xF0, 0x20, 0x70, 0x60, 0x26, 0xC1, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2D,
+0xF0, 0x60, 0xF1, 0xD0, 0xA0, 0x70, 0x10, 0x40, 0xA0, 0x90, 0x70, 0xE0, 0x00, 0x30, 0xE0, 0x32,
+0xC0, 0xF1, 0xA0, 0xD0, 0x30, 0x70, 0xF1, 0xC1, 0x70, 0xA0, 0x70, 0xA0, 0x80, 0x60, 0xF2, 0x22,
+0xF1, 0x25, 0xF0, 0xA0, 0xB0, 0x90, 0xA0, 0x70, 0xA0, 0xF0, 0x50, 0xA1, 0x10, 0xE0, 0x01, 0xA0,
+0x01, 0x40, 0xD1, 0x71, 0x50, 0x70, 0x01, 0x90, 0x70, 0x00, 0x30, 0xB0, 0x30, 0x0F, 0x56, 0x0F,
+0x59, 0xB0, 0x30, 0xE0, 0x10, 0x00, 0xA0, 0x80, 0x30, 0xD0, 0x30, 0xB0, 0x30, 0x02, 0x80, 0x30,
+0x10, 0x50, 0x07, 0x40, 0x00, 0x80, 0x70, 0x80, 0x60, 0xC0, 0xF0, 0x30, 0xD0, 0x10, 0xD0, 0xA0,
+0x80, 0x50, 0x40, 0x50, 0x00, 0x90, 0x01, 0x30, 0xD0, 0x80, 0xC0, 0xF3, 0x24, 0xF0, 0xC1, 0xF0,
+0x2D, 0x60, 0xF0, 0x20, 0xF0, 0x80, 0xD0, 0x70, 0x28, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xF0,
+0x60, 0x2E, 0x61, 0x11, 0xD0, 0x10, 0x91, 0x10, 0xB1, 0x01, 0x81, 0x40, 0x80, 0xD0, 0x10, 0xD0,
+0x10, 0x70, 0x50, 0x12, 0xD0, 0x30, 0x80, 0xE0, 0x02, 0x40, 0x80, 0xA1, 0xE0, 0xC0, 0xF1, 0xC0,
+0xF1, 0x24, 0xF0, 0xC0, 0xA0, 0xB0, 0x01, 0xB0, 0xA0, 0x70, 0x30, 0x01, 0x30, 0x10, 0x70, 0x02,
+0x80, 0x50, 0x40, 0x30, 0xB1, 0xA0, 0x01, 0xD0, 0x50, 0x00, 0x90, 0x30, 0x90, 0x0F, 0x56, 0x0F,
+0x5C, 0x80, 0x40, 0x00, 0xA0, 0x11, 0xB0, 0x01, 0x30, 0x00, 0xE0, 0x12, 0x40, 0x07, 0x90, 0xA0,
+0x80, 0xF2, 0x21, 0xF1, 0xC0, 0xF0, 0x82, 0xA0, 0x71, 0xA0, 0x30, 0x70, 0x60, 0xF1, 0x2B, 0x60,
+0xF0, 0x2D, 0x60, 0xF0, 0x21, 0x60, 0x20, 0xF1, 0x27, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2E, 0x60,
+0x2D, 0xC2, 0x72, 0x40, 0x00, 0x90, 0x10, 0xB0, 0x00, 0xB0, 0x80, 0x40, 0x30, 0xE1, 0x30, 0xA0,
+0xD0, 0x30, 0x02, 0x91, 0x10, 0x05, 0x40, 0x01, 0xB0, 0xE0, 0x70, 0xA1, 0xD0, 0xA0, 0x61, 0xF0,
+0x23, 0xF0, 0x30, 0xA0, 0x80, 0x08, 0x30, 0xD0, 0x90, 0x00, 0x30, 0x01, 0x80, 0x10, 0x80, 0xA1,
+0xD0, 0x40, 0x0F, 0x5B, 0x0F, 0x59, 0x90, 0xE0, 0xB0, 0x70, 0x50, 0x80, 0xE0, 0xB0, 0x10, 0xA0,
+0x01, 0xA0, 0xD0, 0x10, 0xD0, 0xA0, 0x50, 0x07, 0x80, 0xA0, 0x60, 0xF1, 0x24, 0xF0, 0x21, 0xF6,
+0x60, 0xF2, 0x2C, 0x60, 0xF0, 0x2D, 0x60, 0xF1, 0x22, 0xF0, 0x28, 0x60, 0xF0, 0x2B, 0xF0, 0x60,
+0x2D, 0xC0, 0x60, 0x2C, 0xF0, 0xC1, 0xE0, 0x70, 0x10, 0xD0, 0x50, 0x00, 0xB0, 0xE0, 0x01, 0x70,
+0x90, 0x01, 0x50, 0x40, 0x80, 0x90, 0x80, 0x04, 0x50, 0x80, 0x04, 0x51, 0x05, 0xB0, 0x00, 0xB0,
+0x30, 0x80, 0x30, 0xF0, 0x23, 0x60, 0xF0, 0x60, 0x30, 0x08, 0x50, 0xA0, 0x10, 0x90, 0x00, 0xB0,
+0x10, 0xA0, 0x50, 0x31, 0x0F, 0x5D, 0x0F, 0x59, 0xB0, 0x30, 0xA2, 0x30, 0x01, 0x30, 0x10, 0x80,
+0x10, 0x70, 0x30, 0x70, 0xA0, 0x70, 0x30, 0x90, 0x00, 0x40, 0x30, 0x90, 0x00, 0x10, 0x70, 0x60,
+0xF0, 0x60, 0x2F, 0x00, 0xF0, 0x60, 0x20, 0xF0, 0x2D, 0x60, 0xF0, 0x2D, 0x60, 0xF0, 0x2D, 0x60,
+0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xC1, 0x2C, 0xC0, 0x81, 0x10, 0x70, 0x11, 0x30, 0x03, 0x50, 0xE0,
+0x02, 0x50, 0x90, 0x71, 0x0C, 0x90, 0xB0, 0x0A, 0xE0, 0x30, 0xF0, 0x20, 0xF0, 0x60, 0xF2, 0x70,
+0xB0, 0x09, 0x50, 0xD0, 0x30, 0xA0, 0x10, 0xB0, 0x01, 0x70, 0xA0, 0x50, 0x0F, 0x5B, 0x0F, 0x5A,
+0x50, 0x30, 0x90, 0x00, 0x80, 0x50, 0x00, 0x50, 0x10, 0x70, 0xC0, 0xF1, 0xA0, 0xD0, 0x12, 0x70,
+0xD0, 0xA0, 0xD0, 0x70, 0x60, 0xF2, 0x20, 0x60, 0xF0, 0x2F, 0x00, 0x60, 0xF0, 0x2D, 0xC1, 0x2D,
+0xC1, 0x2D, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xC1, 0x2A, 0xF0, 0x80, 0x10, 0xA0, 0x70, 0xD0,
+0x10, 0x01, 0xB0, 0x03, 0x40, 0x90, 0x02, 0x40, 0x10, 0x70, 0x30, 0x0C, 0x40, 0x0C, 0xE0, 0xA0,
+0xF0, 0xC0, 0x60, 0x21, 0xF0, 0xC0, 0x30, 0x0B, 0x40, 0x10, 0xD0, 0x01, 0x30, 0xB0, 0x00, 0x31,
+0x0F, 0x5A, 0x0F, 0x58, 0xB0, 0x32, 0x02, 0x31, 0x10, 0x60, 0xC0, 0xF0, 0x20, 0xF1, 0x60, 0xA0,
+0xC0, 0x60, 0xC0, 0xF4, 0x22, 0xF0, 0x60, 0xC0, 0x2F, 0x00, 0x60, 0xF0, 0x2E, 0x60, 0x2E, 0x60,
+0x2D, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xC1, 0x29, 0xF0, 0x70, 0xD0, 0xE0, 0x80, 0x10, 0x81,
+0x40, 0x05, 0x50, 0xE0, 0x02, 0xA0, 0x70, 0xD0, 0xE0, 0x07, 0xB0, 0x02, 0x51, 0x0D, 0x30, 0xC0,
+0x60, 0xF2, 0x60, 0xC0, 0xA0, 0x0B, 0x51, 0xE0, 0xD0, 0x80, 0xE0, 0x01, 0xB0, 0xA1, 0x40, 0x0F,
+0x58, 0x0F, 0x57, 0x40, 0xA0, 0xB0, 0x00, 0xE0, 0x90, 0x00, 0x40, 0x10, 0xA0, 0xF1, 0xC0, 0x60,
+0x22, 0xF2, 0x20, 0xF1, 0x20, 0xF0, 0x22, 0xF0, 0x21, 0xC0, 0x60, 0xF0, 0x2E, 0x60, 0xC0, 0x2D,
+0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0xC1, 0x28, 0xF0, 0x60,
+0x10, 0x70, 0xD0, 0xA1, 0x09, 0x30, 0x01, 0x50, 0x40, 0x30, 0xD0, 0x90, 0x07, 0x90, 0xD0, 0xB0,
+0x00, 0x40, 0x0E, 0x40, 0x61, 0xC0, 0x70, 0xA0, 0xE0, 0x70, 0x10, 0x30, 0x0A, 0x40, 0x01, 0xB0,
+0x70, 0xA0, 0xB0, 0x00, 0x30, 0x50, 0x00, 0x40, 0xA0, 0xB0, 0x0F, 0x56, 0x0F, 0x56, 0x30, 0x80,
+0x30, 0x02, 0xA0, 0x70, 0xD0, 0xC0, 0xF0, 0x22, 0x60, 0xF0, 0x2E, 0xF1, 0x60, 0x2F, 0x00, 0xF0,
+0x60, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60, 0x2D, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0x60, 0xC0,
+0x26, 0xF2, 0xA0, 0x71, 0xE0, 0x70, 0x10, 0xB0, 0x08, 0xA0, 0xB0, 0x00, 0xE0, 0xD0, 0x10, 0xB0,
+0x80, 0x08, 0xA0, 0x40, 0x00, 0x40, 0x0E, 0xE0, 0x80, 0xF0, 0x30, 0x90, 0x01, 0x70, 0x50, 0xA0,
+0xB0, 0x08, 0x90, 0xB0, 0x03, 0x40, 0xD0, 0xA0, 0xE0, 0x02, 0xA0, 0x30, 0x40, 0x0F, 0x55, 0x0F,
+0x54, 0x90, 0xA0, 0xB0, 0x00, 0xE0, 0x90, 0x00, 0x80, 0x10, 0x60, 0xF1, 0x24, 0x60, 0x2F, 0x02,
+0x60, 0x2E, 0xF0, 0x60, 0x2E, 0xC1, 0xF0, 0x2B, 0xF0, 0x60, 0x2D, 0x60, 0xC0, 0x2B, 0xF0, 0x60,
+0x2C, 0xF0, 0x60, 0x28, 0xC0, 0x70, 0x12, 0x80, 0x70, 0x50, 0xB0, 0x70, 0x30, 0x06, 0xA0, 0x01,
+0x90, 0x80, 0xB0, 0x50, 0x80, 0x08, 0xA0, 0xE0, 0x50, 0xB0, 0x0E, 0xE0, 0x80, 0xF0, 0x80, 0x50,
+0x0E, 0x40, 0x06, 0x30, 0xD0, 0x50, 0x00, 0x70, 0x01, 0xE0, 0xA0, 0x0F, 0x54, 0x0F, 0x46, 0xB1,
+0x0A, 0x30, 0x80, 0x30, 0x02, 0xA0, 0x10, 0x70, 0xF1, 0x25, 0xF0, 0x60, 0x2F, 0x02, 0x60, 0x2F,
+0x00, 0xC1, 0xF0, 0x2D, 0x60, 0xF0, 0x2B, 0xF0, 0xC0, 0x2D, 0xC1, 0x2B, 0xF0, 0x60, 0x2C, 0xF0,
+0x60, 0x26, 0xF1, 0xD0, 0x50, 0xD0, 0x10, 0x80, 0xA0, 0x90, 0xB0, 0xA0, 0x90, 0x50, 0x30, 0x02,
+0x80, 0x90, 0x80, 0x90, 0x01, 0x90, 0x02, 0x30, 0x90, 0xB0, 0x06, 0x30, 0xD0, 0x90, 0x0F, 0x00,
+0x30, 0xC0, 0xF0, 0x70, 0x0E, 0x40, 0x08, 0xB0, 0x71, 0x40, 0x01, 0xB0, 0xA1, 0x40, 0x0F, 0x52,
+0x0F, 0x45, 0x50, 0x80, 0x30, 0xB0, 0x07, 0x90, 0xA0, 0x50, 0x00, 0xE0, 0x40, 0x00, 0x40, 0xA0,
+0x60, 0xF0, 0x29, 0x60, 0x2F, 0x01, 0xC0, 0x60, 0x2F, 0x00, 0x60, 0xF1, 0x2C, 0x60, 0x2C, 0xF0,
+0xC1, 0x2C, 0xC1, 0x2B, 0xF0, 0x60, 0x2C, 0xF0, 0x60, 0xF0, 0x24, 0xF0, 0x70, 0xC0, 0xD0, 0x70,
+0xD0, 0xB0, 0x00, 0x90, 0x00, 0x80, 0x70, 0x80, 0x00, 0x40, 0x30, 0x90, 0x30, 0x40, 0x90, 0xA0,
+0x01, 0xB0, 0x50, 0x03, 0xE0, 0x30, 0xE0, 0x05, 0xA0, 0x10, 0x90, 0x0E, 0x50, 0x30, 0xF0, 0x81,
+0x0D, 0xB0, 0x90, 0x0A, 0xE0, 0xD0, 0x50, 0x00, 0xA0, 0x01, 0xE0, 0xA0, 0x0F, 0x51, 0x0F, 0x45,
+0x90, 0x40, 0x80, 0x50, 0x06, 0x30, 0x80, 0x30, 0x02, 0x30, 0xA0, 0x30, 0xF1, 0x2A, 0xC1, 0x2F,
+0x00, 0xF0, 0x60, 0x2E, 0xF0, 0x60, 0x2E, 0x60, 0xC0, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x2B, 0xC0,
+0x60, 0x2B, 0xF0, 0x60, 0x2C, 0xF0, 0x60, 0xF0, 0x23, 0xF0, 0x60, 0xD0, 0xF0, 0xD1, 0xE0, 0x01,
+0x90, 0x00, 0x40, 0x91, 0xA0, 0xB1, 0x40, 0xB0, 0x04, 0x90, 0x40, 0x80, 0xA0, 0x70, 0x90, 0x01,
+0x40, 0xA0, 0x04, 0xE0, 0x90, 0xB0, 0x0D, 0xB0, 0x70, 0xC0, 0xF0, 0x70, 0x0E, 0x40, 0x0C, 0xB0,
+0x71, 0x90, 0x01, 0x50, 0x30, 0xA0, 0x50, 0x0F, 0x4F, 0x0F, 0x43, 0xB0, 0x50, 0x00, 0x90, 0x50,
+0x05, 0xB0, 0xA0, 0x50, 0x00, 0x40, 0x80, 0x00, 0x60, 0xA0, 0xC0, 0xF0, 0x2D, 0x60, 0x2F, 0x01,
+0xC1, 0xF0, 0x2C, 0xF0, 0xC1, 0x2C, 0xF0, 0xC1, 0x2C, 0xF0, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2B,
+0xF0, 0xC0, 0x2D, 0x60, 0xF0, 0x22, 0xF0, 0x60, 0xD1, 0x10, 0x80, 0x10, 0x70, 0x01, 0x90, 0x00,
+0xE0, 0x90, 0x01, 0x32, 0x50, 0x04, 0x91, 0xD0, 0x80, 0x10, 0x50, 0x02, 0x50, 0x80, 0x03, 0xB0,
+0x80, 0xB0, 0x0C, 0x90, 0x70, 0x80, 0xF1, 0xA0, 0x0D, 0x51, 0x0E, 0xE0, 0xD0, 0xB0, 0x00, 0xA0,
+0x01, 0x81, 0x0F, 0x4E, 0x0F, 0x42, 0x90, 0x70, 0xA0, 0x70, 0x06, 0x40, 0xA1, 0x02, 0x30, 0xA0,
+0x80, 0xF1, 0x2D, 0xF0, 0xC0, 0x60, 0x2F, 0x01, 0x60, 0xF0, 0x2D, 0xF0, 0x60, 0x2D, 0xF0, 0x60,
+0x2C, 0xF0, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2D, 0x60, 0xF0, 0x22, 0x60, 0x12,
+0x70, 0xD0, 0x30, 0xE0, 0xB0, 0xE1, 0x90, 0x80, 0x90, 0x04, 0xA0, 0x40, 0x02, 0xB0, 0x90, 0x07,
+0x90, 0xE0, 0x02, 0xB0, 0x30, 0x71, 0x40, 0x80, 0xE0, 0x81, 0x40, 0x50, 0x90, 0xE0, 0xA0, 0x72,
+0x80, 0xC1, 0xF0, 0x60, 0x40, 0x0D, 0x40, 0x0F, 0x02, 0xD1, 0x50, 0x01, 0x50, 0xA1, 0x0F, 0x4D,
+0x0F, 0x42, 0xA0, 0x50, 0x00, 0xE0, 0x70, 0x04, 0x80, 0xE0, 0x00, 0x90, 0x80, 0x00, 0x90, 0xA0,
+0x80, 0xF1, 0x2F, 0x01, 0x60, 0x2F, 0x01, 0xC1, 0x2D, 0xF0, 0xC1, 0xF0, 0x2B, 0xF0, 0x60, 0x2C,
+0xF0, 0x60, 0xC0, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2D, 0x60, 0xF0, 0x21, 0xF0, 0x80, 0xD0,
+0x11, 0x70, 0xD0, 0x80, 0xD0, 0xA0, 0x80, 0x50, 0x40, 0xE0, 0x06, 0x30, 0x40, 0x01, 0x51, 0x07,
+0x80, 0xB0, 0x03, 0x90, 0xA1, 0x71, 0xE0, 0x80, 0x61, 0x81, 0x60, 0x20, 0xF3, 0x60, 0xF1, 0x80,
+0x40, 0x0C, 0x90, 0xB0, 0x0F, 0x02, 0x50, 0x30, 0x70, 0xB0, 0x00, 0xA0, 0x00, 0xB0, 0xA0, 0x90,
+0x0F, 0x4B, 0x0F, 0x3F, 0x50, 0x80, 0x00, 0x30, 0x40, 0x01, 0x31, 0x01, 0xB0, 0xA0, 0x70, 0x02,
+0x80, 0xA0, 0x30, 0xF0, 0xC0, 0x60, 0x2F, 0x03, 0x60, 0xF0, 0x2F, 0x00, 0x60, 0xF0, 0x28, 0xF3,
+0x21, 0x60, 0xF0, 0x2C, 0xC1, 0x2B, 0xF0, 0xC1, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2C, 0xC1,
+0xF0, 0x21, 0xF1, 0x80, 0x11, 0xD0, 0x11, 0x70, 0x90, 0x30, 0x09, 0x50, 0xE0, 0x01, 0x40, 0x08,
+0xA0, 0x04, 0xA0, 0x10, 0x40, 0x80, 0x10, 0xA0, 0x50, 0xF3, 0x23, 0xF0, 0xC1, 0x21, 0xF0, 0xA0,
+0x80, 0x0B, 0x40, 0x0F, 0x03, 0x40, 0x00, 0x90, 0xD0, 0x70, 0xB0, 0x01, 0x90, 0xD0, 0x80, 0x06,
+0x50, 0xE0, 0x70, 0x50, 0x0F, 0x3F, 0x0F, 0x3E, 0x40, 0x70, 0xE0, 0xD0, 0x50, 0x10, 0x02, 0xD0,
+0x00, 0x40, 0xA0, 0x00, 0x50, 0x30, 0x00, 0xB0, 0x70, 0x60, 0xF0, 0x20, 0xF0, 0x60, 0xC0, 0x2F,
+0x01, 0xF0, 0x60, 0xC0, 0xF0, 0x2E, 0xC1, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0x10, 0xA0, 0x21, 0x60,
+0xF0, 0x2D, 0x60, 0xF0, 0x2B, 0xC1, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2B, 0xF0, 0xC1, 0xF0,
+0x20, 0xF0, 0x60, 0xA0, 0x10, 0xA0, 0x30, 0xD0, 0x10, 0x90, 0xE1, 0x30, 0x0A, 0xA0, 0x01, 0x40,
+0x08, 0xA0, 0x03, 0x50, 0xB0, 0xE0, 0x10, 0x01, 0xE0, 0x31, 0xA0, 0xF1, 0x23, 0xF0, 0x60, 0x23,
+0xF0, 0x60, 0x70, 0x90, 0x08, 0x40, 0x0F, 0x03, 0x40, 0x03, 0x70, 0xA0, 0x01, 0x70, 0x00, 0x90,
+0xA0, 0x02, 0x50, 0xA1, 0x80, 0xA1, 0x0F, 0x40, 0x0F, 0x3E, 0x70, 0xB0, 0x00, 0xA0, 0x51, 0x10,
+0xB1, 0x70, 0x30, 0x70, 0x02, 0xE0, 0x30, 0xA0, 0xF1, 0x22, 0xF0, 0x60, 0xF0, 0x2F, 0x02, 0x60,
+0xF0, 0x2F, 0x00, 0x60, 0xF0, 0x22, 0xF0, 0x21, 0xF0, 0x60, 0x10, 0xA0, 0x10, 0xD0, 0x60, 0xF0,
+0xC1, 0x2D, 0x60, 0xF0, 0x2C, 0x60, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2B, 0xF0, 0xC1, 0xF1,
+0x80, 0x10, 0xA0, 0x60, 0xB0, 0xD0, 0x11, 0x30, 0x90, 0x40, 0x90, 0x0A, 0xE0, 0x80, 0xB0, 0x50,
+0x08, 0xB0, 0x70, 0xB0, 0x01, 0x90, 0x07, 0x50, 0xD0, 0xC0, 0x22, 0xF0, 0xC1, 0xF2, 0x21, 0xF0,
+0x50, 0xA0, 0x50, 0x06, 0xB0, 0x90, 0x0F, 0x02, 0x51, 0x04, 0x40, 0xD0, 0xA0, 0x02, 0x40, 0xD0,
+0x90, 0x00, 0x90, 0x10, 0xB0, 0x90, 0x70, 0x00, 0x50, 0x71, 0x90, 0x0F, 0x3C, 0x0F, 0x3E, 0x30,
+0x50, 0x00, 0xA0, 0x50, 0x00, 0x50, 0x71, 0xD0, 0x51, 0x30, 0x01, 0x31, 0xF1, 0x25, 0x60, 0x2F,
+0x01, 0xF0, 0xC1, 0x2F, 0x00, 0x60, 0x24, 0xF1, 0x30, 0x10, 0x30, 0xA0, 0x10, 0x00, 0xA0, 0xF1,
+0x60, 0x2C, 0xF0, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2B, 0xF0,
+0x60, 0x20, 0xF0, 0xC0, 0x10, 0x60, 0xF1, 0x30, 0x10, 0x80, 0x31, 0x01, 0x50, 0x0B, 0xA0, 0x50,
+0xB0, 0x09, 0x50, 0xA0, 0x01, 0xE0, 0x80, 0x07, 0xA0, 0x80, 0xF0, 0x21, 0xF0, 0x60, 0x30, 0x80,
+0x60, 0xC1, 0x60, 0xC0, 0x80, 0xD0, 0x90, 0x06, 0x40, 0x0F, 0x02, 0xB0, 0x90, 0x06, 0x50, 0xD0,
+0xE0, 0x00, 0xB0, 0xA0, 0x00, 0x30, 0xE0, 0x00, 0xB0, 0xD1, 0x00, 0xB0, 0xD0, 0x90, 0xB0, 0xD0,
+0x0F, 0x3C, 0x0F, 0x3B, 0x30, 0xD0, 0xE0, 0x02, 0x70, 0xB1, 0xE0, 0xB0, 0x70, 0x50, 0x01, 0x40,
+0x80, 0xA0, 0x60, 0xF0, 0x26, 0xF0, 0xC1, 0x2F, 0x01, 0xF0, 0x60, 0x2F, 0x00, 0xF0, 0x60, 0xF0,
+0x22, 0xC0, 0xD0, 0x11, 0x90, 0xB0, 0xD0, 0x00, 0xD0, 0xC0, 0xF0, 0x60, 0x21, 0xF1, 0x23, 0xF1,
+0x23, 0xC1, 0x2B, 0xF0, 0x60, 0xF0, 0x2A, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x2B, 0xF0, 0x60, 0x21,
+0xC0, 0x80, 0xF0, 0x20, 0xF0, 0xD0, 0x10, 0x30, 0x00, 0x30, 0x00, 0x51, 0x0B, 0x30, 0x40, 0x0B,
+0x90, 0x30, 0xB0, 0x30, 0xA0, 0xE0, 0x00, 0x30, 0x04, 0x50, 0x80, 0xF0, 0x21, 0xF0, 0xA0, 0x90,
+0x50, 0x30, 0x10, 0x70, 0xE0, 0x30, 0x80, 0x07, 0x51, 0x0F, 0x02, 0x40, 0x09, 0x70, 0x31, 0x02,
+0x31, 0x00, 0xD0, 0x70, 0xB0, 0x10, 0x50, 0x01, 0x70, 0xB0, 0x0F, 0x3B, 0x0F, 0x3A, 0x80, 0xE0,
+0x00, 0xD0, 0x02, 0x70, 0x90, 0xD0, 0xE0, 0xA0, 0x50, 0xA0, 0x01, 0x90, 0x70, 0xF1, 0x29, 0x60,
+0x2F, 0x01, 0xF0, 0xC0, 0x60, 0xF0, 0x2D, 0xF0, 0x60, 0xC0, 0x23, 0xA0, 0x32, 0x90, 0x01, 0x70,
+0xC0, 0x60, 0x70, 0x61, 0x70, 0xC0, 0xF0, 0x20, 0xF1, 0x80, 0xA0, 0x24, 0x60, 0xF0, 0x2A, 0xF0,
+0x60, 0xC0, 0x2B, 0x60, 0xC0, 0x2A, 0xF0, 0xC0, 0x2B, 0xF0, 0x60, 0x22, 0xF0, 0x21, 0xF0, 0x30,
+0x11, 0x70, 0xB0, 0x00, 0x90, 0xB0, 0x0C, 0xA0, 0xB0, 0x0B, 0x50, 0x70, 0x00, 0x31, 0x70, 0x30,
+0x80, 0x03, 0xA0, 0x70, 0xF0, 0x60, 0x10, 0x60, 0x70, 0xB0, 0x01, 0xE0, 0x0B, 0x40, 0x0F, 0x02,
+0x90, 0xB0, 0x0A, 0xE0, 0xD0, 0x01, 0x50, 0x30, 0x50, 0xD0, 0x90, 0x00, 0xE0, 0x80, 0x01, 0x40,
+0x70, 0x00, 0x81, 0x0F, 0x39, 0x0F, 0x3A, 0x30, 0x90, 0xB0, 0x10, 0xD0, 0x30, 0x00, 0x10, 0xA0,
+0x80, 0x70, 0x01, 0x90, 0x81, 0x30, 0xF0, 0x2C, 0x60, 0xF0, 0x2F, 0x01, 0x60, 0x2F, 0x00, 0xC0,
+0x60, 0xF0, 0x22, 0xF1, 0x90, 0xE0, 0x10, 0x90, 0xA0, 0x80, 0xC0, 0x30, 0xE0, 0xA0, 0x30, 0x50,
+0x10, 0xA0, 0xC0, 0x80, 0xF0, 0x70, 0x90, 0x80, 0xF1, 0x20, 0xF0, 0x60, 0x2C, 0xC1, 0xF0, 0x2A,
+0xC1, 0xF0, 0x2A, 0xC0, 0x2B, 0xF0, 0x60, 0x24, 0xF0, 0xC0, 0x10, 0xE0, 0x70, 0x40, 0xE0, 0x00,
+0x40, 0x0C, 0xB0, 0xA0, 0x50, 0x0C, 0x80, 0x40, 0x01, 0x50, 0x30, 0xD0, 0x10, 0x50, 0x02, 0x40,
+0xA0, 0xF0, 0x62, 0xA0, 0x50, 0x00, 0x50, 0x0A, 0x90, 0xB0, 0x0F, 0x01, 0xB0, 0x90, 0x0C, 0x50,
+0x10, 0x90, 0xA0, 0x01, 0xB0, 0xD0, 0xB0, 0x30, 0x50, 0x00, 0x90, 0x10, 0x00, 0x90, 0x41, 0x90,
+0x0F, 0x38, 0x0F, 0x3C, 0xB0, 0x50, 0x00, 0x70, 0x50, 0x40, 0x30, 0xD0, 0x10, 0x90, 0x01, 0x70,
+0x80, 0xF0, 0x2C, 0xF0, 0xC1, 0xF0, 0x2F, 0x01, 0x60, 0x2F, 0x00, 0x60, 0x22, 0xF3, 0xC0, 0x70,
+0x80, 0xE0, 0x30, 0x10, 0x70, 0x00, 0xA0, 0xB0, 0x00, 0x10, 0x90, 0x10, 0x80, 0x70, 0x90, 0xB0,
+0xD0, 0x71, 0x21, 0x60, 0xC0, 0xF0, 0x2B, 0x60, 0xF0, 0x2A, 0xC1, 0xF0, 0x29, 0xF0, 0xC0, 0x2B,
+0xF0, 0x60, 0x24, 0xF0, 0x80, 0x11, 0xD0, 0xB0, 0x30, 0x00, 0x40, 0x0C, 0x90, 0x80, 0xB0, 0x0B,
+0x50, 0xB0, 0xD0, 0x04, 0x50, 0xB0, 0x03, 0x30, 0x80, 0xC1, 0xF0, 0xC0, 0x30, 0x80, 0x71, 0x08,
+0xB0, 0x40, 0x0F, 0x02, 0x40, 0x0F, 0x00, 0xD0, 0x80, 0x01, 0x70, 0x10, 0xA0, 0x80, 0xA0, 0x30,
+0x70, 0x50, 0x01, 0xE0, 0x80, 0x0F, 0x39, 0x0F, 0x3F, 0x30, 0x90, 0x30, 0x50, 0x00, 0xD0, 0x10,
+0x50, 0xA0, 0x60, 0xF0, 0x2E, 0xF0, 0x60, 0xC0, 0x2F, 0x00, 0xF0, 0x60, 0xC0, 0x2E, 0xC0, 0x60,
+0x20, 0xF0, 0x71, 0xD0, 0x30, 0x70, 0x30, 0x00, 0x80, 0xD0, 0xB0, 0x01, 0xB0, 0x50, 0x00, 0x10,
+0xB0, 0x90, 0x03, 0x90, 0x10, 0xC0, 0xF0, 0x20, 0xC1, 0xF0, 0x2B, 0x60, 0xF0, 0x2B, 0x60, 0xF0,
+0x29, 0xF0, 0xC0, 0x2B, 0xF0, 0x60, 0x24, 0xC0, 0x10, 0x80, 0x01, 0x50, 0x80, 0x00, 0x90, 0x0C,
+0x90, 0xE0, 0x90, 0x0B, 0x40, 0xB0, 0x80, 0x0B, 0xD0, 0x60, 0xF3, 0x60, 0xF0, 0x60, 0x30, 0x07,
+0x40, 0x0F, 0x02, 0x90, 0xB0, 0x0F, 0x01, 0xA0, 0x30, 0x80, 0x10, 0xE0, 0x00, 0x81, 0x50, 0x0F,
+0x3F, 0x0F, 0x3C, 0x50, 0xD0, 0xA3, 0x02, 0x10, 0xD0, 0xF1, 0x2F, 0x01, 0xF0, 0x60, 0xF0, 0x2F,
+0x01, 0x60, 0xF0, 0x2E, 0x60, 0x20, 0xF0, 0xA0, 0x30, 0xA0, 0x50, 0xE0, 0x70, 0x50, 0xE0, 0x04,
+0x40, 0x00, 0xB0, 0x06, 0x70, 0xC0, 0x22, 0x60, 0xF0, 0x2B, 0x60, 0xF0, 0x2B, 0x60, 0xF0, 0x29,
+0xF0, 0x60, 0x2B, 0xF0, 0x60, 0x23, 0xF0, 0x10, 0x40, 0x02, 0xA0, 0x00, 0x51, 0x0C, 0x90, 0x00,
+0x30, 0x90, 0x09, 0xB0, 0x50, 0x00, 0x70, 0x0B, 0x40, 0xA0, 0x71, 0xA0, 0xC0, 0xF1, 0xE0, 0xA0,
+0x06, 0xB0, 0x90, 0x0F, 0x01, 0x50, 0x90, 0x0F, 0x03, 0xE0, 0x10, 0x80, 0x01, 0xB0, 0xD0, 0x80,
+0x0F, 0x3F, 0x0F, 0x3E, 0x40, 0xA0, 0x00, 0x90, 0x30, 0x00, 0x40, 0xA0, 0xC1, 0x2F, 0x02, 0xF0,
+0x20, 0x60, 0xF0, 0x2E, 0xF0, 0xC0, 0x60, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0xF3, 0xD0, 0x08, 0x50,
+0xB0, 0x07, 0x10, 0xC0, 0xF0, 0x21, 0x60, 0xF0, 0x2B, 0x60, 0xF0, 0x2B, 0x60, 0xF0, 0x29, 0xF0,
+0x60, 0xC0, 0x2B, 0x60, 0x22, 0xF0, 0x60, 0x10, 0x50, 0x01, 0x50, 0x80, 0x00, 0x50, 0x90, 0xB0,
+0x0A, 0x50, 0xB0, 0x00, 0xB0, 0x70, 0xD0, 0xB0, 0x07, 0x90, 0xB0, 0x00, 0x70, 0x40, 0x0A, 0x90,
+0x02, 0xB0, 0xA3, 0xB0, 0x06, 0x40, 0x0F, 0x02, 0x40, 0x0F, 0x04, 0x90, 0x40, 0xD0, 0xB1, 0xA0,
+0x00, 0x40, 0x30, 0x0F, 0x3E, 0x0F, 0x3D, 0x90, 0x70, 0x02, 0x40, 0x70, 0x30, 0xF1, 0x60, 0x2F,
+0x03, 0xF0, 0x60, 0xC0, 0x2F, 0x00, 0xF0, 0x60, 0x2E, 0xF0, 0x60, 0xF0, 0x21, 0xF0, 0xA0, 0xE1,
+0x06, 0xB0, 0x90, 0x07, 0x70, 0xA0, 0xF0, 0x21, 0xC1, 0x2B, 0x60, 0xC0, 0x2B, 0x60, 0xF0, 0x29,
+0xF0, 0xC0, 0x20, 0xF0, 0x29, 0xC0, 0x60, 0xF0, 0x21, 0xF0, 0x71, 0x02, 0x40, 0x90, 0x00, 0x90,
+0x40, 0x10, 0x40, 0x09, 0x40, 0x70, 0x80, 0xA0, 0x80, 0x60, 0xA1, 0xB0, 0x05, 0x90, 0x01, 0xE0,
+0x40, 0x09, 0x51, 0x04, 0xB0, 0x08, 0x51, 0x0F, 0x01, 0x40, 0x0F, 0x04, 0x90, 0x50, 0x00, 0x50,
+0xD1, 0x02, 0xE0, 0x70, 0x0F, 0x3D, 0x0F, 0x3C, 0x90, 0x30, 0x90, 0x30, 0x01, 0x81, 0xF0, 0x22,
+0x60, 0xF0, 0x2F, 0x02, 0xF0, 0x60, 0x2F, 0x00, 0xF0, 0xC0, 0x60, 0x2E, 0xC0, 0x60, 0x20, 0xF1,
+0x80, 0xD0, 0x40, 0x07, 0x40, 0x07, 0x40, 0xE0, 0x30, 0xF0, 0x20, 0xC1, 0x2B, 0xC1, 0x2A, 0xF0,
+0x60, 0xF0, 0x24, 0xC5, 0x61, 0xC5, 0x23, 0xF0, 0xC0, 0x60, 0xF0, 0x21, 0xF0, 0xD0, 0xA0, 0x30,
+0x01, 0x80, 0x90, 0x00, 0x40, 0x00, 0x50, 0x10, 0x80, 0x08, 0x81, 0x60, 0xF3, 0x60, 0x80, 0x04,
+0x51, 0x02, 0x80, 0xA0, 0x08, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x51, 0x0F, 0x03, 0x50, 0x90,
+0x03, 0xD0, 0x40, 0x00, 0xB0, 0x30, 0x50, 0xA0, 0x0F, 0x3C, 0x0F, 0x3B, 0xE0, 0x30, 0x01, 0x40,
+0x80, 0xA0, 0x60, 0xF0, 0x24, 0x60, 0xF0, 0x2F, 0x03, 0x60, 0xF0, 0x2E, 0xF0, 0x60, 0x2E, 0xF0,
+0x60, 0xF0, 0x60, 0x50, 0x70, 0xD0, 0x50, 0x07, 0x50, 0xB0, 0x07, 0x30, 0xA0, 0xF0, 0x20, 0xF0,
+0x60, 0xF0, 0x2A, 0xF0, 0x60, 0xF0, 0x20, 0xF3, 0xC1, 0x69, 0xC6, 0x60, 0xC6, 0x69, 0xC0, 0xA0,
+0x71, 0x00, 0xD0, 0x90, 0x01, 0x40, 0x01, 0xD0, 0x10, 0x07, 0x50, 0xD0, 0xC0, 0xF0, 0x22, 0xF1,
+0xA0, 0x04, 0x40, 0x04, 0xE0, 0x90, 0x06, 0x51, 0x00, 0xD0, 0xA0, 0x50, 0x0A, 0x90, 0xB0, 0x0F,
+0x00, 0xB0, 0x40, 0x0F, 0x03, 0xB0, 0x40, 0x05, 0xD0, 0xE0, 0xA0, 0x02, 0x70, 0xB0, 0x0F, 0x3A,
+0x0F, 0x3A, 0x80, 0x31, 0x02, 0x70, 0x60, 0xF0, 0x25, 0xC0, 0x60, 0xF0, 0x2F, 0x02, 0xC1, 0xF0,
+0x2E, 0xF0, 0x60, 0x2D, 0xF0, 0xC0, 0x60, 0xD0, 0x30, 0xA0, 0x0A, 0x40, 0x06, 0x50, 0x10, 0x60,
+0xF2, 0x60, 0x2A, 0xF1, 0x60, 0xC0, 0x65, 0xC1, 0x20, 0xF1, 0xC1, 0xF3, 0x21, 0xF0, 0x21, 0xF1,
+0xC0, 0x20, 0xF2, 0x22, 0xF4, 0x60, 0xC0, 0xF2, 0xD1, 0x91, 0x80, 0x30, 0x52, 0x90, 0x02, 0x80,
+0x70, 0x05, 0xB0, 0x80, 0x60, 0xF0, 0x24, 0xD0, 0x10, 0xE0, 0x03, 0x90, 0x05, 0xA0, 0x80, 0x05,
+0x40, 0x01, 0xA0, 0x30, 0xD0, 0x10, 0x50, 0x07, 0xB0, 0x90, 0x0F, 0x01, 0x40, 0x0F, 0x03, 0xB0,
+0x40, 0x07, 0xA0, 0x30, 0x01, 0xB0, 0xA1, 0x50, 0x0F, 0x39, 0x0F, 0x39, 0x80, 0x40, 0x00, 0x40,
+0x80, 0xB0, 0xA0, 0x60, 0xF2, 0x25, 0xC0, 0x60, 0xF0, 0x2F, 0x00, 0xF1, 0x60, 0xC0, 0x2E, 0xF0,
+0x60, 0xC0, 0x2D, 0xF0, 0x60, 0x30, 0xA0, 0x40, 0xB0, 0x09, 0x40, 0x06, 0x30, 0x10, 0xC0, 0x22,
+0xC1, 0x22, 0xF2, 0x20, 0xC1, 0x63, 0xC0, 0x29, 0xF0, 0x60, 0xC0, 0xF0, 0x28, 0xF0, 0x60, 0x27,
+0xF0, 0x22, 0x60, 0xF0, 0x20, 0xF1, 0x70, 0x40, 0x00, 0x50, 0x10, 0x80, 0xB1, 0x90, 0x41, 0x90,
+0x50, 0xB1, 0x05, 0x50, 0x70, 0xC0, 0xF0, 0x23, 0xF0, 0xA0, 0xD0, 0x40, 0x02, 0x90, 0x50, 0xB0,
+0x05, 0xE0, 0x90, 0x03, 0xB0, 0x90, 0x00, 0xB1, 0x50, 0x10, 0x30, 0x08, 0x40, 0x0F, 0x01, 0x90,
+0x50, 0x0F, 0x03, 0x40, 0x09, 0x31, 0xB0, 0xA0, 0x01, 0x30, 0x50, 0x0F, 0x38, 0x0F, 0x38, 0x80,
+0x70, 0x02, 0xE0, 0xD0, 0xC0, 0xF0, 0x21, 0xF0, 0x25, 0xF0, 0x60, 0xC0, 0xF0, 0x2F, 0x00, 0xF0,
+0x20, 0x60, 0xF0, 0x2F, 0x00, 0x60, 0xF0, 0x2C, 0xF0, 0xC0, 0xF0, 0xC0, 0x80, 0xA1, 0x08, 0x51,
+0x03, 0xB0, 0x10, 0xD0, 0x60, 0xF0, 0x23, 0x60, 0xF0, 0x21, 0xC1, 0x61, 0xC2, 0x20, 0xF0, 0x60,
+0xF0, 0x2A, 0x60, 0xC0, 0x29, 0xF0, 0x60, 0x2A, 0xF0, 0x60, 0xF0, 0x21, 0xF0, 0xD0, 0xB0, 0x00,
+0x50, 0xE0, 0x30, 0x01, 0x90, 0x02, 0xB0, 0x50, 0x90, 0x41, 0x50, 0x03, 0x80, 0x60, 0xF0, 0x23,
+0xF0, 0xA0, 0x04, 0x30, 0xA0, 0x10, 0xE0, 0x90, 0x40, 0x10, 0x50, 0x00, 0x40, 0x90, 0x03, 0x40,
+0x00, 0x90, 0x10, 0x70, 0x40, 0xB0, 0xD0, 0x07, 0x50, 0x90, 0x0F, 0x00, 0xB0, 0x90, 0x0F, 0x03,
+0x40, 0xB0, 0x0A, 0xE0, 0x10, 0x02, 0xB0, 0x10, 0xB0, 0x0F, 0x37, 0x0F, 0x37, 0x80, 0x41, 0x80,
+0x00, 0x50, 0x70, 0xF1, 0x29, 0xF1, 0x60, 0x2F, 0x02, 0xF0, 0xC1, 0xF0, 0x2E, 0xC1, 0x2C, 0xF1,
+0x60, 0xF2, 0xD0, 0x80, 0x08, 0x40, 0x03, 0x80, 0x70, 0xF1, 0x21, 0xF2, 0x60, 0xC0, 0x61, 0xC0,
+0x26, 0xF0, 0x60, 0xC0, 0xF0, 0x29, 0xC1, 0x29, 0xF0, 0xC0, 0x2B, 0x60, 0xF0, 0x20, 0xF1, 0x10,
+0x80, 0x02, 0x30, 0xB0, 0x00, 0x40, 0x07, 0xB0, 0x90, 0x41, 0x90, 0x30, 0xF2, 0x21, 0xF0, 0xC0,
+0x30, 0x04, 0x80, 0x70, 0xA0, 0x30, 0x10, 0xD0, 0x50, 0x01, 0x70, 0x03, 0xB0, 0x90, 0x00, 0xB0,
+0xA0, 0x30, 0x40, 0x00, 0x30, 0x50, 0x04, 0xB0, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x0F, 0x03, 0x90,
+0x50, 0x0C, 0x40, 0x10, 0x00, 0xB0, 0x70, 0x00, 0xA0, 0x50, 0x0F, 0x36, 0x0F, 0x36, 0x30, 0x40,
+0x01, 0x90, 0x30, 0x70, 0xF1, 0x2D, 0x60, 0x20, 0xF0, 0x2F, 0x00, 0xF0, 0x60, 0x2F, 0x00, 0xF0,
+0x60, 0x2D, 0xF0, 0xC1, 0x20, 0xF0, 0x60, 0xA0, 0x08, 0x90, 0xE0, 0x30, 0xD0, 0x70, 0x30, 0xF1,
+0x20, 0xF0, 0xC1, 0x62, 0xC0, 0xF3, 0x26, 0xC0, 0x60, 0xF0, 0x29, 0xC1, 0x2A, 0xC0, 0x2B, 0x60,
+0xF0, 0x20, 0xF0, 0x60, 0x10, 0xD0, 0x02, 0x30, 0x01, 0x40, 0x0B, 0x90, 0x70, 0x61, 0xC0, 0x21,
+0xF0, 0x30, 0x90, 0x03, 0x90, 0xB0, 0x07, 0x40, 0xA0, 0xE0, 0xB0, 0x00, 0x90, 0xB0, 0x05, 0x10,
+0xA1, 0xE0, 0xB0, 0x00, 0xE0, 0x10, 0x90, 0xB0, 0x0F, 0x00, 0x90, 0xB0, 0x0F, 0x02, 0x50, 0x90,
+0x0E, 0x90, 0xD0, 0x30, 0x02, 0xA0, 0x50, 0x0F, 0x35, 0x0F, 0x2B, 0xB1, 0x07, 0x80, 0x30, 0x80,
+0x01, 0x50, 0x70, 0xF1, 0x2F, 0x00, 0x60, 0x2F, 0x03, 0x60, 0x2F, 0x01, 0x60, 0xF0, 0x2D, 0x60,
+0xF0, 0x20, 0xF0, 0x60, 0x70, 0x50, 0x01, 0xB0, 0x80, 0xE0, 0x70, 0x80, 0xA0, 0x60, 0xC0, 0xF0,
+0xC0, 0xF1, 0xC1, 0x61, 0xC0, 0x20, 0xF0, 0xC1, 0xF0, 0x2A, 0x60, 0xF0, 0x29, 0xC1, 0x2A, 0xC0,
+0x2B, 0x60, 0xF2, 0xC0, 0x10, 0x30, 0x02, 0xA0, 0x01, 0x90, 0x0B, 0x91, 0xA0, 0xF0, 0xC0, 0x61,
+0xC0, 0xA0, 0x04, 0x40, 0x06, 0x30, 0x90, 0x01, 0x90, 0x30, 0x80, 0x90, 0x06, 0x50, 0x70, 0xD0,
+0x70, 0xA0, 0x01, 0xD0, 0x40, 0x0F, 0x00, 0x50, 0x90, 0x0F, 0x02, 0xB0, 0x40, 0x0F, 0x01, 0x40,
+0xD0, 0x01, 0xB0, 0x30, 0xA0, 0x50, 0x0F, 0x34, 0x0F, 0x2A, 0x90, 0x81, 0x06, 0x80, 0x40, 0x00,
+0x40, 0x80, 0x50, 0xA0, 0xF1, 0x2F, 0x00, 0xF0, 0xC0, 0x60, 0x2F, 0x02, 0xC0, 0x60, 0xF0, 0x2D,
+0xF0, 0x60, 0x2E, 0x60, 0x22, 0xF1, 0xA0, 0x30, 0xA0, 0xD0, 0x80, 0x60, 0x80, 0x60, 0xF0, 0x60,
+0xF0, 0x21, 0x61, 0xC1, 0xF1, 0x22, 0xF0, 0x60, 0x2B, 0x60, 0xF0, 0x29, 0xC0, 0x60, 0x2A, 0xC0,
+0x2B, 0x60, 0xF0, 0x30, 0x80, 0x10, 0x70, 0x02, 0xE0, 0x50, 0x00, 0xB0, 0x90, 0x0B, 0x40, 0x00,
+0xA0, 0xF3, 0x60, 0x30, 0x90, 0x50, 0x01, 0xB0, 0x50, 0x06, 0x80, 0xD0, 0x31, 0x01, 0x40, 0xA0,
+0xB0, 0x04, 0x50, 0x90, 0x10, 0xE0, 0xB0, 0x10, 0x50, 0x00, 0x90, 0x05, 0x90, 0x09, 0x40, 0x0F,
+0x03, 0x40, 0x0F, 0x03, 0x40, 0xD0, 0x00, 0xA0, 0xB0, 0x00, 0xA0, 0xB0, 0x0F, 0x33, 0x0F, 0x2A,
+0x40, 0xE0, 0x30, 0x05, 0x30, 0x70, 0x02, 0x80, 0xD0, 0xF1, 0x2F, 0x03, 0xC0, 0x60, 0xF0, 0x2F,
+0x00, 0xF0, 0x60, 0xC0, 0x2E, 0xF0, 0x60, 0x2E, 0x60, 0x23, 0xF0, 0xC1, 0xF5, 0xC0, 0x62, 0x28,
+0xF0, 0x60, 0x2A, 0xF0, 0x60, 0x2B, 0x60, 0x2A, 0x60, 0x29, 0xF0, 0x20, 0xC0, 0x60, 0x11, 0xA0,
+0x03, 0xD0, 0x01, 0x51, 0x0A, 0x51, 0xE0, 0x60, 0xF0, 0x21, 0xF0, 0x70, 0xB0, 0x00, 0x50, 0x42,
+0xB0, 0x01, 0xD0, 0xA0, 0x03, 0x40, 0x30, 0x10, 0xE0, 0x70, 0x42, 0x04, 0x90, 0x10, 0x70, 0xD0,
+0x10, 0xA0, 0x30, 0x00, 0x90, 0x04, 0xB0, 0x10, 0x08, 0x40, 0xB0, 0x0F, 0x02, 0x40, 0x0F, 0x05,
+0x90, 0x10, 0x03, 0x10, 0x50, 0x0F, 0x32, 0x0F, 0x2B, 0x90, 0xB0, 0x04, 0x80, 0x41, 0x80, 0x00,
+0x50, 0x70, 0x90, 0x60, 0x2F, 0x05, 0xC1, 0x2F, 0x01, 0xF0, 0x60, 0xF0, 0x2D, 0xF0, 0xC1, 0x2C,
+0xF0, 0x60, 0x25, 0xF0, 0x23, 0xC0, 0x62, 0xF2, 0x27, 0xF0, 0x60, 0x2B, 0x60, 0xC0, 0x2A, 0x60,
+0x29, 0xF0, 0x60, 0x2B, 0x60, 0x50, 0x90, 0x10, 0x40, 0x03, 0x70, 0x10, 0x41, 0x0B, 0x40, 0x00,
+0x80, 0xC0, 0x21, 0xF0, 0x60, 0x30, 0x04, 0x40, 0x91, 0xB0, 0x00, 0xD0, 0x51, 0x90, 0x03, 0x10,
+0xA0, 0xB0, 0x41, 0x05, 0xB0, 0xD0, 0x30, 0x40, 0xA0, 0x50, 0x70, 0x06, 0x30, 0x50, 0x06, 0x51,
+0x0F, 0x02, 0x40, 0x0F, 0x06, 0x40, 0x90, 0xD0, 0x01, 0x70, 0x00, 0xA0, 0x50, 0x0F, 0x31, 0x0F,
+0x28, 0xE0, 0x70, 0xA0, 0xB0, 0x04, 0xE0, 0x40, 0x01, 0x40, 0x30, 0xA0, 0xF1, 0xC0, 0x60, 0xF0,
+0x2F, 0x03, 0xF0, 0x60, 0x20, 0xF0, 0x2F, 0x01, 0x60, 0xF0, 0x2E, 0x60, 0x2D, 0xC0, 0x60, 0xF0,
+0x24, 0xF0, 0xC0, 0x61, 0xC0, 0x21, 0x60, 0xF1, 0x28, 0xF0, 0xC1, 0xF0, 0x29, 0xC1, 0x2A, 0x60,
+0x29, 0xF0, 0x60, 0xC0, 0x29, 0xC1, 0x60, 0x11, 0x90, 0x04, 0xA0, 0xD0, 0x30, 0xD0, 0x0A, 0x90,
+0x00, 0xA0, 0xF1, 0x20, 0xC0, 0x70, 0x90, 0x03, 0x50, 0xB0, 0x01, 0x50, 0x90, 0x30, 0xA0, 0x10,
+0xD0, 0x03, 0xB0, 0x40, 0x00, 0x40, 0x90, 0x07, 0xD0, 0x01, 0xB0, 0x90, 0xA0, 0x90, 0x0D, 0x40,
+0x0F, 0x02, 0x90, 0x50, 0x0F, 0x05, 0x40, 0x01, 0x40, 0xD0, 0x30, 0x02, 0xA0, 0xB0, 0x0F, 0x30,
+0x0F, 0x27, 0x50, 0x70, 0xB0, 0x40, 0x10, 0x90, 0x02, 0x90, 0xD0, 0x40, 0x01, 0x50, 0x70, 0xF1,
+0x20, 0xF0, 0xC0, 0x60, 0x2F, 0x05, 0x60, 0x2F, 0x02, 0xC1, 0x2E, 0xC0, 0x60, 0xF0, 0x2C, 0x60,
+0xF1, 0x22, 0xC0, 0x60, 0xC1, 0x23, 0xC1, 0x2B, 0x60, 0xF0, 0x29, 0xC1, 0x29, 0xF0, 0x60, 0x29,
+0xF0, 0x60, 0xC0, 0x29, 0xC1, 0x70, 0xB0, 0x50, 0x03, 0xB0, 0x00, 0x80, 0x00, 0x50, 0xD0, 0x90,
+0x09, 0x50, 0xA0, 0x60, 0xF0, 0x20, 0xF0, 0x80, 0x30, 0x04, 0x90, 0xB0, 0xD1, 0x00, 0x90, 0x70,
+0xE1, 0x30, 0x50, 0x01, 0xA1, 0xB0, 0x00, 0x30, 0xB0, 0x07, 0x80, 0x30, 0x40, 0xE0, 0x01, 0xA0,
+0xB0, 0x05, 0x70, 0xE0, 0x03, 0x40, 0x0F, 0x02, 0x51, 0x0F, 0x05, 0x40, 0x03, 0x40, 0xD0, 0x02,
+0xA0, 0x70, 0x07, 0x90, 0xB0, 0x0F, 0x26, 0x0F, 0x27, 0x90, 0xA0, 0x01, 0xB0, 0x10, 0x50, 0x00,
+0x90, 0xA0, 0x00, 0xE0, 0x80, 0xB0, 0x70, 0xF1, 0x22, 0xF0, 0x61, 0x2F, 0x05, 0x60, 0xF0, 0x2F,
+0x00, 0xF0, 0x60, 0x2E, 0xF0, 0x60, 0xC0, 0x2C, 0xC0, 0x60, 0xF0, 0x20, 0x61, 0xC0, 0xF1, 0x25,
+0x60, 0x2B, 0x60, 0x29, 0xF1, 0x60, 0x29, 0xF0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x28, 0xF0, 0xC0,
+0x70, 0xE0, 0x00, 0xE0, 0xB0, 0x01, 0x32, 0xE0, 0xB0, 0x50, 0xE0, 0x10, 0x50, 0x07, 0x50, 0x70,
+0x60, 0xF3, 0x81, 0x04, 0x40, 0x00, 0xE0, 0xA0, 0x12, 0x50, 0xA1, 0x70, 0xA0, 0x40, 0xD0, 0x30,
+0x01, 0x30, 0x0A, 0x41, 0xA0, 0x00, 0xE0, 0x40, 0x05, 0x90, 0x10, 0x50, 0x01, 0x90, 0x50, 0x0F,
+0x01, 0x50, 0x90, 0x0F, 0x05, 0xE0, 0x05, 0x90, 0x10, 0x00, 0xA0, 0xB1, 0xA0, 0x04, 0xB0, 0xA0,
+0xD0, 0x70, 0x0F, 0x26, 0x0F, 0x25, 0x50, 0x01, 0xD0, 0x40, 0x01, 0xB0, 0xA0, 0x50, 0xD0, 0x02,
+0xE0, 0xD0, 0xF0, 0x25, 0xF0, 0xC0, 0x60, 0xF1, 0x2F, 0x03, 0x60, 0xF0, 0x2F, 0x01, 0x60, 0x2D,
+0xF0, 0xC0, 0x60, 0xF0, 0x2A, 0xF1, 0x62, 0xC0, 0xF0, 0x28, 0x60, 0x2B, 0x60, 0xC0, 0x28, 0xF1,
+0x60, 0x29, 0xF0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x27, 0xF1, 0xC0, 0x10, 0x00, 0x30, 0x10, 0x50,
+0x00, 0xE0, 0x40, 0x02, 0xB0, 0x50, 0x00, 0xE0, 0x40, 0x07, 0x81, 0xF0, 0x20, 0xF0, 0x71, 0xA0,
+0xB0, 0x03, 0x90, 0xB0, 0x01, 0x40, 0xD0, 0x11, 0xD0, 0x11, 0xE1, 0x30, 0x80, 0xD0, 0xA0, 0x91,
+0x0A, 0x40, 0xA0, 0x32, 0x07, 0xB1, 0x00, 0xB0, 0x90, 0x0F, 0x01, 0xB0, 0x40, 0x0F, 0x04, 0xB0,
+0x40, 0x07, 0x90, 0x10, 0x02, 0x50, 0x70, 0x03, 0xA0, 0x70, 0x00, 0x40, 0x70, 0x0F, 0x25, 0x0F,
+0x25, 0x10, 0xE0, 0x01, 0xD0, 0x30, 0x00, 0x50, 0xD0, 0x30, 0xE1, 0x01, 0xA0, 0xC0, 0xF0, 0x27,
+0xC0, 0x60, 0x2F, 0x03, 0xF0, 0xC1, 0x2F, 0x01, 0xC1, 0x2E, 0x60, 0xC0, 0xF0, 0x28, 0xF0, 0xC0,
+0x62, 0xF0, 0x2A, 0xC1, 0xF0, 0x29, 0xC1, 0xF0, 0x28, 0xF0, 0x60, 0x29, 0xF0, 0xC1, 0x28, 0xF0,
+0x60, 0x26, 0xF0, 0xC0, 0x80, 0xF0, 0x30, 0x80, 0x00, 0x11, 0x90, 0x00, 0x30, 0x50, 0x10, 0x01,
+0x50, 0xB0, 0x09, 0x30, 0x80, 0xF0, 0x22, 0xC0, 0xD0, 0x05, 0x40, 0x02, 0x40, 0x12, 0xB1, 0x40,
+0x10, 0xA0, 0x70, 0x80, 0x30, 0x40, 0x80, 0x00, 0xE0, 0x40, 0x50, 0x06, 0x40, 0x50, 0x70, 0xD0,
+0x70, 0x30, 0x04, 0x50, 0xB0, 0x03, 0x40, 0x0F, 0x02, 0x40, 0x0F, 0x04, 0xB0, 0x40, 0x09, 0xE0,
+0xA0, 0x01, 0xA0, 0x40, 0x30, 0x00, 0x30, 0x40, 0x00, 0x90, 0x30, 0x00, 0x90, 0x0F, 0x25, 0x0F,
+0x25, 0x71, 0x30, 0x01, 0x80, 0xD0, 0x70, 0xA0, 0x01, 0xE0, 0x80, 0xA0, 0xC0, 0xF0, 0x28, 0xF0,
+0xC0, 0x60, 0x2F, 0x03, 0xF0, 0x60, 0xC0, 0x2F, 0x00, 0xF0, 0x60, 0x2E, 0xF0, 0x60, 0xF0, 0x28,
+0x61, 0xC0, 0xF0, 0x60, 0xF0, 0x2B, 0x60, 0xF0, 0x29, 0xF0, 0x60, 0xF0, 0x29, 0xC0, 0x29, 0xF0,
+0xC1, 0x28, 0xF0, 0x60, 0x25, 0xF1, 0xA0, 0x10, 0x80, 0x30, 0x81, 0x10, 0x50, 0x00, 0xB0, 0x30,
+0x00, 0x10, 0x40, 0x00, 0x90, 0x09, 0x90, 0xA0, 0xC0, 0xF0, 0x22, 0xF0, 0xA0, 0x04, 0xB0, 0x90,
+0x03, 0x30, 0x10, 0xE0, 0x02, 0xE1, 0x70, 0x80, 0x70, 0x80, 0x30, 0x50, 0xA0, 0x90, 0x30, 0xE0,
+0xB0, 0x03, 0xB0, 0x90, 0x08, 0x40, 0xE0, 0xA0, 0x02, 0xE0, 0xB0, 0x0F, 0x01, 0x40, 0x0F, 0x05,
+0x40, 0x0B, 0x31, 0xA0, 0xB0, 0x00, 0x40, 0xE0, 0xA0, 0xB0, 0x01, 0xD0, 0x01, 0x50, 0xB0, 0x0F,
+0x23, 0x0F, 0x25, 0x30, 0x00, 0x30, 0xD0, 0x02, 0xD0, 0x40, 0x02, 0x70, 0x60, 0xF0, 0x2A, 0xF0,
+0xC0, 0x60, 0x2F, 0x03, 0xF0, 0x60, 0xC0, 0xF0, 0x2E, 0xF0, 0x60, 0x2D, 0xF0, 0xC1, 0xF0, 0x23,
+0xF0, 0xC0, 0x61, 0x20, 0xF0, 0x20, 0xF0, 0xC1, 0x2B, 0x60, 0xC0, 0x29, 0xF0, 0x60, 0x2A, 0xC1,
+0xF0, 0x27, 0xF0, 0xC1, 0x28, 0xF0, 0x60, 0xC0, 0x24, 0xF0, 0x80, 0xD0, 0x70, 0x10, 0x80, 0x11,
+0xE0, 0x01, 0x41, 0x01, 0x50, 0x90, 0xA1, 0xB0, 0x05, 0x50, 0x90, 0x70, 0xE0, 0xC0, 0xF0, 0x21,
+0xF0, 0x60, 0x40, 0x04, 0x90, 0x01, 0xB1, 0x00, 0xD0, 0x70, 0x00, 0x80, 0x03, 0x30, 0x80, 0xD0,
+0x90, 0x30, 0x81, 0x50, 0x00, 0x50, 0x80, 0x31, 0x01, 0xE0, 0x09, 0x80, 0xA1, 0x01, 0xB0, 0x80,
+0x11, 0x50, 0x0D, 0x90, 0xB0, 0x0F, 0x04, 0xE0, 0x0D, 0xA0, 0x80, 0x02, 0xD0, 0x70, 0x30, 0x90,
+0xD0, 0x40, 0x50, 0x10, 0xA0, 0xD0, 0x90, 0x0F, 0x22, 0x0F, 0x22, 0x41, 0x03, 0xE0, 0xD0, 0xB0,
+0xA0, 0xB0, 0x80, 0xE0, 0x00, 0xA0, 0x60, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0x2F, 0x02, 0xF1, 0x60,
+0xC0, 0x2E, 0xF0, 0xC1, 0xF0, 0x2C, 0xF0, 0x60, 0x22, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x23, 0xF0,
+0x60, 0x2B, 0xC1, 0xF0, 0x29, 0xC1, 0x28, 0xF0, 0x20, 0x60, 0xF0, 0x27, 0xF0, 0xC1, 0xF0, 0x27,
+0xF0, 0x60, 0x24, 0xF1, 0x70, 0xA0, 0x70, 0x90, 0x40, 0xB0, 0x50, 0x02, 0x41, 0x03, 0x80, 0x10,
+0x07, 0x10, 0xA0, 0x60, 0xF0, 0x23, 0x60, 0x30, 0x04, 0x40, 0xE1, 0x10, 0xE0, 0x00, 0x10, 0x30,
+0xE0, 0x10, 0x30, 0x00, 0xA0, 0x30, 0xA0, 0x10, 0x90, 0x30, 0x00, 0x80, 0xB1, 0x40, 0x50, 0x01,
+0x90, 0xA0, 0x51, 0x0E, 0x40, 0x01, 0x90, 0xB0, 0x0C, 0x90, 0x50, 0x0F, 0x04, 0x40, 0x03, 0xE0,
+0xD1, 0x08, 0xD0, 0x40, 0x00, 0xA0, 0xB0, 0x80, 0x30, 0x80, 0x50, 0x40, 0xD0, 0xB0, 0x00, 0x50,
+0xA0, 0x0F, 0x22, 0x0F, 0x21, 0x31, 0x70, 0x40, 0x03, 0x50, 0x30, 0xE0, 0x01, 0x40, 0xD0, 0x60,
+0xF1, 0x2E, 0xC0, 0x60, 0x2F, 0x02, 0xF0, 0x20, 0x60, 0xF0, 0x2F, 0x00, 0xC1, 0x2E, 0x60, 0xF0,
+0x20, 0x61, 0xC0, 0xF0, 0x25, 0xF0, 0x60, 0xC0, 0x2B, 0x60, 0xF0, 0x2A, 0x60, 0x20, 0xF0, 0x20,
+0xF0, 0x26, 0x60, 0xF0, 0x29, 0x60, 0xF0, 0x27, 0xF0, 0x60, 0xC0, 0x22, 0xF1, 0x80, 0xD0, 0x10,
+0x80, 0x00, 0x40, 0x05, 0xA0, 0x02, 0xB0, 0x40, 0x10, 0x07, 0x80, 0xE0, 0x60, 0xF0, 0x23, 0xF0,
+0xA0, 0x50, 0x02, 0x51, 0x30, 0x10, 0xD0, 0xE0, 0x00, 0x14, 0xE0, 0x10, 0x70, 0x50, 0xD0, 0x50,
+0x30, 0x00, 0x10, 0x90, 0x01, 0x50, 0x40, 0x50, 0x00, 0x50, 0x30, 0x0E, 0x40, 0xB0, 0x0F, 0x00,
+0x50, 0x90, 0x0F, 0x03, 0xB0, 0x40, 0x05, 0x10, 0x40, 0x09, 0xD0, 0x70, 0x02, 0xA0, 0xB1, 0xD0,
+0xB0, 0x01, 0x81, 0x0F, 0x22, 0x0F, 0x20, 0xB0, 0xD0, 0x00, 0x90, 0x10, 0x70, 0x90, 0x01, 0x40,
+0x10, 0xD0, 0xB0, 0x00, 0x40, 0x30, 0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0x2F, 0x03, 0xC0, 0x60,
+0x2F, 0x00, 0xF0, 0x60, 0x2D, 0xF0, 0x62, 0xC0, 0xF0, 0x20, 0xF0, 0x27, 0x60, 0xF0, 0x29, 0xF0,
+0x60, 0xC0, 0x2A, 0x60, 0xF0, 0x20, 0xF2, 0x25, 0x60, 0xF0, 0x29, 0x60, 0xF0, 0x27, 0xF0, 0x60,
+0x22, 0xF0, 0x60, 0xD0, 0x12, 0xE0, 0x00, 0x90, 0x05, 0xA0, 0x02, 0x50, 0xB0, 0x50, 0x06, 0x90,
+0x70, 0x60, 0xC0, 0x24, 0xF0, 0xC0, 0xA0, 0x02, 0x90, 0x01, 0x10, 0x00, 0x40, 0xB0, 0xD0, 0x11,
+0x90, 0xB0, 0x50, 0x10, 0x30, 0xB0, 0xE0, 0x10, 0xE0, 0x00, 0x90, 0x81, 0x02, 0x50, 0x41, 0x30,
+0x0D, 0x51, 0x0F, 0x00, 0xB0, 0x40, 0x0F, 0x04, 0x40, 0x05, 0x80, 0x10, 0xB0, 0x0A, 0xD0, 0x50,
+0x00, 0xE0, 0x10, 0xD0, 0xE1, 0x01, 0xE0, 0x70, 0x00, 0x40, 0x80, 0x0F, 0x20, 0x0F, 0x21, 0xA0,
+0x00, 0x80, 0x90, 0x50, 0xD0, 0xB0, 0x50, 0x30, 0x50, 0x11, 0x80, 0xA0, 0xF0, 0x2F, 0x04, 0xC0,
+0x60, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0xF0, 0x2F, 0x00, 0x60, 0xF0, 0x2A, 0xF0, 0xC0, 0x61, 0xF0,
+0x2B, 0x60, 0xC0, 0x2B, 0x60, 0xF0, 0x29, 0x60, 0xF1, 0x30, 0x80, 0x60, 0xF0, 0x24, 0x60, 0x2A,
+0x60, 0xF0, 0x27, 0xF0, 0x60, 0x21, 0xF1, 0xC0, 0xD0, 0x30, 0xA0, 0x10, 0x40, 0x00, 0x90, 0x04,
+0xE0, 0xA0, 0x02, 0x90, 0xB0, 0x07, 0x30, 0x60, 0xC0, 0x25, 0xF1, 0xA0, 0x02, 0x40, 0x00, 0x50,
+0x10, 0x50, 0x10, 0x00, 0x30, 0xD0, 0x00, 0x30, 0x01, 0xE0, 0x80, 0x10, 0xA0, 0x70, 0x03, 0x80,
+0x40, 0x02, 0xB0, 0xE1, 0x0D, 0x40, 0x00, 0xA0, 0xD0, 0x0D, 0x40, 0x01, 0xB0, 0x0F, 0x01, 0xE0,
+0x05, 0xE0, 0x10, 0x0C, 0xB0, 0xD0, 0x30, 0x10, 0xA0, 0xB0, 0xD0, 0x70, 0x40, 0x71, 0x00, 0xB0,
+0xE0, 0x50, 0xE0, 0x0F, 0x1F, 0x0F, 0x26, 0x30, 0x90, 0x70, 0x02, 0xD1, 0xF1, 0x2F, 0x04, 0xF0,
+0xC0, 0x60, 0x2F, 0x02, 0xF0, 0xC1, 0xF0, 0x2E, 0xC0, 0x60, 0xF0, 0x23, 0xF0, 0x24, 0x60, 0xC0,
+0xF0, 0x60, 0xC0, 0xF0, 0x2B, 0x60, 0xF0, 0x2A, 0x60, 0xF0, 0x29, 0xC1, 0xA0, 0x11, 0x30, 0xF0,
+0x24, 0xC1, 0x29, 0x60, 0xF0, 0x28, 0x60, 0x20, 0xF1, 0x70, 0xA0, 0x11, 0x90, 0x00, 0xB1, 0x50,
+0x05, 0x30, 0x50, 0x01, 0x90, 0x09, 0xA0, 0x60, 0xF0, 0x25, 0xF0, 0x60, 0x80, 0x00, 0x51, 0x01,
+0x10, 0x70, 0xE0, 0x00, 0x40, 0x12, 0x00, 0xB0, 0x90, 0x01, 0x90, 0x40, 0x04, 0x81, 0x01, 0xE0,
+0x31, 0x40, 0x50, 0x0A, 0x40, 0x00, 0x70, 0xD0, 0xE0, 0x0C, 0x40, 0x01, 0x40, 0x10, 0x0F, 0x00,
+0x40, 0x05, 0x70, 0x10, 0x0E, 0x40, 0x10, 0xE0, 0x01, 0x50, 0x70, 0xE0, 0x50, 0x02, 0xE0, 0x30,
+0xB0, 0x0F, 0x1F, 0x0F, 0x24, 0x81, 0xA0, 0x30, 0x80, 0x40, 0x01, 0xA0, 0xC0, 0x60, 0xF0, 0x2F,
+0x06, 0xC0, 0x60, 0x2F, 0x03, 0x60, 0xC0, 0xF1, 0x2C, 0xF0, 0x60, 0xC0, 0x25, 0xF1, 0xC0, 0x60,
+0x20, 0xF2, 0x60, 0x2B, 0xF0, 0x60, 0x2B, 0xC1, 0x2A, 0x61, 0x70, 0xA0, 0xF0, 0x25, 0xC0, 0x60,
+0x29, 0x60, 0xF0, 0x28, 0x60, 0xF0, 0xC0, 0x70, 0x11, 0x40, 0xB0, 0x02, 0x51, 0x05, 0x50, 0xE0,
+0x01, 0x40, 0x08, 0xB0, 0xA0, 0xC0, 0xF0, 0x26, 0xF0, 0xA0, 0xB0, 0x90, 0x01, 0x90, 0x11, 0x30,
+0x01, 0xE0, 0x80, 0x70, 0x00, 0x90, 0xB0, 0x01, 0x80, 0xA0, 0x80, 0x04, 0xE1, 0x90, 0x40, 0xB0,
+0x01, 0x50, 0x40, 0xB0, 0x07, 0x90, 0xB0, 0x00, 0x30, 0x70, 0xA0, 0x30, 0x40, 0x50, 0x08, 0x90,
+0xB0, 0x00, 0xB0, 0x70, 0xA0, 0x0D, 0xB0, 0x40, 0x03, 0xB0, 0xD0, 0x80, 0x10, 0xB0, 0x0D, 0x51,
+0xE0, 0x30, 0x01, 0x30, 0x80, 0x40, 0x0F, 0x26, 0x0F, 0x24, 0xE0, 0x40, 0x30, 0x50, 0x00, 0x81,
+0x30, 0x60, 0xF0, 0x20, 0x60, 0x2F, 0x06, 0xF0, 0x60, 0xC0, 0x2F, 0x02, 0xF0, 0x60, 0x2F, 0x01,
+0x60, 0xF0, 0x23, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x23, 0xC1, 0x2C, 0x60, 0xF0, 0x2A, 0x60, 0x29,
+0xF0, 0x60, 0xF0, 0x31, 0xF0, 0x26, 0x60, 0x29, 0x60, 0xF0, 0x28, 0x60, 0xC0, 0x10, 0xD1, 0x80,
+0x10, 0xB0, 0x02, 0x50, 0xB0, 0x05, 0xB0, 0x80, 0x01, 0x40, 0x08, 0xB0, 0x70, 0xC0, 0xF1, 0x25,
+0xF0, 0x80, 0x91, 0x02, 0x90, 0xA0, 0x10, 0x40, 0x02, 0x50, 0x00, 0x90, 0x01, 0x50, 0xD0, 0x70,
+0xA0, 0x01, 0xB0, 0x02, 0xE0, 0x80, 0x30, 0x04, 0x91, 0x05, 0xB0, 0x90, 0x00, 0x40, 0x30, 0xB0,
+0xD0, 0x50, 0x90, 0x70, 0xE0, 0x06, 0x90, 0x50, 0x01, 0x11, 0xA0, 0x0D, 0x40, 0x04, 0x80, 0x10,
+0x30, 0x80, 0x0D, 0x91, 0x01, 0xA0, 0x80, 0xA0, 0xB0, 0x00, 0x30, 0x90, 0x0F, 0x25, 0x0F, 0x25,
+0xE0, 0x80, 0x02, 0xA0, 0x80, 0xF0, 0x22, 0x60, 0xC0, 0x2F, 0x06, 0xC0, 0x60, 0x2F, 0x02, 0xF0,
+0x60, 0x2F, 0x00, 0xC0, 0x60, 0xF0, 0x20, 0xF1, 0x61, 0x20, 0xF0, 0x24, 0xF0, 0x60, 0x2C, 0x60,
+0xF0, 0x29, 0xF0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x60, 0x20, 0xF0, 0x25, 0xF0, 0x60, 0x29, 0x60,
+0xF0, 0x27, 0xF0, 0x60, 0x10, 0xA0, 0x10, 0x80, 0x50, 0x30, 0x03, 0x50, 0xB0, 0x05, 0x50, 0xE0,
+0x00, 0xB0, 0x50, 0x08, 0xE0, 0x70, 0xF0, 0x27, 0xF0, 0x60, 0xA0, 0x0B, 0x50, 0x30, 0x90, 0xA1,
+0x60, 0xF0, 0x60, 0x70, 0x30, 0xA0, 0x70, 0x40, 0x00, 0x50, 0xE0, 0xB0, 0x05, 0xB0, 0x40, 0xB0,
+0x03, 0x40, 0x02, 0x80, 0x10, 0x30, 0x01, 0xA0, 0xE0, 0x05, 0x50, 0x90, 0x03, 0x50, 0x10, 0x40,
+0x0B, 0xE0, 0x06, 0x40, 0x10, 0x50, 0x0C, 0x40, 0x50, 0x03, 0xD0, 0x90, 0x02, 0xD0, 0x0F, 0x25,
+0x0F, 0x24, 0x50, 0x82, 0x00, 0xE0, 0x30, 0xF0, 0x23, 0xF0, 0x61, 0xF0, 0x2F, 0x04, 0xF0, 0xC0,
+0x60, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0x2E, 0xF0, 0x60, 0xC0, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x27,
+0xC0, 0x60, 0x2C, 0x60, 0xF0, 0x29, 0xC1, 0x29, 0xC1, 0x70, 0xC0, 0x26, 0xF0, 0x60, 0x29, 0x60,
+0x28, 0xF0, 0x60, 0x11, 0x81, 0x30, 0x03, 0x10, 0xD0, 0x06, 0xB0, 0x30, 0x00, 0x50, 0xE0, 0x08,
+0x40, 0x80, 0xF0, 0x27, 0xF0, 0x60, 0x30, 0x0B, 0x80, 0xD0, 0x30, 0xF2, 0x20, 0xF1, 0x80, 0xA0,
+0x30, 0xA0, 0xB0, 0x40, 0x09, 0x40, 0x90, 0x01, 0x40, 0xB0, 0x04, 0xE0, 0xA0, 0xD0, 0x70, 0x40,
+0x04, 0xB0, 0x40, 0x05, 0x90, 0x10, 0xE0, 0x09, 0x40, 0x07, 0x80, 0xD0, 0x0C, 0x40, 0x06, 0x10,
+0x00, 0xB0, 0xA0, 0x90, 0x70, 0x0F, 0x24, 0x0F, 0x24, 0xA0, 0x01, 0x40, 0xA1, 0xF0, 0x25, 0xF0,
+0xC0, 0x60, 0xF1, 0x2F, 0x04, 0xC0, 0x60, 0x2F, 0x02, 0xC0, 0x60, 0x2D, 0xF1, 0x60, 0xC0, 0x60,
+0x20, 0xF0, 0x28, 0xF0, 0xC1, 0x2A, 0xF0, 0x60, 0x2B, 0x60, 0xF0, 0x29, 0x60, 0xF0, 0x27, 0xF0,
+0x60, 0x29, 0x60, 0xC0, 0x26, 0xF1, 0x30, 0x80, 0x00, 0xA0, 0x90, 0xB0, 0x04, 0x40, 0x07, 0x40,
+0xA0, 0x90, 0xA1, 0x07, 0xB0, 0xE0, 0xF0, 0x26, 0xF1, 0x60, 0x90, 0x0A, 0x90, 0x10, 0xC0, 0xF0,
+0x23, 0xF0, 0x60, 0x70, 0x02, 0x90, 0xB0, 0x0A, 0xB0, 0x40, 0x51, 0x07, 0x40, 0xE0, 0x05, 0x40,
+0x07, 0x80, 0xA0, 0x08, 0x40, 0x08, 0x90, 0x10, 0x40, 0x09, 0x50, 0x40, 0x07, 0x50, 0xD0, 0x30,
+0xB0, 0x00, 0x90, 0xE0, 0x0F, 0x23, 0x0F, 0x23, 0xA0, 0xE0, 0x02, 0x70, 0xF1, 0x26, 0xF0, 0xC0,
+0x60, 0x2F, 0x05, 0xF0, 0xC0, 0x60, 0x2F, 0x02, 0xC1, 0xF0, 0x2B, 0xF0, 0xC0, 0x61, 0xF0, 0x2C,
+0x60, 0xF0, 0x2A, 0xC0, 0x60, 0xF0, 0x29, 0x60, 0x2A, 0x60, 0xF0, 0x27, 0xF0, 0xC1, 0x28, 0xC1,
+0x27, 0xF0, 0x60, 0x10, 0x40, 0x03, 0x90, 0x02, 0x90, 0x08, 0x50, 0xA0, 0x09, 0x50, 0xA0, 0xF0,
+0x27, 0xF0, 0xC0, 0xA0, 0xB0, 0x08, 0x30, 0x80, 0x60, 0xF0, 0x23, 0xF0, 0x30, 0xD0, 0x50, 0x01,
+0xB0, 0x90, 0x0D, 0x30, 0x50, 0x0E, 0x40, 0x0F, 0x03, 0x40, 0x0A, 0x10, 0xD0, 0x08, 0x50, 0x40,
+0x09, 0xE0, 0x30, 0x02, 0xD0, 0x90, 0x0F, 0x22, 0x0F, 0x22, 0xE1, 0x81, 0x00, 0xA0, 0xC0, 0xF0,
+0x28, 0xF0, 0x20, 0x60, 0xC0, 0x2F, 0x05, 0xC0, 0x60, 0x2F, 0x01, 0xF0, 0x60, 0xC0, 0x2A, 0xF0,
+0xC0, 0x60, 0xF0, 0x60, 0xC0, 0xF0, 0x2B, 0xC1, 0x2A, 0xF0, 0x60, 0xF0, 0x29, 0xC0, 0x60, 0x28,
+0xF0, 0xC1, 0x28, 0xC1, 0x23, 0xF0, 0x23, 0xC1, 0x27, 0xF0, 0x60, 0x10, 0xD0, 0x01, 0xA0, 0x00,
+0x10, 0x02, 0x40, 0x09, 0x80, 0x09, 0x90, 0x30, 0xC0, 0xF0, 0x20, 0xF0, 0x25, 0x61, 0x70, 0xA1,
+0x40, 0x30, 0x02, 0x90, 0x70, 0x80, 0xC0, 0xF0, 0x23, 0xF0, 0xC0, 0x10, 0xB0, 0x02, 0x40, 0x0D,
+0x40, 0x00, 0x50, 0x40, 0x0C, 0x40, 0xB0, 0x0F, 0x02, 0x40, 0x0A, 0xE0, 0x40, 0x70, 0x01, 0x10,
+0x90, 0x03, 0x91, 0x0B, 0x70, 0x40, 0x00, 0x70, 0x50, 0xA0, 0xB0, 0x0F, 0x21, 0x0F, 0x21, 0x90,
+0x80, 0x01, 0x90, 0xD0, 0x80, 0xF0, 0x2B, 0xF0, 0x60, 0xC0, 0x2F, 0x04, 0xF0, 0xC0, 0x60, 0x2F,
+0x01, 0xF0, 0x60, 0x26, 0xF0, 0x22, 0x61, 0x20, 0xF0, 0x20, 0x60, 0xF0, 0x2C, 0x60, 0x2B, 0xC1,
+0xF0, 0x28, 0xF0, 0x60, 0xF0, 0x28, 0xC0, 0x60, 0x28, 0xF0, 0x60, 0x22, 0xF1, 0x24, 0x60, 0x26,
+0xF1, 0x30, 0xA0, 0xE0, 0x31, 0x10, 0xD0, 0x70, 0x02, 0x40, 0x02, 0x91, 0x02, 0x50, 0x70, 0x90,
+0x03, 0x10, 0xD0, 0x03, 0x90, 0x00, 0xD0, 0x60, 0xC0, 0xF1, 0x21, 0x60, 0xF0, 0xC0, 0x60, 0xF1,
+0xC1, 0x10, 0xD0, 0x40, 0x90, 0xA0, 0xD0, 0xC0, 0x60, 0xF1, 0x20, 0xC0, 0x60, 0xF0, 0xC0, 0x80,
+0x70, 0x02, 0x51, 0x0C, 0x51, 0x02, 0x40, 0x50, 0x09, 0x90, 0x50, 0x0F, 0x01, 0xB0, 0x40, 0x0C,
+0x10, 0x50, 0x00, 0x90, 0x70, 0x03, 0x40, 0x50, 0x0D, 0xD0, 0xA0, 0x01, 0xB0, 0xA0, 0x0F, 0x21,
+0x0F, 0x21, 0xD0, 0x40, 0x01, 0x50, 0xA0, 0xF0, 0x2B, 0xF0, 0x20, 0xF0, 0x61, 0xF1, 0x2F, 0x01,
+0xF0, 0x20, 0xC1, 0x2F, 0x00, 0xF0, 0x20, 0x60, 0x28, 0x60, 0x20, 0xF0, 0x21, 0xF0, 0x20, 0x60,
+0xF0, 0x2A, 0xF0, 0xC0, 0x60, 0xF0, 0x29, 0xF0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x28, 0xF0, 0x60,
+0x28, 0xF0, 0x60, 0x22, 0xF0, 0x60, 0x24, 0x60, 0x27, 0xF0, 0x80, 0xD0, 0x30, 0x50, 0x30, 0xB0,
+0x10, 0x03, 0x40, 0x02, 0xB0, 0x10, 0x90, 0x01, 0x50, 0x30, 0x50, 0x03, 0xB0, 0x50, 0x02, 0xB0,
+0x50, 0x00, 0xA2, 0x10, 0xF2, 0xD1, 0x60, 0x20, 0xF0, 0xA0, 0x30, 0xF0, 0x70, 0x80, 0x10, 0xA0,
+0xC0, 0xF0, 0xC1, 0x50, 0xD0, 0x70, 0x30, 0x80, 0xA0, 0x80, 0x90, 0xB0, 0x02, 0x40, 0x0C, 0xB0,
+0x40, 0x04, 0x91, 0x07, 0x50, 0x90, 0x0F, 0x01, 0xB0, 0x40, 0xB0, 0x0C, 0xE0, 0x11, 0xD0, 0x70,
+0x02, 0x40, 0xB0, 0x0E, 0x50, 0xD0, 0x02, 0xA0, 0x80, 0x0F, 0x20, 0x0F, 0x20, 0xA0, 0x50, 0xE0,
+0x80, 0x00, 0x70, 0xC0, 0x22, 0xF0, 0x2B, 0xF0, 0x61, 0x20, 0xF0, 0x2F, 0x02, 0xF0, 0xC0, 0x60,
+0x2F, 0x02, 0x60, 0x24, 0xF0, 0xC0, 0x60, 0xF1, 0x23, 0xF0, 0xC1, 0xF0, 0x2A, 0xF0, 0x60, 0xC0,
+0x29, 0xF0, 0xC1, 0x2A, 0x60, 0x28, 0xF0, 0x60, 0x29, 0x60, 0xC0, 0xF1, 0x30, 0xD0, 0xF0, 0x22,
+0xF0, 0x60, 0x27, 0xF0, 0x60, 0x70, 0x03, 0x50, 0x03, 0x40, 0x03, 0xE0, 0x10, 0x50, 0x01, 0x80,
+0x50, 0x08, 0x50, 0xB0, 0x80, 0xD0, 0x01, 0x10, 0x60, 0xF0, 0xC0, 0x10, 0x70, 0x60, 0xF0, 0x20,
+0xC0, 0xF2, 0x60, 0x30, 0xF2, 0x60, 0x71, 0x30, 0x08, 0x51, 0x05, 0x41, 0x04, 0x40, 0x06, 0x50,
+0x40, 0x05, 0x50, 0x90, 0x0F, 0x02, 0x40, 0x0F, 0x00, 0x51, 0xA0, 0x10, 0xA0, 0x00, 0xA0, 0x0F,
+0x02, 0x40, 0x30, 0xB0, 0xA0, 0x50, 0x80, 0x90, 0x0F, 0x1F, 0x0F, 0x1F, 0x41, 0x01, 0x50, 0x10,
+0xC0, 0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0x2F, 0x05, 0xC0, 0x60, 0x2F, 0x02, 0x60, 0xF0, 0x21,
+0xF0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0x60, 0xF0, 0x2C, 0x60, 0x2B, 0x60, 0xF0, 0x28, 0xF0, 0x60,
+0xF0, 0x27, 0xF0, 0xC1, 0xF0, 0x27, 0x60, 0xC0, 0xF0, 0x11, 0xC0, 0xF0, 0x22, 0xF0, 0x60, 0x27,
+0xF0, 0x60, 0x11, 0x06, 0xB0, 0x90, 0x04, 0x90, 0xD0, 0x01, 0x40, 0x80, 0x08, 0x90, 0x40, 0x10,
+0x03, 0xD0, 0x80, 0xF1, 0x60, 0xC0, 0x25, 0xF1, 0x20, 0xF0, 0xC0, 0xA0, 0xE0, 0x06, 0x30, 0x70,
+0xB0, 0x00, 0x40, 0x06, 0xA0, 0x70, 0x80, 0x02, 0x90, 0x50, 0x08, 0x40, 0xB0, 0x03, 0x40, 0x0F,
+0x02, 0xE0, 0x0F, 0x03, 0x50, 0x10, 0xE0, 0xA0, 0x90, 0x0F, 0x03, 0x71, 0x02, 0xA0, 0x0F, 0x1F,
+0x0F, 0x1E, 0xB0, 0xD0, 0x40, 0x01, 0xE0, 0x80, 0xF0, 0x2F, 0x05, 0x60, 0x20, 0xF0, 0x2F, 0x02,
+0xF0, 0xC0, 0x60, 0x2F, 0x01, 0xC1, 0xF0, 0x20, 0x60, 0xC0, 0x28, 0xF1, 0x60, 0xF0, 0x2A, 0xF0,
+0x60, 0xC0, 0x2A, 0xC1, 0x29, 0xC1, 0x28, 0xC0, 0x60, 0xF0, 0x27, 0xC2, 0xD0, 0x70, 0xF1, 0x22,
+0xF0, 0x60, 0x26, 0xF1, 0x80, 0x11, 0x00, 0xE0, 0x10, 0xA0, 0x02, 0xB0, 0x50, 0x05, 0xB0, 0x01,
+0xE1, 0x08, 0x90, 0x06, 0x70, 0xC0, 0xF0, 0x60, 0x28, 0xF0, 0x60, 0xA0, 0xB0, 0x06, 0x80, 0x90,
+0x00, 0xA0, 0x90, 0xB0, 0x05, 0x50, 0x70, 0x30, 0x02, 0xB0, 0x90, 0x0A, 0x40, 0x50, 0x01, 0x40,
+0x0F, 0x02, 0x40, 0x0F, 0x05, 0x90, 0xD0, 0x80, 0x0F, 0x05, 0xD0, 0xB0, 0x01, 0xA1, 0x0F, 0x1E,
+0x0F, 0x1E, 0x30, 0xB0, 0xE0, 0x30, 0x90, 0xA0, 0xF0, 0x2F, 0x07, 0x60, 0xC0, 0xF0, 0x2F, 0x02,
+0xF0, 0xC0, 0x60, 0x2F, 0x00, 0xF0, 0x62, 0x2C, 0xC1, 0xF0, 0x2B, 0x60, 0xF0, 0x2A, 0x60, 0xF0,
+0x29, 0x60, 0xF0, 0x28, 0x60, 0xF0, 0x27, 0xC2, 0x10, 0xA0, 0xF0, 0x23, 0xF0, 0x60, 0x27, 0xF0,
+0x80, 0xD0, 0x10, 0xE0, 0x10, 0xD0, 0x03, 0x50, 0xB0, 0x08, 0xE1, 0x07, 0x51, 0x02, 0x91, 0x01,
+0xD0, 0xC0, 0x20, 0x60, 0xF0, 0x25, 0xF2, 0xA0, 0x90, 0x07, 0xB0, 0xA0, 0x00, 0x80, 0x90, 0x0C,
+0x40, 0x0C, 0x90, 0x50, 0x40, 0x0F, 0x01, 0xB0, 0x40, 0x0F, 0x05, 0x90, 0xE0, 0x70, 0x0F, 0x06,
+0x50, 0x70, 0x50, 0xA0, 0xB0, 0xE0, 0x40, 0x0F, 0x1D, 0x0F, 0x15, 0xB0, 0x06, 0xE0, 0x40, 0x01,
+0x50, 0xD0, 0xC0, 0xF0, 0x2F, 0x08, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0x2F, 0x00,
+0xC0, 0x60, 0xC0, 0x2D, 0x60, 0xC0, 0xF0, 0x29, 0xF0, 0x60, 0xC0, 0x29, 0xF0, 0x60, 0x20, 0xF0,
+0x28, 0x60, 0x29, 0x60, 0xF0, 0x27, 0xF0, 0x60, 0xF0, 0x70, 0x80, 0xF0, 0x23, 0xF0, 0x60, 0x27,
+0xF0, 0x60, 0x80, 0xD0, 0x10, 0x70, 0xE0, 0x03, 0x90, 0xB0, 0x05, 0x90, 0x00, 0x50, 0xA0, 0xB0,
+0x07, 0x90, 0x01, 0xB1, 0x70, 0x10, 0x00, 0x30, 0x60, 0xF0, 0xC1, 0x25, 0xF0, 0x60, 0x30, 0xC0,
+0x80, 0x09, 0xB0, 0x30, 0xE0, 0x0C, 0x90, 0xB0, 0x0D, 0x41, 0x0F, 0x01, 0x40, 0x0F, 0x05, 0x40,
+0xB0, 0x0F, 0x09, 0x30, 0xD0, 0x02, 0x30, 0x0F, 0x1D, 0x0F, 0x14, 0x80, 0x30, 0x50, 0x04, 0xB0,
+0x10, 0x40, 0x01, 0x80, 0x62, 0xF0, 0x2F, 0x08, 0xC0, 0x60, 0xF1, 0x2F, 0x01, 0xF0, 0xC0, 0x60,
+0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x60, 0xF0, 0x2C, 0xF0, 0x60, 0x2B, 0xF0, 0x60, 0x2B, 0x60,
+0xF0, 0x28, 0xC1, 0xF0, 0x27, 0xC1, 0x27, 0xF0, 0x60, 0xF0, 0x60, 0xF0, 0x24, 0xF0, 0x60, 0x27,
+0xF0, 0xC0, 0x70, 0x10, 0xA0, 0x05, 0x90, 0x04, 0xA1, 0x10, 0x00, 0x70, 0x50, 0x08, 0x90, 0x00,
+0xA0, 0x11, 0xA0, 0x30, 0x11, 0x30, 0xF0, 0x60, 0xF0, 0x24, 0xF0, 0x80, 0xD0, 0xE0, 0xA0, 0x80,
+0x10, 0x50, 0x08, 0x40, 0xD0, 0x30, 0x90, 0x09, 0x50, 0x90, 0x0D, 0x51, 0x00, 0x40, 0x0E, 0xE0,
+0x0F, 0x04, 0xB0, 0x40, 0xB0, 0x0F, 0x09, 0x40, 0xB0, 0xD0, 0x50, 0x01, 0xA1, 0x0F, 0x1C, 0x0F,
+0x14, 0x30, 0x90, 0xE0, 0x04, 0x70, 0x00, 0xE0, 0xA0, 0x90, 0xA0, 0xF1, 0xC0, 0x60, 0xC0, 0x2F,
+0x07, 0xF0, 0xC0, 0x60, 0xF1, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0x29, 0xF0, 0x20, 0x61, 0xF1, 0x20,
+0x60, 0xF0, 0x2C, 0xC0, 0x60, 0xF0, 0x2A, 0xC0, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xC0, 0x29, 0x60,
+0xF0, 0x27, 0xF0, 0x60, 0x27, 0xF0, 0x60, 0xC0, 0xF0, 0x25, 0xF0, 0x60, 0x27, 0xF0, 0x60, 0x10,
+0xD0, 0x10, 0x80, 0x04, 0x40, 0x03, 0x90, 0x10, 0x40, 0x50, 0xB0, 0x30, 0xB0, 0x07, 0xB0, 0xE1,
+0x10, 0x00, 0xB0, 0x70, 0x30, 0xE0, 0x70, 0xF0, 0xC0, 0x60, 0x26, 0xC0, 0x80, 0xD0, 0x80, 0x90,
+0x70, 0x09, 0x90, 0xE0, 0x30, 0xD0, 0xB0, 0x08, 0x40, 0x0D, 0x50, 0x90, 0x02, 0x40, 0xB0, 0x0A,
+0xB0, 0x40, 0x0F, 0x04, 0x50, 0x40, 0x03, 0xD0, 0x40, 0x0F, 0x03, 0x90, 0x40, 0x02, 0xD0, 0x40,
+0xA0, 0x00, 0xE0, 0x40, 0x0F, 0x1B, 0x0F, 0x14, 0x50, 0xE0, 0x04, 0xE0, 0x90, 0x01, 0xB0, 0xD0,
+0xF0, 0x21, 0xF1, 0x61, 0x2F, 0x07, 0xF0, 0x20, 0x60, 0xC0, 0x2F, 0x01, 0xF0, 0x20, 0xC0, 0x60,
+0x27, 0xF0, 0x20, 0x60, 0xC0, 0xF0, 0x22, 0xC0, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0xC0, 0x2A, 0xF0,
+0x60, 0xC0, 0x29, 0xC0, 0x60, 0x28, 0xF0, 0x60, 0xC0, 0x27, 0xF0, 0x60, 0x28, 0xC1, 0xF0, 0x25,
+0xF0, 0xC1, 0x26, 0xF0, 0x60, 0xD1, 0x40, 0xA0, 0xB0, 0x03, 0x90, 0x04, 0x10, 0xE0, 0x30, 0xB0,
+0x80, 0x02, 0x80, 0xA0, 0x70, 0x40, 0x01, 0x40, 0x70, 0x10, 0xE0, 0x02, 0x30, 0x70, 0x60, 0xF0,
+0x60, 0xC0, 0x26, 0xC0, 0x30, 0xA0, 0xE0, 0xD0, 0x81, 0xE0, 0x10, 0x05, 0x90, 0xB0, 0x00, 0xB0,
+0x90, 0x08, 0x40, 0x0D, 0xB0, 0x40, 0x04, 0x40, 0xB0, 0x08, 0xB0, 0x40, 0xB0, 0x0F, 0x03, 0x50,
+0x90, 0x04, 0x10, 0x40, 0x0F, 0x01, 0xB0, 0x40, 0x50, 0x03, 0xE0, 0x70, 0x02, 0x30, 0xB0, 0x0F,
+0x1A, 0x0F, 0x13, 0x90, 0xB0, 0x04, 0xB0, 0xD0, 0x40, 0x01, 0x80, 0x60, 0xF0, 0x23, 0xF0, 0xC0,
+0x60, 0x20, 0xF0, 0x2F, 0x07, 0x60, 0xC0, 0xF0, 0x2F, 0x01, 0xF0, 0x61, 0x27, 0x60, 0xC0, 0xF0,
+0x23, 0xF0, 0xC0, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x2C, 0x60, 0x29, 0xF0, 0x60, 0x29, 0xC0, 0x60,
+0xF0, 0x26, 0xF0, 0xC0, 0x23, 0xF0, 0x60, 0x20, 0xF1, 0xC1, 0xF0, 0x25, 0xF0, 0xC1, 0x26, 0xF0,
+0xC0, 0x70, 0x30, 0x10, 0xD0, 0x04, 0x90, 0x04, 0xA1, 0x30, 0x00, 0xE0, 0x02, 0xA0, 0x00, 0x90,
+0x80, 0xB0, 0x00, 0x90, 0xB1, 0x03, 0xA0, 0x70, 0xF0, 0x20, 0x60, 0xF1, 0x24, 0xF0, 0xA1, 0xB0,
+0xE0, 0x30, 0x50, 0x61, 0x70, 0x04, 0xB0, 0x90, 0x0B, 0x51, 0x0D, 0x40, 0x06, 0x40, 0xB0, 0x07,
+0x40, 0x0F, 0x04, 0x91, 0x05, 0x30, 0x40, 0x0F, 0x00, 0x50, 0x40, 0x06, 0xD0, 0x50, 0x01, 0xA1,
+0x0F, 0x1A, 0x0F, 0x12, 0xA0, 0x30, 0xD1, 0x50, 0x02, 0xA0, 0x00, 0x40, 0xA0, 0x40, 0xA0, 0xF0,
+0x27, 0x60, 0xC0, 0xF0, 0x2F, 0x07, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0xC0, 0x60, 0x25, 0x60, 0x27,
+0xF0, 0x60, 0xC0, 0x2D, 0x60, 0xF0, 0x2A, 0xC1, 0x2A, 0x60, 0xF0, 0x27, 0xF0, 0x60, 0xF0, 0x27,
+0xC1, 0x22, 0xF0, 0xD1, 0xC0, 0xF0, 0x20, 0x60, 0xF0, 0x26, 0xC1, 0x26, 0xF0, 0x60, 0x10, 0x82,
+0x04, 0x40, 0x02, 0xB1, 0xA0, 0x60, 0x70, 0xA0, 0x80, 0x01, 0x70, 0x10, 0x90, 0x00, 0x10, 0x30,
+0xB0, 0xE0, 0x04, 0xA0, 0x80, 0xF1, 0xC1, 0x27, 0x60, 0x30, 0x81, 0xF3, 0x70, 0x04, 0x40, 0x0C,
+0x40, 0x0D, 0x40, 0xB0, 0x07, 0x40, 0x50, 0x05, 0xE0, 0x0F, 0x04, 0x40, 0x50, 0x06, 0x50, 0x10,
+0x0E, 0x40, 0x90, 0x07, 0xB0, 0xD0, 0x40, 0xA0, 0x00, 0xE0, 0x40, 0x0F, 0x19, 0x0F, 0x11, 0x90,
+0x80, 0x01, 0x50, 0xD0, 0xE0, 0x00, 0xE0, 0x90, 0x02, 0xD0, 0xF1, 0x26, 0xF1, 0xC0, 0x60, 0xF1,
+0x2F, 0x05, 0xF0, 0xC0, 0x60, 0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0xF0, 0x20, 0xF1, 0x60, 0x29,
+0xF0, 0x60, 0xC0, 0x2C, 0xC0, 0x60, 0xF0, 0x28, 0xF0, 0x20, 0x60, 0xF0, 0x29, 0x60, 0x28, 0xF0,
+0xC1, 0x23, 0xF0, 0x20, 0xF2, 0x60, 0xF2, 0xC0, 0xD0, 0x30, 0x60, 0xF0, 0x20, 0x60, 0xF0, 0x27,
+0x60, 0xF0, 0x25, 0xF0, 0xC2, 0x10, 0xA0, 0x40, 0x03, 0x90, 0x01, 0xB0, 0x10, 0x70, 0xF1, 0x71,
+0xE0, 0x00, 0xA0, 0x40, 0xB1, 0xE0, 0x90, 0x00, 0xA0, 0x90, 0x02, 0x11, 0x30, 0xF0, 0x20, 0xF0,
+0x60, 0x28, 0xF0, 0x60, 0x70, 0xF1, 0x21, 0xF0, 0x70, 0xB0, 0x02, 0x50, 0x90, 0x0B, 0x40, 0x0D,
+0x40, 0xB0, 0x09, 0x91, 0x03, 0xE0, 0x0F, 0x03, 0xB0, 0x40, 0x08, 0x50, 0x10, 0x0C, 0x50, 0x40,
+0x0A, 0xE0, 0x70, 0x02, 0x30, 0x05, 0x50, 0xB0, 0x0F, 0x11, 0x0F, 0x11, 0xB0, 0x70, 0x50, 0x02,
+0xD0, 0xB0, 0xD0, 0xE0, 0x01, 0x80, 0x60, 0xF0, 0x2B, 0x60, 0xC0, 0xF0, 0x20, 0xF0, 0x2F, 0x04,
+0xC0, 0x60, 0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0xF1, 0x60, 0x2B, 0xF0, 0x60, 0x2D, 0x60, 0xC0,
+0xF0, 0x29, 0xC0, 0x60, 0xF0, 0x28, 0xC0, 0x60, 0xF0, 0x28, 0x60, 0xF0, 0x20, 0xF0, 0xC0, 0x30,
+0xA0, 0xF1, 0x30, 0xA0, 0x70, 0xA0, 0x31, 0x70, 0xC0, 0xF0, 0x21, 0x60, 0xF0, 0x27, 0x60, 0xF0,
+0x25, 0xF0, 0xC1, 0x71, 0xA0, 0x04, 0x90, 0x01, 0x70, 0x60, 0xF1, 0x20, 0x60, 0xA0, 0x01, 0x90,
+0x40, 0x90, 0x30, 0xE0, 0x00, 0x50, 0xA0, 0x80, 0x02, 0x40, 0x10, 0xF1, 0x21, 0x60, 0xF0, 0x20,
+0xF1, 0x24, 0xF0, 0x80, 0x60, 0xC0, 0xF0, 0x23, 0xA0, 0x02, 0x40, 0x0B, 0x90, 0x50, 0x0C, 0x90,
+0x50, 0x0B, 0x50, 0x90, 0x01, 0x40, 0x0F, 0x03, 0x50, 0x40, 0x09, 0x50, 0x40, 0x0B, 0x91, 0x0C,
+0xA0, 0x50, 0x00, 0x50, 0xA0, 0x30, 0x02, 0xE0, 0xD0, 0x30, 0x70, 0xE0, 0x0F, 0x10, 0x0F, 0x10,
+0xB0, 0x50, 0x40, 0xD0, 0xE0, 0x01, 0xA1, 0xB0, 0x90, 0xA0, 0x40, 0x30, 0xF0, 0x2C, 0xF0, 0x61,
+0xF0, 0x2F, 0x05, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x2F, 0x00, 0xF0, 0xC1, 0x60, 0x20, 0xF0, 0x2C,
+0x60, 0xF0, 0x2C, 0x60, 0xF0, 0x29, 0xF0, 0x60, 0x29, 0xF0, 0x60, 0x29, 0x60, 0xF1, 0x30, 0x70,
+0x80, 0x70, 0xF1, 0xD0, 0x90, 0xE0, 0x50, 0xB0, 0x00, 0x30, 0x60, 0xF0, 0x20, 0xF0, 0x60, 0x28,
+0x60, 0xF0, 0x25, 0xF0, 0xC1, 0x30, 0x06, 0x90, 0x00, 0x31, 0xF1, 0x21, 0xF0, 0xA0, 0x01, 0x40,
+0x70, 0x30, 0x40, 0x01, 0xE0, 0x30, 0x50, 0x03, 0x81, 0xF0, 0x20, 0xC1, 0xF1, 0x30, 0xC0, 0x24,
+0xC1, 0x80, 0xA0, 0x30, 0xF0, 0x21, 0xF0, 0xA0, 0xB0, 0x00, 0x51, 0x0A, 0xB0, 0x90, 0x0C, 0xB0,
+0x90, 0x0D, 0x51, 0x40, 0x0F, 0x03, 0x50, 0x90, 0x0F, 0x07, 0xB0, 0x40, 0xB0, 0x0D, 0xB0, 0xD0,
+0xE0, 0x30, 0x00, 0x30, 0x50, 0x00, 0xA0, 0xD0, 0x70, 0x50, 0x00, 0xD0, 0x0F, 0x10, 0x0F, 0x0F,
+0x90, 0xD0, 0x30, 0xD0, 0x31, 0xD1, 0xA0, 0xE0, 0x02, 0x10, 0xC0, 0x2E, 0xF0, 0xC0, 0x60, 0x20,
+0xF0, 0x2F, 0x04, 0xF0, 0x20, 0x60, 0xC0, 0x2F, 0x00, 0xF1, 0x61, 0xF1, 0x2C, 0xC0, 0x60, 0xF1,
+0x2A, 0xC0, 0x60, 0xF0, 0x29, 0xC0, 0x60, 0xF0, 0x27, 0xF0, 0xC1, 0x28, 0xC2, 0xA0, 0x00, 0xD0,
+0x60, 0xF0, 0xD0, 0x80, 0xB0, 0x50, 0x01, 0x80, 0xA0, 0xF0, 0x22, 0xC1, 0x26, 0xF0, 0x60, 0xF0,
+0x25, 0xF0, 0xC1, 0x30, 0xE0, 0x05, 0x51, 0xA0, 0xF0, 0x23, 0xF0, 0xA0, 0x10, 0x50, 0x40, 0xE0,
+0x03, 0xA0, 0x80, 0x04, 0x80, 0x60, 0xF0, 0x20, 0x60, 0xF0, 0x80, 0x10, 0xA0, 0x20, 0xF0, 0x22,
+0xF0, 0x60, 0xA0, 0x40, 0x00, 0x90, 0x70, 0xC0, 0xF1, 0xA0, 0xB0, 0x00, 0x40, 0x0B, 0x40, 0x0C,
+0xB0, 0x40, 0x0F, 0x00, 0x80, 0x50, 0x0F, 0x02, 0x90, 0x50, 0x0F, 0x07, 0x90, 0x40, 0x0F, 0x01,
+0x31, 0x02, 0xA0, 0x40, 0x30, 0x01, 0xA0, 0x50, 0x10, 0x0F, 0x10, 0x0F, 0x0F, 0x70, 0xB0, 0x01,
+0x80, 0xD0, 0x01, 0xA0, 0x80, 0x01, 0x40, 0x80, 0xF0, 0x2F, 0x00, 0xF1, 0x61, 0x2F, 0x06, 0xF0,
+0x60, 0xC0, 0x2F, 0x00, 0x60, 0xF0, 0xC0, 0x60, 0x2E, 0xC0, 0x60, 0x2B, 0xF0, 0x60, 0xC0, 0xF0,
+0x28, 0xF0, 0x60, 0xC0, 0xF0, 0x28, 0x60, 0x29, 0x60, 0xF0, 0x10, 0xD0, 0xC0, 0xF0, 0x80, 0x10,
+0x50, 0x00, 0x90, 0x00, 0x70, 0x60, 0xF0, 0x24, 0x60, 0xF0, 0x26, 0x60, 0xF0, 0x25, 0xF0, 0x60,
+0xC0, 0xF0, 0x80, 0xA0, 0x80, 0x02, 0xB0, 0xE0, 0xA0, 0xF0, 0x24, 0xF0, 0x80, 0x10, 0x70, 0x05,
+0x70, 0xE0, 0x04, 0x10, 0x60, 0xF0, 0x20, 0x60, 0xC0, 0x30, 0xE0, 0xC0, 0xF0, 0x22, 0xF0, 0xC0,
+0x60, 0x80, 0x03, 0x70, 0xC1, 0xA0, 0x00, 0x90, 0xB0, 0x0A, 0x40, 0xB0, 0x0C, 0x40, 0x0F, 0x00,
+0x40, 0x00, 0x50, 0x90, 0x0F, 0x00, 0x40, 0xB0, 0x09, 0x50, 0xD0, 0x70, 0x08, 0xB0, 0x40, 0x50,
+0x0F, 0x03, 0x10, 0x01, 0x50, 0x71, 0x40, 0x00, 0xB0, 0xD0, 0x0F, 0x12, 0x0F, 0x0F, 0x80, 0x30,
+0x02, 0x40, 0x80, 0x40, 0x90, 0x50, 0xA0, 0x40, 0xA0, 0xF0, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0x20,
+0xF0, 0x2F, 0x04, 0xF0, 0xC0, 0x60, 0xF0, 0x2A, 0xF0, 0x20, 0x60, 0x21, 0xF0, 0xC0, 0x60, 0x2C,
+0xF0, 0x20, 0x60, 0xC0, 0x2C, 0x60, 0x2A, 0xC0, 0x60, 0xF0, 0x28, 0xC1, 0x27, 0xF0, 0x60, 0x10,
+0x30, 0x50, 0x80, 0x60, 0xD0, 0xE0, 0x50, 0x00, 0x90, 0x10, 0xC0, 0xF2, 0x22, 0xF0, 0x60, 0x27,
+0x60, 0xF0, 0x25, 0xF0, 0x60, 0x21, 0xF1, 0x10, 0x70, 0x51, 0x30, 0xA0, 0xF1, 0x25, 0x60, 0xD0,
+0x80, 0x05, 0xA0, 0x50, 0x04, 0xE0, 0xA0, 0xF0, 0x60, 0xF0, 0x80, 0x50, 0x30, 0x60, 0x24, 0x60,
+0x80, 0x90, 0x03, 0x50, 0x30, 0xA0, 0x00, 0xB0, 0x90, 0x0A, 0x50, 0x90, 0x0C, 0x40, 0xB0, 0x0D,
+0xB0, 0x40, 0x02, 0x50, 0x90, 0x0C, 0xB0, 0x40, 0xB0, 0x0A, 0xA0, 0x70, 0x08, 0x50, 0x40, 0x0F,
+0x05, 0x90, 0xA0, 0xE0, 0x80, 0x00, 0x30, 0x70, 0xA0, 0xD0, 0x90, 0xB0, 0x80, 0xA0, 0x90, 0x0F,
+0x0E, 0x0F, 0x10, 0xA0, 0x70, 0x50, 0x00, 0x50, 0xA0, 0x30, 0x02, 0x70, 0x60, 0xF0, 0x2F, 0x06,
+0x60, 0xC0, 0xF1, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x28, 0xF0, 0x60, 0x23, 0xF0, 0xC0,
+0x60, 0x2E, 0x60, 0x2C, 0xC0, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xC0, 0xF0, 0x28, 0x60, 0xF0, 0x26,
+0xF0, 0xC0, 0x30, 0x60, 0xD0, 0x70, 0x30, 0x40, 0x02, 0x30, 0x70, 0x81, 0x61, 0xC0, 0x20, 0xF1,
+0x60, 0x27, 0x60, 0xC0, 0x25, 0xF0, 0xC0, 0x22, 0xF0, 0x60, 0x30, 0xA0, 0x30, 0x60, 0xC0, 0xF0,
+0x23, 0xF1, 0xC1, 0x60, 0x80, 0x05, 0x40, 0x05, 0x50, 0xA0, 0xF0, 0x60, 0xF0, 0x80, 0x50, 0x80,
+0x60, 0x22, 0xF0, 0xC2, 0x80, 0x07, 0x40, 0x0B, 0x40, 0x0C, 0x40, 0xB0, 0x0E, 0x40, 0x04, 0x90,
+0x50, 0x0A, 0xB0, 0x40, 0x0C, 0x70, 0x50, 0x07, 0x90, 0x50, 0x0F, 0x07, 0x70, 0xE0, 0x01, 0xB0,
+0x30, 0x50, 0x00, 0x80, 0xD0, 0xE0, 0x50, 0xA0, 0x50, 0x0F, 0x0D, 0x0F, 0x0D, 0x90, 0x70, 0xE0,
+0x00, 0x90, 0x70, 0x10, 0x71, 0x10, 0x80, 0x00, 0x50, 0x30, 0xF0, 0x2F, 0x07, 0xF0, 0x61, 0xF0,
+0x2F, 0x05, 0xC0, 0x60, 0x20, 0xF0, 0x26, 0xF0, 0x60, 0xC0, 0xF0, 0x23, 0xF0, 0xC0, 0x60, 0x2D,
+0xF0, 0x60, 0x2C, 0xC1, 0x29, 0xF0, 0x60, 0xF0, 0x28, 0xC1, 0xF0, 0x25, 0xF0, 0xA0, 0x61, 0xD0,
+0xE0, 0xA0, 0xE0, 0x02, 0x30, 0x80, 0x90, 0x50, 0x40, 0xE0, 0x80, 0xA0, 0x60, 0xF0, 0x60, 0x27,
+0x60, 0xC0, 0x25, 0xF0, 0xC0, 0x24, 0xF2, 0xC0, 0xF0, 0x23, 0xF0, 0xC0, 0xD0, 0x60, 0xC0, 0xF0,
+0x70, 0x05, 0x90, 0x05, 0xB0, 0x30, 0xA0, 0x60, 0xF0, 0x60, 0x30, 0xA0, 0xF0, 0x22, 0xF0, 0x60,
+0xF0, 0xA0, 0xB0, 0x06, 0x51, 0x0A, 0x40, 0xB0, 0x0B, 0x90, 0x50, 0x0E, 0xE0, 0x06, 0x40, 0xB0,
+0x08, 0x50, 0x40, 0x0D, 0xD0, 0x06, 0xB0, 0x40, 0xB0, 0x0F, 0x08, 0xB0, 0xD0, 0x00, 0xB0, 0x70,
+0x10, 0xB0, 0x30, 0xA0, 0x02, 0x80, 0xE0, 0x0F, 0x0D, 0x0F, 0x0C, 0xB0, 0x70, 0xB0, 0x70, 0x81,
+0xB0, 0x00, 0x50, 0x30, 0xA0, 0x11, 0x70, 0xC0, 0x2F, 0x09, 0xF0, 0x20, 0x60, 0xC0, 0xF0, 0x2F,
+0x04, 0xF0, 0x60, 0xC0, 0xF0, 0x25, 0x60, 0xC0, 0xF1, 0x24, 0xF0, 0xC0, 0x60, 0x2D, 0xF0, 0x60,
+0x2C, 0x60, 0xF0, 0x29, 0xC0, 0x60, 0xF0, 0x28, 0x60, 0xF0, 0x25, 0xF0, 0x80, 0x60, 0xF0, 0x80,
+0xD0, 0x10, 0xD0, 0x01, 0x70, 0x40, 0x90, 0x04, 0x40, 0x80, 0xF0, 0x60, 0x27, 0xC1, 0x22, 0xF0,
+0x21, 0xF0, 0xC1, 0x24, 0xF1, 0x60, 0xF2, 0x20, 0xF0, 0x30, 0xA0, 0x70, 0xC0, 0xF1, 0x60, 0xA0,
+0x03, 0x51, 0x05, 0x90, 0xA0, 0x80, 0xC0, 0x20, 0xF0, 0xD0, 0x80, 0xF0, 0x21, 0xF0, 0xC1, 0xF0,
+0xA0, 0x07, 0x40, 0x0A, 0x90, 0x50, 0x0B, 0x50, 0x90, 0x0E, 0x40, 0x08, 0x40, 0xB0, 0x06, 0x91,
+0x0E, 0x10, 0x05, 0x91, 0x0F, 0x0B, 0xE0, 0x12, 0xE0, 0xA0, 0x70, 0x02, 0xE0, 0xD0, 0x0F, 0x0E,
+0x0F, 0x0C, 0x90, 0x30, 0x00, 0x30, 0x80, 0xE0, 0xD0, 0x00, 0x30, 0x01, 0x50, 0x10, 0x80, 0xC0,
+0x2F, 0x0C, 0x61, 0xF0, 0x20, 0xF0, 0x2F, 0x02, 0xF0, 0x60, 0xC0, 0xF0, 0x23, 0x60, 0xC0, 0x29,
+0xC0, 0x60, 0x2D, 0xC0, 0x60, 0x2A, 0xF0, 0x20, 0x60, 0x29, 0xF0, 0x60, 0x20, 0xF0, 0x26, 0xF0,
+0x60, 0xC0, 0xF0, 0x25, 0xF0, 0xC1, 0xA1, 0x10, 0xE0, 0x00, 0x90, 0x30, 0x00, 0x90, 0xB0, 0x03,
+0xA0, 0xF1, 0xC1, 0xF2, 0xC3, 0x67, 0xC0, 0x69, 0xC4, 0x30, 0x00, 0x80, 0xE0, 0x70, 0xC0, 0xF0,
+0x70, 0x03, 0x90, 0x06, 0x50, 0x70, 0x30, 0xF0, 0x21, 0xC0, 0x24, 0x60, 0xC0, 0xF0, 0x70, 0x06,
+0x90, 0xB0, 0x0A, 0x40, 0x0B, 0xB0, 0x90, 0x0D, 0xB0, 0x40, 0x0A, 0x40, 0xB0, 0x04, 0x40, 0x50,
+0x0F, 0x00, 0x80, 0x10, 0x50, 0x01, 0xB0, 0x40, 0xB0, 0x0F, 0x0C, 0x50, 0x10, 0xA0, 0x01, 0x40,
+0x10, 0x91, 0x70, 0xA0, 0x00, 0xE0, 0x30, 0x40, 0x0F, 0x0B, 0x0F, 0x0D, 0x30, 0xB0, 0x50, 0x01,
+0x81, 0x70, 0x02, 0x70, 0xF0, 0xC0, 0x60, 0x2F, 0x0C, 0xC0, 0x60, 0x20, 0xF1, 0x2F, 0x02, 0xF0,
+0x60, 0xC0, 0xF0, 0x20, 0xF0, 0xC1, 0x2A, 0xF0, 0xC0, 0x60, 0x2D, 0xC0, 0x60, 0xF0, 0x29, 0xF0,
+0xC1, 0x29, 0xC0, 0x60, 0xF0, 0x27, 0xF0, 0x60, 0xF0, 0x26, 0xF0, 0x60, 0xC0, 0xE0, 0x70, 0x00,
+0x50, 0x80, 0x01, 0xB0, 0x90, 0x02, 0x80, 0x60, 0xF0, 0x20, 0x64, 0xC4, 0xF7, 0xC1, 0xF5, 0x20,
+0xC2, 0x60, 0x80, 0x30, 0xE0, 0x40, 0x80, 0xE0, 0x60, 0xF1, 0x60, 0x80, 0x02, 0x30, 0x90, 0x05,
+0xB0, 0x70, 0xA0, 0xF0, 0x27, 0x60, 0xF1, 0x70, 0xB0, 0x05, 0x40, 0x0A, 0x40, 0x0C, 0x40, 0x0E,
+0x40, 0x0C, 0x40, 0x03, 0x40, 0xB0, 0x0F, 0x02, 0x90, 0xD0, 0x00, 0x50, 0x40, 0x0F, 0x0C, 0x50,
+0x40, 0xB0, 0x90, 0x30, 0x01, 0x50, 0xD0, 0x31, 0x90, 0x01, 0x30, 0xB0, 0x30, 0x0F, 0x0B, 0x0F,
+0x10, 0xB0, 0x50, 0x71, 0xB0, 0xA0, 0xE0, 0x80, 0x60, 0xF1, 0x20, 0x61, 0x2F, 0x0A, 0xF1, 0x60,
+0xC0, 0xF1, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0xF0, 0xC0, 0x60, 0x2C, 0xF0, 0xC0, 0x60, 0x2C, 0xF0,
+0x61, 0xF0, 0x2A, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x27, 0xF0, 0x60, 0x27, 0x60, 0xA0, 0x70, 0x10,
+0xA0, 0x80, 0x40, 0x03, 0x40, 0x01, 0xB0, 0x30, 0x62, 0xC0, 0x60, 0xF0, 0x21, 0xF0, 0x22, 0xF0,
+0x26, 0xF0, 0xC0, 0x20, 0xF0, 0x26, 0xF0, 0x30, 0x70, 0x10, 0xD0, 0x11, 0xA0, 0x40, 0xC0, 0x62,
+0xA0, 0x90, 0x01, 0xD0, 0x50, 0x00, 0xE0, 0xB0, 0x02, 0x90, 0x70, 0x80, 0xF0, 0x25, 0xF0, 0x60,
+0xC0, 0x20, 0xF0, 0x80, 0x40, 0x04, 0x40, 0x0A, 0x90, 0x50, 0x0B, 0x40, 0x0E, 0x40, 0x0E, 0x40,
+0x00, 0xB0, 0x40, 0x0F, 0x04, 0x31, 0x90, 0x50, 0x0F, 0x0B, 0xB0, 0x40, 0x50, 0x02, 0xD0, 0x90,
+0xA0, 0xE0, 0x41, 0x03, 0xB0, 0x80, 0xB0, 0x0F, 0x0B, 0x0F, 0x10, 0x80, 0xA0, 0x80, 0x90, 0x01,
+0x40, 0xD0, 0xF0, 0x21, 0xF1, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x07, 0xF1, 0xC0, 0x60, 0x2F, 0x04,
+0xF0, 0xC0, 0x61, 0xF0, 0x2D, 0xF0, 0xC0, 0x60, 0x2C, 0xF0, 0x60, 0xC0, 0x2B, 0x60, 0xF0, 0x29,
+0x60, 0x28, 0xC0, 0x60, 0xF0, 0x24, 0xF0, 0x80, 0x60, 0xA0, 0x10, 0xD0, 0x10, 0x03, 0x50, 0xE0,
+0x91, 0xA0, 0x40, 0xF1, 0x20, 0xF0, 0x60, 0xF0, 0x2D, 0xF0, 0xC1, 0x26, 0xF0, 0x60, 0xA0, 0x10,
+0xD0, 0xB0, 0x00, 0xB0, 0x30, 0x90, 0xF4, 0x30, 0x80, 0x41, 0xB0, 0x00, 0xE0, 0xA0, 0x02, 0x80,
+0xA0, 0x80, 0xF0, 0x24, 0xF0, 0x20, 0x60, 0xF0, 0x21, 0xF0, 0xA0, 0x03, 0xB0, 0x90, 0x09, 0x50,
+0x90, 0x0B, 0x40, 0xB0, 0x0D, 0xE0, 0x0F, 0x01, 0xE0, 0x90, 0x0F, 0x05, 0xE0, 0x70, 0x41, 0xA0,
+0x0F, 0x09, 0x90, 0x40, 0x04, 0x50, 0x10, 0x02, 0x30, 0x0F, 0x12, 0x0F, 0x12, 0x70, 0xB0, 0x01,
+0x80, 0x60, 0xF0, 0x23, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x08, 0xF0, 0x20, 0x60, 0xC0, 0xF0,
+0x2F, 0x02, 0xF0, 0x61, 0xC0, 0xF0, 0x2E, 0xC0, 0x60, 0x2C, 0xF0, 0x60, 0x2B, 0xC0, 0x60, 0x28,
+0xF0, 0xC1, 0x27, 0xF0, 0x60, 0xC0, 0x25, 0xF0, 0xC0, 0xA0, 0x71, 0x50, 0x00, 0x50, 0x90, 0x40,
+0x50, 0x00, 0xE0, 0x30, 0x80, 0xF0, 0x23, 0x60, 0x2E, 0xF0, 0xC0, 0x27, 0xF0, 0xA0, 0x12, 0x80,
+0x00, 0x50, 0x70, 0xE0, 0xF1, 0x20, 0xF1, 0xC0, 0xD0, 0x00, 0xB0, 0x90, 0x40, 0x90, 0xB0, 0x02,
+0x30, 0x70, 0x60, 0xF0, 0x25, 0xC1, 0x22, 0xF0, 0xA0, 0xB0, 0x02, 0x40, 0x0A, 0x40, 0x0B, 0x90,
+0x50, 0x0C, 0xB0, 0x40, 0x0F, 0x01, 0x90, 0x40, 0x90, 0x0F, 0x04, 0x90, 0x50, 0x90, 0x11, 0x40,
+0x0F, 0x07, 0x50, 0x40, 0xB0, 0x06, 0xA0, 0x90, 0x01, 0xE0, 0x80, 0x0F, 0x11, 0x0F, 0x11, 0xE0,
+0x40, 0x30, 0xE0, 0x50, 0xA0, 0xF0, 0x28, 0x61, 0x20, 0xF0, 0x2F, 0x08, 0xF0, 0xC0, 0x60, 0x2F,
+0x01, 0xF0, 0x60, 0xC0, 0xF0, 0x60, 0xC0, 0x2E, 0xF0, 0xC0, 0x60, 0x2C, 0xF0, 0x60, 0x2B, 0x60,
+0x2A, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0x26, 0xF0, 0xC0, 0x30, 0xA0, 0x40, 0xE0, 0xB0, 0x03,
+0x80, 0xD0, 0xF0, 0x24, 0xC1, 0x2D, 0xF0, 0xC0, 0x27, 0xF0, 0xA0, 0x30, 0x70, 0x00, 0x50, 0x00,
+0x50, 0xA0, 0x40, 0xA0, 0xF0, 0x21, 0xF0, 0xA0, 0x30, 0x04, 0x90, 0xE1, 0x70, 0x30, 0xC0, 0xF1,
+0x24, 0xF0, 0x60, 0xF0, 0x22, 0xF0, 0x30, 0xA0, 0x01, 0x51, 0x09, 0x90, 0xB0, 0x0A, 0x50, 0x90,
+0x0C, 0xB0, 0x40, 0x0F, 0x01, 0x40, 0x50, 0x00, 0x90, 0x50, 0x0F, 0x01, 0xB0, 0x40, 0xB0, 0x00,
+0x40, 0x10, 0x0F, 0x07, 0xB0, 0x40, 0x50, 0x08, 0x50, 0x70, 0xB0, 0xA0, 0x40, 0x30, 0xB0, 0x0F,
+0x10, 0x0F, 0x11, 0xA0, 0x01, 0x50, 0xD0, 0xC0, 0x2B, 0x61, 0x20, 0xF0, 0x2F, 0x09, 0x60, 0xC0,
+0xF0, 0x2C, 0xF0, 0x60, 0xC0, 0x21, 0xF0, 0x61, 0xF0, 0x2E, 0xC0, 0x60, 0x2D, 0x60, 0xF0, 0x29,
+0xF0, 0x60, 0x29, 0xC0, 0x60, 0xF0, 0x26, 0xF0, 0x60, 0x24, 0xF1, 0x60, 0x81, 0xD2, 0xB0, 0x01,
+0x40, 0x50, 0xA1, 0xF0, 0x24, 0xC1, 0x2E, 0xC0, 0x27, 0xF0, 0x70, 0x05, 0x40, 0xC0, 0x30, 0xF2,
+0xC0, 0xD0, 0x50, 0x03, 0x90, 0xD0, 0x60, 0xC1, 0x61, 0xF1, 0x23, 0xF0, 0xC1, 0x23, 0xF0, 0x80,
+0x10, 0x01, 0x40, 0x09, 0xB0, 0x90, 0x0A, 0xB0, 0x40, 0x0D, 0xE0, 0x0F, 0x01, 0x40, 0xB0, 0x02,
+0x40, 0xB0, 0x0E, 0x91, 0x02, 0xE0, 0x40, 0x0F, 0x06, 0x40, 0x50, 0x0B, 0x30, 0x70, 0x01, 0xB0,
+0x30, 0x0F, 0x10, 0x0F, 0x10, 0x30, 0x50, 0x01, 0x50, 0x30, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0xC0,
+0x2F, 0x09, 0xF0, 0x61, 0xF0, 0x2B, 0x60, 0xC0, 0x23, 0xF0, 0xC0, 0x60, 0x2E, 0xF0, 0x61, 0x2C,
+0xC0, 0x60, 0xF0, 0x29, 0xC0, 0x60, 0xF0, 0x27, 0xF0, 0x60, 0xC0, 0x28, 0x60, 0xF2, 0x20, 0x61,
+0x70, 0xD0, 0xE0, 0xD0, 0x10, 0xD0, 0x80, 0x01, 0xE0, 0xD0, 0xA2, 0xF1, 0x22, 0xC0, 0x60, 0x2E,
+0x60, 0x27, 0xF0, 0x70, 0x04, 0xB0, 0xA0, 0x70, 0xF0, 0x20, 0x60, 0x81, 0x70, 0xA0, 0x03, 0x70,
+0x50, 0xF1, 0x60, 0xC1, 0x61, 0xC0, 0xF0, 0x21, 0xF0, 0x60, 0xF0, 0x23, 0xF0, 0x80, 0x10, 0x91,
+0xB0, 0x05, 0x80, 0xB0, 0x01, 0x40, 0x0B, 0x40, 0x0D, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x05, 0x40,
+0x0C, 0xB0, 0x40, 0xB0, 0x03, 0xE0, 0xA0, 0x0F, 0x04, 0x41, 0x08, 0xB0, 0x80, 0x50, 0x02, 0x10,
+0x02, 0x70, 0xB0, 0x0F, 0x0F, 0x0F, 0x10, 0xA0, 0x30, 0x80, 0xB0, 0xA0, 0xC0, 0x2E, 0xF0, 0xC0,
+0x60, 0xC0, 0xF0, 0x2F, 0x07, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x29, 0x60, 0xF0, 0x24, 0xF0, 0xC0,
+0x60, 0x2E, 0xF0, 0xC0, 0x60, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xC0, 0xF0, 0x28,
+0x60, 0xF0, 0x27, 0x60, 0xF1, 0x61, 0xF1, 0x60, 0x81, 0x71, 0x30, 0x06, 0x90, 0xA0, 0xF0, 0x22,
+0xF0, 0x60, 0x2D, 0xF0, 0xC0, 0x27, 0xF0, 0x70, 0xA0, 0x03, 0xB0, 0xA0, 0xD0, 0xF0, 0x60, 0x11,
+0x80, 0x90, 0x70, 0xE0, 0x02, 0x70, 0xF2, 0x60, 0x20, 0xF0, 0x21, 0xC0, 0x61, 0xF0, 0x60, 0xC0,
+0xF0, 0x23, 0xF0, 0x10, 0x80, 0xE0, 0x90, 0x06, 0x50, 0x01, 0x40, 0x0B, 0x40, 0x0C, 0xB0, 0x40,
+0x0F, 0x00, 0x50, 0x40, 0x07, 0x40, 0x0A, 0x91, 0x05, 0xB0, 0xD0, 0x0F, 0x02, 0x50, 0x40, 0xB0,
+0x08, 0xE0, 0xA0, 0x60, 0x70, 0x50, 0x01, 0x80, 0xE0, 0x90, 0xA0, 0xE0, 0x30, 0x0F, 0x0F, 0x0F,
+0x0F, 0x80, 0x50, 0x00, 0x50, 0xA0, 0x30, 0xF0, 0x2F, 0x00, 0xF0, 0x20, 0x61, 0x2F, 0x08, 0xF0,
+0x20, 0x61, 0xF0, 0x25, 0xF1, 0x60, 0x27, 0xF0, 0xC0, 0x60, 0xC0, 0x2D, 0xF0, 0xC0, 0x60, 0x2B,
+0xF0, 0x60, 0xC0, 0x29, 0xF0, 0x60, 0x28, 0xF0, 0x60, 0xC0, 0x26, 0xF0, 0xC0, 0x80, 0x72, 0xC1,
+0xF1, 0x10, 0x30, 0xA0, 0x70, 0xB0, 0x06, 0x80, 0x60, 0xF0, 0x21, 0xF0, 0x60, 0x2D, 0xF0, 0xC0,
+0x27, 0xF0, 0xA0, 0x80, 0x02, 0x40, 0x30, 0xE0, 0x60, 0x30, 0x70, 0x90, 0x80, 0x30, 0x80, 0xE0,
+0xA0, 0x02, 0xA0, 0xF1, 0x20, 0x60, 0xF0, 0x22, 0xF1, 0xC0, 0x61, 0xC0, 0xF1, 0x21, 0x60, 0xA0,
+0x10, 0x70, 0x30, 0x09, 0x51, 0x0A, 0x40, 0xB0, 0x0C, 0x40, 0x0F, 0x00, 0x91, 0x08, 0x50, 0x90,
+0x08, 0x40, 0x50, 0x07, 0x70, 0x0F, 0x00, 0xB0, 0x40, 0x50, 0x07, 0xB1, 0x50, 0x70, 0xF1, 0x81,
+0x02, 0x10, 0xE0, 0xB0, 0x00, 0x30, 0xB0, 0x0F, 0x0E, 0x0F, 0x0F, 0xA0, 0x02, 0xA0, 0xF0, 0x2F,
+0x03, 0xF0, 0x20, 0x61, 0xF1, 0x2F, 0x05, 0xF1, 0xC0, 0x60, 0x25, 0xF0, 0x60, 0xC0, 0x28, 0xF0,
+0x20, 0x60, 0xC0, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0xF0, 0x2A, 0xF0, 0x60, 0xC0, 0xF0, 0x29, 0x60,
+0xF0, 0x28, 0x60, 0x24, 0xF0, 0xC0, 0x60, 0x30, 0x90, 0x30, 0x10, 0x70, 0x10, 0x80, 0xA0, 0x60,
+0xA0, 0xC0, 0xE0, 0x30, 0x08, 0xA0, 0x22, 0xF0, 0x60, 0xC0, 0x2C, 0xF0, 0x60, 0x27, 0xF0, 0xA0,
+0xE0, 0x02, 0x71, 0x30, 0x10, 0x80, 0xA0, 0x01, 0x40, 0x30, 0xF0, 0xD0, 0xC0, 0xA1, 0x30, 0xF0,
+0x30, 0x60, 0xC0, 0x24, 0xF3, 0x61, 0xF1, 0xC0, 0xA0, 0xB0, 0x00, 0xB0, 0x50, 0x08, 0xB0, 0x40,
+0x0A, 0x90, 0x50, 0x0C, 0x40, 0x0F, 0x00, 0x40, 0x50, 0x0A, 0x90, 0x50, 0x05, 0x50, 0x40, 0x09,
+0x70, 0x0E, 0x40, 0x90, 0x07, 0xB0, 0x70, 0xA2, 0xC0, 0xF2, 0x10, 0xE0, 0x01, 0x80, 0xE0, 0x01,
+0xB0, 0x80, 0x0F, 0x0E, 0x0F, 0x0E, 0xE0, 0xA0, 0x30, 0xB0, 0x50, 0x30, 0xF0, 0x2F, 0x05, 0xF0,
+0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0xF1, 0x20, 0x60, 0xC0, 0x23, 0x60, 0xC0, 0xF0, 0x2A, 0xF0,
+0x61, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x29, 0xF0, 0x60, 0xF0, 0x28, 0xF0, 0xC1, 0xF0,
+0x27, 0xC1, 0x21, 0xF0, 0xC0, 0x61, 0x70, 0xE0, 0x01, 0x70, 0x50, 0x01, 0x50, 0x30, 0x50, 0xC0,
+0xA0, 0x09, 0x80, 0xC0, 0x21, 0xF0, 0xC1, 0x2C, 0xF0, 0x60, 0x28, 0xC0, 0x70, 0x80, 0x01, 0x10,
+0x80, 0x00, 0x90, 0xA0, 0x30, 0x50, 0x01, 0xD0, 0xC0, 0x20, 0x80, 0xF2, 0xC0, 0xD0, 0xA0, 0xF0,
+0x23, 0xF2, 0x80, 0xA1, 0x62, 0xC0, 0xD0, 0x70, 0x00, 0x90, 0x02, 0x50, 0xE0, 0xA2, 0x90, 0x00,
+0x40, 0x0A, 0x90, 0x50, 0x0C, 0xE0, 0x0F, 0x00, 0x40, 0xB0, 0x0C, 0x40, 0x04, 0x40, 0x50, 0x0A,
+0xD0, 0x90, 0x0B, 0x90, 0x40, 0x09, 0xA0, 0xF4, 0x22, 0xF0, 0xA0, 0x02, 0xD0, 0x00, 0x40, 0xA1,
+0xB0, 0x0F, 0x0D, 0x0F, 0x0D, 0xB0, 0x30, 0x00, 0xB0, 0x80, 0xD0, 0xF0, 0x2F, 0x07, 0xF1, 0x61,
+0xC0, 0x2F, 0x07, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0xC0, 0x60, 0x2D, 0xF0, 0xC0, 0x60, 0xF0, 0x2D,
+0xC0, 0x60, 0x20, 0xF0, 0x2A, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xC0, 0x27, 0xF0, 0x60, 0xF0, 0xC2,
+0xF0, 0x60, 0x70, 0xE0, 0x50, 0xA0, 0x50, 0x01, 0xB0, 0x00, 0xA0, 0x50, 0xA0, 0x80, 0x02, 0xB0,
+0x40, 0x50, 0x03, 0x80, 0xC0, 0xF0, 0x22, 0x60, 0xF0, 0x2B, 0xF0, 0xC0, 0x28, 0xF1, 0x70, 0x01,
+0x31, 0x80, 0x00, 0x70, 0x40, 0x30, 0xD0, 0xE0, 0xA0, 0xC0, 0x20, 0xF1, 0x21, 0xF0, 0x60, 0x80,
+0xF0, 0x23, 0xF0, 0x80, 0xA0, 0x40, 0x00, 0xA0, 0xD0, 0xF1, 0x30, 0xD0, 0x80, 0x40, 0x81, 0x30,
+0xA0, 0xE0, 0x50, 0x02, 0x30, 0x40, 0xB0, 0x09, 0xB0, 0x90, 0x0B, 0xB0, 0x40, 0x0E, 0xB0, 0x40,
+0x0F, 0x00, 0x40, 0x01, 0x50, 0x40, 0xB0, 0x06, 0x80, 0x50, 0x02, 0xE1, 0x09, 0x50, 0x40, 0xB0,
+0x09, 0x50, 0x70, 0xF0, 0x26, 0xF0, 0x80, 0x90, 0x01, 0x80, 0xD0, 0x40, 0x00, 0x50, 0x80, 0x0F,
+0x0D, 0x0F, 0x0D, 0xE0, 0x50, 0x01, 0x50, 0x30, 0xF0, 0x2F, 0x09, 0xF0, 0xC0, 0x60, 0xC0, 0x20,
+0xF0, 0x2F, 0x05, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xF0, 0x2D, 0xF1, 0xC0, 0x60, 0x2D, 0xF0, 0xC0,
+0x60, 0x2B, 0xC0, 0x60, 0xF0, 0x28, 0xC0, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0xA1, 0x60, 0xF0,
+0x90, 0xA0, 0xD0, 0x70, 0xB0, 0x01, 0x50, 0x10, 0x50, 0x10, 0x60, 0x80, 0xD0, 0x80, 0x10, 0xE0,
+0xA0, 0x10, 0x30, 0x03, 0x40, 0x80, 0xF0, 0x22, 0x60, 0xF0, 0x2B, 0xF0, 0xC0, 0x28, 0xF0, 0x80,
+0xD0, 0x01, 0xD0, 0xA0, 0xD0, 0xA0, 0x10, 0x30, 0xE0, 0xA0, 0xD0, 0x10, 0x80, 0x20, 0xF1, 0x21,
+0xF0, 0x60, 0x23, 0xF0, 0xC0, 0xA0, 0x40, 0x02, 0xB0, 0xA0, 0x60, 0xA0, 0x10, 0x90, 0xE1, 0x50,
+0xB0, 0x00, 0xA0, 0x50, 0x03, 0x90, 0xE0, 0x0A, 0x40, 0x0B, 0xB0, 0x40, 0x0E, 0xB0, 0x40, 0x0F,
+0x01, 0x51, 0x91, 0x08, 0x90, 0x10, 0xD0, 0x01, 0x30, 0xE0, 0x07, 0xB0, 0x40, 0x50, 0x0B, 0x70,
+0x60, 0xF0, 0x26, 0xF0, 0x80, 0x90, 0x01, 0xB0, 0xD0, 0x02, 0x30, 0x0F, 0x0D, 0x0F, 0x0D, 0xD0,
+0x30, 0xB0, 0x00, 0xA0, 0xC0, 0xF0, 0x2F, 0x0B, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0xF1,
+0x61, 0xF0, 0x2F, 0x02, 0x60, 0xF0, 0x2C, 0xF0, 0x61, 0x2A, 0xF0, 0xC0, 0x60, 0xF0, 0x27, 0xF0,
+0xC1, 0x25, 0xF0, 0xC0, 0x61, 0x70, 0xB0, 0x80, 0xD1, 0x30, 0x50, 0xE0, 0x00, 0xB0, 0x80, 0x00,
+0x80, 0x00, 0x30, 0x70, 0xF0, 0x60, 0x80, 0x61, 0x80, 0x90, 0x04, 0x50, 0x30, 0xF0, 0x22, 0x60,
+0xF0, 0x2B, 0xF0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0x11, 0xA0, 0x30, 0xA0, 0xD0, 0xA1, 0xD0, 0x70,
+0xE0, 0x70, 0xD0, 0xC0, 0xF1, 0x60, 0x30, 0xF2, 0x60, 0xF0, 0x21, 0xF0, 0xC0, 0x70, 0xB0, 0x04,
+0xB0, 0x41, 0x50, 0x00, 0x90, 0x50, 0x40, 0x07, 0x40, 0xA0, 0x09, 0x40, 0x0C, 0xE0, 0x0E, 0x91,
+0x0F, 0x03, 0x80, 0x50, 0x0A, 0x50, 0xA0, 0x30, 0x00, 0xE0, 0x40, 0x06, 0x40, 0x90, 0x0C, 0x50,
+0xA0, 0xF0, 0x27, 0xF0, 0x60, 0xC0, 0x00, 0x50, 0x00, 0x30, 0x40, 0x00, 0x90, 0x70, 0x80, 0x0F,
+0x0C, 0x0F, 0x0C, 0xE0, 0x50, 0x00, 0x31, 0xA0, 0xF1, 0x2F, 0x0C, 0xF1, 0xC0, 0x60, 0xC0, 0xF0,
+0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0x2F, 0x02, 0xF0, 0x60, 0xC0, 0xF0, 0x2B, 0xF0, 0x61,
+0xF0, 0x29, 0xF0, 0x60, 0xC0, 0xF0, 0x27, 0xF0, 0x60, 0xC0, 0xF0, 0x20, 0xF1, 0xC0, 0x60, 0xC0,
+0xF0, 0x70, 0x80, 0x04, 0x80, 0x30, 0x80, 0xA0, 0x70, 0x02, 0x71, 0xF1, 0x60, 0xC0, 0xF0, 0x70,
+0x06, 0x70, 0x30, 0xF2, 0x60, 0xF0, 0x2B, 0xF0, 0x60, 0x28, 0xF0, 0x10, 0xD0, 0x90, 0x00, 0x40,
+0xE0, 0x80, 0x51, 0xC0, 0xA0, 0x30, 0xA0, 0xF2, 0x11, 0x80, 0xF0, 0x60, 0xC0, 0xF2, 0x60, 0x70,
+0xB0, 0x09, 0xB0, 0x40, 0x01, 0x92, 0xD0, 0x02, 0x40, 0xB0, 0x90, 0x80, 0x07, 0x40, 0xB0, 0x0B,
+0xE0, 0x0E, 0x40, 0x50, 0x0F, 0x02, 0x50, 0x40, 0x00, 0x40, 0x0B, 0xD0, 0x90, 0x00, 0x31, 0x04,
+0x90, 0x40, 0x0E, 0x80, 0x60, 0xF0, 0x27, 0xF1, 0xA0, 0x10, 0x30, 0x01, 0x10, 0x30, 0xE0, 0x00,
+0xA0, 0x0F, 0x0C, 0x0F, 0x0C, 0xA0, 0x02, 0xA0, 0x61, 0xC0, 0xF1, 0x2F, 0x0E, 0x61, 0x20, 0xF0,
+0x2F, 0x02, 0x60, 0xF2, 0x61, 0xF0, 0x2F, 0x01, 0x60, 0xC0, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0xF0,
+0x28, 0xF0, 0x20, 0x60, 0xC0, 0x29, 0x60, 0xF1, 0x20, 0x61, 0x20, 0xF2, 0x70, 0x40, 0x03, 0x50,
+0x00, 0x50, 0x01, 0x70, 0xE0, 0x80, 0xA0, 0xF1, 0x80, 0x70, 0xC0, 0xF0, 0x80, 0xE0, 0x06, 0x90,
+0xA0, 0xF1, 0x60, 0xC0, 0x2B, 0xF0, 0x60, 0xC0, 0xF0, 0x27, 0x60, 0x90, 0x70, 0x00, 0x51, 0x10,
+0x80, 0x90, 0x70, 0x30, 0xF1, 0xC0, 0x10, 0x70, 0x10, 0xA0, 0x70, 0x50, 0x60, 0xF1, 0x60, 0xA0,
+0x80, 0xB0, 0x0A, 0x40, 0x03, 0xB0, 0xE0, 0x90, 0x01, 0x51, 0x01, 0x30, 0x50, 0x05, 0x90, 0xB0,
+0x0A, 0xB0, 0x40, 0x0E, 0x40, 0x50, 0x0F, 0x01, 0xB0, 0x40, 0x50, 0x01, 0x50, 0x90, 0x09, 0x50,
+0x10, 0x01, 0xB0, 0x40, 0x02, 0x50, 0x40, 0xB0, 0x0E, 0x80, 0x30, 0xF0, 0x27, 0xF0, 0xC0, 0xA0,
+0x80, 0xB0, 0x00, 0x50, 0x90, 0xA0, 0x90, 0x01, 0x50, 0xE0, 0x0F, 0x0B, 0x0F, 0x0B, 0x90, 0x70,
+0xB0, 0x00, 0xB0, 0xA0, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x2F, 0x0C, 0xF0, 0x20, 0x61,
+0x2F, 0x00, 0xF0, 0x60, 0xC0, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0xF0,
+0x2B, 0xF0, 0xC0, 0x60, 0xF1, 0x27, 0xF1, 0x60, 0x29, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0xF0, 0x21,
+0xF0, 0x70, 0x91, 0x08, 0x40, 0x10, 0x80, 0xF2, 0x70, 0x80, 0x60, 0xF1, 0xD0, 0xA0, 0xB0, 0x05,
+0x80, 0x60, 0xF0, 0xC1, 0x2B, 0xF0, 0x60, 0x29, 0xF0, 0x80, 0xD0, 0x00, 0x90, 0x00, 0xE1, 0x30,
+0xA0, 0x60, 0xF0, 0x60, 0x70, 0x90, 0x00, 0x50, 0xD0, 0x70, 0xA0, 0xC0, 0x40, 0x70, 0xE0, 0xB0,
+0x0B, 0x50, 0x90, 0x05, 0x91, 0x00, 0x40, 0x03, 0xA0, 0x04, 0x51, 0x0B, 0x40, 0x0D, 0xB0, 0x40,
+0xB0, 0x0F, 0x01, 0x50, 0x40, 0x04, 0x90, 0xB0, 0x09, 0x70, 0x80, 0x03, 0xB0, 0x40, 0x50, 0x0F,
+0x00, 0x40, 0x10, 0xF0, 0x26, 0xF1, 0x80, 0xA0, 0x50, 0x00, 0x50, 0x40, 0xB0, 0x01, 0xD0, 0x01,
+0x50, 0xD0, 0x0F, 0x0B, 0x0F, 0x04, 0x50, 0x05, 0xA0, 0x50, 0x31, 0x70, 0xC0, 0x23, 0xC0, 0x60,
+0xC0, 0xF2, 0x2F, 0x0C, 0xC0, 0x60, 0xC0, 0xF1, 0x2B, 0xC1, 0x23, 0xF1, 0xC0, 0x60, 0xC0, 0x2F,
+0x00, 0xF0, 0xC0, 0x60, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0x29, 0xF0, 0x20, 0x60, 0xF0, 0x27, 0xF0,
+0x61, 0x23, 0xF1, 0xD0, 0xB1, 0x50, 0x01, 0xB0, 0x70, 0x03, 0xB0, 0x30, 0xF0, 0x22, 0xF1, 0x60,
+0xF1, 0xC0, 0x10, 0x07, 0x70, 0xC0, 0xF0, 0x60, 0x2B, 0xF0, 0xC0, 0x29, 0xF0, 0xC0, 0xD0, 0x00,
+0x40, 0x02, 0xB0, 0x70, 0x60, 0xA0, 0xE0, 0x50, 0x03, 0x50, 0xD2, 0x0E, 0x40, 0x07, 0xB0, 0xE0,
+0xB0, 0x03, 0x80, 0x50, 0x02, 0xB0, 0x40, 0x0B, 0x40, 0x0D, 0xB0, 0x40, 0x0F, 0x02, 0x40, 0x50,
+0x06, 0x40, 0x08, 0xE0, 0x10, 0xB0, 0x02, 0x40, 0x90, 0x0F, 0x02, 0xE0, 0xA0, 0xF0, 0x26, 0xF0,
+0x31, 0x00, 0x91, 0xB0, 0x03, 0xA0, 0x80, 0xA0, 0x40, 0xE0, 0x90, 0x0F, 0x0A, 0x0F, 0x02, 0xB0,
+0x30, 0xE0, 0x40, 0x03, 0x50, 0x80, 0x01, 0xB0, 0x70, 0xF0, 0x24, 0xF0, 0xC0, 0x61, 0x20, 0xF0,
+0x2F, 0x0B, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x2A, 0x60, 0xF0, 0x25, 0xF1, 0x61, 0x2F, 0x00, 0xF0,
+0x20, 0x60, 0x2C, 0xF0, 0xC0, 0x60, 0x29, 0xF0, 0xC0, 0x60, 0xF0, 0x26, 0x60, 0xC0, 0xF0, 0x23,
+0xF1, 0x60, 0xD0, 0x81, 0x02, 0x30, 0x04, 0xA0, 0xF0, 0x23, 0xF0, 0xC1, 0xF0, 0x80, 0xE0, 0x07,
+0xA0, 0xF1, 0x60, 0x2B, 0xF0, 0xC1, 0x26, 0xF0, 0x21, 0xF0, 0xA0, 0x30, 0x50, 0x02, 0xB0, 0x30,
+0x80, 0x40, 0x06, 0x80, 0x11, 0x50, 0x0C, 0x51, 0x09, 0x40, 0x90, 0x02, 0xE0, 0x40, 0x01, 0xB0,
+0x40, 0x0B, 0xE0, 0x0D, 0x50, 0x40, 0x0F, 0x01, 0xB0, 0x40, 0xB0, 0x07, 0xB0, 0x90, 0x07, 0x40,
+0x10, 0x50, 0x00, 0x90, 0x40, 0x0F, 0x04, 0x90, 0x80, 0xF0, 0x25, 0xF0, 0xC0, 0xA0, 0x50, 0x90,
+0x06, 0x90, 0x70, 0x02, 0xA0, 0x0F, 0x0A, 0x0F, 0x03, 0x80, 0xE0, 0x90, 0x03, 0x30, 0x40, 0x01,
+0xE0, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x0B, 0xF0, 0x20, 0x61, 0x20, 0xF0,
+0x27, 0xC0, 0x2B, 0x60, 0xC0, 0xF0, 0x2F, 0x00, 0x60, 0xC0, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x29,
+0xC0, 0x60, 0xF0, 0x22, 0xF0, 0xC0, 0x60, 0x28, 0xF0, 0x90, 0xD0, 0x70, 0x50, 0x06, 0xB0, 0x70,
+0xF0, 0x23, 0xF1, 0x60, 0xF0, 0x30, 0xE0, 0x06, 0x80, 0xA0, 0x80, 0xF0, 0x60, 0x2B, 0xF0, 0x60,
+0x24, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x30, 0x70, 0xA0, 0x70, 0x0C, 0xB0, 0x50, 0x90, 0x30, 0x80,
+0x0C, 0x40, 0x0B, 0x50, 0x40, 0x00, 0x40, 0x30, 0x02, 0x40, 0x0A, 0xB0, 0x40, 0x0D, 0x90, 0x50,
+0x0F, 0x01, 0x91, 0x0A, 0x90, 0xB0, 0x06, 0x40, 0x10, 0xB0, 0x40, 0xB0, 0x0F, 0x05, 0x10, 0xC0,
+0xF0, 0x24, 0xF0, 0xC0, 0x60, 0xA0, 0x09, 0x70, 0x50, 0x01, 0xA0, 0x50, 0x0F, 0x09, 0x0F, 0x03,
+0xB0, 0x50, 0x03, 0xB0, 0x30, 0xE0, 0x30, 0x50, 0xA0, 0xF0, 0x2A, 0xC0, 0x61, 0xC0, 0xF0, 0x2F,
+0x0B, 0xF0, 0xC0, 0x61, 0x20, 0xF0, 0x24, 0xC0, 0x60, 0x2B, 0xF0, 0x61, 0xF1, 0x2E, 0x60, 0xC0,
+0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x29, 0x60, 0xC0, 0xF2, 0x60, 0xC0, 0xF0, 0x28, 0xF0, 0x30, 0x90,
+0x00, 0x90, 0x30, 0x40, 0x05, 0xA0, 0xF1, 0x20, 0xF0, 0xA0, 0x70, 0xC0, 0x60, 0xC0, 0xD0, 0x07,
+0x90, 0x10, 0xA0, 0xF0, 0x60, 0x2B, 0xF0, 0xC1, 0xF2, 0xC0, 0xF0, 0x70, 0xD1, 0xA0, 0x30, 0x70,
+0x00, 0x50, 0x80, 0xD0, 0xB0, 0x0A, 0x90, 0xB0, 0x00, 0xA0, 0x50, 0x0B, 0x40, 0xB0, 0x0C, 0xB0,
+0x40, 0x30, 0x02, 0x40, 0xB0, 0x0A, 0x40, 0x07, 0xE0, 0x04, 0x40, 0x50, 0x0F, 0x00, 0xB0, 0x40,
+0xB0, 0x0C, 0x40, 0x06, 0x50, 0x30, 0xE0, 0x0F, 0x07, 0x10, 0x60, 0xF0, 0x23, 0xC0, 0x60, 0xC0,
+0xF0, 0xA0, 0x09, 0x40, 0x30, 0x40, 0xA0, 0x81, 0x0F, 0x09, 0x0F, 0x02, 0xE0, 0xD0, 0x70, 0xE0,
+0x02, 0xE0, 0x90, 0x01, 0xA0, 0x80, 0xF0, 0x2C, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x0B, 0xF0, 0xC0,
+0x60, 0xC0, 0xF0, 0x22, 0xF0, 0x60, 0xF0, 0x2B, 0xF1, 0xC0, 0x60, 0x20, 0xF0, 0x2D, 0xF0, 0x61,
+0xF0, 0x2A, 0xF0, 0xC0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0xF0, 0x60, 0xC0, 0xF0, 0x28, 0xF0, 0x30,
+0x80, 0xB0, 0x90, 0x00, 0x30, 0xB0, 0x05, 0x70, 0xF0, 0x21, 0xF0, 0xA0, 0xD0, 0x70, 0xE0, 0x30,
+0x70, 0xD0, 0x07, 0xB0, 0xA0, 0xF0, 0x60, 0x2B, 0xF0, 0xC1, 0x60, 0x30, 0x80, 0xD1, 0xA0, 0xB0,
+0x01, 0x11, 0x00, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x01, 0x30, 0x0B, 0xB0, 0x40, 0x0E, 0x50, 0xA0,
+0x50, 0x00, 0x40, 0xB0, 0x0A, 0xE0, 0x07, 0xB0, 0x10, 0x90, 0x02, 0x40, 0x0F, 0x01, 0x50, 0x40,
+0x0E, 0x51, 0x04, 0xE0, 0x80, 0x70, 0x10, 0x0F, 0x06, 0x30, 0x80, 0xC0, 0xF1, 0x20, 0xC0, 0x60,
+0xC0, 0xF2, 0xA0, 0x30, 0xE1, 0x07, 0x10, 0x90, 0x01, 0xA0, 0x0F, 0x09, 0x0F, 0x01, 0x40, 0x30,
+0x00, 0x50, 0x30, 0x10, 0x40, 0x00, 0x30, 0x02, 0x30, 0xC0, 0x2E, 0xF1, 0x61, 0xC0, 0x2F, 0x0B,
+0xF1, 0x61, 0x20, 0xF1, 0xC1, 0xF0, 0x2F, 0x00, 0x61, 0xF0, 0x2D, 0xF0, 0xC0, 0x60, 0xF0, 0x2A,
+0xF0, 0x61, 0xF0, 0x28, 0xF0, 0x61, 0xF1, 0x27, 0xF1, 0x60, 0x12, 0xD0, 0x00, 0x51, 0x04, 0x50,
+0x30, 0xF0, 0x22, 0xA0, 0x90, 0x01, 0x90, 0x0A, 0x40, 0x80, 0xF0, 0xC0, 0x2A, 0xF0, 0x60, 0x30,
+0xD0, 0x70, 0xA0, 0x80, 0x50, 0x10, 0x70, 0x02, 0xB0, 0x00, 0x40, 0x0C, 0x51, 0x00, 0xB0, 0x30,
+0x0B, 0x40, 0x0F, 0x01, 0x50, 0xE1, 0x50, 0x0A, 0x40, 0x09, 0xA1, 0x00, 0xB0, 0x40, 0x0F, 0x01,
+0x40, 0x50, 0x0F, 0x01, 0x40, 0x02, 0x50, 0x40, 0xA0, 0x70, 0xA0, 0x0F, 0x07, 0xD0, 0xF1, 0x20,
+0xC0, 0x60, 0xC0, 0xF0, 0x70, 0xA0, 0xF1, 0xC0, 0x30, 0x10, 0xE0, 0x07, 0x80, 0x40, 0x01, 0x50,
+0xE0, 0x0F, 0x08, 0x0F, 0x01, 0xE0, 0x80, 0x03, 0x70, 0x40, 0xA0, 0x30, 0x90, 0x50, 0x30, 0xF0,
+0x2F, 0x03, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x0C, 0x61, 0xF0, 0x60, 0xF0, 0x2F, 0x02, 0xC0, 0x60,
+0x2F, 0x01, 0x60, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x61, 0x20, 0xF0, 0x26, 0xF0,
+0x60, 0x80, 0xD0, 0x50, 0x04, 0x40, 0x04, 0xA0, 0xC0, 0x21, 0xF0, 0x60, 0xD0, 0x70, 0x01, 0x51,
+0x09, 0x80, 0xE0, 0xC0, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xA0, 0xE0, 0x80, 0x03, 0x50, 0x30, 0x04,
+0x90, 0x0C, 0x90, 0x01, 0x90, 0x30, 0x0A, 0x51, 0x0F, 0x02, 0x50, 0x80, 0x40, 0x08, 0xB0, 0x40,
+0x0A, 0x90, 0x30, 0x50, 0x90, 0x0F, 0x00, 0x50, 0x40, 0x0F, 0x03, 0xB0, 0x90, 0xB0, 0x40, 0x50,
+0x00, 0x30, 0xD0, 0xB0, 0x0F, 0x05, 0x40, 0x10, 0xC0, 0xF0, 0x61, 0xC0, 0x23, 0xD0, 0xF0, 0xA0,
+0x80, 0xB1, 0x09, 0xD0, 0x00, 0xE0, 0x30, 0x70, 0x05, 0xA0, 0xB0, 0x0F, 0x00, 0x0F, 0x02, 0x70,
+0x30, 0xB0, 0x01, 0xA1, 0x00, 0xB0, 0x40, 0x10, 0xC0, 0xF0, 0x2F, 0x03, 0xF1, 0xC0, 0x60, 0xC0,
+0x2F, 0x0B, 0xF1, 0x60, 0xC0, 0xF0, 0x2F, 0x04, 0x60, 0xC0, 0xF0, 0x2E, 0x60, 0x2B, 0xF0, 0xC0,
+0x60, 0xF0, 0x24, 0xF0, 0xC0, 0x60, 0xF0, 0xC0, 0x60, 0x27, 0xF0, 0x70, 0x10, 0xD0, 0x05, 0xB0,
+0x90, 0x02, 0x50, 0xA0, 0xF0, 0x21, 0xF0, 0x20, 0xF0, 0x70, 0x01, 0xB0, 0x90, 0x08, 0x90, 0xD0,
+0xA0, 0x80, 0x31, 0xF0, 0x27, 0xF0, 0x60, 0xA0, 0xD0, 0x80, 0x03, 0x50, 0x80, 0x03, 0xB0, 0x90,
+0x0C, 0x90, 0x02, 0x40, 0xA0, 0x09, 0x40, 0x0F, 0x02, 0xB0, 0xE1, 0x00, 0x40, 0x06, 0xB0, 0x40,
+0x0C, 0x91, 0x0F, 0x00, 0x40, 0x50, 0x0F, 0x05, 0xE0, 0x90, 0x02, 0x50, 0x90, 0x0F, 0x06, 0x10,
+0xA0, 0xC0, 0x60, 0xC0, 0xF0, 0x20, 0xF0, 0x22, 0xF0, 0x61, 0x00, 0x50, 0x0A, 0xA1, 0x90, 0x00,
+0xE0, 0x90, 0x04, 0x80, 0xE0, 0x0F, 0x00, 0x0F, 0x03, 0x40, 0xD2, 0x30, 0x80, 0x02, 0x70, 0xF0,
+0x2F, 0x08, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x07, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0xF0, 0x2F,
+0x03, 0x61, 0xF1, 0x2D, 0x60, 0xC0, 0xF0, 0x29, 0xF0, 0xC0, 0x60, 0x23, 0xF0, 0xC0, 0x60, 0x21,
+0xF0, 0xC1, 0x26, 0xF0, 0x81, 0xB0, 0x06, 0x90, 0xB0, 0xE0, 0x50, 0x70, 0xF1, 0x23, 0xF0, 0x70,
+0xB0, 0x01, 0x40, 0x09, 0x40, 0xB0, 0x00, 0x90, 0xC0, 0xA0, 0xF0, 0x26, 0xF0, 0x30, 0x80, 0xA0,
+0xD0, 0xB0, 0x02, 0xE0, 0x90, 0x03, 0x51, 0x0B, 0x50, 0x90, 0xB0, 0x02, 0x30, 0xB0, 0x07, 0x90,
+0xB0, 0x0F, 0x02, 0x40, 0x00, 0x30, 0xB0, 0x00, 0x40, 0xB0, 0x04, 0x40, 0x0C, 0x40, 0x50, 0x0E,
+0xB0, 0xE0, 0xB0, 0x0F, 0x04, 0x90, 0x40, 0xB0, 0x40, 0x0F, 0x0B, 0xE0, 0x60, 0xC0, 0xF0, 0x28,
+0xA1, 0x30, 0x70, 0xB0, 0x08, 0x50, 0x30, 0x02, 0x30, 0x00, 0x50, 0x40, 0x90, 0xB1, 0x70, 0x0F,
+0x00, 0x0F, 0x00, 0x90, 0x70, 0xA0, 0x40, 0x02, 0xE0, 0x70, 0x50, 0x00, 0x40, 0x60, 0xF0, 0x2F,
+0x08, 0xF1, 0xC0, 0x61, 0x20, 0xF0, 0x2F, 0x06, 0x60, 0xF2, 0x61, 0x20, 0xF0, 0x2F, 0x01, 0xF0,
+0x20, 0x60, 0xC0, 0x2D, 0xF0, 0x61, 0xF0, 0x29, 0xF0, 0xC0, 0x60, 0x21, 0xF0, 0x61, 0xF0, 0x22,
+0xF0, 0x60, 0xC0, 0x25, 0xF0, 0x80, 0x70, 0x10, 0xB0, 0x02, 0x50, 0xB0, 0xE0, 0xA0, 0x30, 0xA2,
+0xF1, 0x20, 0xF2, 0x81, 0x02, 0x51, 0x0B, 0x90, 0x00, 0xA0, 0xF0, 0x26, 0xF0, 0x30, 0x90, 0xA1,
+0x30, 0x01, 0xE0, 0x30, 0x04, 0x90, 0x0C, 0x90, 0x40, 0x50, 0x02, 0xE1, 0x07, 0x40, 0x0F, 0x02,
+0xE0, 0x01, 0x50, 0xA0, 0x01, 0x40, 0xB0, 0x02, 0xE0, 0x0C, 0x40, 0xB0, 0x04, 0xB0, 0x08, 0x91,
+0x0F, 0x04, 0x50, 0x40, 0xB0, 0x01, 0x50, 0xB0, 0x0F, 0x07, 0x50, 0x40, 0x91, 0x80, 0xF0, 0x28,
+0xF4, 0x70, 0xE0, 0x08, 0x10, 0x01, 0x40, 0xD0, 0x70, 0xA0, 0x31, 0x70, 0xD0, 0x10, 0xB0, 0x0E,
+0x0E, 0xB0, 0x70, 0x00, 0x90, 0x10, 0xD0, 0x90, 0x00, 0xA0, 0x00, 0xE0, 0x30, 0x70, 0xF0, 0x2F,
+0x0E, 0x61, 0xC0, 0xF1, 0x2F, 0x02, 0xC0, 0x60, 0x22, 0xF0, 0x20, 0x61, 0xF0, 0x2F, 0x00, 0xF0,
+0x21, 0x61, 0xF1, 0x2B, 0xF0, 0xC0, 0x60, 0xF0, 0x2A, 0xC0, 0x60, 0xF0, 0x60, 0xC0, 0x25, 0xF0,
+0x60, 0xC0, 0xF0, 0x24, 0xF0, 0x70, 0x10, 0xE0, 0x01, 0x90, 0x10, 0x70, 0x60, 0xF0, 0xC0, 0xF2,
+0x22, 0x60, 0xA1, 0xE0, 0x04, 0x40, 0x0B, 0x50, 0xB0, 0xA0, 0xF0, 0x25, 0xF0, 0xC0, 0x30, 0x40,
+0x70, 0xE0, 0xD0, 0xB0, 0x00, 0x40, 0xA0, 0x04, 0x40, 0x0B, 0xB0, 0x90, 0x03, 0xE0, 0xB0, 0x70,
+0x06, 0x40, 0x0F, 0x02, 0x40, 0xB0, 0x02, 0x40, 0xE0, 0x01, 0x40, 0xB0, 0x00, 0x40, 0x0B, 0xB0,
+0x40, 0x06, 0x10, 0xA0, 0xE0, 0x90, 0xE0, 0x10, 0x90, 0x00, 0xB0, 0x40, 0xB0, 0x0F, 0x03, 0xB0,
+0x40, 0x50, 0x04, 0x40, 0x0F, 0x05, 0x50, 0x40, 0x50, 0x01, 0xB0, 0x30, 0xF0, 0x2D, 0xF0, 0x80,
+0x70, 0xB0, 0x06, 0xE0, 0x70, 0x30, 0x50, 0x40, 0x90, 0x04, 0xB0, 0x0F, 0x00, 0x0E, 0x40, 0x80,
+0x01, 0x30, 0xB0, 0x70, 0x90, 0xE0, 0x01, 0xB0, 0xA0, 0xF0, 0x2F, 0x0E, 0xF0, 0x20, 0x61, 0xC0,
+0x2F, 0x01, 0xF0, 0x60, 0x25, 0xF0, 0xC0, 0x60, 0xC0, 0x2F, 0x03, 0xC0, 0x60, 0xC0, 0xF0, 0x2B,
+0xF0, 0xC0, 0x60, 0x2A, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0x60, 0x26, 0xF0, 0x71, 0xA1,
+0x80, 0xC0, 0xF0, 0x22, 0x60, 0xF0, 0x22, 0x60, 0xD0, 0xB0, 0x06, 0x90, 0x0B, 0xB0, 0x40, 0x30,
+0xF1, 0x23, 0xF1, 0x30, 0x51, 0xA0, 0xD0, 0xB0, 0x02, 0x30, 0x50, 0x03, 0x90, 0x0B, 0x90, 0xB0,
+0x03, 0x40, 0xB0, 0xA0, 0x05, 0xB0, 0x90, 0x0F, 0x01, 0x90, 0x50, 0x04, 0xA0, 0x50, 0x01, 0x41,
+0x0B, 0x50, 0x40, 0x08, 0x40, 0xA0, 0x10, 0xD0, 0x30, 0x80, 0x31, 0x90, 0x51, 0x02, 0xB0, 0x0C,
+0x91, 0x06, 0x51, 0x0F, 0x02, 0x50, 0x40, 0x50, 0x03, 0xB0, 0x30, 0xF0, 0x2E, 0xF1, 0xA0, 0xE0,
+0x80, 0x00, 0x50, 0x30, 0xD0, 0xE0, 0xB0, 0x70, 0x02, 0x30, 0x03, 0xB0, 0x50, 0xB0, 0x0E, 0x0F,
+0x00, 0x10, 0xE0, 0x40, 0xD0, 0x00, 0xE0, 0x71, 0x50, 0x00, 0xE1, 0xF0, 0x2F, 0x0F, 0xF1, 0x20,
+0xC0, 0x60, 0xC0, 0xF0, 0x2D, 0xC1, 0xF0, 0x27, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0x61, 0xF0,
+0x2B, 0xF0, 0xC0, 0x60, 0x29, 0xF0, 0x60, 0xC0, 0x2A, 0x60, 0xF0, 0x25, 0xF5, 0x23, 0x60, 0xC0,
+0x22, 0xC0, 0x10, 0x60, 0xA0, 0x50, 0x04, 0xB0, 0x50, 0x0A, 0xE0, 0x30, 0x60, 0xF0, 0x23, 0xF1,
+0x60, 0xA0, 0x00, 0x50, 0x04, 0xE0, 0x80, 0x03, 0xB0, 0x90, 0x0B, 0x40, 0x06, 0x70, 0x05, 0x40,
+0x0F, 0x01, 0x50, 0x90, 0x05, 0x90, 0x30, 0x02, 0x40, 0xB0, 0x09, 0x91, 0x0C, 0xB0, 0xE0, 0x80,
+0x10, 0xE0, 0x70, 0x11, 0x70, 0xE0, 0x90, 0x10, 0xB0, 0x09, 0x50, 0x40, 0xB0, 0x08, 0x40, 0x0F,
+0x00, 0x90, 0x40, 0x50, 0x05, 0x90, 0xD0, 0xF0, 0x2F, 0x00, 0xF0, 0x81, 0x60, 0xA1, 0x60, 0xC0,
+0xD0, 0x00, 0x70, 0x50, 0x00, 0xE0, 0x10, 0xB0, 0x00, 0x40, 0xD1, 0xA0, 0xD0, 0xB0, 0x0D, 0x0E,
+0x51, 0xE0, 0x30, 0xB0, 0x80, 0x71, 0x12, 0xD0, 0x50, 0xF0, 0x2F, 0x13, 0xF0, 0x61, 0xC0, 0x2C,
+0x60, 0x28, 0xF1, 0x20, 0xC0, 0x60, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x2B, 0xF0, 0x60,
+0xC0, 0xF0, 0x25, 0xF0, 0x60, 0xC0, 0x2A, 0xF0, 0x20, 0x60, 0xF0, 0x2E, 0xF0, 0x60, 0x22, 0xF0,
+0x60, 0x80, 0xC0, 0x10, 0xA0, 0xB0, 0x01, 0x50, 0xA0, 0x40, 0x09, 0xE0, 0x10, 0x80, 0xF0, 0x24,
+0xF0, 0xC0, 0xD0, 0x01, 0x90, 0xB0, 0x01, 0xE0, 0x80, 0x70, 0xB0, 0x03, 0xB0, 0x50, 0x0A, 0xB0,
+0x90, 0x06, 0x90, 0x30, 0x03, 0x51, 0x0F, 0x00, 0xB0, 0x40, 0x07, 0xA0, 0xB0, 0x02, 0x40, 0xB0,
+0x07, 0x40, 0x50, 0x0D, 0x50, 0x90, 0x05, 0x40, 0x31, 0x70, 0x80, 0x07, 0x50, 0x40, 0xB0, 0x02,
+0x90, 0xD0, 0xB0, 0x04, 0xB0, 0x90, 0x0C, 0x90, 0x40, 0xB0, 0x07, 0x80, 0x60, 0xF0, 0x2F, 0x01,
+0xF6, 0x30, 0xB0, 0x50, 0x13, 0x40, 0x30, 0xA0, 0xB0, 0x01, 0x90, 0x80, 0x0D, 0x0D, 0x80, 0x70,
+0xD0, 0xE0, 0x01, 0x91, 0x40, 0x00, 0x40, 0xD0, 0x30, 0x60, 0xC0, 0x20, 0xF1, 0x2F, 0x13, 0xC0,
+0x60, 0xC0, 0x20, 0xF0, 0x27, 0xC1, 0xF0, 0x2C, 0x61, 0x2F, 0x02, 0xF0, 0x60, 0xC0, 0xF0, 0x2C,
+0x61, 0x24, 0xF0, 0x60, 0xC0, 0x2C, 0xF0, 0xC0, 0x60, 0xF0, 0x2D, 0xF0, 0xC0, 0x60, 0x22, 0xF3,
+0xC0, 0xA0, 0x90, 0xD0, 0x10, 0x51, 0xB0, 0x07, 0xB0, 0x10, 0xC0, 0x60, 0x24, 0xF1, 0xD0, 0x10,
+0xE0, 0x00, 0x50, 0xB0, 0x01, 0x70, 0x06, 0x50, 0xB0, 0x0A, 0x90, 0xB0, 0x07, 0x80, 0x50, 0x02,
+0x40, 0x0F, 0x00, 0xB0, 0x40, 0x07, 0xA0, 0x40, 0x04, 0x40, 0x06, 0x40, 0xB0, 0x0D, 0x40, 0x50,
+0x0A, 0x10, 0x05, 0xB0, 0x40, 0x50, 0x03, 0xD1, 0x81, 0x05, 0x40, 0x09, 0xB0, 0x90, 0x40, 0xB0,
+0x09, 0x81, 0x60, 0xF2, 0x2F, 0x02, 0xF2, 0x80, 0x41, 0x10, 0x30, 0xB0, 0x00, 0xA1, 0x03, 0x70,
+0x40, 0x0D, 0x0C, 0xB0, 0x70, 0x01, 0xD0, 0xB0, 0x00, 0x80, 0x30, 0xB0, 0x01, 0x80, 0xC0, 0xF0,
+0xC0, 0x61, 0xC0, 0x2F, 0x14, 0xF0, 0xC0, 0x61, 0x21, 0xF0, 0x24, 0x60, 0xF0, 0x2E, 0xC0, 0x60,
+0xC0, 0x2F, 0x00, 0xF1, 0x61, 0x2D, 0xC0, 0x60, 0x20, 0xF0, 0x20, 0xF0, 0xC0, 0x60, 0x2E, 0xF0,
+0x61, 0xF0, 0x2D, 0xF0, 0x60, 0x23, 0xF1, 0x80, 0x32, 0x70, 0xB0, 0x00, 0xB0, 0x90, 0x06, 0x90,
+0x10, 0x30, 0xC2, 0x21, 0xF2, 0xA0, 0x70, 0x10, 0x51, 0x40, 0xB0, 0x01, 0xE0, 0x50, 0x05, 0x90,
+0xB0, 0x0A, 0x40, 0x08, 0x90, 0x40, 0x01, 0x90, 0xB0, 0x0F, 0x00, 0x40, 0x07, 0x90, 0xE0, 0x06,
+0x40, 0x03, 0xB0, 0x40, 0xB0, 0x0C, 0xB0, 0x40, 0xB0, 0x0B, 0xD0, 0x04, 0x91, 0x04, 0x31, 0x40,
+0xA0, 0x06, 0xB0, 0x50, 0x06, 0xB0, 0x91, 0xB0, 0x0B, 0xB0, 0x81, 0x70, 0x60, 0xF1, 0x2E, 0xF1,
+0x20, 0xC0, 0x61, 0xA0, 0x00, 0xD0, 0x90, 0x01, 0xE0, 0xD0, 0x51, 0x30, 0xD0, 0xE0, 0x0E, 0x0C,
+0xB0, 0x70, 0xB0, 0x00, 0xE1, 0xB0, 0x71, 0x30, 0x40, 0x00, 0xA0, 0xF0, 0x23, 0x61, 0xC0, 0x20,
+0xF1, 0x2F, 0x10, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0xF0, 0x21, 0xF0, 0xC1, 0x2F, 0x02, 0x61, 0x20,
+0xF0, 0x2E, 0xF0, 0x20, 0x60, 0xC0, 0xF0, 0x2B, 0xC0, 0x60, 0xF1, 0xC0, 0x60, 0xF0, 0x2F, 0x00,
+0xF0, 0x60, 0xC0, 0xF0, 0x2A, 0xF0, 0x22, 0x60, 0xF0, 0x20, 0xF0, 0xC0, 0x70, 0xE0, 0xB0, 0x90,
+0x80, 0x40, 0x02, 0x40, 0x07, 0x40, 0x31, 0x80, 0xC0, 0x20, 0xF1, 0xC0, 0x70, 0x13, 0x80, 0x31,
+0xB0, 0x00, 0x90, 0xE0, 0x05, 0x40, 0x0A, 0x51, 0x06, 0xE0, 0xA0, 0x40, 0x10, 0x40, 0x00, 0x90,
+0x0F, 0x00, 0x40, 0xB0, 0x07, 0xA0, 0x08, 0x40, 0x01, 0x50, 0x40, 0x0D, 0x91, 0x0D, 0xE0, 0xA0,
+0x01, 0x50, 0x40, 0xB0, 0x03, 0x80, 0x70, 0x60, 0x90, 0x70, 0x08, 0x40, 0x04, 0xB0, 0x40, 0x90,
+0x0F, 0x03, 0x80, 0xD0, 0x60, 0xF0, 0x2B, 0xF1, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x30, 0x40, 0xE0,
+0xA0, 0x00, 0x80, 0xA3, 0xE0, 0xB1, 0x30, 0x80, 0x0C, 0x0D, 0x40, 0xE0, 0x00, 0xB0, 0x70, 0x80,
+0xA0, 0x50, 0x00, 0x90, 0xD0, 0x60, 0xF0, 0x24, 0xF0, 0xC0, 0x62, 0x20, 0xF0, 0x2F, 0x11, 0xF0,
+0x20, 0x61, 0x20, 0xF1, 0x60, 0xF0, 0x2F, 0x02, 0xF0, 0x20, 0x61, 0x2F, 0x01, 0xF0, 0x61, 0xF0,
+0x2B, 0xF0, 0x60, 0xC0, 0x60, 0xF0, 0x2F, 0x02, 0xF0, 0x60, 0x2E, 0xF0, 0x60, 0xC0, 0xF1, 0x70,
+0x50, 0x07, 0x50, 0xB0, 0x08, 0xA0, 0x80, 0xC0, 0xF0, 0x60, 0xA0, 0x30, 0x00, 0x40, 0x81, 0x01,
+0x50, 0x90, 0xA0, 0x80, 0xA0, 0x06, 0x40, 0x0A, 0x90, 0x06, 0x50, 0xA0, 0xB0, 0xD0, 0x50, 0x80,
+0x31, 0x40, 0x50, 0x0C, 0x90, 0xB0, 0x07, 0x41, 0x08, 0xB0, 0x40, 0x50, 0x90, 0x0C, 0xB0, 0x40,
+0xB0, 0x0E, 0x50, 0x10, 0x80, 0x40, 0x50, 0x04, 0x90, 0x30, 0xF1, 0xA0, 0x70, 0x08, 0x51, 0x01,
+0x50, 0x40, 0x90, 0x0F, 0x06, 0x71, 0xF0, 0x29, 0xF0, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x22, 0xF0,
+0xA1, 0x10, 0xE0, 0xB0, 0x00, 0xA0, 0x03, 0xE0, 0x50, 0x80, 0xB0, 0x0B, 0x0F, 0x02, 0x80, 0x10,
+0x80, 0x02, 0x30, 0xC0, 0x28, 0xF0, 0xC0, 0x61, 0xC0, 0x2F, 0x14, 0x61, 0xC1, 0xF0, 0x2F, 0x04,
+0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2D, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2A, 0xC0, 0x60, 0xC0, 0xF0,
+0x2F, 0x04, 0x60, 0x20, 0xF0, 0x2C, 0xF0, 0x60, 0xF0, 0x30, 0x80, 0x02, 0x50, 0x90, 0x40, 0x02,
+0x50, 0x80, 0xD0, 0x40, 0xB0, 0x51, 0x00, 0xB0, 0xE0, 0x70, 0xC1, 0x30, 0xA0, 0x30, 0x80, 0x06,
+0x50, 0xB0, 0x00, 0x70, 0x30, 0x05, 0xB0, 0x50, 0x0A, 0x90, 0x05, 0x31, 0x03, 0xB0, 0x90, 0x00,
+0xE0, 0x70, 0x00, 0x90, 0x40, 0x00, 0xB0, 0x06, 0x50, 0x90, 0x08, 0xA0, 0x0A, 0x41, 0x0C, 0x90,
+0x40, 0x0D, 0x50, 0x30, 0x10, 0xD0, 0x30, 0x90, 0x05, 0x40, 0xA0, 0xF1, 0xA0, 0x40, 0x0A, 0x40,
+0x50, 0x40, 0x50, 0x0F, 0x08, 0x50, 0xD0, 0xF0, 0x27, 0xC0, 0x61, 0xC0, 0xF0, 0x26, 0xF1, 0xC0,
+0xD0, 0x90, 0x01, 0xE0, 0x50, 0x03, 0x80, 0x40, 0x0C, 0x0F, 0x03, 0x90, 0xD0, 0x90, 0xB0, 0x00,
+0x70, 0xF0, 0x2A, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2F, 0x0F, 0xF1, 0x61, 0xC0, 0x2F,
+0x07, 0xC0, 0x60, 0xC0, 0xF0, 0x2D, 0xF0, 0x20, 0x61, 0x29, 0xF0, 0x60, 0xC0, 0x60, 0xC0, 0x2F,
+0x05, 0x60, 0xF0, 0x2C, 0xF0, 0xC0, 0x30, 0x40, 0x03, 0xD0, 0x30, 0x80, 0xA0, 0x80, 0x30, 0xA0,
+0x30, 0x10, 0xA0, 0x30, 0x80, 0x30, 0x70, 0x30, 0x60, 0xC0, 0xF0, 0x30, 0xE0, 0x01, 0x30, 0xE0,
+0x90, 0x04, 0x90, 0xB1, 0x70, 0xA0, 0x05, 0x51, 0x09, 0x50, 0xB0, 0x03, 0x50, 0xA0, 0x90, 0x04,
+0x40, 0x01, 0xB0, 0xA0, 0x00, 0x70, 0x80, 0x30, 0x10, 0x05, 0xB0, 0x90, 0x08, 0x90, 0xE0, 0x09,
+0x40, 0xB0, 0x51, 0x0A, 0x40, 0x50, 0x0E, 0xD1, 0x80, 0x50, 0xB0, 0x05, 0x90, 0x70, 0xF2, 0x70,
+0xE0, 0x50, 0x08, 0x50, 0xE0, 0x90, 0x0F, 0x0B, 0x90, 0x70, 0xF1, 0x21, 0xF0, 0x20, 0xC0, 0x61,
+0xC0, 0xF1, 0x29, 0xF0, 0x60, 0xA0, 0x00, 0xB0, 0xE0, 0x30, 0x0F, 0x03, 0x0F, 0x03, 0x50, 0x80,
+0x40, 0x30, 0xA0, 0x80, 0xF0, 0x2F, 0x00, 0xC0, 0x61, 0x20, 0xF1, 0x2F, 0x0C, 0xF0, 0xC1, 0xF0,
+0x61, 0xC0, 0xF0, 0x2F, 0x06, 0x61, 0xC0, 0xF0, 0x2D, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x25, 0xF0,
+0x60, 0xC0, 0xF0, 0x20, 0x61, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xF0, 0x2A, 0xF0, 0x80, 0xA0, 0xE0,
+0x80, 0xA1, 0xE0, 0x50, 0x30, 0xF2, 0xC0, 0x60, 0xF0, 0xC0, 0x30, 0xF8, 0xA0, 0x90, 0x01, 0xB0,
+0x80, 0xA0, 0x04, 0x90, 0xB0, 0x00, 0x90, 0x30, 0x50, 0x04, 0x90, 0xB0, 0x09, 0x40, 0x02, 0xB0,
+0xA0, 0x70, 0x05, 0x51, 0x03, 0x70, 0x80, 0x01, 0xA2, 0x80, 0x02, 0x40, 0x09, 0x90, 0xE0, 0x08,
+0x40, 0xB0, 0x01, 0x40, 0xB0, 0x07, 0x50, 0x40, 0x0F, 0x01, 0xE0, 0x30, 0x07, 0xE0, 0xA0, 0x60,
+0xF0, 0x21, 0xC0, 0x60, 0xA0, 0xD0, 0x50, 0x04, 0x90, 0x40, 0xB0, 0x00, 0x40, 0x0F, 0x0C, 0xA0,
+0xF2, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2C, 0xF1, 0x10, 0xA0, 0x80, 0x50, 0xA0, 0x0F, 0x03, 0x0F,
+0x03, 0x30, 0x02, 0x30, 0xF1, 0x2F, 0x01, 0xF0, 0x20, 0x61, 0xC0, 0x2F, 0x0C, 0xF0, 0x60, 0x21,
+0xF1, 0xC0, 0x60, 0xC0, 0x20, 0xF1, 0x2F, 0x02, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2C, 0xF0, 0x20,
+0x61, 0xF0, 0x23, 0xF0, 0xC0, 0x60, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0x21, 0xF0, 0x2F, 0x00, 0xF0,
+0xC0, 0x60, 0xF0, 0x29, 0xF0, 0xD0, 0xA1, 0x60, 0xF1, 0x80, 0x70, 0xF0, 0x24, 0xF1, 0x60, 0x27,
+0xF0, 0xA0, 0xB1, 0x02, 0x40, 0x70, 0x50, 0x02, 0x90, 0xB0, 0x01, 0xB0, 0x70, 0x04, 0x90, 0x0A,
+0x90, 0x01, 0x10, 0x70, 0x07, 0x40, 0x0B, 0x40, 0xA0, 0x00, 0x40, 0xB0, 0x04, 0x90, 0x30, 0xA0,
+0x30, 0x01, 0xA0, 0x06, 0xB0, 0x40, 0x04, 0x40, 0x06, 0x40, 0x90, 0x0F, 0x00, 0xB0, 0x40, 0xA0,
+0x40, 0x05, 0xB0, 0x70, 0x80, 0xF1, 0x22, 0xF1, 0xD0, 0x40, 0x02, 0xB0, 0x41, 0xB0, 0x02, 0x51,
+0x0F, 0x0B, 0xB0, 0xA0, 0x60, 0xC1, 0xF2, 0x2F, 0x00, 0xF0, 0x70, 0x50, 0x01, 0x80, 0xB0, 0x0F,
+0x02, 0x0F, 0x03, 0x70, 0x02, 0xA0, 0xF0, 0x2F, 0x06, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2F, 0x08,
+0x60, 0xF0, 0x24, 0xC0, 0x61, 0x2F, 0x05, 0xF0, 0x20, 0x61, 0xF1, 0x2D, 0xC0, 0x60, 0x23, 0xC0,
+0x60, 0xF0, 0x25, 0x60, 0x2F, 0x03, 0xF0, 0x60, 0xC0, 0xF0, 0x29, 0xF0, 0x61, 0xC0, 0x21, 0xF2,
+0x25, 0xF0, 0x60, 0x26, 0xF0, 0xC0, 0xA0, 0x00, 0x50, 0x03, 0xB0, 0x30, 0x70, 0xB0, 0x00, 0x50,
+0xB0, 0x01, 0xB0, 0xA0, 0x04, 0x40, 0x09, 0x90, 0xB0, 0x01, 0xE0, 0x80, 0x06, 0x90, 0xB0, 0x0C,
+0x90, 0x31, 0x70, 0xE0, 0x00, 0x80, 0xA1, 0x30, 0x01, 0x50, 0xA0, 0x30, 0xD0, 0x80, 0x04, 0x91,
+0x06, 0x90, 0x03, 0xB0, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x90, 0x00, 0x10, 0x50, 0x03, 0xB0, 0xD0,
+0x30, 0xC0, 0xF0, 0x25, 0x60, 0x10, 0x01, 0x50, 0x40, 0x90, 0x06, 0x40, 0x0F, 0x09, 0xB0, 0x90,
+0x40, 0xB0, 0x80, 0xA0, 0x60, 0xF1, 0x2F, 0x02, 0x60, 0xA0, 0x01, 0x40, 0xE0, 0x0F, 0x02, 0x0F,
+0x02, 0x50, 0xA0, 0x30, 0x80, 0x40, 0x30, 0xF0, 0x2F, 0x07, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x2F,
+0x06, 0x60, 0x27, 0xF0, 0xC0, 0x61, 0x2F, 0x05, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2B, 0xF0, 0x20,
+0x60, 0xC0, 0xF0, 0x20, 0x60, 0x28, 0x60, 0xC0, 0xF0, 0x2F, 0x01, 0xF0, 0x60, 0xC0, 0x2B, 0xF0,
+0x20, 0x60, 0x28, 0xF1, 0xC1, 0x20, 0xF0, 0x21, 0xF1, 0xC0, 0x70, 0x50, 0x00, 0x40, 0x05, 0x80,
+0xB0, 0xE0, 0x30, 0xB0, 0x00, 0x50, 0xD0, 0x40, 0x04, 0x40, 0x09, 0x40, 0x03, 0x80, 0x90, 0x05,
+0x90, 0x0D, 0x91, 0x40, 0x00, 0xE0, 0x70, 0x40, 0x06, 0xE0, 0x40, 0xB0, 0x03, 0x90, 0x50, 0x06,
+0x90, 0x30, 0x90, 0x01, 0x91, 0x0D, 0x50, 0x00, 0x90, 0x40, 0x01, 0x50, 0x10, 0xB0, 0x04, 0x10,
+0xA0, 0xF1, 0x24, 0xF0, 0x60, 0x80, 0xB0, 0x40, 0x50, 0x08, 0x90, 0xB0, 0x0F, 0x06, 0x50, 0x40,
+0x90, 0xB0, 0x02, 0xB0, 0x80, 0xA0, 0xC0, 0xF0, 0x2F, 0x01, 0xF0, 0x70, 0x90, 0x30, 0x80, 0xA0,
+0x0F, 0x02, 0x0F, 0x02, 0x80, 0x50, 0x00, 0xB0, 0x70, 0x60, 0xF0, 0x2F, 0x0B, 0xC0, 0x62, 0x2F,
+0x04, 0x60, 0x2A, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x04, 0xC0, 0x60, 0xC0, 0xF0, 0x2D, 0x60, 0xC0,
+0x60, 0x29, 0xF0, 0x60, 0xC0, 0x2F, 0x03, 0x60, 0x20, 0xF0, 0x29, 0xF1, 0x60, 0xC0, 0x25, 0xF0,
+0x61, 0xC0, 0xF0, 0x60, 0xF0, 0x20, 0xF0, 0xC0, 0x30, 0x70, 0x30, 0x50, 0x01, 0x40, 0x05, 0xE0,
+0xA1, 0x80, 0x01, 0x30, 0x40, 0xE0, 0x03, 0xB0, 0x90, 0x08, 0xB0, 0x90, 0x03, 0xE0, 0x90, 0x04,
+0x40, 0x0D, 0x50, 0x90, 0x03, 0x90, 0x07, 0x80, 0xB0, 0x03, 0x40, 0xB0, 0x06, 0xE0, 0x80, 0xB0,
+0x80, 0x41, 0x50, 0x0E, 0xA0, 0xE0, 0xB0, 0x01, 0x80, 0x10, 0x50, 0x04, 0xB0, 0x10, 0xC0, 0xF0,
+0x25, 0xF0, 0x80, 0xE0, 0x50, 0x0A, 0xB0, 0x90, 0x0F, 0x03, 0x50, 0x40, 0x90, 0x50, 0x07, 0xB0,
+0xA0, 0x30, 0x60, 0xF1, 0x2D, 0xF0, 0xD0, 0x80, 0x01, 0x80, 0x50, 0x0F, 0x01, 0x0F, 0x02, 0x30,
+0x02, 0xA0, 0xF0, 0x2F, 0x0D, 0xF1, 0x20, 0x61, 0xC0, 0x20, 0xF0, 0x2D, 0xC1, 0x2B, 0xF0, 0x20,
+0x61, 0xC0, 0xF0, 0x2F, 0x04, 0x61, 0xF1, 0x28, 0xF0, 0x21, 0xF0, 0x60, 0xC0, 0xF0, 0x2A, 0xC0,
+0x60, 0xF0, 0x2F, 0x02, 0x60, 0x20, 0xF0, 0x20, 0xF0, 0x28, 0xF0, 0x60, 0xF0, 0x22, 0xC0, 0x60,
+0xF0, 0xA0, 0x30, 0xD0, 0xC2, 0xF0, 0xC0, 0xA0, 0x50, 0x04, 0x90, 0x08, 0x30, 0xE0, 0x00, 0x80,
+0xB0, 0x40, 0xA0, 0x02, 0x50, 0xB0, 0x08, 0x40, 0x05, 0xA0, 0x03, 0xB0, 0x90, 0x0C, 0x50, 0x90,
+0x0D, 0x30, 0x02, 0xB0, 0x40, 0xB0, 0x06, 0x90, 0x70, 0x02, 0x30, 0xB0, 0x0D, 0xB0, 0x90, 0x50,
+0x10, 0x01, 0x90, 0x70, 0x04, 0x50, 0xE0, 0xD0, 0x10, 0xF1, 0x21, 0xF2, 0xC1, 0xE0, 0x10, 0x0C,
+0x40, 0x0F, 0x00, 0xB0, 0x41, 0x50, 0x0C, 0x50, 0x40, 0x70, 0x80, 0xF1, 0x2B, 0xF0, 0x60, 0x80,
+0x01, 0x50, 0xE0, 0x0F, 0x01, 0x0F, 0x01, 0x50, 0x70, 0xE0, 0x50, 0x90, 0x80, 0xF0, 0x2F, 0x11,
+0xF0, 0xC0, 0x61, 0xC0, 0xF1, 0x28, 0xF0, 0x20, 0x60, 0x2E, 0xF0, 0x20, 0x61, 0xC0, 0xF1, 0x2F,
+0x01, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x28, 0xF0, 0x20, 0x60, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0x2F,
+0x02, 0xC0, 0x60, 0xF0, 0x2A, 0xF0, 0xC1, 0x22, 0xC0, 0x60, 0xF0, 0x30, 0x51, 0x70, 0x80, 0x60,
+0xF0, 0x30, 0xA0, 0xB0, 0x04, 0x90, 0x08, 0x50, 0xE0, 0x30, 0xA0, 0x90, 0x80, 0x90, 0x02, 0x90,
+0x09, 0x40, 0x05, 0x50, 0xA0, 0x90, 0x01, 0x40, 0x0C, 0xB0, 0x40, 0x08, 0x50, 0xE0, 0x80, 0xA0,
+0x80, 0x50, 0xD0, 0xB0, 0x00, 0xB0, 0x90, 0x06, 0x40, 0xA0, 0xE0, 0x03, 0xB0, 0x30, 0x50, 0x0A,
+0xB0, 0x40, 0x51, 0xA0, 0x70, 0x80, 0x70, 0xE0, 0x03, 0x30, 0x13, 0xC0, 0xF0, 0x21, 0xF1, 0x60,
+0x80, 0xA1, 0x70, 0xE0, 0x0C, 0x51, 0x0B, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x03, 0x40, 0x70, 0xC0,
+0xF0, 0x2A, 0xF0, 0xC0, 0xD0, 0x00, 0x40, 0x80, 0x70, 0x0F, 0x01, 0x0F, 0x01, 0xE0, 0x90, 0x50,
+0xE0, 0x70, 0x60, 0xF0, 0x2F, 0x13, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x28, 0xC1, 0x2F, 0x01, 0xF0,
+0x20, 0xC0, 0x60, 0xC0, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xC0, 0x29, 0x60, 0x2E, 0xF0, 0x20, 0x60,
+0x2F, 0x02, 0xC0, 0x60, 0x2B, 0xF0, 0x60, 0x23, 0xF0, 0xA0, 0x60, 0x30, 0x00, 0x41, 0x80, 0xA1,
+0x40, 0x05, 0x50, 0xB0, 0x07, 0x50, 0x00, 0xB0, 0x90, 0x80, 0x30, 0xA0, 0x02, 0x40, 0x08, 0x51,
+0x07, 0x30, 0x40, 0x51, 0x02, 0x90, 0x30, 0xE0, 0x50, 0x01, 0x50, 0xB0, 0x01, 0x40, 0x09, 0xA0,
+0x51, 0x00, 0x40, 0xE0, 0x50, 0x31, 0x40, 0xE1, 0x80, 0xE0, 0xA0, 0x31, 0x40, 0x30, 0x06, 0x90,
+0x70, 0x50, 0x08, 0x91, 0xB1, 0x30, 0x12, 0x80, 0x02, 0xA0, 0x30, 0xD0, 0x71, 0xD0, 0x11, 0x60,
+0xF1, 0x60, 0x31, 0x11, 0x40, 0xB0, 0x0E, 0x40, 0x08, 0xB0, 0x50, 0x40, 0x90, 0xB0, 0x0F, 0x06,
+0xB0, 0x70, 0x60, 0xF2, 0x20, 0xF0, 0x25, 0xF1, 0x70, 0xA0, 0x40, 0xB0, 0x30, 0x0F, 0x01, 0x0F,
+0x01, 0x30, 0xB0, 0x01, 0xA0, 0x2F, 0x1A, 0x61, 0xC1, 0xF0, 0x24, 0x60, 0x2F, 0x06, 0xC0, 0x60,
+0xC0, 0xF1, 0x2F, 0x02, 0x61, 0x20, 0xF0, 0x25, 0xC0, 0x60, 0xF1, 0x2D, 0xF0, 0x20, 0x60, 0xC0,
+0xF0, 0x2E, 0xF0, 0x60, 0xC0, 0x28, 0xF3, 0x60, 0xF1, 0x21, 0xC0, 0xF0, 0xA0, 0x02, 0x50, 0xB0,
+0x07, 0xB0, 0x50, 0x07, 0x50, 0xB0, 0x03, 0x40, 0x70, 0x41, 0x90, 0x08, 0x90, 0x09, 0x80, 0xA0,
+0xB0, 0x02, 0x70, 0xB0, 0x50, 0xE0, 0x30, 0xA0, 0x30, 0x70, 0x90, 0x40, 0xB0, 0x08, 0x80, 0x40,
+0x05, 0x51, 0x10, 0xE0, 0x90, 0x52, 0x00, 0xB0, 0xE0, 0x08, 0x40, 0xA0, 0xE0, 0x05, 0xB0, 0x40,
+0x50, 0x00, 0xB0, 0x70, 0xC0, 0x60, 0x30, 0x10, 0xE0, 0xB0, 0x80, 0x10, 0x81, 0x10, 0xB0, 0x01,
+0xB0, 0xE0, 0x10, 0xE0, 0x40, 0xD0, 0xE0, 0x00, 0x70, 0x10, 0x31, 0xB0, 0x0D, 0x51, 0x05, 0xB0,
+0x90, 0x40, 0x50, 0x0F, 0x0A, 0xB0, 0x80, 0x70, 0x60, 0xA2, 0xC0, 0x25, 0xF0, 0xA0, 0xE0, 0x01,
+0x40, 0x90, 0x0F, 0x00, 0x0F, 0x01, 0x70, 0x02, 0xA0, 0xF0, 0x2F, 0x19, 0xF1, 0xC0, 0x61, 0xC0,
+0x23, 0x60, 0xF0, 0x2F, 0x05, 0xF1, 0xC0, 0x61, 0x20, 0xF0, 0x2F, 0x00, 0xF0, 0xC0, 0x61, 0x25,
+0x60, 0xF0, 0x2F, 0x01, 0xF1, 0x60, 0xC0, 0xF0, 0x2E, 0xF0, 0x60, 0xC0, 0x27, 0x80, 0xA1, 0x70,
+0xA0, 0x70, 0x60, 0xF3, 0xA0, 0x03, 0x90, 0x08, 0x40, 0x07, 0x90, 0xB0, 0x04, 0xB0, 0x40, 0xE0,
+0x31, 0x80, 0x06, 0x90, 0x09, 0x90, 0xB0, 0xD0, 0xA0, 0x00, 0x30, 0xE0, 0x05, 0x50, 0x30, 0xB0,
+0x07, 0x70, 0xA0, 0xE0, 0x05, 0x40, 0xB0, 0x40, 0x80, 0x0F, 0x01, 0xB0, 0x50, 0x40, 0xA0, 0x02,
+0xB0, 0x40, 0x90, 0x02, 0x50, 0x80, 0xF0, 0xC0, 0x70, 0xA0, 0x31, 0xA0, 0x30, 0x50, 0xA0, 0x40,
+0x02, 0xB0, 0x90, 0x40, 0x11, 0x50, 0x00, 0xE0, 0x70, 0x50, 0xF0, 0xC0, 0x70, 0x80, 0x10, 0xA0,
+0x51, 0x90, 0x07, 0xB0, 0x90, 0x02, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x0F, 0xB0, 0x80, 0x00, 0x80,
+0xA0, 0x80, 0xF0, 0x25, 0xC0, 0xA0, 0x01, 0x90, 0x30, 0x0F, 0x00, 0x0F, 0x00, 0x90, 0x33, 0x80,
+0xF1, 0x2F, 0x1B, 0xF1, 0xC0, 0x61, 0xC2, 0xF0, 0x2F, 0x08, 0xF0, 0xC0, 0x61, 0x20, 0xF1, 0x2E,
+0xF0, 0xC0, 0x60, 0xC0, 0xF2, 0x60, 0x2F, 0x06, 0xC0, 0x60, 0x20, 0xF0, 0x2D, 0xF0, 0x60, 0x25,
+0xF0, 0xA0, 0x90, 0xB0, 0x00, 0x50, 0x00, 0x90, 0xA0, 0x31, 0x70, 0xA0, 0xD0, 0x50, 0x02, 0x40,
+0x08, 0x40, 0x07, 0x50, 0xB0, 0x06, 0xB0, 0x50, 0xB0, 0xA0, 0x05, 0x50, 0xB0, 0x08, 0xB0, 0x40,
+0xA1, 0xE0, 0x30, 0x40, 0x06, 0x40, 0xE0, 0x05, 0x90, 0x30, 0x70, 0x07, 0x40, 0x00, 0x30, 0x40,
+0x0F, 0x03, 0x90, 0x00, 0xE0, 0x40, 0x00, 0x40, 0x90, 0x02, 0xE0, 0x10, 0xA0, 0xC0, 0x20, 0xF5,
+0x50, 0xA0, 0x50, 0x01, 0x50, 0x40, 0x90, 0x02, 0x50, 0x71, 0x60, 0xF1, 0x21, 0xF0, 0xC0, 0xF1,
+0x31, 0x80, 0x70, 0xA0, 0x40, 0x05, 0x40, 0xB0, 0x90, 0x40, 0x90, 0x0F, 0x14, 0xE0, 0x80, 0xF1,
+0x22, 0xF3, 0xC0, 0x10, 0x80, 0xA0, 0x80, 0xA0, 0x0F, 0x00, 0x0F, 0x00, 0x80, 0xB0, 0x01, 0x30,
+0x62, 0xC1, 0x20, 0xF0, 0x2F, 0x19, 0xF2, 0xC0, 0x61, 0xC0, 0x2F, 0x0A, 0xF0, 0xC0, 0x61, 0xC0,
+0xF1, 0x20, 0xF0, 0x2B, 0xF1, 0xC0, 0x60, 0x20, 0xC0, 0x60, 0xF0, 0x2F, 0x04, 0xF0, 0x20, 0xC0,
+0x60, 0x2E, 0xF1, 0x60, 0x24, 0xF0, 0xA0, 0x10, 0xE0, 0x02, 0x51, 0x40, 0xB0, 0x50, 0x91, 0xB0,
+0x02, 0x51, 0x07, 0x90, 0x07, 0x50, 0x07, 0x50, 0xB0, 0x70, 0xB0, 0x05, 0x40, 0x09, 0x90, 0x40,
+0x80, 0xB0, 0x08, 0x51, 0x30, 0xE0, 0x04, 0x70, 0x50, 0x06, 0xB0, 0x40, 0x00, 0x50, 0x30, 0x0F,
+0x05, 0x40, 0x00, 0x30, 0x90, 0xB0, 0x04, 0x90, 0x10, 0xF0, 0x25, 0xF0, 0x80, 0x40, 0x00, 0xB0,
+0x90, 0x50, 0x04, 0x70, 0xC0, 0xF0, 0x28, 0xF3, 0xC0, 0x80, 0xA0, 0x40, 0xB0, 0x01, 0x50, 0x41,
+0xB0, 0x0F, 0x16, 0xA0, 0xF1, 0x24, 0xC0, 0x61, 0xC0, 0x70, 0x90, 0x01, 0xA0, 0x0F, 0x00, 0x0F,
+0x00, 0x30, 0x02, 0xA0, 0xF1, 0x20, 0xC1, 0x61, 0xC0, 0xF2, 0x2F, 0x17, 0xF1, 0x60, 0xF0, 0xC0,
+0x61, 0x20, 0xF1, 0x2F, 0x07, 0xF0, 0x20, 0x61, 0xC0, 0xF0, 0x2D, 0xF1, 0x20, 0x60, 0x80, 0xF1,
+0x2F, 0x07, 0xC0, 0x60, 0x21, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0x23, 0xF0, 0x80, 0x10, 0x40, 0x03,
+0x40, 0x09, 0x40, 0x07, 0x50, 0xB0, 0x01, 0xB0, 0x50, 0x92, 0xE0, 0x40, 0x91, 0x51, 0xB0, 0x01,
+0x90, 0xB0, 0xE0, 0x06, 0x90, 0x08, 0xB0, 0x31, 0xB0, 0x08, 0xB0, 0x40, 0x01, 0x70, 0xA0, 0x50,
+0xB0, 0x50, 0x80, 0x70, 0xB0, 0x05, 0x50, 0x40, 0x01, 0x40, 0x90, 0x0F, 0x05, 0x90, 0x40, 0x30,
+0x06, 0xB0, 0x30, 0xF0, 0x25, 0xF0, 0x70, 0xE0, 0x81, 0x40, 0x03, 0xB0, 0xA0, 0x30, 0xF0, 0x2E,
+0xF1, 0x80, 0xA0, 0x40, 0x80, 0x50, 0x00, 0x90, 0x0F, 0x17, 0xA0, 0xF1, 0x21, 0x62, 0xC0, 0x21,
+0xF0, 0x30, 0x80, 0x01, 0x40, 0x90, 0x0E, 0x0F, 0x00, 0x10, 0x30, 0xE0, 0x00, 0x70, 0xF0, 0x22,
+0xF1, 0x20, 0xC0, 0x62, 0xC0, 0x20, 0xF1, 0x2F, 0x13, 0xF0, 0x60, 0xF1, 0x20, 0xF0, 0xC0, 0x61,
+0xC0, 0x20, 0xF0, 0x2F, 0x07, 0xF0, 0x20, 0x61, 0xC0, 0xF0, 0x2C, 0xF1, 0xC1, 0x60, 0xC0, 0xF0,
+0x2F, 0x08, 0x60, 0x20, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0x22, 0xF0, 0xA1, 0x04, 0x50, 0x90, 0x08,
+0x90, 0x05, 0x50, 0x90, 0x42, 0x90, 0x51, 0xB0, 0x01, 0x90, 0xB1, 0x00, 0xB0, 0x50, 0x92, 0x40,
+0xE1, 0xB0, 0x04, 0x90, 0xB0, 0x08, 0xE0, 0x30, 0x0A, 0xE0, 0x00, 0x30, 0xA0, 0x80, 0x00, 0x80,
+0x30, 0xE0, 0x50, 0x06, 0x91, 0x02, 0x80, 0xB0, 0x0F, 0x04, 0x40, 0x50, 0x90, 0xA0, 0x04, 0xB0,
+0x50, 0x10, 0xC0, 0xF0, 0x23, 0xF1, 0x61, 0xC1, 0x80, 0x30, 0xE0, 0x01, 0xB0, 0x70, 0xC0, 0xF0,
+0x2E, 0xF0, 0xC0, 0x61, 0xC1, 0x80, 0xA1, 0x30, 0x70, 0x80, 0xE0, 0x0F, 0x06, 0x70, 0x12, 0x09,
+0x80, 0xE0, 0x62, 0xC0, 0xF2, 0x21, 0xF1, 0xA0, 0x50, 0x80, 0xA0, 0x30, 0x0E, 0x0E, 0x50, 0xE0,
+0x00, 0x90, 0x70, 0x80, 0xF0, 0x29, 0xC0, 0x62, 0xC0, 0xF2, 0x2F, 0x10, 0x60, 0xF1, 0x22, 0xF0,
+0x20, 0xC0, 0x61, 0xC0, 0xF1, 0x20, 0xF0, 0x2F, 0x04, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xF0,
+0x27, 0xF0, 0x22, 0x60, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x07, 0x60, 0xC0, 0xF0, 0x2D, 0x60,
+0xC0, 0xF0, 0x21, 0xF0, 0x71, 0x30, 0x50, 0x02, 0x40, 0xB0, 0x07, 0x51, 0x00, 0xB0, 0x90, 0x40,
+0x90, 0x50, 0x09, 0x90, 0xB0, 0x07, 0x30, 0xB0, 0x50, 0x40, 0x90, 0x50, 0x01, 0x90, 0x08, 0x50,
+0xB0, 0xA0, 0xB0, 0x08, 0x40, 0x00, 0x50, 0xD0, 0x80, 0x0B, 0x40, 0x50, 0x03, 0xA0, 0x0F, 0x03,
+0x90, 0x40, 0x01, 0xB0, 0x30, 0x50, 0x03, 0xE0, 0x10, 0x30, 0xF0, 0x22, 0xF0, 0x20, 0x61, 0x20,
+0xF4, 0xA0, 0x01, 0x80, 0xC0, 0xF0, 0x2B, 0xF1, 0xC0, 0x62, 0x21, 0xF4, 0xC2, 0x30, 0xE0, 0x0F,
+0x05, 0x51, 0x08, 0x50, 0x92, 0x30, 0xF0, 0x28, 0xF0, 0x10, 0xE0, 0xB0, 0x00, 0xA0, 0x0E, 0x07,
+0xB1, 0x04, 0x80, 0xB0, 0x01, 0x30, 0xC0, 0x2A, 0xF2, 0xC1, 0x61, 0xC0, 0x2F, 0x10, 0x60, 0xF0,
+0x25, 0xF1, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x07, 0xF1, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x24, 0xF0,
+0x22, 0x60, 0xC0, 0x23, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x06, 0xC0, 0x60, 0x2E, 0x60, 0xC0, 0x23,
+0xF0, 0x60, 0xA0, 0xD0, 0x50, 0x01, 0x40, 0x07, 0xB0, 0xE0, 0x40, 0x50, 0xB0, 0x0C, 0x50, 0xB0,
+0x07, 0x30, 0x02, 0xB1, 0x91, 0x40, 0x08, 0xE0, 0x50, 0x30, 0xE0, 0x07, 0x90, 0xB0, 0x01, 0x30,
+0x50, 0x09, 0xB0, 0x40, 0xB0, 0x03, 0x50, 0xE0, 0x0F, 0x01, 0x50, 0x40, 0xB0, 0x03, 0xE1, 0x03,
+0xB0, 0xD0, 0xF2, 0x21, 0x61, 0xC0, 0xF0, 0x24, 0xF0, 0x70, 0x01, 0x70, 0xF0, 0x2A, 0xF0, 0x20,
+0xC0, 0x61, 0xC0, 0xF1, 0x26, 0xF0, 0x60, 0xF1, 0xA0, 0x90, 0x0F, 0x0B, 0xB0, 0x90, 0x40, 0x90,
+0xB0, 0x02, 0x70, 0xC0, 0x28, 0xF0, 0x70, 0xB0, 0x01, 0x80, 0xB0, 0x0D, 0x06, 0xB0, 0x30, 0x80,
+0xB0, 0x03, 0xA0, 0xB0, 0x01, 0xA0, 0xF0, 0x2F, 0x02, 0xC0, 0x62, 0xC0, 0xF3, 0x2F, 0x06, 0xF0,
+0x60, 0x2A, 0xF1, 0x20, 0xC0, 0x61, 0x20, 0xF0, 0x2F, 0x06, 0xF0, 0xC0, 0x61, 0x20, 0xF0, 0x26,
+0x60, 0xF0, 0x25, 0xC0, 0x60, 0xF1, 0x2F, 0x03, 0xF0, 0x20, 0xC0, 0x60, 0xF0, 0x2C, 0xF0, 0x60,
+0xF0, 0x24, 0xF0, 0x70, 0x10, 0xD0, 0x50, 0x90, 0xB0, 0x04, 0x50, 0x40, 0x90, 0xB0, 0x0F, 0x00,
+0x50, 0xB0, 0x07, 0x30, 0x01, 0x90, 0xD0, 0x80, 0xD0, 0x40, 0xB0, 0x91, 0x03, 0x50, 0x31, 0x40,
+0xE0, 0x70, 0xA0, 0x06, 0x90, 0x50, 0x02, 0xA0, 0x04, 0xB0, 0x03, 0xB0, 0x40, 0x05, 0xE0, 0x90,
+0x0E, 0xB0, 0x40, 0x50, 0x06, 0x70, 0x02, 0x40, 0x30, 0x70, 0x80, 0xF0, 0xC0, 0x61, 0x28, 0xF0,
+0x30, 0xA1, 0xC0, 0x27, 0xF2, 0xC0, 0x61, 0xC0, 0x20, 0xF1, 0x28, 0xF0, 0x60, 0x20, 0xF1, 0x70,
+0xB0, 0x0F, 0x07, 0x50, 0x40, 0x90, 0x50, 0xB0, 0x05, 0xE0, 0x80, 0xF0, 0x27, 0xF0, 0x81, 0x01,
+0x80, 0x90, 0x0D, 0x06, 0xB0, 0x30, 0x80, 0x50, 0x03, 0xA0, 0x80, 0x30, 0xA0, 0x30, 0xF0, 0x2F,
+0x03, 0xF2, 0xC0, 0x62, 0xC0, 0x2F, 0x07, 0x60, 0x2D, 0xF1, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2F,
+0x05, 0xF0, 0xC0, 0x61, 0x25, 0x60, 0xC0, 0xF0, 0x25, 0xF1, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0xC0,
+0x60, 0x2D, 0xF0, 0x60, 0x25, 0x70, 0xF0, 0x60, 0x70, 0x00, 0x40, 0x02, 0x90, 0x40, 0x50, 0x0F,
+0x03, 0x50, 0xB0, 0x07, 0xD0, 0xA0, 0x30, 0x70, 0x30, 0xE1, 0x11, 0x30, 0x50, 0xA1, 0x80, 0xE0,
+0xA0, 0xB0, 0x90, 0x01, 0xB1, 0x05, 0x50, 0x90, 0x03, 0xA0, 0xB0, 0x02, 0x50, 0x10, 0x50, 0x01,
+0x50, 0x40, 0x06, 0x70, 0x0E, 0x40, 0x90, 0x08, 0x40, 0x30, 0xB0, 0x31, 0x00, 0x50, 0x30, 0x61,
+0xF1, 0x28, 0xF4, 0x26, 0xF0, 0xC0, 0x61, 0xC0, 0x2E, 0xF0, 0xC1, 0x20, 0xF1, 0x70, 0x02, 0x40,
+0x70, 0x90, 0x0C, 0x50, 0x41, 0x90, 0xB0, 0x03, 0x70, 0xA0, 0xE0, 0x02, 0x80, 0x60, 0xF0, 0x27,
+0xF0, 0x60, 0x10, 0x31, 0x80, 0xE0, 0x0D, 0x07, 0xB1, 0x03, 0x50, 0x80, 0x01, 0x50, 0x80, 0x2F,
+0x09, 0xF0, 0x20, 0xC0, 0x61, 0xC1, 0x20, 0xF0, 0x2F, 0x01, 0x60, 0x2F, 0x03, 0xC0, 0x61, 0xC0,
+0xF1, 0x2F, 0x04, 0xF0, 0xC0, 0x61, 0xC0, 0xF2, 0x60, 0x29, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F,
+0x05, 0x60, 0x20, 0xF0, 0x2C, 0x60, 0x25, 0xF1, 0xA0, 0x10, 0xA0, 0x51, 0x40, 0xB0, 0x0F, 0x05,
+0x50, 0xB0, 0x04, 0xB0, 0xD0, 0xA0, 0x40, 0x06, 0xA0, 0x00, 0xD0, 0x80, 0x00, 0x90, 0x40, 0x00,
+0x40, 0x09, 0xB0, 0x40, 0x03, 0x70, 0xE0, 0x01, 0xB0, 0x30, 0x10, 0x90, 0x01, 0x91, 0x07, 0xA0,
+0x0C, 0x90, 0x40, 0x0B, 0xE2, 0x00, 0xB0, 0x90, 0x80, 0xF2, 0x2F, 0x04, 0xC0, 0x61, 0xC1, 0xF0,
+0x2F, 0x02, 0x60, 0xF0, 0x20, 0xF0, 0x80, 0x90, 0x00, 0x90, 0x70, 0xB0, 0x40, 0xA0, 0x30, 0x40,
+0x04, 0x50, 0xA0, 0x80, 0xA0, 0x80, 0xB0, 0x06, 0x40, 0xE0, 0x00, 0x30, 0x40, 0x01, 0x10, 0x70,
+0xF0, 0x28, 0xF0, 0x70, 0x02, 0xA0, 0x0D, 0x07, 0x50, 0x40, 0x90, 0xB0, 0x01, 0x40, 0x90, 0x01,
+0xE0, 0x60, 0xF0, 0x2F, 0x0B, 0xF1, 0xC0, 0x62, 0xC0, 0x2E, 0xC1, 0x2F, 0x03, 0xF2, 0xC0, 0x61,
+0xC0, 0x2F, 0x04, 0xF1, 0xC0, 0x61, 0x20, 0x60, 0x2C, 0xF0, 0xC0, 0x60, 0x2F, 0x06, 0x60, 0xC0,
+0xF0, 0x2B, 0xC0, 0x60, 0xF0, 0x24, 0xF0, 0xC0, 0x10, 0x50, 0xE0, 0x50, 0x0F, 0x07, 0x50, 0xB0,
+0x04, 0x90, 0x30, 0x07, 0x90, 0x70, 0x04, 0xB0, 0xE1, 0x30, 0x90, 0x07, 0x40, 0x02, 0xB0, 0xE0,
+0x70, 0x80, 0x01, 0x90, 0x30, 0x02, 0x90, 0x50, 0x06, 0xE0, 0x70, 0x50, 0x0A, 0x50, 0x40, 0xB0,
+0x0C, 0x40, 0x00, 0xB0, 0x30, 0xA0, 0x80, 0x30, 0xF0, 0x2F, 0x01, 0xF0, 0x21, 0xC0, 0x61, 0xC0,
+0xF1, 0x2F, 0x03, 0xF0, 0x60, 0x21, 0xF0, 0x30, 0xE0, 0xA0, 0x40, 0xB0, 0x01, 0xB1, 0xE0, 0x30,
+0x00, 0xB0, 0x50, 0x40, 0x90, 0xE0, 0x70, 0x50, 0x70, 0x07, 0xA0, 0x01, 0x80, 0xE0, 0x01, 0x70,
+0xC0, 0xF0, 0x28, 0xF0, 0xD0, 0x50, 0x01, 0x30, 0xB0, 0x0C, 0x06, 0x80, 0x70, 0x80, 0xA0, 0xD0,
+0xA0, 0x00, 0x80, 0x70, 0x80, 0x50, 0xA0, 0xF0, 0x2F, 0x10, 0xF0, 0x20, 0xC0, 0x62, 0xC0, 0x20,
+0xF2, 0x25, 0xF0, 0x60, 0xF0, 0x2F, 0x06, 0xF0, 0x21, 0xC0, 0x60, 0xC0, 0x20, 0xF1, 0x2F, 0x02,
+0xF0, 0x20, 0x61, 0xF0, 0x2C, 0xF0, 0x20, 0x61, 0xF1, 0x2F, 0x02, 0xF0, 0x61, 0xF0, 0x2A, 0xF0,
+0x60, 0xC0, 0xF0, 0x23, 0xF0, 0xC0, 0x70, 0x50, 0xB0, 0x90, 0x0F, 0x07, 0x50, 0xB0, 0x04, 0x70,
+0x08, 0x90, 0xA0, 0x30, 0x50, 0xA0, 0x01, 0xA0, 0xE0, 0x90, 0xE0, 0xA0, 0xB0, 0x05, 0x40, 0x01,
+0x80, 0xA1, 0xE0, 0x90, 0x40, 0x30, 0x04, 0x40, 0xB0, 0x03, 0x40, 0x80, 0xA1, 0xE0, 0x0A, 0xB0,
+0x40, 0x50, 0x0E, 0xB0, 0xE0, 0xB0, 0xA0, 0xD0, 0x60, 0xF1, 0x24, 0xF0, 0x23, 0xF0, 0x25, 0xC0,
+0x61, 0xC0, 0x2F, 0x09, 0xC1, 0xF1, 0x70, 0x40, 0x06, 0xB0, 0x80, 0xE0, 0x50, 0xB0, 0x02, 0x50,
+0xA0, 0x50, 0x06, 0x41, 0x02, 0xA0, 0x50, 0x00, 0x30, 0x60, 0xF0, 0x28, 0xF0, 0x30, 0xE0, 0x40,
+0x30, 0xD0, 0x50, 0x0C, 0x06, 0x70, 0x03, 0x40, 0x31, 0x00, 0xB0, 0xE0, 0x70, 0xF1, 0x2F, 0x12,
+0xF1, 0x20, 0xC0, 0x62, 0xC0, 0x20, 0xF0, 0x22, 0xF0, 0x20, 0x60, 0xF0, 0x2F, 0x0A, 0xF0, 0xC0,
+0x61, 0xC0, 0x2F, 0x03, 0xF0, 0xC1, 0xF0, 0x2E, 0xF0, 0xC0, 0x61, 0xF1, 0x2F, 0x01, 0xF0, 0xC0,
+0x60, 0x2B, 0xF0, 0x60, 0xC0, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0x30, 0x90, 0x00, 0x40, 0xB0, 0x0F,
+0x06, 0x50, 0xB0, 0x03, 0x70, 0xB0, 0x0A, 0x50, 0x80, 0xA0, 0x30, 0xA0, 0xE0, 0xB0, 0x01, 0x90,
+0x31, 0x80, 0xE1, 0x41, 0xB0, 0x00, 0xD0, 0x50, 0x04, 0x40, 0x70, 0xB0, 0x00, 0xB0, 0x40, 0x04,
+0x30, 0xE0, 0x00, 0xB0, 0x30, 0xE0, 0x09, 0x40, 0x90, 0x0F, 0x02, 0x90, 0x00, 0xA0, 0x70, 0xF0,
+0x2F, 0x01, 0x61, 0xC0, 0x20, 0xF1, 0x2F, 0x09, 0xC0, 0x60, 0xF0, 0x81, 0x03, 0x50, 0x41, 0x90,
+0xB1, 0x80, 0x0E, 0x30, 0x03, 0xD0, 0x90, 0x01, 0x70, 0xF0, 0x28, 0xF0, 0x60, 0x10, 0x90, 0x00,
+0x90, 0x40, 0x0C, 0x06, 0xA0, 0xE0, 0xB0, 0x01, 0xB0, 0x70, 0xE0, 0x01, 0xB0, 0x30, 0xF0, 0x2F,
+0x1A, 0xC0, 0x62, 0xC0, 0xF1, 0xC1, 0x2F, 0x0D, 0xF1, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2E, 0x60,
+0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0xC0, 0x60, 0x2B, 0xF0, 0x60, 0xC0, 0xF1,
+0x61, 0xF1, 0x70, 0x01, 0x40, 0x0F, 0x06, 0x50, 0xB0, 0x02, 0xE1, 0x0C, 0x40, 0x10, 0x01, 0x90,
+0x04, 0x40, 0x90, 0x50, 0xE0, 0x70, 0x40, 0x31, 0xB0, 0x06, 0xB0, 0xA0, 0xE0, 0x90, 0x03, 0x80,
+0x70, 0x50, 0x03, 0x40, 0x80, 0x06, 0x90, 0x40, 0x0F, 0x04, 0x51, 0x80, 0xC0, 0xF0, 0x2B, 0xF0,
+0xC0, 0x62, 0x22, 0xF0, 0x2F, 0x0B, 0xF0, 0x60, 0xC0, 0xA0, 0x00, 0x50, 0x90, 0x40, 0x90, 0x50,
+0x04, 0x70, 0x01, 0x50, 0xE0, 0x09, 0x90, 0x80, 0x03, 0xB0, 0x40, 0x30, 0xA0, 0x70, 0x80, 0xF0,
+0x28, 0xC0, 0xD0, 0x01, 0x50, 0xE0, 0x00, 0x40, 0x90, 0x00, 0x30, 0x80, 0x06, 0x07, 0x30, 0xD0,
+0x70, 0xA0, 0x70, 0xE0, 0x30, 0xB0, 0x00, 0x90, 0x80, 0xF0, 0x2F, 0x1B, 0xF0, 0x20, 0xC0, 0x63,
+0xC0, 0x24, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x29, 0xF0, 0xC1, 0x2F,
+0x04, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2F, 0x02, 0x60, 0x20, 0xF0, 0x2A, 0x60, 0xC0, 0x60, 0xC0,
+0x21, 0xF0, 0x60, 0xA0, 0x91, 0xB0, 0x0F, 0x05, 0x50, 0xB0, 0x01, 0x50, 0x30, 0xE0, 0x40, 0x04,
+0x50, 0xB0, 0x01, 0xA0, 0x51, 0xD0, 0x50, 0x00, 0x40, 0x06, 0x90, 0x50, 0xA0, 0x40, 0x0B, 0x50,
+0x80, 0xA0, 0x40, 0x50, 0x90, 0xA0, 0x40, 0x06, 0xA0, 0x04, 0x50, 0x40, 0x50, 0x0F, 0x06, 0x90,
+0xA0, 0xF0, 0x2B, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x0B, 0xF0, 0x21, 0xF2, 0x60, 0x30, 0xE0, 0x90,
+0x50, 0xB0, 0x07, 0x50, 0xA0, 0x80, 0x30, 0x50, 0x70, 0xA0, 0xB0, 0x06, 0x30, 0x07, 0xB0, 0x00,
+0xA0, 0xC0, 0xF0, 0x22, 0xF2, 0x21, 0xF0, 0x70, 0x00, 0xB0, 0x90, 0xA0, 0x30, 0xA1, 0xD0, 0x40,
+0x81, 0x05, 0x09, 0xB0, 0x50, 0x00, 0x90, 0x80, 0xE0, 0x30, 0x70, 0x60, 0x2F, 0x20, 0xF1, 0x63,
+0xC0, 0xF2, 0x2F, 0x0D, 0xF0, 0x20, 0x61, 0xC1, 0xF0, 0x28, 0x60, 0xF0, 0x2F, 0x06, 0xF0, 0xC0,
+0x60, 0xC0, 0xF0, 0x2F, 0x00, 0xF0, 0x20, 0x60, 0xC0, 0xF0, 0x28, 0xF0, 0xC0, 0x60, 0x20, 0xF0,
+0x22, 0xF0, 0x70, 0x10, 0x90, 0x40, 0x0F, 0x05, 0x50, 0xB0, 0x01, 0x50, 0x12, 0x50, 0x02, 0xB0,
+0xD0, 0x30, 0x00, 0xB0, 0x31, 0x80, 0xD0, 0x00, 0xB0, 0x90, 0x07, 0x50, 0x80, 0x30, 0x0A, 0x90,
+0x50, 0x01, 0x40, 0xE0, 0x40, 0xB0, 0x07, 0xB0, 0xA0, 0x80, 0x50, 0x00, 0x40, 0x50, 0x0F, 0x08,
+0xB0, 0x30, 0x60, 0xF0, 0x25, 0xF1, 0xC0, 0x61, 0xC0, 0x2F, 0x0F, 0xF2, 0xC0, 0x60, 0x40, 0xA0,
+0x90, 0x0C, 0xB1, 0x01, 0xA0, 0x90, 0xA0, 0x90, 0x04, 0x50, 0xA0, 0x09, 0x50, 0x70, 0xF3, 0x80,
+0xA0, 0x60, 0xF2, 0x70, 0xA0, 0x80, 0x40, 0x70, 0xA0, 0x01, 0x70, 0x00, 0xB0, 0xA0, 0x05, 0x05,
+0x90, 0x11, 0x80, 0x70, 0x10, 0x50, 0x80, 0xB0, 0x01, 0x30, 0xC0, 0x2F, 0x21, 0xF0, 0x60, 0xF2,
+0xC0, 0x62, 0xC0, 0x2F, 0x0E, 0xF1, 0xC0, 0x61, 0xC0, 0x20, 0xF1, 0x24, 0x60, 0xF1, 0x2F, 0x07,
+0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x00, 0xF0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0xF1,
+0x24, 0xC0, 0x70, 0x90, 0x51, 0x0F, 0x04, 0x50, 0xB0, 0x01, 0xA0, 0x10, 0x00, 0xE0, 0xB0, 0x02,
+0x80, 0x90, 0x30, 0xE0, 0x80, 0x90, 0x03, 0x40, 0x09, 0xB0, 0x80, 0x09, 0x40, 0xB0, 0x0F, 0x01,
+0x50, 0xA0, 0x90, 0x0F, 0x05, 0xE0, 0x30, 0x92, 0x00, 0x40, 0x30, 0xF1, 0x23, 0xC0, 0x61, 0xC0,
+0x20, 0xF0, 0x2F, 0x0D, 0xF0, 0x20, 0xC0, 0x61, 0x32, 0x70, 0x40, 0x90, 0x0F, 0x01, 0x80, 0xB0,
+0x00, 0x80, 0x70, 0x30, 0xB0, 0x40, 0x31, 0x0B, 0x50, 0x70, 0x30, 0xA1, 0x90, 0x50, 0xA0, 0x70,
+0x81, 0x70, 0xE0, 0x01, 0xE0, 0xD0, 0x00, 0xB0, 0xD0, 0x70, 0x10, 0x90, 0x05, 0x05, 0x30, 0xB0,
+0x00, 0xD0, 0xB0, 0x00, 0x70, 0xA0, 0x50, 0x01, 0xA0, 0xF0, 0x2F, 0x21, 0xC1, 0xF0, 0x22, 0xF1,
+0x20, 0xC0, 0x61, 0xC1, 0xF1, 0x2F, 0x0D, 0xC0, 0x61, 0xC0, 0xF1, 0x20, 0xF0, 0x60, 0x20, 0xF0,
+0x2F, 0x09, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0xF0, 0x2E, 0xF0, 0xC0, 0x60, 0xF0, 0x24, 0xF0, 0xC0,
+0x60, 0x26, 0xF0, 0x60, 0x10, 0x90, 0x00, 0x40, 0x0F, 0x04, 0x50, 0xB0, 0x04, 0x50, 0xA0, 0x90,
+0x32, 0x01, 0x30, 0x10, 0x03, 0x50, 0xB0, 0x50, 0x07, 0x80, 0xA0, 0x70, 0x80, 0x06, 0xB0, 0x40,
+0x0F, 0x02, 0x91, 0x70, 0xB0, 0x01, 0xB0, 0x50, 0x0E, 0x40, 0xA0, 0x50, 0xB0, 0x41, 0x31, 0x80,
+0xA0, 0xF2, 0x20, 0x62, 0x2F, 0x03, 0xF2, 0x22, 0xF0, 0x22, 0xF1, 0x20, 0xC0, 0x62, 0xC0, 0x60,
+0xA0, 0xE0, 0x90, 0xB0, 0x01, 0x40, 0x0F, 0x00, 0x80, 0x30, 0x03, 0x50, 0x80, 0x40, 0x0F, 0x00,
+0xB1, 0x04, 0x50, 0x90, 0x81, 0x00, 0xB0, 0x40, 0x30, 0xD0, 0x70, 0x90, 0x51, 0x06, 0x05, 0x30,
+0x80, 0xE0, 0x70, 0x01, 0xA0, 0x12, 0xD0, 0xA0, 0xF0, 0x20, 0xF0, 0x2F, 0x1E, 0xF0, 0x60, 0x2A,
+0xC0, 0x62, 0xC0, 0x21, 0xF0, 0x2F, 0x0A, 0xF1, 0xC0, 0x61, 0xC0, 0xF0, 0x60, 0xF0, 0x2F, 0x0D,
+0xF0, 0x61, 0x20, 0xF0, 0x2E, 0xC0, 0x60, 0xF1, 0x21, 0xF0, 0xC0, 0x60, 0xF0, 0x27, 0xF0, 0xD0,
+0xE0, 0x00, 0xB0, 0x90, 0x0F, 0x03, 0x50, 0xB0, 0x04, 0x50, 0xA0, 0xE0, 0x51, 0x03, 0x90, 0x02,
+0xB0, 0x90, 0x50, 0x70, 0x04, 0xB0, 0x50, 0xA0, 0x30, 0x90, 0x70, 0xE0, 0x90, 0x04, 0x50, 0x40,
+0x0F, 0x01, 0xB0, 0x40, 0xB0, 0x00, 0x40, 0x70, 0xE1, 0x30, 0x70, 0x40, 0x0C, 0xA0, 0x40, 0x07,
+0x30, 0xC1, 0x61, 0xC0, 0xF1, 0x2F, 0x01, 0xF1, 0x60, 0x10, 0x60, 0xF1, 0x60, 0xC0, 0xF0, 0xC0,
+0xF0, 0xC0, 0x61, 0xC0, 0xF2, 0xE0, 0xA0, 0xB0, 0x04, 0x90, 0x0F, 0x00, 0x40, 0x80, 0x0F, 0x10,
+0xB0, 0x10, 0xD0, 0x11, 0xE0, 0xB0, 0xA0, 0x71, 0xA0, 0x70, 0x50, 0x04, 0x06, 0x80, 0xE0, 0x30,
+0xA0, 0x30, 0x70, 0x80, 0xE0, 0xA0, 0x10, 0x80, 0xC0, 0x61, 0xC1, 0xF4, 0x2F, 0x18, 0x60, 0xF0,
+0x2D, 0xC0, 0x62, 0xC0, 0x20, 0xF1, 0x2F, 0x08, 0xF1, 0x20, 0xC0, 0x61, 0xF1, 0x2F, 0x0E, 0xC0,
+0x60, 0xC0, 0xF0, 0x2D, 0xF0, 0x20, 0x60, 0xC0, 0xF1, 0xC0, 0x60, 0xF0, 0x27, 0xF1, 0x30, 0x10,
+0x01, 0x90, 0xB0, 0x0F, 0x02, 0x50, 0xB0, 0x04, 0x50, 0x30, 0x0A, 0x90, 0xB0, 0x70, 0xA0, 0x04,
+0x70, 0xD0, 0xC0, 0xF0, 0xC0, 0xA0, 0x00, 0xB0, 0x80, 0x30, 0x01, 0x50, 0x90, 0x0F, 0x01, 0x40,
+0x90, 0x04, 0xB0, 0x80, 0x90, 0xA0, 0x0C, 0x80, 0x90, 0x06, 0xB0, 0x30, 0x80, 0x60, 0xC0, 0x20,
+0xF0, 0x2F, 0x01, 0xF1, 0xC1, 0x30, 0x70, 0x50, 0x70, 0x60, 0x80, 0xD0, 0xA0, 0x61, 0xA1, 0xC1,
+0x81, 0x30, 0x70, 0x30, 0x06, 0x51, 0x0F, 0x00, 0xE0, 0x40, 0x0F, 0x0B, 0x50, 0x90, 0x40, 0x91,
+0x10, 0x70, 0x80, 0x40, 0x80, 0x70, 0x40, 0x02, 0x90, 0x30, 0x04, 0x05, 0x30, 0xD0, 0x50, 0x00,
+0x41, 0x91, 0x01, 0xE0, 0x60, 0xF2, 0xC1, 0x63, 0xC1, 0x2F, 0x17, 0x60, 0xF0, 0x2E, 0xF0, 0x21,
+0x63, 0xC0, 0x2F, 0x0A, 0xF0, 0x60, 0xC0, 0x62, 0x2F, 0x0E, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2C,
+0xF1, 0x60, 0xC1, 0x60, 0xF1, 0x28, 0xF0, 0xA0, 0x80, 0x30, 0x01, 0x40, 0x0F, 0x02, 0x50, 0xB0,
+0x05, 0xE0, 0x40, 0x08, 0xB0, 0x90, 0x00, 0x50, 0xB0, 0x03, 0x50, 0xA0, 0x50, 0xF0, 0x20, 0xF0,
+0x70, 0x90, 0x00, 0xD0, 0xA0, 0x10, 0x90, 0x50, 0x0F, 0x00, 0x90, 0x40, 0x0A, 0x10, 0xE0, 0x09,
+0xE0, 0x30, 0x05, 0xB0, 0x90, 0x80, 0xE0, 0x60, 0xF0, 0x2F, 0x01, 0xF1, 0xC0, 0x30, 0x70, 0x30,
+0x80, 0x50, 0x01, 0x90, 0xA0, 0xE0, 0x51, 0xA0, 0x10, 0x51, 0x30, 0x80, 0xE0, 0x90, 0x50, 0x09,
+0x40, 0x0D, 0x90, 0x01, 0xA0, 0x90, 0x0F, 0x04, 0x50, 0x90, 0x40, 0x92, 0x50, 0xB0, 0x02, 0x70,
+0x02, 0x30, 0xA0, 0x03, 0x81, 0x04, 0x04, 0x81, 0x00, 0xD0, 0x90, 0x00, 0x30, 0xA0, 0x40, 0xB0,
+0x00, 0x80, 0xC0, 0xF0, 0x27, 0xC0, 0x64, 0xC1, 0xF3, 0x2F, 0x0C, 0xC1, 0x2F, 0x07, 0x63, 0xC0,
+0x20, 0xF1, 0x2F, 0x04, 0x60, 0xF0, 0x20, 0xF0, 0xC0, 0x61, 0xC0, 0xF1, 0x2F, 0x0A, 0xF1, 0xC0,
+0x60, 0x2E, 0xF0, 0x61, 0x2A, 0xF0, 0xC0, 0x80, 0x00, 0x70, 0x01, 0x51, 0x0F, 0x01, 0x50, 0xB0,
+0x05, 0x40, 0x80, 0x08, 0x40, 0x08, 0x81, 0xF0, 0x20, 0xF0, 0xC0, 0xA0, 0x70, 0x10, 0xA0, 0x30,
+0x90, 0x0E, 0x50, 0x40, 0xB0, 0x0A, 0xE0, 0x50, 0x70, 0x50, 0xE0, 0x41, 0x90, 0xE0, 0xA1, 0x30,
+0xA0, 0xE0, 0x03, 0xB0, 0x90, 0x40, 0x50, 0x00, 0xA0, 0xF1, 0x60, 0xF0, 0x2F, 0x00, 0xF0, 0x60,
+0xA0, 0x50, 0x01, 0xB0, 0x50, 0x41, 0x50, 0x0F, 0x07, 0x40, 0x0C, 0x70, 0x10, 0x02, 0x70, 0x02,
+0x80, 0xD0, 0xE0, 0x07, 0xB0, 0x50, 0x91, 0x41, 0x50, 0xB0, 0x08, 0x30, 0xB0, 0x00, 0xB0, 0x70,
+0x30, 0xA0, 0x80, 0x70, 0x10, 0x30, 0x05, 0x04, 0x30, 0x50, 0x00, 0xB0, 0x70, 0x00, 0xA0, 0x80,
+0xE0, 0x80, 0x30, 0x70, 0xF1, 0x28, 0xF3, 0xC1, 0x63, 0xC1, 0x21, 0xF0, 0x2F, 0x07, 0xF0, 0x60,
+0xC0, 0x2F, 0x07, 0xF1, 0x20, 0xC0, 0x62, 0xC0, 0x20, 0xF1, 0x2F, 0x00, 0xC1, 0x23, 0xF0, 0x20,
+0xC0, 0x61, 0xC0, 0x2F, 0x0B, 0xF0, 0x20, 0x60, 0xC0, 0x21, 0xF1, 0x29, 0x60, 0xF0, 0x2A, 0xF0,
+0x60, 0x40, 0x00, 0x10, 0x02, 0x40, 0x0F, 0x01, 0x50, 0xB0, 0x04, 0xD0, 0xE0, 0x08, 0x51, 0x09,
+0xD0, 0xF0, 0x21, 0xF0, 0x80, 0x70, 0xE0, 0xD0, 0x70, 0x40, 0x0C, 0xB0, 0x40, 0x50, 0x0C, 0xA0,
+0x00, 0xE0, 0x30, 0x90, 0x50, 0x90, 0x40, 0x90, 0x06, 0x50, 0x40, 0x90, 0xB0, 0x02, 0x80, 0xC0,
+0xF0, 0x60, 0xF1, 0x2B, 0xF2, 0x80, 0x30, 0xB0, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x0F, 0x0A, 0x90,
+0x0B, 0x40, 0x10, 0x50, 0x02, 0x40, 0x70, 0x01, 0xA0, 0x30, 0xA0, 0x01, 0xB0, 0x51, 0x90, 0x40,
+0x90, 0x50, 0xB0, 0x0E, 0xE0, 0xD0, 0x30, 0xE0, 0xA0, 0xB0, 0x90, 0x40, 0x90, 0x01, 0xB0, 0x04,
+0x04, 0x40, 0x70, 0xB0, 0x00, 0x80, 0x30, 0xA0, 0x80, 0x02, 0xA0, 0xF0, 0x2F, 0x00, 0xF0, 0x22,
+0xC1, 0x63, 0xC1, 0xF0, 0x20, 0xF0, 0x2F, 0x00, 0xF1, 0x60, 0x2F, 0x0F, 0xC0, 0x61, 0xC1, 0xF3,
+0x29, 0xF0, 0x60, 0x26, 0xF0, 0x21, 0xC0, 0x61, 0x20, 0xF1, 0x2F, 0x09, 0xC0, 0x60, 0xC0, 0xF1,
+0x27, 0xF0, 0x60, 0xC0, 0xF0, 0x2A, 0xF0, 0x80, 0xE0, 0x00, 0xB0, 0x02, 0x51, 0x0F, 0x00, 0x50,
+0xB0, 0x04, 0x30, 0x90, 0x08, 0x40, 0x09, 0x80, 0x60, 0xF0, 0x22, 0xF1, 0xC0, 0x10, 0x80, 0x70,
+0x90, 0x0A, 0x40, 0x90, 0x0E, 0x41, 0x0A, 0xB0, 0x40, 0x90, 0x50, 0x05, 0x80, 0x60, 0xF0, 0xC1,
+0xF0, 0x29, 0xF3, 0x31, 0x90, 0x50, 0xB0, 0x0F, 0x0E, 0x50, 0xB0, 0x09, 0x31, 0x70, 0xA0, 0x03,
+0x80, 0x50, 0x00, 0x50, 0xA0, 0x80, 0xE0, 0xA0, 0x51, 0xB0, 0x0F, 0x04, 0x90, 0x30, 0x01, 0x40,
+0x90, 0x03, 0x80, 0xE0, 0x40, 0x03, 0x05, 0x50, 0x02, 0x70, 0xA0, 0x80, 0x02, 0x70, 0xF0, 0x2F,
+0x06, 0xF2, 0xC1, 0x64, 0xC0, 0x2E, 0xF0, 0x60, 0xF0, 0x2F, 0x0E, 0xF2, 0xC1, 0x62, 0xC0, 0xF0,
+0x29, 0x60, 0x2A, 0xF0, 0xC0, 0x61, 0xC0, 0x2F, 0x09, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x26, 0xC1,
+0xF0, 0x2B, 0xF0, 0x31, 0x05, 0x40, 0x0F, 0x00, 0x90, 0xB0, 0x05, 0xA0, 0x50, 0x06, 0x90, 0x50,
+0x09, 0xE0, 0x60, 0xF0, 0x24, 0xF0, 0x60, 0xF0, 0x80, 0xA1, 0x07, 0x90, 0x40, 0x0F, 0x02, 0x70,
+0x40, 0x06, 0xB0, 0x90, 0x40, 0x50, 0x07, 0xB0, 0xA0, 0xF1, 0xC1, 0xF0, 0x27, 0xF0, 0x20, 0xC0,
+0x60, 0xC0, 0x30, 0x40, 0x0F, 0x12, 0x51, 0x08, 0xE0, 0x80, 0x50, 0x90, 0xD0, 0xB1, 0x50, 0x90,
+0x80, 0x90, 0x51, 0x90, 0xA0, 0x90, 0x30, 0x80, 0x0F, 0x07, 0xA0, 0x01, 0xB0, 0x80, 0x03, 0x30,
+0x90, 0x80, 0x03, 0x0B, 0xD0, 0x80, 0xE1, 0x30, 0xF0, 0x2F, 0x0E, 0xF0, 0x20, 0xC0, 0x64, 0xC0,
+0x20, 0xF2, 0x24, 0xC0, 0x60, 0xF0, 0x2F, 0x13, 0xF0, 0x20, 0xC0, 0x62, 0xC1, 0xF2, 0x22, 0xC1,
+0x2C, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2F, 0x05, 0xF2, 0xC0, 0x60, 0xC0, 0xF0, 0x24,
+0x60, 0x2D, 0xF0, 0x30, 0xB0, 0x05, 0xB0, 0x90, 0x0E, 0x50, 0xB0, 0x05, 0xA0, 0x06, 0x50, 0x90,
+0x0A, 0x50, 0xA0, 0xF0, 0x26, 0xF0, 0x80, 0xD0, 0x90, 0x05, 0x50, 0x40, 0xB0, 0x0F, 0x04, 0x40,
+0xA0, 0x02, 0xB0, 0x50, 0x40, 0x90, 0x0A, 0xE0, 0xD0, 0xC0, 0xF1, 0x60, 0xF0, 0x23, 0xF1, 0xC0,
+0x62, 0xC0, 0xF0, 0x81, 0x0F, 0x14, 0x90, 0x08, 0xE0, 0xD0, 0x70, 0x30, 0xE0, 0x90, 0x50, 0xB0,
+0x00, 0x90, 0xA1, 0x01, 0x40, 0x30, 0x50, 0xA0, 0x0F, 0x07, 0x10, 0xE0, 0x80, 0x31, 0x03, 0xB0,
+0x40, 0x04, 0x0A, 0xB0, 0x80, 0x00, 0xB0, 0x80, 0x60, 0x2F, 0x11, 0xF3, 0x20, 0xC1, 0x63, 0xC1,
+0x22, 0xC1, 0xF0, 0x2F, 0x16, 0xF1, 0x20, 0xC0, 0x62, 0xC0, 0x21, 0xF0, 0x60, 0xC0, 0x2F, 0x00,
+0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x2D, 0xF0, 0x22, 0xF1, 0x80, 0xD0, 0xA0, 0x80, 0xF0, 0xC0, 0x60,
+0xF3, 0x60, 0xC0, 0x2D, 0xF0, 0xA0, 0x07, 0x90, 0xB0, 0x0D, 0x90, 0xB0, 0x05, 0xA0, 0x04, 0x50,
+0xA0, 0x31, 0x40, 0x0A, 0xA0, 0xC0, 0xF1, 0x25, 0x80, 0x10, 0xD0, 0x50, 0x02, 0xB0, 0x40, 0x50,
+0x0F, 0x07, 0x30, 0x51, 0x40, 0x90, 0xB0, 0x0D, 0x50, 0xA0, 0xC0, 0xF0, 0xC1, 0xF0, 0x21, 0xC0,
+0x61, 0xC1, 0x20, 0xF1, 0x60, 0xA0, 0x0F, 0x15, 0x40, 0x02, 0xB0, 0x51, 0x90, 0x40, 0x91, 0xB0,
+0x08, 0x90, 0x30, 0x01, 0x31, 0x80, 0x0F, 0x07, 0x10, 0x90, 0xB0, 0x00, 0xA0, 0x0A, 0x0A, 0x40,
+0x90, 0x01, 0x80, 0xC0, 0x2F, 0x1C, 0xC1, 0x63, 0xC0, 0xF4, 0x2F, 0x16, 0xF1, 0x20, 0xC0, 0x61,
+0xC0, 0x60, 0xF0, 0x2F, 0x05, 0x62, 0x20, 0xF0, 0x2A, 0xF1, 0xC0, 0xF0, 0xA0, 0x30, 0xB0, 0x00,
+0x80, 0x30, 0xE1, 0x60, 0xC3, 0xF0, 0x2D, 0xC0, 0x30, 0x08, 0x40, 0x0D, 0x90, 0xB0, 0x05, 0x40,
+0xA0, 0x90, 0xE0, 0x01, 0x70, 0xC0, 0x60, 0xC0, 0x30, 0xA0, 0x50, 0x08, 0x40, 0x70, 0x30, 0xC0,
+0xF0, 0x24, 0xF0, 0x60, 0x10, 0x80, 0x30, 0x00, 0x91, 0x0F, 0x08, 0x90, 0x30, 0x90, 0x50, 0x0F,
+0x00, 0x90, 0x00, 0x90, 0xD0, 0xF0, 0xC0, 0x63, 0xC0, 0x20, 0xF0, 0x23, 0xF0, 0x70, 0x0F, 0x16,
+0x43, 0x90, 0x50, 0xB1, 0x0D, 0x40, 0xA0, 0x01, 0x40, 0xB0, 0x0F, 0x07, 0x70, 0xB0, 0x01, 0x30,
+0x0A, 0x0A, 0x80, 0x50, 0x01, 0xA0, 0xF0, 0x2F, 0x1D, 0xF0, 0x20, 0xF1, 0x60, 0xC0, 0x63, 0xC1,
+0x2F, 0x19, 0xF1, 0xC1, 0xF0, 0x2F, 0x05, 0xF1, 0x20, 0x61, 0xC0, 0x20, 0xF0, 0x26, 0xF1, 0x70,
+0x30, 0xA0, 0x80, 0xB0, 0x02, 0x50, 0x40, 0xE0, 0x80, 0xE0, 0x30, 0xA1, 0xC0, 0xF6, 0x25, 0xF0,
+0x80, 0x90, 0x08, 0x51, 0x0C, 0x50, 0xB0, 0x07, 0x40, 0x70, 0x00, 0x30, 0xC0, 0x60, 0xF2, 0xC0,
+0x30, 0x70, 0x07, 0x40, 0x00, 0x50, 0x70, 0x60, 0xF0, 0x23, 0xF2, 0xC0, 0x30, 0xA0, 0x31, 0x40,
+0x0F, 0x04, 0xB0, 0x41, 0x80, 0x0F, 0x01, 0x50, 0xD0, 0xE0, 0xA0, 0x30, 0xA0, 0x60, 0xF0, 0x60,
+0xF3, 0x20, 0xF4, 0x80, 0xA0, 0x0F, 0x0F, 0xB0, 0x50, 0x90, 0x41, 0x92, 0x50, 0x0F, 0x02, 0x40,
+0xE0, 0x00, 0xD0, 0x30, 0x0F, 0x0A, 0x30, 0xB0, 0x01, 0x30, 0xB0, 0x09, 0x0A, 0x30, 0x80, 0xA0,
+0x30, 0xD0, 0xF0, 0x2F, 0x21, 0x60, 0xF0, 0x24, 0xC0, 0x63, 0xC1, 0xF4, 0x2F, 0x0F, 0xF0, 0xC1,
+0x2F, 0x09, 0xF1, 0xC0, 0x61, 0xC0, 0xF1, 0x23, 0xF0, 0xD0, 0xB0, 0x0B, 0x50, 0x90, 0x40, 0xA1,
+0x80, 0x61, 0x31, 0xC0, 0xF2, 0x22, 0xF0, 0xA0, 0x0A, 0x40, 0x0C, 0x90, 0xB0, 0x07, 0xE0, 0x31,
+0x80, 0xC1, 0x23, 0xF0, 0x60, 0xE0, 0x0A, 0x80, 0x70, 0xF0, 0x23, 0xF0, 0xC0, 0x62, 0xA0, 0x11,
+0x70, 0x90, 0x0F, 0x00, 0x90, 0x40, 0x90, 0x01, 0xA0, 0x0F, 0x00, 0x40, 0xA0, 0x04, 0x70, 0xE0,
+0x60, 0xF3, 0xC0, 0x60, 0xA1, 0x30, 0xA0, 0xE0, 0x0F, 0x0A, 0xB0, 0x51, 0x90, 0x41, 0x90, 0xB0,
+0x04, 0xB0, 0x50, 0x0E, 0xB0, 0x50, 0x81, 0x30, 0xD0, 0x00, 0x40, 0x80, 0x0F, 0x09, 0xE0, 0x70,
+0xA0, 0x30, 0x70, 0xB0, 0x09, 0x0A, 0xA0, 0x02, 0xA0, 0xF0, 0x2F, 0x21, 0x60, 0xF0, 0x23, 0xF4,
+0xC2, 0x63, 0xC1, 0x2F, 0x0E, 0xF0, 0x60, 0x2F, 0x0D, 0xF0, 0xC1, 0x61, 0xC0, 0x21, 0xF1, 0x30,
+0x90, 0x0A, 0xB0, 0x90, 0x01, 0x92, 0xE1, 0x91, 0x70, 0x30, 0xA1, 0x60, 0xF0, 0xC0, 0x60, 0x30,
+0x0A, 0xB0, 0x90, 0x07, 0x50, 0x02, 0x50, 0xB0, 0x06, 0x80, 0x70, 0x60, 0xC0, 0xF0, 0x60, 0x25,
+0xC0, 0x30, 0x0B, 0x90, 0x80, 0xF0, 0x22, 0x60, 0xC0, 0xF1, 0x60, 0x90, 0xD2, 0x10, 0x70, 0x50,
+0x0A, 0x50, 0x40, 0x90, 0xB0, 0x03, 0x30, 0x50, 0x0D, 0x40, 0xD0, 0xB0, 0x05, 0xE0, 0x80, 0xA1,
+0xD0, 0xA0, 0x30, 0xE0, 0x50, 0x0F, 0x08, 0xB1, 0x50, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x09, 0xB0,
+0x90, 0x0C, 0x90, 0xA0, 0x80, 0xE0, 0x90, 0x01, 0x40, 0x01, 0x40, 0x30, 0x0F, 0x08, 0x40, 0x80,
+0x01, 0xE0, 0x50, 0x09, 0x0A, 0x30, 0x02, 0xA0, 0xF0, 0x2F, 0x21, 0x60, 0xF0, 0x24, 0xF0, 0x21,
+0xF4, 0x21, 0xC1, 0x63, 0xC1, 0x20, 0xF3, 0x2F, 0x04, 0xF0, 0x60, 0x2F, 0x0F, 0xF0, 0x21, 0xC0,
+0x61, 0x20, 0xF0, 0x60, 0xD0, 0x50, 0x09, 0x90, 0xB0, 0x02, 0x50, 0x40, 0xB0, 0x03, 0x50, 0xB0,
+0x50, 0x30, 0xA0, 0x30, 0xD0, 0x90, 0x0B, 0x40, 0x06, 0x90, 0x10, 0xA0, 0x90, 0xA0, 0x80, 0x90,
+0x05, 0x30, 0x80, 0xF2, 0x60, 0xC0, 0xF0, 0x24, 0xF0, 0xA0, 0xB0, 0x0B, 0xA0, 0xC0, 0xF0, 0x61,
+0x20, 0xF0, 0x20, 0xF0, 0x60, 0xA0, 0xF0, 0x80, 0xD0, 0x12, 0xE0, 0x05, 0x90, 0x30, 0x41, 0xB0,
+0x06, 0x70, 0x50, 0x0D, 0xD0, 0x40, 0x70, 0x07, 0x50, 0xE0, 0x70, 0x0F, 0x08, 0x50, 0x90, 0x41,
+0x90, 0x51, 0xB0, 0x0F, 0x00, 0x90, 0x0B, 0xB0, 0xA0, 0x09, 0x80, 0xD0, 0xB0, 0x0F, 0x06, 0x90,
+0xA0, 0x01, 0x91, 0x09, 0x0A, 0x70, 0x30, 0xE1, 0x30, 0xF0, 0x2F, 0x1F, 0xF0, 0xC1, 0x23, 0x60,
+0x10, 0x60, 0xF0, 0x20, 0xF0, 0xA0, 0xC0, 0x24, 0xF3, 0x20, 0xC1, 0x64, 0x22, 0xF1, 0x2E, 0xF0,
+0x60, 0x2F, 0x12, 0xF1, 0xC0, 0x62, 0x10, 0xE0, 0x08, 0xB0, 0x90, 0x05, 0x90, 0xE0, 0x40, 0x08,
+0xD0, 0x50, 0x0A, 0xB0, 0x40, 0x04, 0x80, 0x70, 0xF0, 0xC0, 0x30, 0xD0, 0x30, 0x70, 0x50, 0x03,
+0x70, 0x60, 0xF0, 0x22, 0x60, 0xF0, 0x26, 0xC0, 0xA0, 0x0B, 0x50, 0x80, 0x60, 0xC0, 0xF0, 0x22,
+0xF1, 0xC0, 0xF0, 0xC1, 0xF0, 0x60, 0xA0, 0x80, 0x70, 0xE0, 0x02, 0x90, 0x80, 0x40, 0x90, 0x70,
+0x40, 0x07, 0x80, 0x70, 0x0C, 0x40, 0x50, 0xA0, 0xB0, 0x04, 0x30, 0xA0, 0x80, 0xA1, 0x31, 0x10,
+0x90, 0x0D, 0xB0, 0x90, 0x41, 0x91, 0x50, 0xB0, 0x0F, 0x06, 0x40, 0x09, 0x50, 0xD0, 0x30, 0x50,
+0x0B, 0xA0, 0x40, 0x50, 0xB0, 0xA1, 0x0F, 0x01, 0x50, 0x70, 0x40, 0x80, 0x70, 0x40, 0x09, 0x09,
+0xB0, 0x80, 0x00, 0x50, 0x40, 0xA0, 0xF0, 0x2F, 0x20, 0xC1, 0x23, 0xF0, 0x30, 0xD0, 0xC0, 0xF1,
+0x70, 0xD0, 0xF0, 0x2E, 0xC0, 0x64, 0xC1, 0xF4, 0x27, 0xC1, 0x2F, 0x16, 0xF1, 0x30, 0x80, 0xB0,
+0x07, 0x90, 0x08, 0x90, 0x40, 0x07, 0x90, 0x70, 0x30, 0x50, 0x09, 0x90, 0x50, 0x01, 0xB0, 0x70,
+0x60, 0xF4, 0xC0, 0xF0, 0xA0, 0x70, 0x80, 0xE0, 0xA1, 0xF1, 0x20, 0xF0, 0x60, 0x20, 0xF0, 0x22,
+0xC0, 0x21, 0xF1, 0x70, 0xB0, 0x09, 0x50, 0x40, 0xA0, 0xF1, 0x24, 0xF0, 0x60, 0x23, 0xF3, 0x80,
+0x70, 0xA0, 0xE0, 0x30, 0xA0, 0x02, 0xE1, 0x07, 0xB0, 0xA0, 0x03, 0x50, 0x30, 0x80, 0x51, 0x00,
+0x40, 0x31, 0x90, 0x80, 0x02, 0xB0, 0xA0, 0x70, 0xC0, 0xF0, 0x60, 0xF0, 0x40, 0xA0, 0x30, 0x09,
+0xB0, 0x50, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x0F, 0x0C, 0x40, 0x09, 0xA0, 0x50, 0x70, 0x0D, 0xE1,
+0x30, 0x80, 0x40, 0x0F, 0x02, 0x70, 0x50, 0xB1, 0x80, 0x09, 0x09, 0xB0, 0x80, 0x01, 0x50, 0x80,
+0xF0, 0x2F, 0x1F, 0xF0, 0x60, 0xC0, 0x24, 0xF0, 0x22, 0xF0, 0xC1, 0x2F, 0x01, 0xF3, 0x20, 0xC0,
+0x63, 0xC1, 0x21, 0xF0, 0x20, 0xF1, 0x20, 0xF0, 0x60, 0xC0, 0x2F, 0x17, 0xF0, 0xD0, 0x40, 0x90,
+0xE0, 0x90, 0xB0, 0x04, 0x40, 0x09, 0xB0, 0x40, 0x50, 0x07, 0xB0, 0x30, 0x80, 0xE0, 0x02, 0xE0,
+0xB0, 0x03, 0x40, 0x01, 0x90, 0x80, 0xF0, 0x23, 0xF0, 0x60, 0xC0, 0xF0, 0xC0, 0x81, 0xC0, 0xF0,
+0x21, 0xF0, 0xC1, 0xF0, 0x21, 0xF1, 0x70, 0x80, 0xF0, 0x20, 0x30, 0xA0, 0x70, 0x07, 0xB0, 0x40,
+0x50, 0x00, 0xE0, 0x30, 0xF0, 0x26, 0x60, 0xF0, 0x21, 0xF0, 0xC1, 0x60, 0xC0, 0xF0, 0x60, 0xA0,
+0x70, 0xD0, 0x03, 0x30, 0x08, 0xA0, 0x01, 0xB0, 0x81, 0x50, 0x90, 0x30, 0xE0, 0xA0, 0x40, 0xB0,
+0x00, 0x50, 0x80, 0x02, 0xE0, 0x60, 0x50, 0xF1, 0x60, 0xC0, 0x70, 0x90, 0x04, 0xB0, 0x50, 0x91,
+0x40, 0x90, 0x50, 0xB0, 0x0F, 0x12, 0x90, 0xB0, 0x06, 0x40, 0xA0, 0xB0, 0x90, 0x40, 0x0F, 0x01,
+0x80, 0x90, 0x0F, 0x02, 0x70, 0x02, 0x30, 0x09, 0x09, 0x50, 0x80, 0x01, 0x90, 0x80, 0xF3, 0x2F,
+0x1C, 0xF0, 0x60, 0x2B, 0xF0, 0x2F, 0x08, 0xF1, 0x20, 0xC2, 0x62, 0xC0, 0x20, 0xF1, 0x60, 0xF1,
+0x2F, 0x16, 0x60, 0xD0, 0x31, 0x80, 0x00, 0x50, 0x40, 0x50, 0x01, 0x51, 0x0B, 0x50, 0x40, 0xB0,
+0x07, 0x50, 0x40, 0xA0, 0x30, 0x70, 0xE0, 0x30, 0xA0, 0xB0, 0x01, 0x51, 0x00, 0x30, 0x60, 0xF0,
+0x24, 0x60, 0x21, 0xF3, 0x23, 0x60, 0x20, 0xF0, 0x20, 0xF1, 0x80, 0x10, 0x30, 0xF0, 0xC0, 0xD0,
+0x20, 0xC0, 0x70, 0x05, 0x90, 0x40, 0x03, 0x80, 0x30, 0xF0, 0x25, 0x60, 0xF1, 0xC0, 0x61, 0xC0,
+0x20, 0xF3, 0x70, 0xD0, 0x03, 0x30, 0x08, 0x30, 0x40, 0xA0, 0x30, 0x90, 0x04, 0xB0, 0x02, 0x41,
+0x02, 0xA0, 0x80, 0x70, 0x60, 0xC0, 0xE0, 0x80, 0x10, 0x30, 0xB0, 0x50, 0x90, 0x40, 0x90, 0x51,
+0xB0, 0x0F, 0x17, 0x51, 0x03, 0x50, 0x30, 0xA0, 0xE0, 0x01, 0xA0, 0x0F, 0x03, 0x30, 0x90, 0x0F,
+0x01, 0x70, 0xB0, 0x01, 0xA0, 0x09, 0x09, 0x50, 0x70, 0x31, 0x70, 0x80, 0x62, 0xC1, 0x2F, 0x1B,
+0xF0, 0x60, 0x2F, 0x1A, 0xF2, 0x20, 0xC0, 0x64, 0xC0, 0x20, 0xF1, 0x2F, 0x12, 0xF0, 0x60, 0x80,
+0x00, 0xE0, 0xA0, 0x30, 0x50, 0x00, 0xA0, 0x80, 0x90, 0xE0, 0x0E, 0x90, 0x40, 0x0D, 0xB0, 0x10,
+0xA0, 0x01, 0x40, 0x00, 0x40, 0x60, 0xF0, 0x24, 0xC1, 0x27, 0xC1, 0xF0, 0x21, 0xC0, 0x70, 0x40,
+0x00, 0x70, 0xF2, 0x20, 0xF0, 0x60, 0xD0, 0xB0, 0x01, 0x50, 0x40, 0xB0, 0x05, 0x40, 0x70, 0xF5,
+0xC0, 0x61, 0xC0, 0xF1, 0x25, 0xF0, 0x80, 0x70, 0x02, 0x30, 0x08, 0x70, 0xE0, 0x04, 0x90, 0x00,
+0xA0, 0x70, 0xA1, 0x70, 0xD0, 0x00, 0x80, 0x70, 0xA0, 0x80, 0x90, 0x70, 0x10, 0x70, 0xA0, 0xE0,
+0x90, 0x51, 0xB0, 0x0F, 0x01, 0x50, 0x0F, 0x0B, 0xB0, 0x50, 0x02, 0x50, 0xA0, 0x03, 0xB0, 0x30,
+0x0F, 0x03, 0xB0, 0x70, 0x0A, 0xB0, 0x51, 0x90, 0x40, 0x90, 0x70, 0xA0, 0x30, 0x80, 0xA0, 0x09,
+0x09, 0x40, 0x90, 0x01, 0x80, 0xC0, 0xF0, 0x21, 0xC1, 0x67, 0xC4, 0x20, 0xF4, 0x2F, 0x08, 0xF0,
+0x60, 0x2F, 0x22, 0x60, 0xF0, 0xC0, 0x63, 0xC2, 0xF1, 0x2F, 0x0D, 0x80, 0x30, 0x01, 0x50, 0xB0,
+0x30, 0xA0, 0x50, 0x40, 0xD0, 0x50, 0x0F, 0x01, 0x40, 0x90, 0x0C, 0x31, 0x70, 0x30, 0x81, 0xA0,
+0x70, 0xF0, 0x24, 0xC0, 0x28, 0x60, 0xF0, 0x21, 0xF0, 0x30, 0x50, 0x01, 0x30, 0xC0, 0xF0, 0x21,
+0xF1, 0x80, 0x31, 0x90, 0x50, 0x08, 0xB0, 0xA0, 0x30, 0x81, 0x30, 0xA0, 0x61, 0xF0, 0x22, 0xF0,
+0x25, 0xF0, 0xA0, 0x02, 0xA0, 0xB0, 0x04, 0x40, 0x31, 0x40, 0x04, 0x50, 0x70, 0x10, 0xE0, 0xF2,
+0x50, 0x80, 0xA0, 0x70, 0xD0, 0xA0, 0x30, 0x80, 0x40, 0x50, 0x01, 0x90, 0x0F, 0x04, 0x50, 0x10,
+0x90, 0x0F, 0x0A, 0xB0, 0x90, 0x01, 0xB0, 0x70, 0x03, 0x50, 0xA0, 0xB0, 0x0F, 0x03, 0xA0, 0x90,
+0xB0, 0x51, 0x92, 0x43, 0x90, 0x51, 0xB0, 0x02, 0xA0, 0x50, 0x01, 0x80, 0x09, 0x09, 0xE0, 0x50,
+0x01, 0x30, 0xC0, 0xF0, 0x23, 0xF6, 0xC4, 0x66, 0xC3, 0x2F, 0x04, 0xF0, 0x60, 0x2F, 0x22, 0x60,
+0xF4, 0x20, 0xC2, 0x62, 0xC1, 0x2F, 0x09, 0xF0, 0x60, 0x90, 0x07, 0x80, 0x40, 0x00, 0x70, 0x50,
+0x0E, 0xB0, 0x40, 0x50, 0x0E, 0x50, 0x40, 0xB0, 0xD0, 0xC0, 0x24, 0x60, 0x27, 0x60, 0xC0, 0x22,
+0xF0, 0x70, 0x50, 0x01, 0x80, 0xC0, 0x25, 0xC0, 0x80, 0x30, 0x0B, 0x50, 0xE0, 0x90, 0xB0, 0x50,
+0xA0, 0xC0, 0x29, 0xF0, 0xC0, 0x30, 0x02, 0xE0, 0x80, 0x03, 0x80, 0xE0, 0xB1, 0x03, 0x40, 0xA1,
+0x50, 0x10, 0x60, 0x21, 0xA0, 0x60, 0xC0, 0x80, 0xA0, 0x30, 0x06, 0x40, 0x0F, 0x04, 0xE0, 0x30,
+0xD0, 0x40, 0x0F, 0x0A, 0x90, 0x01, 0xA0, 0x04, 0xA0, 0x09, 0xB1, 0x52, 0x92, 0x41, 0x90, 0x30,
+0x51, 0xB2, 0x0C, 0x30, 0x90, 0x01, 0xE0, 0xB0, 0x08, 0x09, 0x81, 0x40, 0x50, 0xA0, 0xF0, 0x2F,
+0x08, 0xC3, 0x67, 0xC3, 0xF8, 0x60, 0xF0, 0x2D, 0xC1, 0xF0, 0x2F, 0x0F, 0xC1, 0xF0, 0x29, 0xC2,
+0x63, 0xC0, 0x21, 0xF4, 0x2D, 0x60, 0x40, 0x07, 0x90, 0xA0, 0x10, 0xA0, 0x0F, 0x02, 0x50, 0x40,
+0xB0, 0x0E, 0xE0, 0xA0, 0xF0, 0x23, 0xF0, 0x60, 0x25, 0xF0, 0xC0, 0x60, 0xF0, 0x22, 0xF0, 0x80,
+0xE0, 0x01, 0x70, 0xF0, 0x21, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x60, 0x70, 0x0E, 0x70, 0x90, 0xC1,
+0xF0, 0x28, 0xF0, 0x70, 0x03, 0x10, 0xD0, 0xE0, 0x50, 0x80, 0x30, 0x06, 0x40, 0xA0, 0x90, 0xC0,
+0x62, 0xC1, 0x60, 0xA0, 0x30, 0x10, 0xB0, 0x06, 0x90, 0x0F, 0x04, 0x50, 0x70, 0xA0, 0x80, 0x0F,
+0x0A, 0x90, 0xB0, 0x30, 0x50, 0x04, 0x30, 0xB0, 0x51, 0x91, 0x41, 0x92, 0x53, 0xB1, 0x04, 0xA0,
+0x0F, 0x02, 0xE1, 0x90, 0x40, 0xA0, 0x50, 0x08, 0x09, 0x80, 0x40, 0x90, 0x40, 0x70, 0xF0, 0x2F,
+0x09, 0xF9, 0xC3, 0x68, 0xC0, 0x60, 0x26, 0xF0, 0x24, 0xF1, 0x80, 0x10, 0xA0, 0xC0, 0xF0, 0x2F,
+0x0D, 0xC1, 0x2A, 0xF5, 0xC1, 0x64, 0xC0, 0x20, 0xF1, 0x2B, 0x60, 0x80, 0x07, 0x30, 0x80, 0x30,
+0x50, 0x0F, 0x04, 0x90, 0x40, 0x0D, 0x50, 0x30, 0xF0, 0x23, 0xF0, 0x60, 0xC0, 0x24, 0xF0, 0x60,
+0x20, 0xF0, 0x22, 0xF0, 0xC0, 0x70, 0x00, 0xB0, 0x30, 0xF2, 0xC0, 0x60, 0xC0, 0xF0, 0x21, 0xF0,
+0x60, 0x70, 0x0D, 0xE0, 0x70, 0x30, 0x60, 0xF2, 0x26, 0xF0, 0xA0, 0x03, 0x40, 0xD0, 0x10, 0xE0,
+0x50, 0x02, 0xB0, 0x90, 0xA0, 0x91, 0x50, 0x70, 0xD0, 0xA0, 0xF4, 0x30, 0x70, 0x60, 0xA0, 0x07,
+0x90, 0xB0, 0x0F, 0x05, 0x90, 0x0F, 0x0A, 0xB0, 0xE0, 0x70, 0xE0, 0x90, 0x42, 0x91, 0x80, 0x40,
+0x51, 0xB0, 0x0F, 0x01, 0xD0, 0x50, 0x0F, 0x01, 0x90, 0x30, 0x91, 0x80, 0x50, 0x08, 0x09, 0x30,
+0x02, 0xA0, 0xF0, 0x2F, 0x1F, 0xF0, 0xC0, 0x60, 0xC0, 0x68, 0xC4, 0xF0, 0x80, 0xA0, 0x10, 0xF1,
+0x20, 0xF0, 0x2F, 0x09, 0xF0, 0x60, 0x2F, 0x09, 0xC0, 0x63, 0xC1, 0xF3, 0x23, 0xF0, 0x60, 0xE0,
+0x05, 0x50, 0xA0, 0x90, 0x0F, 0x09, 0x40, 0x90, 0x0A, 0x80, 0x70, 0x60, 0xF0, 0x23, 0xF0, 0xC0,
+0x25, 0xC1, 0x25, 0xF0, 0x10, 0x50, 0x40, 0x60, 0xF0, 0xC0, 0x60, 0xC0, 0x25, 0xF0, 0xC0, 0x70,
+0xE0, 0x0D, 0x90, 0x80, 0xA0, 0x30, 0x60, 0xF0, 0x25, 0xF0, 0xA0, 0x05, 0x30, 0x51, 0x90, 0x41,
+0x50, 0xA0, 0x31, 0x40, 0x30, 0xD0, 0x80, 0xD0, 0x60, 0xF1, 0x30, 0x10, 0xF1, 0x80, 0x50, 0x07,
+0x50, 0xB0, 0x0F, 0x13, 0xB1, 0x51, 0x93, 0x40, 0x30, 0xE0, 0x31, 0x80, 0xE0, 0x08, 0xA0, 0xB0,
+0x0F, 0x02, 0xB0, 0xA0, 0x0F, 0x02, 0x90, 0xE0, 0x01, 0x40, 0x90, 0x08, 0x09, 0x30, 0x02, 0xA0,
+0xF0, 0x2F, 0x20, 0x60, 0xC0, 0xF4, 0x20, 0xF1, 0x20, 0xC4, 0x64, 0xC0, 0x60, 0xC3, 0x2F, 0x07,
+0xF0, 0x60, 0x2F, 0x0D, 0xF0, 0xC1, 0x63, 0xC1, 0x21, 0xF0, 0x70, 0x40, 0x05, 0x70, 0x40, 0x0F,
+0x0B, 0x50, 0x30, 0x50, 0x06, 0x40, 0x70, 0x60, 0xF0, 0xC0, 0x60, 0xF1, 0x21, 0xF0, 0xC1, 0xF0,
+0x23, 0x60, 0xF0, 0x25, 0xF0, 0x80, 0xA1, 0xF0, 0x61, 0x28, 0xF0, 0xC0, 0x60, 0xA1, 0x30, 0xA0,
+0xB0, 0x09, 0x50, 0xB1, 0x31, 0x60, 0xF0, 0x23, 0xF0, 0x70, 0x00, 0xB0, 0x50, 0x90, 0x40, 0xE0,
+0x80, 0x50, 0xB0, 0x03, 0x30, 0x90, 0xC0, 0x71, 0xA0, 0xD0, 0xC0, 0x21, 0xF0, 0x70, 0xA0, 0xF1,
+0xC0, 0x30, 0x50, 0xA0, 0x10, 0x04, 0x51, 0x0F, 0x07, 0xB2, 0x51, 0x92, 0x42, 0x90, 0x52, 0xB1,
+0x01, 0xB0, 0xA0, 0xB0, 0x01, 0xB0, 0x00, 0x90, 0x08, 0x50, 0x80, 0x0F, 0x03, 0x90, 0x30, 0x0F,
+0x01, 0x90, 0x30, 0x01, 0x40, 0x90, 0x08, 0x02, 0xB0, 0x90, 0x04, 0xA0, 0x31, 0xA0, 0x70, 0xF0,
+0x2F, 0x20, 0x60, 0xC0, 0x2E, 0xF0, 0x23, 0xC4, 0x66, 0xC2, 0x21, 0xF8, 0x20, 0xF1, 0x60, 0x2F,
+0x13, 0xC2, 0x61, 0x40, 0x70, 0xB0, 0x05, 0x80, 0xE0, 0x0F, 0x0A, 0x80, 0x10, 0x80, 0x30, 0x40,
+0xB0, 0x02, 0xB0, 0xE0, 0x30, 0xF3, 0x60, 0x23, 0xF0, 0xC1, 0x22, 0xF0, 0x60, 0xC0, 0x27, 0xF0,
+0xC0, 0x30, 0x60, 0xF1, 0x29, 0xF1, 0xC0, 0x20, 0xC1, 0xA0, 0x09, 0xB0, 0x50, 0x01, 0x50, 0x80,
+0x70, 0xC0, 0xF0, 0xC0, 0x61, 0x30, 0xE0, 0x50, 0xB1, 0x00, 0x80, 0xB0, 0x05, 0x30, 0x60, 0xF0,
+0xC0, 0xD0, 0x70, 0xC0, 0x22, 0xF3, 0x21, 0x10, 0xA0, 0xE0, 0x30, 0x04, 0x51, 0x0C, 0xB1, 0x50,
+0x92, 0x41, 0x92, 0x52, 0xB2, 0x0A, 0xB0, 0xA0, 0xB0, 0x04, 0x40, 0x08, 0xB0, 0x30, 0x0F, 0x04,
+0xA0, 0x0F, 0x01, 0x50, 0x10, 0x31, 0x70, 0x90, 0x08, 0x02, 0x30, 0xE0, 0x40, 0x03, 0xA0, 0x02,
+0x30, 0xF0, 0x2F, 0x20, 0x60, 0x2F, 0x09, 0xF5, 0x20, 0xC3, 0x68, 0xC2, 0xF1, 0x60, 0xF0, 0x2F,
+0x15, 0xF1, 0xE0, 0x40, 0x50, 0x91, 0x41, 0x50, 0xB0, 0x30, 0x40, 0x0F, 0x0D, 0x90, 0x00, 0x90,
+0x40, 0x30, 0xA1, 0x60, 0xF0, 0x22, 0xF0, 0xC0, 0x60, 0x22, 0xF0, 0x60, 0x23, 0xF0, 0x60, 0x25,
+0xF0, 0x60, 0xF0, 0xC0, 0x80, 0xE0, 0x70, 0x60, 0xF0, 0x2E, 0xF0, 0x80, 0x70, 0xE0, 0x08, 0x90,
+0x00, 0x90, 0x51, 0x90, 0x31, 0xC0, 0x20, 0xF0, 0x80, 0x30, 0x03, 0x70, 0x07, 0xA0, 0x60, 0xF2,
+0x23, 0xF0, 0xD0, 0xF0, 0x21, 0x60, 0x70, 0xA1, 0x70, 0x04, 0xB0, 0x50, 0x01, 0xB0, 0x50, 0x91,
+0x42, 0x90, 0xE1, 0x90, 0x52, 0xB0, 0x0F, 0x02, 0x50, 0x00, 0x50, 0xA0, 0x30, 0x70, 0x30, 0x06,
+0x40, 0x09, 0x30, 0x0F, 0x04, 0x80, 0xA0, 0x50, 0xB0, 0x0D, 0x50, 0xA0, 0x01, 0x90, 0x40, 0x08,
+0x02, 0x30, 0x80, 0x90, 0x03, 0x30, 0x01, 0xB0, 0x30, 0xF0, 0x2F, 0x20, 0x60, 0x2F, 0x16, 0xF0,
+0x21, 0xF0, 0x22, 0xC1, 0x63, 0xF0, 0x2F, 0x16, 0xF0, 0x70, 0x05, 0xB0, 0x50, 0xA0, 0x50, 0x0F,
+0x00, 0x50, 0x0C, 0xB0, 0x70, 0xE0, 0x60, 0xC0, 0xF1, 0x24, 0xF0, 0x60, 0xC0, 0x21, 0xF0, 0xC1,
+0xF0, 0x21, 0x60, 0xC0, 0xF0, 0x24, 0xF0, 0xD0, 0x60, 0x70, 0xE0, 0x00, 0x50, 0xD0, 0xF0, 0x2F,
+0x00, 0xF1, 0xD0, 0x71, 0x06, 0x40, 0xA0, 0x80, 0x30, 0xE1, 0x00, 0xE0, 0x30, 0xF0, 0x20, 0xF0,
+0x30, 0x70, 0x90, 0x00, 0x70, 0x50, 0x08, 0x70, 0xC0, 0xF0, 0x21, 0xF0, 0x25, 0xF0, 0xA0, 0x70,
+0x10, 0x70, 0xE0, 0x70, 0xB0, 0x02, 0xB0, 0xE0, 0x91, 0x51, 0xB0, 0x04, 0xE0, 0x10, 0x00, 0x91,
+0x0F, 0x03, 0xE0, 0x70, 0x80, 0xB0, 0x80, 0x09, 0x40, 0x09, 0xA0, 0x0F, 0x05, 0xB0, 0x30, 0x70,
+0x40, 0x0C, 0x50, 0x70, 0x01, 0x90, 0x40, 0x08, 0x09, 0xA0, 0x91, 0x40, 0x30, 0xF0, 0x2F, 0x20,
+0x60, 0x2F, 0x1F, 0xF1, 0xC1, 0x2F, 0x16, 0xF0, 0xC0, 0xA0, 0x06, 0x30, 0x80, 0xB0, 0x0E, 0x90,
+0xD0, 0x0C, 0x81, 0xF1, 0xC0, 0x60, 0xC0, 0x26, 0x60, 0x21, 0xF0, 0xC0, 0x23, 0x60, 0xF0, 0x25,
+0x60, 0x30, 0xA0, 0x90, 0x02, 0x30, 0xC0, 0x2F, 0x01, 0xF0, 0xC1, 0x60, 0x80, 0x05, 0x90, 0x80,
+0xF0, 0xC1, 0x80, 0xE0, 0x00, 0xA0, 0xF0, 0x21, 0xF0, 0x90, 0x70, 0xB0, 0x70, 0x09, 0xB0, 0x70,
+0x60, 0xF1, 0x30, 0xF0, 0x25, 0xF0, 0xC0, 0xE0, 0xC0, 0x50, 0xD0, 0xB0, 0x03, 0x90, 0x0A, 0x10,
+0x50, 0xE0, 0xD0, 0x30, 0x0F, 0x02, 0xA0, 0x90, 0xA0, 0x00, 0xA0, 0x09, 0x90, 0x09, 0x90, 0xE0,
+0x07, 0x40, 0x0D, 0xE1, 0x0B, 0x50, 0xD0, 0x50, 0x90, 0xE1, 0x08, 0x03, 0x80, 0x72, 0x80, 0xB0,
+0x30, 0x90, 0x40, 0x80, 0x30, 0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x1F, 0xF0, 0xC1, 0x2F, 0x16,
+0xF0, 0x30, 0x50, 0x06, 0x30, 0x40, 0x0F, 0x00, 0xE0, 0xD0, 0x0B, 0x40, 0xA0, 0x60, 0xF0, 0x22,
+0xC0, 0x60, 0x20, 0xF0, 0x23, 0xC1, 0xF1, 0xC0, 0x20, 0xF1, 0x60, 0x20, 0xF0, 0x21, 0xF1, 0xC0,
+0x60, 0xC0, 0x70, 0x04, 0x90, 0x30, 0xF0, 0x2F, 0x02, 0xF0, 0xC0, 0x70, 0xB0, 0x04, 0xE0, 0xF0,
+0x21, 0xF1, 0xA0, 0xC0, 0xA0, 0xF0, 0x21, 0xF0, 0x30, 0x10, 0xD0, 0x30, 0x09, 0x90, 0x70, 0x10,
+0x60, 0x70, 0x60, 0xF0, 0xC0, 0x60, 0xF0, 0x23, 0xF1, 0x81, 0xA0, 0x04, 0x90, 0x0A, 0x50, 0x01,
+0x30, 0x80, 0x0C, 0x80, 0xA0, 0x30, 0x40, 0xA0, 0x60, 0x80, 0x50, 0x00, 0x81, 0x08, 0x50, 0xB0,
+0x09, 0x30, 0x07, 0x71, 0x40, 0x0B, 0xB0, 0xD0, 0x31, 0xE0, 0x50, 0x00, 0xB0, 0x05, 0xB0, 0xD0,
+0x41, 0xE1, 0x08, 0x02, 0xA0, 0x80, 0x50, 0xB1, 0xE0, 0x70, 0x80, 0x01, 0x50, 0x80, 0xF0, 0x2F,
+0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0, 0x60, 0x80, 0x07, 0x30, 0x90, 0x0F, 0x0E,
+0x70, 0xF1, 0x23, 0xF1, 0x61, 0x20, 0xF0, 0x22, 0x60, 0xF1, 0xC0, 0x20, 0xF0, 0xC1, 0x22, 0xF0,
+0xC0, 0x60, 0xC0, 0xF1, 0x60, 0x80, 0x03, 0x90, 0x30, 0xF0, 0x2F, 0x03, 0xF0, 0xC0, 0x72, 0x02,
+0x30, 0xF0, 0x24, 0x80, 0xC0, 0x22, 0xF0, 0xC0, 0xD1, 0xA0, 0x09, 0x50, 0x70, 0x10, 0xE0, 0x50,
+0xF1, 0x60, 0xD0, 0xC0, 0xF0, 0x21, 0xF0, 0xA2, 0xD0, 0x70, 0x10, 0x03, 0x40, 0x0F, 0x0C, 0x90,
+0xA0, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x70, 0x00, 0x50, 0x70, 0x09, 0x50, 0xB0, 0x09, 0x30, 0x07,
+0x50, 0x80, 0x90, 0x30, 0x0B, 0xB1, 0x00, 0x50, 0x80, 0x30, 0xA0, 0x70, 0xB0, 0x03, 0xB0, 0xD0,
+0x01, 0x50, 0xE0, 0x08, 0x02, 0x70, 0x04, 0x70, 0x80, 0x01, 0x50, 0x80, 0xF0, 0x2F, 0x20, 0x60,
+0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x14, 0xF0, 0x60, 0xA0, 0x05, 0xE0, 0x70, 0x30, 0x80, 0x90, 0x01,
+0x30, 0x11, 0x30, 0x0F, 0x07, 0xA0, 0xC0, 0xF0, 0x28, 0x61, 0xF2, 0xC0, 0x60, 0xF0, 0x60, 0xC0,
+0xF0, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0x61, 0xF1, 0x21, 0xF0, 0xA0, 0x03, 0xA0, 0xC0, 0x2F, 0x06,
+0xF1, 0x60, 0xE0, 0x00, 0xB0, 0x70, 0xC0, 0xF0, 0x23, 0xF0, 0x25, 0xC0, 0xA0, 0x31, 0x07, 0xB0,
+0x40, 0xD0, 0xA0, 0x30, 0xA0, 0x81, 0xF0, 0x24, 0xF0, 0xA1, 0xD0, 0x80, 0xD0, 0x04, 0x40, 0x0F,
+0x0C, 0x70, 0xF0, 0x23, 0xF0, 0x60, 0xA0, 0x00, 0xA0, 0x09, 0x51, 0x09, 0x30, 0x08, 0xE0, 0xA0,
+0x30, 0x0F, 0x04, 0xA0, 0x80, 0x02, 0xB0, 0x70, 0x01, 0xB0, 0xE0, 0x90, 0xB1, 0x30, 0xA0, 0x50,
+0x02, 0x02, 0xE0, 0x70, 0xE0, 0x40, 0xE0, 0x70, 0x30, 0xA0, 0x31, 0xA0, 0x80, 0xF0, 0x2F, 0x20,
+0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x14, 0xF0, 0x70, 0x07, 0xA0, 0x01, 0x40, 0x02, 0xB2, 0x0F,
+0x06, 0xA0, 0x60, 0xF0, 0x28, 0xF1, 0xC0, 0x60, 0xC0, 0x62, 0xF0, 0x60, 0xC0, 0x60, 0xC0, 0xF0,
+0x20, 0x61, 0x20, 0xF0, 0x23, 0xF0, 0x70, 0x03, 0x40, 0x60, 0xF0, 0x2F, 0x07, 0xF0, 0xA0, 0x01,
+0x90, 0x31, 0x2B, 0xF1, 0x60, 0x71, 0xD0, 0x04, 0x90, 0xD0, 0x71, 0xD0, 0x80, 0x50, 0xC0, 0x30,
+0xF0, 0x24, 0x60, 0xD0, 0x80, 0xA0, 0x80, 0x70, 0x30, 0x50, 0x01, 0x40, 0x0F, 0x0B, 0x90, 0x80,
+0xF0, 0x24, 0xF0, 0x70, 0xD0, 0x50, 0x09, 0x51, 0x08, 0x50, 0xA0, 0x0F, 0x11, 0x50, 0xA0, 0x02,
+0xD0, 0x80, 0x30, 0xA1, 0x70, 0xB0, 0xD0, 0x40, 0x90, 0xD0, 0xB0, 0x01, 0x02, 0xB0, 0x50, 0xE0,
+0x30, 0x80, 0x50, 0xB0, 0x80, 0x01, 0x90, 0x80, 0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x1F, 0xF0,
+0xC1, 0x2F, 0x13, 0xF1, 0xA0, 0x00, 0x90, 0x05, 0xA0, 0x01, 0x40, 0x0F, 0x0B, 0xE0, 0x80, 0xF0,
+0x27, 0xF1, 0x30, 0xD0, 0x60, 0xF0, 0x60, 0xA0, 0x70, 0xC0, 0x60, 0xC1, 0x60, 0xF0, 0xC0, 0x60,
+0xC0, 0x26, 0xF0, 0xD0, 0xB0, 0x02, 0x90, 0x60, 0xF0, 0x2F, 0x07, 0xF0, 0x81, 0x01, 0x50, 0x90,
+0x30, 0xF0, 0x2B, 0xF0, 0x60, 0x10, 0x80, 0x07, 0x50, 0x30, 0x10, 0x31, 0x70, 0xC0, 0xF0, 0x24,
+0xC0, 0xF2, 0xC0, 0x80, 0x30, 0x01, 0x90, 0x0E, 0xB0, 0x09, 0x50, 0x70, 0xC0, 0x25, 0xF0, 0x70,
+0x0B, 0x51, 0x08, 0xA0, 0x0F, 0x13, 0x40, 0x90, 0x01, 0x70, 0x01, 0xB0, 0x70, 0x90, 0xB0, 0x30,
+0x01, 0x80, 0x90, 0x01, 0x02, 0x70, 0xD0, 0xB0, 0x02, 0xB0, 0x80, 0x01, 0x50, 0x80, 0xF0, 0x2F,
+0x20, 0x60, 0xF1, 0x2F, 0x1E, 0xF0, 0xC1, 0xF0, 0x24, 0xF2, 0x2F, 0x05, 0xF5, 0x80, 0x50, 0xE0,
+0xA0, 0x05, 0x40, 0x80, 0x00, 0x40, 0x04, 0x50, 0x10, 0x40, 0x0F, 0x03, 0x70, 0xF0, 0x26, 0xF1,
+0xC0, 0x70, 0x50, 0x90, 0x10, 0xC0, 0xF0, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x60, 0xC0, 0xF2, 0x24,
+0xF1, 0x70, 0x40, 0x02, 0x40, 0x60, 0xF0, 0x25, 0xF1, 0x2F, 0x00, 0xF0, 0xA0, 0x01, 0x90, 0x00,
+0xA0, 0xF3, 0x22, 0xF0, 0x24, 0xF0, 0x70, 0xD0, 0x80, 0x04, 0xB0, 0x90, 0x03, 0xE0, 0x30, 0x10,
+0xD0, 0xA0, 0xF7, 0x60, 0x11, 0xA0, 0x01, 0x90, 0x0B, 0x80, 0xA4, 0x30, 0x50, 0x04, 0x90, 0x70,
+0xC0, 0xF1, 0x22, 0xF2, 0x70, 0x0B, 0xB0, 0x50, 0x07, 0x30, 0x50, 0x0C, 0xB0, 0x80, 0x0F, 0x04,
+0x50, 0x40, 0x01, 0x70, 0x02, 0x30, 0xD0, 0x90, 0xA0, 0x40, 0x90, 0xD0, 0xB0, 0x01, 0x02, 0xA0,
+0x50, 0xD0, 0x70, 0x90, 0x01, 0x70, 0xA1, 0x70, 0x80, 0x20, 0xCF, 0x20, 0x60, 0xCF, 0x21, 0x60,
+0xCF, 0x15, 0x30, 0x80, 0x10, 0x50, 0xB5, 0x00, 0xA0, 0xB0, 0x40, 0xB3, 0x90, 0x70, 0x90, 0x40,
+0xBF, 0x02, 0x30, 0x40, 0xC2, 0x20, 0xC5, 0xD0, 0xE0, 0xB0, 0x00, 0xE0, 0x60, 0xC1, 0xF0, 0xC0,
+0xE3, 0xCA, 0xF0, 0x30, 0x50, 0xB2, 0xE0, 0x60, 0xCF, 0x0A, 0x80, 0x90, 0xB0, 0x91, 0x70, 0xF0,
+0xCB, 0xF0, 0x81, 0x31, 0x80, 0x90, 0x11, 0xD0, 0x71, 0x30, 0x80, 0xB1, 0x50, 0x30, 0xA0, 0x30,
+0x10, 0xA0, 0xF0, 0xC2, 0x60, 0x10, 0xF0, 0xC0, 0xF0, 0xA0, 0xE0, 0xB0, 0x40, 0xBA, 0x50, 0xA0,
+0xF1, 0xC0, 0xF1, 0xC0, 0x70, 0xE0, 0x00, 0xB0, 0x90, 0x70, 0xA0, 0xF0, 0xC3, 0x60, 0xC3, 0x60,
+0x70, 0xBA, 0x50, 0x90, 0xB5, 0x00, 0xE1, 0x00, 0xBC, 0x90, 0xD0, 0x30, 0x50, 0xBF, 0x02, 0x50,
+0x30, 0x00, 0xB0, 0xD0, 0x30, 0xA0, 0x70, 0x80, 0x00, 0x30, 0xA1, 0x30, 0x03, 0x02, 0x70, 0xB0,
+0x00, 0x90, 0xA0, 0xD0, 0xA0, 0xD0, 0x10, 0xD0, 0x10, 0x80, 0xCF, 0x21, 0x60, 0xCF, 0x21, 0x61,
+0xCF, 0x12, 0x60, 0xC1, 0xA0, 0xE1, 0x55, 0x30, 0xE0, 0x50, 0xE0, 0x52, 0x90, 0x80, 0x5F, 0x05,
+0x80, 0xE0, 0xC2, 0x60, 0xC5, 0x60, 0x80, 0xA0, 0x80, 0x30, 0xC0, 0x60, 0xC2, 0xE0, 0x80, 0xE0,
+0x60, 0xCB, 0x30, 0x51, 0x40, 0x50, 0xE0, 0x60, 0xCF, 0x03, 0x60, 0xC3, 0x60, 0xC1, 0xA0, 0x50,
+0x30, 0x80, 0xCE, 0xA0, 0x70, 0x90, 0x31, 0x70, 0x40, 0x90, 0xE0, 0x80, 0x30, 0xD0, 0xA0, 0x30,
+0xA0, 0x80, 0x30, 0xC1, 0x40, 0xA0, 0x70, 0x60, 0xC1, 0x80, 0x60, 0xC2, 0x60, 0x30, 0xA0, 0xE1,
+0x30, 0x59, 0x30, 0xC0, 0x60, 0xC1, 0x60, 0xC1, 0x80, 0x31, 0x80, 0xC5, 0x70, 0x80, 0xC0, 0x60,
+0xC2, 0x80, 0xE0, 0x59, 0x91, 0x55, 0xE1, 0x5F, 0x00, 0x30, 0x40, 0x70, 0x5F, 0x03, 0x30, 0x81,
+0xD0, 0x10, 0xD0, 0x10, 0x30, 0x00, 0x40, 0x81, 0x90, 0x03, 0x02, 0x70, 0xB0, 0x03, 0x50, 0x80,
+0x01, 0x90, 0x80, 0xF0, 0x2F, 0x1F, 0xF0, 0x60, 0xF1, 0x23, 0xF0, 0x23, 0xF1, 0x2F, 0x13, 0xF0,
+0xC1, 0xF0, 0x2F, 0x13, 0xF0, 0xC0, 0xA0, 0x10, 0x50, 0x03, 0x90, 0xE0, 0x01, 0x40, 0x0F, 0x0A,
+0x90, 0x80, 0xF1, 0x21, 0xF1, 0x60, 0xF0, 0x21, 0xF1, 0x60, 0x80, 0xC0, 0xF2, 0xC0, 0x61, 0xE1,
+0xC0, 0x60, 0xF2, 0x26, 0xF0, 0x70, 0x01, 0x10, 0x30, 0x70, 0x21, 0xF1, 0x22, 0xF2, 0x25, 0xF0,
+0x20, 0xF0, 0x26, 0xF0, 0x31, 0x00, 0x80, 0xF1, 0x23, 0xF0, 0x21, 0xF1, 0x22, 0xF0, 0xC0, 0xD0,
+0x70, 0x60, 0x50, 0x70, 0x90, 0x03, 0xB0, 0xE0, 0xD0, 0x40, 0xA0, 0x60, 0x70, 0x31, 0xF0, 0x80,
+0xA0, 0x70, 0x60, 0xF2, 0x21, 0xF1, 0xD0, 0x70, 0x80, 0x30, 0x70, 0x81, 0x50, 0xA0, 0x05, 0xA0,
+0xF0, 0x24, 0xF1, 0x20, 0xC0, 0xF0, 0x22, 0xF1, 0x71, 0xF1, 0x22, 0xF0, 0x60, 0x80, 0x09, 0xB0,
+0x50, 0x05, 0xA0, 0x0F, 0x01, 0x90, 0xE1, 0x0F, 0x04, 0x40, 0xE0, 0x10, 0x01, 0x50, 0x30, 0x70,
+0x80, 0xE1, 0x30, 0x70, 0x02, 0x08, 0xB0, 0x80, 0x01, 0x50, 0x80, 0xF0, 0x2F, 0x20, 0x60, 0xF0,
+0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0, 0xC0, 0xE0, 0x04, 0xA0, 0xB0, 0x01, 0x40, 0x0F, 0x0B, 0xD0,
+0xF1, 0x21, 0xF0, 0xA0, 0xD0, 0x60, 0x24, 0xF0, 0x20, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x60, 0xC2,
+0xF0, 0x61, 0xF0, 0x26, 0xF0, 0xD0, 0xA0, 0x50, 0xA0, 0x50, 0xC0, 0x2F, 0x0A, 0xF0, 0x70, 0x01,
+0x30, 0xF1, 0x2C, 0xF0, 0x60, 0x80, 0xC0, 0x80, 0x60, 0x06, 0x90, 0x70, 0x80, 0xF1, 0xC0, 0x10,
+0xF0, 0x60, 0xC0, 0xF0, 0x60, 0xC0, 0xF1, 0x21, 0xC0, 0xD0, 0x10, 0x81, 0x10, 0xD0, 0x30, 0x40,
+0x30, 0x81, 0x02, 0x50, 0xA0, 0x80, 0xF0, 0x2A, 0xF1, 0x60, 0x70, 0x10, 0xF1, 0x23, 0xF1, 0x70,
+0x00, 0xE0, 0x70, 0xB0, 0x05, 0x51, 0x04, 0xA0, 0xB0, 0x0F, 0x19, 0xB0, 0xD0, 0x02, 0x70, 0x90,
+0x03, 0x80, 0x90, 0x01, 0x02, 0x90, 0x11, 0xE0, 0x00, 0xB0, 0xD0, 0xA0, 0x81, 0xA0, 0x80, 0xF0,
+0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0, 0x80, 0x90, 0x05, 0x70, 0x90, 0x00,
+0x40, 0x0F, 0x0C, 0xD0, 0xC0, 0x21, 0xF0, 0x30, 0xA0, 0xF0, 0x24, 0xF1, 0x61, 0xF1, 0x60, 0xC2,
+0x60, 0xF1, 0xC0, 0x61, 0xF0, 0x25, 0xF0, 0x30, 0xA0, 0xF1, 0x2F, 0x08, 0xF2, 0xC0, 0xA0, 0x00,
+0xE0, 0x60, 0x2E, 0xF1, 0xA0, 0x10, 0x60, 0x70, 0x90, 0x04, 0xD0, 0x30, 0xE0, 0x10, 0xF0, 0x20,
+0xF0, 0x30, 0x60, 0xF0, 0xC0, 0xD0, 0x10, 0x80, 0xF0, 0x80, 0x21, 0xF0, 0x70, 0x30, 0x80, 0x30,
+0xD0, 0x70, 0xC0, 0xF2, 0xA0, 0x30, 0x80, 0x30, 0xA0, 0xF1, 0x2A, 0xC0, 0xA1, 0x80, 0x00, 0x70,
+0xF0, 0x25, 0xF0, 0x60, 0x10, 0x40, 0x70, 0x50, 0x05, 0x51, 0x03, 0x30, 0x50, 0x0F, 0x1B, 0xD0,
+0x80, 0x31, 0xA0, 0x70, 0x50, 0xB1, 0x90, 0xD0, 0xB0, 0x01, 0x02, 0xD0, 0x01, 0xA0, 0xE0, 0x00,
+0x70, 0x80, 0x01, 0x90, 0x80, 0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0,
+0x30, 0x50, 0x04, 0xB0, 0x70, 0x90, 0x00, 0x40, 0x0F, 0x0A, 0x50, 0x30, 0x80, 0xF0, 0x21, 0xF0,
+0xC0, 0x70, 0xF0, 0x22, 0xF1, 0xC0, 0x60, 0x20, 0xF1, 0x20, 0x60, 0xF0, 0x60, 0xC0, 0xF0, 0x60,
+0xF2, 0xC0, 0x60, 0xC0, 0x25, 0xF0, 0x2F, 0x03, 0xF0, 0x24, 0xF1, 0x61, 0xA0, 0x10, 0x51, 0xA0,
+0xC0, 0x2F, 0x01, 0xF0, 0x80, 0x20, 0xC0, 0x30, 0x80, 0x03, 0x30, 0x80, 0x30, 0xC0, 0xF0, 0x21,
+0xF0, 0x80, 0x70, 0x60, 0xA0, 0x80, 0xC0, 0xD0, 0x80, 0xF0, 0x60, 0x20, 0xC0, 0xF0, 0xC0, 0x60,
+0xF0, 0x30, 0x70, 0x21, 0xF1, 0xC2, 0xF0, 0x24, 0xF0, 0x24, 0xF1, 0xA0, 0x90, 0x02, 0xA0, 0x30,
+0xF0, 0x24, 0xF0, 0x60, 0xE0, 0x01, 0xA0, 0x05, 0x51, 0x02, 0xE1, 0x0F, 0x1B, 0xB0, 0xD0, 0x01,
+0x50, 0xE0, 0x90, 0x72, 0xA0, 0x50, 0x02, 0x02, 0x70, 0x02, 0x70, 0x40, 0x70, 0x80, 0x01, 0x50,
+0x30, 0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0, 0x30, 0xB0, 0x04, 0x70,
+0x50, 0x01, 0x90, 0x0F, 0x09, 0x40, 0xA0, 0x60, 0xF0, 0x24, 0xF0, 0x22, 0xF0, 0xC0, 0x60, 0xC0,
+0xF0, 0x21, 0xF0, 0x60, 0x21, 0x60, 0x20, 0xF0, 0x60, 0xC0, 0x23, 0x61, 0x2F, 0x06, 0xF2, 0x60,
+0x80, 0xF2, 0xC0, 0x60, 0xA0, 0x80, 0xE1, 0x70, 0x50, 0x30, 0x80, 0xF0, 0x2F, 0x02, 0xF2, 0x50,
+0x70, 0x03, 0xB0, 0xA0, 0xF1, 0x22, 0xF0, 0xC0, 0x60, 0xF0, 0x60, 0x70, 0xF0, 0x60, 0xF0, 0x20,
+0x70, 0xF0, 0x20, 0xF0, 0x61, 0x80, 0x50, 0xA0, 0xF0, 0x21, 0xF3, 0x2C, 0xA0, 0x30, 0x02, 0xA0,
+0x60, 0xF0, 0x25, 0xF0, 0x30, 0xB0, 0x01, 0x30, 0xB0, 0x04, 0x50, 0xB0, 0x01, 0x90, 0xA0, 0x0F,
+0x1D, 0xD0, 0x01, 0x50, 0x80, 0x08, 0x02, 0x40, 0x10, 0xB0, 0x01, 0xD1, 0x80, 0x01, 0x50, 0x80,
+0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x15, 0xF0, 0xA0, 0x04, 0x30, 0x50, 0x02,
+0x90, 0x0F, 0x08, 0x50, 0x70, 0xF0, 0x28, 0xF0, 0x20, 0x61, 0xF1, 0x21, 0xF0, 0xC0, 0x60, 0xF1,
+0x60, 0x22, 0x60, 0xF1, 0x21, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0xF1, 0x70, 0xD0, 0x30,
+0x90, 0x71, 0xA0, 0x30, 0x80, 0x02, 0x70, 0x90, 0x30, 0x61, 0x2F, 0x05, 0xF1, 0x70, 0x00, 0x90,
+0xB0, 0x01, 0x90, 0x80, 0xF0, 0x22, 0xF0, 0xD0, 0xC0, 0x70, 0xA0, 0x20, 0x60, 0xF0, 0x20, 0xF1,
+0x22, 0xF0, 0xC0, 0x30, 0x81, 0xF0, 0x22, 0xF0, 0x2C, 0xF0, 0xD0, 0x50, 0x02, 0xE0, 0x30, 0xF0,
+0x26, 0xF0, 0xA0, 0x01, 0x50, 0x80, 0x05, 0x90, 0xB0, 0x01, 0x70, 0xA0, 0x0F, 0x1B, 0xB0, 0x70,
+0xD0, 0x01, 0x50, 0xE0, 0x03, 0x31, 0x90, 0x01, 0x08, 0x50, 0x70, 0xA0, 0x30, 0xA0, 0x30, 0xF0,
+0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x20, 0xC1, 0x2F, 0x14, 0xF0, 0x60, 0x80, 0x03, 0xB0, 0xA0, 0x03,
+0x90, 0xB0, 0x0A, 0x90, 0x30, 0x09, 0x30, 0x40, 0xF0, 0x26, 0xF1, 0x61, 0x25, 0xF0, 0x60, 0xF0,
+0x21, 0xC0, 0x22, 0xC1, 0xF0, 0x23, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2D, 0xF1, 0x30, 0x50, 0x09,
+0x90, 0x80, 0xF2, 0x60, 0xF0, 0x2F, 0x05, 0xF0, 0x81, 0xD0, 0x70, 0x00, 0x30, 0x40, 0xA0, 0xF0,
+0x23, 0xF3, 0xC0, 0xA0, 0xF0, 0x25, 0xF0, 0x60, 0xC0, 0x70, 0xF1, 0x2F, 0x01, 0xF0, 0x80, 0xE0,
+0xB0, 0x90, 0x70, 0x80, 0xF1, 0x26, 0xF0, 0x30, 0x50, 0x00, 0xA0, 0xE0, 0x05, 0x90, 0x01, 0xA0,
+0xB0, 0x00, 0xA0, 0x0F, 0x1A, 0x70, 0xB0, 0xD0, 0x30, 0xA0, 0x70, 0xE0, 0x02, 0xB0, 0x30, 0xE0,
+0x90, 0x01, 0x09, 0x30, 0x02, 0x30, 0xF0, 0x2F, 0x20, 0x60, 0xF0, 0x2F, 0x1F, 0xC1, 0x60, 0x2F,
+0x14, 0xF0, 0x70, 0x40, 0x50, 0x03, 0x30, 0x02, 0xB0, 0x90, 0x50, 0x0F, 0x07, 0x70, 0xF0, 0x27,
+0xC0, 0x60, 0xC0, 0xF0, 0x25, 0xC1, 0x22, 0xC1, 0x22, 0x60, 0xF0, 0x26, 0x61, 0xC0, 0xF0, 0x2D,
+0xF0, 0x30, 0x90, 0x09, 0x80, 0x60, 0xF0, 0x20, 0xF0, 0x60, 0xC0, 0x22, 0xF0, 0x20, 0xF0, 0x2F,
+0x00, 0xF0, 0xA1, 0xC0, 0x70, 0xA0, 0x80, 0x10, 0x60, 0xF0, 0x26, 0xF2, 0x24, 0xF0, 0x61, 0xC2,
+0x2F, 0x03, 0xF0, 0x80, 0x30, 0x81, 0xF0, 0x28, 0xF0, 0x30, 0x00, 0x40, 0xE0, 0x06, 0x90, 0x00,
+0xE0, 0x40, 0x01, 0x50, 0x30, 0x0F, 0x18, 0x90, 0x40, 0xB0, 0x70, 0x01, 0x50, 0x40, 0x03, 0xB0,
+0x90, 0x02, 0x09, 0xA0, 0x02, 0x30, 0xF0, 0x2F, 0x20, 0x60, 0x2F, 0x0A, 0xF7, 0x21, 0xC3, 0x66,
+0xC2, 0x60, 0x2F, 0x14, 0xF0, 0x30, 0x81, 0xA0, 0x80, 0x50, 0x30, 0xA0, 0x81, 0x40, 0x51, 0x90,
+0x0F, 0x04, 0x51, 0x80, 0x70, 0xF0, 0x23, 0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x27, 0x60, 0xF1, 0x21,
+0xC0, 0x23, 0xC0, 0x60, 0x28, 0x61, 0xF1, 0x2C, 0xC0, 0x70, 0xA0, 0x30, 0x50, 0x06, 0x30, 0x60,
+0xF0, 0x20, 0xF0, 0x60, 0xC0, 0x63, 0xC1, 0x20, 0xF2, 0x2C, 0xF2, 0x70, 0x80, 0xF0, 0xA0, 0x60,
+0xF0, 0x2E, 0xF0, 0xA0, 0x60, 0xC1, 0x66, 0xC5, 0x20, 0xFA, 0x29, 0xF0, 0x30, 0x00, 0xB0, 0x30,
+0x06, 0x91, 0x30, 0x03, 0x40, 0x80, 0x0F, 0x17, 0x90, 0x40, 0x50, 0xA0, 0x01, 0x90, 0x40, 0x08,
+0x09, 0x70, 0x80, 0x30, 0xA0, 0x70, 0xF0, 0x2F, 0x20, 0x60, 0x2F, 0x0A, 0xC1, 0x68, 0xC3, 0x20,
+0xF4, 0x21, 0xF0, 0x60, 0x2F, 0x13, 0xF0, 0x20, 0xF0, 0xC0, 0x63, 0xC1, 0xF0, 0xC0, 0x70, 0xB0,
+0x00, 0x40, 0x0F, 0x03, 0x30, 0xA0, 0x30, 0xA0, 0xF0, 0x23, 0xF1, 0x61, 0xF0, 0x28, 0x60, 0x20,
+0xF0, 0x20, 0xF0, 0x20, 0x60, 0xC0, 0x21, 0xF0, 0x20, 0x60, 0x28, 0xF0, 0xC0, 0x60, 0xC0, 0xF3,
+0x28, 0xF2, 0xC0, 0xA1, 0xB0, 0x05, 0xD0, 0xF0, 0x20, 0xC0, 0x60, 0xF3, 0xC1, 0x64, 0xC0, 0x20,
+0xF0, 0x2C, 0xF1, 0x20, 0xD0, 0x80, 0xF0, 0x2D, 0xF1, 0x31, 0xF7, 0x20, 0xC2, 0x69, 0xC1, 0x2B,
+0xF1, 0xA0, 0x00, 0x80, 0x50, 0x06, 0x90, 0x70, 0x05, 0x80, 0x40, 0x50, 0x40, 0xE0, 0x40, 0x50,
+0x0F, 0x11, 0x50, 0x40, 0x50, 0x10, 0x30, 0x80, 0xA0, 0x90, 0x08, 0x09, 0x30, 0x50, 0x01, 0xA0,
+0xF0, 0x2F, 0x20, 0xC1, 0x24, 0xF5, 0x20, 0xC1, 0x6A, 0xC1, 0x22, 0xF1, 0x2F, 0x00, 0xF0, 0x60,
+0x2F, 0x0A, 0xF4, 0xC1, 0x64, 0xC0, 0x21, 0xF2, 0x21, 0xF1, 0xD0, 0x70, 0x90, 0x0F, 0x02, 0xA0,
+0x60, 0xF2, 0x20, 0xF0, 0x20, 0xF0, 0x20, 0x61, 0xF1, 0x29, 0x60, 0xF0, 0x20, 0xF0, 0x21, 0xC0,
+0x25, 0x60, 0xF0, 0x27, 0xF1, 0xC0, 0x60, 0x81, 0x60, 0xF0, 0x21, 0xF0, 0x25, 0xF1, 0x20, 0xF1,
+0x70, 0x30, 0xA0, 0x40, 0x02, 0xA0, 0xC0, 0x20, 0xC1, 0x27, 0xF0, 0x21, 0xC0, 0x64, 0xC0, 0x20,
+0xF2, 0x2F, 0x07, 0xF3, 0xA0, 0xC0, 0x2F, 0x06, 0xC1, 0x69, 0xC2, 0xF0, 0x30, 0x00, 0x80, 0x07,
+0x30, 0xB0, 0x06, 0xD0, 0xE0, 0x90, 0x50, 0x90, 0xE0, 0x30, 0xA0, 0x31, 0x80, 0x40, 0x90, 0x50,
+0xB1, 0x0F, 0x07, 0x40, 0x91, 0x30, 0x00, 0xB0, 0xE0, 0x90, 0x08, 0x09, 0x30, 0x02, 0xA0, 0xF0,
+0x2F, 0x1E, 0xF1, 0xC7, 0x65, 0xC4, 0x20, 0xF6, 0x2F, 0x07, 0xF0, 0x60, 0x2F, 0x0A, 0xC1, 0x63,
+0xC0, 0xF3, 0x29, 0xF0, 0xD0, 0xB0, 0x50, 0xB0, 0x0F, 0x00, 0x50, 0xA0, 0xF0, 0x24, 0xF0, 0xC0,
+0x60, 0x2C, 0x60, 0xF2, 0x20, 0xF1, 0xC1, 0x23, 0xF0, 0xC1, 0xF3, 0x20, 0xF1, 0x20, 0xF0, 0x60,
+0x70, 0x80, 0x90, 0xA0, 0x70, 0x60, 0xF1, 0x60, 0xF1, 0x28, 0xF0, 0xC0, 0xF0, 0xA0, 0xE0, 0x00,
+0x50, 0xA0, 0xF0, 0x20, 0x60, 0x2B, 0xF2, 0x21, 0xC1, 0x63, 0xC1, 0x21, 0xF0, 0x20, 0xF0, 0x23,
+0xF0, 0x60, 0xF0, 0x60, 0xF1, 0x20, 0x60, 0xC1, 0x80, 0xF0, 0x60, 0x70, 0xF1, 0xC1, 0x2F, 0x08,
+0xF6, 0x20, 0xC4, 0x60, 0x80, 0x40, 0x92, 0x53, 0xB0, 0x40, 0x80, 0x06, 0xA0, 0xB0, 0x07, 0xB0,
+0x50, 0x90, 0x40, 0xE0, 0x81, 0x30, 0xA1, 0x70, 0x50, 0x01, 0xB0, 0x0E, 0x30, 0x00, 0x90, 0xE0,
+0x01, 0x40, 0x90, 0x08, 0x09, 0x80, 0xB0, 0x01, 0xA0, 0xF0, 0x2F, 0x10, 0xF4, 0x20, 0xC5, 0x65,
+0xC5, 0x23, 0xF1, 0x2F, 0x14, 0xF0, 0x60, 0x2E, 0xF3, 0x20, 0xC1, 0x63, 0xC1, 0x21, 0xF1, 0x2E,
+0xF0, 0x60, 0x80, 0xB0, 0x50, 0x04, 0xA0, 0x30, 0xA0, 0x30, 0x42, 0xB0, 0x90, 0x80, 0x50, 0xA0,
+0xF0, 0x25, 0x60, 0xC0, 0x2C, 0xC0, 0x60, 0xF5, 0xC0, 0x22, 0xF1, 0x60, 0x30, 0xE0, 0xF0, 0x80,
+0x70, 0x60, 0xF1, 0xC1, 0xE0, 0xA0, 0x02, 0xB0, 0x40, 0x80, 0x90, 0x30, 0xA0, 0x60, 0xF0, 0x21,
+0xC0, 0x26, 0xF0, 0x20, 0xF0, 0x30, 0xA1, 0x60, 0x21, 0x60, 0xF0, 0x2F, 0x06, 0xC1, 0x62, 0xC2,
+0xF2, 0xC0, 0x10, 0xA0, 0xD0, 0x30, 0x80, 0xA0, 0x80, 0x31, 0x80, 0x70, 0x80, 0x70, 0xF1, 0x60,
+0x2F, 0x15, 0xF0, 0xC0, 0x80, 0x00, 0xE0, 0x51, 0xB3, 0x40, 0x30, 0x40, 0x90, 0x41, 0x90, 0x51,
+0x80, 0xE0, 0x0F, 0x04, 0xA0, 0xE0, 0xA0, 0x70, 0x09, 0xB4, 0x70, 0x80, 0x70, 0x40, 0x01, 0xE0,
+0x50, 0x08, 0x09, 0x80, 0xA0, 0x81, 0x70, 0xF0, 0x2F, 0x0D, 0xC1, 0x68, 0xC3, 0x20, 0xF3, 0xC0,
+0xF3, 0x2F, 0x1C, 0xF0, 0xC1, 0x2A, 0xF0, 0x21, 0xC0, 0x64, 0xC0, 0x20, 0xF2, 0x2F, 0x05, 0xF1,
+0xA0, 0x00, 0x40, 0x00, 0xB0, 0x30, 0xA0, 0x70, 0x60, 0xC0, 0xF0, 0xC0, 0x82, 0xA0, 0x30, 0x60,
+0xA0, 0x60, 0xF0, 0x23, 0x61, 0x20, 0xF0, 0x28, 0xF2, 0xC0, 0x60, 0xF0, 0x60, 0x70, 0xA0, 0x71,
+0xA0, 0x80, 0xF2, 0x60, 0x30, 0xA0, 0x50, 0x80, 0xA1, 0x00, 0xE0, 0x10, 0x70, 0x80, 0x70, 0xA0,
+0x04, 0xB0, 0xD0, 0xA0, 0x40, 0x80, 0x60, 0x21, 0x60, 0x30, 0x29, 0xF3, 0x20, 0xC1, 0xF0, 0x2F,
+0x07, 0xF3, 0xC1, 0x63, 0x81, 0x01, 0x80, 0x40, 0x03, 0x40, 0x10, 0x30, 0x60, 0xF1, 0x60, 0x2F,
+0x15, 0xF1, 0xA0, 0x00, 0x30, 0xD0, 0x80, 0xA0, 0xE0, 0x50, 0x40, 0xA0, 0x00, 0x90, 0x03, 0x50,
+0xA0, 0x51, 0x93, 0x43, 0x90, 0x51, 0xB0, 0x07, 0xB0, 0x90, 0x00, 0x90, 0x40, 0x07, 0xA0, 0x30,
+0x81, 0xE0, 0xD0, 0x30, 0x00, 0x40, 0xA0, 0x80, 0x30, 0x70, 0x50, 0x08, 0x09, 0xE0, 0xB0, 0x01,
+0x30, 0xF0, 0x28, 0xF5, 0x20, 0xC2, 0x69, 0xC1, 0x2F, 0x01, 0xF0, 0x60, 0xF0, 0x2F, 0x21, 0x60,
+0xF0, 0x22, 0xF2, 0xC1, 0x64, 0xC0, 0x2F, 0x10, 0xF0, 0xA0, 0x40, 0x51, 0x70, 0xF3, 0x22, 0xF6,
+0x21, 0xF1, 0x61, 0x26, 0xF5, 0x60, 0xC0, 0x30, 0xA0, 0x30, 0xA0, 0x80, 0x04, 0xE0, 0xA0, 0xE0,
+0x70, 0x80, 0x90, 0x02, 0x90, 0x04, 0xB0, 0xA0, 0x06, 0xB0, 0x00, 0x50, 0x30, 0xC0, 0xF0, 0x20,
+0xF1, 0x2D, 0xF0, 0x60, 0xC0, 0x2F, 0x10, 0xF1, 0xC0, 0x82, 0x30, 0xA0, 0x10, 0x40, 0x80, 0x70,
+0x60, 0x50, 0xF3, 0x60, 0x2F, 0x15, 0xF0, 0x60, 0x40, 0x04, 0x50, 0x80, 0x40, 0x01, 0x90, 0x02,
+0xE0, 0x30, 0x0B, 0xB0, 0x51, 0x90, 0x44, 0x92, 0x51, 0xB0, 0xA0, 0x06, 0x70, 0x50, 0x02, 0xE1,
+0x01, 0x80, 0x90, 0x01, 0xE0, 0xB0, 0x08, 0x09, 0x40, 0x90, 0x01, 0x80, 0xC0, 0xF0, 0x23, 0xC3,
+0x67, 0xC2, 0x23, 0xF6, 0x2F, 0x01, 0xF0, 0x60, 0xF0, 0x2F, 0x1F, 0xF0, 0x20, 0x60, 0xF0, 0x20,
+0xC1, 0x63, 0xC1, 0x2F, 0x16, 0xF0, 0x31, 0xA0, 0xC0, 0xF0, 0x2E, 0xC0, 0x60, 0xC0, 0xF0, 0x23,
+0xF2, 0x80, 0xA4, 0xE0, 0x30, 0x40, 0x90, 0x07, 0x50, 0x90, 0xE0, 0x05, 0xB0, 0x40, 0x03, 0xD0,
+0x50, 0x07, 0x50, 0x70, 0xC1, 0x60, 0x20, 0xF0, 0x2A, 0xF0, 0x22, 0xF0, 0x60, 0xF1, 0x2F, 0x11,
+0xF0, 0x20, 0xF4, 0x64, 0xC1, 0x20, 0xF0, 0x60, 0xF0, 0x2F, 0x14, 0xF0, 0x60, 0xE0, 0x09, 0x90,
+0x01, 0x30, 0xE0, 0x0F, 0x08, 0xB1, 0x51, 0x30, 0x43, 0x90, 0x50, 0x30, 0x40, 0xB1, 0x00, 0xE1,
+0x02, 0xA0, 0x50, 0x01, 0x80, 0xB0, 0x08, 0x09, 0x90, 0x80, 0x40, 0xE0, 0xA0, 0x80, 0x64, 0xC2,
+0x2F, 0x18, 0xF0, 0x60, 0x2F, 0x1D, 0xF0, 0x20, 0xC1, 0x63, 0xC1, 0x22, 0xF0, 0x2F, 0x17, 0xF1,
+0x60, 0x31, 0xF1, 0x2B, 0xF0, 0x20, 0x60, 0xC0, 0x20, 0xF0, 0x23, 0xF0, 0xC0, 0x30, 0xA0, 0x90,
+0x06, 0x90, 0x08, 0x50, 0xB0, 0x07, 0x40, 0xB0, 0x02, 0xE0, 0x90, 0x07, 0xA0, 0xF1, 0x21, 0x60,
+0xC0, 0xF0, 0x28, 0xA0, 0x30, 0x22, 0xC0, 0x60, 0xC1, 0xF0, 0x2F, 0x16, 0xF2, 0x21, 0xC1, 0x63,
+0xC1, 0x21, 0xF0, 0x2F, 0x11, 0xC0, 0x30, 0x08, 0xB0, 0x50, 0xB0, 0xA0, 0x90, 0x0F, 0x0D, 0x50,
+0xA0, 0x33, 0xA0, 0x71, 0x30, 0xE0, 0x81, 0x50, 0x41, 0x90, 0x70, 0x30, 0x40, 0x90, 0xA0, 0x09,
+0x09, 0x50, 0xA0, 0x90, 0x50, 0xE0, 0x80, 0xF7, 0x2F, 0x19, 0x60, 0x2F, 0x1A, 0xC0, 0x64, 0xC1,
+0x60, 0xF1, 0x2F, 0x1D, 0x60, 0x80, 0x40, 0x50, 0xE0, 0x60, 0xF0, 0x2A, 0xF0, 0x61, 0xF0, 0x22,
+0xF3, 0x60, 0xA0, 0x50, 0x07, 0xB0, 0x90, 0x08, 0x50, 0xB0, 0x08, 0x40, 0x02, 0xE0, 0x50, 0x07,
+0xA0, 0xF0, 0x21, 0xF1, 0xC0, 0x60, 0xC0, 0x27, 0xF0, 0xD0, 0x60, 0x20, 0xF0, 0x60, 0xC1, 0x61,
+0xC0, 0x2F, 0x1B, 0xF2, 0xC3, 0x63, 0xC0, 0x2F, 0x0E, 0xF1, 0xA0, 0x08, 0x50, 0xE0, 0x30, 0x0F,
+0x18, 0xB0, 0x90, 0x40, 0x04, 0x70, 0x92, 0xA0, 0x09, 0x09, 0xB0, 0x80, 0x01, 0x50, 0x80, 0xF0,
+0x2F, 0x20, 0x60, 0x2F, 0x11, 0xF1, 0x20, 0xC1, 0x63, 0xC1, 0x21, 0xF1, 0x20, 0xF0, 0x60, 0xF0,
+0x2F, 0x19, 0xF0, 0x20, 0x62, 0xF0, 0x70, 0x01, 0xB0, 0x80, 0xF1, 0x26, 0xF1, 0x61, 0x20, 0xF0,
+0x21, 0xF2, 0x60, 0x70, 0x60, 0x70, 0x09, 0x40, 0x09, 0x50, 0xB0, 0x08, 0x90, 0x50, 0x01, 0x80,
+0xB0, 0x07, 0x50, 0x70, 0xF0, 0x20, 0xF1, 0x21, 0xC0, 0x60, 0xC0, 0xF0, 0x25, 0xF2, 0x20, 0x60,
+0x21, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x19, 0xF0, 0xC1, 0xF0, 0x21, 0xF1, 0x20, 0xC0,
+0x64, 0xC1, 0xF2, 0x20, 0xF1, 0x2F, 0x02, 0xF0, 0xA0, 0x02, 0x90, 0x04, 0x50, 0xE0, 0xA0, 0x50,
+0x0F, 0x1F, 0x70, 0x02, 0x30, 0x09, 0x09, 0xB0, 0x80, 0x01, 0x50, 0x30, 0xF0, 0x2F, 0x20, 0xC0,
+0x2F, 0x0E, 0xC1, 0x63, 0xC1, 0xF4, 0x26, 0xC1, 0x2F, 0x18, 0xC0, 0x61, 0xC0, 0xF1, 0x80, 0xE0,
+0x02, 0xE0, 0x60, 0xF3, 0x20, 0xF2, 0xC0, 0x60, 0xC0, 0xF0, 0x22, 0xF0, 0x60, 0xA0, 0x70, 0x30,
+0x50, 0x80, 0xB0, 0x08, 0x51, 0x09, 0x50, 0xB0, 0x09, 0x40, 0x01, 0x30, 0xB0, 0x08, 0x40, 0x70,
+0x60, 0xF0, 0x22, 0xF1, 0x61, 0x28, 0x60, 0xC0, 0x24, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x17,
+0xF0, 0x60, 0xF0, 0x25, 0xF3, 0x21, 0xC1, 0x62, 0xC2, 0x2F, 0x01, 0xF1, 0x30, 0x01, 0x50, 0x10,
+0xB0, 0x03, 0x40, 0x01, 0x30, 0x80, 0x0F, 0x1E, 0xA0, 0x01, 0xB0, 0x80, 0x09, 0x0A, 0x70, 0xA0,
+0x32, 0xF0, 0x2F, 0x20, 0xC1, 0xF0, 0x2F, 0x01, 0xF4, 0x20, 0xC1, 0x62, 0xC2, 0x2F, 0x02, 0x60,
+0x2F, 0x15, 0xC0, 0x61, 0xC0, 0x22, 0xF1, 0x70, 0x03, 0xB0, 0xA0, 0x30, 0xC1, 0x62, 0xF0, 0x81,
+0xF0, 0x23, 0xF0, 0xC0, 0xA0, 0xB0, 0x0D, 0x90, 0x0A, 0x90, 0xB0, 0x09, 0x50, 0x90, 0x00, 0x40,
+0x90, 0x09, 0x50, 0x30, 0xF0, 0x26, 0x61, 0xF1, 0x23, 0xF0, 0x60, 0x29, 0xC0, 0x61, 0xC0, 0x2F,
+0x16, 0x60, 0xF0, 0x2F, 0x01, 0xC1, 0x63, 0xC1, 0x20, 0xF3, 0x26, 0xF0, 0x60, 0xE0, 0x01, 0xB0,
+0xD0, 0x90, 0x03, 0x40, 0x02, 0x50, 0xA0, 0x90, 0x0F, 0x1B, 0xB0, 0xD0, 0xE0, 0x30, 0x70, 0xE0,
+0x09, 0x0A, 0x30, 0x02, 0xA0, 0xF0, 0x2F, 0x20, 0xC1, 0xF0, 0x2E, 0xF0, 0x20, 0xC0, 0x64, 0xC1,
+0x20, 0xF2, 0x2F, 0x03, 0xF0, 0x60, 0xF0, 0x2F, 0x12, 0x61, 0xC0, 0x25, 0xF0, 0x60, 0xE0, 0x04,
+0x91, 0x81, 0xE0, 0x80, 0xA1, 0xE0, 0x10, 0x60, 0xF3, 0x80, 0x70, 0x50, 0x0D, 0x90, 0x50, 0x0A,
+0x50, 0xB0, 0x0A, 0x40, 0x00, 0x40, 0x90, 0x0A, 0xA0, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0xC0, 0xF0,
+0x22, 0xC1, 0xF0, 0x28, 0xF2, 0xC0, 0x61, 0xC0, 0xF1, 0x2F, 0x11, 0x60, 0xF0, 0x2F, 0x01, 0xF4,
+0xC2, 0x63, 0xC0, 0x20, 0xF1, 0x22, 0xF1, 0x30, 0x50, 0x02, 0x10, 0x90, 0x03, 0x90, 0x04, 0xE0,
+0x30, 0x0F, 0x1A, 0x90, 0xA0, 0x01, 0x90, 0x40, 0x09, 0x0A, 0xA0, 0x02, 0xA0, 0xF0, 0x2F, 0x21,
+0x60, 0xF0, 0x25, 0xF3, 0x21, 0xC0, 0x64, 0xC0, 0x2F, 0x0D, 0xF0, 0x60, 0x2F, 0x0E, 0xF0, 0x20,
+0x62, 0xC0, 0xF1, 0x25, 0xF0, 0x70, 0x05, 0xB0, 0x50, 0x01, 0x50, 0x90, 0x02, 0xB0, 0x31, 0x70,
+0xA1, 0xE0, 0x0F, 0x00, 0x40, 0x0B, 0x50, 0xB0, 0x0B, 0x40, 0x50, 0x30, 0x0A, 0xA0, 0xC0, 0x29,
+0xC0, 0x60, 0xC0, 0xF1, 0x60, 0xF0, 0x2D, 0xF1, 0xC0, 0x61, 0xC0, 0xF1, 0x2F, 0x0D, 0x60, 0xC0,
+0x2F, 0x0D, 0xC1, 0x64, 0xC1, 0xF0, 0x70, 0x03, 0xA0, 0x30, 0x02, 0xB0, 0x90, 0x04, 0xB0, 0xA0,
+0x0F, 0x1A, 0x40, 0x80, 0x01, 0xE0, 0x50, 0x09, 0x0A, 0xA0, 0x50, 0x40, 0xE0, 0x70, 0xF0, 0x2F,
+0x21, 0x60, 0xF1, 0x24, 0xC1, 0x63, 0xC1, 0xF2, 0x2F, 0x0B, 0xC0, 0xF0, 0x21, 0xF0, 0xC1, 0x2F,
+0x0A, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0xF2, 0x26, 0xF0, 0x30, 0x90, 0x06, 0x90, 0x50, 0x40, 0x50,
+0x06, 0x50, 0xA0, 0x0F, 0x01, 0x40, 0x0C, 0x50, 0xB0, 0x0B, 0x90, 0x40, 0xE0, 0x09, 0x50, 0x30,
+0xF0, 0x2A, 0xF0, 0x60, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x00, 0xF1, 0x20, 0xC0, 0x61, 0xC0, 0x2F,
+0x0C, 0x60, 0xF0, 0x2F, 0x10, 0xF2, 0xC2, 0x30, 0x80, 0x52, 0x05, 0xB0, 0x50, 0x04, 0x30, 0xB0,
+0x0F, 0x1A, 0xE0, 0x70, 0x40, 0x90, 0x30, 0xB0, 0x09, 0x0A, 0x80, 0xE0, 0x90, 0x50, 0xA0, 0xF0,
+0x2F, 0x1F, 0xF1, 0x60, 0xC2, 0x62, 0xC2, 0x2F, 0x13, 0xA0, 0xD0, 0x30, 0xF0, 0x20, 0xF0, 0xC0,
+0x60, 0xF0, 0x2F, 0x06, 0xF1, 0xC0, 0x61, 0xC0, 0x2B, 0xF0, 0x60, 0x80, 0x06, 0xB0, 0x40, 0xE0,
+0x09, 0x50, 0x30, 0x0E, 0xB0, 0x90, 0x0C, 0x50, 0xB0, 0x0C, 0x30, 0x50, 0x09, 0x30, 0x60, 0x70,
+0xF0, 0x2A, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x03, 0xF0, 0x21, 0x61, 0xC0, 0x2F, 0x09, 0xF0,
+0x60, 0xF1, 0x2F, 0x0A, 0xF2, 0x22, 0xF0, 0xC1, 0xF0, 0x30, 0x80, 0xB1, 0x51, 0x90, 0x40, 0x90,
+0x51, 0x00, 0x51, 0x04, 0x30, 0x0F, 0x1B, 0xE0, 0x40, 0x50, 0x90, 0x70, 0xB0, 0x00, 0xB0, 0x07,
+0x0A, 0xE0, 0x50, 0x01, 0x30, 0xC0, 0x2F, 0x1E, 0xC0, 0x63, 0xC2, 0xF3, 0x2F, 0x13, 0xF0, 0xC0,
+0x30, 0x70, 0x20, 0xC0, 0x62, 0xF0, 0x2F, 0x04, 0xF0, 0x20, 0x61, 0xC0, 0xF1, 0x2A, 0xF2, 0x70,
+0x06, 0x90, 0x40, 0xB0, 0x90, 0xB0, 0x09, 0xA0, 0x0E, 0x40, 0x0D, 0x50, 0xB0, 0x0C, 0xE0, 0x50,
+0x08, 0x40, 0x30, 0x70, 0x80, 0xF0, 0x2A, 0xF0, 0x60, 0xC1, 0x60, 0x2F, 0x06, 0xF1, 0xC0, 0x61,
+0xC0, 0xF0, 0x22, 0xF0, 0x2F, 0x01, 0xC0, 0x62, 0x2F, 0x06, 0xF3, 0x80, 0x70, 0xF3, 0x80, 0x11,
+0xA0, 0x40, 0x07, 0xB0, 0x51, 0x42, 0x50, 0xB0, 0x00, 0x90, 0x30, 0x0F, 0x1B, 0xA0, 0xB0, 0x01,
+0x80, 0x50, 0x80, 0x30, 0x50, 0x06, 0x0A, 0x50, 0xE0, 0x01, 0xE0, 0x60, 0x2F, 0x14, 0xF2, 0x20,
+0xC0, 0x64, 0xC0, 0x21, 0xC1, 0x2F, 0x18, 0xF2, 0xC2, 0x60, 0xC0, 0x20, 0xF0, 0x60, 0x2F, 0x01,
+0xF1, 0x20, 0x62, 0x20, 0xF0, 0x2C, 0xF1, 0x60, 0xD0, 0x05, 0x50, 0x40, 0xB0, 0x02, 0x40, 0x09,
+0xA0, 0x0D, 0x51, 0x0D, 0x50, 0xB0, 0x0B, 0x90, 0x30, 0x40, 0x07, 0x80, 0xA0, 0xF2, 0x2A, 0xF0,
+0xC0, 0x60, 0xF0, 0x20, 0xF0, 0x61, 0xC0, 0xF0, 0x2F, 0x07, 0xC0, 0x61, 0xC0, 0xF0, 0x2F, 0x02,
+0xC1, 0xF0, 0xC1, 0x62, 0x20, 0xF2, 0x25, 0xF0, 0x24, 0xF1, 0x70, 0x10, 0x80, 0x30, 0x70, 0xD1,
+0x10, 0x80, 0xA0, 0x10, 0xA0, 0xB0, 0x0C, 0x40, 0x01, 0xB0, 0x40, 0x70, 0xE0, 0x92, 0xB0, 0x0F,
+0x18, 0x10, 0xB0, 0x01, 0x30, 0xB0, 0x80, 0xE0, 0x90, 0x06, 0x0B, 0xD0, 0x30, 0xA1, 0x80, 0xF0,
+0x2F, 0x11, 0xC1, 0x63, 0xC0, 0x21, 0xF3, 0x21, 0xC0, 0x60, 0x2F, 0x17, 0xC0, 0x62, 0xC0, 0xF2,
+0x21, 0xF0, 0xC1, 0x2F, 0x00, 0xC0, 0x61, 0xC0, 0x2C, 0xF2, 0xC0, 0x80, 0xA0, 0x80, 0x04, 0x50,
+0x40, 0x50, 0x04, 0xB0, 0x90, 0x08, 0xA0, 0x0D, 0x40, 0x0E, 0x50, 0xB0, 0x0A, 0x40, 0x30, 0x00,
+0xB0, 0x90, 0x05, 0xA0, 0x80, 0xF0, 0x2D, 0xF0, 0x60, 0xF0, 0x24, 0x61, 0x2F, 0x08, 0xF1, 0xC0,
+0x60, 0xC0, 0x20, 0xF2, 0x2C, 0x60, 0x20, 0xF4, 0xC0, 0x62, 0xC0, 0x20, 0xF2, 0x25, 0xF0, 0xC0,
+0xA0, 0x10, 0xD0, 0x03, 0x30, 0xD0, 0x10, 0x40, 0xE0, 0xB0, 0x0E, 0x40, 0x01, 0xB0, 0xA0, 0xB0,
+0x02, 0xB0, 0x50, 0x41, 0x90, 0x51, 0xB0, 0x0F, 0x12, 0x10, 0x30, 0xA0, 0x80, 0xA0, 0x00, 0xB0,
+0x50, 0x07, 0x07, 0xB0, 0x30, 0x50, 0x00, 0xA0, 0x02, 0x70, 0xF0, 0x2F, 0x06, 0xF3, 0x20, 0xC2,
+0x62, 0xC1, 0x22, 0xF0, 0x28, 0xF0, 0x60, 0xF0, 0x2F, 0x0F, 0xF2, 0x20, 0xC0, 0x61, 0xC1, 0x20,
+0xF1, 0x26, 0x60, 0xF0, 0x29, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2B, 0xF1, 0x60, 0x80,
+0xA0, 0x30, 0x40, 0x05, 0x91, 0x07, 0x90, 0xB0, 0x07, 0x30, 0x0C, 0x90, 0xB0, 0x0E, 0x50, 0xB0,
+0x09, 0x50, 0x70, 0x02, 0x40, 0x04, 0x90, 0x30, 0xF0, 0x20, 0xF1, 0x2B, 0x60, 0x20, 0xF0, 0x23,
+0xF1, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x04, 0xF0, 0x21, 0xF0, 0xC0, 0x80, 0x30, 0x81, 0xC2, 0xF0,
+0x29, 0x60, 0xF1, 0x27, 0xC0, 0x61, 0xC1, 0x20, 0xF0, 0x21, 0xF2, 0x80, 0xE0, 0x50, 0x06, 0x81,
+0x0F, 0x00, 0xB0, 0x90, 0x01, 0x40, 0x90, 0x08, 0xB0, 0x51, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x0F,
+0x0D, 0x70, 0x01, 0x50, 0x80, 0x00, 0xB0, 0x91, 0xB0, 0x05, 0x03, 0xA1, 0xB0, 0x01, 0x40, 0x70,
+0x00, 0x30, 0x02, 0xA0, 0xF0, 0x2F, 0x06, 0xC1, 0x62, 0xC2, 0xF2, 0x2E, 0xF0, 0x60, 0xF0, 0x2F,
+0x0F, 0xC0, 0x62, 0xC0, 0x20, 0xF0, 0x2A, 0xF0, 0x60, 0xF0, 0x27, 0xF0, 0x20, 0x61, 0xC0, 0x2F,
+0x00, 0xF0, 0xC0, 0x70, 0x80, 0x50, 0x06, 0x90, 0x40, 0xB0, 0x09, 0x40, 0x07, 0xA0, 0x0C, 0x40,
+0x0F, 0x00, 0x50, 0xB0, 0x09, 0xA0, 0x04, 0x40, 0x03, 0xB0, 0xA0, 0xF1, 0x81, 0x29, 0xF0, 0xC0,
+0x60, 0xF0, 0x26, 0xF1, 0xC0, 0x60, 0xC0, 0xF2, 0x2F, 0x01, 0xF1, 0x60, 0x70, 0x90, 0x50, 0xB0,
+0x50, 0x40, 0xA1, 0x60, 0xF1, 0x24, 0xF1, 0xC1, 0x29, 0xF2, 0xC0, 0x63, 0xC0, 0xF1, 0xA0, 0x60,
+0x09, 0x10, 0x0F, 0x00, 0x50, 0xB0, 0x01, 0x80, 0x50, 0x0E, 0xB0, 0x50, 0x90, 0x42, 0x50, 0xB0,
+0x0F, 0x06, 0x50, 0x30, 0x01, 0x90, 0x41, 0xD0, 0x30, 0xA0, 0xD0, 0x70, 0xB0, 0x03, 0x03, 0x80,
+0x30, 0xD0, 0x90, 0x01, 0x80, 0x50, 0x80, 0x90, 0x40, 0x80, 0x70, 0xC0, 0xF0, 0x2C, 0xF0, 0x20,
+0xC0, 0x64, 0xC1, 0x20, 0xF0, 0x2F, 0x06, 0xF0, 0x60, 0x2F, 0x09, 0xF2, 0xC0, 0x62, 0xC0, 0x20,
+0xF1, 0x2E, 0xC1, 0xF0, 0x23, 0xF0, 0x20, 0x62, 0x20, 0xF0, 0x2F, 0x00, 0xF0, 0xC0, 0x70, 0xB0,
+0x06, 0x50, 0xE0, 0x50, 0x0C, 0x40, 0x06, 0x70, 0x0B, 0x40, 0x0F, 0x01, 0x50, 0xB0, 0x09, 0xA0,
+0x04, 0x90, 0xB0, 0x03, 0x90, 0x70, 0x60, 0x70, 0xD0, 0x60, 0xF0, 0x27, 0xC0, 0x60, 0xF0, 0x29,
+0xF0, 0x20, 0x61, 0xC0, 0xF0, 0x2F, 0x00, 0xF0, 0x80, 0xA0, 0x80, 0x06, 0x50, 0xA0, 0xC1, 0xF6,
+0x60, 0x2F, 0x02, 0xC0, 0x61, 0x81, 0x0A, 0x10, 0xB0, 0x0E, 0x90, 0xB0, 0x00, 0xB0, 0xA0, 0x0F,
+0x06, 0xB0, 0x90, 0x41, 0x91, 0x50, 0xB0, 0x0F, 0x00, 0xE0, 0xD0, 0xE0, 0x50, 0x30, 0xB0, 0xA0,
+0x03, 0x90, 0xD0, 0x03, 0x03, 0x40, 0xE0, 0x00, 0x70, 0x30, 0x40, 0xD0, 0x00, 0xE0, 0x30, 0x90,
+0xB0, 0x30, 0xC0, 0xF0, 0x28, 0xC1, 0x63, 0xC1, 0x20, 0xF2, 0x2F, 0x0B, 0xC1, 0x2F, 0x07, 0xC1,
+0x61, 0xC1, 0xF1, 0x2F, 0x04, 0x60, 0xF0, 0x22, 0xC0, 0x61, 0xC0, 0xF1, 0x2F, 0x01, 0xF0, 0x60,
+0xA0, 0xB0, 0x05, 0xB0, 0x40, 0x50, 0x0E, 0x90, 0x40, 0x05, 0x30, 0xB0, 0x09, 0xB0, 0x90, 0x0F,
+0x01, 0x50, 0xB0, 0x09, 0x80, 0x50, 0x04, 0x40, 0x04, 0xB0, 0xE0, 0xD0, 0x70, 0x30, 0xF0, 0x27,
+0x60, 0xC0, 0xF0, 0x2B, 0xF0, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x2C, 0xF0, 0xA0, 0xE0, 0x09, 0x80,
+0xA0, 0x80, 0x60, 0x30, 0x60, 0x80, 0xA1, 0x70, 0x60, 0xF2, 0xC3, 0x62, 0xC0, 0xF8, 0x81, 0x00,
+0x90, 0x40, 0x90, 0x50, 0xB0, 0x05, 0x40, 0x10, 0x90, 0x0A, 0x50, 0x01, 0x90, 0x01, 0xA0, 0xB0,
+0x0F, 0x0C, 0x50, 0x90, 0x41, 0x90, 0x51, 0xB0, 0x09, 0x30, 0x90, 0x50, 0x40, 0xD0, 0x00, 0x30,
+0x80, 0xB0, 0x02, 0xD0, 0x03, 0x03, 0x50, 0xA0, 0x01, 0x40, 0x30, 0x50, 0x00, 0x40, 0x50, 0x01,
+0xE0, 0xC0, 0xF2, 0x21, 0xC1, 0x62, 0xC1, 0x2F, 0x16, 0x60, 0x2F, 0x02, 0xF0, 0x20, 0xC0, 0x61,
+0xC1, 0x20, 0xF2, 0x2F, 0x05, 0xF0, 0x60, 0xF0, 0xC0, 0x61, 0xC0, 0x2F, 0x05, 0xF0, 0x81, 0x06,
+0x91, 0x0F, 0x00, 0x91, 0x51, 0x04, 0xA0, 0x0A, 0x40, 0x0F, 0x02, 0x50, 0xB0, 0x09, 0xB0, 0x30,
+0x04, 0x51, 0x05, 0x50, 0xB0, 0xA0, 0x60, 0xF1, 0x23, 0xF0, 0x60, 0xC0, 0x60, 0xC0, 0xF0, 0x2C,
+0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2A, 0xF0, 0xA0, 0x90, 0x0E, 0xB0, 0x90, 0xE0, 0x90, 0x00, 0x50,
+0xA0, 0xF0, 0x60, 0xA0, 0x80, 0x31, 0x83, 0x70, 0x30, 0x70, 0x30, 0x80, 0xA2, 0x60, 0x30, 0x80,
+0x03, 0xB0, 0x50, 0x90, 0x40, 0x90, 0xB0, 0x03, 0x50, 0x70, 0x09, 0xB0, 0xD0, 0x90, 0xE0, 0x80,
+0xA0, 0x30, 0x40, 0x0F, 0x12, 0xB0, 0x50, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x04, 0x70, 0x02, 0x30,
+0x01, 0x80, 0x70, 0xA1, 0x70, 0xE0, 0x03, 0x04, 0x50, 0x01, 0x50, 0x40, 0x50, 0x00, 0x50, 0xE0,
+0x00, 0x90, 0xA0, 0x80, 0xC0, 0x63, 0xC1, 0x20, 0xF4, 0x2F, 0x15, 0x60, 0x2F, 0x00, 0xC0, 0x62,
+0xC0, 0x20, 0xF1, 0x2F, 0x0B, 0x61, 0xC1, 0xF1, 0x2F, 0x05, 0xC0, 0xA0, 0x05, 0x50, 0x40, 0xB0,
+0x0F, 0x00, 0x40, 0x50, 0x01, 0x90, 0x50, 0x03, 0x30, 0x50, 0x08, 0x51, 0x0F, 0x02, 0x50, 0xB0,
+0x0A, 0xA0, 0x05, 0x40, 0x07, 0x40, 0x71, 0x30, 0xC0, 0xF2, 0x60, 0xF2, 0x60, 0xC0, 0xF0, 0x2D,
+0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x26, 0xF0, 0x30, 0x40, 0x0F, 0x03, 0xB0, 0x90, 0xE0, 0x71, 0x80,
+0x08, 0x50, 0x00, 0x90, 0x50, 0x01, 0x50, 0xE0, 0x90, 0x08, 0xB0, 0x50, 0x90, 0x40, 0x90, 0x01,
+0xD0, 0x50, 0x08, 0x40, 0xD0, 0xE0, 0x91, 0x0F, 0x1A, 0xB0, 0x50, 0x91, 0x41, 0x90, 0x50, 0xD0,
+0x40, 0x50, 0x00, 0x30, 0x00, 0x30, 0x71, 0xA0, 0x40, 0x05, 0x05, 0xA0, 0x11, 0x31, 0xA0, 0x00,
+0x13, 0xA0, 0xF0, 0x2F, 0x21, 0x60, 0x2A, 0xF0, 0xC0, 0x62, 0xC0, 0x20, 0xF0, 0x2F, 0x0A, 0xF1,
+0xC1, 0x61, 0xC0, 0x60, 0xF0, 0x2F, 0x08, 0xC0, 0x80, 0x03, 0x50, 0x40, 0x50, 0x0F, 0x01, 0x40,
+0xB0, 0x03, 0x90, 0x50, 0x03, 0xA0, 0x08, 0x40, 0x0F, 0x03, 0x50, 0xB0, 0x0A, 0x50, 0x70, 0x40,
+0x03, 0xB0, 0x90, 0x08, 0xA0, 0x50, 0x30, 0xA0, 0x62, 0xA3, 0x70, 0x60, 0xC0, 0xF1, 0x2D, 0x61,
+0xF1, 0x24, 0xF0, 0xC0, 0x30, 0x0F, 0x06, 0xA0, 0x51, 0x90, 0x50, 0x0F, 0x0E, 0xB0, 0x90, 0xE0,
+0x30, 0xA0, 0x08, 0xE0, 0x70, 0xB0, 0x50, 0xB0, 0x0F, 0x20, 0xB0, 0x50, 0x13, 0xE0, 0x30, 0xE0,
+0x00, 0x50, 0x40, 0xD0, 0xE0, 0x04, 0x04, 0x81, 0x00, 0xB0, 0x30, 0x00, 0xA0, 0xB0, 0x70, 0xE0,
+0x50, 0x00, 0xA0, 0xF0, 0x2F, 0x21, 0xC1, 0xF0, 0x22, 0xF2, 0xC1, 0x61, 0xC0, 0x20, 0xF1, 0x2F,
+0x0D, 0xC0, 0x61, 0xC0, 0x20, 0xF1, 0x60, 0x2F, 0x07, 0xF1, 0xA0, 0x50, 0x01, 0xB0, 0x40, 0x50,
+0x0F, 0x01, 0xB0, 0x40, 0x06, 0x90, 0x50, 0x02, 0xA0, 0x07, 0x90, 0xB0, 0x0F, 0x03, 0x50, 0xB0,
+0x0C, 0x80, 0x90, 0x03, 0x90, 0xB0, 0x07, 0xA0, 0x01, 0xB0, 0x82, 0x50, 0x01, 0xB0, 0x00, 0x40,
+0xA0, 0x30, 0x60, 0xC1, 0xF1, 0x29, 0xF0, 0x20, 0x60, 0xC0, 0x24, 0xF0, 0x30, 0x50, 0x0F, 0x05,
+0x50, 0x30, 0x02, 0x50, 0x40, 0x90, 0xB0, 0x0F, 0x0D, 0x50, 0xA0, 0xE0, 0x30, 0x91, 0x50, 0xB0,
+0x03, 0x40, 0x70, 0x50, 0x90, 0x0F, 0x22, 0xB0, 0x30, 0x00, 0x90, 0x30, 0x40, 0xA0, 0xB0, 0x03,
+0x70, 0x04, 0x04, 0x80, 0x90, 0x01, 0x70, 0x50, 0xD0, 0x00, 0x80, 0x02, 0xA0, 0xF0, 0x2F, 0x20,
+0xF0, 0xC0, 0x60, 0xF2, 0x20, 0xC0, 0x62, 0xC0, 0x2F, 0x0E, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0x24,
+0xF0, 0xC1, 0xF0, 0x2F, 0x05, 0xF0, 0xA0, 0x90, 0x01, 0x91, 0xB0, 0x0F, 0x01, 0x50, 0x40, 0x08,
+0x90, 0x50, 0x01, 0x40, 0x30, 0x05, 0xB0, 0x90, 0x0F, 0x04, 0x50, 0xB0, 0x0D, 0xA0, 0x04, 0x40,
+0x07, 0xA0, 0x01, 0x40, 0xB0, 0x07, 0xB0, 0x80, 0xE0, 0x80, 0x31, 0xF1, 0x2A, 0xF0, 0xC0, 0x60,
+0xC0, 0x22, 0xF0, 0xA0, 0xB0, 0x0F, 0x05, 0x40, 0x90, 0xE0, 0x03, 0xB0, 0x50, 0x40, 0x50, 0xB0,
+0x0F, 0x0B, 0x90, 0xA1, 0x40, 0x00, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x00, 0x90, 0x70, 0x40, 0x90,
+0x0F, 0x22, 0xE1, 0x01, 0x40, 0x91, 0xD0, 0x80, 0x50, 0xB0, 0x90, 0xA0, 0x04, 0x04, 0x50, 0xD0,
+0xA0, 0xD0, 0x40, 0xB0, 0x90, 0x00, 0xE0, 0x90, 0x50, 0xE0, 0xD0, 0xC0, 0x2F, 0x20, 0xF1, 0x60,
+0xC0, 0x62, 0xC0, 0x20, 0xF2, 0x2F, 0x0C, 0xF0, 0xC0, 0x62, 0xC0, 0xF1, 0x26, 0x60, 0xF0, 0x2F,
+0x04, 0xF0, 0xA0, 0x90, 0x00, 0x50, 0x40, 0xB0, 0x0F, 0x02, 0x91, 0x0A, 0x50, 0x90, 0x01, 0xA0,
+0xE0, 0x04, 0x40, 0x0F, 0x05, 0x50, 0xB0, 0x0D, 0xA0, 0x04, 0x90, 0xB0, 0x06, 0xA0, 0x90, 0x40,
+0x0A, 0xB0, 0x40, 0x01, 0xE0, 0x60, 0xF0, 0x2D, 0xC0, 0x60, 0x20, 0xF1, 0x80, 0x90, 0x0F, 0x04,
+0xB0, 0x50, 0x00, 0xA0, 0xB0, 0x05, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x0A, 0x50, 0x30, 0x80, 0xA0,
+0x02, 0xB0, 0x50, 0x90, 0xE0, 0x30, 0xE0, 0x50, 0x0F, 0x22, 0xA0, 0x70, 0x40, 0x00, 0x30, 0xB0,
+0x00, 0xB0, 0x80, 0x71, 0xA0, 0xB0, 0x04, 0x06, 0x40, 0x30, 0x70, 0xD0, 0x70, 0x51, 0xD0, 0xE0,
+0x50, 0x40, 0x60, 0xF0, 0x2F, 0x1C, 0xF1, 0xC0, 0x62, 0xC0, 0x2F, 0x11, 0xF0, 0x20, 0xC0, 0x61,
+0x20, 0xF0, 0x20, 0xF0, 0x27, 0xF0, 0x60, 0xC0, 0x2F, 0x03, 0xF0, 0x60, 0x80, 0xB0, 0x40, 0x50,
+0x0F, 0x03, 0x40, 0x50, 0x07, 0xB0, 0x90, 0xE0, 0x91, 0x50, 0x90, 0x50, 0x30, 0x04, 0x50, 0x90,
+0x0F, 0x05, 0x50, 0xB0, 0x0D, 0xB0, 0x70, 0x90, 0x03, 0x40, 0x04, 0x90, 0xA0, 0xE0, 0x91, 0xB0,
+0x0B, 0x40, 0xB1, 0x30, 0xF0, 0x2D, 0xF0, 0x20, 0x61, 0xF1, 0xA0, 0x0F, 0x04, 0x40, 0x01, 0xE0,
+0x50, 0x08, 0x50, 0x40, 0x90, 0x50, 0x0C, 0x30, 0x10, 0x50, 0x07, 0x70, 0x50, 0xE0, 0x80, 0x04,
+0x90, 0x30, 0x80, 0x91, 0x50, 0x0F, 0x20, 0xA0, 0x00, 0x90, 0x30, 0xD0, 0x0C, 0x05, 0x90, 0xD0,
+0xE0, 0xB0, 0x00, 0xB0, 0x70, 0x50, 0xE0, 0x01, 0x50, 0x80, 0xF0, 0x2F, 0x1B, 0xC0, 0x62, 0xC0,
+0xF0, 0xC1, 0xF0, 0x2F, 0x0D, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0xF1, 0x2D, 0x60, 0xF0, 0x2F, 0x02,
+0xF0, 0x30, 0x40, 0x50, 0x0F, 0x04, 0x40, 0xB0, 0x07, 0x40, 0x30, 0x40, 0x50, 0xE0, 0x80, 0xA0,
+0x31, 0x40, 0x04, 0x40, 0x0F, 0x06, 0x50, 0xB0, 0x0F, 0x00, 0x80, 0x30, 0x02, 0x50, 0x90, 0x02,
+0xE0, 0x80, 0x90, 0x50, 0x01, 0x40, 0x0C, 0x90, 0x50, 0xA0, 0xF0, 0x2F, 0x00, 0xF0, 0x20, 0x60,
+0xC0, 0x60, 0x80, 0x0F, 0x02, 0xB0, 0x90, 0x01, 0x80, 0x50, 0x0B, 0x50, 0x40, 0x90, 0xB0, 0x09,
+0xE0, 0x09, 0x90, 0xA0, 0x90, 0x70, 0x04, 0xE0, 0x80, 0x30, 0xB0, 0xE0, 0x50, 0x90, 0x40, 0x90,
+0x50, 0xB0, 0x0F, 0x1A, 0xB0, 0xD0, 0x01, 0xB0, 0x80, 0x50, 0xD0, 0x30, 0x40, 0x90, 0xB0, 0x06,
+0x05, 0x30, 0x50, 0x03, 0x70, 0x00, 0x30, 0x01, 0x50, 0xA0, 0xF0, 0x2F, 0x14, 0xF1, 0x20, 0xC0,
+0x62, 0xC0, 0x20, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0xC0, 0x61, 0xC0,
+0x2F, 0x02, 0xF0, 0x60, 0x20, 0xF0, 0x2E, 0xF0, 0x20, 0xC0, 0xA0, 0x0F, 0x04, 0xB0, 0x40, 0xB0,
+0x04, 0x50, 0x40, 0x90, 0xE0, 0x70, 0x01, 0x51, 0x03, 0x91, 0x02, 0x51, 0x0F, 0x06, 0x50, 0xB0,
+0x0F, 0x01, 0x40, 0xE0, 0x02, 0x40, 0x01, 0xE0, 0x30, 0x90, 0xB0, 0x03, 0x40, 0x0C, 0x50, 0x81,
+0xF1, 0x2F, 0x00, 0xF0, 0xC0, 0x60, 0xA0, 0x0F, 0x02, 0x90, 0xB0, 0x01, 0x30, 0x0E, 0xB0, 0x90,
+0x40, 0x50, 0x0F, 0x04, 0x90, 0xA0, 0x40, 0xA0, 0x90, 0x02, 0x50, 0xA1, 0x30, 0x80, 0xA0, 0xB0,
+0x00, 0xB0, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x0F, 0x17, 0x50, 0x70, 0x01, 0x50, 0xE0, 0x00, 0x70,
+0x81, 0xA0, 0xD0, 0x70, 0xB0, 0x04, 0x05, 0xE0, 0x30, 0xB0, 0x50, 0xE0, 0x70, 0x30, 0x00, 0x30,
+0xA0, 0x30, 0x80, 0x70, 0xF0, 0x2F, 0x10, 0xF0, 0x22, 0x62, 0xC0, 0x20, 0xF2, 0x25, 0x60, 0xF0,
+0x2F, 0x08, 0xF0, 0x20, 0x62, 0xF1, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xF0, 0x2C, 0xF1, 0xC0, 0x60,
+0xC0, 0xA0, 0x0F, 0x03, 0xB0, 0x40, 0x06, 0xA0, 0x41, 0x50, 0x01, 0xB0, 0x40, 0x05, 0xB0, 0x40,
+0xB0, 0x00, 0x40, 0x0F, 0x07, 0x50, 0xB0, 0x0F, 0x02, 0xA0, 0x02, 0xB0, 0x90, 0x50, 0xA0, 0x90,
+0x05, 0xB0, 0x40, 0x0C, 0xB0, 0x30, 0xA0, 0xC1, 0xF0, 0xC2, 0xF4, 0x26, 0xF0, 0xC0, 0x30, 0x40,
+0x0F, 0x01, 0xE0, 0x01, 0x50, 0x80, 0x0F, 0x02, 0x50, 0x90, 0x40, 0x50, 0x0F, 0x02, 0xB0, 0x70,
+0x90, 0x80, 0x30, 0x02, 0x70, 0xC0, 0xF1, 0xC0, 0x70, 0xB0, 0x03, 0xB0, 0x91, 0x40, 0x50, 0x0F,
+0x14, 0x40, 0xA0, 0x80, 0xA0, 0x70, 0x50, 0x00, 0x90, 0x80, 0x02, 0xB0, 0x05, 0x06, 0xE0, 0x71,
+0x80, 0x50, 0x01, 0x40, 0x90, 0x01, 0x80, 0x60, 0xF0, 0x2F, 0x0B, 0xF2, 0xC0, 0x63, 0x2D, 0x60,
+0xC0, 0x2F, 0x04, 0xF1, 0x20, 0xC0, 0x61, 0x2F, 0x05, 0xF1, 0xC0, 0x62, 0xF0, 0x2B, 0xF0, 0xC0,
+0x60, 0xC0, 0x20, 0x60, 0x80, 0x0F, 0x02, 0x50, 0x40, 0x07, 0x70, 0x03, 0xB0, 0x40, 0x08, 0x90,
+0xE0, 0xB0, 0x0F, 0x07, 0x50, 0xB0, 0x0F, 0x02, 0x30, 0xB0, 0x02, 0xE0, 0x80, 0xB0, 0x07, 0x50,
+0x40, 0x0D, 0xE0, 0x80, 0x31, 0x81, 0x31, 0xA1, 0x60, 0xF1, 0x25, 0xF0, 0x80, 0x90, 0x00, 0x40,
+0x90, 0x0D, 0x90, 0x50, 0x40, 0x90, 0x00, 0x30, 0xB0, 0x0F, 0x04, 0x50, 0x41, 0x50, 0x0F, 0x01,
+0xA1, 0xE0, 0x70, 0x80, 0x30, 0x80, 0xF0, 0x21, 0xF1, 0x70, 0xB0, 0x06, 0xB0, 0x90, 0x40, 0x90,
+0x50, 0x0F, 0x10, 0xA0, 0x50, 0x01, 0x30, 0xB0, 0x0C, 0x0A, 0x50, 0x30, 0x90, 0x50, 0xE0, 0x01,
+0x90, 0x80, 0xF0, 0x2F, 0x08, 0xF0, 0x20, 0xC1, 0x62, 0xC0, 0xF1, 0x2F, 0x00, 0x60, 0xF0, 0x2F,
+0x03, 0xC0, 0x61, 0xC0, 0xF1, 0x2F, 0x05, 0xC0, 0x60, 0xC0, 0xF2, 0x60, 0x29, 0xF0, 0x20, 0x61,
+0xF1, 0x20, 0xC0, 0x70, 0x0F, 0x01, 0x90, 0x50, 0x08, 0x70, 0xB0, 0x02, 0x40, 0x09, 0xB0, 0x92,
+0x0F, 0x06, 0x50, 0xB0, 0x0F, 0x02, 0x90, 0x40, 0x00, 0x50, 0x40, 0x30, 0x90, 0x09, 0x50, 0x90,
+0x0D, 0x90, 0xB0, 0x05, 0xB0, 0xE0, 0xA1, 0xC0, 0xF0, 0x22, 0xF0, 0xC0, 0xA0, 0x02, 0xB0, 0x40,
+0x50, 0x0B, 0x40, 0x01, 0xB0, 0x90, 0xE1, 0x0F, 0x07, 0x50, 0x40, 0x90, 0xB0, 0x0E, 0xB0, 0x70,
+0x50, 0xC0, 0x61, 0xF0, 0x22, 0xF1, 0x70, 0x90, 0x09, 0x50, 0x90, 0x40, 0x90, 0x50, 0x0F, 0x0C,
+0x70, 0x02, 0xA0, 0x0D, 0x0A, 0x30, 0xB0, 0x30, 0xB0, 0x30, 0x50, 0x40, 0x30, 0xA0, 0xF0, 0x2F,
+0x03, 0xF2, 0x20, 0xC0, 0x62, 0xC0, 0x2F, 0x05, 0xF0, 0x60, 0xF0, 0x2D, 0xF1, 0xC0, 0x61, 0xC0,
+0x25, 0xF0, 0x21, 0xF1, 0x2B, 0xF0, 0xC0, 0x60, 0xC0, 0x23, 0xF0, 0x60, 0x27, 0xF1, 0xC0, 0x60,
+0x24, 0xF0, 0x30, 0x90, 0x0E, 0x40, 0x50, 0x08, 0xB0, 0xE0, 0xA0, 0x01, 0x40, 0xB0, 0x09, 0x40,
+0x01, 0xB0, 0x40, 0x50, 0xB0, 0x0F, 0x03, 0x50, 0xB0, 0x0F, 0x02, 0x50, 0x80, 0x91, 0x00, 0x30,
+0x90, 0x50, 0x09, 0x90, 0x50, 0x0D, 0x90, 0x50, 0x07, 0x50, 0xA0, 0x80, 0xF2, 0xC0, 0x70, 0xB0,
+0x04, 0x50, 0x40, 0xB0, 0x08, 0x90, 0xB0, 0x04, 0x30, 0x90, 0xB0, 0x0F, 0x07, 0xB0, 0x50, 0x40,
+0x90, 0x0D, 0x30, 0xC0, 0x81, 0xC0, 0x24, 0xF1, 0xA0, 0x40, 0x0B, 0xB0, 0x50, 0x41, 0x50, 0xB0,
+0x0F, 0x07, 0xB0, 0xD0, 0xE0, 0x90, 0x50, 0x80, 0x0D, 0x0A, 0x50, 0x30, 0x90, 0x00, 0xA0, 0xE0,
+0x90, 0xB0, 0xA0, 0xF0, 0x2F, 0x02, 0xF0, 0xC0, 0x62, 0xC1, 0xF1, 0x2F, 0x06, 0xF0, 0x60, 0x2B,
+0xF1, 0xC1, 0x60, 0xC0, 0x20, 0xF0, 0x28, 0xF0, 0xC0, 0x70, 0x60, 0x29, 0xC0, 0x60, 0xC0, 0xF0,
+0x25, 0xC0, 0x60, 0xF0, 0x24, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x24, 0xF0, 0x30, 0x50, 0x0D, 0x40,
+0x09, 0xE0, 0x30, 0xE0, 0x50, 0x00, 0x90, 0x50, 0x09, 0x51, 0x03, 0x50, 0x90, 0x40, 0xB0, 0x0F,
+0x01, 0x50, 0xB0, 0x0F, 0x01, 0x50, 0x40, 0xA0, 0x02, 0x90, 0x41, 0x0A, 0x40, 0xB0, 0x0D, 0x91,
+0x08, 0xE0, 0x70, 0x30, 0xA0, 0x70, 0x08, 0x90, 0x40, 0x07, 0x40, 0x05, 0xE0, 0x91, 0x40, 0xB0,
+0x0F, 0x08, 0xB0, 0x90, 0x40, 0x50, 0x0A, 0x50, 0xA0, 0x61, 0xC0, 0xF0, 0x25, 0xF0, 0x30, 0xE0,
+0x0E, 0xB0, 0x90, 0x41, 0x50, 0x0F, 0x04, 0x40, 0x30, 0xB0, 0x40, 0xA0, 0x40, 0x0D, 0x0E, 0x30,
+0x02, 0xA0, 0xF0, 0x2B, 0xF2, 0xC0, 0x62, 0xC0, 0x20, 0xF1, 0x2F, 0x0B, 0xC1, 0xF0, 0x26, 0xF1,
+0x20, 0x62, 0xC0, 0xF1, 0x2A, 0xF0, 0x60, 0x80, 0xA0, 0xF0, 0x24, 0xF1, 0x61, 0xC0, 0xF0, 0x27,
+0xF0, 0x60, 0xC0, 0xF0, 0x21, 0xF0, 0xC0, 0x61, 0xF1, 0x25, 0xF0, 0x70, 0x0C, 0x50, 0x40, 0x06,
+0xB0, 0x80, 0x30, 0xA0, 0x90, 0x02, 0x50, 0x90, 0x0A, 0x40, 0x07, 0x90, 0xE0, 0x90, 0xB0, 0x0D,
+0x50, 0xB0, 0x0D, 0x50, 0x40, 0xE0, 0xB0, 0x00, 0x30, 0xB0, 0x02, 0x30, 0xB0, 0x90, 0x0A, 0x40,
+0x0E, 0x50, 0x40, 0x09, 0x50, 0xB0, 0x0B, 0x40, 0x90, 0x04, 0x90, 0xB0, 0x06, 0xA0, 0x01, 0x90,
+0x40, 0x50, 0x0F, 0x09, 0x50, 0x41, 0x50, 0x08, 0x50, 0x70, 0x60, 0xF0, 0x25, 0xF2, 0x80, 0xA0,
+0x0F, 0x02, 0x50, 0x42, 0x50, 0x0F, 0x00, 0x30, 0x50, 0x01, 0xE0, 0xB0, 0x0D, 0x0E, 0x90, 0x40,
+0x01, 0x30, 0x60, 0xF0, 0x29, 0xC1, 0x61, 0xC1, 0xF1, 0x2F, 0x10, 0x60, 0xF0, 0x21, 0xF2, 0x21,
+0xC0, 0x61, 0xC0, 0xF1, 0x2E, 0xC0, 0x70, 0xC0, 0x22, 0xF1, 0x20, 0xC0, 0x60, 0xC0, 0xF0, 0x27,
+0xF1, 0x60, 0x20, 0x60, 0xF1, 0x20, 0x61, 0x20, 0xF0, 0x26, 0xF0, 0xA0, 0x50, 0x0B, 0x91, 0x06,
+0xB0, 0xA0, 0xB0, 0x04, 0x50, 0x90, 0x0A, 0x90, 0xB0, 0x07, 0xB0, 0x90, 0x00, 0x90, 0x40, 0x90,
+0x50, 0xB0, 0x09, 0x50, 0xB0, 0x09, 0xB0, 0x50, 0x90, 0x40, 0x50, 0x00, 0x90, 0x01, 0x90, 0xE0,
+0x01, 0x41, 0x00, 0x90, 0xB0, 0x0A, 0x40, 0x0E, 0xB0, 0xE0, 0x0F, 0x08, 0xB0, 0x40, 0x50, 0x01,
+0xB0, 0x90, 0x07, 0xA0, 0x03, 0x50, 0x40, 0x50, 0x0F, 0x0A, 0x50, 0x40, 0x90, 0xB0, 0x06, 0x50,
+0x30, 0xF0, 0x28, 0xF0, 0x60, 0x30, 0x0F, 0x05, 0x50, 0x41, 0x90, 0x50, 0x0B, 0x10, 0x90, 0x01,
+0xA0, 0x0E, 0x0F, 0x00, 0xD0, 0x30, 0x80, 0x40, 0xA0, 0xF0, 0x23, 0xF1, 0x20, 0xC0, 0x61, 0xC1,
+0x2F, 0x16, 0x60, 0x22, 0xF1, 0xC0, 0x61, 0xC0, 0x2F, 0x07, 0xF2, 0xC0, 0x60, 0x80, 0x60, 0xF0,
+0x28, 0xF0, 0x60, 0xA0, 0xD0, 0xF0, 0x60, 0xC1, 0x60, 0xC0, 0x28, 0xF0, 0xA0, 0x90, 0x0B, 0x90,
+0x50, 0x07, 0x30, 0x50, 0x04, 0xB0, 0x40, 0x0A, 0xB0, 0x90, 0x08, 0x90, 0xB0, 0x02, 0xB0, 0x50,
+0x90, 0x40, 0x90, 0x50, 0xB2, 0x03, 0x50, 0xB0, 0x03, 0xB1, 0x50, 0x90, 0x40, 0x90, 0x51, 0x03,
+0x40, 0x02, 0x30, 0x00, 0xB0, 0x30, 0x01, 0xB0, 0x90, 0x0A, 0xB0, 0x40, 0x0F, 0x00, 0x40, 0xB0,
+0x0F, 0x08, 0x50, 0x40, 0x00, 0x90, 0xB0, 0x07, 0xE0, 0x50, 0x04, 0x50, 0x40, 0x50, 0x0F, 0x0A,
+0xB0, 0x50, 0x40, 0x50, 0xB0, 0x03, 0x50, 0x80, 0x60, 0xF0, 0x28, 0xF0, 0x60, 0xA0, 0x90, 0x0F,
+0x06, 0xB0, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x07, 0xD0, 0x40, 0x32, 0x0E, 0x0F, 0x00, 0xA0, 0x02,
+0x70, 0xF1, 0x21, 0xC1, 0x61, 0xC1, 0xF0, 0x2F, 0x18, 0xC1, 0x21, 0x61, 0xC0, 0x20, 0xF0, 0x2F,
+0x07, 0xF0, 0x62, 0xA1, 0x70, 0xD0, 0xF0, 0x28, 0xF0, 0xD0, 0xA0, 0x60, 0xF0, 0xC0, 0x80, 0xC0,
+0xF0, 0x28, 0xF0, 0xA0, 0x90, 0x0B, 0x90, 0xB0, 0x05, 0xB0, 0x90, 0xA0, 0x50, 0x05, 0x40, 0x0B,
+0x40, 0xB0, 0x08, 0x40, 0x07, 0x52, 0x93, 0x40, 0x90, 0xE0, 0x42, 0x92, 0x51, 0x40, 0x07, 0xB0,
+0x50, 0x01, 0x30, 0xB0, 0xA0, 0x50, 0x02, 0x90, 0xB0, 0x0A, 0x51, 0x0F, 0x00, 0x40, 0x50, 0x0F,
+0x09, 0x40, 0xE0, 0x08, 0x50, 0xE0, 0x06, 0x50, 0x40, 0x90, 0x0F, 0x0B, 0xB0, 0x90, 0x40, 0x50,
+0x01, 0x40, 0x50, 0xA0, 0xF1, 0x28, 0xF0, 0xC0, 0x70, 0x0F, 0x0A, 0x50, 0x90, 0x41, 0x50, 0x03,
+0x40, 0x30, 0x01, 0x41, 0x0E, 0x0F, 0x00, 0x80, 0xB0, 0x01, 0x80, 0xC1, 0x61, 0xC1, 0x20, 0xF0,
+0x2F, 0x1A, 0xF1, 0x62, 0xC0, 0x2F, 0x07, 0xF3, 0xC0, 0xA0, 0x70, 0x61, 0x00, 0xA0, 0xF0, 0x27,
+0xF0, 0x20, 0x70, 0x60, 0x50, 0xC0, 0x60, 0xC2, 0xF0, 0x27, 0xF0, 0xA0, 0xE0, 0x0B, 0x40, 0x50,
+0x30, 0xE0, 0x00, 0x80, 0xA0, 0x31, 0x80, 0xE0, 0x06, 0x40, 0x0B, 0x50, 0x90, 0x08, 0xB0, 0x50,
+0x07, 0x90, 0xB0, 0x06, 0x50, 0xB0, 0x06, 0x50, 0xB0, 0x07, 0x40, 0x01, 0x70, 0x30, 0xB0, 0x04,
+0x40, 0x0B, 0x90, 0x50, 0x0F, 0x00, 0x91, 0x0F, 0x08, 0x40, 0xB0, 0x40, 0x90, 0x07, 0xA0, 0x08,
+0xB0, 0x40, 0x90, 0xB0, 0x0F, 0x0B, 0x50, 0x42, 0x00, 0x90, 0xA0, 0xF0, 0x29, 0xF0, 0x60, 0x70,
+0x40, 0x0F, 0x0C, 0x50, 0x90, 0x40, 0x90, 0xB0, 0xA0, 0xB0, 0x01, 0x30, 0x0F, 0x00, 0x0F, 0x00,
+0x90, 0xE0, 0x40, 0x80, 0x70, 0x80, 0xC0, 0x21, 0xF0, 0x2F, 0x18, 0xF2, 0x20, 0xC0, 0x62, 0xC0,
+0xF0, 0x2F, 0x09, 0x10, 0xA0, 0x60, 0xC2, 0xF0, 0xA1, 0xC0, 0xF1, 0x30, 0x60, 0x23, 0xF1, 0xA0,
+0x60, 0x80, 0x61, 0xF2, 0x60, 0x25, 0xF1, 0x60, 0x70, 0x90, 0x0A, 0xB0, 0x30, 0x80, 0x30, 0x00,
+0x90, 0x30, 0xE0, 0x0A, 0x40, 0xB0, 0x0B, 0x40, 0x09, 0x40, 0x08, 0x40, 0x07, 0x90, 0xB0, 0x06,
+0xB0, 0x50, 0x07, 0x90, 0xB0, 0x50, 0x30, 0x06, 0x51, 0x0B, 0x90, 0xB0, 0x0F, 0x00, 0x50, 0x40,
+0x0F, 0x06, 0x51, 0x01, 0x50, 0x40, 0x50, 0x05, 0x30, 0x0B, 0x90, 0x40, 0xB0, 0x0F, 0x0B, 0x90,
+0x50, 0x40, 0x50, 0xE0, 0x30, 0xF1, 0x27, 0xF1, 0x60, 0xD0, 0x40, 0x0F, 0x0F, 0x50, 0xD0, 0x30,
+0xE0, 0x90, 0xA0, 0x0F, 0x00, 0x0F, 0x01, 0x70, 0x90, 0xB1, 0x30, 0xF0, 0x2F, 0x1A, 0xF0, 0x20,
+0xC0, 0x61, 0xC0, 0x22, 0x60, 0xF0, 0x2F, 0x08, 0xC0, 0x60, 0xC0, 0x24, 0xF0, 0x20, 0xF1, 0x80,
+0xE0, 0x30, 0x60, 0x22, 0xF0, 0x80, 0xE0, 0x80, 0x60, 0xC0, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0xF0,
+0x22, 0xF0, 0x60, 0xA0, 0x80, 0xB0, 0x0A, 0x50, 0x30, 0xE0, 0x50, 0x0E, 0x51, 0x0B, 0x51, 0x09,
+0x40, 0x08, 0x40, 0x07, 0x50, 0xB0, 0x07, 0x90, 0x07, 0xB0, 0x50, 0x00, 0x30, 0x50, 0x06, 0x40,
+0x0C, 0x40, 0x0F, 0x01, 0xB0, 0x40, 0x0F, 0x05, 0x40, 0x04, 0x50, 0x40, 0xB0, 0x03, 0x30, 0x0D,
+0x50, 0x40, 0x50, 0x0F, 0x09, 0x90, 0x01, 0xB0, 0x50, 0x80, 0x60, 0xF1, 0x28, 0xC0, 0x60, 0x30,
+0xE0, 0x0F, 0x0F, 0x70, 0x00, 0x50, 0xE0, 0x30, 0x0F, 0x00, 0x0F, 0x01, 0x30, 0x02, 0xA0, 0xF0,
+0x2F, 0x1A, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x23, 0x60, 0xF0, 0x2F, 0x04, 0xF0, 0x20, 0x61, 0xC0,
+0xF1, 0x27, 0xF0, 0xA0, 0xB0, 0x80, 0xC0, 0x21, 0xF0, 0x70, 0xD0, 0x30, 0xC0, 0xF0, 0x24, 0xF0,
+0xC1, 0xF2, 0xA0, 0x80, 0x0C, 0x80, 0xE0, 0xB0, 0x0F, 0x00, 0xB0, 0x90, 0x0C, 0x40, 0x09, 0x51,
+0x08, 0x90, 0x07, 0x50, 0xB0, 0x07, 0x40, 0x08, 0x40, 0x01, 0xA0, 0x06, 0xB0, 0x90, 0x0C, 0x40,
+0x0F, 0x02, 0x40, 0xB0, 0x0F, 0x02, 0x90, 0xB0, 0x06, 0x91, 0x02, 0x80, 0xB0, 0x0E, 0x50, 0x40,
+0x50, 0x0F, 0x06, 0x51, 0x04, 0xE0, 0x30, 0x60, 0xC0, 0x20, 0xF1, 0x20, 0xF0, 0x23, 0xF1, 0x70,
+0x0F, 0x0E, 0x40, 0xE0, 0x01, 0x50, 0x40, 0x0F, 0x00, 0x0F, 0x01, 0xE0, 0x50, 0x00, 0x50, 0x70,
+0xC0, 0x2F, 0x15, 0xF0, 0x20, 0x62, 0x20, 0xF0, 0x25, 0xF0, 0xC1, 0x2F, 0x04, 0x61, 0x20, 0xF0,
+0x2B, 0xF0, 0xA0, 0x60, 0xF0, 0x20, 0xF1, 0xC1, 0xF0, 0x23, 0xF4, 0x60, 0xF0, 0x60, 0x70, 0x50,
+0x0B, 0x80, 0xA0, 0x50, 0x0F, 0x02, 0x40, 0x0C, 0x90, 0xB0, 0x09, 0x40, 0x08, 0x51, 0x07, 0x90,
+0xB0, 0x07, 0x90, 0x08, 0x51, 0x00, 0xE0, 0x90, 0x06, 0x90, 0xB0, 0x0B, 0xB0, 0x40, 0x0F, 0x02,
+0x40, 0x50, 0x0F, 0x00, 0x50, 0x90, 0x08, 0xB0, 0x40, 0x50, 0x00, 0x90, 0x40, 0x0F, 0x01, 0x50,
+0x40, 0x50, 0x0F, 0x04, 0x40, 0x06, 0xE0, 0x30, 0xC0, 0x61, 0xC0, 0xF2, 0x23, 0xF0, 0x70, 0xB0,
+0x0F, 0x0D, 0x70, 0x30, 0x01, 0x30, 0xB0, 0x0F, 0x00, 0x0F, 0x01, 0x90, 0x70, 0xA0, 0xE0, 0x40,
+0x80, 0xF0, 0x2F, 0x13, 0xC0, 0x61, 0xC0, 0xF0, 0x28, 0xF1, 0x60, 0x2E, 0xF1, 0xC0, 0x61, 0x20,
+0xF0, 0x23, 0xF0, 0x29, 0xF0, 0x20, 0xF1, 0x61, 0x20, 0xF0, 0x23, 0xF0, 0x60, 0x35, 0x40, 0x0C,
+0xB0, 0x30, 0x0F, 0x03, 0x40, 0x0C, 0xB0, 0x90, 0x09, 0xB0, 0x90, 0x08, 0x90, 0x08, 0x90, 0xB0,
+0x07, 0x40, 0x09, 0x90, 0x00, 0xB0, 0x30, 0x07, 0x40, 0x0C, 0x50, 0x90, 0x0F, 0x02, 0x91, 0x0E,
+0x40, 0x0B, 0x50, 0x40, 0x50, 0x80, 0x0F, 0x03, 0x50, 0x40, 0x50, 0xB0, 0x0F, 0x00, 0xB0, 0x90,
+0x07, 0x30, 0x60, 0xF1, 0xC0, 0x61, 0xC0, 0xF0, 0x23, 0xF0, 0x70, 0x90, 0x0F, 0x0B, 0xB0, 0xD0,
+0x50, 0x31, 0x70, 0x0F, 0x01, 0x0F, 0x02, 0xA0, 0x02, 0xA0, 0xF1, 0x2F, 0x0C, 0xF2, 0xC0, 0x61,
+0xC0, 0x2D, 0xF0, 0x60, 0x2C, 0xF1, 0xC0, 0x61, 0x2F, 0x03, 0xF1, 0xC0, 0x60, 0xC0, 0xF1, 0x23,
+0xF0, 0x30, 0xA0, 0xB0, 0x00, 0xB1, 0x00, 0x90, 0xB0, 0x0B, 0xB0, 0xE1, 0x0F, 0x02, 0x40, 0x0D,
+0x40, 0x0A, 0x50, 0xB0, 0x08, 0x90, 0x08, 0x50, 0xB0, 0x07, 0x90, 0xB0, 0x08, 0x40, 0x01, 0x30,
+0x07, 0x51, 0x0C, 0x51, 0x0F, 0x02, 0x50, 0x90, 0x0C, 0x40, 0x0E, 0x50, 0x80, 0x0F, 0x05, 0xB0,
+0x40, 0x90, 0xB0, 0x0D, 0x90, 0xB0, 0x08, 0xA0, 0x60, 0xF0, 0x20, 0xF0, 0x20, 0xC0, 0x60, 0xC1,
+0xF1, 0x20, 0xF0, 0xA0, 0x60, 0xE0, 0x40, 0x0F, 0x08, 0x90, 0x30, 0x01, 0x90, 0xE0, 0x0F, 0x01,
+0x0F, 0x02, 0x30, 0x02, 0x30, 0xC0, 0xF0, 0x2F, 0x0D, 0x61, 0xC1, 0xF1, 0x2F, 0x00, 0x60, 0x2A,
+0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x25, 0xF0, 0x60, 0xA0,
+0xE0, 0x30, 0xA0, 0xE0, 0x90, 0x50, 0x41, 0x0A, 0x50, 0x91, 0xE0, 0x0F, 0x01, 0x90, 0xB0, 0x0C,
+0x51, 0x0A, 0x40, 0x09, 0x40, 0x08, 0x50, 0xB0, 0x07, 0xB0, 0x50, 0x08, 0x51, 0x00, 0xE0, 0x50,
+0x07, 0x40, 0x0D, 0x40, 0xB0, 0x0F, 0x02, 0xB0, 0x40, 0x0A, 0x50, 0x40, 0x90, 0x0E, 0x30, 0x40,
+0x90, 0x0F, 0x05, 0xB0, 0x90, 0x40, 0x0C, 0x40, 0x0A, 0xA0, 0xC0, 0xF0, 0x21, 0xF1, 0xC0, 0x61,
+0xC0, 0x20, 0xF0, 0xC0, 0x81, 0x30, 0xA0, 0x30, 0xB0, 0x0F, 0x05, 0x30, 0x90, 0x01, 0x40, 0x90,
+0x0F, 0x01, 0x0F, 0x02, 0x90, 0x81, 0x31, 0x80, 0xF0, 0x2F, 0x07, 0xF1, 0x20, 0xC0, 0x61, 0xC0,
+0xF0, 0x2F, 0x04, 0x60, 0xF0, 0x26, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x03, 0xF1, 0x61,
+0x20, 0xF0, 0x26, 0xF0, 0x70, 0x03, 0xB0, 0x30, 0xE0, 0x31, 0x80, 0xE0, 0x40, 0xB0, 0x05, 0x91,
+0x00, 0x40, 0x90, 0x0F, 0x00, 0x90, 0x50, 0x0D, 0x40, 0x0A, 0xB0, 0x90, 0x09, 0x40, 0x08, 0x50,
+0xB0, 0x08, 0x90, 0x09, 0x40, 0x00, 0xE0, 0x90, 0x07, 0x51, 0x0D, 0x40, 0x0F, 0x04, 0x40, 0xB0,
+0x07, 0xB0, 0x40, 0x00, 0xB0, 0x40, 0x50, 0x0C, 0xE0, 0xB1, 0x40, 0x50, 0x0F, 0x06, 0x90, 0x40,
+0xB0, 0x08, 0x90, 0xB0, 0x0A, 0xB0, 0x70, 0xC0, 0xF0, 0x23, 0xF0, 0x20, 0xC0, 0x61, 0xC0, 0xF3,
+0xC0, 0x70, 0x90, 0x0F, 0x04, 0xD0, 0x31, 0x40, 0xA0, 0x0F, 0x02, 0x0F, 0x02, 0xB0, 0x70, 0x02,
+0xA0, 0xF0, 0x2F, 0x07, 0xC0, 0x61, 0xC0, 0x2F, 0x08, 0xC1, 0x24, 0xF0, 0x20, 0x61, 0xC0, 0xF1,
+0x2F, 0x04, 0x61, 0x29, 0xF0, 0xA0, 0x50, 0x02, 0xB0, 0x40, 0xB0, 0x02, 0x50, 0x40, 0x90, 0x80,
+0xA0, 0x31, 0xE0, 0x42, 0x01, 0xE0, 0x50, 0x0E, 0x50, 0x90, 0x0D, 0x90, 0xB0, 0x0A, 0x90, 0x09,
+0xB0, 0x90, 0x08, 0x50, 0xB0, 0x08, 0x40, 0x09, 0x90, 0x00, 0xE0, 0x50, 0x08, 0x40, 0x0E, 0x40,
+0x0F, 0x04, 0x40, 0x50, 0x06, 0x40, 0x03, 0x91, 0x0B, 0x40, 0x90, 0x01, 0x50, 0x40, 0xB0, 0x0F,
+0x06, 0x90, 0x40, 0x50, 0x06, 0x40, 0x0C, 0x50, 0x70, 0xF1, 0x25, 0xF1, 0xC0, 0x61, 0xC0, 0x20,
+0xF1, 0x70, 0x80, 0x0F, 0x02, 0x90, 0xA0, 0x01, 0x40, 0x30, 0x00, 0xB0, 0x0F, 0x00, 0x0F, 0x03,
+0xA0, 0x02, 0xA0, 0xF0, 0x2F, 0x02, 0xF1, 0xC0, 0x61, 0xC0, 0x20, 0xF0, 0x2F, 0x08, 0xF1, 0x60,
+0xF0, 0x20, 0xF1, 0x20, 0x61, 0xC0, 0xF0, 0x2F, 0x05, 0xC0, 0x60, 0xC0, 0xF1, 0x27, 0xF0, 0xC0,
+0x30, 0x02, 0x50, 0x90, 0x05, 0x90, 0xB0, 0x03, 0x50, 0x80, 0x40, 0xE0, 0xA0, 0x30, 0x70, 0x0E,
+0xB0, 0x40, 0x0E, 0x40, 0x0B, 0x40, 0x09, 0x51, 0x08, 0x50, 0xB0, 0x08, 0x40, 0x09, 0xB0, 0x50,
+0x80, 0xB0, 0x08, 0xB0, 0x90, 0x0D, 0xB0, 0x40, 0x0F, 0x04, 0x91, 0x04, 0x90, 0xB0, 0x04, 0xB0,
+0x40, 0xB0, 0x09, 0x90, 0xE0, 0x03, 0x91, 0x0F, 0x07, 0x50, 0x40, 0x50, 0x03, 0xB0, 0x90, 0x0D,
+0x50, 0xA0, 0x60, 0xF1, 0x27, 0xC0, 0x62, 0xC0, 0x50, 0x30, 0x90, 0x0F, 0x01, 0x80, 0x90, 0x01,
+0xE0, 0x50, 0x81, 0x90, 0x0E, 0x0F, 0x03, 0xE0, 0x90, 0x00, 0x40, 0xD0, 0x60, 0xF0, 0x2E, 0xF0,
+0x20, 0x62, 0x20, 0xF0, 0x2F, 0x0C, 0xF0, 0xC1, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2F, 0x04, 0xF0,
+0x20, 0x60, 0xC0, 0x29, 0xF2, 0xA0, 0x50, 0x01, 0x40, 0x50, 0x07, 0x40, 0x03, 0x40, 0x04, 0xA0,
+0x0E, 0x40, 0x0E, 0x90, 0xB0, 0x0A, 0xB0, 0x90, 0x09, 0x90, 0x09, 0x50, 0xB0, 0x08, 0x90, 0xB0,
+0x09, 0x90, 0x30, 0xB0, 0x09, 0x90, 0xB0, 0x0D, 0x50, 0x90, 0x0F, 0x04, 0x50, 0x90, 0x02, 0x51,
+0x07, 0x40, 0x90, 0x08, 0xB0, 0x30, 0x04, 0xB0, 0x40, 0x90, 0x0F, 0x07, 0x50, 0x40, 0x50, 0x01,
+0x40, 0x0F, 0x01, 0x80, 0x70, 0x60, 0xF0, 0x27, 0xF1, 0xC0, 0x61, 0xC0, 0x70, 0xB0, 0x0F, 0x00,
+0x10, 0x30, 0x50, 0x00, 0x30, 0xB0, 0x80, 0xB0, 0x80, 0x0E, 0x0F, 0x04, 0x10, 0x80, 0x90, 0x00,
+0x70, 0xF0, 0x2C, 0xF0, 0x62, 0x20, 0xF1, 0x2F, 0x0E, 0xF1, 0x62, 0x20, 0xF0, 0x2F, 0x05, 0xF0,
+0x61, 0x22, 0xF0, 0x25, 0xF1, 0x60, 0xA1, 0x50, 0x00, 0x50, 0x40, 0x0A, 0x40, 0x00, 0x50, 0x40,
+0x05, 0xA0, 0x0D, 0x40, 0x0E, 0xB0, 0x90, 0x0B, 0x40, 0x0A, 0x40, 0x09, 0x50, 0xB0, 0x08, 0x50,
+0xB0, 0x09, 0x50, 0xE0, 0x40, 0x0A, 0x40, 0x0E, 0x90, 0x50, 0x0F, 0x04, 0x50, 0x40, 0x00, 0xB0,
+0x40, 0x09, 0x50, 0x40, 0x08, 0xA0, 0x06, 0x50, 0x40, 0x50, 0x0F, 0x07, 0x50, 0x40, 0x90, 0x50,
+0x0F, 0x01, 0xE0, 0xA0, 0xC0, 0x29, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0x10, 0xB0, 0x0E, 0x70, 0x00,
+0xE0, 0x30, 0xA0, 0x00, 0x50, 0x80, 0x0F, 0x00, 0x0F, 0x01, 0x80, 0xE0, 0x00, 0x30, 0x02, 0xA0,
+0xF0, 0x28, 0xF0, 0x20, 0xC0, 0x61, 0x21, 0xF0, 0x2F, 0x0F, 0xF1, 0xC0, 0x61, 0xC0, 0xF1, 0x2F,
+0x05, 0xC0, 0x60, 0xC0, 0xF0, 0x27, 0xF1, 0x60, 0xA0, 0xE0, 0xB0, 0x01, 0x40, 0x50, 0x0B, 0xB0,
+0x40, 0x90, 0x05, 0xB0, 0xA1, 0x0B, 0x40, 0xB0, 0x0E, 0x40, 0x0C, 0x90, 0x0A, 0x40, 0x09, 0x50,
+0xB0, 0x08, 0xB0, 0x50, 0x09, 0xB0, 0x40, 0x30, 0x0A, 0x51, 0x0E, 0x40, 0xB0, 0x0F, 0x05, 0x41,
+0x0C, 0x40, 0x50, 0x06, 0x30, 0xB0, 0x07, 0x50, 0x40, 0xB0, 0x0F, 0x07, 0x41, 0x90, 0x0F, 0x00,
+0x50, 0x30, 0xF0, 0x2D, 0xF1, 0xC0, 0xA0, 0x40, 0x90, 0xB0, 0x0A, 0x80, 0xE0, 0x01, 0x40, 0x90,
+0x0F, 0x03, 0x0C, 0xB0, 0x02, 0x90, 0x30, 0xE1, 0x50, 0x00, 0xB0, 0xA0, 0x60, 0x25, 0xF1, 0xC0,
+0x61, 0xC0, 0x2F, 0x12, 0xF1, 0xC0, 0x60, 0xC0, 0xF1, 0x60, 0xF0, 0x2F, 0x02, 0xF1, 0xC0, 0x60,
+0xC0, 0x2B, 0xF0, 0xA0, 0x02, 0xB0, 0x40, 0xB0, 0x0C, 0x90, 0x40, 0x50, 0x05, 0x50, 0x40, 0x50,
+0xA0, 0xB0, 0x08, 0x90, 0x50, 0x0E, 0x51, 0x0B, 0x51, 0x09, 0xB0, 0x90, 0x09, 0x50, 0xB0, 0x09,
+0x90, 0x0A, 0x40, 0x30, 0x0B, 0x40, 0x0F, 0x00, 0x40, 0xB0, 0x0F, 0x04, 0x41, 0xB0, 0x0C, 0x50,
+0x40, 0x05, 0x40, 0x90, 0x09, 0x91, 0x0F, 0x05, 0xB0, 0x90, 0x00, 0xB0, 0x91, 0xB0, 0x0D, 0xA0,
+0xF1, 0x2E, 0xF0, 0x80, 0x40, 0x00, 0x50, 0x40, 0x50, 0xB0, 0x07, 0xD0, 0x50, 0x01, 0xA0, 0x00,
+0x30, 0x70, 0xD0, 0xA0, 0x90, 0x0D, 0x0B, 0x50, 0x10, 0x70, 0x90, 0x02, 0x70, 0xB0, 0xA0, 0x31,
+0x40, 0xA0, 0xF0, 0x24, 0x62, 0x20, 0xF0, 0x2F, 0x13, 0xC0, 0x60, 0xC0, 0xF1, 0x21, 0x60, 0xC0,
+0x2F, 0x03, 0x61, 0xF1, 0x2A, 0xF0, 0x30, 0x90, 0x01, 0x91, 0x0D, 0x40, 0xB0, 0x00, 0x90, 0x50,
+0x04, 0x90, 0x40, 0x00, 0xB0, 0xA0, 0x50, 0x06, 0x50, 0x90, 0x0F, 0x00, 0x40, 0x0C, 0x40, 0x0A,
+0xB0, 0x50, 0x09, 0x50, 0xB0, 0x09, 0x40, 0x0A, 0x40, 0x90, 0x0B, 0xB0, 0x90, 0x0F, 0x00, 0x40,
+0x0F, 0x03, 0x40, 0xB0, 0x00, 0x90, 0x50, 0x0C, 0xB0, 0x40, 0xB0, 0x03, 0x50, 0xE0, 0x0A, 0xB0,
+0x40, 0x50, 0x0F, 0x03, 0x90, 0xB0, 0x02, 0xB0, 0x90, 0x40, 0x0C, 0x80, 0x60, 0xF0, 0x2E, 0xF0,
+0x60, 0x80, 0x02, 0xB0, 0x90, 0x40, 0x50, 0x04, 0xB0, 0x70, 0xE0, 0xA0, 0x80, 0x30, 0x50, 0x30,
+0x01, 0x40, 0x70, 0x30, 0x0C, 0x0C, 0x70, 0x90, 0x71, 0x40, 0x80, 0xA0, 0x00, 0xA0, 0xB0, 0x01,
+0x30, 0xC0, 0xF1, 0x62, 0x2F, 0x14, 0xF0, 0x20, 0x61, 0xC0, 0xF1, 0x24, 0x60, 0xF0, 0x2B, 0xF0,
+0x21, 0xF0, 0x61, 0x2D, 0xF0, 0x60, 0x30, 0x00, 0xB0, 0x40, 0xB0, 0x0D, 0x40, 0xB0, 0x02, 0x40,
+0xB0, 0x03, 0xE0, 0x90, 0x02, 0xA0, 0x40, 0x04, 0xB0, 0x40, 0x0F, 0x00, 0x90, 0xB0, 0x0B, 0xB0,
+0x90, 0x0A, 0x50, 0xB0, 0x09, 0x50, 0xB0, 0x09, 0x90, 0x0A, 0x30, 0x90, 0x0C, 0x40, 0x0F, 0x00,
+0xB0, 0x40, 0x0F, 0x01, 0x40, 0x50, 0x02, 0x91, 0x0D, 0x91, 0x02, 0xB0, 0x80, 0x0C, 0x50, 0x40,
+0x50, 0x0F, 0x01, 0x40, 0x05, 0x30, 0x80, 0x90, 0x50, 0x09, 0xB0, 0x70, 0xC0, 0xF0, 0x2E, 0xC0,
+0x30, 0x05, 0x50, 0x40, 0x90, 0x50, 0x01, 0x30, 0x40, 0x01, 0xE0, 0x40, 0x90, 0xA0, 0x03, 0x30,
+0x90, 0x0B, 0x0C, 0xE1, 0x00, 0x50, 0x30, 0x80, 0x01, 0x40, 0x90, 0x00, 0xB0, 0x30, 0x80, 0xC0,
+0x60, 0xC0, 0x20, 0xF0, 0x2F, 0x12, 0xF0, 0xC0, 0x61, 0xC0, 0xF1, 0x26, 0x60, 0x2E, 0xC0, 0x60,
+0xC0, 0xF0, 0x2C, 0xF0, 0xC0, 0x70, 0x00, 0x50, 0x40, 0x09, 0x30, 0xA0, 0x80, 0xE0, 0x90, 0xE0,
+0x05, 0x40, 0xB0, 0x02, 0xE0, 0x50, 0x03, 0x30, 0xE0, 0x03, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x0C,
+0x50, 0xB0, 0x0A, 0x90, 0x0A, 0x50, 0xB0, 0x09, 0x50, 0xB0, 0x09, 0x80, 0xE0, 0x0C, 0xB0, 0x40,
+0x0F, 0x00, 0x50, 0x40, 0x0E, 0x90, 0x50, 0x04, 0xB0, 0x40, 0x0D, 0xB0, 0x40, 0xB0, 0x01, 0x30,
+0x0E, 0x50, 0x40, 0xB0, 0x0D, 0x40, 0x06, 0x90, 0xD0, 0x00, 0x50, 0x40, 0x50, 0x09, 0x70, 0xC0,
+0xF2, 0x2B, 0xF0, 0xA0, 0x08, 0x50, 0x40, 0x50, 0x70, 0x90, 0x01, 0xA0, 0x01, 0x80, 0xD0, 0xE0,
+0xB0, 0x00, 0x30, 0x50, 0x0B, 0x0C, 0x50, 0xA0, 0x03, 0xB2, 0xA0, 0x70, 0x11, 0xD0, 0xF1, 0x2F,
+0x13, 0xF0, 0xC0, 0x61, 0x20, 0xF0, 0x2A, 0x60, 0xF0, 0x2A, 0xC0, 0x60, 0xC0, 0xF1, 0x2D, 0xF0,
+0x80, 0x40, 0x90, 0x50, 0x0A, 0x30, 0x00, 0xB0, 0x40, 0xE1, 0x30, 0xA0, 0x80, 0xE0, 0x90, 0x50,
+0xB0, 0x40, 0x02, 0x30, 0xB0, 0x04, 0xE0, 0x30, 0x01, 0x40, 0x0F, 0x01, 0x90, 0xB0, 0x0C, 0x40,
+0x0B, 0x40, 0x0A, 0x50, 0xB0, 0x09, 0xB0, 0x50, 0x09, 0x90, 0x80, 0x50, 0x0C, 0x90, 0x50, 0x0F,
+0x00, 0x51, 0x0C, 0x91, 0x07, 0x40, 0xB0, 0x0D, 0x40, 0x50, 0x00, 0xA0, 0x0F, 0x01, 0x91, 0x0C,
+0x40, 0x06, 0x70, 0x10, 0x50, 0x01, 0x50, 0x40, 0x50, 0x07, 0xB0, 0x30, 0xA1, 0x60, 0xF0, 0x2A,
+0xF0, 0x80, 0xE0, 0x09, 0x90, 0x12, 0xA0, 0x80, 0x02, 0x50, 0x30, 0x71, 0x80, 0x0C, 0x0E, 0xB0,
+0x00, 0xE0, 0xD0, 0x70, 0x10, 0x00, 0xA0, 0x10, 0x30, 0x50, 0x30, 0xC0, 0xF0, 0x2F, 0x13, 0x61,
+0x20, 0xF0, 0x2B, 0xF0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2F, 0x00, 0xF0,
+0x30, 0x40, 0x0C, 0xA0, 0x00, 0x90, 0x50, 0x03, 0xB0, 0x90, 0x40, 0xE0, 0x80, 0x30, 0x81, 0x40,
+0xA0, 0x06, 0x90, 0x30, 0x90, 0x0F, 0x01, 0xB0, 0x90, 0x0C, 0xB0, 0x90, 0x0B, 0x40, 0x0A, 0x50,
+0xB0, 0x09, 0xB0, 0x90, 0x0A, 0xA0, 0x90, 0x0D, 0x40, 0x0F, 0x01, 0x40, 0x50, 0x0A, 0x50, 0x90,
+0x09, 0x40, 0xB0, 0x0D, 0x50, 0x90, 0xA0, 0x0F, 0x02, 0xB0, 0x40, 0x50, 0x09, 0x40, 0x08, 0x10,
+0xE0, 0x03, 0x50, 0x40, 0x90, 0x09, 0xA1, 0x60, 0x2A, 0xF0, 0xA0, 0x50, 0x08, 0xA0, 0x40, 0x90,
+0xD0, 0x10, 0x50, 0x80, 0x30, 0x50, 0x0F, 0x02, 0x0E, 0xD0, 0x50, 0xB0, 0xA0, 0x00, 0x80, 0x40,
+0x50, 0x40, 0x01, 0xB0, 0x30, 0xF0, 0x2F, 0x0E, 0xF1, 0xC0, 0x61, 0x2F, 0x02, 0x60, 0x25, 0xF1,
+0x61, 0x20, 0xF0, 0x2F, 0x01, 0xF0, 0x60, 0x30, 0x0D, 0x30, 0x90, 0x50, 0x0B, 0x80, 0x91, 0x07,
+0x90, 0xA0, 0xB0, 0x0F, 0x00, 0x40, 0x0D, 0x90, 0xB0, 0x0A, 0xB0, 0x90, 0x0A, 0x50, 0xB0, 0x0A,
+0x90, 0x0A, 0x30, 0x90, 0x0D, 0x51, 0x0F, 0x01, 0x40, 0xB0, 0x08, 0x90, 0xE0, 0x0B, 0x90, 0x50,
+0x0E, 0xE0, 0x90, 0x0F, 0x03, 0x50, 0x40, 0xB0, 0x06, 0xB0, 0x90, 0x07, 0x50, 0x10, 0x40, 0x05,
+0xB0, 0x40, 0x90, 0x09, 0xE0, 0xD0, 0xF0, 0x27, 0xF1, 0x60, 0x80, 0x08, 0x70, 0x02, 0x30, 0x00,
+0x50, 0xD0, 0x70, 0x10, 0x30, 0xB0, 0x0E, 0x0D, 0x50, 0xA0, 0x01, 0x40, 0xE0, 0xB0, 0xA0, 0x00,
+0xA0, 0x00, 0x50, 0x80, 0xD0, 0xF0, 0x2F, 0x0E, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x01, 0xF0, 0x60,
+0xC0, 0x24, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x01, 0xC0, 0x60, 0xA0, 0x40, 0x0C, 0x50, 0x80, 0x0B,
+0xB0, 0x40, 0x00, 0x40, 0x07, 0x51, 0x00, 0xA0, 0x90, 0x0D, 0x51, 0x0D, 0x40, 0x0B, 0x51, 0x0A,
+0x50, 0xB0, 0x0A, 0x40, 0x09, 0x30, 0x80, 0x00, 0x90, 0x0D, 0x40, 0x0F, 0x02, 0x40, 0x07, 0x90,
+0x50, 0xB0, 0x40, 0x0B, 0x91, 0x0D, 0xB0, 0x30, 0x90, 0x0F, 0x04, 0x90, 0x40, 0xB0, 0x04, 0x40,
+0x08, 0xE0, 0xD0, 0x10, 0x08, 0x40, 0x90, 0xB0, 0x03, 0xB0, 0xE0, 0x30, 0x80, 0x30, 0x60, 0xF0,
+0x29, 0x70, 0x07, 0x40, 0xD0, 0x40, 0x00, 0x50, 0xE0, 0x01, 0xA0, 0x01, 0xE0, 0xD0, 0xE0, 0x0D,
+0x0D, 0xB0, 0x70, 0x51, 0x70, 0x50, 0x02, 0x30, 0xA0, 0xE0, 0xB0, 0x80, 0x60, 0xF0, 0x2F, 0x09,
+0xF0, 0x20, 0xC0, 0x60, 0xC0, 0x2F, 0x07, 0x60, 0xF2, 0xC0, 0x60, 0xC0, 0x2F, 0x03, 0xF0, 0xC0,
+0xE0, 0x31, 0x0C, 0xB0, 0x30, 0x50, 0x0A, 0xB0, 0x40, 0x02, 0x40, 0xB0, 0x04, 0xB0, 0x90, 0x02,
+0x80, 0xE0, 0x0C, 0x40, 0x0D, 0xB0, 0x50, 0x0B, 0x50, 0xB0, 0x0A, 0x50, 0xB0, 0x0A, 0x40, 0x08,
+0xA0, 0x50, 0x01, 0x40, 0x0D, 0xB0, 0x90, 0x0F, 0x01, 0xB0, 0x40, 0x05, 0x90, 0x50, 0x01, 0x50,
+0x40, 0x0B, 0x50, 0x90, 0x0D, 0x30, 0x00, 0x40, 0xB0, 0x0F, 0x04, 0x91, 0x02, 0x51, 0x08, 0xA0,
+0x40, 0xB0, 0x0A, 0x50, 0x90, 0xB0, 0x40, 0x30, 0x80, 0x90, 0x02, 0x70, 0xF1, 0x28, 0xC0, 0xA0,
+0x90, 0x05, 0xD0, 0x50, 0x90, 0x30, 0xD0, 0xB0, 0x0F, 0x06, 0x0E, 0x50, 0x71, 0x41, 0xA1, 0x50,
+0xB0, 0x80, 0x02, 0xA0, 0xF0, 0x2F, 0x07, 0xF0, 0x20, 0x61, 0xC0, 0xF1, 0x2F, 0x07, 0xC1, 0xF0,
+0x61, 0x2F, 0x04, 0xF0, 0x60, 0x80, 0xA0, 0x50, 0x0C, 0x50, 0x90, 0x30, 0x0B, 0x40, 0x04, 0x40,
+0x50, 0x03, 0x40, 0x04, 0xE0, 0x30, 0x0A, 0x90, 0xB0, 0x0D, 0x40, 0x0C, 0x90, 0x0B, 0x50, 0xB0,
+0x0A, 0x50, 0xB0, 0x06, 0xB0, 0xA0, 0x02, 0x90, 0xB0, 0x0D, 0x40, 0x0F, 0x02, 0xB0, 0x90, 0x03,
+0x90, 0x50, 0x03, 0x50, 0x90, 0x0B, 0xB0, 0x40, 0x0C, 0x30, 0x01, 0x91, 0x0F, 0x04, 0xB0, 0x40,
+0x50, 0x00, 0x40, 0x07, 0x41, 0x10, 0x0B, 0xB0, 0xE0, 0xA0, 0xE0, 0x30, 0x50, 0x04, 0xE0, 0x30,
+0xF0, 0x28, 0xF0, 0xC0, 0x30, 0x80, 0x04, 0x70, 0x02, 0xA0, 0x50, 0xB0, 0x0F, 0x05, 0x0F, 0x01,
+0x40, 0x10, 0x30, 0x51, 0x70, 0xB0, 0xA0, 0x01, 0xB0, 0xD0, 0xC0, 0xF0, 0x2F, 0x04, 0xF0, 0xC0,
+0x61, 0xC0, 0xF0, 0x2F, 0x09, 0xF1, 0x61, 0xC0, 0xF0, 0x2F, 0x02, 0xF0, 0xC0, 0x60, 0xA0, 0x30,
+0x0D, 0x91, 0x00, 0xA0, 0x0A, 0xE0, 0x06, 0x40, 0xB0, 0x01, 0xE0, 0x06, 0x50, 0x70, 0x08, 0xB0,
+0x40, 0x0E, 0x40, 0x0C, 0x40, 0x0B, 0x50, 0xB0, 0x0A, 0xB0, 0x90, 0x07, 0x80, 0x90, 0x01, 0xB0,
+0x90, 0x0E, 0x40, 0x0F, 0x02, 0x90, 0x50, 0x01, 0x40, 0xB0, 0x05, 0x50, 0x40, 0x0C, 0x40, 0xB0,
+0x0A, 0x30, 0x02, 0xB0, 0x40, 0xB0, 0x0F, 0x04, 0x50, 0xE0, 0x90, 0x06, 0x80, 0xD0, 0x10, 0xE0,
+0x08, 0x90, 0x30, 0xA0, 0x80, 0x50, 0x02, 0x50, 0x40, 0x50, 0x03, 0x80, 0x30, 0xF0, 0x29, 0xF0,
+0x80, 0x30, 0xB0, 0x40, 0xB0, 0x80, 0xA0, 0x01, 0x90, 0x40, 0xE0, 0x10, 0x70, 0x40, 0x0F, 0x03,
+0x0F, 0x00, 0x40, 0x70, 0x03, 0xA0, 0x50, 0x40, 0x80, 0x30, 0x80, 0x40, 0x80, 0xF0, 0x2F, 0x02,
+0xF0, 0x20, 0x61, 0x20, 0xF0, 0x2F, 0x0A, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xF0, 0x2F, 0x01, 0xF0,
+0x20, 0x60, 0x80, 0x10, 0xB0, 0x0D, 0x40, 0x50, 0x01, 0x30, 0x08, 0xB0, 0x40, 0x08, 0x90, 0x50,
+0x90, 0xB0, 0x07, 0xB0, 0xA0, 0x50, 0x06, 0x40, 0x0E, 0x51, 0x0C, 0x40, 0x0B, 0x50, 0xB0, 0x0B,
+0x90, 0x08, 0xA0, 0x50, 0x01, 0x40, 0x0E, 0x90, 0x50, 0x0F, 0x02, 0x90, 0x50, 0x40, 0xB0, 0x07,
+0x50, 0x40, 0x0C, 0x40, 0x50, 0x09, 0x80, 0xB0, 0x03, 0x91, 0x0F, 0x04, 0x40, 0x91, 0x04, 0x70,
+0x10, 0x50, 0xB0, 0x05, 0x50, 0xE0, 0x30, 0xA0, 0x40, 0xB0, 0x07, 0x50, 0x40, 0x50, 0x01, 0xB0,
+0x70, 0x20, 0xF0, 0x29, 0xF0, 0xC0, 0xA0, 0x80, 0xA0, 0x10, 0x50, 0xA0, 0x80, 0xA0, 0x01, 0xA0,
+0xB0, 0x30, 0xD0, 0xA0, 0x50, 0x0F, 0x00, 0x0F, 0x00, 0xE1, 0x01, 0x50, 0xA1, 0x01, 0x70, 0x02,
+0xA0, 0xF0, 0x2E, 0xF1, 0xC0, 0x61, 0x2F, 0x0C, 0xF0, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x60, 0xC0,
+0x2F, 0x00, 0xF0, 0xC0, 0x60, 0xC0, 0x10, 0x80, 0x0D, 0x40, 0xB0, 0x01, 0xB0, 0x30, 0x07, 0xB0,
+0x40, 0x0A, 0x41, 0x03, 0x50, 0x90, 0x50, 0xB0, 0x02, 0x30, 0x40, 0x04, 0x50, 0x90, 0x0E, 0x40,
+0x0C, 0xB0, 0x90, 0x0B, 0x50, 0xB0, 0x0B, 0x40, 0x08, 0xB0, 0xA0, 0x01, 0x51, 0x0E, 0x40, 0x0F,
+0x02, 0xB0, 0xE0, 0x50, 0x09, 0x50, 0x40, 0x0C, 0x91, 0x08, 0x40, 0x90, 0x04, 0x50, 0x40, 0x0F,
+0x02, 0x90, 0xB0, 0x00, 0xB0, 0x40, 0x90, 0x02, 0x30, 0xA0, 0x03, 0xB0, 0x50, 0x80, 0xA0, 0x80,
+0x50, 0xB0, 0x0C, 0xB0, 0x40, 0x50, 0x00, 0xA0, 0xF0, 0x2B, 0xF2, 0x60, 0xE0, 0x01, 0x90, 0x30,
+0x01, 0xE0, 0x02, 0x90, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0xB0, 0x70, 0xA0, 0x70, 0xD0, 0x40, 0x00,
+0x40, 0x00, 0x80, 0x50, 0x01, 0x80, 0x60, 0xF0, 0x2C, 0xF0, 0xC0, 0x60, 0xC0, 0x20, 0xF0, 0x2F,
+0x0A, 0xF0, 0x20, 0x61, 0x24, 0x60, 0xF0, 0x2C, 0xF0, 0x20, 0x60, 0xC0, 0xF0, 0x40, 0x30, 0x0C,
+0xB0, 0x40, 0x03, 0xB0, 0x80, 0x07, 0x40, 0x0A, 0x51, 0xB0, 0x40, 0x02, 0xA0, 0x40, 0xE0, 0x80,
+0x30, 0xA0, 0x30, 0x80, 0xD0, 0x80, 0x03, 0x40, 0x0E, 0xB0, 0x90, 0x0C, 0x50, 0xB0, 0x0B, 0x50,
+0xB0, 0x0B, 0x40, 0x09, 0x50, 0x30, 0x01, 0x90, 0x0E, 0x51, 0x0F, 0x00, 0x50, 0x40, 0x00, 0x40,
+0x0A, 0x50, 0x90, 0x0C, 0x50, 0x40, 0x07, 0x50, 0x80, 0x06, 0x40, 0x50, 0x0E, 0xB0, 0x90, 0x03,
+0x50, 0x40, 0xB0, 0x90, 0x10, 0x01, 0xB0, 0x40, 0xA0, 0x30, 0xE0, 0x50, 0x0F, 0x03, 0xB0, 0x90,
+0x81, 0xF0, 0x2B, 0xF1, 0x70, 0xB0, 0x01, 0x80, 0x50, 0x0F, 0x08, 0x0F, 0x02, 0x50, 0xB0, 0x01,
+0xE0, 0x40, 0x30, 0x50, 0x80, 0x90, 0xA0, 0x80, 0xA0, 0xF0, 0x29, 0xF0, 0x20, 0xC0, 0x61, 0xF1,
+0x2F, 0x0A, 0xF1, 0x61, 0x20, 0xF0, 0x23, 0xF0, 0xC1, 0x2B, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0xC0,
+0x70, 0x0C, 0x50, 0x40, 0x04, 0x90, 0x40, 0x05, 0xB0, 0xE0, 0x0A, 0xB0, 0x90, 0x02, 0xE0, 0xB0,
+0x00, 0x30, 0x05, 0xB0, 0x50, 0x31, 0x01, 0x50, 0xB0, 0x0E, 0x50, 0xB0, 0x0C, 0x90, 0x0C, 0x50,
+0xB0, 0x0B, 0x90, 0x0A, 0x30, 0x01, 0x40, 0x0F, 0x00, 0x40, 0x0E, 0x91, 0x02, 0x40, 0x0A, 0x50,
+0x90, 0x0C, 0xB0, 0xE0, 0x07, 0xA0, 0x07, 0x50, 0x40, 0x0D, 0x40, 0x06, 0x50, 0xA0, 0x30, 0x80,
+0xA0, 0x30, 0x90, 0x0F, 0x0A, 0x30, 0x60, 0x2B, 0xF0, 0x60, 0xA0, 0x31, 0x50, 0x30, 0x0F, 0x09,
+0x0F, 0x06, 0x90, 0x81, 0x00, 0x70, 0xE0, 0x01, 0x80, 0x60, 0x29, 0xC0, 0x60, 0xC0, 0xF1, 0x2F,
+0x0B, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x26, 0xF0, 0x60, 0x2B, 0x61, 0xF2, 0xA0, 0x50, 0x0B, 0x91,
+0x05, 0xE0, 0x50, 0x04, 0xB0, 0x40, 0x0A, 0xB0, 0x40, 0x04, 0x91, 0x30, 0x08, 0x90, 0xA0, 0xB0,
+0x40, 0x0F, 0x00, 0x40, 0x0D, 0x40, 0x0C, 0x50, 0xB0, 0x0B, 0x50, 0xB0, 0x09, 0xA0, 0x01, 0xB0,
+0x50, 0x0F, 0x00, 0x40, 0x0C, 0x40, 0xB0, 0x03, 0xB0, 0x40, 0x0A, 0x50, 0x40, 0x0D, 0x40, 0xB0,
+0x05, 0x30, 0x09, 0x40, 0xB0, 0x0A, 0x90, 0x50, 0x04, 0x90, 0xE0, 0x30, 0x10, 0x41, 0x0F, 0x0D,
+0x30, 0xC0, 0x61, 0xC0, 0xF1, 0x26, 0xF0, 0x30, 0x50, 0x00, 0xB0, 0x70, 0x90, 0x0F, 0x09, 0x0F,
+0x07, 0xB0, 0x01, 0x90, 0x40, 0x01, 0xB0, 0xA0, 0xF0, 0x24, 0xF0, 0x20, 0x61, 0xC0, 0x20, 0xF0,
+0x2F, 0x0B, 0xF0, 0xC0, 0x60, 0xC0, 0x2B, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x60, 0xC0, 0x21, 0xF0,
+0x60, 0x30, 0x0B, 0x40, 0x50, 0x06, 0x30, 0xB0, 0x03, 0xB0, 0x40, 0x0B, 0x40, 0x06, 0x50, 0x30,
+0x09, 0xB0, 0x30, 0x90, 0x0E, 0xB0, 0x90, 0x0D, 0x40, 0x0C, 0x50, 0xB0, 0x0B, 0xB0, 0x90, 0x09,
+0x80, 0x90, 0x01, 0x40, 0x0F, 0x00, 0x90, 0xB0, 0x09, 0x50, 0x40, 0x06, 0x50, 0x90, 0x0A, 0x50,
+0x90, 0x0D, 0x40, 0x50, 0x04, 0x80, 0xB0, 0x09, 0x91, 0x09, 0x90, 0x00, 0xB0, 0x50, 0xE0, 0x31,
+0x40, 0xB0, 0x50, 0x10, 0x00, 0xB0, 0x40, 0x50, 0x0F, 0x0B, 0x50, 0x30, 0xF0, 0x20, 0xC0, 0x60,
+0xC0, 0xF1, 0x24, 0xC0, 0xA0, 0x02, 0x30, 0x0F, 0x0A, 0x0F, 0x0B, 0xA0, 0x00, 0x90, 0x30, 0xD0,
+0xF1, 0x23, 0x61, 0xC0, 0x2F, 0x0D, 0xF1, 0x61, 0xC0, 0xF0, 0x2B, 0x60, 0xC0, 0xF0, 0x23, 0xF0,
+0x20, 0x61, 0xF0, 0x22, 0xF0, 0x70, 0x0B, 0x40, 0xB0, 0x04, 0x51, 0xE0, 0xD0, 0x04, 0x40, 0x0B,
+0x40, 0xB0, 0x07, 0x30, 0x40, 0xB0, 0x08, 0x90, 0xA0, 0x90, 0x0D, 0x90, 0x0E, 0x90, 0x0C, 0x50,
+0xB0, 0x0C, 0x40, 0x0A, 0xA0, 0x50, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x08, 0x91, 0x08, 0x90, 0x50,
+0x0A, 0x50, 0x90, 0x0D, 0x90, 0x50, 0x03, 0xE0, 0x90, 0x0A, 0xB0, 0x40, 0xB0, 0x06, 0x40, 0xE0,
+0xA0, 0x30, 0xE0, 0x90, 0xB0, 0x02, 0xE1, 0x02, 0x50, 0x40, 0xB0, 0x0F, 0x0A, 0x70, 0xF0, 0x20,
+0xF1, 0xC0, 0x60, 0xC0, 0x23, 0xF0, 0x80, 0x70, 0x80, 0xB0, 0x90, 0xE0, 0x0F, 0x0A, 0x0F, 0x0B,
+0xE0, 0x70, 0xE0, 0x00, 0x50, 0x30, 0xF1, 0x20, 0x61, 0xC0, 0xF0, 0x20, 0xF0, 0x2F, 0x0A, 0xF1,
+0xC0, 0x60, 0x2F, 0x00, 0xF0, 0x60, 0x23, 0xF1, 0x60, 0xC0, 0x22, 0xF1, 0x80, 0xE0, 0x09, 0xB0,
+0xE0, 0x04, 0xE0, 0xA0, 0x80, 0xE0, 0x50, 0x04, 0xE0, 0x0B, 0x40, 0xB0, 0x08, 0x30, 0x91, 0x40,
+0x06, 0x40, 0x01, 0x30, 0x80, 0x0C, 0x40, 0x0D, 0xB0, 0x90, 0x0C, 0x50, 0xB0, 0x0C, 0x40, 0x0B,
+0xA0, 0x30, 0xE0, 0x31, 0xE0, 0x0D, 0x90, 0x50, 0x05, 0xB0, 0x40, 0x91, 0x09, 0x40, 0x0B, 0x50,
+0x40, 0x0D, 0x50, 0x40, 0x02, 0x90, 0x40, 0x0C, 0x90, 0x50, 0x01, 0x90, 0x31, 0xA0, 0xE0, 0x90,
+0x07, 0x40, 0xB0, 0x04, 0x90, 0x40, 0x0F, 0x09, 0x40, 0x60, 0xF0, 0x21, 0xF0, 0x20, 0xC0, 0x61,
+0xF2, 0x70, 0x00, 0x50, 0x30, 0xD0, 0x0F, 0x0B, 0x0F, 0x0C, 0xA0, 0x02, 0xA0, 0xC0, 0x61, 0x21,
+0xF0, 0x2F, 0x0C, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x02, 0x60, 0xF0, 0x20, 0xF0, 0xC0, 0x60,
+0x23, 0xF0, 0x60, 0xA0, 0x30, 0x09, 0x50, 0x40, 0x04, 0xA0, 0x40, 0x06, 0xB0, 0x40, 0x0B, 0x90,
+0x50, 0x09, 0x30, 0x01, 0xB0, 0x40, 0xB0, 0x03, 0x51, 0x02, 0x40, 0xA0, 0x0A, 0xB0, 0x50, 0x0D,
+0x50, 0xB0, 0x0C, 0x50, 0xB0, 0x0C, 0x90, 0x0E, 0x90, 0x00, 0x50, 0x70, 0x50, 0x0C, 0x40, 0x04,
+0x91, 0x01, 0x90, 0xB0, 0x09, 0x40, 0x0B, 0x50, 0x40, 0x0D, 0xB0, 0x40, 0x01, 0x50, 0x80, 0x0B,
+0xB0, 0x40, 0x30, 0xA1, 0x40, 0xB0, 0x00, 0x90, 0x0F, 0x03, 0x40, 0x90, 0x0F, 0x07, 0xB0, 0xA0,
+0xF0, 0x23, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0x80, 0x90, 0x02, 0x30, 0x0F, 0x0B, 0x0F, 0x0C, 0x30,
+0xB0, 0x00, 0x90, 0x70, 0x30, 0xF1, 0x2F, 0x0F, 0x61, 0x20, 0xF0, 0x2F, 0x03, 0xC1, 0xF0, 0x60,
+0xC0, 0x23, 0xF0, 0x60, 0xA0, 0x0A, 0x91, 0x04, 0x50, 0xE0, 0x06, 0xB0, 0x40, 0x0B, 0x50, 0x90,
+0x09, 0x50, 0xA0, 0x03, 0x91, 0x02, 0x40, 0x04, 0x50, 0xA0, 0xB0, 0x08, 0x40, 0x0E, 0x40, 0x0D,
+0x50, 0xB0, 0x0C, 0x90, 0xB0, 0x0D, 0x90, 0xB0, 0x01, 0xA0, 0x0C, 0x51, 0x01, 0x50, 0x40, 0xB0,
+0x03, 0x40, 0x0A, 0x40, 0x0B, 0x50, 0x40, 0x0E, 0x40, 0x01, 0x30, 0x06, 0xB0, 0x50, 0x40, 0x30,
+0xA0, 0x80, 0x90, 0xB0, 0x00, 0x90, 0xB0, 0x00, 0x90, 0x0F, 0x05, 0xB0, 0x40, 0x50, 0x0F, 0x06,
+0x30, 0x60, 0x27, 0xC0, 0xD0, 0x80, 0x50, 0x00, 0x30, 0xB0, 0x0F, 0x0B, 0x0F, 0x0C, 0xB0, 0x70,
+0x30, 0xE0, 0x00, 0xA0, 0xF0, 0x2F, 0x0D, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x2F, 0x05, 0xF0, 0x61,
+0xC0, 0x24, 0xF0, 0xA0, 0x0A, 0x40, 0x50, 0x05, 0x50, 0xE0, 0x06, 0x40, 0x0B, 0xB0, 0x40, 0x09,
+0xB0, 0x40, 0x30, 0x04, 0xB0, 0x40, 0x51, 0xB0, 0x05, 0xB0, 0xA0, 0x50, 0x07, 0x40, 0x0E, 0x40,
+0x0D, 0x50, 0xB0, 0x0C, 0x51, 0x0D, 0xB0, 0x90, 0x01, 0xE0, 0x40, 0x0C, 0x40, 0x00, 0x40, 0x50,
+0x02, 0x90, 0xE0, 0x01, 0x90, 0x09, 0xB0, 0x40, 0x0B, 0x50, 0x90, 0x0E, 0x40, 0xB0, 0xA0, 0x02,
+0xB0, 0x90, 0x30, 0xA0, 0x80, 0xE0, 0x90, 0xB0, 0x05, 0x50, 0xE0, 0x50, 0x0F, 0x07, 0x50, 0x40,
+0xB0, 0x0F, 0x04, 0xB0, 0xA0, 0xF0, 0x25, 0xF0, 0x60, 0xE0, 0x50, 0x32, 0x0F, 0x0C, 0x0F, 0x0D,
+0x30, 0xB0, 0x01, 0x40, 0x80, 0xF0, 0x22, 0xF0, 0x2F, 0x05, 0xF0, 0x20, 0xC0, 0x60, 0xC0, 0xF0,
+0x2F, 0x05, 0xF1, 0x62, 0xF0, 0x23, 0xF0, 0xC0, 0x30, 0x09, 0x40, 0xB0, 0x06, 0x50, 0x80, 0x05,
+0xE0, 0x0C, 0x40, 0x0A, 0x40, 0x00, 0x30, 0x06, 0x50, 0x30, 0xB0, 0x07, 0x30, 0x40, 0x05, 0x51,
+0x0E, 0x90, 0x0D, 0x50, 0xB0, 0x0C, 0xB0, 0x50, 0x0E, 0x40, 0x02, 0xA0, 0x0C, 0x40, 0xE0, 0x03,
+0xA0, 0xE0, 0x90, 0x31, 0x80, 0x50, 0x09, 0x50, 0x90, 0x0B, 0x50, 0x90, 0x0E, 0x90, 0x30, 0xA0,
+0x31, 0x80, 0x40, 0xB0, 0x0B, 0x41, 0x50, 0x0F, 0x08, 0x90, 0x40, 0x0F, 0x04, 0xE0, 0x60, 0xF0,
+0x23, 0xF1, 0xA0, 0x02, 0x30, 0x50, 0x0F, 0x0C, 0x0F, 0x0D, 0x50, 0x30, 0x01, 0x40, 0xD0, 0xF0,
+0x2F, 0x08, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x05, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0xC0, 0x60,
+0xF0, 0x22, 0xF0, 0x80, 0x50, 0x07, 0xB0, 0x40, 0x08, 0x90, 0x40, 0x03, 0xB0, 0x40, 0x0C, 0xE0,
+0x0A, 0x90, 0xB0, 0x00, 0xA0, 0x06, 0x90, 0x00, 0x90, 0x40, 0xB0, 0x06, 0xE0, 0x30, 0x04, 0x40,
+0x0E, 0xB0, 0x90, 0x0D, 0x50, 0xB0, 0x0D, 0x40, 0x0E, 0x51, 0x01, 0x80, 0x70, 0x30, 0x80, 0x40,
+0x90, 0xB0, 0x04, 0x50, 0x40, 0x00, 0x90, 0xB0, 0x00, 0x40, 0xA0, 0xB0, 0x03, 0x40, 0x30, 0x80,
+0x90, 0x08, 0x51, 0x0B, 0x50, 0x40, 0x0E, 0x41, 0x0F, 0x00, 0x40, 0x01, 0x91, 0x0F, 0x09, 0x40,
+0x90, 0x0F, 0x02, 0xB0, 0x70, 0x80, 0x60, 0xF3, 0x60, 0x70, 0x50, 0x00, 0xB0, 0x30, 0x0F, 0x0D,
+0x0F, 0x0E, 0x80, 0xE0, 0xA0, 0x90, 0x40, 0x80, 0xF0, 0x2F, 0x05, 0xF1, 0x61, 0x2F, 0x07, 0xF0,
+0x20, 0xC0, 0x60, 0xF0, 0x21, 0xF0, 0x60, 0xC0, 0xF0, 0x21, 0xF0, 0x70, 0x30, 0xE0, 0x90, 0xB0,
+0x03, 0xB0, 0x40, 0x09, 0x40, 0x90, 0x02, 0xB0, 0x40, 0x0C, 0x40, 0xB0, 0x09, 0xB0, 0x90, 0x01,
+0xA0, 0x05, 0xB0, 0x90, 0x02, 0x91, 0xB0, 0x05, 0x40, 0xA0, 0x02, 0xB0, 0x90, 0x0E, 0x51, 0x0D,
+0x50, 0xB0, 0x0D, 0x40, 0x0F, 0x00, 0x90, 0xB0, 0xA0, 0x90, 0x00, 0xB0, 0x50, 0x90, 0x40, 0x80,
+0xA0, 0x30, 0x40, 0xB0, 0x40, 0x50, 0x02, 0x40, 0x80, 0xE0, 0x07, 0xE1, 0xA0, 0xE0, 0x50, 0x06,
+0x40, 0xB0, 0x0B, 0x50, 0x40, 0x0D, 0x50, 0x80, 0x40, 0x0D, 0x90, 0xB0, 0x02, 0xB0, 0x40, 0xB0,
+0x0F, 0x08, 0xB0, 0x40, 0x50, 0x0F, 0x01, 0xB0, 0x90, 0xE0, 0xA0, 0x80, 0xF0, 0x50, 0xA0, 0x50,
+0x82, 0x50, 0x0F, 0x0D, 0x0F, 0x0E, 0x50, 0x70, 0x02, 0xA0, 0xF0, 0x2F, 0x05, 0x61, 0xC0, 0xF0,
+0x2F, 0x06, 0xF0, 0x20, 0x60, 0xC0, 0x25, 0x60, 0x21, 0xF0, 0xC0, 0x10, 0xB0, 0x50, 0x40, 0x80,
+0xA0, 0x30, 0x40, 0x90, 0x40, 0x0A, 0xE0, 0x50, 0x02, 0x40, 0x0C, 0x51, 0x0A, 0x40, 0x02, 0xA0,
+0x05, 0x40, 0x04, 0xB0, 0x91, 0x05, 0x50, 0xA0, 0x50, 0x00, 0x50, 0xB0, 0x0E, 0x50, 0xB0, 0x0D,
+0x50, 0xB0, 0x0D, 0x90, 0xB0, 0x0E, 0xE0, 0x30, 0xB0, 0x07, 0x50, 0x80, 0x70, 0xB0, 0x02, 0x90,
+0xA0, 0xE0, 0x08, 0x51, 0x00, 0x50, 0x80, 0xA0, 0x40, 0x05, 0x40, 0xB0, 0x0B, 0x50, 0x90, 0x0C,
+0xB0, 0x80, 0x00, 0x40, 0xB0, 0x0A, 0x50, 0x90, 0x05, 0x91, 0x0F, 0x09, 0x50, 0x40, 0xB0, 0x0F,
+0x03, 0xA0, 0xD0, 0x70, 0xE0, 0x01, 0x90, 0xA0, 0x0F, 0x0E, 0x0F, 0x0F, 0xA0, 0x02, 0x70, 0x60,
+0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x05, 0xF1, 0xC0, 0x60, 0x26, 0xF0, 0xC0,
+0x60, 0xF1, 0x30, 0xD0, 0x80, 0x04, 0x80, 0x40, 0x80, 0xA1, 0xE0, 0x90, 0x06, 0x30, 0x02, 0xE0,
+0x0C, 0x50, 0x90, 0x0A, 0x90, 0xB0, 0x02, 0x30, 0x04, 0x51, 0x07, 0x41, 0xB0, 0x04, 0xA0, 0x50,
+0x40, 0x0F, 0x00, 0x90, 0x0E, 0x50, 0xB0, 0x0D, 0x50, 0xB0, 0x0D, 0xA0, 0xE0, 0x50, 0x06, 0x50,
+0xE0, 0x50, 0x01, 0x70, 0x40, 0x00, 0xA0, 0xE0, 0x00, 0xE0, 0x09, 0x90, 0xB0, 0x02, 0x40, 0x30,
+0xA0, 0x40, 0x03, 0x40, 0x0C, 0x50, 0x40, 0x0C, 0x30, 0x01, 0x40, 0x50, 0x08, 0xB0, 0x40, 0x07,
+0x50, 0x40, 0x0F, 0x0A, 0x90, 0x40, 0x0F, 0x04, 0x10, 0x50, 0x01, 0xE0, 0x50, 0x0F, 0x0E, 0x0F,
+0x0F, 0xB0, 0x30, 0x40, 0xA0, 0x90, 0x70, 0xF1, 0x2D, 0xF0, 0xC0, 0x61, 0x2F, 0x08, 0xF0, 0x20,
+0x61, 0xF0, 0x27, 0xF0, 0xC0, 0x60, 0xF0, 0xA0, 0x60, 0xA0, 0x03, 0x40, 0xB0, 0x03, 0x50, 0xE0,
+0xA1, 0x30, 0x80, 0x40, 0x50, 0x00, 0xA0, 0x00, 0xB0, 0x40, 0x0C, 0xB0, 0x40, 0x0A, 0x50, 0x90,
+0x03, 0xA0, 0x04, 0x40, 0x08, 0x40, 0x00, 0x90, 0x40, 0x50, 0x03, 0x30, 0xE0, 0x0F, 0x00, 0x40,
+0x0E, 0x50, 0xB0, 0x0D, 0xB0, 0x50, 0x0B, 0x40, 0xA0, 0xB0, 0x00, 0x40, 0x03, 0xB0, 0x90, 0x40,
+0x51, 0xB0, 0x02, 0xE0, 0x70, 0xB0, 0x01, 0x30, 0x50, 0x09, 0x40, 0x05, 0x40, 0xA1, 0x90, 0x01,
+0x40, 0x0C, 0x50, 0x40, 0x0B, 0xA0, 0x02, 0x90, 0x50, 0x07, 0x40, 0x0A, 0x40, 0x50, 0x0F, 0x0A,
+0x40, 0x90, 0x0F, 0x01, 0x40, 0x30, 0x80, 0x30, 0x50, 0xA0, 0x0F, 0x0F, 0x0F, 0x10, 0xA0, 0x40,
+0x01, 0xE0, 0x80, 0xF0, 0x2B, 0xF1, 0xC0, 0x60, 0xC0, 0x2F, 0x08, 0xF0, 0xC0, 0x60, 0x20, 0xF0,
+0x29, 0xF0, 0x60, 0xC0, 0xF1, 0x31, 0xB0, 0x00, 0x40, 0x0A, 0x50, 0x90, 0xE0, 0xA0, 0x70, 0x00,
+0x40, 0x0D, 0x40, 0x0B, 0x40, 0x04, 0xA0, 0x03, 0x90, 0xB0, 0x08, 0x90, 0x02, 0x50, 0x40, 0x50,
+0xB0, 0x00, 0x50, 0xE0, 0x30, 0x0E, 0x90, 0x0E, 0x50, 0xB0, 0x0D, 0xB0, 0x90, 0x0A, 0x30, 0x80,
+0x02, 0x90, 0x01, 0xB0, 0x91, 0xB0, 0x02, 0x40, 0x07, 0x90, 0x30, 0x09, 0xB0, 0x40, 0x06, 0xB0,
+0xE0, 0xA0, 0xE0, 0x40, 0x90, 0x0C, 0x50, 0x40, 0x0A, 0x30, 0x03, 0x91, 0x05, 0x40, 0xB0, 0x0B,
+0x50, 0x40, 0x0F, 0x0A, 0xB0, 0x40, 0x50, 0x0E, 0xD0, 0x02, 0x70, 0x50, 0x0F, 0x0F, 0x0F, 0x10,
+0x50, 0xE0, 0x02, 0x70, 0xF0, 0x2A, 0xF0, 0xC0, 0x60, 0xC0, 0xF1, 0x2F, 0x06, 0xF1, 0x60, 0xC0,
+0xF0, 0x2C, 0xF0, 0x60, 0x21, 0xF0, 0xA0, 0xE0, 0x40, 0x0F, 0x01, 0x40, 0x0D, 0x40, 0x0B, 0x40,
+0xB0, 0x04, 0xA0, 0x03, 0x40, 0x08, 0x90, 0xB0, 0x04, 0xB0, 0x90, 0x40, 0xE0, 0x00, 0x50, 0xA0,
+0x0C, 0xB0, 0x50, 0x0E, 0x50, 0xB0, 0x0E, 0x40, 0x08, 0x50, 0xA0, 0x90, 0x03, 0x50, 0x41, 0x50,
+0x05, 0x90, 0xB0, 0x06, 0xB0, 0x30, 0x90, 0x09, 0x90, 0xB0, 0x08, 0x50, 0xE0, 0xA0, 0x40, 0x0C,
+0x50, 0x90, 0x09, 0xE0, 0x90, 0x03, 0x50, 0x40, 0x03, 0x51, 0x0D, 0xB0, 0x40, 0xB0, 0x0F, 0x0A,
+0x50, 0x40, 0xB0, 0x0B, 0x40, 0xA0, 0x02, 0xA0, 0x00, 0x80, 0x50, 0x0F, 0x0D, 0x0F, 0x11, 0x30,
+0xB0, 0x40, 0xA0, 0x81, 0xF0, 0x27, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x08, 0xF0, 0xC0, 0x60,
+0xC0, 0x2F, 0x01, 0x60, 0xF1, 0x60, 0x80, 0x0F, 0x01, 0xE0, 0x0D, 0x40, 0xB0, 0x0A, 0x50, 0x90,
+0x05, 0xA0, 0x02, 0x40, 0x09, 0x90, 0x07, 0xB0, 0x41, 0x91, 0x70, 0x50, 0x0A, 0x50, 0xB0, 0x0E,
+0x50, 0xB0, 0x0E, 0x40, 0x07, 0x80, 0x30, 0x03, 0x90, 0x40, 0x90, 0x40, 0x08, 0x90, 0x07, 0x30,
+0x90, 0xB0, 0x09, 0x40, 0x0B, 0x40, 0xA1, 0x40, 0x0A, 0x50, 0x90, 0x08, 0x50, 0xE0, 0x04, 0xB0,
+0x40, 0x01, 0xB0, 0x40, 0x0F, 0x01, 0x91, 0x0F, 0x0B, 0x41, 0x0A, 0x10, 0xE0, 0xA0, 0xB0, 0x80,
+0x50, 0x30, 0x50, 0x30, 0x0F, 0x0D, 0x0F, 0x11, 0xB0, 0xD0, 0x90, 0x01, 0xA0, 0xC0, 0x24, 0xF2,
+0x60, 0xC0, 0xF1, 0x2F, 0x09, 0x61, 0xF0, 0x2F, 0x01, 0xF0, 0xC0, 0x61, 0xC0, 0xA0, 0xB0, 0x0D,
+0xB0, 0x40, 0x0D, 0x90, 0x50, 0x0A, 0xB0, 0x40, 0x06, 0xA0, 0x01, 0xB0, 0x90, 0x08, 0x90, 0xB0,
+0x07, 0x40, 0x02, 0xB0, 0x90, 0x30, 0x40, 0x09, 0x90, 0xB0, 0x0E, 0x50, 0xB0, 0x0E, 0x90, 0x05,
+0x50, 0xA0, 0x50, 0x00, 0xB0, 0x90, 0x40, 0x90, 0xB0, 0x01, 0x90, 0xB0, 0x07, 0x90, 0x07, 0xA0,
+0x00, 0x40, 0x09, 0xB0, 0x40, 0x0B, 0x90, 0x00, 0x40, 0xA0, 0x30, 0x90, 0x08, 0x50, 0x40, 0x08,
+0x30, 0x06, 0x40, 0x50, 0x90, 0x0F, 0x03, 0xB0, 0x40, 0xB0, 0x0F, 0x0B, 0x40, 0x50, 0x06, 0xB0,
+0xD0, 0xE0, 0x01, 0x30, 0xA0, 0x00, 0x40, 0x30, 0xE0, 0x0F, 0x0D, 0x0F, 0x0F, 0xB0, 0x50, 0x00,
+0xE0, 0x50, 0x01, 0x90, 0xA0, 0xF0, 0x22, 0xF0, 0x20, 0x61, 0x2F, 0x0C, 0x60, 0xC0, 0x2F, 0x03,
+0xF1, 0x61, 0x50, 0xA0, 0x0D, 0xB0, 0x40, 0x0D, 0x50, 0x90, 0x0B, 0x40, 0x07, 0xA0, 0x01, 0x40,
+0x09, 0x40, 0x08, 0x90, 0x05, 0xE0, 0x30, 0x40, 0x51, 0xB0, 0x04, 0x90, 0x0F, 0x00, 0x50, 0xB0,
+0x0E, 0x51, 0x03, 0xE0, 0xA0, 0x91, 0x40, 0x50, 0xB0, 0x04, 0xB0, 0x90, 0x07, 0xB0, 0x90, 0x06,
+0xA0, 0x00, 0x51, 0x09, 0x51, 0x0B, 0x40, 0x01, 0xB0, 0x40, 0xA0, 0xE0, 0x50, 0x06, 0x50, 0x40,
+0x07, 0x30, 0x07, 0xE0, 0x50, 0x0F, 0x05, 0x40, 0x50, 0x0F, 0x0B, 0xB0, 0x40, 0x50, 0x04, 0x40,
+0x10, 0x02, 0x80, 0xB0, 0x0F, 0x11, 0x0F, 0x0F, 0xE0, 0x70, 0x30, 0xB0, 0x30, 0x00, 0xE0, 0x30,
+0xA0, 0xC0, 0x22, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x0A, 0xC0, 0x60, 0x20, 0xF0, 0x2F, 0x02, 0xF0,
+0xC0, 0x60, 0xC1, 0x70, 0x80, 0x0D, 0x40, 0x0D, 0xB0, 0x40, 0x0B, 0x90, 0x50, 0x07, 0xA0, 0x00,
+0x51, 0x08, 0x90, 0xB0, 0x07, 0x51, 0x06, 0x90, 0x30, 0xB1, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x00,
+0x40, 0x0F, 0x00, 0x90, 0xB0, 0x0E, 0xB0, 0x90, 0x00, 0xB0, 0x90, 0xE1, 0x50, 0xB1, 0x90, 0x07,
+0x90, 0x08, 0x40, 0x06, 0x90, 0x80, 0x00, 0x40, 0x0A, 0x90, 0x0C, 0x40, 0x03, 0x50, 0xE0, 0xA0,
+0x40, 0xB0, 0x04, 0x50, 0x90, 0x06, 0xA0, 0x06, 0x40, 0xB0, 0x50, 0x90, 0x0F, 0x05, 0x50, 0x40,
+0x0F, 0x0C, 0x90, 0x40, 0xB0, 0x01, 0xB0, 0x70, 0x80, 0x30, 0x51, 0x80, 0x50, 0x71, 0xE0, 0x0F,
+0x0E, 0x0F, 0x11, 0x80, 0x90, 0xE0, 0xA0, 0x90, 0x01, 0xA0, 0xF0, 0xC0, 0x61, 0x2F, 0x0B, 0xF0,
+0x60, 0xC0, 0xF0, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0x20, 0xF1, 0x70, 0xB0, 0x0C, 0xE0, 0x0E, 0x40,
+0x0B, 0xB0, 0x90, 0x08, 0xA0, 0x00, 0x40, 0x09, 0x40, 0x08, 0x40, 0x08, 0x40, 0xA0, 0x90, 0x02,
+0x50, 0x91, 0xE0, 0x41, 0x50, 0xB0, 0x0B, 0x50, 0xB0, 0x0B, 0x50, 0x90, 0x41, 0xE0, 0x50, 0x30,
+0xA0, 0xB0, 0x03, 0x40, 0x07, 0x51, 0x07, 0xB0, 0x90, 0x06, 0x80, 0x40, 0x00, 0x90, 0x0A, 0x40,
+0x0B, 0x50, 0x90, 0x05, 0x90, 0x30, 0xA0, 0xE0, 0x03, 0x50, 0x40, 0x00, 0xB0, 0xE0, 0xA1, 0x30,
+0x40, 0x05, 0x40, 0x50, 0x01, 0x50, 0x40, 0x0F, 0x05, 0xB0, 0x40, 0x50, 0x0F, 0x0C, 0x40, 0x90,
+0x80, 0xA0, 0x70, 0x01, 0x80, 0xD0, 0xB0, 0x70, 0xB1, 0x30, 0x10, 0x50, 0x0F, 0x0C, 0x0F, 0x0B,
+0x30, 0x10, 0x70, 0xE0, 0xB0, 0x00, 0xA0, 0x40, 0x00, 0xA0, 0x02, 0xD0, 0x61, 0xF1, 0x26, 0xF0,
+0x2E, 0xF0, 0x21, 0xC0, 0x60, 0x20, 0xF0, 0x2F, 0x03, 0xF0, 0xC0, 0x60, 0xF0, 0x20, 0xF0, 0x71,
+0x90, 0xB0, 0x09, 0xB0, 0x40, 0x0E, 0x40, 0x0C, 0x40, 0x09, 0xA0, 0x90, 0xB0, 0x08, 0x51, 0x07,
+0xB0, 0x90, 0x07, 0x90, 0xB0, 0x00, 0x80, 0x30, 0x03, 0xB0, 0x50, 0x01, 0xB0, 0x90, 0x44, 0x94,
+0x51, 0x40, 0x90, 0x51, 0x94, 0x40, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x01, 0x90, 0xA0, 0x40, 0x05,
+0x90, 0x08, 0x40, 0x08, 0x40, 0x07, 0x30, 0x91, 0x0A, 0x50, 0x90, 0x0B, 0x50, 0x90, 0x07, 0x90,
+0xA0, 0x30, 0x40, 0x01, 0xB0, 0x90, 0xA0, 0x50, 0x08, 0x90, 0x50, 0x03, 0xB0, 0x40, 0x0F, 0x06,
+0x90, 0x40, 0x0F, 0x0C, 0xB0, 0xE0, 0xD0, 0xE0, 0x01, 0x50, 0xE0, 0x00, 0x70, 0x02, 0xB0, 0x10,
+0xB0, 0x0F, 0x0B, 0x0F, 0x0B, 0xB0, 0xD0, 0xB0, 0x80, 0x70, 0xD0, 0x80, 0x01, 0xE0, 0x40, 0xE0,
+0x11, 0x70, 0xF0, 0x26, 0xC0, 0x30, 0x60, 0xF0, 0x2E, 0xF0, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0xC1,
+0xF0, 0x21, 0xF0, 0xD0, 0x01, 0x40, 0x08, 0xB0, 0x40, 0x0E, 0x40, 0xB0, 0x0B, 0x40, 0xB0, 0x09,
+0x30, 0x90, 0x09, 0x40, 0x08, 0x50, 0xB0, 0x07, 0x40, 0x02, 0x50, 0xA0, 0x50, 0x01, 0x90, 0xB0,
+0x06, 0x51, 0x02, 0xB3, 0x90, 0x50, 0xB3, 0x02, 0x40, 0x06, 0x40, 0xA0, 0xB0, 0x06, 0x51, 0x07,
+0x40, 0x08, 0x51, 0x06, 0x90, 0xE0, 0x00, 0x40, 0x0A, 0x40, 0xB0, 0x0B, 0x90, 0x50, 0x08, 0xB0,
+0x40, 0xA0, 0x80, 0x51, 0x30, 0x08, 0x90, 0x50, 0x06, 0x40, 0xB0, 0x0F, 0x05, 0xB0, 0x40, 0xB0,
+0x0F, 0x0B, 0x80, 0x11, 0x70, 0x50, 0xA0, 0x01, 0x40, 0xD0, 0x50, 0x01, 0xE1, 0x0F, 0x0B, 0x0F,
+0x0C, 0x30, 0xE0, 0x06, 0xD0, 0x10, 0xD0, 0x50, 0xE0, 0x80, 0xF0, 0x24, 0xF0, 0x31, 0xD0, 0xF0,
+0x2D, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0x60, 0xC0, 0xF0, 0x22, 0xF0, 0x60, 0x80, 0x01, 0x40,
+0x07, 0x40, 0x0E, 0x90, 0xB0, 0x0B, 0x50, 0x90, 0x0A, 0xE0, 0x09, 0x51, 0x08, 0x40, 0x08, 0x40,
+0x04, 0x30, 0xE0, 0x00, 0x90, 0x07, 0x90, 0xB0, 0x06, 0x50, 0xB0, 0x06, 0x90, 0x05, 0x30, 0xE0,
+0x90, 0x07, 0xB0, 0x90, 0x07, 0xB0, 0x50, 0x08, 0x40, 0x06, 0xB0, 0xA0, 0xB0, 0x50, 0xB0, 0x0A,
+0x40, 0x0C, 0x40, 0x0B, 0x50, 0xE0, 0x30, 0x70, 0x90, 0x06, 0x50, 0x90, 0x08, 0x40, 0x50, 0x0F,
+0x06, 0x91, 0x0F, 0x0A, 0xD0, 0x00, 0xE0, 0x11, 0x40, 0xB0, 0xE0, 0xB0, 0x90, 0xD0, 0x30, 0x40,
+0x70, 0xB0, 0x0F, 0x0B, 0x0F, 0x0C, 0xB0, 0x70, 0x00, 0x90, 0xE0, 0x40, 0x90, 0xB0, 0x00, 0x50,
+0xA0, 0x02, 0xA0, 0xC0, 0xF0, 0x24, 0xC0, 0x80, 0xD0, 0xC0, 0xF0, 0x29, 0xF1, 0xC0, 0x60, 0x2F,
+0x04, 0xF1, 0x20, 0x60, 0x20, 0xF0, 0x24, 0xF0, 0xA0, 0x01, 0xB0, 0x40, 0x05, 0x40, 0x0E, 0x50,
+0x90, 0x0C, 0x40, 0x0A, 0xB0, 0x70, 0x09, 0x40, 0x08, 0xB0, 0x90, 0x07, 0xB0, 0x90, 0x05, 0xA0,
+0x00, 0x40, 0x07, 0x90, 0x07, 0x90, 0xB0, 0x06, 0x90, 0xB0, 0x02, 0x90, 0x70, 0x50, 0x00, 0x51,
+0x07, 0x40, 0x08, 0x40, 0x08, 0x51, 0x07, 0x70, 0xB0, 0x40, 0x0A, 0xB0, 0x90, 0x0C, 0xE0, 0x0D,
+0x80, 0x40, 0x90, 0x04, 0xB0, 0x40, 0x0A, 0x91, 0x0F, 0x06, 0xB0, 0x40, 0xB0, 0x0F, 0x07, 0x80,
+0xE0, 0x01, 0xB0, 0x70, 0x00, 0xD0, 0x80, 0x10, 0xB0, 0x00, 0x90, 0x80, 0x50, 0x0F, 0x0C, 0x0F,
+0x0F, 0x31, 0x90, 0xE0, 0x11, 0x00, 0x80, 0x50, 0x00, 0x30, 0xA1, 0xF0, 0x24, 0xF1, 0x80, 0xF0,
+0x20, 0xF0, 0x27, 0xF0, 0xC0, 0x60, 0xC0, 0xF0, 0x2F, 0x03, 0xF1, 0xC0, 0x60, 0xF0, 0x26, 0xF0,
+0x30, 0xB0, 0x01, 0xB0, 0x40, 0x02, 0xB0, 0x40, 0x0E, 0xB0, 0x40, 0x0C, 0x40, 0x0B, 0x90, 0x30,
+0x08, 0x51, 0x08, 0x90, 0x08, 0x90, 0xB0, 0x05, 0x70, 0xB0, 0x90, 0x07, 0x90, 0x07, 0x50, 0xB0,
+0x06, 0x50, 0xB0, 0x01, 0xA0, 0x80, 0x03, 0x90, 0x07, 0x90, 0xB0, 0x07, 0x40, 0x09, 0x40, 0x08,
+0x70, 0xB0, 0x50, 0x0A, 0x90, 0x50, 0x0C, 0x40, 0x0C, 0x90, 0x40, 0xB0, 0x40, 0x02, 0xB0, 0x40,
+0x0C, 0x50, 0x40, 0x0F, 0x07, 0x40, 0x90, 0x0F, 0x05, 0xB0, 0xD0, 0x30, 0x40, 0x00, 0x80, 0x50,
+0x80, 0x90, 0x00, 0x90, 0xA0, 0x0F, 0x10, 0x0F, 0x10, 0x70, 0x50, 0x70, 0x30, 0x01, 0xB0, 0xA0,
+0x30, 0x50, 0x00, 0x80, 0x60, 0xF0, 0x26, 0xF0, 0xC0, 0x30, 0xC0, 0xF0, 0x23, 0xF1, 0xC0, 0x60,
+0x2F, 0x06, 0xF0, 0x61, 0x28, 0xF0, 0x30, 0xB0, 0x02, 0xB0, 0x40, 0x00, 0xB0, 0x40, 0x0E, 0xB0,
+0x40, 0x0C, 0x51, 0x0A, 0x50, 0xB0, 0x80, 0xB0, 0x07, 0x40, 0x09, 0x40, 0x08, 0x40, 0x06, 0xB0,
+0x30, 0xE0, 0x07, 0x40, 0x07, 0x90, 0xB0, 0x06, 0x51, 0x00, 0x30, 0x40, 0x04, 0x40, 0x07, 0xB0,
+0x50, 0x07, 0xB0, 0x90, 0x08, 0x51, 0x06, 0x90, 0xE0, 0x00, 0x40, 0x0B, 0x40, 0x0C, 0xB0, 0x90,
+0x0C, 0x30, 0x00, 0x50, 0x40, 0x00, 0xB0, 0x40, 0x0E, 0xB0, 0x40, 0x0F, 0x07, 0x50, 0x40, 0x0F,
+0x04, 0x70, 0x50, 0x00, 0xE0, 0xA0, 0x80, 0x00, 0x40, 0x30, 0x01, 0x70, 0x00, 0x80, 0xE0, 0x0F,
+0x0D, 0x0F, 0x0F, 0xB0, 0xD0, 0x10, 0x90, 0x03, 0xE0, 0x40, 0x02, 0x70, 0xF0, 0x27, 0xC0, 0xD1,
+0xF0, 0x22, 0xF1, 0x60, 0xC0, 0xF0, 0x2F, 0x05, 0xF0, 0x60, 0xC0, 0x20, 0xF0, 0x27, 0xF0, 0x30,
+0xB0, 0x03, 0xB0, 0x41, 0x0F, 0x00, 0x40, 0x0D, 0x40, 0x0B, 0x40, 0x00, 0x80, 0xB0, 0x06, 0xB0,
+0x90, 0x08, 0x51, 0x07, 0xB0, 0x90, 0x08, 0xA0, 0x90, 0x06, 0x40, 0x07, 0x50, 0xB0, 0x06, 0xB0,
+0x50, 0xA0, 0x90, 0x05, 0x40, 0x08, 0x90, 0x08, 0x40, 0x09, 0x40, 0x06, 0xA0, 0x01, 0xB0, 0x40,
+0x0B, 0x40, 0x0C, 0x50, 0x90, 0x0B, 0x30, 0x01, 0xB0, 0x40, 0x90, 0x0F, 0x01, 0xB0, 0x40, 0xB0,
+0x0F, 0x07, 0x40, 0x50, 0x0F, 0x01, 0x90, 0xA0, 0x02, 0xA0, 0xB0, 0x01, 0x90, 0x01, 0x70, 0x50,
+0x70, 0x0F, 0x0E, 0x0F, 0x0F, 0x30, 0x40, 0x80, 0x00, 0x90, 0xD1, 0x30, 0x00, 0x70, 0x01, 0x30,
+0xA0, 0x80, 0xF0, 0x2C, 0xF0, 0xC0, 0x80, 0x70, 0xF0, 0x2F, 0x05, 0xF0, 0x60, 0xC0, 0x29, 0xF1,
+0xA0, 0xB0, 0x04, 0xE0, 0x40, 0x0E, 0x40, 0xB0, 0x0C, 0x40, 0x0B, 0x40, 0xB0, 0x00, 0xE0, 0xB0,
+0x06, 0x40, 0x09, 0x40, 0x08, 0x51, 0x07, 0x50, 0xB0, 0xA0, 0x31, 0x50, 0x03, 0x40, 0x07, 0x50,
+0xB0, 0x07, 0x70, 0x50, 0x06, 0x90, 0x08, 0x40, 0x08, 0x90, 0xB0, 0x08, 0x90, 0xB0, 0x05, 0x30,
+0x02, 0x40, 0x0B, 0x90, 0x50, 0x0C, 0x90, 0x50, 0x0A, 0x30, 0x01, 0xB0, 0xE0, 0x90, 0x0F, 0x03,
+0x40, 0x50, 0x0F, 0x07, 0x50, 0x40, 0x0F, 0x00, 0x10, 0xA0, 0x40, 0x00, 0x41, 0x90, 0x70, 0xB0,
+0x02, 0x30, 0x10, 0x90, 0x0F, 0x0E, 0x0F, 0x12, 0x71, 0xB0, 0x00, 0xE0, 0x40, 0xB0, 0x70, 0xA0,
+0xB0, 0x00, 0xA0, 0xC0, 0xF0, 0x28, 0xF0, 0x21, 0x61, 0xC0, 0x60, 0xF0, 0x2F, 0x03, 0xF0, 0x20,
+0x60, 0xC0, 0x2B, 0xF0, 0xA0, 0xB0, 0x02, 0xB0, 0x40, 0x00, 0xB0, 0x40, 0x0C, 0x40, 0xB0, 0x0C,
+0x90, 0x50, 0x0B, 0x40, 0x01, 0xE0, 0x50, 0x06, 0x40, 0x09, 0x40, 0x08, 0x90, 0xB0, 0x07, 0x40,
+0x01, 0x50, 0xB0, 0xA0, 0x90, 0x02, 0x90, 0x07, 0x50, 0xB0, 0x05, 0xB0, 0x70, 0x50, 0x07, 0x50,
+0xB0, 0x07, 0x90, 0xB0, 0x08, 0x90, 0x09, 0x40, 0x05, 0x30, 0x03, 0x40, 0x0B, 0x40, 0xB0, 0x0C,
+0x40, 0xB0, 0x09, 0x30, 0x00, 0xB0, 0x40, 0x00, 0x50, 0x40, 0x0F, 0x03, 0x91, 0x0F, 0x08, 0x40,
+0xB0, 0x0C, 0x30, 0x40, 0x00, 0x40, 0xA1, 0x00, 0xB0, 0xD1, 0x30, 0x01, 0xB0, 0x30, 0x0F, 0x0F,
+0x0F, 0x11, 0x70, 0xE0, 0x02, 0x80, 0x40, 0x00, 0x30, 0x50, 0x01, 0xB0, 0xA0, 0xF0, 0x28, 0xF0,
+0xC0, 0x60, 0x21, 0xF1, 0x2F, 0x04, 0xC0, 0x60, 0x20, 0xF0, 0x2B, 0xF0, 0xA0, 0x02, 0xB0, 0x40,
+0x02, 0xB0, 0x40, 0x0A, 0x51, 0x0C, 0xB0, 0x90, 0x0B, 0x40, 0x02, 0xE0, 0x50, 0x05, 0x90, 0x09,
+0x51, 0x08, 0x40, 0x08, 0x40, 0x04, 0xE0, 0x30, 0xA0, 0x40, 0x50, 0x07, 0x90, 0xB0, 0x04, 0x50,
+0xA0, 0xB0, 0x90, 0x07, 0x51, 0x07, 0xB0, 0x50, 0x08, 0x40, 0x09, 0x90, 0xB0, 0x04, 0x30, 0x03,
+0x90, 0x50, 0x0B, 0x40, 0x0D, 0x40, 0x09, 0x30, 0x50, 0x40, 0x02, 0x50, 0x40, 0x0F, 0x03, 0x50,
+0x90, 0x0F, 0x08, 0x91, 0x0A, 0x90, 0xD0, 0x02, 0x30, 0x50, 0x00, 0xB0, 0x30, 0x00, 0xE0, 0xD0,
+0xE0, 0x0F, 0x11, 0x0F, 0x11, 0x70, 0x02, 0x30, 0xA0, 0x00, 0x50, 0x00, 0x30, 0x00, 0xB0, 0x31,
+0x80, 0xF0, 0x25, 0xF1, 0xC0, 0x60, 0x21, 0xF0, 0x60, 0xA0, 0x2F, 0x03, 0xC0, 0x60, 0x20, 0xF0,
+0x26, 0xF0, 0x24, 0xF0, 0xA0, 0x02, 0x40, 0x04, 0xB0, 0x40, 0x08, 0x50, 0x90, 0x0D, 0x40, 0x0B,
+0x51, 0x02, 0xE0, 0x90, 0x05, 0x40, 0x09, 0x40, 0x08, 0xB0, 0x90, 0x08, 0x90, 0x07, 0xE1, 0x07,
+0x90, 0xB0, 0x03, 0x50, 0xA0, 0x01, 0x40, 0x07, 0xB0, 0x90, 0x08, 0x40, 0x08, 0x51, 0x08, 0xB0,
+0x90, 0x04, 0x30, 0x04, 0x40, 0x0B, 0x50, 0x90, 0x0C, 0xB0, 0x40, 0x08, 0x41, 0x04, 0x50, 0x90,
+0x0F, 0x03, 0xB0, 0x40, 0x0F, 0x08, 0xB0, 0x40, 0xB0, 0x08, 0x70, 0x30, 0x40, 0x00, 0x50, 0x80,
+0x02, 0xB0, 0x01, 0xB0, 0x30, 0x90, 0x0F, 0x10, 0x0F, 0x11, 0xA1, 0x30, 0x10, 0xE0, 0x00, 0x30,
+0xE0, 0x40, 0x90, 0xA1, 0xB0, 0x00, 0xA0, 0xC0, 0x24, 0xF1, 0x60, 0xC0, 0xF0, 0x22, 0xD0, 0x70,
+0xC0, 0x2F, 0x00, 0xF0, 0xC0, 0x60, 0x2E, 0xF0, 0x80, 0x90, 0x01, 0x40, 0x07, 0x40, 0x07, 0x40,
+0x0D, 0x90, 0xB0, 0x0B, 0x40, 0x03, 0x40, 0x90, 0x04, 0x90, 0xB0, 0x08, 0xB0, 0x90, 0x08, 0x50,
+0xB0, 0x07, 0xB0, 0x90, 0x07, 0x50, 0xE0, 0x07, 0x50, 0xB0, 0x02, 0x50, 0x70, 0x02, 0x40, 0x08,
+0x40, 0x08, 0x40, 0x09, 0x90, 0x09, 0x90, 0x04, 0x30, 0x04, 0x51, 0x0B, 0x40, 0x0D, 0xB0, 0x40,
+0x06, 0x50, 0xE0, 0x40, 0x05, 0x50, 0x90, 0x0F, 0x03, 0xB0, 0x40, 0x0F, 0x09, 0x40, 0x90, 0x06,
+0x30, 0xE0, 0x00, 0x40, 0xA0, 0x70, 0x0F, 0x1A, 0x0F, 0x12, 0x90, 0x40, 0x02, 0x30, 0xE0, 0x40,
+0x00, 0xA0, 0x03, 0xD0, 0xF0, 0x22, 0xF0, 0x61, 0xF1, 0x23, 0xF0, 0xC0, 0xF0, 0x2E, 0xF0, 0x60,
+0xC0, 0xF0, 0x2E, 0xF0, 0x70, 0x00, 0xB0, 0x40, 0x09, 0x40, 0xB0, 0x04, 0xE0, 0x0D, 0x50, 0x90,
+0x0B, 0x90, 0x50, 0x03, 0x40, 0x90, 0x04, 0x40, 0x09, 0x50, 0xB0, 0x08, 0x40, 0x08, 0x51, 0x07,
+0x50, 0x30, 0x07, 0x51, 0x90, 0x80, 0x31, 0x03, 0x40, 0x08, 0x40, 0x08, 0x90, 0xB0, 0x08, 0x40,
+0x09, 0xB0, 0x90, 0x02, 0xB0, 0x80, 0x05, 0x40, 0x0C, 0x40, 0x0D, 0x50, 0x90, 0x04, 0x91, 0xB0,
+0x80, 0x06, 0x50, 0x40, 0x0F, 0x04, 0x40, 0x50, 0x0F, 0x08, 0x50, 0x40, 0x04, 0x50, 0xD0, 0x02,
+0x80, 0x50, 0x0F, 0x1A, 0x0F, 0x18, 0xB0, 0x02, 0xA0, 0x00, 0x50, 0x31, 0x80, 0xF2, 0x60, 0xC0,
+0x20, 0xF1, 0x2F, 0x04, 0xF0, 0x20, 0x60, 0xC0, 0x2F, 0x00, 0xF0, 0x30, 0x40, 0x00, 0x40, 0x0B,
+0x40, 0xB0, 0x02, 0x40, 0x0E, 0x40, 0x0C, 0x40, 0x04, 0x41, 0x03, 0x50, 0xB0, 0x09, 0x40, 0x09,
+0x40, 0x08, 0x90, 0xB0, 0x07, 0x40, 0x90, 0x03, 0x50, 0x90, 0xE0, 0x31, 0x80, 0x40, 0x50, 0x05,
+0x40, 0x08, 0x50, 0xB0, 0x08, 0x90, 0x08, 0xB0, 0x50, 0x09, 0x40, 0x02, 0xB0, 0x80, 0x06, 0x40,
+0x0B, 0xB0, 0x90, 0x0D, 0x90, 0x50, 0x02, 0x90, 0x50, 0x01, 0xA0, 0x07, 0x50, 0x40, 0x0F, 0x04,
+0x90, 0x50, 0x0F, 0x09, 0x40, 0x50, 0x02, 0xD0, 0x80, 0xE0, 0x00, 0x50, 0x80, 0x0F, 0x1B, 0x0F,
+0x1C, 0x40, 0xA0, 0x30, 0xB0, 0x00, 0xA0, 0xC1, 0x61, 0xF1, 0xC0, 0xA0, 0xF1, 0x2F, 0x01, 0xF0,
+0xC0, 0x60, 0xC0, 0xF0, 0x2E, 0xF0, 0x60, 0x30, 0x00, 0x40, 0x0D, 0x40, 0x50, 0x00, 0x90, 0xB0,
+0x0D, 0x40, 0xB0, 0x0B, 0x40, 0xB0, 0x04, 0x90, 0x40, 0x03, 0x40, 0x09, 0xB0, 0x90, 0x08, 0xB0,
+0x90, 0x08, 0x40, 0x08, 0x40, 0xE0, 0x90, 0xE0, 0xA0, 0x30, 0x70, 0xE0, 0x50, 0xB0, 0x50, 0x08,
+0x90, 0x08, 0x51, 0x08, 0x40, 0x09, 0x40, 0x09, 0xB0, 0x90, 0x01, 0xB0, 0x30, 0x06, 0x90, 0xB0,
+0x0B, 0x90, 0x50, 0x0D, 0x40, 0xB0, 0x00, 0x40, 0x50, 0x02, 0xA0, 0x08, 0x50, 0x90, 0x0F, 0x04,
+0x50, 0x90, 0x0F, 0x09, 0x91, 0x00, 0x30, 0xE0, 0x00, 0x90, 0x30, 0xA0, 0x0F, 0x1C, 0x0F, 0x1D,
+0xA0, 0xB0, 0x01, 0xB0, 0x70, 0x60, 0x70, 0xD0, 0xC0, 0xF0, 0xA0, 0x80, 0x60, 0x80, 0xD0, 0xF0,
+0x2D, 0xF0, 0xC0, 0x60, 0x20, 0xF1, 0x2E, 0xF0, 0xA0, 0xB0, 0x40, 0x0F, 0x00, 0x90, 0x40, 0x50,
+0x0D, 0x51, 0x0B, 0xB0, 0x90, 0x05, 0x90, 0x40, 0x02, 0x51, 0x09, 0x90, 0xB0, 0x08, 0x90, 0xB0,
+0x08, 0x40, 0x08, 0x91, 0x40, 0x50, 0x01, 0x80, 0xB0, 0x01, 0x90, 0xB0, 0x07, 0x90, 0xB0, 0x07,
+0xB0, 0x50, 0x08, 0x90, 0x09, 0x40, 0x0A, 0x40, 0x01, 0xB0, 0x30, 0x07, 0x40, 0x0C, 0x40, 0x0E,
+0x41, 0xB0, 0x03, 0x30, 0xB0, 0x08, 0x50, 0x40, 0x0F, 0x04, 0xB0, 0x40, 0x0F, 0x0A, 0xE0, 0x70,
+0x02, 0x30, 0x90, 0x0F, 0x1C, 0x0F, 0x1E, 0xA0, 0x00, 0x50, 0xA0, 0x81, 0x90, 0x80, 0x21, 0x60,
+0xA0, 0x30, 0xC0, 0x60, 0xF0, 0x2C, 0xF0, 0x61, 0xF0, 0x2F, 0x01, 0xF0, 0x80, 0x40, 0x90, 0x0F,
+0x01, 0x50, 0x40, 0x90, 0x0C, 0xB0, 0x40, 0x0C, 0x40, 0x06, 0x90, 0xE0, 0x02, 0x40, 0x0A, 0x40,
+0x09, 0x40, 0x08, 0xB0, 0x90, 0x08, 0x40, 0x04, 0x80, 0xB0, 0x01, 0x50, 0xB0, 0x07, 0x50, 0xB0,
+0x08, 0x90, 0x08, 0x50, 0xB0, 0x08, 0xB0, 0x90, 0x09, 0x51, 0x01, 0x30, 0x07, 0x51, 0x0C, 0x40,
+0x0C, 0xB0, 0x41, 0x04, 0xE0, 0x50, 0x09, 0x50, 0x40, 0x0F, 0x05, 0xE0, 0x0F, 0x09, 0xD0, 0x31,
+0x00, 0x90, 0x80, 0x0F, 0x1D, 0x0F, 0x1E, 0x90, 0x70, 0x80, 0x01, 0x30, 0x40, 0xF0, 0x21, 0xF0,
+0xC0, 0x2F, 0x01, 0x60, 0xC0, 0x2F, 0x03, 0xF0, 0x31, 0xA0, 0x80, 0x40, 0x90, 0x40, 0x50, 0x80,
+0x90, 0xB0, 0x07, 0xB0, 0x40, 0x00, 0xB0, 0x40, 0x0B, 0x40, 0x0C, 0x51, 0x06, 0x50, 0xE0, 0x01,
+0x51, 0x09, 0xB0, 0x50, 0x09, 0x90, 0x08, 0x51, 0x08, 0x90, 0x04, 0x30, 0xB0, 0x01, 0x50, 0xB0,
+0x07, 0x51, 0x08, 0x40, 0x08, 0xB0, 0x90, 0x09, 0x40, 0x0A, 0x40, 0x01, 0x30, 0x08, 0x40, 0x0C,
+0x51, 0x0A, 0x50, 0x90, 0x01, 0x40, 0x03, 0x40, 0x90, 0x0A, 0x50, 0x40, 0x0F, 0x05, 0x40, 0x50,
+0x0F, 0x06, 0xA0, 0x90, 0x00, 0x50, 0xA1, 0x0F, 0x1E, 0x0F, 0x1F, 0x30, 0x50, 0x02, 0xD0, 0xF1,
+0x2F, 0x01, 0xF0, 0x20, 0x60, 0xC0, 0x2F, 0x03, 0xF1, 0xA0, 0xE0, 0x00, 0xB0, 0x41, 0x90, 0xE0,
+0x90, 0x40, 0x80, 0xA0, 0x30, 0x05, 0x40, 0x03, 0x40, 0xB0, 0x08, 0x90, 0xB0, 0x0C, 0x40, 0x07,
+0x50, 0xE0, 0x01, 0x40, 0x0A, 0x40, 0x09, 0xB0, 0x50, 0x08, 0x50, 0xB0, 0x08, 0x90, 0x04, 0x80,
+0xB0, 0x01, 0x90, 0xB0, 0x07, 0xB0, 0x90, 0x08, 0x40, 0x09, 0x40, 0x09, 0x90, 0xB0, 0x09, 0x51,
+0x00, 0x30, 0x08, 0xB0, 0x90, 0x0C, 0x40, 0x09, 0x91, 0x02, 0x50, 0x90, 0x02, 0x90, 0x40, 0x0B,
+0x50, 0x90, 0x0F, 0x05, 0x90, 0x50, 0x0F, 0x04, 0xE0, 0x70, 0x02, 0x30, 0x50, 0x0F, 0x1E, 0x0F,
+0x20, 0x70, 0x00, 0x50, 0xA0, 0x40, 0xA0, 0xF0, 0x2F, 0x02, 0x60, 0x20, 0xF0, 0x2F, 0x04, 0x80,
+0x70, 0x0A, 0x90, 0x30, 0x03, 0x40, 0x05, 0x91, 0x06, 0xB0, 0x40, 0x0C, 0x90, 0xB0, 0x07, 0xB0,
+0x80, 0x00, 0xB0, 0x90, 0x0A, 0x40, 0x09, 0x90, 0xB0, 0x08, 0x90, 0xB0, 0x08, 0x40, 0x04, 0x80,
+0xB0, 0x01, 0x50, 0xB0, 0x08, 0x90, 0x08, 0x90, 0xB0, 0x08, 0x90, 0xB0, 0x08, 0xB0, 0x90, 0x0A,
+0x40, 0x00, 0x30, 0x09, 0x40, 0x0D, 0x40, 0x07, 0x40, 0x50, 0x04, 0x90, 0x50, 0x01, 0x50, 0xE0,
+0x0C, 0x50, 0x90, 0x0F, 0x05, 0x91, 0x0F, 0x02, 0xB0, 0xD0, 0xE0, 0x30, 0x00, 0x40, 0x80, 0x0F,
+0x1F, 0x0F, 0x20, 0x50, 0xD0, 0x80, 0x01, 0x40, 0x80, 0xF0, 0x2F, 0x00, 0x60, 0xF1, 0x2F, 0x01,
+0xF1, 0xC0, 0x60, 0x80, 0x50, 0x0B, 0xE1, 0x01, 0x40, 0xB0, 0x06, 0x50, 0x40, 0x05, 0x40, 0x0D,
+0x40, 0x08, 0xB0, 0x80, 0x00, 0x40, 0x0A, 0x51, 0x09, 0x40, 0x09, 0x90, 0x09, 0x40, 0x04, 0x30,
+0xB0, 0x01, 0x90, 0xB0, 0x08, 0x40, 0x08, 0x51, 0x08, 0xB0, 0x50, 0x09, 0x40, 0x0A, 0x51, 0x30,
+0x0A, 0x40, 0x0C, 0x50, 0x90, 0x04, 0x50, 0x40, 0x07, 0x90, 0x50, 0x01, 0x30, 0x0D, 0x50, 0x40,
+0x0F, 0x05, 0xB0, 0x40, 0x0F, 0x01, 0x10, 0x01, 0x50, 0x70, 0xA0, 0x0F, 0x20, 0x0F, 0x21, 0xE0,
+0x40, 0x01, 0xB0, 0x70, 0x60, 0xF0, 0x2A, 0xF1, 0xC0, 0x60, 0x2F, 0x04, 0xF0, 0xC0, 0x60, 0xC0,
+0x70, 0x0D, 0x70, 0x50, 0x90, 0xB0, 0x09, 0x40, 0xB0, 0x02, 0x90, 0xB0, 0x0C, 0x40, 0x09, 0xB0,
+0x30, 0x00, 0x90, 0x0A, 0x40, 0x09, 0xB0, 0x90, 0x09, 0x40, 0x09, 0x90, 0x04, 0x30, 0xB0, 0x01,
+0x90, 0xB0, 0x08, 0x40, 0x09, 0x90, 0x09, 0x90, 0x09, 0x51, 0x0A, 0x40, 0xA0, 0x0A, 0x90, 0xB0,
+0x0C, 0x90, 0xB0, 0x02, 0x91, 0x09, 0x40, 0x01, 0xA0, 0x0E, 0x50, 0x40, 0x0F, 0x06, 0x40, 0xB0,
+0x0D, 0x70, 0x30, 0x02, 0xA0, 0x0F, 0x21, 0x0F, 0x22, 0x30, 0x51, 0xA0, 0x50, 0xA0, 0xF0, 0x2A,
+0xF0, 0x60, 0xC0, 0x2F, 0x04, 0xF0, 0x20, 0x60, 0xC0, 0x70, 0x50, 0x0D, 0xB0, 0x80, 0xA0, 0x90,
+0x0A, 0x90, 0x50, 0x00, 0x51, 0x0C, 0xB0, 0x90, 0x0A, 0x30, 0x90, 0xB0, 0x09, 0xB0, 0x90, 0x09,
+0x51, 0x08, 0xB0, 0x90, 0x08, 0xB0, 0x90, 0x04, 0x30, 0xB0, 0x01, 0x50, 0xB0, 0x08, 0x40, 0x09,
+0x90, 0x09, 0x40, 0x0A, 0x90, 0x0A, 0x50, 0x30, 0x0B, 0x40, 0x0D, 0x40, 0x01, 0x40, 0x50, 0x0B,
+0x40, 0x00, 0x30, 0x0F, 0x00, 0x50, 0x90, 0x0F, 0x06, 0x40, 0xB0, 0x0B, 0xE0, 0x30, 0x90, 0xA0,
+0x00, 0x80, 0x90, 0x0F, 0x21, 0x0F, 0x23, 0x70, 0x80, 0x01, 0x50, 0xA0, 0xF0, 0x27, 0xF1, 0x60,
+0xC0, 0x2F, 0x04, 0xF1, 0x60, 0xF0, 0xA0, 0x50, 0x0E, 0xB0, 0x40, 0x00, 0xA0, 0x0B, 0x50, 0x41,
+0x0D, 0x40, 0x0B, 0xA0, 0x50, 0x0A, 0x50, 0xB0, 0x09, 0x90, 0x09, 0x51, 0x08, 0x51, 0x04, 0x30,
+0x02, 0x50, 0xB0, 0x08, 0x90, 0x09, 0x40, 0x09, 0x90, 0xB0, 0x09, 0x40, 0x0B, 0x30, 0x0B, 0x51,
+0x0D, 0x41, 0xB0, 0x0D, 0x90, 0xE0, 0x50, 0x0F, 0x00, 0x50, 0x90, 0x0F, 0x06, 0x40, 0x50, 0x09,
+0x50, 0xD0, 0x01, 0xB0, 0xD0, 0xE0, 0x0F, 0x22, 0x0F, 0x23, 0xB0, 0x30, 0x01, 0xB0, 0xD0, 0x80,
+0xF1, 0x24, 0xF0, 0x20, 0x60, 0x2F, 0x05, 0xF1, 0x60, 0xF0, 0x70, 0x90, 0x0E, 0xB0, 0x40, 0x01,
+0x30, 0x0C, 0x41, 0x50, 0x0B, 0x51, 0x0B, 0xD0, 0x08, 0x50, 0x01, 0x40, 0x0A, 0x40, 0x09, 0x90,
+0xB0, 0x08, 0x50, 0xB0, 0x04, 0x80, 0xB0, 0x01, 0x90, 0xB0, 0x08, 0x90, 0x09, 0x40, 0x09, 0xB0,
+0x90, 0x09, 0xB0, 0x90, 0x09, 0x40, 0xA0, 0x0C, 0x40, 0x0C, 0x90, 0x40, 0xB0, 0x0B, 0x40, 0x80,
+0xA0, 0xE0, 0xA0, 0x50, 0x0F, 0x01, 0x50, 0x40, 0x0F, 0x06, 0x91, 0x08, 0x10, 0x80, 0x01, 0xB0,
+0x30, 0x0F, 0x23, 0x0F, 0x24, 0xE0, 0x40, 0x90, 0xA0, 0x00, 0x80, 0x60, 0xF0, 0x23, 0xF0, 0xC0,
+0x60, 0x20, 0xF0, 0x2F, 0x05, 0x80, 0x70, 0x30, 0xB0, 0x0F, 0x00, 0x40, 0xB0, 0x01, 0x40, 0x30,
+0x0A, 0x51, 0x00, 0x50, 0x40, 0x0A, 0x40, 0x0C, 0xE0, 0x04, 0xB0, 0x40, 0xD0, 0x10, 0xA0, 0x00,
+0xB0, 0x50, 0x09, 0xB0, 0x90, 0x09, 0x40, 0x09, 0x90, 0x05, 0x30, 0xB0, 0x01, 0x90, 0xB0, 0x08,
+0x90, 0xB0, 0x08, 0x90, 0xB0, 0x09, 0x40, 0x0A, 0x40, 0x08, 0x50, 0x30, 0x00, 0x40, 0x0B, 0xB0,
+0x90, 0x09, 0x50, 0x40, 0xB0, 0x00, 0x40, 0x0A, 0x30, 0x40, 0x50, 0x01, 0x51, 0x0F, 0x02, 0x50,
+0x40, 0x0F, 0x06, 0x50, 0x40, 0x06, 0x70, 0x91, 0x30, 0xB0, 0xA0, 0xB0, 0xE0, 0x80, 0x0F, 0x21,
+0x0F, 0x25, 0xA0, 0x80, 0x02, 0xA0, 0xC0, 0xF0, 0x21, 0xF0, 0xC0, 0x60, 0x20, 0xF0, 0x2F, 0x03,
+0xF0, 0x20, 0x61, 0xA0, 0x40, 0x0F, 0x00, 0x40, 0xB0, 0x03, 0xE1, 0x05, 0xB0, 0x90, 0x00, 0xB0,
+0x40, 0x02, 0xB0, 0x40, 0x50, 0x07, 0x90, 0xB0, 0x0B, 0x50, 0x30, 0x90, 0x03, 0x50, 0xA0, 0x90,
+0x50, 0x01, 0x90, 0x0A, 0x90, 0xB0, 0x09, 0x40, 0x09, 0x40, 0x05, 0xA0, 0x02, 0x90, 0xB0, 0x08,
+0x90, 0xB0, 0x08, 0xB0, 0x50, 0x09, 0x40, 0x0A, 0x90, 0x08, 0xA0, 0x01, 0x40, 0x0C, 0x90, 0xB0,
+0x07, 0x40, 0x90, 0x02, 0xB0, 0x90, 0x08, 0xB0, 0xA0, 0x04, 0x90, 0xB0, 0x0F, 0x02, 0x50, 0x90,
+0x0F, 0x06, 0xB0, 0x40, 0x04, 0x30, 0x80, 0x01, 0x50, 0x70, 0x50, 0x90, 0x41, 0x90, 0x0F, 0x20,
+0x0F, 0x26, 0xA0, 0x01, 0xB0, 0xA0, 0x70, 0xF0, 0x20, 0xF0, 0x61, 0xF0, 0x2F, 0x04, 0xF0, 0xC0,
+0x60, 0xF2, 0x70, 0x0E, 0x90, 0x50, 0x05, 0x70, 0x04, 0x40, 0x70, 0x30, 0xE0, 0x90, 0x05, 0x90,
+0x40, 0x05, 0xB0, 0x90, 0x0C, 0x40, 0x00, 0x70, 0x09, 0x40, 0x0A, 0x40, 0x0A, 0x90, 0x09, 0x40,
+0x05, 0x30, 0x02, 0x50, 0xB0, 0x08, 0x50, 0xB0, 0x09, 0x90, 0x09, 0x90, 0xB0, 0x09, 0xB0, 0x90,
+0x06, 0x70, 0xB0, 0x01, 0xB0, 0x90, 0x0C, 0x40, 0x05, 0x50, 0x40, 0xB0, 0x04, 0x51, 0x08, 0x30,
+0xB0, 0x04, 0x40, 0x0F, 0x03, 0x50, 0x90, 0x0F, 0x07, 0x40, 0xB0, 0x01, 0x40, 0xD0, 0x80, 0x01,
+0x40, 0xE0, 0x01, 0xE0, 0x80, 0x0F, 0x21, 0x0F, 0x23, 0x40, 0xD0, 0x40, 0xB0, 0xA0, 0x90, 0x30,
+0x00, 0xB0, 0x70, 0xF0, 0x60, 0xC0, 0xF0, 0x2F, 0x06, 0x60, 0xF0, 0x21, 0xF0, 0xE0, 0x30, 0x0C,
+0x50, 0x90, 0x06, 0xE0, 0x30, 0x03, 0xA0, 0x01, 0x30, 0x40, 0x00, 0x80, 0x30, 0xE0, 0x03, 0x80,
+0x30, 0x03, 0x40, 0x0C, 0x51, 0x00, 0xA0, 0x08, 0xB0, 0x50, 0x0A, 0x40, 0x0A, 0x90, 0x09, 0x40,
+0x05, 0x30, 0x02, 0x90, 0xB0, 0x08, 0x51, 0x09, 0x40, 0x0A, 0x90, 0x0A, 0x40, 0x05, 0x30, 0x90,
+0x03, 0x40, 0x0C, 0x90, 0x50, 0x03, 0x40, 0x90, 0x07, 0x40, 0x07, 0xB0, 0xA0, 0x06, 0x40, 0x0F,
+0x03, 0x50, 0x40, 0x0F, 0x07, 0x40, 0xB1, 0xD0, 0x00, 0x50, 0x70, 0x40, 0x30, 0x00, 0xE0, 0x40,
+0x0F, 0x23, 0x0F, 0x23, 0x50, 0xB0, 0x30, 0x40, 0x50, 0x70, 0x02, 0xA1, 0xF1, 0x2F, 0x04, 0xF0,
+0xC0, 0x60, 0x24, 0xF0, 0xA0, 0x0B, 0x50, 0x90, 0x08, 0x90, 0xA0, 0x01, 0x50, 0xE0, 0x00, 0xB0,
+0x50, 0x80, 0xA0, 0xE0, 0x00, 0x90, 0x31, 0x80, 0x30, 0xA0, 0x30, 0x81, 0xE0, 0x40, 0xE0, 0x50,
+0xB0, 0x0A, 0x40, 0x00, 0x90, 0x40, 0x05, 0x50, 0x90, 0x00, 0x40, 0x0A, 0xB0, 0x90, 0x09, 0x51,
+0x09, 0x90, 0x04, 0x90, 0x80, 0x02, 0x50, 0xB0, 0x08, 0xB0, 0x50, 0x09, 0x90, 0x0A, 0x40, 0x0A,
+0x50, 0xB0, 0x03, 0x40, 0x80, 0x04, 0xB0, 0x90, 0x0C, 0x40, 0x01, 0x91, 0x0A, 0x40, 0x06, 0xA0,
+0xB0, 0x07, 0x40, 0x0F, 0x03, 0x50, 0x40, 0x0F, 0x07, 0x90, 0x10, 0x90, 0x01, 0x50, 0x70, 0x00,
+0xA0, 0xE0, 0x30, 0xD0, 0x50, 0x0F, 0x21, 0x0F, 0x25, 0x50, 0xA0, 0x00, 0xE0, 0x40, 0x00, 0x70,
+0x10, 0x70, 0x60, 0xF0, 0x2F, 0x05, 0x60, 0xF0, 0x24, 0xF0, 0x30, 0x71, 0x50, 0x07, 0xB0, 0x40,
+0x0A, 0xE1, 0x00, 0x40, 0xE0, 0x00, 0x40, 0x00, 0xB0, 0x30, 0x04, 0xB0, 0x03, 0x90, 0xE1, 0x90,
+0xE0, 0x80, 0x30, 0xA0, 0x30, 0x80, 0x40, 0x90, 0x50, 0xB1, 0x00, 0x50, 0xB0, 0x00, 0x80, 0xB0,
+0x04, 0x30, 0x10, 0xE0, 0x00, 0x40, 0x0A, 0x90, 0xB0, 0x09, 0x90, 0x0A, 0x90, 0x04, 0xA0, 0x03,
+0x90, 0xB0, 0x08, 0xB0, 0x50, 0x09, 0x90, 0xB0, 0x09, 0x90, 0x0A, 0xB0, 0x90, 0x02, 0x50, 0x30,
+0x06, 0x40, 0x0C, 0x50, 0x90, 0x40, 0x50, 0x0B, 0x50, 0x90, 0x05, 0xA0, 0x08, 0xB0, 0x40, 0x0F,
+0x03, 0x50, 0x90, 0x0F, 0x06, 0x70, 0xD0, 0x10, 0xE0, 0x00, 0xA0, 0x00, 0xB0, 0x70, 0x01, 0x90,
+0xD0, 0x50, 0x0F, 0x20, 0x0F, 0x1F, 0x50, 0xD1, 0x70, 0x81, 0xD0, 0x40, 0x01, 0x80, 0x11, 0xE0,
+0x00, 0x30, 0x60, 0xF0, 0x2F, 0x03, 0x60, 0xF0, 0x25, 0xF0, 0x80, 0x10, 0x70, 0x08, 0x40, 0x0C,
+0x30, 0xD0, 0xE0, 0x00, 0x90, 0xB0, 0x0D, 0x90, 0x40, 0x50, 0x04, 0xB0, 0x90, 0x40, 0xE0, 0x80,
+0x32, 0xA0, 0x30, 0x70, 0x04, 0xE0, 0x70, 0x01, 0x51, 0x0A, 0x40, 0x0A, 0x40, 0x09, 0xB0, 0x90,
+0x03, 0xB0, 0x30, 0x03, 0x50, 0xB0, 0x08, 0xB0, 0x90, 0x09, 0x50, 0xB0, 0x09, 0x51, 0x0A, 0x40,
+0x02, 0xA0, 0x07, 0xB0, 0x50, 0x0B, 0x40, 0xE0, 0x0E, 0x90, 0xB0, 0x02, 0xB0, 0xA0, 0x40, 0x09,
+0x51, 0x0F, 0x03, 0x50, 0x90, 0x0F, 0x04, 0xA0, 0xE0, 0x00, 0xD0, 0x10, 0xD0, 0x50, 0x01, 0x70,
+0x90, 0x01, 0x50, 0x70, 0x0F, 0x20, 0x0F, 0x20, 0x70, 0x90, 0x00, 0x40, 0xE0, 0xB1, 0x70, 0x30,
+0x00, 0x70, 0x40, 0x01, 0xB0, 0x10, 0xC0, 0xF0, 0x2F, 0x01, 0x60, 0xF1, 0x26, 0xF0, 0x10, 0x40,
+0x07, 0x40, 0x0D, 0x30, 0x01, 0x50, 0x90, 0x0E, 0x40, 0x00, 0xB0, 0x40, 0x50, 0x08, 0xB0, 0x50,
+0x01, 0xB0, 0x04, 0x40, 0xA0, 0x01, 0x40, 0x0B, 0x90, 0x0A, 0x40, 0x09, 0xB0, 0x90, 0x03, 0x30,
+0x50, 0x03, 0x90, 0xB0, 0x09, 0x40, 0x09, 0xB0, 0x50, 0x09, 0xB0, 0x90, 0x0A, 0x51, 0x00, 0xE0,
+0x90, 0x08, 0x40, 0x08, 0xB0, 0x90, 0x40, 0x00, 0xB0, 0x40, 0x0E, 0x40, 0x02, 0x90, 0x80, 0x0B,
+0x90, 0x50, 0x0F, 0x03, 0x50, 0x40, 0x0F, 0x02, 0xA0, 0xD0, 0x02, 0xD0, 0x90, 0x00, 0xE0, 0x50,
+0xB0, 0x10, 0x40, 0x01, 0xD0, 0x0F, 0x20, 0x0F, 0x21, 0xD0, 0x90, 0x03, 0xB0, 0xE0, 0x80, 0x00,
+0xA0, 0x00, 0x90, 0xA0, 0x00, 0x70, 0xC0, 0xF0, 0x2C, 0xF0, 0x20, 0x60, 0x28, 0xF0, 0xC0, 0xD0,
+0x30, 0xE0, 0x90, 0x50, 0x01, 0x30, 0xE1, 0x90, 0x0D, 0x80, 0x40, 0x00, 0x40, 0x0E, 0x90, 0xB0,
+0x02, 0x50, 0x40, 0x50, 0x06, 0x40, 0x09, 0x10, 0xD0, 0xB0, 0x90, 0x0A, 0xB0, 0x50, 0x09, 0xB0,
+0x90, 0x09, 0xB0, 0x50, 0x02, 0x40, 0xA0, 0x04, 0x50, 0xB0, 0x09, 0x40, 0x0A, 0x90, 0x0A, 0x40,
+0x0B, 0x90, 0x00, 0xA0, 0x09, 0x51, 0x06, 0x91, 0x03, 0x90, 0xB0, 0x0D, 0xB0, 0x90, 0x02, 0xA0,
+0x0C, 0x40, 0xB0, 0x0F, 0x03, 0xB0, 0x40, 0x0F, 0x00, 0x30, 0x80, 0x50, 0xA0, 0x00, 0x40, 0xE0,
+0xB0, 0x70, 0xE0, 0x70, 0xB0, 0x00, 0x71, 0xA0, 0x80, 0x0F, 0x20, 0x0F, 0x21, 0x50, 0x30, 0x00,
+0x50, 0x00, 0x50, 0xB0, 0x50, 0x70, 0x00, 0xB0, 0x70, 0x80, 0x01, 0xB0, 0xA0, 0xC0, 0xF0, 0x2C,
+0x60, 0x29, 0xC0, 0xA0, 0xD0, 0xE0, 0x30, 0xD0, 0xA1, 0x10, 0x50, 0xE0, 0x90, 0xA0, 0xB0, 0x0D,
+0xA0, 0x90, 0x0E, 0xB0, 0x90, 0x05, 0x50, 0x40, 0xB0, 0x03, 0xB0, 0x90, 0x09, 0x52, 0xB0, 0x0A,
+0x90, 0xB0, 0x09, 0xB0, 0x90, 0x07, 0xB0, 0x00, 0x50, 0x90, 0x50, 0xB0, 0xE1, 0x05, 0x90, 0xB0,
+0x09, 0x40, 0x0A, 0x40, 0x0A, 0x90, 0xB0, 0x0A, 0x90, 0x30, 0xB0, 0x0A, 0x40, 0x04, 0x50, 0x40,
+0xB0, 0x05, 0x40, 0x0E, 0x90, 0x50, 0x01, 0x70, 0x50, 0x0C, 0x40, 0x0F, 0x04, 0x50, 0x90, 0x0D,
+0x40, 0xA0, 0x01, 0x50, 0x70, 0x30, 0x00, 0xE1, 0x00, 0xA0, 0xD0, 0x70, 0xB0, 0x51, 0x0F, 0x21,
+0x0F, 0x23, 0x40, 0xA0, 0x00, 0x90, 0x10, 0xD0, 0x90, 0x01, 0x90, 0x80, 0x01, 0xB0, 0x70, 0xA0,
+0xF0, 0x2B, 0x60, 0x29, 0xF0, 0xC0, 0xA0, 0x70, 0xD0, 0x10, 0x90, 0x30, 0x11, 0x70, 0x80, 0x30,
+0x50, 0x30, 0x80, 0x0C, 0x30, 0x50, 0x0E, 0x40, 0x08, 0x50, 0x40, 0xB0, 0x01, 0x40, 0x0C, 0x40,
+0x0B, 0x40, 0x03, 0xB0, 0x05, 0x50, 0xB0, 0x00, 0x90, 0xA0, 0x36, 0x80, 0xA0, 0xE0, 0x80, 0xA0,
+0x06, 0x90, 0xB0, 0x09, 0x90, 0x0A, 0x90, 0x0A, 0xB0, 0x50, 0x0A, 0x50, 0x40, 0x0B, 0x90, 0xB0,
+0x01, 0x90, 0x40, 0x50, 0x07, 0x51, 0x0E, 0x40, 0x00, 0x30, 0x40, 0x0D, 0xB0, 0x40, 0x0F, 0x04,
+0x50, 0x90, 0x0B, 0x90, 0x10, 0x30, 0x01, 0xB0, 0x70, 0x01, 0x50, 0x30, 0x00, 0x30, 0xB0, 0x40,
+0x70, 0x0F, 0x23, 0x0F, 0x23, 0x40, 0x80, 0x00, 0xB0, 0xD0, 0x00, 0xB0, 0x31, 0x00, 0x40, 0x80,
+0x50, 0x70, 0x00, 0x50, 0x70, 0xF0, 0x29, 0x60, 0x2A, 0xF0, 0xC0, 0x30, 0xB0, 0x40, 0x80, 0x30,
+0x70, 0x00, 0xB0, 0xE0, 0x01, 0xA0, 0x40, 0xE0, 0x31, 0x70, 0xB0, 0x07, 0xB0, 0xA0, 0x0E, 0x51,
+0x0A, 0x90, 0x40, 0x50, 0x90, 0x0B, 0xB0, 0x90, 0x0A, 0xB0, 0x50, 0x01, 0x40, 0xA0, 0x30, 0xA1,
+0x30, 0xE1, 0x90, 0x40, 0x50, 0x80, 0x30, 0x07, 0x50, 0x0A, 0x50, 0xB0, 0x09, 0x90, 0x0A, 0x50,
+0xB0, 0x0A, 0x90, 0x0A, 0xE0, 0x40, 0x0C, 0x40, 0x90, 0x40, 0xB0, 0x0A, 0x40, 0x0F, 0x00, 0x30,
+0x90, 0x0F, 0x00, 0xB0, 0x40, 0x0F, 0x04, 0x50, 0x40, 0x09, 0x50, 0xD0, 0x00, 0x50, 0xA0, 0xB0,
+0x70, 0x00, 0x70, 0x90, 0x05, 0x70, 0x0F, 0x23, 0x0F, 0x24, 0xA1, 0xD0, 0x90, 0x40, 0xD0, 0x40,
+0x90, 0x70, 0x00, 0x40, 0xD0, 0x02, 0x40, 0x70, 0xF0, 0x26, 0xC0, 0x60, 0x2B, 0xF0, 0x30, 0x80,
+0x05, 0x40, 0x03, 0x90, 0x30, 0xE1, 0xA0, 0x50, 0x07, 0xE1, 0x0E, 0x40, 0x0D, 0x41, 0x50, 0x0A,
+0x90, 0x0B, 0x90, 0xE1, 0xA0, 0xE0, 0x04, 0x40, 0xA0, 0x90, 0xE0, 0x80, 0x90, 0x08, 0x90, 0xB0,
+0x09, 0x90, 0xB0, 0x09, 0x50, 0xB0, 0x09, 0xB0, 0x50, 0x0A, 0x40, 0x09, 0xB0, 0xA0, 0x90, 0x0A,
+0xB0, 0x90, 0xE0, 0x50, 0x0C, 0xB0, 0x90, 0x0E, 0x50, 0xE0, 0x0F, 0x01, 0x50, 0x90, 0x0F, 0x04,
+0x50, 0x40, 0x07, 0xB0, 0x10, 0xB0, 0x01, 0x90, 0xD0, 0xB0, 0x00, 0xA0, 0x10, 0xE0, 0x01, 0x90,
+0x30, 0x70, 0x90, 0x0F, 0x23, 0x0F, 0x25, 0x50, 0xB0, 0x90, 0xD0, 0xB0, 0x01, 0xD0, 0x01, 0xE0,
+0x40, 0x00, 0x50, 0x30, 0x40, 0x30, 0xF0, 0x25, 0x60, 0x2C, 0xF0, 0xA0, 0x10, 0xE0, 0xB1, 0x01,
+0x40, 0x50, 0x05, 0x51, 0xB0, 0x07, 0x90, 0x50, 0xA0, 0x0D, 0x51, 0x0C, 0xB0, 0x90, 0x00, 0x50,
+0x40, 0x90, 0x08, 0x40, 0x09, 0x50, 0xA0, 0x80, 0x90, 0x50, 0x06, 0x90, 0x40, 0x00, 0x90, 0x0A,
+0x90, 0x0A, 0x90, 0xB0, 0x09, 0x50, 0xB0, 0x09, 0xB0, 0x90, 0x0A, 0x50, 0xB0, 0x08, 0xA0, 0x50,
+0x00, 0x90, 0x07, 0xB0, 0x40, 0x90, 0xB0, 0x00, 0x90, 0x0D, 0x90, 0xB0, 0x0E, 0xE0, 0x50, 0x0F,
+0x01, 0x90, 0x50, 0x0F, 0x04, 0x50, 0x40, 0x05, 0xB0, 0x10, 0x40, 0x30, 0x01, 0xA0, 0x50, 0x01,
+0x30, 0x50, 0x70, 0x80, 0x00, 0xB0, 0x40, 0x50, 0x0F, 0x24, 0x0F, 0x26, 0xB0, 0xD0, 0x02, 0xE0,
+0x30, 0xB0, 0x80, 0xB0, 0x30, 0xE0, 0x30, 0x01, 0xE0, 0x80, 0xF0, 0x23, 0x60, 0x2D, 0xF0, 0x70,
+0x40, 0x70, 0x11, 0xD0, 0x40, 0xD0, 0x90, 0xB1, 0x0D, 0xB0, 0x90, 0x00, 0x40, 0x70, 0xE0, 0x0B,
+0x40, 0x0D, 0x90, 0xB0, 0x02, 0xB0, 0x41, 0xB0, 0x04, 0xB0, 0x50, 0x06, 0xB0, 0x01, 0xA0, 0x00,
+0x90, 0x08, 0x80, 0x50, 0xB0, 0x90, 0x0A, 0x40, 0x0A, 0x50, 0xB0, 0x09, 0x51, 0x0A, 0x40, 0x0A,
+0xB0, 0x90, 0x08, 0x30, 0x01, 0x40, 0x05, 0x50, 0x40, 0x50, 0x03, 0x90, 0xB0, 0x0C, 0xB0, 0x90,
+0x0E, 0xE1, 0x0F, 0x02, 0x40, 0xB0, 0x0F, 0x04, 0x50, 0x40, 0x04, 0x10, 0xB0, 0x00, 0x90, 0x31,
+0x50, 0x02, 0x50, 0x01, 0xA1, 0x0F, 0x27, 0x0F, 0x26, 0xB0, 0x70, 0x01, 0x30, 0xD0, 0x00, 0x30,
+0x00, 0x30, 0x00, 0x70, 0x50, 0x01, 0xB0, 0x70, 0x30, 0xF1, 0x20, 0x60, 0xF0, 0x2D, 0xF0, 0x80,
+0x10, 0xE0, 0x30, 0xD0, 0x80, 0x11, 0x30, 0x80, 0x33, 0xE0, 0x90, 0x08, 0x40, 0x03, 0xA0, 0x0A,
+0x40, 0xB0, 0x0D, 0x40, 0x06, 0x90, 0x40, 0x90, 0x02, 0x40, 0x06, 0x80, 0x31, 0xA1, 0x00, 0x90,
+0x09, 0x70, 0x51, 0x0A, 0x40, 0x0A, 0x90, 0xB0, 0x09, 0xB0, 0x50, 0x0A, 0x40, 0x0B, 0x40, 0x08,
+0x80, 0xB0, 0x00, 0x90, 0xB0, 0x01, 0xB0, 0x90, 0x40, 0x50, 0x06, 0x90, 0x0D, 0x90, 0xB0, 0x0C,
+0x80, 0xE0, 0xB0, 0x90, 0x0F, 0x02, 0x40, 0x0F, 0x05, 0xB0, 0x40, 0x02, 0x10, 0x30, 0x02, 0xA0,
+0x90, 0x07, 0x80, 0x90, 0x0F, 0x26, 0x0F, 0x27, 0xE0, 0x70, 0xD0, 0x80, 0x01, 0x40, 0x30, 0x40,
+0x01, 0xA0, 0x50, 0xB0, 0xA0, 0x00, 0xE0, 0x30, 0xF0, 0x60, 0x2F, 0x01, 0xF0, 0x60, 0xD1, 0x80,
+0x50, 0xB0, 0x06, 0x50, 0xE0, 0x30, 0xD0, 0x30, 0xE0, 0x90, 0x02, 0x40, 0x04, 0xE0, 0x40, 0x08,
+0xB0, 0x50, 0x0D, 0x90, 0xB0, 0x08, 0xB0, 0x40, 0x90, 0x50, 0x90, 0x05, 0x30, 0x40, 0x03, 0x90,
+0xB0, 0x09, 0x80, 0x40, 0xB0, 0x0A, 0x40, 0x0A, 0x90, 0xB0, 0x09, 0xB0, 0x90, 0x0A, 0x90, 0x0B,
+0x40, 0x07, 0xE0, 0xA0, 0x70, 0x50, 0x00, 0x40, 0x50, 0x40, 0x90, 0xB0, 0x08, 0x40, 0x0E, 0x40,
+0x0B, 0xB0, 0x30, 0x01, 0x90, 0xB0, 0x0F, 0x02, 0x40, 0x0F, 0x05, 0x50, 0x90, 0x00, 0x10, 0xB0,
+0x90, 0xA0, 0x00, 0x80, 0x40, 0x0F, 0x31, 0x0F, 0x28, 0xB1, 0x08, 0xA1, 0x02, 0x30, 0xA0, 0xF1,
+0x2F, 0x01, 0xF0, 0x30, 0x91, 0xB0, 0x0A, 0x90, 0xE0, 0x50, 0x40, 0xA0, 0xB1, 0x50, 0x04, 0x50,
+0xE0, 0x08, 0x40, 0x0E, 0x40, 0x0C, 0x90, 0xE0, 0x90, 0xB0, 0x01, 0x50, 0xB0, 0x30, 0x04, 0x40,
+0x0A, 0x40, 0xE0, 0x0B, 0x90, 0x0A, 0x90, 0xB0, 0x09, 0xB0, 0x90, 0x0A, 0x50, 0xB0, 0x0A, 0x50,
+0xB0, 0x06, 0xD0, 0x80, 0xA0, 0x30, 0x90, 0x40, 0x50, 0x0B, 0xB0, 0x90, 0x0D, 0x51, 0x0A, 0x40,
+0xE0, 0x50, 0x80, 0x90, 0x40, 0x0F, 0x02, 0xB0, 0x90, 0x0F, 0x05, 0x50, 0x10, 0xB0, 0x01, 0x50,
+0xD0, 0x40, 0x0F, 0x32, 0x0F, 0x34, 0xA0, 0xB0, 0x00, 0xB0, 0xA0, 0x80, 0x30, 0xF0, 0x2F, 0x01,
+0xF0, 0xC0, 0xA0, 0xD0, 0x10, 0xB0, 0x40, 0xB0, 0x06, 0xE0, 0xA0, 0x90, 0x01, 0xE0, 0xA0, 0x80,
+0x05, 0xE0, 0x90, 0x07, 0x51, 0x0D, 0x51, 0x0C, 0x40, 0x00, 0xB0, 0x90, 0x40, 0x90, 0xD0, 0x70,
+0x40, 0x04, 0x40, 0x0B, 0x30, 0xB0, 0x09, 0xB0, 0x90, 0x0A, 0x50, 0xB0, 0x00, 0x30, 0x40, 0x07,
+0x90, 0x0A, 0xB0, 0x50, 0x0B, 0x90, 0x05, 0x50, 0xD0, 0xE0, 0x80, 0xA0, 0x00, 0x40, 0xB0, 0x0C,
+0x40, 0x0E, 0x40, 0x0B, 0x81, 0x50, 0x70, 0xB0, 0x90, 0x0F, 0x02, 0x50, 0x90, 0x0F, 0x04, 0x10,
+0xE0, 0x80, 0x01, 0xE1, 0x0F, 0x33, 0x0F, 0x35, 0x70, 0x40, 0xA0, 0x01, 0xE0, 0x30, 0xF0, 0x2F,
+0x00, 0xF0, 0x61, 0xA0, 0xD0, 0x70, 0xD0, 0x70, 0x10, 0x50, 0x04, 0xD0, 0x50, 0x03, 0x91, 0xA1,
+0x31, 0x80, 0xE0, 0xA0, 0x90, 0x07, 0x40, 0x0E, 0x40, 0x0C, 0xB0, 0x40, 0x70, 0xA0, 0x40, 0x00,
+0xB0, 0x30, 0x50, 0x90, 0x50, 0x02, 0xB0, 0x50, 0x0B, 0xE0, 0xA0, 0x30, 0x08, 0xB0, 0x50, 0x07,
+0x90, 0x33, 0xA0, 0xB0, 0x40, 0xA0, 0x30, 0xE0, 0x90, 0x03, 0x90, 0x0B, 0x90, 0x0B, 0x40, 0x03,
+0x90, 0xA0, 0x40, 0x90, 0x80, 0x00, 0xD0, 0xA0, 0xD0, 0x90, 0x40, 0xE0, 0x50, 0x09, 0xB0, 0x50,
+0x0D, 0xB0, 0x90, 0x0D, 0xA0, 0x00, 0x51, 0x0F, 0x02, 0x90, 0x50, 0x0F, 0x02, 0x10, 0x50, 0x00,
+0x40, 0x30, 0xE1, 0x0F, 0x34, 0x0F, 0x36, 0x70, 0x50, 0x01, 0x50, 0x70, 0x30, 0xF1, 0x2C, 0xF0,
+0x60, 0x70, 0x30, 0xD0, 0x50, 0x30, 0x70, 0x10, 0x31, 0x05, 0xA0, 0x02, 0x90, 0x50, 0x01, 0xB0,
+0x01, 0xB1, 0xA0, 0xB0, 0x06, 0x90, 0xB0, 0x00, 0xB0, 0x0B, 0x51, 0x0C, 0x50, 0x70, 0x01, 0xE0,
+0xA0, 0x70, 0x90, 0x01, 0x50, 0x40, 0x90, 0x50, 0x40, 0x0B, 0xB0, 0x50, 0x00, 0xB0, 0xD0, 0x50,
+0x06, 0x51, 0x06, 0xE0, 0x80, 0x01, 0x50, 0xB0, 0x04, 0x50, 0xE0, 0x30, 0x02, 0x40, 0x0B, 0x90,
+0x03, 0x90, 0xE0, 0x82, 0x31, 0xE1, 0x51, 0x90, 0x30, 0xE0, 0x02, 0x40, 0x30, 0x00, 0x30, 0xD0,
+0x70, 0xE0, 0xB0, 0x80, 0x30, 0x90, 0x08, 0x40, 0x0E, 0x90, 0xB0, 0x0C, 0x90, 0x80, 0x00, 0x40,
+0x0F, 0x03, 0x40, 0xB0, 0x0F, 0x00, 0x10, 0x30, 0x02, 0x30, 0xE0, 0x0F, 0x35, 0x0F, 0x37, 0x30,
+0xB1, 0x30, 0x00, 0xE0, 0x30, 0xF1, 0x2B, 0x60, 0xC0, 0x81, 0x30, 0x50, 0x30, 0x10, 0x40, 0xE0,
+0x00, 0xB1, 0x90, 0x80, 0x90, 0x50, 0xA0, 0x01, 0xB0, 0x40, 0x07, 0x70, 0x00, 0xE0, 0x80, 0x01,
+0x50, 0xB0, 0x00, 0x90, 0x01, 0x70, 0xA0, 0x50, 0x09, 0x40, 0x0D, 0x40, 0x30, 0x02, 0xB0, 0x06,
+0xB0, 0xE0, 0x91, 0x50, 0xB0, 0x07, 0x50, 0xB0, 0x01, 0x10, 0xA0, 0x06, 0x51, 0x05, 0x40, 0xE0,
+0x02, 0x90, 0xB0, 0x06, 0x40, 0xE0, 0x01, 0x40, 0x00, 0x50, 0x30, 0xA0, 0xE0, 0x06, 0x40, 0x01,
+0x80, 0x30, 0xE0, 0x50, 0xB3, 0x90, 0x80, 0xE0, 0xA0, 0x30, 0xE0, 0x80, 0x04, 0x50, 0xD0, 0x50,
+0xA0, 0x50, 0xA0, 0x90, 0xE0, 0xD0, 0x40, 0x08, 0x51, 0x0D, 0xB0, 0x90, 0x0D, 0x30, 0x50, 0x00,
+0x40, 0x0F, 0x03, 0x40, 0xB0, 0x0C, 0xB0, 0x10, 0xB0, 0x90, 0x30, 0x00, 0x80, 0xE0, 0x0F, 0x36,
+0x0F, 0x38, 0xA1, 0x02, 0x80, 0xA0, 0xF1, 0x29, 0xC0, 0x60, 0xF0, 0x30, 0x10, 0x60, 0xA0, 0x60,
+0xD0, 0x01, 0x50, 0xA0, 0x80, 0x40, 0x50, 0x40, 0xE0, 0xB0, 0x01, 0x40, 0x08, 0x50, 0xA0, 0x40,
+0xE0, 0x50, 0x81, 0x30, 0xE0, 0x00, 0x50, 0xA1, 0x00, 0xA0, 0x08, 0x51, 0x0C, 0xB0, 0x40, 0x70,
+0x0B, 0x90, 0x01, 0x50, 0x90, 0x41, 0x50, 0xB0, 0x03, 0x90, 0x01, 0x50, 0x80, 0x07, 0x50, 0xB0,
+0x05, 0xE0, 0x50, 0x02, 0x50, 0xB0, 0x07, 0xA0, 0xB0, 0x00, 0xE0, 0x31, 0xB0, 0x00, 0x90, 0xA0,
+0xE0, 0x04, 0x90, 0x00, 0xA0, 0x90, 0x01, 0xB0, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x01, 0x90, 0x50,
+0x90, 0x06, 0x30, 0x00, 0x30, 0x00, 0x30, 0xD0, 0x50, 0x0B, 0x40, 0x0E, 0x90, 0x50, 0x0C, 0xE0,
+0x50, 0x00, 0x51, 0x0F, 0x03, 0x40, 0x0B, 0x50, 0x10, 0x02, 0x90, 0xD0, 0x40, 0x0F, 0x37, 0x0F,
+0x39, 0xA0, 0xB0, 0x00, 0xB0, 0xA0, 0x40, 0x70, 0xF1, 0x28, 0x60, 0xF1, 0x60, 0xA0, 0x80, 0xF1,
+0xA0, 0xD0, 0x40, 0x30, 0x07, 0x90, 0x50, 0x0C, 0xD0, 0x40, 0x00, 0xB0, 0x40, 0xA0, 0x30, 0x02,
+0x70, 0x08, 0x40, 0x0D, 0x90, 0xD0, 0xB0, 0x0A, 0xB0, 0x50, 0x05, 0xB0, 0x91, 0x41, 0x50, 0x40,
+0x02, 0x80, 0x30, 0x06, 0x90, 0xB0, 0x05, 0x30, 0xB0, 0x02, 0x90, 0xB0, 0x08, 0xA1, 0x80, 0x50,
+0x04, 0x40, 0xA0, 0xE0, 0x51, 0xB0, 0x90, 0xA0, 0x40, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x05, 0x40,
+0x08, 0x40, 0xE0, 0x80, 0x10, 0xE0, 0x50, 0xA0, 0x0B, 0x51, 0x0E, 0x40, 0x0C, 0xE1, 0x01, 0x40,
+0x0F, 0x03, 0xB0, 0x40, 0x09, 0x90, 0xD0, 0x40, 0x30, 0x01, 0xE1, 0x0F, 0x38, 0x0F, 0x3A, 0x30,
+0x40, 0xA0, 0x01, 0x50, 0x70, 0xC0, 0xF0, 0x26, 0x60, 0xF1, 0x21, 0xF0, 0x21, 0xF1, 0xD0, 0x70,
+0xA0, 0xB0, 0x05, 0xB0, 0x90, 0x0F, 0x01, 0x40, 0x05, 0x50, 0xA0, 0x06, 0x51, 0x0D, 0x40, 0xA0,
+0x0B, 0x90, 0xB0, 0x0A, 0xB0, 0xE0, 0x90, 0x40, 0x90, 0x50, 0xE0, 0x30, 0xB0, 0x00, 0x90, 0x50,
+0x01, 0x90, 0x05, 0x90, 0x30, 0x03, 0x50, 0xB0, 0x0A, 0x50, 0x04, 0xB1, 0x50, 0x40, 0xE1, 0x40,
+0xE0, 0x40, 0x0B, 0x50, 0xB0, 0x08, 0xE0, 0xD0, 0x80, 0x90, 0x50, 0x40, 0x90, 0x0B, 0x40, 0x0E,
+0x51, 0x0C, 0x40, 0xA0, 0x90, 0x00, 0x40, 0x0F, 0x03, 0x50, 0x90, 0x07, 0x40, 0x70, 0x01, 0x40,
+0xE0, 0x80, 0xE0, 0x0F, 0x39, 0x0F, 0x3B, 0xA0, 0x40, 0x01, 0xB0, 0xA1, 0xC0, 0xF0, 0x24, 0x60,
+0x20, 0xF0, 0x26, 0xF0, 0x60, 0xD1, 0x90, 0xB0, 0x04, 0x40, 0x0F, 0x01, 0x51, 0x05, 0xB0, 0x80,
+0x06, 0x40, 0x0D, 0xB0, 0xA0, 0xE0, 0x0B, 0x40, 0x0C, 0x90, 0x03, 0xB0, 0x50, 0x30, 0x81, 0xE0,
+0x40, 0x90, 0x40, 0x51, 0xB2, 0x90, 0xA0, 0x04, 0x90, 0xB0, 0x04, 0xB4, 0x50, 0x41, 0x90, 0x41,
+0x91, 0x50, 0xB1, 0x03, 0x40, 0x0B, 0x51, 0x0A, 0x40, 0xE1, 0x90, 0x80, 0x0B, 0x50, 0xB0, 0x0E,
+0x40, 0x0E, 0xA0, 0x00, 0x50, 0x90, 0x0F, 0x03, 0x51, 0x05, 0xE0, 0xD0, 0x80, 0x02, 0xD0, 0x90,
+0x0F, 0x3A, 0x0F, 0x3C, 0x30, 0x90, 0x00, 0x70, 0x00, 0xB0, 0xA0, 0xC0, 0xF0, 0x21, 0xF0, 0x60,
+0xC0, 0x29, 0xF0, 0xC0, 0x70, 0x10, 0x90, 0x03, 0x90, 0xB0, 0x0F, 0x01, 0x40, 0x06, 0xB0, 0x70,
+0x06, 0x90, 0x0B, 0xE0, 0x31, 0x90, 0x0B, 0xB0, 0x90, 0x0B, 0xB0, 0x90, 0x08, 0x80, 0x40, 0x00,
+0x41, 0xB0, 0x51, 0x90, 0x30, 0x50, 0x94, 0x41, 0x95, 0x50, 0x90, 0x54, 0x0B, 0x40, 0x0C, 0x90,
+0x0C, 0x80, 0xB0, 0x30, 0xE0, 0x0B, 0x40, 0x0E, 0xB0, 0x90, 0x0B, 0xB0, 0x50, 0x30, 0x01, 0x90,
+0xB0, 0x0F, 0x03, 0x40, 0xB0, 0x03, 0x30, 0xA0, 0x00, 0x40, 0x80, 0x00, 0xA0, 0x50, 0x0F, 0x3B,
+0x0F, 0x3D, 0x80, 0xD0, 0x02, 0x50, 0x10, 0x60, 0xF1, 0x60, 0xC0, 0xF0, 0x2A, 0xF0, 0xC0, 0x30,
+0x03, 0x50, 0x90, 0x0F, 0x01, 0x90, 0xB0, 0x07, 0x90, 0xA0, 0xB0, 0x03, 0x40, 0x0A, 0xA1, 0x50,
+0xB0, 0x40, 0x0C, 0x51, 0x0B, 0x50, 0xB0, 0x08, 0xA0, 0xB0, 0xA0, 0x80, 0x31, 0x01, 0x50, 0xE0,
+0x05, 0x50, 0xB0, 0x0A, 0xB0, 0x90, 0x0B, 0x90, 0x0C, 0x40, 0x0C, 0x80, 0x90, 0xB0, 0x30, 0x0B,
+0x90, 0xB0, 0x0E, 0x90, 0xB0, 0x08, 0xE0, 0xA0, 0x80, 0x30, 0xA0, 0x02, 0x40, 0x0F, 0x04, 0x40,
+0x02, 0x70, 0x10, 0x02, 0xE0, 0x10, 0xB0, 0x50, 0x30, 0x40, 0x0F, 0x39, 0x0F, 0x3E, 0x40, 0x30,
+0x00, 0xB0, 0xA0, 0x00, 0x30, 0x80, 0xC0, 0x60, 0xF0, 0x2C, 0xF0, 0xA0, 0x03, 0x40, 0x0F, 0x01,
+0xB0, 0x90, 0x09, 0x30, 0xA0, 0x03, 0x40, 0x0B, 0x30, 0x00, 0x51, 0x0C, 0x90, 0x0C, 0x40, 0x09,
+0x90, 0x70, 0xE0, 0x90, 0x00, 0x90, 0x30, 0x00, 0x50, 0xE0, 0x05, 0x90, 0xB0, 0x0B, 0x90, 0x0B,
+0x90, 0xB0, 0x0B, 0x51, 0x0B, 0x70, 0x40, 0x00, 0x30, 0x0C, 0x40, 0x0F, 0x00, 0x40, 0x06, 0xB0,
+0x70, 0x40, 0x02, 0x90, 0xA0, 0x50, 0x00, 0xB0, 0x90, 0x0F, 0x04, 0x90, 0xB0, 0xD0, 0x40, 0x50,
+0x30, 0x00, 0x50, 0x30, 0x01, 0x80, 0x50, 0x30, 0x0F, 0x39, 0x0F, 0x3D, 0x50, 0x00, 0x90, 0x31,
+0xB0, 0x01, 0x10, 0xA0, 0xF1, 0x2D, 0x60, 0x70, 0x01, 0x40, 0xB0, 0x0F, 0x01, 0x90, 0x09, 0xE0,
+0x30, 0x50, 0x02, 0x90, 0xB0, 0x0B, 0xA0, 0x00, 0x40, 0x0D, 0x40, 0x0C, 0x40, 0x0A, 0xA0, 0xE0,
+0x90, 0x01, 0xE0, 0x80, 0x40, 0xE0, 0x05, 0x50, 0xB0, 0x0B, 0x90, 0x0B, 0x51, 0x0B, 0xB0, 0x90,
+0x0B, 0xA0, 0x90, 0x50, 0xA0, 0x0C, 0x90, 0xB0, 0x0E, 0x51, 0x04, 0x90, 0xA0, 0xB0, 0x04, 0xB0,
+0x30, 0x40, 0x00, 0x90, 0x50, 0x0F, 0x03, 0x50, 0x10, 0x80, 0x01, 0x40, 0x80, 0x30, 0x50, 0xE0,
+0x51, 0x80, 0x90, 0x0F, 0x39, 0x0F, 0x3C, 0xA0, 0x71, 0x00, 0x90, 0x70, 0x01, 0x30, 0x10, 0x30,
+0xA0, 0xF1, 0x2C, 0xF0, 0x60, 0x10, 0xA0, 0xB0, 0x0F, 0x01, 0x51, 0x09, 0x40, 0x80, 0x70, 0x01,
+0xB0, 0x90, 0x0B, 0xB0, 0x30, 0x00, 0x90, 0x0C, 0xB0, 0x90, 0x0C, 0x90, 0x0A, 0xA0, 0x00, 0x90,
+0x02, 0x50, 0xD0, 0xE0, 0x05, 0x90, 0xB0, 0x0B, 0x90, 0x0B, 0xB0, 0x90, 0x0C, 0x40, 0x09, 0xB0,
+0x70, 0x50, 0x00, 0x40, 0x30, 0x0C, 0xB0, 0x90, 0x0F, 0x00, 0x40, 0x04, 0x30, 0xB0, 0x07, 0xA0,
+0xB0, 0x00, 0x40, 0x0F, 0x02, 0x40, 0xD0, 0x70, 0x10, 0xB0, 0x00, 0x50, 0x70, 0xB0, 0x70, 0x40,
+0x70, 0x80, 0x0F, 0x3B, 0x0F, 0x3E, 0x50, 0xA0, 0x00, 0xB0, 0xA0, 0x30, 0x10, 0x80, 0x00, 0xB0,
+0x70, 0xC0, 0xF0, 0x2B, 0xF1, 0xC0, 0x30, 0xB0, 0x0F, 0x01, 0x40, 0x0C, 0xA0, 0x01, 0x90, 0xB0,
+0x0A, 0x90, 0x70, 0x00, 0x50, 0xB0, 0x0C, 0x90, 0xB0, 0x0B, 0xB0, 0x90, 0x05, 0x50, 0xB1, 0x50,
+0xA0, 0x90, 0xB0, 0x50, 0x03, 0xA0, 0x06, 0x50, 0xB0, 0x0B, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x07,
+0x40, 0xA0, 0x30, 0x02, 0x40, 0xE0, 0x0D, 0x90, 0x0F, 0x00, 0xB0, 0x90, 0x03, 0x80, 0x50, 0x08,
+0x70, 0x01, 0x40, 0x0F, 0x00, 0xA1, 0x01, 0x11, 0x31, 0x00, 0x40, 0x80, 0x01, 0x70, 0x80, 0x0F,
+0x3A, 0x0F, 0x3E, 0xE0, 0xA0, 0x00, 0x40, 0xB0, 0xA0, 0xD0, 0x01, 0xB0, 0x30, 0xA0, 0x60, 0xF0,
+0x2B, 0xF0, 0x60, 0xC0, 0xD0, 0x30, 0x0E, 0x90, 0xB0, 0x0C, 0xA0, 0x01, 0x40, 0x06, 0xB1, 0x02,
+0xE0, 0x50, 0x00, 0x40, 0x0D, 0x90, 0x0C, 0xB0, 0x50, 0x04, 0x80, 0x33, 0xB0, 0x00, 0x50, 0xB0,
+0x02, 0x50, 0x30, 0x01, 0x40, 0x90, 0x02, 0x90, 0xB0, 0x0B, 0x40, 0x0C, 0x40, 0x0C, 0x51, 0x06,
+0xA0, 0x04, 0xB0, 0x30, 0x0D, 0xB0, 0x90, 0x0F, 0x00, 0x40, 0x02, 0x80, 0xE0, 0x09, 0xB0, 0x30,
+0x00, 0x51, 0x0D, 0x70, 0x30, 0x80, 0x01, 0x50, 0x10, 0x40, 0xB0, 0x00, 0xB0, 0xD0, 0xB0, 0x01,
+0x70, 0x50, 0x0F, 0x39, 0x0F, 0x39, 0x80, 0x72, 0xD0, 0xA0, 0xB0, 0xA0, 0x30, 0xA0, 0x50, 0x80,
+0xE0, 0x00, 0xA0, 0x01, 0x81, 0xF1, 0x28, 0xF0, 0x60, 0xC0, 0xF0, 0xC0, 0xD0, 0x04, 0x40, 0xA0,
+0x30, 0x80, 0xA2, 0x80, 0x90, 0x00, 0x40, 0x0D, 0x30, 0xE0, 0x51, 0x90, 0xB0, 0x02, 0xE0, 0xA0,
+0x70, 0x30, 0x02, 0xE0, 0x50, 0xB0, 0x50, 0x0A, 0x40, 0xA1, 0x30, 0xA0, 0x30, 0x81, 0x30, 0x42,
+0x50, 0xB0, 0x80, 0xA0, 0x70, 0x30, 0x40, 0xB0, 0x02, 0xD0, 0x40, 0x05, 0x50, 0xB0, 0x03, 0xE0,
+0x90, 0x00, 0xB0, 0x10, 0xA0, 0x01, 0x90, 0xB0, 0x0B, 0x40, 0x0C, 0x90, 0xB0, 0x0C, 0x40, 0x05,
+0x80, 0x50, 0x05, 0x30, 0x0E, 0x40, 0x0F, 0x00, 0xB0, 0x90, 0x00, 0x90, 0x30, 0x0B, 0xA0, 0x01,
+0x40, 0x0B, 0x50, 0x70, 0x40, 0x00, 0x40, 0xE0, 0x00, 0xA0, 0x50, 0x00, 0x10, 0x40, 0x00, 0xE0,
+0x70, 0x01, 0xE0, 0x80, 0x0F, 0x39, 0x0F, 0x39, 0x30, 0xD0, 0xB0, 0x05, 0x50, 0x70, 0x00, 0xE0,
+0xD0, 0x50, 0x01, 0x50, 0x70, 0xA0, 0xF1, 0x27, 0xC0, 0x60, 0xF1, 0x60, 0x10, 0x90, 0x03, 0xA0,
+0x01, 0x50, 0x02, 0xB0, 0x30, 0xE0, 0x0F, 0x00, 0xE1, 0xA0, 0xE0, 0x70, 0x01, 0x90, 0xD0, 0x51,
+0x30, 0x02, 0xA0, 0x00, 0x90, 0x0B, 0xA0, 0x01, 0x50, 0x01, 0xB2, 0x91, 0x40, 0xE0, 0xA0, 0x40,
+0x00, 0x90, 0x30, 0x90, 0x80, 0xA0, 0x30, 0xD0, 0x90, 0x06, 0x90, 0x05, 0xA0, 0x01, 0xB0, 0xE0,
+0x10, 0x00, 0x90, 0xB0, 0x0B, 0x90, 0x0C, 0x51, 0x0C, 0x40, 0x04, 0xB0, 0xA0, 0x06, 0x90, 0x40,
+0x0D, 0xB0, 0x90, 0x0F, 0x00, 0x90, 0x40, 0x30, 0x0C, 0xA0, 0x02, 0x40, 0x09, 0x40, 0xD0, 0xA0,
+0x02, 0x80, 0x70, 0xB0, 0x01, 0xA0, 0xD0, 0x50, 0x00, 0x30, 0x70, 0xB0, 0xA0, 0x90, 0x0F, 0x39,
+0x0F, 0x3A, 0x40, 0xD0, 0xB0, 0x03, 0xB0, 0x31, 0x01, 0x50, 0xA0, 0x01, 0xA0, 0x00, 0xB0, 0x70,
+0x60, 0xF0, 0x26, 0x60, 0xF0, 0x21, 0xF1, 0xD0, 0x02, 0x70, 0x50, 0x06, 0xB0, 0xA0, 0x0F, 0x00,
+0x80, 0x30, 0xB0, 0x00, 0x50, 0xA0, 0xD0, 0x80, 0x40, 0x00, 0xB0, 0xA0, 0xB0, 0xD0, 0x80, 0xD0,
+0x50, 0x90, 0x0B, 0x30, 0x00, 0x90, 0x0C, 0x80, 0xE0, 0x02, 0x90, 0x40, 0x07, 0x40, 0x05, 0xA0,
+0x03, 0xE0, 0xA0, 0x50, 0xB0, 0x0B, 0x90, 0x0C, 0xB0, 0x50, 0x0C, 0x90, 0x04, 0xE0, 0x50, 0x07,
+0x70, 0xB0, 0x0D, 0x40, 0x0F, 0x00, 0xB0, 0xA0, 0x0D, 0xA0, 0x02, 0x50, 0x90, 0x07, 0x30, 0x70,
+0x00, 0x90, 0x80, 0x00, 0x40, 0x30, 0x03, 0xA0, 0xB0, 0xD0, 0xE0, 0x50, 0x90, 0xA0, 0x40, 0x0F,
+0x3A, 0x0F, 0x3B, 0x50, 0xE0, 0x30, 0xD0, 0x70, 0xD0, 0x70, 0x80, 0x00, 0x30, 0x70, 0xE0, 0x00,
+0xA1, 0xB0, 0x01, 0x90, 0x70, 0x30, 0xF1, 0x23, 0x60, 0xC0, 0xF0, 0x20, 0xF0, 0x20, 0xF0, 0x80,
+0xD0, 0xB0, 0xD0, 0x50, 0x07, 0x40, 0x90, 0xE0, 0x0D, 0x50, 0x30, 0x04, 0xB0, 0x03, 0x40, 0x30,
+0x02, 0xE0, 0x30, 0x0B, 0xA0, 0x50, 0x40, 0x0C, 0x40, 0x80, 0x02, 0x30, 0x08, 0x40, 0x05, 0x41,
+0x01, 0x50, 0xA0, 0x30, 0x50, 0xB0, 0x0B, 0x50, 0xB0, 0x0B, 0xB0, 0x90, 0x0C, 0x51, 0x03, 0x30,
+0x08, 0x90, 0xA0, 0x90, 0x0C, 0x51, 0x0E, 0x30, 0x40, 0x50, 0x0B, 0x80, 0x90, 0x03, 0x90, 0xB0,
+0x04, 0xB0, 0xD1, 0x02, 0xE0, 0xA0, 0xE0, 0x00, 0xE0, 0x02, 0x30, 0x00, 0x30, 0x10, 0xB0, 0x0F,
+0x3D, 0x0F, 0x3D, 0xE0, 0xD0, 0x50, 0x02, 0x70, 0x80, 0x00, 0x30, 0x90, 0x00, 0x30, 0x40, 0x01,
+0xA0, 0x00, 0x40, 0xA0, 0xF1, 0x20, 0xF0, 0xC0, 0x60, 0xF0, 0x23, 0xF0, 0x30, 0xD0, 0x30, 0x08,
+0x51, 0x00, 0xA0, 0x0D, 0x91, 0x0E, 0x90, 0x41, 0x0A, 0xE0, 0x91, 0x0C, 0xB0, 0xE0, 0x30, 0x01,
+0xA0, 0x08, 0x90, 0x05, 0xE1, 0x01, 0xA0, 0x70, 0x51, 0xB0, 0x0B, 0x50, 0xB0, 0x0C, 0x40, 0x0D,
+0x90, 0x02, 0xB0, 0xA0, 0x03, 0xB1, 0x00, 0xB0, 0x50, 0xE0, 0x90, 0x70, 0x80, 0x0C, 0x40, 0x0D,
+0xE1, 0x00, 0x40, 0x0B, 0x30, 0x90, 0x04, 0x40, 0x03, 0x40, 0x70, 0x51, 0x30, 0x00, 0xB0, 0xA0,
+0x90, 0x01, 0xD0, 0x30, 0x01, 0x80, 0x70, 0x30, 0xE0, 0x30, 0x0F, 0x3D, 0x0F, 0x3E, 0x50, 0xD0,
+0x50, 0x00, 0x30, 0x80, 0x01, 0x80, 0x40, 0x01, 0xE0, 0x31, 0x02, 0xE0, 0xD0, 0x60, 0xF1, 0x60,
+0x25, 0xF0, 0xC0, 0x10, 0x50, 0x08, 0x40, 0x01, 0x40, 0xE0, 0x0C, 0xE0, 0x50, 0x0E, 0x90, 0x00,
+0xD0, 0xB0, 0x03, 0xB0, 0x40, 0x90, 0x02, 0xE0, 0x40, 0x50, 0x0C, 0x50, 0xB0, 0x40, 0xE0, 0x00,
+0x90, 0xA0, 0x07, 0x90, 0x04, 0xE0, 0x80, 0x02, 0xA0, 0x80, 0xB0, 0x50, 0xB0, 0x0B, 0xB0, 0x50,
+0x0C, 0x40, 0x0D, 0x40, 0x02, 0x70, 0x50, 0x02, 0xE0, 0x30, 0x80, 0x31, 0x80, 0x40, 0x80, 0x90,
+0xB0, 0x0C, 0x51, 0x0B, 0xA0, 0x90, 0x01, 0xB0, 0x90, 0x0A, 0x50, 0xD0, 0xE0, 0x30, 0xA0, 0x30,
+0x00, 0xB0, 0x40, 0x01, 0x30, 0x10, 0x02, 0xE0, 0x80, 0xA0, 0xB0, 0x01, 0xB0, 0xA0, 0x70, 0x40,
+0x00, 0x90, 0x30, 0x0F, 0x40, 0x0F, 0x3F, 0xB0, 0x40, 0x50, 0x70, 0x01, 0xB0, 0xD0, 0x00, 0xE0,
+0x30, 0x00, 0xB0, 0x70, 0xB0, 0x01, 0xA0, 0x00, 0x31, 0x60, 0xF0, 0x26, 0x60, 0xE1, 0xB0, 0x06,
+0x90, 0xB0, 0x01, 0x40, 0x30, 0x0B, 0xB0, 0x40, 0x70, 0x40, 0x0C, 0x51, 0x00, 0xB0, 0x70, 0xA0,
+0x00, 0x32, 0x90, 0x40, 0xA1, 0x00, 0x90, 0x30, 0x0D, 0x90, 0x00, 0x90, 0x40, 0x01, 0xB0, 0x70,
+0x40, 0x05, 0x40, 0x04, 0x41, 0x02, 0xE0, 0xD0, 0x00, 0x50, 0xB0, 0x0B, 0xB0, 0x90, 0x0C, 0x90,
+0x0D, 0x50, 0xB0, 0x01, 0xA0, 0x02, 0x50, 0x30, 0x05, 0x90, 0x0F, 0x00, 0x40, 0x08, 0xE0, 0x30,
+0xA0, 0x90, 0x03, 0x40, 0x0B, 0x90, 0xB0, 0x01, 0x30, 0x01, 0x50, 0x90, 0xD0, 0x40, 0xB0, 0x30,
+0x01, 0x80, 0x30, 0x03, 0xB0, 0x50, 0x00, 0xD0, 0x90, 0x0F, 0x42, 0x0F, 0x41, 0xE0, 0x80, 0x00,
+0xB0, 0x10, 0x90, 0x00, 0x30, 0x50, 0xE0, 0x01, 0x30, 0xE0, 0xA0, 0x02, 0x30, 0x70, 0x60, 0xF0,
+0x24, 0xF0, 0x30, 0x10, 0x70, 0x07, 0x40, 0x03, 0xA0, 0x0B, 0x40, 0x00, 0xB0, 0x30, 0x0C, 0x40,
+0x03, 0x50, 0x70, 0x90, 0x05, 0x70, 0xE0, 0x80, 0x0D, 0x90, 0x00, 0xE0, 0x90, 0x03, 0x30, 0xB0,
+0x04, 0x40, 0x04, 0x30, 0x50, 0x02, 0x90, 0x10, 0x00, 0x90, 0xB0, 0x0C, 0x90, 0x0C, 0x51, 0x0C,
+0xB0, 0x50, 0x01, 0xA0, 0x02, 0xE0, 0x10, 0x50, 0x04, 0x51, 0x0E, 0x51, 0x02, 0x90, 0xE0, 0x80,
+0x30, 0xA0, 0x90, 0x06, 0xB0, 0x90, 0x0D, 0x50, 0xA0, 0xE1, 0xA0, 0x10, 0x50, 0x01, 0x40, 0xE0,
+0xA0, 0x90, 0x07, 0xB0, 0xD0, 0x50, 0x0F, 0x41, 0x0F, 0x41, 0xB0, 0xA0, 0x30, 0xD0, 0x40, 0x01,
+0x40, 0x30, 0xB0, 0x02, 0xE0, 0xA0, 0x01, 0x50, 0x30, 0x00, 0xA0, 0x80, 0xF1, 0x22, 0xF0, 0x30,
+0xA0, 0x07, 0x90, 0xB0, 0x03, 0xA0, 0xB0, 0x09, 0xB0, 0x90, 0x00, 0xB0, 0x70, 0x0B, 0xB0, 0x90,
+0x0C, 0x50, 0xA0, 0xE0, 0x0D, 0x40, 0x00, 0x70, 0x04, 0xE0, 0x50, 0x04, 0x90, 0x03, 0xA0, 0x40,
+0x04, 0x90, 0x00, 0x50, 0xB0, 0x0C, 0x40, 0x0C, 0xB0, 0x90, 0x0D, 0x90, 0xB0, 0xA0, 0xE0, 0x03,
+0x30, 0x40, 0x05, 0x40, 0x0F, 0x00, 0x40, 0x01, 0x30, 0xE0, 0x50, 0xB0, 0x0A, 0x90, 0xB0, 0x0E,
+0x90, 0x10, 0xE0, 0xB0, 0x30, 0x01, 0x90, 0x70, 0xB0, 0x09, 0x90, 0x80, 0x0F, 0x41, 0x0F, 0x43,
+0x90, 0xB0, 0x09, 0x50, 0x70, 0x50, 0x30, 0x02, 0xA0, 0x70, 0xC0, 0xF0, 0x22, 0xC0, 0xA0, 0x30,
+0x05, 0xB0, 0x90, 0x03, 0xB0, 0x30, 0x50, 0x90, 0x00, 0xB0, 0x06, 0x40, 0x01, 0x70, 0x0C, 0x90,
+0xB0, 0x0D, 0x40, 0x30, 0x0D, 0x90, 0x00, 0xD0, 0x40, 0x03, 0x30, 0xB0, 0x04, 0x90, 0x02, 0x80,
+0x90, 0x07, 0x90, 0xB0, 0x0C, 0x40, 0x0D, 0x90, 0x0D, 0x40, 0xD0, 0x06, 0x30, 0x90, 0x04, 0x40,
+0x0F, 0x00, 0x90, 0xB0, 0x00, 0x80, 0x30, 0x0D, 0x40, 0x0D, 0xE0, 0x10, 0x40, 0x01, 0x41, 0xE0,
+0x80, 0x0F, 0x4F, 0x0F, 0x51, 0xA1, 0x01, 0x50, 0x80, 0x00, 0xA0, 0x80, 0xF1, 0x20, 0xF1, 0xD0,
+0x05, 0x40, 0x04, 0x10, 0xA0, 0x70, 0x30, 0xA1, 0x70, 0x05, 0x40, 0x01, 0xB0, 0xA0, 0x0B, 0x40,
+0x0E, 0xE0, 0x90, 0x0C, 0x51, 0x00, 0xE0, 0x80, 0x90, 0x02, 0xE0, 0x90, 0x03, 0xB0, 0x50, 0x01,
+0xB0, 0x30, 0x08, 0x90, 0xB0, 0x0C, 0x40, 0x0D, 0x90, 0x0D, 0x50, 0x30, 0x07, 0x30, 0x80, 0x03,
+0xB0, 0x90, 0x0F, 0x00, 0x40, 0x01, 0xD0, 0x0D, 0x51, 0x0A, 0xB0, 0xD0, 0x80, 0x00, 0xA0, 0x01,
+0x50, 0xD0, 0x90, 0x0F, 0x50, 0x0F, 0x52, 0x50, 0xA0, 0x50, 0xA0, 0x02, 0xA0, 0x70, 0x60, 0xF2,
+0x70, 0xB0, 0x03, 0x51, 0x05, 0x40, 0xA0, 0x02, 0x40, 0xA0, 0x03, 0x40, 0x00, 0x40, 0x30, 0xE0,
+0x80, 0x40, 0x09, 0x51, 0x0E, 0x30, 0xE0, 0x06, 0xB0, 0x50, 0x03, 0x90, 0xB0, 0x01, 0x30, 0xB0,
+0x03, 0xA0, 0xB0, 0x02, 0x51, 0x01, 0x50, 0xE0, 0x08, 0x50, 0xB0, 0x0C, 0x90, 0x0D, 0x40, 0x0E,
+0xE0, 0x08, 0x90, 0xA0, 0xE0, 0x02, 0x40, 0x0F, 0x00, 0x90, 0x00, 0x80, 0x50, 0x0E, 0x40, 0x09,
+0x80, 0x10, 0x90, 0x01, 0x90, 0xE0, 0x80, 0x30, 0x0F, 0x52, 0x0F, 0x54, 0x31, 0x01, 0x90, 0xE0,
+0xB0, 0x30, 0x80, 0xF1, 0x80, 0xD0, 0x70, 0x02, 0x40, 0x05, 0x40, 0xE0, 0xB0, 0x03, 0xA0, 0x03,
+0x40, 0x00, 0x30, 0x90, 0x50, 0xA0, 0xE0, 0x09, 0x90, 0x0E, 0xB0, 0x50, 0xA0, 0x05, 0xB0, 0x40,
+0x30, 0x03, 0x90, 0x00, 0x51, 0xA0, 0x04, 0x90, 0xE0, 0x02, 0x50, 0xB0, 0x50, 0x30, 0x70, 0x09,
+0x50, 0xB0, 0x0C, 0x90, 0x0D, 0x90, 0x0D, 0x50, 0x80, 0x0A, 0xE0, 0x30, 0x01, 0x90, 0xB0, 0x0F,
+0x00, 0x81, 0x0F, 0x00, 0xB0, 0x90, 0x06, 0x90, 0xD0, 0xE0, 0x00, 0xA0, 0x01, 0xB0, 0xD0, 0x90,
+0x0F, 0x53, 0x0F, 0x55, 0x40, 0xA0, 0x50, 0xA0, 0x02, 0x70, 0xA0, 0x60, 0x30, 0xD0, 0x10, 0x70,
+0x91, 0xB0, 0x05, 0xD0, 0x05, 0xA0, 0x02, 0x90, 0xB0, 0x00, 0x50, 0xA0, 0x90, 0x0B, 0x40, 0x0E,
+0x90, 0x00, 0x80, 0x50, 0x03, 0x70, 0x10, 0xD0, 0x10, 0xE0, 0x90, 0x01, 0x40, 0x00, 0x70, 0xE0,
+0xA0, 0x04, 0x50, 0xE0, 0x02, 0x90, 0x00, 0x80, 0x90, 0x0A, 0x50, 0xB0, 0x0C, 0x90, 0xB0, 0x0C,
+0x51, 0x0A, 0x50, 0x80, 0xA0, 0x40, 0x0B, 0x40, 0x80, 0x00, 0xB0, 0x90, 0x0D, 0x50, 0xE0, 0x80,
+0x0F, 0x02, 0x40, 0x05, 0x30, 0x10, 0x40, 0x01, 0x40, 0xE0, 0x40, 0xA0, 0x0F, 0x55, 0x0F, 0x57,
+0x30, 0xA0, 0x01, 0x90, 0xE0, 0x00, 0x80, 0xA0, 0x90, 0x10, 0x80, 0x00, 0x90, 0x04, 0xB0, 0xA0,
+0x40, 0x05, 0x30, 0x50, 0x01, 0x90, 0x02, 0xA0, 0x40, 0x0A, 0x51, 0x0E, 0x40, 0x00, 0x40, 0x90,
+0x02, 0xB0, 0xE0, 0x00, 0x80, 0x30, 0x10, 0x70, 0x01, 0x90, 0x00, 0xD0, 0x50, 0xA0, 0x04, 0x50,
+0xE0, 0x02, 0x40, 0x00, 0x80, 0xB0, 0x0A, 0x50, 0xB0, 0x0C, 0x90, 0xB0, 0x0D, 0x90, 0x0A, 0x70,
+0x40, 0x00, 0x51, 0x0B, 0x30, 0x50, 0x00, 0x40, 0x09, 0xE0, 0xA0, 0x31, 0xE0, 0x90, 0xB0, 0x90,
+0x0F, 0x02, 0x40, 0x02, 0xE0, 0xD0, 0x40, 0x00, 0xA0, 0x02, 0x10, 0x40, 0x0F, 0x56, 0x0F, 0x58,
+0x50, 0x70, 0x40, 0x30, 0x02, 0xA0, 0x30, 0x81, 0xA0, 0x40, 0x03, 0x31, 0xB0, 0x06, 0x80, 0x50,
+0x00, 0x50, 0xE0, 0x40, 0x00, 0x50, 0x80, 0x0B, 0x40, 0x50, 0xD0, 0x0D, 0x40, 0x00, 0x90, 0x40,
+0x07, 0x30, 0x70, 0x01, 0x90, 0x50, 0x10, 0x00, 0x90, 0x30, 0x03, 0xB0, 0x80, 0x02, 0x40, 0x00,
+0x30, 0xB0, 0x0A, 0x50, 0xB0, 0x0C, 0x50, 0xB0, 0x0D, 0x40, 0x09, 0x90, 0xE0, 0x02, 0x40, 0x0B,
+0xB0, 0x30, 0x00, 0x90, 0xB0, 0x02, 0x50, 0x02, 0xE0, 0xA0, 0x50, 0x05, 0x40, 0x0F, 0x02, 0x50,
+0xB0, 0x50, 0xD0, 0x70, 0x90, 0x01, 0x50, 0x80, 0xE0, 0xA0, 0x0F, 0x58, 0x0F, 0x5A, 0x80, 0x30,
+0xB0, 0x00, 0x41, 0x00, 0x90, 0xD0, 0x81, 0xA0, 0xB0, 0x00, 0x70, 0x50, 0x07, 0xB0, 0xD0, 0x90,
+0x00, 0x90, 0xA0, 0x80, 0x70, 0xA0, 0x50, 0x0B, 0x90, 0x10, 0x40, 0x0C, 0xB0, 0x50, 0x00, 0xA0,
+0xB0, 0x07, 0xB0, 0x10, 0x70, 0x30, 0x40, 0x00, 0x10, 0x40, 0x00, 0xA0, 0xB0, 0x02, 0x50, 0xE0,
+0x02, 0x40, 0x00, 0xA0, 0x0B, 0x50, 0xB0, 0x0C, 0x51, 0x0D, 0x40, 0x09, 0x40, 0x90, 0x02, 0x40,
+0x0C, 0x30, 0x90, 0x00, 0x90, 0x01, 0xA0, 0x70, 0xB1, 0x30, 0x40, 0x07, 0xB0, 0x90, 0x0F, 0x01,
+0xB0, 0xA0, 0xD0, 0xB0, 0x00, 0xA0, 0x01, 0x90, 0x70, 0x90, 0x00, 0x30, 0x80, 0x0F, 0x56, 0x0F,
+0x5B, 0xB0, 0xA0, 0xE0, 0x30, 0x01, 0x40, 0x10, 0xA1, 0xE0, 0x30, 0xA0, 0x50, 0x08, 0xB0, 0x90,
+0xA0, 0x40, 0xA0, 0x90, 0x00, 0xA0, 0x0C, 0x50, 0xE0, 0x10, 0x90, 0x0C, 0x90, 0x00, 0xA0, 0x50,
+0x09, 0xE0, 0x10, 0x70, 0x30, 0x50, 0x10, 0x90, 0x50, 0xE0, 0x03, 0x50, 0xE0, 0x02, 0x90, 0x00,
+0x30, 0x0B, 0x50, 0xB0, 0x0C, 0xB0, 0x50, 0x0D, 0x90, 0x09, 0x30, 0xB0, 0x02, 0x90, 0xB0, 0x0C,
+0xD0, 0x00, 0x91, 0xA0, 0xE0, 0xB0, 0x70, 0xA0, 0x50, 0x09, 0x40, 0x0F, 0x00, 0xE0, 0xD0, 0x11,
+0x01, 0x50, 0x31, 0xE0, 0x01, 0xE0, 0x50, 0xE0, 0x50, 0x0F, 0x55, 0x0F, 0x59, 0x90, 0x70, 0x30,
+0x00, 0x40, 0xA0, 0x50, 0x00, 0x10, 0xD0, 0x01, 0x71, 0xD0, 0x0C, 0x30, 0xB0, 0x01, 0x30, 0x0C,
+0x90, 0x80, 0xD0, 0x40, 0x0C, 0x90, 0xE0, 0x90, 0x0C, 0xE0, 0xD0, 0x70, 0x10, 0x00, 0x50, 0xE0,
+0x03, 0x50, 0xE0, 0x02, 0x90, 0x00, 0xA0, 0x0B, 0x50, 0xB0, 0x0C, 0xB0, 0x90, 0x0D, 0x90, 0xB0,
+0x07, 0xB0, 0x30, 0x03, 0x51, 0x0C, 0x10, 0x30, 0xA0, 0xE0, 0x0F, 0x00, 0x51, 0x0C, 0x40, 0x10,
+0xE0, 0x00, 0x50, 0x10, 0x80, 0x00, 0xE0, 0xA0, 0x00, 0x80, 0xD0, 0xA0, 0x00, 0x80, 0x40, 0x0F,
+0x56, 0x0F, 0x59, 0x80, 0x50, 0x90, 0xD0, 0x01, 0x80, 0xD0, 0x10, 0x50, 0x01, 0xA0, 0xB0, 0xA0,
+0x70, 0xB0, 0x09, 0x51, 0x02, 0x30, 0xB0, 0x0A, 0xB0, 0x50, 0x30, 0x11, 0x40, 0x0B, 0x50, 0xA0,
+0x0C, 0x50, 0xE0, 0x10, 0xA1, 0x40, 0xB0, 0x80, 0x03, 0x50, 0xE0, 0x01, 0xB0, 0x90, 0x00, 0xA0,
+0x0B, 0x50, 0xB0, 0x0D, 0x90, 0x0D, 0x51, 0x07, 0xE0, 0x90, 0x04, 0x40, 0x0B, 0xA0, 0xB0, 0x01,
+0x90, 0x0F, 0x01, 0x40, 0x0A, 0x90, 0xD0, 0x30, 0x50, 0x80, 0x01, 0x30, 0x10, 0xA0, 0x90, 0x00,
+0xE0, 0x80, 0x00, 0xE0, 0xA0, 0x0F, 0x58, 0x0F, 0x5C, 0x10, 0x02, 0xB0, 0x70, 0xE0, 0x00, 0x80,
+0x50, 0x01, 0x30, 0xD0, 0x80, 0xB0, 0x07, 0x40, 0x03, 0xA0, 0x0B, 0x90, 0xB0, 0xE0, 0xD0, 0x70,
+0xB0, 0x0A, 0x50, 0x90, 0x80, 0x0B, 0x40, 0xD0, 0xE0, 0x70, 0xD0, 0x80, 0xE0, 0x30, 0xB0, 0x03,
+0x50, 0xE0, 0x01, 0xB0, 0x90, 0x00, 0x30, 0x0B, 0x90, 0xB0, 0x0D, 0x40, 0x0E, 0x90, 0x06, 0x50,
+0xA0, 0x05, 0x40, 0x0A, 0x80, 0x90, 0x02, 0x90, 0x0F, 0x01, 0x51, 0x07, 0x50, 0x70, 0x10, 0xB0,
+0x01, 0x30, 0x00, 0xB0, 0x30, 0xE0, 0x00, 0x40, 0xB0, 0xE0, 0x80, 0x01, 0xD0, 0x90, 0x0F, 0x57,
+0x0F, 0x59, 0xB0, 0x40, 0x70, 0x30, 0x00, 0x40, 0x80, 0xA0, 0x00, 0x90, 0xA0, 0x70, 0x02, 0xA0,
+0x00, 0xE0, 0xD0, 0x80, 0x05, 0xB0, 0x90, 0x02, 0xE1, 0x0B, 0x40, 0x01, 0x40, 0x10, 0x50, 0x0A,
+0x50, 0xE0, 0x90, 0x0D, 0x50, 0xB0, 0x80, 0x70, 0x81, 0x90, 0x03, 0x50, 0xE0, 0x01, 0xB0, 0x50,
+0x00, 0x30, 0x50, 0x0A, 0x50, 0xB0, 0x0D, 0x40, 0x0E, 0x40, 0x06, 0x80, 0x50, 0x05, 0x50, 0xB0,
+0x09, 0xA0, 0x03, 0xB0, 0x90, 0x0F, 0x01, 0x40, 0x05, 0xB0, 0xA0, 0x70, 0x51, 0x80, 0x01, 0x50,
+0xD0, 0x30, 0xB1, 0x70, 0x30, 0x00, 0xB0, 0xD0, 0x01, 0x90, 0xA0, 0x0F, 0x57, 0x0F, 0x57, 0x30,
+0xD0, 0x70, 0x30, 0x90, 0x00, 0xB0, 0x40, 0xD0, 0xE0, 0x02, 0x40, 0xA0, 0x50, 0xE0, 0x50, 0x01,
+0xE0, 0x30, 0x10, 0x80, 0x03, 0x40, 0x02, 0x80, 0x10, 0x0B, 0xB0, 0x50, 0x0F, 0x00, 0xE0, 0xA0,
+0x0D, 0x51, 0x00, 0xE0, 0xD0, 0xE0, 0x00, 0x30, 0x03, 0x50, 0xE0, 0x01, 0x51, 0x00, 0x80, 0xB0,
+0x0A, 0x90, 0xB0, 0x0D, 0x40, 0x0E, 0x90, 0x40, 0x05, 0x80, 0x40, 0x05, 0xB0, 0x50, 0x08, 0x41,
+0x04, 0x40, 0x0F, 0x01, 0x51, 0x02, 0x50, 0x71, 0xA0, 0x02, 0x30, 0xB0, 0x80, 0xA0, 0xB0, 0x01,
+0x10, 0x50, 0x00, 0x50, 0x00, 0x30, 0x80, 0x01, 0xD0, 0x0F, 0x57, 0x0F, 0x56, 0xB0, 0xA1, 0x04,
+0x50, 0xD0, 0x01, 0xB0, 0x30, 0x90, 0x00, 0xE0, 0xD0, 0x50, 0x00, 0xB0, 0x30, 0x01, 0xE0, 0x10,
+0x30, 0x01, 0x50, 0x03, 0x40, 0x70, 0x40, 0x50, 0x08, 0x90, 0x0F, 0x01, 0xA0, 0x0E, 0x50, 0x01,
+0x40, 0x70, 0x50, 0x40, 0x90, 0x03, 0xE1, 0x01, 0x50, 0xB0, 0x00, 0x30, 0xB0, 0x0A, 0x90, 0xB0,
+0x0D, 0x90, 0x0C, 0x41, 0x90, 0x70, 0xA0, 0x90, 0x02, 0x80, 0xE0, 0x07, 0x90, 0x08, 0x70, 0x05,
+0x90, 0x0F, 0x02, 0x90, 0x00, 0x40, 0xD0, 0x10, 0xB0, 0x00, 0x50, 0x30, 0x01, 0x80, 0x70, 0x50,
+0x00, 0x30, 0x01, 0xE0, 0x30, 0x71, 0xD0, 0xB0, 0x70, 0x81, 0x30, 0x0F, 0x57, 0x0F, 0x58, 0x90,
+0xD0, 0xE0, 0x02, 0x70, 0x90, 0x00, 0x50, 0xD0, 0x90, 0x30, 0x40, 0x01, 0xE0, 0x30, 0x80, 0x50,
+0x01, 0xE0, 0x90, 0x40, 0x70, 0xA0, 0x50, 0x04, 0xB0, 0x90, 0x30, 0x90, 0x07, 0x40, 0x0F, 0x00,
+0x50, 0xA0, 0x0D, 0xD0, 0x80, 0x50, 0x90, 0x70, 0xA0, 0xB0, 0xA0, 0x04, 0xA0, 0xB0, 0x01, 0x50,
+0xB0, 0x00, 0xA0, 0x0B, 0x50, 0xB0, 0x0D, 0x90, 0xB0, 0x09, 0xB0, 0x30, 0xE1, 0x80, 0x50, 0x00,
+0xA0, 0xE0, 0x01, 0x70, 0x08, 0x40, 0x07, 0x80, 0x50, 0x06, 0x90, 0x0F, 0x01, 0xE0, 0x70, 0xA0,
+0xB0, 0x80, 0x50, 0x01, 0x80, 0xE0, 0xA0, 0x90, 0x01, 0x90, 0x10, 0x90, 0x00, 0xB0, 0x10, 0x50,
+0x00, 0x81, 0x00, 0xE1, 0x0F, 0x58, 0x0F, 0x5A, 0x50, 0x01, 0xE0, 0xA0, 0x01, 0x10, 0x50, 0x00,
+0x90, 0x30, 0x00, 0xE1, 0xB0, 0x31, 0xB0, 0x00, 0x30, 0x01, 0xB0, 0xA0, 0x70, 0xA0, 0x05, 0xB0,
+0xA0, 0x06, 0x51, 0x0F, 0x00, 0x90, 0x30, 0x0D, 0x90, 0x30, 0x11, 0xE0, 0xD0, 0x41, 0xE0, 0x03,
+0x40, 0x90, 0x01, 0x90, 0x01, 0x30, 0xB0, 0x0A, 0x50, 0xB0, 0x0D, 0x50, 0xB0, 0x09, 0x80, 0x40,
+0x01, 0xB0, 0x50, 0x01, 0xA0, 0x00, 0xE1, 0x08, 0x51, 0x06, 0xA0, 0x07, 0x40, 0x0E, 0x40, 0xD0,
+0xA0, 0x30, 0x01, 0xB0, 0x80, 0x00, 0x90, 0xA0, 0xE0, 0x03, 0xA0, 0xE0, 0x70, 0x01, 0xB0, 0x01,
+0x90, 0x30, 0x0F, 0x5B, 0x0F, 0x5D, 0xD0, 0xB0, 0x00, 0xE0, 0x30, 0x01, 0x30, 0x40, 0x50, 0x41,
+0x90, 0x00, 0xB0, 0x30, 0xD0, 0x90, 0x01, 0x30, 0xB0, 0x00, 0x90, 0x10, 0x70, 0x40, 0x03, 0x40,
+0xA0, 0x05, 0x40, 0x0F, 0x01, 0x90, 0xA0, 0x0E, 0x50, 0xB0, 0x70, 0x30, 0x80, 0x01, 0x70, 0x03,
+0x50, 0x80, 0x01, 0x90, 0xB0, 0x00, 0x30, 0x02, 0xE0, 0x30, 0x70, 0x05, 0x90, 0xB0, 0x0D, 0x50,
+0xB0, 0x08, 0x80, 0x30, 0x03, 0x90, 0x01, 0x40, 0xA0, 0xE0, 0x0A, 0x90, 0x04, 0x50, 0xA0, 0x50,
+0x07, 0x90, 0xB0, 0x0B, 0x80, 0x10, 0xA0, 0x01, 0x30, 0x02, 0x70, 0xA0, 0x40, 0x05, 0xB0, 0x00,
+0x30, 0xE0, 0x00, 0xB0, 0x70, 0xE0, 0xD0, 0x50, 0x0F, 0x5B, 0x0F, 0x60, 0x70, 0xB0, 0x00, 0xB0,
+0x10, 0x01, 0x80, 0x30, 0x04, 0x80, 0x30, 0x90, 0x30, 0x02, 0x30, 0x00, 0x30, 0x10, 0xE0, 0xB0,
+0x01, 0xB0, 0x30, 0x04, 0x90, 0x0F, 0x00, 0x51, 0x90, 0x40, 0x0C, 0xB0, 0x50, 0x01, 0x10, 0x90,
+0x01, 0xB0, 0xA0, 0x90, 0x02, 0xA0, 0x91, 0xE0, 0x10, 0x71, 0x81, 0x30, 0xD1, 0x70, 0xA0, 0x30,
+0x80, 0x40, 0x01, 0x50, 0xB0, 0x0D, 0xB0, 0x50, 0x07, 0x30, 0x40, 0x04, 0x40, 0x0F, 0x00, 0x40,
+0x04, 0xD0, 0xB0, 0x09, 0x90, 0x08, 0x90, 0xA0, 0xD0, 0xE0, 0x00, 0xA0, 0x02, 0xA0, 0xE0, 0xA0,
+0x90, 0x09, 0xB0, 0x10, 0x01, 0x50, 0xE0, 0x0F, 0x5D, 0x0F, 0x60, 0xA0, 0x90, 0xB0, 0x70, 0x40,
+0x09, 0xB0, 0x80, 0xA0, 0x50, 0x00, 0x30, 0xB0, 0x01, 0xA0, 0xE0, 0x70, 0xA0, 0x50, 0x00, 0xA0,
+0x03, 0x51, 0x0F, 0x00, 0x90, 0x00, 0xB0, 0x80, 0x0C, 0x50, 0xB0, 0x01, 0xE0, 0x30, 0x90, 0xB0,
+0x01, 0x30, 0x81, 0xA0, 0x70, 0x30, 0x81, 0xC5, 0xF3, 0xC0, 0x61, 0xA0, 0xB0, 0x50, 0xB0, 0x0D,
+0xB0, 0x50, 0x06, 0x30, 0x40, 0x05, 0x40, 0x0F, 0x00, 0x40, 0x04, 0x50, 0x70, 0x09, 0x90, 0x06,
+0x40, 0x70, 0xA0, 0x30, 0x50, 0x01, 0x80, 0xB0, 0x00, 0x40, 0x70, 0x90, 0x0C, 0xE0, 0x80, 0x0F,
+0x60, 0x0F, 0x60, 0xB0, 0xA0, 0x70, 0x40, 0x0D, 0xE0, 0xA1, 0x01, 0xB0, 0x30, 0x01, 0xE0, 0x10,
+0x71, 0x03, 0x40, 0x0F, 0x01, 0x40, 0x01, 0xA0, 0x0C, 0x90, 0xB0, 0x02, 0x90, 0x80, 0x10, 0xB0,
+0x00, 0x30, 0x80, 0xC0, 0xF3, 0x60, 0xF3, 0x21, 0xF0, 0x22, 0xF2, 0xC0, 0xA0, 0x40, 0x0E, 0xB0,
+0x90, 0x05, 0x30, 0x40, 0x06, 0x90, 0xB0, 0x0E, 0x51, 0x04, 0xA0, 0x09, 0x51, 0x02, 0xB0, 0x30,
+0xD1, 0x50, 0x01, 0xA0, 0x01, 0x90, 0x70, 0x30, 0x40, 0x0F, 0x00, 0xB0, 0x0F, 0x60, 0x0F, 0x74,
+0x40, 0xA0, 0xE0, 0x30, 0xB0, 0x01, 0x30, 0x01, 0x80, 0x10, 0xA0, 0x90, 0x00, 0x50, 0x0F, 0x01,
+0x40, 0x01, 0x80, 0xA0, 0x0B, 0x40, 0x02, 0xB0, 0x81, 0xD0, 0x10, 0xA0, 0x80, 0xF0, 0x24, 0x60,
+0x2C, 0xF1, 0x31, 0xE0, 0x0C, 0xB0, 0x90, 0x04, 0xA0, 0xE0, 0x07, 0xB0, 0x50, 0x0F, 0x00, 0x40,
+0x04, 0xA0, 0x0A, 0x90, 0x00, 0x80, 0x10, 0xD0, 0x40, 0x00, 0x40, 0x90, 0x01, 0x80, 0xE0, 0x31,
+0x50, 0x0F, 0x73, 0x0F, 0x76, 0x50, 0x31, 0x90, 0x50, 0x80, 0x01, 0x90, 0x40, 0xB0, 0xA0, 0x10,
+0x30, 0x90, 0x04, 0xE0, 0x80, 0x90, 0x50, 0x81, 0x30, 0x80, 0xE0, 0x80, 0x40, 0xB0, 0x00, 0x90,
+0x00, 0xE0, 0x90, 0x0A, 0x90, 0x00, 0x40, 0x30, 0xA0, 0xC0, 0xF2, 0x20, 0xF0, 0x23, 0xF0, 0xC0,
+0x60, 0x2D, 0xF0, 0xC0, 0xD0, 0x30, 0x90, 0x0C, 0x90, 0x04, 0x80, 0xB0, 0x08, 0x90, 0x0F, 0x00,
+0x40, 0x03, 0xB0, 0x70, 0x09, 0x40, 0x70, 0x10, 0xE0, 0x00, 0x30, 0x01, 0xB0, 0x30, 0x00, 0xE0,
+0xA0, 0xE0, 0x0F, 0x76, 0x0F, 0x78, 0xB0, 0xE0, 0x70, 0xE0, 0xB0, 0x00, 0x30, 0xB0, 0x00, 0x90,
+0x10, 0x80, 0xA0, 0x71, 0xD0, 0x31, 0xD1, 0x71, 0x10, 0xD1, 0x71, 0x10, 0xA0, 0x90, 0xA0, 0xD0,
+0xB0, 0x30, 0x50, 0x09, 0xB0, 0x80, 0xA0, 0x60, 0xC0, 0xF1, 0x29, 0xC1, 0x2D, 0xF0, 0xC0, 0x80,
+0x11, 0xE0, 0x0B, 0x90, 0x04, 0x30, 0xB0, 0x08, 0x90, 0x0F, 0x00, 0x90, 0xB0, 0x03, 0x50, 0x80,
+0x04, 0xB0, 0x90, 0x71, 0x80, 0x70, 0x10, 0x01, 0xE0, 0x90, 0x00, 0x50, 0x70, 0x30, 0x50, 0x0F,
+0x78, 0x0F, 0x7B, 0x90, 0x31, 0xA0, 0x01, 0x70, 0x10, 0x01, 0x80, 0xE0, 0x80, 0xA0, 0xE0, 0xF0,
+0x50, 0xF7, 0x61, 0x80, 0xD0, 0x11, 0x50, 0x06, 0x90, 0x30, 0xA0, 0x30, 0x60, 0xF1, 0x2B, 0xF0,
+0xC1, 0x2D, 0xF0, 0x60, 0xF0, 0xA0, 0x10, 0x40, 0x0B, 0x40, 0x04, 0x30, 0x09, 0x40, 0x0F, 0x00,
+0x51, 0x04, 0x30, 0x02, 0x90, 0xA0, 0xD0, 0x30, 0x70, 0x01, 0x40, 0x10, 0x50, 0x00, 0x50, 0x70,
+0x30, 0xE0, 0xB0, 0x00, 0x50, 0x30, 0x80, 0x0F, 0x76, 0x0F, 0x7A, 0xB0, 0x90, 0x00, 0xB0, 0xE0,
+0xA0, 0x80, 0x10, 0x80, 0x01, 0xA0, 0x02, 0xD0, 0x80, 0xA0, 0x30, 0xC0, 0xF3, 0x21, 0x60, 0xF3,
+0x60, 0xA1, 0x80, 0x01, 0x90, 0x70, 0xA0, 0x30, 0xC0, 0xF0, 0xC0, 0x28, 0xF0, 0x25, 0xC1, 0x2E,
+0xC0, 0xF0, 0x80, 0xA0, 0x0C, 0x40, 0x03, 0x50, 0x30, 0x09, 0x40, 0x0F, 0x01, 0x40, 0x04, 0x30,
+0x40, 0xA0, 0x10, 0x80, 0xA0, 0x01, 0x90, 0x40, 0x01, 0x10, 0xD0, 0x31, 0x40, 0x00, 0x51, 0x00,
+0x80, 0xB0, 0x80, 0xB0, 0x0F, 0x75, 0x0F, 0x79, 0x90, 0xD0, 0x80, 0xD0, 0xB0, 0x02, 0x80, 0x30,
+0xE0, 0x50, 0x80, 0x01, 0xE0, 0x50, 0x01, 0xA0, 0x80, 0xA0, 0x30, 0x60, 0xF1, 0xC1, 0xF0, 0x22,
+0xF2, 0x60, 0x71, 0x30, 0xF4, 0x60, 0x2F, 0x00, 0xC1, 0x2E, 0xC0, 0x20, 0xF0, 0x70, 0x0C, 0x40,
+0x00, 0x90, 0x80, 0x00, 0xA0, 0x0A, 0x90, 0xB0, 0x0F, 0x00, 0x90, 0x01, 0x90, 0xE0, 0xD0, 0x71,
+0x50, 0x01, 0x30, 0x02, 0xA0, 0x50, 0x80, 0xA0, 0x90, 0x02, 0xA0, 0x30, 0x70, 0x30, 0x00, 0x30,
+0x40, 0x0F, 0x76, 0x0F, 0x79, 0xB1, 0x00, 0x90, 0x30, 0x00, 0xE0, 0x30, 0xB0, 0x00, 0x90, 0xA0,
+0x30, 0x90, 0xB0, 0xA0, 0x01, 0xB0, 0x30, 0x01, 0x40, 0xA2, 0x30, 0x60, 0xF2, 0x23, 0xF0, 0xC0,
+0x20, 0xF0, 0x23, 0xF0, 0x60, 0x2F, 0x00, 0x60, 0xC0, 0x2E, 0xC0, 0x20, 0xF0, 0x30, 0x50, 0x04,
+0xB0, 0x90, 0x51, 0x02, 0x90, 0x01, 0x11, 0x80, 0x0A, 0xB0, 0x50, 0x0E, 0x50, 0xE0, 0xA0, 0x70,
+0xA0, 0x70, 0xB0, 0x00, 0xB0, 0x80, 0x01, 0x40, 0x90, 0x50, 0xE0, 0x70, 0xE0, 0xB0, 0x00, 0x80,
+0x30, 0x50, 0x00, 0xD0, 0x01, 0xD0, 0xB0, 0x0F, 0x78, 0x0F, 0x7C, 0x70, 0x90, 0x80, 0x30, 0x50,
+0xD0, 0x02, 0xB0, 0x40, 0x30, 0xD0, 0x40, 0xB0, 0x90, 0x40, 0x01, 0x80, 0xB0, 0x00, 0xB0, 0xA0,
+0xE0, 0xA1, 0x80, 0xC1, 0xF2, 0x27, 0x60, 0xF0, 0x2E, 0x60, 0xC0, 0x2E, 0xC1, 0xF0, 0xC0, 0xA0,
+0x04, 0x90, 0x12, 0x80, 0x70, 0x40, 0x90, 0xE1, 0x70, 0xA0, 0x10, 0xD0, 0x50, 0x09, 0x90, 0x0B,
+0x40, 0xA0, 0x71, 0x31, 0x01, 0xE0, 0x50, 0x01, 0x30, 0x00, 0x50, 0x30, 0x70, 0x80, 0x90, 0x02,
+0xA0, 0x40, 0x90, 0xE0, 0x00, 0xD0, 0x01, 0xE0, 0x30, 0x0F, 0x78, 0x0F, 0x79, 0x50, 0x30, 0x10,
+0xE0, 0xB0, 0xD0, 0x01, 0xA0, 0x50, 0x00, 0x70, 0xD0, 0x90, 0x01, 0x90, 0x80, 0xD0, 0x30, 0xB0,
+0x00, 0x30, 0x01, 0x50, 0xE0, 0x01, 0xE1, 0x80, 0x30, 0x70, 0x30, 0x60, 0xF6, 0x20, 0x60, 0xF0,
+0x2E, 0x60, 0xF0, 0x2E, 0x60, 0xC0, 0xF1, 0x60, 0x70, 0x50, 0x90, 0xE0, 0x00, 0x13, 0xD0, 0x10,
+0x30, 0x80, 0xE0, 0x60, 0xC1, 0x60, 0x80, 0x90, 0x09, 0x40, 0x06, 0x50, 0x80, 0x30, 0xD1, 0xE0,
+0xA0, 0x02, 0x30, 0x01, 0x50, 0x40, 0x00, 0x90, 0xD0, 0xA0, 0x80, 0xB0, 0x01, 0xB0, 0x30, 0x00,
+0xB0, 0xD0, 0x00, 0xE0, 0x40, 0x00, 0x70, 0x90, 0x00, 0xB0, 0xD0, 0x0F, 0x78, 0x0F, 0x78, 0x71,
+0x50, 0x01, 0x80, 0xE0, 0x01, 0xD0, 0xB0, 0x70, 0x90, 0x00, 0x70, 0xB1, 0xE0, 0xB0, 0x00, 0xB0,
+0x30, 0x71, 0x40, 0x00, 0xE0, 0x50, 0x01, 0x30, 0x01, 0xB0, 0x80, 0xB0, 0xE0, 0xD0, 0xA1, 0x30,
+0x60, 0xC0, 0xF0, 0xC1, 0xF0, 0x2D, 0xF0, 0x60, 0xF0, 0x2D, 0xF0, 0xC1, 0x20, 0xF2, 0xA0, 0xD0,
+0x70, 0xA0, 0x30, 0x80, 0xC0, 0xF4, 0xC0, 0xF1, 0x20, 0xF1, 0xA0, 0x02, 0x50, 0xB0, 0x04, 0x90,
+0x01, 0x90, 0xE0, 0xA0, 0xD0, 0x10, 0xA0, 0xE0, 0x50, 0x30, 0x01, 0x90, 0xE0, 0x01, 0x30, 0x00,
+0x50, 0xE0, 0xD0, 0xA0, 0x40, 0x05, 0xA0, 0x10, 0x01, 0x70, 0xA0, 0xE0, 0x30, 0xA0, 0x50, 0x70,
+0x01, 0xD0, 0x0F, 0x78, 0x0F, 0x78, 0x30, 0x70, 0x30, 0x90, 0x00, 0x70, 0x50, 0x00, 0x50, 0x70,
+0x90, 0xA0, 0x01, 0xA0, 0x50, 0x30, 0xB0, 0x30, 0x03, 0xB0, 0x40, 0x30, 0x70, 0x80, 0x90, 0xB0,
+0x30, 0x01, 0xE0, 0x50, 0x01, 0x30, 0x00, 0xB0, 0x50, 0x70, 0x30, 0xA0, 0x70, 0x80, 0x61, 0xC0,
+0xF3, 0x21, 0xF2, 0x22, 0xF0, 0x60, 0xF0, 0x2E, 0x60, 0x24, 0xF6, 0x23, 0xC0, 0x60, 0x23, 0xF0,
+0x80, 0xA0, 0x30, 0x70, 0x10, 0xB0, 0x00, 0xB0, 0x50, 0x90, 0xE0, 0xA0, 0xD0, 0xA1, 0x70, 0xB0,
+0x00, 0xE0, 0x50, 0x01, 0xA0, 0x02, 0x30, 0xB0, 0x40, 0x30, 0xA0, 0x80, 0x50, 0x07, 0x50, 0x81,
+0x40, 0x00, 0x30, 0xA0, 0x01, 0xD0, 0x00, 0x30, 0xA1, 0xE0, 0x0F, 0x78, 0x0F, 0x7A, 0x40, 0x30,
+0x00, 0xA0, 0x50, 0x00, 0x70, 0x50, 0x30, 0x40, 0x00, 0xB0, 0x70, 0x00, 0x40, 0x30, 0xE0, 0x07,
+0x50, 0xE0, 0xA0, 0x70, 0xE0, 0xB0, 0x30, 0xB0, 0x01, 0x30, 0x01, 0x90, 0x40, 0x00, 0xB0, 0x10,
+0x80, 0x90, 0x80, 0x70, 0xA0, 0x70, 0x30, 0x80, 0x60, 0xC2, 0xF4, 0x60, 0xF0, 0x2D, 0xF0, 0xC0,
+0x2F, 0x00, 0xF0, 0x60, 0xF3, 0xC0, 0x90, 0x40, 0x30, 0xA0, 0x10, 0x70, 0xA0, 0xD0, 0x10, 0x80,
+0x90, 0x10, 0x70, 0x01, 0x30, 0x01, 0xB0, 0x80, 0x01, 0x30, 0xB0, 0x90, 0x30, 0xD0, 0xE0, 0x40,
+0xB0, 0x0C, 0x50, 0xA0, 0x00, 0xB0, 0x10, 0x01, 0xD0, 0x01, 0x90, 0x50, 0x0F, 0x79, 0x0F, 0x7D,
+0x50, 0x70, 0xD0, 0x30, 0x00, 0x70, 0xB0, 0x00, 0xE0, 0x30, 0x0F, 0x00, 0x50, 0x80, 0xA1, 0x30,
+0xE0, 0x30, 0x01, 0x80, 0xB0, 0x00, 0x90, 0x10, 0x50, 0x00, 0x50, 0x40, 0x01, 0xA0, 0x90, 0xE0,
+0xA0, 0x70, 0x30, 0xA1, 0x70, 0xA0, 0x81, 0x60, 0xC0, 0xFD, 0xC0, 0xFE, 0xC0, 0x60, 0x31, 0xA0,
+0x70, 0x11, 0x71, 0xE0, 0x40, 0x30, 0x40, 0x01, 0x30, 0x01, 0xA0, 0x10, 0x01, 0x80, 0xB0, 0x01,
+0xD0, 0xE0, 0xA1, 0x30, 0x40, 0xB0, 0x0F, 0x02, 0x70, 0xB0, 0x00, 0x40, 0xD1, 0x40, 0x0F, 0x7D,
+0x0F, 0x82, 0x30, 0xE0, 0xB0, 0x10, 0xB0, 0x0F, 0x05, 0x90, 0x80, 0xA0, 0x30, 0x10, 0x40, 0xB0,
+0x30, 0x10, 0x01, 0x40, 0x90, 0x01, 0xA0, 0x01, 0x91, 0x01, 0x80, 0x01, 0x40, 0xA0, 0xE0, 0x80,
+0xD0, 0xA2, 0xD0, 0x30, 0xA2, 0x32, 0xA0, 0x30, 0xA3, 0x31, 0xA3, 0x30, 0xD0, 0x31, 0xD0, 0xA0,
+0x80, 0xE0, 0xA0, 0xB0, 0x00, 0x91, 0x01, 0x30, 0x01, 0x50, 0xE0, 0x01, 0x80, 0xB0, 0x00, 0xE0,
+0x10, 0x51, 0xA1, 0x30, 0xA0, 0xE0, 0x50, 0x0F, 0x07, 0xE0, 0x30, 0x0F, 0x82, 0x0F, 0x83, 0x80,
+0xA0, 0x50, 0x0F, 0x0A, 0xB0, 0x90, 0xE0, 0xA0, 0x70, 0x80, 0x40, 0xA0, 0x90, 0xB1, 0x80, 0x01,
+0x40, 0x50, 0x01, 0x30, 0x01, 0x90, 0x40, 0x01, 0x30, 0x02, 0x30, 0x01, 0x30, 0xB1, 0x50, 0x30,
+0x00, 0x50, 0x10, 0x30, 0x00, 0x50, 0x30, 0x01, 0x80, 0x50, 0x01, 0xA0, 0x01, 0x40, 0x50, 0x01,
+0x30, 0x01, 0x50, 0xE0, 0x01, 0x30, 0x01, 0xB0, 0xE0, 0x00, 0xB0, 0x30, 0x80, 0xE0, 0x30, 0x70,
+0x30, 0x40, 0x50, 0xB0, 0x40, 0x50, 0x01, 0x80, 0x30, 0x50, 0x0F, 0x04, 0xB0, 0x50, 0x0F, 0x82,
+0x0F, 0x9E, 0xE1, 0x01, 0x50, 0xE0, 0x50, 0xB0, 0x90, 0x40, 0xE0, 0x80, 0xA0, 0x70, 0x80, 0x90,
+0x30, 0x90, 0x01, 0xA0, 0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0xB0, 0x80, 0x01, 0xA0, 0x01, 0xB0,
+0xE0, 0x00, 0xB0, 0x10, 0x30, 0x01, 0x30, 0x01, 0xE0, 0x50, 0x01, 0x30, 0x01, 0x40, 0x90, 0x01,
+0x30, 0x01, 0xB0, 0x30, 0x01, 0xA0, 0x41, 0x30, 0xD0, 0x30, 0xE0, 0x40, 0x90, 0x50, 0xB0, 0x00,
+0xB0, 0x90, 0x00, 0xA0, 0x80, 0x70, 0xE0, 0xB0, 0x80, 0x50, 0x40, 0x0F, 0x98, 0x0F, 0x9C, 0xB0,
+0xD0, 0x10, 0xE0, 0x00, 0x40, 0xD0, 0x40, 0x70, 0x50, 0x01, 0x40, 0x02, 0xB0, 0x50, 0x40, 0x80,
+0x31, 0x70, 0x30, 0xA0, 0xD0, 0x30, 0x40, 0x90, 0xA0, 0x50, 0x00, 0x90, 0xE0, 0x01, 0xA0, 0x01,
+0xB0, 0xE0, 0x01, 0x10, 0x30, 0x01, 0x80, 0x01, 0x40, 0x50, 0x01, 0x30, 0x00, 0xB0, 0xE0, 0x30,
+0x90, 0xE0, 0xD0, 0xA0, 0x31, 0xA0, 0x81, 0xE0, 0x40, 0x90, 0x02, 0xB0, 0x40, 0x00, 0x90, 0xD0,
+0x72, 0xB0, 0x70, 0x01, 0x10, 0x00, 0x90, 0xE0, 0x0F, 0x99, 0x0F, 0x9E, 0xA0, 0x50, 0x00, 0x70,
+0xB0, 0x00, 0x90, 0x30, 0xB0, 0xD0, 0xE0, 0xD0, 0xB0, 0x50, 0x31, 0x07, 0xB0, 0x90, 0x40, 0xE1,
+0x31, 0xA3, 0x32, 0xA0, 0x31, 0xD0, 0x70, 0x31, 0x70, 0x31, 0xA3, 0x31, 0x80, 0xE0, 0x41, 0x50,
+0x0C, 0x70, 0xD0, 0x03, 0x30, 0x50, 0xB0, 0x70, 0x01, 0x70, 0x90, 0x0F, 0x9B, 0x0F, 0x9E, 0x70,
+0xB0, 0x00, 0xA0, 0x40, 0x00, 0x81, 0x30, 0x40, 0x00, 0x80, 0x40, 0x90, 0xE0, 0x80, 0xB0, 0x0F,
+0x04, 0xB0, 0x02, 0xB0, 0x03, 0xB1, 0x02, 0xB0, 0x0F, 0x03, 0xE1, 0x70, 0xB0, 0x01, 0xB0, 0xD0,
+0x00, 0xB0, 0x70, 0x01, 0x30, 0x40, 0x0F, 0x9B, 0x0F, 0x9D, 0xB0, 0x70, 0x01, 0xB0, 0x70, 0xA0,
+0xD0, 0x40, 0x70, 0xB0, 0x00, 0xE1, 0x00, 0x91, 0x0F, 0x04, 0x80, 0xE0, 0x01, 0x30, 0x71, 0xB0,
+0x00, 0xE0, 0x70, 0xD0, 0xB0, 0x00, 0x80, 0xE0, 0x90, 0x0F, 0x04, 0x70, 0x50, 0x01, 0x40, 0x30,
+0x01, 0x70, 0x90, 0x00, 0x30, 0x40, 0x0F, 0x9B, 0x0F, 0x9D, 0x90, 0xA0, 0x01, 0xA0, 0x01, 0x70,
+0xB0, 0x70, 0x01, 0x30, 0x90, 0x0F, 0x06, 0xA0, 0x10, 0xE0, 0x00, 0x90, 0x70, 0x00, 0x40, 0x30,
+0xB0, 0x70, 0x00, 0x50, 0x70, 0x00, 0x30, 0x40, 0xE0, 0x0F, 0x04, 0x30, 0x40, 0x01, 0xE1, 0x01,
+0x90, 0xD0, 0xE0, 0xD0, 0x0F, 0x9C, 0x0F, 0x9D, 0x50, 0x90, 0x01, 0x30, 0x71, 0xE0, 0x00, 0x70,
+0x01, 0x10, 0xB0, 0x0F, 0x06, 0x50, 0xE1, 0x01, 0x70, 0xE0, 0xA0, 0x90, 0x40, 0x30, 0x01, 0xD0,
+0x00, 0xB0, 0x90, 0x0F, 0x05, 0xE0, 0x80, 0x01, 0x30, 0xE0, 0x02, 0xB0, 0x40, 0x0F, 0x9D, 0x0F,
+0xA2, 0xB1, 0x01, 0x31, 0xA0, 0x80, 0x0F, 0x08, 0xE1, 0x00, 0xB0, 0xD0, 0x80, 0x70, 0x41, 0x30,
+0x01, 0xD0, 0xB0, 0x0F, 0x07, 0x50, 0x80, 0x01, 0x90, 0x50, 0x0F, 0xA2, 0x0F, 0xA7, 0x91, 0x0F,
+0x09, 0xE1, 0x00, 0x80, 0xE0, 0x01, 0xD0, 0x90, 0x30, 0x01, 0x70, 0x0F, 0xC0, 0x0F, 0xC2, 0x81,
+0x00, 0x40, 0xA0, 0x00, 0x90, 0x70, 0x00, 0xD0, 0xB0, 0x40, 0xA0, 0x0F, 0xC0, 0x0F, 0xC2, 0x91,
+0x01, 0xE0, 0xD0, 0xA0, 0x01, 0x90, 0xD0, 0xA0, 0x0F, 0xC1, 0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xFF,
+0x0F, 0x90, 0x0F, 0xFF, 0x0F, 0x90};
+
+const Map_Image JM29_4000_image = {431, 432, JM29_4000_palette, JM29_4000_rows, JM29_4000_data};
@@ -0,0 +1,3398 @@
+// Generated by maps/compress_map.py from JM29_8000.h, do not edit
+// Image Size : 431x429 pixels, 53531 bytes compressed from 369798
+
+#pragma once
+
+#include "MapImage.h"
+
+const uint16_t JM29_8000_palette[16] PROGMEM = {
+0xFFFF, 0x0021, 0x867C, 0x634C, 0xA514, 0xCE99, 0x6D16, 0x29E8,
+0x8430, 0xB5D7, 0x428A, 0xE73C, 0x85D9, 0x1924, 0x967C, 0x53F1};
+
+const uint32_t JM29_8000_rows[429] PROGMEM = {
+0, 4, 15, 30, 45, 70, 109, 147, 182, 226, 297, 374,
+443, 517, 605, 690, 774, 867, 965, 1060, 1150, 1234, 1313, 1389,
+1458, 1520, 1589, 1674, 1752, 1831, 1907, 1986, 2067, 2157, 2242, 2331,
+2417, 2494, 2570, 2650, 2747, 2840, 2933, 3031, 3127, 3223, 3323, 3425,
+3531, 3640, 3754, 3879, 4006, 4119, 4237, 4359, 4482, 4600, 4710, 4810,
+4914, 5034, 5152, 5284, 5415, 5547, 5684, 5824, 5969, 6109, 6249, 6395,
+6533, 6669, 6826, 6998, 7169, 7331, 7493, 7661, 7818, 7980, 8128, 8286,
+8453, 8611, 8756, 8910, 9043, 9189, 9321, 9455, 9609, 9762, 9914, 10072,
+10225, 10382, 10543, 10710, 10887, 11053, 11216, 11384, 11557, 11739, 11929, 12117,
+12288, 12458, 12618, 12775, 12947, 13112, 13273, 13439, 13601, 13757, 13909, 14070,
+14223, 14377, 14534, 14696, 14867, 15042, 15208, 15355, 15511, 15675, 15832, 16004,
+16166, 16332, 16496, 16672, 16856, 17034, 17207, 17402, 17602, 17794, 17970, 18144,
+18318, 18482, 18648, 18813, 18964, 19128, 19288, 19446, 19604, 19747, 19902, 20054,
+20197, 20336, 20481, 20634, 20792, 20953, 21116, 21260, 21403, 21557, 21707, 21863,
+22024, 22177, 22341, 22510, 22675, 22829, 22981, 23127, 23279, 23426, 23575, 23721,
+23875, 24019, 24180, 24344, 24492, 24650, 24815, 24973, 25123, 25264, 25402, 25546,
+25689, 25837, 25977, 26113, 26260, 26396, 26531, 26663, 26793, 26931, 27072, 27221,
+27388, 27546, 27691, 27821, 27961, 28093, 28229, 28373, 28514, 28681, 28822, 28980,
+29171, 29316, 29461, 29603, 29747, 29904, 30046, 30177, 30306, 30438, 30567, 30688,
+30814, 30954, 31082, 31203, 31323, 31439, 31554, 31672, 31788, 31908, 32021, 32132,
+32242, 32353, 32474, 32594, 32713, 32842, 32968, 33096, 33237, 33368, 33490, 33622,
+33761, 33896, 34018, 34159, 34318, 34458, 34597, 34742, 34896, 35043, 35194, 35331,
+35478, 35619, 35761, 35898, 36045, 36197, 36340, 36473, 36605, 36749, 36889, 37022,
+37149, 37281, 37415, 37552, 37698, 37844, 37993, 38130, 38257, 38386, 38530, 38700,
+38849, 38987, 39129, 39270, 39409, 39578, 39735, 39879, 40020, 40179, 40326, 40470,
+40615, 40748, 40873, 41014, 41158, 41302, 41458, 41611, 41751, 41891, 42040, 42180,
+42317, 42461, 42594, 42737, 42886, 43032, 43174, 43314, 43449, 43581, 43716, 43851,
+43994, 44131, 44259, 44380, 44502, 44613, 44725, 44837, 44944, 45059, 45168, 45283,
+45390, 45509, 45620, 45739, 45865, 45994, 46131, 46273, 46397, 46522, 46648, 46777,
+46906, 47035, 47158, 47279, 47410, 47546, 47674, 47797, 47913, 48014, 48124, 48221,
+48313, 48412, 48513, 48614, 48702, 48788, 48884, 48974, 49058, 49147, 49248, 49352,
+49458, 49572, 49662, 49762, 49859, 49964, 50058, 50150, 50232, 50317, 50394, 50471,
+50543, 50624, 50697, 50776, 50844, 50916, 50989, 51068, 51147, 51225, 51312, 51401,
+51496, 51578, 51656, 51734, 51811, 51878, 51941, 51997, 52059, 52120, 52182, 52255,
+52324, 52393, 52475, 52567, 52659, 52746, 52839, 52927, 53013, 53085, 53156, 53235,
+53282, 53323, 53368, 53415, 53457, 53484, 53499, 53514, 53527};
+
+const uint8_t JM29_8000_data[53531] PROGMEM = {
+0x0F, 0xFF, 0x0F, 0x90, 0x0F, 0xC6, 0x80, 0x30, 0xB0, 0x00, 0x50, 0x30, 0x90, 0x0F, 0xC2, 0x0F,
+0xAB, 0x50, 0x0F, 0x09, 0xA0, 0x80, 0x40, 0x70, 0x00, 0x30, 0x50, 0x30, 0x0F, 0xC2, 0x0F, 0xAA,
+0x40, 0x80, 0x30, 0x0F, 0x08, 0xD0, 0x01, 0x70, 0x51, 0x30, 0x90, 0x0F, 0xC2, 0x0F, 0xA1, 0x90,
+0x80, 0xA0, 0xB0, 0x00, 0x71, 0x10, 0x00, 0x40, 0x80, 0x30, 0x0F, 0x08, 0xD0, 0x01, 0xA0, 0x90,
+0x0F, 0x0F, 0x40, 0x90, 0x0F, 0xA4, 0x0F, 0x9C, 0x50, 0x40, 0xB0, 0x00, 0x50, 0x10, 0x40, 0xB0,
+0x00, 0x40, 0x30, 0x00, 0x90, 0xA0, 0x00, 0xB0, 0x0F, 0x09, 0xD0, 0x01, 0xA0, 0x50, 0x0F, 0x0D,
+0xB0, 0xA0, 0x10, 0x50, 0x01, 0x80, 0xA0, 0x90, 0x01, 0x40, 0xB0, 0x0F, 0x9B, 0x0F, 0x9B, 0x50,
+0xD0, 0x40, 0xD0, 0xB0, 0x50, 0xA0, 0xB0, 0x50, 0x00, 0x81, 0x01, 0x10, 0x0F, 0x0B, 0xD0, 0x01,
+0xD0, 0xB0, 0x0F, 0x0D, 0xB0, 0x50, 0xD0, 0x01, 0x80, 0x30, 0x50, 0x70, 0xB0, 0x80, 0x90, 0x30,
+0xB0, 0x0F, 0x9A, 0x0F, 0x9B, 0x80, 0x90, 0x00, 0x30, 0x90, 0x50, 0x10, 0x30, 0xA1, 0x90, 0x30,
+0x01, 0xD0, 0xB0, 0x0F, 0x0A, 0x40, 0xD0, 0x70, 0x30, 0x0F, 0x10, 0xD0, 0x01, 0xD0, 0xB0, 0x00,
+0x30, 0x90, 0x40, 0x31, 0x0F, 0x9B, 0x0F, 0x9D, 0xA0, 0x10, 0x90, 0x00, 0xB0, 0x01, 0xD0, 0x50,
+0x70, 0x01, 0x70, 0xB0, 0x0A, 0xB0, 0x50, 0x90, 0x41, 0x81, 0x35, 0xA0, 0x31, 0xA0, 0x70, 0x31,
+0xA0, 0x35, 0x81, 0x41, 0x91, 0x50, 0xB0, 0x0E, 0x50, 0x70, 0x00, 0x50, 0x70, 0x01, 0xA0, 0x50,
+0x0F, 0x9E, 0x0F, 0x9E, 0xB0, 0xD0, 0xB0, 0x80, 0x01, 0xD0, 0x00, 0x30, 0x80, 0x50, 0x70, 0x01,
+0xB0, 0x50, 0x90, 0x40, 0x80, 0x32, 0xA0, 0xD0, 0x80, 0x40, 0x30, 0x80, 0x51, 0xA0, 0x01, 0x90,
+0x80, 0x01, 0x30, 0xB0, 0x00, 0x30, 0x10, 0xB0, 0x00, 0x80, 0x50, 0x01, 0xA0, 0x01, 0x80, 0x40,
+0x50, 0x90, 0x70, 0x40, 0x80, 0x30, 0xD0, 0xA0, 0x31, 0x80, 0x41, 0x90, 0x50, 0xB0, 0x04, 0x40,
+0x30, 0x00, 0x90, 0xA0, 0x01, 0x70, 0x50, 0x0F, 0x9E, 0x0F, 0x87, 0x90, 0xB0, 0x0F, 0x03, 0x40,
+0x01, 0x70, 0xB0, 0xA0, 0x30, 0xA0, 0x30, 0x00, 0x50, 0xA0, 0xD0, 0x30, 0xA0, 0x30, 0x81, 0xA0,
+0x51, 0xA0, 0xB0, 0x01, 0x30, 0x01, 0x91, 0x01, 0x30, 0x01, 0x50, 0x80, 0x01, 0x30, 0xB0, 0x00,
+0x30, 0x10, 0x01, 0x80, 0xB0, 0x01, 0xA0, 0x01, 0x80, 0xB0, 0x01, 0x30, 0x01, 0x50, 0x40, 0x01,
+0x70, 0xB0, 0x50, 0x80, 0xA0, 0x80, 0x30, 0x70, 0x30, 0x80, 0x90, 0xB0, 0x30, 0x40, 0x00, 0xB0,
+0x70, 0x00, 0x50, 0xA0, 0x0F, 0x9F, 0x0F, 0x86, 0x80, 0x40, 0xA0, 0x0F, 0x03, 0x70, 0x32, 0x00,
+0x50, 0x71, 0x30, 0x80, 0x31, 0x50, 0x00, 0x80, 0xB0, 0x01, 0x30, 0x01, 0x80, 0x50, 0x01, 0x30,
+0x01, 0x50, 0x40, 0x01, 0xA0, 0x01, 0xB0, 0x80, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0x80, 0xB0,
+0x01, 0x30, 0x01, 0x30, 0x02, 0x30, 0x01, 0x40, 0x90, 0x01, 0x30, 0x01, 0x50, 0x40, 0x01, 0x80,
+0x51, 0x80, 0xD0, 0x80, 0x30, 0xA0, 0x30, 0xD2, 0xB0, 0x0F, 0x9F, 0x0F, 0x82, 0x50, 0x71, 0x00,
+0x40, 0x31, 0x0F, 0x02, 0xB0, 0x50, 0x70, 0xA1, 0x70, 0x90, 0x50, 0x10, 0x80, 0x00, 0xB0, 0x80,
+0x01, 0x40, 0x50, 0x01, 0x30, 0x01, 0x91, 0x00, 0x50, 0x70, 0x81, 0x30, 0xD0, 0x30, 0x70, 0xD0,
+0xF0, 0xA1, 0x70, 0xA1, 0x77, 0x11, 0x70, 0xD2, 0x10, 0x70, 0xA0, 0x30, 0xD0, 0x81, 0xA0, 0x40,
+0xB0, 0x00, 0x30, 0x01, 0x91, 0x01, 0xA0, 0x01, 0x50, 0x40, 0x01, 0x10, 0x30, 0xB0, 0x40, 0x10,
+0x31, 0x40, 0x50, 0x0F, 0x9C, 0x0F, 0x7F, 0x50, 0x01, 0x70, 0xB0, 0x90, 0xD0, 0x00, 0xB0, 0x0D,
+0xB0, 0x50, 0x80, 0x30, 0xA0, 0x80, 0xD0, 0x01, 0xB0, 0x80, 0x01, 0x10, 0xA0, 0x01, 0x30, 0x01,
+0x40, 0x80, 0x90, 0x40, 0xD0, 0x71, 0xD0, 0x70, 0xA2, 0x80, 0x40, 0x50, 0x00, 0x50, 0x70, 0xE1,
+0xC0, 0xE6, 0xC1, 0xE3, 0xF0, 0xA0, 0x41, 0x90, 0x50, 0xB0, 0x00, 0xB1, 0x90, 0x80, 0xA3, 0xD1,
+0x70, 0xD0, 0x30, 0x90, 0x50, 0xA0, 0x01, 0x40, 0x50, 0x00, 0x50, 0x10, 0x90, 0x01, 0x30, 0x01,
+0x30, 0x80, 0x31, 0x80, 0x40, 0xB0, 0x0F, 0x03, 0x90, 0xA0, 0x30, 0x0F, 0x81, 0x0F, 0x7E, 0x50,
+0x10, 0x00, 0xB0, 0x70, 0x01, 0x70, 0x90, 0x0B, 0x50, 0x40, 0xA0, 0x30, 0x41, 0x30, 0x01, 0x30,
+0x02, 0x30, 0x01, 0xD0, 0x10, 0x00, 0x40, 0xD0, 0xA0, 0x72, 0x30, 0x40, 0x51, 0xB0, 0x03, 0x90,
+0x01, 0xB0, 0xA0, 0xF1, 0xE1, 0x28, 0x60, 0x21, 0xE2, 0xC0, 0x60, 0xF1, 0x30, 0xA1, 0x03, 0x90,
+0x03, 0xB0, 0x51, 0x90, 0x80, 0xA0, 0xD0, 0xA1, 0xD0, 0x30, 0x50, 0x80, 0x10, 0xB0, 0x00, 0x91,
+0x01, 0xA0, 0x01, 0xB0, 0xA0, 0x90, 0x80, 0xA0, 0x80, 0x50, 0xB0, 0x0E, 0x70, 0x90, 0x40, 0xA0,
+0x0F, 0x80, 0x0F, 0x79, 0xB0, 0x90, 0x02, 0x40, 0x10, 0x40, 0x00, 0xD0, 0xB0, 0x00, 0x40, 0xA0,
+0x07, 0xB0, 0x40, 0xA1, 0x80, 0x50, 0x30, 0x02, 0xA0, 0x01, 0x90, 0x40, 0x01, 0x70, 0x30, 0x70,
+0x10, 0xD0, 0x30, 0x80, 0x40, 0x50, 0x0B, 0x90, 0x01, 0x70, 0xE2, 0x2A, 0x60, 0x26, 0xE3, 0xA0,
+0x70, 0x02, 0x40, 0x80, 0xD0, 0x80, 0x08, 0xB0, 0x90, 0x40, 0x80, 0x70, 0x10, 0x70, 0x30, 0xD0,
+0xB0, 0x01, 0x30, 0x01, 0x50, 0x80, 0x01, 0x30, 0x90, 0x40, 0x30, 0xA0, 0x30, 0x50, 0x0E, 0x10,
+0x00, 0x80, 0xD0, 0xA0, 0x0F, 0x7C, 0x0F, 0x78, 0x90, 0xD0, 0x30, 0xD0, 0x01, 0x30, 0x90, 0x70,
+0x00, 0x30, 0x80, 0x00, 0xB0, 0x70, 0x04, 0x90, 0x30, 0xD0, 0x30, 0x90, 0x00, 0x30, 0x01, 0x80,
+0x50, 0x01, 0x30, 0xB0, 0x40, 0x80, 0x11, 0x70, 0x30, 0x40, 0x01, 0x50, 0x0F, 0x00, 0x50, 0x00,
+0x90, 0xA0, 0xE0, 0x2B, 0xC1, 0x2A, 0xE0, 0xF0, 0x70, 0x90, 0x00, 0x90, 0x70, 0xB0, 0x70, 0xB0,
+0x0C, 0xB0, 0x00, 0x50, 0x80, 0xA0, 0xD0, 0x10, 0xD0, 0x40, 0xB0, 0x80, 0xB0, 0x01, 0x30, 0x01,
+0x50, 0x80, 0x00, 0x80, 0xD0, 0xA0, 0x80, 0x09, 0x50, 0xD0, 0x80, 0x40, 0xA0, 0x00, 0x81, 0x00,
+0x41, 0x0F, 0x78, 0x0F, 0x78, 0xA0, 0x50, 0x00, 0x70, 0xB0, 0x00, 0x30, 0x00, 0xD0, 0x80, 0x50,
+0xD0, 0xB0, 0x90, 0xA0, 0x00, 0xB0, 0x40, 0x30, 0x70, 0x40, 0x00, 0x80, 0x50, 0x01, 0x30, 0x01,
+0xB0, 0x30, 0x90, 0x30, 0xD0, 0xA0, 0x30, 0x40, 0x06, 0x40, 0x0F, 0x00, 0x50, 0xB0, 0x70, 0xF0,
+0xE0, 0x2B, 0xC1, 0x24, 0xE3, 0x22, 0xE0, 0xD0, 0x10, 0xA0, 0x40, 0xD0, 0x90, 0xF0, 0x70, 0x0B,
+0x90, 0xB0, 0x05, 0xB0, 0x30, 0xA0, 0xD1, 0x41, 0x80, 0x01, 0x40, 0x50, 0x01, 0x30, 0xB0, 0x50,
+0x30, 0xA0, 0x40, 0x50, 0x03, 0x40, 0x70, 0xA0, 0x90, 0x00, 0xD0, 0xB0, 0x00, 0x40, 0x30, 0x50,
+0x80, 0x40, 0x50, 0x0F, 0x77, 0x0F, 0x78, 0xB0, 0x00, 0x30, 0x10, 0x30, 0x50, 0xD0, 0xA0, 0xD0,
+0xA0, 0x00, 0x50, 0x70, 0xD0, 0x80, 0xA0, 0x30, 0x90, 0x50, 0x30, 0x01, 0x90, 0x40, 0x01, 0x81,
+0xA0, 0x70, 0xD0, 0x80, 0x50, 0xB0, 0x09, 0x40, 0x0F, 0x01, 0x80, 0x10, 0x60, 0xE0, 0x2B, 0xC1,
+0xE2, 0xC2, 0x61, 0xC0, 0xE1, 0x21, 0xE0, 0x60, 0x71, 0x10, 0xD0, 0xA0, 0xD0, 0xF0, 0x80, 0x05,
+0xB0, 0x40, 0x01, 0x40, 0x0A, 0x50, 0x40, 0xA0, 0x71, 0x40, 0x30, 0xB0, 0x00, 0xB0, 0x30, 0x01,
+0x41, 0x50, 0x80, 0x70, 0x80, 0xB0, 0x30, 0x10, 0x50, 0x01, 0x50, 0xA0, 0x01, 0xA0, 0x40, 0x00,
+0x31, 0xB0, 0x0F, 0x77, 0x0F, 0x7A, 0xB0, 0x00, 0xA0, 0x30, 0x80, 0xB0, 0x00, 0x70, 0x00, 0x90,
+0x30, 0x80, 0x90, 0x41, 0x01, 0x30, 0xB0, 0x01, 0xA0, 0x30, 0xD1, 0x30, 0x90, 0xB0, 0xA0, 0xB0,
+0x0B, 0x50, 0xB0, 0x0D, 0x80, 0x31, 0xF0, 0xE0, 0x2C, 0xC1, 0xE0, 0x20, 0x70, 0xF2, 0x60, 0x80,
+0xF0, 0xA0, 0x70, 0xF0, 0xE0, 0x20, 0xE1, 0x60, 0xE0, 0xC0, 0xA1, 0xC0, 0x60, 0x70, 0x30, 0x02,
+0xB0, 0x10, 0x90, 0x01, 0x90, 0x0E, 0x50, 0x80, 0x70, 0xD0, 0xA1, 0x50, 0x01, 0x30, 0xB0, 0x01,
+0xA0, 0x50, 0x80, 0xA0, 0x10, 0xD0, 0xA0, 0xB0, 0x40, 0x80, 0x01, 0x10, 0x0F, 0x7C, 0x0F, 0x79,
+0x50, 0x01, 0x80, 0x40, 0x01, 0x50, 0x30, 0xA0, 0x40, 0xA0, 0x02, 0x30, 0x01, 0x50, 0xA1, 0x10,
+0x30, 0x40, 0x01, 0x90, 0x02, 0xA0, 0x90, 0x0A, 0xB0, 0x90, 0x0D, 0x70, 0xD0, 0xC0, 0xE1, 0x2C,
+0xC0, 0x60, 0x21, 0xA0, 0x60, 0xE0, 0xC0, 0x50, 0xB0, 0x01, 0xE0, 0x70, 0xE0, 0x20, 0xE0, 0xC1,
+0xE6, 0x60, 0x70, 0xF0, 0x40, 0x10, 0xA0, 0x02, 0x90, 0x0F, 0x00, 0xB1, 0x00, 0xB0, 0x30, 0xD1,
+0x80, 0xA0, 0x01, 0x50, 0x80, 0x01, 0x80, 0x50, 0x80, 0xA0, 0x80, 0x50, 0xA0, 0xB0, 0xA0, 0x80,
+0x0F, 0x7C, 0x0F, 0x79, 0x40, 0xD0, 0x30, 0xA0, 0x50, 0x80, 0x30, 0xD0, 0x10, 0x01, 0x80, 0x50,
+0x01, 0xA0, 0x40, 0xD0, 0x70, 0x30, 0xB0, 0x04, 0x40, 0x03, 0x30, 0x40, 0x0A, 0x40, 0x0C, 0xA0,
+0x70, 0xC0, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x22, 0x60, 0xF2, 0x30, 0xA0, 0x70, 0xF0, 0xC0, 0xE0,
+0x21, 0xC1, 0xE0, 0x26, 0xE0, 0x60, 0xF0, 0xD0, 0x40, 0x01, 0xB0, 0x90, 0x0F, 0x00, 0x90, 0xB0,
+0x04, 0x40, 0x70, 0xD0, 0x30, 0x70, 0x02, 0xA0, 0x01, 0x30, 0x10, 0x30, 0x70, 0x10, 0x80, 0x0F,
+0x7D, 0x0F, 0x7A, 0x50, 0x30, 0xA0, 0x70, 0x90, 0x00, 0x90, 0x10, 0x90, 0x01, 0xA0, 0x80, 0x70,
+0xD0, 0x80, 0x50, 0x07, 0x50, 0xB0, 0x03, 0x30, 0x40, 0x09, 0x40, 0x04, 0xB1, 0x30, 0x70, 0x90,
+0x30, 0x80, 0xF0, 0x60, 0xE1, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x22, 0xE0, 0x20, 0xE5, 0x22, 0xE0,
+0xC1, 0xE0, 0x25, 0xE0, 0x21, 0xE0, 0x90, 0xD0, 0x01, 0x51, 0x0F, 0x00, 0x40, 0x07, 0xB0, 0x90,
+0xA0, 0x70, 0x30, 0x40, 0x80, 0x01, 0xD1, 0x01, 0xA0, 0x31, 0x50, 0x0F, 0x7B, 0x0F, 0x78, 0xB0,
+0x30, 0x70, 0x90, 0x00, 0x41, 0x01, 0x10, 0xA0, 0x40, 0x70, 0xD0, 0x80, 0xB0, 0x0A, 0xB0, 0x90,
+0x04, 0x30, 0x80, 0x08, 0x90, 0x03, 0x30, 0x70, 0x12, 0xA0, 0xD0, 0xA0, 0xD0, 0xE0, 0x20, 0xE0,
+0x60, 0x2E, 0xC0, 0x60, 0x2D, 0xE0, 0xC1, 0x29, 0xE0, 0xA0, 0x40, 0x01, 0x90, 0xB0, 0x0F, 0x00,
+0x40, 0x0B, 0x90, 0xA0, 0x10, 0x30, 0x40, 0x10, 0x40, 0x01, 0x30, 0x00, 0xB0, 0x30, 0x70, 0x90,
+0x0F, 0x79, 0x0F, 0x76, 0x40, 0x31, 0x00, 0x30, 0x02, 0xA0, 0x00, 0x90, 0x10, 0xD0, 0x80, 0x0F,
+0x00, 0x90, 0x05, 0x80, 0x30, 0x07, 0x50, 0x80, 0x30, 0xA0, 0x70, 0x60, 0xE1, 0xC0, 0xE4, 0x21,
+0xE0, 0x60, 0xE0, 0x2D, 0xC1, 0x2E, 0x60, 0x2A, 0xC0, 0xA0, 0x02, 0x40, 0x0F, 0x00, 0x51, 0x0E,
+0x40, 0xA0, 0x10, 0x30, 0x00, 0x40, 0x90, 0x01, 0x80, 0x50, 0x40, 0xA0, 0x80, 0xB0, 0x0F, 0x76,
+0x0F, 0x64, 0x40, 0x30, 0x80, 0x0B, 0xB0, 0x80, 0xA0, 0x81, 0x01, 0x41, 0x00, 0x50, 0x70, 0x11,
+0x30, 0x80, 0x51, 0x02, 0xB0, 0x40, 0x80, 0x40, 0x07, 0x80, 0x06, 0x40, 0x30, 0x04, 0x40, 0x30,
+0xA0, 0x80, 0xC1, 0x2B, 0xE0, 0x60, 0x2E, 0xC1, 0x2D, 0xE0, 0x60, 0x2A, 0xE0, 0xA0, 0x50, 0x01,
+0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x50, 0xB0, 0x40, 0x70, 0x10, 0x40, 0x01, 0x30, 0x01, 0xB0,
+0xA0, 0x31, 0x50, 0x0F, 0x74, 0x0F, 0x64, 0x30, 0xB0, 0x30, 0x09, 0x50, 0x30, 0x70, 0x40, 0x01,
+0xA0, 0x01, 0xB0, 0xD0, 0x70, 0x10, 0xA0, 0x40, 0x00, 0x50, 0x90, 0x80, 0xA0, 0x70, 0xA0, 0x30,
+0xD0, 0x80, 0x50, 0x30, 0xA0, 0x00, 0x40, 0x80, 0x02, 0x30, 0xA0, 0x40, 0xB0, 0x05, 0x40, 0x80,
+0xB2, 0x60, 0xA0, 0xC1, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0xC0, 0x2D, 0xC1, 0x2D, 0xE0, 0x60, 0x2B,
+0xC0, 0x70, 0x50, 0x00, 0x50, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x02, 0xB0, 0x30, 0xD1, 0x40,
+0x01, 0x30, 0xB0, 0x00, 0xB0, 0x70, 0xA0, 0x90, 0x0F, 0x72, 0x0F, 0x60, 0xB0, 0xD1, 0x80, 0x00,
+0x80, 0x50, 0x07, 0xB0, 0xA0, 0x30, 0xB0, 0x50, 0x80, 0x01, 0x50, 0x80, 0x30, 0xD0, 0x30, 0x90,
+0x05, 0x50, 0x07, 0x80, 0x70, 0xD0, 0x90, 0x70, 0xA0, 0x70, 0x50, 0x00, 0x80, 0xA0, 0x40, 0x05,
+0x70, 0x10, 0xD0, 0xA0, 0xF0, 0xE2, 0x60, 0x2E, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0x2C,
+0xE0, 0xA1, 0x90, 0x0F, 0x00, 0x90, 0x0F, 0x00, 0xB0, 0x50, 0x05, 0x40, 0xD0, 0x70, 0x50, 0x30,
+0x02, 0xA0, 0x00, 0x40, 0xA0, 0x40, 0x0F, 0x70, 0x0F, 0x60, 0xA0, 0xB0, 0x00, 0xA0, 0x80, 0x07,
+0x50, 0xA0, 0x30, 0xA0, 0x02, 0xA0, 0x00, 0x50, 0xA0, 0x10, 0x40, 0x08, 0x40, 0x0C, 0x90, 0xB0,
+0x01, 0x40, 0x00, 0x81, 0x90, 0x30, 0xA0, 0x70, 0x10, 0x60, 0xE3, 0x21, 0xE0, 0x60, 0xE0, 0x2D,
+0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0xE0, 0x2C, 0xE0, 0xC0, 0xF0, 0x70, 0xA0, 0xB0, 0x0B,
+0x51, 0x0F, 0x00, 0x90, 0x08, 0xB0, 0xA0, 0x10, 0x80, 0x00, 0x30, 0xB0, 0x01, 0x30, 0x40, 0xA0,
+0x80, 0x0B, 0x30, 0x70, 0x50, 0x0F, 0x5F, 0x0F, 0x5D, 0xB1, 0x00, 0xA0, 0x50, 0x01, 0x10, 0x05,
+0x90, 0x30, 0x70, 0x01, 0xB0, 0x30, 0x01, 0x30, 0x11, 0xA0, 0x80, 0x09, 0xB0, 0x50, 0x0F, 0x00,
+0x90, 0x00, 0x40, 0xD0, 0x70, 0x90, 0xE1, 0xC0, 0xE0, 0x26, 0x60, 0x2E, 0xC1, 0x2D, 0xC0, 0x60,
+0x2D, 0xE0, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0xE1, 0x60, 0x70, 0x0B, 0x40, 0x0F, 0x01, 0x40, 0x0B,
+0x80, 0xD0, 0x10, 0xB0, 0x00, 0xB0, 0x30, 0x01, 0x40, 0xD0, 0x80, 0x08, 0xB0, 0x80, 0x00, 0x70,
+0xB0, 0x0F, 0x5E, 0x0F, 0x5C, 0x30, 0xA0, 0xD0, 0x50, 0x90, 0xA0, 0x01, 0x81, 0x02, 0x90, 0x30,
+0x80, 0x00, 0x30, 0xB0, 0x01, 0x30, 0x80, 0xD0, 0xA0, 0xB0, 0x00, 0xB0, 0x0B, 0x40, 0x0F, 0x00,
+0xB0, 0x30, 0x10, 0xD0, 0x70, 0xE2, 0x28, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0xC0,
+0x60, 0xE0, 0x2C, 0xE0, 0x60, 0x20, 0xE0, 0x60, 0xA0, 0x0B, 0x90, 0x0F, 0x00, 0x51, 0x0D, 0x90,
+0xD0, 0xA0, 0x30, 0x50, 0x01, 0x30, 0xB0, 0x90, 0x30, 0x80, 0x09, 0x70, 0x50, 0x00, 0x40, 0xB0,
+0x0F, 0x5B, 0x0F, 0x5B, 0xB0, 0xD0, 0x00, 0x90, 0x30, 0x00, 0xD0, 0x90, 0x00, 0x50, 0xA0, 0x00,
+0xB0, 0xA0, 0x30, 0x80, 0x01, 0x50, 0x80, 0x00, 0x30, 0xD0, 0x30, 0xA0, 0x0F, 0x00, 0x40, 0x0E,
+0x31, 0x40, 0xA0, 0x60, 0xD0, 0xC0, 0xE0, 0x29, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xC1, 0x2D, 0xC1,
+0x2D, 0xE0, 0x60, 0x20, 0xE1, 0xD0, 0x30, 0x09, 0xB0, 0x50, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40,
+0xD0, 0x70, 0xB1, 0x30, 0x01, 0xB0, 0xA1, 0x40, 0x05, 0x30, 0x10, 0x80, 0x00, 0xD0, 0x30, 0x70,
+0x90, 0x0F, 0x5A, 0x0F, 0x58, 0xA0, 0xD0, 0x40, 0x00, 0x40, 0x00, 0xD1, 0x30, 0x00, 0xD0, 0x80,
+0x70, 0x40, 0xA0, 0x30, 0x01, 0x30, 0xB0, 0x01, 0x11, 0x80, 0x00, 0x30, 0x50, 0x0F, 0x00, 0xB0,
+0x90, 0x0E, 0x10, 0x80, 0xA0, 0xD0, 0xF0, 0xE0, 0x2A, 0xC0, 0x60, 0x2D, 0xC0, 0x60, 0xE0, 0x2C,
+0xC0, 0x60, 0x2D, 0xC1, 0x2D, 0xC1, 0xE0, 0x20, 0xE0, 0x70, 0xA0, 0x09, 0x50, 0xB0, 0x0F, 0x00,
+0x90, 0x0F, 0x01, 0x50, 0x00, 0xB0, 0x70, 0x10, 0x40, 0x01, 0x30, 0xB0, 0x00, 0x90, 0xD0, 0x40,
+0x00, 0x50, 0x70, 0x01, 0xD0, 0x00, 0x70, 0x40, 0x00, 0x50, 0xA0, 0x0F, 0x5A, 0x0F, 0x57, 0xA0,
+0x90, 0x00, 0x70, 0x02, 0xB0, 0x00, 0x70, 0x90, 0x00, 0x80, 0xA0, 0x30, 0x50, 0x80, 0x01, 0xB0,
+0x31, 0xD0, 0x90, 0x01, 0x50, 0x30, 0xB0, 0x0F, 0x01, 0x40, 0x0E, 0x80, 0x70, 0xD0, 0xE1, 0x2B,
+0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0xC1, 0x2D, 0xC1, 0xE0, 0x20, 0x60, 0xA0,
+0x80, 0x09, 0x40, 0x0F, 0x00, 0x50, 0xB0, 0x0F, 0x01, 0x40, 0x02, 0xB0, 0xA0, 0xD0, 0x40, 0x80,
+0x01, 0xB0, 0x80, 0x40, 0xA0, 0x90, 0x70, 0x51, 0xD0, 0x40, 0x70, 0x01, 0x81, 0x00, 0xA0, 0x80,
+0x0F, 0x57, 0x0F, 0x57, 0x30, 0xB0, 0x50, 0x10, 0x80, 0x03, 0x30, 0x41, 0x70, 0x90, 0x01, 0x30,
+0xB0, 0x00, 0x30, 0xD0, 0x80, 0x31, 0x40, 0xB0, 0xA0, 0xB0, 0x90, 0x0F, 0x01, 0x90, 0xB0, 0x02,
+0x50, 0xB0, 0x07, 0x50, 0x11, 0x30, 0xE0, 0x2C, 0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xC0, 0x60,
+0x2D, 0xC1, 0x2D, 0xC1, 0x21, 0xE0, 0xA0, 0xB1, 0x50, 0x07, 0x90, 0x0F, 0x00, 0x40, 0x0F, 0x01,
+0x50, 0xB0, 0x04, 0xB0, 0x70, 0xD0, 0x50, 0x00, 0xA0, 0xB0, 0x01, 0xA0, 0x70, 0xD0, 0x70, 0xB0,
+0x30, 0x90, 0x01, 0xD0, 0xB0, 0x90, 0x40, 0x80, 0x50, 0x0F, 0x56, 0x0F, 0x59, 0x40, 0x90, 0x31,
+0x90, 0x70, 0x80, 0x10, 0xA0, 0x90, 0xB0, 0x30, 0x02, 0xD1, 0x40, 0x03, 0x50, 0xA0, 0x80, 0x00,
+0x50, 0xB0, 0x0D, 0x50, 0x01, 0x80, 0x10, 0x51, 0x70, 0x10, 0x70, 0x50, 0x06, 0x71, 0xF0, 0xE0,
+0x2C, 0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0xC1, 0x2D, 0x60, 0x22, 0xE0, 0x20,
+0xA0, 0x12, 0x50, 0x04, 0x51, 0x0E, 0xB0, 0x90, 0x0F, 0x01, 0x40, 0x07, 0xB0, 0xA0, 0xD0, 0x30,
+0x01, 0xB0, 0x30, 0x00, 0x80, 0x30, 0x00, 0x30, 0x50, 0x00, 0xA0, 0x80, 0x01, 0x80, 0x40, 0x0F,
+0x57, 0x0F, 0x5C, 0xD0, 0x00, 0x40, 0xD0, 0x10, 0x30, 0x01, 0x30, 0xB0, 0x80, 0x10, 0x80, 0x06,
+0xA0, 0x02, 0x81, 0x0B, 0x30, 0x10, 0xB0, 0x00, 0x80, 0x10, 0x00, 0x70, 0x81, 0x50, 0x06, 0x40,
+0x11, 0xF0, 0xE0, 0x2C, 0xE0, 0xC1, 0x2C, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0x60, 0x2E, 0x60,
+0xE0, 0x22, 0xE1, 0x10, 0xD0, 0x40, 0x05, 0x90, 0x0F, 0x00, 0x90, 0xB0, 0x0F, 0x00, 0x51, 0x09,
+0xB0, 0xD0, 0xA0, 0xB0, 0xA0, 0x01, 0xB0, 0x11, 0x30, 0xA0, 0xD0, 0x30, 0x0F, 0x5C, 0x0F, 0x59,
+0xA0, 0x40, 0x30, 0x82, 0x00, 0x30, 0x10, 0xB0, 0x00, 0x40, 0x10, 0x80, 0x07, 0x40, 0x90, 0x01,
+0xB0, 0xD0, 0xB0, 0x0A, 0x31, 0x80, 0xA0, 0x40, 0xD0, 0x30, 0x02, 0xA0, 0x07, 0x40, 0xA0, 0x90,
+0xC1, 0x2C, 0xE0, 0xC1, 0x2C, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0x60, 0x2C, 0xE1, 0x60, 0xE0,
+0x23, 0xE0, 0xF0, 0x70, 0x50, 0x05, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40, 0x0C, 0x50, 0xD0,
+0x70, 0x01, 0x70, 0x10, 0x00, 0x90, 0xA0, 0x90, 0x0F, 0x5D, 0x0F, 0x59, 0x90, 0x30, 0xA0, 0x30,
+0xA0, 0xB0, 0x01, 0x10, 0xD0, 0xA1, 0x09, 0x30, 0x50, 0x90, 0x00, 0x50, 0xD0, 0x90, 0x09, 0x90,
+0xD0, 0xF0, 0xC0, 0xD1, 0xA0, 0x80, 0x08, 0x90, 0x80, 0x60, 0x50, 0x10, 0xA0, 0xC0, 0x60, 0xE0,
+0x2D, 0x60, 0x2C, 0xE0, 0xC1, 0x2C, 0xC0, 0x60, 0x2D, 0x60, 0x2B, 0xC0, 0xF0, 0x60, 0xC0, 0xE0,
+0x23, 0xE1, 0xA0, 0x50, 0x03, 0x90, 0x00, 0x90, 0x0E, 0xB0, 0x50, 0x0F, 0x00, 0xB0, 0x50, 0x70,
+0x0D, 0x40, 0xD0, 0xA0, 0x10, 0x80, 0x01, 0x32, 0x0F, 0x5C, 0x0F, 0x59, 0xB0, 0x30, 0x40, 0x00,
+0xB0, 0x30, 0x01, 0x10, 0xD0, 0x50, 0x09, 0x40, 0x90, 0x70, 0x80, 0x90, 0x10, 0x30, 0x50, 0xB0,
+0x02, 0x50, 0x04, 0xB0, 0x10, 0xA0, 0x60, 0xA0, 0x80, 0x30, 0x80, 0x00, 0xA0, 0xB0, 0x05, 0x10,
+0xF0, 0x60, 0xF1, 0x60, 0xE0, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2C, 0xC1, 0x2C, 0xC0, 0x60, 0x2D,
+0x60, 0xE0, 0x29, 0xE0, 0xF0, 0xA0, 0x60, 0xF0, 0xE0, 0x22, 0xE0, 0x60, 0x70, 0xE0, 0xA0, 0x90,
+0x00, 0x80, 0xA0, 0x10, 0x40, 0x30, 0x0E, 0x90, 0x0F, 0x01, 0x40, 0x00, 0xB0, 0x0F, 0x00, 0x30,
+0x10, 0x90, 0x00, 0x90, 0x80, 0x00, 0x50, 0xA0, 0x40, 0x0F, 0x5A, 0x0F, 0x58, 0x32, 0xB0, 0x01,
+0x90, 0xA0, 0x10, 0x90, 0xB0, 0x50, 0x09, 0x30, 0x01, 0x40, 0x10, 0x50, 0x01, 0x40, 0x01, 0x70,
+0x10, 0xB0, 0x04, 0x10, 0xD0, 0xE0, 0x60, 0x80, 0x30, 0x90, 0x51, 0x04, 0xB0, 0x10, 0x70, 0x10,
+0xC0, 0xE1, 0x20, 0xE0, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2C, 0xC1, 0xE0, 0x2B, 0xC0, 0x60, 0x2D,
+0x60, 0xE0, 0x2A, 0xE0, 0x70, 0x30, 0xF0, 0xC0, 0x22, 0xE0, 0x70, 0x00, 0xA0, 0x60, 0x70, 0xA0,
+0x10, 0x60, 0xC0, 0xA0, 0x10, 0x0E, 0x40, 0x0F, 0x00, 0xB0, 0x50, 0x0F, 0x02, 0x90, 0x00, 0x70,
+0xA1, 0x02, 0x30, 0x80, 0x70, 0xB0, 0x0F, 0x58, 0x0F, 0x56, 0x50, 0xD0, 0x50, 0x01, 0xA0, 0x00,
+0x50, 0xD0, 0x30, 0x02, 0x40, 0x08, 0x40, 0x10, 0x00, 0x40, 0x70, 0xD0, 0x02, 0x50, 0x00, 0x50,
+0x70, 0x41, 0x01, 0xA0, 0x10, 0x30, 0xB0, 0xA0, 0x40, 0xA0, 0x70, 0xA0, 0xB0, 0x40, 0x05, 0x50,
+0x70, 0xC0, 0xF0, 0xE1, 0x20, 0xE1, 0xC1, 0xE0, 0x2C, 0x60, 0x2E, 0x60, 0xE0, 0x2B, 0xC0, 0x60,
+0x2D, 0x60, 0xE0, 0x2A, 0xE1, 0xA0, 0x70, 0xC0, 0xE3, 0xA0, 0x90, 0x10, 0xF0, 0xE4, 0x60, 0xA0,
+0x0D, 0x51, 0x0F, 0x00, 0x40, 0xB0, 0x0F, 0x01, 0x90, 0xB0, 0x01, 0x90, 0xD0, 0x80, 0x00, 0x41,
+0x01, 0x70, 0x80, 0x0F, 0x57, 0x0F, 0x55, 0x81, 0x30, 0x50, 0x01, 0x40, 0xD0, 0x70, 0xB0, 0x03,
+0xB0, 0x90, 0x07, 0xA0, 0x70, 0xB0, 0xA0, 0xE0, 0xA0, 0x40, 0x00, 0xB0, 0x80, 0x90, 0x01, 0x40,
+0x70, 0x01, 0xB0, 0x50, 0x00, 0x10, 0x80, 0xA0, 0x00, 0x30, 0x40, 0x00, 0x40, 0x06, 0x70, 0xE5,
+0xC0, 0xF0, 0x60, 0xE0, 0x2C, 0xC1, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x28,
+0xC0, 0x20, 0xE1, 0x60, 0xA0, 0x72, 0xC0, 0xE0, 0xA0, 0x10, 0x60, 0xF0, 0xE0, 0x21, 0xE0, 0xC1,
+0xF0, 0x70, 0x40, 0x0B, 0x40, 0x0F, 0x00, 0xB0, 0x90, 0x0F, 0x02, 0x90, 0x04, 0x80, 0xD0, 0x70,
+0x02, 0xA0, 0x40, 0xA0, 0x50, 0x0F, 0x55, 0x0F, 0x53, 0xB0, 0xD0, 0x50, 0x01, 0xA0, 0x00, 0x40,
+0xD0, 0x40, 0x06, 0x40, 0x06, 0x50, 0x80, 0x01, 0xA0, 0xE0, 0x60, 0xA0, 0x30, 0x10, 0x30, 0x90,
+0x08, 0x50, 0xA0, 0x10, 0x40, 0x02, 0xB0, 0x90, 0x03, 0x80, 0xA0, 0xC0, 0xE0, 0x21, 0xA0, 0x71,
+0x30, 0x40, 0xF0, 0xE2, 0x2A, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2D, 0x60, 0xE0,
+0x27, 0xE0, 0x70, 0xF0, 0xE1, 0xC0, 0x70, 0x50, 0x80, 0x10, 0xD0, 0xE0, 0x60, 0xF0, 0xE1, 0x23,
+0xC1, 0xE0, 0xC0, 0xD0, 0x0B, 0x40, 0x0F, 0x00, 0x90, 0x0F, 0x02, 0x40, 0x06, 0xB0, 0x70, 0x30,
+0x00, 0x41, 0x01, 0xA0, 0x80, 0x0F, 0x54, 0x0F, 0x46, 0x90, 0x0A, 0x80, 0x31, 0x50, 0x01, 0x90,
+0x10, 0xA0, 0x09, 0x40, 0x05, 0xA0, 0x01, 0x90, 0x70, 0xE0, 0xC0, 0xF0, 0xD0, 0x90, 0x00, 0xB0,
+0x90, 0x09, 0x50, 0x04, 0x40, 0x01, 0xB0, 0xD0, 0x60, 0xE0, 0x23, 0xA0, 0x03, 0x90, 0xD0, 0xC0,
+0xE0, 0x2A, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2C, 0xC1, 0xE0, 0x29, 0xE1, 0xC2,
+0x10, 0xD0, 0x01, 0x10, 0x70, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x60, 0xE1, 0x60, 0xD0, 0x60, 0xA0,
+0x30, 0x50, 0x06, 0x50, 0xB0, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0xB0, 0x90, 0x08, 0x40, 0x10, 0x70,
+0x02, 0xA0, 0x40, 0xA0, 0xB0, 0x0F, 0x52, 0x0F, 0x45, 0x30, 0x40, 0x80, 0x07, 0xB0, 0xD0, 0x90,
+0x01, 0xA0, 0x00, 0x40, 0x10, 0x50, 0x0A, 0x51, 0x40, 0x02, 0xB0, 0x30, 0x00, 0x40, 0x50, 0xA0,
+0x60, 0xC0, 0x70, 0x40, 0x02, 0x40, 0x0F, 0x00, 0x50, 0xB0, 0x30, 0x70, 0xE3, 0x21, 0xC0, 0xA0,
+0x03, 0xB0, 0x40, 0x70, 0xC0, 0xE1, 0x28, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2C,
+0xC1, 0xE0, 0x2A, 0xE0, 0xC1, 0xE0, 0xD1, 0x80, 0x01, 0xF0, 0xC0, 0xE0, 0xF1, 0xE0, 0x21, 0x60,
+0xE1, 0x60, 0xF0, 0x60, 0x50, 0xA0, 0x40, 0x06, 0x40, 0x0F, 0x00, 0x90, 0xB0, 0x0F, 0x01, 0x40,
+0x0B, 0xA0, 0x70, 0x00, 0x80, 0x90, 0x01, 0xA0, 0x80, 0x0F, 0x51, 0x0F, 0x45, 0x30, 0x41, 0x06,
+0x40, 0x30, 0x80, 0x50, 0x01, 0x40, 0xD0, 0x30, 0x0C, 0x50, 0xA0, 0x10, 0x50, 0x01, 0x30, 0x40,
+0x00, 0xB0, 0x00, 0x30, 0xA0, 0x70, 0xB0, 0x03, 0xB0, 0x50, 0x0E, 0xB0, 0x30, 0x60, 0x50, 0xC0,
+0xE5, 0xA0, 0x90, 0x03, 0x90, 0xB0, 0xD0, 0x30, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0x2D, 0x60, 0xE0,
+0x2B, 0xC0, 0x60, 0x2C, 0x60, 0xC0, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0xE0, 0xC0, 0xA0, 0x90, 0x00,
+0x90, 0xA0, 0xE1, 0x60, 0xC0, 0x20, 0xE0, 0xC0, 0x60, 0x22, 0xE2, 0xA0, 0xB0, 0x05, 0xB0, 0x90,
+0x0F, 0x00, 0x40, 0x0F, 0x01, 0x51, 0x0C, 0x40, 0xD0, 0xA0, 0x02, 0x30, 0x40, 0xA0, 0xB0, 0x0F,
+0x4F, 0x0F, 0x43, 0x40, 0xB0, 0x00, 0x50, 0x06, 0x30, 0x40, 0x01, 0xA0, 0x00, 0x90, 0xD0, 0x90,
+0x0E, 0x80, 0x40, 0x02, 0xA0, 0x03, 0x50, 0x11, 0xB0, 0x04, 0x40, 0x02, 0xA0, 0x06, 0xB0, 0x70,
+0x50, 0x00, 0x80, 0x31, 0x70, 0xA0, 0x60, 0xC0, 0x70, 0xA0, 0xE0, 0xA0, 0x30, 0xA0, 0x50, 0x02,
+0x40, 0x01, 0x90, 0x70, 0xE0, 0x27, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2B, 0xE0,
+0x60, 0x2D, 0x60, 0xE0, 0x20, 0xE0, 0xF0, 0x71, 0xD0, 0x70, 0xE0, 0x20, 0xE0, 0x22, 0x60, 0x21,
+0xE1, 0xC0, 0xA0, 0x10, 0x90, 0x06, 0x50, 0xB0, 0x0E, 0x50, 0xB0, 0x0F, 0x01, 0x40, 0x0F, 0x00,
+0xA0, 0x70, 0x00, 0x30, 0x90, 0x00, 0xB0, 0xA0, 0x50, 0x0F, 0x4E, 0x0F, 0x41, 0xB0, 0x70, 0x80,
+0x10, 0x80, 0x05, 0x50, 0x70, 0x30, 0x90, 0x01, 0xB0, 0x10, 0xD0, 0xB1, 0x51, 0xB3, 0x08, 0x10,
+0x30, 0x01, 0x50, 0x80, 0x04, 0x80, 0x11, 0xB0, 0x01, 0x40, 0x00, 0x51, 0x03, 0x30, 0x10, 0x50,
+0x02, 0x10, 0xF0, 0xD0, 0x90, 0xA0, 0x30, 0x90, 0x00, 0x90, 0xF0, 0xD0, 0x00, 0x30, 0x10, 0xD0,
+0x40, 0xD0, 0xA0, 0x02, 0x50, 0xB0, 0x00, 0x30, 0xC0, 0x29, 0xC1, 0x2C, 0x60, 0x2C, 0xC0, 0x60,
+0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x21, 0xE2, 0x70, 0xF0, 0xE0, 0x23, 0xE0, 0x60, 0x20, 0xE0,
+0xC0, 0xA0, 0x70, 0x10, 0x92, 0x05, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x40, 0xB0, 0x0F, 0x01,
+0x90, 0x10, 0x30, 0x02, 0xA0, 0x31, 0x0F, 0x4D, 0x0F, 0x41, 0x40, 0x30, 0x01, 0xD0, 0x40, 0x03,
+0x80, 0x30, 0x01, 0xA0, 0x00, 0x90, 0xD0, 0x81, 0x40, 0x84, 0x33, 0xA3, 0x32, 0x70, 0xD0, 0x80,
+0x40, 0x30, 0x50, 0x05, 0xA0, 0x10, 0xA0, 0x01, 0x10, 0x80, 0x00, 0x40, 0x03, 0x90, 0xA0, 0xB0,
+0x01, 0x80, 0xA0, 0xC0, 0xD0, 0x70, 0x80, 0xA0, 0x50, 0x00, 0x80, 0xA0, 0x40, 0x00, 0x10, 0x40,
+0x01, 0x40, 0x10, 0x50, 0x01, 0xB0, 0x80, 0x30, 0xA0, 0xE4, 0x26, 0x60, 0xE0, 0x2B, 0x60, 0x2C,
+0xC0, 0x60, 0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x24, 0xE1, 0x24, 0xC0, 0x60, 0xE0, 0xC0, 0x12,
+0xD0, 0x71, 0xB0, 0x04, 0xB0, 0x50, 0x0E, 0x50, 0xB0, 0x0F, 0x01, 0x90, 0x0F, 0x03, 0x40, 0x70,
+0x30, 0x00, 0xA0, 0xB0, 0x00, 0x90, 0xA0, 0xB0, 0x0F, 0x4B, 0x0F, 0x3E, 0x50, 0x30, 0x80, 0xB0,
+0x70, 0x01, 0xB0, 0xD0, 0xB0, 0x00, 0xB0, 0x30, 0xA0, 0x40, 0x02, 0x10, 0xA0, 0xB0, 0x00, 0x40,
+0x06, 0xB0, 0x40, 0x06, 0xB0, 0x50, 0xA0, 0x81, 0xA0, 0x03, 0x90, 0x80, 0x00, 0xD0, 0x10, 0x30,
+0x00, 0xB0, 0x10, 0x50, 0x00, 0xB0, 0x50, 0xB0, 0xA1, 0x04, 0x70, 0x50, 0x80, 0x70, 0x90, 0x80,
+0x00, 0x90, 0x00, 0xA1, 0x01, 0x10, 0x03, 0x70, 0x40, 0x01, 0x90, 0x70, 0xC0, 0xE0, 0x20, 0xE0,
+0xC0, 0xF0, 0xA0, 0xC0, 0xE0, 0x24, 0x60, 0xE0, 0x2B, 0xC1, 0x2B, 0xC0, 0x60, 0x2B, 0xE0, 0x60,
+0x2B, 0xE0, 0xC1, 0x2C, 0xC1, 0xE0, 0xF0, 0x40, 0x90, 0xD0, 0x10, 0xA0, 0x06, 0x90, 0x0F, 0x00,
+0x40, 0x0F, 0x01, 0x40, 0x0F, 0x03, 0x40, 0x01, 0x80, 0x10, 0x80, 0x02, 0xA0, 0x30, 0x90, 0x04,
+0xB0, 0x90, 0x80, 0xD0, 0x30, 0x0F, 0x40, 0x0F, 0x3D, 0xB0, 0x70, 0x90, 0xA0, 0x40, 0x80, 0xA0,
+0x01, 0x80, 0x40, 0xB0, 0xA0, 0x50, 0x00, 0xA0, 0xB0, 0x00, 0x70, 0x30, 0x03, 0x40, 0x04, 0x80,
+0x10, 0x30, 0x71, 0x05, 0x50, 0xA0, 0x70, 0x80, 0x40, 0x02, 0xB0, 0x11, 0x80, 0x90, 0x10, 0x50,
+0x01, 0x30, 0x80, 0x00, 0x40, 0xA0, 0x10, 0x30, 0xB0, 0x03, 0xB0, 0x70, 0x60, 0xA0, 0x50, 0x02,
+0xB0, 0xA0, 0x30, 0x80, 0x06, 0x80, 0xA0, 0x00, 0xB0, 0x30, 0xF0, 0xE3, 0x70, 0xD0, 0xF0, 0x60,
+0xE0, 0x23, 0xE0, 0x60, 0xE0, 0x2B, 0xC1, 0x2B, 0xC0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xE0, 0xC1,
+0x2B, 0xE0, 0x60, 0x20, 0xE0, 0xC0, 0x10, 0x30, 0x40, 0x30, 0x80, 0x06, 0x40, 0x0E, 0x51, 0x0F,
+0x00, 0xB0, 0x50, 0x0F, 0x02, 0x51, 0x02, 0xB0, 0xD0, 0x40, 0x00, 0xA0, 0xB0, 0x00, 0x30, 0x80,
+0x02, 0xA1, 0x81, 0x10, 0x0F, 0x41, 0x0F, 0x3D, 0x81, 0x00, 0xB0, 0xA0, 0x00, 0xA0, 0x30, 0x00,
+0x30, 0xA0, 0x70, 0x40, 0x02, 0xD0, 0x10, 0x50, 0x04, 0x50, 0x90, 0x02, 0x31, 0xA0, 0x10, 0x30,
+0x06, 0x50, 0x70, 0x91, 0x50, 0x05, 0x40, 0x50, 0x80, 0x01, 0xB0, 0x10, 0x01, 0x31, 0xB0, 0x06,
+0xD0, 0x90, 0x70, 0x04, 0xD0, 0x30, 0x05, 0xD0, 0x50, 0x60, 0xD0, 0xA1, 0x60, 0xC0, 0xE0, 0xF1,
+0xD1, 0x70, 0xB0, 0xA0, 0xE0, 0x24, 0x60, 0xC0, 0x2B, 0xC0, 0x60, 0x2B, 0xC1, 0x2B, 0xE0, 0x60,
+0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x20, 0xE0, 0x10, 0x01, 0xA0, 0x06, 0x51, 0x0E, 0x40, 0x0F,
+0x01, 0x40, 0x0F, 0x03, 0x40, 0x05, 0xA0, 0xD0, 0x90, 0x02, 0x70, 0xA0, 0x01, 0x31, 0x00, 0xD0,
+0xB0, 0x00, 0xA0, 0xD0, 0x70, 0x0F, 0x3D, 0x0F, 0x3B, 0xB0, 0x00, 0x50, 0x80, 0x00, 0x50, 0x30,
+0x01, 0x80, 0x70, 0xD0, 0x40, 0x00, 0x30, 0x50, 0x00, 0xA1, 0x07, 0x90, 0xB0, 0x01, 0xA1, 0x40,
+0x02, 0xB0, 0x04, 0x50, 0x10, 0x00, 0x30, 0x40, 0x06, 0xB0, 0x10, 0x40, 0x00, 0x30, 0x10, 0x40,
+0x02, 0x40, 0x04, 0x40, 0x11, 0x90, 0xA0, 0x04, 0x80, 0x06, 0xA0, 0xD0, 0xF0, 0xE4, 0x71, 0x10,
+0xD0, 0x70, 0x10, 0x50, 0xF0, 0x60, 0x24, 0xC1, 0x2C, 0x60, 0x2B, 0xC1, 0x2C, 0x60, 0x2B, 0xE0,
+0x60, 0xE0, 0x2C, 0x60, 0xE0, 0x20, 0xE0, 0xD0, 0x40, 0x30, 0x10, 0x90, 0x05, 0x40, 0x0E, 0xB0,
+0x50, 0x0F, 0x00, 0x50, 0xB0, 0x0F, 0x02, 0x40, 0x07, 0x40, 0xD0, 0xB0, 0x00, 0xA0, 0xB1, 0xA0,
+0x50, 0x00, 0x80, 0x10, 0x40, 0x00, 0xD0, 0x40, 0x00, 0x40, 0x30, 0x0F, 0x3C, 0x0F, 0x3A, 0x80,
+0x70, 0xD0, 0xB0, 0x01, 0x40, 0x80, 0x00, 0x30, 0xB0, 0xA0, 0x80, 0x02, 0xA1, 0x80, 0x09, 0x40,
+0x02, 0x40, 0xB0, 0x02, 0x10, 0x50, 0x03, 0x81, 0x00, 0xA0, 0xB0, 0x90, 0x04, 0x40, 0x50, 0xB0,
+0x30, 0x80, 0x10, 0x90, 0x03, 0x90, 0x00, 0xB0, 0x40, 0x10, 0x30, 0x10, 0x70, 0xA0, 0x80, 0x30,
+0x05, 0x90, 0x03, 0x10, 0x40, 0xA0, 0xC0, 0xE2, 0xF0, 0x70, 0x30, 0xA0, 0x40, 0x11, 0xD0, 0x70,
+0x80, 0xB0, 0xA0, 0xE0, 0x22, 0xE0, 0xC1, 0x2C, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0xC0, 0x60, 0x2B,
+0xE0, 0x60, 0xE0, 0x2B, 0xC1, 0x22, 0x60, 0xF0, 0xC0, 0xD0, 0x90, 0x05, 0x40, 0x0E, 0x40, 0x0F,
+0x01, 0x40, 0x0F, 0x02, 0x90, 0xB0, 0x08, 0xB0, 0xD0, 0xA0, 0x50, 0x01, 0x50, 0xD0, 0x90, 0x30,
+0xA0, 0x40, 0x31, 0x01, 0x81, 0x0F, 0x3C, 0x0F, 0x39, 0x50, 0xA0, 0x00, 0x81, 0x01, 0x30, 0x80,
+0xA0, 0x80, 0xA0, 0xB0, 0x30, 0x90, 0x00, 0x50, 0x11, 0x40, 0x09, 0xB0, 0x40, 0x00, 0x41, 0x03,
+0x10, 0x70, 0x03, 0x10, 0xB0, 0x50, 0x40, 0x00, 0x40, 0x03, 0x30, 0x10, 0xA0, 0x01, 0x51, 0x05,
+0x40, 0xD0, 0x12, 0xD0, 0x10, 0xD0, 0x30, 0x70, 0x05, 0x40, 0x03, 0x11, 0xF0, 0xE1, 0x20, 0xE0,
+0xA0, 0x50, 0x10, 0xA0, 0x00, 0x40, 0x10, 0xA0, 0x70, 0x80, 0x70, 0x60, 0xE0, 0x23, 0xC1, 0x2B,
+0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0xC1, 0x2B, 0xE0, 0x60, 0x23, 0xE2, 0xC0,
+0x30, 0x04, 0x50, 0xB0, 0x0D, 0xB0, 0x90, 0x0F, 0x00, 0x40, 0xB0, 0x0F, 0x02, 0x40, 0x0B, 0xA0,
+0x30, 0x01, 0xA0, 0xB0, 0x80, 0xA0, 0x00, 0xB0, 0xD0, 0x01, 0xB0, 0x10, 0x00, 0x80, 0x30, 0x90,
+0x0F, 0x39, 0x0F, 0x39, 0x50, 0xA0, 0x00, 0x71, 0x10, 0x50, 0x80, 0x10, 0x80, 0x10, 0xB0, 0x01,
+0x30, 0x80, 0x10, 0xB0, 0x80, 0x0B, 0x50, 0xB0, 0x51, 0x03, 0xB0, 0x03, 0x70, 0x90, 0x00, 0x30,
+0x02, 0x40, 0x10, 0x50, 0xB0, 0x70, 0x0B, 0x90, 0x01, 0xB0, 0x01, 0xD0, 0x70, 0x80, 0xA0, 0x50,
+0x04, 0x90, 0xB0, 0x52, 0xD0, 0x10, 0x60, 0xE0, 0x21, 0xE0, 0xF0, 0x80, 0xD0, 0x00, 0x50, 0x40,
+0x71, 0xA0, 0x80, 0x70, 0xE1, 0x23, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0xC1,
+0x2B, 0xC1, 0x2B, 0xE0, 0x60, 0x25, 0xE0, 0x60, 0x10, 0xB0, 0x03, 0x40, 0x0E, 0x40, 0x0F, 0x00,
+0xB0, 0x40, 0x0F, 0x02, 0x40, 0x0D, 0x80, 0xD0, 0x30, 0x50, 0x01, 0xD0, 0x30, 0xB0, 0xA0, 0x01,
+0xD0, 0x40, 0x00, 0x30, 0xB0, 0x30, 0x0F, 0x39, 0x0F, 0x3C, 0xB0, 0x00, 0x50, 0x70, 0x00, 0x31,
+0x11, 0x01, 0xA1, 0x0D, 0x50, 0x70, 0x80, 0x0A, 0x40, 0x80, 0x00, 0xA0, 0x01, 0xB0, 0x50, 0x30,
+0xD0, 0x02, 0x40, 0xB0, 0x08, 0xB0, 0x90, 0x03, 0x40, 0x10, 0x30, 0xA0, 0xD0, 0x05, 0x40, 0x12,
+0x70, 0x30, 0x60, 0xE0, 0x21, 0xE0, 0xA0, 0xB0, 0x50, 0x70, 0x30, 0xF0, 0xE0, 0xC1, 0x60, 0xA0,
+0x10, 0xE0, 0x23, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xC1, 0x2B, 0xC1, 0x2A, 0xE0, 0x60, 0xC0,
+0x2B, 0xC0, 0x60, 0x25, 0xC0, 0x70, 0x30, 0x03, 0xB0, 0x50, 0x0D, 0xB0, 0x50, 0x0F, 0x00, 0x40,
+0x0F, 0x02, 0x90, 0xB0, 0x0E, 0x50, 0xD0, 0xB0, 0x00, 0x80, 0x10, 0xA0, 0x31, 0x70, 0xD0, 0x90,
+0x01, 0xB0, 0x80, 0xB0, 0x0F, 0x39, 0x0F, 0x3E, 0x90, 0x31, 0x40, 0x00, 0x90, 0x10, 0xA0, 0x70,
+0x80, 0x0E, 0xB0, 0x10, 0xD0, 0x40, 0x0C, 0x31, 0x10, 0xD0, 0x00, 0x40, 0x03, 0x40, 0x50, 0x09,
+0x40, 0x02, 0xB0, 0xA0, 0x10, 0xD0, 0xA0, 0x06, 0x90, 0xB0, 0x02, 0x80, 0xD0, 0xF0, 0x21, 0xE0,
+0x70, 0xB0, 0x30, 0x70, 0x80, 0x30, 0xC0, 0xE0, 0xF1, 0x80, 0xA0, 0xF0, 0xE0, 0x22, 0xE0, 0x60,
+0xC0, 0x2A, 0xE0, 0x60, 0x2B, 0xC1, 0x2B, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0x2C, 0xC1, 0x25, 0xC0,
+0xA0, 0x04, 0x90, 0xB0, 0x0D, 0x90, 0xB0, 0x0E, 0x51, 0x0F, 0x01, 0x50, 0x90, 0x0F, 0x01, 0x80,
+0x10, 0x80, 0x10, 0x70, 0x00, 0xB0, 0xA0, 0x90, 0x0F, 0x40, 0x0F, 0x3C, 0xA0, 0x71, 0xA1, 0x50,
+0x01, 0x30, 0x10, 0x40, 0x0F, 0x01, 0x40, 0xA0, 0x51, 0x03, 0x50, 0x70, 0x40, 0x30, 0xB0, 0x01,
+0xB0, 0x80, 0x40, 0x10, 0x50, 0x00, 0x50, 0xB0, 0x0E, 0xB0, 0x50, 0x01, 0x70, 0x30, 0x80, 0x70,
+0x05, 0x50, 0x00, 0x50, 0x90, 0x50, 0x90, 0x80, 0xD0, 0x30, 0xF0, 0xE2, 0xD0, 0x00, 0x90, 0x30,
+0x70, 0x30, 0x70, 0xE0, 0xF0, 0xA0, 0x80, 0xD1, 0x23, 0xE0, 0xC1, 0x2A, 0xE0, 0x60, 0x2B, 0xC1,
+0x2A, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0xE0, 0x2B, 0x60, 0xE0, 0x24, 0xE1, 0x30, 0x04, 0x40, 0x0E,
+0x90, 0x0F, 0x00, 0x40, 0x0F, 0x02, 0x40, 0x0F, 0x02, 0xA0, 0x00, 0xD0, 0x10, 0x02, 0xA1, 0x50,
+0x0F, 0x3F, 0x0F, 0x3D, 0xB0, 0x30, 0x50, 0x00, 0xA0, 0xB0, 0x50, 0xD0, 0x50, 0x90, 0x0A, 0x40,
+0x90, 0x03, 0x90, 0xB0, 0x00, 0x80, 0x30, 0x40, 0x00, 0xB0, 0x30, 0x11, 0x80, 0x02, 0x50, 0x40,
+0x04, 0x40, 0x0C, 0x40, 0x10, 0x90, 0x40, 0x00, 0x80, 0xA0, 0xB0, 0xA0, 0x50, 0x80, 0x30, 0x01,
+0x80, 0x70, 0xA2, 0xF2, 0x70, 0x80, 0xF1, 0xE0, 0x20, 0xE0, 0x70, 0x00, 0x70, 0x10, 0xC0, 0xF0,
+0x60, 0xE1, 0x60, 0x70, 0xD0, 0x70, 0xC0, 0x23, 0xC0, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0x2B, 0xC0,
+0x60, 0x2A, 0xE0, 0x60, 0xE0, 0x2B, 0x60, 0xE0, 0x2B, 0x60, 0xE0, 0x25, 0xE0, 0x70, 0x03, 0xB0,
+0x50, 0x0D, 0x90, 0xB0, 0x0E, 0x90, 0xB0, 0x0F, 0x01, 0x40, 0x0F, 0x02, 0xB0, 0x80, 0xB0, 0x50,
+0x30, 0xA0, 0x00, 0xA0, 0x50, 0x00, 0xA0, 0x90, 0x0F, 0x3E, 0x0F, 0x3D, 0xD0, 0x40, 0x02, 0x11,
+0x40, 0x00, 0xB0, 0x40, 0x09, 0x90, 0x40, 0x07, 0xA0, 0xD0, 0xA0, 0x70, 0x30, 0x00, 0x50, 0xB1,
+0x51, 0x30, 0x11, 0x03, 0xB0, 0x50, 0x00, 0x70, 0x40, 0x01, 0xB0, 0x40, 0x04, 0x80, 0x50, 0x00,
+0xB0, 0x80, 0xA0, 0xE0, 0x60, 0xD0, 0x40, 0x10, 0x70, 0x00, 0xF0, 0x70, 0xE3, 0xC0, 0xE0, 0xC0,
+0xE0, 0x61, 0xE0, 0x20, 0xE0, 0x60, 0x71, 0xA0, 0xF0, 0xB0, 0x60, 0xE0, 0xC0, 0x20, 0xE1, 0xC1,
+0xE0, 0x24, 0x60, 0xE0, 0x28, 0xE1, 0x60, 0x2A, 0xE0, 0xC1, 0xE0, 0x27, 0xE0, 0x20, 0xE0, 0x60,
+0xE1, 0x29, 0xC1, 0x2B, 0xC0, 0x60, 0xE7, 0xC0, 0x12, 0xD0, 0x90, 0x0E, 0x40, 0x0E, 0xB0, 0x90,
+0x0F, 0x01, 0x51, 0x0F, 0x03, 0x30, 0x90, 0x01, 0x40, 0x10, 0x50, 0x02, 0xD0, 0x80, 0x0F, 0x3D,
+0x0F, 0x3B, 0xB0, 0xA0, 0x00, 0x30, 0x90, 0x00, 0x30, 0xA0, 0x30, 0x90, 0x01, 0x50, 0x90, 0x0A,
+0x50, 0x02, 0xB0, 0x91, 0x40, 0x80, 0x70, 0xD1, 0x11, 0x31, 0x81, 0x40, 0xD0, 0x80, 0x40, 0x10,
+0x80, 0x02, 0x50, 0xD0, 0xA0, 0x10, 0x90, 0x01, 0x40, 0x02, 0x10, 0x90, 0x03, 0x80, 0xC0, 0xE0,
+0x60, 0xF0, 0x71, 0x10, 0x30, 0xF0, 0xE2, 0x20, 0xE0, 0x60, 0xA0, 0x70, 0x60, 0xE1, 0x22, 0x60,
+0xD0, 0x40, 0xA0, 0x70, 0x10, 0x60, 0xA0, 0x10, 0xD0, 0xE4, 0x24, 0x60, 0xE0, 0x25, 0xE4, 0xC8,
+0x62, 0xC0, 0x61, 0xC0, 0x60, 0xC9, 0x60, 0xE2, 0x27, 0xE0, 0xC0, 0x2B, 0xE0, 0x60, 0x20, 0xE0,
+0xA0, 0x10, 0x70, 0xA0, 0xC0, 0xA0, 0x70, 0xD0, 0x30, 0xB1, 0x00, 0x40, 0x0D, 0x90, 0xB0, 0x0E,
+0x40, 0x0F, 0x01, 0xB0, 0x40, 0x0D, 0x50, 0x04, 0x40, 0x30, 0x02, 0x40, 0xD0, 0xB0, 0x00, 0xA0,
+0x50, 0x81, 0x0F, 0x3C, 0x0F, 0x3A, 0x50, 0x70, 0x02, 0x30, 0xA1, 0x00, 0x80, 0xB0, 0x02, 0x90,
+0xB0, 0x08, 0x50, 0x70, 0x31, 0xA0, 0x30, 0x10, 0x30, 0x51, 0x40, 0x90, 0xB0, 0x80, 0x50, 0x04,
+0x30, 0x01, 0x70, 0xD0, 0x01, 0x50, 0x30, 0x81, 0xD0, 0x90, 0x01, 0xA0, 0x02, 0x10, 0x40, 0x03,
+0x40, 0x62, 0xD0, 0xE0, 0xF0, 0xA0, 0xF1, 0x60, 0xE2, 0x60, 0xD0, 0x40, 0xA0, 0x30, 0xD0, 0xC0,
+0x21, 0xE1, 0xC0, 0x12, 0x30, 0xC0, 0x61, 0xE0, 0x60, 0xD0, 0xF0, 0x70, 0xF0, 0xE0, 0x23, 0x60,
+0xE0, 0x24, 0xC1, 0x65, 0xC8, 0x20, 0xC1, 0x60, 0xCB, 0x64, 0xC1, 0x24, 0xE0, 0x60, 0x2B, 0xE0,
+0x60, 0xE0, 0xA0, 0x10, 0x70, 0x50, 0xB0, 0xA0, 0xD1, 0xA0, 0x80, 0x01, 0x51, 0x0D, 0x40, 0x0E,
+0xB0, 0x90, 0x0F, 0x01, 0x40, 0x0D, 0xB0, 0x40, 0x03, 0x40, 0x00, 0x90, 0xA0, 0x02, 0x90, 0xD0,
+0xA0, 0x50, 0x01, 0x80, 0x30, 0x0F, 0x3B, 0x0F, 0x39, 0x90, 0xA0, 0x30, 0x50, 0x01, 0x30, 0x10,
+0x90, 0x00, 0x30, 0x04, 0x40, 0x03, 0x50, 0x80, 0x30, 0xA0, 0x31, 0x40, 0x50, 0x04, 0x80, 0x01,
+0x40, 0x06, 0x80, 0xA0, 0x05, 0x10, 0xD0, 0x30, 0xB0, 0x02, 0x50, 0xD0, 0x01, 0xB0, 0x10, 0x50,
+0x03, 0xA0, 0x40, 0x60, 0xC0, 0x10, 0xC0, 0xE2, 0x60, 0x20, 0xE0, 0xF0, 0x70, 0x80, 0x00, 0x50,
+0x11, 0x80, 0x10, 0xE1, 0xC0, 0x70, 0xA0, 0x70, 0x11, 0xA0, 0xC1, 0xF0, 0xA0, 0xD0, 0x30, 0xD0,
+0x70, 0xA0, 0xE4, 0x66, 0xC1, 0x22, 0xE0, 0xC1, 0xE0, 0x21, 0xE0, 0x25, 0xE0, 0xC1, 0xE0, 0x2A,
+0x60, 0xE1, 0x21, 0xC1, 0x66, 0xE2, 0x27, 0xE1, 0xC0, 0x60, 0x70, 0x04, 0x80, 0x70, 0x11, 0x30,
+0x00, 0x40, 0x0D, 0x51, 0x0E, 0x40, 0x0F, 0x01, 0x90, 0x50, 0x0F, 0x03, 0x40, 0xB0, 0x01, 0x90,
+0x40, 0x02, 0xB0, 0x10, 0xB0, 0x01, 0xA0, 0x80, 0x30, 0x0F, 0x3A, 0x0F, 0x38, 0x40, 0x30, 0x01,
+0xA0, 0x50, 0x70, 0xD0, 0x10, 0x01, 0xA0, 0x04, 0x90, 0x30, 0x80, 0x30, 0xA0, 0x80, 0x50, 0x40,
+0xB1, 0x05, 0x12, 0x01, 0xB0, 0x40, 0x04, 0xB0, 0x12, 0xD0, 0x03, 0x90, 0x00, 0x30, 0x80, 0x02,
+0xD0, 0xA0, 0x02, 0x10, 0x80, 0x03, 0x10, 0xD0, 0x80, 0x70, 0x80, 0x10, 0xA0, 0xC0, 0xE0, 0x20,
+0xE0, 0xF0, 0x70, 0x90, 0x01, 0xB0, 0x90, 0x00, 0x80, 0xD0, 0xE1, 0x70, 0x40, 0x80, 0x30, 0xD0,
+0x71, 0xE0, 0x60, 0xF0, 0x70, 0x80, 0x00, 0xD0, 0xF0, 0xE1, 0xC0, 0x63, 0xC0, 0xE4, 0x26, 0x60,
+0xE0, 0x29, 0xC0, 0x60, 0x2B, 0xC0, 0xE0, 0x25, 0xE3, 0xC0, 0x64, 0xC0, 0x21, 0xE0, 0x22, 0xE0,
+0xC0, 0xE0, 0xF0, 0x90, 0x05, 0x50, 0xA0, 0x71, 0x40, 0x90, 0x0D, 0x40, 0x0E, 0x51, 0x0F, 0x00,
+0xB0, 0x90, 0x0D, 0x41, 0x02, 0x40, 0xB0, 0x02, 0xB0, 0x30, 0x04, 0x10, 0x40, 0x30, 0x50, 0x00,
+0x50, 0xA0, 0x0F, 0x39, 0x0F, 0x37, 0x90, 0x10, 0x50, 0x02, 0x10, 0xA0, 0x10, 0x90, 0x01, 0x30,
+0xB0, 0x90, 0x30, 0xA1, 0x80, 0x50, 0x40, 0x02, 0x80, 0x10, 0x70, 0x10, 0xD0, 0xA0, 0x03, 0xD0,
+0xB1, 0xA0, 0xB0, 0x00, 0x51, 0x04, 0x90, 0x30, 0x90, 0xA0, 0xB0, 0x03, 0x40, 0x80, 0xB0, 0x50,
+0x01, 0xD0, 0x70, 0x02, 0xB0, 0x03, 0x40, 0x10, 0x90, 0xA0, 0x80, 0x00, 0xB0, 0x10, 0x60, 0xE3,
+0xD0, 0x90, 0x01, 0x40, 0x70, 0xA0, 0x30, 0x10, 0x60, 0xF1, 0xD0, 0x30, 0x40, 0x90, 0x70, 0xF0,
+0xE0, 0x61, 0xD0, 0xA1, 0x80, 0x61, 0xA0, 0xF0, 0xE0, 0x20, 0xE1, 0x60, 0xE0, 0x2A, 0x60, 0xE0,
+0x29, 0xC0, 0x60, 0x2B, 0xC0, 0xE0, 0x29, 0xE0, 0x60, 0xE0, 0x22, 0xC0, 0x62, 0xC1, 0x20, 0xE0,
+0x60, 0xE0, 0x40, 0x70, 0x07, 0x90, 0xA1, 0xB0, 0x0C, 0x51, 0x0E, 0x40, 0x0F, 0x01, 0x40, 0x04,
+0x50, 0x30, 0x50, 0xB0, 0x09, 0x51, 0x04, 0xA0, 0x05, 0xD0, 0x30, 0x02, 0x70, 0x30, 0x0F, 0x38,
+0x0F, 0x36, 0x90, 0x30, 0x00, 0xA0, 0x50, 0x00, 0x10, 0xB0, 0xD0, 0x50, 0x02, 0x70, 0x30, 0x40,
+0x50, 0x03, 0xB0, 0x90, 0xB0, 0x90, 0x11, 0x70, 0x11, 0xA0, 0x06, 0xD1, 0x50, 0x00, 0x40, 0x04,
+0x50, 0x40, 0x03, 0x30, 0x00, 0x50, 0x10, 0xA0, 0x00, 0x40, 0x01, 0x90, 0xD0, 0x07, 0x90, 0x30,
+0xD0, 0x70, 0x00, 0x50, 0xD0, 0x30, 0xA0, 0x70, 0xD0, 0x70, 0xA0, 0x40, 0x70, 0xA0, 0x70, 0x10,
+0xA0, 0x80, 0xF0, 0xE0, 0xC0, 0x60, 0x70, 0x10, 0xD0, 0x60, 0xF0, 0x30, 0x70, 0xC1, 0x81, 0x40,
+0xA0, 0x60, 0xE0, 0x60, 0x70, 0x60, 0xE1, 0x21, 0x60, 0x2A, 0xE0, 0x60, 0xE0, 0x29, 0xC0, 0x60,
+0x2A, 0xC1, 0xE0, 0x28, 0xE0, 0xC1, 0xE0, 0x22, 0xE3, 0xC1, 0xF0, 0x61, 0x90, 0xA0, 0x10, 0x40,
+0x07, 0x40, 0xA1, 0x0C, 0x40, 0x0E, 0x90, 0xB0, 0x0F, 0x00, 0x90, 0xB0, 0x04, 0x90, 0xD0, 0x32,
+0x50, 0xB0, 0x05, 0xB0, 0x40, 0x05, 0x80, 0x90, 0x05, 0x70, 0x80, 0x00, 0x30, 0x51, 0x30, 0x0F,
+0x37, 0x0F, 0x35, 0x40, 0xA0, 0x02, 0x30, 0x10, 0xB0, 0x00, 0x10, 0x40, 0x02, 0x30, 0x06, 0xB0,
+0xD1, 0x10, 0xD1, 0x70, 0x00, 0x90, 0x07, 0xB0, 0x11, 0x70, 0x00, 0x40, 0x03, 0x90, 0x40, 0x01,
+0x40, 0x10, 0x70, 0x00, 0xB0, 0x50, 0x01, 0xB0, 0x50, 0x40, 0xB1, 0x04, 0x80, 0x13, 0x32, 0x70,
+0x10, 0xD0, 0xB1, 0x40, 0x00, 0x80, 0x70, 0xA1, 0x30, 0x81, 0x70, 0x10, 0x80, 0xF0, 0xD0, 0x91,
+0x10, 0x80, 0xA0, 0x30, 0x80, 0xF0, 0x30, 0x70, 0x30, 0x70, 0x60, 0x50, 0xA0, 0x70, 0x10, 0xD0,
+0x30, 0xE2, 0x60, 0x2A, 0xE0, 0x60, 0xE0, 0x29, 0xC0, 0x60, 0x2A, 0xC1, 0x2A, 0x60, 0xC0, 0x25,
+0xE1, 0x60, 0x71, 0xC0, 0xA0, 0x30, 0x70, 0x90, 0xB0, 0x03, 0xD0, 0xB0, 0x02, 0x90, 0x30, 0x80,
+0x0A, 0x51, 0x0D, 0xB0, 0x90, 0x0F, 0x00, 0xB0, 0x90, 0x06, 0xB0, 0x80, 0xA0, 0x41, 0x31, 0x03,
+0xB0, 0x40, 0x07, 0xA0, 0x06, 0xD0, 0x70, 0x50, 0x01, 0x90, 0xA0, 0x0F, 0x36, 0x0F, 0x2A, 0xB0,
+0x90, 0x07, 0x40, 0x31, 0x50, 0x00, 0xB0, 0xD0, 0xB0, 0x05, 0xB0, 0x30, 0x06, 0xA0, 0x70, 0x50,
+0xB0, 0x00, 0x70, 0xA0, 0xD0, 0x40, 0x09, 0x90, 0x01, 0x51, 0x02, 0x41, 0x01, 0x90, 0x07, 0x40,
+0x10, 0xB0, 0x05, 0x90, 0x70, 0xA0, 0x40, 0x80, 0xA0, 0x90, 0xA0, 0x40, 0xD0, 0x90, 0x04, 0xA0,
+0x10, 0xF0, 0x80, 0x90, 0x00, 0x40, 0x00, 0xA0, 0x40, 0xA0, 0x40, 0x30, 0xA0, 0x80, 0xA0, 0x80,
+0xA0, 0x40, 0xD0, 0x30, 0x90, 0xF0, 0xD0, 0xA0, 0xD0, 0x82, 0x11, 0xA0, 0xE0, 0x60, 0x2A, 0xE0,
+0x60, 0xE0, 0x29, 0xC0, 0x60, 0x2A, 0xC1, 0x2A, 0x60, 0xE0, 0x25, 0xE0, 0xF0, 0x10, 0x00, 0xA0,
+0x90, 0x70, 0xB1, 0x00, 0x50, 0x40, 0x90, 0x50, 0x40, 0x10, 0x70, 0x01, 0x50, 0xB0, 0x0C, 0x40,
+0x0E, 0x40, 0x0F, 0x01, 0x40, 0x0A, 0x80, 0xA0, 0x00, 0xD0, 0x10, 0x50, 0x01, 0x40, 0x08, 0x30,
+0x07, 0x70, 0x80, 0x01, 0xA0, 0x80, 0xA0, 0x0F, 0x35, 0x0F, 0x29, 0xB0, 0x80, 0x41, 0x05, 0x90,
+0x30, 0x01, 0x30, 0x50, 0x10, 0x40, 0x70, 0xB0, 0x04, 0xB0, 0x30, 0x04, 0xB0, 0x30, 0x10, 0x80,
+0x00, 0x80, 0xA0, 0xD0, 0xB0, 0xF0, 0x10, 0xD1, 0xA0, 0x40, 0x05, 0x30, 0x02, 0x90, 0xB0, 0x01,
+0x40, 0x90, 0x04, 0x91, 0x03, 0x50, 0xD0, 0x0B, 0x80, 0x11, 0xA0, 0xD0, 0x02, 0x50, 0x90, 0x30,
+0xF0, 0xE0, 0x60, 0xA0, 0x40, 0x00, 0xB0, 0x90, 0x70, 0xE0, 0x30, 0xA0, 0x31, 0xA0, 0x40, 0x70,
+0x50, 0x90, 0x60, 0x40, 0xA0, 0xD0, 0x50, 0x71, 0x02, 0x50, 0x30, 0xD0, 0xF0, 0xC1, 0x29, 0xE0,
+0x60, 0x2A, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x24, 0xE1, 0x11, 0x00, 0x90, 0x30,
+0x60, 0xA0, 0x50, 0x00, 0x40, 0x01, 0xB0, 0x91, 0x70, 0x90, 0x00, 0x40, 0x0C, 0xB0, 0x90, 0x0D,
+0xB0, 0x50, 0x0F, 0x00, 0x40, 0xB0, 0x0B, 0xB0, 0x30, 0x80, 0x50, 0x30, 0xB0, 0x40, 0xB0, 0x08,
+0xA0, 0x08, 0xA0, 0x80, 0x30, 0x50, 0x00, 0x50, 0x30, 0x0F, 0x34, 0x0F, 0x29, 0xB0, 0x30, 0x80,
+0x90, 0x04, 0x90, 0x10, 0xB0, 0x01, 0xB0, 0x10, 0xD0, 0x30, 0x90, 0x05, 0xB0, 0x80, 0x03, 0x40,
+0x11, 0x40, 0x00, 0x80, 0xD0, 0x40, 0x90, 0xF0, 0xD0, 0x30, 0xB0, 0xA0, 0x10, 0xA0, 0x0A, 0x40,
+0x01, 0x40, 0x50, 0x04, 0x70, 0xD0, 0x03, 0x40, 0x70, 0xB0, 0x0B, 0x90, 0xB0, 0x50, 0x30, 0x70,
+0x30, 0x80, 0x70, 0xF0, 0xC0, 0xE2, 0x60, 0xA0, 0x30, 0x50, 0x80, 0xF1, 0x70, 0xB0, 0x00, 0x80,
+0xD1, 0x10, 0x90, 0x71, 0x90, 0xD0, 0x80, 0x00, 0x40, 0xB0, 0x01, 0x80, 0x70, 0x10, 0xD1, 0x70,
+0xC0, 0xE0, 0x29, 0x60, 0x2A, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x22, 0xE1, 0xF0,
+0xA0, 0x70, 0xD0, 0xA0, 0xF0, 0xA0, 0xE0, 0xC0, 0xA1, 0xD0, 0x03, 0x80, 0xD1, 0x80, 0x90, 0x0C,
+0x40, 0x0E, 0x40, 0x0F, 0x00, 0x51, 0x0E, 0x82, 0x30, 0xB0, 0x08, 0x50, 0x80, 0x09, 0x70, 0xA0,
+0x02, 0xA0, 0x30, 0x0F, 0x33, 0x0F, 0x2B, 0x50, 0x04, 0x90, 0x30, 0x00, 0x70, 0xB0, 0x00, 0x10,
+0x40, 0x30, 0x07, 0xB0, 0x80, 0x01, 0xB0, 0x70, 0x10, 0x90, 0x01, 0xA0, 0xD0, 0x80, 0x30, 0x70,
+0x40, 0x02, 0xB0, 0x70, 0x01, 0xB0, 0xD0, 0x08, 0x90, 0x50, 0xA2, 0x90, 0x08, 0xD0, 0x30, 0x40,
+0x0D, 0x50, 0x70, 0xD0, 0x70, 0xF0, 0xE6, 0x90, 0x81, 0xF0, 0xE0, 0xA0, 0x90, 0x00, 0x90, 0x71,
+0x11, 0x70, 0xF1, 0x90, 0x70, 0x10, 0x30, 0x00, 0xB0, 0x50, 0x11, 0xD1, 0x41, 0x10, 0x60, 0xE0,
+0x29, 0xC1, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x2A, 0xC1, 0xE1, 0xC0, 0x70, 0xA1, 0x10, 0x91,
+0x40, 0xF0, 0xC0, 0xF0, 0xE2, 0x50, 0xD0, 0x11, 0xD0, 0x10, 0x31, 0x10, 0x90, 0x50, 0x40, 0x90,
+0xB0, 0x08, 0xB0, 0x90, 0x0D, 0x51, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x80, 0x10, 0x40, 0x80, 0x08,
+0x50, 0x80, 0x08, 0x40, 0x00, 0x70, 0x80, 0x00, 0xA0, 0x51, 0x30, 0x0F, 0x32, 0x0F, 0x27, 0x50,
+0xD0, 0x10, 0x30, 0x04, 0x50, 0xA0, 0x02, 0xA0, 0x10, 0xB0, 0x00, 0x30, 0x90, 0xB0, 0x05, 0xB0,
+0x80, 0x02, 0x30, 0x90, 0x01, 0x40, 0x70, 0xD0, 0xA0, 0x40, 0x00, 0x40, 0x07, 0x40, 0x80, 0x05,
+0x50, 0xD0, 0xF0, 0x30, 0xC2, 0xF0, 0x70, 0xD0, 0x70, 0x30, 0xB0, 0x00, 0x90, 0x40, 0xB0, 0x10,
+0x00, 0x51, 0x0A, 0x50, 0x40, 0x10, 0x70, 0xE3, 0xC0, 0xA1, 0x71, 0xF0, 0x30, 0x70, 0x60, 0x90,
+0xC0, 0xA0, 0x70, 0x00, 0xA1, 0xB0, 0xD0, 0xA0, 0x90, 0x10, 0x80, 0x70, 0xA0, 0x30, 0x10, 0x80,
+0xA0, 0x10, 0x70, 0xD0, 0x30, 0x10, 0x80, 0x00, 0x71, 0xF0, 0xE0, 0x28, 0xC1, 0x29, 0xC0, 0x60,
+0x29, 0xE0, 0x60, 0x29, 0xE0, 0xC1, 0x20, 0xC0, 0x10, 0x01, 0xD0, 0x50, 0x01, 0x70, 0xC2, 0xE0,
+0x20, 0x60, 0xE1, 0xA0, 0x50, 0x04, 0x40, 0x02, 0x90, 0x40, 0x50, 0x06, 0x90, 0x0E, 0x40, 0x0F,
+0x00, 0x40, 0x0F, 0x02, 0xB0, 0x30, 0x70, 0x30, 0x50, 0x05, 0xB0, 0x30, 0x70, 0xB0, 0x07, 0x40,
+0xB0, 0x01, 0xA0, 0x10, 0x50, 0x01, 0x90, 0xA0, 0x0F, 0x31, 0x0F, 0x27, 0x70, 0x01, 0x30, 0xD0,
+0x02, 0xB0, 0xA0, 0x30, 0x50, 0x01, 0xD0, 0xB0, 0x01, 0x30, 0x00, 0x40, 0xB0, 0x04, 0xB0, 0x80,
+0x03, 0xB0, 0x90, 0x80, 0x11, 0x90, 0x02, 0x50, 0x90, 0x06, 0xB0, 0x10, 0x04, 0x70, 0xD0, 0xF0,
+0xE0, 0x60, 0xE5, 0x60, 0x70, 0x10, 0x30, 0x10, 0x90, 0xD0, 0x40, 0x01, 0x40, 0x01, 0x80, 0x40,
+0x05, 0xA0, 0x10, 0x70, 0xA0, 0x60, 0xC0, 0xE0, 0xC0, 0xA0, 0x10, 0x80, 0x90, 0x50, 0x02, 0xB0,
+0x80, 0xF0, 0xC0, 0x70, 0x01, 0x70, 0x40, 0xE0, 0xD0, 0x80, 0x00, 0x90, 0xD0, 0x10, 0xD0, 0x80,
+0xA0, 0x10, 0xA0, 0x00, 0x80, 0xD0, 0x10, 0x30, 0x50, 0x00, 0x40, 0x70, 0xD0, 0xA0, 0xE0, 0x27,
+0xC1, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x20, 0xE1, 0xF0, 0x70, 0x50,
+0x30, 0x10, 0x71, 0xF0, 0xE0, 0x60, 0xE0, 0x21, 0x70, 0xC0, 0x60, 0x10, 0x70, 0x03, 0x51, 0x04,
+0xB0, 0x40, 0x50, 0xB0, 0x02, 0xB0, 0x90, 0x0D, 0x90, 0xB0, 0x0E, 0x50, 0xB0, 0x0F, 0x01, 0xB0,
+0x40, 0x00, 0x90, 0x70, 0x30, 0x05, 0x40, 0x80, 0x08, 0x40, 0xB0, 0x03, 0xA0, 0x80, 0x01, 0x80,
+0x31, 0x06, 0x50, 0x80, 0x0F, 0x27, 0x0F, 0x27, 0x70, 0xB0, 0x01, 0x40, 0x70, 0x01, 0xA0, 0x01,
+0x30, 0x50, 0x10, 0x50, 0x02, 0x30, 0x01, 0x40, 0xB0, 0x03, 0x50, 0x30, 0x02, 0x40, 0x10, 0x70,
+0x10, 0xA0, 0xB0, 0x04, 0x51, 0x06, 0xB0, 0x05, 0xF0, 0x60, 0xE0, 0xC0, 0x60, 0xE1, 0x22, 0xE1,
+0xF0, 0xD0, 0xF0, 0x00, 0x10, 0x50, 0x01, 0xB0, 0x90, 0x00, 0x30, 0x40, 0x06, 0xB0, 0x50, 0x10,
+0xE0, 0x60, 0xC0, 0x70, 0x50, 0xA0, 0x40, 0x02, 0x50, 0x80, 0xB0, 0x00, 0xA0, 0x90, 0xD0, 0x90,
+0x00, 0xA0, 0x30, 0xE0, 0xD0, 0xA0, 0x00, 0x40, 0x10, 0x30, 0x90, 0x80, 0x10, 0x30, 0x00, 0x70,
+0xD0, 0xA0, 0x10, 0x02, 0x10, 0x41, 0x10, 0x60, 0xE0, 0x26, 0xC1, 0x29, 0xC0, 0x60, 0x2A, 0x60,
+0xE0, 0x28, 0xE0, 0x60, 0x21, 0x60, 0x70, 0x40, 0x70, 0x10, 0xD0, 0x70, 0xE1, 0x20, 0x60, 0xE0,
+0x22, 0xE0, 0xC0, 0xD0, 0x90, 0x03, 0x40, 0x07, 0xB0, 0x91, 0xB0, 0x00, 0x90, 0xB0, 0x0C, 0xB0,
+0x90, 0x0E, 0xB0, 0x90, 0x0F, 0x02, 0x40, 0x02, 0x30, 0xA0, 0x30, 0x03, 0x50, 0xA0, 0xB0, 0x07,
+0x40, 0xB0, 0x05, 0x70, 0x40, 0x30, 0x90, 0x00, 0x80, 0x40, 0x04, 0x30, 0x70, 0xA0, 0x80, 0x0F,
+0x26, 0x0F, 0x24, 0x90, 0x01, 0x90, 0x10, 0x02, 0xA0, 0x50, 0xD0, 0x50, 0x02, 0x10, 0x50, 0x03,
+0xA0, 0x02, 0x40, 0x01, 0x40, 0xA1, 0x30, 0x03, 0xA0, 0x80, 0x50, 0x02, 0xB0, 0x80, 0x01, 0x90,
+0xA0, 0x90, 0xD0, 0x90, 0x08, 0x50, 0x70, 0xF0, 0x20, 0xE0, 0x20, 0x60, 0xC0, 0x24, 0xE1, 0xA1,
+0x70, 0xD0, 0x80, 0x50, 0x01, 0x91, 0x10, 0x90, 0x04, 0x30, 0x70, 0x80, 0x70, 0xC0, 0xE0, 0xC0,
+0xF0, 0xD0, 0x00, 0x70, 0x01, 0xD0, 0x70, 0x10, 0xD0, 0x10, 0x70, 0xD0, 0xE0, 0x70, 0x90, 0x01,
+0xA0, 0xC0, 0xF0, 0x10, 0x90, 0x50, 0x10, 0x30, 0x00, 0x41, 0x50, 0x00, 0xD0, 0x01, 0x12, 0x90,
+0x00, 0xB0, 0x70, 0xD0, 0x70, 0xE0, 0x26, 0xC1, 0x29, 0xC0, 0x60, 0x2A, 0x60, 0xE0, 0x28, 0xE0,
+0x60, 0x21, 0xE0, 0xC0, 0xE2, 0x60, 0xE0, 0x20, 0xE0, 0xC1, 0x24, 0xE0, 0x10, 0xA0, 0x03, 0x90,
+0x0A, 0x90, 0x41, 0x0D, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x02, 0x40, 0x04, 0x30, 0x40, 0x30, 0x02,
+0x30, 0x08, 0x40, 0xB0, 0x07, 0x10, 0x80, 0x02, 0x10, 0x90, 0x02, 0x90, 0x10, 0x40, 0x00, 0x70,
+0x40, 0x0F, 0x25, 0x0F, 0x24, 0x80, 0x10, 0x50, 0x00, 0x90, 0x10, 0x40, 0xB0, 0x71, 0xB0, 0xA0,
+0xB0, 0x00, 0xD0, 0x90, 0x04, 0xA0, 0x03, 0x30, 0xA0, 0x40, 0x01, 0x80, 0x02, 0xA0, 0x01, 0xB0,
+0x40, 0x30, 0xA0, 0x30, 0x40, 0xA0, 0x90, 0x70, 0x80, 0x50, 0x71, 0x04, 0xB0, 0x40, 0x90, 0x70,
+0xA0, 0xE1, 0x22, 0xE0, 0x60, 0x25, 0xE3, 0xC0, 0xD0, 0xA0, 0x02, 0xA0, 0x70, 0x03, 0x40, 0x70,
+0x90, 0xF0, 0x60, 0xE1, 0xC0, 0x40, 0x30, 0x70, 0x00, 0xA0, 0x70, 0x10, 0x30, 0x10, 0x40, 0x12,
+0x90, 0xE0, 0xF0, 0x10, 0x50, 0x00, 0x90, 0xF0, 0x60, 0x10, 0x00, 0xD0, 0xA0, 0x01, 0x90, 0xB0,
+0x80, 0x40, 0x03, 0x80, 0x00, 0xB0, 0x00, 0xB1, 0x80, 0x10, 0xC0, 0x27, 0x60, 0x29, 0xC0, 0x60,
+0x29, 0xC1, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x25, 0xE0, 0xC0, 0xD0, 0x02, 0x50, 0xB0, 0x0B,
+0x50, 0x90, 0x40, 0x50, 0x0A, 0x51, 0x0E, 0x40, 0xB0, 0x0A, 0x50, 0x42, 0x01, 0x90, 0xB0, 0x05,
+0x31, 0x02, 0xA0, 0x07, 0x40, 0xB0, 0x09, 0xD0, 0x90, 0x00, 0xA0, 0x90, 0x30, 0x90, 0x50, 0x70,
+0x01, 0x70, 0xB0, 0x0F, 0x27, 0x0F, 0x24, 0x80, 0x30, 0xD0, 0x40, 0x00, 0xB0, 0x30, 0xA0, 0xD0,
+0xB0, 0x01, 0x30, 0xD0, 0x40, 0x05, 0xA0, 0x00, 0x50, 0x30, 0xA0, 0x91, 0xB0, 0x00, 0xB0, 0x30,
+0x01, 0xB0, 0x40, 0x80, 0xA0, 0x30, 0x90, 0xB0, 0x03, 0x80, 0xA0, 0x40, 0x00, 0x40, 0xB0, 0x05,
+0x10, 0xF0, 0xC0, 0xE0, 0x26, 0x60, 0xE0, 0x26, 0xE1, 0x60, 0xF0, 0x02, 0xD0, 0x50, 0x03, 0xD0,
+0xA0, 0x11, 0x41, 0x60, 0xA0, 0xD1, 0xB0, 0x00, 0x40, 0xD0, 0x30, 0x90, 0x40, 0x00, 0x51, 0xB0,
+0xA0, 0xE0, 0x60, 0x90, 0x01, 0xA0, 0xF0, 0x70, 0x40, 0xB0, 0x10, 0x80, 0x41, 0xB0, 0x90, 0x11,
+0xA0, 0x05, 0xA0, 0x90, 0x50, 0x00, 0xA0, 0x60, 0xE0, 0x25, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x29,
+0xC1, 0x29, 0xC1, 0x29, 0xE0, 0x60, 0x22, 0x70, 0x22, 0xE0, 0xA0, 0xB0, 0x01, 0x40, 0x0C, 0x40,
+0x01, 0x50, 0x40, 0x50, 0x08, 0x40, 0x0E, 0xB0, 0x90, 0x0B, 0x10, 0xD0, 0x70, 0xA0, 0xD0, 0x81,
+0xB1, 0x50, 0x02, 0x30, 0xD0, 0x30, 0x50, 0x01, 0xA0, 0x06, 0x40, 0xB0, 0x0A, 0xB0, 0x70, 0xA0,
+0x50, 0x01, 0x30, 0x80, 0x30, 0x01, 0xD0, 0x50, 0x00, 0x90, 0x40, 0x0F, 0x24, 0x0F, 0x24, 0x40,
+0xB1, 0xD0, 0x80, 0x01, 0x80, 0x70, 0x02, 0x30, 0x80, 0x05, 0x40, 0x70, 0x80, 0x30, 0x50, 0x02,
+0x40, 0xB0, 0x00, 0x70, 0x30, 0xA0, 0x30, 0x40, 0x50, 0x08, 0xB0, 0x31, 0x50, 0x90, 0x05, 0xF0,
+0x60, 0xE0, 0x27, 0xC1, 0xE0, 0x26, 0xE1, 0xA1, 0x80, 0x90, 0x10, 0x40, 0x00, 0x80, 0x30, 0x01,
+0x50, 0x90, 0x30, 0x40, 0x70, 0x10, 0xB0, 0x40, 0x10, 0x50, 0x08, 0x40, 0xD0, 0xE0, 0xC0, 0x30,
+0x70, 0x30, 0x70, 0xA0, 0x73, 0xF1, 0x10, 0x70, 0x30, 0xD0, 0x10, 0xD0, 0xA0, 0xB0, 0x02, 0xB0,
+0x40, 0xD0, 0x40, 0x00, 0x10, 0x60, 0x26, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x29, 0xC1,
+0x2A, 0x60, 0x26, 0xE0, 0xF0, 0x90, 0x00, 0xB0, 0x90, 0x0B, 0x50, 0xB0, 0x03, 0x50, 0x40, 0x50,
+0x05, 0x50, 0xB0, 0x0E, 0x40, 0x0C, 0x10, 0x40, 0x80, 0x30, 0x90, 0x40, 0xD0, 0x12, 0x80, 0x01,
+0xB0, 0x90, 0xD0, 0xB0, 0x01, 0xA0, 0x05, 0x40, 0xB0, 0x0C, 0xB0, 0x10, 0x02, 0x80, 0xD0, 0x70,
+0x80, 0xA0, 0x70, 0xB0, 0x70, 0xA0, 0x80, 0xA0, 0x0F, 0x23, 0x0F, 0x21, 0x90, 0x30, 0xB0, 0x03,
+0xD0, 0x80, 0x40, 0x80, 0x00, 0x70, 0xB0, 0x40, 0xA0, 0x05, 0xA0, 0x81, 0x50, 0x03, 0xB1, 0x91,
+0x12, 0xD0, 0x0C, 0xB0, 0x30, 0xA0, 0x40, 0x05, 0xA0, 0xE0, 0x27, 0xE0, 0x60, 0xC0, 0xE0, 0x25,
+0xC0, 0xF0, 0xE1, 0x80, 0xA0, 0x30, 0xD0, 0xA0, 0x70, 0xA0, 0x90, 0x00, 0x91, 0x01, 0x50, 0x01,
+0x70, 0xD0, 0x30, 0xB0, 0x03, 0x50, 0x30, 0x40, 0x70, 0xD0, 0x70, 0x60, 0xE0, 0x60, 0xF0, 0x60,
+0xE0, 0x20, 0xE1, 0x60, 0xE2, 0x60, 0xF1, 0x40, 0xE0, 0x60, 0xD0, 0x11, 0x30, 0x00, 0x11, 0x40,
+0x50, 0x00, 0xA0, 0xF0, 0xE0, 0x25, 0xE0, 0x60, 0x29, 0xC1, 0x28, 0xE0, 0x60, 0xC0, 0x29, 0x60,
+0xC0, 0x20, 0xE0, 0xA0, 0xF0, 0xE0, 0x24, 0xC1, 0xE0, 0x26, 0xE0, 0x70, 0x00, 0x50, 0xB0, 0x0B,
+0x40, 0x06, 0x50, 0x40, 0xB0, 0x03, 0x40, 0x0E, 0x40, 0x0D, 0x30, 0x11, 0xD0, 0x40, 0x02, 0x90,
+0x00, 0x50, 0x03, 0x30, 0x02, 0x80, 0x50, 0x03, 0x40, 0xB0, 0x0E, 0x50, 0x10, 0x00, 0x30, 0x40,
+0x00, 0x70, 0x40, 0x90, 0x00, 0x10, 0x90, 0x01, 0x70, 0x50, 0x0F, 0x22, 0x0F, 0x20, 0x40, 0xA0,
+0x40, 0xD0, 0x04, 0x40, 0x70, 0x02, 0xD0, 0x10, 0x03, 0x40, 0x30, 0xA0, 0x40, 0x06, 0x80, 0x10,
+0x00, 0x30, 0xD0, 0x10, 0xD0, 0x0F, 0x01, 0x40, 0x30, 0x50, 0x02, 0x90, 0xF0, 0xE0, 0x29, 0x60,
+0xE1, 0x24, 0xF0, 0xA0, 0x70, 0xA0, 0xF0, 0x80, 0x90, 0x80, 0xA0, 0xD0, 0x40, 0xA0, 0x80, 0x05,
+0x40, 0x11, 0x70, 0x90, 0x02, 0xB0, 0xD0, 0x10, 0xD0, 0x30, 0x00, 0x80, 0x60, 0xE0, 0xC1, 0xE0,
+0x23, 0xE0, 0x21, 0xE1, 0xA0, 0x30, 0xF0, 0xE2, 0xC0, 0x60, 0x70, 0xD0, 0x30, 0x11, 0x30, 0x40,
+0x70, 0xE0, 0x26, 0xE0, 0x60, 0x29, 0xC1, 0x29, 0x60, 0xC0, 0x28, 0xE0, 0x60, 0xE0, 0x21, 0xE1,
+0x21, 0xE0, 0x22, 0x60, 0x20, 0xE0, 0x26, 0xE0, 0x70, 0xD0, 0x40, 0x0B, 0x51, 0x08, 0x50, 0x40,
+0xB0, 0x00, 0x40, 0xB0, 0x0D, 0x51, 0x0E, 0xB0, 0x00, 0x40, 0x0E, 0x50, 0x80, 0x02, 0x40, 0xB0,
+0x0F, 0x01, 0x50, 0x10, 0x50, 0x01, 0x40, 0xA0, 0x00, 0xD0, 0x50, 0x01, 0x50, 0xD0, 0x0F, 0x23,
+0x0F, 0x20, 0xA0, 0x50, 0x00, 0xD0, 0x71, 0xB0, 0x00, 0xB0, 0xD0, 0x10, 0xA0, 0x00, 0x90, 0xD0,
+0x80, 0xB0, 0x32, 0x90, 0xB0, 0x07, 0x50, 0x00, 0x40, 0x00, 0xA0, 0x50, 0x30, 0x02, 0x40, 0x0E,
+0x90, 0x31, 0x90, 0x00, 0x30, 0xC0, 0x29, 0xE0, 0xC0, 0x60, 0xE0, 0x23, 0xE0, 0x60, 0xD0, 0x03,
+0xF0, 0x10, 0xD0, 0xA1, 0x80, 0x02, 0xB0, 0x70, 0x80, 0x40, 0xD0, 0x40, 0xD0, 0x30, 0xB1, 0x02,
+0x30, 0x10, 0xA1, 0x00, 0xF0, 0x60, 0xE0, 0x20, 0x60, 0xE0, 0x24, 0xE1, 0x70, 0xF0, 0x30, 0x00,
+0x30, 0xD0, 0x60, 0xE1, 0x70, 0x90, 0x80, 0x10, 0xD0, 0x80, 0x31, 0x60, 0xE0, 0x26, 0xE0, 0x60,
+0x29, 0xC1, 0x29, 0x60, 0xC0, 0xE0, 0x27, 0xE0, 0x60, 0x26, 0xF0, 0x22, 0x60, 0xE0, 0x25, 0xE3,
+0xA0, 0x70, 0x11, 0x40, 0x08, 0x40, 0x01, 0xB0, 0x50, 0x01, 0x90, 0x04, 0x90, 0x40, 0x90, 0x0D,
+0xB0, 0x40, 0x0F, 0x01, 0x40, 0x0F, 0x00, 0x30, 0x50, 0x01, 0x40, 0xB0, 0x0F, 0x03, 0x40, 0xA0,
+0x00, 0x90, 0x11, 0x80, 0x70, 0x01, 0x90, 0x10, 0xB0, 0x50, 0x30, 0x40, 0x0F, 0x20, 0x0F, 0x20,
+0x40, 0x90, 0xB0, 0x80, 0x00, 0x80, 0x30, 0x00, 0x70, 0x00, 0x80, 0x10, 0x73, 0x30, 0xA0, 0x50,
+0x0A, 0x70, 0xB0, 0x00, 0xB0, 0x70, 0x30, 0x50, 0xB0, 0x00, 0x40, 0x10, 0x01, 0x50, 0x80, 0x0B,
+0x90, 0x50, 0x80, 0x30, 0x70, 0xE0, 0x2B, 0x60, 0xC0, 0x22, 0xE0, 0xF1, 0xB0, 0x03, 0xA0, 0x80,
+0xA0, 0x80, 0xD0, 0x90, 0x01, 0xB0, 0xD0, 0xF0, 0x71, 0x60, 0x80, 0x10, 0x41, 0x80, 0x02, 0x11,
+0x90, 0x10, 0x80, 0xA0, 0xE0, 0x20, 0xE0, 0x60, 0x24, 0xE1, 0x70, 0x11, 0x40, 0x00, 0x50, 0xB0,
+0xA0, 0xF1, 0x10, 0x80, 0x00, 0x40, 0x30, 0x81, 0x30, 0xA0, 0xF0, 0xE3, 0x22, 0xE0, 0xC1, 0x28,
+0xC1, 0x29, 0x60, 0xE1, 0x27, 0xE0, 0x60, 0xE0, 0x25, 0x70, 0x22, 0x60, 0xE0, 0x25, 0xA0, 0xE2,
+0xC0, 0x60, 0x80, 0x70, 0xD0, 0x70, 0x50, 0x05, 0xB0, 0x50, 0x01, 0xD0, 0x40, 0x00, 0xB0, 0xD0,
+0x05, 0x41, 0x50, 0x0C, 0x40, 0x0F, 0x01, 0x90, 0xB0, 0x0B, 0x50, 0x80, 0x50, 0x40, 0x30, 0x01,
+0x90, 0xB0, 0x0F, 0x05, 0xA0, 0x70, 0x10, 0xD0, 0xB0, 0x80, 0xD0, 0x30, 0xA0, 0xD0, 0xB0, 0x00,
+0x30, 0xB0, 0x30, 0x0F, 0x20, 0x0F, 0x25, 0x50, 0x30, 0xA0, 0xB0, 0x01, 0x90, 0x10, 0x30, 0x80,
+0x01, 0x80, 0xB0, 0x0E, 0x10, 0x80, 0x00, 0x40, 0x00, 0x70, 0x10, 0x00, 0xB0, 0xD0, 0x30, 0x0C,
+0x40, 0x00, 0x90, 0xA0, 0xE0, 0x2B, 0xE0, 0x60, 0xE0, 0x21, 0xE0, 0xC0, 0xA1, 0x50, 0x01, 0xB0,
+0xA0, 0x61, 0xE0, 0x60, 0xA0, 0xD0, 0x30, 0x70, 0xE3, 0x50, 0x90, 0x70, 0xA0, 0x10, 0x80, 0xB0,
+0x01, 0x50, 0x90, 0x00, 0x10, 0xF0, 0xE0, 0x21, 0xE0, 0xC1, 0xE0, 0x22, 0xE0, 0x60, 0x10, 0xA0,
+0x10, 0x01, 0x40, 0x00, 0xB0, 0x41, 0x05, 0xD0, 0x50, 0x40, 0x10, 0xF0, 0xE0, 0x60, 0xC0, 0xE3,
+0x60, 0x29, 0xC1, 0x29, 0x60, 0xE0, 0x27, 0xE1, 0xC0, 0xE1, 0x24, 0xE0, 0x20, 0xE0, 0x60, 0xC0,
+0x26, 0x60, 0xF0, 0x60, 0xE0, 0x60, 0xE1, 0x70, 0x41, 0x06, 0x40, 0x02, 0x10, 0x50, 0x01, 0xD0,
+0x04, 0x51, 0x00, 0x50, 0x40, 0x0A, 0x90, 0xB0, 0x0F, 0x00, 0x90, 0x50, 0x0C, 0xA0, 0x90, 0x40,
+0x80, 0x01, 0x40, 0xB0, 0x0F, 0x06, 0x50, 0x10, 0x70, 0x02, 0x70, 0x40, 0x50, 0x02, 0xB0, 0x30,
+0x90, 0x0F, 0x20, 0x0F, 0x23, 0x80, 0x71, 0xA0, 0x40, 0x70, 0x50, 0x00, 0xD0, 0x10, 0x51, 0x01,
+0x80, 0x50, 0x06, 0x40, 0x90, 0x04, 0x40, 0x10, 0x02, 0x40, 0x50, 0xA1, 0xD0, 0xB0, 0x0E, 0x90,
+0xA0, 0xE1, 0x2D, 0x60, 0xE1, 0x60, 0xE1, 0xC0, 0x70, 0xD0, 0xB0, 0x30, 0xC0, 0xE2, 0xC1, 0xE2,
+0x21, 0x60, 0xF0, 0x10, 0xD0, 0x10, 0xA1, 0x00, 0x90, 0x01, 0x70, 0x10, 0x70, 0x60, 0xE0, 0x24,
+0x60, 0xE0, 0x21, 0xE0, 0xF0, 0x10, 0x40, 0x30, 0x11, 0x00, 0x90, 0x0A, 0x40, 0xD0, 0x10, 0xA0,
+0x70, 0x11, 0xD0, 0x60, 0xC0, 0xE0, 0xC1, 0x28, 0xC1, 0x29, 0x60, 0xE0, 0x26, 0xE0, 0xC0, 0xD0,
+0xC0, 0xF0, 0x27, 0xE0, 0x60, 0x27, 0xE0, 0x60, 0xF0, 0xC1, 0xE1, 0xA0, 0x07, 0xB0, 0x50, 0x00,
+0xA0, 0x81, 0x50, 0x00, 0x90, 0xD0, 0x04, 0x40, 0x03, 0x40, 0x90, 0x07, 0xB0, 0x40, 0x0F, 0x00,
+0x51, 0x0C, 0x90, 0x30, 0x03, 0x40, 0xB0, 0x0F, 0x06, 0xB0, 0x40, 0x80, 0xD0, 0xB0, 0x00, 0x30,
+0x40, 0xA0, 0x0F, 0x27, 0x0F, 0x24, 0x50, 0x80, 0x40, 0x01, 0x30, 0x70, 0xA0, 0x01, 0x50, 0x40,
+0x00, 0x40, 0x50, 0x06, 0x30, 0x40, 0x04, 0xA0, 0x40, 0x03, 0x40, 0xB0, 0x00, 0x10, 0x80, 0x0E,
+0xF0, 0x60, 0xE1, 0x2C, 0xE0, 0xC1, 0x70, 0x80, 0xD0, 0xE1, 0x70, 0x80, 0x30, 0xA0, 0xE0, 0x22,
+0xE0, 0x60, 0xE1, 0x21, 0xC0, 0x70, 0xA0, 0xE0, 0xA1, 0x10, 0x01, 0x90, 0x00, 0x80, 0x10, 0x70,
+0xF0, 0xE0, 0x25, 0x60, 0xE0, 0x21, 0xE0, 0x70, 0x50, 0x00, 0xB0, 0x30, 0xB0, 0x00, 0xB0, 0x50,
+0x09, 0x90, 0x40, 0xA0, 0x40, 0x10, 0x70, 0x12, 0x30, 0x10, 0xF0, 0xC0, 0xE0, 0x27, 0xC1, 0x28,
+0xE0, 0x60, 0xE0, 0x25, 0xE0, 0xA0, 0x61, 0xF0, 0xD0, 0xF0, 0x26, 0xE0, 0x60, 0xE0, 0x27, 0xE1,
+0x60, 0x20, 0xE0, 0x60, 0xF0, 0x07, 0x40, 0x01, 0x40, 0x30, 0x90, 0x07, 0x90, 0xB0, 0x04, 0xB0,
+0x40, 0x50, 0x05, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x0D, 0xA0, 0x10, 0x30, 0x01, 0x40, 0xB0, 0x0F,
+0x06, 0x50, 0x90, 0x00, 0x30, 0x00, 0xD0, 0xA0, 0x90, 0x00, 0xB0, 0xA0, 0x0F, 0x26, 0x0F, 0x24,
+0xB0, 0xD0, 0x02, 0x40, 0x70, 0x03, 0xB0, 0x42, 0x0D, 0xA0, 0x00, 0x30, 0x40, 0x02, 0x40, 0x00,
+0x50, 0x90, 0x0D, 0x50, 0xA0, 0xC1, 0xE0, 0x2D, 0xE0, 0x60, 0x70, 0x50, 0x80, 0xF0, 0xC0, 0x80,
+0xD0, 0xF0, 0xE0, 0x23, 0xE0, 0xC0, 0x60, 0xE5, 0x60, 0xD0, 0x10, 0x40, 0x02, 0x50, 0x70, 0x10,
+0xA0, 0xE0, 0x27, 0x60, 0xE0, 0x20, 0xE0, 0xD0, 0x10, 0x05, 0x40, 0x09, 0x50, 0xB0, 0x00, 0x30,
+0xD0, 0x30, 0xD0, 0x31, 0x50, 0x90, 0xF0, 0x60, 0xE0, 0x27, 0xC1, 0x28, 0xE0, 0x60, 0xE0, 0x26,
+0xF0, 0xD0, 0x90, 0x10, 0xD0, 0xC0, 0x26, 0xC0, 0x60, 0x2A, 0x60, 0x20, 0xE0, 0xF0, 0x60, 0x02,
+0xB0, 0x40, 0x70, 0x01, 0x50, 0x0B, 0xB0, 0x90, 0x07, 0x50, 0x40, 0x03, 0x90, 0xB0, 0x0F, 0x00,
+0x40, 0x0D, 0x81, 0x90, 0xD1, 0x80, 0xB0, 0x0F, 0x06, 0x91, 0x01, 0x90, 0x40, 0x90, 0x70, 0x02,
+0x31, 0x0F, 0x25, 0x0F, 0x24, 0x70, 0x50, 0x70, 0x50, 0xB0, 0x10, 0x06, 0x80, 0x40, 0x04, 0x40,
+0x70, 0x30, 0x80, 0xD0, 0x40, 0x01, 0xB0, 0xA0, 0x00, 0x90, 0x04, 0x40, 0x0F, 0x00, 0x40, 0xF0,
+0xE0, 0x60, 0xC0, 0xE0, 0x2D, 0xC0, 0x60, 0xF0, 0x70, 0xF1, 0x80, 0x10, 0xC0, 0x25, 0xE0, 0x60,
+0xC0, 0xE0, 0x70, 0xA0, 0x70, 0xC0, 0x11, 0x40, 0x03, 0x50, 0x11, 0xF0, 0xE0, 0x26, 0xE0, 0x60,
+0xE0, 0x21, 0xE0, 0xD0, 0x80, 0x04, 0x40, 0x09, 0xB0, 0x50, 0x00, 0xB0, 0x03, 0x50, 0x70, 0x10,
+0x70, 0xA0, 0xE0, 0x27, 0xC1, 0x29, 0x60, 0xE0, 0x26, 0x60, 0x10, 0x30, 0x10, 0x70, 0xC0, 0x26,
+0x60, 0xC0, 0x28, 0xE0, 0x60, 0xC0, 0x21, 0xC0, 0x70, 0xA0, 0x31, 0xA0, 0xD0, 0x70, 0x10, 0x31,
+0xB0, 0x0A, 0x40, 0x09, 0xB0, 0x40, 0xB0, 0x00, 0x50, 0x90, 0x0F, 0x00, 0x40, 0x0D, 0x40, 0x30,
+0x50, 0x80, 0x00, 0x80, 0xB0, 0x0F, 0x06, 0x40, 0x50, 0x03, 0x70, 0x00, 0x80, 0xA0, 0x00, 0xA0,
+0x40, 0x80, 0x40, 0x0F, 0x24, 0x0F, 0x23, 0x30, 0xB0, 0x01, 0x30, 0x10, 0x07, 0xB0, 0x30, 0x50,
+0x01, 0xA1, 0x80, 0x00, 0x90, 0x50, 0x40, 0xD0, 0xA0, 0x90, 0x00, 0x70, 0x50, 0x06, 0x40, 0xB0,
+0x0D, 0x30, 0xC0, 0xE1, 0x60, 0xC0, 0x2C, 0xE1, 0xC0, 0x61, 0xE1, 0xF0, 0xA0, 0xE5, 0x22, 0x60,
+0x70, 0xB0, 0x01, 0xD0, 0x71, 0x04, 0xD0, 0x80, 0x40, 0xF0, 0xE0, 0x26, 0xE0, 0x60, 0xC0, 0x22,
+0xE0, 0xD0, 0xB0, 0x03, 0x90, 0xB0, 0x09, 0x40, 0x08, 0x40, 0x70, 0xE1, 0x26, 0xC1, 0x28, 0xC1,
+0xE0, 0x25, 0xE1, 0x70, 0xD0, 0x70, 0x10, 0x70, 0xE0, 0x25, 0x60, 0xE3, 0x26, 0x60, 0xE3, 0xC0,
+0x10, 0x80, 0xA1, 0x30, 0x00, 0x30, 0xD0, 0x11, 0x09, 0x51, 0x0B, 0x50, 0x90, 0x40, 0x0F, 0x00,
+0x40, 0xB0, 0x0D, 0xB0, 0xA0, 0x00, 0xB0, 0x40, 0xB0, 0x0F, 0x06, 0x40, 0xB0, 0x03, 0x70, 0x30,
+0x01, 0x30, 0x10, 0xB0, 0x01, 0xA0, 0xB0, 0x0F, 0x23, 0x0F, 0x22, 0x40, 0xD0, 0x02, 0x70, 0xD0,
+0x08, 0xA0, 0x51, 0x81, 0x05, 0x70, 0x60, 0xF0, 0x80, 0x30, 0xB0, 0x03, 0xB1, 0x01, 0x40, 0xB0,
+0x0C, 0x70, 0xE0, 0x22, 0x60, 0x2C, 0xE1, 0x60, 0xF0, 0xC0, 0xE0, 0x20, 0xE3, 0xF0, 0xA0, 0xF0,
+0xC0, 0xE0, 0x20, 0xE0, 0xC0, 0x60, 0x30, 0x40, 0xD0, 0x11, 0x90, 0x03, 0x80, 0x10, 0xA0, 0x70,
+0xE1, 0x28, 0x60, 0xE1, 0x20, 0xE0, 0xF0, 0x90, 0x03, 0xB0, 0x50, 0x09, 0x40, 0x04, 0x90, 0xD0,
+0xA0, 0x01, 0x30, 0x60, 0xE0, 0x26, 0xC1, 0x28, 0xC1, 0x25, 0xE1, 0x61, 0x80, 0xA0, 0x70, 0xC0,
+0x26, 0x60, 0xE1, 0xF0, 0x60, 0xE0, 0x25, 0x60, 0xE1, 0xF0, 0xC0, 0xE0, 0xA1, 0x40, 0x02, 0x50,
+0xB0, 0xD0, 0xA0, 0x09, 0x40, 0x0D, 0x41, 0xB0, 0x0D, 0x40, 0xB0, 0x0F, 0x00, 0x90, 0x30, 0x50,
+0xB0, 0x0F, 0x05, 0xB0, 0x40, 0x05, 0xA0, 0x03, 0xD0, 0xB0, 0x01, 0x80, 0x70, 0x0F, 0x23, 0x0F,
+0x21, 0x50, 0x30, 0xB0, 0xA0, 0x50, 0x30, 0x80, 0x40, 0x50, 0x07, 0x30, 0x00, 0xB0, 0xA0, 0xB0,
+0x04, 0x50, 0x10, 0x60, 0xE0, 0xA0, 0x70, 0x03, 0x30, 0x11, 0x90, 0x01, 0x40, 0xB0, 0x09, 0x40,
+0x10, 0x60, 0xE0, 0x23, 0x60, 0x2A, 0xE0, 0xC0, 0xF0, 0xA0, 0xF1, 0xE1, 0x60, 0xE0, 0x60, 0xF0,
+0x60, 0xB0, 0xF0, 0x30, 0xE0, 0x20, 0xE1, 0x61, 0xF0, 0x70, 0xD0, 0x70, 0x03, 0xB0, 0xD0, 0x11,
+0x60, 0xE0, 0x28, 0xE0, 0x60, 0xE0, 0x21, 0xE0, 0x70, 0x50, 0x04, 0x40, 0x09, 0x90, 0x04, 0x80,
+0x30, 0xD1, 0xA0, 0xF0, 0x60, 0xE0, 0x26, 0xC1, 0x28, 0x60, 0x25, 0xE1, 0xF0, 0x10, 0x30, 0xD0,
+0xC0, 0x20, 0xE0, 0x24, 0xE0, 0xC1, 0xE0, 0xF0, 0xC0, 0xA0, 0xC0, 0xE0, 0x23, 0x60, 0xC0, 0xE1,
+0xD0, 0xC0, 0xE0, 0xF0, 0x10, 0xA0, 0xB0, 0x01, 0x40, 0x0B, 0x50, 0xB0, 0x0C, 0x51, 0x00, 0x91,
+0x0B, 0x51, 0x0F, 0x02, 0x80, 0x30, 0x50, 0x40, 0xB0, 0x0F, 0x02, 0x50, 0x40, 0x05, 0xB0, 0x30,
+0x04, 0xD0, 0xB0, 0x30, 0x40, 0x90, 0x30, 0x0F, 0x22, 0x0F, 0x21, 0xA0, 0x02, 0x30, 0xD0, 0x00,
+0x90, 0x40, 0x07, 0x80, 0xB0, 0x90, 0x80, 0x40, 0x04, 0x80, 0xA0, 0xE2, 0xD0, 0xA0, 0x40, 0x01,
+0x10, 0xA0, 0x10, 0x50, 0x02, 0x40, 0xB0, 0x09, 0xA0, 0xC0, 0x23, 0xE0, 0xC0, 0x60, 0xE0, 0x23,
+0xE2, 0x20, 0xE0, 0xC0, 0x60, 0xF0, 0xA1, 0x60, 0xC1, 0x10, 0xF1, 0x70, 0xB0, 0x00, 0xB0, 0x70,
+0xE0, 0x20, 0xE1, 0xC1, 0x50, 0xA0, 0x10, 0xB0, 0x03, 0x90, 0x30, 0xD0, 0xA0, 0x60, 0x2A, 0xC1,
+0xE2, 0x70, 0x05, 0x90, 0x09, 0x90, 0x06, 0x30, 0x10, 0xD0, 0x30, 0xE1, 0x26, 0xC1, 0x27, 0xE0,
+0x60, 0x26, 0x60, 0x11, 0xA0, 0xE1, 0x26, 0xE0, 0xC0, 0x20, 0xE0, 0xF0, 0x60, 0xB0, 0xF0, 0xE0,
+0x21, 0xE1, 0x60, 0xE0, 0x20, 0xE0, 0x60, 0xA0, 0x70, 0x60, 0xA0, 0xD0, 0x00, 0x30, 0xA0, 0x50,
+0x0B, 0x40, 0x0D, 0x40, 0x02, 0x50, 0x40, 0x09, 0xB0, 0x40, 0x0F, 0x02, 0x40, 0xB0, 0x50, 0x80,
+0x40, 0xA0, 0xB0, 0x0F, 0x00, 0x91, 0x06, 0x30, 0x50, 0x04, 0x40, 0x10, 0xB0, 0x01, 0x80, 0x40,
+0x0F, 0x21, 0x0F, 0x20, 0xA1, 0xB0, 0x01, 0x10, 0x01, 0xB0, 0x30, 0x07, 0x90, 0x40, 0xD0, 0x01,
+0x40, 0xB0, 0x02, 0x30, 0xF0, 0x60, 0xE1, 0x12, 0x70, 0xB0, 0x40, 0x80, 0x05, 0x40, 0xB0, 0x08,
+0x90, 0xF0, 0xE0, 0x23, 0xE0, 0xC0, 0x60, 0xE0, 0x21, 0xE0, 0x60, 0xF0, 0x60, 0x20, 0x60, 0xC0,
+0xE2, 0x60, 0xA1, 0xC0, 0xA0, 0x10, 0xC0, 0x60, 0x70, 0x80, 0x11, 0x61, 0x70, 0xA0, 0x30, 0xF1,
+0xA0, 0x04, 0x50, 0x12, 0xA0, 0xC1, 0x2A, 0x60, 0xE1, 0x10, 0x80, 0x05, 0x50, 0xB0, 0x08, 0x50,
+0xB0, 0x05, 0x30, 0xB0, 0xD0, 0x30, 0xA1, 0x26, 0xC1, 0x27, 0xE0, 0x60, 0x25, 0xE0, 0x60, 0xF0,
+0x70, 0xF0, 0xE0, 0x26, 0xE1, 0x60, 0x21, 0xC0, 0xA0, 0xB0, 0xA0, 0xE0, 0x21, 0xE0, 0xC1, 0x20,
+0xE1, 0xC0, 0xA0, 0x30, 0x11, 0x70, 0xA0, 0x10, 0x80, 0x0B, 0x90, 0xB0, 0x0C, 0x40, 0x05, 0x40,
+0x50, 0x06, 0xB0, 0x40, 0x0F, 0x02, 0x40, 0xB0, 0x03, 0xB0, 0x30, 0x0E, 0x40, 0x50, 0x06, 0xB0,
+0x30, 0x06, 0x30, 0x80, 0x01, 0x80, 0x10, 0xB0, 0x0F, 0x20, 0x0F, 0x1F, 0x41, 0x00, 0x30, 0x90,
+0xD0, 0x50, 0x02, 0xA0, 0x07, 0x80, 0x10, 0x90, 0x02, 0x40, 0x50, 0x01, 0x30, 0x00, 0xA0, 0x60,
+0xE0, 0xC0, 0x70, 0x30, 0x10, 0x30, 0x08, 0x40, 0xB0, 0x07, 0x40, 0xA0, 0xE0, 0x24, 0xE0, 0x60,
+0xC0, 0x22, 0xC0, 0xF0, 0xA0, 0x60, 0xE0, 0x60, 0xE1, 0xA0, 0xF0, 0x00, 0xA0, 0x60, 0xE0, 0xF0,
+0x20, 0xE0, 0x60, 0x10, 0x70, 0xB0, 0x10, 0xA0, 0x01, 0x70, 0x90, 0x40, 0x04, 0x90, 0xA0, 0x10,
+0x30, 0x70, 0xC0, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0xE0, 0x60, 0x30, 0x06, 0xB0, 0x90, 0x08, 0xB0,
+0x50, 0x06, 0x10, 0x70, 0x30, 0x40, 0xB0, 0x70, 0xE0, 0x24, 0xC1, 0x27, 0xE0, 0x60, 0x26, 0xE2,
+0x60, 0xE0, 0x28, 0x60, 0x20, 0xE0, 0x60, 0x80, 0x50, 0xF0, 0xE0, 0x22, 0x60, 0xE1, 0xF0, 0xA0,
+0x60, 0xF0, 0x40, 0x90, 0x31, 0x70, 0x80, 0xB0, 0x0A, 0xB0, 0x90, 0x0C, 0x90, 0xB0, 0x06, 0x91,
+0x05, 0x40, 0x0F, 0x02, 0x40, 0xB0, 0x05, 0x70, 0x0D, 0x40, 0xB0, 0x06, 0x40, 0xA0, 0xB0, 0x07,
+0x70, 0x90, 0xA0, 0x90, 0x00, 0x70, 0x0F, 0x20, 0x0F, 0x1E, 0xB0, 0x30, 0x02, 0x70, 0x30, 0x03,
+0x30, 0xB0, 0x04, 0xB0, 0x70, 0xD0, 0x05, 0x90, 0x50, 0xB0, 0x80, 0x00, 0x90, 0x10, 0xA0, 0xE0,
+0xF0, 0xC0, 0x30, 0x90, 0x09, 0x40, 0xB0, 0x06, 0x50, 0xA0, 0xE1, 0x24, 0xE0, 0x60, 0xC0, 0xE0,
+0x20, 0xE0, 0xC1, 0xE1, 0xA0, 0xD0, 0xA0, 0x80, 0x01, 0x30, 0xC0, 0x60, 0xE0, 0x21, 0xE0, 0x10,
+0x30, 0x00, 0x50, 0xB0, 0x01, 0x30, 0xD0, 0x30, 0x03, 0x40, 0x11, 0xD0, 0x10, 0xF0, 0xE1, 0xC1,
+0x29, 0xE0, 0xF0, 0x10, 0x50, 0x07, 0x40, 0x09, 0x40, 0x05, 0x10, 0x90, 0x00, 0x50, 0xB0, 0x80,
+0x30, 0xE0, 0x24, 0xC1, 0x27, 0xE0, 0x60, 0x27, 0xE0, 0xC1, 0x28, 0xC1, 0x20, 0xE0, 0xD0, 0xB0,
+0x40, 0x60, 0xE0, 0x22, 0x60, 0xE1, 0x70, 0xD0, 0x70, 0x50, 0x31, 0xA0, 0x00, 0xB0, 0x90, 0x0B,
+0x40, 0x0C, 0xB0, 0x90, 0x08, 0x50, 0x40, 0x03, 0x40, 0xB0, 0x06, 0xB0, 0x08, 0x40, 0xB0, 0x05,
+0x30, 0x90, 0x0B, 0xB0, 0x40, 0xB0, 0x07, 0xA0, 0x09, 0xB0, 0x10, 0xB0, 0x01, 0x50, 0x80, 0x0F,
+0x1F, 0x0F, 0x1E, 0xA1, 0xB0, 0x00, 0x50, 0xD0, 0x04, 0x80, 0x50, 0x04, 0x30, 0xB0, 0x07, 0x50,
+0x30, 0x90, 0x00, 0xD0, 0x70, 0x10, 0xE0, 0x70, 0xE0, 0x81, 0x0A, 0x40, 0xB0, 0x05, 0xF0, 0xD0,
+0xE0, 0x23, 0xE2, 0x20, 0x60, 0xE1, 0x61, 0xE1, 0xF0, 0xD0, 0x50, 0x03, 0x70, 0xE0, 0xC1, 0xE0,
+0x20, 0xB0, 0x10, 0xD0, 0x03, 0x30, 0x70, 0xA0, 0x40, 0x90, 0x02, 0xA0, 0x10, 0xF0, 0x70, 0xC0,
+0xE0, 0x22, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0x70, 0x40, 0x08, 0x90, 0x09, 0x40, 0x06, 0xA0, 0xD0,
+0x30, 0xD0, 0xF0, 0xE0, 0x25, 0xC1, 0x26, 0xE1, 0x60, 0x21, 0xE0, 0xF0, 0xE0, 0x22, 0xE0, 0xC1,
+0x27, 0xE0, 0x60, 0xE0, 0x20, 0xE0, 0xD0, 0x00, 0xF0, 0xC0, 0x22, 0xC1, 0x20, 0xE1, 0x10, 0xB0,
+0x01, 0x30, 0xA1, 0x30, 0xA0, 0x90, 0x03, 0x30, 0xA1, 0x90, 0x00, 0x50, 0xB0, 0x50, 0x0C, 0x40,
+0x0A, 0xB0, 0x40, 0x01, 0x90, 0xB0, 0x07, 0x10, 0x50, 0x06, 0x40, 0xB0, 0x05, 0xB0, 0xA0, 0x0B,
+0xB0, 0x40, 0x08, 0xB0, 0x30, 0x0A, 0x40, 0xA0, 0x01, 0x80, 0xD0, 0x50, 0x0F, 0x1E, 0x0F, 0x1D,
+0x80, 0x90, 0x00, 0xA0, 0x80, 0xD0, 0x05, 0x80, 0x50, 0x00, 0x40, 0x01, 0x50, 0xD0, 0x09, 0x40,
+0x80, 0x00, 0x40, 0x60, 0xE0, 0xF1, 0x50, 0xF0, 0x80, 0x0B, 0x40, 0xB0, 0x02, 0x71, 0xF0, 0xE0,
+0x21, 0xE2, 0xF0, 0xE0, 0xF0, 0xC0, 0xE0, 0x60, 0xF0, 0xA0, 0x70, 0x10, 0xD0, 0x70, 0x05, 0x70,
+0x60, 0xF0, 0x60, 0x20, 0xE0, 0x60, 0x30, 0x00, 0x30, 0xD0, 0xA0, 0x00, 0x80, 0xD1, 0x00, 0x51,
+0x00, 0x50, 0x10, 0x30, 0xB0, 0xE1, 0x23, 0x60, 0xC0, 0xE0, 0x25, 0xE1, 0x10, 0x30, 0x09, 0x51,
+0x08, 0x90, 0x06, 0x70, 0xA0, 0x70, 0xE1, 0x26, 0xC1, 0x25, 0xE1, 0x61, 0x20, 0xE0, 0xF1, 0x23,
+0xE0, 0x60, 0x29, 0x60, 0xE1, 0xC0, 0x30, 0x00, 0x30, 0xC0, 0xE0, 0x20, 0xE0, 0x60, 0xE0, 0x21,
+0xE0, 0xF0, 0x80, 0x02, 0x32, 0x40, 0xA0, 0x90, 0x01, 0xD1, 0x30, 0xD0, 0x10, 0x30, 0x10, 0x90,
+0x0C, 0x90, 0xB0, 0x0C, 0x40, 0x90, 0x50, 0x08, 0x30, 0x50, 0x05, 0x40, 0xB0, 0x06, 0xB0, 0x30,
+0x0A, 0x50, 0x90, 0x09, 0x30, 0xB0, 0x0B, 0xA0, 0x30, 0xA0, 0x50, 0x00, 0xA0, 0x0F, 0x1E, 0x0F,
+0x14, 0x50, 0x06, 0x50, 0x30, 0x02, 0x70, 0x30, 0x04, 0x30, 0xD0, 0xA0, 0x31, 0x80, 0x50, 0xA0,
+0x30, 0x08, 0x50, 0xA0, 0x00, 0x40, 0xA0, 0xE1, 0xF0, 0xC0, 0xF0, 0xA0, 0x0D, 0x90, 0x50, 0x80,
+0x70, 0xC0, 0xE1, 0x21, 0xE0, 0xC0, 0xA0, 0xF0, 0xD0, 0xE3, 0xF0, 0x80, 0x01, 0x90, 0xB0, 0x06,
+0x40, 0x70, 0xA0, 0xE0, 0x60, 0xE0, 0x10, 0x00, 0xB0, 0xD0, 0x10, 0xB0, 0x01, 0x80, 0xD0, 0x01,
+0x40, 0x00, 0x40, 0x10, 0x60, 0xE0, 0x25, 0xE0, 0x60, 0x25, 0xE1, 0x70, 0xA0, 0x00, 0x90, 0x09,
+0x90, 0x08, 0x50, 0xB0, 0x04, 0x40, 0x10, 0xD0, 0xC0, 0x60, 0x27, 0xC1, 0x23, 0xE0, 0xC0, 0x12,
+0x80, 0x70, 0xC0, 0xE0, 0x24, 0xE0, 0x60, 0x28, 0xC0, 0x60, 0xE0, 0x20, 0xC0, 0xA0, 0x00, 0x30,
+0xA0, 0xE0, 0x21, 0x60, 0x23, 0xE0, 0xF1, 0x02, 0xB0, 0x50, 0x30, 0xA1, 0x80, 0x90, 0xD0, 0x40,
+0x01, 0x40, 0x70, 0x40, 0xB0, 0x0B, 0x51, 0x0D, 0x50, 0x40, 0x50, 0x08, 0x30, 0x80, 0x40, 0x30,
+0x50, 0x01, 0x40, 0xB0, 0x05, 0xB1, 0xA0, 0x50, 0x09, 0x90, 0x50, 0x0A, 0xA0, 0x0C, 0x50, 0x10,
+0x50, 0x01, 0x50, 0x30, 0x0F, 0x1D, 0x0F, 0x13, 0x90, 0x80, 0x30, 0x05, 0xA1, 0x50, 0x00, 0x40,
+0xA0, 0x00, 0x40, 0x50, 0x01, 0xA0, 0x50, 0x00, 0xB1, 0x00, 0x40, 0x80, 0xB0, 0x30, 0xB0, 0x02,
+0x40, 0x30, 0x00, 0x41, 0xD0, 0x50, 0x00, 0x50, 0xF0, 0xC0, 0xE0, 0x70, 0xF0, 0x30, 0x0E, 0x80,
+0x70, 0x80, 0xE1, 0x23, 0xE0, 0x70, 0x11, 0xF0, 0xE1, 0xC0, 0x60, 0xA0, 0x91, 0x04, 0xB0, 0x90,
+0x03, 0xF0, 0xC0, 0xE0, 0xC0, 0xA0, 0x10, 0x01, 0x70, 0x30, 0x02, 0x80, 0x70, 0xA0, 0x00, 0xB0,
+0x50, 0xA0, 0x10, 0xC0, 0x26, 0xE0, 0x60, 0x24, 0xE0, 0xF0, 0x10, 0x70, 0x01, 0x40, 0x09, 0x40,
+0x08, 0x51, 0x04, 0x30, 0xF0, 0xC0, 0xE0, 0x60, 0xE0, 0x26, 0xC1, 0xE0, 0x21, 0xE1, 0xA0, 0xD0,
+0x81, 0xB0, 0xF0, 0xC0, 0xE0, 0x24, 0xE0, 0x60, 0x28, 0xC1, 0x21, 0xE0, 0x10, 0x00, 0xB0, 0x10,
+0xE0, 0x20, 0xC1, 0xE0, 0x23, 0xE0, 0xF0, 0x80, 0x01, 0x40, 0x01, 0x90, 0xA0, 0x30, 0xA0, 0x40,
+0xA0, 0x50, 0x02, 0x90, 0x0C, 0x40, 0x0D, 0xB0, 0x90, 0x00, 0x50, 0x90, 0x08, 0x70, 0xA1, 0xD0,
+0x00, 0x90, 0xB0, 0x06, 0xA0, 0x30, 0x40, 0x09, 0x40, 0xB0, 0x0B, 0x30, 0x0B, 0x40, 0xB0, 0x50,
+0xD0, 0x01, 0x80, 0xD0, 0x50, 0x0F, 0x1C, 0x0F, 0x13, 0x80, 0x90, 0x30, 0xB0, 0x03, 0x80, 0x90,
+0x00, 0x30, 0x80, 0x10, 0x02, 0x91, 0x41, 0x07, 0x40, 0x50, 0x02, 0x30, 0x90, 0xB0, 0x11, 0x70,
+0x10, 0x80, 0x00, 0xA0, 0xF0, 0x60, 0xA1, 0x80, 0x0D, 0x50, 0xD0, 0xA0, 0xF0, 0xC0, 0xE0, 0x21,
+0xE2, 0xF0, 0x11, 0xE1, 0xC0, 0x60, 0x90, 0xA0, 0x00, 0x51, 0x03, 0x80, 0x70, 0x02, 0x50, 0xD0,
+0xE1, 0x60, 0x30, 0x40, 0x05, 0x80, 0x12, 0x90, 0x00, 0x90, 0x40, 0x10, 0x60, 0x26, 0xE0, 0x20,
+0x60, 0xE0, 0x21, 0xE0, 0xF0, 0x10, 0xD0, 0xB0, 0x01, 0x90, 0xB0, 0x08, 0x90, 0x08, 0xB0, 0x50,
+0x03, 0x90, 0x10, 0xA0, 0xE1, 0x60, 0x27, 0xC0, 0x60, 0x20, 0xE0, 0x60, 0x72, 0x11, 0x30, 0x90,
+0x70, 0xE0, 0x25, 0xC0, 0x60, 0x27, 0xE0, 0x60, 0x22, 0xE0, 0x10, 0x50, 0xB0, 0x10, 0xE1, 0x60,
+0xE0, 0x25, 0xE0, 0xA0, 0x00, 0xB0, 0x90, 0x03, 0x80, 0x72, 0xF0, 0x70, 0x50, 0x90, 0xB0, 0x0B,
+0x40, 0xB0, 0x0D, 0x40, 0x02, 0x50, 0x90, 0x0B, 0x40, 0xB0, 0x07, 0x30, 0x0A, 0x40, 0xB0, 0x0B,
+0xB0, 0x30, 0x09, 0x50, 0x40, 0x02, 0x31, 0xA0, 0x50, 0x00, 0x70, 0x0F, 0x1C, 0x0F, 0x14, 0x90,
+0xB0, 0x03, 0x50, 0x30, 0x02, 0xD0, 0x50, 0x03, 0x50, 0xA0, 0xB0, 0x07, 0xB0, 0x30, 0x01, 0x90,
+0x80, 0xA0, 0x70, 0xA2, 0x30, 0x10, 0x01, 0x30, 0x80, 0x40, 0x30, 0x70, 0x0C, 0x80, 0x10, 0xF0,
+0xD0, 0xC0, 0x60, 0xC0, 0xE0, 0xF0, 0x10, 0xF0, 0xE4, 0xC1, 0x60, 0x70, 0x02, 0x90, 0xB0, 0x02,
+0x50, 0x10, 0x40, 0x01, 0xA0, 0x60, 0xE0, 0xC0, 0x10, 0x41, 0x05, 0x70, 0xA0, 0x90, 0xA0, 0x01,
+0x30, 0xA0, 0x10, 0xE0, 0x27, 0xE0, 0x60, 0x22, 0x70, 0x11, 0x40, 0x03, 0x90, 0x08, 0xB0, 0x50,
+0x08, 0x90, 0x02, 0x40, 0x70, 0xF0, 0xC0, 0xE1, 0x60, 0x27, 0xC0, 0x60, 0x20, 0xE0, 0x71, 0x10,
+0x30, 0xD1, 0x80, 0xA0, 0xE0, 0x60, 0xC0, 0x24, 0xC1, 0x27, 0xE0, 0x60, 0x22, 0xE0, 0xF0, 0x10,
+0x00, 0xA0, 0x60, 0xE0, 0xC0, 0xE0, 0x25, 0xE0, 0x70, 0x80, 0x40, 0x07, 0x40, 0x70, 0x50, 0x70,
+0xB0, 0x0B, 0x51, 0x0D, 0x40, 0x04, 0xB0, 0x40, 0x09, 0x40, 0xB0, 0x06, 0xB0, 0x11, 0x30, 0x01,
+0x50, 0x04, 0x50, 0x40, 0x0D, 0x41, 0x08, 0x40, 0x50, 0x04, 0x10, 0x02, 0xB0, 0x30, 0x0F, 0x1B,
+0x0F, 0x12, 0x40, 0x80, 0xB0, 0x04, 0xA1, 0x90, 0x00, 0x40, 0xA0, 0x04, 0x70, 0xB0, 0x91, 0x07,
+0x30, 0x90, 0x70, 0xF0, 0x60, 0xC0, 0xE4, 0x60, 0x30, 0x00, 0xA0, 0x70, 0x30, 0x80, 0x0D, 0xF0,
+0xC0, 0x60, 0xF2, 0xC0, 0xF0, 0x80, 0x00, 0xA0, 0xF0, 0xE2, 0xC0, 0x60, 0x31, 0x04, 0x40, 0xB0,
+0x02, 0x50, 0x01, 0x90, 0x10, 0xC0, 0xE0, 0xF0, 0x10, 0xB1, 0x40, 0x50, 0x02, 0x80, 0x70, 0x50,
+0xF0, 0x10, 0x80, 0x00, 0x80, 0xD0, 0x40, 0xE0, 0x28, 0xC0, 0x60, 0xE0, 0xC0, 0xA1, 0x10, 0x04,
+0x40, 0x09, 0x40, 0x08, 0x40, 0x01, 0x50, 0x70, 0xF0, 0xE1, 0x20, 0xE0, 0x60, 0x27, 0xC0, 0x60,
+0xE1, 0xA1, 0x00, 0x10, 0x00, 0x40, 0x70, 0x90, 0xE0, 0xF0, 0x60, 0x24, 0x60, 0xC0, 0x27, 0xC1,
+0x23, 0xE0, 0xD0, 0x80, 0x70, 0xD0, 0x60, 0x28, 0xE0, 0xA0, 0x30, 0x40, 0x07, 0x50, 0xA0, 0x80,
+0x30, 0x0A, 0xB0, 0x40, 0x0D, 0x40, 0xB0, 0x05, 0xB0, 0x40, 0x07, 0x40, 0xB0, 0x07, 0x90, 0xD0,
+0x80, 0xA0, 0x00, 0x50, 0x10, 0xB0, 0x02, 0x50, 0x90, 0x0E, 0x30, 0x07, 0xB0, 0x40, 0xB0, 0x05,
+0x50, 0xD0, 0x01, 0x30, 0x70, 0x50, 0x0F, 0x1A, 0x0F, 0x11, 0x80, 0x30, 0x40, 0xD0, 0xA0, 0x02,
+0x80, 0x90, 0x00, 0x81, 0xD0, 0x03, 0xB0, 0x90, 0xA0, 0x01, 0xB0, 0x40, 0xB0, 0x04, 0xB0, 0xD0,
+0xA0, 0xE2, 0xC0, 0xF1, 0x70, 0x60, 0xE0, 0x70, 0xA0, 0x50, 0xD0, 0x10, 0x90, 0xB0, 0x40, 0xB0,
+0x0B, 0x70, 0xE2, 0x60, 0xC0, 0xA1, 0xB0, 0x01, 0x60, 0x71, 0xF0, 0xA0, 0xD0, 0x50, 0xB0, 0x05,
+0x40, 0x05, 0x70, 0xC0, 0xE0, 0x20, 0xE0, 0xD0, 0x90, 0x00, 0xA1, 0x02, 0x10, 0x60, 0xE0, 0x10,
+0x31, 0x00, 0x11, 0xF0, 0xE0, 0x28, 0xE0, 0x60, 0xC0, 0x60, 0x11, 0xD0, 0x04, 0x51, 0x08, 0x40,
+0x08, 0x90, 0xB0, 0x00, 0x11, 0xF0, 0xC0, 0xE0, 0x20, 0xE0, 0x60, 0x27, 0xC1, 0x20, 0xE0, 0x70,
+0xD0, 0xB0, 0x10, 0x90, 0x50, 0x71, 0xC0, 0xE0, 0x25, 0x60, 0xC0, 0x27, 0xC1, 0xE0, 0x22, 0xE0,
+0xF0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0xE0, 0xA0, 0x80, 0x30, 0x90, 0xA0, 0x50,
+0x03, 0x30, 0x40, 0xA0, 0xB0, 0x09, 0x40, 0x0D, 0x90, 0x50, 0x08, 0x40, 0x05, 0x40, 0xB0, 0x08,
+0x50, 0x80, 0x90, 0x50, 0x00, 0x31, 0x01, 0xB0, 0x51, 0x0E, 0x50, 0x80, 0x06, 0x91, 0x08, 0x32,
+0x50, 0x00, 0xA0, 0x0F, 0x1A, 0x0F, 0x11, 0x70, 0x02, 0x80, 0xD0, 0x00, 0xB0, 0x30, 0x02, 0xD0,
+0x40, 0x02, 0xB0, 0xA0, 0x40, 0xB0, 0x03, 0x40, 0x50, 0x02, 0xB0, 0xD0, 0xE3, 0xA1, 0x40, 0x50,
+0x40, 0x11, 0x70, 0x10, 0x90, 0x10, 0x40, 0x02, 0x40, 0xB0, 0x07, 0x50, 0x10, 0x70, 0xE3, 0x60,
+0x70, 0x50, 0x00, 0x40, 0xB0, 0x02, 0x80, 0x90, 0x10, 0x50, 0x00, 0xA0, 0x10, 0x50, 0x03, 0xB0,
+0x40, 0x04, 0xA0, 0xE0, 0x21, 0xC0, 0xA0, 0x00, 0x40, 0x10, 0x30, 0x02, 0x10, 0x60, 0x70, 0xA0,
+0x01, 0x80, 0x40, 0x10, 0xF0, 0xC0, 0xE0, 0x26, 0xE1, 0xA0, 0x71, 0x30, 0x11, 0x05, 0x40, 0x08,
+0x90, 0xB0, 0x07, 0x50, 0xB0, 0x00, 0x30, 0x10, 0xD0, 0xF0, 0x21, 0xE0, 0x60, 0x26, 0xE0, 0xC1,
+0x20, 0xE0, 0xA0, 0x10, 0xD0, 0x10, 0xA0, 0x80, 0x30, 0xA0, 0xD0, 0xF0, 0xE0, 0x24, 0x60, 0xE0,
+0x27, 0x60, 0xE0, 0x23, 0xE0, 0x60, 0x10, 0xD1, 0xF0, 0xE0, 0x28, 0x60, 0xE1, 0x70, 0xC0, 0x80,
+0x30, 0x70, 0x03, 0x40, 0xA0, 0x80, 0x90, 0x08, 0x90, 0x50, 0x0C, 0x50, 0x90, 0x0A, 0x40, 0xB0,
+0x02, 0x40, 0xB0, 0x09, 0xB0, 0x30, 0x05, 0x50, 0x70, 0x10, 0x90, 0x0E, 0x41, 0x05, 0x40, 0xB0,
+0x0A, 0xD0, 0xB0, 0x01, 0x50, 0x80, 0x04, 0x50, 0x40, 0x0F, 0x12, 0x0F, 0x11, 0x80, 0x30, 0x02,
+0x40, 0x80, 0x30, 0xA0, 0x90, 0x00, 0x90, 0x10, 0x50, 0x02, 0x80, 0x40, 0x06, 0x50, 0x40, 0xB0,
+0x80, 0x10, 0x50, 0xE2, 0x70, 0x50, 0x03, 0xB1, 0x90, 0x10, 0xD0, 0x10, 0x04, 0x90, 0x50, 0x07,
+0xB0, 0x70, 0x60, 0x70, 0xC0, 0xF0, 0xA0, 0x03, 0x40, 0xB0, 0x00, 0x40, 0xB0, 0x04, 0xA0, 0x80,
+0x04, 0xB0, 0x40, 0x00, 0x40, 0x01, 0x70, 0xF0, 0xE0, 0x20, 0xC0, 0x30, 0x00, 0x30, 0xD0, 0x70,
+0x50, 0x00, 0x10, 0x70, 0xE0, 0x70, 0x14, 0xD0, 0xE0, 0x60, 0xE0, 0x26, 0xC0, 0x10, 0x90, 0x30,
+0x90, 0xD0, 0x10, 0x06, 0x90, 0x08, 0xB0, 0x50, 0x07, 0xB0, 0x81, 0x40, 0xA0, 0xF0, 0xE0, 0x21,
+0xE0, 0x60, 0x26, 0xE0, 0xC1, 0x21, 0xE0, 0xF0, 0x10, 0xA0, 0x40, 0xA0, 0x80, 0xA0, 0xC0, 0x70,
+0xE0, 0x24, 0x60, 0xE0, 0x27, 0x60, 0xE0, 0x24, 0xE0, 0x60, 0x30, 0xB0, 0x10, 0xE0, 0x26, 0xE0,
+0x60, 0xE3, 0xF0, 0x70, 0x30, 0xD0, 0x90, 0x01, 0x90, 0x00, 0xA0, 0x30, 0xD0, 0x07, 0xB0, 0x90,
+0x0C, 0xB0, 0x40, 0x0C, 0x40, 0xB0, 0x00, 0x40, 0xB0, 0x0B, 0xA0, 0x04, 0xB0, 0x70, 0x80, 0x0B,
+0x51, 0x01, 0x50, 0x70, 0x04, 0x50, 0x40, 0x0A, 0x40, 0x30, 0x90, 0xD0, 0x00, 0xB0, 0x30, 0xD0,
+0xB0, 0x01, 0x40, 0x10, 0x30, 0x80, 0xD0, 0x0F, 0x11, 0x0F, 0x0F, 0xB0, 0x80, 0x40, 0x30, 0xD0,
+0x40, 0x00, 0x40, 0x70, 0x40, 0x00, 0x80, 0x30, 0xD0, 0x50, 0x80, 0x02, 0xA0, 0x08, 0x81, 0x40,
+0x80, 0x30, 0xF1, 0x70, 0x50, 0x06, 0x40, 0x30, 0x10, 0xA0, 0x05, 0x50, 0x40, 0x06, 0xD0, 0x70,
+0x10, 0x71, 0xA0, 0x05, 0x90, 0x40, 0xB0, 0x02, 0x10, 0x50, 0x08, 0x50, 0xB0, 0xD0, 0x40, 0xF0,
+0xD0, 0x60, 0x21, 0xE0, 0xA0, 0x00, 0xA0, 0x10, 0x51, 0x30, 0x70, 0xE1, 0xA0, 0xF0, 0x60, 0x70,
+0xC0, 0x21, 0xE0, 0xC0, 0x60, 0xE0, 0x24, 0xE0, 0xF0, 0x70, 0x00, 0x10, 0x40, 0x10, 0xA0, 0x06,
+0xB0, 0x50, 0x08, 0x40, 0x08, 0x70, 0x10, 0x30, 0xD0, 0xC0, 0xE0, 0x21, 0xE0, 0x60, 0x27, 0xC0,
+0x60, 0x21, 0xE1, 0x60, 0x10, 0x70, 0x30, 0x80, 0xA0, 0xD0, 0x60, 0xE0, 0x24, 0x60, 0xE0, 0x25,
+0xE0, 0xC1, 0xE0, 0x24, 0xE0, 0x60, 0x70, 0x50, 0x30, 0xA0, 0xE0, 0x26, 0x60, 0xC0, 0x30, 0xA0,
+0x70, 0x90, 0x05, 0x90, 0xA0, 0x10, 0xD0, 0x08, 0x40, 0x0C, 0xB0, 0x40, 0x0E, 0x41, 0xB0, 0x0C,
+0xA0, 0x03, 0xB0, 0x90, 0x30, 0x10, 0x0A, 0x30, 0xA0, 0x80, 0x30, 0xA0, 0x80, 0x50, 0x02, 0xB0,
+0x40, 0x50, 0x0A, 0x80, 0x40, 0x30, 0x90, 0x30, 0xA0, 0x30, 0xB0, 0x00, 0xA0, 0x00, 0x80, 0xD0,
+0x31, 0x00, 0x81, 0x0F, 0x10, 0x0F, 0x0E, 0xB0, 0x70, 0x40, 0x30, 0xD0, 0x31, 0x70, 0xA1, 0x02,
+0xA0, 0x30, 0x40, 0x30, 0x01, 0xA0, 0x90, 0x06, 0x40, 0xA0, 0x90, 0x00, 0x50, 0x90, 0x70, 0x51,
+0x08, 0xF1, 0x10, 0xA0, 0x06, 0xB0, 0x40, 0x03, 0x40, 0x70, 0x30, 0x40, 0xA0, 0xB1, 0x02, 0x80,
+0xA0, 0x01, 0x90, 0x40, 0xB0, 0x02, 0x10, 0xB0, 0x09, 0x90, 0x80, 0xD0, 0x60, 0xE1, 0x21, 0xE0,
+0x32, 0x70, 0x80, 0x10, 0x70, 0x60, 0xE0, 0x20, 0xE4, 0x22, 0xE0, 0x60, 0x20, 0xE0, 0x23, 0xE0,
+0xF0, 0x70, 0x90, 0x10, 0x30, 0xA0, 0xB0, 0x07, 0x40, 0x08, 0x90, 0x08, 0x30, 0x71, 0xF0, 0xE0,
+0x22, 0xE0, 0x60, 0xC0, 0xE0, 0x25, 0xC0, 0x60, 0x22, 0xE0, 0xC0, 0x70, 0xB0, 0x70, 0xC0, 0xE2,
+0x24, 0xC1, 0xE0, 0x25, 0xE0, 0x60, 0x27, 0xE0, 0x70, 0x90, 0x00, 0x80, 0xA0, 0xC0, 0xE3, 0xC1,
+0x60, 0xA0, 0x50, 0x07, 0x90, 0x00, 0x10, 0xD0, 0x50, 0x07, 0x90, 0xB0, 0x0C, 0x40, 0x0F, 0x00,
+0x41, 0x0D, 0x80, 0x90, 0x01, 0x50, 0x40, 0x01, 0x40, 0x08, 0xB0, 0x30, 0x80, 0x07, 0xB0, 0x40,
+0xB0, 0x0B, 0x40, 0xA1, 0x01, 0x10, 0x02, 0x41, 0x70, 0x01, 0x80, 0x40, 0x30, 0x50, 0x0F, 0x10,
+0x0F, 0x0E, 0x90, 0x30, 0x01, 0xB0, 0x70, 0x40, 0x00, 0x40, 0x70, 0x90, 0x00, 0xB0, 0x70, 0x90,
+0x30, 0x90, 0x00, 0x10, 0x50, 0x05, 0x80, 0xA0, 0x40, 0x03, 0xB0, 0x30, 0x09, 0x40, 0x70, 0xF0,
+0x10, 0xD0, 0x07, 0xB0, 0x40, 0x00, 0x90, 0xA0, 0x40, 0x07, 0x50, 0xA0, 0x80, 0x00, 0x90, 0x50,
+0x00, 0x40, 0xB0, 0x01, 0x50, 0x08, 0x51, 0x70, 0x30, 0xE0, 0xC0, 0xD0, 0xC0, 0x21, 0xE0, 0x71,
+0xE0, 0x11, 0x70, 0xF0, 0x60, 0xE0, 0x22, 0xE0, 0x26, 0x60, 0xE0, 0x22, 0xE0, 0xC0, 0xE0, 0xC0,
+0xF0, 0x10, 0xD0, 0x09, 0x90, 0x08, 0x50, 0xB0, 0x06, 0x50, 0x80, 0x11, 0xC0, 0x23, 0xE0, 0xC1,
+0xE0, 0x25, 0xC0, 0x60, 0x24, 0x60, 0x10, 0xD0, 0xC0, 0xE0, 0x25, 0xE0, 0x60, 0x27, 0xE0, 0x60,
+0x27, 0xE0, 0xC0, 0x70, 0x01, 0x50, 0xA0, 0x70, 0xA0, 0x60, 0xA1, 0xF0, 0x10, 0x08, 0xB0, 0x90,
+0x0A, 0xB0, 0x90, 0x0C, 0x40, 0xB0, 0x0E, 0x40, 0xB0, 0x00, 0x40, 0xB0, 0x05, 0x30, 0x50, 0x03,
+0xB0, 0x70, 0x00, 0x91, 0x0B, 0x40, 0xA0, 0x50, 0x07, 0x40, 0x90, 0x0E, 0x40, 0xB0, 0x01, 0x40,
+0x30, 0x00, 0xB0, 0x30, 0x71, 0x01, 0x70, 0x90, 0x0F, 0x12, 0x0F, 0x0F, 0x10, 0x50, 0x02, 0xD0,
+0x90, 0x30, 0x00, 0x80, 0x30, 0xD0, 0x11, 0x71, 0x10, 0x30, 0xA0, 0x01, 0x42, 0x70, 0x80, 0x06,
+0x81, 0x90, 0x03, 0x40, 0xA0, 0x80, 0x30, 0xA0, 0xE0, 0xA0, 0xD1, 0x50, 0x06, 0x30, 0x10, 0xA0,
+0x30, 0x0C, 0x40, 0x50, 0x02, 0x90, 0xB0, 0x0A, 0x70, 0x10, 0x70, 0xE0, 0x60, 0xC0, 0xF0, 0x22,
+0xE0, 0xA1, 0xC0, 0xD0, 0xE2, 0xC0, 0x60, 0x2A, 0x60, 0xC0, 0xE2, 0x70, 0x10, 0xD0, 0x60, 0x10,
+0x70, 0x00, 0x40, 0x09, 0x90, 0x07, 0xB0, 0x90, 0x06, 0x10, 0x30, 0xF0, 0xC0, 0xE0, 0x24, 0xC1,
+0xE0, 0x25, 0xC0, 0x60, 0x24, 0xE0, 0x60, 0xA0, 0xC0, 0x26, 0xE0, 0x60, 0xE0, 0x26, 0xC0, 0x60,
+0xE0, 0x27, 0x60, 0x70, 0x00, 0x31, 0x00, 0xB0, 0x10, 0xF0, 0x60, 0xA1, 0x70, 0x30, 0x40, 0x06,
+0x40, 0x0B, 0x40, 0x0C, 0x90, 0xB0, 0x0E, 0x40, 0xB0, 0x02, 0x40, 0xB0, 0x04, 0x81, 0x04, 0xA0,
+0x40, 0xB0, 0x0C, 0xA0, 0x07, 0xB0, 0x40, 0xB0, 0x0F, 0x05, 0xD0, 0x30, 0xA0, 0x00, 0x50, 0x70,
+0xD0, 0x10, 0x40, 0x00, 0x30, 0xD0, 0x70, 0xB0, 0x0F, 0x0E, 0x0F, 0x0F, 0xB0, 0xD0, 0x30, 0x50,
+0xB0, 0xA0, 0x70, 0xB0, 0x01, 0x80, 0xA0, 0x02, 0xB0, 0x80, 0x00, 0xA0, 0xD1, 0x30, 0x90, 0x40,
+0x09, 0x30, 0xB0, 0x40, 0x02, 0x30, 0x70, 0x80, 0x90, 0xE0, 0x70, 0x60, 0xD0, 0x10, 0x80, 0x05,
+0xB0, 0xD1, 0x00, 0x51, 0x0A, 0x90, 0x50, 0x03, 0x30, 0x70, 0xB0, 0x0A, 0x80, 0x60, 0xE0, 0x20,
+0x60, 0xE0, 0x23, 0x10, 0xA0, 0xE0, 0x23, 0xE0, 0x60, 0xC0, 0x2A, 0x61, 0x70, 0x11, 0x70, 0x10,
+0xD0, 0xA0, 0x01, 0x51, 0x08, 0x40, 0x08, 0x40, 0x05, 0x90, 0x10, 0xD0, 0x70, 0xF0, 0xE0, 0x25,
+0x60, 0x26, 0xC0, 0x60, 0x26, 0xE0, 0x60, 0xE0, 0x25, 0xE0, 0x60, 0x26, 0xE0, 0xC1, 0x26, 0xE0,
+0x60, 0xE0, 0x30, 0xD0, 0x11, 0x30, 0x10, 0xF0, 0xE1, 0x60, 0xE1, 0x90, 0x70, 0x05, 0x50, 0xB0,
+0x0A, 0x40, 0x0C, 0x50, 0x90, 0x0E, 0x40, 0x90, 0x04, 0x40, 0x0B, 0x30, 0xB0, 0x03, 0x31, 0x80,
+0x30, 0x40, 0x03, 0x50, 0x80, 0x06, 0x91, 0x0F, 0x07, 0xB0, 0xD0, 0x02, 0xA0, 0x50, 0x00, 0x40,
+0xD0, 0x80, 0x00, 0x50, 0xA0, 0x0F, 0x0E, 0x0F, 0x0C, 0xB0, 0x70, 0xD0, 0x50, 0x00, 0x40, 0x71,
+0x30, 0x11, 0x40, 0x00, 0xD0, 0x30, 0x03, 0x30, 0x80, 0x30, 0x00, 0xB0, 0x70, 0x09, 0xB0, 0x30,
+0xA0, 0x01, 0x90, 0x50, 0x01, 0xB0, 0xA0, 0xC0, 0x70, 0xC0, 0x60, 0xA0, 0x31, 0x03, 0xB0, 0x80,
+0x30, 0x80, 0xB0, 0x01, 0x50, 0x30, 0xD0, 0x90, 0x06, 0x50, 0x90, 0x05, 0xA1, 0x07, 0x80, 0x30,
+0xB0, 0x10, 0xE2, 0xC0, 0x60, 0xE2, 0x20, 0x60, 0xE0, 0x23, 0xE1, 0xC0, 0x60, 0x28, 0xE2, 0x70,
+0x10, 0x30, 0x11, 0xA0, 0x04, 0x40, 0x08, 0x50, 0xB0, 0x07, 0x90, 0x05, 0x40, 0x10, 0xA0, 0x71,
+0xE0, 0x25, 0x60, 0xE0, 0x24, 0xE0, 0xC1, 0x21, 0xE1, 0x22, 0xC0, 0x60, 0xE2, 0x23, 0xE0, 0x60,
+0x26, 0xE0, 0x60, 0x28, 0x60, 0xE2, 0xC0, 0x60, 0xF0, 0xC0, 0xE0, 0x20, 0xC1, 0xE0, 0xF0, 0xD0,
+0x10, 0xB0, 0x04, 0x40, 0x0A, 0x51, 0x0B, 0xB0, 0x40, 0x0E, 0x40, 0x00, 0xD0, 0x90, 0x04, 0x40,
+0x08, 0xB0, 0x40, 0xA0, 0x03, 0xD0, 0x90, 0xB0, 0x50, 0xB0, 0x80, 0x30, 0xB0, 0x01, 0xA0, 0x05,
+0xB0, 0x40, 0xB0, 0x0F, 0x09, 0x30, 0x40, 0x00, 0x70, 0x10, 0xA0, 0x50, 0x70, 0xB0, 0x01, 0x50,
+0xA0, 0x0F, 0x0E, 0x0F, 0x0C, 0xA0, 0x51, 0xD0, 0x70, 0x80, 0x01, 0xA0, 0x90, 0x12, 0x50, 0x30,
+0x03, 0x11, 0x90, 0x01, 0xD0, 0x08, 0x31, 0x00, 0x30, 0xB0, 0x01, 0x50, 0x90, 0x00, 0xA2, 0xE1,
+0x10, 0xC1, 0x30, 0x02, 0x40, 0x10, 0x50, 0x05, 0x40, 0x30, 0x06, 0x50, 0x90, 0x07, 0xB0, 0x40,
+0xB0, 0x06, 0x30, 0x10, 0x70, 0x50, 0xE1, 0x50, 0x61, 0xA0, 0x70, 0xE1, 0x27, 0xC0, 0x60, 0xE0,
+0x26, 0xE0, 0xC0, 0xA1, 0x40, 0x12, 0x90, 0x04, 0x50, 0xB0, 0x08, 0x90, 0x07, 0xB0, 0x40, 0xB0,
+0x80, 0x90, 0x00, 0xA0, 0x11, 0x70, 0xC0, 0xE1, 0x23, 0xE1, 0x60, 0xE4, 0x20, 0xE0, 0xC0, 0x60,
+0xE0, 0x20, 0xE4, 0xC1, 0xE3, 0x22, 0xC1, 0x26, 0xE0, 0x60, 0xE0, 0x26, 0xC1, 0xE2, 0x20, 0xE2,
+0x20, 0xE0, 0x60, 0xE1, 0x70, 0x50, 0x30, 0xB0, 0x03, 0x90, 0xB0, 0x0A, 0x40, 0x0C, 0x40, 0x0E,
+0x40, 0xB0, 0x00, 0x30, 0x40, 0x04, 0xB0, 0x40, 0x06, 0x50, 0x40, 0x00, 0x30, 0x80, 0xB0, 0x30,
+0x70, 0x80, 0x04, 0xB0, 0x70, 0x00, 0x80, 0x40, 0x04, 0x50, 0x90, 0x0F, 0x0C, 0xD0, 0x11, 0x81,
+0x10, 0xB0, 0x01, 0x50, 0x10, 0x50, 0x0F, 0x0E, 0x0F, 0x0C, 0xD0, 0xB0, 0x50, 0x70, 0xB0, 0xA0,
+0x80, 0x40, 0x50, 0x01, 0x30, 0xD0, 0x50, 0x41, 0x01, 0x10, 0xA0, 0x30, 0x02, 0x90, 0xD0, 0x05,
+0x80, 0xA0, 0x50, 0x01, 0x90, 0x30, 0x40, 0x80, 0x50, 0x40, 0x70, 0x30, 0xA2, 0x10, 0xA0, 0xE0,
+0xD0, 0x02, 0xB0, 0x10, 0x00, 0xA0, 0x07, 0x40, 0x04, 0x50, 0x90, 0x0A, 0x40, 0xB0, 0x00, 0x50,
+0x80, 0x03, 0x80, 0xA1, 0x70, 0xA0, 0x70, 0x10, 0x70, 0xD0, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0xC0,
+0xE0, 0x25, 0xE0, 0x12, 0x80, 0x10, 0x70, 0x30, 0x06, 0x40, 0x08, 0x90, 0x08, 0xD2, 0x10, 0x70,
+0x11, 0x30, 0x60, 0xC0, 0xE0, 0x21, 0xC1, 0x6F, 0x08, 0xC2, 0x20, 0xE0, 0xC1, 0xE0, 0x23, 0xE1,
+0xC1, 0x26, 0xE0, 0x60, 0x28, 0xC1, 0xE0, 0x60, 0xD0, 0x05, 0xB0, 0x90, 0x0A, 0x40, 0x0C, 0x40,
+0x0E, 0x40, 0xB0, 0x01, 0x40, 0x70, 0x05, 0xB0, 0x40, 0x04, 0x90, 0x50, 0x01, 0x30, 0x80, 0xA0,
+0x50, 0x07, 0x50, 0x70, 0x80, 0x04, 0x40, 0x50, 0x0F, 0x0C, 0x50, 0x80, 0x10, 0x02, 0x70, 0xA0,
+0x40, 0x70, 0xD0, 0xB0, 0x50, 0x30, 0xA0, 0x0F, 0x0C, 0x0F, 0x0C, 0x90, 0x50, 0x02, 0xB0, 0xA0,
+0x70, 0x80, 0x01, 0x70, 0xB0, 0x00, 0x90, 0x80, 0x03, 0x80, 0x50, 0x02, 0xA0, 0x30, 0x90, 0x50,
+0x00, 0x90, 0xA0, 0x90, 0x03, 0xB0, 0xD0, 0x12, 0x30, 0x70, 0x30, 0x80, 0xB0, 0x00, 0x70, 0x90,
+0xF1, 0x02, 0xA0, 0xB0, 0x0A, 0x40, 0xB0, 0x01, 0xB0, 0x40, 0x04, 0xB0, 0x50, 0x05, 0x40, 0x00,
+0x10, 0x50, 0x05, 0xA0, 0xD0, 0x30, 0x80, 0xD1, 0xF0, 0xE1, 0x29, 0xE0, 0x60, 0x21, 0xE0, 0x22,
+0xE0, 0xA0, 0x10, 0x80, 0x90, 0x40, 0x10, 0x90, 0x07, 0x90, 0xB0, 0x07, 0x51, 0x06, 0xB0, 0xA0,
+0x70, 0x12, 0x80, 0x70, 0x90, 0xC0, 0x63, 0xC0, 0x23, 0xE0, 0x25, 0xE0, 0xC1, 0xE0, 0x20, 0xE0,
+0x26, 0xF0, 0x20, 0xC1, 0x63, 0xC1, 0x20, 0xE3, 0x60, 0x27, 0xE0, 0x60, 0x26, 0xE1, 0x60, 0xD0,
+0xC0, 0xA0, 0x06, 0x40, 0x0A, 0x90, 0xB0, 0x0B, 0x40, 0x0E, 0x40, 0xB0, 0x02, 0xB0, 0xD0, 0x06,
+0xB0, 0x40, 0x02, 0x40, 0xB0, 0x02, 0xA0, 0x0F, 0x01, 0x50, 0x40, 0x0F, 0x0C, 0xB0, 0x40, 0xB0,
+0x00, 0xD0, 0x01, 0x50, 0xA0, 0x30, 0x80, 0x50, 0x01, 0x90, 0x80, 0x30, 0xB0, 0x0F, 0x0B, 0x0F,
+0x0F, 0xB0, 0x40, 0xA1, 0x50, 0x90, 0x30, 0x80, 0xA0, 0x00, 0x50, 0x30, 0x70, 0x90, 0x50, 0x01,
+0xB0, 0x30, 0x02, 0xB0, 0x50, 0x80, 0xD0, 0xA0, 0x80, 0x05, 0x40, 0x11, 0x70, 0xB0, 0x01, 0xB1,
+0x90, 0xB0, 0x31, 0x70, 0x02, 0x50, 0x80, 0x01, 0xB0, 0x10, 0x40, 0x07, 0x90, 0xB1, 0x90, 0x05,
+0x50, 0x30, 0x01, 0x80, 0x40, 0x02, 0x40, 0x90, 0x06, 0x50, 0x00, 0xB0, 0x10, 0x30, 0x70, 0xE0,
+0x60, 0x2B, 0xC0, 0x60, 0xE0, 0x23, 0xE0, 0xD0, 0x10, 0x70, 0x01, 0x40, 0x09, 0x40, 0x08, 0x90,
+0x04, 0x51, 0x00, 0x80, 0x70, 0x10, 0xD0, 0x30, 0xF0, 0x60, 0xC1, 0x60, 0xC0, 0xE2, 0x2B, 0xC0,
+0x60, 0x29, 0x60, 0x20, 0xE3, 0x60, 0xC1, 0x62, 0xC1, 0xE0, 0x60, 0x20, 0xE0, 0x25, 0xC1, 0x24,
+0xE3, 0xA0, 0x70, 0x30, 0xA0, 0x05, 0x51, 0x09, 0xB0, 0x90, 0x0B, 0x90, 0x50, 0x0D, 0x40, 0xB0,
+0x04, 0x80, 0xB0, 0x06, 0x51, 0x00, 0x40, 0xB0, 0x03, 0xB0, 0xA0, 0x02, 0xB0, 0x0A, 0x90, 0x50,
+0x0F, 0x0B, 0xB0, 0x90, 0x80, 0xB0, 0x01, 0x50, 0xA0, 0x30, 0x80, 0x00, 0xA0, 0x04, 0x51, 0x0F,
+0x0C, 0x0F, 0x0F, 0xB0, 0x30, 0x40, 0x30, 0x02, 0xD0, 0x90, 0xA0, 0x80, 0xB0, 0xD0, 0x51, 0x40,
+0xB0, 0x00, 0x30, 0x05, 0xB0, 0x30, 0x50, 0x05, 0x90, 0xD0, 0xA0, 0xF0, 0x70, 0x80, 0x03, 0x90,
+0x80, 0xA0, 0xB0, 0x02, 0x50, 0x40, 0x01, 0x90, 0x10, 0x08, 0x40, 0x70, 0x30, 0x70, 0x80, 0x05,
+0x30, 0xB0, 0x00, 0x40, 0x10, 0x03, 0x40, 0xB0, 0x07, 0x40, 0x11, 0xC0, 0xE0, 0xC0, 0x60, 0x2A,
+0xE0, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0xC0, 0x10, 0x90, 0xD0, 0x50, 0x00, 0x50, 0xB0, 0x08, 0x40,
+0x08, 0x90, 0xB0, 0x03, 0x80, 0x70, 0x00, 0x80, 0xA0, 0x80, 0x70, 0xF0, 0xE1, 0x21, 0xC1, 0xE1,
+0x2C, 0xC1, 0x2F, 0x00, 0x60, 0xE0, 0x23, 0xC0, 0x63, 0x20, 0xE1, 0x23, 0x60, 0xE0, 0x24, 0xA0,
+0x70, 0x60, 0xC0, 0x70, 0x30, 0x10, 0x40, 0x05, 0x40, 0x0A, 0x40, 0x0B, 0x50, 0x90, 0x0D, 0x40,
+0xB0, 0x0F, 0x00, 0x90, 0x40, 0x05, 0x70, 0x30, 0xB0, 0x01, 0x10, 0x90, 0x07, 0xB0, 0x40, 0xB0,
+0x0F, 0x0B, 0x91, 0x00, 0xA1, 0x02, 0xD0, 0x90, 0x01, 0x90, 0x40, 0x0F, 0x12, 0x0F, 0x11, 0x31,
+0x01, 0x40, 0x10, 0x80, 0x01, 0xB0, 0x10, 0x30, 0x01, 0x91, 0x80, 0x50, 0x05, 0xA0, 0x07, 0x30,
+0x80, 0xA0, 0xF0, 0x30, 0x50, 0x03, 0x80, 0xD0, 0x50, 0x02, 0xB0, 0xA0, 0x01, 0xB0, 0x10, 0xA0,
+0x01, 0x50, 0x03, 0x40, 0x10, 0xA0, 0x40, 0x70, 0xA0, 0x03, 0xB0, 0xD0, 0x09, 0x40, 0xB0, 0x04,
+0x90, 0x70, 0x10, 0xD0, 0xA0, 0xE2, 0xC0, 0x60, 0x2A, 0xE0, 0x60, 0x21, 0xE0, 0xC0, 0x10, 0xD0,
+0x40, 0x03, 0x40, 0x08, 0xB0, 0x90, 0x07, 0xB0, 0x50, 0x02, 0xB0, 0xA0, 0x70, 0x40, 0x00, 0x50,
+0x10, 0xD0, 0xE0, 0x24, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x2F, 0x00, 0x60, 0xE0, 0x25, 0xE1, 0xC0,
+0x62, 0xC0, 0x20, 0xE0, 0x20, 0x60, 0xE0, 0x23, 0x61, 0xC0, 0x30, 0x40, 0x70, 0x40, 0x06, 0x90,
+0xB0, 0x09, 0x40, 0xB0, 0x0A, 0xB0, 0x90, 0x0D, 0x40, 0xB0, 0x0F, 0x00, 0x50, 0x90, 0x40, 0xB0,
+0x04, 0x80, 0xA0, 0x02, 0x80, 0x50, 0x06, 0x91, 0x0F, 0x0B, 0x50, 0x40, 0xB0, 0x06, 0xB0, 0xD0,
+0x01, 0x50, 0x10, 0x0F, 0x12, 0x0F, 0x10, 0x50, 0x30, 0x50, 0xA0, 0x40, 0xD0, 0xB0, 0x02, 0xB0,
+0xA1, 0x03, 0x40, 0x80, 0x05, 0xA0, 0x08, 0x31, 0xF0, 0x70, 0xA0, 0x00, 0x90, 0x80, 0xB0, 0x00,
+0x50, 0x90, 0x50, 0x01, 0xB0, 0x30, 0x01, 0x80, 0x30, 0x01, 0xB0, 0x11, 0x50, 0x02, 0x90, 0xB0,
+0x01, 0x40, 0xB0, 0x02, 0x40, 0xD0, 0x01, 0xB0, 0x10, 0x02, 0x90, 0x02, 0x90, 0xB0, 0x03, 0xD0,
+0x50, 0x70, 0x10, 0xE1, 0x22, 0xC0, 0x60, 0x29, 0xE0, 0xC0, 0x60, 0xE1, 0x70, 0x11, 0x80, 0x03,
+0xB0, 0x50, 0x08, 0x90, 0x08, 0x40, 0x50, 0x90, 0x50, 0x70, 0x30, 0x40, 0x10, 0x00, 0x50, 0x10,
+0xC0, 0xE0, 0x24, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x2E, 0xC1, 0xE0, 0x26, 0xE0, 0x23, 0xC0, 0x62,
+0xC0, 0xE1, 0x22, 0xE0, 0xA1, 0x60, 0xF0, 0x90, 0x07, 0x40, 0x09, 0x51, 0x0A, 0xB0, 0x40, 0x0D,
+0x40, 0xB0, 0x01, 0x80, 0x10, 0x04, 0x50, 0x05, 0x50, 0x90, 0x01, 0x40, 0x00, 0xD0, 0xA0, 0x40,
+0x01, 0x50, 0xA0, 0x90, 0x07, 0xB0, 0x40, 0xB0, 0x0F, 0x0A, 0xB0, 0x40, 0x50, 0x09, 0x30, 0x80,
+0x30, 0x80, 0x50, 0x30, 0x0F, 0x11, 0x0F, 0x10, 0xA0, 0x02, 0xA0, 0x80, 0x05, 0x80, 0x50, 0x03,
+0x30, 0x40, 0xB0, 0x03, 0x30, 0xB0, 0x08, 0x80, 0x71, 0x10, 0x80, 0x30, 0x71, 0x50, 0x01, 0x50,
+0x40, 0x00, 0x40, 0x80, 0x01, 0x40, 0xB0, 0x02, 0x30, 0x10, 0x02, 0x51, 0x03, 0x40, 0xB0, 0x04,
+0x90, 0x11, 0x00, 0x40, 0xD0, 0x10, 0xD0, 0x50, 0x01, 0x40, 0xB0, 0x00, 0x50, 0xA0, 0x40, 0xB0,
+0x10, 0xF0, 0xE1, 0x22, 0xE0, 0x60, 0xC0, 0x29, 0xE0, 0xC1, 0x60, 0x12, 0x90, 0x04, 0x40, 0x08,
+0xB0, 0x90, 0x05, 0xB0, 0x90, 0x80, 0x51, 0x70, 0x10, 0x70, 0xD0, 0x70, 0x40, 0x50, 0x10, 0xC0,
+0xE0, 0x24, 0x60, 0xE0, 0x2D, 0xC1, 0x2E, 0xC1, 0x2D, 0xE0, 0xC0, 0x61, 0xC0, 0x20, 0xE4, 0xC1,
+0xA0, 0xB0, 0x06, 0x40, 0x0A, 0x40, 0x0B, 0x40, 0x0D, 0x40, 0xB0, 0x02, 0x30, 0x10, 0x50, 0x03,
+0xA0, 0x30, 0x03, 0x40, 0x50, 0x02, 0xB0, 0x40, 0x70, 0x80, 0x30, 0x02, 0xB0, 0x80, 0x30, 0x05,
+0x50, 0x40, 0x0F, 0x0B, 0x40, 0x50, 0x0B, 0xB0, 0x10, 0xB0, 0x01, 0x30, 0xB0, 0x0F, 0x10, 0x0F,
+0x0F, 0xB0, 0x70, 0x02, 0x10, 0x06, 0xB0, 0x30, 0x03, 0x80, 0x51, 0x40, 0xB0, 0x01, 0x41, 0x07,
+0x80, 0x30, 0x90, 0x70, 0xD2, 0x10, 0x71, 0x03, 0x40, 0x30, 0x90, 0x01, 0x30, 0x50, 0x03, 0x30,
+0x02, 0x40, 0x02, 0x90, 0x50, 0x00, 0x40, 0x50, 0x03, 0x80, 0x10, 0x40, 0x30, 0x40, 0x80, 0x11,
+0x03, 0x40, 0xA0, 0x80, 0xB0, 0x00, 0x90, 0x10, 0xE0, 0x21, 0xE0, 0x22, 0xE0, 0x60, 0x2A, 0xE0,
+0xC0, 0x10, 0x31, 0xA0, 0x06, 0x40, 0x08, 0x40, 0x03, 0x90, 0x40, 0x50, 0x01, 0x90, 0x50, 0x11,
+0x70, 0xA0, 0x30, 0x50, 0x90, 0xD0, 0xE1, 0x24, 0x60, 0xC0, 0x2D, 0xC0, 0x60, 0x2E, 0x60, 0x2F,
+0x00, 0xE0, 0x60, 0xE0, 0xC0, 0x61, 0xE0, 0xC0, 0xF0, 0xE0, 0xC0, 0x60, 0x10, 0x06, 0xB0, 0x90,
+0x09, 0x40, 0xB0, 0x0A, 0x40, 0x0D, 0x40, 0xB0, 0x03, 0x40, 0x50, 0x05, 0xB0, 0x02, 0x40, 0xB0,
+0x04, 0xB0, 0x50, 0x90, 0x10, 0x80, 0x50, 0xA0, 0x01, 0x30, 0x04, 0x40, 0x50, 0x0F, 0x0A, 0x50,
+0x40, 0x0E, 0x30, 0x40, 0x01, 0x90, 0xA0, 0x0F, 0x10, 0x0F, 0x0F, 0xA0, 0x50, 0xA0, 0x40, 0x30,
+0x40, 0x06, 0x80, 0x70, 0x03, 0xB0, 0x80, 0x01, 0x90, 0x40, 0x00, 0x70, 0x40, 0x80, 0xB0, 0x03,
+0x40, 0xA0, 0x90, 0x00, 0x50, 0x30, 0x90, 0x70, 0x80, 0x50, 0x70, 0x30, 0x70, 0xB0, 0x02, 0x30,
+0x90, 0x0A, 0x40, 0x02, 0x80, 0x50, 0x02, 0x50, 0x90, 0x02, 0x50, 0x30, 0x50, 0xA0, 0x00, 0x70,
+0x10, 0x30, 0x03, 0x10, 0x40, 0x00, 0x50, 0xB0, 0x10, 0x70, 0xE0, 0x26, 0xE0, 0x60, 0x29, 0xE0,
+0xF0, 0x70, 0x50, 0x08, 0x90, 0xB0, 0x07, 0xB0, 0x50, 0xB0, 0x40, 0x90, 0xB0, 0x03, 0x40, 0x00,
+0x32, 0xD0, 0x80, 0x30, 0x10, 0xF0, 0xE0, 0x25, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0xE3,
+0x60, 0xC0, 0xE1, 0x27, 0x60, 0xC0, 0xE2, 0x60, 0x70, 0xF1, 0xA0, 0x60, 0xF0, 0x30, 0x06, 0x40,
+0x09, 0x51, 0x0A, 0x90, 0x50, 0x0C, 0x40, 0xB0, 0x0E, 0xB0, 0x40, 0x07, 0x90, 0xB0, 0x40, 0x11,
+0xD0, 0xB0, 0x00, 0x10, 0x02, 0x50, 0x40, 0x0F, 0x0A, 0x50, 0x40, 0xB0, 0x0F, 0x01, 0x10, 0x50,
+0xA0, 0x80, 0xA0, 0xB0, 0x0F, 0x0F, 0x0F, 0x0E, 0x50, 0x80, 0x01, 0x90, 0x10, 0x01, 0x90, 0xB0,
+0x30, 0xB0, 0x00, 0x30, 0x41, 0x90, 0x03, 0x70, 0xB0, 0x02, 0x30, 0x80, 0x40, 0x30, 0xA0, 0x70,
+0x90, 0x80, 0x10, 0x30, 0x03, 0x30, 0x03, 0xA1, 0x10, 0xD0, 0x02, 0x81, 0x90, 0xB0, 0x07, 0x40,
+0x50, 0x01, 0xB0, 0xA0, 0x03, 0x50, 0x10, 0x40, 0x03, 0xA0, 0xB0, 0x00, 0xA0, 0x90, 0x10, 0x50,
+0x01, 0x40, 0x70, 0x00, 0x90, 0x10, 0x80, 0xA0, 0xE0, 0x29, 0x60, 0xE0, 0x27, 0xE0, 0xA0, 0x10,
+0x50, 0x09, 0x40, 0x07, 0x50, 0x40, 0x90, 0x01, 0x50, 0x30, 0x02, 0x50, 0xB0, 0x02, 0xB0, 0xA0,
+0x70, 0xD0, 0xE0, 0x26, 0xC1, 0x2D, 0xC1, 0x2D, 0xE0, 0x60, 0xE1, 0x70, 0xF0, 0x11, 0x70, 0x10,
+0x60, 0xE2, 0x23, 0x60, 0xE0, 0x22, 0xC0, 0xF0, 0xD0, 0xB0, 0xF0, 0x80, 0x40, 0x30, 0x05, 0x51,
+0x08, 0xB0, 0x90, 0x0A, 0x90, 0x50, 0x0C, 0x40, 0xB0, 0x0E, 0x50, 0x40, 0x09, 0x40, 0x00, 0x30,
+0x40, 0x01, 0x80, 0x40, 0x01, 0x90, 0x50, 0x0F, 0x00, 0x90, 0x10, 0x80, 0x05, 0xB0, 0x40, 0x50,
+0x0F, 0x03, 0x80, 0x70, 0x02, 0x30, 0x0F, 0x0F, 0x0F, 0x0E, 0x30, 0x50, 0x01, 0x81, 0x01, 0xB1,
+0x01, 0x30, 0x40, 0x00, 0xB0, 0xA0, 0x90, 0xB0, 0x01, 0x90, 0x10, 0x40, 0x51, 0x80, 0xB0, 0x90,
+0xB0, 0x00, 0xB0, 0x80, 0x10, 0x50, 0x04, 0x90, 0x80, 0x02, 0x31, 0x70, 0x10, 0x30, 0xB0, 0x01,
+0x30, 0x40, 0x91, 0x05, 0xB0, 0x10, 0x80, 0x00, 0x50, 0xA0, 0xB0, 0x01, 0xB0, 0x00, 0x10, 0xD0,
+0x10, 0x90, 0x00, 0xB0, 0xD0, 0x80, 0x01, 0x11, 0x30, 0x10, 0x00, 0x90, 0x70, 0x01, 0x40, 0x70,
+0xD0, 0xC0, 0xE0, 0x28, 0xE0, 0xC0, 0x60, 0x26, 0xE0, 0xC0, 0x10, 0x80, 0x90, 0xB0, 0x08, 0x51,
+0x04, 0xB0, 0x40, 0x50, 0x03, 0x70, 0xA0, 0x03, 0x90, 0x01, 0x50, 0x30, 0x10, 0xD0, 0xE0, 0x28,
+0x60, 0xE1, 0xC0, 0x2A, 0xC1, 0x2D, 0xC1, 0x60, 0x12, 0xD0, 0x10, 0xB0, 0x80, 0x30, 0xF0, 0xA0,
+0xC0, 0xE0, 0xC0, 0x60, 0xC1, 0xE1, 0x21, 0xE1, 0xF0, 0x40, 0xA0, 0x41, 0x70, 0xB0, 0x04, 0x40,
+0x09, 0x40, 0x0A, 0x50, 0x90, 0x0C, 0x40, 0xB0, 0x0E, 0x91, 0x0B, 0x40, 0x02, 0x40, 0xA0, 0x00,
+0xB0, 0x40, 0xB0, 0x0F, 0x02, 0x50, 0x30, 0xB0, 0x03, 0x40, 0x90, 0x0F, 0x06, 0x10, 0x02, 0xA0,
+0xB0, 0x0F, 0x0E, 0x0F, 0x0D, 0x50, 0x31, 0x80, 0xB0, 0xD0, 0x05, 0x30, 0x40, 0x02, 0xA0, 0x30,
+0xA0, 0xB0, 0x01, 0xA0, 0x50, 0x80, 0xD0, 0xB0, 0x01, 0x50, 0x40, 0x01, 0xA0, 0x06, 0xA0, 0x02,
+0xB0, 0xD0, 0xA0, 0x10, 0xD1, 0xA0, 0x90, 0x00, 0x70, 0x00, 0xB0, 0x40, 0x03, 0xB0, 0x40, 0x90,
+0x02, 0x11, 0x00, 0xA0, 0x10, 0xA0, 0x10, 0x70, 0x50, 0x00, 0x40, 0xB0, 0x10, 0x80, 0x00, 0x10,
+0xD0, 0x11, 0xA0, 0x70, 0x80, 0x90, 0x01, 0xA0, 0x70, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0xC0, 0x60,
+0xE0, 0x24, 0xE0, 0xF0, 0x40, 0x01, 0x40, 0x09, 0x90, 0x02, 0xB0, 0x80, 0x50, 0x03, 0x80, 0xA1,
+0x70, 0xD1, 0x81, 0x40, 0x90, 0xD1, 0xF0, 0xC0, 0xE1, 0x27, 0xE0, 0x60, 0xE0, 0xF0, 0xD0, 0xC0,
+0x29, 0xC0, 0x60, 0x2C, 0xE0, 0xC0, 0xF0, 0x11, 0x71, 0x90, 0xA0, 0x11, 0xD0, 0x12, 0xA0, 0xD0,
+0x80, 0x30, 0xA0, 0x30, 0xF0, 0x60, 0xE2, 0xC0, 0xA0, 0x40, 0x30, 0x10, 0x80, 0x90, 0x50, 0x02,
+0x90, 0xB0, 0x08, 0x90, 0xB0, 0x0A, 0x40, 0x0C, 0x40, 0xB0, 0x0E, 0x90, 0x50, 0x0C, 0xB0, 0x90,
+0x01, 0xD0, 0x00, 0x91, 0x0F, 0x09, 0x50, 0x40, 0xB0, 0x0F, 0x07, 0x30, 0x40, 0x50, 0xA0, 0x81,
+0x0F, 0x0E, 0x0F, 0x0D, 0x30, 0xB0, 0x00, 0x50, 0x10, 0x40, 0x04, 0x70, 0x50, 0x02, 0xB0, 0x50,
+0x80, 0x00, 0xA1, 0x00, 0x30, 0xB0, 0x00, 0x30, 0x04, 0x40, 0x50, 0x80, 0x40, 0x05, 0x90, 0x80,
+0x03, 0x30, 0x03, 0xA0, 0xD0, 0x40, 0x90, 0x01, 0x40, 0x50, 0x01, 0x40, 0x01, 0xA0, 0x01, 0x81,
+0x40, 0x10, 0x06, 0xD0, 0x50, 0x01, 0x90, 0x00, 0x40, 0x10, 0x05, 0x70, 0xF0, 0xE0, 0x60, 0xC0,
+0xE1, 0x27, 0xE1, 0x60, 0xC0, 0xE0, 0x23, 0xE0, 0x71, 0x02, 0x40, 0x07, 0x90, 0x30, 0xD0, 0x10,
+0x80, 0xD1, 0x02, 0x40, 0x70, 0xF0, 0xE2, 0xC0, 0x60, 0xF0, 0xA0, 0xF1, 0xC0, 0xE2, 0x29, 0xE0,
+0x60, 0xE0, 0xC0, 0xE1, 0x29, 0xC0, 0x60, 0x2C, 0xE0, 0xC0, 0x70, 0x10, 0x30, 0x90, 0x40, 0x30,
+0x80, 0x40, 0x70, 0x10, 0x01, 0xA0, 0x90, 0x01, 0x90, 0x00, 0x40, 0x30, 0xF0, 0x71, 0xE1, 0x60,
+0xD0, 0xB0, 0x02, 0x50, 0x40, 0x50, 0x00, 0x40, 0x08, 0xB0, 0x40, 0x0A, 0x40, 0x0C, 0x40, 0xB0,
+0x0E, 0x40, 0xB0, 0x0E, 0x51, 0x00, 0xB0, 0x70, 0x0F, 0x00, 0x50, 0x07, 0x50, 0x40, 0x50, 0x0F,
+0x0A, 0x10, 0x80, 0x01, 0x30, 0xB0, 0x0F, 0x0D, 0x0F, 0x0C, 0xB0, 0x30, 0x02, 0xD0, 0x04, 0xA0,
+0xB0, 0x02, 0x31, 0xB0, 0xD0, 0x01, 0x50, 0xD0, 0x50, 0x30, 0x00, 0xD0, 0xB0, 0x04, 0x40, 0xA0,
+0x80, 0x06, 0xA0, 0x09, 0x30, 0x90, 0x70, 0x02, 0x50, 0x91, 0x02, 0xD0, 0x03, 0x80, 0x50, 0x06,
+0x70, 0x80, 0x50, 0x03, 0xD0, 0x80, 0x04, 0xD0, 0x60, 0xE1, 0x60, 0xC0, 0xE1, 0x28, 0xE0, 0x60,
+0xC0, 0xE0, 0x22, 0x60, 0x10, 0x40, 0x02, 0x90, 0x50, 0x05, 0xB0, 0x10, 0xD0, 0x30, 0x40, 0xF0,
+0x13, 0xD0, 0xA0, 0xE2, 0x20, 0xE0, 0x21, 0xE2, 0x60, 0xE1, 0x2B, 0xE0, 0xC1, 0xE0, 0x2B, 0xC0,
+0x60, 0x2B, 0xE0, 0x70, 0xA0, 0x11, 0x80, 0x00, 0xB0, 0x30, 0x00, 0x40, 0x10, 0x90, 0x04, 0x51,
+0x04, 0x90, 0x70, 0xE1, 0x50, 0xA0, 0x04, 0xB0, 0x80, 0x50, 0x08, 0x40, 0x0A, 0x40, 0x0C, 0x40,
+0xB0, 0x0D, 0xB0, 0x40, 0x0F, 0x02, 0x90, 0x50, 0x90, 0x50, 0x30, 0x0D, 0x70, 0xA0, 0x05, 0xB0,
+0x40, 0x50, 0x0F, 0x0C, 0x80, 0x40, 0x01, 0x50, 0x30, 0x0F, 0x0D, 0x0F, 0x0C, 0x30, 0xA0, 0x80,
+0x00, 0x80, 0x70, 0xB0, 0x01, 0x50, 0x30, 0x40, 0x05, 0xA0, 0x40, 0xA0, 0x01, 0x50, 0xA0, 0x70,
+0x00, 0xB0, 0xD0, 0xB0, 0x50, 0x90, 0x80, 0x00, 0xB0, 0x80, 0xD0, 0x40, 0xB0, 0x04, 0x41, 0x08,
+0x30, 0x40, 0x04, 0x50, 0x30, 0xB0, 0x01, 0x70, 0x40, 0x51, 0xB0, 0x09, 0xA0, 0xB0, 0x80, 0xD0,
+0x40, 0x05, 0xB0, 0xD1, 0xE0, 0x20, 0xE1, 0x60, 0xC0, 0xE0, 0x2A, 0x60, 0x22, 0xE0, 0x60, 0x10,
+0x04, 0x40, 0xB0, 0x03, 0x50, 0x10, 0xD0, 0x60, 0xC0, 0x60, 0xE0, 0xC0, 0x60, 0xC1, 0xE1, 0x28,
+0xE0, 0x60, 0x2D, 0xE0, 0xC1, 0x2C, 0xC1, 0x2A, 0xE0, 0xF0, 0x10, 0xA1, 0xB0, 0x02, 0x30, 0x00,
+0x11, 0x50, 0x02, 0x40, 0x80, 0x90, 0x06, 0xF0, 0x60, 0xF0, 0x70, 0x10, 0x50, 0x03, 0xB0, 0x90,
+0x50, 0x90, 0x06, 0x90, 0xB0, 0x09, 0x90, 0xB0, 0x0B, 0x40, 0xB0, 0x0A, 0x50, 0xA0, 0x00, 0xB0,
+0x40, 0x0F, 0x03, 0x41, 0x00, 0x90, 0x30, 0x40, 0x0C, 0x30, 0x40, 0x04, 0x91, 0x0F, 0x0E, 0xB0,
+0xD0, 0x00, 0x90, 0x30, 0xD0, 0x0F, 0x0D, 0x0F, 0x0C, 0x30, 0x00, 0x50, 0x30, 0xD0, 0x90, 0x80,
+0x00, 0x30, 0x10, 0x40, 0x05, 0xB0, 0x10, 0x00, 0x40, 0x80, 0x02, 0x40, 0x90, 0x00, 0x50, 0x30,
+0x80, 0x40, 0x70, 0xA0, 0x40, 0x00, 0xD0, 0xA0, 0x50, 0x40, 0x04, 0xA0, 0x07, 0x80, 0x11, 0x04,
+0x80, 0x10, 0xD0, 0x30, 0xD0, 0x10, 0xD0, 0xA0, 0x30, 0x10, 0x30, 0x00, 0x51, 0x04, 0x50, 0xA0,
+0x30, 0xD0, 0x30, 0xB0, 0x06, 0xD1, 0xE0, 0x22, 0xE0, 0x60, 0xC0, 0xE0, 0x2A, 0x60, 0x21, 0xE0,
+0xF0, 0x10, 0x04, 0xB0, 0x40, 0x01, 0x50, 0x70, 0xD0, 0xF0, 0xC0, 0xE1, 0xC1, 0xE3, 0x2B, 0xC0,
+0x60, 0xE0, 0x2D, 0xC0, 0xE0, 0x2B, 0xC1, 0xE0, 0x28, 0xE0, 0x60, 0x11, 0xA0, 0x31, 0x02, 0x70,
+0x00, 0x10, 0x30, 0x90, 0x03, 0xD0, 0x90, 0x06, 0xF0, 0x60, 0x30, 0x00, 0x80, 0x50, 0x03, 0x40,
+0x01, 0xB0, 0x40, 0x50, 0x03, 0x51, 0x09, 0x90, 0x50, 0x0B, 0x40, 0xB0, 0x0B, 0x90, 0x80, 0x91,
+0x0F, 0x02, 0x50, 0x40, 0x00, 0x40, 0xA0, 0x30, 0x70, 0xA0, 0x70, 0x50, 0x0F, 0x00, 0x50, 0x40,
+0xB0, 0x0F, 0x10, 0x30, 0x70, 0x40, 0x00, 0x50, 0x30, 0x0F, 0x0C, 0x0F, 0x0B, 0x30, 0x02, 0x40,
+0xA0, 0x50, 0x30, 0x81, 0x07, 0x80, 0x40, 0x01, 0xA0, 0x03, 0xA0, 0x06, 0x40, 0x30, 0x70, 0x10,
+0xB0, 0x00, 0x40, 0x90, 0x02, 0x40, 0x80, 0x04, 0xB0, 0x10, 0x70, 0x00, 0x90, 0x80, 0x02, 0x40,
+0x01, 0x50, 0x90, 0x41, 0x90, 0x30, 0xA0, 0x60, 0x80, 0x70, 0xA1, 0x10, 0x03, 0x80, 0x30, 0xA0,
+0x50, 0xB0, 0x40, 0xB0, 0x04, 0xB0, 0x30, 0x10, 0x24, 0xE0, 0x60, 0xC0, 0x2A, 0xC0, 0x60, 0xE1,
+0xD0, 0x10, 0x05, 0xB0, 0x30, 0xD0, 0x10, 0xD0, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0x60, 0xE0, 0x2F,
+0x00, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2B, 0xC1, 0x28, 0xE0, 0xF0, 0x11, 0x80, 0x40, 0x10, 0x31,
+0xA0, 0x70, 0x80, 0x01, 0xB0, 0xA0, 0x30, 0x01, 0xB0, 0x10, 0x07, 0x70, 0xF0, 0x40, 0x05, 0x51,
+0x03, 0x50, 0x40, 0x02, 0x40, 0x09, 0x50, 0x90, 0x0B, 0x40, 0xB0, 0x0D, 0x90, 0x50, 0x0F, 0x02,
+0x40, 0x50, 0x01, 0x70, 0x80, 0x30, 0x40, 0x00, 0x70, 0x50, 0x0D, 0xB0, 0x40, 0x50, 0x0F, 0x10,
+0x50, 0x40, 0x50, 0xD0, 0x02, 0xA0, 0x0F, 0x0C, 0x0F, 0x0B, 0x70, 0x80, 0xB0, 0x00, 0x10, 0xA0,
+0x00, 0xA0, 0x80, 0x50, 0xB0, 0x05, 0x90, 0x10, 0x02, 0x80, 0x90, 0x02, 0x30, 0x50, 0xA0, 0x80,
+0x05, 0x10, 0x50, 0x30, 0x01, 0xB0, 0x40, 0x50, 0x00, 0x41, 0x04, 0x10, 0xB0, 0x02, 0x30, 0x80,
+0x00, 0xB0, 0x90, 0x80, 0x31, 0xA0, 0xD0, 0x90, 0x40, 0x01, 0x80, 0x70, 0x60, 0xE1, 0xC0, 0x70,
+0x04, 0x90, 0x80, 0x01, 0x40, 0x50, 0x00, 0xD0, 0x40, 0x02, 0x70, 0xE0, 0x25, 0x60, 0xC0, 0xE0,
+0x29, 0xC0, 0x60, 0xE1, 0x30, 0xD0, 0x10, 0x50, 0x03, 0xD0, 0xF1, 0xC0, 0xE1, 0x20, 0xE0, 0x21,
+0xC1, 0xE0, 0x2D, 0xE0, 0x60, 0xC0, 0x2D, 0x60, 0xE0, 0x2B, 0xC1, 0xE0, 0x26, 0xE0, 0xF0, 0x12,
+0x00, 0x50, 0x80, 0x40, 0xA0, 0x80, 0x01, 0xB0, 0xD0, 0x10, 0x51, 0xA0, 0x00, 0xB0, 0x30, 0xB0,
+0x00, 0xB0, 0x00, 0xB0, 0x91, 0x70, 0xC0, 0xA0, 0x06, 0x40, 0x06, 0x40, 0x50, 0x40, 0x09, 0xB0,
+0x40, 0x0B, 0x40, 0xB0, 0x0D, 0x40, 0xB0, 0x0F, 0x01, 0xB0, 0x40, 0xB0, 0x04, 0x90, 0x00, 0x30,
+0x40, 0x0C, 0xB0, 0x40, 0x90, 0x0F, 0x0F, 0xB0, 0x50, 0x40, 0xB0, 0x01, 0x30, 0x90, 0x00, 0x90,
+0xA0, 0x40, 0x0F, 0x0B, 0x0F, 0x03, 0x80, 0x50, 0x04, 0x41, 0x50, 0x30, 0xA0, 0x10, 0x01, 0xD0,
+0x01, 0x50, 0x40, 0x50, 0x03, 0x30, 0xA0, 0x02, 0x90, 0x80, 0x02, 0xB0, 0x30, 0x07, 0xA0, 0x00,
+0x80, 0x50, 0x02, 0x50, 0x40, 0x30, 0x03, 0x50, 0xA0, 0xB0, 0x00, 0x50, 0x30, 0x80, 0xA0, 0xD1,
+0x30, 0xA0, 0x40, 0xB0, 0x01, 0x70, 0xA0, 0x90, 0x80, 0xB0, 0x01, 0x30, 0xF0, 0xE1, 0x60, 0x80,
+0x04, 0x30, 0x50, 0x01, 0x90, 0x50, 0x10, 0xD1, 0xA0, 0x00, 0x30, 0xA0, 0xE0, 0x25, 0x60, 0xC0,
+0xE0, 0x28, 0xE0, 0x60, 0xC0, 0xE0, 0x50, 0x11, 0x50, 0x01, 0x50, 0x30, 0x70, 0x60, 0xE0, 0x26,
+0xE0, 0x60, 0x2C, 0xE3, 0x60, 0x2C, 0xE0, 0x60, 0x2C, 0xC0, 0x60, 0x26, 0xE1, 0x13, 0x30, 0xA0,
+0x40, 0x01, 0x81, 0x02, 0xB0, 0x01, 0x30, 0x00, 0xB0, 0xD0, 0x11, 0x70, 0xA1, 0xF1, 0xC0, 0xE0,
+0xA0, 0x05, 0x90, 0xB0, 0x07, 0x50, 0x40, 0x09, 0x40, 0x0B, 0x40, 0xB0, 0x0C, 0xB0, 0x40, 0x0F,
+0x02, 0x91, 0x02, 0x30, 0x02, 0x51, 0x30, 0x0C, 0x90, 0x40, 0x0F, 0x10, 0x91, 0xB0, 0x04, 0x10,
+0x30, 0x40, 0x00, 0xA0, 0x0F, 0x0B, 0x0F, 0x02, 0x80, 0x90, 0x30, 0x04, 0x30, 0x02, 0xD0, 0x70,
+0x01, 0x30, 0xB0, 0x02, 0x50, 0x40, 0x50, 0x01, 0x30, 0xB0, 0x02, 0x80, 0x50, 0x03, 0x30, 0xB0,
+0x04, 0x50, 0x71, 0x90, 0x40, 0x30, 0x01, 0x90, 0x70, 0x31, 0x90, 0x00, 0xB0, 0x30, 0xD0, 0x00,
+0x40, 0xA0, 0x80, 0xB0, 0x50, 0x30, 0x91, 0xB0, 0x04, 0xB0, 0x30, 0x00, 0xA0, 0x80, 0x50, 0x01,
+0xF0, 0x60, 0xE0, 0x60, 0xA0, 0x90, 0x04, 0x70, 0x02, 0x50, 0x30, 0x80, 0xD0, 0x11, 0xD0, 0xF0,
+0xE0, 0x26, 0x60, 0xC0, 0xE0, 0x28, 0xE0, 0x60, 0xC0, 0xE0, 0xD1, 0x01, 0x30, 0x10, 0x70, 0xC0,
+0xE0, 0x28, 0xC0, 0x60, 0xE0, 0x29, 0xE1, 0x60, 0x70, 0x61, 0x2D, 0x60, 0xC0, 0x2B, 0xC0, 0x60,
+0x26, 0xE0, 0xF0, 0x13, 0xA0, 0x04, 0xA0, 0x04, 0xB0, 0x30, 0x00, 0x50, 0x73, 0x60, 0xE4, 0x60,
+0xA0, 0xB0, 0x03, 0x90, 0x0A, 0x40, 0xB0, 0x06, 0x40, 0x0B, 0x40, 0xB0, 0x0C, 0xB0, 0x40, 0x0F,
+0x01, 0xB0, 0x40, 0xB0, 0x02, 0xB0, 0x10, 0x80, 0x02, 0x90, 0x30, 0x0A, 0x50, 0x40, 0xB0, 0x0F,
+0x0E, 0xB0, 0x41, 0xB0, 0x06, 0xD0, 0xB0, 0x01, 0x80, 0x50, 0x0F, 0x0A, 0x0F, 0x02, 0x40, 0x30,
+0x80, 0x03, 0x90, 0x70, 0x01, 0x50, 0x11, 0x30, 0x00, 0x50, 0x80, 0x04, 0x50, 0x40, 0x50, 0x30,
+0x03, 0x41, 0x04, 0x10, 0x50, 0x03, 0x11, 0x30, 0x12, 0xA0, 0x00, 0xA0, 0x01, 0x80, 0x00, 0x30,
+0xD0, 0x00, 0x90, 0xD0, 0x90, 0x02, 0x70, 0xB1, 0x50, 0x05, 0x30, 0x40, 0x01, 0xA0, 0xD0, 0x90,
+0x01, 0xA0, 0x50, 0x10, 0xA0, 0x70, 0x04, 0xB0, 0xA0, 0x02, 0xB0, 0x90, 0x01, 0x80, 0x70, 0xC0,
+0x27, 0xE0, 0x60, 0xC0, 0xE0, 0x27, 0xE1, 0x60, 0xE0, 0x11, 0xA0, 0x11, 0xF0, 0xE1, 0x2A, 0x60,
+0x29, 0xE1, 0x70, 0x11, 0x70, 0xC0, 0xE2, 0x20, 0xE1, 0x27, 0xC1, 0x2B, 0xC0, 0x60, 0x25, 0xE0,
+0xF0, 0xD0, 0x60, 0x11, 0x80, 0x90, 0x04, 0x80, 0x40, 0x04, 0xA0, 0x41, 0x90, 0x02, 0xD0, 0xC0,
+0xE0, 0x60, 0xA0, 0xF1, 0xA1, 0x02, 0x40, 0x0C, 0x91, 0x04, 0x90, 0x70, 0x80, 0x09, 0x40, 0xB0,
+0x0C, 0x50, 0x90, 0x0F, 0x01, 0x50, 0x40, 0x04, 0x40, 0x10, 0x90, 0x02, 0x40, 0xA0, 0x40, 0x07,
+0xB0, 0x40, 0x50, 0x0F, 0x0E, 0xB0, 0x40, 0x90, 0x09, 0x50, 0xA0, 0x01, 0x40, 0xA0, 0x0F, 0x0A,
+0x0F, 0x03, 0xB0, 0x04, 0x30, 0x90, 0x30, 0x80, 0xD0, 0x60, 0xE0, 0xF0, 0x70, 0x00, 0xA0, 0x06,
+0x40, 0x80, 0x90, 0x03, 0xA0, 0x04, 0xD0, 0x40, 0x02, 0x90, 0x12, 0xA1, 0x10, 0xA0, 0xD0, 0x40,
+0x90, 0x30, 0x10, 0xA0, 0x50, 0x90, 0x80, 0xB0, 0xA0, 0x01, 0x50, 0xA0, 0x01, 0x40, 0x05, 0xA0,
+0x90, 0x02, 0xB0, 0x10, 0x50, 0x90, 0x50, 0xD0, 0x50, 0xF0, 0x70, 0x40, 0xA0, 0x04, 0x90, 0x30,
+0x03, 0x40, 0x90, 0xA0, 0x60, 0xE0, 0x29, 0x60, 0xC0, 0x29, 0xE0, 0x60, 0x70, 0x11, 0xD0, 0xC0,
+0xE1, 0x2C, 0x60, 0xE0, 0x28, 0x60, 0x10, 0xD0, 0x30, 0x70, 0x80, 0xF0, 0xA0, 0x60, 0xE0, 0xF0,
+0x60, 0xE0, 0x27, 0x60, 0x2B, 0xC0, 0x60, 0x26, 0xC1, 0x60, 0x10, 0xD0, 0x50, 0x90, 0x05, 0xA0,
+0x05, 0x80, 0x30, 0x70, 0x10, 0x80, 0x00, 0x30, 0xF0, 0x71, 0x50, 0x70, 0x91, 0x02, 0xB0, 0x90,
+0x0D, 0xB0, 0x40, 0x02, 0x90, 0xB0, 0x50, 0x10, 0xB0, 0x07, 0x40, 0xB0, 0x0C, 0x90, 0x50, 0x0F,
+0x00, 0xB0, 0x40, 0x50, 0x04, 0x50, 0x10, 0xA0, 0x03, 0xB0, 0x40, 0x31, 0x50, 0x03, 0xB0, 0x40,
+0x90, 0x0F, 0x0E, 0x50, 0x40, 0x50, 0x0B, 0x40, 0x10, 0x80, 0xA0, 0x40, 0x30, 0xB0, 0x0F, 0x09,
+0x0F, 0x01, 0x40, 0xD1, 0x70, 0x40, 0x01, 0xB0, 0x30, 0x01, 0x50, 0x10, 0xE2, 0xA0, 0x00, 0x30,
+0xB0, 0x04, 0xB0, 0xA0, 0x00, 0xB0, 0x40, 0x90, 0xB0, 0x00, 0x30, 0xB0, 0x03, 0x40, 0x70, 0x00,
+0x50, 0x30, 0x80, 0x11, 0xD0, 0x30, 0x70, 0x30, 0x01, 0xB0, 0xD0, 0x11, 0x30, 0x01, 0xA0, 0x50,
+0x80, 0x40, 0xB0, 0xA0, 0x50, 0x91, 0xB0, 0x03, 0xB0, 0xA0, 0xB0, 0x03, 0x50, 0xD0, 0xA0, 0x80,
+0x30, 0xA0, 0x50, 0xF0, 0x40, 0x60, 0x30, 0x90, 0x04, 0x40, 0x80, 0x03, 0x80, 0x70, 0x30, 0xE0,
+0x2A, 0x60, 0xC0, 0xE0, 0x27, 0xE1, 0xF0, 0x10, 0xA0, 0xC0, 0xE0, 0x2D, 0xE0, 0x60, 0xC0, 0x28,
+0xC0, 0x60, 0xA0, 0x11, 0x70, 0xA0, 0x80, 0x10, 0xD0, 0xA0, 0xD1, 0xE0, 0x25, 0xE0, 0x60, 0x2B,
+0xC0, 0x60, 0x27, 0xE0, 0x70, 0x10, 0xD0, 0x40, 0x50, 0x05, 0x30, 0x05, 0x50, 0xA0, 0x00, 0x40,
+0xA0, 0x01, 0x70, 0x80, 0x40, 0xA0, 0x70, 0x40, 0x03, 0x40, 0x0F, 0x01, 0x40, 0xB0, 0x50, 0x90,
+0x00, 0x50, 0x10, 0x30, 0x06, 0x40, 0xB0, 0x0C, 0x40, 0x50, 0x0F, 0x00, 0x50, 0x40, 0xB0, 0x05,
+0x10, 0x30, 0x06, 0x90, 0x50, 0x80, 0xA0, 0x50, 0x00, 0x50, 0x40, 0xB0, 0x0F, 0x0D, 0x50, 0x40,
+0x50, 0x0D, 0x32, 0x01, 0x50, 0x80, 0x0F, 0x09, 0x0F, 0x01, 0x70, 0xB0, 0x00, 0x50, 0x30, 0xD0,
+0x00, 0x80, 0x50, 0x01, 0xF0, 0xA0, 0xE1, 0x60, 0x80, 0x00, 0xB0, 0x30, 0x04, 0x80, 0x50, 0x02,
+0xB0, 0x91, 0x30, 0x05, 0x30, 0x50, 0x00, 0x11, 0x70, 0x10, 0x30, 0x40, 0xD1, 0xA0, 0x70, 0x10,
+0xC0, 0x60, 0xD0, 0x71, 0x00, 0x30, 0x80, 0x00, 0x80, 0xA1, 0x30, 0xD0, 0x70, 0x90, 0x30, 0x02,
+0x30, 0x90, 0x05, 0x80, 0x10, 0xF0, 0x60, 0xC0, 0x60, 0xA0, 0x90, 0xF0, 0xC0, 0xD0, 0x05, 0x30,
+0x50, 0x03, 0x90, 0x70, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0xE0, 0x27, 0xE0, 0xC0, 0x60, 0x90, 0xE1,
+0x2F, 0x00, 0x60, 0x27, 0xE0, 0x70, 0x10, 0xD0, 0x30, 0xA0, 0x00, 0xB0, 0x50, 0x40, 0x01, 0x40,
+0x70, 0xE0, 0x25, 0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x26, 0xE0, 0x60, 0x10, 0x50, 0x80, 0x40, 0xB0,
+0x05, 0x90, 0x80, 0x04, 0x40, 0xA0, 0x04, 0x50, 0xD0, 0x70, 0x81, 0xD0, 0x02, 0x51, 0x0F, 0x02,
+0x41, 0x02, 0x70, 0x11, 0x40, 0x03, 0x40, 0xB0, 0x0C, 0x40, 0xB0, 0x0F, 0x00, 0x91, 0x05, 0xB0,
+0x10, 0xA0, 0x07, 0xB0, 0x50, 0x00, 0x50, 0xA0, 0x90, 0xB0, 0x0F, 0x0D, 0x50, 0x40, 0x50, 0x04,
+0x80, 0x90, 0x08, 0x80, 0x90, 0xD0, 0x02, 0xA0, 0x0F, 0x09, 0x0F, 0x01, 0xD0, 0xB0, 0x02, 0x90,
+0x30, 0xA0, 0x31, 0xB0, 0x10, 0xE2, 0x70, 0xB0, 0x01, 0x30, 0xB0, 0x01, 0x50, 0x80, 0x11, 0x04,
+0x50, 0x80, 0x40, 0xB0, 0x04, 0x30, 0x80, 0x11, 0xD0, 0x10, 0xA0, 0x10, 0x90, 0xC0, 0x61, 0xE2,
+0x60, 0x11, 0xD0, 0xA0, 0x30, 0x80, 0xD0, 0x61, 0xC1, 0x60, 0x11, 0x80, 0x00, 0x50, 0x30, 0x04,
+0x90, 0x10, 0xF1, 0xE3, 0x60, 0xF1, 0xE0, 0xC0, 0x70, 0x05, 0xA0, 0x50, 0x02, 0x30, 0xF0, 0x60,
+0xE1, 0x28, 0xE1, 0x60, 0xC0, 0xE0, 0x25, 0xE0, 0x20, 0x60, 0xC0, 0x60, 0xE0, 0x2F, 0x01, 0xC1,
+0x27, 0xE0, 0x60, 0x70, 0x03, 0x40, 0x02, 0x90, 0x10, 0xE0, 0x25, 0xE0, 0x60, 0x2B, 0xC1, 0x26,
+0xE0, 0xD0, 0x80, 0x00, 0x30, 0x90, 0xD0, 0x90, 0x03, 0x90, 0xA0, 0x70, 0xD0, 0x90, 0x01, 0x50,
+0xB0, 0x30, 0x40, 0x06, 0x40, 0x30, 0x50, 0x02, 0x40, 0x0F, 0x03, 0x40, 0x91, 0x03, 0x80, 0x70,
+0x02, 0x40, 0xB0, 0x0B, 0xB0, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0xB0, 0x06, 0x71, 0x09, 0x90, 0xB0,
+0x90, 0x30, 0x0F, 0x0D, 0x90, 0x40, 0xB0, 0x06, 0x51, 0x08, 0x50, 0x80, 0x30, 0x40, 0x80, 0xA0,
+0x30, 0x40, 0x04, 0x40, 0x30, 0x0F, 0x01, 0x0F, 0x01, 0x50, 0xD0, 0x30, 0x50, 0x00, 0x40, 0xD0,
+0x90, 0x01, 0x71, 0xE0, 0x20, 0xE0, 0xA0, 0x02, 0xD1, 0x80, 0x10, 0xD0, 0x72, 0xD0, 0x80, 0xB0,
+0x40, 0xB0, 0x80, 0x50, 0x00, 0x50, 0x40, 0x50, 0x01, 0xA0, 0x80, 0x30, 0x70, 0xA0, 0xF0, 0x61,
+0xE3, 0x23, 0xE0, 0xC0, 0xA0, 0xF0, 0x10, 0x80, 0xA0, 0xE2, 0x61, 0xC0, 0xE0, 0x60, 0xD0, 0xA0,
+0x30, 0x70, 0x04, 0x30, 0xF0, 0xE1, 0x23, 0xE0, 0xF0, 0x60, 0xC0, 0xE0, 0xC0, 0x71, 0x10, 0xD1,
+0x40, 0x00, 0x70, 0x00, 0x30, 0x10, 0xA0, 0xE0, 0xC0, 0x60, 0x20, 0xE0, 0x28, 0xE0, 0x20, 0x60,
+0xC0, 0x24, 0xE0, 0xC0, 0x60, 0xE1, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0x60, 0x26, 0xE0, 0xC0, 0xF0,
+0x10, 0xB0, 0x02, 0x90, 0xB0, 0x02, 0x70, 0x60, 0xE0, 0x24, 0xE0, 0xC0, 0x2B, 0xC1, 0xE0, 0x26,
+0xD0, 0x10, 0xA0, 0x91, 0x40, 0x10, 0xB0, 0x02, 0x10, 0x60, 0xE0, 0x90, 0xD0, 0x01, 0x90, 0x01,
+0xD0, 0xB0, 0x03, 0xA0, 0x80, 0xB0, 0x03, 0x90, 0xB0, 0x0F, 0x02, 0x40, 0x01, 0x50, 0x90, 0x01,
+0x40, 0x90, 0x02, 0x40, 0xB0, 0x0B, 0x50, 0x40, 0x09, 0xB0, 0x10, 0x03, 0x91, 0x07, 0x30, 0xD0,
+0x80, 0x09, 0x90, 0x80, 0x00, 0x50, 0xA0, 0x50, 0x0F, 0x08, 0xB0, 0x90, 0x40, 0x0F, 0x05, 0x50,
+0x80, 0x00, 0x10, 0xB0, 0x01, 0xA0, 0x05, 0x70, 0x0F, 0x01, 0x0F, 0x03, 0x40, 0x71, 0x30, 0xA0,
+0x02, 0x70, 0x60, 0xE0, 0x20, 0xE0, 0xA0, 0x02, 0x40, 0x30, 0x10, 0xC0, 0xE3, 0xC0, 0xF0, 0x70,
+0x10, 0xF0, 0xD0, 0x50, 0x02, 0x50, 0x80, 0x50, 0x10, 0xD0, 0x10, 0x60, 0xE1, 0x2A, 0xE2, 0xF0,
+0x10, 0xD0, 0xF0, 0xE1, 0x60, 0xE0, 0x61, 0xE1, 0x80, 0x10, 0xA0, 0x10, 0x90, 0x01, 0x50, 0xD1,
+0xF0, 0xE0, 0x24, 0xE1, 0x61, 0xE1, 0xC1, 0xE0, 0x90, 0x80, 0x10, 0x80, 0x00, 0xA0, 0x70, 0xE2,
+0xC0, 0x60, 0x20, 0xE0, 0x28, 0xE1, 0x60, 0xC0, 0xE0, 0x20, 0xE1, 0xC0, 0x60, 0xE0, 0x22, 0x60,
+0xC0, 0xE0, 0x2E, 0xE0, 0xC0, 0x60, 0xE0, 0x24, 0xE0, 0x60, 0x10, 0x80, 0x03, 0xB0, 0x90, 0x01,
+0x90, 0x10, 0xE0, 0x25, 0xE0, 0xC1, 0x2A, 0xC1, 0x25, 0xE0, 0x60, 0x10, 0x80, 0xD0, 0x00, 0x90,
+0x00, 0x40, 0xB0, 0x01, 0x40, 0xD0, 0xE1, 0xF0, 0x10, 0x50, 0x00, 0x80, 0x50, 0xB0, 0x50, 0xA0,
+0xB0, 0x01, 0xB0, 0xA0, 0x10, 0x80, 0x02, 0xB0, 0x90, 0x0F, 0x02, 0x40, 0xB0, 0x02, 0x50, 0x40,
+0x01, 0x10, 0x50, 0x00, 0x40, 0xB0, 0x0B, 0x91, 0x0A, 0x50, 0x10, 0x90, 0x00, 0xB0, 0x40, 0xB0,
+0x08, 0x30, 0x80, 0x90, 0x07, 0xA0, 0x40, 0x00, 0x50, 0xB0, 0x01, 0xA0, 0x0F, 0x06, 0xB0, 0x91,
+0xB0, 0x0F, 0x06, 0x40, 0x90, 0x00, 0x70, 0x02, 0x30, 0x50, 0x40, 0x31, 0x80, 0x50, 0xA0, 0x90,
+0x0F, 0x00, 0x0E, 0xB0, 0x70, 0xD0, 0x70, 0x90, 0x02, 0xD0, 0x30, 0xB1, 0x10, 0xE2, 0xA0, 0x90,
+0x01, 0x80, 0x10, 0xA0, 0xE1, 0x21, 0xE0, 0x20, 0xE4, 0x60, 0xD0, 0x70, 0xD0, 0x30, 0x80, 0x70,
+0x31, 0xD0, 0xA0, 0xE1, 0x2D, 0xE0, 0x60, 0xA0, 0xD0, 0xC0, 0xE0, 0xC1, 0xE1, 0xC0, 0x61, 0xE0,
+0x60, 0x50, 0x80, 0xA0, 0x81, 0x71, 0x10, 0xE0, 0x21, 0xE1, 0x23, 0xE0, 0xC0, 0x60, 0xC0, 0xE2,
+0xC0, 0x40, 0x10, 0xD0, 0xA0, 0x70, 0xE2, 0x22, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0xC0, 0xE1, 0xC0,
+0x60, 0x25, 0x60, 0x20, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0x25, 0xE0, 0xC0, 0xA0, 0x70, 0x03, 0x90,
+0xB0, 0x90, 0x10, 0xF0, 0xE1, 0x26, 0x60, 0xE0, 0x29, 0xC1, 0x25, 0xE0, 0xF0, 0xD0, 0x00, 0x30,
+0xB0, 0x50, 0x04, 0x40, 0x30, 0xE1, 0xF0, 0x90, 0x00, 0x50, 0x12, 0x90, 0x30, 0x50, 0x01, 0x80,
+0x10, 0x80, 0xA0, 0x01, 0x50, 0x40, 0x0F, 0x02, 0x90, 0x50, 0x04, 0xB0, 0x40, 0x00, 0x10, 0xB0,
+0x90, 0xB0, 0x0B, 0x40, 0x50, 0x0C, 0x80, 0x00, 0x50, 0x40, 0x0A, 0x80, 0x40, 0x30, 0x05, 0xB0,
+0xA0, 0x40, 0x02, 0x40, 0x01, 0x30, 0x0F, 0x04, 0xB0, 0x40, 0x90, 0xB0, 0x0F, 0x00, 0xD0, 0x06,
+0xB0, 0x30, 0x00, 0x40, 0x30, 0x00, 0x40, 0xA0, 0x70, 0x30, 0x80, 0x40, 0x80, 0xA0, 0xD0, 0x30,
+0x0F, 0x00, 0x0E, 0x70, 0xB0, 0x00, 0x80, 0xD1, 0x00, 0x40, 0x50, 0xB0, 0x80, 0xD0, 0x30, 0x50,
+0x60, 0x70, 0x80, 0x01, 0xB0, 0x10, 0xA0, 0xE1, 0x2A, 0xE1, 0xC0, 0x11, 0x70, 0xD0, 0x10, 0xD0,
+0xC0, 0x60, 0x2E, 0xE0, 0xC0, 0xF0, 0xE1, 0x20, 0x60, 0x22, 0xE2, 0x60, 0xD0, 0x10, 0x70, 0x80,
+0x11, 0xD0, 0x10, 0x70, 0xC0, 0xE0, 0x20, 0xF0, 0xA0, 0x24, 0xE1, 0x60, 0xC0, 0x60, 0x70, 0xA0,
+0x80, 0x00, 0xD0, 0x10, 0x60, 0x20, 0xE0, 0x24, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0xC1, 0x60, 0xE0,
+0x26, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0x60, 0xE0, 0x26, 0xE0, 0xA0, 0x80, 0x00, 0x32, 0xA1, 0xC0,
+0xE0, 0x27, 0xE0, 0x60, 0xE0, 0x29, 0xC1, 0x24, 0xE1, 0xA0, 0x10, 0x00, 0x30, 0x51, 0x04, 0x50,
+0x10, 0xE1, 0x70, 0xB0, 0x00, 0x40, 0x02, 0x40, 0x80, 0x30, 0x80, 0x03, 0x11, 0x90, 0xA0, 0x50,
+0x0F, 0x01, 0x50, 0x90, 0x06, 0xB0, 0x40, 0x10, 0x40, 0xB0, 0x0B, 0x40, 0xB0, 0x0E, 0x40, 0x50,
+0x0B, 0x31, 0xA0, 0x03, 0xB0, 0x40, 0x50, 0xB0, 0x02, 0xD0, 0x50, 0xB0, 0x50, 0x80, 0x0F, 0x02,
+0x50, 0x40, 0x90, 0x0F, 0x02, 0x30, 0xD0, 0xB0, 0x06, 0xA0, 0x01, 0x10, 0x30, 0x40, 0x00, 0x30,
+0x0F, 0x07, 0x0E, 0xD0, 0x01, 0x50, 0x80, 0x90, 0x31, 0x02, 0xD0, 0x90, 0x30, 0x10, 0x04, 0xA0,
+0xE1, 0x2D, 0xE0, 0x60, 0x70, 0xD0, 0xA0, 0xD0, 0x60, 0xE0, 0xC0, 0x61, 0xC0, 0xE0, 0x2C, 0xE0,
+0x20, 0xE0, 0x60, 0xC0, 0x23, 0xE0, 0xC0, 0x70, 0xB0, 0x40, 0x51, 0x10, 0x30, 0x50, 0x70, 0x10,
+0x70, 0xE0, 0xC0, 0x70, 0xF0, 0x23, 0xE1, 0xC0, 0xF0, 0x70, 0x30, 0x01, 0x40, 0x10, 0xA0, 0xC0,
+0xE0, 0x26, 0xE0, 0x61, 0xE1, 0x27, 0xE1, 0x61, 0xE0, 0x27, 0xC0, 0x60, 0xE0, 0x2D, 0xE1, 0xC1,
+0x27, 0xE0, 0x60, 0xD0, 0x60, 0xC2, 0xE2, 0x27, 0xE0, 0x60, 0xE0, 0x29, 0xC1, 0x24, 0xE0, 0x11,
+0xB0, 0x50, 0xA0, 0xB1, 0x05, 0xA0, 0xE0, 0xC0, 0xA0, 0x01, 0x90, 0xB0, 0x70, 0x00, 0x90, 0x10,
+0xD0, 0x10, 0x30, 0x01, 0x30, 0x11, 0xD0, 0x50, 0x01, 0x40, 0x30, 0x0C, 0x50, 0x90, 0x08, 0xB0,
+0x80, 0xB0, 0x0A, 0xB0, 0x40, 0x0E, 0x50, 0x40, 0x0D, 0xB0, 0xA0, 0x81, 0x01, 0x40, 0x90, 0x04,
+0x80, 0xD0, 0x00, 0x90, 0x40, 0x90, 0x0F, 0x00, 0x50, 0x40, 0x50, 0x0F, 0x00, 0xD0, 0x30, 0x01,
+0x90, 0x70, 0x07, 0x30, 0x90, 0x00, 0xA0, 0x50, 0x01, 0x40, 0x50, 0x02, 0x50, 0x41, 0x0F, 0x00,
+0x0E, 0x40, 0xD0, 0x30, 0x70, 0x50, 0xB0, 0xD0, 0x10, 0xA0, 0x50, 0x90, 0xD0, 0x90, 0x10, 0xA0,
+0x03, 0x40, 0xF0, 0xE0, 0x2E, 0xE3, 0xF0, 0x60, 0xE0, 0x23, 0x61, 0xC0, 0xE0, 0x2C, 0xE0, 0x60,
+0xE0, 0x23, 0xE0, 0x60, 0x70, 0x01, 0x51, 0xA0, 0xD0, 0x40, 0xD2, 0xA0, 0xE2, 0x21, 0xE1, 0x70,
+0xD0, 0x70, 0x10, 0xB1, 0x30, 0x70, 0x80, 0xF0, 0x60, 0xE0, 0x28, 0xE0, 0xC0, 0x60, 0x20, 0xE0,
+0x26, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0x28, 0xE2, 0x20,
+0xE0, 0x60, 0xE0, 0x2A, 0x60, 0xC0, 0x29, 0xC1, 0x24, 0xE0, 0x10, 0x70, 0x01, 0x10, 0xA0, 0x40,
+0x04, 0x40, 0xF0, 0xE0, 0xD0, 0xB0, 0x00, 0x50, 0x90, 0x00, 0x11, 0x40, 0x00, 0x30, 0x90, 0x30,
+0x02, 0x30, 0xD0, 0x40, 0x30, 0xB0, 0x00, 0xB0, 0x50, 0xB0, 0x0B, 0x40, 0x0A, 0xB0, 0x40, 0x09,
+0x50, 0x90, 0x0E, 0x40, 0x50, 0x0F, 0x00, 0x40, 0x80, 0x10, 0x40, 0x90, 0xB0, 0x04, 0xB0, 0x30,
+0x40, 0x50, 0xB0, 0x30, 0x50, 0x0D, 0x50, 0x40, 0xB0, 0x0F, 0x01, 0xB0, 0x10, 0x40, 0x0B, 0x41,
+0x00, 0x90, 0xA0, 0xB0, 0x80, 0x10, 0x30, 0x00, 0x90, 0xD0, 0x70, 0x80, 0x31, 0x0E, 0x0D, 0x50,
+0x80, 0x90, 0x40, 0x50, 0x40, 0xD0, 0x30, 0x70, 0x12, 0x60, 0xA0, 0x90, 0x04, 0xA0, 0xE1, 0x2F,
+0x03, 0xE0, 0x25, 0xE0, 0x20, 0x61, 0xC0, 0xE1, 0x29, 0x60, 0xC0, 0x26, 0x10, 0x70, 0xA0, 0x70,
+0x10, 0x40, 0x50, 0x00, 0x80, 0xA0, 0x50, 0xC0, 0xF0, 0xA0, 0x70, 0xE1, 0xF0, 0xA0, 0x70, 0x30,
+0xA0, 0x10, 0xA0, 0x40, 0x80, 0xA0, 0x60, 0xE1, 0x2A, 0xE0, 0xC0, 0x60, 0xE0, 0x25, 0xE0, 0xC0,
+0x60, 0x2B, 0xE0, 0x60, 0xC0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2A, 0xE0, 0xC1, 0x2A, 0xC1, 0x29,
+0xC1, 0xE0, 0x22, 0xE0, 0xA0, 0x30, 0x90, 0xB0, 0xA0, 0x30, 0x80, 0x10, 0xB0, 0x02, 0x50, 0x70,
+0xE0, 0x40, 0xD0, 0x01, 0x90, 0x70, 0x12, 0xD1, 0x10, 0x90, 0x40, 0x03, 0x80, 0x30, 0x80, 0xA0,
+0x01, 0xB0, 0x10, 0x0A, 0x40, 0x0C, 0xB0, 0x40, 0x07, 0x50, 0x90, 0x0D, 0xB0, 0x40, 0xB0, 0x0F,
+0x03, 0x90, 0xB0, 0x06, 0x40, 0x80, 0xA0, 0x01, 0x40, 0x80, 0x0B, 0x90, 0x40, 0xB0, 0x0F, 0x04,
+0xB0, 0x07, 0xA0, 0x30, 0x02, 0x80, 0xB0, 0x01, 0xD0, 0x11, 0xD0, 0xA0, 0x40, 0xD0, 0xB0, 0x02,
+0xD0, 0x0E, 0x0C, 0x90, 0xD0, 0x80, 0x10, 0x03, 0xA0, 0x01, 0x40, 0xD0, 0x40, 0x30, 0xB0, 0x03,
+0xD0, 0xF0, 0xE0, 0x2F, 0x0D, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x26, 0xE0, 0x20, 0x60, 0xE0, 0x26,
+0xE0, 0xC1, 0xE0, 0x30, 0x10, 0x80, 0x90, 0x00, 0x30, 0xD0, 0xF0, 0x90, 0xF0, 0xA0, 0xE1, 0x70,
+0x02, 0x90, 0x80, 0x90, 0x00, 0x10, 0x70, 0x61, 0x20, 0xE0, 0x2C, 0x60, 0x20, 0xE0, 0x22, 0xE0,
+0xC0, 0x60, 0x2A, 0xE0, 0x21, 0xE0, 0x60, 0xC0, 0x2D, 0xE0, 0x20, 0x60, 0x2B, 0xE0, 0x20, 0x60,
+0xE0, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x21, 0xE0, 0x61, 0x11, 0x70, 0x30, 0x10, 0x00, 0x50, 0x90,
+0xB0, 0x01, 0xB0, 0x10, 0xE0, 0xC0, 0x10, 0xB0, 0x00, 0xB0, 0x50, 0x00, 0x11, 0x30, 0x12, 0xD0,
+0x80, 0x40, 0x02, 0x50, 0x11, 0x40, 0x00, 0xB0, 0x90, 0x0A, 0x40, 0xB0, 0x0D, 0xB0, 0x40, 0x05,
+0x40, 0x50, 0x0D, 0x91, 0x0F, 0x03, 0x40, 0x90, 0x08, 0x30, 0xA0, 0x02, 0x90, 0x40, 0x08, 0xB0,
+0x41, 0xB0, 0x0F, 0x0F, 0x10, 0xD0, 0x00, 0xB0, 0xD0, 0x10, 0x30, 0x40, 0x90, 0x80, 0xA0, 0x50,
+0x00, 0x90, 0x10, 0xB0, 0x02, 0x80, 0xA0, 0x0E, 0x0C, 0x30, 0x50, 0x00, 0x40, 0x30, 0x00, 0x80,
+0xA0, 0x40, 0x01, 0x40, 0x70, 0xF0, 0x10, 0xB0, 0x40, 0x90, 0xB0, 0xA0, 0x10, 0xC0, 0xE0, 0x2F,
+0x11, 0xC0, 0x61, 0xE1, 0x23, 0xE0, 0x60, 0x29, 0xE4, 0xF0, 0xA0, 0x30, 0x80, 0x70, 0x11, 0xA0,
+0xE0, 0x20, 0xE1, 0xD0, 0x40, 0x04, 0x90, 0x10, 0xF0, 0xE0, 0x60, 0xC0, 0xE0, 0x2C, 0x60, 0xC0,
+0xE2, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0xC0, 0xE0, 0x2B, 0xE0, 0x20, 0xC0, 0x60, 0xE0, 0x2A,
+0xE0, 0x60, 0x2A, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x20, 0xE0, 0xC0, 0xD0, 0x11, 0xD0, 0xB0, 0x30,
+0x80, 0x40, 0x30, 0x02, 0x50, 0xD0, 0x60, 0xE0, 0xC0, 0xA0, 0x01, 0x91, 0xB0, 0x71, 0xB1, 0x11,
+0x70, 0x30, 0x90, 0xA0, 0x30, 0xB0, 0x90, 0x03, 0x30, 0x10, 0x00, 0xA0, 0x10, 0xB0, 0x05, 0x90,
+0xB0, 0x0A, 0xB0, 0x40, 0x02, 0xB0, 0x90, 0x03, 0x40, 0xB0, 0x0C, 0xB0, 0x40, 0xB0, 0x0F, 0x02,
+0x90, 0x40, 0x0F, 0x00, 0xA0, 0x40, 0x06, 0xB0, 0x40, 0x90, 0x0F, 0x15, 0x30, 0x41, 0x50, 0xD0,
+0x50, 0xB0, 0xD0, 0x02, 0xD0, 0xA0, 0x40, 0xA0, 0x10, 0x30, 0x00, 0xB0, 0x0D, 0x0C, 0x80, 0x30,
+0x01, 0xD0, 0xB0, 0x70, 0x32, 0x90, 0x70, 0x40, 0x10, 0x40, 0x02, 0x90, 0x70, 0x60, 0xE1, 0x2F,
+0x11, 0xE1, 0xC0, 0x60, 0xC0, 0x22, 0xE0, 0xC0, 0x60, 0x2E, 0xE1, 0xF0, 0xD0, 0xA1, 0xF0, 0xA0,
+0xE0, 0x22, 0xE0, 0x70, 0x04, 0xA0, 0xD0, 0x10, 0xA0, 0xE0, 0xC0, 0x60, 0x2B, 0xE1, 0xC0, 0x60,
+0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x02, 0x60, 0x2E, 0xE0, 0x60, 0xC0, 0x2B, 0xC1, 0x25, 0xE1, 0x21,
+0xE0, 0x60, 0x2A, 0xC0, 0xE0, 0x20, 0xA0, 0x10, 0x80, 0x02, 0x30, 0x00, 0x50, 0xD0, 0x02, 0x90,
+0x10, 0xE0, 0x20, 0xE0, 0xA0, 0x01, 0x80, 0x10, 0xA0, 0x14, 0xD0, 0x30, 0xA0, 0x01, 0x50, 0xA0,
+0x08, 0xB0, 0x05, 0x51, 0x0B, 0x30, 0x10, 0x03, 0x51, 0x00, 0xB0, 0x40, 0x0D, 0x50, 0x90, 0x0F,
+0x02, 0x50, 0x40, 0xB0, 0x0F, 0x00, 0x80, 0x90, 0xB0, 0x50, 0x03, 0xB0, 0x40, 0x90, 0x0F, 0x15,
+0x50, 0x30, 0x40, 0xB0, 0x01, 0xA0, 0x01, 0x70, 0x90, 0x80, 0x30, 0xA0, 0x40, 0x80, 0x90, 0x01,
+0x30, 0x80, 0x90, 0x0C, 0x0D, 0x80, 0x01, 0x33, 0x01, 0x90, 0x10, 0x80, 0x30, 0x00, 0x50, 0x40,
+0x00, 0x70, 0xF0, 0xE0, 0x61, 0xC0, 0xE3, 0x2F, 0x10, 0xC0, 0x61, 0xE1, 0x60, 0xC0, 0x2F, 0x01,
+0xE2, 0xC0, 0xF0, 0x60, 0xE1, 0x21, 0xE0, 0x60, 0x70, 0x05, 0x40, 0xA0, 0xE0, 0x21, 0x60, 0xC0,
+0xE0, 0x2A, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x01, 0xE0, 0xC0, 0x60, 0xE0, 0x2E, 0x60, 0x2B,
+0xE0, 0x60, 0xE0, 0x23, 0xE0, 0x60, 0xA0, 0xC0, 0x20, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0xE0, 0xA0,
+0x11, 0x90, 0x01, 0x50, 0xD0, 0x00, 0x90, 0x50, 0x02, 0x30, 0xF0, 0xE0, 0x20, 0xE0, 0xF0, 0x80,
+0xB0, 0x90, 0xD1, 0x70, 0x10, 0x40, 0xA0, 0x10, 0xD0, 0xB0, 0x40, 0x30, 0x00, 0xB0, 0xA0, 0x06,
+0x90, 0xA0, 0x05, 0xB0, 0x51, 0x0A, 0x50, 0x10, 0x50, 0x04, 0x50, 0x90, 0x40, 0x05, 0xB0, 0x10,
+0x50, 0x04, 0x40, 0x50, 0x0F, 0x01, 0xB0, 0x40, 0x50, 0x0F, 0x02, 0x50, 0x30, 0x00, 0x40, 0x01,
+0xB0, 0x40, 0x50, 0x0F, 0x14, 0xB0, 0x91, 0x30, 0x40, 0x02, 0xB0, 0xA0, 0x01, 0x80, 0x70, 0xB0,
+0x00, 0x50, 0x80, 0x03, 0x30, 0x90, 0x40, 0x0C, 0x0F, 0x01, 0xB0, 0x10, 0x30, 0x90, 0x01, 0x80,
+0xA1, 0x01, 0xA0, 0xD0, 0x30, 0x10, 0xE0, 0x21, 0xE0, 0xC0, 0x61, 0xC0, 0xE0, 0x21, 0xE0, 0x2F,
+0x08, 0xE0, 0x26, 0x62, 0xE1, 0x2F, 0x03, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0xF0,
+0x10, 0x70, 0x02, 0x30, 0x70, 0xF0, 0x22, 0xE0, 0x61, 0xE0, 0x2A, 0xE0, 0x61, 0xE0, 0x2F, 0x02,
+0xE1, 0xC0, 0x60, 0xE0, 0x2C, 0xE0, 0xC1, 0xE0, 0x29, 0xE0, 0x60, 0x24, 0xE0, 0xA0, 0x10, 0xC0,
+0x20, 0xE0, 0xC1, 0x29, 0xC0, 0x70, 0x10, 0x70, 0xB0, 0x03, 0x80, 0x50, 0x90, 0x03, 0x40, 0x60,
+0xE0, 0x21, 0xE0, 0x70, 0x90, 0xB0, 0x11, 0x50, 0x10, 0x30, 0x00, 0xB0, 0x10, 0xB0, 0x00, 0x90,
+0xA0, 0x30, 0x40, 0x06, 0x70, 0x10, 0x30, 0xB0, 0x03, 0x41, 0xD0, 0x09, 0xA0, 0x10, 0x50, 0x05,
+0x50, 0x80, 0xB0, 0x06, 0x30, 0x50, 0x02, 0x50, 0x40, 0x0F, 0x02, 0x40, 0x90, 0x0F, 0x05, 0xD0,
+0x00, 0xB0, 0x41, 0x50, 0x0F, 0x0D, 0x80, 0x10, 0x04, 0x41, 0x90, 0x01, 0x30, 0x03, 0x30, 0xB0,
+0x02, 0x10, 0x02, 0x30, 0x03, 0x50, 0x40, 0x0D, 0x0F, 0x03, 0xA0, 0x30, 0x40, 0x00, 0x70, 0x40,
+0xA0, 0xB0, 0x00, 0x40, 0x50, 0x70, 0x60, 0xE0, 0x24, 0xE0, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x0E,
+0xE1, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x04, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0xA0, 0x60, 0xA0, 0xD0,
+0x50, 0x00, 0x40, 0x10, 0xF0, 0xE0, 0x25, 0x60, 0xC0, 0xE0, 0x28, 0x60, 0xC0, 0xE0, 0x60, 0xC0,
+0xE0, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0xE0, 0x2D, 0x60, 0x2B, 0xC1, 0x23, 0xE0, 0x60, 0x70, 0xE1,
+0x20, 0xC1, 0x27, 0xE0, 0xC0, 0x70, 0x11, 0x40, 0x00, 0x40, 0x02, 0x40, 0x91, 0x03, 0x30, 0xF0,
+0xE0, 0x21, 0xE0, 0xA0, 0x40, 0x01, 0xA0, 0x01, 0xB0, 0x30, 0xA0, 0x70, 0xA0, 0xD0, 0x82, 0x07,
+0xD0, 0x10, 0x30, 0x10, 0x02, 0x40, 0x00, 0x30, 0x10, 0x50, 0x08, 0x10, 0xA0, 0x05, 0x40, 0x50,
+0x00, 0x40, 0x0A, 0x40, 0x50, 0x0F, 0x01, 0x90, 0x40, 0x0F, 0x05, 0x50, 0x70, 0x80, 0x50, 0x41,
+0x0F, 0x10, 0xD0, 0xB0, 0x00, 0x50, 0x40, 0x90, 0x04, 0x80, 0x50, 0x01, 0x40, 0x30, 0x03, 0x70,
+0x00, 0x50, 0x80, 0x10, 0x0F, 0x04, 0x0F, 0x03, 0x30, 0x00, 0x40, 0x30, 0x10, 0x50, 0xA0, 0x02,
+0x60, 0xF0, 0xE0, 0x27, 0xE0, 0x20, 0xC0, 0x61, 0x2F, 0x0F, 0xE0, 0x60, 0xE1, 0xC0, 0x60, 0xC0,
+0x2F, 0x05, 0xE1, 0x62, 0x10, 0xD0, 0x10, 0x70, 0x80, 0x10, 0xD0, 0x10, 0xE0, 0x25, 0xE0, 0x60,
+0xC0, 0x27, 0xC0, 0x60, 0xE1, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0xE0, 0x2B,
+0xE0, 0xC0, 0x60, 0x2B, 0x60, 0xE0, 0x23, 0xC0, 0x60, 0xE0, 0x22, 0x60, 0xE0, 0x27, 0xC0, 0x70,
+0x10, 0x80, 0x00, 0xB0, 0xA0, 0x02, 0x50, 0x30, 0xA0, 0x50, 0x02, 0x40, 0x60, 0xE0, 0x21, 0xE0,
+0xF0, 0x90, 0x03, 0x50, 0xD0, 0xF0, 0xE1, 0x30, 0xA0, 0x40, 0x90, 0x09, 0xB0, 0x70, 0x40, 0x01,
+0x40, 0xB0, 0x01, 0x40, 0xD0, 0x08, 0x80, 0xA0, 0x04, 0x40, 0xB0, 0x02, 0x40, 0x07, 0xB0, 0x40,
+0xB0, 0x0F, 0x00, 0x50, 0x40, 0xB0, 0x0F, 0x06, 0x30, 0x80, 0x40, 0xB0, 0x00, 0xB0, 0x50, 0x0F,
+0x0E, 0x91, 0x40, 0x90, 0xB0, 0x05, 0x90, 0x80, 0x40, 0x01, 0x30, 0xB0, 0x03, 0x30, 0xD0, 0x80,
+0xB0, 0x41, 0x0F, 0x03, 0x0F, 0x02, 0x50, 0x80, 0x01, 0x90, 0xA0, 0x10, 0x50, 0x01, 0xF1, 0xE0,
+0x2B, 0xE0, 0xC0, 0x61, 0xC0, 0xE2, 0x2F, 0x09, 0xC1, 0xE2, 0x20, 0xC0, 0x60, 0xC0, 0xE1, 0x2F,
+0x02, 0xE0, 0x20, 0xC1, 0xF1, 0x60, 0x12, 0xD0, 0xC0, 0xE0, 0x27, 0xC0, 0x60, 0xC0, 0xE0, 0x23,
+0xC0, 0x60, 0xE0, 0x23, 0x61, 0xE0, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0x2C, 0xE0, 0x60, 0x2B, 0x60,
+0xC0, 0x27, 0xE0, 0x20, 0x60, 0xE1, 0x25, 0xE0, 0xC0, 0xD0, 0x81, 0x70, 0x05, 0x80, 0x90, 0x00,
+0x50, 0x01, 0x50, 0xA0, 0xE3, 0xC0, 0xD0, 0xA1, 0x00, 0x80, 0x70, 0x60, 0xE1, 0xF0, 0x70, 0x00,
+0x90, 0xB0, 0x0D, 0x40, 0xB0, 0x0D, 0x80, 0xD0, 0x50, 0x80, 0x00, 0xB0, 0x40, 0x04, 0xB0, 0x90,
+0x05, 0x91, 0x0F, 0x00, 0xB0, 0x40, 0x50, 0x0F, 0x07, 0x90, 0xA0, 0xB0, 0x03, 0x40, 0x0F, 0x0C,
+0xB0, 0x40, 0xD0, 0x90, 0x08, 0xA0, 0x30, 0x70, 0x00, 0x50, 0xA0, 0x03, 0x50, 0x30, 0xA0, 0x02,
+0xA0, 0x0F, 0x03, 0x0F, 0x02, 0x30, 0x40, 0x01, 0xD0, 0xF0, 0xD0, 0x00, 0x40, 0x70, 0x60, 0xE2,
+0x2C, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0xE0, 0x2F, 0x08, 0x60, 0xE0, 0x23, 0xE1, 0xC0, 0x61, 0xE0,
+0x2F, 0x04, 0xE0, 0xC0, 0x60, 0xF0, 0xD0, 0x80, 0x10, 0x70, 0xE0, 0x28, 0xE1, 0x60, 0xC0, 0x23,
+0x60, 0xE0, 0x25, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0x21, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x29,
+0xC0, 0x60, 0x28, 0xE0, 0x60, 0xE0, 0xC0, 0x60, 0x24, 0xE0, 0xC0, 0xD1, 0x10, 0xD0, 0x02, 0x30,
+0xA0, 0x00, 0xA0, 0x01, 0x30, 0x40, 0x01, 0xD0, 0x10, 0xF0, 0x60, 0xD0, 0xC0, 0xF0, 0xA0, 0x11,
+0xF0, 0xE0, 0xA0, 0x70, 0xA0, 0x30, 0xB1, 0x90, 0x0D, 0x90, 0x50, 0x0E, 0x50, 0x11, 0x30, 0xB0,
+0x40, 0x06, 0x90, 0x50, 0x02, 0xB0, 0x40, 0xB0, 0x0F, 0x00, 0x40, 0x90, 0x0F, 0x06, 0xB0, 0x40,
+0x90, 0x00, 0xA0, 0x04, 0x50, 0xB0, 0x0F, 0x08, 0xB0, 0x90, 0x40, 0x51, 0x90, 0x09, 0x70, 0x00,
+0xD0, 0x30, 0x70, 0x00, 0x50, 0xB0, 0x01, 0x30, 0x00, 0x10, 0x02, 0x70, 0x0F, 0x03, 0x0F, 0x02,
+0xA0, 0x40, 0xA0, 0x30, 0xD0, 0xF1, 0x10, 0xF0, 0xE2, 0x60, 0xF0, 0xE0, 0x2F, 0x01, 0xC0, 0x61,
+0xC0, 0xE1, 0x2F, 0x04, 0x60, 0xE0, 0x26, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x02, 0xE1, 0x60,
+0x70, 0x50, 0x70, 0x60, 0x2A, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x60, 0xC0, 0xE0, 0x26, 0xC0, 0x60,
+0x2F, 0x01, 0xE0, 0x21, 0x60, 0x2C, 0xE0, 0x60, 0xC0, 0x29, 0xE0, 0x60, 0xE0, 0x27, 0xE0, 0xC0,
+0x60, 0x10, 0x60, 0x24, 0xE0, 0xC0, 0xD0, 0x80, 0x50, 0xB0, 0x03, 0xD0, 0x40, 0x90, 0xB0, 0x03,
+0x40, 0x70, 0x00, 0xD0, 0xF0, 0xA0, 0xE2, 0xC0, 0xE0, 0xF0, 0xD0, 0x40, 0x01, 0x80, 0x41, 0x02,
+0xD0, 0xA0, 0x08, 0xB0, 0x90, 0x0F, 0x02, 0x30, 0x10, 0x30, 0x08, 0x40, 0x01, 0x90, 0x40, 0x0F,
+0x00, 0x90, 0x40, 0x0F, 0x06, 0x50, 0x40, 0x90, 0x01, 0xB0, 0x30, 0x05, 0x40, 0x0F, 0x05, 0xB0,
+0x50, 0x40, 0x90, 0x0D, 0x40, 0xD0, 0x90, 0x00, 0x50, 0x00, 0x50, 0xD0, 0x70, 0x50, 0x40, 0x80,
+0x00, 0x80, 0x33, 0x50, 0x0F, 0x02, 0x0F, 0x01, 0x50, 0x80, 0x01, 0x40, 0xD0, 0xE0, 0xC1, 0x22,
+0xE0, 0x60, 0x10, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x20, 0x62, 0x2F, 0x02, 0xE0, 0x60, 0x2A, 0xE0,
+0xC0, 0x61, 0x2F, 0x03, 0xE0, 0xC0, 0xD0, 0xF0, 0x60, 0xE1, 0x21, 0xE1, 0x29, 0x62, 0x28, 0xE0,
+0x20, 0x60, 0xC0, 0x2F, 0x01, 0xE0, 0xC0, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0xC0,
+0x28, 0xC0, 0xA0, 0xD0, 0xE0, 0x24, 0xE0, 0xC0, 0x70, 0x11, 0xB0, 0x05, 0x30, 0xB0, 0x05, 0x80,
+0x40, 0xA0, 0xC0, 0xE1, 0x20, 0xE0, 0x60, 0xA0, 0x03, 0x70, 0xA0, 0xB0, 0x02, 0x80, 0xB0, 0x07,
+0xB0, 0x40, 0x0F, 0x03, 0x90, 0xA0, 0xB0, 0x09, 0x41, 0xB0, 0x0E, 0x50, 0x40, 0xB0, 0x0F, 0x05,
+0x50, 0x40, 0x50, 0x04, 0xA0, 0x50, 0x04, 0x40, 0x0F, 0x03, 0x50, 0x40, 0x90, 0xB0, 0x00, 0xB0,
+0x0C, 0x50, 0xA0, 0x00, 0x30, 0x80, 0xB0, 0x80, 0x10, 0x40, 0x00, 0xA0, 0x80, 0x01, 0x50, 0x70,
+0x01, 0xB0, 0x30, 0x0F, 0x02, 0x0F, 0x01, 0x80, 0x50, 0x01, 0xA0, 0xF0, 0xE2, 0x23, 0xE0, 0xF0,
+0x10, 0xF0, 0xE0, 0x2F, 0x02, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x00, 0x60, 0xE0, 0x2B, 0xE0,
+0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0xE0, 0xC0, 0x61, 0x2C, 0xE0, 0x20, 0x60, 0xE1,
+0x2A, 0x60, 0xC0, 0x2F, 0x01, 0xE0, 0x61, 0xE0, 0x2A, 0xE0, 0xC1, 0x2A, 0x60, 0xE0, 0x27, 0xC0,
+0x60, 0xF0, 0xE0, 0x25, 0xC0, 0xA0, 0x10, 0x40, 0x03, 0x90, 0xD0, 0x80, 0x30, 0x04, 0xA0, 0xD0,
+0x11, 0x60, 0xC0, 0xE0, 0x21, 0x71, 0xD0, 0x03, 0x50, 0x70, 0x80, 0x0C, 0x40, 0x0F, 0x03, 0x40,
+0xB0, 0x50, 0x0A, 0x50, 0x90, 0x0D, 0xB0, 0x90, 0x50, 0x0F, 0x05, 0x50, 0x40, 0x50, 0x06, 0x50,
+0x80, 0x00, 0xB0, 0xA0, 0x50, 0x00, 0xB0, 0x90, 0x0E, 0xB0, 0x90, 0x40, 0x50, 0x02, 0xB0, 0x10,
+0xB0, 0x0A, 0x80, 0x30, 0xB0, 0x01, 0x40, 0x70, 0x10, 0xB0, 0x06, 0x70, 0x02, 0xA0, 0x0F, 0x02,
+0x0F, 0x01, 0x70, 0xA0, 0x30, 0xB0, 0x10, 0x60, 0xE0, 0x26, 0xE0, 0xC0, 0xD0, 0x2F, 0x06, 0xE1,
+0xC0, 0x61, 0xC0, 0x2A, 0xE0, 0x60, 0xC0, 0x2E, 0xE0, 0xC0, 0x61, 0xC0, 0xE0, 0x2F, 0x01, 0xE1,
+0xC0, 0x60, 0x21, 0xE1, 0x27, 0xE0, 0x60, 0x20, 0xE0, 0x2B, 0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x00,
+0xE0, 0x60, 0xC0, 0xE0, 0x2A, 0xE0, 0x60, 0x2A, 0x60, 0x27, 0xE1, 0x60, 0xE0, 0x26, 0xE0, 0x70,
+0x10, 0x80, 0x03, 0x40, 0x10, 0xA0, 0x50, 0x00, 0xA0, 0x80, 0x00, 0x11, 0x50, 0xD1, 0x60, 0xC0,
+0x21, 0xE0, 0xD2, 0xA0, 0x90, 0x01, 0x50, 0x80, 0x70, 0x0B, 0x40, 0x0F, 0x03, 0x80, 0xB0, 0x00,
+0x70, 0x0B, 0x40, 0xB0, 0x0B, 0x91, 0xB0, 0xD0, 0x0F, 0x03, 0x90, 0x40, 0x50, 0x09, 0x10, 0x70,
+0xD0, 0xB0, 0xA0, 0x80, 0x00, 0x40, 0x05, 0x40, 0xB0, 0x04, 0x90, 0x40, 0x50, 0x06, 0x50, 0x0A,
+0xB0, 0xD0, 0xB0, 0x03, 0x70, 0x30, 0x00, 0x50, 0x30, 0x04, 0x30, 0x41, 0xA0, 0x70, 0x50, 0x0F,
+0x01, 0x0F, 0x00, 0xB0, 0x30, 0x01, 0xA0, 0xD0, 0xE0, 0x24, 0xE0, 0x21, 0xE1, 0x70, 0xE0, 0x2F,
+0x08, 0xE1, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x26, 0x60, 0xE0, 0x2F, 0x01, 0xE0, 0x20, 0x61, 0xC0,
+0xE1, 0x2F, 0x02, 0x61, 0x20, 0xE0, 0x27, 0xC1, 0xE0, 0x2E, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x00,
+0x60, 0xC0, 0xE0, 0x2B, 0x60, 0x29, 0xC1, 0x20, 0xE4, 0x60, 0x10, 0xC0, 0x60, 0x26, 0xE0, 0xC0,
+0xA0, 0x10, 0x80, 0x03, 0x30, 0xD0, 0x70, 0x90, 0x70, 0xA0, 0xD0, 0x80, 0x01, 0x80, 0xD0, 0x90,
+0x60, 0xE0, 0x21, 0xC0, 0x10, 0xA0, 0xE0, 0xF0, 0x80, 0x00, 0xB0, 0x90, 0x0C, 0x40, 0xB0, 0x0F,
+0x01, 0xB0, 0x40, 0x02, 0xA0, 0x80, 0x0B, 0x40, 0x09, 0x50, 0x40, 0x00, 0x50, 0x11, 0x50, 0x0E,
+0xB0, 0x90, 0x40, 0xB0, 0x0B, 0x40, 0x51, 0x01, 0x80, 0xD0, 0xB0, 0x90, 0x40, 0x02, 0x50, 0x70,
+0x02, 0x92, 0xB0, 0x0D, 0xB0, 0x03, 0x90, 0x80, 0xD0, 0x40, 0x03, 0x80, 0x40, 0x50, 0xD0, 0x30,
+0xD0, 0x04, 0x80, 0x10, 0x90, 0x00, 0x50, 0x80, 0x0F, 0x01, 0x0F, 0x00, 0x40, 0x90, 0x01, 0x80,
+0xA0, 0xE0, 0x22, 0xE1, 0x60, 0x20, 0xE0, 0x60, 0x10, 0x70, 0xE0, 0x2F, 0x0A, 0xE1, 0x20, 0x62,
+0xC0, 0xE0, 0x22, 0xE0, 0xC1, 0x2F, 0x06, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x02, 0xC0, 0x60, 0xC0,
+0x27, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0x60, 0x2F, 0x01, 0xE0, 0x60, 0x2C, 0x60, 0x2A, 0x60,
+0xE0, 0xF0, 0xA0, 0xC0, 0x10, 0x70, 0xA1, 0xE0, 0x60, 0x27, 0xC0, 0xF0, 0x10, 0x80, 0x02, 0x70,
+0xA0, 0xC0, 0xA0, 0x00, 0xD0, 0x70, 0x40, 0x10, 0xB0, 0x50, 0x10, 0x90, 0xC2, 0x21, 0xE0, 0xA1,
+0xE0, 0xC0, 0xA0, 0x00, 0x40, 0x0C, 0x90, 0x50, 0x0F, 0x01, 0x50, 0x90, 0x03, 0x80, 0x40, 0x0B,
+0x50, 0x90, 0x06, 0xB0, 0x40, 0x50, 0x01, 0x70, 0x30, 0x70, 0x40, 0x0C, 0xB0, 0x91, 0xB0, 0x05,
+0xB0, 0x90, 0x0A, 0x80, 0x10, 0xA0, 0x30, 0x40, 0xA0, 0x80, 0x70, 0x30, 0x00, 0x50, 0x40, 0x90,
+0xB0, 0x51, 0x0D, 0xB0, 0x50, 0xB0, 0x80, 0xB0, 0x30, 0x70, 0x80, 0x04, 0x80, 0x70, 0x03, 0x70,
+0x02, 0x80, 0x10, 0xD1, 0x02, 0x30, 0x0F, 0x01, 0x0F, 0x00, 0x30, 0x40, 0xB0, 0x00, 0xD0, 0xC0,
+0x22, 0xE0, 0x60, 0xA0, 0x10, 0xE1, 0x70, 0xF0, 0x2F, 0x11, 0xC0, 0x61, 0xC1, 0xE1, 0x60, 0x2F,
+0x07, 0xE1, 0xC0, 0x60, 0xC0, 0x2F, 0x03, 0xC0, 0x60, 0xC0, 0xE0, 0x23, 0x60, 0x20, 0xE0, 0x2F,
+0x01, 0xE0, 0xC0, 0x60, 0x2F, 0x02, 0x60, 0xE0, 0x2B, 0x60, 0xE0, 0x28, 0x61, 0x10, 0x71, 0x30,
+0xB0, 0xA0, 0xF0, 0xE0, 0x60, 0x26, 0xE0, 0xC0, 0xF0, 0xA0, 0x02, 0x40, 0xA0, 0xE1, 0xF0, 0x80,
+0xD0, 0x50, 0xB0, 0x10, 0x01, 0xA0, 0x40, 0xC0, 0xF0, 0x70, 0xE0, 0x20, 0xE0, 0x31, 0x70, 0x90,
+0x70, 0x51, 0x0B, 0x50, 0x90, 0x0F, 0x01, 0x90, 0x50, 0x03, 0xB1, 0x0D, 0x90, 0x05, 0x40, 0x50,
+0x03, 0xD0, 0x10, 0xF0, 0xD0, 0xF0, 0xB0, 0x08, 0xB0, 0x40, 0x90, 0xB0, 0x03, 0xB0, 0x02, 0x30,
+0x80, 0x09, 0x90, 0x30, 0x10, 0xB0, 0x50, 0x00, 0x50, 0x80, 0x51, 0x90, 0x50, 0x02, 0x10, 0x31,
+0x70, 0x50, 0x0A, 0x50, 0x81, 0xA1, 0x50, 0x05, 0x90, 0xA0, 0x04, 0xD0, 0x00, 0x90, 0xB0, 0x70,
+0x50, 0x00, 0xA0, 0xB0, 0x00, 0xB0, 0x70, 0x0F, 0x01, 0x0F, 0x00, 0xA0, 0x40, 0x31, 0x10, 0xC0,
+0xE0, 0x21, 0xE0, 0xA0, 0x60, 0xA0, 0x60, 0xE2, 0x2F, 0x11, 0xE2, 0xC0, 0x61, 0xC0, 0x60, 0xE1,
+0x2F, 0x07, 0xE1, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x20, 0xC0,
+0x60, 0xE0, 0x2F, 0x03, 0xE0, 0x20, 0x60, 0xC0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2A, 0xC1, 0x28,
+0xE0, 0x70, 0x10, 0x30, 0x10, 0x00, 0xD0, 0x80, 0xE1, 0x60, 0xC0, 0x25, 0xE1, 0xC0, 0x40, 0x10,
+0x80, 0x71, 0xE2, 0x80, 0x10, 0x01, 0x90, 0x70, 0x01, 0x70, 0x81, 0x71, 0xE0, 0x20, 0xC0, 0x30,
+0x00, 0xB0, 0x70, 0x80, 0x40, 0x0B, 0xB0, 0x40, 0x0F, 0x01, 0x40, 0xB0, 0x03, 0x50, 0x10, 0x50,
+0x0E, 0x40, 0x02, 0x90, 0x40, 0x05, 0x10, 0xC0, 0xE0, 0x61, 0xD0, 0xA0, 0x05, 0xB0, 0x40, 0x90,
+0x05, 0x40, 0x10, 0xB0, 0x0C, 0x40, 0x70, 0x40, 0x30, 0x00, 0xB0, 0x90, 0x50, 0x90, 0x50, 0x09,
+0xA0, 0xB0, 0x04, 0x40, 0x80, 0xB0, 0xA0, 0x30, 0x80, 0x50, 0x80, 0xB0, 0x06, 0x80, 0x70, 0x05,
+0x80, 0xA0, 0x30, 0x70, 0x02, 0x30, 0xD0, 0x30, 0x81, 0x90, 0x0F, 0x00, 0x0F, 0x00, 0x30, 0x01,
+0x50, 0x10, 0x63, 0xE0, 0xA0, 0xD0, 0x60, 0xA0, 0xE0, 0x70, 0xE0, 0x2F, 0x16, 0xE0, 0x62, 0xC0,
+0xE1, 0x2F, 0x08, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x2E, 0xE0, 0x20, 0x61, 0xE0, 0x60, 0xE1, 0x2F,
+0x06, 0x60, 0xC0, 0xE0, 0x2E, 0xC0, 0x60, 0x20, 0xE0, 0x28, 0xE0, 0x60, 0xE0, 0x27, 0xC0, 0xA0,
+0x11, 0xB0, 0x90, 0x10, 0x30, 0xA0, 0x70, 0xC1, 0xE1, 0x20, 0xE3, 0xC1, 0xE1, 0xF0, 0xC0, 0xE1,
+0xC0, 0x70, 0x90, 0xD0, 0x05, 0x40, 0x70, 0x90, 0xD0, 0xF0, 0xE0, 0x20, 0x60, 0xF0, 0x02, 0x51,
+0x0B, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x05, 0x90, 0xA0, 0x0F, 0x00, 0x52, 0x40, 0xB0, 0x05, 0x50,
+0x10, 0x70, 0xF0, 0xE1, 0x60, 0x40, 0x03, 0x50, 0x40, 0x50, 0x0F, 0x03, 0x50, 0x03, 0x30, 0xB0,
+0xA0, 0x00, 0x50, 0x40, 0x80, 0x0B, 0x50, 0xA0, 0x05, 0xA0, 0x70, 0xA0, 0x09, 0x50, 0x00, 0x30,
+0xA0, 0x09, 0x31, 0x80, 0x50, 0xB0, 0xA0, 0x01, 0xB0, 0x30, 0x0F, 0x00, 0x0E, 0x41, 0x01, 0x30,
+0x10, 0x60, 0xE0, 0x21, 0x60, 0xA0, 0xF0, 0xC0, 0xE1, 0x10, 0xE0, 0x2F, 0x17, 0x60, 0xE1, 0xC0,
+0x61, 0x2F, 0x0A, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2E, 0xE1, 0x61, 0xE0, 0x2F, 0x07, 0xE0, 0xC0,
+0x60, 0xE0, 0x2E, 0x60, 0xC0, 0xE0, 0x28, 0xE0, 0xC1, 0xE0, 0x26, 0xE0, 0x60, 0xA0, 0x10, 0x40,
+0x70, 0x02, 0xA0, 0xE0, 0x60, 0xC2, 0x67, 0xC3, 0xF0, 0xA0, 0xF1, 0x80, 0x00, 0x50, 0x02, 0x40,
+0x70, 0xE0, 0xF0, 0xC0, 0x21, 0x60, 0x80, 0x02, 0x40, 0x0B, 0x40, 0x0F, 0x00, 0xB0, 0x40, 0x06,
+0x50, 0x10, 0xB0, 0x0E, 0xB0, 0x80, 0x50, 0x07, 0x40, 0xF0, 0xE1, 0x20, 0xE0, 0xF0, 0x30, 0x01,
+0x50, 0x40, 0x50, 0x0F, 0x04, 0x40, 0x30, 0xD0, 0x30, 0x01, 0x30, 0xA0, 0x40, 0x90, 0xB0, 0x00,
+0x50, 0xB0, 0x0A, 0x10, 0x40, 0x05, 0x50, 0x30, 0x40, 0x08, 0x31, 0xA0, 0x80, 0x06, 0x50, 0x90,
+0x40, 0x90, 0xB1, 0x70, 0x80, 0x00, 0x10, 0x02, 0x30, 0x0F, 0x00, 0x0E, 0x32, 0x40, 0x70, 0xA0,
+0xF0, 0xE0, 0x20, 0xE0, 0x60, 0x10, 0x60, 0xC0, 0x61, 0xA0, 0xE0, 0x20, 0xE2, 0x2F, 0x13, 0x60,
+0x20, 0xE2, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x09, 0x61, 0xC0, 0x2E, 0xC0, 0x60, 0xC0, 0x60,
+0xC0, 0xE0, 0x2F, 0x06, 0xE0, 0xC0, 0x60, 0xE0, 0x2E, 0x60, 0x20, 0xE0, 0x28, 0xE0, 0x60, 0x27,
+0xE0, 0xF0, 0xA0, 0x10, 0xA0, 0x02, 0x90, 0x30, 0x61, 0xC3, 0x22, 0xC1, 0xE0, 0x21, 0xE0, 0xA0,
+0x10, 0x70, 0xA0, 0x60, 0xC0, 0xA0, 0xB0, 0x70, 0xB0, 0x80, 0x00, 0x80, 0xA0, 0xE1, 0x22, 0xC0,
+0x30, 0x01, 0x90, 0xB0, 0x0A, 0x90, 0xB0, 0x0E, 0x50, 0x40, 0x08, 0xD0, 0x80, 0x0D, 0x91, 0x51,
+0x07, 0xB0, 0xA0, 0xF1, 0xE2, 0xD0, 0x50, 0x40, 0x50, 0x0F, 0x06, 0x40, 0x50, 0x00, 0x30, 0x40,
+0x50, 0xA0, 0x90, 0x04, 0x90, 0x0A, 0x50, 0x30, 0x80, 0xB0, 0x50, 0x80, 0x70, 0xD0, 0x40, 0xD0,
+0xB0, 0x07, 0x40, 0x30, 0x05, 0xB0, 0x50, 0x40, 0x90, 0x50, 0xB0, 0x04, 0x40, 0x30, 0xA0, 0x90,
+0x80, 0xA0, 0x10, 0x0F, 0x00, 0x0E, 0xA0, 0x01, 0x40, 0x10, 0xB0, 0xD0, 0x60, 0x22, 0xC0, 0xE0,
+0xC0, 0xE0, 0x70, 0xA0, 0xC0, 0x62, 0xC0, 0x20, 0xE0, 0x2F, 0x10, 0xC1, 0x22, 0xE0, 0x20, 0xE1,
+0xC0, 0x61, 0xC0, 0xE0, 0x2F, 0x09, 0x61, 0xC0, 0x20, 0xE0, 0x29, 0xE0, 0x60, 0xC0, 0xE1, 0x61,
+0x20, 0xE0, 0x2F, 0x05, 0xE0, 0xC0, 0x60, 0x2F, 0x00, 0x60, 0x20, 0xE0, 0x29, 0x60, 0x26, 0xE0,
+0x60, 0xA0, 0x10, 0x40, 0x91, 0xD0, 0xA0, 0xC0, 0xE1, 0x25, 0xE0, 0xC0, 0x60, 0x21, 0xE0, 0xC0,
+0x11, 0xB0, 0x70, 0xC0, 0xE0, 0x90, 0x70, 0x90, 0x40, 0x30, 0xB0, 0x30, 0xA0, 0xE0, 0x23, 0xE0,
+0x70, 0x00, 0xB0, 0x90, 0x0A, 0x90, 0x50, 0x0E, 0x91, 0x09, 0x90, 0x10, 0xD0, 0x0A, 0x90, 0x40,
+0xB0, 0x01, 0x40, 0x08, 0xA0, 0xE3, 0x60, 0x30, 0xA0, 0x0F, 0x08, 0xB0, 0x30, 0x50, 0x90, 0xA0,
+0x40, 0xD0, 0x05, 0x40, 0x0C, 0x40, 0x10, 0x81, 0x02, 0x30, 0x07, 0xB0, 0xD0, 0x03, 0x50, 0x40,
+0x91, 0xB0, 0x09, 0xB0, 0x10, 0x70, 0xB0, 0x00, 0x40, 0x50, 0x0E, 0x06, 0xB0, 0x80, 0x04, 0xB0,
+0x80, 0x01, 0x50, 0x30, 0x00, 0x10, 0xF0, 0xE0, 0x22, 0xE0, 0xA0, 0x60, 0xE0, 0xC0, 0xE0, 0x22,
+0xC0, 0x62, 0xC0, 0x20, 0xE0, 0x2F, 0x0B, 0xE0, 0x60, 0xE0, 0x27, 0xE1, 0xC0, 0x61, 0xC0, 0x2F,
+0x09, 0x61, 0xC0, 0xE0, 0x21, 0xE0, 0x24, 0xE0, 0xC0, 0x60, 0xE0, 0x22, 0xE0, 0x61, 0x20, 0xE0,
+0x2F, 0x06, 0x60, 0xC0, 0x20, 0xE0, 0x2C, 0x60, 0x20, 0xE0, 0x27, 0xE0, 0x60, 0xC0, 0x24, 0xE1,
+0xC0, 0x80, 0xA0, 0xD0, 0x51, 0x10, 0xF0, 0xE0, 0x28, 0xC1, 0x22, 0x60, 0x70, 0xB0, 0x00, 0xD0,
+0x70, 0xB0, 0xA0, 0xD0, 0x01, 0x70, 0xF0, 0x60, 0xC0, 0xE1, 0x22, 0xE0, 0xD0, 0x30, 0x40, 0x02,
+0xB0, 0x06, 0x51, 0x0E, 0x40, 0x50, 0x0B, 0x10, 0x09, 0x50, 0x40, 0xB0, 0x04, 0x90, 0x07, 0x90,
+0xA0, 0xC1, 0x60, 0x50, 0x70, 0x50, 0x0F, 0x06, 0xB0, 0x50, 0x90, 0xD0, 0x02, 0x80, 0xD0, 0xB0,
+0x04, 0x50, 0xB0, 0x30, 0x0F, 0x02, 0xA0, 0xB0, 0x04, 0xB0, 0xA1, 0x51, 0x90, 0x40, 0x90, 0xB0,
+0x0D, 0xA0, 0x10, 0x30, 0x02, 0x30, 0x0E, 0x06, 0x30, 0xB0, 0x80, 0x03, 0x40, 0x30, 0x90, 0x00,
+0xA1, 0x00, 0x10, 0x70, 0xE0, 0x22, 0xE0, 0xC0, 0xE0, 0xF0, 0xA0, 0xE0, 0x23, 0xE0, 0x21, 0x62,
+0xC0, 0x2F, 0x0B, 0x60, 0xE0, 0x29, 0xE1, 0x20, 0xC0, 0x60, 0xC0, 0x2F, 0x07, 0xE1, 0xC0, 0x60,
+0xC0, 0x26, 0xE0, 0x60, 0x27, 0x60, 0xC0, 0xE0, 0x2F, 0x06, 0x60, 0xC0, 0xE1, 0x2A, 0xE0, 0xC0,
+0x60, 0xE0, 0x29, 0x60, 0xE1, 0x20, 0xE1, 0xC0, 0xF0, 0x60, 0x70, 0x11, 0xB0, 0x50, 0x80, 0xA0,
+0x60, 0xE0, 0x27, 0xC0, 0x60, 0x21, 0xE0, 0x60, 0x10, 0x01, 0x10, 0xA0, 0x11, 0xD0, 0x00, 0x40,
+0xF0, 0xE1, 0xC0, 0x60, 0xC1, 0xE2, 0xD0, 0x70, 0xB0, 0x02, 0x80, 0x05, 0xB0, 0x90, 0x0E, 0x40,
+0xB0, 0x0C, 0x10, 0x07, 0xB0, 0x40, 0x50, 0x02, 0xB0, 0x71, 0x00, 0x90, 0xB0, 0x06, 0xB0, 0x80,
+0xF0, 0xA0, 0xD1, 0x80, 0x0F, 0x05, 0x50, 0x40, 0x90, 0x00, 0x80, 0x40, 0x03, 0xA0, 0x06, 0x90,
+0x0F, 0x03, 0x50, 0x30, 0x01, 0x50, 0x90, 0x40, 0xA0, 0x41, 0x90, 0xB0, 0x0F, 0x00, 0x50, 0x10,
+0xA0, 0x10, 0xA0, 0x00, 0x50, 0x40, 0xA0, 0x0E, 0x06, 0x81, 0x40, 0x03, 0x30, 0x90, 0x40, 0x80,
+0x10, 0x80, 0x00, 0x10, 0xF0, 0xE0, 0x22, 0xE0, 0xF0, 0xE0, 0xD0, 0xF0, 0xE0, 0x29, 0xC0, 0x62,
+0xC0, 0x20, 0xE2, 0x2F, 0x02, 0xC1, 0x2E, 0xE0, 0xC0, 0x61, 0xC0, 0x2F, 0x06, 0xE1, 0xC0, 0x61,
+0xE1, 0x23, 0x60, 0x28, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x05, 0x61, 0x2D, 0xC0, 0x60, 0x28, 0xE0,
+0xC1, 0xE1, 0xC0, 0xF0, 0x70, 0x10, 0xA0, 0x72, 0x03, 0x70, 0xE1, 0x25, 0xE0, 0xC0, 0x60, 0x22,
+0xC0, 0x10, 0x00, 0x70, 0x11, 0x31, 0x70, 0xA0, 0x70, 0xA0, 0x60, 0xE0, 0x20, 0xE0, 0xC0, 0x61,
+0xE0, 0x70, 0x30, 0x40, 0x01, 0x90, 0x06, 0xB0, 0x40, 0x0D, 0xB0, 0x40, 0x0E, 0x10, 0x06, 0x91,
+0x02, 0x90, 0x71, 0x60, 0xF0, 0x30, 0x00, 0x90, 0x04, 0xB0, 0x40, 0x50, 0x00, 0x80, 0x10, 0x90,
+0x0F, 0x04, 0xB0, 0x41, 0x50, 0x02, 0x81, 0x03, 0xA0, 0x30, 0xB0, 0x04, 0x40, 0x0F, 0x04, 0xA0,
+0x90, 0x70, 0x31, 0x80, 0xB0, 0x0F, 0x05, 0x90, 0x10, 0xD0, 0xF0, 0x30, 0x80, 0x90, 0x30, 0xB0,
+0x0D, 0x07, 0xB0, 0x04, 0xA0, 0x02, 0xD0, 0x01, 0x10, 0x60, 0x23, 0xE0, 0x10, 0xE0, 0xF0, 0x2B,
+0xE2, 0xC1, 0x62, 0xC0, 0xE1, 0x2A, 0xE0, 0x21, 0xE1, 0x60, 0xE0, 0x2F, 0x01, 0xE1, 0xC0, 0x61,
+0xC0, 0x2F, 0x05, 0xE1, 0xC0, 0x61, 0x20, 0xE1, 0x60, 0xE0, 0x29, 0xE0, 0x61, 0x20, 0xE0, 0x2F,
+0x03, 0xE0, 0xC0, 0x60, 0x2C, 0xE0, 0x60, 0xC0, 0xE0, 0x27, 0xE0, 0x60, 0xC1, 0x80, 0x70, 0xA0,
+0x90, 0xB0, 0xA1, 0x40, 0x00, 0x30, 0xB0, 0x00, 0xA0, 0xE1, 0x26, 0xC0, 0x60, 0x22, 0xE0, 0xA0,
+0x40, 0x70, 0xA0, 0xD0, 0xA0, 0x70, 0xA0, 0xC0, 0xE0, 0x60, 0x70, 0x20, 0xE0, 0xC0, 0x70, 0xA0,
+0x10, 0x40, 0x70, 0x30, 0xA1, 0x30, 0x80, 0xD0, 0x05, 0x40, 0x0D, 0x50, 0x40, 0x0C, 0x50, 0x80,
+0x00, 0xA0, 0xB0, 0x03, 0x90, 0x40, 0xB0, 0x03, 0xD0, 0xE3, 0xA0, 0x00, 0x90, 0x02, 0x50, 0x40,
+0x90, 0x03, 0xD0, 0x40, 0x0F, 0x02, 0x90, 0x40, 0x50, 0x04, 0xB0, 0x70, 0x40, 0x04, 0xB0, 0xD0,
+0x04, 0x90, 0xB0, 0x07, 0x81, 0x07, 0x50, 0x81, 0x50, 0xB0, 0x0F, 0x08, 0xB0, 0xA0, 0xE0, 0xF0,
+0x50, 0x01, 0x80, 0x50, 0x0D, 0x06, 0x90, 0x31, 0x40, 0xB0, 0x00, 0xB0, 0x30, 0x01, 0x90, 0x10,
+0x01, 0x10, 0x60, 0xE0, 0x22, 0xE0, 0xF0, 0x70, 0xE0, 0xC0, 0x2F, 0x01, 0xE0, 0x20, 0xC0, 0x61,
+0xC1, 0xE2, 0x25, 0x60, 0x23, 0x60, 0xE0, 0x2F, 0x04, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0xE0, 0x2F,
+0x04, 0xE0, 0x20, 0x61, 0xC0, 0x60, 0xE0, 0x2A, 0xE0, 0x20, 0x61, 0x20, 0xE0, 0x2F, 0x03, 0xC0,
+0x60, 0x2C, 0xE0, 0x60, 0xC0, 0x27, 0xC0, 0x60, 0xA0, 0x70, 0x11, 0x41, 0x30, 0x70, 0xA0, 0x70,
+0xD0, 0x10, 0x01, 0x80, 0xF0, 0xE0, 0x26, 0xC1, 0xE0, 0x21, 0xE0, 0xD0, 0x70, 0x14, 0x81, 0x60,
+0xE2, 0xF0, 0xA0, 0x01, 0x40, 0x70, 0x80, 0x40, 0xB0, 0x80, 0xB0, 0x00, 0x40, 0x80, 0x03, 0x40,
+0xB0, 0x0C, 0x91, 0x0E, 0xA0, 0x10, 0x30, 0xB0, 0x01, 0x50, 0x40, 0xB0, 0x04, 0x40, 0xF0, 0xE0,
+0x20, 0xE1, 0xF0, 0x30, 0x50, 0x40, 0x50, 0x40, 0x50, 0x0F, 0x07, 0x50, 0x40, 0x90, 0x07, 0x80,
+0x50, 0x06, 0x50, 0x80, 0x03, 0xB0, 0x50, 0x03, 0x50, 0x30, 0x01, 0x30, 0x80, 0x03, 0x50, 0x90,
+0x40, 0x90, 0xB0, 0x0F, 0x0C, 0x90, 0xF0, 0xE0, 0x60, 0x80, 0x01, 0x90, 0x40, 0x0D, 0x05, 0x90,
+0x70, 0x90, 0x40, 0x30, 0xD0, 0x80, 0x50, 0x70, 0x30, 0x80, 0x30, 0x10, 0x01, 0xD0, 0x60, 0x23,
+0xE0, 0xF0, 0xD0, 0x60, 0xF0, 0x2F, 0x04, 0xE0, 0x20, 0xC1, 0x61, 0xC0, 0x21, 0xE3, 0x70, 0x21,
+0xE0, 0xC1, 0xE0, 0x2F, 0x05, 0xE2, 0x20, 0x62, 0x2F, 0x05, 0xE1, 0x60, 0x2E, 0xE0, 0xC0, 0x60,
+0xC0, 0x2F, 0x03, 0xE0, 0x20, 0x60, 0x2B, 0xE0, 0x20, 0x60, 0x23, 0xE1, 0x20, 0xC0, 0x60, 0xC0,
+0x70, 0xB0, 0x00, 0x40, 0x32, 0xD0, 0xC0, 0xD0, 0xC0, 0xA0, 0x02, 0x70, 0x60, 0x26, 0xC1, 0xE0,
+0x21, 0xE0, 0xA0, 0x10, 0x00, 0xD0, 0x30, 0xD0, 0x40, 0xD0, 0x11, 0xE0, 0x60, 0xA1, 0x04, 0x50,
+0x00, 0xB0, 0x30, 0x90, 0x01, 0xA0, 0xB0, 0x01, 0x40, 0xB0, 0x0C, 0x40, 0x50, 0x0F, 0x00, 0x90,
+0xA0, 0x40, 0x50, 0xB0, 0x40, 0x50, 0x05, 0x50, 0x70, 0xE0, 0x22, 0xE0, 0x70, 0xD0, 0xB0, 0x40,
+0x50, 0x0F, 0x06, 0x50, 0x91, 0xB0, 0x07, 0x90, 0x70, 0xA0, 0x07, 0xB0, 0x30, 0x04, 0x40, 0x03,
+0x80, 0x50, 0x03, 0xB0, 0x50, 0x40, 0x90, 0xB0, 0x0F, 0x10, 0x30, 0xC0, 0xE1, 0x70, 0x80, 0x30,
+0xA0, 0x30, 0x0D, 0x05, 0x80, 0x90, 0x03, 0xA0, 0x80, 0x50, 0x01, 0x10, 0xA0, 0x80, 0x00, 0x80,
+0x60, 0xE0, 0x22, 0xE0, 0xD0, 0xC0, 0xE0, 0x2F, 0x0B, 0xC0, 0x62, 0xC0, 0xE5, 0x60, 0x2F, 0x0D,
+0xC0, 0x62, 0x2F, 0x02, 0xE1, 0x60, 0xE1, 0x2F, 0x00, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x03, 0x60,
+0xC0, 0x29, 0xE1, 0x20, 0x60, 0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x60, 0xD0, 0x50, 0x00,
+0x30, 0x01, 0x70, 0xC1, 0x60, 0xE0, 0x70, 0xF0, 0x02, 0x70, 0xE0, 0x24, 0xE0, 0xC1, 0xE0, 0x20,
+0xE2, 0x10, 0x00, 0x50, 0x30, 0xD0, 0x70, 0x90, 0xB0, 0x70, 0x10, 0xA0, 0xB0, 0x04, 0xB0, 0x90,
+0x02, 0x90, 0x50, 0x00, 0x50, 0x80, 0x00, 0x51, 0x0C, 0x40, 0xB0, 0x0F, 0x01, 0x80, 0xD0, 0x00,
+0x91, 0x07, 0xA0, 0xF0, 0xE0, 0x21, 0xC0, 0xD0, 0x50, 0x01, 0xB0, 0x90, 0x0F, 0x03, 0xB0, 0x90,
+0x40, 0x50, 0x09, 0x30, 0x80, 0xB0, 0x09, 0x10, 0x04, 0x90, 0xB0, 0x02, 0x30, 0x01, 0x50, 0x40,
+0x90, 0x50, 0xB0, 0x0F, 0x13, 0x30, 0xC0, 0xE1, 0xA0, 0x50, 0x01, 0xA0, 0x0D, 0x05, 0x50, 0x10,
+0x40, 0x02, 0xA0, 0x30, 0x02, 0x10, 0x40, 0xD0, 0x00, 0x40, 0x70, 0xE0, 0x22, 0xE0, 0xF0, 0xE0,
+0x2F, 0x0C, 0xE2, 0x20, 0xC0, 0x62, 0xC0, 0xE1, 0x60, 0x21, 0xE1, 0x2F, 0x0A, 0xE1, 0xC0, 0x61,
+0xC0, 0x20, 0xE0, 0x2B, 0xE1, 0xC1, 0x2F, 0x02, 0xE0, 0x20, 0x61, 0x2F, 0x03, 0xE0, 0x60, 0xC0,
+0x2B, 0xC0, 0x60, 0x21, 0xC0, 0x60, 0xE0, 0x21, 0xE0, 0x70, 0xD0, 0xB0, 0x50, 0x01, 0xA0, 0xE1,
+0xC0, 0xE0, 0x70, 0xB0, 0x01, 0x90, 0x10, 0xC0, 0xE0, 0x24, 0xC1, 0xE1, 0xC0, 0xF0, 0xC0, 0x11,
+0x01, 0x40, 0x03, 0x70, 0xD0, 0x05, 0x40, 0x04, 0x50, 0x40, 0x80, 0x40, 0xB0, 0x40, 0x0C, 0x40,
+0x0F, 0x03, 0x31, 0x40, 0xB0, 0x08, 0x70, 0x60, 0xE0, 0x20, 0xE0, 0x60, 0x80, 0x03, 0x40, 0x0F,
+0x01, 0x90, 0x40, 0x50, 0x0A, 0x80, 0xA0, 0x40, 0x0B, 0xB0, 0x30, 0x03, 0xB1, 0x01, 0x50, 0x80,
+0xA0, 0x50, 0xB0, 0x0F, 0x17, 0x50, 0xD0, 0x60, 0xE0, 0x30, 0x50, 0x01, 0x80, 0x00, 0x90, 0xA0,
+0x50, 0x30, 0x10, 0x90, 0x06, 0x07, 0x30, 0x12, 0x90, 0x70, 0x80, 0x50, 0x00, 0xD0, 0x31, 0x01,
+0xA0, 0xE0, 0x23, 0xE0, 0xF0, 0xE1, 0x2F, 0x12, 0x63, 0xC0, 0x20, 0xE1, 0x2F, 0x0D, 0xE1, 0xC0,
+0x61, 0xC0, 0xE2, 0x29, 0x60, 0x2F, 0x05, 0xE0, 0x20, 0x61, 0xE0, 0x2F, 0x00, 0xE1, 0xC0, 0x60,
+0xE0, 0x2A, 0xC0, 0x62, 0xE0, 0x21, 0xE0, 0xC0, 0xD0, 0x80, 0x30, 0x02, 0xA0, 0xE0, 0x60, 0x10,
+0xA0, 0x10, 0x50, 0x02, 0x70, 0xF0, 0xE1, 0x23, 0xC0, 0x60, 0x30, 0x11, 0x30, 0x10, 0x80, 0x50,
+0x80, 0x05, 0x90, 0x80, 0x04, 0x51, 0x06, 0xA0, 0x50, 0x90, 0x09, 0x10, 0x50, 0xB0, 0x40, 0x0F,
+0x03, 0x50, 0x30, 0x10, 0x09, 0xB0, 0xD0, 0xC0, 0xE0, 0x20, 0x60, 0xC0, 0x70, 0x80, 0x02, 0x51,
+0x0C, 0x50, 0x40, 0x90, 0x0D, 0xA0, 0xB0, 0x0C, 0x30, 0x50, 0x03, 0x50, 0x80, 0x41, 0x50, 0x00,
+0x90, 0x70, 0x0F, 0x0B, 0x30, 0x90, 0x0B, 0xB0, 0x70, 0xE0, 0xF0, 0x90, 0xB0, 0x40, 0xA1, 0x70,
+0x90, 0xD0, 0x30, 0x00, 0x70, 0xB0, 0x05, 0x05, 0xB0, 0x40, 0x01, 0x50, 0x01, 0x30, 0xB0, 0x40,
+0x70, 0x10, 0x40, 0x02, 0x61, 0xE0, 0x21, 0xE0, 0x60, 0xD0, 0xF0, 0x60, 0x2F, 0x12, 0xE1, 0x60,
+0xC0, 0x62, 0xC0, 0x2F, 0x0F, 0xE1, 0x20, 0x62, 0xC0, 0xE1, 0x26, 0xC1, 0x2F, 0x07, 0xE0, 0xC0,
+0x60, 0xC0, 0x2F, 0x01, 0xE0, 0x20, 0x60, 0x20, 0xE0, 0x29, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0x60,
+0x10, 0x70, 0x80, 0xB0, 0x50, 0x00, 0xB0, 0xA0, 0xE0, 0xF0, 0xD0, 0x05, 0x50, 0x70, 0x60, 0xE0,
+0x23, 0x60, 0x70, 0x30, 0x90, 0xA0, 0x50, 0x09, 0x80, 0x40, 0x04, 0x40, 0x07, 0xB0, 0x30, 0x50,
+0x09, 0x81, 0x90, 0x0F, 0x02, 0xB0, 0x90, 0x40, 0x10, 0x50, 0x08, 0xB0, 0xD0, 0x60, 0xE0, 0x20,
+0xC0, 0x70, 0xF0, 0x70, 0x90, 0x03, 0x40, 0x09, 0x50, 0x90, 0x40, 0xB0, 0x0E, 0x90, 0x80, 0x0C,
+0x70, 0x80, 0x00, 0xB0, 0x50, 0x40, 0x90, 0x50, 0x40, 0x04, 0x30, 0x0F, 0x0B, 0x70, 0xB0, 0x0C,
+0x70, 0xE0, 0x40, 0xD0, 0x80, 0x91, 0x10, 0xB0, 0x00, 0x40, 0x30, 0x00, 0x70, 0xB0, 0x05, 0x05,
+0x70, 0x30, 0x70, 0xA0, 0x71, 0x90, 0x40, 0x01, 0x80, 0x70, 0xA0, 0x90, 0x01, 0xA1, 0xE0, 0x22,
+0x70, 0xD0, 0x2F, 0x15, 0xE0, 0x60, 0xE0, 0x22, 0xC0, 0x62, 0xC0, 0xE1, 0x2F, 0x0E, 0xC0, 0x61,
+0xC0, 0x20, 0xE0, 0x23, 0xE0, 0x60, 0x2F, 0x07, 0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2F,
+0x01, 0x60, 0xC0, 0xE0, 0x27, 0x60, 0xC0, 0xE0, 0x22, 0xE0, 0x70, 0xD0, 0x02, 0x40, 0x80, 0x70,
+0xC0, 0xE1, 0x70, 0xB0, 0x04, 0x90, 0x30, 0x40, 0xA0, 0x22, 0xE0, 0xF0, 0xD0, 0x80, 0x00, 0x80,
+0xB0, 0x08, 0x90, 0x00, 0x30, 0xB0, 0x02, 0x90, 0xB0, 0x08, 0xA0, 0x90, 0x50, 0x08, 0x90, 0x50,
+0x0F, 0x02, 0x91, 0x01, 0xB0, 0x09, 0x50, 0xD0, 0xE0, 0x22, 0xE0, 0x70, 0xA0, 0x40, 0x03, 0x50,
+0xB0, 0x05, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x02, 0x41, 0x0C, 0x40, 0x30, 0x80, 0x50, 0xB0, 0x02,
+0x90, 0x04, 0xA0, 0x0F, 0x1A, 0xA0, 0xE0, 0xC0, 0xA0, 0x02, 0x70, 0x30, 0x00, 0x30, 0xA0, 0xD0,
+0x80, 0x06, 0x04, 0x90, 0x80, 0x00, 0x30, 0x40, 0x00, 0x40, 0xD0, 0x80, 0xB0, 0x00, 0x30, 0x40,
+0x50, 0x70, 0xB0, 0x00, 0x70, 0xF0, 0xE0, 0x21, 0xE0, 0xC0, 0xE1, 0x2F, 0x15, 0x60, 0xE0, 0x23,
+0xE1, 0xC1, 0x62, 0x2F, 0x10, 0xC0, 0x61, 0xC0, 0xE2, 0xC0, 0x60, 0x2F, 0x0B, 0xE0, 0x20, 0x61,
+0x20, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0xE0, 0x23, 0xE0, 0x20, 0x60, 0xE1, 0x23, 0xE0, 0xF0, 0x10,
+0x90, 0x80, 0x10, 0xF0, 0x30, 0x80, 0xE0, 0x60, 0x70, 0x60, 0x08, 0xA0, 0x22, 0xE0, 0x71, 0x10,
+0x00, 0x10, 0x09, 0x50, 0xB0, 0x30, 0x40, 0x01, 0xB0, 0x40, 0x09, 0x90, 0x30, 0x51, 0x06, 0x40,
+0xB0, 0x01, 0x70, 0xA1, 0x80, 0x0A, 0x50, 0x40, 0xB0, 0x0E, 0xA0, 0xE0, 0x23, 0xE1, 0xF0, 0xA0,
+0x02, 0xB0, 0x90, 0x03, 0x41, 0x90, 0xB0, 0x0F, 0x05, 0xA0, 0x08, 0x50, 0x41, 0x90, 0xB0, 0x00,
+0xA0, 0x04, 0xB0, 0x50, 0x03, 0xA0, 0xB0, 0x0F, 0x19, 0x10, 0xE1, 0x70, 0x00, 0xB0, 0x90, 0x70,
+0x80, 0xD0, 0x40, 0xB0, 0x40, 0xB0, 0x06, 0x04, 0xB0, 0xD0, 0x80, 0x10, 0x50, 0x00, 0x40, 0xD0,
+0x13, 0xC0, 0xE1, 0x70, 0x01, 0x70, 0xE0, 0x24, 0xA0, 0x2F, 0x15, 0x60, 0xE0, 0x28, 0xE0, 0xC0,
+0x63, 0xC0, 0xE1, 0x2F, 0x0A, 0xE1, 0xC0, 0x61, 0xC0, 0x60, 0xE0, 0x2F, 0x0C, 0xE0, 0x21, 0x61,
+0xE0, 0x2F, 0x00, 0x61, 0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xE0, 0x26, 0xE0, 0xF0, 0xA0, 0x60, 0xE1,
+0xC1, 0xE0, 0x10, 0xF0, 0xB0, 0x01, 0xB0, 0x04, 0x40, 0xA0, 0xE0, 0x20, 0xE0, 0xF0, 0x80, 0x40,
+0x50, 0x00, 0x70, 0x0B, 0x90, 0x80, 0x01, 0x40, 0x0B, 0x30, 0x40, 0x50, 0x90, 0x03, 0xB0, 0x80,
+0x04, 0x80, 0x30, 0x13, 0x31, 0x03, 0xB0, 0x40, 0xB1, 0x0F, 0x00, 0x70, 0xE0, 0x24, 0xE1, 0xC0,
+0xD0, 0x71, 0xD0, 0x90, 0x80, 0xA0, 0x90, 0x50, 0x0F, 0x09, 0x80, 0x50, 0x03, 0x50, 0x90, 0x41,
+0xB0, 0x03, 0x30, 0xB0, 0x05, 0x40, 0x03, 0x80, 0x50, 0x0F, 0x11, 0x81, 0x05, 0xA0, 0xE1, 0xA0,
+0x13, 0x00, 0x30, 0xD0, 0xA0, 0x30, 0x70, 0xA0, 0x05, 0x05, 0x50, 0x40, 0xB0, 0xD0, 0x71, 0x30,
+0xB0, 0x90, 0x80, 0x10, 0xC0, 0x61, 0x30, 0x90, 0xB0, 0x30, 0xC0, 0x20, 0xE1, 0x20, 0xE0, 0x70,
+0x60, 0xE0, 0x2F, 0x11, 0xE0, 0xC1, 0xE0, 0x29, 0xE3, 0xC0, 0x62, 0xC0, 0x2F, 0x0C, 0xE0, 0x20,
+0xC0, 0xF0, 0xC0, 0x2F, 0x0F, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0xC0, 0x60, 0xE1, 0xC0,
+0x60, 0x29, 0xE1, 0x23, 0x60, 0xE0, 0xC0, 0x80, 0x10, 0x30, 0x10, 0x50, 0x03, 0x80, 0xD0, 0x50,
+0xE1, 0x60, 0x10, 0xB1, 0x50, 0xD0, 0x50, 0x0C, 0x30, 0x00, 0xB0, 0x50, 0x0B, 0x30, 0x90, 0x00,
+0x50, 0x90, 0x01, 0xB0, 0x40, 0x0A, 0xB0, 0x90, 0x10, 0x02, 0x40, 0x50, 0x00, 0x70, 0x10, 0xB0,
+0x0D, 0xB0, 0x70, 0x60, 0xE1, 0x25, 0xE2, 0xF0, 0x81, 0x90, 0xA0, 0x80, 0x90, 0x0F, 0x08, 0xA0,
+0xB1, 0x50, 0x40, 0x90, 0x50, 0x07, 0x40, 0x80, 0x05, 0x40, 0x03, 0x30, 0x0F, 0x11, 0x40, 0x10,
+0x50, 0x01, 0xB1, 0x50, 0x80, 0xF0, 0x60, 0xC0, 0xF0, 0x70, 0x40, 0xB0, 0x40, 0x70, 0x40, 0x03,
+0xA0, 0x50, 0x04, 0x04, 0x80, 0xD0, 0x70, 0x01, 0x50, 0xB0, 0x30, 0x02, 0xD0, 0xE0, 0x21, 0xE0,
+0xD0, 0xF1, 0x61, 0xF0, 0x60, 0xC1, 0xE2, 0x2F, 0x11, 0xE0, 0x60, 0x2F, 0x01, 0xE0, 0x21, 0xC0,
+0x62, 0xC0, 0xE2, 0x2F, 0x06, 0xE0, 0xC2, 0x61, 0xC0, 0xE2, 0x2F, 0x0C, 0xC0, 0x60, 0xC0, 0xE0,
+0x2D, 0xC0, 0x60, 0xE0, 0x60, 0x2F, 0x00, 0xE0, 0x60, 0xC0, 0xE0, 0x70, 0x30, 0xD0, 0x90, 0x04,
+0x70, 0x10, 0x90, 0xE0, 0x60, 0x11, 0xA0, 0x30, 0x50, 0x30, 0x0C, 0x40, 0xD0, 0x30, 0x40, 0x0B,
+0x50, 0x80, 0x02, 0x90, 0x51, 0x90, 0x0D, 0x70, 0x40, 0x50, 0x40, 0x00, 0xB0, 0xA0, 0xD0, 0x30,
+0x0F, 0x00, 0x90, 0x80, 0xD0, 0xC0, 0x23, 0xE1, 0xC0, 0x62, 0x70, 0xF0, 0xE0, 0x90, 0x40, 0x10,
+0x0F, 0x06, 0xB0, 0x90, 0x30, 0x90, 0x50, 0xB0, 0x0B, 0x70, 0x05, 0x90, 0x03, 0x80, 0x90, 0x0F,
+0x10, 0x52, 0x40, 0x91, 0xB0, 0x50, 0x10, 0xF0, 0xE1, 0x60, 0x80, 0x01, 0x50, 0x10, 0xB0, 0x02,
+0x40, 0x70, 0x05, 0x03, 0xB0, 0x70, 0x00, 0x90, 0xD0, 0x00, 0x50, 0xA0, 0xD0, 0x90, 0x00, 0x40,
+0x70, 0xE0, 0x22, 0xE0, 0xF0, 0xD0, 0xF0, 0xE0, 0x70, 0xD0, 0xA0, 0x60, 0xF0, 0x61, 0xC0, 0x21,
+0xE0, 0x2F, 0x0E, 0x60, 0xE0, 0x2F, 0x04, 0xE1, 0x20, 0x63, 0x21, 0xE0, 0x2F, 0x03, 0xE0, 0x60,
+0x20, 0xE1, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x0C, 0xE0, 0x20, 0x61, 0xE1, 0x2B, 0xE1, 0xF0, 0x2F,
+0x02, 0xE0, 0x60, 0xA0, 0x40, 0x00, 0x40, 0x50, 0x00, 0x31, 0x40, 0x50, 0x80, 0xA1, 0xD0, 0x80,
+0xB0, 0x40, 0x00, 0x40, 0x10, 0x40, 0x0B, 0x31, 0x40, 0x81, 0xA0, 0x90, 0x40, 0x08, 0x30, 0xB0,
+0x03, 0x40, 0x90, 0x0D, 0x30, 0xD0, 0x30, 0xB0, 0x01, 0x70, 0x80, 0x70, 0x0F, 0x03, 0xA1, 0xE0,
+0x22, 0x62, 0xC0, 0xE1, 0x60, 0x70, 0x60, 0xC0, 0xA0, 0x70, 0x0F, 0x03, 0x50, 0x41, 0x50, 0xD0,
+0x0F, 0x00, 0x40, 0x80, 0x04, 0x50, 0xB0, 0x02, 0x50, 0x80, 0x0F, 0x0B, 0x50, 0x90, 0x41, 0x90,
+0x50, 0xB0, 0x05, 0x70, 0x60, 0xE0, 0x20, 0xC0, 0xF0, 0x00, 0x50, 0x80, 0x30, 0xD0, 0x70, 0xD0,
+0x10, 0xA0, 0xB0, 0x05, 0x03, 0x50, 0x30, 0x01, 0x30, 0x41, 0x31, 0x90, 0x80, 0x10, 0xA0, 0xE0,
+0x23, 0xE0, 0x60, 0xC0, 0x20, 0xE0, 0xF0, 0x20, 0xE0, 0xF0, 0x10, 0xE0, 0x20, 0x64, 0xC1, 0x20,
+0xE2, 0x2F, 0x05, 0xC0, 0x60, 0x2F, 0x09, 0xE0, 0x21, 0x63, 0xC0, 0xE2, 0x2E, 0x60, 0x24, 0xE0,
+0x20, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x0B, 0x60, 0xC0, 0x2B, 0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x01,
+0xC0, 0x70, 0xA0, 0x30, 0xA1, 0xF0, 0x71, 0xA0, 0x60, 0xF0, 0xC1, 0x80, 0x00, 0xD0, 0x80, 0x01,
+0x50, 0x31, 0x08, 0xB0, 0x80, 0xD0, 0x50, 0x01, 0x40, 0x00, 0x80, 0xD0, 0x80, 0x10, 0x30, 0x04,
+0x50, 0x00, 0x30, 0x05, 0x40, 0x0C, 0x50, 0xD0, 0xB0, 0x01, 0x50, 0xD0, 0xC1, 0x70, 0xD0, 0x0F,
+0x03, 0xD0, 0x60, 0xC0, 0x61, 0x21, 0xE0, 0x21, 0xE1, 0xC0, 0xD0, 0x70, 0x30, 0x0C, 0xB0, 0x90,
+0x00, 0xB0, 0x50, 0x40, 0x70, 0xB0, 0x02, 0xA0, 0x0F, 0x01, 0xA0, 0x04, 0xB0, 0x90, 0x03, 0xA0,
+0x0F, 0x04, 0xB0, 0x51, 0x90, 0x41, 0x90, 0x50, 0x0B, 0x80, 0xC0, 0x21, 0xC0, 0xD0, 0x30, 0x40,
+0x90, 0x30, 0x00, 0xB1, 0x01, 0x90, 0xB0, 0x04, 0x04, 0x70, 0x80, 0x01, 0x71, 0x30, 0x90, 0x01,
+0x30, 0xF0, 0xE0, 0x24, 0xE4, 0x21, 0xE0, 0x70, 0xC0, 0x20, 0xE3, 0x20, 0xC0, 0x63, 0xC2, 0x2F,
+0x03, 0xC1, 0x2F, 0x0C, 0xE2, 0xC0, 0x62, 0xC0, 0x2D, 0xC1, 0x27, 0xE0, 0x20, 0xC0, 0x61, 0x2F,
+0x0B, 0xE0, 0xC0, 0x60, 0xC0, 0x28, 0xE0, 0xC1, 0x2F, 0x03, 0xC0, 0x70, 0xF0, 0x90, 0x60, 0xE7,
+0xF0, 0x40, 0x01, 0x80, 0xA0, 0xB0, 0x50, 0x00, 0x70, 0x08, 0x50, 0x10, 0x02, 0x90, 0xB0, 0x04,
+0x90, 0xA0, 0x70, 0x40, 0x30, 0xA0, 0x80, 0xA0, 0x10, 0x50, 0x05, 0x40, 0x0A, 0x50, 0x40, 0xA0,
+0x01, 0xA1, 0xE2, 0xA1, 0x0F, 0x02, 0x50, 0x90, 0x80, 0x30, 0xC0, 0xE1, 0x25, 0xE0, 0xA0, 0xB0,
+0x09, 0x90, 0xB0, 0x50, 0x40, 0xA0, 0x81, 0x30, 0xA0, 0x30, 0x80, 0x40, 0x02, 0xA0, 0x0E, 0x50,
+0xD0, 0x40, 0x05, 0x40, 0x02, 0x50, 0x80, 0x0E, 0xB0, 0x50, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x0F,
+0x01, 0x80, 0x60, 0x21, 0xE0, 0x70, 0x02, 0x30, 0x03, 0x41, 0x30, 0x04, 0x08, 0x90, 0xD0, 0x30,
+0xB0, 0x01, 0x70, 0xE0, 0x22, 0xE0, 0x21, 0xE0, 0xF0, 0x60, 0xE1, 0x21, 0xE0, 0xC0, 0x2C, 0xC1,
+0x62, 0xC1, 0x21, 0xE2, 0x28, 0xC1, 0x2F, 0x13, 0xC0, 0x62, 0xC0, 0xE2, 0x25, 0xE0, 0x60, 0xC0,
+0x29, 0xE1, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x09, 0xC0, 0x60, 0xC0, 0xE0, 0x26, 0x60, 0xE0,
+0x2F, 0x04, 0xE0, 0xC0, 0x60, 0xE2, 0x60, 0xF0, 0xE1, 0x60, 0xA1, 0x03, 0x30, 0xD0, 0x90, 0x80,
+0x70, 0x09, 0x30, 0x50, 0x00, 0xB0, 0x90, 0x06, 0xB1, 0xA0, 0xB0, 0x01, 0x50, 0x30, 0x05, 0x80,
+0x30, 0x80, 0x07, 0x80, 0x40, 0x90, 0x10, 0x90, 0x00, 0xB0, 0x10, 0x60, 0xE2, 0xA0, 0x90, 0x0E,
+0xB0, 0x90, 0x40, 0x50, 0x01, 0x90, 0x70, 0xF0, 0xC0, 0xE0, 0x24, 0xE0, 0x60, 0xA0, 0x70, 0xA0,
+0x06, 0x30, 0xA0, 0x30, 0x80, 0x90, 0xB0, 0x02, 0xB0, 0x01, 0xA0, 0x90, 0x80, 0x70, 0x80, 0x0E,
+0xA0, 0x07, 0x90, 0x02, 0x41, 0x08, 0xB0, 0x51, 0x41, 0x90, 0x50, 0xB1, 0x0F, 0x06, 0x50, 0xF0,
+0x21, 0xE0, 0x70, 0x02, 0xA0, 0x03, 0x40, 0x80, 0x30, 0x04, 0x0A, 0xA0, 0x30, 0xA0, 0x30, 0x10,
+0xE0, 0x21, 0x60, 0x70, 0xE0, 0x20, 0xE0, 0xD1, 0xA0, 0xE0, 0x2F, 0x04, 0xE0, 0x20, 0xC0, 0x64,
+0xC0, 0x20, 0xE0, 0x21, 0xE1, 0x21, 0xE0, 0x60, 0xE0, 0x2F, 0x14, 0xE0, 0x20, 0xC0, 0x62, 0xC0,
+0x20, 0xE0, 0x22, 0xE0, 0x20, 0x60, 0xE0, 0x2C, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x09, 0xE0,
+0x61, 0x24, 0xE0, 0x60, 0x20, 0xE0, 0x2F, 0x05, 0xE0, 0x60, 0xC0, 0xE0, 0xF0, 0x71, 0xA0, 0xC0,
+0x10, 0xB0, 0x05, 0xB0, 0x30, 0x10, 0xD0, 0xB0, 0x08, 0xB0, 0xD0, 0x00, 0x90, 0x0B, 0x30, 0xA1,
+0x30, 0x02, 0x50, 0xB0, 0xA0, 0x80, 0x00, 0x41, 0x04, 0xB0, 0x40, 0x10, 0xD0, 0xA0, 0x00, 0xB0,
+0x70, 0x11, 0xB0, 0xE0, 0x60, 0xA0, 0x10, 0x90, 0x0C, 0x90, 0x40, 0x50, 0x06, 0x90, 0xA0, 0xF0,
+0xE2, 0x22, 0xC0, 0xF0, 0x80, 0x10, 0x80, 0x02, 0x50, 0x90, 0x30, 0x80, 0xB0, 0x0A, 0xD0, 0x90,
+0x0F, 0x01, 0x10, 0x07, 0x90, 0xB0, 0x01, 0xB0, 0x30, 0x03, 0xB0, 0x50, 0x41, 0x91, 0x50, 0xB0,
+0x0F, 0x0C, 0xB0, 0xA0, 0xE0, 0x20, 0xE0, 0xF0, 0xA1, 0x30, 0x10, 0x04, 0x50, 0xB0, 0x04, 0x0A,
+0x30, 0x02, 0x10, 0xE0, 0x20, 0xE0, 0x70, 0x61, 0xE1, 0x30, 0x90, 0xF0, 0xE0, 0x2F, 0x0C, 0xC0,
+0x64, 0xC1, 0xE1, 0x60, 0xE0, 0x2F, 0x18, 0xE1, 0xC0, 0x62, 0xC0, 0x20, 0xE0, 0xC0, 0x60, 0xE0,
+0x2F, 0x02, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x05, 0xE0, 0xC0, 0x61, 0xE0, 0x21, 0xC1, 0xE0, 0x2F,
+0x05, 0xE1, 0xC0, 0xF0, 0xC0, 0xE0, 0x70, 0x90, 0x50, 0x80, 0x90, 0x07, 0x50, 0xB0, 0x80, 0xD0,
+0x80, 0x90, 0x08, 0xA0, 0x80, 0x00, 0x70, 0xA2, 0x80, 0x03, 0xB0, 0xA0, 0x90, 0x00, 0x50, 0x90,
+0x10, 0x70, 0xA0, 0x80, 0xA0, 0xB0, 0x02, 0x31, 0x01, 0xB0, 0x40, 0x50, 0xA0, 0x11, 0x30, 0x70,
+0x10, 0xD0, 0x80, 0x70, 0xD1, 0x70, 0x10, 0x70, 0x50, 0x90, 0x08, 0x50, 0x40, 0x90, 0xB0, 0x0A,
+0x80, 0x70, 0xA0, 0x70, 0xC0, 0x20, 0xE0, 0x20, 0xC0, 0xB0, 0x10, 0x71, 0x90, 0x40, 0xB0, 0x30,
+0x80, 0x0C, 0x80, 0x50, 0x0F, 0x00, 0xB0, 0x70, 0x07, 0xB1, 0x01, 0x50, 0x30, 0x90, 0x42, 0x50,
+0xB0, 0x0F, 0x12, 0xB0, 0xA0, 0xE0, 0x20, 0xE0, 0x61, 0x01, 0x80, 0x50, 0x0A, 0x09, 0xB0, 0x30,
+0x01, 0xB0, 0x10, 0xE0, 0x20, 0xE0, 0x60, 0x80, 0x70, 0xF0, 0xA0, 0x70, 0x50, 0xA0, 0xE1, 0x2F,
+0x0B, 0xE2, 0x21, 0xE0, 0xC0, 0x63, 0xC1, 0x22, 0xE0, 0x2F, 0x17, 0xE1, 0xC0, 0x62, 0x2F, 0x04,
+0xE1, 0x20, 0x62, 0xC0, 0x2F, 0x05, 0xE1, 0xC0, 0x60, 0xC0, 0x20, 0x60, 0xE1, 0x2F, 0x04, 0xE0,
+0xC0, 0x10, 0xA0, 0xF0, 0x70, 0xA0, 0x10, 0x80, 0x09, 0xB0, 0x50, 0x01, 0xB0, 0x50, 0xA0, 0x40,
+0x07, 0x80, 0x10, 0xA0, 0x40, 0x02, 0x70, 0x02, 0x30, 0xA0, 0x90, 0x02, 0x30, 0x80, 0x07, 0xB0,
+0x80, 0x30, 0x50, 0x90, 0x00, 0xD0, 0x30, 0xE0, 0xF0, 0x60, 0x80, 0xA0, 0x02, 0x30, 0x10, 0xA0,
+0xC1, 0xA1, 0x71, 0x80, 0xB0, 0x01, 0x50, 0x91, 0xB0, 0x0F, 0x00, 0x30, 0xF0, 0xC0, 0x21, 0xE0,
+0x61, 0xF0, 0xC0, 0xF0, 0x40, 0x00, 0x50, 0x30, 0x0D, 0x50, 0x30, 0x0E, 0xB0, 0xD0, 0xB0, 0x05,
+0xB0, 0x50, 0x90, 0x41, 0x90, 0x50, 0xA0, 0x0F, 0x18, 0xB0, 0xA0, 0xE0, 0x21, 0xC0, 0xF0, 0x01,
+0x50, 0x40, 0x0A, 0x09, 0xB0, 0xA0, 0x50, 0xB0, 0x90, 0xA0, 0xE0, 0x20, 0xE0, 0xC0, 0x10, 0x70,
+0xA0, 0xD0, 0x80, 0x00, 0x50, 0x10, 0x60, 0xE0, 0x2F, 0x12, 0xE0, 0xC3, 0x63, 0xC1, 0x21, 0xE1,
+0x2F, 0x13, 0xE2, 0x60, 0x2F, 0x07, 0xE1, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x05, 0xC0, 0x60,
+0xC0, 0xE0, 0x2F, 0x05, 0xE0, 0xC0, 0x10, 0x01, 0x40, 0xB0, 0x50, 0xB0, 0x09, 0xB0, 0x50, 0x03,
+0x30, 0x07, 0x50, 0x70, 0x50, 0x04, 0xA1, 0x40, 0x31, 0x04, 0x30, 0x09, 0x40, 0x30, 0x50, 0x01,
+0x30, 0xF0, 0xE2, 0x70, 0xA0, 0x40, 0x01, 0xA0, 0xF0, 0xE6, 0x60, 0xA0, 0x82, 0x50, 0x0A, 0x50,
+0x90, 0xB0, 0x03, 0xA0, 0xE1, 0x21, 0xE0, 0x60, 0xC0, 0x21, 0xE0, 0x70, 0x00, 0x90, 0x80, 0x0D,
+0xB0, 0xA0, 0x0E, 0x50, 0x80, 0x01, 0xB0, 0x50, 0x90, 0x40, 0x90, 0x50, 0xB1, 0x90, 0x01, 0x80,
+0x90, 0x0B, 0x51, 0x0F, 0x0A, 0x90, 0xF0, 0xE0, 0x21, 0xE0, 0xA0, 0xB0, 0x50, 0x40, 0x30, 0x0A,
+0x09, 0xB0, 0xA0, 0x40, 0x80, 0xD0, 0xF0, 0xE0, 0x21, 0xE1, 0xA1, 0x70, 0x40, 0x00, 0x80, 0x40,
+0x70, 0x60, 0xE0, 0x2F, 0x11, 0xE0, 0xC1, 0x20, 0xE2, 0x21, 0xC0, 0x64, 0xC0, 0x22, 0xE0, 0x2F,
+0x10, 0xE0, 0x60, 0x2F, 0x0A, 0xE1, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x02, 0xC0, 0x62, 0xE0,
+0x2F, 0x05, 0xE0, 0x10, 0xA0, 0x50, 0x00, 0x50, 0x0B, 0xB0, 0x50, 0x02, 0x50, 0x80, 0x07, 0x81,
+0x04, 0x90, 0x10, 0xB0, 0x90, 0xB0, 0x04, 0x90, 0x40, 0x07, 0xB0, 0x40, 0x50, 0x30, 0xB0, 0x00,
+0x40, 0x10, 0xE0, 0x22, 0xC1, 0xA0, 0x50, 0xF1, 0xE1, 0x24, 0x61, 0xC1, 0xF1, 0xA0, 0x30, 0x09,
+0x80, 0xA0, 0x50, 0x03, 0xF0, 0xC0, 0xE0, 0x22, 0xC1, 0x21, 0xE0, 0xF0, 0x81, 0x40, 0x0E, 0xA0,
+0x0C, 0xB0, 0x50, 0x81, 0x91, 0x50, 0xB0, 0x05, 0x40, 0x90, 0xA1, 0x0C, 0x40, 0x30, 0x0F, 0x0A,
+0x40, 0x60, 0xE0, 0x21, 0xE0, 0xD0, 0x81, 0x40, 0x30, 0x0A, 0x09, 0x50, 0x40, 0x01, 0x70, 0x30,
+0xE0, 0x22, 0xE0, 0x60, 0xA0, 0x81, 0x30, 0x70, 0x01, 0x70, 0xE0, 0x2F, 0x11, 0xE0, 0x60, 0x26,
+0xE1, 0x23, 0xC0, 0x64, 0xC0, 0x20, 0xE2, 0x2F, 0x09, 0xE0, 0xC1, 0x2F, 0x0D, 0xE0, 0x20, 0xC0,
+0x61, 0xC0, 0xE1, 0x2D, 0xE0, 0x60, 0x20, 0xE0, 0xC0, 0x60, 0xC0, 0xE1, 0x2F, 0x03, 0xE0, 0xC0,
+0x11, 0x40, 0x0B, 0xB0, 0x90, 0x02, 0x50, 0x81, 0x70, 0x30, 0x50, 0xB0, 0x50, 0x40, 0x30, 0xA0,
+0xD0, 0x04, 0x50, 0x80, 0x01, 0x90, 0x04, 0x30, 0xB0, 0x05, 0xB0, 0x40, 0x90, 0x01, 0x41, 0x00,
+0x71, 0xE0, 0x22, 0xE1, 0x60, 0x70, 0xA0, 0xE0, 0x21, 0xE0, 0x20, 0xC0, 0x61, 0x20, 0xE0, 0x20,
+0xE3, 0xF1, 0x0D, 0x90, 0x00, 0xB0, 0x70, 0xE0, 0x21, 0xE1, 0x60, 0x22, 0xE0, 0xA1, 0x0F, 0x00,
+0x30, 0x40, 0xB0, 0x04, 0xB0, 0x50, 0x90, 0x42, 0x50, 0xB0, 0x00, 0xA0, 0x09, 0x50, 0x70, 0x0F,
+0x1B, 0x50, 0xF0, 0xE0, 0x21, 0xE0, 0xA0, 0x02, 0xA0, 0x0A, 0x09, 0x40, 0x90, 0x01, 0x70, 0xF0,
+0xE0, 0x23, 0xE0, 0x60, 0x30, 0xD0, 0x70, 0x02, 0x80, 0x60, 0xE0, 0x2F, 0x10, 0xE0, 0x60, 0x2D,
+0xE2, 0x20, 0xC1, 0x63, 0xC1, 0x2F, 0x07, 0xE0, 0x60, 0xC0, 0x2F, 0x0F, 0xE2, 0xC0, 0x61, 0x20,
+0xE0, 0x2A, 0xE0, 0xC1, 0x21, 0xE1, 0xC0, 0x60, 0xC0, 0xE1, 0x2F, 0x02, 0xE0, 0xF0, 0x60, 0x10,
+0x40, 0x0A, 0xB0, 0x50, 0x01, 0x50, 0xD0, 0xA0, 0x30, 0xB0, 0x72, 0x80, 0x30, 0x40, 0x06, 0xA0,
+0x40, 0xB0, 0x10, 0x40, 0x04, 0x70, 0x05, 0x91, 0x04, 0x30, 0x70, 0x90, 0x70, 0xE0, 0x24, 0xE3,
+0x20, 0xC0, 0x61, 0xC0, 0xE1, 0x26, 0xE0, 0x70, 0x50, 0x71, 0xA0, 0x50, 0x01, 0x31, 0xB0, 0x02,
+0x80, 0xA1, 0x40, 0xD0, 0xE0, 0x22, 0xE0, 0x60, 0xE0, 0x21, 0xE0, 0xC0, 0x10, 0xB0, 0x0F, 0x00,
+0x31, 0xB0, 0x50, 0x90, 0x41, 0x50, 0xB0, 0x06, 0xB0, 0xA0, 0x08, 0x50, 0xA0, 0xB0, 0x0F, 0x1A,
+0x90, 0xF0, 0xE0, 0x21, 0xE0, 0xA0, 0x02, 0x30, 0x0A, 0x09, 0x80, 0x70, 0x30, 0x80, 0xD0, 0x60,
+0xE0, 0x24, 0xE0, 0xF0, 0xD0, 0x80, 0x02, 0xB0, 0x70, 0xE0, 0x2F, 0x10, 0xE0, 0x60, 0x2F, 0x08,
+0xC1, 0x63, 0xC1, 0x20, 0xE2, 0x2C, 0xE0, 0x60, 0xE0, 0x2F, 0x13, 0xE0, 0x20, 0x61, 0xC0, 0xE1,
+0x27, 0xE0, 0x60, 0x26, 0x61, 0xC0, 0xE0, 0x2F, 0x02, 0xE1, 0x10, 0x90, 0xB0, 0x09, 0xB0, 0x50,
+0x01, 0x70, 0x50, 0x02, 0x80, 0xA0, 0x30, 0x90, 0x80, 0x70, 0x80, 0xB0, 0x02, 0x80, 0xA0, 0x70,
+0xA0, 0x50, 0xB0, 0x02, 0x40, 0xA0, 0xD0, 0x50, 0x03, 0x50, 0x40, 0xB0, 0x05, 0x51, 0x10, 0xF0,
+0xE0, 0x24, 0xE1, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x29, 0xE0, 0x70, 0x80, 0xB0, 0x00, 0xB0, 0xA0,
+0xB0, 0x00, 0xB0, 0x10, 0x50, 0x02, 0xA0, 0x00, 0xD0, 0x50, 0xA0, 0xE0, 0x23, 0x60, 0x20, 0xE1,
+0xC0, 0x70, 0x90, 0x0C, 0xB0, 0x50, 0x90, 0x40, 0x90, 0x30, 0xB1, 0x0C, 0xA0, 0x08, 0xB0, 0x30,
+0xB0, 0x0F, 0x1A, 0x30, 0xC0, 0x22, 0xE0, 0xA0, 0x80, 0x30, 0xA0, 0x70, 0x0A, 0x09, 0x30, 0x01,
+0xB0, 0x70, 0xE1, 0x24, 0xE0, 0xF0, 0x40, 0x04, 0xA0, 0xE0, 0x2F, 0x10, 0xE0, 0x60, 0xE0, 0x2F,
+0x08, 0xE2, 0x20, 0xC1, 0x63, 0xC1, 0x2C, 0x60, 0xE0, 0x2F, 0x15, 0xE0, 0x20, 0xC0, 0x61, 0xC0,
+0x20, 0xE1, 0x23, 0xC0, 0x60, 0x25, 0xE0, 0x20, 0xC0, 0x61, 0xE0, 0x2F, 0x02, 0xE0, 0xF0, 0x40,
+0x90, 0x09, 0xB0, 0x50, 0x00, 0x30, 0x90, 0x04, 0xB0, 0x10, 0x80, 0x50, 0x00, 0x40, 0x80, 0x70,
+0xA1, 0x90, 0x01, 0x50, 0xD0, 0x90, 0x00, 0x50, 0xD0, 0x40, 0x50, 0xA0, 0xB0, 0x01, 0xB0, 0x40,
+0x50, 0x08, 0x40, 0x70, 0xE1, 0x24, 0x62, 0x20, 0xE2, 0x29, 0xE0, 0xF0, 0x30, 0x03, 0x40, 0x80,
+0x91, 0x03, 0x80, 0x90, 0x00, 0x80, 0x30, 0x10, 0xC0, 0xE3, 0xC1, 0xE0, 0xC0, 0x70, 0x09, 0x50,
+0x90, 0x41, 0x90, 0x50, 0xB0, 0x02, 0x90, 0x30, 0x0C, 0x30, 0xB0, 0x09, 0xA0, 0xB1, 0x0F, 0x19,
+0xA0, 0xE0, 0x22, 0xE0, 0xA0, 0x90, 0x01, 0x30, 0x0A, 0x09, 0x30, 0x02, 0xD0, 0xE0, 0x25, 0xE0,
+0xF0, 0x30, 0x70, 0xD0, 0xB0, 0x01, 0xD0, 0x60, 0xE0, 0x2F, 0x10, 0x60, 0x2F, 0x0B, 0xE0, 0x23,
+0xE1, 0x20, 0xC0, 0x64, 0xC1, 0xE5, 0x20, 0x60, 0xE0, 0x2F, 0x19, 0xE0, 0xC0, 0x61, 0xC0, 0xE3,
+0x60, 0xC0, 0x28, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x10, 0xA0, 0x50, 0x08, 0xB0,
+0x50, 0x00, 0x11, 0x01, 0xD0, 0xB0, 0x11, 0x80, 0x90, 0x03, 0xA0, 0x90, 0x05, 0x80, 0xA1, 0x03,
+0x70, 0x40, 0x91, 0x08, 0xB0, 0x00, 0x50, 0xA0, 0xE2, 0x20, 0x62, 0xC0, 0xE0, 0x2C, 0xE1, 0xF0,
+0xA0, 0x05, 0x80, 0x40, 0x70, 0xD0, 0x90, 0x00, 0xB0, 0x70, 0x04, 0x70, 0x90, 0xF0, 0xA0, 0x60,
+0xE0, 0x60, 0x80, 0x70, 0x03, 0xB0, 0x50, 0x91, 0x40, 0x91, 0xB0, 0x09, 0x90, 0x30, 0x0A, 0x40,
+0x80, 0x0A, 0x40, 0x70, 0xA1, 0x0F, 0x18, 0x70, 0xC0, 0x22, 0xE0, 0xF0, 0x50, 0x01, 0x80, 0xB0,
+0x09, 0x09, 0xA0, 0x51, 0x90, 0x10, 0xE2, 0x21, 0xE0, 0x20, 0xE0, 0xC0, 0x60, 0xE0, 0x30, 0x80,
+0xB0, 0x00, 0xD0, 0x70, 0xE0, 0x2F, 0x0F, 0xC1, 0x2F, 0x15, 0xE0, 0x20, 0xE0, 0x20, 0xC0, 0x64,
+0xC3, 0xE0, 0x2F, 0x1A, 0xE2, 0xC0, 0x60, 0xC2, 0x60, 0xE0, 0x29, 0xE1, 0xC0, 0x60, 0xC0, 0xE0,
+0x2E, 0xE0, 0xF0, 0x70, 0x90, 0x08, 0xB0, 0x50, 0x00, 0x81, 0x30, 0x70, 0x80, 0x10, 0x80, 0x00,
+0x50, 0x40, 0x02, 0x50, 0xA0, 0xD0, 0x0C, 0x50, 0xA0, 0x40, 0x51, 0x05, 0x50, 0xA1, 0x70, 0x30,
+0xF0, 0xE0, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x23, 0xE1, 0x60, 0xE6, 0xC0, 0xA1, 0xF0, 0x08, 0x10,
+0x00, 0x80, 0xA0, 0x30, 0xB0, 0x04, 0xB0, 0x30, 0x40, 0xB0, 0xF0, 0xA0, 0xF0, 0x80, 0xB0, 0x50,
+0x90, 0x41, 0x90, 0xB1, 0x0F, 0x00, 0x80, 0x40, 0x30, 0xD0, 0xB0, 0x05, 0x30, 0x80, 0x0B, 0x90,
+0x01, 0x80, 0x30, 0x10, 0x50, 0x0F, 0x14, 0x50, 0x80, 0xA0, 0xE0, 0x21, 0xE0, 0xF0, 0x40, 0xB0,
+0x50, 0xA0, 0xB0, 0x09, 0x09, 0xA0, 0x40, 0x80, 0xA0, 0xD0, 0xC0, 0x61, 0xC0, 0x60, 0xC3, 0xE2,
+0xF0, 0x70, 0xB0, 0x50, 0xA0, 0xE1, 0x2F, 0x0E, 0xC1, 0x2F, 0x1E, 0xC2, 0x61, 0xC2, 0x20, 0xE2,
+0x2F, 0x16, 0xE0, 0x21, 0xC1, 0x60, 0xC0, 0xE0, 0x2B, 0xE0, 0x20, 0x61, 0x2E, 0xE0, 0x60, 0x10,
+0xB0, 0x90, 0x07, 0xB0, 0x50, 0x01, 0x40, 0x30, 0xB0, 0x00, 0xB0, 0x01, 0x40, 0xD0, 0x01, 0x30,
+0xA0, 0x30, 0xF0, 0x80, 0x40, 0x08, 0x50, 0x40, 0xB0, 0x50, 0x80, 0xD0, 0xA0, 0x04, 0xB0, 0xD0,
+0x02, 0x90, 0x30, 0x60, 0xC0, 0x20, 0xE0, 0x24, 0xE0, 0xC0, 0x60, 0xA0, 0xD0, 0x30, 0xD0, 0xF3,
+0x30, 0xA0, 0x50, 0x0A, 0xA0, 0xB0, 0x0B, 0xB0, 0x50, 0x90, 0x80, 0x51, 0xB0, 0x0F, 0x07, 0x80,
+0xB0, 0x90, 0x30, 0x04, 0x90, 0x30, 0x0C, 0x40, 0x02, 0x50, 0xB0, 0x30, 0x80, 0x0F, 0x11, 0xB1,
+0x40, 0xB0, 0xA0, 0xC0, 0x62, 0xF0, 0x70, 0x80, 0x40, 0x30, 0x50, 0x09, 0x08, 0xB0, 0x30, 0x01,
+0x90, 0x10, 0xE2, 0x20, 0xC3, 0x63, 0xC0, 0x60, 0x30, 0x50, 0x30, 0xC1, 0x25, 0xE2, 0x2F, 0x05,
+0x60, 0x2F, 0x21, 0xE0, 0x60, 0xE0, 0x20, 0xC1, 0x63, 0xC0, 0x2F, 0x19, 0xE0, 0x60, 0xE0, 0x2E,
+0xE0, 0xC0, 0x60, 0xC0, 0x2C, 0xE0, 0x60, 0x10, 0x41, 0x07, 0xB0, 0x50, 0x01, 0x50, 0xA0, 0x03,
+0x40, 0x00, 0xB0, 0x01, 0x70, 0xC1, 0xD0, 0x11, 0xB0, 0x05, 0xB0, 0x40, 0x50, 0x04, 0x10, 0xA0,
+0x81, 0xA1, 0x70, 0x03, 0xA0, 0x40, 0xE1, 0x25, 0xE0, 0xF0, 0xA0, 0x60, 0x50, 0x00, 0x50, 0x00,
+0x80, 0x40, 0x91, 0x50, 0x0A, 0x50, 0xD0, 0x00, 0x70, 0x00, 0x31, 0x02, 0xB0, 0x90, 0x41, 0x91,
+0x50, 0xB0, 0x00, 0x90, 0x0F, 0x0C, 0xB0, 0x80, 0x03, 0x30, 0x80, 0x0D, 0x40, 0x05, 0x40, 0x30,
+0x0F, 0x06, 0xB0, 0x51, 0x90, 0x43, 0x92, 0x50, 0xB0, 0x30, 0x60, 0xC1, 0xE1, 0xC0, 0x80, 0x01,
+0x90, 0x40, 0x09, 0x08, 0xB0, 0x80, 0x01, 0x90, 0x70, 0xE0, 0x2A, 0xE1, 0x60, 0xF1, 0x60, 0xC0,
+0x68, 0xC3, 0x20, 0xE7, 0x27, 0x60, 0xE0, 0x2F, 0x20, 0xE0, 0x60, 0xE0, 0x26, 0xC0, 0x64, 0xC1,
+0xE2, 0x2F, 0x10, 0x60, 0xE0, 0x2F, 0x01, 0xE0, 0xC0, 0x60, 0xC0, 0xE1, 0x28, 0xE0, 0xA0, 0x91,
+0x00, 0x90, 0x06, 0xB0, 0x50, 0x01, 0xD0, 0x90, 0x02, 0xB0, 0x90, 0x03, 0x30, 0x60, 0xE0, 0x60,
+0x70, 0x10, 0xA0, 0x04, 0x40, 0x90, 0x06, 0xA0, 0x90, 0xB0, 0x50, 0x06, 0xA0, 0x90, 0x60, 0xE0,
+0x24, 0xE0, 0xA0, 0x80, 0x0F, 0x05, 0x50, 0xD1, 0x00, 0x40, 0x80, 0x30, 0x70, 0x30, 0x40, 0x90,
+0x50, 0xB0, 0x06, 0x90, 0xB0, 0x0F, 0x0B, 0x50, 0x80, 0x02, 0x30, 0x40, 0x0E, 0x40, 0x05, 0x40,
+0x70, 0x09, 0xB1, 0x50, 0x91, 0x41, 0x90, 0x42, 0x90, 0x51, 0xB1, 0x07, 0x40, 0xA0, 0xE0, 0x20,
+0xE0, 0x22, 0xA0, 0x01, 0x50, 0x80, 0x09, 0x08, 0x50, 0x70, 0x81, 0x30, 0xF0, 0xE0, 0x2B, 0xE0,
+0x60, 0x10, 0xA0, 0xE5, 0x24, 0xC2, 0x67, 0xC3, 0x24, 0xE0, 0x60, 0xE0, 0x2F, 0x20, 0xE0, 0x60,
+0x27, 0xE2, 0x20, 0xE0, 0xC1, 0x63, 0xC1, 0x2F, 0x0D, 0x60, 0xC0, 0x2F, 0x02, 0xE1, 0xC0, 0xF0,
+0x60, 0xC0, 0xE1, 0x26, 0xE0, 0x70, 0xB0, 0x01, 0x90, 0xB0, 0x05, 0xB0, 0x50, 0x01, 0x90, 0x40,
+0x01, 0x50, 0x40, 0x04, 0xF0, 0x60, 0xE2, 0xC0, 0x10, 0x40, 0x01, 0x50, 0x40, 0xB0, 0x07, 0x40,
+0x30, 0x08, 0x10, 0xE0, 0x60, 0x24, 0xE0, 0xF0, 0x40, 0x0F, 0x05, 0xB0, 0x30, 0xA0, 0x30, 0x40,
+0x90, 0xA0, 0x40, 0x80, 0x70, 0x40, 0x09, 0x51, 0x0F, 0x0B, 0x90, 0x40, 0x50, 0x80, 0xA0, 0x50,
+0x0F, 0x00, 0x90, 0x04, 0x50, 0xA0, 0x90, 0x52, 0x93, 0x40, 0x91, 0x51, 0xB1, 0x0F, 0x04, 0x40,
+0x60, 0xE0, 0x23, 0xE0, 0x70, 0x81, 0x30, 0x80, 0x09, 0x08, 0x50, 0x80, 0xB1, 0x80, 0xF0, 0xE0,
+0x2D, 0xC0, 0xE1, 0x20, 0xE0, 0x20, 0xE1, 0x25, 0xE0, 0x20, 0xE0, 0x26, 0xC3, 0x66, 0xC3, 0x22,
+0xE7, 0x2F, 0x12, 0xC0, 0x60, 0x2F, 0x04, 0xC0, 0x63, 0xC1, 0x20, 0xE2, 0x2F, 0x03, 0x60, 0xE0,
+0x2F, 0x02, 0xC0, 0xF0, 0x10, 0x30, 0xA0, 0xF1, 0x60, 0xC0, 0xE2, 0x22, 0xE0, 0xA0, 0x03, 0x40,
+0x05, 0xB0, 0x90, 0x01, 0x50, 0x30, 0x40, 0x50, 0xA0, 0xF0, 0xA0, 0x50, 0x02, 0xB0, 0x10, 0x60,
+0xE2, 0xD1, 0x41, 0x50, 0x0A, 0xA0, 0x07, 0x90, 0x80, 0xD0, 0xC0, 0x22, 0xE1, 0x60, 0x30, 0x0F,
+0x00, 0xB1, 0x50, 0x90, 0x40, 0x90, 0x50, 0xB1, 0x02, 0xB0, 0xA0, 0x40, 0xA0, 0xB0, 0x09, 0xB0,
+0x90, 0x0F, 0x0B, 0x90, 0xD0, 0x30, 0xB0, 0x0C, 0xB2, 0x51, 0x41, 0x90, 0x40, 0x90, 0x40, 0x30,
+0x90, 0xB4, 0x01, 0xD0, 0x50, 0x0F, 0x0A, 0x80, 0xF0, 0xE0, 0x21, 0xE0, 0x20, 0xE0, 0x70, 0xB1,
+0x50, 0x30, 0x09, 0x08, 0x90, 0x40, 0x01, 0x30, 0xF0, 0xE0, 0x2D, 0xE0, 0xF0, 0x20, 0x60, 0xC0,
+0xE0, 0x2F, 0x04, 0xE0, 0x20, 0xE5, 0x60, 0xC3, 0x68, 0xC1, 0x2F, 0x12, 0xC1, 0x2F, 0x04, 0xE3,
+0xC1, 0x60, 0xC0, 0x62, 0xC0, 0x2F, 0x02, 0x60, 0xE0, 0x2F, 0x01, 0xC0, 0x70, 0x40, 0x50, 0x00,
+0xB0, 0x91, 0x80, 0xA1, 0xF0, 0xA0, 0xC1, 0xE0, 0x60, 0xF0, 0x03, 0x51, 0x05, 0x50, 0x02, 0x50,
+0x10, 0xA0, 0x60, 0xE0, 0xC0, 0xD0, 0x03, 0x90, 0x60, 0x70, 0xE2, 0xF0, 0x30, 0x10, 0x70, 0x50,
+0x08, 0x41, 0x06, 0x80, 0x30, 0x40, 0x80, 0xA0, 0xC1, 0x60, 0xA0, 0x70, 0xA0, 0x0B, 0xB0, 0x50,
+0x41, 0x91, 0x50, 0xB0, 0x06, 0xB0, 0x40, 0xD0, 0x70, 0xD0, 0xB0, 0x0B, 0x90, 0x0F, 0x0D, 0x80,
+0xA0, 0xB0, 0x00, 0x90, 0x40, 0xB0, 0x50, 0x90, 0x43, 0x92, 0x51, 0xB1, 0x51, 0x01, 0x50, 0xA0,
+0x50, 0x06, 0x80, 0x10, 0x30, 0xA0, 0x0F, 0x09, 0x10, 0xF0, 0x24, 0xE0, 0xA0, 0x02, 0x30, 0x09,
+0x08, 0x90, 0x80, 0x01, 0x70, 0x60, 0xE0, 0x2E, 0xE1, 0xD0, 0x70, 0xC0, 0xE0, 0x28, 0xE0, 0x2F,
+0x01, 0x60, 0xE1, 0x22, 0xE1, 0x24, 0xC2, 0x68, 0xC2, 0x20, 0xE7, 0x2C, 0xC1, 0x2F, 0x0A, 0xE0,
+0x60, 0xE2, 0xC0, 0x63, 0xC1, 0x20, 0xE3, 0x25, 0xC1, 0xE0, 0x2F, 0x01, 0xE0, 0x10, 0x06, 0xB0,
+0x40, 0x80, 0x90, 0x30, 0xA1, 0x10, 0x90, 0x04, 0x40, 0x02, 0x80, 0x10, 0x30, 0x80, 0x01, 0x50,
+0x70, 0x60, 0xC0, 0xE2, 0x60, 0x80, 0x04, 0x50, 0xA0, 0x61, 0xE0, 0x60, 0xA0, 0x11, 0x70, 0x02,
+0xA0, 0x80, 0x02, 0x50, 0x70, 0x05, 0x90, 0x10, 0x90, 0x01, 0x90, 0xA0, 0x10, 0xF0, 0x40, 0x07,
+0xB0, 0x50, 0x43, 0x90, 0xB0, 0x0A, 0xB0, 0x80, 0xA0, 0x90, 0x00, 0xB0, 0x00, 0x70, 0x80, 0x0A,
+0x40, 0x0F, 0x06, 0xB0, 0x51, 0x95, 0x81, 0x90, 0x30, 0x80, 0xB0, 0x08, 0x50, 0x02, 0x50, 0x00,
+0xB0, 0x10, 0x03, 0x80, 0xB0, 0x02, 0x40, 0x11, 0x80, 0x0F, 0x08, 0x40, 0x60, 0xE0, 0x24, 0xE0,
+0xA0, 0x01, 0xB0, 0xA0, 0x09, 0x01, 0xB0, 0x80, 0x50, 0x03, 0x90, 0xA0, 0x31, 0x10, 0x60, 0xE0,
+0x2F, 0x00, 0x60, 0xA0, 0x00, 0x70, 0xE0, 0x2F, 0x0B, 0x60, 0xE0, 0x2D, 0xE7, 0xC3, 0x66, 0xC4,
+0x23, 0xE1, 0x22, 0xE0, 0xC1, 0x2F, 0x0B, 0x70, 0xF0, 0x60, 0xD0, 0xE2, 0x20, 0xE0, 0xC1, 0x63,
+0xC1, 0x21, 0xE2, 0xC1, 0x2F, 0x02, 0xE0, 0x10, 0xB0, 0x07, 0x91, 0x02, 0xB0, 0x70, 0x40, 0xB0,
+0x03, 0x90, 0x00, 0xA0, 0xF0, 0xE0, 0xF0, 0x30, 0x70, 0xF0, 0xD0, 0xC0, 0xE0, 0x60, 0xE1, 0x60,
+0xE0, 0x70, 0xB0, 0x03, 0x50, 0xA0, 0xE5, 0x61, 0xA0, 0x30, 0xA0, 0x30, 0x40, 0x30, 0x02, 0x50,
+0xA0, 0x00, 0x50, 0x30, 0x80, 0x90, 0x30, 0xA0, 0x40, 0x00, 0x30, 0xA0, 0x80, 0x70, 0xD0, 0x90,
+0x01, 0xB0, 0x50, 0x91, 0x41, 0x50, 0xB0, 0x0F, 0x01, 0xA0, 0xD0, 0x05, 0x80, 0xA0, 0x10, 0x50,
+0x07, 0x40, 0x09, 0xB1, 0x52, 0x92, 0x42, 0x90, 0x51, 0xB1, 0x08, 0x30, 0x40, 0x50, 0x06, 0xA0,
+0x10, 0xA0, 0x50, 0x40, 0x50, 0x01, 0xD0, 0x03, 0x10, 0xB0, 0x03, 0x80, 0x30, 0x10, 0x80, 0x0F,
+0x07, 0x40, 0xF0, 0xE0, 0x24, 0xE0, 0x70, 0xA0, 0x30, 0x80, 0xA0, 0x09, 0x01, 0x80, 0x50, 0x30,
+0x03, 0x40, 0x90, 0x01, 0x10, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0xF1, 0x00, 0x70, 0xE0, 0x2F, 0x0A,
+0x60, 0xE0, 0x2F, 0x0C, 0xE0, 0x24, 0xC3, 0x66, 0xC2, 0x60, 0xC0, 0xE0, 0x2F, 0x0D, 0xC0, 0x2A,
+0xC1, 0x63, 0xC0, 0x60, 0x2F, 0x03, 0xE0, 0x10, 0xD0, 0x40, 0x00, 0xB0, 0x06, 0x40, 0x90, 0x02,
+0x40, 0xA0, 0x30, 0x70, 0x30, 0x52, 0xA0, 0xE2, 0xC1, 0x60, 0xE1, 0x60, 0xE1, 0xA0, 0xD0, 0xF0,
+0x70, 0xA0, 0xB0, 0x00, 0xB0, 0x40, 0xB0, 0x90, 0xA0, 0xC0, 0xE6, 0x60, 0xD0, 0xF0, 0x00, 0xA0,
+0x03, 0xA0, 0x31, 0x50, 0x90, 0xA0, 0x40, 0x30, 0x90, 0x50, 0x10, 0x30, 0x80, 0xD0, 0x91, 0x40,
+0x90, 0x50, 0xB1, 0x0F, 0x03, 0xB0, 0x31, 0x40, 0x80, 0x07, 0x40, 0x80, 0x07, 0x40, 0xB0, 0x52,
+0x91, 0x41, 0x91, 0x51, 0xB3, 0x0F, 0x03, 0x50, 0x31, 0x05, 0x50, 0x70, 0xE0, 0xF0, 0xA0, 0x70,
+0x50, 0x80, 0x11, 0xB0, 0x01, 0x30, 0x70, 0x50, 0x03, 0xB0, 0xA0, 0x90, 0xA0, 0x50, 0x0F, 0x07,
+0xA0, 0xE0, 0x21, 0xE0, 0x21, 0xE0, 0x30, 0x02, 0xA0, 0x09, 0x01, 0x90, 0xA0, 0x80, 0x03, 0x40,
+0x50, 0x01, 0x10, 0x60, 0x2F, 0x02, 0xE0, 0xF1, 0xD0, 0xC0, 0xE0, 0x2F, 0x09, 0x60, 0xE0, 0x2F,
+0x15, 0xE6, 0xC3, 0x60, 0xC0, 0xE0, 0x2F, 0x0F, 0xE0, 0x2A, 0xE2, 0xC1, 0x60, 0x2F, 0x04, 0x70,
+0x90, 0xA0, 0x70, 0xA0, 0x40, 0x06, 0xB0, 0x40, 0x50, 0x04, 0x90, 0x10, 0xA0, 0x30, 0xD0, 0xE0,
+0x20, 0xC0, 0x60, 0xE2, 0xC1, 0xE0, 0xF0, 0xC0, 0xA0, 0xE1, 0x60, 0x70, 0x40, 0x50, 0x02, 0x90,
+0x70, 0x30, 0xA0, 0xF0, 0xE0, 0x21, 0xE1, 0xC0, 0xD0, 0x00, 0x30, 0x01, 0xB0, 0x30, 0x70, 0xB0,
+0x00, 0x90, 0xD0, 0x31, 0x70, 0x11, 0xD0, 0x70, 0x40, 0x90, 0xB0, 0x07, 0x40, 0xA0, 0x0E, 0xA0,
+0x50, 0x00, 0xA0, 0xB0, 0x08, 0x70, 0x07, 0x90, 0x51, 0xB1, 0x0F, 0x11, 0x70, 0xB0, 0x03, 0x50,
+0x70, 0xE4, 0x70, 0x10, 0x30, 0xA0, 0x70, 0xA1, 0x30, 0x70, 0x04, 0x40, 0xF0, 0xE0, 0x60, 0x80,
+0x0F, 0x07, 0xF1, 0xE0, 0x23, 0xE0, 0x30, 0xB0, 0x01, 0x30, 0x09, 0x08, 0x40, 0xA0, 0x30, 0x80,
+0x10, 0x60, 0x2F, 0x03, 0xE0, 0xC0, 0x70, 0xD0, 0xF0, 0x20, 0xF0, 0x20, 0xE0, 0x2F, 0x05, 0x60,
+0xE0, 0x2F, 0x20, 0x60, 0xE0, 0x2F, 0x10, 0xF0, 0xE1, 0x2A, 0xE2, 0x60, 0x2F, 0x03, 0xE0, 0xA0,
+0x03, 0x11, 0x07, 0x50, 0x40, 0xB0, 0x05, 0x50, 0x70, 0x21, 0xC1, 0x21, 0xE0, 0x60, 0x20, 0xE0,
+0x70, 0xB0, 0xA0, 0xE1, 0xC1, 0xA0, 0x40, 0x04, 0x50, 0x90, 0x70, 0xE1, 0x22, 0xE0, 0xA0, 0x00,
+0x40, 0x10, 0x80, 0x70, 0xB0, 0x01, 0x80, 0x10, 0xF0, 0xE0, 0xF0, 0x70, 0x10, 0xB0, 0x02, 0x50,
+0x08, 0x80, 0x10, 0x90, 0x0C, 0xA0, 0x50, 0x00, 0x90, 0x40, 0x08, 0x50, 0x30, 0x07, 0x50, 0xB0,
+0x0F, 0x13, 0x30, 0x90, 0x03, 0x50, 0xD0, 0xE1, 0x22, 0xE0, 0x60, 0xE4, 0xC0, 0xD0, 0x50, 0x04,
+0x70, 0xE2, 0x70, 0x0F, 0x08, 0xF0, 0x60, 0xE0, 0x22, 0xE0, 0x33, 0x70, 0x09, 0x02, 0x80, 0xD3,
+0x40, 0x80, 0x50, 0x01, 0x10, 0x60, 0x2F, 0x04, 0xE2, 0x60, 0x20, 0xC0, 0xE0, 0x2F, 0x06, 0x60,
+0xE0, 0x2F, 0x20, 0x60, 0xE0, 0x2F, 0x10, 0x71, 0xE0, 0x2C, 0xE0, 0x60, 0x2F, 0x03, 0xE0, 0xA0,
+0x01, 0xB0, 0xA0, 0x80, 0xB0, 0x09, 0x91, 0x04, 0xF1, 0x21, 0xC0, 0x60, 0xE0, 0x20, 0x60, 0xC0,
+0xE1, 0xF0, 0xD0, 0xF0, 0xC0, 0x60, 0xC0, 0xE1, 0xA0, 0xF0, 0x90, 0x50, 0x03, 0x80, 0xA0, 0xF0,
+0x60, 0xE2, 0x70, 0x01, 0x31, 0x01, 0x70, 0xA1, 0x10, 0xF0, 0xC0, 0xD0, 0xF0, 0x30, 0xB1, 0x01,
+0x90, 0x0F, 0x05, 0x90, 0xA0, 0x30, 0xA0, 0xB0, 0x02, 0xA0, 0x08, 0x40, 0x30, 0x07, 0x50, 0xB0,
+0x0F, 0x12, 0xB0, 0xA0, 0x02, 0xB0, 0xD0, 0x70, 0xC0, 0xE0, 0x24, 0x60, 0x23, 0xE0, 0xF0, 0x70,
+0x40, 0x90, 0xB0, 0x01, 0x40, 0xF0, 0xE0, 0x20, 0xE0, 0xF0, 0xA0, 0x50, 0x0F, 0x07, 0x10, 0xE1,
+0x21, 0xE0, 0x30, 0x90, 0xB0, 0x00, 0x30, 0xB0, 0x08, 0x01, 0x90, 0xA0, 0x03, 0xA0, 0x30, 0xB0,
+0x01, 0x10, 0x60, 0xE0, 0x2F, 0x04, 0xE0, 0x70, 0x2F, 0x09, 0xC1, 0x2F, 0x21, 0x60, 0xE0, 0x2F,
+0x20, 0xC0, 0x60, 0x2F, 0x02, 0xE0, 0xF0, 0xA0, 0x01, 0x50, 0x30, 0x0B, 0xB0, 0x10, 0x30, 0xB1,
+0x90, 0x70, 0x60, 0xC1, 0xE0, 0xC1, 0xE0, 0x20, 0x60, 0x20, 0xE1, 0xC0, 0xA1, 0xC0, 0x22, 0xE1,
+0x60, 0xA1, 0x40, 0x04, 0xB0, 0xF0, 0xA0, 0x60, 0xE0, 0x70, 0x01, 0x80, 0x50, 0x01, 0x30, 0x80,
+0x10, 0x70, 0xE0, 0xC0, 0xF0, 0xE0, 0xD0, 0x10, 0x40, 0x01, 0x90, 0x0F, 0x02, 0xB0, 0x50, 0x40,
+0x30, 0x00, 0xB0, 0x04, 0x41, 0x08, 0x70, 0xB0, 0x06, 0x50, 0xB0, 0x0F, 0x12, 0x80, 0x40, 0x02,
+0xA0, 0x60, 0xE0, 0x26, 0x60, 0x24, 0xE0, 0xC0, 0x60, 0xF0, 0xA3, 0xE0, 0x22, 0xE0, 0xF0, 0x10,
+0x0F, 0x07, 0x50, 0xD0, 0xE1, 0x20, 0xE0, 0xF0, 0x50, 0x01, 0x80, 0xB0, 0x08, 0x01, 0x40, 0x80,
+0x03, 0x30, 0xA0, 0xB0, 0x01, 0x10, 0xF0, 0xE0, 0x2F, 0x04, 0xE0, 0xF0, 0xC0, 0x21, 0xE0, 0x2F,
+0x05, 0xC1, 0x2F, 0x21, 0x60, 0xE0, 0x2F, 0x20, 0xC1, 0x2F, 0x02, 0xE0, 0x70, 0x02, 0x90, 0x40,
+0x06, 0xB1, 0x03, 0xB0, 0x00, 0xA1, 0xF0, 0xE2, 0x60, 0xE0, 0xC0, 0x60, 0xE0, 0x60, 0x20, 0xE1,
+0x60, 0xF1, 0xA0, 0xF0, 0xE0, 0x24, 0xE1, 0x70, 0xD0, 0x40, 0x02, 0x30, 0xA0, 0xF0, 0xA0, 0xC0,
+0x60, 0x70, 0x90, 0xA0, 0x03, 0x70, 0xE2, 0xC0, 0x60, 0xC0, 0x11, 0xD0, 0x01, 0x90, 0x03, 0xB0,
+0x70, 0x40, 0x50, 0x08, 0x70, 0x30, 0xA0, 0x80, 0x07, 0x90, 0x40, 0x08, 0x50, 0x70, 0x30, 0x05,
+0x50, 0xB0, 0x0F, 0x12, 0x90, 0x80, 0x01, 0xA0, 0xF0, 0xE0, 0x27, 0x60, 0xE0, 0x25, 0xE5, 0x24,
+0xE0, 0xD0, 0xA0, 0x0F, 0x07, 0x70, 0xA0, 0xE0, 0x20, 0xE0, 0xF0, 0x50, 0x01, 0x80, 0x40, 0x80,
+0x00, 0xA0, 0xD0, 0xA0, 0x03, 0x02, 0x70, 0xD0, 0xA1, 0xD0, 0xA0, 0x80, 0xA0, 0x31, 0xD0, 0xA0,
+0xE0, 0x2F, 0x08, 0xE0, 0xF0, 0x60, 0x2F, 0x04, 0xC1, 0x2F, 0x21, 0x60, 0xE0, 0x2F, 0x1F, 0xE0,
+0xC1, 0x2F, 0x01, 0xE0, 0xC0, 0xA0, 0x02, 0x70, 0x07, 0xA0, 0x40, 0x04, 0x40, 0xA0, 0xE0, 0xC0,
+0x60, 0xC0, 0xE1, 0x60, 0xC2, 0x60, 0xE1, 0xC0, 0xF0, 0x70, 0x01, 0x70, 0xE0, 0x26, 0xE0, 0xC0,
+0xD0, 0x90, 0x00, 0x50, 0xA0, 0xE0, 0xF0, 0x70, 0xF0, 0xE0, 0xF0, 0x10, 0x90, 0x03, 0x80, 0x10,
+0x70, 0x60, 0xF0, 0xE1, 0x90, 0xF0, 0x10, 0xB0, 0x00, 0x90, 0x04, 0x81, 0xD0, 0x05, 0x80, 0x30,
+0x70, 0xA0, 0x80, 0xA0, 0x09, 0xA0, 0x02, 0xB0, 0x10, 0x50, 0x04, 0x80, 0xD0, 0x30, 0x40, 0x90,
+0x01, 0x50, 0xB0, 0x0F, 0x12, 0xB0, 0x30, 0x00, 0xD0, 0xC0, 0xE0, 0x27, 0xE0, 0x60, 0xE0, 0x2F,
+0x02, 0xE0, 0xD0, 0x80, 0x0F, 0x07, 0xF0, 0x60, 0xE1, 0xF0, 0xA0, 0x31, 0x70, 0xD0, 0xB0, 0xA0,
+0x40, 0x00, 0x80, 0x30, 0x02, 0x01, 0xB0, 0x40, 0x00, 0x91, 0xB0, 0x00, 0x80, 0xB0, 0x01, 0x10,
+0xF0, 0xE1, 0xC0, 0x2F, 0x03, 0xE0, 0x21, 0xE0, 0xA0, 0x60, 0x2F, 0x04, 0xC1, 0x2F, 0x21, 0x60,
+0xE0, 0x2F, 0x1F, 0xE0, 0x60, 0xC0, 0x2F, 0x01, 0xC0, 0x70, 0x01, 0xB0, 0x70, 0xA0, 0x00, 0x30,
+0x10, 0xB0, 0x09, 0x50, 0x70, 0xE0, 0x20, 0xE1, 0xC1, 0xE0, 0x60, 0xC1, 0x60, 0xE0, 0xC0, 0x60,
+0xC0, 0xE0, 0xA0, 0x01, 0x70, 0xE0, 0x27, 0xE0, 0xC0, 0xA0, 0x30, 0x90, 0x70, 0xE1, 0xC0, 0x20,
+0xE0, 0xC0, 0x70, 0x30, 0x90, 0xB0, 0x01, 0xA0, 0x10, 0x70, 0xF0, 0x70, 0xE1, 0x70, 0x11, 0x40,
+0x00, 0x40, 0x0C, 0x90, 0xA0, 0xE1, 0x30, 0x70, 0x40, 0x09, 0xA0, 0x03, 0x30, 0x70, 0x07, 0x40,
+0x30, 0xA0, 0x00, 0x51, 0x0F, 0x13, 0xA0, 0x10, 0x60, 0xE1, 0x27, 0xE0, 0x60, 0xE0, 0x2F, 0x02,
+0xE1, 0x70, 0x50, 0x0F, 0x06, 0x50, 0xF0, 0xE1, 0xF0, 0x90, 0x01, 0x30, 0x70, 0x00, 0xA0, 0x02,
+0x70, 0x02, 0x01, 0x90, 0x10, 0x30, 0x03, 0x80, 0xB0, 0x01, 0xD0, 0xC0, 0xE0, 0xC0, 0x70, 0xE5,
+0x21, 0xE4, 0x22, 0xE1, 0x22, 0xE5, 0x26, 0xE0, 0x27, 0xE1, 0xC1, 0xE2, 0x25, 0xE2, 0x2F, 0x03,
+0xE5, 0x2A, 0xE0, 0x60, 0xE3, 0x20, 0xE6, 0x2F, 0x01, 0xE2, 0x20, 0xE2, 0x20, 0xE0, 0x20, 0xE0,
+0x20, 0xE0, 0x20, 0xE5, 0x60, 0xE5, 0x20, 0xE3, 0x21, 0xE0, 0x22, 0xE0, 0x60, 0x30, 0x50, 0x01,
+0x70, 0x02, 0xB0, 0x90, 0x08, 0xB0, 0x70, 0xE2, 0x20, 0xE0, 0xA1, 0x60, 0x70, 0x63, 0xC0, 0xE2,
+0xD0, 0xB0, 0x00, 0xA0, 0xE1, 0x21, 0xE7, 0xA0, 0x50, 0x90, 0xA0, 0xE5, 0x60, 0x10, 0x40, 0x01,
+0x40, 0x30, 0xD0, 0x10, 0xA0, 0xE1, 0x61, 0xF0, 0x10, 0x50, 0x90, 0x05, 0x50, 0x90, 0x50, 0x03,
+0x70, 0xC0, 0xE1, 0x60, 0x70, 0x09, 0x40, 0x80, 0x05, 0xB0, 0x08, 0xB0, 0x30, 0xB0, 0x50, 0x0F,
+0x10, 0xB0, 0x80, 0x30, 0x70, 0xC0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x60, 0xE1, 0x25,
+0xE4, 0x20, 0xE0, 0x24, 0xE1, 0x70, 0xB0, 0x07, 0xB0, 0x30, 0x0B, 0xA0, 0xE1, 0xF0, 0x90, 0x01,
+0x80, 0x30, 0xA0, 0x30, 0x70, 0x80, 0x70, 0x90, 0x02, 0x01, 0x90, 0x30, 0x40, 0xD0, 0xA0, 0x90,
+0x00, 0x30, 0x10, 0xD2, 0x40, 0x60, 0xA0, 0xF0, 0xCF, 0x06, 0x60, 0xF0, 0xCF, 0x05, 0x61, 0xCF,
+0x21, 0x60, 0xCF, 0x21, 0x60, 0xCF, 0x02, 0xF0, 0xD0, 0x40, 0x50, 0xB0, 0x81, 0xB0, 0x50, 0x40,
+0x10, 0x90, 0x57, 0x80, 0x60, 0xC3, 0xA0, 0x30, 0xA0, 0x61, 0x81, 0x60, 0xC4, 0xA0, 0x50, 0xB0,
+0xA0, 0xCB, 0x60, 0x80, 0x50, 0xA0, 0xC6, 0x70, 0x30, 0x80, 0x30, 0x70, 0x80, 0x40, 0xA0, 0xD0,
+0xA0, 0x60, 0xC0, 0xF0, 0xA0, 0x70, 0x30, 0x40, 0xB2, 0x50, 0xB0, 0x40, 0x70, 0x30, 0xA0, 0x30,
+0x90, 0x40, 0xA0, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xF0, 0x50, 0xB0, 0x57, 0x30, 0x55, 0xB0, 0xD0,
+0x40, 0x57, 0xB0, 0x30, 0x91, 0x50, 0xB1, 0x5F, 0x03, 0x80, 0x90, 0xB0, 0x54, 0xB0, 0x40, 0xA1,
+0x60, 0xCD, 0x60, 0xCF, 0x06, 0x60, 0xA0, 0xB0, 0x56, 0x31, 0xB0, 0x5A, 0x30, 0xC1, 0xF0, 0x10,
+0xD2, 0x00, 0xB0, 0x82, 0x50, 0x03, 0x01, 0x90, 0x30, 0x01, 0x40, 0xA0, 0x10, 0xA0, 0x71, 0xA0,
+0x10, 0x80, 0xA0, 0xF0, 0xC0, 0x61, 0x20, 0xCF, 0x03, 0x60, 0x70, 0xE0, 0xF0, 0x60, 0xCF, 0x02,
+0x61, 0xCF, 0x21, 0x60, 0xCF, 0x21, 0x60, 0xCF, 0x03, 0xD0, 0x30, 0xB0, 0x50, 0xA0, 0xB2, 0x90,
+0x00, 0xB2, 0x50, 0xB4, 0x80, 0x60, 0xC1, 0xF0, 0x60, 0xC0, 0xF1, 0xC0, 0x60, 0x81, 0x60, 0xC3,
+0xE0, 0x70, 0x40, 0x70, 0xF0, 0xCB, 0x60, 0xA1, 0xC6, 0xF0, 0x10, 0x31, 0x50, 0x90, 0x30, 0xD0,
+0x71, 0xF0, 0xD0, 0xF0, 0xC0, 0xE0, 0x40, 0xD0, 0x30, 0x10, 0x70, 0xA0, 0x50, 0x00, 0x80, 0xF0,
+0xE0, 0xC1, 0xF0, 0x60, 0xE0, 0xC0, 0x70, 0xF0, 0xC1, 0xF0, 0x91, 0xB5, 0x00, 0x70, 0xB7, 0x80,
+0x30, 0xB1, 0x50, 0xB5, 0x40, 0x30, 0x50, 0x00, 0x10, 0x71, 0xA0, 0x80, 0x00, 0xB1, 0x51, 0xB8,
+0x90, 0x10, 0x80, 0x30, 0x40, 0xB3, 0x80, 0x70, 0xF0, 0xC0, 0xE0, 0xCE, 0x60, 0xCF, 0x08, 0x70,
+0xB3, 0x50, 0xB3, 0x50, 0xB1, 0x50, 0xB7, 0x30, 0xC1, 0xF0, 0xD0, 0xA1, 0xD0, 0xB0, 0x80, 0xA0,
+0x70, 0xA0, 0x40, 0x03, 0x01, 0x50, 0x80, 0x04, 0x80, 0xB0, 0x01, 0xD0, 0x30, 0x10, 0xD0, 0xE0,
+0xA1, 0xE0, 0x20, 0xE0, 0x24, 0xE1, 0x23, 0xE1, 0x21, 0xE4, 0x60, 0x21, 0xE0, 0x23, 0xE3, 0x23,
+0xE3, 0xC1, 0xE3, 0x23, 0xE7, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x2F, 0x03, 0x60, 0xE0, 0x2D, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x2F, 0x04, 0xE0, 0x60, 0xE0, 0x2C, 0xE0, 0x21, 0xE1, 0xA0, 0xB0,
+0x01, 0xD0, 0xB0, 0x0C, 0xB0, 0x10, 0xE0, 0x60, 0x10, 0xE2, 0xC0, 0x60, 0xC0, 0x64, 0x20, 0xE1,
+0xF0, 0x70, 0xC0, 0xE0, 0x23, 0xE7, 0xA0, 0x60, 0xA0, 0xE1, 0x20, 0xE0, 0x21, 0xE1, 0x70, 0x10,
+0xF0, 0x01, 0x30, 0x10, 0xF0, 0xC0, 0xD0, 0x80, 0x10, 0xF0, 0xC0, 0x60, 0x10, 0x30, 0x10, 0x81,
+0xA0, 0xF0, 0xA0, 0x21, 0xE3, 0xA1, 0x10, 0xE2, 0xC0, 0x10, 0xD0, 0xB0, 0x04, 0x30, 0x50, 0x0F,
+0x04, 0xB0, 0x30, 0x90, 0xD0, 0x60, 0xC0, 0xE0, 0xF0, 0x70, 0xB0, 0x0B, 0x70, 0x10, 0xC0, 0x90,
+0x70, 0xB0, 0x50, 0x80, 0x70, 0xF0, 0xC0, 0xE1, 0x25, 0xE3, 0x25, 0x60, 0xE1, 0x2B, 0xE0, 0x24,
+0xE3, 0x60, 0xA0, 0x0F, 0x04, 0x90, 0xF0, 0x50, 0xF0, 0x50, 0x01, 0x80, 0xD0, 0x80, 0xB1, 0x50,
+0xA0, 0x80, 0x02, 0x02, 0xB0, 0x50, 0x02, 0xB0, 0x30, 0xB0, 0x01, 0x70, 0x00, 0xB0, 0xD0, 0x40,
+0xC0, 0xF1, 0x2F, 0x03, 0xE0, 0xF0, 0xA0, 0xF0, 0xE0, 0x2F, 0x02, 0xC1, 0x2F, 0x21, 0x60, 0xE0,
+0x2F, 0x1F, 0xE0, 0x60, 0xC0, 0x2F, 0x01, 0xE0, 0x70, 0x01, 0x90, 0xA0, 0x0C, 0xB0, 0xA0, 0xF0,
+0xE1, 0x60, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x60, 0xC1, 0x60, 0xE0, 0xC0, 0x60, 0xC0, 0xE3, 0x26,
+0x60, 0xF0, 0x61, 0xA0, 0x70, 0x10, 0xA0, 0xC0, 0x25, 0xE1, 0xC1, 0xF0, 0x40, 0x00, 0x80, 0xA0,
+0xE1, 0xA1, 0xD0, 0xF1, 0x60, 0xC0, 0xF0, 0x10, 0x60, 0xE0, 0xC1, 0xE1, 0x22, 0xE0, 0xA0, 0x80,
+0x50, 0x70, 0x21, 0xE0, 0xC0, 0xF0, 0x50, 0x80, 0x03, 0x31, 0x0F, 0x05, 0x50, 0x70, 0x10, 0xF0,
+0xE3, 0x60, 0xD0, 0x50, 0x09, 0x80, 0x10, 0xC0, 0xA1, 0xE0, 0x70, 0xF1, 0x20, 0xE1, 0x2F, 0x02,
+0x60, 0xE0, 0x2F, 0x07, 0xE0, 0x60, 0x70, 0xA0, 0x0F, 0x03, 0xD0, 0x40, 0xF0, 0x90, 0x01, 0x30,
+0x70, 0x04, 0x70, 0x02, 0x01, 0xB0, 0xD0, 0x70, 0xD0, 0x50, 0x00, 0xA2, 0x31, 0xD0, 0x02, 0x70,
+0xC0, 0xE0, 0x10, 0x2F, 0x04, 0xE1, 0x2F, 0x04, 0xC1, 0x2F, 0x21, 0x60, 0xE0, 0x2F, 0x20, 0xC1,
+0xE0, 0x2F, 0x01, 0x70, 0x01, 0xA0, 0x07, 0x40, 0x50, 0x03, 0xF0, 0x60, 0xE0, 0x21, 0xE0, 0x61,
+0x20, 0xE0, 0xC0, 0x60, 0xC1, 0xE0, 0x60, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0x22, 0xE0,
+0xF1, 0xE0, 0xF0, 0x40, 0xB0, 0x40, 0x80, 0x60, 0x28, 0xE1, 0xC0, 0xD0, 0x70, 0x80, 0xD0, 0xE1,
+0xA0, 0xF2, 0xE2, 0xC0, 0xD0, 0xC0, 0xE0, 0x25, 0xE0, 0xC0, 0x70, 0x80, 0x70, 0xC0, 0xE0, 0x20,
+0xE0, 0x60, 0x80, 0x70, 0x90, 0x02, 0x50, 0xA1, 0x0F, 0x04, 0x90, 0x30, 0x80, 0x10, 0xE0, 0x23,
+0xE0, 0xC0, 0x70, 0x50, 0x00, 0x51, 0x04, 0xB0, 0x70, 0x60, 0xE0, 0x71, 0xE2, 0x2F, 0x06, 0x60,
+0xE0, 0x2F, 0x08, 0xE1, 0xA0, 0x70, 0xB0, 0x0F, 0x02, 0x70, 0x80, 0xA0, 0x31, 0xA0, 0x70, 0x30,
+0x91, 0x40, 0x70, 0x40, 0x02, 0x01, 0x80, 0x40, 0x00, 0x50, 0xD0, 0x00, 0x31, 0xB0, 0x01, 0x70,
+0xB0, 0x01, 0x90, 0x30, 0xE1, 0x2F, 0x03, 0xE0, 0xF1, 0xE0, 0x2F, 0x03, 0xC1, 0x2F, 0x20, 0xE0,
+0x60, 0xE0, 0x2F, 0x20, 0xC1, 0x2F, 0x01, 0xC0, 0x70, 0xA0, 0xF0, 0xD0, 0xA0, 0x0A, 0xB0, 0x80,
+0xD0, 0xE2, 0x61, 0xC0, 0x22, 0x60, 0xE0, 0xC0, 0x60, 0xE0, 0x60, 0xC0, 0xE0, 0x21, 0x61, 0xE2,
+0x23, 0xF0, 0xA0, 0x60, 0x02, 0xA0, 0xC0, 0xE0, 0x2B, 0x61, 0xD0, 0x10, 0x60, 0xE4, 0x20, 0xE0,
+0xC0, 0xA0, 0xE1, 0x27, 0xE0, 0xC0, 0xF0, 0xE0, 0x22, 0xE0, 0x60, 0x40, 0x70, 0x03, 0xA0, 0x00,
+0xB0, 0xA0, 0x0F, 0x03, 0x80, 0x50, 0x80, 0x10, 0xE1, 0x23, 0xE1, 0xA0, 0x70, 0xF0, 0xA0, 0x70,
+0xA1, 0x30, 0x10, 0x70, 0xC0, 0xE1, 0xA0, 0xF0, 0x60, 0xE0, 0x2F, 0x07, 0x60, 0xE0, 0x2F, 0x0A,
+0xE0, 0x60, 0xD0, 0x30, 0x09, 0xB0, 0x90, 0x04, 0x40, 0x70, 0x50, 0x01, 0x80, 0xB0, 0x40, 0xA1,
+0x30, 0x50, 0x03, 0x01, 0x90, 0xA0, 0x01, 0x50, 0xD0, 0xA0, 0x30, 0xB0, 0x01, 0xD0, 0xB0, 0x02,
+0xA0, 0xE0, 0x2F, 0x04, 0xE0, 0xD1, 0xF0, 0xE0, 0x2F, 0x02, 0xC1, 0x2F, 0x20, 0xE0, 0x60, 0xE0,
+0x2F, 0x20, 0xC0, 0x60, 0xE0, 0x2F, 0x01, 0xE1, 0xC0, 0xE0, 0x90, 0x10, 0x50, 0x07, 0xB0, 0x70,
+0x60, 0xC0, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x21, 0xE0, 0xC1, 0xE0, 0xC1, 0xE1, 0x60, 0xE4, 0xF2,
+0xE1, 0x20, 0xE2, 0x60, 0x70, 0xA0, 0x50, 0x90, 0xA0, 0xE0, 0x2C, 0xE1, 0xF0, 0xC0, 0xE5, 0xC0,
+0x60, 0xF0, 0xE0, 0x2F, 0x00, 0xE0, 0x60, 0xF0, 0x90, 0x02, 0xA0, 0xB0, 0x01, 0x80, 0x70, 0xA1,
+0x31, 0x81, 0x41, 0x90, 0x08, 0x80, 0x90, 0x50, 0x00, 0x70, 0x60, 0xE0, 0x23, 0xE5, 0xC0, 0xF0,
+0xC0, 0x60, 0xE0, 0x20, 0xE0, 0x60, 0xF0, 0x00, 0x70, 0xE1, 0x21, 0xE3, 0x2F, 0x00, 0x60, 0xE0,
+0x2F, 0x0B, 0xE1, 0xF0, 0x70, 0x08, 0x50, 0x80, 0x04, 0x90, 0x10, 0xB0, 0x01, 0x30, 0xB0, 0x03,
+0x40, 0xB0, 0x02, 0x02, 0x30, 0x80, 0x01, 0x50, 0x10, 0x30, 0x40, 0x50, 0x90, 0xD0, 0xB0, 0x02,
+0x70, 0xE0, 0x2F, 0x04, 0xE0, 0xF0, 0xA0, 0xC0, 0x2F, 0x04, 0x60, 0xE0, 0x2F, 0x1F, 0xE0, 0x60,
+0x2F, 0x21, 0xE0, 0x60, 0x2F, 0x04, 0xE2, 0x70, 0xB0, 0x00, 0xB0, 0x40, 0x30, 0xF0, 0x80, 0x40,
+0xF0, 0xA0, 0xC0, 0xE1, 0x61, 0xE2, 0x20, 0xE1, 0x60, 0xC0, 0x61, 0xC0, 0xE0, 0x60, 0xA0, 0x60,
+0xA0, 0xF0, 0x60, 0x31, 0x50, 0x30, 0xF0, 0xD0, 0xC0, 0x60, 0xC0, 0xE1, 0x20, 0xC0, 0xA0, 0x70,
+0xC0, 0x2F, 0x00, 0xE1, 0x70, 0xD0, 0xA1, 0x70, 0x10, 0xD0, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0xE0,
+0xF0, 0x40, 0x30, 0x90, 0x00, 0x40, 0x80, 0x01, 0x50, 0x30, 0x03, 0xB0, 0x51, 0x90, 0x40, 0x31,
+0xA0, 0x03, 0xB0, 0x91, 0xD0, 0x31, 0x80, 0x30, 0x70, 0x60, 0xE1, 0x27, 0xE2, 0x22, 0xE0, 0x30,
+0x50, 0x00, 0x90, 0x70, 0xC0, 0xE1, 0xC0, 0xF0, 0xA0, 0xF0, 0xC0, 0xE1, 0x2C, 0x60, 0xE0, 0x2F,
+0x0C, 0xE1, 0x60, 0xA0, 0x0E, 0x70, 0x30, 0x80, 0x90, 0x50, 0x30, 0x03, 0x80, 0x50, 0x30, 0x02,
+0x08, 0x40, 0x30, 0x40, 0x90, 0xD0, 0xB0, 0x01, 0x90, 0xA0, 0xE0, 0x22, 0x60, 0x2E, 0xE0, 0x60,
+0x70, 0x20, 0xE0, 0x2F, 0x04, 0x60, 0xE0, 0x2F, 0x20, 0x60, 0xE0, 0x2F, 0x1F, 0xE1, 0x60, 0x2F,
+0x06, 0xE0, 0x60, 0xF0, 0x90, 0x70, 0xF0, 0xC1, 0x60, 0xF0, 0x61, 0xE0, 0x61, 0xC0, 0xE1, 0xC0,
+0x61, 0xF0, 0xA1, 0xF1, 0x80, 0x30, 0x70, 0x30, 0x50, 0x80, 0x90, 0x80, 0x70, 0x30, 0x01, 0xB0,
+0x80, 0xA0, 0xC2, 0x22, 0xE2, 0x2F, 0x02, 0xE0, 0xD0, 0xA0, 0xD0, 0x30, 0xA1, 0x60, 0xC1, 0x2F,
+0x01, 0xE0, 0xF0, 0x90, 0x40, 0x80, 0x30, 0x80, 0x01, 0x80, 0x30, 0x0A, 0xB0, 0x80, 0x90, 0x01,
+0x50, 0x30, 0x90, 0x70, 0x80, 0x50, 0x00, 0x90, 0x50, 0x00, 0xA0, 0xF0, 0xE2, 0x2B, 0xE0, 0x70,
+0x02, 0xB0, 0x30, 0x71, 0xA0, 0x40, 0x00, 0x90, 0x70, 0xF1, 0xC0, 0x21, 0xE0, 0x28, 0x60, 0xE0,
+0x2F, 0x0E, 0xE0, 0xF1, 0x0D, 0xA0, 0x30, 0x80, 0x41, 0xA0, 0x03, 0x40, 0x31, 0x02, 0x08, 0x40,
+0x50, 0x01, 0x70, 0x50, 0x01, 0x50, 0xA0, 0xE1, 0x21, 0xC0, 0xF0, 0x2D, 0xE0, 0x60, 0xA0, 0xE0,
+0x2F, 0x05, 0x60, 0xE0, 0x2F, 0x13, 0xE7, 0xC2, 0x62, 0xC0, 0xE0, 0x2F, 0x1A, 0xE2, 0x20, 0xC0,
+0x61, 0xE0, 0x2F, 0x06, 0xE0, 0x70, 0x10, 0xC0, 0xE1, 0x20, 0xE2, 0xC0, 0x60, 0x20, 0xE1, 0xF0,
+0x70, 0xF0, 0x80, 0x41, 0x90, 0x03, 0x90, 0x02, 0xB0, 0x50, 0x00, 0xA0, 0xB0, 0x02, 0xA0, 0x62,
+0xE1, 0x21, 0xC0, 0x70, 0xE0, 0x2F, 0x03, 0xE2, 0xC0, 0xE2, 0xC0, 0x60, 0xC1, 0xE4, 0x24, 0xE0,
+0x23, 0xE0, 0xF0, 0x90, 0x04, 0xA0, 0x40, 0x0D, 0x70, 0xA0, 0x30, 0x10, 0x31, 0x80, 0x00, 0x90,
+0x40, 0x51, 0xB1, 0x30, 0x11, 0xC0, 0xE1, 0x20, 0xE2, 0x25, 0xE0, 0x30, 0x0B, 0x90, 0x60, 0xF0,
+0xE0, 0x2A, 0x60, 0xE0, 0x2F, 0x0F, 0xE0, 0xA0, 0x70, 0x0C, 0x30, 0xA0, 0x02, 0x30, 0x04, 0xB0,
+0x03, 0x08, 0x40, 0x50, 0x01, 0xA0, 0x50, 0x02, 0x90, 0x70, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x60,
+0xE1, 0x2F, 0x05, 0x60, 0xE0, 0x2F, 0x10, 0xC2, 0x68, 0xC1, 0x21, 0xC1, 0x2F, 0x15, 0xE1, 0x21,
+0xC1, 0x63, 0xC1, 0x60, 0x2F, 0x06, 0xE0, 0x60, 0x80, 0x40, 0xF0, 0xE3, 0xC0, 0x60, 0xC0, 0xE0,
+0x60, 0xF0, 0x70, 0xF0, 0x03, 0x40, 0x03, 0xB0, 0x50, 0x03, 0x90, 0x00, 0x30, 0xB0, 0x02, 0x80,
+0xF0, 0xE0, 0xC0, 0x61, 0xE0, 0x21, 0xF0, 0xC0, 0x2F, 0x09, 0xE0, 0x60, 0xC1, 0x64, 0xC0, 0x21,
+0xE1, 0x21, 0xE0, 0x22, 0xE0, 0x80, 0x40, 0x51, 0x01, 0x80, 0x30, 0x0F, 0x04, 0xB0, 0x01, 0x90,
+0x01, 0xB0, 0x52, 0x90, 0x40, 0x80, 0xA0, 0x60, 0xC0, 0xF1, 0xC1, 0x23, 0xE0, 0x60, 0x30, 0x0C,
+0x50, 0xF0, 0xE0, 0x2A, 0x60, 0xE0, 0x2F, 0x10, 0xE0, 0x60, 0x70, 0x50, 0x0A, 0x30, 0xD0, 0x02,
+0xA0, 0x09, 0x08, 0x90, 0x70, 0x31, 0x10, 0x50, 0x03, 0xB0, 0xA0, 0xF0, 0xE0, 0x24, 0xE0, 0x29,
+0xE0, 0x10, 0xF0, 0xE0, 0x2F, 0x05, 0x60, 0xE0, 0x2D, 0xE3, 0x21, 0xC4, 0x66, 0xC3, 0x2B, 0xC1,
+0x2F, 0x0F, 0xE2, 0x20, 0xC2, 0x62, 0xC1, 0x24, 0xE0, 0xC1, 0x2F, 0x04, 0xE1, 0x70, 0x01, 0xA0,
+0xF1, 0x80, 0xF1, 0xE0, 0x50, 0xF0, 0xA0, 0x90, 0x50, 0x03, 0xB0, 0x90, 0x03, 0xB0, 0x50, 0x04,
+0x90, 0x80, 0xB0, 0x03, 0x30, 0x60, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x0B, 0x60,
+0xE1, 0x24, 0xC1, 0x62, 0xC1, 0x21, 0xE2, 0xF0, 0x50, 0x80, 0x70, 0x02, 0x90, 0xA0, 0x50, 0x0F,
+0x05, 0x40, 0x08, 0x80, 0x10, 0xD0, 0xF0, 0x80, 0x60, 0xC1, 0x62, 0x40, 0x30, 0x80, 0x52, 0xB2,
+0x06, 0x50, 0x30, 0xE0, 0x28, 0xE0, 0x20, 0x60, 0x2F, 0x12, 0xE0, 0xC0, 0xF0, 0xA0, 0x40, 0x08,
+0x40, 0x10, 0xA0, 0x31, 0xA0, 0x09, 0x08, 0x90, 0x40, 0x01, 0x30, 0x90, 0x05, 0xF1, 0xE0, 0x23,
+0xF0, 0x29, 0xE0, 0xD0, 0x60, 0xE0, 0x2F, 0x04, 0xE0, 0x60, 0xE0, 0x29, 0xC3, 0x67, 0xC3, 0x20,
+0xE7, 0x2C, 0xC1, 0x2F, 0x0E, 0xC1, 0x62, 0xC2, 0xE2, 0x26, 0xE0, 0x20, 0xC0, 0x2F, 0x04, 0xE0,
+0x60, 0xF0, 0x02, 0x90, 0x81, 0x90, 0xD0, 0x71, 0x80, 0x06, 0x40, 0x04, 0xB0, 0x50, 0x04, 0x50,
+0x30, 0x50, 0x03, 0x50, 0xF0, 0xE0, 0x20, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0x2F, 0x09, 0xE0, 0x20,
+0x60, 0xE0, 0x24, 0xE0, 0x21, 0xE1, 0xC2, 0x62, 0xC1, 0xA0, 0x00, 0x90, 0x70, 0x03, 0xB0, 0xD0,
+0x0F, 0x05, 0x40, 0x08, 0x50, 0xD0, 0x80, 0x70, 0x00, 0x70, 0xE3, 0x30, 0x70, 0xD0, 0x00, 0xB1,
+0x52, 0x92, 0x42, 0x90, 0x50, 0x40, 0xF0, 0xE0, 0x28, 0xE0, 0xC1, 0xE0, 0x2F, 0x12, 0xE2, 0xA0,
+0x80, 0x07, 0xA1, 0x01, 0xB0, 0x30, 0x09, 0x08, 0x50, 0x40, 0x01, 0x80, 0x90, 0x06, 0xA0, 0x60,
+0x20, 0x60, 0x21, 0x60, 0xE0, 0x27, 0xE0, 0xF1, 0xE0, 0x2D, 0xE7, 0x60, 0xC0, 0x69, 0xC3, 0x2F,
+0x12, 0xC1, 0x2F, 0x05, 0xE2, 0xC1, 0x63, 0xC1, 0x2D, 0xC0, 0x70, 0x60, 0xE0, 0x60, 0xE0, 0x2F,
+0x02, 0xE1, 0x70, 0x02, 0x50, 0x40, 0xB0, 0x02, 0xB0, 0xA0, 0x06, 0x51, 0x04, 0xB0, 0x50, 0x05,
+0x30, 0xB0, 0x03, 0x30, 0x70, 0xE0, 0x22, 0xE0, 0x20, 0x61, 0x20, 0xE0, 0x25, 0xE0, 0x2F, 0x00,
+0xC1, 0x28, 0xE3, 0xC0, 0xE2, 0x30, 0x70, 0x40, 0x93, 0x50, 0xB0, 0x00, 0x50, 0x80, 0x0F, 0x05,
+0x90, 0x09, 0x50, 0xA0, 0x10, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x30, 0x10, 0x30, 0x0E, 0x30, 0x69,
+0xC1, 0x60, 0xC0, 0xE7, 0x2F, 0x0E, 0xE0, 0x30, 0xF0, 0x05, 0x90, 0x80, 0xA0, 0x02, 0x30, 0x09,
+0x08, 0x50, 0x30, 0x50, 0x90, 0x30, 0x90, 0x06, 0x40, 0xF0, 0xC0, 0xF0, 0x20, 0xE1, 0x28, 0xC0,
+0x70, 0xC0, 0x21, 0xE0, 0x27, 0xC3, 0x68, 0xC1, 0x21, 0xE8, 0x2F, 0x14, 0xC0, 0x60, 0xE0, 0x2F,
+0x01, 0xC1, 0x64, 0xC0, 0xE4, 0x2E, 0xE0, 0x61, 0xE0, 0x60, 0x2F, 0x00, 0xE2, 0x60, 0x70, 0xB0,
+0x00, 0xB0, 0x40, 0x50, 0x05, 0xA0, 0x06, 0x40, 0x05, 0xB0, 0x50, 0x04, 0xB0, 0xA0, 0x50, 0x02,
+0x31, 0x60, 0xE0, 0x24, 0xE0, 0x20, 0x60, 0xC0, 0x2B, 0xE5, 0x23, 0xE0, 0x60, 0x29, 0xE0, 0xC0,
+0x71, 0x11, 0x70, 0x10, 0xA0, 0x50, 0x04, 0x51, 0x31, 0x40, 0x51, 0xB0, 0x0F, 0x01, 0xB0, 0x50,
+0x0B, 0xA0, 0x71, 0xF0, 0xC0, 0x30, 0xF0, 0x0F, 0x01, 0x70, 0xE8, 0x20, 0xC1, 0x69, 0xC2, 0x2F,
+0x0C, 0xE0, 0x60, 0x10, 0x50, 0x03, 0x50, 0xA0, 0x70, 0x90, 0x50, 0x90, 0x30, 0x09, 0x08, 0x50,
+0xA0, 0x41, 0x30, 0x80, 0x06, 0xB0, 0xD0, 0xE2, 0xF0, 0x60, 0xE0, 0x21, 0xE4, 0x60, 0xD0, 0xE1,
+0xC4, 0x65, 0xC3, 0x26, 0xE0, 0x60, 0xE0, 0x2F, 0x20, 0xE0, 0x60, 0xE0, 0x26, 0xE2, 0x20, 0xC2,
+0x62, 0xC1, 0x22, 0xE0, 0x2F, 0x07, 0xE0, 0x21, 0xC1, 0x28, 0xE0, 0x23, 0xE0, 0x60, 0xF0, 0xA0,
+0x80, 0x01, 0x91, 0x07, 0x30, 0xB0, 0x04, 0x90, 0xB0, 0x05, 0xB0, 0x50, 0x04, 0x70, 0xB0, 0x90,
+0x01, 0x40, 0xF0, 0xE1, 0x24, 0xE0, 0x22, 0xC0, 0x60, 0xC0, 0x28, 0xE1, 0xC0, 0xF0, 0xA0, 0xF0,
+0x60, 0xE2, 0x20, 0xE0, 0x60, 0xE1, 0x26, 0xE0, 0x60, 0xD0, 0x30, 0x01, 0x80, 0x10, 0x09, 0xA0,
+0x01, 0xB0, 0x50, 0x92, 0x51, 0xB1, 0x0A, 0x50, 0xB0, 0x0C, 0x50, 0x30, 0x71, 0xF0, 0x0F, 0x02,
+0xD0, 0x70, 0xE0, 0x27, 0xE1, 0x60, 0xE0, 0x20, 0xE0, 0x24, 0xC3, 0x67, 0xC5, 0xE6, 0x27, 0xE0,
+0x60, 0x10, 0xB0, 0x03, 0x71, 0x90, 0x40, 0x30, 0x80, 0x09, 0x08, 0xB0, 0x80, 0x01, 0x90, 0x30,
+0x07, 0x90, 0xF0, 0xE1, 0xF0, 0x10, 0xC3, 0x67, 0xC4, 0x20, 0xE6, 0x29, 0x60, 0x2F, 0x20, 0xE1,
+0x60, 0xE2, 0x23, 0xC1, 0x63, 0xC1, 0x20, 0xE3, 0x2F, 0x0E, 0xC0, 0x60, 0x2C, 0xE0, 0xF0, 0x30,
+0x50, 0x01, 0x50, 0x40, 0xB0, 0x08, 0xA0, 0x04, 0xB0, 0x90, 0x06, 0xB0, 0x50, 0x03, 0x50, 0x80,
+0x00, 0xB0, 0x90, 0x00, 0xB0, 0xA0, 0xD0, 0xA0, 0xE0, 0x22, 0xE0, 0x25, 0xC0, 0x60, 0x20, 0xE0,
+0x25, 0xE0, 0xF0, 0x70, 0x90, 0xB0, 0x50, 0xA0, 0xF0, 0x60, 0xC1, 0x60, 0xC0, 0xE1, 0x20, 0xE5,
+0xC0, 0x70, 0x04, 0x70, 0xB0, 0x07, 0x41, 0x06, 0xB0, 0x51, 0x90, 0x41, 0x90, 0xB0, 0x06, 0x90,
+0xB0, 0x0F, 0x13, 0x70, 0x10, 0x70, 0xE0, 0x28, 0xE0, 0x60, 0x2B, 0xE5, 0xC4, 0x67, 0xC3, 0x25,
+0xE1, 0xA0, 0xF0, 0x03, 0x70, 0x30, 0x01, 0x50, 0x80, 0x09, 0x08, 0xB0, 0x30, 0x01, 0x50, 0xA0,
+0x02, 0xB1, 0x50, 0x92, 0x30, 0x72, 0x30, 0xC3, 0x20, 0xC0, 0x70, 0xF0, 0xE3, 0x20, 0xE1, 0x21,
+0xE0, 0x2F, 0x01, 0x60, 0xC0, 0xE0, 0x2F, 0x1E, 0xE1, 0xC0, 0xE0, 0xC1, 0x64, 0xC0, 0x21, 0xE1,
+0x2F, 0x13, 0xE2, 0x60, 0x2B, 0xE0, 0xF1, 0x01, 0x50, 0x40, 0x50, 0x0A, 0x30, 0x04, 0x40, 0x07,
+0xB0, 0x50, 0x04, 0xA0, 0x01, 0x90, 0xB0, 0x00, 0xB0, 0x80, 0xD0, 0x60, 0xE6, 0x24, 0x61, 0xE1,
+0x22, 0xE0, 0xA0, 0x40, 0x04, 0x81, 0x30, 0x81, 0x30, 0xA3, 0x73, 0xA0, 0xD0, 0x05, 0x90, 0x10,
+0x04, 0xD0, 0x32, 0x0D, 0xB0, 0x50, 0x90, 0x41, 0x91, 0xB0, 0x00, 0x90, 0x0F, 0x14, 0xD0, 0xE0,
+0xC0, 0x29, 0xE0, 0x60, 0x2F, 0x0F, 0xC2, 0x68, 0xC0, 0xA0, 0x70, 0x90, 0x00, 0x30, 0x81, 0x01,
+0x90, 0x40, 0x09, 0x09, 0xA0, 0x80, 0x30, 0xA0, 0xD0, 0x90, 0x40, 0x90, 0x51, 0xB0, 0x05, 0x80,
+0x10, 0x30, 0xE2, 0x21, 0x60, 0xE0, 0x22, 0xE0, 0xA0, 0xF0, 0xE0, 0x2F, 0x04, 0xC1, 0x2F, 0x1E,
+0xC1, 0x63, 0xC0, 0x20, 0xE2, 0x2F, 0x19, 0xE0, 0xC0, 0x61, 0xC0, 0x2A, 0xE0, 0xA0, 0x00, 0xB0,
+0x40, 0x50, 0x0C, 0x80, 0x90, 0x02, 0x51, 0x07, 0xB0, 0x50, 0x04, 0x80, 0x30, 0x01, 0x40, 0x02,
+0xB0, 0xD0, 0xA1, 0xF0, 0xA2, 0x60, 0xE1, 0x22, 0xE0, 0xC0, 0x60, 0xC0, 0x21, 0xE0, 0xF0, 0x40,
+0x09, 0x81, 0x90, 0x06, 0xB0, 0x07, 0xD0, 0x40, 0x02, 0xB0, 0x10, 0xB0, 0x0F, 0x06, 0xB0, 0x50,
+0x90, 0x80, 0x91, 0x50, 0xB0, 0x0F, 0x10, 0x70, 0xE1, 0x29, 0xE0, 0x60, 0x2F, 0x13, 0xE5, 0x21,
+0xC2, 0x60, 0xF0, 0x60, 0xF0, 0x70, 0x30, 0x80, 0xA0, 0x50, 0x09, 0x09, 0xA0, 0xB0, 0x00, 0x50,
+0x70, 0x0D, 0x50, 0xD0, 0x60, 0xE0, 0x27, 0xC1, 0x2F, 0x05, 0xC1, 0xE0, 0x2F, 0x12, 0xE3, 0x20,
+0xC1, 0x63, 0xC0, 0x21, 0xC1, 0xE0, 0x2F, 0x1A, 0xE1, 0xC0, 0x61, 0xC0, 0x21, 0x60, 0xE0, 0x28,
+0xE0, 0xA0, 0x90, 0x50, 0x90, 0x0E, 0xB0, 0xA0, 0x02, 0x40, 0x08, 0xB0, 0x50, 0x05, 0x80, 0x90,
+0x00, 0x50, 0xB0, 0x02, 0xA0, 0x00, 0x51, 0x00, 0xB1, 0x30, 0x70, 0xA0, 0xE0, 0x24, 0xC0, 0x60,
+0xC0, 0xE0, 0xA0, 0x09, 0xB0, 0x30, 0x50, 0x00, 0x90, 0x40, 0x50, 0x0C, 0x30, 0x10, 0x90, 0x02,
+0x10, 0xB0, 0x0F, 0x09, 0x40, 0x01, 0xB0, 0x50, 0x90, 0x40, 0x90, 0x51, 0xB0, 0x0F, 0x0A, 0xA0,
+0xC0, 0xE0, 0x2A, 0x60, 0xE0, 0x2F, 0x1B, 0xE4, 0xF0, 0x40, 0x00, 0xB0, 0x30, 0xB0, 0x09, 0x09,
+0x30, 0x02, 0x70, 0x0D, 0x80, 0x11, 0x60, 0xE0, 0x21, 0xE0, 0x2F, 0x0B, 0xC0, 0x60, 0x2F, 0x13,
+0xC0, 0x63, 0xC1, 0x20, 0xE2, 0x23, 0x60, 0x2F, 0x18, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xE0,
+0x22, 0x60, 0x28, 0xE0, 0xF1, 0x90, 0xB0, 0x0C, 0x90, 0x80, 0x40, 0x50, 0xD0, 0x01, 0x51, 0x08,
+0xB0, 0x50, 0x05, 0xB0, 0xA0, 0x50, 0x00, 0x40, 0x01, 0x40, 0xA0, 0x07, 0x80, 0x60, 0xE0, 0x24,
+0xE0, 0x61, 0xF0, 0x40, 0x08, 0x40, 0x50, 0x80, 0x02, 0x50, 0x90, 0x40, 0xB0, 0x04, 0xB0, 0x10,
+0x03, 0xD0, 0xA0, 0x50, 0x01, 0x10, 0x50, 0x0F, 0x08, 0xB0, 0x90, 0x06, 0xB0, 0x50, 0x93, 0x50,
+0xB0, 0x0F, 0x05, 0x90, 0xF0, 0xE0, 0x29, 0xC0, 0x60, 0x2F, 0x20, 0xE0, 0xF0, 0x50, 0x01, 0x30,
+0xB0, 0x09, 0x09, 0x80, 0xB0, 0x00, 0xB0, 0x70, 0x0D, 0x11, 0x60, 0x10, 0x60, 0xE1, 0x60, 0x2F,
+0x0B, 0xE0, 0x60, 0x2F, 0x08, 0xE3, 0x20, 0xC0, 0x64, 0xC0, 0x21, 0xE0, 0x2A, 0x60, 0xE0, 0x2F,
+0x14, 0xE0, 0x20, 0xE0, 0x62, 0x22, 0xE0, 0x23, 0xE0, 0x60, 0xE0, 0x25, 0xE0, 0xC0, 0xF0, 0x50,
+0x0C, 0x80, 0xA0, 0x30, 0x50, 0x90, 0x80, 0x40, 0x01, 0x40, 0x09, 0xB0, 0x50, 0x07, 0xA0, 0xB0,
+0x51, 0x81, 0x08, 0xB0, 0x70, 0xE5, 0x20, 0xE0, 0xC0, 0x60, 0x30, 0x08, 0x91, 0x40, 0x05, 0x50,
+0x40, 0x90, 0xB0, 0x02, 0xB0, 0x03, 0xB0, 0xD0, 0x70, 0x50, 0x00, 0x10, 0x71, 0x0F, 0x07, 0x50,
+0xB0, 0x0C, 0xB0, 0x50, 0x90, 0x42, 0x50, 0xB0, 0x0F, 0x00, 0xD0, 0xC0, 0x29, 0xC1, 0x2F, 0x1F,
+0xE1, 0xA0, 0x40, 0xB0, 0x00, 0x30, 0xB0, 0x09, 0x09, 0x40, 0xD0, 0x30, 0x40, 0x70, 0xB0, 0x0D,
+0x70, 0x60, 0xB0, 0x71, 0xF0, 0x70, 0x60, 0x2F, 0x0A, 0xE0, 0x60, 0x2C, 0xE0, 0x26, 0xE0, 0x20,
+0xC0, 0x64, 0xC0, 0x2F, 0x03, 0xE0, 0x60, 0xE0, 0x2F, 0x11, 0xE0, 0x21, 0xC0, 0x61, 0xC0, 0xE1,
+0x23, 0xE0, 0x22, 0xE0, 0x60, 0x26, 0x61, 0x70, 0x0C, 0x90, 0x30, 0x06, 0x90, 0xB0, 0x09, 0xB0,
+0x50, 0x07, 0xB0, 0x30, 0x00, 0x30, 0x80, 0x0A, 0x50, 0xA4, 0xF0, 0xE2, 0x90, 0xA0, 0x90, 0x50,
+0x05, 0x90, 0xB0, 0x90, 0x40, 0x08, 0x90, 0x40, 0x90, 0xB0, 0x05, 0xB0, 0xA0, 0x10, 0x80, 0x70,
+0xE1, 0x70, 0xB0, 0x0F, 0x05, 0x90, 0x0F, 0x04, 0xB0, 0x50, 0x41, 0x91, 0x50, 0xB0, 0x08, 0x70,
+0xC0, 0xE0, 0x29, 0xC1, 0x2F, 0x20, 0xE0, 0xA0, 0x81, 0x30, 0x70, 0x0A, 0x09, 0x40, 0x90, 0x01,
+0xA0, 0x90, 0x0D, 0x70, 0x11, 0xF0, 0x61, 0xE1, 0x2F, 0x0A, 0xE0, 0x60, 0x2D, 0xE2, 0xC1, 0x63,
+0xC0, 0x23, 0xE0, 0x2F, 0x05, 0x60, 0xC0, 0xE0, 0x2F, 0x0D, 0xE1, 0x20, 0xC0, 0x61, 0xC0, 0xE3,
+0xC0, 0x28, 0xC1, 0x21, 0xE0, 0x20, 0xC0, 0x60, 0x20, 0xE0, 0xA0, 0xB0, 0x0B, 0x80, 0x70, 0x05,
+0xB0, 0x90, 0x0A, 0xB0, 0x50, 0x08, 0x30, 0x00, 0x30, 0x90, 0x0F, 0x00, 0xB0, 0x40, 0xA0, 0x80,
+0xC0, 0x70, 0xB0, 0x00, 0x50, 0x40, 0xB0, 0x02, 0xB0, 0x90, 0x01, 0xA0, 0x0A, 0xB0, 0x50, 0x40,
+0x50, 0xB0, 0x04, 0xA0, 0x30, 0xC0, 0xE1, 0xC0, 0x70, 0x50, 0x0F, 0x04, 0x40, 0x0F, 0x09, 0xB0,
+0x51, 0x90, 0x40, 0x90, 0x50, 0xB1, 0x01, 0x30, 0x40, 0xE0, 0x2A, 0x60, 0xC0, 0x2F, 0x20, 0xE0,
+0xA0, 0x02, 0x30, 0x0A, 0x09, 0x50, 0x80, 0x01, 0x30, 0x40, 0x0E, 0xA0, 0x10, 0xA0, 0x70, 0xE0,
+0x2F, 0x0C, 0xE0, 0x60, 0x26, 0xE1, 0x22, 0xC1, 0x62, 0xC2, 0xE2, 0x2F, 0x0B, 0xC0, 0x60, 0xE0,
+0x2F, 0x0E, 0x62, 0xC0, 0xE2, 0x20, 0xE0, 0xF0, 0x70, 0xE2, 0x24, 0xE1, 0x60, 0x20, 0xE0, 0xC0,
+0x60, 0xC0, 0xE2, 0x70, 0x0A, 0x80, 0xA0, 0x80, 0xB0, 0x05, 0x40, 0x0B, 0xB0, 0x50, 0x08, 0x30,
+0x00, 0x40, 0x80, 0xB0, 0x0F, 0x02, 0x40, 0x30, 0xB0, 0x03, 0x91, 0x01, 0x90, 0xB0, 0x01, 0x41,
+0x0C, 0x50, 0x90, 0x40, 0xB0, 0x02, 0xB0, 0xD0, 0xC0, 0xE0, 0x20, 0xE1, 0xA0, 0x90, 0x0F, 0x03,
+0x90, 0x0F, 0x0F, 0xB0, 0x51, 0x90, 0x40, 0x30, 0xC1, 0x23, 0xE1, 0x24, 0x60, 0xE0, 0x2F, 0x20,
+0xE0, 0xA0, 0x02, 0xA0, 0x0A, 0x09, 0xB0, 0x70, 0x31, 0xD0, 0x80, 0x0F, 0x00, 0x30, 0x90, 0xE0,
+0x22, 0xE0, 0x2F, 0x09, 0xE0, 0xC1, 0xE0, 0x20, 0xE2, 0xC0, 0x64, 0xC1, 0x2F, 0x14, 0xE0, 0x60,
+0x2F, 0x0A, 0xE0, 0x20, 0xC0, 0x61, 0x20, 0xE0, 0x25, 0xE0, 0xC0, 0x60, 0xE0, 0x60, 0xF0, 0x60,
+0x23, 0xE0, 0xD0, 0xF0, 0x61, 0xC0, 0xE1, 0x20, 0xE0, 0x70, 0x90, 0x09, 0xA0, 0x90, 0x07, 0xB0,
+0x90, 0x0B, 0xB0, 0x50, 0x08, 0x80, 0x50, 0xA0, 0x00, 0x40, 0x0F, 0x0A, 0xB0, 0x41, 0x50, 0x02,
+0xB0, 0x80, 0x0F, 0x00, 0x50, 0x41, 0xB0, 0x00, 0x50, 0xA0, 0xE0, 0x22, 0xE0, 0x70, 0x80, 0x0F,
+0x01, 0xB0, 0x50, 0x0F, 0x14, 0xF0, 0x65, 0xC0, 0x20, 0xE4, 0x60, 0xE0, 0x2F, 0x1F, 0xE1, 0xD0,
+0x31, 0x80, 0x30, 0x0A, 0x09, 0xB0, 0x30, 0x01, 0x50, 0x80, 0x0F, 0x01, 0x70, 0xE0, 0x2F, 0x0C,
+0xE1, 0xC0, 0x60, 0xC0, 0x63, 0xC1, 0xE3, 0x2F, 0x15, 0xE1, 0x60, 0x2F, 0x06, 0xE1, 0x20, 0xC0,
+0x61, 0xC0, 0xE1, 0x27, 0x60, 0xF0, 0xC0, 0xD1, 0x10, 0xC0, 0x22, 0xE0, 0x70, 0xA0, 0x61, 0xC0,
+0xE3, 0x70, 0x90, 0x04, 0xB0, 0x30, 0x80, 0x70, 0xA0, 0x70, 0x50, 0x08, 0x40, 0x0C, 0xB0, 0x50,
+0x08, 0x90, 0x10, 0x50, 0x00, 0x51, 0x0F, 0x0B, 0x41, 0x50, 0x02, 0x30, 0x0F, 0x03, 0x90, 0x40,
+0x50, 0xA0, 0x60, 0xE1, 0x20, 0xE1, 0xA0, 0xF0, 0x0F, 0x00, 0x90, 0xB0, 0x0F, 0x13, 0x90, 0x70,
+0xE4, 0x20, 0xC0, 0x63, 0xC1, 0x60, 0xE2, 0x2F, 0x1E, 0xE0, 0xA0, 0x01, 0x90, 0x80, 0x00, 0x40,
+0xB0, 0x07, 0x0A, 0x30, 0x01, 0xB0, 0x70, 0x0D, 0xB0, 0x00, 0x30, 0x70, 0x2F, 0x06, 0xE2, 0x20,
+0xC1, 0x64, 0xC0, 0x2F, 0x1A, 0xE2, 0xC1, 0x62, 0x2F, 0x05, 0xE0, 0xC0, 0x61, 0xC0, 0x2B, 0xE0,
+0x60, 0xF0, 0xE0, 0x20, 0x60, 0xC0, 0xF0, 0x10, 0xE1, 0xA0, 0xD0, 0xC0, 0xE1, 0x60, 0xE1, 0xF0,
+0x70, 0x90, 0x03, 0xB0, 0x31, 0x51, 0xB0, 0x0A, 0x90, 0xB0, 0x0C, 0xB0, 0x50, 0x08, 0x50, 0x30,
+0x02, 0x40, 0x0F, 0x0A, 0x51, 0x00, 0x50, 0x40, 0xB0, 0x00, 0xA0, 0x0F, 0x05, 0xB0, 0x90, 0xF0,
+0x60, 0xE4, 0x70, 0x30, 0x0E, 0x40, 0x90, 0x40, 0x90, 0xB1, 0x0F, 0x0E, 0x80, 0xA0, 0xC0, 0xE0,
+0x29, 0xC1, 0x62, 0xC2, 0x20, 0xE2, 0x2F, 0x17, 0xE0, 0xC0, 0x80, 0x01, 0x91, 0x80, 0x90, 0x30,
+0x07, 0x0A, 0xA0, 0x00, 0xB0, 0x50, 0x10, 0x08, 0x80, 0x10, 0x02, 0x71, 0xA0, 0xE1, 0x2F, 0x05,
+0x64, 0xC1, 0x21, 0xE0, 0x60, 0xE0, 0x2F, 0x1A, 0xC0, 0x62, 0xC0, 0xE1, 0xC0, 0x60, 0x2F, 0x01,
+0xE0, 0x20, 0xC0, 0x61, 0x20, 0xE0, 0x2E, 0xE0, 0x21, 0xE1, 0x60, 0x70, 0xE0, 0x60, 0xF0, 0xC0,
+0xE1, 0xC0, 0x60, 0xF0, 0xA0, 0x40, 0x04, 0x31, 0xB0, 0x0D, 0xB0, 0x90, 0x0D, 0xB0, 0x50, 0x09,
+0x30, 0xB0, 0x01, 0xB0, 0x50, 0x0F, 0x09, 0x40, 0x03, 0x40, 0x50, 0x80, 0x50, 0x0F, 0x07, 0x30,
+0xF0, 0x60, 0xC0, 0x21, 0xE0, 0x70, 0xB0, 0x0C, 0xB0, 0x90, 0x01, 0xB0, 0x50, 0x90, 0x40, 0x90,
+0xB0, 0x0F, 0x0B, 0x70, 0xE0, 0x60, 0x29, 0xE1, 0xC1, 0xE1, 0xC2, 0x63, 0xC0, 0x23, 0xE0, 0x2F,
+0x11, 0xE0, 0xF0, 0x80, 0xB0, 0x00, 0x80, 0xB0, 0x82, 0x07, 0x0A, 0xA0, 0x31, 0x80, 0x10, 0x08,
+0x80, 0xD0, 0x03, 0x10, 0x70, 0xE1, 0x29, 0xE3, 0xC1, 0x64, 0xC0, 0x21, 0xE0, 0x24, 0xE0, 0x60,
+0xE0, 0x2F, 0x13, 0xE2, 0xC0, 0x62, 0xC0, 0x20, 0xE0, 0x22, 0xE1, 0x60, 0xE0, 0x2B, 0xE1, 0x20,
+0xC0, 0x61, 0xC0, 0x2F, 0x06, 0xE0, 0x20, 0xE1, 0x61, 0xE1, 0x60, 0xD0, 0xA0, 0x80, 0x40, 0xB0,
+0x05, 0xA0, 0x0F, 0x00, 0x40, 0xB0, 0x0D, 0xB0, 0x50, 0x09, 0x90, 0x40, 0x02, 0x40, 0xB0, 0x0F,
+0x07, 0x40, 0x05, 0xB0, 0x80, 0x40, 0x0F, 0x08, 0x70, 0xC1, 0x61, 0xC1, 0x70, 0xA0, 0x40, 0x0A,
+0x50, 0xB0, 0x05, 0xB0, 0x50, 0x41, 0x50, 0xB0, 0x0F, 0x07, 0xA0, 0xE1, 0x2A, 0xE0, 0x60, 0x20,
+0xE0, 0x24, 0xE0, 0x21, 0xC0, 0x64, 0xC0, 0xE4, 0x2F, 0x0B, 0xE0, 0xF0, 0x81, 0x30, 0x10, 0x01,
+0xB0, 0x08, 0x03, 0xB0, 0x02, 0xA1, 0x00, 0x80, 0xB0, 0x01, 0xA0, 0x07, 0x40, 0x10, 0x05, 0xB0,
+0x70, 0x60, 0xE0, 0x27, 0xC0, 0x64, 0xC0, 0x20, 0xE3, 0x28, 0xE0, 0xC1, 0xE0, 0x2F, 0x0E, 0xE1,
+0x20, 0xC0, 0x62, 0xC0, 0xE2, 0x26, 0xE0, 0x60, 0xC0, 0x2B, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x09,
+0x61, 0x20, 0xE2, 0x70, 0x90, 0x80, 0xA0, 0x30, 0x81, 0x40, 0x50, 0x02, 0xA0, 0x0E, 0xB0, 0x50,
+0x0E, 0xB0, 0x50, 0x09, 0x50, 0x80, 0x03, 0x40, 0x0F, 0x06, 0x51, 0x07, 0xA0, 0x40, 0x50, 0x0F,
+0x07, 0x70, 0xC0, 0xE1, 0x63, 0xF0, 0xD0, 0x50, 0x08, 0x90, 0xB0, 0x09, 0xB0, 0x90, 0x40, 0x90,
+0x50, 0x0F, 0x04, 0xA0, 0xE0, 0x2B, 0xE0, 0x60, 0x2A, 0xE3, 0xC1, 0x63, 0xC1, 0x2F, 0x0A, 0xE0,
+0x70, 0x02, 0x30, 0x00, 0x50, 0x31, 0x80, 0x50, 0x05, 0x02, 0x50, 0x10, 0x30, 0x02, 0x81, 0x90,
+0x40, 0x01, 0x30, 0x90, 0x07, 0xB0, 0x07, 0x70, 0xE1, 0xC2, 0x63, 0xC0, 0x24, 0xE0, 0x2D, 0xE0,
+0xC1, 0x2F, 0x0C, 0xE1, 0xC1, 0x61, 0xC1, 0x20, 0xE1, 0x29, 0xE0, 0xC1, 0x27, 0xE0, 0xC0, 0x61,
+0xC0, 0x2F, 0x0C, 0x61, 0xC0, 0x22, 0xE0, 0xF0, 0x40, 0x03, 0x50, 0x40, 0x90, 0x80, 0x30, 0xA0,
+0x30, 0x80, 0x0E, 0x40, 0x0F, 0x00, 0xB0, 0x50, 0x09, 0x50, 0x40, 0x03, 0x90, 0xB0, 0x0F, 0x04,
+0xB0, 0x90, 0x08, 0x30, 0x00, 0x50, 0x40, 0xB0, 0x0F, 0x05, 0x50, 0xA0, 0xF0, 0xE0, 0x20, 0xE0,
+0xC1, 0x60, 0xC0, 0x70, 0xB0, 0x07, 0x40, 0x0E, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x0D, 0x80, 0x70,
+0x60, 0xE0, 0x2C, 0x60, 0x2F, 0x00, 0xE0, 0x23, 0xC1, 0x63, 0xC1, 0x20, 0xE2, 0x2F, 0x00, 0xE0,
+0x70, 0x02, 0x30, 0xB0, 0x70, 0x41, 0x30, 0x70, 0x30, 0x04, 0x03, 0x70, 0x80, 0x70, 0xB0, 0x00,
+0x50, 0x30, 0x00, 0xA0, 0x40, 0x30, 0xD0, 0x80, 0x0D, 0xB0, 0xA0, 0x80, 0xA0, 0xF0, 0x60, 0xC2,
+0x20, 0xE2, 0x2F, 0x05, 0xE0, 0xC0, 0x60, 0x2F, 0x0B, 0xC0, 0x61, 0xC1, 0x20, 0xE2, 0x2D, 0xE0,
+0x60, 0x24, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x0B, 0xC0, 0x60, 0xC0, 0x22, 0xE0,
+0x60, 0xA1, 0x05, 0x51, 0x02, 0x40, 0x80, 0x0D, 0x51, 0x0F, 0x00, 0xB0, 0x50, 0x09, 0xB0, 0x30,
+0x04, 0x40, 0x0F, 0x04, 0x40, 0x09, 0x30, 0x02, 0x91, 0x0F, 0x05, 0xB0, 0x10, 0xE0, 0x22, 0xE1,
+0xC0, 0x60, 0xA0, 0xB0, 0x05, 0x51, 0x0F, 0x02, 0xB0, 0x50, 0x90, 0x40, 0x50, 0xB0, 0x08, 0xF1,
+0xE1, 0x2D, 0xC0, 0x2F, 0x06, 0xE2, 0x20, 0xC2, 0x62, 0xC1, 0x21, 0xE0, 0x2B, 0xE0, 0x70, 0xA0,
+0x80, 0x40, 0x80, 0x41, 0x03, 0x30, 0x90, 0x03, 0x03, 0xD0, 0x00, 0x90, 0x10, 0xA0, 0xD0, 0x40,
+0x00, 0xD0, 0x50, 0x00, 0x50, 0x30, 0x09, 0x50, 0x92, 0x30, 0x51, 0xB0, 0x10, 0xE0, 0x2F, 0x0E,
+0x60, 0xE0, 0x2F, 0x04, 0xE1, 0xC0, 0x62, 0xC0, 0x2F, 0x06, 0xE0, 0x60, 0x21, 0xE0, 0x20, 0xC0,
+0x61, 0x20, 0xE0, 0x2F, 0x0B, 0xE0, 0x20, 0x61, 0x20, 0xE3, 0xF0, 0x30, 0xB0, 0x06, 0xB0, 0x80,
+0xB0, 0x01, 0x40, 0x70, 0x40, 0x0C, 0x40, 0x0F, 0x01, 0xB0, 0x50, 0x0A, 0xA0, 0x04, 0x51, 0x0F,
+0x02, 0x41, 0x09, 0xA0, 0x03, 0xB0, 0x40, 0x50, 0x0F, 0x04, 0xA0, 0xE0, 0x24, 0xE1, 0xC0, 0xA0,
+0x90, 0x40, 0xB0, 0x02, 0x40, 0x0F, 0x07, 0xB0, 0x91, 0x40, 0x50, 0x04, 0x80, 0xA0, 0xE0, 0x21,
+0xE0, 0x2B, 0xC1, 0x2F, 0x10, 0xC1, 0x63, 0xC1, 0xE2, 0x20, 0xE1, 0x22, 0xC0, 0xF0, 0x00, 0xB0,
+0x81, 0xB0, 0xD0, 0x40, 0x02, 0x30, 0x90, 0x03, 0x03, 0x70, 0xB0, 0x01, 0x90, 0xB0, 0x01, 0x30,
+0x02, 0x70, 0x02, 0xB0, 0x51, 0x90, 0x41, 0x90, 0x50, 0xB0, 0x80, 0x50, 0xA0, 0x02, 0x90, 0xF0,
+0xE0, 0x2F, 0x0C, 0xE0, 0x60, 0xE0, 0x2F, 0x03, 0xC0, 0x61, 0xC0, 0x20, 0xE1, 0x2F, 0x07, 0xE0,
+0x20, 0x60, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x0D, 0x61, 0xE1, 0x22, 0xE1, 0x70, 0x05, 0x90, 0xB0,
+0x50, 0x90, 0x00, 0x40, 0x01, 0x30, 0x00, 0x80, 0x30, 0x0A, 0x90, 0xB0, 0x0F, 0x01, 0xB0, 0x50,
+0x09, 0x50, 0x80, 0x05, 0x40, 0x0F, 0x01, 0x90, 0xB1, 0x40, 0x08, 0x80, 0x50, 0x04, 0x50, 0x40,
+0xB0, 0x0A, 0x30, 0xB0, 0x04, 0x40, 0xA0, 0xE1, 0x24, 0xE0, 0xA0, 0x01, 0x90, 0x40, 0x90, 0xB0,
+0x90, 0x0F, 0x0B, 0xB0, 0x90, 0x40, 0x90, 0xB0, 0x80, 0xF0, 0xE1, 0x20, 0xE0, 0x2C, 0x60, 0xE0,
+0x2F, 0x13, 0xE1, 0x20, 0xC0, 0x64, 0xC1, 0x20, 0xE1, 0x60, 0x40, 0x01, 0x90, 0x40, 0x00, 0xB0,
+0x30, 0x70, 0xD1, 0x30, 0x04, 0x05, 0x50, 0x80, 0x31, 0x90, 0x00, 0x30, 0x40, 0x80, 0xA0, 0x10,
+0x30, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x04, 0x81, 0x30, 0xD0, 0x03, 0x70, 0xE0, 0x2F, 0x0D, 0xC1,
+0x2A, 0xE2, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x0C, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x10, 0x61,
+0xC0, 0xE0, 0x24, 0xE0, 0xA0, 0x50, 0x04, 0x50, 0xA0, 0x32, 0x80, 0x40, 0x80, 0xB0, 0xA0, 0x01,
+0x90, 0xA0, 0x08, 0xB0, 0x90, 0x0F, 0x02, 0xB0, 0x50, 0x09, 0xB0, 0x30, 0x05, 0xB0, 0x90, 0x0E,
+0x90, 0x50, 0x01, 0xB0, 0x40, 0x07, 0x50, 0x80, 0x06, 0x91, 0xB0, 0x08, 0xA0, 0x30, 0x05, 0x80,
+0x70, 0xF0, 0xC0, 0xE0, 0x22, 0xE0, 0xA0, 0x50, 0x02, 0xB0, 0x41, 0x50, 0x0F, 0x0E, 0x40, 0xF0,
+0x60, 0xC1, 0x20, 0xE1, 0x2B, 0x60, 0xE0, 0x2F, 0x1C, 0xC0, 0x63, 0xF0, 0xD0, 0x30, 0x40, 0x30,
+0xB0, 0x30, 0xD0, 0x70, 0xD0, 0xA0, 0x50, 0x05, 0x04, 0x30, 0xD0, 0x71, 0x50, 0x70, 0x90, 0x80,
+0x13, 0x30, 0x40, 0x07, 0x40, 0xA0, 0x06, 0xA0, 0xE1, 0x2F, 0x0D, 0x60, 0xE0, 0x29, 0xC0, 0x62,
+0xC0, 0x20, 0xE1, 0x2F, 0x0C, 0x61, 0xC0, 0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x0C, 0xE0, 0xC0, 0x60,
+0xC0, 0xE0, 0x25, 0xE1, 0x70, 0x05, 0x90, 0x80, 0xB0, 0x01, 0x50, 0x90, 0x40, 0x80, 0xA0, 0x02,
+0xB0, 0x70, 0xB0, 0x06, 0x40, 0xB0, 0x0F, 0x02, 0xB0, 0x50, 0x0A, 0xA0, 0x06, 0x90, 0xB0, 0x0C,
+0x90, 0x50, 0x04, 0x40, 0xB0, 0x06, 0xA0, 0x07, 0xB0, 0x91, 0x07, 0x80, 0xD0, 0x07, 0x40, 0x70,
+0xF0, 0xE0, 0x22, 0xC0, 0xA0, 0x03, 0x40, 0x00, 0x50, 0x91, 0xB0, 0x0F, 0x0B, 0xA0, 0xE1, 0xC1,
+0x61, 0xC1, 0x2A, 0x60, 0xE0, 0x2F, 0x1D, 0xE3, 0xA0, 0x13, 0x50, 0xA0, 0x01, 0xB0, 0x40, 0x70,
+0xB0, 0x04, 0x03, 0x50, 0xA0, 0x01, 0x30, 0x50, 0xB0, 0x30, 0x40, 0x80, 0xB0, 0x00, 0x80, 0xA1,
+0x07, 0x80, 0xB0, 0x06, 0xF0, 0xC0, 0xE0, 0x2F, 0x0C, 0xE0, 0x60, 0x22, 0xE3, 0xC0, 0x62, 0xC0,
+0x21, 0xE0, 0x2F, 0x0B, 0xE1, 0xC0, 0x61, 0xC0, 0x22, 0xE0, 0x60, 0xE0, 0x2F, 0x0A, 0xE0, 0x20,
+0x61, 0xE0, 0x26, 0xE1, 0x70, 0x80, 0x05, 0x80, 0x50, 0x06, 0x40, 0x04, 0xA0, 0x50, 0x04, 0xB0,
+0x50, 0x0F, 0x03, 0xB0, 0x50, 0x09, 0xA0, 0x40, 0x06, 0xB0, 0x40, 0x0B, 0x90, 0x50, 0x06, 0x40,
+0x50, 0x05, 0xA0, 0x09, 0xB0, 0x40, 0x50, 0x05, 0x70, 0x30, 0x05, 0x40, 0xA0, 0x30, 0x90, 0x70,
+0xE0, 0x22, 0xE0, 0xF0, 0x30, 0x02, 0x90, 0x03, 0x50, 0x40, 0x90, 0xB0, 0x0F, 0x08, 0x70, 0xE1,
+0x23, 0xC1, 0x61, 0xC0, 0x20, 0xE1, 0x22, 0xE0, 0xC1, 0x2F, 0x21, 0xE0, 0x70, 0x01, 0x50, 0xA0,
+0x50, 0xA0, 0x03, 0x40, 0x80, 0x04, 0x03, 0xB0, 0x70, 0x01, 0x70, 0x90, 0x70, 0x90, 0x50, 0x40,
+0x01, 0x40, 0x70, 0xB0, 0xD0, 0x50, 0x05, 0xB0, 0x80, 0x06, 0x70, 0xE1, 0x2F, 0x0D, 0x60, 0xE1,
+0x20, 0xC1, 0x61, 0xC0, 0xE2, 0x2F, 0x0B, 0xE1, 0x20, 0xC0, 0x61, 0xC0, 0xE1, 0x23, 0xE0, 0x60,
+0x2F, 0x09, 0xE0, 0x20, 0x61, 0xE1, 0x26, 0xE0, 0xF0, 0x70, 0xB0, 0x04, 0xB0, 0x90, 0xA0, 0x08,
+0x40, 0xB0, 0x03, 0x30, 0x80, 0x03, 0x40, 0x0F, 0x04, 0xB0, 0x50, 0x09, 0xA0, 0xB0, 0x07, 0x51,
+0x09, 0x40, 0x50, 0x08, 0x91, 0x04, 0x30, 0x0B, 0x50, 0x40, 0xB0, 0x01, 0x40, 0x11, 0x02, 0x50,
+0x80, 0x30, 0xA0, 0x90, 0x02, 0x50, 0x70, 0xE0, 0x22, 0xE0, 0x60, 0x70, 0x80, 0x40, 0xB0, 0x06,
+0x90, 0x40, 0x90, 0xB0, 0x0F, 0x05, 0xA0, 0xC0, 0x25, 0xE2, 0xC0, 0x62, 0xC0, 0x20, 0xE1, 0x60,
+0x20, 0xE0, 0x2F, 0x20, 0xC0, 0x30, 0x01, 0xB0, 0x80, 0x00, 0x30, 0x10, 0x30, 0x41, 0xD0, 0x50,
+0x04, 0x04, 0x80, 0xD1, 0x80, 0xB0, 0x90, 0x01, 0xA0, 0x90, 0x80, 0x70, 0xA0, 0x01, 0xA0, 0xB0,
+0x40, 0x04, 0x70, 0x05, 0xD1, 0x60, 0xE0, 0x2F, 0x09, 0xE3, 0x60, 0xC0, 0x61, 0xC0, 0x2F, 0x11,
+0xE0, 0xC0, 0x61, 0xC0, 0x29, 0xC1, 0x2F, 0x07, 0xE0, 0xC0, 0x60, 0x20, 0xE0, 0x27, 0xE0, 0x60,
+0x10, 0x05, 0x50, 0x40, 0x00, 0xA0, 0x09, 0x80, 0x50, 0x00, 0x41, 0x50, 0x31, 0x01, 0x50, 0xB0,
+0x0F, 0x04, 0xB0, 0x50, 0x0A, 0xA0, 0x08, 0x40, 0x08, 0x40, 0x50, 0x0A, 0xB0, 0x40, 0x03, 0x80,
+0xB0, 0x0C, 0x91, 0x00, 0xD0, 0x80, 0xB0, 0x90, 0x30, 0xA0, 0x80, 0x50, 0x06, 0x70, 0xC0, 0x23,
+0xE0, 0xC0, 0x60, 0xF0, 0x70, 0x50, 0x07, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x02, 0x40, 0xF0, 0xE0,
+0x2C, 0xC0, 0x61, 0xC0, 0x60, 0xE0, 0x20, 0xE0, 0x2F, 0x1E, 0xE0, 0x60, 0x70, 0xF0, 0x40, 0x80,
+0x40, 0x01, 0xB0, 0x40, 0x30, 0x80, 0xB0, 0x05, 0x05, 0xB0, 0xA0, 0x70, 0xD0, 0x71, 0x00, 0xA0,
+0x90, 0xB0, 0x00, 0x70, 0x01, 0x30, 0x70, 0x80, 0xA0, 0xB1, 0x01, 0xD0, 0x30, 0x04, 0x40, 0x00,
+0x70, 0xE0, 0x2F, 0x08, 0xE0, 0x20, 0xC0, 0x63, 0xE0, 0x2F, 0x12, 0x62, 0x2D, 0x60, 0x2F, 0x06,
+0xC0, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0x70, 0xB0, 0x04, 0x50, 0x90, 0x01, 0x30, 0x08, 0x53, 0xA0,
+0x90, 0x41, 0xA1, 0xB0, 0x40, 0x0F, 0x05, 0xB0, 0x50, 0x0A, 0x90, 0x40, 0x07, 0x51, 0x05, 0xB0,
+0x40, 0xB0, 0x40, 0x0B, 0xB0, 0x40, 0x02, 0x40, 0x90, 0x0D, 0xB0, 0x80, 0x70, 0x30, 0x80, 0x40,
+0x50, 0x09, 0x40, 0xF0, 0xE0, 0x23, 0xE0, 0xC2, 0xD0, 0xB0, 0x09, 0x50, 0x90, 0x40, 0xB0, 0x0D,
+0x50, 0x70, 0xE0, 0x2D, 0xE2, 0xC0, 0x62, 0xC0, 0x2F, 0x1E, 0xE0, 0xF0, 0x90, 0x00, 0x50, 0xA0,
+0x50, 0x0C, 0x04, 0xB0, 0xD0, 0x40, 0x02, 0x41, 0x80, 0xB0, 0x01, 0xD0, 0xB0, 0x00, 0xB0, 0x90,
+0x00, 0xB0, 0x30, 0xA0, 0x70, 0xA0, 0x41, 0x80, 0x05, 0xF0, 0x60, 0xE0, 0x2F, 0x02, 0xE2, 0xC0,
+0x62, 0xC0, 0x21, 0xE0, 0x60, 0x2F, 0x0E, 0xE1, 0xC0, 0x61, 0xC0, 0xE0, 0x2E, 0x60, 0xC0, 0x2F,
+0x04, 0x61, 0xE0, 0x2A, 0xE0, 0xF0, 0x80, 0x04, 0x40, 0x50, 0x01, 0x50, 0x80, 0x07, 0xB0, 0x90,
+0x01, 0xB0, 0x30, 0x03, 0xB0, 0x30, 0x50, 0x0F, 0x05, 0xB0, 0x50, 0x0A, 0xB0, 0xA0, 0x08, 0x40,
+0x04, 0x50, 0x40, 0x01, 0xB0, 0x40, 0x0C, 0x40, 0xB0, 0x00, 0x50, 0x80, 0x0A, 0xB0, 0x80, 0xA0,
+0x30, 0xD0, 0x80, 0x90, 0xB0, 0x0B, 0xB0, 0xA0, 0xE0, 0x23, 0xE0, 0x60, 0x20, 0xE1, 0x70, 0x0C,
+0x50, 0x41, 0xB0, 0x09, 0x40, 0x70, 0xE1, 0x2F, 0x00, 0xE0, 0xC1, 0xE0, 0x20, 0xC0, 0x62, 0xC1,
+0xE2, 0x2F, 0x16, 0xE0, 0xF0, 0xB0, 0x01, 0x80, 0xB0, 0xD1, 0x70, 0x30, 0x40, 0xB0, 0x06, 0x04,
+0x90, 0x30, 0x03, 0x30, 0x40, 0x91, 0x00, 0x50, 0xD0, 0x50, 0x09, 0x30, 0x50, 0x05, 0x90, 0xA0,
+0xE0, 0x2E, 0xE1, 0x20, 0x62, 0xC1, 0xE0, 0x23, 0xE0, 0x60, 0x2F, 0x0D, 0xC0, 0x61, 0xC0, 0xE1,
+0x2F, 0x00, 0xE1, 0x60, 0xE0, 0x2E, 0xE0, 0x20, 0xC0, 0x60, 0x20, 0xE0, 0x2A, 0xE0, 0x60, 0xA0,
+0x04, 0x40, 0xB0, 0x00, 0x80, 0x70, 0xA0, 0x50, 0x06, 0xB0, 0x40, 0x03, 0x30, 0x40, 0x50, 0x01,
+0xB0, 0x90, 0xA0, 0x90, 0x0F, 0x04, 0xB0, 0x50, 0x0B, 0x40, 0xA0, 0x31, 0xB0, 0x04, 0xB0, 0x90,
+0x01, 0xB0, 0x40, 0x50, 0x03, 0xB0, 0x90, 0x0C, 0x40, 0x50, 0x00, 0x30, 0x06, 0x50, 0x80, 0x30,
+0x70, 0x30, 0x50, 0x01, 0x80, 0xB0, 0x00, 0x50, 0x40, 0xB0, 0x0A, 0xF0, 0x60, 0xE0, 0x22, 0xC1,
+0xE0, 0x20, 0xE0, 0x60, 0x70, 0x04, 0xB1, 0x80, 0x40, 0x05, 0x90, 0x40, 0x90, 0xB0, 0x05, 0x80,
+0xF0, 0xE0, 0x2F, 0x02, 0xE0, 0x60, 0x22, 0xE3, 0xC0, 0x62, 0xC0, 0x20, 0xE1, 0x2F, 0x13, 0xE0,
+0x70, 0x40, 0xB0, 0x00, 0xA0, 0x00, 0xB0, 0x70, 0xB0, 0x40, 0x30, 0xD0, 0x80, 0x05, 0x05, 0x70,
+0x81, 0xA0, 0xD0, 0xA0, 0x00, 0x50, 0xD0, 0x30, 0x40, 0x80, 0x30, 0x09, 0x70, 0x07, 0x70, 0xE1,
+0x29, 0xE1, 0xC1, 0x62, 0xC0, 0x29, 0xC1, 0xE0, 0x2F, 0x06, 0xE1, 0xC0, 0x61, 0xC0, 0x2F, 0x04,
+0xE1, 0xC0, 0x60, 0xC0, 0x2D, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2B, 0xE0, 0xF0, 0x30, 0x03, 0xB0,
+0x40, 0x01, 0x41, 0x09, 0x40, 0x04, 0x30, 0x00, 0x50, 0x40, 0x00, 0x40, 0x01, 0x30, 0x80, 0x0F,
+0x03, 0xB0, 0x50, 0x0E, 0xB0, 0xA0, 0x05, 0x90, 0xB0, 0x50, 0x90, 0xB0, 0x05, 0x51, 0x0C, 0x51,
+0xA0, 0x01, 0x50, 0x90, 0x80, 0x30, 0xA0, 0x80, 0x50, 0x0A, 0x91, 0x09, 0x50, 0xA0, 0xE1, 0x21,
+0x60, 0xC0, 0xE1, 0x20, 0xE0, 0xC0, 0xA0, 0x90, 0x02, 0x70, 0x30, 0x40, 0x08, 0xB0, 0x91, 0x50,
+0x02, 0x80, 0xA0, 0xE0, 0x28, 0xE1, 0xC0, 0x27, 0x60, 0xE0, 0x29, 0xC0, 0x61, 0xC1, 0xE2, 0x2F,
+0x0F, 0xE0, 0xA0, 0x90, 0x30, 0x70, 0x30, 0x01, 0x80, 0x0A, 0x05, 0xB0, 0x81, 0x40, 0xB0, 0x02,
+0x30, 0x01, 0x50, 0xD0, 0x09, 0x41, 0x05, 0xB0, 0x10, 0xA0, 0xE1, 0x23, 0xE0, 0x22, 0xC0, 0x62,
+0xC0, 0xE2, 0x2B, 0x60, 0xE0, 0x2F, 0x06, 0xC0, 0x60, 0xC1, 0x2F, 0x06, 0xC0, 0x60, 0xC1, 0x60,
+0xE1, 0x2A, 0xC0, 0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0xA0, 0x03, 0xB0, 0x40, 0x02, 0x40, 0x50, 0x08,
+0x40, 0xB0, 0x04, 0x30, 0x02, 0x41, 0x02, 0x80, 0x30, 0x0F, 0x02, 0xB0, 0x50, 0x0F, 0x00, 0x90,
+0x30, 0xB0, 0x03, 0x50, 0x80, 0xB0, 0x90, 0xA1, 0x80, 0xB0, 0x03, 0x90, 0xB0, 0x0C, 0xB0, 0x30,
+0xA0, 0x30, 0x80, 0x40, 0x50, 0x0F, 0x00, 0xB0, 0x40, 0x50, 0x08, 0xA0, 0x60, 0xE1, 0x20, 0x60,
+0xC0, 0x60, 0xC0, 0x21, 0xE0, 0xC0, 0xF0, 0xA0, 0x01, 0x30, 0x0D, 0xB0, 0x91, 0xF1, 0xE1, 0x28,
+0x60, 0xA0, 0x10, 0xC0, 0x25, 0xC1, 0xE0, 0x29, 0xE1, 0x20, 0xC1, 0x61, 0xC0, 0x2F, 0x0F, 0x60,
+0x80, 0x01, 0x90, 0x40, 0x0D, 0x0A, 0x31, 0x00, 0xA0, 0x02, 0x70, 0x09, 0x40, 0x90, 0x03, 0xB0,
+0x00, 0x30, 0x40, 0xB0, 0x70, 0xE2, 0x20, 0xE0, 0xC0, 0x62, 0xC0, 0x23, 0xE1, 0x2B, 0xE0, 0x60,
+0x2F, 0x02, 0xE1, 0xC0, 0x61, 0x22, 0xE1, 0x2F, 0x01, 0xE1, 0xC0, 0x61, 0x22, 0x60, 0x28, 0xE0,
+0x20, 0xE0, 0x61, 0x2F, 0x00, 0xE0, 0xC0, 0x10, 0x80, 0x90, 0x00, 0x51, 0x03, 0x80, 0x50, 0x07,
+0x40, 0xB0, 0x05, 0xA0, 0x02, 0x40, 0xB0, 0x40, 0x50, 0x01, 0x90, 0x70, 0x0F, 0x01, 0xB0, 0x50,
+0x0F, 0x00, 0x34, 0x80, 0x90, 0xB1, 0x30, 0x80, 0x01, 0x50, 0x30, 0xA0, 0x80, 0x02, 0x40, 0x0D,
+0x40, 0x80, 0x0F, 0x06, 0x50, 0x40, 0xB0, 0x07, 0xA0, 0x70, 0xF0, 0x60, 0xE2, 0xC0, 0x61, 0xE2,
+0x60, 0x10, 0x00, 0x70, 0x0F, 0x00, 0x40, 0xF0, 0x61, 0x20, 0xE1, 0x24, 0xE0, 0xF0, 0x70, 0xA0,
+0xF0, 0xE1, 0x23, 0xE0, 0x60, 0x2F, 0x01, 0xE0, 0x20, 0xC0, 0x62, 0xC0, 0xE3, 0x2F, 0x06, 0xE0,
+0xF0, 0x50, 0x01, 0x80, 0x50, 0x0D, 0x09, 0x50, 0x81, 0x50, 0x81, 0x31, 0x10, 0x50, 0x07, 0x40,
+0x70, 0xB0, 0x02, 0xB0, 0xD0, 0x70, 0xA0, 0x01, 0xB0, 0x10, 0xA0, 0xC1, 0x61, 0x20, 0xE2, 0x2F,
+0x02, 0xE0, 0xC1, 0xE0, 0x2E, 0xC0, 0x61, 0xC0, 0xE1, 0x2F, 0x06, 0xC0, 0x60, 0xC0, 0xE0, 0x24,
+0x60, 0x28, 0x61, 0x20, 0xE0, 0x2F, 0x00, 0xE0, 0x70, 0xA0, 0x00, 0x40, 0x70, 0x31, 0x80, 0x40,
+0xB0, 0x00, 0x80, 0xB0, 0x06, 0x90, 0x50, 0x06, 0x30, 0x01, 0x50, 0xB0, 0x01, 0xB0, 0x40, 0x90,
+0x01, 0x70, 0x50, 0x0E, 0xB0, 0x50, 0x0D, 0x40, 0xA0, 0xB0, 0x01, 0xB0, 0x91, 0xA0, 0x80, 0xA0,
+0x30, 0x05, 0x50, 0xA0, 0x30, 0x40, 0x00, 0x40, 0x0C, 0x90, 0x41, 0xB0, 0x0F, 0x06, 0x50, 0x40,
+0xB0, 0x07, 0x30, 0x70, 0xC0, 0xE0, 0x20, 0xE1, 0xC0, 0x61, 0xA0, 0x10, 0x40, 0x70, 0x80, 0x0F,
+0x00, 0x30, 0xC0, 0xE0, 0x20, 0x62, 0x22, 0xE2, 0xC0, 0xF0, 0xC0, 0xE0, 0x25, 0xE0, 0x60, 0x2F,
+0x02, 0xE4, 0xC0, 0x62, 0xC0, 0x20, 0xE1, 0x2F, 0x03, 0xE0, 0xA1, 0x30, 0x80, 0x30, 0xB0, 0x0D,
+0x0A, 0x90, 0x40, 0x00, 0x90, 0x30, 0xB0, 0x00, 0x80, 0x40, 0x07, 0x70, 0x04, 0x30, 0xB0, 0x01,
+0xB0, 0x51, 0x40, 0x90, 0xD0, 0xA0, 0xE2, 0x2F, 0x07, 0x60, 0x2A, 0xE1, 0xC0, 0x61, 0xC0, 0x2F,
+0x07, 0xE0, 0xC0, 0x61, 0xC0, 0x26, 0xE0, 0x60, 0x24, 0xE1, 0xC0, 0x60, 0xC0, 0x2F, 0x04, 0x60,
+0x70, 0x40, 0x90, 0xB0, 0x00, 0xB1, 0x90, 0x30, 0xA0, 0x70, 0x06, 0x50, 0x90, 0x07, 0x30, 0x01,
+0x40, 0x04, 0xB0, 0x40, 0x90, 0xB0, 0x30, 0x40, 0x0D, 0xB0, 0x50, 0x0C, 0x30, 0x80, 0x01, 0x50,
+0x40, 0x50, 0x02, 0x40, 0x00, 0x80, 0x90, 0x07, 0x40, 0xA0, 0x30, 0x80, 0x0B, 0x50, 0x80, 0x00,
+0x40, 0xB0, 0x0F, 0x07, 0x91, 0x06, 0x40, 0x80, 0xA0, 0xC0, 0x25, 0x60, 0xF0, 0x60, 0x81, 0x06,
+0x50, 0x05, 0x50, 0x30, 0xF0, 0xE0, 0x23, 0xC0, 0x61, 0xC1, 0x60, 0xE0, 0xF0, 0xE0, 0x27, 0xC0,
+0x60, 0x2F, 0x04, 0xE1, 0x20, 0xE1, 0x21, 0xC0, 0x62, 0xC0, 0x20, 0xE1, 0x2E, 0xE0, 0xA0, 0x01,
+0xB0, 0x70, 0x0E, 0x0D, 0xB0, 0x30, 0x01, 0xB0, 0x30, 0x06, 0xA0, 0xB0, 0x03, 0x90, 0x80, 0x00,
+0x50, 0x40, 0x90, 0x50, 0xB0, 0x01, 0x50, 0x80, 0xA0, 0xC0, 0xE0, 0x2F, 0x06, 0xE0, 0x60, 0xE0,
+0x27, 0xE0, 0x20, 0x62, 0x20, 0xE0, 0x2F, 0x06, 0xE0, 0x20, 0x61, 0xC0, 0x28, 0xE0, 0x20, 0x60,
+0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x04, 0xE0, 0xC0, 0x30, 0xB0, 0x0D, 0xB0,
+0x90, 0x08, 0x30, 0x00, 0x90, 0xB0, 0x07, 0x41, 0x30, 0x80, 0x0C, 0xB0, 0x50, 0x0A, 0x50, 0xA0,
+0x90, 0xB0, 0x40, 0x80, 0xB0, 0x06, 0x90, 0x30, 0x09, 0xB0, 0x40, 0x30, 0x80, 0xB0, 0x08, 0xB0,
+0x30, 0x01, 0x90, 0x50, 0x0F, 0x07, 0xB0, 0x40, 0x50, 0x03, 0x50, 0x30, 0x00, 0xB0, 0xA0, 0xE0,
+0x24, 0xE1, 0xC0, 0x60, 0x30, 0x05, 0x50, 0xA0, 0x80, 0xB0, 0x02, 0x50, 0x70, 0x60, 0xE0, 0x24,
+0xE2, 0xC0, 0x60, 0xA0, 0xC0, 0xE1, 0x27, 0x60, 0xC0, 0x2F, 0x06, 0xE0, 0x26, 0xC1, 0x61, 0xC0,
+0x20, 0xE1, 0x2A, 0xE0, 0xC0, 0xF0, 0x01, 0xB0, 0x30, 0x0E, 0x0E, 0xA0, 0x00, 0xB0, 0x80, 0x10,
+0x06, 0x30, 0x02, 0xB0, 0x90, 0x81, 0x50, 0xB0, 0x07, 0x90, 0xA0, 0xE0, 0x2F, 0x06, 0xE0, 0xC1,
+0x24, 0xE1, 0x62, 0xC0, 0xE1, 0x2F, 0x03, 0xE0, 0x21, 0xE0, 0x20, 0x61, 0xC0, 0xE1, 0x29, 0xE0,
+0x60, 0xC0, 0xE1, 0x61, 0x2F, 0x07, 0xE0, 0xC0, 0x40, 0xA0, 0x0E, 0x40, 0x09, 0x30, 0xB0, 0x90,
+0x08, 0x40, 0x01, 0x90, 0xA0, 0x90, 0x50, 0x09, 0xB0, 0x50, 0x09, 0x80, 0xA0, 0x40, 0x50, 0xB0,
+0x00, 0x50, 0xB0, 0x06, 0xB0, 0x30, 0x50, 0x0A, 0x50, 0x40, 0x80, 0xA0, 0x80, 0x07, 0xA0, 0x02,
+0x50, 0x40, 0x0F, 0x08, 0x50, 0x40, 0xB0, 0x01, 0x30, 0x02, 0x80, 0xF0, 0xE0, 0x25, 0xE1, 0xA0,
+0x90, 0x50, 0x04, 0x70, 0xA0, 0x90, 0x02, 0x70, 0xE1, 0x26, 0xE4, 0xC0, 0x61, 0x20, 0xE0, 0x25,
+0x60, 0xE1, 0x2F, 0x0F, 0xE0, 0x20, 0xC0, 0x62, 0xC0, 0xE1, 0x27, 0xE0, 0xF0, 0x70, 0x50, 0x00,
+0x80, 0x50, 0x0E, 0x0E, 0x30, 0xA0, 0x30, 0x50, 0x70, 0x06, 0x30, 0x50, 0x41, 0x90, 0x00, 0xB0,
+0x30, 0x06, 0x30, 0x90, 0x00, 0x80, 0x10, 0xF0, 0xE0, 0x2F, 0x07, 0x60, 0xE3, 0xC0, 0x61, 0xC0,
+0xE1, 0x2F, 0x07, 0xE0, 0xC0, 0x61, 0x20, 0xE1, 0x2D, 0x60, 0xC0, 0x60, 0xC0, 0xE2, 0x2F, 0x05,
+0x60, 0xC0, 0xA1, 0x0D, 0x40, 0x0A, 0x30, 0x40, 0x09, 0x90, 0x02, 0x50, 0xA0, 0x40, 0x50, 0x41,
+0x91, 0x50, 0xB1, 0x01, 0xB0, 0x50, 0x01, 0xB1, 0x51, 0x91, 0x80, 0xA0, 0x50, 0x05, 0x40, 0x07,
+0x30, 0x80, 0xB0, 0x0A, 0x90, 0xB0, 0x00, 0x50, 0xA1, 0x40, 0x02, 0x32, 0x03, 0xB0, 0x40, 0x0F,
+0x09, 0x91, 0x70, 0x90, 0x03, 0xA0, 0xE2, 0x24, 0xE0, 0xD0, 0x40, 0xB0, 0x40, 0x50, 0x02, 0x50,
+0xA0, 0xB0, 0x00, 0xB0, 0x70, 0x60, 0xE0, 0x26, 0xE0, 0xF0, 0x70, 0x60, 0x21, 0xE1, 0x20, 0x62,
+0x20, 0xE0, 0x22, 0x60, 0xE2, 0x2F, 0x11, 0xE2, 0xC0, 0x62, 0xC0, 0x20, 0xE1, 0x22, 0xE0, 0x70,
+0xB0, 0x80, 0xA0, 0x10, 0x0F, 0x00, 0x0E, 0x90, 0x40, 0x01, 0x81, 0x01, 0xB0, 0x50, 0x90, 0x40,
+0x30, 0x05, 0xA0, 0x40, 0x04, 0x30, 0x10, 0xA0, 0x30, 0x40, 0x00, 0xF1, 0xE0, 0x2F, 0x05, 0xE0,
+0x60, 0xE0, 0xC0, 0x61, 0xC0, 0x2F, 0x0A, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2E, 0xE0, 0xC0, 0x61,
+0xE0, 0x20, 0xE0, 0x60, 0xF0, 0x2E, 0xE0, 0x23, 0x60, 0xC0, 0xE0, 0x10, 0xB0, 0x0C, 0x40, 0xB0,
+0x0A, 0x80, 0x50, 0x08, 0x90, 0x05, 0x30, 0x80, 0x00, 0x40, 0x00, 0xB1, 0x51, 0x91, 0x41, 0x92,
+0x50, 0xB1, 0x00, 0x81, 0x07, 0x40, 0x08, 0x70, 0x90, 0x0B, 0x40, 0xB0, 0x02, 0x90, 0x31, 0x80,
+0x30, 0x07, 0x40, 0xB0, 0x0F, 0x09, 0x30, 0x50, 0x03, 0x80, 0xF1, 0x10, 0x60, 0x24, 0xE0, 0xD0,
+0x01, 0xB0, 0x40, 0x50, 0x40, 0x70, 0xB0, 0x00, 0x80, 0x70, 0xE0, 0x27, 0xE0, 0xC0, 0xF0, 0x50,
+0xF0, 0xE0, 0x25, 0xC0, 0x61, 0xC1, 0x60, 0x2F, 0x1C, 0xC0, 0x61, 0xC1, 0x20, 0xE1, 0xA0, 0x02,
+0x30, 0x0F, 0x00, 0x0F, 0x00, 0x30, 0x01, 0x50, 0xA0, 0x50, 0x40, 0x90, 0x50, 0x00, 0xB0, 0x70,
+0x05, 0xB0, 0x30, 0x04, 0xB0, 0x80, 0xB0, 0x30, 0x02, 0x30, 0x60, 0xE0, 0x2F, 0x02, 0xE1, 0x20,
+0x61, 0xC1, 0xE1, 0x2F, 0x07, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xE1, 0x2D, 0xE0, 0x20, 0x61,
+0x20, 0x60, 0xE0, 0x20, 0xE0, 0xF0, 0x10, 0x20, 0xE0, 0x2D, 0xE0, 0x20, 0xE0, 0x60, 0xC0, 0xE1,
+0xF0, 0x90, 0x0B, 0x51, 0x0B, 0x30, 0x09, 0x40, 0x06, 0x80, 0x30, 0xB0, 0x07, 0x50, 0x04, 0xB0,
+0xA0, 0x40, 0x50, 0x07, 0x51, 0x07, 0x40, 0x30, 0xB0, 0x0B, 0x40, 0x04, 0xB0, 0x40, 0x30, 0x08,
+0x40, 0x50, 0x0F, 0x07, 0x50, 0x30, 0xB0, 0x40, 0x50, 0x02, 0xA0, 0x10, 0xD0, 0xC0, 0xE2, 0x21,
+0xE0, 0xF0, 0x80, 0x02, 0x31, 0x51, 0xA0, 0x60, 0xE0, 0x27, 0xE0, 0xC0, 0x70, 0x00, 0xB0, 0xA0,
+0xE0, 0x26, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x2F, 0x1E, 0xC1, 0x62, 0x30, 0x01, 0xB0, 0x80, 0x0F,
+0x00, 0x0F, 0x00, 0xA0, 0x80, 0xA0, 0x30, 0x10, 0xB0, 0x04, 0xA0, 0x05, 0x90, 0x80, 0x06, 0x40,
+0x90, 0x03, 0x70, 0xE0, 0x2F, 0x00, 0xE1, 0xC0, 0x61, 0xC0, 0x60, 0xE0, 0x2F, 0x08, 0xE1, 0x61,
+0xC0, 0x2F, 0x01, 0xE0, 0x20, 0x61, 0x20, 0xE1, 0xC0, 0x60, 0x21, 0xE0, 0xC0, 0x60, 0xF0, 0xE0,
+0x20, 0xE1, 0x29, 0xE0, 0x20, 0x60, 0x22, 0xE0, 0x60, 0x80, 0x0A, 0x50, 0x90, 0x0B, 0x50, 0xA0,
+0x08, 0xB0, 0x50, 0x06, 0xB0, 0xA0, 0x50, 0x06, 0xB0, 0x50, 0x03, 0x50, 0x70, 0x01, 0x90, 0x08,
+0x40, 0x08, 0xA0, 0x40, 0x0B, 0xB0, 0x40, 0x05, 0xA0, 0x09, 0x90, 0x50, 0x0F, 0x06, 0x90, 0x30,
+0x01, 0x50, 0x40, 0xB0, 0x01, 0xD0, 0x30, 0x71, 0xD0, 0xF0, 0xE3, 0x70, 0xB0, 0x01, 0x70, 0x01,
+0xA0, 0x60, 0xE1, 0x26, 0xE0, 0x60, 0x70, 0xB0, 0x01, 0x30, 0xE1, 0x27, 0xE0, 0xC1, 0x62, 0xC0,
+0xE1, 0x2F, 0x1C, 0xE0, 0xF0, 0xA1, 0x31, 0x90, 0x0F, 0x00, 0x0F, 0x00, 0x30, 0x50, 0x01, 0x70,
+0xB0, 0x04, 0x90, 0x30, 0x04, 0xB0, 0x80, 0x06, 0x80, 0x50, 0x03, 0xF0, 0x60, 0x2E, 0xC0, 0x61,
+0xC0, 0xE0, 0x20, 0xE0, 0x60, 0x2F, 0x07, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x61,
+0xC0, 0xE0, 0x22, 0xE0, 0x60, 0x23, 0xC0, 0x70, 0x21, 0xF0, 0x60, 0xE1, 0x26, 0xE0, 0xC0, 0x60,
+0xE1, 0x22, 0x60, 0x80, 0x09, 0xB0, 0x90, 0x0B, 0xB0, 0x90, 0x30, 0x08, 0x90, 0x08, 0x50, 0xA0,
+0x30, 0xB0, 0x04, 0xB0, 0x50, 0x02, 0x40, 0xA0, 0x02, 0x40, 0x08, 0x90, 0xB0, 0x06, 0x90, 0x40,
+0x00, 0x90, 0x0B, 0xB0, 0x40, 0x04, 0x30, 0x0A, 0x50, 0x90, 0x0F, 0x04, 0x40, 0x00, 0x30, 0x03,
+0x90, 0x40, 0x05, 0x80, 0x70, 0x60, 0xE1, 0xC0, 0xA0, 0x01, 0x70, 0x00, 0x70, 0x60, 0xE0, 0x61,
+0xC0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xC0, 0xA0, 0x30, 0x03, 0xF0, 0x10, 0xE0, 0x28, 0x60, 0x20,
+0xE1, 0x20, 0xC0, 0x60, 0xC0, 0x2F, 0x1C, 0xE0, 0xA0, 0x02, 0x70, 0x0F, 0x01, 0x0F, 0x00, 0x41,
+0x01, 0x40, 0x80, 0x05, 0xA0, 0x30, 0xA0, 0x40, 0x50, 0x90, 0x50, 0x80, 0x06, 0x90, 0x40, 0x03,
+0x90, 0xD0, 0xE0, 0x28, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0xE1, 0x23, 0xC1, 0xE0, 0x2F, 0x05, 0x61,
+0x2F, 0x03, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x26, 0x60, 0xE0, 0x22, 0xE0, 0x21, 0xC1, 0xE0, 0x26,
+0xE0, 0xC0, 0x60, 0xE1, 0x22, 0xE0, 0xF0, 0x40, 0x09, 0x40, 0x0C, 0x90, 0x00, 0x30, 0xB0, 0x07,
+0x90, 0x08, 0x90, 0x00, 0xB0, 0x31, 0x50, 0x02, 0xB0, 0x50, 0x01, 0x40, 0x30, 0x03, 0x50, 0xB0,
+0x07, 0xB0, 0x50, 0x06, 0x90, 0x40, 0x00, 0x90, 0xB0, 0x0B, 0x50, 0x90, 0x03, 0x30, 0xB0, 0x0A,
+0xB0, 0x40, 0x0F, 0x02, 0x51, 0xB0, 0x80, 0x04, 0xB0, 0x40, 0x50, 0x04, 0xB0, 0x80, 0x70, 0xC0,
+0xE0, 0xA0, 0x40, 0xA0, 0x40, 0x70, 0xF0, 0xE0, 0x22, 0x61, 0xC0, 0xE1, 0xF1, 0x50, 0x04, 0xA0,
+0xC0, 0xE0, 0x20, 0xE0, 0x26, 0x60, 0xE0, 0x24, 0xC0, 0x61, 0xC1, 0xE0, 0x2F, 0x16, 0xE0, 0xC0,
+0xA0, 0x02, 0x30, 0x0F, 0x01, 0x0F, 0x01, 0x30, 0x00, 0x90, 0xA0, 0x70, 0x06, 0x90, 0xB0, 0x80,
+0x30, 0x80, 0xA1, 0x00, 0x80, 0x50, 0x03, 0xB0, 0x30, 0x04, 0x70, 0xF0, 0xE0, 0x27, 0x61, 0xC1,
+0xE1, 0x26, 0x60, 0xE0, 0x2F, 0x02, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x01, 0xE0, 0x20, 0x61, 0xE1,
+0x27, 0xC1, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x70, 0xF0, 0xE0, 0x26, 0x60, 0xC0, 0x25, 0xE0, 0xA0,
+0x50, 0x08, 0x40, 0x0C, 0x51, 0x00, 0x30, 0x07, 0x50, 0xB0, 0x08, 0x40, 0x03, 0xA0, 0x03, 0x90,
+0x00, 0x80, 0x30, 0x04, 0xB0, 0x50, 0x08, 0x40, 0x06, 0x41, 0x01, 0x40, 0x0C, 0x90, 0xB0, 0x02,
+0x80, 0xB0, 0x0B, 0xB0, 0x40, 0x0F, 0x01, 0x40, 0x00, 0x41, 0x06, 0xB0, 0x40, 0x50, 0x04, 0xB0,
+0x70, 0xA0, 0x80, 0x10, 0xA1, 0xC0, 0xE0, 0x22, 0xE2, 0xC0, 0xF0, 0xA0, 0x80, 0x06, 0x80, 0x60,
+0xE0, 0x26, 0xE0, 0xC1, 0x26, 0xE1, 0xC0, 0x61, 0xC0, 0x2F, 0x15, 0xE0, 0x60, 0xD0, 0x40, 0xB0,
+0x90, 0x40, 0x0F, 0x01, 0x0F, 0x01, 0x70, 0x30, 0x40, 0x00, 0xD0, 0xB0, 0x0A, 0xB0, 0xD0, 0x80,
+0x70, 0x30, 0x70, 0x90, 0x01, 0x70, 0xB0, 0x04, 0x31, 0xE0, 0x22, 0xE1, 0xC0, 0x61, 0x24, 0xE0,
+0x26, 0x60, 0xC0, 0x2D, 0xE1, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x01, 0xE1, 0x61, 0x2C, 0x60, 0x20,
+0xE4, 0x27, 0xE0, 0x60, 0xC0, 0x26, 0xC0, 0xA0, 0x08, 0x40, 0xB0, 0x0C, 0x40, 0x01, 0x30, 0xB0,
+0x06, 0x40, 0x09, 0x90, 0x03, 0xA0, 0x00, 0x50, 0x33, 0x40, 0x06, 0x90, 0x08, 0x90, 0xB0, 0x05,
+0x40, 0x90, 0x01, 0x50, 0xB0, 0x0C, 0x40, 0xB0, 0x01, 0x40, 0x90, 0x0D, 0x40, 0xB0, 0x0D, 0x40,
+0x00, 0x30, 0x00, 0x30, 0x08, 0x50, 0x40, 0x05, 0x40, 0x10, 0xA0, 0xE2, 0x25, 0xE0, 0xF0, 0x40,
+0x50, 0x91, 0x05, 0x90, 0xF0, 0xE0, 0x26, 0xE0, 0x60, 0x2C, 0xC0, 0x61, 0x20, 0xE1, 0x2F, 0x10,
+0xE0, 0xF0, 0x90, 0x50, 0x80, 0x70, 0x50, 0x0F, 0x01, 0x0F, 0x01, 0x40, 0x50, 0x01, 0x80, 0x90,
+0x0C, 0x80, 0xA0, 0x01, 0x70, 0x50, 0x80, 0x40, 0x05, 0x40, 0x10, 0x60, 0xE0, 0x20, 0xC0, 0x61,
+0xC0, 0xE1, 0x2D, 0x60, 0x2D, 0xC0, 0x60, 0xC0, 0xE1, 0x2F, 0x02, 0xE0, 0xC0, 0x60, 0xC0, 0xE0,
+0x2C, 0xE0, 0xF0, 0xD0, 0xF0, 0x72, 0x27, 0x60, 0x27, 0xE0, 0x70, 0x08, 0x90, 0x50, 0x0C, 0x50,
+0xB0, 0x01, 0x30, 0xB0, 0x05, 0xB0, 0x90, 0x08, 0xB0, 0x50, 0x03, 0x31, 0x80, 0x30, 0x00, 0x50,
+0x08, 0x90, 0x08, 0xB0, 0x90, 0x05, 0x41, 0x02, 0x40, 0x0D, 0x40, 0x01, 0x50, 0x40, 0x0E, 0x40,
+0x50, 0x0B, 0x50, 0x90, 0x00, 0xB0, 0x00, 0x30, 0x0A, 0x40, 0x90, 0x02, 0x40, 0xD0, 0x00, 0xF0,
+0xC0, 0xE0, 0x24, 0xE1, 0xF1, 0x02, 0xB0, 0x40, 0x90, 0x03, 0x90, 0xF0, 0xE0, 0x26, 0xC1, 0x2C,
+0xE1, 0x20, 0x62, 0x20, 0xE0, 0x2F, 0x0E, 0xE0, 0xA0, 0x02, 0x30, 0x0F, 0x02, 0x0F, 0x01, 0x50,
+0x80, 0x01, 0x80, 0x70, 0x0F, 0x02, 0x10, 0x40, 0x05, 0x30, 0x40, 0x80, 0xA0, 0xC0, 0x60, 0xC0,
+0x2F, 0x03, 0x60, 0x29, 0xE1, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x02, 0xE0, 0xC0, 0x60, 0xC0,
+0xE0, 0x2D, 0xC0, 0x60, 0xC0, 0x60, 0xE0, 0x60, 0xF0, 0xC0, 0x24, 0xE0, 0xC0, 0x60, 0x20, 0xE0,
+0x26, 0xC0, 0x10, 0x30, 0x82, 0x90, 0x02, 0x51, 0x0D, 0x40, 0x02, 0x80, 0xB0, 0x05, 0x50, 0xB0,
+0x08, 0x50, 0xB0, 0x06, 0x80, 0x00, 0x50, 0x08, 0x40, 0x09, 0x40, 0x05, 0x90, 0x40, 0x02, 0xB0,
+0x50, 0x0D, 0x40, 0x00, 0xB0, 0x30, 0x0F, 0x00, 0x50, 0x90, 0x09, 0xB0, 0x40, 0x90, 0x50, 0x01,
+0x30, 0xB0, 0x0A, 0xB0, 0x40, 0x50, 0x00, 0xA0, 0x00, 0x50, 0x70, 0xE1, 0x22, 0xE0, 0xC0, 0xA1,
+0x80, 0x05, 0xB0, 0x91, 0xB0, 0x00, 0xF0, 0x60, 0xE0, 0x26, 0x60, 0xE0, 0x2F, 0x02, 0xC0, 0x61,
+0xC0, 0x20, 0xE1, 0x2F, 0x0A, 0xC0, 0x70, 0xB0, 0x00, 0xB0, 0x80, 0x0F, 0x02, 0x0F, 0x02, 0xA0,
+0x80, 0xA0, 0x40, 0xD0, 0x0F, 0x02, 0x90, 0x31, 0x03, 0x70, 0x90, 0x50, 0x90, 0xA0, 0xE2, 0x2F,
+0x04, 0xC0, 0x28, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x02, 0xE0, 0x20, 0x61, 0x20, 0xE0, 0x2C,
+0xE0, 0x61, 0xE1, 0x60, 0xC0, 0xE1, 0x24, 0xE0, 0xC0, 0x60, 0xE1, 0x26, 0xE0, 0xA0, 0x30, 0x00,
+0x52, 0x40, 0x30, 0x00, 0xB0, 0x40, 0x0D, 0x90, 0xB0, 0x02, 0x80, 0x50, 0x05, 0x40, 0x09, 0x40,
+0x06, 0xB0, 0x30, 0x00, 0x50, 0x08, 0x90, 0x09, 0x50, 0xB0, 0x04, 0x90, 0x40, 0x03, 0x40, 0x0D,
+0xB0, 0x40, 0x00, 0xA0, 0x0F, 0x01, 0x50, 0x40, 0x08, 0x40, 0x01, 0x50, 0x40, 0x00, 0x30, 0xB0,
+0x0C, 0xB0, 0x40, 0x80, 0xB0, 0x10, 0x71, 0xC0, 0xE0, 0x20, 0xE0, 0xC0, 0x70, 0x0A, 0xB0, 0x91,
+0xA0, 0xE1, 0x26, 0x60, 0xE0, 0x2F, 0x03, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x07,
+0xE0, 0xF0, 0x40, 0x80, 0x30, 0xA0, 0x50, 0x0F, 0x02, 0x0F, 0x02, 0x80, 0x40, 0x01, 0xA0, 0x90,
+0x0F, 0x02, 0xB0, 0x50, 0xD0, 0x50, 0x00, 0xA0, 0x80, 0x50, 0xB1, 0xA0, 0xE0, 0x2F, 0x06, 0x60,
+0xE0, 0x23, 0xE1, 0x61, 0xC0, 0xE0, 0x2F, 0x03, 0xE1, 0x61, 0xC0, 0x2D, 0xE0, 0x20, 0x60, 0xC0,
+0xE0, 0x20, 0xE0, 0x20, 0x60, 0x25, 0xE0, 0x61, 0x29, 0xE0, 0x70, 0x05, 0x40, 0xA0, 0x40, 0x0D,
+0xB0, 0x40, 0x03, 0x80, 0x50, 0x04, 0xB0, 0x90, 0x09, 0x40, 0x06, 0xB0, 0x80, 0x00, 0x50, 0x08,
+0x50, 0xB0, 0x09, 0x90, 0x04, 0x50, 0x40, 0x03, 0xB0, 0x90, 0x0D, 0x51, 0x30, 0x0F, 0x02, 0xB0,
+0x40, 0x06, 0x90, 0xB0, 0x03, 0x90, 0x30, 0x0E, 0x80, 0x90, 0x40, 0x50, 0x80, 0x50, 0x70, 0x60,
+0xE0, 0x60, 0x70, 0xB0, 0x0C, 0xB0, 0xF0, 0x60, 0xC0, 0x24, 0xE0, 0x60, 0xC0, 0x2F, 0x09, 0xC0,
+0x61, 0xC0, 0xE2, 0x2F, 0x03, 0xE0, 0xA0, 0x02, 0x70, 0x00, 0x50, 0xB0, 0x0F, 0x00, 0x0F, 0x02,
+0xB0, 0x80, 0x01, 0x50, 0x30, 0x0F, 0x04, 0x90, 0xA0, 0x80, 0xB0, 0x02, 0x40, 0xF0, 0xE0, 0x2F,
+0x05, 0xE0, 0xC1, 0xE2, 0x20, 0x61, 0xC0, 0xE0, 0x2F, 0x04, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2D,
+0xE0, 0xC0, 0x60, 0xE1, 0x24, 0x60, 0x23, 0xE0, 0x60, 0xC0, 0xE0, 0x27, 0xE1, 0x70, 0x50, 0x06,
+0x40, 0xA0, 0x0D, 0x40, 0x04, 0x80, 0x50, 0x04, 0x90, 0x0A, 0x90, 0x06, 0xB0, 0x30, 0x00, 0x50,
+0x08, 0xB0, 0x50, 0x09, 0x40, 0x04, 0x90, 0x40, 0x04, 0x40, 0xB0, 0x0D, 0x80, 0xA0, 0xB0, 0x0F,
+0x03, 0x40, 0xB0, 0x03, 0x51, 0x05, 0x30, 0x90, 0x0D, 0x90, 0x81, 0x30, 0xA0, 0x01, 0x60, 0xA0,
+0x80, 0x0E, 0x90, 0xF0, 0xE0, 0x61, 0xC0, 0x23, 0x60, 0xE0, 0x2F, 0x0A, 0xE0, 0xC0, 0x62, 0xC0,
+0x20, 0xE0, 0x2F, 0x01, 0xE0, 0x30, 0x02, 0x30, 0x40, 0x80, 0xA0, 0x0F, 0x00, 0x0F, 0x03, 0x30,
+0x50, 0x80, 0x30, 0x10, 0x0F, 0x01, 0xB0, 0x90, 0x40, 0xB0, 0x05, 0x40, 0xF0, 0x2F, 0x07, 0xE0,
+0x60, 0xE0, 0xC0, 0x61, 0x2F, 0x06, 0xE0, 0xC0, 0x61, 0x2E, 0xE1, 0x60, 0xC0, 0xE0, 0x26, 0xC0,
+0x60, 0xE1, 0xC0, 0x60, 0x29, 0xE0, 0xF0, 0xD0, 0x50, 0x06, 0x40, 0x00, 0x30, 0x90, 0x0B, 0x51,
+0x04, 0x41, 0x01, 0x30, 0x10, 0x50, 0x90, 0x09, 0xB0, 0x50, 0x06, 0xB0, 0x80, 0x00, 0x50, 0x09,
+0x40, 0x09, 0x51, 0x03, 0xA0, 0x06, 0x40, 0x0B, 0xB0, 0x70, 0x41, 0xB0, 0x0F, 0x04, 0x40, 0x50,
+0x01, 0xB0, 0x40, 0x05, 0x40, 0xA0, 0xB0, 0x40, 0x50, 0xA0, 0xB0, 0x0A, 0x30, 0x51, 0x30, 0x90,
+0x50, 0x0F, 0x02, 0xF0, 0xC0, 0xE0, 0x21, 0xC0, 0x60, 0xC0, 0xE0, 0xC1, 0xE0, 0x2F, 0x0E, 0xC0,
+0x61, 0xC0, 0x20, 0xE0, 0x2D, 0xE0, 0xF0, 0x70, 0x30, 0x90, 0x80, 0x50, 0x90, 0x80, 0x30, 0x0F,
+0x00, 0x0F, 0x03, 0x30, 0x80, 0x50, 0x00, 0xA0, 0x50, 0x0C, 0xB0, 0x50, 0x40, 0x50, 0xB0, 0x07,
+0x90, 0xF0, 0xE0, 0x2F, 0x05, 0xE1, 0x61, 0xC1, 0xE0, 0x2F, 0x04, 0xE0, 0x20, 0x61, 0x20, 0xE0,
+0x2E, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0xC1, 0x60, 0xC0, 0xE0, 0x27, 0xE0, 0x20, 0xC0, 0xA0, 0x06,
+0x90, 0xB0, 0x01, 0x70, 0x01, 0x80, 0xD0, 0x50, 0xB1, 0x01, 0xB0, 0x01, 0x40, 0x06, 0xA0, 0x01,
+0x50, 0xB1, 0x50, 0x09, 0xB0, 0x50, 0x06, 0x90, 0x40, 0x00, 0x50, 0x09, 0x40, 0x0A, 0x40, 0x02,
+0xA0, 0x50, 0x06, 0x51, 0x0A, 0x50, 0x80, 0x01, 0x40, 0x0F, 0x05, 0x90, 0x50, 0x00, 0x40, 0x05,
+0xB0, 0xA0, 0x02, 0xA1, 0x50, 0x0D, 0x30, 0x80, 0x50, 0x40, 0xB0, 0x0F, 0x00, 0xF0, 0x60, 0x23,
+0xE0, 0xC0, 0x61, 0xE1, 0x2F, 0x0F, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x2C, 0xE0, 0x70, 0x00, 0xB0,
+0x90, 0xD0, 0x01, 0x50, 0xB0, 0x0F, 0x00, 0x0F, 0x00, 0x40, 0xD0, 0x51, 0x40, 0x01, 0x90, 0x30,
+0x0A, 0x50, 0x40, 0x90, 0xB0, 0x0A, 0x30, 0xF0, 0xE0, 0x2F, 0x03, 0xE1, 0xC0, 0x60, 0xC0, 0x60,
+0xE1, 0x2F, 0x03, 0xE1, 0xC0, 0x60, 0x20, 0xE0, 0x2D, 0xE0, 0x20, 0x60, 0xC0, 0x2B, 0xE0, 0x61,
+0xE0, 0x2B, 0xE0, 0xF0, 0x80, 0xB0, 0x03, 0x51, 0x02, 0x50, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0xD0,
+0x30, 0xA0, 0x70, 0x10, 0x30, 0x81, 0x50, 0xB0, 0x04, 0xA0, 0x01, 0x50, 0x40, 0x90, 0x0A, 0x50,
+0xB0, 0x06, 0x80, 0x90, 0x00, 0x50, 0x09, 0x90, 0x0A, 0x90, 0x01, 0x30, 0x40, 0x08, 0x40, 0x0A,
+0x30, 0x50, 0x02, 0x40, 0x0F, 0x05, 0x50, 0x80, 0xB0, 0x05, 0x41, 0x02, 0x40, 0x30, 0x40, 0xB0,
+0x0D, 0x80, 0x30, 0x00, 0x91, 0x08, 0x30, 0x80, 0x03, 0x70, 0xE0, 0x24, 0xE0, 0xC0, 0x62, 0xE1,
+0x2F, 0x10, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0x29, 0xE0, 0x30, 0x02, 0x30, 0x01, 0xB0, 0x0F, 0x01,
+0x0B, 0x90, 0x50, 0x02, 0xB0, 0x70, 0x00, 0xA0, 0x00, 0xB0, 0x80, 0x10, 0x07, 0x50, 0x41, 0xB0,
+0x0D, 0x40, 0x10, 0xC0, 0x2F, 0x02, 0xE0, 0x61, 0xC0, 0xE1, 0xC1, 0xE0, 0x2F, 0x03, 0xC0, 0x60,
+0xC0, 0xE0, 0x2E, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0x60, 0xC0, 0x2C, 0xE0,
+0x10, 0x40, 0x02, 0xB0, 0x90, 0x04, 0x40, 0x10, 0x40, 0x00, 0xB0, 0x05, 0x40, 0x50, 0x40, 0x30,
+0xA1, 0x31, 0xA0, 0x80, 0x01, 0x10, 0x80, 0x90, 0x0A, 0x40, 0x07, 0xA0, 0x00, 0xB0, 0x50, 0x09,
+0x90, 0x0A, 0xB0, 0x51, 0x30, 0x09, 0xB0, 0x90, 0x08, 0x90, 0xA0, 0x03, 0xB0, 0x40, 0x0F, 0x04,
+0x90, 0x50, 0x40, 0x05, 0x30, 0x06, 0x40, 0x90, 0x0D, 0x50, 0xA0, 0x31, 0x70, 0x40, 0x80, 0x33,
+0xA1, 0x50, 0x03, 0x50, 0x30, 0xE0, 0x23, 0xE1, 0x60, 0x20, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x2F,
+0x11, 0xE0, 0x20, 0x62, 0x26, 0xE0, 0xF0, 0x70, 0x90, 0x00, 0x50, 0x41, 0xD0, 0xA0, 0x10, 0x70,
+0x50, 0x0D, 0x0B, 0x70, 0xD0, 0x70, 0x90, 0x01, 0x30, 0x50, 0x80, 0xA0, 0x30, 0xB0, 0xA0, 0x50,
+0x03, 0xB0, 0x90, 0x40, 0x50, 0x0F, 0x02, 0x10, 0x60, 0xE0, 0x2D, 0xE0, 0x20, 0x61, 0xC0, 0x20,
+0xE0, 0x20, 0xE0, 0x20, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x00, 0x61,
+0x2B, 0xE1, 0x60, 0xC0, 0xE1, 0x60, 0x20, 0xE0, 0x2A, 0xE0, 0x10, 0x30, 0x90, 0x40, 0x81, 0x05,
+0x50, 0xA0, 0x07, 0x40, 0x0B, 0x10, 0x40, 0xB0, 0x0A, 0x40, 0x06, 0x80, 0x40, 0x00, 0xB0, 0x50,
+0x09, 0x50, 0xB0, 0x0A, 0x40, 0xA0, 0x0B, 0x40, 0x08, 0x40, 0x80, 0x04, 0x50, 0x90, 0x0F, 0x02,
+0x90, 0x50, 0x01, 0x40, 0xB0, 0x01, 0xD0, 0xB0, 0x30, 0x07, 0xB0, 0x40, 0x0F, 0x02, 0xB0, 0x40,
+0x50, 0x09, 0x80, 0x60, 0xE0, 0x23, 0xE0, 0xC1, 0x22, 0xE0, 0xC0, 0x61, 0xC0, 0xE0, 0x2F, 0x12,
+0xE0, 0xC0, 0x61, 0xC0, 0x20, 0xE0, 0x21, 0xE0, 0x70, 0x00, 0x40, 0x30, 0xD0, 0x00, 0x70, 0x02,
+0x90, 0xD0, 0x90, 0x0C, 0x0B, 0x90, 0x30, 0x50, 0x70, 0xA0, 0x30, 0x70, 0x00, 0x90, 0x80, 0x01,
+0x50, 0x30, 0x00, 0xB0, 0x50, 0x40, 0x50, 0xB0, 0x0F, 0x05, 0xA0, 0xE0, 0x2B, 0xE0, 0x20, 0x61,
+0xC0, 0x20, 0xE0, 0x22, 0xE0, 0x20, 0x60, 0xC0, 0x2D, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x2F, 0x00,
+0xC0, 0x60, 0xC0, 0x2B, 0xE0, 0x20, 0x60, 0xC0, 0x21, 0xE0, 0x20, 0x60, 0x2B, 0xF0, 0x13, 0x30,
+0xD0, 0x30, 0x50, 0xB0, 0x03, 0xA0, 0x06, 0xB0, 0x90, 0x0B, 0xB0, 0x40, 0x06, 0xB0, 0x40, 0x90,
+0xB1, 0x90, 0x40, 0xA3, 0x70, 0xA0, 0x80, 0x01, 0xB0, 0x50, 0x09, 0xB0, 0x50, 0x0A, 0x40, 0x90,
+0x0C, 0x40, 0x07, 0x30, 0x40, 0x05, 0x51, 0x0F, 0x00, 0x51, 0x03, 0x90, 0x50, 0x00, 0xA0, 0x31,
+0x09, 0x40, 0x50, 0x0F, 0x02, 0x50, 0x40, 0xB0, 0x07, 0xF0, 0xC0, 0xE0, 0x23, 0xE0, 0x60, 0x25,
+0xE0, 0xC1, 0x60, 0xC0, 0xE0, 0x2F, 0x12, 0xE0, 0x20, 0xC0, 0x61, 0xC0, 0xE0, 0x60, 0xF0, 0x01,
+0xB0, 0x30, 0x00, 0x70, 0x40, 0x02, 0xB0, 0xA0, 0x0C, 0x0C, 0x70, 0x01, 0x90, 0x40, 0xB0, 0x01,
+0xA0, 0x00, 0xB0, 0x30, 0xD0, 0x91, 0xB0, 0x0F, 0x08, 0x70, 0xE0, 0x28, 0xE1, 0x20, 0x61, 0xC0,
+0x29, 0x60, 0xE0, 0x2B, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0x60, 0x2C, 0xE0,
+0xC0, 0x60, 0x24, 0xE0, 0xC0, 0x60, 0x29, 0xE0, 0xA0, 0x40, 0x50, 0x40, 0x90, 0x00, 0x50, 0xD0,
+0x10, 0x30, 0x02, 0xB0, 0x70, 0x06, 0x40, 0x0D, 0x40, 0x04, 0x90, 0xA1, 0x41, 0xD0, 0x31, 0x40,
+0x08, 0xB0, 0x50, 0x0A, 0x90, 0x0A, 0x70, 0x50, 0x0C, 0x90, 0xB0, 0x06, 0xA0, 0x07, 0x90, 0xB0,
+0x0D, 0x50, 0x90, 0x05, 0x91, 0x00, 0x40, 0xA0, 0x0A, 0x50, 0x40, 0x0F, 0x03, 0x90, 0x40, 0x06,
+0xF0, 0xC0, 0xE0, 0x22, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xC0, 0x60, 0xC0, 0xE1, 0x2F, 0x10, 0xE0,
+0x20, 0xE0, 0x20, 0xC0, 0x60, 0x30, 0xD0, 0x90, 0x00, 0x40, 0x90, 0x01, 0x70, 0xD0, 0x80, 0xB0,
+0x81, 0x0C, 0x0C, 0x80, 0x50, 0x02, 0x50, 0x40, 0x00, 0x80, 0x13, 0x90, 0x0F, 0x08, 0x80, 0x10,
+0xF0, 0xE0, 0x27, 0xE0, 0xC0, 0x61, 0x20, 0xE0, 0x2A, 0x60, 0xC0, 0x28, 0xE0, 0x20, 0xC0, 0x60,
+0xC0, 0xE1, 0x2E, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2B, 0xE0, 0xC0, 0x60, 0xE0, 0x25, 0xE0, 0xC0,
+0x60, 0xE0, 0x27, 0xE0, 0x70, 0x11, 0x30, 0x70, 0x40, 0x50, 0x06, 0x80, 0x30, 0x04, 0x51, 0x0C,
+0x90, 0xB0, 0x01, 0xB0, 0x40, 0xA0, 0x80, 0x03, 0x30, 0x90, 0xB0, 0x09, 0xB0, 0x50, 0x0A, 0x40,
+0x09, 0x41, 0x90, 0x0D, 0x40, 0x06, 0x30, 0xB0, 0x07, 0x40, 0x0C, 0x50, 0x40, 0x07, 0xB0, 0x31,
+0x50, 0x0C, 0x40, 0xB0, 0x0F, 0x02, 0xB0, 0x40, 0x90, 0x04, 0x30, 0xC0, 0x23, 0xE0, 0x60, 0x2A,
+0xE1, 0xC0, 0x61, 0xE1, 0x2F, 0x11, 0xE2, 0xD0, 0x12, 0x70, 0xB0, 0x02, 0xB0, 0x30, 0x70, 0x80,
+0x0D, 0x0E, 0x40, 0xB0, 0x10, 0xA1, 0x30, 0xB0, 0x10, 0x80, 0x00, 0x50, 0x70, 0x0F, 0x05, 0x40,
+0x80, 0x70, 0x10, 0xA0, 0xE0, 0x26, 0xE0, 0xC0, 0x61, 0x20, 0xE1, 0x2B, 0xE0, 0x60, 0x27, 0xE0,
+0x20, 0x61, 0x2F, 0x02, 0xE0, 0xC0, 0x60, 0x20, 0xE0, 0x2B, 0xE0, 0x61, 0x29, 0xC0, 0x60, 0x27,
+0xE0, 0x60, 0x10, 0x70, 0x80, 0x40, 0xB0, 0x40, 0x31, 0x70, 0x80, 0x03, 0xA0, 0xB0, 0x03, 0x40,
+0x0D, 0x40, 0x01, 0xB0, 0x70, 0x90, 0x40, 0x04, 0xB0, 0xA0, 0x0A, 0xB0, 0x50, 0x0A, 0x90, 0x09,
+0x30, 0xD0, 0x90, 0xB0, 0x0C, 0x51, 0x04, 0x80, 0x40, 0x09, 0x40, 0x0A, 0xB0, 0x90, 0x09, 0x40,
+0x80, 0x0E, 0x91, 0x0F, 0x03, 0xB0, 0x40, 0x50, 0x02, 0x70, 0xE0, 0x23, 0xC1, 0xE0, 0x2C, 0xE0,
+0xC0, 0x61, 0xE2, 0x2F, 0x0F, 0xE0, 0x60, 0x80, 0x00, 0x90, 0xD0, 0x30, 0xB0, 0x10, 0xA0, 0x90,
+0x0F, 0x02, 0x0D, 0x31, 0x00, 0x90, 0x80, 0x00, 0xD0, 0x00, 0x30, 0x02, 0x70, 0xB0, 0x07, 0x50,
+0xB0, 0x08, 0x30, 0x13, 0x70, 0xE0, 0x25, 0xC0, 0x61, 0x20, 0xE1, 0x2D, 0xE0, 0xC1, 0x25, 0xE0,
+0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x02, 0x61, 0xE0, 0x2D, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0x61, 0xE0,
+0x26, 0xE0, 0x80, 0x70, 0x30, 0x80, 0x50, 0x01, 0x80, 0x30, 0x50, 0xD0, 0x40, 0xB1, 0x30, 0xB0,
+0x02, 0x90, 0xB0, 0x0D, 0x80, 0x00, 0x90, 0x10, 0x50, 0x07, 0x30, 0x50, 0x09, 0x90, 0x40, 0x30,
+0x40, 0xB0, 0x07, 0x50, 0xB0, 0x07, 0x50, 0x11, 0x30, 0x90, 0xB0, 0x0C, 0x40, 0x04, 0x90, 0xA0,
+0x70, 0x08, 0xB0, 0x40, 0x08, 0xB0, 0x80, 0xB0, 0x09, 0x80, 0x90, 0x40, 0xB0, 0x0D, 0xB0, 0x40,
+0xB0, 0x0F, 0x03, 0x50, 0x40, 0xB0, 0x50, 0xF0, 0xE0, 0x23, 0x60, 0xE0, 0x2E, 0xE1, 0xC0, 0x61,
+0x20, 0xE0, 0x2F, 0x0E, 0xE0, 0xA0, 0xB0, 0x01, 0x80, 0x50, 0x00, 0xA0, 0x40, 0xA0, 0xD0, 0x30,
+0xB0, 0x0E, 0x0D, 0xA0, 0xB0, 0x00, 0xB0, 0x70, 0x00, 0x30, 0xB0, 0x40, 0x90, 0x50, 0x30, 0x70,
+0x80, 0x07, 0x31, 0x07, 0xA0, 0xD0, 0xA0, 0x71, 0x11, 0x60, 0xE0, 0x20, 0xE1, 0xC0, 0x60, 0xC0,
+0x21, 0xE0, 0x2F, 0x01, 0xE0, 0x60, 0x20, 0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F,
+0x00, 0xE0, 0xC0, 0x60, 0xC0, 0x2C, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0x60, 0xC1, 0x60,
+0xE0, 0x24, 0xE0, 0xC0, 0xA0, 0x10, 0xD0, 0x10, 0xD0, 0x01, 0xA0, 0x90, 0x01, 0x40, 0x30, 0x80,
+0x10, 0x03, 0x90, 0x50, 0x0C, 0x90, 0xA0, 0x30, 0xD0, 0xB0, 0x08, 0x40, 0x31, 0x06, 0xB0, 0xA0,
+0x81, 0x50, 0x40, 0x31, 0x02, 0xB0, 0x02, 0xB0, 0x50, 0x00, 0x40, 0xA2, 0x80, 0x00, 0x80, 0x30,
+0x90, 0xA0, 0x10, 0xA0, 0x30, 0xA0, 0xB0, 0x0A, 0xB0, 0x90, 0x05, 0x30, 0x40, 0x08, 0x50, 0x90,
+0x06, 0xB0, 0x40, 0x00, 0x40, 0xB0, 0x08, 0x30, 0x01, 0x40, 0xB0, 0x0E, 0x40, 0x50, 0x0F, 0x04,
+0x90, 0x30, 0xC0, 0xE0, 0x22, 0xC1, 0xE0, 0x2F, 0x03, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x0C, 0xE0,
+0xD0, 0xA0, 0x80, 0x00, 0xA0, 0x01, 0x40, 0x90, 0x01, 0x40, 0xA0, 0x0E, 0x0D, 0x40, 0x70, 0x40,
+0xD0, 0x80, 0x03, 0x10, 0x80, 0x01, 0x10, 0x0E, 0x10, 0xD1, 0x31, 0xD0, 0x10, 0x00, 0xB0, 0x11,
+0xC0, 0xE0, 0x61, 0xC0, 0xE1, 0x2F, 0x05, 0xC1, 0xE1, 0x20, 0x61, 0xE0, 0x2F, 0x02, 0xE0, 0x61,
+0xE0, 0x2C, 0xE0, 0x20, 0x60, 0x2B, 0xE0, 0x60, 0x20, 0xE1, 0xC0, 0x60, 0xE0, 0x23, 0xE0, 0x60,
+0x70, 0xD1, 0x70, 0x90, 0xA2, 0xB0, 0x04, 0x80, 0xA0, 0xD0, 0xA0, 0x30, 0x80, 0xD1, 0x0B, 0x30,
+0x80, 0x0B, 0x50, 0x40, 0x70, 0x06, 0x30, 0xB0, 0x00, 0x50, 0x02, 0x90, 0x30, 0x80, 0xA0, 0x30,
+0x70, 0x40, 0x01, 0x40, 0xA0, 0x50, 0x02, 0x50, 0x30, 0x40, 0x01, 0x50, 0x70, 0xA0, 0x10, 0x30,
+0x0C, 0x40, 0x05, 0xB0, 0x30, 0x09, 0x51, 0x04, 0x50, 0x40, 0x02, 0x90, 0x50, 0x07, 0x30, 0xB0,
+0x01, 0x40, 0x50, 0x0E, 0x50, 0x40, 0xB0, 0x0F, 0x03, 0x30, 0x61, 0x20, 0xE1, 0x60, 0xE1, 0x2F,
+0x04, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x2F, 0x09, 0xE0, 0x60, 0x40, 0x00, 0x50, 0x70, 0x80, 0x0F,
+0x07, 0x0E, 0x50, 0x80, 0x40, 0x80, 0xD1, 0xA0, 0x00, 0xA0, 0x02, 0xA0, 0x50, 0x0E, 0xD1, 0xA1,
+0x10, 0x80, 0x02, 0x40, 0xA0, 0xF0, 0xE2, 0x2F, 0x07, 0xE0, 0x60, 0xE0, 0x61, 0xE0, 0x2F, 0x04,
+0x60, 0xC0, 0xE0, 0x2D, 0xC0, 0x60, 0xE1, 0x2A, 0x60, 0x25, 0x60, 0x20, 0xE0, 0x21, 0x60, 0xE0,
+0xC0, 0x60, 0xE0, 0x11, 0x0A, 0x40, 0x50, 0x91, 0x00, 0x30, 0x90, 0x09, 0xB0, 0x70, 0x0B, 0x51,
+0x00, 0x30, 0x80, 0x40, 0xB0, 0x02, 0xB0, 0xA0, 0x00, 0xB0, 0x50, 0x03, 0x90, 0x50, 0x02, 0x40,
+0xA1, 0x30, 0x0A, 0x30, 0x10, 0x81, 0x0D, 0x40, 0x05, 0x30, 0x80, 0x09, 0x90, 0xB0, 0x02, 0x91,
+0x04, 0x90, 0x50, 0x06, 0x90, 0x40, 0x02, 0x50, 0x90, 0x0F, 0x00, 0x40, 0x50, 0x0F, 0x01, 0x50,
+0xA0, 0xE0, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x2F, 0x08, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0x20, 0xE0,
+0x2F, 0x06, 0xE0, 0x70, 0x02, 0x30, 0x50, 0x80, 0x50, 0x0F, 0x05, 0x0F, 0x00, 0x90, 0xD0, 0x80,
+0xB0, 0x00, 0x40, 0x80, 0x50, 0x40, 0x00, 0x50, 0xA1, 0x0F, 0x03, 0xD0, 0x80, 0x00, 0xB0, 0x91,
+0x00, 0x80, 0xF0, 0xE1, 0x2F, 0x07, 0xE0, 0x61, 0x20, 0xE0, 0x2F, 0x03, 0xC0, 0x60, 0x21, 0xE0,
+0x2C, 0xC0, 0x60, 0xE1, 0x2A, 0x60, 0xC0, 0xE0, 0x22, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x60, 0xC0,
+0x22, 0xE0, 0xC0, 0x10, 0x30, 0x0A, 0x90, 0x02, 0x40, 0x80, 0x07, 0xB0, 0x80, 0x30, 0x40, 0x0B,
+0x90, 0xB0, 0x01, 0x90, 0x31, 0x50, 0x40, 0x00, 0xA0, 0xB0, 0x00, 0xB0, 0x50, 0x0B, 0x40, 0x0B,
+0xB0, 0x30, 0x70, 0x50, 0x0C, 0x90, 0xB0, 0x03, 0xB0, 0x40, 0xD0, 0x0A, 0x40, 0xB0, 0x00, 0x90,
+0x50, 0x06, 0x40, 0x50, 0x05, 0xB0, 0x30, 0x03, 0xB0, 0x40, 0x0F, 0x00, 0x50, 0x90, 0x0F, 0x00,
+0x30, 0xC0, 0xE2, 0x61, 0xE1, 0x2F, 0x0B, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x05, 0xC0, 0x10, 0x40,
+0x01, 0x30, 0x00, 0xD1, 0x70, 0x40, 0xB0, 0x0F, 0x02, 0x0F, 0x00, 0xD0, 0xB0, 0x02, 0x40, 0x30,
+0x00, 0x70, 0xA0, 0x80, 0x00, 0x10, 0x0F, 0x02, 0x30, 0xA0, 0xB0, 0x91, 0x02, 0x60, 0xF0, 0xE1,
+0x2F, 0x05, 0xE0, 0xC0, 0x60, 0xC0, 0x60, 0xE0, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0xE0, 0x2D, 0xE0,
+0x60, 0xC0, 0xE0, 0x29, 0xE1, 0x60, 0x27, 0xE0, 0x20, 0x61, 0xC0, 0xE0, 0x22, 0xE1, 0x60, 0x80,
+0x09, 0x51, 0x03, 0xD0, 0x90, 0x06, 0x30, 0x80, 0x90, 0x0C, 0x40, 0x03, 0xB0, 0xD0, 0x31, 0x40,
+0x30, 0x01, 0xB0, 0x50, 0x0B, 0x40, 0x0C, 0x30, 0x80, 0x40, 0x0D, 0x40, 0x02, 0x40, 0xA0, 0x90,
+0x30, 0x80, 0x0A, 0x41, 0x50, 0x08, 0x90, 0x50, 0x02, 0x90, 0xA0, 0xD0, 0x50, 0x05, 0x40, 0xB0,
+0x0E, 0xB0, 0x40, 0xB0, 0x0C, 0x50, 0xA0, 0xE0, 0x21, 0xE0, 0x60, 0xC0, 0x61, 0xE0, 0x2F, 0x0C,
+0x61, 0xC0, 0x20, 0xE0, 0x2F, 0x01, 0xE0, 0xF0, 0x50, 0x90, 0x30, 0xA0, 0x40, 0x00, 0x80, 0x40,
+0xB0, 0x30, 0xD0, 0xA0, 0x0F, 0x01, 0x0F, 0x00, 0xD0, 0x01, 0x50, 0x70, 0xD0, 0x01, 0x80, 0xB0,
+0x01, 0x40, 0x30, 0x0F, 0x01, 0x30, 0xA0, 0xD0, 0xA0, 0x00, 0x90, 0xB0, 0x30, 0xA1, 0x70, 0xF0,
+0xE3, 0x2E, 0xE0, 0xC0, 0x60, 0xC0, 0x21, 0xE0, 0x60, 0xE0, 0x2E, 0xE0, 0xC0, 0x60, 0xE1, 0x2C,
+0xE0, 0x20, 0x60, 0xC0, 0xE1, 0x28, 0xE1, 0x60, 0x20, 0xE0, 0x27, 0xE0, 0xC0, 0x60, 0xC0, 0xE0,
+0x24, 0xE0, 0xA0, 0x10, 0x08, 0x40, 0x03, 0xB0, 0xD0, 0x90, 0x06, 0x81, 0xB0, 0x0C, 0x90, 0x04,
+0x70, 0xB0, 0x00, 0xA0, 0x70, 0x01, 0xB0, 0x50, 0x0B, 0x50, 0xB0, 0x0A, 0x32, 0x90, 0x0D, 0x51,
+0x00, 0xB0, 0xA0, 0x02, 0x40, 0x30, 0x09, 0x41, 0x0A, 0x90, 0x50, 0x01, 0x30, 0xB0, 0x08, 0x40,
+0x50, 0x0F, 0x00, 0x90, 0x40, 0x0B, 0xA0, 0xC0, 0x22, 0xC1, 0xE1, 0x20, 0x60, 0xC0, 0x2F, 0x0B,
+0xE1, 0xC0, 0x61, 0xE1, 0x2D, 0xE0, 0xC0, 0xA0, 0x02, 0xA0, 0x01, 0xB0, 0x50, 0x02, 0x50, 0x0F,
+0x01, 0x0F, 0x00, 0x90, 0xD1, 0x70, 0x40, 0x00, 0x40, 0x80, 0x00, 0x30, 0x01, 0x90, 0xD0, 0x0E,
+0x50, 0x40, 0x50, 0x00, 0x80, 0xD0, 0x11, 0xD0, 0x10, 0x70, 0x80, 0x00, 0xA0, 0xD0, 0xC0, 0xE0,
+0x2D, 0xE0, 0x20, 0x61, 0xE0, 0x22, 0xE0, 0xC1, 0xE0, 0x2C, 0xE0, 0x61, 0xE0, 0x2E, 0xC0, 0x60,
+0x20, 0xE0, 0x2B, 0x60, 0x20, 0xE0, 0x28, 0xC0, 0x60, 0xE0, 0xC0, 0x60, 0xE0, 0x22, 0xE0, 0x20,
+0xE0, 0xF0, 0x70, 0x01, 0x50, 0x92, 0xB0, 0x90, 0xB0, 0x04, 0x50, 0x80, 0x02, 0xB0, 0x40, 0x01,
+0x70, 0x90, 0x04, 0x50, 0x40, 0x90, 0x51, 0xB0, 0x00, 0xB0, 0x90, 0x40, 0x01, 0x30, 0x70, 0xA0,
+0x50, 0x01, 0x41, 0x80, 0x90, 0x00, 0x90, 0x0B, 0xB0, 0x50, 0x09, 0xA0, 0x50, 0x00, 0x40, 0x50,
+0x0E, 0x40, 0x00, 0x30, 0x40, 0x03, 0x80, 0x90, 0x06, 0xB0, 0x40, 0x00, 0xB0, 0x40, 0x0A, 0x90,
+0x50, 0x00, 0xA0, 0x31, 0x50, 0x07, 0x90, 0x50, 0x00, 0x10, 0xB0, 0x0C, 0xB0, 0x40, 0xB0, 0x08,
+0x50, 0xA0, 0xE0, 0x22, 0x60, 0x24, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x0A, 0xE1, 0xC0, 0x61, 0xC0,
+0xE0, 0x2B, 0xE0, 0xF0, 0x30, 0x01, 0x90, 0x80, 0x0F, 0x09, 0x0F, 0x05, 0x50, 0x80, 0x91, 0x81,
+0xA0, 0x40, 0x30, 0x90, 0x0B, 0x50, 0x40, 0x50, 0x04, 0x40, 0x10, 0xA0, 0x30, 0xA0, 0x02, 0x90,
+0x10, 0xE2, 0x2B, 0xC0, 0x60, 0xC0, 0xE2, 0x23, 0x60, 0x20, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0xC0,
+0xE0, 0x2E, 0xC0, 0x60, 0x20, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0x29, 0xC0, 0x60, 0xE0, 0x21, 0xC0,
+0x60, 0x25, 0xE0, 0x10, 0xB0, 0x00, 0x70, 0x40, 0x80, 0x40, 0xA0, 0x90, 0x06, 0xD0, 0xA1, 0x90,
+0x70, 0x10, 0x40, 0x80, 0x30, 0x50, 0x04, 0xA0, 0x90, 0x40, 0x81, 0x30, 0xA0, 0x30, 0x70, 0x80,
+0xA0, 0xD0, 0x80, 0x05, 0xA0, 0xB0, 0x10, 0x30, 0x50, 0x0C, 0x90, 0x08, 0x41, 0x01, 0xB0, 0x30,
+0x0F, 0x00, 0x30, 0x40, 0x04, 0x50, 0x80, 0x05, 0x50, 0x90, 0x02, 0x51, 0x0A, 0x40, 0xB0, 0x00,
+0xB1, 0x30, 0x40, 0x07, 0x50, 0x80, 0x70, 0x0F, 0x00, 0x91, 0x07, 0xA0, 0xC0, 0x21, 0xE0, 0x60,
+0xC0, 0x23, 0xE1, 0x20, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x0B, 0xE0, 0xC0, 0x61, 0x2B, 0xE0, 0xA0,
+0x90, 0xA0, 0x80, 0x30, 0xB0, 0x0F, 0x09, 0x0F, 0x06, 0x80, 0x30, 0xB0, 0x50, 0xA0, 0x01, 0x50,
+0x70, 0x09, 0x90, 0x40, 0x50, 0x06, 0x10, 0x40, 0x06, 0x40, 0xD0, 0xC0, 0xE0, 0x28, 0xE0, 0xC0,
+0x61, 0xE1, 0x26, 0xC0, 0x60, 0x2A, 0xC0, 0x60, 0xE1, 0x2C, 0xE0, 0x20, 0xC0, 0x60, 0xE0, 0x2A,
+0xE1, 0x60, 0xC0, 0x20, 0xE0, 0x27, 0xE0, 0x60, 0x20, 0xE0, 0x23, 0x60, 0xC0, 0xE1, 0x21, 0xE0,
+0x60, 0xD0, 0xA0, 0x90, 0x02, 0x90, 0x30, 0x06, 0x70, 0xB1, 0x30, 0x51, 0xA0, 0x40, 0x30, 0x90,
+0x04, 0xA0, 0x06, 0x80, 0x50, 0xB0, 0x80, 0x06, 0x80, 0xB0, 0x90, 0xD0, 0x50, 0x0C, 0x90, 0x08,
+0x30, 0xB0, 0x02, 0x80, 0x30, 0x0D, 0xB0, 0x70, 0x05, 0x80, 0x50, 0x04, 0x40, 0x50, 0x04, 0x40,
+0xB0, 0x0A, 0x90, 0xB0, 0x02, 0x80, 0x70, 0x50, 0x06, 0x50, 0x80, 0x0F, 0x01, 0x50, 0x40, 0x05,
+0x50, 0xA0, 0xE0, 0x22, 0x60, 0x26, 0xE1, 0x20, 0x61, 0x2F, 0x0F, 0x61, 0xC0, 0xE0, 0x26, 0xE0,
+0x60, 0x80, 0x01, 0x40, 0x30, 0x0F, 0x0A, 0x0F, 0x0A, 0xA0, 0x02, 0x70, 0x50, 0x06, 0x90, 0x40,
+0xB0, 0x07, 0x50, 0x80, 0x08, 0x40, 0x10, 0xC0, 0xE0, 0x27, 0x61, 0xE0, 0x29, 0xE0, 0x60, 0x27,
+0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x00, 0x61, 0xE0, 0x2B, 0xE0, 0x60, 0x20, 0xE0, 0x28, 0xE0,
+0x60, 0xC0, 0x26, 0x61, 0xE1, 0x21, 0xE0, 0x10, 0xB0, 0x02, 0xB0, 0x50, 0xA0, 0x50, 0x05, 0x70,
+0x06, 0x50, 0xD0, 0x50, 0xB0, 0x80, 0x30, 0xB0, 0x30, 0x06, 0x50, 0x70, 0x50, 0xA0, 0xB0, 0x05,
+0x70, 0x00, 0xA1, 0x50, 0x0C, 0x40, 0x07, 0x50, 0xA0, 0x00, 0x80, 0x33, 0x50, 0x0B, 0x40, 0xA0,
+0x00, 0x40, 0x04, 0x80, 0x70, 0xA0, 0x50, 0x00, 0xB0, 0x40, 0x07, 0x40, 0xB0, 0x0A, 0x40, 0x50,
+0x03, 0x70, 0x08, 0x40, 0xB0, 0x09, 0x40, 0x05, 0x40, 0x50, 0x03, 0x70, 0xE0, 0x22, 0x60, 0xE0,
+0x29, 0xE0, 0xC0, 0x60, 0xC0, 0x2F, 0x0D, 0xE1, 0x61, 0xC0, 0xE0, 0x24, 0xE0, 0x70, 0xB0, 0x01,
+0x80, 0x50, 0x0F, 0x0A, 0x0F, 0x0A, 0x90, 0x80, 0x40, 0xA0, 0x30, 0xA0, 0x03, 0xB0, 0x90, 0x40,
+0xB0, 0x0F, 0x06, 0x90, 0x10, 0xE1, 0x24, 0x61, 0x20, 0xE0, 0x2B, 0xE0, 0x60, 0xE0, 0x23, 0xE1,
+0xC0, 0x60, 0x20, 0xE0, 0x2D, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2C, 0x60, 0x20, 0xE0, 0x28, 0xE0,
+0x60, 0xC0, 0x27, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x21, 0x10, 0x80, 0x02, 0x40, 0x00, 0x41, 0x05,
+0xA0, 0x90, 0x04, 0xB0, 0x90, 0xB0, 0xA0, 0x70, 0x50, 0xB0, 0x80, 0x10, 0xB0, 0x05, 0x90, 0x30,
+0x01, 0xD0, 0x04, 0x40, 0x80, 0x00, 0x31, 0x50, 0x0C, 0x40, 0x07, 0x80, 0x40, 0x00, 0x10, 0x02,
+0x90, 0x08, 0x50, 0x80, 0x30, 0xA0, 0x40, 0x01, 0x50, 0xB0, 0x05, 0x40, 0x30, 0x81, 0x09, 0x40,
+0x0B, 0x90, 0x50, 0x02, 0x40, 0x80, 0x08, 0x40, 0xB0, 0x03, 0xB0, 0xA0, 0x80, 0x40, 0xD0, 0x40,
+0x06, 0x50, 0x40, 0x01, 0x40, 0xF0, 0xE0, 0x20, 0xE0, 0x60, 0xC0, 0x2C, 0xE0, 0xC0, 0x60, 0xC0,
+0xE0, 0x2F, 0x0C, 0xE0, 0x20, 0xC0, 0x60, 0xC0, 0xE1, 0x20, 0xE0, 0xC0, 0x70, 0x30, 0x80, 0xB0,
+0xA0, 0x0F, 0x0B, 0x0F, 0x0B, 0xD0, 0x90, 0x01, 0xD0, 0x01, 0xB0, 0x40, 0x90, 0xB0, 0x0F, 0x09,
+0x30, 0x10, 0x70, 0xE1, 0x20, 0xC0, 0x60, 0xC0, 0xE1, 0x2D, 0xC0, 0x60, 0xE0, 0x23, 0x60, 0xC0,
+0x2F, 0x00, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2C, 0x60, 0xC0, 0xE0, 0x28, 0xE0, 0xC1, 0x28, 0xE0,
+0x60, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x10, 0x90, 0x01, 0x51, 0x00, 0x80, 0xA0, 0x80, 0x40, 0x03,
+0x30, 0x50, 0x04, 0x90, 0x06, 0x70, 0x40, 0x05, 0x90, 0x10, 0x90, 0x00, 0xA0, 0x03, 0xB0, 0xA0,
+0x02, 0xB0, 0x50, 0x0C, 0x50, 0xB0, 0x05, 0x90, 0xA0, 0x01, 0x40, 0x30, 0x01, 0x40, 0x08, 0x70,
+0x80, 0x05, 0x40, 0x05, 0xB0, 0x80, 0xB0, 0x81, 0x09, 0x40, 0x0B, 0x90, 0x50, 0x02, 0x32, 0x07,
+0x40, 0x50, 0x01, 0x50, 0xA0, 0x50, 0x91, 0x30, 0x09, 0x91, 0xA0, 0xE1, 0x20, 0xC0, 0x60, 0xE0,
+0x2D, 0xE0, 0x20, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x0E, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0xA0, 0xB0,
+0x00, 0x50, 0x70, 0x40, 0x0F, 0x0B, 0x0F, 0x0B, 0x80, 0xB0, 0x01, 0x40, 0xA0, 0x91, 0x0F, 0x0C,
+0xB0, 0x80, 0x10, 0xE0, 0xC0, 0x60, 0xC0, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0xE1, 0xC0, 0x60, 0x21,
+0xE0, 0x2D, 0xE0, 0xC0, 0x60, 0x2E, 0x60, 0x2A, 0xE0, 0xC0, 0x60, 0xE0, 0x27, 0xE0, 0xC1, 0xE0,
+0x20, 0xC0, 0x60, 0xE0, 0x60, 0xA0, 0x01, 0x40, 0x01, 0x30, 0x10, 0x40, 0x70, 0x50, 0x01, 0x40,
+0x70, 0xA0, 0x04, 0x40, 0x06, 0x80, 0x90, 0x02, 0x40, 0x01, 0x50, 0x90, 0x30, 0x00, 0x40, 0x80,
+0x02, 0xA0, 0xB0, 0x02, 0xB0, 0x50, 0x0C, 0xB0, 0x50, 0x05, 0x40, 0x90, 0x02, 0x40, 0xA0, 0x50,
+0xB0, 0x50, 0x07, 0x30, 0x50, 0x05, 0xB0, 0x50, 0x03, 0x90, 0x40, 0x02, 0x30, 0x50, 0x08, 0xB0,
+0x40, 0x0B, 0x90, 0x50, 0x02, 0x50, 0x30, 0xB0, 0x07, 0x91, 0x00, 0x70, 0x02, 0xB0, 0x30, 0x09,
+0x50, 0xA0, 0xC0, 0xE0, 0x21, 0x60, 0x2F, 0x03, 0xC0, 0x61, 0xE1, 0x2F, 0x0C, 0xE0, 0x20, 0xC0,
+0x61, 0xA0, 0x02, 0xA0, 0x0F, 0x0C, 0x0F, 0x0C, 0xA0, 0x00, 0x40, 0x30, 0x10, 0x0F, 0x10, 0x30,
+0xF0, 0x60, 0xE0, 0x2F, 0x04, 0xE0, 0x60, 0xE0, 0x61, 0x2F, 0x02, 0xC0, 0x60, 0xE0, 0x2C, 0xE0,
+0x60, 0x20, 0xE0, 0x29, 0xC0, 0x60, 0x29, 0xC0, 0x60, 0x20, 0xE0, 0x21, 0xE0, 0x61, 0x11, 0x50,
+0x02, 0xD0, 0xB0, 0x00, 0xB0, 0x80, 0x01, 0x80, 0x30, 0x90, 0x03, 0xB1, 0x07, 0x30, 0x00, 0x50,
+0x11, 0x40, 0x00, 0x50, 0x10, 0x90, 0x01, 0x30, 0x01, 0xA0, 0x80, 0x03, 0xB0, 0x50, 0x0D, 0x40,
+0x04, 0x40, 0xD0, 0x05, 0x30, 0x50, 0x40, 0x04, 0xB0, 0x40, 0x70, 0x40, 0x07, 0x40, 0x01, 0xB0,
+0x40, 0xB0, 0x03, 0xB0, 0x30, 0xA0, 0x40, 0x07, 0x50, 0x90, 0x0B, 0x90, 0x50, 0x02, 0x30, 0x10,
+0xA0, 0x30, 0xA0, 0x30, 0x50, 0x03, 0x40, 0x30, 0x50, 0x02, 0x30, 0xB0, 0x08, 0xB0, 0x70, 0xE0,
+0xC0, 0x60, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x02, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x0D, 0xE1,
+0xA1, 0x30, 0xB0, 0x50, 0x80, 0x0F, 0x0C, 0x0F, 0x0C, 0x80, 0x70, 0x40, 0x00, 0x40, 0x30, 0x0F,
+0x0E, 0x50, 0x70, 0xA0, 0xE1, 0x2F, 0x04, 0xE0, 0xC0, 0xF0, 0xC0, 0xE0, 0x2F, 0x01, 0x61, 0xE1,
+0x2C, 0x60, 0x20, 0xE0, 0x2A, 0x60, 0x2A, 0x60, 0x25, 0xE0, 0xC0, 0x60, 0x70, 0x80, 0x00, 0x90,
+0x70, 0x50, 0x01, 0xB0, 0x30, 0x00, 0x80, 0x30, 0x40, 0x04, 0x40, 0x70, 0x07, 0xA0, 0x02, 0x80,
+0x10, 0x90, 0xA1, 0x30, 0x01, 0x30, 0x01, 0xA0, 0x04, 0xB0, 0x50, 0x0D, 0x40, 0x04, 0x70, 0x07,
+0xA0, 0x50, 0x00, 0x50, 0xB0, 0x50, 0xA0, 0x30, 0x90, 0x0A, 0x41, 0x50, 0x06, 0x50, 0xB0, 0xA0,
+0x50, 0x07, 0x51, 0x0B, 0x40, 0x80, 0xA0, 0x30, 0x50, 0x30, 0x70, 0x01, 0xB0, 0x80, 0xA0, 0x30,
+0xA1, 0x80, 0x90, 0x40, 0x01, 0xB0, 0x30, 0x08, 0xB0, 0x70, 0xE3, 0x61, 0xE0, 0x2F, 0x07, 0xC0,
+0x60, 0x2F, 0x0D, 0xE0, 0xC0, 0xA0, 0x00, 0xB0, 0x30, 0xD0, 0x0F, 0x0D, 0x0F, 0x0D, 0x30, 0x02,
+0xD0, 0x0F, 0x0C, 0x50, 0x40, 0x00, 0x11, 0x90, 0xE1, 0x2F, 0x03, 0x60, 0xC0, 0x60, 0xC0, 0x2F,
+0x01, 0x60, 0xC0, 0xE0, 0x2D, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0xC0, 0x26, 0xE1,
+0x60, 0xF0, 0x70, 0x30, 0x03, 0x40, 0x70, 0xA0, 0x31, 0x05, 0x30, 0xD0, 0x06, 0xA0, 0x50, 0x03,
+0xA0, 0x70, 0xD0, 0x80, 0xA0, 0x01, 0x30, 0x01, 0xA0, 0x04, 0xB0, 0x50, 0x0D, 0x90, 0x03, 0x50,
+0x30, 0x07, 0x80, 0xA0, 0x40, 0x70, 0xA0, 0x30, 0x0C, 0x50, 0x80, 0xB0, 0x08, 0x40, 0xB0, 0x10,
+0x40, 0xB0, 0x06, 0x90, 0xB0, 0x0A, 0xA0, 0x90, 0x50, 0x01, 0x31, 0xB0, 0x03, 0xB0, 0x04, 0x40,
+0xB0, 0x00, 0x30, 0x08, 0xA0, 0xC0, 0xE0, 0x20, 0xE1, 0x60, 0xC0, 0x60, 0x2F, 0x09, 0x61, 0x2F,
+0x0B, 0xE0, 0xF0, 0x90, 0x01, 0x50, 0x80, 0x0F, 0x0D, 0x0F, 0x0D, 0x30, 0xB0, 0x00, 0x40, 0x10,
+0x80, 0x0F, 0x09, 0xB0, 0x40, 0x50, 0x00, 0xB0, 0x12, 0x71, 0xE1, 0x2F, 0x00, 0x60, 0xC0, 0xE1,
+0x60, 0x20, 0xE0, 0x2D, 0x60, 0xC0, 0xE0, 0x2D, 0x60, 0xC0, 0x20, 0xE0, 0x27, 0xE1, 0x60, 0xC0,
+0xE0, 0x27, 0xE0, 0xC0, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0xE0, 0x60, 0xF0, 0xB0, 0x03, 0xB2, 0x80,
+0x04, 0xB0, 0x11, 0x05, 0x50, 0x80, 0x04, 0xB0, 0xA0, 0x10, 0x31, 0x01, 0x30, 0x01, 0xA0, 0x04,
+0xB0, 0x50, 0x0D, 0x50, 0xB0, 0x02, 0x30, 0x50, 0x07, 0xA0, 0x81, 0x0D, 0x50, 0x40, 0xB0, 0x00,
+0x40, 0x08, 0xB0, 0x90, 0x00, 0x40, 0xA0, 0x07, 0x40, 0x09, 0x80, 0x70, 0x00, 0x90, 0x50, 0x00,
+0x31, 0x50, 0x0A, 0x90, 0x50, 0x30, 0x07, 0x40, 0xF0, 0xE1, 0x20, 0xE0, 0x60, 0xC0, 0xE0, 0xC0,
+0x60, 0xC0, 0xE0, 0x2F, 0x06, 0xE0, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0x2F, 0x07, 0xE0, 0xD0, 0x30,
+0xB0, 0x00, 0x30, 0xB0, 0x0F, 0x0D, 0x0F, 0x0D, 0xB0, 0xA1, 0x40, 0x00, 0xD0, 0x0F, 0x08, 0x91,
+0x02, 0xA0, 0x30, 0x90, 0x00, 0xB0, 0x50, 0x70, 0xC0, 0xE0, 0x2C, 0xC0, 0x60, 0xE1, 0x22, 0x60,
+0xE0, 0x2C, 0x60, 0xE1, 0x2C, 0xE0, 0x60, 0x2B, 0xE0, 0xC0, 0x60, 0xE0, 0x27, 0xE1, 0x60, 0xE0,
+0x28, 0x60, 0x21, 0xE0, 0xC0, 0xA0, 0x90, 0x04, 0x30, 0x50, 0x04, 0x91, 0x10, 0x05, 0x30, 0x50,
+0x04, 0x90, 0x80, 0xD1, 0x30, 0x01, 0x30, 0x01, 0xA0, 0x04, 0xB0, 0x50, 0x0D, 0x50, 0xB0, 0x01,
+0xB0, 0xA0, 0x07, 0x50, 0x80, 0x00, 0x50, 0xB0, 0x0A, 0x50, 0x40, 0x50, 0x02, 0x50, 0xB0, 0x08,
+0x50, 0xB0, 0x00, 0x80, 0x30, 0x04, 0xB1, 0x00, 0x40, 0x06, 0x90, 0x80, 0x30, 0x40, 0xA0, 0x00,
+0x90, 0x50, 0x00, 0xD0, 0x70, 0xB0, 0x0A, 0x50, 0xA0, 0x06, 0xB0, 0x70, 0xE1, 0x21, 0xC0, 0x60,
+0x22, 0xE0, 0xC0, 0x60, 0x2F, 0x07, 0xE1, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x05, 0xE0, 0xF0, 0x50,
+0xB0, 0x30, 0xA0, 0x80, 0x0F, 0x0E, 0x0F, 0x0E, 0x30, 0xB0, 0x01, 0x81, 0x0F, 0x05, 0x90, 0x40,
+0x0A, 0xB0, 0x70, 0xC0, 0xE1, 0x27, 0xE1, 0x60, 0xC0, 0x25, 0xC0, 0x60, 0xE0, 0x29, 0xC0, 0x60,
+0xE1, 0x2D, 0x60, 0x2B, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x28, 0xE0, 0x60, 0xC0, 0x22,
+0xE0, 0xC0, 0xA0, 0x30, 0x90, 0xB0, 0x01, 0xA1, 0xB0, 0x02, 0xB0, 0x90, 0x06, 0x50, 0x30, 0x05,
+0x90, 0x50, 0xA1, 0x30, 0x00, 0xB0, 0x30, 0x01, 0xA0, 0x04, 0xB0, 0x90, 0x0C, 0x50, 0x30, 0x70,
+0x30, 0x00, 0x30, 0x40, 0x07, 0xA0, 0x01, 0xB0, 0x90, 0x08, 0x50, 0x40, 0x50, 0x05, 0x40, 0x06,
+0xA2, 0x30, 0xA0, 0x40, 0x31, 0x01, 0x41, 0xA1, 0x40, 0x00, 0x90, 0x01, 0xB1, 0x80, 0xA0, 0x80,
+0x40, 0x01, 0x30, 0xB0, 0x00, 0x90, 0xB1, 0xD0, 0x10, 0x0B, 0x80, 0x40, 0x05, 0x70, 0xE1, 0x22,
+0x60, 0x24, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x06, 0xE1, 0x61, 0xC0, 0xE0, 0x2F, 0x03, 0xE0,
+0xA0, 0x02, 0xA0, 0xB0, 0x0F, 0x0E, 0x0F, 0x0E, 0xB0, 0x30, 0x01, 0x40, 0x10, 0x0F, 0x03, 0xB0,
+0x40, 0xB0, 0x0C, 0xB0, 0x71, 0xC0, 0xE1, 0x25, 0xC0, 0x60, 0xC0, 0x25, 0xE0, 0x20, 0x60, 0xC0,
+0x27, 0xE0, 0x60, 0xC0, 0x20, 0xE0, 0x2D, 0x60, 0xC0, 0x2A, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xE0,
+0xC1, 0x29, 0x60, 0xE0, 0x24, 0xE0, 0xF1, 0x40, 0x90, 0xB0, 0x00, 0xB0, 0x70, 0x02, 0x90, 0xB0,
+0x06, 0x41, 0x05, 0x80, 0x70, 0x10, 0x70, 0x30, 0x01, 0x30, 0x01, 0xA0, 0x00, 0xB1, 0x01, 0xB0,
+0x50, 0x0B, 0xB0, 0x70, 0x50, 0x41, 0x31, 0x07, 0x41, 0x02, 0x40, 0x05, 0xB0, 0x50, 0x40, 0x50,
+0x07, 0xB0, 0x50, 0x02, 0x81, 0xA0, 0x40, 0x01, 0xB0, 0x90, 0x01, 0x40, 0x70, 0xA0, 0x80, 0x90,
+0xB0, 0x00, 0x80, 0x30, 0x81, 0xA0, 0x30, 0x70, 0x40, 0x04, 0xB0, 0x70, 0xB0, 0x00, 0x90, 0xB0,
+0x00, 0x70, 0x0B, 0x42, 0x03, 0x90, 0xF0, 0xE0, 0x21, 0xE0, 0x60, 0x20, 0xE0, 0x26, 0x61, 0x2F,
+0x06, 0xF0, 0xE1, 0xC0, 0x61, 0x20, 0xE0, 0x2F, 0x00, 0xE0, 0xF0, 0x70, 0xB0, 0x00, 0xB0, 0x30,
+0x0F, 0x0F, 0x0F, 0x0F, 0x30, 0x40, 0xA0, 0x90, 0x81, 0x0F, 0x01, 0x40, 0x50, 0x0F, 0x01, 0x90,
+0x70, 0xA0, 0xC1, 0xE0, 0x22, 0x61, 0x29, 0xE0, 0x60, 0x20, 0xE0, 0x23, 0xE1, 0x60, 0xC0, 0xE0,
+0x2E, 0x60, 0x20, 0xE0, 0x29, 0xE1, 0x60, 0x20, 0xE0, 0x27, 0xE0, 0x20, 0x60, 0x28, 0xE0, 0x60,
+0x26, 0xE1, 0x30, 0x90, 0x00, 0x90, 0x40, 0xB0, 0x50, 0x30, 0x01, 0x40, 0x07, 0x50, 0x80, 0x05,
+0x51, 0x10, 0x50, 0x81, 0x00, 0xD0, 0x80, 0x70, 0x10, 0x30, 0x11, 0xA0, 0x80, 0xB0, 0x50, 0x0A,
+0x50, 0x70, 0x01, 0x40, 0x00, 0x40, 0x07, 0x90, 0x70, 0x03, 0x51, 0x02, 0xB0, 0x41, 0xB0, 0x00,
+0x40, 0x08, 0x40, 0x00, 0x40, 0xA0, 0x90, 0x50, 0xB0, 0x03, 0x51, 0x02, 0xB0, 0x04, 0xB0, 0xA1,
+0xB0, 0x08, 0xB0, 0xA0, 0x01, 0x90, 0xB0, 0x0C, 0x50, 0x80, 0x00, 0x40, 0xB0, 0x01, 0x70, 0xE0,
+0x22, 0x60, 0xC0, 0x28, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0xA0, 0xC0, 0xE0, 0x22,
+0xC0, 0x60, 0xC0, 0xE1, 0x2E, 0xA0, 0xB0, 0x31, 0xA0, 0x0F, 0x10, 0x0F, 0x0F, 0xB0, 0x70, 0x02,
+0x10, 0x0E, 0x41, 0x0F, 0x04, 0xB0, 0x90, 0xF0, 0xA1, 0xE0, 0xC0, 0x60, 0xC0, 0x2C, 0x60, 0x23,
+0xE0, 0x20, 0x60, 0xC0, 0x20, 0xE0, 0x2C, 0xE0, 0x60, 0xC0, 0xE0, 0x2B, 0x60, 0xE0, 0x29, 0xE0,
+0x60, 0x28, 0xE0, 0xC0, 0x60, 0x27, 0xE0, 0x60, 0xA0, 0x90, 0x01, 0x50, 0x90, 0x30, 0xB0, 0x00,
+0x90, 0x08, 0x70, 0x05, 0x90, 0x00, 0x50, 0x10, 0x80, 0x71, 0xF0, 0x60, 0xC0, 0xE4, 0x60, 0x70,
+0x90, 0x09, 0x90, 0xA0, 0x02, 0x90, 0x0A, 0x30, 0x04, 0x90, 0x00, 0x50, 0x40, 0x90, 0x02, 0x80,
+0x30, 0x80, 0xB0, 0x05, 0x40, 0xA0, 0x30, 0x40, 0x08, 0x40, 0xB0, 0x08, 0x50, 0x80, 0x90, 0xB0,
+0x08, 0x30, 0xB0, 0x01, 0x90, 0x50, 0x0C, 0x30, 0x01, 0x40, 0xB0, 0xF0, 0x60, 0xE0, 0x21, 0xC1,
+0x2B, 0xE0, 0x61, 0xE0, 0x2F, 0x01, 0xF0, 0xC0, 0x24, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x2B, 0xE0,
+0xF0, 0x90, 0x01, 0x50, 0x30, 0x0F, 0x10, 0x0F, 0x10, 0x30, 0xB0, 0x01, 0xA0, 0x30, 0x0B, 0x50,
+0x40, 0x0F, 0x0A, 0x50, 0xA0, 0x60, 0xE1, 0x2C, 0xC0, 0x60, 0x21, 0xE0, 0xC0, 0x60, 0xE2, 0x2D,
+0x60, 0x20, 0xE1, 0x2A, 0x60, 0xC0, 0x2A, 0x60, 0xC0, 0x29, 0x60, 0xE0, 0x27, 0xC1, 0xE0, 0xA1,
+0xB0, 0x00, 0x40, 0x80, 0x50, 0x80, 0x51, 0x90, 0x32, 0x71, 0x80, 0x50, 0x80, 0xA0, 0x04, 0x40,
+0x80, 0xA0, 0xF0, 0x70, 0x60, 0xE5, 0x20, 0xE0, 0x20, 0xE0, 0xC0, 0xD0, 0xA0, 0x08, 0xA0, 0xB0,
+0x02, 0x51, 0x09, 0x70, 0xB0, 0x02, 0xB0, 0x80, 0x40, 0xB0, 0x03, 0x81, 0x00, 0x40, 0x30, 0x80,
+0x40, 0xB1, 0x50, 0xB0, 0x70, 0x00, 0x90, 0x0A, 0x40, 0x08, 0xB0, 0x30, 0x00, 0x40, 0x08, 0x50,
+0x80, 0x02, 0x90, 0x50, 0x0B, 0xA0, 0x02, 0x90, 0xA0, 0xE0, 0x21, 0xC0, 0x60, 0xE0, 0x2D, 0xC0,
+0x60, 0x20, 0xE0, 0x2F, 0x09, 0x61, 0xC0, 0xE0, 0x29, 0xC0, 0xD0, 0xB0, 0x01, 0x30, 0xB0, 0x30,
+0x80, 0x0F, 0x0E, 0x0F, 0x10, 0xB0, 0x30, 0x40, 0xA0, 0xB0, 0xD0, 0xB0, 0x08, 0xB0, 0x40, 0x50,
+0x0F, 0x0A, 0xB0, 0x91, 0x70, 0xE1, 0x2C, 0xE0, 0xC0, 0x60, 0xE0, 0xC0, 0x60, 0xE1, 0x2E, 0x60,
+0x20, 0xE0, 0x2B, 0xC1, 0x2B, 0x60, 0xE0, 0x27, 0xE0, 0xC1, 0x27, 0xE0, 0x60, 0x20, 0xE1, 0x60,
+0xA0, 0x80, 0xF0, 0x50, 0x90, 0xF0, 0x70, 0xF3, 0x80, 0x60, 0x80, 0x30, 0x70, 0xD0, 0xA0, 0xB0,
+0x00, 0x50, 0x60, 0xA0, 0xF0, 0x60, 0xE3, 0x28, 0xE1, 0xF0, 0x10, 0x50, 0x07, 0xA0, 0xB0, 0x02,
+0xB0, 0x50, 0x09, 0x41, 0xB0, 0x90, 0x40, 0x51, 0xB0, 0x03, 0x50, 0x30, 0x01, 0x90, 0xB0, 0x80,
+0x40, 0x30, 0x81, 0x30, 0x50, 0x01, 0x40, 0x09, 0xB0, 0x90, 0x07, 0xB0, 0xA0, 0x31, 0x90, 0x01,
+0x80, 0x50, 0x90, 0x02, 0x80, 0x50, 0x03, 0x90, 0x50, 0x0A, 0x30, 0xB0, 0x01, 0x30, 0x61, 0xE0,
+0x20, 0x60, 0xE0, 0x2F, 0x01, 0x60, 0xC0, 0xE0, 0x2F, 0x0A, 0x61, 0x28, 0xE0, 0xA0, 0x90, 0x80,
+0x30, 0x40, 0x80, 0x50, 0x41, 0x90, 0x0F, 0x0D, 0x0F, 0x11, 0x30, 0x80, 0x01, 0x40, 0x30, 0x06,
+0xB0, 0x40, 0x90, 0x0F, 0x0B, 0x50, 0x40, 0x01, 0x90, 0xA0, 0xE0, 0x2D, 0xE0, 0x62, 0xE0, 0x2F,
+0x00, 0x60, 0xC0, 0xE1, 0x2A, 0xC1, 0x2A, 0xE0, 0x60, 0x2A, 0x60, 0x27, 0xE0, 0xC1, 0xE0, 0x21,
+0xE1, 0x60, 0xD0, 0xA0, 0xF0, 0x60, 0xE2, 0xC1, 0x60, 0xC0, 0xE2, 0xC0, 0x60, 0xA0, 0x70, 0xA0,
+0x60, 0xC1, 0xE0, 0x21, 0xE0, 0x2A, 0xC0, 0x60, 0x10, 0x06, 0x40, 0x30, 0x80, 0x03, 0xB0, 0x90,
+0x08, 0xB0, 0x40, 0x30, 0x50, 0xB0, 0x02, 0x40, 0x03, 0xA0, 0x50, 0x01, 0xB0, 0x90, 0x08, 0x51,
+0x09, 0x90, 0xB0, 0x07, 0xB0, 0x10, 0x30, 0x00, 0x40, 0x70, 0x11, 0xA0, 0x01, 0x50, 0x70, 0x05,
+0x40, 0xB0, 0x09, 0x80, 0x50, 0x00, 0x40, 0x30, 0xE0, 0xC0, 0x61, 0xE0, 0x2F, 0x02, 0xE0, 0xC0,
+0x60, 0xE0, 0x2F, 0x0A, 0xC0, 0x60, 0xC0, 0xE1, 0x23, 0xE0, 0x60, 0xF0, 0x01, 0xB0, 0xD0, 0x01,
+0x30, 0x80, 0x0F, 0x0E, 0x0F, 0x0E, 0xB0, 0x80, 0x50, 0x00, 0x30, 0x02, 0x10, 0xB0, 0x04, 0x90,
+0x40, 0x0F, 0x0C, 0x40, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x2B, 0xE1, 0x61, 0x2F, 0x01, 0x60, 0x20,
+0xE0, 0x2A, 0xE0, 0x20, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0xC0, 0x29, 0x60, 0xC0, 0x27, 0xE0, 0x60,
+0x25, 0xE2, 0xC0, 0xE1, 0x23, 0xE0, 0xC0, 0x62, 0xC0, 0x20, 0xE3, 0xC1, 0xE0, 0x2D, 0xC1, 0xF0,
+0x80, 0x00, 0xB0, 0x11, 0xA0, 0xF0, 0xA0, 0x11, 0x04, 0x90, 0x04, 0x50, 0x90, 0x40, 0x80, 0x50,
+0x00, 0xB0, 0xD0, 0x03, 0x90, 0x03, 0x80, 0x50, 0x02, 0x40, 0x09, 0x40, 0x0A, 0x40, 0x07, 0x70,
+0x10, 0x90, 0x00, 0xB0, 0x30, 0xA0, 0x30, 0x50, 0x01, 0x30, 0xB0, 0x06, 0x40, 0xB0, 0x08, 0x50,
+0xA0, 0x00, 0xA0, 0xC0, 0xE1, 0x61, 0xC0, 0xE0, 0x2F, 0x02, 0xE0, 0x20, 0x60, 0xC0, 0x2F, 0x0A,
+0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x22, 0xE0, 0xD0, 0x90, 0x01, 0x41, 0x0F, 0x12, 0x0F, 0x0E, 0xB0,
+0x80, 0x70, 0x90, 0x41, 0x80, 0xA0, 0x90, 0xD0, 0x02, 0x50, 0x40, 0xB0, 0x0F, 0x0B, 0x50, 0x40,
+0x06, 0xF1, 0xE0, 0x29, 0xE1, 0x60, 0xC0, 0xE0, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0x2E, 0x60, 0xE0,
+0x29, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xC0, 0x60, 0x29, 0x60, 0x28, 0x60, 0xE0, 0x26, 0x60, 0xE1,
+0x20, 0x63, 0xC0, 0x60, 0xC0, 0xE4, 0x21, 0xE0, 0x26, 0xC1, 0xE0, 0xF0, 0xD1, 0x71, 0xF0, 0xC0,
+0xE1, 0xF0, 0x80, 0x40, 0x50, 0x01, 0x40, 0xB0, 0x91, 0x40, 0x90, 0x50, 0x01, 0x40, 0x02, 0xD0,
+0x03, 0x80, 0x30, 0xA0, 0x30, 0xA0, 0xD0, 0x90, 0x03, 0x40, 0x08, 0xB0, 0x90, 0x09, 0xB0, 0x40,
+0x05, 0x80, 0x10, 0x90, 0x02, 0x51, 0x02, 0x90, 0x30, 0x08, 0x90, 0x50, 0x08, 0xB0, 0xA0, 0x70,
+0xE1, 0x60, 0xC0, 0xE0, 0x60, 0xC0, 0x2F, 0x03, 0xE1, 0xC0, 0x60, 0x2F, 0x0C, 0x61, 0x21, 0xE0,
+0x60, 0xF0, 0x80, 0xA0, 0xB0, 0xA0, 0xB0, 0xD0, 0x70, 0x10, 0x80, 0x0F, 0x0E, 0x0F, 0x0B, 0x51,
+0x02, 0xB0, 0x70, 0x00, 0xD0, 0x90, 0x01, 0x30, 0x90, 0x00, 0x40, 0x50, 0x0F, 0x0C, 0x90, 0x50,
+0x08, 0xA0, 0xE0, 0x29, 0xC0, 0x60, 0x21, 0xE0, 0xC0, 0x60, 0x2C, 0x60, 0xC0, 0xE0, 0x2B, 0xE0,
+0x60, 0x2B, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0x29, 0x60, 0x28, 0x60, 0xC0, 0x27, 0x60, 0xE1, 0x20,
+0xE2, 0xC1, 0x64, 0xC2, 0x29, 0xC0, 0xE7, 0xC0, 0xE0, 0x60, 0xF0, 0xD0, 0x30, 0x91, 0x40, 0x50,
+0xB0, 0x05, 0x50, 0xB0, 0x01, 0xB0, 0xA0, 0xB0, 0x00, 0x30, 0x90, 0x40, 0x02, 0x80, 0x90, 0x03,
+0x40, 0x09, 0x90, 0xB0, 0x09, 0x51, 0x04, 0xD0, 0xA0, 0x04, 0x51, 0x70, 0x30, 0xD0, 0x09, 0x50,
+0x40, 0x50, 0x08, 0x30, 0x60, 0xE0, 0xC1, 0x21, 0xE0, 0x60, 0xC0, 0x2F, 0x05, 0xC0, 0x60, 0xC0,
+0x2F, 0x0A, 0xE0, 0xC0, 0x61, 0xE0, 0x70, 0x02, 0x70, 0x50, 0x80, 0x40, 0x00, 0xB0, 0x30, 0x70,
+0x0F, 0x0D, 0x0F, 0x0A, 0xB0, 0x10, 0x71, 0x80, 0x50, 0x80, 0xA0, 0x00, 0x41, 0x01, 0xA0, 0x10,
+0x50, 0x0F, 0x0C, 0xB0, 0x40, 0xB0, 0x09, 0x90, 0xA0, 0xE0, 0x27, 0xC0, 0x60, 0x24, 0xC0, 0x60,
+0xE0, 0x29, 0x60, 0xC0, 0xE0, 0x2C, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0x2A, 0xC0, 0x60, 0xE0, 0x28,
+0x60, 0xE0, 0x26, 0xE0, 0x60, 0xE0, 0x27, 0x60, 0xE0, 0x25, 0xE0, 0x60, 0xE1, 0x21, 0xC1, 0x6F,
+0x05, 0xA1, 0xC0, 0x90, 0x10, 0x01, 0xB1, 0x06, 0xB0, 0x90, 0x02, 0xB0, 0xA0, 0x40, 0x30, 0x00,
+0x50, 0xB0, 0x01, 0xA0, 0x04, 0xB0, 0x90, 0x09, 0x40, 0x0A, 0x40, 0x03, 0x70, 0x50, 0x05, 0xA0,
+0x30, 0x10, 0x40, 0x70, 0xA0, 0x10, 0x80, 0x05, 0xB0, 0x10, 0x00, 0x90, 0x50, 0x05, 0xB0, 0x10,
+0xF0, 0xE0, 0xC0, 0x60, 0x23, 0xE0, 0x61, 0x21, 0xE0, 0x2E, 0xE0, 0x22, 0x60, 0xC0, 0x20, 0xE0,
+0x2F, 0x09, 0xE0, 0xC0, 0xF0, 0x10, 0x50, 0x01, 0xA0, 0x00, 0x80, 0x30, 0x02, 0x40, 0xA0, 0x0F,
+0x0C, 0x0F, 0x0B, 0x30, 0x40, 0x00, 0x80, 0x70, 0x30, 0x02, 0xA0, 0x80, 0x12, 0x40, 0x0F, 0x0B,
+0x90, 0x40, 0x0C, 0xA0, 0x60, 0xE0, 0x24, 0xE0, 0x61, 0xE0, 0x24, 0xE0, 0xC0, 0x60, 0xE0, 0x26,
+0xE0, 0x60, 0x20, 0xE0, 0x20, 0xE0, 0x2A, 0xC1, 0x2A, 0xE0, 0xC0, 0x60, 0xE0, 0x29, 0x60, 0xE0,
+0x28, 0xC1, 0xE0, 0x27, 0x60, 0xE0, 0x25, 0xE0, 0xC1, 0xE0, 0x26, 0x60, 0x25, 0xE1, 0x60, 0xE6,
+0xC0, 0x60, 0xE0, 0x20, 0xE2, 0x20, 0xE0, 0xC1, 0xF1, 0xE1, 0xF0, 0x90, 0x00, 0xB0, 0x90, 0x07,
+0x40, 0x04, 0x70, 0x30, 0x00, 0xB0, 0x90, 0x00, 0x80, 0x40, 0x05, 0x40, 0xA0, 0x50, 0x03, 0x80,
+0xB0, 0x01, 0x90, 0xB0, 0x0A, 0x40, 0x02, 0xA0, 0x05, 0xA0, 0x30, 0x50, 0x90, 0x00, 0x80, 0x10,
+0xA0, 0x0A, 0x90, 0x50, 0x04, 0x50, 0xD0, 0xE0, 0xC0, 0x60, 0xE0, 0x24, 0xE0, 0xC0, 0x60, 0xE0,
+0x2F, 0x04, 0xE0, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x08, 0xE1, 0x70, 0x11, 0xA0, 0x30, 0x50, 0x01,
+0xA0, 0x70, 0x02, 0xD0, 0x0F, 0x0C, 0x0F, 0x0C, 0x10, 0xB0, 0x05, 0x50, 0x10, 0x70, 0xB0, 0x00,
+0xD0, 0xB0, 0x0F, 0x08, 0xB0, 0x40, 0xB0, 0x0E, 0xA0, 0x60, 0xE0, 0x21, 0xE1, 0x60, 0xC0, 0x28,
+0xC0, 0x60, 0xE1, 0x22, 0xE0, 0x20, 0x60, 0x2D, 0xE0, 0xC1, 0x2B, 0xC0, 0x60, 0xE0, 0x28, 0xE0,
+0xC1, 0xE0, 0x27, 0xE0, 0x60, 0xE0, 0x26, 0xE0, 0x60, 0xC0, 0xE0, 0x25, 0xE0, 0x60, 0x28, 0x60,
+0xE0, 0x26, 0x60, 0xE0, 0x24, 0xE0, 0xC1, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0xC1, 0xE1, 0x20, 0xE0,
+0xA0, 0x02, 0x90, 0x07, 0x90, 0x04, 0x70, 0x80, 0x01, 0x40, 0x00, 0x30, 0x02, 0x50, 0x30, 0x50,
+0x00, 0x50, 0x40, 0x04, 0xB1, 0x02, 0x40, 0x0A, 0x51, 0x01, 0x30, 0x04, 0x80, 0x10, 0x02, 0x90,
+0x80, 0x70, 0x0C, 0x90, 0x50, 0x02, 0x90, 0x70, 0xC0, 0xE0, 0x60, 0xE0, 0x28, 0x60, 0x2F, 0x05,
+0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x07, 0xE0, 0xA0, 0x50, 0x00, 0x30, 0x10, 0xA0, 0x00, 0x70,
+0xA0, 0x00, 0x40, 0xD0, 0x71, 0x40, 0x0F, 0x0C, 0x0F, 0x0C, 0x40, 0x51, 0x70, 0x30, 0x81, 0x40,
+0xB0, 0x30, 0xB0, 0x01, 0x80, 0x70, 0x0F, 0x07, 0x50, 0x40, 0x0F, 0x02, 0xA0, 0xF0, 0xE2, 0x60,
+0xC0, 0xE0, 0x29, 0xC1, 0x21, 0xE0, 0x21, 0x60, 0x2D, 0xE0, 0xC0, 0x60, 0x2C, 0x60, 0xC0, 0x28,
+0xE0, 0x20, 0x60, 0xE0, 0x28, 0x60, 0xC0, 0x27, 0xE0, 0x60, 0x28, 0x60, 0xE0, 0x26, 0xC1, 0x27,
+0x60, 0xE0, 0x25, 0xC0, 0x60, 0x27, 0x60, 0xE0, 0x21, 0xE0, 0x70, 0x52, 0x40, 0xA0, 0x31, 0xA0,
+0x30, 0x70, 0xA0, 0x31, 0xA1, 0x30, 0x80, 0x40, 0x70, 0x02, 0x50, 0xB0, 0x30, 0x02, 0x10, 0x80,
+0x02, 0x90, 0x09, 0x51, 0x0A, 0x90, 0xB0, 0xA0, 0x70, 0x04, 0x30, 0x50, 0xB0, 0x90, 0x40, 0x31,
+0x10, 0x30, 0x40, 0x50, 0x0A, 0x40, 0x50, 0x01, 0x70, 0xC1, 0x60, 0x29, 0xE0, 0x20, 0x60, 0xC0,
+0x2F, 0x05, 0xE0, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x05, 0x60, 0x70, 0x02, 0xA0, 0xB0, 0xA0, 0x90,
+0x80, 0x70, 0x01, 0xB1, 0x0F, 0x0D, 0x0F, 0x0E, 0xB0, 0x10, 0xB0, 0x50, 0xA0, 0x10, 0x40, 0xB0,
+0x30, 0x00, 0x30, 0x80, 0x70, 0x90, 0x0F, 0x05, 0x40, 0x50, 0x0F, 0x04, 0x80, 0x70, 0xF0, 0x60,
+0xE1, 0x2A, 0xE0, 0x60, 0xC0, 0xE2, 0x60, 0x2F, 0x00, 0x60, 0x2B, 0xE0, 0x60, 0xC0, 0xE0, 0x28,
+0xE0, 0x60, 0xC0, 0x29, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0x27, 0xC1, 0x27, 0x60, 0x27, 0xC1, 0x26,
+0xC0, 0x60, 0x25, 0xE0, 0x20, 0x60, 0x22, 0xE0, 0x70, 0x30, 0x82, 0xA0, 0x03, 0x41, 0x01, 0x50,
+0x00, 0xB0, 0x50, 0x90, 0xA0, 0x03, 0x50, 0xA0, 0x07, 0x51, 0x09, 0x40, 0x0B, 0x80, 0x10, 0x30,
+0x02, 0xB0, 0x40, 0xD0, 0x31, 0x80, 0x50, 0x00, 0x81, 0x00, 0x90, 0x80, 0x31, 0x40, 0x08, 0x90,
+0x50, 0x00, 0x70, 0xE0, 0x60, 0x2D, 0x60, 0xC0, 0xE1, 0x2F, 0x03, 0xE0, 0xC0, 0x60, 0xC0, 0xE1,
+0x2F, 0x02, 0xE0, 0xA0, 0x80, 0xA0, 0xB0, 0x90, 0x80, 0x00, 0x70, 0x01, 0x70, 0xB0, 0x00, 0x50,
+0x0F, 0x0E, 0x0F, 0x0F, 0x40, 0x30, 0x70, 0xA0, 0x02, 0x40, 0xD0, 0x50, 0x01, 0x10, 0x0F, 0x03,
+0xB0, 0x40, 0x0F, 0x07, 0xB0, 0x40, 0xF1, 0xE0, 0x2B, 0xE0, 0x60, 0xC0, 0xE0, 0x60, 0x2E, 0xE0,
+0x60, 0x20, 0xE0, 0x2B, 0x60, 0x2A, 0xC0, 0x60, 0xE0, 0x27, 0xE0, 0xC1, 0x27, 0xE0, 0x60, 0x27,
+0xE0, 0xC1, 0x27, 0x60, 0xE0, 0x26, 0xC1, 0x26, 0xC0, 0x60, 0x25, 0xF0, 0x20, 0x60, 0xE0, 0x20,
+0xE0, 0xC0, 0x70, 0x02, 0x50, 0xA0, 0x03, 0x80, 0x40, 0x80, 0xA0, 0x80, 0x08, 0x90, 0x30, 0x08,
+0x40, 0x09, 0xB0, 0x90, 0x0A, 0xB0, 0x70, 0xB0, 0x00, 0x30, 0xA0, 0x30, 0x90, 0xA0, 0xB0, 0x02,
+0x50, 0x70, 0x50, 0xB0, 0x03, 0xD1, 0x31, 0x40, 0x05, 0x90, 0x40, 0xA0, 0x60, 0xC0, 0x2D, 0xE0,
+0x61, 0xE1, 0x2F, 0x04, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x01, 0xE0, 0xF0, 0x40, 0x01, 0x30, 0x70,
+0x01, 0xD0, 0x50, 0x00, 0x30, 0x91, 0x70, 0x0F, 0x0E, 0x0F, 0x0E, 0xB0, 0xA0, 0x10, 0x90, 0x01,
+0x50, 0xB0, 0x00, 0xA0, 0x02, 0xA0, 0x30, 0x0F, 0x01, 0x91, 0x0F, 0x07, 0x50, 0x90, 0x01, 0xA0,
+0xE0, 0x2C, 0xE0, 0xC0, 0xF0, 0xE1, 0x2C, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0xE1,
+0x27, 0xE0, 0x60, 0x29, 0x60, 0xE0, 0x26, 0xE0, 0x60, 0x28, 0x60, 0xE0, 0x25, 0xE0, 0x60, 0x27,
+0xC1, 0x25, 0xF0, 0xE0, 0x60, 0xE0, 0x20, 0xE0, 0x70, 0x90, 0x02, 0x50, 0x30, 0x03, 0x50, 0x30,
+0xB0, 0x00, 0x30, 0xB0, 0x07, 0xB0, 0x80, 0x08, 0x51, 0x09, 0x90, 0xB0, 0x0A, 0x90, 0xA1, 0x30,
+0xA0, 0x01, 0x30, 0x02, 0x30, 0x10, 0xD0, 0x50, 0x90, 0xB0, 0x02, 0x80, 0x02, 0x90, 0x70, 0x40,
+0x04, 0x40, 0x60, 0xE1, 0x2E, 0xE0, 0xC0, 0x60, 0x2F, 0x06, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2E,
+0xE0, 0x10, 0x02, 0x80, 0x50, 0xB0, 0x03, 0x40, 0x80, 0xD0, 0xB0, 0x0F, 0x0E, 0x0F, 0x0E, 0xB0,
+0x40, 0x50, 0xB0, 0x40, 0xD0, 0xA0, 0x70, 0x40, 0xB0, 0x30, 0x00, 0x30, 0x80, 0xD0, 0xB0, 0x0D,
+0xB0, 0x40, 0xB0, 0x0F, 0x07, 0x90, 0x50, 0x02, 0x30, 0xC0, 0x2D, 0x61, 0xC0, 0xE0, 0x2C, 0x60,
+0xC0, 0x2C, 0x60, 0xC0, 0xE0, 0x28, 0xE0, 0xC1, 0xE0, 0x28, 0xC1, 0x27, 0xE0, 0xC1, 0xE0, 0x27,
+0x60, 0x28, 0x60, 0x26, 0xE0, 0x60, 0x27, 0xC1, 0x27, 0x60, 0xE0, 0x20, 0xE0, 0x30, 0xD0, 0xA1,
+0x31, 0x40, 0x06, 0xB0, 0xA0, 0xB0, 0x08, 0x30, 0x50, 0x08, 0x40, 0x0A, 0x40, 0x09, 0xB0, 0xA0,
+0x30, 0x40, 0x00, 0x30, 0x50, 0x00, 0x70, 0xB2, 0xA0, 0x30, 0xD0, 0x01, 0x40, 0x07, 0x50, 0xA0,
+0x03, 0xB0, 0xA0, 0xC1, 0xE0, 0x2F, 0x00, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x20, 0xE0, 0x2F, 0x04,
+0x61, 0xE0, 0x2C, 0xE0, 0xA0, 0x40, 0xA0, 0x50, 0xB0, 0xA0, 0x00, 0xD0, 0xA0, 0xB0, 0x01, 0xB0,
+0x10, 0x80, 0x0F, 0x0F, 0x0F, 0x11, 0x30, 0x70, 0x50, 0x01, 0x70, 0x00, 0x30, 0xA0, 0x50, 0x00,
+0x50, 0xA0, 0x0C, 0x91, 0x0F, 0x08, 0x40, 0x50, 0x03, 0xF0, 0x60, 0x2A, 0xE0, 0x20, 0x60, 0x20,
+0xE0, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0x2C, 0xC0, 0x60, 0xE0, 0x2A, 0x60, 0x2A, 0x60,
+0x28, 0xE0, 0x60, 0x20, 0xE0, 0x25, 0xE0, 0xC1, 0x26, 0xE0, 0xC1, 0x26, 0xE0, 0x60, 0x27, 0xC1,
+0x26, 0xE0, 0x60, 0x20, 0xE0, 0x20, 0x70, 0x80, 0x03, 0x40, 0x06, 0x70, 0x50, 0x90, 0x07, 0x40,
+0x81, 0x08, 0x90, 0xB0, 0x09, 0x50, 0xB0, 0x08, 0x10, 0x30, 0x00, 0x50, 0x00, 0x90, 0x30, 0x00,
+0xA0, 0x13, 0x40, 0x03, 0x40, 0x01, 0x50, 0x04, 0x40, 0xA0, 0x30, 0x01, 0x40, 0x30, 0xE0, 0x60,
+0xC0, 0xE0, 0x2F, 0x00, 0xE0, 0x20, 0x60, 0xC0, 0x2F, 0x07, 0xC0, 0x60, 0x2B, 0xE0, 0x60, 0xF0,
+0x01, 0x80, 0xD0, 0x01, 0x31, 0xD0, 0x80, 0x01, 0x40, 0x0F, 0x10, 0x0F, 0x10, 0x80, 0x30, 0x02,
+0x40, 0xA0, 0x01, 0xA0, 0x02, 0x70, 0x80, 0x09, 0xB0, 0x40, 0x50, 0x0F, 0x08, 0x40, 0xB0, 0x04,
+0x80, 0xF0, 0x29, 0xE1, 0x60, 0x22, 0xE0, 0x61, 0xE0, 0x27, 0xE0, 0xC0, 0x60, 0x2D, 0x60, 0xE0,
+0x29, 0xE0, 0xC1, 0x28, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0x60, 0xE0, 0x26, 0xE0, 0x60, 0x27, 0xE0,
+0xC1, 0x26, 0xE0, 0x60, 0x27, 0xC1, 0x22, 0xF0, 0x70, 0xE0, 0x21, 0x60, 0xC0, 0x20, 0xC0, 0x10,
+0x70, 0x40, 0x02, 0x40, 0x06, 0xA0, 0x00, 0x40, 0x07, 0x80, 0x90, 0xB0, 0x09, 0x40, 0x0A, 0x40,
+0x07, 0xB0, 0x10, 0xA0, 0x00, 0x30, 0xA0, 0x10, 0x50, 0x00, 0x50, 0x10, 0x00, 0xB0, 0xD0, 0x04,
+0xB0, 0x70, 0x90, 0x10, 0x06, 0x50, 0x30, 0xA0, 0x70, 0x60, 0xE1, 0x60, 0xC0, 0xE0, 0x2F, 0x00,
+0xE1, 0x60, 0xC0, 0x2F, 0x07, 0xE0, 0x60, 0xC0, 0xE0, 0xF0, 0xC0, 0x26, 0xE0, 0xD0, 0x02, 0x90,
+0x80, 0x01, 0x40, 0x50, 0x00, 0x30, 0x10, 0x40, 0x0F, 0x11, 0x0F, 0x10, 0x30, 0x90, 0x01, 0xA0,
+0xD0, 0xB0, 0x80, 0x50, 0x41, 0x00, 0xA0, 0x40, 0xD0, 0xB0, 0x07, 0x50, 0x40, 0x0F, 0x08, 0xB0,
+0x40, 0x06, 0x50, 0xF0, 0xE0, 0x29, 0x60, 0x24, 0xE0, 0xC0, 0x60, 0xE0, 0x25, 0xE0, 0x20, 0x60,
+0x2C, 0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x29, 0xC1, 0xE0, 0x26, 0xE0, 0x60, 0x27,
+0xE0, 0x60, 0x27, 0xE0, 0x60, 0x27, 0xC1, 0xE0, 0x20, 0xE0, 0xF1, 0xE0, 0x21, 0xC1, 0xE0, 0xC0,
+0x70, 0x80, 0x03, 0x90, 0x06, 0x30, 0xA0, 0x40, 0xB0, 0x06, 0x30, 0x10, 0x80, 0x09, 0x90, 0xB0,
+0x09, 0xB0, 0x90, 0x06, 0x90, 0x10, 0x40, 0xB0, 0xA0, 0x40, 0x30, 0x0B, 0xD0, 0x30, 0x50, 0x07,
+0xB0, 0x90, 0x50, 0x30, 0xA0, 0x70, 0xE1, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0xC0, 0x60, 0xE0,
+0x2F, 0x06, 0xE0, 0xC0, 0x60, 0xE1, 0x24, 0xE1, 0xA0, 0x40, 0xA0, 0x40, 0x00, 0xA0, 0x06, 0xB0,
+0x80, 0x0F, 0x11, 0x0F, 0x10, 0xB0, 0x71, 0xD0, 0x80, 0x00, 0x40, 0x90, 0x30, 0x00, 0xA1, 0xB0,
+0x00, 0x50, 0x70, 0x06, 0x90, 0x50, 0x0F, 0x08, 0x50, 0x90, 0x07, 0x50, 0xA0, 0xE0, 0x27, 0xE0,
+0x60, 0x20, 0xE0, 0x25, 0xC0, 0x60, 0x26, 0x60, 0x2D, 0x60, 0xC0, 0x2A, 0xE0, 0x60, 0xC0, 0x28,
+0xE0, 0xC0, 0x60, 0x29, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0xE0, 0x26, 0xE0, 0x60, 0x27, 0xE0, 0x60,
+0x27, 0xC1, 0x27, 0xC2, 0xF0, 0x80, 0x04, 0x50, 0xB0, 0x06, 0x90, 0x30, 0x50, 0x04, 0xB0, 0x30,
+0x91, 0x80, 0xB0, 0x08, 0xB0, 0x90, 0x0A, 0x90, 0x07, 0xA0, 0xD0, 0x30, 0xB0, 0x00, 0x80, 0xA0,
+0x0C, 0x90, 0x50, 0x05, 0x50, 0x40, 0x00, 0x90, 0xF1, 0xA0, 0xE0, 0x20, 0xE0, 0x60, 0xC0, 0x2F,
+0x03, 0xC0, 0x60, 0x20, 0xE0, 0x2F, 0x07, 0x60, 0xC0, 0x24, 0xE0, 0x60, 0xF0, 0x01, 0x40, 0xD0,
+0x50, 0x0F, 0x1A, 0x0F, 0x12, 0x50, 0x02, 0x50, 0xA0, 0x30, 0x00, 0xB0, 0x30, 0x02, 0x70, 0x40,
+0x03, 0x50, 0x40, 0xB0, 0x0F, 0x08, 0x91, 0x08, 0xB0, 0x70, 0xE0, 0x25, 0xE1, 0x60, 0xC0, 0xE0,
+0x26, 0xE0, 0xC0, 0x60, 0x23, 0xE0, 0x60, 0x2E, 0x60, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0xE0, 0x28,
+0xE0, 0x60, 0xC0, 0x29, 0x60, 0xE0, 0x27, 0xC1, 0xE0, 0x27, 0x60, 0x27, 0xE0, 0x60, 0x27, 0xC1,
+0x27, 0xC1, 0x70, 0x10, 0x01, 0x30, 0x50, 0x01, 0x51, 0x06, 0x41, 0x90, 0x03, 0xB0, 0xA0, 0xB0,
+0x01, 0x50, 0x40, 0x09, 0x90, 0xB0, 0x09, 0xB0, 0x90, 0x07, 0xA0, 0x02, 0x30, 0x40, 0x0D, 0x40,
+0xB0, 0x03, 0x50, 0x90, 0x01, 0x81, 0xE0, 0x23, 0xE0, 0x60, 0xC0, 0x2F, 0x04, 0x60, 0x20, 0xE0,
+0x2F, 0x06, 0xE0, 0x61, 0x23, 0xE0, 0x10, 0x02, 0x50, 0x80, 0x0F, 0x1B, 0x0F, 0x1B, 0x41, 0x00,
+0xA0, 0x40, 0x10, 0x02, 0x40, 0x90, 0x0F, 0x09, 0x40, 0x50, 0x09, 0x40, 0xA0, 0xE0, 0x25, 0xE0,
+0x60, 0x20, 0xE0, 0x29, 0xC0, 0x60, 0x21, 0xE0, 0x60, 0xC0, 0x2D, 0x60, 0x20, 0xE0, 0x29, 0xE0,
+0x60, 0x2B, 0x60, 0xE0, 0x28, 0x60, 0xC0, 0x28, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0x27, 0xE0, 0x60,
+0x27, 0xC1, 0x27, 0xE0, 0xC1, 0x30, 0x01, 0xA0, 0x50, 0x01, 0xB0, 0x90, 0x06, 0x50, 0x80, 0x90,
+0x03, 0x30, 0x50, 0x01, 0xB0, 0x10, 0x30, 0x09, 0xB0, 0x90, 0x0A, 0x90, 0xB0, 0x06, 0x10, 0xB0,
+0x00, 0x90, 0x30, 0x90, 0xB0, 0x0D, 0x40, 0x02, 0x50, 0x90, 0x02, 0xA0, 0x71, 0xE0, 0x23, 0xE0,
+0x60, 0xC0, 0x2F, 0x04, 0x60, 0xC0, 0x2F, 0x07, 0xE0, 0xC0, 0x60, 0xC0, 0x20, 0xE0, 0xA0, 0x90,
+0xA0, 0x40, 0x00, 0x70, 0x0F, 0x1C, 0x0F, 0x1C, 0xA1, 0x01, 0x50, 0x70, 0xB0, 0x40, 0xB0, 0x0F,
+0x09, 0x40, 0xB0, 0x0A, 0x80, 0x60, 0xE0, 0x24, 0xE0, 0x60, 0x2E, 0x60, 0xE0, 0xC1, 0xE0, 0x2C,
+0x60, 0xC0, 0x2B, 0xC1, 0xE0, 0x28, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0x29, 0x60, 0xE0, 0x27, 0xC1,
+0x28, 0x60, 0x27, 0xC1, 0x27, 0xE0, 0x60, 0xE0, 0x70, 0x10, 0x05, 0x40, 0x01, 0x90, 0x03, 0x41,
+0x50, 0xB0, 0x01, 0x90, 0x30, 0x03, 0x30, 0x10, 0xB0, 0x09, 0x40, 0x0B, 0x40, 0x06, 0x10, 0x80,
+0x00, 0xA0, 0x01, 0x40, 0x0E, 0x40, 0x00, 0x90, 0x50, 0x03, 0xA0, 0x30, 0x10, 0xC0, 0x24, 0xE0,
+0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE1, 0x60, 0xC0, 0xE0, 0x2F, 0x08, 0x60, 0xC0, 0x60, 0x80, 0x01,
+0x40, 0x10, 0xB0, 0x0F, 0x1C, 0x0F, 0x1C, 0xB0, 0x30, 0x02, 0xD0, 0x30, 0x0F, 0x09, 0xB0, 0x40,
+0x0C, 0xA0, 0xE0, 0x25, 0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0x61, 0xE2, 0x2A, 0xC0, 0x60, 0xE0, 0x2A,
+0xE0, 0x60, 0xE0, 0x2A, 0x60, 0x29, 0xC1, 0xE0, 0x28, 0x60, 0xE0, 0x27, 0xC1, 0x27, 0xC0, 0x60,
+0x27, 0xC1, 0x27, 0xE0, 0x60, 0xE0, 0xC0, 0x10, 0x50, 0x04, 0x90, 0x00, 0x90, 0x70, 0x30, 0x00,
+0x91, 0xA0, 0x01, 0x90, 0x01, 0xA0, 0x04, 0xA0, 0x80, 0x90, 0x09, 0xB0, 0x90, 0x0A, 0x51, 0x05,
+0x11, 0xA0, 0x90, 0x01, 0xB0, 0x90, 0x0D, 0xB0, 0x80, 0xB0, 0x04, 0x50, 0xA0, 0x30, 0xE0, 0x25,
+0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE1, 0xC0, 0x60, 0xE0, 0x2F, 0x07, 0xE0, 0xC0, 0xD0, 0x50,
+0x01, 0x40, 0x80, 0x0F, 0x1D, 0x0F, 0x1D, 0x41, 0xB0, 0xA0, 0x90, 0x70, 0x50, 0x0F, 0x07, 0x50,
+0x40, 0x0C, 0x40, 0xF0, 0xE1, 0x23, 0x60, 0x20, 0xE0, 0x2E, 0xE0, 0x61, 0xC0, 0xE0, 0x2B, 0x60,
+0x20, 0xE0, 0x29, 0xE0, 0x60, 0xC0, 0xE0, 0x29, 0x60, 0x2A, 0x60, 0x28, 0xE0, 0xC1, 0x27, 0xE0,
+0x60, 0x28, 0xC1, 0x27, 0xC1, 0x27, 0xE0, 0x60, 0x20, 0xE0, 0xF0, 0xA0, 0x04, 0x31, 0xA0, 0xB0,
+0x30, 0x70, 0x30, 0xD0, 0x80, 0x01, 0x40, 0x01, 0x30, 0x04, 0x50, 0xB0, 0x40, 0x0A, 0x40, 0x0B,
+0x40, 0x05, 0xA0, 0x10, 0x80, 0x03, 0x51, 0x0C, 0x40, 0x50, 0x90, 0x06, 0x30, 0xF0, 0xE0, 0x26,
+0x60, 0xC0, 0xE0, 0x26, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x06, 0xE0, 0xA0, 0x90, 0x30,
+0x40, 0x00, 0xA0, 0x0F, 0x1E, 0x0F, 0x1E, 0xA0, 0x30, 0x01, 0xB0, 0xD0, 0x0F, 0x06, 0x91, 0x0C,
+0xB0, 0x70, 0xE0, 0x22, 0xE1, 0x60, 0x22, 0xE0, 0x2D, 0x60, 0xE1, 0xC0, 0x60, 0xE0, 0x29, 0x60,
+0xC0, 0x2C, 0x60, 0xE0, 0x2A, 0x60, 0xE0, 0x29, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0x28, 0xE0, 0x60,
+0xE0, 0x27, 0xC1, 0x27, 0xC1, 0x27, 0xE0, 0x60, 0x21, 0xE0, 0xA0, 0x10, 0xB0, 0x02, 0x70, 0xB0,
+0x08, 0x90, 0x01, 0xA0, 0x06, 0x51, 0x09, 0x51, 0x0A, 0x51, 0x04, 0x30, 0x70, 0x30, 0x04, 0x40,
+0x0A, 0xB0, 0x40, 0x01, 0x90, 0x50, 0x05, 0xA0, 0xE0, 0x28, 0x60, 0xC0, 0xE0, 0x26, 0xE0, 0x10,
+0x60, 0x27, 0xE0, 0xC0, 0x60, 0x2F, 0x05, 0xE0, 0xF0, 0x80, 0x01, 0x40, 0xD0, 0xB0, 0x0F, 0x1E,
+0x0F, 0x1F, 0xA0, 0x02, 0x70, 0xA0, 0x0F, 0x04, 0x40, 0xB0, 0x0B, 0x50, 0xD0, 0x70, 0xE1, 0x21,
+0xE0, 0x20, 0x60, 0x2F, 0x01, 0xE0, 0x60, 0x22, 0xE0, 0xC0, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0xE1,
+0x29, 0xE0, 0x60, 0x2A, 0xE0, 0xC1, 0x28, 0xE0, 0xC1, 0xE0, 0x27, 0xE0, 0x60, 0x29, 0x60, 0xE0,
+0x26, 0xE0, 0x60, 0x28, 0xC1, 0x28, 0x60, 0xE0, 0x21, 0xE0, 0xF0, 0xA0, 0x02, 0x30, 0x90, 0x08,
+0x51, 0x00, 0xA0, 0x07, 0x40, 0x0A, 0x40, 0x0B, 0x40, 0xB0, 0x03, 0x31, 0xA0, 0xB0, 0x04, 0x40,
+0x08, 0x50, 0x40, 0x03, 0x40, 0xB0, 0x04, 0xA0, 0xF0, 0xD0, 0xE0, 0x27, 0x60, 0xC0, 0xE0, 0x24,
+0xE0, 0x20, 0xE0, 0x29, 0xE0, 0x20, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0xC0, 0x10, 0xB0, 0x01,
+0x41, 0x0F, 0x1F, 0x0F, 0x1F, 0x90, 0x80, 0x50, 0xA0, 0xB0, 0xA0, 0x40, 0x0F, 0x02, 0x40, 0xB0,
+0x0C, 0xA0, 0xF0, 0xE1, 0x23, 0x60, 0x2F, 0x01, 0xE0, 0x60, 0xC0, 0xE0, 0x24, 0x60, 0xC0, 0x26,
+0x60, 0x20, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0x29, 0xE0, 0x20, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x29,
+0xC1, 0x28, 0xC0, 0x60, 0xE0, 0x26, 0xE0, 0x60, 0x28, 0xC1, 0x28, 0x60, 0xE0, 0x22, 0xE0, 0xC0,
+0x70, 0x01, 0x40, 0xA0, 0x09, 0x51, 0x30, 0x07, 0x40, 0x0A, 0x51, 0x0A, 0xB0, 0x90, 0x04, 0x71,
+0x80, 0x04, 0x51, 0x06, 0x40, 0x50, 0x05, 0x40, 0xB0, 0x03, 0x40, 0x70, 0xC0, 0x29, 0x60, 0xC0,
+0x2F, 0x04, 0xE0, 0x60, 0xC0, 0x2F, 0x00, 0xE1, 0x70, 0x00, 0x30, 0x80, 0xB0, 0xA0, 0x0F, 0x20,
+0x0F, 0x20, 0x30, 0xA0, 0x02, 0xD0, 0xB0, 0x0E, 0xB0, 0x40, 0x0B, 0xB0, 0x80, 0x70, 0x60, 0xE0,
+0x22, 0xE0, 0x20, 0x60, 0x20, 0xE1, 0x2D, 0xE0, 0x60, 0xC0, 0x27, 0x61, 0xE0, 0x23, 0x60, 0xC0,
+0xE0, 0x2A, 0xE0, 0x60, 0xE0, 0x29, 0xE0, 0xC1, 0x20, 0xE0, 0x27, 0xC0, 0x60, 0xE0, 0x28, 0xC1,
+0x28, 0xC1, 0xE0, 0x26, 0xE0, 0x60, 0xE0, 0x27, 0xC1, 0x27, 0xE0, 0x60, 0x24, 0xE0, 0xC0, 0x70,
+0xA0, 0x31, 0x09, 0x30, 0xA0, 0x08, 0xB0, 0x50, 0x0A, 0x40, 0x0B, 0x50, 0xB0, 0x02, 0xB0, 0xD0,
+0xA0, 0x40, 0x05, 0x40, 0xB0, 0x03, 0xB0, 0x40, 0xB0, 0x07, 0x40, 0x03, 0x30, 0xC0, 0xE0, 0x29,
+0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x03, 0xE0, 0x61, 0x20, 0xE0, 0x2C, 0xE0, 0xA0, 0x90, 0x01, 0x40,
+0xD0, 0x0F, 0x21, 0x0F, 0x21, 0xA0, 0x02, 0xA0, 0xD0, 0x0D, 0x50, 0x40, 0x0B, 0x30, 0x70, 0x60,
+0xE1, 0x23, 0xE0, 0x60, 0x2F, 0x02, 0xC0, 0x60, 0x28, 0xE0, 0xC0, 0x60, 0x21, 0xE0, 0xC1, 0xE0,
+0x2B, 0xC1, 0x2B, 0x60, 0xE0, 0x29, 0xC1, 0x29, 0x60, 0x29, 0x60, 0x29, 0x60, 0xE0, 0x27, 0xC0,
+0x60, 0x27, 0xE0, 0x60, 0x25, 0xE0, 0xC0, 0x70, 0x00, 0x90, 0x04, 0xB0, 0x80, 0x40, 0x00, 0xA0,
+0xD0, 0x0A, 0x40, 0x0A, 0x50, 0xB0, 0x0B, 0x40, 0x03, 0xA0, 0xD0, 0x31, 0x05, 0x40, 0x02, 0x50,
+0x40, 0x09, 0xB0, 0x40, 0x02, 0x50, 0x70, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0xE0, 0x2C, 0xE1, 0x23,
+0xE0, 0xC0, 0x60, 0xE1, 0x2A, 0xE0, 0xF0, 0xD0, 0x50, 0x01, 0x80, 0x90, 0x0F, 0x21, 0x0F, 0x21,
+0xB0, 0xA0, 0x50, 0x70, 0x00, 0x40, 0x70, 0x0B, 0x91, 0x0B, 0x40, 0x10, 0xE1, 0x23, 0xE1, 0x60,
+0x2F, 0x01, 0xE0, 0xC0, 0x60, 0x2C, 0x60, 0xC0, 0xE0, 0x60, 0xE0, 0x2C, 0x60, 0xE0, 0x29, 0xE0,
+0xC1, 0x2A, 0x60, 0xE0, 0x29, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0x29, 0x60, 0xE0, 0x27, 0xC0, 0x60,
+0x27, 0xE0, 0xC1, 0x25, 0xE1, 0x70, 0x80, 0xB0, 0x30, 0x10, 0x30, 0x90, 0xD0, 0x40, 0xA0, 0x30,
+0x90, 0x00, 0x50, 0x09, 0x50, 0xB0, 0x0A, 0x40, 0x0B, 0x51, 0x02, 0xB0, 0xD0, 0xA0, 0x31, 0x04,
+0xB0, 0x90, 0x00, 0x40, 0x50, 0x0B, 0xB0, 0x90, 0x02, 0x10, 0x60, 0xE0, 0x2B, 0x60, 0xC0, 0xE0,
+0x2A, 0xE0, 0xC0, 0x10, 0xE0, 0x24, 0xC0, 0x60, 0xC0, 0xE0, 0x28, 0xE0, 0xC0, 0xA0, 0x00, 0x30,
+0x80, 0x40, 0x80, 0x0F, 0x22, 0x0F, 0x22, 0x90, 0xD0, 0x02, 0xA0, 0x40, 0x09, 0x90, 0x50, 0x0C,
+0x70, 0xE1, 0x23, 0xE0, 0x20, 0x60, 0xC0, 0x2F, 0x02, 0x60, 0x2D, 0xE0, 0xC0, 0xF0, 0xE1, 0x2A,
+0xE0, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x27, 0xE0, 0xC1, 0x28, 0xE0, 0x60,
+0x29, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0x28, 0xC1, 0xE0, 0x25, 0xE0, 0xC0, 0xA0, 0x31, 0x80, 0x90,
+0xA0, 0x01, 0x80, 0x40, 0x01, 0x90, 0x09, 0xB0, 0x90, 0x0A, 0x50, 0xB0, 0x0B, 0x40, 0x03, 0x50,
+0x30, 0x71, 0x02, 0x30, 0x80, 0xB0, 0x41, 0x0E, 0x90, 0x50, 0x01, 0x90, 0xA0, 0xE0, 0x2C, 0x60,
+0xC0, 0xE0, 0x2A, 0x30, 0xD0, 0x70, 0xE0, 0x23, 0xE0, 0x20, 0x60, 0xC0, 0x28, 0xE0, 0x70, 0x02,
+0x80, 0xA0, 0x0F, 0x23, 0x0F, 0x23, 0x30, 0x50, 0x00, 0xB0, 0x30, 0x10, 0xB0, 0x07, 0x40, 0xB0,
+0x09, 0xB0, 0x01, 0xA0, 0x60, 0xE0, 0x25, 0x60, 0x20, 0xE0, 0x2F, 0x01, 0x60, 0xC0, 0xE0, 0x2B,
+0xE1, 0xC1, 0x60, 0xC0, 0xE0, 0x29, 0xC0, 0x60, 0xE0, 0x29, 0xE0, 0xC0, 0x60, 0x29, 0xE0, 0x60,
+0xC0, 0xE0, 0x27, 0xE0, 0x60, 0xC0, 0x28, 0xE0, 0x60, 0x29, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0x28,
+0xC1, 0xE0, 0x26, 0xE0, 0x60, 0x90, 0x70, 0x08, 0x90, 0x0A, 0x40, 0x0B, 0x40, 0x0B, 0xB0, 0x90,
+0x04, 0x30, 0x10, 0x40, 0x01, 0x30, 0x10, 0xA0, 0x40, 0x90, 0x0F, 0x00, 0x90, 0xB0, 0x01, 0xD0,
+0x60, 0xE1, 0x2B, 0x60, 0xC0, 0xE0, 0x28, 0x60, 0xD0, 0x00, 0x40, 0xA0, 0xE0, 0x23, 0xE0, 0x20,
+0x60, 0xC0, 0xE0, 0x25, 0xE0, 0xA1, 0x90, 0x01, 0xA0, 0x0F, 0x24, 0x0F, 0x24, 0x70, 0x90, 0xA0,
+0xB1, 0x10, 0x06, 0x40, 0xB0, 0x09, 0x40, 0x10, 0xC0, 0x70, 0x60, 0xE0, 0x24, 0xE0, 0x60, 0x20,
+0xE0, 0x20, 0xE0, 0x2D, 0xE0, 0x60, 0x2F, 0x00, 0xC0, 0x60, 0xE1, 0x61, 0x29, 0x60, 0x2B, 0xE0,
+0x60, 0xE0, 0x29, 0xE0, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x29, 0xC1, 0x29, 0x60, 0xE0, 0x27, 0xC0,
+0x60, 0x29, 0x60, 0xE0, 0x26, 0xE1, 0x30, 0xA0, 0x01, 0xB0, 0x52, 0x40, 0x31, 0xA0, 0x30, 0x70,
+0x40, 0x07, 0x51, 0x0A, 0x40, 0x0C, 0x40, 0xB0, 0x03, 0x90, 0xA0, 0x10, 0xB0, 0x00, 0xB0, 0x91,
+0x10, 0xB0, 0x90, 0x0F, 0x00, 0x40, 0x01, 0x50, 0x11, 0xE1, 0x25, 0xE1, 0x23, 0x60, 0xC0, 0xE0,
+0x27, 0xE0, 0xA0, 0x01, 0x80, 0x60, 0xE0, 0x24, 0xE0, 0x61, 0xE0, 0x23, 0xE0, 0xF0, 0x80, 0x00,
+0x30, 0x80, 0x30, 0x50, 0x40, 0x30, 0x40, 0x0F, 0x21, 0x0F, 0x25, 0xD0, 0x02, 0x90, 0xD0, 0x03,
+0xB0, 0x40, 0x0B, 0xA0, 0x71, 0xC0, 0xE0, 0x25, 0x60, 0x2F, 0x02, 0xE0, 0x60, 0xC0, 0x2E, 0xE0,
+0x60, 0xE0, 0x21, 0xE0, 0xC0, 0x60, 0xC0, 0xE0, 0x25, 0xC1, 0x2A, 0xE0, 0xC0, 0x60, 0x2A, 0xC0,
+0x60, 0xE0, 0x29, 0x60, 0xE0, 0x27, 0xE0, 0x60, 0xC0, 0x29, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0x29,
+0x60, 0xE0, 0x27, 0xE0, 0x30, 0xD0, 0x10, 0xA0, 0x30, 0x82, 0x90, 0xB0, 0x01, 0x50, 0x00, 0xA0,
+0x08, 0x90, 0x00, 0xB0, 0x09, 0x40, 0x0C, 0x40, 0x02, 0x40, 0x80, 0x11, 0xD0, 0x40, 0x90, 0x03,
+0x50, 0xB0, 0x0F, 0x00, 0x40, 0x01, 0xB0, 0xA0, 0x70, 0xE0, 0x24, 0xE0, 0xA1, 0xE0, 0x20, 0xE2,
+0x60, 0xC0, 0xE0, 0x24, 0xE2, 0xA0, 0x01, 0xB0, 0xA0, 0xE0, 0x26, 0xC0, 0x60, 0xE0, 0x21, 0xE0,
+0xF0, 0xA0, 0x02, 0x81, 0x00, 0x30, 0x90, 0x80, 0x0F, 0x21, 0x0F, 0x25, 0x50, 0x30, 0x00, 0xB0,
+0x31, 0xA0, 0x01, 0x50, 0x90, 0x0B, 0x90, 0x10, 0xE1, 0x26, 0x60, 0x2F, 0x02, 0xE0, 0xC0, 0x60,
+0xE0, 0x2D, 0xE0, 0x60, 0x25, 0xE0, 0x61, 0x20, 0xE0, 0x22, 0xE0, 0x60, 0x20, 0xE0, 0x29, 0xE0,
+0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC1, 0x28, 0xE0, 0x60, 0xE0, 0x28, 0xC1, 0x28, 0xC0, 0x60, 0x29,
+0x60, 0xE0, 0x27, 0xE0, 0x60, 0x30, 0x09, 0x40, 0x00, 0x30, 0x50, 0x06, 0x40, 0x31, 0xD0, 0x40,
+0x90, 0x41, 0x05, 0x90, 0x0C, 0x50, 0x40, 0xA1, 0x10, 0x80, 0x40, 0x31, 0x90, 0x70, 0xA0, 0x80,
+0x40, 0x50, 0xB0, 0x40, 0x80, 0x40, 0x0E, 0x90, 0x40, 0x30, 0x00, 0x70, 0xE0, 0x25, 0xF0, 0x70,
+0xE0, 0xC0, 0x10, 0xC0, 0xE1, 0x60, 0xC0, 0xE0, 0x22, 0xE1, 0xA0, 0x10, 0x40, 0x02, 0xF0, 0xC0,
+0xE0, 0x26, 0xC0, 0x60, 0x20, 0xE0, 0xC0, 0xA0, 0x80, 0x40, 0x00, 0x50, 0x30, 0x01, 0xB0, 0x40,
+0xB0, 0x0F, 0x21, 0x0F, 0x22, 0x50, 0xD1, 0x50, 0x40, 0x30, 0xA0, 0x01, 0xA0, 0x40, 0x51, 0x0C,
+0x50, 0x70, 0xE0, 0x26, 0x60, 0x21, 0xE0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2E, 0xC0, 0x60, 0x25,
+0xE0, 0x20, 0xC0, 0x60, 0xC0, 0xE0, 0x21, 0x60, 0xC0, 0xE0, 0x29, 0xE0, 0x61, 0xE0, 0x2A, 0x60,
+0xE0, 0x29, 0x60, 0xE0, 0x29, 0x60, 0xE0, 0x28, 0xC1, 0x28, 0xC0, 0x60, 0x29, 0x60, 0xE0, 0x27,
+0xE0, 0xC0, 0xA0, 0xB0, 0x08, 0x40, 0x00, 0x50, 0x30, 0x05, 0xB0, 0xA0, 0x50, 0xB0, 0x81, 0x40,
+0x50, 0xA0, 0x05, 0xB0, 0x90, 0x0B, 0xB0, 0x70, 0xA0, 0x30, 0xA0, 0x00, 0x90, 0x50, 0x02, 0xB0,
+0x50, 0x90, 0x10, 0xD0, 0x30, 0xA0, 0x31, 0x0C, 0xB0, 0x30, 0x80, 0x00, 0x40, 0xA0, 0xE0, 0x25,
+0xE0, 0xC0, 0xA0, 0x20, 0xF0, 0xE0, 0xF1, 0xE0, 0x60, 0xC0, 0x22, 0xE0, 0xF0, 0x10, 0x40, 0x03,
+0x80, 0x60, 0xE0, 0x27, 0xC0, 0x60, 0xC0, 0x70, 0x01, 0x81, 0xA0, 0x00, 0x80, 0xA0, 0x40, 0x0F,
+0x23, 0x0F, 0x25, 0x70, 0x00, 0xA0, 0x50, 0x01, 0x40, 0x10, 0x90, 0x0D, 0x50, 0xD0, 0xE0, 0x24,
+0xE0, 0x60, 0x2F, 0x04, 0x60, 0x2F, 0x00, 0xE0, 0x60, 0xE0, 0x28, 0xE0, 0xC0, 0x60, 0x20, 0xE0,
+0x60, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0x2A, 0xC1, 0x2A, 0x60, 0xE0, 0x29, 0x60, 0xE0, 0x28, 0xC1,
+0x28, 0xC0, 0x60, 0x29, 0x60, 0xE0, 0x28, 0xC0, 0x60, 0xA0, 0x08, 0x50, 0xB0, 0x00, 0x30, 0x50,
+0x04, 0x50, 0x80, 0x00, 0x40, 0x03, 0xA0, 0x06, 0x40, 0x04, 0xA1, 0x04, 0x70, 0xD0, 0x90, 0xB0,
+0x90, 0x40, 0x08, 0xA0, 0x50, 0x40, 0xB0, 0xD0, 0xB0, 0x09, 0x50, 0x31, 0xB0, 0x51, 0x00, 0xA0,
+0xE0, 0x27, 0xC0, 0xE2, 0xF0, 0x60, 0xE1, 0x60, 0xC0, 0xE0, 0x20, 0xE0, 0x70, 0x80, 0x04, 0x90,
+0xF0, 0xE0, 0x27, 0xE1, 0xD1, 0x02, 0x70, 0x00, 0x81, 0xB0, 0x71, 0x0F, 0x22, 0x0F, 0x20, 0xB0,
+0x03, 0xD0, 0xB0, 0x00, 0x70, 0xB0, 0xA0, 0x10, 0x30, 0xD0, 0xB0, 0x0C, 0x90, 0xF0, 0xE0, 0x24,
+0x60, 0x2F, 0x03, 0xE0, 0x60, 0x2F, 0x00, 0xE0, 0x60, 0x2D, 0x61, 0xC0, 0xE0, 0x2B, 0x60, 0xE0,
+0x29, 0xE0, 0x60, 0xE0, 0x2A, 0x60, 0xE0, 0x29, 0xC0, 0x28, 0xE0, 0xC0, 0x29, 0xC0, 0x60, 0x29,
+0x60, 0xE0, 0x29, 0x60, 0x30, 0x50, 0x08, 0x40, 0x01, 0x70, 0x01, 0x90, 0x31, 0xA0, 0x50, 0x00,
+0x90, 0x03, 0x80, 0x90, 0x05, 0xB0, 0x50, 0x09, 0x90, 0x10, 0x30, 0x90, 0x40, 0xB0, 0x0A, 0x70,
+0x00, 0x30, 0xA0, 0x90, 0x07, 0x50, 0x70, 0x80, 0x50, 0x02, 0x90, 0xB0, 0x70, 0x2C, 0xE1, 0x20,
+0xE0, 0x20, 0x60, 0xC0, 0xE1, 0xD0, 0x30, 0x05, 0x70, 0xE0, 0x26, 0xE1, 0xA0, 0x80, 0x11, 0x50,
+0x30, 0x50, 0x00, 0xA0, 0x50, 0x01, 0x80, 0xD0, 0x0F, 0x21, 0x0F, 0x1F, 0xA0, 0x10, 0x72, 0xD0,
+0x80, 0x02, 0xD0, 0x10, 0x80, 0x00, 0x50, 0xD0, 0x0C, 0x40, 0x60, 0xE0, 0x21, 0xE0, 0x20, 0x60,
+0x2F, 0x04, 0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0xC1, 0xE0, 0x2C, 0xC0, 0x61, 0xC0, 0x29, 0xE0, 0x60,
+0x20, 0xE0, 0x2A, 0x60, 0x29, 0xE0, 0xC1, 0x29, 0xC1, 0x28, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x29,
+0x60, 0xC0, 0x29, 0x60, 0xC0, 0xA0, 0x08, 0x40, 0x02, 0x70, 0xA0, 0x80, 0x50, 0xB0, 0x02, 0xB0,
+0x50, 0x02, 0x90, 0x40, 0x06, 0x40, 0x0A, 0x31, 0x50, 0x90, 0x0B, 0xA0, 0x00, 0x80, 0x30, 0x90,
+0x01, 0xB1, 0x00, 0xB0, 0x80, 0x40, 0xA0, 0x06, 0x90, 0x70, 0xE0, 0x20, 0xE0, 0x2F, 0x00, 0x60,
+0xC0, 0xE0, 0x10, 0x90, 0x05, 0x90, 0xF0, 0xE0, 0x25, 0xE0, 0xF0, 0x40, 0x00, 0xB0, 0x11, 0x40,
+0x01, 0x50, 0xD0, 0x02, 0x30, 0x40, 0x0F, 0x20, 0x0F, 0x1F, 0xB0, 0xD0, 0x01, 0xB1, 0x00, 0x30,
+0xD0, 0x40, 0x50, 0x70, 0x02, 0xD1, 0x0B, 0x40, 0xF0, 0xE0, 0x20, 0xE1, 0x60, 0x2F, 0x03, 0xE0,
+0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0x20, 0x60, 0xE0, 0x2D, 0x60, 0x20, 0xE0, 0xC0, 0x60, 0xC0, 0x20,
+0xE0, 0x25, 0xE0, 0x60, 0x2B, 0xC1, 0x29, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0xC0, 0x28, 0xE0, 0x60,
+0x29, 0xC0, 0x60, 0x29, 0xC1, 0x29, 0x60, 0xE0, 0x30, 0x90, 0x07, 0x90, 0x0B, 0x40, 0x02, 0x40,
+0x50, 0x06, 0xB0, 0x50, 0x08, 0x90, 0x40, 0x80, 0x00, 0x90, 0xB0, 0x09, 0x81, 0x00, 0x30, 0x90,
+0xA0, 0x41, 0xA0, 0x30, 0xA0, 0x30, 0x50, 0x90, 0x08, 0xA0, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x60,
+0x70, 0x30, 0xB0, 0x03, 0x81, 0x40, 0x60, 0x25, 0xE0, 0x60, 0xD0, 0x90, 0x01, 0x40, 0x30, 0x00,
+0x31, 0x00, 0x40, 0x10, 0x50, 0x00, 0x81, 0x0F, 0x20, 0x0F, 0x20, 0x90, 0xD0, 0x05, 0x70, 0x00,
+0x90, 0x80, 0x00, 0x70, 0x00, 0x40, 0xD0, 0x0A, 0x90, 0xF0, 0xE0, 0x20, 0xE0, 0x60, 0xC0, 0xE0,
+0x20, 0xE0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0xC0, 0xE0,
+0x22, 0xC0, 0x60, 0xC0, 0x25, 0xC1, 0x23, 0xE0, 0x26, 0x60, 0x2A, 0xE0, 0x60, 0xE0, 0x28, 0xE0,
+0x60, 0x29, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x29, 0x60, 0xE0, 0x50, 0xA0, 0x07, 0x50,
+0xB0, 0x0A, 0x50, 0xB0, 0x01, 0x80, 0x50, 0x07, 0x40, 0x06, 0x90, 0x40, 0x00, 0xB0, 0x30, 0x01,
+0x40, 0x09, 0x41, 0x00, 0x90, 0x80, 0x31, 0x40, 0x0E, 0x70, 0x60, 0xE0, 0x2F, 0x01, 0xE0, 0xF0,
+0xD0, 0x90, 0x04, 0xA0, 0x70, 0xD0, 0xE0, 0x24, 0xE0, 0x60, 0xA0, 0x00, 0x30, 0x80, 0x00, 0xA0,
+0x00, 0xA0, 0x90, 0x81, 0x00, 0xB0, 0xD1, 0xA0, 0x0F, 0x21, 0x0F, 0x21, 0x40, 0x50, 0x40, 0xB1,
+0x30, 0x50, 0xD0, 0xB0, 0x00, 0x80, 0x10, 0x02, 0x80, 0xA0, 0x09, 0xB0, 0xA0, 0xE0, 0x20, 0x60,
+0x20, 0xE0, 0x2F, 0x02, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0xC0, 0xE1, 0x2B, 0xE0, 0x60, 0x23,
+0xE0, 0x21, 0x61, 0xC0, 0xE2, 0x20, 0x60, 0xE0, 0x2A, 0xC0, 0x60, 0xE0, 0x29, 0xC0, 0x60, 0x29,
+0xE0, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x29, 0xC1, 0xA0, 0x80, 0x08,
+0x40, 0x0A, 0xB0, 0x90, 0x01, 0x90, 0x30, 0x07, 0x51, 0x03, 0x50, 0x90, 0x02, 0xB0, 0x30, 0x01,
+0x30, 0x10, 0x08, 0x80, 0x40, 0x00, 0x80, 0xA0, 0xD0, 0x80, 0x0F, 0x00, 0x80, 0x61, 0xE0, 0x2E,
+0xE0, 0xF0, 0x10, 0x00, 0x90, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x24, 0xE0, 0x60, 0xD0, 0x02, 0x80,
+0x10, 0x00, 0xB0, 0xD0, 0x00, 0x40, 0x10, 0xD0, 0xA0, 0x0F, 0x24, 0x0F, 0x23, 0xD0, 0x01, 0xA0,
+0x70, 0x40, 0x02, 0x80, 0x90, 0x00, 0xB0, 0xA0, 0x31, 0x08, 0x61, 0xE0, 0x60, 0x2F, 0x05, 0x60,
+0x2F, 0x00, 0xE0, 0xC0, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0xC0, 0xE0, 0x27, 0x61, 0xC0, 0xE0, 0xC1,
+0xE0, 0x29, 0xE0, 0x60, 0xC0, 0x2A, 0xC1, 0x2A, 0x60, 0xE0, 0x28, 0xE0, 0x60, 0x29, 0xC0, 0x60,
+0x29, 0xC1, 0x29, 0xC0, 0x60, 0x10, 0x09, 0x40, 0x0B, 0x40, 0x02, 0x40, 0x80, 0x07, 0x40, 0x01,
+0x90, 0x41, 0x10, 0x02, 0x40, 0x90, 0x00, 0x50, 0x10, 0xA0, 0x08, 0x90, 0x80, 0x00, 0xA2, 0x00,
+0x40, 0x0E, 0x40, 0x80, 0xC0, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0xF0, 0x30, 0x01, 0x90, 0x50, 0x02,
+0xB0, 0xA0, 0xE0, 0x23, 0xE0, 0xC0, 0xA0, 0x80, 0x40, 0x01, 0xA0, 0xB0, 0x01, 0x40, 0x00, 0x90,
+0xB0, 0x00, 0x70, 0x50, 0x0F, 0x23, 0x0F, 0x23, 0x70, 0xB0, 0x00, 0x70, 0xB0, 0x00, 0xA0, 0x70,
+0x30, 0x00, 0x30, 0x40, 0xA0, 0x01, 0xA0, 0x80, 0x07, 0xA0, 0xC0, 0x60, 0xC0, 0x2F, 0x04, 0x60,
+0x2F, 0x01, 0xE0, 0x60, 0x2D, 0xE0, 0x20, 0x60, 0xE0, 0x27, 0xE1, 0x20, 0xC0, 0x61, 0xE1, 0x29,
+0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC1, 0x29, 0xC0, 0x60, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x2A,
+0xC0, 0x30, 0x50, 0x08, 0x50, 0xB0, 0x0A, 0x51, 0x02, 0xA0, 0x07, 0x50, 0x40, 0x90, 0xB0, 0x01,
+0x50, 0x02, 0xA0, 0x02, 0x52, 0x07, 0x50, 0xD0, 0x00, 0x31, 0xA0, 0xB0, 0x90, 0xB0, 0x0D, 0xB0,
+0x70, 0xE0, 0x60, 0xC0, 0x2A, 0xE1, 0xF0, 0x10, 0x04, 0x90, 0x50, 0x01, 0x50, 0x10, 0xC0, 0x23,
+0xE0, 0xA0, 0x01, 0x80, 0x40, 0x30, 0xB0, 0x90, 0xD0, 0xB0, 0x04, 0xA0, 0xB0, 0x0F, 0x23, 0x0F,
+0x23, 0xB0, 0xD0, 0x10, 0x80, 0xB0, 0x10, 0x40, 0x00, 0x30, 0x40, 0x00, 0x70, 0x50, 0x02, 0x10,
+0x90, 0x06, 0x70, 0x60, 0xC0, 0xE0, 0x2F, 0x03, 0x60, 0xC0, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0xE0,
+0x2C, 0xE0, 0x60, 0x2A, 0xE0, 0x20, 0xE0, 0xC0, 0x61, 0xC0, 0x29, 0xC0, 0x60, 0x2B, 0x60, 0xE0,
+0x29, 0xC1, 0x29, 0xC1, 0x29, 0xC0, 0x60, 0x29, 0xC1, 0x29, 0xE0, 0x60, 0xC0, 0x30, 0x08, 0xB0,
+0x50, 0x0B, 0x40, 0x02, 0xA0, 0x00, 0xB0, 0x80, 0xA0, 0x10, 0xD0, 0x91, 0xD0, 0x40, 0x03, 0x80,
+0xB0, 0x01, 0x81, 0x02, 0xB0, 0x40, 0x06, 0xB0, 0xA0, 0x90, 0x01, 0xD0, 0xA0, 0x50, 0x00, 0x40,
+0x0E, 0x10, 0x60, 0xE0, 0x60, 0x28, 0xE1, 0x60, 0x70, 0xF0, 0x30, 0x05, 0x90, 0x50, 0x00, 0xA0,
+0xD0, 0xE0, 0x22, 0xE0, 0xD0, 0x40, 0x02, 0xD0, 0x90, 0x00, 0x50, 0xD1, 0xB0, 0x01, 0xD1, 0x30,
+0x0F, 0x24, 0x0F, 0x26, 0xB0, 0x10, 0xB0, 0x01, 0x80, 0x40, 0x01, 0x70, 0x00, 0xB0, 0xA0, 0x00,
+0x10, 0x90, 0x04, 0x90, 0x30, 0xE0, 0x2F, 0x03, 0xE0, 0x60, 0xC0, 0x2F, 0x01, 0xC1, 0xE0, 0x2D,
+0xC0, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0xE1, 0xC0, 0x61, 0x20, 0xE0, 0x24, 0xE0, 0x60, 0xE0, 0x29,
+0xE0, 0xC1, 0x2A, 0x60, 0x2A, 0xC1, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x29, 0xE0, 0x60, 0xE0,
+0x70, 0xB0, 0x08, 0x90, 0x0B, 0x40, 0x02, 0x10, 0xA0, 0x80, 0x50, 0x00, 0x90, 0x80, 0x30, 0x90,
+0x50, 0xA0, 0x40, 0x90, 0x40, 0x80, 0xA0, 0x70, 0x02, 0x40, 0xA0, 0x80, 0xD0, 0x80, 0x00, 0x40,
+0x05, 0xB0, 0x30, 0x02, 0x71, 0x30, 0x01, 0x40, 0x0D, 0x30, 0x60, 0xE1, 0x60, 0x20, 0xE0, 0x24,
+0xE1, 0x70, 0x10, 0xB0, 0x08, 0x90, 0x50, 0xA0, 0xE0, 0x22, 0xE0, 0x70, 0x00, 0x30, 0x40, 0x00,
+0x30, 0x90, 0x01, 0x90, 0x40, 0xB0, 0x10, 0x40, 0x0F, 0x28, 0x0F, 0x26, 0x30, 0x90, 0x01, 0x40,
+0xD0, 0x00, 0x30, 0x80, 0x00, 0xA1, 0x02, 0xD0, 0x90, 0x03, 0x40, 0xF0, 0xE0, 0x2F, 0x02, 0xE0,
+0x60, 0xC0, 0xE1, 0x2F, 0x00, 0x60, 0x2F, 0x00, 0x60, 0x20, 0xE0, 0x2A, 0xE0, 0xC1, 0xE0, 0x21,
+0xE0, 0xC0, 0x61, 0xC0, 0xE0, 0x20, 0xE0, 0x21, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0x2A,
+0xC1, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x2A, 0xC1, 0xE0, 0x70, 0x08, 0x40, 0x0B, 0x51, 0x04,
+0x50, 0x90, 0x30, 0xB0, 0x02, 0xB0, 0x80, 0x42, 0x01, 0xA1, 0x30, 0x00, 0xB0, 0x90, 0xB0, 0x80,
+0x00, 0x90, 0xB0, 0x04, 0x50, 0x80, 0x02, 0x40, 0x70, 0xD0, 0x30, 0x00, 0x51, 0x0C, 0x10, 0xC0,
+0xE0, 0x21, 0x60, 0xE0, 0x23, 0xE0, 0xF0, 0xA0, 0x90, 0x0B, 0x90, 0x30, 0xE0, 0x20, 0xE1, 0x70,
+0x50, 0x01, 0x80, 0x70, 0x40, 0x06, 0xD0, 0x80, 0x0F, 0x27, 0x0F, 0x26, 0x30, 0x40, 0x00, 0x30,
+0xD0, 0xB0, 0x91, 0x80, 0x50, 0xB0, 0xA0, 0x02, 0x30, 0xD0, 0x90, 0x01, 0x80, 0x70, 0x60, 0x2F,
+0x02, 0xE0, 0xC0, 0x60, 0x2F, 0x01, 0xE0, 0x60, 0x2F, 0x00, 0xC1, 0xE0, 0x2B, 0xE0, 0x60, 0x27,
+0xC0, 0x60, 0xC1, 0xE0, 0xC1, 0xE0, 0x29, 0xE0, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0xE0, 0x29, 0xC1,
+0x29, 0xC0, 0x60, 0x29, 0xE0, 0x60, 0x29, 0xE0, 0xC1, 0xE0, 0x30, 0x90, 0x07, 0x50, 0xB0, 0x0B,
+0x40, 0x01, 0xB0, 0x91, 0xB0, 0x00, 0x40, 0x50, 0x03, 0x90, 0xB0, 0x05, 0xB0, 0xD0, 0xB0, 0x00,
+0xB0, 0x30, 0x01, 0x40, 0x04, 0xD0, 0x50, 0x03, 0xA0, 0xD1, 0x30, 0x00, 0x40, 0x0B, 0xB0, 0x70,
+0xE0, 0x22, 0xC0, 0x60, 0x23, 0xE0, 0x70, 0x0E, 0xA0, 0xC0, 0xE1, 0xA0, 0x30, 0x40, 0x01, 0x40,
+0x80, 0x08, 0x40, 0x0F, 0x27, 0x0F, 0x27, 0xA0, 0xD0, 0x30, 0x02, 0x81, 0x01, 0x50, 0xA0, 0x00,
+0x70, 0x01, 0x10, 0x50, 0x90, 0x70, 0xE1, 0x20, 0xE0, 0x2F, 0x01, 0x60, 0xE0, 0x2F, 0x00, 0xE0,
+0xC1, 0xE0, 0x2D, 0xE0, 0x60, 0xE0, 0x2C, 0xC0, 0x60, 0xE0, 0x25, 0xE2, 0xC0, 0x62, 0xE1, 0x2A,
+0x60, 0x2B, 0x60, 0xE0, 0x29, 0x60, 0xC0, 0x29, 0xC1, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x30,
+0x50, 0x07, 0xB0, 0x90, 0x0B, 0x90, 0x41, 0x50, 0x03, 0x41, 0x04, 0x90, 0x07, 0x70, 0x30, 0x10,
+0x30, 0x01, 0x51, 0x03, 0x50, 0x10, 0xA0, 0x01, 0x90, 0x40, 0xB0, 0x10, 0x90, 0x30, 0x00, 0x40,
+0x0A, 0xA0, 0xC0, 0xE0, 0x22, 0xE0, 0xC0, 0x60, 0xE0, 0x20, 0xE1, 0xA0, 0x0D, 0xB0, 0xA0, 0x40,
+0xC0, 0x70, 0x50, 0x00, 0x30, 0x41, 0x30, 0x0F, 0x32, 0x0F, 0x32, 0xB0, 0x10, 0x03, 0x10, 0x80,
+0xF0, 0xE0, 0x2F, 0x02, 0xE0, 0x60, 0xE0, 0x20, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xE0, 0x60,
+0xC0, 0x2C, 0xE0, 0x60, 0xE0, 0x2A, 0xE1, 0x62, 0xC0, 0xE1, 0x26, 0xC1, 0x2A, 0xC1, 0x2A, 0x60,
+0xE0, 0x29, 0xC1, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0xA0, 0xB0, 0x08, 0x40, 0x09, 0x50, 0x41,
+0x50, 0x05, 0xA0, 0x50, 0x04, 0x40, 0x08, 0x50, 0x04, 0x40, 0x01, 0x50, 0x31, 0x00, 0x90, 0xA1,
+0x80, 0x30, 0x00, 0x40, 0x00, 0xA0, 0x00, 0xB0, 0x90, 0x08, 0x40, 0xF0, 0xE0, 0x25, 0x60, 0xC0,
+0xE1, 0xA0, 0x50, 0x0D, 0x80, 0x60, 0x50, 0xD0, 0xF0, 0x02, 0x70, 0x30, 0x0F, 0x33, 0x0F, 0x33,
+0xB0, 0xA0, 0x01, 0xA0, 0x00, 0x10, 0xA0, 0xE0, 0x2F, 0x01, 0xE0, 0x60, 0xC0, 0xE0, 0x21, 0xE0,
+0x2D, 0x60, 0x20, 0xE0, 0x2E, 0x60, 0xE0, 0x2B, 0xE0, 0xC0, 0x60, 0xE0, 0x2B, 0x60, 0xC0, 0xE1,
+0xC0, 0x61, 0xC0, 0x20, 0xE1, 0x22, 0x60, 0xE0, 0x2A, 0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC1, 0x29,
+0xE0, 0x60, 0x2A, 0xE0, 0x60, 0x50, 0xA0, 0xB0, 0x08, 0x40, 0x05, 0xB0, 0x50, 0x40, 0x90, 0xB0,
+0x01, 0x40, 0xB0, 0x81, 0x30, 0xA1, 0x30, 0xB0, 0x05, 0x40, 0x0E, 0x40, 0x31, 0xB0, 0x05, 0xA0,
+0x01, 0x80, 0x10, 0x01, 0x90, 0xB0, 0x06, 0xB0, 0x70, 0xE0, 0x26, 0xE0, 0x60, 0xC0, 0xE0, 0xA0,
+0x0E, 0xA0, 0x90, 0xA0, 0x50, 0x80, 0x40, 0x00, 0x40, 0x80, 0x0F, 0x34, 0x0F, 0x34, 0x50, 0xA0,
+0x30, 0xB0, 0x01, 0xA0, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0xE0, 0x2F, 0x01, 0x60, 0xC0, 0xE0,
+0x2D, 0xE0, 0x60, 0xE1, 0x2B, 0xE0, 0x60, 0xC0, 0x2C, 0x60, 0x21, 0xE0, 0x22, 0xC0, 0x61, 0xC0,
+0xE2, 0x60, 0xE0, 0x29, 0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0xC1, 0x29,
+0xE0, 0x60, 0x30, 0x40, 0x09, 0x50, 0xB0, 0x01, 0xB0, 0x90, 0x40, 0x50, 0xB0, 0x04, 0x50, 0xA0,
+0x40, 0xB0, 0x0A, 0x40, 0x0C, 0x50, 0x31, 0x50, 0x07, 0xA0, 0x01, 0xB0, 0x70, 0x02, 0x40, 0x06,
+0xA0, 0x60, 0xE0, 0x28, 0x61, 0xA0, 0x0E, 0x71, 0x50, 0x01, 0x32, 0x0F, 0x35, 0x0F, 0x35, 0x90,
+0xA0, 0x02, 0x30, 0xA0, 0x60, 0xE0, 0x2C, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x02, 0x60, 0x2F, 0x00,
+0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x25, 0xE0, 0x20, 0xC0, 0x63, 0xE0, 0x22, 0xE0, 0x25,
+0xE0, 0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC0, 0x60, 0x2A, 0xC1, 0x29, 0xE0, 0x30, 0x80, 0x0A, 0xB0,
+0x40, 0x90, 0x40, 0x50, 0xB0, 0x08, 0x30, 0xB0, 0x0B, 0xB0, 0x50, 0x09, 0x50, 0xA0, 0x80, 0x01,
+0x90, 0x06, 0x41, 0x02, 0x70, 0x02, 0xB0, 0x90, 0x04, 0x70, 0x60, 0xE0, 0x2A, 0x60, 0x30, 0x0D,
+0x50, 0x10, 0x30, 0x90, 0x01, 0x40, 0x30, 0x0F, 0x36, 0x0F, 0x36, 0x50, 0xA0, 0x00, 0x70, 0xB0,
+0x00, 0xA0, 0x60, 0xE0, 0x2A, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x02, 0x60, 0x2F, 0x00, 0xE0, 0x60,
+0xE0, 0x2C, 0xE0, 0x60, 0xC0, 0x2B, 0xE0, 0x60, 0x2A, 0xE1, 0xC0, 0x63, 0xC0, 0xE2, 0x23, 0xE0,
+0x60, 0x2B, 0x60, 0xE0, 0x29, 0xC0, 0x60, 0x29, 0xE0, 0xC1, 0x28, 0xE0, 0xF1, 0xB0, 0x06, 0xB0,
+0x50, 0x90, 0x40, 0x90, 0x40, 0x0C, 0x40, 0x50, 0x0C, 0x40, 0x09, 0x41, 0x01, 0x50, 0x31, 0x10,
+0x80, 0x03, 0x30, 0x40, 0x00, 0x40, 0xA0, 0xB0, 0x03, 0x51, 0x01, 0x80, 0x70, 0xC0, 0xE0, 0x2B,
+0xE0, 0xA0, 0x0D, 0x10, 0x50, 0x00, 0x30, 0x90, 0x40, 0x30, 0x0F, 0x37, 0x0F, 0x37, 0xB0, 0x10,
+0xB0, 0x02, 0x10, 0xF0, 0xE0, 0x2A, 0x60, 0xE0, 0x2F, 0x02, 0x60, 0xC0, 0xE0, 0x2D, 0xE0, 0x60,
+0xC0, 0xE0, 0x2D, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0xE2, 0x20, 0xC0, 0x62, 0xC1,
+0x20, 0xE1, 0x60, 0xE0, 0x2A, 0x60, 0x2A, 0xC0, 0x60, 0x2B, 0xC0, 0x27, 0xE0, 0x60, 0xF0, 0x00,
+0x90, 0x01, 0xB0, 0x51, 0x90, 0x40, 0x90, 0xB0, 0x02, 0x90, 0xB0, 0x0B, 0x40, 0x50, 0x0C, 0xB0,
+0x50, 0x07, 0x90, 0x80, 0xA0, 0x40, 0xD0, 0x70, 0x30, 0x80, 0x06, 0xA0, 0x40, 0x70, 0x06, 0x90,
+0x40, 0x70, 0x60, 0xE1, 0x2C, 0xE0, 0x60, 0x40, 0x0A, 0xB0, 0x10, 0x80, 0x02, 0x70, 0x80, 0x0F,
+0x38, 0x0F, 0x38, 0x50, 0xA0, 0x01, 0x70, 0xB0, 0x80, 0xF0, 0xE0, 0x28, 0x60, 0x2F, 0x02, 0xE0,
+0xC0, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0x2D, 0xE0, 0x60, 0xC0, 0xE0, 0x2B, 0xC0, 0x60, 0xE0, 0x2A,
+0xE0, 0x60, 0xE0, 0x26, 0xC1, 0x63, 0xE0, 0xC0, 0xE4, 0x24, 0x60, 0x2A, 0xC0, 0x60, 0x2B, 0x60,
+0xE0, 0x21, 0xE5, 0x30, 0x90, 0xB0, 0x40, 0x90, 0x40, 0x90, 0x50, 0xB0, 0x06, 0x51, 0x0B, 0x41,
+0x0D, 0x40, 0x05, 0x40, 0xA0, 0x40, 0x50, 0xA1, 0x70, 0x30, 0x80, 0x40, 0x90, 0xB0, 0x05, 0x40,
+0x10, 0x50, 0x05, 0x31, 0xC0, 0xE0, 0x2E, 0xE0, 0xC0, 0xA0, 0xB0, 0x08, 0xB0, 0xD0, 0x50, 0x80,
+0x90, 0x00, 0x40, 0x80, 0x0F, 0x39, 0x0F, 0x39, 0x50, 0xA1, 0xB0, 0x01, 0x80, 0xA0, 0xE2, 0x23,
+0xE0, 0x60, 0x2F, 0x04, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0x2D, 0xE0, 0x60, 0x2D, 0x60, 0x2C,
+0xC1, 0x29, 0xE1, 0x60, 0xC1, 0x64, 0xC1, 0x20, 0xE1, 0xC1, 0xE0, 0x28, 0xE0, 0xC1, 0xE0, 0x28,
+0xE0, 0x20, 0x60, 0xE1, 0x21, 0xC0, 0x63, 0x30, 0x51, 0x40, 0x0C, 0x90, 0x0B, 0x90, 0x30, 0x0D,
+0x51, 0x03, 0x81, 0x06, 0xB0, 0x40, 0x80, 0xA0, 0x70, 0x05, 0xA0, 0xB0, 0x04, 0x70, 0xC2, 0xE0,
+0x2E, 0xE1, 0xA0, 0x80, 0xB0, 0x06, 0x50, 0x10, 0xB0, 0x01, 0x31, 0x80, 0x0F, 0x3A, 0x0F, 0x3A,
+0xB0, 0x70, 0x02, 0xA0, 0x40, 0x70, 0xE1, 0x22, 0xE0, 0x60, 0xC0, 0x2F, 0x02, 0xE0, 0x60, 0x2F,
+0x00, 0xE0, 0xC0, 0x60, 0xE0, 0x2C, 0xE0, 0xC1, 0x2D, 0x60, 0xE0, 0x2B, 0x60, 0xC0, 0x2B, 0x60,
+0xE0, 0x20, 0xE0, 0x23, 0xC1, 0x69, 0xC6, 0x60, 0xC5, 0x65, 0xF0, 0x62, 0xC1, 0x21, 0xE1, 0xA0,
+0x01, 0x90, 0x0C, 0x40, 0x0B, 0x90, 0x80, 0x50, 0x0D, 0x40, 0x03, 0x70, 0x0A, 0x50, 0xA0, 0x0A,
+0x50, 0x10, 0xE2, 0x60, 0xC0, 0x2E, 0xE1, 0xF0, 0x50, 0x40, 0x05, 0x40, 0xD0, 0x30, 0x90, 0x01,
+0x30, 0x40, 0x0F, 0x3B, 0x0F, 0x3C, 0xA0, 0x50, 0x30, 0xB0, 0x00, 0x90, 0xA0, 0xC0, 0xE1, 0x20,
+0x60, 0xC0, 0xE0, 0x2F, 0x01, 0xE0, 0x60, 0xC0, 0x2F, 0x00, 0xE0, 0x60, 0x2F, 0x00, 0x60, 0xE0,
+0x2C, 0xC1, 0xE0, 0x2B, 0x60, 0x2C, 0x60, 0xE0, 0x27, 0xE2, 0xC1, 0xE2, 0x20, 0xC6, 0x61, 0xC7,
+0x22, 0xE0, 0x60, 0xE4, 0x21, 0xE0, 0x60, 0x80, 0x01, 0x50, 0xB0, 0x0B, 0x50, 0xB0, 0x0A, 0x90,
+0x40, 0x90, 0x0D, 0x50, 0xB0, 0x00, 0x30, 0x11, 0x50, 0x09, 0x90, 0x30, 0x50, 0x09, 0xF1, 0xE0,
+0x22, 0x60, 0x2E, 0xE1, 0xA0, 0x50, 0x00, 0x40, 0x03, 0x80, 0xA0, 0x01, 0x30, 0x90, 0x30, 0x90,
+0x00, 0xB0, 0x0F, 0x3A, 0x0F, 0x3D, 0x70, 0x40, 0x02, 0x70, 0xA0, 0xC0, 0xE0, 0xC0, 0x60, 0x2F,
+0x04, 0x60, 0xE0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2D, 0xC1, 0xE0, 0x2C, 0x60, 0x2D, 0x60, 0x2C,
+0x60, 0xE0, 0x29, 0xE0, 0x60, 0x2A, 0xE0, 0xC1, 0xE0, 0x25, 0xE0, 0x23, 0x60, 0xE0, 0x25, 0xE0,
+0x70, 0x02, 0xB0, 0x50, 0x0B, 0xB0, 0x50, 0x0A, 0x90, 0x40, 0x50, 0x0E, 0x40, 0xD0, 0x10, 0x80,
+0xB0, 0x0B, 0x30, 0x50, 0x08, 0x40, 0x30, 0xE0, 0x23, 0xC0, 0x60, 0xE0, 0x2D, 0xC0, 0xA0, 0x01,
+0xB0, 0x90, 0x01, 0x30, 0x10, 0x40, 0x02, 0xD0, 0x90, 0x00, 0x31, 0xB0, 0x0F, 0x39, 0x0F, 0x3E,
+0x30, 0x40, 0x00, 0x70, 0xB0, 0x00, 0x70, 0x61, 0x2F, 0x03, 0xE0, 0x60, 0x2F, 0x02, 0x60, 0xE0,
+0x2E, 0x60, 0x2E, 0x60, 0x2C, 0xC1, 0x25, 0x60, 0x25, 0x60, 0x2A, 0xE0, 0x60, 0x2B, 0xC0, 0x60,
+0x2A, 0xE0, 0x60, 0xE0, 0x25, 0xE0, 0xA0, 0x03, 0x40, 0x0C, 0x90, 0x0A, 0xB0, 0xA0, 0x00, 0x50,
+0x0D, 0x30, 0xA0, 0x0E, 0x80, 0x50, 0x07, 0xF0, 0x10, 0xE1, 0x23, 0xE0, 0x60, 0x2D, 0xE0, 0x70,
+0xB0, 0x02, 0x50, 0x90, 0xA0, 0x30, 0x00, 0x30, 0x50, 0x00, 0xA0, 0xB0, 0x00, 0x50, 0x81, 0x90,
+0x0F, 0x39, 0x0F, 0x3C, 0x80, 0x40, 0x00, 0x80, 0xD0, 0xB0, 0x01, 0x30, 0x10, 0xF0, 0xE0, 0x2F,
+0x01, 0xE0, 0x60, 0xC0, 0x2F, 0x00, 0xE0, 0x60, 0xC0, 0xE0, 0x2D, 0xC1, 0x2D, 0x60, 0xC0, 0x2B,
+0xE0, 0x60, 0x26, 0xF0, 0x23, 0xE0, 0xC1, 0x2A, 0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0x60, 0x25,
+0xE0, 0x70, 0x50, 0x03, 0x40, 0x0C, 0x40, 0x0B, 0xB0, 0x70, 0x80, 0x0C, 0x40, 0x10, 0x90, 0x0E,
+0x30, 0x80, 0x06, 0x30, 0xF0, 0xE1, 0x25, 0xE0, 0x60, 0x2B, 0xE0, 0xC0, 0x30, 0x03, 0xB0, 0x11,
+0x02, 0xA0, 0x70, 0xB0, 0xA0, 0x70, 0xB0, 0x50, 0x90, 0x0F, 0x3A, 0x0F, 0x3B, 0x90, 0x31, 0xA0,
+0x00, 0x81, 0x00, 0x40, 0x10, 0x81, 0xA0, 0xE0, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2F, 0x01, 0x60,
+0xE0, 0x2D, 0xE0, 0x60, 0x2E, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xE0, 0x60,
+0x2B, 0xC0, 0x60, 0x2B, 0x60, 0xC0, 0x24, 0xE0, 0xA0, 0x04, 0x90, 0x0C, 0x51, 0x0C, 0x81, 0x00,
+0xB0, 0x40, 0x81, 0x40, 0xB1, 0x00, 0xB0, 0x00, 0x50, 0x10, 0x00, 0x50, 0xB0, 0x0C, 0xB0, 0xA0,
+0xB0, 0x90, 0x04, 0xF1, 0xE0, 0x27, 0xE0, 0xC0, 0x60, 0xE0, 0x28, 0xE0, 0xC0, 0x70, 0x50, 0x02,
+0x90, 0xD0, 0x90, 0x10, 0xD0, 0x00, 0x50, 0xA0, 0x00, 0xA0, 0x50, 0xB0, 0x10, 0x90, 0x0F, 0x3B,
+0x0F, 0x3E, 0xA0, 0x50, 0x00, 0x90, 0xA0, 0x10, 0x70, 0x01, 0x40, 0x70, 0xE1, 0x2C, 0xE0, 0x60,
+0x2F, 0x01, 0xE0, 0x60, 0x2F, 0x00, 0xC0, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x2B,
+0xE0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xC0, 0x60, 0x2B, 0xC1, 0x24, 0xE0, 0x70, 0xB0, 0x03, 0x50,
+0xB0, 0x0C, 0x90, 0x0C, 0xB0, 0x30, 0xA0, 0x30, 0x40, 0x90, 0x80, 0xD0, 0x10, 0x30, 0xA0, 0x32,
+0x50, 0x00, 0xB0, 0x90, 0x0C, 0xB0, 0xA0, 0x00, 0x40, 0x02, 0xB0, 0x80, 0xF0, 0xE0, 0x29, 0xE0,
+0x60, 0xC0, 0xE0, 0x27, 0xE0, 0xF0, 0x60, 0x02, 0x40, 0x10, 0x01, 0x90, 0x10, 0xD0, 0x80, 0x01,
+0x70, 0xB0, 0x00, 0xB0, 0x10, 0xB0, 0x0F, 0x3A, 0x0F, 0x3D, 0x40, 0xD0, 0xB0, 0x30, 0x80, 0x50,
+0x10, 0xB0, 0x01, 0xA0, 0x50, 0x70, 0xC0, 0xE0, 0x2A, 0xE0, 0x60, 0xC0, 0x2F, 0x02, 0x60, 0xE0,
+0x2D, 0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xC1, 0x2B, 0xE0, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xC0,
+0x60, 0x2B, 0xC1, 0x24, 0xE0, 0x70, 0x01, 0x90, 0xA1, 0x80, 0xB0, 0x04, 0xB0, 0x50, 0x90, 0x40,
+0x80, 0x30, 0xA2, 0x50, 0x08, 0x50, 0x31, 0xA1, 0x40, 0x00, 0x80, 0xA0, 0x80, 0x00, 0x80, 0x40,
+0x06, 0x90, 0xB0, 0x0C, 0x70, 0x01, 0x40, 0x00, 0xB0, 0x10, 0xF0, 0xE0, 0x2B, 0xE0, 0x60, 0x28,
+0xE0, 0xA0, 0x02, 0xA1, 0x80, 0x90, 0x01, 0xD0, 0x80, 0x51, 0x00, 0x80, 0x30, 0x01, 0x40, 0xA0,
+0x0F, 0x3A, 0x0F, 0x38, 0x40, 0x10, 0xD1, 0x70, 0x30, 0xB0, 0x50, 0x80, 0x40, 0xA0, 0x00, 0xA0,
+0x50, 0x30, 0x50, 0x01, 0xA0, 0xF0, 0xE0, 0x28, 0xE0, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0x60,
+0x2F, 0x01, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0x60, 0x2D, 0x60, 0x2B, 0xE0, 0x60, 0x2B, 0xC0, 0x60,
+0x2B, 0xC0, 0x60, 0x24, 0xE0, 0x70, 0xA1, 0x80, 0x01, 0x40, 0x30, 0x70, 0x33, 0x81, 0x40, 0x90,
+0x50, 0xB0, 0x01, 0x50, 0x37, 0xA0, 0xD1, 0x31, 0x40, 0x50, 0xA0, 0xD0, 0x90, 0x03, 0x30, 0x40,
+0x05, 0xB0, 0x90, 0x0C, 0xA0, 0x90, 0x00, 0x90, 0xB0, 0x00, 0xA0, 0xE0, 0x2E, 0x60, 0xE0, 0x26,
+0x60, 0x30, 0x01, 0xD0, 0x80, 0x01, 0xA0, 0x50, 0xA0, 0x90, 0x00, 0x80, 0x10, 0x01, 0x70, 0x80,
+0x01, 0x70, 0x0F, 0x3A, 0x0F, 0x39, 0x70, 0x30, 0x06, 0x70, 0x50, 0x00, 0x31, 0x02, 0x30, 0xF0,
+0xA0, 0xE1, 0x27, 0x60, 0xE0, 0x2F, 0x01, 0xC1, 0xE0, 0x2D, 0xE0, 0x60, 0x2E, 0xC1, 0x2D, 0x60,
+0xE0, 0x2B, 0xC1, 0x2C, 0x60, 0x2B, 0xC0, 0x60, 0x2C, 0x60, 0x24, 0xE0, 0x70, 0x05, 0x90, 0x0C,
+0x50, 0xB0, 0x05, 0x80, 0xA0, 0x40, 0xB0, 0x03, 0x90, 0x06, 0xD0, 0x06, 0x40, 0x0C, 0x30, 0xB0,
+0x01, 0x40, 0x00, 0x10, 0xC0, 0xE0, 0x2D, 0xC1, 0xE0, 0x25, 0x60, 0xF0, 0x50, 0x10, 0x30, 0x40,
+0x01, 0x50, 0xD0, 0xB0, 0x01, 0x40, 0xA0, 0xD0, 0x01, 0x70, 0xA1, 0x80, 0x0F, 0x3A, 0x0F, 0x3A,
+0x30, 0xA0, 0x00, 0xB0, 0x51, 0x90, 0x30, 0x70, 0x00, 0xB0, 0x00, 0x40, 0x30, 0x00, 0xA0, 0x50,
+0x00, 0x90, 0x70, 0xC0, 0xE0, 0x24, 0xE0, 0x60, 0x20, 0xE0, 0x2F, 0x01, 0x60, 0xE0, 0x2F, 0x00,
+0x60, 0xE0, 0x2D, 0x60, 0x2D, 0xC0, 0x60, 0xE0, 0x2B, 0xC1, 0x2B, 0xC0, 0x60, 0x2B, 0xC0, 0x60,
+0x2B, 0xE0, 0x60, 0x24, 0xE0, 0xA0, 0x05, 0x40, 0x0D, 0x40, 0x05, 0x40, 0x50, 0x05, 0x40, 0x06,
+0x50, 0x30, 0x05, 0xB0, 0x90, 0x0A, 0x81, 0x02, 0x51, 0xB0, 0xD0, 0xE0, 0x2D, 0xE0, 0x60, 0xC0,
+0x24, 0xE1, 0xD0, 0x70, 0x01, 0x30, 0x51, 0xA0, 0xB0, 0x02, 0x90, 0x41, 0x70, 0x30, 0x00, 0x91,
+0x0F, 0x3B, 0x0F, 0x3B, 0x90, 0x40, 0x10, 0xA1, 0x30, 0x80, 0x00, 0x80, 0xD1, 0x51, 0xD0, 0x90,
+0x02, 0xA1, 0x60, 0xE0, 0x22, 0xE0, 0xC1, 0xE0, 0x2F, 0x00, 0xE0, 0x60, 0xC0, 0x2E, 0xE0, 0x60,
+0xC0, 0x2E, 0x60, 0xE0, 0x2B, 0xE0, 0xC1, 0x2C, 0x60, 0x2C, 0xC0, 0x60, 0x2B, 0xC0, 0x60, 0x2B,
+0xE0, 0x60, 0x25, 0xC0, 0xA0, 0x04, 0x90, 0xB0, 0x0C, 0x40, 0x05, 0x40, 0x50, 0x05, 0xB0, 0x50,
+0x06, 0x40, 0xA0, 0x80, 0x50, 0x03, 0x40, 0x0A, 0x70, 0x04, 0x40, 0x00, 0x70, 0xE1, 0x2E, 0x60,
+0x23, 0xE1, 0xA0, 0x30, 0x40, 0x02, 0x70, 0x30, 0x00, 0x40, 0x80, 0x01, 0x50, 0x80, 0x50, 0x10,
+0x30, 0x0F, 0x3E, 0x0F, 0x3D, 0x31, 0x02, 0xA0, 0x30, 0x00, 0xB0, 0x70, 0x01, 0xA0, 0x90, 0x00,
+0x70, 0x01, 0x80, 0xA0, 0xE0, 0x22, 0x60, 0x2F, 0x03, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2C,
+0xE0, 0xC1, 0xE0, 0x2B, 0xE0, 0x60, 0x2D, 0x60, 0x2C, 0xC1, 0x2B, 0xC0, 0x60, 0x2B, 0xE0, 0x60,
+0x25, 0xE0, 0x60, 0xA0, 0x03, 0x50, 0xB0, 0x0C, 0x90, 0xB0, 0x04, 0x40, 0x50, 0x06, 0x40, 0x08,
+0x50, 0x70, 0x40, 0xB0, 0x01, 0x51, 0x08, 0xB0, 0x30, 0x04, 0xB0, 0x90, 0x40, 0x10, 0x60, 0xE0,
+0x2D, 0xC0, 0x60, 0xE0, 0x20, 0xE0, 0x60, 0x70, 0xB0, 0x00, 0x30, 0x50, 0x00, 0xA0, 0x40, 0x01,
+0x80, 0x10, 0x50, 0x00, 0xB0, 0x10, 0x70, 0x00, 0x30, 0xB0, 0x0F, 0x3D, 0x0F, 0x3E, 0x40, 0xD0,
+0x00, 0x80, 0xA0, 0x01, 0x90, 0xA0, 0x00, 0xB0, 0x00, 0x80, 0x70, 0x90, 0x01, 0xB0, 0x70, 0xA0,
+0xC0, 0xE0, 0x60, 0x2F, 0x03, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xC0, 0x2D, 0xE0, 0x60, 0x2E, 0x60,
+0x2D, 0x60, 0x2C, 0xC1, 0x2B, 0xC0, 0x60, 0x2B, 0xE0, 0x60, 0x26, 0xE0, 0xF1, 0x02, 0xB0, 0x50,
+0x0C, 0x51, 0x04, 0x40, 0x50, 0x06, 0x90, 0xB0, 0x09, 0x80, 0x30, 0x02, 0x40, 0x08, 0xA0, 0x40,
+0x05, 0x90, 0xB0, 0x70, 0xE0, 0x2F, 0x00, 0x60, 0xC0, 0xE0, 0xF0, 0xA0, 0x80, 0x02, 0x70, 0xA0,
+0xB0, 0x02, 0x30, 0x90, 0x10, 0xB0, 0x00, 0x40, 0x0F, 0x41, 0x0F, 0x3F, 0xB0, 0x00, 0xD0, 0xB0,
+0x01, 0xD0, 0x50, 0x90, 0x81, 0x00, 0x90, 0xA0, 0x01, 0xA0, 0x01, 0x30, 0xF0, 0xC0, 0xE0, 0x2F,
+0x01, 0xC0, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xE0, 0x2E, 0x60, 0xE0, 0x2C, 0xC1, 0x2D, 0x60, 0x2C,
+0x60, 0xC0, 0x2B, 0xC0, 0x60, 0x2B, 0xE0, 0x60, 0x26, 0xE1, 0xA0, 0x50, 0x01, 0xB0, 0x90, 0x0D,
+0x90, 0x04, 0x40, 0x90, 0x06, 0xB0, 0x90, 0x09, 0xB0, 0x30, 0x02, 0x51, 0x06, 0x80, 0x40, 0x07,
+0x40, 0x10, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0xA0, 0x40, 0x00, 0x80, 0x90, 0x00, 0x80, 0x30, 0x04,
+0x50, 0x00, 0x90, 0xD0, 0x0F, 0x43, 0x0F, 0x41, 0xD0, 0x01, 0x70, 0x80, 0x00, 0x80, 0x50, 0x30,
+0x01, 0xB0, 0xA1, 0x90, 0x01, 0x50, 0x70, 0xA0, 0xE1, 0x2E, 0xE0, 0x60, 0xE0, 0x2F, 0x00, 0xC1,
+0xE0, 0x2D, 0x60, 0xC0, 0x2D, 0x60, 0xC0, 0x2B, 0xE0, 0xC1, 0x2C, 0x60, 0xE0, 0x2B, 0xC0, 0x60,
+0x2B, 0xE0, 0x60, 0x28, 0xC0, 0xA0, 0x02, 0x90, 0x0D, 0x40, 0x04, 0x40, 0x90, 0x07, 0x40, 0x0A,
+0x81, 0x90, 0x50, 0x00, 0x90, 0x05, 0x81, 0x08, 0x50, 0xA0, 0x60, 0x2D, 0xE1, 0xF0, 0x70, 0x30,
+0x02, 0xA1, 0x40, 0x08, 0x80, 0x70, 0x0F, 0x42, 0x0F, 0x41, 0x90, 0xD1, 0x40, 0x02, 0x80, 0xB0,
+0x03, 0x30, 0x80, 0x01, 0xA0, 0x00, 0xB0, 0xA0, 0xF0, 0xE1, 0x2C, 0xC1, 0x2F, 0x00, 0xE0, 0x60,
+0x2F, 0x00, 0x60, 0x2E, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2B,
+0xE0, 0x60, 0x28, 0xE0, 0xF0, 0x80, 0x01, 0x40, 0x0D, 0x50, 0xB0, 0x03, 0x40, 0x50, 0x07, 0x50,
+0xB0, 0x0A, 0x42, 0x10, 0x81, 0x90, 0x50, 0x80, 0x31, 0x80, 0x0A, 0x30, 0x60, 0x2C, 0xE0, 0xC0,
+0x70, 0x40, 0x00, 0x80, 0x40, 0x00, 0x50, 0xA0, 0xB0, 0x0A, 0x40, 0x0F, 0x42, 0x0F, 0x4F, 0x90,
+0xA0, 0x30, 0x50, 0x01, 0x90, 0xA1, 0xC0, 0xE1, 0x2A, 0x60, 0xE0, 0x2E, 0xE0, 0xC1, 0x2D, 0xE0,
+0xC0, 0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2B,
+0xE0, 0x60, 0x29, 0xE0, 0x70, 0x01, 0x90, 0xB0, 0x0C, 0xB0, 0x50, 0x03, 0x40, 0x90, 0x07, 0xB0,
+0x90, 0x0D, 0x70, 0x30, 0x40, 0x90, 0x80, 0x50, 0x00, 0xA0, 0xB0, 0x0A, 0x30, 0xC0, 0xE0, 0x28,
+0xE2, 0xF0, 0xA0, 0x30, 0x02, 0x30, 0x80, 0x30, 0x0F, 0x50, 0x0F, 0x51, 0xA0, 0x40, 0x01, 0xA0,
+0x00, 0xB0, 0xA0, 0x60, 0xE1, 0x27, 0xE0, 0x60, 0xC0, 0x2E, 0xE0, 0x20, 0x60, 0xE0, 0x2D, 0xE0,
+0x60, 0x2E, 0xC1, 0xE0, 0x2B, 0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2C, 0xC1, 0x28,
+0xE0, 0xF0, 0x40, 0x00, 0x51, 0x0D, 0x40, 0x03, 0x40, 0x90, 0x08, 0x40, 0x0A, 0xB0, 0x80, 0xA0,
+0xB0, 0x00, 0x90, 0x03, 0x50, 0x80, 0x0A, 0xD0, 0x60, 0xE0, 0x28, 0xE0, 0xC0, 0xA0, 0x60, 0x00,
+0x41, 0x00, 0x50, 0xA0, 0x90, 0x0F, 0x51, 0x0F, 0x52, 0x40, 0xA1, 0xB0, 0x01, 0x40, 0xA1, 0xC0,
+0xE0, 0x27, 0x60, 0x2F, 0x00, 0xE0, 0xC0, 0x60, 0x2E, 0xE0, 0x60, 0x2E, 0x60, 0x20, 0xE0, 0x2B,
+0xE0, 0x60, 0x2D, 0x60, 0xE0, 0x2B, 0xC0, 0x60, 0x2C, 0xC1, 0xE0, 0x28, 0xE0, 0xA0, 0x50, 0x00,
+0x90, 0x0D, 0x40, 0x01, 0x50, 0x90, 0xA0, 0x50, 0x08, 0x51, 0x09, 0xA0, 0x50, 0x03, 0x40, 0x03,
+0xA0, 0x0A, 0xD0, 0x61, 0xE0, 0x25, 0xE1, 0xF0, 0xA1, 0x02, 0x30, 0x80, 0x30, 0x0F, 0x53, 0x0F,
+0x54, 0xA0, 0x40, 0x01, 0x70, 0x00, 0xB0, 0xA0, 0xF0, 0xE2, 0x23, 0x60, 0xE0, 0x2F, 0x00, 0xE0,
+0x60, 0xE0, 0x2E, 0xC1, 0xE0, 0x2C, 0xE0, 0x60, 0xE0, 0x2C, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x2B,
+0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x28, 0xE1, 0x70, 0x00, 0x90, 0x0D, 0x50, 0xB0, 0x80, 0x30, 0x40,
+0x50, 0x0A, 0x40, 0x07, 0xB0, 0x70, 0xB0, 0x04, 0x90, 0xB0, 0x02, 0x30, 0x50, 0x08, 0x90, 0xA0,
+0xE0, 0x60, 0x24, 0xE1, 0xC0, 0x70, 0x40, 0x00, 0x90, 0x80, 0x00, 0xB0, 0xA0, 0x40, 0x0F, 0x54,
+0x0F, 0x55, 0x40, 0x30, 0xA0, 0x02, 0x40, 0x30, 0x70, 0x60, 0xE1, 0x21, 0xC0, 0x60, 0xE0, 0x2F,
+0x00, 0xC1, 0xE0, 0x2E, 0x60, 0xE0, 0x2D, 0xE0, 0x60, 0x2D, 0xC1, 0x2D, 0x60, 0xE0, 0x2B, 0xC0,
+0x60, 0x2D, 0x60, 0xE0, 0x29, 0xE0, 0xC0, 0x70, 0x90, 0x0E, 0x50, 0x80, 0xB0, 0x0C, 0x40, 0x06,
+0x40, 0xA0, 0x06, 0xB0, 0x90, 0x02, 0xB0, 0x30, 0x07, 0x60, 0x70, 0xE1, 0x20, 0x60, 0xE0, 0x21,
+0xE0, 0xC0, 0xA0, 0x30, 0xA0, 0x02, 0x32, 0x0F, 0x56, 0x0F, 0x56, 0xB0, 0xA0, 0x40, 0x00, 0xB0,
+0x30, 0x01, 0xF0, 0x70, 0xC0, 0xE0, 0x20, 0x60, 0xE0, 0x2F, 0x00, 0xE0, 0x60, 0x2F, 0x01, 0x60,
+0xE0, 0x2D, 0xC1, 0x2D, 0x60, 0xE0, 0x2C, 0xC1, 0xE0, 0x2B, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x2A,
+0xE0, 0x60, 0xA0, 0x0E, 0x90, 0x80, 0xB0, 0x0C, 0xB0, 0x50, 0x04, 0x40, 0x80, 0x08, 0x90, 0xB0,
+0x02, 0x30, 0x05, 0x40, 0xA0, 0xF0, 0xE0, 0x21, 0xE0, 0x60, 0xC0, 0xE1, 0xF0, 0x70, 0x50, 0x00,
+0x90, 0x80, 0x00, 0xB0, 0xA0, 0x40, 0x0F, 0x57, 0x0F, 0x58, 0x40, 0xA1, 0xB0, 0x01, 0x81, 0x70,
+0x60, 0xC1, 0x20, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xE0, 0xC1, 0x2E, 0x60, 0xE0, 0x2D, 0x60,
+0xE0, 0x2C, 0xC1, 0xE0, 0x2B, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x2A, 0xE0, 0x90, 0xD0, 0x50, 0x0D,
+0x90, 0x30, 0xB0, 0x0D, 0x40, 0x04, 0xA0, 0x09, 0xB0, 0x90, 0x02, 0x30, 0x03, 0x40, 0x70, 0xF0,
+0xE1, 0x22, 0xE1, 0x60, 0xC0, 0x70, 0x40, 0x30, 0x02, 0x32, 0x0F, 0x59, 0x0F, 0x5A, 0x31, 0x00,
+0xB0, 0x30, 0x01, 0x70, 0x10, 0x60, 0xE0, 0x2E, 0xE0, 0x60, 0x2F, 0x00, 0xE0, 0x60, 0x2F, 0x00,
+0x60, 0xE0, 0x2D, 0x60, 0xE0, 0x2C, 0xC1, 0x2C, 0xC0, 0x60, 0x2D, 0x60, 0xE0, 0x2A, 0xE0, 0xC0,
+0x10, 0x40, 0x0D, 0xB0, 0x30, 0xB0, 0x0D, 0x90, 0x03, 0x81, 0x0A, 0x40, 0x02, 0x30, 0x01, 0x50,
+0x70, 0xF0, 0xE1, 0x23, 0xE2, 0xA0, 0x10, 0xB0, 0x00, 0x90, 0x80, 0x00, 0x40, 0xA0, 0x50, 0x00,
+0x31, 0x40, 0x0F, 0x56, 0x0F, 0x5B, 0xB0, 0xA0, 0x70, 0x02, 0x10, 0xA0, 0x80, 0xA0, 0xC0, 0xE0,
+0x2D, 0x60, 0x2F, 0x01, 0x60, 0x2E, 0xC1, 0xE0, 0x2D, 0x60, 0x2C, 0xE0, 0xC1, 0x2C, 0xC0, 0x60,
+0x2D, 0x60, 0xE0, 0x2A, 0xE0, 0xC0, 0x30, 0x50, 0x0E, 0xA0, 0xB0, 0x0D, 0xB0, 0x50, 0x00, 0x40,
+0xA0, 0x40, 0x0B, 0xB0, 0x90, 0x01, 0xA0, 0x00, 0x50, 0x70, 0xE1, 0x24, 0xE1, 0xF0, 0xA0, 0x60,
+0x10, 0x30, 0x01, 0x30, 0x70, 0x40, 0xB1, 0x00, 0x30, 0x80, 0x40, 0x0F, 0x56, 0x0F, 0x58, 0xB0,
+0xD0, 0x70, 0x80, 0x00, 0x40, 0x30, 0x50, 0xA0, 0x10, 0xB0, 0x00, 0x50, 0xD0, 0x30, 0xC0, 0xE0,
+0x29, 0xE0, 0x60, 0x2F, 0x01, 0xC1, 0x2D, 0xE0, 0x60, 0xC0, 0x2D, 0xC1, 0x2C, 0xE0, 0x60, 0x2D,
+0xC0, 0x60, 0x2D, 0x60, 0x2C, 0xC0, 0xF0, 0x90, 0x0E, 0x30, 0xB0, 0x0E, 0x40, 0xB0, 0xA0, 0x0E,
+0x90, 0x30, 0x80, 0xA0, 0x00, 0x70, 0x60, 0xE0, 0x23, 0xE1, 0xF0, 0x70, 0xA0, 0x01, 0xA0, 0x10,
+0xB0, 0x80, 0x30, 0xB0, 0x80, 0xA0, 0x70, 0x80, 0x00, 0x90, 0x0F, 0x57, 0x0F, 0x58, 0xB0, 0x50,
+0x00, 0x30, 0x40, 0x00, 0xB0, 0x30, 0x10, 0x80, 0x01, 0xA0, 0x00, 0x50, 0xA0, 0xF0, 0xE1, 0x28,
+0x60, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xE0, 0x60, 0x2E, 0xC1, 0xE0, 0x2B, 0xE0, 0x60, 0x2D,
+0xC0, 0x60, 0x2D, 0x60, 0x2B, 0xE0, 0xC0, 0xF0, 0x90, 0x0E, 0x80, 0xB0, 0x0E, 0x50, 0x30, 0x90,
+0x0E, 0x30, 0x40, 0x50, 0xA0, 0xB0, 0x40, 0xD0, 0xE0, 0x21, 0xE1, 0x60, 0x70, 0x40, 0x00, 0x30,
+0x02, 0x10, 0xD0, 0x50, 0x01, 0xD0, 0x01, 0xD0, 0x50, 0x0F, 0x58, 0x0F, 0x5B, 0x30, 0x80, 0x02,
+0x50, 0xA0, 0x40, 0x50, 0x30, 0x02, 0xA1, 0xF0, 0xE1, 0x25, 0xC1, 0x2F, 0x00, 0xC0, 0x60, 0xE0,
+0x2E, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0x60, 0xC0, 0x2B, 0xE0,
+0x70, 0x90, 0x0E, 0x80, 0xA0, 0x50, 0x05, 0xB0, 0xA1, 0x80, 0x03, 0x90, 0xA0, 0x0E, 0x40, 0x80,
+0x90, 0x00, 0x40, 0x50, 0x00, 0x70, 0xE2, 0xC0, 0x70, 0xF0, 0x30, 0x02, 0x30, 0xB0, 0xA0, 0x80,
+0x00, 0x81, 0x00, 0xD0, 0x01, 0xB0, 0xD0, 0x0F, 0x58, 0x0F, 0x57, 0xB0, 0x40, 0x30, 0xD0, 0xA0,
+0x00, 0x80, 0xA0, 0x10, 0x50, 0x00, 0x90, 0xD0, 0x40, 0x01, 0x30, 0x01, 0x90, 0xD0, 0xF0, 0xE1,
+0x23, 0x60, 0x2F, 0x00, 0xE0, 0x60, 0xC0, 0x2E, 0xC1, 0x2D, 0xE0, 0x60, 0x2D, 0xE0, 0x60, 0x2D,
+0xC0, 0x60, 0x2D, 0xC1, 0x2B, 0xE0, 0xC0, 0x70, 0x0E, 0x81, 0xA0, 0x05, 0xA0, 0x01, 0x50, 0x30,
+0xA0, 0x31, 0x41, 0x0E, 0x30, 0xB2, 0xA0, 0x71, 0xA0, 0xE0, 0x60, 0x70, 0xA0, 0x01, 0x30, 0xB0,
+0x00, 0xB0, 0x70, 0x30, 0x00, 0xB0, 0xD0, 0x80, 0x01, 0x30, 0x80, 0x01, 0xA0, 0x50, 0x0F, 0x57,
+0x0F, 0x56, 0x30, 0x10, 0x80, 0x90, 0xB0, 0x02, 0x80, 0xA0, 0x03, 0x40, 0xA0, 0x81, 0x01, 0x50,
+0x80, 0x90, 0x70, 0xF0, 0xC0, 0xE1, 0x60, 0xC0, 0x2F, 0x00, 0xE0, 0x60, 0xE0, 0x2E, 0x60, 0xC0,
+0x2E, 0x60, 0xE0, 0x2C, 0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0xC1, 0x2C, 0xE0, 0x70, 0xB0, 0x0D,
+0x30, 0x42, 0x03, 0x50, 0x30, 0x07, 0xB0, 0x50, 0x05, 0xB0, 0x06, 0xB0, 0xA0, 0x50, 0x30, 0x80,
+0x00, 0x81, 0xA0, 0xF0, 0x50, 0x30, 0x01, 0xB0, 0x30, 0x80, 0x30, 0x50, 0x01, 0x90, 0xA0, 0x00,
+0x41, 0x00, 0xD0, 0x50, 0x00, 0x30, 0x90, 0x0F, 0x57, 0x0F, 0x56, 0x50, 0x70, 0x30, 0x04, 0xD0,
+0xB0, 0x00, 0xB0, 0xA0, 0x70, 0xB0, 0x00, 0x30, 0xA0, 0xB0, 0x00, 0xA0, 0xB0, 0x01, 0x70, 0xA0,
+0xF0, 0xE0, 0x60, 0xE0, 0x2F, 0x00, 0xC1, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0xE0, 0x2C,
+0xE0, 0x60, 0x2D, 0xC0, 0x60, 0x2D, 0xC1, 0x2C, 0xE0, 0x70, 0x50, 0x0D, 0x30, 0x90, 0x50, 0xA0,
+0x02, 0x50, 0x70, 0xB0, 0x08, 0x40, 0x04, 0xB0, 0x10, 0xA0, 0x06, 0xB0, 0x41, 0xB0, 0x50, 0x10,
+0x70, 0x90, 0x01, 0x30, 0x50, 0x00, 0x80, 0x70, 0x50, 0x00, 0xA0, 0x50, 0x01, 0xD0, 0x70, 0x80,
+0x70, 0x30, 0x50, 0xD0, 0xA0, 0x70, 0x0F, 0x58, 0x0F, 0x58, 0x40, 0xD0, 0xB0, 0x01, 0x30, 0x80,
+0x01, 0x10, 0x90, 0x00, 0xD0, 0x02, 0x30, 0x70, 0x80, 0x01, 0x90, 0x80, 0x00, 0x90, 0x70, 0xA0,
+0xE1, 0x2D, 0xE0, 0x60, 0x2F, 0x01, 0x60, 0xE0, 0x2D, 0xC1, 0x2D, 0xC1, 0x2D, 0xC0, 0x60, 0x2D,
+0xC0, 0x60, 0x2C, 0xE0, 0xA0, 0x40, 0x0D, 0x30, 0xB0, 0xA0, 0xB0, 0x01, 0x80, 0xA0, 0x0A, 0x90,
+0x05, 0x50, 0xB0, 0x08, 0x40, 0x10, 0x30, 0x01, 0x30, 0x01, 0xB0, 0x70, 0xA0, 0x90, 0x02, 0x10,
+0xD0, 0x01, 0x30, 0x40, 0x01, 0x10, 0x01, 0x50, 0x0F, 0x59, 0x0F, 0x5C, 0xB0, 0xD0, 0x01, 0xA0,
+0x80, 0x01, 0xD0, 0x00, 0x40, 0x30, 0x90, 0x00, 0x31, 0xB0, 0xA0, 0x02, 0x30, 0x90, 0xA1, 0xC0,
+0xE1, 0x2A, 0xE0, 0x60, 0xE0, 0x2E, 0xC1, 0xE0, 0x2D, 0x60, 0xC0, 0x2C, 0xE0, 0xC1, 0x2D, 0xC0,
+0x60, 0x2E, 0x60, 0x2C, 0xE0, 0x30, 0x80, 0x0D, 0x30, 0x00, 0x80, 0x31, 0xA0, 0x40, 0x0A, 0xB0,
+0x40, 0x30, 0x0D, 0x80, 0x10, 0x81, 0x50, 0x01, 0x80, 0x90, 0x80, 0xA0, 0x90, 0x03, 0x90, 0x40,
+0x30, 0x80, 0x01, 0xB0, 0x01, 0xD0, 0x0F, 0x5C, 0x0F, 0x5C, 0x91, 0x00, 0xB0, 0xD0, 0x01, 0x50,
+0x70, 0x00, 0x30, 0x50, 0x30, 0x01, 0xB0, 0x30, 0x70, 0x50, 0x00, 0x50, 0x80, 0x01, 0x80, 0xA1,
+0x60, 0xE1, 0x27, 0xE0, 0xC1, 0x2F, 0x00, 0x60, 0x2F, 0x00, 0x60, 0xE0, 0x2C, 0xE0, 0xC1, 0x2D,
+0xC0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0x60, 0x30, 0x0D, 0x30, 0x00, 0x90, 0xB0, 0x0D, 0x11, 0x90,
+0x0A, 0x50, 0xA0, 0x70, 0xD0, 0x02, 0x30, 0x01, 0x80, 0x70, 0x90, 0x07, 0xB0, 0xD0, 0xB0, 0x00,
+0x80, 0xD0, 0x70, 0x40, 0x0F, 0x5C, 0x0F, 0x5F, 0x90, 0x30, 0x01, 0xD0, 0x50, 0x00, 0x50, 0x80,
+0x50, 0x03, 0xB0, 0x31, 0x70, 0x02, 0xA0, 0x00, 0xB0, 0x80, 0xD0, 0xF0, 0x20, 0xE0, 0x25, 0xE0,
+0x60, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2E, 0x60, 0xE0, 0x2D, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0,
+0x60, 0x2D, 0xE0, 0x70, 0xB0, 0x0C, 0x30, 0x00, 0xB0, 0x50, 0x0D, 0x90, 0x50, 0x90, 0x05, 0xB0,
+0x01, 0x90, 0x70, 0xD0, 0x90, 0x00, 0x80, 0x50, 0x01, 0x32, 0x90, 0x0A, 0x80, 0x30, 0x01, 0x50,
+0xB0, 0x0F, 0x5D, 0x0F, 0x5F, 0xB0, 0xD0, 0x50, 0x70, 0x30, 0x0B, 0x80, 0xA0, 0x51, 0x80, 0x01,
+0x90, 0x40, 0x90, 0xA1, 0xC0, 0xE1, 0x22, 0xC0, 0x60, 0xE0, 0x2F, 0x00, 0x60, 0xE0, 0x2E, 0x60,
+0xE0, 0x2D, 0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0x2E, 0xF0, 0x90, 0x0C, 0x30, 0x01, 0x90,
+0x0F, 0x00, 0xB0, 0x90, 0x02, 0x50, 0x31, 0x70, 0xD0, 0x30, 0xB0, 0xA0, 0x02, 0xA0, 0x00, 0x30,
+0xA0, 0x50, 0x0D, 0xA0, 0x0F, 0x61, 0x0F, 0x60, 0xB0, 0x30, 0x40, 0x0E, 0x80, 0xD0, 0x80, 0x01,
+0xA0, 0x02, 0xA0, 0xF0, 0xA0, 0xF0, 0xC0, 0xE1, 0xC1, 0x2F, 0x00, 0xC1, 0x2E, 0xC1, 0xE0, 0x2D,
+0xC1, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0x2D, 0xE1, 0xA0, 0xB0, 0x01, 0xB0, 0x90, 0x07, 0x30,
+0x01, 0x90, 0x0F, 0x01, 0x40, 0x01, 0x30, 0xD0, 0x71, 0xA0, 0x40, 0x01, 0x80, 0x50, 0x00, 0x50,
+0x70, 0xA0, 0xB0, 0x0F, 0x72, 0x0F, 0x74, 0x90, 0xA1, 0x80, 0x01, 0x41, 0x01, 0xA2, 0x61, 0xE1,
+0x2E, 0x60, 0x2E, 0xE0, 0xC1, 0x2E, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0x60, 0x2E, 0xE0,
+0x60, 0x70, 0x90, 0x00, 0xA0, 0x30, 0x80, 0x04, 0xB0, 0x31, 0x01, 0x40, 0x0F, 0x01, 0xB0, 0x50,
+0xA0, 0xD1, 0x50, 0x01, 0xA0, 0x01, 0xB0, 0x70, 0x30, 0x80, 0xB0, 0x0F, 0x74, 0x0F, 0x76, 0x50,
+0x80, 0xA0, 0xB0, 0x30, 0x02, 0x30, 0x01, 0xD1, 0xA0, 0xC0, 0xE3, 0x2A, 0x60, 0xE0, 0x2D, 0xE0,
+0x60, 0x2E, 0xE0, 0x60, 0xE0, 0x2D, 0xC1, 0x2D, 0xE0, 0xC1, 0x2D, 0xE0, 0x60, 0xE0, 0xA0, 0xD0,
+0x90, 0x00, 0x10, 0x80, 0x51, 0x41, 0xD0, 0xB0, 0x02, 0xB0, 0x50, 0x0E, 0x80, 0x70, 0x10, 0x80,
+0x00, 0x90, 0x40, 0x01, 0x80, 0x90, 0x80, 0xA0, 0x90, 0x0F, 0x77, 0x0F, 0x79, 0x80, 0x70, 0x80,
+0x00, 0x40, 0x90, 0x01, 0x10, 0xA0, 0xB0, 0x80, 0xD0, 0x30, 0xC0, 0xE1, 0x29, 0x60, 0xE0, 0x2D,
+0xE0, 0x60, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xC1, 0x2D, 0xE0, 0xC1, 0x2D, 0xE0, 0xC1, 0xE0, 0xF0,
+0x40, 0x01, 0x50, 0x81, 0x50, 0x40, 0xB0, 0x04, 0x40, 0x0B, 0x80, 0xD1, 0x40, 0x90, 0x10, 0x40,
+0x01, 0xA0, 0x00, 0x90, 0xA1, 0x50, 0x0F, 0x79, 0x0F, 0x7B, 0x50, 0xA0, 0xD0, 0x40, 0x00, 0x40,
+0x10, 0x50, 0x01, 0x30, 0xB0, 0xF0, 0x70, 0xF0, 0x60, 0xE3, 0x22, 0xE0, 0xC1, 0xE0, 0x2D, 0xE0,
+0x60, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xC1, 0x2D, 0xE0, 0xC1, 0x2E, 0xC1, 0xE1, 0x70, 0x0C, 0x40,
+0x07, 0x50, 0x80, 0x10, 0x70, 0x80, 0xB0, 0x80, 0x01, 0xD0, 0x10, 0x00, 0x50, 0x70, 0xA0, 0x40,
+0x02, 0xA0, 0x30, 0x90, 0x0F, 0x76, 0x0F, 0x79, 0x50, 0x30, 0x80, 0x01, 0x40, 0x30, 0xD0, 0x10,
+0x01, 0x80, 0xB0, 0x01, 0xA0, 0xB0, 0x80, 0x70, 0xA0, 0x60, 0xC0, 0xE1, 0x20, 0xE0, 0x60, 0x2F,
+0x01, 0x60, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xC0, 0x60, 0x2D, 0xE0, 0xC1, 0x2F, 0x00, 0x60, 0x20,
+0xE0, 0x60, 0x80, 0x0B, 0x90, 0xB0, 0x03, 0x50, 0x30, 0xD0, 0x70, 0x40, 0x30, 0xB0, 0x01, 0xA0,
+0x01, 0x30, 0x10, 0x30, 0x80, 0x50, 0x00, 0x40, 0x30, 0x50, 0x00, 0x30, 0x41, 0x0F, 0x76, 0x0F,
+0x79, 0xD0, 0x41, 0x70, 0x02, 0xB0, 0x80, 0xA0, 0x80, 0x70, 0x01, 0xB0, 0x30, 0x01, 0x90, 0x80,
+0x40, 0xA0, 0x70, 0x60, 0xC0, 0xE0, 0xC0, 0xE0, 0x2E, 0xC1, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xC0,
+0x60, 0x2E, 0xC1, 0x2F, 0x00, 0x60, 0x21, 0xC0, 0xA0, 0x0B, 0xB0, 0x50, 0x00, 0x90, 0xA0, 0xD0,
+0xA0, 0x90, 0xA0, 0x01, 0xB0, 0x80, 0x01, 0x81, 0x31, 0x50, 0x02, 0x40, 0xA0, 0x90, 0xD0, 0xB0,
+0x50, 0x90, 0x0F, 0x77, 0x0F, 0x7C, 0x10, 0x00, 0x80, 0xD0, 0xA0, 0x01, 0x90, 0x30, 0xA0, 0x81,
+0x90, 0x01, 0x30, 0x02, 0x30, 0x90, 0x30, 0xA0, 0x70, 0xF0, 0xE3, 0x2A, 0xC1, 0x2F, 0x00, 0x60,
+0xE0, 0x2D, 0xC0, 0x60, 0x2E, 0xC0, 0x60, 0x2E, 0xE0, 0x60, 0x21, 0xE0, 0xA0, 0x50, 0x09, 0x90,
+0x30, 0xD1, 0x80, 0x30, 0x50, 0x01, 0x30, 0xB0, 0x01, 0xA0, 0x90, 0x31, 0x40, 0x01, 0x30, 0xD0,
+0xA0, 0x00, 0xA0, 0x50, 0x00, 0x90, 0x70, 0x0F, 0x79, 0x0F, 0x7A, 0xB0, 0xA0, 0x30, 0x90, 0x70,
+0x00, 0x40, 0x30, 0x01, 0xB0, 0x00, 0xB0, 0x30, 0xA0, 0x80, 0x90, 0x30, 0x01, 0x90, 0x40, 0x01,
+0x80, 0x50, 0x90, 0xA0, 0xD0, 0xA0, 0xF0, 0xC0, 0xE4, 0x24, 0x60, 0xE0, 0x2F, 0x00, 0xC0, 0xE0,
+0x2D, 0xC0, 0x60, 0x2F, 0x00, 0x60, 0x2E, 0xE0, 0x60, 0xE0, 0x21, 0xE0, 0x70, 0x05, 0x40, 0x30,
+0x10, 0xD0, 0xA0, 0x50, 0x30, 0x02, 0x30, 0x01, 0x90, 0x80, 0x40, 0x30, 0xA0, 0x40, 0x00, 0xB0,
+0x01, 0x40, 0x30, 0x00, 0x50, 0x00, 0x81, 0x01, 0xD0, 0x0F, 0x79, 0x0F, 0x78, 0x50, 0x71, 0x40,
+0x00, 0xD0, 0x50, 0x00, 0x50, 0xA0, 0x00, 0x70, 0xA0, 0x70, 0xB0, 0x01, 0xB0, 0x80, 0xA0, 0x80,
+0x50, 0x80, 0xB0, 0x01, 0xA0, 0x01, 0xB0, 0x80, 0x00, 0x90, 0x70, 0xA0, 0x30, 0xF0, 0x60, 0xC0,
+0xE2, 0x21, 0x60, 0xE0, 0x2E, 0xC1, 0x2E, 0xC0, 0x60, 0x2F, 0x00, 0x60, 0xE0, 0x2D, 0xE0, 0x60,
+0xC0, 0xE2, 0x60, 0x80, 0x50, 0x90, 0xA0, 0x70, 0xD0, 0xA0, 0x51, 0x80, 0x01, 0x40, 0x90, 0x01,
+0x30, 0x50, 0x40, 0xA0, 0x30, 0x90, 0xB0, 0x02, 0x10, 0xB0, 0x00, 0x30, 0x40, 0x80, 0x70, 0x40,
+0xB0, 0xD0, 0x01, 0xA0, 0x90, 0x0F, 0x78, 0x0F, 0x77, 0x80, 0x10, 0x50, 0x01, 0xB0, 0xD0, 0x01,
+0x80, 0x40, 0x80, 0x30, 0x00, 0x40, 0x80, 0x00, 0x30, 0x80, 0x01, 0x50, 0x40, 0xA1, 0x40, 0x50,
+0x30, 0x01, 0x80, 0x50, 0x01, 0x30, 0x00, 0xB0, 0x40, 0x70, 0xF0, 0x70, 0xA0, 0xF0, 0xC1, 0x60,
+0xE3, 0x20, 0xE0, 0x28, 0xE0, 0xC1, 0x2E, 0xC1, 0x2F, 0x00, 0x60, 0xE1, 0x28, 0xE4, 0xC2, 0x60,
+0xA1, 0xD0, 0x71, 0x50, 0x00, 0x80, 0xB0, 0x01, 0xA0, 0x01, 0x50, 0x80, 0x50, 0x30, 0x70, 0x80,
+0x90, 0x05, 0x40, 0x10, 0x80, 0x00, 0x40, 0x10, 0x40, 0xB0, 0xD0, 0x50, 0x70, 0x40, 0x00, 0xA0,
+0x50, 0x0F, 0x78, 0x0F, 0x77, 0x50, 0x80, 0xD0, 0x70, 0x51, 0x30, 0x01, 0x10, 0x00, 0xD0, 0xB0,
+0x00, 0x40, 0x80, 0x50, 0x41, 0x50, 0x04, 0x90, 0x30, 0xA1, 0x40, 0xA0, 0x02, 0xA0, 0x01, 0x91,
+0x01, 0xA0, 0x90, 0x80, 0xD1, 0x70, 0xA0, 0xF0, 0x60, 0xE6, 0x23, 0xE0, 0x60, 0x2F, 0x00, 0xC0,
+0x60, 0x2E, 0xE0, 0x60, 0xE0, 0x23, 0xE6, 0xC0, 0x60, 0xF0, 0x71, 0x10, 0x30, 0x40, 0xA0, 0x02,
+0x30, 0x01, 0x50, 0x80, 0x01, 0x80, 0x40, 0x30, 0xA0, 0x30, 0x80, 0xB0, 0x08, 0x80, 0x00, 0xD0,
+0x01, 0x10, 0x01, 0x40, 0x30, 0x00, 0xD1, 0xA0, 0x0F, 0x79, 0x0F, 0x7A, 0x50, 0xB1, 0xD0, 0xB0,
+0x31, 0x50, 0xA0, 0x01, 0x70, 0x90, 0x00, 0x30, 0x80, 0x09, 0x90, 0x30, 0xA0, 0x30, 0x80, 0x30,
+0x01, 0x30, 0x02, 0x30, 0x01, 0xD1, 0x01, 0x70, 0x60, 0xA0, 0x71, 0xA0, 0xF1, 0x61, 0xC0, 0xE2,
+0xC0, 0xE2, 0x20, 0xE2, 0x25, 0xE0, 0x21, 0xC0, 0x60, 0xE0, 0x20, 0xE0, 0x22, 0xE0, 0x22, 0xE5,
+0x60, 0xE3, 0xC0, 0x60, 0xF1, 0xA1, 0x70, 0xA0, 0xF0, 0xA0, 0x90, 0x00, 0x40, 0x10, 0xB0, 0x00,
+0x90, 0x40, 0x01, 0x30, 0x01, 0xB0, 0xA0, 0x80, 0x30, 0xA0, 0x40, 0xB0, 0x0E, 0xA0, 0x90, 0x00,
+0x80, 0xA0, 0xB0, 0xA0, 0x40, 0x0F, 0x7D, 0x0F, 0x7D, 0x40, 0x70, 0x80, 0x00, 0x40, 0x80, 0x00,
+0xB0, 0xD0, 0x0F, 0x01, 0xB0, 0x90, 0x80, 0xA0, 0x30, 0xD0, 0x90, 0xB0, 0x50, 0x80, 0x01, 0x10,
+0xA0, 0x01, 0x30, 0x01, 0x90, 0x40, 0x00, 0xB0, 0xA0, 0x40, 0x80, 0xA0, 0x70, 0xA1, 0x70, 0x30,
+0xF1, 0x65, 0xC2, 0xE3, 0x90, 0xC0, 0xE3, 0x20, 0xC2, 0x65, 0xF1, 0xA2, 0x71, 0xF0, 0x40, 0x30,
+0x40, 0xB0, 0x00, 0xA0, 0x01, 0x40, 0x90, 0x00, 0xB0, 0x10, 0x40, 0x01, 0x30, 0xB0, 0x50, 0xA0,
+0x30, 0xA0, 0x30, 0x40, 0xB0, 0x0F, 0x03, 0x90, 0xA0, 0x01, 0x80, 0xA0, 0x40, 0x0F, 0x7E, 0x0F,
+0x81, 0xB0, 0x70, 0x40, 0xD0, 0x90, 0x0F, 0x06, 0x50, 0x40, 0x80, 0xA0, 0x70, 0x41, 0x10, 0x80,
+0x00, 0xB0, 0x80, 0x01, 0x80, 0x50, 0x01, 0xA0, 0x01, 0x91, 0x01, 0xA0, 0x50, 0x90, 0x80, 0xA0,
+0x90, 0x40, 0xD0, 0x81, 0x30, 0x70, 0xA1, 0x70, 0xA1, 0x70, 0xD0, 0xA1, 0x70, 0xA2, 0x70, 0xF0,
+0x80, 0x70, 0x60, 0x41, 0x70, 0x90, 0x50, 0x80, 0x90, 0x01, 0x30, 0x01, 0x90, 0x40, 0x01, 0x30,
+0x01, 0x50, 0x40, 0x01, 0x10, 0xA0, 0x90, 0x30, 0xD0, 0x80, 0x40, 0x50, 0xB0, 0x00, 0xB0, 0x0F,
+0x06, 0x70, 0xB0, 0x0F, 0x82, 0x0F, 0x82, 0xB0, 0x80, 0x50, 0x0F, 0x0C, 0x50, 0x90, 0x40, 0x31,
+0x71, 0x40, 0xB0, 0x80, 0xB0, 0x01, 0x30, 0x01, 0x80, 0x50, 0x01, 0x30, 0x01, 0x50, 0x40, 0x01,
+0xA0, 0x01, 0xB0, 0x80, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0x80, 0xB0, 0x01, 0x30, 0x01, 0x80,
+0x02, 0x30, 0x01, 0x40, 0x90, 0x01, 0x30, 0x01, 0x50, 0x40, 0x01, 0x80, 0x50, 0x90, 0x80, 0xD0,
+0x31, 0x80, 0x40, 0x50, 0x01, 0x80, 0xA0, 0x50, 0x00, 0x81, 0x30, 0x0F, 0x99, 0x0F, 0x9C, 0xB0,
+0x80, 0x10, 0x01, 0x90, 0x70, 0x30, 0x03, 0x50, 0x80, 0xA0, 0x32, 0x70, 0x41, 0xA0, 0x50, 0x01,
+0x30, 0x01, 0x40, 0x90, 0x01, 0x30, 0x01, 0x50, 0x80, 0x01, 0x30, 0x01, 0x30, 0x10, 0x01, 0x80,
+0xB0, 0x01, 0xA0, 0x01, 0x80, 0xB0, 0x01, 0x30, 0x01, 0x50, 0x40, 0x01, 0x70, 0x90, 0x40, 0x30,
+0x70, 0x31, 0xA0, 0x30, 0x40, 0x50, 0x01, 0xB0, 0x50, 0x40, 0x30, 0xB0, 0x81, 0xB0, 0x10, 0x00,
+0x81, 0x30, 0x0F, 0x99, 0x0F, 0x9C, 0x80, 0x30, 0x70, 0x01, 0x10, 0xB0, 0x50, 0x70, 0x00, 0xB0,
+0x30, 0x80, 0x01, 0xB0, 0x40, 0xB1, 0x50, 0x90, 0x40, 0x80, 0x30, 0xA1, 0x30, 0x80, 0xA0, 0x30,
+0x41, 0x70, 0x90, 0x50, 0x40, 0x30, 0xB1, 0xA0, 0x50, 0xB0, 0xA0, 0x10, 0x50, 0xB0, 0x30, 0x90,
+0x50, 0xB0, 0x70, 0x50, 0x90, 0x30, 0x80, 0x41, 0x70, 0x80, 0x30, 0xA0, 0x70, 0x31, 0x80, 0x40,
+0x51, 0xB1, 0x03, 0x70, 0xB0, 0x00, 0xA0, 0x30, 0x80, 0xD0, 0x00, 0xA0, 0x50, 0x00, 0x81, 0x00,
+0x50, 0x0F, 0x9A, 0x0F, 0x9D, 0x90, 0x30, 0x00, 0x90, 0xA0, 0x01, 0xD0, 0x00, 0x70, 0x90, 0x40,
+0xA0, 0x00, 0x30, 0x90, 0x80, 0x07, 0xB2, 0x50, 0x92, 0x41, 0x83, 0x30, 0x81, 0x31, 0x86, 0x41,
+0x92, 0x51, 0xB1, 0x0C, 0x80, 0x10, 0x90, 0x02, 0x90, 0x30, 0x00, 0xA0, 0x90, 0x00, 0x50, 0x70,
+0x0F, 0x9C, 0x0F, 0x9D, 0x81, 0x01, 0x10, 0xB0, 0x40, 0x10, 0x50, 0xA0, 0x01, 0xD0, 0x00, 0x31,
+0x40, 0x0F, 0x04, 0xB0, 0x02, 0xB1, 0x02, 0xB0, 0x50, 0x02, 0x40, 0xB0, 0x0F, 0x02, 0xB0, 0x82,
+0x02, 0xA0, 0x90, 0x00, 0x30, 0x40, 0x00, 0xB0, 0xD0, 0x0F, 0x9C, 0x0F, 0x9D, 0x70, 0x50, 0x01,
+0x50, 0xA0, 0x30, 0xA0, 0x80, 0x40, 0x01, 0xD0, 0x0F, 0x07, 0x40, 0xD0, 0x01, 0x30, 0x70, 0xA0,
+0x70, 0x00, 0x40, 0xD0, 0x30, 0xD0, 0x00, 0x80, 0x50, 0x30, 0x0F, 0x04, 0x90, 0x30, 0x02, 0xD0,
+0x01, 0x50, 0x70, 0x00, 0x50, 0x70, 0x0F, 0x9C, 0x0F, 0x9D, 0xD0, 0xB0, 0x00, 0x30, 0x40, 0x00,
+0x30, 0x40, 0x30, 0x90, 0x00, 0x50, 0x70, 0x0F, 0x06, 0x80, 0xA0, 0x70, 0x01, 0xD0, 0x01, 0xD0,
+0x00, 0x70, 0xB0, 0x00, 0xA0, 0x50, 0x90, 0x30, 0x80, 0x0F, 0x04, 0xB0, 0x70, 0x01, 0xB0, 0x70,
+0x02, 0x80, 0x70, 0xD0, 0x50, 0x0F, 0x9C, 0x0F, 0x9D, 0x50, 0x01, 0xB0, 0x71, 0x30, 0x00, 0x30,
+0x40, 0x00, 0x30, 0x40, 0x0F, 0x06, 0xB0, 0x00, 0x70, 0x01, 0x40, 0xD0, 0x70, 0x30, 0x00, 0xD0,
+0xB0, 0x00, 0x30, 0x40, 0x00, 0xB0, 0x0F, 0x06, 0xD0, 0xB0, 0x00, 0xB0, 0x70, 0x03, 0xB0, 0x0F,
+0x9E, 0x0F, 0xA5, 0xB0, 0xD1, 0x70, 0x0F, 0x09, 0x70, 0x01, 0xD0, 0x40, 0x90, 0xD0, 0x00, 0xD0,
+0xB0, 0x00, 0x30, 0x40, 0x0F, 0x08, 0x40, 0xB0, 0x01, 0xB0, 0x0F, 0xA3, 0x0F, 0xC2, 0x70, 0x01,
+0xD0, 0x01, 0x30, 0x90, 0x70, 0xB0, 0x00, 0xA0, 0x90, 0x0F, 0xC0, 0x0F, 0xC2, 0xD0, 0x01, 0xA0,
+0x80, 0x40, 0xD0, 0x00, 0x80, 0xA0, 0x40, 0xD0, 0x0F, 0xC1, 0x0F, 0xC2, 0x50, 0x02, 0x40, 0x80,
+0xB0, 0x01, 0x90, 0x80, 0xB0, 0x0F, 0xC1, 0x0F, 0xFF, 0x0F, 0x90};
+
+const Map_Image JM29_8000_image = {431, 429, JM29_8000_palette, JM29_8000_rows, JM29_8000_data};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+
+// A map image held as 16 colour runs, see maps/compress_map.py for the format
+struct Map_Image
+{
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *palette;
+    const uint32_t *rows; // offset of each row in data
+    const uint8_t *data;
+};
+
+// Decode count pixels of a row, starting at column x
+void map_image_decode(const Map_Image *image, int row, int x, int count, uint16_t *pixels);
+
+// Draw the whole image with its top left corner at x, y
+void map_image_draw(const Map_Image *image, int16_t x, int16_t y);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+
+// Where the large buffers live on the Teensy 4.1.
+//
+// RAM1, 512 KB of tightly coupled memory at the core's full speed, is shared between the
+// code copied to ITCM and, in DTCM, the plain globals and the stack. It holds the hot
+// working set: the candidate heap, sync accumulators and decoder bookkeeping as globals,
+// and the LDPC message arrays of bp_decode() and ms_decode() on the stack.
+//
+// RAM2, 512 KB of cached OCRAM, holds the DMAMEM statics and the malloc() heap. The
+// buffers streamed through once per gulp or per slot go there: the FFT work arrays, the
+// ingest ring, display rows, the spot history, the telemetry ring and the two spectrograms
+// from the heap. DMAMEM is not cleared at power up, so what goes there must be written
+// before it is read.
+//
+// PSRAM, if any is fitted, is much slower and takes what is optional and only touched a
+// few times a slot, that is the capture buffer, through extmem_malloc(). Without PSRAM
+// extmem_malloc() falls back on the RAM2 heap.
+
+// Code. The Teensy 4 linker copies all code to ITCM unless it is marked FLASHMEM, and
+// ITCM and DTCM share RAM1 in 32 KB banks, so every bank of code is a bank less for the
+// globals and the stack. Code that runs once or at a human pace is kept in flash with
+// COLD_CODE, where a cache miss costs nothing that matters:
+//
+//   setup() and the start up steps   ini_parse_stream() and the StationData.ini entries
+//   the calibration screen           the ADIF writer and Worked.bin loading
+//   Options_Initialize()             map preloading, memory_report()
+//
+// The hot paths are marked HOT_CODE, which keeps them in ITCM whatever the default, so
+// they never wait on flash. They are the functions behind the points that take most of
+// the time of a slot in the DWT profile (see Profile.h):
+//
+//   process_data (audio ISR)  AudioIngest::update()
+//   extract_pwr               extract_power()
+//   waterfall                 update_offset_waterfall()
+//   bp_decode, ms_decode      bp_decode(), ms_decode(), ldpc_check(),
+//                             fast_tanh(), fast_atanh()
+//   osd                       osd_decode()
+//
+// The sync search and extract_likelihood() are templates, and GCC puts their instances in
+// sections of their own whatever the attribute says. The linker script's .text* goes to
+// ITCM, so they get there all the same, as long as the default is left alone.
+//
+// A function that turns up near the top of the profile belongs in the second list, and
+// memory_report() shows what the split leaves for DTCM.
+#if defined(__IMXRT1062__)
+#include <Arduino.h>
+#define HOT_CODE FASTRUN
+#define COLD_CODE FLASHMEM
+#else // the native harness
+#define HOT_CODE
+#define COLD_CODE
+#endif
+
+// Fill the unused stack with a pattern, first thing in setup(), for stack_unused()
+void memory_begin(void);
+// Bytes at the bottom of the stack that have not been written since memory_begin()
+size_t stack_unused(void);
+// Print how much of each region is in use on the USB serial port
+void memory_report(void);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+// Power saving for portable operation. Real work reaches the loop only through interrupts:
+// an audio block from the codec, a touch, the 1 ms SysTick that the slot timing is read
+// from, the TX symbol clock and USB. When a pass of the loop leaves nothing pending it
+// waits for the next of them with WFI instead of spinning, at most a millisecond later
+// than it would have seen it otherwise.
+//
+// WFI stops the DWT cycle counter as well as the core, so micros() runs slow within a
+// millisecond spent asleep and catches up at the next SysTick. Nothing that times itself
+// with micros(), such as the RTC sync, may sleep in the middle.
+//
+// The core can also be slowed in the quiet middle of each RX slot, when it only has the
+// spectrogram rows to do, and is back at F_CPU well ahead of the early decode. The codec,
+// SPI, I2C and timer clocks do not come from the ARM clock, so only the code is slower.
+
+// Core clock for the idle part of RX slots in MHz, 0 (the default) to stay at F_CPU
+extern uint32_t Idle_MHz;
+
+// Run at Idle_MHz while idle is set, if it is, and at F_CPU otherwise
+void power_idle_clock(bool idle);
+
+// Sleep until the next interrupt
+void power_wait(void);
+
+// Watch the ON/OFF pin. Holding the button powers the Teensy off after 5 s, so a press is
+// the last chance to write out what is buffered.
+void power_begin(void);
+
+// Whether the ON/OFF button was pressed or released since the last call
+bool power_off_pressed(void);
@@ -1,18 +1,35 @@
 #pragma once
 
 #include "arm_math.h"
+#include "power_db.h"
 
 #define FFT_BASE_SIZE 1024
 #define FFT_SIZE FFT_BASE_SIZE * 2
-#define num_que_blocks 40
-#define block_size 128
 
-#define ft8_buffer 348 // arbitrary for 2.175 kc
+#define ft8_max_buffer 480     // 3 kc, as far as the 6.4 kHz front end is clear of aliases
+#define ft8_default_buffer 348 // 2.175 kc
 #define ft8_min_bin 48
 #define FFT_Resolution 6.25
 #define ft8_msg_samples 91
+#define ft8_early_samples 84 // 79 symbols of a signal starting on time plus margin for DT
 
-extern uint8_t export_fft_power[];
+// Bins of the spectrogram, each row running up to ft8_buffer * FFT_Resolution Hz. Set from
+// [Decode] Bandwidth before spectrogram_begin(), fixed from then on.
+extern int ft8_buffer;
+
+extern uint8_t *capture_fft_power; // slot being received
+extern uint8_t *export_fft_power;  // last complete slot, for ft8_decode()
+extern Power_Scale export_power_scale; // the scale export_fft_power was made on
 
 void init_DSP(void);
+
+// Allocate the two spectrograms for ft8_buffer bins, falling back on ft8_default_buffer
+// if they don't fit
+void spectrogram_begin(void);
+size_t spectrogram_size(void);
+
+// Waterfall columns of bins above ft8_min_bin and back, 2 per bin while they fit the 600
+// pixels, squeezed to fit after that
+int waterfall_x(int bin_offset);
+int waterfall_bin_offset(int x);
 void process_FT8_FFT(void);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <Arduino.h>
+
+// Cycle counts of the hot paths, taken from the DWT cycle counter. Each point keeps the
+// count, minimum, mean and maximum of its calls over a slot, together with the high water
+// marks of the audio buffers. profile_end_slot() reports them over Serial and starts over,
+// and the calibration screen shows the last report when the clock is touched.
+
+enum Profile_Point
+{
+  Profile_Process_Data,
+  Profile_Extract_Power,
+  Profile_Waterfall,
+  Profile_Sync_Rows, // the sync search done a spectrogram row at a time
+  Profile_Find_Sync, // the rest of the search, and each search after a subtraction
+  Profile_BP_Decode,
+  Profile_MS_Decode,
+  Profile_OSD,
+  Profile_AP,
+  Profile_Unpack,
+  Profile_Display_Messages,
+  Profile_PSK_I2C,
+  Profile_Points
+};
+
+struct Profile_Stats
+{
+  uint32_t calls;
+  uint32_t min_cycles;
+  uint32_t max_cycles;
+  uint64_t total_cycles;
+};
+
+void profile_begin(void);
+void profile_add(int point, uint32_t cycles);
+// Samples waiting in the audio ingest ring when a gulp is taken
+void profile_audio_backlog(int samples);
+void profile_end_slot(void);
+
+// Draw the last slot's report over the map, or put the map back
+void show_Profile_Page(bool show);
+bool profile_page_shown(void);
+
+// Times the rest of the enclosing block
+class Profile_Scope
+{
+public:
+  explicit Profile_Scope(int point) : point(point), start(ARM_DWT_CYCCNT) {}
+  ~Profile_Scope() { profile_add(point, ARM_DWT_CYCCNT - start); }
+
+private:
+  int point;
+  uint32_t start;
+};
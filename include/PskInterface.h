@@ -5,9 +5,20 @@
 #define PSK_INTERFACE_H
 
 void requestTimeSync();
+// Start a sync of the RTC to the ESP32 time, which serviceTimeSync() then runs a step at a time
 void getTime();
+void serviceTimeSync(void);
+// Whether a sync is under way, timing the ESP32's second edges with micros()
+bool timeSyncBusy(void);
 bool addSenderRecord(const char *callsign, const char *gridSquare, const char *software);
+// Queue a spot for PSK Reporter, it is sent later by sendReceivedRecords()
 bool addReceivedRecord(const char *callsign, uint32_t frequency, uint8_t snr);
+// Send one batch of queued spots to the ESP32, to be called when the loop has time to spare
+bool sendReceivedRecords(void);
+// Queue a decode for the ESP32 to pass on to WSJT-X clients on the LAN, dt from the slot start
+bool addDecodeRecord(time_t slotTime, uint16_t dialKHz, const char *message, int snr, int timeMs, int frequency);
+// Send one batch of queued decodes, all of one slot, from the same spare time as the spots
+bool sendDecodeRecords(void);
 bool sendRequest(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include <TimeLib.h>
+
+// Capture mode keeps the spectrogram of every decoded slot on the SD card, one file per slot
+// in the Capture folder named after the slot's UTC start, YYYYMMDD_HHMMSS.fft, for replaying
+// through the native build. A file is a Capture_Header followed by export_fft_power as it
+// was before any decoding; all fields are little endian.
+
+static const uint32_t kCapture_magic = 0x50385446; // "FT8P"
+
+struct __attribute__((packed)) Capture_Header
+{
+    uint32_t magic;         // kCapture_magic
+    uint16_t header_size;   // sizeof(Capture_Header), the spectrogram follows
+    uint16_t cursor_freq;   // audio offset of the TX cursor, Hz
+    uint32_t time;          // UTC start of the slot, seconds since 1970
+    uint16_t dial_khz;      // sBand_Data[band].Frequency
+    uint8_t band;           // BandIndex
+    uint8_t rows_per_block; // 4, two time offsets of two bin offsets
+    uint16_t num_blocks;    // ft8_msg_samples
+    uint16_t num_bins;      // ft8_buffer
+};
+
+extern int Capture_On; // [Decode] Capture in StationData.ini
+
+// Set aside the copy buffer once the station data is read, when capture is on
+void capture_begin(void);
+
+// Copy a finished spectrogram, before the decoder subtracts from it. Dropped if the last
+// one is still being written.
+void capture_slot(const uint8_t *power, time_t slot_time, int band, uint16_t cursor_freq);
+
+// Write a piece of the copy, from the loop's quiet middle of a slot
+void service_Capture(void);
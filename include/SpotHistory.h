@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <TimeLib.h>
+
+// Every decode is kept on the SD card in a per-day binary file, YYYYMMDD.spt, for later
+// viewing on a PC. The file is a run of slots, each a Spot_Slot_Header followed by its
+// records, so a reader can step from slot to slot without looking inside the records.
+// All fields are little endian.
+
+static const uint32_t kSpot_slot_magic = 0x53385446; // "FT8S"
+
+struct __attribute__((packed)) Spot_Slot_Header
+{
+    uint32_t magic;       // kSpot_slot_magic
+    uint32_t time;        // UTC start of the slot, seconds since 1970
+    uint8_t band;         // BandIndex
+    uint8_t count;        // records that follow
+    uint16_t record_size; // sizeof(Spot_Record), for readers of older or newer files
+};
+
+struct __attribute__((packed)) Spot_Record
+{
+    uint16_t freq_hz;   // audio offset
+    int8_t snr;         // dB, as displayed
+    uint8_t reserved;
+    int16_t sync_score;
+    uint8_t payload[10]; // the 77 bit packed message, as given to genft8()
+};
+
+static_assert(sizeof(Spot_Slot_Header) == 12, "Spot_Slot_Header is part of the file format");
+static_assert(sizeof(Spot_Record) == 16, "Spot_Record is part of the file format");
+
+// Start the records of the slot that began at slot_time
+void spot_history_begin_slot(time_t slot_time, int band);
+void spot_history_add(int freq_hz, int snr, int sync_score, const uint8_t *payload);
+// Close the slot's header, a slot without decodes leaves nothing behind
+void spot_history_end_slot(void);
+
+// Append the staged slots to the card once enough have gathered, or all of them if force
+void flush_Spot_History(bool force);
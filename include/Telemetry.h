@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+#include <TimeLib.h>
+
+// A binary stream of the decodes, the spectrogram and the profile over USB, for logging on
+// a PC without going through the ESP32. It has a USB serial port of its own, the second one
+// of the dual serial USB type, so the text of the first port is left as it is.
+//
+// Each frame is a Telemetry_Frame_Header, the payload its type describes, then the
+// CRC-16/CCITT (polynomial 0x1021, from 0xFFFF) of the header and payload. A host that
+// loses its place looks for the next sync bytes whose frame passes the check. All fields
+// are little endian. The sequence number counts every frame made, so a gap shows frames
+// dropped while the host was not keeping up.
+
+static const uint8_t kTelemetry_sync0 = 0xA5;
+static const uint8_t kTelemetry_sync1 = 0x5A;
+
+enum Telemetry_Type
+{
+    Telemetry_Slot = 1,     // Telemetry_Slot_Record, once a slot ahead of its decodes
+    Telemetry_Decode = 2,   // Telemetry_Decode_Record and the text
+    Telemetry_Spectrum = 3, // Telemetry_Spectrum_Record and its rows of bins
+    Telemetry_Profile = 4   // Telemetry_Profile_Record and a Telemetry_Profile_Point per point
+};
+
+struct __attribute__((packed)) Telemetry_Frame_Header
+{
+    uint8_t sync[2];  // kTelemetry_sync0, kTelemetry_sync1
+    uint8_t type;     // Telemetry_Type
+    uint8_t sequence;
+    uint16_t length;  // of the payload
+};
+
+struct __attribute__((packed)) Telemetry_Slot_Record
+{
+    uint32_t time;      // UTC start of the slot, seconds since 1970
+    uint32_t dial_hz;   // dial frequency
+    uint8_t band;       // BandIndex
+    uint8_t decodes;    // Telemetry_Decode frames that follow
+    uint8_t passes;
+    uint8_t was_txing;  // the decodes include our own transmission
+    uint16_t candidates;
+    uint16_t tried;
+    uint32_t decode_us;
+};
+
+struct __attribute__((packed)) Telemetry_Decode_Record
+{
+    uint32_t time;       // of the slot
+    uint16_t freq_hz;    // audio frequency
+    int16_t time_ms;     // start of the signal from the start of the slot, WSJT-X's DT is 500 ms less
+    int8_t snr;          // dB in 2500 Hz
+    uint8_t flags;       // kTelemetry_CQ, kTelemetry_To_Me
+    int16_t sync_score;
+    uint8_t payload[10]; // the 77 bits as decoded
+    uint8_t text_length; // the text follows, as on the display
+};
+
+static const uint8_t kTelemetry_CQ = 0x01;
+static const uint8_t kTelemetry_To_Me = 0x02;
+
+// A symbol's worth of spectrogram, as export_fft_power holds it: time_sub 0 freq_sub 0,
+// time_sub 0 freq_sub 1, then the same for time_sub 1, num_bins bytes each from 0 Hz.
+// A byte is the dB of power_db.h less offset_q8.
+struct __attribute__((packed)) Telemetry_Spectrum_Record
+{
+    uint16_t block; // symbol of the slot, 0 to ft8_msg_samples - 1
+    uint16_t num_bins;
+    uint8_t rows;
+    uint8_t reserved;
+    int32_t offset_q8;
+};
+
+struct __attribute__((packed)) Telemetry_Profile_Record
+{
+    uint8_t points;          // Telemetry_Profile_Point records that follow, in Profile_Point order
+    uint8_t audio_blocks;    // most audio blocks in use
+    uint16_t audio_cpu_x10;  // largest share of the CPU an audio update took, in tenths of a percent
+    uint32_t backlog;        // most samples waiting in the ingest ring
+    uint32_t stack_unused;
+};
+
+struct __attribute__((packed)) Telemetry_Profile_Point
+{
+    uint32_t calls;
+    uint32_t min_us;
+    uint32_t mean_us;
+    uint32_t max_us;
+};
+
+// [Telemetry] Decodes, Spectra and Profile in StationData.ini, all off by default
+extern int Telemetry_Decodes_On;
+extern int Telemetry_Spectra_On;
+extern int Telemetry_Profile_On;
+
+// Frames made while no host has the port open are not kept. One that does not fit what
+// is still waiting to go is dropped, so a slow host never holds up the loop.
+void telemetry_slot(time_t slot_time, int band, int num_decoded);
+void telemetry_spectrum(int block, const uint8_t *rows, int num_bins, int32_t offset_q8);
+void telemetry_profile(const Telemetry_Profile_Record *record, const Telemetry_Profile_Point *points);
+
+// Hand the USB port as much of what is waiting as it takes without blocking, from every loop
+void service_Telemetry(void);
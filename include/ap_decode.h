@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A-priori decoding. During a QSO most of the next message from the DX station is known:
+// it is addressed to us, from them, and often its last field is known as well. Fixing
+// those bits in the log likelihoods leaves belief propagation far fewer to find, which
+// decodes that message several dB below where a blind decode gives up.
+
+struct AP_Hypothesis
+{
+    uint8_t payload[10]; // 77 bits, as pack77() leaves them
+    uint8_t known[10];   // the bits of payload taken as received
+};
+
+const int kMax_AP_hypotheses = 4;
+
+// The messages mycall may expect from dxcall: any standard one, and RRR, RR73 or 73 when
+// rogers or signoff. Returns the number put in hypotheses, none for calls pack77() cannot
+// pack as a standard message.
+int ap_hypotheses(const char *mycall, const char *dxcall, bool rogers, bool signoff, AP_Hypothesis hypotheses[]);
+
+// Run bp_decode() on codeword with the known bits of each hypothesis in turn fixed, and
+// return the number of bits the first codeword found differs from codeword's hard
+// decisions in, leaving it in plain[]. -1 if none was found.
+int ap_decode(const float codeword[], const AP_Hypothesis hypotheses[], int num_hypotheses,
+              int max_iters, uint8_t plain[]);
@@ -38,5 +38,25 @@ bool autoseq_get_next_tx(char *out_text);
 /* === Populate the string for displaying the current QSO state  === */
 void autoseq_get_qso_state(char *out_text);
 
+/* === Encode the messages this QSO may send next ahead of time === */
+/* Call when the loop is idle, it encodes at most one message per call */
+void autoseq_prepare_tx(void);
+
+/* === Tones of a message encoded ahead of time, NULL if it was not === */
+const uint8_t *autoseq_cached_tones(const char *text);
+
+/* === What the DX station may send next, for a-priori decoding === */
+typedef struct
+{
+    const char *mycall;
+    const char *dxcall;
+    int dxfreq;   /* where they were last decoded, Hz */
+    bool rogers;  /* RRR or RR73 likely */
+    bool signoff; /* 73 likely */
+} autoseq_ap_t;
+
+/* Return false when no QSO is in progress */
+bool autoseq_get_ap(autoseq_ap_t *ap);
+
 /* === Slot timer / time‑out manager === */
 void autoseq_tick(void);
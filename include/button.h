@@ -44,6 +44,7 @@ int Xmit_message_Touch(void);
 void transmit_sequence(void);
 void receive_sequence(void);
 void process_touch(void);
+void begin_touch(uint8_t pin);
 void check_WF_Touch(void);
 void set_startup_freq(void);
 void terminate_transmit_armed(void);
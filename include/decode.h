@@ -10,6 +10,9 @@
 
 #include <stdint.h>
 
+#include "Process_DSP.h"
+#include "protocol.h"
+
 struct Candidate
 {
     int16_t score;
@@ -19,16 +22,64 @@ struct Candidate
     uint8_t freq_sub;
 };
 
+// State of a Costas sync search that is fed one spectrogram row at a time
+struct Sync_Search
+{
+    Candidate *heap;
+    int num_blocks;
+    int num_bins;
+    int num_candidates;
+    int min_score;
+    int heap_size;
+    int first_time_offset; // the first Costas block may be cut off by the slot start
+    int next_time_offset;  // first time offset not yet scored
+
+    // Final scores of the last three time offsets, indexed by (time_offset - first_time_offset) % 3,
+    // kept so a cell only becomes a candidate if it beats its neighbours
+    int16_t scores[3][4][ft8_max_buffer];
+};
+
+// The functions below are templates over a protocol descriptor, FT8_Protocol of protocol.h,
+// so that the symbol counts and sync layout are constants in their loops. Only the
+// FT8_Protocol ones are instantiated, in decode.cpp.
+
+// Start an incremental candidate search over a spectrogram of num_blocks rows that is still being filled
+template <typename Protocol>
+void sync_search_begin(Sync_Search *search, int num_blocks, int num_bins,
+                       int num_candidates, Candidate *heap, int min_score);
+
+// Score every time offset whose sync symbols all lie within the first num_rows rows of power.
+// A time offset reaches the heap once the one after it is scored, as it has to beat its neighbours.
+template <typename Protocol>
+void sync_search_update(Sync_Search *search, const uint8_t *power, int num_rows);
+
+// Score the time offsets that run past the last row and return the number of candidates found
+template <typename Protocol>
+int sync_search_finish(Sync_Search *search, const uint8_t *power);
+
 // Localize top N candidates in frequency and time according to their sync strength (looking at Costas symbols)
 // We treat and organize the candidate list as a min-heap (empty initially).
+template <typename Protocol>
 int find_sync(const uint8_t *power, int num_blocks, int num_bins,
-              const uint8_t *sync_map, int num_candidates, Candidate *heap,
-              int min_score);
+              int num_candidates, Candidate *heap, int min_score);
 
-// Compute log likelihood log(p(1) / p(0)) of 174 message bits
-// for later use in soft-decision LDPC decoding
+// Order a candidate list by descending sync score
+void sort_candidates(Candidate *list, int num_candidates);
 
-void extract_likelihood(const uint8_t *power, int num_bins, Candidate cand,
-                        const uint8_t *code_map, float *log174);
+// Mask the bins of a decoded signal, given its candidate and its Protocol::nn tones from gen_tones()
+template <typename Protocol>
+void subtract_signal(uint8_t *power, int num_blocks, int num_bins, Candidate cand,
+                     const uint8_t *tones);
+
+// The lowest SNR reported, as in WSJT-X
+const float kMin_snr_db = -24;
+
+// Compute log likelihood log(p(1) / p(0)) of 174 message bits
+// for later use in soft-decision LDPC decoding. The tone bins of the candidate are first
+// averaged with those of the neighbouring grid point in time and in frequency the signal
+// leans towards, if any. Returns the SNR of the candidate in dB, in a 2500 Hz bandwidth,
+// from its own tone bins.
+template <typename Protocol>
+float extract_likelihood(const uint8_t *power, int num_blocks, int num_bins, Candidate cand, float *log174);
 
 #endif /* DECODE_H_ */
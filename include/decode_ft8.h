@@ -8,25 +8,47 @@
 #ifndef DECODE_FT8_H_
 #define DECODE_FT8_H_
 
-int ft8_decode(void);
+#include "decode_passes.h"
+
+// Decode the slot, trying candidates best first until budget_ms has been used
+int ft8_decode(uint32_t budget_ms);
+
+// Decode the candidates already complete at ft8_early_samples rows, ahead of ft8_decode()
+int ft8_decode_early(void);
+
+// Incremental Costas sync search, fed with each new spectrogram row
+void ft8_sync_begin(void);
+void ft8_sync_update(int num_rows);
 
 extern int max_sync_score;
 extern int max_sync_score_index;
 extern int auto_called;
 extern int auto_logged;
 
+// What the last field of a message is, worked out once when it is decoded
 enum Sequence
 {
-    Seq_RSL = 0,
-    Seq_Locator
+    Seq_RSL = 0,   // a report
+    Seq_Locator,   // a grid
+    Seq_Roger_RSL, // R and a report
+    Seq_Rogers,    // RRR or RR73
+    Seq_73
 };
 
+// Length of the text of a decode, which is kept only if it fits the display
+const int kDecode_text_size = 20;
+
+// A message of the slot, unpacked once into new_decoded[] for the display, autoseq, PSK
+// Reporter and the map to share
 struct Decode
 {
+    uint8_t payload[10]; // 77 bits as decoded
     char call_to[14];
     char call_from[14];
     char locator[7];
+    char text[kDecode_text_size]; // empty until decode_text() formats it
     int freq_hz;
+    int time_ms; // start of the signal from the start of the slot
     int sync_score;
     int snr;
     int received_snr;
@@ -73,7 +95,13 @@ struct Called_Stations
 void process_selected_Station(int stations_decoded, int TouchIndex);
 
 void display_line(bool right, int line, MsgColor background, MsgColor textcolor, const char *text);
-void display_messages(Decode new_decoded[], int decoded_messages);
+void display_messages(int decoded_messages);
+// "call_to call_from locator" of new_decoded[index], formatted the first time it is asked for.
+// A call the call hash table resolved is shown as <CALL>, as it was sent.
+const char *decode_text(int index);
+// Copy a call of a decode without the brackets of a resolved hash, for comparing with other
+// calls and for the log. Unresolved hashes stay <nnnnnnn>. dst holds at least 14 chars.
+void copy_bare_call(char *dst, const char *call);
 void clear_rx_region(void);
 void clear_qso_region(void);
 void display_queued_message(const char *msg);
@@ -90,15 +118,22 @@ void display_logged_list(int number_calls);
 
 int check_call_list(int message_index);
 int check_log_list(int message_index);
+// Whether call is in the log on the current band
+bool worked_on_band(const char *call);
 void store_CQ_Call(void);
 void store_logged_CQ_Call(const char *call);
+// Mark a call_key() as worked on a band, for check_log_list(). True if the set was full, and
+// the least recently logged call was forgotten to make room.
+bool store_worked_call(uint32_t key, int band);
 void clear_auto_memories(void);
 
 int strindex(const char *s, const char *t);
 
 extern struct Decode new_decoded[];
-extern size_t kMax_message_length;
 extern int was_txing;
+extern int Early_Decode;
+extern int AP_Decode;
+extern uint16_t Decode_Budget_ms[];
 extern int Valid_CQ_Candidate;
 
 #endif /* DECODE_FT8_H_ */
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "decode.h"
+#include "ap_decode.h"
+
+// The candidate and pass loop of the decoder: LDPC with the OSD and a-priori fallbacks, the
+// CRC, dropping repeated payloads, and the passes that subtract what was decoded and search
+// again. Free of Arduino, so that ft8_decode() on the radio and the offline decoder in
+// native/ft8_replay.cpp run the same code, each with its own clock and decode handling.
+
+const int kMax_candidates = 80;
+const int kMax_decoded_messages = 50;
+const int kMin_score = 40; // Minimum sync score threshold for candidates
+const int kMax_decode_passes = 3;
+
+const uint32_t kEarly_budget_ms = 100; // The early pass runs while rows are still arriving
+
+extern int Decode_Passes;  // Each pass after the first subtracts what the previous ones decoded
+extern int Min_Sum_Passes; // The early pass and this many full passes use ms_decode(), the rest bp_decode()
+extern int OSD_Depth;      // 0 for no fallback
+
+// Work done by the decoder in the last slot, for tuning Decode_Budget_ms
+struct Decode_Stats
+{
+  int candidates;    // candidates found by the sync search
+  int tried;         // candidates run through LDPC
+  int skipped;       // candidates left untried when the budget ran out
+  int decoded;       // messages decoded
+  int early_decoded; // of which by the early pass
+  int osd_decoded;   // of which by osd_decode()
+  int ap_decoded;    // of which by ap_decode()
+  int passes;        // passes made, see Decode_Passes
+  uint32_t elapsed_us;
+};
+
+extern struct Decode_Stats decode_stats;
+
+// Stages timed through Decode_Hooks::stage_time
+enum Decode_Stage
+{
+  Decode_Stage_Find_Sync, // each search after a subtraction
+  Decode_Stage_Likelihood,
+  Decode_Stage_BP_Decode,
+  Decode_Stage_MS_Decode,
+  Decode_Stage_OSD,
+  Decode_Stage_AP,
+  Decode_Stage_Subtract,
+  Decode_Stages
+};
+
+struct Decode_Hooks
+{
+  uint32_t (*micros)(void); // time source of the budgets
+  void (*service)(void);    // called before each candidate, service_audio() on the radio
+
+  // A payload that passed the CRC and is new to the slot, to become decode index. Returns
+  // false to drop it, when it does not unpack or does not fit.
+  bool (*add_decode)(int index, const Candidate *cand, const uint8_t *payload, float snr);
+
+  // Optional, the ticks of stage_clock() spent in each Decode_Stage
+  uint32_t (*stage_clock)(void);
+  void (*stage_time)(int stage, uint32_t ticks);
+};
+
+// Forget the decodes of the previous slot and decode the next one with hooks, trying
+// ap_list on the candidates within kAP_freq_span_hz of ap_freq_hz
+void decode_passes_begin(const Decode_Hooks *hooks, const AP_Hypothesis *ap_list, int num_ap_hypotheses, int ap_freq_hz);
+
+// Decode the candidates of a partly received slot, the heap of its sync search, until
+// budget_us has elapsed since start_us. Those left untried go to decode_full_passes().
+int decode_early_pass(const uint8_t *power, const Candidate *heap, int heap_size, uint32_t start_us, uint32_t budget_us);
+
+// Decode the candidates of the complete slot and make up to Decode_Passes passes, subtracting
+// the decodes from power between them, until budget_us has elapsed since start_us. Candidates
+// the early pass has tried are left out. Returns the number of decodes.
+int decode_full_passes(uint8_t *power, const Candidate *heap, int num_candidates, uint32_t start_us, uint32_t budget_us);
@@ -20,4 +20,9 @@ void encode174(const uint8_t *message, uint8_t *codeword);
 // [IN] num_bits - number of bits in the sequence
 uint16_t crc(uint8_t *message, int num_bits);
 
+// Generate the Protocol::nn tones of a 77 bit payload (MSB first), for FT8_Protocol of
+// protocol.h. genft8() is the same for FT8.
+template <typename Protocol>
+void gen_tones(const uint8_t *payload, uint8_t *itone);
+
 #endif // ENCODE_H_
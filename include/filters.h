@@ -6,3 +6,8 @@
 
 extern const short FIR_I[];
 extern const short FIR_Q[];
+
+// Taps of the decimation filter in front of the FT8 spectrogram
+#define NUM_DECIMATE_COEFFS 235
+
+extern const short FIR_Decimate[];
@@ -2,41 +2,34 @@
 #ifndef INI_H_
 #define INI_H_
 
-// Define a maximum size for strings and the INI structure
+#include <stddef.h>
+
+// Longest line the reader takes, longer ones are skipped
 #define MAX_SECTION_NAME_LENGTH 32
-#define MAX_KEY_LENGTH 32
-#define MAX_VALUE_LENGTH 64
-#define MAX_SECTIONS 10
-#define MAX_KEYS_PER_SECTION 20
 #define MAX_LINE_LENGTH 128
+// Bytes asked of the source at a time
+#define INI_CHUNK_SIZE 128
 
-// Structure to hold a key-value pair
+// Key and value text in place in the reader's buffer, not zero terminated, and only good
+// for the duration of the handler call
 typedef struct
 {
-    char key[MAX_KEY_LENGTH];
-    char value[MAX_VALUE_LENGTH];
-    bool present;
-} ini_entry_t;
+    const char *text;
+    size_t length;
+} ini_view_t;
 
-// Structure to hold a section
-typedef struct
-{
-    char name[MAX_SECTION_NAME_LENGTH];
-    ini_entry_t entries[MAX_KEYS_PER_SECTION];
-    unsigned int num_entries;
-    bool present;
-} ini_section_t;
+// Called for each key = value line, section the name of the [section] it is in, "" before the first
+typedef void (*ini_handler_t)(void *user, const char *section, ini_view_t key, ini_view_t value);
+// Fill buffer with up to size bytes of the file, returning how many, 0 at the end
+typedef size_t (*ini_read_t)(void *source, char *buffer, size_t size);
 
-// Structure to hold the entire INI data
-typedef struct
-{
-    ini_section_t sections[MAX_SECTIONS];
-    unsigned int num_sections;
-} ini_data_t;
-
-void parse_ini(const char *buffer, size_t buffer_len, ini_data_t *ini_data);
-const char *get_ini_value(const ini_data_t *ini_data, const char *section_name, const char *entry_key);
-const ini_section_t *get_ini_section(const ini_data_t *ini_data, const char *section_name);
-const char *get_ini_value_from_section(const ini_section_t *section, const char *entry_key);
+// Read an INI file from source a chunk at a time, handing every entry to handler. Needs
+// no more than a line and a chunk of stack whatever the file's size. Returns the number
+// of lines skipped for being longer than MAX_LINE_LENGTH.
+int ini_parse_stream(ini_read_t read, void *source, ini_handler_t handler, void *user);
+
+bool ini_view_equals(ini_view_t view, const char *text);
+// Copy into a zero terminated string, false, leaving text empty, if it does not fit in size
+bool ini_view_copy(ini_view_t view, char *text, size_t size);
 
 #endif
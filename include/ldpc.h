@@ -2,7 +2,13 @@
 #pragma once
 
 void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok);
+// Min-sum with 8 bit messages, cheaper than bp_decode() but a little less sensitive
+void ms_decode(const float codeword[], int max_iters, uint8_t plain[], int *ok);
 
 // Packs a string of bits each represented as a zero/non-zero byte in plain[],
 // as a string of packed bits starting from the MSB of the first byte of packed[]
 void pack_bits(const uint8_t plain[], int num_bits, uint8_t packed[]);
+
+// Whether the 77 message bits of a packed codeword are all zero. That codeword passes the
+// CRC, so it is thrown away before it, as WSJT-X does.
+bool payload_is_zero(const uint8_t packed[]);
@@ -7,6 +7,8 @@
 #include <TimeLib.h>
 #include <RA8876_t3.h>
 
+#include "AudioIngest.h"
+
 extern int FT_8_counter;
 extern int ft8_marker;
 extern int WF_counter;
@@ -15,20 +17,21 @@ extern int xmit_flag;
 extern RA8876_t3 tft;
 extern AudioControlSGTL5000 sgtl5000;
 extern Si5351 si5351;
-extern AudioAmplifier amp1;
 extern AudioAmplifier in_left_amp;
+extern AudioIngest audioIngest;
 extern AudioAmplifier in_right_amp;
 
 extern char Station_Call[11];
 extern char Station_Locator[7];
 extern char Short_Station_Locator[5];
 extern int decode_flag;
+extern int early_decode_flag;
 extern uint16_t cursor_line;
 extern int Tune_On;
 extern int master_decoded;
 extern uint16_t cursor_freq;
 extern int ft8_flag;
-extern int ft8_xmit_counter;
+extern volatile int ft8_xmit_counter; // advanced by the TX symbol clock
 extern int slot_state;
 extern int target_slot;
 extern bool free_text;
@@ -36,8 +39,10 @@ extern bool tx_pressed;
 extern bool clr_pressed;
 extern int log_display_flag;
 
-extern q15_t __attribute__((aligned(4))) dsp_buffer[];
+extern q15_t *dsp_buffer;
 extern q15_t __attribute__((aligned(4))) dsp_output[];
 
 void tx_display_update(void);
+void service_audio(void);
+void align_slots_to_utc(uint32_t second_millis, time_t utc);
 time_t getTeensy3Time(void);
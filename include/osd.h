@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stdint.h>
+
+// Ordered statistics decoding of the (174,91) code, for candidates bp_decode() came close
+// on. The 91 most reliable independent bits are taken as they were received and re-encoded,
+// and then again with each one of them flipped and, at depth 2, each pair of the least
+// reliable of them. The codeword nearest the log likelihoods wins if it passes the CRC.
+// Takes the log likelihoods bp_decode() does and leaves a codeword in plain[] the same
+// way. Returns the number of bits that differ from the hard decisions, or -1 if the
+// nearest codeword failed the CRC.
+int osd_decode(const float codeword[], int depth, uint8_t plain[]);
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdint.h>
+
+// The byte scale of the spectrogram, shared by the FFT front end and the native harness
+
+// log2(1 + i / 64) in Q16
+static constexpr uint32_t log2_table[65] = {
+    0, 1466, 2909, 4331, 5732, 7112, 8473, 9814,
+    11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+    21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+    30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+    38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+    45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+    52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+    59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794,
+    65536};
+
+// The log power scale of export_fft_power, 10 * ln(10 * power + 0.1), in Q8, of the
+// squared magnitude re * re + im * im of a bin of arm_rfft_q15(), up to 2^31.
+// ln is taken as log2 from the leading one and the next 6 mantissa bits of power,
+// interpolating linearly between table entries with the 16 bits after those.
+static inline int32_t power_db_q8(uint32_t power)
+{
+  const int32_t db_of_zero = -5895;             // 10 * ln(0.1)
+  const int32_t db_of_one = 5895;               // 10 * ln(10)
+  const uint64_t db_per_octave_q24 = 116290269; // 10 * ln(2)
+
+  if (power == 0)
+    return db_of_zero;
+
+  int msb = 31 - __builtin_clz(power);
+  uint32_t mantissa = (power << (31 - msb)) << 1; // fraction after the leading one
+  uint32_t index = mantissa >> 26;
+  uint32_t frac = (mantissa >> 10) & 0xFFFF;
+
+  uint32_t log2_q16 = ((uint32_t)msb << 16) + log2_table[index] +
+                      (((log2_table[index + 1] - log2_table[index]) * frac) >> 16);
+
+  return db_of_one + (int32_t)((log2_q16 * db_per_octave_q24) >> 32);
+}
+
+// The scale a spectrogram was made on. The slot's noise floor is put at kNoise_floor_byte,
+// which leaves strong signals some 75 dB above it before they reach 255, and the weakest
+// cells clear of 0.
+const int32_t kNoise_floor_byte = 80;
+
+struct Power_Scale
+{
+  int32_t offset_q8; // taken off the dB of every cell
+  int32_t noise_q8;  // median of the bins' noise floors, in dB before the offset
+};
+
+// Average of two bins in dB, less the slot's offset, clamped to a byte
+static inline uint8_t power_byte(int32_t db1_q8, int32_t db2_q8, int32_t offset_q8)
+{
+  int scaled = (db1_q8 + db2_q8 - 2 * offset_q8) / 512;
+  return (scaled < 0) ? 0 : ((scaled > 255) ? 255 : scaled);
+}
+
+// Follow the noise floor of a bin from its dB in each row, quickly down and slowly up, so
+// that the signals passing through hardly lift it
+static inline void track_noise_floor(int32_t *floor_q8, int32_t db_q8)
+{
+  int32_t step = db_q8 - *floor_q8;
+  *floor_q8 += step < 0 ? step / 16 : step / 256;
+}
+
+// The scale for the next slot from the floors of its bins: the median floor, which the
+// bins busy with signals cannot drag far, goes to kNoise_floor_byte. The offset is never
+// below the dB of no power at all, so that silence still comes out as 0.
+static inline Power_Scale power_scale(const int32_t *floor_q8, int num_bins)
+{
+  const int32_t db_of_zero = -5895;
+  const int first_byte = db_of_zero / 256 - 1; // the bytes of the histogram start at the lowest floor
+
+  uint16_t histogram[256] = {0};
+  for (int j = 0; j < num_bins; ++j)
+  {
+    int byte = floor_q8[j] / 256 - first_byte;
+    ++histogram[(byte < 0) ? 0 : ((byte > 255) ? 255 : byte)];
+  }
+
+  int median = 0;
+  for (int count = 0; median < 255 && (count += histogram[median]) < num_bins / 2;)
+    ++median;
+
+  Power_Scale scale;
+  scale.noise_q8 = (median + first_byte) * 256;
+  scale.offset_q8 = scale.noise_q8 - kNoise_floor_byte * 256;
+  if (scale.offset_q8 < db_of_zero)
+    scale.offset_q8 = db_of_zero;
+  return scale;
+}
+
+// The noise floor in dB below a bin at full scale, for reports
+static inline float noise_dbfs(const Power_Scale *scale)
+{
+  const float db_per_unit = 0.4342945f; // 10 * log10(e), the scale is 10 * ln
+  return (scale->noise_q8 - power_db_q8(1u << 30)) / 256.0f * db_per_unit;
+}
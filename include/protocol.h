@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+// Geometry of the FT8 signal, as compile-time constants for the templates of the sync search,
+// the likelihoods, signal subtraction and tone generation.
+
+struct FT8_Protocol
+{
+    // S7 D29 S7 D29 S7, 8-GFSK
+    static constexpr int num_tones = 8;
+    static constexpr int bits_per_symbol = 3;
+    static constexpr int nn = 79; // channel symbols
+    static constexpr int nd = 58; // data symbols
+    static constexpr int num_sync_blocks = 3;
+    static constexpr int sync_length = 7;
+    static constexpr int data_block_length = 29;
+    static constexpr uint8_t sync_offsets[num_sync_blocks] = {0, 36, 72};
+    static constexpr uint8_t sync_map[num_sync_blocks][sync_length] = {
+        {3, 1, 4, 0, 6, 5, 2}, {3, 1, 4, 0, 6, 5, 2}, {3, 1, 4, 0, 6, 5, 2}};
+    static constexpr uint8_t gray_map[num_tones] = {0, 1, 3, 2, 5, 6, 4, 7};
+
+    static constexpr uint32_t slot_ms = 15000;
+    static constexpr uint32_t symbol_us = 160000;
+    static constexpr float tone_spacing_hz = 6.25f;
+};
+
+// The channel symbol that data symbol k is sent in
+template <typename Protocol>
+constexpr int data_symbol(int k)
+{
+    return k + Protocol::sync_length * (1 + k / Protocol::data_block_length);
+}
+
+// The number of a Costas block a symbol is in, -1 for data symbols
+template <typename Protocol>
+constexpr int sync_block_of(int symbol)
+{
+    return symbol % (Protocol::data_block_length + Protocol::sync_length) < Protocol::sync_length
+               ? symbol / (Protocol::data_block_length + Protocol::sync_length)
+               : -1;
+}
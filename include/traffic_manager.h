@@ -3,8 +3,16 @@
 
 #include "arm_math.h"
 
+// A transmission keys up this many symbols into the slot and ends at FT8_TX_END_SYMBOL
+#define FT8_TX_OFFSET_SYMBOLS 8
+#define FT8_TX_END_SYMBOL (80 + FT8_TX_OFFSET_SYMBOLS)
+
 void set_FT8_Tone(uint8_t ft8_tone);
 void setup_to_transmit_on_next_DSP_Flag(void);
+void start_FT8_symbol_clock(uint32_t slot_ms);
+bool FT8_tone_due(void);
+void service_FT8_tone(void);
+bool FT8_transmit_done(void);
 void tune_On_sequence(void);
 void tune_Off_sequence(void);
 void service_QSO_mode(int decoded_signals);
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# Compress an ImageConverter 565 map header into the palette and run length form read by
+# src/MapImage.cpp, written to include/<name>_rle.h
+#
+#   python3 maps/compress_map.py maps/EM29_4000.h include/EM29_4000_rle.h
+#
+# The maps are scanned drawings saved as JPEG, so each colour of the drawing comes with a
+# cloud of near shades. These are folded into a 16 colour palette with k-means, which
+# leaves long runs of the same index. Each run is one byte, the palette index in the high
+# nibble and the run length less one in the low nibble. A low nibble of 15 means the
+# length less 16 follows in the next byte. Runs stop at the end of each row, and the
+# offset of every row is kept so any part of a row can be decoded on its own.
+
+import collections
+import re
+import sys
+
+PALETTE_SIZE = 16
+
+
+def rgb(p):
+    return ((p >> 11) & 31) << 3, ((p >> 5) & 63) << 2, (p & 31) << 3
+
+
+def rgb565(c):
+    r, g, b = (min(255, max(0, int(round(v)))) for v in c)
+    return (r >> 3) << 11 | (g >> 2) << 5 | (b >> 3)
+
+
+def distance2(a, b):
+    return (a[0] - b[0]) ** 2 + (a[1] - b[1]) ** 2 + (a[2] - b[2]) ** 2
+
+
+def make_palette(counts):
+    colours = list(counts)
+    weights = [counts[c] for c in colours]
+    points = [rgb(c) for c in colours]
+
+    # Start from the commonest colour and add the ones furthest from those chosen,
+    # weighted by how often they occur, so thin black lines get a colour of their own
+    centres = [points[weights.index(max(weights))]]
+    while len(centres) < PALETTE_SIZE:
+        best = max(range(len(points)),
+                   key=lambda i: min(distance2(points[i], c) for c in centres) * weights[i] ** 0.5)
+        centres.append(points[best])
+
+    for _ in range(15):
+        sums = [[0.0, 0.0, 0.0, 0] for _ in centres]
+        for p, w in zip(points, weights):
+            s = sums[min(range(len(centres)), key=lambda j: distance2(p, centres[j]))]
+            s[0] += p[0] * w
+            s[1] += p[1] * w
+            s[2] += p[2] * w
+            s[3] += w
+        centres = [(s[0] / s[3], s[1] / s[3], s[2] / s[3]) if s[3] else c for s, c in zip(sums, centres)]
+
+    return [rgb565(c) for c in centres]
+
+
+def encode_row(indices):
+    out = bytearray()
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < 16 + 255:
+            run += 1
+        if run < 16:
+            out.append(indices[i] << 4 | (run - 1))
+        else:
+            out.append(indices[i] << 4 | 15)
+            out.append(run - 16)
+        i += run
+    return out
+
+
+def hex_lines(values, fmt, per_line):
+    return ",\n".join(", ".join(fmt % v for v in values[i:i + per_line]) for i in range(0, len(values), per_line))
+
+
+def main(source, target):
+    text = open(source).read()
+    name = re.search(r"unsigned short\s+(\w+)\s*\[", text).group(1)
+    width, height = map(int, re.search(r"Image Size\s*:\s*(\d+)x(\d+)", text).groups())
+    body = re.sub(r"//.*", "", text[text.index("{") + 1:text.rindex("}")])
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    assert len(pixels) == width * height, "%s: %d pixels for %dx%d" % (source, len(pixels), width, height)
+
+    palette = make_palette(collections.Counter(pixels))
+    points = [rgb(p) for p in palette]
+    nearest = {}
+    for p in set(pixels):
+        nearest[p] = min(range(PALETTE_SIZE), key=lambda j: distance2(rgb(p), points[j]))
+
+    data = bytearray()
+    rows = []
+    for y in range(height):
+        rows.append(len(data))
+        data += encode_row([nearest[p] for p in pixels[y * width:(y + 1) * width]])
+
+    with open(target, "w") as out:
+        out.write("// Generated by maps/compress_map.py from %s, do not edit\n" % source.split("/")[-1])
+        out.write("// Image Size : %dx%d pixels, %d bytes compressed from %d\n\n" % (width, height, len(data), 2 * len(pixels)))
+        out.write("#pragma once\n\n#include \"MapImage.h\"\n\n")
+        out.write("const uint16_t %s_palette[%d] PROGMEM = {\n%s};\n\n" % (name, PALETTE_SIZE, hex_lines(palette, "0x%04X", 8)))
+        out.write("const uint32_t %s_rows[%d] PROGMEM = {\n%s};\n\n" % (name, height, hex_lines(rows, "%u", 12)))
+        out.write("const uint8_t %s_data[%d] PROGMEM = {\n%s};\n\n" % (name, len(data), hex_lines(data, "0x%02X", 16)))
+        out.write("const Map_Image %s_image = {%d, %d, %s_palette, %s_rows, %s_data};\n" % (name, width, height, name, name, name))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1], sys.argv[2])
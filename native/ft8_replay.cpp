@@ -0,0 +1,498 @@
+// Offline FT8 decoder for the native environment: replays recorded slots through the
+// receiver's row by row sync search and the decode passes of decode_passes.cpp, early pass
+// and budget included, and reports the decodes and the time taken by each stage.
+//
+//   pio run -e native
+//   .pio/build/native/program [-p passes] [-m min_sum_passes] [-o osd_depth] [-e early] [-t budget_ms] [-b bandwidth_hz] [-a mycall dxcall freq_hz] slot.wav|slot.fft ...
+//
+// A .wav file is 16 bit mono PCM at 6400 Hz, cut into 15 s slots from its start. The first
+// 91 gulps of 1024 samples of each slot are put through a model of the fixed point front end
+// in Process_DSP.cpp. Any other file is a spectrogram written by capture mode, or a bare one
+// as held in export_fft_power.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <complex>
+#include <vector>
+
+#include "constants.h"
+#include "decode.h"
+#include "decode_passes.h"
+#include "ap_decode.h"
+#include "unpack.h"
+#include "power_db.h"
+#include "SlotCapture.h"
+
+// A QSO in progress to decode a-priori for, set with -a
+static AP_Hypothesis ap_hypotheses_list[kMax_AP_hypotheses];
+static int num_ap_hypotheses = 0;
+static int ap_freq_hz = 0;
+
+static const int kSample_rate = 6400;
+static const int kSlot_samples = kSample_rate * 15;
+static const int kGulp_samples = FFT_BASE_SIZE;
+static const int kWindow_samples = FFT_BASE_SIZE * 3;
+static const int kMax_power_bins = ft8_max_buffer * 2 + 1;
+
+// Bins of the spectrogram, set with -b or taken from a capture's header
+int ft8_buffer = ft8_default_buffer;
+
+size_t spectrogram_size(void)
+{
+  return (size_t)ft8_msg_samples * ft8_buffer * 4;
+}
+
+// The stages of decode_passes.cpp, then those of the harness
+enum Stage
+{
+  Stage_Spectrogram = Decode_Stages,
+  Stage_Sync_Search,
+  Stage_Unpack,
+  Stages
+};
+
+static const char *const stage_names[Stages] = {
+    "find_sync", "likelihood", "bp_decode", "ms_decode", "osd", "ap", "subtract", "spectrogram", "sync_search", "unpack"};
+
+struct Stage_Times
+{
+  double us[Stages];
+  int calls[Stages];
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsed_us(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static void add_time(Stage_Times *times, int stage, Clock::time_point start)
+{
+  times->us[stage] += elapsed_us(start);
+  ++times->calls[stage];
+}
+
+// The front end
+
+static int16_t saturate(long value)
+{
+  return value > 32767 ? 32767 : (value < -32768 ? -32768 : (int16_t)value);
+}
+
+static void fft(std::vector<std::complex<double>> &data)
+{
+  const size_t n = data.size();
+  for (size_t i = 1, j = 0; i < n; ++i)
+  {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(data[i], data[j]);
+  }
+
+  for (size_t length = 2; length <= n; length <<= 1)
+  {
+    std::complex<double> step = std::polar(1.0, -2 * M_PI / length);
+    for (size_t i = 0; i < n; i += length)
+    {
+      std::complex<double> w = 1;
+      for (size_t k = 0; k < length / 2; ++k)
+      {
+        std::complex<double> even = data[i + k];
+        std::complex<double> odd = data[i + k + length / 2] * w;
+        data[i + k] = even + odd;
+        data[i + k + length / 2] = even - odd;
+        w *= step;
+      }
+    }
+  }
+}
+
+static int16_t window[FFT_SIZE];
+
+static void init_window(void)
+{
+  // ft_blackman_i() of Process_DSP.cpp
+  const float alpha = 0.16f;
+  const float a0 = (1 - alpha) / 2;
+  const float a1 = 1.0f / 2;
+  const float a2 = alpha / 2;
+  for (int i = 0; i < FFT_SIZE; ++i)
+  {
+    const float x1 = cosf(2 * (float)M_PI * i / (FFT_SIZE - 1));
+    const float x2 = 2 * x1 * x1 - 1;
+    window[i] = (int16_t)((a0 - a1 * x1 + a2 * x2) * 32767.0f + 0.5f);
+  }
+}
+
+// The squared magnitudes extract_power() takes of arm_rfft_q15() for one window: the CMSIS
+// transform of this length scales its output down by 2048
+static void window_power(const int16_t *samples, uint32_t *magnitude)
+{
+  std::vector<std::complex<double>> data(FFT_SIZE);
+  for (int i = 0; i < FFT_SIZE; ++i)
+    data[i] = (samples[i] * window[i]) >> 15;
+  fft(data);
+
+  for (int j = 0; j < ft8_buffer * 2 + 1; ++j)
+  {
+    int32_t re = saturate(lrint(data[j].real() / FFT_SIZE));
+    int32_t im = saturate(lrint(data[j].imag() / FFT_SIZE));
+    magnitude[j] = (uint32_t)(re * re) + (uint32_t)(im * im);
+  }
+}
+
+// Noise floors of the bins, carried from file to file as extract_power() carries them from slot to slot
+static int32_t noise_floor_q8[ft8_max_buffer];
+static bool noise_floor_started = false;
+
+// Fill a spectrogram as extract_power() does, gulp by gulp, from the samples of one slot.
+// Without a power to fill only the noise floors are followed.
+static void build_spectrogram(const int16_t *slot, int slot_samples, uint8_t *power, Power_Scale scale)
+{
+  int16_t window_samples[kWindow_samples];
+  uint32_t magnitude[kMax_power_bins];
+
+  for (int gulp = 0; gulp < ft8_msg_samples; ++gulp)
+  {
+    // The window ends with the gulp, the audio before the slot is taken as silence
+    int first = (gulp + 1) * kGulp_samples - kWindow_samples;
+    for (int i = 0; i < kWindow_samples; ++i)
+    {
+      int sample = first + i;
+      window_samples[i] = (sample >= 0 && sample < slot_samples) ? slot[sample] : 0;
+    }
+
+    for (int time_sub = 0; time_sub < 2; ++time_sub)
+    {
+      window_power(window_samples + time_sub * FFT_BASE_SIZE / 2, magnitude);
+
+      int32_t db_low = power_db_q8(magnitude[0]);
+      for (int j = 0; j < ft8_buffer; ++j)
+      {
+        int32_t db_mid = power_db_q8(magnitude[j * 2 + 1]);
+        int32_t db_high = power_db_q8(magnitude[j * 2 + 2]);
+        if (time_sub == 0)
+          track_noise_floor(&noise_floor_q8[j], (db_low + db_mid) / 2);
+        if (power != NULL)
+        {
+          uint8_t *row0 = power + (gulp * 4 + time_sub * 2) * ft8_buffer;
+          row0[j] = power_byte(db_low, db_mid, scale.offset_q8);
+          row0[j + ft8_buffer] = power_byte(db_mid, db_high, scale.offset_q8);
+        }
+        db_low = db_high;
+      }
+    }
+  }
+}
+
+// The spectrogram of a slot on the scale the noise floors give. The floors are first
+// settled on the slot itself, as if the band had been heard for a slot already.
+static void slot_spectrogram(const int16_t *slot, int slot_samples, uint8_t *power)
+{
+  if (!noise_floor_started)
+  {
+    Power_Scale fixed = {0, 0};
+    for (int j = 0; j < ft8_max_buffer; ++j)
+      noise_floor_q8[j] = kNoise_floor_byte * 256;
+    build_spectrogram(slot, slot_samples, NULL, fixed);
+    noise_floor_started = true;
+  }
+  Power_Scale scale = power_scale(noise_floor_q8 + ft8_min_bin, ft8_buffer - ft8_min_bin);
+  build_spectrogram(slot, slot_samples, power, scale);
+}
+
+// The decoder, as ft8_decode_early() and ft8_decode() run it without the display
+
+struct Decoded
+{
+  Candidate cand;
+  char message[40];
+  int snr;
+};
+
+// Decodes and stage times of the slot being decoded
+static Decoded decoded[kMax_decoded_messages];
+static Stage_Times *slot_times;
+
+static const Clock::time_point clock_start = Clock::now();
+
+static uint32_t micros_now(void)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - clock_start).count();
+}
+
+static uint32_t nanos_now(void)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - clock_start).count();
+}
+
+static void stage_time(int stage, uint32_t nanos)
+{
+  slot_times->us[stage] += nanos / 1000.0;
+  ++slot_times->calls[stage];
+}
+
+static bool add_decode(int index, const Candidate *cand, const uint8_t *payload, float snr)
+{
+  Clock::time_point start = Clock::now();
+  char call_to[14], call_from[14], locator[7];
+  int rc = unpack77_fields(payload, call_to, call_from, locator);
+  add_time(slot_times, Stage_Unpack, start);
+  if (rc < 0)
+    return false;
+
+  Decoded *entry = &decoded[index];
+  entry->cand = *cand;
+  entry->snr = (int)lrintf(snr);
+  snprintf(entry->message, sizeof(entry->message), "%s %s %s", call_to, call_from, locator);
+  return true;
+}
+
+static const Decode_Hooks decode_hooks = {micros_now, NULL, add_decode, nanos_now, stage_time};
+
+// Search the slot row by row as it would arrive, with the early pass at ft8_early_samples
+// rows if early, and decode it within budget_ms, or without a budget if 0
+static int decode_slot(uint8_t *power, bool early, uint32_t budget_ms, Stage_Times *times)
+{
+  static Candidate heap[kMax_candidates];
+  Sync_Search search;
+  slot_times = times;
+  uint32_t early_start_us = micros_now();
+  decode_passes_begin(&decode_hooks, ap_hypotheses_list, num_ap_hypotheses, ap_freq_hz);
+
+  Clock::time_point start = Clock::now();
+  sync_search_begin<FT8_Protocol>(&search, ft8_msg_samples, ft8_buffer, kMax_candidates, heap, kMin_score);
+  for (int rows = 1; rows <= ft8_early_samples; ++rows)
+    sync_search_update<FT8_Protocol>(&search, power, rows);
+  add_time(times, Stage_Sync_Search, start);
+
+  if (early)
+    decode_early_pass(power, heap, search.heap_size, early_start_us, budget_ms > 0 ? kEarly_budget_ms * 1000 : UINT32_MAX);
+
+  uint32_t start_us = micros_now();
+  start = Clock::now();
+  for (int rows = ft8_early_samples + 1; rows <= ft8_msg_samples; ++rows)
+    sync_search_update<FT8_Protocol>(&search, power, rows);
+  int num_candidates = sync_search_finish<FT8_Protocol>(&search, power);
+  add_time(times, Stage_Sync_Search, start);
+
+  return decode_full_passes(power, heap, num_candidates, start_us, budget_ms > 0 ? budget_ms * 1000 : UINT32_MAX);
+}
+
+// Files
+
+static bool ends_with(const char *name, const char *suffix)
+{
+  size_t name_length = strlen(name);
+  size_t suffix_length = strlen(suffix);
+  return name_length >= suffix_length && strcmp(name + name_length - suffix_length, suffix) == 0;
+}
+
+static bool read_file(const char *name, std::vector<uint8_t> *contents)
+{
+  FILE *file = fopen(name, "rb");
+  if (file == NULL)
+    return false;
+  uint8_t buffer[4096];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    contents->insert(contents->end(), buffer, buffer + count);
+  fclose(file);
+  return true;
+}
+
+static uint32_t read_le(const uint8_t *p, int bytes)
+{
+  uint32_t value = 0;
+  for (int i = bytes - 1; i >= 0; --i)
+    value = value << 8 | p[i];
+  return value;
+}
+
+// The samples of a 16 bit mono 6400 Hz WAV file
+static bool wav_samples(const char *name, const std::vector<uint8_t> &contents, std::vector<int16_t> *samples)
+{
+  if (contents.size() < 12 || memcmp(&contents[0], "RIFF", 4) != 0 || memcmp(&contents[8], "WAVE", 4) != 0)
+  {
+    fprintf(stderr, "%s: not a WAV file\n", name);
+    return false;
+  }
+
+  bool format_ok = false;
+  for (size_t pos = 12; pos + 8 <= contents.size();)
+  {
+    uint32_t chunk_size = read_le(&contents[pos + 4], 4);
+    const uint8_t *chunk = &contents[pos + 8];
+    if (memcmp(&contents[pos], "fmt ", 4) == 0 && chunk_size >= 16)
+    {
+      format_ok = read_le(chunk, 2) == 1 && read_le(chunk + 2, 2) == 1 &&
+                  read_le(chunk + 4, 4) == kSample_rate && read_le(chunk + 14, 2) == 16;
+    }
+    else if (memcmp(&contents[pos], "data", 4) == 0)
+    {
+      if (!format_ok)
+        break;
+      size_t count = (chunk_size < contents.size() - pos - 8 ? chunk_size : contents.size() - pos - 8) / 2;
+      for (size_t i = 0; i < count; ++i)
+        samples->push_back((int16_t)read_le(chunk + i * 2, 2));
+      return true;
+    }
+    pos += 8 + chunk_size + (chunk_size & 1);
+  }
+
+  fprintf(stderr, "%s: needs 16 bit mono PCM at %d Hz\n", name, kSample_rate);
+  return false;
+}
+
+static void print_times(const char *label, const Stage_Times *times, int slots)
+{
+  printf("%s", label);
+  for (int i = 0; i < Stages; ++i)
+  {
+    if (times->calls[i] > 0)
+      printf(" %s %.0f us (%d),", stage_names[i], times->us[i] / slots, times->calls[i] / slots);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  int early = 1;          // Early_Decode
+  uint32_t budget_ms = 0; // Decode_Budget_ms, none by default
+  int first_file = 1;
+  while (first_file + 1 < argc && argv[first_file][0] == '-')
+  {
+    if (strcmp(argv[first_file], "-p") == 0)
+      Decode_Passes = atoi(argv[first_file + 1]);
+    else if (strcmp(argv[first_file], "-m") == 0)
+      Min_Sum_Passes = atoi(argv[first_file + 1]);
+    else if (strcmp(argv[first_file], "-o") == 0)
+      OSD_Depth = atoi(argv[first_file + 1]);
+    else if (strcmp(argv[first_file], "-e") == 0)
+      early = atoi(argv[first_file + 1]);
+    else if (strcmp(argv[first_file], "-t") == 0)
+      budget_ms = (uint32_t)atoi(argv[first_file + 1]);
+    else if (strcmp(argv[first_file], "-b") == 0)
+      ft8_buffer = (int)(atoi(argv[first_file + 1]) / 6.25f);
+    else if (strcmp(argv[first_file], "-a") == 0 && first_file + 3 < argc)
+    {
+      // As if in a QSO with dxcall, expecting anything from a report to 73
+      num_ap_hypotheses = ap_hypotheses(argv[first_file + 1], argv[first_file + 2], true, true, ap_hypotheses_list);
+      ap_freq_hz = atoi(argv[first_file + 3]);
+      if (num_ap_hypotheses == 0)
+        fprintf(stderr, "-a: cannot pack %s %s\n", argv[first_file + 1], argv[first_file + 2]);
+      first_file += 2;
+    }
+    else
+      break;
+    first_file += 2;
+  }
+  if (first_file >= argc || Decode_Passes < 1 || Decode_Passes > kMax_decode_passes || Min_Sum_Passes < 0 ||
+      OSD_Depth < 0 || OSD_Depth > 2 ||
+      ft8_buffer < ft8_min_bin + 100 || ft8_buffer > ft8_max_buffer)
+  {
+    fprintf(stderr, "usage: %s [-p passes] [-m min_sum_passes] [-o osd_depth] [-e early] [-t budget_ms] [-b bandwidth_hz] [-a mycall dxcall freq_hz] slot.wav|slot.fft ...\n", argv[0]);
+    return 2;
+  }
+
+  init_window();
+
+  Stage_Times total = {};
+  int total_slots = 0;
+  int total_decoded = 0;
+  std::vector<uint8_t> power;
+
+  for (int f = first_file; f < argc; ++f)
+  {
+    const char *name = argv[f];
+    std::vector<uint8_t> contents;
+    if (!read_file(name, &contents))
+    {
+      fprintf(stderr, "%s: cannot read\n", name);
+      return 1;
+    }
+
+    std::vector<int16_t> samples;
+    bool is_wav = ends_with(name, ".wav") || ends_with(name, ".WAV");
+    if (is_wav && !wav_samples(name, contents, &samples))
+      return 1;
+    size_t spectrogram_start = 0;
+    if (!is_wav && contents.size() > sizeof(Capture_Header))
+    {
+      // A capture is replayed at the bandwidth it was made with
+      Capture_Header header;
+      memcpy(&header, contents.data(), sizeof(header));
+      if (header.magic == kCapture_magic && header.header_size == sizeof(header) &&
+          header.num_blocks == ft8_msg_samples && header.num_bins <= ft8_max_buffer &&
+          contents.size() == sizeof(header) + (size_t)ft8_msg_samples * header.num_bins * 4)
+      {
+        ft8_buffer = header.num_bins;
+        spectrogram_start = sizeof(header);
+        printf("%s: %u kHz, band %u, cursor %u Hz, slot at %lu\n", name, header.dial_khz, header.band,
+               header.cursor_freq, (unsigned long)header.time);
+      }
+    }
+    if (!is_wav && contents.size() != spectrogram_start + spectrogram_size())
+    {
+      fprintf(stderr, "%s: a spectrogram is %u bytes, not %u\n", name, (unsigned)spectrogram_size(), (unsigned)contents.size());
+      return 1;
+    }
+    power.resize(spectrogram_size());
+
+    int slots = is_wav ? 0 : 1;
+    if (is_wav)
+      for (size_t start = 0; start + ft8_msg_samples * kGulp_samples <= samples.size(); start += kSlot_samples)
+        ++slots;
+
+    for (int slot = 0; slot < slots; ++slot)
+    {
+      Stage_Times times = {};
+      if (is_wav)
+      {
+        Clock::time_point start = Clock::now();
+        size_t first = (size_t)slot * kSlot_samples;
+        slot_spectrogram(&samples[first], (int)(samples.size() - first), power.data());
+        add_time(&times, Stage_Spectrogram, start);
+      }
+      else
+      {
+        memcpy(power.data(), contents.data() + spectrogram_start, spectrogram_size());
+      }
+
+      int num_decoded = decode_slot(power.data(), early != 0, budget_ms, &times);
+
+      printf("%s slot %d: %d decoded\n", name, slot, num_decoded);
+      for (int i = 0; i < num_decoded; ++i)
+      {
+        const Candidate *cand = &decoded[i].cand;
+        float freq_hz = (cand->freq_offset + cand->freq_sub / 2.0f) * 6.25f;
+        printf("  %4d %+4d dB %7.1f Hz %5.1f sym  %s\n", cand->score, decoded[i].snr, freq_hz,
+               cand->time_offset + cand->time_sub / 2.0f, decoded[i].message);
+      }
+      print_times(" ", &times, 1);
+
+      for (int i = 0; i < Stages; ++i)
+      {
+        total.us[i] += times.us[i];
+        total.calls[i] += times.calls[i];
+      }
+      ++total_slots;
+      total_decoded += num_decoded;
+    }
+  }
+
+  if (total_slots > 0)
+  {
+    printf("%d slots, %.1f decodes per slot\n", total_slots, (double)total_decoded / total_slots);
+    print_times("per slot:", &total, total_slots);
+  }
+  return 0;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+// Nothing of the audio library is used by the modules built for the native harness
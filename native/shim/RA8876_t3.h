@@ -0,0 +1,3 @@
+#pragma once
+
+// Nothing of the display is used by the modules built for the native harness
@@ -0,0 +1,3 @@
+#pragma once
+
+class String;
@@ -0,0 +1,9 @@
+#pragma once
+
+// The CMSIS types the decode modules see, the harness models the FFT itself
+#include <stdint.h>
+#include <math.h>
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef float float32_t;
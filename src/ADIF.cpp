@@ -8,6 +8,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
+#include <ctype.h>
 
 #include <SD.h>
 #include <RA8876_t3.h>
@@ -26,15 +27,22 @@
 #include "main.h"
 #include "Maps.h"
 #include "Geodesy.h"
+#include "CallSet.h"
+#include "DisplayQueue.h"
+#include "MemoryMap.h"
 
 static const double EARTH_RAD = 6371; // radius in km
 
-#include "EM29_4000.h"  //the picture
-#include "EM29_8000.h"  //the picture
-#include "EM29_16000.h" //the picture
-#include "JM29_4000.h"  //the picture
-#include "JM29_8000.h"  //the picture
-#include "JM29_16000.h" //the picture
+#include "EM29_4000_rle.h"  //the picture
+#include "EM29_8000_rle.h"  //the picture
+#include "EM29_16000_rle.h" //the picture
+#include "JM29_4000_rle.h"  //the picture
+#include "JM29_8000_rle.h"  //the picture
+#include "JM29_16000_rle.h" //the picture
+
+// Image of each MapFiles entry
+static const Map_Image *map_images[] = {&EM29_4000_image, &EM29_8000_image, &EM29_16000_image,
+                                        &JM29_4000_image, &JM29_8000_image, &JM29_16000_image};
 
 static char log_rtc_date_string[9];
 static char log_rtc_time_string[9];
@@ -63,11 +71,53 @@ static float Station_Latitude, Station_Longitude;
 static float Map_Latitude, Map_Longitude;
 static float Target_Latitude, Target_Longitude;
 
+// Map vectors of grids already plotted, direct mapped by grid and map
+struct Grid_Vector
+{
+  uint16_t grid; // grid_index()
+  int8_t map;    // MapFiles index + 1, 0 when empty
+  float distance;
+  float bearing;
+};
+static const int grid_cache_size = 512;
+static Grid_Vector grid_cache[grid_cache_size];
+static int map_center_index = -1; // map whose centre is in Map_Latitude and Map_Longitude
+
+// Stations heard over the last few slots, drawn on the map as dots that fade with age.
+// A dot is taken off by putting back the map image under it, so a slot only touches a few
+// small patches of the screen rather than the whole map.
+struct Heard_Spot
+{
+  char locator[5];
+  int16_t x, y; // centre of the dot
+  uint8_t age;  // slots since last heard
+  bool redraw;
+};
+static const int max_heard_spots = 96;
+static const int heard_spot_radius = 2;
+static const int heard_patch_size = 2 * heard_spot_radius + 1;
+static const uint8_t heard_spot_ages = 8; // two minutes
+static const uint16_t heard_spot_colors[4] = {0xFFE0, 0xBDE0, 0x7BE0, 0x39E0}; // yellow, fading
+static Heard_Spot heard_spots[max_heard_spots];
+static int num_heard = 0;
+static const Map_Image *map_image = NULL;
+
 static float QTH_Distance;
 static float QTH_Bearing;
 
 static File Log_File;
 
+// Whole ADIF records waiting for flush_ADIF_Log(), which runs in every quiet RX window.
+// A record is up to 300 bytes and a QSO is logged at most once a slot, so room for
+// several means a record never has to go to the card at TX time.
+static char log_buffer[2048];
+static size_t log_buffered = 0;
+
+// Worked-before records waiting for flush_ADIF_Log()
+static const char *worked_file_name = "Worked.bin";
+static Worked_Record worked_buffer[16];
+static int worked_buffered = 0;
+
 // convert degrees to radians
 inline double deg2rad(double deg)
 {
@@ -91,34 +141,106 @@ void make_time(void)
   sprintf(log_rtc_time_string, "%02i%02i%02i", hour(), minute(), second());
 }
 
-void make_File_Name(void)
+COLD_CODE void make_File_Name(void)
 {
   make_date();
   sprintf((char *)file_name_string, "%s.adi", log_rtc_date_string);
 }
 
-static void write_log_data(char *data)
+static void flush_Worked_Index(void)
 {
-  Log_File = SD.open(file_name_string, FILE_WRITE);
-  Log_File.println(data);
-  Log_File.close();
+  if (worked_buffered == 0)
+    return;
+
+  File worked_file = SD.open(worked_file_name, FILE_WRITE);
+  if (worked_file)
+  {
+    worked_file.write((const uint8_t *)worked_buffer, worked_buffered * sizeof(Worked_Record));
+    worked_file.close();
+  }
+  worked_buffered = 0;
 }
 
-void Open_Log_File(void)
+void flush_ADIF_Log(void)
+{
+  flush_Worked_Index();
+
+  if (log_buffered == 0)
+    return;
+
+  if (Log_File)
+  {
+    Log_File.write((const uint8_t *)log_buffer, log_buffered);
+    Log_File.flush(); // one directory update for the lot
+  }
+  log_buffered = 0;
+}
+
+COLD_CODE void load_Worked_Index(void)
+{
+  File worked_file = SD.open(worked_file_name, FILE_READ);
+  if (!worked_file)
+    return;
+
+  // Large sequential reads, a part record left by a power cut is ignored
+  Worked_Record records[128];
+  int loaded = 0;
+  int forgotten = 0;
+  int bytes_read;
+  while ((bytes_read = worked_file.read(records, sizeof(records))) > 0)
+  {
+    int count = bytes_read / sizeof(Worked_Record);
+    for (int i = 0; i < count; ++i)
+      if (store_worked_call(records[i].key, records[i].band))
+        ++forgotten;
+    loaded += count;
+    if (bytes_read < (int)sizeof(records))
+      break;
+  }
+  worked_file.close();
+
+  Serial.printf("worked before: %d QSOs loaded\n", loaded);
+  if (forgotten > 0)
+    Serial.printf("worked before: full, the %d least recently logged calls are forgotten\n", forgotten);
+}
+
+// Stage a line for the log file, it reaches the card with the next flush_ADIF_Log()
+static void write_log_data(const char *data)
+{
+  size_t length = strlen(data);
+  if (log_buffered + length + 2 > sizeof(log_buffer))
+  {
+    // Only if the quiet windows have been missed for many slots, the record is not lost
+    Serial.printf("ADIF: log buffer full, %u bytes written at once\n", (unsigned)log_buffered);
+    flush_ADIF_Log();
+  }
+
+  memcpy(log_buffer + log_buffered, data, length);
+  log_buffered += length;
+  log_buffer[log_buffered++] = '\r';
+  log_buffer[log_buffered++] = '\n';
+}
+
+// The log file stays open from here on, until the next Init_Log_File()
+COLD_CODE void Open_Log_File(void)
 {
   Log_File = SD.open(file_name_string, FILE_WRITE);
 
-  if (Log_File.size() == 0)
+  if (Log_File && Log_File.size() == 0)
   {
     Log_File.println("ADIF EXPORT");
     Log_File.println("<eoh>");
+    Log_File.flush();
   }
-
-  Log_File.close();
 }
 
-void Init_Log_File(void)
+COLD_CODE void Init_Log_File(void)
 {
+  // A new day's file, what is left of the old one goes first
+  flush_ADIF_Log();
+  if (Log_File)
+    Log_File.close();
+
   make_File_Name();
   Open_Log_File();
 }
@@ -195,32 +317,6 @@ float Target_Distance(const char *target)
   return distance(Station_Latitude, Station_Longitude, Target_Latitude, Target_Longitude);
 }
 
-static float Map_Distance(const char *target)
-{
-  LatLong ll = QRAtoLatLong(map_locator);
-  if (ll.isValid)
-  {
-    Map_Latitude = ll.latitude;
-    Map_Longitude = ll.longitude;
-  }
-  else
-  {
-    Map_Latitude = Map_Longitude = 0.0;
-  }
-
-  ll = QRAtoLatLong(target);
-  if (ll.isValid)
-  {
-    Target_Latitude = ll.latitude;
-    Target_Longitude = ll.longitude;
-  }
-  else
-  {
-    Target_Latitude = Target_Longitude = 0.0;
-  }
-  return distance(Map_Latitude, Map_Longitude, Target_Latitude, Target_Longitude);
-}
-
 static double bearing(double lat1, double long1, double lat2, double long2)
 {
   double dlon = deg2rad(long2 - long1);
@@ -237,8 +333,11 @@ static double bearing(double lat1, double long1, double lat2, double long2)
   return rad2deg(a2);
 }
 
-float Map_Bearing(const char *target)
+// Work out the centre of a map once, when it is drawn
+static void set_map_center(int16_t index)
 {
+  strcpy(map_locator, MapFiles[index].map_locator);
+
   LatLong ll = QRAtoLatLong(map_locator);
   if (ll.isValid)
   {
@@ -249,8 +348,37 @@ float Map_Bearing(const char *target)
   {
     Map_Latitude = Map_Longitude = 0.0;
   }
+  map_center_index = index;
+}
+
+// Index of a four character locator, 0 to 32399, or -1 for anything else
+static int grid_index(const char *locator)
+{
+  if (strlen(locator) != 4 || !IsValidLocator(locator))
+    return -1;
+
+  int field = (toupper(locator[0]) - 'A') * 18 + (toupper(locator[1]) - 'A');
+  return field * 100 + (locator[2] - '0') * 10 + (locator[3] - '0');
+}
 
-  ll = QRAtoLatLong(target);
+// Distance (km) and bearing (degrees) from the map centre to target. Results for four
+// character grids are cached by grid and map, the rest are worked out every time.
+static void map_vector(const char *target, float *map_distance, float *map_bearing)
+{
+  int grid = grid_index(target);
+  Grid_Vector *entry = NULL;
+  if (grid >= 0 && map_center_index >= 0)
+  {
+    entry = &grid_cache[(grid * 7 + map_center_index) % grid_cache_size];
+    if (entry->grid == grid && entry->map == map_center_index + 1)
+    {
+      *map_distance = entry->distance;
+      *map_bearing = entry->bearing;
+      return;
+    }
+  }
+
+  LatLong ll = QRAtoLatLong(target);
   if (ll.isValid)
   {
     Target_Latitude = ll.latitude;
@@ -261,7 +389,16 @@ float Map_Bearing(const char *target)
     Target_Latitude = Target_Longitude = 0.0;
   }
 
-  return bearing(Map_Latitude, Map_Longitude, Target_Latitude, Target_Longitude);
+  *map_distance = distance(Map_Latitude, Map_Longitude, Target_Latitude, Target_Longitude);
+  *map_bearing = bearing(Map_Latitude, Map_Longitude, Target_Latitude, Target_Longitude);
+
+  if (entry != NULL)
+  {
+    entry->grid = grid;
+    entry->map = map_center_index + 1;
+    entry->distance = *map_distance;
+    entry->bearing = *map_bearing;
+  }
 }
 
 static unsigned num_digits(int num)
@@ -290,7 +427,26 @@ static unsigned num_chars(const char *ptr)
   return (unsigned)strlen(trim_front(ptr));
 }
 
-void write_ADIF_Log()
+// Add the target station to the worked-before index
+static COLD_CODE void write_worked_record(void)
+{
+  if (worked_buffered == (int)(sizeof(worked_buffer) / sizeof(worked_buffer[0])))
+    flush_Worked_Index();
+
+  Worked_Record *record = &worked_buffer[worked_buffered++];
+  memset(record, 0, sizeof(Worked_Record));
+  record->key = call_key(trim_front(Target_Call));
+  record->time = (uint32_t)now();
+  memset(record->grid, ' ', sizeof(record->grid));
+  if (IsValidLocator(Target_Locator))
+    memcpy(record->grid, Target_Locator, sizeof(record->grid));
+  record->band = (uint8_t)BandIndex;
+
+  if (store_worked_call(record->key, record->band))
+    Serial.printf("worked before: full, the least recently logged call is forgotten\n");
+}
+
+COLD_CODE void write_ADIF_Log()
 {
   static char log_line[300];
   char freq[10];
@@ -324,6 +480,7 @@ void write_ADIF_Log()
   log_line[sizeof(log_line) - 1] = 0;
 
   write_log_data(log_line);
+  write_worked_record();
   if (Auto_QSO) store_logged_CQ_Call(Target_Call);
 
   LatLong ll = QRAtoLatLong(Target_Locator);
@@ -334,8 +491,10 @@ void write_ADIF_Log()
 
   if (ADIF_distance > 0)
   {
-    ADIF_map_distance = Map_Distance(Target_Locator);
-    ADIF_map_bearing = Map_Bearing(Target_Locator);
+    float map_distance, map_bearing;
+    map_vector(Target_Locator, &map_distance, &map_bearing);
+    ADIF_map_distance = map_distance;
+    ADIF_map_bearing = map_bearing;
 
     draw_vector(ADIF_map_distance, ADIF_map_bearing, 3, 3);
     stored_log_entries[number_logged].ADIF_map_distance = ADIF_map_distance;
@@ -346,13 +505,51 @@ void write_ADIF_Log()
 
 static void draw_QTH(void)
 {
-  QTH_Distance = Map_Distance(Station_Locator);
-  QTH_Bearing = Map_Bearing(Station_Locator);
+  map_vector(Station_Locator, &QTH_Distance, &QTH_Bearing);
 
   draw_vector(QTH_Distance, QTH_Bearing, 3, 2);
 }
 
-static void drawImage(uint16_t image_width, uint16_t image_height, uint16_t image_x, uint16_t image_y, const uint16_t *image)
+// Every map is drawn once after startup into the RA8876's SDRAM past the visible page, two to a
+// page side by side. Showing one, or a part of one, is then a BTE copy done by the controller.
+static const int screen_width = 1024;
+static bool maps_preloaded = false;
+static int16_t maps_drawn = 0;
+static int16_t shown_map = 0;
+
+static uint32_t map_page(int16_t index)
+{
+  return PAGE2_START_ADDR + (index / 2) * (PAGE3_START_ADDR - PAGE2_START_ADDR);
+}
+
+static uint16_t map_page_x(int16_t index)
+{
+  return (index % 2) * screen_width / 2;
+}
+
+COLD_CODE bool preload_next_map(void)
+{
+  if (maps_preloaded)
+    return true;
+
+  // What is queued belongs on the visible page
+  flush_display();
+  tft.canvasImageStartAddress(map_page(maps_drawn));
+  map_image_draw(map_images[maps_drawn], map_page_x(maps_drawn), 0);
+  tft.canvasImageStartAddress(PAGE1_START_ADDR);
+
+  maps_preloaded = ++maps_drawn == numMaps;
+  return maps_preloaded;
+}
+
+// Copy an area of the map on show from its off-screen copy to the same place on screen
+static void copy_map_area(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  tft.bteMemoryCopy(map_page(shown_map), screen_width, map_page_x(shown_map) + x - start_x, y - start_y,
+                    PAGE1_START_ADDR, screen_width, x, y, width, height);
+}
+
+static void drawImage(uint16_t image_width, uint16_t image_height, uint16_t image_x, uint16_t image_y, int16_t index)
 {
   start_x = (1023 - image_width);
   start_y = (100);
@@ -360,8 +557,14 @@ static void drawImage(uint16_t image_width, uint16_t image_height, uint16_t imag
   center_y = (100 + image_y);
 
   tft.fillRect(588, 100, 435, 435, BLACK);
+  display_invalidate(588, 100, 435, 435);
 
-  tft.writeRect(start_x, start_y, image_width, image_height, image);
+  shown_map = index;
+  map_image = map_images[index];
+  if (maps_preloaded)
+    copy_map_area(start_x, start_y, image_width, image_height);
+  else
+    map_image_draw(map_image, start_x, start_y);
 
   tft.drawLine(center_x - 10, center_y, center_x + 10, center_y, RED); // This puts cross hair on map at map center
   tft.drawLine(center_x, center_y - 10, center_x, center_y + 10, RED);
@@ -373,49 +576,155 @@ static void draw_stored_entries(void)
     draw_vector(stored_log_entries[j].ADIF_map_distance, stored_log_entries[j].ADIF_map_bearing, 3, 3);
 }
 
-void draw_map(int16_t index)
+// Screen position of a heard station on the map on show, false if it falls off the image
+static bool heard_spot_position(Heard_Spot *spot)
 {
-  map_width = MapFiles[index].map_width;
-  map_height = MapFiles[index].map_height;
-  map_center_x = MapFiles[index].map_center_x;
-  map_center_y = MapFiles[index].map_center_y;
+  float spot_distance, spot_bearing;
+  map_vector(spot->locator, &spot_distance, &spot_bearing);
+  if (spot_distance > MapFiles[map_key_index].max_distance)
+    return false;
+
+  float magnitude = spot_distance / MapFiles[map_key_index].map_scale;
+  spot->x = center_x + (int)(sin(spot_bearing * PI / 180) * magnitude);
+  spot->y = center_y - (int)(cos(spot_bearing * PI / 180) * magnitude);
+
+  return spot->x - heard_spot_radius >= start_x && spot->x + heard_spot_radius < start_x + map_width &&
+         spot->y - heard_spot_radius >= start_y && spot->y + heard_spot_radius < start_y + map_height;
+}
 
-  switch (index)
+static void draw_heard_spot(const Heard_Spot *spot)
+{
+  tft.drawCircleFill(spot->x, spot->y, heard_spot_radius, heard_spot_colors[spot->age / 2]);
+}
+
+// Put back the map image under a dot
+static void restore_heard_patch(const Heard_Spot *spot)
+{
+  if (maps_preloaded)
   {
-  case 0:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)EM29_4000);
-    break;
+    copy_map_area(spot->x - heard_spot_radius, spot->y - heard_spot_radius, heard_patch_size, heard_patch_size);
+    return;
+  }
 
-  case 1:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)EM29_8000);
-    break;
+  uint16_t patch[heard_patch_size * heard_patch_size];
+  int left = spot->x - heard_spot_radius - start_x;
+  int top = spot->y - heard_spot_radius - start_y;
+  for (int row = 0; row < heard_patch_size; ++row)
+    map_image_decode(map_image, top + row, left, heard_patch_size, patch + row * heard_patch_size);
 
-  case 2:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)EM29_16000);
-    break;
+  tft.writeRect(spot->x - heard_spot_radius, spot->y - heard_spot_radius, heard_patch_size, heard_patch_size, patch);
+}
 
-  case 3:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)JM29_4000);
-    break;
+// Draw the logged QSOs over the map again, a restored patch may have cut through them
+static void draw_overlay(void)
+{
+  tft.drawLine(center_x - 10, center_y, center_x + 10, center_y, RED);
+  tft.drawLine(center_x, center_y - 10, center_x, center_y + 10, RED);
+  draw_vector(QTH_Distance, QTH_Bearing, 3, 2);
+  draw_stored_entries();
+}
 
-  case 4:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)JM29_8000);
-    break;
+void plot_heard_stations(const Decode *decodes, int num_decodes)
+{
+  if (map_image == NULL)
+    return;
 
-  case 5:
-    drawImage(map_width, map_height, map_center_x, map_center_y, (uint16_t *)JM29_16000);
-    break;
+  // Age the dots of earlier slots, wiping those that have run their time
+  bool restored = false;
+  int kept = 0;
+  for (int i = 0; i < num_heard; ++i)
+  {
+    Heard_Spot spot = heard_spots[i];
+    if (++spot.age >= heard_spot_ages)
+    {
+      restore_heard_patch(&spot);
+      restored = true;
+
+      // Dots the patch overlapped need drawing again
+      for (int j = 0; j < num_heard; ++j)
+        if (abs(heard_spots[j].x - spot.x) < heard_patch_size && abs(heard_spots[j].y - spot.y) < heard_patch_size)
+          heard_spots[j].redraw = true;
+      continue;
+    }
+    spot.redraw |= spot.age % 2 == 0; // the colour steps every two slots
+    heard_spots[kept++] = spot;
   }
+  num_heard = kept;
 
-  strcpy(map_locator, MapFiles[index].map_locator);
+  // Add this slot's stations, or bring back to full brightness those heard already
+  for (int i = 0; i < num_decodes; ++i)
+  {
+    if (decodes[i].sequence != Seq_Locator || strlen(decodes[i].target_locator) != 4)
+      continue;
+
+    int j = 0;
+    while (j < num_heard && memcmp(heard_spots[j].locator, decodes[i].target_locator, 4) != 0)
+      ++j;
+
+    if (j < num_heard)
+    {
+      heard_spots[j].redraw |= heard_spots[j].age > 1;
+      heard_spots[j].age = 0;
+    }
+    else if (num_heard < max_heard_spots)
+    {
+      Heard_Spot *spot = &heard_spots[num_heard];
+      memcpy(spot->locator, decodes[i].target_locator, 5);
+      spot->age = 0;
+      spot->redraw = true;
+      if (heard_spot_position(spot))
+        ++num_heard;
+    }
+  }
+
+  for (int i = 0; i < num_heard; ++i)
+  {
+    if (heard_spots[i].redraw)
+      draw_heard_spot(&heard_spots[i]);
+    heard_spots[i].redraw = false;
+  }
+
+  if (restored)
+    draw_overlay();
+}
+
+// Place the heard stations on a newly drawn map
+static void draw_heard_spots(void)
+{
+  int kept = 0;
+  for (int i = 0; i < num_heard; ++i)
+  {
+    Heard_Spot spot = heard_spots[i];
+    if (heard_spot_position(&spot))
+    {
+      draw_heard_spot(&spot);
+      heard_spots[kept++] = spot;
+    }
+  }
+  num_heard = kept;
+}
+
+void draw_map(int16_t index)
+{
+  flush_display();
+
+  map_width = MapFiles[index].map_width;
+  map_height = MapFiles[index].map_height;
+  map_center_x = MapFiles[index].map_center_x;
+  map_center_y = MapFiles[index].map_center_y;
+
+  drawImage(map_width, map_height, map_center_x, map_center_y, index);
+
+  set_map_center(index);
   map_key_index = index;
+  draw_heard_spots();
   draw_QTH();
   drawButton(14);
   drawButton(15);
   draw_stored_entries();
 }
 
-void set_Station_Coordinates()
+COLD_CODE void set_Station_Coordinates()
 {
   LatLong ll = QRAtoLatLong(Station_Locator);
   if (ll.isValid)
@@ -0,0 +1,196 @@
+#include <Audio.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#include "AudioIngest.h"
+#include "MemoryMap.h"
+
+// 6.4 kHz samples, each kept at i and i + ring_samples
+DMAMEM static q15_t __attribute__((aligned(4))) ring[AudioIngest::ring_samples * 2];
+
+// The taps for a kept sample whose LO phase is p, oldest sample first as CMSIS has them
+static float32_t phase_taps[AudioIngest::lo_period][AudioIngest::taps];
+
+// The interpolation taps for a monitor output sample at phase p, newest input sample first
+static float32_t interpolate_taps[AudioIngest::decimation][AudioIngest::monitor_taps];
+
+// The gain of the mixers of the old audio graph, which took the upper sideband as I - Q
+static const float sideband_gain = 0.4f;
+
+// FIR_Decimate after FIR (either of the phasing pair), both in CMSIS order and in Q15
+static void fold_filters(const short *fir, float32_t *folded)
+{
+  for (int i = 0; i < AudioIngest::taps; ++i)
+    folded[i] = 0;
+  for (int j = 0; j < NUM_DECIMATE_COEFFS; ++j)
+    for (int i = 0; i < NUM_COEFFS; ++i)
+      folded[i + j] += (float32_t)FIR_Decimate[j] * fir[i] / (32768.0f * 32768.0f);
+}
+
+static void make_phase_taps(void)
+{
+  static float32_t folded_i[AudioIngest::taps], folded_q[AudioIngest::taps];
+  fold_filters(FIR_I, folded_i);
+  fold_filters(FIR_Q, folded_q);
+
+  // Tap i of a sample at LO phase p meets the input AudioIngest::taps - 1 - i samples before it
+  for (int p = 0; p < AudioIngest::lo_period; ++p)
+    for (int i = 0; i < AudioIngest::taps; ++i)
+    {
+      int phase = (p - (AudioIngest::taps - 1) + i) % AudioIngest::lo_period;
+      if (phase < 0)
+        phase += AudioIngest::lo_period;
+      float angle = 2 * PI * phase * 5 / AudioIngest::lo_period;
+      phase_taps[p][i] = sideband_gain * (folded_i[i] * sinf(angle) - folded_q[i] * cosf(angle));
+    }
+}
+
+// FIR_Decimate as a polyphase interpolator, the gain of 5 making up for the samples between
+static void make_monitor_taps(void)
+{
+  for (int p = 0; p < AudioIngest::decimation; ++p)
+    for (int t = 0; t < AudioIngest::monitor_taps; ++t)
+    {
+      int tap = p + t * AudioIngest::decimation;
+      interpolate_taps[p][t] = tap < NUM_DECIMATE_COEFFS ? AudioIngest::decimation * FIR_Decimate[tap] / 32768.0f : 0;
+    }
+}
+
+AudioIngest::AudioIngest(void) : AudioStream(1, inputQueueArray)
+{
+  overruns = 0;
+  staged = 0;
+  write_count = 0;
+  read_count = 0;
+  recording = false;
+  gain_level = 1.0f;
+  monitor_written = 0;
+  monitor_read = 0;
+  monitor_phase = 0;
+}
+
+void AudioIngest::begin(void)
+{
+  // Start out as if a window of silence had been received, as the old zeroed dsp_buffer did
+  memset(ring, 0, sizeof(ring));
+  memset(history, 0, sizeof(history));
+  make_phase_taps();
+  make_monitor_taps();
+
+  // The monitor starts a stage of silence behind the first samples
+  memset(monitor, 0, sizeof(monitor));
+  monitor_written = 0;
+  monitor_read = (uint32_t)-AUDIO_BLOCK_SAMPLES;
+  monitor_phase = 0;
+  staged = 0;
+  read_count = window_samples - gulp_samples;
+  write_count = read_count;
+  overruns = 0;
+  recording = true;
+}
+
+HOT_CODE void AudioIngest::update(void)
+{
+  audio_block_t *block = receiveReadOnly(0);
+  if (block == NULL)
+    return;
+
+  if (!recording)
+  {
+    release(block);
+    return;
+  }
+
+  arm_q15_to_float(block->data, history + taps - 1 + staged, AUDIO_BLOCK_SAMPLES);
+  staged += AUDIO_BLOCK_SAMPLES;
+  release(block);
+
+  if (staged == stage_samples)
+  {
+    staged = 0;
+    decimate_stage();
+  }
+  send_monitor();
+}
+
+HOT_CODE void AudioIngest::decimate_stage(void)
+{
+  // Kept sample m is input 5 m + 4 of the stage, as arm_fir_decimate_q15() would keep it
+  float32_t decimated[AUDIO_BLOCK_SAMPLES];
+  for (int m = 0; m < AUDIO_BLOCK_SAMPLES; ++m)
+  {
+    int newest = decimation * m + decimation - 1;
+    arm_dot_prod_f32(history + newest, phase_taps[newest % lo_period], taps, &decimated[m]);
+  }
+  memmove(history, history + stage_samples, (taps - 1) * sizeof(float32_t));
+
+  for (int m = 0; m < AUDIO_BLOCK_SAMPLES; ++m)
+    monitor[(monitor_written + m) % monitor_samples] = decimated[m];
+  monitor_written += AUDIO_BLOCK_SAMPLES;
+
+  arm_scale_f32(decimated, gain_level, decimated, AUDIO_BLOCK_SAMPLES);
+
+  // ring_samples is a multiple of the AUDIO_BLOCK_SAMPLES outputs, so they never wrap
+  uint32_t head = write_count % ring_samples;
+  arm_float_to_q15(decimated, ring + head, AUDIO_BLOCK_SAMPLES);
+  memcpy(ring + head + ring_samples, ring + head, AUDIO_BLOCK_SAMPLES * sizeof(q15_t));
+
+  // The samples have to be in the ring before the main loop can see them counted
+  __asm__ volatile("" ::: "memory");
+  write_count += AUDIO_BLOCK_SAMPLES;
+}
+
+// One block of the monitor, the next fifth of a stage's 6.4 kHz samples interpolated
+HOT_CODE void AudioIngest::send_monitor(void)
+{
+  audio_block_t *out = allocate();
+  if (out == NULL)
+    return;
+
+  float32_t samples[AUDIO_BLOCK_SAMPLES];
+  for (int n = 0; n < AUDIO_BLOCK_SAMPLES; ++n)
+  {
+    const float32_t *phase = interpolate_taps[monitor_phase];
+    float32_t sum = 0;
+    for (int t = 0; t < monitor_taps; ++t)
+      sum += phase[t] * monitor[(monitor_read - t) % monitor_samples];
+    samples[n] = sum;
+
+    if (++monitor_phase == decimation)
+    {
+      monitor_phase = 0;
+      ++monitor_read;
+    }
+  }
+  arm_float_to_q15(samples, out->data, AUDIO_BLOCK_SAMPLES);
+
+  transmit(out, 0);
+  release(out);
+}
+
+void AudioIngest::gain(float level)
+{
+  gain_level = level;
+}
+
+int AudioIngest::available(void)
+{
+  return (int)(write_count - read_count);
+}
+
+q15_t *AudioIngest::take_gulp(void)
+{
+  uint32_t written = write_count;
+
+  // Past this the oldest samples of the window have been written over,
+  // so start again from the newest gulp
+  if (written - read_count > (uint32_t)(ring_samples - window_samples))
+  {
+    read_count = written - gulp_samples;
+    ++overruns;
+  }
+
+  read_count += gulp_samples;
+  return ring + (read_count - window_samples) % ring_samples;
+}
@@ -0,0 +1,120 @@
+#include <string.h>
+
+#include "CallHash.h"
+
+static const char kHash_alphabet[] = " 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ/";
+
+struct Call_Hash_Entry
+{
+  uint32_t hash22;
+  char call[12]; // empty once dropped or superseded
+};
+
+// The calls in order of arrival, a ring with the oldest at next_entry
+static Call_Hash_Entry entries[kCall_hash_capacity];
+static int next_entry = 0;
+static Call_Hash_Entry own_entry;
+
+// Entry + 1 of the latest call with each 12 or 10 bit hash, 0 for none. A 22 bit lookup goes
+// through the 12 bit index and checks the rest of the hash, so of two calls that share their
+// top 12 bits only the later one resolves.
+static uint8_t index12[1 << 12];
+static uint8_t index10[1 << 10];
+
+static_assert(kCall_hash_capacity < 256, "the indexes hold entry numbers in a byte");
+
+uint32_t call_hash22(const char *call)
+{
+  // Blank padded to 11 characters, taken as a base 38 number
+  uint64_t n8 = 0;
+  int i = 0;
+  for (; i < 11 && call[i] != 0; ++i)
+  {
+    const char *c = strchr(kHash_alphabet, call[i]);
+    n8 = 38 * n8 + (c != NULL && *c != 0 ? c - kHash_alphabet : 0);
+  }
+  for (; i < 11; ++i)
+    n8 = 38 * n8;
+
+  return (uint32_t)((47055833459ULL * n8) >> (64 - 22));
+}
+
+void call_hash_clear(void)
+{
+  memset(entries, 0, sizeof(entries));
+  memset(index12, 0, sizeof(index12));
+  memset(index10, 0, sizeof(index10));
+  next_entry = 0;
+}
+
+void call_hash_set_own(const char *call)
+{
+  strncpy(own_entry.call, call, sizeof(own_entry.call) - 1);
+  own_entry.call[sizeof(own_entry.call) - 1] = 0;
+  own_entry.hash22 = call_hash22(own_entry.call);
+}
+
+static Call_Hash_Entry *entry_at(const uint8_t *index, uint32_t hash)
+{
+  int n = index[hash];
+  if (n == 0 || entries[n - 1].call[0] == 0)
+    return NULL;
+  return &entries[n - 1];
+}
+
+void call_hash_insert(const char *call)
+{
+  if (call[0] == 0 || strlen(call) >= sizeof(entries[0].call))
+    return;
+
+  uint32_t hash = call_hash22(call);
+  Call_Hash_Entry *held = entry_at(index12, hash >> 10);
+  if (held != NULL && strcmp(held->call, call) == 0)
+  {
+    // Already the most recent, as almost every repeat of a call in a busy band is
+    if (held == &entries[(next_entry + kCall_hash_capacity - 1) % kCall_hash_capacity])
+      return;
+    held->call[0] = 0;
+  }
+
+  // Drop the oldest, leaving the indexes alone where a later call has taken them over
+  Call_Hash_Entry *entry = &entries[next_entry];
+  uint8_t n = (uint8_t)(next_entry + 1);
+  if (entry->call[0] != 0)
+  {
+    if (index12[entry->hash22 >> 10] == n)
+      index12[entry->hash22 >> 10] = 0;
+    if (index10[entry->hash22 >> 12] == n)
+      index10[entry->hash22 >> 12] = 0;
+  }
+
+  entry->hash22 = hash;
+  strcpy(entry->call, call);
+  index12[hash >> 10] = n;
+  index10[hash >> 12] = n;
+  next_entry = (next_entry + 1) % kCall_hash_capacity;
+}
+
+const char *call_hash_lookup22(uint32_t hash)
+{
+  if (own_entry.call[0] != 0 && own_entry.hash22 == hash)
+    return own_entry.call;
+  const Call_Hash_Entry *entry = entry_at(index12, hash >> 10);
+  return entry != NULL && entry->hash22 == hash ? entry->call : NULL;
+}
+
+const char *call_hash_lookup12(uint32_t hash)
+{
+  if (own_entry.call[0] != 0 && own_entry.hash22 >> 10 == hash)
+    return own_entry.call;
+  const Call_Hash_Entry *entry = entry_at(index12, hash);
+  return entry != NULL ? entry->call : NULL;
+}
+
+const char *call_hash_lookup10(uint32_t hash)
+{
+  if (own_entry.call[0] != 0 && own_entry.hash22 >> 12 == hash)
+    return own_entry.call;
+  const Call_Hash_Entry *entry = entry_at(index10, hash);
+  return entry != NULL ? entry->call : NULL;
+}
@@ -0,0 +1,113 @@
+#include <string.h>
+
+#include "CallSet.h"
+#include "pack.h"
+
+static const int32_t kFirst_standard_call = 2063592L + 4194304L; // NTOKENS + MAX22
+
+void call_set_init(Call_Set *set, uint32_t *keys, uint32_t *last_used, int size, int capacity)
+{
+  set->keys = keys;
+  set->last_used = last_used;
+  set->size = size;
+  set->capacity = capacity;
+  call_set_clear(set);
+}
+
+void call_set_clear(Call_Set *set)
+{
+  memset(set->keys, 0, set->size * sizeof(set->keys[0]));
+  set->count = 0;
+  set->clock = 0;
+  set->evicted = 0;
+}
+
+uint32_t call_key(const char *call)
+{
+  int32_t n28 = pack28(call);
+  if (n28 >= kFirst_standard_call)
+    return (uint32_t)n28;
+
+  // FNV-1a over the call up to the first blank
+  uint32_t hash = 2166136261u;
+  for (; *call != 0 && *call != ' '; ++call)
+  {
+    hash ^= (uint8_t)*call;
+    hash *= 16777619u;
+  }
+  return hash | 0x80000000u;
+}
+
+uint32_t call_band_key(uint32_t key, int band)
+{
+  return (key & ~0x70000000u) | (uint32_t)(band & 7) << 28;
+}
+
+// Slot holding key, or the empty slot where it would go
+static int find_slot(const Call_Set *set, uint32_t key)
+{
+  int mask = set->size - 1;
+  int slot = (key * 2654435761u) >> 8 & mask;
+  while (set->keys[slot] != 0 && set->keys[slot] != key)
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+// Empty a slot, moving later entries of its probe run back so that every lookup still finds them
+static void remove_slot(Call_Set *set, int slot)
+{
+  int mask = set->size - 1;
+  int hole = slot;
+  for (int next = (hole + 1) & mask; set->keys[next] != 0; next = (next + 1) & mask)
+  {
+    int home = (set->keys[next] * 2654435761u) >> 8 & mask;
+    // The entry may fill the hole unless its home lies cyclically within (hole, next]
+    if (((next - home) & mask) >= ((next - hole) & mask))
+    {
+      set->keys[hole] = set->keys[next];
+      set->last_used[hole] = set->last_used[next];
+      hole = next;
+    }
+  }
+  set->keys[hole] = 0;
+  --set->count;
+}
+
+bool call_set_contains_key(const Call_Set *set, uint32_t key)
+{
+  return set->keys[find_slot(set, key)] != 0;
+}
+
+bool call_set_contains(const Call_Set *set, const char *call)
+{
+  return call_set_contains_key(set, call_key(call));
+}
+
+void call_set_insert(Call_Set *set, const char *call)
+{
+  call_set_insert_key(set, call_key(call));
+}
+
+void call_set_insert_key(Call_Set *set, uint32_t key)
+{
+  int slot = find_slot(set, key);
+
+  if (set->keys[slot] == 0)
+  {
+    if (set->count >= set->capacity)
+    {
+      // Only done when full, so a scan for the oldest is cheap enough
+      int oldest = -1;
+      for (int i = 0; i < set->size; ++i)
+        if (set->keys[i] != 0 && (oldest < 0 || set->clock - set->last_used[i] > set->clock - set->last_used[oldest]))
+          oldest = i;
+      remove_slot(set, oldest);
+      ++set->evicted;
+      slot = find_slot(set, key);
+    }
+    set->keys[slot] = key;
+    ++set->count;
+  }
+
+  set->last_used[slot] = ++set->clock;
+}
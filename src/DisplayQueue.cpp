@@ -0,0 +1,315 @@
+#include <string.h>
+
+#include <RA8876_t3.h>
+#include <Audio.h>
+#include <si5351.h>
+
+#include "DisplayQueue.h"
+#include "main.h"
+
+enum Display_Op
+{
+  Op_Text,
+  Op_Fill,
+  Op_Row
+};
+
+struct Display_Command
+{
+  uint8_t op;
+  uint8_t font_size;
+  uint8_t length;
+  int8_t row; // row_pool entry of an Op_Row
+  int16_t x, y, width, height;
+  uint16_t fg, bg;
+  char text[32];
+};
+
+static const int queue_size = 64;
+static Display_Command queue[queue_size];
+static int queue_head = 0; // oldest
+static int queue_count = 0;
+
+// Pixels of the queued rows, the waterfall is 600 pixels wide
+static const int row_pool_size = 8;
+static const int max_row_width = 600;
+DMAMEM static uint16_t row_pool[row_pool_size][max_row_width];
+static bool row_used[row_pool_size];
+
+static bool queueing = false;
+
+// The text last drawn or queued at each place, so that drawing it again can be skipped.
+// Anything drawn over a place since forgets it.
+struct Shown_Text
+{
+  bool used;
+  uint8_t font_size;
+  uint8_t length;
+  int16_t x, y;
+  uint16_t fg, bg;
+  char text[32];
+};
+static const int max_shown = 96;
+static Shown_Text shown[max_shown];
+
+static void execute(Display_Command *command)
+{
+  switch (command->op)
+  {
+  case Op_Text:
+    tft.setFontSize(command->font_size, true);
+    tft.textColor(command->fg, command->bg);
+    tft.setCursor(command->x, command->y);
+    tft.write(command->text, command->length);
+    break;
+  case Op_Fill:
+    tft.fillRect(command->x, command->y, command->width, command->height, command->fg);
+    break;
+  case Op_Row:
+    tft.writeRect(command->x, command->y, command->width, 1, row_pool[command->row]);
+    row_used[command->row] = false;
+    break;
+  }
+}
+
+static void execute_oldest(void)
+{
+  execute(&queue[queue_head]);
+  queue_head = (queue_head + 1) % queue_size;
+  --queue_count;
+}
+
+static bool overlaps(const Display_Command *a, const Display_Command *b)
+{
+  return a->x < b->x + b->width && b->x < a->x + a->width &&
+         a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+static bool same_place(const Display_Command *a, const Display_Command *b)
+{
+  return a->op == b->op && a->x == b->x && a->y == b->y && a->width == b->width &&
+         a->height == b->height && a->font_size == b->font_size && a->length == b->length;
+}
+
+// Queue a command, or replace the last one queued for the same place if nothing queued
+// since then overlaps it. Returns the command as stored.
+static Display_Command *enqueue(const Display_Command *command)
+{
+  for (int i = queue_count - 1; i >= 0; --i)
+  {
+    Display_Command *queued = &queue[(queue_head + i) % queue_size];
+    if (overlaps(queued, command))
+    {
+      if (same_place(queued, command))
+      {
+        int8_t row = queued->row;
+        *queued = *command;
+        queued->row = row;
+        return queued;
+      }
+      break;
+    }
+  }
+
+  if (queue_count == queue_size)
+    execute_oldest();
+
+  Display_Command *queued = &queue[(queue_head + queue_count) % queue_size];
+  *queued = *command;
+  ++queue_count;
+  return queued;
+}
+
+static bool rects_overlap(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t x1, int16_t y1, int16_t w1, int16_t h1)
+{
+  return x0 < x1 + w1 && x1 < x0 + w0 && y0 < y1 + h1 && y1 < y0 + h0;
+}
+
+// Generous bounds of a text, they only decide what may be merged or forgotten
+static int16_t text_width(int length, uint8_t font_size)
+{
+  return length * 16 * font_size;
+}
+
+static int16_t text_height(uint8_t font_size)
+{
+  return 32 * font_size;
+}
+
+void display_invalidate(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  for (int i = 0; i < max_shown; ++i)
+    if (shown[i].used && rects_overlap(shown[i].x, shown[i].y, text_width(shown[i].length, shown[i].font_size),
+                                       text_height(shown[i].font_size), x, y, width, height))
+      shown[i].used = false;
+}
+
+static Shown_Text *find_shown(int16_t x, int16_t y)
+{
+  for (int i = 0; i < max_shown; ++i)
+    if (shown[i].used && shown[i].x == x && shown[i].y == y)
+      return &shown[i];
+  return NULL;
+}
+
+bool display_text_shown(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length)
+{
+  if (length > (int)sizeof(shown[0].text))
+    return false;
+
+  const Shown_Text *entry = find_shown(x, y);
+  return entry != NULL && entry->font_size == font_size && entry->length == length &&
+         entry->fg == fg && entry->bg == bg && memcmp(entry->text, text, length) == 0;
+}
+
+// Note a text about to be drawn, false if it is on the screen already
+static bool remember_text(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length)
+{
+  if (display_text_shown(x, y, font_size, fg, bg, text, length))
+    return false;
+
+  display_invalidate(x, y, text_width(length, font_size), text_height(font_size));
+  if (length > (int)sizeof(shown[0].text))
+    return true;
+
+  for (int i = 0; i < max_shown; ++i)
+  {
+    if (!shown[i].used)
+    {
+      Shown_Text *entry = &shown[i];
+      entry->used = true;
+      entry->font_size = font_size;
+      entry->length = length;
+      entry->x = x;
+      entry->y = y;
+      entry->fg = fg;
+      entry->bg = bg;
+      memcpy(entry->text, text, length);
+      break;
+    }
+  }
+  return true;
+}
+
+static void make_text(Display_Command *command, int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length)
+{
+  command->op = Op_Text;
+  command->font_size = font_size;
+  command->length = length < (int)sizeof(command->text) ? length : sizeof(command->text);
+  command->row = -1;
+  command->x = x;
+  command->y = y;
+  command->width = text_width(command->length, font_size);
+  command->height = text_height(font_size);
+  command->fg = fg;
+  command->bg = bg;
+  memcpy(command->text, text, command->length);
+}
+
+void display_text_now(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length)
+{
+  if (!remember_text(x, y, font_size, fg, bg, text, length))
+    return;
+
+  flush_display();
+
+  Display_Command command;
+  make_text(&command, x, y, font_size, fg, bg, text, length);
+  execute(&command);
+}
+
+void display_text(int16_t x, int16_t y, uint8_t font_size, uint16_t fg, uint16_t bg, const char *text, int length)
+{
+  if (!remember_text(x, y, font_size, fg, bg, text, length))
+    return;
+
+  Display_Command command;
+  make_text(&command, x, y, font_size, fg, bg, text, length);
+
+  if (queueing)
+    enqueue(&command);
+  else
+    execute(&command);
+}
+
+void display_fill(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t colour)
+{
+  display_invalidate(x, y, width, height);
+
+  Display_Command command;
+  command.op = Op_Fill;
+  command.font_size = 0;
+  command.length = 0;
+  command.row = -1;
+  command.x = x;
+  command.y = y;
+  command.width = width;
+  command.height = height;
+  command.fg = colour;
+  command.bg = colour;
+
+  if (queueing)
+    enqueue(&command);
+  else
+    execute(&command);
+}
+
+void display_row(int16_t x, int16_t y, int16_t width, const uint16_t *pixels)
+{
+  display_invalidate(x, y, width, 1);
+
+  if (!queueing || width > max_row_width)
+  {
+    tft.writeRect(x, y, width, 1, pixels);
+    return;
+  }
+
+  Display_Command command;
+  command.op = Op_Row;
+  command.font_size = 0;
+  command.length = 0;
+  command.x = x;
+  command.y = y;
+  command.width = width;
+  command.height = 1;
+  command.fg = command.bg = 0;
+
+  // A free row buffer, drawing the oldest commands until one comes free
+  int row = -1;
+  while (row < 0)
+  {
+    for (int i = 0; i < row_pool_size && row < 0; ++i)
+      if (!row_used[i])
+        row = i;
+    if (row < 0)
+      execute_oldest();
+  }
+  command.row = row;
+
+  Display_Command *queued = enqueue(&command);
+  row_used[queued->row] = true;
+  memcpy(row_pool[queued->row], pixels, width * sizeof(pixels[0]));
+}
+
+void display_queue_begin(void)
+{
+  queueing = true;
+}
+
+void service_display(uint32_t budget_us)
+{
+  uint32_t start_us = micros();
+  while (queue_count > 0 && micros() - start_us < budget_us)
+    execute_oldest();
+}
+
+void flush_display(void)
+{
+  while (queue_count > 0)
+    execute_oldest();
+}
+
+bool display_pending(void)
+{
+  return queue_count > 0;
+}
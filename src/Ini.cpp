@@ -1,10 +1,8 @@
-
 #include <string.h>
 #include <stdbool.h>
 
 #include "ini.h"
-
-#define min(a, b) ((a) < (b)) ? (a) : (b)
+#include "MemoryMap.h"
 
 // Basic function to check if a character is whitespace (space or tab)
 static bool is_whitespace(char c)
@@ -12,144 +10,114 @@ static bool is_whitespace(char c)
     return ((c == ' ') || (c == '\t') || (c == '\r'));
 }
 
-// Function to trim leading and trailing whitespace from a "string"
-static void str_trim(char *str)
+static COLD_CODE ini_view_t trimmed(const char *text, size_t length)
 {
-    char *start = str;
-    while (is_whitespace(*start))
+    while (length > 0 && is_whitespace(*text))
     {
-        start++;
+        text++;
+        length--;
     }
-
-    char *end = str + strlen(str) - 1;
-    while (end > start && is_whitespace(*end))
+    while (length > 0 && is_whitespace(text[length - 1]))
     {
-        end--;
+        length--;
     }
-
-    char *p = str;
-    while (start <= end)
-    {
-        *p++ = *start++;
-    }
-    *p = 0;
-}
-
-static void copy_and_trim(char *dest, const char *src, size_t len)
-{
-    memcpy(dest, src, len);
-    dest[len] = 0;
-    str_trim(dest);
+    ini_view_t view = {text, length};
+    return view;
 }
 
-void parse_ini(const char *buffer, size_t buffer_len, ini_data_t *ini_data)
+static void parse_line(const char *line_start, size_t line_length, char *section,
+                       ini_handler_t handler, void *user)
 {
-    ini_data->num_sections = 0;
-    int current_section = -1;
-    const char *current_pos = buffer;
-    const char *buffer_end = buffer + buffer_len;
+    ini_view_t line = trimmed(line_start, line_length);
 
-    while (current_pos < buffer_end)
+    // Handle comments
+    if (line.length == 0 || *line.text == ';' || *line.text == '#')
     {
-        const char *line_start = current_pos;
-        while (current_pos < buffer_end && *current_pos != '\n')
+        // Skip comment or empty line
+    }
+    else if (*line.text == '[' && line.text[line.length - 1] == ']')
+    {
+        // Handle section, the name is all that is kept from one line to the next
+        ini_view_t name = trimmed(line.text + 1, line.length - 2);
+        if (!ini_view_copy(name, section, MAX_SECTION_NAME_LENGTH))
+            section[0] = 0;
+    }
+    else
+    {
+        // Handle key-value pair
+        const char *equals_pos = (const char *)memchr(line.text, '=', line.length);
+        if (equals_pos != NULL)
         {
-            current_pos++;
+            ini_view_t key = trimmed(line.text, equals_pos - line.text);
+            ini_view_t value = trimmed(equals_pos + 1, line.text + line.length - equals_pos - 1);
+            handler(user, section, key, value);
         }
+    }
+}
 
-        char line[MAX_LINE_LENGTH];
-        copy_and_trim(line, line_start, min((size_t)(current_pos - line_start), sizeof(line) - 1));
-
-        // Handle comments
-        if (*line == ';' || *line == '#' || strlen(line) == 0)
-        {
-            // Skip comment or empty line
-        }
-        else if (*line == '[' && line[strlen(line) - 1] == ']')
-        {
-            // Handle section
-            if (ini_data->num_sections < MAX_SECTIONS)
-            {
-                current_section = ini_data->num_sections;
-                ini_section_t *section = &ini_data->sections[current_section];
+COLD_CODE int ini_parse_stream(ini_read_t read, void *source, ini_handler_t handler, void *user)
+{
+    char buffer[MAX_LINE_LENGTH + INI_CHUNK_SIZE];
+    char section[MAX_SECTION_NAME_LENGTH] = "";
+    size_t filled = 0;
+    bool skipping = false; // in the rest of a line too long for the buffer
+    int skipped = 0;
 
-                section->num_entries = 0;
-                section->present = true;
+    for (;;)
+    {
+        size_t space = sizeof(buffer) - filled;
+        size_t bytes_read = read(source, buffer + filled, space < INI_CHUNK_SIZE ? space : INI_CHUNK_SIZE);
+        filled += bytes_read;
 
-                copy_and_trim(section->name, line + 1, min(strlen(line) - 2, sizeof(section->name) - 1));
-                ini_data->num_sections++;
-            }
-            else
-            {
-                current_section = -1; // Too many sections
-            }
-        }
-        else if (current_section != -1)
+        // Every complete line in the buffer
+        size_t line_start = 0;
+        for (;;)
         {
-            // Handle key-value pair
-            const char *equals_pos = NULL;
-            for (size_t i = 0; i < strlen(line); i++)
-            {
-                if (line[i] == '=')
-                {
-                    equals_pos = line + i;
-                    break;
-                }
-            }
-
-            ini_section_t *current_section_ptr = &ini_data->sections[current_section];
-            if (equals_pos != NULL && current_section_ptr->num_entries < MAX_KEYS_PER_SECTION)
-            {
-                ini_entry_t *entry = &current_section_ptr->entries[ini_data->sections[current_section].num_entries++];
-
-                copy_and_trim(entry->key, line, min((size_t)(equals_pos - line), sizeof(entry->key) - 1));
-                copy_and_trim(entry->value, equals_pos + 1, min((size_t)(buffer_end - equals_pos + 1), sizeof(entry->value) - 1));
-
-                entry->present = true;
-            }
+            const char *newline = (const char *)memchr(buffer + line_start, '\n', filled - line_start);
+            if (newline == NULL)
+                break;
+            size_t line_end = newline - buffer;
+            if (!skipping)
+                parse_line(buffer + line_start, line_end - line_start, section, handler, user);
+            skipping = false;
+            line_start = line_end + 1;
         }
 
-        // Move to the next line
-        if (current_pos < buffer_end && *current_pos == '\n')
+        if (bytes_read == 0)
         {
-            current_pos++;
+            // The last line may not have a newline
+            if (line_start < filled && !skipping)
+                parse_line(buffer + line_start, filled - line_start, section, handler, user);
+            return skipped;
         }
-    }
-}
 
-const char *get_ini_value(const ini_data_t *ini_data, const char *section_name, const char *entry_key)
-{
-    for (unsigned int i = 0; i < ini_data->num_sections; i++)
-    {
-        const ini_section_t *section = ini_data->sections + i;
-        if (section->present && strcmp(section->name, section_name) == 0)
+        // Keep the start of a line still to come in
+        filled -= line_start;
+        memmove(buffer, buffer + line_start, filled);
+        if (filled > MAX_LINE_LENGTH)
         {
-            return get_ini_value_from_section(section, entry_key);
+            if (!skipping)
+                skipped++;
+            skipping = true;
+            filled = 0;
         }
     }
-    return NULL;
 }
 
-const ini_section_t *get_ini_section(const ini_data_t *ini_data, const char *section_name)
+bool ini_view_equals(ini_view_t view, const char *text)
 {
-    for (unsigned int i = 0; i < ini_data->num_sections; i++)
-    {
-        const ini_section_t *section = ini_data->sections + i;
-        if (section->present && strcmp(section->name, section_name) == 0)
-        {
-            return section;
-        }
-    }
-    return NULL;
+    return strlen(text) == view.length && memcmp(view.text, text, view.length) == 0;
 }
 
-const char *get_ini_value_from_section(const ini_section_t *section, const char *entry_key)
+bool ini_view_copy(ini_view_t view, char *text, size_t size)
 {
-    for (unsigned int j = 0; j < section->num_entries; j++)
+    if (view.length >= size)
     {
-        const ini_entry_t *entry = section->entries + j;
-        if (entry->present && strcmp(entry->key, entry_key) == 0)
-            return entry->value;
+        if (size > 0)
+            text[0] = 0;
+        return false;
     }
-    return NULL;
+    memcpy(text, view.text, view.length);
+    text[view.length] = 0;
+    return true;
 }
@@ -0,0 +1,50 @@
+#include <string.h>
+
+#include <RA8876_t3.h>
+#include <Audio.h>
+#include <si5351.h>
+
+#include "MapImage.h"
+#include "main.h"
+
+// Rows decoded per writeRect, the maps are at most 432 pixels wide
+static const int draw_rows = 8;
+static const int max_width = 432;
+DMAMEM static uint16_t draw_buffer[draw_rows * max_width];
+
+void map_image_decode(const Map_Image *image, int row, int x, int count, uint16_t *pixels)
+{
+  const uint8_t *data = image->data + image->rows[row];
+  int column = 0;
+  int end = x + count;
+
+  while (column < end)
+  {
+    uint8_t token = *data++;
+    int run = (token & 15) + 1;
+    if (run == 16)
+      run += *data++;
+
+    int first = column > x ? column : x;
+    int last = column + run < end ? column + run : end;
+    if (first < last)
+    {
+      uint16_t colour = image->palette[token >> 4];
+      for (int i = first; i < last; ++i)
+        pixels[i - x] = colour;
+    }
+    column += run;
+  }
+}
+
+void map_image_draw(const Map_Image *image, int16_t x, int16_t y)
+{
+  for (int row = 0; row < image->height; row += draw_rows)
+  {
+    int rows = image->height - row < draw_rows ? image->height - row : draw_rows;
+    for (int i = 0; i < rows; ++i)
+      map_image_decode(image, row + i, 0, image->width, draw_buffer + i * image->width);
+
+    tft.writeRect(x, y + row, image->width, rows, draw_buffer);
+  }
+}
@@ -0,0 +1,61 @@
+#include <stdint.h>
+
+#include <Arduino.h>
+
+#include "MemoryMap.h"
+
+// From the Teensy 4.1 linker script and startup code
+extern unsigned long _stext, _etext, _sdata, _ebss, _estack, _itcm_block_count;
+extern unsigned long _heap_start, _heap_end, _extram_start, _extram_end;
+extern char *__brkval;
+extern "C" uint8_t external_psram_size;
+
+static const uint32_t kRAM1_size = 512 * 1024;
+static const uint32_t kRAM2_start = 0x20200000;
+static const uint32_t kRAM2_size = 512 * 1024;
+
+static const uint32_t kStack_paint = 0xA5A5A5A5;
+// Left alone below the frame of memory_begin(), for the calls it makes and the interrupts
+static const uintptr_t kPaint_margin = 1024;
+
+static uint32_t address(const void *p)
+{
+  return (uint32_t)(uintptr_t)p;
+}
+
+void memory_begin(void)
+{
+  uint32_t *top = (uint32_t *)(((uintptr_t)__builtin_frame_address(0) - kPaint_margin) & ~(uintptr_t)3);
+  for (uint32_t *word = (uint32_t *)&_ebss; word < top; ++word)
+    *word = kStack_paint;
+}
+
+size_t stack_unused(void)
+{
+  const uint32_t *word = (const uint32_t *)&_ebss;
+  while (word < (const uint32_t *)&_estack && *word == kStack_paint)
+    ++word;
+  return (const char *)word - (const char *)&_ebss;
+}
+
+COLD_CODE void memory_report(void)
+{
+  uint32_t itcm = address(&_itcm_block_count) * 32768;
+  uint32_t code = address(&_etext) - address(&_stext);
+  uint32_t globals = address(&_ebss) - address(&_sdata);
+  uint32_t stack = kRAM1_size - itcm - globals;
+  Serial.printf("memory: RAM1 ITCM %lu KB, %lu bytes of code; DTCM %lu bytes of globals, %lu KB stack, %u bytes never used\n",
+                itcm / 1024, code, globals, stack / 1024, (unsigned)stack_unused());
+
+  uint32_t dmamem = address(&_heap_start) - kRAM2_start;
+  uint32_t heap = address(__brkval) - address(&_heap_start);
+  uint32_t heap_free = address(&_heap_end) - address(__brkval);
+  Serial.printf("memory: RAM2 %lu KB, %lu bytes of DMAMEM, %lu bytes of heap, %lu bytes free\n",
+                kRAM2_size / 1024, dmamem, heap, heap_free);
+
+  if (external_psram_size > 0)
+    Serial.printf("memory: PSRAM %u MB, %lu bytes of EXTMEM\n", external_psram_size,
+                  address(&_extram_end) - address(&_extram_start));
+  else
+    Serial.printf("memory: no PSRAM, extmem_malloc() takes from the RAM2 heap\n");
+}
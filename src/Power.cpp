@@ -0,0 +1,60 @@
+#include <stdint.h>
+
+#include <Arduino.h>
+
+#include "Power.h"
+
+// In the Teensy 4 core, not declared in its headers
+extern "C" uint32_t set_arm_clock(uint32_t frequency);
+
+uint32_t Idle_MHz = 0;
+
+static bool clock_idle = false;
+
+// SNVS_HPCR and SNVS_HPSR bits of the ON/OFF button, i.MX RT1060 reference manual 45.7
+static const uint32_t hpcr_button_config = 7 << 24;
+static const uint32_t hpcr_button_any_edge = 4 << 24;
+static const uint32_t hpcr_button_mask = 1 << 27;
+static const uint32_t hpsr_button_interrupt = 1 << 6;
+
+static volatile bool off_pressed = false;
+
+void power_idle_clock(bool idle)
+{
+  idle = idle && Idle_MHz > 0 && Idle_MHz * 1000000 < F_CPU;
+  if (idle == clock_idle)
+    return;
+
+  set_arm_clock(idle ? Idle_MHz * 1000000 : F_CPU);
+  clock_idle = idle;
+}
+
+static void on_off_isr(void)
+{
+  SNVS_HPSR = hpsr_button_interrupt; // write 1 to clear
+  off_pressed = true;
+  asm volatile("dsb");
+}
+
+void power_begin(void)
+{
+  SNVS_HPCR = (SNVS_HPCR & ~hpcr_button_config) | hpcr_button_any_edge | hpcr_button_mask;
+  attachInterruptVector(IRQ_SNVS_ONOFF, on_off_isr);
+  NVIC_ENABLE_IRQ(IRQ_SNVS_ONOFF);
+}
+
+bool power_off_pressed(void)
+{
+  if (!off_pressed)
+    return false;
+
+  off_pressed = false;
+  return true;
+}
+
+void power_wait(void)
+{
+  // Outstanding memory writes finish before the core stops, as the Cortex-M7 needs
+  asm volatile("dsb");
+  asm volatile("wfi");
+}
@@ -1,9 +1,13 @@
+#include <stdlib.h>
+#include <string.h>
+
 #include <Audio.h>
 #include "RA8876_t3.h"
 #include <TimeLib.h>
 #include <si5351.h>
 
 #include "Process_DSP.h"
+#include "power_db.h"
 #include "WF_Table.h"
 #include "arm_math.h"
 #include "decode_ft8.h"
@@ -11,19 +15,45 @@
 #include "traffic_manager.h"
 #include "button.h"
 #include "main.h"
+#include "MemoryMap.h"
+#include "DisplayQueue.h"
+#include "Profile.h"
+#include "Telemetry.h"
+
+int ft8_buffer = ft8_default_buffer;
 
-static float window[FFT_SIZE];
+// FFT bins read by the two freq_sub rows of export_fft_power, each bin being averaged with the next
+static const int max_power_bins = ft8_max_buffer * 2 + 1;
 
-static q15_t __attribute__((aligned(4))) window_dsp_buffer[FFT_SIZE];
-static q15_t FFT_Scale[FFT_SIZE * 2];
-static q15_t FFT_Magnitude[FFT_SIZE];
-static uint8_t FFT_Buffer[FFT_BASE_SIZE];
-static float mag_db[FFT_BASE_SIZE + 1];
+static q15_t __attribute__((aligned(4))) window[FFT_SIZE];
+
+// Work arrays written afresh every gulp, out of RAM1 (see MemoryMap.h)
+DMAMEM static q15_t __attribute__((aligned(4))) window_dsp_buffer[FFT_SIZE];
+DMAMEM static uint8_t FFT_Buffer[FFT_BASE_SIZE];
 static arm_rfft_instance_q15 fft_inst;
-static float raw_fft_max;
 
-static const size_t export_fft_power_size = ft8_msg_samples * ft8_buffer * 4;
-uint8_t export_fft_power[export_fft_power_size];
+static size_t export_fft_power_size;
+
+// Ping-pong spectrograms: the slot being received is written to capture_fft_power while
+// ft8_decode() reads the previous one from export_fft_power. Together they don't fit RAM1,
+// so they come from the heap in RAM2, sized for the bandwidth in use.
+uint8_t *capture_fft_power = NULL;
+uint8_t *export_fft_power = NULL;
+
+// The scale of each, settled when its slot starts from the noise floors of the slot before
+static Power_Scale capture_scale;
+Power_Scale export_power_scale;
+
+// Noise floor of each bin, in dB, carried over from slot to slot
+static int32_t noise_floor_q8[ft8_max_buffer];
+static bool noise_floor_started = false;
+
+// The offset at which the bytes come out as they did on the fixed scale before, when the
+// transform was shifted up by 5 bits and squared in 3.13 format: 10 * ln(2^7) in Q8
+static const int32_t fixed_scale_offset_q8 = 12421;
+
+static const int waterfall_max_width = 600;
+static int waterfall_width = 2 * (ft8_default_buffer - ft8_min_bin);
 
 
 static float ft_blackman_i(int i, int N)
@@ -38,61 +68,124 @@ static float ft_blackman_i(int i, int N)
   return a0 - a1 * x1 + a2 * x2;
 }
 
+void spectrogram_begin(void)
+{
+  if (ft8_buffer > ft8_max_buffer)
+    ft8_buffer = ft8_max_buffer;
+  if (ft8_buffer < ft8_min_bin + 100)
+    ft8_buffer = ft8_default_buffer;
+
+  while (true)
+  {
+    export_fft_power_size = (size_t)ft8_msg_samples * ft8_buffer * 4;
+    capture_fft_power = (uint8_t *)malloc(export_fft_power_size);
+    export_fft_power = (uint8_t *)malloc(export_fft_power_size);
+    if ((capture_fft_power != NULL && export_fft_power != NULL) || ft8_buffer == ft8_default_buffer)
+      break;
+
+    Serial.printf("dsp: no room for %d bins, back to %d\n", ft8_buffer, ft8_default_buffer);
+    free(capture_fft_power);
+    free(export_fft_power);
+    ft8_buffer = ft8_default_buffer;
+  }
+  memset(capture_fft_power, 0, export_fft_power_size);
+  memset(export_fft_power, 0, export_fft_power_size);
+
+  waterfall_width = 2 * (ft8_buffer - ft8_min_bin);
+  if (waterfall_width > waterfall_max_width)
+    waterfall_width = waterfall_max_width;
+
+  // The cursor stays on its bin, wherever that is drawn now
+  display_cursor_line = waterfall_x(cursor_line);
+}
+
+size_t spectrogram_size(void)
+{
+  return export_fft_power_size;
+}
+
+int waterfall_x(int bin_offset)
+{
+  return bin_offset * waterfall_width / (ft8_buffer - ft8_min_bin);
+}
+
+int waterfall_bin_offset(int x)
+{
+  return x * (ft8_buffer - ft8_min_bin) / waterfall_width;
+}
+
 void init_DSP(void)
 {
   arm_rfft_init_q15(&fft_inst, FFT_SIZE, 0, 1);
   for (int i = 0; i < FFT_SIZE; ++i)
   {
-    window[i] = ft_blackman_i(i, FFT_SIZE);
+    window[i] = (q15_t)(ft_blackman_i(i, FFT_SIZE) * 32767.0f + 0.5f);
+  }
+}
+
+static inline uint32_t bin_power(const q15_t *bin)
+{
+  int32_t re = bin[0];
+  int32_t im = bin[1];
+  return (uint32_t)(re * re) + (uint32_t)(im * im);
+}
+
+// Settle the scale of the slot about to be captured
+static void begin_slot_scale(void)
+{
+  if (!noise_floor_started)
+  {
+    // Nothing heard yet, the first slot goes on the fixed scale while the floors settle
+    for (int j = 0; j < ft8_max_buffer; ++j)
+      noise_floor_q8[j] = (kNoise_floor_byte * 256) + fixed_scale_offset_q8;
+    noise_floor_started = true;
   }
+  capture_scale = power_scale(noise_floor_q8 + ft8_min_bin, ft8_buffer - ft8_min_bin);
 }
 
 // Compute FFT magnitudes (log power) for each timeslot in the signal
-static void extract_power(size_t offset)
+static HOT_CODE void extract_power(size_t offset)
 {
+  Profile_Scope scope(Profile_Extract_Power);
+  if (offset == 0)
+    begin_slot_scale();
+
   int half_gulp = 0;
   for (int time_sub = 0; time_sub < 2; ++time_sub)
   {
-    for (size_t i = 0; i < FFT_SIZE; i++)
-    {
-      window_dsp_buffer[i] = (q15_t)((float)dsp_buffer[i + half_gulp] * window[i]);
-    }
+    arm_mult_q15(dsp_buffer + half_gulp, window, window_dsp_buffer, FFT_SIZE);
 
     half_gulp += FFT_BASE_SIZE / 2;
 
     arm_rfft_q15(&fft_inst, window_dsp_buffer, dsp_output);
-    arm_shift_q15(dsp_output, 5, FFT_Scale, FFT_SIZE * 2);
-    arm_cmplx_mag_squared_q15(FFT_Scale, FFT_Magnitude, FFT_SIZE);
-
-    raw_fft_max = 0;
 
-    for (int j = 0; j < FFT_BASE_SIZE; j++)
+    if (offset + 2 * ft8_buffer > export_fft_power_size)
     {
-      int32_t FFT_Mag_10 = 10 * (int32_t)FFT_Magnitude[j];
-      mag_db[j] = (10.0f * log((float)FFT_Mag_10 + 0.1f));
-      if (mag_db[j] > raw_fft_max)
-        raw_fft_max = mag_db[j];
+      // Handle buffer overflow error
+      break;
     }
 
-    // Loop over two possible frequency bin offsets (for averaging)
-    for (int freq_sub = 0; freq_sub < 2; ++freq_sub)
+    // Both frequency bin offsets (for averaging) in one go, so each bin is converted to dB once:
+    // freq_sub 0 averages bins 2j and 2j + 1, freq_sub 1 averages bins 2j + 1 and 2j + 2.
+    // The squared magnitudes are taken in 32 bits, so strong signals no longer clip and the
+    // noise of a quiet band is not rounded down to a few levels.
+    uint8_t *row0 = capture_fft_power + offset;
+    uint8_t *row1 = row0 + ft8_buffer;
+    const int32_t offset_q8 = capture_scale.offset_q8;
+    int32_t db_low = power_db_q8(bin_power(dsp_output));
+    for (int j = 0; j < ft8_buffer; ++j)
     {
-      for (int j = 0; j < ft8_buffer; ++j)
-      {
-        if (offset >= export_fft_power_size)
-        {
-          // Handle buffer overflow error
-          break;
-        }
-
-        float db1 = mag_db[j * 2 + freq_sub];
-        float db2 = mag_db[j * 2 + freq_sub + 1];
-        int scaled = (int)((db1 + db2) / 2);
-
-        export_fft_power[offset] = (scaled < 0) ? 0 : ((scaled > 255) ? 255 : scaled);
-        ++offset;
-      }
+      int32_t db_mid = power_db_q8(bin_power(dsp_output + (j * 2 + 1) * 2));
+      int32_t db_high = power_db_q8(bin_power(dsp_output + (j * 2 + 2) * 2));
+
+      if (time_sub == 0)
+        track_noise_floor(&noise_floor_q8[j], (db_low + db_mid) / 2);
+
+      row0[j] = power_byte(db_low, db_mid, offset_q8);
+      row1[j] = power_byte(db_mid, db_high, offset_q8);
+      db_low = db_high;
     }
+    offset += 2 * ft8_buffer;
   }
 }
 
@@ -100,13 +193,18 @@ const int max_noise_count = 3;
 const int max_noise_free_sets_count = 3;
 static int noise_free_sets_count = 0;
 
-static void update_offset_waterfall(int offset)
+static HOT_CODE void update_offset_waterfall(int offset)
 {
-  uint8_t WF_index[ft8_buffer];
+  Profile_Scope scope(Profile_Waterfall);
+  uint8_t WF_index[ft8_max_buffer];
 
+  // The waterfall's colours and the Auto_Sync quiet test keep to the fixed scale, so that
+  // they look and behave as before whatever the slot's scale
+  int shift = (capture_scale.offset_q8 - fixed_scale_offset_q8) / 256;
   for (int x = ft8_min_bin; x < ft8_buffer; x++)
   {
-    uint8_t bar = FFT_Buffer[x] = export_fft_power[x + offset];
+    int level = capture_fft_power[x + offset] + shift;
+    uint8_t bar = FFT_Buffer[x] = (level < 0) ? 0 : ((level > 255) ? 255 : level);
     if (bar > 63)
       bar = 63;
 
@@ -143,26 +241,48 @@ static void update_offset_waterfall(int offset)
     }
   }
 
-  for (int k = ft8_min_bin; k < ft8_buffer; k++)
+  // Build the row in one buffer and send it with a single write. At 2 columns per bin the
+  // spectrum takes the even columns, the odd ones stay black as they always have. A wider
+  // band has each column take the strongest of the bins it covers.
+  uint16_t row[waterfall_max_width];
+  uint16_t colour = BLUE;
+  const int cursor_width = waterfall_x(8);
+  const bool squeezed = waterfall_width < 2 * (ft8_buffer - ft8_min_bin);
+  for (int x = 0; x < waterfall_width; x++)
   {
-    uint16_t colour = BLUE;
-    if (xmit_flag == 0)
+    int k = ft8_min_bin + waterfall_bin_offset(x);
+    uint8_t level = WF_index[k];
+    if (squeezed)
     {
-      tft.drawPixel(2 * (k - ft8_min_bin), WF_counter, WFPalette[WF_index[k]]);
+      for (int next = ft8_min_bin + waterfall_bin_offset(x + 1); k < next; k++)
+        if (WF_index[k] > level)
+          level = WF_index[k];
     }
-    else
+    else if (x & 1)
     {
-      colour = RED;
-      if (2 * (k - ft8_min_bin) >= display_cursor_line && 2 * (k - ft8_min_bin) <= display_cursor_line + 16)
-        tft.drawPixel(2 * (k - ft8_min_bin), WF_counter, WFPalette[WF_index[k]]);
-      else
-        tft.drawPixel(2 * (k - ft8_min_bin), WF_counter, BLACK);
+      row[x] = BLACK;
+      continue;
     }
 
-    tft.drawPixel(display_cursor_line, WF_counter, colour);
-    tft.drawPixel(display_cursor_line + 16, WF_counter, colour);
+    if (xmit_flag == 0 || (x >= display_cursor_line && x <= display_cursor_line + cursor_width))
+      row[x] = WFPalette[level];
+    else
+      row[x] = BLACK;
   }
 
+  if (xmit_flag != 0)
+    colour = RED;
+
+  for (int x = display_cursor_line; x <= display_cursor_line + cursor_width; x += cursor_width)
+  {
+    if (x < waterfall_width)
+      row[x] = colour;
+    else
+      tft.drawPixel(x, WF_counter, colour);
+  }
+
+  display_row(0, WF_counter, waterfall_width, row);
+
   WF_counter++;
 }
 
@@ -172,13 +292,28 @@ void process_FT8_FFT(void)
 
   if (ft8_flag)
   {
+    if (FT_8_counter == 0)
+      ft8_sync_begin();
+
     int master_offset = offset_step * FT_8_counter;
     extract_power(master_offset);
+    telemetry_spectrum(FT_8_counter, capture_fft_power + master_offset, ft8_buffer, capture_scale.offset_q8);
 
     update_offset_waterfall(master_offset);
 
-    if (++FT_8_counter == ft8_msg_samples)
+    ft8_sync_update(++FT_8_counter);
+
+    if (FT_8_counter == ft8_early_samples && Early_Decode)
+      early_decode_flag = 1;
+
+    if (FT_8_counter == ft8_msg_samples)
     {
+      // Hand the complete slot over to the decoder, the next slot is captured into the other buffer
+      uint8_t *complete = capture_fft_power;
+      capture_fft_power = export_fft_power;
+      export_fft_power = complete;
+      export_power_scale = capture_scale;
+
       ft8_flag = 0;
       decode_flag = 1;
     }
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <Audio.h>
+#include <RA8876_t3.h>
+#include <si5351.h>
+
+#include "Profile.h"
+#include "DisplayQueue.h"
+#include "ADIF.h"
+#include "button.h"
+#include "main.h"
+#include "MemoryMap.h"
+#include "Telemetry.h"
+
+static const char *const point_names[Profile_Points] = {
+    "process_data", "extract_pwr", "waterfall", "sync_rows", "find_sync",
+    "bp_decode", "ms_decode", "osd", "ap_decode", "unpack77", "display_msgs", "psk_i2c"};
+
+static Profile_Stats slot_stats[Profile_Points];
+static int slot_backlog_max;
+
+// The last slot reported, for the calibration screen
+static Profile_Stats shown_stats[Profile_Points];
+static int shown_backlog_max;
+static int shown_audio_blocks_max;
+static bool page_shown = false;
+
+static void clear_slot(void)
+{
+  memset(slot_stats, 0, sizeof(slot_stats));
+  for (int i = 0; i < Profile_Points; ++i)
+    slot_stats[i].min_cycles = UINT32_MAX;
+  slot_backlog_max = 0;
+  AudioMemoryUsageMaxReset();
+  AudioProcessorUsageMaxReset();
+}
+
+void profile_begin(void)
+{
+  // The core starts the counter already, this makes sure of it
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+  clear_slot();
+}
+
+void profile_add(int point, uint32_t cycles)
+{
+  // Counted at F_CPU, whatever the clock was slowed to when idle
+  if (F_CPU_ACTUAL != F_CPU)
+    cycles = (uint32_t)((uint64_t)cycles * (F_CPU / 1000000) / (F_CPU_ACTUAL / 1000000));
+
+  Profile_Stats *stats = &slot_stats[point];
+  ++stats->calls;
+  stats->total_cycles += cycles;
+  if (cycles < stats->min_cycles)
+    stats->min_cycles = cycles;
+  if (cycles > stats->max_cycles)
+    stats->max_cycles = cycles;
+}
+
+void profile_audio_backlog(int samples)
+{
+  if (samples > slot_backlog_max)
+    slot_backlog_max = samples;
+}
+
+static uint32_t cycles_to_us(uint64_t cycles)
+{
+  return (uint32_t)(cycles / (F_CPU / 1000000));
+}
+
+// One line of the report, min / mean / max in us, short enough for a queued text
+static void format_point(char *line, size_t size, int point, const Profile_Stats *stats)
+{
+  snprintf(line, size, "%-12s%4lu%5lu%5lu%6lu", point_names[point], (unsigned long)stats->calls,
+           (unsigned long)cycles_to_us(stats->min_cycles),
+           (unsigned long)cycles_to_us(stats->total_cycles / stats->calls),
+           (unsigned long)cycles_to_us(stats->max_cycles));
+}
+
+static void draw_page(void)
+{
+  const int x = 596;
+  const int line_height = 26;
+  int y = 108;
+  char line[40];
+
+  flush_display();
+  display_fill(588, 100, 435, 435, BLACK);
+  const char *heading = "point          n  min mean   max";
+  display_text(x, y, 1, YELLOW, BLACK, heading, strlen(heading));
+  y += line_height;
+
+  for (int i = 0; i < Profile_Points; ++i)
+  {
+    if (shown_stats[i].calls == 0)
+      continue;
+    format_point(line, sizeof(line), i, &shown_stats[i]);
+    display_text(x, y, 1, WHITE, BLACK, line, strlen(line));
+    y += line_height;
+  }
+
+  y += line_height;
+  snprintf(line, sizeof(line), "ingest backlog %d samples", shown_backlog_max);
+  display_text(x, y, 1, WHITE, BLACK, line, strlen(line));
+  y += line_height;
+  snprintf(line, sizeof(line), "audio blocks   %d used", shown_audio_blocks_max);
+  display_text(x, y, 1, WHITE, BLACK, line, strlen(line));
+}
+
+// The same report for the USB telemetry stream
+static void send_telemetry(void)
+{
+  Telemetry_Profile_Record record;
+  record.points = Profile_Points;
+  record.audio_blocks = (uint8_t)AudioMemoryUsageMax();
+  record.audio_cpu_x10 = (uint16_t)(AudioProcessorUsageMax() * 10);
+  record.backlog = slot_backlog_max;
+  record.stack_unused = stack_unused();
+
+  Telemetry_Profile_Point points[Profile_Points];
+  for (int i = 0; i < Profile_Points; ++i)
+  {
+    const Profile_Stats *stats = &slot_stats[i];
+    points[i].calls = stats->calls;
+    points[i].min_us = stats->calls ? cycles_to_us(stats->min_cycles) : 0;
+    points[i].mean_us = stats->calls ? cycles_to_us(stats->total_cycles / stats->calls) : 0;
+    points[i].max_us = cycles_to_us(stats->max_cycles);
+  }
+  telemetry_profile(&record, points);
+}
+
+void profile_end_slot(void)
+{
+  char line[40];
+  for (int i = 0; i < Profile_Points; ++i)
+  {
+    if (slot_stats[i].calls == 0)
+      continue;
+    format_point(line, sizeof(line), i, &slot_stats[i]);
+    Serial.printf("profile: %s\n", line);
+  }
+  Serial.printf("profile: ingest backlog %d samples, %d audio blocks, audio update %.1f%% CPU, %u bytes of stack never used\n",
+                slot_backlog_max, AudioMemoryUsageMax(), AudioProcessorUsageMax(), (unsigned)stack_unused());
+  send_telemetry();
+
+  memcpy(shown_stats, slot_stats, sizeof(shown_stats));
+  shown_backlog_max = slot_backlog_max;
+  shown_audio_blocks_max = AudioMemoryUsageMax();
+  clear_slot();
+
+  if (page_shown)
+    draw_page();
+}
+
+void show_Profile_Page(bool show)
+{
+  if (show)
+    draw_page();
+  else if (page_shown)
+    draw_map(Map_Index);
+  page_shown = show;
+}
+
+bool profile_page_shown(void)
+{
+  return page_shown;
+}
@@ -12,6 +12,7 @@
 
 #include "main.h"
 #include "PskInterface.h"
+#include "Profile.h"
 
 static const int MAX_SYNCTIME_RETRIES = 10;
 
@@ -36,11 +37,50 @@ enum I2COperation
   OP_SENDER_RECORD,
   OP_SENDER_SOFTWARE_RECORD,
   OP_RECEIVER_RECORD,
-  OP_SEND_REQUEST
+  OP_SEND_REQUEST,
+  OP_RECEIVER_BATCH,
+  OP_DECODE_BATCH
 };
 
 static const uint8_t ESP32_I2C_ADDRESS = 0x2A;
 
+// Spots waiting to be sent to the ESP32, so that decoding never waits on I2C
+struct ReceivedRecord
+{
+  char callsign[14];
+  uint32_t frequency;
+  uint8_t snr;
+};
+
+static const int RECEIVED_QUEUE_SIZE = 128; // two full slots of decodes, power of two
+static ReceivedRecord receivedQueue[RECEIVED_QUEUE_SIZE];
+static uint32_t receivedHead = 0; // next record to fill
+static uint32_t receivedTail = 0; // next record to send
+
+// The decodes of a slot waiting for the ESP32 to broadcast them as WSJT-X Decode packets
+struct DecodeRecord
+{
+  uint32_t slotTime; // UTC start of the slot
+  uint16_t dialKHz;
+  uint16_t frequency; // audio, Hz
+  int8_t snr;
+  int8_t dt; // tenths of a second, as WSJT-X shows it
+  char message[20];
+};
+
+static const int DECODE_QUEUE_SIZE = 64; // a full slot of decodes, power of two
+static DecodeRecord decodeQueue[DECODE_QUEUE_SIZE];
+static uint32_t decodeHead = 0; // next record to fill
+static uint32_t decodeTail = 0; // next record to send
+
+// An OP_RECEIVER_BATCH or OP_DECODE_BATCH frame has to fit the Wire1 transmit buffer and
+// the ESP32 slave receive buffer (128 bytes)
+static const size_t MAX_BATCH_FRAME = 128;
+
+// Wait this long before trying again when the ESP32 doesn't answer
+static const uint32_t SEND_RETRY_MS = 1000;
+static uint32_t sendRetryTime = 0;
+
 void requestTimeSync(void)
 {
   syncTime = true;
@@ -49,57 +89,167 @@ void requestTimeSync(void)
   syncTimeCounter = 0;
 }
 
+// The ESP32 only reports whole seconds, so the time is read repeatedly until the seconds
+// change. The change happened between the two reads, each taken to be sampled half way
+// through its transaction, and the RTC is set at the next whole second from there.
+enum TimeSyncState
+{
+  TIME_IDLE = 0,
+  TIME_POLL,     // reading the time until the seconds change
+  TIME_WAIT_EDGE // waiting for the second to set the RTC on
+};
+
+static const uint32_t TIME_SYNC_TIMEOUT_MS = 3000; // whole sync, two seconds plus margin
+static const uint32_t TIME_POLL_US = 10000;        // between reads, half of it is the edge error
+static const uint32_t TIME_SET_LATE_US = 20000;    // later than this, set on the next second
+
+static TimeSyncState timeSyncState = TIME_IDLE;
+static uint32_t timeSyncDeadline;
+static uint32_t lastPollTime;
+static bool havePreviousTime;
+static time_t previousTime;
+static uint32_t previousSampleTime;
+static time_t edgeTime;
+static uint32_t edgeSampleTime;
+
+// One OP_TIME_REQUEST transaction, without waiting for bytes that don't come.
+// Returns 0 when a valid time was read, else the Wire1 status or 0xFF.
+static uint8_t readTime(RTC_Time *rtcTime, uint32_t *sampleTime)
+{
+  Profile_Scope scope(Profile_PSK_I2C);
+  uint32_t requestTime = micros();
+  Wire1.beginTransmission(ESP32_I2C_ADDRESS);
+  Wire1.write(OP_TIME_REQUEST);
+  uint8_t retVal = Wire1.endTransmission();
+  if (retVal != 0)
+    return retVal;
+
+  memset(rtcTime, 0, sizeof(*rtcTime));
+  Wire1.requestFrom(ESP32_I2C_ADDRESS, sizeof(RTC_Time));
+  uint8_t *ptr = (uint8_t *)rtcTime;
+  size_t size = 0;
+  while (size < sizeof(RTC_Time) && Wire1.available())
+  {
+    ptr[size++] = Wire1.read();
+  }
+
+  // The ESP32 read its clock somewhere in the round trip, take the middle of it
+  *sampleTime = requestTime + (micros() - requestTime) / 2;
+
+  if (!(rtcTime->year > 24 && rtcTime->year < 99 && size == sizeof(RTC_Time)))
+    return 0xFF;
+  return 0;
+}
+
+static time_t toTime(const RTC_Time *rtcTime)
+{
+  tmElements_t tm;
+  tm.Second = rtcTime->seconds;
+  tm.Minute = rtcTime->minutes;
+  tm.Hour = rtcTime->hours;
+  tm.Day = rtcTime->day;
+  tm.Month = rtcTime->month;
+  tm.Year = CalendarYrToTm(rtcTime->year + 2000);
+  return makeTime(tm);
+}
+
+static void pollTime(void)
+{
+  if (micros() - lastPollTime < TIME_POLL_US)
+    return;
+  lastPollTime = micros();
+
+  RTC_Time rtcTime;
+  uint32_t sampleTime;
+  uint8_t retVal = readTime(&rtcTime, &sampleTime);
+  if (retVal == 0xFF)
+    return; // short or bad reply, try again on the next poll
+
+  if (retVal != 0)
+  {
+    Serial.printf("Failed to read RTC time: %u\n", retVal);
+    syncTime = false;
+    timeSyncState = TIME_IDLE;
+    return;
+  }
+
+  time_t t = toTime(&rtcTime);
+  if (havePreviousTime && t == previousTime + 1)
+  {
+    Serial.printf("%2.2u:%2.2u:%2.2u %2.2u/%2.2u/%2.2u (%u) +-%lu us\n",
+                  rtcTime.hours, rtcTime.minutes, rtcTime.seconds,
+                  rtcTime.day, rtcTime.month, rtcTime.year,
+                  rtcTime.dayOfWeek, (sampleTime - previousSampleTime) / 2);
+
+    // The second began between the two samples
+    edgeTime = t + 1;
+    edgeSampleTime = previousSampleTime + (sampleTime - previousSampleTime) / 2 + 1000000;
+    timeSyncState = TIME_WAIT_EDGE;
+    return;
+  }
+
+  havePreviousTime = true;
+  previousTime = t;
+  previousSampleTime = sampleTime;
+}
+
+static void setTimeOnEdge(void)
+{
+  int32_t late = (int32_t)(micros() - edgeSampleTime);
+  if (late < 0)
+    return;
+
+  if ((uint32_t)late > TIME_SET_LATE_US)
+  {
+    // The loop was busy, the RTC keeps its own fraction of a second, so use a later second
+    uint32_t seconds = (late - TIME_SET_LATE_US) / 1000000 + 1;
+    edgeTime += seconds;
+    edgeSampleTime += seconds * 1000000;
+    return;
+  }
+
+  setTime(edgeTime);
+  Teensy3Clock.set(now()); // set the RTC
+
+  // Line the slots up with UTC
+  align_slots_to_utc(millis() - late / 1000, edgeTime);
+
+  syncTime = false;
+  timeSyncState = TIME_IDLE;
+}
+
 void getTime(void)
 {
-  if (syncTime && syncTimeCounter++ < MAX_SYNCTIME_RETRIES)
+  if (syncTime && timeSyncState == TIME_IDLE && syncTimeCounter++ < MAX_SYNCTIME_RETRIES)
   {
-    Wire1.beginTransmission(ESP32_I2C_ADDRESS);
-    uint8_t retVal = Wire1.endTransmission();
-    if (retVal == 0)
-    {
-      RTC_Time rtcTime;
-      memset(&rtcTime, 0, sizeof(rtcTime));
+    timeSyncDeadline = millis() + TIME_SYNC_TIMEOUT_MS;
+    lastPollTime = micros() - TIME_POLL_US;
+    havePreviousTime = false;
+    timeSyncState = TIME_POLL;
+  }
+}
 
-      Wire1.beginTransmission(ESP32_I2C_ADDRESS);
-      Wire1.write(OP_TIME_REQUEST);
-      Wire1.endTransmission();
-      Wire1.requestFrom(ESP32_I2C_ADDRESS, sizeof(RTC_Time));
-      uint8_t *ptr = (uint8_t *)&rtcTime;
-      size_t size = 0;
-      for (;;)
-      {
-        if (Wire1.available())
-        {
-          ptr[size++] = Wire1.read();
-          if (size >= sizeof(RTC_Time))
-            break;
-        }
-      }
+void serviceTimeSync(void)
+{
+  if (timeSyncState == TIME_IDLE)
+    return;
 
-      if (rtcTime.year > 24 && rtcTime.year < 99 && size == sizeof(RTC_Time))
-      {
-        syncTime = false;
-
-        Serial.printf("%u %2.2u:%2.2u:%2.2u %2.2u/%2.2u/%2.2u (%u)\n",
-                      size,
-                      rtcTime.hours, rtcTime.minutes, rtcTime.seconds,
-                      rtcTime.day, rtcTime.month, rtcTime.year,
-                      rtcTime.dayOfWeek);
-        setTime(rtcTime.hours,
-                rtcTime.minutes,
-                rtcTime.seconds,
-                rtcTime.day,
-                rtcTime.month,
-                rtcTime.year + 2000);
-        Teensy3Clock.set(now()); // set the RTC
-      }
-    }
-    else
-    {
-      Serial.printf("Failed to read RTC time: %u\n", retVal);
-      syncTime = false;
-    }
+  if ((int32_t)(millis() - timeSyncDeadline) >= 0)
+  {
+    Serial.printf("RTC time sync timed out\n");
+    timeSyncState = TIME_IDLE;
+    return;
   }
+
+  if (timeSyncState == TIME_POLL)
+    pollTime();
+  else
+    setTimeOnEdge();
+}
+
+bool timeSyncBusy(void)
+{
+  return timeSyncState != TIME_IDLE;
 }
 
 bool addSenderRecord(const char *callsign, const char *gridSquare, const char *software)
@@ -157,41 +307,151 @@ bool addSenderRecord(const char *callsign, const char *gridSquare, const char *s
 
 bool addReceivedRecord(const char *callsign, uint32_t frequency, uint8_t snr)
 {
+  size_t callsignLength = strlen(callsign);
+  if (callsignLength >= sizeof(receivedQueue[0].callsign) ||
+      receivedHead - receivedTail >= (uint32_t)RECEIVED_QUEUE_SIZE)
+    return false;
+
+  ReceivedRecord *record = &receivedQueue[receivedHead % RECEIVED_QUEUE_SIZE];
+  memcpy(record->callsign, callsign, callsignLength + 1);
+  record->frequency = frequency;
+  record->snr = snr;
+  ++receivedHead;
+  return true;
+}
+
+bool sendReceivedRecords(void)
+{
+  if (receivedHead == receivedTail || (int32_t)(millis() - sendRetryTime) < 0)
+    return false;
+
+  Profile_Scope scope(Profile_PSK_I2C);
+
   if (!senderSent)
   {
-    addSenderRecord(Station_Call, Station_Locator, "DX FT8 Transceiver");
-    senderSent = true;
+    senderSent = addSenderRecord(Station_Call, Station_Locator, "DX FT8 Transceiver");
+    if (!senderSent)
+      sendRetryTime = millis() + SEND_RETRY_MS;
+    // One transaction per call, the spots go with the next one
+    return senderSent;
+  }
+
+  uint8_t buffer[MAX_BATCH_FRAME];
+  uint8_t *ptr = buffer;
+  *ptr++ = (uint8_t)OP_RECEIVER_BATCH;
+  uint8_t *count = ptr++;
+  *count = 0;
+
+  // Pack as many records as fit, each as in OP_RECEIVER_RECORD
+  uint32_t tail = receivedTail;
+  for (; tail != receivedHead; ++tail)
+  {
+    const ReceivedRecord *record = &receivedQueue[tail % RECEIVED_QUEUE_SIZE];
+    size_t callsignLength = strlen(record->callsign);
+    size_t recordSize = sizeof(uint8_t) + callsignLength + sizeof(uint32_t) + sizeof(uint8_t);
+    if (ptr + recordSize > buffer + sizeof(buffer) || *count == UINT8_MAX)
+      break;
+
+    // Add callsign as length-delimited
+    *ptr++ = (uint8_t)callsignLength;
+    memcpy(ptr, record->callsign, callsignLength);
+    ptr += callsignLength;
+
+    // Add frequency
+    memcpy(ptr, &record->frequency, sizeof(record->frequency));
+    ptr += sizeof(record->frequency);
+
+    // Add SNR (1 byte)
+    *ptr++ = record->snr;
+    ++*count;
   }
 
-  bool result = false;
   Wire1.beginTransmission(ESP32_I2C_ADDRESS);
-  uint8_t retVal = Wire1.endTransmission();
-  if (retVal == 0)
+  Wire1.write(buffer, ptr - buffer);
+  bool result = (Wire1.endTransmission() == 0);
+  if (result)
+    receivedTail = tail;
+  else
+    sendRetryTime = millis() + SEND_RETRY_MS;
+
+  return result;
+}
+
+bool addDecodeRecord(time_t slotTime, uint16_t dialKHz, const char *message, int snr, int timeMs, int frequency)
+{
+  size_t messageLength = strlen(message);
+  if (messageLength >= sizeof(decodeQueue[0].message) ||
+      decodeHead - decodeTail >= (uint32_t)DECODE_QUEUE_SIZE)
+    return false;
+
+  // WSJT-X's DT is from half a second into the slot
+  int dt = timeMs - 500;
+  dt = (dt >= 0 ? dt + 50 : dt - 50) / 100;
+
+  DecodeRecord *record = &decodeQueue[decodeHead % DECODE_QUEUE_SIZE];
+  record->slotTime = (uint32_t)slotTime;
+  record->dialKHz = dialKHz;
+  record->frequency = (uint16_t)frequency;
+  record->snr = (int8_t)snr;
+  record->dt = (int8_t)(dt < INT8_MIN ? INT8_MIN : (dt > INT8_MAX ? INT8_MAX : dt));
+  memcpy(record->message, message, messageLength + 1);
+  ++decodeHead;
+  return true;
+}
+
+bool sendDecodeRecords(void)
+{
+  if (decodeHead == decodeTail || (int32_t)(millis() - sendRetryTime) < 0)
+    return false;
+
+  Profile_Scope scope(Profile_PSK_I2C);
+
+  // The slot's time and dial frequency once, then as many of its decodes as fit. A busy
+  // slot takes a few frames, each one a slot's worth for the ESP32.
+  const DecodeRecord *first = &decodeQueue[decodeTail % DECODE_QUEUE_SIZE];
+  uint8_t buffer[MAX_BATCH_FRAME];
+  uint8_t *ptr = buffer;
+  *ptr++ = (uint8_t)OP_DECODE_BATCH;
+  memcpy(ptr, &first->slotTime, sizeof(first->slotTime));
+  ptr += sizeof(first->slotTime);
+  memcpy(ptr, &first->dialKHz, sizeof(first->dialKHz));
+  ptr += sizeof(first->dialKHz);
+  uint8_t *count = ptr++;
+  *count = 0;
+
+  uint32_t tail = decodeTail;
+  for (; tail != decodeHead; ++tail)
   {
-    uint8_t buffer[32];
-    size_t callsignLength = strlen(callsign);
-    size_t bufferSize = sizeof(uint8_t) + sizeof(uint8_t) + callsignLength + sizeof(uint32_t) + sizeof(uint8_t);
-    if (bufferSize < sizeof(buffer))
-    {
-      uint8_t *ptr = buffer;
-      *ptr++ = (uint8_t)OP_RECEIVER_RECORD;
-      // Add callsign as length-delimited
-      *ptr++ = (uint8_t)callsignLength;
-      memcpy(ptr, callsign, callsignLength);
-      ptr += callsignLength;
+    const DecodeRecord *record = &decodeQueue[tail % DECODE_QUEUE_SIZE];
+    size_t messageLength = strlen(record->message);
+    size_t recordSize = sizeof(int8_t) + sizeof(int8_t) + sizeof(uint16_t) + sizeof(uint8_t) + messageLength;
+    if (record->slotTime != first->slotTime || record->dialKHz != first->dialKHz ||
+        ptr + recordSize > buffer + sizeof(buffer) || *count == UINT8_MAX)
+      break;
 
-      // Add frequency
-      memcpy(ptr, &frequency, sizeof(frequency));
-      ptr += (uint8_t)sizeof(frequency);
+    // SNR and DT (1 byte each)
+    *ptr++ = (uint8_t)record->snr;
+    *ptr++ = (uint8_t)record->dt;
 
-      // Add SNR (1 byte)
-      *ptr++ = snr;
+    // Add audio frequency
+    memcpy(ptr, &record->frequency, sizeof(record->frequency));
+    ptr += sizeof(record->frequency);
 
-      Wire1.beginTransmission(ESP32_I2C_ADDRESS);
-      Wire1.write(buffer, ptr - buffer);
-      result = (Wire1.endTransmission() == 0);
-    }
+    // Add message as length-delimited
+    *ptr++ = (uint8_t)messageLength;
+    memcpy(ptr, record->message, messageLength);
+    ptr += messageLength;
+    ++*count;
   }
+
+  Wire1.beginTransmission(ESP32_I2C_ADDRESS);
+  Wire1.write(buffer, ptr - buffer);
+  bool result = (Wire1.endTransmission() == 0);
+  if (result)
+    decodeTail = tail;
+  else
+    sendRetryTime = millis() + SEND_RETRY_MS;
+
   return result;
 }
 
@@ -21,13 +21,22 @@
 #include "traffic_manager.h"
 #include "filters.h"
 #include "constants.h"
+#include "protocol.h"
 #include "gen_ft8.h"
 #include "options.h"
 #include "ADIF.h"
 #include "main.h"
+#include "AudioIngest.h"
 #include "Geodesy.h"
 #include "PskInterface.h"
+#include "SpotHistory.h"
+#include "DisplayQueue.h"
+#include "Profile.h"
+#include "SlotCapture.h"
 #include "autoseq_engine.h"
+#include "MemoryMap.h"
+#include "Power.h"
+#include "Telemetry.h"
 #include "ADIF.h"
 
 #define SCREEN_WIDTH 1024
@@ -53,46 +62,32 @@ static char autoseq_state_str[MAX_LINE_LEN];
 
 static bool worked_qsos_in_display = false;
 
+// Decodes of the early pass and whether they already produced a reply
+static int early_decoded = 0;
+static bool early_reply_queued = false;
+
+// Time each loop pass may spend drawing queued display commands
+static const uint32_t display_budget_us = 2000;
+
 RA8876_t3 tft = RA8876_t3(RA8876_CS, RA8876_RESET);
 Si5351 si5351;
 
 AudioInputI2S i2s1; // xy=120,212
 AudioAmplifier in_left_amp;
-AudioEffectMultiply multiply2; // xy=285,414
-AudioEffectMultiply multiply1; // xy=287,149
-AudioSynthWaveformSine sine1;  // xy=289,244
-AudioSynthWaveformSine sine2;  // xy=289,244
-AudioFilterFIR fir1;           // xy=471,153
-AudioFilterFIR fir2;           // xy=472,413
-AudioMixer4 mixer1;            // xy=666,173
-AudioMixer4 mixer2;            // xy=675,406
-AudioAmplifier amp1;           // xy=859,151
-AudioOutputI2S i2s2;           // xy=868,258
-AudioRecordQueue audioQueue;   // xy=1027,149
+AudioIngest audioIngest; // xy=1027,149
+AudioOutputI2S i2s2;     // xy=868,258
 
+// The IF mixer, sideband selection and decimation are all done in audioIngest, which also
+// gives back the receive audio for the monitor on line out and headphones
 AudioConnection c11(i2s1, 0, in_left_amp, 0);
-AudioConnection patchCord1(in_left_amp, 0, multiply1, 0);
-AudioConnection patchCord2(in_left_amp, 0, multiply2, 0);
-AudioConnection patchCord4(multiply1, fir1);
-AudioConnection patchCord3(multiply2, fir2);
-AudioConnection patchCord5(sine1, 0, multiply1, 1);
-AudioConnection patchCord6(sine2, 0, multiply2, 1);
-AudioConnection patchCord7(fir1, 0, mixer1, 0);
-AudioConnection patchCord8(fir1, 0, mixer2, 0);
-AudioConnection patchCord9(fir2, 0, mixer1, 1);
-AudioConnection patchCord10(fir2, 0, mixer2, 1);
-
-AudioConnection c3(mixer2, 0, amp1, 0);
-AudioConnection patchCord13(amp1, audioQueue);
-
-AudioConnection c6(mixer1, 0, i2s2, 0);
-AudioConnection c7(mixer2, 0, i2s2, 1);
+AudioConnection patchCord13(in_left_amp, audioIngest);
+AudioConnection c6(audioIngest, 0, i2s2, 0);
+AudioConnection c7(audioIngest, 0, i2s2, 1);
 
 AudioControlSGTL5000 sgtl5000; // xy=404,516
 
-q15_t __attribute__((aligned(4))) dsp_buffer[FFT_BASE_SIZE * 3];
-q15_t __attribute__((aligned(4))) dsp_output[FFT_SIZE * 2];
-q15_t __attribute__((aligned(4))) input_gulp[FFT_BASE_SIZE * 5];
+q15_t *dsp_buffer; // FFT_BASE_SIZE * 3 samples at 6.4 kHz, in the audioIngest ring
+DMAMEM q15_t __attribute__((aligned(4))) dsp_output[FFT_SIZE * 2];
 
 char Station_Call[11];         // six character call sign + /0
 char Station_Locator[7];       // up to six character locator  + /0
@@ -103,9 +98,10 @@ int ft8_flag;
 int FT_8_counter;
 int ft8_marker;
 int decode_flag;
+int early_decode_flag;
 int WF_counter;
 int xmit_flag;
-int ft8_xmit_counter;
+volatile int ft8_xmit_counter;
 int DSP_Flag;
 int master_decoded;
 
@@ -120,7 +116,12 @@ int slot_state = 0;
 int target_slot;
 
 static void process_data();
+static void process_DSP_gulp();
+static void start_slot_if_due();
 static void update_synchronization();
+static bool queue_autoseq_reply(int first, int last, bool queue);
+static bool loop_idle();
+static void continue_startup();
 
 // Helper function for updating TX region display
 void tx_display_update(void)
@@ -142,8 +143,9 @@ void tx_display_update(void)
   display_qso_state(autoseq_state_str);
 }
 
-void setup(void)
+COLD_CODE void setup(void)
 {
+  memory_begin();
   Serial.begin(9600);
 
   if (CrashReport)
@@ -168,7 +170,7 @@ void setup(void)
   tft.backlight(true);
   tft.useCapINT(CTP_INT); // we use the capacitive chip Interrupt out!
   tft.setTouchLimit(MAXTOUCHLIMIT);
-  tft.enableCapISR(true); // capacitive touch screen interrupt it's armed
+  begin_touch(CTP_INT);   // touches are taken from the interrupt, see process_touch()
   tft.fillRect(0, 0, 1024, 600, BLACK);
 
   Init_BoardVersionInput();
@@ -179,7 +181,7 @@ void setup(void)
   init_DSP();
   set_startup_freq();
 
-  AudioMemory(100);
+  AudioMemory(12);
   RX_volume = 6;
   RF_Gain = 20;
 
@@ -189,33 +191,19 @@ void setup(void)
   sgtl5000.lineOutLevel(31);
   sgtl5000.volume(0.4);
 
-  sine1.amplitude(1.0);
-  sine1.frequency(10000);
-  sine1.phase(0);
-
-  sine2.amplitude(1.0);
-  sine2.frequency(10000);
-  sine2.phase(90.0);
-
-  fir1.begin(FIR_I, NUM_COEFFS);
-  fir2.begin(FIR_Q, NUM_COEFFS);
-
-  mixer1.gain(0, 0.4);
-  mixer1.gain(1, 0.4);
-
-  mixer2.gain(0, 0.4);
-  mixer2.gain(1, -0.4);
-
   set_RF_Gain(RF_Gain);
   set_Attenuator_Gain(1.0);
 
-  audioQueue.begin();
+  audioIngest.begin();
 
   start_time = millis();
 
   open_stationData_file();
+  spectrogram_begin();
+  capture_begin();
 
   set_Station_Coordinates();
+  clear_auto_memories();
 
   LatLong ll = QRAtoLatLong(Station_Locator);
   if (ll.isValid)
@@ -232,82 +220,57 @@ void setup(void)
 
   display_value(620, 559, RF_Gain);
 
-  Init_Log_File();
-  draw_map(Map_Index);
-
   autoseq_init(Station_Call, Short_Station_Locator);
+
+  display_queue_begin();
+  profile_begin();
+  power_begin();
+
+  // The log file, the worked before index and the maps follow from loop(), see continue_startup()
 }
 
 // charley is a dope without hope
 void loop()
 {
-  const int offset_index = 8;
-  if (!decode_flag)
-    process_data();
+  service_FT8_tone();
+  process_data();
+  process_DSP_gulp();
 
-  if (DSP_Flag)
+  if (early_decode_flag) // early pass on the signals that started on time
   {
-    process_FT8_FFT();
-
-    if (xmit_flag)
+    if (!Tune_On && !xmit_flag)
     {
-      if (!Tune_On)
-      {
-        if (ft8_xmit_counter >= offset_index && ft8_xmit_counter < 79 + offset_index)
-        {
-          set_FT8_Tone(tones[ft8_xmit_counter - offset_index]);
-        }
+      early_decoded = ft8_decode_early();
 
-        ft8_xmit_counter++;
-
-        if (ft8_xmit_counter == 80 + offset_index)
-        {
-          xmit_flag = 0;
-          terminate_transmit_armed();
-        }
-      }
+      if (!was_txing)
+        early_reply_queued = queue_autoseq_reply(0, early_decoded, true);
     }
 
-    display_time(880, 30);
-
-    DSP_Flag = 0;
+    early_decode_flag = 0;
   }
 
   if (decode_flag && !Tune_On && !xmit_flag) // start of servicing FT_Decode
   {
 
-    master_decoded = ft8_decode();
+    master_decoded = ft8_decode(Decode_Budget_ms[BandIndex]);
 
-    display_messages(new_decoded, master_decoded);
+    display_messages(master_decoded);
+    plot_heard_stations(new_decoded, master_decoded);
+    profile_end_slot();
 
     for (int i = 0; i < master_decoded; ++i)
     {
       if (strindex(new_decoded[i].call_to, Station_Call) >= 0)
       {
-        char received_message[22];
-        sprintf(received_message, "%s %s %s", new_decoded[i].call_to, new_decoded[i].call_from, new_decoded[i].locator);
-        strcpy(current_message, received_message);
+        strcpy(current_message, decode_text(i));
         update_message_log_display(0);
       }
     }
 
     if (!was_txing)
     {
-      for (int i = 0; i < master_decoded; i++)
-      {
-        // TX is (potentially) necessary
-        if (autoseq_on_decode(&new_decoded[i]))
-        {
-          // Fetch TX msg
-          if (autoseq_get_next_tx(autoseq_txbuf))
-          {
-            queue_custom_text(autoseq_txbuf);
-            QSO_xmit = 1;
-            tx_display_update();
-            break;
-          }
-        }
-      }
+      // Every caller is taken in, but a reply the early pass queued stands
+      queue_autoseq_reply(early_decoded, master_decoded, !early_reply_queued);
 
       if (!QSO_xmit)
       { // Check if QSO_xmit
@@ -344,10 +307,36 @@ void loop()
       } // Check if QSO_xmit End
     }
 
+    early_decoded = 0;
+    early_reply_queued = false;
     decode_flag = 0;
 
   } // end of sevicing FT_Decode
 
+  // PSK Reporter spots, logged QSOs, the spot history and captured slots leave in the quiet middle of an RX slot, well
+  // clear of TX keying, symbol timing, the early decode and the end of slot decode. The next replies get encoded then too.
+  bool quiet_rx = !decode_flag && !xmit_flag && FT_8_counter > 8 && FT_8_counter < ft8_early_samples - 8;
+  if (quiet_rx)
+  {
+    if (!Tune_On)
+      continue_startup();
+    if (!sendReceivedRecords())
+      sendDecodeRecords();
+    flush_ADIF_Log();
+    flush_Spot_History(false);
+    service_Capture();
+    autoseq_prepare_tx();
+  }
+
+  // Only the spectrogram rows are left to keep up with then, the decodes and TX run at full speed
+  power_idle_clock(quiet_rx && !Tune_On);
+
+  service_Telemetry();
+
+  // The power may be about to go, the log cannot wait for the quiet window
+  if (power_off_pressed())
+    flush_ADIF_Log();
+
   process_touch();
 
   if (clr_pressed)
@@ -385,7 +374,67 @@ void loop()
     tx_display_update();
   }
 
+  serviceTimeSync();
+
   update_synchronization();
+
+  // What was drawn this pass reaches the screen a little at a time, between audio gulps
+  service_display(display_budget_us);
+
+  if (loop_idle())
+    power_wait();
+}
+
+// One spectrogram row per DSP gulp, and the end of a transmission the symbol clock has finished
+static void process_DSP_gulp()
+{
+  if (DSP_Flag)
+  {
+    process_FT8_FFT();
+
+    if (xmit_flag && !Tune_On && FT8_transmit_done())
+    {
+      xmit_flag = 0;
+      terminate_transmit_armed();
+    }
+
+    display_time(880, 30);
+
+    DSP_Flag = 0;
+  }
+}
+
+// Called by the decoder between candidates, so that the audio queue keeps draining
+// and the next slot's spectrogram keeps filling however long the decode takes
+void service_audio(void)
+{
+  service_FT8_tone();
+  process_data();
+  start_slot_if_due();
+  process_DSP_gulp();
+}
+
+// Feed decodes first..last-1 to the auto-sequencer, and if any asks for a reply and queue
+// is set, queue the one it sends first. Callers it does not answer now wait their turn.
+static bool queue_autoseq_reply(int first, int last, bool queue)
+{
+  bool reply = false;
+  for (int i = first; i < last; i++)
+  {
+    // TX is (potentially) necessary
+    if (autoseq_on_decode(&new_decoded[i]))
+      reply = true;
+  }
+
+  // Fetch TX msg
+  if (reply && queue && autoseq_get_next_tx(autoseq_txbuf))
+  {
+    queue_custom_text(autoseq_txbuf);
+    QSO_xmit = 1;
+    tx_display_update();
+    return true;
+  }
+  return false;
 }
 
 time_t getTeensy3Time()
@@ -395,54 +444,145 @@ time_t getTeensy3Time()
 
 static void process_data()
 {
-  if (audioQueue.available() >= num_que_blocks)
+  if (!DSP_Flag && audioIngest.available() >= AudioIngest::gulp_samples)
   {
-    for (int i = 0; i < num_que_blocks; i++)
-    {
-      memcpy(input_gulp + block_size * i,
-             audioQueue.readBuffer(),
-             AUDIO_BLOCK_SAMPLES * sizeof(uint16_t));
-      audioQueue.freeBuffer();
-    }
+    Profile_Scope scope(Profile_Process_Data);
+    profile_audio_backlog(audioIngest.available());
 
-    const size_t length = FFT_SIZE;
-    memmove(dsp_buffer,
-            dsp_buffer + FFT_BASE_SIZE,
-            length * sizeof(q15_t));
-    for (int i = 0; i < FFT_BASE_SIZE; i++)
-    {
-      dsp_buffer[length + i] = input_gulp[i * 5]; // decimation by 5
-    }
+    // Filtered and decimated as it arrived, point the FFT at it where it lies
+    uint32_t overruns = audioIngest.overruns;
+    dsp_buffer = audioIngest.take_gulp();
+    if (audioIngest.overruns != overruns)
+      Serial.printf("audio: ingest ring overrun, %lu so far\n", audioIngest.overruns);
 
     DSP_Flag = 1;
   }
 }
 
-void update_synchronization()
+// Set by start_slot_if_due() for the rest of the slot change, which waits for update_synchronization()
+static bool slot_started = false;
+
+// Move of start_time asked for by align_slots_to_utc(), made at the next slot boundary so that
+// no slot is cut short or run twice. After the first, a step moves the slots by at most
+// max_slot_step_ms; clock drift between syncs is far less than that.
+static const uint32_t slot_cycle_ms = 2 * FT8_Protocol::slot_ms; // an even and an odd slot
+static const int32_t max_slot_step_ms = 1000;
+static int32_t slot_correction_ms = 0;
+static bool slots_aligned = false;
+static uint32_t slot_begin_ms = 0;
+
+// The part of the correction that the next slot boundary makes. Not until the slot is half
+// over, so that the slot just started is not taken for the one before.
+static int32_t slot_step(uint32_t current_time)
+{
+  if (current_time - slot_begin_ms < FT8_Protocol::slot_ms / 2)
+    return 0;
+
+  int32_t step = slot_correction_ms;
+  if (slots_aligned && step > max_slot_step_ms)
+    return max_slot_step_ms;
+  if (slots_aligned && step < -max_slot_step_ms)
+    return -max_slot_step_ms;
+  return step;
+}
+
+// Update slot and reset RX. This much is also done from within the decoder, see service_audio()
+static void start_slot_if_due()
 {
   uint32_t current_time = millis();
-  ;
-  ft8_time = current_time - start_time;
 
-  // Update slot and reset RX
-  int current_slot = ft8_time / 15000 % 2;
+  // The boundary is looked for where the correction puts it, so a slot is neither cut short nor run
+  // twice. A cycle on keeps the time positive without changing the slot.
+  int32_t step = slot_step(current_time);
+  int32_t elapsed = (int32_t)(current_time - start_time) - step + (int32_t)slot_cycle_ms;
+  int current_slot = elapsed / FT8_Protocol::slot_ms % 2;
   if (current_slot != slot_state)
   {
+    // Within a cycle of now, so that ft8_time neither goes negative nor wraps
+    start_time = current_time - (uint32_t)(elapsed % slot_cycle_ms);
+    slot_begin_ms = current_time - (uint32_t)(elapsed % FT8_Protocol::slot_ms);
+    slot_correction_ms -= step;
+    slots_aligned |= step != 0;
+
     // toggle the slot state
     slot_state ^= 1;
+
+    ft8_flag = 1;
+    FT_8_counter = 0;
+    ft8_marker = 1;
+    WF_counter = 0;
+    slot_started = true;
+  }
+
+  // Time into the cycle as the slots now run, for the partial TX
+  ft8_time = (uint32_t)(elapsed % slot_cycle_ms);
+}
+
+// What setup() leaves to the loop, so that the audio and the slot timing start straight away.
+// One step per pass, in the quiet part of the RX slots, which all fit in the first slot or two.
+enum Startup_Step
+{
+  Startup_Log_File,
+  Startup_Worked_Index,
+  Startup_Map,          // the map on show, drawn straight from its image
+  Startup_Preload_Maps, // the off-screen copies, one map a step
+  Startup_Report,
+  Startup_Done
+};
+
+static int startup_step = Startup_Log_File;
+
+static COLD_CODE void continue_startup()
+{
+  switch (startup_step)
+  {
+  case Startup_Log_File:
+    Init_Log_File();
+    break;
+  case Startup_Worked_Index:
+    load_Worked_Index();
+    break;
+  case Startup_Map:
+    draw_map(Map_Index);
+    break;
+  case Startup_Preload_Maps:
+    if (!preload_next_map())
+      return;
+    break;
+  case Startup_Report:
+    Serial.printf("startup: done %lu ms after power up\n", millis());
+    memory_report();
+    break;
+  default:
+    return;
+  }
+  ++startup_step;
+}
+
+// Whether the loop has nothing to do until an interrupt brings it something, see Power.h.
+// Work that comes in the meantime waits at most until the next SysTick.
+static bool loop_idle()
+{
+  return !DSP_Flag && audioIngest.available() < AudioIngest::gulp_samples && !decode_flag &&
+         !early_decode_flag && !slot_started && !display_pending() && !timeSyncBusy() && !FT8_tone_due();
+}
+
+void update_synchronization()
+{
+  start_slot_if_due();
+
+  if (slot_started)
+  {
     if (was_txing)
     {
       autoseq_tick();
     }
-    
+
     was_txing = 0;
 
-    ft8_flag = 1;
-    FT_8_counter = 0;
-    ft8_marker = 1;
-    WF_counter = 0;
     tx_display_update();
     getTime();
+    slot_started = false;
   }
 
   // Check if TX is intended
@@ -452,7 +592,9 @@ void update_synchronization()
     QSO_xmit = 0;
     was_txing = 1;
     // Partial TX, set the TX counter based on current ft8_time
-    ft8_xmit_counter = (ft8_time % 15000) / 160; // 160ms per symbol
+    uint32_t slot_ms = ft8_time % FT8_Protocol::slot_ms;
+    ft8_xmit_counter = slot_ms / (FT8_Protocol::symbol_us / 1000);
+    start_FT8_symbol_clock(slot_ms);
 
     // Log the TX
     if (strindex(autoseq_txbuf, "CQ") < 0)
@@ -466,11 +608,29 @@ void update_synchronization()
   }
 }
 
+// Put the slot boundaries on the UTC quarter minutes, given the millis() at which UTC second utc began.
+// The move is made from the next slot boundary on, see start_slot_if_due() and slot_step().
+void align_slots_to_utc(uint32_t second_millis, time_t utc)
+{
+  uint32_t cycle_ms = (uint32_t)((uint64_t)utc * 1000 % slot_cycle_ms);
+  uint32_t aligned_start = second_millis - cycle_ms;
+
+  // The shortest way round the cycle, a whole slot swaps even and odd
+  int32_t correction = (int32_t)(aligned_start - start_time) % (int32_t)slot_cycle_ms;
+  if (correction > (int32_t)FT8_Protocol::slot_ms)
+    correction -= (int32_t)slot_cycle_ms;
+  else if (correction <= -(int32_t)FT8_Protocol::slot_ms)
+    correction += (int32_t)slot_cycle_ms;
+  slot_correction_ms = correction;
+}
+
 void sync_FT8(void)
 {
   setSyncProvider(getTeensy3Time);
   Teensy3Clock.set(now()); // set the RTC
   start_time = millis();
+  slot_correction_ms = 0;
+  slot_begin_ms = start_time;
   ft8_flag = 1;
   FT_8_counter = 0;
   ft8_marker = 1;
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SD.h>
+#include <TimeLib.h>
+
+#include "SlotCapture.h"
+#include "Process_DSP.h"
+#include "button.h"
+
+int Capture_On = 0;
+
+// Sized by capture_begin(), once spectrogram_begin() has settled the bandwidth
+static size_t capture_size;
+
+// A file goes out in a few large writes into space allocated up front, so the card sees
+// whole clusters and the FAT is touched once. One write every write_interval_ms leaves
+// the loop free for the audio, display and touch between them.
+static const size_t write_size = 16384;
+static const uint32_t write_interval_ms = 50;
+
+static uint8_t *capture_buffer = NULL;
+static size_t capture_written = 0;
+static bool capture_pending = false;
+static uint32_t last_write_ms;
+static FsFile capture_file;
+static uint32_t captures_dropped = 0;
+
+void capture_begin(void)
+{
+  if (!Capture_On || capture_buffer != NULL)
+    return;
+
+  capture_size = sizeof(Capture_Header) + spectrogram_size();
+  // Only touched a few times a slot, so PSRAM if there is any
+  capture_buffer = (uint8_t *)extmem_malloc(capture_size);
+  if (capture_buffer == NULL)
+  {
+    Serial.printf("capture: no room for %u bytes, capture is off\n", (unsigned)capture_size);
+    Capture_On = 0;
+    return;
+  }
+
+  if (!SD.sdfs.exists("Capture"))
+    SD.sdfs.mkdir("Capture");
+}
+
+void capture_slot(const uint8_t *power, time_t slot_time, int band, uint16_t cursor_freq)
+{
+  if (capture_buffer == NULL)
+    return;
+
+  if (capture_pending)
+  {
+    Serial.printf("capture: slot dropped, %lu so far\n", ++captures_dropped);
+    return;
+  }
+
+  Capture_Header header;
+  header.magic = kCapture_magic;
+  header.header_size = sizeof(header);
+  header.cursor_freq = cursor_freq;
+  header.time = (uint32_t)slot_time;
+  header.dial_khz = sBand_Data[band].Frequency;
+  header.band = (uint8_t)band;
+  header.rows_per_block = 4;
+  header.num_blocks = ft8_msg_samples;
+  header.num_bins = ft8_buffer;
+
+  memcpy(capture_buffer, &header, sizeof(header));
+  memcpy(capture_buffer + sizeof(header), power, spectrogram_size());
+  capture_written = 0;
+  capture_pending = true;
+}
+
+static bool open_capture_file(void)
+{
+  const Capture_Header *header = (const Capture_Header *)capture_buffer;
+  time_t slot_time = header->time;
+
+  char file_name[32];
+  sprintf(file_name, "Capture/%04i%02i%02i_%02i%02i%02i.fft", year(slot_time), month(slot_time), day(slot_time),
+          hour(slot_time), minute(slot_time), second(slot_time));
+
+  capture_file = SD.sdfs.open(file_name, O_WRITE | O_CREAT | O_TRUNC);
+  if (!capture_file)
+  {
+    Serial.printf("capture: cannot open %s\n", file_name);
+    return false;
+  }
+  capture_file.preAllocate(capture_size);
+  return true;
+}
+
+void service_Capture(void)
+{
+  if (!capture_pending || millis() - last_write_ms < write_interval_ms)
+    return;
+  last_write_ms = millis();
+
+  if (capture_written == 0 && !open_capture_file())
+  {
+    capture_pending = false;
+    return;
+  }
+
+  size_t size = capture_size - capture_written;
+  if (size > write_size)
+    size = write_size;
+
+  if (capture_file.write(capture_buffer + capture_written, size) != size)
+  {
+    Serial.printf("capture: write failed\n");
+    capture_written = capture_size;
+  }
+  else
+  {
+    capture_written += size;
+  }
+
+  if (capture_written == capture_size)
+  {
+    capture_file.close();
+    capture_pending = false;
+  }
+}
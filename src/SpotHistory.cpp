@@ -0,0 +1,109 @@
+#include <string.h>
+#include <stdio.h>
+
+#include <SD.h>
+#include <TimeLib.h>
+
+#include "SpotHistory.h"
+
+// Slots wait here and reach the card in a few large appends. They go once half the
+// buffer is used or the oldest has waited five minutes, so a power cut costs little.
+DMAMEM static uint8_t spot_buffer[8192];
+static size_t spot_buffered = 0;
+static const size_t spot_flush_size = sizeof(spot_buffer) / 2;
+static const time_t spot_flush_age = 300;
+
+static time_t first_staged_time;
+static time_t staged_day = -1; // the file the staged slots belong to
+
+// Header of the slot being decoded, or -1
+static int open_header = -1;
+static time_t open_slot_time;
+static int open_band;
+
+static void append_to_file(void)
+{
+  char file_name[16];
+  sprintf(file_name, "%04i%02i%02i.spt", year(first_staged_time), month(first_staged_time), day(first_staged_time));
+
+  File spot_file = SD.open(file_name, FILE_WRITE);
+  if (spot_file)
+  {
+    spot_file.write(spot_buffer, spot_buffered);
+    spot_file.close();
+  }
+  else
+  {
+    Serial.printf("spot history: cannot open %s, %u bytes lost\n", file_name, (unsigned)spot_buffered);
+  }
+
+  spot_buffered = 0;
+}
+
+void flush_Spot_History(bool force)
+{
+  // The slot being decoded is not finished, it goes with the next flush
+  if (spot_buffered == 0 || open_header >= 0)
+    return;
+
+  if (force || spot_buffered >= spot_flush_size || now() - first_staged_time >= spot_flush_age)
+    append_to_file();
+}
+
+void spot_history_begin_slot(time_t slot_time, int band)
+{
+  open_header = -1;
+  open_slot_time = slot_time;
+  open_band = band;
+}
+
+static void open_slot(void)
+{
+  // A file holds one UTC day, and a slot that fills the buffer carries on under another header
+  time_t slot_day = open_slot_time / SECS_PER_DAY;
+  if (spot_buffered > 0 && (slot_day != staged_day ||
+                            spot_buffered + sizeof(Spot_Slot_Header) + sizeof(Spot_Record) > sizeof(spot_buffer)))
+    append_to_file();
+
+  if (spot_buffered == 0)
+  {
+    first_staged_time = open_slot_time;
+    staged_day = slot_day;
+  }
+
+  Spot_Slot_Header header = {kSpot_slot_magic, (uint32_t)open_slot_time, (uint8_t)open_band, 0, sizeof(Spot_Record)};
+  open_header = spot_buffered;
+  memcpy(spot_buffer + spot_buffered, &header, sizeof(header));
+  spot_buffered += sizeof(header);
+}
+
+void spot_history_add(int freq_hz, int snr, int sync_score, const uint8_t *payload)
+{
+  if (open_header < 0)
+    open_slot();
+
+  Spot_Slot_Header *header = (Spot_Slot_Header *)(spot_buffer + open_header);
+  if (header->count == 255 || spot_buffered + sizeof(Spot_Record) > sizeof(spot_buffer))
+  {
+    // Carry on in a new header for the same slot
+    open_header = -1;
+    open_slot();
+    header = (Spot_Slot_Header *)(spot_buffer + open_header);
+  }
+
+  Spot_Record record;
+  record.freq_hz = (uint16_t)freq_hz;
+  record.snr = (int8_t)snr;
+  record.reserved = 0;
+  record.sync_score = (int16_t)sync_score;
+  memcpy(record.payload, payload, sizeof(record.payload));
+
+  memcpy(spot_buffer + spot_buffered, &record, sizeof(record));
+  spot_buffered += sizeof(record);
+  ++header->count;
+}
+
+void spot_history_end_slot(void)
+{
+  open_header = -1;
+}
@@ -0,0 +1,179 @@
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "Telemetry.h"
+#include "decode_ft8.h"
+#include "button.h"
+#include "main.h"
+
+int Telemetry_Decodes_On = 0;
+int Telemetry_Spectra_On = 0;
+int Telemetry_Profile_On = 0;
+
+// The second USB serial port with the dual serial USB type, else the text has to share
+#if defined(USB_DUAL_SERIAL) || defined(USB_TRIPLE_SERIAL)
+#define TELEMETRY_PORT SerialUSB1
+#else
+#define TELEMETRY_PORT Serial
+#endif
+
+// What is waiting for the port. A slot's spectrogram comes a symbol at a time, 1.9 KB every
+// 160 ms at the widest bandwidth, so this holds well over a second of it with the decodes.
+static const uint32_t ring_size = 16384; // a power of two
+DMAMEM static uint8_t ring[ring_size];
+static uint32_t ring_head = 0; // next byte to send
+static uint32_t ring_tail = 0; // next byte to fill, both running on past ring_size
+static uint8_t sequence = 0;
+static bool host_open = false;
+static uint32_t frames_dropped = 0;
+
+static uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t size)
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; ++bit)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+static void ring_put(const void *data, size_t size)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t at = ring_tail % ring_size;
+  size_t first = size < ring_size - at ? size : ring_size - at;
+  memcpy(ring + at, bytes, first);
+  memcpy(ring, bytes + first, size - first);
+  ring_tail += size;
+}
+
+// A frame of a record and what follows it, whole or not at all
+static void send_frame(uint8_t type, const void *record, size_t record_size, const void *data, size_t data_size)
+{
+  if (!host_open)
+    return;
+
+  Telemetry_Frame_Header header;
+  header.sync[0] = kTelemetry_sync0;
+  header.sync[1] = kTelemetry_sync1;
+  header.type = type;
+  header.sequence = sequence++;
+  header.length = (uint16_t)(record_size + data_size);
+
+  size_t frame_size = sizeof(header) + record_size + data_size + 2;
+  if (frame_size > ring_size - (ring_tail - ring_head))
+  {
+    ++frames_dropped;
+    return;
+  }
+
+  uint16_t crc = crc16_update(0xFFFF, (const uint8_t *)&header, sizeof(header));
+  crc = crc16_update(crc, (const uint8_t *)record, record_size);
+  crc = crc16_update(crc, (const uint8_t *)data, data_size);
+  uint8_t crc_bytes[2] = {(uint8_t)crc, (uint8_t)(crc >> 8)};
+
+  ring_put(&header, sizeof(header));
+  ring_put(record, record_size);
+  if (data_size > 0)
+    ring_put(data, data_size);
+  ring_put(crc_bytes, sizeof(crc_bytes));
+}
+
+void telemetry_slot(time_t slot_time, int band, int num_decoded)
+{
+  if (!Telemetry_Decodes_On)
+    return;
+
+  Telemetry_Slot_Record slot;
+  slot.time = (uint32_t)slot_time;
+  slot.dial_hz = (uint32_t)sBand_Data[band].Frequency * 1000;
+  slot.band = (uint8_t)band;
+  slot.decodes = (uint8_t)num_decoded;
+  slot.passes = (uint8_t)decode_stats.passes;
+  slot.was_txing = was_txing != 0;
+  slot.candidates = (uint16_t)decode_stats.candidates;
+  slot.tried = (uint16_t)decode_stats.tried;
+  slot.decode_us = decode_stats.elapsed_us;
+  send_frame(Telemetry_Slot, &slot, sizeof(slot), NULL, 0);
+
+  for (int i = 0; i < num_decoded; ++i)
+  {
+    const Decode *decode = &new_decoded[i];
+    const char *text = decode_text(i);
+
+    Telemetry_Decode_Record record;
+    record.time = (uint32_t)slot_time;
+    record.freq_hz = (uint16_t)decode->freq_hz;
+    record.time_ms = (int16_t)decode->time_ms;
+    record.snr = (int8_t)decode->snr;
+    record.flags = 0;
+    if (decode->calling_CQ)
+      record.flags |= kTelemetry_CQ;
+    char call_to[sizeof(decode->call_to)];
+    copy_bare_call(call_to, decode->call_to);
+    if (strncmp(call_to, Station_Call, sizeof(call_to)) == 0)
+      record.flags |= kTelemetry_To_Me;
+    record.sync_score = (int16_t)decode->sync_score;
+    memcpy(record.payload, decode->payload, sizeof(record.payload));
+    record.text_length = (uint8_t)strlen(text);
+    send_frame(Telemetry_Decode, &record, sizeof(record), text, record.text_length);
+  }
+}
+
+void telemetry_spectrum(int block, const uint8_t *rows, int num_bins, int32_t offset_q8)
+{
+  if (!Telemetry_Spectra_On)
+    return;
+
+  Telemetry_Spectrum_Record record;
+  record.block = (uint16_t)block;
+  record.num_bins = (uint16_t)num_bins;
+  record.rows = 4;
+  record.reserved = 0;
+  record.offset_q8 = offset_q8;
+  send_frame(Telemetry_Spectrum, &record, sizeof(record), rows, (size_t)num_bins * record.rows);
+}
+
+void telemetry_profile(const Telemetry_Profile_Record *record, const Telemetry_Profile_Point *points)
+{
+  if (!Telemetry_Profile_On)
+    return;
+
+  send_frame(Telemetry_Profile, record, sizeof(*record), points, record->points * sizeof(points[0]));
+}
+
+void service_Telemetry(void)
+{
+  if (!Telemetry_Decodes_On && !Telemetry_Spectra_On && !Telemetry_Profile_On)
+    return;
+
+  // Nothing is kept for a host that is not there, and a new one starts on a whole frame
+  bool open = TELEMETRY_PORT;
+  if (open != host_open)
+  {
+    ring_head = ring_tail;
+    host_open = open;
+    if (frames_dropped > 0)
+      Serial.printf("telemetry: %lu frames dropped\n", (unsigned long)frames_dropped);
+    frames_dropped = 0;
+  }
+
+  while (host_open && ring_head != ring_tail)
+  {
+    int room = TELEMETRY_PORT.availableForWrite();
+    if (room <= 0)
+      break;
+
+    uint32_t at = ring_head % ring_size;
+    uint32_t size = ring_tail - ring_head;
+    if (size > ring_size - at)
+      size = ring_size - at;
+    if (size > (uint32_t)room)
+      size = room;
+
+    TELEMETRY_PORT.write(ring + at, size);
+    ring_head += size;
+  }
+}
@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "constants.h"
+#include "ldpc.h"
+#include "pack.h"
+#include "ap_decode.h"
+
+// Fields of a standard (i3 = 1 or 2) payload
+static const int kCalls_bits = 58;  // two 28 bit calls, each with its /P or /R bit
+static const int kLast_bits = 16;   // R flag and grid, report, RRR, RR73 or 73
+static const int kI3_first_bit = 74;
+
+static inline bool get_bit(const uint8_t *bytes, int i)
+{
+  return (bytes[i / 8] >> (7 - i % 8)) & 1;
+}
+
+static void set_bits(uint8_t *bytes, int first, int count)
+{
+  for (int i = first; i < first + count; ++i)
+    bytes[i / 8] |= 0x80 >> (i % 8);
+}
+
+static bool add_hypothesis(const char *mycall, const char *dxcall, const char *last, bool last_known,
+                           AP_Hypothesis *hypothesis)
+{
+  char text[40];
+  snprintf(text, sizeof(text), "%s %s %s", mycall, dxcall, last);
+  if (pack77(text, hypothesis->payload) < 0)
+    return false;
+
+  // Anything else has been packed as free text or in another layout
+  uint8_t i3 = (hypothesis->payload[9] >> 3) & 0x07;
+  if (i3 != 1 && i3 != 2)
+    return false;
+
+  memset(hypothesis->known, 0, sizeof(hypothesis->known));
+  set_bits(hypothesis->known, 0, kCalls_bits);
+  if (last_known)
+    set_bits(hypothesis->known, kCalls_bits, kLast_bits);
+  set_bits(hypothesis->known, kI3_first_bit, 3);
+  return true;
+}
+
+int ap_hypotheses(const char *mycall, const char *dxcall, bool rogers, bool signoff, AP_Hypothesis hypotheses[])
+{
+  // Any standard message, its last field left to be decoded
+  int count = 0;
+  if (!add_hypothesis(mycall, dxcall, "RRR", false, &hypotheses[count]))
+    return 0;
+  ++count;
+
+  if (rogers)
+  {
+    count += add_hypothesis(mycall, dxcall, "RRR", true, &hypotheses[count]);
+    count += add_hypothesis(mycall, dxcall, "RR73", true, &hypotheses[count]);
+  }
+  if (signoff)
+    count += add_hypothesis(mycall, dxcall, "73", true, &hypotheses[count]);
+  return count;
+}
+
+int ap_decode(const float codeword[], const AP_Hypothesis hypotheses[], int num_hypotheses,
+              int max_iters, uint8_t plain[])
+{
+  // A little stronger than anything received, as WSJT-X does
+  float magnitude = 0;
+  for (int i = 0; i < N; ++i)
+    if (fabsf(codeword[i]) > magnitude)
+      magnitude = fabsf(codeword[i]);
+  magnitude *= 1.01f;
+
+  for (int h = 0; h < num_hypotheses; ++h)
+  {
+    const AP_Hypothesis *hypothesis = &hypotheses[h];
+    float ap_codeword[N];
+    memcpy(ap_codeword, codeword, sizeof(ap_codeword));
+    for (int i = 0; i < 77; ++i)
+      if (get_bit(hypothesis->known, i))
+        ap_codeword[i] = get_bit(hypothesis->payload, i) ? magnitude : -magnitude;
+
+    int n_errors = 0;
+    bp_decode(ap_codeword, max_iters, plain, &n_errors);
+    if (n_errors > 0)
+      continue;
+
+    bool agrees = true;
+    for (int i = 0; i < 77 && agrees; ++i)
+      if (get_bit(hypothesis->known, i) && plain[i] != get_bit(hypothesis->payload, i))
+        agrees = false;
+    if (!agrees)
+      continue;
+
+    int hard_errors = 0;
+    for (int i = 0; i < N; ++i)
+      hard_errors += plain[i] != (codeword[i] > 0);
+    return hard_errors;
+  }
+  return -1;
+}
@@ -13,12 +13,16 @@
 #include <stdio.h>
 
 #include "autoseq_engine.h"
-#include "gen_ft8.h" // For accessing CQ_Mode_Index and saving Target_*
+#include "gen_ft8.h" // For accessing CQ_Mode_Index and saving Target_*, genft8()
+#include "pack.h"    // For pack77()
+#include "constants.h" // For K_BYTES
 #include "ADIF.h"    // For write_ADIF_Log()
 #include "button.h"  // For BandIndex
 
 /***** Compile‑time knobs *****/
 #define MAX_TX_RETRY 2
+#define MAX_QSOS 4       /* callers worked at once when calling CQ */
+#define MAX_WAIT_SLOTS 3 /* a QSO not heard from for this many of our slots is dropped */
 
 /***** Identifiers for the six canonical FT8 messages *****/
 typedef enum
@@ -44,32 +48,65 @@ typedef enum
     AS_CALLING,
 } autoseq_state_t;
 
-/***** Control‑block *****/
+/***** Control‑block, one per QSO *****/
 typedef struct
 {
     autoseq_state_t state;
     tx_msg_t next_tx;
     tx_msg_t rcvd_msg_type;
 
-    char mycall[CALLSIGN_SIZE];
-    char mygrid[LOCATOR_SIZE];
     char dxcall[CALLSIGN_SIZE];
     char dxgrid[LOCATOR_SIZE];
-    int snr_tx; /* SNR we report to DX (‑dB) */
+    int dxfreq;     /* audio frequency the DX station was last decoded on */
+    int snr_tx;     /* SNR we report to DX (‑dB) */
+    int snr_rx;     /* SNR DX reported to us */
+    int sync_score; /* of their last decode, to rank callers */
+    bool worked;    /* already in the log on this band */
     int retry_counter;
     int retry_limit;
-    bool logged; /* true => QSO logged */
+    int wait_slots; /* our slots since DX was last heard */
+    bool complete;  /* DX has sent RR73 or 73 */
+    bool logged;    /* true => QSO logged */
 } autoseq_ctx_t;
 
-static autoseq_ctx_t ctx;
+static char mycall[CALLSIGN_SIZE];
+static char mygrid[LOCATOR_SIZE];
+
+/*
+ * When several stations answer a CQ each gets a QSO of its own, and every slot
+ * the one that goes furthest is sent to: a reply to whoever was heard last
+ * slot before a repeat to someone who went quiet, the end of a QSO before the
+ * start of one, and among new callers one not worked before, then the
+ * strongest. The others wait their turn rather than being dropped.
+ */
+static autoseq_ctx_t qsos[MAX_QSOS];
+static autoseq_ctx_t *active = &qsos[0]; /* the QSO sent to this slot, or last */
+static autoseq_ctx_t *chosen = NULL;     /* sent to next whatever the ranking */
+
+/***** Messages of the QSOs encoded ahead of time, indexed by QSO and tx_msg_t *****/
+typedef struct
+{
+    char text[MAX_MSG_LEN]; /* empty if not encoded */
+    uint8_t tones[79];
+} tx_cache_entry_t;
+
+static tx_cache_entry_t tx_cache[MAX_QSOS][TX6 + 1];
+static int tx_cache_next = 0; /* QSO * (TX6 + 1) + tx_msg_t */
 
 /*************** Forward declarations ****************/
-static void set_state(autoseq_state_t s, tx_msg_t first_tx, int limit);
-static void format_tx_text(tx_msg_t id, char *out);
-static void parse_rcvd_msg(const Decode *msg);
+static void set_state(autoseq_ctx_t *ctx, autoseq_state_t s, tx_msg_t first_tx, int limit);
+static void build_tx_text(const autoseq_ctx_t *ctx, tx_msg_t id, char *out);
+static void format_tx_text(autoseq_ctx_t *ctx, tx_msg_t id, char *out);
+static void parse_rcvd_msg(autoseq_ctx_t *ctx, const Decode *msg);
 // Internal helper called by autoseq_on_touch() and autoseq_on_decode()
-static bool generate_response(const Decode *msg, bool override);
-static void write_worked_qso();
+static bool generate_response(autoseq_ctx_t *ctx, const Decode *msg, bool override);
+static void log_and_write_qso(autoseq_ctx_t *ctx);
+static void write_worked_qso(const autoseq_ctx_t *ctx);
+static autoseq_ctx_t *find_qso(const char *dxcall);
+static autoseq_ctx_t *claim_qso(const Decode *msg, bool force);
+static autoseq_ctx_t *next_to_send(void);
+static void release_qso(autoseq_ctx_t *ctx);
+static const Decode *bare_calls(const Decode *msg, Decode *bare);
 
 /******************************************************/
 
@@ -79,18 +116,25 @@ static void write_worked_qso();
 
 void autoseq_init(const char *myCall, const char *myGrid)
 {
-    memset(&ctx, 0, sizeof(ctx));
-    strncpy(ctx.mycall, myCall, CALLSIGN_SIZE-1);
-    strncpy(ctx.mygrid, myGrid, LOCATOR_SIZE-1);
-    ctx.state = AS_IDLE;
+    memset(qsos, 0, sizeof(qsos));
+    memset(mycall, 0, sizeof(mycall));
+    memset(mygrid, 0, sizeof(mygrid));
+    strncpy(mycall, myCall, CALLSIGN_SIZE-1);
+    strncpy(mygrid, myGrid, LOCATOR_SIZE-1);
+    for (int i = 0; i < MAX_QSOS; ++i)
+        qsos[i].state = AS_IDLE;
+    active = &qsos[0];
+    chosen = NULL;
 }
 
 static const char CQ[3] = "CQ";
 
 void autoseq_start_cq(void)
 {
-    memcpy(ctx.dxcall, CQ, sizeof(CQ));
-    set_state(AS_CALLING, TX6, 0); /* infinite CQ loop */
+    autoseq_ctx_t *ctx = claim_qso(NULL, true);
+    memcpy(ctx->dxcall, CQ, sizeof(CQ));
+    set_state(ctx, AS_CALLING, TX6, 0); /* infinite CQ loop */
+    chosen = ctx;
 }
 
 /* === Called for selected decode (manual response) === */
@@ -98,25 +142,35 @@ void autoseq_on_touch(const Decode *msg)
 {
     if (!msg)
         return;
-
-    parse_rcvd_msg(msg);
-    if (strncmp(msg->call_to, ctx.mycall, LOCATOR_SIZE) != 0)
+    Decode bare;
+    msg = bare_calls(msg, &bare);
+
+    // The station picked is sent to next, whatever else is going on
+    autoseq_ctx_t *ctx = find_qso(msg->call_from);
+    if (!ctx)
+        ctx = claim_qso(msg, true);
+    chosen = ctx;
+    ctx->wait_slots = 0;
+
+    parse_rcvd_msg(ctx, msg);
+    if (strncmp(msg->call_to, mycall, LOCATOR_SIZE) != 0)
     {
         // Not addresses to me, treat it as if it's a CQ/TX6
-        ctx.rcvd_msg_type = TX6;
+        ctx->rcvd_msg_type = TX6;
     }
     else
     {
         // Addressed me
-        generate_response(msg, true);
+        generate_response(ctx, msg, true);
         return;
     }
 
     // Must be handling TX6
-    strncpy(ctx.dxcall, msg->call_from, CALLSIGN_SIZE);
-    strncpy(ctx.dxgrid, msg->locator, LOCATOR_SIZE);
-    ctx.snr_tx = msg->snr;
-    set_state(Skip_Tx1 ? AS_REPORT : AS_REPLYING, Skip_Tx1 ? TX2 : TX1, MAX_TX_RETRY);
+    strncpy(ctx->dxcall, msg->call_from, CALLSIGN_SIZE);
+    strncpy(ctx->dxgrid, msg->locator, LOCATOR_SIZE);
+    ctx->dxfreq = msg->freq_hz;
+    ctx->snr_tx = msg->snr;
+    set_state(ctx, Skip_Tx1 ? AS_REPORT : AS_REPLYING, Skip_Tx1 ? TX2 : TX1, MAX_TX_RETRY);
 }
 
 /* === Called for **every** new decode (auto response) === */
@@ -125,32 +179,54 @@ bool autoseq_on_decode(const Decode *msg)
 {
     if (!msg)
         return false;
+    Decode bare;
+    msg = bare_calls(msg, &bare);
 
-    // Not addresses me or current QSO is in progress with a different dxcall, return false
-    if (strncmp(msg->call_to, ctx.mycall, CALLSIGN_SIZE) != 0 ||
-        ((ctx.state == AS_REPLYING || ctx.state == AS_REPORT || ctx.state == AS_ROGER_REPORT) &&
-         strncmp(msg->call_from, ctx.dxcall, CALLSIGN_SIZE) != 0))
+    // Not addresses me, return false
+    if (strncmp(msg->call_to, mycall, CALLSIGN_SIZE) != 0)
     {
         return false;
     }
 
-    parse_rcvd_msg(msg);
+    // A station we are not in QSO with gets a QSO of its own when we are calling CQ
+    autoseq_ctx_t *ctx = find_qso(msg->call_from);
+    if (!ctx)
+    {
+        // Only a grid or a report can answer it
+        if (!Beacon_On || msg->sequence == Seq_Rogers || msg->sequence == Seq_73)
+            return false;
+        ctx = claim_qso(msg, false);
+        if (!ctx)
+            return false;
+    }
+    ctx->wait_slots = 0;
+
+    parse_rcvd_msg(ctx, msg);
 
-    return generate_response(msg, false);
+    return generate_response(ctx, msg, false);
 }
 
 /* === Provide the message we should transmit this slot (if any) === */
 bool autoseq_get_next_tx(char *out_text)
 {
-    format_tx_text(ctx.next_tx, out_text);
-
-    if (ctx.next_tx == TX_UNDEF)
+    autoseq_ctx_t *ctx = chosen ? chosen : next_to_send();
+    chosen = NULL;
+    if (!ctx || ctx->next_tx == TX_UNDEF)
+    {
+        if (out_text)
+            out_text[0] = '\0';
         return false;
+    }
+
+    active = ctx;
+    strncpy(Target_Call, ctx->dxcall, CALLSIGN_SIZE);
+    strncpy(Target_Locator, ctx->dxgrid, LOCATOR_SIZE);
+    format_tx_text(ctx, ctx->next_tx, out_text);
 
     /* Bump retry counter */
-    if (ctx.retry_limit && ctx.retry_counter >= ctx.retry_limit)
+    if (ctx->retry_limit && ctx->retry_counter >= ctx->retry_limit)
     {
-        ctx.state = AS_SIGNOFF; /* give up */
+        ctx->state = AS_SIGNOFF; /* give up */
     }
     return true;
 }
@@ -165,11 +241,19 @@ void autoseq_get_qso_state(char *out_text)
 
     out_text[0] = '\0';
     // IDLE state is treated as no active QSO
-    if (ctx.state == AS_IDLE)
+    if (active->state == AS_IDLE)
     {
         return;
     }
 
+    // Callers waiting their turn
+    int waiting = 0;
+    for (int i = 0; i < MAX_QSOS; ++i)
+    {
+        if (&qsos[i] != active && qsos[i].state != AS_IDLE && qsos[i].next_tx != TX_UNDEF)
+            ++waiting;
+    }
+
     const char states[][5] = {
         "",     // AS_IDLE
         "RPLY", // AS_REPLYING
@@ -180,95 +264,318 @@ void autoseq_get_qso_state(char *out_text)
         "CALL", // AS_CALLING
     };
 
-    snprintf(out_text, MAX_LINE_LEN,
-             " %.4s tried:%1u",
-             states[ctx.state],
-             ctx.retry_counter);
+    if (waiting)
+        snprintf(out_text, MAX_LINE_LEN,
+                 " %.4s tried:%1u +%d",
+                 states[active->state],
+                 active->retry_counter,
+                 waiting);
+    else
+        snprintf(out_text, MAX_LINE_LEN,
+                 " %.4s tried:%1u",
+                 states[active->state],
+                 active->retry_counter);
 }
 
-static void set_next_state(autoseq_state_t next_state, tx_msg_t next_tx)
+static void set_next_state(autoseq_ctx_t *ctx, autoseq_state_t next_state, tx_msg_t next_tx)
 {
-    ctx.state = next_state;
-    ctx.next_tx = next_tx;
+    ctx->state = next_state;
+    ctx->next_tx = next_tx;
     if (next_state == AS_IDLE)
     {
-        ctx.logged = false;
+        ctx->logged = false;
+        ctx->complete = false;
     }
 }
 
-static void handle_state_retry(tx_msg_t tx_on_retry, autoseq_state_t next_state, tx_msg_t next_tx)
+static void handle_state_retry(autoseq_ctx_t *ctx, tx_msg_t tx_on_retry, autoseq_state_t next_state, tx_msg_t next_tx)
 {
-    if (ctx.retry_counter < ctx.retry_limit)
+    if (ctx->retry_counter < ctx->retry_limit)
     {
-        ctx.next_tx = tx_on_retry;
-        ctx.retry_counter++;
+        ctx->next_tx = tx_on_retry;
+        ctx->retry_counter++;
     }
     else
     {
-        set_next_state(next_state, next_tx);
+        set_next_state(ctx, next_state, next_tx);
     }
 }
 
+/* === What the DX station may send next, for a-priori decoding === */
+bool autoseq_get_ap(autoseq_ap_t *ap)
+{
+    if (!ap)
+        return false;
+
+    ap->rogers = false;
+    ap->signoff = false;
+    switch (active->state)
+    {
+    case AS_REPLYING: /* their report */
+    case AS_REPORT:   /* their R report */
+        break;
+    case AS_ROGER_REPORT:
+        ap->rogers = true;
+        ap->signoff = true;
+        break;
+    case AS_ROGERS:
+        ap->signoff = true;
+        break;
+    case AS_SIGNOFF: /* they may not have had our RR73 */
+        ap->rogers = true;
+        break;
+    default:
+        return false;
+    }
+
+    ap->mycall = mycall;
+    ap->dxcall = active->dxcall;
+    ap->dxfreq = active->dxfreq;
+    return mycall[0] != '\0' && active->dxcall[0] != '\0';
+}
+
+/* === Encode the messages the QSOs may send next ahead of time, one per call === */
+void autoseq_prepare_tx(void)
+{
+    /* Only QSOs in progress, and the CQ once for them all */
+    int qso, id;
+    for (int tries = 0; tries < MAX_QSOS * (TX6 + 1); ++tries)
+    {
+        qso = tx_cache_next / (TX6 + 1);
+        id = tx_cache_next % (TX6 + 1);
+        tx_cache_next = (tx_cache_next + 1) % (MAX_QSOS * (TX6 + 1));
+        if (id == TX6 ? qso == 0 : id != TX_UNDEF && qsos[qso].state != AS_IDLE)
+            break;
+        id = TX_UNDEF;
+    }
+    if (id == TX_UNDEF)
+        return;
+
+    char text[MAX_MSG_LEN];
+    build_tx_text(&qsos[qso], (tx_msg_t)id, text);
+    text[MAX_MSG_LEN - 1] = '\0'; /* free texts are copied with strncpy() */
+    tx_cache_entry_t *entry = &tx_cache[qso][id];
+    if (strcmp(text, entry->text) == 0)
+        return;
+
+    uint8_t packed[K_BYTES];
+    if (text[0] == '\0' || pack77(text, packed) < 0)
+    {
+        entry->text[0] = '\0';
+        return;
+    }
+    genft8(packed, entry->tones);
+    strcpy(entry->text, text);
+}
+
+/* === Tones of a message encoded ahead of time, NULL if it was not === */
+const uint8_t *autoseq_cached_tones(const char *text)
+{
+    for (int qso = 0; qso < MAX_QSOS; ++qso)
+    {
+        for (int id = TX1; id <= TX6; ++id)
+        {
+            if (tx_cache[qso][id].text[0] != '\0' && strcmp(tx_cache[qso][id].text, text) == 0)
+                return tx_cache[qso][id].tones;
+        }
+    }
+    return NULL;
+}
+
 /* === Slot timer / time‑out manager === */
 void autoseq_tick(void)
 {
-    switch (ctx.state)
+    autoseq_ctx_t *ctx = active;
+    switch (ctx->state)
     {
     case AS_REPLYING:
-        handle_state_retry(TX1, AS_SIGNOFF, TX5);
+        handle_state_retry(ctx, TX1, AS_SIGNOFF, TX5);
         break;
 
     case AS_REPORT:
-        handle_state_retry(TX2, AS_SIGNOFF, TX5);
+        handle_state_retry(ctx, TX2, AS_SIGNOFF, TX5);
         break;
 
     case AS_ROGER_REPORT:
-        handle_state_retry(TX3, AS_SIGNOFF, TX5);
+        handle_state_retry(ctx, TX3, AS_SIGNOFF, TX5);
         break;
 
     case AS_ROGERS:
-        handle_state_retry(TX4, AS_IDLE, TX_UNDEF);
+        handle_state_retry(ctx, TX4, AS_IDLE, TX_UNDEF);
         break;
 
     case AS_CALLING: // CQ is controlled by Beacon_On, so it's only once
     case AS_SIGNOFF:
-        set_next_state(AS_IDLE, TX_UNDEF);
+        set_next_state(ctx, AS_IDLE, TX_UNDEF);
         break;
     default:
         break;
     }
+
+    /* Give up on the QSOs that have gone quiet while waiting their turn */
+    for (int i = 0; i < MAX_QSOS; ++i)
+    {
+        if (qsos[i].state != AS_IDLE && ++qsos[i].wait_slots > MAX_WAIT_SLOTS)
+            release_qso(&qsos[i]);
+    }
 }
 
 /* ================================================================
  *                Internal helpers
  * ================================================================ */
 
-static void set_state(autoseq_state_t s, tx_msg_t first_tx, int limit)
+static void set_state(autoseq_ctx_t *ctx, autoseq_state_t s, tx_msg_t first_tx, int limit)
 {
-    ctx.state = s;
-    ctx.next_tx = first_tx;
-    ctx.retry_counter = 0;
-    ctx.retry_limit = limit;
+    ctx->state = s;
+    ctx->next_tx = first_tx;
+    ctx->retry_counter = 0;
+    ctx->retry_limit = limit;
 }
 
-static void log_and_write_qso()
+static void log_and_write_qso(autoseq_ctx_t *ctx)
 {
-    if (!ctx.logged)
+    if (!ctx->logged)
     {
+        /* The log is written from the Target_* globals */
+        strncpy(Target_Call, ctx->dxcall, CALLSIGN_SIZE);
+        strncpy(Target_Locator, ctx->dxgrid, LOCATOR_SIZE);
+        Target_RSL = ctx->snr_tx;
+        Station_RSL = ctx->snr_rx;
         write_ADIF_Log();
-        write_worked_qso();
-        ctx.logged = true;
+        write_worked_qso(ctx);
+        ctx->logged = true;
     }
 }
 
-/* Build printable FT8 text ("<CALL> <CALL> <LOC/RPT>") */
-static void format_tx_text(tx_msg_t id, char *out)
+static autoseq_ctx_t *find_qso(const char *dxcall)
 {
-    if (!out)
+    for (int i = 0; i < MAX_QSOS; ++i)
     {
-        return;
+        if (qsos[i].state != AS_IDLE && strncmp(qsos[i].dxcall, dxcall, CALLSIGN_SIZE) == 0)
+            return &qsos[i];
     }
+    return NULL;
+}
+
+/* Callers not in the log on this band first, then the strongest */
+static int caller_rank(bool worked, int sync_score)
+{
+    return (worked ? 0 : 1 << 20) + sync_score;
+}
+
+/* A free QSO for msg's caller, or NULL. Taking the place of a caller
+ * only sent a report, a lower ranked one, or of a QSO that is over; with
+ * force that of the lowest ranked one if need be. */
+static autoseq_ctx_t *claim_qso(const Decode *msg, bool force)
+{
+    bool worked = msg && worked_on_band(msg->call_from);
+    int rank = msg ? caller_rank(worked, msg->sync_score) : 0;
 
+    autoseq_ctx_t *ctx = NULL;
+    int lowest = force ? (1 << 30) : rank;
+    for (int i = 0; i < MAX_QSOS; ++i)
+    {
+        autoseq_ctx_t *q = &qsos[i];
+        if (q->state == AS_IDLE)
+        {
+            ctx = q;
+            break;
+        }
+        if (q == active && !force)
+            continue;
+
+        int keep;
+        switch (q->state)
+        {
+        case AS_ROGERS:
+        case AS_SIGNOFF:
+            keep = -1;
+            break;
+        case AS_REPLYING:
+        case AS_REPORT:
+            keep = caller_rank(q->worked, q->sync_score);
+            break;
+        default:
+            keep = force ? (1 << 21) : (1 << 30);
+            break;
+        }
+        if (keep < lowest)
+        {
+            lowest = keep;
+            ctx = q;
+        }
+    }
+    if (!ctx)
+        return NULL;
+
+    release_qso(ctx);
+    if (msg)
+    {
+        strncpy(ctx->dxcall, msg->call_from, CALLSIGN_SIZE);
+        ctx->dxgrid[0] = '\0';
+        ctx->sync_score = msg->sync_score;
+        ctx->worked = worked;
+    }
+    return ctx;
+}
+
+/* Put a QSO back in the pool, logging it if DX had signed off */
+static void release_qso(autoseq_ctx_t *ctx)
+{
+    if (ctx->state != AS_IDLE && ctx->complete)
+        log_and_write_qso(ctx);
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->state = AS_IDLE;
+    if (chosen == ctx)
+        chosen = NULL;
+}
+
+/* How far sending id takes a QSO; 73 is a courtesy, RR73 has logged it already */
+static int tx_progress(tx_msg_t id)
+{
+    switch (id)
+    {
+    case TX1:
+        return 1;
+    case TX2:
+        return 2;
+    case TX3:
+        return 3;
+    case TX4:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/* Whether QSO a is sent to before QSO b */
+static bool goes_first(const autoseq_ctx_t *a, const autoseq_ctx_t *b)
+{
+    if (a->wait_slots != b->wait_slots)
+        return a->wait_slots < b->wait_slots;
+    if (tx_progress(a->next_tx) != tx_progress(b->next_tx))
+        return tx_progress(a->next_tx) > tx_progress(b->next_tx);
+    return caller_rank(a->worked, a->sync_score) > caller_rank(b->worked, b->sync_score);
+}
+
+/* The QSO to send to this slot, NULL if none has anything to send */
+static autoseq_ctx_t *next_to_send(void)
+{
+    autoseq_ctx_t *best = NULL;
+    for (int i = 0; i < MAX_QSOS; ++i)
+    {
+        autoseq_ctx_t *q = &qsos[i];
+        if (q->state == AS_IDLE || q->next_tx == TX_UNDEF)
+            continue;
+        if (!best || goes_first(q, best))
+            best = q;
+    }
+    return best;
+}
+
+/* Build printable FT8 text ("<CALL> <CALL> <LOC/RPT>"), with no side effects */
+static void build_tx_text(const autoseq_ctx_t *ctx, tx_msg_t id, char *out)
+{
     out[0] = '\0';
 
     const char *cq_str;
@@ -276,23 +583,19 @@ static void format_tx_text(tx_msg_t id, char *out)
     switch (id)
     {
     case TX1:
-        snprintf(out, MAX_MSG_LEN, "%s %s %s", ctx.dxcall, ctx.mycall, ctx.mygrid);
+        snprintf(out, MAX_MSG_LEN, "%s %s %s", ctx->dxcall, mycall, mygrid);
         break;
     case TX2:
-        snprintf(out, MAX_MSG_LEN, "%s %s %+d", ctx.dxcall, ctx.mycall, ctx.snr_tx);
-        Target_RSL = ctx.snr_tx;
+        snprintf(out, MAX_MSG_LEN, "%s %s %+d", ctx->dxcall, mycall, ctx->snr_tx);
         break;
     case TX3:
-        snprintf(out, MAX_MSG_LEN, "%s %s R%+d", ctx.dxcall, ctx.mycall, ctx.snr_tx);
-        Target_RSL = ctx.snr_tx;
+        snprintf(out, MAX_MSG_LEN, "%s %s R%+d", ctx->dxcall, mycall, ctx->snr_tx);
         break;
     case TX4:
-        snprintf(out, MAX_MSG_LEN, "%s %s RR73", ctx.dxcall, ctx.mycall);
-        log_and_write_qso();
+        snprintf(out, MAX_MSG_LEN, "%s %s RR73", ctx->dxcall, mycall);
         break;
     case TX5:
-        snprintf(out, MAX_MSG_LEN, "%s %s 73", ctx.dxcall, ctx.mycall);
-        log_and_write_qso();
+        snprintf(out, MAX_MSG_LEN, "%s %s 73", ctx->dxcall, mycall);
         break;
     case TX6:
         if (!free_text)
@@ -312,7 +615,7 @@ static void format_tx_text(tx_msg_t id, char *out)
                 cq_str = CQ;
                 break;
             }
-            snprintf(out, MAX_MSG_LEN, "%s %s %s", cq_str, ctx.mycall, ctx.mygrid);
+            snprintf(out, MAX_MSG_LEN, "%s %s %s", cq_str, mycall, mygrid);
         }
         else
         {
@@ -335,102 +638,126 @@ static void format_tx_text(tx_msg_t id, char *out)
     }
 }
 
-static void parse_rcvd_msg(const Decode *msg)
+/* Build the text of the message being sent, noting its report and logging the QSO */
+static void format_tx_text(autoseq_ctx_t *ctx, tx_msg_t id, char *out)
 {
-    ctx.rcvd_msg_type = TX_UNDEF;
-    if (msg->sequence == Seq_Locator)
+    if (!out)
     {
-        ctx.rcvd_msg_type = TX1;
-        strncpy(ctx.dxgrid, msg->locator, LOCATOR_SIZE);
+        return;
     }
-    else
+
+    build_tx_text(ctx, id, out);
+
+    switch (id)
     {
-        if (strcmp(msg->locator, "73") == 0)
-        {
-            ctx.rcvd_msg_type = TX5;
-        }
-        else if (strcmp(msg->locator, "RR73") == 0 || strcmp(msg->locator, "RRR") == 0)
-        {
-            ctx.rcvd_msg_type = TX4;
-        }
-        else if (msg->locator[0] == 'R')
-        {
-            ctx.rcvd_msg_type = TX3;
-        }
-        else
-        {
-            ctx.rcvd_msg_type = TX2;
-        }
+    case TX2:
+    case TX3:
+        Target_RSL = ctx->snr_tx;
+        break;
+    case TX4:
+    case TX5:
+        log_and_write_qso(ctx);
+        break;
+    default:
+        break;
+    }
+}
+
+static void parse_rcvd_msg(autoseq_ctx_t *ctx, const Decode *msg)
+{
+    /* The decoder has already told the last fields apart */
+    switch (msg->sequence)
+    {
+    case Seq_Locator:
+        ctx->rcvd_msg_type = TX1;
+        strncpy(ctx->dxgrid, msg->locator, LOCATOR_SIZE);
+        break;
+    case Seq_73:
+        ctx->rcvd_msg_type = TX5;
+        break;
+    case Seq_Rogers:
+        ctx->rcvd_msg_type = TX4;
+        break;
+    case Seq_Roger_RSL:
+        ctx->rcvd_msg_type = TX3;
+        break;
+    case Seq_RSL:
+        ctx->rcvd_msg_type = TX2;
+        break;
+    default:
+        ctx->rcvd_msg_type = TX_UNDEF;
+        break;
     }
 }
 
 // Internal helper called by autoseq_on_touch() and autoseq_on_decode()
-static bool generate_response(const Decode *msg, bool override)
+static bool generate_response(autoseq_ctx_t *ctx, const Decode *msg, bool override)
 {
-    if (!msg || ctx.rcvd_msg_type == TX_UNDEF)
+    if (!msg || ctx->rcvd_msg_type == TX_UNDEF)
     {
         return false;
     }
 
     // Update the DX call and SNR
-    strncpy(ctx.dxcall, msg->call_from, CALLSIGN_SIZE);
-    ctx.snr_tx = msg->snr;
+    strncpy(ctx->dxcall, msg->call_from, CALLSIGN_SIZE);
+    ctx->dxfreq = msg->freq_hz;
+    ctx->snr_tx = msg->snr;
+    ctx->sync_score = msg->sync_score;
+    if (ctx->rcvd_msg_type == TX4 || ctx->rcvd_msg_type == TX5)
+    {
+        ctx->complete = true;
+    }
 
     if (override)
     {
         // Reset own internal state to macth rcve_msg_type
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         case TX1:
-            set_state(AS_CALLING, TX_UNDEF, 0);
+            set_state(ctx, AS_CALLING, TX_UNDEF, 0);
             break;
         case TX2:
-            set_state(AS_REPLYING, TX_UNDEF, 0);
+            set_state(ctx, AS_REPLYING, TX_UNDEF, 0);
             break;
         case TX3:
-            set_state(AS_REPORT, TX_UNDEF, 0);
+            set_state(ctx, AS_REPORT, TX_UNDEF, 0);
             break;
         case TX4:
-            set_state(AS_ROGER_REPORT, TX_UNDEF, 0);
+            set_state(ctx, AS_ROGER_REPORT, TX_UNDEF, 0);
             break;
         case TX5:
-            set_state(AS_ROGERS, TX_UNDEF, 0);
+            set_state(ctx, AS_ROGERS, TX_UNDEF, 0);
         // case TX6 already handled by autoseq_on_touch()
         default:
             break;
         }
     }
-    // Populating Target_Call
-    strncpy(Target_Call, msg->call_from, CALLSIGN_SIZE);
-
-    // Populating Station_RSL
-    if (ctx.rcvd_msg_type == TX2 || ctx.rcvd_msg_type == TX3)
+    // The report DX sent us, for the log
+    if (ctx->rcvd_msg_type == TX2 || ctx->rcvd_msg_type == TX3)
     {
-        Station_RSL = msg->received_snr;
+        ctx->snr_rx = msg->received_snr;
     }
 
     // After CQ TX, state goes back to IDLE. Need to distinguish between Beacon and QSO mode
-    if (ctx.state == AS_IDLE)
+    if (ctx->state == AS_IDLE)
     {
-        ctx.state = Beacon_On ? AS_CALLING : AS_IDLE;
+        ctx->state = Beacon_On ? AS_CALLING : AS_IDLE;
     }
 
-    switch (ctx.state)
+    switch (ctx->state)
     {
     /* ------------------------------------------------ CALLING (we sent CQ) */
     case AS_CALLING:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         case TX1:
-            // Populate Target_Locator
-            strncpy(Target_Locator, msg->locator, LOCATOR_SIZE);
-            set_state(AS_REPORT, TX2, MAX_TX_RETRY);
+            set_state(ctx, AS_REPORT, TX2, MAX_TX_RETRY);
             return true;
         case TX2:
-            set_state(AS_ROGER_REPORT, TX3, MAX_TX_RETRY);
+            set_state(ctx, AS_ROGER_REPORT, TX3, MAX_TX_RETRY);
             return true;
         case TX3:
-            set_state(AS_ROGERS, TX4, MAX_TX_RETRY);
+            set_state(ctx, AS_ROGERS, TX4, MAX_TX_RETRY);
             return true;
         default:
             return false;
@@ -438,20 +765,20 @@ static bool generate_response(const Decode *msg, bool override)
 
     /* ------------------------------------------------ REPLYING (we sent Tx1) */
     case AS_REPLYING:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         // Since we sent TX1, it doesn't make sense to respond to TX1
         case TX2:
-            set_state(AS_ROGER_REPORT, TX3, MAX_TX_RETRY);
+            set_state(ctx, AS_ROGER_REPORT, TX3, MAX_TX_RETRY);
             return true;
         case TX3:
-            set_state(AS_ROGERS, TX4, MAX_TX_RETRY);
+            set_state(ctx, AS_ROGERS, TX4, MAX_TX_RETRY);
             return true;
 
         // QSO complete without signal report exchange
         case TX4:
         case TX5:
-            set_state(AS_SIGNOFF, TX5, 0);
+            set_state(ctx, AS_SIGNOFF, TX5, 0);
             return true;
         default:
             return false;
@@ -459,15 +786,15 @@ static bool generate_response(const Decode *msg, bool override)
 
     /* ------------------------------------------------ REPORT sent, waiting Roger */
     case AS_REPORT:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         case TX3:
-            set_state(AS_ROGERS, TX4, MAX_TX_RETRY);
+            set_state(ctx, AS_ROGERS, TX4, MAX_TX_RETRY);
             return true;
         // QSO complete without signal report exchange
         case TX4:
         case TX5:
-            set_state(AS_SIGNOFF, TX5, 0);
+            set_state(ctx, AS_SIGNOFF, TX5, 0);
             return true;
         default:
             return false;
@@ -475,24 +802,28 @@ static bool generate_response(const Decode *msg, bool override)
 
     /* ------------------------------------------------ Roger‑Report sent */
     case AS_ROGER_REPORT:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         // QSO complete
         case TX4:
         case TX5: // Be polite, echo back 73
-            set_state(AS_SIGNOFF, TX5, 0);
+            set_state(ctx, AS_SIGNOFF, TX5, 0);
             return true;
         default:
             return false;
         }
 
     case AS_ROGERS:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
+        // DX hasn't received our RR73, send it again in its turn
+        case TX3:
+            ctx->next_tx = TX4;
+            return true;
         // QSO complete
         case TX4:
         case TX5:
-            set_state(AS_IDLE, TX_UNDEF, 0);
+            set_state(ctx, AS_IDLE, TX_UNDEF, 0);
             break;
         default:
             break;
@@ -501,13 +832,13 @@ static bool generate_response(const Decode *msg, bool override)
 
     // Since 73 is sent only once, this should never be reached
     case AS_SIGNOFF:
-        switch (ctx.rcvd_msg_type)
+        switch (ctx->rcvd_msg_type)
         {
         // DX hasn't received our TX5. Retry
         case TX4:
             break;
         default:
-            set_state(AS_IDLE, TX_UNDEF, 0);
+            set_state(ctx, AS_IDLE, TX_UNDEF, 0);
             break;
         }
         return false;
@@ -518,14 +849,14 @@ static bool generate_response(const Decode *msg, bool override)
     return false;
 }
 
-static void write_worked_qso()
+static void write_worked_qso(const autoseq_ctx_t *ctx)
 {
     static const char band_strs[NumBands][4] = {
         "40", "30", "20", "17", "15", "12", "10"};
     char *buf = add_worked_qso();
     int printed = snprintf(buf, MAX_LINE_LEN, "%.3s %.12s",
                            band_strs[BandIndex],
-                           ctx.dxcall);
+                           ctx->dxcall);
     if (printed < 0)
     {
         return;
@@ -550,3 +881,13 @@ static void write_worked_qso()
         strncpy(buf + printed, rsl, needed + 1);
     }
 }
+
+/* The calls of msg as the engine compares and logs them, without the
+ * brackets of a hash the call hash table resolved */
+static const Decode *bare_calls(const Decode *msg, Decode *bare)
+{
+    *bare = *msg;
+    copy_bare_call(bare->call_to, msg->call_to);
+    copy_bare_call(bare->call_from, msg->call_from);
+    return bare;
+}
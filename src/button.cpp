@@ -19,6 +19,9 @@
 #include "Maps.h"
 #include "PskInterface.h"
 #include "autoseq_engine.h"
+#include "DisplayQueue.h"
+#include "Profile.h"
+#include "MemoryMap.h"
 
 #define Board_PIN 2
 #define Relay_PIN 3
@@ -413,25 +416,13 @@ ButtonStruct sButtonData[] = {
 
 void drawButton(uint16_t i)
 {
-  tft.setFontSize(2, true);
   if (sButtonData[i].Active > 0)
   {
-
-    if (sButtonData[i].state)
-      tft.textColor(WHITE, RED);
-    else
-      tft.textColor(WHITE, BLUE);
-
+    // Drawn at once, so that a press shows as a flash, and skipped if nothing has changed
     if (sButtonData[i].state)
-    {
-      tft.setCursor(sButtonData[i].x + 7, sButtonData[i].y + 20);
-      tft.write(sButtonData[i].text1, 4);
-    }
+      display_text_now(sButtonData[i].x + 7, sButtonData[i].y + 20, 2, WHITE, RED, sButtonData[i].text1, 4);
     else
-    {
-      tft.setCursor(sButtonData[i].x + 7, sButtonData[i].y + 20);
-      tft.write(sButtonData[i].text0, 4);
-    }
+      display_text_now(sButtonData[i].x + 7, sButtonData[i].y + 20, 2, WHITE, BLUE, sButtonData[i].text0, 4);
   }
 }
 
@@ -450,12 +441,46 @@ void display_all_buttons(void)
   drawButton(10);
 }
 
+// Buttons under each cell of a coarse grid over the screen, a bit per button
+#define button_cell_size 64
+#define button_grid_columns (SCREEN_WIDTH / button_cell_size)
+#define button_grid_rows ((SCREEN_HEIGHT + button_cell_size - 1) / button_cell_size)
+
+static_assert(numButtons <= 32, "a grid cell holds a bit per button");
+static uint32_t button_grid[button_grid_rows][button_grid_columns];
+static bool button_grid_built = false;
+
+static int grid_cell(int position, int cells)
+{
+  int cell = position / button_cell_size;
+  return cell < cells ? cell : cells - 1;
+}
+
+// The buttons never move, so the grid is built on the first touch
+static COLD_CODE void build_button_grid(void)
+{
+  for (uint8_t i = 0; i < numButtons; i++)
+  {
+    const ButtonStruct *button = &sButtonData[i];
+    if (button->w == 0 || button->h == 0)
+      continue;
+
+    for (int row = grid_cell(button->y, button_grid_rows); row <= grid_cell(button->y + button->h, button_grid_rows); row++)
+      for (int column = grid_cell(button->x, button_grid_columns); column <= grid_cell(button->x + button->w, button_grid_columns); column++)
+        button_grid[row][column] |= 1ul << i;
+  }
+  button_grid_built = true;
+}
+
 void checkButton(void)
 {
-  uint16_t i;
-  for (i = 0; i < numButtons; i++)
+  if (!button_grid_built)
+    build_button_grid();
+
+  uint32_t candidates = button_grid[grid_cell(draw_y, button_grid_rows)][grid_cell(draw_x, button_grid_columns)];
+  for (uint8_t i = 0; candidates != 0; i++, candidates >>= 1)
   {
-    if (testButton(i))
+    if ((candidates & 1) && testButton(i))
     {
       switch (sButtonData[i].Active)
       {
@@ -582,7 +607,7 @@ void executeButton(uint16_t index)
     {
       cursor_line--;
       cursor_freq = (uint16_t)((float)(cursor_line + ft8_min_bin) * ft8_shift);
-      display_cursor_line = 2 * cursor_line;
+      display_cursor_line = waterfall_x(cursor_line);
       display_value(870, 559, cursor_freq);
     }
     break;
@@ -592,7 +617,7 @@ void executeButton(uint16_t index)
     {
       cursor_line++;
       cursor_freq = (uint16_t)((float)(cursor_line + ft8_min_bin) * ft8_shift);
-      display_cursor_line = 2 * cursor_line;
+      display_cursor_line = waterfall_x(cursor_line);
       display_value(870, 559, cursor_freq);
     }
     break;
@@ -617,7 +642,7 @@ void executeButton(uint16_t index)
   }
 }
 
-void executeCalibrationButton(uint16_t index)
+COLD_CODE void executeCalibrationButton(uint16_t index)
 {
   switch (index)
   {
@@ -638,6 +663,7 @@ void executeCalibrationButton(uint16_t index)
     break;
 
   case 13: // Save Band Changes
+    flush_ADIF_Log(); // the QSOs logged so far were on the old band
     Options_SetValue(0, BandIndex);
     Options_StoreValue(0);
     start_freq = sBand_Data[BandIndex].Frequency;
@@ -774,7 +800,7 @@ void set_xmit_button(bool state)
   delay(button_delay);
 }
 
-void init_RxSw_TxSw(void)
+COLD_CODE void init_RxSw_TxSw(void)
 {
   pinMode(TxSw_PIN, OUTPUT);
   digitalWrite(TxSw_PIN, HIGH);
@@ -783,7 +809,7 @@ void init_RxSw_TxSw(void)
   digitalWrite(RxSw_PIN, LOW);
 }
 
-void Init_BoardVersionInput(void)
+COLD_CODE void Init_BoardVersionInput(void)
 {
   pinMode(Board_PIN, INPUT_PULLUP);
   delay(10);
@@ -806,7 +832,7 @@ void Init_BandSwitchOutput(void)
   digitalWrite(Relay_PIN, LOW);
 }
 
-void Check_Board_Version(void)
+COLD_CODE void Check_Board_Version(void)
 {
   Band_Minimum = _20M;
 
@@ -847,7 +873,7 @@ void set_RF_Gain(int rfgain)
 {
   float gain_setpoint;
   gain_setpoint = ((float)rfgain / 32.0);
-  amp1.gain(gain_setpoint);
+  audioIngest.gain(gain_setpoint);
 }
 
 void set_Attenuator_Gain(float att_gain)
@@ -898,67 +924,91 @@ void check_WF_Touch(void)
   if (draw_x < 600 && draw_y < 90)
   {
     display_cursor_line = draw_x;
-    cursor_line = display_cursor_line / 2;
+    cursor_line = waterfall_bin_offset(display_cursor_line);
     cursor_freq = (uint16_t)((float)(cursor_line + ft8_min_bin) * ft8_shift);
     display_value(870, 559, cursor_freq);
   }
 }
 
-void set_startup_freq(void)
+// Touching the clock on the calibration screen shows how long the hot paths took last slot
+static void check_Profile_Touch(void)
 {
-  display_cursor_line = 224;
-  cursor_line = display_cursor_line / 2;
+  if (Tune_On && draw_x > 620 && draw_y < 90)
+    show_Profile_Page(!profile_page_shown());
+}
+
+COLD_CODE void set_startup_freq(void)
+{
+  cursor_line = 112;
+  display_cursor_line = waterfall_x(cursor_line);
   cursor_freq = (uint16_t)((float)(cursor_line + ft8_min_bin) * ft8_shift);
   display_value(870, 559, cursor_freq);
 }
 
 #define MAXTOUCHLIMIT 10
 
-void process_touch(void)
+// The touch controller pulls its interrupt line low for every report, many times a second
+// while a finger stays down. The interrupt only notes when it came, and one that follows a
+// quiet spell starts a new touch. process_touch() then reads the coordinates over I2C once
+// for that touch, which cannot be done in the interrupt.
+static const uint32_t touch_release_ms = 80;
+static volatile uint32_t last_touch_interrupt_ms;
+static volatile uint8_t touch_starts; // touches begun, counted by the interrupt
+static uint8_t touch_starts_read;     // touches whose coordinates have been read
+
+static void touch_interrupt(void)
 {
-  static int touch_count = 0;
+  uint32_t now_ms = millis();
+  if (now_ms - last_touch_interrupt_ms > touch_release_ms)
+    ++touch_starts;
+  last_touch_interrupt_ms = now_ms;
+}
 
-  if (touch_count < MAXTOUCHLIMIT)
-  {
-    if (tft.touched())
-    { // if touched(true) detach isr
-      // at this point we need to fill the FT5206 registers...
-      tft.updateTS(); // now we have the data inside library
-
-      uint16_t coordinates[MAXTOUCHLIMIT][2]; // to hold coordinates
-      tft.getTScoordinates(coordinates);      // done
-      // now coordinates has the x,y of all touches
-      for (uint8_t i = 0; i < tft.getTouches(); i++)
-      {
-        if (i == 0)
-        {
-          draw_x = SCREEN_WIDTH - coordinates[i][0];
-          draw_y = SCREEN_HEIGHT - coordinates[i][1];
-        }
-      }
-      tft.enableCapISR(); // rearm ISR if needed (touched(true))
+void begin_touch(uint8_t pin)
+{
+  last_touch_interrupt_ms = millis() - touch_release_ms - 1;
+  attachInterrupt(digitalPinToInterrupt(pin), touch_interrupt, FALLING);
+}
 
-      touch_count++;
-    }
-  }
+// Screen position of the touch being reported, false if the finger has gone already
+static bool read_touch(void)
+{
+  tft.updateTS();
+  if (tft.getTouches() == 0)
+    return false;
+
+  uint16_t coordinates[MAXTOUCHLIMIT][2];
+  tft.getTScoordinates(coordinates);
+  draw_x = SCREEN_WIDTH - coordinates[0][0];
+  draw_y = SCREEN_HEIGHT - coordinates[0][1];
+  return true;
+}
 
-  if (touch_count >= MAXTOUCHLIMIT)
-  {
-    checkButton();
-    FT8_Touch_Flag = FT8_Touch();
-    FT8_Message_Touch = Xmit_message_Touch();
-    check_WF_Touch();
-    touch_count = 0;
-    if (!Tune_On && (draw_x > START_X_RIGHT && draw_y > 120 && draw_y < 400))
-      tx_pressed = true;
-  }
+void process_touch(void)
+{
+  uint8_t starts = touch_starts;
+  if (starts == touch_starts_read)
+    return;
+
+  // Touches that came while the loop was busy are gone, only the latest can be read
+  touch_starts_read = starts;
+  if (!read_touch())
+    return;
+
+  checkButton();
+  FT8_Touch_Flag = FT8_Touch();
+  FT8_Message_Touch = Xmit_message_Touch();
+  check_WF_Touch();
+  check_Profile_Touch();
+  if (!Tune_On && (draw_x > START_X_RIGHT && draw_y > 120 && draw_y < 400))
+    tx_pressed = true;
 }
 
-void setup_Cal_Display(void)
+COLD_CODE void setup_Cal_Display(void)
 {
   requestTimeSync();
   clear_reply_message_box();
-  tft.fillRect(0, 100, 600, 439, BLACK);
+  display_fill(0, 100, 600, 439, BLACK);
   erase_CQ();
 
   sButtonData[11].Active = 3;
@@ -990,14 +1040,8 @@ void setup_Cal_Display(void)
 
 void display_Free_Text(void)
 {
-  tft.setFontSize(2, true);
-  tft.textColor(WHITE, BLACK);
-
-  tft.setCursor(100, line4 + 20);
-  tft.write(Free_Text1, 14);
-
-  tft.setCursor(100, line5 + 20);
-  tft.write(Free_Text2, 14);
+  display_text(100, line4 + 20, 2, WHITE, BLACK, Free_Text1, 14);
+  display_text(100, line5 + 20, 2, WHITE, BLACK, Free_Text2, 14);
 }
 
 void reset_buttons(int btn1, int btn2, int btn3, const char *button_text)
@@ -1018,10 +1062,11 @@ void update_CQFree_button()
   drawButton(CQFree);
 }
 
-void erase_Cal_Display(void)
+COLD_CODE void erase_Cal_Display(void)
 {
+  show_Profile_Page(false);
   clear_reply_message_box();
-  tft.fillRect(0, 100, 600, 439, BLACK); // move tune to left hand pane
+  display_fill(0, 100, 600, 439, BLACK); // move tune to left hand pane
   erase_CQ();
   for (int i = 11; i < 23; i++)
     sButtonData[i].Active = 0;
@@ -1055,7 +1100,7 @@ void Set_Cursor_Frequency(void)
 
 const uint64_t F_boot = 11229600000ULL;
 
-void start_Si5351(void)
+COLD_CODE void start_Si5351(void)
 {
   si5351.init(SI5351_CRYSTAL_LOAD_0PF, 26000000, 0);
   si5351.drive_strength(SI5351_CLK0, SI5351_DRIVE_8MA);
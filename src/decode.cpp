@@ -9,6 +9,9 @@
 #include <Audio.h>
 
 #include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
 
 #include "display.h"
 #include "decode.h"
@@ -19,107 +22,489 @@ static float max2(float a, float b);
 static float max4(float a, float b, float c, float d);
 static void heapify_down(Candidate *heap, int heap_size);
 static void heapify_up(Candidate *heap, int heap_size);
-static void decode_symbol(const uint8_t *power, const uint8_t *code_map,
-                          int bit_idx, float *log174);
+template <typename Protocol>
+static void decode_symbol(const float *tones, int bit_idx, float *log174);
 
-// Localize top N candidates in frequency and time according to their sync strength (looking at Costas symbols)
-// We treat and organize the candidate list as a min-heap (empty initially).
-int find_sync(const uint8_t *power, int num_blocks, int num_bins,
-              const uint8_t *sync_map, int num_candidates, Candidate *heap,
-              int min_score)
+// Running Costas sync scores of one (time_offset, alt) for every freq_offset
+static int32_t sync_acc[ft8_max_buffer];
+
+static int16_t *scores_of(Sync_Search *search, int time_offset, int alt)
 {
-  int heap_size = 0;
-  // int x = 500;
-  // Here we allow time offsets that exceed signal boundaries, as long as we still have all data bits.
-  // I.e. we can afford to skip the first 7 or the last 7 Costas symbols, as long as we track how many
-  // sync symbols we included in the score, so the score is averaged.
+  return search->scores[(time_offset - search->first_time_offset) % 3][alt];
+}
+
+// Scalar reference kernel: add the score of one Costas symbol row,
+// Tones * p[tone] - (p[0] + ... + p[Tones - 1]), for every freq_offset in [first_bin, last_bin)
+template <int Tones>
+static void sync_accumulate_row_ref(const uint8_t *row, int first_bin, int last_bin,
+                                    uint8_t tone, int32_t *acc)
+{
+  for (int freq_offset = first_bin; freq_offset < last_bin; ++freq_offset)
+  {
+    const uint8_t *p = row + freq_offset;
+
+    int32_t window = 0;
+    for (int j = 0; j < Tones; ++j)
+      window += p[j];
+    acc[freq_offset] += Tones * p[tone] - window;
+  }
+}
+
+#if defined(__ARM_FEATURE_SIMD32) && !defined(FT8_SCALAR_SYNC)
+// Sum of the 4 bins starting at p, using the M7 packed byte sum of absolute differences
+static inline uint32_t sum4(const uint8_t *p)
+{
+  uint32_t word;
+  memcpy(&word, p, sizeof(word)); // unaligned LDR
+  return __USAD8(word, 0);
+}
+
+// Same as sync_accumulate_row_ref(), but the 8 bin window of each freq_offset is
+// built from two 4 bin sums, and each 4 bin sum is shared by the two windows that overlap it
+template <int Tones>
+static void sync_accumulate_row(const uint8_t *row, int first_bin, int last_bin,
+                                uint8_t tone, int32_t *acc)
+{
+  static_assert(Tones == 8, "the windows are built from two 4 bin sums");
+
+  if (last_bin <= first_bin)
+    return;
+
+  // sums[i % 4] holds the 4 bin sum starting at bin i
+  uint32_t sums[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    sums[i] = sum4(row + first_bin + i);
+  }
+
+  for (int freq_offset = first_bin; freq_offset < last_bin; ++freq_offset)
+  {
+    int slot = (freq_offset - first_bin) & 3;
+    uint32_t upper = sum4(row + freq_offset + 4);
+    int32_t window = (int32_t)(sums[slot] + upper);
+    sums[slot] = upper;
+
+    acc[freq_offset] += 8 * row[freq_offset + tone] - window;
+  }
+}
+#else
+#define sync_accumulate_row sync_accumulate_row_ref
+#endif
+
+template <typename Protocol>
+static int sync_last_bin(const Sync_Search *search)
+{
+  return (search->num_bins < ft8_max_buffer ? search->num_bins : ft8_max_buffer) - Protocol::num_tones;
+}
+
+// Score every alt and freq_offset of one time offset into the sync_scores ring
+template <typename Protocol>
+static void sync_score_time_offset(Sync_Search *search, const uint8_t *power, int time_offset)
+{
+  const int num_bins = search->num_bins;
+  const int last_bin = sync_last_bin<Protocol>(search);
+
   for (int alt = 0; alt < 4; ++alt)
   {
-    // int alt = 0;
-    for (int time_offset = -7; time_offset < num_blocks - NN + 7;
-         ++time_offset)
-    { // NN=79
-      for (int freq_offset = ft8_min_bin; freq_offset < num_bins - 8;
-           ++freq_offset)
+    for (int freq_offset = ft8_min_bin; freq_offset < last_bin; ++freq_offset)
+    {
+      sync_acc[freq_offset] = 0;
+    }
+
+    // Compute average score over sync symbols (m+k = 0-7, 36-43, 72-79 for FT8)
+    int num_symbols = 0;
+    for (int block = 0; block < Protocol::num_sync_blocks; ++block)
+    {
+      const int m = Protocol::sync_offsets[block];
+      for (int k = 0; k < Protocol::sync_length; ++k)
       {
-        int score = 0;
+        // Check for time boundaries
+        if (time_offset + k + m < 0)
+          continue;
+        if (time_offset + k + m >= search->num_blocks)
+          break;
 
-        // Compute average score over sync symbols (m+k = 0-7, 36-43, 72-79)
-        int num_symbols = 0;
-        for (int m = 0; m <= 72; m += 36)
+        const uint8_t *row = power + ((time_offset + k + m) * 4 + alt) * num_bins;
+        sync_accumulate_row<Protocol::num_tones>(row, ft8_min_bin, last_bin, Protocol::sync_map[block][k], sync_acc);
+
+        ++num_symbols;
+      }
+    }
+
+    for (int freq_offset = ft8_min_bin; freq_offset < last_bin; ++freq_offset)
+    {
+      scores_of(search, time_offset, alt)[freq_offset] = (int16_t)(sync_acc[freq_offset] / num_symbols);
+    }
+  }
+}
+
+// Push the cells of a scored time offset into the min-heap, keeping only those over
+// min_score that are the local maximum within +-1 bin, +-1 time offset and all four alt
+// sub-grids, so that one strong signal takes one heap slot instead of several.
+// has_next tells whether time_offset + 1 has been scored, the first offset has no previous one.
+template <typename Protocol>
+static void sync_push_maxima(Sync_Search *search, int time_offset, bool has_next)
+{
+  Candidate *heap = search->heap;
+  const int last_bin = sync_last_bin<Protocol>(search);
+  const int first_dt = (time_offset > search->first_time_offset) ? -1 : 0;
+  const int last_dt = has_next ? 1 : 0;
+
+  for (int alt = 0; alt < 4; ++alt)
+  {
+    const int16_t *scores = scores_of(search, time_offset, alt);
+    for (int freq_offset = ft8_min_bin; freq_offset < last_bin; ++freq_offset)
+    {
+      int score = scores[freq_offset];
+
+      if (score < search->min_score)
+        continue;
+
+      bool is_max = true;
+      for (int dt = first_dt; dt <= last_dt && is_max; ++dt)
+      {
+        for (int near_alt = 0; near_alt < 4 && is_max; ++near_alt)
         {
-          for (int k = 0; k < 7; ++k)
+          const int16_t *near = scores_of(search, time_offset + dt, near_alt);
+          for (int df = -1; df <= 1; ++df)
           {
-            // Check for time boundaries
-            if (time_offset + k + m < 0)
+            int near_bin = freq_offset + df;
+            if (near_bin < ft8_min_bin || near_bin >= last_bin)
               continue;
-            if (time_offset + k + m >= num_blocks)
+            if (near[near_bin] > score)
+            {
+              is_max = false;
               break;
+            }
+          }
+        }
+      }
+      if (!is_max)
+        continue;
 
-            int offset = ((time_offset + k + m) * 4 + alt) * num_bins + freq_offset;
+      // If the heap is full AND the current candidate is better than
+      // the worst in the heap, we remove the worst and make space
+      if (search->heap_size == search->num_candidates && score > heap[0].score)
+      {
+        heap[0] = heap[search->heap_size - 1];
+        --search->heap_size;
 
-            const uint8_t *p8 = power + offset;
+        heapify_down(heap, search->heap_size);
+      }
 
-            score += 8 * p8[sync_map[k]] - p8[0] - p8[1] - p8[2] - p8[3] - p8[4] - p8[5] - p8[6] - p8[7];
+      // If there's free space in the heap, we add the current candidate
+      if (search->heap_size < search->num_candidates)
+      {
+        int heap_size = search->heap_size;
+        heap[heap_size].score = score;
+        heap[heap_size].time_offset = time_offset;
+        heap[heap_size].freq_offset = freq_offset;
+        heap[heap_size].time_sub = alt / 2;
+        heap[heap_size].freq_sub = alt % 2;
+        search->heap_size = ++heap_size;
+
+        heapify_up(heap, heap_size);
+      }
+    }
+  }
+}
 
-            ++num_symbols;
-          }
-        }
-        score /= num_symbols;
+template <typename Protocol>
+void sync_search_begin(Sync_Search *search, int num_blocks, int num_bins,
+                       int num_candidates, Candidate *heap, int min_score)
+{
+  search->num_blocks = num_blocks;
+  search->num_bins = num_bins;
+  search->num_candidates = num_candidates;
+  search->heap = heap;
+  search->heap_size = 0;
+  search->min_score = min_score;
+  // Here we allow time offsets that exceed signal boundaries, as long as we still have all data bits.
+  // I.e. we can afford to skip the first 7 or the last 7 Costas symbols, as long as we track how many
+  // sync symbols we included in the score, so the score is averaged.
+  search->first_time_offset = -Protocol::sync_length;
+  search->next_time_offset = search->first_time_offset;
+}
 
-        if (score < min_score)
-          continue;
+// Score the next time offset, which completes the neighbourhood of the one before it
+template <typename Protocol>
+static void sync_search_step(Sync_Search *search, const uint8_t *power)
+{
+  int time_offset = search->next_time_offset++;
+  sync_score_time_offset<Protocol>(search, power, time_offset);
+  if (time_offset > search->first_time_offset)
+    sync_push_maxima<Protocol>(search, time_offset - 1, true);
+}
 
-        // If the heap is full AND the current candidate is better than
-        // the worst in the heap, we remove the worst and make space
-        if (heap_size == num_candidates && score > heap[0].score)
-        {
-          heap[0] = heap[heap_size - 1];
-          --heap_size;
+template <typename Protocol>
+void sync_search_update(Sync_Search *search, const uint8_t *power, int num_rows)
+{
+  // A time offset is final once the row holding its last Costas symbol (nn - 1) has arrived
+  while (search->next_time_offset < search->num_blocks - Protocol::nn + Protocol::sync_length &&
+         search->next_time_offset + Protocol::nn <= num_rows)
+  {
+    sync_search_step<Protocol>(search, power);
+  }
+}
+
+template <typename Protocol>
+int sync_search_finish(Sync_Search *search, const uint8_t *power)
+{
+  // The remaining time offsets run past the end of the slot and only have some of their sync symbols
+  while (search->next_time_offset < search->num_blocks - Protocol::nn + Protocol::sync_length)
+  {
+    sync_search_step<Protocol>(search, power);
+  }
+
+  // The last time offset has no later neighbour to wait for
+  if (search->next_time_offset > search->first_time_offset)
+    sync_push_maxima<Protocol>(search, search->next_time_offset - 1, false);
+
+  return search->heap_size;
+}
+
+// Localize top N candidates in frequency and time according to their sync strength (looking at Costas symbols)
+// We treat and organize the candidate list as a min-heap (empty initially).
+template <typename Protocol>
+int find_sync(const uint8_t *power, int num_blocks, int num_bins,
+              int num_candidates, Candidate *heap, int min_score)
+{
+  // Kept apart from the incremental search, which may be part way through the next slot
+  static Sync_Search search;
+  sync_search_begin<Protocol>(&search, num_blocks, num_bins, num_candidates, heap, min_score);
+  return sync_search_finish<Protocol>(&search, power);
+}
+
+void sort_candidates(Candidate *list, int num_candidates)
+{
+  // Insertion sort, the list is at most a few dozen entries and mostly heap ordered
+  for (int i = 1; i < num_candidates; ++i)
+  {
+    Candidate cand = list[i];
+    int j = i - 1;
+    while (j >= 0 && list[j].score < cand.score)
+    {
+      list[j + 1] = list[j];
+      --j;
+    }
+    list[j + 1] = cand;
+  }
+}
+
+// Knock the tones of a decoded signal out of the spectrogram, so that the sync
+// search and LDPC see what was underneath it. Each masked bin is set to the
+// lowest bin of the signal's tone window in the same row, as a noise floor.
+template <typename Protocol>
+void subtract_signal(uint8_t *power, int num_blocks, int num_bins, Candidate cand,
+                     const uint8_t *tones)
+{
+  const int nn = Protocol::nn;
+  int first_block = cand.time_offset < 0 ? 0 : cand.time_offset;
+  int last_block = cand.time_offset + nn + 1 < num_blocks ? cand.time_offset + nn + 1 : num_blocks;
+
+  for (int block = first_block; block < last_block; ++block)
+  {
+    for (int time_sub = 0; time_sub < 2; ++time_sub)
+    {
+      // A row half a symbol off the signal's own time_sub straddles two of its symbols
+      int first_sym = block - cand.time_offset - (cand.time_sub > time_sub ? 1 : 0);
+      int last_sym = first_sym + (cand.time_sub != time_sub ? 1 : 0);
+
+      for (int freq_sub = 0; freq_sub < 2; ++freq_sub)
+      {
+        uint8_t *row = power + (block * 4 + time_sub * 2 + freq_sub) * num_bins;
+
+        // Likewise a row half a bin off the signal's own freq_sub splits each tone over two bins
+        int shift = cand.freq_sub - freq_sub;
+        int first_bin = cand.freq_offset + (shift < 0 ? shift : 0);
+        int last_bin = cand.freq_offset + (shift > 0 ? shift : 0);
 
-          heapify_down(heap, heap_size);
+        uint8_t floor = 255;
+        for (int j = 0; j < Protocol::num_tones; ++j)
+        {
+          if (row[cand.freq_offset + j] < floor)
+            floor = row[cand.freq_offset + j];
         }
 
-        // If there's free space in the heap, we add the current candidate
-        if (heap_size < num_candidates)
+        for (int sym = first_sym; sym <= last_sym; ++sym)
         {
-          heap[heap_size].score = score;
-          heap[heap_size].time_offset = time_offset;
-          heap[heap_size].freq_offset = freq_offset;
-          heap[heap_size].time_sub = alt / 2;
-          heap[heap_size].freq_sub = alt % 2;
-          ++heap_size;
-
-          heapify_up(heap, heap_size);
+          if (sym < 0 || sym >= nn)
+            continue;
+
+          for (int bin = first_bin + tones[sym]; bin <= last_bin + tones[sym]; ++bin)
+          {
+            if (bin >= 0 && bin < num_bins)
+              row[bin] = floor;
+          }
         }
       }
     }
+  }
+}
+
+// Linear power of each spectrogram byte, to a common factor: a byte is 10 * ln(power) less
+// the slot's offset, which cancels in a ratio of powers
+static float byte_power[256];
+// Mean noise power of a cell against that at the noise floor, which power_scale() puts at
+// kNoise_floor_byte below most of the noise
+static const float kFloor_noise_power = 5.75f;
+static bool byte_power_made = false;
+
+static void make_byte_power(void)
+{
+  for (int i = 0; i < 256; ++i)
+    byte_power[i] = expf((i - kNoise_floor_byte) / 10.0f);
+  byte_power_made = true;
+}
+
+// A point of the sync search's grid, in half symbols and half bins
+struct Grid_Point
+{
+  int half_symbol; // time_offset * 2 + time_sub
+  int half_bin;    // freq_offset * 2 + freq_sub
+};
+
+// Offset in power of the first tone bin of a grid point's symbol 0
+static int grid_offset(Grid_Point point, int num_bins)
+{
+  int time_sub = point.half_symbol & 1;
+  int freq_sub = point.half_bin & 1;
+  int time_offset = (point.half_symbol - time_sub) / 2;
+  int freq_offset = (point.half_bin - freq_sub) / 2;
+  return (time_offset * 4 + time_sub * 2 + freq_sub) * num_bins + freq_offset;
+}
+
+// Whether all the data symbol tone bins of a grid point are within the spectrogram
+template <typename Protocol>
+static bool grid_data_inside(Grid_Point point, int num_blocks, int num_bins)
+{
+  int time_offset = (point.half_symbol - (point.half_symbol & 1)) / 2;
+  int freq_offset = (point.half_bin - (point.half_bin & 1)) / 2;
+  return time_offset + data_symbol<Protocol>(0) >= 0 &&
+         time_offset + data_symbol<Protocol>(Protocol::nd - 1) < num_blocks &&
+         freq_offset >= 0 && freq_offset + Protocol::num_tones <= num_bins;
+}
+
+// The Costas score of a grid point, as the sync search has it
+template <typename Protocol>
+static int grid_sync_score(const uint8_t *power, int num_blocks, int num_bins, Grid_Point point)
+{
+  int time_offset = (point.half_symbol - (point.half_symbol & 1)) / 2;
+  int offset = grid_offset(point, num_bins);
+  int score = 0;
+  int num_symbols = 0;
+  for (int block = 0; block < Protocol::num_sync_blocks; ++block)
+  {
+    for (int k = 0; k < Protocol::sync_length; ++k)
+    {
+      int sym = Protocol::sync_offsets[block] + k;
+      if (time_offset + sym < 0 || time_offset + sym >= num_blocks)
+        continue;
+
+      const uint8_t *p = power + offset + sym * 4 * num_bins;
+      int window = 0;
+      for (int j = 0; j < Protocol::num_tones; ++j)
+        window += p[j];
+      score += Protocol::num_tones * p[Protocol::sync_map[block][k]] - window;
+      ++num_symbols;
+    }
+  }
+  return num_symbols > 0 ? score / num_symbols : 0;
+}
 
-  } // end of alt
+// A signal rarely sits on a point of the half symbol, half bin grid, and the cells of the
+// point the search picked only catch part of its tones. Of the points half a symbol
+// either side, and half a bin either side, the one with the better Costas score is the way
+// the signal lies, and its cells are averaged in when it scores at least half as well.
+// *time_step and *freq_step are set to how far in power the cells of the chosen point in time
+// and in frequency are from those of the candidate, or to 0 where none is averaged in.
+template <typename Protocol>
+static void refine_candidate(const uint8_t *power, int num_blocks, int num_bins, Candidate cand,
+                             int *time_step, int *freq_step)
+{
+  Grid_Point point = {cand.time_offset * 2 + cand.time_sub, cand.freq_offset * 2 + cand.freq_sub};
+  int offset = grid_offset(point, num_bins);
+  int score = grid_sync_score<Protocol>(power, num_blocks, num_bins, point);
+
+  *time_step = 0;
+  *freq_step = 0;
+  if (score <= 0)
+    return;
+
+  int best_time = score / 2 - 1;
+  int best_freq = score / 2 - 1;
+  for (int step = -1; step <= 1; step += 2)
+  {
+    Grid_Point in_time = {point.half_symbol + step, point.half_bin};
+    if (grid_data_inside<Protocol>(in_time, num_blocks, num_bins))
+    {
+      int near = grid_sync_score<Protocol>(power, num_blocks, num_bins, in_time);
+      if (near > best_time)
+      {
+        best_time = near;
+        *time_step = grid_offset(in_time, num_bins) - offset;
+      }
+    }
 
-  return heap_size;
+    Grid_Point in_freq = {point.half_symbol, point.half_bin + step};
+    if (grid_data_inside<Protocol>(in_freq, num_blocks, num_bins))
+    {
+      int near = grid_sync_score<Protocol>(power, num_blocks, num_bins, in_freq);
+      if (near > best_freq)
+      {
+        best_freq = near;
+        *freq_step = grid_offset(in_freq, num_bins) - offset;
+      }
+    }
+  }
 }
 
 // Compute log likelihood log(p(1) / p(0)) of 174 message bits
 // for later use in soft-decision LDPC decoding
-void extract_likelihood(const uint8_t *power, int num_bins, Candidate cand,
-                        const uint8_t *code_map, float *log174)
+template <typename Protocol>
+float extract_likelihood(const uint8_t *power, int num_blocks, int num_bins, Candidate cand, float *log174)
 {
+  if (!byte_power_made)
+    make_byte_power();
+
+  // The strongest tone of each data symbol is taken as the signal
+  float signal = 0;
 
   int offset = (cand.time_offset * 4 + cand.time_sub * 2 + cand.freq_sub) * num_bins + cand.freq_offset;
 
-  // show_variable(600,200,offset);
-  //  Go over FSK tones and skip Costas sync symbols
-  const int n_syms = 1;
-  for (int k = 0; k < ND; k += n_syms)
+  int time_step, freq_step;
+  refine_candidate<Protocol>(power, num_blocks, num_bins, cand, &time_step, &freq_step);
+  const float weight = 1.0f / (1 + (time_step != 0) + (freq_step != 0));
+
+  // Go over FSK tones and skip Costas sync symbols
+  for (int k = 0; k < Protocol::nd; ++k)
   {
-    int sym_idx = (k < ND / 2) ? (k + 7) : (k + 14);
-    int bit_idx = 3 * k;
+    int sym_idx = data_symbol<Protocol>(k);
+    int bit_idx = Protocol::bits_per_symbol * k;
 
-    // Pointer to 8 bins of the current symbol
+    // Pointer to the tone bins of the current symbol
     const uint8_t *ps = power + (offset + sym_idx * 4 * num_bins);
 
-    decode_symbol(ps, code_map, bit_idx, log174);
+    float tones[Protocol::num_tones];
+    for (int j = 0; j < Protocol::num_tones; ++j)
+    {
+      int sum = ps[j];
+      if (time_step != 0)
+        sum += ps[j + time_step];
+      if (freq_step != 0)
+        sum += ps[j + freq_step];
+      tones[j] = sum * weight;
+    }
+    decode_symbol<Protocol>(tones, bit_idx, log174);
+
+    float strongest = 0;
+    for (int j = 0; j < Protocol::num_tones; ++j)
+    {
+      float p = byte_power[ps[j]];
+      if (p > strongest)
+        strongest = p;
+    }
+    signal += strongest;
   }
 
   // Compute the variance of log174
@@ -140,6 +525,16 @@ void extract_likelihood(const uint8_t *power, int num_bins, Candidate cand,
   {
     log174[i] *= norm_factor;
   }
+
+  // Against the slot's noise floor rather than the other tones, which the symbols either
+  // side leak into, as WSJT-X takes its baseline. Less the noise in the signal's own bin,
+  // and taken to the 2500 Hz noise bandwidth SNRs are reported in.
+  float noise = Protocol::nd * kFloor_noise_power;
+  float ratio = signal / noise - 1;
+  if (ratio < 0.001f)
+    ratio = 0.001f;
+  float snr = 10 * log10f(ratio) + 10 * log10f(Protocol::tone_spacing_hz / 2500.0f);
+  return (snr < kMin_snr_db) ? kMin_snr_db : snr;
 }
 
 static float max2(float a, float b)
@@ -201,20 +596,38 @@ static void heapify_up(Candidate *heap, int heap_size)
   }
 }
 
-// Compute unnormalized log likelihood log(p(1) / p(0)) of 3 message bits (1 FSK symbol)
-static void decode_symbol(const uint8_t *power, const uint8_t *code_map,
-                          int bit_idx, float *log174)
+// Compute unnormalized log likelihood log(p(1) / p(0)) of the bits of 1 FSK symbol
+template <typename Protocol>
+static void decode_symbol(const float *tones, int bit_idx, float *log174)
 {
 
   // Cleaned up code for the simple case of n_syms==1
   float s2[8];
 
-  for (int j = 0; j < 8; ++j)
+  for (int j = 0; j < Protocol::num_tones; ++j)
   {
-    s2[j] = (float)power[code_map[j]];
+    s2[j] = tones[Protocol::gray_map[j]];
   }
 
-  log174[bit_idx + 0] = max4(s2[4], s2[5], s2[6], s2[7]) - max4(s2[0], s2[1], s2[2], s2[3]);
-  log174[bit_idx + 1] = max4(s2[2], s2[3], s2[6], s2[7]) - max4(s2[0], s2[1], s2[4], s2[5]);
-  log174[bit_idx + 2] = max4(s2[1], s2[3], s2[5], s2[7]) - max4(s2[0], s2[2], s2[4], s2[6]);
+  if (Protocol::bits_per_symbol == 3)
+  {
+    log174[bit_idx + 0] = max4(s2[4], s2[5], s2[6], s2[7]) - max4(s2[0], s2[1], s2[2], s2[3]);
+    log174[bit_idx + 1] = max4(s2[2], s2[3], s2[6], s2[7]) - max4(s2[0], s2[1], s2[4], s2[5]);
+    log174[bit_idx + 2] = max4(s2[1], s2[3], s2[5], s2[7]) - max4(s2[0], s2[2], s2[4], s2[6]);
+  }
+  else
+  {
+    log174[bit_idx + 0] = max2(s2[2], s2[3]) - max2(s2[0], s2[1]);
+    log174[bit_idx + 1] = max2(s2[1], s2[3]) - max2(s2[0], s2[2]);
+  }
 }
+
+#define INSTANTIATE_DECODE(Protocol)                                                        \
+  template void sync_search_begin<Protocol>(Sync_Search *, int, int, int, Candidate *, int); \
+  template void sync_search_update<Protocol>(Sync_Search *, const uint8_t *, int);           \
+  template int sync_search_finish<Protocol>(Sync_Search *, const uint8_t *);                 \
+  template int find_sync<Protocol>(const uint8_t *, int, int, int, Candidate *, int);        \
+  template void subtract_signal<Protocol>(uint8_t *, int, int, Candidate, const uint8_t *);  \
+  template float extract_likelihood<Protocol>(const uint8_t *, int, int, Candidate, float *);
+
+INSTANTIATE_DECODE(FT8_Protocol)
@@ -20,6 +20,8 @@
 #include "gen_ft8.h"
 #include "unpack.h"
 #include "ldpc.h"
+#include "osd.h"
+#include "ap_decode.h"
 #include "decode.h"
 #include "constants.h"
 #include "encode.h"
@@ -28,21 +30,30 @@
 #include "decode_ft8.h"
 #include "ADIF.h"
 #include "button.h"
+#include "SpotHistory.h"
+#include "CallSet.h"
+#include "DisplayQueue.h"
 #include "main.h"
 #include "traffic_manager.h"
 #include "Geodesy.h"
 #include "PskInterface.h"
 #include "autoseq_engine.h"
+#include "Telemetry.h"
+#include "Profile.h"
+#include "SlotCapture.h"
 
 int blank_length = 26;
 
-const int kLDPC_iterations = 20;
-const int kMax_candidates = 20;
-const int kMax_decoded_messages = 20;
-size_t kMax_message_length = 20;
-const int kMin_score = 40; // Minimum sync score threshold for candidates
+int Early_Decode = 1; // Decode on-time signals before the last rows of the slot arrive
 
-Decode new_decoded[20];
+// Candidates near the DX station of a QSO in progress that fail to decode are tried again
+// with what the QSO expects them to say, see ap_decode.h
+int AP_Decode = 1;
+
+// Time ft8_decode() may spend on each band before TX setup for the next slot, see [DecodeBudget]
+uint16_t Decode_Budget_ms[NumBands] = {350, 350, 350, 350, 350, 350, 350};
+
+Decode new_decoded[kMax_decoded_messages];
 
 static const char *blank = "                      "; // 22 spaces
 static const char *auto_blank = "             ";     // 14 spaces
@@ -50,144 +61,228 @@ static char worked_qso_entries[MAX_QSO_ENTRIES][MAX_LINE_LEN] = {};
 static int num_qsos = 0;
 
 static int validate_locator(const char *QSO_locator);
+static void display_padded_line(bool right, int line, MsgColor background, MsgColor textcolor, const char *text);
 
 const int auto_call_limit = 10;
-const int auto_logged_limit = 100;
+// Worked before calls remembered, one per call and band. Past that the one least recently
+// logged is forgotten, and its station may be answered again.
+const int auto_logged_limit = 3072;
 
 int max_sync_score;
 int max_sync_score_index;
+
+// Stations auto called, in order, oldest at call_list_head
 Called_Stations call_list[auto_call_limit];
-Called_Stations auto_logged_list[auto_logged_limit];
+static int call_list_head = 0;
+
+// Stations auto called, and stations worked on each band in this or earlier sessions,
+// so that a CQ from either is passed over
+static uint32_t called_keys[16], called_used[16];
+static Call_Set called_set = {called_keys, called_used, 16, auto_call_limit, 0, 0, 0};
+DMAMEM static uint32_t logged_keys[4096], logged_used[4096];
+static Call_Set logged_set;
 
 int auto_logged;
 int Valid_CQ_Candidate;
 
-int ft8_decode(void)
+// Candidate heap filled row by row while the slot is being received
+static Candidate candidate_list[kMax_candidates];
+static Sync_Search sync_search;
+
+// True between the early pass of a slot and its full pass
+static bool early_pass_done = false;
+
+// Slot whose spectrogram is being decoded, slot_state moves on if the decode overruns it
+static int decode_slot;
+static time_t decode_slot_time; // its UTC start
+
+void ft8_sync_begin(void)
 {
-  // Find top candidates by Costas sync score and localize them in time and frequency
-  Candidate candidate_list[kMax_candidates];
+  sync_search_begin<FT8_Protocol>(&sync_search, ft8_msg_samples, ft8_buffer, kMax_candidates, candidate_list, kMin_score);
+  early_pass_done = false;
+}
+
+// A payload decode_passes.cpp found, unpacked straight into new_decoded[index], which is
+// kept only if the text fits the display
+static bool add_decode(int index, const Candidate *cand, const uint8_t *payload, float snr)
+{
+  float freq_hz = (cand->freq_offset + cand->freq_sub / 2.0f) * 6.25f;
+
+  Decode *decode = &new_decoded[index];
+  int rc;
+  {
+    Profile_Scope scope(Profile_Unpack);
+    rc = unpack77_fields(payload, decode->call_to, decode->call_from, decode->locator);
+  }
+  if (rc < 0)
+    return false;
+  if (strlen(decode->call_to) + strlen(decode->call_from) + strlen(decode->locator) + 3 >= kDecode_text_size)
+    return false;
+
+  memcpy(decode->payload, payload, sizeof(decode->payload));
+  decode->text[0] = 0; // formatted by decode_text() if anything asks for it
+
+  decode->sync_score = cand->score;
+  decode->freq_hz = (int)freq_hz;
+  decode->time_ms = (cand->time_offset * 2 + cand->time_sub) * (int)FT8_Protocol::symbol_us / 2000;
+  decode->slot = decode_slot;
 
-  int num_candidates = find_sync(export_fft_power, ft8_msg_samples, ft8_buffer, kCostas_map, kMax_candidates, candidate_list, kMin_score);
-  char decoded[kMax_decoded_messages][kMax_message_length];
+  int display_RSL = (int)lrintf(snr);
+  decode->snr = display_RSL;
 
-  const float fsk_dev = 6.25f; // tone deviation in Hz and symbol rate
+  spot_history_add((int)freq_hz, display_RSL, cand->score, payload);
 
-  // Go over candidates and attempt to decode messages
-  int num_decoded = 0;
+  decode->target_distance = 0;
 
-  for (int idx = 0; idx < num_candidates; ++idx)
+  const char *locator = decode->locator;
+  if (validate_locator(locator))
   {
-    Candidate cand = candidate_list[idx];
-    float freq_hz = (cand.freq_offset + cand.freq_sub / 2.0f) * fsk_dev;
-
-    float log174[N];
-    extract_likelihood(export_fft_power, ft8_buffer, cand, kGray_map, log174);
-
-    // bp_decode() produces better decodes, uses way less memory
-    uint8_t plain[N];
-    int n_errors = 0;
-    bp_decode(log174, kLDPC_iterations, plain, &n_errors);
-
-    if (n_errors > 0)
-      continue;
-
-    // Extract payload + CRC (first K bits)
-    uint8_t a91[K_BYTES];
-    pack_bits(plain, K, a91);
-
-    // Extract CRC and check it
-    uint16_t chksum = ((a91[9] & 0x07) << 11) | (a91[10] << 3) | (a91[11] >> 5);
-    a91[9] &= 0xF8;
-    a91[10] = 0;
-    a91[11] = 0;
-    uint16_t chksum2 = crc(a91, 96 - 14);
-    if (chksum != chksum2)
-      continue;
-
-    char message[kMax_message_length];
-
-    char call_to[14];
-    char call_from[14];
-    char locator[7];
-    int rc = unpack77_fields(a91, call_to, call_from, locator);
-    if (rc < 0)
-      continue;
-
-    sprintf(message, "%s %s %s ", call_to, call_from, locator);
-
-    // Check for duplicate messages (TODO: use hashing)
-    bool found = false;
-    for (int i = 0; i < num_decoded; ++i)
+    strcpy(decode->target_locator, locator);
+    decode->sequence = Seq_Locator;
+  }
+  else
+  {
+    if (strcmp(locator, "73") == 0)
+      decode->sequence = Seq_73;
+    else if (strcmp(locator, "RR73") == 0 || strcmp(locator, "RRR") == 0)
+      decode->sequence = Seq_Rogers;
+    else if (*locator == 'R')
+      decode->sequence = Seq_Roger_RSL;
+    else
+      decode->sequence = Seq_RSL;
+
+    const char *ptr = locator;
+    if (*ptr == 'R')
     {
-      if (0 == strcmp(decoded[i], message))
-      {
-        found = true;
-        break;
-      }
+      ptr++;
     }
 
-    int raw_RSL;
-    int display_RSL;
-    int received_RSL;
+    int received_RSL = atoi(ptr);
+    if (received_RSL < 30) // Prevents a 73 being decoded as a received RSL
+    {
+      decode->received_snr = received_RSL;
+    }
+  }
 
-    getTeensy3Time();
-    char rtc_string[10]; // print format stuff
-    sprintf(rtc_string, "%02i%02i%02i", hour(), minute(), second());
+  decode->calling_CQ = (memcmp(decode->call_to, "CQ\0", 3) == 0) || (memcmp(decode->call_to, "CQ ", 3) == 0);
 
-    if (!found && num_decoded < kMax_decoded_messages)
-    {
-      if (strlen(message) < kMax_message_length)
-      {
-        strcpy(decoded[num_decoded], message);
+  // ignore hashed callsigns the call hash table could not resolve
+  char call_from[sizeof(decode->call_from)];
+  copy_bare_call(call_from, decode->call_from);
+  if (*call_from != '<')
+  {
+    uint32_t frequency = (sBand_Data[BandIndex].Frequency * 1000) + decode->freq_hz;
+    addReceivedRecord(call_from, frequency, display_RSL);
+  }
 
-        new_decoded[num_decoded].sync_score = cand.score;
-        new_decoded[num_decoded].freq_hz = (int)freq_hz;
-        strcpy(new_decoded[num_decoded].call_to, call_to);
-        strcpy(new_decoded[num_decoded].call_from, call_from);
-        strcpy(new_decoded[num_decoded].locator, locator);
+  return true;
+}
 
-        new_decoded[num_decoded].slot = slot_state;
+static uint32_t micros_now(void)
+{
+  return micros();
+}
 
-        raw_RSL = (float)cand.score;
-        display_RSL = (int)((raw_RSL - 235)) / 8;
-        new_decoded[num_decoded].snr = display_RSL;
-        new_decoded[num_decoded].sequence = Seq_RSL;
+static uint32_t cycles_now(void)
+{
+  return ARM_DWT_CYCCNT;
+}
 
-        new_decoded[num_decoded].target_distance = 0;
+static void profile_stage(int stage, uint32_t cycles)
+{
+  static const int8_t points[Decode_Stages] = {Profile_Find_Sync, -1, Profile_BP_Decode, Profile_MS_Decode,
+                                               Profile_OSD, Profile_AP, -1};
+  if (points[stage] >= 0)
+    profile_add(points[stage], cycles);
+}
 
-        if (validate_locator(locator))
-        {
-          strcpy(new_decoded[num_decoded].target_locator, locator);
-          new_decoded[num_decoded].sequence = Seq_Locator;
-        }
-        else
-        {
-          const char *ptr = locator;
-          if (*ptr == 'R')
-          {
-            ptr++;
-          }
-
-          received_RSL = atoi(ptr);
-          if (received_RSL < 30) // Prevents a 73 being decoded as a received RSL
-          {
-            new_decoded[num_decoded].received_snr = received_RSL;
-          }
-        }
+static const Decode_Hooks decode_hooks = {micros_now, service_audio, add_decode, cycles_now, profile_stage};
 
-        new_decoded[num_decoded].calling_CQ = (memcmp(new_decoded[num_decoded].call_to, "CQ\0", 3) == 0) || (memcmp(new_decoded[num_decoded].call_to, "CQ ", 3) == 0);
+// Forget the decodes of the previous slot. Not done by ft8_sync_begin(), as the capture of
+// the next slot may begin while the previous one is still being decoded.
+static void decode_begin(void)
+{
+  decode_slot = slot_state;
 
-        // ignore hashed callsigns
-        if (*call_from != '<')
-        {
-          uint32_t frequency = (sBand_Data[BandIndex].Frequency * 1000) + new_decoded[num_decoded].freq_hz;
-          addReceivedRecord(call_from, frequency, display_RSL);
-        }
+  // Both passes start 13 to 15 s into the slot, so this is its start even with the RTC a few seconds out
+  time_t slot_time = now() - 7;
+  decode_slot_time = slot_time - slot_time % 15;
+  spot_history_begin_slot(decode_slot_time, BandIndex);
 
-        ++num_decoded;
-      }
-    }
-  } // End of big decode loop
+  AP_Hypothesis ap_list[kMax_AP_hypotheses];
+  int num_ap_hypotheses = 0;
+  autoseq_ap_t ap = {};
+  if (AP_Decode && autoseq_get_ap(&ap))
+    num_ap_hypotheses = ap_hypotheses(ap.mycall, ap.dxcall, ap.rogers, ap.signoff, ap_list);
+
+  decode_passes_begin(&decode_hooks, ap_list, num_ap_hypotheses, ap.dxfreq);
+}
+
+void copy_bare_call(char *dst, const char *call)
+{
+  size_t length = strlen(call);
+  if (length > 2 && call[0] == '<' && call[length - 1] == '>' && strspn(call + 1, "0123456789") != length - 2)
+  {
+    memcpy(dst, call + 1, length - 2);
+    dst[length - 2] = 0;
+  }
+  else
+    strcpy(dst, call);
+}
+
+const char *decode_text(int index)
+{
+  Decode *decode = &new_decoded[index];
+  if (decode->text[0] == 0)
+    snprintf(decode->text, sizeof(decode->text), "%s %s %s", decode->call_to, decode->call_from, decode->locator);
+  return decode->text;
+}
+
+void ft8_sync_update(int num_rows)
+{
+  Profile_Scope scope(Profile_Sync_Rows);
+  sync_search_update<FT8_Protocol>(&sync_search, capture_fft_power, num_rows);
+}
+
+int ft8_decode_early(void)
+{
+  uint32_t start_us = micros();
+  decode_begin();
+  early_pass_done = true;
+
+  // The rows still to come are captured while the early pass runs, and can complete the
+  // slot and swap the spectrograms over, but the buffer the early pass started on stays put
+  return decode_early_pass(capture_fft_power, candidate_list, sync_search.heap_size, start_us, kEarly_budget_ms * 1000);
+}
+
+int ft8_decode(uint32_t budget_ms)
+{
+  uint32_t start_us = micros();
+  if (!early_pass_done)
+    decode_begin();
+  early_pass_done = false;
+
+  capture_slot(export_fft_power, decode_slot_time, BandIndex, cursor_freq);
+
+  // Finish the Costas sync search over the time offsets that end past the slot
+  int num_candidates;
+  {
+    Profile_Scope scope(Profile_Find_Sync);
+    num_candidates = sync_search_finish<FT8_Protocol>(&sync_search, export_fft_power);
+  }
+  int num_decoded = decode_full_passes(export_fft_power, candidate_list, num_candidates, start_us, budget_ms * 1000);
+
+  spot_history_end_slot();
+
+  Serial.printf("decode: %d candidates, %d tried, %d skipped, %d decoded (%d early, %d by OSD, %d AP), %d passes, %lu us, noise floor %.1f dBFS\n",
+                decode_stats.candidates, decode_stats.tried, decode_stats.skipped,
+                decode_stats.decoded, decode_stats.early_decoded, decode_stats.osd_decoded, decode_stats.ap_decoded,
+                decode_stats.passes, decode_stats.elapsed_us, noise_dbfs(&export_power_scale));
+  telemetry_slot(decode_slot_time, BandIndex, num_decoded);
+
+  for (int i = 0; i < num_decoded; ++i)
+    addDecodeRecord(decode_slot_time, sBand_Data[BandIndex].Frequency, decode_text(i), new_decoded[i].snr,
+                    new_decoded[i].time_ms, new_decoded[i].freq_hz);
 
   return num_decoded;
 }
@@ -222,14 +317,14 @@ void set_QSO_Xmit_Freq(int freq)
 
   float cursor_value = (float)freq / FFT_Resolution;
   cursor_line = (uint16_t)(cursor_value - ft8_min_bin);
-  display_cursor_line = 2 * cursor_line;
+  display_cursor_line = waterfall_x(cursor_line);
 }
 
 void process_selected_Station(int stations_decoded, int TouchIndex)
 {
   if (stations_decoded > 0 && TouchIndex <= stations_decoded)
   {
-    strcpy(Target_Call, new_decoded[TouchIndex].call_from);
+    copy_bare_call(Target_Call, new_decoded[TouchIndex].call_from);
     strcpy(Target_Locator, new_decoded[TouchIndex].target_locator);
 
     Target_RSL = new_decoded[TouchIndex].snr;
@@ -243,22 +338,18 @@ void process_selected_Station(int stations_decoded, int TouchIndex)
   FT8_Touch_Flag = 0;
 }
 
-void display_messages(Decode new_decoded[], int decoded_messages)
+void display_messages(int decoded_messages)
 {
-  clear_rx_region();
+  Profile_Scope scope(Profile_Display_Messages);
   max_sync_score = 0;
   Valid_CQ_Candidate = 0;
 
   for (int i = 0; i < decoded_messages && i < MAX_RX_ROWS; i++)
   {
-    const char *call_to = new_decoded[i].call_to;
-    const char *call_from = new_decoded[i].call_from;
-    const char *locator = new_decoded[i].locator;
+    char call_to[sizeof(new_decoded[i].call_to)];
+    copy_bare_call(call_to, new_decoded[i].call_to);
 
     MsgColor color = White;
-    char message[MAX_MSG_LEN];
-    snprintf(message, MAX_LINE_LEN, "%s %s %s", call_to, call_from, locator);
-    message[MAX_LINE_LEN - 1] = '\0'; // Make sure it fits the display region
 
     if (new_decoded[i].calling_CQ)
     {
@@ -286,66 +377,87 @@ void display_messages(Decode new_decoded[], int decoded_messages)
     {
       color = Yellow;
     }
-    display_line(false, i, Black, color, message);
+    display_padded_line(false, i, Black, color, decode_text(i));
   }
+
+  // Rows left over from a busier slot, already blank ones are skipped
+  for (int i = decoded_messages; i < MAX_RX_ROWS; i++)
+    display_padded_line(false, i, Black, Black, "");
 }
 
 void store_CQ_Call(void)
 {
+  char call[sizeof(new_decoded[0].call_from)];
+  copy_bare_call(call, new_decoded[max_sync_score_index].call_from);
+  call_set_insert(&called_set, call);
 
-  const char blank[] = "             ";
-
-  for (int i = 0; i < auto_call_limit - 1; i++)
-  {
-    strcpy(call_list[i].call, blank);
-    strcpy(call_list[i].call, call_list[i + 1].call);
-  }
+  strcpy(call_list[call_list_head].call, call);
+  call_list_head = (call_list_head + 1) % auto_call_limit;
+}
 
-  strcpy(call_list[auto_call_limit - 1].call, blank);
-  strcpy(call_list[auto_call_limit - 1].call, new_decoded[max_sync_score_index].call_from);
+bool store_worked_call(uint32_t key, int band)
+{
+  uint32_t evicted = logged_set.evicted;
+  call_set_insert_key(&logged_set, call_band_key(key, band));
+  return logged_set.evicted != evicted;
 }
 
 void store_logged_CQ_Call(const char *call)
 {
-
-  strcpy(auto_logged_list[auto_logged].call, call); // store candidate call so we do not duplicate call later
+  // The call itself went into the worked set with the log record
   auto_logged++;
   display_value(0, 520, auto_logged);
 }
 
 void clear_auto_memories(void)
 {
-
-  for (int j = 0; j < auto_logged; j++)
+  for (int j = 0; j < auto_call_limit; j++)
   {
     strcpy(call_list[j].call, auto_blank);
     call_list[j].distance = 0.0;
     call_list[j].sync_score = 0;
   }
+  call_list_head = 0;
+  call_set_clear(&called_set);
+
+  // The logged set lives in DMAMEM, which holds garbage after power up, so this is also its
+  // setup. load_Worked_Index() fills it from the card afterwards.
+  call_set_init(&logged_set, logged_keys, logged_used, 4096, auto_logged_limit);
   auto_logged = 0;
 }
 
 void display_line(bool right, int line, MsgColor background, MsgColor textcolor, const char *text)
 {
-  tft.setFontSize(1, true);
-  tft.textColor(lcd_color_map[textcolor], lcd_color_map[background]);
-  tft.setCursor(right ? START_X_RIGHT : START_X_LEFT, START_Y + line * LINE_HT);
-  tft.write((const uint8_t *)text, strlen(text));
+  display_text(right ? START_X_RIGHT : START_X_LEFT, START_Y + line * LINE_HT, 1,
+               lcd_color_map[textcolor], lcd_color_map[background], text, strlen(text));
+}
+
+// A display_line() padded with spaces to a whole row, so drawing it covers whatever was in
+// the row before and the text memory of the display queue skips rows that have not changed
+static void display_padded_line(bool right, int line, MsgColor background, MsgColor textcolor, const char *text)
+{
+  char row[MAX_LINE_LEN + 1];
+  snprintf(row, sizeof(row), "%-*s", MAX_LINE_LEN, text);
+  display_line(right, line, background, textcolor, row);
+}
+
+// True if a display_line() of the same text in the same colours is on the screen already
+static bool line_shown(bool right, int line, MsgColor background, MsgColor textcolor, const char *text)
+{
+  return display_text_shown(right ? START_X_RIGHT : START_X_LEFT, START_Y + line * LINE_HT, 1,
+                            lcd_color_map[textcolor], lcd_color_map[background], text, strlen(text));
 }
 
 void display_call_list_item(int left, int line, MsgColor background, MsgColor textcolor, const char *text)
 {
-  tft.setFontSize(1, true);
-  tft.textColor(lcd_color_map[textcolor], lcd_color_map[background]);
-  tft.setCursor(left, START_Y + line * LINE_HT);
-  tft.write((const uint8_t *)text, strlen(text));
+  display_text(left, START_Y + line * LINE_HT, 1, lcd_color_map[textcolor], lcd_color_map[background], text, strlen(text));
 }
 
 void display_call_list(int number_calls)
 {
 
-  for (int i = 0; i < number_calls; i++)
-    display_call_list_item(600, i, Black, Yellow, call_list[i].call);
+  for (int i = 0; i < number_calls && i < auto_call_limit; i++)
+    display_call_list_item(600, i, Black, Yellow, call_list[(call_list_head + i) % auto_call_limit].call);
 }
 
 void clear_rx_region(void)
@@ -366,20 +478,21 @@ void clear_qso_region(void)
 
 void display_queued_message(const char *msg)
 {
-  display_line(true, 0, Black, Black, blank);
-  display_line(true, 0, Black, Red, msg);
+  display_padded_line(true, 0, Black, Red, msg);
 }
 
 void display_txing_message(const char *msg)
 {
+  if (line_shown(true, 0, Red, White, msg))
+    return;
+
   display_line(true, 0, Black, Black, blank);
   display_line(true, 0, Red, White, msg);
 }
 
 void display_qso_state(const char *txt)
 {
-  display_line(true, 1, Black, Black, blank);
-  display_line(true, 1, Black, White, txt);
+  display_padded_line(true, 1, Black, White, txt);
 }
 
 char *add_worked_qso(void)
@@ -426,31 +539,19 @@ bool display_worked_qsos(void)
 
 int check_call_list(int message_index)
 {
-
-  int test = 0;
-
-  for (int i = 0; i < auto_call_limit; i++)
-  {
-
-    if (strcmp(call_list[i].call, new_decoded[message_index].call_from) == 0)
-    {
-      test = 1;
-    }
-  }
-  return test;
+  char call[sizeof(new_decoded[0].call_from)];
+  copy_bare_call(call, new_decoded[message_index].call_from);
+  return call_set_contains(&called_set, call);
 }
 
 int check_log_list(int message_index)
 {
+  char call[sizeof(new_decoded[0].call_from)];
+  copy_bare_call(call, new_decoded[message_index].call_from);
+  return worked_on_band(call);
+}
 
-  int test = 0;
-
-  for (int i = 0; i < auto_logged; i++)
-  {
-    if (strcmp(auto_logged_list[i].call, new_decoded[message_index].call_from) == 0)
-    {
-      test = 1;
-    }
-  }
-  return test;
+bool worked_on_band(const char *call)
+{
+  return call_set_contains_key(&logged_set, call_band_key(call_key(call), BandIndex));
 }
@@ -0,0 +1,345 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "decode_passes.h"
+#include "constants.h"
+#include "encode.h"
+#include "gen_ft8.h"
+#include "ldpc.h"
+#include "osd.h"
+
+const int kLDPC_iterations = 20;
+
+int Decode_Passes = 2;
+int Min_Sum_Passes = 1;
+
+// Candidates bp_decode() left few parity errors on, with a sync score well clear of the
+// noise, go on to osd_decode(). Below these the fallback mostly spends time on noise.
+int OSD_Depth = 2;
+const int kOSD_max_errors = 20;
+const int kOSD_min_score = 120;
+const int kOSD_max_hard_errors = 36; // as WSJT-X, against false decodes
+
+// Candidates near the DX station of a QSO in progress that fail to decode are tried again
+// with what the QSO expects them to say, see ap_decode.h
+const int kAP_freq_span_hz = 50;
+const int kAP_max_hard_errors = 36;
+static AP_Hypothesis ap_list[kMax_AP_hypotheses];
+static int num_ap_hypotheses = 0;
+static int ap_freq_hz = 0;
+
+Decode_Stats decode_stats;
+
+static const Decode_Hooks *hooks;
+
+// Decodes of the current slot, shared by all passes
+static int num_decoded = 0;
+
+// Candidate and payload of each decode, so that the next pass can subtract it
+static Candidate decoded_candidates[kMax_decoded_messages];
+static uint8_t decoded_payloads[kMax_decoded_messages][10];
+static int num_subtracted = 0;
+
+// Open addressing hash set over decoded_payloads, holding the index of each payload or -1
+static const int kPayload_set_size = 64; // power of two, above kMax_decoded_messages
+static int8_t payload_set[kPayload_set_size];
+
+// Snapshot of the heap decoded by the early pass
+static Candidate early_candidates[kMax_candidates];
+
+// Candidates of the full pass. The heap is taken over by the next slot while they are tried.
+static Candidate decode_list[kMax_candidates];
+
+// Candidates run through LDPC in the current slot, by any pass
+static Candidate tried_candidates[kMax_candidates * (kMax_decode_passes + 1)];
+static bool tried_with_bp[kMax_candidates * (kMax_decode_passes + 1)]; // else only by ms_decode()
+static int num_tried = 0;
+
+// Candidates ms_decode() failed on since the last bp_decode() pass, worth a pass of their own
+static int min_sum_misses = 0;
+
+// Times the rest of the enclosing block, as Profile_Scope does on the radio
+class Stage_Scope
+{
+public:
+  explicit Stage_Scope(int stage) : stage(stage), start(hooks->stage_clock ? hooks->stage_clock() : 0) {}
+  ~Stage_Scope()
+  {
+    if (hooks->stage_clock && hooks->stage_time)
+      hooks->stage_time(stage, hooks->stage_clock() - start);
+  }
+
+private:
+  int stage;
+  uint32_t start;
+};
+
+void decode_passes_begin(const Decode_Hooks *decode_hooks, const AP_Hypothesis *hypotheses, int num_hypotheses, int freq_hz)
+{
+  hooks = decode_hooks;
+  num_tried = 0;
+  min_sum_misses = 0;
+  num_decoded = 0;
+  num_subtracted = 0;
+  memset(payload_set, -1, sizeof(payload_set));
+  memset(&decode_stats, 0, sizeof(decode_stats));
+
+  num_ap_hypotheses = num_hypotheses < kMax_AP_hypotheses ? num_hypotheses : kMax_AP_hypotheses;
+  if (num_ap_hypotheses > 0)
+    memcpy(ap_list, hypotheses, num_ap_hypotheses * sizeof(AP_Hypothesis));
+  ap_freq_hz = freq_hz;
+}
+
+// FNV-1a hash of a 77 bit payload
+static uint32_t hash_payload(const uint8_t *payload)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < sizeof(decoded_payloads[0]); ++i)
+  {
+    hash = (hash ^ payload[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Slot of payload in payload_set, or of the empty entry where it would go
+static int find_payload(const uint8_t *payload)
+{
+  int slot = hash_payload(payload) & (kPayload_set_size - 1);
+  while (payload_set[slot] >= 0 &&
+         memcmp(decoded_payloads[payload_set[slot]], payload, sizeof(decoded_payloads[0])) != 0)
+  {
+    slot = (slot + 1) & (kPayload_set_size - 1);
+  }
+  return slot;
+}
+
+// Index of a candidate in tried_candidates, or -1
+static int find_tried(const Candidate *cand)
+{
+  for (int i = 0; i < num_tried; ++i)
+  {
+    const Candidate *tried = &tried_candidates[i];
+    if (tried->time_offset == cand->time_offset && tried->freq_offset == cand->freq_offset &&
+        tried->time_sub == cand->time_sub && tried->freq_sub == cand->freq_sub)
+      return i;
+  }
+  return -1;
+}
+
+// Subtract the decodes of the previous passes from the spectrogram. Candidates whose
+// 8 tone window overlaps a subtracted signal may now decode, so they are tried again.
+static void subtract_decoded(uint8_t *power)
+{
+  Stage_Scope scope(Decode_Stage_Subtract);
+  uint8_t itone[79];
+
+  for (; num_subtracted < num_decoded; ++num_subtracted)
+  {
+    const Candidate *cand = &decoded_candidates[num_subtracted];
+    genft8(decoded_payloads[num_subtracted], itone);
+    subtract_signal<FT8_Protocol>(power, ft8_msg_samples, ft8_buffer, *cand, itone);
+
+    int kept = 0;
+    for (int i = 0; i < num_tried; ++i)
+    {
+      if (abs(tried_candidates[i].freq_offset - cand->freq_offset) >= 8)
+      {
+        tried_with_bp[kept] = tried_with_bp[i];
+        tried_candidates[kept++] = tried_candidates[i];
+      }
+    }
+    num_tried = kept;
+  }
+}
+
+// Attempt to decode a list of candidates, best first, handing new payloads to add_decode()
+// until budget_us has elapsed since start_us. Candidates tried earlier in the slot are left
+// out, except that those only min_sum had tried get another go when min_sum is off.
+static void decode_candidates(const uint8_t *power, const Candidate *candidates, int num_candidates,
+                              uint32_t start_us, uint32_t budget_us, bool min_sum)
+{
+  const float fsk_dev = 6.25f; // tone deviation in Hz and symbol rate
+
+  for (int idx = 0; idx < num_candidates; ++idx)
+  {
+    Candidate cand = candidates[idx];
+    int tried = find_tried(&cand);
+    if (tried >= 0 && (tried_with_bp[tried] || min_sum))
+      continue;
+
+    if (hooks->micros() - start_us >= budget_us)
+    {
+      ++decode_stats.skipped;
+      continue;
+    }
+    ++decode_stats.tried;
+    if (hooks->service)
+      hooks->service();
+
+    float freq_hz = (cand.freq_offset + cand.freq_sub / 2.0f) * fsk_dev;
+
+    // The DX station of the QSO in progress gets the full decoder whatever the pass
+    bool near_dx = num_ap_hypotheses > 0 && fabsf(freq_hz - ap_freq_hz) <= kAP_freq_span_hz;
+    bool use_min_sum = min_sum && !near_dx;
+
+    if (tried >= 0)
+    {
+      tried_with_bp[tried] = true;
+    }
+    else if (num_tried < (int)(sizeof(tried_candidates) / sizeof(tried_candidates[0])))
+    {
+      tried_with_bp[num_tried] = !use_min_sum;
+      tried_candidates[num_tried++] = cand;
+    }
+
+    float log174[N];
+    float snr;
+    {
+      Stage_Scope scope(Decode_Stage_Likelihood);
+      snr = extract_likelihood<FT8_Protocol>(power, ft8_msg_samples, ft8_buffer, cand, log174);
+    }
+
+    // bp_decode() produces better decodes, uses way less memory
+    uint8_t plain[N];
+    int n_errors = 0;
+    if (use_min_sum)
+    {
+      Stage_Scope scope(Decode_Stage_MS_Decode);
+      ms_decode(log174, kLDPC_iterations, plain, &n_errors);
+    }
+    else
+    {
+      Stage_Scope scope(Decode_Stage_BP_Decode);
+      bp_decode(log174, kLDPC_iterations, plain, &n_errors);
+    }
+
+    bool by_osd = false;
+    if (n_errors > 0 && !use_min_sum && OSD_Depth > 0 && n_errors <= kOSD_max_errors &&
+        cand.score >= kOSD_min_score && hooks->micros() - start_us < budget_us)
+    {
+      Stage_Scope scope(Decode_Stage_OSD);
+      int hard_errors = osd_decode(log174, OSD_Depth, plain);
+      if (hard_errors >= 0 && hard_errors <= kOSD_max_hard_errors)
+      {
+        n_errors = 0;
+        by_osd = true;
+      }
+    }
+
+    bool by_ap = false;
+    if (n_errors > 0 && near_dx && hooks->micros() - start_us < budget_us)
+    {
+      Stage_Scope scope(Decode_Stage_AP);
+      int hard_errors = ap_decode(log174, ap_list, num_ap_hypotheses, kLDPC_iterations, plain);
+      if (hard_errors >= 0 && hard_errors <= kAP_max_hard_errors)
+      {
+        n_errors = 0;
+        by_ap = true;
+      }
+    }
+
+    if (n_errors > 0)
+    {
+      if (use_min_sum)
+        ++min_sum_misses;
+      continue;
+    }
+
+    // Extract payload + CRC (first K bits)
+    uint8_t a91[K_BYTES];
+    pack_bits(plain, K, a91);
+
+    // The all-zero codeword passes the CRC, and strong slopes in the spectrum decode to it
+    if (payload_is_zero(a91))
+      continue;
+
+    // Extract CRC and check it
+    uint16_t chksum = ((a91[9] & 0x07) << 11) | (a91[10] << 3) | (a91[11] >> 5);
+    a91[9] &= 0xF8;
+    a91[10] = 0;
+    a91[11] = 0;
+    uint16_t chksum2 = crc(a91, 96 - 14);
+    if (chksum != chksum2)
+      continue;
+
+    // Neighbouring candidates of a signal decode to the same payload, drop those
+    // before spending time on unpacking it
+    int payload_slot = find_payload(a91);
+    if (payload_set[payload_slot] >= 0)
+      continue;
+
+    if (num_decoded >= kMax_decoded_messages)
+      continue;
+
+    if (!hooks->add_decode(num_decoded, &cand, a91, snr))
+      continue;
+
+    decoded_candidates[num_decoded] = cand;
+    memcpy(decoded_payloads[num_decoded], a91, sizeof(decoded_payloads[0]));
+    payload_set[payload_slot] = num_decoded;
+
+    if (by_osd)
+      ++decode_stats.osd_decoded;
+    if (by_ap)
+      ++decode_stats.ap_decoded;
+    ++num_decoded;
+  } // End of big decode loop
+}
+
+int decode_early_pass(const uint8_t *power, const Candidate *heap, int heap_size, uint32_t start_us, uint32_t budget_us)
+{
+  // Only the time offsets already covered by the received rows are in the heap, so
+  // decode a snapshot of it and leave the heap to keep filling for the full pass
+  memcpy(early_candidates, heap, heap_size * sizeof(Candidate));
+  sort_candidates(early_candidates, heap_size);
+
+  // Whatever the budget left untried goes back to the full pass
+  decode_candidates(power, early_candidates, heap_size, start_us, budget_us, Min_Sum_Passes > 0);
+  decode_stats.skipped = 0;
+  decode_stats.early_decoded = num_decoded;
+
+  return num_decoded;
+}
+
+int decode_full_passes(uint8_t *power, const Candidate *heap, int num_candidates, uint32_t start_us, uint32_t budget_us)
+{
+  memcpy(decode_list, heap, num_candidates * sizeof(Candidate));
+  sort_candidates(decode_list, num_candidates);
+  decode_stats.candidates = num_candidates;
+
+  // Go over candidates and attempt to decode messages, skipping those the early pass has tried
+  decode_candidates(power, decode_list, num_candidates, start_us, budget_us, Min_Sum_Passes > 0);
+  decode_stats.passes = 1;
+
+  // Strong signals hide weaker ones under their tones, so take out what has been
+  // decoded and search again while there is budget left. A bp_decode() pass is also
+  // worth it for the candidates min-sum gave up on, even with nothing new to take out.
+  while (decode_stats.passes < Decode_Passes && hooks->micros() - start_us < budget_us)
+  {
+    bool min_sum = decode_stats.passes < Min_Sum_Passes;
+    bool retry = !min_sum && min_sum_misses > 0;
+    if (num_subtracted < num_decoded)
+    {
+      subtract_decoded(power);
+      {
+        Stage_Scope scope(Decode_Stage_Find_Sync);
+        num_candidates = find_sync<FT8_Protocol>(power, ft8_msg_samples, ft8_buffer, kMax_candidates, decode_list, kMin_score);
+      }
+      sort_candidates(decode_list, num_candidates);
+    }
+    else if (!retry)
+    {
+      break;
+    }
+
+    if (!min_sum)
+      min_sum_misses = 0;
+    decode_candidates(power, decode_list, num_candidates, start_us, budget_us, min_sum);
+    ++decode_stats.passes;
+  }
+
+  decode_stats.decoded = num_decoded;
+  decode_stats.elapsed_us = hooks->micros() - start_us;
+  return num_decoded;
+}
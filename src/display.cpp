@@ -14,6 +14,13 @@
 #include "gen_ft8.h"
 #include "ini.h"
 #include "autoseq_engine.h"
+#include "DisplayQueue.h"
+#include "SlotCapture.h"
+#include "Process_DSP.h"
+#include "CallHash.h"
+#include "Power.h"
+#include "Telemetry.h"
+#include "MemoryMap.h"
 
 File stationData_File;
 
@@ -23,25 +30,22 @@ char current_message[22];
 
 static int old_rtc_hour = -1;
 
+// StationData.ini keys of each band, see BandIndex
+static const char *band_keys[NumBands] = {"40", "30", "20", "17", "15", "12", "10"};
+
 void display_value(int x, int y, int value)
 {
   char string[5];
   sprintf(string, "%4i", value);
 
-  tft.textColor(YELLOW, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(string, 5);
+  display_text(x, y, 2, YELLOW, BLACK, string, 5);
 }
 
 void show_wide(uint16_t x, uint16_t y, int variable)
 {
   char string[7];
   sprintf(string, "%6i", variable);
-  tft.textColor(YELLOW, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(string, 7);
+  display_text(x, y, 2, YELLOW, BLACK, string, 7);
 }
 
 void display_time(int x, int y)
@@ -59,10 +63,7 @@ void display_time(int x, int y)
 
   old_rtc_hour = hour();
 
-  tft.textColor(WHITE, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(string, 8);
+  display_text(x, y, 2, WHITE, BLACK, string, 8);
 }
 
 void display_date(int x, int y)
@@ -70,13 +71,10 @@ void display_date(int x, int y)
   getTeensy3Time();
   char string[11];
   sprintf(string, "%2.2i/%2.2i/%4.4i", day(), month(), year());
-  tft.textColor(WHITE, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(string, 11);
+  display_text(x, y, 2, WHITE, BLACK, string, 11);
 }
 
-static int setup_station_call(const char *call_part)
+static COLD_CODE int setup_station_call(const char *call_part)
 {
   int result = 0;
   if (call_part != NULL)
@@ -86,12 +84,13 @@ static int setup_station_call(const char *call_part)
     if (result != 0)
     {
       strcpy(Station_Call, call_part);
+      call_hash_set_own(Station_Call);
     }
   }
   return result;
 }
 
-static int setup_locator(const char *locator_part)
+static COLD_CODE int setup_locator(const char *locator_part)
 {
   int result = 0;
   if (locator_part != NULL)
@@ -114,7 +113,7 @@ enum
   FreeText2
 };
 
-static int setup_free_text(const char *free_text, int field_id)
+static COLD_CODE int setup_free_text(const char *free_text, int field_id)
 {
   int result = 0;
   if (free_text != NULL)
@@ -139,7 +138,88 @@ static int setup_free_text(const char *free_text, int field_id)
   return result;
 }
 
-bool open_stationData_file(void)
+// The StationData.ini entries, as ini_parse_stream() comes to them
+static COLD_CODE void station_data_entry(void *user, const char *section, ini_view_t key, ini_view_t value)
+{
+  char text[MAX_LINE_LENGTH];
+  if (!ini_view_copy(value, text, sizeof(text)))
+    return;
+
+  if (strcmp(section, "Station") == 0)
+  {
+    if (ini_view_equals(key, "Call"))
+      setup_station_call(text);
+    else if (ini_view_equals(key, "Locator"))
+      setup_locator(text);
+  }
+  else if (strcmp(section, "FreeText") == 0)
+  {
+    if (ini_view_equals(key, "1"))
+      setup_free_text(text, FreeText1);
+    else if (ini_view_equals(key, "2"))
+      setup_free_text(text, FreeText2);
+  }
+  else if (strcmp(section, "BandData") == 0)
+  {
+    for (int idx = _40M; idx <= _10M; ++idx)
+    {
+      size_t band_data_size = value.length + 1;
+      if (ini_view_equals(key, band_keys[idx]) && band_data_size < BAND_DATA_SIZE)
+      {
+        sBand_Data[idx].Frequency = (uint16_t)(atof(text) * 1000);
+        memcpy(sBand_Data[idx].display, text, band_data_size);
+      }
+    }
+  }
+  else if (strcmp(section, "DecodeBudget") == 0)
+  {
+    for (int idx = _40M; idx <= _10M; ++idx)
+      if (ini_view_equals(key, band_keys[idx]) && atoi(text) > 0)
+        Decode_Budget_ms[idx] = (uint16_t)atoi(text);
+  }
+  else if (strcmp(section, "Decode") == 0)
+  {
+    int number = atoi(text);
+    if (ini_view_equals(key, "Early"))
+      Early_Decode = number != 0;
+    else if (ini_view_equals(key, "Passes") && number >= 1 && number <= kMax_decode_passes)
+      Decode_Passes = number;
+    else if (ini_view_equals(key, "MinSum") && number >= 0 && number <= kMax_decode_passes)
+      Min_Sum_Passes = number;
+    else if (ini_view_equals(key, "OSD") && number >= 0 && number <= 2)
+      OSD_Depth = number;
+    else if (ini_view_equals(key, "AP"))
+      AP_Decode = number != 0;
+    else if (ini_view_equals(key, "Bandwidth") && number > 0)
+      ft8_buffer = (int)(number / FFT_Resolution);
+    else if (ini_view_equals(key, "Capture"))
+      Capture_On = number != 0;
+  }
+  else if (strcmp(section, "Power") == 0)
+  {
+    int number = atoi(text);
+    if (ini_view_equals(key, "IdleMHz") && number >= 24 && number <= 600)
+      Idle_MHz = number;
+  }
+  else if (strcmp(section, "Telemetry") == 0)
+  {
+    int number = atoi(text);
+    if (ini_view_equals(key, "Decodes"))
+      Telemetry_Decodes_On = number != 0;
+    else if (ini_view_equals(key, "Spectra"))
+      Telemetry_Spectra_On = number != 0;
+    else if (ini_view_equals(key, "Profile"))
+      Telemetry_Profile_On = number != 0;
+  }
+}
+
+static COLD_CODE size_t read_station_data(void *source, char *buffer, size_t size)
+{
+  int bytes_read = ((File *)source)->read(buffer, size);
+  return bytes_read > 0 ? (size_t)bytes_read : 0;
+}
+
+COLD_CODE bool open_stationData_file(void)
 {
   Station_Call[0] = 0;
   Station_Locator[0] = 0;
@@ -147,7 +227,6 @@ bool open_stationData_file(void)
   Free_Text1[0] = 0;
   Free_Text2[0] = 0;
 
-  char read_buffer[256];
   if (!SD.begin(BUILTIN_SDCARD))
   {
     tft.textColor(RED, BLACK);
@@ -158,48 +237,14 @@ bool open_stationData_file(void)
   }
   else
   {
-    size_t bytes_read = 0;
     stationData_File = SD.open("StationData.ini", FILE_READ);
 
     if (stationData_File)
     {
       stationData_File.seek(0);
-      bytes_read = stationData_File.read(read_buffer, 256);
-      ini_data_t ini_data;
-      parse_ini(read_buffer, bytes_read, &ini_data);
-      const ini_section_t *section = get_ini_section(&ini_data, "Station");
-      if (section != NULL)
-      {
-        setup_station_call(get_ini_value_from_section(section, "Call"));
-        setup_locator(get_ini_value_from_section(section, "Locator"));
-      }
-
-      section = get_ini_section(&ini_data, "FreeText");
-      if (section != NULL)
-      {
-        setup_free_text(get_ini_value_from_section(section, "1"), FreeText1);
-        setup_free_text(get_ini_value_from_section(section, "2"), FreeText2);
-      }
-
-      section = get_ini_section(&ini_data, "BandData");
-      if (section != NULL)
-      {
-        // see BandIndex
-        static const char *bands[NumBands] = {"40", "30", "20", "17", "15", "12", "10"};
-        for (int idx = _40M; idx <= _10M; ++idx)
-        {
-          const char *band_data = get_ini_value_from_section(section, bands[idx]);
-          if (band_data != NULL)
-          {
-            size_t band_data_size = strlen(band_data) + 1;
-            if (band_data_size < BAND_DATA_SIZE)
-            {
-              sBand_Data[idx].Frequency = (uint16_t)(atof(band_data) * 1000);
-              memcpy(sBand_Data[idx].display, band_data, band_data_size);
-            }
-          }
-        }
-      }
+      int skipped = ini_parse_stream(read_station_data, &stationData_File, station_data_entry, NULL);
+      if (skipped > 0)
+        Serial.printf("StationData.ini: %d lines over %d characters skipped\n", skipped, MAX_LINE_LENGTH);
 
       stationData_File.close();
     }
@@ -207,6 +252,7 @@ bool open_stationData_file(void)
     {
       stationData_File = SD.open("StationData.txt", FILE_READ);
 
+      char read_buffer[65] = {0};
       if (stationData_File)
       {
         stationData_File.seek(0);
@@ -249,18 +295,15 @@ bool open_stationData_file(void)
   return true;
 }
 
-void display_station_data(int x, int y)
+COLD_CODE void display_station_data(int x, int y)
 {
   char str[13];
   sprintf(str, "%7s %4s", Station_Call, Short_Station_Locator);
 
-  tft.textColor(YELLOW, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(str, 13);
+  display_text(x, y, 2, YELLOW, BLACK, str, 13);
 }
 
-void display_revision_level(void)
+COLD_CODE void display_revision_level(void)
 {
   tft.textColor(YELLOW, BLACK);
   tft.setFontSize(2, true);
@@ -294,7 +337,7 @@ void display_revision_level(void)
 
   delay(5000);
 
-  tft.fillRect(0, 100, 300, 400, BLACK);
+  display_fill(0, 100, 300, 400, BLACK);
 }
 
 void show_decimal(uint16_t x, uint16_t y, float variable)
@@ -309,10 +352,7 @@ void show_decimal(uint16_t x, uint16_t y, float variable)
     fraction = fraction * -1;
   sprintf(str, "%3i.%3i", units, fraction);
 
-  tft.textColor(YELLOW, BLACK);
-  tft.setCursor(x, y);
-  tft.setFontSize(2, true);
-  tft.write(str, 8);
+  display_text(x, y, 2, YELLOW, BLACK, str, 8);
 }
 
 void Be_Patient(void)
@@ -9,6 +9,7 @@
 
 #include "encode.h"
 #include "constants.h"
+#include "protocol.h"
 
 // Returns 1 if an odd number of bits are set in x, zero otherwise
 static uint8_t parity8(uint8_t x)
@@ -105,10 +106,11 @@ uint16_t crc(uint8_t *message, int num_bits)
   return remainder & ((1 << CRC_WIDTH) - 1);
 }
 
-// Generate FT8 tone sequence from payload data
+// Generate the tone sequence of Protocol from payload data
 // [IN] payload - 10 byte array consisting of 77 bit payload (MSB first)
-// [OUT] itone  - array of NN (79) bytes to store the generated tones (encoded as 0..7)
-void genft8(const uint8_t *payload, uint8_t *itone)
+// [OUT] itone  - array of Protocol::nn bytes to store the generated tones (0 .. num_tones - 1)
+template <typename Protocol>
+void gen_tones(const uint8_t *payload, uint8_t *itone)
 {
   uint8_t a91[12]; // Store 77 bits of payload + 14 bits CRC
 
@@ -133,52 +135,41 @@ void genft8(const uint8_t *payload, uint8_t *itone)
   uint8_t codeword[22];
   encode174(a91, codeword);
 
-  // Message structure: S7 D29 S7 D29 S7
-  for (int i = 0; i < 7; ++i)
+  // Message structure: S7 D29 S7 D29 S7 for FT8
+  for (int block = 0; block < Protocol::num_sync_blocks; ++block)
   {
-    itone[i] = kCostas_map[i];
-    itone[36 + i] = kCostas_map[i];
-    itone[72 + i] = kCostas_map[i];
+    for (int i = 0; i < Protocol::sync_length; ++i)
+      itone[Protocol::sync_offsets[block] + i] = Protocol::sync_map[block][i];
   }
 
-  int k = 7; // Skip over the first set of Costas symbols
-
   uint8_t mask = 0x80;
   int i_byte = 0;
-  for (int j = 0; j < ND; ++j)
+  for (int j = 0; j < Protocol::nd; ++j)
   { // do j=1,ND
-    if (j == 29)
+    // Extract the bits of one symbol from codeword at i-th position
+    uint8_t bits = 0;
+    for (int b = 0; b < Protocol::bits_per_symbol; ++b)
     {
-      k += 7; // Skip over the second set of Costas symbols
+      bits <<= 1;
+      if (codeword[i_byte] & mask)
+        bits |= 1;
+      if (0 == (mask >>= 1))
+      {
+        mask = 0x80;
+        i_byte++;
+      }
     }
 
-    // Extract 3 bits from codeword at i-th position
-    uint8_t bits3 = 0;
+    itone[data_symbol<Protocol>(j)] = Protocol::gray_map[bits];
+  }
+}
 
-    if (codeword[i_byte] & mask)
-      bits3 |= 4;
+template void gen_tones<FT8_Protocol>(const uint8_t *payload, uint8_t *itone);
 
-    if (0 == (mask >>= 1))
-    {
-      mask = 0x80;
-      i_byte++;
-    }
-    if (codeword[i_byte] & mask)
-      bits3 |= 2;
-    if (0 == (mask >>= 1))
-    {
-      mask = 0x80;
-      i_byte++;
-    }
-    if (codeword[i_byte] & mask)
-      bits3 |= 1;
-    if (0 == (mask >>= 1))
-    {
-      mask = 0x80;
-      i_byte++;
-    }
-
-    itone[k] = kGray_map[bits3];
-    ++k;
-  }
+// Generate FT8 tone sequence from payload data
+// [IN] payload - 10 byte array consisting of 77 bit payload (MSB first)
+// [OUT] itone  - array of NN (79) bytes to store the generated tones (encoded as 0..7)
+void genft8(const uint8_t *payload, uint8_t *itone)
+{
+  gen_tones<FT8_Protocol>(payload, itone);
 }
@@ -26,3 +26,28 @@ const short FIR_Q[NUM_COEFFS] = {
     2271, 2283, 1829, 1124, 445, 20, -45, 207, 627, 1021, 1234, 1198, 948,
     588, 251, 39, -6, 92, 260, 414, 489, 460, 346, 194, 56, -29, -47, -9,
     55, 115, 146, 139, 98, 41, -15, 0};
+
+// Anti-alias low pass for the decimation by 5 from 32 kHz to 6.4 kHz: Kaiser windowed sinc,
+// flat to 3 kHz, 40 dB down at 3.4 kHz, whose alias lands on 3 kHz, and 70 dB from 3.5 kHz,
+// so that the whole of the widest passband (ft8_max_buffer) is clear of aliases
+const short FIR_Decimate[NUM_DECIMATE_COEFFS] = {
+    -3, -2, 0, 2, 4, 5, 3, 0, -4, -7, -7, -5,
+    0, 6, 10, 11, 7, 0, -8, -14, -15, -10, 0, 11,
+    19, 20, 13, 0, -15, -25, -26, -17, 0, 19, 32, 34,
+    22, 0, -24, -41, -43, -28, 0, 30, 51, 53, 34, 0,
+    -37, -63, -66, -42, 0, 46, 77, 80, 52, 0, -56, -94,
+    -98, -63, 0, 68, 114, 119, 76, 0, -82, -139, -144, -92,
+    0, 100, 168, 174, 112, 0, -121, -204, -212, -137, 0, 148,
+    250, 261, 168, 0, -183, -310, -325, -210, 0, 232, 395, 416,
+    271, 0, -304, -522, -556, -367, 0, 424, 742, 807, 546, 0,
+    -672, -1227, -1405, -1016, 0, 1529, 3301, 4956, 6129, 6553, 6129, 4956,
+    3301, 1529, 0, -1016, -1405, -1227, -672, 0, 546, 807, 742, 424,
+    0, -367, -556, -522, -304, 0, 271, 416, 395, 232, 0, -210,
+    -325, -310, -183, 0, 168, 261, 250, 148, 0, -137, -212, -204,
+    -121, 0, 112, 174, 168, 100, 0, -92, -144, -139, -82, 0,
+    76, 119, 114, 68, 0, -63, -98, -94, -56, 0, 52, 80,
+    77, 46, 0, -42, -66, -63, -37, 0, 34, 53, 51, 30,
+    0, -28, -43, -41, -24, 0, 22, 34, 32, 19, 0, -17,
+    -26, -25, -15, 0, 13, 20, 19, 11, 0, -10, -15, -14,
+    -8, 0, 7, 11, 10, 6, 0, -5, -7, -7, -4, 0,
+    3, 5, 4, 2, 0, -2, -3};
@@ -29,6 +29,8 @@
 #include "ADIF.h"
 #include "main.h"
 #include "button.h"
+#include "DisplayQueue.h"
+#include "autoseq_engine.h"
 
 char Target_Call[14];   // six character call sign + /0
 char Target_Locator[7]; // six character locator  + /0
@@ -39,7 +41,7 @@ const int left_hand_message = 300;
 
 void clear_reply_message_box(void)
 {
-  tft.fillRect(left_hand_message, 100, 290, 420, BLACK);
+  display_fill(left_hand_message, 100, 290, 420, BLACK);
 }
 
 char Free_Text1[MESSAGE_SIZE] = "FreeText 1   ";
@@ -49,15 +51,20 @@ static const char CQ_message[] = "                  ";
 
 void erase_CQ(void)
 {
-  tft.setFontSize(2, true);
-  tft.textColor(BLACK, BLACK);
-  tft.setCursor(left_hand_message, 520);
-  tft.write(CQ_message, 18);
+  display_text(left_hand_message, 520, 2, BLACK, BLACK, CQ_message, 18);
 }
 
-// Needed by autoseq_engine
+// Needed by autoseq_engine. The messages of a QSO are mostly encoded already by
+// autoseq_prepare_tx(), which leaves only a copy of their tones to do here.
 void queue_custom_text(const char *tx_msg)
 {
+  const uint8_t *cached = autoseq_cached_tones(tx_msg);
+  if (cached != NULL)
+  {
+    memcpy(tones, cached, sizeof(tones));
+    return;
+  }
+
   uint8_t packed[K_BYTES];
 
   pack77(tx_msg, packed);
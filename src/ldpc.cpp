@@ -20,6 +20,49 @@
 #include <math.h>
 
 #include "constants.h"
+#include "ldpc_tables.h"
+#include "MemoryMap.h"
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include "arm_math.h" // __QSUB8
+#endif
+
+// The Tanner graph of the code, derived from kNm and kMn at compile time. Edges are
+// numbered check by check, so the edges of check j are check_start[j] to check_start[j + 1] - 1,
+// and the messages along them lie side by side. Edge e joins its check to bit edge_bit[e],
+// and bit_edges[i] are the edges of bit i in the order of kMn[i].
+static constexpr int kEdges = 174 * 3;
+
+struct Tanner_Graph
+{
+  uint16_t check_start[83 + 1];
+  uint8_t edge_bit[kEdges];
+  uint16_t bit_edges[174][3];
+};
+
+static constexpr Tanner_Graph make_tanner_graph()
+{
+  Tanner_Graph graph = {};
+  int edge = 0;
+  for (int j = 0; j < 83; ++j)
+  {
+    graph.check_start[j] = edge;
+    for (int k = 0; k < kNrw[j]; ++k)
+    {
+      int bit = kNm[j][k] - 1;
+      graph.edge_bit[edge] = bit;
+      for (int kk = 0; kk < 3; ++kk)
+        if (kMn[bit][kk] - 1 == j)
+          graph.bit_edges[bit][kk] = edge;
+      ++edge;
+    }
+  }
+  graph.check_start[83] = edge;
+  return graph;
+}
+
+static constexpr Tanner_Graph kGraph = make_tanner_graph();
+static_assert(kGraph.check_start[83] == kEdges, "every bit takes part in three checks");
 
 static int ldpc_check(uint8_t codeword[]);
 static float fast_tanh(float x);
@@ -52,86 +95,14 @@ void pack_bits(const uint8_t plain[], int num_bits, uint8_t packed[])
   }
 }
 
-// codeword is 174 log-likelihoods.
-// plain is a return value, 174 ints, to be 0 or 1.
-// max_iters is how hard to try.
-// ok == 87 means success.
-void ldpc_decode(float *codeword, int max_iters, uint8_t plain[], int *ok)
+bool payload_is_zero(const uint8_t packed[])
 {
-  float m[M][N]; // ~60 kB
-  float e[M][N]; // ~60 kB
-  int min_errors = M;
-
-  for (int j = 0; j < M; j++)
+  for (int i = 0; i < 9; ++i)
   {
-    for (int i = 0; i < N; i++)
-    {
-      m[j][i] = codeword[i];
-      e[j][i] = 0.0f;
-    }
-  }
-
-  for (int iter = 0; iter < max_iters; iter++)
-  {
-    for (int j = 0; j < M; j++)
-    {
-      for (int ii1 = 0; ii1 < kNrw[j]; ii1++)
-      {
-        int i1 = kNm[j][ii1] - 1;
-        float a = 1.0f;
-        for (int ii2 = 0; ii2 < kNrw[j]; ii2++)
-        {
-          int i2 = kNm[j][ii2] - 1;
-          if (i2 != i1)
-          {
-            a *= fast_tanh(-m[j][i2] / 2.0f);
-          }
-        }
-        e[j][i1] = logf((1 - a) / (1 + a));
-      }
-    }
-
-    for (int i = 0; i < N; i++)
-    {
-      float l = codeword[i];
-      for (int j = 0; j < 3; j++)
-        l += e[kMn[i][j] - 1][i];
-      plain[i] = (l > 0) ? 1 : 0;
-    }
-
-    int errors = ldpc_check(plain);
-
-    if (errors < min_errors)
-    {
-      // Update the current best result
-      min_errors = errors;
-
-      if (errors == 0)
-      {
-        break; // Found a perfect answer
-      }
-    }
-
-    for (int i = 0; i < N; i++)
-    {
-      for (int ji1 = 0; ji1 < 3; ji1++)
-      {
-        int j1 = kMn[i][ji1] - 1;
-        float l = codeword[i];
-        for (int ji2 = 0; ji2 < 3; ji2++)
-        {
-          if (ji1 != ji2)
-          {
-            int j2 = kMn[i][ji2] - 1;
-            l += e[j2][i];
-          }
-        }
-        m[j1][i] = l;
-      }
-    }
+    if (packed[i])
+      return false;
   }
-
-  *ok = min_errors;
+  return (packed[9] & 0xF8) == 0;
 }
 
 //
@@ -139,16 +110,16 @@ void ldpc_decode(float *codeword, int max_iters, uint8_t plain[], int *ok)
 // returns the number of parity errors.
 // 0 means total success.
 //
-static int ldpc_check(uint8_t codeword[])
+static HOT_CODE int ldpc_check(uint8_t codeword[])
 {
   int errors = 0;
 
   for (int j = 0; j < M; ++j)
   {
     uint8_t x = 0;
-    for (int i = 0; i < kNrw[j]; ++i)
+    for (int e = kGraph.check_start[j]; e < kGraph.check_start[j + 1]; ++e)
     {
-      x ^= codeword[kNm[j][i] - 1];
+      x ^= codeword[kGraph.edge_bit[e]];
     }
     if (x != 0)
     {
@@ -158,28 +129,19 @@ static int ldpc_check(uint8_t codeword[])
   return errors;
 }
 
-void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok)
+HOT_CODE void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok)
 {
-  float tov[N][3];
-  float toc[M][7];
+  // Messages along each edge, from the check to its bit and from the bit to its check
+  float tov[kEdges];
+  float toc[kEdges];
 
   int min_errors = M;
 
   // initialize messages to checks
-  for (int i = 0; i < M; ++i)
+  for (int e = 0; e < kEdges; ++e)
   {
-    for (int j = 0; j < kNrw[i]; ++j)
-    {
-      toc[i][j] = codeword[kNm[i][j] - 1];
-    }
-  }
-
-  for (int i = 0; i < N; ++i)
-  {
-    for (int j = 0; j < 3; ++j)
-    {
-      tov[i][j] = 0;
-    }
+    toc[e] = codeword[kGraph.edge_bit[e]];
+    tov[e] = 0;
   }
 
   for (int iter = 0; iter < max_iters; ++iter)
@@ -189,7 +151,8 @@ void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok)
     // Update bit log likelihood ratios (tov=0 in iter 0)
     for (int i = 0; i < N; ++i)
     {
-      zn[i] = codeword[i] + tov[i][0] + tov[i][1] + tov[i][2];
+      const uint16_t *edges = kGraph.bit_edges[i];
+      zn[i] = codeword[i] + tov[edges[0]] + tov[edges[1]] + tov[edges[2]];
       plain[i] = (zn[i] > 0) ? 1 : 0;
     }
 
@@ -207,47 +170,142 @@ void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok)
       }
     }
 
-    // Send messages from bits to check nodes
-    for (int i = 0; i < M; ++i)
+    // Send messages from bits to check nodes, less what the bit had received from the check
+    for (int e = 0; e < kEdges; ++e)
+    {
+      toc[e] = fast_tanh(-(zn[kGraph.edge_bit[e]] - tov[e]) / 2);
+    }
+
+    // send messages from check nodes to variable nodes
+    for (int j = 0; j < M; ++j)
     {
-      for (int j = 0; j < kNrw[i]; ++j)
+      int first = kGraph.check_start[j];
+      int last = kGraph.check_start[j + 1];
+      for (int e = first; e < last; ++e)
       {
-        int ibj = kNm[i][j] - 1;
-        toc[i][j] = zn[ibj];
-        for (int kk = 0; kk < 3; ++kk)
+        float Tmn = 1.0f;
+        for (int k = first; k < last; ++k)
         {
-          // subtract off what the bit had received from the check
-          if (kMn[ibj][kk] - 1 == i)
+          if (k != e)
           {
-            toc[i][j] -= tov[ibj][kk];
+            Tmn *= toc[k];
           }
         }
+        tov[e] = 2 * fast_atanh(-Tmn);
       }
     }
+  }
 
-    // send messages from check nodes to variable nodes
-    for (int i = 0; i < M; ++i)
+  *ok = min_errors;
+}
+
+// Messages of the min-sum decoder are bytes in steps of 1 / kMin_sum_scale of a log
+// likelihood, which covers the +-30 or so extract_likelihood() leaves after normalising.
+static constexpr float kMin_sum_scale = 4.0f;
+static constexpr int kPadded_edges = (kEdges + 3) & ~3; // whole words for the SIMD subtract
+
+static inline int8_t saturate8(int x)
+{
+  return x > 127 ? 127 : (x < -128 ? -128 : x);
+}
+
+// out = a - b on every edge, saturating, four edges at a time where the core can
+static void subtract_messages(const int8_t *a, const int8_t *b, int8_t *out)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+  const uint32_t *a4 = (const uint32_t *)a;
+  const uint32_t *b4 = (const uint32_t *)b;
+  uint32_t *out4 = (uint32_t *)out;
+  for (int e = 0; e < kPadded_edges / 4; ++e)
+    out4[e] = __QSUB8(a4[e], b4[e]);
+#else
+  for (int e = 0; e < kPadded_edges; ++e)
+    out[e] = saturate8(a[e] - b[e]);
+#endif
+}
+
+// Normalized min-sum: a check sends each of its bits 7/8 of the smallest magnitude among
+// its other bits' messages, for the value that agrees with their parity. A fraction of the cost of
+// bp_decode(), at some loss of sensitivity. Same arguments and result as bp_decode().
+HOT_CODE void ms_decode(const float codeword[], int max_iters, uint8_t plain[], int *ok)
+{
+  int8_t llr[N];
+  int8_t zn[N];
+  int8_t __attribute__((aligned(4))) zn_edge[kPadded_edges];
+  int8_t __attribute__((aligned(4))) toc[kPadded_edges];
+  int8_t __attribute__((aligned(4))) tov[kPadded_edges];
+
+  int min_errors = M;
+
+  for (int i = 0; i < N; ++i)
+    llr[i] = saturate8(lrintf(codeword[i] * kMin_sum_scale));
+  for (int e = 0; e < kPadded_edges; ++e)
+  {
+    zn_edge[e] = 0;
+    tov[e] = 0;
+  }
+
+  for (int iter = 0; iter < max_iters; ++iter)
+  {
+    for (int i = 0; i < N; ++i)
+    {
+      const uint16_t *edges = kGraph.bit_edges[i];
+      int sum = llr[i] + tov[edges[0]] + tov[edges[1]] + tov[edges[2]];
+      zn[i] = saturate8(sum);
+      plain[i] = (sum > 0) ? 1 : 0;
+    }
+
+    int errors = ldpc_check(plain);
+
+    if (errors < min_errors)
     {
-      for (int j = 0; j < kNrw[i]; ++j)
+      min_errors = errors;
+
+      if (errors == 0)
       {
-        toc[i][j] = fast_tanh(-toc[i][j] / 2);
+        break; // Found a perfect answer
       }
     }
 
-    for (int i = 0; i < N; ++i)
+    // Bits to checks, less what the bit had received from the check
+    for (int e = 0; e < kEdges; ++e)
+      zn_edge[e] = zn[kGraph.edge_bit[e]];
+    subtract_messages(zn_edge, tov, toc);
+
+    // Checks to bits
+    for (int j = 0; j < M; ++j)
     {
-      for (int j = 0; j < 3; ++j)
+      int first = kGraph.check_start[j];
+      int last = kGraph.check_start[j + 1];
+
+      int min1 = 127, min2 = 127, min1_edge = first;
+      int ones = 0; // parity of the bits the messages point to
+      for (int e = first; e < last; ++e)
       {
-        int ichk = kMn[i][j] - 1; // kMn(:,j) are the checks that include bit j
-        float Tmn = 1.0f;
-        for (int k = 0; k < kNrw[ichk]; ++k)
+        int magnitude = toc[e] < 0 ? -toc[e] : toc[e];
+        if (magnitude > 127)
+          magnitude = 127;
+        ones ^= toc[e] > 0;
+
+        if (magnitude < min1)
         {
-          if (kNm[ichk][k] - 1 != i)
-          {
-            Tmn *= toc[ichk][k];
-          }
+          min2 = min1;
+          min1 = magnitude;
+          min1_edge = e;
+        }
+        else if (magnitude < min2)
+        {
+          min2 = magnitude;
         }
-        tov[i][j] = 2 * fast_atanh(-Tmn);
+      }
+
+      int scaled1 = (min1 * 7) >> 3;
+      int scaled2 = (min2 * 7) >> 3;
+      for (int e = first; e < last; ++e)
+      {
+        int magnitude = (e == min1_edge) ? scaled2 : scaled1;
+        // The bit is likely whatever makes the parity of the others even
+        tov[e] = (ones ^ (toc[e] > 0)) ? magnitude : -magnitude;
       }
     }
   }
@@ -261,7 +319,7 @@ void bp_decode(float codeword[], int max_iters, uint8_t plain[], int *ok)
 
 // thank you Douglas Bagnall
 // https://math.stackexchange.com/a/446411
-static float fast_tanh(float x)
+static HOT_CODE float fast_tanh(float x)
 {
   if (x < -4.97f)
   {
@@ -277,7 +335,7 @@ static float fast_tanh(float x)
   return a / b;
 }
 
-static float fast_atanh(float x)
+static HOT_CODE float fast_atanh(float x)
 {
   float x2 = x * x;
   float a = x * (945.0f + x2 * (-735.0f + x2 * 64.0f));
@@ -6,6 +6,7 @@
 #include "display.h"
 #include "options.h"
 #include "button.h"
+#include "MemoryMap.h"
 #include "stdio.h"
 
 #define sentinel 1948 // 1037, 1945, 1066,
@@ -35,7 +36,7 @@ OptionStruct s_optionsData[] = {
         /*Name*/ "  Map_Index ", // opt0
         /*Init*/ 0,
         /*Min */ 0,
-        /*Max */ 2,
+        /*Max */ 5, // numMaps - 1
         /*Rate*/ 1,
         /*Data*/ 0,
     }};
@@ -51,7 +52,7 @@ void Options_SetValue(int optionIdx, int16_t newValue)
   s_optionsData[optionIdx].CurrentValue = newValue;
 }
 
-static void Options_ResetToDefaults(void)
+static COLD_CODE void Options_ResetToDefaults(void)
 {
   for (int i = 0; i < NUM_OPTIONS; i++)
   {
@@ -60,7 +61,7 @@ static void Options_ResetToDefaults(void)
 }
 
 // Initialization
-void Options_Initialize(void)
+COLD_CODE void Options_Initialize(void)
 {
   if (EEPROMReadInt(10) == sentinel)
   {
@@ -0,0 +1,208 @@
+//
+// Ordered statistics decoder for FT8, after osd174_91 in WSJT-X.
+//
+// The codewords are held 174 bits to three 64 bit words, bit i in word i / 64. The
+// generator is put in systematic form on the most reliable basis (MRB) by Gaussian
+// elimination of its columns in order of reliability, after which the codeword of any
+// choice of the basis bits is the XOR of the rows of the bits that are set.
+//
+#include <string.h>
+#include <math.h>
+
+#include "constants.h"
+#include "encode.h"
+#include "osd.h"
+#include "MemoryMap.h"
+
+struct Osd_Word
+{
+  uint64_t w[3];
+};
+
+// Flipping pairs is limited to the least reliable basis bits, where the errors are
+static constexpr int kPair_span = 40;
+
+// The generator, a row per message bit, made with encode174() the first time
+static Osd_Word generator[91];
+static bool generator_made = false;
+
+static void make_generator(void)
+{
+  for (int k = 0; k < K; ++k)
+  {
+    uint8_t message[12] = {0};
+    uint8_t packed[22];
+    message[k / 8] = 0x80 >> (k % 8);
+    encode174(message, packed);
+
+    memset(&generator[k], 0, sizeof(generator[k]));
+    for (int i = 0; i < N; ++i)
+      if (packed[i / 8] & (0x80 >> (i % 8)))
+        generator[k].w[i / 64] |= 1ULL << (i % 64);
+  }
+  generator_made = true;
+}
+
+static inline bool get_bit(const Osd_Word *word, int i)
+{
+  return (word->w[i / 64] >> (i % 64)) & 1;
+}
+
+static inline void xor_word(Osd_Word *a, const Osd_Word *b)
+{
+  a->w[0] ^= b->w[0];
+  a->w[1] ^= b->w[1];
+  a->w[2] ^= b->w[2];
+}
+
+// Sum of the reliabilities of the bits set in diff, given up once it reaches limit
+static float distance(const Osd_Word *diff, const float reliability[], float limit)
+{
+  float d = 0;
+  for (int w = 0; w < 3; ++w)
+  {
+    uint64_t x = diff->w[w];
+    while (x)
+    {
+      d += reliability[w * 64 + __builtin_ctzll(x)];
+      if (d >= limit)
+        return d;
+      x &= x - 1;
+    }
+  }
+  return d;
+}
+
+static bool crc_passes(const Osd_Word *codeword)
+{
+  uint8_t a91[12] = {0};
+  for (int i = 0; i < K; ++i)
+    if (get_bit(codeword, i))
+      a91[i / 8] |= 0x80 >> (i % 8);
+
+  uint16_t chksum = ((a91[9] & 0x07) << 11) | (a91[10] << 3) | (a91[11] >> 5);
+  a91[9] &= 0xF8;
+  a91[10] = 0;
+  a91[11] = 0;
+  return chksum == crc(a91, 96 - 14);
+}
+
+// The nearest codeword found so far
+struct Osd_Search
+{
+  const float *reliability;
+  float best;
+  Osd_Word best_diff;
+};
+
+static void consider(Osd_Search *search, const Osd_Word *diff)
+{
+  float d = distance(diff, search->reliability, search->best);
+  if (d >= search->best)
+    return;
+
+  search->best = d;
+  search->best_diff = *diff;
+}
+
+HOT_CODE int osd_decode(const float codeword[], int depth, uint8_t plain[])
+{
+  if (!generator_made)
+    make_generator();
+
+  float reliability[N];
+  Osd_Word hard = {};
+  for (int i = 0; i < N; ++i)
+  {
+    reliability[i] = fabsf(codeword[i]);
+    if (codeword[i] > 0)
+      hard.w[i / 64] |= 1ULL << (i % 64);
+  }
+
+  // Bits by reliability, most reliable first
+  uint8_t order[N];
+  for (int i = 0; i < N; ++i)
+  {
+    int j = i;
+    while (j > 0 && reliability[order[j - 1]] < reliability[i])
+    {
+      order[j] = order[j - 1];
+      --j;
+    }
+    order[j] = i;
+  }
+
+  // Gaussian elimination, taking pivots from the most reliable columns
+  Osd_Word rows[91];
+  memcpy(rows, generator, sizeof(rows));
+  int rank = 0;
+  int basis[91];
+  for (int c = 0; c < N && rank < K; ++c)
+  {
+    int column = order[c];
+    int pivot = -1;
+    for (int r = rank; r < K && pivot < 0; ++r)
+      if (get_bit(&rows[r], column))
+        pivot = r;
+    if (pivot < 0)
+      continue;
+
+    Osd_Word swap = rows[rank];
+    rows[rank] = rows[pivot];
+    rows[pivot] = swap;
+    for (int r = 0; r < K; ++r)
+      if (r != rank && get_bit(&rows[r], column))
+        xor_word(&rows[r], &rows[rank]);
+    basis[rank++] = column;
+  }
+
+  // The codeword of the basis as received, as the difference from the hard decisions
+  Osd_Word diff0 = hard;
+  for (int r = 0; r < rank; ++r)
+    if (get_bit(&hard, basis[r]))
+      xor_word(&diff0, &rows[r]);
+
+  Osd_Search search;
+  search.reliability = reliability;
+  search.best = INFINITY;
+
+  Osd_Word diff;
+  consider(&search, &diff0);
+  for (int r = 0; r < rank; ++r)
+  {
+    diff = diff0;
+    xor_word(&diff, &rows[r]);
+    consider(&search, &diff);
+  }
+
+  if (depth >= 2)
+  {
+    int first = rank > kPair_span ? rank - kPair_span : 0;
+    for (int r1 = first; r1 < rank; ++r1)
+    {
+      Osd_Word diff1 = diff0;
+      xor_word(&diff1, &rows[r1]);
+      for (int r2 = r1 + 1; r2 < rank; ++r2)
+      {
+        diff = diff1;
+        xor_word(&diff, &rows[r2]);
+        consider(&search, &diff);
+      }
+    }
+  }
+
+  // Checking only the winner keeps the CRC's protection against false decodes
+  Osd_Word decoded = search.best_diff;
+  xor_word(&decoded, &hard);
+  if (!crc_passes(&decoded))
+    return -1;
+
+  int hard_errors = 0;
+  for (int i = 0; i < N; ++i)
+  {
+    bool flipped = get_bit(&search.best_diff, i);
+    hard_errors += flipped;
+    plain[i] = get_bit(&hard, i) != flipped;
+  }
+  return hard_errors;
+}
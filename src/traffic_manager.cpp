@@ -6,13 +6,73 @@
 #include "display.h"
 #include "decode_ft8.h"
 #include "gen_ft8.h"
+#include "constants.h"
+#include "protocol.h"
 #include "button.h"
 #include "main.h"
 
-#define FT8_TONE_SPACING 625
+#define FT8_TONE_SPACING ((uint64_t)(FT8_Protocol::tone_spacing_hz * 100)) // in 0.01 Hz, as set_freq() takes
+#define FT8_SYMBOL_US FT8_Protocol::symbol_us
+#define RFRAC_DENOM 1000000ULL
 
 static uint64_t F_Long, F_FT8, F_Receive;
 
+// The multisynth 0 registers (42..49) of each of the 8 tones, worked out at TX start so
+// that a tone change is a single I2C burst of the bytes that differ between them
+static uint8_t tone_registers[8][8];
+static uint8_t tone_first_register, tone_register_count;
+
+static IntervalTimer symbol_clock;
+
+// The symbol the clock last asked for, and the one whose tone is on the Si5351. The I2C
+// write is left to the loop, which owns Wire, see service_FT8_tone().
+static volatile int tone_due_symbol = -1;
+static int tone_set_symbol = -1;
+
+// Registers 42..49 as Si5351::set_ms() lays them out, for the PLL left running by set_freq()
+static void make_tone_registers(uint8_t *registers, uint64_t freq, uint8_t reg44_high)
+{
+  uint64_t pll_freq = si5351.plla_freq;
+  uint32_t a = pll_freq / freq;
+  uint32_t b = (pll_freq % freq * RFRAC_DENOM) / freq;
+  uint32_t c = b ? RFRAC_DENOM : 1;
+
+  uint32_t p1 = 128 * a + ((128 * b) / c) - 512;
+  uint32_t p2 = 128 * b - c * ((128 * b) / c);
+  uint32_t p3 = c;
+
+  registers[0] = (p3 >> 8) & 0xFF;
+  registers[1] = p3 & 0xFF;
+  registers[2] = reg44_high | ((p1 >> 16) & 0x03);
+  registers[3] = (p1 >> 8) & 0xFF;
+  registers[4] = p1 & 0xFF;
+  registers[5] = ((p3 >> 12) & 0xF0) | ((p2 >> 16) & 0x0F);
+  registers[6] = (p2 >> 8) & 0xFF;
+  registers[7] = p2 & 0xFF;
+}
+
+// Called with F_Long just set, which has programmed everything about CLK0 but its divider
+static void prepare_FT8_tones(void)
+{
+  // The R divider and divide by 4 bits, the same for all the tones
+  uint8_t reg44_high = si5351.si5351_read(SI5351_CLK0_PARAMETERS + 2) & ~0x03;
+  for (int tone = 0; tone < 8; ++tone)
+    make_tone_registers(tone_registers[tone], F_Long + (uint64_t)tone * FT8_TONE_SPACING, reg44_high);
+
+  int first = 8, last = -1;
+  for (int i = 0; i < 8; ++i)
+    for (int tone = 1; tone < 8; ++tone)
+      if (tone_registers[tone][i] != tone_registers[0][i])
+      {
+        if (i < first)
+          first = i;
+        if (i > last)
+          last = i;
+      }
+  tone_first_register = first < 8 ? first : 0;
+  tone_register_count = last >= first ? last - first + 1 : 8;
+}
+
 static void set_Xmit_Freq(void)
 {
   F_Long = (((uint64_t)start_freq * 1000 + (uint64_t)cursor_freq) * 100);
@@ -42,11 +102,57 @@ void tune_Off_sequence(void)
 void set_FT8_Tone(uint8_t ft8_tone)
 {
   F_FT8 = F_Long + (uint64_t)ft8_tone * FT8_TONE_SPACING;
-  si5351.set_freq(F_FT8, SI5351_CLK0);
+  si5351.si5351_write_bulk(SI5351_CLK0_PARAMETERS + tone_first_register, tone_register_count,
+                           &tone_registers[ft8_tone][tone_first_register]);
+}
+
+// The TX symbols are clocked here rather than by the DSP gulps, which come whenever the
+// loop gets to them. Only the symbol is noted, the touch controller shares Wire.
+static void FT8_symbol_tick(void)
+{
+  int symbol = ft8_xmit_counter - FT8_TX_OFFSET_SYMBOLS;
+  if (symbol >= 0 && symbol < 79)
+    tone_due_symbol = symbol;
+
+  if (++ft8_xmit_counter >= FT8_TX_END_SYMBOL)
+    symbol_clock.end();
+}
+
+void start_FT8_symbol_clock(uint32_t slot_ms)
+{
+  // The first tick on the next symbol boundary of the slot, from then on every symbol
+  uint32_t first_us = (FT8_SYMBOL_US / 1000 - slot_ms % (FT8_SYMBOL_US / 1000)) * 1000;
+  tone_due_symbol = -1;
+  tone_set_symbol = -1;
+  symbol_clock.begin(FT8_symbol_tick, first_us);
+  symbol_clock.update(FT8_SYMBOL_US);
+}
+
+bool FT8_tone_due(void)
+{
+  return tone_due_symbol != tone_set_symbol;
+}
+
+// Called from the loop and between decode candidates. A loop pass is a few ms against a
+// 160 ms symbol, so the tone lands a fraction of a symbol after the clock tick.
+void service_FT8_tone(void)
+{
+  int symbol = tone_due_symbol;
+  if (symbol < 0 || symbol == tone_set_symbol)
+    return;
+
+  set_FT8_Tone(tones[symbol]);
+  tone_set_symbol = symbol;
+}
+
+bool FT8_transmit_done(void)
+{
+  return ft8_xmit_counter >= FT8_TX_END_SYMBOL;
 }
 
 void ft8_receive_sequence(void)
 {
+  symbol_clock.end();
   si5351.output_enable(SI5351_CLK0, 0);
   sgtl5000.lineInLevel(RX_volume);
   set_RF_Gain(RF_Gain);
@@ -56,7 +162,7 @@ void ft8_receive_sequence(void)
 void ft8_transmit_sequence(void)
 {
   set_Xmit_Freq();
-  si5351.set_freq(F_Long, SI5351_CLK0);
+  prepare_FT8_tones();
   sgtl5000.lineInLevel(0);
   set_RF_Gain(1);
   set_Attenuator_Gain(0.05);
@@ -1,6 +1,7 @@
 
 #include "unpack.h"
 #include "text.h"
+#include "CallHash.h"
 
 #include <string.h>
 
@@ -62,10 +63,14 @@ static int unpack28(uint32_t n28, uint8_t ip, uint8_t i3, char *result)
   n28 = n28 - NTOKENS;
   if (n28 < MAX22)
   {
-    // This is a 22-bit hash of a result
-    // call hash22(n22,c13)     !Retrieve result from hash table
-    // TODO: implement
-    // strcpy(result, "<...>");
+    // This is a 22-bit hash of a result, shown as <CALL> once it resolves
+    const char *call = call_hash_lookup22(n28);
+    if (call != NULL)
+    {
+      result[0] = '<';
+      strcpy(stpcpy(result + 1, call), ">");
+      return 0;
+    }
     result[0] = '<';
     int_to_dd(result + 1, n28, 7, 1);
     result[8] = '>';
@@ -93,6 +98,7 @@ static int unpack28(uint32_t n28, uint8_t ip, uint8_t i3, char *result)
   strcpy(result, trim(callsign));
   if (strlen(result) == 0)
     return -1;
+  call_hash_insert(result);
 
   // Check if we should append /R or /P suffix
   if (ip)
@@ -293,16 +299,23 @@ static int unpack_nonstandard(const uint8_t *a77, char *field1, char *field2,
   }
 
   char call_3[15];
-  // should replace with hash12(n12, call_3);
-  // strcpy(call_3, "<...>");
-  call_3[0] = '<';
-  int_to_dd(call_3 + 1, n12, 4, 1);
-  call_3[5] = '>';
-  call_3[6] = '\0';
+  const char *hashed = call_hash_lookup12(n12);
+  if (hashed != NULL)
+  {
+    call_3[0] = '<';
+    strcpy(stpcpy(call_3 + 1, hashed), ">");
+  }
+  else
+  {
+    call_3[0] = '<';
+    int_to_dd(call_3 + 1, n12, 4, 1);
+    call_3[5] = '>';
+    call_3[6] = '\0';
+  }
 
   char *call_1 = (iflip) ? c11 : call_3;
   char *call_2 = (iflip) ? call_3 : c11;
-  // save_hash_call(c11_trimmed);
+  call_hash_insert(trim(c11));
 
   if (icq == 0)
   {